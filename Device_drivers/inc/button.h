@@ -3,17 +3,101 @@
 *@brief provide functions for interfacing with button
 *
 *This header file provide functions for interfacing with button.
+*Button is either read directly (button_init, button_read) or its edges are captured by EXTI interrupt (button_event_init):
+*interrupt handler filter bounces and put press and release events with time stamp (DWT cycle count) into a lock-free queue
+*(interrupt handler is the only producer, button_get_event caller the only consumer), so presses shorter than polling period are not lost.
+*
+*Debounce filter: an edge changing level of button is reported at once, then edges are ignored for debounce time. If level at end of
+*debounce time differ from reported one (button released during debounce time), it is reported with time of its last edge when
+*button_get_event is called (or on next edge).
 *
 *@author Tran Thanh Nhan
 *@date 16/08/2019
 */
 
+/*
+ *@version 1.1
+ *date 17/10/2026
+ *add press and release events captured by EXTI interrupt with debounce filter (button_event_init, button_intrpt_handler,
+ *button_get_event, button_flush_events)
+ */
+
 #ifndef BUTTON_H
 #define BUTTON_H
 
 #include "stm32f407xx.h"                  // Device header
 #include "../../Peripheral_drivers/inc/stm32f407xx_gpio.h"
+#include "../../Peripheral_drivers/inc/stm32f407xx_dwt.h"
+#include "../../Peripheral_drivers/inc/stm32f407xx_rcc.h"
+
+/***********************************************************************
+Macro definition
+***********************************************************************/
+
+#define BUTTON_MAX_EVENT_BUTTONS	4
+#define BUTTON_EVENT_QUEUE_SIZE		16		/*power of 2 up to 128*/
+#define BUTTON_NO_BUTTON			0xFF	/*returned by button_event_init when every button is used*/
+
+/*
+*@BUTTON_EVENT_TYPE
+*/
+#define BUTTON_RELEASED		0
+#define BUTTON_PRESSED		1
+
+/***********************************************************************
+Button structure definition
+***********************************************************************/
 
-void button_init (GPIO_TypeDef *GPIOxPtr, uint8_t pinNumber, uint8_t puPdr);	
+typedef struct{
+	uint32_t timestamp;	/*DWT cycle count at edge*/
+	uint8_t button;		/*number returned by button_event_init*/
+	uint8_t type;		/*refer to @BUTTON_EVENT_TYPE*/
+}Button_Event_t;
+
+/***********************************************************************
+Button APIs prototype
+***********************************************************************/
+
+void button_init (GPIO_TypeDef *GPIOxPtr, uint8_t pinNumber, uint8_t puPdr);
 uint8_t button_read (GPIO_TypeDef *GPIOxPtr, uint8_t pinNumber);
-#endif
\ No newline at end of file
+
+/**
+*@brief 	Initialize button whose edges are captured by EXTI interrupt
+*
+*Pin interrupt is enabled on both edges, EXTIx_IRQHandler of pin must call button_intrpt_handler. DWT cycle counter is enabled
+*(and reset) for time stamps. System clock must be set before, debounce time is converted into CPU cycles.
+*
+*@param 	Pointer to GPIO port x
+*@param 	GPIO pin number (one button per EXTI line: pin number of each button must differ)
+*@param 	Pull up (pressed button read 0) or pull down (pressed button read 1), refer to GPIO_PUPDR_MODE
+*@param 	Debounce time in microseconds
+*@return 	Number of button in events, BUTTON_NO_BUTTON if BUTTON_MAX_EVENT_BUTTONS are already initialized
+*/
+uint8_t button_event_init (GPIO_TypeDef *GPIOxPtr, uint8_t pinNumber, uint8_t puPdr, uint32_t debounceTime);
+
+/**
+*@brief 	Handle EXTI interrupt of button pin, to be called in EXTIx_IRQHandler
+*@param 	GPIO pin number
+*@return 	None
+*/
+void button_intrpt_handler (uint8_t pinNumber);
+
+/**
+*@brief 	Get oldest press or release event
+*
+*Buttons released or pressed again during debounce time are checked first (in interrupt handler triggered by software).
+*Events of a button alternate between press and release. When queue is full, level change of button wait in debounce filter
+*until an event is read, so a tap may be lost but last event always match level of button.
+*
+*@param 	Pointer to event
+*@return 	TRUE if event is written, FALSE if there is no event
+*/
+uint8_t button_get_event (Button_Event_t *EventPtr);
+
+/**
+*@brief 	Drop every event waiting in queue
+*@param 	None
+*@return 	None
+*/
+void button_flush_events (void);
+#endif
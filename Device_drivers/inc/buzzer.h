@@ -10,6 +10,9 @@
 *@note Due to the fact that prescaler value of TIM6 and TIM7 is consider fixed (for simplicity), possible range of sound frequency is 24 Hz - 160 Khz,
 *possible range of sound duration is 0.625 milisecond - 40.96 second					
 *
+*@note buzzer_play_sound block caller until end of sound and use TIM6 and TIM7, which are used by game engine and speaker driver,
+*speaker_play_note (speaker.h) play notes of same frequencies without blocking and mix them with sound effects
+*
 *@author Tran Thanh Nhan
 *@date 21/08/2019
 */
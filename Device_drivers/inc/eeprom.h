@@ -0,0 +1,114 @@
+/**
+*@file eeprom.h
+*@brief provide functions for interfacing with I2C EEPROM (24C32 and alike)
+*
+*This header file provide functions for reading and writing I2C EEPROM with 2 bytes memory address through transaction queue of
+*I2C driver (refer to I2C_queue_transaction), so that caller never wait for bus.
+*A read is a sequential read of any length (memory address written, then bytes read after repeated start). A write is a page write:
+*bytes must not cross a page boundary (EEPROM address counter wrap inside page). After a page write EEPROM program page during its
+*write cycle (up to 5ms) and does not acknowledge its address; eeprom_busy_check poll it with address only transactions (ACK polling)
+*until it answers, so write cycle end is seen without waiting for worst case time.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef EEPROM_H
+#define EEPROM_H
+
+#include "stm32f407xx.h"                  // Device header
+#include "../../Peripheral_drivers/inc/stm32f407xx_i2c.h"
+
+/***********************************************************************
+Macro definition
+***********************************************************************/
+
+#define EEPROM_MAX_PAGE_SIZE	64
+#define EEPROM_MAX_POLLS		250	/*address only transactions sent during a write cycle before EEPROM is taken as gone*/
+
+/*
+*@EEPROM_STATE
+*/
+#define EEPROM_READY				0
+#define EEPROM_BUSY_IN_TRANSFER		1	/*read or write transaction queued or running*/
+#define EEPROM_BUSY_IN_WRITE_CYCLE	2	/*page being programmed*/
+
+/*
+*@EEPROM_RESULT
+*Result of eeprom_read and eeprom_write_page
+*/
+#define EEPROM_OK			0
+#define EEPROM_ERR_BUSY		1	/*previous transfer or write cycle not finished, or I2C queue full*/
+#define EEPROM_ERR_PAGE		2	/*bytes cross page boundary or are more than a page*/
+
+/***********************************************************************
+Structure definition
+***********************************************************************/
+
+typedef struct{
+	I2C_Handle_t *I2CxHandlePtr;
+	uint8_t slaveAddr;	/*7-bit address (0x50 to 0x57 with A2:A0 pins)*/
+	uint16_t pageSize;	/*power of 2, not above EEPROM_MAX_PAGE_SIZE*/
+	volatile uint8_t state;	/*refer to @EEPROM_STATE*/
+	volatile uint8_t result;	/*refer to @I2C_TRANSACTION_RESULT, result of last read or write (after write cycle)*/
+	volatile uint8_t pollFlag;	/*address only transaction queued*/
+	uint16_t numOfPolls;
+	I2C_Transaction_t Transaction;
+	uint8_t txBuffer[2 + EEPROM_MAX_PAGE_SIZE];	/*memory address and copy of bytes to write*/
+}EEPROM_Handle_t;
+
+/***********************************************************************
+Function prototype
+***********************************************************************/
+
+/**
+*@brief Initialize EEPROM handle
+*
+*I2C handle must be initialized with transaction queue (I2C_init, I2C_DMA_init) and its interrupts enabled.
+*
+*@param Pointer to EEPROM handle
+*@param Pointer to I2C handle of bus
+*@param 7-bit address of EEPROM
+*@param Page size in bytes
+*@return none
+*/
+void eeprom_init(EEPROM_Handle_t *EEPROMHandlePtr, I2C_Handle_t *I2CxHandlePtr, uint8_t slaveAddr, uint16_t pageSize);
+
+/**
+*@brief Start sequential read
+*
+*Bytes are valid once eeprom_busy_check return FALSE and result is I2C_TRANSACTION_OK.
+*
+*@param Pointer to EEPROM handle
+*@param Memory address of first byte
+*@param Pointer to buffer receiving bytes (must stay valid until read is finished)
+*@param Number of bytes
+*@return Refer to @EEPROM_RESULT
+*/
+uint8_t eeprom_read(EEPROM_Handle_t *EEPROMHandlePtr, uint16_t memAddress, uint8_t *dataPtr, uint16_t length);
+
+/**
+*@brief Start page write
+*
+*Bytes are copied, buffer can be reused at once. Write is finished once eeprom_busy_check return FALSE (after write cycle),
+*result is I2C_TRANSACTION_OK when EEPROM took every byte.
+*
+*@param Pointer to EEPROM handle
+*@param Memory address of first byte
+*@param Pointer to bytes to write
+*@param Number of bytes (all in same page)
+*@return Refer to @EEPROM_RESULT
+*/
+uint8_t eeprom_write_page(EEPROM_Handle_t *EEPROMHandlePtr, uint16_t memAddress, const uint8_t *dataPtr, uint16_t length);
+
+/**
+*@brief Check whether EEPROM is busy, and poll it during write cycle
+*
+*Call regularly (e.g. once per frame) after a write: every call during write cycle queue an address only transaction
+*if none is running.
+*
+*@param Pointer to EEPROM handle
+*@return TRUE if busy, FALSE otherwise
+*/
+uint8_t eeprom_busy_check(EEPROM_Handle_t *EEPROMHandlePtr);
+#endif
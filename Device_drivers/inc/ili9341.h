@@ -16,6 +16,38 @@
 *03/09/2019
 */
 
+/**
+*@Version 1.1 
+*17/10/2026
+*ILI9341_draw_bitmap_w_background set active area once and stream whole image in single memory write
+*Add SPI byte counter
+*/
+
+/**
+*@Version 1.2 
+*17/10/2026
+*Pixels of fill area and monochrome image (with background) are sent by DMA using ping-pong line buffers
+*Add ILI9341_busy_check and ILI9341_wait_until_ready functions
+*/
+
+/**
+*@Version 1.3 
+*17/10/2026
+*Add framebuffer mode: primitives are drawn into RAM strip by strip, only touched tiles are sent (one memory write per tile)
+*/
+
+/**
+*@Version 1.4 
+*17/10/2026
+*Add DWT time stamp of last byte sent to ILI9341 (ILI9341_get_last_transfer_timestamp)
+*/
+
+/**
+*@Version 1.5 
+*17/10/2026
+*SPI prescaler is computed from APB clock so that serial clock stay at or below ILI9341_SPI_MAX_CLK with every clock profile
+*/
+
 #ifndef ILI9341_H
 #define ILI9341_H
 
@@ -23,6 +55,8 @@
 #include "../../Peripheral_drivers/inc/stm32f407xx_common_macro.h"
 #include "../../Peripheral_drivers/inc/stm32f407xx_gpio.h"
 #include "../../Peripheral_drivers/inc/stm32f407xx_spi.h"
+#include "../../Peripheral_drivers/inc/stm32f407xx_dwt.h"
+#include "../../Peripheral_drivers/inc/stm32f407xx_rcc.h"
 #include "../../Miscellaneous/inc/tm_stm32f4_fonts.h"
 #include <stdint.h>
 #include <stdlib.h>
@@ -37,6 +71,15 @@ ILI9341 macro definition
 */
 #define ILI9341_SPI	SPI1
 #define ILI9341_SPI_PINS_PACK SPI_pins_pack_2
+#define ILI9341_SPI_APB	APB2	/*bus of ILI9341_SPI (SPI1 is on APB2, SPI2 and SPI3 on APB1)*/
+#define ILI9341_SPI_MAX_CLK	21000000	/*fastest serial clock used for ILI9341*/
+
+/*
+*@ILI9341_SPI_DMA
+*Interrupt of DMA stream used for SPI transmission, must match ILI9341_SPI (refer to @SPI_DMA_TX_STREAM)
+*/
+#define ILI9341_SPI_DMA_IRQ	SPI1_DMA_TX_IRQ
+#define ILI9341_SPI_DMA_IRQ_HANDLER	DMA2_Stream3_IRQHandler
 
 /*
 *@ILI9341_CSX
@@ -59,6 +102,29 @@ ILI9341 macro definition
 #define ILI9341_RST_PORT  GPIOD
 #define ILI9341_RST_PIN	GPIO_PIN_NO_2
 
+/*
+*@ILI9341_SPI_BYTE_COUNTER
+*Count number of bytes sent to ILI9341 through SPI (uncomment to enable, or build with -DILI9341_USE_SPI_BYTE_COUNTER)
+*/
+/*#define ILI9341_USE_SPI_BYTE_COUNTER	TRUE*/
+
+/*
+*@ILI9341_TRANSFER_TIMESTAMP
+*Keep DWT cycle count when last byte of each command, parameter or DMA transfer is handed to SPI (uncomment to enable, or build with
+*-DILI9341_USE_TRANSFER_TIMESTAMP). DWT cycle counter must be enabled by user (DWT_cycle_counter_ctr)
+*/
+/*#define ILI9341_USE_TRANSFER_TIMESTAMP	TRUE*/
+
+/*
+*@ILI9341_FRAMEBUFFER
+*Draw into RAM strips (full screen width, ILI9341_FB_STRIP_HEIGHT rows) split into tiles of ILI9341_FB_TILE_WIDTH columns (uncomment to enable,
+*or build with -DILI9341_USE_FRAMEBUFFER). Whole screen does not fit in RAM, so every primitive is drawn once per strip and clipped to it
+*(2 strip buffers, 20KB with default size). Without it ILI9341_framebuffer_begin and ILI9341_framebuffer_next_strip draw directly
+*/
+/*#define ILI9341_USE_FRAMEBUFFER	TRUE*/
+#define ILI9341_FB_STRIP_HEIGHT		16
+#define ILI9341_FB_TILE_WIDTH		32
+
 /*
 *@ILI9341_COMMAND
 *ILI9341 command
@@ -122,6 +188,9 @@ ILI9341 macro definition
 #define ILI9341_HEIGHT		320
 #define ILI9341_PIXEL			76800
 
+/*tiles in a strip of longest row (landscape orientation)*/
+#define ILI9341_FB_TILES_IN_STRIP	((ILI9341_HEIGHT + ILI9341_FB_TILE_WIDTH - 1)/ILI9341_FB_TILE_WIDTH)
+
 #define ILI9341_CSX_SET			GPIO_write_pin(ILI9341_CSX_PORT,ILI9341_CSX_PIN,SET)
 #define ILI9341_CSX_CLEAR 	GPIO_write_pin(ILI9341_CSX_PORT,ILI9341_CSX_PIN,CLEAR)
 #define ILI9341_DCX_SET 			GPIO_write_pin(ILI9341_DCX_PORT,ILI9341_DCX_PIN,SET)
@@ -190,6 +259,11 @@ void ILI9341_draw_bitmap (int16_t x, int16_t y, const uint8_t *bitmapPtr, uint16
 
 /**
 *@brief 			Draw monochrome image starting from specified (x,y) position (with background)
+*
+*Active area is set once and pixels are streamed row by row in single memory write (by DMA).
+*Function return before all pixels are sent, following ILI9341 function wait for transfer to finish.
+*Part of image which go beyond right or bottom edge of screen is wrapped around to opposite edge (at most 4 windows)
+*
 *@param	X axis value of top left conner pixel of image
 *@param	Y axis value of top left conner pixel of image
 *@param 	Byte array with monochrome bitmap
@@ -320,4 +394,85 @@ void ILI9341_draw_circle(int16_t x0, int16_t y0, int16_t r, uint32_t color);
 *@return 	None
 */
 void ILI9341_draw_filled_circle(int16_t x0, int16_t y0, int16_t r, uint32_t color);
+
+/**
+*@brief 		Check whether pixel transfer (DMA) is ongoing
+*@param 	None
+*@return 	TRUE if transfer is ongoing, FALSE otherwise
+*/
+uint8_t ILI9341_busy_check (void);
+
+/**
+*@brief 		Wait until pixel transfer (DMA) is finished
+*
+*Every function sending command to ILI9341 already wait by itself, user only need to call this before using image buffer or SPI for other purpose
+*
+*@param 	None
+*@return 	None
+*/
+void ILI9341_wait_until_ready (void);
+
+/**
+*@brief 		Get number of bytes sent to ILI9341 through SPI since last reset
+*@param 	None
+*@return 	Number of bytes (always 0 if ILI9341_USE_SPI_BYTE_COUNTER is not defined)
+*/
+uint32_t ILI9341_get_SPI_byte_count (void);
+
+/**
+*@brief 		Reset SPI byte counter
+*@param 	None
+*@return 	None
+*/
+void ILI9341_reset_SPI_byte_count (void);
+
+/**
+*@brief 		Get time stamp of last byte sent to ILI9341
+*
+*Time when DMA transfer completed or when command or parameter was written to SPI, last bits leave shift register 16 SPI clock
+*cycles later at most. Call after ILI9341_busy_check return FALSE to get time when drawing ended.
+*
+*@param 	None
+*@return 	DWT cycle count (always 0 if ILI9341_USE_TRANSFER_TIMESTAMP is not defined)
+*/
+uint32_t ILI9341_get_last_transfer_timestamp (void);
+
+/**
+*@brief 		Start drawing screen into framebuffer strips, drawing must be repeated until ILI9341_framebuffer_next_strip return FALSE
+*
+*Usage:	ILI9341_framebuffer_begin(ILI9341_BLACK);
+*		do{
+*			draw whole screen with ILI9341 functions
+*		}while(ILI9341_framebuffer_next_strip());
+*
+*Pixels of a touched tile which are not drawn are sent in background color, so every pixel of touched tiles must be drawn or be background.
+*Without ILI9341_USE_FRAMEBUFFER primitives are sent to ILI9341 directly and loop run once.
+*
+*@param 	Background color
+*@return 	None
+*/
+void ILI9341_framebuffer_begin (uint16_t background);
+
+/**
+*@brief 		Send touched tiles of current strip to ILI9341 (by DMA) and move to next strip
+*@param 	None
+*@return 	TRUE if there is a next strip to draw, FALSE when whole screen is done (framebuffer mode end)
+*/
+uint8_t ILI9341_framebuffer_next_strip (void);
+
+/**
+*@brief 		Check whether primitives are drawn into framebuffer
+*@param 	None
+*@return 	TRUE if framebuffer mode is active, FALSE otherwise
+*/
+uint8_t ILI9341_framebuffer_active_check (void);
+
+/**
+*@brief 		Draw pixel into current strip (pixel outside strip or screen is skipped), used by overridden ILI9341_draw_pixel
+*@param 	X axis value
+*@param 	Y axis value 
+*@param 	Color
+*@return 	None
+*/
+void ILI9341_framebuffer_draw_pixel (int16_t x, int16_t y, uint16_t color);
 #endif 
@@ -4,22 +4,54 @@
 *
 *This header file provide functions for interfacing with joystick.
 *The joystick communicate its position (in X axis & Y axis) with the MCU through 2 ADC channel.
+*With JOYSTICK_USE_DMA, ADC convert both channels again and again in scan mode and DMA write conversions into a circular buffer,
+*so reading joystick is a few memory loads instead of 2 conversions waited for.
+*Besides 9 directions, position is read as calibrated analog vector (joystick_read_vector): offset from center captured at boot
+*(joystick_calibrate) is normalized on each side of axis to Q14, vectors shorter than radial dead zone are 0 and magnitude rise
+*from 0 at edge of dead zone to JOYSTICK_VECTOR_ONE at full deflection. While joystick rest in dead zone, center slowly follow
+*position read so that drift of potentiometers is cancelled. Angle is given by integer fast_atan2 (fast_math.h).
 *
 *@author Tran Thanh Nhan
 *@date 27/08/2019
 */
 
+/*
+ *@version 1.1
+ *date 17/10/2026
+ *convert both axes continuously into DMA buffer (JOYSTICK_USE_DMA), latest scans are averaged
+ *add joystick_read_position
+ */
+
+/*
+ *@version 1.2
+ *date 17/10/2026
+ *add calibrated analog vector with radial dead zone and center drift tracking (joystick_calibrate, joystick_read_vector)
+ */
+
 #ifndef JOYSTICK_H
 #define JOYSTICK_H
 
 #include "stm32f407xx.h"                  // Device header
 #include "../../Peripheral_drivers/inc/stm32f407xx_gpio.h"
 #include "../../Peripheral_drivers/inc/stm32f407xx_adc.h"
+#include "../../Miscellaneous/inc/fast_math.h"
 
 /***********************************************************************
 Macro definition
 ***********************************************************************/
 
+/*comment out to read ADC on each call (2 conversions waited for)*/
+#define JOYSTICK_USE_DMA			TRUE
+#define JOYSTICK_OVERSAMPLING		8							/*latest scans averaged when reading position (with DMA), 1 for latest scan only*/
+#define JOYSTICK_SAMPLE_TIME		ADC_SAMPLE_TIME_480_CYCLES	/*long sampling of potentiometers, a scan take 2*(480+12) ADC cycles (47us at 21MHz)*/
+#define JOYSTICK_POS_CENTER			2048						/*position read before first scan end*/
+#define JOYSTICK_POS_MAX			4095
+
+#define JOYSTICK_VECTOR_ONE			16384	/*Q14 length of fully deflected joystick vector*/
+#define JOYSTICK_DEAD_ZONE			1311	/*radius of dead zone around center in Q14 (8% of full deflection)*/
+#define JOYSTICK_RAIL_MARGIN		256		/*full deflection is reached this far from ends of ADC range, potentiometer does not reach them*/
+#define JOYSTICK_DRIFT_SHIFT		4		/*center move by 1/16 of its difference with position read in dead zone*/
+
 /*
 *X axis and Y axis position threshold (in 12 bits digital number)
 */
@@ -50,6 +82,17 @@ Macro definition
 #define JS_DIR_DOWN 8
 #define JS_DIR_CENTERED 0
 
+/***********************************************************************
+Structure definition
+***********************************************************************/
+
+typedef struct{
+	int16_t x;			/*Q14, right is positive, 0 in dead zone*/
+	int16_t y;			/*Q14, up is positive*/
+	uint16_t magnitude;	/*0 in dead zone to JOYSTICK_VECTOR_ONE*/
+	uint16_t angle;		/*binary angle counter-clockwise from right (refer to fast_math.h), 0 in dead zone*/
+}Joystick_Vector_t;
+
 /***********************************************************************
 Function prototype
 ***********************************************************************/
@@ -65,6 +108,9 @@ void joystick_init(ADC_TypeDef *ADCxPtr, uint8_t X_axis_ADC_channel, uint8_t Y_a
 
 /**
 *@brief Deinitilize joystick
+*
+*With JOYSTICK_USE_DMA, conversions into DMA buffer are stopped first.
+*
 *@param Pointer to ADCx peripheral (x = 1,2,3)
 *@return none
 */
@@ -74,6 +120,7 @@ void joystick_deinit(ADC_TypeDef *ADCxPtr);
 *@brief Read joystick direction
 *
 *This read 12 bits digital number from X & Y axis ADC channel then determine the direction of joystick.
+*With JOYSTICK_USE_DMA, position is read from DMA buffer (refer to joystick_read_position).
 *
 *@param Pointer to ADCx peripheral (x = 1,2,3)
 *@param X axis ADC channel
@@ -81,4 +128,45 @@ void joystick_deinit(ADC_TypeDef *ADCxPtr);
 *@return Indicator of joystick direction
 */
 uint8_t joystick_read_direction(ADC_TypeDef *ADCxPtr, uint8_t X_axis_ADC_channel, uint8_t Y_axis_ADC_channel);
+
+/**
+*@brief Read joystick position
+*
+*With JOYSTICK_USE_DMA, this average JOYSTICK_OVERSAMPLING latest scans of DMA buffer without waiting for ADC (ADC and channels
+*given to joystick_init are used). Otherwise X & Y axis ADC channel are converted.
+*
+*@param Pointer to ADCx peripheral (x = 1,2,3)
+*@param X axis ADC channel
+*@param Y axis ADC channel
+*@param Pointer to X axis position (12 bits digital number)
+*@param Pointer to Y axis position (12 bits digital number)
+*@return none
+*/
+void joystick_read_position(ADC_TypeDef *ADCxPtr, uint8_t X_axis_ADC_channel, uint8_t Y_axis_ADC_channel, uint16_t *xPosPtr, uint16_t *yPosPtr);
+
+/**
+*@brief Capture center of joystick from current position
+*
+*Joystick must be released. With JOYSTICK_USE_DMA, JOYSTICK_OVERSAMPLING scans must have been done since joystick_init (under 1ms).
+*Until joystick is calibrated, center is JOYSTICK_POS_CENTER.
+*
+*@param Pointer to ADCx peripheral (x = 1,2,3)
+*@param X axis ADC channel
+*@param Y axis ADC channel
+*@return none
+*/
+void joystick_calibrate(ADC_TypeDef *ADCxPtr, uint8_t X_axis_ADC_channel, uint8_t Y_axis_ADC_channel);
+
+/**
+*@brief Read joystick as calibrated analog vector
+*
+*Position is read as with joystick_read_position. Vector in dead zone also move center toward position read.
+*
+*@param Pointer to ADCx peripheral (x = 1,2,3)
+*@param X axis ADC channel
+*@param Y axis ADC channel
+*@param Pointer to vector
+*@return none
+*/
+void joystick_read_vector(ADC_TypeDef *ADCxPtr, uint8_t X_axis_ADC_channel, uint8_t Y_axis_ADC_channel, Joystick_Vector_t *VectorPtr);
 #endif
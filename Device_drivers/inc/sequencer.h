@@ -0,0 +1,116 @@
+/**
+*@file sequencer.h
+*@brief provide functions for playing music with synthesizer notes of speaker driver
+*
+*This header file provide functions for playing songs in background.
+*Song is made of tracks, each track is a list of 4 bytes events (note frequency from notes.h, duration in ticks, effect) played one
+*after the other with instrument and volume of track, so a song take a few hundred bytes of flash. Tracks start together and
+*the song restart when every track has ended (looping song) or stop.
+*Sequencer run in speaker interrupt (refer to speaker_set_block_callback): time is counted in samples output by speaker and notes due
+*in a block are started before it is mixed, so note onset is at most one block (SPEAKER_BLOCK_SIZE samples) late whatever the tempo.
+*Notes are mixed with sound effects, they are played at priority of song so effects of higher priority steal their voices.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef SEQUENCER_H
+#define SEQUENCER_H
+
+#include "speaker.h"
+#include "../../Miscellaneous/inc/notes.h"
+
+#define SEQUENCER_MAX_TRACKS		3	/*at least one voice of speaker is left to sound effects*/
+#define SEQUENCER_TICKS_PER_BEAT	4	/*a tick is a sixteenth note*/
+
+/*
+*@SEQUENCER_EFFECT
+*Effect of event
+*/
+#define SEQUENCER_EFFECT_NONE		0
+#define SEQUENCER_EFFECT_ACCENT		1	/*note is played at full volume instead of volume of track*/
+#define SEQUENCER_EFFECT_STACCATO	2	/*note is released at half of its duration*/
+#define SEQUENCER_EFFECT_TEMPO		3	/*set tempo of song to frequency field of event (beats per minute), take no time*/
+#define SEQUENCER_EFFECT_END		4	/*end of track*/
+
+/*
+*@SEQUENCER_EVENT
+*Build events of track, duration is one of notes.h durations (WN, HN, QN, EN, SN or sum of them)
+*/
+#define SEQUENCER_TICKS(duration)				((duration)*SEQUENCER_TICKS_PER_BEAT/beatLength)
+#define SEQUENCER_NOTE(frequency,duration)		{frequency,SEQUENCER_TICKS(duration),SEQUENCER_EFFECT_NONE}
+#define SEQUENCER_ACCENT(frequency,duration)	{frequency,SEQUENCER_TICKS(duration),SEQUENCER_EFFECT_ACCENT}
+#define SEQUENCER_STACCATO(frequency,duration)	{frequency,SEQUENCER_TICKS(duration),SEQUENCER_EFFECT_STACCATO}
+#define SEQUENCER_REST(duration)				{Rest,SEQUENCER_TICKS(duration),SEQUENCER_EFFECT_NONE}
+#define SEQUENCER_TEMPO(beatsPerMinute)			{beatsPerMinute,0,SEQUENCER_EFFECT_TEMPO}
+#define SEQUENCER_END							{0,0,SEQUENCER_EFFECT_END}
+
+/*
+*@SEQUENCER_PLAY_MODE
+*/
+#define SEQUENCER_PLAY_ONCE			0
+#define SEQUENCER_PLAY_LOOP			1
+
+/***********************************************************************
+Sequencer structure definition
+***********************************************************************/
+
+typedef struct{
+	uint16_t frequency;	/*refer to notes.h, Rest for silence (beats per minute for SEQUENCER_EFFECT_TEMPO)*/
+	uint8_t duration;	/*ticks before next event of track*/
+	uint8_t effect;		/*refer to @SEQUENCER_EFFECT*/
+}Sequencer_Event_t;
+
+typedef struct{
+	const Sequencer_Event_t *EventPtr;	/*ended by SEQUENCER_END*/
+	const Synth_Instrument_t *InstrumentPtr;
+	uint16_t volume;	/*refer to @SPEAKER_VOLUME*/
+}Sequencer_Track_t;
+
+typedef struct{
+	const Sequencer_Track_t *TrackPtr;
+	uint8_t numOfTracks;	/*up to SEQUENCER_MAX_TRACKS*/
+	uint16_t tempo;			/*beats per minute at start of song*/
+	uint8_t priority;		/*priority of notes on speaker voices*/
+	uint8_t playMode;		/*refer to @SEQUENCER_PLAY_MODE*/
+}Sequencer_Song_t;
+
+/***********************************************************************
+Sequencer APIs prototype
+***********************************************************************/
+
+/**
+*@brief 	Play song from its start, song played before is stopped
+*
+*Speaker must be initialized, song is played in speaker interrupt and function return immediately.
+*
+*@param 	Song to play
+*@return 	None
+*/
+void sequencer_play (const Sequencer_Song_t *SongPtr);
+
+/**
+*@brief 	Stop song, notes already started fade out
+*
+*@param 	None
+*@return 	None
+*/
+void sequencer_stop (void);
+
+/**
+*@brief 	Check whether a song is playing
+*
+*@param 	None
+*@return 	TRUE if song is playing, FALSE if it is stopped or has ended
+*/
+uint8_t sequencer_playing_check (void);
+
+/**
+*@brief 	Change tempo of playing song (until next tempo event)
+*
+*@param 	Beats per minute
+*@return 	None
+*/
+void sequencer_set_tempo (uint16_t tempo);
+
+#endif
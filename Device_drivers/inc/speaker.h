@@ -4,7 +4,13 @@
 *
 *This header file provide functions for interfacing with speaker.
 *Speaker is driven with STM32F4 Discovery board 's on-board DAC (user can select channel 1 or channel 2).
-*Timer 7 is used for creating time interval between sound samples.
+*Timer 7 is used for creating time interval between sound samples: its update event trigger DAC conversion and DMA1 feed DAC from
+*a circular buffer (SPEAKER_USE_DMA), or timer interrupt write each sample to DAC when DMA is not used.
+*Up to SPEAKER_NUM_OF_VOICES sounds are played together: samples of every playing voice are scaled by its volume and summed
+*(saturated into 12 bits DAC range). Mixing is done SPEAKER_BLOCK_SIZE samples at a time into one of 2 block buffers while the
+*other one is output. Sounds are arrays of 12 bits samples or IMA ADPCM sounds (4 times smaller in flash) decoded block by block
+*as they are mixed. Notes of synthesizer (synth.h) are rendered on voices the same way, so music never block the caller. With DMA, both blocks form the circular buffer: first block is refilled on half transfer interrupt and second
+*block on transfer complete interrupt, so CPU is interrupted once per block instead of once per sample. When every voice is busy, a new sound steal the voice of lowest priority.
 *
 *@author Tran Thanh Nhan
 *@date 21/08/2019
@@ -18,6 +24,49 @@
  *remove duration from play sound function
  */
 
+/*
+ *@version 1.2
+ *date 17/10/2026
+ *mix up to SPEAKER_NUM_OF_VOICES sounds in blocks, each voice has its own position, volume, priority and loop flag
+ *add speaker_play_voice, speaker_stop_voice, speaker_find_voice and speaker_mix_block functions
+ */
+
+/*
+ *@version 1.3
+ *date 17/10/2026
+ *output samples through DMA triggered by timer update event (SPEAKER_USE_DMA), timer interrupt is only used without DMA
+ */
+
+/*
+ *@version 1.4
+ *date 17/10/2026
+ *add speaker_play_ADPCM_voice, sound of up to 2^32 samples
+ */
+
+/*
+ *@version 1.5
+ *date 17/10/2026
+ *add speaker_play_note, speaker_release_note and speaker_get_sample_rate (notes of synthesizer are mixed with sounds)
+ */
+
+/*
+ *@version 1.6
+ *date 17/10/2026
+ *add speaker_set_block_callback (music sequencer run in interrupt before each block is mixed)
+ */
+
+/*
+ *@version 1.7
+ *date 17/10/2026
+ *ADPCM sound of other sample rate than speaker is resampled with linear interpolation as it is mixed
+ */
+
+/*
+ *@version 1.8
+ *date 17/10/2026
+ *add speaker_get_num_of_underruns (blocks output again because their interrupt was served too late)
+ */
+
 #ifndef SPEAKER_H
 #define SPEAKER_H
 
@@ -25,10 +74,40 @@
 #include "../../Peripheral_drivers/inc/stm32f407xx_rcc.h"
 #include "../../Peripheral_drivers/inc/stm32f407xx_dac.h"
 #include "../../Peripheral_drivers/inc/stm32f407xx_timer.h"
+#include "../../Miscellaneous/inc/adpcm.h"
+#include "../../Miscellaneous/inc/synth.h"
 
 #define SPEAKER_USE_TIMER7			TRUE
 #define SPEAKER_TIMER				TIM7
 #define SPEAKER_TIMER_IRQ_NUM		IRQ_TIM7
+#define SPEAKER_TIMER_APB			APB1					/*bus of SPEAKER_TIMER (TIM3, TIM4, TIM6 and TIM7 are on APB1)*/
+#define SPEAKER_DAC_TRIGGER_EV		DAC_TRIGGER_EV_TIM7		/*DAC trigger event of SPEAKER_TIMER, refer to @DAC_TRIGGER_EV*/
+
+/*comment out to write each sample to DAC in timer interrupt*/
+#define SPEAKER_USE_DMA				TRUE
+#define SPEAKER_DMA_IRQ_HANDLER		DMA1_Stream5_IRQHandler	/*DMA stream of DAC channel 1, DMA1_Stream6_IRQHandler for DAC channel 2*/
+
+#define SPEAKER_NUM_OF_VOICES		4
+#define SPEAKER_BLOCK_SIZE			32		/*samples mixed at a time*/
+#define SPEAKER_NO_VOICE			0xFF
+
+/*12 bits samples, silence is at midpoint*/
+#define SPEAKER_SAMPLE_MIDPOINT		2048
+#define SPEAKER_SAMPLE_MAX			4095
+#define SPEAKER_16_BITS_SCALE_SHIFT	4		/*ADPCM sounds and synthesizer notes hold 16 bits samples*/
+
+/*
+*@SPEAKER_VOLUME
+*Volume of voice, sample of sound is scaled by volume/SPEAKER_VOLUME_FULL
+*/
+#define SPEAKER_VOLUME_FULL			256
+#define SPEAKER_VOLUME_HALF			128
+
+/*
+*@SPEAKER_PLAY_MODE
+*/
+#define SPEAKER_PLAY_ONCE			0
+#define SPEAKER_PLAY_LOOP			1
 
 /**
 *@brief 	Initialize speaker (driven by on-board DAC)
@@ -37,6 +116,9 @@
 *@param 	Timer prescaler value
 *@param 	Timer reload value
 *@return 	None
+*
+*@note 	Sample rate is timer clock/((prescaler + 1)*(reload + 1)), speaker_init(DAC_CHANNEL_1,9,679) output 6176 samples per second
+*		with RCC_set_SYSCLK_PLL_84_MHz (42MHz timer clock on APB1), RCC_get_TIM_period give values for other clock profiles
 */
 void speaker_init (uint8_t DAC_channel, uint16_t timerPrescaler, uint16_t timerReload);
 
@@ -44,6 +126,7 @@ void speaker_init (uint8_t DAC_channel, uint16_t timerPrescaler, uint16_t timerR
 *@brief 	Generate sound
 *
 *This read sound 's samples at frequency specified in speaker_init function and output to DAC
+*Sound is played once at full volume and lowest priority (refer to speaker_play_voice)
 *
 *@param 	Array of samples of sound to play
 *@return 	None
@@ -51,11 +134,120 @@ void speaker_init (uint8_t DAC_channel, uint16_t timerPrescaler, uint16_t timerR
 void speaker_play_sound (const uint16_t *SoundPtr, const uint16_t size);
 
 /**
-*@brief 	Stop sound
+*@brief 	Stop sound of every voice
 *
 *@param 	None
 *@return 	None
 */
 void speaker_stop_sound (void);
 
+/**
+*@brief 	Play sound on a voice of mixer
+*
+*Free voice is used first. When every voice is busy, voice of lowest priority is stolen (among voices of same priority,
+*the one closest to its end), sound is not played if every voice has higher priority.
+*
+*@param 	Array of samples of sound to play
+*@param 	Number of samples
+*@param 	Volume (refer to @SPEAKER_VOLUME)
+*@param 	Priority (higher value steal voice of lower value)
+*@param 	Play once or loop until stopped (refer to @SPEAKER_PLAY_MODE)
+*@return 	Voice playing sound, SPEAKER_NO_VOICE if sound is not played
+*/
+uint8_t speaker_play_voice (const uint16_t *soundPtr, uint16_t size, uint16_t volume, uint8_t priority, uint8_t playMode);
+
+/**
+*@brief 	Play IMA ADPCM sound on a voice of mixer
+*
+*Sound is decoded block by block as it is mixed (refer to speaker_play_voice for voice selection).
+*Sound stored at other sample rate than speaker (sampleRate of sound) is resampled to sample rate of speaker with linear interpolation,
+*sound should be stored at lower rate only, samples are dropped without filtering when sound rate is higher.
+*
+*@param 	ADPCM sound to play (sound assets generated by Tools/adpcm_encoder.c)
+*@param 	Volume (refer to @SPEAKER_VOLUME)
+*@param 	Priority (higher value steal voice of lower value)
+*@param 	Play once or loop until stopped (refer to @SPEAKER_PLAY_MODE)
+*@return 	Voice playing sound, SPEAKER_NO_VOICE if sound is not played
+*/
+uint8_t speaker_play_ADPCM_voice (const ADPCM_Sound_t *soundPtr, uint16_t volume, uint8_t priority, uint8_t playMode);
+
+/**
+*@brief 	Play note of synthesizer on a voice of mixer
+*
+*Note is rendered block by block as it is mixed (refer to speaker_play_voice for voice selection), it is played once.
+*
+*@param 	Instrument (waveform and envelope), speaker_find_voice find note by its instrument
+*@param 	Frequency in Hz (refer to notes.h), Rest (0) play nothing
+*@param 	Duration in milliseconds before release, 0 to hold note until speaker_release_note
+*@param 	Volume (refer to @SPEAKER_VOLUME)
+*@param 	Priority (higher value steal voice of lower value)
+*@return 	Voice playing note, SPEAKER_NO_VOICE if note is not played
+*/
+uint8_t speaker_play_note (const Synth_Instrument_t *InstrumentPtr, uint32_t frequency, uint32_t duration, uint16_t volume, uint8_t priority);
+
+/**
+*@brief 	Release note of a voice, it fade out in release time of its instrument
+*
+*@param 	Voice returned by speaker_play_note
+*@return 	None
+*/
+void speaker_release_note (uint8_t voice);
+
+/**
+*@brief 	Stop sound of a voice
+*
+*@param 	Voice returned by speaker_play_voice
+*@return 	None
+*/
+void speaker_stop_voice (uint8_t voice);
+
+/**
+*@brief 	Find voice playing a sound
+*
+*@param 	Array of samples, ADPCM sound or instrument of note
+*@return 	Voice playing sound, SPEAKER_NO_VOICE if sound is not playing
+*/
+uint8_t speaker_find_voice (const void *soundPtr);
+
+/**
+*@brief 	Get number of samples output per second
+*
+*@param 	None
+*@return 	Sample rate in Hz set by speaker_init
+*/
+uint32_t speaker_get_sample_rate (void);
+
+/**
+*@brief 	Get number of underruns since speaker_init
+*
+*Underrun is counted when half transfer and transfer complete interrupts are served together: both blocks were output and one of
+*them was output again before it was mixed (interrupts of higher priority held back DMA interrupt for a whole block).
+*
+*@param 	None
+*@return 	Number of underruns (always 0 if SPEAKER_USE_DMA is not defined)
+*/
+uint32_t speaker_get_num_of_underruns (void);
+
+/**
+*@brief 	Set function called in interrupt before each block is mixed
+*
+*Callback may start voices, they are mixed from start of this block. Output keep running while callback return TRUE,
+*even when no voice is playing (output is started when callback is set).
+*
+*@param 	Callback receiving number of samples of block, NULL to remove callback
+*@return 	None
+*/
+void speaker_set_block_callback (uint8_t (*callback)(uint16_t numOfSamples));
+
+/**
+*@brief 	Mix next samples of every playing voice
+*
+*Called in DMA (or timer) interrupt to refill block buffers, voices move forward by number of samples (voice played once is freed at its end).
+*
+*@param 	Buffer receiving mixed samples (12 bits, saturated)
+*@param 	Number of samples
+*@return 	Number of voices playing at start of mix
+*/
+uint8_t speaker_mix_block (uint16_t *bufferPtr, uint16_t numOfSamples);
+
 #endif
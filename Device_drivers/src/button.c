@@ -10,15 +10,201 @@
 
 #include "../inc/button.h"
 
+/*debounce filter of button captured by EXTI interrupt, only written in interrupt handler*/
+typedef struct{
+	GPIO_TypeDef *GPIOxPtr;
+	uint32_t debounceTime;	/*CPU cycles*/
+	uint32_t lastEdgeTime;	/*time of last level change seen*/
+	uint32_t lastEventTime;	/*time of last reported level change*/
+	uint8_t pinNumber;
+	uint8_t pressedLevel;	/*pin level of pressed button*/
+	uint8_t rawLevel;		/*pin level at last edge*/
+	uint8_t stableLevel;	/*pin level of last event*/
+	uint8_t lockout;		/*edges are ignored until debounce time has elapsed since last event*/
+}Button_Filter_t;
+
+static void button_filter_update (uint8_t button, uint8_t level, uint32_t time);
+static uint8_t button_report (uint8_t button, uint8_t level, uint32_t time);
+static uint8_t button_get_IRQ_number (uint8_t pinNumber);
+
+Button_Filter_t buttonFilter[BUTTON_MAX_EVENT_BUTTONS];
+volatile uint8_t numOfEventButtons = 0;
+
+/*single producer (interrupt handler) single consumer queue, head and tail count events and wrap around with uint8_t*/
+volatile Button_Event_t buttonEventQueue[BUTTON_EVENT_QUEUE_SIZE];
+volatile uint8_t buttonEventHead = 0;
+volatile uint8_t buttonEventTail = 0;
+
 void button_init (GPIO_TypeDef *GPIOxPtr, uint8_t pinNumber, uint8_t puPdr)
 {
 	GPIO_Pin_config_t GPIO_button_config = {.pinNumber=pinNumber,.mode=GPIO_MODE_IN,.puPdr=puPdr};
 	GPIO_Handle_t	GPIO_button_handle = {GPIOxPtr,GPIO_button_config};
 	GPIO_init(&GPIO_button_handle);
-}	
+}
 
 uint8_t button_read (GPIO_TypeDef *GPIOxPtr,uint8_t pinNumber)
 {
 	return GPIO_read_pin(GPIOxPtr,pinNumber);
 }
 
+/***********************************************************************
+Public function: Initialize button captured by EXTI interrupt
+***********************************************************************/
+uint8_t button_event_init (GPIO_TypeDef *GPIOxPtr, uint8_t pinNumber, uint8_t puPdr, uint32_t debounceTime)
+{
+	GPIO_Pin_config_t GPIO_button_config = {.pinNumber=pinNumber,.mode=GPIO_MODE_INTRPT_RFE,.puPdr=puPdr};
+	GPIO_Handle_t	GPIO_button_handle = {GPIOxPtr,GPIO_button_config};
+	uint8_t button = numOfEventButtons;
+	Button_Filter_t *FilterPtr = &buttonFilter[button];
+
+	if(button >= BUTTON_MAX_EVENT_BUTTONS){
+		return BUTTON_NO_BUTTON;
+	}
+
+	if(button == 0){
+		DWT_cycle_counter_ctr(ENABLE);
+	}
+
+	GPIO_init(&GPIO_button_handle);
+
+	FilterPtr->GPIOxPtr = GPIOxPtr;
+	FilterPtr->pinNumber = pinNumber;
+	FilterPtr->pressedLevel = (puPdr == GPIO_PDR) ? 1 : 0;
+	FilterPtr->debounceTime = debounceTime * (RCC_get_SYSCLK_value()/1000000);
+	FilterPtr->rawLevel = GPIO_read_pin(GPIOxPtr,pinNumber);
+	FilterPtr->stableLevel = FilterPtr->rawLevel;
+	FilterPtr->lastEdgeTime = DWT_get_cycle_count();
+	FilterPtr->lastEventTime = FilterPtr->lastEdgeTime;
+	FilterPtr->lockout = FALSE;
+
+	/*filter is ready before its interrupt can run*/
+	numOfEventButtons = button + 1;
+	GPIO_Intrpt_ctrl(button_get_IRQ_number(pinNumber),ENABLE);
+
+	return button;
+}
+
+/***********************************************************************
+Public function: Handle EXTI interrupt of button pin
+***********************************************************************/
+void button_intrpt_handler (uint8_t pinNumber)
+{
+	uint32_t time = DWT_get_cycle_count();
+
+	GPIO_Intrpt_handler(pinNumber);
+
+	for(uint8_t button = 0; button < numOfEventButtons; button++){
+		if(buttonFilter[button].pinNumber == pinNumber){
+			button_filter_update(button,GPIO_read_pin(buttonFilter[button].GPIOxPtr,pinNumber),time);
+		}
+	}
+}
+
+/***********************************************************************
+Public function: Get oldest event
+***********************************************************************/
+uint8_t button_get_event (Button_Event_t *EventPtr)
+{
+	uint8_t tail = buttonEventTail;
+
+	/*level change waiting for end of debounce time is reported by interrupt handler, so that filter has a single writer*/
+	if(buttonEventHead == tail){
+		for(uint8_t button = 0; button < numOfEventButtons; button++){
+			if(buttonFilter[button].lockout || (buttonFilter[button].rawLevel != buttonFilter[button].stableLevel)){
+				GPIO_Intrpt_software_trigger(buttonFilter[button].pinNumber);
+			}
+		}
+	}
+
+	if(buttonEventHead == tail){
+		return FALSE;
+	}
+
+	EventPtr->timestamp = buttonEventQueue[tail % BUTTON_EVENT_QUEUE_SIZE].timestamp;
+	EventPtr->button = buttonEventQueue[tail % BUTTON_EVENT_QUEUE_SIZE].button;
+	EventPtr->type = buttonEventQueue[tail % BUTTON_EVENT_QUEUE_SIZE].type;
+
+	/*slot is given back to interrupt handler after it is read*/
+	buttonEventTail = tail + 1;
+
+	return TRUE;
+}
+
+/***********************************************************************
+Public function: Drop every event waiting in queue
+***********************************************************************/
+void button_flush_events (void)
+{
+	buttonEventTail = buttonEventHead;
+}
+
+/***********************************************************************
+Private function: Filter level of button read in interrupt handler
+***********************************************************************/
+void button_filter_update (uint8_t button, uint8_t level, uint32_t time)
+{
+	Button_Filter_t *FilterPtr = &buttonFilter[button];
+
+	/*unsigned subtraction stay correct across one wrap of cycle counter*/
+	if(FilterPtr->lockout && ((time - FilterPtr->lastEventTime) >= FilterPtr->debounceTime)){
+		FilterPtr->lockout = FALSE;
+	}
+
+	/*level changed during debounce time is reported first with time of its edge*/
+	if(!FilterPtr->lockout && (FilterPtr->rawLevel != FilterPtr->stableLevel)){
+		if(button_report(button,FilterPtr->rawLevel,FilterPtr->lastEdgeTime)){
+			FilterPtr->lockout = ((time - FilterPtr->lastEventTime) < FilterPtr->debounceTime) ? TRUE : FALSE;
+		}
+	}
+
+	if(level == FilterPtr->rawLevel){
+		return;
+	}
+
+	FilterPtr->rawLevel = level;
+	FilterPtr->lastEdgeTime = time;
+
+	if(!FilterPtr->lockout && (level != FilterPtr->stableLevel)){
+		button_report(button,level,time);
+	}
+}
+
+/***********************************************************************
+Private function: Put event into queue, return FALSE when queue is full (level is not reported)
+***********************************************************************/
+uint8_t button_report (uint8_t button, uint8_t level, uint32_t time)
+{
+	Button_Filter_t *FilterPtr = &buttonFilter[button];
+	uint8_t head = buttonEventHead;
+
+	if((uint8_t)(head - buttonEventTail) >= BUTTON_EVENT_QUEUE_SIZE){
+		return FALSE;
+	}
+
+	buttonEventQueue[head % BUTTON_EVENT_QUEUE_SIZE].timestamp = time;
+	buttonEventQueue[head % BUTTON_EVENT_QUEUE_SIZE].button = button;
+	buttonEventQueue[head % BUTTON_EVENT_QUEUE_SIZE].type = (level == FilterPtr->pressedLevel) ? BUTTON_PRESSED : BUTTON_RELEASED;
+
+	/*event is given to consumer after it is written*/
+	buttonEventHead = head + 1;
+
+	FilterPtr->stableLevel = level;
+	FilterPtr->lastEventTime = time;
+	FilterPtr->lockout = TRUE;
+
+	return TRUE;
+}
+
+/***********************************************************************
+Private function: Get EXTI interrupt number of pin
+***********************************************************************/
+uint8_t button_get_IRQ_number (uint8_t pinNumber)
+{
+	if(pinNumber <= GPIO_PIN_NO_4){
+		return IRQ_EXTI0 + pinNumber;
+	}else if(pinNumber <= GPIO_PIN_NO_9){
+		return IRQ_EXTI9_5;
+	}
+
+	return IRQ_EXTI15_10;
+}
@@ -0,0 +1,157 @@
+/**
+*@file eeprom.c
+*@brief provide functions for interfacing with I2C EEPROM (24C32 and alike)
+*
+*This implementation file provide functions for reading and writing I2C EEPROM through transaction queue of I2C driver.
+*Every transfer is a single queued transaction, its callback (called from I2C or DMA interrupt) update EEPROM state: a page write
+*move EEPROM to write cycle, address only transaction acknowledged during write cycle move it back to ready.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../inc/eeprom.h"
+
+static void eeprom_transaction_done(I2C_Transaction_t *TransactionPtr, uint8_t result);
+static uint8_t eeprom_queue(EEPROM_Handle_t *EEPROMHandlePtr, uint16_t txLength, uint8_t *rxBufferPtr, uint16_t rxLength);
+
+/***********************************************************************
+Initialize EEPROM handle
+***********************************************************************/
+void eeprom_init(EEPROM_Handle_t *EEPROMHandlePtr, I2C_Handle_t *I2CxHandlePtr, uint8_t slaveAddr, uint16_t pageSize)
+{
+	EEPROMHandlePtr->I2CxHandlePtr = I2CxHandlePtr;
+	EEPROMHandlePtr->slaveAddr = slaveAddr;
+	EEPROMHandlePtr->pageSize = (pageSize > EEPROM_MAX_PAGE_SIZE) ? EEPROM_MAX_PAGE_SIZE : pageSize;
+	EEPROMHandlePtr->state = EEPROM_READY;
+	EEPROMHandlePtr->result = I2C_TRANSACTION_OK;
+	EEPROMHandlePtr->pollFlag = FALSE;
+	EEPROMHandlePtr->numOfPolls = 0;
+
+	EEPROMHandlePtr->Transaction.slaveAddr = slaveAddr;
+	EEPROMHandlePtr->Transaction.txBufferPtr = EEPROMHandlePtr->txBuffer;
+	EEPROMHandlePtr->Transaction.callback = eeprom_transaction_done;
+	EEPROMHandlePtr->Transaction.contextPtr = EEPROMHandlePtr;
+}
+
+/***********************************************************************
+Start sequential read
+***********************************************************************/
+uint8_t eeprom_read(EEPROM_Handle_t *EEPROMHandlePtr, uint16_t memAddress, uint8_t *dataPtr, uint16_t length)
+{
+	if(EEPROMHandlePtr->state != EEPROM_READY){
+		return EEPROM_ERR_BUSY;
+	}
+
+	EEPROMHandlePtr->txBuffer[0] = (uint8_t)(memAddress >> 8);
+	EEPROMHandlePtr->txBuffer[1] = (uint8_t)memAddress;
+
+	return eeprom_queue(EEPROMHandlePtr,2,dataPtr,length);
+}
+
+/***********************************************************************
+Start page write
+***********************************************************************/
+uint8_t eeprom_write_page(EEPROM_Handle_t *EEPROMHandlePtr, uint16_t memAddress, const uint8_t *dataPtr, uint16_t length)
+{
+	uint16_t offset = memAddress & (EEPROMHandlePtr->pageSize - 1);
+
+	if(EEPROMHandlePtr->state != EEPROM_READY){
+		return EEPROM_ERR_BUSY;
+	}
+
+	/*EEPROM address counter wrap inside page, bytes after page end would overwrite its start*/
+	if(length > EEPROMHandlePtr->pageSize - offset){
+		return EEPROM_ERR_PAGE;
+	}
+
+	EEPROMHandlePtr->txBuffer[0] = (uint8_t)(memAddress >> 8);
+	EEPROMHandlePtr->txBuffer[1] = (uint8_t)memAddress;
+
+	for(uint16_t i = 0; i < length; i++){
+		EEPROMHandlePtr->txBuffer[2 + i] = dataPtr[i];
+	}
+
+	return eeprom_queue(EEPROMHandlePtr,2 + length,NULL,0);
+}
+
+/***********************************************************************
+Check whether EEPROM is busy, and poll it during write cycle
+***********************************************************************/
+uint8_t eeprom_busy_check(EEPROM_Handle_t *EEPROMHandlePtr)
+{
+	if(EEPROMHandlePtr->state == EEPROM_BUSY_IN_WRITE_CYCLE && EEPROMHandlePtr->pollFlag == FALSE){
+		/*EEPROM which never answer is taken as gone, last write is reported as not acknowledged*/
+		if(EEPROMHandlePtr->numOfPolls >= EEPROM_MAX_POLLS){
+			EEPROMHandlePtr->result = I2C_TRANSACTION_NACK;
+			EEPROMHandlePtr->state = EEPROM_READY;
+			return FALSE;
+		}
+
+		EEPROMHandlePtr->numOfPolls++;
+		EEPROMHandlePtr->pollFlag = TRUE;
+		EEPROMHandlePtr->Transaction.txLength = 0;
+		EEPROMHandlePtr->Transaction.rxLength = 0;
+
+		if(I2C_queue_transaction(EEPROMHandlePtr->I2CxHandlePtr,&EEPROMHandlePtr->Transaction) != I2C_QUEUE_ACCEPTED){
+			EEPROMHandlePtr->pollFlag = FALSE;
+		}
+	}
+
+	if(EEPROMHandlePtr->state == EEPROM_READY){
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+/***********************************************************************
+Private function: Queue transaction of EEPROM, bytes to send are in txBuffer
+***********************************************************************/
+static uint8_t eeprom_queue(EEPROM_Handle_t *EEPROMHandlePtr, uint16_t txLength, uint8_t *rxBufferPtr, uint16_t rxLength)
+{
+	I2C_Transaction_t *TransactionPtr = &EEPROMHandlePtr->Transaction;
+
+	TransactionPtr->txLength = txLength;
+	TransactionPtr->rxBufferPtr = rxBufferPtr;
+	TransactionPtr->rxLength = rxLength;
+	TransactionPtr->repeatedStart = I2C_REPEATED_START_ENABLE;
+
+	/*state is set before queueing, transaction may end in interrupt before I2C_queue_transaction return*/
+	EEPROMHandlePtr->state = EEPROM_BUSY_IN_TRANSFER;
+
+	if(I2C_queue_transaction(EEPROMHandlePtr->I2CxHandlePtr,TransactionPtr) != I2C_QUEUE_ACCEPTED){
+		EEPROMHandlePtr->state = EEPROM_READY;
+		return EEPROM_ERR_BUSY;
+	}
+
+	return EEPROM_OK;
+}
+
+/***********************************************************************
+Private function: Transaction callback (called from I2C or DMA interrupt)
+***********************************************************************/
+static void eeprom_transaction_done(I2C_Transaction_t *TransactionPtr, uint8_t result)
+{
+	EEPROM_Handle_t *EEPROMHandlePtr = (EEPROM_Handle_t*)TransactionPtr->contextPtr;
+
+	/*address only transaction: EEPROM answer once write cycle is over (arbitration loss is polled again as well)*/
+	if(EEPROMHandlePtr->state == EEPROM_BUSY_IN_WRITE_CYCLE){
+		EEPROMHandlePtr->pollFlag = FALSE;
+		if(result == I2C_TRANSACTION_OK){
+			EEPROMHandlePtr->state = EEPROM_READY;
+		}
+		return;
+	}
+
+	EEPROMHandlePtr->result = result;
+
+	/*page is only programmed when every byte was acknowledged*/
+	if(result == I2C_TRANSACTION_OK && TransactionPtr->txLength > 2){
+		EEPROMHandlePtr->numOfPolls = 0;
+		EEPROMHandlePtr->pollFlag = FALSE;
+		EEPROMHandlePtr->state = EEPROM_BUSY_IN_WRITE_CYCLE;
+	}else{
+		EEPROMHandlePtr->state = EEPROM_READY;
+	}
+}
@@ -21,10 +21,99 @@ void ILI9341_send_parameter_16_bits (uint16_t param);
 void ILI9341_set_active_area (uint16_t startColum, uint16_t startPage, uint16_t endColumn, uint16_t endPage);
 static void ILI9341_delay(volatile uint32_t delay);
 static void ILI9341_fill_area (uint16_t startColumn, uint16_t endColumn, uint16_t startPage, uint16_t endPage, uint16_t color);
+static void ILI9341_draw_bitmap_window (uint16_t x, uint16_t y, const uint8_t *bitmapPtr, uint16_t bytesInScanLine, uint16_t startColumn, uint16_t numOfColumns, uint16_t startRow, uint16_t numOfRows, uint16_t foreground, uint16_t background);
+static void ILI9341_fill_bitmap_line (uint8_t bufferIndex, uint16_t row);
+static void ILI9341_send_fill_chunk (void);
+static void ILI9341_transfer_continue (void);
+static uint8_t ILI9341_framebuffer_row_check (int16_t y);
+#ifdef ILI9341_USE_FRAMEBUFFER
+static void ILI9341_framebuffer_start_strip (void);
+static void ILI9341_framebuffer_flush (void);
+static uint16_t ILI9341_framebuffer_tile_width (uint16_t tile);
+static uint16_t* ILI9341_framebuffer_get_tile (uint16_t tile);
+static void ILI9341_framebuffer_fill (uint16_t startColumn, uint16_t endColumn, uint16_t startPage, uint16_t endPage, uint16_t color);
+static void ILI9341_framebuffer_put_line (uint16_t x, uint16_t y, const uint16_t *linePtr, uint16_t numOfPixels);
+#endif
+
+#ifdef ILI9341_USE_SPI_BYTE_COUNTER
+#define ILI9341_COUNT_SPI_BYTES(n)	(ILI9341_SPIbyteCount += (n))
+#else
+#define ILI9341_COUNT_SPI_BYTES(n)
+#endif
+
+#ifdef ILI9341_USE_TRANSFER_TIMESTAMP
+#define ILI9341_STAMP_TRANSFER	(ILI9341_lastTransferTimestamp = DWT_get_cycle_count())
+#else
+#define ILI9341_STAMP_TRANSFER
+#endif
 
 ILI9341_Config_t ILI9341_config;
 uint16_t ILI9341_x;
 uint16_t ILI9341_y;
+uint32_t ILI9341_SPIbyteCount = 0;
+volatile uint32_t ILI9341_lastTransferTimestamp = 0;
+
+/*
+*@ILI9341_TRANSFER
+*Type of asynchronous (DMA) pixel transfer in progress
+*/
+#define ILI9341_TRANSFER_NONE	0
+#define ILI9341_TRANSFER_FILL	1
+#define ILI9341_TRANSFER_BITMAP	2
+
+#define ILI9341_DMA_MAX_COUNT	65535
+
+/*
+*Asynchronous pixel transfer. Only one transfer is in progress at a time, every command sent to ILI9341 wait until it finish
+*/
+typedef struct{
+	volatile uint8_t type;	/*Refer to @ILI9341_TRANSFER for possible value*/
+	uint16_t color;	/*fill color, read repeatedly by DMA*/
+	uint32_t remainingPixels;	/*fill pixels not yet handed to DMA*/
+	const uint8_t *bitmapPtr;
+	uint16_t bytesInScanLine;
+	uint16_t startColumn;
+	uint16_t numOfColumns;
+	uint16_t nextRow;	/*next bitmap row to expand into line buffer*/
+	uint16_t endRow;
+	uint16_t foreground;
+	uint16_t background;
+	uint8_t activeBuffer;	/*line buffer being drained by DMA*/
+	uint8_t nextBufferReady;	/*other line buffer hold next row*/
+}ILI9341_Transfer_t;
+
+static SPI_Handle_t *ILI9341_SPIHandlePtr = NULL;
+static ILI9341_Transfer_t ILI9341_transfer;
+
+/*ping-pong buffers holding one row of pixels each (longest row is in landscape orientation)*/
+static uint16_t ILI9341_lineBuffer[2][ILI9341_HEIGHT];
+
+#ifdef ILI9341_USE_FRAMEBUFFER
+
+#if (ILI9341_FB_TILES_IN_STRIP > 16)
+#error "ILI9341_FB_TILE_WIDTH is too small, at most 16 tiles in a strip"
+#endif
+
+#define ILI9341_FB_NO_BUFFER	0xFF
+
+/*
+*Framebuffer mode. Strip is drawn in one buffer while touched tiles of previous strip are sent by DMA from the other one
+*/
+typedef struct{
+	uint8_t active;
+	uint16_t stripY;	/*first row of current strip*/
+	uint16_t stripRows;	/*rows in current strip*/
+	uint16_t background;
+	uint16_t touchedTiles;	/*bit i set when tile i of current strip is drawn*/
+	uint8_t buffer;	/*strip buffer being drawn*/
+	uint8_t busyBuffer;	/*strip buffer which may still be read by DMA*/
+}ILI9341_Framebuffer_t;
+
+static ILI9341_Framebuffer_t ILI9341_framebuffer;
+
+/*pixels of a tile are contiguous (row by row, tile width per row) so that a tile is sent in single DMA transfer*/
+static uint16_t ILI9341_stripBuffer[2][ILI9341_FB_TILES_IN_STRIP][ILI9341_FB_TILE_WIDTH*ILI9341_FB_STRIP_HEIGHT];
+#endif
 
 /***********************************************************************
 Initilaize related hardware (GPIO pins, SPI peripheral and initilize display with default settings
@@ -60,6 +149,11 @@ Draw pixel in specified (x,y) position
 ***********************************************************************/
 __attribute__((weak)) void ILI9341_draw_pixel (int16_t x, int16_t y, uint16_t color)
 {
+	if(ILI9341_framebuffer_active_check()){
+		ILI9341_framebuffer_draw_pixel(x,y,color);
+		return;
+	}
+	
 	ILI9341_set_active_area(x,x,y,y);
 	ILI9341_send_command(ILI9341_MEM_WRITE);
 	ILI9341_send_parameter_16_bits(color);
@@ -83,6 +177,11 @@ void ILI9341_draw_bitmap (int16_t x, int16_t y, const uint8_t *bitmapPtr, uint16
 	uint8_t byte = 0;
 	
 	for(uint16_t i = 0; i < h; i++){
+		
+		if(!ILI9341_framebuffer_row_check(y + i)){
+			continue;
+		}
+		
 		for(uint16_t j = 0; j< w; j++){
 			
 			/*keep reading value of bits in byte. if finished reading previous byte, move to next byte*/
@@ -101,28 +200,45 @@ void ILI9341_draw_bitmap (int16_t x, int16_t y, const uint8_t *bitmapPtr, uint16
 
 /***********************************************************************
 Draw monochrome image starting from specified (x,y) position (with background)
-@note Based on drawBitmap function in Adafruit GFX Library
+Image is split into at most 4 windows where it cross right/bottom edge of screen, each window is sent in single memory write
 ***********************************************************************/
 void ILI9341_draw_bitmap_w_background (int16_t x, int16_t y, const uint8_t *bitmapPtr, uint16_t w, uint16_t h, uint16_t foreground, uint16_t background)
-	{
-	uint8_t bytesInScanLine = (w+7)/8;
-	uint8_t byte = 0;
+{
+	uint16_t bytesInScanLine = (w+7)/8;
+	uint16_t leftWidth, topHeight;
 	
-	for(uint16_t i = 0; i < h; i++){
-		for(uint16_t j = 0; j< w; j++){
-			
-			/*keep reading value of bits in byte. if finished reading previous byte, move to next byte*/
-			if(j & 0x07){
-				byte <<= 1;
-			}else{
-				byte = *(bitmapPtr + i*bytesInScanLine + j/8);
-			}
-			
-			if(byte & 0x80){
-				ILI9341_draw_pixel(x+j,y+i,foreground);
-			}else{
-				ILI9341_draw_pixel(x+j,y+i,background);
-			}
+	if(w > ILI9341_config.width){
+		w = ILI9341_config.width;
+	}
+	if(h > ILI9341_config.height){
+		h = ILI9341_config.height;
+	}
+	
+	/*wrap top left corner into screen*/
+	x %= (int16_t)ILI9341_config.width;
+	if(x < 0){
+		x += ILI9341_config.width;
+	}
+	y %= (int16_t)ILI9341_config.height;
+	if(y < 0){
+		y += ILI9341_config.height;
+	}
+	
+	/*number of columns before right edge and number of rows before bottom edge*/
+	leftWidth = (x + w > ILI9341_config.width) ? (ILI9341_config.width - x) : w;
+	topHeight = (y + h > ILI9341_config.height) ? (ILI9341_config.height - y) : h;
+	
+	ILI9341_draw_bitmap_window(x,y,bitmapPtr,bytesInScanLine,0,leftWidth,0,topHeight,foreground,background);
+	
+	if(leftWidth < w){
+		ILI9341_draw_bitmap_window(0,y,bitmapPtr,bytesInScanLine,leftWidth,w - leftWidth,0,topHeight,foreground,background);
+	}
+	
+	if(topHeight < h){
+		ILI9341_draw_bitmap_window(x,0,bitmapPtr,bytesInScanLine,0,leftWidth,topHeight,h - topHeight,foreground,background);
+		
+		if(leftWidth < w){
+			ILI9341_draw_bitmap_window(0,0,bitmapPtr,bytesInScanLine,leftWidth,w - leftWidth,topHeight,h - topHeight,foreground,background);
 		}
 	}
 }
@@ -181,6 +297,9 @@ void ILI9341_put_character (uint16_t x, uint16_t y, char c, TM_FontDef_t *font,
 	
 	/* Draw font data */
 	for (i = 0; i < font->FontHeight; i++) {
+		if (!ILI9341_framebuffer_row_check(ILI9341_y + i)) {
+			continue;
+		}
 		b = font->data[(c - 32) * font->FontHeight + i];
 		for (j = 0; j < font->FontWidth; j++) {
 			if ((b << j) & 0x8000) {
@@ -460,15 +579,141 @@ void ILI9341_draw_filled_circle(int16_t x0, int16_t y0, int16_t r, uint32_t colo
     }
 }
 
+/***********************************************************************
+Check whether pixel transfer is ongoing
+***********************************************************************/
+uint8_t ILI9341_busy_check (void)
+{
+	if(ILI9341_SPIHandlePtr == NULL){
+		return FALSE;
+	}
+	
+	if((ILI9341_transfer.type != ILI9341_TRANSFER_NONE) || SPI_DMA_TX_busy_check(ILI9341_SPIHandlePtr)){
+		return TRUE;
+	}
+	
+	return FALSE;
+}
+
+/***********************************************************************
+Wait until pixel transfer is finished
+***********************************************************************/
+void ILI9341_wait_until_ready (void)
+{
+	while(ILI9341_busy_check());
+}
+
+/***********************************************************************
+Get number of bytes sent to ILI9341 through SPI since last reset
+***********************************************************************/
+uint32_t ILI9341_get_SPI_byte_count (void)
+{
+	return ILI9341_SPIbyteCount;
+}
+
+/***********************************************************************
+Reset SPI byte counter
+***********************************************************************/
+void ILI9341_reset_SPI_byte_count (void)
+{
+	ILI9341_SPIbyteCount = 0;
+}
+
+/***********************************************************************
+Get time stamp of last byte sent to ILI9341
+***********************************************************************/
+uint32_t ILI9341_get_last_transfer_timestamp (void)
+{
+	return ILI9341_lastTransferTimestamp;
+}
+
+/***********************************************************************
+Start drawing screen into framebuffer strips
+***********************************************************************/
+void ILI9341_framebuffer_begin (uint16_t background)
+{
+#ifdef ILI9341_USE_FRAMEBUFFER
+	/*line buffers and strip buffers must not be read by DMA of previous drawing*/
+	ILI9341_wait_until_ready();
+	
+	ILI9341_framebuffer.active = TRUE;
+	ILI9341_framebuffer.stripY = 0;
+	ILI9341_framebuffer.background = background;
+	ILI9341_framebuffer.buffer = 1;
+	ILI9341_framebuffer.busyBuffer = ILI9341_FB_NO_BUFFER;
+	ILI9341_framebuffer_start_strip();
+#endif
+}
+
+/***********************************************************************
+Send touched tiles of current strip and move to next strip
+***********************************************************************/
+uint8_t ILI9341_framebuffer_next_strip (void)
+{
+#ifdef ILI9341_USE_FRAMEBUFFER
+	if(ILI9341_framebuffer.active != TRUE){
+		return FALSE;
+	}
+	
+	ILI9341_framebuffer_flush();
+	ILI9341_framebuffer.stripY += ILI9341_framebuffer.stripRows;
+	
+	if(ILI9341_framebuffer.stripY >= ILI9341_config.height){
+		ILI9341_framebuffer.active = FALSE;
+		return FALSE;
+	}
+	
+	ILI9341_framebuffer_start_strip();
+	return TRUE;
+#else
+	return FALSE;
+#endif
+}
+
+/***********************************************************************
+Check whether primitives are drawn into framebuffer
+***********************************************************************/
+uint8_t ILI9341_framebuffer_active_check (void)
+{
+#ifdef ILI9341_USE_FRAMEBUFFER
+	return ILI9341_framebuffer.active;
+#else
+	return FALSE;
+#endif
+}
+
+/***********************************************************************
+Draw pixel into current strip
+***********************************************************************/
+void ILI9341_framebuffer_draw_pixel (int16_t x, int16_t y, uint16_t color)
+{
+#ifdef ILI9341_USE_FRAMEBUFFER
+	uint16_t row = y - ILI9341_framebuffer.stripY;
+	uint16_t tile;
+	
+	if((x < 0) || (x >= ILI9341_config.width) || (y < ILI9341_framebuffer.stripY) || (row >= ILI9341_framebuffer.stripRows)){
+		return;
+	}
+	
+	tile = x/ILI9341_FB_TILE_WIDTH;
+	ILI9341_framebuffer_get_tile(tile)[row*ILI9341_framebuffer_tile_width(tile) + x%ILI9341_FB_TILE_WIDTH] = color;
+#endif
+}
+
 /***********************************************************************
 Private function: Initilize related hardware (SPI peripheral and GPIO pins)
 ***********************************************************************/
 void ILI9341_HW_init (void)
 {
-	/*Initilize SPI peripheral*/
-	SPI_general_init(ILI9341_SPI,ILI9341_SPI_PINS_PACK,SPI_MODE_MASTER,SPI_BUS_FULL_DUPLEX,SPI_DATA_8BITS,SPI_CLK_PHASE_1ST_E,SPI_CLK_POL_LIDLE,SPI_SSM_EN,SPI_CLK_SPEED_DIV2);
+	/*Initilize SPI peripheral, serial clock as fast as ILI9341_SPI_MAX_CLK allow with current APB clock*/
+	uint8_t clkSpeed = RCC_get_SPI_prescaler((uint32_t)RCC_get_PCLK_value(ILI9341_SPI_APB),ILI9341_SPI_MAX_CLK);
+	ILI9341_SPIHandlePtr = SPI_general_init(ILI9341_SPI,ILI9341_SPI_PINS_PACK,SPI_MODE_MASTER,SPI_BUS_FULL_DUPLEX,SPI_DATA_8BITS,SPI_CLK_PHASE_1ST_E,SPI_CLK_POL_LIDLE,SPI_SSM_EN,clkSpeed);
 	SPI_SSI_ctr(ILI9341_SPI,ENABLE);
 	
+	/*Initilize DMA stream for pixel transfer*/
+	SPI_DMA_TX_init(ILI9341_SPIHandlePtr);
+	DMA_intrpt_vector_ctr(ILI9341_SPI_DMA_IRQ,ENABLE);
+	
 	/*Initilize CSX pin*/
 	GPIO_init_direct(ILI9341_CSX_PORT,ILI9341_CSX_PIN,GPIO_MODE_OUT,GPIO_OUTPUT_VERY_HIGH_SPEED,GPIO_OUTPUT_TYPE_PP,GPIO_PU,0);
 	
@@ -599,9 +844,12 @@ Private function: Send command
 ***********************************************************************/
 void ILI9341_send_command (uint8_t cmd)
 {
+	ILI9341_wait_until_ready();
 	ILI9341_DCX_CLEAR;
 	ILI9341_CSX_CLEAR;
 	SPI_send_8_bits(ILI9341_SPI,cmd);
+	ILI9341_COUNT_SPI_BYTES(1);
+	ILI9341_STAMP_TRANSFER;
 //	ILI9341_Delay(10);
 //	ILI9341_CSX_SET;
 }
@@ -611,9 +859,12 @@ Private function: Send parameter
 ***********************************************************************/
 void ILI9341_send_parameter (uint8_t param)
 {
+	ILI9341_wait_until_ready();
 	ILI9341_DCX_SET;
 	ILI9341_CSX_CLEAR;
 	SPI_send_8_bits(ILI9341_SPI,param);
+	ILI9341_COUNT_SPI_BYTES(1);
+	ILI9341_STAMP_TRANSFER;
 //	ILI9341_Delay(10);
 //	ILI9341_CSX_SET;
 }
@@ -623,9 +874,12 @@ Private function: Send parameter
 ***********************************************************************/
 void ILI9341_send_parameter_16_bits (uint16_t param)
 {
+	ILI9341_wait_until_ready();
 	ILI9341_DCX_SET;
 	ILI9341_CSX_CLEAR;
 	SPI_send_16_bits(ILI9341_SPI,param);
+	ILI9341_COUNT_SPI_BYTES(2);
+	ILI9341_STAMP_TRANSFER;
 //	ILI9341_Delay(10);	
 //	ILI9341_CSX_SET;
 }
@@ -652,17 +906,342 @@ void ILI9341_delay(volatile uint32_t delay) {
 
 /***********************************************************************
 Private function: Fill area
+Pixels are sent by DMA, function return right after transfer is started
 ***********************************************************************/
 void ILI9341_fill_area (uint16_t startColumn, uint16_t endColumn, uint16_t startPage, uint16_t endPage, uint16_t color)
 {
+#ifdef ILI9341_USE_FRAMEBUFFER
+	if(ILI9341_framebuffer.active == TRUE){
+		ILI9341_framebuffer_fill(startColumn,endColumn,startPage,endPage,color);
+		return;
+	}
+#endif
+	
 	ILI9341_set_active_area(startColumn,endColumn,startPage,endPage);
 	ILI9341_send_command(ILI9341_MEM_WRITE);
 	uint16_t areaWidth = endColumn - startColumn +1 ;
 	uint16_t areaHeight  = endPage - startPage + 1; 
-	uint32_t areaPixelCount = areaHeight*areaWidth;
-	uint32_t count = 0 ;
-	while(count < areaPixelCount){
-		ILI9341_send_parameter_16_bits(color);
-		count++;
+	uint32_t areaPixelCount = (uint32_t)areaHeight*areaWidth;
+	ILI9341_COUNT_SPI_BYTES(2*areaPixelCount);
+	
+	ILI9341_transfer.color = color;
+	ILI9341_transfer.remainingPixels = areaPixelCount;
+	ILI9341_transfer.type = ILI9341_TRANSFER_FILL;
+	
+	ILI9341_DCX_SET;
+	ILI9341_CSX_CLEAR;
+	ILI9341_send_fill_chunk();
+}
+
+/***********************************************************************
+Private function: Draw part of monochrome image (with background) in single window
+Window start at (x,y) on screen and cover columns [startColumn,startColumn + numOfColumns) and rows [startRow,startRow + numOfRows) of image.
+Rows are expanded into ping-pong line buffers and sent by DMA, function return after first rows are handed to DMA
+***********************************************************************/
+void ILI9341_draw_bitmap_window (uint16_t x, uint16_t y, const uint8_t *bitmapPtr, uint16_t bytesInScanLine, uint16_t startColumn, uint16_t numOfColumns, uint16_t startRow, uint16_t numOfRows, uint16_t foreground, uint16_t background)
+{
+	if((numOfColumns == 0) || (numOfRows == 0)){
+		return;
+	}
+	
+#ifdef ILI9341_USE_FRAMEBUFFER
+	if(ILI9341_framebuffer.active == TRUE){
+		ILI9341_transfer.bitmapPtr = bitmapPtr;
+		ILI9341_transfer.bytesInScanLine = bytesInScanLine;
+		ILI9341_transfer.startColumn = startColumn;
+		ILI9341_transfer.numOfColumns = numOfColumns;
+		ILI9341_transfer.foreground = foreground;
+		ILI9341_transfer.background = background;
+		
+		/*only rows inside current strip are expanded (line buffer is free, no bitmap transfer in framebuffer mode)*/
+		for(uint16_t i = 0; i < numOfRows; i++){
+			if(((uint16_t)(y + i) >= ILI9341_framebuffer.stripY) && ((uint16_t)(y + i) < ILI9341_framebuffer.stripY + ILI9341_framebuffer.stripRows)){
+				ILI9341_fill_bitmap_line(0,startRow + i);
+				ILI9341_framebuffer_put_line(x,y + i,ILI9341_lineBuffer[0],numOfColumns);
+			}
+		}
+		return;
+	}
+#endif
+	
+	ILI9341_set_active_area(x,x + numOfColumns - 1,y,y + numOfRows - 1);
+	ILI9341_send_command(ILI9341_MEM_WRITE);
+	ILI9341_COUNT_SPI_BYTES(2*(uint32_t)numOfColumns*numOfRows);
+	
+	ILI9341_transfer.bitmapPtr = bitmapPtr;
+	ILI9341_transfer.bytesInScanLine = bytesInScanLine;
+	ILI9341_transfer.startColumn = startColumn;
+	ILI9341_transfer.numOfColumns = numOfColumns;
+	ILI9341_transfer.endRow = startRow + numOfRows;
+	ILI9341_transfer.foreground = foreground;
+	ILI9341_transfer.background = background;
+	
+	/*prepare both line buffers before starting DMA so that completion interrupt always find next row ready*/
+	ILI9341_fill_bitmap_line(0,startRow);
+	ILI9341_transfer.nextRow = startRow + 1;
+	ILI9341_transfer.nextBufferReady = FALSE;
+	
+	if(ILI9341_transfer.nextRow < ILI9341_transfer.endRow){
+		ILI9341_fill_bitmap_line(1,ILI9341_transfer.nextRow);
+		ILI9341_transfer.nextRow++;
+		ILI9341_transfer.nextBufferReady = TRUE;
 	}
+	
+	ILI9341_transfer.activeBuffer = 0;
+	ILI9341_transfer.type = ILI9341_TRANSFER_BITMAP;
+	
+	ILI9341_DCX_SET;
+	ILI9341_CSX_CLEAR;
+	SPI_send_data_DMA(ILI9341_SPIHandlePtr,ILI9341_lineBuffer[0],numOfColumns,SPI_DATA_16BITS,ENABLE);
+}
+
+/***********************************************************************
+Private function: Expand one row of monochrome image into line buffer
+MSB of each byte is leftmost pixel
+***********************************************************************/
+void ILI9341_fill_bitmap_line (uint8_t bufferIndex, uint16_t row)
+{
+	uint16_t *linePtr = ILI9341_lineBuffer[bufferIndex];
+	uint16_t startColumn = ILI9341_transfer.startColumn;
+	const uint8_t *bytePtr = ILI9341_transfer.bitmapPtr + row*ILI9341_transfer.bytesInScanLine + startColumn/8;
+	uint8_t byte = (*bytePtr++) << (startColumn & 0x07);
+	
+	for(uint16_t j = 0; j < ILI9341_transfer.numOfColumns; j++){
+		if((j != 0) && (((startColumn + j) & 0x07) == 0)){
+			byte = *bytePtr++;
+		}
+		
+		linePtr[j] = (byte & 0x80) ? ILI9341_transfer.foreground : ILI9341_transfer.background;
+		byte <<= 1;
+	}
+}
+
+/***********************************************************************
+Private function: Hand next part of fill area to DMA (at most 65535 pixels at a time)
+***********************************************************************/
+void ILI9341_send_fill_chunk (void)
+{
+	uint16_t count = (ILI9341_transfer.remainingPixels > ILI9341_DMA_MAX_COUNT) ? ILI9341_DMA_MAX_COUNT : ILI9341_transfer.remainingPixels;
+	
+	ILI9341_transfer.remainingPixels -= count;
+	SPI_send_data_DMA(ILI9341_SPIHandlePtr,&ILI9341_transfer.color,count,SPI_DATA_16BITS,DISABLE);
+}
+
+/***********************************************************************
+Private function: Continue asynchronous transfer after DMA finish previous part (called in interrupt)
+***********************************************************************/
+void ILI9341_transfer_continue (void)
+{
+	if(ILI9341_SPIHandlePtr->txState == SPI_STATE_TX_BUSY){
+		return;
+	}
+	
+	if(ILI9341_transfer.type == ILI9341_TRANSFER_FILL){
+		
+		if(ILI9341_transfer.remainingPixels){
+			ILI9341_send_fill_chunk();
+		}else{
+			ILI9341_transfer.type = ILI9341_TRANSFER_NONE;
+		}
+		
+	}else if(ILI9341_transfer.type == ILI9341_TRANSFER_BITMAP){
+		
+		if(ILI9341_transfer.nextBufferReady){
+			/*start sending next row first, then refill line buffer which was just drained*/
+			uint8_t drainedBuffer = ILI9341_transfer.activeBuffer;
+			
+			ILI9341_transfer.activeBuffer ^= 1;
+			ILI9341_transfer.nextBufferReady = FALSE;
+			SPI_send_data_DMA(ILI9341_SPIHandlePtr,ILI9341_lineBuffer[ILI9341_transfer.activeBuffer],ILI9341_transfer.numOfColumns,SPI_DATA_16BITS,ENABLE);
+			
+			if(ILI9341_transfer.nextRow < ILI9341_transfer.endRow){
+				ILI9341_fill_bitmap_line(drainedBuffer,ILI9341_transfer.nextRow);
+				ILI9341_transfer.nextRow++;
+				ILI9341_transfer.nextBufferReady = TRUE;
+			}
+		}else{
+			ILI9341_transfer.type = ILI9341_TRANSFER_NONE;
+		}
+	}
+}
+
+/***********************************************************************
+Private function: Check whether row of primitive may be drawn in current strip
+Row is wrapped around bottom edge like overridden ILI9341_draw_pixel may do, pixels of row are still clipped one by one
+***********************************************************************/
+uint8_t ILI9341_framebuffer_row_check (int16_t y)
+{
+#ifdef ILI9341_USE_FRAMEBUFFER
+	if(ILI9341_framebuffer.active != TRUE){
+		return TRUE;
+	}
+	
+	y %= (int16_t)ILI9341_config.height;
+	if(y < 0){
+		y += ILI9341_config.height;
+	}
+	
+	return ((y >= ILI9341_framebuffer.stripY) && (y < ILI9341_framebuffer.stripY + ILI9341_framebuffer.stripRows)) ? TRUE : FALSE;
+#else
+	return TRUE;
+#endif
+}
+
+#ifdef ILI9341_USE_FRAMEBUFFER
+/***********************************************************************
+Private function: Prepare next strip buffer, no tile is touched yet
+***********************************************************************/
+void ILI9341_framebuffer_start_strip (void)
+{
+	uint16_t rowsLeft = ILI9341_config.height - ILI9341_framebuffer.stripY;
+	
+	ILI9341_framebuffer.buffer ^= 1;
+	
+	if(ILI9341_framebuffer.busyBuffer == ILI9341_framebuffer.buffer){
+		ILI9341_wait_until_ready();
+	}
+	
+	ILI9341_framebuffer.busyBuffer = ILI9341_FB_NO_BUFFER;
+	ILI9341_framebuffer.stripRows = (rowsLeft > ILI9341_FB_STRIP_HEIGHT) ? ILI9341_FB_STRIP_HEIGHT : rowsLeft;
+	ILI9341_framebuffer.touchedTiles = 0;
+}
+
+/***********************************************************************
+Private function: Send touched tiles of current strip, each tile in single memory write (by DMA)
+Function return after last tile is handed to DMA
+***********************************************************************/
+void ILI9341_framebuffer_flush (void)
+{
+	uint16_t firstRow = ILI9341_framebuffer.stripY;
+	uint16_t lastRow = firstRow + ILI9341_framebuffer.stripRows - 1;
+	
+	for(uint16_t tile = 0; tile < ILI9341_FB_TILES_IN_STRIP; tile++){
+		
+		if(!(ILI9341_framebuffer.touchedTiles & (1U << tile))){
+			continue;
+		}
+		
+		uint16_t x = tile*ILI9341_FB_TILE_WIDTH;
+		uint16_t tileWidth = ILI9341_framebuffer_tile_width(tile);
+		uint16_t numOfPixels = tileWidth*ILI9341_framebuffer.stripRows;
+		
+		ILI9341_set_active_area(x,x + tileWidth - 1,firstRow,lastRow);
+		ILI9341_send_command(ILI9341_MEM_WRITE);
+		ILI9341_COUNT_SPI_BYTES(2*(uint32_t)numOfPixels);
+		
+		ILI9341_DCX_SET;
+		ILI9341_CSX_CLEAR;
+		SPI_send_data_DMA(ILI9341_SPIHandlePtr,ILI9341_stripBuffer[ILI9341_framebuffer.buffer][tile],numOfPixels,SPI_DATA_16BITS,ENABLE);
+		ILI9341_framebuffer.busyBuffer = ILI9341_framebuffer.buffer;
+	}
+}
+
+/***********************************************************************
+Private function: Get number of columns of tile (last tile of portrait strip is narrower)
+***********************************************************************/
+uint16_t ILI9341_framebuffer_tile_width (uint16_t tile)
+{
+	uint16_t columnsLeft = ILI9341_config.width - tile*ILI9341_FB_TILE_WIDTH;
+	
+	return (columnsLeft > ILI9341_FB_TILE_WIDTH) ? ILI9341_FB_TILE_WIDTH : columnsLeft;
+}
+
+/***********************************************************************
+Private function: Get pixels of tile in current strip, tile is filled with background when it is touched first time
+***********************************************************************/
+uint16_t* ILI9341_framebuffer_get_tile (uint16_t tile)
+{
+	uint16_t *tilePtr = ILI9341_stripBuffer[ILI9341_framebuffer.buffer][tile];
+	
+	if(!(ILI9341_framebuffer.touchedTiles & (1U << tile))){
+		uint16_t numOfPixels = ILI9341_framebuffer_tile_width(tile)*ILI9341_framebuffer.stripRows;
+		
+		for(uint16_t i = 0; i < numOfPixels; i++){
+			tilePtr[i] = ILI9341_framebuffer.background;
+		}
+		
+		ILI9341_framebuffer.touchedTiles |= (1U << tile);
+	}
+	
+	return tilePtr;
+}
+
+/***********************************************************************
+Private function: Fill part of area inside current strip
+***********************************************************************/
+void ILI9341_framebuffer_fill (uint16_t startColumn, uint16_t endColumn, uint16_t startPage, uint16_t endPage, uint16_t color)
+{
+	uint16_t stripEnd = ILI9341_framebuffer.stripY + ILI9341_framebuffer.stripRows - 1;
+	
+	if(endColumn >= ILI9341_config.width){
+		endColumn = ILI9341_config.width - 1;
+	}
+	if(startPage < ILI9341_framebuffer.stripY){
+		startPage = ILI9341_framebuffer.stripY;
+	}
+	if(endPage > stripEnd){
+		endPage = stripEnd;
+	}
+	if((startColumn > endColumn) || (startPage > endPage)){
+		return;
+	}
+	
+	for(uint16_t tile = startColumn/ILI9341_FB_TILE_WIDTH; tile <= endColumn/ILI9341_FB_TILE_WIDTH; tile++){
+		uint16_t *tilePtr = ILI9341_framebuffer_get_tile(tile);
+		uint16_t tileWidth = ILI9341_framebuffer_tile_width(tile);
+		uint16_t tileX = tile*ILI9341_FB_TILE_WIDTH;
+		uint16_t firstColumn = (startColumn > tileX) ? startColumn - tileX : 0;
+		uint16_t lastColumn = (endColumn < tileX + tileWidth - 1) ? endColumn - tileX : tileWidth - 1;
+		
+		for(uint16_t row = startPage - ILI9341_framebuffer.stripY; row <= endPage - ILI9341_framebuffer.stripY; row++){
+			uint16_t *pixelPtr = tilePtr + row*tileWidth;
+			
+			for(uint16_t column = firstColumn; column <= lastColumn; column++){
+				pixelPtr[column] = color;
+			}
+		}
+	}
+}
+
+/***********************************************************************
+Private function: Copy pixels of one row (inside current strip) into tiles
+***********************************************************************/
+void ILI9341_framebuffer_put_line (uint16_t x, uint16_t y, const uint16_t *linePtr, uint16_t numOfPixels)
+{
+	uint16_t row = y - ILI9341_framebuffer.stripY;
+	
+	if(x + numOfPixels > ILI9341_config.width){
+		numOfPixels = ILI9341_config.width - x;
+	}
+	
+	while(numOfPixels){
+		uint16_t tile = x/ILI9341_FB_TILE_WIDTH;
+		uint16_t tileWidth = ILI9341_framebuffer_tile_width(tile);
+		uint16_t column = x%ILI9341_FB_TILE_WIDTH;
+		uint16_t count = tileWidth - column;
+		uint16_t *pixelPtr = ILI9341_framebuffer_get_tile(tile) + row*tileWidth + column;
+		
+		if(count > numOfPixels){
+			count = numOfPixels;
+		}
+		
+		for(uint16_t i = 0; i < count; i++){
+			pixelPtr[i] = linePtr[i];
+		}
+		
+		linePtr += count;
+		x += count;
+		numOfPixels -= count;
+	}
+}
+#endif
+
+/***********************************************************************
+Interrupt handler of DMA stream used for SPI transmission
+***********************************************************************/
+void ILI9341_SPI_DMA_IRQ_HANDLER (void)
+{
+	ILI9341_STAMP_TRANSFER;
+	SPI_DMA_TX_intrpt_handler(ILI9341_SPIHandlePtr);
+	ILI9341_transfer_continue();
 }
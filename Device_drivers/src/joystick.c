@@ -4,6 +4,8 @@
 *
 *This implementation file provide functions for interfacing with joystick.
 *The joystick communicate its position (in X axis & Y axis) with the MCU through 2 ADC channel.
+*With JOYSTICK_USE_DMA, ADC1 (or ADC given to joystick_init) convert X and Y channels in scan and continuous mode and DMA write
+*each conversion into joystickScan, the oldest scan being overwritten.
 *
 *@author Tran Thanh Nhan
 *@date 27/08/2019
@@ -11,6 +13,18 @@
 
 #include "../inc/joystick.h"                
 
+/*center of X and Y axis in 12 bits digital number * 16, so that drift smaller than 1 is tracked*/
+int32_t joystickCenter[2] = {JOYSTICK_POS_CENTER << 4,JOYSTICK_POS_CENTER << 4};
+
+#ifdef JOYSTICK_USE_DMA
+/*X and Y conversions of latest scans, written by DMA*/
+volatile uint16_t joystickScan[JOYSTICK_OVERSAMPLING][2];
+uint8_t joystickSequence[2];
+ADC_Config_t joystickADCConfig;
+ADC_Handle_t joystickADCHandle;
+uint8_t joystickConverting = FALSE;
+#endif
+
 /***********************************************************************
 Initilize joystick
 ***********************************************************************/
@@ -18,6 +32,36 @@ void joystick_init(ADC_TypeDef *ADCxPtr, uint8_t X_axis_ADC_channel, uint8_t Y_a
 {
 	ADC_init_channel(ADCxPtr,X_axis_ADC_channel);
 	ADC_init_channel(ADCxPtr,Y_axis_ADC_channel);
+	
+#ifdef JOYSTICK_USE_DMA
+	/*joystick initialized again restart conversions*/
+	if(joystickConverting == TRUE){
+		ADC_stop_DMA(&joystickADCHandle);
+	}
+	
+	/*joystick is centered until first scan end*/
+	for(uint8_t i = 0; i < JOYSTICK_OVERSAMPLING; i++){
+		joystickScan[i][0] = JOYSTICK_POS_CENTER;
+		joystickScan[i][1] = JOYSTICK_POS_CENTER;
+	}
+	
+	joystickSequence[0] = X_axis_ADC_channel;
+	joystickSequence[1] = Y_axis_ADC_channel;
+	
+	joystickADCConfig.numOfConversion = 2;
+	joystickADCConfig.resolution = ADC_RES_12_bits;
+	joystickADCConfig.conversionMode = ADC_CVSMODE_CONT;
+	joystickADCConfig.sampleTime = JOYSTICK_SAMPLE_TIME;
+	joystickADCConfig.sequencePtr = joystickSequence;
+	
+	joystickADCHandle.ADCxPtr = ADCxPtr;
+	joystickADCHandle.ADCxConfigPtr = &joystickADCConfig;
+	
+	ADC_init(&joystickADCHandle);
+	ADC_DMA_init(&joystickADCHandle);
+	ADC_start_DMA(&joystickADCHandle,&joystickScan[0][0],2*JOYSTICK_OVERSAMPLING);
+	joystickConverting = TRUE;
+#endif
 }
 
 /***********************************************************************
@@ -25,6 +69,12 @@ Deinitilize joystick
 ***********************************************************************/
 void joystick_deinit(ADC_TypeDef *ADCxPtr)
 {
+#ifdef JOYSTICK_USE_DMA
+	if(joystickConverting == TRUE){
+		ADC_stop_DMA(&joystickADCHandle);
+		joystickConverting = FALSE;
+	}
+#endif
 	ADC_deinit();
 }
 
@@ -34,8 +84,9 @@ Read joystick direction
 uint8_t joystick_read_direction(ADC_TypeDef *ADCxPtr, uint8_t X_axis_ADC_channel, uint8_t Y_axis_ADC_channel)
 {
 	int8_t xDir = 0, yDir = 0;
-	uint16_t xPos = ADC_read(ADCxPtr,X_axis_ADC_channel);
-	uint16_t yPos = ADC_read(ADCxPtr,Y_axis_ADC_channel);
+	uint16_t xPos, yPos;
+	
+	joystick_read_position(ADCxPtr,X_axis_ADC_channel,Y_axis_ADC_channel,&xPos,&yPos);
 	
 	if(xPos > X_POS_THRES_H){
 		xDir = X_DIR_RIGHT;
@@ -83,3 +134,98 @@ uint8_t joystick_read_direction(ADC_TypeDef *ADCxPtr, uint8_t X_axis_ADC_channel
 		}
 	}	
 }
+
+/***********************************************************************
+Read joystick position
+***********************************************************************/
+void joystick_read_position(ADC_TypeDef *ADCxPtr, uint8_t X_axis_ADC_channel, uint8_t Y_axis_ADC_channel, uint16_t *xPosPtr, uint16_t *yPosPtr)
+{
+#ifdef JOYSTICK_USE_DMA
+	uint32_t xSum = 0, ySum = 0;
+	
+	/*conversions are 16 bits loads from buffer, a scan being written by DMA may mix with previous one which is harmless*/
+	for(uint8_t i = 0; i < JOYSTICK_OVERSAMPLING; i++){
+		xSum += joystickScan[i][0];
+		ySum += joystickScan[i][1];
+	}
+	
+	*xPosPtr = (uint16_t)(xSum/JOYSTICK_OVERSAMPLING);
+	*yPosPtr = (uint16_t)(ySum/JOYSTICK_OVERSAMPLING);
+#else
+	*xPosPtr = ADC_read(ADCxPtr,X_axis_ADC_channel);
+	*yPosPtr = ADC_read(ADCxPtr,Y_axis_ADC_channel);
+#endif
+}
+
+/***********************************************************************
+Capture center of joystick
+***********************************************************************/
+void joystick_calibrate(ADC_TypeDef *ADCxPtr, uint8_t X_axis_ADC_channel, uint8_t Y_axis_ADC_channel)
+{
+	uint16_t xPos, yPos;
+	
+	joystick_read_position(ADCxPtr,X_axis_ADC_channel,Y_axis_ADC_channel,&xPos,&yPos);
+	
+	joystickCenter[0] = (int32_t)xPos << 4;
+	joystickCenter[1] = (int32_t)yPos << 4;
+}
+
+/***********************************************************************
+Read joystick as calibrated analog vector
+***********************************************************************/
+void joystick_read_vector(ADC_TypeDef *ADCxPtr, uint8_t X_axis_ADC_channel, uint8_t Y_axis_ADC_channel, Joystick_Vector_t *VectorPtr)
+{
+	uint16_t position[2];
+	int32_t normalized[2];
+	uint32_t radius, magnitude;
+	
+	joystick_read_position(ADCxPtr,X_axis_ADC_channel,Y_axis_ADC_channel,&position[0],&position[1]);
+	
+	/*offset from center divided by distance from center to full deflection on its side*/
+	for(uint8_t axis = 0; axis < 2; axis++){
+		int32_t offset = ((int32_t)position[axis] << 4) - joystickCenter[axis];
+		int32_t span = (offset >= 0) ? (((int32_t)JOYSTICK_POS_MAX << 4) - joystickCenter[axis]) : joystickCenter[axis];
+		
+		span -= JOYSTICK_RAIL_MARGIN << 4;
+		if(span < (JOYSTICK_RAIL_MARGIN << 4)){
+			span = JOYSTICK_RAIL_MARGIN << 4;
+		}
+		
+		normalized[axis] = offset*JOYSTICK_VECTOR_ONE/span;
+		
+		if(normalized[axis] > JOYSTICK_VECTOR_ONE){
+			normalized[axis] = JOYSTICK_VECTOR_ONE;
+		}else if(normalized[axis] < -JOYSTICK_VECTOR_ONE){
+			normalized[axis] = -JOYSTICK_VECTOR_ONE;
+		}
+	}
+	
+	radius = fast_sqrt((uint32_t)(normalized[0]*normalized[0]) + (uint32_t)(normalized[1]*normalized[1]));
+	
+	/*joystick at rest, center follow drift*/
+	if(radius <= JOYSTICK_DEAD_ZONE){
+		for(uint8_t axis = 0; axis < 2; axis++){
+			joystickCenter[axis] += (((int32_t)position[axis] << 4) - joystickCenter[axis])/(1 << JOYSTICK_DRIFT_SHIFT);
+		}
+		
+		VectorPtr->x = 0;
+		VectorPtr->y = 0;
+		VectorPtr->magnitude = 0;
+		VectorPtr->angle = 0;
+		return;
+	}
+	
+	/*corners of square range are brought back on circle*/
+	if(radius > JOYSTICK_VECTOR_ONE){
+		normalized[0] = normalized[0]*JOYSTICK_VECTOR_ONE/(int32_t)radius;
+		normalized[1] = normalized[1]*JOYSTICK_VECTOR_ONE/(int32_t)radius;
+		radius = JOYSTICK_VECTOR_ONE;
+	}
+	
+	magnitude = (radius - JOYSTICK_DEAD_ZONE)*JOYSTICK_VECTOR_ONE/(JOYSTICK_VECTOR_ONE - JOYSTICK_DEAD_ZONE);
+	
+	VectorPtr->x = (int16_t)(normalized[0]*(int32_t)magnitude/(int32_t)radius);
+	VectorPtr->y = (int16_t)(normalized[1]*(int32_t)magnitude/(int32_t)radius);
+	VectorPtr->magnitude = (uint16_t)magnitude;
+	VectorPtr->angle = fast_atan2(normalized[1],normalized[0]);
+}
@@ -0,0 +1,179 @@
+/**
+*@file sequencer.c
+*@brief provide functions for playing music with synthesizer notes of speaker driver
+*
+*This implementation file provide functions for playing songs in background.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../inc/sequencer.h"
+
+typedef struct{
+	uint16_t eventIndex;	/*next event*/
+	uint8_t ticksLeft;		/*ticks before next event*/
+	uint8_t ended;
+}Sequencer_Track_State_t;
+
+static uint8_t sequencer_block_callback (uint16_t numOfSamples);
+static void sequencer_tick (void);
+static uint8_t sequencer_process_tracks (void);
+static void sequencer_restart (void);
+
+const Sequencer_Song_t *volatile sequencerSongPtr = NULL;
+Sequencer_Track_State_t sequencerTrack[SEQUENCER_MAX_TRACKS];
+volatile uint16_t sequencerTempo = 0;
+
+/*samples since last tick multiplied by tempo*SEQUENCER_TICKS_PER_BEAT (ticks per minute), tick is due at 60*sampleRate*/
+uint32_t sequencerTime = 0;
+
+void sequencer_play (const Sequencer_Song_t *SongPtr)
+{
+	speaker_set_block_callback(NULL);
+
+	/*tick length is derived from sample rate set by speaker_init*/
+	if((SongPtr == NULL) || (SongPtr->numOfTracks == 0) || (SongPtr->numOfTracks > SEQUENCER_MAX_TRACKS) || (speaker_get_sample_rate() == 0)){
+		sequencerSongPtr = NULL;
+		return;
+	}
+
+	sequencerSongPtr = SongPtr;
+	sequencer_restart();
+
+	/*first tick is due at once*/
+	sequencerTime = 60*speaker_get_sample_rate();
+
+	speaker_set_block_callback(sequencer_block_callback);
+}
+
+void sequencer_stop (void)
+{
+	speaker_set_block_callback(NULL);
+	sequencerSongPtr = NULL;
+}
+
+uint8_t sequencer_playing_check (void)
+{
+	return (sequencerSongPtr != NULL) ? TRUE : FALSE;
+}
+
+void sequencer_set_tempo (uint16_t tempo)
+{
+	if(tempo){
+		sequencerTempo = tempo;
+	}
+}
+
+/*count time of block, ticks due before start of block are processed first (called in speaker interrupt)*/
+uint8_t sequencer_block_callback (uint16_t numOfSamples)
+{
+	uint32_t tickLength = 60*speaker_get_sample_rate();
+
+	if(sequencerSongPtr == NULL){
+		return FALSE;
+	}
+
+	while(sequencerTime >= tickLength){
+		sequencerTime -= tickLength;
+		sequencer_tick();
+
+		if(sequencerSongPtr == NULL){
+			speaker_set_block_callback(NULL);
+			return FALSE;
+		}
+	}
+
+	sequencerTime += (uint32_t)numOfSamples * sequencerTempo * SEQUENCER_TICKS_PER_BEAT;
+
+	return TRUE;
+}
+
+/*move every track forward by one tick, song restart or end when every track has ended*/
+void sequencer_tick (void)
+{
+	if(sequencer_process_tracks()){
+		return;
+	}
+
+	if(sequencerSongPtr->playMode == SEQUENCER_PLAY_LOOP){
+		sequencer_restart();
+
+		/*first events are played at once, so that loop take no time*/
+		if(sequencer_process_tracks()){
+			return;
+		}
+	}
+
+	sequencerSongPtr = NULL;
+}
+
+/*play events of tracks whose last note is over, return number of tracks still playing*/
+uint8_t sequencer_process_tracks (void)
+{
+	const Sequencer_Song_t *SongPtr = sequencerSongPtr;
+	uint8_t numOfPlayingTracks = 0;
+
+	for(uint8_t track = 0; track < SongPtr->numOfTracks; track++){
+		const Sequencer_Track_t *TrackPtr = &SongPtr->TrackPtr[track];
+		Sequencer_Track_State_t *StatePtr = &sequencerTrack[track];
+
+		if(StatePtr->ticksLeft){
+			StatePtr->ticksLeft--;
+		}
+
+		while(!StatePtr->ticksLeft && !StatePtr->ended){
+			const Sequencer_Event_t *EventPtr = &TrackPtr->EventPtr[StatePtr->eventIndex++];
+			uint16_t volume = TrackPtr->volume;
+			uint32_t duration;
+
+			switch(EventPtr->effect){
+				case SEQUENCER_EFFECT_END:
+					StatePtr->ended = TRUE;
+					continue;
+
+				case SEQUENCER_EFFECT_TEMPO:
+					sequencer_set_tempo(EventPtr->frequency);
+					continue;
+
+				case SEQUENCER_EFFECT_ACCENT:
+					volume = SPEAKER_VOLUME_FULL;
+					break;
+
+				default:
+					break;
+			}
+
+			StatePtr->ticksLeft = EventPtr->duration;
+
+			/*note is released at end of its duration (in milliseconds at current tempo), release of instrument overlap next note*/
+			duration = (uint32_t)EventPtr->duration * 60000 / ((uint32_t)sequencerTempo * SEQUENCER_TICKS_PER_BEAT);
+
+			if(EventPtr->effect == SEQUENCER_EFFECT_STACCATO){
+				duration /= 2;
+			}
+
+			if(duration && (EventPtr->frequency != Rest)){
+				speaker_play_note(TrackPtr->InstrumentPtr,EventPtr->frequency,duration,volume,SongPtr->priority);
+			}
+		}
+
+		if(!StatePtr->ended){
+			numOfPlayingTracks++;
+		}
+	}
+
+	return numOfPlayingTracks;
+}
+
+/*every track restart from its first event at tempo of song*/
+void sequencer_restart (void)
+{
+	for(uint8_t track = 0; track < SEQUENCER_MAX_TRACKS; track++){
+		sequencerTrack[track].eventIndex = 0;
+		sequencerTrack[track].ticksLeft = 0;
+		sequencerTrack[track].ended = FALSE;
+	}
+
+	sequencerTempo = sequencerSongPtr->tempo;
+}
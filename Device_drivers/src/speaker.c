@@ -4,7 +4,8 @@
 *
 *This implementation file provide functions for interfacing with speaker.
 *Speaker is driven with STM32F4 Discovery board 's on-board DAC (user can select channel 1 or channel 2).
-*Timer 7 is used for creating time interval between sound samples.
+*Timer 7 is used for creating time interval between sound samples, its update event trigger DAC conversion fed by DMA
+*(or timer interrupt write samples to DAC when SPEAKER_USE_DMA is not defined).
 *
 *@author Tran Thanh Nhan
 *@date 21/08/2019
@@ -14,9 +15,65 @@
 #include "../inc/speaker.h"
 #include "../inc/led.h"
 
+typedef struct{
+	const void *soundPtr;	/*array of samples, ADPCM sound or instrument, NULL when voice is free, written last when voice is started*/
+	const void *dataPtr;	/*samples, ADPCM codes or synthesizer voice when note is started*/
+	uint32_t size;
+	uint32_t position;
+	uint16_t volume;
+	uint8_t priority;
+	uint8_t playMode;
+	uint8_t format;
+	ADPCM_State_t ADPCMState;	/*decoder state after sample before position (after nextSample when sound is resampled)*/
+	uint32_t phaseStep;		/*sound samples per output sample, SPEAKER_PHASE_ONE when sound is at sample rate of speaker*/
+	uint32_t phase;			/*position between previousSample and nextSample*/
+	int16_t previousSample;	/*decoded sample at position and the one after it, resampled sound is interpolated between them*/
+	int16_t nextSample;
+	Synth_Voice_t synth;	/*oscillator and envelope of note*/
+}Speaker_Voice_t;
+
+/*
+*@SPEAKER_FORMAT
+*Format of sound played on voice
+*/
+#define SPEAKER_FORMAT_PCM		0	/*12 bits samples*/
+#define SPEAKER_FORMAT_ADPCM	1	/*IMA ADPCM codes of 16 bits samples*/
+#define SPEAKER_FORMAT_SYNTH	2	/*note rendered by synthesizer*/
+
+/*phase of resampled sound is 16.16 fixed point*/
+#define SPEAKER_PHASE_SHIFT		16
+#define SPEAKER_PHASE_ONE		(1UL << SPEAKER_PHASE_SHIFT)
+
+static void speaker_start (void);
+static uint8_t speaker_start_voice (const void *soundPtr, const void *dataPtr, uint32_t size, uint8_t format, uint16_t volume, uint8_t priority, uint8_t playMode);
+#ifndef SPEAKER_USE_DMA
+static void speaker_output_sample (void);
+#endif
+static void speaker_refill_block (uint8_t block);
+static void speaker_intrpt_ctr (uint8_t enOrDis);
+static void speaker_stop_output (void);
+static void speaker_mix_voice (volatile Speaker_Voice_t *VoicePtr, int32_t *mixPtr, uint16_t numOfSamples);
+static void speaker_mix_resampled_voice (volatile Speaker_Voice_t *VoicePtr, int32_t *mixPtr, uint16_t numOfSamples);
+static int16_t speaker_decode_next_sample (ADPCM_State_t *StatePtr, const ADPCM_Sound_t *SoundPtr, uint32_t position, uint8_t playMode);
+
 extern DAC_Handle_t DACxHandle;
-const uint16_t *soundPtrGlobal = NULL;
-const uint16_t *soundEnd = NULL;
+
+/*voices are written by application and read by timer interrupt*/
+volatile Speaker_Voice_t speakerVoice[SPEAKER_NUM_OF_VOICES];
+
+/*one block is output while the other one hold next mixed samples (both blocks are circular buffer of DMA)*/
+uint16_t speakerBlock[2][SPEAKER_BLOCK_SIZE];
+volatile uint8_t speakerActiveBlock = 0;
+volatile uint16_t speakerBlockPosition = 0;
+volatile uint8_t speakerSilentBlocks = 0;
+volatile uint8_t speakerBlocksMixed = FALSE;
+volatile uint8_t speakerRunning = FALSE;
+uint32_t speakerSampleRate = 0;
+volatile uint32_t speakerNumOfUnderruns = 0;
+uint8_t speakerIRQNumber = SPEAKER_TIMER_IRQ_NUM;
+
+/*called in interrupt before each block is mixed*/
+uint8_t (*volatile speakerBlockCallback)(uint16_t numOfSamples) = NULL;
 
 void speaker_init (uint8_t DAC_channel, uint16_t timerPrescaler, uint16_t timerReload)
 {
@@ -24,36 +81,501 @@ void speaker_init (uint8_t DAC_channel, uint16_t timerPrescaler, uint16_t timerR
 	DAC_init_channel(DAC_channel);
 
 	TIM_init_direct(SPEAKER_TIMER,timerPrescaler,timerReload);
-	
+
+	speakerSampleRate = (uint32_t)RCC_get_TIMCLK_value(SPEAKER_TIMER_APB) / (((uint32_t)timerPrescaler + 1) * ((uint32_t)timerReload + 1));
+	speakerNumOfUnderruns = 0;
+
+#ifdef SPEAKER_USE_DMA
+	/*DAC convert on timer update event and request next sample from DMA*/
+	DACxHandle.DACxConfigPtr->triggerEV = SPEAKER_DAC_TRIGGER_EV;
+	DAC_init(&DACxHandle);
+	DAC_DMA_init(&DACxHandle);
+
+	TIM_update_event_TRGO(SPEAKER_TIMER);
+
+	speakerIRQNumber = (DAC_channel == DAC_CHANNEL_1) ? DAC1_DMA_IRQ : DAC2_DMA_IRQ;
+	DMA_intrpt_vector_ctr(speakerIRQNumber,ENABLE);
+#else
 	/*enable timer update event interrupt and enable interrupt request of timer in NVIC*/
 	TIM_interrupt_ctr(SPEAKER_TIMER,ENABLE);
 
 	TIM_intrpt_vector_ctr(SPEAKER_TIMER_IRQ_NUM,ENABLE);
+#endif
 
 }
 
 void speaker_play_sound (const uint16_t *soundPtr, uint16_t size)
 {
-	soundPtrGlobal = soundPtr;
-	soundEnd = soundPtrGlobal + size - 1;
-	TIM_ctr(SPEAKER_TIMER,START);
+	speaker_play_voice(soundPtr,size,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_ONCE);
 }
 
 void speaker_stop_sound (void)
 {
-	soundPtrGlobal = NULL;
-	soundEnd = NULL;
+	speaker_stop_output();
+
+	for(uint8_t voice = 0; voice < SPEAKER_NUM_OF_VOICES; voice++){
+		speakerVoice[voice].soundPtr = NULL;
+	}
+}
+
+uint8_t speaker_play_voice (const uint16_t *soundPtr, uint16_t size, uint16_t volume, uint8_t priority, uint8_t playMode)
+{
+	return speaker_start_voice(soundPtr,soundPtr,size,SPEAKER_FORMAT_PCM,volume,priority,playMode);
+}
+
+uint8_t speaker_play_ADPCM_voice (const ADPCM_Sound_t *soundPtr, uint16_t volume, uint8_t priority, uint8_t playMode)
+{
+	if(soundPtr == NULL){
+		return SPEAKER_NO_VOICE;
+	}
+
+	return speaker_start_voice(soundPtr,soundPtr->dataPtr,soundPtr->numOfSamples,SPEAKER_FORMAT_ADPCM,volume,priority,playMode);
+}
+
+uint8_t speaker_play_note (const Synth_Instrument_t *InstrumentPtr, uint32_t frequency, uint32_t duration, uint16_t volume, uint8_t priority)
+{
+	Synth_Voice_t note = {0};
+	uint32_t size = UINT32_MAX;
+
+	if((InstrumentPtr == NULL) || (frequency == 0) || (speakerSampleRate == 0)){
+		return SPEAKER_NO_VOICE;
+	}
+
+	synth_note_on(&note,InstrumentPtr,frequency,duration,speakerSampleRate);
+
+	/*note length (up to end of release) is only used to steal voice closest to its end, held note is the longest*/
+	if(duration){
+		size = note.gate + note.releaseSamples;
+	}
+
+	return speaker_start_voice(InstrumentPtr,&note,size,SPEAKER_FORMAT_SYNTH,volume,priority,SPEAKER_PLAY_ONCE);
+}
+
+void speaker_release_note (uint8_t voice)
+{
+	/*interrupt release note at next mixed block*/
+	if((voice < SPEAKER_NUM_OF_VOICES) && (speakerVoice[voice].format == SPEAKER_FORMAT_SYNTH)){
+		speakerVoice[voice].synth.gate = 0;
+	}
+}
+
+void speaker_stop_voice (uint8_t voice)
+{
+	if(voice < SPEAKER_NUM_OF_VOICES){
+		speakerVoice[voice].soundPtr = NULL;
+	}
+}
+
+uint8_t speaker_find_voice (const void *soundPtr)
+{
+	for(uint8_t voice = 0; voice < SPEAKER_NUM_OF_VOICES; voice++){
+		if(speakerVoice[voice].soundPtr == soundPtr){
+			return voice;
+		}
+	}
+
+	return SPEAKER_NO_VOICE;
+}
+
+uint32_t speaker_get_sample_rate (void)
+{
+	return speakerSampleRate;
+}
+
+uint32_t speaker_get_num_of_underruns (void)
+{
+	return speakerNumOfUnderruns;
+}
+
+void speaker_set_block_callback (uint8_t (*callback)(uint16_t numOfSamples))
+{
+	speakerBlockCallback = callback;
+
+	if((callback != NULL) && (speakerRunning == FALSE)){
+		speaker_start();
+	}
+}
+
+uint8_t speaker_mix_block (uint16_t *bufferPtr, uint16_t numOfSamples)
+{
+	int32_t mix[SPEAKER_BLOCK_SIZE];
+	uint8_t numOfActiveVoices = 0;
+
+	for(uint8_t voice = 0; voice < SPEAKER_NUM_OF_VOICES; voice++){
+		if(speakerVoice[voice].soundPtr != NULL){
+			numOfActiveVoices++;
+		}
+	}
+
+	while(numOfSamples){
+		uint16_t count = (numOfSamples > SPEAKER_BLOCK_SIZE) ? SPEAKER_BLOCK_SIZE : numOfSamples;
+
+		for(uint16_t i = 0; i < count; i++){
+			mix[i] = 0;
+		}
+
+		for(uint8_t voice = 0; voice < SPEAKER_NUM_OF_VOICES; voice++){
+			speaker_mix_voice(&speakerVoice[voice],mix,count);
+		}
+
+		/*sum of voices is saturated into DAC range instead of wrapping around*/
+		for(uint16_t i = 0; i < count; i++){
+			int32_t sample = SPEAKER_SAMPLE_MIDPOINT + (mix[i] / SPEAKER_VOLUME_FULL);
+
+			if(sample < 0){
+				sample = 0;
+			}else if(sample > SPEAKER_SAMPLE_MAX){
+				sample = SPEAKER_SAMPLE_MAX;
+			}
+
+			bufferPtr[i] = (uint16_t)sample;
+		}
+
+		bufferPtr += count;
+		numOfSamples -= count;
+	}
+
+	return numOfActiveVoices;
+}
+
+/*select voice for new sound and start it*/
+uint8_t speaker_start_voice (const void *soundPtr, const void *dataPtr, uint32_t size, uint8_t format, uint16_t volume, uint8_t priority, uint8_t playMode)
+{
+	uint8_t selectedVoice = SPEAKER_NO_VOICE;
+
+	if((soundPtr == NULL) || (size == 0)){
+		return SPEAKER_NO_VOICE;
+	}
+
+	/*block callback start voices in interrupt too (refer to speaker_set_block_callback), interrupt is masked so that it can not take voice being selected*/
+	speaker_intrpt_ctr(DISABLE);
+
+	/*free voice first, otherwise voice of lowest priority not higher than new sound (closest to its end among same priority)*/
+	for(uint8_t voice = 0; voice < SPEAKER_NUM_OF_VOICES; voice++){
+		volatile Speaker_Voice_t *VoicePtr = &speakerVoice[voice];
+
+		if(VoicePtr->soundPtr == NULL){
+			selectedVoice = voice;
+			break;
+		}
+
+		if(VoicePtr->priority > priority){
+			continue;
+		}
+
+		if((selectedVoice == SPEAKER_NO_VOICE) || (VoicePtr->priority < speakerVoice[selectedVoice].priority)
+			|| ((VoicePtr->priority == speakerVoice[selectedVoice].priority)
+			&& (VoicePtr->size - VoicePtr->position < speakerVoice[selectedVoice].size - speakerVoice[selectedVoice].position))){
+			selectedVoice = voice;
+		}
+	}
+
+	if(selectedVoice == SPEAKER_NO_VOICE){
+		speaker_intrpt_ctr(ENABLE);
+		return SPEAKER_NO_VOICE;
+	}
+
+	/*interrupt skip voice while it is set up*/
+	volatile Speaker_Voice_t *VoicePtr = &speakerVoice[selectedVoice];
+
+	VoicePtr->soundPtr = NULL;
+	VoicePtr->dataPtr = dataPtr;
+	VoicePtr->size = size;
+	VoicePtr->volume = volume;
+	VoicePtr->priority = priority;
+	VoicePtr->playMode = playMode;
+	VoicePtr->format = format;
+	VoicePtr->position = 0;
+	if(format == SPEAKER_FORMAT_ADPCM){
+		const ADPCM_Sound_t *SoundPtr = soundPtr;
+		ADPCM_State_t state = SoundPtr->initialState;
+
+		/*sound at sample rate of speaker (or before speaker_init) is decoded in blocks, other sounds are interpolated between 2 decoded samples*/
+		VoicePtr->phaseStep = SPEAKER_PHASE_ONE;
+		if(SoundPtr->sampleRate && speakerSampleRate && (SoundPtr->sampleRate != speakerSampleRate)){
+			VoicePtr->phaseStep = (uint32_t)(((uint64_t)SoundPtr->sampleRate << SPEAKER_PHASE_SHIFT) / speakerSampleRate);
+			VoicePtr->previousSample = adpcm_decode_sample(&state,SoundPtr->dataPtr[0] & 0x0F);
+			VoicePtr->nextSample = speaker_decode_next_sample(&state,SoundPtr,0,playMode);
+		}
+		VoicePtr->phase = 0;
+		VoicePtr->ADPCMState = state;
+	}else if(format == SPEAKER_FORMAT_SYNTH){
+		VoicePtr->synth = *(const Synth_Voice_t*)dataPtr;
+	}
+	VoicePtr->soundPtr = soundPtr;
+
+	speaker_intrpt_ctr(ENABLE);
+
+	/*interrupt only stop output after mixing a block without voice, so voice started above is never missed*/
+	if(speakerRunning == FALSE){
+		speaker_start();
+	}
+
+	return selectedVoice;
+}
+
+#ifdef SPEAKER_USE_DMA
+/*start DMA on silent blocks and start timer, first block is mixed by half transfer interrupt (sound start 2 blocks later)*/
+void speaker_start (void)
+{
+	for(uint16_t i = 0; i < SPEAKER_BLOCK_SIZE; i++){
+		speakerBlock[0][i] = SPEAKER_SAMPLE_MIDPOINT;
+		speakerBlock[1][i] = SPEAKER_SAMPLE_MIDPOINT;
+	}
+
+	speakerSilentBlocks = 0;
+	speakerRunning = TRUE;
+
+	DAC_start_DMA(&DACxHandle,speakerBlock,2*SPEAKER_BLOCK_SIZE);
+	TIM_ctr(SPEAKER_TIMER,START);
+}
+#else
+/*start timer, both blocks are mixed by first timer interrupt*/
+void speaker_start (void)
+{
+	speakerBlocksMixed = FALSE;
+	speakerActiveBlock = 0;
+	speakerBlockPosition = 0;
+	speakerSilentBlocks = 0;
+	speakerRunning = TRUE;
+
+	TIM_ctr(SPEAKER_TIMER,START);
+}
+#endif
+
+#ifndef SPEAKER_USE_DMA
+/*output one sample, drained block is refilled as soon as output move to other block (called in timer interrupt)*/
+void speaker_output_sample (void)
+{
+	if(speakerBlocksMixed == FALSE){
+		speaker_refill_block(0);
+		speaker_refill_block(1);
+		speakerBlocksMixed = TRUE;
+	}
+
+	DAC_write(&DACxHandle,speakerBlock[speakerActiveBlock][speakerBlockPosition++]);
+
+	if(speakerBlockPosition < SPEAKER_BLOCK_SIZE){
+		return;
+	}
+
+	uint8_t drainedBlock = speakerActiveBlock;
+
+	speakerActiveBlock ^= 1;
+	speakerBlockPosition = 0;
+
+	speaker_refill_block(drainedBlock);
+}
+#endif
+
+/*mix drained block, output is stopped when both blocks hold silence and block callback does not need it any more*/
+void speaker_refill_block (uint8_t block)
+{
+	uint8_t keepRunning = FALSE;
+
+	/*voices started by callback are mixed in this block*/
+	if(speakerBlockCallback != NULL){
+		keepRunning = speakerBlockCallback(SPEAKER_BLOCK_SIZE);
+	}
+
+	if(speaker_mix_block(speakerBlock[block],SPEAKER_BLOCK_SIZE) || keepRunning){
+		speakerSilentBlocks = 0;
+	}else if(++speakerSilentBlocks >= 2){
+		/*last block holding sound is played and both blocks hold silence, nothing left to play*/
+		speaker_stop_output();
+	}
+}
+
+/*stop timer (and DMA), DAC keep last sample which is silence*/
+void speaker_stop_output (void)
+{
 	TIM_ctr(SPEAKER_TIMER,STOP);
+#ifdef SPEAKER_USE_DMA
+	DAC_stop_DMA(&DACxHandle);
+#endif
+	speakerRunning = FALSE;
+}
+
+/*mask or unmask interrupt refilling blocks*/
+void speaker_intrpt_ctr (uint8_t enOrDis)
+{
+#ifdef SPEAKER_USE_DMA
+	DMA_intrpt_vector_ctr(speakerIRQNumber,enOrDis);
+#else
+	TIM_intrpt_vector_ctr(speakerIRQNumber,enOrDis);
+#endif
+}
+
+/*add scaled samples of voice to mix, voice played once is freed at its end*/
+void speaker_mix_voice (volatile Speaker_Voice_t *VoicePtr, int32_t *mixPtr, uint16_t numOfSamples)
+{
+	const void *soundPtr = VoicePtr->soundPtr;
+
+	if(soundPtr == NULL){
+		return;
+	}
+
+	uint32_t position = VoicePtr->position;
+	uint32_t size = VoicePtr->size;
+	int32_t volume = VoicePtr->volume;
+
+	if(VoicePtr->format == SPEAKER_FORMAT_PCM){
+		const uint16_t *samplePtr = VoicePtr->dataPtr;
+
+		for(uint16_t i = 0; i < numOfSamples; i++){
+			mixPtr[i] += ((int32_t)samplePtr[position] - SPEAKER_SAMPLE_MIDPOINT) * volume;
+
+			if(++position == size){
+				if(VoicePtr->playMode != SPEAKER_PLAY_LOOP){
+					VoicePtr->soundPtr = NULL;
+					return;
+				}
+				position = 0;
+			}
+		}
+
+		VoicePtr->position = position;
+		return;
+	}
+
+	int16_t decoded[SPEAKER_BLOCK_SIZE];
+
+	if(VoicePtr->format == SPEAKER_FORMAT_SYNTH){
+		/*note is rendered as it is mixed, voice is freed when its envelope end*/
+		Synth_Voice_t note = VoicePtr->synth;
+		uint16_t count = synth_render(&note,decoded,numOfSamples);
+
+		for(uint16_t i = 0; i < count; i++){
+			mixPtr[i] += (decoded[i] >> SPEAKER_16_BITS_SCALE_SHIFT) * volume;
+		}
+
+		if(count < numOfSamples){
+			VoicePtr->soundPtr = NULL;
+			return;
+		}
+
+		VoicePtr->synth = note;
+		VoicePtr->position = position + count;
+		return;
+	}
+
+	if(VoicePtr->phaseStep != SPEAKER_PHASE_ONE){
+		speaker_mix_resampled_voice(VoicePtr,mixPtr,numOfSamples);
+		return;
+	}
+
+	/*ADPCM sound is decoded as it is mixed, up to its end or its loop point at a time*/
+	ADPCM_State_t state = VoicePtr->ADPCMState;
+
+	while(numOfSamples){
+		uint16_t count = (size - position < numOfSamples) ? (uint16_t)(size - position) : numOfSamples;
+
+		adpcm_decode_block(&state,VoicePtr->dataPtr,position,decoded,count);
+
+		for(uint16_t i = 0; i < count; i++){
+			mixPtr[i] += (decoded[i] >> SPEAKER_16_BITS_SCALE_SHIFT) * volume;
+		}
+
+		mixPtr += count;
+		position += count;
+		numOfSamples -= count;
+
+		if(position == size){
+			if(VoicePtr->playMode != SPEAKER_PLAY_LOOP){
+				VoicePtr->soundPtr = NULL;
+				return;
+			}
+			state = ((const ADPCM_Sound_t*)soundPtr)->initialState;
+			position = 0;
+		}
+	}
+
+	VoicePtr->ADPCMState = state;
+	VoicePtr->position = position;
 }
 
+/*add ADPCM sound of other sample rate to mix, output sample is linearly interpolated between decoded samples at 16.16 fixed point phase*/
+void speaker_mix_resampled_voice (volatile Speaker_Voice_t *VoicePtr, int32_t *mixPtr, uint16_t numOfSamples)
+{
+	const ADPCM_Sound_t *SoundPtr = VoicePtr->soundPtr;
+	ADPCM_State_t state = VoicePtr->ADPCMState;
+	uint32_t position = VoicePtr->position;
+	uint32_t phase = VoicePtr->phase;
+	uint32_t phaseStep = VoicePtr->phaseStep;
+	int32_t previousSample = VoicePtr->previousSample;
+	int32_t nextSample = VoicePtr->nextSample;
+	int32_t volume = VoicePtr->volume;
+	uint8_t playMode = VoicePtr->playMode;
+
+	for(uint16_t i = 0; i < numOfSamples; i++){
+		/*phase is reduced to 15 bits so that product of 16 bits difference fit in 32 bits*/
+		int32_t sample = previousSample + (((nextSample - previousSample) * (int32_t)(phase >> 1)) >> (SPEAKER_PHASE_SHIFT - 1));
+
+		mixPtr[i] += (sample >> SPEAKER_16_BITS_SCALE_SHIFT) * volume;
+
+		for(phase += phaseStep; phase >= SPEAKER_PHASE_ONE; phase -= SPEAKER_PHASE_ONE){
+			if(++position == SoundPtr->numOfSamples){
+				if(playMode != SPEAKER_PLAY_LOOP){
+					VoicePtr->soundPtr = NULL;
+					return;
+				}
+				position = 0;
+			}
+
+			previousSample = nextSample;
+			nextSample = speaker_decode_next_sample(&state,SoundPtr,position,playMode);
+		}
+	}
+
+	VoicePtr->ADPCMState = state;
+	VoicePtr->position = position;
+	VoicePtr->phase = phase;
+	VoicePtr->previousSample = (int16_t)previousSample;
+	VoicePtr->nextSample = (int16_t)nextSample;
+}
+
+/*decode sample after position, it is first sample at end of looping sound and silence at end of sound played once*/
+int16_t speaker_decode_next_sample (ADPCM_State_t *StatePtr, const ADPCM_Sound_t *SoundPtr, uint32_t position, uint8_t playMode)
+{
+	uint32_t next = position + 1;
+
+	if(next == SoundPtr->numOfSamples){
+		if(playMode != SPEAKER_PLAY_LOOP){
+			return 0;
+		}
+		*StatePtr = SoundPtr->initialState;
+		next = 0;
+	}
+
+	return adpcm_decode_sample(StatePtr,(SoundPtr->dataPtr[next >> 1] >> ((next & 0x01) << 2)) & 0x0F);
+}
+
+#ifdef SPEAKER_USE_DMA
+	/*first block is output at half transfer and second block at transfer complete*/
+	void SPEAKER_DMA_IRQ_HANDLER (void)
+	{
+		uint8_t event = DAC_DMA_intrpt_handler(&DACxHandle);
+
+		/*both halves drained before interrupt was served, one block was output again before it was refilled*/
+		if((event & DAC_EV_DMA_HALF_TRANSFER) && (event & DAC_EV_DMA_TRANSFER_CMPLT)){
+			speakerNumOfUnderruns++;
+		}
+
+		if(event & DAC_EV_DMA_HALF_TRANSFER){
+			speaker_refill_block(0);
+		}
+
+		if((event & DAC_EV_DMA_TRANSFER_CMPLT) && (speakerRunning == TRUE)){
+			speaker_refill_block(1);
+		}
+	}
+#else
+
 #ifdef SPEAKER_USE_TIMER7
 	void TIM7_IRQHandler (void)
 	{
 		TIM_intrpt_handler(TIM7);
-		DAC_write(&DACxHandle,*(soundPtrGlobal++));
-		if(soundPtrGlobal == soundEnd){
-			speaker_stop_sound();
-		}
+		speaker_output_sample();
 	}
 #endif
 
@@ -61,10 +583,7 @@ void speaker_stop_sound (void)
 	void TIM6_DAC_IRQHandler (void)
 	{
 		TIM_intrpt_handler(TIM6);
-		DAC_write(&DACxHandle,*(soundPtrGlobal++));
-		if(soundPtrGlobal == soundEnd){
-			speaker_stop_sound();
-		}
+		speaker_output_sample();
 	}
 #endif
 
@@ -72,10 +591,7 @@ void speaker_stop_sound (void)
 	void TIM3_IRQHandler (void)
 	{
 		TIM_intrpt_handler(TIM3);
-		DAC_write(&DACxHandle,*(soundPtrGlobal++));
-		if(soundPtrGlobal == soundEnd){
-			speaker_stop_sound();
-		}
+		speaker_output_sample();
 	}
 #endif
 
@@ -83,9 +599,8 @@ void speaker_stop_sound (void)
 	void TIM4_IRQHandler (void)
 	{
 		TIM_intrpt_handler(TIM4);
-		DAC_write(&DACxHandle,*(soundPtrGlobal++));
-		if(soundPtrGlobal == soundEnd){
-			speaker_stop_sound();
-		}
+		speaker_output_sample();
 	}
 #endif
+
+#endif
@@ -0,0 +1,223 @@
+/**
+*@file dirty_rect.c
+*@brief Provide dirty rectangle list for partial screen update.
+*
+*This implementation file provide functions for collecting screen areas which need to be redrawn.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "dirty_rect.h"
+
+static int16_t dirty_rect_wrap(int32_t value, uint16_t size);
+static uint8_t dirty_rect_span_overlap(int16_t a, uint16_t aLength, int16_t b, uint16_t bLength, uint16_t size);
+static void dirty_rect_merge(dirty_rect *dest, const dirty_rect *src, const dirty_rect_list *list);
+
+/***********************************************************************
+Initialize empty list for screen with given size
+***********************************************************************/
+void dirty_rect_list_init(dirty_rect_list *list, uint16_t screenWidth, uint16_t screenHeight)
+{
+	list->total = 0;
+	list->screenWidth = screenWidth;
+	list->screenHeight = screenHeight;
+}
+
+/***********************************************************************
+Remove all rects from list
+***********************************************************************/
+void dirty_rect_list_clear(dirty_rect_list *list)
+{
+	list->total = 0;
+}
+
+/***********************************************************************
+Add rect to list, merging it with every rect it overlaps
+***********************************************************************/
+void dirty_rect_add(dirty_rect_list *list, int16_t x, int16_t y, uint16_t width, uint16_t height)
+{
+	dirty_rect newRect;
+
+	if(!width || !height){
+		return;
+	}
+
+	newRect.x = dirty_rect_wrap(x,list->screenWidth);
+	newRect.y = dirty_rect_wrap(y,list->screenHeight);
+	newRect.width = width;
+	newRect.height = height;
+
+	/*bounding box of a merge may overlap rects checked before, so restart scanning after every merge*/
+	for(int i = 0; i < list->total;){
+		dirty_rect *rectPtr = &list->rects[i];
+
+		if(newRect.x < rectPtr->x + rectPtr->width && rectPtr->x < newRect.x + newRect.width
+			&& newRect.y < rectPtr->y + rectPtr->height && rectPtr->y < newRect.y + newRect.height){
+
+			dirty_rect_merge(&newRect,rectPtr,list);
+			list->total--;
+			list->rects[i] = list->rects[list->total];
+			i = 0;
+		}else{
+			i++;
+		}
+	}
+
+	/*list is full, grow last rect instead (more pixels are redrawn but nothing is lost)*/
+	if(list->total == DIRTY_RECT_LIST_CAPACITY){
+		dirty_rect_merge(&list->rects[list->total - 1],&newRect,list);
+		return;
+	}
+
+	list->rects[list->total] = newRect;
+	list->total++;
+}
+
+/***********************************************************************
+Add area covered by previous rect but not by current rect (strip left behind by moving object)
+***********************************************************************/
+void dirty_rect_add_vacated(dirty_rect_list *list, const dirty_rect *previous, const dirty_rect *current)
+{
+	int32_t curX = current->x;
+	int32_t curY = current->y;
+
+	/*object may have wrapped to the opposite side, bring current position next to previous one*/
+	if(curX - previous->x > list->screenWidth/2){
+		curX -= list->screenWidth;
+	}else if(previous->x - curX > list->screenWidth/2){
+		curX += list->screenWidth;
+	}
+
+	if(curY - previous->y > list->screenHeight/2){
+		curY -= list->screenHeight;
+	}else if(previous->y - curY > list->screenHeight/2){
+		curY += list->screenHeight;
+	}
+
+	int32_t prevLeft = previous->x;
+	int32_t prevTop = previous->y;
+	int32_t prevRight = previous->x + previous->width;
+	int32_t prevBottom = previous->y + previous->height;
+	int32_t curRight = curX + current->width;
+	int32_t curBottom = curY + current->height;
+
+	/*no overlap, whole previous rect is vacated*/
+	if(curX >= prevRight || curRight <= prevLeft || curY >= prevBottom || curBottom <= prevTop){
+		dirty_rect_add(list,previous->x,previous->y,previous->width,previous->height);
+		return;
+	}
+
+	/*top and bottom strips take full width of previous rect*/
+	if(curY > prevTop){
+		dirty_rect_add(list,prevLeft,prevTop,previous->width,curY - prevTop);
+		prevTop = curY;
+	}
+
+	if(curBottom < prevBottom){
+		dirty_rect_add(list,prevLeft,curBottom,previous->width,prevBottom - curBottom);
+		prevBottom = curBottom;
+	}
+
+	/*left and right strips only cover rows shared by both rects*/
+	if(curX > prevLeft){
+		dirty_rect_add(list,prevLeft,prevTop,curX - prevLeft,prevBottom - prevTop);
+	}
+
+	if(curRight < prevRight){
+		dirty_rect_add(list,curRight,prevTop,prevRight - curRight,prevBottom - prevTop);
+	}
+}
+
+/***********************************************************************
+Check whether 2 rects overlap (wrap around screen edges is considered)
+***********************************************************************/
+uint8_t dirty_rect_overlap(const dirty_rect_list *list, const dirty_rect *rect1, const dirty_rect *rect2)
+{
+	if(dirty_rect_span_overlap(rect1->x,rect1->width,rect2->x,rect2->width,list->screenWidth)
+		&& dirty_rect_span_overlap(rect1->y,rect1->height,rect2->y,rect2->height,list->screenHeight)){
+		return DIRTY_RECT_OVERLAP_TRUE;
+	}
+
+	return DIRTY_RECT_OVERLAP_FALSE;
+}
+
+/***********************************************************************
+Check whether rect overlap any rect in list
+***********************************************************************/
+uint8_t dirty_rect_list_overlap(const dirty_rect_list *list, const dirty_rect *rect)
+{
+	for(int i = 0; i < list->total; i++){
+		if(dirty_rect_overlap(list,&list->rects[i],rect) == DIRTY_RECT_OVERLAP_TRUE){
+			return DIRTY_RECT_OVERLAP_TRUE;
+		}
+	}
+
+	return DIRTY_RECT_OVERLAP_FALSE;
+}
+
+/***********************************************************************
+Get number of pixels in rect
+***********************************************************************/
+uint32_t dirty_rect_area(const dirty_rect *rect)
+{
+	return (uint32_t)rect->width * rect->height;
+}
+
+/***********************************************************************
+Private function: Wrap coordinate into 0 to (size - 1)
+***********************************************************************/
+int16_t dirty_rect_wrap(int32_t value, uint16_t size)
+{
+	value %= size;
+
+	if(value < 0){
+		value += size;
+	}
+
+	return (int16_t)value;
+}
+
+/***********************************************************************
+Private function: Check whether 2 spans on a wrapping axis overlap
+***********************************************************************/
+uint8_t dirty_rect_span_overlap(int16_t a, uint16_t aLength, int16_t b, uint16_t bLength, uint16_t size)
+{
+	if(aLength >= size || bLength >= size){
+		return DIRTY_RECT_OVERLAP_TRUE;
+	}
+
+	/*distance from start of span a to start of span b going in positive direction*/
+	int16_t distance = dirty_rect_wrap((int32_t)b - a,size);
+
+	if(distance < aLength || distance > size - bLength){
+		return DIRTY_RECT_OVERLAP_TRUE;
+	}
+
+	return DIRTY_RECT_OVERLAP_FALSE;
+}
+
+/***********************************************************************
+Private function: Grow destination rect to bounding box of both rects
+***********************************************************************/
+void dirty_rect_merge(dirty_rect *dest, const dirty_rect *src, const dirty_rect_list *list)
+{
+	int32_t left = (dest->x < src->x) ? dest->x : src->x;
+	int32_t top = (dest->y < src->y) ? dest->y : src->y;
+	int32_t right = (dest->x + dest->width > src->x + src->width) ? dest->x + dest->width : src->x + src->width;
+	int32_t bottom = (dest->y + dest->height > src->y + src->height) ? dest->y + dest->height : src->y + src->height;
+
+	dest->x = left;
+	dest->y = top;
+	dest->width = right - left;
+	dest->height = bottom - top;
+
+	/*never cover more than whole screen*/
+	if(dest->width > list->screenWidth){
+		dest->width = list->screenWidth;
+	}
+
+	if(dest->height > list->screenHeight){
+		dest->height = list->screenHeight;
+	}
+}
@@ -0,0 +1,44 @@
+/**
+*@file dirty_rect.h
+*@brief Provide dirty rectangle list for partial screen update.
+*
+*This header file provide functions for collecting screen areas which need to be redrawn. Overlapping areas are merged into their bounding box.
+*Coordinates wrap around screen edges (object going off screen appear on the opposite side).
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef DIRTY_RECT_H
+#define DIRTY_RECT_H
+
+#include <stdint.h>
+
+#define DIRTY_RECT_LIST_CAPACITY	32
+
+#define DIRTY_RECT_OVERLAP_TRUE		1
+#define DIRTY_RECT_OVERLAP_FALSE	0
+
+typedef struct dirty_rect {
+	int16_t x;
+	int16_t y;
+	uint16_t width;
+	uint16_t height;
+} dirty_rect;
+
+typedef struct dirty_rect_list {
+	dirty_rect rects[DIRTY_RECT_LIST_CAPACITY];
+	int total;
+	uint16_t screenWidth;
+	uint16_t screenHeight;
+} dirty_rect_list;
+
+void dirty_rect_list_init(dirty_rect_list *, uint16_t screenWidth, uint16_t screenHeight);
+void dirty_rect_list_clear(dirty_rect_list *);
+void dirty_rect_add(dirty_rect_list *, int16_t x, int16_t y, uint16_t width, uint16_t height);
+void dirty_rect_add_vacated(dirty_rect_list *, const dirty_rect *previous, const dirty_rect *current);
+uint8_t dirty_rect_overlap(const dirty_rect_list *, const dirty_rect *, const dirty_rect *);
+uint8_t dirty_rect_list_overlap(const dirty_rect_list *, const dirty_rect *);
+uint32_t dirty_rect_area(const dirty_rect *);
+
+#endif
@@ -0,0 +1,269 @@
+/**
+*@file entity_store.c
+*@brief Provide structure of arrays storage for moving rectangular objects.
+*
+*This implementation file provide functions for adding, removing, moving objects and finding objects overlapping a given area.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include <string.h>
+
+#include "entity_store.h"
+
+static int16_t entity_store_wrap(int32_t value, uint16_t size);
+static uint8_t entity_store_span_overlap(int16_t a, int16_t aLength, int16_t b, uint16_t bLength, uint16_t size);
+
+/***********************************************************************
+Initialize empty store for screen with given size
+***********************************************************************/
+void entity_store_init(entity_store *store, uint16_t capacity, uint16_t screenWidth, uint16_t screenHeight)
+{
+	if(capacity > ENTITY_STORE_MAX_ENTITIES){
+		capacity = ENTITY_STORE_MAX_ENTITIES;
+	}
+
+	store->capacity = capacity;
+	store->screenWidth = screenWidth;
+	store->screenHeight = screenHeight;
+
+	entity_store_clear(store);
+}
+
+/***********************************************************************
+Remove all objects from store
+***********************************************************************/
+void entity_store_clear(entity_store *store)
+{
+	memset(store->x,0,sizeof(store->x));
+	memset(store->y,0,sizeof(store->y));
+	memset(store->dx,0,sizeof(store->dx));
+	memset(store->dy,0,sizeof(store->dy));
+	memset(store->width,0,sizeof(store->width));
+	memset(store->height,0,sizeof(store->height));
+	memset(store->kind,0,sizeof(store->kind));
+	memset(store->alive,0,sizeof(store->alive));
+
+	/*free list hold every index in increasing order*/
+	for(uint16_t index = 0; index < store->capacity; index++){
+		store->nextFree[index] = (index + 1 < store->capacity) ? index + 1 : ENTITY_STORE_NONE;
+	}
+
+	store->freeHead = store->capacity ? 0 : ENTITY_STORE_NONE;
+	store->total = 0;
+}
+
+/***********************************************************************
+Add object at first index of free list (whole pixel position, Q16.16 velocity), return its index or ENTITY_STORE_NONE if store is full
+***********************************************************************/
+uint16_t entity_store_add(entity_store *store, uint8_t kind, int16_t x, int16_t y, int32_t dx, int32_t dy, uint16_t width, uint16_t height)
+{
+	uint16_t index = store->freeHead;
+
+	if(index == ENTITY_STORE_NONE){
+		return ENTITY_STORE_NONE;
+	}
+
+	store->freeHead = store->nextFree[index];
+
+	store->x[index] = (int32_t)entity_store_wrap(x,store->screenWidth) * ENTITY_STORE_ONE;
+	store->y[index] = (int32_t)entity_store_wrap(y,store->screenHeight) * ENTITY_STORE_ONE;
+	store->width[index] = width;
+	store->height[index] = height;
+	store->kind[index] = kind;
+	entity_store_set_velocity(store,index,dx,dy);
+
+	store->alive[index / 32] |= 1UL << (index % 32);
+	store->live[store->total] = index;
+	store->livePosition[index] = store->total;
+	store->total++;
+
+	return index;
+}
+
+/***********************************************************************
+Remove object (other objects keep their index, last object of live array take its position), its index become first of free list
+***********************************************************************/
+void entity_store_remove(entity_store *store, uint16_t index)
+{
+	uint16_t lastIndex = 0;
+
+	if(!entity_store_is_alive(store,index)){
+		return;
+	}
+
+	store->total--;
+	lastIndex = store->live[store->total];
+	store->live[store->livePosition[index]] = lastIndex;
+	store->livePosition[lastIndex] = store->livePosition[index];
+
+	store->nextFree[index] = store->freeHead;
+	store->freeHead = index;
+
+	store->alive[index / 32] &= ~(1UL << (index % 32));
+	entity_store_set_velocity(store,index,0,0);
+}
+
+/***********************************************************************
+Set Q16.16 velocity of object
+***********************************************************************/
+void entity_store_set_velocity(entity_store *store, uint16_t index, int32_t dx, int32_t dy)
+{
+	store->dx[index] = dx;
+	store->dy[index] = dy;
+}
+
+/***********************************************************************
+Get Q16.16 velocity of object along x axis
+***********************************************************************/
+int32_t entity_store_get_dx(const entity_store *store, uint16_t index)
+{
+	return store->dx[index];
+}
+
+/***********************************************************************
+Get Q16.16 velocity of object along y axis
+***********************************************************************/
+int32_t entity_store_get_dy(const entity_store *store, uint16_t index)
+{
+	return store->dy[index];
+}
+
+/***********************************************************************
+Get whole pixel x coordinate of object
+***********************************************************************/
+int16_t entity_store_get_x(const entity_store *store, uint16_t index)
+{
+	return (int16_t)(store->x[index] >> ENTITY_STORE_FRACTION_BITS);
+}
+
+/***********************************************************************
+Get whole pixel y coordinate of object
+***********************************************************************/
+int16_t entity_store_get_y(const entity_store *store, uint16_t index)
+{
+	return (int16_t)(store->y[index] >> ENTITY_STORE_FRACTION_BITS);
+}
+
+/***********************************************************************
+Check whether object at given index is live
+***********************************************************************/
+uint8_t entity_store_is_alive(const entity_store *store, uint16_t index)
+{
+	if(index >= store->capacity){
+		return 0;
+	}
+
+	return (store->alive[index / 32] >> (index % 32)) & 1;
+}
+
+/***********************************************************************
+Move every live object by its velocity (velocity must be smaller than screen)
+***********************************************************************/
+void entity_store_integrate(entity_store *store)
+{
+	int32_t width = (int32_t)store->screenWidth * ENTITY_STORE_ONE;
+	int32_t height = (int32_t)store->screenHeight * ENTITY_STORE_ONE;
+
+	for(uint16_t i = 0; i < store->capacity; i++){
+		if(!(store->alive[i / 32] & (1UL << (i % 32)))){
+			continue;
+		}
+
+		int32_t x = store->x[i] + store->dx[i];
+		int32_t y = store->y[i] + store->dy[i];
+
+		if(x < 0){
+			x += width;
+		}else if(x >= width){
+			x -= width;
+		}
+
+		if(y < 0){
+			y += height;
+		}else if(y >= height){
+			y -= height;
+		}
+
+		store->x[i] = x;
+		store->y[i] = y;
+	}
+}
+
+/***********************************************************************
+Find live objects overlapping given area, bit i of mask is set when object i overlap (mask must hold ENTITY_STORE_MASK_WORDS words)
+Return number of objects found
+***********************************************************************/
+uint16_t entity_store_overlap_mask(const entity_store *store, int16_t x, int16_t y, uint16_t width, uint16_t height, uint32_t *maskPtr)
+{
+	uint16_t numOfObjects = 0;
+
+	x = entity_store_wrap(x,store->screenWidth);
+	y = entity_store_wrap(y,store->screenHeight);
+
+	memset(maskPtr,0,ENTITY_STORE_MASK_WORDS * sizeof(uint32_t));
+
+	for(uint16_t i = 0; i < store->capacity; i++){
+		if(!(store->alive[i / 32] & (1UL << (i % 32)))){
+			continue;
+		}
+
+		if(entity_store_span_overlap(entity_store_get_x(store,i),store->width[i],x,width,store->screenWidth)
+			&& entity_store_span_overlap(entity_store_get_y(store,i),store->height[i],y,height,store->screenHeight)){
+			maskPtr[i / 32] |= 1UL << (i % 32);
+			numOfObjects++;
+		}
+	}
+
+	return numOfObjects;
+}
+
+/***********************************************************************
+Check whether object at given index overlap given area (wrap around screen edges is considered)
+***********************************************************************/
+uint8_t entity_store_overlap(const entity_store *store, uint16_t index, int16_t x, int16_t y, uint16_t width, uint16_t height)
+{
+	x = entity_store_wrap(x,store->screenWidth);
+	y = entity_store_wrap(y,store->screenHeight);
+
+	if(entity_store_span_overlap(entity_store_get_x(store,index),store->width[index],x,width,store->screenWidth)
+		&& entity_store_span_overlap(entity_store_get_y(store,index),store->height[index],y,height,store->screenHeight)){
+		return ENTITY_STORE_OVERLAP_TRUE;
+	}
+
+	return ENTITY_STORE_OVERLAP_FALSE;
+}
+
+/***********************************************************************
+Private function: Wrap coordinate into 0 to (size - 1)
+***********************************************************************/
+int16_t entity_store_wrap(int32_t value, uint16_t size)
+{
+	value %= size;
+
+	if(value < 0){
+		value += size;
+	}
+
+	return (int16_t)value;
+}
+
+/***********************************************************************
+Private function: Check whether span a and span b overlap on a wrapping axis (both start inside screen, span a is shorter than screen)
+***********************************************************************/
+uint8_t entity_store_span_overlap(int16_t a, int16_t aLength, int16_t b, uint16_t bLength, uint16_t size)
+{
+	/*distance from start of span a to start of span b going in positive direction*/
+	int32_t distance = b - a;
+
+	if(distance < 0){
+		distance += size;
+	}
+
+	if(distance < aLength || distance > size - bLength){
+		return ENTITY_STORE_OVERLAP_TRUE;
+	}
+
+	return ENTITY_STORE_OVERLAP_FALSE;
+}
@@ -0,0 +1,78 @@
+/**
+*@file entity_store.h
+*@brief Provide structure of arrays storage for moving rectangular objects.
+*
+*This header file provide functions for keeping position, velocity and size of objects in separate arrays (one array per field),
+*so that movement and collision passes only read the fields they need. An object keep its index until it is removed, free indexes are kept in a free list
+*(adding and removing take constant time). Live objects are marked in a bit mask for passes over the field arrays, and their indexes are also kept packed
+*in live array (a removed object is replaced by the last one) so that loops over live objects do not visit free indexes.
+*Coordinates wrap around screen edges (object going off screen appear on the opposite side), objects must be smaller than screen.
+*Position and velocity are Q16.16 pixel (velocity is pixel per frame), so sub-pixel motion accumulate. Size is whole pixel.
+*Capacity can be changed by defining ENTITY_STORE_MAX_ENTITIES in project options (multiple of 32, same value for every file).
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef ENTITY_STORE_H
+#define ENTITY_STORE_H
+
+#include <stdint.h>
+
+/*largest number of objects in a store*/
+#ifndef ENTITY_STORE_MAX_ENTITIES
+#define ENTITY_STORE_MAX_ENTITIES	32
+#endif
+
+#if (ENTITY_STORE_MAX_ENTITIES % 32)
+#error "ENTITY_STORE_MAX_ENTITIES must be a multiple of 32"
+#endif
+
+#define ENTITY_STORE_MASK_WORDS		(ENTITY_STORE_MAX_ENTITIES / 32)
+
+#define ENTITY_STORE_NONE	0xFFFF
+
+#define ENTITY_STORE_OVERLAP_TRUE	1
+#define ENTITY_STORE_OVERLAP_FALSE	0
+
+/*Q16.16 velocity*/
+#define ENTITY_STORE_FRACTION_BITS	16
+#define ENTITY_STORE_ONE			((int32_t)1 << ENTITY_STORE_FRACTION_BITS)
+#define ENTITY_STORE_VELOCITY(pixelPerFrame)	((int32_t)((pixelPerFrame) * ENTITY_STORE_ONE))
+
+/*fields of object i are x[i], y[i], dx[i]... Velocity is added to position once per call to entity_store_integrate.
+Position is Q16.16 from 0 to less than screen size, whole pixel is read with entity_store_get_x and entity_store_get_y*/
+typedef struct entity_store {
+	int32_t x[ENTITY_STORE_MAX_ENTITIES];
+	int32_t y[ENTITY_STORE_MAX_ENTITIES];
+	int32_t dx[ENTITY_STORE_MAX_ENTITIES];
+	int32_t dy[ENTITY_STORE_MAX_ENTITIES];
+	int16_t width[ENTITY_STORE_MAX_ENTITIES];
+	int16_t height[ENTITY_STORE_MAX_ENTITIES];
+	uint8_t kind[ENTITY_STORE_MAX_ENTITIES];	/*meaning is defined by user of the store*/
+	uint32_t alive[ENTITY_STORE_MASK_WORDS];	/*bit i set when object i is live*/
+	uint16_t live[ENTITY_STORE_MAX_ENTITIES];	/*indexes of live objects in live[0] to live[total - 1], order change when object is removed*/
+	uint16_t livePosition[ENTITY_STORE_MAX_ENTITIES];	/*position of live object i in live array*/
+	uint16_t nextFree[ENTITY_STORE_MAX_ENTITIES];	/*free list link of free object i*/
+	uint16_t freeHead;	/*first free index, ENTITY_STORE_NONE when store is full*/
+	uint16_t capacity;
+	uint16_t total;	/*number of live objects*/
+	uint16_t screenWidth;
+	uint16_t screenHeight;
+} entity_store;
+
+void entity_store_init(entity_store *, uint16_t capacity, uint16_t screenWidth, uint16_t screenHeight);
+void entity_store_clear(entity_store *);
+uint16_t entity_store_add(entity_store *, uint8_t kind, int16_t x, int16_t y, int32_t dx, int32_t dy, uint16_t width, uint16_t height);
+void entity_store_remove(entity_store *, uint16_t index);
+void entity_store_set_velocity(entity_store *, uint16_t index, int32_t dx, int32_t dy);
+int32_t entity_store_get_dx(const entity_store *, uint16_t index);
+int32_t entity_store_get_dy(const entity_store *, uint16_t index);
+int16_t entity_store_get_x(const entity_store *, uint16_t index);
+int16_t entity_store_get_y(const entity_store *, uint16_t index);
+uint8_t entity_store_is_alive(const entity_store *, uint16_t index);
+void entity_store_integrate(entity_store *);
+uint16_t entity_store_overlap_mask(const entity_store *, int16_t x, int16_t y, uint16_t width, uint16_t height, uint32_t *maskPtr);
+uint8_t entity_store_overlap(const entity_store *, uint16_t index, int16_t x, int16_t y, uint16_t width, uint16_t height);
+
+#endif
@@ -31,14 +31,43 @@ Private function prototype
 int16_t RTE_random_x (void);
 int16_t RTE_random_y (void);
 int8_t RTE_random_sign (void); 
+uint32_t RTE_random_get (void);
 void RTE_wrap_cordinate (int16_t *xPtr, int16_t *yPtr);
+void RTE_move_object (Object_Property_t *PropertyPtr);
 void RTE_update_player_spaceship_direction (Space_Object_t *PlayerSpaceShipPtr);
 void RTE_update_player_spaceship_position (Space_Object_t *PlayerSpaceShipPtr);
-void RTE_delete_dead_rocket (Space_Object_t *RocketPtr);
-void RTE_delete_dead_asteroid (Space_Object_t *AsteroidPtr);
-uint8_t RTE_collision_detect (Space_Object_t *Object1Ptr, Space_Object_t *Object2Ptr);
-void RTE_accelerate_player_spaceship (Space_Object_t *PlayerSpaceShipPtr, int8_t ddx, int8_t ddy);
-void RTE_create_medium_asteroid (vector *AsteroidVectPtr, Space_Object_t *DeadAsteroidPtr);
+void RTE_delete_dead_rocket (entity_store *RocketStorePtr, uint16_t index);
+void RTE_delete_dead_asteroid (entity_store *AsteroidStorePtr, uint16_t index);
+uint8_t RTE_collision_detect (entity_store *AsteroidStorePtr, uint16_t gridId, Space_Object_t *PlayerSpaceShipPtr, int16_t x, int16_t y, uint16_t width, uint16_t height);
+void RTE_accelerate_player_spaceship (Space_Object_t *PlayerSpaceShipPtr, RTE_Real_t ddx, RTE_Real_t ddy);
+void RTE_create_medium_asteroid (entity_store *AsteroidStorePtr, int16_t deadAsteroid_x, int16_t deadAsteroid_y);
+Object_Sprite_t RTE_get_player_sprite (Space_Object_t *PlayerSpaceShipPtr);
+Object_Sprite_t RTE_get_asteroid_sprite (entity_store *AsteroidStorePtr, uint16_t index);
+Object_Sprite_t RTE_get_rocket_sprite (entity_store *RocketStorePtr, uint16_t index);
+void RTE_draw_object (Object_Sprite_t *SpritePtr);
+void RTE_erase_object (Object_Render_t *RenderPtr);
+uint8_t RTE_object_changed (Object_Sprite_t *SpritePtr);
+void RTE_fill_area (const dirty_rect *AreaPtr, uint16_t color);
+void RTE_draw_start_screen(void);
+void RTE_draw_game_over_screen(void);
+void RTE_stop_thruster_sound (void);
+void RTE_build_asteroid_grid (entity_store *AsteroidStorePtr);
+uint16_t RTE_query_asteroid_grid (int16_t x, int16_t y, uint16_t width, uint16_t height);
+uint32_t RTE_hash_data (uint32_t hash, const void *dataPtr, uint32_t size);
+uint32_t RTE_hash_entity_store (uint32_t hash, entity_store *StorePtr);
+
+/*every asteroid slot and player spaceship need an id in asteroid grid, large asteroid touch at most 3x3 cells*/
+#if (RTE_PLAYER_GRID_ID >= SPATIAL_GRID_MAX_IDS)
+#error "SPATIAL_GRID_MAX_IDS is too small for RTE_ASTEROID_BUFFER_SIZE"
+#endif
+
+#if (9*(RTE_ASTEROID_BUFFER_SIZE + 1) > SPATIAL_GRID_MAX_ENTRIES)
+#error "SPATIAL_GRID_MAX_ENTRIES is too small for RTE_ASTEROID_BUFFER_SIZE"
+#endif
+
+#if (RTE_ASTEROID_BUFFER_SIZE > ENTITY_STORE_MAX_ENTITIES) || (RTE_ROCKET_BUFFER_SIZE > ENTITY_STORE_MAX_ENTITIES)
+#error "ENTITY_STORE_MAX_ENTITIES is too small for RTE_ASTEROID_BUFFER_SIZE"
+#endif
 
 /***********************************************************************
 Global variable
@@ -48,37 +77,94 @@ int16_t score = 0;
 int16_t scorePrevious = 0;
 char displayScore[15];
 
-uint8_t shootButtonFirstTimeFlag = RTE_FIRST_TIME_TRUE;
+uint8_t shootCooldown = 0;	/*frames left before next rocket can be launched*/
+
+/*game random numbers come from xorshift32 generator seeded at start of every wave, so a game can be replayed from its seeds and inputs*/
+uint32_t randomState = 1;
+RTE_Input_t frameInput = {JS_DIR_CENTERED,0,0,0};
+uint8_t shootButton = BUTTON_NO_BUTTON;
+uint8_t thrustButton = BUTTON_NO_BUTTON;
+#ifdef RTE_MEASURE_LATENCY
+latency_probe InputLatency;
+#endif
+uint8_t heldButtons = 0;	/*@RTE_BUTTON of buttons whose last event is press*/
+uint8_t playerHeading = RTE_NUM_OF_HEADINGS/4;	/*heading of last joystick deflection, spaceship image and rockets use nearest @JS_DIR*/
 
 Space_Object_t PlayerSpaceship;
-volatile Space_Object_t Asteroid[RTE_ASTEROID_BUFFER_SIZE] ;
-Space_Object_t Rocket[RTE_ROCKET_BUFFER_SIZE];
 
-vector AsteroidVect;
-vector RocketVect;
+/*position, velocity and size of asteroids and rockets (asteroid kind is its size, rocket kind is its heading direction)*/
+entity_store AsteroidStore;
+entity_store RocketStore;
+
+/*data not needed by movement and collision passes, indexed same as entity store*/
+Object_Render_t AsteroidRender[RTE_ASTEROID_BUFFER_SIZE];
+Object_Render_t RocketRender[RTE_ROCKET_BUFFER_SIZE];
+uint8_t rocketLifeSpan[RTE_ROCKET_BUFFER_SIZE];
+
+const uint8_t *const asteroidImage[] = {asteroid_bmp,asteroid_medium_bmp};
+
+/*@JS_DIR nearest to each eighth of a turn from east, and heading of each @JS_DIR*/
+const uint8_t octantDirection[8] = {JS_DIR_RIGHT,JS_DIR_RIGHT_UP,JS_DIR_UP,JS_DIR_LEFT_UP,JS_DIR_LEFT,JS_DIR_LEFT_DOWN,JS_DIR_DOWN,JS_DIR_RIGHT_DOWN};
+const uint8_t directionHeading[RTE_NUM_OF_JS_DIR] = {0,12,20,16,4,28,0,8,24};
+
+/*thrust of each heading (screen y axis point down), largest axis is 1 so that 8 directions of digital joystick keep their thrust*/
+const RTE_Real_t headingThrustX[RTE_NUM_OF_HEADINGS] = {
+RTE_REAL(1),RTE_REAL(1),RTE_REAL(1),RTE_REAL(1),RTE_REAL(1),RTE_REAL(0.668179),RTE_REAL(0.414214),RTE_REAL(0.198912),
+RTE_REAL(0),RTE_REAL(-0.198912),RTE_REAL(-0.414214),RTE_REAL(-0.668179),RTE_REAL(-1),RTE_REAL(-1),RTE_REAL(-1),RTE_REAL(-1),
+RTE_REAL(-1),RTE_REAL(-1),RTE_REAL(-1),RTE_REAL(-1),RTE_REAL(-1),RTE_REAL(-0.668179),RTE_REAL(-0.414214),RTE_REAL(-0.198912),
+RTE_REAL(0),RTE_REAL(0.198912),RTE_REAL(0.414214),RTE_REAL(0.668179),RTE_REAL(1),RTE_REAL(1),RTE_REAL(1),RTE_REAL(1)};
+const RTE_Real_t headingThrustY[RTE_NUM_OF_HEADINGS] = {
+RTE_REAL(0),RTE_REAL(-0.198912),RTE_REAL(-0.414214),RTE_REAL(-0.668179),RTE_REAL(-1),RTE_REAL(-1),RTE_REAL(-1),RTE_REAL(-1),
+RTE_REAL(-1),RTE_REAL(-1),RTE_REAL(-1),RTE_REAL(-1),RTE_REAL(-1),RTE_REAL(-0.668179),RTE_REAL(-0.414214),RTE_REAL(-0.198912),
+RTE_REAL(0),RTE_REAL(0.198912),RTE_REAL(0.414214),RTE_REAL(0.668179),RTE_REAL(1),RTE_REAL(1),RTE_REAL(1),RTE_REAL(1),
+RTE_REAL(1),RTE_REAL(1),RTE_REAL(1),RTE_REAL(1),RTE_REAL(1),RTE_REAL(0.668179),RTE_REAL(0.414214),RTE_REAL(0.198912)};
+const uint8_t *const rocketImage[] = {NULL,rocket_north_bmp,rocket_south_bmp,rocket_east_bmp,rocket_west_bmp,
+rocket_north_east_bmp,rocket_north_west_bmp,rocket_south_east_bmp,rocket_south_west_bmp};
 
 uint8_t currentWave = 0;
 uint8_t numOfAsteroidInWave[RTE_NUM_OF_WAVE] = {1,2,3,4,5};
 
+dirty_rect_list eraseRectList;
+uint8_t fullRedraw = FALSE;	/*RTE_draw_frame clear whole screen and draw every object, used to check dirty rectangles*/
+spatial_grid asteroidGrid;
+uint16_t gridQueryResult[RTE_ASTEROID_BUFFER_SIZE + 1];
+uint32_t pixelsPushedInFrame = 0;
+uint32_t collisionCycles = 0;	/*DWT cycles spent on collision detection since last RTE_get_collision_cycles*/
+
 /***********************************************************************
 Public function: Initialize game engine
 ***********************************************************************/
 void RTE_init (void)
 {
-	RCC_set_SYSCLK_PLL_84_MHz();
+	uint16_t timerPrescaler, timerReload;
+	
+	RCC_set_SYSCLK_profile(RTE_CLOCK_PROFILE);
 	
 	RNG_init();
 	
+	/*joystick scan start first so that its buffer is filled with position at rest before calibration*/
+	joystick_init(JOYSTICK_ADC,JOYSTICK_X_ADC_CHANNEL,JOYSTICK_Y_ADC_CHANNEL);
+	
 	ILI9341_init();
 	ILI9341_rotate(ILI9341_orientation_landscape_2);
 	ILI9341_fill_display(ILI9341_BLACK);
+
+	dirty_rect_list_init(&eraseRectList,ILI9341_config.width,ILI9341_config.height);
+	spatial_grid_init(&asteroidGrid,ILI9341_config.width,ILI9341_config.height);
 	
-	joystick_init(JOYSTICK_ADC,JOYSTICK_X_ADC_CHANNEL,JOYSTICK_Y_ADC_CHANNEL);
+	joystick_calibrate(JOYSTICK_ADC,JOYSTICK_X_ADC_CHANNEL,JOYSTICK_Y_ADC_CHANNEL);
 	
-	speaker_init(DAC_CHANNEL_1,9,679);
+	/*sample rate and frame rate are derived from timer clock of clock profile*/
+	RCC_get_TIM_period((uint32_t)RCC_get_TIMCLK_value(SPEAKER_TIMER_APB),RTE_AUDIO_SAMPLE_RATE,&timerPrescaler,&timerReload);
+	speaker_init(DAC_CHANNEL_1,timerPrescaler,timerReload);
 
-	button_init(SHOOT_BUTTON_PORT,SHOOT_BUTTON_PIN,GPIO_PU);
-	button_init(THRUST_BUTTON_PORT,THRUST_BUTTON_PIN,GPIO_PU);
+	shootButton = button_event_init(SHOOT_BUTTON_PORT,SHOOT_BUTTON_PIN,GPIO_PU,RTE_BUTTON_DEBOUNCE_US);
+	thrustButton = button_event_init(THRUST_BUTTON_PORT,THRUST_BUTTON_PIN,GPIO_PU,RTE_BUTTON_DEBOUNCE_US);
+	
+#ifdef RTE_MEASURE_LATENCY
+	/*button_event_init enabled DWT cycle counter*/
+	latency_probe_init(&InputLatency,RCC_get_SYSCLK_value()/1000000*RTE_LATENCY_BIN_US);
+#endif
 	
 	led_init(PROTOBOARD_RED_LED_PORT,PROTOBOARD_RED_LED_PIN);
 	led_init(PROTOBOARD_GREEN_LED_PORT,PROTOBOARD_GREEN_LED_PIN);
@@ -86,20 +172,16 @@ void RTE_init (void)
 	led_init(PROTOBOARD_WHITE_LED_PORT,PROTOBOARD_WHITE_LED_PIN);
 	
 	/*configure timer 6 to generate periodic interrupt of 33ms (screen refresh rate 30Hz)*/
-	TIM_init_direct(TIM6,1874,999);
+	RCC_get_TIM_period((uint32_t)RCC_get_TIMCLK_value(APB1),RTE_FRAME_RATE,&timerPrescaler,&timerReload);
+	TIM_init_direct(TIM6,timerReload,timerPrescaler);
 	TIM_intrpt_vector_ctr(IRQ_TIM6_DAC,ENABLE);
 	TIM_interrupt_ctr(TIM6,ENABLE);
-	
-	/*configure timer 3 (timer  3 is used for button debouncing)*/
-	TIM_init_direct(TIM3,59999,999);
-	TIM_intrpt_vector_ctr(IRQ_TIM3,ENABLE);
-	TIM_interrupt_ctr(TIM3,ENABLE);
 
-	/*initialize asteroid vector*/
-	vector_init(&AsteroidVect);
+	/*initialize asteroid store*/
+	entity_store_init(&AsteroidStore,RTE_ASTEROID_BUFFER_SIZE,ILI9341_config.width,ILI9341_config.height);
 
-	/*initialize rocket vector*/
-	vector_init(&RocketVect);
+	/*initialize rocket store*/
+	entity_store_init(&RocketStore,RTE_ROCKET_BUFFER_SIZE,ILI9341_config.width,ILI9341_config.height);
 
 }
 
@@ -108,6 +190,10 @@ Public function: Start updating game screen
 ***********************************************************************/
 void RTE_start_update_frame (void)
 {
+#ifdef RTE_MEASURE_LATENCY
+	/*edges read while waiting on start or game over screen are not shown by a frame*/
+	latency_probe_discard_edges(&InputLatency);
+#endif
 	TIM_ctr(TIM6,START);
 }
 
@@ -119,10 +205,14 @@ void RTE_create_player_spaceship (Space_Object_t *PlayerSpaceShipPtr)
 	PlayerSpaceShipPtr->Object_Property.x = RTE_random_x();
 	PlayerSpaceShipPtr->Object_Property.y = RTE_random_y();	
 	
+	PlayerSpaceShipPtr->Object_Property.xFraction = 0;
+	PlayerSpaceShipPtr->Object_Property.yFraction = 0;
+
 	PlayerSpaceShipPtr->Object_Property.dx = 0;
 	PlayerSpaceShipPtr->Object_Property.dy = 0;	
 	
 	PlayerSpaceShipPtr->Object_Property.headingDir = RTE_HEADING_DIR_N;
+	playerHeading = RTE_NUM_OF_HEADINGS/4;
 	
 	PlayerSpaceShipPtr->Object_Property.aliveFlag = RTE_ALIVE_TRUE;
 	PlayerSpaceShipPtr->Object_Property.lifeSpan = 0;
@@ -130,244 +220,320 @@ void RTE_create_player_spaceship (Space_Object_t *PlayerSpaceShipPtr)
 	PlayerSpaceShipPtr->Object_Image.image = player_spaceship_north_bmp;
 	PlayerSpaceShipPtr->Object_Image.imageHeight = RTE_PLAYER_SPACESHIP_BMP_H1;
 	PlayerSpaceShipPtr->Object_Image.imageWidth = RTE_PLAYER_SPACESHIP_BMP_W1;
+
+	PlayerSpaceShipPtr->Object_Render.drawn = RTE_DRAWN_FALSE;
 }
 
 /***********************************************************************
-Public function: Create asteroid (Fill data into elements in array of asteroid structure, then add to asteroid vector)
+Public function: Create asteroid (Add asteroids to asteroid store)
 ***********************************************************************/
-void RTE_create_asteroid (vector *AsteroidVectPtr,Space_Object_t *AsteroidPtr, uint8_t numberToCreate, Space_Object_t *PlayerSpaceShipPtr)
+void RTE_create_asteroid (entity_store *AsteroidStorePtr, uint8_t numberToCreate, Space_Object_t *PlayerSpaceShipPtr)
 {
-	Space_Object_t *PreviousAsteroidPtr = NULL;
-	uint8_t check1 = 0, check2 =0;
-
-	for (uint8_t count = 0; count < numberToCreate; count++,AsteroidPtr++){
-
-		/*store address of asteroid to be created in asteroid vector*/
-		vector_add(AsteroidVectPtr,(void*)AsteroidPtr);
-
-		AsteroidPtr->Object_Image.image = asteroid_bmp;
-		AsteroidPtr->Object_Image.imageHeight = RTE_ASTEROID_BMP_H;
-		AsteroidPtr->Object_Image.imageWidth = RTE_ASTEROID_BMP_W;
-		AsteroidPtr->Object_Image.clearWhenDead = RTE_DEAD_OBJECT_UNCLEARED;
+	uint16_t index = 0;
+	uint16_t numOfCandidate = 0;
+	uint8_t collision = RTE_COLLISION_FALSE;
+	int16_t x = 0;
+	int16_t y = 0;
+	RTE_Real_t dx = 0;
+	RTE_Real_t dy = 0;
+
+	/*new asteroid must not be placed on player spaceship or on asteroids already on screen*/
+	RTE_build_asteroid_grid(AsteroidStorePtr);
+	spatial_grid_insert(&asteroidGrid,RTE_PLAYER_GRID_ID,PlayerSpaceShipPtr->Object_Property.x,PlayerSpaceShipPtr->Object_Property.y,
+	PlayerSpaceShipPtr->Object_Image.imageWidth,PlayerSpaceShipPtr->Object_Image.imageHeight);
+
+	for (uint8_t count = 0; count < numberToCreate; count++){
+
+		/*asteroid store is full*/
+		if(AsteroidStorePtr->total == AsteroidStorePtr->capacity){
+			return;
+		}
 
 		/*keep randomizing asteroid 's position until asteroid being generated not colliding with player and also with other asteroids*/
 		do{
-			check1 = RTE_COLLISION_FALSE;
-			check2 = RTE_COLLISION_FALSE;
-
-			AsteroidPtr->Object_Property.x = RTE_random_x();
-			AsteroidPtr->Object_Property.y = RTE_random_y();
-
-			check1 = RTE_collision_detect(AsteroidPtr,PlayerSpaceShipPtr);
-
-			if(check1 == RTE_COLLISION_TRUE){
-				continue;
-			}
+			collision = RTE_COLLISION_FALSE;
 
+			x = RTE_random_x();
+			y = RTE_random_y();
 
-			/*if first asteroid is being created, no need to check for collision with other asteroid*/
-			if(count == 0){
-				break;
-			}
-
-			/*for generation of 2nd,3rd and other asteroid, collision need to be check*/
-			PreviousAsteroidPtr = AsteroidPtr-1;
-
-			for(uint8_t i = 0; i< count;i++,PreviousAsteroidPtr--){
-				check2 = RTE_collision_detect(AsteroidPtr,PreviousAsteroidPtr);
+			numOfCandidate = RTE_query_asteroid_grid(x,y,RTE_ASTEROID_BMP_W,RTE_ASTEROID_BMP_H);
 
-				if(check2 == RTE_COLLISION_TRUE){
+			for(uint16_t i = 0; i < numOfCandidate; i++){
+				if(RTE_collision_detect(AsteroidStorePtr,gridQueryResult[i],PlayerSpaceShipPtr,x,y,RTE_ASTEROID_BMP_W,RTE_ASTEROID_BMP_H) == RTE_COLLISION_TRUE){
+					collision = RTE_COLLISION_TRUE;
 					break;
 				}
 			}
 
-		}while((check1 == RTE_COLLISION_TRUE) || (check2 == RTE_COLLISION_TRUE ));
+		}while(collision == RTE_COLLISION_TRUE);
 
-		AsteroidPtr->Object_Property.dx = RTE_random_sign()*RTE_ASTEROID_BASE_SPEED;
-		AsteroidPtr->Object_Property.dy = RTE_random_sign()*RTE_ASTEROID_BASE_SPEED;
+		dx = RTE_REAL(RTE_random_sign()*RTE_ASTEROID_BASE_SPEED);
+		dy = RTE_REAL(RTE_random_sign()*RTE_ASTEROID_BASE_SPEED);
 
-		AsteroidPtr->Object_Property.aliveFlag = RTE_ALIVE_TRUE;
-		AsteroidPtr->Object_Property.lifeSpan = 0;
-		AsteroidPtr->Object_Property.asteroidSize = RTE_ASTEROID_SIZE_L;
+		index = entity_store_add(AsteroidStorePtr,RTE_ASTEROID_SIZE_L,x,y,RTE_REAL_TO_Q16(dx),RTE_REAL_TO_Q16(dy),RTE_ASTEROID_BMP_W,RTE_ASTEROID_BMP_H);
+		AsteroidRender[index].drawn = RTE_DRAWN_FALSE;
+
+		spatial_grid_insert(&asteroidGrid,index,entity_store_get_x(AsteroidStorePtr,index),entity_store_get_y(AsteroidStorePtr,index),
+		AsteroidStorePtr->width[index],AsteroidStorePtr->height[index]);
 	}
 }
 
 /***********************************************************************
-Public function: Create rocket (Fill data into elements in array of rocket structure, then add to rocket vector)
+Public function: Create rocket (Add rocket to rocket store)
 ***********************************************************************/
-void RTE_create_rocket (vector *RocketVectPtr, Space_Object_t *RocketPtr, Space_Object_t *PlayerSpaceShipPtr)
+void RTE_create_rocket (entity_store *RocketStorePtr, Space_Object_t *PlayerSpaceShipPtr)
 {
-	if (!SHOOT_BUTTON_READ){
+	if(shootCooldown){
+		shootCooldown--;
+	}
+
+	if (frameInput.buttons & RTE_BUTTON_SHOOT){
 
-		if(shootButtonFirstTimeFlag == RTE_FIRST_TIME_TRUE){
+		/*rate of fire is counted in frames (not in time) so that replayed game launch rockets in same frames*/
+		if(!shootCooldown){
 
-			TIM_ctr(TIM3,START);
+			int16_t x = PlayerSpaceShipPtr->Object_Property.x;
+			int16_t y = PlayerSpaceShipPtr->Object_Property.y;
+			RTE_Real_t dx = 0;
+			RTE_Real_t dy = 0;
+			uint8_t width = 0;
+			uint8_t height = 0;
+			uint16_t index = 0;
 
-			shootButtonFirstTimeFlag = RTE_FIRST_TIME_FALSE;
+			shootCooldown = RTE_SHOOT_COOLDOWN_FRAMES;
 
 			PROTOBOARD_WHITE_LED_ON;
 
-			speaker_play_sound(rocket_launch,sizeof(rocket_launch)/sizeof(rocket_launch[0]));
+			speaker_play_ADPCM_voice(&rocket_launch,SPEAKER_VOLUME_FULL,RTE_SOUND_PRIORITY_ROCKET,SPEAKER_PLAY_ONCE);
 
 			scorePrevious = score;
 			score--;
 
-			Space_Object_t *head = RocketPtr;
-
-			while((RocketPtr->Object_Property.aliveFlag != RTE_ALIVE_FALSE)	&& (RocketPtr->Object_Property.aliveFlag != RTE_ALIVE_UNSET)){
-				RocketPtr ++;
-				if(RocketPtr - head > (RTE_ROCKET_BUFFER_SIZE-1)){
-					return;
-				}
-			}
-
-			vector_add(RocketVectPtr,RocketPtr);
+			if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_N){
 
-			RocketPtr->Object_Property.aliveFlag = RTE_ALIVE_TRUE;
-			RocketPtr->Object_Property.lifeSpan = RTE_ROCKET_LIFESPAN;
-			RocketPtr->Object_Image.clearWhenDead = RTE_DEAD_OBJECT_UNCLEARED;
+				x += RTE_ROCKET_N_START_X;
+				y += RTE_ROCKET_N_START_Y;
+				dy = -RTE_REAL(RTE_ROCKET_BASE_SPEED);
+				width = RTE_ROCKET_BMP_W1;
+				height = RTE_ROCKET_BMP_H1;
 
-			if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_N){
+			}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_S){
 
-				RocketPtr->Object_Property.x = PlayerSpaceShipPtr->Object_Property.x + RTE_ROCKET_N_START_X;
-				RocketPtr->Object_Property.y = PlayerSpaceShipPtr->Object_Property.y + RTE_ROCKET_N_START_Y;
+				x += RTE_ROCKET_S_START_X;
+				y += RTE_ROCKET_S_START_Y;
+				dy = RTE_REAL(RTE_ROCKET_BASE_SPEED);
+				width = RTE_ROCKET_BMP_W1;
+				height = RTE_ROCKET_BMP_H1;
 
-				RocketPtr->Object_Property.dx = 0;
-				RocketPtr->Object_Property.dy = -RTE_ROCKET_BASE_SPEED;
+			}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_E){
 
-				RocketPtr->Object_Image.image = rocket_north_bmp;
-				RocketPtr->Object_Image.imageWidth = RTE_ROCKET_BMP_W1;
-				RocketPtr->Object_Image.imageHeight = RTE_ROCKET_BMP_H1;
+				x += RTE_ROCKET_E_START_X;
+				y += RTE_ROCKET_E_START_Y;
+				dx = RTE_REAL(RTE_ROCKET_BASE_SPEED);
+				width = RTE_ROCKET_BMP_H1;
+				height = RTE_ROCKET_BMP_W1;
 
-			}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_S){
+			}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_W){
 
-				RocketPtr->Object_Property.x = PlayerSpaceShipPtr->Object_Property.x + RTE_ROCKET_S_START_X;
-				RocketPtr->Object_Property.y = PlayerSpaceShipPtr->Object_Property.y + RTE_ROCKET_S_START_Y;
+				x += RTE_ROCKET_W_START_X;
+				y += RTE_ROCKET_W_START_Y;
+				dx = -RTE_REAL(RTE_ROCKET_BASE_SPEED);
+				width = RTE_ROCKET_BMP_H1;
+				height = RTE_ROCKET_BMP_W1;
 
-				RocketPtr->Object_Property.dx =	0;
-				RocketPtr->Object_Property.dy = RTE_ROCKET_BASE_SPEED;
+			}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_NE){
 
-				RocketPtr->Object_Image.image = rocket_south_bmp;
-				RocketPtr->Object_Image.imageWidth = RTE_ROCKET_BMP_W1;
-				RocketPtr->Object_Image.imageHeight = RTE_ROCKET_BMP_H1;
+				x += RTE_ROCKET_NE_START_X;
+				y += RTE_ROCKET_NE_START_Y;
+				dx = RTE_REAL(RTE_ROCKET_BASE_SPEED);
+				dy = -RTE_REAL(RTE_ROCKET_BASE_SPEED);
+				width = RTE_ROCKET_BMP_W2;
+				height = RTE_ROCKET_BMP_H2;
 
-			}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_E){
+			}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_SE){
 
-				RocketPtr->Object_Property.x = PlayerSpaceShipPtr->Object_Property.x + RTE_ROCKET_E_START_X;
-				RocketPtr->Object_Property.y = PlayerSpaceShipPtr->Object_Property.y + RTE_ROCKET_E_START_Y;
+				x += RTE_ROCKET_SE_START_X;
+				y += RTE_ROCKET_SE_START_Y;
+				dx = RTE_REAL(RTE_ROCKET_BASE_SPEED);
+				dy = RTE_REAL(RTE_ROCKET_BASE_SPEED);
+				width = RTE_ROCKET_BMP_W2;
+				height = RTE_ROCKET_BMP_H2;
 
-				RocketPtr->Object_Property.dx = RTE_ROCKET_BASE_SPEED;
-				RocketPtr->Object_Property.dy = 0;
+			}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_NW){
 
-				RocketPtr->Object_Image.image = rocket_east_bmp;
-				RocketPtr->Object_Image.imageWidth = RTE_ROCKET_BMP_H1;
-				RocketPtr->Object_Image.imageHeight = RTE_ROCKET_BMP_W1;
+				x += RTE_ROCKET_NW_START_X;
+				y += RTE_ROCKET_NW_START_Y;
+				dx = -RTE_REAL(RTE_ROCKET_BASE_SPEED);
+				dy = -RTE_REAL(RTE_ROCKET_BASE_SPEED);
+				width = RTE_ROCKET_BMP_W2;
+				height = RTE_ROCKET_BMP_H2;
 
-			}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_W){
+			}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_SW){
 
-				RocketPtr->Object_Property.x = PlayerSpaceShipPtr->Object_Property.x + RTE_ROCKET_W_START_X;
-				RocketPtr->Object_Property.y = PlayerSpaceShipPtr->Object_Property.y + RTE_ROCKET_W_START_Y;
+				x += RTE_ROCKET_SW_START_X;
+				y += RTE_ROCKET_SW_START_Y;
+				dx = -RTE_REAL(RTE_ROCKET_BASE_SPEED);
+				dy = RTE_REAL(RTE_ROCKET_BASE_SPEED);
+				width = RTE_ROCKET_BMP_W2;
+				height = RTE_ROCKET_BMP_H2;
 
-				RocketPtr->Object_Property.dx = -RTE_ROCKET_BASE_SPEED;
-				RocketPtr->Object_Property.dy = 0;
+			}
 
-				RocketPtr->Object_Image.image = rocket_west_bmp;
-				RocketPtr->Object_Image.imageWidth = RTE_ROCKET_BMP_H1;
-				RocketPtr->Object_Image.imageHeight = RTE_ROCKET_BMP_W1;
+			/*rocket image is picked from its heading direction (stored as kind)*/
+			index = entity_store_add(RocketStorePtr,PlayerSpaceShipPtr->Object_Property.headingDir,x,y,RTE_REAL_TO_Q16(dx),RTE_REAL_TO_Q16(dy),width,height);
 
-			}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_NE){
+			/*all rockets are flying*/
+			if(index == ENTITY_STORE_NONE){
+				return;
+			}
 
-				RocketPtr->Object_Property.x = PlayerSpaceShipPtr->Object_Property.x + RTE_ROCKET_NE_START_X;
-				RocketPtr->Object_Property.y = PlayerSpaceShipPtr->Object_Property.y + RTE_ROCKET_NE_START_Y;
+			rocketLifeSpan[index] = RTE_ROCKET_LIFESPAN;
+			RocketRender[index].drawn = RTE_DRAWN_FALSE;
+		}
+	}else{
+		PROTOBOARD_WHITE_LED_OFF;
+	}
+}
 
-				RocketPtr->Object_Property.dx = RTE_ROCKET_BASE_SPEED;
-				RocketPtr->Object_Property.dy = -RTE_ROCKET_BASE_SPEED;
+/***********************************************************************
+Public function: Draw player spaceship
+***********************************************************************/
+void RTE_draw_player_spaceship (Space_Object_t *PlayerSpaceShipPtr)
+{
+	Object_Sprite_t Sprite = RTE_get_player_sprite(PlayerSpaceShipPtr);
+	RTE_draw_object(&Sprite);
+}
 
-				RocketPtr->Object_Image.image = rocket_north_east_bmp;
-				RocketPtr->Object_Image.imageWidth = RTE_ROCKET_BMP_W2;
-				RocketPtr->Object_Image.imageHeight = RTE_ROCKET_BMP_H2;
+/***********************************************************************
+Public function: Draw live asteroid (asteroid in asteroid store)
+***********************************************************************/
+void RTE_draw_asteroid (entity_store *AsteroidStorePtr)
+{
+	Object_Sprite_t Sprite;
+	for(uint16_t position = 0;position < AsteroidStorePtr->total;position++){
+		uint16_t index = AsteroidStorePtr->live[position];
+		Sprite = RTE_get_asteroid_sprite(AsteroidStorePtr,index);
+		RTE_draw_object(&Sprite);
+	}
+}
 
-			}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_SE){
+/***********************************************************************
+Public function: Draw live rocket (rocket in rocket store)
+***********************************************************************/
+void RTE_draw_rocket (entity_store *RocketStorePtr)
+{
+	Object_Sprite_t Sprite;
+	for(uint16_t position = 0;position < RocketStorePtr->total;position++){
+		uint16_t index = RocketStorePtr->live[position];
+		Sprite = RTE_get_rocket_sprite(RocketStorePtr,index);
+		RTE_draw_object(&Sprite);
+	}
+}
 
-				RocketPtr->Object_Property.x = PlayerSpaceShipPtr->Object_Property.x + RTE_ROCKET_SE_START_X;
-				RocketPtr->Object_Property.y = PlayerSpaceShipPtr->Object_Property.y + RTE_ROCKET_SE_START_Y;
+/***********************************************************************
+Public function: Draw all objects, only pushing area which changed since last frame to the screen
+***********************************************************************/
+void RTE_draw_frame (Space_Object_t *PlayerSpaceShipPtr, entity_store *RocketStorePtr, entity_store *AsteroidStorePtr)
+{
+	Object_Sprite_t Sprite[RTE_MAX_NUM_OF_OBJECT];
+	uint8_t redraw[RTE_MAX_NUM_OF_OBJECT];
+	uint8_t numOfObject = 0;
 
-				RocketPtr->Object_Property.dx = RTE_ROCKET_BASE_SPEED;
-				RocketPtr->Object_Property.dy = RTE_ROCKET_BASE_SPEED;
+	pixelsPushedInFrame = 0;
 
-				RocketPtr->Object_Image.image = rocket_south_east_bmp;
-				RocketPtr->Object_Image.imageWidth = RTE_ROCKET_BMP_W2;
-				RocketPtr->Object_Image.imageHeight = RTE_ROCKET_BMP_H2;
+	/*objects are drawn in same order as RTE_draw_player_spaceship, RTE_draw_rocket, RTE_draw_asteroid (later object is on top)*/
+	Sprite[numOfObject++] = RTE_get_player_sprite(PlayerSpaceShipPtr);
 
-			}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_NW){
+	for(uint16_t position = 0;position < RocketStorePtr->total && numOfObject < RTE_MAX_NUM_OF_OBJECT;position++){
+		uint16_t index = RocketStorePtr->live[position];
+		Sprite[numOfObject++] = RTE_get_rocket_sprite(RocketStorePtr,index);
+	}
 
-				RocketPtr->Object_Property.x = PlayerSpaceShipPtr->Object_Property.x + RTE_ROCKET_NW_START_X;
-				RocketPtr->Object_Property.y = PlayerSpaceShipPtr->Object_Property.y + RTE_ROCKET_NW_START_Y;
+	for(uint16_t position = 0;position < AsteroidStorePtr->total && numOfObject < RTE_MAX_NUM_OF_OBJECT;position++){
+		uint16_t index = AsteroidStorePtr->live[position];
+		Sprite[numOfObject++] = RTE_get_asteroid_sprite(AsteroidStorePtr,index);
+	}
 
-				RocketPtr->Object_Property.dx = -RTE_ROCKET_BASE_SPEED;
-				RocketPtr->Object_Property.dy = -RTE_ROCKET_BASE_SPEED;
+	/*reference drawing: same objects in same order over a cleared screen*/
+	if(fullRedraw){
+		dirty_rect screen = {0,0,ILI9341_config.width,ILI9341_config.height};
+		RTE_fill_area(&screen,RTE_BACKGROUND_COLOR);
 
-				RocketPtr->Object_Image.image = rocket_north_west_bmp;
-				RocketPtr->Object_Image.imageWidth = RTE_ROCKET_BMP_W2;
-				RocketPtr->Object_Image.imageHeight = RTE_ROCKET_BMP_H2;
+		for(uint8_t i = 0;i < numOfObject;i++){
+			RTE_draw_object(&Sprite[i]);
+		}
 
-			}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_SW){
+		dirty_rect_list_clear(&eraseRectList);
+		return;
+	}
 
-				RocketPtr->Object_Property.x = PlayerSpaceShipPtr->Object_Property.x + RTE_ROCKET_SW_START_X;
-				RocketPtr->Object_Property.y = PlayerSpaceShipPtr->Object_Property.y + RTE_ROCKET_SW_START_Y;
+	/*collect strips left behind by moved objects (dead objects were already added when they were deleted)*/
+	for(uint8_t i = 0;i < numOfObject;i++){
+		redraw[i] = RTE_object_changed(&Sprite[i]);
 
-				RocketPtr->Object_Property.dx = -RTE_ROCKET_BASE_SPEED;
-				RocketPtr->Object_Property.dy = RTE_ROCKET_BASE_SPEED;
+		if(redraw[i] && Sprite[i].Object_Render->drawn == RTE_DRAWN_TRUE){
+			dirty_rect current = {Sprite[i].x,Sprite[i].y,Sprite[i].imageWidth,Sprite[i].imageHeight};
+			dirty_rect_add_vacated(&eraseRectList,&Sprite[i].Object_Render->drawnArea,&current);
+		}
+	}
 
-				RocketPtr->Object_Image.image = rocket_south_west_bmp;
-				RocketPtr->Object_Image.imageWidth = RTE_ROCKET_BMP_W2;
-				RocketPtr->Object_Image.imageHeight = RTE_ROCKET_BMP_H2;
+	for(int i = 0;i < eraseRectList.total;i++){
+		RTE_fill_area(&eraseRectList.rects[i],RTE_BACKGROUND_COLOR);
+	}
 
+	/*unchanged object must still be redrawn if it was partly erased or partly covered by object drawn before it*/
+	for(uint8_t i = 0;i < numOfObject;i++){
+		if(!redraw[i]){
+			if(dirty_rect_list_overlap(&eraseRectList,&Sprite[i].Object_Render->drawnArea) == DIRTY_RECT_OVERLAP_TRUE){
+				redraw[i] = TRUE;
+			}else{
+				for(uint8_t j = 0;j < i;j++){
+					if(redraw[j] && dirty_rect_overlap(&eraseRectList,&Sprite[j].Object_Render->drawnArea,&Sprite[i].Object_Render->drawnArea) == DIRTY_RECT_OVERLAP_TRUE){
+						redraw[i] = TRUE;
+						break;
+					}
+				}
 			}
 		}
-	}else{
-		PROTOBOARD_WHITE_LED_OFF;
+
+		if(redraw[i]){
+			RTE_draw_object(&Sprite[i]);
+		}
 	}
+
+	dirty_rect_list_clear(&eraseRectList);
 }
 
+
 /***********************************************************************
-Public function: Draw player spaceship
+Public function: Make RTE_draw_frame clear whole screen and draw every object instead of only changed areas (TRUE or FALSE)
 ***********************************************************************/
-void RTE_draw_player_spaceship (Space_Object_t *PlayerSpaceShipPtr)
+void RTE_set_full_redraw (uint8_t enOrDis)
 {
-	ILI9341_draw_bitmap_w_background(PlayerSpaceShipPtr->Object_Property.x,PlayerSpaceShipPtr->Object_Property.y,
-	PlayerSpaceShipPtr->Object_Image.image,PlayerSpaceShipPtr->Object_Image.imageWidth,
-	PlayerSpaceShipPtr->Object_Image.imageHeight,ILI9341_LIGHTGREY,ILI9341_BLACK);
+	fullRedraw = enOrDis;
 }
 
 /***********************************************************************
-Public function: Draw active asteroid (asteroid which address is store in asteroid vector)
+Public function: Count latency of button edges read in this frame, once last byte of frame is sent (nothing without RTE_MEASURE_LATENCY)
 ***********************************************************************/
-void RTE_draw_asteroid (vector *AsteroidVect)
+void RTE_measure_frame_latency (void)
 {
-	Space_Object_t *AsteroidPtr = NULL;
-	for(uint8_t count = 0;count < AsteroidVect->total;count++){
-		AsteroidPtr = vector_get(AsteroidVect,count);
-		ILI9341_draw_bitmap_w_background(AsteroidPtr->Object_Property.x,AsteroidPtr->Object_Property.y,
-		AsteroidPtr->Object_Image.image,AsteroidPtr->Object_Image.imageWidth,
-		AsteroidPtr->Object_Image.imageHeight,0xB3E7,ILI9341_BLACK);
-	}
+#ifdef RTE_MEASURE_LATENCY
+	ILI9341_wait_until_ready();
+	latency_probe_frame_sent(&InputLatency,ILI9341_get_last_transfer_timestamp());
+#endif
 }
 
 /***********************************************************************
-Public function: Draw active rocket (rocket which address is store in rocket vector)
+Public function: Get DWT cycles spent on collision detection (asteroid grid, asteroid and rocket overlap) since last call
 ***********************************************************************/
-void RTE_draw_rocket (vector *RocketVectPtr)
+uint32_t RTE_get_collision_cycles (void)
 {
-	Space_Object_t  *RocketPtr = NULL;
-	for (uint8_t count = 0;count < RocketVectPtr->total;count++){
-		RocketPtr = vector_get(RocketVectPtr,count);
-		ILI9341_draw_bitmap_w_background(RocketPtr->Object_Property.x,RocketPtr->Object_Property.y,
-		RocketPtr->Object_Image.image,RocketPtr->Object_Image.imageWidth,
-		RocketPtr->Object_Image.imageHeight,ILI9341_LIGHTGREY,ILI9341_BLACK);
-	}
-}
+	uint32_t cycles = collisionCycles;
 
+	collisionCycles = 0;
+	return cycles;
+}
 
 /***********************************************************************
 Public function: Update player spaceship 's information
@@ -379,111 +545,143 @@ void RTE_update_player_spaceship (Space_Object_t *PlayerSpaceShipPtr)
 }
 
 /***********************************************************************
-Public function: Update information of active asteroid
+Public function: Update information of live asteroid
 ***********************************************************************/
-void RTE_update_asteroid (vector *AsteroidVectPtr, Space_Object_t *PlayerSpaceShipPtr)
+void RTE_update_asteroid (entity_store *AsteroidStorePtr, Space_Object_t *PlayerSpaceShipPtr)
 {
-	Space_Object_t *AsteroidPtr = NULL;
-	Space_Object_t *OtherAsteroidPtr = NULL;
+	uint16_t numOfCandidate = 0;
+	uint16_t otherIndex = 0;
+	uint32_t collisionStart = 0;
 
-	for(uint8_t count = 0;count < AsteroidVectPtr->total;count++){
+	/*update position of every asteroid first, then sort them into grid cells*/
+	entity_store_integrate(AsteroidStorePtr);
 
-		AsteroidPtr = vector_get(AsteroidVectPtr,count);
+	collisionStart = DWT_get_cycle_count();
+	RTE_build_asteroid_grid(AsteroidStorePtr);
 
-		/*update current asteroid 's position*/
-		AsteroidPtr->Object_Property.x += AsteroidPtr->Object_Property.dx;
-		AsteroidPtr->Object_Property.y += AsteroidPtr->Object_Property.dy;
-		RTE_wrap_cordinate(&AsteroidPtr->Object_Property.x,&AsteroidPtr->Object_Property.y);
+	/*check whether current asteroid collide with other asteroid sharing a grid cell (each pair is checked once, by asteroid with lower index)*/
+	for(uint16_t position = 0;position < AsteroidStorePtr->total;position++){
 
-		/*check whether current asteroid collide with other asteroid (if there are more than 1 active asteroid)*/
-		if(AsteroidVectPtr->total > 1){
+		uint16_t index = AsteroidStorePtr->live[position];
 
-			for (uint8_t i = count + 1;i < AsteroidVectPtr->total;i++){
+		numOfCandidate = RTE_query_asteroid_grid(entity_store_get_x(AsteroidStorePtr,index),entity_store_get_y(AsteroidStorePtr,index),
+		AsteroidStorePtr->width[index],AsteroidStorePtr->height[index]);
 
-				OtherAsteroidPtr = vector_get(AsteroidVectPtr,i);
+		for (uint16_t i = 0;i < numOfCandidate;i++){
 
-				if(OtherAsteroidPtr->Object_Property.aliveFlag == RTE_ALIVE_TRUE){
-					if(RTE_collision_detect(AsteroidPtr,OtherAsteroidPtr) == RTE_COLLISION_TRUE){
+			otherIndex = gridQueryResult[i];
 
-						/*if collided make both asteroid travel in opposite direction*/
-						AsteroidPtr->Object_Property.dx *= -1;
-						AsteroidPtr->Object_Property.dy *= -1;
-						OtherAsteroidPtr->Object_Property.dx *= -1;
-						OtherAsteroidPtr->Object_Property.dy *= -1;
+			if(otherIndex <= index){
+				continue;
+			}
 
-						speaker_play_sound(asteroid_impact,sizeof(asteroid_impact)/sizeof(asteroid_impact[0]));
-					}
-				}
+			if(RTE_collision_detect(AsteroidStorePtr,otherIndex,PlayerSpaceShipPtr,entity_store_get_x(AsteroidStorePtr,index),entity_store_get_y(AsteroidStorePtr,index),
+				AsteroidStorePtr->width[index],AsteroidStorePtr->height[index]) == RTE_COLLISION_TRUE){
+
+				/*if collided make both asteroid travel in opposite direction*/
+				entity_store_set_velocity(AsteroidStorePtr,index,-entity_store_get_dx(AsteroidStorePtr,index),-entity_store_get_dy(AsteroidStorePtr,index));
+				entity_store_set_velocity(AsteroidStorePtr,otherIndex,-entity_store_get_dx(AsteroidStorePtr,otherIndex),-entity_store_get_dy(AsteroidStorePtr,otherIndex));
+
+				speaker_play_ADPCM_voice(&asteroid_impact,SPEAKER_VOLUME_FULL,RTE_SOUND_PRIORITY_IMPACT,SPEAKER_PLAY_ONCE);
 			}
 		}
+	}
+
+	/*check whether any asteroid and player spaceship collided*/
+	numOfCandidate = RTE_query_asteroid_grid(PlayerSpaceShipPtr->Object_Property.x,PlayerSpaceShipPtr->Object_Property.y,
+	PlayerSpaceShipPtr->Object_Image.imageWidth,PlayerSpaceShipPtr->Object_Image.imageHeight);
+
+	for(uint16_t i = 0;i < numOfCandidate;i++){
 
-		/*check whether current asteroid and player spaceship collided*/
-		if(RTE_collision_detect(AsteroidPtr,PlayerSpaceShipPtr) == RTE_COLLISION_TRUE){
+		if(RTE_collision_detect(AsteroidStorePtr,gridQueryResult[i],PlayerSpaceShipPtr,PlayerSpaceShipPtr->Object_Property.x,PlayerSpaceShipPtr->Object_Property.y,
+			PlayerSpaceShipPtr->Object_Image.imageWidth,PlayerSpaceShipPtr->Object_Image.imageHeight) == RTE_COLLISION_TRUE){
 
 			/*if collided mark player spaceship as dead and return to main loop*/
 			PlayerSpaceShipPtr->Object_Property.aliveFlag = RTE_ALIVE_FALSE;
+			collisionCycles += DWT_get_elapsed_cycles(collisionStart);
 
-			speaker_play_sound(spaceship_explode,sizeof(spaceship_explode)/sizeof(spaceship_explode[0]));
+			RTE_stop_thruster_sound();
+			speaker_play_ADPCM_voice(&spaceship_explode,SPEAKER_VOLUME_FULL,RTE_SOUND_PRIORITY_EXPLODE,SPEAKER_PLAY_ONCE);
 
 			return;
 		}
 	}
+
+	collisionCycles += DWT_get_elapsed_cycles(collisionStart);
 }
 
 /***********************************************************************
-Function: Update active rocket information
+Function: Update live rocket information
 ***********************************************************************/
-void RTE_update_rocket (vector *RocketVectPtr, vector *AsteroidVectPtr)
+void RTE_update_rocket (entity_store *RocketStorePtr, entity_store *AsteroidStorePtr)
 {
-	Space_Object_t *RocketPtr = NULL;
-	Space_Object_t *AsteroidPtr = NULL;
+	uint16_t asteroidIndex = 0;
+	uint16_t numOfCandidate = 0;
+	uint8_t asteroidSize = 0;
+	int16_t deadAsteroid_x = 0;
+	int16_t deadAsteroid_y = 0;
+	uint32_t collisionStart = 0;
 
-	for(int8_t count = 0; count < RocketVectPtr->total; count++){
+	entity_store_integrate(RocketStorePtr);
 
-		RocketPtr = vector_get(RocketVectPtr,count);
+	collisionStart = DWT_get_cycle_count();
+	RTE_build_asteroid_grid(AsteroidStorePtr);
+	collisionCycles += DWT_get_elapsed_cycles(collisionStart);
 
-		RocketPtr->Object_Property.lifeSpan--;
+	/*walk live array backward, a removed rocket is replaced by last rocket which was already updated*/
+	for(uint16_t position = RocketStorePtr->total;position-- > 0;){
 
-		RocketPtr->Object_Property.x += RocketPtr->Object_Property.dx;
-		RocketPtr->Object_Property.y += RocketPtr->Object_Property.dy;
-		RTE_wrap_cordinate(&RocketPtr->Object_Property.x,&RocketPtr->Object_Property.y);
+		uint16_t index = RocketStorePtr->live[position];
 
-		/*if life span of rocket ran out, mark rocket as dead and remove from rocket vector */
-		if(!(RocketPtr->Object_Property.lifeSpan)){
-			RocketPtr->Object_Property.aliveFlag = RTE_ALIVE_FALSE;
-			RTE_delete_dead_rocket(RocketPtr);
-			vector_delete(RocketVectPtr,count);
-			count--;
-		}
+		rocketLifeSpan[index]--;
 
-		/*if rocket hit an asteroid, mark both rocket and asteroid as dead, remove current rocket from rocket vector, asteroid from asteroid vector*/
-		for(int8_t i = 0;i < AsteroidVectPtr->total; i++){
-			AsteroidPtr = (Space_Object_t*)vector_get(AsteroidVectPtr,i);
+		/*if life span of rocket ran out, remove rocket from rocket store*/
+		if(!rocketLifeSpan[index]){
+			RTE_delete_dead_rocket(RocketStorePtr,index);
+			continue;
+		}
 
-			if(RTE_collision_detect(RocketPtr,AsteroidPtr) == RTE_COLLISION_TRUE){
+		/*check rocket only against asteroids sharing a grid cell with it*/
+		collisionStart = DWT_get_cycle_count();
+		numOfCandidate = RTE_query_asteroid_grid(entity_store_get_x(RocketStorePtr,index),entity_store_get_y(RocketStorePtr,index),
+		RocketStorePtr->width[index],RocketStorePtr->height[index]);
 
-				scorePrevious = score;
-				score += 10;
+		/*rocket is gone after hitting asteroid with lowest index, it can not hit other asteroid*/
+		asteroidIndex = ENTITY_STORE_NONE;
+		for(uint16_t i = 0;i < numOfCandidate;i++){
 
-				RocketPtr->Object_Property.aliveFlag = RTE_ALIVE_FALSE;
-				RTE_delete_dead_rocket(RocketPtr);
-				vector_delete(RocketVectPtr,count);
-				count--;
-				AsteroidPtr->Object_Property.aliveFlag = RTE_ALIVE_FALSE;
-				RTE_delete_dead_asteroid(AsteroidPtr);
-				vector_delete(AsteroidVectPtr,i);
-				i--;
+			/*asteroid may have been destroyed by other rocket in this frame*/
+			if(gridQueryResult[i] >= asteroidIndex || !entity_store_is_alive(AsteroidStorePtr,gridQueryResult[i])){
+				continue;
+			}
 
-				/*if asteroid that was hit is large one, create 2 medium asteroids*/
-				if(AsteroidPtr->Object_Property.asteroidSize == RTE_ASTEROID_SIZE_L){
-					RTE_create_medium_asteroid(AsteroidVectPtr,AsteroidPtr);
-					speaker_play_sound(asteroid_large_explode,sizeof(asteroid_large_explode)/sizeof(asteroid_large_explode[0]));
-					break;
-				}else if (AsteroidPtr->Object_Property.asteroidSize == RTE_ASTEROID_SIZE_M){
-					speaker_play_sound(asteroid_medium_explode,sizeof(asteroid_medium_explode)/sizeof(asteroid_medium_explode[0]));
-				}
+			if(entity_store_overlap(AsteroidStorePtr,gridQueryResult[i],entity_store_get_x(RocketStorePtr,index),entity_store_get_y(RocketStorePtr,index),
+				RocketStorePtr->width[index],RocketStorePtr->height[index]) == ENTITY_STORE_OVERLAP_TRUE){
+				asteroidIndex = gridQueryResult[i];
 			}
+		}
+		collisionCycles += DWT_get_elapsed_cycles(collisionStart);
 
+		if(asteroidIndex == ENTITY_STORE_NONE){
+			continue;
+		}
+
+		scorePrevious = score;
+		score += 10;
+
+		asteroidSize = AsteroidStorePtr->kind[asteroidIndex];
+		deadAsteroid_x = entity_store_get_x(AsteroidStorePtr,asteroidIndex);
+		deadAsteroid_y = entity_store_get_y(AsteroidStorePtr,asteroidIndex);
+
+		RTE_delete_dead_rocket(RocketStorePtr,index);
+		RTE_delete_dead_asteroid(AsteroidStorePtr,asteroidIndex);
+
+		/*if asteroid that was hit is large one, create 2 medium asteroids*/
+		if(asteroidSize == RTE_ASTEROID_SIZE_L){
+			RTE_create_medium_asteroid(AsteroidStorePtr,deadAsteroid_x,deadAsteroid_y);
+			speaker_play_ADPCM_voice(&asteroid_large_explode,SPEAKER_VOLUME_FULL,RTE_SOUND_PRIORITY_EXPLODE,SPEAKER_PLAY_ONCE);
+		}else if (asteroidSize == RTE_ASTEROID_SIZE_M){
+			speaker_play_ADPCM_voice(&asteroid_medium_explode,SPEAKER_VOLUME_FULL,RTE_SOUND_PRIORITY_EXPLODE,SPEAKER_PLAY_ONCE);
 		}
 	}
 }
@@ -511,10 +709,11 @@ Function: Display start screen
 ***********************************************************************/
 void RTE_display_start_screen(void)
 {
-	RTE_display_black_background();
-	ILI9341_draw_bitmap(48,8,earth_bmp,225,225,ILI9341_DARKCYAN);
-	ILI9341_put_string(40,60,"RETURN TO EARTH",&TM_Font_16x26,ILI9341_WHITE);
-	ILI9341_put_string(20,220,"Press shoot button to start",&TM_Font_11x18,ILI9341_WHITE);	
+	/*text is drawn over image, in framebuffer every pixel is sent once*/
+	ILI9341_framebuffer_begin(RTE_BACKGROUND_COLOR);
+	do{
+		RTE_draw_start_screen();
+	}while(ILI9341_framebuffer_next_strip());
 }
 
 /***********************************************************************
@@ -522,9 +721,10 @@ Function: Display game over screen
 ***********************************************************************/
 void RTE_display_game_over_screen(void)
 {
-	RTE_display_black_background();
-	ILI9341_draw_bitmap(48,0,meteor_bmp,225,225,ILI9341_YELLOW);
-	ILI9341_put_string(10,200,"Uh oh,your space ship burned down.Want to try again?",&TM_Font_11x18,ILI9341_WHITE);
+	ILI9341_framebuffer_begin(RTE_BACKGROUND_COLOR);
+	do{
+		RTE_draw_game_over_screen();
+	}while(ILI9341_framebuffer_next_strip());
 }
 
 /***********************************************************************
@@ -533,25 +733,153 @@ Function: Preparation before resetting game
 void RTE_reset_game(void)
 {
 	score = 0;
+	shootCooldown = 0;
 	frameUpdate = CLEAR;
 	RNG_init();
 	TIM_ctr(TIM6,STOP);
 	currentWave = 0;
 
-	for(uint8_t count = 0; count < AsteroidVect.total;){
-		vector_delete(&AsteroidVect,count);
+	entity_store_clear(&AsteroidStore);
+	entity_store_clear(&RocketStore);
+
+	dirty_rect_list_clear(&eraseRectList);
+}
+
+/***********************************************************************
+Public function: Get hash of game state (same inputs and random numbers always give same hash, used to detect behavior change)
+***********************************************************************/
+uint32_t RTE_get_state_hash(void)
+{
+	/*FNV-1a, each field is hashed separately so that padding bytes of structures are not included*/
+	uint32_t hash = RTE_HASH_INITIAL_VALUE;
+	Object_Property_t *PropertyPtr = &PlayerSpaceship.Object_Property;
+
+	hash = RTE_hash_data(hash,&score,sizeof(score));
+	hash = RTE_hash_data(hash,&currentWave,sizeof(currentWave));
+	hash = RTE_hash_data(hash,&shootCooldown,sizeof(shootCooldown));
+	hash = RTE_hash_data(hash,&randomState,sizeof(randomState));
+
+	hash = RTE_hash_data(hash,&PropertyPtr->x,sizeof(PropertyPtr->x));
+	hash = RTE_hash_data(hash,&PropertyPtr->y,sizeof(PropertyPtr->y));
+	hash = RTE_hash_data(hash,&PropertyPtr->xFraction,sizeof(PropertyPtr->xFraction));
+	hash = RTE_hash_data(hash,&PropertyPtr->yFraction,sizeof(PropertyPtr->yFraction));
+	hash = RTE_hash_data(hash,&PropertyPtr->dx,sizeof(PropertyPtr->dx));
+	hash = RTE_hash_data(hash,&PropertyPtr->dy,sizeof(PropertyPtr->dy));
+	hash = RTE_hash_data(hash,&PropertyPtr->headingDir,sizeof(PropertyPtr->headingDir));
+	hash = RTE_hash_data(hash,&PropertyPtr->aliveFlag,sizeof(PropertyPtr->aliveFlag));
+
+	hash = RTE_hash_entity_store(hash,&AsteroidStore);
+	hash = RTE_hash_entity_store(hash,&RocketStore);
+
+	for(uint16_t position = 0;position < RocketStore.total;position++){
+		uint16_t index = RocketStore.live[position];
+		hash = RTE_hash_data(hash,&rocketLifeSpan[index],sizeof(rocketLifeSpan[index]));
 	}
 
-	for(uint8_t count = 0; count < RocketVect.total;){
-		vector_delete(&RocketVect,count);
+	return hash;
+}
+
+/***********************************************************************
+Public function: Seed game random number generator (same seed always give same asteroids)
+***********************************************************************/
+void RTE_seed_random(uint32_t seed)
+{
+	/*xorshift32 state must not be 0*/
+	randomState = seed ? seed : 1;
+}
+
+/***********************************************************************
+Public function: Read joystick direction and buttons
+***********************************************************************/
+void RTE_read_input(RTE_Input_t *InputPtr)
+{
+	Button_Event_t Event;
+	Joystick_Vector_t Vector;
+	uint8_t pressedButtons = 0;
+
+	joystick_read_vector(JOYSTICK_ADC,JOYSTICK_X_ADC_CHANNEL,JOYSTICK_Y_ADC_CHANNEL,&Vector);
+
+	if(Vector.magnitude){
+		/*nearest heading (angle wrap around at a turn) and level rounded up, so that any deflection out of dead zone thrust*/
+		InputPtr->stickHeading = (uint16_t)(Vector.angle + FAST_MATH_ANGLE_TURN/(2*RTE_NUM_OF_HEADINGS))/(FAST_MATH_ANGLE_TURN/RTE_NUM_OF_HEADINGS);
+		InputPtr->stickLevel = ((uint32_t)Vector.magnitude*RTE_NUM_OF_THRUST_LEVELS + JOYSTICK_VECTOR_ONE - 1)/JOYSTICK_VECTOR_ONE;
+		InputPtr->joystickDirection = octantDirection[((InputPtr->stickHeading + RTE_NUM_OF_HEADINGS/16)/(RTE_NUM_OF_HEADINGS/8)) % 8];
+	}else{
+		InputPtr->stickHeading = 0;
+		InputPtr->stickLevel = 0;
+		InputPtr->joystickDirection = JS_DIR_CENTERED;
+	}
+
+	/*button pressed and released since last frame is pressed in this frame*/
+	while(button_get_event(&Event)){
+		uint8_t buttonBit = (Event.button == shootButton) ? RTE_BUTTON_SHOOT : RTE_BUTTON_THRUST;
+
+#ifdef RTE_MEASURE_LATENCY
+		latency_probe_consume_edge(&InputLatency,Event.timestamp);
+#endif
+
+		if(Event.type == BUTTON_PRESSED){
+			heldButtons |= buttonBit;
+			pressedButtons |= buttonBit;
+		}else{
+			heldButtons &= ~buttonBit;
+		}
 	}
 
-	for(uint8_t count = 0;count < RTE_ASTEROID_BUFFER_SIZE;count++){
-		Asteroid[count].Object_Property.aliveFlag = RTE_ALIVE_FALSE;
+	InputPtr->buttons = heldButtons | pressedButtons;
+}
+
+/***********************************************************************
+Public function: Drop button events, held buttons must be pressed again
+***********************************************************************/
+void RTE_flush_input(void)
+{
+	button_flush_events();
+	heldButtons = 0;
+}
+
+/***********************************************************************
+Public function: Set input used by game engine until next call
+***********************************************************************/
+void RTE_set_input(const RTE_Input_t *InputPtr)
+{
+	frameInput = *InputPtr;
+}
+
+/***********************************************************************
+Public function: Encode input of a frame into input log value
+***********************************************************************/
+uint16_t RTE_encode_input(const RTE_Input_t *InputPtr)
+{
+	uint16_t value = InputPtr->joystickDirection + RTE_NUM_OF_JS_DIR*(InputPtr->buttons & (RTE_BUTTON_SHOOT | RTE_BUTTON_THRUST));
+
+	/*full deflection along @JS_DIR is logged without auxiliary byte, as digital joystick was*/
+	if(InputPtr->stickLevel && !((InputPtr->stickLevel == RTE_NUM_OF_THRUST_LEVELS) && (InputPtr->stickHeading == directionHeading[InputPtr->joystickDirection]))){
+		value |= (uint16_t)((InputPtr->stickHeading << 3) | InputPtr->stickLevel) << 8;
 	}
 
-	for(uint8_t count = 0;count < RTE_ROCKET_BUFFER_SIZE;count++){
-		Rocket[count].Object_Property.aliveFlag = RTE_ALIVE_FALSE;
+	return value;
+}
+
+/***********************************************************************
+Public function: Decode input log value into input of a frame
+***********************************************************************/
+void RTE_decode_input(uint16_t value, RTE_Input_t *InputPtr)
+{
+	uint8_t aux = value >> 8;
+
+	InputPtr->joystickDirection = (value & 0xFF) % RTE_NUM_OF_JS_DIR;
+	InputPtr->buttons = (value & 0xFF) / RTE_NUM_OF_JS_DIR;
+
+	if(aux){
+		InputPtr->stickHeading = aux >> 3;
+		InputPtr->stickLevel = aux & 0x07;
+	}else if(InputPtr->joystickDirection != JS_DIR_CENTERED){
+		InputPtr->stickHeading = directionHeading[InputPtr->joystickDirection];
+		InputPtr->stickLevel = RTE_NUM_OF_THRUST_LEVELS;
+	}else{
+		InputPtr->stickHeading = 0;
+		InputPtr->stickLevel = 0;
 	}
 }
 
@@ -577,12 +905,32 @@ void RTE_wrap_cordinate (int16_t *xPtr, int16_t *yPtr)
 	}
 }
 
+/***********************************************************************
+Private function: Move object by its velocity, keeping sub-pixel part of position
+***********************************************************************/
+void RTE_move_object (Object_Property_t *PropertyPtr)
+{
+	RTE_Real_t xPosition = PropertyPtr->xFraction + PropertyPtr->dx;
+	RTE_Real_t yPosition = PropertyPtr->yFraction + PropertyPtr->dy;
+
+	/*whole pixels go to x,y and remainder (always positive) stay in fraction*/
+	int16_t xStep = RTE_REAL_FLOOR(xPosition);
+	int16_t yStep = RTE_REAL_FLOOR(yPosition);
+
+	PropertyPtr->xFraction = xPosition - RTE_REAL(xStep);
+	PropertyPtr->yFraction = yPosition - RTE_REAL(yStep);
+
+	PropertyPtr->x += xStep;
+	PropertyPtr->y += yStep;
+	RTE_wrap_cordinate(&PropertyPtr->x,&PropertyPtr->y);
+}
+
 /***********************************************************************
 Private function: Random object initial x value
 ***********************************************************************/
 int16_t RTE_random_x (void)
 {
-	return (RNG_get() & 0x1FF) % (ILI9341_config.width +1);
+	return (RTE_random_get() & 0x1FF) % (ILI9341_config.width +1);
 }
 
 /***********************************************************************
@@ -590,7 +938,7 @@ Private function: Random object initial y value
 ***********************************************************************/
 int16_t RTE_random_y (void)
 {
-	return (RNG_get() & 0xFF) % (ILI9341_config.height +1);
+	return (RTE_random_get() & 0xFF) % (ILI9341_config.height +1);
 }
 
 
@@ -599,24 +947,39 @@ Private function: Randomize sign (minus or plus)
 ***********************************************************************/
 int8_t RTE_random_sign (void)
 {
-	uint8_t temp = (RNG_get() & 0x0F) % 9;
+	uint8_t temp = (RTE_random_get() & 0x0F) % 9;
 	if(temp < 5){
 		return -1;
 	}
 	return 1;
 }
 
+/***********************************************************************
+Private function: Get next number of game random number generator (xorshift32)
+***********************************************************************/
+uint32_t RTE_random_get (void)
+{
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+
+	return randomState;
+}
+
 /***********************************************************************
 Private function: Update player spaceship direction
 ***********************************************************************/
 void RTE_update_player_spaceship_direction (Space_Object_t *PlayerSpaceShipPtr)
 {
-	uint8_t direction = 0;
-	direction = joystick_read_direction (JOYSTICK_ADC,JOYSTICK_X_ADC_CHANNEL, JOYSTICK_Y_ADC_CHANNEL);
+	uint8_t direction = frameInput.joystickDirection;
 	
 	if (direction == JS_DIR_CENTERED){
 		return;
-	}else if (direction == JS_DIR_UP){
+	}
+	
+	playerHeading = frameInput.stickHeading;
+	
+	if (direction == JS_DIR_UP){
 		
 		PlayerSpaceShipPtr->Object_Property.headingDir = RTE_HEADING_DIR_N;
 		
@@ -696,76 +1059,48 @@ Private function: Update player spaceship position
 void RTE_update_player_spaceship_position (Space_Object_t *PlayerSpaceShipPtr)
 {
 	
-	if(!THRUST_BUTTON_READ){
+	if(frameInput.buttons & RTE_BUTTON_THRUST){
 		
-		int8_t ddx = 0;
-		int8_t ddy = 0;
+		uint8_t level = frameInput.stickLevel ? frameInput.stickLevel : RTE_NUM_OF_THRUST_LEVELS;
 
 		PROTOBOARD_BLUE_LED_ON;
 		
-		speaker_play_sound(spaceship_thruster,sizeof(spaceship_thruster)/sizeof(spaceship_thruster[0]));
-
-		if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_N){
-			ddx	= 0;
-			ddy = -RTE_PLAYER_BASE_ACCELERATION;
-			RTE_accelerate_player_spaceship(PlayerSpaceShipPtr,ddx,ddy);
-		}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_S){
-			ddx += 0;
-			ddy += RTE_PLAYER_BASE_ACCELERATION;
-			RTE_accelerate_player_spaceship(PlayerSpaceShipPtr,ddx,ddy);
-		}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_E){
-			ddx += RTE_PLAYER_BASE_ACCELERATION;
-			ddy += 0;
-			RTE_accelerate_player_spaceship(PlayerSpaceShipPtr,ddx,ddy);
-		}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_W){
-			ddx += -RTE_PLAYER_BASE_ACCELERATION;
-			ddy += 0;
-			RTE_accelerate_player_spaceship(PlayerSpaceShipPtr,ddx,ddy);
-		}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_NE){
-			ddx += RTE_PLAYER_BASE_ACCELERATION;
-			ddy += -RTE_PLAYER_BASE_ACCELERATION;
-			RTE_accelerate_player_spaceship(PlayerSpaceShipPtr,ddx,ddy);
-		}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_NW){
-			ddx += -RTE_PLAYER_BASE_ACCELERATION;
-			ddy += -RTE_PLAYER_BASE_ACCELERATION;
-			RTE_accelerate_player_spaceship(PlayerSpaceShipPtr,ddx,ddy);
-		}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_SE){
-			ddx += RTE_PLAYER_BASE_ACCELERATION;
-			ddy += RTE_PLAYER_BASE_ACCELERATION;
-			RTE_accelerate_player_spaceship(PlayerSpaceShipPtr,ddx,ddy);
-		}else if(PlayerSpaceShipPtr->Object_Property.headingDir == RTE_HEADING_DIR_SW){
-			ddx += -RTE_PLAYER_BASE_ACCELERATION;
-			ddy += RTE_PLAYER_BASE_ACCELERATION;
-			RTE_accelerate_player_spaceship(PlayerSpaceShipPtr,ddx,ddy);
+		/*thruster keep looping on its voice while button is held (started again if its voice was stolen)*/
+		if(speaker_find_voice(&spaceship_thruster) == SPEAKER_NO_VOICE){
+			speaker_play_ADPCM_voice(&spaceship_thruster,RTE_THRUSTER_VOLUME,RTE_SOUND_PRIORITY_THRUSTER,SPEAKER_PLAY_LOOP);
 		}
+
+		/*thrust along heading of spaceship, proportional to deflection of joystick (full thrust when joystick is released)*/
+		RTE_accelerate_player_spaceship(PlayerSpaceShipPtr,headingThrustX[playerHeading]*RTE_PLAYER_BASE_ACCELERATION*level/RTE_NUM_OF_THRUST_LEVELS,
+		headingThrustY[playerHeading]*RTE_PLAYER_BASE_ACCELERATION*level/RTE_NUM_OF_THRUST_LEVELS);
 	
 	}else{
 		
 		PROTOBOARD_BLUE_LED_OFF;
 
-		PlayerSpaceShipPtr->Object_Property.x += PlayerSpaceShipPtr->Object_Property.dx;
-		PlayerSpaceShipPtr->Object_Property.y += PlayerSpaceShipPtr->Object_Property.dy;
-		RTE_wrap_cordinate(&PlayerSpaceShipPtr->Object_Property.x,&PlayerSpaceShipPtr->Object_Property.y);
+		RTE_stop_thruster_sound();
+
+		RTE_move_object(&PlayerSpaceShipPtr->Object_Property);
 		
 		/*decelerate player spaceship*/
 		
-		if(fabs(PlayerSpaceShipPtr->Object_Property.dx) > RTE_PLAYER_BASE_DECELERATION){ 
+		if(RTE_REAL_ABS(PlayerSpaceShipPtr->Object_Property.dx) > RTE_REAL(RTE_PLAYER_BASE_DECELERATION)){ 
 			
 			if(PlayerSpaceShipPtr->Object_Property.dx > 0){
-				PlayerSpaceShipPtr->Object_Property.dx -= RTE_PLAYER_BASE_DECELERATION;
+				PlayerSpaceShipPtr->Object_Property.dx -= RTE_REAL(RTE_PLAYER_BASE_DECELERATION);
 			}else if(PlayerSpaceShipPtr->Object_Property.dx < 0){
-				PlayerSpaceShipPtr->Object_Property.dx += RTE_PLAYER_BASE_DECELERATION;
+				PlayerSpaceShipPtr->Object_Property.dx += RTE_REAL(RTE_PLAYER_BASE_DECELERATION);
 			}
 		}else{
 			PlayerSpaceShipPtr->Object_Property.dx = 0;
 		}
 		
-		if(fabs(PlayerSpaceShipPtr->Object_Property.dy) > RTE_PLAYER_BASE_DECELERATION){		
+		if(RTE_REAL_ABS(PlayerSpaceShipPtr->Object_Property.dy) > RTE_REAL(RTE_PLAYER_BASE_DECELERATION)){		
 						
 			if(PlayerSpaceShipPtr->Object_Property.dy > 0){
-				PlayerSpaceShipPtr->Object_Property.dy -= RTE_PLAYER_BASE_DECELERATION;
+				PlayerSpaceShipPtr->Object_Property.dy -= RTE_REAL(RTE_PLAYER_BASE_DECELERATION);
 			}else if(PlayerSpaceShipPtr->Object_Property.dy < 0){
-				PlayerSpaceShipPtr->Object_Property.dy += RTE_PLAYER_BASE_DECELERATION;
+				PlayerSpaceShipPtr->Object_Property.dy += RTE_REAL(RTE_PLAYER_BASE_DECELERATION);
 			}
 		}else{
 			PlayerSpaceShipPtr->Object_Property.dy = 0;
@@ -776,64 +1111,110 @@ void RTE_update_player_spaceship_position (Space_Object_t *PlayerSpaceShipPtr)
 }
 
 /***********************************************************************
-Private function: Detect collision between 2 object using AABB algorithm
+Private function: Detect collision between object in asteroid grid (asteroid or player spaceship) and given area using AABB algorithm
+(object going off screen continue on the opposite side)
 ***********************************************************************/
-uint8_t RTE_collision_detect (Space_Object_t *Object1Ptr, Space_Object_t *Object2Ptr)
+uint8_t RTE_collision_detect (entity_store *AsteroidStorePtr, uint16_t gridId, Space_Object_t *PlayerSpaceShipPtr, int16_t x, int16_t y, uint16_t width, uint16_t height)
 {
-	int16_t Obj1BottomRight_X = Object1Ptr->Object_Property.x + Object1Ptr->Object_Image.imageWidth;
-	int16_t Obj1BottomRight_Y = Object1Ptr->Object_Property.y + Object1Ptr->Object_Image.imageHeight;
-	
-	int16_t Obj2BottomRight_X = Object2Ptr->Object_Property.x + Object2Ptr->Object_Image.imageWidth;
-	int16_t Obj2BottomRight_Y = Object2Ptr->Object_Property.y + Object2Ptr->Object_Image.imageHeight;
-	
-	if (Object1Ptr->Object_Property.x < Obj2BottomRight_X 
-		&& Object2Ptr->Object_Property.x < Obj1BottomRight_X
-		&& Object1Ptr->Object_Property.y < Obj2BottomRight_Y
-		&& Object2Ptr->Object_Property.y < Obj1BottomRight_Y){
-						
+	if(gridId == RTE_PLAYER_GRID_ID){
+		if(spatial_grid_overlap(&asteroidGrid,PlayerSpaceShipPtr->Object_Property.x,PlayerSpaceShipPtr->Object_Property.y,
+			PlayerSpaceShipPtr->Object_Image.imageWidth,PlayerSpaceShipPtr->Object_Image.imageHeight,x,y,width,height) == SPATIAL_GRID_OVERLAP_TRUE){
+			return RTE_COLLISION_TRUE;
+		}
+
+		return RTE_COLLISION_FALSE;
+	}
+
+	if(entity_store_overlap(AsteroidStorePtr,gridId,x,y,width,height) == ENTITY_STORE_OVERLAP_TRUE){
 		return RTE_COLLISION_TRUE;
-	}	
+	}
 
 	return RTE_COLLISION_FALSE;
 }
 
 /***********************************************************************
-Private function: Delete dead rocket
+Private function: Sort live asteroids into asteroid grid (asteroid id is its index in asteroid store)
 ***********************************************************************/
-void RTE_delete_dead_rocket (Space_Object_t *RocketPtr)
+void RTE_build_asteroid_grid (entity_store *AsteroidStorePtr)
 {
-		if((RocketPtr->Object_Property.aliveFlag == RTE_ALIVE_FALSE) && (RocketPtr->Object_Image.clearWhenDead == RTE_DEAD_OBJECT_UNCLEARED)){
-			ILI9341_draw_bitmap_w_background(RocketPtr->Object_Property.x,RocketPtr->Object_Property.y,
-			RocketPtr->Object_Image.image,RocketPtr->Object_Image.imageWidth,
-			RocketPtr->Object_Image.imageHeight,ILI9341_BLACK,ILI9341_BLACK);
-			RocketPtr->Object_Image.clearWhenDead = RTE_DEAD_OBJECT_CLEARED;
-		}
+	spatial_grid_clear(&asteroidGrid);
+
+	for(uint16_t position = 0;position < AsteroidStorePtr->total;position++){
+		uint16_t index = AsteroidStorePtr->live[position];
+		spatial_grid_insert(&asteroidGrid,index,entity_store_get_x(AsteroidStorePtr,index),entity_store_get_y(AsteroidStorePtr,index),
+		AsteroidStorePtr->width[index],AsteroidStorePtr->height[index]);
+	}
 }
 
+/***********************************************************************
+Private function: Find ids of objects sharing a grid cell with given area (result is stored in gridQueryResult)
+***********************************************************************/
+uint16_t RTE_query_asteroid_grid (int16_t x, int16_t y, uint16_t width, uint16_t height)
+{
+	return spatial_grid_query(&asteroidGrid,x,y,width,height,gridQueryResult,sizeof(gridQueryResult)/sizeof(gridQueryResult[0]));
+}
 
 /***********************************************************************
-Private function: Delete dead rocket
+Private function: Add bytes to FNV-1a hash
 ***********************************************************************/
-void RTE_delete_dead_asteroid (Space_Object_t *AsteroidPtr)
+uint32_t RTE_hash_data (uint32_t hash, const void *dataPtr, uint32_t size)
 {
-		if((AsteroidPtr->Object_Property.aliveFlag == RTE_ALIVE_FALSE) && (AsteroidPtr->Object_Image.clearWhenDead == RTE_DEAD_OBJECT_UNCLEARED)){
-			ILI9341_draw_bitmap_w_background(AsteroidPtr->Object_Property.x,AsteroidPtr->Object_Property.y,
-			AsteroidPtr->Object_Image.image,AsteroidPtr->Object_Image.imageWidth,
-			AsteroidPtr->Object_Image.imageHeight,ILI9341_BLACK,ILI9341_BLACK);
-			AsteroidPtr->Object_Image.clearWhenDead = RTE_DEAD_OBJECT_CLEARED;
-		}
+	const uint8_t *bytePtr = dataPtr;
+
+	for(uint32_t i = 0; i < size; i++){
+		hash ^= bytePtr[i];
+		hash *= RTE_HASH_PRIME;
+	}
+
+	return hash;
+}
+
+/***********************************************************************
+Private function: Add index and fields of every live object in entity store to hash
+***********************************************************************/
+uint32_t RTE_hash_entity_store (uint32_t hash, entity_store *StorePtr)
+{
+	for(uint16_t position = 0;position < StorePtr->total;position++){
+		uint16_t index = StorePtr->live[position];
+		hash = RTE_hash_data(hash,&index,sizeof(index));
+		hash = RTE_hash_data(hash,&StorePtr->x[index],sizeof(StorePtr->x[index]));
+		hash = RTE_hash_data(hash,&StorePtr->y[index],sizeof(StorePtr->y[index]));
+		hash = RTE_hash_data(hash,&StorePtr->dx[index],sizeof(StorePtr->dx[index]));
+		hash = RTE_hash_data(hash,&StorePtr->dy[index],sizeof(StorePtr->dy[index]));
+		hash = RTE_hash_data(hash,&StorePtr->kind[index],sizeof(StorePtr->kind[index]));
+	}
+
+	return hash;
+}
+
+/***********************************************************************
+Private function: Delete dead rocket (mark its area to be cleared and remove it from rocket store)
+***********************************************************************/
+void RTE_delete_dead_rocket (entity_store *RocketStorePtr, uint16_t index)
+{
+	RTE_erase_object(&RocketRender[index]);
+	entity_store_remove(RocketStorePtr,index);
+}
+
+/***********************************************************************
+Private function: Delete dead asteroid (mark its area to be cleared and remove it from asteroid store)
+***********************************************************************/
+void RTE_delete_dead_asteroid (entity_store *AsteroidStorePtr, uint16_t index)
+{
+	RTE_erase_object(&AsteroidRender[index]);
+	entity_store_remove(AsteroidStorePtr,index);
 }
 
 /***********************************************************************
 Private function: Accelerate player spaceship
 ***********************************************************************/
-void RTE_accelerate_player_spaceship (Space_Object_t *PlayerSpaceShipPtr, int8_t ddx, int8_t ddy)
+void RTE_accelerate_player_spaceship (Space_Object_t *PlayerSpaceShipPtr, RTE_Real_t ddx, RTE_Real_t ddy)
 {
-	if(fabs(PlayerSpaceShipPtr->Object_Property.dx) < RTE_PLAYER_MAX_SPEED){
+	if(RTE_REAL_ABS(PlayerSpaceShipPtr->Object_Property.dx) < RTE_REAL(RTE_PLAYER_MAX_SPEED)){
 		PlayerSpaceShipPtr->Object_Property.dx += ddx;
 	}
 
-	if(fabs(PlayerSpaceShipPtr->Object_Property.dy) < RTE_PLAYER_MAX_SPEED){
+	if(RTE_REAL_ABS(PlayerSpaceShipPtr->Object_Property.dy) < RTE_REAL(RTE_PLAYER_MAX_SPEED)){
 		PlayerSpaceShipPtr->Object_Property.dy += ddy;
 	}
 }
@@ -841,47 +1222,69 @@ void RTE_accelerate_player_spaceship (Space_Object_t *PlayerSpaceShipPtr, int8_t
 /***********************************************************************
 Private function: Create 2 medium size asteroids
 ***********************************************************************/
-void RTE_create_medium_asteroid (vector *AsteroidVectPtr, Space_Object_t *DeadAsteroidPtr)
+void RTE_create_medium_asteroid (entity_store *AsteroidStorePtr, int16_t deadAsteroid_x, int16_t deadAsteroid_y)
 {
-	Space_Object_t *AsteroidPtr = Asteroid;
-
-	uint8_t deadAsteroid_x =  DeadAsteroidPtr->Object_Property.x;
-	uint8_t deadAsteroid_y =  DeadAsteroidPtr->Object_Property.y;
-
-	RNG_init();
+	uint16_t index = 0;
+	RTE_Real_t dx = 0;
+	RTE_Real_t dy = 0;
 
 	for(uint8_t j =0; j < 2; j++){
 
-		/*find element in asteroid array that is unused or contain dead asteroid to overwrite*/
-		while((AsteroidPtr->Object_Property.aliveFlag != RTE_ALIVE_FALSE)	&& (AsteroidPtr->Object_Property.aliveFlag != RTE_ALIVE_UNSET)){
-			AsteroidPtr++;
-			if(AsteroidPtr - Asteroid > (RTE_ASTEROID_BUFFER_SIZE-1)){
-				return;
-			}
-		}
-
-		vector_add(AsteroidVectPtr,AsteroidPtr);
-		AsteroidPtr->Object_Property.aliveFlag = RTE_ALIVE_TRUE;
-		AsteroidPtr->Object_Property.asteroidSize = RTE_ASTEROID_SIZE_M;
-		AsteroidPtr->Object_Image.image = asteroid_medium_bmp;
-		AsteroidPtr->Object_Image.imageWidth = RTE_ASTEROID_MEDIUM_BMP_W;
-		AsteroidPtr->Object_Image.imageHeight = RTE_ASTEROID_MEDIUM_BMP_H;
-		AsteroidPtr->Object_Image.clearWhenDead = RTE_DEAD_OBJECT_UNCLEARED;
+		dx = RTE_REAL(RTE_random_sign()*2);
+		dy = RTE_REAL(RTE_random_sign()*2);
 
+		/*dead asteroid 's index may be reused*/
 		if(j == 0){
-			AsteroidPtr->Object_Property.dx = RTE_random_sign()*2;
-			AsteroidPtr->Object_Property.dy = RTE_random_sign()*2;
-			AsteroidPtr->Object_Property.x = deadAsteroid_x + RTE_ASTEROID_MEDIUM_BMP_W;
-			AsteroidPtr->Object_Property.y = deadAsteroid_y + RTE_ASTEROID_MEDIUM_BMP_H;
+			index = entity_store_add(AsteroidStorePtr,RTE_ASTEROID_SIZE_M,deadAsteroid_x + RTE_ASTEROID_MEDIUM_BMP_W,deadAsteroid_y + RTE_ASTEROID_MEDIUM_BMP_H,
+			RTE_REAL_TO_Q16(dx),RTE_REAL_TO_Q16(dy),RTE_ASTEROID_MEDIUM_BMP_W,RTE_ASTEROID_MEDIUM_BMP_H);
 		}else if(j == 1){
-			AsteroidPtr->Object_Property.dx = RTE_random_sign()*2;
-			AsteroidPtr->Object_Property.dy = RTE_random_sign()*2;
-			AsteroidPtr->Object_Property.x = deadAsteroid_x;
-			AsteroidPtr->Object_Property.y = deadAsteroid_y;
+			index = entity_store_add(AsteroidStorePtr,RTE_ASTEROID_SIZE_M,deadAsteroid_x,deadAsteroid_y,
+			RTE_REAL_TO_Q16(dx),RTE_REAL_TO_Q16(dy),RTE_ASTEROID_MEDIUM_BMP_W,RTE_ASTEROID_MEDIUM_BMP_H);
 		}
+
+		if(index == ENTITY_STORE_NONE){
+			break;
+		}
+
+		AsteroidRender[index].drawn = RTE_DRAWN_FALSE;
+
+		/*rockets checked later in this frame can hit new asteroid (grid may still hold dead asteroid which had this index, it is checked against store)*/
+		spatial_grid_insert(&asteroidGrid,index,entity_store_get_x(AsteroidStorePtr,index),entity_store_get_y(AsteroidStorePtr,index),
+		AsteroidStorePtr->width[index],AsteroidStorePtr->height[index]);
 	}
+}
+
+/***********************************************************************
+Private function: Draw start screen (called once per framebuffer strip)
+***********************************************************************/
+void RTE_draw_start_screen(void)
+{
+	RTE_display_black_background();
+	ILI9341_draw_bitmap(48,8,earth_bmp,225,225,ILI9341_DARKCYAN);
+	ILI9341_put_string(40,60,"RETURN TO EARTH",&TM_Font_16x26,ILI9341_WHITE);
+	ILI9341_put_string(20,220,"Press shoot button to start",&TM_Font_11x18,ILI9341_WHITE);	
+}
+
+/***********************************************************************
+Private function: Draw game over screen (called once per framebuffer strip)
+***********************************************************************/
+void RTE_draw_game_over_screen(void)
+{
+	RTE_display_black_background();
+	ILI9341_draw_bitmap(48,0,meteor_bmp,225,225,ILI9341_YELLOW);
+	ILI9341_put_string(10,200,"Uh oh,your space ship burned down.Want to try again?",&TM_Font_11x18,ILI9341_WHITE);
+}
 
-	RNG_deinit();
+/***********************************************************************
+Private function: Stop thruster sound looping on speaker
+***********************************************************************/
+void RTE_stop_thruster_sound (void)
+{
+	uint8_t voice = speaker_find_voice(&spaceship_thruster);
+
+	if(voice != SPEAKER_NO_VOICE){
+		speaker_stop_voice(voice);
+	}
 }
 
 /***********************************************************************
@@ -890,6 +1293,143 @@ Private function: Display black background
 void RTE_display_black_background(void)
 {
 	ILI9341_fill_display(ILI9341_BLACK);
+
+	/*nothing left on screen to erase*/
+	dirty_rect_list_clear(&eraseRectList);
+}
+
+/***********************************************************************
+Private function: Get player spaceship as seen by renderer
+***********************************************************************/
+Object_Sprite_t RTE_get_player_sprite (Space_Object_t *PlayerSpaceShipPtr)
+{
+	Object_Sprite_t Sprite;
+
+	Sprite.x = PlayerSpaceShipPtr->Object_Property.x;
+	Sprite.y = PlayerSpaceShipPtr->Object_Property.y;
+	Sprite.image = PlayerSpaceShipPtr->Object_Image.image;
+	Sprite.imageWidth = PlayerSpaceShipPtr->Object_Image.imageWidth;
+	Sprite.imageHeight = PlayerSpaceShipPtr->Object_Image.imageHeight;
+	Sprite.color = RTE_PLAYER_SPACESHIP_COLOR;
+	Sprite.Object_Render = &PlayerSpaceShipPtr->Object_Render;
+
+	return Sprite;
+}
+
+/***********************************************************************
+Private function: Get asteroid as seen by renderer (image is picked from asteroid size)
+***********************************************************************/
+Object_Sprite_t RTE_get_asteroid_sprite (entity_store *AsteroidStorePtr, uint16_t index)
+{
+	Object_Sprite_t Sprite;
+
+	Sprite.x = entity_store_get_x(AsteroidStorePtr,index);
+	Sprite.y = entity_store_get_y(AsteroidStorePtr,index);
+	Sprite.image = asteroidImage[AsteroidStorePtr->kind[index]];
+	Sprite.imageWidth = AsteroidStorePtr->width[index];
+	Sprite.imageHeight = AsteroidStorePtr->height[index];
+	Sprite.color = RTE_ASTEROID_COLOR;
+	Sprite.Object_Render = &AsteroidRender[index];
+
+	return Sprite;
+}
+
+/***********************************************************************
+Private function: Get rocket as seen by renderer (image is picked from rocket heading direction)
+***********************************************************************/
+Object_Sprite_t RTE_get_rocket_sprite (entity_store *RocketStorePtr, uint16_t index)
+{
+	Object_Sprite_t Sprite;
+
+	Sprite.x = entity_store_get_x(RocketStorePtr,index);
+	Sprite.y = entity_store_get_y(RocketStorePtr,index);
+	Sprite.image = rocketImage[RocketStorePtr->kind[index]];
+	Sprite.imageWidth = RocketStorePtr->width[index];
+	Sprite.imageHeight = RocketStorePtr->height[index];
+	Sprite.color = RTE_ROCKET_COLOR;
+	Sprite.Object_Render = &RocketRender[index];
+
+	return Sprite;
+}
+
+/***********************************************************************
+Private function: Draw object at its current position and remember what was drawn
+***********************************************************************/
+void RTE_draw_object (Object_Sprite_t *SpritePtr)
+{
+	Object_Render_t *RenderPtr = SpritePtr->Object_Render;
+
+	ILI9341_draw_bitmap_w_background(SpritePtr->x,SpritePtr->y,SpritePtr->image,SpritePtr->imageWidth,
+	SpritePtr->imageHeight,SpritePtr->color,RTE_BACKGROUND_COLOR);
+
+	RenderPtr->drawnArea.x = SpritePtr->x;
+	RenderPtr->drawnArea.y = SpritePtr->y;
+	RenderPtr->drawnArea.width = SpritePtr->imageWidth;
+	RenderPtr->drawnArea.height = SpritePtr->imageHeight;
+	RenderPtr->drawnImage = SpritePtr->image;
+	RenderPtr->drawn = RTE_DRAWN_TRUE;
+
+	pixelsPushedInFrame += dirty_rect_area(&RenderPtr->drawnArea);
+}
+
+/***********************************************************************
+Private function: Mark area where object was last drawn to be cleared in next RTE_draw_frame
+***********************************************************************/
+void RTE_erase_object (Object_Render_t *RenderPtr)
+{
+	if(RenderPtr->drawn == RTE_DRAWN_TRUE){
+		dirty_rect_add(&eraseRectList,RenderPtr->drawnArea.x,RenderPtr->drawnArea.y,
+		RenderPtr->drawnArea.width,RenderPtr->drawnArea.height);
+		RenderPtr->drawn = RTE_DRAWN_FALSE;
+	}
+}
+
+/***********************************************************************
+Private function: Check whether object moved or changed image since it was last drawn
+***********************************************************************/
+uint8_t RTE_object_changed (Object_Sprite_t *SpritePtr)
+{
+	Object_Render_t *RenderPtr = SpritePtr->Object_Render;
+
+	if(RenderPtr->drawn != RTE_DRAWN_TRUE
+		|| RenderPtr->drawnArea.x != SpritePtr->x
+		|| RenderPtr->drawnArea.y != SpritePtr->y
+		|| RenderPtr->drawnImage != SpritePtr->image){
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+/***********************************************************************
+Private function: Fill area with color, area going off screen is continued on the opposite side
+***********************************************************************/
+void RTE_fill_area (const dirty_rect *AreaPtr, uint16_t color)
+{
+	uint16_t width = ILI9341_config.width;
+	uint16_t height = ILI9341_config.height;
+
+	/*area x,y is always inside screen, so at most 1 extra piece on each axis*/
+	uint16_t firstWidth = (AreaPtr->x + AreaPtr->width > width) ? width - AreaPtr->x : AreaPtr->width;
+	uint16_t firstHeight = (AreaPtr->y + AreaPtr->height > height) ? height - AreaPtr->y : AreaPtr->height;
+	uint16_t restWidth = AreaPtr->width - firstWidth;
+	uint16_t restHeight = AreaPtr->height - firstHeight;
+
+	ILI9341_draw_filled_rectangle(AreaPtr->x,AreaPtr->y,AreaPtr->x + firstWidth - 1,AreaPtr->y + firstHeight - 1,color);
+
+	if(restWidth){
+		ILI9341_draw_filled_rectangle(0,AreaPtr->y,restWidth - 1,AreaPtr->y + firstHeight - 1,color);
+	}
+
+	if(restHeight){
+		ILI9341_draw_filled_rectangle(AreaPtr->x,0,AreaPtr->x + firstWidth - 1,restHeight - 1,color);
+	}
+
+	if(restWidth && restHeight){
+		ILI9341_draw_filled_rectangle(0,0,restWidth - 1,restHeight - 1,color);
+	}
+
+	pixelsPushedInFrame += dirty_rect_area(AreaPtr);
 }
 
 /***********************************************************************
@@ -898,11 +1438,30 @@ External function: Overwrite draw pixel function in ILI9341 driver library (in o
 void ILI9341_draw_pixel (int16_t x, int16_t y, uint16_t color)
 {
 	RTE_wrap_cordinate(&x,&y);
+
+	if(ILI9341_framebuffer_active_check()){
+		ILI9341_framebuffer_draw_pixel(x,y,color);
+		return;
+	}
+
 	ILI9341_set_active_area(x,x,y,y);
 	ILI9341_send_command(ILI9341_MEM_WRITE);
 	ILI9341_send_parameter_16_bits(color);
 }
 
+/***********************************************************************
+External function: Interrupt handler for shoot and thrust buttons
+***********************************************************************/
+void EXTI1_IRQHandler (void)
+{
+	button_intrpt_handler(SHOOT_BUTTON_PIN);
+}
+
+void EXTI3_IRQHandler (void)
+{
+	button_intrpt_handler(THRUST_BUTTON_PIN);
+}
+
 /***********************************************************************
 External function: Interrupt handler for TIM 6
 ***********************************************************************/
@@ -911,9 +1470,3 @@ void TIM6_DAC_IRQHandler (void)
 	TIM_intrpt_handler(TIM6);
 	frameUpdate = SET;
 }
-
-void TIM3_IRQHandler (void)
-{
-	TIM_intrpt_handler(TIM3);
-	shootButtonFirstTimeFlag = RTE_FIRST_TIME_TRUE;
-}
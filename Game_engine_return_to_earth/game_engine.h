@@ -19,7 +19,11 @@
 #include "../Device_drivers/inc/button.h"
 #include "../Device_drivers/inc/led.h"
 #include "../Device_drivers/inc/speaker.h"
-#include "vector.h"
+#include "entity_store.h"
+#include "dirty_rect.h"
+#include "spatial_grid.h"
+#include "input_log.h"
+#include "latency_probe.h"
 #include <math.h>
 #include <stdio.h>
 
@@ -28,11 +32,14 @@ Macro definition
 ***********************************************************************/
 #define SHOOT_BUTTON_PORT		GPIOC
 #define	SHOOT_BUTTON_PIN		GPIO_PIN_NO_1
-#define	SHOOT_BUTTON_READ		button_read(SHOOT_BUTTON_PORT,SHOOT_BUTTON_PIN)
 
 #define THRUST_BUTTON_PORT		GPIOC
 #define	THRUST_BUTTON_PIN		GPIO_PIN_NO_3
-#define	THRUST_BUTTON_READ		button_read(THRUST_BUTTON_PORT,THRUST_BUTTON_PIN)
+
+#define RTE_CLOCK_PROFILE		RCC_PROFILE_168_MHZ	/*refer to @RCC_CLOCK_PROFILE*/
+#define RTE_FRAME_RATE			30		/*frames per second (TIM6 update rate)*/
+#define RTE_AUDIO_SAMPLE_RATE	6176	/*speaker samples per second, rate sounds of the game are recorded at*/
+#define RTE_BUTTON_DEBOUNCE_US	5000	/*bounces of buttons are ignored for 5ms after press or release*/
 
 #define PROTOBOARD_RED_LED_PORT		GPIOC
 #define PROTOBOARD_RED_LED_PIN		GPIO_PIN_NO_0
@@ -58,6 +65,39 @@ Macro definition
 #define JOYSTICK_X_ADC_CHANNEL		ADC_CHANNEL_5
 #define JOYSTICK_Y_ADC_CHANNEL		ADC_CHANNEL_7
 
+/*
+*@RTE_FIXED_POINT_PHYSICS
+*Store object velocity and sub-pixel position as Q16.16 fixed point number (comment out, or build with -DRTE_FLOAT_PHYSICS, to use
+*single precision float). Both representation avoid double precision arithmetic which is emulated in software on cortex M4F
+*/
+#ifndef RTE_FLOAT_PHYSICS
+#define RTE_FIXED_POINT_PHYSICS	TRUE
+#endif
+
+/*
+*@RTE_MEASURE_LATENCY
+*Measure latency from button edge to last byte of frame which consumed it sent to ILI9341 (uncomment to enable, or build with
+*-DRTE_MEASURE_LATENCY). Latencies in DWT cycles are counted in InputLatency (see latency_probe.h), bins are RTE_LATENCY_BIN_US wide.
+*On target ILI9341_USE_TRANSFER_TIMESTAMP (ili9341.h) must be enabled too, time stamp of last byte of frame is read from ILI9341 driver
+*/
+/*#define RTE_MEASURE_LATENCY	TRUE*/
+#define RTE_LATENCY_BIN_US	250
+
+#ifdef RTE_FIXED_POINT_PHYSICS
+#define RTE_REAL_FRACTION_BITS	16
+#define RTE_REAL_ONE			((RTE_Real_t)1 << RTE_REAL_FRACTION_BITS)
+#define RTE_REAL(value)			((RTE_Real_t)((value) * RTE_REAL_ONE))
+#define RTE_REAL_FLOOR(value)	((int16_t)((value) >> RTE_REAL_FRACTION_BITS))
+#define RTE_REAL_ABS(value)		(((value) < 0) ? -(value) : (value))
+#define RTE_REAL_TO_Q16(value)	((int32_t)(value))
+#else
+#define RTE_REAL_ONE			1.0f
+#define RTE_REAL(value)			((RTE_Real_t)(value))
+#define RTE_REAL_FLOOR(value)	((int16_t)floorf(value))
+#define RTE_REAL_ABS(value)		fabsf(value)
+#define RTE_REAL_TO_Q16(value)	((int32_t)floorf((value) * 65536.0f))
+#endif
+
 #define RTE_PLAYER_INITIAL_SPEED		0
 #define RTE_PLAYER_BASE_ACCELERATION	1
 #define RTE_PLAYER_BASE_DECELERATION	0.1
@@ -124,8 +164,20 @@ Macro definition
 #define RTE_COLLISION_TRUE 		1
 #define RTE_COLLISION_FALSE 	0
 
-#define RTE_FIRST_TIME_TRUE 	1
-#define RTE_FIRST_TIME_FALSE	0
+/*frames between 2 rockets while shoot button is held (about 1 second)*/
+#define RTE_SHOOT_COOLDOWN_FRAMES	32
+
+/*
+*@RTE_SOUND_PRIORITY
+*Sound of higher priority steal speaker voice of lower one when every voice is busy
+*/
+#define RTE_SOUND_PRIORITY_THRUSTER		0
+#define RTE_SOUND_PRIORITY_ROCKET		1
+#define RTE_SOUND_PRIORITY_IMPACT		2
+#define RTE_SOUND_PRIORITY_EXPLODE		3
+
+/*thruster loop while thrust button is held, it is kept quieter than effects played over it*/
+#define RTE_THRUSTER_VOLUME		SPEAKER_VOLUME_HALF
 
 #define RTE_ASTEROID_BUFFER_SIZE 	15
 #define RTE_ROCKET_BUFFER_SIZE		3
@@ -134,14 +186,57 @@ Macro definition
 
 #define RTE_NUM_OF_WAVE	5
 
+#define RTE_PLAYER_SPACESHIP_COLOR	ILI9341_LIGHTGREY
+#define RTE_ASTEROID_COLOR			0xB3E7
+#define RTE_ROCKET_COLOR			ILI9341_LIGHTGREY
+#define RTE_BACKGROUND_COLOR		ILI9341_BLACK
+
+#define RTE_DRAWN_FALSE		0
+#define RTE_DRAWN_TRUE		1
+
+#define RTE_MAX_NUM_OF_OBJECT	(1 + RTE_ROCKET_BUFFER_SIZE + RTE_ASTEROID_BUFFER_SIZE)
+
+/*FNV-1a 32 bits hash of game state*/
+#define RTE_HASH_INITIAL_VALUE	2166136261UL
+#define RTE_HASH_PRIME			16777619UL
+
+/*
+*@RTE_BUTTON
+*Bits of pressed buttons in RTE_Input_t
+*/
+#define RTE_BUTTON_SHOOT	(1 << 0)
+#define RTE_BUTTON_THRUST	(1 << 1)
+
+/*number of @JS_DIR values, input of a frame is logged as direction + RTE_NUM_OF_JS_DIR*buttons (analog joystick in auxiliary byte)*/
+#define RTE_NUM_OF_JS_DIR	9
+
+/*analog joystick: heading of player spaceship in steps of 11.25 degree and thrust proportional to deflection, logged as heading*8 + level*/
+#define RTE_NUM_OF_HEADINGS			32
+#define RTE_NUM_OF_THRUST_LEVELS	7
+
+#if ((4*RTE_NUM_OF_JS_DIR - 1) > INPUT_LOG_MAX_INPUT)
+#error "input of a frame does not fit in input log"
+#endif
+
+/*id of player spaceship in asteroid grid (asteroid ids are 0 to RTE_ASTEROID_BUFFER_SIZE - 1)*/
+#define RTE_PLAYER_GRID_ID		RTE_ASTEROID_BUFFER_SIZE
+
 /***********************************************************************
 Structure definition
 ***********************************************************************/
+#ifdef RTE_FIXED_POINT_PHYSICS
+typedef int32_t RTE_Real_t;	/*Q16.16*/
+#else
+typedef float RTE_Real_t;
+#endif
+
 typedef struct{
-	int16_t x;
+	int16_t x;	/*pixel position, used for drawing and collision*/
 	int16_t y;
-	double dx;
-	double dy;
+	RTE_Real_t xFraction;	/*sub-pixel position, 0 to less than 1 pixel*/
+	RTE_Real_t yFraction;
+	RTE_Real_t dx;	/*pixel per frame*/
+	RTE_Real_t dy;
 	uint8_t headingDir;
 	uint8_t aliveFlag;
 	uint8_t lifeSpan;
@@ -155,11 +250,38 @@ typedef struct{
 	uint8_t clearWhenDead;
 }Object_Image_t;
 
+/*what is currently on screen for this object (used to redraw only changed area)*/
+typedef struct{
+	dirty_rect drawnArea;
+	const uint8_t *drawnImage;
+	uint8_t drawn;
+}Object_Render_t;
+
 typedef struct{
 	Object_Property_t Object_Property;
 	Object_Image_t Object_Image;
+	Object_Render_t Object_Render;
 }Space_Object_t;
 
+/*object as seen by renderer (player spaceship is a Space_Object_t, asteroids and rockets live in entity stores)*/
+typedef struct{
+	int16_t x;
+	int16_t y;
+	const uint8_t *image;
+	uint8_t imageWidth;
+	uint8_t imageHeight;
+	uint16_t color;
+	Object_Render_t *Object_Render;
+}Object_Sprite_t;
+
+/*input used by game engine during one frame (read from joystick and buttons, or from replayed input log)*/
+typedef struct{
+	uint8_t joystickDirection;	/*@JS_DIR in joystick.h, nearest to stickHeading*/
+	uint8_t buttons;	/*@RTE_BUTTON*/
+	uint8_t stickHeading;	/*0 to RTE_NUM_OF_HEADINGS - 1 counter-clockwise from east, 0 when joystick is centered*/
+	uint8_t stickLevel;	/*deflection of joystick, 1 to RTE_NUM_OF_THRUST_LEVELS, 0 when joystick is centered*/
+}RTE_Input_t;
+
 /***********************************************************************
 Function prototype
 ***********************************************************************/
@@ -168,16 +290,20 @@ void RTE_init (void);
 void RTE_start_update_frame (void);
 
 void RTE_create_player_spaceship (Space_Object_t *PlayerSpaceShipPtr);
-void RTE_create_asteroid (vector *AsteroidVectPtr,Space_Object_t *AsteroidPtr, uint8_t numberToCreate, Space_Object_t *PlayerSpaceShipPtr);
-void RTE_create_rocket (vector *RocketVectPtr, Space_Object_t *RocketPtr, Space_Object_t *PlayerSpaceShipPtr);
+void RTE_create_asteroid (entity_store *AsteroidStorePtr, uint8_t numberToCreate, Space_Object_t *PlayerSpaceShipPtr);
+void RTE_create_rocket (entity_store *RocketStorePtr, Space_Object_t *PlayerSpaceShipPtr);
 
 void RTE_draw_player_spaceship (Space_Object_t *PlayerSpaceShipPtr);
-void RTE_draw_asteroid (vector *AsteroidVectPtr);
-void RTE_draw_rocket (vector *RocketVectPtr);
+void RTE_draw_asteroid (entity_store *AsteroidStorePtr);
+void RTE_draw_rocket (entity_store *RocketStorePtr);
+void RTE_draw_frame (Space_Object_t *PlayerSpaceShipPtr, entity_store *RocketStorePtr, entity_store *AsteroidStorePtr);
+void RTE_set_full_redraw (uint8_t enOrDis);
+void RTE_measure_frame_latency (void);
+uint32_t RTE_get_collision_cycles (void);
 
 void RTE_update_player_spaceship (Space_Object_t *PlayerSpaceShipPtr);
-void RTE_update_asteroid (vector *AsteroidVectPtr, Space_Object_t *PlayerSpaceShipPtr);
-void RTE_update_rocket (vector *RocketVectPtr, vector *AsteroidVectPtr);
+void RTE_update_asteroid (entity_store *AsteroidStorePtr, Space_Object_t *PlayerSpaceShipPtr);
+void RTE_update_rocket (entity_store *RocketStorePtr, entity_store *AsteroidStorePtr);
 
 void RTE_display_black_background(void);
 void RTE_display_start_screen(void);
@@ -186,4 +312,14 @@ void RTE_display_game_over_screen(void);
 
 void RTE_reset_game(void);
 
+uint32_t RTE_get_state_hash(void);
+
+void RTE_seed_random(uint32_t seed);
+
+void RTE_read_input(RTE_Input_t *InputPtr);
+void RTE_flush_input(void);
+void RTE_set_input(const RTE_Input_t *InputPtr);
+uint16_t RTE_encode_input(const RTE_Input_t *InputPtr);
+void RTE_decode_input(uint16_t value, RTE_Input_t *InputPtr);
+
 #endif
@@ -0,0 +1,265 @@
+/**
+*@file input_log.c
+*@brief Provide run length encoded log of per-frame game input.
+*
+*This implementation file provide functions for encoding frames, random seeds and state hashes into records and decoding them back.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "input_log.h"
+
+#define INPUT_LOG_SHORT_RUN		3
+#define INPUT_LOG_LONG_RUN		(INPUT_LOG_SHORT_RUN + 1)
+#define INPUT_LOG_VALUE_SIZE	4
+
+static void input_log_write_value(input_log_writer *writer, uint8_t recordType, uint32_t value);
+static uint8_t input_log_read_value(input_log_reader *reader, uint8_t recordType, uint32_t *valuePtr);
+
+/***********************************************************************
+Initialize writer of empty log, records are passed to output function
+***********************************************************************/
+void input_log_writer_init(input_log_writer *writer, input_log_output output)
+{
+	writer->output = output;
+	writer->input = 0;
+	writer->aux = 0;
+	writer->runLength = 0;
+	writer->numOfFrames = 0;
+	writer->numOfBytes = 0;
+}
+
+/***********************************************************************
+Add input of one frame (run is written only when input change)
+***********************************************************************/
+void input_log_write_frame(input_log_writer *writer, uint16_t input)
+{
+	if((input & 0xFF) > INPUT_LOG_MAX_INPUT){
+		input &= 0xFF00;
+	}
+
+	if(writer->runLength && input != writer->input){
+		input_log_flush(writer);
+	}
+
+	/*auxiliary byte apply to runs after its record*/
+	if((input >> 8) != writer->aux){
+		uint8_t record[2] = {INPUT_LOG_RECORD_AUX,(uint8_t)(input >> 8)};
+
+		writer->output(record,sizeof(record));
+		writer->numOfBytes += sizeof(record);
+		writer->aux = (uint8_t)(input >> 8);
+	}
+
+	writer->input = input;
+	writer->runLength++;
+	writer->numOfFrames++;
+}
+
+/***********************************************************************
+Add random seed record after frames written so far
+***********************************************************************/
+void input_log_write_seed(input_log_writer *writer, uint32_t seed)
+{
+	input_log_write_value(writer,INPUT_LOG_RECORD_SEED,seed);
+}
+
+/***********************************************************************
+Add state hash record after frames written so far
+***********************************************************************/
+void input_log_write_hash(input_log_writer *writer, uint32_t hash)
+{
+	input_log_write_value(writer,INPUT_LOG_RECORD_HASH,hash);
+}
+
+/***********************************************************************
+Write current run and end record
+***********************************************************************/
+void input_log_write_end(input_log_writer *writer)
+{
+	uint8_t record = INPUT_LOG_RECORD_END;
+
+	input_log_flush(writer);
+
+	writer->output(&record,1);
+	writer->numOfBytes++;
+}
+
+/***********************************************************************
+Write current run (next frame start a new run even with same input)
+***********************************************************************/
+void input_log_flush(input_log_writer *writer)
+{
+	uint8_t record[INPUT_LOG_MAX_RECORD_SIZE];
+	uint16_t length = 0;
+
+	if(!writer->runLength){
+		return;
+	}
+
+	if(writer->runLength <= INPUT_LOG_SHORT_RUN){
+		record[length++] = (uint8_t)(writer->runLength << 6) | (writer->input & 0x3F);
+	}else{
+		uint32_t extraFrames = writer->runLength - INPUT_LOG_LONG_RUN;
+
+		record[length++] = writer->input & 0x3F;
+
+		do{
+			record[length] = extraFrames & 0x7F;
+			extraFrames >>= 7;
+
+			if(extraFrames){
+				record[length] |= 0x80;
+			}
+			length++;
+		}while(extraFrames);
+	}
+
+	writer->output(record,length);
+	writer->numOfBytes += length;
+	writer->runLength = 0;
+}
+
+/***********************************************************************
+Initialize reader of log held in memory
+***********************************************************************/
+void input_log_reader_init(input_log_reader *reader, const uint8_t *dataPtr, uint32_t size)
+{
+	reader->data = dataPtr;
+	reader->size = size;
+	reader->position = 0;
+	reader->input = 0;
+	reader->runLeft = 0;
+	reader->numOfFrames = 0;
+}
+
+/***********************************************************************
+Read input of next frame
+***********************************************************************/
+uint8_t input_log_read_frame(input_log_reader *reader, uint16_t *inputPtr)
+{
+	if(!reader->runLeft){
+		uint32_t position = reader->position;
+		uint8_t firstByte;
+
+		if(position >= reader->size){
+			return INPUT_LOG_END;
+		}
+
+		firstByte = reader->data[position++];
+
+		/*auxiliary byte is kept for following runs*/
+		while(firstByte == INPUT_LOG_RECORD_AUX){
+			if(position + 1 >= reader->size){
+				return INPUT_LOG_END;
+			}
+
+			reader->input = (uint16_t)reader->data[position++] << 8;
+			firstByte = reader->data[position++];
+		}
+
+		if(firstByte >> 6){
+			reader->runLeft = firstByte >> 6;
+		}else if(firstByte == INPUT_LOG_RECORD_END){
+			return INPUT_LOG_END;
+		}else if(firstByte > INPUT_LOG_MAX_INPUT){
+			/*seed or hash record, game asked for a frame too early or too late*/
+			return INPUT_LOG_MISMATCH;
+		}else{
+			uint32_t extraFrames = 0;
+			uint8_t shift = 0;
+			uint8_t nextByte;
+
+			do{
+				/*run length cut off by end of data or longer than 32 bits*/
+				if(position >= reader->size || shift > 28){
+					return INPUT_LOG_END;
+				}
+
+				nextByte = reader->data[position++];
+				extraFrames |= (uint32_t)(nextByte & 0x7F) << shift;
+				shift += 7;
+			}while(nextByte & 0x80);
+
+			reader->runLeft = extraFrames + INPUT_LOG_LONG_RUN;
+		}
+
+		reader->input = (reader->input & 0xFF00) | (firstByte & 0x3F);
+		reader->position = position;
+	}
+
+	reader->runLeft--;
+	reader->numOfFrames++;
+	*inputPtr = reader->input;
+
+	return INPUT_LOG_OK;
+}
+
+/***********************************************************************
+Read random seed record (must follow last frame of a run)
+***********************************************************************/
+uint8_t input_log_read_seed(input_log_reader *reader, uint32_t *seedPtr)
+{
+	return input_log_read_value(reader,INPUT_LOG_RECORD_SEED,seedPtr);
+}
+
+/***********************************************************************
+Read state hash record (must follow last frame of a run)
+***********************************************************************/
+uint8_t input_log_read_hash(input_log_reader *reader, uint32_t *hashPtr)
+{
+	return input_log_read_value(reader,INPUT_LOG_RECORD_HASH,hashPtr);
+}
+
+/***********************************************************************
+Private function: Write current run then a record holding 32 bits value
+***********************************************************************/
+static void input_log_write_value(input_log_writer *writer, uint8_t recordType, uint32_t value)
+{
+	uint8_t record[1 + INPUT_LOG_VALUE_SIZE];
+
+	input_log_flush(writer);
+
+	record[0] = recordType;
+
+	for(uint8_t i = 0; i < INPUT_LOG_VALUE_SIZE; i++){
+		record[1 + i] = (uint8_t)(value >> (8*i));
+	}
+
+	writer->output(record,sizeof(record));
+	writer->numOfBytes += sizeof(record);
+}
+
+/***********************************************************************
+Private function: Read record holding 32 bits value
+***********************************************************************/
+static uint8_t input_log_read_value(input_log_reader *reader, uint8_t recordType, uint32_t *valuePtr)
+{
+	uint32_t value = 0;
+
+	if(reader->runLeft){
+		return INPUT_LOG_MISMATCH;
+	}
+
+	if(reader->position >= reader->size || reader->data[reader->position] == INPUT_LOG_RECORD_END){
+		return INPUT_LOG_END;
+	}
+
+	if(reader->data[reader->position] != recordType){
+		return INPUT_LOG_MISMATCH;
+	}
+
+	if(reader->size - reader->position < 1 + INPUT_LOG_VALUE_SIZE){
+		return INPUT_LOG_END;
+	}
+
+	for(uint8_t i = 0; i < INPUT_LOG_VALUE_SIZE; i++){
+		value |= (uint32_t)reader->data[reader->position + 1 + i] << (8*i);
+	}
+
+	reader->position += 1 + INPUT_LOG_VALUE_SIZE;
+	*valuePtr = value;
+
+	return INPUT_LOG_OK;
+}
@@ -0,0 +1,83 @@
+/**
+*@file input_log.h
+*@brief Provide run length encoded log of per-frame game input.
+*
+*This header file provide functions for writing game input of every frame into a compact byte stream and reading it back.
+*Input of a frame is a small value (0 to INPUT_LOG_MAX_INPUT, e.g. joystick direction and pressed buttons) in low byte and an auxiliary
+*byte (e.g. analog joystick) in high byte, frames with same input are merged into one run. Auxiliary byte is written only when it
+*change, in a record before the run (it is 0 until first auxiliary record). Random seed and state hash records can be placed between frames, so that a log replayed from start rebuild
+*same random numbers and can be checked against state of the recorded game.
+*
+*Byte stream is a list of records, first byte of a record is rrvvvvvv:
+*rr = 1 to 3:	run of rr frames with input vvvvvv (1 byte)
+*rr = 0:		run of 4 frames or more with input vvvvvv, number of frames - 4 follows as unsigned LEB128 (7 bits per byte, low bits first)
+*rr = 0 and vvvvvv = INPUT_LOG_RECORD_SEED, INPUT_LOG_RECORD_HASH:	4 bytes value follows (little endian)
+*rr = 0 and vvvvvv = INPUT_LOG_RECORD_AUX:	auxiliary byte of next frames follows
+*rr = 0 and vvvvvv = INPUT_LOG_RECORD_END:	end of log
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef INPUT_LOG_H
+#define INPUT_LOG_H
+
+#include <stdint.h>
+
+/*largest input value of a frame, larger values of first byte are record types*/
+#define INPUT_LOG_MAX_INPUT		47
+
+/*
+*@INPUT_LOG_RECORD
+*Record types (rr = 0)
+*/
+#define INPUT_LOG_RECORD_AUX	0x3C
+#define INPUT_LOG_RECORD_END	0x3D
+#define INPUT_LOG_RECORD_HASH	0x3E
+#define INPUT_LOG_RECORD_SEED	0x3F
+
+/*largest record: first byte + 5 bytes LEB128 run length*/
+#define INPUT_LOG_MAX_RECORD_SIZE	6
+
+/*
+*@INPUT_LOG_RESULT
+*Result of reading log
+*/
+#define INPUT_LOG_OK		0
+#define INPUT_LOG_END		1	/*end record reached or log data ended*/
+#define INPUT_LOG_MISMATCH	2	/*next record is not the one asked for (log does not match game)*/
+
+/*called with every complete record*/
+typedef void (*input_log_output)(const uint8_t *dataPtr, uint16_t length);
+
+typedef struct input_log_writer {
+	input_log_output output;
+	uint16_t input;	/*input of current run*/
+	uint8_t aux;	/*last auxiliary byte written*/
+	uint32_t runLength;	/*frames in current run, run is written when input change or another record is written*/
+	uint32_t numOfFrames;
+	uint32_t numOfBytes;
+} input_log_writer;
+
+typedef struct input_log_reader {
+	const uint8_t *data;
+	uint32_t size;
+	uint32_t position;
+	uint16_t input;	/*input of current run, auxiliary byte in high byte*/
+	uint32_t runLeft;	/*frames left in current run*/
+	uint32_t numOfFrames;
+} input_log_reader;
+
+void input_log_writer_init(input_log_writer *, input_log_output output);
+void input_log_write_frame(input_log_writer *, uint16_t input);
+void input_log_write_seed(input_log_writer *, uint32_t seed);
+void input_log_write_hash(input_log_writer *, uint32_t hash);
+void input_log_write_end(input_log_writer *);
+void input_log_flush(input_log_writer *);
+
+void input_log_reader_init(input_log_reader *, const uint8_t *dataPtr, uint32_t size);
+uint8_t input_log_read_frame(input_log_reader *, uint16_t *inputPtr);
+uint8_t input_log_read_seed(input_log_reader *, uint32_t *seedPtr);
+uint8_t input_log_read_hash(input_log_reader *, uint32_t *hashPtr);
+
+#endif
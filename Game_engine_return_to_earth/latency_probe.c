@@ -0,0 +1,127 @@
+/**
+*@file latency_probe.c
+*@brief Provide histogram of latency from input edge to end of frame drawing it.
+*
+*This implementation file provide functions for keeping edges consumed by a frame and counting their latencies in histogram.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "latency_probe.h"
+
+/***********************************************************************
+Initialize probe with no sample, latencies are counted in bins of binWidth ticks
+***********************************************************************/
+void latency_probe_init(latency_probe *probe, uint32_t binWidth)
+{
+	probe->binWidth = binWidth ? binWidth : 1;
+	latency_probe_reset(probe);
+}
+
+/***********************************************************************
+Remove every sample and edge (bin width is kept)
+***********************************************************************/
+void latency_probe_reset(latency_probe *probe)
+{
+	for(uint16_t i = 0; i < LATENCY_PROBE_NUM_OF_BINS; i++){
+		probe->bins[i] = 0;
+	}
+
+	probe->numOfEdges = 0;
+	probe->numOfSamples = 0;
+	probe->numOfDropped = 0;
+	probe->min = UINT32_MAX;
+	probe->max = 0;
+	probe->sum = 0;
+}
+
+/***********************************************************************
+Keep time stamp of edge consumed by current frame
+***********************************************************************/
+void latency_probe_consume_edge(latency_probe *probe, uint32_t timestamp)
+{
+	if(probe->numOfEdges >= LATENCY_PROBE_MAX_EDGES){
+		probe->numOfDropped++;
+		return;
+	}
+
+	probe->edges[probe->numOfEdges++] = timestamp;
+}
+
+/***********************************************************************
+Forget edges of current frame (frame is not drawn, e.g. input waited for on a menu screen)
+***********************************************************************/
+void latency_probe_discard_edges(latency_probe *probe)
+{
+	probe->numOfEdges = 0;
+}
+
+/***********************************************************************
+Count latency of every edge of current frame, whose last byte was sent at timestamp
+***********************************************************************/
+void latency_probe_frame_sent(latency_probe *probe, uint32_t timestamp)
+{
+	for(uint8_t i = 0; i < probe->numOfEdges; i++){
+		/*unsigned subtraction stay correct when counter wrapped once*/
+		uint32_t latency = timestamp - probe->edges[i];
+		uint32_t bin = latency/probe->binWidth;
+
+		probe->bins[(bin < LATENCY_PROBE_NUM_OF_BINS) ? bin : LATENCY_PROBE_NUM_OF_BINS - 1]++;
+		probe->sum += latency;
+		probe->numOfSamples++;
+
+		if(latency < probe->min){
+			probe->min = latency;
+		}
+		if(latency > probe->max){
+			probe->max = latency;
+		}
+	}
+
+	probe->numOfEdges = 0;
+}
+
+/***********************************************************************
+Get minimum, average, percentile and maximum latency (0 when there is no sample)
+***********************************************************************/
+void latency_probe_get_stats(const latency_probe *probe, latency_probe_stats *stats)
+{
+	/*rank of percentile sample, rounded up*/
+	uint32_t rank = (uint32_t)(((uint64_t)probe->numOfSamples*LATENCY_PROBE_PERCENTILE + 99)/100);
+	uint32_t count = 0;
+	uint16_t bin = 0;
+
+	stats->numOfSamples = probe->numOfSamples;
+	stats->numOfDropped = probe->numOfDropped;
+
+	if(!probe->numOfSamples){
+		stats->min = 0;
+		stats->average = 0;
+		stats->percentile = 0;
+		stats->max = 0;
+		return;
+	}
+
+	stats->min = probe->min;
+	stats->average = (uint32_t)(probe->sum/probe->numOfSamples);
+	stats->max = probe->max;
+
+	while(bin < LATENCY_PROBE_NUM_OF_BINS - 1){
+		count += probe->bins[bin];
+		if(count >= rank){
+			break;
+		}
+		bin++;
+	}
+
+	/*upper edge of bin, never beyond longest latency (last bin is open ended)*/
+	if((bin == LATENCY_PROBE_NUM_OF_BINS - 1) || ((uint64_t)(bin + 1)*probe->binWidth - 1 >= probe->max)){
+		stats->percentile = probe->max;
+	}else{
+		stats->percentile = (bin + 1)*probe->binWidth - 1;
+	}
+	if(stats->percentile < stats->min){
+		stats->percentile = stats->min;
+	}
+}
@@ -0,0 +1,52 @@
+/**
+*@file latency_probe.h
+*@brief Provide histogram of latency from input edge to end of frame drawing it.
+*
+*This header file provide functions for measuring input latency. Time stamp of every input edge (e.g. DWT cycle count of button event)
+*is kept by frame which consume it, then latency of each kept edge is taken when last byte of that frame is sent to display.
+*Latencies are counted in histogram of LATENCY_PROBE_NUM_OF_BINS bins (longer latencies are counted in last bin), so that minimum,
+*average, 99th percentile (upper edge of its bin) and maximum are read without keeping every sample.
+*Time stamps are in any unit (tick) of a 32 bits counter which wrap around, latency must be shorter than a wrap.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+#include <stdint.h>
+
+#define LATENCY_PROBE_NUM_OF_BINS	512
+#define LATENCY_PROBE_MAX_EDGES		8	/*edges kept by one frame, later edges of same frame are dropped*/
+#define LATENCY_PROBE_PERCENTILE	99
+
+typedef struct latency_probe {
+	uint32_t binWidth;	/*ticks per bin*/
+	uint32_t bins[LATENCY_PROBE_NUM_OF_BINS];
+	uint32_t edges[LATENCY_PROBE_MAX_EDGES];	/*time stamps of edges consumed by current frame*/
+	uint8_t numOfEdges;
+	uint32_t numOfSamples;
+	uint32_t numOfDropped;	/*edges which did not fit in edges of their frame*/
+	uint32_t min;
+	uint32_t max;
+	uint64_t sum;
+} latency_probe;
+
+typedef struct latency_probe_stats {
+	uint32_t numOfSamples;
+	uint32_t numOfDropped;
+	uint32_t min;	/*ticks*/
+	uint32_t average;
+	uint32_t percentile;	/*LATENCY_PROBE_PERCENTILE percent of latencies are not longer*/
+	uint32_t max;
+} latency_probe_stats;
+
+void latency_probe_init(latency_probe *, uint32_t binWidth);
+void latency_probe_reset(latency_probe *);
+void latency_probe_consume_edge(latency_probe *, uint32_t timestamp);
+void latency_probe_discard_edges(latency_probe *);
+void latency_probe_frame_sent(latency_probe *, uint32_t timestamp);
+void latency_probe_get_stats(const latency_probe *, latency_probe_stats *);
+
+#endif
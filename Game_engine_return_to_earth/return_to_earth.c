@@ -1,46 +1,427 @@
 /**
 *@brief test ili9341 driver library 's functions
 *
+*Input of every frame and random seed of every wave are logged (see input_log.h), so a game can be replayed frame by frame:
+*with RTE_RECORD_INPUT input log is streamed out through UART3 by DMA while playing (capture it into a file on PC),
+*with RTE_REPLAY_INPUT input log is received through UART3 and played back instead of joystick and buttons.
+*State hash is logged at end of every wave and at game over, replay check it and report first frame where game went different.
+*Same log can be replayed on PC with headless simulation (Headless_simulation/headless_main.c), final state hash must be the same.
+*Theme song is played in background on start and game over screens (see sequencer.h).
+*With RTE_MEASURE_LATENCY (game_engine.h, input log disabled, ILI9341_USE_TRANSFER_TIMESTAMP defined in ili9341.h) latency from button edge to last pixel of frame showing it is measured,
+*minimum, average, 99th percentile and maximum are sent through UART3 at end of every wave and game.
+*With RTE_SEND_TELEMETRY (input log disabled) frame time counters are streamed through UART3 (see telemetry.h), decode them on PC
+*with Tools/telemetry_decoder.c.
+*With RTE_SAVE_TO_EEPROM high score table and player progress are kept in a 24C32 EEPROM on I2C1 (see save_store.h): they are loaded
+*at boot and written behind the game, between frames, best scores are shown on game over screen.
+*
 *@author Tran Thanh Nhan
 *@date 04/09/2019
 */
 
+/*
+*@PIN_MAPPING
+*Pin mapping
+*UART3 TX	- PB10
+*UART3 RX	- PB11
+*I2C1 SCL	- PB6
+*I2C1 SDA	- PB7
+*/
+
 #include "stm32f407xx.h"                  // Device header
 #include "game_engine.h"
+#include "input_log.h"
+#include "telemetry.h"
+#include "save_store.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_uart.h"
+#include "../Miscellaneous/inc/rte_theme_song.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+
+/*
+*@RTE_INPUT_LOG_MODE
+*RTE_RECORD_INPUT: stream input log through UART3 while playing
+*RTE_REPLAY_INPUT: receive input log through UART3 (4 bytes size in little endian followed by log), then play it back
+*Both are off by default, uncomment one of them to enable it, or build with -DRTE_RECORD_INPUT or -DRTE_REPLAY_INPUT
+*/
+/*#define RTE_RECORD_INPUT	TRUE*/
+/*#define RTE_REPLAY_INPUT	TRUE*/
+
+#define RTE_INPUT_LOG_BAUD_RATE		UART_BDR_115200
+#define RTE_REPLAY_BUFFER_SIZE		(16*1024)
+
+#if defined (RTE_RECORD_INPUT) && defined (RTE_REPLAY_INPUT)
+#error "define only one of RTE_RECORD_INPUT and RTE_REPLAY_INPUT"
+#endif
+
+/*
+*@RTE_TELEMETRY
+*RTE_SEND_TELEMETRY: stream frame number, update, draw and collision cycles, SPI bytes, live asteroids and rockets and audio underruns
+*through UART3, one packet (32 bytes) every RTE_TELEMETRY_PERIOD frames (240 bytes/s at 30 frames/s, 2% of line at 115200 baud).
+*SPI bytes are always 0 unless ILI9341_USE_SPI_BYTE_COUNTER is defined (ili9341.h)
+*/
+/*#define RTE_SEND_TELEMETRY	TRUE*/
+#define RTE_TELEMETRY_PERIOD	4
+
+/*
+*@RTE_SAVE
+*RTE_SAVE_TO_EEPROM: keep high score table and player progress in EEPROM (RTE_EEPROM_ADDRESS on I2C1, DMA1 streams 7 and 0), an absent
+*EEPROM only keep them in RAM. Off by default, uncomment to enable it, or build with -DRTE_SAVE_TO_EEPROM
+*/
+/*#define RTE_SAVE_TO_EEPROM	TRUE*/
+#define RTE_EEPROM_ADDRESS		0x50
+#define RTE_EEPROM_PAGE_SIZE	32
+#define RTE_SAVE_BASE_ADDRESS	0x0000
+#define RTE_NUM_OF_SCORES_SHOWN	3
+
+#if defined (RTE_MEASURE_LATENCY) && (defined (RTE_RECORD_INPUT) || defined (RTE_REPLAY_INPUT))
+#error "latency report and input log share UART3, disable RTE_RECORD_INPUT and RTE_REPLAY_INPUT"
+#endif
+
+#if defined (RTE_MEASURE_LATENCY) && !defined (ILI9341_USE_TRANSFER_TIMESTAMP)
+#error "latency is measured with ILI9341 transfer time stamps, define ILI9341_USE_TRANSFER_TIMESTAMP too"
+#endif
+
+#if defined (RTE_SEND_TELEMETRY) && (defined (RTE_RECORD_INPUT) || defined (RTE_REPLAY_INPUT) || defined (RTE_MEASURE_LATENCY))
+#error "telemetry, latency report and input log share UART3, disable RTE_RECORD_INPUT, RTE_REPLAY_INPUT and RTE_MEASURE_LATENCY"
+#endif
 
 extern uint8_t frameUpdate;
+extern int16_t score;
 
 extern Space_Object_t PlayerSpaceship;
-extern Space_Object_t Asteroid[RTE_ASTEROID_BUFFER_SIZE] ;
-extern Space_Object_t Rocket[RTE_ROCKET_BUFFER_SIZE];
 
-extern vector AsteroidVect;
-extern vector RocketVect;
+extern entity_store AsteroidStore;
+extern entity_store RocketStore;
 
 extern uint8_t currentWave;
 extern uint8_t numOfAsteroidInWave[RTE_NUM_OF_WAVE];
 
+UART_Handle_t *UART3HandlePtr = NULL;
+
+#ifdef RTE_RECORD_INPUT
+input_log_writer InputLogWriter;
+
+/*records waiting for DMA transmission, slot of a record is only reused after UART_DMA_TX_QUEUE_SIZE records were queued behind it*/
+uint8_t inputLogRecords[UART_DMA_TX_QUEUE_SIZE + 1][INPUT_LOG_MAX_RECORD_SIZE];
+uint8_t inputLogSlot = 0;
+#endif
+
+#ifdef RTE_REPLAY_INPUT
+input_log_reader InputLogReader;
+uint8_t replayBuffer[RTE_REPLAY_BUFFER_SIZE];
+#endif
+
+#ifdef RTE_MEASURE_LATENCY
+extern latency_probe InputLatency;
+#endif
+
+#ifdef RTE_SEND_TELEMETRY
+telemetry_writer TelemetryWriter;
+uint32_t frameNumber = 0;
+
+/*packets waiting for DMA transmission, same reuse of slots as input log records*/
+uint8_t telemetryPackets[UART_DMA_TX_QUEUE_SIZE + 1][TELEMETRY_MAX_PACKET_SIZE];
+uint8_t telemetrySlot = 0;
+#endif
+
+#ifdef RTE_SAVE_TO_EEPROM
+I2C_Handle_t I2C1Handle;
+I2C_Config_t I2C1Config = {.SCLspeed = I2C_FSCL_FM,.ACKctr = I2C_ACKctr_ENABLE,.deviceAddress = 0x33,.FMdutyCycle = I2C_FMduty_2};
+EEPROM_Handle_t EEPROMHandle;
+save_store SaveStore;
+#endif
+
+void check_state (void);
+void serve_save_store (void);
+
 void delay(volatile uint32_t delay)
 {
 	for(;delay !=0;delay--);
 }
 
+#ifdef RTE_RECORD_INPUT
+/*records are queued as soon as they are complete (at most a few bytes per frame), game only wait when queue is full*/
+void send_input_log (const uint8_t *dataPtr, uint16_t length)
+{
+	uint8_t *recordPtr = inputLogRecords[inputLogSlot];
+
+	memcpy(recordPtr,dataPtr,length);
+	inputLogSlot = (inputLogSlot + 1) % (UART_DMA_TX_QUEUE_SIZE + 1);
+
+	while(UART_send_DMA(UART3HandlePtr,recordPtr,length) != UART_STATE_READY);
+}
+
+#endif
+
+#ifdef RTE_SEND_TELEMETRY
+/*packet is dropped rather than waiting when transmission queue is full, game timing must not depend on serial line*/
+uint8_t send_telemetry_packet (const uint8_t *dataPtr, uint16_t length)
+{
+	uint8_t *packetPtr = telemetryPackets[telemetrySlot];
+
+	memcpy(packetPtr,dataPtr,length);
+
+	if(UART_send_DMA(UART3HandlePtr,packetPtr,length) != UART_STATE_READY){
+		return 0;
+	}
+
+	telemetrySlot = (telemetrySlot + 1) % (UART_DMA_TX_QUEUE_SIZE + 1);
+	return 1;
+}
+#endif
+
+#if defined (RTE_RECORD_INPUT) || defined (RTE_SEND_TELEMETRY)
+void DMA1_Stream3_IRQHandler (void)
+{
+	UART_DMA_TX_intrpt_handler(UART3HandlePtr);
+}
+#endif
+
+#ifdef RTE_REPLAY_INPUT
+/*report result of replay and stop game*/
+void stop_replay (const char *reasonPtr)
+{
+	char str[100];
+
+	sprintf(str,"%s at frame %lu, state hash 0x%08lx\n\r",reasonPtr,(unsigned long)InputLogReader.numOfFrames,(unsigned long)RTE_get_state_hash());
+	UART_send(UART3HandlePtr,(uint8_t*)str,strlen(str));
+
+	TIM_ctr(TIM6,STOP);
+	while(1);
+}
+#endif
+
+void start_input_log (void)
+{
+	UART3HandlePtr = UART_general_init(USART3,UART_pins_pack_1,RTE_INPUT_LOG_BAUD_RATE,UART_STB_1,UART_WRDLEN_8_DT_BITS,UART_TX_RX,UART_NO_PARCTRL,UART_NO_FLOWCTRL);
+
+#if defined (RTE_RECORD_INPUT) || defined (RTE_SEND_TELEMETRY)
+	UART_DMA_init(UART3HandlePtr);
+	DMA_intrpt_vector_ctr(USART3_DMA_TX_IRQ,ENABLE);
+#endif
+
+#ifdef RTE_RECORD_INPUT
+	input_log_writer_init(&InputLogWriter,send_input_log);
+#endif
+
+#ifdef RTE_SEND_TELEMETRY
+	telemetry_writer_init(&TelemetryWriter,send_telemetry_packet,RTE_TELEMETRY_PERIOD);
+	ILI9341_reset_SPI_byte_count();
+#endif
+
+#ifdef RTE_REPLAY_INPUT
+	uint8_t sizeBytes[4];
+	uint32_t size;
+
+	UART_receive(UART3HandlePtr,sizeBytes,sizeof(sizeBytes));
+	size = sizeBytes[0] | (sizeBytes[1] << 8) | ((uint32_t)sizeBytes[2] << 16) | ((uint32_t)sizeBytes[3] << 24);
+
+	if(size > RTE_REPLAY_BUFFER_SIZE){
+		size = RTE_REPLAY_BUFFER_SIZE;
+	}
+
+	UART_receive(UART3HandlePtr,replayBuffer,size);
+	input_log_reader_init(&InputLogReader,replayBuffer,size);
+#endif
+}
+
+/*input of this frame, from joystick and buttons or from replayed log*/
+void get_frame_input (RTE_Input_t *InputPtr)
+{
+#ifdef RTE_REPLAY_INPUT
+	uint16_t value;
+	uint8_t result = input_log_read_frame(&InputLogReader,&value);
+
+	/*log written between 2 frames end with state hash*/
+	if(result == INPUT_LOG_MISMATCH){
+		check_state();
+		result = input_log_read_frame(&InputLogReader,&value);
+	}
+
+	if(result == INPUT_LOG_END){
+		stop_replay("Replay finished");
+	}else if(result == INPUT_LOG_MISMATCH){
+		stop_replay("Replay went different");
+	}
+
+	RTE_decode_input(value,InputPtr);
+#else
+	RTE_read_input(InputPtr);
+#ifdef RTE_RECORD_INPUT
+	input_log_write_frame(&InputLogWriter,RTE_encode_input(InputPtr));
+#endif
+#endif
+}
+
+/*seed of random numbers at start of wave, hardware RNG must be initialized*/
+uint32_t get_wave_seed (void)
+{
+#ifdef RTE_REPLAY_INPUT
+	uint32_t seed = 0;
+
+	if(input_log_read_seed(&InputLogReader,&seed) != INPUT_LOG_OK){
+		stop_replay("Replay finished");
+	}
+
+	return seed;
+#else
+	uint32_t seed = RNG_get();
+#ifdef RTE_RECORD_INPUT
+	input_log_write_seed(&InputLogWriter,seed);
+#endif
+	return seed;
+#endif
+}
+
+/*log state hash (record) or compare it with logged one (replay)*/
+void check_state (void)
+{
+#ifdef RTE_REPLAY_INPUT
+	uint32_t hash = 0;
+	uint8_t result = input_log_read_hash(&InputLogReader,&hash);
+
+	if(result == INPUT_LOG_END){
+		stop_replay("Replay finished");
+	}else if(result == INPUT_LOG_MISMATCH || hash != RTE_get_state_hash()){
+		PROTOBOARD_RED_LED_ON;
+		stop_replay("Replay went different");
+	}
+#elif defined (RTE_RECORD_INPUT)
+	input_log_write_hash(&InputLogWriter,RTE_get_state_hash());
+#endif
+}
+
+/*send latency of button edges measured so far*/
+void report_latency (void)
+{
+#ifdef RTE_MEASURE_LATENCY
+	latency_probe_stats Stats;
+	uint32_t cyclesPerMicrosecond = RCC_get_SYSCLK_value()/1000000;
+	char str[120];
+
+	latency_probe_get_stats(&InputLatency,&Stats);
+	sprintf(str,"Input latency of %lu edges (%lu dropped): min %lu us, avg %lu us, p%u %lu us, max %lu us\n\r",
+	(unsigned long)Stats.numOfSamples,(unsigned long)Stats.numOfDropped,(unsigned long)(Stats.min/cyclesPerMicrosecond),
+	(unsigned long)(Stats.average/cyclesPerMicrosecond),LATENCY_PROBE_PERCENTILE,(unsigned long)(Stats.percentile/cyclesPerMicrosecond),
+	(unsigned long)(Stats.max/cyclesPerMicrosecond));
+	UART_send(UART3HandlePtr,(uint8_t*)str,strlen(str));
+#endif
+}
+
+/*add counters of frame whose update started at updateStart and drawing at drawStart (collision cycles and SPI bytes are counted since last frame)*/
+void send_telemetry (uint32_t updateStart, uint32_t drawStart)
+{
+#ifdef RTE_SEND_TELEMETRY
+	telemetry_frame Frame;
+
+	Frame.frameNumber = frameNumber++;
+	Frame.updateCycles = drawStart - updateStart;
+	Frame.drawCycles = DWT_get_elapsed_cycles(drawStart);
+	Frame.collisionCycles = RTE_get_collision_cycles();
+	Frame.SPIbytes = ILI9341_get_SPI_byte_count();
+	Frame.numOfAsteroids = AsteroidStore.total;
+	Frame.numOfRockets = RocketStore.total;
+	Frame.audioUnderruns = (uint16_t)speaker_get_num_of_underruns();
+	Frame.numOfFrames = 1;
+
+	ILI9341_reset_SPI_byte_count();
+	telemetry_write_frame(&TelemetryWriter,&Frame);
+#endif
+}
+
+/*initialize I2C1 and EEPROM, then load records (few milliseconds, before first frame)*/
+void start_save_store (void)
+{
+#ifdef RTE_SAVE_TO_EEPROM
+	GPIO_Pin_config_t GPIO_I2C_pin_config = {.mode = GPIO_MODE_ALTFN,.speed = GPIO_OUTPUT_HIGH_SPEED,.outType = GPIO_OUTPUT_TYPE_OD,.puPdr = GPIO_PU,.altFunc = 4};
+	GPIO_Handle_t GPIO_I2C_pin_handle = {.GPIOxPtr = GPIOB};
+
+	GPIO_I2C_pin_config.pinNumber = GPIO_PIN_NO_6;
+	GPIO_I2C_pin_handle.GPIO_Pin_config = GPIO_I2C_pin_config;
+	GPIO_init(&GPIO_I2C_pin_handle);
+	GPIO_I2C_pin_config.pinNumber = GPIO_PIN_NO_7;
+	GPIO_I2C_pin_handle.GPIO_Pin_config = GPIO_I2C_pin_config;
+	GPIO_init(&GPIO_I2C_pin_handle);
+
+	I2C1Handle.I2CxPtr = I2C1;
+	I2C1Handle.I2CxConfigPtr = &I2C1Config;
+	I2C_init(&I2C1Handle);
+	I2C_DMA_init(&I2C1Handle);
+	I2C_periph_ctr(I2C1,ENABLE);
+	I2C_intrpt_ctrl(IRQ_I2C1_EV,ENABLE);
+	I2C_intrpt_ctrl(IRQ_I2C1_ER,ENABLE);
+	DMA_intrpt_vector_ctr(I2C1_DMA_TX_IRQ,ENABLE);
+	DMA_intrpt_vector_ctr(I2C1_DMA_RX_IRQ,ENABLE);
+
+	eeprom_init(&EEPROMHandle,&I2C1Handle,RTE_EEPROM_ADDRESS,RTE_EEPROM_PAGE_SIZE);
+	save_store_init(&SaveStore,&EEPROMHandle,RTE_SAVE_BASE_ADDRESS);
+
+	while(save_store_service(&SaveStore) == SAVE_STORE_LOADING);
+#endif
+}
+
+/*go on with EEPROM write of changed records, never wait for EEPROM*/
+void serve_save_store (void)
+{
+#ifdef RTE_SAVE_TO_EEPROM
+	save_store_service(&SaveStore);
+#endif
+}
+
+/*add result of game over to records, write them at once and show best scores on game over screen*/
+void save_game (void)
+{
+#ifdef RTE_SAVE_TO_EEPROM
+	char str[40];
+	uint8_t rank = save_store_add_game(&SaveStore,score,currentWave + 1);
+
+	save_store_flush(&SaveStore);
+
+	for(uint8_t i = 0; i < RTE_NUM_OF_SCORES_SHOWN; i++){
+		sprintf(str,"%u. %d (wave %u)",i + 1,SaveStore.highScores[i].score,SaveStore.highScores[i].wave);
+		ILI9341_put_string(10,10 + 20*i,str,&TM_Font_11x18,(i == rank) ? ILI9341_YELLOW : ILI9341_WHITE);
+	}
+#endif
+}
+
+/*wait for new press of shoot button, replay does not wait, records are written meanwhile*/
+void wait_shoot_button (void)
+{
+#ifndef RTE_REPLAY_INPUT
+	RTE_Input_t Input;
+
+	RTE_flush_input();
+
+	do{
+		serve_save_store();
+		RTE_read_input(&Input);
+	}while(!(Input.buttons & RTE_BUTTON_SHOOT));
+#endif
+}
+
 int main (void)
 {
+	RTE_Input_t Input;
+	uint32_t updateStart, drawStart;
+
 	RTE_init();
+	start_input_log();
+	start_save_store();
 	RTE_display_start_screen();
-	while(SHOOT_BUTTON_READ);
+	sequencer_play(&rte_theme_song);
+	wait_shoot_button();
+	sequencer_stop();
 
 	while(1){
 
 		RTE_display_black_background();
+		RTE_seed_random(get_wave_seed());
 		RTE_create_player_spaceship(&PlayerSpaceship);
 		RTE_draw_player_spaceship(&PlayerSpaceship);
 
-		RTE_create_asteroid(&AsteroidVect,Asteroid,numOfAsteroidInWave[currentWave],&PlayerSpaceship);
-		RTE_draw_asteroid(&AsteroidVect);
+		RTE_create_asteroid(&AsteroidStore,numOfAsteroidInWave[currentWave],&PlayerSpaceship);
+		RTE_draw_asteroid(&AsteroidStore);
 		RNG_deinit();
 
 		RTE_start_update_frame();
@@ -49,32 +430,52 @@ int main (void)
 
 			if(frameUpdate == SET){
 
+				updateStart = DWT_get_cycle_count();
+				get_frame_input(&Input);
+				RTE_set_input(&Input);
+
 				RTE_display_score();
 
 				RTE_update_player_spaceship(&PlayerSpaceship);
-				RTE_draw_player_spaceship(&PlayerSpaceship);
 
-				RTE_create_rocket(&RocketVect,Rocket,&PlayerSpaceship);
-				RTE_update_rocket(&RocketVect,&AsteroidVect);
-				RTE_draw_rocket(&RocketVect);
+				RTE_create_rocket(&RocketStore,&PlayerSpaceship);
+				RTE_update_rocket(&RocketStore,&AsteroidStore);
+
+				RTE_update_asteroid(&AsteroidStore,&PlayerSpaceship);
 
-				RTE_update_asteroid(&AsteroidVect,&PlayerSpaceship);
-				RTE_draw_asteroid(&AsteroidVect);
+				/*push only area that changed since last frame*/
+				drawStart = DWT_get_cycle_count();
+				RTE_draw_frame(&PlayerSpaceship,&RocketStore,&AsteroidStore);
+				RTE_measure_frame_latency();
+				send_telemetry(updateStart,drawStart);
+				serve_save_store();
 
 				if(PlayerSpaceship.Object_Property.aliveFlag == RTE_ALIVE_FALSE){
+					check_state();
+					report_latency();
 					PROTOBOARD_GREEN_LED_ON;
 					RTE_display_game_over_screen();
-					while(SHOOT_BUTTON_READ);
+					save_game();
+					sequencer_play(&rte_theme_song);
+					wait_shoot_button();
+					sequencer_stop();
 					RTE_reset_game();
 					PROTOBOARD_GREEN_LED_OFF;
 					break;
 				}
 
-				if(AsteroidVect.total == 0){
+				if(AsteroidStore.total == 0){
 					TIM_ctr(TIM6,STOP);
-					currentWave++;
+					check_state();
+					report_latency();
+
+					/*keep playing last wave once every wave is cleared*/
+					if(currentWave < RTE_NUM_OF_WAVE - 1){
+						currentWave++;
+					}
 					RNG_init();
-					RTE_create_asteroid(&AsteroidVect,Asteroid,numOfAsteroidInWave[currentWave],&PlayerSpaceship);
+					RTE_seed_random(get_wave_seed());
+					RTE_create_asteroid(&AsteroidStore,numOfAsteroidInWave[currentWave],&PlayerSpaceship);
 					TIM_ctr(TIM6,START);
 				}
 
@@ -84,6 +485,28 @@ int main (void)
 	}
 }
 
+#ifdef RTE_SAVE_TO_EEPROM
+void I2C1_EV_IRQHandler (void)
+{
+	I2C_event_intrpt_handler(&I2C1Handle);
+}
+
+void I2C1_ER_IRQHandler (void)
+{
+	I2C_err_intrpt_handler(&I2C1Handle);
+}
+
+void DMA1_Stream7_IRQHandler (void)
+{
+	I2C_DMA_TX_intrpt_handler(&I2C1Handle);
+}
+
+void DMA1_Stream0_IRQHandler (void)
+{
+	I2C_DMA_RX_intrpt_handler(&I2C1Handle);
+}
+#endif
+
 void HardFault_Handler(void)
 {
 	PROTOBOARD_RED_LED_ON;
@@ -0,0 +1,310 @@
+/**
+*@file save_store.c
+*@brief Keep high score table and player progress in I2C EEPROM without stalling frames.
+*
+*This implementation file provide functions for loading newest valid copy of every record at boot, keeping records in RAM and writing
+*dirty records to next slot of their ring, one EEPROM operation per call to save_store_service.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "save_store.h"
+#include "../Miscellaneous/inc/byte_pack.h"
+
+#define SAVE_STORE_CRC_OFFSET			(SAVE_STORE_SLOT_SIZE - 2)
+
+static void save_store_load(save_store *store);
+static void save_store_set_defaults(save_store *store, uint8_t record);
+static uint8_t save_store_check_slot(save_store *store, const uint8_t *slotPtr, uint8_t record);
+static void save_store_decode(save_store *store, const uint8_t *slotPtr, uint8_t record);
+static void save_store_encode(save_store *store, uint8_t *slotPtr, uint8_t record, uint16_t sequence);
+static void save_store_start_write(save_store *store);
+static void save_store_mark_dirty(save_store *store, uint8_t record);
+
+/***********************************************************************
+Initialize store with default records and start boot read of EEPROM area at baseAddress (page aligned)
+***********************************************************************/
+void save_store_init(save_store *store, EEPROM_Handle_t *eeprom, uint16_t baseAddress)
+{
+	store->eeprom = eeprom;
+	store->baseAddress = baseAddress;
+	store->loadRetries = 0;
+	store->dirty = 0;
+	store->delay = 0;
+	store->flushFlag = 0;
+	store->numOfWrites = 0;
+	store->numOfFailedWrites = 0;
+	store->numOfCorruptSlots = 0;
+
+	for(uint8_t record = 0; record < SAVE_STORE_NUM_OF_RECORDS; record++){
+		save_store_set_defaults(store,record);
+	}
+
+	store->state = SAVE_STORE_LOADING;
+	store->reading = (eeprom_read(eeprom,baseAddress,store->image,SAVE_STORE_SIZE) == EEPROM_OK);
+}
+
+/***********************************************************************
+Go on with boot read or write of dirty records, call once per frame after drawing, return state (refer to @SAVE_STORE_STATE)
+***********************************************************************/
+uint8_t save_store_service(save_store *store)
+{
+	if(store->state == SAVE_STORE_OFFLINE){
+		return store->state;
+	}
+
+	if(eeprom_busy_check(store->eeprom)){
+		return store->state;
+	}
+
+	if(store->state == SAVE_STORE_LOADING){
+		if(!store->reading){
+			/*I2C queue was full*/
+			store->reading = (eeprom_read(store->eeprom,store->baseAddress,store->image,SAVE_STORE_SIZE) == EEPROM_OK);
+		}else if(store->eeprom->result == I2C_TRANSACTION_OK){
+			save_store_load(store);
+			store->state = SAVE_STORE_IDLE;
+		}else if(++store->loadRetries < SAVE_STORE_LOAD_RETRIES){
+			store->reading = (eeprom_read(store->eeprom,store->baseAddress,store->image,SAVE_STORE_SIZE) == EEPROM_OK);
+		}else{
+			/*writing without knowing newest copies could hide newer records behind older sequence numbers*/
+			store->state = SAVE_STORE_OFFLINE;
+		}
+		return store->state;
+	}
+
+	if(store->state == SAVE_STORE_WRITING){
+		uint8_t record = store->writing;
+
+		if(store->eeprom->result == I2C_TRANSACTION_OK){
+			store->slot[record] = (store->slot[record] + 1) % SAVE_STORE_NUM_OF_SLOTS;
+			store->sequence[record]++;
+			store->numOfWrites++;
+		}else{
+			/*same slot is written again after delay*/
+			store->numOfFailedWrites++;
+			store->flushFlag = 0;
+			save_store_mark_dirty(store,record);
+		}
+		store->state = SAVE_STORE_IDLE;
+		return store->state;
+	}
+
+	if(store->dirty){
+		if(store->delay && !store->flushFlag){
+			store->delay--;
+		}else{
+			save_store_start_write(store);
+		}
+	}else{
+		store->flushFlag = 0;
+	}
+
+	return store->state;
+}
+
+/***********************************************************************
+Add game result to records, return rank of score in high score table (0 for best) or SAVE_STORE_NOT_RANKED
+***********************************************************************/
+uint8_t save_store_add_game(save_store *store, int16_t score, uint8_t wave)
+{
+	uint8_t rank;
+
+	store->numOfGames++;
+	if(wave > store->bestWave){
+		store->bestWave = wave;
+	}
+	save_store_mark_dirty(store,SAVE_STORE_PROGRESS);
+
+	for(rank = 0; rank < SAVE_STORE_NUM_OF_SCORES; rank++){
+		if(score > store->highScores[rank].score){
+			break;
+		}
+	}
+
+	if(rank == SAVE_STORE_NUM_OF_SCORES){
+		return SAVE_STORE_NOT_RANKED;
+	}
+
+	for(uint8_t i = SAVE_STORE_NUM_OF_SCORES - 1; i > rank; i--){
+		store->highScores[i] = store->highScores[i - 1];
+	}
+	store->highScores[rank].score = score;
+	store->highScores[rank].wave = wave;
+	save_store_mark_dirty(store,SAVE_STORE_HIGH_SCORES);
+
+	return rank;
+}
+
+/***********************************************************************
+Write dirty records on next calls without waiting for delay
+***********************************************************************/
+void save_store_flush(save_store *store)
+{
+	if(store->dirty){
+		store->flushFlag = 1;
+	}
+}
+
+/***********************************************************************
+Take newest valid copy of every record from area read at boot
+***********************************************************************/
+static void save_store_load(save_store *store)
+{
+	for(uint8_t record = 0; record < SAVE_STORE_NUM_OF_RECORDS; record++){
+		const uint8_t *newestPtr = 0;
+
+		for(uint8_t slot = 0; slot < SAVE_STORE_NUM_OF_SLOTS; slot++){
+			const uint8_t *slotPtr = &store->image[(record*SAVE_STORE_NUM_OF_SLOTS + slot)*SAVE_STORE_SLOT_SIZE];
+			uint16_t sequence = (uint16_t)byte_pack_get_value(&slotPtr[2],2);
+
+			if(!save_store_check_slot(store,slotPtr,record)){
+				continue;
+			}
+
+			/*sequence numbers wrap around, newest is ahead of the others by less than half the range*/
+			if(newestPtr == 0 || (int16_t)(sequence - store->sequence[record]) > 0){
+				newestPtr = slotPtr;
+				store->slot[record] = slot;
+				store->sequence[record] = sequence;
+			}
+		}
+
+		if(newestPtr != 0){
+			save_store_decode(store,newestPtr,record);
+		}
+	}
+}
+
+/***********************************************************************
+Default record (also used when no slot is valid), first write go to slot 0
+***********************************************************************/
+static void save_store_set_defaults(save_store *store, uint8_t record)
+{
+	store->slot[record] = SAVE_STORE_NUM_OF_SLOTS - 1;
+	store->sequence[record] = 0;
+
+	if(record == SAVE_STORE_HIGH_SCORES){
+		for(uint8_t i = 0; i < SAVE_STORE_NUM_OF_SCORES; i++){
+			store->highScores[i].score = 0;
+			store->highScores[i].wave = 0;
+		}
+	}else{
+		store->numOfGames = 0;
+		store->bestWave = 0;
+	}
+}
+
+/***********************************************************************
+Check magic, type and CRC of slot, return 1 if slot hold a copy of record (erased slot is not counted as corrupt)
+***********************************************************************/
+static uint8_t save_store_check_slot(save_store *store, const uint8_t *slotPtr, uint8_t record)
+{
+	uint8_t erased = 1;
+
+	if(slotPtr[0] == SAVE_STORE_MAGIC && slotPtr[1] == record
+		&& byte_pack_crc16(slotPtr,SAVE_STORE_CRC_OFFSET) == ((slotPtr[SAVE_STORE_CRC_OFFSET] << 8) | slotPtr[SAVE_STORE_CRC_OFFSET + 1])){
+		return 1;
+	}
+
+	for(uint8_t i = 0; i < SAVE_STORE_SLOT_SIZE; i++){
+		if(slotPtr[i] != 0xFF){
+			erased = 0;
+		}
+	}
+
+	if(!erased){
+		store->numOfCorruptSlots++;
+	}
+
+	return 0;
+}
+
+/***********************************************************************
+Unpack payload of valid slot into record
+***********************************************************************/
+static void save_store_decode(save_store *store, const uint8_t *slotPtr, uint8_t record)
+{
+	const uint8_t *bytePtr = &slotPtr[4];
+
+	if(record == SAVE_STORE_HIGH_SCORES){
+		for(uint8_t i = 0; i < SAVE_STORE_NUM_OF_SCORES; i++){
+			store->highScores[i].score = (int16_t)byte_pack_get_value(bytePtr,2);
+			store->highScores[i].wave = bytePtr[2];
+			bytePtr += 3;
+		}
+	}else{
+		store->numOfGames = byte_pack_get_value(bytePtr,4);
+		store->bestWave = bytePtr[4];
+	}
+}
+
+/***********************************************************************
+Pack record into slot with header and CRC, unused payload bytes are 0
+***********************************************************************/
+static void save_store_encode(save_store *store, uint8_t *slotPtr, uint8_t record, uint16_t sequence)
+{
+	uint8_t *bytePtr = slotPtr;
+	uint16_t crc;
+
+	*bytePtr++ = SAVE_STORE_MAGIC;
+	*bytePtr++ = record;
+	bytePtr = byte_pack_put_value(bytePtr,sequence,2);
+
+	for(uint8_t i = 0; i < SAVE_STORE_PAYLOAD_SIZE; i++){
+		bytePtr[i] = 0;
+	}
+
+	if(record == SAVE_STORE_HIGH_SCORES){
+		for(uint8_t i = 0; i < SAVE_STORE_NUM_OF_SCORES; i++){
+			bytePtr = byte_pack_put_value(bytePtr,(uint16_t)store->highScores[i].score,2);
+			*bytePtr++ = store->highScores[i].wave;
+		}
+	}else{
+		bytePtr = byte_pack_put_value(bytePtr,store->numOfGames,4);
+		*bytePtr = store->bestWave;
+	}
+
+	crc = byte_pack_crc16(slotPtr,SAVE_STORE_CRC_OFFSET);
+	slotPtr[SAVE_STORE_CRC_OFFSET] = (uint8_t)(crc >> 8);
+	slotPtr[SAVE_STORE_CRC_OFFSET + 1] = (uint8_t)crc;
+}
+
+/***********************************************************************
+Write first dirty record to slot after its newest copy (dirty bit is set again if write fail)
+***********************************************************************/
+static void save_store_start_write(save_store *store)
+{
+	uint8_t slotData[SAVE_STORE_SLOT_SIZE];
+	uint8_t record = 0;
+	uint8_t slot;
+
+	while(!(store->dirty & (1 << record))){
+		record++;
+	}
+
+	slot = (store->slot[record] + 1) % SAVE_STORE_NUM_OF_SLOTS;
+	save_store_encode(store,slotData,record,store->sequence[record] + 1);
+
+	if(eeprom_write_page(store->eeprom,store->baseAddress + (record*SAVE_STORE_NUM_OF_SLOTS + slot)*SAVE_STORE_SLOT_SIZE,slotData,SAVE_STORE_SLOT_SIZE) != EEPROM_OK){
+		return;
+	}
+
+	/*record changed during write is written again*/
+	store->dirty &= ~(1 << record);
+	store->writing = record;
+	store->state = SAVE_STORE_WRITING;
+}
+
+/***********************************************************************
+Mark record as changed, delay start with first change so that following changes are batched into same write
+***********************************************************************/
+static void save_store_mark_dirty(save_store *store, uint8_t record)
+{
+	if(!store->dirty){
+		store->delay = SAVE_STORE_WRITE_DELAY;
+	}
+
+	store->dirty |= 1 << record;
+}
@@ -0,0 +1,90 @@
+/**
+*@file save_store.h
+*@brief Keep high score table and player progress in I2C EEPROM without stalling frames.
+*
+*This header file provide functions for loading records (high score table, player progress) from EEPROM at boot and writing them back
+*behind the game: records are changed in RAM and marked dirty, save_store_service (called once per frame, after drawing) write dirty
+*records SAVE_STORE_WRITE_DELAY frames later so that changes close in time are batched into one write, and never start more than one
+*EEPROM operation per call. A page write and its write cycle (up to 5ms) run in background, they are polled on next calls.
+*
+*EEPROM area (SAVE_STORE_SIZE bytes from baseAddress, page aligned) hold SAVE_STORE_NUM_OF_SLOTS slots of one page for every record,
+*slots of a record are written in turn (wear leveling: every page take 1/SAVE_STORE_NUM_OF_SLOTS of writes) and copy with newest
+*sequence number is loaded. Whole area is loaded in one sequential read. A write cut by power loss leave a slot with wrong CRC, it is
+*skipped and previous copy is loaded, so a record is always the old or the new one.
+*Slot:	magic (1 byte), record type (1 byte), sequence (2 bytes), payload (SAVE_STORE_PAYLOAD_SIZE bytes),
+*		CRC-16/CCITT-FALSE of previous bytes (high byte first), little endian values
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef SAVE_STORE_H
+#define SAVE_STORE_H
+
+#include <stdint.h>
+#include "../Device_drivers/inc/eeprom.h"
+
+#define SAVE_STORE_SLOT_SIZE		32	/*one EEPROM page (24C32)*/
+#define SAVE_STORE_PAYLOAD_SIZE		(SAVE_STORE_SLOT_SIZE - 6)
+#define SAVE_STORE_NUM_OF_SLOTS		8
+#define SAVE_STORE_NUM_OF_RECORDS	2
+#define SAVE_STORE_SIZE				(SAVE_STORE_NUM_OF_RECORDS*SAVE_STORE_NUM_OF_SLOTS*SAVE_STORE_SLOT_SIZE)
+#define SAVE_STORE_MAGIC			0x5A
+#define SAVE_STORE_NUM_OF_SCORES	8
+#define SAVE_STORE_WRITE_DELAY		30	/*frames between first change of a record and its write*/
+#define SAVE_STORE_LOAD_RETRIES		3
+#define SAVE_STORE_NOT_RANKED		0xFF
+
+/*
+*@SAVE_STORE_RECORD
+*/
+#define SAVE_STORE_HIGH_SCORES	0
+#define SAVE_STORE_PROGRESS		1
+
+/*
+*@SAVE_STORE_STATE
+*/
+#define SAVE_STORE_LOADING	0	/*boot read running*/
+#define SAVE_STORE_IDLE		1
+#define SAVE_STORE_WRITING	2	/*page write or write cycle running*/
+#define SAVE_STORE_OFFLINE	3	/*EEPROM could not be read, records are only kept in RAM*/
+
+typedef struct save_high_score {
+	int16_t score;
+	uint8_t wave;	/*wave reached, 1 for first wave*/
+} save_high_score;
+
+typedef struct save_store {
+	EEPROM_Handle_t *eeprom;
+	uint16_t baseAddress;
+	uint8_t state;
+	uint8_t reading;	/*boot read queued*/
+	uint8_t loadRetries;
+
+	/*records*/
+	save_high_score highScores[SAVE_STORE_NUM_OF_SCORES];	/*best first*/
+	uint32_t numOfGames;
+	uint8_t bestWave;
+
+	/*newest copy of every record*/
+	uint8_t slot[SAVE_STORE_NUM_OF_RECORDS];
+	uint16_t sequence[SAVE_STORE_NUM_OF_RECORDS];
+
+	uint8_t dirty;	/*bit per record changed since its last write*/
+	uint8_t writing;	/*record being written*/
+	uint8_t delay;	/*frames left before dirty records are written*/
+	uint8_t flushFlag;	/*write dirty records without delay*/
+
+	uint8_t image[SAVE_STORE_SIZE];	/*EEPROM area read at boot*/
+
+	uint32_t numOfWrites;
+	uint32_t numOfFailedWrites;	/*page writes not acknowledged, record is written again*/
+	uint32_t numOfCorruptSlots;	/*slots found at boot with wrong CRC or type (not erased)*/
+} save_store;
+
+void save_store_init(save_store *, EEPROM_Handle_t *eeprom, uint16_t baseAddress);
+uint8_t save_store_service(save_store *);
+uint8_t save_store_add_game(save_store *, int16_t score, uint8_t wave);
+void save_store_flush(save_store *);
+
+#endif
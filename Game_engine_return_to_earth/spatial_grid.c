@@ -0,0 +1,216 @@
+/**
+*@file spatial_grid.c
+*@brief Provide uniform grid for finding objects which may collide.
+*
+*This implementation file provide functions for sorting objects into square cells of screen and finding objects near a given area.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include <string.h>
+
+#include "spatial_grid.h"
+
+static int32_t spatial_grid_wrap(int32_t value, uint16_t size);
+static uint32_t spatial_grid_cell_mask(int16_t position, uint16_t length, uint16_t size, uint8_t numOfCells);
+static uint8_t spatial_grid_span_overlap(int16_t a, uint16_t aLength, int16_t b, uint16_t bLength, uint16_t size);
+
+/***********************************************************************
+Initialize empty grid covering screen with given size
+***********************************************************************/
+void spatial_grid_init(spatial_grid *grid, uint16_t screenWidth, uint16_t screenHeight)
+{
+	grid->screenWidth = screenWidth;
+	grid->screenHeight = screenHeight;
+
+	grid->numOfColumns = (screenWidth + SPATIAL_GRID_CELL_SIZE - 1) / SPATIAL_GRID_CELL_SIZE;
+	grid->numOfRows = (screenHeight + SPATIAL_GRID_CELL_SIZE - 1) / SPATIAL_GRID_CELL_SIZE;
+
+	if(grid->numOfColumns > SPATIAL_GRID_MAX_COLUMNS){
+		grid->numOfColumns = SPATIAL_GRID_MAX_COLUMNS;
+	}
+
+	if(grid->numOfRows > SPATIAL_GRID_MAX_ROWS){
+		grid->numOfRows = SPATIAL_GRID_MAX_ROWS;
+	}
+
+	memset(grid->queryStamp,0,sizeof(grid->queryStamp));
+	grid->currentStamp = 0;
+
+	spatial_grid_clear(grid);
+}
+
+/***********************************************************************
+Remove all objects from grid
+***********************************************************************/
+void spatial_grid_clear(spatial_grid *grid)
+{
+	for(int i = 0; i < grid->numOfColumns * grid->numOfRows; i++){
+		grid->cellHead[i] = -1;
+	}
+
+	grid->totalEntries = 0;
+}
+
+/***********************************************************************
+Add object to every cell its area touch
+***********************************************************************/
+uint8_t spatial_grid_insert(spatial_grid *grid, uint16_t id, int16_t x, int16_t y, uint16_t width, uint16_t height)
+{
+	uint32_t columnMask = spatial_grid_cell_mask(x,width,grid->screenWidth,grid->numOfColumns);
+	uint32_t rowMask = spatial_grid_cell_mask(y,height,grid->screenHeight,grid->numOfRows);
+
+	if(id >= SPATIAL_GRID_MAX_IDS){
+		return SPATIAL_GRID_FULL;
+	}
+
+	for(uint8_t row = 0; row < grid->numOfRows; row++){
+		if(!(rowMask & (1UL << row))){
+			continue;
+		}
+
+		for(uint8_t column = 0; column < grid->numOfColumns; column++){
+			if(!(columnMask & (1UL << column))){
+				continue;
+			}
+
+			if(grid->totalEntries == SPATIAL_GRID_MAX_ENTRIES){
+				return SPATIAL_GRID_FULL;
+			}
+
+			int cell = row * grid->numOfColumns + column;
+
+			grid->entryId[grid->totalEntries] = id;
+			grid->entryNext[grid->totalEntries] = grid->cellHead[cell];
+			grid->cellHead[cell] = grid->totalEntries;
+			grid->totalEntries++;
+		}
+	}
+
+	return SPATIAL_GRID_OK;
+}
+
+/***********************************************************************
+Find objects sharing a cell with given area (each id is reported once)
+***********************************************************************/
+uint16_t spatial_grid_query(spatial_grid *grid, int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t *idBufferPtr, uint16_t bufferSize)
+{
+	uint32_t columnMask = spatial_grid_cell_mask(x,width,grid->screenWidth,grid->numOfColumns);
+	uint32_t rowMask = spatial_grid_cell_mask(y,height,grid->screenHeight,grid->numOfRows);
+	uint16_t numOfIds = 0;
+
+	/*ids already reported in this query are marked with current stamp, reset all marks when stamp wrap around*/
+	grid->currentStamp++;
+	if(grid->currentStamp == 0){
+		memset(grid->queryStamp,0,sizeof(grid->queryStamp));
+		grid->currentStamp = 1;
+	}
+
+	for(uint8_t row = 0; row < grid->numOfRows; row++){
+		if(!(rowMask & (1UL << row))){
+			continue;
+		}
+
+		for(uint8_t column = 0; column < grid->numOfColumns; column++){
+			if(!(columnMask & (1UL << column))){
+				continue;
+			}
+
+			for(int16_t entry = grid->cellHead[row * grid->numOfColumns + column]; entry >= 0; entry = grid->entryNext[entry]){
+				uint16_t id = grid->entryId[entry];
+
+				if(grid->queryStamp[id] != grid->currentStamp){
+					grid->queryStamp[id] = grid->currentStamp;
+
+					if(numOfIds == bufferSize){
+						return numOfIds;
+					}
+
+					idBufferPtr[numOfIds++] = id;
+				}
+			}
+		}
+	}
+
+	return numOfIds;
+}
+
+/***********************************************************************
+Check whether 2 areas overlap (wrap around screen edges is considered)
+***********************************************************************/
+uint8_t spatial_grid_overlap(const spatial_grid *grid, int16_t x1, int16_t y1, uint16_t width1, uint16_t height1, int16_t x2, int16_t y2, uint16_t width2, uint16_t height2)
+{
+	if(spatial_grid_span_overlap(x1,width1,x2,width2,grid->screenWidth)
+		&& spatial_grid_span_overlap(y1,height1,y2,height2,grid->screenHeight)){
+		return SPATIAL_GRID_OVERLAP_TRUE;
+	}
+
+	return SPATIAL_GRID_OVERLAP_FALSE;
+}
+
+/***********************************************************************
+Private function: Wrap coordinate into 0 to (size - 1)
+***********************************************************************/
+int32_t spatial_grid_wrap(int32_t value, uint16_t size)
+{
+	value %= size;
+
+	if(value < 0){
+		value += size;
+	}
+
+	return value;
+}
+
+/***********************************************************************
+Private function: Get bit mask of cells touched by a span on a wrapping axis
+***********************************************************************/
+uint32_t spatial_grid_cell_mask(int16_t position, uint16_t length, uint16_t size, uint8_t numOfCells)
+{
+	uint32_t mask = 0;
+
+	if(length == 0){
+		return 0;
+	}
+
+	if(length >= size){
+		return (numOfCells >= 32) ? 0xFFFFFFFF : ((1UL << numOfCells) - 1);
+	}
+
+	int32_t start = spatial_grid_wrap(position,size);
+	int32_t end = start + length - 1;
+
+	/*span going past screen edge continue from 0, screen size may not be a multiple of cell size*/
+	if(end >= size){
+		for(int32_t cell = 0; cell <= (end - size) / SPATIAL_GRID_CELL_SIZE; cell++){
+			mask |= 1UL << cell;
+		}
+		end = size - 1;
+	}
+
+	for(int32_t cell = start / SPATIAL_GRID_CELL_SIZE; cell <= end / SPATIAL_GRID_CELL_SIZE && cell < numOfCells; cell++){
+		mask |= 1UL << cell;
+	}
+
+	return mask;
+}
+
+/***********************************************************************
+Private function: Check whether 2 spans on a wrapping axis overlap
+***********************************************************************/
+uint8_t spatial_grid_span_overlap(int16_t a, uint16_t aLength, int16_t b, uint16_t bLength, uint16_t size)
+{
+	if(aLength >= size || bLength >= size){
+		return SPATIAL_GRID_OVERLAP_TRUE;
+	}
+
+	/*distance from start of span a to start of span b going in positive direction*/
+	int32_t distance = spatial_grid_wrap((int32_t)b - a,size);
+
+	if(distance < aLength || distance > size - bLength){
+		return SPATIAL_GRID_OVERLAP_TRUE;
+	}
+
+	return SPATIAL_GRID_OVERLAP_FALSE;
+}
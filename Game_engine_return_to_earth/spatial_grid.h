@@ -0,0 +1,58 @@
+/**
+*@file spatial_grid.h
+*@brief Provide uniform grid for finding objects which may collide.
+*
+*This header file provide functions for sorting objects into square cells of screen, so that collision only need to be checked between objects sharing a cell.
+*Coordinates wrap around screen edges (object going off screen appear on the opposite side).
+*Capacity can be changed by defining SPATIAL_GRID_MAX_IDS and SPATIAL_GRID_MAX_ENTRIES in project options (same value for every file).
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include <stdint.h>
+
+/*side of a cell in pixel, about size of the largest object*/
+#define SPATIAL_GRID_CELL_SIZE		32
+#define SPATIAL_GRID_MAX_COLUMNS	16
+#define SPATIAL_GRID_MAX_ROWS		16
+
+/*number of different object ids (id must be less than this value)*/
+#ifndef SPATIAL_GRID_MAX_IDS
+#define SPATIAL_GRID_MAX_IDS		256
+#endif
+
+/*number of (object,cell) pairs, object 2 cells wide and 2 cells high take 4 entries*/
+#ifndef SPATIAL_GRID_MAX_ENTRIES
+#define SPATIAL_GRID_MAX_ENTRIES	1024
+#endif
+
+#define SPATIAL_GRID_OK		0
+#define SPATIAL_GRID_FULL	1
+
+#define SPATIAL_GRID_OVERLAP_TRUE	1
+#define SPATIAL_GRID_OVERLAP_FALSE	0
+
+typedef struct spatial_grid {
+	int16_t cellHead[SPATIAL_GRID_MAX_COLUMNS * SPATIAL_GRID_MAX_ROWS];
+	int16_t entryNext[SPATIAL_GRID_MAX_ENTRIES];
+	uint16_t entryId[SPATIAL_GRID_MAX_ENTRIES];
+	uint16_t queryStamp[SPATIAL_GRID_MAX_IDS];
+	uint16_t currentStamp;
+	int totalEntries;
+	uint16_t screenWidth;
+	uint16_t screenHeight;
+	uint8_t numOfColumns;
+	uint8_t numOfRows;
+} spatial_grid;
+
+void spatial_grid_init(spatial_grid *, uint16_t screenWidth, uint16_t screenHeight);
+void spatial_grid_clear(spatial_grid *);
+uint8_t spatial_grid_insert(spatial_grid *, uint16_t id, int16_t x, int16_t y, uint16_t width, uint16_t height);
+uint16_t spatial_grid_query(spatial_grid *, int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t *idBufferPtr, uint16_t bufferSize);
+uint8_t spatial_grid_overlap(const spatial_grid *, int16_t x1, int16_t y1, uint16_t width1, uint16_t height1, int16_t x2, int16_t y2, uint16_t width2, uint16_t height2);
+
+#endif
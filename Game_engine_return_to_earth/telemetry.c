@@ -0,0 +1,215 @@
+/**
+*@file telemetry.c
+*@brief Provide compact binary stream of frame time counters.
+*
+*This implementation file provide functions for summarizing frames into packets, framing packets with CRC and COBS, and decoding them back.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "telemetry.h"
+#include "../Miscellaneous/inc/byte_pack.h"
+
+#define TELEMETRY_COBS_MAX_CODE		0xFF	/*code of a block of 254 non-zero bytes not followed by 0x00*/
+
+static void telemetry_send_packet(telemetry_writer *writer);
+static uint16_t telemetry_cobs_encode(const uint8_t *srcPtr, uint16_t length, uint8_t *destPtr);
+static uint16_t telemetry_cobs_decode(const uint8_t *srcPtr, uint16_t length, uint8_t *destPtr);
+
+/***********************************************************************
+Initialize writer sending one packet every period frames (0 is taken as 1) to output function
+***********************************************************************/
+void telemetry_writer_init(telemetry_writer *writer, telemetry_output output, uint8_t period)
+{
+	writer->output = output;
+	writer->period = period ? period : 1;
+	writer->summary.numOfFrames = 0;
+	writer->numOfPackets = 0;
+	writer->numOfDropped = 0;
+	writer->numOfBytes = 0;
+}
+
+/***********************************************************************
+Add counters of one frame, packet is sent when period frames were added
+***********************************************************************/
+void telemetry_write_frame(telemetry_writer *writer, const telemetry_frame *frame)
+{
+	telemetry_frame *summary = &writer->summary;
+
+	if(!summary->numOfFrames){
+		*summary = *frame;
+		summary->numOfFrames = 1;
+	}else{
+		if(frame->updateCycles > summary->updateCycles){
+			summary->updateCycles = frame->updateCycles;
+		}
+		if(frame->drawCycles > summary->drawCycles){
+			summary->drawCycles = frame->drawCycles;
+		}
+		if(frame->collisionCycles > summary->collisionCycles){
+			summary->collisionCycles = frame->collisionCycles;
+		}
+
+		summary->SPIbytes += frame->SPIbytes;
+		summary->frameNumber = frame->frameNumber;
+		summary->numOfAsteroids = frame->numOfAsteroids;
+		summary->numOfRockets = frame->numOfRockets;
+		summary->audioUnderruns = frame->audioUnderruns;
+		summary->numOfFrames++;
+	}
+
+	if(summary->numOfFrames >= writer->period){
+		telemetry_send_packet(writer);
+		summary->numOfFrames = 0;
+	}
+}
+
+/***********************************************************************
+Initialize reader waiting for first packet (bytes before first delimiter are dropped as a corrupted packet)
+***********************************************************************/
+void telemetry_reader_init(telemetry_reader *reader)
+{
+	reader->length = 0;
+	reader->overflow = 0;
+	reader->numOfPackets = 0;
+	reader->numOfErrors = 0;
+}
+
+/***********************************************************************
+Read next byte of stream, frame is filled when result is TELEMETRY_PACKET
+***********************************************************************/
+uint8_t telemetry_read_byte(telemetry_reader *reader, uint8_t byte, telemetry_frame *frame)
+{
+	uint8_t payload[TELEMETRY_MAX_PACKET_SIZE];
+	uint16_t length;
+
+	if(byte){
+		if(reader->length < TELEMETRY_MAX_PACKET_SIZE){
+			reader->buffer[reader->length++] = byte;
+		}else{
+			reader->overflow = 1;
+		}
+		return TELEMETRY_NONE;
+	}
+
+	/*delimiter, empty packet is only a delimiter sent again*/
+	if(!reader->length && !reader->overflow){
+		return TELEMETRY_NONE;
+	}
+
+	length = reader->overflow ? 0 : telemetry_cobs_decode(reader->buffer,reader->length,payload);
+	reader->length = 0;
+	reader->overflow = 0;
+
+	if(length != TELEMETRY_PAYLOAD_SIZE + TELEMETRY_CRC_SIZE || payload[0] != TELEMETRY_VERSION
+		|| byte_pack_crc16(payload,TELEMETRY_PAYLOAD_SIZE) != ((payload[TELEMETRY_PAYLOAD_SIZE] << 8) | payload[TELEMETRY_PAYLOAD_SIZE + 1])){
+		reader->numOfErrors++;
+		return TELEMETRY_ERROR;
+	}
+
+	frame->numOfFrames = payload[1];
+	frame->frameNumber = byte_pack_get_value(&payload[2],4);
+	frame->updateCycles = byte_pack_get_value(&payload[6],4);
+	frame->drawCycles = byte_pack_get_value(&payload[10],4);
+	frame->collisionCycles = byte_pack_get_value(&payload[14],4);
+	frame->SPIbytes = byte_pack_get_value(&payload[18],4);
+	frame->numOfAsteroids = byte_pack_get_value(&payload[22],2);
+	frame->numOfRockets = byte_pack_get_value(&payload[24],2);
+	frame->audioUnderruns = byte_pack_get_value(&payload[26],2);
+
+	reader->numOfPackets++;
+	return TELEMETRY_PACKET;
+}
+
+/***********************************************************************
+Pack summary into payload, frame it and pass it to output
+***********************************************************************/
+static void telemetry_send_packet(telemetry_writer *writer)
+{
+	const telemetry_frame *summary = &writer->summary;
+	uint8_t payload[TELEMETRY_PAYLOAD_SIZE + TELEMETRY_CRC_SIZE];
+	uint8_t *bytePtr = payload;
+	uint16_t crc;
+	uint16_t length;
+
+	*bytePtr++ = TELEMETRY_VERSION;
+	*bytePtr++ = summary->numOfFrames;
+	bytePtr = byte_pack_put_value(bytePtr,summary->frameNumber,4);
+	bytePtr = byte_pack_put_value(bytePtr,summary->updateCycles,4);
+	bytePtr = byte_pack_put_value(bytePtr,summary->drawCycles,4);
+	bytePtr = byte_pack_put_value(bytePtr,summary->collisionCycles,4);
+	bytePtr = byte_pack_put_value(bytePtr,summary->SPIbytes,4);
+	bytePtr = byte_pack_put_value(bytePtr,summary->numOfAsteroids,2);
+	bytePtr = byte_pack_put_value(bytePtr,summary->numOfRockets,2);
+	bytePtr = byte_pack_put_value(bytePtr,summary->audioUnderruns,2);
+
+	crc = byte_pack_crc16(payload,TELEMETRY_PAYLOAD_SIZE);
+	*bytePtr++ = (uint8_t)(crc >> 8);
+	*bytePtr = (uint8_t)crc;
+
+	length = telemetry_cobs_encode(payload,sizeof(payload),writer->packet);
+	writer->packet[length++] = 0x00;
+
+	if(writer->output(writer->packet,length)){
+		writer->numOfPackets++;
+		writer->numOfBytes += length;
+	}else{
+		writer->numOfDropped++;
+	}
+}
+
+/***********************************************************************
+COBS encode (every 0x00 is replaced by distance to next one), return encoded length (length + 1 for less than 254 bytes)
+***********************************************************************/
+static uint16_t telemetry_cobs_encode(const uint8_t *srcPtr, uint16_t length, uint8_t *destPtr)
+{
+	uint16_t codeIndex = 0;
+	uint16_t destIndex = 1;
+	uint8_t code = 1;
+
+	for(uint16_t i = 0; i < length; i++){
+		if(srcPtr[i]){
+			destPtr[destIndex++] = srcPtr[i];
+			code++;
+		}
+
+		if(!srcPtr[i] || code == TELEMETRY_COBS_MAX_CODE){
+			destPtr[codeIndex] = code;
+			codeIndex = destIndex++;
+			code = 1;
+		}
+	}
+
+	destPtr[codeIndex] = code;
+
+	return destIndex;
+}
+
+/***********************************************************************
+COBS decode, return decoded length (0 when a code point beyond end of packet)
+***********************************************************************/
+static uint16_t telemetry_cobs_decode(const uint8_t *srcPtr, uint16_t length, uint8_t *destPtr)
+{
+	uint16_t srcIndex = 0;
+	uint16_t destIndex = 0;
+
+	while(srcIndex < length){
+		uint8_t code = srcPtr[srcIndex++];
+
+		if(srcIndex + code - 1 > length){
+			return 0;
+		}
+
+		for(uint8_t i = 1; i < code; i++){
+			destPtr[destIndex++] = srcPtr[srcIndex++];
+		}
+
+		/*last block is not followed by 0x00, neither is a full block*/
+		if(code != TELEMETRY_COBS_MAX_CODE && srcIndex < length){
+			destPtr[destIndex++] = 0x00;
+		}
+	}
+
+	return destIndex;
+}
@@ -0,0 +1,78 @@
+/**
+*@file telemetry.h
+*@brief Provide compact binary stream of frame time counters.
+*
+*This header file provide functions for packing per-frame counters (frame number, cycles spent on update, drawing and collision
+*detection, bytes sent to display, live asteroids and rockets, audio underruns) into small packets and reading them back on PC.
+*Stream is rate limited: one packet summarize period frames, cycle counts are the longest of those frames (spikes are not averaged
+*away), SPI bytes are summed and other counters are taken from last frame. A packet the output can not take at once is dropped and
+*counted, so game never wait for serial line.
+*
+*Packet is TELEMETRY_PAYLOAD_SIZE bytes payload (little endian) followed by CRC-16/CCITT-FALSE of payload (high byte first), encoded
+*with COBS (Consistent Overhead Byte Stuffing, no 0x00 byte inside packet) and ended by 0x00 delimiter. Reader resynchronize on next
+*delimiter after a lost or corrupted byte, at most one packet is lost.
+*Payload:	version (1 byte), numOfFrames (1 byte), frameNumber, updateCycles, drawCycles, collisionCycles, SPIbytes (4 bytes each),
+*			numOfAsteroids, numOfRockets, audioUnderruns (2 bytes each)
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+
+#define TELEMETRY_VERSION			1
+#define TELEMETRY_PAYLOAD_SIZE		28
+#define TELEMETRY_CRC_SIZE			2
+#define TELEMETRY_MAX_PACKET_SIZE	(TELEMETRY_PAYLOAD_SIZE + TELEMETRY_CRC_SIZE + 2)	/*COBS overhead byte and delimiter*/
+
+/*
+*@TELEMETRY_RESULT
+*Result of reading one byte of stream
+*/
+#define TELEMETRY_NONE		0	/*packet is not complete yet*/
+#define TELEMETRY_PACKET	1	/*packet decoded*/
+#define TELEMETRY_ERROR		2	/*packet dropped (bad length, COBS code, CRC or version)*/
+
+/*called with every complete packet, return 0 when packet can not be taken (it is dropped)*/
+typedef uint8_t (*telemetry_output)(const uint8_t *dataPtr, uint16_t length);
+
+typedef struct telemetry_frame {
+	uint32_t frameNumber;
+	uint32_t updateCycles;	/*DWT cycles from input read to end of game update, collision detection included*/
+	uint32_t drawCycles;	/*DWT cycles spent drawing frame*/
+	uint32_t collisionCycles;
+	uint32_t SPIbytes;	/*bytes sent to display*/
+	uint16_t numOfAsteroids;
+	uint16_t numOfRockets;
+	uint16_t audioUnderruns;	/*total since start (wrap around)*/
+	uint8_t numOfFrames;	/*frames summarized by packet, 1 for a single frame*/
+} telemetry_frame;
+
+typedef struct telemetry_writer {
+	telemetry_output output;
+	uint8_t period;	/*frames per packet*/
+	telemetry_frame summary;	/*frames since last packet*/
+	uint8_t packet[TELEMETRY_MAX_PACKET_SIZE];
+	uint32_t numOfPackets;
+	uint32_t numOfDropped;	/*packets output did not take*/
+	uint32_t numOfBytes;
+} telemetry_writer;
+
+typedef struct telemetry_reader {
+	uint8_t buffer[TELEMETRY_MAX_PACKET_SIZE];	/*COBS encoded bytes of current packet*/
+	uint16_t length;
+	uint8_t overflow;	/*current packet is longer than any valid packet, it is dropped at its delimiter*/
+	uint32_t numOfPackets;
+	uint32_t numOfErrors;
+} telemetry_reader;
+
+void telemetry_writer_init(telemetry_writer *, telemetry_output output, uint8_t period);
+void telemetry_write_frame(telemetry_writer *, const telemetry_frame *frame);
+
+void telemetry_reader_init(telemetry_reader *);
+uint8_t telemetry_read_byte(telemetry_reader *, uint8_t byte, telemetry_frame *frame);
+
+#endif
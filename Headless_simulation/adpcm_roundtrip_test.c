@@ -0,0 +1,236 @@
+/**
+*@brief Check IMA ADPCM encoder and streaming decoder on PC
+*
+*This program encode test signals of 12 bits samples with IMA ADPCM (Miscellaneous/src/adpcm.c), like Tools/adpcm_encoder.c
+*does for sound assets, decode them again and check signal to noise ratio of round trip against a minimum for each signal:
+*silence, sinewave, frequency sweep, decaying noise (like explosions of "Return To Earth") and square wave.
+*Each signal is also decoded in blocks of varying size, as speaker driver does while mixing, and compared with decoding at once.
+*Then sound assets of "Return To Earth" are decoded in blocks and at once and compared.
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 Headless_simulation/adpcm_roundtrip_test.c Miscellaneous/src/adpcm.c -lm -o adpcm_roundtrip_test
+*
+*Run:
+*adpcm_roundtrip_test
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../Miscellaneous/inc/adpcm.h"
+#include "../Miscellaneous/inc/rocket_launch.h"
+#include "../Miscellaneous/inc/spaceship_explode.h"
+#include "../Miscellaneous/inc/spaceship_thruster.h"
+#include "../Miscellaneous/inc/spaceship_accelerate.h"
+#include "../Miscellaneous/inc/asteroid_impact.h"
+#include "../Miscellaneous/inc/asteroid_large_explode.h"
+#include "../Miscellaneous/inc/asteroid_medium_explode.h"
+#include <stdio.h>
+#include <math.h>
+
+#define TEST_SAMPLE_RATE		6176	/*speaker_init(DAC_CHANNEL_1,9,679) with 42MHz timer clock*/
+#define TEST_NUM_OF_SAMPLES		8192
+#define SAMPLE_MIDPOINT			2048
+#define SAMPLE_MAX				4095
+#define SAMPLE_SCALE_SHIFT		4
+#define PI						3.14159265358979
+
+typedef struct{
+	const char *name;
+	double minSNR;	/*dB*/
+	uint16_t (*generate)(uint32_t i);
+}Test_Signal_t;
+
+typedef struct{
+	const char *name;
+	const ADPCM_Sound_t *soundPtr;
+}Test_Asset_t;
+
+uint16_t numOfFailures = 0;
+uint32_t noiseState = 1;
+
+uint16_t clip (double sample)
+{
+	if(sample < 0){
+		return 0;
+	}
+
+	if(sample > SAMPLE_MAX){
+		return SAMPLE_MAX;
+	}
+
+	return (uint16_t)lround(sample);
+}
+
+uint16_t silence (uint32_t i)
+{
+	return SAMPLE_MIDPOINT;
+}
+
+uint16_t sinewave (uint32_t i)
+{
+	return clip(SAMPLE_MIDPOINT + 1500*sin(2*PI*440*i/TEST_SAMPLE_RATE));
+}
+
+uint16_t sweep (uint32_t i)
+{
+	double t = (double)i/TEST_SAMPLE_RATE;
+	double duration = (double)TEST_NUM_OF_SAMPLES/TEST_SAMPLE_RATE;
+
+	/*100Hz to 4kHz*/
+	return clip(SAMPLE_MIDPOINT + 1500*sin(2*PI*(100*t + (4000 - 100)*t*t/(2*duration))));
+}
+
+uint16_t decaying_noise (uint32_t i)
+{
+	noiseState ^= noiseState << 13;
+	noiseState ^= noiseState >> 17;
+	noiseState ^= noiseState << 5;
+
+	/*low pass filtered noise, like recorded explosion*/
+	static double filtered = 0;
+	filtered = 0.8*filtered + 0.2*((double)(noiseState & 0xFFF) - SAMPLE_MIDPOINT);
+
+	return clip(SAMPLE_MIDPOINT + 3*filtered*exp(-3.0*i/TEST_NUM_OF_SAMPLES));
+}
+
+uint16_t square (uint32_t i)
+{
+	return ((i*200*2/TEST_SAMPLE_RATE) & 0x01) ? SAMPLE_MIDPOINT + 1000 : SAMPLE_MIDPOINT - 1000;
+}
+
+Test_Signal_t signal[] = {
+	{"silence",INFINITY,silence},
+	{"sinewave 440Hz",25,sinewave},
+	{"sweep 100Hz to 4kHz",18,sweep},
+	{"decaying noise",18,decaying_noise},
+	{"square wave 200Hz",5,square},	/*edges ring while step size adapt*/
+};
+
+Test_Asset_t asset[] = {
+	{"rocket_launch",&rocket_launch},
+	{"spaceship_explode",&spaceship_explode},
+	{"spaceship_thruster",&spaceship_thruster},
+	{"spaceship_accelerate",&spaceship_accelerate},
+	{"asteroid_impact",&asteroid_impact},
+	{"asteroid_large_explode",&asteroid_large_explode},
+	{"asteroid_medium_explode",&asteroid_medium_explode},
+};
+
+/*decode in blocks of 1 to 37 samples and compare with samples decoded at once, return 0 when they differ*/
+uint8_t check_streaming (const ADPCM_Sound_t *SoundPtr, const int16_t *decodedPtr)
+{
+	ADPCM_State_t state = SoundPtr->initialState;
+	int16_t block[37];
+	uint32_t position = 0;
+	uint16_t blockSize = 1;
+
+	while(position < SoundPtr->numOfSamples){
+		uint16_t count = (SoundPtr->numOfSamples - position < blockSize) ? SoundPtr->numOfSamples - position : blockSize;
+
+		adpcm_decode_block(&state,SoundPtr->dataPtr,position,block,count);
+
+		for(uint16_t i = 0; i < count; i++){
+			if(block[i] != decodedPtr[position + i]){
+				printf("  FAIL: sample %u decoded in blocks is %d, decoded at once %d\n",position + i,block[i],decodedPtr[position + i]);
+				return 0;
+			}
+		}
+
+		position += count;
+		blockSize = (blockSize % 37) + 1;
+	}
+
+	return 1;
+}
+
+void test_signal (const Test_Signal_t *SignalPtr)
+{
+	static uint16_t input[TEST_NUM_OF_SAMPLES];
+	static uint8_t data[TEST_NUM_OF_SAMPLES/2];
+	static int16_t decoded[TEST_NUM_OF_SAMPLES];
+	ADPCM_Sound_t sound = {data,TEST_NUM_OF_SAMPLES,{0,0},TEST_SAMPLE_RATE};
+	ADPCM_State_t state;
+	double power = 0, noise = 0, SNR;
+
+	for(uint32_t i = 0; i < TEST_NUM_OF_SAMPLES; i++){
+		input[i] = SignalPtr->generate(i);
+		data[i/2] = 0;
+	}
+
+	/*same scaling as Tools/adpcm_encoder.c*/
+	sound.initialState.predictor = (int16_t)(((int32_t)input[0] - SAMPLE_MIDPOINT) << SAMPLE_SCALE_SHIFT);
+	state = sound.initialState;
+
+	for(uint32_t i = 0; i < TEST_NUM_OF_SAMPLES; i++){
+		data[i/2] |= adpcm_encode_sample(&state,(int16_t)(((int32_t)input[i] - SAMPLE_MIDPOINT) << SAMPLE_SCALE_SHIFT)) << ((i & 1) ? 4 : 0);
+	}
+
+	state = sound.initialState;
+	adpcm_decode_block(&state,data,0,decoded,TEST_NUM_OF_SAMPLES);
+
+	for(uint32_t i = 0; i < TEST_NUM_OF_SAMPLES; i++){
+		double error = (double)((decoded[i] >> SAMPLE_SCALE_SHIFT) + SAMPLE_MIDPOINT) - input[i];
+
+		power += ((double)input[i] - SAMPLE_MIDPOINT)*((double)input[i] - SAMPLE_MIDPOINT);
+		noise += error*error;
+	}
+
+	SNR = (noise > 0) ? 10*log10(power/noise) : INFINITY;
+
+	printf("%s: round trip SNR %.1f dB (minimum %.1f dB)\n",SignalPtr->name,SNR,SignalPtr->minSNR);
+
+	if(SNR < SignalPtr->minSNR){
+		printf("  FAIL: SNR too low\n");
+		numOfFailures++;
+	}
+
+	if(!check_streaming(&sound,decoded)){
+		numOfFailures++;
+	}
+}
+
+void test_asset (const Test_Asset_t *AssetPtr)
+{
+	static int16_t decoded[1 << 17];
+	ADPCM_State_t state = AssetPtr->soundPtr->initialState;
+	uint32_t numOfSamples = AssetPtr->soundPtr->numOfSamples;
+
+	if(numOfSamples > sizeof(decoded)/sizeof(decoded[0])){
+		printf("%s: FAIL: %u samples, too long for test\n",AssetPtr->name,numOfSamples);
+		numOfFailures++;
+		return;
+	}
+
+	for(uint32_t position = 0; position < numOfSamples; position += UINT16_MAX){
+		uint32_t count = (numOfSamples - position < UINT16_MAX) ? numOfSamples - position : UINT16_MAX;
+		adpcm_decode_block(&state,AssetPtr->soundPtr->dataPtr,position,decoded + position,(uint16_t)count);
+	}
+
+	printf("%s: %u samples, %u bytes of ADPCM codes instead of %u bytes of samples\n",AssetPtr->name,numOfSamples,
+			(numOfSamples + 1)/2,2*numOfSamples);
+
+	if(!check_streaming(AssetPtr->soundPtr,decoded)){
+		numOfFailures++;
+	}
+}
+
+int main (void)
+{
+	for(uint8_t i = 0; i < sizeof(signal)/sizeof(signal[0]); i++){
+		test_signal(&signal[i]);
+	}
+
+	for(uint8_t i = 0; i < sizeof(asset)/sizeof(asset[0]); i++){
+		test_asset(&asset[i]);
+	}
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
@@ -0,0 +1,392 @@
+/**
+*@brief Check button events captured by EXTI interrupt and filtered by debounce filter on PC
+*
+*This program run button driver (Device_drivers/src/button.c) with stub GPIO and DWT drivers: test set level of emulated pins at given
+*times (in microseconds, DWT cycle count at 84MHz) and call interrupt handler on each edge as EXTI would, software triggered interrupt
+*run at once. Bouncing edges are fed and events read with button_get_event are compared with expected ones: clean press and release,
+*bounces of press and release, tap shorter than debounce time, several taps between 2 reads, 2 buttons, edge missed by interrupt
+*latency, full queue, wrap of cycle counter and flush are checked. Then random taps are read once per frame (30Hz) from events and
+*by polling pin level as game did before, number of taps seen by each method is printed.
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 -DSTM32F407xx -ICMSIS/Include -ICMSIS/Device/ST/STM32F4xx/Include
+*Headless_simulation/button_event_test.c Device_drivers/src/button.c -o button_event_test
+*
+*Run:
+*button_event_test
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../Device_drivers/inc/button.h"
+#include <stdio.h>
+
+#define BUTTON_TEST_HCLK_MHZ		84
+#define BUTTON_TEST_DEBOUNCE_US		5000
+#define BUTTON_TEST_FRAME_US		33333
+#define BUTTON_TEST_NUM_OF_TAPS		1000
+#define BUTTON_TEST_MAX_EVENTS		64
+
+#define SHOOT_PIN		GPIO_PIN_NO_1
+#define THRUST_PIN		GPIO_PIN_NO_3
+
+typedef struct{
+	uint8_t button;
+	uint8_t type;
+	uint32_t time;	/*microseconds*/
+}Expected_Event_t;
+
+/*emulated pins of port C (pulled up, released button read 1) and time*/
+uint8_t pinLevel[16];
+uint8_t pinMode[16];
+uint8_t pinPuPdr[16];
+uint8_t IRQEnabled[96];
+uint32_t currentTime = 0;		/*microseconds*/
+uint32_t cycleCountOffset = 0;	/*added to cycle count, to wrap counter*/
+uint32_t numOfSoftwareTriggers = 0;
+
+uint8_t shootButton, thrustButton;
+uint16_t numOfFailures = 0;
+
+/*stub GPIO, DWT and RCC drivers*/
+void GPIO_init (GPIO_Handle_t *GPIOxHandlePtr)
+{
+	pinMode[GPIOxHandlePtr->GPIO_Pin_config.pinNumber] = GPIOxHandlePtr->GPIO_Pin_config.mode;
+	pinPuPdr[GPIOxHandlePtr->GPIO_Pin_config.pinNumber] = GPIOxHandlePtr->GPIO_Pin_config.puPdr;
+}
+
+uint8_t GPIO_read_pin (GPIO_TypeDef *GPIOxPtr, uint8_t pinNumber)
+{
+	return pinLevel[pinNumber];
+}
+
+void GPIO_Intrpt_ctrl (uint8_t IRQnumber, uint8_t enOrDis)
+{
+	IRQEnabled[IRQnumber] = enOrDis;
+}
+
+void GPIO_Intrpt_handler (uint8_t pinNumber)
+{
+}
+
+/*interrupt of thread mode caller is taken at once*/
+void GPIO_Intrpt_software_trigger (uint8_t pinNumber)
+{
+	numOfSoftwareTriggers++;
+	button_intrpt_handler(pinNumber);
+}
+
+void DWT_cycle_counter_ctr (uint8_t enOrDis)
+{
+}
+
+uint32_t DWT_get_cycle_count (void)
+{
+	return currentTime*BUTTON_TEST_HCLK_MHZ + cycleCountOffset;
+}
+
+int32_t RCC_get_SYSCLK_value (void)
+{
+	return BUTTON_TEST_HCLK_MHZ*1000000;
+}
+
+void check_value (const char *namePtr, uint32_t value, uint32_t expected)
+{
+	if(value != expected){
+		printf("FAIL %s: %lu, expected %lu\n",namePtr,(unsigned long)value,(unsigned long)expected);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+/*edge on pin at given time, interrupt handler run on each edge*/
+void set_pin (uint8_t pinNumber, uint8_t level, uint32_t time)
+{
+	currentTime = time;
+
+	if(pinLevel[pinNumber] != level){
+		pinLevel[pinNumber] = level;
+		button_intrpt_handler(pinNumber);
+	}
+}
+
+/*numOfEdges edges spaced by spacing microseconds from start, pin end at level*/
+void bounce_pin (uint8_t pinNumber, uint8_t level, uint32_t start, uint8_t numOfEdges, uint32_t spacing)
+{
+	for(uint8_t i = 0; i < numOfEdges; i++){
+		set_pin(pinNumber,((numOfEdges - 1 - i) % 2) ? !level : level,start + i*spacing);
+	}
+}
+
+/*read every event at given time, return number of events*/
+uint16_t read_events (uint32_t time, Button_Event_t *EventPtr)
+{
+	uint16_t numOfEvents = 0;
+
+	currentTime = time;
+
+	while(numOfEvents < BUTTON_TEST_MAX_EVENTS && button_get_event(&EventPtr[numOfEvents])){
+		numOfEvents++;
+	}
+
+	return numOfEvents;
+}
+
+/*read events at given time and compare them with expected ones*/
+void check_events (const char *namePtr, uint32_t time, const Expected_Event_t *ExpectedPtr, uint16_t numOfExpected)
+{
+	Button_Event_t Event[BUTTON_TEST_MAX_EVENTS];
+	uint16_t numOfEvents = read_events(time,Event);
+
+	if(numOfEvents != numOfExpected){
+		printf("FAIL %s: %u events, expected %u\n",namePtr,numOfEvents,numOfExpected);
+		numOfFailures++;
+		return;
+	}
+
+	for(uint16_t i = 0; i < numOfEvents; i++){
+		if(Event[i].button != ExpectedPtr[i].button || Event[i].type != ExpectedPtr[i].type
+				|| Event[i].timestamp != ExpectedPtr[i].time*BUTTON_TEST_HCLK_MHZ + cycleCountOffset){
+			printf("FAIL %s: event %u is button %u %s at %lu cycles, expected button %u %s at %lu cycles\n",namePtr,i,
+					Event[i].button,Event[i].type ? "press" : "release",(unsigned long)Event[i].timestamp,
+					ExpectedPtr[i].button,ExpectedPtr[i].type ? "press" : "release",
+					(unsigned long)(ExpectedPtr[i].time*BUTTON_TEST_HCLK_MHZ + cycleCountOffset));
+			numOfFailures++;
+			return;
+		}
+	}
+
+	printf("pass %s\n",namePtr);
+}
+
+void test_init (void)
+{
+	Button_Event_t Event;
+
+	pinLevel[SHOOT_PIN] = 1;
+	pinLevel[THRUST_PIN] = 1;
+
+	shootButton = button_event_init(GPIOC,SHOOT_PIN,GPIO_PU,BUTTON_TEST_DEBOUNCE_US);
+	thrustButton = button_event_init(GPIOC,THRUST_PIN,GPIO_PU,BUTTON_TEST_DEBOUNCE_US);
+
+	check_value("buttons numbered in order of init",shootButton == 0 && thrustButton == 1,1);
+	check_value("interrupt on both edges of pins",pinMode[SHOOT_PIN] == GPIO_MODE_INTRPT_RFE && pinMode[THRUST_PIN] == GPIO_MODE_INTRPT_RFE,1);
+	check_value("pins pulled up",pinPuPdr[SHOOT_PIN] == GPIO_PU && pinPuPdr[THRUST_PIN] == GPIO_PU,1);
+	check_value("EXTI1 and EXTI3 interrupts enabled",IRQEnabled[IRQ_EXTI1] == ENABLE && IRQEnabled[IRQ_EXTI3] == ENABLE,1);
+	check_value("no event after init",button_get_event(&Event),FALSE);
+	check_value("no software interrupt while levels are settled",numOfSoftwareTriggers,0);
+}
+
+void test_clean_press (void)
+{
+	const Expected_Event_t expected[] = {{0,BUTTON_PRESSED,1000},{0,BUTTON_RELEASED,200000}};
+
+	set_pin(SHOOT_PIN,0,1000);
+	set_pin(SHOOT_PIN,1,200000);
+	check_events("clean press and release",300000,expected,2);
+}
+
+void test_bounce (void)
+{
+	const Expected_Event_t expected[] = {{0,BUTTON_PRESSED,400000},{0,BUTTON_RELEASED,500000}};
+
+	/*edges every 300us for 2.7ms on press and release*/
+	bounce_pin(SHOOT_PIN,0,400000,9,300);
+	bounce_pin(SHOOT_PIN,1,500000,9,300);
+	check_events("one event for bouncing press and release",600000,expected,2);
+}
+
+void test_short_tap (void)
+{
+	const Expected_Event_t press[] = {{0,BUTTON_PRESSED,700000}};
+	const Expected_Event_t release[] = {{0,BUTTON_RELEASED,703600}};
+
+	/*released 3ms after press, release bounce end 3.6ms after press*/
+	bounce_pin(SHOOT_PIN,0,700000,3,200);
+	bounce_pin(SHOOT_PIN,1,703000,3,300);
+	check_events("tap shorter than debounce time: press at once",704000,press,1);
+	check_events("tap shorter than debounce time: release after debounce time, with time of its edge",705000,release,1);
+}
+
+void test_taps_between_reads (void)
+{
+	const Expected_Event_t expected[] = {{0,BUTTON_PRESSED,800000},{0,BUTTON_RELEASED,808000},{0,BUTTON_PRESSED,816000},
+			{0,BUTTON_RELEASED,824000},{0,BUTTON_PRESSED,832000}};
+
+	/*taps of 8ms within one frame, last one still held when events are read*/
+	for(uint8_t i = 0; i < 3; i++){
+		bounce_pin(SHOOT_PIN,0,800000 + i*16000,5,200);
+		if(i < 2){
+			bounce_pin(SHOOT_PIN,1,808000 + i*16000,5,200);
+		}
+	}
+	check_events("every tap between 2 reads",833333,expected,5);
+
+	set_pin(SHOOT_PIN,1,900000);
+	read_events(1000000,(Button_Event_t[BUTTON_TEST_MAX_EVENTS]){0});
+}
+
+void test_two_buttons (void)
+{
+	const Expected_Event_t expected[] = {{1,BUTTON_PRESSED,1100000},{0,BUTTON_PRESSED,1101000},{1,BUTTON_RELEASED,1150000},
+			{0,BUTTON_RELEASED,1160000}};
+
+	bounce_pin(THRUST_PIN,0,1100000,7,300);
+	bounce_pin(SHOOT_PIN,0,1101000,7,300);
+	bounce_pin(THRUST_PIN,1,1150000,7,300);
+	bounce_pin(SHOOT_PIN,1,1160000,7,300);
+	check_events("thrust and shoot filtered independently",1200000,expected,4);
+}
+
+void test_missed_edge (void)
+{
+	const Expected_Event_t expected[] = {{0,BUTTON_PRESSED,1300100}};
+
+	/*glitch shorter than interrupt latency: handler read level it had before*/
+	pinLevel[SHOOT_PIN] = 0;
+	pinLevel[SHOOT_PIN] = 1;
+	currentTime = 1300000;
+	button_intrpt_handler(SHOOT_PIN);
+	check_events("glitch missed by interrupt give no event",1310000,expected,0);
+
+	/*press whose first edges are missed: handler read pressed level*/
+	pinLevel[SHOOT_PIN] = 0;
+	currentTime = 1300100;
+	button_intrpt_handler(SHOOT_PIN);
+	check_events("press found by handler after missed edges",1310000,expected,1);
+
+	set_pin(SHOOT_PIN,1,1400000);
+	read_events(1500000,(Button_Event_t[BUTTON_TEST_MAX_EVENTS]){0});
+}
+
+void test_queue_full (void)
+{
+	Button_Event_t Event[BUTTON_TEST_MAX_EVENTS];
+	uint16_t numOfEvents;
+	uint8_t alternate = TRUE;
+
+	/*20 taps (40 edges) are not read*/
+	for(uint8_t i = 0; i < 20; i++){
+		bounce_pin(SHOOT_PIN,0,2000000 + i*20000,3,300);
+		bounce_pin(SHOOT_PIN,1,2010000 + i*20000,3,300);
+	}
+
+	numOfEvents = read_events(3000000,Event);
+
+	for(uint16_t i = 0; i < numOfEvents; i++){
+		if(Event[i].type != ((i % 2) ? BUTTON_RELEASED : BUTTON_PRESSED)){
+			alternate = FALSE;
+		}
+	}
+
+	check_value("queue full: events keep alternating press and release",alternate,TRUE);
+	check_value("queue full: last event is release of released button",(numOfEvents >= BUTTON_EVENT_QUEUE_SIZE) && (Event[numOfEvents - 1].type == BUTTON_RELEASED),1);
+	printf("queue full: %u events of 40 read (queue of %u events)\n",numOfEvents,BUTTON_EVENT_QUEUE_SIZE);
+}
+
+void test_counter_wrap (void)
+{
+	const Expected_Event_t expected[] = {{0,BUTTON_PRESSED,4000000},{0,BUTTON_RELEASED,4003000}};
+
+	/*counter wrap 1ms after press, during bounces of tap shorter than debounce time*/
+	cycleCountOffset = 0 - (4001000*BUTTON_TEST_HCLK_MHZ);
+	bounce_pin(SHOOT_PIN,0,4000000,9,200);
+	bounce_pin(SHOOT_PIN,1,4003000,1,200);
+	check_events("cycle counter wrap during debounce time",4100000,expected,2);
+	cycleCountOffset = 0;
+}
+
+void test_flush (void)
+{
+	Button_Event_t Event;
+
+	set_pin(SHOOT_PIN,0,5000000);
+	set_pin(THRUST_PIN,0,5000000);
+	button_flush_events();
+	check_value("no event after flush",button_get_event(&Event),FALSE);
+
+	set_pin(SHOOT_PIN,1,5100000);
+	set_pin(THRUST_PIN,1,5100000);
+	read_events(5200000,&Event);
+}
+
+/*random taps (15 to 60ms, press and release bounce for 1ms) are read once per frame, as game engine read input*/
+void test_taps_per_frame (void)
+{
+	Button_Event_t Event[BUTTON_TEST_MAX_EVENTS];
+	uint32_t randomState = 2463534242UL;
+	uint32_t time = 6000000;
+	uint32_t nextFrame = time;
+	uint32_t polledTaps = 0, eventTaps = 0;
+	uint8_t polledLevel = 1;
+
+	for(uint16_t tap = 0; tap < BUTTON_TEST_NUM_OF_TAPS; tap++){
+		uint32_t edgeTime[10];
+		uint8_t edgeLevel[10];
+
+		randomState ^= randomState << 13;
+		randomState ^= randomState >> 17;
+		randomState ^= randomState << 5;
+
+		/*5 edges of press then 5 edges of release, 250us apart*/
+		for(uint8_t i = 0; i < 10; i++){
+			edgeTime[i] = time + 10000 + randomState % 40000 + (i % 5)*250 + ((i < 5) ? 0 : 15000 + (randomState >> 16) % 45000);
+			edgeLevel[i] = (i < 5) ? (i % 2) : !((i - 5) % 2);
+		}
+
+		for(uint8_t i = 0; i < 10; i++){
+			/*frames before edge*/
+			while(nextFrame < edgeTime[i]){
+				uint16_t numOfEvents = read_events(nextFrame,Event);
+
+				for(uint16_t j = 0; j < numOfEvents; j++){
+					if(Event[j].type == BUTTON_PRESSED){
+						eventTaps++;
+					}
+				}
+
+				/*polling see buttons held at time of frame*/
+				if(!pinLevel[SHOOT_PIN] && polledLevel){
+					polledTaps++;
+				}
+				polledLevel = pinLevel[SHOOT_PIN];
+
+				nextFrame += BUTTON_TEST_FRAME_US;
+			}
+
+			set_pin(SHOOT_PIN,edgeLevel[i],edgeTime[i]);
+		}
+
+		time = edgeTime[9];
+	}
+
+	printf("taps of 15 to 60ms read at 30Hz: %lu of %u seen by polling, %lu of %u seen in events\n",(unsigned long)polledTaps,
+			BUTTON_TEST_NUM_OF_TAPS,(unsigned long)eventTaps,BUTTON_TEST_NUM_OF_TAPS);
+	check_value("every tap seen in events",eventTaps,BUTTON_TEST_NUM_OF_TAPS);
+}
+
+int main (void)
+{
+	test_init();
+	test_clean_press();
+	test_bounce();
+	test_short_tap();
+	test_taps_between_reads();
+	test_two_buttons();
+	test_missed_edge();
+	test_queue_full();
+	test_counter_wrap();
+	test_flush();
+	test_taps_per_frame();
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
@@ -0,0 +1,204 @@
+/**
+*@brief Check clock profiles of RCC driver and settings derived from them on PC
+*
+*This program check every clock profile of RCC driver (RCC_clockProfile in Peripheral_drivers/src/stm32f407xx_rcc.c) against limits
+*of STM32F407 (RM0090 and datasheet, voltage scale 1, supply 2.7V to 3.6V): VCO input and output range, PLL48CLK of 48MHz, APB1 and
+*APB2 clocks, flash wait states for HCLK, and prefetch buffer and caches enabled. Settings which game engine derive from clock tree
+*with each profile are computed with functions of RCC driver and checked: TIM6 frame rate of exactly 30Hz, speaker sample rate of
+*6176Hz (rate sounds are recorded at, as speaker_init compute it), ILI9341 SPI clock (SPI1 on APB2) not above 21MHz, ADC clock not
+*above 36MHz, UART baud rate error (BRR as UART_init compute it) and I2C peripheral clock. Timer split of corner cases is checked too.
+*Registers are not touched: only table and computing functions of RCC driver are used.
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 -DSTM32F407xx -ICMSIS/Include -ICMSIS/Device/ST/STM32F4xx/Include
+*Headless_simulation/clock_profile_test.c Peripheral_drivers/src/stm32f407xx_rcc.c -o clock_profile_test
+*
+*Run:
+*clock_profile_test
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../Peripheral_drivers/inc/stm32f407xx_rcc.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_spi.h"
+#include <stdio.h>
+
+#define CLOCK_TEST_FRAME_RATE		30		/*RTE_FRAME_RATE*/
+#define CLOCK_TEST_AUDIO_RATE		6176	/*RTE_AUDIO_SAMPLE_RATE*/
+#define CLOCK_TEST_LCD_MAX_SCLK		21000000	/*ILI9341_SPI_MAX_CLK*/
+#define CLOCK_TEST_BAUD_RATE		115200
+#define CLOCK_TEST_MAX_BAUD_ERROR	0.02	/*2% is tolerated by receiver with 16 times oversampling*/
+#define CLOCK_TEST_MAX_I2C_FREQ		50000000	/*I2C_CR2 FREQ field*/
+
+uint16_t numOfFailures = 0;
+
+void check_value (const char *namePtr, uint32_t value, uint32_t expected)
+{
+	if(value != expected){
+		printf("FAIL %s: %lu, expected %lu\n",namePtr,(unsigned long)value,(unsigned long)expected);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+void check_true (const char *namePtr, uint8_t condition)
+{
+	if(!condition){
+		printf("FAIL %s\n",namePtr);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+/*RCC driver configure MCO pins with GPIO driver, never called here*/
+void GPIO_init_direct(GPIO_TypeDef *GPIOxPtr, uint8_t pinNumber, uint8_t mode, uint8_t speed, uint8_t outputType, uint8_t pupdr, uint8_t altFunction)
+{
+}
+
+/*division factor of RCC_APB_DIVx*/
+uint32_t APB_division (uint8_t APBdiv)
+{
+	return (APBdiv < RCC_APB_DIV2) ? 1 : 2U << (APBdiv - RCC_APB_DIV2);
+}
+
+/*baud rate given by BRR computed as UART_init do (mantissa and truncated 4 bits fraction, 16 times oversampling)*/
+double UART_actual_baud_rate (uint32_t PCLK, uint32_t baudRate)
+{
+	uint32_t mantissa = PCLK/(baudRate*16);
+	uint32_t fraction = (uint32_t)(((double)PCLK/(baudRate*16) - mantissa)*16);
+
+	return (double)PCLK/(16*mantissa + fraction);
+}
+
+void test_profile (uint8_t profile)
+{
+	const RCC_Clock_Profile_t *ProfilePtr = &RCC_clockProfile[profile];
+	uint32_t VCOinput = RCC_HSE_VALUE/ProfilePtr->PLLM;
+	uint32_t VCOoutput = VCOinput*ProfilePtr->PLLN;
+	uint32_t PCLK1 = ProfilePtr->SYSCLK/APB_division(ProfilePtr->APB1div);
+	uint32_t PCLK2 = ProfilePtr->SYSCLK/APB_division(ProfilePtr->APB2div);
+	uint32_t TIMCLK1 = (ProfilePtr->APB1div < RCC_APB_DIV2) ? PCLK1 : 2*PCLK1;
+	uint16_t prescaler, reload;
+	uint8_t exact;
+	uint32_t rate;
+	double error;
+
+	printf("-- profile %u: SYSCLK %lu MHz, PCLK1 %lu MHz, PCLK2 %lu MHz, %u wait states\n",profile,(unsigned long)(ProfilePtr->SYSCLK/1000000),
+	(unsigned long)(PCLK1/1000000),(unsigned long)(PCLK2/1000000),ProfilePtr->flashLatency);
+
+	/*PLL*/
+	check_true("PLLM in [2,63]",ProfilePtr->PLLM >= 2 && ProfilePtr->PLLM <= 63);
+	check_true("PLLN in [50,432]",ProfilePtr->PLLN >= 50 && ProfilePtr->PLLN <= 432);
+	check_true("PLLP is 2, 4, 6 or 8",ProfilePtr->PLLP >= 2 && ProfilePtr->PLLP <= 8 && ProfilePtr->PLLP % 2 == 0);
+	check_true("PLLQ in [2,15]",ProfilePtr->PLLQ >= 2 && ProfilePtr->PLLQ <= 15);
+	check_true("VCO input in [1,2] MHz",VCOinput >= 1000000 && VCOinput <= 2000000);
+	check_true("VCO output in [100,432] MHz",VCOoutput >= 100000000 && VCOoutput <= 432000000);
+	check_value("SYSCLK from PLL factors",VCOoutput/ProfilePtr->PLLP,ProfilePtr->SYSCLK);
+	check_value("PLL48CLK",VCOoutput/ProfilePtr->PLLQ,RCC_PLL48_CLK);
+	check_true("SYSCLK not above 168MHz",ProfilePtr->SYSCLK <= RCC_MAX_SYSCLK);
+
+	/*buses and flash*/
+	check_true("PCLK1 not above 42MHz",PCLK1 <= RCC_MAX_PCLK1);
+	check_true("PCLK2 not above 84MHz",PCLK2 <= RCC_MAX_PCLK2);
+	check_value("flash wait states",ProfilePtr->flashLatency,(ProfilePtr->SYSCLK - 1)/RCC_FLASH_WS_CLK);
+	check_value("prefetch buffer and caches enabled",ProfilePtr->flashAccel,FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN);
+
+	/*frame timer (TIM6 on APB1)*/
+	exact = RCC_get_TIM_period(TIMCLK1,CLOCK_TEST_FRAME_RATE,&prescaler,&reload);
+	check_true("frame rate exact",exact == TRUE);
+	check_value("frame timer period",((uint32_t)prescaler + 1)*((uint32_t)reload + 1),TIMCLK1/CLOCK_TEST_FRAME_RATE);
+	printf("   TIM6 prescaler %u, reload %u\n",prescaler,reload);
+
+	/*speaker timer (TIM7 on APB1), sample rate as speaker_init compute it*/
+	RCC_get_TIM_period(TIMCLK1,CLOCK_TEST_AUDIO_RATE,&prescaler,&reload);
+	rate = TIMCLK1/(((uint32_t)prescaler + 1)*((uint32_t)reload + 1));
+	error = ((double)TIMCLK1/(((uint32_t)prescaler + 1)*((uint32_t)reload + 1)) - CLOCK_TEST_AUDIO_RATE)/CLOCK_TEST_AUDIO_RATE;
+	check_value("speaker sample rate",rate,CLOCK_TEST_AUDIO_RATE);
+	check_true("speaker sample rate error below 0.01%",error >= 0 && error < 0.0001);
+	printf("   TIM7 prescaler %u, reload %u, sample rate error %.4f%%\n",prescaler,reload,error*100);
+
+	/*ILI9341 on SPI1 (APB2)*/
+	rate = PCLK2 >> (RCC_get_SPI_prescaler(PCLK2,CLOCK_TEST_LCD_MAX_SCLK) + 1);
+	check_true("SPI clock not above 21MHz",rate <= CLOCK_TEST_LCD_MAX_SCLK);
+	check_true("SPI clock is fastest allowed",2*rate > CLOCK_TEST_LCD_MAX_SCLK);
+	printf("   SPI1 clock %.2f MHz\n",rate/1e6);
+
+	/*ADC*/
+	rate = PCLK2/(2*(RCC_get_ADC_prescaler(PCLK2) + 1));
+	check_true("ADC clock not above 36MHz",rate <= RCC_MAX_ADCCLK);
+	check_true("ADC clock is fastest allowed",2*rate > RCC_MAX_ADCCLK || RCC_get_ADC_prescaler(PCLK2) == 0);
+
+	/*UART on APB1 (UART3 of telemetry and input log) and APB2*/
+	error = UART_actual_baud_rate(PCLK1,CLOCK_TEST_BAUD_RATE)/CLOCK_TEST_BAUD_RATE - 1;
+	check_true("UART baud rate error on APB1",error < CLOCK_TEST_MAX_BAUD_ERROR && error > -CLOCK_TEST_MAX_BAUD_ERROR);
+	printf("   115200 baud on APB1: error %.3f%%\n",error*100);
+	error = UART_actual_baud_rate(PCLK2,CLOCK_TEST_BAUD_RATE)/CLOCK_TEST_BAUD_RATE - 1;
+	check_true("UART baud rate error on APB2",error < CLOCK_TEST_MAX_BAUD_ERROR && error > -CLOCK_TEST_MAX_BAUD_ERROR);
+
+	/*I2C1 peripheral clock is given in whole MHz*/
+	check_true("PCLK1 usable as I2C clock",PCLK1 % 1000000 == 0 && PCLK1 <= CLOCK_TEST_MAX_I2C_FREQ);
+}
+
+void test_timer_split (void)
+{
+	uint16_t prescaler, reload;
+
+	printf("-- timer split\n");
+
+	/*fit in 16 bits without prescaler*/
+	check_true("short period exact",RCC_get_TIM_period(42000000,6176,&prescaler,&reload) == FALSE);
+	check_value("short period prescaler",prescaler,0);
+	check_value("short period reload",reload,42000000/6176 - 1);
+
+	/*smallest prescaler dividing period*/
+	check_true("long period exact",RCC_get_TIM_period(84000000,30,&prescaler,&reload) == TRUE);
+	check_value("long period prescaler",prescaler,49);
+	check_value("long period reload",reload,55999);
+
+	/*prime period above 16 bits: no exact split, smallest prescaler keeping reload in 16 bits*/
+	check_true("prime period exact",RCC_get_TIM_period(65537,1,&prescaler,&reload) == FALSE);
+	check_value("prime period prescaler",prescaler,1);
+	check_value("prime period reload",reload,65537/2 - 1);
+
+	/*rate above timer clock*/
+	RCC_get_TIM_period(1000,2000,&prescaler,&reload);
+	check_value("rate above clock prescaler",prescaler,0);
+	check_value("rate above clock reload",reload,0);
+
+	/*longest exact period (65535*65535), rounding up smallest prescaler must not overflow*/
+	check_true("longest period exact",RCC_get_TIM_period(0xFFFE0001,1,&prescaler,&reload) == TRUE);
+	check_value("longest period prescaler",prescaler,65534);
+	check_value("longest period reload",reload,65534);
+
+	printf("-- SPI and ADC prescalers\n");
+	check_value("SPI 84MHz",RCC_get_SPI_prescaler(84000000,21000000),SPI_CLK_SPEED_DIV4);
+	check_value("SPI 42MHz",RCC_get_SPI_prescaler(42000000,21000000),SPI_CLK_SPEED_DIV2);
+	check_value("SPI slowest",RCC_get_SPI_prescaler(84000000,1000),SPI_CLK_SPEED_DIV256);
+	check_value("ADC 84MHz",RCC_get_ADC_prescaler(84000000),1);
+	check_value("ADC 42MHz",RCC_get_ADC_prescaler(42000000),0);
+}
+
+int main (void)
+{
+	for(uint8_t profile = 0; profile < RCC_NUM_OF_PROFILES; profile++){
+		test_profile(profile);
+	}
+
+	check_value("84MHz profile",RCC_clockProfile[RCC_PROFILE_84_MHZ].SYSCLK,84000000);
+	check_value("120MHz profile",RCC_clockProfile[RCC_PROFILE_120_MHZ].SYSCLK,120000000);
+	check_value("168MHz profile",RCC_clockProfile[RCC_PROFILE_168_MHZ].SYSCLK,168000000);
+
+	test_timer_split();
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
@@ -0,0 +1,399 @@
+/**
+*@brief Check that dirty rectangle drawing of "Return To Earth" leave same picture on screen as redrawing whole screen every frame
+*
+*This program run game engine with real ILI9341 driver on emulated panel (headless_lcd.c). A game is played with random input
+*and its input log (see input_log.h) is recorded in memory, then the log is played back twice: once drawn by RTE_draw_frame with dirty
+*rectangles (only areas which changed are erased and redrawn) and once with full redraw (RTE_set_full_redraw, whole screen is cleared
+*and every object is drawn every frame). Graphic RAM of both playbacks is compared after every frame, logged state hashes are checked
+*so that both playbacks are same game. At first different frame, number of different pixels and first one are printed.
+*Score text is drawn outside RTE_draw_frame and does not change game state, so it is left out (RTE_display_score is not called).
+*Number of bytes sent through SPI by both playbacks are printed and compared, so SPI byte counter of ILI9341 driver must be enabled.
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 -DSTM32F407xx -DHEADLESS_USE_ILI9341_DRIVER -DILI9341_USE_SPI_BYTE_COUNTER -ICMSIS/Include -ICMSIS/Device/ST/STM32F4xx/Include
+*Headless_simulation/dirty_rect_redraw_test.c Headless_simulation/headless_lcd.c Headless_simulation/headless_stubs.c Device_drivers/src/ili9341.c
+*Game_engine_return_to_earth/game_engine.c Game_engine_return_to_earth/dirty_rect.c Game_engine_return_to_earth/spatial_grid.c
+*Game_engine_return_to_earth/entity_store.c Game_engine_return_to_earth/input_log.c Miscellaneous/src/tm_stm32f4_fonts.c -lm -o dirty_rect_redraw_test
+*
+*Run:
+*dirty_rect_redraw_test [number of frames] [seed]
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "headless_lcd.h"
+#include "headless_stubs.h"
+#include "../Game_engine_return_to_earth/game_engine.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef ILI9341_USE_SPI_BYTE_COUNTER
+#error "build with -DILI9341_USE_SPI_BYTE_COUNTER, SPI bytes of both playbacks are compared"
+#endif
+
+#define REDRAW_TEST_MAX_FRAMES		20000
+#define REDRAW_TEST_LOG_SIZE		65536
+#define REDRAW_TEST_MAX_HOLD		30	/*random input is held for 1 to this many frames*/
+
+/*
+*@REDRAW_TEST_PASS
+*What a game played by play_game is used for
+*/
+#define REDRAW_TEST_RECORD			0	/*random input, input log is recorded*/
+#define REDRAW_TEST_DIRTY			1	/*input log is played back with dirty rectangles, screen hash of every frame is kept*/
+#define REDRAW_TEST_FULL			2	/*input log is played back with full redraw, screen hash is compared with dirty playback*/
+
+extern uint8_t frameUpdate;
+extern uint8_t currentWave;
+extern uint8_t numOfAsteroidInWave[RTE_NUM_OF_WAVE];
+
+extern Space_Object_t PlayerSpaceship;
+extern entity_store AsteroidStore;
+extern entity_store RocketStore;
+
+extern ILI9341_Config_t ILI9341_config;
+
+uint8_t inputLog[REDRAW_TEST_LOG_SIZE];
+uint32_t inputLogSize = 0;
+uint8_t inputLogOverflow = FALSE;
+input_log_writer InputLogWriter;
+input_log_reader InputLogReader;
+
+uint8_t currentPass = REDRAW_TEST_RECORD;
+uint8_t replayMismatch = FALSE;	/*logged state hash or seed was different, or log ended early*/
+
+uint32_t screenHash[REDRAW_TEST_MAX_FRAMES];
+uint32_t firstDifferentFrame = UINT32_MAX;
+uint16_t fullImage[HEADLESS_LCD_SIZE][HEADLESS_LCD_SIZE];	/*screen drawn by full redraw at first different frame*/
+
+uint32_t inputRandomState = 0x6A09E667;
+uint16_t numOfFailures = 0;
+
+void check_value (const char *namePtr, uint32_t value, uint32_t expected)
+{
+	if(value != expected){
+		printf("FAIL %s: %lu, expected %lu\n",namePtr,(unsigned long)value,(unsigned long)expected);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+void check_true (const char *namePtr, uint8_t condition)
+{
+	if(!condition){
+		printf("FAIL %s\n",namePtr);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+uint32_t random_get (void)
+{
+	inputRandomState ^= inputRandomState << 13;
+	inputRandomState ^= inputRandomState >> 17;
+	inputRandomState ^= inputRandomState << 5;
+	return inputRandomState;
+}
+
+void write_input_log (const uint8_t *dataPtr, uint16_t length)
+{
+	if(inputLogSize + length > REDRAW_TEST_LOG_SIZE){
+		inputLogOverflow = TRUE;
+		return;
+	}
+
+	memcpy(&inputLog[inputLogSize],dataPtr,length);
+	inputLogSize += length;
+}
+
+/*FNV-1a of every pixel on screen*/
+uint32_t get_screen_hash (void)
+{
+	uint32_t hash = 0x811C9DC5;
+
+	for(uint16_t y = 0; y < ILI9341_config.height; y++){
+		for(uint16_t x = 0; x < ILI9341_config.width; x++){
+			uint16_t pixel = headless_lcd_get_pixel(x,y);
+			hash = (hash ^ (pixel & 0xFF)) * 0x01000193;
+			hash = (hash ^ (pixel >> 8)) * 0x01000193;
+		}
+	}
+
+	return hash;
+}
+
+/*same as check_state in return_to_earth.c*/
+void check_state (void)
+{
+	uint32_t hash = 0;
+
+	if(currentPass == REDRAW_TEST_RECORD){
+		input_log_write_hash(&InputLogWriter,RTE_get_state_hash());
+		return;
+	}
+
+	if(input_log_read_hash(&InputLogReader,&hash) != INPUT_LOG_OK || hash != RTE_get_state_hash()){
+		replayMismatch = TRUE;
+	}
+}
+
+/*same as get_wave_seed in return_to_earth.c*/
+uint32_t get_wave_seed (void)
+{
+	uint32_t seed = 0;
+
+	if(currentPass == REDRAW_TEST_RECORD){
+		seed = RNG_get();
+		input_log_write_seed(&InputLogWriter,seed);
+		return seed;
+	}
+
+	if(input_log_read_seed(&InputLogReader,&seed) != INPUT_LOG_OK){
+		replayMismatch = TRUE;
+	}
+
+	return seed;
+}
+
+/*same as get_frame_input in return_to_earth.c, return 0 when input log ended*/
+uint8_t get_frame_input (RTE_Input_t *InputPtr, uint32_t *framesHeldPtr)
+{
+	uint16_t value = 0;
+	uint8_t logResult;
+
+	if(currentPass == REDRAW_TEST_RECORD){
+		static Headless_Input_t Input = {JS_DIR_CENTERED,0};
+
+		if(!*framesHeldPtr){
+			uint32_t random = random_get();
+
+			Input.joystickDirection = random % RTE_NUM_OF_JS_DIR;
+			Input.buttons = ((random >> 8) & 1 ? HEADLESS_BUTTON_SHOOT : 0) | ((random >> 9) & 1 ? HEADLESS_BUTTON_THRUST : 0);
+			*framesHeldPtr = 1 + (random >> 16) % REDRAW_TEST_MAX_HOLD;
+		}
+
+		(*framesHeldPtr)--;
+		headless_set_input(&Input);
+		RTE_read_input(InputPtr);
+		input_log_write_frame(&InputLogWriter,RTE_encode_input(InputPtr));
+		return 1;
+	}
+
+	logResult = input_log_read_frame(&InputLogReader,&value);
+
+	/*log written between 2 frames end with state hash*/
+	if(logResult == INPUT_LOG_MISMATCH){
+		check_state();
+		logResult = input_log_read_frame(&InputLogReader,&value);
+	}
+
+	if(logResult != INPUT_LOG_OK){
+		if(logResult != INPUT_LOG_END){
+			replayMismatch = TRUE;
+		}
+		return 0;
+	}
+
+	RTE_decode_input(value,InputPtr);
+	return 1;
+}
+
+/*same as start of game loop in return_to_earth.c*/
+void start_game (void)
+{
+	RTE_display_black_background();
+	RTE_seed_random(get_wave_seed());
+	RTE_create_player_spaceship(&PlayerSpaceship);
+	RTE_draw_player_spaceship(&PlayerSpaceship);
+
+	RTE_create_asteroid(&AsteroidStore,numOfAsteroidInWave[currentWave],&PlayerSpaceship);
+	RTE_draw_asteroid(&AsteroidStore);
+	RNG_deinit();
+
+	RTE_start_update_frame();
+}
+
+/*keep or compare screen after frame is drawn, return 0 to stop at first different frame*/
+uint8_t check_frame (uint32_t frame)
+{
+	ILI9341_wait_until_ready();
+
+	if(currentPass == REDRAW_TEST_DIRTY){
+		screenHash[frame] = get_screen_hash();
+	}else if(currentPass == REDRAW_TEST_FULL && get_screen_hash() != screenHash[frame]){
+		firstDifferentFrame = frame;
+
+		for(uint16_t y = 0; y < ILI9341_config.height; y++){
+			for(uint16_t x = 0; x < ILI9341_config.width; x++){
+				fullImage[y][x] = headless_lcd_get_pixel(x,y);
+			}
+		}
+
+		return 0;
+	}
+
+	return 1;
+}
+
+/*play a new game (same main loop as headless_main.c without score text), return number of frames played*/
+uint32_t play_game (uint8_t pass, uint32_t numOfFrames)
+{
+	RTE_Input_t Input;
+	uint32_t frame = 0, framesHeld = 0;
+
+	currentPass = pass;
+	replayMismatch = FALSE;
+	RTE_set_full_redraw(pass == REDRAW_TEST_FULL);
+
+	if(pass == REDRAW_TEST_RECORD){
+		inputLogSize = 0;
+		input_log_writer_init(&InputLogWriter,write_input_log);
+	}else{
+		input_log_reader_init(&InputLogReader,inputLog,inputLogSize);
+	}
+
+	RTE_reset_game();
+	start_game();
+
+	while(frame < numOfFrames && !replayMismatch){
+
+		/*one TIM6 period pass every frame, TIM6 interrupt set frameUpdate*/
+		headless_tick_timers();
+
+		if(frameUpdate != SET){
+			continue;
+		}
+
+		if(!get_frame_input(&Input,&framesHeld)){
+			break;
+		}
+
+		RTE_set_input(&Input);
+		RTE_update_player_spaceship(&PlayerSpaceship);
+		RTE_create_rocket(&RocketStore,&PlayerSpaceship);
+		RTE_update_rocket(&RocketStore,&AsteroidStore);
+		RTE_update_asteroid(&AsteroidStore,&PlayerSpaceship);
+		RTE_draw_frame(&PlayerSpaceship,&RocketStore,&AsteroidStore);
+
+		if(!check_frame(frame++)){
+			break;
+		}
+
+		/*game over screen is skipped at once, new game start in next frame*/
+		if(PlayerSpaceship.Object_Property.aliveFlag == RTE_ALIVE_FALSE){
+			check_state();
+			RTE_display_game_over_screen();
+			RTE_reset_game();
+			start_game();
+			continue;
+		}
+
+		if(AsteroidStore.total == 0){
+			TIM_ctr(TIM6,STOP);
+			check_state();
+
+			if(currentWave < RTE_NUM_OF_WAVE - 1){
+				currentWave++;
+			}
+
+			RNG_init();
+			RTE_seed_random(get_wave_seed());
+			RTE_create_asteroid(&AsteroidStore,numOfAsteroidInWave[currentWave],&PlayerSpaceship);
+			TIM_ctr(TIM6,START);
+		}
+
+		frameUpdate = CLEAR;
+	}
+
+	if(pass == REDRAW_TEST_RECORD){
+		check_state();
+		input_log_write_end(&InputLogWriter);
+	}
+
+	return frame;
+}
+
+/*play dirty rectangle drawing again until first different frame and compare it with full redraw pixel by pixel*/
+void print_first_difference (void)
+{
+	uint32_t numOfDifferences = 0;
+	uint16_t firstX = 0, firstY = 0;
+
+	play_game(REDRAW_TEST_DIRTY,firstDifferentFrame + 1);
+
+	for(uint16_t y = 0; y < ILI9341_config.height; y++){
+		for(uint16_t x = 0; x < ILI9341_config.width; x++){
+			if(fullImage[y][x] != headless_lcd_get_pixel(x,y)){
+				if(!numOfDifferences){
+					firstX = x;
+					firstY = y;
+				}
+				numOfDifferences++;
+			}
+		}
+	}
+
+	printf("frame %lu: %lu different pixels, first at (%u,%u): dirty rectangles 0x%04x, full redraw 0x%04x\n",
+	(unsigned long)firstDifferentFrame,(unsigned long)numOfDifferences,firstX,firstY,headless_lcd_get_pixel(firstX,firstY),fullImage[firstY][firstX]);
+}
+
+int main (int argc, char *argv[])
+{
+	uint32_t numOfFrames = 3000, recordedFrames, dirtyFrames, fullFrames;
+	uint32_t dirtyBytes, fullBytes;
+
+	if(argc > 1){
+		numOfFrames = strtoul(argv[1],NULL,0);
+	}
+
+	if(argc > 2){
+		headless_rng_seed(strtoul(argv[2],NULL,0));
+		inputRandomState = strtoul(argv[2],NULL,0) | 1;
+	}
+
+	if(numOfFrames > REDRAW_TEST_MAX_FRAMES){
+		numOfFrames = REDRAW_TEST_MAX_FRAMES;
+	}
+
+	RTE_init();
+
+	recordedFrames = play_game(REDRAW_TEST_RECORD,numOfFrames);
+	printf("recorded %lu frames, input log %lu bytes\n",(unsigned long)recordedFrames,(unsigned long)inputLogSize);
+	check_true("input log fit in memory",!inputLogOverflow);
+
+	ILI9341_reset_SPI_byte_count();
+	dirtyFrames = play_game(REDRAW_TEST_DIRTY,REDRAW_TEST_MAX_FRAMES);
+	ILI9341_wait_until_ready();
+	dirtyBytes = ILI9341_get_SPI_byte_count();
+	check_value("dirty rectangles: frames played back",dirtyFrames,recordedFrames);
+	check_true("dirty rectangles: same game as recorded",!replayMismatch);
+
+	ILI9341_reset_SPI_byte_count();
+	fullFrames = play_game(REDRAW_TEST_FULL,REDRAW_TEST_MAX_FRAMES);
+	ILI9341_wait_until_ready();
+	fullBytes = ILI9341_get_SPI_byte_count();
+	check_true("full redraw: same game as recorded",!replayMismatch);
+
+	if(firstDifferentFrame != UINT32_MAX){
+		check_value("same screen every frame, first different frame",firstDifferentFrame,UINT32_MAX);
+		print_first_difference();
+	}else{
+		check_value("full redraw: frames played back",fullFrames,recordedFrames);
+		check_true("same screen every frame",1);
+		printf("SPI bytes per frame: dirty rectangles %.0f, full redraw %.0f\n",(double)dirtyBytes/dirtyFrames,(double)fullBytes/fullFrames);
+		check_true("dirty rectangles send less than full redraw",dirtyBytes < fullBytes);
+	}
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
@@ -0,0 +1,403 @@
+/**
+*@brief Check entity store against array of structures Q16.16 model on PC and time both layouts
+*
+*This program move objects with whole pixel and sub-pixel velocities (quarter pixel, 1/65536 pixel, negative, crossing screen edges) with
+*entity_store_integrate and with a reference array of structures that keep position as one Q16.16 number per axis (like Space_Object_t
+*position update before entity store). Position and velocity of every object must match reference after every frame,
+*and objects overlapping a rocket sized area must match a brute force check. Random adds and removes must keep live array, free list and alive mask
+*consistent. Random scenes of 16 to 1024 objects are then timed for
+*both layouts and times are printed, they are not checked (PC timing say nothing about cortex M4, Test_applications/test_entity_store_benchmark.c
+*measure both layouts on target).
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 -DENTITY_STORE_MAX_ENTITIES=1024
+*Headless_simulation/entity_store_test.c Game_engine_return_to_earth/entity_store.c -o entity_store_test
+*
+*Run:
+*entity_store_test
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../Game_engine_return_to_earth/entity_store.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define STORE_TEST_MAX_OBJECTS	1024
+#define STORE_TEST_REPEAT		100		/*frames of each layout per timed scene*/
+#define SCREEN_WIDTH			320
+#define SCREEN_HEIGHT			240
+
+#if (ENTITY_STORE_MAX_ENTITIES < STORE_TEST_MAX_OBJECTS)
+#error "define ENTITY_STORE_MAX_ENTITIES=1024 on command line"
+#endif
+
+/*reference object, position and velocity are Q16.16 pixel*/
+typedef struct{
+	int32_t x;
+	int32_t y;
+	int32_t dx;
+	int32_t dy;
+	uint16_t width;
+	uint16_t height;
+	uint8_t alive;
+}Reference_Object_t;
+
+Reference_Object_t Object[STORE_TEST_MAX_OBJECTS];
+entity_store store;
+uint32_t hitMask[ENTITY_STORE_MASK_WORDS];
+
+uint32_t randomState = 0x2545F491;
+uint16_t numOfFailures = 0;
+
+void check_value (const char *namePtr, uint32_t value, uint32_t expected)
+{
+	if(value != expected){
+		printf("FAIL %s: %lu, expected %lu\n",namePtr,(unsigned long)value,(unsigned long)expected);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+void check_true (const char *namePtr, uint8_t condition)
+{
+	if(!condition){
+		printf("FAIL %s\n",namePtr);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+/*time in nanoseconds*/
+uint64_t get_time (void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC,&now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+uint32_t random_get (void)
+{
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+	return randomState;
+}
+
+/*wrap Q16.16 coordinate into 0 to less than size pixels*/
+int32_t reference_wrap (int32_t value, uint16_t size)
+{
+	int32_t limit = (int32_t)size * ENTITY_STORE_ONE;
+
+	value %= limit;
+
+	if(value < 0){
+		value += limit;
+	}
+
+	return value;
+}
+
+void reference_integrate (uint16_t numOfObjects)
+{
+	for(uint16_t i = 0; i < numOfObjects; i++){
+		if(!Object[i].alive){
+			continue;
+		}
+
+		Object[i].x = reference_wrap(Object[i].x + Object[i].dx,SCREEN_WIDTH);
+		Object[i].y = reference_wrap(Object[i].y + Object[i].dy,SCREEN_HEIGHT);
+	}
+}
+
+/*check whether span a and span b overlap on a wrapping axis (both start inside screen)*/
+uint8_t reference_span_overlap (int16_t a, uint16_t aLength, int16_t b, uint16_t bLength, uint16_t size)
+{
+	int32_t distance = b - a;
+
+	if(distance < 0){
+		distance += size;
+	}
+
+	return (distance < aLength || distance > size - bLength);
+}
+
+uint16_t reference_overlap (uint16_t numOfObjects, int16_t x, int16_t y, uint16_t width, uint16_t height)
+{
+	uint16_t numOfHits = 0;
+
+	for(uint16_t i = 0; i < numOfObjects; i++){
+		if(Object[i].alive
+			&& reference_span_overlap(Object[i].x >> ENTITY_STORE_FRACTION_BITS,Object[i].width,x,width,SCREEN_WIDTH)
+			&& reference_span_overlap(Object[i].y >> ENTITY_STORE_FRACTION_BITS,Object[i].height,y,height,SCREEN_HEIGHT)){
+			numOfHits++;
+		}
+	}
+
+	return numOfHits;
+}
+
+/*add same object to both layouts, return its index in store*/
+uint16_t add_object (uint16_t index, int16_t x, int16_t y, int32_t dx, int32_t dy, uint16_t width, uint16_t height)
+{
+	Object[index] = (Reference_Object_t){(int32_t)x * ENTITY_STORE_ONE,(int32_t)y * ENTITY_STORE_ONE,dx,dy,width,height,1};
+	return entity_store_add(&store,0,x,y,dx,dy,width,height);
+}
+
+/*return number of objects whose position or velocity differ from reference*/
+uint16_t compare_layouts (uint16_t numOfObjects)
+{
+	uint16_t numOfMismatches = 0;
+
+	for(uint16_t i = 0; i < numOfObjects; i++){
+		if(!Object[i].alive){
+			continue;
+		}
+
+		if(store.x[i] != Object[i].x || store.y[i] != Object[i].y
+			|| entity_store_get_dx(&store,i) != Object[i].dx || entity_store_get_dy(&store,i) != Object[i].dy){
+			numOfMismatches++;
+		}
+	}
+
+	return numOfMismatches;
+}
+
+void test_sub_pixel_motion (void)
+{
+	uint16_t numOfMismatches = 0;
+
+	printf("-- sub-pixel motion\n");
+
+	entity_store_init(&store,8,SCREEN_WIDTH,SCREEN_HEIGHT);
+
+	add_object(0,10,10,ENTITY_STORE_VELOCITY(0.25),ENTITY_STORE_VELOCITY(-0.25),13,22);
+	add_object(1,100,100,1,-1,13,22);	/*1/65536 pixel per frame*/
+	add_object(2,318,1,ENTITY_STORE_VELOCITY(1.5),ENTITY_STORE_VELOCITY(-2.75),27,25);	/*cross right and top edge*/
+	add_object(3,2,238,ENTITY_STORE_VELOCITY(-3),ENTITY_STORE_VELOCITY(3),27,25);	/*whole pixel velocity cross left and bottom edge*/
+	add_object(4,50,50,ENTITY_STORE_VELOCITY(-0.5),ENTITY_STORE_VELOCITY(0.75),50,42);
+	add_object(5,60,60,ENTITY_STORE_VELOCITY(0.5),0,50,42);
+
+	/*dead object must stay in place*/
+	entity_store_remove(&store,5);
+	Object[5].alive = 0;
+	check_value("removed object velocity",(uint32_t)entity_store_get_dx(&store,5),0);
+
+	check_value("negative velocity read back",(uint32_t)entity_store_get_dy(&store,0),(uint32_t)ENTITY_STORE_VELOCITY(-0.25));
+
+	entity_store_integrate(&store);
+	check_value("-0.25 pixel step: whole pixel",(uint32_t)entity_store_get_y(&store,0),9);
+	check_value("-0.25 pixel step: fraction",store.y[0] & 0xFFFF,0xC000);
+
+	for(uint16_t frame = 1; frame < 4; frame++){
+		entity_store_integrate(&store);
+	}
+	check_value("0.25 pixel per frame: 1 pixel after 4 frames",(uint32_t)entity_store_get_x(&store,0),11);
+	check_value("0.25 pixel per frame: no fraction left",store.x[0] & 0xFFFF,0);
+
+	reference_integrate(8);
+	reference_integrate(8);
+	reference_integrate(8);
+	reference_integrate(8);
+	numOfMismatches += compare_layouts(8);
+
+	for(uint32_t frame = 0; frame < 2000; frame++){
+		entity_store_integrate(&store);
+		reference_integrate(8);
+		numOfMismatches += compare_layouts(8);
+
+		/*bounce like colliding asteroids*/
+		if(frame % 97 == 0){
+			entity_store_set_velocity(&store,4,-entity_store_get_dx(&store,4),-entity_store_get_dy(&store,4));
+			Object[4].dx = -Object[4].dx;
+			Object[4].dy = -Object[4].dy;
+		}
+	}
+
+	check_value("2000 frames match reference",numOfMismatches,0);
+	check_value("1/65536 pixel per frame: fraction after 2004 frames",store.x[1] & 0xFFFF,2004);
+	check_value("dead object kept in place",(uint32_t)entity_store_get_x(&store,5),60);
+}
+
+/*return 1 when live array hold exactly the objects marked in alive mask, each once, and positions are linked back*/
+uint8_t check_live_array (void)
+{
+	uint16_t numOfAlive = 0;
+
+	for(uint16_t index = 0; index < store.capacity; index++){
+		numOfAlive += entity_store_is_alive(&store,index);
+	}
+
+	if(numOfAlive != store.total){
+		return 0;
+	}
+
+	for(uint16_t position = 0; position < store.total; position++){
+		uint16_t index = store.live[position];
+
+		if(!entity_store_is_alive(&store,index) || store.livePosition[index] != position){
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+void test_live_array (void)
+{
+	uint16_t index = 0;
+	uint16_t numOfErrors = 0;
+	uint16_t numOfFree = 0;
+
+	printf("-- free list and live array\n");
+
+	entity_store_init(&store,64,SCREEN_WIDTH,SCREEN_HEIGHT);
+
+	for(uint16_t i = 0; i < 64; i++){
+		numOfErrors += (entity_store_add(&store,0,i,i,0,0,8,8) != i);
+	}
+	check_value("empty store give indexes in increasing order",numOfErrors,0);
+	check_value("full store",entity_store_add(&store,0,0,0,0,0,8,8),ENTITY_STORE_NONE);
+
+	entity_store_remove(&store,10);
+	entity_store_remove(&store,40);
+	check_value("last object take position of removed object",store.live[10],63);
+	check_value("live array shrink",store.total,62);
+	check_value("last removed index is reused first",entity_store_add(&store,0,0,0,0,0,8,8),40);
+	check_value("then previous removed index",entity_store_add(&store,0,0,0,0,0,8,8),10);
+	check_true("live array match alive mask",check_live_array());
+
+	/*random adds and removes, store is sometimes full*/
+	numOfErrors = 0;
+	for(uint32_t step = 0; step < 100000; step++){
+		uint32_t random = random_get();
+
+		if(random & 1){
+			uint8_t full = (numOfFree == 0);
+
+			index = entity_store_add(&store,0,0,0,0,0,8,8);
+			numOfErrors += (index == ENTITY_STORE_NONE) != full;
+			if(index != ENTITY_STORE_NONE){
+				numOfFree--;
+			}
+		}else if(store.total){
+			index = store.live[(random >> 1) % store.total];
+			entity_store_remove(&store,index);
+			numOfErrors += entity_store_is_alive(&store,index);
+			numOfFree++;
+		}
+
+		numOfErrors += !check_live_array() || (store.total + numOfFree != 64);
+	}
+	check_value("100000 random adds and removes",numOfErrors,0);
+
+	entity_store_clear(&store);
+	check_value("cleared store give index 0",entity_store_add(&store,0,0,0,0,0,8,8),0);
+}
+
+void place_random_objects (uint16_t numOfObjects)
+{
+	entity_store_init(&store,numOfObjects,SCREEN_WIDTH,SCREEN_HEIGHT);
+
+	for(uint16_t i = 0; i < numOfObjects; i++){
+		uint32_t random = random_get();
+
+		/*-4 to 4 pixels per frame with random fraction*/
+		int32_t dx = (int32_t)(random_get() % (8 * ENTITY_STORE_ONE + 1)) - 4 * ENTITY_STORE_ONE;
+		int32_t dy = (int32_t)(random_get() % (8 * ENTITY_STORE_ONE + 1)) - 4 * ENTITY_STORE_ONE;
+
+		add_object(i,random % SCREEN_WIDTH,(random >> 12) % SCREEN_HEIGHT,dx,dy,27,25);
+	}
+
+	/*some dead objects, skipped by both layouts*/
+	for(uint16_t i = 0; i < numOfObjects; i += 5){
+		entity_store_remove(&store,i);
+		Object[i].alive = 0;
+	}
+}
+
+void test_random_scenes (void)
+{
+	const uint16_t numOfObjectSweep[] = {16,64,256,1024};
+	char name[60];
+
+	printf("-- random scenes on 320x240 screen\n");
+
+	for(uint8_t sweep = 0; sweep < sizeof(numOfObjectSweep)/sizeof(numOfObjectSweep[0]); sweep++){
+		uint16_t numOfObjects = numOfObjectSweep[sweep];
+		uint32_t numOfMismatches = 0;
+		uint32_t referenceHits = 0;
+		uint32_t storeHits = 0;
+		uint64_t start, referenceTime, storeTime, referenceOverlapTime, storeOverlapTime;
+
+		place_random_objects(numOfObjects);
+
+		for(uint16_t frame = 0; frame < STORE_TEST_REPEAT; frame++){
+			uint32_t random = random_get();
+			int16_t x = random % SCREEN_WIDTH;
+			int16_t y = (random >> 12) % SCREEN_HEIGHT;
+
+			entity_store_integrate(&store);
+			reference_integrate(numOfObjects);
+			numOfMismatches += compare_layouts(numOfObjects);
+
+			referenceHits += reference_overlap(numOfObjects,x,y,13,22);
+			storeHits += entity_store_overlap_mask(&store,x,y,13,22,hitMask);
+		}
+
+		snprintf(name,sizeof(name),"%u objects: positions match reference",numOfObjects);
+		check_value(name,numOfMismatches,0);
+		snprintf(name,sizeof(name),"%u objects: overlapping objects (%lu)",numOfObjects,(unsigned long)referenceHits);
+		check_value(name,storeHits,referenceHits);
+
+		start = get_time();
+		for(uint16_t frame = 0; frame < STORE_TEST_REPEAT; frame++){
+			reference_integrate(numOfObjects);
+		}
+		referenceTime = (get_time() - start)/STORE_TEST_REPEAT;
+
+		start = get_time();
+		for(uint16_t frame = 0; frame < STORE_TEST_REPEAT; frame++){
+			entity_store_integrate(&store);
+		}
+		storeTime = (get_time() - start)/STORE_TEST_REPEAT;
+
+		start = get_time();
+		for(uint16_t frame = 0; frame < STORE_TEST_REPEAT; frame++){
+			referenceHits += reference_overlap(numOfObjects,frame,frame,13,22);
+		}
+		referenceOverlapTime = (get_time() - start)/STORE_TEST_REPEAT;
+
+		start = get_time();
+		for(uint16_t frame = 0; frame < STORE_TEST_REPEAT; frame++){
+			storeHits += entity_store_overlap_mask(&store,frame,frame,13,22,hitMask);
+		}
+		storeOverlapTime = (get_time() - start)/STORE_TEST_REPEAT;
+
+		snprintf(name,sizeof(name),"%u objects: timed passes match",numOfObjects);
+		check_value(name,storeHits,referenceHits);
+
+		printf("   integrate AoS %7.2f us SoA %7.2f us, AABB AoS %7.2f us SoA %7.2f us\n",
+		referenceTime/1e3,storeTime/1e3,referenceOverlapTime/1e3,storeOverlapTime/1e3);
+	}
+}
+
+int main (void)
+{
+	test_sub_pixel_motion();
+	test_live_array();
+	test_random_scenes();
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
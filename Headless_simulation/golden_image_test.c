@@ -0,0 +1,154 @@
+/**
+*@brief Check that ILI9341 framebuffer mode draw same pixels as direct mode
+*
+*This program run real ILI9341 driver on emulated panel (headless_lcd.c). Start screen and game over screen of "Return To Earth"
+*are drawn directly (every drawing function send its pixels at once) and through framebuffer strips (ILI9341_framebuffer_begin),
+*then graphic RAM of both drawings are compared pixel by pixel. Graphic RAM is filled with a different color before each drawing,
+*so a pixel left out by one mode is reported too. Number of bytes sent through SPI by both modes are printed.
+*If a golden image file is given, start screen is compared with it (file is written when it does not exist yet).
+*
+*Framebuffer mode and SPI byte counter of ILI9341 driver are off by default, both are enabled on build line.
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 -DSTM32F407xx -DHEADLESS_USE_ILI9341_DRIVER -DILI9341_USE_FRAMEBUFFER -DILI9341_USE_SPI_BYTE_COUNTER -ICMSIS/Include
+*-ICMSIS/Device/ST/STM32F4xx/Include Headless_simulation/golden_image_test.c Headless_simulation/headless_lcd.c Headless_simulation/headless_stubs.c
+*Device_drivers/src/ili9341.c Game_engine_return_to_earth/game_engine.c Game_engine_return_to_earth/dirty_rect.c Game_engine_return_to_earth/spatial_grid.c
+*Game_engine_return_to_earth/entity_store.c Game_engine_return_to_earth/input_log.c Miscellaneous/src/tm_stm32f4_fonts.c -lm -o golden_image_test
+*
+*Run:
+*golden_image_test [golden image file (PPM)]
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "headless_lcd.h"
+#include "../Game_engine_return_to_earth/game_engine.h"
+#include <stdio.h>
+
+#ifndef ILI9341_USE_FRAMEBUFFER
+#error "build with -DILI9341_USE_FRAMEBUFFER, otherwise both drawings are direct"
+#endif
+
+/*graphic RAM is filled with these colors before direct and framebuffer drawing*/
+#define GOLDEN_DIRECT_FILL_COLOR		0xF81F
+#define GOLDEN_FRAMEBUFFER_FILL_COLOR	0x07E0
+
+typedef struct{
+	const char *name;
+	void (*draw_direct)(void);	/*draw screen directly*/
+	void (*draw_framebuffer)(void);	/*draw screen through framebuffer strips*/
+}Golden_Screen_t;
+
+/*private drawing functions of game engine (no framebuffer picture loop)*/
+extern void RTE_draw_start_screen(void);
+extern void RTE_draw_game_over_screen(void);
+
+extern ILI9341_Config_t ILI9341_config;
+
+uint16_t directImage[HEADLESS_LCD_SIZE][HEADLESS_LCD_SIZE];
+
+Golden_Screen_t screen[] = {
+	{"start screen",RTE_draw_start_screen,RTE_display_start_screen},
+	{"game over screen",RTE_draw_game_over_screen,RTE_display_game_over_screen},
+};
+
+/*draw screen in both modes and compare, return number of different pixels*/
+uint32_t check_screen (const Golden_Screen_t *ScreenPtr)
+{
+	uint32_t directBytes, framebufferBytes, directPixels, framebufferPixels;
+	uint32_t numOfDifferences = 0;
+	uint16_t firstX = 0, firstY = 0;
+
+	headless_lcd_clear(GOLDEN_DIRECT_FILL_COLOR);
+	ILI9341_reset_SPI_byte_count();
+	ScreenPtr->draw_direct();
+	ILI9341_wait_until_ready();
+	directBytes = ILI9341_get_SPI_byte_count();
+	directPixels = headless_lcd_get_pixels_written();
+
+	for(uint16_t y = 0; y < ILI9341_config.height; y++){
+		for(uint16_t x = 0; x < ILI9341_config.width; x++){
+			directImage[y][x] = headless_lcd_get_pixel(x,y);
+		}
+	}
+
+	headless_lcd_clear(GOLDEN_FRAMEBUFFER_FILL_COLOR);
+	ILI9341_reset_SPI_byte_count();
+	ScreenPtr->draw_framebuffer();
+	ILI9341_wait_until_ready();
+	framebufferBytes = ILI9341_get_SPI_byte_count();
+	framebufferPixels = headless_lcd_get_pixels_written();
+
+	for(uint16_t y = 0; y < ILI9341_config.height; y++){
+		for(uint16_t x = 0; x < ILI9341_config.width; x++){
+			if(directImage[y][x] != headless_lcd_get_pixel(x,y)){
+				if(!numOfDifferences){
+					firstX = x;
+					firstY = y;
+				}
+				numOfDifferences++;
+			}
+		}
+	}
+
+	printf("%s:\n",ScreenPtr->name);
+	printf("  direct:      %lu bytes through SPI, %lu pixels written\n",(unsigned long)directBytes,(unsigned long)directPixels);
+	printf("  framebuffer: %lu bytes through SPI, %lu pixels written\n",(unsigned long)framebufferBytes,(unsigned long)framebufferPixels);
+
+	if(numOfDifferences){
+		printf("  FAIL: %lu different pixels, first at (%u,%u): direct 0x%04x, framebuffer 0x%04x\n",(unsigned long)numOfDifferences,firstX,firstY,
+				directImage[firstY][firstX],headless_lcd_get_pixel(firstX,firstY));
+	}else{
+		printf("  pass\n");
+	}
+
+	return numOfDifferences;
+}
+
+int main (int argc, char *argv[])
+{
+	uint8_t failed = 0;
+
+	RTE_init();
+
+	for(uint8_t i = 0; i < sizeof(screen)/sizeof(screen[0]); i++){
+		if(check_screen(&screen[i])){
+			failed = 1;
+		}
+	}
+
+	if(argc > 1){
+		/*golden image is compared with start screen, it is written only when file does not exist*/
+		FILE *filePtr = fopen(argv[1],"rb");
+		uint32_t numOfDifferences;
+
+		RTE_display_start_screen();
+		ILI9341_wait_until_ready();
+
+		if(filePtr == NULL){
+			if(headless_lcd_save_ppm(argv[1],ILI9341_config.width,ILI9341_config.height)){
+				printf("golden image %s written\n",argv[1]);
+			}else{
+				printf("FAIL: golden image %s can not be written\n",argv[1]);
+				failed = 1;
+			}
+		}else{
+			fclose(filePtr);
+			numOfDifferences = headless_lcd_compare_ppm(argv[1],ILI9341_config.width,ILI9341_config.height);
+
+			if(numOfDifferences == UINT32_MAX){
+				printf("FAIL: golden image %s can not be read or has different size\n",argv[1]);
+				failed = 1;
+			}else if(numOfDifferences){
+				printf("FAIL: start screen differ from golden image %s in %lu pixels\n",argv[1],(unsigned long)numOfDifferences);
+				failed = 1;
+			}else{
+				printf("start screen match golden image %s\n",argv[1]);
+			}
+		}
+	}
+
+	return failed;
+}
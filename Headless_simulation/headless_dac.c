@@ -0,0 +1,175 @@
+/**
+*@file headless_dac.c
+*@brief Emulate DAC fed by DMA on PC, so that real speaker driver (Device_drivers/src/speaker.c) can run without hardware.
+*
+*This implementation file provide stub implementations of DAC and DMA driver functions used by speaker driver.
+*Sample moved by DMA is output on the same trigger event (one sample delay of hardware between data holding register
+*and output register is not emulated).
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "headless_dac.h"
+#include "../Device_drivers/inc/speaker.h"
+
+/***********************************************************************
+External function prototype
+***********************************************************************/
+#ifdef SPEAKER_USE_DMA
+extern void SPEAKER_DMA_IRQ_HANDLER (void);
+#endif
+
+/***********************************************************************
+Private structure definition
+***********************************************************************/
+typedef struct{
+	const uint16_t *bufferPtr;
+	uint16_t count;
+	uint16_t position;	/*next sample to transfer*/
+	uint8_t pendingEvents;	/*refer to @DAC_EVENT, reported by DAC_DMA_intrpt_handler*/
+}Headless_DAC_DMA_t;
+
+/***********************************************************************
+Private function prototype
+***********************************************************************/
+void headless_dac_output (uint16_t sample);
+
+/***********************************************************************
+Global variable
+***********************************************************************/
+DAC_Handle_t DACxHandle;
+DAC_Config_t DACxConfig;
+
+DMA_Handle_t headlessDACDMAHandle;
+Headless_DAC_DMA_t headlessDACDMA;
+
+uint16_t *dacOutputPtr = NULL;
+uint32_t dacOutputSize = 0;
+uint32_t numOfDacOutputs = 0;
+
+/***********************************************************************
+Public function: Set buffer receiving samples output by DAC
+***********************************************************************/
+void headless_dac_set_output(uint16_t *bufferPtr, uint32_t size)
+{
+	dacOutputPtr = bufferPtr;
+	dacOutputSize = size;
+	numOfDacOutputs = 0;
+}
+
+/***********************************************************************
+Public function: Get number of samples output by DAC
+***********************************************************************/
+uint32_t headless_dac_get_num_of_outputs(void)
+{
+	return numOfDacOutputs;
+}
+
+/***********************************************************************
+Public function: Emulate trigger events of DAC
+***********************************************************************/
+void headless_dac_trigger(uint32_t numOfTriggers)
+{
+	Headless_DAC_DMA_t *DMAPtr = &headlessDACDMA;
+
+	while(numOfTriggers--){
+		if(headlessDACDMAHandle.state != DMA_STATE_BUSY){
+			return;
+		}
+
+		headless_dac_output(DMAPtr->bufferPtr[DMAPtr->position++]);
+
+		if(DMAPtr->position == DMAPtr->count/2){
+			DMAPtr->pendingEvents |= DAC_EV_DMA_HALF_TRANSFER;
+		}else if(DMAPtr->position == DMAPtr->count){
+			DMAPtr->position = 0;
+			DMAPtr->pendingEvents |= DAC_EV_DMA_TRANSFER_CMPLT;
+		}else{
+			continue;
+		}
+
+#ifdef SPEAKER_USE_DMA
+		SPEAKER_DMA_IRQ_HANDLER();
+#endif
+	}
+}
+
+/***********************************************************************
+Public function: Check whether DMA transfer feeding DAC is running
+***********************************************************************/
+uint8_t headless_dac_DMA_running_check(void)
+{
+	return (headlessDACDMAHandle.state == DMA_STATE_BUSY) ? 1 : 0;
+}
+
+/***********************************************************************
+Private function: Store sample output by DAC
+***********************************************************************/
+void headless_dac_output (uint16_t sample)
+{
+	if(dacOutputPtr != NULL && numOfDacOutputs < dacOutputSize){
+		dacOutputPtr[numOfDacOutputs] = sample;
+	}
+	numOfDacOutputs++;
+}
+
+/***********************************************************************
+Stub: DAC driver
+***********************************************************************/
+void DAC_init(DAC_Handle_t *DACxHandlePtr)
+{
+}
+
+void DAC_init_channel(uint8_t channel)
+{
+	DACxConfig.channel = channel;
+	DACxConfig.resolution = DAC_RES_12_bits;
+	DACxConfig.alignment = DAC_ALIGNMENT_RIGHT;
+	DACxConfig.triggerEV = DAC_NO_TRIGGER_EV;
+	DACxConfig.outputBuffer = DAC_OBUFFER_EN;
+
+	DACxHandle.DACxConfigPtr = &DACxConfig;
+	DACxHandle.DACxPtr = DAC;
+}
+
+void DAC_write(DAC_Handle_t *DACxHandlePtr, uint16_t digiVal)
+{
+	headless_dac_output(digiVal);
+}
+
+void DAC_DMA_init(DAC_Handle_t *DACxHandlePtr)
+{
+	headlessDACDMAHandle.state = DMA_STATE_READY;
+	DACxHandlePtr->DMAxHandlePtr = &headlessDACDMAHandle;
+}
+
+void DAC_start_DMA(DAC_Handle_t *DACxHandlePtr, const void *bufferPtr, uint16_t count)
+{
+	headlessDACDMA.bufferPtr = bufferPtr;
+	headlessDACDMA.count = count;
+	headlessDACDMA.position = 0;
+	headlessDACDMA.pendingEvents = 0;
+	headlessDACDMAHandle.state = DMA_STATE_BUSY;
+}
+
+void DAC_stop_DMA(DAC_Handle_t *DACxHandlePtr)
+{
+	headlessDACDMAHandle.state = DMA_STATE_READY;
+}
+
+uint8_t DAC_DMA_intrpt_handler(DAC_Handle_t *DACxHandlePtr)
+{
+	uint8_t event = headlessDACDMA.pendingEvents;
+
+	headlessDACDMA.pendingEvents = 0;
+
+	return event;
+}
+
+/***********************************************************************
+Stub: DMA driver
+***********************************************************************/
+void DMA_intrpt_vector_ctr(uint8_t IRQnumber, uint8_t enOrDis)
+{
+}
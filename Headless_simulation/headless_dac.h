@@ -0,0 +1,51 @@
+/**
+*@file headless_dac.h
+*@brief Emulate DAC fed by DMA on PC, so that real speaker driver (Device_drivers/src/speaker.c) can run without hardware.
+*
+*This header file provide functions for triggering emulated DAC conversions and reading samples output by DAC.
+*Stub implementations of DAC and DMA driver functions used by speaker driver emulate a circular DMA transfer: each trigger event
+*(timer update event on hardware) move one sample of buffer to DAC output, stream IRQ handler of speaker driver is called at
+*half transfer and transfer complete. Samples written with DAC_write (speaker driver without DMA) are output as well.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef HEADLESS_DAC_H
+#define HEADLESS_DAC_H
+
+#include <stdint.h>
+
+/**
+*@brief		Set buffer receiving samples output by DAC, number of outputs is reset
+*@param		bufferPtr Buffer of samples
+*@param		size Number of samples in buffer (following samples are counted, not stored)
+*@return	None
+*/
+void headless_dac_set_output(uint16_t *bufferPtr, uint32_t size);
+
+/**
+*@brief		Get number of samples output by DAC since last call to headless_dac_set_output
+*@param		None
+*@return	Number of samples
+*/
+uint32_t headless_dac_get_num_of_outputs(void);
+
+/**
+*@brief		Emulate trigger events of DAC, one sample is transferred by DMA on each event
+*
+*Nothing is output while DMA transfer is stopped (trigger events are ignored by DAC without DMA).
+*
+*@param		numOfTriggers Number of trigger events
+*@return	None
+*/
+void headless_dac_trigger(uint32_t numOfTriggers);
+
+/**
+*@brief		Check whether DMA transfer feeding DAC is running
+*@param		None
+*@return	1 if transfer is running, 0 otherwise
+*/
+uint8_t headless_dac_DMA_running_check(void);
+
+#endif
@@ -0,0 +1,682 @@
+/**
+*@file headless_i2c.c
+*@brief Emulate I2C bus with its DMA streams and slave devices on PC, so that real I2C driver (Peripheral_drivers/src/stm32f407xx_i2c.c)
+*can run transaction queue without hardware.
+*
+*This implementation file provide emulated I2C registers and slaves, and stub implementations of DMA and RCC driver functions used by
+*I2C driver. Address written to data register by event handler on SB is detected with a value which can not be a byte.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "headless_i2c.h"
+
+/*value left in data register before calling I2C event handler on SB*/
+#define HEADLESS_I2C_DR_UNWRITTEN	0xFFFFFFFF
+
+/*APB1 clock after RCC_set_SYSCLK_PLL_84_MHz*/
+#define HEADLESS_I2C_PCLK1		21000000
+
+/*
+*@HEADLESS_I2C_BUS_STATE
+*Transfer of I2C driver on emulated bus
+*/
+#define HEADLESS_I2C_BUS_IDLE		0	/*no transfer (or bus used by other master)*/
+#define HEADLESS_I2C_BUS_ADDRESS	1	/*start condition sent, address byte is sent once written to data register*/
+#define HEADLESS_I2C_BUS_WRITE		2
+#define HEADLESS_I2C_BUS_READ		3
+#define HEADLESS_I2C_BUS_HALTED		4	/*byte not acknowledged, bus is held until stop or start condition*/
+
+/***********************************************************************
+Private structure definition
+***********************************************************************/
+typedef struct{
+	DMA_Handle_t *DMAxHandlePtr;	/*stream set by DMA_init*/
+	uint8_t *memPtr;
+	uint16_t count;
+	uint16_t remaining;
+	uint32_t interrupts;	/*refer to @DMA_INTERRUPT*/
+	uint8_t pendingEvents;	/*refer to @DMA_EVENT, reported by DMA_intrpt_handler*/
+}Headless_I2C_DMA_t;
+
+/***********************************************************************
+Private function prototype
+***********************************************************************/
+void headless_i2c_call_event_handler (void);
+void headless_i2c_call_err_handler (void);
+void headless_i2c_start (void);
+void headless_i2c_stop (void);
+void headless_i2c_end_transfer (uint8_t repeatedStart);
+void headless_i2c_send_address (void);
+void headless_i2c_send_byte (void);
+void headless_i2c_receive_byte (void);
+uint8_t headless_i2c_slave_write (Headless_I2C_Slave_t *SlavePtr, uint8_t data);
+uint8_t headless_i2c_slave_read (Headless_I2C_Slave_t *SlavePtr);
+void headless_i2c_slave_program (Headless_I2C_Slave_t *SlavePtr, uint8_t numOfBytes);
+Headless_I2C_DMA_t* headless_i2c_get_DMA (DMA_Handle_t *DMAxHandlePtr);
+
+/***********************************************************************
+Global variable
+***********************************************************************/
+I2C_TypeDef headlessI2C;
+I2C_Handle_t *headlessI2CHandlePtr = NULL;
+
+Headless_I2C_DMA_t headlessI2CTxDMA;
+Headless_I2C_DMA_t headlessI2CRxDMA;
+
+Headless_I2C_Slave_t *headlessI2CSlavePtr[HEADLESS_I2C_MAX_SLAVES];
+uint8_t numOfHeadlessI2CSlaves = 0;
+Headless_I2C_Slave_t *currentSlavePtr = NULL;	/*slave which acknowledged last address*/
+
+uint8_t busState = HEADLESS_I2C_BUS_IDLE;
+uint8_t addressWritten = 0;
+uint8_t addressByte = 0;
+uint8_t arbitrationLossCount = 0;
+uint32_t otherMasterTime = 0;
+
+Headless_I2C_Stats_t headlessI2CStats;
+
+/***********************************************************************
+Public function: Connect I2C handle to emulated I2C registers
+***********************************************************************/
+void headless_i2c_init(I2C_Handle_t *I2CxHandlePtr)
+{
+	headlessI2C.CR1 = 0;
+	headlessI2C.CR2 = 0;
+	headlessI2C.OAR1 = 0;
+	headlessI2C.OAR2 = 0;
+	headlessI2C.DR = 0;
+	headlessI2C.SR1 = 0;
+	headlessI2C.SR2 = 0;
+	headlessI2C.CCR = 0;
+	headlessI2C.TRISE = 0;
+
+	I2CxHandlePtr->I2CxPtr = &headlessI2C;
+	I2CxHandlePtr->State = I2C_READY;
+	I2CxHandlePtr->DMAxTxHandlePtr = NULL;
+	I2CxHandlePtr->DMAxRxHandlePtr = NULL;
+	headlessI2CHandlePtr = I2CxHandlePtr;
+
+	headlessI2CTxDMA.DMAxHandlePtr = NULL;
+	headlessI2CRxDMA.DMAxHandlePtr = NULL;
+
+	numOfHeadlessI2CSlaves = 0;
+	currentSlavePtr = NULL;
+	busState = HEADLESS_I2C_BUS_IDLE;
+	addressWritten = 0;
+	arbitrationLossCount = 0;
+	otherMasterTime = 0;
+
+	headless_i2c_reset_stats();
+}
+
+/***********************************************************************
+Public function: Attach simulated slave to bus
+***********************************************************************/
+uint8_t headless_i2c_add_slave(Headless_I2C_Slave_t *SlavePtr)
+{
+	if(numOfHeadlessI2CSlaves >= HEADLESS_I2C_MAX_SLAVES){
+		return FALSE;
+	}
+
+	SlavePtr->numOfWrites = 0;
+	SlavePtr->numOfReads = 0;
+	SlavePtr->numOfBytesWritten = 0;
+	SlavePtr->numOfBytesRead = 0;
+	SlavePtr->numOfStops = 0;
+	SlavePtr->numOfRepeatedStarts = 0;
+	SlavePtr->numOfReadsNACKed = 0;
+	SlavePtr->numOfReadsNotNACKed = 0;
+	SlavePtr->pointer = 0;
+	SlavePtr->addressBytesLeft = 0;
+	SlavePtr->bytesInWrite = 0;
+	SlavePtr->lastReadAcked = 0;
+	SlavePtr->numOfWriteCycles = 0;
+	SlavePtr->numOfLatched = 0;
+	SlavePtr->writeCycleLeft = 0;
+
+	headlessI2CSlavePtr[numOfHeadlessI2CSlaves++] = SlavePtr;
+
+	return TRUE;
+}
+
+/***********************************************************************
+Public function: Make next address phases lose arbitration
+***********************************************************************/
+void headless_i2c_lose_arbitration(uint8_t count)
+{
+	arbitrationLossCount = count;
+}
+
+/***********************************************************************
+Public function: Cut power of attached slaves
+***********************************************************************/
+void headless_i2c_power_loss(void)
+{
+	Headless_I2C_Slave_t *SlavePtr;
+
+	for(uint8_t i = 0; i < numOfHeadlessI2CSlaves; i++){
+		SlavePtr = headlessI2CSlavePtr[i];
+
+		if(SlavePtr->writeCycleLeft){
+			headless_i2c_slave_program(SlavePtr,(uint8_t)(SlavePtr->numOfLatched * (SlavePtr->writeCycleTime - SlavePtr->writeCycleLeft) / SlavePtr->writeCycleTime));
+			SlavePtr->writeCycleLeft = 0;
+		}
+
+		SlavePtr->numOfLatched = 0;
+	}
+
+	currentSlavePtr = NULL;
+	busState = HEADLESS_I2C_BUS_IDLE;
+}
+
+/***********************************************************************
+Public function: Run emulated bus
+***********************************************************************/
+void headless_i2c_run(uint32_t numOfByteTimes)
+{
+	I2C_TypeDef *I2CPtr = &headlessI2C;
+
+	while(numOfByteTimes--){
+		headlessI2CStats.numOfByteTimes++;
+
+		/*slaves program latched bytes whatever master is doing*/
+		for(uint8_t i = 0; i < numOfHeadlessI2CSlaves; i++){
+			if(headlessI2CSlavePtr[i]->writeCycleLeft && --headlessI2CSlavePtr[i]->writeCycleLeft == 0){
+				headless_i2c_slave_program(headlessI2CSlavePtr[i],headlessI2CSlavePtr[i]->numOfLatched);
+			}
+		}
+
+		/*other master which won arbitration release bus with its stop condition*/
+		if(otherMasterTime){
+			if(--otherMasterTime == 0){
+				I2CPtr->SR2 &= ~I2C_SR2_BUSY;
+			}
+			continue;
+		}
+
+		if(!(I2CPtr->CR1 & I2C_CR1_PE)){
+			continue;
+		}
+
+		/*stop or start requested while receiving is generated after byte being received*/
+		if(busState == HEADLESS_I2C_BUS_READ && (I2CPtr->CR1 & (I2C_CR1_STOP | I2C_CR1_START))){
+			headless_i2c_receive_byte();
+		}
+
+		if(I2CPtr->CR1 & I2C_CR1_STOP){
+			headless_i2c_stop();
+		}
+
+		if(I2CPtr->CR1 & I2C_CR1_START){
+			headless_i2c_start();
+			continue;
+		}
+
+		if(busState == HEADLESS_I2C_BUS_ADDRESS){
+			headless_i2c_send_address();
+		}else if(busState == HEADLESS_I2C_BUS_WRITE){
+			headless_i2c_send_byte();
+		}else if(busState == HEADLESS_I2C_BUS_READ){
+			headless_i2c_receive_byte();
+		}
+	}
+}
+
+/***********************************************************************
+Public function: Get counters of emulated bus
+***********************************************************************/
+void headless_i2c_get_stats(Headless_I2C_Stats_t *StatsPtr)
+{
+	*StatsPtr = headlessI2CStats;
+}
+
+/***********************************************************************
+Public function: Reset counters of emulated bus
+***********************************************************************/
+void headless_i2c_reset_stats(void)
+{
+	headlessI2CStats.numOfByteTimes = 0;
+	headlessI2CStats.busBusyTime = 0;
+	headlessI2CStats.numOfEventIRQs = 0;
+	headlessI2CStats.numOfErrorIRQs = 0;
+	headlessI2CStats.numOfTxDMAIRQs = 0;
+	headlessI2CStats.numOfRxDMAIRQs = 0;
+	headlessI2CStats.numOfArbitrationLosses = 0;
+	headlessI2CStats.numOfStarts = 0;
+	headlessI2CStats.numOfStops = 0;
+}
+
+/***********************************************************************
+Private function: Call I2C event interrupt handler (when ITEVTEN is set)
+***********************************************************************/
+void headless_i2c_call_event_handler (void)
+{
+	if(headlessI2C.CR2 & I2C_CR2_ITEVTEN){
+		headlessI2CStats.numOfEventIRQs++;
+		I2C_event_intrpt_handler(headlessI2CHandlePtr);
+	}
+}
+
+/***********************************************************************
+Private function: Call I2C error interrupt handler (when ITERREN is set)
+***********************************************************************/
+void headless_i2c_call_err_handler (void)
+{
+	if(headlessI2C.CR2 & I2C_CR2_ITERREN){
+		headlessI2CStats.numOfErrorIRQs++;
+		I2C_err_intrpt_handler(headlessI2CHandlePtr);
+	}
+}
+
+/***********************************************************************
+Private function: Generate start or repeated start condition, then wait for address written by event handler on SB
+***********************************************************************/
+void headless_i2c_start (void)
+{
+	I2C_TypeDef *I2CPtr = &headlessI2C;
+
+	/*start condition is held back while other master use bus*/
+	if((I2CPtr->SR2 & I2C_SR2_BUSY) && !(I2CPtr->SR2 & I2C_SR2_MSL)){
+		return;
+	}
+
+	I2CPtr->CR1 &= ~I2C_CR1_START;
+
+	if(busState != HEADLESS_I2C_BUS_IDLE){
+		headless_i2c_end_transfer(TRUE);
+	}
+
+	headlessI2CStats.numOfStarts++;
+	busState = HEADLESS_I2C_BUS_ADDRESS;
+	I2CPtr->SR1 &= ~(I2C_SR1_TXE | I2C_SR1_BTF);
+	I2CPtr->SR1 |= I2C_SR1_SB;
+	I2CPtr->SR2 |= I2C_SR2_MSL | I2C_SR2_BUSY;
+
+	I2CPtr->DR = HEADLESS_I2C_DR_UNWRITTEN;
+	headless_i2c_call_event_handler();
+
+	if(I2CPtr->DR != HEADLESS_I2C_DR_UNWRITTEN){
+		addressByte = (uint8_t)I2CPtr->DR;
+		addressWritten = 1;
+		I2CPtr->SR1 &= ~I2C_SR1_SB;
+	}
+}
+
+/***********************************************************************
+Private function: Generate stop condition (ignored when I2C driver is not master)
+***********************************************************************/
+void headless_i2c_stop (void)
+{
+	I2C_TypeDef *I2CPtr = &headlessI2C;
+
+	I2CPtr->CR1 &= ~I2C_CR1_STOP;
+
+	if(!(I2CPtr->SR2 & I2C_SR2_MSL)){
+		return;
+	}
+
+	headless_i2c_end_transfer(FALSE);
+
+	headlessI2CStats.numOfStops++;
+	busState = HEADLESS_I2C_BUS_IDLE;
+	I2CPtr->SR1 &= ~(I2C_SR1_TXE | I2C_SR1_BTF);
+	I2CPtr->SR2 &= ~(I2C_SR2_MSL | I2C_SR2_BUSY | I2C_SR2_TRA);
+}
+
+/***********************************************************************
+Private function: Inform slave of end of transfer by stop or repeated start condition
+***********************************************************************/
+void headless_i2c_end_transfer (uint8_t repeatedStart)
+{
+	Headless_I2C_Slave_t *SlavePtr = currentSlavePtr;
+
+	currentSlavePtr = NULL;
+
+	if(SlavePtr == NULL){
+		return;
+	}
+
+	if(repeatedStart){
+		SlavePtr->numOfRepeatedStarts++;
+	}else{
+		SlavePtr->numOfStops++;
+	}
+
+	if(busState == HEADLESS_I2C_BUS_READ){
+		if(SlavePtr->lastReadAcked){
+			SlavePtr->numOfReadsNotNACKed++;
+		}else{
+			SlavePtr->numOfReadsNACKed++;
+		}
+	}
+
+	/*latched bytes are only programmed when write is ended by stop condition*/
+	if(SlavePtr->numOfLatched && !SlavePtr->writeCycleLeft){
+		if(repeatedStart){
+			SlavePtr->numOfLatched = 0;
+		}else{
+			SlavePtr->numOfWriteCycles++;
+			SlavePtr->writeCycleLeft = SlavePtr->writeCycleTime;
+		}
+	}
+}
+
+/***********************************************************************
+Private function: Send address byte, acknowledged by matching slave unless arbitration is lost
+***********************************************************************/
+void headless_i2c_send_address (void)
+{
+	I2C_TypeDef *I2CPtr = &headlessI2C;
+	Headless_I2C_Slave_t *SlavePtr = NULL;
+
+	if(!addressWritten){
+		return;
+	}
+
+	addressWritten = 0;
+	headlessI2CStats.busBusyTime++;
+
+	/*other master sent a lower address bit at same time, interface go back to slave mode*/
+	if(arbitrationLossCount){
+		arbitrationLossCount--;
+		headlessI2CStats.numOfArbitrationLosses++;
+		busState = HEADLESS_I2C_BUS_IDLE;
+		otherMasterTime = HEADLESS_I2C_OTHER_MASTER_TIME;
+		I2CPtr->SR1 |= I2C_SR1_ARLO;
+		I2CPtr->SR2 &= ~(I2C_SR2_MSL | I2C_SR2_TRA);
+		headless_i2c_call_err_handler();
+		return;
+	}
+
+	for(uint8_t i = 0; i < numOfHeadlessI2CSlaves; i++){
+		if(headlessI2CSlavePtr[i]->address == (addressByte >> 1)){
+			SlavePtr = headlessI2CSlavePtr[i];
+		}
+	}
+
+	if(SlavePtr == NULL || SlavePtr->nackAddress || SlavePtr->writeCycleLeft){
+		busState = HEADLESS_I2C_BUS_HALTED;
+		I2CPtr->SR1 |= I2C_SR1_AF;
+		headless_i2c_call_err_handler();
+		return;
+	}
+
+	currentSlavePtr = SlavePtr;
+
+	if(!SlavePtr->addressSize){
+		SlavePtr->pointer = 0;
+	}
+
+	if(addressByte & 1){
+		SlavePtr->numOfReads++;
+		SlavePtr->lastReadAcked = 0;
+		busState = HEADLESS_I2C_BUS_READ;
+		I2CPtr->SR2 &= ~I2C_SR2_TRA;
+	}else{
+		SlavePtr->numOfWrites++;
+		SlavePtr->addressBytesLeft = SlavePtr->addressSize;
+		SlavePtr->bytesInWrite = 0;
+		busState = HEADLESS_I2C_BUS_WRITE;
+		I2CPtr->SR2 |= I2C_SR2_TRA;
+	}
+
+	/*handler read SR1 then SR2*/
+	I2CPtr->SR1 |= I2C_SR1_ADDR;
+	headless_i2c_call_event_handler();
+	I2CPtr->SR1 &= ~I2C_SR1_ADDR;
+}
+
+/***********************************************************************
+Private function: Send byte taken from DMA, BTF is set when DMA has no more byte
+***********************************************************************/
+void headless_i2c_send_byte (void)
+{
+	I2C_TypeDef *I2CPtr = &headlessI2C;
+	Headless_I2C_DMA_t *DMAPtr = &headlessI2CTxDMA;
+	uint8_t data;
+
+	if((I2CPtr->CR2 & I2C_CR2_DMAEN) && DMAPtr->DMAxHandlePtr != NULL && DMAPtr->DMAxHandlePtr->state == DMA_STATE_BUSY && DMAPtr->remaining){
+		data = DMAPtr->memPtr[DMAPtr->count - DMAPtr->remaining];
+		headlessI2CStats.busBusyTime++;
+		I2CPtr->SR1 &= ~(I2C_SR1_TXE | I2C_SR1_BTF);
+
+		if(--DMAPtr->remaining == 0){
+			DMAPtr->pendingEvents |= DMA_EV_TRANSFER_CMPLT;
+			if(DMAPtr->interrupts & DMA_INTRPT_TC){
+				headlessI2CStats.numOfTxDMAIRQs++;
+				I2C_DMA_TX_intrpt_handler(headlessI2CHandlePtr);
+			}
+		}
+
+		if(!headless_i2c_slave_write(currentSlavePtr,data)){
+			busState = HEADLESS_I2C_BUS_HALTED;
+			I2CPtr->SR1 |= I2C_SR1_AF;
+			headless_i2c_call_err_handler();
+			return;
+		}
+
+		/*DMA refill data register while byte is shifted out*/
+		if((I2CPtr->CR2 & I2C_CR2_DMAEN) && DMAPtr->DMAxHandlePtr->state == DMA_STATE_BUSY && DMAPtr->remaining){
+			return;
+		}
+	}
+
+	I2CPtr->SR1 |= I2C_SR1_TXE | I2C_SR1_BTF;
+	headless_i2c_call_event_handler();
+}
+
+/***********************************************************************
+Private function: Receive byte into DMA or through event handler on RXNE (clock is stretched when neither can take it)
+***********************************************************************/
+void headless_i2c_receive_byte (void)
+{
+	I2C_TypeDef *I2CPtr = &headlessI2C;
+	Headless_I2C_DMA_t *DMAPtr = &headlessI2CRxDMA;
+	uint8_t useDMA;
+	uint8_t data;
+
+	if(I2CPtr->SR1 & I2C_SR1_ADDR){
+		return;
+	}
+
+	useDMA = (I2CPtr->CR2 & I2C_CR2_DMAEN) && DMAPtr->DMAxHandlePtr != NULL && DMAPtr->DMAxHandlePtr->state == DMA_STATE_BUSY && DMAPtr->remaining;
+
+	if(!useDMA && !((I2CPtr->CR2 & I2C_CR2_ITBUFEN) && (I2CPtr->CR2 & I2C_CR2_ITEVTEN))){
+		return;
+	}
+
+	data = headless_i2c_slave_read(currentSlavePtr);
+	headlessI2CStats.busBusyTime++;
+
+	/*LAST bit make hardware NACK byte ending DMA transfer*/
+	currentSlavePtr->lastReadAcked = (I2CPtr->CR1 & I2C_CR1_ACK) && !(useDMA && (I2CPtr->CR2 & I2C_CR2_LAST) && DMAPtr->remaining == 1);
+
+	if(useDMA){
+		DMAPtr->memPtr[DMAPtr->count - DMAPtr->remaining] = data;
+
+		if(--DMAPtr->remaining == 0){
+			DMAPtr->pendingEvents |= DMA_EV_TRANSFER_CMPLT;
+			if(DMAPtr->interrupts & DMA_INTRPT_TC){
+				headlessI2CStats.numOfRxDMAIRQs++;
+				I2C_DMA_RX_intrpt_handler(headlessI2CHandlePtr);
+			}
+		}
+	}else{
+		/*handler read DR*/
+		I2CPtr->DR = data;
+		I2CPtr->SR1 |= I2C_SR1_RXNE;
+		headless_i2c_call_event_handler();
+		I2CPtr->SR1 &= ~I2C_SR1_RXNE;
+	}
+}
+
+/***********************************************************************
+Private function: Slave take written byte (memory address first), return FALSE when byte is not acknowledged
+***********************************************************************/
+uint8_t headless_i2c_slave_write (Headless_I2C_Slave_t *SlavePtr, uint8_t data)
+{
+	if(SlavePtr->nackAfterBytes && SlavePtr->bytesInWrite >= SlavePtr->nackAfterBytes){
+		return FALSE;
+	}
+
+	SlavePtr->bytesInWrite++;
+	SlavePtr->numOfBytesWritten++;
+
+	if(SlavePtr->addressBytesLeft){
+		SlavePtr->addressBytesLeft--;
+		SlavePtr->pointer = ((SlavePtr->pointer << 8) | data) % SlavePtr->memorySize;
+		return TRUE;
+	}
+
+	if(SlavePtr->writeCycleTime){
+		if(SlavePtr->numOfLatched < HEADLESS_I2C_MAX_LATCH){
+			SlavePtr->latchPointer[SlavePtr->numOfLatched] = SlavePtr->pointer;
+			SlavePtr->latchData[SlavePtr->numOfLatched++] = data;
+		}
+	}else{
+		SlavePtr->memoryPtr[SlavePtr->pointer] = data;
+	}
+
+	/*address counter of a page write only increment inside page*/
+	if(SlavePtr->pageSize){
+		SlavePtr->pointer = (SlavePtr->pointer & ~(uint32_t)(SlavePtr->pageSize - 1)) | ((SlavePtr->pointer + 1) & (SlavePtr->pageSize - 1));
+	}else{
+		SlavePtr->pointer = (SlavePtr->pointer + 1) % SlavePtr->memorySize;
+	}
+
+	return TRUE;
+}
+
+/***********************************************************************
+Private function: Slave give byte at memory pointer
+***********************************************************************/
+uint8_t headless_i2c_slave_read (Headless_I2C_Slave_t *SlavePtr)
+{
+	uint8_t data = SlavePtr->memoryPtr[SlavePtr->pointer];
+
+	SlavePtr->pointer = (SlavePtr->pointer + 1) % SlavePtr->memorySize;
+	SlavePtr->numOfBytesRead++;
+
+	return data;
+}
+
+/***********************************************************************
+Private function: Program latched bytes, first numOfBytes get written value and the others are left erased
+***********************************************************************/
+void headless_i2c_slave_program (Headless_I2C_Slave_t *SlavePtr, uint8_t numOfBytes)
+{
+	for(uint8_t i = 0; i < SlavePtr->numOfLatched; i++){
+		SlavePtr->memoryPtr[SlavePtr->latchPointer[i]] = (i < numOfBytes) ? SlavePtr->latchData[i] : 0xFF;
+	}
+
+	SlavePtr->numOfLatched = 0;
+}
+
+/***********************************************************************
+Private function: Get emulated stream from DMA handle (NULL if handle is not a stream of I2C)
+***********************************************************************/
+Headless_I2C_DMA_t* headless_i2c_get_DMA (DMA_Handle_t *DMAxHandlePtr)
+{
+	if(DMAxHandlePtr == headlessI2CTxDMA.DMAxHandlePtr){
+		return &headlessI2CTxDMA;
+	}else if(DMAxHandlePtr == headlessI2CRxDMA.DMAxHandlePtr){
+		return &headlessI2CRxDMA;
+	}
+
+	return NULL;
+}
+
+/***********************************************************************
+Stub: DMA driver (streams are told apart by direction)
+***********************************************************************/
+void DMA_init(DMA_Handle_t *DMAxHandlePtr)
+{
+	Headless_I2C_DMA_t *DMAPtr = (DMAxHandlePtr->DMAxConfigPtr->direction == DMA_DIR_MEM_TO_PERIPH) ? &headlessI2CTxDMA : &headlessI2CRxDMA;
+
+	DMAPtr->DMAxHandlePtr = DMAxHandlePtr;
+	DMAPtr->remaining = 0;
+	DMAPtr->interrupts = 0;
+	DMAPtr->pendingEvents = 0;
+	DMAxHandlePtr->state = DMA_STATE_READY;
+}
+
+void DMA_start(DMA_Handle_t *DMAxHandlePtr, uint32_t periphAddr, uint32_t memAddr, uint16_t numOfData)
+{
+	Headless_I2C_DMA_t *DMAPtr = headless_i2c_get_DMA(DMAxHandlePtr);
+	I2C_Transaction_t *TransactionPtr = headlessI2CHandlePtr->queuePtr[headlessI2CHandlePtr->queueHead % I2C_QUEUE_SIZE];
+
+	/*addresses are 64 bits on PC, memory address is taken from transaction running*/
+	if(DMAPtr == &headlessI2CTxDMA){
+		DMAPtr->memPtr = (uint8_t*)TransactionPtr->txBufferPtr;
+	}else if(DMAPtr == &headlessI2CRxDMA){
+		DMAPtr->memPtr = TransactionPtr->rxBufferPtr;
+	}else{
+		return;
+	}
+
+	DMAPtr->count = numOfData;
+	DMAPtr->remaining = numOfData;
+	DMAPtr->pendingEvents = 0;
+	DMAxHandlePtr->state = DMA_STATE_BUSY;
+}
+
+void DMA_stop(DMA_Handle_t *DMAxHandlePtr)
+{
+	DMAxHandlePtr->state = DMA_STATE_READY;
+}
+
+uint16_t DMA_get_remaining(DMA_Handle_t *DMAxHandlePtr)
+{
+	Headless_I2C_DMA_t *DMAPtr = headless_i2c_get_DMA(DMAxHandlePtr);
+
+	return (DMAPtr != NULL) ? DMAPtr->remaining : 0;
+}
+
+void DMA_interrupt_ctr(DMA_Handle_t *DMAxHandlePtr, uint32_t interrupts, uint8_t enOrDis)
+{
+	Headless_I2C_DMA_t *DMAPtr = headless_i2c_get_DMA(DMAxHandlePtr);
+
+	if(DMAPtr == NULL){
+		return;
+	}
+
+	if(enOrDis == ENABLE){
+		DMAPtr->interrupts |= interrupts;
+	}else{
+		DMAPtr->interrupts &= ~interrupts;
+	}
+}
+
+uint8_t DMA_intrpt_handler(DMA_Handle_t *DMAxHandlePtr)
+{
+	Headless_I2C_DMA_t *DMAPtr = headless_i2c_get_DMA(DMAxHandlePtr);
+	uint8_t event;
+
+	if(DMAPtr == NULL){
+		return 0;
+	}
+
+	event = DMAPtr->pendingEvents;
+	DMAPtr->pendingEvents = 0;
+
+	/*stream is disabled by hardware at the end of transfer*/
+	if(event & DMA_EV_TRANSFER_CMPLT){
+		DMAxHandlePtr->state = DMA_STATE_READY;
+	}
+
+	return event;
+}
+
+void DMA_intrpt_vector_ctr(uint8_t IRQnumber, uint8_t enOrDis)
+{
+}
+
+/***********************************************************************
+Stub: RCC driver
+***********************************************************************/
+int32_t RCC_get_PCLK_value(uint8_t APBx)
+{
+	return HEADLESS_I2C_PCLK1;
+}
@@ -0,0 +1,131 @@
+/**
+*@file headless_i2c.h
+*@brief Emulate I2C bus with its DMA streams and slave devices on PC, so that real I2C driver (Peripheral_drivers/src/stm32f407xx_i2c.c)
+*can run transaction queue without hardware.
+*
+*This header file provide functions for attaching simulated slaves (memory with address pointer, like an EEPROM or a sensor register
+*file) to emulated bus, injecting arbitration loss and running bus. I2C handle is connected to emulated I2C registers, stub
+*implementations of DMA driver functions used by I2C driver emulate transmission and reception streams.
+*Time is counted in byte times (9 SCL clocks, 22.5us at 400KHz): on each byte time master send address or one data byte (taken from DMA)
+*and get its acknowledge, or receive one data byte (given to DMA or to I2C event handler on RXNE) and acknowledge it according to ACK and
+*LAST bits. Start and stop conditions take no time, stop requested while receiving is generated after byte being received. Event and
+*error interrupt handlers of I2C driver are called at once when their interrupt is enabled, flags cleared by reading registers (ADDR, RXNE)
+*are cleared after handler return. Only master mode with DMA (and RXNE interrupt for single byte read) is emulated.
+*A slave with a write cycle time behave like an EEPROM: written bytes are latched and only programmed after stop condition, slave does not
+*acknowledge its address while programming. headless_i2c_power_loss cut power of slaves, a page being programmed is left half written.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef HEADLESS_I2C_H
+#define HEADLESS_I2C_H
+
+#include "../Peripheral_drivers/inc/stm32f407xx_i2c.h"
+
+#define HEADLESS_I2C_MAX_SLAVES			4
+#define HEADLESS_I2C_OTHER_MASTER_TIME	4	/*byte times bus is used by master winning arbitration*/
+#define HEADLESS_I2C_MAX_LATCH			64	/*bytes latched by slave with write cycle (page buffer)*/
+
+typedef struct{
+	/*set by application*/
+	uint8_t address;	/*7-bit address*/
+	uint8_t *memoryPtr;
+	uint32_t memorySize;
+	uint8_t addressSize;	/*bytes of memory address (high byte first) at start of write, 0 when transfers always start at 0*/
+	uint16_t pageSize;	/*written bytes wrap around at end of page (power of 2), 0 when memory is not paged*/
+	uint16_t nackAfterBytes;	/*bytes of a write acknowledged before data is refused, 0 when every byte is acknowledged*/
+	uint8_t nackAddress;	/*address is not acknowledged (device absent or busy)*/
+	uint32_t writeCycleTime;	/*byte times taken to program written bytes after stop condition, 0 when bytes are written at once*/
+
+	/*counters updated by emulator*/
+	uint32_t numOfWrites;	/*address acknowledged for write*/
+	uint32_t numOfReads;	/*address acknowledged for read*/
+	uint32_t numOfBytesWritten;	/*data bytes acknowledged, memory address included*/
+	uint32_t numOfBytesRead;
+	uint32_t numOfStops;	/*stop conditions ending transfer with slave*/
+	uint32_t numOfRepeatedStarts;	/*repeated start conditions ending transfer with slave*/
+	uint32_t numOfReadsNACKed;	/*reads ended by master NACK on last byte*/
+	uint32_t numOfReadsNotNACKed;	/*reads ended with last byte acknowledged (slave may hold SDA low)*/
+	uint32_t numOfWriteCycles;	/*write cycles started by stop condition*/
+
+	/*state of emulator*/
+	uint32_t pointer;	/*memory address of next byte*/
+	uint8_t addressBytesLeft;	/*memory address bytes still expected in current write*/
+	uint16_t bytesInWrite;
+	uint8_t lastReadAcked;
+	uint32_t latchPointer[HEADLESS_I2C_MAX_LATCH];	/*memory address of latched bytes, in order written*/
+	uint8_t latchData[HEADLESS_I2C_MAX_LATCH];
+	uint8_t numOfLatched;
+	uint32_t writeCycleLeft;	/*byte times until latched bytes are programmed, 0 when slave is not programming*/
+}Headless_I2C_Slave_t;
+
+typedef struct{
+	uint32_t numOfByteTimes;	/*byte times emulated*/
+	uint32_t busBusyTime;	/*byte times bus was used by I2C driver (address and data bytes)*/
+	uint32_t numOfEventIRQs;	/*calls to I2C_event_intrpt_handler*/
+	uint32_t numOfErrorIRQs;	/*calls to I2C_err_intrpt_handler*/
+	uint32_t numOfTxDMAIRQs;	/*calls to I2C_DMA_TX_intrpt_handler*/
+	uint32_t numOfRxDMAIRQs;	/*calls to I2C_DMA_RX_intrpt_handler*/
+	uint32_t numOfArbitrationLosses;
+	uint32_t numOfStarts;	/*start and repeated start conditions*/
+	uint32_t numOfStops;
+}Headless_I2C_Stats_t;
+
+/**
+*@brief		Connect I2C handle to emulated I2C registers, bus is reset and slaves are removed
+*
+*Call before I2C_init and I2C_DMA_init.
+*
+*@param		I2CxHandlePtr Pointer to I2C handle struct
+*@return	None
+*/
+void headless_i2c_init(I2C_Handle_t *I2CxHandlePtr);
+
+/**
+*@brief		Attach simulated slave to bus, its counters and state are reset
+*@param		SlavePtr Pointer to slave (must stay valid while bus is run)
+*@return	TRUE if slave is attached, FALSE when HEADLESS_I2C_MAX_SLAVES slaves are attached
+*/
+uint8_t headless_i2c_add_slave(Headless_I2C_Slave_t *SlavePtr);
+
+/**
+*@brief		Make next address phases of I2C driver lose arbitration, other master then use bus for HEADLESS_I2C_OTHER_MASTER_TIME
+*@param		count Number of address phases
+*@return	None
+*/
+void headless_i2c_lose_arbitration(uint8_t count);
+
+/**
+*@brief		Cut power of attached slaves
+*
+*Bytes latched but not yet stopped are lost. Of bytes being programmed, those programmed before power loss (in order written, in proportion
+*to write cycle time elapsed) hold new value, the others are left erased (0xFF). Call headless_i2c_init and attach slaves again to boot.
+*
+*@param		None
+*@return	None
+*/
+void headless_i2c_power_loss(void);
+
+/**
+*@brief		Run emulated bus
+*@param		numOfByteTimes Number of byte times
+*@return	None
+*/
+void headless_i2c_run(uint32_t numOfByteTimes);
+
+/**
+*@brief		Get counters of emulated bus since last call to headless_i2c_reset_stats
+*@param		StatsPtr Pointer to struct receiving counters
+*@return	None
+*/
+void headless_i2c_get_stats(Headless_I2C_Stats_t *StatsPtr);
+
+/**
+*@brief		Reset counters of emulated bus
+*@param		None
+*@return	None
+*/
+void headless_i2c_reset_stats(void);
+
+#endif
@@ -0,0 +1,411 @@
+/**
+*@file headless_lcd.c
+*@brief Emulate ILI9341 LCD panel on PC, so that real ILI9341 driver (Device_drivers/src/ili9341.c) can run without hardware.
+*
+*This implementation file provide stub implementations of SPI, DMA and GPIO driver functions feeding emulated panel.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "headless_lcd.h"
+#include "../Device_drivers/inc/ili9341.h"
+#include <stdio.h>
+
+/***********************************************************************
+External function prototype
+***********************************************************************/
+extern void ILI9341_SPI_DMA_IRQ_HANDLER (void);
+
+/***********************************************************************
+Private structure definition
+***********************************************************************/
+typedef struct{
+	uint8_t command;	/*last command byte*/
+	uint8_t parameter[4];	/*parameter bytes of address commands*/
+	uint8_t numOfParameters;
+	uint8_t dataCommandPin;	/*DCX: CLEAR for command, SET for data*/
+	uint8_t pixelHighByte;
+	uint8_t pixelByteReady;	/*high byte of pixel received, waiting for low byte*/
+	uint16_t startColumn;
+	uint16_t endColumn;
+	uint16_t startPage;
+	uint16_t endPage;
+	uint16_t column;	/*memory write cursor*/
+	uint16_t page;
+	uint32_t pixelsWritten;
+	uint16_t *outputPtr;	/*recorded bytes*/
+	uint32_t outputSize;
+	uint32_t numOfOutputs;
+}Headless_LCD_t;
+
+typedef struct{
+	const void *bufferPtr;
+	uint16_t count;
+	uint8_t dataFrame;
+	uint8_t memInc;
+	uint8_t inInterrupt;	/*TRUE while completion interrupt handler run*/
+	uint8_t mode;	/*Refer to @HEADLESS_LCD_DMA for possible value*/
+	Headless_LCD_DMA_Transfer_t *logPtr;
+	uint32_t logSize;
+	uint32_t numOfTransfers;
+}Headless_DMA_t;
+
+/***********************************************************************
+Private function prototype
+***********************************************************************/
+void headless_lcd_receive_byte (uint8_t byte);
+void headless_lcd_write_pixel (uint16_t color);
+void headless_lcd_to_rgb (uint16_t color, uint8_t *rgbPtr);
+void headless_lcd_send_DMA_data (void);
+
+/***********************************************************************
+Global variable
+***********************************************************************/
+uint16_t headlessGRAM[HEADLESS_LCD_SIZE][HEADLESS_LCD_SIZE];
+Headless_LCD_t headlessLCD;
+
+SPI_Handle_t headlessSPIHandle;
+Headless_DMA_t headlessDMA;
+
+/***********************************************************************
+Public function: Fill whole graphic RAM with color
+***********************************************************************/
+void headless_lcd_clear(uint16_t color)
+{
+	for(uint16_t page = 0; page < HEADLESS_LCD_SIZE; page++){
+		for(uint16_t column = 0; column < HEADLESS_LCD_SIZE; column++){
+			headlessGRAM[page][column] = color;
+		}
+	}
+
+	headlessLCD.pixelsWritten = 0;
+}
+
+/***********************************************************************
+Public function: Get pixel of graphic RAM
+***********************************************************************/
+uint16_t headless_lcd_get_pixel(uint16_t x, uint16_t y)
+{
+	return headlessGRAM[y][x];
+}
+
+/***********************************************************************
+Public function: Get number of pixels written since last clear
+***********************************************************************/
+uint32_t headless_lcd_get_pixels_written(void)
+{
+	return headlessLCD.pixelsWritten;
+}
+
+/***********************************************************************
+Public function: Save part of graphic RAM as binary PPM image
+***********************************************************************/
+uint8_t headless_lcd_save_ppm(const char *fileNamePtr, uint16_t width, uint16_t height)
+{
+	FILE *filePtr = fopen(fileNamePtr,"wb");
+	uint8_t rgb[3];
+
+	if(filePtr == NULL){
+		return 0;
+	}
+
+	fprintf(filePtr,"P6\n%u %u\n255\n",width,height);
+
+	for(uint16_t y = 0; y < height; y++){
+		for(uint16_t x = 0; x < width; x++){
+			headless_lcd_to_rgb(headlessGRAM[y][x],rgb);
+			fwrite(rgb,1,sizeof(rgb),filePtr);
+		}
+	}
+
+	fclose(filePtr);
+
+	return 1;
+}
+
+/***********************************************************************
+Public function: Compare part of graphic RAM with binary PPM image
+***********************************************************************/
+uint32_t headless_lcd_compare_ppm(const char *fileNamePtr, uint16_t width, uint16_t height)
+{
+	FILE *filePtr = fopen(fileNamePtr,"rb");
+	unsigned int fileWidth, fileHeight, maxValue;
+	uint32_t numOfDifferences = 0;
+	uint8_t rgb[3], fileRgb[3];
+
+	if(filePtr == NULL){
+		return UINT32_MAX;
+	}
+
+	if(fscanf(filePtr,"P6 %u %u %u",&fileWidth,&fileHeight,&maxValue) != 3 || fileWidth != width || fileHeight != height || fgetc(filePtr) == EOF){
+		fclose(filePtr);
+		return UINT32_MAX;
+	}
+
+	for(uint16_t y = 0; y < height; y++){
+		for(uint16_t x = 0; x < width; x++){
+			if(fread(fileRgb,1,sizeof(fileRgb),filePtr) != sizeof(fileRgb)){
+				fclose(filePtr);
+				return UINT32_MAX;
+			}
+
+			headless_lcd_to_rgb(headlessGRAM[y][x],rgb);
+
+			if(rgb[0] != fileRgb[0] || rgb[1] != fileRgb[1] || rgb[2] != fileRgb[2]){
+				numOfDifferences++;
+			}
+		}
+	}
+
+	fclose(filePtr);
+
+	return numOfDifferences;
+}
+
+/***********************************************************************
+Public function: Record bytes sent to panel
+***********************************************************************/
+void headless_lcd_set_output(uint16_t *bufferPtr, uint32_t size)
+{
+	headlessLCD.outputPtr = bufferPtr;
+	headlessLCD.outputSize = size;
+	headlessLCD.numOfOutputs = 0;
+}
+
+/***********************************************************************
+Public function: Get number of bytes sent to panel
+***********************************************************************/
+uint32_t headless_lcd_get_num_of_outputs(void)
+{
+	return headlessLCD.numOfOutputs;
+}
+
+/***********************************************************************
+Public function: Record DMA transfers started by driver
+***********************************************************************/
+void headless_lcd_set_DMA_log(Headless_LCD_DMA_Transfer_t *bufferPtr, uint32_t size)
+{
+	headlessDMA.logPtr = bufferPtr;
+	headlessDMA.logSize = size;
+	headlessDMA.numOfTransfers = 0;
+}
+
+/***********************************************************************
+Public function: Get number of DMA transfers started
+***********************************************************************/
+uint32_t headless_lcd_get_num_of_DMA_transfers(void)
+{
+	return headlessDMA.numOfTransfers;
+}
+
+/***********************************************************************
+Public function: Select when DMA transfers are completed
+***********************************************************************/
+void headless_lcd_DMA_mode(uint8_t mode)
+{
+	headlessDMA.mode = mode;
+}
+
+/***********************************************************************
+Public function: Complete waiting DMA transfer and raise transfer complete interrupt
+***********************************************************************/
+uint8_t headless_lcd_complete_DMA(void)
+{
+	if(headlessSPIHandle.txState != SPI_STATE_TX_BUSY){
+		return 0;
+	}
+
+	headless_lcd_send_DMA_data();
+
+	/*transfer started by interrupt handler wait for next call, it is not sent by nested call*/
+	headlessDMA.inInterrupt = TRUE;
+	ILI9341_SPI_DMA_IRQ_HANDLER();
+	headlessDMA.inInterrupt = FALSE;
+
+	return 1;
+}
+
+/***********************************************************************
+Private function: Decode one byte sent to panel
+***********************************************************************/
+void headless_lcd_receive_byte (uint8_t byte)
+{
+	if(headlessLCD.numOfOutputs < headlessLCD.outputSize){
+		headlessLCD.outputPtr[headlessLCD.numOfOutputs] = (headlessLCD.dataCommandPin == CLEAR) ? byte : (byte | HEADLESS_LCD_DATA_BYTE);
+	}
+	headlessLCD.numOfOutputs++;
+
+	if(headlessLCD.dataCommandPin == CLEAR){
+		headlessLCD.command = byte;
+		headlessLCD.numOfParameters = 0;
+		headlessLCD.pixelByteReady = FALSE;
+
+		if(byte == ILI9341_MEM_WRITE){
+			headlessLCD.column = headlessLCD.startColumn;
+			headlessLCD.page = headlessLCD.startPage;
+		}
+		return;
+	}
+
+	if(headlessLCD.command == ILI9341_COLUMN_ADDR || headlessLCD.command == ILI9341_PAGE_ADDR){
+		if(headlessLCD.numOfParameters < sizeof(headlessLCD.parameter)){
+			headlessLCD.parameter[headlessLCD.numOfParameters++] = byte;
+		}
+
+		if(headlessLCD.numOfParameters == sizeof(headlessLCD.parameter)){
+			uint16_t start = (headlessLCD.parameter[0] << 8) | headlessLCD.parameter[1];
+			uint16_t end = (headlessLCD.parameter[2] << 8) | headlessLCD.parameter[3];
+
+			if(headlessLCD.command == ILI9341_COLUMN_ADDR){
+				headlessLCD.startColumn = start;
+				headlessLCD.endColumn = end;
+			}else{
+				headlessLCD.startPage = start;
+				headlessLCD.endPage = end;
+			}
+		}
+	}else if(headlessLCD.command == ILI9341_MEM_WRITE){
+		/*pixel is sent high byte first*/
+		if(headlessLCD.pixelByteReady){
+			headless_lcd_write_pixel((headlessLCD.pixelHighByte << 8) | byte);
+			headlessLCD.pixelByteReady = FALSE;
+		}else{
+			headlessLCD.pixelHighByte = byte;
+			headlessLCD.pixelByteReady = TRUE;
+		}
+	}
+}
+
+/***********************************************************************
+Private function: Write pixel at memory write cursor and move cursor (left to right, top to bottom inside active area)
+***********************************************************************/
+void headless_lcd_write_pixel (uint16_t color)
+{
+	if(headlessLCD.column < HEADLESS_LCD_SIZE && headlessLCD.page < HEADLESS_LCD_SIZE){
+		headlessGRAM[headlessLCD.page][headlessLCD.column] = color;
+	}
+
+	headlessLCD.pixelsWritten++;
+
+	if(headlessLCD.column < headlessLCD.endColumn){
+		headlessLCD.column++;
+	}else{
+		headlessLCD.column = headlessLCD.startColumn;
+		headlessLCD.page = (headlessLCD.page < headlessLCD.endPage) ? headlessLCD.page + 1 : headlessLCD.startPage;
+	}
+}
+
+/***********************************************************************
+Private function: Convert RGB565 color to 8 bits red, green and blue
+***********************************************************************/
+void headless_lcd_to_rgb (uint16_t color, uint8_t *rgbPtr)
+{
+	rgbPtr[0] = ((color >> 11) & 0x1F) << 3;
+	rgbPtr[1] = ((color >> 5) & 0x3F) << 2;
+	rgbPtr[2] = (color & 0x1F) << 3;
+}
+
+/***********************************************************************
+Private function: Send data frames of current DMA transfer to panel
+***********************************************************************/
+void headless_lcd_send_DMA_data (void)
+{
+	for(uint16_t i = 0; i < headlessDMA.count; i++){
+		uint16_t index = (headlessDMA.memInc == ENABLE) ? i : 0;
+
+		if(headlessDMA.dataFrame == SPI_DATA_16BITS){
+			SPI_send_16_bits(headlessSPIHandle.SPIxPtr,((const uint16_t*)headlessDMA.bufferPtr)[index]);
+		}else{
+			SPI_send_8_bits(headlessSPIHandle.SPIxPtr,((const uint8_t*)headlessDMA.bufferPtr)[index]);
+		}
+	}
+}
+
+/***********************************************************************
+Stub: GPIO driver (only DCX pin of ILI9341 is followed)
+***********************************************************************/
+void GPIO_init_direct (GPIO_TypeDef *GPIOxPtr,uint8_t pinNumber,uint8_t mode,uint8_t speed, uint8_t outType, uint8_t puPdr, uint8_t altFunc)
+{
+}
+
+void GPIO_write_pin (GPIO_TypeDef *GPIOxPtr, uint8_t pinNumber, uint8_t setOrClear)
+{
+	if(GPIOxPtr == ILI9341_DCX_PORT && pinNumber == ILI9341_DCX_PIN){
+		headlessLCD.dataCommandPin = setOrClear;
+	}
+}
+
+/***********************************************************************
+Stub: SPI and DMA drivers (DMA transfer is completed before SPI_send_data_DMA return or by headless_lcd_complete_DMA)
+***********************************************************************/
+SPI_Handle_t* SPI_general_init(SPI_TypeDef *SPIxPtr, SPI_pins_pack_t pinsPack, uint32_t deviceMode, uint8_t busConfig, uint8_t dataFrame, uint8_t clkPhase, uint8_t clkPol, uint8_t swSlaveManage, uint8_t clkSpeed)
+{
+	headlessSPIHandle.SPIxPtr = SPIxPtr;
+	headlessSPIHandle.txState = SPI_STATE_READY;
+
+	return &headlessSPIHandle;
+}
+
+void SPI_SSI_ctr(SPI_TypeDef *SPIxPtr, uint8_t enOrDis)
+{
+}
+
+void SPI_DMA_TX_init(SPI_Handle_t *SPIxHandlePtr)
+{
+}
+
+void DMA_intrpt_vector_ctr(uint8_t IRQnumber, uint8_t enOrDis)
+{
+}
+
+void SPI_send_8_bits(SPI_TypeDef *SPIxPtr, uint8_t data)
+{
+	headless_lcd_receive_byte(data);
+}
+
+void SPI_send_16_bits(SPI_TypeDef *SPIxPtr, uint16_t data)
+{
+	headless_lcd_receive_byte(data >> 8);
+	headless_lcd_receive_byte(data & 0xFF);
+}
+
+uint8_t SPI_send_data_DMA(SPI_Handle_t *SPIxHandlePtr, const void *txBufferPtr, uint16_t count, uint8_t dataFrame, uint8_t memInc)
+{
+	uint8_t state = SPIxHandlePtr->txState;
+
+	if(state == SPI_STATE_TX_BUSY){
+		return state;
+	}
+
+	SPIxHandlePtr->txState = SPI_STATE_TX_BUSY;
+	headlessDMA.bufferPtr = txBufferPtr;
+	headlessDMA.count = count;
+	headlessDMA.dataFrame = dataFrame;
+	headlessDMA.memInc = memInc;
+
+	if(headlessDMA.numOfTransfers < headlessDMA.logSize){
+		headlessDMA.logPtr[headlessDMA.numOfTransfers] = (Headless_LCD_DMA_Transfer_t){count,dataFrame,memInc};
+	}
+	headlessDMA.numOfTransfers++;
+
+	/*transfer started by completion interrupt is sent by loop below, not by nested call*/
+	if(headlessDMA.inInterrupt || headlessDMA.mode == HEADLESS_LCD_DMA_ON_REQUEST){
+		return state;
+	}
+
+	/*DMA is infinitely fast: whole transfer is sent at once, then completion interrupt let driver start next part*/
+	while(headless_lcd_complete_DMA());
+
+	return state;
+}
+
+uint8_t SPI_DMA_TX_busy_check(SPI_Handle_t *SPIxHandlePtr)
+{
+	return (SPIxHandlePtr->txState == SPI_STATE_TX_BUSY) ? TRUE : FALSE;
+}
+
+void SPI_DMA_TX_intrpt_handler(SPI_Handle_t *SPIxHandlePtr)
+{
+	SPIxHandlePtr->txState = SPI_STATE_READY;
+}
@@ -0,0 +1,132 @@
+/**
+*@file headless_lcd.h
+*@brief Emulate ILI9341 LCD panel on PC, so that real ILI9341 driver (Device_drivers/src/ili9341.c) can run without hardware.
+*
+*This header file provide functions for reading pixels written into emulated graphic RAM.
+*Stub implementations of SPI, DMA and GPIO driver functions used by ILI9341 driver decode byte stream sent to panel
+*(column address, page address and memory write commands). By default DMA transfers are completed before SPI_send_data_DMA return,
+*they can instead wait until transfer complete interrupt is raised by headless_lcd_complete_DMA, one transfer at a time.
+*Bytes sent to panel and DMA transfers started by driver can be recorded.
+*Build with HEADLESS_USE_ILI9341_DRIVER defined so that ILI9341 stubs in headless_stubs.c are left out.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef HEADLESS_LCD_H
+#define HEADLESS_LCD_H
+
+#include <stdint.h>
+
+/*graphic RAM is indexed by page and column, large enough for both orientations*/
+#define HEADLESS_LCD_SIZE	320
+
+/*
+*@HEADLESS_LCD_DMA
+*DMA transfer modes
+*/
+#define HEADLESS_LCD_DMA_AT_ONCE		0	/*transfer is completed before SPI_send_data_DMA return*/
+#define HEADLESS_LCD_DMA_ON_REQUEST		1	/*transfer is completed by headless_lcd_complete_DMA*/
+
+/*recorded byte is data (DCX set) when this bit is set, command otherwise*/
+#define HEADLESS_LCD_DATA_BYTE	0x100
+
+typedef struct{
+	uint16_t count;	/*number of data frames*/
+	uint8_t dataFrame;	/*SPI_DATA_8BITS or SPI_DATA_16BITS*/
+	uint8_t memInc;	/*ENABLE or DISABLE*/
+}Headless_LCD_DMA_Transfer_t;
+
+/**
+*@brief		Fill whole graphic RAM with color (pixels never written by driver keep this color)
+*@param		color RGB565 color
+*@return	None
+*/
+void headless_lcd_clear(uint16_t color);
+
+/**
+*@brief		Get pixel of graphic RAM
+*@param		x Column
+*@param		y Page
+*@return	RGB565 color
+*/
+uint16_t headless_lcd_get_pixel(uint16_t x, uint16_t y);
+
+/**
+*@brief		Get number of pixels written by memory write commands since last call to headless_lcd_clear
+*@param		None
+*@return	Number of pixels
+*/
+uint32_t headless_lcd_get_pixels_written(void);
+
+/**
+*@brief		Save top left part of graphic RAM as binary PPM image
+*@param		fileNamePtr Name of image file
+*@param		width Number of columns
+*@param		height Number of pages
+*@return	1 if image is saved, 0 otherwise
+*/
+uint8_t headless_lcd_save_ppm(const char *fileNamePtr, uint16_t width, uint16_t height);
+
+/**
+*@brief		Compare top left part of graphic RAM with binary PPM image saved by headless_lcd_save_ppm
+*@param		fileNamePtr Name of image file
+*@param		width Number of columns
+*@param		height Number of pages
+*@return	Number of different pixels, UINT32_MAX if image can not be read or has different size
+*/
+uint32_t headless_lcd_compare_ppm(const char *fileNamePtr, uint16_t width, uint16_t height);
+
+/**
+*@brief		Record bytes sent to panel, number of outputs is reset
+*@param		bufferPtr Buffer of bytes, HEADLESS_LCD_DATA_BYTE is added to data bytes
+*@param		size Number of bytes in buffer (following bytes are counted, not stored)
+*@return	None
+*/
+void headless_lcd_set_output(uint16_t *bufferPtr, uint32_t size);
+
+/**
+*@brief		Get number of bytes sent to panel since last call to headless_lcd_set_output
+*@param		None
+*@return	Number of bytes
+*/
+uint32_t headless_lcd_get_num_of_outputs(void);
+
+/**
+*@brief		Record DMA transfers started by driver, number of transfers is reset
+*@param		bufferPtr Buffer of transfers
+*@param		size Number of transfers in buffer (following transfers are counted, not stored)
+*@return	None
+*/
+void headless_lcd_set_DMA_log(Headless_LCD_DMA_Transfer_t *bufferPtr, uint32_t size);
+
+/**
+*@brief		Get number of DMA transfers started since last call to headless_lcd_set_DMA_log
+*@param		None
+*@return	Number of transfers
+*/
+uint32_t headless_lcd_get_num_of_DMA_transfers(void);
+
+/**
+*@brief		Select when DMA transfers are completed
+*
+*With HEADLESS_LCD_DMA_ON_REQUEST driver must not send a command while a transfer is waiting (it would wait for it forever),
+*call headless_lcd_complete_DMA until it return 0 before next drawing.
+*
+*@param		mode Refer to @HEADLESS_LCD_DMA for possible value
+*@return	None
+*/
+void headless_lcd_DMA_mode(uint8_t mode);
+
+/**
+*@brief		Complete waiting DMA transfer: send its data frames to panel, then raise transfer complete interrupt of driver
+*
+*Data frames are read from memory at this time, so a buffer changed by driver before transfer complete is seen on panel.
+*Interrupt handler of driver may start next transfer, which wait for next call.
+*
+*@param		None
+*@return	1 if a transfer was completed, 0 if no transfer was waiting
+*/
+uint8_t headless_lcd_complete_DMA(void);
+
+#endif
@@ -0,0 +1,516 @@
+/**
+*@brief Run "Return To Earth" game engine on PC without display, joystick, buttons and speaker
+*
+*This program link game engine with stub drivers (headless_stubs.c) and run a number of frames as fast as possible.
+*Random numbers come from a seeded generator and input comes from a script, so same seed and script always give same game.
+*Frames per second, time spent in each game engine function and hash of final game state are printed,
+*a change of hash mean game behavior changed, a drop of frames per second mean game engine got slower.
+*Input log (see input_log.h) of the run can be written into a file, and a log written by headless simulation or captured from game console
+*UART (RTE_RECORD_INPUT in return_to_earth.c) can be played back: logged state hashes are checked and final state hash is printed.
+*Time spent sending bytes to ILI9341 is emulated with SPI cost model (SPI clock and CPU cycles per memory write area, option -l),
+*built with -DRTE_MEASURE_LATENCY latency from button edge to last byte of frame showing it is predicted with this model
+*(minimum, average, 99th percentile, maximum), so that latency impact of a rendering change is known before running it on target.
+*Telemetry stream (see telemetry.h) of the run can be written into a file (option -t) and decoded with Tools/telemetry_decoder.c like
+*a stream captured from game console (RTE_SEND_TELEMETRY in return_to_earth.c), cycles are emulated DWT cycles (SPI cost model only).
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 -DSTM32F407xx -ICMSIS/Include -ICMSIS/Device/ST/STM32F4xx/Include Headless_simulation/headless_main.c Headless_simulation/headless_stubs.c
+*Game_engine_return_to_earth/game_engine.c Game_engine_return_to_earth/dirty_rect.c Game_engine_return_to_earth/spatial_grid.c
+*Game_engine_return_to_earth/entity_store.c Game_engine_return_to_earth/input_log.c Game_engine_return_to_earth/latency_probe.c
+*Game_engine_return_to_earth/telemetry.c Miscellaneous/src/byte_pack.c Miscellaneous/src/tm_stm32f4_fonts.c -lm -o rte_headless
+*
+*Run:
+*rte_headless [-l <SPI clock in MHz> <CPU cycles per area>] [-t <telemetry file>] [-w <input log file>] <number of frames> <seed> [input script]
+*rte_headless [-l <SPI clock in MHz> <CPU cycles per area>] [-t <telemetry file>] -p <input log file>
+*
+*Input script hold one input per line for a number of frames: <frames> <joystick direction> <shoot> <thrust>
+*Joystick direction is C, U, D, L, R, LU, LD, RU or RD, shoot and thrust are 1 (pressed) or 0, line starting with # is ignored.
+*Joystick stay centered and buttons released after last line (or without script).
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "headless_stubs.h"
+#include "../Game_engine_return_to_earth/game_engine.h"
+#include "../Game_engine_return_to_earth/telemetry.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+*@HEADLESS_PROFILE
+*Game engine functions timed every frame
+*/
+#define HEADLESS_PROFILE_DISPLAY_SCORE		0
+#define HEADLESS_PROFILE_UPDATE_PLAYER		1
+#define HEADLESS_PROFILE_CREATE_ROCKET		2
+#define HEADLESS_PROFILE_UPDATE_ROCKET		3
+#define HEADLESS_PROFILE_UPDATE_ASTEROID	4
+#define HEADLESS_PROFILE_DRAW_FRAME			5
+#define HEADLESS_NUM_OF_PROFILE				6
+
+#define HEADLESS_TELEMETRY_PERIOD	4	/*same as RTE_TELEMETRY_PERIOD in return_to_earth.c*/
+
+extern uint8_t frameUpdate;
+extern int16_t score;
+extern uint8_t currentWave;
+extern uint8_t numOfAsteroidInWave[RTE_NUM_OF_WAVE];
+
+extern Space_Object_t PlayerSpaceship;
+extern entity_store AsteroidStore;
+extern entity_store RocketStore;
+
+#ifdef RTE_MEASURE_LATENCY
+extern latency_probe InputLatency;
+#endif
+
+/*
+*@HEADLESS_REPLAY
+*Result of playing back input log
+*/
+#define HEADLESS_REPLAY_RUNNING		0
+#define HEADLESS_REPLAY_FINISHED	1
+#define HEADLESS_REPLAY_DIFFERENT	2
+
+typedef struct{
+	FILE *scriptPtr;
+	uint32_t framesLeft;	/*frames current input is still held*/
+	Headless_Input_t Input;
+}Headless_Script_t;
+
+const char *profileName[HEADLESS_NUM_OF_PROFILE] = {
+	"RTE_display_score",
+	"RTE_update_player_spaceship",
+	"RTE_create_rocket",
+	"RTE_update_rocket",
+	"RTE_update_asteroid",
+	"RTE_draw_frame",
+};
+
+uint64_t profileTime[HEADLESS_NUM_OF_PROFILE];
+
+FILE *logFilePtr = NULL;
+input_log_writer InputLogWriter;
+
+FILE *telemetryFilePtr = NULL;
+telemetry_writer TelemetryWriter;
+uint32_t telemetryFrameNumber = 0;
+uint64_t telemetrySPIbytes = 0;	/*SPI bytes counted when last frame was added*/
+
+uint8_t replayFlag = FALSE;
+uint8_t replayResult = HEADLESS_REPLAY_RUNNING;
+input_log_reader InputLogReader;
+
+Headless_SPI_Model_t SPIModel = {21000000,200};
+
+const char *directionName[] = {"C","LU","LD","L","RU","RD","R","U","D"};	/*indexed by @JS_DIR*/
+
+/*time in nanoseconds*/
+uint64_t get_time (void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC,&now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+/*read next input line of script, return 0 when script ended*/
+uint8_t read_script_line (Headless_Script_t *ScriptPtr)
+{
+	char line[100];
+	char direction[8];
+	unsigned long frames;
+	unsigned int shoot, thrust;
+
+	while(ScriptPtr->scriptPtr && fgets(line,sizeof(line),ScriptPtr->scriptPtr)){
+		if(line[0] == '#' || sscanf(line,"%lu %7s %u %u",&frames,direction,&shoot,&thrust) != 4){
+			continue;
+		}
+
+		for(uint8_t i = 0; i < sizeof(directionName)/sizeof(directionName[0]); i++){
+			if(!strcmp(direction,directionName[i])){
+				ScriptPtr->framesLeft = frames;
+				ScriptPtr->Input.joystickDirection = i;
+				ScriptPtr->Input.buttons = (shoot ? HEADLESS_BUTTON_SHOOT : 0) | (thrust ? HEADLESS_BUTTON_THRUST : 0);
+				return 1;
+			}
+		}
+
+		fprintf(stderr,"Unknown joystick direction: %s\n",direction);
+	}
+
+	return 0;
+}
+
+/*get input of next frame*/
+void next_input (Headless_Script_t *ScriptPtr)
+{
+	while(!ScriptPtr->framesLeft){
+		if(!read_script_line(ScriptPtr)){
+			ScriptPtr->Input.joystickDirection = JS_DIR_CENTERED;
+			ScriptPtr->Input.buttons = 0;
+			ScriptPtr->framesLeft = 1;
+		}
+	}
+
+	ScriptPtr->framesLeft--;
+	headless_set_input(&ScriptPtr->Input);
+}
+
+void check_state (void);
+
+void write_input_log (const uint8_t *dataPtr, uint16_t length)
+{
+	fwrite(dataPtr,1,length,logFilePtr);
+}
+
+uint8_t write_telemetry (const uint8_t *dataPtr, uint16_t length)
+{
+	fwrite(dataPtr,1,length,telemetryFilePtr);
+	return 1;
+}
+
+/*same as send_telemetry in return_to_earth.c*/
+void send_telemetry (uint32_t updateStart, uint32_t drawStart)
+{
+	telemetry_frame Frame;
+
+	if(telemetryFilePtr == NULL){
+		return;
+	}
+
+	Frame.frameNumber = telemetryFrameNumber++;
+	Frame.updateCycles = drawStart - updateStart;
+	Frame.drawCycles = DWT_get_elapsed_cycles(drawStart);
+	Frame.collisionCycles = RTE_get_collision_cycles();
+	Frame.SPIbytes = (uint32_t)(headless_get_stats()->SPIbytes - telemetrySPIbytes);
+	Frame.numOfAsteroids = AsteroidStore.total;
+	Frame.numOfRockets = RocketStore.total;
+	Frame.audioUnderruns = (uint16_t)speaker_get_num_of_underruns();
+	Frame.numOfFrames = 1;
+
+	telemetrySPIbytes = headless_get_stats()->SPIbytes;
+	telemetry_write_frame(&TelemetryWriter,&Frame);
+}
+
+/*read whole input log file into memory, return 0 when file can not be read*/
+uint8_t load_input_log (const char *fileNamePtr)
+{
+	FILE *filePtr = fopen(fileNamePtr,"rb");
+	uint8_t *dataPtr;
+	long size;
+
+	if(filePtr == NULL){
+		return 0;
+	}
+
+	fseek(filePtr,0,SEEK_END);
+	size = ftell(filePtr);
+	fseek(filePtr,0,SEEK_SET);
+
+	dataPtr = malloc(size ? size : 1);
+	if(dataPtr == NULL || fread(dataPtr,1,size,filePtr) != (size_t)size){
+		fclose(filePtr);
+		return 0;
+	}
+
+	fclose(filePtr);
+	input_log_reader_init(&InputLogReader,dataPtr,size);
+
+	return 1;
+}
+
+/*stop playing back input log at first problem*/
+void set_replay_result (uint8_t logResult)
+{
+	if(replayResult == HEADLESS_REPLAY_RUNNING && logResult != INPUT_LOG_OK){
+		replayResult = (logResult == INPUT_LOG_END) ? HEADLESS_REPLAY_FINISHED : HEADLESS_REPLAY_DIFFERENT;
+	}
+}
+
+/*same as get_frame_input in return_to_earth.c*/
+void get_frame_input (Headless_Script_t *ScriptPtr, RTE_Input_t *InputPtr)
+{
+	if(replayFlag){
+		uint16_t value = 0;
+		uint8_t logResult = input_log_read_frame(&InputLogReader,&value);
+
+		/*log written between 2 frames end with state hash*/
+		if(logResult == INPUT_LOG_MISMATCH){
+			check_state();
+			logResult = input_log_read_frame(&InputLogReader,&value);
+		}
+
+		set_replay_result(logResult);
+		RTE_decode_input(value,InputPtr);
+		return;
+	}
+
+	next_input(ScriptPtr);
+	RTE_read_input(InputPtr);
+
+	if(logFilePtr){
+		input_log_write_frame(&InputLogWriter,RTE_encode_input(InputPtr));
+	}
+}
+
+/*same as get_wave_seed in return_to_earth.c*/
+uint32_t get_wave_seed (void)
+{
+	uint32_t seed = 0;
+
+	if(replayFlag){
+		set_replay_result(input_log_read_seed(&InputLogReader,&seed));
+		return seed;
+	}
+
+	seed = RNG_get();
+
+	if(logFilePtr){
+		input_log_write_seed(&InputLogWriter,seed);
+	}
+
+	return seed;
+}
+
+/*same as check_state in return_to_earth.c*/
+void check_state (void)
+{
+	uint32_t hash = 0;
+
+	if(replayFlag){
+		uint8_t logResult = input_log_read_hash(&InputLogReader,&hash);
+
+		if(logResult == INPUT_LOG_OK && hash != RTE_get_state_hash()){
+			logResult = INPUT_LOG_MISMATCH;
+		}
+
+		set_replay_result(logResult);
+		return;
+	}
+
+	if(logFilePtr){
+		input_log_write_hash(&InputLogWriter,RTE_get_state_hash());
+	}
+}
+
+/*predicted latency of button edges, in emulated time*/
+void print_latency (void)
+{
+#ifdef RTE_MEASURE_LATENCY
+	latency_probe_stats Stats;
+	double cyclesPerMillisecond = HEADLESS_CPU_CLOCK/1e3;
+
+	latency_probe_get_stats(&InputLatency,&Stats);
+	printf("Input latency of %lu edges (%lu dropped): min %.2f ms, avg %.2f ms, p%u %.2f ms, max %.2f ms\n",(unsigned long)Stats.numOfSamples,
+	(unsigned long)Stats.numOfDropped,Stats.min/cyclesPerMillisecond,Stats.average/cyclesPerMillisecond,LATENCY_PROBE_PERCENTILE,
+	Stats.percentile/cyclesPerMillisecond,Stats.max/cyclesPerMillisecond);
+#endif
+}
+
+/*same as start of game loop in return_to_earth.c*/
+void start_game (void)
+{
+	RTE_display_black_background();
+	RTE_seed_random(get_wave_seed());
+	RTE_create_player_spaceship(&PlayerSpaceship);
+	RTE_draw_player_spaceship(&PlayerSpaceship);
+
+	RTE_create_asteroid(&AsteroidStore,numOfAsteroidInWave[currentWave],&PlayerSpaceship);
+	RTE_draw_asteroid(&AsteroidStore);
+	RNG_deinit();
+
+	RTE_start_update_frame();
+}
+
+int main (int argc, char *argv[])
+{
+	Headless_Script_t Script = {NULL,0,{JS_DIR_CENTERED,0}};
+	RTE_Input_t Input;
+	uint32_t numOfFrames = UINT32_MAX, frame, numOfGames = 1;
+	uint64_t start, totalTime = 0;
+	uint32_t updateStart, drawStart;
+
+	if(argc > 3 && !strcmp(argv[1],"-l")){
+		SPIModel.SPIclock = (uint32_t)(strtod(argv[2],NULL)*1e6);
+		SPIModel.areaCycles = strtoul(argv[3],NULL,0);
+		if(!SPIModel.SPIclock){
+			fprintf(stderr,"SPI clock must not be 0\n");
+			return 1;
+		}
+		argc -= 3;
+		argv += 3;
+	}
+
+	headless_set_spi_model(&SPIModel);
+
+	if(argc > 2 && !strcmp(argv[1],"-t")){
+		telemetryFilePtr = fopen(argv[2],"wb");
+		if(telemetryFilePtr == NULL){
+			fprintf(stderr,"Can not create telemetry file %s\n",argv[2]);
+			return 1;
+		}
+		telemetry_writer_init(&TelemetryWriter,write_telemetry,HEADLESS_TELEMETRY_PERIOD);
+		argc -= 2;
+		argv += 2;
+	}
+
+	if(argc == 3 && !strcmp(argv[1],"-p")){
+		if(!load_input_log(argv[2])){
+			fprintf(stderr,"Can not read input log %s\n",argv[2]);
+			return 1;
+		}
+		replayFlag = TRUE;
+	}else{
+		if(argc > 2 && !strcmp(argv[1],"-w")){
+			logFilePtr = fopen(argv[2],"wb");
+			if(logFilePtr == NULL){
+				fprintf(stderr,"Can not create input log %s\n",argv[2]);
+				return 1;
+			}
+			input_log_writer_init(&InputLogWriter,write_input_log);
+			argc -= 2;
+			argv += 2;
+		}
+
+		if(argc < 3){
+			fprintf(stderr,"Usage: %s [-l <SPI clock in MHz> <CPU cycles per area>] [-t <telemetry file>] [-w <input log file>] <number of frames> <seed> [input script]\n",argv[0]);
+			fprintf(stderr,"       %s [-l <SPI clock in MHz> <CPU cycles per area>] [-t <telemetry file>] -p <input log file>\n",argv[0]);
+			return 1;
+		}
+
+		numOfFrames = strtoul(argv[1],NULL,0);
+		headless_rng_seed(strtoul(argv[2],NULL,0));
+
+		if(argc > 3){
+			Script.scriptPtr = fopen(argv[3],"r");
+			if(Script.scriptPtr == NULL){
+				fprintf(stderr,"Can not open input script %s\n",argv[3]);
+				return 1;
+			}
+		}
+	}
+
+	RTE_init();
+	RTE_display_start_screen();
+	start_game();
+
+	for(frame = 0; frame < numOfFrames && replayResult == HEADLESS_REPLAY_RUNNING; frame++){
+
+		/*one TIM6 period pass every frame, TIM6 interrupt set frameUpdate*/
+		headless_tick_timers();
+
+		if(frameUpdate != SET){
+			continue;
+		}
+
+		updateStart = DWT_get_cycle_count();
+		get_frame_input(&Script,&Input);
+
+		/*input log ended or went different, state is kept as it was after last logged frame*/
+		if(replayResult != HEADLESS_REPLAY_RUNNING){
+			break;
+		}
+
+		RTE_set_input(&Input);
+
+		start = get_time();
+		RTE_display_score();
+		profileTime[HEADLESS_PROFILE_DISPLAY_SCORE] += get_time() - start;
+
+		start = get_time();
+		RTE_update_player_spaceship(&PlayerSpaceship);
+		profileTime[HEADLESS_PROFILE_UPDATE_PLAYER] += get_time() - start;
+
+		start = get_time();
+		RTE_create_rocket(&RocketStore,&PlayerSpaceship);
+		profileTime[HEADLESS_PROFILE_CREATE_ROCKET] += get_time() - start;
+
+		start = get_time();
+		RTE_update_rocket(&RocketStore,&AsteroidStore);
+		profileTime[HEADLESS_PROFILE_UPDATE_ROCKET] += get_time() - start;
+
+		start = get_time();
+		RTE_update_asteroid(&AsteroidStore,&PlayerSpaceship);
+		profileTime[HEADLESS_PROFILE_UPDATE_ASTEROID] += get_time() - start;
+
+		start = get_time();
+		drawStart = DWT_get_cycle_count();
+		RTE_draw_frame(&PlayerSpaceship,&RocketStore,&AsteroidStore);
+		profileTime[HEADLESS_PROFILE_DRAW_FRAME] += get_time() - start;
+
+		RTE_measure_frame_latency();
+		send_telemetry(updateStart,drawStart);
+
+		/*game over screen is skipped at once, new game start in next frame*/
+		if(PlayerSpaceship.Object_Property.aliveFlag == RTE_ALIVE_FALSE){
+			check_state();
+			RTE_display_game_over_screen();
+			RTE_reset_game();
+			start_game();
+			numOfGames++;
+			continue;
+		}
+
+		if(AsteroidStore.total == 0){
+			TIM_ctr(TIM6,STOP);
+			check_state();
+
+			if(currentWave < RTE_NUM_OF_WAVE - 1){
+				currentWave++;
+			}
+
+			RNG_init();
+			RTE_seed_random(get_wave_seed());
+			RTE_create_asteroid(&AsteroidStore,numOfAsteroidInWave[currentWave],&PlayerSpaceship);
+			TIM_ctr(TIM6,START);
+		}
+
+		frameUpdate = CLEAR;
+	}
+
+	for(uint8_t i = 0; i < HEADLESS_NUM_OF_PROFILE; i++){
+		totalTime += profileTime[i];
+	}
+
+	numOfFrames = frame;
+
+	printf("Frames: %lu, games: %lu, wave: %u, score: %d\n",(unsigned long)numOfFrames,(unsigned long)numOfGames,currentWave + 1,score);
+	printf("Game engine time: %.3f ms, %.0f frames/sec\n",totalTime / 1e6,totalTime ? numOfFrames * 1e9 / totalTime : 0.0);
+
+	for(uint8_t i = 0; i < HEADLESS_NUM_OF_PROFILE; i++){
+		printf("%-28s %10.1f ns/frame %5.1f%%\n",profileName[i],numOfFrames ? (double)profileTime[i] / numOfFrames : 0.0,
+		totalTime ? 100.0 * profileTime[i] / totalTime : 0.0);
+	}
+
+	if(replayFlag){
+		printf("Replay %s at frame %lu\n",replayResult == HEADLESS_REPLAY_DIFFERENT ? "went different" : "finished",
+		(unsigned long)InputLogReader.numOfFrames);
+	}
+
+	if(logFilePtr){
+		check_state();
+		input_log_write_end(&InputLogWriter);
+		printf("Input log: %lu frames in %lu bytes\n",(unsigned long)InputLogWriter.numOfFrames,(unsigned long)InputLogWriter.numOfBytes);
+		fclose(logFilePtr);
+	}
+
+	if(telemetryFilePtr){
+		printf("Telemetry: %lu packets in %lu bytes\n",(unsigned long)TelemetryWriter.numOfPackets,(unsigned long)TelemetryWriter.numOfBytes);
+		fclose(telemetryFilePtr);
+	}
+
+	printf("Pixels pushed: %llu, sounds played: %lu, random numbers: %lu\n",(unsigned long long)headless_get_stats()->pixelsPushed,
+	(unsigned long)headless_get_stats()->soundsPlayed,(unsigned long)headless_get_stats()->randomNumbers);
+	printf("SPI: %llu bytes in %lu areas, %.3f ms per frame at %.1f MHz and %lu cycles per area\n",(unsigned long long)headless_get_stats()->SPIbytes,
+	(unsigned long)headless_get_stats()->numOfAreas,numOfFrames ? headless_get_stats()->SPIcycles*1e3/HEADLESS_CPU_CLOCK/numOfFrames : 0.0,
+	SPIModel.SPIclock/1e6,(unsigned long)SPIModel.areaCycles);
+	print_latency();
+	printf("State hash: 0x%08lx\n",(unsigned long)RTE_get_state_hash());
+
+	if(Script.scriptPtr){
+		fclose(Script.scriptPtr);
+	}
+
+	return 0;
+}
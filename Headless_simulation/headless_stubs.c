@@ -0,0 +1,536 @@
+/**
+*@file headless_stubs.c
+*@brief Replace hardware of "Return To Earth" game console when game engine run on PC.
+*
+*This implementation file provide stub implementations of driver functions called by game engine.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "headless_stubs.h"
+#include "../Game_engine_return_to_earth/game_engine.h"
+
+/***********************************************************************
+External function prototype
+***********************************************************************/
+extern void TIM6_DAC_IRQHandler (void);
+
+/***********************************************************************
+Private structure definition
+***********************************************************************/
+typedef struct{
+	TIM_TypeDef *TIMxPtr;
+	void (*IRQHandler)(void);
+	uint32_t period;	/*counter clock cycles between 2 update events*/
+	uint32_t elapsed;
+	uint8_t running;
+	uint8_t interrupt;
+}Headless_Timer_t;
+
+/***********************************************************************
+Private function prototype
+***********************************************************************/
+Headless_Timer_t* headless_find_timer (TIM_TypeDef *TIMxPtr);
+uint8_t headless_play_sound (const void *soundPtr, uint8_t playMode);
+void headless_send_spi (uint32_t numOfBytes, uint32_t numOfAreas);
+uint32_t headless_edge_time (void);
+
+/***********************************************************************
+Global variable
+***********************************************************************/
+#ifndef HEADLESS_USE_ILI9341_DRIVER
+ILI9341_Config_t ILI9341_config;
+#endif
+
+Headless_Input_t headlessInput = {JS_DIR_CENTERED,0};
+Headless_Stats_t headlessStats = {0,0,0,0,0,0};
+Headless_SPI_Model_t headlessSPIModel = {21000000,200};
+uint64_t headlessCycles = 0;	/*emulated DWT cycle count*/
+uint64_t headlessUpdateEventTime = 0;	/*time of latest TIM6 update event*/
+uint64_t headlessInputTime[2] = {0,0};	/*time of 2 latest input reads, edges of latest input happened between them*/
+uint64_t headlessLastTransferTime = 0;
+uint32_t edgeTimeState = 0x2545F491;	/*separate from RNG_get so that time stamps do not change game*/
+uint32_t rngState = 1;
+const void *loopingSoundPtr[SPEAKER_NUM_OF_VOICES];
+
+Headless_Timer_t headlessTimer[] = {
+	{TIM6,TIM6_DAC_IRQHandler,0,0,STOP,DISABLE},
+};
+
+/***********************************************************************
+Public function: Set seed of pseudo random number generator
+***********************************************************************/
+void headless_rng_seed(uint32_t seed)
+{
+	rngState = seed ? seed : 1;
+}
+
+/***********************************************************************
+Public function: Set input read by game engine
+***********************************************************************/
+void headless_set_input(const Headless_Input_t *InputPtr)
+{
+	headlessInput = *InputPtr;
+	headlessInputTime[0] = headlessInputTime[1];
+	headlessInputTime[1] = headlessCycles;
+}
+
+/***********************************************************************
+Public function: Set cost of bytes sent to ILI9341
+***********************************************************************/
+void headless_set_spi_model(const Headless_SPI_Model_t *ModelPtr)
+{
+	headlessSPIModel = *ModelPtr;
+}
+
+/***********************************************************************
+Public function: Advance running timers by one game frame
+***********************************************************************/
+void headless_tick_timers(void)
+{
+	Headless_Timer_t *FrameTimerPtr = headless_find_timer(TIM6);
+	uint32_t framePeriod = FrameTimerPtr->period;
+
+	/*next frame start at next update event, at once if previous frame is still running (update events meanwhile are lost)*/
+	if(FrameTimerPtr->running == START && framePeriod){
+		uint64_t periodCycles = (uint64_t)framePeriod*(HEADLESS_CPU_CLOCK/HEADLESS_TIMER_CLOCK);
+
+		headlessUpdateEventTime += periodCycles;
+		if(headlessCycles > headlessUpdateEventTime){
+			headlessUpdateEventTime += (headlessCycles - headlessUpdateEventTime)/periodCycles*periodCycles;
+		}else{
+			headlessCycles = headlessUpdateEventTime;
+		}
+	}
+
+	for(uint8_t i = 0; i < sizeof(headlessTimer)/sizeof(headlessTimer[0]); i++){
+		Headless_Timer_t *TimerPtr = &headlessTimer[i];
+
+		if(TimerPtr->running != START || !TimerPtr->period){
+			continue;
+		}
+
+		TimerPtr->elapsed += framePeriod;
+
+		while(TimerPtr->elapsed >= TimerPtr->period){
+			TimerPtr->elapsed -= TimerPtr->period;
+
+			if(TimerPtr->interrupt == ENABLE){
+				TimerPtr->IRQHandler();
+			}
+		}
+	}
+}
+
+/***********************************************************************
+Public function: Get counters of what game engine sent to stubs
+***********************************************************************/
+Headless_Stats_t* headless_get_stats(void)
+{
+	return &headlessStats;
+}
+
+/***********************************************************************
+Private function: Get emulated timer of timer peripheral
+***********************************************************************/
+Headless_Timer_t* headless_find_timer (TIM_TypeDef *TIMxPtr)
+{
+	for(uint8_t i = 0; i < sizeof(headlessTimer)/sizeof(headlessTimer[0]); i++){
+		if(headlessTimer[i].TIMxPtr == TIMxPtr){
+			return &headlessTimer[i];
+		}
+	}
+
+	/*game engine only use TIM6*/
+	return &headlessTimer[0];
+}
+
+/***********************************************************************
+Private function: Count played sound, only looping sounds are kept on a voice (sound played once end at once)
+***********************************************************************/
+uint8_t headless_play_sound (const void *soundPtr, uint8_t playMode)
+{
+	headlessStats.soundsPlayed++;
+
+	if(playMode == SPEAKER_PLAY_LOOP){
+		for(uint8_t voice = 0; voice < SPEAKER_NUM_OF_VOICES; voice++){
+			if(loopingSoundPtr[voice] == NULL){
+				loopingSoundPtr[voice] = soundPtr;
+				return voice;
+			}
+		}
+	}
+
+	return SPEAKER_NO_VOICE;
+}
+
+/***********************************************************************
+Private function: Spend time of bytes sent to ILI9341
+***********************************************************************/
+void headless_send_spi (uint32_t numOfBytes, uint32_t numOfAreas)
+{
+	uint64_t cycles = (uint64_t)numOfBytes*8*HEADLESS_CPU_CLOCK/headlessSPIModel.SPIclock + (uint64_t)numOfAreas*headlessSPIModel.areaCycles;
+
+	headlessStats.SPIbytes += numOfBytes;
+	headlessStats.numOfAreas += numOfAreas;
+	headlessStats.SPIcycles += cycles;
+	headlessCycles += cycles;
+	headlessLastTransferTime = headlessCycles;
+}
+
+/***********************************************************************
+Private function: Get random time between 2 latest input reads
+***********************************************************************/
+uint32_t headless_edge_time (void)
+{
+	uint64_t interval = headlessInputTime[1] - headlessInputTime[0];
+
+	edgeTimeState ^= edgeTimeState << 13;
+	edgeTimeState ^= edgeTimeState >> 17;
+	edgeTimeState ^= edgeTimeState << 5;
+
+	/*edge after previous read, not later than latest read*/
+	return (uint32_t)(headlessInputTime[1] - (interval ? edgeTimeState % interval : 0));
+}
+
+/***********************************************************************
+Stub: RCC and DWT drivers
+***********************************************************************/
+void RCC_set_SYSCLK_profile (uint8_t profile)
+{
+}
+
+int32_t RCC_get_SYSCLK_value (void)
+{
+	return HEADLESS_CPU_CLOCK;
+}
+
+int32_t RCC_get_PCLK_value(uint8_t APBx)
+{
+	return (APBx == APB1) ? HEADLESS_CPU_CLOCK/4 : HEADLESS_CPU_CLOCK/2;
+}
+
+int32_t RCC_get_TIMCLK_value(uint8_t APBx)
+{
+	return (APBx == APB1) ? HEADLESS_TIMER_CLOCK : HEADLESS_CPU_CLOCK;
+}
+
+/*same split as RCC driver: smallest prescaler dividing period with reload in 16 bits*/
+uint8_t RCC_get_TIM_period(uint32_t timerClock, uint32_t rate, uint16_t *prescalerPtr, uint16_t *reloadPtr)
+{
+	uint32_t period = timerClock/rate ? timerClock/rate : 1;
+	uint32_t minPrescaler = period/0x10000 + ((period % 0x10000) ? 1 : 0);
+	uint32_t prescaler = minPrescaler;
+
+	while(prescaler <= 0x10000 && period % prescaler){
+		prescaler++;
+	}
+	if(prescaler > 0x10000){
+		prescaler = minPrescaler;
+	}
+
+	*prescalerPtr = (uint16_t)(prescaler - 1);
+	*reloadPtr = (uint16_t)(period/prescaler - 1);
+
+	return (timerClock % rate == 0 && period % prescaler == 0) ? TRUE : FALSE;
+}
+
+uint8_t RCC_get_SPI_prescaler(uint32_t PCLK, uint32_t maxSCLK)
+{
+	uint8_t baudRate = 0;
+
+	while(baudRate < 7 && (PCLK >> (baudRate + 1)) > maxSCLK){
+		baudRate++;
+	}
+
+	return baudRate;
+}
+
+uint32_t DWT_get_cycle_count(void)
+{
+	return (uint32_t)headlessCycles;
+}
+
+uint32_t DWT_get_elapsed_cycles(uint32_t startCount)
+{
+	return (uint32_t)headlessCycles - startCount;
+}
+
+/***********************************************************************
+Stub: RNG driver (xorshift32 pseudo random number generator, hardware RNG keep running between RNG_init and RNG_deinit so seed is not reset)
+***********************************************************************/
+void RNG_init(void)
+{
+}
+
+void RNG_deinit(void)
+{
+}
+
+uint32_t RNG_get(void)
+{
+	rngState ^= rngState << 13;
+	rngState ^= rngState >> 17;
+	rngState ^= rngState << 5;
+
+	headlessStats.randomNumbers++;
+
+	return rngState;
+}
+
+/***********************************************************************
+Stub: Timer driver
+***********************************************************************/
+void TIM_init_direct(TIM_TypeDef *TIMxPtr,uint16_t reloadVal,uint16_t preScaler)
+{
+	Headless_Timer_t *TimerPtr = headless_find_timer(TIMxPtr);
+
+	TimerPtr->period = ((uint32_t)reloadVal + 1) * ((uint32_t)preScaler + 1);
+	TimerPtr->elapsed = 0;
+}
+
+void TIM_ctr(TIM_TypeDef *TIMxPtr, uint8_t startOrStop)
+{
+	headless_find_timer(TIMxPtr)->running = startOrStop;
+}
+
+void TIM_interrupt_ctr(TIM_TypeDef *TIMxPtr, uint8_t enOrDis)
+{
+	headless_find_timer(TIMxPtr)->interrupt = enOrDis;
+}
+
+void TIM_intrpt_vector_ctr (uint8_t IRQnumber, uint8_t enOrDis)
+{
+}
+
+void TIM_intrpt_handler (TIM_TypeDef *TIMxPtr)
+{
+}
+
+/***********************************************************************
+Stub: ILI9341 driver (pixels are counted, not drawn), left out when real driver run on emulated panel (headless_lcd.c)
+***********************************************************************/
+#ifndef HEADLESS_USE_ILI9341_DRIVER
+void ILI9341_init (void)
+{
+	ILI9341_config.width = ILI9341_WIDTH;
+	ILI9341_config.height = ILI9341_HEIGHT;
+	ILI9341_config.orientation = ILI9341_orientation_portrait_1;
+}
+
+void ILI9341_rotate (ILI9341_Orientation_e orientation)
+{
+	ILI9341_config.orientation = orientation;
+
+	if(orientation == ILI9341_orientation_portrait_1 || orientation == ILI9341_orientation_portrait_2){
+		ILI9341_config.width = ILI9341_WIDTH;
+		ILI9341_config.height = ILI9341_HEIGHT;
+	}else{
+		ILI9341_config.width = ILI9341_HEIGHT;
+		ILI9341_config.height = ILI9341_WIDTH;
+	}
+}
+
+void ILI9341_fill_display (uint16_t color)
+{
+	headlessStats.pixelsPushed += (uint32_t)ILI9341_config.width * ILI9341_config.height;
+	headless_send_spi(HEADLESS_AREA_SETUP_BYTES + 2*(uint32_t)ILI9341_config.width * ILI9341_config.height,1);
+}
+
+void ILI9341_draw_filled_rectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint32_t color)
+{
+	headlessStats.pixelsPushed += (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+	headless_send_spi(HEADLESS_AREA_SETUP_BYTES + 2*(uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1),1);
+}
+
+void ILI9341_draw_bitmap (int16_t x, int16_t y, const uint8_t *bitmapPtr, uint16_t w, uint16_t h, uint16_t color)
+{
+	headlessStats.pixelsPushed += (uint32_t)w * h;
+	headless_send_spi(HEADLESS_AREA_SETUP_BYTES + 2*(uint32_t)w * h,1);
+}
+
+void ILI9341_draw_bitmap_w_background (int16_t x, int16_t y, const uint8_t *bitmapPtr, uint16_t w, uint16_t h, uint16_t foreground, uint16_t background)
+{
+	headlessStats.pixelsPushed += (uint32_t)w * h;
+	headless_send_spi(HEADLESS_AREA_SETUP_BYTES + 2*(uint32_t)w * h,1);
+}
+
+void ILI9341_put_string (uint16_t x, uint16_t y, char *str, TM_FontDef_t *font, uint32_t foreground)
+{
+	while(*str++){
+		headlessStats.pixelsPushed += (uint32_t)font->FontWidth * font->FontHeight;
+		headless_send_spi(HEADLESS_AREA_SETUP_BYTES + 2*(uint32_t)font->FontWidth * font->FontHeight,1);
+	}
+}
+
+void ILI9341_set_active_area (uint16_t startColum, uint16_t startPage, uint16_t endColumn, uint16_t endPage)
+{
+	headless_send_spi(HEADLESS_AREA_SETUP_BYTES - 1,0);
+}
+
+void ILI9341_send_command (uint8_t cmd)
+{
+	headless_send_spi(1,(cmd == ILI9341_MEM_WRITE) ? 1 : 0);
+}
+
+void ILI9341_send_parameter_16_bits (uint16_t param)
+{
+	headlessStats.pixelsPushed++;
+	headless_send_spi(2,0);
+}
+
+/*bytes are sent at once*/
+void ILI9341_wait_until_ready (void)
+{
+}
+
+uint32_t ILI9341_get_last_transfer_timestamp (void)
+{
+	return (uint32_t)headlessLastTransferTime;
+}
+
+/*picture loop run once, screen is drawn like without framebuffer*/
+void ILI9341_framebuffer_begin(uint16_t background)
+{
+}
+
+uint8_t ILI9341_framebuffer_next_strip(void)
+{
+	return FALSE;
+}
+
+uint8_t ILI9341_framebuffer_active_check(void)
+{
+	return FALSE;
+}
+
+void ILI9341_framebuffer_draw_pixel(int16_t x, int16_t y, uint16_t color)
+{
+}
+#endif
+
+/***********************************************************************
+Stub: Joystick, button, LED and speaker drivers
+***********************************************************************/
+void joystick_init(ADC_TypeDef *ADCxPtr, uint8_t X_axis_ADC_channel, uint8_t Y_axis_ADC_channel)
+{
+}
+
+uint8_t joystick_read_direction(ADC_TypeDef *ADCxPtr, uint8_t X_axis_ADC_channel, uint8_t Y_axis_ADC_channel)
+{
+	return headlessInput.joystickDirection;
+}
+
+void joystick_calibrate(ADC_TypeDef *ADCxPtr, uint8_t X_axis_ADC_channel, uint8_t Y_axis_ADC_channel)
+{
+}
+
+/*scripted direction is joystick fully pushed along compass direction, index is JS_DIR*/
+const Joystick_Vector_t headlessStickVector[9] = {
+	{0,0,0,0},
+	{-11585,11585,JOYSTICK_VECTOR_ONE,24576},
+	{-11585,-11585,JOYSTICK_VECTOR_ONE,40960},
+	{-JOYSTICK_VECTOR_ONE,0,JOYSTICK_VECTOR_ONE,32768},
+	{11585,11585,JOYSTICK_VECTOR_ONE,8192},
+	{11585,-11585,JOYSTICK_VECTOR_ONE,57344},
+	{JOYSTICK_VECTOR_ONE,0,JOYSTICK_VECTOR_ONE,0},
+	{0,JOYSTICK_VECTOR_ONE,JOYSTICK_VECTOR_ONE,16384},
+	{0,-JOYSTICK_VECTOR_ONE,JOYSTICK_VECTOR_ONE,49152}
+};
+
+void joystick_read_vector(ADC_TypeDef *ADCxPtr, uint8_t X_axis_ADC_channel, uint8_t Y_axis_ADC_channel, Joystick_Vector_t *VectorPtr)
+{
+	*VectorPtr = headlessStickVector[headlessInput.joystickDirection];
+}
+
+/*event of each button whose scripted state differ from last event, buttons of scripted input change between frames only*/
+uint8_t headlessButtonState = 0;
+
+uint8_t button_event_init (GPIO_TypeDef *GPIOxPtr, uint8_t pinNumber, uint8_t puPdr, uint32_t debounceTime)
+{
+	return (GPIOxPtr == SHOOT_BUTTON_PORT && pinNumber == SHOOT_BUTTON_PIN) ? 0 : 1;
+}
+
+void button_intrpt_handler (uint8_t pinNumber)
+{
+}
+
+uint8_t button_get_event (Button_Event_t *EventPtr)
+{
+	uint8_t headlessButton[2] = {HEADLESS_BUTTON_SHOOT,HEADLESS_BUTTON_THRUST};
+
+	for(uint8_t button = 0; button < 2; button++){
+		uint8_t pressed = headlessInput.buttons & headlessButton[button];
+
+		if(pressed != (headlessButtonState & headlessButton[button])){
+			headlessButtonState ^= headlessButton[button];
+			EventPtr->timestamp = headless_edge_time();
+			EventPtr->button = button;
+			EventPtr->type = pressed ? BUTTON_PRESSED : BUTTON_RELEASED;
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+void button_flush_events (void)
+{
+	headlessButtonState = headlessInput.buttons & (HEADLESS_BUTTON_SHOOT | HEADLESS_BUTTON_THRUST);
+}
+
+void led_init (GPIO_TypeDef *GPIOxPtr, uint8_t pinNumber)
+{
+}
+
+void led_on (GPIO_TypeDef *GPIOxPtr, uint8_t pinNumber)
+{
+}
+
+void led_off (GPIO_TypeDef *GPIOxPtr, uint8_t pinNumber)
+{
+}
+
+void speaker_init (uint8_t DAC_channel, uint16_t timerPrescaler, uint16_t timerReload)
+{
+}
+
+void speaker_play_sound (const uint16_t *SoundPtr, const uint16_t size)
+{
+	headlessStats.soundsPlayed++;
+}
+
+uint8_t speaker_play_voice (const uint16_t *soundPtr, uint16_t size, uint16_t volume, uint8_t priority, uint8_t playMode)
+{
+	return headless_play_sound(soundPtr,playMode);
+}
+
+uint8_t speaker_play_ADPCM_voice (const ADPCM_Sound_t *soundPtr, uint16_t volume, uint8_t priority, uint8_t playMode)
+{
+	return headless_play_sound(soundPtr,playMode);
+}
+
+void speaker_stop_voice (uint8_t voice)
+{
+	if(voice < SPEAKER_NUM_OF_VOICES){
+		loopingSoundPtr[voice] = NULL;
+	}
+}
+
+/*sounds are not mixed, output never run late*/
+uint32_t speaker_get_num_of_underruns (void)
+{
+	return 0;
+}
+
+uint8_t speaker_find_voice (const void *soundPtr)
+{
+	for(uint8_t voice = 0; voice < SPEAKER_NUM_OF_VOICES; voice++){
+		if(loopingSoundPtr[voice] == soundPtr){
+			return voice;
+		}
+	}
+
+	return SPEAKER_NO_VOICE;
+}
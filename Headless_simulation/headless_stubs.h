@@ -0,0 +1,88 @@
+/**
+*@file headless_stubs.h
+*@brief Replace hardware of "Return To Earth" game console when game engine run on PC.
+*
+*This header file provide functions for feeding scripted input to stub implementations of ILI9341, joystick, button, speaker, RNG and timer
+*driver functions, and for reading what game engine sent to them. Stubs only count pixels and sounds, nothing is displayed or played.
+*Timers are emulated in whole frames: every call to headless_tick_timers advance running timers by one period of TIM6 (one game frame).
+*CPU time is emulated in DWT cycles (DWT_get_cycle_count): a frame start at update event of TIM6 (or when previous frame end, if it
+*was longer than TIM6 period) and only bytes sent to ILI9341 take time, following SPI cost model (headless_set_spi_model).
+*Button edges are time stamped at random time between 2 reads of input, like presses of a player which are not synchronized with frames.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef HEADLESS_STUBS_H
+#define HEADLESS_STUBS_H
+
+#include <stdint.h>
+
+/*
+*@HEADLESS_BUTTON
+*Bits of pressed buttons
+*/
+#define HEADLESS_BUTTON_SHOOT	(1 << 0)
+#define HEADLESS_BUTTON_THRUST	(1 << 1)
+
+#define HEADLESS_CPU_CLOCK		168000000UL	/*DWT cycles per second (RCC_PROFILE_168_MHZ, RTE_CLOCK_PROFILE)*/
+#define HEADLESS_TIMER_CLOCK	84000000UL	/*counter clock of TIM6 without prescaler (APB1 timer clock)*/
+
+/*bytes of column address, page address and memory write commands sent before pixels of an area*/
+#define HEADLESS_AREA_SETUP_BYTES	11
+
+typedef struct{
+	uint8_t joystickDirection;	/*@JS_DIR in joystick.h*/
+	uint8_t buttons;	/*@HEADLESS_BUTTON*/
+}Headless_Input_t;
+
+typedef struct{
+	uint32_t SPIclock;	/*SPI clock in Hz, 21MHz for ILI9341 (SPI1 clock divided by 2)*/
+	uint32_t areaCycles;	/*CPU cycles spent on every area (set up of DMA transfer, waiting between commands)*/
+}Headless_SPI_Model_t;
+
+typedef struct{
+	uint64_t pixelsPushed;	/*pixels sent to ILI9341 (filled area, bitmaps, characters)*/
+	uint32_t soundsPlayed;
+	uint32_t randomNumbers;	/*calls to RNG_get*/
+	uint64_t SPIbytes;	/*bytes sent to ILI9341 (commands and pixels)*/
+	uint32_t numOfAreas;	/*memory write commands*/
+	uint64_t SPIcycles;	/*CPU cycles spent sending bytes to ILI9341*/
+}Headless_Stats_t;
+
+/**
+*@brief		Set seed of pseudo random number generator replacing RNG_get (same seed always give same numbers)
+*@param		seed Any value (0 is replaced by 1)
+*@return	None
+*/
+void headless_rng_seed(uint32_t seed);
+
+/**
+*@brief		Set joystick direction and buttons read by game engine until next call
+*@param		InputPtr Pointer to input
+*@return	None
+*/
+void headless_set_input(const Headless_Input_t *InputPtr);
+
+/**
+*@brief		Set cost of bytes sent to ILI9341 (default: 21MHz SPI clock, 200 cycles per area)
+*@param		ModelPtr Pointer to SPI cost model
+*@return	None
+*/
+void headless_set_spi_model(const Headless_SPI_Model_t *ModelPtr);
+
+/**
+*@brief		Advance running timers by one game frame (period of TIM6), interrupt handlers of timers which overflowed are called
+*@param		None
+*@return	None
+*/
+void headless_tick_timers(void);
+
+/**
+*@brief		Get counters of what game engine sent to stubs
+*@param		None
+*@return	Pointer to counters
+*/
+Headless_Stats_t* headless_get_stats(void);
+
+#endif
@@ -0,0 +1,420 @@
+/**
+*@file headless_uart.c
+*@brief Emulate USART with its DMA streams on PC, so that real UART driver (Peripheral_drivers/src/stm32f407xx_uart.c) can run without hardware.
+*
+*This implementation file provide emulated USART registers, and stub implementations of DMA, RCC and GPIO driver functions used by
+*UART driver. Data register written by UART interrupt handler is detected with a value which can not be a data frame.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "headless_uart.h"
+
+/*value left in data register before calling UART interrupt handler on TXE, data frames are 9 bits at most*/
+#define HEADLESS_UART_DR_UNWRITTEN	0xFFFFFFFF
+
+/*APB1 and APB2 clocks after RCC_set_SYSCLK_PLL_84_MHz*/
+#define HEADLESS_UART_PCLK1		21000000
+#define HEADLESS_UART_PCLK2		42000000
+
+/***********************************************************************
+Private structure definition
+***********************************************************************/
+typedef struct{
+	DMA_Handle_t *DMAxHandlePtr;	/*stream set by DMA_init*/
+	uint8_t *memPtr;
+	uint16_t count;
+	uint16_t remaining;
+	uint32_t interrupts;	/*refer to @DMA_INTERRUPT*/
+	uint8_t pendingEvents;	/*refer to @DMA_EVENT, reported by DMA_intrpt_handler*/
+}Headless_UART_DMA_t;
+
+/***********************************************************************
+Private function prototype
+***********************************************************************/
+void headless_uart_call_handler (void);
+void headless_uart_feed_transmitter (void);
+void headless_uart_receive_byte (uint8_t data);
+void headless_uart_output (uint8_t data);
+Headless_UART_DMA_t* headless_uart_get_DMA (DMA_Handle_t *DMAxHandlePtr);
+
+/***********************************************************************
+Global variable
+***********************************************************************/
+USART_TypeDef headlessUSART;
+UART_Handle_t *headlessUARTHandlePtr = NULL;
+
+Headless_UART_DMA_t headlessUARTTxDMA;
+Headless_UART_DMA_t headlessUARTRxDMA;
+
+uint16_t txDataRegister;	/*transmit data register, full when TXE is clear*/
+uint8_t rxLineActive = 0;	/*byte received since line was last idle*/
+uint8_t loopbackEnabled = 0;
+
+uint8_t peerBuffer[HEADLESS_UART_PEER_BUFFER_SIZE];
+uint32_t peerHead = 0;
+uint32_t peerTail = 0;
+
+uint8_t *uartOutputPtr = NULL;
+uint32_t uartOutputSize = 0;
+uint32_t numOfUartOutputs = 0;
+
+Headless_UART_Stats_t headlessUARTStats;
+
+/***********************************************************************
+Public function: Connect UART handle to emulated USART registers
+***********************************************************************/
+void headless_uart_init(UART_Handle_t *UARTxHandlePtr)
+{
+	headlessUSART.SR = USART_SR_TXE | USART_SR_TC;
+	headlessUSART.DR = 0;
+	headlessUSART.BRR = 0;
+	headlessUSART.CR1 = 0;
+	headlessUSART.CR2 = 0;
+	headlessUSART.CR3 = 0;
+	headlessUSART.GTPR = 0;
+
+	UARTxHandlePtr->UARTxPtr = &headlessUSART;
+	UARTxHandlePtr->txState = UART_STATE_READY;
+	UARTxHandlePtr->rxState = UART_STATE_READY;
+	UARTxHandlePtr->DMAxTxHandlePtr = NULL;
+	UARTxHandlePtr->DMAxRxHandlePtr = NULL;
+	headlessUARTHandlePtr = UARTxHandlePtr;
+
+	headlessUARTTxDMA.DMAxHandlePtr = NULL;
+	headlessUARTRxDMA.DMAxHandlePtr = NULL;
+
+	rxLineActive = 0;
+	loopbackEnabled = 0;
+	peerHead = 0;
+	peerTail = 0;
+
+	headless_uart_reset_stats();
+}
+
+/***********************************************************************
+Public function: Set buffer receiving bytes sent by transmitter
+***********************************************************************/
+void headless_uart_set_output(uint8_t *bufferPtr, uint32_t size)
+{
+	uartOutputPtr = bufferPtr;
+	uartOutputSize = size;
+	numOfUartOutputs = 0;
+}
+
+/***********************************************************************
+Public function: Get number of bytes sent by transmitter
+***********************************************************************/
+uint32_t headless_uart_get_num_of_outputs(void)
+{
+	return numOfUartOutputs;
+}
+
+/***********************************************************************
+Public function: Connect or disconnect transmitter output to receiver input
+***********************************************************************/
+void headless_uart_loopback_ctr(uint8_t enOrDis)
+{
+	loopbackEnabled = enOrDis;
+}
+
+/***********************************************************************
+Public function: Queue bytes sent by peer
+***********************************************************************/
+uint32_t headless_uart_inject(const uint8_t *dataPtr, uint32_t length)
+{
+	uint32_t i;
+
+	for(i = 0; i < length && peerTail - peerHead < HEADLESS_UART_PEER_BUFFER_SIZE; i++){
+		peerBuffer[peerTail++ % HEADLESS_UART_PEER_BUFFER_SIZE] = dataPtr[i];
+	}
+
+	return i;
+}
+
+/***********************************************************************
+Public function: Run emulated line
+***********************************************************************/
+void headless_uart_run(uint32_t numOfCharTimes)
+{
+	USART_TypeDef *USARTPtr = &headlessUSART;
+
+	while(numOfCharTimes--){
+		uint8_t shifted = 0;
+		uint8_t txData = 0;
+
+		headlessUARTStats.numOfCharTimes++;
+
+		/*transmitter: shift out data register, which is refilled at once (DMA request or TXE interrupt)*/
+		if((USARTPtr->CR1 & USART_CR1_UE) && (USARTPtr->CR1 & USART_CR1_TE)){
+			if(!(USARTPtr->SR & USART_SR_TXE)){
+				txData = (uint8_t)txDataRegister;
+				shifted = 1;
+				USARTPtr->SR |= USART_SR_TXE;
+				USARTPtr->SR &= ~USART_SR_TC;
+				headlessUARTStats.txBusyTime++;
+			}
+
+			headless_uart_feed_transmitter();
+
+			if(shifted){
+				headless_uart_output(txData);
+			}else if((USARTPtr->SR & USART_SR_TXE) && !(USARTPtr->SR & USART_SR_TC)){
+				USARTPtr->SR |= USART_SR_TC;
+				if(USARTPtr->CR1 & USART_CR1_TCIE){
+					headless_uart_call_handler();
+				}
+			}
+		}
+
+		/*receiver: one byte per character time from transmitter (loopback) or peer, line is idle otherwise*/
+		if(!((USARTPtr->CR1 & USART_CR1_UE) && (USARTPtr->CR1 & USART_CR1_RE))){
+			continue;
+		}
+
+		if(loopbackEnabled && shifted){
+			headless_uart_receive_byte(txData);
+		}else if(peerHead != peerTail){
+			headless_uart_receive_byte(peerBuffer[peerHead++ % HEADLESS_UART_PEER_BUFFER_SIZE]);
+		}else if(rxLineActive){
+			rxLineActive = 0;
+			USARTPtr->SR |= USART_SR_IDLE;
+			if(USARTPtr->CR1 & USART_CR1_IDLEIE){
+				headless_uart_call_handler();
+
+				/*handler read SR then DR*/
+				USARTPtr->SR &= ~USART_SR_IDLE;
+			}
+		}
+	}
+}
+
+/***********************************************************************
+Public function: Get counters of emulated line
+***********************************************************************/
+void headless_uart_get_stats(Headless_UART_Stats_t *StatsPtr)
+{
+	*StatsPtr = headlessUARTStats;
+}
+
+/***********************************************************************
+Public function: Reset counters of emulated line
+***********************************************************************/
+void headless_uart_reset_stats(void)
+{
+	headlessUARTStats.numOfCharTimes = 0;
+	headlessUARTStats.txBusyTime = 0;
+	headlessUARTStats.numOfUARTIRQs = 0;
+	headlessUARTStats.numOfTxDMAIRQs = 0;
+	headlessUARTStats.numOfRxDMAIRQs = 0;
+	headlessUARTStats.numOfRxLost = 0;
+}
+
+/***********************************************************************
+Private function: Call UART interrupt handler
+***********************************************************************/
+void headless_uart_call_handler (void)
+{
+	headlessUARTStats.numOfUARTIRQs++;
+	UART_intrpt_handler(headlessUARTHandlePtr);
+}
+
+/***********************************************************************
+Private function: Fill empty transmit data register by DMA (DMAT) or by UART interrupt handler (TXEIE)
+***********************************************************************/
+void headless_uart_feed_transmitter (void)
+{
+	USART_TypeDef *USARTPtr = &headlessUSART;
+	Headless_UART_DMA_t *DMAPtr = &headlessUARTTxDMA;
+
+	if(!(USARTPtr->SR & USART_SR_TXE)){
+		return;
+	}
+
+	if((USARTPtr->CR3 & USART_CR3_DMAT) && DMAPtr->DMAxHandlePtr != NULL && DMAPtr->DMAxHandlePtr->state == DMA_STATE_BUSY && DMAPtr->remaining){
+		txDataRegister = DMAPtr->memPtr[DMAPtr->count - DMAPtr->remaining];
+		USARTPtr->SR &= ~USART_SR_TXE;
+
+		if(--DMAPtr->remaining == 0){
+			DMAPtr->pendingEvents |= DMA_EV_TRANSFER_CMPLT;
+			if(DMAPtr->interrupts & DMA_INTRPT_TC){
+				headlessUARTStats.numOfTxDMAIRQs++;
+				UART_DMA_TX_intrpt_handler(headlessUARTHandlePtr);
+			}
+		}
+	}else if(USARTPtr->CR1 & USART_CR1_TXEIE){
+		USARTPtr->DR = HEADLESS_UART_DR_UNWRITTEN;
+		headless_uart_call_handler();
+
+		if(USARTPtr->DR != HEADLESS_UART_DR_UNWRITTEN){
+			txDataRegister = USARTPtr->DR & 0x1FF;
+			USARTPtr->SR &= ~USART_SR_TXE;
+		}
+	}
+}
+
+/***********************************************************************
+Private function: Pass received byte to DMA (DMAR) or to UART interrupt handler (RXNEIE)
+***********************************************************************/
+void headless_uart_receive_byte (uint8_t data)
+{
+	USART_TypeDef *USARTPtr = &headlessUSART;
+	Headless_UART_DMA_t *DMAPtr = &headlessUARTRxDMA;
+
+	rxLineActive = 1;
+	USARTPtr->SR &= ~USART_SR_IDLE;
+
+	if((USARTPtr->CR3 & USART_CR3_DMAR) && DMAPtr->DMAxHandlePtr != NULL && DMAPtr->DMAxHandlePtr->state == DMA_STATE_BUSY && DMAPtr->remaining){
+		DMAPtr->memPtr[DMAPtr->count - DMAPtr->remaining] = data;
+		DMAPtr->remaining--;
+
+		if(DMAPtr->remaining == DMAPtr->count - DMAPtr->count/2){
+			DMAPtr->pendingEvents |= DMA_EV_HALF_TRANSFER;
+		}
+		if(DMAPtr->remaining == 0){
+			DMAPtr->pendingEvents |= DMA_EV_TRANSFER_CMPLT;
+
+			/*NDTR is reloaded in circular mode*/
+			if(DMAPtr->DMAxHandlePtr->DMAxConfigPtr->circular == DMA_CIRCULAR_EN){
+				DMAPtr->remaining = DMAPtr->count;
+			}
+		}
+
+		if(((DMAPtr->pendingEvents & DMA_EV_HALF_TRANSFER) && (DMAPtr->interrupts & DMA_INTRPT_HT)) ||
+		((DMAPtr->pendingEvents & DMA_EV_TRANSFER_CMPLT) && (DMAPtr->interrupts & DMA_INTRPT_TC))){
+			headlessUARTStats.numOfRxDMAIRQs++;
+			UART_DMA_RX_intrpt_handler(headlessUARTHandlePtr);
+		}
+	}else if(USARTPtr->CR1 & USART_CR1_RXNEIE){
+		USARTPtr->DR = data;
+		USARTPtr->SR |= USART_SR_RXNE;
+		headless_uart_call_handler();
+
+		/*handler read DR*/
+		USARTPtr->SR &= ~USART_SR_RXNE;
+	}else{
+		headlessUARTStats.numOfRxLost++;
+	}
+}
+
+/***********************************************************************
+Private function: Store byte sent by transmitter
+***********************************************************************/
+void headless_uart_output (uint8_t data)
+{
+	if(uartOutputPtr != NULL && numOfUartOutputs < uartOutputSize){
+		uartOutputPtr[numOfUartOutputs] = data;
+	}
+	numOfUartOutputs++;
+}
+
+/***********************************************************************
+Private function: Get emulated stream from DMA handle (NULL if handle is not a stream of UART)
+***********************************************************************/
+Headless_UART_DMA_t* headless_uart_get_DMA (DMA_Handle_t *DMAxHandlePtr)
+{
+	if(DMAxHandlePtr == headlessUARTTxDMA.DMAxHandlePtr){
+		return &headlessUARTTxDMA;
+	}else if(DMAxHandlePtr == headlessUARTRxDMA.DMAxHandlePtr){
+		return &headlessUARTRxDMA;
+	}
+
+	return NULL;
+}
+
+/***********************************************************************
+Stub: DMA driver (streams are told apart by direction)
+***********************************************************************/
+void DMA_init(DMA_Handle_t *DMAxHandlePtr)
+{
+	Headless_UART_DMA_t *DMAPtr = (DMAxHandlePtr->DMAxConfigPtr->direction == DMA_DIR_MEM_TO_PERIPH) ? &headlessUARTTxDMA : &headlessUARTRxDMA;
+
+	DMAPtr->DMAxHandlePtr = DMAxHandlePtr;
+	DMAPtr->remaining = 0;
+	DMAPtr->interrupts = 0;
+	DMAPtr->pendingEvents = 0;
+	DMAxHandlePtr->state = DMA_STATE_READY;
+}
+
+void DMA_start(DMA_Handle_t *DMAxHandlePtr, uint32_t periphAddr, uint32_t memAddr, uint16_t numOfData)
+{
+	Headless_UART_DMA_t *DMAPtr = headless_uart_get_DMA(DMAxHandlePtr);
+
+	/*addresses are 64 bits on PC, memory address is taken from UART handle*/
+	if(DMAPtr == &headlessUARTTxDMA){
+		DMAPtr->memPtr = (uint8_t*)headlessUARTHandlePtr->txQueueBufferPtr[headlessUARTHandlePtr->txQueueHead % UART_DMA_TX_QUEUE_SIZE];
+	}else if(DMAPtr == &headlessUARTRxDMA){
+		DMAPtr->memPtr = headlessUARTHandlePtr->rxRingPtr;
+	}else{
+		return;
+	}
+
+	DMAPtr->count = numOfData;
+	DMAPtr->remaining = numOfData;
+	DMAPtr->pendingEvents = 0;
+	DMAxHandlePtr->state = DMA_STATE_BUSY;
+}
+
+void DMA_stop(DMA_Handle_t *DMAxHandlePtr)
+{
+	DMAxHandlePtr->state = DMA_STATE_READY;
+}
+
+uint16_t DMA_get_remaining(DMA_Handle_t *DMAxHandlePtr)
+{
+	Headless_UART_DMA_t *DMAPtr = headless_uart_get_DMA(DMAxHandlePtr);
+
+	return (DMAPtr != NULL) ? DMAPtr->remaining : 0;
+}
+
+void DMA_interrupt_ctr(DMA_Handle_t *DMAxHandlePtr, uint32_t interrupts, uint8_t enOrDis)
+{
+	Headless_UART_DMA_t *DMAPtr = headless_uart_get_DMA(DMAxHandlePtr);
+
+	if(DMAPtr == NULL){
+		return;
+	}
+
+	if(enOrDis == ENABLE){
+		DMAPtr->interrupts |= interrupts;
+	}else{
+		DMAPtr->interrupts &= ~interrupts;
+	}
+}
+
+uint8_t DMA_intrpt_handler(DMA_Handle_t *DMAxHandlePtr)
+{
+	Headless_UART_DMA_t *DMAPtr = headless_uart_get_DMA(DMAxHandlePtr);
+	uint8_t event;
+
+	if(DMAPtr == NULL){
+		return 0;
+	}
+
+	event = DMAPtr->pendingEvents;
+	DMAPtr->pendingEvents = 0;
+
+	/*stream is disabled by hardware at the end of transfer (except circular mode)*/
+	if((event & DMA_EV_TRANSFER_CMPLT) && DMAxHandlePtr->DMAxConfigPtr->circular != DMA_CIRCULAR_EN){
+		DMAxHandlePtr->state = DMA_STATE_READY;
+	}
+
+	return event;
+}
+
+void DMA_intrpt_vector_ctr(uint8_t IRQnumber, uint8_t enOrDis)
+{
+}
+
+/***********************************************************************
+Stub: RCC and GPIO drivers
+***********************************************************************/
+int32_t RCC_get_PCLK_value(uint8_t APBx)
+{
+	return (APBx == APB2) ? HEADLESS_UART_PCLK2 : HEADLESS_UART_PCLK1;
+}
+
+void GPIO_init_direct (GPIO_TypeDef *GPIOxPtr,uint8_t pinNumber,uint8_t mode,uint8_t speed, uint8_t outType, uint8_t puPdr, uint8_t altFunc)
+{
+}
@@ -0,0 +1,95 @@
+/**
+*@file headless_uart.h
+*@brief Emulate USART with its DMA streams on PC, so that real UART driver (Peripheral_drivers/src/stm32f407xx_uart.c) can run without hardware.
+*
+*This header file provide functions for running emulated serial line and reading bytes sent by UART driver.
+*UART handle is connected to emulated USART registers, stub implementations of DMA driver functions used by UART driver emulate
+*transmission and reception streams. Time is counted in character times (10 bits at baud rate of UART, 10.85us at 921600 baud):
+*on each character time transmitter shift out one byte and take next one from data register (written by DMA or by UART interrupt
+*handler on TXE), receiver get one byte from peer (or from transmitter in loopback) and pass it to DMA or to UART interrupt handler
+*on RXNE. Line idle during one character time after a received byte set IDLE flag. Interrupt handlers of UART driver are called at
+*once when their interrupt is enabled, flags cleared by reading registers (RXNE, IDLE) are cleared after handler return.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef HEADLESS_UART_H
+#define HEADLESS_UART_H
+
+#include "../Peripheral_drivers/inc/stm32f407xx_uart.h"
+
+/*bytes sent by peer which can wait for receiver*/
+#define HEADLESS_UART_PEER_BUFFER_SIZE	4096
+
+typedef struct{
+	uint32_t numOfCharTimes;	/*character times emulated*/
+	uint32_t txBusyTime;	/*character times transmitter was shifting out a byte*/
+	uint32_t numOfUARTIRQs;	/*calls to UART_intrpt_handler*/
+	uint32_t numOfTxDMAIRQs;	/*calls to UART_DMA_TX_intrpt_handler*/
+	uint32_t numOfRxDMAIRQs;	/*calls to UART_DMA_RX_intrpt_handler*/
+	uint32_t numOfRxLost;	/*received bytes taken neither by DMA nor by interrupt*/
+}Headless_UART_Stats_t;
+
+/**
+*@brief		Connect UART handle to emulated USART registers, line is reset
+*
+*Call before UART_init and UART_DMA_init.
+*
+*@param		UARTxHandlePtr Pointer to UART handle struct
+*@return	None
+*/
+void headless_uart_init(UART_Handle_t *UARTxHandlePtr);
+
+/**
+*@brief		Set buffer receiving bytes sent by transmitter, number of outputs is reset
+*@param		bufferPtr Buffer of bytes
+*@param		size Number of bytes in buffer (following bytes are counted, not stored)
+*@return	None
+*/
+void headless_uart_set_output(uint8_t *bufferPtr, uint32_t size);
+
+/**
+*@brief		Get number of bytes sent by transmitter since last call to headless_uart_set_output
+*@param		None
+*@return	Number of bytes
+*/
+uint32_t headless_uart_get_num_of_outputs(void);
+
+/**
+*@brief		Connect or disconnect transmitter output to receiver input (bytes from peer are still received)
+*@param		enOrDis Enable or disable action
+*@return	None
+*/
+void headless_uart_loopback_ctr(uint8_t enOrDis);
+
+/**
+*@brief		Queue bytes sent by peer, they are received back to back (one per character time)
+*@param		dataPtr Bytes to send
+*@param		length Number of bytes
+*@return	Number of bytes queued (less than length when peer buffer is full)
+*/
+uint32_t headless_uart_inject(const uint8_t *dataPtr, uint32_t length);
+
+/**
+*@brief		Run emulated line
+*@param		numOfCharTimes Number of character times
+*@return	None
+*/
+void headless_uart_run(uint32_t numOfCharTimes);
+
+/**
+*@brief		Get counters of emulated line since last call to headless_uart_reset_stats
+*@param		StatsPtr Pointer to struct receiving counters
+*@return	None
+*/
+void headless_uart_get_stats(Headless_UART_Stats_t *StatsPtr);
+
+/**
+*@brief		Reset counters of emulated line
+*@param		None
+*@return	None
+*/
+void headless_uart_reset_stats(void);
+
+#endif
@@ -0,0 +1,435 @@
+/**
+*@brief Check I2C transaction queue of I2C driver on PC against simulated slaves, including NACK and arbitration loss
+*
+*This program run I2C driver (Peripheral_drivers/src/stm32f407xx_i2c.c) on emulated I2C bus, DMA streams and slaves (headless_i2c.c):
+*a register file sensor (1 byte register address) and an EEPROM (2 bytes memory address, 64 bytes pages).
+*Queued transactions must run in queue order without caller waiting, with their callbacks called once in order: write only, write then
+*read with repeated start or with stop then start, single byte read (NACK and stop set up on ADDR), address probe. Address NACK (absent
+*device) and data NACK must end transaction with I2C_TRANSACTION_NACK and a stop condition, arbitration loss with I2C_TRANSACTION_ARLO
+*and no stop condition, and transaction queued again from callback must succeed once other master released bus. Every read must end
+*with NACK on its last byte. Full queue and interrupt based transfer in progress must refuse transactions. Then sensor and EEPROM are
+*polled every frame for one second at 400KHz: bus usage and interrupts per transaction are printed, interrupts must not depend on
+*number of bytes moved.
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 -DSTM32F407xx -ICMSIS/Include -ICMSIS/Device/ST/STM32F4xx/Include
+*Headless_simulation/i2c_queue_test.c Headless_simulation/headless_i2c.c Peripheral_drivers/src/stm32f407xx_i2c.c -o i2c_queue_test
+*
+*Run:
+*i2c_queue_test
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "headless_i2c.h"
+#include <stdio.h>
+#include <string.h>
+
+#define I2C_TEST_SENSOR_ADDRESS		0x68
+#define I2C_TEST_EEPROM_ADDRESS		0x50
+#define I2C_TEST_ABSENT_ADDRESS		0x20
+#define I2C_TEST_SENSOR_SIZE		128
+#define I2C_TEST_EEPROM_SIZE		4096
+#define I2C_TEST_EEPROM_PAGE_SIZE	64
+#define I2C_TEST_MAX_COMPLETED		64
+#define I2C_TEST_BYTE_TIMES_PER_S	(I2C_FSCL_FM/9)	/*8 data bits and acknowledge*/
+#define I2C_TEST_FRAME_TIME			(I2C_TEST_BYTE_TIMES_PER_S/30)
+
+I2C_Handle_t I2CHandle;
+I2C_Config_t I2CConfig = {.SCLspeed = I2C_FSCL_FM, .deviceAddress = 0x33, .ACKctr = I2C_ACKctr_ENABLE, .FMdutyCycle = I2C_FMduty_2};
+
+uint8_t sensorMemory[I2C_TEST_SENSOR_SIZE];
+uint8_t eepromMemory[I2C_TEST_EEPROM_SIZE];
+Headless_I2C_Slave_t Sensor;
+Headless_I2C_Slave_t Eeprom;
+
+/*transactions given to callback*/
+I2C_Transaction_t *completedPtr[I2C_TEST_MAX_COMPLETED];
+uint8_t completedResult[I2C_TEST_MAX_COMPLETED];
+uint16_t numOfCompleted = 0;
+uint8_t retryOnArbitrationLoss = 0;
+
+uint16_t numOfFailures = 0;
+
+void transaction_callback (I2C_Transaction_t *TransactionPtr, uint8_t result)
+{
+	if(numOfCompleted < I2C_TEST_MAX_COMPLETED){
+		completedPtr[numOfCompleted] = TransactionPtr;
+		completedResult[numOfCompleted] = result;
+	}
+	numOfCompleted++;
+
+	/*lost transaction is queued again from interrupt, it start once other master released bus*/
+	if(result == I2C_TRANSACTION_ARLO && retryOnArbitrationLoss){
+		I2C_queue_transaction(&I2CHandle,TransactionPtr);
+	}
+}
+
+void check_value (const char *namePtr, uint32_t value, uint32_t expected)
+{
+	if(value != expected){
+		printf("FAIL %s: %lu, expected %lu\n",namePtr,(unsigned long)value,(unsigned long)expected);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+void check_true (const char *namePtr, uint8_t condition)
+{
+	if(!condition){
+		printf("FAIL %s\n",namePtr);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+/*reset emulated bus, slaves, I2C driver and collected callbacks*/
+void test_init (void)
+{
+	memset(&I2CHandle,0,sizeof(I2CHandle));
+	headless_i2c_init(&I2CHandle);
+	I2CHandle.I2CxConfigPtr = &I2CConfig;
+	I2C_init(&I2CHandle);
+	I2C_DMA_init(&I2CHandle);
+	I2C_periph_ctr(I2CHandle.I2CxPtr,ENABLE);
+
+	for(uint16_t i = 0; i < I2C_TEST_SENSOR_SIZE; i++){
+		sensorMemory[i] = (uint8_t)(i*3 + 1);
+	}
+	for(uint16_t i = 0; i < I2C_TEST_EEPROM_SIZE; i++){
+		eepromMemory[i] = (uint8_t)(i ^ (i >> 8));
+	}
+
+	memset(&Sensor,0,sizeof(Sensor));
+	Sensor.address = I2C_TEST_SENSOR_ADDRESS;
+	Sensor.memoryPtr = sensorMemory;
+	Sensor.memorySize = I2C_TEST_SENSOR_SIZE;
+	Sensor.addressSize = 1;
+	headless_i2c_add_slave(&Sensor);
+
+	memset(&Eeprom,0,sizeof(Eeprom));
+	Eeprom.address = I2C_TEST_EEPROM_ADDRESS;
+	Eeprom.memoryPtr = eepromMemory;
+	Eeprom.memorySize = I2C_TEST_EEPROM_SIZE;
+	Eeprom.addressSize = 2;
+	Eeprom.pageSize = I2C_TEST_EEPROM_PAGE_SIZE;
+	headless_i2c_add_slave(&Eeprom);
+
+	numOfCompleted = 0;
+	retryOnArbitrationLoss = 0;
+}
+
+void set_transaction (I2C_Transaction_t *TransactionPtr, uint8_t slaveAddr, const uint8_t *txBufferPtr, uint16_t txLength,
+uint8_t *rxBufferPtr, uint16_t rxLength, uint8_t repeatedStart)
+{
+	TransactionPtr->slaveAddr = slaveAddr;
+	TransactionPtr->txBufferPtr = txBufferPtr;
+	TransactionPtr->txLength = txLength;
+	TransactionPtr->rxBufferPtr = rxBufferPtr;
+	TransactionPtr->rxLength = rxLength;
+	TransactionPtr->repeatedStart = repeatedStart;
+	TransactionPtr->callback = transaction_callback;
+	TransactionPtr->contextPtr = NULL;
+}
+
+/*transactions queued back to back run in order, each kind of transaction*/
+void test_queue_order (void)
+{
+	const uint8_t registerWrite[5] = {0x10, 0xA1, 0xB2, 0xC3, 0xD4};
+	const uint8_t registerAddress = 0x10;
+	uint8_t registerRead[4] = {0};
+	uint8_t singleByte = 0;
+	I2C_Transaction_t Write, WriteRead, ReadOne, Probe;
+	Headless_I2C_Stats_t Stats;
+	uint8_t accepted = 0;
+
+	printf("--- queue order\n");
+	test_init();
+	sensorMemory[0x14] = 0x5A;
+
+	set_transaction(&Write,I2C_TEST_SENSOR_ADDRESS,registerWrite,sizeof(registerWrite),NULL,0,I2C_REPEATED_START_DISABLE);
+	set_transaction(&WriteRead,I2C_TEST_SENSOR_ADDRESS,&registerAddress,1,registerRead,sizeof(registerRead),I2C_REPEATED_START_ENABLE);
+	set_transaction(&ReadOne,I2C_TEST_SENSOR_ADDRESS,NULL,0,&singleByte,1,I2C_REPEATED_START_DISABLE);
+	set_transaction(&Probe,I2C_TEST_EEPROM_ADDRESS,NULL,0,NULL,0,I2C_REPEATED_START_DISABLE);
+
+	accepted += (I2C_queue_transaction(&I2CHandle,&Write) == I2C_QUEUE_ACCEPTED);
+	accepted += (I2C_queue_transaction(&I2CHandle,&WriteRead) == I2C_QUEUE_ACCEPTED);
+	accepted += (I2C_queue_transaction(&I2CHandle,&ReadOne) == I2C_QUEUE_ACCEPTED);
+	accepted += (I2C_queue_transaction(&I2CHandle,&Probe) == I2C_QUEUE_ACCEPTED);
+	check_value("transactions accepted",accepted,4);
+	check_true("queue busy after queueing (caller does not wait)",I2C_queue_busy_check(&I2CHandle));
+
+	headless_i2c_run(100);
+	headless_i2c_get_stats(&Stats);
+
+	check_value("callbacks",numOfCompleted,4);
+	check_true("callbacks in queue order",completedPtr[0] == &Write && completedPtr[1] == &WriteRead && completedPtr[2] == &ReadOne
+	&& completedPtr[3] == &Probe);
+	check_true("all results OK",!completedResult[0] && !completedResult[1] && !completedResult[2] && !completedResult[3]);
+	check_true("register written",!memcmp(&sensorMemory[0x10],&registerWrite[1],4));
+	check_true("registers read back",!memcmp(registerRead,&registerWrite[1],4));
+	check_value("single byte read at current address",singleByte,0x5A);
+	check_value("sensor repeated starts",Sensor.numOfRepeatedStarts,1);
+	check_value("sensor stops",Sensor.numOfStops,3);
+	check_value("reads ended by NACK",Sensor.numOfReadsNACKed,2);
+	check_value("reads ended without NACK",Sensor.numOfReadsNotNACKed,0);
+	check_value("probe acknowledged by EEPROM",Eeprom.numOfWrites,1);
+	check_value("probe stopped",Eeprom.numOfStops,1);
+	check_value("no error interrupt",Stats.numOfErrorIRQs,0);
+	check_true("queue idle",!I2C_queue_busy_check(&I2CHandle) && I2CHandle.State == I2C_READY);
+	check_value("event interrupts disabled when idle",I2CHandle.I2CxPtr->CR2 & (I2C_CR2_ITEVTEN | I2C_CR2_ITERREN),0);
+}
+
+/*read after write with stop then start (EEPROM random read), and interrupts independent of length*/
+void test_stop_between (void)
+{
+	const uint8_t memoryAddress[2] = {0x01, 0x20};
+	uint8_t shortRead[4];
+	uint8_t longRead[200];
+	I2C_Transaction_t ShortRead, LongRead;
+	Headless_I2C_Stats_t Stats;
+	uint32_t shortIRQs;
+
+	printf("--- stop between write and read\n");
+	test_init();
+
+	set_transaction(&ShortRead,I2C_TEST_EEPROM_ADDRESS,memoryAddress,2,shortRead,sizeof(shortRead),I2C_REPEATED_START_DISABLE);
+	I2C_queue_transaction(&I2CHandle,&ShortRead);
+	headless_i2c_run(100);
+	headless_i2c_get_stats(&Stats);
+	shortIRQs = Stats.numOfEventIRQs + Stats.numOfErrorIRQs + Stats.numOfRxDMAIRQs + Stats.numOfTxDMAIRQs;
+
+	check_value("result OK",completedResult[0],I2C_TRANSACTION_OK);
+	check_true("data read at memory address",!memcmp(shortRead,&eepromMemory[0x120],sizeof(shortRead)));
+	check_value("EEPROM stops",Eeprom.numOfStops,2);
+	check_value("EEPROM repeated starts",Eeprom.numOfRepeatedStarts,0);
+	check_value("bus stops",Stats.numOfStops,2);
+
+	headless_i2c_reset_stats();
+	set_transaction(&LongRead,I2C_TEST_EEPROM_ADDRESS,memoryAddress,2,longRead,sizeof(longRead),I2C_REPEATED_START_DISABLE);
+	I2C_queue_transaction(&I2CHandle,&LongRead);
+	headless_i2c_run(400);
+	headless_i2c_get_stats(&Stats);
+
+	printf("write 2 + read 4 bytes: %lu interrupts, write 2 + read 200 bytes: %lu interrupts\n",(unsigned long)shortIRQs,
+	(unsigned long)(Stats.numOfEventIRQs + Stats.numOfErrorIRQs + Stats.numOfRxDMAIRQs + Stats.numOfTxDMAIRQs));
+	check_value("long read result OK",completedResult[1],I2C_TRANSACTION_OK);
+	check_true("long read data",!memcmp(longRead,&eepromMemory[0x120],sizeof(longRead)));
+	check_value("interrupts independent of length",Stats.numOfEventIRQs + Stats.numOfErrorIRQs + Stats.numOfRxDMAIRQs + Stats.numOfTxDMAIRQs,
+	shortIRQs);
+	check_value("reads ended by NACK",Eeprom.numOfReadsNACKed,2);
+	check_value("reads ended without NACK",Eeprom.numOfReadsNotNACKed,0);
+}
+
+/*absent or busy device, and data refused by device: transaction fail with NACK and stop, next transaction run*/
+void test_nack (void)
+{
+	const uint8_t registerWrite[6] = {0x40, 1, 2, 3, 4, 5};
+	uint8_t registerRead[3];
+	I2C_Transaction_t Absent, Busy, Refused, RefusedRead, Next;
+	Headless_I2C_Stats_t Stats;
+
+	printf("--- NACK\n");
+	test_init();
+	memset(registerRead,0xEE,sizeof(registerRead));
+
+	set_transaction(&Absent,I2C_TEST_ABSENT_ADDRESS,registerWrite,sizeof(registerWrite),NULL,0,I2C_REPEATED_START_DISABLE);
+	set_transaction(&Next,I2C_TEST_SENSOR_ADDRESS,registerWrite,1,registerRead,sizeof(registerRead),I2C_REPEATED_START_ENABLE);
+	I2C_queue_transaction(&I2CHandle,&Absent);
+	I2C_queue_transaction(&I2CHandle,&Next);
+	headless_i2c_run(100);
+	headless_i2c_get_stats(&Stats);
+
+	check_value("callbacks",numOfCompleted,2);
+	check_value("absent device result",completedResult[0],I2C_TRANSACTION_NACK);
+	check_value("next transaction result",completedResult[1],I2C_TRANSACTION_OK);
+	check_true("next transaction data",!memcmp(registerRead,&sensorMemory[0x40],sizeof(registerRead)));
+	check_value("stop after address NACK",Stats.numOfStops,2);
+	check_value("error interrupts",Stats.numOfErrorIRQs,1);
+
+	/*device busy (e.g. EEPROM write cycle) do not acknowledge its address*/
+	Eeprom.nackAddress = 1;
+	set_transaction(&Busy,I2C_TEST_EEPROM_ADDRESS,NULL,0,NULL,0,I2C_REPEATED_START_DISABLE);
+	I2C_queue_transaction(&I2CHandle,&Busy);
+	headless_i2c_run(20);
+	check_value("busy device result",completedResult[2],I2C_TRANSACTION_NACK);
+	Eeprom.nackAddress = 0;
+
+	/*data refused after 2 bytes: DMA is stopped with bytes left, read phase is not run*/
+	headless_i2c_reset_stats();
+	Sensor.nackAfterBytes = 2;
+	set_transaction(&Refused,I2C_TEST_SENSOR_ADDRESS,registerWrite,sizeof(registerWrite),NULL,0,I2C_REPEATED_START_DISABLE);
+	set_transaction(&RefusedRead,I2C_TEST_SENSOR_ADDRESS,registerWrite,sizeof(registerWrite),registerRead,sizeof(registerRead),
+	I2C_REPEATED_START_ENABLE);
+	I2C_queue_transaction(&I2CHandle,&Refused);
+	I2C_queue_transaction(&I2CHandle,&RefusedRead);
+	headless_i2c_run(100);
+	headless_i2c_get_stats(&Stats);
+
+	check_value("data NACK result",completedResult[3],I2C_TRANSACTION_NACK);
+	check_value("data NACK before read result",completedResult[4],I2C_TRANSACTION_NACK);
+	check_value("bytes acknowledged (register address of first read included)",Sensor.numOfBytesWritten,1 + 2*2);
+	check_value("read phase skipped",Sensor.numOfReads,1);
+	check_value("stops after data NACK",Stats.numOfStops,2);
+	check_true("DMA stopped",I2CHandle.DMAxTxHandlePtr->state == DMA_STATE_READY);
+	check_true("queue idle",!I2C_queue_busy_check(&I2CHandle));
+
+	/*bus recovered*/
+	Sensor.nackAfterBytes = 0;
+	I2C_queue_transaction(&I2CHandle,&Next);
+	headless_i2c_run(50);
+	check_value("transaction after NACK result",completedResult[5],I2C_TRANSACTION_OK);
+}
+
+/*arbitration lost on address: no stop condition, retry from callback once other master released bus*/
+void test_arbitration_loss (void)
+{
+	const uint8_t registerAddress = 0x08;
+	uint8_t registerRead[8];
+	I2C_Transaction_t Lost, Next;
+	Headless_I2C_Stats_t Stats;
+
+	printf("--- arbitration loss\n");
+	test_init();
+
+	/*retried from callback*/
+	retryOnArbitrationLoss = 1;
+	headless_i2c_lose_arbitration(2);
+	set_transaction(&Lost,I2C_TEST_SENSOR_ADDRESS,&registerAddress,1,registerRead,sizeof(registerRead),I2C_REPEATED_START_ENABLE);
+	I2C_queue_transaction(&I2CHandle,&Lost);
+	headless_i2c_run(100);
+	headless_i2c_get_stats(&Stats);
+
+	check_value("callbacks",numOfCompleted,3);
+	check_true("lost twice then OK",completedResult[0] == I2C_TRANSACTION_ARLO && completedResult[1] == I2C_TRANSACTION_ARLO
+	&& completedResult[2] == I2C_TRANSACTION_OK);
+	check_value("arbitration losses",Stats.numOfArbitrationLosses,2);
+	check_value("no stop after arbitration loss",Stats.numOfStops,1);
+	check_true("data read after retry",!memcmp(registerRead,&sensorMemory[0x08],sizeof(registerRead)));
+	check_true("start waited for other master",Stats.numOfByteTimes - Stats.busBusyTime >= 2*HEADLESS_I2C_OTHER_MASTER_TIME);
+
+	/*not retried: failure reported, next transaction run*/
+	retryOnArbitrationLoss = 0;
+	headless_i2c_lose_arbitration(1);
+	set_transaction(&Next,I2C_TEST_SENSOR_ADDRESS,&registerAddress,1,registerRead,sizeof(registerRead),I2C_REPEATED_START_DISABLE);
+	I2C_queue_transaction(&I2CHandle,&Lost);
+	I2C_queue_transaction(&I2CHandle,&Next);
+	headless_i2c_run(100);
+
+	check_value("lost transaction result",completedResult[3],I2C_TRANSACTION_ARLO);
+	check_value("next transaction result",completedResult[4],I2C_TRANSACTION_OK);
+	check_true("queue idle",!I2C_queue_busy_check(&I2CHandle));
+}
+
+/*full queue and interrupt based transfer refuse transactions*/
+void test_queue_full (void)
+{
+	uint8_t registerAddress = 0x00;
+	uint8_t registerRead[I2C_QUEUE_SIZE + 1][2];
+	I2C_Transaction_t Reads[I2C_QUEUE_SIZE + 1];
+	uint8_t accepted = 0;
+	uint8_t allOK = 1;
+
+	printf("--- queue full\n");
+	test_init();
+
+	for(uint8_t i = 0; i <= I2C_QUEUE_SIZE; i++){
+		set_transaction(&Reads[i],I2C_TEST_SENSOR_ADDRESS,&registerAddress,1,registerRead[i],2,I2C_REPEATED_START_ENABLE);
+	}
+
+	for(uint8_t i = 0; i < I2C_QUEUE_SIZE; i++){
+		accepted += (I2C_queue_transaction(&I2CHandle,&Reads[i]) == I2C_QUEUE_ACCEPTED);
+	}
+	check_value("transactions accepted",accepted,I2C_QUEUE_SIZE);
+	check_value("full queue refuse",I2C_queue_transaction(&I2CHandle,&Reads[I2C_QUEUE_SIZE]),I2C_QUEUE_FULL);
+
+	/*slot is free once first transaction finished*/
+	while(!numOfCompleted){
+		headless_i2c_run(1);
+	}
+	check_value("slot free after first callback",I2C_queue_transaction(&I2CHandle,&Reads[I2C_QUEUE_SIZE]),I2C_QUEUE_ACCEPTED);
+	headless_i2c_run(200);
+
+	for(uint8_t i = 0; i <= I2C_QUEUE_SIZE; i++){
+		if(completedPtr[i] != &Reads[i] || completedResult[i] != I2C_TRANSACTION_OK || memcmp(registerRead[i],sensorMemory,2)){
+			allOK = 0;
+		}
+	}
+	check_value("callbacks",numOfCompleted,I2C_QUEUE_SIZE + 1);
+	check_true("all transactions OK in order",allOK);
+
+	/*legacy interrupt based transfer own the peripheral*/
+	I2C_master_send_intrpt(&I2CHandle,&registerAddress,1,I2C_TEST_SENSOR_ADDRESS,I2C_REPEATED_START_DISABLE);
+	check_value("refused during interrupt based transfer",I2C_queue_transaction(&I2CHandle,&Reads[0]),I2C_QUEUE_BUSY);
+}
+
+/*sensor read and EEPROM page written every frame for one second*/
+void test_frame_polling (void)
+{
+	const uint8_t sensorRegister = 0x20;
+	uint8_t sensorData[14];
+	uint8_t pageWrite[2 + 16];
+	I2C_Transaction_t SensorRead, PageWrite;
+	Headless_I2C_Stats_t Stats;
+	uint32_t numOfTransactions = 0;
+	uint32_t numOfBytes = 0;
+	uint32_t numOfRefused = 0;
+	uint32_t IRQs;
+
+	printf("--- polling every frame\n");
+	test_init();
+	set_transaction(&SensorRead,I2C_TEST_SENSOR_ADDRESS,&sensorRegister,1,sensorData,sizeof(sensorData),I2C_REPEATED_START_ENABLE);
+	set_transaction(&PageWrite,I2C_TEST_EEPROM_ADDRESS,pageWrite,sizeof(pageWrite),NULL,0,I2C_REPEATED_START_DISABLE);
+
+	for(uint16_t frame = 0; frame < 30; frame++){
+		/*frame loop queue its transactions and go on at once, buffers are reused only after previous frame's transactions finished*/
+		pageWrite[0] = (uint8_t)((frame*16) >> 8);
+		pageWrite[1] = (uint8_t)(frame*16);
+		memset(&pageWrite[2],frame,16);
+
+		numOfRefused += (I2C_queue_transaction(&I2CHandle,&SensorRead) != I2C_QUEUE_ACCEPTED);
+		numOfRefused += (I2C_queue_transaction(&I2CHandle,&PageWrite) != I2C_QUEUE_ACCEPTED);
+		numOfTransactions += 2;
+		numOfBytes += 1 + sizeof(sensorData) + sizeof(pageWrite);
+
+		headless_i2c_run(I2C_TEST_FRAME_TIME);
+	}
+
+	headless_i2c_get_stats(&Stats);
+	IRQs = Stats.numOfEventIRQs + Stats.numOfErrorIRQs + Stats.numOfRxDMAIRQs + Stats.numOfTxDMAIRQs;
+
+	printf("%lu transactions (%lu data bytes) in 1 s at 400KHz: bus used %lu.%lu%%, %lu interrupts (%lu.%lu per transaction, "
+	"%lu with one interrupt per byte)\n",(unsigned long)numOfTransactions,(unsigned long)numOfBytes,
+	(unsigned long)(Stats.busBusyTime*100/Stats.numOfByteTimes),(unsigned long)(Stats.busBusyTime*1000/Stats.numOfByteTimes%10),
+	(unsigned long)IRQs,(unsigned long)(IRQs/numOfTransactions),(unsigned long)(IRQs*10/numOfTransactions%10),
+	(unsigned long)(numOfBytes + 3*numOfTransactions));
+
+	check_value("transactions refused",numOfRefused,0);
+	check_value("callbacks",numOfCompleted,numOfTransactions);
+	check_true("sensor data",!memcmp(sensorData,&sensorMemory[0x20],sizeof(sensorData)));
+	check_value("last page written",eepromMemory[29*16 + 15],29);
+	check_true("interrupts per transaction below 6",IRQs <= 6*numOfTransactions);
+	check_value("reads ended without NACK",Sensor.numOfReadsNotNACKed,0);
+}
+
+int main (void)
+{
+	test_queue_order();
+	test_stop_between();
+	test_nack();
+	test_arbitration_loss();
+	test_queue_full();
+	test_frame_polling();
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
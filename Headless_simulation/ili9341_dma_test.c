@@ -0,0 +1,301 @@
+/**
+*@brief Check asynchronous pixel transfers of ILI9341 driver with DMA transfer complete interrupts raised one at a time
+*
+*This program run real ILI9341 driver (Device_drivers/src/ili9341.c) on emulated panel (headless_lcd.c) with DMA transfers left
+*waiting until the test raise their transfer complete interrupt, so that state machine of driver (ILI9341_send_fill_chunk and
+*ILI9341_transfer_continue) is stepped one DMA transfer at a time:
+*- fill areas larger than one DMA transfer are split in chunks of at most 65535 pixels, next chunk is started by interrupt only
+*- address window (column address, page address) is sent before memory write command, and pixels follow it
+*- pixels sent by DMA (16 bits data frames) have same byte order as pixel sent by synchronous SPI write (ILI9341_draw_pixel)
+*- monochrome image rows sent from ping-pong line buffers give same pixels as image drawn pixel by pixel
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 -DSTM32F407xx -DHEADLESS_USE_ILI9341_DRIVER -ICMSIS/Include -ICMSIS/Device/ST/STM32F4xx/Include
+*Headless_simulation/ili9341_dma_test.c Headless_simulation/headless_lcd.c Device_drivers/src/ili9341.c
+*Miscellaneous/src/tm_stm32f4_fonts.c -o ili9341_dma_test
+*
+*Run:
+*ili9341_dma_test
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "headless_lcd.h"
+#include "../Device_drivers/inc/ili9341.h"
+#include <stdio.h>
+#include <string.h>
+
+#define DMA_TEST_CLEAR_COLOR	0x0000
+#define DMA_TEST_COLOR			0xF00F	/*different high and low byte*/
+#define DMA_TEST_MAX_CHUNK		65535
+#define DMA_TEST_MAX_OUTPUTS	200000
+#define DMA_TEST_MAX_TRANSFERS	64
+
+extern ILI9341_Config_t ILI9341_config;
+
+uint16_t output[DMA_TEST_MAX_OUTPUTS];
+Headless_LCD_DMA_Transfer_t transfer[DMA_TEST_MAX_TRANSFERS];
+uint16_t numOfFailures = 0;
+
+/*16 x 5 image, MSB of each byte is leftmost pixel*/
+const uint8_t testImage[] = {
+	0xF0,0x0F,
+	0x81,0x81,
+	0xAA,0x55,
+	0x00,0xFF,
+	0x3C,0xC3,
+};
+
+void check_value (const char *namePtr, uint32_t value, uint32_t expected)
+{
+	if(value != expected){
+		printf("FAIL %s: %lu, expected %lu\n",namePtr,(unsigned long)value,(unsigned long)expected);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+void check_true (const char *namePtr, uint8_t condition)
+{
+	if(!condition){
+		printf("FAIL %s\n",namePtr);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+/*number of pixels of area with different color*/
+uint32_t count_wrong_pixels (uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+	uint32_t numOfWrongPixels = 0;
+
+	for(uint16_t y = y0; y <= y1; y++){
+		for(uint16_t x = x0; x <= x1; x++){
+			if(headless_lcd_get_pixel(x,y) != color){
+				numOfWrongPixels++;
+			}
+		}
+	}
+
+	return numOfWrongPixels;
+}
+
+/*start recording a new drawing on cleared panel*/
+void start_drawing (void)
+{
+	headless_lcd_clear(DMA_TEST_CLEAR_COLOR);
+	headless_lcd_set_output(output,DMA_TEST_MAX_OUTPUTS);
+	headless_lcd_set_DMA_log(transfer,DMA_TEST_MAX_TRANSFERS);
+}
+
+/*check that recorded bytes start with address window and memory write command, return index of first pixel byte*/
+uint32_t check_window (const char *namePtr, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+	const uint16_t expected[] = {
+		ILI9341_COLUMN_ADDR,
+		HEADLESS_LCD_DATA_BYTE | (x0 >> 8),HEADLESS_LCD_DATA_BYTE | (x0 & 0xFF),
+		HEADLESS_LCD_DATA_BYTE | (x1 >> 8),HEADLESS_LCD_DATA_BYTE | (x1 & 0xFF),
+		ILI9341_PAGE_ADDR,
+		HEADLESS_LCD_DATA_BYTE | (y0 >> 8),HEADLESS_LCD_DATA_BYTE | (y0 & 0xFF),
+		HEADLESS_LCD_DATA_BYTE | (y1 >> 8),HEADLESS_LCD_DATA_BYTE | (y1 & 0xFF),
+		ILI9341_MEM_WRITE,
+	};
+	char name[80];
+
+	snprintf(name,sizeof(name),"%s: window and memory write command",namePtr);
+	check_true(name,headless_lcd_get_num_of_outputs() >= sizeof(expected)/sizeof(expected[0])
+		&& memcmp(output,expected,sizeof(expected)) == 0);
+
+	return sizeof(expected)/sizeof(expected[0]);
+}
+
+/*bytes of one pixel sent by synchronous SPI write (last 2 bytes sent by ILI9341_draw_pixel)*/
+void get_synchronous_pixel_bytes (uint16_t color, uint16_t *bytePtr)
+{
+	start_drawing();
+	ILI9341_draw_pixel(0,0,color);
+
+	bytePtr[0] = output[headless_lcd_get_num_of_outputs() - 2];
+	bytePtr[1] = output[headless_lcd_get_num_of_outputs() - 1];
+}
+
+/*fill area with DMA_TEST_COLOR, interrupt is raised once per transfer and chunks are checked*/
+void check_fill (const char *namePtr, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+	uint32_t numOfPixels = (uint32_t)(x1 - x0 + 1)*(y1 - y0 + 1);
+	uint32_t numOfChunks = (numOfPixels + DMA_TEST_MAX_CHUNK - 1)/DMA_TEST_MAX_CHUNK;
+	uint32_t numOfWrongChunks = 0;
+	uint32_t numOfWrongBytes = 0;
+	uint32_t firstPixelByte;
+	uint16_t pixelBytes[2];
+	char name[80];
+
+	get_synchronous_pixel_bytes(DMA_TEST_COLOR,pixelBytes);
+
+	start_drawing();
+	ILI9341_draw_filled_rectangle(x0,y0,x1,y1,DMA_TEST_COLOR);
+
+	/*driver return as soon as first chunk is handed to DMA, nothing is sent yet*/
+	snprintf(name,sizeof(name),"%s: busy after first chunk is started",namePtr);
+	check_true(name,ILI9341_busy_check() == TRUE);
+	snprintf(name,sizeof(name),"%s: no pixel before first interrupt",namePtr);
+	check_value(name,headless_lcd_get_pixels_written(),0);
+
+	for(uint32_t chunk = 0; chunk < numOfChunks; chunk++){
+		uint32_t expectedCount = (chunk == numOfChunks - 1) ? numOfPixels - chunk*DMA_TEST_MAX_CHUNK : DMA_TEST_MAX_CHUNK;
+
+		/*chunk is started before its interrupt, next chunk only by interrupt of this one*/
+		if(headless_lcd_get_num_of_DMA_transfers() != chunk + 1 || transfer[chunk].count != expectedCount
+			|| transfer[chunk].dataFrame != SPI_DATA_16BITS || transfer[chunk].memInc != DISABLE){
+			numOfWrongChunks++;
+		}
+
+		headless_lcd_complete_DMA();
+
+		if(headless_lcd_get_pixels_written() != chunk*DMA_TEST_MAX_CHUNK + expectedCount){
+			numOfWrongChunks++;
+		}
+	}
+
+	snprintf(name,sizeof(name),"%s: %lu chunks of at most 65535 pixels",namePtr,(unsigned long)numOfChunks);
+	check_value(name,numOfWrongChunks,0);
+	snprintf(name,sizeof(name),"%s: no transfer after last chunk",namePtr);
+	check_true(name,headless_lcd_complete_DMA() == 0 && headless_lcd_get_num_of_DMA_transfers() == numOfChunks);
+	snprintf(name,sizeof(name),"%s: ready after last interrupt",namePtr);
+	check_true(name,ILI9341_busy_check() == FALSE);
+
+	firstPixelByte = check_window(namePtr,x0,y0,x1,y1);
+
+	snprintf(name,sizeof(name),"%s: number of bytes",namePtr);
+	check_value(name,headless_lcd_get_num_of_outputs(),firstPixelByte + 2*numOfPixels);
+
+	for(uint32_t i = 0; i < numOfPixels; i++){
+		if(output[firstPixelByte + 2*i] != pixelBytes[0] || output[firstPixelByte + 2*i + 1] != pixelBytes[1]){
+			numOfWrongBytes++;
+		}
+	}
+
+	snprintf(name,sizeof(name),"%s: byte order of synchronous write",namePtr);
+	check_value(name,numOfWrongBytes,0);
+	snprintf(name,sizeof(name),"%s: area filled",namePtr);
+	check_value(name,count_wrong_pixels(x0,y0,x1,y1,DMA_TEST_COLOR),0);
+
+	if(y1 + 1 < ILI9341_config.height){
+		snprintf(name,sizeof(name),"%s: row below area untouched",namePtr);
+		check_value(name,count_wrong_pixels(x0,y1 + 1,x1,y1 + 1,DMA_TEST_CLEAR_COLOR),0);
+	}
+}
+
+void test_fill (void)
+{
+	uint16_t width = ILI9341_config.width;
+	uint16_t height = ILI9341_config.height;
+	uint16_t rowsInChunk = DMA_TEST_MAX_CHUNK/width;
+
+	printf("-- fill %ux%u\n",width,height);
+
+	check_fill("small area",10,20,40,50);
+	check_fill("largest single chunk",0,0,width - 1,rowsInChunk - 1);
+	check_fill("one row over single chunk",0,0,width - 1,rowsInChunk);
+	check_fill("whole screen",0,0,width - 1,height - 1);
+
+	/*ILI9341_fill_display take same path*/
+	start_drawing();
+	ILI9341_fill_display(DMA_TEST_COLOR);
+	while(headless_lcd_complete_DMA());
+	check_value("fill display: transfers",headless_lcd_get_num_of_DMA_transfers(),((uint32_t)width*height + DMA_TEST_MAX_CHUNK - 1)/DMA_TEST_MAX_CHUNK);
+	check_value("fill display: screen filled",count_wrong_pixels(0,0,width - 1,height - 1,DMA_TEST_COLOR),0);
+}
+
+void test_bitmap (void)
+{
+	const uint16_t x = 100, y = 60, w = 16, h = sizeof(testImage)/2;
+	const uint16_t background = 0x001F;
+	uint32_t numOfWrongRows = 0;
+	uint32_t numOfDifferences = 0;
+	uint16_t image[sizeof(testImage)/2][16];
+
+	printf("-- image with background\n");
+
+	/*reference: image drawn pixel by pixel with synchronous writes over background*/
+	headless_lcd_DMA_mode(HEADLESS_LCD_DMA_AT_ONCE);
+	start_drawing();
+	ILI9341_draw_filled_rectangle(x,y,x + w - 1,y + h - 1,background);
+	ILI9341_draw_bitmap(x,y,testImage,w,h,DMA_TEST_COLOR);
+
+	for(uint16_t i = 0; i < h; i++){
+		for(uint16_t j = 0; j < w; j++){
+			image[i][j] = headless_lcd_get_pixel(x + j,y + i);
+		}
+	}
+
+	headless_lcd_DMA_mode(HEADLESS_LCD_DMA_ON_REQUEST);
+	start_drawing();
+	ILI9341_draw_bitmap_w_background(x,y,testImage,w,h,DMA_TEST_COLOR,background);
+
+	/*one row per transfer from line buffers, next row started by interrupt of previous one*/
+	for(uint16_t row = 0; row < h; row++){
+		if(headless_lcd_get_num_of_DMA_transfers() != row + 1 || transfer[row].count != w
+			|| transfer[row].dataFrame != SPI_DATA_16BITS || transfer[row].memInc != ENABLE){
+			numOfWrongRows++;
+		}
+
+		headless_lcd_complete_DMA();
+	}
+
+	check_value("image: one transfer per row",numOfWrongRows,0);
+	check_true("image: ready after last row",headless_lcd_complete_DMA() == 0 && ILI9341_busy_check() == FALSE);
+	check_value("image: number of bytes",headless_lcd_get_num_of_outputs(),check_window("image",x,y,x + w - 1,y + h - 1) + 2*w*h);
+
+	for(uint16_t i = 0; i < h; i++){
+		for(uint16_t j = 0; j < w; j++){
+			if(headless_lcd_get_pixel(x + j,y + i) != image[i][j]){
+				numOfDifferences++;
+			}
+		}
+	}
+
+	check_value("image: same pixels as synchronous drawing",numOfDifferences,0);
+}
+
+/***********************************************************************
+Stub: RCC and DWT drivers (used by ILI9341 driver for SPI clock and transfer time stamp, game engine stubs are not linked)
+***********************************************************************/
+int32_t RCC_get_PCLK_value(uint8_t APBx)
+{
+	return 84000000;
+}
+
+uint8_t RCC_get_SPI_prescaler(uint32_t PCLK, uint32_t maxSCLK)
+{
+	return 0;
+}
+
+uint32_t DWT_get_cycle_count(void)
+{
+	return 0;
+}
+
+int main (void)
+{
+	headless_lcd_clear(DMA_TEST_CLEAR_COLOR);
+	ILI9341_init();
+	headless_lcd_DMA_mode(HEADLESS_LCD_DMA_ON_REQUEST);
+
+	test_fill();
+	ILI9341_rotate(ILI9341_orientation_landscape_1);
+	test_fill();
+	test_bitmap();
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
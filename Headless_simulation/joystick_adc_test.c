@@ -0,0 +1,530 @@
+/**
+*@brief Check joystick driver reading ADC scans from DMA buffer on PC and estimate CPU cycles saved per frame
+*
+*This program run joystick driver (Device_drivers/src/joystick.c, built with JOYSTICK_USE_DMA) with stub ADC driver emulating
+*scan of regular sequence in continuous mode and DMA transfer of each conversion into circular buffer. Analog voltage of X and Y
+*axes (with optional noise) is set by test, then conversions are emulated and joystick is read: ADC configuration (sequence,
+*continuous mode, sampling time, buffer size), position and direction of each joystick direction, centered joystick before first
+*scan, averaging of JOYSTICK_OVERSAMPLING latest scans (noise), restart on second joystick_init and stop on joystick_deinit are checked.
+*Analog vector is checked next: center captured by joystick_calibrate at off-center rest position, radial dead zone, full deflection
+*and proportional magnitude, angle, and center following slow drift of rest position (which would leave dead zone without tracking).
+*fast_atan2 is compared with atan2 of math library over a grid (error below 1.5 binary angle) and fast_sqrt with exact square root.
+*Then CPU cycles waited per frame by previous joystick_read_direction (2 conversions started and polled with ADC_read) are computed
+*from ADC conversion time and clock tree, and compared with time spent reading DMA buffer (measured on PC).
+*Test_applications/test_joystick_dma_benchmark.c measure both on target with DWT cycle counter.
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 -DSTM32F407xx -ICMSIS/Include -ICMSIS/Device/ST/STM32F4xx/Include
+*Headless_simulation/joystick_adc_test.c Device_drivers/src/joystick.c Miscellaneous/src/fast_math.c -lm -o joystick_adc_test
+*
+*Run:
+*joystick_adc_test
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../Device_drivers/inc/joystick.h"
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define ADC_TEST_HCLK			84000000UL
+#define ADC_TEST_ADCCLK			21000000UL	/*PCLK2 (42MHz) divided by 2 (ADC_CCR reset value)*/
+#define ADC_TEST_NOISE_READS	4096
+#define ADC_TEST_BENCHMARK_READS	(1024*1024)
+#define ADC_TEST_REST_X			2150		/*rest position away from JOYSTICK_POS_CENTER*/
+#define ADC_TEST_REST_Y			1950
+#define ADC_TEST_DRIFT			300			/*drift of rest position, out of dead zone without tracking*/
+#define ADC_TEST_DRIFT_READS	3000
+
+#ifndef JOYSTICK_USE_DMA
+#error joystick_adc_test check joystick driver built with JOYSTICK_USE_DMA
+#endif
+
+/*emulated ADC: sequence converted one channel after the other, each conversion written to next element of circular DMA buffer*/
+typedef struct{
+	ADC_Config_t config;
+	uint8_t sequence[ADC_MAX_CONVERSIONS];
+	uint8_t sequenceIndex;
+	volatile uint16_t *bufferPtr;
+	uint16_t count;
+	uint16_t position;
+	uint8_t converting;
+	uint8_t numOfStarts;
+}Headless_ADC_t;
+
+Headless_ADC_t headlessADC;
+
+/*analog input of each channel in 12 bits digital number, uniform noise of +/- noiseAmplitude is added to each conversion*/
+double analogInput[ADC_MAX_CONVERSIONS];
+double noiseAmplitude = 0;
+uint32_t noiseState = 12345;
+
+extern int32_t joystickCenter[2];
+
+uint32_t numOfPolledConversions = 0;
+uint16_t numOfFailures = 0;
+
+/*stub ADC driver*/
+uint16_t headless_adc_convert (uint8_t channel)
+{
+	double value = analogInput[channel];
+
+	if(noiseAmplitude > 0){
+		noiseState ^= noiseState << 13;
+		noiseState ^= noiseState >> 17;
+		noiseState ^= noiseState << 5;
+		value += noiseAmplitude * (2.0*noiseState/4294967295.0 - 1.0);
+	}
+
+	value = (value < 0) ? 0 : (value > 4095) ? 4095 : value;
+	return (uint16_t)lround(value);
+}
+
+void ADC_init_channel(ADC_TypeDef *ADCxPtr,uint8_t ADC_channel_x)
+{
+}
+
+void ADC_init(ADC_Handle_t *ADCxHandlePtr)
+{
+	headlessADC.config = *ADCxHandlePtr->ADCxConfigPtr;
+
+	for(uint8_t i = 0; i < headlessADC.config.numOfConversion && i < ADC_MAX_CONVERSIONS; i++){
+		headlessADC.sequence[i] = headlessADC.config.sequencePtr[i];
+	}
+}
+
+void ADC_DMA_init(ADC_Handle_t *ADCxHandlePtr)
+{
+}
+
+void ADC_start_DMA(ADC_Handle_t *ADCxHandlePtr, volatile uint16_t *bufferPtr, uint16_t count)
+{
+	headlessADC.bufferPtr = bufferPtr;
+	headlessADC.count = count;
+	headlessADC.position = 0;
+	headlessADC.sequenceIndex = 0;
+	headlessADC.converting = 1;
+	headlessADC.numOfStarts++;
+}
+
+void ADC_stop_DMA(ADC_Handle_t *ADCxHandlePtr)
+{
+	headlessADC.converting = 0;
+}
+
+void ADC_deinit(void)
+{
+}
+
+uint16_t ADC_read(ADC_TypeDef *ADCxPtr, uint8_t channel)
+{
+	numOfPolledConversions++;
+	return headless_adc_convert(channel);
+}
+
+/*emulate conversions of running scan, each one is moved to buffer by DMA*/
+void headless_adc_scan (uint32_t numOfScans)
+{
+	if(!headlessADC.converting){
+		return;
+	}
+
+	for(uint32_t i = 0; i < numOfScans*headlessADC.config.numOfConversion; i++){
+		headlessADC.bufferPtr[headlessADC.position] = headless_adc_convert(headlessADC.sequence[headlessADC.sequenceIndex]);
+		headlessADC.position = (headlessADC.position + 1) % headlessADC.count;
+		headlessADC.sequenceIndex = (headlessADC.sequenceIndex + 1) % headlessADC.config.numOfConversion;
+
+		/*single conversion mode stop at end of sequence*/
+		if(!headlessADC.config.conversionMode && !headlessADC.sequenceIndex){
+			headlessADC.converting = 0;
+			return;
+		}
+	}
+}
+
+void check_value (const char *namePtr, uint32_t value, uint32_t expected)
+{
+	if(value != expected){
+		printf("FAIL %s: %lu, expected %lu\n",namePtr,(unsigned long)value,(unsigned long)expected);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+void set_joystick (double xPos, double yPos)
+{
+	analogInput[ADC_CHANNEL_5] = xPos;
+	analogInput[ADC_CHANNEL_7] = yPos;
+}
+
+void test_configuration (void)
+{
+	uint16_t xPos, yPos;
+
+	joystick_init(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7);
+	check_value("sequence of 2 conversions",headlessADC.config.numOfConversion,2);
+	check_value("X axis converted first",headlessADC.sequence[0],ADC_CHANNEL_5);
+	check_value("Y axis converted second",headlessADC.sequence[1],ADC_CHANNEL_7);
+	check_value("continuous conversions",headlessADC.config.conversionMode,ADC_CVSMODE_CONT);
+	check_value("sampling time",headlessADC.config.sampleTime,JOYSTICK_SAMPLE_TIME);
+	check_value("DMA buffer hold JOYSTICK_OVERSAMPLING scans",headlessADC.count,2*JOYSTICK_OVERSAMPLING);
+	check_value("conversions started",headlessADC.converting,1);
+
+	/*nothing converted yet*/
+	set_joystick(0,0);
+	joystick_read_position(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7,&xPos,&yPos);
+	check_value("X centered before first scan",xPos,JOYSTICK_POS_CENTER);
+	check_value("Y centered before first scan",yPos,JOYSTICK_POS_CENTER);
+	check_value("direction centered before first scan",joystick_read_direction(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7),JS_DIR_CENTERED);
+	check_value("no conversion waited for",numOfPolledConversions,0);
+
+	/*each axis land in its own element of scan*/
+	set_joystick(100,4000);
+	headless_adc_scan(JOYSTICK_OVERSAMPLING);
+	joystick_read_position(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7,&xPos,&yPos);
+	check_value("X position from buffer",xPos,100);
+	check_value("Y position from buffer",yPos,4000);
+}
+
+void test_directions (void)
+{
+	const struct{
+		double xPos, yPos;
+		uint8_t direction;
+	}testDirection[] = {
+		{500,3500,JS_DIR_LEFT_UP},{500,500,JS_DIR_LEFT_DOWN},{500,2000,JS_DIR_LEFT},
+		{3500,3500,JS_DIR_RIGHT_UP},{3500,500,JS_DIR_RIGHT_DOWN},{3500,2000,JS_DIR_RIGHT},
+		{2075,3500,JS_DIR_UP},{2075,500,JS_DIR_DOWN},{2075,2000,JS_DIR_CENTERED},
+	};
+	uint8_t numOfErrors = 0, numOfLateErrors = 0;
+
+	for(uint8_t i = 0; i < sizeof(testDirection)/sizeof(testDirection[0]); i++){
+		set_joystick(testDirection[i].xPos,testDirection[i].yPos);
+
+		/*average follow joystick within JOYSTICK_OVERSAMPLING scans*/
+		headless_adc_scan(JOYSTICK_OVERSAMPLING);
+		if(joystick_read_direction(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7) != testDirection[i].direction){
+			numOfErrors++;
+		}
+
+		/*joystick moved back to center is seen after enough scans*/
+		set_joystick(2075,2000);
+		headless_adc_scan(JOYSTICK_OVERSAMPLING);
+		if(joystick_read_direction(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7) != JS_DIR_CENTERED){
+			numOfLateErrors++;
+		}
+	}
+
+	check_value("every direction read from scans",numOfErrors,0);
+	check_value("return to center read from scans",numOfLateErrors,0);
+}
+
+/*standard deviation of X position over reads, one new scan between reads*/
+double position_deviation (uint8_t averaged)
+{
+	double sum = 0, sumOfSquares = 0;
+
+	for(uint32_t i = 0; i < ADC_TEST_NOISE_READS; i++){
+		uint16_t xPos, yPos;
+
+		headless_adc_scan(1);
+		if(averaged){
+			joystick_read_position(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7,&xPos,&yPos);
+		}else{
+			xPos = headlessADC.bufferPtr[(headlessADC.position + headlessADC.count - 2) % headlessADC.count];
+		}
+		sum += xPos;
+		sumOfSquares += (double)xPos*xPos;
+	}
+
+	return sqrt(sumOfSquares/ADC_TEST_NOISE_READS - (sum/ADC_TEST_NOISE_READS)*(sum/ADC_TEST_NOISE_READS));
+}
+
+void test_oversampling (void)
+{
+	double single, averaged;
+
+	set_joystick(2000,2000);
+	noiseAmplitude = 40;
+	headless_adc_scan(JOYSTICK_OVERSAMPLING);
+	single = position_deviation(0);
+	averaged = position_deviation(1);
+	noiseAmplitude = 0;
+
+	printf("noise of X position: %.2f LSB for one conversion, %.2f LSB for average of %u scans\n",single,averaged,JOYSTICK_OVERSAMPLING);
+	check_value("averaging reduce noise by sqrt(JOYSTICK_OVERSAMPLING) (within 20%)",
+			fabs(averaged*sqrt(JOYSTICK_OVERSAMPLING)/single - 1) < 0.2,1);
+}
+
+void test_restart (void)
+{
+	uint8_t numOfStarts = headlessADC.numOfStarts;
+
+	joystick_init(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7);
+	check_value("second joystick_init restart conversions",headlessADC.numOfStarts,numOfStarts + 1);
+	check_value("conversions running after restart",headlessADC.converting,1);
+
+	joystick_deinit(ADC1);
+	check_value("joystick_deinit stop conversions",headlessADC.converting,0);
+	joystick_init(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7);
+}
+
+/*offset of position from rest position in Q14 of distance to full deflection (same span as driver)*/
+double expected_normalized (double position, double center)
+{
+	double span = (position >= center) ? (JOYSTICK_POS_MAX - center) : center;
+
+	span -= JOYSTICK_RAIL_MARGIN;
+	return (position - center)*JOYSTICK_VECTOR_ONE/span;
+}
+
+/*difference of binary angles, wrapped around a turn*/
+int32_t angle_error (uint16_t angle, double expected)
+{
+	int32_t difference = (int32_t)angle - (int32_t)lround(expected);
+
+	difference %= (int32_t)FAST_MATH_ANGLE_TURN;
+	if(difference > FAST_MATH_ANGLE_HALF){
+		difference -= FAST_MATH_ANGLE_TURN;
+	}else if(difference < -FAST_MATH_ANGLE_HALF){
+		difference += FAST_MATH_ANGLE_TURN;
+	}
+	return difference;
+}
+
+Joystick_Vector_t read_vector_at (double xPos, double yPos)
+{
+	Joystick_Vector_t Vector;
+
+	set_joystick(xPos,yPos);
+	headless_adc_scan(JOYSTICK_OVERSAMPLING);
+	joystick_read_vector(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7,&Vector);
+	return Vector;
+}
+
+void test_vector (void)
+{
+	const struct{
+		double xPos, yPos;
+		uint16_t angle;
+	}testDeflection[] = {
+		{JOYSTICK_POS_MAX,ADC_TEST_REST_Y,0},{JOYSTICK_POS_MAX,JOYSTICK_POS_MAX,FAST_MATH_ANGLE_QUARTER/2},
+		{ADC_TEST_REST_X,JOYSTICK_POS_MAX,FAST_MATH_ANGLE_QUARTER},{0,JOYSTICK_POS_MAX,3*FAST_MATH_ANGLE_QUARTER/2},
+		{0,ADC_TEST_REST_Y,FAST_MATH_ANGLE_HALF},{0,0,5*FAST_MATH_ANGLE_QUARTER/2},
+		{ADC_TEST_REST_X,0,3*FAST_MATH_ANGLE_QUARTER},{JOYSTICK_POS_MAX,0,7*FAST_MATH_ANGLE_QUARTER/2},
+	};
+	Joystick_Vector_t Vector;
+	uint8_t numOfErrors = 0;
+	int32_t maxMagnitudeError = 0, maxAngleError = 0;
+
+	/*rest position captured at boot*/
+	set_joystick(ADC_TEST_REST_X,ADC_TEST_REST_Y);
+	headless_adc_scan(JOYSTICK_OVERSAMPLING);
+	joystick_calibrate(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7);
+	check_value("X center captured at rest",joystickCenter[0],ADC_TEST_REST_X << 4);
+	check_value("Y center captured at rest",joystickCenter[1],ADC_TEST_REST_Y << 4);
+
+	Vector = read_vector_at(ADC_TEST_REST_X,ADC_TEST_REST_Y);
+	check_value("vector at rest is 0",(uint16_t)Vector.x | (uint16_t)Vector.y | Vector.magnitude,0);
+
+	/*offset inside dead zone on every side*/
+	for(uint8_t i = 0; i < 8; i++){
+		double radius = 0.95*JOYSTICK_DEAD_ZONE*(JOYSTICK_POS_MAX - ADC_TEST_REST_X - JOYSTICK_RAIL_MARGIN)/JOYSTICK_VECTOR_ONE;
+
+		Vector = read_vector_at(ADC_TEST_REST_X + radius*cos(i*M_PI/4),ADC_TEST_REST_Y + radius*sin(i*M_PI/4));
+		if(Vector.magnitude){
+			numOfErrors++;
+		}
+		read_vector_at(ADC_TEST_REST_X,ADC_TEST_REST_Y);
+		joystick_calibrate(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7);
+	}
+	check_value("vector inside dead zone is 0",numOfErrors,0);
+
+	/*full deflection along 8 directions, corners are brought back on circle*/
+	numOfErrors = 0;
+	for(uint8_t i = 0; i < sizeof(testDeflection)/sizeof(testDeflection[0]); i++){
+		Vector = read_vector_at(testDeflection[i].xPos,testDeflection[i].yPos);
+		if(Vector.magnitude != JOYSTICK_VECTOR_ONE || abs(angle_error(Vector.angle,testDeflection[i].angle)) > 1){
+			printf("deflection %u: magnitude %u angle %u\n",i,Vector.magnitude,Vector.angle);
+			numOfErrors++;
+		}
+	}
+	check_value("full deflection give magnitude JOYSTICK_VECTOR_ONE along its direction",numOfErrors,0);
+
+	/*magnitude rise from 0 at edge of dead zone to JOYSTICK_VECTOR_ONE, angle between positions of each side*/
+	for(uint16_t step = 0; step <= 64; step++){
+		double fraction = step/64.0;
+		double xPos = round(ADC_TEST_REST_X + fraction*(JOYSTICK_POS_MAX - JOYSTICK_RAIL_MARGIN - ADC_TEST_REST_X)*0.6);
+		double yPos = round(ADC_TEST_REST_Y - fraction*(ADC_TEST_REST_Y - JOYSTICK_RAIL_MARGIN)*0.8);
+		double xNormalized = expected_normalized(xPos,ADC_TEST_REST_X);
+		double yNormalized = expected_normalized(yPos,ADC_TEST_REST_Y);
+		double radius = sqrt(xNormalized*xNormalized + yNormalized*yNormalized);
+		double magnitude = (radius <= JOYSTICK_DEAD_ZONE) ? 0 :
+				(fmin(radius,JOYSTICK_VECTOR_ONE) - JOYSTICK_DEAD_ZONE)*JOYSTICK_VECTOR_ONE/(JOYSTICK_VECTOR_ONE - JOYSTICK_DEAD_ZONE);
+
+		/*positions inside dead zone move center, start each step from rest*/
+		read_vector_at(ADC_TEST_REST_X,ADC_TEST_REST_Y);
+		joystick_calibrate(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7);
+		Vector = read_vector_at(xPos,yPos);
+		if(abs((int32_t)Vector.magnitude - (int32_t)lround(magnitude)) > maxMagnitudeError){
+			maxMagnitudeError = abs((int32_t)Vector.magnitude - (int32_t)lround(magnitude));
+		}
+		if(magnitude > 0 && abs(angle_error(Vector.angle,atan2(yNormalized,xNormalized)*FAST_MATH_ANGLE_TURN/(2*M_PI))) > maxAngleError){
+			maxAngleError = abs(angle_error(Vector.angle,atan2(yNormalized,xNormalized)*FAST_MATH_ANGLE_TURN/(2*M_PI)));
+		}
+	}
+	printf("proportional deflection: magnitude error %ld (Q14), angle error %ld binary angle\n",(long)maxMagnitudeError,(long)maxAngleError);
+	check_value("magnitude proportional to deflection out of dead zone (within 4)",maxMagnitudeError <= 4,1);
+	check_value("angle of deflection (within 4 binary angle)",maxAngleError <= 4,1);
+}
+
+void test_drift (void)
+{
+	Joystick_Vector_t Vector;
+	uint16_t numOfMoves = 0;
+
+	set_joystick(ADC_TEST_REST_X,ADC_TEST_REST_Y);
+	headless_adc_scan(JOYSTICK_OVERSAMPLING);
+	joystick_calibrate(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7);
+
+	/*rest position drift slowly (temperature), joystick is never pushed*/
+	for(uint16_t i = 1; i <= ADC_TEST_DRIFT_READS; i++){
+		Vector = read_vector_at(ADC_TEST_REST_X + (double)ADC_TEST_DRIFT*i/ADC_TEST_DRIFT_READS,
+				ADC_TEST_REST_Y - (double)ADC_TEST_DRIFT*i/ADC_TEST_DRIFT_READS);
+		if(Vector.magnitude){
+			numOfMoves++;
+		}
+	}
+
+	/*center lag behind drifting rest position, then settle*/
+	for(uint16_t i = 0; i < ADC_TEST_DRIFT_READS/10; i++){
+		Vector = read_vector_at(ADC_TEST_REST_X + ADC_TEST_DRIFT,ADC_TEST_REST_Y - ADC_TEST_DRIFT);
+		if(Vector.magnitude){
+			numOfMoves++;
+		}
+	}
+
+	printf("center after drift of %u LSB: X %.2f, Y %.2f\n",ADC_TEST_DRIFT,joystickCenter[0]/16.0,joystickCenter[1]/16.0);
+	check_value("drift larger than dead zone",expected_normalized(ADC_TEST_REST_X + ADC_TEST_DRIFT,ADC_TEST_REST_X) > JOYSTICK_DEAD_ZONE,1);
+	check_value("vector stay 0 while rest position drift",numOfMoves,0);
+	check_value("X center follow drift (within 1 LSB)",abs(joystickCenter[0] - ((ADC_TEST_REST_X + ADC_TEST_DRIFT) << 4)) <= 16,1);
+	check_value("Y center follow drift (within 1 LSB)",abs(joystickCenter[1] - ((ADC_TEST_REST_Y - ADC_TEST_DRIFT) << 4)) <= 16,1);
+
+	Vector = read_vector_at(JOYSTICK_POS_MAX,ADC_TEST_REST_Y - ADC_TEST_DRIFT);
+	check_value("full deflection after drift",Vector.magnitude,JOYSTICK_VECTOR_ONE);
+}
+
+void test_fast_math (void)
+{
+	int32_t maxError = 0;
+	uint32_t numOfSqrtErrors = 0;
+
+	/*every angle of grid around origin, then long vectors*/
+	for(int32_t y = -2048; y <= 2048; y += 3){
+		for(int32_t x = -2048; x <= 2048; x += 5){
+			int32_t error = abs(angle_error(fast_atan2(y,x),atan2(y,x)*FAST_MATH_ANGLE_TURN/(2*M_PI)));
+
+			if((x || y) && error > maxError){
+				maxError = error;
+			}
+		}
+	}
+	for(int32_t i = 0; i < 4096; i++){
+		double angle = i*2*M_PI/4096;
+		int32_t x = (int32_t)lround(1e9*cos(angle)), y = (int32_t)lround(1e9*sin(angle));
+		int32_t error = abs(angle_error(fast_atan2(y,x),atan2(y,x)*FAST_MATH_ANGLE_TURN/(2*M_PI)));
+
+		if(error > maxError){
+			maxError = error;
+		}
+	}
+	printf("fast_atan2 error: %ld binary angle (%.4f degree)\n",(long)maxError,maxError*360.0/FAST_MATH_ANGLE_TURN);
+	check_value("fast_atan2 error below 1.5 binary angle",maxError <= 1,1);
+	check_value("fast_atan2 of 0 vector",fast_atan2(0,0),0);
+
+	for(uint32_t value = 0; value < (1UL << 20); value++){
+		uint64_t root = fast_sqrt(value);
+
+		if(root*root > value || (root + 1)*(root + 1) <= value){
+			numOfSqrtErrors++;
+		}
+	}
+	for(uint32_t value = 0xFFFFFFFF, i = 0; i < 4096; i++, value -= 1048573){
+		uint64_t root = fast_sqrt(value);
+
+		if(root*root > value || (root + 1)*(root + 1) <= value){
+			numOfSqrtErrors++;
+		}
+	}
+	check_value("fast_sqrt rounded down square root",numOfSqrtErrors,0);
+}
+
+/*cycles waited for 2 polled conversions per frame (software start to end of conversion), from clock tree*/
+void estimate_cycles_saved (void)
+{
+	const uint16_t sampleCycles[] = {3,15,28,56,84,112,144,480};
+	struct timespec start, end;
+	volatile uint8_t direction = 0;
+	double nanoseconds;
+
+	for(uint32_t i = 0; i < ADC_TEST_BENCHMARK_READS; i++){
+		direction += joystick_read_direction(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC,&start);
+	for(uint32_t i = 0; i < ADC_TEST_BENCHMARK_READS; i++){
+		direction += joystick_read_direction(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7);
+	}
+	clock_gettime(CLOCK_MONOTONIC,&end);
+	nanoseconds = ((end.tv_sec - start.tv_sec)*1e9 + (end.tv_nsec - start.tv_nsec))/ADC_TEST_BENCHMARK_READS;
+
+	/*conversion take sampling time + 12 ADC cycles, CPU run HCLK/ADCCLK cycles per ADC cycle*/
+	uint32_t fastCycles = 2*(sampleCycles[ADC_SAMPLE_TIME_3_CYCLES] + 12)*(ADC_TEST_HCLK/ADC_TEST_ADCCLK);
+	uint32_t slowCycles = 2*(sampleCycles[JOYSTICK_SAMPLE_TIME] + 12)*(ADC_TEST_HCLK/ADC_TEST_ADCCLK);
+
+	printf("polled read per frame at %lu MHz: %lu CPU cycles waiting for conversions (3 cycles sampling), %lu CPU cycles with sampling time of JOYSTICK_SAMPLE_TIME\n",
+			ADC_TEST_HCLK/1000000,(unsigned long)fastCycles,(unsigned long)slowCycles);
+	printf("DMA buffer read per frame: no waiting, %.1f ns on this PC for averaging %u scans and finding direction\n",nanoseconds,JOYSTICK_OVERSAMPLING);
+	printf("cycles saved per frame: at least %lu (plus ADC register accesses on APB2), %lu at same sampling time\n",(unsigned long)fastCycles,(unsigned long)slowCycles);
+
+	/*analog vector: same averaging plus normalization, square root and arctangent*/
+	Joystick_Vector_t Vector;
+	volatile uint16_t angle = 0;
+
+	set_joystick(3000,3500);
+	headless_adc_scan(JOYSTICK_OVERSAMPLING);
+	clock_gettime(CLOCK_MONOTONIC,&start);
+	for(uint32_t i = 0; i < ADC_TEST_BENCHMARK_READS; i++){
+		joystick_read_vector(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7,&Vector);
+		angle += Vector.angle;
+	}
+	clock_gettime(CLOCK_MONOTONIC,&end);
+	nanoseconds = ((end.tv_sec - start.tv_sec)*1e9 + (end.tv_nsec - start.tv_nsec))/ADC_TEST_BENCHMARK_READS;
+	printf("analog vector read per frame: %.1f ns on this PC\n",nanoseconds);
+}
+
+int main (void)
+{
+	test_configuration();
+	test_directions();
+	test_oversampling();
+	test_restart();
+	test_vector();
+	test_drift();
+	test_fast_math();
+	check_value("no conversion waited for by joystick reads",numOfPolledConversions,0);
+	estimate_cycles_saved();
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
@@ -0,0 +1,228 @@
+/**
+*@brief Check that "Return To Earth" game engine never use heap memory
+*
+*Asteroids, rockets and their render data live in static entity stores (entity_store.h), so game engine must not call malloc or free
+*while playing. This program is linked with malloc, calloc, realloc and free wrapped by linker (-Wl,--wrap), wrappers count calls made
+*from game engine, drivers stubs and this program (calls made inside C library itself, such as by printf, are not wrapped).
+*Game engine is initialized and played for a number of frames with random input, like rte_headless (headless_main.c) main loop,
+*through deaths, game over and new waves, and number of calls must stay 0.
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 -DSTM32F407xx -ICMSIS/Include -ICMSIS/Device/ST/STM32F4xx/Include Headless_simulation/no_alloc_test.c
+*Headless_simulation/headless_stubs.c Game_engine_return_to_earth/game_engine.c Game_engine_return_to_earth/dirty_rect.c
+*Game_engine_return_to_earth/spatial_grid.c Game_engine_return_to_earth/entity_store.c Game_engine_return_to_earth/input_log.c
+*Miscellaneous/src/tm_stm32f4_fonts.c -lm -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free -o no_alloc_test
+*
+*Run:
+*no_alloc_test [number of frames] [seed]
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "headless_stubs.h"
+#include "../Game_engine_return_to_earth/game_engine.h"
+#include <stdlib.h>
+
+#define NO_ALLOC_MAX_HOLD	30	/*random input is held for 1 to this many frames*/
+
+extern uint8_t frameUpdate;
+extern uint8_t currentWave;
+extern uint8_t numOfAsteroidInWave[RTE_NUM_OF_WAVE];
+
+extern Space_Object_t PlayerSpaceship;
+extern entity_store AsteroidStore;
+extern entity_store RocketStore;
+
+/*calls counted by wrappers*/
+uint32_t numOfMallocs = 0;
+uint32_t numOfCallocs = 0;
+uint32_t numOfReallocs = 0;
+uint32_t numOfFrees = 0;
+
+uint32_t inputRandomState = 0xBB67AE85;
+uint16_t numOfFailures = 0;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t numOfItems, size_t size);
+void *__real_realloc(void *memoryPtr, size_t size);
+void __real_free(void *memoryPtr);
+
+/***********************************************************************
+Stub: Count heap calls then forward them to C library
+***********************************************************************/
+void *__wrap_malloc (size_t size)
+{
+	numOfMallocs++;
+	return __real_malloc(size);
+}
+
+void *__wrap_calloc (size_t numOfItems, size_t size)
+{
+	numOfCallocs++;
+	return __real_calloc(numOfItems,size);
+}
+
+void *__wrap_realloc (void *memoryPtr, size_t size)
+{
+	numOfReallocs++;
+	return __real_realloc(memoryPtr,size);
+}
+
+void __wrap_free (void *memoryPtr)
+{
+	numOfFrees++;
+	__real_free(memoryPtr);
+}
+
+void check_value (const char *namePtr, uint32_t value, uint32_t expected)
+{
+	if(value != expected){
+		printf("FAIL %s: %lu, expected %lu\n",namePtr,(unsigned long)value,(unsigned long)expected);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+void check_true (const char *namePtr, uint8_t condition)
+{
+	if(!condition){
+		printf("FAIL %s\n",namePtr);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+uint32_t random_get (void)
+{
+	inputRandomState ^= inputRandomState << 13;
+	inputRandomState ^= inputRandomState >> 17;
+	inputRandomState ^= inputRandomState << 5;
+	return inputRandomState;
+}
+
+/*random input held for random number of frames, shooting most of the time so that asteroids are destroyed*/
+void next_input (void)
+{
+	static Headless_Input_t Input = {JS_DIR_CENTERED,0};
+	static uint32_t framesHeld = 0;
+
+	if(!framesHeld){
+		uint32_t random = random_get();
+
+		Input.joystickDirection = random % RTE_NUM_OF_JS_DIR;
+		Input.buttons = (((random >> 8) & 3) ? HEADLESS_BUTTON_SHOOT : 0) | (((random >> 10) & 1) ? HEADLESS_BUTTON_THRUST : 0);
+		framesHeld = 1 + (random >> 16) % NO_ALLOC_MAX_HOLD;
+	}
+
+	framesHeld--;
+	headless_set_input(&Input);
+}
+
+/*same as start of game loop in return_to_earth.c*/
+void start_game (void)
+{
+	RTE_display_black_background();
+	RTE_seed_random(RNG_get());
+	RTE_create_player_spaceship(&PlayerSpaceship);
+	RTE_draw_player_spaceship(&PlayerSpaceship);
+
+	RTE_create_asteroid(&AsteroidStore,numOfAsteroidInWave[currentWave],&PlayerSpaceship);
+	RTE_draw_asteroid(&AsteroidStore);
+	RNG_deinit();
+
+	RTE_start_update_frame();
+}
+
+int main (int argc, char *argv[])
+{
+	RTE_Input_t Input;
+	uint32_t numOfFrames = 20000, frame = 0, numOfGames = 1, numOfWaves = 0;
+	void *volatile memoryPtr;	/*kept, otherwise compiler remove malloc and free pair*/
+
+	if(argc > 1){
+		numOfFrames = strtoul(argv[1],NULL,0);
+	}
+
+	if(argc > 2){
+		headless_rng_seed(strtoul(argv[2],NULL,0));
+		inputRandomState = strtoul(argv[2],NULL,0) | 1;
+	}
+
+	/*call from this file must be counted, otherwise program was linked without wrappers*/
+	memoryPtr = malloc(16);
+	free(memoryPtr);
+	check_true("heap calls are counted",numOfMallocs == 1 && numOfFrees == 1);
+	numOfMallocs = 0;
+	numOfFrees = 0;
+
+	RTE_init();
+	RTE_display_start_screen();
+	start_game();
+
+	/*same main loop as headless_main.c*/
+	while(frame < numOfFrames){
+
+		/*one TIM6 period pass every frame, TIM6 interrupt set frameUpdate*/
+		headless_tick_timers();
+
+		if(frameUpdate != SET){
+			continue;
+		}
+
+		next_input();
+		RTE_read_input(&Input);
+		RTE_set_input(&Input);
+
+		RTE_display_score();
+		RTE_update_player_spaceship(&PlayerSpaceship);
+		RTE_create_rocket(&RocketStore,&PlayerSpaceship);
+		RTE_update_rocket(&RocketStore,&AsteroidStore);
+		RTE_update_asteroid(&AsteroidStore,&PlayerSpaceship);
+		RTE_draw_frame(&PlayerSpaceship,&RocketStore,&AsteroidStore);
+		frame++;
+
+		/*game over screen is skipped at once, new game start in next frame*/
+		if(PlayerSpaceship.Object_Property.aliveFlag == RTE_ALIVE_FALSE){
+			RTE_display_game_over_screen();
+			RTE_reset_game();
+			start_game();
+			numOfGames++;
+			continue;
+		}
+
+		if(AsteroidStore.total == 0){
+			TIM_ctr(TIM6,STOP);
+
+			if(currentWave < RTE_NUM_OF_WAVE - 1){
+				currentWave++;
+			}
+
+			RNG_init();
+			RTE_seed_random(RNG_get());
+			RTE_create_asteroid(&AsteroidStore,numOfAsteroidInWave[currentWave],&PlayerSpaceship);
+			TIM_ctr(TIM6,START);
+			numOfWaves++;
+		}
+
+		frameUpdate = CLEAR;
+	}
+
+	printf("Frames: %lu, games: %lu, waves cleared: %lu\n",(unsigned long)frame,(unsigned long)numOfGames,(unsigned long)numOfWaves);
+	check_true("game over and new wave were played",numOfGames > 1 && numOfWaves > 0);
+	check_value("malloc calls",numOfMallocs,0);
+	check_value("calloc calls",numOfCallocs,0);
+	check_value("realloc calls",numOfReallocs,0);
+	check_value("free calls",numOfFrees,0);
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
@@ -0,0 +1,325 @@
+/**
+*@brief Check that Q16.16 fixed point and float physics of "Return To Earth" move player spaceship along same path
+*
+*RTE_Real_t is Q16.16 fixed point by default and single precision float when game engine is built with -DRTE_FLOAT_PHYSICS, both builds
+*can not be linked in one program, so this program is built once for each and both are run over same input log. The build run with -w
+*write position of player spaceship after every frame into a trace file, the build run with -c play same input and compare its own
+*position with the trace every frame. Largest distance between both positions (wrap around screen edges is taken into account)
+*must stay under PHYSICS_DRIFT_MAX_PIXELS.
+*Only player spaceship is stepped (RTE_set_input and RTE_update_player_spaceship), no asteroid is created: asteroids and rockets move
+*in Q16.16 lanes of entity store in both builds, and a collision happening in one build only would make both games different.
+*Input come from an input log file (written by rte_headless -w or captured from game console, seed and hash records are skipped),
+*or from an input log recorded in memory from random input when no file is given.
+*
+*Build on PC from repository root (second build add -DRTE_FLOAT_PHYSICS and write physics_drift_float):
+*gcc -O2 -std=gnu99 -DSTM32F407xx -ICMSIS/Include -ICMSIS/Device/ST/STM32F4xx/Include Headless_simulation/physics_drift_test.c
+*Headless_simulation/headless_stubs.c Game_engine_return_to_earth/game_engine.c Game_engine_return_to_earth/dirty_rect.c
+*Game_engine_return_to_earth/spatial_grid.c Game_engine_return_to_earth/entity_store.c Game_engine_return_to_earth/input_log.c
+*Miscellaneous/src/tm_stm32f4_fonts.c -lm -o physics_drift_fixed
+*
+*Run:
+*physics_drift_fixed [-i <input log file>] -w <trace file>
+*physics_drift_float [-i <input log file>] -c <trace file>
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "headless_stubs.h"
+#include "../Game_engine_return_to_earth/game_engine.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PHYSICS_DRIFT_MAX_PIXELS	2.0
+#define PHYSICS_DRIFT_FRAMES		20000	/*frames of random input when no input log file is given*/
+#define PHYSICS_DRIFT_LOG_SIZE		65536
+#define PHYSICS_DRIFT_MAX_HOLD		60		/*random input is held for 1 to this many frames*/
+#define PHYSICS_DRIFT_TRACE_ID		0x54445452	/*first word of trace file*/
+
+/*
+*@PHYSICS_DRIFT_BUILD
+*Representation of RTE_Real_t in this build, written in trace file
+*/
+#define PHYSICS_DRIFT_FIXED		0
+#define PHYSICS_DRIFT_FLOAT		1
+
+#ifdef RTE_FIXED_POINT_PHYSICS
+#define PHYSICS_DRIFT_BUILD		PHYSICS_DRIFT_FIXED
+#else
+#define PHYSICS_DRIFT_BUILD		PHYSICS_DRIFT_FLOAT
+#endif
+
+/*player spaceship position after a frame, Q16.16 pixels*/
+typedef struct{
+	int32_t x;
+	int32_t y;
+}Drift_Position_t;
+
+extern Space_Object_t PlayerSpaceship;
+extern ILI9341_Config_t ILI9341_config;
+
+const char *buildName[] = {"fixed point","float"};
+
+uint8_t *inputLog;
+uint32_t inputLogSize = 0;
+uint8_t inputLogOverflow = FALSE;
+input_log_reader InputLogReader;
+
+uint32_t inputRandomState = 0x3C6EF372;
+uint16_t numOfFailures = 0;
+
+void check_value (const char *namePtr, uint32_t value, uint32_t expected)
+{
+	if(value != expected){
+		printf("FAIL %s: %lu, expected %lu\n",namePtr,(unsigned long)value,(unsigned long)expected);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+void check_true (const char *namePtr, uint8_t condition)
+{
+	if(!condition){
+		printf("FAIL %s\n",namePtr);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+uint32_t random_get (void)
+{
+	inputRandomState ^= inputRandomState << 13;
+	inputRandomState ^= inputRandomState >> 17;
+	inputRandomState ^= inputRandomState << 5;
+	return inputRandomState;
+}
+
+void write_input_log (const uint8_t *dataPtr, uint16_t length)
+{
+	if(inputLogSize + length > PHYSICS_DRIFT_LOG_SIZE){
+		inputLogOverflow = TRUE;
+		return;
+	}
+
+	memcpy(&inputLog[inputLogSize],dataPtr,length);
+	inputLogSize += length;
+}
+
+/*record random input held for random number of frames, same generator give same log in both builds*/
+void record_random_input (void)
+{
+	static uint8_t logData[PHYSICS_DRIFT_LOG_SIZE];
+	input_log_writer InputLogWriter;
+	Headless_Input_t Input;
+	RTE_Input_t FrameInput;
+	uint32_t framesHeld = 0;
+
+	inputLog = logData;
+	input_log_writer_init(&InputLogWriter,write_input_log);
+
+	for(uint32_t frame = 0; frame < PHYSICS_DRIFT_FRAMES; frame++){
+		if(!framesHeld){
+			uint32_t random = random_get();
+
+			Input.joystickDirection = random % RTE_NUM_OF_JS_DIR;
+			Input.buttons = ((random >> 8) & 3) ? HEADLESS_BUTTON_THRUST : 0;
+			framesHeld = 1 + (random >> 16) % PHYSICS_DRIFT_MAX_HOLD;
+		}
+
+		framesHeld--;
+		headless_set_input(&Input);
+		RTE_read_input(&FrameInput);
+		input_log_write_frame(&InputLogWriter,RTE_encode_input(&FrameInput));
+	}
+
+	input_log_write_end(&InputLogWriter);
+}
+
+/*read whole input log file into memory, return 0 when file can not be read*/
+uint8_t load_input_log (const char *fileNamePtr)
+{
+	FILE *filePtr = fopen(fileNamePtr,"rb");
+	long size;
+
+	if(filePtr == NULL){
+		return 0;
+	}
+
+	fseek(filePtr,0,SEEK_END);
+	size = ftell(filePtr);
+	fseek(filePtr,0,SEEK_SET);
+
+	inputLog = malloc(size ? size : 1);
+	if(inputLog == NULL || fread(inputLog,1,size,filePtr) != (size_t)size){
+		fclose(filePtr);
+		return 0;
+	}
+
+	fclose(filePtr);
+	inputLogSize = size;
+
+	return 1;
+}
+
+/*input of next frame, seed and hash records are skipped, return 0 when input log ended*/
+uint8_t get_frame_input (RTE_Input_t *InputPtr)
+{
+	uint16_t value = 0;
+	uint32_t record;
+	uint8_t logResult = input_log_read_frame(&InputLogReader,&value);
+
+	while(logResult == INPUT_LOG_MISMATCH){
+		if(input_log_read_hash(&InputLogReader,&record) != INPUT_LOG_OK && input_log_read_seed(&InputLogReader,&record) != INPUT_LOG_OK){
+			return 0;
+		}
+		logResult = input_log_read_frame(&InputLogReader,&value);
+	}
+
+	if(logResult != INPUT_LOG_OK){
+		return 0;
+	}
+
+	RTE_decode_input(value,InputPtr);
+	return 1;
+}
+
+Drift_Position_t get_player_position (void)
+{
+	Object_Property_t *PropertyPtr = &PlayerSpaceship.Object_Property;
+	Drift_Position_t Position;
+
+	Position.x = (int32_t)PropertyPtr->x * 65536 + RTE_REAL_TO_Q16(PropertyPtr->xFraction);
+	Position.y = (int32_t)PropertyPtr->y * 65536 + RTE_REAL_TO_Q16(PropertyPtr->yFraction);
+
+	return Position;
+}
+
+/*distance along one axis in pixels, shortest way around screen*/
+double get_axis_distance (int32_t a, int32_t b, uint16_t size)
+{
+	double distance = fabs((a - b) / 65536.0);
+
+	distance = fmod(distance,size);
+	return (distance > size/2.0) ? size - distance : distance;
+}
+
+int main (int argc, char *argv[])
+{
+	FILE *tracePtr;
+	uint32_t header[3];
+	uint32_t frame = 0, worstFrame = 0;
+	double maxDrift = 0, distance = 0;
+	uint8_t compareFlag;
+	RTE_Input_t Input;
+	Drift_Position_t Previous;
+	char name[80];
+
+	RTE_init();
+
+	if(argc > 2 && !strcmp(argv[1],"-i")){
+		if(!load_input_log(argv[2])){
+			fprintf(stderr,"Can not read input log %s\n",argv[2]);
+			return 1;
+		}
+		argc -= 2;
+		argv += 2;
+	}else{
+		record_random_input();
+		if(inputLogOverflow){
+			fprintf(stderr,"Random input log does not fit in %u bytes\n",PHYSICS_DRIFT_LOG_SIZE);
+			return 1;
+		}
+	}
+
+	if(argc != 3 || (strcmp(argv[1],"-w") && strcmp(argv[1],"-c"))){
+		fprintf(stderr,"Usage: %s [-i <input log file>] -w <trace file>\n",argv[0]);
+		fprintf(stderr,"       %s [-i <input log file>] -c <trace file>\n",argv[0]);
+		return 1;
+	}
+
+	compareFlag = !strcmp(argv[1],"-c");
+	tracePtr = fopen(argv[2],compareFlag ? "rb" : "wb");
+
+	if(tracePtr == NULL){
+		fprintf(stderr,"Can not open trace file %s\n",argv[2]);
+		return 1;
+	}
+
+	if(compareFlag){
+		if(fread(header,sizeof(header),1,tracePtr) != 1 || header[0] != PHYSICS_DRIFT_TRACE_ID){
+			fprintf(stderr,"%s is not a trace file\n",argv[2]);
+			fclose(tracePtr);
+			return 1;
+		}
+
+		snprintf(name,sizeof(name),"trace written by %s build",header[1] ? buildName[PHYSICS_DRIFT_FLOAT] : buildName[PHYSICS_DRIFT_FIXED]);
+		check_true(name,header[1] != PHYSICS_DRIFT_BUILD);
+	}else{
+		header[0] = PHYSICS_DRIFT_TRACE_ID;
+		header[1] = PHYSICS_DRIFT_BUILD;
+		header[2] = 0;
+		fwrite(header,sizeof(header),1,tracePtr);
+	}
+
+	input_log_reader_init(&InputLogReader,inputLog,inputLogSize);
+	RTE_reset_game();
+	RTE_create_player_spaceship(&PlayerSpaceship);
+
+	Previous = get_player_position();
+
+	while(get_frame_input(&Input)){
+		Drift_Position_t Position, Other;
+
+		RTE_set_input(&Input);
+		RTE_update_player_spaceship(&PlayerSpaceship);
+		Position = get_player_position();
+		distance += hypot(get_axis_distance(Position.x,Previous.x,ILI9341_config.width),get_axis_distance(Position.y,Previous.y,ILI9341_config.height));
+		Previous = Position;
+
+		if(!compareFlag){
+			fwrite(&Position,sizeof(Position),1,tracePtr);
+		}else if(fread(&Other,sizeof(Other),1,tracePtr) == 1){
+			double drift = hypot(get_axis_distance(Position.x,Other.x,ILI9341_config.width),get_axis_distance(Position.y,Other.y,ILI9341_config.height));
+
+			if(drift > maxDrift){
+				maxDrift = drift;
+				worstFrame = frame;
+			}
+		}else{
+			break;
+		}
+
+		frame++;
+	}
+
+	if(!compareFlag){
+		/*number of frames is known once input log ended*/
+		header[2] = frame;
+		fseek(tracePtr,0,SEEK_SET);
+		fwrite(header,sizeof(header),1,tracePtr);
+		fclose(tracePtr);
+		printf("%s build: %lu frames written into %s\n",buildName[PHYSICS_DRIFT_BUILD],(unsigned long)frame,argv[2]);
+		return 0;
+	}
+
+	fclose(tracePtr);
+
+	printf("%s build against trace: largest drift %.4f pixels at frame %lu, %.0f pixels travelled\n",buildName[PHYSICS_DRIFT_BUILD],maxDrift,
+	(unsigned long)worstFrame,distance);
+	check_value("same number of frames",frame,header[2]);
+	check_true("player spaceship moved (at least 1 pixel per 10 frames)",distance*10 >= frame);
+	snprintf(name,sizeof(name),"drift stay under %.1f pixels",PHYSICS_DRIFT_MAX_PIXELS);
+	check_true(name,maxDrift < PHYSICS_DRIFT_MAX_PIXELS);
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
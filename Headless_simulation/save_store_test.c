@@ -0,0 +1,444 @@
+/**
+*@brief Check save store (high score table and progress in EEPROM) on PC against a file backed EEPROM, including power loss during writes
+*
+*This program run save store (Game_engine_return_to_earth/save_store.c) over EEPROM driver (Device_drivers/src/eeprom.c) and I2C
+*transaction queue (Peripheral_drivers/src/stm32f407xx_i2c.c) on emulated I2C bus (headless_i2c.c) with a 24C32 EEPROM: 32 bytes pages,
+*bytes programmed 5ms after stop condition and address not acknowledged meanwhile. EEPROM content is kept in a file: every boot load it,
+*every power loss save it, so records only survive through what the EEPROM really programmed.
+*Blank EEPROM must boot with default records in one sequential read. Records must be written SAVE_STORE_WRITE_DELAY frames after first
+*change, changes in between batched into one page write per record, and be restored on next boot. Slots of a record must be written in
+*turn. Power is then cut at every byte time of a high score write (transfer, write cycle and after): next boot must find old or new
+*table, never a mix, and half programmed pages must be counted as corrupt. A corrupted newest copy must fall back to previous one, a
+*write not acknowledged must be done again, an EEPROM not answering at boot must leave records in RAM only.
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 -DSTM32F407xx -ICMSIS/Include -ICMSIS/Device/ST/STM32F4xx/Include
+*Headless_simulation/save_store_test.c Headless_simulation/headless_i2c.c Peripheral_drivers/src/stm32f407xx_i2c.c Device_drivers/src/eeprom.c
+*Game_engine_return_to_earth/save_store.c Miscellaneous/src/byte_pack.c -o save_store_test
+*
+*Run:
+*save_store_test [EEPROM image file]
+*Exit code is 0 when every check pass. Without a file name EEPROM image is kept in a temporary file removed at exit, a given file is
+*kept and hold EEPROM content at end of test.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "headless_i2c.h"
+#include "../Game_engine_return_to_earth/save_store.h"
+#include <stdio.h>
+#include <string.h>
+
+#define SAVE_TEST_EEPROM_ADDRESS	0x50
+#define SAVE_TEST_EEPROM_SIZE		4096
+#define SAVE_TEST_PAGE_SIZE			32
+#define SAVE_TEST_BASE_ADDRESS		0x0100
+#define SAVE_TEST_BYTE_TIMES_PER_S	(I2C_FSCL_FM/9)	/*8 data bits and acknowledge*/
+#define SAVE_TEST_FRAME_TIME		(SAVE_TEST_BYTE_TIMES_PER_S/30)
+#define SAVE_TEST_WRITE_CYCLE_TIME	(SAVE_TEST_BYTE_TIMES_PER_S/200)	/*5ms*/
+#define SAVE_TEST_MAX_BOOT_FRAMES	10
+#define SAVE_TEST_FRAMES_PER_WRITE	3	/*page write started, write cycle polled, polling acknowledged*/
+#define SAVE_TEST_FRAMES_PER_FLUSH	(SAVE_STORE_NUM_OF_RECORDS*SAVE_TEST_FRAMES_PER_WRITE + 1)
+
+I2C_Handle_t I2CHandle;
+I2C_Config_t I2CConfig = {.SCLspeed = I2C_FSCL_FM, .deviceAddress = 0x33, .ACKctr = I2C_ACKctr_ENABLE, .FMdutyCycle = I2C_FMduty_2};
+
+uint8_t eepromMemory[SAVE_TEST_EEPROM_SIZE];
+Headless_I2C_Slave_t Eeprom;
+EEPROM_Handle_t EEPROMHandle;
+save_store Store;
+
+const char *imagePathPtr = "temporary file";
+FILE *imageFilePtr = NULL;
+uint16_t numOfFailures = 0;
+
+void check_value (const char *namePtr, uint32_t value, uint32_t expected)
+{
+	if(value != expected){
+		printf("FAIL %s: %lu, expected %lu\n",namePtr,(unsigned long)value,(unsigned long)expected);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+void check_true (const char *namePtr, uint8_t condition)
+{
+	if(!condition){
+		printf("FAIL %s\n",namePtr);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+/*write EEPROM content into image file*/
+void save_image (void)
+{
+	rewind(imageFilePtr);
+	if(fwrite(eepromMemory,1,sizeof(eepromMemory),imageFilePtr) != sizeof(eepromMemory) || fflush(imageFilePtr)){
+		printf("FAIL image file (%s) can not be written\n",imagePathPtr);
+		numOfFailures++;
+	}
+}
+
+/*erase EEPROM image file (every byte 0xFF)*/
+void erase_image (void)
+{
+	memset(eepromMemory,0xFF,sizeof(eepromMemory));
+	save_image();
+}
+
+/*cut power: page being programmed is left half written, EEPROM content is saved into image file*/
+void power_off (void)
+{
+	headless_i2c_power_loss();
+	save_image();
+}
+
+/*load EEPROM content from image file, initialize bus, I2C driver, EEPROM and save store (boot read is started)*/
+void power_on (void)
+{
+	rewind(imageFilePtr);
+	if(fread(eepromMemory,1,sizeof(eepromMemory),imageFilePtr) != sizeof(eepromMemory)){
+		printf("FAIL image file (%s) can not be read\n",imagePathPtr);
+		numOfFailures++;
+	}
+
+	memset(&I2CHandle,0,sizeof(I2CHandle));
+	headless_i2c_init(&I2CHandle);
+	I2CHandle.I2CxConfigPtr = &I2CConfig;
+	I2C_init(&I2CHandle);
+	I2C_DMA_init(&I2CHandle);
+	I2C_periph_ctr(I2CHandle.I2CxPtr,ENABLE);
+
+	memset(&Eeprom,0,sizeof(Eeprom));
+	Eeprom.address = SAVE_TEST_EEPROM_ADDRESS;
+	Eeprom.memoryPtr = eepromMemory;
+	Eeprom.memorySize = SAVE_TEST_EEPROM_SIZE;
+	Eeprom.addressSize = 2;
+	Eeprom.pageSize = SAVE_TEST_PAGE_SIZE;
+	Eeprom.writeCycleTime = SAVE_TEST_WRITE_CYCLE_TIME;
+	headless_i2c_add_slave(&Eeprom);
+
+	eeprom_init(&EEPROMHandle,&I2CHandle,SAVE_TEST_EEPROM_ADDRESS,SAVE_TEST_PAGE_SIZE);
+	save_store_init(&Store,&EEPROMHandle,SAVE_TEST_BASE_ADDRESS);
+}
+
+/*save store is served after drawing, bus run until next frame*/
+void run_frames (uint16_t numOfFrames)
+{
+	while(numOfFrames--){
+		save_store_service(&Store);
+		headless_i2c_run(SAVE_TEST_FRAME_TIME);
+	}
+}
+
+/*power on and run frames until boot read is over, return number of frames*/
+uint16_t boot (void)
+{
+	uint16_t numOfFrames = 0;
+
+	power_on();
+	while(save_store_service(&Store) == SAVE_STORE_LOADING && numOfFrames < SAVE_TEST_MAX_BOOT_FRAMES){
+		headless_i2c_run(SAVE_TEST_FRAME_TIME);
+		numOfFrames++;
+	}
+
+	return numOfFrames;
+}
+
+/*add game and write it at once, return when store is idle again*/
+void play_game (int16_t score, uint8_t wave)
+{
+	save_store_add_game(&Store,score,wave);
+	save_store_flush(&Store);
+	run_frames(SAVE_TEST_FRAMES_PER_FLUSH);
+}
+
+uint8_t same_table (const save_high_score *tablePtr, const save_high_score *expectedPtr)
+{
+	for(uint8_t i = 0; i < SAVE_STORE_NUM_OF_SCORES; i++){
+		if(tablePtr[i].score != expectedPtr[i].score || tablePtr[i].wave != expectedPtr[i].wave){
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+/*slot of record in EEPROM image*/
+const uint8_t* get_slot (uint8_t record, uint8_t slot)
+{
+	return &eepromMemory[SAVE_TEST_BASE_ADDRESS + (record*SAVE_STORE_NUM_OF_SLOTS + slot)*SAVE_STORE_SLOT_SIZE];
+}
+
+/*blank EEPROM boot with default records, whole area is read in one transfer*/
+void test_blank_boot (void)
+{
+	uint16_t numOfFrames;
+	uint8_t defaults = TRUE;
+
+	printf("\nBlank EEPROM\n");
+	erase_image();
+	numOfFrames = boot();
+
+	check_value("boot read done in first frame",numOfFrames,1);
+	check_value("state after boot",Store.state,SAVE_STORE_IDLE);
+	check_value("EEPROM reads at boot",Eeprom.numOfReads,1);
+	check_value("bytes read at boot",Eeprom.numOfBytesRead,SAVE_STORE_SIZE);
+
+	for(uint8_t i = 0; i < SAVE_STORE_NUM_OF_SCORES; i++){
+		if(Store.highScores[i].score || Store.highScores[i].wave){
+			defaults = FALSE;
+		}
+	}
+	check_true("high score table is empty",defaults);
+	check_value("games played",Store.numOfGames,0);
+	check_value("erased slots are not corrupt",Store.numOfCorruptSlots,0);
+}
+
+/*records are written after delay, changes made meanwhile go into same writes*/
+void test_write_behind (void)
+{
+	uint8_t rank;
+
+	printf("\nWrite behind\n");
+
+	rank = save_store_add_game(&Store,1200,3);
+	check_value("first game rank",rank,0);
+	run_frames(10);
+	rank = save_store_add_game(&Store,800,2);
+	check_value("second game rank",rank,1);
+	rank = save_store_add_game(&Store,0,1);
+	check_value("game without score is not ranked",rank,SAVE_STORE_NOT_RANKED);
+
+	run_frames(SAVE_STORE_WRITE_DELAY - 10);
+	check_value("nothing written before delay",Eeprom.numOfWriteCycles,0);
+
+	run_frames(SAVE_TEST_FRAMES_PER_FLUSH);
+	check_value("one page write per record",Eeprom.numOfWriteCycles,SAVE_STORE_NUM_OF_RECORDS);
+	check_value("records written",Store.numOfWrites,SAVE_STORE_NUM_OF_RECORDS);
+	check_value("state after writes",Store.state,SAVE_STORE_IDLE);
+	check_value("nothing left to write",Store.dirty,0);
+	/*memory address of boot read is a write as well*/
+	check_value("one address poll per write cycle",Eeprom.numOfWrites - Eeprom.numOfWriteCycles - 1,SAVE_STORE_NUM_OF_RECORDS);
+}
+
+/*next boot restore records written*/
+void test_reboot (void)
+{
+	save_high_score Expected[SAVE_STORE_NUM_OF_SCORES];
+
+	printf("\nReboot\n");
+	memcpy(Expected,Store.highScores,sizeof(Expected));
+	power_off();
+	boot();
+
+	check_true("high score table restored",same_table(Store.highScores,Expected));
+	check_value("best score",Store.highScores[0].score,1200);
+	check_value("games played restored",Store.numOfGames,3);
+	check_value("best wave restored",Store.bestWave,3);
+}
+
+/*slots of a record are written in turn with consecutive sequence numbers*/
+void test_wear_leveling (void)
+{
+	uint32_t writesBefore = Eeprom.numOfWriteCycles;
+	uint16_t sequences[SAVE_STORE_NUM_OF_SLOTS];
+	uint16_t minSequence = 0xFFFF, maxSequence = 0;
+	uint8_t allValid = TRUE;
+	uint8_t allDifferent = TRUE;
+
+	printf("\nWear leveling\n");
+
+	for(uint8_t i = 0; i < 2*SAVE_STORE_NUM_OF_SLOTS; i++){
+		play_game((int16_t)(1300 + 10*i),4);
+	}
+	check_value("page writes",Eeprom.numOfWriteCycles - writesBefore,2*SAVE_STORE_NUM_OF_SLOTS*SAVE_STORE_NUM_OF_RECORDS);
+
+	for(uint8_t slot = 0; slot < SAVE_STORE_NUM_OF_SLOTS; slot++){
+		const uint8_t *slotPtr = get_slot(SAVE_STORE_HIGH_SCORES,slot);
+
+		if(slotPtr[0] != SAVE_STORE_MAGIC || slotPtr[1] != SAVE_STORE_HIGH_SCORES){
+			allValid = FALSE;
+		}
+		sequences[slot] = slotPtr[2] | (slotPtr[3] << 8);
+		if(sequences[slot] < minSequence){
+			minSequence = sequences[slot];
+		}
+		if(sequences[slot] > maxSequence){
+			maxSequence = sequences[slot];
+		}
+		for(uint8_t i = 0; i < slot; i++){
+			if(sequences[i] == sequences[slot]){
+				allDifferent = FALSE;
+			}
+		}
+	}
+
+	check_true("every slot hold a copy",allValid);
+	check_true("every slot hold a different copy",allDifferent);
+	check_value("slots hold last copies",maxSequence - minSequence,SAVE_STORE_NUM_OF_SLOTS - 1);
+
+	power_off();
+	boot();
+	check_value("newest copy loaded",Store.highScores[0].score,1300 + 10*(2*SAVE_STORE_NUM_OF_SLOTS - 1));
+	check_value("games played",Store.numOfGames,3 + 2*SAVE_STORE_NUM_OF_SLOTS);
+}
+
+/*power is cut at every byte time of a high score write, table is old or new one*/
+void test_power_loss (void)
+{
+	save_high_score Old[SAVE_STORE_NUM_OF_SCORES];
+	save_high_score New[SAVE_STORE_NUM_OF_SCORES];
+	uint32_t oldGames = Store.numOfGames;
+	uint32_t cutTime = 0;
+	uint32_t numOfOld = 0, numOfNew = 0, numOfMixed = 0, numOfCorrupt = 0;
+	uint8_t progressAhead = FALSE;
+
+	printf("\nPower loss during write\n");
+	power_off();
+	memcpy(Old,Store.highScores,sizeof(Old));
+
+	while(1){
+		/*same write every time: image file hold old records until a cut leave new ones*/
+		boot();
+		save_store_add_game(&Store,2000,5);
+		memcpy(New,Store.highScores,sizeof(New));
+		save_store_flush(&Store);
+		while(Store.state != SAVE_STORE_WRITING){
+			save_store_service(&Store);
+		}
+
+		headless_i2c_run(cutTime);
+		power_off();
+
+		boot();
+		if(same_table(Store.highScores,Old)){
+			numOfOld++;
+		}else if(same_table(Store.highScores,New)){
+			numOfNew++;
+		}else{
+			numOfMixed++;
+		}
+		if(Store.numOfCorruptSlots){
+			numOfCorrupt++;
+		}
+		/*progress record is written after high score table*/
+		if(Store.numOfGames != oldGames){
+			progressAhead = TRUE;
+		}
+
+		power_off();
+		if(!same_table(Store.highScores,Old)){
+			break;
+		}
+		cutTime++;
+	}
+
+	printf("power cut after 0 to %lu byte times: %lu old tables, %lu new tables, %lu half programmed pages\n",(unsigned long)cutTime,
+	(unsigned long)numOfOld,(unsigned long)numOfNew,(unsigned long)numOfCorrupt);
+	check_value("mixed tables",numOfMixed,0);
+	check_value("new table found once",numOfNew,1);
+	check_true("cuts during write cycle leave corrupt page",numOfCorrupt > 0);
+	check_true("cuts cover write cycle",cutTime > SAVE_TEST_WRITE_CYCLE_TIME);
+	check_true("progress never ahead of high scores",!progressAhead);
+
+	boot();
+	check_value("new table kept",Store.highScores[0].score,2000);
+	check_value("no corrupt slot once rewritten",Store.numOfCorruptSlots,0);
+}
+
+/*newest copy with wrong CRC is skipped, previous copy is loaded and corrupt slot is written next*/
+void test_corrupt_newest (void)
+{
+	save_high_score Previous[SAVE_STORE_NUM_OF_SCORES];
+	uint8_t newest;
+
+	printf("\nCorrupt newest copy\n");
+	play_game(2100,5);
+	memcpy(Previous,Store.highScores,sizeof(Previous));
+	play_game(2200,5);
+	newest = Store.slot[SAVE_STORE_HIGH_SCORES];
+
+	/*bit flipped in payload*/
+	eepromMemory[SAVE_TEST_BASE_ADDRESS + (SAVE_STORE_HIGH_SCORES*SAVE_STORE_NUM_OF_SLOTS + newest)*SAVE_STORE_SLOT_SIZE + 5] ^= 0x10;
+	power_off();
+	boot();
+
+	check_value("corrupt slots",Store.numOfCorruptSlots,1);
+	check_true("previous table loaded",same_table(Store.highScores,Previous));
+
+	play_game(2300,5);
+	check_value("corrupt slot written next",Store.slot[SAVE_STORE_HIGH_SCORES],newest);
+	power_off();
+	boot();
+	check_value("no corrupt slot after rewrite",Store.numOfCorruptSlots,0);
+	check_value("new best score",Store.highScores[0].score,2300);
+}
+
+/*page write not acknowledged is done again after delay*/
+void test_nack (void)
+{
+	uint32_t failuresBefore = Store.numOfFailedWrites;
+
+	printf("\nWrite not acknowledged\n");
+	Eeprom.nackAfterBytes = 10;
+	play_game(2400,5);
+	check_true("failed writes counted",Store.numOfFailedWrites > failuresBefore);
+	check_true("record still dirty",Store.dirty != 0);
+
+	Eeprom.nackAfterBytes = 0;
+	run_frames(SAVE_STORE_WRITE_DELAY + SAVE_TEST_FRAMES_PER_FLUSH);
+	check_value("record written again",Store.dirty,0);
+	power_off();
+	boot();
+	check_value("best score after retry",Store.highScores[0].score,2400);
+
+	/*absent EEPROM: boot read is tried again then store run from RAM*/
+	power_off();
+	power_on();
+	Eeprom.nackAddress = TRUE;
+	run_frames(2*SAVE_STORE_LOAD_RETRIES);
+	check_value("absent EEPROM state",Store.state,SAVE_STORE_OFFLINE);
+	check_value("absent EEPROM reads",Eeprom.numOfReads,0);
+	check_value("records kept in RAM",save_store_add_game(&Store,100,1),0);
+	run_frames(SAVE_STORE_WRITE_DELAY + 2);
+	check_value("nothing written offline",Eeprom.numOfWrites,0);
+	Eeprom.nackAddress = FALSE;
+}
+
+int main (int argc, char *argv[])
+{
+	if(argc > 1){
+		imagePathPtr = argv[1];
+		imageFilePtr = fopen(imagePathPtr,"w+b");
+	}else{
+		imageFilePtr = tmpfile();
+	}
+
+	if(imageFilePtr == NULL){
+		fprintf(stderr,"Can not create EEPROM image file (%s)\n",imagePathPtr);
+		return 1;
+	}
+
+	test_blank_boot();
+	test_write_behind();
+	test_reboot();
+	test_wear_leveling();
+	test_power_loss();
+	test_corrupt_newest();
+	test_nack();
+
+	fclose(imageFilePtr);
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
@@ -0,0 +1,266 @@
+/**
+*@brief Check note onset timing of music sequencer on PC
+*
+*This program play songs with sequencer (Device_drivers/src/sequencer.c) through real speaker driver and emulated DAC fed by DMA
+*(headless_dac.c), then find onsets of notes in samples output by DAC (first sound after silence). Every onset must be less than
+*one block (SPEAKER_BLOCK_SIZE samples) away from its time in song, counted from first note: notes and rests of every duration,
+*tempo change in song and by sequencer_set_tempo, and restart of looping song are checked. Notes are square waves without attack and
+*release, separated by rests, so that onsets are exact. Theme song of "Return To Earth" is rendered too and its size is printed.
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 -DSTM32F407xx -ICMSIS/Include -ICMSIS/Device/ST/STM32F4xx/Include
+*Headless_simulation/sequencer_test.c Headless_simulation/headless_dac.c Device_drivers/src/speaker.c Device_drivers/src/sequencer.c
+*Miscellaneous/src/adpcm.c Miscellaneous/src/synth.c -lm -o sequencer_test
+*
+*Run:
+*sequencer_test
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "headless_dac.h"
+#include "../Device_drivers/inc/sequencer.h"
+#include "../Miscellaneous/inc/rte_theme_song.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define SEQUENCER_TEST_MAX_SAMPLES	(60*6176)
+#define SEQUENCER_TEST_MAX_ONSETS	64
+
+uint16_t dacOutput[SEQUENCER_TEST_MAX_SAMPLES];
+uint32_t onset[SEQUENCER_TEST_MAX_ONSETS];
+
+uint16_t numOfFailures = 0;
+
+const Synth_Instrument_t beep = {SYNTH_WAVE_SQUARE,0,0,SYNTH_SUSTAIN_FULL,0};
+
+/*notes of every duration separated by rests, tempo is doubled in the middle*/
+const Sequencer_Event_t timingEvent[] = {
+	SEQUENCER_NOTE(noteA4,EN),SEQUENCER_REST(EN),SEQUENCER_NOTE(noteC5,QN),SEQUENCER_REST(SN),SEQUENCER_ACCENT(noteE5,HN),SEQUENCER_REST(QN),
+	SEQUENCER_STACCATO(noteA5,QN),SEQUENCER_REST(SN),
+	SEQUENCER_TEMPO(300),
+	SEQUENCER_NOTE(noteA4,EN),SEQUENCER_REST(EN),SEQUENCER_NOTE(noteC5,SN),SEQUENCER_REST(SN),SEQUENCER_NOTE(noteE5,WN),SEQUENCER_REST(EN),
+	SEQUENCER_END
+};
+
+/*ticks and tempo of notes of timingEvent, song last 50 ticks*/
+const uint16_t timingTick[] = {0,4,9,21,26,30,32};
+const uint16_t timingTempo[] = {150,150,150,150,300,300,300};
+
+const Sequencer_Track_t timingTrack[] = {{timingEvent,&beep,SPEAKER_VOLUME_HALF}};
+const Sequencer_Song_t timingSong = {timingTrack,1,150,0,SEQUENCER_PLAY_ONCE};
+const Sequencer_Song_t loopingSong = {timingTrack,1,150,0,SEQUENCER_PLAY_LOOP};
+
+/*stub timer and RCC drivers*/
+void TIM_init_direct(TIM_TypeDef *TIMxPtr,uint16_t reloadVal,uint16_t preScaler)
+{
+}
+
+void TIM_ctr(TIM_TypeDef *TIMxPtr, uint8_t startOrStop)
+{
+}
+
+void TIM_interrupt_ctr(TIM_TypeDef *TIMxPtr, uint8_t enOrDis)
+{
+}
+
+void TIM_intrpt_vector_ctr (uint8_t IRQnumber, uint8_t enOrDis)
+{
+}
+
+void TIM_intrpt_handler (TIM_TypeDef *TIMxPtr)
+{
+}
+
+void TIM_update_event_TRGO (TIM_TypeDef *TIMxPtr)
+{
+}
+
+/*timers on APB1 after RCC_set_SYSCLK_PLL_84_MHz*/
+int32_t RCC_get_TIMCLK_value(uint8_t APBx)
+{
+	return 42000000;
+}
+
+void check_value (const char *namePtr, uint32_t value, uint32_t expected)
+{
+	if(value != expected){
+		printf("FAIL %s: %lu, expected %lu\n",namePtr,(unsigned long)value,(unsigned long)expected);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+/*output samples until DMA stop (or given number of samples), return number of samples output*/
+uint32_t run_speaker (uint32_t maxSamples)
+{
+	uint32_t numOfSamples = 0;
+
+	headless_dac_set_output(dacOutput,SEQUENCER_TEST_MAX_SAMPLES);
+
+	while(headless_dac_DMA_running_check() && numOfSamples < maxSamples){
+		headless_dac_trigger(SPEAKER_BLOCK_SIZE);
+		numOfSamples += SPEAKER_BLOCK_SIZE;
+	}
+
+	return headless_dac_get_num_of_outputs();
+}
+
+/*find first samples of sound after silence, return number of onsets*/
+uint16_t find_onsets (uint32_t numOfSamples)
+{
+	uint16_t numOfOnsets = 0;
+
+	for(uint32_t i = 1; i < numOfSamples && numOfOnsets < SEQUENCER_TEST_MAX_ONSETS; i++){
+		if(dacOutput[i - 1] == SPEAKER_SAMPLE_MIDPOINT && dacOutput[i] != SPEAKER_SAMPLE_MIDPOINT){
+			onset[numOfOnsets++] = i;
+		}
+	}
+
+	return numOfOnsets;
+}
+
+/*time of note in samples from start of song, tick length depend on tempo*/
+double tick_time (uint16_t note, uint16_t firstNote)
+{
+	double time = 0;
+	uint32_t sampleRate = speaker_get_sample_rate();
+
+	for(uint16_t i = firstNote; i < note; i++){
+		time += (timingTick[i + 1] - timingTick[i]) * 60.0 * sampleRate / (timingTempo[i] * SEQUENCER_TICKS_PER_BEAT);
+	}
+
+	return time;
+}
+
+/*compare onsets with time of notes in song, return largest difference in samples*/
+uint32_t check_onsets (const char *namePtr, uint16_t firstOnset, uint16_t numOfNotes)
+{
+	double largest = 0;
+
+	for(uint16_t i = 0; i < numOfNotes; i++){
+		double expected = onset[firstOnset] + tick_time(i,0);
+		double difference = onset[firstOnset + i] - expected;
+
+		if(difference < 0){
+			difference = -difference;
+		}
+
+		if(difference > largest){
+			largest = difference;
+		}
+
+		if(difference >= SPEAKER_BLOCK_SIZE){
+			printf("FAIL %s: note %u start at sample %lu, expected %.1f\n",namePtr,i,(unsigned long)onset[firstOnset + i],expected);
+			numOfFailures++;
+			return (uint32_t)largest;
+		}
+	}
+
+	printf("pass %s (largest onset error %.1f samples, block of %u samples)\n",namePtr,largest,SPEAKER_BLOCK_SIZE);
+	return (uint32_t)largest;
+}
+
+void test_timing (void)
+{
+	uint16_t numOfNotes = sizeof(timingTick)/sizeof(timingTick[0]);
+	uint32_t numOfSamples;
+
+	sequencer_play(&timingSong);
+	check_value("song playing",sequencer_playing_check(),TRUE);
+	check_value("DMA started by song",headless_dac_DMA_running_check(),1);
+
+	numOfSamples = run_speaker(SEQUENCER_TEST_MAX_SAMPLES);
+	check_value("song ended",sequencer_playing_check(),FALSE);
+	check_value("DMA stopped after song",headless_dac_DMA_running_check(),0);
+	check_value("notes found in output",find_onsets(numOfSamples),numOfNotes);
+	check_onsets("onsets of notes and tempo change",0,numOfNotes);
+}
+
+void test_loop (void)
+{
+	uint16_t numOfNotes = sizeof(timingTick)/sizeof(timingTick[0]);
+	double songLength = tick_time(numOfNotes - 1,0) + (50 - timingTick[numOfNotes - 1])*60.0*speaker_get_sample_rate()/(300*SEQUENCER_TICKS_PER_BEAT);
+	double difference;
+
+	sequencer_play(&loopingSong);
+	run_speaker((uint32_t)(2.5*songLength));
+	check_value("looping song still playing",sequencer_playing_check(),TRUE);
+	check_value("notes of 2 loops found in output",find_onsets(headless_dac_get_num_of_outputs()) >= 2*numOfNotes,1);
+	check_onsets("onsets of second loop",numOfNotes,numOfNotes);
+
+	difference = onset[numOfNotes] - onset[0] - songLength;
+	if(difference < 0){
+		difference = -difference;
+	}
+	check_value("song restart at its end (within one block)",difference < SPEAKER_BLOCK_SIZE,1);
+
+	sequencer_stop();
+	run_speaker(SEQUENCER_TEST_MAX_SAMPLES);
+	check_value("DMA stopped after sequencer_stop",headless_dac_DMA_running_check(),0);
+}
+
+void test_set_tempo (void)
+{
+	double tickAt150 = 60.0*speaker_get_sample_rate()/(150*SEQUENCER_TICKS_PER_BEAT);
+	double counted = 4*SPEAKER_BLOCK_SIZE;
+	double expected;
+	uint32_t numOfSamples = 0;
+
+	/*tempo is halved while first note play, 4 blocks are mixed before (output start 2 blocks later): second note is 4 ticks after first one, first 4 blocks at 150 beats per minute and the rest at 75*/
+	sequencer_play(&timingSong);
+	headless_dac_set_output(dacOutput,SEQUENCER_TEST_MAX_SAMPLES);
+	headless_dac_trigger(4*SPEAKER_BLOCK_SIZE);
+	sequencer_set_tempo(75);
+
+	while(headless_dac_DMA_running_check() && numOfSamples < SEQUENCER_TEST_MAX_SAMPLES){
+		headless_dac_trigger(SPEAKER_BLOCK_SIZE);
+		numOfSamples += SPEAKER_BLOCK_SIZE;
+	}
+	find_onsets(headless_dac_get_num_of_outputs());
+
+	expected = counted + (4 - counted/tickAt150)*2*tickAt150;
+	check_value("sequencer_set_tempo slow down song (within one block)",fabs(onset[1] - onset[0] - expected) < SPEAKER_BLOCK_SIZE,1);
+}
+
+void test_theme_song (void)
+{
+	Sequencer_Song_t song = rte_theme_song;
+	uint32_t numOfBytes = sizeof(rte_theme_song) + sizeof(rte_theme_track) + sizeof(rte_theme_melody) + sizeof(rte_theme_bassline)
+			+ sizeof(rte_theme_lead) + sizeof(rte_theme_bass);
+
+	/*theme is played once, it must end after its 4 bars at 140 beats per minute*/
+	song.playMode = SEQUENCER_PLAY_ONCE;
+	sequencer_play(&song);
+	run_speaker(SEQUENCER_TEST_MAX_SAMPLES);
+	check_value("theme song ended",sequencer_playing_check(),FALSE);
+	check_value("theme song last 4 bars (within 2 blocks and release)",
+			abs((int32_t)headless_dac_get_num_of_outputs() - (int32_t)(4*4*60*speaker_get_sample_rate()/140)) < 4*SPEAKER_BLOCK_SIZE + 80*speaker_get_sample_rate()/1000,1);
+
+	printf("theme song: %lu bytes of flash (%u events), %lu bytes of RAM for sequencer\n",(unsigned long)numOfBytes,
+			(unsigned)((sizeof(rte_theme_melody) + sizeof(rte_theme_bassline))/sizeof(Sequencer_Event_t)),
+			(unsigned long)(SEQUENCER_MAX_TRACKS*4 + sizeof(void*) + 2*sizeof(uint32_t)));
+	check_value("theme song take less than 512 bytes",numOfBytes < 512,1);
+}
+
+int main (void)
+{
+	speaker_init(DAC_CHANNEL_1,9,679);
+
+	test_timing();
+	test_loop();
+	test_set_tempo();
+	test_theme_song();
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
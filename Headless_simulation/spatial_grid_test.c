@@ -0,0 +1,299 @@
+/**
+*@brief Check spatial grid broad phase against brute force pair check on PC and compare their speed
+*
+*This program place asteroid and rocket sized rectangles on screen (random scenes of 15 to 1000 objects, objects straddling screen
+*edges and corners, objects touching without overlapping, objects as large as screen, screen size not a multiple of cell size) and find
+*every overlapping pair twice: by brute force O(n^2) check of every pair with a wrap-aware AABB test written independently of
+*spatial_grid.c, and by spatial grid broad phase (insert every object, query candidates of each object, check candidates with
+*spatial_grid_overlap) like game engine does. Both methods must find the same set of pairs, and a query must report each id once.
+*Time of both methods is printed for each random scene (Test_applications/test_spatial_grid_benchmark.c measure them on target).
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 -DSPATIAL_GRID_MAX_IDS=1024 -DSPATIAL_GRID_MAX_ENTRIES=4096
+*Headless_simulation/spatial_grid_test.c Game_engine_return_to_earth/spatial_grid.c -o spatial_grid_test
+*
+*Run:
+*spatial_grid_test
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../Game_engine_return_to_earth/spatial_grid.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define GRID_TEST_MAX_OBJECTS	1000
+#define GRID_TEST_REPEAT		20		/*runs of each method per timed scene*/
+
+#if (SPATIAL_GRID_MAX_IDS < GRID_TEST_MAX_OBJECTS) || (SPATIAL_GRID_MAX_ENTRIES < 4*GRID_TEST_MAX_OBJECTS)
+#error "define SPATIAL_GRID_MAX_IDS=1024 and SPATIAL_GRID_MAX_ENTRIES=4096 on command line"
+#endif
+
+typedef struct{
+	int16_t x;
+	int16_t y;
+	uint16_t width;
+	uint16_t height;
+}Rect_t;
+
+Rect_t Object[GRID_TEST_MAX_OBJECTS];
+uint16_t queryResult[GRID_TEST_MAX_OBJECTS];
+spatial_grid grid;
+
+/*overlapping pairs (i < j) found by each method, bit j of row i*/
+uint32_t bruteForcePairs[GRID_TEST_MAX_OBJECTS][GRID_TEST_MAX_OBJECTS/32 + 1];
+uint32_t gridPairs[GRID_TEST_MAX_OBJECTS][GRID_TEST_MAX_OBJECTS/32 + 1];
+
+uint32_t randomState = 0x2545F491;
+uint16_t numOfFailures = 0;
+
+void check_value (const char *namePtr, uint32_t value, uint32_t expected)
+{
+	if(value != expected){
+		printf("FAIL %s: %lu, expected %lu\n",namePtr,(unsigned long)value,(unsigned long)expected);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+void check_true (const char *namePtr, uint8_t condition)
+{
+	if(!condition){
+		printf("FAIL %s\n",namePtr);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+/*time in nanoseconds*/
+uint64_t get_time (void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC,&now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+uint32_t random_get (void)
+{
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+	return randomState;
+}
+
+/*reference test: spans overlap if they intersect at some shift of whole screen (object off screen is drawn on opposite side)*/
+uint8_t reference_span_overlap (int32_t a, uint16_t aLength, int32_t b, uint16_t bLength, uint16_t size)
+{
+	if(aLength == 0 || bLength == 0){
+		return 0;
+	}
+
+	if(aLength >= size || bLength >= size){
+		return 1;
+	}
+
+	a = ((a % size) + size) % size;
+	b = ((b % size) + size) % size;
+
+	for(int32_t shift = -(int32_t)size; shift <= size; shift += size){
+		if(a < b + shift + bLength && b + shift < a + aLength){
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+uint32_t find_pairs_brute_force (uint16_t numOfObjects, uint16_t screenWidth, uint16_t screenHeight)
+{
+	uint32_t numOfPairs = 0;
+
+	memset(bruteForcePairs,0,sizeof(bruteForcePairs));
+
+	for(uint16_t i = 0; i < numOfObjects; i++){
+		for(uint16_t j = i + 1; j < numOfObjects; j++){
+			if(reference_span_overlap(Object[i].x,Object[i].width,Object[j].x,Object[j].width,screenWidth)
+				&& reference_span_overlap(Object[i].y,Object[i].height,Object[j].y,Object[j].height,screenHeight)){
+				bruteForcePairs[i][j/32] |= 1UL << (j % 32);
+				numOfPairs++;
+			}
+		}
+	}
+
+	return numOfPairs;
+}
+
+/*return number of pairs, or 0xFFFFFFFF when grid is full or a query report an id twice*/
+uint32_t find_pairs_grid (uint16_t numOfObjects)
+{
+	uint32_t numOfPairs = 0;
+
+	memset(gridPairs,0,sizeof(gridPairs));
+	spatial_grid_clear(&grid);
+
+	for(uint16_t i = 0; i < numOfObjects; i++){
+		if(spatial_grid_insert(&grid,i,Object[i].x,Object[i].y,Object[i].width,Object[i].height) != SPATIAL_GRID_OK){
+			return 0xFFFFFFFF;
+		}
+	}
+
+	for(uint16_t i = 0; i < numOfObjects; i++){
+		uint16_t numOfCandidates = spatial_grid_query(&grid,Object[i].x,Object[i].y,Object[i].width,Object[i].height,queryResult,GRID_TEST_MAX_OBJECTS);
+
+		for(uint16_t k = 0; k < numOfCandidates; k++){
+			uint16_t j = queryResult[k];
+
+			if(j <= i){
+				continue;
+			}
+
+			if(gridPairs[i][j/32] & (1UL << (j % 32))){
+				return 0xFFFFFFFF;
+			}
+
+			if(spatial_grid_overlap(&grid,Object[i].x,Object[i].y,Object[i].width,Object[i].height,
+				Object[j].x,Object[j].y,Object[j].width,Object[j].height) == SPATIAL_GRID_OVERLAP_TRUE){
+				gridPairs[i][j/32] |= 1UL << (j % 32);
+				numOfPairs++;
+			}
+		}
+	}
+
+	return numOfPairs;
+}
+
+/*compare both methods on objects placed by caller*/
+void compare_methods (const char *namePtr, uint16_t numOfObjects, uint16_t screenWidth, uint16_t screenHeight)
+{
+	char name[100];
+	uint32_t numOfPairs;
+
+	spatial_grid_init(&grid,screenWidth,screenHeight);
+
+	numOfPairs = find_pairs_brute_force(numOfObjects,screenWidth,screenHeight);
+
+	snprintf(name,sizeof(name),"%s: grid pairs (%lu)",namePtr,(unsigned long)numOfPairs);
+	check_value(name,find_pairs_grid(numOfObjects),numOfPairs);
+
+	snprintf(name,sizeof(name),"%s: same pairs",namePtr);
+	check_true(name,memcmp(bruteForcePairs,gridPairs,sizeof(gridPairs)) == 0);
+}
+
+/*1 large asteroid out of 7 objects, other are medium asteroids and rockets (as test_spatial_grid_benchmark.c)*/
+void place_random_objects (uint16_t numOfObjects, uint16_t screenWidth, uint16_t screenHeight)
+{
+	for(uint16_t i = 0; i < numOfObjects; i++){
+		uint32_t random = random_get();
+
+		Object[i].x = (int16_t)(random % screenWidth);
+		Object[i].y = (int16_t)((random >> 12) % screenHeight);
+
+		if(i % 7 == 0){
+			Object[i].width = 50;
+			Object[i].height = 42;
+		}else if(random & (1UL << 30)){
+			Object[i].width = 27;
+			Object[i].height = 25;
+		}else{
+			Object[i].width = 13;
+			Object[i].height = 22;
+		}
+	}
+}
+
+void test_random_scenes (void)
+{
+	const uint16_t numOfObjectSweep[] = {15,50,100,250,500,1000};
+	char name[40];
+
+	printf("-- random scenes on 320x240 screen\n");
+
+	for(uint8_t sweep = 0; sweep < sizeof(numOfObjectSweep)/sizeof(numOfObjectSweep[0]); sweep++){
+		uint16_t numOfObjects = numOfObjectSweep[sweep];
+		uint64_t start, bruteForceTime, gridTime;
+
+		place_random_objects(numOfObjects,320,240);
+		snprintf(name,sizeof(name),"%u objects",numOfObjects);
+		compare_methods(name,numOfObjects,320,240);
+
+		start = get_time();
+		for(uint8_t run = 0; run < GRID_TEST_REPEAT; run++){
+			find_pairs_brute_force(numOfObjects,320,240);
+		}
+		bruteForceTime = (get_time() - start)/GRID_TEST_REPEAT;
+
+		start = get_time();
+		for(uint8_t run = 0; run < GRID_TEST_REPEAT; run++){
+			find_pairs_grid(numOfObjects);
+		}
+		gridTime = (get_time() - start)/GRID_TEST_REPEAT;
+
+		printf("   brute force %8.1f us, grid %8.1f us\n",bruteForceTime/1e3,gridTime/1e3);
+	}
+}
+
+void test_edge_scenes (void)
+{
+	printf("-- edge scenes\n");
+
+	/*objects straddling every edge and corner, and copies wrapped by whole screen*/
+	Object[0] = (Rect_t){310,100,27,25};	/*right edge*/
+	Object[1] = (Rect_t){5,110,13,22};		/*overlap object 0 through right edge*/
+	Object[2] = (Rect_t){100,230,50,42};	/*bottom edge*/
+	Object[3] = (Rect_t){120,10,13,22};		/*overlap object 2 through bottom edge*/
+	Object[4] = (Rect_t){-10,-10,27,25};	/*top left corner, negative position*/
+	Object[5] = (Rect_t){315,235,13,22};	/*bottom right corner, overlap object 4 through both edges*/
+	Object[6] = (Rect_t){330,250,13,22};	/*same as (10,10) on screen*/
+	Object[7] = (Rect_t){-300,-220,13,22};	/*same as (20,20) on screen*/
+	compare_methods("edges and corners",8,320,240);
+	check_true("wrap across right edge found",(gridPairs[0][0] >> 1) & 1);
+	check_true("wrap across both edges found",(gridPairs[4][0] >> 5) & 1);
+
+	/*objects touching without overlapping, at cell boundaries and across screen edge*/
+	Object[0] = (Rect_t){0,0,32,32};
+	Object[1] = (Rect_t){32,0,32,32};
+	Object[2] = (Rect_t){0,32,32,32};
+	Object[3] = (Rect_t){288,0,32,32};
+	Object[4] = (Rect_t){0,208,32,32};
+	Object[5] = (Rect_t){31,31,1,1};	/*overlap object 0 only*/
+	compare_methods("touching objects",6,320,240);
+	check_value("touching objects: 1 pair",find_pairs_grid(6),1);
+
+	/*objects as large as screen overlap everything, empty objects overlap nothing*/
+	Object[0] = (Rect_t){50,60,320,10};
+	Object[1] = (Rect_t){0,0,13,22};
+	Object[2] = (Rect_t){200,100,27,240};
+	Object[3] = (Rect_t){5,5,0,0};
+	compare_methods("screen sized objects",4,320,240);
+
+	/*screen size not a multiple of cell size: last column and row are narrower, wrap still join them with first ones*/
+	place_random_objects(200,250,170);
+	for(uint16_t i = 0; i < 20; i++){
+		Object[i].x = 240 + (i % 5);
+		Object[i].y = 160 + (i % 7);
+	}
+	compare_methods("250x170 screen",200,250,170);
+
+	/*screen wider than grid capacity: objects in uncovered columns are never found by grid*/
+	spatial_grid_init(&grid,(SPATIAL_GRID_MAX_COLUMNS + 1)*SPATIAL_GRID_CELL_SIZE,240);
+	check_value("columns limited to grid capacity",grid.numOfColumns,SPATIAL_GRID_MAX_COLUMNS);
+}
+
+int main (void)
+{
+	test_edge_scenes();
+	test_random_scenes();
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
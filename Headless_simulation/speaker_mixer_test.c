@@ -0,0 +1,440 @@
+/**
+*@brief Check speaker mixer on PC and measure its cost per sample
+*
+*This program run speaker driver (Device_drivers/src/speaker.c) with stub timer driver and emulated DAC fed by DMA (headless_dac.c).
+*Known sample arrays are mixed and output buffer is compared with expected samples: single voice, sum of voices, volume, saturation
+*into 12 bits, looping voice, voice freed at its end, ADPCM voice decoded across blocks and loop, ADPCM voice at half sample rate interpolated across blocks, loop and end, synthesizer note rendered across blocks until end of its release, voice stealing by priority, and samples output by DAC (block buffers refilled
+*on DMA half transfer and transfer complete, or written by timer interrupt when speaker driver is built without SPEAKER_USE_DMA).
+*Then 4 looping voices (12 bits samples, ADPCM, then ADPCM resampled from 2/3 of sample rate) are mixed for a while and time per output sample is printed (CPU cycles on x86 PC).
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 -DSTM32F407xx -ICMSIS/Include -ICMSIS/Device/ST/STM32F4xx/Include
+*Headless_simulation/speaker_mixer_test.c Headless_simulation/headless_dac.c Device_drivers/src/speaker.c Miscellaneous/src/adpcm.c
+*Miscellaneous/src/synth.c -o speaker_mixer_test
+*
+*Run:
+*speaker_mixer_test
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "headless_dac.h"
+#include "../Device_drivers/inc/speaker.h"
+#include "../Miscellaneous/inc/notes.h"
+#include <stdio.h>
+#include <time.h>
+
+#define MIXER_TEST_MAX_SAMPLES		256
+#define MIXER_BENCHMARK_SAMPLES		(1024*1024)
+#define MIXER_TEST_SAMPLE_RATE		(42000000/(10*680))	/*speaker_init(DAC_CHANNEL_1,9,679) with 42MHz timer clock*/
+
+#ifndef SPEAKER_USE_DMA
+extern void TIM7_IRQHandler (void);
+#endif
+
+extern DAC_Handle_t DACxHandle;
+
+/*stub timer and RCC drivers*/
+uint16_t dacOutput[MIXER_TEST_MAX_SAMPLES];
+uint8_t timerRunning = STOP;
+
+uint16_t numOfFailures = 0;
+
+const uint16_t rampSound[8] = {2048,2148,2248,2348,2448,2548,2648,2748};
+const uint16_t lowSound[6] = {1048,1548,2048,2548,3048,3548};
+const uint16_t maxSound[4] = {4095,4095,4095,4095};
+const uint16_t minSound[4] = {0,0,0,0};
+const uint16_t shortSound[5] = {2049,2050,2051,2052,2053};
+uint16_t longSound[MIXER_TEST_MAX_SAMPLES];
+uint8_t ADPCMData[MIXER_TEST_MAX_SAMPLES/2];
+ADPCM_Sound_t ADPCMSound = {ADPCMData,45,{0,0},MIXER_TEST_SAMPLE_RATE};	/*at speaker rate, not resampled*/
+ADPCM_Sound_t halfRateSound = {ADPCMData,45,{0,0},MIXER_TEST_SAMPLE_RATE/2};
+ADPCM_Sound_t resampledSound = {ADPCMData,45,{0,0},MIXER_TEST_SAMPLE_RATE*2/3};
+
+void TIM_init_direct(TIM_TypeDef *TIMxPtr,uint16_t reloadVal,uint16_t preScaler)
+{
+}
+
+void TIM_ctr(TIM_TypeDef *TIMxPtr, uint8_t startOrStop)
+{
+	timerRunning = startOrStop;
+}
+
+void TIM_interrupt_ctr(TIM_TypeDef *TIMxPtr, uint8_t enOrDis)
+{
+}
+
+void TIM_intrpt_vector_ctr (uint8_t IRQnumber, uint8_t enOrDis)
+{
+}
+
+void TIM_intrpt_handler (TIM_TypeDef *TIMxPtr)
+{
+}
+
+void TIM_update_event_TRGO (TIM_TypeDef *TIMxPtr)
+{
+}
+
+/*timers on APB1 after RCC_set_SYSCLK_PLL_84_MHz*/
+int32_t RCC_get_TIMCLK_value(uint8_t APBx)
+{
+	return 42000000;
+}
+
+/*compare mixed samples with expected ones, report first different sample*/
+void check_samples (const char *namePtr, const uint16_t *bufferPtr, const uint16_t *expectedPtr, uint16_t numOfSamples)
+{
+	for(uint16_t i = 0; i < numOfSamples; i++){
+		if(bufferPtr[i] != expectedPtr[i]){
+			printf("FAIL %s: sample %u is %u, expected %u\n",namePtr,i,bufferPtr[i],expectedPtr[i]);
+			numOfFailures++;
+			return;
+		}
+	}
+
+	printf("pass %s\n",namePtr);
+}
+
+void check_value (const char *namePtr, uint32_t value, uint32_t expected)
+{
+	if(value != expected){
+		printf("FAIL %s: %lu, expected %lu\n",namePtr,(unsigned long)value,(unsigned long)expected);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+void test_mix (void)
+{
+	uint16_t buffer[MIXER_TEST_MAX_SAMPLES];
+	uint16_t expected[MIXER_TEST_MAX_SAMPLES];
+
+	/*single voice at full volume is output unchanged, then silence*/
+	speaker_play_voice(rampSound,8,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_ONCE);
+	speaker_mix_block(buffer,12);
+	for(uint16_t i = 0; i < 12; i++){
+		expected[i] = (i < 8) ? rampSound[i] : SPEAKER_SAMPLE_MIDPOINT;
+	}
+	check_samples("single voice",buffer,expected,12);
+	check_value("voice freed at end of sound",speaker_find_voice(rampSound),SPEAKER_NO_VOICE);
+	speaker_stop_sound();
+
+	/*2 voices are summed around midpoint*/
+	speaker_play_voice(rampSound,8,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_ONCE);
+	speaker_play_voice(lowSound,6,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_ONCE);
+	speaker_mix_block(buffer,8);
+	for(uint16_t i = 0; i < 8; i++){
+		expected[i] = rampSound[i] + ((i < 6) ? lowSound[i] - SPEAKER_SAMPLE_MIDPOINT : 0);
+	}
+	check_samples("sum of 2 voices",buffer,expected,8);
+	speaker_stop_sound();
+
+	/*half volume*/
+	speaker_play_voice(lowSound,6,SPEAKER_VOLUME_HALF,0,SPEAKER_PLAY_ONCE);
+	speaker_mix_block(buffer,6);
+	for(uint16_t i = 0; i < 6; i++){
+		expected[i] = SPEAKER_SAMPLE_MIDPOINT + ((int16_t)lowSound[i] - SPEAKER_SAMPLE_MIDPOINT)/2;
+	}
+	check_samples("half volume",buffer,expected,6);
+	speaker_stop_sound();
+
+	/*sum of voices is saturated, not wrapped around*/
+	for(uint8_t voice = 0; voice < SPEAKER_NUM_OF_VOICES; voice++){
+		speaker_play_voice(maxSound,4,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_ONCE);
+	}
+	speaker_mix_block(buffer,4);
+	for(uint16_t i = 0; i < 4; i++){
+		expected[i] = SPEAKER_SAMPLE_MAX;
+	}
+	check_samples("saturation at top",buffer,expected,4);
+	speaker_stop_sound();
+
+	for(uint8_t voice = 0; voice < SPEAKER_NUM_OF_VOICES; voice++){
+		speaker_play_voice(minSound,4,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_ONCE);
+	}
+	speaker_mix_block(buffer,4);
+	for(uint16_t i = 0; i < 4; i++){
+		expected[i] = 0;
+	}
+	check_samples("saturation at bottom",buffer,expected,4);
+	speaker_stop_sound();
+
+	/*looping voice start again at its end, across blocks*/
+	speaker_play_voice(shortSound,5,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_LOOP);
+	speaker_mix_block(buffer,7);
+	speaker_mix_block(buffer + 7,SPEAKER_BLOCK_SIZE + 3);
+	for(uint16_t i = 0; i < SPEAKER_BLOCK_SIZE + 10; i++){
+		expected[i] = shortSound[i % 5];
+	}
+	check_samples("looping voice",buffer,expected,SPEAKER_BLOCK_SIZE + 10);
+	check_value("looping voice still playing",speaker_find_voice(shortSound) != SPEAKER_NO_VOICE,1);
+	speaker_stop_sound();
+
+	/*ADPCM voice output decoded samples scaled to 12 bits, decoder restart from initial state at loop point*/
+	ADPCM_State_t state = ADPCMSound.initialState;
+	int16_t decoded[45];
+
+	adpcm_decode_block(&state,ADPCMData,0,decoded,45);
+	speaker_play_ADPCM_voice(&ADPCMSound,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_LOOP);
+	speaker_mix_block(buffer,20);
+	speaker_mix_block(buffer + 20,SPEAKER_BLOCK_SIZE + 50);
+	for(uint16_t i = 0; i < SPEAKER_BLOCK_SIZE + 70; i++){
+		expected[i] = SPEAKER_SAMPLE_MIDPOINT + (decoded[i % 45] >> SPEAKER_16_BITS_SCALE_SHIFT);
+	}
+	check_samples("looping ADPCM voice",buffer,expected,SPEAKER_BLOCK_SIZE + 70);
+	check_value("ADPCM voice found by its sound",speaker_find_voice(&ADPCMSound) != SPEAKER_NO_VOICE,1);
+	speaker_stop_sound();
+}
+
+void test_note (void)
+{
+	const Synth_Instrument_t instrument = {SYNTH_WAVE_TRIANGLE,2,3,128,4};
+	uint16_t buffer[MIXER_TEST_MAX_SAMPLES];
+	uint16_t expected[MIXER_TEST_MAX_SAMPLES];
+	int16_t rendered[MIXER_TEST_MAX_SAMPLES];
+	Synth_Voice_t note = {0};
+	uint16_t length;
+	uint8_t voice;
+
+	check_value("sample rate from timer clock",speaker_get_sample_rate(),MIXER_TEST_SAMPLE_RATE);
+
+	/*note of 10 ms is rendered across blocks and voice is freed at end of its release*/
+	synth_note_on(&note,&instrument,noteA5,10,speaker_get_sample_rate());
+	length = synth_render(&note,rendered,MIXER_TEST_MAX_SAMPLES);
+	for(uint16_t i = 0; i < MIXER_TEST_MAX_SAMPLES; i++){
+		expected[i] = SPEAKER_SAMPLE_MIDPOINT + ((i < length) ? rendered[i] >> SPEAKER_16_BITS_SCALE_SHIFT : 0);
+	}
+
+	check_value("rest is not played",speaker_play_note(&instrument,Rest,10,SPEAKER_VOLUME_FULL,0),SPEAKER_NO_VOICE);
+	speaker_play_note(&instrument,noteA5,10,SPEAKER_VOLUME_FULL,0);
+	speaker_mix_block(buffer,10);
+	speaker_mix_block(buffer + 10,MIXER_TEST_MAX_SAMPLES - 10);
+	check_samples("note of synthesizer",buffer,expected,MIXER_TEST_MAX_SAMPLES);
+	check_value("note end in its release time",(length > 10*speaker_get_sample_rate()/1000) && (length <= 14*speaker_get_sample_rate()/1000 + 1),1);
+	check_value("voice freed at end of note",speaker_find_voice(&instrument),SPEAKER_NO_VOICE);
+
+	/*held note play until it is released*/
+	voice = speaker_play_note(&instrument,noteA5,0,SPEAKER_VOLUME_FULL,0);
+	speaker_mix_block(buffer,MIXER_TEST_MAX_SAMPLES);
+	check_value("held note still playing",speaker_find_voice(&instrument),voice);
+	speaker_release_note(voice);
+	speaker_mix_block(buffer,MIXER_TEST_MAX_SAMPLES);
+	check_value("released note end",speaker_find_voice(&instrument),SPEAKER_NO_VOICE);
+	speaker_stop_sound();
+}
+
+/*expected output of sound at half sample rate: decoded samples and midpoints between them, toward silence after end of sound played once*/
+void interpolate_half_rate (const int16_t *decodedPtr, uint16_t *expectedPtr, uint16_t numOfSamples, uint8_t playMode)
+{
+	for(uint16_t i = 0; i < numOfSamples; i++){
+		uint16_t position = (i/2) % 45, next = (position + 1) % 45;
+		int32_t previousSample = decodedPtr[position];
+		int32_t nextSample = ((playMode != SPEAKER_PLAY_LOOP) && (position == 44)) ? 0 : decodedPtr[next];
+		int32_t sample = (i & 1) ? previousSample + ((nextSample - previousSample) >> 1) : previousSample;
+
+		expectedPtr[i] = ((playMode != SPEAKER_PLAY_LOOP) && (i >= 90)) ? SPEAKER_SAMPLE_MIDPOINT : SPEAKER_SAMPLE_MIDPOINT + (sample >> SPEAKER_16_BITS_SCALE_SHIFT);
+	}
+}
+
+void test_resample (void)
+{
+	uint16_t buffer[MIXER_TEST_MAX_SAMPLES];
+	uint16_t expected[MIXER_TEST_MAX_SAMPLES];
+	ADPCM_State_t state = ADPCMSound.initialState;
+	int16_t decoded[45];
+
+	adpcm_decode_block(&state,ADPCMData,0,decoded,45);
+
+	/*sound at half sample rate is played at half speed, looping sound is interpolated from its last sample to its first one*/
+	speaker_play_ADPCM_voice(&halfRateSound,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_LOOP);
+	speaker_mix_block(buffer,21);
+	speaker_mix_block(buffer + 21,SPEAKER_BLOCK_SIZE + 100);
+	interpolate_half_rate(decoded,expected,SPEAKER_BLOCK_SIZE + 121,SPEAKER_PLAY_LOOP);
+	check_samples("looping ADPCM voice at half sample rate",buffer,expected,SPEAKER_BLOCK_SIZE + 121);
+	speaker_stop_sound();
+
+	/*sound played once fade to silence after its last sample and voice is freed*/
+	speaker_play_ADPCM_voice(&halfRateSound,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_ONCE);
+	speaker_mix_block(buffer,33);
+	speaker_mix_block(buffer + 33,67);
+	interpolate_half_rate(decoded,expected,100,SPEAKER_PLAY_ONCE);
+	check_samples("ADPCM voice at half sample rate played once",buffer,expected,100);
+	check_value("voice freed at end of resampled sound",speaker_find_voice(&halfRateSound),SPEAKER_NO_VOICE);
+	speaker_stop_sound();
+}
+
+void test_voice_stealing (void)
+{
+	uint8_t voice[SPEAKER_NUM_OF_VOICES];
+	uint16_t buffer[4];
+
+	/*voices of priority 1, 1, 2, 3, second voice of priority 1 is closer to its end*/
+	voice[0] = speaker_play_voice(longSound,MIXER_TEST_MAX_SAMPLES,SPEAKER_VOLUME_FULL,1,SPEAKER_PLAY_ONCE);
+	voice[1] = speaker_play_voice(rampSound,8,SPEAKER_VOLUME_FULL,1,SPEAKER_PLAY_ONCE);
+	voice[2] = speaker_play_voice(lowSound,6,SPEAKER_VOLUME_FULL,2,SPEAKER_PLAY_ONCE);
+	voice[3] = speaker_play_voice(shortSound,5,SPEAKER_VOLUME_FULL,3,SPEAKER_PLAY_LOOP);
+	speaker_mix_block(buffer,4);
+
+	check_value("lower priority is not played when voices are full",speaker_play_voice(maxSound,4,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_ONCE),SPEAKER_NO_VOICE);
+	check_value("lowest priority voice closest to its end is stolen",speaker_play_voice(minSound,4,SPEAKER_VOLUME_FULL,2,SPEAKER_PLAY_ONCE),voice[1]);
+	check_value("stolen sound is no longer playing",speaker_find_voice(rampSound),SPEAKER_NO_VOICE);
+	check_value("same priority steal voice",speaker_play_voice(maxSound,4,SPEAKER_VOLUME_FULL,1,SPEAKER_PLAY_ONCE),voice[0]);
+	check_value("highest priority voice is kept",speaker_find_voice(shortSound),voice[3]);
+
+	speaker_stop_voice(voice[2]);
+	check_value("stopped voice is reused",speaker_play_voice(rampSound,8,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_ONCE),voice[2]);
+	speaker_stop_sound();
+}
+
+#ifdef SPEAKER_USE_DMA
+void test_DMA_output (void)
+{
+	uint16_t expected[MIXER_TEST_MAX_SAMPLES] = {0};
+	uint16_t numOfTriggers = 0;
+
+	check_value("DAC triggered by speaker timer",DACxHandle.DACxConfigPtr->triggerEV,SPEAKER_DAC_TRIGGER_EV);
+
+	headless_dac_set_output(dacOutput,MIXER_TEST_MAX_SAMPLES);
+	speaker_play_voice(longSound,40,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_ONCE);
+	check_value("timer started by first sound",timerRunning,START);
+	check_value("DMA started by first sound",headless_dac_DMA_running_check(),1);
+
+	/*blocks start silent and are refilled at half transfer and transfer complete, DMA keep running until block holding end of sound is output*/
+	while(headless_dac_DMA_running_check() && numOfTriggers < MIXER_TEST_MAX_SAMPLES){
+		headless_dac_trigger(1);
+		numOfTriggers++;
+	}
+
+	for(uint16_t i = 0; i < numOfTriggers; i++){
+		expected[i] = (i >= 2*SPEAKER_BLOCK_SIZE && i < 2*SPEAKER_BLOCK_SIZE + 40) ? longSound[i - 2*SPEAKER_BLOCK_SIZE] : SPEAKER_SAMPLE_MIDPOINT;
+	}
+	check_samples("samples output by DAC through DMA",dacOutput,expected,numOfTriggers);
+	check_value("DMA stopped after last block holding sound",numOfTriggers,2*SPEAKER_BLOCK_SIZE + (40 + SPEAKER_BLOCK_SIZE - 1)/SPEAKER_BLOCK_SIZE*SPEAKER_BLOCK_SIZE);
+	check_value("timer stopped with DMA",timerRunning,STOP);
+
+	/*sound played while DMA run is mixed at next half transfer*/
+	headless_dac_set_output(dacOutput,MIXER_TEST_MAX_SAMPLES);
+	speaker_play_voice(rampSound,8,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_ONCE);
+	headless_dac_trigger(SPEAKER_BLOCK_SIZE + 1);
+	speaker_play_voice(lowSound,6,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_ONCE);
+	headless_dac_trigger(3*SPEAKER_BLOCK_SIZE);
+	check_value("first sound start 2 blocks later",dacOutput[2*SPEAKER_BLOCK_SIZE],rampSound[0]);
+	check_value("second sound start one block later",dacOutput[3*SPEAKER_BLOCK_SIZE],lowSound[0]);
+	speaker_stop_sound();
+	check_value("DMA stopped by speaker_stop_sound",headless_dac_DMA_running_check(),0);
+}
+#else
+void test_timer_output (void)
+{
+	uint16_t expected[MIXER_TEST_MAX_SAMPLES] = {0};
+	uint16_t numOfInterrupts = 0;
+
+	headless_dac_set_output(dacOutput,MIXER_TEST_MAX_SAMPLES);
+	speaker_play_voice(longSound,40,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_ONCE);
+	check_value("timer started by first sound",timerRunning,START);
+
+	/*timer keep running until block holding end of sound is played*/
+	while(timerRunning == START && numOfInterrupts < MIXER_TEST_MAX_SAMPLES){
+		TIM7_IRQHandler();
+		numOfInterrupts++;
+	}
+
+	for(uint16_t i = 0; i < numOfInterrupts; i++){
+		expected[i] = (i < 40) ? longSound[i] : SPEAKER_SAMPLE_MIDPOINT;
+	}
+	check_samples("samples written to DAC by timer interrupt",dacOutput,expected,numOfInterrupts);
+	check_value("timer stopped after last block holding sound",numOfInterrupts,(40 + SPEAKER_BLOCK_SIZE - 1)/SPEAKER_BLOCK_SIZE*SPEAKER_BLOCK_SIZE);
+
+	/*sound played while timer run start on block after next one*/
+	headless_dac_set_output(dacOutput,MIXER_TEST_MAX_SAMPLES);
+	speaker_play_voice(rampSound,8,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_ONCE);
+	TIM7_IRQHandler();
+	speaker_play_voice(lowSound,6,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_ONCE);
+	for(uint16_t i = 1; i < 3*SPEAKER_BLOCK_SIZE; i++){
+		TIM7_IRQHandler();
+	}
+	check_value("second sound start 2 blocks later",dacOutput[2*SPEAKER_BLOCK_SIZE],lowSound[0]);
+	speaker_stop_sound();
+}
+#endif
+
+void benchmark_mix (const ADPCM_Sound_t *SoundPtr)
+{
+	static uint16_t buffer[SPEAKER_BLOCK_SIZE];
+	struct timespec start, end;
+	double seconds;
+
+	for(uint8_t voice = 0; voice < SPEAKER_NUM_OF_VOICES; voice++){
+		if(SoundPtr != NULL){
+			speaker_play_ADPCM_voice(SoundPtr,SPEAKER_VOLUME_HALF,voice,SPEAKER_PLAY_LOOP);
+		}else{
+			speaker_play_voice(longSound + voice,MIXER_TEST_MAX_SAMPLES - voice,SPEAKER_VOLUME_HALF,0,SPEAKER_PLAY_LOOP);
+		}
+	}
+
+	clock_gettime(CLOCK_MONOTONIC,&start);
+#if defined (__x86_64__) || defined (__i386__)
+	uint64_t startCycles = __builtin_ia32_rdtsc();
+#endif
+
+	for(uint32_t i = 0; i < MIXER_BENCHMARK_SAMPLES/SPEAKER_BLOCK_SIZE; i++){
+		speaker_mix_block(buffer,SPEAKER_BLOCK_SIZE);
+		__asm__ volatile("" : : "r"(buffer) : "memory");
+	}
+
+#if defined (__x86_64__) || defined (__i386__)
+	uint64_t cycles = __builtin_ia32_rdtsc() - startCycles;
+#endif
+	clock_gettime(CLOCK_MONOTONIC,&end);
+	seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec)*1e-9;
+
+	printf("%u %s voices, %u samples per block: %.2f ns per output sample",SPEAKER_NUM_OF_VOICES,(SoundPtr == NULL) ? "12 bits" : SoundPtr->sampleRate ? "resampled ADPCM" : "ADPCM",
+			SPEAKER_BLOCK_SIZE,seconds*1e9/MIXER_BENCHMARK_SAMPLES);
+#if defined (__x86_64__) || defined (__i386__)
+	printf(", %.1f TSC cycles per output sample",(double)cycles/MIXER_BENCHMARK_SAMPLES);
+#endif
+	printf("\n");
+
+	speaker_stop_sound();
+}
+
+int main (void)
+{
+	for(uint16_t i = 0; i < MIXER_TEST_MAX_SAMPLES; i++){
+		longSound[i] = (i*37) & SPEAKER_SAMPLE_MAX;
+	}
+
+	/*ADPCM sound of 45 samples: ramp up and down*/
+	ADPCM_State_t state = ADPCMSound.initialState;
+	for(uint16_t i = 0; i < ADPCMSound.numOfSamples; i++){
+		int16_t sample = (int16_t)(((i < 23) ? i : 45 - i)*1000);
+		ADPCMData[i/2] |= adpcm_encode_sample(&state,sample) << ((i & 1) ? 4 : 0);
+	}
+
+	speaker_init(DAC_CHANNEL_1,9,679);
+
+	test_mix();
+	test_note();
+	test_resample();
+	test_voice_stealing();
+#ifdef SPEAKER_USE_DMA
+	test_DMA_output();
+#else
+	test_timer_output();
+#endif
+	benchmark_mix(NULL);
+	benchmark_mix(&ADPCMSound);
+	benchmark_mix(&resampledSound);
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
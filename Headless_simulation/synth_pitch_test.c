@@ -0,0 +1,217 @@
+/**
+*@brief Check pitch and envelope of synthesizer notes on PC
+*
+*This program render notes of notes.h (C2 to C7) with synthesizer (Miscellaneous/src/synth.c) at sample rate of speaker and measure their
+*frequency from rising zero crossings (interpolated between samples) over one second: sine, square and triangle notes must be within
+*SYNTH_TEST_MAX_ERROR of frequency defined in notes.h. Envelope is checked as well: attack reach full level in attack time, decay fall to
+*sustain level, note end in its release time (held note after synth_note_off) and instrument without sustain end after its decay.
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 Headless_simulation/synth_pitch_test.c Miscellaneous/src/synth.c -lm -o synth_pitch_test
+*
+*Run:
+*synth_pitch_test [sample rate in Hz]
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../Miscellaneous/inc/synth.h"
+#include "../Miscellaneous/inc/notes.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define SYNTH_TEST_SAMPLE_RATE		6176	/*speaker_init(DAC_CHANNEL_1,9,679) with 42MHz timer clock*/
+#define SYNTH_TEST_MAX_ERROR		0.001	/*relative frequency error*/
+#define SYNTH_TEST_MAX_SAMPLES		48000
+
+typedef struct{
+	const char *name;
+	uint32_t frequency;
+}Test_Note_t;
+
+const Test_Note_t testNote[] = {
+	{"C2",noteC2},{"A2",noteA2},{"C3",noteC3},{"E3",noteE3},{"A3",noteA3},{"C4",noteC4},{"Fs4",noteFs4},{"A4",noteA4},
+	{"C5",noteC5},{"D5",noteD5},{"G5",noteG5},{"A5",noteA5},{"B5",noteB5},{"C6",noteC6},{"D6",noteD6},{"A6",noteA6},{"C7",noteC7},
+};
+
+const char *waveformName[] = {"sine","square","triangle"};
+
+int16_t rendered[SYNTH_TEST_MAX_SAMPLES];
+uint16_t numOfFailures = 0;
+
+void check_value (const char *namePtr, uint32_t value, uint32_t expected)
+{
+	if(value != expected){
+		printf("FAIL %s: %lu, expected %lu\n",namePtr,(unsigned long)value,(unsigned long)expected);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+/*render held note of full level in blocks like speaker mixer*/
+void render_note (const Synth_Instrument_t *InstrumentPtr, uint32_t frequency, uint32_t sampleRate, uint32_t numOfSamples)
+{
+	Synth_Voice_t voice = {0};
+
+	synth_note_on(&voice,InstrumentPtr,frequency,0,sampleRate);
+
+	for(uint32_t i = 0; i < numOfSamples; i += 32){
+		synth_render(&voice,&rendered[i],(numOfSamples - i < 32) ? (uint16_t)(numOfSamples - i) : 32);
+	}
+}
+
+/*frequency from time between first and last rising zero crossings, 0 if less than 2 crossings*/
+double measure_frequency (uint32_t numOfSamples, uint32_t sampleRate)
+{
+	double first = 0, last = 0;
+	uint32_t numOfCrossings = 0;
+
+	for(uint32_t i = 1; i < numOfSamples; i++){
+		if(rendered[i - 1] < 0 && rendered[i] >= 0){
+			double crossing = (i - 1) + (double)-rendered[i - 1] / (rendered[i] - rendered[i - 1]);
+
+			if(!numOfCrossings){
+				first = crossing;
+			}
+			last = crossing;
+			numOfCrossings++;
+		}
+	}
+
+	if(numOfCrossings < 2){
+		return 0;
+	}
+
+	return (numOfCrossings - 1) * (double)sampleRate / (last - first);
+}
+
+void test_pitch (uint32_t sampleRate)
+{
+	double maxError[3] = {0,0,0};
+
+	for(uint8_t waveform = SYNTH_WAVE_SINE; waveform <= SYNTH_WAVE_TRIANGLE; waveform++){
+		const Synth_Instrument_t instrument = {waveform,0,0,SYNTH_SUSTAIN_FULL,0};
+
+		for(uint8_t i = 0; i < sizeof(testNote)/sizeof(testNote[0]); i++){
+			/*note alias from half of sample rate*/
+			if(2*testNote[i].frequency >= sampleRate){
+				continue;
+			}
+
+			render_note(&instrument,testNote[i].frequency,sampleRate,sampleRate);
+
+			double measured = measure_frequency(sampleRate,sampleRate);
+			double error = fabs(measured - testNote[i].frequency) / testNote[i].frequency;
+
+			if(error > maxError[waveform]){
+				maxError[waveform] = error;
+			}
+
+			if(error > SYNTH_TEST_MAX_ERROR){
+				printf("FAIL %s %s: %.3f Hz, expected %lu Hz\n",waveformName[waveform],testNote[i].name,measured,(unsigned long)testNote[i].frequency);
+				numOfFailures++;
+			}
+		}
+
+		printf("%s notes at %lu Hz: largest frequency error %.4f%%\n",waveformName[waveform],(unsigned long)sampleRate,maxError[waveform]*100);
+	}
+}
+
+void test_envelope (uint32_t sampleRate)
+{
+	/*10 ms attack, 20 ms decay to half level, 30 ms release*/
+	const Synth_Instrument_t instrument = {SYNTH_WAVE_SQUARE,10,20,128,30};
+	const Synth_Instrument_t pluck = {SYNTH_WAVE_SINE,0,50,0,0};
+	uint32_t attackSamples = (10*sampleRate + 500)/1000, decaySamples = (20*sampleRate + 500)/1000, releaseSamples = (30*sampleRate + 500)/1000;
+	uint32_t length = 0, count;
+	Synth_Voice_t voice = {0};
+	int32_t peak = 0;
+
+	synth_note_on(&voice,&instrument,noteA4,0,sampleRate);
+	count = synth_render(&voice,rendered,(uint16_t)(attackSamples + 1));
+	for(uint32_t i = 0; i < count; i++){
+		peak = (abs(rendered[i]) > peak) ? abs(rendered[i]) : peak;
+	}
+	check_value("attack reach full level in attack time",peak >= SYNTH_AMPLITUDE_MAX - 1,1);
+
+	/*decay step is rounded down, one more sample may be needed to reach sustain level*/
+	synth_render(&voice,rendered,(uint16_t)(decaySamples + 2));
+	check_value("decay end at sustain level",voice.stage,SYNTH_STAGE_SUSTAIN);
+	synth_render(&voice,rendered,100);
+	peak = 0;
+	for(uint32_t i = 0; i < 100; i++){
+		peak = (rendered[i] > peak) ? rendered[i] : peak;
+	}
+	check_value("sustain level (half of full level)",peak,(uint32_t)(SYNTH_AMPLITUDE_MAX * (int32_t)((SYNTH_ENVELOPE_FULL*128/255) >> 9)) >> 15);
+
+	synth_note_off(&voice);
+	while((count = synth_render(&voice,rendered,32)) == 32){
+		length += 32;
+	}
+	length += count;
+	check_value("released note end in release time",(length + 1 >= releaseSamples) && (length <= releaseSamples + 1),1);
+	check_value("ended note render nothing",synth_render(&voice,rendered,32),0);
+
+	/*note of given duration is released at its end*/
+	synth_note_on(&voice,&instrument,noteA4,100,sampleRate);
+	length = 0;
+	while((count = synth_render(&voice,rendered,32)) == 32){
+		length += 32;
+	}
+	length += count;
+	check_value("note of 100 ms end after its release",(length + 1 >= 130*sampleRate/1000) && (length <= 130*sampleRate/1000 + 2),1);
+
+	/*instrument without sustain end after decay even when note is held*/
+	synth_note_on(&voice,&pluck,noteA4,0,sampleRate);
+	length = 0;
+	while((count = synth_render(&voice,rendered,32)) == 32){
+		length += 32;
+	}
+	length += count;
+	check_value("note without sustain end after its decay",(length + 2 >= (50*sampleRate/1000)) && (length <= 50*sampleRate/1000 + 2),1);
+}
+
+void test_noise (uint32_t sampleRate)
+{
+	const Synth_Instrument_t instrument = {SYNTH_WAVE_NOISE,0,0,SYNTH_SUSTAIN_FULL,0};
+	uint32_t numOfChanges = 0;
+
+	/*noise keep its value for a period of note*/
+	render_note(&instrument,noteA4,sampleRate,sampleRate);
+	for(uint32_t i = 1; i < sampleRate; i++){
+		if(rendered[i] != rendered[i - 1]){
+			numOfChanges++;
+		}
+	}
+	check_value("noise change value once per period",(numOfChanges + 2 >= noteA4) && (numOfChanges <= noteA4),1);
+}
+
+int main (int argc, char *argv[])
+{
+	uint32_t sampleRate = SYNTH_TEST_SAMPLE_RATE;
+
+	if(argc > 1){
+		sampleRate = (uint32_t)strtoul(argv[1],NULL,10);
+	}
+
+	if(sampleRate < 1000 || sampleRate > SYNTH_TEST_MAX_SAMPLES){
+		printf("sample rate must be 1000 Hz to %u Hz\n",SYNTH_TEST_MAX_SAMPLES);
+		return 1;
+	}
+
+	test_pitch(sampleRate);
+	test_envelope(sampleRate);
+	test_noise(sampleRate);
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
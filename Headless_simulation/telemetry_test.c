@@ -0,0 +1,408 @@
+/**
+*@brief Check telemetry stream (COBS framing, CRC, rate limit) on PC and measure its cost against frame time budget
+*
+*This program record a telemetry stream of known frames with telemetry writer (Game_engine_return_to_earth/telemetry.c) and read it
+*back with telemetry reader, like Tools/telemetry_decoder.c does. Every packet must be TELEMETRY_MAX_PACKET_SIZE bytes with no 0x00
+*byte before its delimiter, and must summarize its frames (longest cycle counts, summed SPI bytes, counters of last frame).
+*Recorded stream is then corrupted (flipped byte, lost byte, lost delimiter, stream joined in middle of a packet, line noise): each
+*corruption must cost only the packets it touched, following packets must decode. Packets refused by output must be counted as dropped.
+*Time to add a frame and send its packet is measured: it must stay below 1% of a 30 frames/s frame even on a CPU 100 times slower
+*than PC, and serial line usage at 115200 baud is printed.
+*A stream recorded by headless simulation (rte_headless -t) or captured from game console may be given: it must decode without error
+*and without gap in frame numbers.
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 Headless_simulation/telemetry_test.c Game_engine_return_to_earth/telemetry.c Miscellaneous/src/byte_pack.c -o telemetry_test
+*
+*Run:
+*telemetry_test [recorded stream file]
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../Game_engine_return_to_earth/telemetry.h"
+#include "../Miscellaneous/inc/byte_pack.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define TELEMETRY_TEST_PERIOD			4
+#define TELEMETRY_TEST_NUM_OF_FRAMES	400
+#define TELEMETRY_TEST_NUM_OF_PACKETS	(TELEMETRY_TEST_NUM_OF_FRAMES/TELEMETRY_TEST_PERIOD)
+#define TELEMETRY_TEST_STREAM_SIZE		(TELEMETRY_TEST_NUM_OF_PACKETS*TELEMETRY_MAX_PACKET_SIZE)
+#define TELEMETRY_TEST_FRAME_RATE		30
+#define TELEMETRY_TEST_BAUD_RATE		115200
+#define TELEMETRY_TEST_SLOWDOWN			100		/*target CPU is taken as 100 times slower than PC*/
+#define TELEMETRY_TEST_TIMING_FRAMES	1000000
+
+uint8_t stream[TELEMETRY_TEST_STREAM_SIZE];
+uint32_t streamLength = 0;
+uint32_t numOfOutputs = 0;
+uint8_t refuseOddPackets = 0;
+
+/*packets decoded from a stream*/
+telemetry_frame decoded[2*TELEMETRY_TEST_NUM_OF_PACKETS];
+uint32_t numOfDecoded = 0;
+
+uint16_t numOfFailures = 0;
+
+void check_value (const char *namePtr, uint32_t value, uint32_t expected)
+{
+	if(value != expected){
+		printf("FAIL %s: %lu, expected %lu\n",namePtr,(unsigned long)value,(unsigned long)expected);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+void check_true (const char *namePtr, uint8_t condition)
+{
+	if(!condition){
+		printf("FAIL %s\n",namePtr);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+/*time in nanoseconds*/
+uint64_t get_time (void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC,&now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+uint8_t record_packet (const uint8_t *dataPtr, uint16_t length)
+{
+	if(refuseOddPackets && (numOfOutputs++ & 1)){
+		return 0;
+	}
+
+	if(streamLength + length <= sizeof(stream)){
+		memcpy(stream + streamLength,dataPtr,length);
+		streamLength += length;
+	}
+
+	return 1;
+}
+
+uint8_t discard_packet (const uint8_t *dataPtr, uint16_t length)
+{
+	return 1;
+}
+
+/*counters of frame, cycle counts rise and fall so that longest one is not always last one*/
+void make_frame (uint32_t frameNumber, telemetry_frame *FramePtr)
+{
+	FramePtr->frameNumber = frameNumber;
+	FramePtr->updateCycles = 100000 + (frameNumber*7919) % 50000;
+	FramePtr->drawCycles = 1000000 + (frameNumber*104729) % 700000;
+	FramePtr->collisionCycles = (frameNumber % 3) ? 20000 + frameNumber : 0;
+	FramePtr->SPIbytes = 7000 + frameNumber*13;
+	FramePtr->numOfAsteroids = (frameNumber/10) % 20;
+	FramePtr->numOfRockets = frameNumber % 8;
+	FramePtr->audioUnderruns = frameNumber/100;
+	FramePtr->numOfFrames = 1;
+}
+
+/*write frames 0 to TELEMETRY_TEST_NUM_OF_FRAMES - 1 into stream*/
+void record_stream (telemetry_writer *WriterPtr)
+{
+	telemetry_frame Frame;
+
+	streamLength = 0;
+	numOfOutputs = 0;
+	telemetry_writer_init(WriterPtr,record_packet,TELEMETRY_TEST_PERIOD);
+
+	for(uint32_t i = 0; i < TELEMETRY_TEST_NUM_OF_FRAMES; i++){
+		make_frame(i,&Frame);
+		telemetry_write_frame(WriterPtr,&Frame);
+	}
+}
+
+void decode_stream (telemetry_reader *ReaderPtr, const uint8_t *dataPtr, uint32_t length)
+{
+	telemetry_frame Frame;
+
+	telemetry_reader_init(ReaderPtr);
+	numOfDecoded = 0;
+
+	for(uint32_t i = 0; i < length; i++){
+		if(telemetry_read_byte(ReaderPtr,dataPtr[i],&Frame) == TELEMETRY_PACKET && numOfDecoded < sizeof(decoded)/sizeof(decoded[0])){
+			decoded[numOfDecoded++] = Frame;
+		}
+	}
+}
+
+/*packet must hold summary of frames (packet*period) to (packet*period + period - 1)*/
+uint8_t check_summary (const telemetry_frame *PacketPtr, uint32_t packet)
+{
+	telemetry_frame Frame, Expected;
+	uint32_t SPIbytes = 0;
+
+	make_frame(packet*TELEMETRY_TEST_PERIOD,&Expected);
+
+	for(uint32_t i = 0; i < TELEMETRY_TEST_PERIOD; i++){
+		make_frame(packet*TELEMETRY_TEST_PERIOD + i,&Frame);
+
+		Expected.updateCycles = (Frame.updateCycles > Expected.updateCycles) ? Frame.updateCycles : Expected.updateCycles;
+		Expected.drawCycles = (Frame.drawCycles > Expected.drawCycles) ? Frame.drawCycles : Expected.drawCycles;
+		Expected.collisionCycles = (Frame.collisionCycles > Expected.collisionCycles) ? Frame.collisionCycles : Expected.collisionCycles;
+		SPIbytes += Frame.SPIbytes;
+	}
+
+	return PacketPtr->frameNumber == Frame.frameNumber && PacketPtr->numOfFrames == TELEMETRY_TEST_PERIOD
+		&& PacketPtr->updateCycles == Expected.updateCycles && PacketPtr->drawCycles == Expected.drawCycles
+		&& PacketPtr->collisionCycles == Expected.collisionCycles && PacketPtr->SPIbytes == SPIbytes
+		&& PacketPtr->numOfAsteroids == Frame.numOfAsteroids && PacketPtr->numOfRockets == Frame.numOfRockets
+		&& PacketPtr->audioUnderruns == Frame.audioUnderruns;
+}
+
+/*index of first decoded packet summarizing frames of given packet, numOfDecoded when it is missing*/
+uint32_t find_packet (uint32_t packet)
+{
+	uint32_t i = 0;
+
+	while(i < numOfDecoded && decoded[i].frameNumber != packet*TELEMETRY_TEST_PERIOD + TELEMETRY_TEST_PERIOD - 1){
+		i++;
+	}
+
+	return i;
+}
+
+void test_recorded_stream (void)
+{
+	telemetry_writer Writer;
+	telemetry_reader Reader;
+	uint32_t numOfZeros = 0;
+	uint32_t numOfGoodSummaries = 0;
+
+	printf("-- recorded stream\n");
+	check_value("CRC-16/CCITT-FALSE of \"123456789\"",byte_pack_crc16((const uint8_t*)"123456789",9),0x29B1);
+	record_stream(&Writer);
+
+	check_value("packets sent",Writer.numOfPackets,TELEMETRY_TEST_NUM_OF_PACKETS);
+	check_value("bytes sent",Writer.numOfBytes,TELEMETRY_TEST_STREAM_SIZE);
+	check_value("stream length",streamLength,TELEMETRY_TEST_STREAM_SIZE);
+
+	for(uint32_t i = 0; i < streamLength; i++){
+		if(!stream[i]){
+			numOfZeros++;
+			if(i % TELEMETRY_MAX_PACKET_SIZE != TELEMETRY_MAX_PACKET_SIZE - 1){
+				break;
+			}
+		}
+	}
+	check_value("0x00 only as delimiter at end of each packet",numOfZeros,TELEMETRY_TEST_NUM_OF_PACKETS);
+
+	decode_stream(&Reader,stream,streamLength);
+	check_value("packets decoded",numOfDecoded,TELEMETRY_TEST_NUM_OF_PACKETS);
+	check_value("corrupted packets",Reader.numOfErrors,0);
+
+	for(uint32_t i = 0; i < numOfDecoded; i++){
+		numOfGoodSummaries += check_summary(&decoded[i],i);
+	}
+	check_value("packets holding summary of their frames",numOfGoodSummaries,TELEMETRY_TEST_NUM_OF_PACKETS);
+}
+
+/*every byte value, including 0x00 and 0xFF in every field, must survive COBS*/
+void test_extreme_values (void)
+{
+	telemetry_writer Writer;
+	telemetry_reader Reader;
+	telemetry_frame Frame;
+
+	printf("-- extreme values\n");
+	streamLength = 0;
+	numOfOutputs = 0;
+	telemetry_writer_init(&Writer,record_packet,1);
+
+	memset(&Frame,0,sizeof(Frame));
+	telemetry_write_frame(&Writer,&Frame);
+
+	Frame.frameNumber = Frame.updateCycles = Frame.drawCycles = Frame.collisionCycles = Frame.SPIbytes = UINT32_MAX;
+	Frame.numOfAsteroids = Frame.numOfRockets = Frame.audioUnderruns = UINT16_MAX;
+	telemetry_write_frame(&Writer,&Frame);
+
+	check_value("packet size with zero counters",streamLength,2*TELEMETRY_MAX_PACKET_SIZE);
+
+	decode_stream(&Reader,stream,streamLength);
+	check_value("packets decoded",numOfDecoded,2);
+	check_true("zero counters",numOfDecoded == 2 && decoded[0].frameNumber == 0 && decoded[0].drawCycles == 0
+		&& decoded[0].audioUnderruns == 0 && decoded[0].numOfFrames == 1);
+	check_true("largest counters",numOfDecoded == 2 && decoded[1].frameNumber == UINT32_MAX && decoded[1].SPIbytes == UINT32_MAX
+		&& decoded[1].numOfRockets == UINT16_MAX && decoded[1].audioUnderruns == UINT16_MAX);
+}
+
+void test_corruption (void)
+{
+	telemetry_writer Writer;
+	telemetry_reader Reader;
+	uint8_t corrupted[TELEMETRY_TEST_STREAM_SIZE + 200];
+	uint32_t length;
+
+	printf("-- corrupted stream\n");
+	record_stream(&Writer);
+
+	/*flipped bit inside packet 10 is caught by CRC*/
+	memcpy(corrupted,stream,streamLength);
+	corrupted[10*TELEMETRY_MAX_PACKET_SIZE + 12] ^= 0x10;
+	decode_stream(&Reader,corrupted,streamLength);
+	check_value("flipped bit: corrupted packets",Reader.numOfErrors,1);
+	check_value("flipped bit: packets decoded",numOfDecoded,TELEMETRY_TEST_NUM_OF_PACKETS - 1);
+	check_true("flipped bit: packet 10 missing, packet 11 intact",find_packet(10) == numOfDecoded && check_summary(&decoded[find_packet(11)],11));
+
+	/*COBS code replaced by a longer one point beyond end of packet*/
+	memcpy(corrupted,stream,streamLength);
+	corrupted[20*TELEMETRY_MAX_PACKET_SIZE] = 0xF0;
+	decode_stream(&Reader,corrupted,streamLength);
+	check_value("bad COBS code: corrupted packets",Reader.numOfErrors,1);
+	check_value("bad COBS code: packets decoded",numOfDecoded,TELEMETRY_TEST_NUM_OF_PACKETS - 1);
+
+	/*byte lost inside packet 30*/
+	length = 30*TELEMETRY_MAX_PACKET_SIZE + 5;
+	memcpy(corrupted,stream,length);
+	memcpy(corrupted + length,stream + length + 1,streamLength - length - 1);
+	decode_stream(&Reader,corrupted,streamLength - 1);
+	check_value("lost byte: corrupted packets",Reader.numOfErrors,1);
+	check_true("lost byte: packet 31 intact",find_packet(31) < numOfDecoded && check_summary(&decoded[find_packet(31)],31));
+
+	/*delimiter of packet 40 lost, packets 40 and 41 are merged into one too long packet*/
+	length = 41*TELEMETRY_MAX_PACKET_SIZE - 1;
+	memcpy(corrupted,stream,length);
+	memcpy(corrupted + length,stream + length + 1,streamLength - length - 1);
+	decode_stream(&Reader,corrupted,streamLength - 1);
+	check_value("lost delimiter: corrupted packets",Reader.numOfErrors,1);
+	check_value("lost delimiter: packets decoded",numOfDecoded,TELEMETRY_TEST_NUM_OF_PACKETS - 2);
+	check_true("lost delimiter: packet 42 intact",find_packet(42) < numOfDecoded && check_summary(&decoded[find_packet(42)],42));
+
+	/*decoder started in middle of packet 0*/
+	decode_stream(&Reader,stream + 13,streamLength - 13);
+	check_value("joined mid-packet: corrupted packets",Reader.numOfErrors,1);
+	check_true("joined mid-packet: first decoded is packet 1",numOfDecoded && check_summary(&decoded[0],1));
+
+	/*line noise (200 non-zero bytes, then a stray delimiter) between packets 50 and 51*/
+	length = 51*TELEMETRY_MAX_PACKET_SIZE;
+	memcpy(corrupted,stream,length);
+	for(uint32_t i = 0; i < 200; i++){
+		corrupted[length + i] = (uint8_t)(i % 255 + 1);
+	}
+	corrupted[length + 199] = 0x00;
+	memcpy(corrupted + length + 200,stream + length,streamLength - length);
+	decode_stream(&Reader,corrupted,streamLength + 200);
+	check_value("line noise: corrupted packets",Reader.numOfErrors,1);
+	check_value("line noise: packets decoded",numOfDecoded,TELEMETRY_TEST_NUM_OF_PACKETS);
+}
+
+void test_dropped_packets (void)
+{
+	telemetry_writer Writer;
+	telemetry_reader Reader;
+
+	printf("-- packets refused by output\n");
+	refuseOddPackets = 1;
+	record_stream(&Writer);
+	refuseOddPackets = 0;
+
+	check_value("packets sent",Writer.numOfPackets,TELEMETRY_TEST_NUM_OF_PACKETS/2);
+	check_value("packets dropped",Writer.numOfDropped,TELEMETRY_TEST_NUM_OF_PACKETS/2);
+
+	decode_stream(&Reader,stream,streamLength);
+	check_value("packets decoded",numOfDecoded,TELEMETRY_TEST_NUM_OF_PACKETS/2);
+	check_true("gap of one packet between decoded packets",numOfDecoded > 1
+		&& decoded[1].frameNumber - decoded[0].frameNumber == 2*TELEMETRY_TEST_PERIOD);
+}
+
+void test_cost (void)
+{
+	telemetry_writer Writer;
+	telemetry_frame Frame;
+	uint64_t start, elapsed;
+	double frameBudgetNs = 1e9/TELEMETRY_TEST_FRAME_RATE/100;	/*1% of frame time*/
+	double costNs;
+	double lineUsage = (double)TELEMETRY_MAX_PACKET_SIZE*TELEMETRY_TEST_FRAME_RATE/TELEMETRY_TEST_PERIOD/(TELEMETRY_TEST_BAUD_RATE/10);
+
+	printf("-- cost\n");
+	telemetry_writer_init(&Writer,discard_packet,TELEMETRY_TEST_PERIOD);
+	make_frame(1234,&Frame);
+
+	start = get_time();
+	for(uint32_t i = 0; i < TELEMETRY_TEST_TIMING_FRAMES; i++){
+		Frame.frameNumber = i;
+		telemetry_write_frame(&Writer,&Frame);
+	}
+	elapsed = get_time() - start;
+	costNs = (double)elapsed/TELEMETRY_TEST_TIMING_FRAMES;
+
+	printf("%.1f ns per frame on PC (%.1f ns per packet), %.3f%% of frame time at %u frames/s on %u times slower CPU\n",costNs,
+	costNs*TELEMETRY_TEST_PERIOD,100*costNs*TELEMETRY_TEST_SLOWDOWN/(1e9/TELEMETRY_TEST_FRAME_RATE),TELEMETRY_TEST_FRAME_RATE,TELEMETRY_TEST_SLOWDOWN);
+	printf("%u bytes/s, %.1f%% of serial line at %u baud\n",TELEMETRY_MAX_PACKET_SIZE*TELEMETRY_TEST_FRAME_RATE/TELEMETRY_TEST_PERIOD,
+	100*lineUsage,TELEMETRY_TEST_BAUD_RATE);
+
+	check_true("cost below 1% of frame time",costNs*TELEMETRY_TEST_SLOWDOWN < frameBudgetNs);
+	check_true("serial line usage below 5%",lineUsage < 0.05);
+}
+
+/*stream captured from game console or written by headless simulation*/
+void test_file (const char *fileNamePtr)
+{
+	FILE *filePtr = fopen(fileNamePtr,"rb");
+	telemetry_reader Reader;
+	telemetry_frame Frame, Previous;
+	uint32_t numOfGaps = 0;
+	int byte;
+
+	printf("-- stream file %s\n",fileNamePtr);
+
+	if(filePtr == NULL){
+		check_true("stream file opened",0);
+		return;
+	}
+
+	telemetry_reader_init(&Reader);
+	memset(&Previous,0,sizeof(Previous));
+
+	while((byte = fgetc(filePtr)) != EOF){
+		if(telemetry_read_byte(&Reader,(uint8_t)byte,&Frame) != TELEMETRY_PACKET){
+			continue;
+		}
+
+		if(Reader.numOfPackets > 1 && Frame.frameNumber - Previous.frameNumber != Frame.numOfFrames){
+			numOfGaps++;
+		}
+		Previous = Frame;
+	}
+
+	fclose(filePtr);
+
+	printf("%lu packets, last frame %lu\n",(unsigned long)Reader.numOfPackets,(unsigned long)(Reader.numOfPackets ? Previous.frameNumber : 0));
+	check_true("packets decoded",Reader.numOfPackets > 0);
+	check_value("corrupted packets",Reader.numOfErrors,0);
+	check_value("gaps in frame numbers",numOfGaps,0);
+}
+
+int main (int argc, char *argv[])
+{
+	test_recorded_stream();
+	test_extreme_values();
+	test_corruption();
+	test_dropped_packets();
+	test_cost();
+
+	if(argc > 1){
+		test_file(argv[1]);
+	}
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
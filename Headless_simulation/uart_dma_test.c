@@ -0,0 +1,428 @@
+/**
+*@brief Check DMA transmission queue and idle-line framed DMA reception of UART driver on PC, and measure throughput at 921600 baud
+*
+*This program run UART driver (Peripheral_drivers/src/stm32f407xx_uart.c) on emulated USART and DMA streams (headless_uart.c).
+*Queued buffers must be sent back to back in queue order with one DMA interrupt per buffer, full queue must refuse buffers until one is
+*sent. Frames sent by peer with idle line between them must be given to callback exactly (short frames, frames ending on half and end
+*of circular buffer, frames longer than circular buffer, frames merged when line does not become idle), and frames sent in loopback
+*must come back. Then telemetry packets queued by a main loop polling every millisecond are streamed for one second of line time:
+*line usage, bytes per second at 921600 baud and interrupts per kilobyte are printed and compared with interrupt driven transmission
+*(UART_send_intrpt), and a continuous stream of frames is received at full line rate without losing bytes.
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 -DSTM32F407xx -ICMSIS/Include -ICMSIS/Device/ST/STM32F4xx/Include
+*Headless_simulation/uart_dma_test.c Headless_simulation/headless_uart.c Peripheral_drivers/src/stm32f407xx_uart.c -o uart_dma_test
+*
+*Run:
+*uart_dma_test
+*Exit code is 0 when every check pass.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "headless_uart.h"
+#include <stdio.h>
+#include <string.h>
+
+#define UART_TEST_BAUD_RATE			UART_BDR_921600
+#define UART_TEST_CHAR_TIMES_PER_S	(UART_TEST_BAUD_RATE/10)	/*8 data bits, start and stop bits*/
+#define UART_TEST_RING_SIZE			64
+#define UART_TEST_MAX_FRAMES		64
+#define UART_TEST_MAX_FRAME_SIZE	512
+#define UART_TEST_OUTPUT_SIZE		(UART_TEST_CHAR_TIMES_PER_S + 1024)
+#define UART_TEST_LOOP_PERIOD		96	/*character times between 2 main loop iterations (about 1ms)*/
+#define UART_TEST_MIN_PACKET		16
+#define UART_TEST_MAX_PACKET		256
+#define UART_TEST_MIN_USAGE			995	/*per mille of line time used by saturated transmission*/
+
+UART_Handle_t UARTHandle;
+UART_Config_t UARTConfig = {.baudRate = UART_TEST_BAUD_RATE, .stopBit = UART_STB_1, .wordLength = UART_WRDLEN_8_DT_BITS,
+.mode = UART_TX_RX, .parityCtrl = UART_NO_PARCTRL, .flowCtrl = UART_NO_FLOWCTRL};
+
+uint8_t rxRing[UART_TEST_RING_SIZE];
+uint8_t output[UART_TEST_OUTPUT_SIZE];
+
+/*frames given to UART_DMA_RX_event_callback*/
+uint8_t frameData[UART_TEST_MAX_FRAMES][UART_TEST_MAX_FRAME_SIZE];
+uint16_t frameLength[UART_TEST_MAX_FRAMES];
+uint16_t numOfFrames = 0;
+uint16_t currentLength = 0;
+uint32_t numOfRxBytes = 0;
+uint32_t numOfEmptyEnds = 0;
+uint8_t checkRxData = 0;	/*throughput test check byte sequence instead of storing frames*/
+uint32_t rxSequence = 0;
+uint32_t rxSequenceErrors = 0;
+
+uint32_t numOfTxSent = 0;
+uint32_t numOfRxErrors = 0;
+
+uint16_t numOfFailures = 0;
+
+void UART_application_event_callback (UART_Handle_t *UARTxHandlePtr,uint8_t event)
+{
+	if(event == UART_EV_DMA_TX_SENT){
+		numOfTxSent++;
+	}else if(event == UART_EV_DMA_RX_ERROR){
+		numOfRxErrors++;
+	}
+}
+
+void UART_DMA_RX_event_callback(UART_Handle_t *UARTxHandlePtr, const uint8_t *dataPtr, uint16_t length, uint8_t endOfFrame)
+{
+	numOfRxBytes += length;
+
+	if(checkRxData){
+		for(uint16_t i = 0; i < length; i++){
+			if(dataPtr[i] != (uint8_t)(rxSequence++*7)){
+				rxSequenceErrors++;
+			}
+		}
+	}else if(numOfFrames < UART_TEST_MAX_FRAMES){
+		for(uint16_t i = 0; i < length; i++){
+			if(currentLength < UART_TEST_MAX_FRAME_SIZE){
+				frameData[numOfFrames][currentLength] = dataPtr[i];
+			}
+			currentLength++;
+		}
+	}
+
+	if(endOfFrame){
+		if(!length){
+			numOfEmptyEnds++;
+		}
+		if(!checkRxData && numOfFrames < UART_TEST_MAX_FRAMES){
+			frameLength[numOfFrames++] = currentLength;
+		}
+		currentLength = 0;
+	}
+}
+
+void check_value (const char *namePtr, uint32_t value, uint32_t expected)
+{
+	if(value != expected){
+		printf("FAIL %s: %lu, expected %lu\n",namePtr,(unsigned long)value,(unsigned long)expected);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+void check_true (const char *namePtr, uint8_t condition)
+{
+	if(!condition){
+		printf("FAIL %s\n",namePtr);
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+/*reset emulated line, UART driver and collected frames*/
+void test_init (uint8_t useDMA)
+{
+	memset(&UARTHandle,0,sizeof(UARTHandle));
+	headless_uart_init(&UARTHandle);
+	UARTHandle.UARTxConfigPtr = &UARTConfig;
+	UART_init(&UARTHandle);
+
+	if(useDMA){
+		UART_DMA_init(&UARTHandle);
+	}
+
+	headless_uart_set_output(output,UART_TEST_OUTPUT_SIZE);
+	numOfFrames = 0;
+	currentLength = 0;
+	numOfRxBytes = 0;
+	numOfEmptyEnds = 0;
+	numOfTxSent = 0;
+	numOfRxErrors = 0;
+	checkRxData = 0;
+}
+
+/*run line until DMA transmission is finished, return FALSE if it does not finish*/
+uint8_t run_until_sent (uint32_t maxCharTimes)
+{
+	while(maxCharTimes--){
+		if(!UART_DMA_TX_busy_check(&UARTHandle)){
+			return TRUE;
+		}
+		headless_uart_run(1);
+	}
+
+	return FALSE;
+}
+
+/*compare frames given to callback with expected lengths, frame i hold bytes i*31+j*/
+void check_frames (const char *namePtr, const uint16_t *lengthPtr, uint16_t count)
+{
+	uint8_t ok = (numOfFrames == count);
+
+	for(uint16_t i = 0; ok && i < count; i++){
+		ok = (frameLength[i] == lengthPtr[i]);
+		for(uint16_t j = 0; ok && j < lengthPtr[i]; j++){
+			ok = (frameData[i][j] == (uint8_t)(i*31 + j));
+		}
+	}
+
+	if(!ok){
+		printf("FAIL %s: %u frames, expected %u\n",namePtr,numOfFrames,count);
+		for(uint16_t i = 0; i < numOfFrames; i++){
+			printf("  frame %u: %u bytes\n",i,frameLength[i]);
+		}
+		numOfFailures++;
+	}else{
+		printf("pass %s\n",namePtr);
+	}
+}
+
+void fill_frame (uint8_t *bufferPtr, uint16_t index, uint16_t length)
+{
+	for(uint16_t j = 0; j < length; j++){
+		bufferPtr[j] = (uint8_t)(index*31 + j);
+	}
+}
+
+void test_tx_queue (void)
+{
+	static const uint16_t lengths[5] = {1,7,64,300,2};
+	static uint8_t buffers[5][300];
+	uint32_t total = 0;
+	uint8_t accepted = TRUE;
+	uint8_t ok = TRUE;
+	Headless_UART_Stats_t Stats;
+
+	test_init(TRUE);
+
+	for(uint8_t i = 0; i < 5; i++){
+		fill_frame(buffers[i],i,lengths[i]);
+		accepted &= (UART_send_DMA(&UARTHandle,buffers[i],lengths[i]) == UART_STATE_READY);
+		total += lengths[i];
+	}
+
+	check_true("5 buffers queued",accepted);
+	check_true("transmission finish",run_until_sent(10000));
+	headless_uart_get_stats(&Stats);
+
+	check_value("bytes sent",headless_uart_get_num_of_outputs(),total);
+	for(uint32_t i = 0, k = 0; i < 5; i++){
+		for(uint16_t j = 0; j < lengths[i]; j++, k++){
+			ok &= (output[k] == buffers[i][j]);
+		}
+	}
+	check_true("bytes sent in queue order",ok);
+
+	/*one character time to load first byte, one to see last one shifted out*/
+	check_value("line busy time (char times)",Stats.txBusyTime,total);
+	check_true("no idle gap between queued buffers",Stats.numOfCharTimes <= total + 2);
+	check_value("DMA interrupts",Stats.numOfTxDMAIRQs,5);
+	check_value("UART interrupts",Stats.numOfUARTIRQs,0);
+	check_value("sent events",numOfTxSent,5);
+
+	/*full queue refuse buffer until first one is sent*/
+	test_init(TRUE);
+	accepted = TRUE;
+	for(uint8_t i = 0; i < UART_DMA_TX_QUEUE_SIZE; i++){
+		accepted &= (UART_send_DMA(&UARTHandle,buffers[0],1) == UART_STATE_READY);
+	}
+	check_true("queue of UART_DMA_TX_QUEUE_SIZE buffers",accepted);
+	check_value("full queue refuse buffer",UART_send_DMA(&UARTHandle,buffers[1],1),UART_STATE_TX_BUSY);
+	headless_uart_run(1);
+	check_value("buffer accepted after one is sent",UART_send_DMA(&UARTHandle,buffers[1],1),UART_STATE_READY);
+	check_true("queue sent",run_until_sent(100));
+	check_value("bytes sent from full queue",headless_uart_get_num_of_outputs(),UART_DMA_TX_QUEUE_SIZE + 1);
+	check_value("last byte",output[UART_DMA_TX_QUEUE_SIZE],buffers[1][0]);
+}
+
+void test_rx_frames (void)
+{
+	/*positions in circular buffer of 64 bytes: frame 2 end on half, frame 4 end on end, frame 5 cross half, frame 6 wrap, frame 7 is longer than buffer*/
+	static const uint16_t lengths[8] = {1,5,26,20,12,40,60,150};
+	static const uint16_t mergedLengths[1] = {45};
+	static uint8_t frame[UART_TEST_MAX_FRAME_SIZE];
+	Headless_UART_Stats_t Stats;
+
+	test_init(TRUE);
+	check_value("reception started",UART_receive_DMA(&UARTHandle,rxRing,UART_TEST_RING_SIZE),UART_STATE_READY);
+
+	for(uint8_t i = 0; i < 8; i++){
+		fill_frame(frame,i,lengths[i]);
+		headless_uart_inject(frame,lengths[i]);
+		headless_uart_run(lengths[i] + 3);
+	}
+
+	check_frames("frames separated by idle line",lengths,8);
+	check_value("empty end of frame (frame ended on half or end of buffer)",numOfEmptyEnds,2);
+	headless_uart_get_stats(&Stats);
+	check_value("UART interrupts (one per idle line)",Stats.numOfUARTIRQs,8);
+	check_value("bytes lost",Stats.numOfRxLost,0);
+
+	/*no idle line between frames: they are given as one*/
+	test_init(TRUE);
+	UART_receive_DMA(&UARTHandle,rxRing,UART_TEST_RING_SIZE);
+	fill_frame(frame,0,45);
+	headless_uart_inject(frame,20);
+	headless_uart_inject(frame + 20,25);
+	headless_uart_run(50);
+	check_frames("frames without idle line merged",mergedLengths,1);
+
+	/*stopped reception drop bytes*/
+	UART_stop_receive_DMA(&UARTHandle);
+	headless_uart_inject(frame,10);
+	headless_uart_run(20);
+	headless_uart_get_stats(&Stats);
+	check_value("frames after stop",numOfFrames,1);
+	check_value("bytes lost after stop",Stats.numOfRxLost,10);
+}
+
+void test_loopback (void)
+{
+	static const uint16_t lengths[4] = {3,64,100,9};
+	static uint8_t frames[4][100];
+
+	test_init(TRUE);
+	headless_uart_loopback_ctr(ENABLE);
+	UART_receive_DMA(&UARTHandle,rxRing,UART_TEST_RING_SIZE);
+
+	for(uint8_t i = 0; i < 4; i++){
+		fill_frame(frames[i],i,lengths[i]);
+		UART_send_DMA(&UARTHandle,frames[i],lengths[i]);
+		run_until_sent(1000);
+		headless_uart_run(2);
+	}
+
+	check_frames("frames sent in loopback",lengths,4);
+}
+
+/*stream telemetry packets for one second of line time, queued by main loop every millisecond, return interrupts*/
+uint32_t stream_packets (uint8_t useDMA, uint32_t *numOfBytesPtr)
+{
+	static uint8_t packets[UART_DMA_TX_QUEUE_SIZE + 1][UART_TEST_MAX_PACKET];
+	uint32_t random = 12345;
+	uint32_t sequence = 0;
+	uint32_t numOfQueued = 0;
+	uint32_t errors = 0;
+	Headless_UART_Stats_t Stats;
+
+	test_init(useDMA);
+
+	while(1){
+		headless_uart_get_stats(&Stats);
+		if(Stats.numOfCharTimes >= UART_TEST_CHAR_TIMES_PER_S){
+			break;
+		}
+
+		/*main loop: queue packets while driver accept them*/
+		while(1){
+			uint8_t *packetPtr = packets[numOfQueued % (UART_DMA_TX_QUEUE_SIZE + 1)];
+			uint16_t length;
+
+			random ^= random << 13;
+			random ^= random >> 17;
+			random ^= random << 5;
+			length = UART_TEST_MIN_PACKET + random % (UART_TEST_MAX_PACKET - UART_TEST_MIN_PACKET + 1);
+
+			if(useDMA){
+				/*slot of packet queued UART_DMA_TX_QUEUE_SIZE + 1 packets ago is not in queue any more*/
+				if((uint8_t)(UARTHandle.txQueueTail - UARTHandle.txQueueHead) >= UART_DMA_TX_QUEUE_SIZE){
+					break;
+				}
+			}else if(UARTHandle.txState != UART_STATE_READY){
+				break;
+			}
+
+			for(uint16_t i = 0; i < length; i++){
+				packetPtr[i] = (uint8_t)((sequence + i)*7);
+			}
+
+			if(useDMA){
+				UART_send_DMA(&UARTHandle,packetPtr,length);
+			}else{
+				UART_send_intrpt(&UARTHandle,packetPtr,length);
+			}
+			sequence += length;
+			numOfQueued++;
+		}
+
+		headless_uart_run(UART_TEST_LOOP_PERIOD);
+	}
+
+	headless_uart_get_stats(&Stats);
+	*numOfBytesPtr = headless_uart_get_num_of_outputs();
+
+	for(uint32_t i = 0; i < *numOfBytesPtr && i < UART_TEST_OUTPUT_SIZE; i++){
+		if(output[i] != (uint8_t)(i*7)){
+			errors++;
+		}
+	}
+	check_value(useDMA ? "streamed bytes in order (DMA)" : "streamed bytes in order (interrupt)",errors,0);
+
+	return Stats.numOfUARTIRQs + Stats.numOfTxDMAIRQs;
+}
+
+void test_throughput (void)
+{
+	static uint8_t frame[UART_TEST_MAX_FRAME_SIZE];
+	uint32_t DMABytes, intrptBytes, DMAIRQs, intrptIRQs;
+	uint32_t numOfSent = 0;
+	uint32_t PCLK1 = RCC_get_PCLK_value(APB1);
+	uint32_t PCLK2 = RCC_get_PCLK_value(APB2);
+	Headless_UART_Stats_t Stats;
+
+	DMAIRQs = stream_packets(TRUE,&DMABytes);
+	intrptIRQs = stream_packets(FALSE,&intrptBytes);
+
+	/*BRR hold USARTDIV in 1/16 (truncated by UART_init), emulated line run at nominal baud rate*/
+	printf("actual baud rate for %u: %lu on APB1 (%lu Hz), %lu on APB2 (%lu Hz)\n",UART_TEST_BAUD_RATE,
+	(unsigned long)(PCLK1/(PCLK1/UART_TEST_BAUD_RATE)),(unsigned long)PCLK1,(unsigned long)(PCLK2/(PCLK2/UART_TEST_BAUD_RATE)),(unsigned long)PCLK2);
+	printf("DMA transmission: %lu bytes/s at %u baud (%lu.%lu%% of line), %lu interrupts (%lu.%02lu per KB)\n",(unsigned long)DMABytes,
+	UART_TEST_BAUD_RATE,(unsigned long)(DMABytes*100/UART_TEST_CHAR_TIMES_PER_S),(unsigned long)(DMABytes*1000/UART_TEST_CHAR_TIMES_PER_S%10),
+	(unsigned long)DMAIRQs,(unsigned long)(DMAIRQs*1024/DMABytes),(unsigned long)(DMAIRQs*102400/DMABytes%100));
+	printf("interrupt driven transmission: %lu bytes/s at %u baud (%lu.%lu%% of line), %lu interrupts (%lu.%02lu per KB)\n",
+	(unsigned long)intrptBytes,UART_TEST_BAUD_RATE,(unsigned long)(intrptBytes*100/UART_TEST_CHAR_TIMES_PER_S),
+	(unsigned long)(intrptBytes*1000/UART_TEST_CHAR_TIMES_PER_S%10),(unsigned long)intrptIRQs,(unsigned long)(intrptIRQs*1024/intrptBytes),
+	(unsigned long)(intrptIRQs*102400/intrptBytes%100));
+
+	check_true("DMA transmission saturate line",DMABytes*1000 >= (uint32_t)UART_TEST_CHAR_TIMES_PER_S*UART_TEST_MIN_USAGE);
+
+	/*reception of frames of 100 bytes with one idle character between them, during one second*/
+	test_init(TRUE);
+	checkRxData = 1;
+	rxSequence = 0;
+	rxSequenceErrors = 0;
+	UART_receive_DMA(&UARTHandle,rxRing,UART_TEST_RING_SIZE);
+
+	while(numOfSent + 100 <= UART_TEST_CHAR_TIMES_PER_S*100/101){
+		for(uint16_t i = 0; i < 100; i++){
+			frame[i] = (uint8_t)((numOfSent + i)*7);
+		}
+		headless_uart_inject(frame,100);
+		headless_uart_run(101);
+		numOfSent += 100;
+	}
+
+	headless_uart_get_stats(&Stats);
+	printf("DMA reception: %lu bytes/s in frames of 100 bytes, %lu interrupts (%lu.%02lu per KB)\n",(unsigned long)numOfRxBytes,
+	(unsigned long)(Stats.numOfUARTIRQs + Stats.numOfRxDMAIRQs),(unsigned long)((Stats.numOfUARTIRQs + Stats.numOfRxDMAIRQs)*1024/numOfRxBytes),
+	(unsigned long)((Stats.numOfUARTIRQs + Stats.numOfRxDMAIRQs)*102400/numOfRxBytes%100));
+
+	check_value("received bytes",numOfRxBytes,numOfSent);
+	check_value("received bytes in order",rxSequenceErrors,0);
+	check_value("bytes lost",Stats.numOfRxLost,0);
+}
+
+int main (void)
+{
+	test_tx_queue();
+	test_rx_frames();
+	test_loopback();
+	test_throughput();
+
+	if(numOfFailures){
+		printf("%u checks failed\n",numOfFailures);
+		return 1;
+	}
+
+	printf("all checks passed\n");
+	return 0;
+}
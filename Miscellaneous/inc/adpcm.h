@@ -0,0 +1,74 @@
+/**
+*@file adpcm.h
+*@brief provide functions for encoding and decoding IMA ADPCM sound
+*
+*This header file provide functions for encoding and decoding IMA ADPCM sound.
+*Each 16 bits sample is coded in 4 bits (2 samples per byte, first sample in low nibble), so sound take 4 times less flash
+*than 16 bits samples. Decoder state (predicted sample and step index) is carried from one sample to the next, so sound is
+*decoded from its start and decoding can be split in blocks of any size.
+*Each sound carry its sample rate, speaker driver resample it to its output rate, so that sound of little importance can be stored
+*at lower rate to save flash.
+*Sound assets in Miscellaneous/inc are generated from WAV files by Tools/adpcm_encoder.c.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef ADPCM_H
+#define ADPCM_H
+
+#include <stdint.h>
+
+#define ADPCM_STEP_INDEX_MAX	88
+
+/***********************************************************************
+ADPCM structure definition
+***********************************************************************/
+
+typedef struct{
+	int16_t predictor;	/*last decoded sample*/
+	uint8_t stepIndex;	/*0 to ADPCM_STEP_INDEX_MAX*/
+}ADPCM_State_t;
+
+typedef struct{
+	const uint8_t *dataPtr;	/*4 bits codes, first sample in low nibble*/
+	uint32_t numOfSamples;
+	ADPCM_State_t initialState;	/*decoder state before first sample*/
+	uint16_t sampleRate;	/*Hz, 0 for sample rate of speaker*/
+}ADPCM_Sound_t;
+
+/***********************************************************************
+ADPCM APIs prototype
+***********************************************************************/
+
+/**
+*@brief 	Encode one sample
+*
+*Encoder state is updated like decoder state, so that encoder predict samples seen by decoder.
+*
+*@param 	Pointer to encoder state
+*@param 	Sample
+*@return 	4 bits code
+*/
+uint8_t adpcm_encode_sample (ADPCM_State_t *StatePtr, int16_t sample);
+
+/**
+*@brief 	Decode one sample
+*@param 	Pointer to decoder state
+*@param 	4 bits code
+*@return 	Sample
+*/
+int16_t adpcm_decode_sample (ADPCM_State_t *StatePtr, uint8_t code);
+
+/**
+*@brief 	Decode consecutive samples of sound
+*@param 	Pointer to decoder state (state after sample before first decoded sample)
+*@param 	4 bits codes of sound
+*@param 	Index of first decoded sample in sound
+*@param 	Buffer receiving samples
+*@param 	Number of samples
+*@return 	None
+*/
+void adpcm_decode_block (ADPCM_State_t *StatePtr, const uint8_t *dataPtr, uint32_t position, int16_t *bufferPtr, uint16_t numOfSamples);
+
+#endif
@@ -1 +1,2007 @@
-const uint16_t asteroid_impact[] = {2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2047,2047,2047,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2047,2047,2048,2048,2047,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2047,2046,2046,2047,2047,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2049,2048,2047,2048,2049,2049,2048,2048,2049,2049,2049,2048,2046,2047,2048,2048,2049,2050,2050,2050,2049,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2047,2048,2048,2047,2047,2048,2048,2049,2049,2047,2046,2047,2048,2048,2048,2048,2047,2046,2047,2048,2048,2048,2048,2048,2046,2046,2047,2048,2049,2048,2047,2047,2048,2049,2050,2051,2049,2048,2047,2046,2047,2048,2049,2049,2049,2048,2048,2046,2045,2047,2050,2050,2050,2050,2049,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2049,2050,2048,2047,2047,2048,2049,2050,2051,2050,2048,2048,2049,2049,2047,2046,2045,2045,2047,2047,2047,2048,2048,2047,2046,2047,2048,2048,2047,2045,2044,2045,2046,2047,2048,2048,2048,2047,2047,2047,2048,2046,2045,2045,2046,2046,2046,2047,2047,2048,2047,2046,2047,2049,2050,2050,2050,2050,2049,2050,2050,2049,2049,2049,2046,2045,2047,2048,2048,2050,2049,2047,2047,2047,2047,2049,2048,2049,2050,2049,2047,2047,2047,2047,2049,2047,2045,2047,2046,2048,2057,2053,2030,2024,2057,2112,2148,2106,1961,1802,1768,1891,2092,2274,2374,2379,2313,2207,2092,1989,1912,1856,1817,1791,1773,1767,1778,1808,1857,1921,1994,2067,2136,2197,2249,2286,2313,2329,2334,2326,2314,2296,2272,2247,2222,2195,2167,2138,2111,2088,2070,2056,2043,2026,2004,1975,1942,1909,1882,1864,1855,1855,1860,1868,1878,1888,1895,1900,1900,1896,1892,1889,1884,1878,1873,1869,1864,1860,1860,1864,1871,1878,1888,1902,1916,1931,1947,1963,1981,2003,2026,2047,2067,2087,2107,2124,2141,2160,2179,2196,2212,2228,2241,2252,2265,2276,2285,2293,2299,2303,2305,2307,2309,2311,2312,2311,2308,2302,2298,2294,2291,2288,2283,2276,2270,2266,2262,2257,2252,2245,2237,2231,2223,2213,2204,2195,2188,2180,2171,2160,2149,2137,2126,2117,2105,2093,2080,2065,2049,2035,2022,2005,1989,1975,1961,1947,1935,1921,1907,1892,1879,1867,1854,1839,1824,1810,1798,1786,1775,1765,1755,1745,1736,1727,1720,1714,1710,1706,1702,1699,1696,1693,1691,1690,1690,1692,1695,1697,1701,1705,1708,1712,1720,1730,1740,1748,1756,1764,1774,1785,1796,1808,1819,1831,1843,1853,1864,1877,1891,1905,1920,1934,1947,1958,1971,1985,1999,2013,2027,2041,2054,2068,2082,2095,2107,2119,2130,2140,2151,2163,2177,2188,2198,2205,2213,2222,2231,2240,2247,2255,2262,2269,2275,2282,2288,2293,2297,2300,2303,2307,2310,2312,2315,2319,2325,2329,2332,2334,2335,2335,2335,2334,2332,2331,2331,2330,2328,2325,2323,2320,2318,2316,2314,2311,2309,2306,2303,2300,2297,2296,2295,2293,2291,2289,2287,2285,2283,2281,2280,2281,2282,2284,2285,2285,2286,2287,2287,2287,2286,2287,2287,2288,2287,2287,2286,2285,2283,2281,2278,2275,2271,2265,2260,2255,2250,2245,2238,2230,2222,2213,2204,2194,2183,2173,2161,2150,2139,2127,2115,2103,2090,2076,2062,2048,2035,2022,2008,1994,1980,1965,1951,1937,1923,1910,1897,1883,1870,1857,1844,1832,1820,1808,1797,1786,1775,1765,1755,1746,1737,1728,1720,1712,1705,1698,1692,1686,1681,1676,1672,1668,1665,1661,1659,1657,1655,1654,1653,1652,1652,1653,1654,1655,1656,1658,1660,1662,1665,1668,1671,1674,1678,1682,1686,1690,1695,1699,1704,1708,1713,1719,1724,1729,1734,1739,1745,1750,1756,1761,1767,1772,1778,1783,1789,1794,1800,1805,1811,1816,1821,1827,1832,1838,1843,1849,1854,1860,1865,1871,1876,1882,1888,1893,1899,1905,1910,1916,1922,1928,1934,1940,1946,1952,1958,1965,1971,1977,1984,1991,1997,2004,2011,2018,2025,2032,2039,2046,2054,2061,2069,2076,2084,2092,2099,2107,2115,2123,2131,2139,2147,2155,2163,2172,2180,2188,2196,2204,2212,2221,2229,2237,2245,2253,2260,2268,2276,2284,2291,2299,2306,2313,2320,2327,2334,2341,2347,2353,2359,2366,2371,2377,2382,2387,2392,2397,2401,2405,2409,2413,2416,2420,2423,2425,2428,2431,2432,2434,2436,2437,2438,2438,2438,2438,2439,2439,2438,2437,2436,2434,2432,2431,2429,2427,2423,2420,2417,2414,2411,2408,2403,2398,2393,2390,2385,2380,2375,2369,2362,2357,2352,2346,2341,2335,2327,2319,2313,2307,2302,2294,2284,2276,2272,2268,2259,2250,2242,2235,2230,2225,2215,2204,2197,2191,2184,2178,2170,2161,2155,2149,2140,2132,2128,2121,2113,2104,2095,2087,2084,2080,2072,2064,2057,2049,2042,2038,2034,2028,2020,2010,2003,2001,1998,1992,1984,1978,1976,1972,1963,1954,1950,1951,1948,1938,1926,1919,1922,1926,1924,1915,1902,1894,1902,1911,1897,1877,1878,1886,1879,1868,1864,1863,1862,1861,1857,1855,1852,1843,1837,1842,1841,1831,1828,1829,1820,1813,1822,1829,1821,1809,1805,1805,1810,1812,1802,1788,1789,1798,1795,1780,1777,1789,1794,1789,1783,1776,1774,1787,1796,1783,1770,1775,1776,1768,1775,1788,1779,1765,1769,1781,1786,1787,1786,1783,1778,1773,1780,1796,1790,1767,1772,1805,1815,1794,1783,1794,1811,1823,1826,1814,1794,1792,1817,1836,1826,1813,1818,1827,1833,1846,1850,1842,1846,1859,1859,1861,1870,1867,1863,1875,1881,1878,1881,1884,1885,1907,1929,1927,1923,1926,1921,1926,1943,1939,1929,1945,1959,1952,1963,1993,1997,1986,1987,1991,1998,2020,2039,2034,2011,1999,2028,2079,2087,2059,2056,2067,2052,2052,2094,2117,2096,2089,2108,2109,2097,2116,2145,2127,2087,2101,2141,2130,2106,2122,2136,2134,2167,2215,2236,2244,2223,2166,2146,2172,2171,2170,2199,2187,2165,2228,2289,2263,2240,2236,2197,2207,2272,2259,2231,2306,2335,2245,2237,2326,2313,2245,2291,2359,2324,2294,2360,2410,2348,2262,2248,2270,2304,2391,2454,2366,2236,2232,2286,2301,2332,2380,2392,2413,2435,2397,2357,2355,2344,2372,2429,2357,2221,2233,2307,2295,2294,2309,2243,2208,2262,2285,2344,2480,2446,2257,2266,2438,2481,2437,2409,2324,2244,2258,2278,2295,2342,2276,2120,2115,2233,2271,2252,2231,2180,2183,2267,2309,2328,2404,2421,2323,2235,2163,2057,2057,2228,2363,2306,2157,2063,2038,2057,2145,2239,2206,2151,2247,2282,2082,2000,2171,2173,1990,2035,2174,2117,2117,2256,2202,2035,2006,1947,1857,2004,2204,2182,2118,2085,1965,1940,2043,1947,1700,1613,1661,1809,2071,2182,2102,2111,2076,1853,1794,1892,1840,1839,1857,1577,1625,2202,1974,1154,1733,2900,2220,902,1259,2117,2221,2531,2478,910,0,1566,3415,3496,2608,1521,763,1521,3068,2966,1211,55,365,1277,1929,2139,2502,3359,3791,3201,2505,2285,1965,1375,846,311,0,0,456,876,1168,1602,2353,3237,3648,3307,2691,2164,1573,947,525,317,326,642,1153,1708,2317,2910,3265,3168,2567,1768,1138,614,119,13,440,1084,1853,2735,3280,3211,2871,2473,1866,1119,492,72,0,189,915,1777,2375,2682,2902,2842,2178,1267,679,312,20,204,920,1590,2070,2734,3446,3599,3037,2176,1402,799,372,221,404,815,1333,1861,2263,2541,2866,3204,3283,3017,2606,2345,2450,2716,2577,1951,1428,1258,1089,864,919,1270,1694,2186,2708,3049,3185,3265,3300,3212,2886,2110,966,130,134,519,452,16,51,712,1132,888,746,1260,1730,1520,1333,1949,2710,2639,2144,2248,2927,3432,3510,3270,2579,1495,650,524,862,1306,2011,3072,3817,3439,2173,1058,622,604,805,1262,1713,1840,1842,2071,2452,2727,2891,3143,3552,3860,3801,3551,3378,3132,2695,2355,2187,1930,1603,1362,1089,825,812,880,736,575,631,790,1029,1457,1973,2484,3059,3579,3780,3684,3510,3269,2815,2183,1594,1154,776,459,323,369,458,544,723,1026,1307,1483,1745,2221,2637,2774,2868,3187,3611,3854,3820,3694,3698,3751,3700,3649,3643,3484,3182,2943,2736,2447,2144,1910,1730,1564,1394,1276,1212,1125,1124,1374,1668,1741,1710,1722,1715,1716,1885,2214,2464,2508,2607,2902,2998,2774,2825,3276,3439,3109,2780,2678,2690,2739,2717,2598,2518,2498,2423,2271,2163,2258,2505,2694,2832,3026,3188,3284,3343,3247,3062,3022,2966,2741,2644,2672,2421,2009,1842,1822,1727,1697,1899,2200,2406,2622,3046,3451,3537,3472,3436,3344,3285,3293,3126,2880,2814,2662,2271,2084,2222,2266,2124,2051,2156,2299,2228,2012,2018,2171,2125,1995,1964,1940,1932,1949,1967,2152,2436,2551,2654,2903,3048,3107,3244,3200,2905,2705,2590,2423,2369,2364,2231,2189,2288,2273,2213,2325,2572,2814,2980,3198,3498,3491,3151,3023,3014,2681,2484,2743,2777,2472,2463,2600,2506,2381,2177,1890,1936,2141,2167,2283,2475,2610,2879,3019,2903,3002,3148,3012,2981,3005,2770,2707,2849,2596,2268,2445,2582,2308,2174,2279,2373,2529,2445,2065,2065,2348,2488,2647,2462,2038,2481,2965,2068,1378,2194,2835,2545,2284,1980,1831,2698,3274,2265,1497,2144,2614,2126,1590,1667,2075,1989,1930,2999,3463,1830,992,2706,3678,2133,1164,2418,3156,1899,986,1937,3354,3591,2550,1388,938,922,984,1029,1486,2893,3722,2669,1997,3106,3907,3397,2437,1428,911,1288,1679,1222,669,1172,1930,1721,1475,1942,2327,2709,3289,3185,2613,2416,2176,1818,2060,2493,2494,2534,2536,2015,1539,1213,565,203,281,372,1077,2122,2548,3013,3753,3986,3966,3893,3548,3209,2805,2325,2120,1899,1527,1372,1347,1127,735,719,1089,852,212,187,348,398,648,665,719,1402,1987,2190,2569,2897,2839,2888,3372,3540,2991,2723,2839,2590,2471,2136,769,358,1703,2089,1368,1909,2981,2708,1816,1423,1456,1899,2407,2164,1421,830,344,280,806,1258,1592,1981,1937,1441,982,826,772,366,0,89,243,564,1187,1440,1745,2511,2932,3105,3270,2973,2730,2705,2183,1574,1336,1047,671,437,485,745,797,757,982,1220,1333,1525,1842,2107,2139,2263,2627,2645,2460,2682,2823,2523,2320,2220,1834,1373,1100,835,555,454,354,164,143,146,122,388,555,326,296,510,532,553,796,1096,1305,1495,1801,2015,2033,2226,2530,2535,2406,2417,2446,2406,2448,2535,2348,2122,2257,2207,1796,1747,1800,1431,1229,1349,1332,1262,1221,1101,964,796,626,472,290,245,220,0,0,225,440,617,859,948,1021,1181,1160,1054,1104,1176,1274,1462,1543,1607,1808,1819,1664,1761,1956,2076,2256,2235,2069,2295,2608,2549,2501,2552,2454,2504,2730,2685,2498,2614,2871,2841,2654,2685,2753,2602,2490,2474,2325,2217,2187,1960,1792,1961,2070,1918,1764,1652,1596,1737,1866,1735,1585,1609,1630,1625,1684,1716,1738,1782,1662,1471,1511,1611,1477,1290,1266,1301,1275,1226,1212,1217,1209,1188,1188,1196,1129,1059,1153,1311,1396,1556,1775,1868,1950,2100,2147,2148,2251,2303,2234,2247,2377,2460,2456,2385,2243,2142,2086,1831,1449,1325,1416,1374,1212,1166,1260,1313,1245,1239,1418,1593,1634,1697,1879,2049,2126,2177,2177,2072,2005,2042,1984,1817,1787,1888,1909,1886,2025,2264,2298,2122,2088,2260,2346,2290,2267,2282,2288,2305,2285,2222,2239,2366,2439,2295,2035,1959,2079,2127,2118,2218,2311,2315,2399,2581,2639,2541,2556,2703,2633,2444,2525,2605,2453,2524,2778,2745,2626,2596,2448,2401,2553,2580,2573,2593,2363,2129,2155,2150,2097,2096,1935,1819,2016,2162,2103,2115,2174,2172,2195,2274,2361,2343,2222,2256,2417,2387,2275,2329,2407,2443,2542,2550,2420,2493,2728,2639,2433,2639,2828,2666,2729,2882,2643,2592,2676,2268,2335,3031,2738,2288,3255,3605,2281,1940,3047,3438,3106,2866,2368,2078,2657,3320,3445,3363,3152,2702,2280,2112,2108,2251,2626,2929,2883,2942,3241,3027,2321,2043,2237,2378,2518,2745,2786,2507,2121,2008,2244,2482,2564,2625,2655,2655,2752,2852,2667,2210,1941,2072,2131,1834,1681,2039,2503,2565,2320,2210,2308,2360,2316,2225,2097,2033,1976,1955,2212,2316,1935,2091,2852,2524,1489,1909,3117,2946,1808,1244,1450,2053,2670,2793,2518,2462,2530,2057,1574,2187,2986,2520,1718,1701,1847,1930,2267,2593,2961,3273,2864,2257,2333,2575,2650,2973,3232,3082,2976,3074,3070,2966,2986,3148,3220,3084,2876,2567,2170,1960,1916,2076,2826,3646,3691,3491,3521,3105,2135,1277,957,1296,1818,2142,2738,3412,3392,3137,3161,3042,2820,2756,2745,2944,3197,3126,3151,3473,3664,3720,3568,3156,3229,3619,3226,2598,2722,2857,2546,2401,2362,2321,2661,2947,2714,2517,2529,2356,2207,2263,2141,1902,1994,2256,2252,2032,1902,1956,1994,1849,1769,1925,1960,1790,1785,1901,1932,1933,1830,1746,2020,2352,2370,2366,2471,2486,2500,2557,2508,2455,2506,2504,2445,2496,2622,2731,2803,2691,2427,2319,2309,2060,1687,1573,1685,1649,1445,1448,1600,1546,1400,1335,1280,1276,1272,1224,1293,1390,1411,1504,1610,1669,1713,1608,1574,1846,2040,2020,2032,2033,2032,2081,2044,2017,2080,2045,1965,2034,2163,2178,2102,2062,2047,2043,2064,1953,1716,1541,1422,1408,1388,1086,987,1377,1477,1283,1456,1485,879,420,713,1334,1511,1013,386,155,358,1003,1969,2558,2290,1802,1610,1166,424,180,674,1623,2212,1650,1134,2033,3090,3116,2768,2222,1215,354,158,404,660,922,1613,2517,2731,2089,1393,1227,1292,1071,609,236,261,866,1741,2488,3013,3141,2807,2209,1495,927,631,383,237,264,203,129,306,645,1011,1483,2143,2673,2716,2647,2718,2532,2263,2299,2324,2317,2544,2701,2624,2574,2550,2390,2027,1475,925,585,450,405,404,430,430,408,335,153,79,244,366,385,520,764,1061,1371,1604,1842,2143,2469,2862,3196,3341,3432,3504,3488,3402,3225,3061,3008,2844,2580,2521,2504,2208,1849,1673,1565,1547,1722,1767,1395,960,895,1024,915,543,237,119,81,157,350,452,419,415,468,509,581,677,687,662,699,643,554,781,1131,1119,987,1209,1607,1824,1886,1936,2016,2163,2339,2454,2546,2636,2654,2680,2786,2918,3077,3197,3225,3280,3282,3158,3103,3053,2911,2870,2832,2667,2572,2448,2158,1955,1859,1687,1564,1546,1386,1083,1045,1275,1218,803,500,454,537,605,571,585,679,656,555,572,846,1248,1392,1402,1667,1929,2003,2140,2266,2298,2388,2445,2359,2195,2053,2028,2074,2127,2220,2300,2299,2181,2056,2154,2279,2197,2187,2238,2182,2291,2465,2452,2569,2892,3191,3413,3405,3257,3305,3414,3391,3357,3320,3246,3179,3068,2857,2713,2882,3173,3223,3149,3119,3131,3287,3362,3067,2632,2312,2388,3055,3708,3781,3457,2953,2592,2695,2993,3254,3553,3823,3952,3717,2980,2156,1689,1731,2251,2844,3155,3219,3057,2806,2765,2855,2775,2505,2189,1870,1803,2492,3594,3917,3307,2876,3118,3184,2317,1454,1967,3210,3679,3170,2129,1261,1412,2110,2178,1676,1367,1605,2283,2866,2940,2784,2852,3141,3313,3205,2929,2585,2267,2023,1693,1242,955,1063,1469,1841,1929,1813,1865,2359,2927,2930,2533,2415,2671,2920,2905,2673,2456,2294,2064,1797,1598,1614,1974,2420,2597,2582,2614,2712,2685,2456,2325,2424,2346,2039,2007,2234,2401,2755,3346,3501,2828,1681,759,708,1418,2014,1937,1388,959,1194,1998,2670,2800,2583,2308,1965,1429,951,988,1492,2025,2455,2897,3176,3041,2698,2447,2144,1596,1022,776,908,1211,1628,2129,2381,2235,1971,1743,1527,1362,1267,1325,1597,1970,2210,1995,1360,826,579,536,866,1434,1849,2123,2305,2231,1928,1689,1843,2275,2432,2160,1800,1528,1296,1112,1090,1352,1930,2612,2914,2659,2271,2108,2276,2660,2667,2084,1562,1465,1623,1839,1777,1363,951,734,827,1282,1783,2069,2135,1980,1630,1170,808,736,819,911,1100,1415,1769,2061,2337,2732,3046,3025,2794,2499,2282,2243,2113,1829,1752,1990,2416,2801,2864,2786,2911,3122,3172,3012,2752,2546,2444,2479,2571,2445,2070,1643,1271,1111,1225,1473,1761,1995,2087,1999,1699,1419,1399,1562,1937,2417,2547,2410,2422,2492,2488,2459,2367,2305,2338,2346,2324,2257,2023,1735,1651,1760,1839,1889,2100,2392,2527,2479,2357,2264,2124,1788,1457,1356,1384,1492,1587,1428,1181,1193,1412,1614,1663,1618,1675,1759,1703,1676,1857,2186,2521,2685,2659,2667,2802,2909,2940,3029,3151,3093,2866,2751,2871,3075,3180,3147,3009,2779,2563,2555,2778,3039,3139,3022,2763,2479,2284,2269,2397,2585,2756,2726,2410,2024,1778,1729,1900,2210,2511,2730,2804,2679,2471,2314,2166,2002,1927,1997,2208,2518,2771,2889,2987,3163,3394,3536,3397,3021,2634,2360,2272,2443,2812,3142,3123,2654,1984,1417,1099,1063,1206,1297,1177,923,750,753,894,1113,1276,1299,1291,1336,1423,1587,1787,1887,1895,1960,2129,2356,2647,2917,2992,2922,2856,2800,2782,2835,2883,2921,2934,2815,2564,2240,1908,1700,1615,1553,1534,1557,1540,1465,1358,1259,1225,1284,1422,1598,1793,2002,2150,2196,2205,2277,2481,2731,2869,2902,2922,2971,3044,3056,2999,2991,3029,3024,2934,2770,2666,2667,2632,2560,2532,2507,2498,2501,2409,2216,2018,1922,2020,2204,2247,2056,1686,1276,963,813,836,988,1253,1630,1964,2053,1834,1378,889,537,349,366,612,989,1383,1671,1793,1875,2028,2227,2430,2568,2580,2495,2375,2241,2048,1807,1668,1685,1713,1675,1631,1598,1550,1494,1430,1369,1394,1529,1629,1586,1462,1371,1385,1529,1764,2021,2216,2287,2253,2167,2040,1869,1670,1461,1273,1168,1160,1186,1213,1257,1281,1240,1128,970,859,840,838,803,759,733,743,757,743,724,709,723,815,951,1078,1185,1225,1147,966,751,606,581,636,720,804,905,1057,1223,1306,1275,1199,1152,1135,1163,1248,1310,1297,1257,1201,1148,1178,1282,1385,1481,1571,1604,1553,1444,1340,1282,1241,1190,1189,1290,1443,1599,1756,1895,1985,2032,2048,2055,2067,2046,1966,1855,1781,1820,1962,2119,2258,2380,2432,2376,2249,2120,2053,2083,2133,2119,2108,2166,2224,2262,2329,2402,2468,2546,2587,2551,2469,2399,2401,2478,2568,2628,2640,2613,2609,2665,2757,2861,2985,3101,3145,3135,3114,3015,2819,2672,2645,2664,2712,2849,3025,3095,3024,2910,2794,2659,2570,2606,2751,2928,3053,3069,2978,2847,2739,2665,2654,2750,2897,2989,3000,2929,2770,2582,2479,2527,2677,2829,2901,2857,2766,2722,2712,2702,2696,2656,2578,2526,2502,2445,2357,2300,2290,2293,2318,2378,2446,2508,2514,2421,2320,2274,2222,2158,2117,2103,2152,2250,2311,2290,2224,2176,2165,2166,2191,2227,2224,2175,2090,2004,1974,1974,1965,1976,2002,2032,2113,2270,2427,2462,2356,2237,2173,2127,2115,2170,2274,2385,2442,2427,2364,2266,2184,2182,2230,2251,2220,2195,2216,2225,2180,2102,2012,1951,1967,2027,2088,2147,2200,2208,2142,2043,1984,1977,1988,1995,2010,2077,2182,2249,2270,2316,2392,2421,2354,2262,2236,2252,2261,2281,2314,2331,2355,2411,2470,2512,2544,2537,2477,2393,2310,2281,2355,2458,2503,2514,2506,2475,2449,2439,2435,2433,2436,2462,2486,2448,2356,2255,2190,2209,2288,2348,2356,2332,2320,2339,2368,2411,2455,2444,2376,2303,2260,2258,2293,2343,2365,2325,2255,2223,2255,2308,2324,2318,2333,2316,2230,2152,2136,2185,2267,2290,2222,2150,2136,2168,2201,2183,2142,2167,2271,2374,2388,2306,2181,2058,1976,1957,1975,2010,2066,2098,2056,1971,1898,1857,1857,1885,1921,1968,2019,2038,2033,2042,2045,2016,1994,2024,2067,2049,1981,1933,1929,1960,2012,2042,2030,2014,2040,2116,2183,2169,2111,2118,2210,2294,2274,2164,2066,2033,2043,2063,2064,2032,2009,2043,2121,2185,2166,2079,2021,2041,2082,2105,2140,2196,2224,2194,2146,2118,2113,2124,2131,2110,2079,2073,2083,2071,2025,1993,2004,2018,2028,2064,2087,2072,2068,2099,2142,2160,2140,2113,2107,2109,2105,2089,2096,2175,2274,2309,2280,2213,2133,2072,2027,1996,2005,2063,2140,2163,2138,2144,2168,2196,2261,2296,2264,2224,2150,2038,1961,1913,1901,1959,2039,2119,2180,2160,2111,2104,2090,2045,2025,2058,2094,2083,2065,2073,2077,2109,2162,2118,1996,1960,1991,1814,1370,1131,1440,1909,2116,2168,2193,2059,1662,1106,779,1071,1833,2492,2634,2215,1440,665,266,390,904,1587,2172,2425,2371,2223,2173,2351,2664,2829,2724,2401,1918,1376,859,436,238,234,254,374,749,1239,1675,2062,2408,2720,3015,3214,3238,3090,2736,2174,1524,899,410,234,450,890,1251,1312,1063,694,445,439,634,896,1076,1114,1095,1160,1383,1736,2085,2242,2114,1786,1503,1519,1858,2309,2636,2730,2633,2452,2300,2289,2446,2655,2773,2726,2527,2263,2007,1753,1476,1188,939,748,598,524,535,535,460,334,211,165,235,389,601,822,978,1026,936,755,658,748,958,1233,1594,2053,2529,2882,2997,2854,2548,2234,2004,1919,2039,2297,2533,2637,2533,2207,1811,1571,1623,1922,2228,2264,1936,1377,849,539,468,581,801,1022,1182,1258,1232,1171,1164,1159,1078,969,930,1040,1308,1595,1724,1692,1637,1679,1837,2036,2186,2237,2189,2080,1970,1933,2044,2285,2543,2691,2672,2542,2413,2308,2193,2064,1946,1891,1909,1935,1901,1753,1435,982,541,259,213,434,890,1373,1636,1632,1415,1091,890,909,1055,1324,1706,2044,2204,2153,1987,1899,1970,2188,2528,2865,3078,3156,3100,2950,2764,2571,2458,2484,2573,2659,2721,2726,2660,2520,2343,2208,2118,2067,2098,2183,2226,2168,2024,1877,1771,1678,1592,1549,1565,1616,1641,1635,1627,1592,1561,1632,1803,2025,2267,2435,2443,2303,2083,1887,1795,1840,2011,2219,2325,2269,2100,1913,1766,1696,1766,1943,2084,2134,2135,2107,2065,2005,1913,1826,1789,1821,1930,2078,2195,2260,2278,2242,2163,2101,2114,2201,2325,2451,2548,2617,2666,2669,2645,2645,2693,2785,2872,2925,2980,3034,3068,3090,3026,2874,2821,2904,2972,3026,3136,3182,3030,2784,2651,2666,2733,2808,2852,2821,2786,2839,2919,2873,2658,2426,2344,2450,2713,3050,3265,3190,2871,2526,2325,2277,2350,2525,2750,2957,3077,3049,2881,2641,2413,2278,2289,2444,2679,2891,3000,2984,2866,2701,2524,2375,2338,2432,2580,2693,2694,2598,2494,2422,2400,2493,2682,2836,2881,2864,2844,2815,2773,2766,2815,2865,2871,2839,2770,2687,2645,2661,2720,2838,3008,3137,3132,2998,2841,2741,2679,2642,2662,2754,2910,3068,3107,2991,2821,2735,2797,2942,3061,3120,3109,3041,2979,2930,2885,2901,2968,3002,3000,2990,2965,2930,2881,2793,2691,2653,2707,2800,2861,2875,2852,2749,2572,2442,2436,2522,2650,2732,2695,2617,2569,2488,2358,2284,2342,2501,2667,2762,2777,2734,2642,2514,2382,2305,2331,2441,2568,2662,2694,2669,2628,2574,2478,2393,2366,2365,2397,2462,2504,2539,2574,2539,2438,2351,2324,2367,2450,2540,2621,2641,2564,2439,2317,2226,2187,2181,2201,2253,2298,2307,2306,2308,2303,2296,2303,2312,2294,2259,2241,2244,2262,2313,2392,2460,2487,2467,2416,2363,2315,2291,2331,2399,2436,2467,2492,2459,2402,2379,2396,2449,2504,2525,2517,2475,2411,2364,2324,2277,2242,2233,2251,2268,2254,2226,2195,2160,2121,2072,2054,2105,2165,2189,2210,2223,2208,2188,2192,2230,2290,2342,2371,2378,2377,2373,2355,2318,2282,2271,2287,2305,2313,2312,2286,2235,2189,2151,2119,2116,2151,2179,2149,2080,2036,2030,2044,2065,2065,2043,2032,2028,2020,2028,2045,2041,2024,2019,2021,2035,2086,2136,2138,2111,2094,2081,2074,2087,2080,2005,1933,1968,2034,2016,1958,1927,1898,1862,1845,1858,1877,1880,1861,1798,1704,1654,1660,1666,1669,1697,1740,1771,1762,1727,1704,1695,1687,1682,1683,1688,1691,1700,1717,1722,1730,1757,1776,1772,1744,1701,1673,1641,1575,1521,1505,1504,1502,1486,1488,1531,1558,1556,1554,1521,1469,1464,1498,1520,1527,1539,1557,1563,1550,1527,1498,1481,1487,1498,1515,1526,1500,1455,1411,1369,1346,1348,1359,1377,1397,1412,1409,1372,1322,1296,1304,1338,1356,1340,1337,1348,1325,1278,1240,1217,1226,1267,1309,1335,1344,1330,1297,1261,1231,1211,1217,1257,1305,1335,1355,1382,1395,1368,1336,1343,1375,1405,1418,1399,1369,1367,1377,1391,1407,1400,1379,1374,1381,1393,1404,1395,1370,1346,1327,1317,1318,1324,1326,1316,1298,1278,1260,1246,1238,1250,1279,1304,1317,1315,1310,1324,1343,1359,1390,1421,1431,1444,1457,1472,1488,1477,1444,1418,1396,1391,1408,1410,1392,1377,1366,1365,1366,1373,1394,1402,1386,1369,1355,1348,1344,1337,1331,1321,1326,1375,1416,1404,1397,1426,1440,1416,1402,1432,1475,1487,1475,1460,1453,1446,1417,1392,1389,1379,1372,1387,1371,1318,1296,1310,1322,1343,1376,1403,1430,1448,1443,1451,1469,1447,1408,1417,1461,1484,1471,1467,1489,1493,1494,1524,1528,1521,1565,1584,1541,1557,1638,1632,1519,1452,1472,1467,1468,1547,1565,1511,1556,1610,1530,1470,1515,1546,1569,1621,1601,1515,1541,1669,1718,1711,1765,1800,1747,1694,1680,1645,1571,1502,1457,1430,1448,1516,1589,1680,1803,1905,1966,1995,1983,1972,1996,1991,1892,1743,1639,1593,1553,1523,1523,1543,1602,1704,1806,1892,1985,2079,2153,2199,2232,2247,2221,2170,2112,2060,2029,1992,1943,1919,1917,1918,1925,1926,1919,1896,1843,1792,1779,1786,1772,1714,1646,1609,1573,1542,1566,1609,1623,1646,1732,1873,2020,2143,2248,2342,2433,2512,2568,2641,2745,2825,2855,2849,2817,2782,2765,2749,2709,2642,2580,2540,2497,2430,2349,2258,2157,2059,1978,1918,1874,1830,1761,1680,1646,1663,1665,1646,1654,1689,1722,1747,1769,1799,1835,1863,1907,1980,2056,2121,2187,2238,2256,2276,2327,2383,2419,2456,2498,2526,2545,2560,2560,2559,2575,2606,2637,2652,2649,2657,2673,2661,2651,2669,2667,2637,2642,2677,2682,2666,2648,2596,2537,2531,2534,2491,2454,2454,2449,2420,2383,2352,2332,2314,2290,2279,2281,2275,2261,2241,2201,2156,2156,2188,2196,2195,2204,2173,2107,2097,2146,2174,2159,2150,2165,2171,2157,2166,2217,2256,2243,2202,2171,2154,2156,2197,2260,2307,2323,2303,2271,2272,2304,2327,2348,2393,2426,2411,2386,2390,2393,2367,2348,2382,2441,2463,2449,2447,2437,2392,2376,2436,2487,2471,2445,2446,2439,2416,2403,2394,2379,2365,2353,2339,2330,2332,2340,2359,2378,2379,2379,2383,2372,2346,2315,2289,2292,2324,2334,2320,2323,2331,2315,2305,2310,2306,2295,2284,2273,2273,2294,2316,2324,2327,2336,2337,2323,2312,2313,2301,2270,2245,2250,2273,2276,2254,2257,2284,2292,2290,2296,2299,2309,2324,2311,2287,2270,2236,2209,2238,2286,2301,2291,2285,2284,2259,2213,2204,2232,2231,2204,2217,2269,2297,2286,2288,2321,2338,2333,2337,2330,2309,2313,2329,2327,2327,2346,2373,2385,2345,2288,2292,2339,2367,2384,2385,2346,2306,2305,2336,2374,2395,2383,2349,2315,2319,2372,2430,2452,2426,2388,2404,2455,2450,2385,2334,2345,2427,2502,2485,2431,2416,2402,2380,2388,2402,2421,2455,2453,2423,2424,2430,2419,2423,2438,2443,2439,2437,2461,2500,2498,2469,2475,2494,2458,2394,2385,2430,2450,2448,2473,2491,2482,2510,2542,2518,2497,2514,2526,2518,2488,2466,2499,2523,2484,2456,2476,2514,2573,2610,2569,2518,2514,2500,2472,2501,2585,2659,2680,2667,2639,2589,2538,2513,2505,2529,2573,2596,2614,2625,2602,2582,2570,2550,2574,2631,2626,2584,2584,2597,2602,2629,2615,2548,2547,2604,2617,2594,2571,2562,2585,2607,2598,2585,2589,2592,2575,2552,2548,2556,2550,2519,2507,2554,2601,2591,2582,2623,2645,2606,2583,2594,2586,2598,2624,2561,2454,2426,2499,2614,2637,2549,2527,2614,2665,2622,2547,2496,2486,2527,2579,2563,2495,2479,2524,2562,2562,2530,2518,2577,2636,2591,2511,2492,2473,2433,2430,2438,2418,2409,2414,2412,2422,2454,2521,2620,2677,2634,2550,2482,2425,2379,2352,2337,2306,2247,2219,2243,2287,2360,2416,2420,2470,2565,2603,2594,2596,2597,2534,2405,2305,2266,2235,2187,2127,2106,2144,2177,2197,2228,2258,2287,2330,2423,2525,2522,2452,2416,2402,2408,2419,2387,2337,2307,2276,2201,2066,1942,1903,1913,1907,1898,1929,1974,2011,2066,2144,2231,2289,2286,2283,2297,2268,2243,2259,2280,2301,2310,2302,2287,2260,2253,2235,2162,2110,2095,2049,2008,2016,2043,2069,2086,2069,1983,1879,1830,1796,1763,1784,1820,1816,1794,1832,1918,1932,1887,1885,1907,1906,1903,1952,2013,1993,1958,1948,1923,1953,1986,1976,2000,1950,1880,1934,1936,1910,1920,1805,1742,1790,1758,1774,1833,1823,1854,1871,1878,1937,1891,1777,1725,1742,1811,1792,1717,1765,1823,1806,1772,1737,1714,1704,1766,1826,1692,1524,1533,1639,1717,1698,1669,1681,1610,1546,1571,1553,1495,1478,1579,1696,1611,1535,1631,1637,1559,1568,1618,1656,1658,1691,1768,1728,1581,1485,1497,1494,1359,1300,1415,1471,1455,1452,1453,1467,1428,1419,1528,1577,1580,1608,1548,1470,1431,1355,1309,1333,1373,1404,1416,1438,1471,1429,1325,1371,1510,1386,1253,1488,1639,1522,1515,1556,1514,1426,1348,1452,1545,1446,1449,1512,1415,1186,962,1070,1393,1436,1293,1204,1217,1376,1452,1377,1309,1254,1315,1389,1263,1186,1271,1352,1397,1335,1219,1274,1455,1543,1544,1541,1389,1204,1249,1240,1206,1411,1391,1192,1251,1217,1171,1334,1278,1222,1373,1245,1107,1337,1246,736,1001,1848,1631,815,862,1412,1880,1852,1250,974,608,230,1515,3013,2797,1872,718,320,1223,1138,405,565,387,701,2226,2486,1760,2127,3073,3203,1971,572,294,588,1290,2011,1476,478,229,362,715,1250,1922,2731,3152,3262,3232,2625,1850,1303,699,287,153,23,56,233,476,985,1579,1996,2451,2968,3056,2683,2407,2230,1801,1253,878,873,1206,1500,1482,1156,792,840,1436,2334,3042,3245,3199,2903,2111,1246,704,431,457,699,1082,1589,1889,1916,1889,1712,1356,975,587,297,175,86,71,252,405,345,337,561,819,1034,1338,1717,2075,2425,2744,2889,2926,3054,3177,3133,2932,2653,2486,2499,2481,2301,2054,1963,2049,2035,1958,2028,2180,2405,2555,2364,2113,2156,2308,2289,2056,1764,1512,1358,1383,1396,1366,1553,1673,1478,1302,1142,900,839,851,651,376,287,362,338,201,180,215,177,228,462,647,640,693,882,923,849,872,964,1065,1139,1251,1480,1630,1629,1684,1814,1931,2071,2292,2474,2481,2554,2806,2905,2913,3089,3263,3311,3285,3297,3474,3601,3561,3605,3630,3505,3438,3349,3217,3294,3311,3000,2757,2747,2713,2617,2546,2543,2535,2316,2040,2008,2006,1817,1651,1620,1600,1541,1523,1500,1312,1139,1208,1280,1226,1263,1366,1368,1359,1476,1580,1467,1320,1374,1489,1613,1768,1742,1631,1714,1762,1579,1454,1543,1688,1780,1811,1762,1661,1647,1721,1759,1856,2054,2148,2126,2041,1905,1969,2266,2446,2429,2343,2298,2410,2497,2373,2305,2442,2532,2461,2425,2579,2820,2996,3078,3059,2942,2811,2833,3030,3118,3097,3285,3438,3294,3270,3440,3472,3480,3504,3400,3368,3469,3462,3409,3549,3703,3544,3334,3429,3482,3325,3370,3547,3556,3494,3375,3255,3319,3373,3279,3236,3211,3153,3217,3288,3238,3289,3351,3127,2995,3271,3364,3026,2809,2880,3060,3201,3125,3132,3369,3267,2986,3050,2972,2648,2600,2522,2324,2557,2895,2743,2427,2374,2414,2335,2302,2309,2162,2145,2322,2251,2162,2358,2374,2184,2171,2262,2363,2373,2192,2172,2345,2265,2119,2280,2389,2246,2346,2688,2594,2224,2332,2595,2457,2354,2493,2566,2592,2533,2449,2608,2781,2818,2951,3071,3041,2888,2721,2725,2708,2706,2951,2939,2731,2913,3063,3014,2989,2728,2629,2833,2664,2492,2714,2862,2965,3009,2818,2803,2991,2991,2853,2833,3003,3087,2929,2818,2773,2710,2808,2947,2967,2900,2779,2891,3098,2993,3021,3095,2722,2742,3083,2818,2789,2959,2434,2470,3018,2571,2265,2783,2858,2652,2700,2802,2941,2791,2505,2552,2476,2353,2654,2870,2810,2791,2704,2617,2698,2752,2687,2595,2561,2602,2601,2565,2530,2429,2466,2640,2565,2479,2624,2549,2390,2478,2443,2324,2334,2341,2520,2638,2363,2287,2501,2513,2516,2532,2348,2299,2433,2479,2532,2601,2603,2574,2356,2188,2503,2728,2455,2381,2598,2556,2359,2314,2365,2253,2090,2323,2639,2664,2689,2557,2331,2436,2362,2082,2286,2567,2456,2324,2422,2634,2623,2331,2140,2144,2236,2377,2372,2153,1985,2070,2273,2422,2433,2283,2228,2333,2331,2214,2075,2159,2456,2315,2039,2278,2413,2283,2298,2284,2225,2112,2037,2168,2174,2259,2396,2027,1855,2034,1896,1966,2231,2309,2420,2175,1972,2401,2505,2200,2208,2310,2206,1906,1820,2073,2143,2112,2072,1940,2072,2123,1907,1907,1823,1594,1600,1663,1726,1806,1925,2073,1899,1679,1740,1753,1879,2076,1818,1478,1630,1967,1893,1554,1522,1702,1845,1877,1763,1887,2000,1718,1785,2092,1975,1944,2006,1781,1602,1526,1586,1774,1689,1696,2231,2502,2070,1830,2054,1988,1758,1692,1477,1558,2003,1920,1659,1790,1871,1819,1765,1729,1780,1758,1727,1713,1535,1489,1730,1878,1696,1515,1749,1858,1589,1718,1912,1631,1601,1705,1498,1571,1865,1900,1870,1785,1569,1604,1921,1938,1590,1591,2022,2147,1870,1783,1896,1759,1636,1869,1907,1685,1697,1672,1676,2063,2205,1978,1930,1869,1794,1893,1804,1667,1747,1659,1531,1798,2075,2004,1945,2069,2016,1764,1726,1868,1907,1971,2100,2122,2216,2461,2448,2150,2111,2232,1888,1500,1717,1899,1719,1762,1849,1773,1946,2038,1789,1833,2112,2075,1995,2197,2384,2373,2244,2026,1970,2300,2528,2202,1795,1784,1831,1709,1771,1881,1619,1497,1739,1697,1687,2125,2300,2177,2121,1861,1653,1715,1663,1617,1688,1805,2129,2170,1656,1360,1497,1681,1831,1917,2023,2053,1830,1730,1764,1571,1307,952,715,1236,2017,2179,1828,1563,1807,1934,1443,1315,1588,1428,1411,1775,1872,1680,1277,1056,1369,1471,1246,1399,1701,1653,1297,1097,1426,1687,1413,1262,1581,1875,1807,1508,1185,961,1062,1435,1615,1581,1533,1253,983,1308,1838,1910,1660,1284,901,897,1265,1587,1529,1236,1411,1816,1585,1359,1581,1412,1145,1375,1512,1390,1318,1310,1395,1472,1391,1219,1259,1625,1813,1747,1865,1865,1601,1488,1389,1233,1327,1473,1452,1552,1791,1751,1495,1362,1260,1280,1526,1657,1758,1916,1803,1669,1673,1448,1240,1454,1809,1877,1687,1543,1555,1674,1723,1660,1906,2243,2007,1677,1763,1825,1670,1607,1734,1620,1274,1479,1904,1816,1784,1887,1719,1720,1905,1894,1798,1844,2136,2253,2006,1972,1970,1711,1739,1880,1786,1860,2047,2108,2163,2068,1810,1679,1697,1761,1784,1661,1603,1871,2115,2025,2062,2291,2078,1796,2183,2480,2147,2030,2194,2035,1887,1926,1862,1953,2196,2160,2050,2177,2254,2082,1922,1938,2072,2313,2474,2374,2189,1997,1871,1979,2117,2111,2055,2043,2145,2152,2047,2177,2240,1958,1886,2174,2272,2045,2059,2376,2285,2001,2128,2277,2365,2501,2380,2321,2368,2112,1867,1738,1735,2153,2399,2139,2094,2286,2156,1897,1925,2035,2031,2212,2419,2260,2114,2127,1853,1627,1974,2250,1994,1955,2240,2201,2084,2114,2055,2079,2113,2044,2029,1917,1851,1879,1710,1668,1813,1837,1828,1754,1854,2151,2169,2288,2443,2055,1757,1718,1474,1282,1266,1558,2015,2124,2192,2154,1792,1788,1886,1682,1761,1919,1805,1722,1742,1828,1824,1741,1759,1593,1383,1508,1617,1578,1630,1689,1691,1768,1887,1820,1716,1781,1679,1527,1617,1609,1576,1620,1453,1370,1494,1532,1553,1611,1746,1856,1699,1489,1372,1386,1546,1503,1511,1835,1856,1640,1583,1496,1460,1481,1510,1669,1581,1292,1341,1523,1573,1624,1708,1739,1591,1486,1572,1554,1598,1786,1644,1442,1531,1455,1293,1434,1481,1329,1456,1700,1728,1791,1909,1819,1582,1374,1339,1423,1423,1413,1445,1485,1624,1683,1593,1604,1681,1761,1761,1551,1474,1598,1569,1569,1676,1619,1549,1601,1653,1657,1608,1609,1698,1786,1893,1932,1809,1701,1699,1709,1644,1546,1592,1727,1705,1602,1669,1912,2111,2065,1818,1639,1673,1764,1772,1820,1904,1821,1717,1795,1847,1882,2090,2213,2145,2134,2050,1817,1749,1837,1924,2052,2121,2062,2013,2009,2010,2012,2040,2138,2205,2175,2180,2193,2140,2162,2216,2192,2260,2372,2307,2190,2156,2170,2239,2294,2328,2366,2301,2228,2255,2280,2350,2427,2399,2408,2432,2428,2518,2530,2454,2504,2507,2428,2457,2510,2525,2522,2530,2608,2625,2587,2646,2664,2593,2581,2613,2642,2620,2595,2694,2758,2657,2597,2690,2794,2735,2639,2750,2847,2722,2653,2713,2741,2766,2747,2692,2746,2815,2799,2785,2773,2749,2762,2795,2836,2829,2738,2710,2789,2844,2864,2858,2827,2814,2775,2742,2766,2776,2835,2919,2854,2812,2890,2882,2892,2971,2881,2737,2754,2838,2888,2869,2823,2854,2879,2810,2787,2873,2917,2856,2792,2782,2788,2812,2873,2930,2901,2790,2731,2752,2739,2685,2691,2766,2804,2775,2807,2894,2869,2779,2759,2752,2712,2664,2631,2673,2731,2699,2678,2732,2752,2716,2675,2677,2738,2734,2646,2657,2734,2719,2694,2716,2700,2683,2684,2622,2574,2642,2722,2713,2661,2622,2609,2596,2577,2609,2660,2621,2542,2532,2563,2564,2534,2547,2605,2596,2547,2565,2591,2572,2551,2539,2547,2534,2479,2477,2513,2528,2562,2547,2488,2515,2542,2508,2496,2456,2417,2486,2538,2509,2496,2499,2484,2452,2407,2390,2398,2413,2445,2461,2458,2453,2439,2454,2473,2419,2354,2343,2358,2356,2308,2284,2331,2361,2370,2389,2399,2433,2429,2314,2253,2291,2284,2277,2321,2296,2230,2267,2351,2340,2281,2270,2257,2243,2290,2319,2291,2267,2238,2244,2290,2246,2175,2212,2235,2186,2192,2237,2237,2257,2304,2294,2279,2297,2227,2143,2191,2217,2162,2194,2257,2258,2245,2194,2149,2189,2208,2160,2148,2210,2262,2202,2129,2176,2202,2137,2127,2159,2167,2165,2156,2176,2184,2120,2109,2173,2176,2148,2140,2118,2096,2079,2072,2079,2092,2151,2222,2207,2148,2122,2121,2127,2104,2069,2077,2099,2104,2106,2113,2111,2080,2078,2113,2095,2079,2119,2120,2095,2088,2077,2090,2056,1978,2025,2111,2105,2117,2124,2094,2100,2073,2056,2118,2083,2005,2050,2076,2027,2022,2043,2039,2020,2044,2112,2099,2052,2052,1978,1929,2024,2054,2015,2055,2036,1948,1950,1981,1981,2011,2046,2062,2071,2054,2025,2030,2031,1989,1963,1976,1966,1944,1957,1977,2001,2043,2061,2024,1965,1951,1985,2013,2045,2054,1989,1963,2007,2002,1998,2029,2002,1977,2004,2006,1996,1991,1973,1989,2005,1975,1952,1938,1930,1958,2000,2030,2013,1956,1977,2040,2007,1985,2032,1999,1923,1925,1936,1932,1946,1939,1932,1947,1936,1926,1943,1962,1992,1999,1971,1981,1977,1908,1893,1925,1911,1891,1881,1876,1906,1925,1923,1945,1949,1937,1950,1948,1931,1912,1883,1894,1916,1908,1926,1937,1910,1915,1920,1878,1866,1883,1886,1894,1910,1916,1896,1859,1849,1854,1847,1856,1867,1856,1866,1893,1884,1858,1868,1890,1883,1873,1885,1888,1881,1885,1893,1907,1914,1900,1900,1895,1851,1837,1879,1894,1870,1856,1848,1833,1831,1837,1838,1842,1848,1843,1837,1830,1824,1833,1839,1845,1867,1861,1825,1826,1842,1836,1838,1837,1822,1827,1843,1842,1835,1833,1822,1816,1835,1847,1819,1813,1840,1825,1789,1803,1819,1800,1797,1813,1783,1731,1736,1788,1803,1774,1746,1727,1719,1723,1735,1764,1782,1759,1747,1757,1742,1740,1770,1790,1793,1777,1749,1746,1752,1742,1739,1733,1718,1718,1735,1745,1750,1763,1772,1768,1759,1746,1736,1745,1756,1746,1745,1778,1796,1759,1726,1720,1717,1739,1773,1765,1750,1758,1758,1753,1756,1763,1764,1773,1795,1784,1754,1758,1761,1749,1745,1737,1736,1745,1750,1761,1756,1730,1720,1717,1721,1725,1712,1716,1728,1726,1752,1782,1768,1754,1773,1783,1770,1762,1757,1744,1754,1770,1762,1761,1755,1733,1742,1757,1751,1765,1779,1762,1754,1769,1779,1764,1757,1773,1775,1759,1754,1755,1745,1737,1744,1741,1725,1729,1736,1726,1723,1729,1736,1745,1743,1744,1749,1734,1716,1709,1708,1717,1715,1704,1696,1673,1663,1684,1694,1695,1708,1710,1700,1696,1688,1689,1695,1682,1671,1672,1663,1656,1662,1661,1647,1650,1672,1674,1659,1672,1684,1676,1689,1696,1681,1687,1691,1685,1690,1681,1668,1669,1674,1692,1701,1690,1699,1713,1726,1748,1747,1744,1763,1765,1756,1750,1742,1749,1750,1739,1756,1759,1735,1759,1798,1782,1769,1787,1791,1786,1795,1812,1826,1820,1810,1814,1805,1795,1806,1820,1833,1842,1839,1844,1839,1820,1831,1847,1826,1813,1839,1863,1852,1832,1838,1853,1850,1857,1877,1874,1860,1858,1850,1840,1848,1853,1849,1847,1845,1852,1863,1848,1833,1840,1844,1843,1841,1846,1854,1845,1837,1837,1834,1839,1830,1813,1822,1815,1806,1824,1817,1811,1824,1808,1826,1833,1794,1843,1852,1752,1834,1938,1782,1722,1887,1920,1820,1798,1835,1854,1852,1858,1856,1813,1798,1851,1880,1848,1832,1866,1873,1828,1817,1854,1874,1873,1882,1891,1880,1862,1865,1891,1909,1892,1857,1845,1868,1896,1903,1899,1910,1918,1917,1932,1944,1936,1937,1945,1948,1951,1956,1973,1971,1939,1950,1994,1992,1973,1988,2002,1983,1977,2030,2063,2004,1943,1970,2044,2049,1964,1938,2022,2070,2039,2002,1979,1988,2030,2066,2093,2111,2083,2028,2026,2068,2055,2002,2006,2036,2031,2020,2021,2014,2002,2012,2058,2116,2156,2159,2123,2090,2082,2056,2012,1994,1997,1989,1981,1990,2021,2067,2083,2069,2098,2139,2125,2107,2112,2099,2076,2060,2054,2051,2034,2040,2070,2075,2074,2090,2096,2080,2053,2055,2106,2141,2119,2097,2120,2147,2146,2154,2182,2173,2123,2082,2065,2056,2043,2036,2050,2084,2125,2163,2200,2232,2227,2196,2170,2145,2120,2090,2060,2064,2100,2121,2117,2115,2137,2174,2196,2186,2164,2170,2195,2190,2163,2152,2155,2159,2163,2178,2204,2209,2186,2166,2161,2167,2162,2141,2135,2135,2123,2138,2182,2193,2168,2154,2164,2174,2181,2196,2220,2225,2212,2219,2237,2225,2212,2227,2241,2250,2240,2189,2159,2178,2197,2215,2228,2209,2207,2233,2233,2227,2237,2218,2188,2209,2250,2237,2188,2173,2201,2216,2214,2224,2228,2215,2207,2206,2226,2260,2246,2215,2228,2228,2209,2248,2302,2302,2290,2288,2274,2263,2251,2227,2208,2207,2222,2243,2256,2271,2297,2309,2294,2269,2251,2251,2266,2266,2259,2272,2283,2274,2277,2289,2280,2264,2266,2269,2264,2263,2262,2260,2272,2289,2296,2301,2298,2275,2261,2276,2276,2250,2243,2254,2250,2250,2280,2310,2317,2312,2302,2299,2307,2310,2310,2313,2306,2294,2296,2304,2294,2277,2273,2270,2262,2262,2262,2261,2278,2299,2306,2311,2310,2291,2281,2290,2288,2288,2304,2310,2304,2307,2303,2298,2300,2290,2292,2317,2318,2293,2272,2268,2286,2295,2276,2283,2304,2291,2286,2302,2289,2275,2300,2329,2329,2295,2261,2270,2300,2312,2324,2334,2317,2299,2304,2303,2284,2279,2288,2289,2279,2268,2269,2290,2312,2307,2294,2310,2331,2320,2306,2309,2311,2313,2313,2296,2286,2291,2286,2276,2274,2266,2253,2260,2289,2300,2287,2298,2315,2290,2265,2285,2306,2303,2292,2284,2272,2262,2267,2272,2255,2231,2225,2228,2224,2233,2259,2250,2214,2210,2217,2221,2245,2238,2214,2233,2224,2179,2196,2229,2214,2210,2220,2221,2227,2219,2210,2207,2186,2171,2170,2158,2177,2215,2208,2201,2223,2219,2201,2210,2215,2206,2211,2229,2242,2233,2206,2205,2232,2234,2214,2201,2187,2184,2193,2189,2184,2183,2179,2190,2202,2204,2204,2188,2173,2177,2176,2171,2163,2144,2155,2178,2176,2181,2170,2126,2117,2146,2181,2197,2161,2138,2156,2127,2089,2110,2128,2128,2122,2104,2108,2120,2118,2132,2122,2091,2097,2103,2093,2118,2134,2107,2090,2092,2094,2099,2104,2097,2089,2095,2095,2072,2059,2079,2102,2099,2074,2062,2074,2086,2084,2074,2084,2108,2101,2084,2101,2106,2077,2067,2073,2074,2071,2072,2086,2097,2071,2023,2004,2032,2064,2071,2089,2103,2087,2087,2094,2069,2053,2061,2073,2084,2078,2063,2059,2068,2104,2129,2113,2119,2140,2122,2107,2104,2085,2076,2092,2111,2105,2068,2064,2098,2097,2069,2069,2091,2119,2133,2119,2089,2066,2072,2079,2060,2049,2052,2052,2077,2098,2071,2046,2044,2042,2051,2066,2074,2090,2094,2084,2088,2086,2065,2059,2079,2102,2110,2097,2064,2049,2067,2060,1999,1955,1979,2023,2043,2066,2087,2064,2032,2047,2064,2033,1985,1969,1997,2026,2012,2000,2024,2042,2043,2052,2053,2027,2015,2026,2014,1996,2025,2048,2028,2002,1968,1947,1996,2048,2038,2040,2083,2113,2107,2075,2066,2115,2144,2082,2002,2001,2059,2098,2106,2104,2073,2037,2041,2059,2068,2080,2073,2044,2020,2001,1991,2017,2064,2075,2054,2044,2036,2012,2019,2052,2047,2047,2086,2079,2023,2006,2015,2008,2003,1999,2008,2036,2035,1997,1986,2040,2120,2135,2082,2072,2102,2080,2032,2012,1999,1997,2009,1998,1975,1974,1999,2036,2060,2061,2059,2059,2063,2072,2066,2032,1979,1944,1964,2005,2013,2001,1994,1986,1979,1981,1993,2008,2013,2019,2024,2018,2031,2048,2019,1997,2024,2036,2031,2043,2039,2010,1975,1952,1974,2020,2034,2017,1987,1974,2004,2030,2031,2053,2069,2037,2010,2009,2003,1996,1985,1970,1978,2009,2042,2059,2046,2009,1968,1943,1960,2012,2052,2058,2042,2023,2021,2040,2075,2107,2116,2112,2112,2107,2095,2075,2039,2002,1976,1960,1968,1991,2003,2022,2042,2020,1974,1962,1997,2049,2078,2082,2085,2083,2077,2080,2080,2075,2078,2071,2049,2050,2074,2090,2095,2087,2063,2045,2055,2084,2107,2119,2123,2111,2079,2040,2013,1996,1983,1976,1978,1980,1995,2033,2059,2044,2015,1995,1976,1969,1974,1982,1997,2005,1989,1982,2001,2013,2026,2052,2066,2067,2066,2053,2043,2039,2013,1986,1980,1975,1987,2031,2063,2078,2089,2070,2039,2032,2030,2024,2024,2013,2009,2027,2042,2056,2079,2088,2086,2070,2036,2029,2036,2006,1986,1985,1947,1934,1987,2006,1991,2028,2063,2045,2029,2035,2046,2044,2016,1985,1969,1950,1955,1998,2023,2019,2039,2070,2086,2119,2152,2118,2054,2024,2001,1991,2033,2071,2076,2114,2146,2098,2050,2051,2040,2033,2057,2065,2070,2124,2188,2197,2147,2082,2027,1957,1886,1880,1920,1948,1977,2034,2096,2126,2116,2110,2113,2080,2043,2037,2017,2022,2091,2108,2049,2025,2012,1965,1961,1988,1970,1975,2045,2085,2071,2070,2066,2032,2020,2039,2018,1971,1970,1971,1917,1882,1923,1967,1966,1999,2117,2178,2086,2029,2065,1983,1864,1919,1974,1934,1990,2066,2025,2023,2089,2090,2048,2015,2012,2048,2057,2052,2065,2016,1964,1976,1912,1846,1950,2040,2036,2087,2093,2031,2085,2142,2085,2060,2065,2026,1992,1959,1977,2024,1926,1829,1932,2028,2043,2085,2092,2110,2142,2033,1948,2004,1939,1785,1785,1841,1846,1894,1972,2004,2026,2094,2160,2118,2003,1986,2005,1881,1793,1895,1970,1950,1950,1945,1924,1901,1897,2003,2075,1999,2004,2080,2037,1995,2013,2016,2055,2096,2111,2120,1983,1817,1861,1882,1774,1809,1905,1889,1896,1926,1956,2055,2086,2001,1961,1978,1964,1907,1895,1977,2032,2022,1994,1920,1907,1981,1998,2015,2073,2118,2131,2030,1987,2097,2025,1906,1983,1979,1974,2078,2049,2024,2042,2009,2129,2190,2058,2083,2124,2000,1932,1966,2046,2017,1910,1994,2018,1882,1949,1992,1843,1812,1900,2032,2109,2054,2121,2194,2047,1978,1976,1879,1969,2175,2027,1790,2048,2214,1903,2202,2585,1637,1110,2062,2435,2273,2567,2298,2012,2591,2526,1684,1247,819,537,1286,2353,2954,3349,3215,2425,2315,3282,3517,2153,733,408,502,308,102,322,1158,2460,3518,3812,3601,3264,2845,2091,989,321,463,668,608,709,1219,2144,3146,3646,3628,3604,3659,3193,2113,1222,904,919,972,697,298,431,1035,1719,2362,2866,3267,3580,3675,3543,3134,2444,1736,1278,1128,1019,797,743,873,937,1026,1194,1285,1442,1961,2636,2984,3074,3065,2660,2041,1730,1761,2145,2725,3029,3013,2650,1876,1289,1210,1158,1182,1889,2870,3236,3344,3587,3461,3343,3438,2681,1408,747,394,192,257,292,664,1267,1231,905,1152,1796,2024,1639,1548,2061,2506,2733,2448,1565,1201,1285,962,1045,1572,1260,703,888,1013,814,1123,1812,2210,2368,2598,3016,3529,3755,3624,3621,3790,3540,2864,2495,2577,2504,2203,2129,2383,2760,2911,2623,2180,1930,2142,2724,2749,1899,1073,610,287,182,188,336,849,1308,1428,1590,1760,1568,1168,854,633,581,793,1186,1606,1743,1632,1800,2088,2109,2274,2655,3052,3481,3326,2820,3148,3544,2938,2337,2400,2638,2747,2687,2889,3530,3850,3388,2598,2384,2905,3010,2536,2500,2631,2542,2648,2662,2480,2309,1825,1538,1818,1821,1656,1568,1036,741,837,382,435,1597,1796,766,467,1039,1152,563,218,478,706,943,1445,1543,1329,1475,1654,1918,2733,3318,2968,2392,2495,3137,3360,2778,1837,857,308,759,1707,2179,2013,1566,1137,758,359,195,529,1081,1410,1562,1857,2255,2414,2194,1782,1430,1130,805,706,901,1090,1304,1709,2166,2523,2664,2758,3142,3488,3432,3357,3402,3313,3082,2740,2498,2570,2615,2454,2422,2620,2850,2914,2914,3196,3473,3220,2840,2900,3178,3228,2926,2546,2388,2301,2056,1757,1527,1298,1016,854,893,886,814,856,884,869,942,952,904,1095,1506,1809,1854,1894,2125,2237,2068,1936,1983,2198,2517,2659,2548,2376,2258,2256,2256,2133,2007,1857,1645,1561,1534,1383,1153,949,995,1207,1073,708,587,590,533,509,560,659,605,432,588,976,1124,1153,1264,1377,1579,1858,1959,1877,1837,1855,1752,1619,1720,1927,1968,1941,2041,2247,2386,2411,2483,2557,2534,2669,2897,2808,2657,2854,3049,2912,2697,2625,2607,2593,2655,2707,2658,2694,2848,2904,2951,3088,3104,3067,3190,3287,3170,2992,2930,2922,2776,2570,2532,2532,2415,2375,2441,2446,2383,2255,2108,2109,2140,1939,1611,1448,1512,1604,1538,1417,1363,1299,1224,1191,1173,1215,1286,1328,1482,1682,1723,1762,1835,1760,1779,2045,2219,2187,2135,2130,2150,2148,2194,2382,2530,2559,2643,2730,2772,2912,3053,3088,3152,3175,3016,2914,3049,3171,3103,3020,3034,3011,2900,2803,2778,2807,2790,2649,2522,2545,2564,2457,2412,2517,2523,2313,2129,2113,2123,2045,1987,2051,2078,1915,1737,1685,1671,1667,1627,1531,1552,1617,1511,1414,1447,1389,1240,1180,1234,1302,1280,1248,1325,1373,1316,1289,1306,1330,1338,1288,1284,1387,1425,1396,1487,1656,1705,1600,1523,1630,1794,1836,1857,1972,2032,1942,1846,1860,1985,2156,2243,2195,2104,2032,2037,2163,2282,2246,2076,1914,1889,1924,1900,1948,2080,2083,1981,1923,1918,1960,1989,1973,1989,2002,1957,1890,1796,1738,1750,1732,1765,1909,1963,1898,1829,1757,1737,1759,1746,1744,1692,1572,1611,1774,1815,1755,1724,1779,1891,1910,1830,1790,1782,1770,1779,1796,1835,1915,1998,2036,2047,2098,2163,2172,2185,2224,2210,2186,2209,2264,2379,2513,2599,2660,2663,2589,2526,2497,2496,2536,2595,2681,2762,2810,2899,2981,2958,2963,3042,3049,3007,3027,3079,3109,3144,3215,3227,3111,2997,2962,3008,3188,3370,3393,3390,3443,3430,3357,3285,3222,3200,3199,3187,3171,3142,3109,3069,3017,3041,3134,3148,3102,3115,3122,3027,2937,2970,3032,3017,2984,2979,2988,3046,3075,2959,2817,2790,2791,2755,2769,2842,2865,2825,2794,2765,2715,2683,2648,2609,2647,2708,2660,2547,2492,2489,2477,2443,2423,2401,2318,2226,2232,2268,2233,2206,2236,2238,2208,2180,2123,2076,2103,2124,2052,1922,1807,1743,1698,1671,1728,1767,1644,1523,1593,1716,1734,1677,1570,1437,1407,1502,1539,1434,1349,1378,1427,1437,1442,1457,1433,1340,1272,1289,1300,1281,1275,1243,1216,1276,1332,1314,1312,1361,1387,1357,1316,1323,1358,1385,1432,1493,1485,1405,1364,1407,1460,1480,1517,1568,1593,1600,1579,1540,1551,1588,1586,1618,1735,1794,1717,1639,1650,1687,1707,1716,1708,1728,1820,1890,1866,1841,1868,1880,1862,1870,1909,1966,2027,2052,2044,2048,2060,2076,2118,2167,2192,2179,2141,2133,2150,2126,2092,2126,2224,2333,2390,2365,2313,2296,2317,2348,2382,2429,2447,2426,2451,2491,2449,2408,2427,2436,2439,2465,2504,2571,2632,2671,2705,2683,2631,2618,2620,2650,2708,2720,2712,2707,2679,2685,2719,2727,2747,2764,2754,2756,2753,2766,2840,2892,2894,2901,2910,2923,2910,2844,2814,2845,2872,2866,2815,2795,2880,2947,2927,2899,2879,2878,2919,2933,2896,2863,2850,2854,2855,2841,2853,2888,2896,2867,2841,2845,2849,2827,2813,2812,2814,2838,2825,2747,2711,2753,2780,2773,2798,2840,2812,2736,2716,2733,2719,2696,2668,2617,2596,2611,2615,2620,2636,2603,2536,2519,2522,2487,2489,2551,2576,2546,2497,2453,2466,2487,2420,2349,2381,2435,2416,2342,2296,2313,2324,2294,2282,2282,2258,2243,2248,2224,2161,2115,2129,2146,2108,2068,2063,2045,2017,2011,1994,1952,1906,1862,1838,1848,1866,1873,1871,1862,1843,1795,1733,1717,1732,1713,1674,1649,1644,1652,1630,1582,1574,1586,1566,1542,1523,1496,1499,1530,1540,1505,1443,1411,1431,1436,1394,1328,1254,1213,1224,1249,1266,1272,1272,1291,1332,1373,1391,1361,1311,1283,1260,1223,1194,1171,1138,1110,1102,1111,1116,1095,1049,1031,1105,1231,1291,1265,1222,1193,1191,1219,1215,1137,1034,977,1002,1086,1165,1232,1327,1455,1592,1678,1645,1530,1392,1222,1031,858,746,756,858,979,1158,1353,1453,1548,1651,1622,1593,1705,1739,1625,1577,1589,1522,1414,1344,1308,1253,1176,1188,1329,1472,1548,1620,1698,1742,1772,1807,1807,1780,1779,1777,1741,1692,1636,1590,1621,1698,1747,1804,1899,1976,2025,2088,2167,2219,2220,2202,2188,2141,2064,2025,2028,2012,1974,1955,1965,1994,2030,2060,2091,2128,2168,2215,2279,2335,2351,2343,2343,2342,2322,2301,2290,2271,2263,2299,2355,2394,2433,2474,2504,2554,2615,2631,2623,2626,2608,2580,2568,2537,2501,2494,2469,2432,2445,2479,2490,2497,2508,2521,2560,2616,2651,2650,2645,2660,2658,2623,2600,2593,2575,2564,2582,2608,2624,2638,2653,2658,2654,2650,2664,2693,2689,2634,2587,2568,2545,2542,2554,2534,2510,2509,2511,2534,2565,2544,2515,2533,2543,2532,2534,2521,2493,2500,2519,2508,2486,2464,2436,2422,2420,2392,2356,2353,2357,2330,2305,2305,2295,2267,2262,2285,2284,2249,2228,2234,2220,2174,2140,2134,2129,2113,2093,2069,2046,2041,2047,2056,2059,2045,2025,2015,2000,1971,1951,1946,1946,1952,1949,1923,1893,1882,1882,1890,1894,1860,1811,1811,1846,1853,1828,1812,1831,1860,1849,1819,1825,1838,1811,1764,1726,1708,1701,1700,1725,1740,1700,1665,1684,1703,1704,1696,1667,1650,1656,1647,1626,1600,1571,1558,1567,1590,1607,1591,1566,1558,1548,1545,1549,1527,1508,1514,1515,1518,1526,1516,1509,1504,1484,1476,1469,1450,1440,1428,1416,1423,1414,1402,1430,1442,1418,1420,1433,1417,1407,1420,1416,1390,1386,1405,1402,1383,1392,1406,1395,1400,1441,1447,1393,1373,1409,1414,1398,1412,1408,1392,1412,1413,1394,1406,1398,1393,1456,1468,1373,1345,1435,1521,1560,1568,1539,1501,1467,1384,1277,1278,1405,1528,1590,1626,1636,1645,1698,1732,1691,1633,1596,1543,1474,1402,1303,1194,1147,1193,1314,1472,1629,1806,2018,2178,2254,2304,2269,2079,1861,1696,1492,1253,1095,1037,1036,1093,1198,1312,1433,1590,1766,1918,2055,2196,2300,2340,2343,2317,2243,2128,2003,1876,1747,1612,1470,1353,1280,1237,1220,1250,1311,1380,1467,1591,1725,1833,1938,2073,2192,2268,2339,2393,2397,2383,2379,2364,2325,2271,2212,2138,2056,1991,1938,1889,1853,1814,1780,1781,1787,1774,1766,1772,1803,1866,1909,1915,1928,1968,2018,2054,2081,2127,2169,2198,2248,2278,2267,2281,2301,2280,2274,2280,2250,2226,2227,2199,2151,2141,2167,2181,2188,2225,2262,2279,2307,2332,2350,2384,2388,2359,2367,2385,2346,2267,2206,2206,2228,2204,2181,2204,2228,2263,2306,2305,2300,2333,2373,2418,2449,2421,2398,2430,2456,2434,2372,2308,2293,2287,2248,2240,2273,2285,2299,2335,2333,2307,2312,2328,2334,2347,2353,2348,2352,2363,2378,2398,2396,2370,2372,2397,2392,2360,2330,2293,2249,2228,2224,2218,2218,2223,2226,2253,2289,2289,2294,2337,2349,2327,2351,2372,2316,2264,2275,2285,2279,2279,2266,2251,2270,2286,2272,2265,2274,2276,2271,2276,2283,2286,2294,2318,2345,2353,2349,2354,2363,2354,2325,2306,2310,2311,2295,2285,2277,2258,2246,2242,2233,2222,2220,2218,2201,2183,2194,2216,2213,2202,2202,2201,2197,2194,2190,2199,2224,2246,2258,2266,2270,2267,2266,2283,2295,2284,2280,2287,2278,2260,2252,2241,2225,2213,2205,2203,2210,2225,2232,2223,2224,2238,2237,2232,2225,2192,2165,2162,2145,2129,2135,2133,2134,2155,2159,2150,2146,2135,2128,2132,2139,2147,2141,2134,2149,2161,2167,2173,2162,2158,2171,2166,2160,2159,2131,2120,2135,2120,2112,2132,2139,2136,2127,2119,2143,2150,2109,2100,2124,2118,2104,2108,2121,2130,2122,2117,2117,2105,2106,2119,2108,2098,2107,2106,2109,2118,2109,2099,2092,2079,2082,2091,2073,2063,2078,2088,2090,2097,2104,2107,2113,2120,2121,2111,2100,2094,2083,2073,2075,2063,2031,2020,2033,2041,2048,2050,2039,2050,2070,2059,2046,2062,2078,2078,2063,2050,2058,2057,2034,2037,2056,2045,2024,2018,2018,2016,2016,2026,2045,2048,2040,2046,2049,2033,2023,2030,2028,2012,2006,2010,2011,2018,2023,1997,1979,2022,2075,2066,2020,2000,2007,2012,2003,2002,2043,2108,2119,2084,2046,1947,1783,1660,1602,1604,1712,1894,2110,2377,2606,2695,2639,2436,2126,1816,1549,1336,1228,1238,1354,1556,1799,2046,2255,2390,2464,2482,2445,2388,2324,2265,2243,2240,2238,2248,2229,2161,2065,1916,1708,1501,1325,1203,1177,1242,1387,1617,1907,2210,2504,2771,2978,3104,3138,3077,2943,2766,2540,2261,1959,1670,1415,1202,1025,891,794,722,697,746,854,1002,1182,1412,1704,2014,2323,2653,2960,3201,3418,3609,3704,3703,3663,3597,3486,3344,3181,2983,2780,2617,2462,2275,2082,1897,1724,1571,1406,1218,1055,931,830,775,781,830,920,1064,1243,1427,1619,1804,1943,2051,2150,2196,2193,2188,2161,2105,2071,2056,2030,2024,2063,2119,2168,2228,2308,2390,2462,2535,2623,2725,2819,2884,2938,2983,2991,2976,2953,2893,2807,2741,2664,2538,2421,2356,2303,2247,2213,2195,2186,2204,2224,2210,2194,2203,2201,2172,2134,2110,2104,2104,2093,2069,2043,2024,2007,1981,1954,1943,1934,1921,1917,1925,1939,1953,1958,1952,1953,1970,1983,1975,1964,1964,1957,1939,1921,1897,1871,1865,1866,1860,1863,1879,1896,1916,1947,1963,1961,1971,1998,2021,2045,2077,2114,2158,2210,2257,2299,2348,2397,2429,2437,2429,2414,2399,2378,2351,2339,2358,2382,2389,2388,2387,2386,2384,2371,2358,2352,2332,2305,2303,2308,2306,2322,2354,2365,2354,2353,2358,2349,2342,2339,2312,2274,2254,2231,2205,2209,2221,2214,2202,2196,2197,2214,2249,2281,2293,2296,2305,2295,2266,2258,2267,2252,2218,2191,2178,2166,2148,2139,2135,2123,2123,2131,2125,2118,2115,2096,2079,2083,2072,2028,1975,1938,1913,1885,1859,1839,1829,1835,1831,1806,1808,1831,1829,1832,1861,1874,1875,1883,1875,1865,1881,1896,1892,1907,1945,1942,1903,1897,1907,1889,1889,1908,1880,1838,1827,1822,1838,1887,1915,1897,1870,1861,1852,1831,1827,1854,1877,1880,1868,1861,1878,1882,1848,1840,1865,1864,1850,1866,1889,1886,1875,1899,1948,1973,1976,1973,1948,1927,1930,1932,1943,1972,1983,1970,1957,1943,1930,1922,1925,1936,1937,1932,1928,1917,1917,1938,1945,1937,1930,1927,1932,1935,1935,1967,2003,1997,1991,2013,2027,2021,2014,2017,2024,2014,1998,1989,1974,1961,1966,1981,2000,2013,2013,2013,2008,2000,1997,1986,1982,2006,2010,1996,2000,1992,1977,1997,2010,1979,1966,1991,2005,1996,1994,1999,1991,1975,1948,1916,1936,1980,1949,1898,1917,1933,1905,1909,1930,1911,1884,1886,1888,1866,1850,1862,1872,1870,1882,1892,1883,1872,1863,1859,1865,1862,1859,1863,1859,1856,1861,1865,1871,1876,1878,1886,1871,1837,1833,1842,1818,1793,1796,1810,1813,1802,1792,1793,1793,1788,1777,1773,1779,1776,1766,1772,1771,1758,1766,1775,1759,1743,1740,1745,1754,1754,1753,1763,1767,1755,1735,1721,1726,1727,1707,1697,1714,1736,1743,1730,1704,1690,1704,1738,1756,1740,1723,1722,1732,1752,1763,1757,1774,1800,1783,1753,1758,1776,1779,1784,1802,1811,1794,1778,1783,1793,1794,1791,1796,1808,1814,1814,1812,1805,1802,1812,1811,1793,1793,1801,1798,1795,1804,1810,1817,1829,1832,1820,1812,1812,1817,1826,1839,1845,1842,1840,1841,1848,1859,1861,1860,1869,1886,1897,1898,1887,1881,1889,1898,1899,1900,1906,1910,1917,1942,1974,1989,1988,1993,2000,1992,1977,1984,2009,2021,2017,2011,2007,2001,2005,2018,2028,2036,2046,2047,2048,2062,2071,2056,2049,2076,2104,2102,2089,2085,2082,2081,2093,2108,2117,2124,2128,2122,2111,2115,2137,2152,2146,2144,2160,2171,2151,2116,2099,2115,2152,2177,2171,2157,2159,2166,2153,2131,2132,2162,2195,2207,2202,2190,2179,2187,2210,2203,2161,2143,2170,2201,2231,2267,2275,2242,2200,2157,2113,2111,2162,2221,2277,2339,2374,2352,2299,2239,2179,2140,2128,2125,2126,2138,2159,2184,2216,2253,2286,2305,2306,2306,2315,2308,2271,2230,2201,2170,2136,2107,2081,2061,2061,2086,2130,2171,2195,2210,2220,2212,2195,2191,2189,2185,2195,2195,2154,2110,2104,2108,2105,2116,2135,2151,2181,2214,2219,2216,2230,2228,2201,2191,2200,2200,2190,2184,2177,2165,2148,2119,2089,2080,2081,2062,2027,2006,1999,1990,1982,1983,1974,1948,1933,1944,1957,1961,1967,1968,1961,1959,1965,1970,1976,1985,1992,2009,2037,2047,2041,2045,2053,2052,2063,2089,2105,2113,2124,2128,2130,2141,2147,2144,2141,2134,2118,2109,2100,2075,2047,2037,2029,2012,2006,2003,1991,1980,1980,1976,1968,1971,1972,1957,1954,1975,1986,1994,2010,2011,1994,1984,1986,1987,1979,1978,1982,1981,1979,1978,1973,1969,1966,1964,1960,1954,1950,1943,1931,1925,1924,1929,1940,1945,1941,1937,1944,1958,1959,1946,1938,1942,1960,1982,1989,1985,1977,1975,1982,1993,2006,2009,2005,2018,2035,2042,2064,2093,2101,2106,2132,2163,2177,2185,2203,2218,2219,2224,2229,2228,2232,2253,2274,2275,2277,2299,2302,2280,2285,2307,2303,2286,2285,2291,2298,2301,2297,2296,2295,2290,2297,2307,2311,2321,2328,2318,2307,2307,2314,2321,2336,2348,2338,2327,2336,2345,2354,2363,2367,2365,2356,2359,2381,2387,2370,2361,2366,2376,2371,2353,2350,2353,2350,2345,2339,2344,2352,2349,2349,2354,2358,2356,2341,2337,2352,2356,2347,2349,2366,2370,2361,2370,2376,2356,2359,2386,2390,2384,2384,2384,2379,2382,2404,2410,2398,2407,2407,2401,2415,2405,2393,2423,2433,2419,2434,2458,2454,2427,2411,2417,2426,2443,2446,2429,2435,2444,2432,2430,2427,2422,2429,2420,2409,2414,2425,2436,2420,2393,2395,2400,2403,2415,2396,2358,2354,2372,2363,2328,2320,2331,2322,2325,2332,2293,2245,2240,2256,2248,2230,2226,2202,2161,2154,2157,2151,2155,2154,2153,2151,2134,2118,2107,2084,2056,2042,2037,2026,2018,2004,1969,1963,1983,1976,1981,1977,1944,1978,1973,1890,1974,2055,1871,1818,2032,2035,1858,1877,1975,1955,1918,1922,1926,1930,1928,1920,1933,1951,1931,1903,1917,1927,1908,1907,1911,1908,1932,1929,1895,1912,1925,1888,1877,1876,1851,1855,1871,1866,1876,1892,1884,1883,1903,1901,1868,1847,1863,1874,1863,1871,1889,1868,1839,1850,1867,1862,1865,1870,1850,1821,1809,1813,1828,1851,1878,1892,1876,1840,1813,1809,1822,1847,1862,1853,1839,1838,1847,1866,1881,1882,1886,1889,1885,1887,1897,1897,1885,1884,1913,1941,1941,1935,1932,1917,1912,1930,1934,1917,1916,1927,1918,1910,1922,1932,1933,1940,1945,1947,1948,1940,1937,1952,1969,1968,1952,1940,1933,1935,1958,1974,1965,1971,1976,1955,1958,1989,1996,1984,1975,1971,1980,1990,1985,1984,1999,2016,2025,2031,2038,2036,2030,2028,2026,2032,2051,2052,2040,2047,2060,2065,2078,2081,2073,2086,2109,2120,2122,2116,2107,2113,2133,2145,2145,2149,2154,2153,2163,2174,2163,2154,2159,2165,2173,2187,2203,2213,2204,2192,2194,2202,2205,2211,2221,2230,2225,2218,2225,2231,2225,2232,2245,2240,2234,2240,2240,2229,2234,2249,2246,2234,2233,2230,2222,2224,2234,2244,2245,2239,2241,2239,2230,2236,2237,2217,2214,2220,2203,2199,2220,2232,2227,2220,2221,2227,2225,2226,2237,2233,2219,2215,2212,2202,2187,2172,2167,2164,2144,2128,2131,2132,2123,2124,2129,2127,2141,2177,2196,2191,2195,2212,2230,2245,2252,2251,2251,2259,2276,2295,2311,2315,2294,2265,2246,2221,2195,2182,2158,2138,2145,2136,2081,2029,2020,2039,2042,2020,2001,1983,1969,1980,1995,1996,1999,1997,1983,1974,1959,1951,1964,1979,1996,2018,2021,2028,2053,2058,2041,2033,2040,2047,2040,2028,2030,2033,2028,2022,2016,2021,2031,2022,2016,2029,2037,2033,2033,2031,2009,1979,1975,1988,1976,1947,1937,1941,1934,1914,1892,1874,1864,1859,1858,1864,1874,1877,1867,1852,1839,1847,1861,1835,1805,1827,1834,1788,1777,1811,1818,1794,1768,1751,1761,1791,1797,1772,1758,1765,1773,1774,1770,1763,1768,1789,1796,1780,1772,1783,1801,1808,1792,1775,1784,1799,1787,1765,1757,1756,1753,1759,1773,1780,1791,1806,1804,1790,1790,1800,1805,1806,1810,1814,1810,1799,1804,1826,1827,1813,1831,1856,1850,1839,1832,1820,1818,1820,1817,1821,1820,1823,1848,1863,1856,1863,1876,1882,1890,1890,1875,1856,1847,1857,1863,1850,1839,1839,1849,1862,1854,1838,1845,1857,1855,1856,1860,1854,1843,1838,1853,1874,1883,1882,1884,1890,1896,1894,1884,1877,1877,1885,1894,1893,1884,1874,1873,1880,1885,1887,1877,1859,1866,1889,1888,1885,1901,1913,1906,1891,1887,1902,1909,1903,1908,1916,1910,1902,1906,1918,1919,1905,1898,1898,1897,1909,1917,1914,1920,1926,1915,1909,1921,1939,1945,1934,1937,1964,1971,1955,1963,1985,1994,1999,2005,2002,1991,1983,1984,1993,1996,1996,1994,1987,1986,1994,1992,1991,2001,1997,1983,1993,2006,2006,2009,2000,1977,1981,2011,2036,2040,2030,2028,2038,2038,2033,2035,2035,2031,2025,2015,2012,2018,2024,2026,2025,2024,2032,2047,2052,2051,2057,2054,2035,2034,2055,2064,2056,2044,2044,2059,2061,2040,2035,2053,2067,2069,2065,2065,2067,2067,2071,2070,2055,2055,2071,2078,2075,2059,2046,2063,2077,2053,2031,2037,2059,2080,2076,2062,2066,2074,2076,2083,2090,2084,2068,2062,2075,2084,2079,2076,2067,2058,2074,2090,2073,2063,2086,2098,2079,2067,2076,2075,2065,2064,2062,2052,2050,2059,2066,2066,2068,2077,2082,2074,2070,2071,2067,2065,2070,2085,2099,2099,2100,2100,2079,2061,2065,2074,2077,2071,2062,2077,2098,2099,2100,2101,2090,2084,2074,2062,2071,2071,2060,2076,2084,2067,2074,2093,2086,2083,2095,2091,2073,2074,2090,2084,2064,2064,2068,2060,2062,2068,2057,2056,2069,2058,2044,2066,2078,2051,2039,2056,2063,2060,2064,2063,2060,2068,2069,2059,2057,2063,2058,2053,2066,2069,2055,2054,2060,2046,2033,2036,2042,2048,2053,2058,2065,2067,2067,2074,2073,2067,2071,2070,2061,2061,2065,2062,2055,2050,2053,2062,2059,2046,2034,2033,2049,2066,2059,2047,2052,2068,2085,2091,2083,2087,2103,2101,2089,2085,2076,2063,2059,2064,2076,2079,2060,2047,2062,2074,2062,2046,2052,2072,2077,2077,2080,2071,2062,2067,2071,2081,2090,2068,2056,2081,2078,2051,2060,2085,2097,2099,2070,2028,2026,2059,2075,2057,2036,2044,2047,2020,2021,2067,2080,2045,2026,2050,2103,2138,2123,2086,2055,2028,2023,2036,2045,2064,2082,2075,2076,2102,2121,2128,2133,2116,2078,2048,2035,2031,2039,2053,2050,2035,2043,2070,2077,2068,2081,2103,2085,2059,2075,2092,2070,2055,2061,2050,2021,1999,2003,2037,2077,2099,2104,2111,2138,2162,2150,2125,2119,2124,2118,2100,2091,2096,2088,2061,2038,2019,2003,2004,2029,2055,2043,2013,1997,1990,2001,2027,2026,2031,2080,2095,2057,2048,2079,2101,2096,2085,2096,2103,2088,2090,2107,2109,2100,2081,2056,2036,2023,2038,2060,2050,2046,2057,2036,2027,2066,2079,2048,2032,2041,2040,2026,2028,2036,2023,2013,2032,2063,2084,2074,2053,2056,2067,2066,2050,2008,1978,1983,1970,1944,1968,2016,2035,2034,2033,2025,2007,2010,2035,2046,2051,2048,2026,2024,2032,2008,1995,2000,1978,1960,1969,1979,1979,1962,1960,2008,2040,2017,1988,1959,1938,1962,1998,2013,2033,2059,2048,2007,1986,1984,1972,1993,2043,2037,2012,2050,2084,2053,2023,2036,2049,2042,2039,2053,2073,2086,2065,2019,2001,2013,2028,2050,2063,2061,2044,1993,1956,1997,2040,2025,2023,2048,2047,2034,2033,2024,1998,1984,1987,1973,1942,1940,1975,2019,2034,2010,1994,2007,2012,2017,2042,2058,2060,2068,2077,2071,2045,2025,2036,2057,2069,2079,2082,2070,2064,2064,2047,2027,2033,2037,2022,2030,2052,2042,2036,2054,2031,1985,1985,2003,1994,1985,2000,2027,2053,2065,2060,2069,2104,2124,2105,2081,2071,2054,2051,2085,2128,2144,2143,2145,2144,2121,2093,2092,2103,2098,2096,2111,2115,2097,2087,2108,2137,2142,2132,2134,2133,2111,2075,2028,1993,1996,2007,1992,1983,2006,2024,2013,2003,2017,2053,2101,2144,2143,2112,2102,2110,2101,2092,2115,2143,2139,2105,2076,2071,2073,2046,2005,2012,2053,2062,2049,2059,2072,2061,2046,2057,2086,2096,2096,2129,2160,2153,2152,2159,2145,2133,2124,2097,2079,2075,2065,2058,2059,2064,2069,2071,2084,2104,2099,2066,2042,2036,2031,2028,2040,2057,2064,2055,2037,2037,2054,2057,2054,2048,2016,1990,1996,1991,1979,1983,1973,1962,1978,1988,1985,1988,1998,2020,2038,2036,2030,2029,2037,2044,2035,2038,2064,2066,2037,2019,2019,2014,2003,2003,2010,2005,1994,2002,2019,2020,2006,2004,2018,2017,1997,1988,1990,1993,1987,1969,1966,1980,1974,1963,1968,1963,1950,1956,1966,1965,1962,1968,1982,1993,1992,1975,1958,1974,2006,2008,1997,1996,1993,1997,2014,2021,2006,1981,1980,2002,2003,1999,2023,2034,2014,2011,2028,2034,2030,2021,2012,2009,2009,2007,2007,2016,2026,2017,1991,1980,1987,1981,1974,1989,1991,1969,1971,1984,1968,1972,2008,2003,1973,1973,1978,1971,1965,1952,1940,1949,1958,1953,1944,1942,1958,1974,1957,1933,1937,1954,1956,1954,1951,1939,1930,1946,1989,2020,2001,1967,1977,2004,2011,2029,2047,2018,1981,2000,2033,2020,1992,1998,2011,2002,1988,1975,1962,1983,2019,2017,2005,2025,2054,2064,2058,2044,2031,2023,2016,2015,2024,2038,2049,2051,2040,2029,2037,2052,2044,2029,2035,2043,2039,2045,2064,2078,2083,2076,2071,2082,2093,2075,2052,2060,2069,2059,2062,2074,2059,2045,2058,2064,2048,2040,2046,2058,2070,2063,2048,2061,2085,2076,2062,2076,2093,2101,2117,2125,2111,2093,2087,2091,2093,2093,2102,2112,2118,2119,2109,2114,2142,2151,2134,2120,2109,2109,2127,2139,2144,2152,2150,2143,2149,2159,2149,2118,2108,2136,2146,2115,2089,2094,2105,2099,2083,2078,2086,2102,2119,2121,2117,2129,2151,2145,2119,2117,2126,2102,2080,2101,2116,2107,2111,2124,2117,2104,2103,2106,2108,2125,2146,2144,2134,2139,2146,2142,2125,2103,2096,2102,2114,2128,2130,2131,2150,2161,2164,2175,2172,2152,2141,2134,2130,2134,2138,2148,2150,2130,2122,2137,2149,2153,2145,2128,2140,2171,2168,2146,2157,2174,2167,2168,2175,2165,2159,2158,2150,2161,2178,2170,2167,2174,2167,2168,2186,2185,2168,2164,2170,2170,2166,2156,2149,2156,2161,2149,2155,2177,2173,2172,2189,2182,2165,2176,2181,2162,2153,2156,2149,2142,2148,2152,2142,2131,2128,2145,2166,2164,2156,2147,2126,2126,2147,2149,2162,2184,2161,2142,2159,2154,2140,2140,2135,2148,2169,2164,2190,2227,2177,2132,2204,2263,2196,2127,2153,2200,2213,2209,2189,2162,2167,2190,2171,2131,2138,2184,2213,2224,2231,2239,2255,2237,2167,2118,2105,2090,2097,2127,2160,2208,2238,2231,2240,2256,2243,2204,2130,2059,2051,2069,2080,2116,2157,2179,2209,2237,2225,2208,2227,2234,2209,2210,2232,2226,2230,2263,2253,2207,2191,2192,2165,2133,2122,2108,2092,2106,2131,2149,2184,2221,2232,2230,2214,2183,2167,2161,2139,2131,2165,2204,2217,2227,2254,2270,2256,2224,2205,2213,2205,2168,2155,2166,2166,2180,2212,2214,2193,2199,2230,2250,2246,2230,2205,2188,2203,2216,2190,2157,2159,2179,2173,2157,2164,2158,2125,2128,2152,2138,2121,2127,2131,2139,2147,2142,2141,2147,2157,2180,2196,2189,2180,2185,2197,2201,2189,2170,2166,2177,2174,2154,2149,2159,2151,2144,2171,2194,2168,2136,2141,2152,2165,2189,2182,2155,2164,2180,2181,2185,2156,2107,2115,2156,2159,2130,2101,2081,2077,2103,2138,2134,2115,2132,2145,2142,2166,2183,2158,2139,2153,2161,2145,2132,2137,2135,2134,2162,2184,2173,2162,2159,2149,2140,2134,2122,2126,2156,2173,2157,2161,2188,2185,2155,2136,2128,2123,2117,2114,2126,2132,2114,2091,2090,2118,2148,2150,2134,2115,2100,2102,2108,2105,2110,2122,2117,2100,2101,2125,2135,2123,2125,2122,2097,2083,2083,2081,2089,2110,2140,2159,2140,2120,2128,2115,2080,2085,2117,2107,2071,2081,2112,2098,2079,2100,2111,2087,2073,2090,2101,2084,2077,2093,2091,2082,2101,2106,2074,2054,2054,2048,2044,2045,2030,2025,2057,2080,2070,2076,2106,2113,2102,2106,2122,2122,2101,2088,2075,2051,2043,2045,2031,2035,2056,2065,2083,2095,2065,2040,2056,2074,2070,2070,2088,2104,2122,2136,2124,2116,2131,2127,2098,2065,2045,2061,2071,2051,2075,2108,2072,2058,2094,2091,2085,2111,2117,2107,2099,2084,2086,2108,2113,2102,2090,2072,2079,2110,2112,2090,2091,2094,2093,2108,2103,2078,2087,2099,2100,2122,2126,2105,2114,2117,2086,2073,2079,2072,2065,2079,2091,2072,2062,2094,2111,2104,2111,2110,2091,2084,2090,2101,2108,2100,2099,2094,2061,2042,2053,2061,2074,2092,2076,2059,2083,2102,2072,2048,2059,2060,2052,2066,2080,2077,2086,2101,2090,2066,2061,2068,2061,2056,2062,2057,2054,2075,2087,2063,2038,2046,2069,2077,2076,2069,2057,2065,2083,2078,2067,2067,2069,2069,2069,2067,2062,2050,2051,2065,2055,2031,2037,2060,2070,2056,2033,2025,2036,2045,2045,2039,2033,2035,2049,2058,2040,2015,2017,2031,2039,2042,2035,2028,2042,2057,2054,2045,2040,2050,2052,2026,2016,2033,2037,2036,2047,2050,2047,2048,2048,2053,2049,2019,2000,2010,2025,2041,2044,2021,2022,2050,2035,2006,2018,2025,2013,2022,2031,2022,2017,2004,1982,1986,2004,2012,2017,2011,2002,2009,2001,1979,1980,1983,1968,1965,1964,1953,1956,1968,1963,1945,1925,1924,1955,1992,2000,1980,1964,1973,1980,1966,1955,1946,1933,1936,1946,1953,1966,1967,1948,1936,1944,1954,1943,1930,1940,1940,1925,1924,1914,1911,1946,1963,1941,1931,1942,1949,1932,1900,1906,1920,1907,1924,1959,1939,1903,1907,1917,1907,1889,1896,1927,1935,1924,1922,1912,1893,1888,1899,1924,1940,1920,1893,1897,1904,1887,1875,1888,1903,1912,1923,1934,1940,1932,1906,1893,1907,1905,1880,1870,1883,1893,1892,1898,1912,1926,1939,1938,1922,1918,1930,1922,1894,1890,1910,1911,1896,1904,1907,1878,1871,1889,1872,1847,1862,1893,1911,1912,1903,1920,1947,1944,1935,1943,1942,1930,1923,1921,1932,1944,1936,1931,1940,1931,1920,1927,1921,1908,1910,1912,1923,1947,1943,1919,1924,1945,1936,1924,1947,1952,1921,1924,1957,1950,1930,1933,1941,1954,1950,1920,1914,1932,1925,1915,1925,1926,1900,1887,1924,1969,1964,1944,1945,1939,1936,1968,1983,1926,1868,1887,1924,1931,1949,1972,1965,1955,1956,1960,1972,1968,1941,1930,1941,1934,1909,1914,1955,1964,1938,1944,1957,1938,1946,1979,1966,1931,1941,1978,1994,1991,1986,1960,1919,1907,1919,1912,1899,1913,1923,1911,1919,1945,1950,1961,1981,1962,1935,1938,1939,1958,1996,1996,1979,1981,1977,1975,1987,1980,1962,1952,1953,1965,1964,1942,1925,1922,1938,1960,1955,1945,1954,1953,1947,1964,1982,1975,1956,1945,1940,1939,1948,1962,1975,1988,1985,1960,1949,1963,1984,1989,1969,1951,1954,1949,1952,1977,1975,1945,1945,1968,1963,1940,1948,1985,1986,1946,1943,1982,1986,1955,1947,1948,1929,1930,1963,1973,1953,1961,1992,1999,1980,1956,1951,1981,2001,1963,1926,1948,1987,1990,1968,1953,1953,1949,1947,1971,2001,1995,1980,1992,2002,1994,2003,2018,2003,1985,1988,1987,1980,1988,1993,1981,1980,1989,1986,1983,1999,2011,2002,1997,2004,2002,2000,2016,2032,2019,1995,1998,2019,2029,2039,2047,2036,2030,2050,2059,2029,2002,2010,2024,2022,2032,2056,2063,2064,2080,2094,2091,2067,2040,2043,2058,2049,2026,2024,2047,2066,2076,2104,2113,2081,2079,2115,2106,2073,2070,2064,2049,2062,2084,2085,2083,2089,2082,2079,2101,2121,2115,2098,2082,2082,2097,2090,2057,2039,2054,2080,2084,2087,2123,2143,2116,2095,2113,2140,2153,2158,2167,2163,2126,2089,2073,2066,2057,2063,2108,2150,2151,2144,2121,2095,2123,2121,2067,2104,2166,2153,2184,2215,2137,2090,2124,2151,2182,2187,2151,2151,2144,2094,2077,2091,2087,2084,2085,2093,2120,2144,2150,2147,2140,2131,2151,2210,2242,2216,2202,2206,2170,2110,2074,2064,2068,2085,2099,2067,2005,2003,2056,2075,2071,2098,2153,2207,2228,2213,2195,2193,2202,2201,2186,2182,2166,2130,2140,2186,2192,2179,2197,2231,2253,2247,2210,2159,2126,2130,2148,2142,2116,2099,2112,2138,2130,2095,2070,2050,2045,2067,2074,2050,2036,2052,2075,2082,2092,2123,2140,2135,2140,2140,2118,2107,2114,2123,2144,2166,2175,2189,2208,2212,2200,2187,2180,2180,2189,2207,2215,2212,2207,2193,2183,2197,2206,2191,2180,2176,2174,2179,2172,2154,2153,2158,2157,2165,2173,2166,2156,2156,2164,2180,2192,2181,2161,2169,2186,2163,2144,2170,2182,2153,2137,2140,2135,2141,2160,2158,2138,2129,2136,2145,2148,2140,2130,2125,2127,2137,2144,2135,2131,2138,2137,2123,2115,2124,2138,2139,2139,2162,2186,2183,2184,2205,2204,2176,2166,2172,2170,2181,2197,2192,2187,2182,2161,2164,2187,2188,2192,2207,2205,2219,2235,2213,2193,2195,2188,2190,2201,2191,2182,2176,2167,2172,2182,2182,2189,2196,2194,2201,2208,2189,2178,2196,2197,2173,2178,2200,2195,2190,2207,2202,2169,2155,2174,2201,2217,2220,2211,2212,2230,2225,2193,2190,2216,2225,2215,2206,2187,2167,2170,2182,2182,2186,2198,2192,2183,2192,2186,2159,2154,2170,2169,2152,2138,2124,2129,2160,2181,2170,2155,2147,2152,2169,2157,2120,2131,2161,2125,2080,2104,2139,2125,2103,2105,2108,2099,2120,2159,2111,2007,2035,2157,2159,2086,2086,2091,2069,2091,2117,2108,2118,2125,2094,2080,2099,2097,2066,2077,2145,2160,2093,2085,2152,2165,2120,2101,2111,2119,2113,2102,2104,2097,2075,2095,2145,2142,2104,2116,2147,2127,2094,2098,2106,2099,2090,2078,2073,2097,2134,2146,2124,2092,2071,2064,2082,2100,2072,2036,2056,2101,2112,2090,2072,2074,2083,2094,2096,2068,2041,2046,2045,2038,2043,2037,2033,2054,2062,2047,2041,2053,2070,2065,2044,2037,2040,2051,2054,2018,2004,2052,2084,2081,2090,2074,2041,2055,2065,2030,2028,2060,2044,2014,2042,2068,2058,2070,2077,2044,2032,2048,2043,2032,2029,2038,2061,2051,2019,2031,2057,2047,2034,2039,2038,2027,2019,2006,1987,1994,2018,2011,2005,2022,2005,1989,2033,2052,2009,1995,2028,2046,2033,2015,2002,2008,2029,2018,1981,1975,1988,2001,2031,2034,2007,2018,2022,1988,1989,2006,2004,2019,2021,1990,1985,2000,2014,2032,2017,1974,1960,1974,1987,1988,1980,1975,1971,1965,1972,1997,2027,2033,2002,1968,1978,2017,2037,2026,2022,2026,2000,1968,1966,1970,1963,1955,1963,1992,2005,1986,1985,2004,2000,1983,1985,1993,1973,1947,1960,1970,1944,1953,1995,2001,1990,1994,2000,2004,1990,1972,1985,1995,1987,1989,1974,1949,1957,1955,1930,1937,1969,1977,1966,1966,1989,2007,1992,1966,1977,2011,2010,1975,1953,1949,1952,1955,1955,1964,1963,1931,1933,1990,2013,1981,1944,1925,1935,1956,1969,1997,2007,1961,1942,1991,2010,1964,1944,1986,2005,1964,1938,1960,1981,1981,1981,1983,1973,1961,1970,1977,1945,1916,1939,1985,2003,1982,1959,1976,1998,1982,1949,1918,1914,1953,1961,1914,1906,1957,1996,2008,2005,1983,1972,1986,1984,1964,1962,1965,1963,1985,2007,1986,1965,1982,1991,1958,1916,1898,1902,1918,1934,1934,1932,1953,1978,1985,1974,1942,1932,1975,1986,1926,1915,1970,1979,1969,2004,2005,1951,1954,2003,1992,1928,1890,1904,1958,1985,1950,1935,1958,1945,1932,1954,1932,1906,1953,1971,1926,1927,1945,1932,1964,2016,2014,1997,1987,1975,2004,2026,1987,1964,1971,1934,1898,1914,1942,1952,1950,1963,2001,2008,1976,1979,1997,1975,1951,1936,1913,1926,1970,1978,1959,1941,1918,1926,1963,1965,1943,1950,1966,1967,1977,1992,1987,1969,1962,1974,1973,1933,1903,1920,1942,1932,1906,1898,1937,2000,2017,1972,1932,1942,1965,1968,1965,1956,1947,1960,1983,1981,1958,1947,1962,1969,1942,1926,1951,1968,1954,1941,1947,1969,1995,1996,1976,1961,1958,1961,1964,1956,1938,1927,1951,1998,2019,2006,1994,1991,1989,1980,1950,1920,1944,2006,2019,1976,1975,2018,2013,1967,1943,1939,1950,1984,1996,1971,1957,1958,1957,1974,2002,1992,1964,1961,1963,1943,1931,1938,1960,1992,2004,1973,1935,1936,1968,1991,1985,1983,1997,1988,1952,1941,1959,1964,1951,1958,1979,1981,1974,1963,1950,1969,1992,1962,1935,1964,1994,2003,2018,2020,2002,1996,2003,1987,1946,1923,1941,1977,2014,2026,2004,2002,2038,2052,2026,2009,2016,2013,1995,1998,2017,1998,1967,1979,1984,1956,1958,1984,1985,1987,2006,2022,2040,2053,2042,2028,2029,2040,2054,2043,2005,1993,1996,1973,1962,1981,1997,2030,2066,2067,2070,2089,2079,2059,2049,2024,2019,2059,2079,2046,2021,2049,2076,2058,2047,2061,2054,2052,2086,2098,2065,2035,2034,2056,2057,2008,1971,1990,2014,2008,1992,1992,2024,2057,2059,2064,2073,2060,2067,2105,2115,2111,2129,2135,2114,2104,2117,2129,2114,2090,2083,2074,2052,2047,2055,2058,2080,2100,2073,2036,2047,2081,2087,2069,2064,2072,2074,2073,2066,2050,2060,2087,2090,2084,2070,2035,2025,2062,2081,2068,2062,2069,2076,2071,2057,2056,2064,2065,2071,2073,2062,2063,2080,2102,2120,2111,2080,2062,2055,2046,2060,2088,2088,2053,2032,2054,2075,2054,2034,2035,2030,2038,2069,2087,2097,2104,2085,2064,2048,2012,1985,2007,2057,2120,2162,2153,2136,2139,2135,2116,2077,2013,1976,1979,1978,1968,1984,2021,2053,2064,2080,2119,2155,2177,2177,2131,2080,2076,2071,2031,2007,2000,1980,1961,1967,2000,2034,2031,2023,2060,2108,2135,2151,2146,2116,2091,2083,2085,2076,2040,2009,2027,2071,2099,2097,2084,2083,2092,2088,2081,2081,2076,2055,2024,2001,1995,1999,2004,2002,1988,1992,2024,2039,2027,2037,2073,2093,2095,2106,2124,2127,2116,2095,2071,2083,2132,2151,2130,2129,2148,2148,2149,2157,2145,2125,2132,2155,2155,2116,2082,2091,2112,2108,2107,2126,2118,2081,2092,2144,2129,2072,2081,2100,2069,2077,2112,2076,2041,2081,2104,2075,2072,2120,2163,2146,2106,2120,2140,2093,2071,2122,2133,2103,2144,2203,2173,2125,2154,2190,2172,2160,2162,2132,2131,2183,2198,2166,2161,2166,2150,2136,2137,2156,2187,2201,2210,2233,2244,2234,2207,2173,2179,2211,2199,2165,2162,2168,2159,2157,2185,2224,2217,2164,2144,2169,2194,2221,2248,2241,2217,2211,2212,2203,2193,2197,2207,2205,2204,2213,2218,2215,2214,2218,2211,2191,2207,2262,2261,2201,2203,2239,2200,2160,2202,2251,2239,2197,2172,2180,2207,2228,2226,2200,2188,2211,2213,2175,2158,2168,2180,2202,2203,2161,2146,2190,2223,2198,2157,2150,2174,2204,2218,2193,2157,2173,2211,2207,2187,2182,2181,2201,2218,2195,2185,2211,2218,2211,2197,2159,2144,2169,2184,2179,2165,2143,2161,2211,2216,2182,2170,2193,2234,2249,2205,2151,2150,2184,2192,2150,2113,2136,2171,2165,2151,2146,2137,2138,2161,2182,2187,2192,2217,2226,2173,2110,2111,2156,2187,2163,2106,2088,2105,2125,2163,2164,2084,2059,2136,2154,2098,2098,2135,2130,2127,2144,2113,2054,2059,2086,2057,2078,2187,2189,2070,2056,2118,2059,1965,2021,2130,2133,2091,2100,2109,2089,2076,2055,2030,2060,2117,2104,2040,2018,2034,2023,1997,2015,2057,2077,2082,2086,2069,2037,2030,2059,2072,2052,2048,2065,2057,2030,2005,1985,1982,1999,2022,2044,2045,2023,2009,2009,2016,2036,2044,2017,1999,2019,2038,2024,2004,2016,2043,2047,2036,2034,2030,2003,1966,1947,1961,1995,2012,2004,2011,2029,2016,2017,2065,2082,2050,2033,2026,2014,2018,2010,1978,1968,1989,2000,1988,1978,1994,2005,1992,1983,1991,1998,1999,1992,1984,1986,1985,1986,2000,2004,1993,1988,1993,2007,2030,2058,2069,2045,2029,2051,2056,2027,2023,2044,2059,2065,2056,2044,2048,2052,2051,2047,2036,2038,2049,2046,2044,2046,2044,2050,2051,2031,2027,2059,2078,2057,2031,2033,2043,2037,2025,2033,2053,2057,2037,2021,2026,2045,2063,2064,2053,2066,2082,2067,2054,2062,2053,2028,2028,2058,2064,2026,1993,2001,2026,2040,2036,2030,2040,2037,2023,2030,2032,2025,2035,2047,2053,2052,2028,2030,2052,2036,2031,2058,2054,2063,2078,2040,2045,2080,2026,2009,2099,2126,2057,2002,2010,2077,2100,2034,2006,2033,2044,2058,2062,2038,2040,2050,2034,2022,2024,2041,2060,2048,2030,2039,2039,2024,2012,2000,2001,2006,2005,2004,1986,1966,1978,1996,1996,1997,2001,2001,1988,1972,1977,1969,1933,1934,1962,1964,1957,1946,1922,1919,1925,1924,1939,1946,1929,1926,1943,1948,1926,1905,1926,1951,1928,1910,1920,1910,1888,1893,1921,1939,1918,1895,1909,1915,1896,1894,1901,1895,1890,1885,1890,1909,1908,1894,1895,1894,1879,1873,1885,1897,1896,1887,1880,1880,1885,1888,1879,1872,1890,1910,1907,1902,1916,1908,1877,1882,1912,1914,1902,1895,1887,1895,1919,1928,1922,1909,1901,1904,1911,1929,1942,1918,1894,1900,1898,1899,1909,1892,1876,1894,1898,1894,1909,1905,1892,1908,1917,1899,1891,1906,1921,1909,1878,1868,1879,1878,1878,1898,1911,1904,1905,1919,1929,1934,1939,1942,1944,1938,1923,1915,1914,1918,1939,1951,1936,1930,1943,1950,1947,1940,1928,1923,1925,1928,1931,1934,1939,1943,1944,1948,1955,1964,1965,1953,1947,1952,1945,1939,1953,1964,1962,1955,1943,1955,1985,1990,1979,1978,1974,1970,1978,1990,1993,1977,1964,1976,1982,1970,1987,2024,2029,2006,1992,1988,1973,1961,1968,1981,1986,1997,2011,2013,2007,2004,2005,2008,2015,2031,2040,2030,2027,2031,2007,1976,1983,2013,2024,2016,2004,1999,2013,2037,2044,2027,2014,2008,1997,1996,2015,2035,2045,2041,2020,1995,1982,1978,1979,1984,1991,1999,2003,2003,2005,2009,2003,1989,1981,1988,1994,1990,1984,1981,1973,1965,1972,1987,1988,1976,1976,1989,1992,1994,2014,2036,2027,2004,2008,2019,2001,1980,1981,1991,2009,2028,2018,2002,2021,2046,2041,2031,2041,2051,2034,2013,2030,2065,2065,2044,2044,2054,2047,2033,2022,2006,1995,2018,2042,2033,2029,2049,2052,2036,2026,2017,2006,2008,2006,1997,2000,2011,2011,2003,2017,2049,2054,2040,2044,2045,2031,2029,2015,1977,1973,1996,1996,1995,2007,2011,2012,2020,2031,2041,2024,1985,1970,1985,2006,2031,2055,2063,2050,2024,2016,2033,2034,2026,2037,2030,2004,2015,2046,2038,2014,2020,2041,2047,2048,2055,2050,2031,2021,2024,2032,2043,2044,2035,2038,2046,2042,2041,2053,2059,2055,2054,2061,2071,2067,2050,2044,2057,2059,2051,2060,2074,2073,2074,2089,2099,2088,2073,2071,2073,2072,2074,2067,2059,2078,2097,2087,2075,2067,2059,2079,2111,2123,2115,2083,2067,2111,2120,2074,2107,2160,2113,2076,2081,2063,2144,2261,2115,1836,1866,2191,2383,2217,1953,1955,2152,2214,2082,1913,1854,2021,2308,2422,2337,2277,2240,2074,1862,1780,1832,1961,2127,2247,2292,2305,2277,2218,2163,2088,2028,2052,2097,2106,2113,2089,2036,2033,2047,2032,2049,2108,2165,2227,2268,2250,2214,2213,2231,2218,2172,2110,2029,1975,2002,2031,2018,2078,2198,2232,2209,2220,2225,2220,2233,2228,2211,2215,2191,2137,2109,2076,2012,2009,2064,2078,2082,2131,2161,2195,2294,2349,2308,2287,2277,2211,2171,2176,2151,2131,2162,2187,2184,2181,2174,2174,2198,2219,2199,2154,2122,2114,2127,2148,2139,2105,2093,2113,2146,2178,2190,2179,2163,2152,2158,2170,2171,2192,2224,2213,2178,2161,2169,2197,2210,2187,2187,2223,2233,2208,2191,2186,2183,2179,2170,2158,2158,2173,2183,2174,2168,2176,2172,2158,2157,2168,2179,2178,2165,2154,2141,2130,2127,2118,2117,2131,2138,2139,2151,2169,2173,2158,2146,2144,2133,2125,2130,2130,2118,2112,2132,2153,2140,2126,2143,2172,2191,2200,2201,2194,2180,2169,2159,2156,2163,2168,2169,2172,2177,2177,2162,2154,2167,2162,2149,2155,2156,2154,2168,2181,2175,2159,2165,2168,2128,2105,2131,2144,2131,2113,2115,2129,2128,2133,2140,2113,2096,2110,2132,2158,2158,2132,2133,2144,2144,2157,2163,2146,2135,2120,2088,2104,2147,2107,2045,2084,2139,2112,2062,2054,2070,2072,2069,2081,2096,2109,2111,2084,2055,2088,2156,2147,2079,2081,2132,2147,2146,2138,2114,2100,2095,2110,2132,2115,2104,2137,2147,2111,2098,2112,2094,2066,2083,2119,2126,2105,2105,2120,2102,2100,2130,2109,2070,2086,2111,2114,2111,2116,2112,2080,2080,2107,2095,2089,2110,2105,2080,2066,2085,2114,2118,2139,2157,2130,2104,2097,2101,2094,2070,2091,2116,2089,2076,2078,2085,2117,2121,2104,2092,2083,2112,2124,2092,2084,2093,2100,2101,2081,2073,2062,2039,2043,2058,2074,2077,2059,2060,2053,2041,2062,2062,2049,2065,2067,2056,2036,2011,2011,2020,2036,2028,1992,2016,2045,2016,2009,2007,2010,2029,1988,1953,1967,1984,2053,2049,1895,1899,2089,2112,1957,1890,1952,2047,2130,2105,1963,1900,1954,1997,2049,2094,2056,2015,2029,2016,1944,1906,1978,2078,2094,2056,2044,2076,2086,2047,2028,2024,2011,2037,2040,1987,1979,2000,2006,2029,2044,2028,2018,2037,2082,2106,2092,2078,2068,2049,2034,2030,2034,2019,1982,1984,2013,2010,1998,1996,1987,1990,2019,2048,2047,2026,2016,2025,2047,2064,2045,2015,2017,2026,2025,2028,2013,1963,1925,1947,1994,2003,1985,1992,2012,2003,1976,1975,1995,2001,2006,2015,2005,2003,2026,2044,2068,2090,2067,2020,2006,2028,2051,2053,2044,2004,1938,1910,1931,1958,1994,2049,2088,2093,2098,2115,2099,2045,2009,1994,1966,1933,1910,1899,1903,1925,1961,1998,2023,2045,2071,2088,2100,2109,2093,2048,2018,2023,2034,2021,1998,1986,1982,1996,2026,2034,2009,1978,1958,1958,1969,1961,1945,1944,1952,1957,1971,2003,2038,2043,2030,2032,2054,2069,2058,2039,2029,2007,1987,2008,2028,2005,1981,1990,2007,2007,1988,1969,1972,1984,1976,1955,1945,1945,1952,1959,1944,1933,1949,1963,1958,1955,1965,1986,1993,1967,1945,1950,1961,1964,1970,1968,1947,1941,1963,1947,1911,1937,1974,1939,1879,1895,1985,2014,1924,1872,1938,2002,2013,2004,1967,1925,1927,1978,2043,2075,2059,2032,2012,1968,1892,1849,1872,1913,1951,1985,1993,2000,2004,1950,1911,1952,1965,1907,1879,1911,1957,1997,2024,2028,2031,2041,2028,1984,1963,1977,1982,1958,1933,1933,1963,2011,2050,2048,2023,2024,2028,1979,1910,1890,1916,1948,1975,1997,2009,2011,1996,1954,1919,1928,1973,2025,2054,2057,2063,2075,2068,2028,1957,1903,1908,1927,1915,1911,1976,2073,2088,2038,2054,2127,2141,2092,2054,2057,2067,2036,1980,1926,1889,1884,1879,1835,1793,1780,1771,1767,1789,1832,1862,1887,1939,1978,1972,1985,2027,2050,2068,2097,2131,2176,2211,2214,2210,2212,2195,2154,2126,2124,2121,2100,2056,1994,1961,1972,1955,1902,1876,1879,1876,1877,1892,1891,1870,1871,1909,1944,1955,1967,1982,1973,1953,1958,1957,1938,1948,1963,1942,1942,1977,1983,1967,1977,2001,2010,2005,1999,2017,2057,2056,2023,2042,2067,2038,2052,2097,2054,2024,2064,2028,1966,2009,2025,1931,1891,1973,2042,2014,1946,1923,1967,2012,2002,1994,2015,2008,2017,2072,2058,1972,1927,1902,1881,1912,1940,1919,1912,1950,1994,2017,2022,2010,1977,1946,1940,1950,1953,1945,1939,1949,1973,2001,2010,1984,1962,1963,1949,1921,1924,1965,2004,2006,1978,1962,1961,1960,1958,1950,1936,1949,1982,1988,1984,2003,2007,1980,1969,1970,1955,1945,1954,1972,1991,1998,2010,2033,2035,2019,2008,1989,1975,1988,2007,2008,2010,2034,2047,2024,2014,2028,2025,2011,2004,2007,2026,2030,2017,2036,2072,2081,2071,2061,2058,2051,2025,2006,2016,2028,2013,1986,1995,2033,2043,2036,2044,2047,2044,2044,2041,2049,2059,2054,2061,2079,2083,2082,2080,2074,2081,2101,2110,2105,2099,2088,2065,2065,2100,2115,2090,2075,2092,2109,2105,2096,2094,2090,2092,2107,2112,2105,2106,2100,2079,2077,2092,2093,2098,2126,2148,2152,2145,2119,2111,2135,2126,2091,2095,2103,2086,2092,2113,2116,2113,2123,2141,2156,2150,2115,2096,2124,2145,2122,2109,2113,2105,2113,2124,2110,2105,2106,2101,2122,2148,2140,2122,2117,2121,2133,2139,2135,2129,2124,2123,2127,2126,2108,2085,2085,2097,2092,2096,2115,2121,2118,2119,2122,2134,2147,2145,2128,2124,2159,2195,2180,2136,2114,2121,2138,2132,2106,2103,2118,2109,2086,2092,2111,2107,2103,2126,2133,2106,2090,2103,2117,2120,2118,2116,2113,2100,2082,2087,2120,2135,2115,2103,2112,2117,2107,2082,2061,2057,2063,2072,2077,2077,2089,2094,2076,2063,2066,2083,2109,2112,2096,2087,2083,2080,2068,2050,2065,2095,2087,2060,2055,2074,2099,2116,2116,2101,2085,2096,2120,2120,2095,2068,2064,2091,2108,2090,2065,2073,2107,2117,2093,2080,2090,2114,2143,2145,2128,2128,2127,2120,2123,2111,2093,2106,2124,2127,2136,2140,2122,2110,2131,2157,2149,2109,2078,2082,2100,2113,2133,2148,2132,2116,2126,2130,2112,2100,2114,2139,2153,2144,2109,2061,2047,2096,2155,2156,2129,2149,2175,2143,2120,2131,2112,2100,2137,2151,2136,2142,2137,2100,2082,2113,2161,2168,2135,2119,2133,2143,2145,2163,2193,2195,2168,2148,2143,2142,2145,2156,2176,2182,2157,2137,2148,2166,2164,2142,2139,2172,2197,2182,2156,2154,2168,2166,2150,2149,2154,2148,2140,2132,2137,2159,2154,2121,2123,2175,2201,2152,2100,2122,2169,2161,2132,2137,2152,2145,2148,2180,2185,2145,2120,2137,2164,2179,2179,2170,2157,2139,2137,2150,2141,2114,2110,2142,2180,2193,2166,2129,2135,2163,2165,2160,2158,2133,2118,2140,2160,2166,2166,2152,2137,2127,2119,2130,2146,2141,2130,2125,2129,2136,2128,2121,2137,2147,2133,2125,2135,2141,2124,2110,2118,2141,2153,2138,2114,2120,2143,2145,2135,2126,2113,2102,2103,2118,2135,2145,2153,2157,2149,2123,2096,2111,2149,2141,2113,2117,2125,2122,2120,2105,2090,2111,2142,2140,2119,2118,2140,2156,2156,2150,2138,2120,2103,2100,2101,2094,2094,2106,2107,2099,2101,2109,2101,2087,2100,2127,2124,2109,2111,2115,2112,2103,2087,2083,2085,2073,2056,2050,2061,2082,2085,2070,2061,2061,2081,2110,2110,2089,2082,2086,2092,2095,2089,2082,2074,2058,2058,2081,2088,2063,2046,2047,2048,2046,2036,2035,2063,2077,2053,2040,2048,2054,2062,2068,2072,2080,2077,2059,2034,2027,2062,2098,2086,2061,2064,2080,2083,2057,2025,2031,2052,2042,2017,2015,2023,2023,2030,2037,2021,2015,2034,2035,2017,2009,2007,2014,2034,2045,2038,2026,2010,1987,1972,1970,1973,1993,2023,2030,2024,2024,2005,1982,2000,2026,2019,2002,1991,1978,1982,2010,2016,1991,1983,1990,1991,2006,2018,2004,1995,2001,2011,2032,2041,2023,2010,2000,1984,1988,2008,2013,2008,2007,2000,1990,1993,1997,1994,2000,2004,1997,1993,1978,1955,1964,1980,1968,1949,1948,1958,1958,1948,1950,1965,1975,1971,1957,1943,1948,1966,1983,1984,1960,1942,1942,1939,1939,1948,1945,1933,1930,1938,1941,1930,1925,1934,1933,1919,1924,1945,1955,1955,1950,1944,1950,1964,1961,1955,1959,1952,1943,1950,1963,1975,1980,1969,1961,1959,1951,1959,1977,1970,1954,1954,1965,1971,1972,1973,1956,1934,1949,1979,1965,1933,1936,1955,1957,1951,1954,1969,1977,1970,1958,1956,1952,1942,1943,1940,1915,1917,1955,1976,1966,1946,1937,1944,1943,1936,1950,1956,1937,1940,1970,1978,1967,1968,1977,1972,1960,1958,1955,1939,1926,1937,1967,1988,1974,1945,1947,1970,1967,1948,1955,1962,1945,1933,1930,1922,1921,1935,1953,1958,1940,1927,1946,1985,2011,1996,1954,1934,1944,1953,1960,1967,1952,1922,1918,1953,1974,1952,1934,1944,1962,1970,1963,1952,1957,1963,1964,1972,1980,1974,1962,1948,1936,1936,1944,1945,1942,1939,1935,1942,1962,1956,1928,1934,1964,1963,1937,1931,1947,1964,1975,1973,1949,1930,1942,1951,1945,1945,1946,1936,1933,1946,1959,1958,1953,1957,1952,1938,1936,1934,1914,1910,1939,1958,1944,1938,1955,1960,1952,1956,1952,1941,1944,1940,1917,1908,1919,1930,1936,1930,1913,1908,1928,1949,1957,1963,1969,1967,1966,1959,1938,1921,1936,1965,1980,1982,1978,1964,1963,1981,1980,1950,1938,1951,1968,1980,1977,1965,1963,1968,1980,1993,1990,1986,1997,1985,1943,1934,1974,2001,1989,1971,1963,1977,2005,2001,1969,1952,1953,1965,1990,2009,2005,1982,1967,1985,2005,2004,2004,2005,1990,1981,1989,1999,2012,2013,1995,1988,2002,2015,2003,1981,1984,2006,2002,1980,1985,2003,1995,1980,1999,2036,2028,1980,1980,2041,2064,2024,1997,2008,2030,2048,2034,1985,1977,2041,2084,2042,1989,1991,2021,2034,2016,1994,2015,2043,2030,2023,2041,2037,2031,2038,2021,1994,2003,2028,2034,2028,2036,2063,2078,2062,2040,2032,2035,2041,2049,2050,2036,2034,2046,2036,2012,2020,2049,2059,2050,2043,2048,2049,2034,2027,2043,2057,2054,2045,2046,2062,2073,2073,2075,2075,2065,2047,2026,2021,2038,2049,2062,2087,2082,2050,2047,2057,2050,2044,2045,2050,2056,2044,2027,2036,2060,2080,2084,2071,2063,2074,2085,2079,2062,2059,2075,2083,2081,2077,2065,2062,2074,2069,2052,2060,2077,2072,2064,2079,2089,2059,2030,2037,2048,2057,2075,2075,2069,2081,2082,2074,2082,2087,2088,2096,2092,2078,2073,2067,2065,2079,2093,2095,2087,2080,2090,2103,2101,2087,2070,2072,2092,2096,2086,2090,2094,2086,2081,2091,2100,2091,2093,2123,2129,2100,2089,2097,2094,2091,2083,2069,2075,2095,2105,2103,2102,2113,2128,2130,2124,2108,2087,2101,2138,2144,2117,2104,2123,2137,2117,2107,2124,2122,2111,2132,2146,2124,2102,2112,2140,2139,2105,2098,2124,2138,2135,2126,2105,2100,2123,2141,2133,2119,2133,2163,2165,2156,2161,2155,2137,2123,2100,2084,2104,2123,2111,2107,2145,2188,2191,2177,2182,2197,2203,2170,2102,2076,2114,2135,2121,2107,2101,2111,2127,2133,2149,2164,2144,2123,2134,2152,2157,2146,2138,2145,2145,2141,2150,2146,2122,2116,2131,2134,2121,2112,2131,2160,2177,2184,2159,2108,2097,2130,2147,2143,2140,2140,2144,2146,2141,2140,2140,2118,2093,2107,2130,2107,2088,2120,2135,2128,2157,2179,2163,2159,2143,2093,2060,2059,2082,2132,2164,2151,2130,2128,2145,2145,2104,2084,2117,2140,2142,2153,2150,2119,2090,2097,2136,2150,2109,2083,2113,2129,2105,2108,2141,2140,2126,2139,2140,2123,2128,2139,2141,2143,2132,2118,2112,2102,2110,2132,2121,2111,2133,2130,2106,2110,2121,2129,2133,2104,2085,2117,2150,2150,2135,2119,2126,2147,2135,2113,2117,2121,2111,2112,2131,2138,2121,2105,2102,2100,2094,2098,2118,2133,2120,2102,2104,2115,2126,2130,2118,2108,2114,2125,2140,2143,2128,2136,2158,2151,2137,2127,2106,2103,2121,2124,2109,2098,2098,2110,2121,2133,2134,2098,2071,2105,2141,2134,2123,2128,2132,2122,2099,2080,2071,2075,2093,2106,2110,2117,2119,2115,2118,2110,2094,2098,2109,2107,2108,2122,2136,2135,2130,2135,2143,2148,2128,2084,2090,2138,2131,2105,2107,2079,2078,2147,2150,2101,2111,2115,2071,2049,2110,2229,2192,2001,2030,2217,2187,2110,2133,2060,2043,2134,2059,2039,2212,2163,2017,2112,2138,2051,2136,2163,2062,2125,2172,2051,2048,2107,2026,2009,2085,2075,2087,2151,2107,2074,2129,2092,2029,2082,2094,2045,2088,2114,2068,2083,2092,2039,2062,2100,2047,2030,2058,2046,2075,2119,2083,2100,2176,2139,2082,2119,2105,2045,2053,2047,2025,2066,2065,2017,2060,2099,2060,2086,2136,2096,2080,2106,2085,2087,2109,2061,2037,2074,2068,2063,2084,2030,1977,2022,2047,2028,2053,2059,2029,2048,2063,2043,2058,2059,2014,2017,2036,2002,1986,2005,2009,2035,2072,2055,2040,2074,2085,2068,2078,2075,2039,2035,2045,2020,2004,2014,2010,2022,2049,2037,2013,2002,1987,2024,2101,2088,2005,1983,2021,2054,2072,2067,2044,2015,1984,1975,2001,2032,2049,2052,2033,2008,1991,1960,1932,1963,2018,2032,2032,2033,2003,1985,2006,2016,2028,2064,2050,1984,1947,1947,1960,1980,1993,2003,2018,2025,2033,2036,2024,2012,1996,1975,1982,1996,1981,1975,2006,2029,2009,1974,1973,2000,2002,1981,1988,2020,2043,2049,2051,2051,2038,2019,2008,2002,2001,2004,1995,1972,1968,1994,2007,1985,1976,1991,1992,1992,2017,2026,1998,1977,1990,2027,2052,2039,2013,2005,2001,1988,1986,1999,2010,2001,1982,1978,1992,1996,1989,1993,2004,2000,1992,1987,1976,1973,1988,1994,1991,1997,1993,1988,2000,1988,1951,1952,1988,2002,1991,1978,1972,1986,2012,2019,1994,1967,1971,1992,1999,1986,1960,1933,1934,1962,1973,1957,1945,1953,1965,1967,1962,1966,1980,1981,1970,1984,2007,1994,1961,1952,1954,1952,1964,1986,1991,1979,1984,2008,2013,1994,1990,1998,1990,1981,1974,1954,1944,1970,1997,1981,1947,1943,1966,1977,1967,1959,1964,1975,1985,1989,1992,1995,1992,1991,1999,1996,1983,1987,1991,1968,1944,1943,1951,1960,1965,1958,1952,1960,1961,1951,1945,1938,1928,1937,1951,1943,1934,1947,1964,1953,1928,1924,1930,1910,1885,1900,1934,1940,1939,1959,1977,1976,1969,1962,1955,1960,1983,2002,1990,1960,1945,1963,1987,1985,1968,1966,1975,1971,1962,1976,2008,2019,1990,1948,1933,1957,1981,1966,1929,1909,1920,1963,2024,2046,1996,1916,1839,1780,1785,1889,2044,2184,2280,2318,2309,2284,2237,2114,1905,1660,1445,1312,1279,1324,1413,1522,1648,1824,2088,2439,2844,3238,3515,3574,3377,2960,2406,1802,1216,729,410,279,305,465,761,1193,1711,2238,2722,3135,3444,3601,3594,3465,3256,2969,2617,2228,1822,1431,1087,787,548,413,387,457,629,888,1212,1588,1985,2365,2723,3056,3337,3537,3616,3533,3312,3038,2751,2444,2149,1904,1712,1564,1457,1395,1404,1494,1630,1774,1899,1990,2060,2113,2143,2169,2192,2201,2206,2205,2169,2089,1981,1864,1757,1647,1515,1370,1240,1155,1129,1150,1216,1342,1522,1747,2011,2279,2515,2708,2852,2947,3004,3018,2966,2838,2659,2461,2242,2001,1778,1608,1497,1450,1450,1488,1581,1696,1764,1794,1853,1952,2050,2129,2186,2208,2202,2195,2200,2206,2189,2130,2080,2111,2176,2198,2198,2210,2218,2224,2236,2239,2237,2246,2253,2245,2216,2177,2138,2096,2034,1933,1815,1743,1719,1683,1620,1560,1514,1494,1492,1479,1477,1528,1621,1727,1843,1987,2151,2283,2377,2494,2631,2714,2725,2701,2678,2651,2573,2437,2305,2193,2059,1924,1838,1760,1662,1604,1614,1627,1627,1679,1794,1899,1934,1926,1958,2045,2114,2135,2146,2153,2141,2128,2113,2087,2074,2099,2131,2140,2159,2212,2250,2253,2272,2294,2272,2237,2193,2102,2027,2019,1994,1928,1902,1908,1898,1900,1928,1941,1947,1977,2012,2023,2016,2015,2041,2074,2064,2030,2048,2111,2137,2121,2135,2199,2253,2261,2260,2291,2327,2319,2272,2240,2253,2258,2198,2124,2111,2110,2070,2034,2030,2014,1984,1981,2006,2028,2023,2006,2017,2056,2079,2081,2095,2117,2122,2118,2121,2130,2141,2148,2139,2118,2096,2086,2096,2103,2084,2059,2051,2045,2037,2041,2055,2059,2053,2048,2053,2068,2067,2034,1996,1987,2016,2071,2129,2157,2131,2077,2046,2059,2098,2145,2194,2242,2291,2305,2231,2098,2023,2057,2122,2127,2096,2109,2162,2176,2151,2151,2178,2184,2162,2138,2120,2111,2093,2067,2077,2128,2149,2129,2127,2134,2110,2089,2108,2142,2165,2168,2136,2092,2081,2087,2067,2036,2041,2070,2077,2057,2048,2071,2101,2109,2099,2099,2123,2154,2159,2140,2138,2163,2159,2099,2041,2041,2072,2078,2060,2068,2126,2186,2184,2128,2092,2110,2140,2145,2137,2132,2131,2138,2152,2167,2174,2167,2153,2148,2138,2092,2042,2050,2092,2100,2093,2116,2152,2177,2200,2205,2187,2201,2243,2240,2194,2166,2153,2134,2126,2128,2139,2163,2154,2099,2093,2155,2166,2110,2096,2134,2148,2129,2115,2123,2154,2186,2186,2172,2176,2175,2151,2129,2128,2133,2130,2121,2103,2086,2098,2125,2112,2060,2033,2064,2118,2152,2150,2120,2102,2115,2129,2123,2116,2123,2138,2148,2149,2146,2144,2131,2121,2134,2142,2123,2120,2158,2183,2167,2145,2138,2132,2129,2146,2163,2147,2113,2115,2160,2198,2198,2182,2169,2151,2120,2111,2146,2172,2155,2138,2139,2123,2100,2098,2096,2088,2098,2112,2113,2108,2101,2105,2141,2173,2171,2172,2189,2184,2171,2169,2148,2116,2124,2147,2126,2079,2071,2103,2116,2092,2081,2104,2117,2092,2073,2103,2148,2137,2090,2110,2189,2196,2124,2097,2131,2151,2149,2141,2116,2089,2065,2044,2050,2078,2092,2108,2130,2116,2093,2121,2138,2086,2050,2081,2113,2111,2091,2062,2059,2090,2090,2054,2047,2070,2072,2057,2051,2053,2060,2083,2109,2117,2109,2095,2080,2076,2099,2121,2094,2049,2056,2095,2092,2053,2035,2057,2085,2072,2044,2052,2076,2077,2071,2076,2092,2112,2107,2071,2052,2068,2072,2044,2028,2058,2096,2095,2073,2079,2107,2114,2108,2109,2101,2085,2083,2079,2054,2033,2035,2052,2065,2061,2040,2015,2004,2019,2052,2073,2065,2052,2066,2087,2087,2086,2083,2065,2064,2091,2098,2072,2048,2048,2066,2070,2047,2042,2075,2093,2071,2053,2059,2060,2042,2031,2039,2055,2059,2045,2033,2050,2075,2061,2018,2015,2053,2060,2036,2030,2023,2003,2000,2007,2007,2011,2013,2004,2005,2017,2011,1999,2012,2013,1979,1981,2034,2041,1994,1981,2005,2015,2015,2010,1983,1954,1946,1939,1932,1957,1998,2006,1982,1968,1990,2028,2040,2022,2008,1996,1977,1975,1983,1968,1940,1941,1961,1953,1924,1929,1954,1957,1955,1975,1987,1984,1999,2018,1994,1975,2006,2020,1988,1969,1961,1950,1965,1967,1930,1932,1991,2014,1973,1929,1920,1931,1947,1970,1983,1953,1918,1945,2003,1998,1942,1924,1963,2002,1998,1973,1978,2006,2019,2020,2016,2006,2011,2017,1999,1992,2013,2034,2046,2039,2015,2008,2019,2013,2000,1999,1999,1995,2006,2023,2024,2019,2022,2021,2017,2022,2029,2038,2037,2023,2019,2021,2004,1983,1989,2003,1996,1979,1986,2015,2032,2020,2002,2007,2043,2078,2069,2019,1998,2040,2076,2052,2018,2012,2010,1999,1992,2015,2060,2056,2021,2051,2085,2021,1956,1966,1953,1897,1912,1987,2017,2026,2070,2098,2074,2034,1990,1958,1954,1946,1925,1922,1946,1995,2047,2050,2008,1981,1972,1959,1954,1940,1905,1917,1982,1985,1927,1933,1990,1989,1944,1935,1959,1943,1904,1926,1964,1938,1926,1950,1910,1849,1881,1936,1920,1885,1907,1967,1991,1951,1916,1937,1956,1918,1883,1896,1905,1891,1901,1929,1943,1958,1976,1955,1909,1904,1926,1921,1913,1923,1910,1892,1900,1904,1899,1908,1919,1928,1931,1914,1895,1891,1889,1885,1893,1910,1910,1886,1881,1913,1932,1923,1921,1935,1946,1940,1919,1906,1912,1915,1906,1918,1945,1936,1892,1874,1891,1918,1942,1941,1918,1921,1951,1945,1902,1906,1959,1947,1878,1891,1981,2006,1949,1921,1949,1954,1924,1940,1978,1955,1923,1950,1983,1991,1996,1982,1953,1956,1986,2012,2023,2005,1971,1967,1977,1970,1981,2000,1977,1967,2013,2037,2024,2035,2051,2042,2038,2039,2019,1984,1957,1961,1992,2008,1991,1981,2009,2045,2052,2043,2045,2063,2074,2057,2029,2028,2065,2091,2048,2001,2032,2058,2020,2017,2061,2058,2011,1971,1967,2018,2072,2067,2057,2080,2077,2050,2063,2106,2119,2098,2070,2056,2063,2072,2066,2055,2037,2013,2017,2043,2042,2006,1988,2013,2052,2079,2089,2080,2076,2098,2104,2091,2091,2075,2047,2059,2067,2037,2034,2048,2040,2047,2071,2064,2041,2039,2056,2076,2075,2048,2033,2055,2078,2075,2061,2054,2061,2083,2103,2107,2094,2074,2053,2031,2026,2046,2047,2031,2040,2035,2011,2045,2089,2055,2016,2044,2084,2075,2023,1995,2039,2079,2053,2034,2066,2084,2068,2061,2068,2063,2050,2043,2051,2064,2065,2073,2099,2092,2065,2088,2123,2094,2043,2032,2046,2051,2045,2038,2048,2083,2105,2089,2085,2105,2109,2106,2111,2103,2086,2087,2095,2100,2104,2102,2100,2092,2073,2065,2061,2045,2040,2056,2065,2051,2042,2058,2072,2083,2110,2128,2120,2111,2111,2117,2128,2124,2102,2090,2093,2093,2087,2090,2110,2124,2119,2105,2102,2114,2118,2101,2093,2114,2127,2115,2103,2108,2111,2099,2087,2089,2091,2084,2079,2097,2125,2123,2101,2108,2129,2125,2113,2112,2109,2102,2108,2121,2112,2087,2085,2100,2103,2103,2101,2088,2089,2113,2117,2092,2078,2081,2076,2072,2078,2077,2078,2091,2097,2097,2102,2099,2100,2110,2108,2088,2079,2092,2102,2084,2069,2088,2109,2101,2076,2058,2060,2076,2083,2078,2069,2058,2050,2052,2051,2050,2065,2090,2094,2079,2071,2083,2095,2084,2063,2071,2093,2078,2041,2032,2052,2069,2067,2064,2079,2083,2067,2054,2043,2044,2073,2082,2058,2062,2086,2070,2037,2039,2055,2044,2031,2045,2048,2034,2050,2081,2075,2052,2048,2050,2048,2060,2078,2071,2049,2048,2069,2065,2031,2026,2059,2071,2052,2042,2030,2013,2042,2096,2097,2067,2068,2078,2064,2055,2074,2086,2070,2056,2061,2062,2050,2062,2109,2129,2105,2103,2117,2090,2059,2073,2091,2077,2044,2035,2071,2106,2095,2089,2122,2134,2105,2094,2113,2112,2097,2109,2125,2107,2083,2095,2124,2134,2119,2102,2108,2130,2139,2130,2126,2123,2107,2097,2106,2106,2101,2124,2156,2162,2153,2150,2146,2145,2162,2182,2177,2155,2137,2135,2140,2136,2129,2135,2150,2160,2161,2158,2155,2137,2107,2107,2143,2181,2215,2237,2211,2151,2102,2080,2072,2080,2120,2178,2213,2228,2250,2259,2218,2135,2064,2043,2046,2045,2078,2162,2232,2254,2261,2266,2256,2236,2207,2171,2143,2123,2091,2056,2032,2013,2013,2047,2106,2167,2201,2206,2211,2216,2210,2212,2217,2211,2199,2179,2153,2150,2158,2145,2119,2101,2092,2102,2134,2156,2151,2149,2165,2164,2135,2115,2130,2156,2155,2123,2105,2133,2164,2154,2129,2128,2152,2171,2168,2152,2149,2168,2170,2127,2087,2105,2151,2155,2115,2103,2154,2182,2125,2076,2116,2169,2165,2139,2121,2117,2123,2115,2088,2074,2101,2154,2173,2134,2096,2106,2125,2105,2052,2024,2047,2055,2028,2044,2102,2117,2090,2094,2136,2167,2155,2129,2115,2100,2083,2081,2081,2069,2055,2044,2050,2067,2070,2056,2048,2048,2047,2042,2041,2062,2092,2092,2073,2069,2071,2068,2076,2087,2075,2053,2049,2055,2057,2045,2026,2020,2031,2047,2062,2064,2054,2055,2057,2040,2034,2057,2068,2047,2027,2032,2043,2039,2032,2028,2021,2022,2031,2031,2033,2047,2056,2046,2024,2007,2012,2029,2028,2016,2027,2056,2052,2011,2001,2036,2050,2037,2036,2043,2035,2013,1988,1985,2001,2006,2002,2005,2011,2014,2012,2013,2019,2019,2013,2005,1990,1988,2003,2004,1994,1997,2001,2000,2003,2006,2008,2006,2001,2005,2007,1998,1993,1989,1983,1989,1995,1989,1980,1978,1987,1999,1992,1980,1991,2008,2005,1994,1997,2007,1999,1982,1987,1998,1989,1972,1974,1989,1988,1968,1970,1988,1986,1980,1987,1985,1976,1975,1977,1986,1990,1967,1950,1970,1995,1990,1975,1983,1998,1988,1985,2010,2015,1989,1969,1963,1962,1961,1955,1962,1981,1982,1968,1961,1960,1965,1975,1978,1985,1998,1995,1983,1975,1957,1940,1950,1970,1972,1967,1963,1962,1963,1956,1947,1957,1960,1944,1940,1954,1958,1955,1957,1968,1982,1987,1992,1989,1955,1938,1968,1979,1960,1961,1962,1952,1966,1995,2001,1971,1940,1964,1998,1967,1929,1953,1979,1952,1920,1946,1996,1977,1911,1902,1933,1955,1989,2010,1993,1980,1970,1941,1930,1947,1965,1976,1980,1981,1982,1975,1964,1948,1925,1916,1924,1925,1925,1936,1946,1951,1964,1978,1965,1940,1944,1963,1955,1937,1943,1958,1958,1939,1924,1941,1973,1985,1970,1946,1930,1928,1932,1954,1984,1995,1993,1989,1974,1957,1938,1912,1917,1949,1970,1979,1964,1924,1922,1966,1991,1977,1957,1964,1972,1934,1916,1984,2027,1962,1892,1907,1967,2005,2006,2002,2005,1977,1918,1894,1939,2007,2028,1987,1952,1959,1951,1902,1882,1930,1998,2034,2026,1981,1936,1921,1936,1969,1998,1993,1958,1919,1909,1949,2005,2028,2028,2018,1987,1953,1949,1968,1994,2006,2003,1999,1989,1971,1961,1957,1961,1985,2001,1981,1946,1937,1969,2001,1994,1994,2024,2033,2014,2008,2014,2010,1990,1964,1962,1981,1984,1969,1964,1976,1986,1981,1980,1986,1990,2011,2036,2027,2008,2008,2003,1996,2000,2000,1989,1974,1954,1950,1969,1986,1986,1978,1981,2000,2011,2012,2028,2047,2050,2040,2018,1994,1990,1991,1980,1972,1980,1982,1969,1967,1985,2002,2013,2035,2056,2054,2037,2034,2051,2057,2038,2025,2033,2043,2051,2053,2045,2042,2046,2049,2057,2058,2039,2022,2032,2051,2057,2055,2057,2058,2053,2046,2037,2023,2009,2004,2006,2017,2025,2027,2035,2039,2029,2030,2049,2056,2047,2039,2031,2025,2034,2050,2041,2011,1999,2009,2014,2011,2005,1990,1991,2016,2032,2033,2044,2054,2051,2055,2066,2059,2032,2011,2015,2033,2053,2076,2082,2065,2067,2081,2063,2036,2036,2043,2047,2056,2060,2051,2043,2045,2057,2067,2065,2072,2084,2082,2071,2059,2053,2063,2071,2065,2069,2079,2072,2064,2068,2074,2073,2065,2054,2046,2042,2046,2051,2041,2026,2026,2027,2022,2025,2034,2035,2033,2037,2040,2045,2058,2062,2050,2049,2067,2082,2076,2060,2042,2032,2027,2023,2026,2034,2035,2023,2008,2001,2002,2004,2012,2032,2045,2038,2033,2040,2050,2052,2049,2051,2062,2073,2080,2081,2079,2079,2074,2062,2070,2097,2109,2099,2090,2082,2073,2068,2067,2068,2073,2075,2063,2048,2052,2069,2070,2060,2067,2075,2059,2038,2038,2049,2049,2038,2027,2031,2052,2067,2063,2051,2048,2056,2063,2063,2061,2057,2055,2058,2056,2048,2046,2047,2058,2082,2097,2096,2104,2106,2086,2078,2099,2108,2096,2096,2120,2139,2126,2112,2131,2144,2126,2106,2099,2099,2108,2109,2100,2105,2106,2088,2088,2106,2106,2095,2091,2087,2094,2103,2091,2081,2094,2094,2073,2066,2076,2088,2092,2078,2069,2084,2098,2101,2109,2117,2115,2115,2126,2139,2138,2124,2117,2118,2113,2104,2108,2119,2115,2103,2103,2105,2098,2102,2112,2104,2090,2099,2112,2106,2096,2101,2120,2126,2104,2089,2108,2128,2115,2092,2102,2130,2131,2111,2111,2133,2151,2161,2160,2152,2157,2170,2171,2172,2181,2181,2171,2174,2184,2173,2151,2157,2182,2190,2177,2170,2175,2185,2199,2205,2194,2178,2169,2167,2179,2194,2181,2153,2153,2173,2173,2163,2168,2174,2167,2162,2167,2166,2163,2167,2172,2174,2176,2169,2169,2191,2203,2177,2144,2138,2147,2155,2162,2158,2143,2139,2149,2154,2157,2160,2150,2152,2173,2171,2153,2145,2134,2134,2161,2169,2154,2151,2140,2128,2154,2178,2165,2146,2131,2125,2147,2156,2132,2116,2116,2111,2114,2133,2138,2119,2112,2130,2142,2138,2133,2120,2100,2101,2115,2112,2097,2100,2118,2123,2118,2127,2143,2141,2129,2132,2141,2126,2091,2090,2126,2128,2097,2096,2119,2124,2116,2113,2114,2103,2093,2119,2133,2089,2086,2156,2167,2108,2081,2088,2108,2137,2125,2099,2121,2137,2104,2083,2083,2076,2082,2109,2109,2075,2061,2075,2077,2079,2106,2128,2125,2116,2101,2082,2078,2088,2097,2100,2091,2089,2110,2121,2101,2077,2082,2102,2101,2083,2079,2079,2066,2057,2069,2081,2079,2069,2054,2043,2045,2055,2058,2056,2060,2066,2063,2060,2069,2086,2085,2066,2064,2078,2065,2045,2052,2065,2063,2063,2068,2069,2070,2066,2061,2061,2058,2054,2057,2066,2075,2073,2061,2058,2069,2076,2072,2068,2068,2061,2050,2048,2055,2060,2053,2037,2028,2035,2045,2049,2053,2049,2037,2030,2030,2039,2049,2034,2018,2037,2053,2045,2049,2056,2037,2021,2028,2045,2059,2046,2015,2019,2059,2073,2049,2038,2049,2041,2020,2036,2081,2094,2068,2042,2015,1988,2002,2057,2087,2060,2030,2029,2039,2047,2044,2028,2024,2037,2037,2036,2050,2043,2009,2000,2022,2032,2018,2007,2021,2040,2034,2018,2013,2011,2008,2013,2017,2016,2018,2017,2013,2014,2015,2012,2015,2019,2012,2008,2018,2019,2001,1991,2003,2018,2016,2006,1998,1996,1994,1990,1994,2006,2012,2008,2001,2000,2007,2016,2016,2010,2008,2009,2014,2025,2026,2015,2009,2005,1996,1990,1990,1987,1987,1994,2001,2007,2019,2033,2035,2030,2028,2029,2028,2027,2023,2017,2012,2011,2013,2010,2012,2025,2032,2029,2032,2034,2024,2020,2017,2011,2016,2019,2010,2010,2015,2008,2007,2014,2012,2015,2026,2022,2012,2009,2006,2010,2018,2015,2006,2000,1997,2001,1997,1980,1978,1995,1998,1988,1985,1984,1977,1973,1973,1973,1975,1974,1968,1967,1972,1975,1971,1965,1961,1960,1963,1967,1969,1965,1958,1952,1952,1953,1948,1944,1947,1947,1938,1932,1927,1920,1928,1948,1956,1951,1952,1959,1960,1952,1946,1942,1936,1932,1938,1940,1942,1953,1955,1939,1931,1940,1945,1945,1951,1964,1981,1992,1979,1949,1939,1948,1945,1938,1943,1947,1946,1949,1947,1940,1941,1955,1977,1987,1980,1985,1995,1983,1971,1966,1955,1956,1967,1954,1945,1972,1994,1983,1968,1970,1980,1980,1977,1981,1979,1967,1969,1977,1973,1972,1987,2005,2004,1988,1980,1975,1962,1962,1982,1993,1988,1981,1976,1982,1992,1992,1991,1984,1964,1952,1963,1983,1993,1982,1967,1969,1974,1965,1955,1961,1977,1979,1961,1954,1967,1970,1964,1968,1975,1975,1964,1955,1967,1977,1961,1952,1963,1966,1952,1943,1943,1944,1943,1951,1959,1954,1953,1969,1972,1958,1957,1969,1978,1979,1970,1966,1970,1966,1956,1957,1959,1954,1952,1962,1971,1969,1959,1954,1958,1963,1964,1962,1963,1969,1969,1958,1952,1962,1970,1966,1965,1965,1956,1957,1972,1967,1946,1946,1960,1961,1957,1955,1961,1971,1962,1942,1952,1973,1963,1947,1951,1953,1953,1964,1965,1952,1954,1962,1953,1949,1960,1959,1957,1974,1986,1973,1955,1948,1950,1958,1968,1973,1975,1976,1974,1977,1990,1995,1988,1988,1994,1983,1971,1979,1985,1979,1980,1987,1991,2003,2005,1985,1973,1983,1983,1968,1973,1996,2006,1995,1992,2000,2004,2000,1996,1992,1989,1990,1993,1998,2003,2007,2012,2011,2004,2004,2009,2010,2013,2019,2024,2021,2019,2028,2035,2025,2014,2011,2014,2025,2034,2028,2025,2031,2034,2036,2042,2040,2031,2027,2029,2037,2050,2058,2057,2046,2032,2029,2033,2033,2036,2043,2047,2056,2063,2061,2067,2074,2066,2069,2092,2097,2071,2058,2081,2093,2072,2062,2068,2060,2056,2073,2086,2083,2073,2065,2066,2072,2076,2086,2099,2107,2105,2097,2090,2091,2099,2103,2097,2096,2113,2123,2110,2096,2097,2099,2088,2076,2080,2089,2093,2094,2096,2097,2095,2094,2102,2118,2121,2110,2111,2123,2129,2125,2122,2122,2116,2103,2096,2096,2087,2079,2090,2101,2095,2095,2108,2114,2108,2098,2099,2118,2130,2120,2119,2130,2120,2100,2103,2115,2112,2110,2110,2103,2107,2119,2115,2105,2105,2113,2122,2119,2104,2098,2100,2096,2098,2105,2107,2107,2107,2103,2104,2107,2101,2098,2105,2112,2116,2118,2123,2131,2122,2102,2091,2087,2080,2078,2083,2083,2086,2095,2105,2108,2100,2093,2096,2107,2117,2113,2106,2111,2113,2101,2093,2092,2091,2089,2089,2094,2099,2096,2091,2082,2063,2064,2087,2092,2072,2057,2062,2072,2069,2059,2067,2080,2085,2090,2093,2087,2083,2094,2102,2099,2098,2095,2090,2091,2093,2094,2101,2101,2088,2076,2075,2083,2084,2079,2094,2113,2103,2089,2092,2098,2098,2088,2075,2080,2094,2099,2099,2097,2088,2085,2090,2094,2086,2075,2089,2115,2123,2118,2114,2111,2107,2105,2111,2120,2128,2134,2135,2131,2128,2119,2106,2102,2111,2122,2134,2144,2146,2142,2124,2110,2121,2134,2129,2128,2137,2134,2127,2132,2144,2154,2143,2127,2142,2161,2150,2138,2146,2153,2154,2157,2161,2163,2164,2163,2162,2150,2134,2131,2144,2156,2159,2163,2168,2168,2166,2166,2168,2168,2160,2149,2153,2173,2183,2172,2152,2140,2140,2142,2148,2162,2168,2170,2176,2173,2164,2170,2178,2175,2181,2188,2177,2172,2184,2187,2178,2173,2176,2185,2186,2171,2154,2150,2159,2168,2165,2158,2164,2185,2203,2196,2180,2173,2162,2156,2159,2147,2130,2132,2150,2169,2172,2163,2165,2169,2162,2159,2152,2149,2166,2170,2158,2158,2151,2139,2147,2152,2142,2147,2162,2164,2154,2151,2158,2159,2145,2135,2135,2137,2142,2147,2145,2136,2128,2126,2129,2138,2140,2130,2130,2143,2151,2150,2140,2121,2107,2110,2117,2114,2112,2115,2108,2099,2099,2104,2106,2106,2102,2108,2122,2119,2103,2091,2082,2076,2074,2080,2092,2096,2090,2087,2080,2073,2080,2088,2087,2088,2092,2088,2081,2081,2083,2069,2046,2047,2061,2057,2043,2044,2056,2055,2034,2022,2037,2060,2074,2089,2101,2098,2092,2090,2079,2055,2034,2035,2054,2055,2038,2031,2032,2019,2005,2004,2012,2018,2022,2035,2056,2063,2054,2049,2054,2046,2027,2020,2017,2000,1990,2000,2018,2032,2034,2018,2011,2028,2037,2019,2004,2005,2002,1990,1984,1985,2002,2029,2041,2032,2023,2024,2028,2027,2026,2033,2042,2044,2039,2018,1989,1977,1972,1955,1943,1959,1998,2033,2047,2043,2034,2029,2029,2027,2019,2007,2007,2021,2023,2013,2010,2003,1989,1982,1981,1991,2013,2026,2024,2022,2028,2037,2039,2033,2025,2019,2022,2024,2008,1989,1981,1980,1990,2007,2014,2016,2017,2016,2017,2022,2033,2041,2028,2011,2016,2024,2016,2004,2005,2013,2013,2012,2018,2008,1987,1986,2001,2010,2016,2026,2040,2047,2036,2025,2025,2025,2027,2033,2034,2026,2017,2019,2027,2023,2017,2030,2046,2043,2032,2025,2020,2019,2024,2020,2007,2008,2028,2042,2030,2012,2013,2022,2020,2017,2022,2026,2024,2018,2016,2014,2009,2008,2015,2024,2032,2035,2033,2029,2028,2024,2011,2003,2011,2019,2025,2035,2028,2004,1993,1993,1992,1991,1990,1994,2011,2024,2024,2023,2034,2054,2057,2031,1999,1977,1966,1967,1977,1983,1992,2012,2025,2021,2013,2017,2025,2025,2029,2042,2045,2027,1995,1952,1933,1961,1999,2022,2044,2051,2024,1976,1938,1946,1983,2011,2028,2031,2006,1976,1962,1971,2007,2044,2064,2070,2061,2031,1998,1979,1979,1979,1970,1960,1948,1946,1972,2001,2007,2004,2001,2003,2006,1986,1961,1953,1949,1950,1970,1990,2000,2006,1999,1984,1979,1984,1997,2015,2019,2002,1980,1960,1946,1942,1944,1956,1980,2000,2005,1998,1990,1982,1975,1970,1966,1964,1965,1969,1975,1981,1984,1984,1993,2006,2006,2001,1999,1982,1957,1955,1976,1993,1993,1988,1987,1984,1971,1961,1964,1972,1969,1950,1927,1915,1920,1929,1942,1967,1980,1964,1946,1952,1964,1971,1985,1997,1997,1993,1995,2001,2008,2008,2000,1985,1973,1973,1977,1979,1988,1995,1989,1978,1971,1956,1937,1919,1906,1913,1946,1984,2008,2009,1990,1965,1952,1956,1965,1966,1968,1973,1974,1973,1972,1971,1980,1990,1981,1964,1953,1941,1942,1967,1990,1995,1989,1972,1947,1929,1928,1944,1964,1976,1981,1973,1959,1963,1974,1977,1987,2001,2009,2022,2033,2033,2032,2017,1984,1958,1940,1930,1941,1958,1963,1965,1971,1979,1988,1992,2000,2008,1997,1983,1985,1990,1987,1987,1987,1984,1982,1984,1987,1989,1995,2007,2025,2040,2044,2039,2032,2023,2005,1978,1954,1953,1976,2008,2047,2085,2100,2094,2074,2037,2009,2005,2010,2025,2042,2033,2020,2030,2035,2030,2040,2052,2040,2013,1991,1990,2003,2004,2005,2039,2097,2120,2079,2020,1985,1977,1980,1970,1950,1954,1949,1929,2010,2169,2212,2136,2072,2022,1968,1964,2016,2083,2120,2107,2077,2055,2033,1997,1900,1735,1596,1615,1870,2315,2760,2993,2881,2419,1778,1172,766,727,1108,1785,2567,3219,3546,3509,3119,2431,1645,970,545,448,616,936,1327,1705,2087,2545,3000,3398,3748,3831,3453,2850,2290,1730,1211,993,1140,1475,1869,2213,2379,2393,2319,2137,1889,1648,1412,1246,1203,1207,1238,1321,1414,1552,1822,2207,2653,3090,3405,3523,3399,3035,2533,1990,1502,1252,1319,1609,2067,2647,3154,3374,3264,2901,2413,1996,1775,1680,1589,1465,1308,1143,1054,1122,1400,1858,2338,2663,2741,2558,2174,1694,1246,958,875,969,1225,1593,1989,2389,2773,3067,3199,3131,2913,2671,2479,2382,2404,2459,2413,2254,2050,1899,1936,2254,2780,3290,3526,3340,2772,2002,1245,691,428,441,719,1252,1919,2590,3202,3611,3636,3256,2608,1871,1201,700,446,453,644,990,1513,2155,2815,3389,3757,3870,3718,3306,2726,2096,1481,981,686,585,650,866,1204,1650,2199,2805,3356,3712,3803,3627,3205,2623,1996,1410,973,789,890,1251,1778,2316,2731,2901,2770,2450,2122,1923,1960,2211,2485,2574,2373,1911,1358,932,778,939,1340,1831,2266,2534,2616,2612,2628,2683,2760,2844,2910,2903,2772,2533,2260,1999,1772,1609,1527,1522,1583,1679,1766,1825,1863,1918,2030,2200,2384,2512,2500,2327,2060,1796,1617,1556,1592,1688,1839,2035,2252,2438,2518,2434,2184,1856,1602,1546,1697,1948,2148,2194,2074,1881,1776,1866,2111,2395,2621,2714,2625,2372,2061,1816,1691,1672,1728,1833,1958,2083,2170,2173,2090,1963,1852,1819,1902,2074,2232,2258,2128,1922,1733,1621,1618,1713,1867,2046,2211,2313,2348,2342,2292,2202,2124,2109,2164,2267,2375,2432,2374,2188,1959,1798,1779,1922,2182,2476,2713,2818,2785,2689,2613,2595,2617,2633,2605,2509,2365,2220,2106,2052,2069,2124,2188,2262,2331,2401,2456,2415,2256,2060,1894,1789,1759,1784,1841,1908,1956,1975,1953,1882,1824,1858,1979,2104,2173,2183,2116,1956,1755,1582,1505,1620,1936,2344,2719,2939,2873,2501,1988,1597,1481,1638,2014,2495,2894,3072,2959,2568,2078,1695,1487,1451,1552,1709,1857,1959,1993,1979,1943,1897,1849,1809,1786,1763,1718,1665,1610,1544,1524,1592,1705,1800,1851,1874,1891,1884,1897,2000,2153,2305,2447,2517,2482,2419,2375,2328,2272,2237,2255,2327,2424,2518,2589,2625,2588,2448,2290,2198,2148,2155,2257,2367,2372,2250,2057,1907,1877,1919,1977,2061,2166,2234,2215,2133,2032,1933,1860,1836,1879,2005,2155,2238,2227,2140,2027,1976,1995,2044,2144,2259,2286,2211,2076,1913,1801,1827,2010,2277,2511,2639,2633,2469,2188,1921,1794,1842,2024,2282,2543,2701,2687,2490,2160,1823,1578,1460,1506,1677,1862,2039,2207,2279,2253,2214,2180,2128,2067,2031,2044,2066,2034,1969,1952,1992,2012,1963,1899,1861,1836,1830,1856,1900,1955,2006,2036,2062,2102,2147,2159,2111,2044,1997,1941,1877,1857,1907,2006,2090,2114,2107,2079,2002,1923,1901,1932,1983,2010,1999,1975,1935,1866,1790,1731,1713,1765,1886,2049,2184,2213,2143,2025,1899,1806,1772,1805,1923,2088,2206,2230,2197,2121,1996,1906,1908,1943,2029,2170,2184,2110,2191,2236,2005,1872,2039,2098,1941,1885,1957,2024,2059,1929,1659,1627,1868,1953,1823,1806,1912,1933,1866,1810,1819,1864,1845,1817,1923,2073,2101,2027,1969,2016,2126,2141,2072,2102,2220,2261,2212,2157,2090,1983,1920,1997,2153,2217,2139,2052,2048,2039,1962,1932,2017,2131,2194,2205,2179,2115,2009,1918,1899,1917,1941,1988,2052,2118,2140,2065,1965,1940,1949,1946,1969,2025,2069,2069,2041,2042,2087,2119,2115,2118,2166,2226,2230,2173,2121,2106,2095,2073,2078,2103,2089,2071,2114,2152,2119,2065,2038,2063,2110,2100,2061,2072,2093,2091,2111,2141,2159,2182,2202,2232,2271,2249,2161,2093,2065,2036,2012,2009,2023,2077,2172,2221,2183,2115,2038,1964,1932,1929,1955,2044,2128,2133,2123,2131,2126,2120,2127,2152,2218,2276,2266,2223,2198,2179,2124,2033,1995,2054,2124,2132,2096,2047,1995,1950,1919,1919,1960,2013,2033,2041,2061,2023,1927,1912,1985,2022,2006,1993,2022,2098,2137,2083,2000,1929,1867,1862,1919,1987,2054,2107,2105,2060,2025,2020,2007,1995,2033,2077,2064,2026,2004,1981,1956,1954,1952,1902,1866,1944,2042,2025,1968,1945,1898,1859,1891,1934,1948,1960,1952,1904,1870,1896,1935,1937,1942,1978,1996,1966,1916,1875,1859,1855,1842,1824,1809,1809,1834,1849,1844,1856,1874,1854,1817,1811,1846,1881,1860,1797,1769,1790,1813,1822,1834,1850,1856,1854,1847,1833,1832,1850,1850,1832,1835,1856,1878,1907,1941,1958,1942,1888,1826,1774,1720,1689,1724,1794,1837,1844,1844,1837,1820,1820,1835,1831,1813,1802,1788,1768,1753,1754,1771,1798,1837,1881,1907,1926,1930,1865,1781,1767,1796,1834,1899,1950,1948,1924,1890,1844,1818,1828,1853,1879,1926,1989,2018,2002,1979,1957,1936,1924,1920,1932,1960,1988,2010,2026,2027,2006,1954,1894,1875,1893,1926,1970,2006,2021,2024,2010,1993,1984,1967,1944,1929,1916,1912,1928,1943,1953,1984,2049,2114,2124,2091,2065,2049,2009,1956,1928,1945,1991,2053,2123,2161,2144,2106,2062,2015,2002,2032,2073,2106,2131,2147,2146,2123,2099,2093,2094,2107,2141,2179,2204,2208,2185,2146,2110,2086,2082,2087,2086,2098,2121,2135,2139,2136,2128,2131,2153,2174,2180,2180,2181,2164,2136,2127,2129,2127,2150,2193,2213,2204,2182,2149,2120,2108,2108,2113,2134,2179,2216,2227,2227,2204,2157,2135,2149,2176,2211,2255,2303,2330,2308,2267,2244,2226,2224,2243,2255,2263,2271,2257,2239,2230,2221,2222,2222,2218,2233,2247,2232,2193,2142,2116,2141,2193,2251,2291,2283,2248,2218,2190,2164,2140,2124,2151,2213,2259,2277,2274,2249,2208,2164,2134,2123,2132,2160,2179,2176,2174,2166,2128,2106,2135,2172,2181,2197,2234,2239,2197,2159,2140,2117,2104,2112,2117,2126,2150,2166,2162,2150,2133,2115,2112,2127,2152,2170,2168,2157,2149,2133,2117,2129,2147,2137,2122,2127,2136,2131,2107,2087,2090,2096,2090,2101,2137,2166,2167,2140,2102,2079,2071,2061,2060,2077,2087,2077,2063,2053,2046,2049,2062,2080,2099,2111,2113,2100,2063,2025,2012,2010,2002,2002,2019,2039,2052,2067,2082,2081,2065,2044,2027,2032,2049,2054,2054,2050,2031,2005,1987,1980,1985,1999,2019,2030,2016,2000,1996,1979,1959,1963,1978,1985,1984,1988,2003,2007,1988,1970,1955,1939,1941,1952,1948,1946,1954,1944,1925,1930,1949,1962,1978,1991,1974,1936,1909,1902,1903,1913,1936,1948,1938,1929,1930,1921,1902,1884,1886,1908,1920,1912,1907,1910,1916,1913,1888,1871,1879,1887,1900,1927,1939,1950,1965,1951,1925,1914,1896,1878,1886,1905,1925,1948,1963,1964,1949,1933,1930,1929,1923,1922,1915,1907,1917,1935,1945,1946,1939,1932,1941,1972,2006,2019,2009,1994,1976,1971,1993,2008,1993,1976,1968,1953,1945,1958,1973,1974,1975,1988,2005,2014,2015,2006,1991,1989,2004,2023,2036,2039,2039,2046,2047,2029,2005,1988,1985,2002,2030,2051,2059,2061,2069,2076,2062,2045,2049,2062,2071,2080,2085,2083,2077,2073,2074,2074,2081,2099,2117,2130,2141,2143,2143,2145,2139,2134,2129,2120,2128,2144,2141,2137,2138,2133,2147,2168,2163,2159,2159,2134,2115,2116,2119,2139,2171,2187,2200,2214,2201,2175,2169,2174,2179,2184,2188,2188,2183,2196,2233,2260,2274,2287,2275,2238,2223,2248,2282,2286,2274,2279,2290,2287,2271,2231,2203,2240,2276,2260,2254,2259,2242,2235,2234,2229,2245,2259,2244,2223,2218,2237,2254,2249,2253,2266,2256,2249,2254,2255,2251,2233,2217,2219,2225,2246,2274,2277,2286,2299,2284,2294,2332,2333,2332,2347,2333,2315,2309,2302,2318,2335,2321,2315,2326,2326,2331,2348,2349,2323,2297,2289,2272,2247,2248,2273,2300,2317,2311,2303,2300,2278,2254,2249,2251,2264,2275,2258,2247,2264,2282,2281,2270,2267,2262,2242,2240,2261,2266,2255,2246,2239,2237,2236,2234,2227,2198,2170,2179,2191,2194,2206,2207,2194,2182,2171,2171,2174,2160,2150,2160,2167,2171,2183,2206,2224,2205,2182,2187,2180,2147,2134,2147,2179,2221,2224,2186,2166,2170,2160,2131,2103,2104,2140,2166,2153,2130,2125,2125,2119,2114,2108,2099,2091,2073,2038,2023,2042,2053,2044,2048,2067,2077,2080,2085,2082,2060,2031,2014,2011,2013,2026,2044,2035,1998,1972,1963,1946,1931,1946,1979,2002,2017,2021,2005,1993,1993,1979,1957,1950,1942,1928,1930,1953,1974,1969,1937,1909,1900,1897,1901,1903,1880,1839,1809,1797,1811,1842,1857,1838,1804,1783,1780,1784,1788,1785,1781,1792,1812,1827,1838,1844,1840,1836,1835,1825,1821,1826,1820,1806,1802,1795,1785,1793,1808,1812,1813,1813,1801,1792,1794,1795,1796,1797,1786,1771,1770,1780,1791,1800,1799,1788,1777,1772,1775,1785,1793,1803,1819,1834,1840,1834,1820,1812,1814,1817,1812,1808,1826,1873,1924,1942,1907,1847,1812,1812,1828,1868,1922,1952,1932,1861,1785,1780,1850,1925,1957,1945,1912,1886,1879,1892,1914,1930,1923,1897,1881,1899,1924,1921,1900,1876,1861,1873,1902,1926,1931,1913,1888,1875,1878,1900,1926,1924,1912,1914,1919,1932,1956,1966,1950,1919,1893,1906,1955,1997,2014,2003,1970,1949,1959,1983,2000,2010,2008,1980,1953,1964,1993,2001,1998,1997,1992,1984,1985,1991,1994,1991,1979,1957,1938,1927,1928,1942,1959,1969,1981,1991,1986,1986,2003,2018,2010,1984,1959,1950,1949,1958,1980,1997,2005,2014,2021,2018,2006,1997,1999,2002,1996,1992,1993,1994,1990,1986,1995,2008,1998,1977,1966,1959,1959,1978,2000,2011,2005,1989,1980,1984,1991,1992,1996,2000,1992,1985,1994,2004,2008,2019,2022,2012,2010,2017,2023,2029,2037,2053,2061,2045,2024,2012,2004,2000,1999,1992,1986,1982,1981,1992,1999,1993,1984,1979,1975,1978,1982,1980,1975,1976,1993,2008,2009,2001,1995,1993,1997,2000,2012,2031,2041,2040,2034,2028,2034,2044,2045,2048,2053,2046,2036,2035,2032,2018,1997,1993,2015,2040,2051,2045,2027,2017,2024,2028,2027,2028,2028,2028,2023,2006,1994,2006,2027,2047,2066,2076,2068,2058,2056,2070,2087,2088,2077,2076,2082,2084,2088,2096,2109,2122,2122,2110,2103,2104,2103,2107,2119,2125,2120,2126,2136,2134,2138,2149,2139,2121,2118,2122,2126,2128,2124,2124,2123,2107,2099,2116,2131,2124,2118,2126,2129,2119,2108,2113,2135,2150,2142,2133,2138,2152,2164,2164,2155,2159,2171,2176,2172,2162,2154,2163,2174,2170,2160,2152,2148,2152,2150,2140,2139,2146,2147,2142,2146,2161,2177,2181,2171,2154,2143,2140,2143,2160,2183,2189,2186,2186,2182,2177,2173,2168,2168,2166,2167,2175,2167,2153,2168,2185,2182,2181,2180,2172,2170,2171,2176,2183,2174,2157,2153,2165,2177,2177,2176,2173,2149,2127,2127,2128,2131,2155,2174,2166,2143,2119,2107,2111,2118,2125,2133,2138,2140,2137,2130,2130,2131,2124,2115,2110,2099,2094,2109,2128,2133,2122,2112,2116,2128,2127,2109,2093,2089,2098,2111,2116,2112,2107,2104,2110,2117,2111,2099,2087,2072,2065,2074,2083,2080,2073,2067,2065,2066,2065,2064,2062,2055,2058,2072,2076,2074,2077,2076,2066,2047,2025,2016,2022,2037,2055,2067,2064,2050,2029,2013,2008,2009,2015,2026,2027,2013,2005,2014,2026,2027,2020,2015,2004,1990,1981,1985,2003,2015,2012,2015,2021,2009,1987,1973,1975,1993,2006,2002,1994,1983,1981,2002,2018,2005,1987,1979,1972,1968,1967,1968,1979,1993,1999,1993,1977,1957,1941,1932,1940,1967,1999,2026,2032,2012,1987,1967,1950,1948,1962,1982,1995,1992,1989,1999,2012,2031,2047,2034,2006,1984,1965,1960,1973,1982,1983,1989,2001,2012,2016,2015,2009,2000,2000,2012,2018,2006,1992,1993,2000,1998,2000,2017,2034,2032,2004,1982,2001,2032,2046,2050,2043,2028,2022,2021,2017,2013,2010,2012,2016,2017,2026,2037,2042,2044,2049,2056,2053,2031,2010,2006,2019,2038,2041,2034,2036,2036,2029,2031,2042,2051,2048,2038,2039,2052,2061,2066,2073,2074,2065,2055,2055,2064,2074,2088,2095,2088,2076,2065,2060,2064,2066,2070,2081,2082,2074,2072,2075,2081,2084,2079,2077,2080,2084,2091,2084,2070,2067,2070,2070,2071,2075,2078,2079,2085,2092,2090,2085,2090,2091,2088,2084,2084,2094,2104,2099,2095,2092,2084,2086,2093,2096,2101,2095,2074,2063,2065,2072,2086,2094,2092,2090,2092,2095,2091,2076,2075,2089,2088,2076,2072,2072,2064,2053,2052,2063,2072,2084,2093,2089,2085,2082,2072,2074,2084,2086,2090,2089,2069,2054,2055,2062,2079,2089,2080,2069,2058,2054,2068,2086,2095,2096,2086,2077,2075,2067,2058,2065,2078,2080,2073,2063,2054,2046,2041,2043,2058,2076,2081,2076,2068,2064,2070,2082,2080,2071,2068,2062,2054,2055,2063,2062,2058,2060,2059,2058,2060,2058,2055,2061,2067,2067,2068,2068,2064,2061,2066,2072,2065,2042,2029,2038,2054,2062,2066,2071,2069,2058,2052,2054,2048,2033,2029,2040,2052,2053,2054,2059,2064,2064,2047,2025,2034,2065,2079,2066,2051,2047,2052,2058,2064,2065,2058,2057,2077,2102,2089,2057,2059,2068,2051,2051,2071,2073,2065,2066,2072,2082,2086,2089,2094,2086,2079,2083,2090,2116,2126,2092,2074,2091,2096,2100,2116,2116,2108,2111,2117,2113,2097,2086,2086,2095,2116,2130,2120,2109,2111,2118,2124,2122,2115,2117,2129,2138,2131,2123,2128,2132,2127,2128,2136,2144,2142,2138,2144,2145,2128,2121,2138,2154,2148,2142,2153,2157,2143,2129,2124,2129,2142,2148,2152,2161,2164,2161,2158,2149,2140,2141,2146,2156,2169,2179,2181,2171,2158,2152,2148,2149,2149,2141,2144,2156,2153,2147,2155,2158,2147,2134,2129,2131,2132,2131,2136,2147,2155,2152,2136,2129,2139,2148,2149,2149,2144,2133,2129,2127,2114,2108,2121,2140,2154,2154,2139,2125,2117,2116,2133,2145,2133,2122,2133,2140,2122,2105,2107,2108,2105,2107,2111,2122,2137,2121,2091,2093,2106,2092,2079,2097,2123,2119,2097,2097,2104,2090,2071,2061,2060,2078,2096,2087,2071,2061,2054,2056,2058,2044,2042,2059,2065,2057,2058,2062,2060,2057,2050,2045,2053,2065,2065,2051,2041,2037,2024,2015,2026,2035,2036,2046,2052,2045,2040,2040,2043,2043,2043,2047,2044,2033,2032,2041,2040,2030,2025,2025,2026,2027,2027,2026,2015,1998,1990,1989,1982,1974,1977,1982,1979,1972,1968,1964,1953,1932,1922,1936,1956,1954,1942,1938,1944,1954,1957,1947,1948,1957,1958,1973,1994,1987,1973,1974,1971,1965,1966,1974,1990,1992,1978,1975,1978,1979,1989,1990,1982,1983,1990,1998,1998,1983,1966,1965,1972,1971,1965,1967,1969,1957,1946,1944,1944,1946,1947,1946,1953,1955,1949,1942,1938,1940,1945,1939,1937,1947,1949,1944,1946,1945,1930,1913,1916,1937,1953,1962,1965,1955,1939,1933,1936,1936,1930,1928,1934,1936,1929,1921,1917,1922,1929,1926,1922,1929,1940,1949,1955,1948,1924,1903,1904,1912,1917,1926,1939,1941,1933,1923,1916,1919,1927,1936,1946,1951,1947,1941,1943,1944,1942,1948,1952,1950,1952,1956,1956,1958,1962,1963,1963,1959,1955,1957,1960,1962,1963,1968,1973,1972,1967,1961,1959,1968,1974,1968,1966,1973,1977,1972,1967,1975,1987,1978,1965,1972,1979,1975,1971,1969,1973,1976,1966,1960,1970,1985,1993,1993,1993,1998,1997,1987,1976,1972,1977,1988,1989,1985,1985,1987,1983,1976,1969,1964,1962,1964,1965,1965,1960,1948,1939,1939,1939,1936,1936,1937,1935,1935,1941,1948,1950,1952,1957,1960,1962,1961,1957,1954,1954,1955,1957,1961,1964,1967,1969,1967,1964,1964,1964,1960,1958,1964,1972,1973,1969,1969,1979,1988,1984,1973,1964,1957,1958,1968,1980,1993,2005,2001,1980,1957,1948,1963,1986,1998,2003,2002,1996,1989,1996,2020,2032,2014,2007,2028,2037,2024,2020,2032,2050,2058,2044,2027,2022,2024,2038,2050,2039,2025,2023,2021,2023,2030,2034,2036,2035,2031,2042,2062,2060,2040,2030,2034,2037,2028,2015,2011,2020,2032,2036,2038,2043,2042,2036,2037,2038,2036,2039,2044,2045,2045,2048,2044,2033,2025,2027,2037,2046,2052,2053,2048,2042,2039,2048,2066,2068,2055,2055,2062,2058,2056,2061,2059,2050,2046,2051,2057,2060,2064,2065,2055,2051,2062,2066,2059,2057,2061,2064,2062,2057,2050,2041,2037,2044,2048,2051,2056,2046,2026,2028,2047,2058,2061,2057,2044,2039,2044,2046,2046,2052,2055,2051,2051,2063,2072,2069,2063,2064,2067,2072,2076,2076,2071,2068,2071,2076,2079,2080,2082,2083,2078,2074,2078,2086,2089,2091,2093,2087,2080,2082,2087,2091,2092,2091,2091,2092,2087,2078,2079,2092,2102,2099,2092,2089,2089,2094,2103,2109,2107,2100,2088,2078,2076,2088,2096,2091,2088,2093,2092,2092,2101,2104,2098,2101,2103,2092,2086,2095,2104,2101,2096,2095,2094,2089,2085,2083,2083,2086,2085,2088,2096,2093,2085,2088,2090,2084,2078,2077,2081,2083,2080,2086,2089,2073,2065,2080,2091,2100,2114,2113,2097,2089,2089,2081,2070,2078,2094,2094,2087,2086,2085,2086,2092,2098,2104,2100,2097,2114,2128,2106,2080,2091,2131,2155,2129,2072,2035,2052,2128,2210,2221,2143,2034,1971,2005,2113,2223,2269,2222,2110,2010,1966,1977,2038,2129,2201,2224,2198,2138,2075,2035,2026,2043,2066,2080,2100,2130,2153,2163,2164,2150,2125,2103,2092,2092,2104,2119,2121,2104,2095,2104,2110,2111,2125,2137,2133,2132,2130,2111,2095,2102,2112,2106,2105,2130,2157,2150,2124,2111,2111,2113,2121,2128,2124,2121,2129,2126,2116,2117,2124,2121,2117,2113,2113,2123,2126,2115,2115,2124,2118,2107,2104,2103,2105,2108,2108,2105,2102,2100,2106,2110,2112,2121,2130,2127,2128,2130,2114,2104,2118,2125,2119,2119,2118,2111,2108,2106,2100,2100,2103,2107,2110,2105,2095,2097,2108,2106,2091,2087,2094,2096,2090,2089,2095,2100,2099,2105,2115,2108,2104,2114,2112,2099,2095,2088,2087,2101,2112,2108,2093,2083,2095,2108,2104,2110,2117,2092,2080,2101,2107,2098,2087,2066,2053,2068,2094,2121,2117,2074,2064,2102,2107,2078,2079,2100,2092,2069,2077,2108,2111,2095,2103,2113,2114,2115,2090,2060,2063,2071,2078,2097,2099,2088,2088,2079,2063,2061,2069,2082,2078,2049,2041,2050,2055,2072,2074,2055,2065,2072,2064,2100,2121,2074,2048,2066,2068,2071,2077,2046,2032,2061,2063,2039,2043,2046,2049,2085,2094,2065,2070,2079,2056,2057,2078,2072,2057,2043,2021,2005,2021,2082,2121,2082,2042,2053,2062,2051,2035,2024,2028,2039,2047,2040,2002,1983,2028,2093,2104,2025,1977,2047,2050,1964,1999,2042,2029,2155,2193,1929,1783,1973,2203,2211,1979,1906,2239,2378,2027,1800,1896,1930,1870,1908,2088,2312,2395,2362,2378,2333,2084,1824,1748,1748,1720,1734,1762,1782,1964,2195,2192,2184,2370,2439,2292,2169,2119,2032,1837,1659,1711,1844,1863,1958,2194,2391,2499,2482,2374,2304,2222,2106,2063,2004,1873,1809,1831,1898,2001,2060,2092,2199,2351,2497,2640,2755,2801,2725,2515,2257,2010,1757,1520,1377,1360,1376,1311,1187,1130,1189,1281,1322,1344,1397,1470,1572,1713,1865,2025,2185,2306,2406,2514,2607,2680,2745,2804,2824,2790,2776,2810,2796,2744,2761,2821,2833,2800,2773,2769,2721,2596,2530,2609,2700,2690,2613,2511,2390,2244,2062,1848,1665,1570,1510,1416,1330,1284,1220,1136,1094,1096,1097,1073,1041,1018,980,907,841,836,874,908,952,1049,1191,1341,1474,1584,1696,1835,1973,2081,2183,2296,2381,2404,2405,2462,2590,2756,2974,3250,3499,3657,3740,3767,3720,3608,3470,3325,3162,2999,2882,2808,2730,2643,2577,2528,2484,2456,2445,2430,2392,2328,2225,2072,1887,1721,1609,1548,1529,1533,1535,1539,1559,1574,1581,1597,1588,1538,1496,1460,1394,1351,1373,1398,1387,1375,1385,1424,1478,1501,1489,1476,1462,1428,1388,1363,1346,1314,1293,1314,1323,1303,1342,1414,1390,1321,1332,1375,1378,1384,1405,1403,1387,1372,1345,1334,1358,1377,1396,1464,1555,1620,1698,1820,1923,1970,2005,2048,2099,2167,2231,2275,2325,2384,2445,2518,2580,2640,2732,2793,2785,2809,2874,2897,2902,2924,2937,2963,3007,3027,3033,3034,3001,2972,2987,3007,3020,3045,3044,3001,2968,2970,2958,2903,2842,2808,2786,2767,2766,2771,2749,2695,2632,2584,2524,2438,2370,2318,2229,2130,2061,1994,1918,1839,1748,1656,1572,1499,1456,1414,1341,1274,1244,1225,1195,1166,1158,1162,1151,1143,1155,1166,1178,1187,1177,1157,1149,1168,1213,1229,1214,1227,1242,1252,1312,1376,1384,1382,1392,1418,1478,1527,1534,1531,1535,1567,1629,1672,1696,1718,1732,1761,1809,1838,1863,1904,1942,1977,2001,2010,2036,2072,2088,2094,2103,2128,2164,2179,2172,2166,2166,2181,2207,2211,2203,2205,2217,2230,2234,2233,2241,2238,2221,2226,2240,2235,2227,2233,2247,2256,2244,2225,2219,2220,2224,2223,2206,2188,2188,2191,2181,2168,2170,2174,2162,2153,2159,2162,2171,2183,2174,2161,2151,2124,2108,2116,2115,2114,2122,2110,2094,2099,2114,2128,2125,2109,2114,2123,2108,2106,2123,2118,2105,2110,2114,2114,2122,2130,2141,2164,2188,2202,2207,2215,2235,2261,2284,2307,2324,2335,2360,2377,2365,2373,2422,2451,2451,2464,2483,2494,2516,2536,2544,2556,2565,2576,2590,2570,2542,2569,2596,2574,2567,2577,2568,2568,2563,2520,2493,2505,2503,2464,2410,2381,2378,2346,2300,2297,2289,2246,2229,2222,2177,2119,2078,2056,2050,2027,1980,1929,1886,1870,1865,1830,1786,1766,1743,1713,1684,1646,1613,1590,1560,1532,1506,1480,1469,1446,1407,1401,1407,1377,1340,1327,1329,1331,1311,1283,1293,1312,1294,1269,1255,1246,1254,1260,1234,1206,1215,1238,1246,1236,1227,1250,1293,1290,1263,1272,1286,1293,1319,1327,1329,1375,1398,1384,1431,1492,1483,1479,1525,1569,1578,1552,1549,1595,1617,1621,1661,1690,1685,1702,1742,1767,1770,1773,1800,1823,1833,1878,1915,1906,1926,1980,1995,1998,2014,2023,2042,2066,2075,2092,2117,2124,2143,2201,2236,2206,2200,2269,2308,2301,2360,2438,2402,2330,2358,2442,2454,2404,2417,2491,2495,2458,2482,2524,2544,2566,2560,2545,2586,2630,2620,2617,2658,2699,2720,2729,2722,2710,2717,2722,2700,2704,2746,2733,2682,2714,2806,2855,2863,2843,2807,2808,2834,2808,2752,2752,2801,2801,2739,2707,2736,2780,2816,2831,2826,2832,2818,2762,2748,2773,2739,2672,2655,2685,2696,2646,2592,2615,2684,2729,2729,2702,2709,2733,2679,2585,2535,2493,2459,2486,2521,2509,2499,2523,2503,2407,2363,2421,2439,2388,2353,2314,2270,2249,2214,2188,2213,2230,2230,2230,2195,2164,2151,2109,2075,2067,2035,1994,1959,1930,1937,1935,1890,1868,1871,1869,1885,1903,1896,1869,1819,1780,1782,1759,1694,1663,1668,1643,1587,1571,1590,1558,1491,1475,1493,1499,1491,1470,1458,1446,1400,1376,1400,1394,1367,1391,1417,1385,1338,1305,1270,1250,1285,1362,1410,1415,1447,1519,1542,1517,1533,1573,1573,1554,1525,1469,1413,1358,1298,1285,1317,1341,1363,1386,1394,1401,1405,1408,1436,1466,1473,1486,1502,1497,1499,1526,1546,1541,1544,1574,1607,1655,1728,1759,1729,1715,1727,1724,1709,1710,1748,1806,1824,1801,1795,1801,1794,1803,1843,1881,1903,1919,1925,1933,1958,1963,1944,1968,2021,2029,2014,2002,1984,1990,2016,2009,1996,2039,2100,2121,2112,2105,2115,2138,2141,2119,2118,2135,2132,2127,2131,2104,2077,2086,2091,2083,2082,2083,2094,2107,2106,2121,2161,2198,2232,2259,2281,2292,2274,2255,2269,2285,2294,2313,2333,2341,2336,2340,2371,2401,2436,2498,2529,2534,2560,2551,2524,2555,2589,2594,2603,2603,2625,2681,2696,2703,2747,2762,2756,2773,2781,2766,2735,2722,2749,2758,2764,2815,2834,2822,2869,2914,2920,2938,2929,2887,2885,2902,2899,2884,2862,2855,2855,2851,2851,2831,2811,2832,2820,2773,2778,2791,2781,2796,2772,2708,2710,2727,2694,2687,2719,2736,2742,2742,2730,2709,2685,2670,2651,2613,2585,2566,2541,2525,2499,2466,2479,2499,2461,2413,2393,2389,2384,2357,2339,2362,2362,2321,2303,2282,2234,2203,2188,2181,2191,2189,2179,2166,2118,2072,2069,2051,2012,1997,1985,1950,1902,1865,1853,1836,1798,1765,1748,1758,1767,1723,1677,1677,1658,1613,1584,1551,1525,1526,1521,1513,1504,1479,1460,1439,1422,1453,1467,1429,1443,1477,1433,1404,1445,1448,1395,1358,1362,1387,1404,1399,1401,1428,1449,1443,1438,1459,1485,1492,1491,1497,1506,1506,1514,1540,1546,1525,1538,1581,1603,1602,1610,1617,1602,1594,1631,1662,1654,1660,1678,1680,1687,1692,1697,1720,1724,1713,1738,1758,1746,1739,1740,1760,1786,1774,1756,1748,1739,1779,1813,1770,1788,1885,1887,1817,1796,1807,1838,1879,1866,1809,1785,1796,1798,1794,1812,1826,1803,1784,1788,1782,1791,1877,1982,1966,1865,1863,1946,1969,1963,1965,1921,1905,1980,2050,2067,2037,1966,1955,2037,2063,1970,1885,1900,1949,1970,1997,2011,1969,1961,2040,2082,2039,2010,2032,2052,2048,2020,1984,1993,2049,2062,2024,2026,2059,2038,1974,1962,2039,2075,1987,1957,2059,2086,2011,1978,1949,1914,1935,1952,1960,2023,2059,2022,2025,2091,2107,2044,1993,1992,2030,2093,2091,2013,2016,2070,2038,2030,2092,2065,2011,2057,2085,2047,2049,2069,2015,1969,2049,2127,2065,2022,2075,2071,2030,2062,2102,2078,2010,1965,1988,2008,1999,2003,1981,1969,2023,2064,2092,2097,2028,2058,2195,2188,2142,2202,2162,2073,2134,2217,2192,2107,2057,2108,2129,2068,2083,2108,2048,2057,2100,2084,2128,2202,2200,2199,2237,2265,2249,2198,2219,2276,2200,2103,2129,2149,2135,2198,2268,2262,2255,2291,2331,2346,2352,2373,2394,2383,2347,2337,2347,2305,2252,2287,2344,2354,2375,2393,2400,2453,2479,2403,2354,2411,2446,2371,2311,2377,2427,2359,2316,2338,2328,2342,2395,2377,2341,2373,2396,2388,2414,2433,2391,2344,2342,2356,2371,2392,2387,2357,2346,2352,2359,2360,2338,2342,2388,2371,2317,2331,2315,2237,2233,2259,2236,2270,2325,2290,2252,2249,2252,2319,2367,2317,2303,2301,2252,2320,2391,2247,2124,2145,2121,2149,2270,2252,2171,2189,2173,2123,2132,2134,2098,2064,2061,2100,2140,2188,2191,2022,1932,2127,2185,1948,1833,1878,1865,1892,2008,2067,1963,1788,1814,2020,2060,1972,1981,1980,1910,1869,1848,1811,1739,1672,1723,1789,1776,1839,1905,1804,1781,1904,1841,1658,1677,1769,1715,1625,1608,1652,1780,1908,1895,1818,1777,1681,1538,1530,1666,1704,1538,1423,1539,1635,1589,1604,1615,1472,1372,1387,1374,1341,1296,1291,1502,1746,1736,1682,1771,1818,1788,1727,1498,1187,1078,1137,1178,1230,1348,1437,1440,1457,1569,1639,1562,1524,1610,1641,1627,1649,1592,1485,1412,1304,1275,1394,1423,1342,1330,1430,1586,1530,1230,1202,1431,1416,1371,1567,1700,1747,1816,1749,1588,1446,1382,1508,1624,1600,1652,1650,1573,1808,2038,1814,1635,1832,2035,2086,2085,2085,2063,1925,1807,1820,1670,1366,1341,1584,1784,1935,2084,2116,2045,2086,2265,2332,2318,2417,2438,2266,2139,2020,1764,1571,1519,1484,1519,1690,1913,2121,2318,2550,2770,2862,2871,2880,2835,2775,2776,2754,2638,2432,2147,1872,1654,1452,1332,1320,1322,1383,1566,1752,1924,2168,2390,2493,2551,2631,2723,2807,2896,3050,3242,3395,3528,3656,3711,3686,3643,3607,3524,3346,3181,3112,3029,2906,2820,2715,2578,2475,2362,2272,2250,2169,2069,2088,2079,1960,1884,1849,1781,1726,1664,1581,1535,1505,1456,1423,1426,1468,1534,1582,1622,1683,1739,1776,1834,1941,2060,2156,2246,2342,2432,2523,2614,2691,2746,2799,2874,2937,2966,3003,3022,2992,3036,3175,3237,3214,3240,3311,3358,3372,3381,3407,3430,3436,3440,3405,3322,3255,3204,3116,2997,2882,2779,2697,2632,2551,2434,2308,2195,2102,2056,2023,1939,1849,1783,1700,1629,1577,1504,1444,1391,1305,1249,1225,1193,1199,1204,1158,1151,1179,1161,1119,1066,1014,996,969,946,959,923,878,927,976,989,1057,1130,1145,1149,1168,1200,1258,1350,1467,1563,1639,1734,1819,1879,1957,2053,2131,2161,2168,2230,2309,2329,2366,2447,2470,2433,2395,2388,2421,2425,2379,2362,2355,2317,2288,2267,2247,2245,2224,2205,2247,2276,2240,2214,2231,2239,2223,2230,2283,2316,2301,2291,2306,2317,2301,2250,2215,2215,2194,2160,2160,2168,2149,2106,2078,2100,2112,2081,2076,2108,2129,2119,2061,1995,1988,1991,1966,1951,1944,1948,1962,1936,1906,1932,1942,1904,1893,1917,1938,1939,1920,1923,1951,1949,1945,1980,1983,1946,1964,2011,1998,1964,1962,1955,1938,1937,1937,1946,1966,1959,1946,1965,1978,1967,1964,1948,1935,1980,2029,2016,1995,1998,1984,1956,1961,1990,2005,2011,2021,2020,1999,1983,1997,2021,2021,2008,2007,2007,2000,2017,2063,2073,2022,1985,2007,2034,2026,1997,1966,1960,1994,2021,2004,1980,1997,2033,2025,1987,1990,2019,2008,1990,2011,2031,2033,2048,2057,2026,2001,2030,2056,2021,1993,2017,2033,2027,2046,2077,2077,2054,2053,2066,2043,2010,2026,2050,2061,2098,2127,2115,2117,2137,2138,2133,2137,2162,2212,2258,2279,2262,2239,2283,2352,2359,2365,2405,2410,2401,2422,2436,2444,2487,2544,2575,2574,2581,2619,2643,2662,2718,2753,2727,2719,2762,2812,2832,2812,2793,2804,2805,2799,2828,2853,2850,2859,2871,2868,2875,2873,2847,2849,2884,2886,2854,2838,2840,2835,2815,2792,2785,2786,2779,2778,2769,2711,2640,2622,2635,2626,2590,2544,2501,2489,2495,2457,2385,2355,2345,2287,2234,2238,2230,2177,2139,2126,2099,2050,2001,1969,1938,1895,1859,1827,1774,1736,1746,1738,1664,1607,1613,1592,1513,1482,1498,1471,1425,1403,1370,1332,1317,1290,1244,1213,1199,1190,1184,1158,1112,1097,1130,1129,1054,1004,1030,1050,1038,1028,1011,1000,1009,983,944,958,974,956,962,983,981,963,939,926,940,944,942,967,977,960,962,991,1026,1051,1059,1057,1058,1077,1119,1131,1115,1146,1198,1208,1237,1298,1301,1282,1340,1419,1424,1399,1429,1492,1535,1557,1573,1588,1628,1687,1727,1740,1745,1765,1809,1846,1877,1935,1973,1958,1975,2050,2106,2127,2154,2211,2277,2294,2281,2311,2354,2363,2393,2460,2501,2510,2532,2572,2596,2608,2645,2686,2692,2706,2747,2750,2731,2755,2795,2829,2863,2872,2882,2916,2930,2948,3001,3028,3028,3043,3035,3020,3040,3039,3018,3048,3089,3094,3088,3083,3100,3128,3108,3085,3102,3090,3050,3052,3058,3046,3056,3065,3055,3057,3053,3033,3036,3046,3027,3013,3009,2996,3005,3013,2970,2941,2970,2967,2909,2864,2851,2854,2840,2797,2786,2801,2760,2696,2673,2654,2613,2573,2549,2555,2558,2501,2433,2418,2418,2384,2341,2326,2332,2312,2261,2231,2223,2175,2103,2089,2106,2071,2000,1953,1926,1910,1897,1872,1847,1818,1779,1770,1772,1723,1671,1660,1636,1588,1547,1506,1461,1430,1426,1448,1440,1371,1331,1348,1332,1281,1251,1213,1167,1167,1176,1143,1120,1125,1119,1092,1054,1032,1040,1023,973,948,941,922,907,882,849,840,837,829,842,849,827,803,793,799,801,795,811,844,841,819,830,872,893,870,862,901,923,913,912,920,934,939,915,924,980,996,982,999,1018,1029,1067,1111,1139,1159,1170,1175,1182,1192,1203,1217,1228,1243,1282,1334,1356,1363,1389,1404,1412,1463,1512,1519,1541,1579,1582,1595,1649,1680,1678,1687,1702,1720,1762,1798,1809,1839,1880,1900,1931,1966,1972,1993,2049,2103,2159,2195,2183,2192,2240,2260,2264,2296,2332,2355,2381,2410,2435,2441,2430,2437,2479,2530,2563,2589,2620,2636,2635,2631,2639,2684,2732,2742,2767,2811,2805,2791,2836,2879,2877,2868,2880,2919,2955,2958,2970,3001,3013,3026,3061,3068,3042,3049,3105,3142,3138,3146,3178,3181,3151,3150,3199,3213,3167,3164,3215,3225,3213,3223,3214,3209,3238,3245,3235,3238,3226,3210,3201,3184,3191,3211,3191,3162,3152,3134,3124,3122,3103,3097,3098,3065,3044,3062,3040,2983,2983,3001,2955,2920,2950,2954,2900,2871,2879,2860,2815,2804,2813,2787,2762,2776,2769,2721,2677,2635,2612,2623,2617,2574,2530,2499,2490,2486,2467,2450,2411,2344,2338,2364,2321,2271,2274,2268,2236,2202,2170,2166,2166,2119,2063,2042,2040,2035,2007,1961,1940,1933,1901,1873,1860,1819,1787,1804,1796,1734,1693,1689,1698,1705,1667,1622,1631,1609,1535,1518,1532,1509,1498,1493,1457,1431,1423,1411,1406,1400,1377,1354,1348,1342,1308,1275,1293,1316,1289,1244,1216,1211,1214,1197,1171,1150,1123,1125,1149,1129,1098,1092,1066,1058,1097,1094,1052,1054,1074,1069,1063,1058,1056,1071,1075,1067,1088,1096,1059,1048,1070,1060,1043,1059,1079,1078,1045,1023,1058,1086,1083,1121,1154,1142,1160,1186,1199,1243,1236,1205,1302,1339,1181,1158,1336,1362,1234,1205,1263,1324,1376,1368,1362,1466,1531,1420,1365,1540,1705,1625,1428,1379,1523,1651,1609,1495,1463,1526,1586,1583,1614,1723,1748,1690,1766,1931,1974,1926,1899,1896,1939,1979,1896,1783,1838,1963,1927,1778,1740,1887,2077,2104,2001,2038,2223,2286,2227,2243,2323,2378,2383,2306,2216,2237,2302,2271,2196,2206,2250,2234,2228,2279,2312,2334,2372,2377,2395,2486,2549,2531,2508,2487,2442,2428,2464,2496,2507,2521,2523,2512,2543,2618,2669,2689,2714,2746,2783,2803,2786,2761,2763,2773,2757,2730,2728,2743,2748,2757,2773,2797,2838,2853,2842,2868,2901,2879,2857,2872,2869,2820,2752,2713,2703,2665,2612,2590,2583,2581,2593,2604,2618,2636,2637,2648,2683,2712,2719,2707,2703,2715,2693,2648,2643,2645,2624,2621,2618,2583,2568,2604,2642,2640,2633,2660,2696,2696,2680,2687,2704,2700,2684,2683,2683,2670,2649,2613,2577,2576,2579,2553,2527,2513,2498,2485,2485,2495,2493,2479,2471,2450,2417,2432,2479,2470,2415,2384,2379,2364,2333,2306,2285,2273,2277,2259,2214,2205,2201,2138,2088,2098,2102,2093,2095,2084,2066,2072,2072,2043,2025,2039,2041,2006,1980,1974,1945,1903,1892,1900,1894,1877,1871,1869,1858,1856,1865,1862,1849,1841,1842,1845,1823,1787,1785,1805,1797,1769,1744,1734,1731,1724,1722,1720,1719,1734,1726,1680,1671,1697,1689,1678,1693,1704,1703,1686,1659,1650,1638,1633,1666,1688,1686,1700,1697,1681,1696,1685,1645,1673,1727,1708,1667,1680,1719,1729,1709,1708,1736,1744,1733,1759,1804,1795,1761,1783,1836,1848,1840,1849,1842,1800,1780,1809,1832,1829,1842,1846,1820,1816,1838,1860,1888,1898,1894,1927,1967,1970,1958,1952,1961,1968,1937,1932,1994,2009,1962,1957,1969,1969,2002,2023,1995,1988,2015,2030,2043,2058,2056,2057,2074,2076,2056,2047,2050,2042,2028,2024,2024,2027,2040,2055,2044,2018,2017,2034,2037,2028,2015,2016,2041,2043,2014,2012,2023,2000,1982,1983,1979,1983,1988,1977,1985,2004,1988,1960,1962,1983,1992,1973,1950,1960,1979,1970,1949,1942,1950,1967,1965,1937,1931,1962,1968,1940,1940,1962,1964,1962,1977,1985,1981,1984,1995,2005,2016,2016,1994,1988,2020,2029,2010,2022,2046,2037,2032,2045,2055,2065,2067,2064,2073,2083,2086,2095,2103,2107,2113,2115,2123,2134,2129,2124,2123,2111,2115,2145,2163,2157,2153,2161,2167,2163,2163,2169,2164,2155,2153,2154,2158,2158,2145,2131,2141,2159,2146,2121,2145,2183,2169,2140,2143,2153,2154,2146,2132,2134,2135,2109,2097,2106,2100,2089,2070,2045,2056,2074,2055,2048,2065,2051,2018,2014,2025,2015,1981,1962,1970,1971,1967,1971,1967,1954,1936,1920,1930,1946,1924,1903,1918,1923,1907,1907,1918,1916,1904,1895,1894,1898,1897,1891,1890,1902,1907,1890,1885,1906,1895,1874,1907,1932,1894,1889,1937,1944,1919,1921,1920,1902,1918,1963,1970,1938,1938,1966,1957,1926,1935,1968,1979,1973,1979,2000,2005,1986,1981,1995,2001,2007,2023,2023,2011,2018,2034,2032,2023,2030,2044,2050,2059,2070,2063,2051,2052,2054,2053,2067,2084,2082,2078,2093,2105,2095,2087,2086,2082,2083,2084,2085,2098,2106,2095,2091,2100,2106,2109,2101,2087,2093,2102,2092,2086,2093,2088,2068,2062,2085,2102,2087,2080,2094,2084,2072,2089,2088,2070,2084,2094,2071,2061,2076,2079,2070,2061,2063,2075,2073,2062,2066,2065,2050,2048,2048,2036,2038,2056,2061,2057,2056,2058,2057,2044,2032,2036,2038,2030,2035,2049,2047,2040,2036,2031,2040,2055,2050,2039,2038,2043,2048,2043,2027,2030,2051,2053,2048,2051,2045,2031,2030,2041,2053,2050,2031,2034,2064,2064,2037,2034,2051,2053,2043,2034,2033,2041,2042,2037,2048,2070,2076,2064,2050,2045,2049,2049,2051,2061,2054,2036,2046,2062,2056,2049,2041,2029,2039,2061,2063,2052,2038,2030,2034,2031,2026,2040,2049,2036,2030,2032,2033,2035,2038,2042,2034,2016,2021,2034,2017,2009,2022,2007,1994,2014,2017,2008,2025,2032,2015,2004,2001,2003,2013,2021,2026,2021,2008,2011,2022,2020,2013,2014,2024,2027,2022,2024,2026,2022,2021,2019,2026,2052,2055,2031,2029,2039,2027,2017,2023,2037,2040,2022,2013,2018,2008,2006,2027,2036,2030,2022,2013,2022,2041,2036,2020,2018,2024,2026,2023,2024,2027,2017,2002,2010,2035,2044,2038,2034,2023,2012,2019,2026,2024,2025,2017,2008,2014,2016,2014,2028,2036,2031,2032,2032,2037,2038,2018,2008,2026,2037,2033,2024,2007,1997,2003,2009,2015,2019,1998,1972,1986,2019,2022,1999,1979,1973,1985,2001,1997,1983,1967,1952,1949,1954,1952,1948,1942,1934,1933,1927,1924,1939,1942,1934,1950,1963,1936,1915,1927,1933,1920,1912,1906,1906,1924,1933,1914,1900,1903,1895,1881,1890,1911,1908,1896,1904,1909,1897,1893,1898,1905,1913,1897,1878,1900,1917,1897,1888,1897,1893,1886,1893,1898,1890,1885,1894,1886,1868,1879,1885,1861,1864,1900,1898,1860,1848,1873,1886,1874,1873,1895,1907,1889,1869,1877,1895,1901,1900,1891,1890,1911,1920,1902,1895,1891,1882,1896,1925,1926,1910,1912,1922,1913,1904,1914,1923,1928,1938,1933,1922,1928,1942,1951,1949,1939,1961,1994,1988,1980,1995,1994,1985,1983,1981,1991,2007,2007,2005,2012,2021,2029,2026,2022,2030,2036,2030,2032,2048,2065,2066,2051,2041,2044,2058,2084,2098,2089,2091,2107,2117,2127,2126,2112,2129,2164,2162,2156,2171,2174,2179,2196,2195,2188,2203,2235,2251,2228,2217,2252,2259,2230,2228,2236,2250,2295,2302,2266,2270,2295,2286,2264,2267,2297,2314,2310,2317,2323,2311,2314,2335,2341,2333,2333,2350,2359,2357,2360,2349,2334,2348,2355,2346,2354,2357,2363,2388,2386,2375,2396,2404,2395,2395,2381,2368,2373,2373,2385,2397,2366,2338,2351,2373,2388,2395,2382,2357,2349,2370,2386,2367,2347,2360,2387,2392,2363,2343,2359,2367,2347,2332,2336,2350,2365,2365,2347,2328,2318,2316,2322,2331,2329,2316,2315,2319,2315,2318,2318,2308,2307,2301,2290,2305,2308,2283,2290,2299,2264,2241,2244,2238,2254,2273,2234,2201,2221,2220,2186,2187,2204,2193,2185,2188,2173,2158,2165,2159,2134,2128,2139,2134,2112,2099,2101,2102,2088,2077,2086,2096,2082,2051,2031,2033,2042,2039,2027,2017,2013,2008,2004,2006,1992,1956,1946,1963,1952,1927,1919,1919,1931,1936,1898,1871,1903,1916,1872,1848,1872,1871,1840,1848,1864,1831,1808,1827,1824,1809,1819,1815,1793,1801,1818,1796,1756,1743,1756,1771,1789,1794,1770,1757,1780,1787,1754,1737,1754,1765,1762,1774,1780,1754,1739,1754,1746,1731,1752,1772,1770,1775,1777,1759,1749,1770,1796,1794,1773,1773,1794,1803,1797,1792,1797,1813,1822,1820,1821,1824,1826,1835,1842,1839,1839,1846,1861,1869,1858,1861,1889,1900,1904,1915,1896,1874,1904,1934,1929,1938,1953,1954,1961,1966,1955,1950,1955,1969,1992,2004,2008,2023,2027,2012,2014,2028,2024,2024,2043,2049,2051,2063,2060,2059,2084,2097,2092,2102,2121,2135,2142,2137,2140,2161,2168,2163,2164,2170,2187,2209,2211,2204,2213,2229,2234,2223,2213,2226,2242,2233,2230,2249,2255,2259,2272,2265,2253,2271,2281,2268,2274,2284,2281,2296,2310,2296,2303,2331,2326,2311,2328,2338,2329,2319,2300,2302,2336,2337,2311,2326,2350,2337,2315,2301,2307,2330,2328,2333,2370,2359,2320,2344,2360,2322,2324,2356,2330,2304,2329,2339,2321,2318,2309,2292,2300,2303,2283,2286,2313,2323,2309,2287,2280,2283,2271,2274,2296,2290,2272,2279,2280,2260,2244,2237,2234,2230,2226,2229,2229,2229,2232,2212,2189,2206,2215,2184,2181,2221,2215,2172,2184,2212,2185,2164,2166,2143,2129,2159,2172,2147,2134,2144,2140,2122,2133,2146,2123,2118,2137,2123,2104,2113,2117,2112,2109,2104,2104,2092,2075,2083,2085,2062,2045,2040,2046,2061,2057,2032,2016,2027,2044,2025,2003,2022,2024,1993,1995,2011,1988,1967,1992,2015,1993,1989,2022,2000,1957,1991,2011,1956,1950,1986,1967,1942,1962,1982,1974,1956,1956,1970,1960,1944,1957,1974,1968,1958,1952,1955,1961,1948,1918,1911,1935,1950,1929,1904,1910,1914,1899,1897,1898,1880,1888,1915,1904,1883,1884,1875,1869,1889,1884,1862,1874,1898,1885,1851,1846,1871,1880,1860,1858,1884,1903,1893,1871,1863,1871,1881,1883,1876,1874,1880,1877,1878,1893,1886,1869,1879,1882,1860,1858,1881,1889,1884,1887,1892,1880,1871,1890,1914,1913,1891,1858,1840,1865,1894,1889,1866,1848,1853,1880,1894,1888,1881,1865,1852,1876,1901,1898,1898,1899,1890,1892,1883,1857,1878,1923,1904,1860,1879,1913,1891,1861,1871,1881,1867,1874,1907,1933,1925,1899,1900,1925,1919,1891,1893,1909,1910,1904,1904,1911,1902,1890,1917,1947,1930,1909,1910,1907,1919,1944,1930,1892,1895,1934,1953,1947,1938,1938,1948,1950,1945,1964,1984,1968,1956,1972,1983,1976,1959,1955,1977,1973,1936,1937,1968,1972,1960,1965,1979,1975,1952,1953,1983,1995,2001,2011,2001,1995,2009,2013,2009,2013,2022,2021,2011,2021,2038,2026,2019,2025,1999,1987,2026,2050,2042,2028,2011,2008,2019,2018,2015,2015,2016,2028,2029,2021,2025,2020,2015,2033,2031,2018,2044,2062,2044,2037,2041,2043,2050,2035,2011,2031,2066,2064,2051,2058,2068,2059,2051,2066,2080,2067,2057,2061,2055,2047,2054,2056,2053,2055,2054,2052,2058,2065,2065,2050,2036,2050,2060,2036,2019,2034,2057,2066,2049,2025,2029,2036,2029,2037,2047,2037,2036,2049,2039,2010,1998,2012,2027,2030,2024,2009,1999,2014,2028,2015,1997,1987,1987,2003,2019,2019,2018,2014,2000,1993,2002,2017,2024,2028,2034,2028,2020,2027,2028,2018,2022,2023,2012,2024,2042,2039,2040,2046,2044,2048,2047,2036,2034,2037,2039,2049,2056,2050,2040,2034,2044,2061,2050,2030,2033,2045,2053,2059,2049,2033,2034,2031,2026,2056,2085,2063,2030,2024,2025,2027,2042,2053,2050,2044,2044,2044,2036,2029,2031,2032,2037,2050,2055,2047,2043,2048,2050,2043,2039,2047,2055,2058,2065,2059,2032,2025,2043,2052,2048,2049,2058,2064,2063,2066,2070,2064,2058,2062,2069,2074,2067,2065,2082,2084,2066,2065,2072,2060,2059,2076,2082,2074,2071,2076,2083,2086,2080,2069,2063,2064,2065,2079,2091,2072,2055,2071,2077,2066,2070,2073,2067,2072,2070,2048,2035,2050,2073,2071,2057,2066,2081,2085,2093,2086,2057,2044,2056,2073,2089,2085,2069,2068,2071,2067,2068,2066,2054,2061,2093,2102,2068,2051,2067,2066,2066,2086,2066,2039,2076,2104,2066,2035,2047,2070,2079,2069,2062,2061,2059,2075,2091,2072,2050,2056,2069,2071,2057,2054,2077,2084,2067,2071,2084,2075,2074,2085,2078,2067,2082,2098,2082,2055,2054,2073,2079,2068,2066,2072,2076,2084,2082,2057,2054,2076,2065,2037,2052,2081,2077,2057,2049,2053,2058,2074,2098,2083,2047,2071,2109,2074,2025,2041,2091,2099,2035,1998,2061,2127,2117,2078,2037,2019,2051,2090,2108,2116,2088,2049,2074,2102,2068,2047,2076,2094,2087,2082,2083,2083,2077,2077,2087,2084,2077,2085,2082,2062,2063,2080,2092,2095,2083,2071,2082,2099,2108,2107,2099,2101,2103,2089,2094,2109,2105,2100,2099,2099,2112,2109,2085,2080,2083,2092,2120,2113,2082,2091,2116,2121,2121,2116,2113,2116,2114,2119,2125,2116,2123,2135,2117,2106,2123,2127,2114,2121,2141,2127,2092,2101,2140,2140,2111,2101,2122,2144,2133,2111,2116,2129,2129,2116,2095,2106,2140,2138,2109,2090,2083,2106,2142,2134,2106,2104,2121,2132,2124,2117,2132,2132,2107,2101,2107,2106,2121,2141,2130,2099,2093,2121,2140,2127,2107,2107,2119,2126,2116,2098,2106,2124,2114,2094,2111,2147,2149,2114,2086,2094,2109,2103,2086,2079,2086,2103,2105,2086,2085,2100,2094,2089,2106,2107,2095,2101,2106,2101,2097,2090,2088,2097,2090,2077,2094,2113,2091,2064,2069,2084,2088,2082,2073,2069,2071,2072,2068,2059,2061,2082,2087,2071,2065,2062,2072,2105,2110,2081,2066,2062,2074,2093,2074,2052,2063,2063,2067,2078,2052,2058,2108,2076,2018,2061,2117,2096,2047,2015,2022,2054,2069,2075,2077,2057,2047,2067,2089,2102,2078,2031,2042,2091,2092,2065,2057,2062,2079,2080,2046,2029,2056,2087,2097,2078,2050,2065,2096,2085,2069,2078,2078,2071,2082,2099,2097,2074,2065,2080,2082,2075,2086,2087,2075,2072,2079,2095,2105,2087,2074,2088,2094,2084,2082,2088,2086,2077,2075,2081,2082,2081,2085,2082,2081,2085,2089,2089,2080,2063,2059,2068,2084,2096,2092,2081,2061,2039,2055,2085,2072,2062,2089,2099,2078,2061,2060,2072,2072,2063,2068,2068,2065,2088,2099,2076,2057,2047,2053,2081,2079,2053,2065,2086,2076,2063,2058,2058,2082,2103,2094,2072,2047,2036,2069,2099,2076,2044,2032,2032,2065,2090,2062,2039,2061,2086,2083,2062,2064,2099,2100,2063,2058,2073,2061,2047,2054,2068,2067,2051,2046,2043,2034,2055,2086,2075,2054,2049,2047,2065,2083,2065,2057,2079,2072,2039,2032,2046,2064,2093,2101,2071,2041,2022,2015,2049,2097,2098,2059,2025,2014,2029,2053,2069,2055,2010,2012,2073,2087,2055,2054,2042,2017,2059,2102,2054,2005,2022,2040,2041,2056,2053,2020,2017,2029,2017,2027,2057,2030,1987,2013,2061,2056,2009,1981,2013,2064,2063,2018,1992,2010,2038,2041,2035,2019,1996,2009,2048,2050,2022,1996,1974,1984,2033,2072,2050,2000,2007,2055,2050,2025,2030,2010,1974,1994,2035,2030,2000,1995,2008,2004,1993,2011,2021,2006,2008,2026,2033,2030,2012,1997,2011,2026,2034,2057,2050,2005,1985,1999,2016,2032,2024,1985,1977,2011,2025,2003,1983,1992,2011,2022,2036,2033,2005,2010,2046,2050,2036,2025,1991,1962,1984,2037,2057,2003,1941,1953,2003,2028,2020,1983,1969,2004,2012,2005,2030,2015,1963,1973,2015,2010,1980,1967,1963,1961,1988,2034,2019,1951,1951,2023,2051,2021,1991,1979,1985,2011,2021,1994,1972,1979,1977,1975,1995,2005,2007,2022,2000,1964,1978,2004,2007,2016,2013,1986,1973,1980,1991,1982,1973,2012,2033,1982,1966,2002,1993,1985,2031,2050,2022,2002,1990,1988,2015,2041,2031,1994,1965,1975,2025,2048,1993,1961,2016,2028,1961,1951,2013,2050,2036,2001,1975,1983,2018,2046,2030,1992,1979,1976,1979,2005,2021,2017,2022,2015,2002,2002,2000,2016,2049,2046,2004,1984,2011,2036,2017,1997,2004,1999,2008,2042,2043,2017,2005,2004,2025,2054,2052,2039,2042,2046,2030,1995,1986,2014,2036,2030,1999,1975,2003,2025,2009,2015,2019,2001,2014,2023,2011,2037,2046,2011,2011,2017,2004,2021,2023,2010,2054,2052,1971,1982,2069,2081,2025,1979,2014,2088,2043,1968,2047,2094,2004,2000,2054,2008,1980,2026,2034,2023,2033,2024,2005,2017,2052,2067,2046,2018,2039,2084,2045,1964,1997,2076,2061,2011,1948,1921,2036,2104,1991,1957,2021,2001,2008,2056,1995,1947,2017,2072,2046,1998,1969,1979,2025,2066,2043,1977,1955,1982,2032,2076,2047,1981,1968,1989,2037,2089,2065,2022,2004,1948,1943,2028,2039,1974,1952,1948,1963,2007,2008,2005,2034,1996,1916,1942,2049,2100,2045,1958,1941,1983,2012,2026,2030,1986,1932,1957,2032,2040,1975,1943,1968,2009,2043,2021,1961,1953,1992,2013,2001,1968,1965,1999,2001,1992,1998,1977,1981,2027,1998,1931,1966,2047,2028,1934,1928,2009,2019,1986,2008,2010,1982,2008,2050,2053,2017,1980,2003,2035,2004,1990,2025,2040,2015,1978,1977,2006,2025,2044,2009,1926,1967,2065,2038,1999,2011,1989,1994,2036,2027,2003,1984,1984,2032,2018,1959,1998,2041,2001,2002,2036,2022,1996,1989,2025,2084,2056,1982,1997,2043,2032,2020,2041,2061,2035,1980,2000,2080,2075,2007,2004,2052,2068,2045,2036,2067,2092,2078,2045,2018,2035,2063,2058,2075,2067,1971,1965,2111,2188,2096,1931,1876,2058,2248,2195,2030,1911,1888,2056,2272,2232,1981,1864,1998,2143,2137,2076,2011,1976,2052,2133,2100,2043,2038,2063,2086,2080,2073,2065,2045,2069,2097,2064,2060,2082,2059,2059,2084,2083,2102,2121,2091,2074,2074,2066,2101,2143,2098,2021,2025,2080,2114,2127,2101,2029,2004,2069,2144,2157,2104,2054,2067,2112,2139,2126,2071,2052,2094,2098,2061,2064,2081,2079,2090,2088,2051,2057,2117,2120,2071,2064,2076,2071,2090,2110,2075,2044,2076,2119,2120,2093,2051,2033,2077,2123,2110,2082,2062,2067,2118,2130,2075,2059,2081,2091,2098,2075,2059,2096,2102,2071,2075,2088,2101,2098,2066,2093,2140,2091,2060,2111,2124,2092,2070,2057,2066,2099,2116,2079,2038,2067,2081,2047,2094,2149,2076,2017,2057,2089,2123,2147,2076,2017,2066,2099,2078,2095,2099,2051,2053,2098,2092,2072,2067,2049,2056,2098,2113,2095,2073,2069,2081,2089,2102,2105,2063,2030,2048,2080,2095,2088,2058,2026,2025,2088,2152,2114,2037,2036,2079,2097,2074,2054,2091,2130,2097,2059,2065,2072,2070,2085,2101,2092,2080,2087,2098,2106,2112,2100,2086,2085,2085,2090,2099,2100,2095,2071,2058,2097,2127,2101,2077,2080,2089,2095,2096,2093,2088,2092,2106,2085,2052,2082,2128,2111,2068,2059,2083,2103,2108,2102,2079,2066,2077,2080,2090,2103,2073,2060,2093,2106,2106,2105,2082,2086,2109,2105,2108,2098,2059,2062,2096,2107,2104,2076,2038,2055,2103,2112,2084,2071,2083,2089,2088,2082,2070,2078,2088,2069,2064,2078,2074,2069,2067,2058,2061,2071,2067,2056,2061,2078,2075,2057,2051,2051,2074,2107,2087,2052,2063,2067,2058,2063,2066,2087,2102,2063,2051,2094,2102,2071,2055,2065,2082,2071,2064,2095,2098,2061,2049,2058,2070,2088,2086,2070,2084,2099,2066,2033,2047,2073,2074,2058,2049,2051,2044,2049,2087,2085,2036,2026,2048,2064,2082,2081,2061,2051,2051,2083,2107,2074,2063,2084,2066,2062,2085,2074,2078,2096,2071,2048,2061,2083,2095,2080,2076,2094,2086,2067,2071,2075,2082,2096,2096,2086,2078,2081,2085,2074,2075,2093,2090,2073,2060,2049,2060,2083,2074,2052,2064,2090,2076,2048,2064,2087,2075,2068,2076,2070,2063,2074,2085,2068,2052,2076,2090,2060,2051,2057,2045,2062,2081,2041,2020,2061,2079,2059,2054,2054,2046,2059,2080,2079,2079,2091,2092,2090,2081,2060,2062,2092,2108,2090,2059,2060,2088,2090,2083,2100,2098,2067,2059,2077,2081,2064,2057,2054,2043,2064,2095,2067,2037,2066,2081,2051,2039,2061,2074,2065,2060,2055,2033,2035,2059,2048,2038,2061,2069,2057,2047,2038,2041,2043,2045,2054,2033,2013,2041,2049,2023,2028,2034,2015,2017,2035,2038,2032,2030,2029,2021,2030,2057,2055,2033,2030,2036,2044,2055,2056,2053,2046,2033,2042,2059,2045,2024,2029,2043,2044,2034,2024,2025,2032,2027,2019,2028,2045,2045,2021,1997,2012,2042,2034,2005,2003,2015,2025,2029,2019,2008,2007,2009,2019,2025,2014,2014,2020,2005,1996,2010,2021,2019,2018,2021,2019,2013,2014,2021,2020,2007,1992,1999,2027,2033,2013,2013,2029,2031,2017,2003,2002,2017,2028,2023,2021,2021,2014,2017,2027,2020,2014,2032,2041,2025,2016,2023,2030,2038,2043,2042,2039,2043,2051,2049,2035,2032,2047,2050,2030,2027,2047,2050,2039,2032,2025,2038,2064,2051,2021,2022,2038,2046,2041,2025,2027,2044,2043,2031,2025,2027,2035,2037,2030,2024,2023,2029,2034,2025,2018,2024,2038,2045,2035,2023,2031,2040,2035,2036,2042,2042,2039,2038,2046,2058,2060,2054,2047,2048,2061,2068,2060,2051,2047,2051,2053,2040,2040,2056,2052,2047,2059,2053,2043,2054,2055,2047,2054,2049,2034,2043,2051,2037,2034,2042,2038,2028,2036,2051,2051,2043,2038,2033,2030,2040,2052,2050,2043,2033,2023,2029,2040,2034,2023,2027,2036,2034,2034,2040,2041,2036,2035,2036,2028,2020,2025,2031,2023,2017,2023,2029,2032,2038,2035,2028,2030,2032,2028,2025,2028,2035,2039,2034,2031,2032,2030,2025,2022,2023,2026,2023,2020,2020,2019,2016,2015,2018,2024,2029,2030,2025,2016,2015,2020,2024,2028,2035,2039,2038,2032,2032,2034,2022,2012,2021,2032,2037,2031,2016,2016,2034,2035,2020,2013,2016,2020,2022,2027,2029,2013,1995,1998,2009,2013,2011,2006,2007,2016,2021,2022,2022,2020,2017,2018,2020,2021,2020,2018,2016,2019,2024,2021,2012,2010,2018,2024,2029,2035,2031,2021,2015,2018,2025,2025,2021,2020,2026,2034,2035,2032,2030,2029,2023,2020,2019,2016,2018,2023,2021,2010,1999,2003,2011,2004,2000,2011,2013,2007,2010,2013,2012,2016,2021,2029,2034,2028,2024,2025,2020,2019,2027,2032,2030,2027,2022,2015,2011,2012,2011,2012,2019,2019,2012,2016,2020,2014,2013,2020,2013,1999,2002,2015,2011,2000,2000,2002,2002,1999,1999,2003,2002,2000,2005,2003,1997,2000,2000,2000,2011,2012,2008,2010,2015,2027,2043,2040,2023,2016,2019,2021,2025,2037,2037,2021,2024,2040,2036,2028,2036,2044,2043,2038,2042,2052,2054,2049,2047,2047,2051,2050,2039,2038,2043,2042,2039,2028,2014,2014,2028,2038,2033,2024,2029,2028,2012,2016,2040,2041,2020,2015,2030,2038,2031,2042,2066,2059,2038,2049,2074,2079,2079,2082,2074,2068,2082,2091,2084,2083,2071,2044,2049,2077,2073,2051,2042,2035,2022,2014,2027,2036,2012,1993,2006,2016,2008,2001,1997,2005,2014,2014,2017,2020,2021,2031,2035,2032,2055,2085,2082,2071,2082,2098,2097,2093,2098,2108,2110,2099,2093,2102,2108,2113,2117,2093,2070,2089,2095,2076,2074,2061,2032,2032,2045,2046,2031,2001,1999,2023,2024,2018,2004,1975,1994,2023,1983,1963,2005,2012,1996,2031,2055,2010,1994,2062,2100,2059,2044,2058,2047,2060,2104,2098,2058,2066,2111,2111,2079,2088,2111,2098,2089,2090,2083,2094,2106,2095,2078,2064,2073,2101,2097,2069,2050,2060,2094,2090,2060,2078,2085,2050,2054,2067,2052,2057,2052,2035,2064,2084,2060,2053,2067,2076,2074,2071,2093,2096,2053,2051,2082,2059,2027,2051,2078,2065,2051,2067,2080,2060,2058,2087,2079,2051,2064,2077,2068,2072,2077,2067,2066,2072,2069,2067,2076,2083,2065,2052,2074,2090,2081,2075,2074,2076,2091,2093,2075,2072,2082,2085,2079,2067,2057,2057,2074,2098,2079,2040,2059,2099,2093,2077,2081,2082,2075,2080,2104,2113,2077,2047,2066,2090,2090,2087,2086,2082,2083,2087,2092,2090,2076,2069,2083,2095,2081,2057,2054,2065,2064,2051,2052,2070,2079,2079,2078,2078,2080,2081,2076,2076,2075,2068,2072,2084,2086,2082,2087,2097,2103,2096,2089,2093,2097,2095,2095,2092,2085,2086,2090,2086,2079,2079,2088,2094,2082,2074,2089,2095,2081,2081,2093,2093,2090,2091,2089,2088,2088,2090,2086,2075,2079,2094,2086,2065,2058,2062,2065,2064,2066,2071,2072,2082,2097,2091,2083,2089,2087,2079,2081,2078,2076,2077,2075,2080,2089,2089,2088,2091,2089,2092,2102,2102,2094,2095,2106,2107,2099,2100,2105,2100,2092,2090,2082,2066,2062,2065,2057,2049,2055,2062,2064,2062,2053,2043,2039,2046,2052,2042,2036,2048,2051,2045,2049,2049,2046,2055,2065,2064,2066,2072,2074,2076,2074,2065,2070,2088,2090,2079,2081,2089,2088,2082,2080,2081,2077,2074,2083,2090,2082,2082,2091,2089,2081,2083,2082,2076,2076,2078,2071,2061,2056,2057,2056,2050,2041,2041,2050,2059,2062,2053,2046,2051,2052,2050,2050,2047,2044,2045,2044,2043,2045,2052,2057,2051,2051,2063,2066,2065,2070,2065,2055,2055,2057,2058,2060,2061,2061,2058,2050,2046,2044,2047,2057,2057,2049,2048,2047,2048,2046,2037,2033,2031,2026,2029,2035,2031,2030,2036,2036,2029,2023,2027,2038,2039,2027,2023,2033,2036,2030,2028,2028,2030,2041,2051,2052,2051,2050,2048,2044,2045,2049,2051,2055,2057,2053,2055,2061,2056,2053,2057,2055,2052,2057,2061,2058,2052,2050,2053,2050,2045,2041,2038,2042,2046,2044,2040,2033,2027,2033,2042,2040,2040,2047,2051,2044,2038,2040,2042,2040,2038,2032,2030,2041,2050,2045,2037,2039,2047,2045,2034,2033,2037,2039,2040,2036,2031,2030,2030,2037,2053,2056,2044,2040,2047,2051,2047,2043,2041,2039,2039,2039,2039,2043,2043,2042,2042,2038,2035,2037,2036,2038,2045,2039,2033,2038,2042,2041,2043,2043,2039,2039,2044,2051,2055,2048,2032,2027,2042,2054,2049,2038,2036,2036,2029,2026,2038,2049,2045,2044,2053,2053,2045,2047,2053,2048,2037,2035,2037,2035,2037,2049,2053,2049,2053,2059,2051,2036,2032,2037,2044,2045,2041,2039,2030,2018,2018,2020,2023,2029,2037,2048,2056,2049,2043,2043,2037,2031,2032,2034,2038,2039,2032,2029,2031,2030,2028,2032,2040,2039,2027,2019,2017,2014,2011,2016,2024,2031,2032,2028,2029,2036,2038,2030,2026,2028,2022,2010,2011,2025,2031,2022,2016,2018,2017,2021,2027,2022,2011,2006,2008,2019,2026,2022,2022,2023,2018,2014,2016,2022,2025,2022,2021,2023,2018,2012,2011,2009,2005,2009,2020,2024,2024,2033,2040,2034,2026,2028,2032,2024,2010,2007,2013,2015,2019,2028,2033,2031,2025,2024,2030,2030,2027,2027,2025,2024,2019,2008,2005,2006,2005,2006,2010,2020,2032,2025,2013,2015,2017,2019,2025,2023,2020,2026,2031,2031,2030,2025,2023,2032,2037,2026,2015,2017,2014,2001,2001,2008,2012,2018,2022,2013,1999,1998,2012,2011,1996,1997,2011,2019,2023,2030,2036,2032,2023,2026,2032,2020,2009,2010,2013,2018,2019,2012,2011,2017,2024,2028,2027,2026,2026,2026,2025,2018,2014,2022,2027,2025,2022,2013,2003,2005,2013,2018,2022,2027,2030,2024,2015,2011,2009,2011,2015,2019,2021,2018,2010,2008,2013,2021,2027,2031,2033,2027,2016,2013,2017,2016,2016,2023,2026,2025,2021,2023,2028,2027,2022,2023,2025,2024,2022,2019,2015,2014,2015,2019,2022,2017,2009,2006,2012,2021,2027,2027,2022,2018,2015,2010,2004,2002,2006,2011,2011,2010,2012,2013,2017,2023,2023,2021,2025,2024,2017,2014,2015,2017,2018,2018,2021,2024,2025,2025,2022,2021,2024,2022,2017,2015,2012,2010,2013,2019,2024,2022,2018,2019,2024,2028,2028,2025,2024,2025,2025,2024,2021,2018,2019,2022,2023,2025,2028,2028,2021,2018,2026,2034,2034,2035,2036,2037,2042,2036,2019,2011,2018,2025,2028,2035,2046,2047,2040,2039,2036,2028,2030,2036,2042,2053,2055,2044,2037,2038,2034,2028,2030,2032,2025,2017,2015,2015,2018,2026,2032,2034,2035,2036,2039,2042,2041,2040,2037,2036,2038,2037,2036,2038,2036,2033,2033,2030,2025,2023,2027,2036,2042,2048,2056,2055,2049,2046,2047,2051,2053,2054,2059,2058,2048,2046,2050,2045,2046,2060,2072,2073,2067,2063,2062,2065,2072,2079,2080,2075,2062,2049,2044,2048,2056,2065,2073,2078,2077,2075,2072,2063,2057,2065,2074,2078,2082,2087,2080,2065,2058,2061,2063,2064,2069,2073,2072,2068,2066,2070,2070,2067,2068,2071,2070,2069,2066,2061,2062,2068,2070,2068,2069,2070,2070,2073,2077,2079,2076,2070,2065,2062,2058,2059,2071,2077,2071,2062,2061,2067,2072,2071,2069,2067,2065,2067,2068,2067,2071,2075,2072,2067,2066,2072,2084,2089,2079,2060,2049,2049,2053,2065,2085,2090,2077,2064,2065,2072,2073,2059,2049,2057,2073,2082,2076,2061,2048,2045,2053,2068,2081,2087,2082,2074,2073,2069,2062,2061,2059,2066,2086,2095,2085,2066,2046,2036,2048,2072,2097,2117,2115,2090,2062,2049,2054,2067,2079,2076,2059,2054,2071,2092,2103,2099,2085,2074,2062,2042,2035,2054,2084,2108,2117,2099,2063,2034,2026,2043,2085,2137,2165,2153,2120,2083,2059,2061,2083,2107,2121,2124,2114,2094,2072,2056,2050,2060,2084,2111,2128,2130,2113,2083,2061,2062,2084,2114,2137,2157,2169,2156,2123,2096,2087,2092,2102,2107,2106,2108,2113,2116,2118,2115,2101,2080,2062,2054,2058,2078,2098,2098,2077,2043,2004,1985,1999,2032,2069,2095,2101,2097,2089,2081,2081,2091,2108,2127,2142,2145,2138,2127,2115,2106,2102,2103,2110,2120,2129,2134,2130,2114,2092,2075,2062,2054,2059,2064,2052,2028,2006,1993,1985,1975,1972,1977,1986,2000,2019,2035,2040,2036,2036,2045,2053,2064,2091,2121,2140,2146,2132,2108,2098,2107,2125,2145,2165,2177,2170,2149,2126,2113,2113,2123,2129,2130,2126,2117,2107,2096,2084,2075,2064,2048,2032,2021,2017,2021,2025,2021,2010,2001,1996,1993,1997,2005,2005,1998,1993,1991,1988,1987,1989,1992,1995,2004,2018,2028,2030,2025,2022,2023,2027,2034,2043,2050,2051,2048,2043,2037,2037,2051,2072,2091,2100,2098,2092,2089,2088,2093,2101,2108,2111,2112,2108,2108,2113,2114,2112,2113,2109,2104,2105,2106,2108,2110,2107,2098,2086,2075,2069,2069,2073,2077,2080,2080,2076,2067,2061,2065,2070,2074,2078,2081,2084,2085,2079,2074,2073,2070,2069,2076,2087,2098,2099,2090,2082,2080,2081,2082,2087,2095,2099,2098,2094,2089,2085,2087,2091,2091,2092,2095,2094,2090,2085,2084,2085,2083,2077,2075,2079,2082,2088,2099,2103,2095,2085,2078,2071,2069,2072,2070,2062,2054,2044,2035,2036,2042,2043,2043,2043,2042,2037,2026,2016,2016,2022,2027,2034,2039,2038,2033,2033,2034,2029,2029,2037,2043,2042,2042,2045,2043,2036,2032,2037,2042,2040,2036,2033,2032,2030,2027,2023,2020,2022,2022,2020,2024,2031,2036,2037,2039,2034,2022,2010,2000,1995,2002,2007,1996,1983,1987,2000,2006,2006,2010,2019,2030,2034,2027,2018,2013,2011,2008,2002,1996,1995,1996,1992,1984,1978,1979,1983,1989,1997,2004,2008,2009,2010,2007,2003,2001,1996,1992,2001,2016,2021,2019,2012,2002,2002,2015,2022,2020,2016,2009,1997,1991,1992,1986,1972,1963,1958,1959,1967,1969,1970,1989,2017,2034,2042,2050,2061,2074,2082,2089,2087,2075,2064,2054,2039,2026,2015,2004,2002,2001,1993,1980,1968,1962,1963,1973,1987,1992,1997,2016,2036,2038,2038,2053,2073,2082,2084,2090,2094,2090,2086,2084,2079,2070,2064,2063,2065,2067,2064,2054,2041,2037,2041,2041,2034,2028,2026,2023,2019,2023,2038,2047,2043,2037,2038,2046,2052,2055,2052,2044,2042,2047,2048,2051,2059,2061,2060,2067,2072,2065,2062,2064,2062,2060,2061,2059,2053,2049,2046,2045,2049,2052,2045,2034,2034,2045,2048,2043,2043,2045,2040,2035,2038,2041,2042,2044,2045,2043,2045,2053,2052,2046,2051,2055,2050,2048,2051,2047,2040,2041,2044,2042,2036,2033,2031,2029,2028,2023,2016,2010,2010,2015,2017,2012,2006,2006,2010,2011,2009,2010,2012,2010,2006,2003,1999,1994,1988,1981,1975,1978,1993,2006,2009,2011,2014,2013,2013,2012,2008,2006,2004,1999,1998,1999,2002,2007,2009,2010,2011,2009,2007,2007,2003,2003,2004,2002,2008,2015,2011,2006,2006,2005,2003,1997,1991,1993,2001,2007,2015,2022,2028,2037,2050,2056,2045,2025,2012,2004,1993,1980,1971,1968,1965,1963,1967,1973,1977,1980,1986,2001,2020,2027,2025,2029,2035,2037,2033,2023,2010,1999,1990,1982,1977,1980,1989,1995,2000,2010,2026,2044,2061,2076,2089,2100,2114,2124,2130,2140,2147,2145,2140,2133,2120,2108,2100,2088,2069,2046,2019,1995,1983,1972,1953,1931,1918,1913,1908,1898,1882,1868,1866,1867,1862,1853,1850,1858,1872,1887,1898,1907,1918,1936,1953,1968,1982,1992,2008,2031,2048,2060,2073,2086,2098,2116,2135,2151,2165,2177,2184,2188,2193,2204,2213,2213,2212,2216,2225,2228,2223,2218,2214,2207,2203,2200,2192,2181,2176,2173,2162,2147,2134,2120,2110,2105,2097,2084,2078,2074,2054,2032,2025,2024,2015,1997,1985,1987,1988,1980,1973,1967,1957,1947,1946,1944,1937,1931,1926,1923,1926,1930,1926,1920,1921,1926,1929,1925,1919,1920,1929,1936,1944,1954,1957,1956,1963,1976,1987,1993,1992,1996,2010,2027,2040,2045,2045,2046,2052,2064,2078,2086,2086,2091,2106,2122,2128,2128,2129,2134,2141,2142,2141,2144,2155,2167,2175,2178,2176,2176,2177,2175,2172,2177,2182,2182,2182,2183,2183,2182,2176,2164,2157,2159,2162,2160,2155,2153,2152,2145,2137,2137,2143,2139,2128,2124,2125,2122,2113,2104,2100,2097,2090,2076,2064,2057,2053,2049,2040,2028,2024,2025,2024,2014,2000,1994,1993,1988,1980,1972,1964,1960,1961,1961,1957,1951,1946,1947,1948,1945,1940,1939,1939,1935,1936,1945,1949,1946,1943,1941,1942,1952,1962,1963,1958,1953,1953,1957,1962,1964,1962,1961,1970,1986,1996,1998,1996,1997,2004,2010,2013,2015,2012,2010,2017,2026,2028,2030,2034,2035,2038,2043,2045,2050,2056,2057,2057,2060,2065,2063,2056,2063,2075,2073,2064,2069,2078,2078,2074,2073,2078,2082,2077,2074,2080,2084,2081,2082,2086,2087,2082,2081,2088,2094,2088,2082,2080,2077,2073,2076,2081,2082,2083,2087,2087,2081,2077,2082,2088,2087,2082,2082,2084,2087,2090,2090,2090,2088,2087,2088,2092,2092,2091,2091,2092,2092,2092,2093,2096,2095,2094,2101,2109,2109,2108,2106,2101,2099,2104,2108,2110,2109,2107,2107,2107,2104,2103,2102,2100,2098,2096,2096,2097,2096,2097,2100,2100,2096,2091,2086,2083,2083,2083,2085,2086,2082,2076,2075,2079,2078,2074,2072,2072,2069,2065,2064,2064,2063,2057,2053,2058,2061,2054,2047,2048,2049,2049,2047,2044,2040,2041,2042,2044,2044,2041,2038,2036,2035,2036,2039,2040,2036,2035,2042,2047,2044,2042,2042,2041,2036,2032,2034,2040,2041,2036,2032,2034,2038,2039,2037,2039,2043,2043,2037,2035,2041,2045,2046,2049,2054,2055,2054,2055,2056,2055,2055,2055,2056,2058,2059,2058,2061,2067,2065,2062,2066,2070,2071,2071,2071,2071,2072,2071,2069,2070,2068,2069,2075,2077,2075,2079,2082,2082,2083,2085,2089,2093,2092,2090,2091,2089,2088,2088,2087,2087,2091,2094,2103,2112,2108,2101,2101,2100,2100,2104,2106,2106,2105,2104,2105,2112,2117,2113,2106,2103,2107,2112,2111,2109,2110,2113,2114,2111,2110,2111,2111,2108,2109,2112,2116,2116,2110,2106,2108,2110,2107,2104,2104,2105,2107,2107,2106,2108,2107,2103,2105,2106,2102,2100,2102,2102,2101,2098,2097,2100,2100,2097,2098,2099,2097,2096,2095,2090,2087,2090,2091,2086,2081,2081,2083,2081,2080,2080,2078,2075,2073,2073,2072,2069,2065,2063,2060,2058,2057,2053,2045,2043,2043,2043,2041,2040,2040,2042,2042,2043,2043,2039,2036,2035,2032,2030,2028,2024,2020,2019,2020,2019,2018,2019,2023,2022,2018,2015,2014,2015,2016,2018,2017,2012,2007,2006,2009,2010,2009,2008,2008,2011,2012,2009,2006,2007,2007,2006,2006,2006,2003,2001,2002,2003,2001,1998,1998,1999,1998,1996,1996,1997,1998,2001,2003,2000,1995,1991,1990,1990,1987,1985,1985,1984,1984,1986,1986,1986,1987,1988,1987,1987,1989,1992,1994,1993,1993,1992,1993,1996,1997,1994,1991,1992,1997,1996,1990,1991,1998,1998,1997,1998,1999,2001,2002,2001,2000,2000,2001,2000,1997,1997,2003,2005,2002,2002,2004,2006,2008,2005,2003,2009,2014,2011,2006,2008,2012,2010,2003,2006,2021,2026,2013,2008,2018,2026,2024,2019,2019,2023,2026,2024,2022,2030,2039,2036,2029,2027,2029,2029,2028,2024,2023,2030,2038,2040,2042,2046,2045,2039,2037,2037,2038,2045,2048,2047,2053,2058,2054,2048,2046,2047,2053,2057,2055,2052,2051,2053,2058,2062,2064,2063,2059,2058,2060,2060,2058,2059,2064,2071,2075,2073,2070,2070,2071,2074,2077,2076,2073,2075,2075,2072,2069,2067,2070,2077,2079,2075,2073,2072,2073,2076,2079,2080,2077,2074,2072,2071,2069,2069,2072,2075,2073,2070,2070,2071,2073,2078,2080,2080,2078,2077,2077,2080,2082,2080,2078,2077,2073,2071,2069,2068,2070,2072,2071,2071,2069,2067,2065,2062,2058,2057,2059,2061,2061,2058,2055,2053,2052,2054,2055,2055,2056,2058,2055,2049,2046,2046,2049,2051,2051,2049,2048,2051,2052,2052,2052,2053,2050,2049,2053,2055,2050,2047,2051,2052,2048,2044,2041,2042,2046,2045,2042,2043,2045,2047,2046,2043,2038,2035,2035,2036,2038,2038,2033,2029,2031,2030,2029,2037,2033,2022,2029,2034,2024,2025,2036,2041,2039,2034,2027,2028,2029,2031,2034,2033,2030,2033,2031,2027,2026,2023,2016,2016,2021,2027,2032,2033,2031,2027,2021,2023,2027,2021,2021,2027,2018,2005,2019,2035,2023,2006,2015,2026,2022,2023,2028,2020,2015,2022,2027,2029,2034,2033,2027,2029,2032,2029,2022,2021,2028,2033,2031,2025,2021,2022,2026,2026,2024,2024,2025,2022,2019,2018,2018,2018,2019,2021,2020,2016,2016,2020,2021,2021,2024,2025,2022,2020,2021,2022,2021,2017,2021,2029,2029,2023,2019,2018,2018,2020,2020,2019,2016,2017,2023,2024,2019,2020,2026,2029,2028,2025,2023,2026,2029,2027,2023,2023,2026,2032,2038,2039,2036,2036,2036,2035,2035,2034,2036,2042,2041,2033,2030,2030,2025,2026,2033,2033,2029,2027,2028,2029,2028,2029,2033,2037,2037,2036,2034,2035,2037,2040,2045,2050,2049,2044,2042,2043,2043,2041,2040,2042,2043,2044,2045,2042,2038,2042,2048,2050,2046,2041,2038,2036,2033,2032,2034,2037,2038,2038,2036,2031,2029,2029,2031,2035,2034,2032,2034,2033,2030,2029,2029,2029,2031,2031,2030,2032,2035,2036,2036,2034,2031,2034,2037,2032,2027,2029,2032,2034,2034,2033,2035,2036,2036,2040,2045,2045,2041,2038,2039,2041,2043,2044,2043,2041,2038,2034,2035,2041,2045,2044,2044,2046,2050,2051,2050,2049,2049,2046,2045,2048,2050,2049,2049,2049,2048,2047,2046,2046,2046,2047,2048,2045,2043,2045,2048,2048,2045,2046,2051,2052,2048,2048,2050,2046,2041,2043,2048,2051,2052,2054,2051,2049,2052,2055,2056,2055,2052,2050,2049,2049,2052,2052,2046,2044,2049,2051,2052,2053,2051,2050,2052,2052,2051,2051,2049,2047,2047,2046,2046,2048,2049,2047,2046,2048,2054,2057,2058,2059,2060,2060,2059,2055,2052,2053,2059,2061,2060,2059,2059,2056,2054,2057,2060,2058,2057,2058,2056,2053,2054,2057,2057,2055,2054,2056,2057,2054,2052,2055,2058,2062,2063,2058,2055,2059,2058,2054,2054,2057,2061,2064,2061,2057,2061,2064,2062,2062,2063,2063,2062,2063,2068,2070,2067,2063,2058,2054,2054,2059,2067,2075,2074,2064,2056,2057,2060,2062,2064,2066,2063,2064,2068,2069,2067,2065,2063,2062,2065,2067,2069,2073,2076,2074,2068,2066,2067,2066,2063,2062,2065,2069,2071,2072,2073,2073,2074,2075,2074,2074,2075,2072,2069,2069,2069,2070,2073,2074,2076,2079,2078,2071,2066,2065,2064,2064,2065,2065,2064,2063,2063,2065,2067,2064,2063,2067,2066,2063,2065,2068,2071,2073,2068,2068,2073,2074,2072,2071,2071,2076,2081,2078,2072,2066,2064,2066,2069,2070,2071,2069,2063,2059,2059,2060,2061,2066,2074,2072,2066,2068,2068,2062,2066,2072,2066,2061,2065,2068,2064,2062,2068,2071,2064,2059,2063,2062,2056,2055,2060,2065,2065,2061,2061,2062,2058,2057,2059,2061,2060,2057,2058,2060,2056,2054,2059,2064,2067,2067,2063,2055,2050,2051,2060,2069,2069,2064,2060,2055,2050,2055,2066,2073,2075,2078,2079,2073,2064,2058,2058,2063,2069,2072,2076,2075,2070,2071,2074,2074,2071,2067,2062,2062,2065,2066,2063,2062,2061,2063,2067,2071,2074,2073,2068,2063,2063,2066,2066,2062,2062,2067,2068,2067,2068,2068,2065,2063,2064,2068,2073,2074,2075,2075,2072,2071,2074,2074,2073,2073,2071,2071,2071,2069,2068,2068,2065,2063,2063,2062,2065,2067,2068,2069,2064,2058,2058,2061,2063,2065,2062,2059,2062,2067,2070,2072,2070,2069,2069,2071,2073,2070,2064,2064,2068,2068,2067,2069,2071,2071,2070,2067,2067,2071,2073,2070,2067,2064,2061,2062,2064,2063,2065,2066,2065,2068,2073,2068,2062,2063,2062,2061,2062,2062,2062,2063,2061,2060,2059,2060,2063,2063,2061,2059,2058,2056,2057,2062,2065,2065,2063,2064,2066,2065,2062,2063,2065,2062,2058,2059,2057,2053,2057,2061,2060,2062,2064,2061,2057,2052,2047,2049,2056,2058,2057,2056,2058,2061,2056,2052,2058,2062,2058,2058,2060,2051,2045,2052,2059,2058,2058,2056,2053,2059,2064,2057,2052,2053,2051,2050,2053,2051,2050,2049,2044,2045,2051,2051,2043,2043,2048,2048,2045,2049,2053,2048,2047,2051,2048,2046,2050,2051,2045,2044,2047,2047,2046,2044,2047,2055,2056,2047,2042,2046,2051,2050,2044,2041,2039,2039,2041,2042,2041,2041,2044,2043,2039,2034,2035,2039,2034,2025,2027,2038,2045,2042,2033,2027,2026,2027,2029,2038,2043,2036,2030,2031,2037,2039,2034,2024,2020,2025,2033,2039,2045,2047,2041,2034,2028,2025,2032,2038,2029,2023,2026,2021,2017,2024,2025,2021,2028,2035,2033,2029,2024,2023,2029,2032,2030,2027,2023,2022,2022,2020,2022,2035,2037,2026,2025,2032,2031,2033,2043,2041,2034,2031,2021,2015,2027,2036,2031,2028,2028,2028,2033,2030,2024,2020,2017,2022,2031,2028,2024,2024,2020,2019,2025,2025,2026,2031,2029,2024,2021,2021,2027,2032,2029,2025,2029,2033,2034,2037,2035,2026,2020,2021,2020,2019,2027,2034,2033,2032,2041,2041,2028,2021,2019,2014,2015,2022,2027,2031,2034,2033,2035,2040,2037,2026,2013,2004,2005,2008,2010,2025,2046,2053,2048,2041,2034,2026,2016,2012,2019,2026,2024,2022,2026,2034,2039,2040,2037,2032,2032,2029,2020,2014,2017,2023,2027,2030,2029,2025,2030,2039,2043,2040,2033,2024,2020,2022,2024,2016,2006,2007,2020,2031,2030,2028,2033,2032,2028,2028,2028,2030,2030,2024,2026,2038,2040,2034,2032,2029,2026,2022,2012,2011,2020,2017,2011,2021,2027,2020,2022,2028,2029,2033,2042,2040,2024,2013,2020,2028,2024,2019,2019,2011,2005,2022,2040,2037,2032,2039,2038,2026,2023,2031,2033,2030,2034,2034,2022,2015,2021,2027,2028,2028,2029,2035,2034,2025,2019,2014,2011,2026,2047,2048,2034,2027,2035,2041,2029,2026,2041,2034,2006,2002,2016,2026,2041,2047,2032,2023,2033,2041,2037,2027,2024,2032,2032,2023,2029,2036,2027,2025,2037,2037,2033,2039,2043,2044,2054,2053,2040,2040,2050,2046,2030,2023,2033,2044,2040,2036,2033,2026,2028,2043,2048,2044,2039,2028,2023,2029,2036,2036,2036,2033,2029,2035,2046,2047,2041,2043,2045,2037,2030,2037,2043,2042,2042,2045,2043,2036,2039,2042,2031,2022,2033,2038,2026,2025,2035,2032,2028,2040,2046,2039,2037,2044,2042,2035,2037,2044,2044,2036,2034,2039,2038,2034,2036,2039,2040,2040,2038,2040,2046,2047,2046,2048,2051,2056,2058,2053,2051,2053,2050,2047,2045,2045,2049,2055,2056,2052,2049,2053,2060,2057,2047,2043,2047,2052,2049,2044,2045,2051,2056,2058,2053,2044,2041,2048,2054,2056,2057,2058,2054,2053,2055,2054,2052,2051,2049,2046,2050,2055,2054,2051,2049,2047,2047,2049,2052,2048,2041,2045,2055,2059,2055,2050,2048,2049,2048,2047,2049,2050,2051,2053,2051,2052,2056,2053,2045,2045,2054,2062,2062,2058,2058,2058,2054,2051,2051,2048,2044,2048,2053,2050,2043,2044,2049,2049,2051,2053,2048,2042,2046,2051,2049,2047,2050,2053,2050,2049,2053,2055,2053,2052,2058,2067,2071,2065,2057,2060,2068,2063,2050,2050,2055,2053,2052,2058,2065,2069,2070,2067,2063,2062,2067,2069,2062,2059,2067,2070,2064,2061,2058,2055,2058,2063,2063,2058,2057,2060,2063,2061,2060,2059,2057,2058,2058,2056,2057,2061,2063,2063,2060,2055,2052,2055,2061,2063,2062,2066,2068,2062,2062,2068,2066,2062,2068,2072,2066,2062,2063,2065,2064,2063,2065,2070,2069,2062,2061,2065,2067,2067,2065,2063,2066,2069,2067,2066,2064,2060,2062,2064,2062,2062,2065,2065,2067,2070,2074,2078,2077,2075,2077,2075,2071,2073,2072,2072,2077,2077,2069,2067,2069,2069,2071,2074,2074,2072,2073,2074,2071,2066,2065,2067,2067,2063,2061,2063,2065,2067,2069,2069,2068,2068,2069,2070,2068,2065,2065,2065,2067,2069,2065,2059,2064,2070,2065,2059,2060,2065,2068,2065,2062,2061,2061,2061,2059,2059,2059,2056,2051,2053,2055,2054,2051,2048,2047,2054,2059,2055,2050,2053,2058,2061,2059,2055,2055,2055,2049,2043,2046,2053,2054,2056,2059,2059,2057,2051,2049,2059,2065,2060,2053,2055,2062,2065,2062,2060,2064,2065,2061,2058,2057,2059,2061,2061,2059,2056,2055,2058,2057,2053,2053,2058,2060,2057,2055,2058,2060,2059,2060,2060,2057,2059,2061,2059,2058,2057,2058,2060,2062,2062,2064,2063,2058,2056,2055,2056,2059,2062,2064,2068,2069,2064,2062,2066,2068,2067,2066,2062,2062,2069,2069,2061,2060,2063,2063,2066,2070,2072,2072,2068,2066,2072,2075,2070,2065,2063,2064,2069,2068,2064,2063,2066,2070,2070,2064,2062,2066,2068,2067,2065,2064,2064,2062,2058,2059,2062,2057,2053,2056,2058,2055,2054,2054,2055,2060,2058,2052,2056,2063,2060,2054,2052,2055,2065,2063,2049,2050,2063,2063,2054,2046,2044,2049,2056,2056,2053,2051,2051,2055,2053,2048,2048,2051,2048,2047,2056,2061,2051,2041,2045,2056,2057,2052,2050,2049,2046,2049,2056,2052,2044,2048,2056,2061,2061,2055,2049,2050,2048,2042,2038,2036,2034,2032,2030,2036,2050,2057,2045,2032,2040,2061,2063,2046,2033,2042,2062,2068,2049,2028,2030,2050,2059,2046,2031,2034,2047,2053,2052,2049,2049,2053,2058,2058,2053,2043,2033,2033,2039,2043,2039,2036,2042,2052,2051,2041,2038,2047,2055,2051,2040,2034,2037,2047,2046,2032,2027,2038,2045,2041,2039,2041,2047,2052,2051,2049,2048,2051,2052,2051,2050,2047,2044,2047,2049,2045,2046,2046,2044,2050,2054,2048,2044,2049,2051,2047,2046,2048,2050,2047,2045,2046,2047,2044,2039,2033,2032,2039,2043,2042,2042,2044,2047,2048,2048,2048,2046,2045,2045,2040,2034,2036,2043,2046,2045,2042,2041,2041,2043,2046,2046,2044,2045,2047,2046,2042,2039,2039,2042,2042,2043,2046,2048,2044,2040,2040,2043,2042,2041,2043,2043,2041,2041,2039,2036,2038,2044,2046,2042,2036,2034,2039,2043,2041,2036,2034,2037,2042,2043,2040,2037,2038,2040,2042,2042,2039,2036,2038,2041,2042,2041,2038,2036,2036,2035,2033,2032,2034,2038,2041,2040,2040,2040,2039,2039,2041,2043,2047,2046,2042,2041,2043,2046,2046,2046,2049,2050,2048,2045,2042,2039,2037,2036,2034,2033,2032,2031,2034,2036,2038,2038,2035,2033,2035,2036,2034,2032,2032,2035,2039,2042,2043,2043,2043,2045,2048,2050,2047,2045,2048,2052,2050,2047,2046,2045,2048,2052,2051,2050,2050,2049,2048,2050,2053,2053,2049,2044,2041,2040,2038,2040,2041,2040,2039,2039,2040,2041,2041,2040,2038,2036,2038,2040,2039,2037,2036,2036,2039,2040,2037,2037,2038,2039,2038,2036,2036,2040,2042,2039,2036,2038,2044,2047,2042,2038,2039,2040,2038,2033,2030,2033,2037,2040,2042,2042,2042,2040,2039,2040,2041,2040,2038,2040,2041,2041,2037,2033,2035,2040,2042,2040,2040,2041,2041,2040,2040,2041,2041,2040,2037,2035,2035,2036,2034,2033,2035,2035,2033,2032,2033,2033,2034,2034,2034,2035,2035,2034,2033,2034,2034,2034,2035,2035,2034,2033,2032,2031,2031,2032,2034,2036,2036,2035,2034,2034,2036,2041,2043,2043,2043,2043,2042,2040,2038,2037,2038,2039,2040,2040,2040,2038,2038,2039,2038,2037,2036,2035,2034,2036,2039,2040,2038,2036,2038,2040,2039,2036,2034,2035,2039,2041,2040,2040,2039,2038,2037,2038,2041,2043,2045,2046,2045,2044,2043,2042,2041,2042,2042,2041,2040,2042,2044,2044,2044,2045,2046,2046,2044,2044,2043,2042,2039,2040,2044,2046,2045,2046,2048,2049,2047,2044,2043,2042,2039,2037,2039,2041,2042,2042,2043,2045,2048,2048,2047,2044,2043,2044,2040,2036,2037,2038,2035,2033,2034,2035,2035,2035,2036,2040,2041,2037,2034,2037,2042,2043,2042,2040,2040,2044,2046,2043,2041,2044,2044,2042,2040,2035,2032,2033,2036,2037,2036,2035,2037,2041,2043,2041,2038,2039,2044,2046,2044,2040,2039,2042,2044,2042,2037,2034,2037,2042,2044,2043,2043,2044,2045,2045,2043,2040,2039,2039,2041,2045,2051,2053,2053,2051,2048,2046,2045,2043,2042,2044,2046,2045,2043,2043,2045,2048,2050,2050,2049,2048,2046,2045,2046,2046,2045,2046,2046,2044,2045,2047,2049,2047,2046,2046,2047,2049,2051,2051,2049,2047,2047,2048,2049,2049,2046,2044,2045,2048,2050,2052,2052,2053,2051,2048,2045,2044,2047,2048,2045,2043,2044,2046,2045,2044,2045,2048,2049,2047,2046,2048,2050,2051,2051,2052,2053,2054,2053,2053,2054,2055,2056,2054,2053,2054,2054,2052,2053,2055,2057,2056,2054,2053,2055,2054,2052,2051,2051,2055,2060,2061,2061,2060,2060,2061,2061,2061,2060,2058,2057,2055,2052,2051,2052,2054,2056,2057,2056,2056,2056,2057,2056,2057,2058,2058,2057,2056,2056,2057,2058,2058,2058,2058,2059,2059,2057,2059,2063,2064,2062,2061,2057,2054,2055,2056,2056,2057,2059,2059,2060,2060,2059,2057,2055,2055,2055,2057,2058,2057,2055,2056,2057,2058,2056,2054,2053,2053,2055,2057,2059,2060,2059,2059,2059,2059,2056,2054,2054,2055,2055,2055,2056,2056,2055,2057,2060,2063,2063,2062,2061,2061,2062,2064,2063,2061,2058,2057,2058,2058,2057,2056,2054,2053,2054,2056,2057,2057,2057,2059,2060,2060,2061,2062,2063,2062,2060,2060,2061,2062,2062,2061,2060,2059,2059,2061,2064,2066,2064,2062,2061,2061,2061,2061,2062,2064,2066,2065,2063,2061,2059,2057,2056,2057,2058,2059,2060,2062,2063,2062,2061,2061,2063,2063,2062,2062,2062,2063,2062,2061,2062,2063,2063,2063,2062,2062,2065,2066,2066,2066,2065,2063,2064,2064,2062,2062,2063,2063,2063,2063,2062,2062,2063,2064,2066,2065,2063,2063,2061,2056,2055,2057,2060,2061,2062,2062,2059,2056,2054,2056,2057,2057,2056,2057,2059,2062,2063,2063,2063,2064,2064,2064,2064,2062,2062,2063,2064,2065,2065,2063,2061,2061,2060,2059,2059,2062,2064,2064,2064,2064,2064,2064,2065,2067,2066,2064,2063,2063,2063,2065,2067,2066,2063,2062,2062,2061,2059,2057,2057,2056,2055,2055,2054,2053,2053,2054,2056,2057,2058,2056,2055,2053,2051,2051,2053,2054,2055,2056,2058,2060,2061,2061,2062,2063,2063,2061,2058,2057,2056,2053,2053,2054,2055,2056,2059,2060,2060,2059,2058,2058,2060,2062,2061,2058,2055,2053,2053,2053,2054,2053,2052,2053,2055,2056,2057,2057,2057,2058,2057,2053,2050,2050,2050,2050,2051,2051,2051,2050,2048,2045,2045,2047,2051,2053,2052,2051,2050,2049,2050,2051,2054,2056,2055,2053,2050,2048,2048,2051,2054,2056,2055,2051,2047,2045,2044,2045,2046,2047,2048,2049,2050,2050,2048,2047,2048,2050,2051,2051,2050,2048,2047,2048,2050,2051,2052,2051,2047,2042,2041,2044,2048,2052,2055,2054,2052,2050,2047,2046,2048,2049,2049,2049,2048,2046,2045,2044,2046,2048,2048,2048,2048,2048,2046,2044,2044,2046,2046,2046,2044,2042,2042,2044,2046,2047,2048,2050,2051,2051,2049,2047,2045,2043,2044,2045,2045,2044,2043,2043,2043,2043,2042,2041,2041,2040,2041,2044,2045,2046,2045,2044,2044,2043,2039,2038,2040,2042,2043,2044,2042,2041,2042,2041,2039,2039,2039,2040,2041,2042,2041,2039,2037,2037,2037,2039,2040,2040,2038,2038,2038,2038,2039,2041,2042,2043,2044,2043,2039,2036,2037,2038,2038,2036,2035,2034,2035,2038,2039,2039,2039,2040,2042,2044,2044,2042,2039,2036,2036,2038,2039,2039,2039,2040,2042,2044,2047,2047,2045,2042,2041,2040,2040,2041,2044,2046,2045,2044,2042,2041,2040,2040,2039,2039,2040,2043,2044,2043,2041,2040,2039,2038,2037,2037,2038,2039,2039,2040,2041,2040,2039,2038,2038,2037,2036,2036,2037,2040,2042,2042,2042,2040,2038,2038,2039,2040,2038,2037,2035,2035,2035,2035,2034,2036,2037,2038,2037,2036,2034,2033,2033,2034,2035,2037,2036,2035,2035,2036,2036,2036,2036,2035,2036,2038,2038,2037,2037,2038,2039,2038,2037,2037,2038,2038,2039,2039,2039,2038,2039,2039,2040,2040,2040,2039,2038,2037,2036,2035,2035,2035,2035,2036,2039,2040,2038,2036,2037,2037,2037,2039,2041,2042,2040,2039,2039,2038,2036,2036,2036,2038,2038,2037,2036,2036,2036,2038,2039,2041,2043,2044,2040,2037,2037,2036,2037,2038,2039,2038,2038,2039,2039,2038,2039,2039,2037,2036,2036,2036,2036,2037,2036,2034,2033,2032,2031,2031,2032,2034,2036,2039,2038,2037,2039,2039,2037,2036,2036,2037,2041,2043,2043,2040,2039,2038,2037,2036,2037,2037,2037,2039,2039,2037,2037,2038,2040,2039,2037,2037,2038,2038,2038,2037,2037,2038,2038,2038,2037,2038,2039,2040,2038,2035,2033,2034,2036,2036,2036,2037,2038,2039,2040,2039,2037,2037,2038,2037,2037,2037,2038,2037,2035,2036,2037,2037,2037,2037,2038,2039,2038,2039,2039,2039,2038,2038,2039,2038,2036,2036,2037,2037,2036,2036,2036,2036,2036,2037,2037,2037,2037,2037,2037,2036,2037,2036,2035,2035,2037,2037,2036,2037,2038,2037,2038,2039,2039,2039,2040,2040,2040,2039,2038,2038,2039,2041,2042,2040,2038,2039,2040,2039,2039,2041,2042,2042,2042,2041,2041,2041,2041,2041,2041,2041,2042,2044,2044,2043,2043,2044,2044,2045,2044,2043,2043,2044,2046,2045,2043,2043,2043,2045,2047,2046,2044,2043,2045,2046,2045,2044,2044,2044,2045,2045,2045,2043,2043,2044,2045,2046,2047,2048,2048,2047,2047,2048,2049,2048,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2049,2050,2050,2050,2049,2048,2048,2049,2050,2051,2050,2049,2048,2049,2049,2049,2048,2049,2049,2047,2046,2046,2047,2049,2050,2051,2051,2051,2051,2052,2050,2048,2048,2049,2050,2052,2051,2049,2049,2051,2051,2051,2052,2054,2054,2053,2052,2050,2049,2051,2052,2051,2050,2051,2051,2052,2051,2050,2050,2051,2052,2052,2052,2052,2051,2052,2053,2054,2052,2050,2052,2054,2052,2050,2051,2052,2051,2050,2050,2052,2055,2055,2054,2054,2054,2053,2053,2052,2053,2055,2056,2055,2053,2051,2050,2052,2054,2056,2056,2054,2055,2057,2057,2055,2055,2054,2054,2057,2060,2061,2059,2058,2057,2057,2058,2059,2058,2055,2055,2058,2061,2061,2059,2058,2058,2058,2058,2057,2056,2055,2055,2056,2057,2057,2057,2057,2058,2059,2060,2059,2056,2055,2053,2053,2055,2057,2056,2057,2058,2058,2057,2057,2059,2058,2057,2058,2059,2059,2059,2058,2057,2056,2055,2055,2057,2059,2059,2058,2059,2060,2060,2058,2058,2058,2059,2059,2060,2061,2062,2062,2061,2061,2061,2061,2060,2059,2061,2062,2062,2060,2057,2056,2057,2059,2061,2062,2062,2062,2062,2062,2061,2060,2060,2059,2060,2062,2064,2062,2061,2062,2062,2062,2062,2062,2061,2061,2062,2061,2063,2065,2065,2062,2062,2061,2060,2060,2062,2063,2062,2062,2064,2064,2062,2062,2062,2060,2061,2062,2062,2061,2062,2063,2062,2061,2061,2062,2062,2060,2060,2059,2060,2059,2060,2061,2060,2059,2059,2058,2058,2058,2059,2060,2062,2063,2064,2063,2061,2061,2063,2063,2061,2060,2061,2063,2064,2062,2060,2060,2061,2060,2058,2059,2060,2060,2059,2059,2059,2059,2057,2057,2059,2060,2059,2060,2060,2060,2062,2061,2059,2059,2061,2061,2060,2060,2061,2061,2060,2059,2060,2061,2061,2060,2060,2060,2059,2060,2060,2060,2060,2059,2059,2060,2059,2059,2059,2057,2056,2056,2056,2055,2054,2054,2055,2056,2055,2053,2054,2056,2056,2057,2057,2057,2056,2055,2055,2055,2054,2053,2052,2050,2051,2052,2053,2054,2054,2053,2054,2053,2053,2054,2055,2056,2057,2056,2056,2056,2056,2055,2055,2055,2056,2056,2055,2054,2054,2054,2053,2051,2049,2051,2053,2054,2054,2054,2054,2053,2051,2050,2048,2048,2048,2050,2052,2052,2052,2053,2053,2052,2052,2050,2048,2048,2049,2050,2051,2050,2046,2046,2048,2050,2049,2048,2048,2050,2049,2049,2051,2054,2055,2054,2052,2050,2049,2050,2050,2049,2050,2050,2050,2049,2047,2047,2048,2048,2046,2045,2047,2050,2050,2049,2049,2049,2049,2048,2047,2048,2049,2047,2046,2047,2050,2050,2049,2049,2049,2049,2048,2047,2049,2050,2049,2049,2048,2048,2049,2049,2049,2048,2047,2047,2047,2048,2048,2046,2045,2046,2047,2048,2048,2048,2047,2047,2048,2048,2047,2048,2048,2047,2048,2048,2047,2045,2045,2045,2046,2047,2047,2048,2048,2046,2046,2046,2047,2047,2045,2045,2045,2044,2044,2043,2043,2045,2047,2045,2043,2041,2042,2043,2043,2042,2043,2043,2042,2043,2043,2044,2045,2044,2043,2043,2045,2046,2045,2043,2043,2044,2044,2043,2044,2044,2044,2043,2042,2041,2040,2042,2043,2042,2042,2043,2043,2043,2043,2042,2042,2040,2040,2041,2041,2041,2042,2042,2040,2039,2041,2043,2044,2043,2041,2040,2040,2040,2042,2043,2041,2040,2039,2039,2041,2041,2041,2042,2043,2042,2041,2040,2041,2042,2043,2044,2042,2040,2040,2041,2039,2038,2039,2040,2041,2042,2042,2042,2039,2036,2034,2036,2038,2039,2039,2040,2041,2040,2040,2042,2043,2042,2041,2041,2040,2040,2040,2038,2038,2040,2041,2040,2040,2042,2041,2041,2040,2039,2038,2040,2041,2039,2038,2039,2038,2036,2036,2038,2038,2037,2036,2038,2040,2040,2038,2038,2040,2040,2038,2037,2037,2038,2038,2037,2039,2040,2036,2038,2041,2036,2036,2045,2043,2028,2026,2040,2050,2044,2027,2023,2043,2059,2045,2023,2025,2044,2050,2033,2023,2034,2044,2045,2040,2030,2029,2038,2038,2031,2033,2038,2036,2029,2031,2040,2042,2038,2035,2036,2038,2038,2036,2033,2035,2038,2038,2037,2040,2041,2038,2036,2038,2040,2039,2039,2038,2037,2038,2040,2039,2038,2037,2037,2038,2039,2039,2041,2039,2036,2037,2038,2038,2037,2037,2038,2037,2037,2039,2039,2037,2036,2037,2036,2036,2036,2036,2037,2037,2036,2037,2038,2037,2037,2038,2037,2036,2037,2037,2037,2037,2038,2038,2038,2038,2039,2038,2038,2039,2039,2038,2038,2038,2038,2039,2040,2039,2037,2037,2038,2039,2039,2040,2040,2038,2038,2040,2040,2037,2037,2038,2039,2038,2038,2039,2041,2041,2039,2040,2042,2041,2038,2037,2041,2043,2042,2040,2042,2043,2040,2038,2041,2044,2042,2040,2040,2041,2040,2040,2040,2040,2042,2042,2040,2041,2044,2045,2043,2041,2042,2044,2045,2043,2041,2040,2040,2041,2042,2043,2044,2044,2043,2042,2044,2045,2043,2041,2044,2049,2047,2041,2041,2046,2047,2046,2045,2044,2043,2044,2045,2043,2042,2045,2046,2047,2047,2046,2043,2041,2043,2043,2043,2044,2044,2042,2042,2043,2043,2042,2041,2043,2044,2042,2042,2046,2048,2046,2045,2045,2046,2045,2044,2045,2047,2047,2045,2045,2046,2047,2046,2044,2045,2048,2048,2046,2045,2043,2044,2045,2045,2044,2044,2045,2046,2047,2047,2047,2047,2048,2050,2049,2045,2043,2045,2048,2048,2047,2046,2046,2047,2046,2045,2044,2043,2042,2044,2046,2046,2046,2046,2047,2048,2049,2049,2048,2049,2049,2048,2049,2051,2051,2048,2047,2047,2049,2049,2048,2047,2049,2051,2052,2052,2051,2051,2050,2050,2052,2054,2052,2052,2052,2052,2051,2052,2052,2052,2053,2054,2054,2055,2055,2054,2053,2052,2053,2056,2055,2054,2054,2054,2054,2054,2054,2055,2055,2056,2055,2055,2055,2055,2054,2055,2057,2058,2058,2058,2058,2059,2058,2058,2058,2058,2056,2055,2054,2055,2056,2056,2055,2055,2056,2056,2057,2058,2057,2056,2056,2055,2054,2054,2055,2055,2055,2054,2054,2055,2056,2055,2054,2053,2052,2053,2054,2055,2057,2057,2057,2056,2056,2055,2055,2054,2055,2055,2056,2057,2059,2058,2058,2058,2058,2058,2058,2059,2058,2059,2060,2059,2059,2060,2061,2060,2060,2059,2059,2059,2059,2059,2058,2058,2057,2058,2058,2059,2059,2058,2058,2057,2056,2056,2055,2056,2055,2054,2054,2054,2054,2054,2054,2054,2056,2057,2057,2055,2054,2053,2053,2054,2053,2053,2054,2056,2055,2055,2056,2056,2055,2053,2053,2054,2055,2054,2054,2054,2056,2056,2055,2054,2055,2056,2056,2056,2055,2055,2054,2054,2056,2057,2057,2057,2057,2055,2054,2054,2054,2054,2054,2055,2053,2053,2053,2053,2052,2052,2052,2051,2051,2051,2051,2049,2048,2047,2046,2047,2047,2048,2049,2048,2047,2046,2046,2047,2049,2050,2050,2050,2049,2049,2050,2050,2051,2052,2052,2052,2053,2053,2053,2053,2053,2055,2055,2054,2055,2057,2058,2056,2056,2058,2059,2060,2060,2059,2058,2058,2060,2061,2060,2060,2061,2062,2061,2059,2058,2059,2060,2061,2060,2059,2058,2059,2061,2062,2063,2064,2065,2065,2063,2061,2060,2059,2058,2060,2061,2061,2061,2061,2061,2060,2059,2058,2058,2057,2056,2056,2054,2053,2054,2054,2053,2053,2052,2051,2052,2052,2051,2049,2049,2048,2048,2048,2048,2048,2047,2046,2045,2045,2044,2043,2043,2043,2044,2044,2044,2044,2044,2044,2042,2042,2042,2043,2043,2042,2043,2043,2044,2043,2043,2042,2041,2040,2040,2042,2044,2045,2046,2046,2045,2044,2043,2043,2043,2045,2045,2046,2047,2047,2046,2046,2048,2048,2049,2049,2050,2051,2051,2050,2050,2050,2051,2051,2051,2052,2055,2056,2056,2057,2058,2058,2059,2060,2058,2056,2058,2059,2058,2057,2059,2061,2058,2056,2058,2059,2057,2056,2059,2062,2060,2058,2059,2060,2059,2058,2058,2060,2062,2061,2059,2059,2059,2059,2059,2060,2060,2059,2059,2060,2059,2059,2058,2058,2058,2059,2059,2058,2058,2058,2056,2055,2056,2056,2055,2054,2054,2053,2053,2055,2054,2052,2052,2053,2053,2050,2050,2050,2049,2048,2050,2051,2050,2049,2050,2050,2049,2049,2048,2048,2048,2047,2044,2043,2043,2043,2042,2042,2042,2042,2042,2041,2041,2041,2041,2041,2041,2041,2040,2039,2038,2037,2037,2037,2038,2039,2038,2037,2037,2036,2035,2035,2035,2035,2035,2035,2034,2033,2034,2034,2034,2034,2035,2035,2034,2034,2034,2035,2035,2035,2033,2031,2032,2033,2033,2033,2033,2034,2035,2036,2035,2034,2034,2035,2034,2034,2034,2035,2036,2038,2037,2037,2037,2038,2038,2038,2038,2038,2039,2039,2040,2040,2041,2043,2044,2043,2043,2044,2044,2043,2043,2044,2046,2046,2047,2047,2047,2047,2047,2047,2047,2048,2049,2051,2053,2052,2051,2051,2051,2051,2050,2050,2051,2052,2052,2051,2052,2053,2054,2054,2054,2056,2057,2055,2054,2054,2055,2055,2056,2057,2057,2058,2057,2056,2057,2057,2056,2057,2058,2058,2056,2056,2058,2058,2057,2055,2055,2056,2056,2055,2055,2057,2058,2058,2057,2056,2056,2055,2055,2056,2055,2054,2053,2054,2054,2054,2055,2055,2055,2055,2055,2055,2054,2054,2053,2053,2054,2053,2053,2052,2052,2051,2050,2050,2051,2050,2049,2049,2048,2047,2048,2048,2047,2046,2046,2046,2045,2044,2044,2043,2042,2043,2043,2042,2041,2041,2041,2041,2041,2041,2041,2040,2038,2039,2040,2040,2038,2039,2041,2039,2038,2038,2039,2039,2039,2039,2039,2037,2036,2037,2037,2037,2038,2038,2037,2036,2037,2037,2037,2036,2036,2036,2037,2037,2037,2036,2036,2036,2037,2037,2037,2037,2038,2038,2038,2038,2038,2036,2035,2035,2035,2035,2035,2036,2037,2037,2036,2036,2037,2037,2037,2036,2036,2037,2037,2036,2036,2037,2036,2036,2036,2036,2035,2035,2036,2036,2035,2034,2036,2035,2033,2033,2034,2034,2035,2035,2035,2035,2036,2035,2036,2037,2037,2036,2037,2038,2038,2037,2036,2037,2040,2040,2038,2037,2038,2038,2039,2039,2039,2038,2038,2039,2039,2037,2037,2039,2040,2039,2039,2041,2042,2042,2042,2043,2043,2043,2043,2044,2043,2043,2043,2044,2044,2043,2044,2045,2045,2046,2047,2047,2047,2046,2046,2047,2048,2048,2048,2047,2047,2048,2048,2047,2048,2049,2050,2049,2049,2049,2049,2049,2050,2051,2051,2050,2049,2049,2050,2051,2050,2049,2050,2051,2050,2049,2050,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2050,2050,2050,2051,2051,2052,2052,2050,2050,2050,2051,2051,2051,2050,2050,2050,2051,2051,2051,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2048,2048,2047,2047,2047,2047,2047,2046,2045,2046,2046,2046,2045,2045,2045,2045,2045,2044,2044,2044,2043,2043,2043,2043,2043,2044,2044,2044,2044,2043,2043,2044,2044,2044,2044,2044,2043,2043,2042,2042,2042,2041,2041,2041,2041,2042,2042,2040,2040,2039,2040,2040,2040,2040,2040,2040,2040,2040,2041,2041,2040,2039,2039,2040,2041,2041,2041,2041,2041,2041,2041,2042,2042,2042,2042,2041,2041,2041,2041,2041,2041,2042,2042,2042,2041,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2043,2043,2043,2042,2043,2044,2044,2045,2044,2044,2043,2043,2043,2044,2045,2045,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2045,2045,2045,2046,2047,2047,2046,2046,2047,2048,2048,2047,2047,2046,2046,2046,2047,2047,2047,2047,2046,2046,2047,2047,2047,2048,2048,2049,2050,2049,2049,2049,2049,2048,2048,2049,2050,2050,2051,2052,2052,2052,2052,2053,2053,2054,2054,2054,2053,2053,2053,2053,2054,2054,2053,2054,2055,2054,2055,2056,2056,2055,2055,2055,2055,2055,2055,2056,2056,2056,2056,2056,2056,2056,2057,2057,2056,2057,2057,2057,2057,2057,2057,2058,2058,2059,2059,2059,2059,2058,2057,2057,2057,2057,2058,2058,2057,2058,2058,2058,2059,2059,2059,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2059,2059,2059,2058,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2060,2059,2059,2059,2059,2059,2060,2060,2059,2059,2060,2061,2060,2059,2060,2061,2060,2059,2060,2059,2058,2057,2058,2058,2057,2057,2058,2058,2057,2058,2058,2058,2058,2058,2058,2057,2058,2058,2057,2057,2057,2057,2057,2057,2057,2058,2058,2058,2058,2058,2057,2057,2058,2057,2057,2057,2057,2056,2057,2057,2057,2057,2056,2056,2056,2056,2057,2057,2056,2056,2056,2057,2056,2056,2056,2056,2055,2056,2056,2056,2056,2056,2055,2056,2056,2057,2057,2057,2056,2056,2056,2056,2056,2056,2055,2055,2056,2056,2055,2055,2055,2056,2056,2056,2055,2055,2056,2056,2056,2056,2055,2055,2056,2056,2055,2055,2056,2056,2055,2054,2054,2053,2053,2053,2053,2053,2054,2054,2054,2054,2054,2054,2054,2054,2054,2055,2055,2055,2054,2053,2053,2054,2053,2053,2053,2053,2053,2053,2053,2053,2053,2052,2052,2053,2053,2052,2051,2052,2052,2052,2052,2051,2050,2051,2051,2051,2051,2050,2049,2050,2051,2051,2050,2050,2052,2052,2052,2051,2051,2051,2051,2050,2049,2049,2050,2049,2049,2048,2048,2048,2049,2049,2049,2049,2049,2048,2049,2049,2048,2047,2048,2049,2049,2048,2048,2048,2049,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2049,2049,2048,2047,2047,2047,2047,2046,2045,2046,2047,2047,2047,2046,2047,2047,2047,2046,2046,2046,2047,2048,2048,2048,2048,2048,2047,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2043,2043,2044,2045,2045,2044,2044,2044,2044,2044,2043,2042,2043,2043,2043,2043,2043,2043,2043,2044,2045,2045,2044,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2045,2044,2044,2044,2043,2043,2043,2043,2044,2044,2044,2043,2043,2044,2044,2044,2043,2044,2044,2043,2044,2045,2045,2044,2043,2043,2043,2044,2043,2043,2043,2044,2044,2044,2044,2043,2042,2043,2043,2043,2044,2044,2043,2044,2043,2043,2043,2043,2043,2043,2042,2043,2043,2043,2043,2043,2042,2043,2042,2042,2043,2043,2042,2042,2043,2043,2044,2044,2044,2045,2045,2044,2044,2044,2043,2043,2043,2043,2042,2042,2043,2044,2043,2042,2042,2042,2043,2043,2043,2044,2044,2043,2043,2044,2044,2043,2042,2043,2043,2043,2043,2043,2041,2041,2041,2041,2041,2042,2042,2043,2042,2041,2040,2040,2040,2040,2040,2040,2040,2040,2041,2041,2040,2040,2041,2041,2041,2042,2043,2042,2042,2043,2043,2043,2042,2043,2043,2043,2043,2043,2042,2042,2042,2043,2043,2043,2043,2043,2042,2043,2043,2044,2043,2042,2040,2040,2041,2041,2040,2040,2040,2041,2041,2042,2042,2041,2041,2042,2042,2041,2042,2042,2042,2043,2043,2043,2043,2042,2041,2041,2042,2041,2040,2041,2042,2042,2041,2041,2041,2042,2042,2043,2042,2040,2041,2043,2042,2041,2042,2043,2044,2043,2041,2042,2043,2043,2042,2041,2041,2042,2042,2042,2042,2041,2041,2042,2043,2043,2043,2042,2042,2043,2044,2044,2044,2044,2044,2043,2044,2044,2044,2044,2044,2044,2043,2043,2044,2044,2044,2044,2045,2045,2044,2044,2044,2044,2044,2045,2046,2046,2046,2046,2046,2047,2047,2047,2046,2044,2045,2045,2044,2043,2044,2044,2044,2044,2045,2045,2044,2045,2045,2044,2044,2045,2044,2043,2043,2043,2044,2045,2045,2045,2045,2044,2046,2047,2047,2047,2047,2046,2046,2046,2044,2044,2045,2046,2045,2045,2046,2046,2044,2044,2045,2046,2046,2046,2045,2045,2046,2047,2045,2044,2045,2044,2043,2043,2044,2044,2043,2043,2044,2043,2043,2043,2044,2045,2045,2046,2045,2045,2045,2045,2045,2046,2046,2046,2045,2045,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2044,2044,2044,2045,2046,2046,2046,2045,2045,2045,2045,2044,2045,2046,2046,2046,2046,2045,2045,2046,2047,2047,2048,2049,2049,2048,2048,2048,2049,2050,2050,2050,2051,2051,2050,2049,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2051,2051,2050,2050,2050,2051,2051,2051,2051,2051,2052,2051,2051,2051,2051,2050,2049,2049,2049,2050,2051,2051,2051,2051,2051,2051,2051,2050,2049,2049,2049,2049,2048,2048,2049,2049,2050,2050,2050,2051,2050,2050,2049,2048,2048,2049,2048,2048,2048,2047,2047,2048,2048,2049,2049,2049,2050,2050,2051,2051,2050,2050,2050,2050,2049,2049,2049,2049,2049,2050,2051,2050,2051,2052,2051,2051,2051,2051,2052,2051,2050,2051,2051,2051,2052,2053,2053,2052,2052,2052,2052,2051,2051,2050,2050,2051,2050,2050,2051,2051,2052,2053,2053,2053,2054,2053,2053,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2053,2053,2053,2052,2052,2051,2052,2052,2052,2051,2051,2051,2052,2051,2050,2050,2050,2050,2051,2051,2050,2050,2050,2051,2051,2050,2050,2050,2050,2051,2051,2051,2050,2049,2048,2047,2048,2049,2049,2050,2049,2048,2049,2050,2050,2050,2051,2051,2051,2050,2049,2049,2049,2050,2050,2050,2050,2050,2050,2051,2050,2050,2049,2049,2049,2049,2050,2050,2050,2050,2051,2051,2052,2052,2052,2051,2052,2053,2053,2053,2054,2055,2054,2053,2053,2053,2052,2052,2052,2052,2052,2052,2052,2052,2052,2053,2053,2054,2054,2053,2053,2053,2053,2053,2053,2053,2052,2052,2053,2053,2053,2052,2053,2053,2054,2054,2054,2054,2054,2054,2054,2054,2054,2054,2054,2055,2055,2054,2054,2054,2054,2054,2054,2054,2054,2054,2055,2054,2054,2053,2052,2053,2054,2053,2053,2053,2053,2054,2054,2055,2055,2055,2055,2055,2054,2054,2054,2053,2053,2053,2053,2053,2052,2052,2053,2053,2053,2054,2054,2053,2053,2053,2053,2053,2053,2055,2055,2055,2055,2056,2056,2055,2054,2053,2052,2051,2052,2053,2052,2051,2052,2052,2052,2052,2052,2053,2052,2052,2053,2053,2052,2052,2051,2051,2051,2051,2052,2052,2052,2052,2053,2053,2053,2053,2052,2052,2052,2052,2053,2054,2054,2053,2053,2052,2052,2052,2051,2052,2051,2050,2049,2049,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2047,2047,2048,2047,2047,2046,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2049,2049,2050,2050,2050,2050,2051,2051,2051,2052,2052,2052,2051,2052,2052,2052,2052,2053,2053,2052,2051,2051,2050,2051,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2054,2054,2054,2054,2053,2053,2052,2051,2050,2049,2050,2051,2051,2052,2052,2051,2051,2051,2051,2050,2050,2050,2050,2049,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2046,2045,2045,2045,2045,2045,2045,2044,2044,2043,2043,2043,2043,2044,2044,2044,2044,2044,2043,2043,2044,2044,2044,2045,2045,2045,2044,2044,2044,2044,2044,2044,2045,2044,2045,2046,2047,2047,2047,2047,2048,2049,2049,2049,2047,2048,2049,2049,2049,2049,2050,2050,2050,2051,2051,2052,2052,2052,2052,2052,2051,2051,2051,2052,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2051,2051,2052,2052,2052,2052,2052,2051,2051,2051,2050,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2048,2047,2047,2047,2046,2045,2045,2046,2046,2045,2045,2045,2044,2044,2043,2043,2043,2042,2042,2042,2041,2041,2040,2040,2040,2040,2040,2039,2039,2039,2039,2040,2039,2038,2038,2038,2038,2038,2037,2036,2036,2036,2035,2035,2035,2035,2036,2036,2036,2037,2036,2036,2036,2037,2036,2036,2035,2036,2036,2036,2036,2036,2036,2037,2037,2037,2037,2037,2037,2037,2038,2038,2038,2039,2039,2039,2040,2041,2041,2040,2041,2041,2042,2042,2043,2043,2043,2044,2045,2045,2045,2046,2047,2047,2047,2047,2048,2047,2047,2048,2048,2049,2050,2051,2051,2052,2052,2052,2053,2053,2053,2053,2054,2055,2056,2056,2056,2057,2057,2057,2057,2057,2056,2057,2057,2057,2057,2057,2058,2058,2058,2058,2057,2057,2057,2057,2056,2056,2056,2055,2055,2056,2056,2056,2056,2055,2055,2055,2054,2054,2054,2055,2054,2053,2053,2053,2053,2052,2052,2051,2050,2050,2050,2049,2049,2048,2049,2048,2047,2047,2046,2045,2045,2045,2044,2044,2044,2044,2042,2042,2042,2041,2041,2041,2040,2039,2038,2038,2038,2038,2037,2037,2036,2036,2036,2036,2035,2035,2035,2035,2035,2035,2034,2033,2033,2033,2033,2032,2031,2031,2031,2031,2030,2031,2031,2031,2031,2031,2031,2031,2031,2031,2031,2032,2033,2032,2032,2033,2032,2031,2031,2031,2031,2032,2033,2033,2033,2033,2034,2034,2034,2034,2035,2035,2036,2036,2036,2037,2037,2037,2038,2037,2037,2038,2038,2038,2039,2039,2040,2041,2041,2041,2042,2042,2043,2044,2045,2045,2045,2045,2045,2046,2047,2047,2047,2047,2047,2048,2049,2050,2050,2049,2049,2051,2052,2053,2054,2055,2056,2055,2053,2053,2054,2054,2054,2055,2056,2056,2057,2059,2059,2059,2059,2058,2057,2057,2057,2057,2057,2058,2059,2060,2060,2060,2061,2062,2063,2063,2063,2063,2062,2061,2060,2059,2060,2060,2061,2061,2061,2061,2062,2061,2060,2060,2060,2059,2059,2060,2060,2059,2058,2058,2058,2057,2058,2058,2058,2058,2058,2057,2056,2055,2055,2055,2055,2055,2054,2053,2053,2052,2052,2051,2051,2052,2052,2051,2050,2051,2051,2050,2049,2048,2047,2046,2045,2045,2045,2044,2044,2044,2044,2043,2043,2043,2043,2043,2043,2042,2043,2044,2043,2041,2042,2043,2042,2040,2040,2041,2040,2039,2038,2038,2038,2038,2037,2038,2039,2038,2038,2039,2039,2037,2038,2038,2037,2036,2035,2035,2035,2036,2036,2036,2035,2035,2035,2035,2036,2036,2036,2036,2037,2037,2036,2035,2035,2035,2035,2036,2036,2036,2035,2035,2035,2036,2036,2037,2036,2036,2037,2037,2037,2037,2038,2038,2039,2040,2040,2040,2040,2039,2039,2039,2040,2040,2040,2040,2040,2040,2041,2042,2042,2042,2041,2041,2042,2042,2042,2042,2043,2043,2044,2045,2046,2047,2047,2047,2047,2047,2046,2046,2047,2047,2047,2047,2047,2048,2048,2049,2050,2050,2050,2050,2050,2051,2052,2053,2052,2052,2053,2053,2054,2054,2054,2054,2055,2056,2056,2056,2056,2056,2056,2057,2057,2057,2057,2058,2058,2058,2059,2059,2059,2058,2058,2057,2057,2057,2057,2057,2057,2058,2058,2058,2058,2058,2059,2060,2061,2061,2061,2060,2060,2060,2060,2060,2061,2061,2061,2060,2060,2059,2059,2059,2059,2059,2059,2059,2059,2060,2060,2060,2060,2059,2058,2059,2060,2060,2060,2060,2060,2060,2061,2061,2062,2061,2060,2060,2059,2059,2059,2059,2059,2059,2059,2060,2061,2061,2061,2060,2060,2060,2060,2061,2061,2061,2060,2060,2059,2059,2059,2059,2059,2058,2058,2058,2059,2059,2059,2059,2058,2058,2058,2058,2058,2058,2058,2057,2057,2057,2056,2056,2057,2056,2056,2056,2056,2056,2055,2056,2056,2056,2056,2055,2055,2055,2054,2054,2054,2054,2054,2053,2053,2052,2052,2052,2052,2051,2051,2051,2051,2051,2050,2050,2049,2049,2050,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2047,2046,2046,2047,2047,2047,2047,2048,2047,2047,2047,2047,2046,2045,2045,2046,2045,2045,2045,2045,2044,2044,2044,2044,2043,2043,2043,2043,2043,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2041,2041,2040,2040,2040,2040,2040,2040,2040,2039,2039,2039,2039,2039,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2041,2041,2041,2041,2041,2041,2041,2042,2042,2043,2043,2043,2043,2044,2044,2043,2043,2043,2044,2043,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2046,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2050,2050,2050,2050,2050,2050,2051,2051,2050,2051,2051,2051,2051,2051,2051,2051,2052,2052,2051,2051,2052,2052,2053,2054,2054,2054,2054,2054,2055,2054,2054,2055,2055,2055,2055,2054,2054,2055,2055,2054,2054,2054,2055,2056,2055,2055,2055,2056,2055,2054,2054,2055,2055,2055,2055,2056,2056,2054,2054,2055,2055,2055,2055,2055,2054,2054,2054,2054,2055,2056,2055,2054,2055,2055,2055,2054,2053,2053,2054,2054,2054,2054,2053,2052,2051,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2050,2051,2052,2053,2052,2052,2052,2052,2051,2052,2052,2052,2052,2051,2051,2050,2050,2049,2049,2049,2049,2049,2048,2047,2047,2048,2049,2049,2049,2050,2050,2050,2050,2049,2049,2049,2048,2047,2048,2048,2047,2046,2046,2047,2047,2046,2046,2045,2046,2046,2046,2046,2047,2046,2046,2046,2046,2045,2046,2046,2046,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2044,2044,2044,2044,2045,2045,2045,2045,2044,2044,2044,2045,2045,2046,2046,2046,2045,2045,2045,2046,2046,2046,2045,2044,2044,2044,2044,2044,2044,2044,2044,2045,2046,2045,2045,2045,2045,2046,2046,2045,2045,2046,2046,2046,2045,2045,2045,2045,2044,2044,2044,2044,2043,2043,2043,2044,2045,2045,2044,2044,2044,2044,2045,2045,2044,2044,2044,2044,2044,2044,2044,2043,2043,2044,2044,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2042,2042,2042,2042,2042,2042,2042,2042,2042,2041,2040,2041,2041,2042,2041,2039,2039,2039,2039,2039,2040,2040,2041,2041,2040,2041,2041,2040,2040,2041,2041,2040,2039,2039,2040,2039,2039,2040,2039,2039,2039,2040,2040,2040,2040,2040,2041,2041,2041,2041,2041,2040,2041,2041,2041,2041,2041,2041,2042,2042,2042,2042,2042,2043,2043,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2042,2042,2042,2044,2044,2043,2044,2044,2045,2046,2047,2047,2047,2046,2047,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2046,2046,2047,2048,2049,2049,2049,2049,2049,2049,2050,2049,2048,2049,2049,2050,2049,2048,2049,2049,2050,2051,2051,2051,2051,2051,2050,2051,2052,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2050,2050,2049,2050,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2050,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2049,2049,2049,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2047,2047,2047,2047,2047,2047,2047,2046,2046,2047,2046,2046,2047,2047,2047,2046,2047,2047,2047,2047,2047,2046,2046,2047,2047,2047,2046,2046,2046,2046,2047,2047,2047,2046,2045,2044,2044,2045,2045,2045,2045,2044,2044,2045,2046,2045,2045,2045,2045,2044,2044,2044,2045,2045,2045,2044,2045,2045,2046,2046,2046,2046,2046,2047,2047,2046,2046,2046,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2044,2045,2045,2045,2044,2044,2044,2045,2044,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2044,2045,2045,2045,2044,2044,2044,2045,2045,2045,2046,2046,2046,2046,2046,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2045,2045,2046,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2045,2045,2046,2046,2046,2046,2046,2047,2047,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2050,2050,2049,2050,2050,2050,2051,2050,2050,2050,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2052,2052,2051,2051,2052,2051,2051,2051,2051,2051,2051,2050,2049,2049,2050,2050,2050,2050,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2050,2050,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2052,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2051,2052,2052,2052,2052,2052,2053,2054,2054,2053,2053,2053,2053,2053,2052,2052,2051,2052,2052,2051,2051,2051,2052,2052,2053,2052,2052,2052,2053,2053,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2053,2053,2052,2052,2052,2052,2052,2052,2052,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2052,2052,2053,2053,2053,2052,2052,2052,2052,2053,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2053,2053,2054,2054,2054,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2052,2052,2052,2051,2051,2052,2051,2051,2051,2051,2051,2051,2051,2050,2051,2051,2051,2050,2050,2049,2049,2049,2049,2049,2049,2050,2049,2049,2049,2050,2051,2051,2050,2050,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2051,2050,2050,2049,2049,2049,2048,2047,2046,2047,2047,2047,2048,2049,2049,2050,2051,2051,2051,2051,2051,2052,2051,2051,2050,2049,2048,2047,2046,2046,2046,2046,2046,2047,2049,2051,2053,2054,2055,2056,2056,2056,2055,2053,2050,2048,2046,2043,2041,2040,2039,2038,2038,2039,2039,2039,2040,2040,2041,2040,2038,2037,2036,2034,2032,2030,2028,2027,2028,2028,2029,2030,2033,2037,2042,2047,2053,2060,2067,2075,2081,2088,2094,2099,2103,2106,2108,2108,2107,2104,2100,2095,2089,2081,2073,2064,2055,2046,2037,2027,2019,2011,2003,1996,1990,1984,1980,1977,1975,1973,1973,1974,1975,1978,1981,1986,1990,1995,2002,2009,2016,2022,2029,2036,2043,2049,2056,2062,2068,2074,2079,2085,2091,2096,2100,2104,2107,2110,2113,2116,2117,2118,2118,2118,2117,2116,2114,2111,2109,2105,2102,2098,2094,2089,2084,2080,2075,2070,2065,2060,2055,2051,2046,2041,2036,2032,2028,2025,2021,2018,2015,2012,2011,2010,2008,2007,2006,2006,2005,2005,2004,2004,2003,2003,2003,2004,2004,2005,2006,2006,2007,2009,2010,2011,2012,2014,2016,2018,2019,2020,2022,2024,2026,2029,2031,2033,2035,2038,2041,2043,2045,2047,2048,2051,2053,2055,2057,2059,2060,2063,2065,2067,2069,2071,2073,2075,2076,2077,2079,2080,2081,2082,2083,2084,2084,2085,2086,2087,2087,2087,2087,2087,2086,2086,2085,2085,2084,2083,2082,2081,2080,2080,2079,2077,2076,2075,2074,2073,2071,2069,2068,2066,2064,2061,2059,2058,2056,2054,2052,2050,2048,2046,2044,2041,2039,2037,2036,2034,2032,2030,2029,2027,2026,2025,2023,2022,2021,2020,2019,2018,2017,2016,2016,2015,2015,2016,2016,2016,2015,2015,2016,2016,2017,2017,2017,2017,2017,2018,2018,2019,2020,2020,2021,2021,2022,2023,2024,2025,2026,2027,2028,2029,2029,2029,2030,2031,2032,2033,2034,2035,2036,2037,2038,2039,2040,2041,2041,2042,2043,2045,2046,2046,2047,2048,2049,2050,2050,2051,2052,2053,2054,2054,2055,2055,2056,2057,2057,2057,2058,2058,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2058,2058,2058,2058,2057,2057,2057,2058,2058,2058,2058,2058,2057,2057,2057,2056,2056,2056,2056,2056,2057,2057,2056,2056,2056,2056,2056,2056,2056,2055,2054,2054,2054,2054,2054,2054,2054,2053,2053,2053,2052,2052,2052,2051,2051,2050,2049,2048,2047,2046,2046,2045,2045,2045,2045,2044,2044,2044,2043,2043,2042,2042,2041,2041,2040,2039,2039,2038,2038,2038,2037,2037,2036,2036,2035,2034,2033,2032,2031,2031,2031,2030,2030,2030,2030,2030,2031,2031,2031,2032,2032,2033,2033,2033,2033,2033,2033,2033,2033,2033,2033,2033,2033,2033,2034,2034,2034,2034,2034,2034,2035,2035,2035,2035,2036,2036,2035,2034,2034,2033,2032,2031,2030,2029,2029,2028,2027,2026,2026,2026,2025,2025,2025,2025,2026,2026,2027,2028,2029,2030,2032,2034,2036,2037,2039,2040,2043,2045,2047,2048,2050,2052,2053,2054,2056,2057,2059,2061,2062,2063,2064,2064,2065,2066,2066,2067,2067,2067,2068,2068,2068,2068,2069,2069,2068,2067,2067,2066,2066,2065,2064,2063,2062,2061,2060,2059,2058,2058,2057,2056,2056,2055,2054,2053,2053,2053,2052,2051,2051,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2053,2053,2053,2054,2054,2055,2055,2056,2056,2056,2057,2058,2058,2059,2059,2059,2059,2059,2059,2060,2060,2060,2060,2061,2061,2061,2061,2061,2061,2060,2060,2060,2060,2060,2059,2060,2060,2060,2060,2059,2059,2059,2058,2058,2058,2058,2057,2056,2055,2054,2054,2053,2053,2052,2051,2051,2050,2049,2049,2048,2048,2047,2047,2046,2046,2045,2044,2044,2043,2042,2041,2040,2039,2039,2038,2037,2036,2035,2034,2033,2032,2032,2031,2031,2031,2031,2031,2030,2030,2030,2030,2029,2029,2028,2028,2028,2028,2028,2028,2028,2028,2028,2028,2028,2029,2029,2029,2029,2029,2029,2030,2030,2031,2031,2032,2033,2034,2035,2035,2036,2037,2037,2038,2038,2038,2038,2039,2040,2041,2041,2042,2042,2043,2043,2043,2044,2044,2045,2045,2046,2046,2046,2047,2048,2049,2049,2050,2050,2050,2051,2051,2051,2051,2051,2051,2052,2053,2053,2053,2054,2054,2055,2055,2056,2056,2056,2056,2056,2056,2056,2056,2056,2056,2056,2057,2057,2058,2058,2058,2058,2059,2059,2059,2060,2060,2060,2060,2061,2062,2062,2063,2063,2063,2063,2062,2062,2062,2062,2062,2062,2062,2062,2062,2062,2062,2062,2062,2062,2062,2062,2063,2063,2062,2062,2062,2062,2062,2063,2063,2062,2062,2062,2063,2063,2063,2063,2062,2062,2061,2061,2061,2061,2061,2061,2061,2060,2060,2061,2061,2060,2060,2060,2060,2060,2059,2059,2059,2058,2058,2058,2057,2057,2056,2056,2056,2056,2056,2055,2054,2054,2054,2054,2054,2054,2053,2053,2053,2053,2053,2052,2052,2051,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2047,2047,2046,2046,2046,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2046,2046,2045,2045,2046,2046,2046,2046,2046,2046,2046,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2046,2046,2046,2046,2047,2047,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2051,2051,2050,2050,2050,2050,2050,2050,2050,2049,2050,2050,2050,2050,2050,2050,2050,2051,2051,2050,2050,2050,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2050,2050,2049,2049,2049,2050,2050,2050,2049,2049,2050,2049,2049,2049,2049,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2044,2045,2045,2044,2044,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2045,2044,2044,2045,2044,2044,2044,2043,2043,2043,2043,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2051,2051,2051,2050,2051,2050,2050,2050,2050,2050,2050,2050,2050,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2050,2050,2050,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2050,2050,2050,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2050,2050,2049,2049,2049,2049,2049,2049,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2049,2049,2049,2049,2050,2050,2049,2049,2050,2050,2050,2050,2050,2050,2051,2051,2051,2050,2050,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2050,2050,2051,2051,2051,2051,2050,2051,2051,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2051,2051,2050,2050,2050,2051,2051,2050,2050,2050,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2049,2048,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2046,2046,2046,2047,2047,2047,2046,2046,2046,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2046,2045,2046,2046,2046,2046,2046,2046,2046,2047,2046,2046,2046,2046,2046,2046,2046,2046,2045,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2049,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2047,2047,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2051,2051,2051,2050,2050,2050,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2049,2050,2050,2050,2050,2050,2050,2049,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2049,2049,2049,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2048,2049,2049,2049,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2049,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2046,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2053,2053,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2048,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2049,2049,2049,2049,2050,2050,2050,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2050,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2046,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2046,2046,2046,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2047,2047,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2048,2049,2049,2049,2049,2048,2048,2049,2049,2048,2048,2048,2048,2049,2049,2048,2048,2048,2049,2049,2048,2048,2049,2049,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2047,2048,2048,2048,2047,2047,2047,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2047,2047,2047,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2049,2049,2048,2048,2048,2048,2048,2049,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2048,2047,2047,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2047,2047,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2049,2049,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2047,2047,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2047,2047,2047,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2047,2047,2048,2048,2047,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2047,2046,2046,2047,2047,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2049,2048,2047,2048,2049,2049,2048,2048,2049,2049,2049,2048,2046,2047,2048,2048,2049,2050,2050,2050,2049,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2047,2048,2048,2047,2047,2048,2048,2049,2049,2047,2046,2047,2048,2048,2048,2048,2047,2046,2047,2048,2048,2048,2048,2048,2046,2046,2047,2048,2049,2048,2047,2047,2048,2049,2050,2051,2049,2048,2047,2046,2047,2048,2049,2049,2049,2048,2048,2046,2045,2047,2050,2050,2050,2050,2049,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2049,2050,2048,2047,2047,2048,2049,2050,2051,2050,2048,2048,2049,2049,2047,2046,2045,2045,2047,2047,2047,2048,2048,2047,2046,2047,2048,2048,2047,2045,2044,2045,2046,2047,2048,2048,2048,2047,2047,2047,2048,2046,2045,2045,2046,2046,2046,2047,2047,2048,2047,2046,2047,2049,2050,2050,2050,2050,2049,2050,2050,2049,2049,2049,2046,2045,2047,2048,2048,2050,2049,2047,2047,2047,2047,2049,2048,2049,2050,2049,2047,2047,2047,2047,2049,2047,2045,2047,2046,2048,2057,2053,2030,2024,2057,2112,2148,2106,1961,1802,1768,1891,2092,2274,2374,2379,2313,2207,2092,1989,1912,1856,1817,1791,1773,1767,1778,1808,1857,1921,1994,2067,2136,2197,2249,2286,2313,2329,2334,2326,2314,2296,2272,2247,2222,2195,2167,2138,2111,2088,2070,2056,2043,2026,2004,1975,1942,1909,1882,1864,1855,1855,1860,1868,1878,1888,1895,1900,1900,1896,1892,1889,1884,1878,1873,1869,1864,1860,1860,1864,1871,1878,1888,1902,1916,1931,1947,1963,1981,2003,2026,2047,2067,2087,2107,2124,2141,2160,2179,2196,2212,2228,2241,2252,2265,2276,2285,2293,2299,2303,2305,2307,2309,2311,2312,2311,2308,2302,2297,2294,2291,2288,2283,2276,2270,2266,2262,2257,2252,2245,2237,2231,2223,2213,2204,2195,2188,2180,2171,2160,2149,2137,2126,2117,2105,2093,2080,2065,2049,2035,2022,2005,1989,1975,1961,1947,1935,1921,1907,1892,1879,1867,1854,1839,1824,1810,1798,1786,1775,1765,1755,1745,1736,1727,1720,1714,1710,1706,1702,1699,1696,1693,1691,1690,1690,1692,1694,1697,1701,1705,1708,1712,1720,1730,1740,1748,1756,1764,1774,1785,1796,1808,1819,1831,1843,1853,1864,1877,1891,1905,1920,1934,1947,1958,1971,1985,1999,2013,2027,2041,2054,2068,2082,2095,2107,2119,2130,2140,2151,2163,2177,2188,2198,2205,2213,2222,2231,2240,2247,2255,2262,2269,2275,2282,2288,2293,2297,2300,2303,2307,2310,2312,2315,2319,2325,2329,2332,2334,2335,2335,2335,2334,2332,2331,2331,2330,2328,2325,2323,2320,2318,2316,2314,2311,2309,2306,2303,2300,2297,2296,2295,2293,2291,2289,2287,2285,2283,2281,2280,2281,2282,2284,2285,2285,2286,2287,2287,2287,2286,2287,2287,2288,2287,2287,2286,2285,2283,2281,2278,2275,2271,2265,2260,2255,2250,2245,2238,2230,2222,2213,2204,2194,2183,2173,2161,2150,2139,2127,2115,2103,2090,2076,2062,2048,2035,2022,2008,1994,1980,1965,1951,1937,1923,1910,1897,1883,1870,1857,1844,1832,1819,1808,1797,1786,1775,1765,1755,1746,1737,1728,1720,1712,1705,1698,1692,1686,1681,1676,1672,1668,1665,1661,1659,1657,1655,1654,1653,1652,1652,1653,1654,1655,1656,1658,1660,1662,1665,1668,1671,1674,1678,1682,1686,1690,1695,1699,1704,1708,1713,1719,1724,1729,1734,1739,1745,1750,1756,1761,1767,1772,1778,1783,1789,1794,1800,1805,1811,1816,1821,1827,1832,1838,1843,1849,1854,1860,1865,1871,1876,1882,1888,1893,1899,1905,1910,1916,1922,1928,1934,1940,1946,1952,1958,1965,1971,1977,1984,1991,1997,2004,2011,2018,2025,2032,2039,2046,2054,2061,2069,2076,2084,2092,2099,2107,2115,2123,2131,2139,2147,2155,2163,2172,2180,2188,2196,2204,2212,2221,2229,2237,2245,2253,2260,2268,2276,2284,2291,2299,2306,2313,2320,2327,2334,2341,2347,2353,2359,2366,2371,2377,2382,2387,2392,2397,2401,2405,2410,2413,2417,2420,2423,2425,2428,2431,2432,2434,2436,2437,2438,2439,2439,2439,2439,2439,2438,2437,2436,2434,2433,2431,2429,2427,2424,2420,2417,2414,2411,2408,2403,2398,2393,2390,2385,2379,2375,2369,2363,2358,2353,2347,2341,2336,2327,2319,2313,2308,2302,2295,2285,2276,2272,2267,2258,2249,2241,2235,2231,2226,2216,2206,2199,2192,2184,2177,2169,2160,2154,2148,2139,2132,2128,2122,2114,2105,2096,2088,2084,2081,2073,2065,2057,2048,2042,2039,2034,2028,2020,2010,2005,2003,2000,1993,1985,1977,1974,1969,1960,1950,1949,1951,1950,1943,1931,1923,1924,1926,1922,1912,1897,1889,1898,1908,1897,1878,1879,1887,1881,1868,1863,1862,1861,1861,1858,1855,1853,1845,1839,1843,1842,1831,1828,1829,1819,1811,1820,1827,1818,1808,1803,1803,1808,1811,1801,1789,1790,1799,1797,1784,1780,1791,1797,1791,1783,1777,1773,1783,1791,1777,1765,1772,1774,1767,1775,1788,1779,1767,1771,1780,1786,1789,1786,1781,1776,1772,1781,1799,1794,1773,1779,1811,1817,1793,1778,1785,1802,1816,1819,1808,1792,1797,1826,1845,1834,1817,1818,1821,1824,1837,1843,1838,1847,1864,1867,1870,1878,1872,1864,1873,1878,1872,1875,1879,1882,1905,1930,1930,1927,1933,1929,1931,1944,1939,1928,1946,1961,1953,1964,1992,1993,1982,1983,1987,1998,2027,2045,2037,2014,2000,2023,2068,2077,2055,2055,2064,2050,2051,2087,2109,2102,2103,2111,2104,2095,2116,2146,2132,2094,2107,2145,2132,2102,2115,2133,2144,2190,2239,2249,2244,2214,2153,2134,2157,2145,2133,2163,2168,2171,2258,2334,2310,2285,2281,2243,2247,2296,2257,2205,2275,2319,2250,2259,2349,2321,2244,2294,2374,2348,2307,2333,2344,2289,2247,2283,2340,2377,2433,2458,2348,2211,2203,2257,2278,2322,2385,2407,2427,2443,2407,2380,2383,2356,2349,2375,2303,2202,2263,2370,2367,2361,2376,2320,2284,2304,2265,2268,2392,2390,2246,2266,2400,2386,2311,2300,2262,2224,2254,2274,2300,2372,2327,2166,2131,2211,2231,2221,2221,2186,2192,2274,2316,2337,2410,2419,2316,2233,2162,2038,2000,2137,2277,2281,2229,2208,2177,2115,2108,2147,2117,2109,2248,2283,2055,1957,2147,2187,2026,2047,2126,2010,1988,2150,2143,2013,1998,1945,1880,2078,2341,2359,2282,2187,1995,1931,2041,1976,1741,1627,1631,1764,2060,2231,2181,2155,2038,1749,1688,1844,1858,1878,1864,1545,1589,2195,1998,1179,1736,2902,2268,1016,1402,2229,2273,2548,2509,966,22,1517,3284,3370,2599,1670,991,1692,3088,2849,1046,0,257,1144,1738,1929,2353,3321,3837,3264,2550,2344,2112,1648,1203,651,95,34,389,675,835,1149,1837,2757,3309,3171,2760,2401,1937,1405,1041,849,816,1018,1305,1478,1527,1466,1281,1021,806,896,1392,1865,1954,1920,1995,2042,2150,2457,2620,2431,2228,2142,1895,1445,1014,704,585,782,1245,1626,1598,1302,1133,1010,609,200,236,510,783,1370,2244,2785,2880,3007,3185,2954,2253,1513,1050,831,734,768,969,1267,1593,1897,2068,2126,2272,2518,2637,2556,2450,2556,3013,3529,3460,2683,1812,1186,582,49,0,340,905,1628,2443,3088,3455,3617,3578,3348,2955,2276,1367,781,905,1216,930,226,23,496,766,405,199,730,1300,1239,1214,1993,2914,2990,2600,2734,3356,3742,3686,3326,2532,1349,407,204,519,1009,1800,2932,3692,3282,1964,816,400,462,785,1369,1915,2072,2037,2196,2528,2804,3011,3308,3716,3965,3825,3523,3343,3120,2713,2392,2228,1959,1604,1306,942,568,452,461,343,316,596,1026,1530,2154,2746,3202,3607,3866,3768,3404,3029,2659,2174,1634,1252,1089,1014,952,958,1011,991,883,837,952,1100,1180,1401,1911,2405,2621,2804,3207,3654,3873,3841,3747,3743,3754,3680,3629,3611,3417,3060,2759,2535,2283,2008,1775,1638,1556,1429,1311,1275,1212,1170,1375,1695,1813,1780,1766,1712,1635,1764,2141,2439,2478,2602,2994,3153,2914,2945,3410,3613,3347,3045,2849,2703,2656,2561,2302,2113,2138,2172,2087,2076,2343,2740,3018,3229,3447,3535,3521,3477,3210,2798,2589,2429,2101,1953,2053,1955,1749,1876,2159,2234,2276,2540,2810,2830,2874,3254,3621,3612,3538,3633,3683,3669,3622,3319,2923,2758,2487,1876,1520,1710,1918,1826,1696,1766,1927,1920,1807,1880,2039,2073,2149,2281,2289,2332,2478,2540,2612,2741,2677,2492,2399,2332,2377,2639,2762,2595,2495,2559,2617,2650,2588,2485,2620,2846,2821,2731,2816,2938,2979,2954,2965,3027,2854,2456,2305,2313,2109,2088,2463,2600,2443,2549,2743,2749,2792,2747,2590,2734,2934,2878,2930,2998,2821,2770,2829,2736,2721,2746,2708,2858,2900,2571,2481,2677,2476,2160,2327,2503,2341,2268,2282,2266,2422,2345,1892,1878,2263,2446,2532,2331,1975,2398,2794,1956,1443,2303,2821,2477,2335,2164,2025,2817,3338,2326,1552,2145,2550,2034,1447,1435,1871,1999,2104,3121,3520,1985,1235,2871,3745,2170,1133,2315,3127,1992,1024,1828,3286,3763,2856,1492,693,655,1137,1522,1835,2966,3823,2857,1964,2757,3471,3012,2136,1383,1240,1798,2046,1261,403,797,1629,1441,1107,1631,2269,2856,3556,3612,3100,2744,2389,2052,2116,2131,1922,2070,2114,1459,991,952,712,712,976,1006,1498,2297,2470,2758,3480,3739,3704,3780,3846,3859,3482,2892,2640,2283,1543,992,795,559,95,0,498,630,319,443,693,818,1065,1045,1072,1628,1975,2002,2282,2461,2272,2339,2900,3123,2707,2654,3000,3069,3287,2988,1411,1020,2632,3076,2168,2579,3450,2655,1170,423,277,776,1800,2294,1987,1429,771,393,573,833,1059,1288,1187,850,594,637,917,835,517,593,870,1269,1618,1363,1262,1905,2479,2951,3372,3189,2983,3020,2605,2036,1640,1089,594,401,457,700,864,982,1215,1312,1237,1254,1510,1843,1883,1899,2228,2310,2157,2472,2866,2739,2517,2506,2406,2107,1809,1559,1254,907,573,383,375,222,28,198,273,10,20,196,108,139,471,765,953,1224,1592,1803,1919,2329,2785,2827,2685,2587,2386,2132,2111,2250,2127,1934,2142,2298,2156,2269,2342,1937,1657,1663,1575,1479,1372,1183,1056,910,721,593,468,393,314,97,11,132,213,335,461,444,593,888,885,811,1006,1176,1270,1482,1572,1534,1668,1759,1670,1752,1997,2229,2435,2395,2256,2468,2688,2596,2626,2758,2718,2835,3084,2985,2741,2827,3045,2987,2811,2843,2870,2649,2421,2215,1858,1619,1571,1399,1276,1444,1566,1493,1450,1454,1543,1829,2049,2009,2013,2161,2170,2061,2004,1921,1865,1910,1819,1612,1609,1665,1489,1298,1323,1377,1299,1204,1178,1135,1037,941,872,794,703,728,958,1197,1311,1487,1720,1837,1973,2202,2329,2382,2477,2446,2225,2034,1949,1882,1845,1828,1750,1686,1670,1518,1317,1391,1593,1548,1348,1323,1502,1638,1592,1539,1627,1708,1692,1748,1935,2061,2027,1952,1872,1742,1683,1736,1677,1475,1388,1449,1461,1426,1522,1715,1763,1682,1765,2009,2127,2126,2209,2353,2461,2519,2477,2388,2425,2574,2595,2368,2128,2194,2444,2535,2556,2722,2835,2769,2782,2965,3041,2926,2925,3057,2904,2583,2594,2651,2366,2182,2265,2255,2226,2249,2209,2364,2655,2662,2632,2782,2749,2618,2645,2614,2523,2475,2289,2148,2275,2356,2318,2371,2370,2268,2308,2490,2606,2550,2466,2607,2808,2745,2627,2665,2619,2509,2600,2672,2491,2439,2655,2641,2447,2606,2808,2693,2748,2883,2681,2637,2638,2191,2335,3058,2654,2152,3209,3541,1998,1599,3034,3755,3309,2695,2016,1786,2468,3305,3724,3757,3214,2257,1621,1589,1845,2280,2898,3150,2739,2557,3032,3053,2205,1605,1794,2273,2710,2986,2890,2346,1678,1510,1972,2409,2459,2482,2680,2836,2827,2729,2532,2155,1833,1861,1963,1793,1688,2064,2604,2678,2267,1994,2147,2363,2340,2129,1952,1972,1989,1919,2077,2196,2010,2379,3114,2512,1301,1888,3362,3137,1667,926,1298,2178,2951,3126,2841,2683,2611,2098,1681,2359,3180,2702,1808,1627,1684,1842,2278,2563,2796,2997,2511,1858,2041,2599,2978,3332,3401,3082,2902,2977,3042,3108,3233,3320,3273,3128,2888,2335,1630,1388,1626,2103,3032,3936,3980,3599,3265,2508,1470,833,805,1328,1924,2259,2845,3533,3545,3269,3204,3023,2846,2884,2917,3067,3231,3090,3080,3413,3657,3798,3746,3411,3486,3815,3354,2688,2771,2793,2319,2092,2126,2215,2589,2782,2457,2279,2317,2026,1762,1945,2069,1895,1861,2042,2114,2010,1873,1834,1874,1823,1733,1750,1686,1520,1564,1754,1880,1978,1965,1945,2214,2488,2483,2553,2784,2866,2862,2883,2806,2676,2593,2495,2465,2620,2793,2847,2842,2702,2433,2292,2231,1998,1716,1626,1644,1529,1318,1281,1355,1276,1148,1130,1194,1328,1366,1268,1297,1415,1475,1570,1673,1790,1886,1736,1629,1906,2159,2184,2215,2228,2248,2303,2230,2164,2201,2104,1940,1970,2103,2130,2087,2088,2085,2066,2056,1908,1662,1519,1429,1391,1286,913,845,1318,1411,1096,1151,1156,638,325,755,1493,1776,1315,614,259,388,1014,1951,2492,2214,1749,1566,1145,455,240,762,1793,2450,1891,1375,2243,3162,3023,2608,2090,1160,378,218,482,781,1094,1844,2805,2992,2217,1386,1143,1187,1010,621,291,363,1045,1959,2668,3124,3187,2807,2200,1516,1007,786,590,423,385,313,320,608,1033,1442,1869,2393,2781,2705,2504,2453,2162,1762,1703,1777,1895,2211,2441,2456,2501,2586,2542,2264,1759,1219,854,706,683,702,743,732,634,478,283,207,325,405,385,422,548,790,1110,1369,1614,1903,2235,2680,3094,3284,3323,3280,3175,3038,2820,2659,2667,2569,2350,2342,2411,2256,2057,1970,1862,1822,1987,2023,1646,1211,1162,1339,1294,978,705,570,443,364,364,309,201,145,123,123,194,277,289,331,463,495,464,699,1045,1077,1013,1267,1641,1798,1830,1895,1964,2069,2262,2423,2501,2565,2593,2598,2637,2690,2743,2769,2815,2970,3041,2944,2934,2948,2853,2846,2850,2730,2669,2566,2286,2089,2004,1828,1655,1577,1379,1046,981,1202,1149,765,532,540,651,789,855,925,1037,1014,884,872,1115,1431,1458,1364,1499,1629,1652,1780,1891,1947,2096,2221,2254,2240,2157,2111,2171,2277,2385,2433,2393,2259,2144,2266,2399,2285,2232,2275,2223,2290,2400,2358,2455,2728,2966,3140,3092,2908,2927,3025,3019,3024,3062,3087,3091,3024,2872,2777,2954,3257,3323,3228,3179,3216,3403,3494,3214,2789,2481,2577,3234,3843,3886,3554,3039,2643,2666,2878,3109,3425,3713,3861,3652,2969,2241,1855,1906,2414,2997,3267,3301,3162,2923,2840,2865,2700,2336,1973,1647,1550,2196,3325,3771,3304,2949,3193,3231,2328,1420,1881,3055,3459,2952,1987,1190,1360,2045,2114,1637,1351,1598,2273,2830,2904,2827,2984,3268,3403,3313,3090,2812,2550,2273,1851,1378,1125,1222,1571,1875,1892,1745,1813,2331,2960,3090,2802,2707,2925,3094,2979,2673,2413,2229,2015,1800,1645,1672,2008,2410,2536,2475,2489,2617,2648,2441,2274,2313,2195,1878,1857,2113,2304,2633,3183,3347,2720,1642,835,878,1598,2196,2167,1633,1163,1365,2137,2755,2835,2570,2236,1845,1281,782,816,1346,1930,2417,2871,3112,2969,2676,2481,2226,1719,1141,844,908,1137,1496,1984,2243,2087,1807,1562,1337,1175,1079,1126,1412,1829,2126,1977,1411,936,729,697,1012,1563,1953,2184,2346,2305,2047,1839,2014,2448,2586,2285,1878,1524,1212,1027,1089,1423,2000,2649,2912,2612,2209,2071,2243,2627,2706,2227,1756,1650,1729,1794,1597,1131,725,548,707,1243,1860,2288,2458,2361,2058,1620,1236,1115,1093,1017,1053,1268,1549,1810,2118,2581,2989,3089,2965,2734,2561,2555,2435,2132,1992,2099,2356,2624,2669,2641,2839,3110,3158,2943,2645,2432,2313,2341,2473,2403,2078,1693,1314,1087,1146,1403,1754,2083,2265,2237,1964,1662,1564,1633,1930,2362,2508,2442,2502,2573,2561,2517,2401,2325,2340,2290,2194,2084,1844,1567,1505,1652,1789,1905,2183,2541,2724,2686,2538,2374,2127,1713,1362,1265,1285,1370,1433,1262,1055,1148,1458,1746,1850,1820,1870,1936,1849,1783,1933,2263,2634,2831,2791,2732,2763,2771,2759,2867,3048,3069,2900,2769,2817,2947,3014,2993,2910,2754,2618,2669,2887,3084,3108,2930,2645,2364,2150,2071,2130,2265,2382,2330,2064,1764,1604,1633,1851,2160,2433,2634,2703,2596,2434,2325,2182,1990,1893,1949,2136,2420,2654,2749,2820,2964,3161,3288,3176,2850,2528,2323,2277,2457,2820,3135,3108,2672,2049,1499,1199,1206,1369,1446,1305,1022,827,841,987,1175,1327,1399,1454,1531,1605,1701,1819,1884,1900,1973,2132,2340,2599,2838,2904,2830,2740,2660,2655,2753,2854,2926,2940,2803,2540,2223,1916,1750,1709,1675,1660,1665,1620,1540,1455,1363,1312,1354,1467,1606,1790,2019,2196,2277,2319,2394,2572,2795,2901,2885,2853,2869,2928,2937,2887,2893,2948,2966,2909,2771,2668,2656,2612,2536,2507,2480,2447,2408,2287,2093,1902,1814,1922,2117,2188,2051,1739,1367,1072,927,960,1144,1449,1845,2165,2214,1956,1506,1073,787,643,678,904,1226,1561,1801,1887,1961,2143,2380,2603,2736,2709,2564,2404,2267,2083,1845,1700,1698,1706,1661,1611,1573,1546,1533,1509,1476,1515,1634,1704,1645,1524,1449,1482,1616,1791,1963,2081,2098,2051,1992,1905,1774,1602,1397,1201,1097,1094,1110,1130,1182,1223,1203,1108,943,801,750,724,674,633,620,633,637,605,567,550,587,717,909,1109,1286,1364,1295,1108,878,714,680,738,826,909,1002,1136,1281,1364,1363,1331,1322,1334,1372,1426,1416,1329,1236,1154,1110,1176,1298,1372,1405,1434,1445,1437,1424,1417,1416,1391,1333,1312,1378,1488,1607,1745,1882,1992,2061,2072,2051,2038,2019,1970,1891,1811,1794,1865,1973,2096,2235,2328,2316,2231,2141,2087,2083,2079,2025,1998,2073,2181,2262,2327,2362,2398,2467,2506,2466,2382,2318,2346,2473,2620,2709,2714,2671,2658,2708,2798,2911,3031,3117,3141,3134,3123,3042,2876,2754,2737,2747,2762,2851,2981,3024,2960,2875,2786,2673,2591,2591,2660,2750,2812,2812,2755,2686,2639,2590,2550,2587,2686,2770,2810,2789,2687,2537,2424,2424,2516,2614,2662,2647,2612,2604,2607,2601,2586,2540,2489,2491,2516,2486,2401,2327,2280,2225,2190,2219,2298,2404,2472,2428,2329,2253,2181,2113,2087,2120,2216,2322,2352,2297,2209,2148,2124,2119,2146,2193,2213,2193,2127,2044,2002,1979,1947,1939,1956,1993,2089,2263,2456,2538,2451,2322,2250,2200,2169,2191,2253,2314,2329,2299,2256,2196,2146,2157,2214,2252,2248,2247,2285,2306,2264,2198,2138,2098,2099,2127,2158,2199,2254,2288,2253,2162,2091,2077,2095,2116,2152,2238,2345,2391,2383,2401,2457,2490,2460,2421,2426,2442,2433,2419,2397,2362,2363,2414,2472,2528,2591,2609,2561,2493,2418,2376,2430,2514,2534,2515,2491,2456,2429,2424,2435,2462,2507,2571,2611,2581,2509,2433,2384,2409,2465,2473,2431,2380,2354,2367,2396,2428,2457,2452,2411,2376,2358,2353,2367,2395,2388,2312,2233,2225,2285,2365,2405,2388,2351,2279,2152,2041,2017,2080,2167,2187,2127,2064,2047,2082,2131,2135,2107,2129,2222,2310,2318,2242,2138,2046,1988,1972,1971,1971,1987,2003,1984,1950,1940,1952,1967,1966,1948,1945,1971,1986,1977,1986,2012,2016,2012,2045,2090,2076,2014,1977,1985,2008,2021,1997,1942,1903,1928,2018,2103,2109,2075,2104,2195,2249,2189,2050,1940,1932,1998,2071,2108,2104,2087,2104,2167,2221,2209,2154,2135,2172,2205,2183,2147,2143,2140,2114,2101,2122,2151,2173,2170,2131,2091,2095,2131,2153,2135,2108,2088,2041,1979,1950,1941,1942,1985,2060,2123,2133,2073,2003,1984,2003,2023,2030,2056,2139,2225,2239,2185,2102,2036,2009,1999,1997,2012,2053,2104,2095,2034,2016,2027,2046,2115,2151,2110,2068,1997,1888,1837,1834,1847,1904,1964,2019,2067,2034,1966,1956,1946,1894,1870,1905,1951,1973,1995,2035,2063,2091,2111,2036,1901,1874,1935,1800,1400,1204,1531,1978,2136,2132,2113,1976,1616,1110,815,1103,1832,2458,2587,2185,1450,721,352,468,935,1544,2056,2273,2248,2176,2209,2442,2770,2916,2771,2404,1907,1387,903,506,317,286,244,288,599,1071,1539,1993,2422,2800,3127,3341,3376,3234,2901,2369,1721,1057,487,200,316,695,1046,1152,975,669,462,466,631,837,959,952,916,988,1229,1616,2012,2223,2149,1868,1624,1663,1994,2409,2688,2725,2571,2355,2199,2219,2434,2698,2855,2840,2663,2414,2172,1926,1643,1334,1045,807,617,504,489,493,434,310,176,118,169,301,501,723,875,915,817,623,501,556,732,985,1347,1831,2363,2793,2985,2902,2634,2333,2091,1974,2057,2299,2554,2705,2664,2410,2082,1880,1912,2137,2337,2261,1847,1258,752,509,530,720,982,1220,1360,1376,1275,1135,1045,964,816,655,591,696,977,1301,1482,1514,1551,1713,1996,2317,2575,2691,2656,2514,2319,2149,2112,2237,2430,2570,2589,2528,2470,2405,2278,2088,1880,1729,1673,1670,1654,1555,1300,914,530,287,253,464,898,1366,1637,1670,1516,1254,1090,1122,1261,1490,1816,2115,2266,2228,2089,2019,2071,2227,2474,2706,2834,2874,2842,2777,2717,2648,2620,2671,2726,2747,2738,2676,2561,2399,2209,2049,1935,1874,1906,2010,2105,2122,2057,1976,1918,1862,1815,1800,1836,1898,1913,1880,1833,1746,1659,1694,1859,2106,2389,2584,2581,2386,2072,1760,1568,1561,1741,2012,2223,2284,2203,2056,1909,1811,1834,1968,2084,2124,2127,2117,2106,2083,2028,1981,1989,2068,2226,2413,2540,2577,2534,2421,2255,2103,2052,2113,2228,2353,2466,2555,2613,2621,2584,2551,2564,2619,2679,2736,2823,2921,3000,3049,2987,2829,2775,2873,2984,3102,3280,3387,3267,3025,2887,2886,2930,2996,3045,3011,2963,3003,3067,2980,2692,2380,2227,2265,2473,2783,2994,2919,2603,2274,2099,2082,2179,2371,2599,2792,2889,2841,2662,2426,2221,2122,2173,2366,2639,2891,3049,3094,3037,2923,2788,2676,2658,2754,2896,2988,2960,2829,2691,2599,2566,2633,2778,2871,2839,2747,2673,2619,2579,2589,2661,2743,2784,2784,2752,2708,2700,2744,2809,2913,3057,3154,3123,2985,2836,2744,2692,2656,2668,2756,2908,3043,3037,2871,2665,2554,2594,2730,2856,2928,2939,2911,2888,2865,2836,2853,2915,2952,2956,2959,2959,2960,2946,2873,2754,2674,2678,2727,2773,2807,2816,2742,2585,2465,2457,2533,2653,2743,2739,2714,2724,2680,2552,2447,2448,2537,2635,2678,2661,2602,2510,2394,2274,2202,2235,2356,2502,2630,2703,2710,2703,2684,2613,2543,2521,2514,2534,2583,2608,2624,2645,2607,2509,2423,2393,2427,2491,2563,2649,2682,2613,2501,2394,2310,2268,2250,2253,2291,2319,2308,2295,2287,2265,2250,2264,2283,2268,2221,2182,2165,2169,2213,2294,2360,2379,2351,2300,2257,2233,2246,2336,2459,2547,2617,2670,2656,2605,2570,2555,2562,2571,2559,2543,2518,2488,2477,2455,2392,2309,2234,2189,2163,2135,2120,2121,2115,2095,2059,2042,2074,2101,2100,2115,2134,2132,2128,2136,2159,2198,2231,2247,2253,2258,2268,2278,2272,2249,2237,2253,2268,2261,2240,2195,2132,2086,2067,2065,2091,2145,2176,2134,2049,1997,1993,2017,2055,2073,2060,2045,2035,2026,2029,2035,2019,1998,2000,2014,2040,2090,2123,2092,2027,1975,1940,1927,1949,1966,1921,1873,1906,1949,1907,1837,1800,1765,1720,1695,1710,1746,1775,1780,1734,1648,1601,1614,1630,1639,1671,1724,1770,1772,1740,1717,1705,1696,1694,1697,1696,1688,1684,1682,1667,1659,1666,1663,1647,1621,1589,1584,1587,1560,1539,1542,1543,1532,1510,1506,1540,1559,1556,1559,1529,1477,1469,1491,1498,1501,1522,1556,1572,1562,1544,1520,1499,1488,1480,1481,1481,1459,1429,1403,1373,1359,1367,1379,1388,1394,1395,1390,1368,1351,1359,1389,1427,1436,1403,1380,1381,1368,1343,1320,1310,1337,1386,1419,1441,1460,1456,1429,1404,1381,1352,1340,1369,1411,1433,1439,1448,1444,1411,1384,1404,1451,1490,1506,1488,1460,1453,1455,1464,1476,1465,1444,1439,1436,1439,1458,1470,1462,1451,1443,1439,1438,1443,1452,1454,1448,1442,1436,1426,1410,1402,1408,1415,1414,1403,1390,1393,1399,1396,1401,1407,1406,1417,1437,1469,1516,1537,1530,1527,1523,1525,1541,1540,1521,1507,1500,1500,1500,1504,1512,1501,1468,1439,1416,1402,1398,1390,1383,1373,1370,1403,1431,1417,1409,1436,1453,1432,1413,1441,1491,1506,1486,1462,1458,1464,1453,1442,1448,1445,1453,1490,1492,1447,1419,1419,1420,1431,1448,1449,1448,1449,1451,1473,1497,1467,1418,1422,1464,1486,1474,1466,1483,1488,1492,1513,1491,1451,1473,1490,1461,1496,1596,1609,1512,1460,1487,1475,1463,1535,1552,1500,1555,1625,1549,1480,1515,1536,1537,1571,1551,1478,1515,1654,1717,1717,1764,1782,1711,1648,1633,1599,1527,1457,1400,1356,1362,1419,1473,1542,1660,1774,1859,1920,1937,1938,1967,1968,1872,1715,1601,1548,1500,1459,1447,1452,1488,1571,1670,1771,1882,1989,2073,2133,2184,2210,2192,2147,2092,2040,2003,1957,1897,1863,1852,1847,1855,1861,1857,1837,1788,1737,1717,1716,1698,1642,1584,1555,1518,1485,1510,1553,1560,1573,1648,1779,1924,2057,2171,2266,2360,2449,2515,2590,2687,2760,2797,2813,2802,2779,2767,2744,2682,2597,2531,2497,2459,2404,2344,2270,2174,2072,1985,1921,1875,1829,1759,1677,1637,1642,1632,1605,1605,1628,1651,1677,1710,1755,1802,1839,1889,1964,2033,2087,2146,2194,2211,2233,2292,2356,2397,2435,2479,2513,2533,2546,2553,2569,2601,2635,2664,2676,2670,2678,2696,2690,2684,2703,2701,2671,2669,2685,2672,2654,2647,2597,2530,2525,2542,2511,2477,2486,2498,2482,2451,2422,2405,2386,2359,2342,2338,2330,2316,2298,2259,2209,2202,2232,2242,2238,2240,2208,2150,2141,2186,2208,2188,2173,2183,2186,2174,2187,2241,2283,2270,2226,2188,2165,2166,2207,2271,2320,2335,2314,2283,2287,2319,2337,2360,2418,2462,2444,2409,2414,2426,2396,2361,2387,2456,2484,2460,2447,2443,2406,2391,2452,2515,2514,2495,2495,2490,2469,2450,2433,2416,2406,2398,2385,2377,2377,2378,2388,2401,2402,2398,2404,2403,2379,2340,2303,2306,2341,2347,2323,2326,2347,2343,2329,2323,2313,2297,2281,2261,2256,2278,2306,2321,2327,2334,2338,2329,2320,2317,2300,2260,2229,2236,2263,2260,2235,2245,2282,2294,2287,2284,2284,2297,2310,2298,2282,2271,2236,2210,2236,2274,2278,2264,2265,2277,2263,2227,2225,2254,2248,2215,2213,2251,2284,2286,2291,2325,2347,2347,2353,2338,2298,2297,2318,2314,2311,2332,2357,2367,2330,2269,2268,2319,2355,2371,2367,2330,2301,2305,2325,2360,2394,2388,2339,2289,2288,2342,2402,2417,2387,2364,2405,2467,2460,2389,2336,2350,2424,2474,2439,2395,2388,2359,2323,2336,2363,2389,2425,2429,2409,2419,2431,2422,2425,2443,2449,2437,2424,2447,2496,2502,2468,2466,2493,2478,2422,2406,2452,2479,2470,2479,2487,2484,2523,2560,2534,2512,2533,2553,2547,2499,2457,2490,2522,2481,2458,2499,2551,2612,2646,2600,2553,2555,2530,2489,2523,2614,2692,2730,2728,2695,2647,2601,2561,2539,2562,2607,2626,2640,2652,2643,2634,2617,2592,2615,2662,2650,2614,2620,2637,2655,2694,2686,2619,2610,2662,2678,2651,2617,2612,2642,2660,2650,2643,2641,2635,2621,2601,2598,2620,2636,2615,2594,2625,2665,2653,2632,2654,2667,2636,2621,2632,2635,2677,2723,2653,2535,2504,2581,2703,2722,2615,2582,2676,2737,2695,2621,2570,2559,2583,2610,2587,2535,2530,2574,2612,2624,2618,2631,2690,2734,2682,2589,2548,2518,2480,2485,2494,2460,2438,2457,2474,2470,2477,2535,2631,2681,2643,2576,2530,2494,2461,2442,2437,2409,2341,2297,2294,2303,2360,2418,2420,2460,2549,2585,2582,2596,2615,2580,2476,2385,2353,2334,2282,2198,2155,2174,2189,2196,2224,2261,2300,2341,2421,2512,2503,2429,2395,2393,2416,2441,2420,2382,2359,2327,2243,2094,1963,1929,1939,1916,1885,1903,1948,1979,2013,2078,2178,2264,2282,2289,2313,2304,2290,2302,2311,2318,2318,2293,2250,2211,2205,2183,2110,2078,2087,2060,2015,1992,2000,2020,2017,1993,1926,1837,1799,1778,1748,1767,1799,1766,1716,1739,1812,1840,1830,1831,1840,1840,1832,1878,1941,1916,1889,1894,1869,1907,1952,1936,1954,1894,1812,1879,1888,1845,1849,1756,1726,1780,1695,1672,1748,1753,1779,1802,1819,1881,1830,1709,1668,1685,1740,1735,1688,1727,1750,1703,1671,1655,1636,1627,1677,1722,1626,1503,1495,1561,1622,1613,1609,1610,1519,1488,1535,1493,1420,1383,1462,1617,1602,1564,1641,1582,1465,1483,1531,1534,1492,1514,1622,1624,1509,1420,1417,1443,1372,1333,1440,1464,1396,1419,1495,1523,1466,1413,1447,1486,1530,1599,1607,1554,1460,1365,1334,1340,1355,1356,1339,1375,1444,1419,1298,1302,1434,1359,1274,1509,1616,1455,1427,1465,1465,1438,1368,1468,1586,1485,1444,1486,1443,1311,1117,1171,1433,1440,1296,1226,1236,1363,1393,1308,1314,1305,1339,1439,1347,1232,1298,1378,1422,1388,1258,1291,1499,1540,1496,1581,1480,1229,1193,1135,1127,1367,1327,1177,1304,1262,1238,1401,1279,1219,1364,1242,1194,1431,1350,930,1061,1721,1584,838,901,1508,1856,1735,1253,1043,798,520,1461,2607,2476,1726,768,583,1443,1295,618,666,348,592,1954,2207,1676,2083,3023,3250,1989,448,80,350,1151,2092,1781,970,763,675,721,1059,1530,2062,2380,2768,3252,3079,2435,1712,834,280,181,173,314,536,758,1169,1544,1634,1777,2095,2166,2093,2362,2625,2408,1957,1528,1307,1381,1461,1420,1215,828,740,1258,2032,2593,2765,2760,2622,2095,1391,926,733,729,862,1143,1519,1739,1748,1668,1491,1241,948,609,358,265,209,185,314,484,509,559,767,963,1129,1396,1712,1998,2309,2640,2820,2858,2972,3078,2968,2705,2428,2308,2417,2489,2337,2117,2032,2054,2011,1936,1973,2130,2380,2524,2352,2115,2154,2368,2395,2136,1845,1610,1447,1486,1492,1405,1531,1577,1321,1161,1050,848,825,860,666,377,247,291,304,269,326,337,220,236,486,693,690,739,936,987,905,913,974,1007,1021,1148,1451,1664,1698,1783,1934,2042,2139,2300,2456,2480,2573,2842,2952,2931,3067,3228,3263,3238,3278,3482,3645,3640,3654,3607,3435,3348,3253,3104,3144,3179,2956,2779,2787,2762,2663,2560,2511,2476,2288,2067,2043,2028,1852,1696,1635,1563,1483,1502,1530,1360,1186,1274,1359,1271,1243,1314,1346,1389,1541,1672,1599,1472,1488,1527,1591,1718,1679,1559,1651,1726,1563,1427,1493,1633,1742,1796,1766,1681,1689,1786,1830,1921,2113,2209,2194,2113,1967,2019,2315,2503,2487,2387,2322,2428,2517,2386,2314,2480,2627,2607,2600,2768,3019,3180,3205,3118,2971,2853,2894,3099,3199,3201,3392,3501,3292,3234,3409,3455,3468,3513,3456,3463,3559,3517,3443,3578,3715,3517,3278,3374,3435,3263,3280,3452,3485,3442,3326,3215,3313,3404,3317,3251,3206,3140,3187,3222,3143,3196,3282,3073,2939,3217,3328,3001,2768,2811,2978,3126,3050,3039,3269,3189,2942,3027,2954,2641,2611,2529,2293,2485,2814,2686,2403,2384,2470,2449,2447,2426,2214,2139,2286,2198,2102,2324,2410,2288,2294,2356,2417,2396,2180,2117,2273,2225,2133,2317,2410,2248,2341,2668,2536,2136,2259,2564,2438,2304,2403,2447,2431,2309,2169,2327,2549,2638,2800,2951,2963,2831,2636,2585,2541,2558,2826,2822,2637,2870,3062,3010,2949,2666,2578,2784,2596,2424,2683,2878,3000,3027,2823,2827,3031,3016,2857,2841,3029,3118,2933,2800,2783,2758,2850,2963,2975,2903,2755,2819,2979,2875,2948,3052,2686,2726,3102,2845,2780,2919,2419,2494,3035,2565,2264,2789,2842,2588,2586,2683,2860,2728,2445,2527,2506,2409,2692,2864,2784,2783,2701,2596,2692,2797,2786,2718,2660,2665,2668,2652,2615,2523,2591,2786,2699,2556,2634,2537,2373,2423,2377,2325,2405,2441,2641,2786,2522,2421,2586,2563,2568,2597,2399,2315,2442,2535,2618,2648,2617,2604,2393,2206,2505,2703,2399,2322,2531,2459,2270,2272,2365,2270,2100,2337,2695,2748,2741,2571,2330,2416,2324,2045,2261,2560,2447,2289,2388,2630,2617,2302,2108,2125,2236,2385,2364,2155,2043,2145,2308,2444,2479,2315,2204,2274,2286,2219,2145,2289,2598,2413,2103,2333,2429,2251,2269,2269,2207,2113,2058,2196,2236,2362,2494,2125,1990,2189,2048,2106,2335,2363,2428,2141,1927,2365,2452,2142,2207,2378,2286,1957,1842,2097,2177,2140,2109,2018,2166,2195,1960,1934,1822,1594,1607,1645,1685,1769,1901,2062,1893,1662,1711,1746,1932,2174,1906,1552,1725,2050,1925,1580,1559,1705,1825,1862,1719,1797,1896,1608,1676,2008,1918,1931,2061,1860,1635,1508,1548,1737,1659,1654,2168,2433,2005,1767,2002,1952,1732,1673,1457,1536,1973,1864,1581,1715,1768,1656,1593,1605,1684,1668,1668,1707,1574,1550,1790,1916,1693,1486,1732,1845,1547,1658,1837,1537,1528,1673,1472,1560,1894,1908,1809,1703,1509,1549,1861,1876,1526,1536,1979,2108,1840,1766,1897,1803,1732,1968,1951,1665,1634,1570,1526,1897,2072,1890,1881,1863,1823,1945,1879,1737,1776,1664,1544,1811,2079,1997,1901,1973,1911,1706,1712,1858,1903,2010,2160,2146,2204,2435,2386,2047,2005,2131,1795,1448,1706,1892,1709,1753,1827,1742,1913,1975,1689,1746,2078,2071,1992,2198,2408,2427,2312,2076,1987,2286,2477,2120,1729,1766,1843,1738,1821,1912,1588,1446,1730,1723,1721,2170,2360,2234,2154,1852,1601,1659,1660,1686,1803,1934,2246,2239,1654,1315,1437,1608,1776,1934,2102,2132,1903,1817,1820,1545,1222,871,684,1281,2127,2306,1936,1638,1838,1928,1428,1303,1596,1495,1533,1894,1953,1731,1302,1070,1402,1543,1380,1597,1900,1776,1343,1106,1399,1625,1366,1267,1631,1974,1968,1676,1285,1004,1107,1506,1713,1714,1694,1410,1102,1369,1841,1882,1640,1283,902,902,1299,1643,1575,1275,1452,1847,1630,1465,1726,1534,1236,1446,1555,1399,1296,1267,1365,1474,1411,1267,1340,1690,1821,1711,1794,1762,1511,1458,1403,1244,1323,1470,1462,1585,1837,1786,1523,1414,1322,1301,1513,1644,1724,1851,1750,1637,1632,1407,1230,1471,1828,1883,1687,1535,1498,1560,1607,1588,1885,2262,2025,1666,1745,1793,1595,1511,1650,1556,1250,1508,1947,1834,1764,1818,1602,1579,1768,1798,1777,1876,2158,2246,1992,1938,1886,1598,1640,1807,1745,1865,2066,2073,2069,1967,1714,1587,1646,1761,1817,1731,1684,1912,2122,2010,1995,2173,1955,1709,2149,2473,2129,1996,2127,1927,1795,1885,1840,1946,2227,2213,2084,2159,2172,1976,1836,1869,2020,2298,2483,2378,2178,1965,1814,1917,2069,2068,2008,1999,2120,2151,2061,2192,2235,1936,1891,2219,2299,2037,2062,2376,2233,1929,2068,2211,2318,2505,2405,2334,2373,2108,1849,1699,1672,2101,2388,2143,2072,2224,2080,1862,1954,2086,2084,2286,2491,2291,2109,2096,1791,1543,1888,2195,1996,1995,2289,2259,2125,2106,2038,2104,2176,2113,2074,1943,1885,1911,1721,1664,1783,1794,1816,1761,1864,2196,2234,2324,2485,2137,1847,1809,1584,1386,1338,1616,2077,2180,2224,2150,1743,1702,1805,1657,1803,1991,1877,1804,1839,1924,1917,1836,1850,1680,1453,1550,1662,1645,1686,1719,1699,1758,1885,1835,1733,1808,1712,1552,1665,1693,1654,1666,1480,1412,1578,1615,1602,1677,1840,1915,1720,1508,1399,1426,1592,1517,1489,1803,1809,1566,1509,1456,1459,1515,1585,1776,1692,1396,1432,1574,1556,1543,1613,1671,1551,1464,1562,1560,1634,1847,1708,1507,1593,1490,1291,1391,1393,1221,1359,1611,1649,1746,1913,1870,1653,1438,1390,1458,1429,1400,1431,1465,1592,1634,1517,1524,1638,1744,1748,1559,1502,1609,1565,1572,1671,1589,1497,1544,1617,1648,1599,1577,1628,1676,1777,1843,1767,1705,1718,1725,1676,1593,1635,1767,1739,1625,1686,1904,2068,2010,1765,1583,1624,1738,1773,1833,1908,1800,1662,1714,1779,1838,2053,2188,2147,2157,2069,1817,1750,1857,1942,2066,2139,2064,2002,1992,1960,1930,1955,2047,2115,2111,2136,2151,2094,2128,2219,2216,2268,2376,2314,2177,2118,2114,2171,2232,2270,2313,2280,2236,2256,2260,2311,2381,2365,2382,2403,2402,2492,2492,2410,2476,2510,2434,2436,2479,2510,2516,2515,2576,2581,2547,2616,2634,2556,2538,2571,2596,2548,2511,2636,2725,2634,2583,2677,2765,2696,2606,2731,2832,2701,2632,2692,2710,2717,2677,2614,2683,2770,2759,2770,2810,2811,2787,2760,2777,2787,2712,2676,2744,2811,2849,2844,2814,2815,2793,2766,2777,2763,2811,2891,2816,2770,2853,2852,2878,2981,2920,2791,2791,2850,2894,2864,2799,2825,2860,2806,2783,2844,2879,2842,2805,2797,2779,2777,2850,2936,2914,2812,2768,2790,2771,2711,2715,2801,2836,2784,2799,2880,2866,2804,2788,2769,2726,2671,2638,2699,2766,2734,2713,2760,2783,2751,2704,2711,2777,2752,2642,2642,2721,2732,2733,2757,2741,2725,2723,2663,2607,2665,2745,2725,2665,2649,2662,2663,2642,2646,2670,2628,2558,2563,2602,2594,2566,2587,2646,2649,2615,2632,2650,2625,2599,2590,2598,2572,2501,2485,2517,2544,2584,2572,2526,2555,2574,2536,2527,2490,2451,2508,2547,2505,2486,2501,2510,2495,2459,2440,2439,2451,2482,2488,2469,2455,2440,2458,2483,2449,2407,2401,2406,2403,2371,2356,2385,2383,2362,2365,2375,2417,2430,2350,2322,2371,2358,2343,2379,2341,2255,2284,2382,2379,2317,2309,2290,2262,2296,2311,2284,2275,2254,2268,2325,2283,2213,2248,2271,2244,2265,2288,2266,2275,2313,2292,2265,2284,2241,2178,2234,2274,2224,2248,2301,2282,2263,2229,2186,2214,2227,2175,2159,2212,2252,2205,2155,2207,2243,2195,2182,2207,2199,2180,2171,2191,2188,2123,2119,2192,2211,2188,2184,2181,2159,2128,2117,2115,2108,2148,2205,2196,2151,2124,2133,2161,2150,2122,2127,2137,2143,2145,2134,2113,2075,2069,2101,2075,2060,2121,2136,2115,2124,2131,2156,2131,2046,2071,2131,2100,2099,2101,2065,2075,2062,2063,2147,2120,2030,2069,2101,2055,2051,2081,2097,2094,2111,2154,2118,2056,2040,1953,1900,2002,2049,2031,2084,2072,1999,2015,2042,2032,2046,2061,2059,2058,2027,1984,1988,2012,2007,2005,2030,2028,2007,2010,2009,2009,2041,2063,2030,1982,1985,2034,2080,2116,2110,2044,2019,2045,2026,2013,2030,1995,1968,1991,1993,1984,1985,1989,2024,2053,2036,2018,2010,2003,2015,2041,2066,2042,1978,1989,2042,2020,2009,2051,2024,1964,1970,1987,1987,1991,1979,1966,1969,1955,1944,1957,1978,2008,2012,1987,1999,2003,1953,1951,1988,1971,1946,1933,1910,1911,1914,1908,1929,1942,1939,1953,1965,1963,1946,1924,1945,1967,1958,1968,1962,1925,1931,1933,1885,1865,1875,1879,1899,1926,1928,1905,1878,1873,1876,1870,1874,1876,1864,1869,1879,1865,1851,1874,1912,1917,1904,1903,1896,1883,1885,1894,1906,1903,1880,1878,1878,1843,1837,1877,1887,1863,1851,1844,1832,1823,1820,1816,1820,1829,1828,1824,1822,1825,1839,1845,1843,1855,1841,1806,1809,1818,1805,1806,1803,1787,1792,1798,1785,1781,1790,1787,1791,1818,1824,1793,1790,1814,1794,1761,1772,1778,1755,1751,1760,1732,1685,1687,1736,1760,1739,1718,1711,1704,1694,1696,1722,1734,1704,1687,1688,1666,1666,1700,1716,1720,1712,1691,1695,1706,1697,1697,1699,1684,1677,1686,1696,1702,1711,1716,1708,1697,1687,1680,1687,1695,1687,1689,1723,1745,1719,1691,1686,1681,1700,1732,1727,1710,1709,1709,1711,1712,1708,1701,1707,1732,1733,1711,1712,1715,1708,1706,1695,1693,1704,1714,1733,1729,1697,1686,1689,1693,1698,1690,1695,1707,1714,1748,1777,1762,1752,1767,1770,1754,1745,1741,1733,1744,1750,1731,1728,1730,1724,1746,1761,1749,1765,1786,1769,1755,1764,1768,1753,1749,1765,1768,1755,1753,1751,1736,1729,1736,1734,1720,1725,1733,1731,1735,1735,1731,1740,1741,1739,1738,1720,1705,1701,1702,1711,1710,1701,1696,1678,1669,1688,1701,1711,1727,1718,1701,1704,1708,1712,1719,1706,1691,1692,1685,1676,1675,1673,1667,1675,1694,1695,1685,1704,1713,1692,1697,1707,1701,1714,1724,1721,1731,1726,1712,1710,1715,1737,1747,1733,1738,1750,1759,1778,1775,1769,1787,1793,1789,1787,1784,1799,1799,1778,1790,1804,1790,1812,1848,1836,1821,1829,1825,1817,1820,1826,1835,1838,1840,1848,1842,1835,1847,1860,1875,1879,1864,1862,1866,1853,1854,1857,1834,1823,1846,1869,1863,1848,1855,1867,1863,1875,1900,1891,1865,1858,1855,1850,1855,1850,1836,1832,1825,1827,1844,1844,1837,1842,1843,1837,1833,1838,1838,1816,1808,1820,1816,1807,1795,1789,1806,1793,1773,1790,1790,1794,1809,1793,1809,1812,1770,1818,1821,1719,1808,1909,1738,1674,1854,1895,1784,1755,1799,1831,1834,1838,1832,1787,1771,1820,1848,1819,1804,1835,1841,1797,1786,1829,1855,1855,1863,1871,1857,1838,1847,1879,1898,1885,1851,1830,1845,1876,1887,1882,1893,1903,1904,1920,1932,1924,1928,1940,1944,1950,1963,1983,1977,1939,1942,1981,1984,1971,1985,2001,1986,1975,2020,2057,2008,1947,1973,2051,2059,1974,1947,2030,2084,2057,2016,1993,2011,2055,2079,2095,2109,2077,2020,2024,2076,2069,2019,2019,2048,2054,2059,2065,2059,2048,2047,2073,2120,2159,2164,2131,2101,2097,2082,2048,2032,2035,2031,2021,2019,2045,2094,2111,2097,2125,2165,2153,2137,2139,2128,2117,2104,2090,2088,2082,2091,2116,2120,2123,2145,2154,2137,2112,2116,2156,2173,2146,2128,2143,2160,2161,2175,2204,2197,2161,2139,2137,2130,2113,2108,2122,2143,2167,2194,2221,2239,2231,2213,2204,2194,2183,2163,2138,2143,2173,2187,2181,2174,2183,2210,2232,2224,2206,2218,2248,2248,2229,2216,2208,2204,2206,2214,2234,2243,2226,2208,2204,2211,2212,2198,2192,2194,2191,2209,2239,2236,2213,2206,2213,2216,2220,2233,2249,2249,2238,2254,2274,2252,2234,2254,2268,2274,2273,2238,2211,2220,2233,2255,2271,2248,2237,2259,2258,2249,2258,2244,2216,2229,2264,2255,2209,2193,2221,2241,2242,2249,2248,2234,2228,2228,2246,2275,2259,2230,2251,2260,2239,2269,2315,2311,2294,2284,2266,2254,2243,2221,2208,2212,2227,2247,2263,2281,2303,2307,2291,2272,2253,2243,2252,2253,2246,2256,2266,2258,2258,2263,2250,2234,2235,2239,2244,2259,2264,2252,2250,2263,2272,2280,2280,2261,2248,2257,2254,2227,2217,2223,2216,2216,2246,2274,2284,2285,2275,2263,2260,2261,2268,2284,2287,2279,2275,2271,2253,2235,2234,2233,2227,2230,2230,2219,2226,2245,2256,2264,2270,2261,2256,2261,2255,2250,2259,2257,2253,2264,2265,2256,2251,2238,2242,2269,2271,2249,2235,2234,2249,2253,2232,2237,2255,2246,2251,2267,2246,2233,2269,2303,2301,2268,2233,2231,2244,2247,2260,2276,2268,2257,2262,2257,2236,2235,2254,2266,2256,2237,2234,2261,2281,2268,2252,2270,2284,2262,2250,2263,2266,2265,2268,2253,2238,2241,2244,2242,2240,2228,2214,2224,2260,2271,2253,2262,2285,2261,2232,2250,2271,2259,2239,2232,2229,2220,2225,2239,2234,2213,2206,2211,2208,2211,2231,2224,2196,2203,2221,2229,2246,2232,2204,2221,2214,2174,2189,2211,2188,2186,2197,2200,2214,2215,2208,2206,2188,2181,2185,2179,2203,2235,2220,2211,2231,2219,2197,2206,2208,2192,2197,2222,2238,2228,2202,2204,2229,2228,2212,2204,2193,2193,2203,2198,2194,2193,2185,2192,2208,2212,2205,2186,2182,2195,2188,2181,2181,2164,2166,2185,2187,2192,2174,2130,2127,2158,2192,2208,2175,2158,2180,2149,2112,2137,2156,2150,2141,2131,2140,2142,2135,2153,2144,2106,2116,2133,2125,2140,2152,2128,2107,2101,2103,2111,2113,2107,2105,2118,2124,2103,2084,2098,2122,2119,2093,2086,2108,2120,2106,2092,2104,2121,2103,2082,2098,2099,2068,2065,2081,2080,2067,2063,2078,2092,2075,2035,2022,2056,2085,2076,2076,2083,2067,2059,2053,2030,2030,2054,2082,2104,2101,2090,2087,2088,2116,2142,2130,2135,2148,2121,2094,2080,2060,2058,2072,2086,2086,2061,2059,2079,2063,2041,2053,2075,2101,2123,2123,2104,2081,2083,2094,2075,2056,2047,2039,2069,2096,2070,2052,2057,2047,2050,2072,2083,2096,2101,2092,2091,2082,2057,2057,2084,2106,2113,2099,2071,2061,2073,2065,2017,1975,1992,2034,2054,2079,2103,2070,2028,2042,2053,2019,1978,1965,1993,2022,2019,2022,2042,2044,2042,2050,2042,2017,2007,2025,2030,2014,2029,2057,2048,2027,1996,1979,2029,2072,2049,2057,2117,2148,2138,2098,2083,2135,2153,2068,1994,2014,2072,2104,2113,2119,2103,2071,2068,2088,2103,2118,2115,2088,2074,2059,2035,2055,2099,2088,2053,2055,2058,2044,2057,2086,2088,2099,2132,2118,2071,2068,2075,2048,2027,2028,2035,2061,2070,2037,2028,2084,2150,2155,2116,2109,2131,2108,2058,2036,2027,2028,2045,2039,2015,2013,2029,2057,2089,2094,2084,2083,2079,2078,2086,2067,2014,1985,2007,2043,2049,2033,2022,2016,2014,2019,2025,2028,2036,2051,2056,2055,2071,2080,2057,2040,2052,2057,2054,2059,2052,2022,1984,1963,1989,2036,2053,2036,2008,1996,2018,2044,2049,2063,2074,2051,2026,2026,2025,2011,1995,1982,1981,1998,2022,2036,2026,1992,1951,1930,1946,1999,2048,2056,2042,2037,2037,2048,2076,2093,2084,2077,2079,2075,2069,2055,2023,1992,1966,1948,1955,1976,1991,2007,2022,2003,1956,1933,1963,2009,2032,2040,2048,2051,2055,2065,2060,2046,2044,2037,2017,2018,2048,2071,2076,2067,2036,2005,2007,2030,2047,2066,2082,2078,2056,2027,2001,1979,1960,1947,1945,1946,1961,2000,2023,2007,1978,1955,1939,1939,1951,1968,1995,2006,1983,1962,1960,1958,1964,1991,2014,2033,2053,2058,2062,2063,2027,1979,1955,1934,1927,1962,1996,2011,2020,2004,1979,1988,2019,2052,2076,2073,2061,2059,2045,2023,2004,1978,1961,1949,1934,1955,1986,1973,1974,1997,1970,1963,2023,2033,1995,2006,2013,1961,1918,1906,1899,1897,1906,1932,1965,1976,1986,2021,2044,2042,2048,2044,2019,2021,2046,2020,1957,1921,1909,1924,1996,2067,2093,2126,2146,2097,2041,2027,2014,2007,2017,2008,2003,2040,2084,2084,2029,1968,1950,1947,1942,1975,2013,2003,1989,2010,2039,2045,2026,2017,2029,2025,2011,2003,1981,1988,2043,2056,2034,2059,2075,2042,2036,2035,1991,1981,2016,1995,1938,1942,1990,2022,2050,2071,2053,2031,2066,2098,2037,1946,1930,1957,1945,1943,2032,2076,1963,1917,2015,2001,1931,2038,2131,2083,2111,2165,2094,2046,2064,2026,1965,1931,1924,1946,1954,1970,2044,2094,2123,2149,2077,2020,2112,2161,2117,2101,2002,1869,1915,1979,1936,1973,2061,2083,2092,2093,2126,2177,2064,1924,1965,1983,1911,1900,1894,1902,1947,1916,1923,2044,2058,1985,1996,2019,2002,1992,1949,1873,1838,1874,1950,1978,1946,1986,2042,1952,1907,2041,2087,1985,1922,1879,1823,1782,1769,1848,1924,1940,2054,2185,2168,2132,2110,2054,2028,1956,1859,1883,1871,1812,1914,1990,1928,1983,2085,2049,1979,1905,1872,1970,2015,1911,1858,1950,2066,2070,2034,2102,2164,2131,2076,1982,1883,1831,1815,1886,1967,2009,2070,2050,2076,2229,2142,1958,2015,2040,2023,2071,1995,1932,1940,1957,2113,2138,1985,2054,2148,2052,1973,1946,1989,2013,1943,1993,2018,1926,1990,2049,1966,1910,1886,1990,2086,1961,1962,2071,1986,1975,2053,1987,2048,2247,2095,1814,2041,2167,1768,2046,2481,1476,835,1863,2463,2489,2899,2636,2193,2621,2552,1688,1084,426,0,702,2128,3206,3808,3656,2872,2784,3694,3783,2160,497,247,753,934,688,303,217,918,2069,2851,3161,3416,3725,3746,3381,3153,3063,2405,1288,439,129,255,399,249,296,1168,2532,3389,3443,3348,3518,3802,3752,2819,1376,444,279,667,1370,2008,2576,3179,3577,3647,3409,2863,2204,1765,1607,1315,732,307,159,112,321,737,1075,1486,2246,3088,3578,3806,3798,3187,2172,1240,547,445,953,1517,2039,2439,2454,2482,2734,2681,2470,2853,3432,3313,2966,2813,2358,2170,2549,2172,1148,698,679,933,1431,1671,1963,2356,2071,1446,1418,1866,1895,1396,1498,2380,2982,3036,2442,1312,845,878,404,294,750,488,69,504,840,645,892,1630,2068,2140,2259,2644,3228,3620,3623,3634,3804,3621,2986,2625,2732,2632,2236,2125,2408,2777,2930,2749,2490,2447,2819,3394,3267,2305,1471,1014,680,545,467,507,921,1253,1234,1343,1566,1484,1215,968,665,443,521,834,1182,1243,1083,1285,1684,1802,2009,2447,2950,3501,3468,3042,3337,3603,2869,2199,2235,2420,2407,2254,2521,3344,3820,3470,2785,2646,3223,3396,2943,2817,2798,2582,2637,2692,2564,2387,1908,1717,2101,2147,2018,1973,1441,1128,1223,727,673,1716,1827,765,514,1167,1342,819,533,760,856,954,1336,1295,948,1000,1104,1331,2199,2922,2749,2361,2625,3353,3588,2958,1905,787,149,571,1496,1942,1766,1326,929,633,338,247,628,1220,1563,1702,1992,2392,2550,2356,1988,1633,1261,837,635,740,877,1062,1414,1812,2145,2301,2450,2954,3446,3507,3520,3625,3516,3165,2653,2220,2113,2053,1885,1904,2193,2573,2821,3012,3488,3910,3687,3245,3211,3379,3323,2966,2576,2428,2381,2198,1914,1625,1303,918,663,661,656,570,586,620,635,746,813,819,1029,1460,1820,1935,2042,2364,2577,2499,2457,2585,2810,3075,3162,3018,2835,2744,2777,2767,2600,2440,2260,2011,1908,1873,1706,1479,1306,1359,1533,1352,938,759,719,629,536,500,552,499,351,557,985,1117,1096,1160,1213,1330,1532,1573,1433,1359,1371,1240,1057,1138,1369,1462,1516,1701,1943,2084,2123,2210,2276,2235,2339,2504,2353,2174,2347,2512,2379,2208,2196,2258,2330,2432,2484,2452,2526,2715,2809,2889,3028,3047,3062,3268,3450,3436,3367,3386,3435,3325,3093,2971,2888,2715,2628,2673,2677,2593,2439,2305,2342,2389,2187,1838,1615,1613,1673,1590,1452,1417,1409,1393,1420,1456,1502,1529,1537,1672,1837,1839,1838,1845,1715,1739,2047,2266,2294,2309,2345,2384,2391,2403,2513,2590,2573,2619,2688,2736,2876,3021,3105,3245,3318,3182,3081,3174,3240,3148,3050,3041,3023,2941,2859,2842,2875,2826,2625,2459,2470,2473,2347,2286,2358,2325,2119,1954,1931,1926,1841,1757,1792,1813,1640,1438,1381,1381,1378,1337,1247,1254,1302,1221,1173,1242,1209,1069,993,1023,1087,1067,1021,1095,1165,1131,1130,1199,1278,1329,1337,1408,1562,1628,1619,1701,1845,1903,1825,1746,1842,2009,2041,2049,2179,2251,2144,2041,2070,2182,2325,2400,2321,2177,2090,2107,2226,2336,2296,2106,1927,1918,1971,1936,1967,2099,2084,1952,1887,1875,1899,1937,1949,1979,2002,1970,1903,1798,1741,1759,1719,1714,1829,1850,1768,1720,1678,1682,1749,1792,1823,1779,1662,1687,1808,1815,1748,1694,1720,1833,1852,1770,1760,1788,1781,1778,1787,1816,1883,1960,2008,2023,2086,2187,2217,2229,2272,2241,2171,2157,2181,2257,2363,2452,2536,2578,2576,2591,2607,2640,2708,2743,2763,2781,2753,2758,2790,2754,2748,2820,2852,2846,2881,2966,3056,3121,3198,3236,3141,3015,2979,3031,3185,3338,3355,3341,3381,3382,3328,3271,3238,3248,3266,3262,3245,3201,3148,3101,3054,3066,3143,3157,3100,3095,3104,3009,2909,2947,3023,3010,2967,2952,2950,2983,2996,2884,2724,2675,2689,2669,2695,2806,2860,2823,2800,2787,2737,2681,2624,2568,2576,2627,2604,2500,2449,2483,2494,2469,2479,2480,2394,2302,2310,2330,2262,2213,2237,2219,2164,2136,2062,1984,2017,2062,2000,1887,1803,1757,1713,1692,1753,1771,1630,1512,1576,1683,1700,1642,1523,1391,1372,1462,1484,1387,1312,1335,1388,1410,1412,1433,1431,1355,1290,1309,1330,1322,1321,1294,1254,1278,1311,1272,1246,1288,1301,1247,1206,1218,1250,1291,1355,1433,1452,1397,1379,1440,1491,1513,1540,1553,1545,1517,1463,1425,1452,1500,1516,1565,1697,1770,1699,1632,1650,1683,1721,1749,1738,1769,1873,1929,1893,1863,1876,1876,1862,1880,1921,1977,2050,2076,2061,2080,2099,2089,2127,2199,2233,2226,2200,2193,2200,2168,2133,2164,2244,2337,2400,2372,2299,2284,2314,2331,2370,2454,2498,2498,2549,2604,2579,2554,2568,2567,2562,2572,2598,2645,2673,2688,2716,2711,2678,2680,2707,2752,2803,2819,2828,2832,2803,2798,2823,2825,2845,2888,2893,2883,2892,2914,2952,2980,2983,2985,2998,3022,3024,2980,2956,2991,3023,3009,2965,2959,3030,3085,3061,3022,3000,2991,3008,3028,3015,2981,2960,2972,2980,2955,2959,3005,3009,2965,2937,2927,2916,2916,2918,2905,2897,2910,2888,2808,2759,2786,2816,2818,2844,2877,2849,2784,2759,2770,2766,2746,2732,2708,2673,2663,2671,2669,2657,2618,2561,2546,2543,2501,2485,2532,2559,2528,2465,2415,2433,2456,2389,2318,2361,2444,2433,2330,2262,2283,2297,2273,2272,2268,2237,2236,2238,2194,2142,2110,2109,2130,2114,2074,2068,2049,2005,1993,1997,1972,1919,1863,1846,1869,1879,1861,1835,1821,1804,1746,1680,1671,1690,1683,1653,1618,1605,1599,1559,1512,1512,1536,1538,1503,1462,1451,1463,1479,1479,1428,1357,1346,1372,1371,1343,1294,1230,1189,1188,1210,1237,1244,1237,1248,1277,1308,1322,1293,1254,1242,1217,1170,1149,1132,1098,1075,1055,1045,1070,1075,1021,1001,1089,1217,1269,1231,1176,1149,1162,1205,1212,1139,1036,973,993,1061,1114,1165,1249,1369,1528,1655,1656,1573,1462,1318,1150,969,823,787,829,911,1055,1190,1275,1395,1509,1528,1580,1735,1811,1749,1698,1677,1579,1424,1316,1264,1206,1136,1154,1306,1471,1567,1654,1732,1746,1743,1760,1750,1722,1726,1742,1733,1702,1665,1644,1677,1753,1809,1842,1898,1949,1967,2011,2102,2171,2190,2199,2211,2184,2117,2077,2067,2026,1966,1944,1953,1977,2016,2054,2090,2134,2174,2222,2285,2326,2342,2351,2349,2344,2342,2324,2295,2264,2244,2267,2315,2350,2391,2426,2448,2509,2587,2612,2622,2641,2627,2603,2587,2550,2509,2481,2434,2394,2406,2446,2480,2500,2512,2533,2568,2605,2630,2633,2624,2631,2633,2605,2586,2599,2596,2578,2590,2608,2604,2607,2622,2628,2628,2626,2631,2653,2654,2617,2583,2569,2560,2564,2567,2540,2511,2503,2502,2517,2543,2534,2511,2523,2542,2535,2524,2515,2503,2498,2503,2505,2488,2447,2410,2393,2377,2341,2298,2288,2313,2316,2312,2343,2350,2308,2296,2316,2299,2255,2232,2225,2191,2131,2101,2102,2090,2076,2072,2051,2035,2046,2055,2060,2074,2065,2028,2001,1987,1963,1935,1926,1923,1905,1879,1846,1813,1799,1801,1813,1827,1812,1783,1802,1840,1835,1797,1767,1772,1788,1762,1732,1756,1774,1749,1722,1705,1693,1695,1703,1716,1711,1663,1625,1625,1626,1626,1617,1592,1600,1627,1620,1595,1568,1536,1518,1514,1520,1529,1515,1504,1519,1522,1521,1532,1514,1485,1478,1468,1457,1454,1449,1453,1447,1427,1435,1448,1436,1428,1423,1412,1417,1420,1422,1433,1414,1375,1370,1374,1368,1382,1402,1396,1378,1374,1376,1361,1344,1353,1367,1360,1365,1403,1412,1370,1355,1390,1404,1401,1414,1402,1381,1387,1374,1359,1377,1366,1361,1433,1453,1364,1341,1429,1502,1536,1552,1526,1486,1456,1374,1268,1279,1402,1495,1532,1561,1570,1584,1657,1714,1691,1660,1654,1614,1540,1469,1364,1227,1143,1153,1231,1352,1494,1663,1872,2054,2177,2282,2300,2156,1961,1806,1627,1410,1236,1135,1082,1080,1138,1229,1334,1483,1674,1867,2052,2234,2365,2409,2402,2377,2315,2208,2094,1994,1893,1777,1655,1547,1464,1398,1344,1313,1306,1322,1368,1458,1576,1684,1798,1963,2137,2266,2373,2465,2519,2558,2601,2617,2582,2521,2465,2393,2289,2186,2097,2008,1933,1862,1791,1745,1725,1722,1740,1769,1822,1907,1985,2046,2113,2175,2225,2262,2281,2298,2298,2273,2258,2231,2189,2188,2194,2165,2162,2185,2194,2225,2274,2289,2288,2316,2357,2377,2390,2421,2439,2437,2444,2442,2429,2429,2394,2329,2311,2305,2251,2180,2140,2154,2194,2206,2225,2286,2348,2416,2479,2484,2476,2501,2525,2548,2543,2473,2420,2434,2439,2396,2328,2267,2253,2252,2228,2235,2274,2284,2297,2341,2359,2352,2367,2389,2404,2420,2424,2421,2424,2419,2415,2432,2434,2405,2394,2407,2401,2380,2360,2323,2281,2271,2274,2265,2261,2266,2268,2294,2335,2339,2340,2380,2396,2388,2423,2446,2388,2345,2375,2392,2371,2352,2332,2314,2320,2317,2286,2265,2267,2264,2256,2256,2260,2266,2287,2326,2361,2370,2377,2407,2437,2431,2397,2379,2389,2388,2360,2336,2319,2294,2271,2253,2228,2201,2182,2170,2155,2146,2165,2198,2210,2209,2208,2197,2189,2189,2186,2192,2219,2254,2278,2284,2281,2273,2275,2294,2304,2291,2286,2294,2285,2264,2249,2231,2209,2196,2191,2192,2196,2205,2215,2216,2221,2225,2211,2203,2203,2171,2143,2145,2139,2132,2143,2146,2153,2171,2172,2168,2178,2179,2177,2180,2182,2182,2167,2153,2161,2167,2167,2170,2154,2144,2150,2131,2111,2108,2094,2099,2118,2108,2114,2151,2160,2153,2147,2146,2172,2177,2136,2124,2140,2130,2115,2116,2117,2114,2106,2105,2105,2086,2082,2097,2096,2097,2105,2094,2093,2115,2119,2112,2106,2098,2105,2110,2088,2073,2073,2056,2037,2040,2041,2033,2032,2045,2057,2055,2054,2062,2060,2049,2048,2036,2008,2002,2020,2031,2039,2045,2040,2047,2053,2028,2007,2013,2019,2022,2021,2016,2026,2034,2027,2037,2050,2035,2015,2004,1993,1990,1998,2010,2019,2013,2004,2010,2009,1989,1974,1976,1975,1964,1960,1960,1958,1967,1971,1945,1936,1986,2033,2011,1965,1951,1955,1949,1942,1950,1994,2059,2083,2069,2042,1947,1793,1685,1630,1617,1700,1851,2034,2275,2497,2597,2569,2410,2153,1893,1663,1470,1347,1300,1338,1461,1625,1796,1955,2083,2187,2258,2299,2343,2372,2370,2373,2376,2360,2325,2252,2143,2024,1866,1667,1486,1334,1218,1175,1205,1299,1470,1703,1959,2227,2505,2766,2973,3105,3155,3132,3043,2870,2613,2304,1965,1623,1315,1057,850,683,558,500,519,593,713,877,1093,1372,1685,2024,2403,2774,3092,3395,3671,3845,3913,3921,3872,3751,3572,3346,3072,2797,2571,2360,2131,1927,1761,1620,1508,1398,1271,1163,1084,1024,999,1008,1032,1080,1169,1278,1381,1491,1595,1658,1701,1751,1764,1745,1743,1741,1732,1762,1825,1884,1958,2073,2205,2326,2444,2567,2681,2766,2830,2888,2949,2992,2991,2972,2951,2903,2835,2770,2683,2586,2522,2459,2359,2274,2240,2217,2190,2185,2196,2216,2263,2308,2318,2327,2357,2368,2343,2304,2269,2242,2215,2181,2137,2094,2064,2048,2023,1992,1969,1944,1908,1875,1858,1856,1861,1865,1867,1880,1911,1935,1932,1918,1908,1884,1845,1805,1759,1714,1692,1683,1673,1680,1710,1746,1791,1851,1900,1930,1969,2022,2071,2117,2168,2220,2276,2335,2381,2418,2458,2498,2522,2523,2509,2486,2458,2420,2374,2344,2346,2356,2353,2347,2344,2347,2352,2350,2349,2355,2344,2321,2316,2313,2298,2298,2315,2314,2295,2288,2285,2269,2254,2246,2220,2191,2184,2174,2159,2172,2195,2201,2206,2221,2238,2263,2298,2327,2335,2334,2340,2328,2297,2286,2296,2289,2268,2255,2254,2250,2234,2221,2212,2196,2191,2193,2181,2168,2157,2127,2101,2097,2079,2028,1973,1937,1912,1883,1855,1833,1821,1827,1829,1815,1831,1867,1878,1894,1931,1949,1955,1966,1959,1944,1953,1957,1939,1941,1975,1975,1939,1937,1952,1941,1950,1984,1976,1949,1936,1911,1895,1911,1914,1886,1865,1867,1861,1832,1816,1827,1835,1828,1812,1803,1818,1823,1799,1803,1839,1846,1837,1855,1875,1870,1861,1885,1928,1947,1950,1951,1933,1919,1929,1929,1927,1943,1949,1939,1928,1920,1912,1906,1906,1919,1930,1935,1936,1925,1926,1945,1946,1937,1936,1934,1931,1923,1917,1943,1971,1964,1965,1995,2012,2014,2019,2032,2045,2046,2044,2047,2038,2029,2037,2048,2054,2058,2059,2061,2055,2048,2051,2040,2034,2058,2069,2059,2062,2056,2046,2068,2079,2049,2038,2058,2061,2047,2048,2057,2048,2035,2014,1984,1999,2045,2022,1974,1992,2006,1979,1979,1994,1974,1951,1954,1953,1932,1921,1930,1930,1922,1933,1939,1925,1918,1919,1921,1925,1923,1921,1919,1904,1893,1893,1888,1883,1884,1887,1892,1872,1839,1842,1854,1830,1807,1813,1821,1812,1796,1790,1792,1791,1788,1783,1781,1789,1794,1794,1799,1788,1765,1766,1768,1752,1744,1750,1753,1753,1749,1751,1762,1765,1755,1737,1722,1727,1738,1732,1732,1752,1772,1775,1755,1725,1713,1728,1755,1764,1749,1737,1737,1742,1757,1761,1747,1759,1795,1796,1781,1794,1815,1817,1819,1838,1850,1836,1817,1818,1831,1833,1825,1824,1836,1846,1846,1847,1844,1845,1852,1839,1814,1813,1828,1834,1841,1852,1857,1866,1884,1892,1883,1876,1880,1885,1888,1892,1892,1884,1873,1866,1872,1890,1903,1910,1921,1934,1942,1941,1930,1919,1921,1930,1936,1944,1954,1958,1963,1979,1995,1993,1985,1996,2014,2011,1998,2004,2028,2044,2040,2033,2026,2022,2026,2034,2034,2033,2038,2038,2036,2050,2064,2054,2046,2065,2085,2083,2080,2090,2094,2093,2099,2107,2106,2101,2096,2086,2075,2077,2094,2104,2099,2100,2119,2130,2112,2084,2075,2092,2123,2141,2133,2121,2122,2123,2106,2085,2090,2122,2154,2165,2159,2144,2127,2130,2155,2155,2120,2103,2126,2154,2183,2218,2226,2196,2167,2142,2111,2108,2148,2194,2237,2289,2316,2294,2250,2205,2159,2127,2119,2121,2125,2135,2146,2158,2179,2205,2229,2240,2237,2241,2256,2252,2215,2179,2164,2153,2138,2122,2102,2085,2082,2096,2125,2153,2168,2178,2187,2182,2175,2183,2189,2187,2197,2203,2175,2141,2135,2132,2121,2128,2144,2154,2174,2195,2190,2183,2198,2204,2189,2186,2197,2194,2181,2174,2165,2148,2124,2092,2064,2061,2067,2050,2019,2004,2005,2000,1993,1995,1991,1971,1963,1976,1989,1993,1998,1996,1984,1975,1973,1971,1974,1981,1989,2004,2025,2028,2020,2028,2042,2044,2054,2074,2086,2090,2095,2092,2086,2092,2099,2099,2100,2095,2082,2076,2072,2050,2025,2018,2012,1998,1993,1991,1977,1965,1961,1956,1954,1968,1974,1957,1951,1964,1966,1967,1978,1974,1952,1942,1950,1958,1956,1958,1963,1958,1952,1951,1948,1946,1946,1944,1936,1927,1928,1928,1921,1918,1916,1916,1927,1938,1941,1940,1943,1952,1953,1946,1946,1952,1966,1981,1985,1980,1975,1976,1984,1994,2009,2017,2017,2031,2045,2043,2058,2082,2087,2092,2117,2139,2143,2150,2171,2182,2179,2181,2184,2188,2198,2215,2230,2234,2247,2274,2277,2259,2266,2284,2270,2252,2255,2258,2254,2256,2261,2267,2262,2257,2271,2285,2287,2297,2304,2292,2285,2289,2295,2304,2326,2337,2317,2301,2308,2314,2320,2330,2336,2341,2344,2354,2377,2380,2361,2355,2367,2380,2371,2349,2345,2351,2351,2347,2341,2343,2350,2352,2354,2356,2362,2369,2355,2351,2375,2382,2370,2378,2393,2382,2370,2386,2388,2361,2365,2391,2394,2390,2392,2391,2386,2387,2408,2415,2398,2407,2418,2412,2419,2415,2406,2419,2421,2414,2424,2439,2442,2425,2416,2423,2427,2439,2446,2425,2424,2436,2427,2420,2420,2427,2435,2420,2408,2420,2433,2439,2414,2386,2392,2399,2406,2418,2396,2369,2371,2370,2347,2328,2325,2321,2317,2333,2336,2302,2270,2264,2276,2281,2261,2245,2226,2187,2165,2171,2183,2184,2177,2186,2193,2166,2138,2129,2116,2092,2073,2078,2082,2072,2053,2020,2015,2037,2024,2017,2015,1989,2015,2015,1947,2011,2076,1925,1874,2040,2041,1905,1923,1990,1969,1958,1979,1968,1946,1955,1972,1973,1974,1965,1941,1945,1957,1936,1929,1943,1946,1959,1952,1924,1942,1953,1908,1892,1902,1880,1874,1894,1902,1903,1901,1892,1898,1911,1899,1874,1863,1864,1863,1868,1889,1893,1862,1843,1864,1877,1865,1868,1885,1871,1832,1811,1821,1839,1851,1866,1882,1875,1841,1816,1817,1829,1845,1857,1845,1831,1838,1846,1853,1867,1870,1864,1863,1866,1872,1881,1880,1866,1865,1892,1913,1912,1909,1902,1892,1896,1906,1902,1891,1889,1897,1893,1883,1892,1904,1895,1893,1914,1924,1911,1902,1906,1914,1928,1933,1917,1909,1909,1906,1926,1948,1942,1947,1953,1935,1941,1976,1984,1970,1956,1951,1961,1964,1953,1959,1981,1993,1997,2004,2008,2007,1999,1990,1991,2007,2023,2024,2022,2026,2031,2040,2049,2047,2049,2067,2083,2095,2101,2094,2090,2098,2111,2123,2126,2120,2113,2111,2121,2125,2113,2109,2119,2126,2134,2149,2166,2176,2167,2152,2154,2159,2158,2162,2176,2188,2191,2190,2192,2187,2181,2187,2191,2188,2193,2201,2198,2191,2196,2211,2214,2202,2197,2199,2194,2193,2203,2210,2205,2203,2209,2204,2195,2204,2201,2179,2177,2179,2162,2164,2187,2194,2191,2193,2199,2204,2202,2203,2210,2207,2199,2200,2195,2184,2169,2153,2143,2134,2113,2098,2098,2096,2093,2094,2096,2098,2114,2144,2160,2161,2168,2182,2198,2215,2220,2216,2217,2222,2231,2248,2269,2278,2261,2236,2225,2204,2173,2157,2139,2119,2122,2113,2060,2009,2003,2020,2016,1993,1982,1970,1954,1961,1977,1979,1977,1970,1960,1950,1932,1929,1953,1967,1976,1990,1991,1996,2019,2024,2006,1998,2009,2021,2016,2009,2016,2021,2018,2014,2010,2019,2031,2024,2020,2027,2024,2016,2016,2018,2007,1983,1967,1965,1954,1935,1931,1934,1924,1901,1879,1879,1889,1885,1873,1870,1879,1884,1879,1867,1858,1864,1869,1843,1815,1828,1833,1798,1785,1806,1812,1796,1776,1760,1766,1788,1786,1758,1749,1765,1771,1762,1752,1744,1749,1766,1777,1774,1770,1777,1799,1813,1804,1792,1792,1793,1781,1765,1761,1762,1759,1763,1778,1787,1794,1807,1804,1791,1793,1808,1813,1815,1825,1839,1841,1829,1830,1848,1850,1844,1861,1876,1870,1864,1853,1837,1839,1846,1846,1849,1842,1843,1872,1891,1888,1893,1894,1891,1899,1903,1888,1869,1862,1871,1875,1865,1860,1865,1877,1887,1873,1858,1872,1886,1888,1896,1896,1881,1870,1870,1886,1909,1916,1913,1914,1918,1926,1932,1927,1917,1917,1928,1935,1932,1923,1913,1907,1910,1917,1921,1912,1898,1907,1926,1925,1920,1928,1936,1932,1922,1925,1940,1942,1932,1934,1935,1925,1919,1924,1936,1937,1927,1928,1937,1940,1952,1961,1958,1963,1972,1972,1975,1979,1983,1985,1975,1981,2009,2014,1999,2008,2023,2024,2028,2031,2022,2009,1999,1996,2006,2020,2030,2025,2009,2007,2016,2010,2008,2028,2031,2020,2028,2041,2042,2041,2032,2018,2019,2037,2058,2066,2055,2054,2066,2065,2057,2062,2071,2073,2070,2066,2068,2071,2072,2071,2069,2069,2077,2085,2086,2084,2087,2083,2066,2066,2085,2093,2084,2078,2082,2094,2097,2083,2076,2089,2104,2105,2092,2086,2098,2109,2113,2106,2091,2096,2119,2133,2129,2107,2089,2104,2120,2105,2090,2094,2109,2118,2107,2098,2103,2107,2107,2112,2109,2101,2094,2097,2113,2120,2109,2098,2091,2093,2113,2120,2097,2083,2100,2114,2102,2095,2104,2100,2086,2089,2095,2089,2091,2101,2102,2100,2101,2105,2105,2098,2091,2087,2084,2085,2090,2107,2125,2125,2119,2116,2095,2076,2085,2100,2099,2085,2077,2091,2106,2100,2095,2094,2086,2082,2073,2066,2077,2077,2071,2088,2093,2073,2079,2096,2088,2082,2091,2085,2069,2068,2077,2073,2060,2056,2056,2053,2063,2069,2058,2059,2074,2068,2055,2069,2078,2051,2034,2047,2052,2050,2054,2052,2047,2055,2061,2054,2053,2058,2052,2045,2056,2062,2050,2049,2053,2039,2028,2038,2045,2044,2047,2054,2059,2059,2060,2063,2060,2060,2068,2066,2054,2048,2045,2039,2033,2029,2033,2034,2024,2012,2009,2014,2029,2042,2034,2022,2029,2049,2062,2061,2053,2055,2063,2058,2047,2046,2038,2021,2012,2016,2028,2034,2021,2011,2024,2036,2028,2016,2026,2046,2050,2047,2048,2035,2023,2030,2037,2045,2054,2037,2028,2049,2047,2019,2022,2049,2071,2073,2036,1985,1984,2024,2050,2037,2009,2000,2000,1990,2012,2062,2070,2024,1987,2008,2080,2131,2109,2055,2014,1987,1990,2019,2039,2044,2040,2024,2029,2064,2094,2103,2099,2068,2025,2004,2006,2006,2009,2017,2011,2001,2016,2046,2055,2048,2055,2067,2047,2023,2041,2056,2033,2020,2026,2015,1993,1982,1995,2032,2068,2086,2090,2095,2121,2148,2139,2114,2109,2112,2104,2090,2083,2082,2063,2027,1998,1979,1964,1966,1990,2010,1995,1966,1958,1956,1970,1998,2005,2020,2069,2079,2041,2036,2068,2090,2091,2092,2108,2113,2104,2110,2119,2114,2106,2084,2051,2029,2018,2033,2050,2031,2018,2024,2008,2006,2048,2063,2036,2021,2027,2026,2015,2022,2032,2019,2010,2031,2062,2083,2072,2045,2042,2053,2055,2045,2011,1982,1980,1959,1928,1952,2007,2031,2026,2024,2020,2003,2005,2031,2040,2034,2026,2017,2026,2032,2001,1981,1978,1952,1939,1956,1968,1963,1942,1941,1990,2019,1993,1958,1921,1902,1940,1992,2019,2042,2059,2039,1995,1979,1986,1983,2007,2053,2043,2018,2057,2091,2059,2021,2021,2032,2034,2038,2052,2066,2065,2032,1988,1981,2006,2030,2053,2064,2056,2040,1995,1957,1986,2017,1997,1994,2018,2019,2005,1994,1976,1953,1952,1964,1947,1911,1905,1939,1984,2002,1980,1966,1978,1990,2009,2042,2053,2046,2050,2061,2062,2047,2033,2041,2058,2070,2084,2087,2071,2053,2039,2017,2006,2019,2021,2002,2007,2023,2010,2007,2025,1996,1943,1945,1971,1970,1971,1994,2023,2053,2072,2071,2077,2109,2128,2109,2089,2083,2070,2066,2099,2142,2166,2176,2183,2179,2155,2132,2134,2141,2131,2123,2124,2113,2091,2083,2101,2124,2126,2116,2117,2117,2098,2061,2013,1976,1975,1983,1969,1966,1995,2022,2024,2020,2033,2066,2119,2167,2168,2138,2129,2138,2134,2136,2165,2192,2174,2121,2077,2070,2079,2059,2021,2024,2060,2069,2064,2081,2093,2079,2063,2074,2112,2143,2161,2196,2221,2214,2215,2220,2207,2198,2181,2137,2106,2098,2090,2085,2087,2090,2091,2090,2103,2125,2124,2093,2064,2054,2052,2054,2068,2083,2086,2071,2046,2044,2066,2076,2076,2071,2036,2010,2019,2014,2002,2009,2003,1996,2019,2041,2044,2045,2052,2070,2081,2073,2066,2064,2069,2077,2078,2086,2109,2108,2080,2059,2052,2044,2035,2034,2038,2034,2029,2043,2061,2059,2040,2033,2041,2033,2011,2004,2006,2007,2001,1986,1984,1996,1990,1980,1987,1984,1974,1983,1997,2000,2000,2004,2017,2027,2023,2009,2000,2021,2051,2054,2047,2042,2034,2040,2061,2066,2048,2021,2017,2031,2027,2023,2049,2058,2037,2035,2052,2063,2066,2062,2053,2050,2050,2044,2040,2046,2051,2033,1997,1977,1984,1987,1985,1993,1990,1967,1967,1979,1968,1972,2000,1988,1959,1966,1980,1980,1973,1952,1937,1948,1957,1949,1940,1938,1948,1958,1947,1930,1935,1950,1954,1951,1949,1945,1940,1953,1990,2017,1993,1958,1968,1994,2002,2023,2043,2016,1985,2006,2037,2024,1998,2002,2015,2010,2003,1992,1977,1994,2023,2010,1989,2009,2038,2043,2038,2031,2023,2015,2010,2012,2026,2046,2060,2064,2059,2047,2046,2053,2045,2034,2044,2053,2051,2059,2074,2082,2084,2080,2072,2073,2081,2068,2050,2058,2067,2058,2064,2076,2061,2052,2068,2070,2049,2035,2033,2040,2054,2054,2044,2063,2092,2087,2072,2080,2092,2097,2108,2115,2111,2102,2095,2098,2100,2097,2100,2105,2109,2113,2111,2122,2152,2166,2153,2134,2113,2106,2119,2124,2126,2136,2136,2125,2123,2130,2120,2087,2075,2107,2125,2100,2073,2073,2083,2082,2068,2063,2078,2096,2104,2100,2095,2101,2115,2110,2087,2085,2096,2075,2053,2071,2089,2081,2087,2105,2106,2101,2105,2106,2103,2112,2127,2123,2110,2110,2122,2129,2117,2096,2091,2094,2099,2112,2114,2113,2132,2143,2139,2148,2150,2134,2123,2122,2121,2119,2118,2129,2133,2115,2109,2120,2125,2131,2131,2121,2135,2165,2163,2141,2146,2156,2145,2142,2146,2136,2132,2136,2136,2152,2172,2170,2170,2175,2167,2169,2182,2175,2156,2149,2153,2158,2156,2143,2134,2144,2148,2133,2137,2161,2165,2169,2182,2166,2143,2151,2155,2140,2134,2140,2135,2127,2133,2140,2131,2118,2117,2132,2150,2149,2144,2137,2118,2117,2136,2139,2157,2181,2160,2144,2152,2134,2119,2125,2119,2128,2149,2144,2168,2200,2146,2106,2185,2239,2162,2094,2131,2190,2213,2214,2190,2150,2139,2156,2147,2119,2133,2181,2207,2211,2212,2212,2216,2195,2129,2080,2069,2064,2081,2119,2157,2201,2222,2219,2236,2248,2226,2186,2113,2038,2026,2043,2056,2093,2131,2155,2196,2234,2223,2203,2221,2229,2197,2188,2209,2210,2215,2240,2228,2186,2171,2171,2144,2104,2087,2073,2057,2071,2103,2131,2174,2221,2237,2228,2204,2171,2154,2147,2130,2124,2152,2185,2197,2212,2248,2274,2269,2242,2218,2213,2198,2162,2152,2164,2159,2166,2198,2201,2179,2188,2224,2243,2241,2236,2217,2199,2212,2223,2189,2150,2151,2169,2166,2149,2146,2126,2089,2093,2120,2112,2099,2105,2110,2122,2138,2141,2146,2155,2167,2192,2208,2200,2187,2186,2194,2193,2173,2153,2156,2172,2171,2153,2146,2157,2158,2155,2180,2206,2183,2148,2152,2164,2170,2182,2170,2141,2149,2166,2170,2177,2152,2104,2111,2154,2162,2139,2116,2099,2093,2112,2141,2133,2112,2125,2138,2142,2172,2185,2153,2136,2150,2156,2145,2135,2134,2127,2128,2159,2187,2184,2177,2179,2175,2161,2141,2125,2127,2152,2167,2159,2171,2205,2206,2178,2159,2143,2125,2113,2112,2123,2126,2107,2088,2091,2116,2140,2145,2138,2123,2107,2109,2116,2111,2114,2125,2121,2106,2111,2136,2142,2126,2124,2121,2102,2091,2090,2091,2099,2107,2126,2147,2130,2107,2118,2121,2098,2100,2123,2113,2083,2090,2116,2104,2092,2115,2124,2095,2078,2094,2102,2082,2077,2098,2092,2081,2103,2106,2068,2045,2046,2047,2058,2068,2051,2042,2073,2092,2078,2078,2101,2109,2105,2110,2125,2124,2102,2089,2079,2057,2056,2066,2056,2059,2082,2099,2124,2131,2093,2067,2083,2095,2087,2095,2115,2120,2128,2146,2138,2132,2156,2155,2117,2082,2066,2082,2092,2074,2098,2133,2101,2087,2122,2124,2115,2131,2132,2124,2121,2106,2099,2116,2124,2118,2112,2106,2114,2135,2136,2117,2110,2108,2108,2123,2121,2106,2118,2125,2122,2137,2136,2123,2137,2136,2107,2098,2099,2086,2080,2098,2114,2099,2091,2128,2151,2143,2146,2141,2113,2094,2092,2103,2116,2114,2109,2104,2082,2068,2075,2084,2096,2107,2099,2095,2118,2130,2103,2079,2082,2077,2069,2088,2105,2101,2105,2113,2095,2063,2054,2070,2082,2085,2089,2084,2080,2101,2116,2093,2066,2071,2085,2090,2096,2090,2073,2081,2094,2084,2075,2077,2079,2087,2088,2078,2073,2069,2066,2077,2072,2051,2051,2077,2093,2079,2058,2054,2059,2066,2074,2073,2070,2071,2075,2079,2068,2046,2042,2051,2054,2059,2054,2044,2060,2084,2083,2069,2061,2062,2057,2033,2028,2054,2063,2056,2061,2064,2062,2065,2065,2065,2060,2037,2018,2024,2040,2052,2048,2030,2047,2083,2064,2030,2041,2047,2030,2033,2038,2025,2018,2009,1998,2011,2032,2038,2033,2017,2008,2019,2017,1995,1985,1978,1966,1968,1967,1952,1951,1959,1953,1938,1931,1945,1972,1987,1985,1972,1964,1981,1994,1974,1953,1944,1939,1949,1955,1948,1953,1957,1940,1926,1935,1939,1914,1897,1918,1932,1928,1925,1908,1904,1940,1950,1925,1919,1930,1933,1912,1889,1902,1914,1905,1931,1953,1915,1888,1897,1896,1883,1873,1883,1916,1930,1924,1919,1904,1891,1894,1896,1910,1926,1904,1877,1888,1899,1880,1865,1876,1893,1903,1915,1925,1929,1923,1907,1901,1914,1911,1880,1867,1887,1898,1881,1874,1891,1904,1910,1910,1901,1898,1902,1891,1867,1860,1875,1879,1870,1878,1881,1862,1864,1879,1862,1845,1858,1876,1891,1897,1894,1911,1933,1930,1926,1929,1927,1926,1917,1911,1936,1954,1933,1924,1934,1921,1911,1918,1907,1890,1892,1897,1911,1929,1923,1905,1912,1931,1925,1910,1924,1926,1894,1903,1947,1941,1918,1929,1947,1960,1951,1911,1892,1900,1888,1879,1893,1891,1869,1877,1923,1952,1943,1931,1923,1904,1906,1943,1951,1890,1841,1872,1916,1921,1940,1961,1941,1922,1928,1935,1943,1936,1911,1908,1924,1919,1906,1922,1954,1947,1915,1924,1939,1919,1922,1952,1937,1909,1934,1974,1974,1957,1946,1922,1888,1885,1898,1890,1877,1893,1911,1910,1919,1931,1923,1932,1957,1941,1918,1921,1917,1932,1969,1969,1957,1964,1960,1957,1960,1946,1935,1933,1934,1948,1944,1921,1914,1919,1931,1949,1940,1923,1927,1927,1925,1944,1961,1954,1936,1928,1930,1930,1934,1947,1959,1965,1959,1935,1924,1941,1961,1960,1936,1921,1934,1945,1948,1959,1950,1919,1923,1955,1952,1926,1937,1973,1975,1951,1959,1990,1982,1943,1928,1926,1906,1906,1938,1944,1922,1934,1966,1969,1956,1941,1936,1959,1979,1950,1921,1946,1980,1977,1960,1958,1959,1953,1954,1966,1976,1974,1969,1969,1972,1972,1977,1981,1974,1965,1967,1967,1965,1975,1982,1976,1980,1996,2001,1995,2000,2004,2000,2004,2010,1997,1989,2002,2013,2004,1992,1991,2001,2017,2038,2049,2035,2031,2055,2061,2030,2007,2018,2028,2026,2041,2064,2065,2061,2070,2081,2082,2057,2022,2023,2044,2039,2026,2040,2061,2069,2080,2110,2120,2092,2088,2115,2108,2076,2069,2071,2068,2079,2098,2098,2090,2092,2089,2086,2102,2114,2110,2107,2104,2113,2128,2112,2076,2062,2074,2097,2102,2101,2131,2158,2141,2119,2125,2140,2148,2156,2172,2167,2127,2090,2076,2085,2098,2093,2111,2157,2160,2135,2128,2128,2134,2120,2088,2121,2176,2180,2199,2197,2115,2076,2129,2183,2197,2175,2152,2157,2152,2139,2140,2123,2103,2101,2097,2113,2143,2144,2131,2122,2118,2139,2183,2216,2211,2179,2170,2181,2164,2126,2093,2070,2072,2109,2142,2110,2040,2025,2062,2084,2094,2120,2159,2195,2204,2199,2202,2197,2189,2180,2161,2151,2146,2132,2147,2181,2181,2175,2197,2227,2249,2244,2206,2163,2142,2146,2158,2148,2120,2108,2123,2143,2135,2104,2070,2046,2048,2076,2087,2069,2056,2065,2083,2092,2093,2103,2110,2109,2119,2130,2125,2116,2105,2102,2126,2154,2169,2187,2202,2199,2188,2182,2179,2176,2181,2200,2215,2211,2197,2181,2171,2182,2196,2193,2186,2186,2193,2197,2176,2143,2130,2133,2141,2161,2181,2175,2156,2155,2175,2192,2193,2178,2162,2178,2204,2191,2174,2193,2201,2172,2149,2143,2135,2140,2155,2150,2126,2118,2128,2136,2137,2131,2119,2109,2114,2130,2139,2133,2129,2134,2136,2130,2122,2120,2127,2135,2146,2170,2186,2178,2180,2200,2199,2175,2163,2167,2178,2202,2211,2193,2187,2184,2160,2164,2195,2195,2184,2189,2194,2213,2227,2206,2184,2184,2189,2199,2203,2198,2196,2185,2171,2170,2163,2155,2166,2177,2179,2192,2203,2195,2181,2175,2174,2171,2175,2188,2192,2192,2202,2206,2187,2167,2172,2194,2211,2212,2208,2216,2229,2213,2177,2180,2216,2228,2213,2200,2190,2184,2187,2186,2178,2181,2188,2184,2190,2208,2204,2182,2177,2182,2178,2169,2156,2139,2137,2163,2187,2175,2146,2137,2152,2162,2146,2126,2145,2164,2121,2073,2095,2130,2115,2097,2107,2104,2101,2145,2174,2099,2010,2054,2153,2140,2072,2061,2064,2066,2104,2125,2113,2125,2128,2092,2079,2101,2092,2058,2081,2159,2172,2104,2089,2143,2155,2114,2088,2093,2107,2107,2099,2102,2098,2083,2108,2153,2143,2104,2112,2134,2105,2063,2063,2083,2098,2100,2084,2070,2083,2112,2126,2110,2081,2061,2058,2083,2111,2089,2043,2043,2080,2103,2095,2077,2070,2070,2072,2073,2056,2038,2042,2050,2056,2061,2052,2049,2066,2064,2037,2022,2040,2070,2067,2044,2039,2039,2043,2051,2028,2012,2051,2081,2076,2076,2068,2056,2068,2065,2042,2054,2076,2050,2017,2033,2062,2067,2073,2073,2048,2040,2058,2060,2042,2026,2037,2062,2047,2017,2030,2050,2040,2029,2035,2042,2037,2019,2004,1998,2004,2015,2016,2023,2030,2010,2005,2036,2042,2018,2010,2021,2031,2026,2011,2007,2019,2032,2023,1993,1983,1999,2015,2032,2029,2012,2017,2009,1982,1988,1998,1997,2018,2016,1978,1972,1990,2004,2014,1995,1962,1962,1989,2008,1998,1974,1972,1981,1977,1979,1999,2023,2027,1998,1970,1984,2017,2029,2020,2017,2015,1992,1967,1962,1968,1972,1966,1963,1983,1992,1979,1986,2005,2008,2006,2001,1996,1984,1964,1969,1981,1960,1957,1993,2013,2013,2018,2017,2011,2000,1996,2006,2004,1997,1993,1971,1962,1987,1988,1961,1968,1997,2006,1998,2001,2020,2018,1985,1964,1986,2031,2045,2007,1973,1978,1987,1984,1991,1998,1967,1925,1952,2025,2043,2003,1970,1955,1955,1971,1996,2022,2013,1972,1968,2011,2025,1988,1962,1981,1992,1972,1966,1982,1996,2015,2029,2016,1993,1984,1995,2000,1974,1951,1963,1990,2006,1993,1963,1968,1995,1988,1955,1927,1929,1961,1964,1926,1929,1979,2004,1999,1991,1980,1974,1977,1978,1974,1974,1971,1963,1970,1983,1972,1962,1982,1995,1966,1930,1916,1912,1920,1939,1946,1945,1967,1995,1998,1971,1936,1936,1971,1964,1914,1913,1959,1982,1992,2006,1982,1940,1952,1995,1984,1926,1888,1909,1963,1985,1951,1929,1942,1940,1934,1945,1934,1931,1970,1975,1938,1935,1941,1933,1967,2022,2025,1993,1966,1968,2004,2011,1969,1952,1955,1927,1908,1930,1954,1963,1967,1985,2017,2021,1999,2001,2004,1972,1944,1933,1920,1934,1981,2003,1985,1955,1931,1937,1959,1951,1933,1944,1959,1968,1997,2015,1998,1982,1984,1987,1968,1927,1900,1914,1937,1935,1915,1907,1941,1995,2006,1968,1939,1943,1951,1950,1948,1944,1937,1945,1967,1976,1960,1939,1942,1949,1930,1913,1928,1942,1935,1933,1946,1966,1983,1984,1967,1946,1939,1944,1948,1953,1953,1948,1962,1988,1988,1972,1968,1969,1974,1968,1928,1892,1915,1968,1982,1954,1953,1987,1992,1964,1947,1937,1929,1940,1954,1954,1952,1946,1941,1959,1990,1989,1958,1935,1921,1909,1920,1944,1956,1976,1994,1970,1931,1924,1939,1950,1961,1978,1987,1969,1943,1943,1960,1956,1940,1948,1972,1981,1977,1963,1953,1971,1984,1960,1950,1981,2005,2012,2017,2012,1997,1980,1968,1956,1933,1914,1921,1953,1994,2007,1985,1989,2022,2022,1994,1982,1988,1991,1976,1968,1982,1973,1952,1972,1988,1963,1958,1984,1994,1987,1984,1995,2021,2034,2028,2023,2026,2033,2041,2029,1996,1983,1980,1960,1949,1960,1988,2036,2062,2050,2056,2080,2076,2053,2026,2002,2016,2058,2065,2035,2023,2053,2069,2040,2018,2029,2034,2041,2059,2054,2035,2028,2037,2057,2048,1992,1957,1979,2004,2005,1992,1984,2011,2058,2076,2071,2061,2047,2054,2090,2111,2108,2099,2088,2083,2089,2098,2097,2083,2067,2062,2057,2048,2046,2041,2041,2064,2081,2060,2036,2046,2069,2073,2065,2064,2067,2065,2066,2063,2055,2063,2083,2086,2081,2071,2051,2051,2081,2096,2082,2069,2077,2086,2073,2053,2053,2062,2061,2063,2068,2070,2069,2073,2090,2111,2103,2076,2063,2050,2037,2053,2081,2081,2055,2043,2066,2093,2087,2066,2051,2037,2042,2069,2089,2097,2096,2083,2071,2053,2014,1988,2009,2064,2126,2155,2143,2135,2137,2118,2090,2054,2001,1966,1970,1981,1984,1997,2029,2067,2082,2085,2108,2138,2153,2146,2112,2074,2061,2052,2032,2024,2015,1992,1979,1986,2013,2040,2036,2020,2043,2097,2146,2175,2171,2138,2110,2097,2083,2060,2020,1985,1998,2047,2078,2079,2073,2073,2077,2077,2073,2072,2070,2051,2022,2007,2010,2010,2004,1998,1991,1996,2021,2039,2039,2053,2088,2108,2107,2111,2127,2136,2127,2095,2071,2094,2139,2145,2127,2131,2148,2163,2173,2164,2139,2129,2144,2158,2138,2100,2085,2096,2101,2096,2101,2110,2102,2080,2085,2119,2121,2091,2085,2085,2076,2099,2111,2061,2036,2080,2105,2090,2102,2143,2161,2139,2119,2136,2137,2094,2086,2131,2152,2146,2171,2196,2168,2142,2169,2189,2165,2148,2154,2146,2151,2185,2192,2171,2169,2173,2160,2145,2144,2162,2181,2185,2201,2235,2248,2232,2202,2178,2192,2218,2197,2160,2162,2175,2163,2155,2182,2223,2225,2179,2151,2172,2205,2229,2240,2229,2208,2202,2205,2193,2176,2180,2194,2199,2208,2218,2218,2217,2221,2222,2216,2206,2222,2261,2249,2194,2195,2225,2196,2159,2192,2246,2252,2216,2182,2180,2204,2229,2227,2192,2169,2186,2196,2175,2161,2166,2181,2199,2193,2164,2162,2190,2200,2181,2158,2160,2191,2230,2242,2209,2176,2195,2225,2210,2185,2177,2173,2187,2201,2191,2193,2217,2218,2207,2197,2179,2178,2197,2193,2182,2182,2173,2179,2207,2210,2189,2182,2194,2220,2230,2195,2153,2155,2188,2200,2165,2131,2151,2184,2175,2153,2148,2146,2152,2170,2181,2173,2168,2192,2206,2163,2125,2151,2194,2198,2164,2115,2099,2116,2128,2137,2133,2099,2096,2145,2154,2120,2116,2130,2123,2117,2126,2116,2086,2081,2090,2076,2099,2180,2179,2085,2065,2112,2080,2018,2056,2123,2117,2091,2096,2091,2077,2082,2076,2059,2084,2122,2103,2057,2045,2050,2029,2007,2024,2061,2088,2102,2093,2058,2025,2027,2062,2084,2071,2065,2075,2064,2036,2009,1985,1980,1995,2017,2044,2055,2040,2023,2015,2025,2049,2042,2004,1993,2014,2033,2032,2013,2009,2028,2034,2023,2020,2017,2001,1980,1974,1998,2026,2029,2023,2027,2021,2007,2018,2050,2057,2031,2011,2009,2012,2019,2014,1992,1987,2001,2002,1991,1997,2015,2015,1997,1990,2002,2017,2023,2013,2000,1999,2001,2003,2014,2019,2011,2007,2012,2021,2039,2060,2066,2048,2038,2056,2057,2029,2019,2037,2049,2049,2050,2054,2058,2061,2061,2045,2026,2029,2038,2033,2035,2045,2053,2067,2064,2031,2024,2060,2081,2063,2049,2061,2070,2058,2046,2052,2060,2049,2025,2015,2035,2064,2075,2069,2063,2069,2074,2070,2071,2072,2059,2046,2057,2082,2079,2036,1997,2010,2045,2058,2048,2043,2048,2048,2044,2051,2056,2049,2050,2069,2084,2077,2059,2059,2062,2046,2051,2075,2077,2079,2085,2064,2058,2065,2035,2029,2086,2105,2066,2044,2061,2093,2104,2075,2050,2050,2055,2060,2062,2054,2049,2046,2037,2027,2023,2033,2044,2040,2037,2040,2031,2022,2023,2027,2029,2023,2015,2013,1997,1975,1977,1985,1985,1989,1995,1994,1994,1994,1986,1964,1943,1953,1972,1968,1955,1942,1928,1935,1954,1952,1945,1947,1943,1941,1946,1935,1905,1902,1939,1961,1947,1941,1947,1932,1911,1912,1927,1934,1915,1893,1901,1912,1906,1910,1918,1914,1907,1902,1906,1921,1914,1889,1888,1901,1900,1893,1893,1905,1917,1912,1895,1887,1890,1890,1880,1879,1898,1911,1905,1909,1923,1912,1891,1896,1914,1916,1907,1896,1891,1901,1922,1932,1920,1907,1907,1906,1912,1935,1937,1910,1901,1907,1903,1907,1915,1904,1896,1904,1904,1907,1915,1905,1891,1904,1916,1902,1891,1907,1924,1916,1894,1880,1881,1886,1894,1908,1912,1897,1889,1904,1925,1938,1940,1941,1950,1950,1931,1919,1914,1911,1921,1929,1918,1916,1929,1936,1936,1935,1931,1929,1931,1931,1926,1923,1928,1930,1932,1937,1941,1944,1942,1932,1938,1954,1952,1947,1955,1959,1957,1946,1925,1930,1959,1971,1972,1976,1969,1962,1971,1986,1989,1971,1956,1966,1967,1954,1971,2003,2003,1982,1979,1988,1984,1976,1984,1996,1999,2006,2013,2009,1999,1995,1996,1998,2004,2022,2036,2029,2027,2030,2007,1981,1991,2012,2008,1992,1987,1996,2014,2035,2040,2023,2010,2008,2000,1999,2013,2026,2027,2015,1993,1975,1967,1962,1965,1977,1989,1998,2001,1993,1986,1992,1994,1974,1952,1959,1984,1996,1992,1986,1980,1976,1980,1986,1977,1961,1966,1981,1978,1971,1987,2010,2008,1997,2010,2024,2008,1987,1984,1985,1996,2013,2006,1996,2016,2033,2017,2002,2008,2019,2016,2008,2019,2045,2062,2064,2055,2031,2004,1994,1988,1972,1966,1993,2021,2017,2013,2025,2023,2007,1989,1968,1969,1999,2007,1981,1975,1994,1996,1983,2005,2053,2064,2045,2040,2030,2001,1991,1977,1942,1939,1965,1971,1981,2006,2015,2012,2019,2032,2039,2014,1971,1960,1977,1994,2012,2028,2031,2018,1993,1990,2023,2044,2041,2038,2023,2000,2004,2023,2015,1999,2003,2021,2040,2053,2055,2041,2020,2007,2008,2034,2066,2059,2024,2017,2030,2027,2020,2032,2042,2044,2052,2061,2056,2043,2034,2035,2038,2033,2033,2048,2050,2035,2034,2054,2068,2062,2053,2055,2056,2054,2060,2059,2049,2053,2063,2061,2065,2064,2057,2074,2096,2097,2091,2059,2026,2062,2093,2072,2094,2120,2071,2063,2093,2064,2098,2192,2100,1898,1909,2128,2266,2163,1977,1973,2114,2159,2070,1958,1907,2017,2230,2312,2229,2172,2155,2059,1928,1877,1907,2003,2130,2204,2221,2232,2211,2155,2112,2061,2029,2075,2121,2111,2100,2084,2054,2061,2072,2049,2054,2098,2142,2192,2227,2217,2199,2202,2208,2191,2160,2123,2066,2027,2053,2069,2048,2103,2206,2218,2186,2196,2193,2180,2205,2214,2196,2192,2170,2122,2108,2100,2061,2058,2095,2098,2106,2153,2167,2180,2257,2292,2248,2238,2233,2167,2129,2138,2113,2103,2163,2212,2206,2187,2182,2191,2212,2220,2193,2148,2114,2100,2109,2131,2130,2107,2098,2110,2136,2168,2179,2167,2158,2159,2167,2169,2161,2176,2194,2166,2130,2130,2162,2205,2215,2176,2159,2189,2201,2179,2169,2180,2192,2191,2174,2151,2143,2159,2173,2162,2148,2160,2177,2174,2157,2142,2145,2154,2162,2170,2167,2156,2149,2138,2132,2136,2136,2132,2134,2148,2168,2172,2165,2158,2148,2139,2135,2133,2131,2132,2149,2175,2175,2166,2174,2188,2192,2193,2197,2200,2191,2181,2182,2189,2193,2194,2201,2204,2194,2187,2180,2179,2184,2173,2162,2173,2178,2184,2202,2207,2188,2163,2165,2170,2145,2137,2158,2161,2147,2130,2121,2130,2136,2147,2155,2137,2133,2149,2160,2174,2167,2137,2133,2138,2127,2131,2139,2128,2125,2123,2105,2119,2146,2101,2049,2092,2137,2108,2070,2069,2082,2091,2102,2114,2114,2113,2115,2090,2057,2081,2143,2140,2088,2103,2157,2170,2164,2144,2115,2108,2108,2111,2121,2113,2118,2154,2156,2114,2097,2109,2100,2087,2105,2129,2132,2120,2125,2133,2108,2104,2136,2118,2085,2106,2134,2134,2124,2125,2126,2103,2103,2127,2113,2107,2126,2121,2102,2090,2103,2125,2123,2134,2141,2124,2124,2132,2132,2114,2087,2106,2125,2096,2093,2104,2109,2133,2132,2118,2108,2097,2125,2144,2119,2113,2120,2129,2130,2104,2086,2073,2055,2062,2075,2088,2092,2079,2085,2073,2049,2064,2070,2066,2080,2076,2070,2066,2047,2037,2035,2051,2051,2020,2037,2056,2026,2026,2028,2026,2042,2011,1995,2016,2018,2075,2083,1950,1943,2093,2097,1972,1941,1989,2032,2089,2089,1989,1946,1990,2011,2044,2082,2049,2020,2042,2039,1986,1958,2009,2072,2077,2060,2065,2088,2084,2051,2046,2035,2009,2038,2050,1994,1981,2015,2035,2054,2053,2036,2039,2058,2081,2091,2083,2076,2055,2029,2028,2043,2052,2033,1998,2009,2039,2033,2024,2030,2016,2006,2034,2071,2071,2041,2021,2022,2035,2049,2038,2018,2025,2037,2039,2044,2035,1996,1966,1986,2026,2029,2012,2024,2046,2038,2006,1991,1999,2008,2021,2032,2019,2019,2038,2043,2054,2080,2075,2038,2016,2035,2069,2085,2078,2035,1968,1937,1951,1970,1999,2049,2087,2094,2096,2114,2110,2067,2026,2003,1978,1959,1949,1932,1917,1926,1959,1987,1999,2016,2040,2054,2065,2078,2072,2048,2030,2031,2039,2023,1988,1968,1964,1969,1995,2018,2005,1971,1946,1944,1956,1951,1929,1919,1924,1927,1930,1960,2001,2008,1994,1998,2019,2042,2051,2047,2039,2012,1981,1990,2004,1978,1953,1965,1984,1984,1966,1949,1955,1973,1966,1943,1940,1950,1956,1961,1952,1944,1957,1960,1948,1950,1968,1982,1979,1957,1936,1939,1952,1954,1957,1963,1943,1926,1946,1943,1914,1938,1976,1952,1908,1922,1983,1993,1908,1854,1901,1957,1973,1972,1952,1926,1925,1967,2031,2065,2047,2015,1993,1964,1912,1877,1895,1931,1966,1992,1989,1990,1995,1951,1915,1945,1953,1904,1882,1910,1944,1971,1990,2001,2018,2032,2009,1966,1961,1984,1982,1953,1927,1919,1931,1965,2000,2002,1980,1977,1979,1945,1900,1888,1899,1910,1928,1952,1960,1953,1938,1899,1863,1875,1923,1966,1988,1999,2014,2022,2010,1981,1925,1871,1863,1877,1875,1883,1941,2023,2039,2004,2025,2084,2091,2056,2034,2041,2048,2024,1984,1942,1899,1882,1871,1824,1784,1776,1765,1757,1779,1810,1823,1841,1887,1912,1908,1937,1984,2005,2034,2074,2107,2145,2174,2176,2177,2181,2168,2138,2115,2116,2120,2101,2055,2000,1972,1971,1950,1906,1881,1876,1875,1883,1897,1892,1870,1873,1908,1935,1940,1944,1950,1942,1936,1945,1940,1923,1934,1945,1925,1924,1945,1945,1946,1975,2002,2004,1995,1994,2013,2045,2044,2014,2022,2035,2007,2020,2063,2030,2000,2029,2000,1952,1990,2006,1932,1900,1964,2018,1998,1949,1932,1964,2007,2009,1998,2004,1995,2004,2053,2044,1975,1937,1916,1898,1923,1944,1921,1906,1926,1958,1979,1987,1980,1961,1946,1956,1973,1978,1973,1965,1970,1987,2004,1998,1967,1947,1949,1939,1915,1919,1961,2006,2012,1985,1968,1972,1981,1982,1964,1946,1959,1985,1987,1986,2003,2002,1984,1987,1995,1986,1977,1972,1975,1992,2005,2020,2042,2040,2033,2038,2027,2012,2023,2041,2038,2032,2044,2050,2031,2025,2041,2045,2044,2039,2027,2035,2040,2025,2039,2076,2082,2067,2062,2067,2064,2043,2028,2032,2034,2016,1992,2000,2036,2051,2049,2055,2053,2055,2072,2073,2071,2080,2080,2077,2079,2081,2078,2069,2061,2068,2088,2104,2104,2097,2086,2068,2068,2102,2117,2095,2083,2096,2107,2109,2111,2103,2085,2086,2112,2126,2121,2111,2092,2071,2075,2092,2092,2095,2129,2161,2164,2150,2127,2117,2127,2111,2083,2097,2113,2095,2094,2122,2135,2126,2125,2147,2175,2174,2136,2102,2115,2136,2117,2098,2100,2102,2118,2135,2124,2111,2110,2116,2134,2140,2127,2120,2123,2134,2145,2142,2139,2140,2136,2136,2134,2123,2110,2102,2104,2106,2095,2097,2114,2122,2125,2131,2128,2129,2141,2143,2120,2107,2144,2183,2164,2120,2107,2128,2152,2140,2106,2106,2125,2114,2094,2106,2125,2121,2120,2143,2155,2134,2114,2117,2128,2133,2132,2125,2107,2088,2082,2103,2138,2147,2127,2114,2113,2113,2108,2090,2078,2081,2086,2095,2096,2085,2092,2097,2074,2060,2072,2098,2126,2123,2094,2085,2092,2096,2090,2079,2097,2131,2126,2096,2084,2092,2116,2140,2138,2114,2104,2125,2145,2138,2111,2088,2091,2116,2127,2110,2089,2095,2128,2140,2118,2109,2119,2138,2167,2173,2154,2143,2136,2131,2133,2120,2104,2117,2135,2141,2150,2149,2128,2119,2137,2154,2147,2124,2105,2105,2122,2141,2159,2159,2128,2108,2121,2127,2110,2101,2115,2141,2160,2152,2112,2063,2064,2127,2183,2173,2143,2157,2171,2134,2107,2115,2104,2096,2128,2150,2149,2160,2155,2113,2084,2115,2168,2171,2141,2129,2140,2151,2156,2169,2196,2198,2163,2136,2136,2149,2159,2165,2180,2187,2162,2138,2144,2157,2154,2136,2135,2167,2185,2163,2140,2143,2155,2155,2145,2148,2156,2150,2136,2124,2130,2150,2146,2112,2114,2172,2202,2150,2100,2130,2181,2174,2141,2141,2157,2154,2158,2185,2186,2149,2127,2141,2162,2176,2178,2164,2140,2125,2132,2147,2134,2098,2086,2123,2170,2182,2151,2112,2112,2142,2149,2144,2147,2132,2119,2143,2164,2165,2166,2160,2145,2126,2113,2127,2150,2145,2126,2110,2108,2120,2121,2112,2121,2130,2115,2109,2122,2128,2117,2108,2116,2139,2151,2126,2101,2110,2121,2115,2115,2115,2109,2103,2099,2109,2131,2143,2151,2155,2142,2112,2084,2090,2118,2112,2088,2091,2100,2103,2106,2089,2070,2085,2108,2107,2094,2095,2118,2140,2145,2134,2113,2088,2069,2067,2073,2072,2074,2085,2086,2076,2075,2078,2069,2058,2077,2108,2110,2098,2096,2097,2095,2081,2060,2060,2072,2065,2046,2036,2044,2065,2077,2073,2059,2050,2075,2110,2109,2085,2072,2076,2090,2093,2085,2079,2071,2054,2051,2064,2070,2064,2063,2065,2059,2050,2039,2041,2070,2082,2056,2042,2052,2056,2057,2061,2062,2059,2047,2030,2019,2029,2067,2095,2079,2053,2057,2078,2075,2038,2008,2017,2034,2025,2009,2014,2022,2017,2020,2031,2026,2026,2037,2028,2008,2002,2004,2011,2020,2027,2027,2018,2008,1999,1989,1979,1976,1989,2013,2026,2029,2025,2001,1983,2004,2028,2020,2003,1989,1973,1975,2002,2017,2001,1987,1985,1983,1999,2025,2025,2010,2003,2010,2028,2033,2016,2001,1992,1982,1992,2017,2025,2017,2014,2002,1980,1977,1988,1995,2005,2006,1994,1987,1974,1961,1978,1996,1986,1972,1970,1976,1974,1960,1958,1970,1979,1978,1967,1951,1952,1967,1978,1969,1945,1932,1934,1931,1932,1943,1942,1933,1937,1953,1961,1954,1947,1948,1944,1939,1944,1957,1963,1965,1969,1970,1975,1981,1976,1970,1970,1960,1952,1967,1984,1991,1984,1968,1960,1960,1959,1970,1982,1978,1973,1974,1970,1965,1964,1963,1952,1940,1960,1993,1983,1950,1947,1960,1961,1961,1971,1978,1980,1979,1969,1957,1952,1947,1943,1933,1914,1920,1956,1983,1976,1954,1950,1960,1949,1934,1947,1950,1933,1941,1968,1978,1971,1965,1968,1967,1953,1949,1952,1942,1936,1955,1984,1992,1971,1949,1955,1975,1972,1958,1961,1965,1949,1935,1933,1929,1932,1949,1972,1980,1963,1946,1954,1981,2004,1998,1967,1948,1953,1961,1972,1981,1966,1929,1922,1963,1989,1962,1938,1952,1975,1983,1978,1969,1971,1976,1972,1968,1970,1971,1958,1940,1935,1940,1945,1944,1940,1943,1951,1968,1990,1986,1954,1948,1967,1958,1928,1920,1934,1950,1965,1965,1939,1916,1925,1936,1935,1942,1947,1938,1934,1939,1946,1950,1952,1952,1942,1929,1934,1941,1930,1927,1949,1958,1940,1932,1943,1946,1939,1934,1928,1931,1943,1934,1911,1904,1916,1933,1949,1952,1940,1933,1944,1959,1960,1954,1945,1937,1938,1939,1927,1917,1929,1959,1976,1965,1950,1946,1955,1971,1969,1947,1941,1957,1967,1966,1962,1965,1974,1972,1971,1983,1985,1984,1993,1983,1949,1941,1976,2002,1991,1969,1962,1979,1998,1988,1960,1947,1946,1952,1973,1998,1999,1977,1963,1978,1997,2000,2000,1996,1988,1993,2000,2001,2005,2001,1986,1987,1999,1999,1992,1982,1978,1990,2000,1992,1994,2002,1986,1972,2002,2037,2017,1971,1977,2034,2057,2024,1996,2003,2031,2046,2017,1974,1984,2042,2069,2030,1980,1977,2004,2017,2002,1991,2014,2039,2035,2034,2046,2043,2029,2017,1995,1984,2003,2026,2025,2013,2022,2048,2053,2034,2022,2021,2017,2022,2036,2042,2038,2038,2034,2017,2011,2026,2043,2049,2048,2052,2060,2053,2033,2032,2051,2054,2038,2027,2033,2046,2047,2045,2054,2065,2059,2038,2023,2035,2057,2060,2058,2070,2064,2037,2033,2045,2041,2036,2044,2059,2069,2060,2041,2040,2056,2071,2076,2072,2067,2068,2071,2069,2054,2046,2056,2063,2066,2071,2064,2055,2058,2053,2040,2042,2050,2055,2068,2087,2087,2064,2051,2055,2050,2054,2071,2076,2074,2076,2064,2058,2077,2090,2087,2089,2092,2085,2076,2074,2089,2107,2112,2103,2088,2083,2098,2111,2101,2078,2063,2068,2084,2085,2072,2072,2084,2086,2083,2094,2102,2086,2085,2114,2116,2088,2084,2089,2081,2084,2088,2078,2075,2086,2096,2099,2099,2105,2116,2128,2134,2115,2085,2099,2139,2137,2101,2091,2115,2129,2113,2100,2106,2114,2124,2139,2144,2135,2120,2121,2141,2137,2104,2103,2130,2143,2150,2145,2118,2112,2139,2155,2138,2122,2135,2159,2163,2166,2176,2167,2147,2131,2105,2089,2106,2125,2113,2107,2147,2194,2191,2167,2171,2190,2194,2159,2103,2093,2129,2142,2128,2117,2113,2122,2136,2147,2170,2179,2157,2143,2159,2178,2176,2152,2141,2151,2151,2148,2160,2154,2126,2117,2129,2136,2127,2120,2139,2166,2190,2202,2172,2115,2107,2146,2164,2158,2161,2172,2170,2154,2150,2153,2139,2111,2096,2113,2136,2119,2101,2129,2154,2156,2175,2189,2177,2170,2156,2119,2092,2086,2103,2137,2153,2145,2129,2121,2137,2136,2095,2085,2124,2147,2150,2154,2141,2112,2090,2099,2134,2144,2109,2092,2125,2145,2130,2133,2159,2156,2142,2156,2155,2128,2123,2131,2136,2138,2120,2105,2116,2116,2113,2125,2119,2115,2135,2136,2116,2116,2124,2131,2128,2104,2098,2127,2142,2133,2118,2111,2124,2133,2119,2105,2109,2116,2116,2118,2135,2142,2122,2110,2116,2112,2100,2100,2111,2123,2120,2110,2109,2116,2130,2141,2129,2117,2117,2119,2133,2136,2108,2106,2137,2142,2131,2122,2102,2101,2122,2121,2101,2103,2123,2133,2132,2144,2150,2115,2083,2100,2125,2128,2128,2131,2138,2140,2125,2104,2087,2093,2120,2130,2127,2135,2139,2145,2158,2142,2117,2121,2125,2122,2128,2132,2145,2156,2140,2132,2145,2143,2118,2088,2093,2135,2144,2122,2114,2092,2091,2147,2159,2116,2108,2113,2085,2062,2117,2229,2188,2008,2035,2200,2181,2123,2134,2064,2056,2125,2051,2049,2202,2150,2033,2125,2153,2088,2152,2169,2098,2138,2153,2066,2072,2104,2048,2042,2091,2099,2120,2146,2105,2085,2112,2082,2045,2080,2096,2080,2104,2117,2092,2089,2082,2052,2064,2086,2063,2043,2047,2059,2093,2115,2100,2121,2163,2135,2090,2099,2092,2049,2036,2041,2043,2062,2060,2039,2062,2082,2063,2077,2111,2094,2074,2084,2090,2100,2101,2068,2050,2061,2063,2068,2067,2024,1994,2024,2053,2055,2062,2061,2047,2045,2045,2041,2045,2032,2009,2012,2020,2006,1991,1991,2007,2034,2048,2040,2035,2053,2075,2077,2075,2077,2057,2037,2043,2031,1999,2000,2011,2013,2031,2036,2008,1986,1985,2020,2081,2077,1994,1958,2004,2043,2050,2054,2042,2004,1978,1981,1997,2026,2051,2042,2018,2003,1980,1947,1933,1964,2014,2037,2032,2021,1993,1970,1980,1996,2014,2048,2044,1987,1944,1944,1957,1964,1970,1981,1988,1995,2013,2019,2011,2010,1995,1972,1982,1993,1972,1967,1997,2017,1999,1966,1964,1994,1997,1973,1978,2009,2025,2024,2022,2015,1998,1980,1972,1974,1983,1997,1999,1983,1981,2006,2013,1984,1968,1977,1975,1977,2004,2015,1991,1969,1980,2015,2035,2018,1993,1986,1983,1977,1978,1989,1999,1988,1961,1954,1968,1970,1966,1977,1988,1984,1978,1967,1950,1948,1963,1971,1980,1996,1998,2001,2015,1998,1957,1953,1977,1987,1975,1955,1948,1962,1983,1987,1964,1934,1938,1968,1981,1975,1962,1942,1945,1976,1985,1963,1951,1960,1970,1975,1972,1972,1983,1977,1955,1960,1979,1961,1930,1927,1932,1936,1953,1974,1977,1961,1957,1974,1975,1953,1951,1967,1969,1969,1973,1959,1951,1981,2010,1998,1970,1972,1998,2008,1991,1970,1960,1960,1962,1965,1970,1976,1976,1973,1975,1966,1949,1952,1960,1947,1935,1947,1966,1983,1994,1990,1982,1985,1979,1961,1948,1935,1922,1928,1941,1932,1921,1935,1956,1953,1941,1950,1969,1955,1926,1930,1948,1938,1924,1938,1954,1953,1949,1945,1939,1947,1974,1999,1995,1969,1956,1972,1989,1980,1959,1955,1962,1956,1944,1953,1980,1992,1971,1944,1951,1995,2034,2025,1981,1947,1940,1968,2019,2036,1986,1907,1828,1762,1757,1850,1997,2137,2243,2304,2327,2339,2324,2223,2019,1762,1519,1347,1268,1266,1308,1372,1455,1595,1838,2193,2636,3110,3501,3695,3634,3330,2844,2251,1622,1040,590,305,173,184,356,701,1184,1733,2295,2833,3296,3616,3761,3759,3642,3409,3076,2671,2216,1745,1299,883,527,287,180,197,338,583,901,1276,1677,2069,2455,2835,3182,3463,3634,3645,3515,3321,3097,2828,2536,2260,2001,1760,1549,1389,1321,1360,1467,1600,1725,1821,1899,1968,2031,2103,2181,2244,2292,2317,2293,2218,2111,1999,1905,1805,1665,1489,1307,1149,1039,984,995,1089,1263,1502,1796,2109,2405,2661,2863,3013,3114,3153,3105,2969,2779,2572,2343,2088,1847,1650,1501,1411,1377,1398,1493,1634,1742,1809,1884,1977,2047,2080,2087,2075,2059,2067,2105,2159,2189,2168,2138,2170,2229,2246,2243,2255,2272,2291,2306,2300,2279,2260,2245,2220,2179,2140,2123,2112,2072,1985,1875,1789,1733,1674,1602,1537,1500,1513,1542,1543,1546,1599,1677,1754,1845,1961,2091,2196,2271,2370,2490,2559,2561,2550,2555,2558,2522,2447,2373,2304,2216,2124,2056,1988,1896,1825,1797,1762,1708,1696,1747,1791,1775,1740,1758,1837,1915,1963,2001,2044,2097,2150,2178,2187,2212,2252,2272,2267,2272,2298,2302,2278,2268,2258,2213,2169,2121,2026,1948,1945,1936,1887,1867,1875,1875,1889,1924,1954,1987,2042,2096,2125,2126,2123,2140,2156,2119,2058,2048,2073,2067,2037,2048,2109,2167,2190,2210,2262,2315,2321,2287,2264,2285,2308,2263,2189,2171,2179,2142,2090,2057,2022,1981,1957,1953,1964,1975,1979,2005,2057,2094,2114,2143,2168,2171,2176,2178,2159,2147,2154,2138,2096,2071,2069,2077,2089,2089,2077,2074,2083,2086,2086,2090,2093,2094,2089,2071,2051,2034,1995,1933,1898,1931,2005,2074,2115,2111,2077,2063,2094,2145,2200,2265,2336,2394,2407,2335,2204,2114,2119,2153,2135,2083,2061,2077,2091,2089,2092,2106,2125,2140,2140,2130,2128,2122,2112,2126,2155,2162,2155,2158,2145,2105,2079,2092,2126,2159,2167,2140,2114,2114,2117,2102,2091,2109,2134,2135,2117,2115,2130,2136,2125,2104,2083,2079,2091,2089,2076,2093,2127,2123,2081,2057,2073,2102,2116,2116,2133,2186,2236,2222,2157,2111,2118,2143,2157,2154,2142,2134,2144,2158,2157,2153,2158,2157,2146,2131,2106,2081,2086,2109,2109,2095,2103,2130,2164,2196,2199,2186,2208,2247,2240,2202,2183,2169,2149,2144,2151,2165,2184,2166,2115,2112,2157,2165,2136,2143,2173,2175,2160,2145,2132,2134,2149,2151,2139,2133,2135,2129,2113,2108,2122,2131,2118,2102,2108,2135,2161,2151,2106,2081,2105,2141,2158,2141,2100,2076,2094,2109,2095,2085,2094,2108,2117,2127,2138,2147,2146,2144,2156,2166,2158,2154,2168,2177,2168,2151,2134,2131,2149,2169,2165,2138,2112,2115,2145,2173,2179,2172,2156,2132,2113,2125,2167,2195,2190,2184,2187,2174,2156,2147,2131,2113,2121,2132,2115,2090,2077,2078,2098,2114,2105,2099,2114,2126,2136,2148,2147,2149,2179,2202,2174,2130,2126,2151,2142,2094,2072,2092,2097,2059,2034,2068,2112,2093,2050,2088,2180,2190,2121,2097,2127,2148,2154,2152,2128,2104,2090,2071,2062,2078,2099,2110,2100,2067,2064,2109,2121,2068,2046,2087,2112,2094,2054,2016,2018,2050,2047,2024,2041,2078,2086,2075,2069,2070,2080,2105,2130,2133,2119,2104,2092,2087,2105,2123,2092,2041,2044,2083,2080,2038,2014,2032,2059,2055,2038,2056,2090,2101,2093,2088,2101,2123,2113,2068,2053,2081,2086,2056,2052,2085,2101,2077,2045,2036,2048,2052,2045,2052,2061,2053,2056,2069,2064,2056,2070,2089,2100,2106,2091,2053,2027,2034,2057,2070,2058,2035,2031,2047,2060,2064,2049,2027,2041,2076,2077,2051,2040,2056,2080,2076,2046,2043,2073,2088,2069,2048,2045,2047,2037,2023,2027,2048,2052,2030,2015,2035,2063,2056,2021,2019,2054,2059,2027,2008,2003,2000,2000,1999,2004,2024,2030,2018,2017,2019,2003,1994,2004,1991,1958,1971,2023,2031,1994,1980,2002,2026,2036,2023,1997,1982,1979,1956,1927,1943,1985,1984,1948,1934,1959,1996,2012,2006,1997,1985,1976,1986,1996,1976,1950,1960,1980,1956,1915,1920,1945,1945,1948,1974,1990,1990,1997,2002,1985,1979,2007,2017,1989,1966,1958,1961,1969,1952,1914,1916,1958,1970,1933,1896,1890,1900,1920,1948,1952,1911,1882,1914,1969,1975,1941,1939,1982,2014,2006,1985,1987,2003,2006,2003,2003,1999,1997,1996,1987,1984,2000,2022,2037,2032,2015,2018,2036,2035,2015,2005,2009,2007,2001,2006,2009,2004,1998,1994,1995,2001,2003,2007,2012,2010,2013,2019,2014,2005,2001,2001,1998,1991,1993,2012,2027,2023,2008,2006,2032,2058,2038,1985,1968,2005,2036,2025,2010,2013,2011,2000,1999,2022,2049,2036,2012,2043,2076,2040,2000,2002,1987,1949,1958,2002,2014,2017,2051,2067,2032,1993,1970,1957,1951,1941,1926,1926,1950,1992,2034,2043,2014,1984,1981,2000,2009,1980,1945,1966,2003,1968,1913,1927,1956,1939,1928,1942,1947,1933,1923,1940,1960,1952,1951,1961,1923,1883,1922,1969,1942,1904,1927,1975,1984,1952,1926,1940,1957,1931,1902,1903,1902,1895,1907,1917,1927,1957,1975,1948,1911,1908,1922,1918,1911,1910,1899,1899,1918,1920,1906,1909,1924,1937,1942,1934,1924,1919,1913,1917,1927,1928,1915,1901,1897,1909,1920,1924,1930,1950,1970,1966,1944,1931,1927,1918,1913,1929,1954,1943,1902,1878,1882,1907,1937,1934,1904,1916,1966,1972,1932,1940,1993,1973,1901,1916,1985,1984,1943,1934,1940,1932,1927,1943,1957,1940,1921,1937,1969,1986,1984,1968,1950,1951,1977,2008,2013,1992,1975,1980,1988,1988,2003,2015,1993,1980,2006,2019,2013,2022,2030,2024,2026,2034,2024,1988,1965,1982,2008,2014,2004,1994,2000,2019,2027,2013,2003,2024,2056,2047,2009,2014,2066,2088,2050,2019,2040,2055,2030,2027,2057,2058,2013,1969,1975,2025,2060,2055,2052,2065,2064,2043,2046,2081,2095,2071,2052,2054,2061,2075,2088,2071,2028,2011,2033,2041,2023,2007,2000,2015,2055,2086,2090,2078,2073,2085,2090,2077,2072,2065,2050,2054,2053,2026,2017,2027,2021,2026,2052,2058,2042,2043,2065,2083,2077,2047,2023,2034,2060,2064,2048,2037,2050,2080,2100,2103,2094,2074,2054,2042,2042,2054,2056,2043,2043,2032,2009,2030,2059,2030,2005,2035,2069,2061,2020,1993,2023,2064,2054,2034,2053,2072,2059,2047,2051,2046,2032,2030,2044,2050,2048,2065,2083,2060,2041,2071,2087,2045,2002,2002,2023,2040,2043,2039,2053,2089,2105,2085,2077,2091,2091,2087,2091,2080,2063,2059,2056,2062,2072,2069,2071,2078,2072,2071,2075,2069,2072,2085,2078,2062,2057,2052,2046,2059,2087,2104,2102,2089,2083,2096,2105,2095,2088,2083,2073,2072,2070,2064,2080,2104,2103,2095,2101,2110,2105,2092,2091,2101,2108,2109,2102,2093,2094,2090,2081,2086,2094,2086,2081,2100,2130,2130,2109,2112,2132,2127,2112,2109,2100,2089,2105,2122,2106,2085,2086,2089,2091,2098,2090,2078,2096,2122,2121,2104,2096,2092,2079,2065,2063,2065,2069,2077,2082,2092,2101,2091,2089,2102,2088,2054,2055,2086,2095,2076,2072,2096,2109,2096,2077,2065,2065,2077,2089,2092,2085,2070,2065,2070,2064,2063,2087,2106,2095,2077,2076,2082,2084,2075,2062,2070,2091,2092,2076,2066,2074,2095,2094,2074,2077,2088,2075,2058,2048,2057,2087,2092,2067,2069,2088,2075,2045,2037,2049,2055,2055,2062,2065,2062,2074,2084,2070,2058,2059,2050,2049,2075,2090,2072,2059,2073,2094,2091,2064,2055,2076,2088,2079,2068,2046,2034,2064,2100,2097,2086,2093,2095,2082,2080,2098,2102,2084,2076,2084,2077,2061,2076,2119,2134,2115,2118,2137,2111,2077,2089,2106,2088,2061,2059,2086,2109,2101,2097,2122,2139,2124,2112,2116,2115,2116,2134,2142,2126,2110,2114,2129,2138,2123,2101,2103,2131,2150,2145,2142,2147,2135,2119,2124,2123,2111,2122,2146,2149,2142,2142,2141,2139,2151,2167,2165,2144,2127,2130,2143,2145,2142,2149,2161,2169,2168,2160,2152,2136,2113,2116,2151,2191,2231,2248,2212,2145,2092,2059,2048,2070,2122,2174,2209,2236,2258,2256,2217,2148,2081,2053,2048,2047,2082,2162,2229,2257,2272,2281,2271,2256,2236,2198,2160,2139,2114,2078,2051,2042,2050,2080,2129,2184,2217,2218,2209,2206,2207,2213,2219,2214,2203,2184,2159,2147,2148,2138,2111,2089,2090,2111,2140,2163,2165,2159,2167,2174,2156,2137,2145,2165,2164,2135,2118,2138,2164,2154,2124,2122,2157,2183,2179,2165,2159,2166,2164,2123,2085,2111,2157,2152,2116,2116,2159,2178,2133,2096,2133,2188,2190,2157,2128,2123,2126,2103,2066,2059,2095,2153,2178,2143,2109,2122,2130,2098,2057,2051,2071,2069,2048,2070,2116,2119,2097,2099,2124,2146,2143,2123,2107,2095,2089,2095,2089,2071,2063,2064,2071,2083,2086,2077,2072,2070,2063,2056,2060,2083,2104,2100,2083,2074,2067,2062,2070,2077,2064,2050,2050,2062,2077,2078,2063,2051,2051,2060,2071,2066,2052,2056,2055,2029,2024,2048,2051,2028,2018,2032,2046,2050,2050,2045,2034,2032,2035,2030,2030,2041,2043,2034,2022,2016,2028,2040,2029,2015,2025,2045,2042,2014,2009,2035,2047,2043,2046,2051,2044,2026,2003,1997,2009,2019,2021,2013,2006,2009,2007,1997,2000,2012,2013,2005,1998,2000,2009,2008,2005,2010,2013,2015,2016,2009,2004,2001,1991,1991,1995,1986,1978,1981,1986,1997,2002,1993,1978,1967,1973,1991,1990,1979,1991,2010,2006,1991,1993,2000,1988,1972,1976,1985,1978,1968,1965,1968,1966,1955,1956,1972,1978,1983,1992,1990,1984,1978,1967,1970,1974,1953,1943,1971,2001,1997,1976,1971,1975,1965,1963,1988,2002,1992,1983,1978,1968,1957,1946,1954,1976,1981,1970,1964,1960,1963,1971,1972,1975,1983,1980,1970,1965,1957,1955,1971,1982,1976,1973,1974,1970,1967,1965,1966,1974,1970,1953,1951,1961,1961,1959,1963,1975,1989,1990,1985,1980,1956,1942,1961,1969,1955,1952,1947,1942,1962,1980,1975,1951,1931,1946,1970,1950,1930,1950,1965,1948,1926,1943,1983,1968,1912,1907,1937,1951,1968,1978,1958,1948,1945,1929,1923,1935,1948,1954,1948,1943,1946,1939,1929,1927,1921,1919,1929,1934,1935,1939,1938,1936,1945,1958,1954,1944,1951,1961,1947,1931,1935,1947,1947,1932,1921,1938,1960,1964,1957,1942,1933,1940,1945,1953,1968,1972,1969,1968,1964,1965,1954,1924,1921,1948,1965,1973,1965,1937,1938,1971,1975,1950,1938,1957,1969,1938,1922,1970,1996,1939,1880,1897,1960,2003,1999,1990,1996,1979,1936,1922,1954,1999,2009,1975,1948,1962,1969,1934,1907,1933,1989,2026,2021,1984,1951,1940,1940,1954,1978,1979,1954,1928,1927,1959,1996,2005,1999,1995,1980,1962,1956,1970,1998,2013,2007,2002,1996,1984,1977,1967,1965,1987,1999,1979,1955,1957,1989,2016,2006,1994,2012,2024,2009,1995,1994,1994,1983,1964,1965,1982,1984,1971,1967,1981,1998,2000,1999,2005,2006,2012,2022,2014,2005,2010,2006,1999,2003,2001,1985,1968,1956,1961,1980,1998,2006,1997,1988,2000,2011,2010,2022,2046,2055,2044,2023,2005,2003,2002,1988,1973,1973,1977,1968,1961,1975,1995,2008,2031,2059,2067,2054,2051,2067,2077,2062,2045,2043,2050,2060,2062,2054,2051,2054,2055,2057,2055,2043,2035,2044,2056,2061,2062,2062,2056,2046,2041,2035,2022,2013,2012,2020,2034,2038,2036,2044,2049,2041,2048,2059,2047,2035,2035,2025,2015,2026,2038,2031,2016,2010,2011,2016,2024,2025,2013,2013,2035,2052,2054,2061,2070,2070,2071,2072,2063,2045,2031,2032,2042,2062,2090,2100,2086,2082,2085,2067,2050,2056,2064,2071,2084,2093,2090,2077,2066,2073,2083,2080,2079,2084,2080,2071,2061,2059,2069,2074,2071,2079,2079,2061,2052,2055,2052,2047,2046,2047,2050,2052,2058,2067,2056,2034,2033,2042,2038,2037,2045,2046,2037,2026,2018,2018,2027,2034,2035,2046,2063,2068,2057,2041,2034,2037,2036,2030,2035,2043,2036,2023,2012,2002,2000,2008,2022,2037,2046,2044,2041,2047,2053,2048,2036,2034,2042,2046,2051,2057,2058,2056,2051,2047,2063,2096,2113,2107,2099,2093,2088,2085,2076,2071,2078,2085,2076,2062,2061,2068,2057,2035,2034,2049,2045,2028,2028,2033,2029,2022,2019,2022,2036,2052,2051,2041,2039,2048,2054,2050,2040,2031,2029,2037,2041,2034,2030,2036,2047,2063,2074,2078,2087,2091,2080,2078,2095,2102,2093,2095,2114,2122,2106,2100,2123,2138,2125,2112,2108,2106,2106,2099,2093,2102,2102,2084,2083,2096,2094,2086,2084,2082,2084,2086,2079,2080,2088,2081,2066,2062,2074,2093,2097,2076,2062,2071,2085,2094,2100,2096,2090,2093,2103,2117,2123,2115,2107,2105,2098,2092,2098,2104,2099,2093,2095,2094,2083,2085,2096,2089,2078,2093,2107,2102,2098,2108,2121,2122,2102,2088,2107,2132,2126,2111,2118,2136,2133,2117,2116,2130,2139,2135,2127,2130,2147,2159,2157,2157,2168,2172,2166,2166,2173,2169,2159,2166,2186,2192,2178,2163,2162,2174,2188,2189,2177,2166,2165,2171,2183,2191,2180,2164,2168,2186,2191,2179,2169,2166,2162,2159,2159,2156,2151,2153,2156,2160,2168,2173,2168,2169,2175,2166,2144,2138,2154,2162,2157,2155,2156,2156,2157,2158,2160,2164,2157,2158,2171,2165,2149,2154,2152,2142,2153,2156,2143,2145,2141,2129,2147,2166,2153,2143,2138,2135,2153,2159,2134,2121,2128,2120,2116,2133,2138,2121,2115,2125,2131,2134,2137,2129,2115,2117,2122,2117,2109,2109,2115,2118,2111,2110,2120,2122,2120,2127,2130,2109,2081,2093,2133,2137,2112,2117,2133,2125,2124,2132,2122,2107,2112,2129,2117,2074,2081,2144,2154,2106,2086,2096,2110,2122,2108,2090,2111,2126,2103,2086,2087,2088,2099,2117,2111,2079,2065,2078,2081,2078,2096,2112,2110,2109,2097,2074,2073,2091,2105,2111,2111,2116,2131,2129,2102,2077,2072,2082,2093,2095,2094,2092,2079,2070,2079,2093,2100,2102,2089,2071,2070,2081,2080,2077,2084,2085,2075,2072,2085,2100,2098,2082,2076,2075,2060,2055,2075,2089,2087,2090,2092,2084,2077,2071,2064,2066,2073,2079,2085,2089,2090,2088,2079,2069,2077,2093,2094,2090,2092,2086,2070,2065,2069,2066,2059,2051,2045,2048,2055,2057,2058,2052,2044,2043,2049,2059,2062,2043,2033,2049,2054,2045,2051,2051,2034,2031,2045,2059,2071,2067,2043,2034,2050,2058,2046,2039,2048,2048,2032,2033,2058,2076,2071,2052,2026,2009,2026,2070,2093,2071,2044,2043,2052,2057,2055,2044,2039,2043,2042,2048,2063,2053,2024,2021,2041,2046,2032,2027,2041,2050,2044,2040,2041,2036,2033,2038,2036,2028,2029,2030,2023,2017,2018,2020,2023,2026,2021,2016,2022,2023,2010,2004,2011,2022,2028,2024,2017,2013,2009,2002,2002,2013,2027,2031,2023,2019,2023,2021,2015,2017,2020,2021,2030,2036,2029,2021,2017,2012,2009,2012,2014,2010,2006,2009,2010,2010,2019,2031,2032,2028,2027,2026,2027,2028,2023,2018,2018,2021,2026,2027,2026,2029,2030,2030,2035,2035,2027,2020,2017,2019,2027,2030,2024,2022,2019,2011,2015,2024,2022,2022,2033,2037,2028,2018,2010,2010,2016,2013,2006,2006,2008,2002,1991,1981,1979,1986,1990,1989,1989,1990,1986,1983,1982,1982,1984,1984,1978,1975,1978,1977,1973,1967,1957,1950,1957,1966,1966,1965,1964,1961,1958,1959,1956,1951,1954,1956,1950,1942,1933,1929,1940,1953,1950,1941,1938,1942,1944,1945,1947,1943,1935,1938,1949,1953,1956,1965,1960,1940,1930,1938,1944,1940,1939,1947,1963,1976,1969,1949,1944,1955,1955,1946,1944,1951,1957,1959,1957,1949,1945,1952,1964,1964,1957,1963,1972,1965,1958,1958,1957,1965,1977,1970,1960,1975,1994,1986,1969,1971,1984,1988,1983,1981,1978,1969,1968,1974,1976,1980,1994,2007,2005,1993,1983,1976,1968,1972,1988,1999,1999,1994,1988,1987,1988,1989,1993,1994,1982,1975,1989,2002,1998,1982,1972,1973,1974,1967,1964,1977,1994,1999,1990,1987,1993,1991,1986,1990,1994,1984,1972,1970,1975,1973,1961,1960,1973,1977,1971,1969,1970,1964,1961,1970,1976,1968,1964,1977,1982,1967,1959,1967,1973,1967,1956,1954,1963,1967,1964,1969,1976,1972,1968,1974,1979,1974,1965,1963,1970,1974,1968,1962,1960,1961,1965,1960,1950,1957,1970,1969,1970,1972,1966,1967,1978,1975,1963,1967,1976,1972,1960,1953,1952,1952,1943,1930,1937,1954,1956,1948,1947,1950,1960,1971,1965,1954,1960,1967,1963,1962,1968,1964,1957,1965,1978,1973,1959,1954,1958,1964,1974,1978,1973,1971,1971,1970,1976,1983,1979,1979,1980,1971,1964,1972,1978,1976,1982,1989,1998,2012,2012,1988,1971,1972,1968,1959,1970,1998,2009,1997,1988,1992,1993,1986,1983,1983,1983,1985,1993,2002,2004,2000,2001,2003,1997,1994,2001,2008,2011,2012,2010,2005,2003,2008,2013,2012,2009,2002,2003,2017,2027,2019,2013,2021,2027,2030,2038,2039,2032,2025,2019,2020,2031,2040,2044,2043,2036,2035,2037,2033,2035,2043,2046,2052,2059,2058,2061,2066,2062,2066,2082,2079,2054,2045,2064,2074,2059,2053,2056,2045,2043,2059,2066,2063,2063,2065,2069,2074,2079,2084,2090,2093,2090,2079,2074,2079,2090,2095,2087,2080,2093,2106,2095,2084,2090,2094,2085,2080,2085,2085,2082,2083,2087,2089,2092,2094,2099,2104,2100,2094,2100,2112,2116,2114,2113,2115,2115,2109,2105,2104,2097,2090,2097,2108,2110,2111,2118,2124,2120,2105,2094,2105,2114,2106,2104,2116,2115,2102,2102,2108,2107,2107,2107,2103,2108,2121,2116,2100,2095,2099,2103,2099,2091,2091,2097,2101,2107,2115,2114,2112,2108,2102,2102,2104,2102,2103,2108,2110,2111,2112,2115,2120,2115,2102,2098,2100,2095,2092,2091,2089,2093,2102,2112,2112,2102,2092,2089,2096,2105,2099,2089,2098,2105,2095,2086,2083,2078,2072,2067,2066,2069,2067,2067,2065,2055,2061,2085,2092,2077,2064,2066,2075,2073,2063,2066,2078,2085,2090,2089,2078,2073,2079,2079,2072,2075,2079,2073,2068,2064,2065,2076,2083,2080,2077,2076,2078,2076,2073,2085,2094,2081,2072,2080,2087,2090,2083,2068,2067,2081,2093,2096,2088,2076,2077,2087,2090,2080,2070,2081,2101,2107,2104,2102,2099,2095,2095,2100,2107,2114,2123,2127,2124,2122,2115,2101,2096,2104,2118,2132,2138,2139,2139,2127,2115,2125,2139,2134,2131,2135,2128,2122,2126,2136,2148,2147,2138,2154,2173,2159,2140,2143,2151,2158,2167,2172,2171,2166,2160,2154,2141,2124,2125,2144,2161,2171,2175,2171,2160,2153,2153,2157,2164,2160,2148,2150,2166,2174,2163,2141,2129,2139,2153,2164,2175,2179,2176,2174,2166,2157,2166,2178,2176,2179,2185,2173,2161,2164,2167,2161,2156,2157,2168,2175,2166,2148,2141,2146,2152,2150,2148,2159,2182,2197,2187,2171,2163,2154,2152,2159,2148,2135,2144,2161,2168,2158,2144,2146,2148,2142,2142,2141,2144,2168,2175,2162,2156,2144,2130,2139,2147,2142,2148,2159,2155,2144,2141,2148,2151,2146,2144,2142,2135,2135,2140,2138,2129,2124,2125,2133,2147,2153,2143,2136,2140,2141,2138,2131,2119,2114,2122,2129,2126,2125,2125,2116,2106,2110,2118,2123,2122,2113,2111,2119,2119,2109,2105,2106,2105,2098,2092,2096,2096,2089,2085,2080,2077,2085,2092,2089,2088,2088,2082,2076,2080,2085,2071,2047,2046,2059,2058,2052,2056,2063,2056,2034,2020,2031,2051,2066,2081,2091,2086,2084,2089,2085,2069,2053,2052,2063,2060,2042,2037,2038,2026,2011,2005,2007,2014,2024,2037,2052,2059,2055,2053,2052,2039,2022,2021,2022,2007,1999,2006,2016,2025,2031,2022,2017,2029,2031,2013,2003,2010,2011,2001,1994,1994,2006,2029,2036,2023,2012,2013,2019,2017,2015,2026,2040,2046,2045,2029,2004,1993,1988,1972,1959,1969,2000,2035,2054,2051,2039,2031,2031,2030,2019,2007,2009,2023,2024,2016,2017,2011,1990,1974,1970,1982,2009,2026,2027,2024,2027,2033,2033,2025,2018,2015,2023,2031,2021,2005,1997,1992,1998,2014,2026,2032,2035,2032,2027,2021,2023,2029,2022,2013,2023,2035,2031,2022,2022,2026,2023,2020,2021,2007,1985,1985,1999,2007,2014,2027,2043,2051,2043,2035,2036,2035,2036,2039,2036,2025,2016,2019,2026,2025,2026,2045,2061,2051,2035,2028,2023,2025,2032,2027,2013,2012,2032,2048,2036,2015,2014,2026,2034,2042,2049,2050,2044,2037,2035,2033,2027,2023,2024,2030,2037,2042,2038,2028,2022,2019,2006,1999,2013,2030,2041,2050,2037,2006,1986,1980,1985,2000,2013,2023,2038,2047,2037,2021,2021,2035,2041,2025,2005,1993,1986,1989,2002,2011,2020,2036,2044,2033,2020,2027,2042,2044,2042,2046,2041,2019,1986,1946,1931,1965,2010,2039,2061,2061,2028,1973,1931,1935,1976,2014,2040,2046,2022,1992,1975,1976,2004,2041,2063,2071,2063,2036,2004,1984,1979,1975,1967,1964,1961,1964,1990,2013,2012,2001,1992,1994,2006,1997,1976,1967,1959,1953,1963,1974,1986,2003,2009,2005,2007,2010,2011,2014,2005,1982,1963,1953,1953,1962,1973,1988,2010,2019,2006,1984,1967,1959,1960,1966,1972,1975,1976,1976,1976,1976,1973,1970,1979,1999,2007,2009,2012,1995,1967,1959,1971,1980,1977,1975,1981,1986,1982,1977,1979,1981,1971,1947,1919,1907,1916,1932,1949,1973,1984,1964,1943,1949,1962,1972,1986,1997,1993,1985,1986,1995,2008,2018,2018,2006,1990,1980,1972,1967,1976,1991,1997,1998,1995,1978,1950,1920,1895,1895,1928,1973,2006,2015,1998,1968,1946,1942,1947,1954,1967,1986,1996,1995,1985,1971,1969,1975,1971,1966,1968,1964,1966,1986,1999,1995,1984,1965,1942,1929,1937,1962,1988,1999,1996,1974,1944,1938,1948,1961,1988,2019,2035,2043,2040,2023,2010,1994,1971,1960,1957,1956,1968,1979,1975,1969,1968,1974,1983,1987,1993,1996,1978,1957,1959,1970,1982,2001,2018,2020,2009,1990,1971,1960,1967,1992,2028,2055,2059,2044,2024,2006,1989,1970,1954,1953,1965,1982,2008,2045,2074,2089,2087,2058,2022,2000,1984,1985,1999,2000,2006,2038,2062,2068,2080,2083,2056,2011,1971,1958,1964,1964,1966,2002,2062,2088,2055,2006,1983,1981,1982,1962,1928,1924,1923,1918,2020,2194,2239,2151,2066,1991,1920,1908,1962,2039,2093,2103,2100,2106,2101,2058,1927,1703,1501,1479,1739,2242,2781,3109,3048,2565,1832,1090,558,454,863,1656,2601,3405,3814,3760,3259,2407,1466,701,284,285,603,1069,1551,1941,2263,2619,2972,3296,3613,3694,3324,2724,2156,1587,1073,889,1104,1531,2022,2445,2656,2666,2544,2280,1943,1627,1356,1202,1210,1278,1351,1427,1452,1479,1631,1934,2366,2861,3278,3498,3429,3049,2467,1816,1246,985,1129,1569,2200,2922,3493,3689,3485,3005,2427,1977,1789,1766,1746,1656,1475,1237,1051,1037,1278,1755,2293,2685,2803,2612,2176,1626,1123,824,777,935,1255,1659,2057,2438,2801,3084,3209,3127,2879,2597,2381,2298,2378,2509,2513,2338,2049,1781,1736,2065,2710,3402,3806,3696,3083,2172,1250,579,290,356,725,1335,2036,2701,3289,3680,3701,3320,2660,1892,1178,638,364,372,579,946,1487,2145,2823,3409,3774,3853,3631,3123,2451,1771,1181,787,657,737,951,1247,1587,1975,2441,2974,3487,3839,3939,3756,3289,2615,1862,1146,610,388,526,993,1672,2372,2916,3150,3004,2604,2171,1894,1920,2238,2623,2810,2638,2111,1426,860,627,808,1310,1928,2450,2721,2726,2609,2525,2529,2604,2711,2795,2787,2641,2391,2120,1877,1677,1545,1504,1558,1701,1883,2033,2103,2092,2060,2089,2221,2424,2608,2648,2482,2164,1805,1518,1371,1355,1438,1604,1839,2116,2376,2535,2515,2300,1976,1719,1676,1863,2164,2393,2407,2179,1827,1567,1558,1791,2139,2462,2638,2588,2332,1999,1740,1622,1630,1725,1867,2026,2181,2287,2286,2165,1969,1777,1685,1763,1990,2236,2345,2259,2040,1798,1629,1597,1702,1892,2113,2307,2417,2446,2430,2368,2262,2154,2096,2108,2183,2292,2380,2369,2228,2030,1883,1866,2011,2276,2566,2777,2830,2723,2547,2408,2358,2386,2439,2460,2416,2318,2207,2122,2100,2152,2240,2345,2460,2557,2638,2687,2615,2410,2173,1978,1861,1843,1888,1948,1989,1985,1930,1836,1724,1670,1759,1973,2202,2357,2410,2333,2112,1815,1535,1369,1436,1751,2196,2633,2914,2882,2506,1961,1528,1389,1558,1982,2533,2992,3192,3048,2583,1999,1534,1284,1254,1404,1639,1871,2041,2117,2121,2081,2015,1943,1887,1853,1821,1763,1690,1600,1496,1444,1490,1596,1706,1775,1803,1812,1790,1788,1883,2049,2237,2432,2546,2528,2455,2371,2255,2128,2050,2061,2166,2339,2524,2668,2748,2714,2535,2314,2161,2072,2076,2212,2374,2434,2356,2177,2003,1924,1910,1919,1973,2074,2153,2157,2100,2012,1911,1832,1808,1860,1992,2148,2238,2231,2130,1994,1931,1954,2022,2154,2308,2371,2318,2176,1979,1822,1810,1971,2236,2489,2647,2661,2491,2171,1841,1647,1647,1816,2104,2435,2683,2747,2593,2262,1878,1555,1366,1369,1534,1758,2016,2268,2403,2408,2359,2278,2166,2046,1961,1957,1992,1980,1940,1953,2022,2065,2037,1992,1976,1964,1950,1949,1958,1967,1969,1963,1972,2007,2052,2062,2000,1906,1831,1756,1694,1712,1828,2008,2172,2253,2263,2210,2079,1939,1877,1900,1976,2062,2126,2159,2134,2042,1917,1790,1702,1706,1815,1995,2157,2205,2142,2019,1872,1749,1696,1733,1868,2058,2198,2231,2189,2093,1946,1843,1852,1916,2046,2234,2277,2201,2261,2272,1994,1820,1978,2050,1912,1882,1970,2027,2040,1887,1587,1536,1793,1917,1825,1840,1965,1993,1914,1823,1799,1835,1820,1794,1904,2063,2090,2001,1922,1951,2059,2083,2023,2058,2177,2204,2124,2036,1944,1832,1793,1917,2125,2238,2195,2111,2088,2048,1939,1890,1987,2128,2219,2256,2245,2168,2028,1899,1849,1857,1900,1982,2081,2176,2214,2124,1983,1915,1897,1887,1923,2006,2091,2130,2112,2094,2109,2110,2070,2049,2098,2176,2202,2168,2133,2127,2121,2101,2109,2144,2138,2115,2144,2158,2088,1998,1955,1987,2065,2109,2128,2187,2238,2238,2228,2213,2189,2179,2185,2217,2271,2275,2207,2137,2095,2054,2017,2001,2013,2078,2184,2244,2208,2133,2056,1987,1957,1962,2001,2092,2161,2142,2094,2059,2023,2008,2025,2081,2191,2289,2312,2284,2247,2204,2135,2040,2003,2078,2179,2214,2184,2119,2045,1977,1926,1915,1962,2038,2087,2113,2130,2072,1950,1905,1949,1973,1968,1981,2035,2129,2175,2113,2012,1914,1831,1823,1897,1994,2091,2170,2186,2139,2089,2063,2026,1991,2016,2057,2041,2004,1987,1973,1960,1966,1971,1933,1904,1972,2052,2024,1960,1925,1876,1850,1905,1974,2005,2022,2004,1934,1870,1868,1892,1892,1907,1959,1989,1970,1928,1887,1865,1861,1856,1847,1843,1847,1860,1855,1822,1802,1798,1775,1753,1779,1859,1940,1951,1896,1850,1838,1821,1791,1779,1797,1816,1828,1841,1847,1846,1849,1835,1802,1788,1803,1829,1868,1915,1946,1942,1897,1835,1776,1721,1692,1727,1800,1850,1861,1858,1850,1837,1841,1855,1847,1821,1799,1775,1751,1738,1742,1765,1800,1845,1886,1905,1917,1910,1833,1740,1726,1762,1810,1884,1943,1948,1926,1884,1832,1811,1831,1865,1902,1959,2019,2034,2001,1958,1919,1888,1876,1878,1901,1944,1980,2008,2025,2021,1994,1939,1876,1856,1881,1921,1966,2000,2009,2002,1980,1958,1952,1947,1938,1930,1921,1923,1938,1947,1952,1977,2036,2096,2101,2066,2049,2041,2003,1949,1919,1932,1976,2040,2113,2159,2152,2117,2075,2034,2026,2057,2095,2121,2137,2147,2143,2116,2090,2085,2085,2094,2124,2156,2181,2192,2175,2142,2118,2105,2106,2111,2111,2120,2138,2146,2141,2130,2122,2131,2158,2185,2198,2203,2202,2181,2145,2129,2126,2119,2136,2176,2201,2200,2184,2160,2144,2141,2141,2141,2158,2197,2234,2249,2254,2233,2186,2166,2182,2209,2242,2280,2314,2326,2293,2248,2227,2214,2214,2235,2252,2267,2280,2271,2254,2244,2234,2229,2220,2215,2237,2258,2249,2222,2182,2151,2166,2210,2261,2294,2277,2236,2210,2192,2177,2162,2156,2187,2243,2278,2290,2285,2259,2214,2168,2141,2132,2140,2167,2191,2196,2204,2207,2177,2154,2174,2199,2197,2204,2234,2234,2187,2149,2137,2129,2130,2146,2153,2159,2176,2189,2184,2167,2143,2119,2109,2120,2145,2168,2174,2170,2164,2147,2131,2138,2147,2136,2130,2142,2153,2154,2141,2125,2127,2133,2126,2128,2150,2172,2178,2162,2128,2104,2098,2093,2090,2105,2121,2117,2103,2091,2084,2082,2084,2086,2091,2092,2090,2078,2046,2011,2000,2005,2006,2010,2023,2037,2048,2063,2078,2078,2065,2043,2016,2009,2021,2029,2032,2031,2014,1993,1983,1981,1989,2009,2040,2058,2044,2026,2019,1998,1974,1975,1987,1992,1989,1988,2002,2010,1993,1973,1954,1931,1929,1944,1947,1950,1959,1945,1921,1919,1932,1942,1958,1974,1960,1922,1899,1896,1895,1903,1926,1939,1929,1921,1922,1910,1887,1867,1866,1883,1892,1884,1883,1892,1905,1908,1887,1868,1870,1873,1885,1912,1925,1938,1957,1943,1915,1906,1891,1875,1883,1899,1911,1923,1930,1925,1908,1893,1896,1901,1901,1906,1906,1903,1911,1919,1919,1914,1903,1895,1910,1950,1990,1999,1982,1960,1934,1925,1945,1962,1952,1943,1944,1939,1939,1955,1969,1964,1954,1958,1973,1982,1978,1963,1949,1952,1969,1988,2004,2013,2017,2022,2019,2000,1975,1955,1946,1966,2000,2023,2025,2023,2030,2036,2023,2009,2017,2035,2048,2059,2066,2065,2054,2041,2035,2030,2032,2049,2072,2090,2104,2107,2105,2103,2095,2091,2092,2092,2109,2128,2128,2129,2135,2134,2151,2172,2163,2158,2161,2141,2118,2113,2107,2118,2145,2160,2176,2196,2185,2155,2144,2149,2151,2151,2150,2150,2151,2173,2218,2249,2264,2281,2274,2237,2221,2248,2282,2284,2268,2277,2299,2304,2290,2249,2227,2268,2299,2270,2254,2250,2226,2216,2221,2228,2258,2285,2278,2259,2249,2260,2268,2258,2263,2282,2283,2283,2291,2294,2295,2279,2254,2246,2247,2269,2302,2310,2319,2331,2311,2313,2345,2344,2347,2365,2353,2343,2349,2349,2366,2380,2363,2355,2364,2364,2370,2388,2393,2371,2350,2344,2324,2296,2298,2327,2356,2373,2364,2351,2342,2320,2300,2302,2307,2321,2335,2323,2311,2320,2330,2326,2314,2312,2315,2304,2302,2319,2321,2313,2306,2295,2288,2286,2288,2285,2256,2228,2235,2243,2239,2246,2249,2241,2232,2218,2215,2220,2207,2192,2198,2209,2223,2240,2268,2291,2277,2251,2248,2230,2190,2174,2192,2233,2283,2290,2251,2229,2228,2215,2187,2163,2165,2197,2222,2211,2186,2172,2163,2153,2148,2142,2133,2126,2106,2071,2056,2079,2097,2095,2101,2120,2129,2128,2129,2121,2093,2057,2035,2029,2029,2043,2066,2063,2029,2006,1999,1982,1969,1986,2018,2040,2055,2056,2035,2016,2011,1988,1961,1957,1959,1953,1957,1977,1992,1980,1940,1908,1901,1905,1911,1912,1891,1853,1814,1789,1795,1827,1848,1833,1802,1784,1783,1786,1785,1780,1777,1783,1797,1810,1822,1827,1822,1818,1815,1806,1807,1817,1810,1793,1789,1784,1775,1780,1793,1797,1797,1792,1780,1776,1781,1780,1779,1780,1765,1746,1746,1757,1765,1770,1764,1746,1728,1720,1725,1738,1750,1763,1783,1803,1808,1795,1775,1761,1760,1764,1765,1762,1778,1824,1871,1884,1849,1794,1762,1761,1780,1828,1889,1920,1896,1823,1750,1747,1818,1899,1941,1934,1899,1868,1856,1861,1873,1879,1865,1837,1828,1855,1887,1891,1873,1844,1822,1833,1865,1892,1900,1879,1845,1825,1824,1845,1869,1866,1859,1872,1889,1908,1933,1940,1916,1875,1846,1868,1925,1971,1987,1974,1939,1913,1914,1930,1947,1966,1977,1962,1946,1959,1980,1977,1964,1959,1955,1953,1960,1973,1982,1979,1959,1928,1901,1887,1889,1908,1934,1955,1976,1988,1982,1980,1992,1997,1985,1960,1931,1910,1902,1911,1934,1950,1956,1965,1972,1969,1961,1960,1970,1974,1967,1964,1967,1968,1963,1958,1966,1982,1980,1963,1947,1934,1933,1953,1980,1997,1999,1984,1967,1964,1968,1967,1966,1966,1962,1961,1975,1988,1995,2004,2003,1991,1991,2000,2008,2016,2024,2039,2047,2031,2008,1995,1986,1982,1980,1972,1970,1973,1980,1993,1998,1989,1979,1971,1967,1973,1979,1979,1975,1977,1993,2006,2000,1985,1976,1980,1990,1995,2004,2021,2033,2038,2038,2032,2034,2039,2033,2032,2038,2037,2037,2042,2043,2034,2018,2011,2021,2036,2047,2048,2034,2027,2035,2041,2037,2032,2027,2027,2028,2015,2002,2013,2037,2058,2077,2086,2079,2068,2063,2070,2085,2088,2080,2078,2083,2087,2092,2100,2108,2114,2109,2101,2104,2114,2122,2129,2140,2142,2136,2143,2152,2147,2147,2153,2140,2121,2120,2126,2131,2132,2132,2137,2133,2106,2091,2109,2124,2120,2123,2137,2140,2125,2110,2111,2131,2147,2141,2132,2138,2151,2161,2156,2142,2144,2157,2162,2157,2150,2151,2163,2173,2170,2164,2156,2152,2157,2154,2140,2136,2143,2149,2150,2157,2172,2185,2188,2179,2161,2145,2134,2130,2147,2171,2177,2172,2168,2159,2149,2142,2136,2137,2136,2140,2156,2158,2153,2169,2180,2173,2170,2167,2157,2154,2156,2164,2170,2160,2140,2136,2149,2159,2160,2164,2164,2143,2123,2127,2133,2139,2160,2176,2171,2150,2122,2103,2105,2116,2127,2135,2139,2139,2133,2122,2119,2124,2124,2118,2113,2107,2109,2128,2142,2136,2116,2103,2107,2119,2117,2103,2090,2088,2100,2117,2123,2118,2111,2106,2113,2124,2121,2109,2098,2087,2085,2096,2101,2094,2083,2071,2062,2060,2061,2067,2071,2069,2071,2078,2079,2077,2076,2073,2066,2057,2045,2038,2044,2058,2068,2067,2056,2046,2035,2026,2024,2028,2038,2051,2054,2039,2024,2030,2042,2042,2035,2030,2022,2010,1997,1997,2014,2026,2019,2016,2019,2011,1997,1992,2002,2023,2032,2026,2013,1997,1993,2015,2031,2016,1997,1994,1993,1992,1990,1989,1997,2010,2013,2005,1993,1980,1969,1964,1976,2003,2030,2046,2037,2007,1982,1966,1957,1966,1987,2006,2015,2012,2008,2014,2019,2030,2041,2029,2004,1981,1961,1959,1974,1985,1989,1999,2013,2024,2028,2031,2032,2027,2023,2025,2025,2012,1993,1989,1995,1994,1996,2012,2026,2021,1996,1981,2003,2037,2055,2062,2053,2037,2031,2028,2021,2017,2012,2013,2017,2013,2012,2018,2021,2025,2034,2041,2035,2015,2000,2003,2020,2041,2046,2037,2039,2041,2030,2027,2037,2045,2042,2032,2032,2042,2048,2054,2066,2070,2061,2048,2044,2049,2054,2060,2066,2064,2057,2052,2055,2062,2061,2061,2069,2069,2060,2056,2058,2064,2066,2062,2057,2058,2066,2076,2075,2064,2061,2064,2068,2072,2078,2081,2082,2086,2090,2083,2076,2074,2072,2069,2065,2067,2082,2092,2085,2079,2075,2070,2075,2082,2083,2091,2089,2071,2058,2057,2063,2072,2072,2064,2061,2068,2079,2077,2064,2065,2079,2075,2057,2048,2048,2042,2036,2044,2061,2073,2081,2079,2064,2054,2047,2036,2040,2055,2066,2082,2087,2069,2050,2044,2046,2058,2067,2062,2057,2052,2054,2070,2086,2093,2090,2076,2064,2062,2059,2058,2073,2091,2095,2087,2076,2064,2054,2047,2045,2053,2066,2071,2068,2064,2061,2066,2075,2072,2063,2059,2051,2042,2049,2066,2074,2075,2074,2070,2063,2057,2046,2038,2043,2052,2058,2064,2067,2064,2061,2062,2063,2053,2032,2021,2033,2056,2070,2076,2079,2071,2055,2049,2049,2040,2026,2025,2043,2059,2061,2060,2062,2067,2070,2053,2029,2037,2068,2083,2075,2061,2057,2062,2065,2065,2061,2049,2042,2058,2082,2076,2054,2065,2081,2062,2059,2078,2074,2061,2060,2068,2082,2094,2101,2107,2100,2092,2091,2089,2107,2115,2080,2066,2088,2093,2096,2115,2114,2103,2104,2108,2103,2093,2091,2101,2117,2140,2150,2132,2118,2121,2126,2128,2127,2120,2125,2143,2151,2139,2127,2127,2126,2118,2116,2126,2137,2138,2137,2143,2144,2128,2114,2124,2134,2126,2124,2145,2158,2151,2142,2138,2142,2154,2161,2164,2168,2166,2163,2162,2157,2152,2149,2150,2160,2173,2182,2181,2167,2152,2148,2149,2153,2156,2151,2154,2162,2155,2148,2154,2158,2148,2133,2127,2130,2131,2130,2136,2145,2150,2142,2126,2122,2138,2153,2158,2158,2154,2145,2139,2130,2108,2096,2108,2133,2153,2155,2143,2133,2127,2127,2144,2156,2143,2131,2141,2146,2126,2109,2110,2109,2103,2103,2103,2110,2124,2110,2084,2090,2105,2094,2084,2104,2129,2120,2094,2092,2102,2091,2072,2060,2057,2076,2094,2085,2067,2057,2051,2056,2059,2049,2049,2068,2074,2064,2062,2062,2058,2055,2052,2051,2063,2077,2074,2057,2046,2039,2023,2011,2020,2034,2043,2057,2064,2055,2048,2050,2053,2051,2050,2051,2048,2037,2037,2049,2051,2044,2042,2043,2044,2047,2050,2051,2042,2024,2014,2010,1997,1983,1982,1985,1981,1975,1976,1982,1978,1959,1947,1958,1976,1975,1960,1951,1951,1958,1960,1953,1954,1963,1965,1980,2002,1996,1985,1990,1988,1982,1984,1991,2007,2012,1998,1994,1997,1997,2004,2004,1991,1988,1994,2001,2005,1995,1985,1989,1993,1987,1982,1989,1997,1992,1983,1981,1983,1984,1980,1972,1968,1964,1954,1949,1948,1953,1962,1959,1954,1964,1968,1962,1961,1961,1951,1938,1941,1957,1970,1975,1975,1958,1937,1930,1934,1935,1931,1931,1935,1935,1928,1919,1912,1917,1924,1921,1914,1920,1934,1948,1956,1949,1927,1909,1907,1905,1902,1914,1931,1937,1932,1922,1915,1919,1930,1939,1946,1949,1947,1947,1953,1952,1949,1953,1951,1940,1938,1946,1949,1950,1954,1960,1964,1963,1961,1963,1966,1965,1960,1960,1961,1957,1952,1948,1948,1957,1964,1958,1956,1961,1964,1960,1952,1955,1961,1949,1938,1951,1963,1963,1960,1957,1961,1964,1954,1942,1946,1956,1962,1959,1958,1963,1965,1959,1954,1954,1964,1977,1980,1973,1972,1976,1974,1965,1954,1950,1955,1959,1957,1956,1960,1957,1949,1944,1940,1935,1932,1930,1926,1925,1930,1937,1944,1951,1956,1958,1960,1964,1961,1954,1953,1956,1957,1955,1954,1957,1959,1953,1950,1958,1965,1960,1953,1958,1970,1975,1975,1977,1983,1986,1980,1974,1969,1962,1961,1971,1981,1990,1993,1985,1967,1950,1945,1963,1989,2000,2000,1998,1991,1981,1978,1997,2010,1995,1984,1999,2007,1998,1994,1999,2011,2021,2018,2007,1999,1999,2017,2035,2026,2012,2013,2016,2019,2025,2028,2034,2038,2032,2033,2045,2045,2031,2021,2024,2027,2023,2016,2017,2026,2036,2041,2044,2046,2041,2035,2040,2047,2048,2051,2055,2051,2050,2054,2053,2044,2036,2038,2049,2058,2065,2066,2063,2060,2058,2062,2073,2072,2060,2059,2065,2063,2064,2070,2070,2062,2056,2060,2065,2064,2065,2068,2061,2056,2061,2061,2051,2045,2049,2058,2060,2056,2051,2046,2047,2057,2062,2061,2063,2053,2033,2032,2047,2056,2058,2052,2039,2037,2044,2044,2043,2047,2049,2043,2043,2057,2068,2067,2062,2060,2058,2059,2062,2061,2057,2054,2056,2059,2063,2068,2072,2074,2073,2071,2075,2080,2080,2078,2077,2072,2063,2059,2059,2066,2074,2078,2081,2083,2080,2072,2073,2084,2092,2090,2085,2083,2084,2091,2100,2098,2088,2082,2075,2066,2062,2070,2078,2076,2076,2082,2081,2083,2098,2100,2088,2086,2086,2073,2065,2074,2083,2083,2083,2089,2091,2088,2084,2077,2070,2069,2069,2072,2078,2075,2070,2077,2083,2080,2074,2074,2083,2091,2089,2093,2096,2077,2060,2063,2066,2070,2083,2086,2075,2070,2075,2072,2066,2076,2095,2097,2089,2085,2081,2080,2079,2081,2085,2083,2080,2099,2116,2097,2072,2085,2126,2151,2127,2069,2028,2041,2117,2200,2210,2129,2018,1955,1989,2101,2219,2273,2229,2113,2004,1953,1963,2029,2127,2205,2234,2210,2148,2082,2042,2034,2050,2068,2076,2091,2122,2152,2172,2178,2165,2138,2112,2097,2093,2101,2116,2119,2109,2106,2116,2119,2115,2126,2139,2141,2143,2141,2119,2104,2118,2135,2131,2127,2147,2171,2164,2138,2124,2121,2120,2126,2133,2130,2130,2138,2136,2126,2127,2129,2123,2119,2120,2124,2136,2140,2132,2136,2145,2135,2120,2118,2119,2118,2117,2114,2112,2111,2111,2117,2121,2120,2126,2133,2128,2127,2128,2115,2109,2122,2121,2107,2108,2116,2117,2116,2113,2113,2119,2120,2115,2115,2114,2108,2109,2119,2122,2117,2116,2121,2123,2123,2125,2128,2127,2126,2134,2137,2116,2100,2110,2114,2101,2091,2085,2091,2112,2120,2112,2099,2093,2102,2105,2090,2097,2112,2093,2079,2096,2105,2104,2101,2083,2068,2080,2104,2127,2112,2058,2044,2086,2097,2068,2065,2086,2085,2069,2076,2100,2094,2076,2080,2083,2075,2071,2050,2024,2026,2033,2048,2085,2102,2092,2083,2069,2058,2066,2075,2082,2076,2058,2067,2082,2078,2080,2071,2050,2056,2053,2034,2065,2090,2046,2019,2037,2044,2058,2070,2038,2019,2051,2059,2038,2032,2023,2025,2069,2084,2052,2052,2069,2063,2077,2094,2077,2057,2048,2026,1993,1981,2023,2064,2041,2017,2037,2053,2054,2054,2051,2054,2058,2065,2063,2023,1989,2013,2065,2073,1993,1941,2013,2032,1970,2020,2064,2050,2186,2234,1961,1782,1935,2147,2159,1928,1847,2177,2336,2025,1838,1949,1971,1885,1891,2033,2222,2290,2276,2341,2351,2142,1901,1834,1837,1797,1780,1770,1764,1939,2168,2153,2126,2308,2399,2293,2212,2198,2144,1979,1813,1840,1908,1843,1856,2028,2187,2292,2320,2296,2322,2315,2244,2226,2183,2048,1943,1886,1865,1903,1934,1964,2078,2244,2416,2598,2756,2846,2815,2652,2437,2216,1967,1726,1586,1578,1597,1516,1363,1281,1322,1393,1402,1387,1409,1458,1533,1639,1756,1899,2061,2189,2283,2372,2455,2541,2636,2726,2768,2751,2757,2808,2800,2740,2746,2799,2808,2772,2744,2750,2723,2621,2565,2638,2722,2713,2645,2558,2457,2346,2214,2048,1887,1778,1680,1549,1441,1379,1297,1190,1130,1124,1122,1100,1070,1051,1015,934,849,821,837,846,854,898,986,1098,1218,1330,1442,1573,1699,1800,1906,2030,2137,2193,2228,2305,2428,2567,2753,3005,3247,3413,3522,3597,3622,3594,3536,3453,3333,3195,3083,2995,2891,2774,2680,2613,2558,2529,2533,2552,2562,2550,2494,2376,2212,2045,1909,1808,1746,1721,1709,1709,1727,1740,1748,1769,1767,1719,1666,1607,1510,1431,1418,1413,1378,1347,1344,1378,1438,1476,1483,1485,1474,1436,1386,1351,1325,1284,1255,1274,1285,1271,1318,1397,1376,1306,1314,1351,1345,1334,1335,1313,1287,1275,1261,1264,1293,1303,1301,1342,1408,1452,1516,1631,1733,1787,1835,1893,1951,2013,2059,2078,2108,2157,2216,2290,2351,2407,2497,2559,2559,2595,2677,2721,2751,2801,2843,2891,2948,2975,2989,3002,2985,2973,3002,3027,3039,3064,3071,3040,3023,3043,3050,3016,2978,2965,2955,2935,2923,2914,2887,2838,2790,2759,2710,2628,2558,2502,2412,2313,2243,2177,2105,2034,1952,1865,1777,1691,1628,1568,1481,1405,1367,1339,1299,1259,1242,1236,1215,1194,1193,1195,1204,1216,1208,1187,1172,1184,1227,1245,1236,1251,1261,1257,1299,1347,1343,1334,1343,1373,1442,1505,1526,1532,1534,1554,1597,1624,1638,1661,1683,1724,1781,1816,1842,1878,1905,1926,1939,1947,1982,2037,2075,2098,2117,2142,2172,2178,2160,2145,2137,2149,2176,2187,2187,2194,2205,2211,2204,2193,2197,2192,2177,2184,2200,2197,2192,2197,2210,2213,2195,2171,2164,2166,2173,2173,2154,2131,2125,2124,2112,2098,2102,2111,2103,2099,2106,2105,2108,2112,2095,2081,2075,2055,2048,2063,2065,2062,2065,2048,2026,2025,2039,2057,2062,2053,2063,2073,2055,2052,2070,2067,2059,2068,2077,2081,2091,2100,2114,2139,2164,2181,2189,2200,2224,2250,2268,2285,2297,2309,2335,2354,2349,2364,2419,2455,2456,2468,2486,2495,2514,2534,2542,2553,2563,2572,2590,2579,2557,2584,2613,2591,2578,2584,2574,2578,2581,2545,2525,2543,2549,2522,2473,2436,2426,2394,2350,2348,2337,2296,2291,2298,2257,2202,2164,2141,2135,2117,2070,2019,1978,1959,1947,1908,1866,1845,1824,1800,1777,1742,1715,1695,1665,1639,1608,1565,1541,1520,1487,1483,1486,1453,1425,1419,1413,1402,1374,1345,1353,1367,1344,1310,1287,1278,1287,1283,1252,1228,1227,1234,1235,1221,1209,1235,1274,1269,1240,1241,1252,1264,1288,1284,1277,1317,1336,1318,1354,1401,1383,1376,1421,1464,1468,1444,1447,1499,1529,1533,1568,1596,1591,1607,1647,1677,1684,1686,1707,1726,1741,1788,1826,1819,1836,1876,1885,1894,1915,1920,1938,1970,1980,1996,2024,2033,2054,2115,2150,2122,2118,2181,2213,2205,2261,2339,2314,2242,2260,2341,2359,2313,2329,2403,2409,2374,2400,2449,2476,2507,2513,2498,2530,2579,2575,2566,2599,2637,2650,2655,2647,2636,2654,2675,2662,2676,2727,2717,2668,2698,2777,2818,2836,2829,2788,2777,2807,2801,2757,2764,2819,2819,2748,2703,2715,2745,2778,2798,2800,2817,2819,2784,2789,2826,2796,2730,2715,2742,2747,2695,2635,2644,2699,2740,2743,2725,2740,2769,2734,2667,2629,2577,2524,2538,2571,2556,2543,2573,2558,2463,2426,2485,2498,2456,2437,2404,2357,2333,2296,2270,2287,2293,2291,2291,2259,2241,2242,2201,2164,2156,2129,2089,2043,2001,2002,1994,1946,1922,1914,1900,1920,1949,1955,1947,1911,1877,1876,1842,1760,1713,1713,1691,1637,1623,1644,1615,1551,1533,1545,1543,1528,1511,1511,1503,1448,1419,1449,1444,1409,1422,1445,1418,1373,1342,1310,1280,1295,1355,1386,1376,1412,1496,1528,1510,1534,1588,1600,1584,1561,1516,1461,1399,1334,1314,1337,1351,1355,1371,1390,1407,1415,1421,1452,1486,1498,1503,1505,1498,1498,1521,1543,1541,1543,1570,1596,1634,1708,1758,1748,1733,1734,1730,1714,1701,1728,1789,1813,1796,1794,1799,1791,1797,1826,1852,1868,1883,1896,1915,1944,1943,1926,1958,2005,2008,1996,1982,1958,1970,2004,1999,1984,2015,2066,2093,2095,2091,2099,2119,2125,2105,2099,2116,2119,2121,2131,2108,2078,2083,2087,2074,2072,2069,2074,2094,2096,2093,2116,2148,2177,2208,2239,2252,2230,2214,2243,2281,2300,2312,2326,2331,2314,2304,2326,2346,2372,2431,2468,2485,2523,2529,2512,2540,2563,2556,2555,2550,2569,2617,2623,2631,2683,2710,2713,2731,2741,2735,2717,2706,2717,2704,2694,2739,2754,2734,2780,2844,2865,2884,2881,2854,2855,2871,2871,2848,2818,2814,2813,2802,2802,2788,2781,2813,2801,2753,2761,2769,2749,2764,2752,2694,2688,2699,2674,2674,2704,2716,2713,2708,2709,2706,2686,2675,2662,2621,2588,2566,2538,2528,2511,2473,2479,2507,2484,2443,2423,2410,2396,2363,2334,2345,2345,2314,2300,2283,2244,2226,2221,2214,2214,2201,2186,2182,2143,2090,2080,2072,2040,2017,1997,1960,1917,1891,1880,1860,1822,1783,1762,1773,1778,1730,1694,1702,1684,1641,1610,1572,1548,1552,1549,1544,1534,1511,1507,1495,1476,1506,1521,1486,1504,1526,1457,1415,1460,1476,1430,1391,1397,1429,1446,1439,1438,1458,1479,1479,1470,1481,1501,1506,1505,1507,1505,1496,1507,1546,1567,1553,1561,1596,1619,1626,1634,1630,1612,1613,1657,1689,1672,1663,1687,1710,1725,1728,1728,1751,1761,1756,1776,1794,1786,1785,1790,1796,1796,1778,1769,1764,1752,1782,1807,1769,1789,1878,1879,1814,1807,1845,1889,1917,1894,1839,1813,1818,1813,1804,1827,1847,1832,1822,1821,1798,1798,1881,1978,1959,1856,1855,1947,1967,1938,1922,1876,1871,1965,2040,2049,2030,1985,1984,2054,2065,1975,1916,1945,1977,1977,2003,2025,1983,1963,2031,2072,2028,1993,2015,2043,2054,2046,2016,2005,2036,2036,1990,1991,2027,2009,1948,1941,2027,2081,2002,1960,2055,2092,2028,1987,1946,1906,1933,1953,1953,2002,2028,1990,1999,2066,2082,2028,1994,2007,2045,2102,2103,2033,2036,2080,2029,2004,2057,2033,1992,2051,2080,2036,2044,2069,2005,1936,1998,2075,2023,1973,2006,1993,1958,2007,2068,2056,1999,1972,1994,1990,1954,1945,1937,1947,1993,2013,2041,2054,1992,2034,2173,2155,2103,2156,2116,2037,2103,2185,2163,2074,2022,2082,2109,2051,2073,2092,2021,2022,2061,2048,2093,2153,2140,2148,2193,2223,2211,2156,2178,2252,2191,2096,2117,2118,2088,2151,2218,2205,2192,2223,2258,2266,2258,2271,2303,2311,2288,2278,2281,2238,2191,2225,2276,2291,2326,2357,2362,2402,2430,2381,2356,2424,2459,2375,2298,2348,2390,2325,2293,2320,2308,2320,2385,2390,2364,2386,2386,2361,2382,2403,2366,2332,2340,2343,2343,2363,2366,2348,2342,2345,2353,2359,2339,2345,2389,2361,2298,2311,2302,2241,2252,2269,2225,2247,2308,2294,2269,2261,2258,2320,2354,2296,2287,2294,2256,2325,2389,2253,2150,2185,2176,2216,2333,2305,2210,2204,2177,2123,2122,2117,2080,2046,2048,2086,2118,2185,2225,2075,1986,2180,2252,2045,1947,1977,1948,1966,2079,2142,2042,1859,1886,2093,2120,2018,2027,2040,1990,1953,1909,1856,1779,1705,1748,1798,1763,1826,1921,1857,1864,1990,1911,1722,1746,1841,1788,1688,1640,1645,1744,1861,1861,1814,1807,1747,1629,1633,1785,1841,1677,1542,1614,1662,1592,1613,1639,1508,1414,1449,1471,1460,1396,1347,1518,1733,1688,1594,1665,1741,1781,1803,1644,1385,1314,1382,1385,1360,1385,1403,1369,1368,1481,1588,1571,1601,1741,1789,1753,1731,1624,1485,1399,1279,1245,1392,1472,1435,1436,1507,1620,1539,1222,1185,1418,1407,1365,1559,1670,1693,1773,1738,1603,1467,1388,1504,1631,1613,1651,1622,1505,1706,1937,1727,1557,1757,1953,2009,2038,2069,2072,1971,1893,1935,1790,1447,1364,1567,1736,1848,1959,1977,1937,2041,2257,2336,2343,2475,2528,2374,2239,2099,1831,1623,1543,1465,1442,1559,1751,1931,2103,2334,2580,2722,2793,2851,2836,2796,2812,2815,2740,2576,2328,2088,1884,1658,1484,1407,1348,1360,1495,1629,1744,1943,2160,2287,2365,2453,2552,2646,2752,2915,3097,3228,3343,3464,3525,3520,3515,3543,3538,3422,3281,3210,3134,3025,2929,2795,2640,2542,2453,2384,2360,2271,2168,2183,2174,2061,1990,1963,1905,1849,1787,1709,1659,1619,1559,1504,1483,1499,1540,1582,1624,1676,1721,1750,1804,1919,2044,2135,2232,2330,2397,2454,2507,2544,2588,2654,2733,2802,2846,2901,2941,2927,2976,3122,3187,3156,3176,3247,3292,3307,3313,3340,3378,3399,3417,3418,3377,3330,3284,3189,3062,2948,2844,2758,2710,2663,2577,2473,2365,2267,2227,2196,2101,2004,1945,1874,1813,1766,1695,1643,1597,1505,1426,1366,1294,1268,1252,1197,1193,1233,1232,1207,1161,1115,1109,1085,1056,1063,1023,966,990,1015,1017,1082,1156,1174,1183,1206,1241,1298,1383,1490,1570,1626,1701,1766,1811,1882,1979,2061,2090,2087,2146,2232,2255,2294,2379,2402,2365,2327,2308,2335,2356,2333,2333,2343,2325,2316,2307,2284,2280,2258,2224,2241,2257,2226,2226,2271,2296,2291,2308,2356,2374,2337,2302,2303,2321,2317,2278,2248,2246,2224,2184,2161,2150,2126,2076,2038,2055,2058,2013,2002,2033,2055,2057,2017,1971,1985,2007,1986,1955,1928,1922,1930,1891,1850,1879,1908,1892,1886,1897,1914,1928,1920,1931,1976,1984,1975,2004,2002,1952,1957,1995,1980,1956,1964,1962,1959,1978,1991,2001,2012,1989,1974,2011,2044,2048,2053,2040,2024,2057,2084,2046,2012,2026,2029,2009,2017,2053,2072,2071,2066,2048,2023,2022,2045,2060,2052,2036,2023,2011,2001,2012,2050,2063,2025,1998,2022,2045,2033,2004,1974,1963,1986,2009,1994,1973,1992,2030,2019,1969,1961,1986,1979,1963,1980,1995,1989,1988,1982,1948,1932,1977,2012,1983,1967,2006,2026,2011,2019,2047,2052,2035,2041,2059,2031,1992,2004,2013,2002,2025,2043,2025,2032,2062,2077,2092,2112,2142,2187,2227,2244,2218,2178,2218,2296,2304,2303,2341,2343,2329,2350,2365,2377,2421,2467,2485,2483,2491,2527,2550,2575,2642,2678,2642,2630,2674,2723,2747,2733,2713,2731,2747,2747,2776,2802,2791,2788,2792,2786,2790,2785,2763,2781,2830,2839,2819,2818,2828,2824,2802,2782,2780,2778,2766,2766,2754,2694,2634,2631,2654,2647,2609,2569,2542,2533,2529,2486,2413,2382,2377,2327,2281,2297,2305,2266,2232,2224,2201,2147,2096,2075,2049,1999,1966,1946,1892,1850,1864,1861,1792,1739,1747,1726,1647,1607,1617,1596,1557,1538,1510,1482,1471,1437,1385,1358,1348,1337,1326,1292,1242,1230,1260,1250,1165,1104,1120,1135,1118,1110,1097,1083,1091,1078,1044,1043,1046,1025,1023,1030,1019,1002,974,958,975,977,962,977,983,965,970,996,1017,1035,1039,1025,1020,1044,1087,1103,1093,1127,1179,1184,1201,1244,1233,1211,1272,1350,1363,1353,1382,1432,1469,1494,1506,1510,1540,1598,1635,1634,1631,1657,1705,1740,1773,1831,1864,1844,1860,1939,2002,2019,2033,2078,2138,2156,2145,2175,2223,2241,2272,2332,2359,2349,2359,2391,2412,2434,2483,2526,2534,2557,2605,2609,2597,2636,2689,2721,2749,2756,2755,2777,2796,2819,2869,2894,2898,2917,2916,2910,2937,2941,2924,2953,2988,2988,2989,2999,3031,3075,3070,3052,3072,3058,3013,3016,3027,3010,3018,3034,3024,3020,3021,3014,3028,3041,3028,3025,3026,3011,3023,3036,2987,2947,2974,2977,2919,2872,2869,2885,2870,2825,2818,2834,2799,2752,2739,2722,2694,2665,2640,2646,2653,2595,2524,2513,2517,2483,2441,2425,2427,2416,2378,2342,2320,2276,2211,2191,2213,2190,2117,2065,2045,2031,2008,1974,1947,1919,1878,1865,1865,1816,1765,1757,1739,1698,1667,1625,1570,1531,1526,1546,1527,1452,1418,1444,1423,1365,1345,1320,1275,1268,1268,1231,1199,1182,1159,1137,1105,1077,1083,1079,1043,1027,1023,999,967,927,892,884,882,886,903,899,877,866,862,859,849,827,825,841,830,805,808,844,868,852,847,886,913,911,910,902,906,918,902,908,963,986,972,983,1001,1022,1064,1101,1117,1127,1134,1147,1166,1177,1188,1203,1206,1206,1236,1288,1313,1321,1342,1357,1369,1417,1463,1470,1494,1532,1537,1550,1600,1627,1629,1650,1673,1696,1746,1784,1793,1823,1859,1873,1901,1927,1919,1934,1989,2040,2090,2121,2112,2128,2180,2197,2198,2232,2264,2276,2294,2333,2371,2381,2372,2382,2427,2481,2512,2529,2547,2554,2548,2541,2549,2597,2656,2673,2691,2737,2746,2737,2769,2799,2796,2783,2786,2825,2873,2893,2913,2939,2939,2948,2990,2998,2965,2965,3006,3027,3017,3030,3072,3091,3070,3067,3114,3137,3097,3086,3129,3141,3131,3140,3137,3141,3167,3170,3163,3167,3153,3136,3129,3115,3122,3142,3125,3099,3091,3077,3072,3083,3077,3070,3065,3039,3031,3051,3023,2961,2959,2977,2931,2893,2921,2923,2864,2831,2843,2833,2790,2771,2782,2767,2749,2763,2757,2710,2670,2639,2623,2632,2620,2577,2541,2521,2519,2517,2493,2471,2432,2369,2361,2382,2339,2290,2295,2294,2274,2244,2205,2197,2208,2174,2114,2080,2073,2077,2055,2005,1982,1983,1954,1917,1901,1869,1840,1850,1832,1769,1735,1732,1732,1729,1696,1668,1685,1657,1579,1564,1581,1558,1545,1539,1501,1467,1448,1440,1452,1447,1410,1383,1388,1394,1363,1327,1343,1370,1347,1299,1265,1261,1267,1249,1228,1219,1194,1185,1203,1188,1167,1172,1147,1125,1151,1152,1116,1114,1128,1124,1120,1115,1113,1126,1122,1105,1120,1131,1109,1114,1134,1111,1092,1117,1141,1134,1098,1077,1115,1143,1130,1152,1174,1160,1173,1190,1204,1256,1245,1203,1301,1350,1192,1152,1319,1358,1257,1240,1283,1323,1372,1369,1354,1447,1518,1415,1350,1517,1696,1640,1452,1393,1525,1658,1636,1528,1474,1517,1584,1588,1599,1685,1710,1660,1735,1898,1948,1918,1904,1895,1929,1986,1932,1822,1859,1985,1967,1816,1753,1873,2046,2070,1971,2004,2178,2242,2191,2206,2283,2352,2374,2301,2209,2239,2331,2323,2248,2233,2256,2241,2240,2277,2289,2303,2343,2345,2355,2444,2515,2508,2493,2480,2449,2447,2478,2487,2481,2500,2517,2500,2509,2572,2632,2661,2678,2704,2749,2784,2769,2736,2738,2758,2747,2711,2707,2733,2744,2741,2745,2773,2826,2846,2824,2838,2873,2868,2863,2880,2873,2823,2755,2719,2716,2686,2631,2596,2573,2567,2586,2598,2604,2615,2620,2639,2678,2710,2715,2695,2687,2707,2692,2646,2634,2630,2607,2603,2591,2544,2526,2563,2593,2586,2582,2613,2648,2651,2642,2654,2670,2662,2647,2657,2678,2675,2640,2585,2542,2535,2534,2509,2482,2468,2457,2448,2449,2459,2457,2432,2415,2408,2395,2416,2460,2454,2399,2366,2366,2354,2323,2297,2282,2273,2273,2246,2195,2182,2182,2127,2083,2094,2097,2079,2068,2047,2028,2027,2022,2003,2005,2035,2043,2015,1993,1988,1960,1919,1905,1908,1900,1878,1859,1849,1834,1824,1827,1835,1841,1842,1844,1849,1828,1791,1788,1803,1790,1767,1751,1744,1751,1758,1749,1727,1716,1735,1731,1687,1682,1712,1703,1691,1709,1723,1729,1718,1695,1691,1690,1687,1710,1724,1718,1729,1722,1706,1721,1711,1671,1695,1740,1716,1675,1686,1726,1749,1742,1742,1767,1776,1766,1790,1823,1804,1771,1796,1844,1852,1843,1851,1843,1801,1791,1837,1866,1858,1866,1870,1845,1840,1860,1880,1907,1914,1906,1936,1976,1981,1971,1960,1964,1972,1943,1936,1996,2010,1962,1952,1962,1964,2001,2029,2008,2002,2029,2047,2059,2071,2064,2058,2071,2075,2057,2050,2060,2063,2056,2049,2040,2036,2048,2057,2039,2014,2018,2036,2041,2039,2035,2039,2062,2063,2033,2031,2044,2022,2000,2002,2004,2010,2011,1994,1997,2008,1990,1967,1970,1989,2001,1986,1960,1970,1991,1980,1959,1958,1965,1975,1972,1941,1926,1952,1963,1942,1938,1954,1957,1961,1972,1971,1959,1962,1979,1992,1996,1995,1980,1979,2011,2024,2012,2028,2048,2031,2021,2031,2036,2034,2029,2029,2049,2064,2064,2071,2081,2088,2089,2084,2091,2105,2101,2097,2098,2088,2093,2122,2138,2134,2130,2133,2138,2137,2136,2142,2137,2124,2121,2126,2135,2140,2124,2109,2124,2152,2147,2125,2142,2174,2161,2137,2142,2153,2153,2141,2122,2125,2128,2102,2089,2098,2089,2081,2073,2053,2059,2079,2064,2056,2071,2056,2026,2029,2048,2041,2005,1982,1987,1991,1985,1984,1980,1968,1950,1936,1950,1970,1951,1926,1935,1940,1929,1930,1933,1923,1914,1913,1915,1920,1924,1925,1927,1938,1944,1929,1922,1935,1917,1891,1928,1959,1919,1908,1958,1968,1941,1943,1944,1926,1941,1980,1984,1955,1952,1976,1966,1936,1948,1985,1996,1989,1996,2013,2010,1987,1982,1998,2010,2026,2055,2060,2043,2044,2055,2047,2032,2033,2042,2048,2061,2078,2075,2064,2069,2073,2073,2091,2115,2110,2095,2103,2109,2099,2091,2086,2082,2088,2096,2100,2112,2115,2099,2091,2094,2098,2104,2095,2080,2088,2101,2096,2095,2104,2100,2081,2073,2092,2101,2078,2070,2084,2074,2064,2085,2089,2076,2091,2101,2071,2052,2065,2070,2060,2053,2056,2067,2068,2060,2062,2061,2049,2047,2045,2030,2031,2049,2049,2035,2031,2034,2030,2019,2012,2025,2036,2030,2029,2038,2036,2031,2024,2013,2021,2040,2036,2022,2021,2026,2032,2027,2015,2026,2050,2052,2042,2041,2036,2028,2027,2031,2043,2045,2029,2031,2055,2053,2028,2027,2045,2052,2044,2037,2038,2045,2045,2045,2058,2079,2089,2080,2062,2051,2048,2044,2048,2063,2060,2045,2057,2076,2073,2068,2061,2047,2054,2074,2076,2068,2056,2046,2051,2049,2039,2050,2061,2049,2042,2047,2049,2053,2061,2066,2060,2047,2055,2069,2054,2047,2062,2048,2024,2033,2035,2028,2044,2050,2032,2025,2029,2036,2046,2050,2051,2044,2033,2038,2051,2048,2035,2033,2043,2051,2049,2050,2052,2050,2048,2040,2036,2053,2057,2037,2035,2045,2036,2029,2038,2053,2055,2036,2024,2025,2016,2017,2039,2046,2034,2020,2015,2031,2051,2046,2030,2028,2034,2035,2029,2026,2026,2017,2005,2015,2040,2051,2048,2045,2034,2023,2029,2037,2037,2037,2027,2015,2020,2016,2007,2019,2028,2022,2019,2019,2027,2036,2018,2006,2025,2040,2038,2032,2014,2002,2005,2003,1999,1999,1979,1957,1975,2009,2009,1990,1976,1971,1980,1994,1991,1978,1964,1953,1954,1956,1948,1942,1940,1937,1935,1925,1923,1940,1945,1936,1946,1955,1933,1914,1924,1932,1922,1914,1912,1914,1934,1950,1935,1923,1929,1918,1900,1911,1930,1917,1897,1904,1913,1910,1910,1911,1916,1928,1915,1893,1911,1926,1907,1899,1908,1904,1900,1910,1915,1906,1904,1914,1905,1884,1891,1897,1871,1867,1902,1905,1871,1866,1898,1911,1896,1896,1917,1924,1900,1881,1891,1902,1897,1893,1888,1888,1907,1918,1903,1896,1892,1883,1899,1926,1923,1902,1899,1910,1907,1899,1907,1916,1918,1924,1920,1911,1917,1926,1931,1930,1926,1950,1981,1973,1965,1983,1985,1971,1965,1964,1977,1992,1989,1987,1996,2010,2025,2026,2017,2021,2028,2026,2025,2032,2039,2038,2033,2034,2040,2050,2073,2089,2080,2075,2084,2090,2098,2097,2085,2101,2133,2133,2133,2153,2156,2162,2180,2170,2155,2175,2209,2217,2184,2171,2208,2217,2186,2185,2197,2211,2255,2268,2240,2249,2277,2261,2229,2232,2262,2273,2266,2274,2280,2268,2270,2288,2296,2292,2293,2308,2319,2320,2326,2315,2296,2309,2320,2312,2316,2318,2322,2347,2349,2341,2359,2366,2360,2361,2345,2334,2343,2346,2361,2374,2344,2314,2326,2345,2353,2353,2340,2319,2313,2335,2354,2340,2322,2335,2363,2367,2338,2322,2339,2340,2316,2310,2318,2320,2323,2325,2318,2305,2291,2286,2297,2310,2311,2305,2307,2307,2303,2305,2301,2290,2288,2277,2265,2285,2291,2269,2278,2289,2259,2244,2250,2243,2259,2278,2240,2205,2220,2216,2186,2189,2206,2198,2196,2206,2198,2183,2182,2170,2145,2141,2151,2143,2121,2108,2112,2119,2109,2095,2101,2113,2103,2073,2052,2054,2060,2055,2041,2030,2026,2022,2019,2023,2009,1979,1978,1994,1978,1954,1948,1940,1949,1959,1922,1891,1917,1931,1892,1869,1887,1887,1860,1865,1880,1848,1822,1841,1841,1826,1834,1831,1811,1822,1839,1813,1773,1768,1786,1799,1812,1817,1798,1788,1805,1801,1765,1748,1769,1783,1779,1786,1792,1770,1756,1768,1759,1744,1768,1792,1788,1784,1780,1764,1759,1777,1794,1790,1773,1775,1794,1799,1792,1790,1799,1816,1824,1818,1817,1820,1816,1821,1830,1826,1823,1835,1857,1864,1853,1856,1880,1886,1889,1903,1886,1858,1880,1909,1908,1914,1931,1938,1946,1949,1943,1939,1940,1950,1969,1981,1986,2000,2002,1987,1988,1999,1996,2003,2026,2031,2030,2042,2044,2042,2060,2070,2064,2073,2093,2111,2119,2113,2114,2132,2138,2134,2138,2144,2155,2176,2184,2180,2185,2199,2206,2198,2195,2212,2228,2219,2215,2233,2240,2241,2253,2249,2235,2251,2264,2253,2255,2266,2268,2283,2296,2282,2285,2312,2312,2303,2317,2321,2309,2305,2293,2293,2328,2337,2313,2326,2352,2341,2315,2296,2302,2325,2322,2324,2362,2358,2323,2343,2358,2321,2323,2350,2321,2298,2328,2339,2319,2318,2315,2299,2304,2304,2282,2283,2308,2318,2307,2291,2293,2298,2281,2281,2309,2307,2286,2291,2294,2279,2267,2259,2250,2242,2238,2240,2241,2238,2238,2222,2203,2214,2220,2191,2189,2232,2229,2181,2188,2215,2187,2162,2165,2143,2131,2161,2173,2150,2138,2145,2139,2123,2132,2141,2122,2123,2143,2127,2108,2117,2122,2118,2117,2116,2115,2095,2073,2082,2085,2067,2058,2059,2067,2080,2075,2052,2035,2042,2056,2036,2015,2034,2037,2007,2009,2023,2002,1986,2008,2029,2013,2015,2045,2019,1972,2007,2030,1978,1969,2002,1984,1961,1982,2001,1994,1981,1981,1987,1974,1962,1978,1992,1983,1969,1962,1967,1975,1963,1934,1925,1949,1969,1956,1936,1942,1943,1927,1928,1928,1905,1914,1945,1931,1904,1905,1897,1891,1909,1907,1885,1893,1912,1898,1866,1862,1885,1888,1866,1863,1890,1912,1907,1886,1875,1884,1895,1896,1887,1885,1891,1887,1888,1905,1902,1886,1894,1898,1876,1874,1897,1908,1903,1903,1905,1892,1881,1896,1917,1920,1904,1873,1861,1891,1920,1915,1896,1878,1882,1912,1929,1921,1912,1891,1873,1893,1916,1911,1912,1916,1909,1914,1907,1884,1909,1957,1935,1887,1905,1938,1913,1877,1881,1887,1878,1889,1925,1947,1939,1918,1923,1946,1938,1913,1915,1931,1933,1929,1929,1932,1919,1906,1934,1962,1943,1923,1928,1926,1934,1961,1955,1919,1920,1959,1979,1971,1960,1959,1965,1963,1957,1973,1991,1973,1956,1971,1985,1980,1964,1960,1978,1974,1942,1946,1975,1977,1968,1974,1986,1982,1964,1970,1997,2004,2007,2017,2008,2001,2011,2014,2012,2018,2029,2035,2030,2039,2054,2040,2032,2036,2009,1993,2028,2050,2045,2039,2027,2025,2034,2031,2026,2021,2015,2021,2019,2008,2014,2012,2008,2027,2027,2014,2037,2055,2038,2032,2037,2038,2044,2030,2008,2027,2063,2066,2053,2058,2068,2061,2050,2060,2073,2064,2059,2065,2061,2053,2058,2059,2056,2058,2055,2050,2054,2062,2066,2052,2038,2050,2058,2033,2016,2031,2055,2067,2051,2024,2025,2034,2028,2033,2039,2024,2022,2036,2029,2003,1994,2009,2023,2025,2024,2015,2005,2018,2035,2026,2007,1993,1989,2004,2018,2015,2012,2008,1994,1985,1993,2007,2013,2012,2017,2016,2012,2023,2025,2017,2023,2027,2017,2029,2046,2043,2041,2042,2037,2038,2036,2025,2024,2025,2028,2041,2049,2044,2037,2030,2035,2051,2045,2026,2026,2035,2042,2049,2038,2021,2020,2016,2007,2032,2058,2038,2006,2002,2007,2014,2029,2039,2039,2037,2037,2037,2026,2015,2017,2019,2022,2034,2038,2029,2026,2032,2033,2025,2020,2027,2033,2036,2045,2039,2011,2006,2026,2032,2023,2025,2039,2047,2044,2044,2047,2044,2038,2040,2049,2057,2052,2051,2072,2078,2056,2051,2055,2040,2036,2052,2057,2050,2047,2050,2056,2061,2058,2046,2040,2040,2040,2052,2067,2051,2034,2049,2055,2044,2050,2056,2051,2057,2055,2035,2025,2041,2060,2053,2038,2048,2064,2069,2080,2075,2045,2033,2049,2067,2082,2080,2068,2067,2065,2058,2061,2059,2040,2038,2071,2087,2057,2039,2055,2055,2054,2073,2056,2035,2074,2101,2065,2037,2050,2071,2076,2062,2051,2049,2046,2061,2079,2064,2048,2057,2071,2076,2066,2061,2077,2082,2069,2072,2079,2069,2070,2078,2063,2049,2066,2084,2065,2034,2035,2060,2067,2054,2054,2063,2067,2075,2076,2050,2043,2065,2057,2029,2043,2071,2069,2053,2049,2055,2058,2070,2093,2080,2049,2077,2116,2083,2036,2048,2093,2103,2046,2008,2066,2128,2116,2076,2040,2028,2063,2101,2113,2121,2096,2061,2081,2104,2069,2046,2072,2094,2093,2090,2090,2089,2081,2081,2094,2093,2083,2089,2085,2064,2065,2084,2096,2100,2087,2071,2079,2100,2115,2113,2104,2108,2111,2098,2102,2116,2109,2103,2104,2105,2119,2114,2087,2081,2081,2084,2107,2102,2074,2084,2109,2113,2113,2110,2112,2121,2122,2127,2131,2123,2131,2141,2119,2107,2124,2125,2107,2113,2137,2130,2096,2100,2134,2136,2110,2102,2123,2145,2133,2109,2110,2120,2125,2117,2096,2105,2139,2140,2115,2100,2094,2119,2154,2142,2107,2104,2124,2137,2127,2119,2130,2124,2097,2093,2104,2107,2123,2144,2137,2109,2102,2128,2148,2133,2110,2107,2118,2125,2116,2102,2106,2117,2103,2085,2104,2142,2143,2107,2082,2094,2107,2098,2085,2082,2091,2108,2109,2085,2084,2102,2094,2084,2101,2105,2093,2096,2102,2099,2100,2094,2087,2095,2090,2072,2085,2106,2089,2059,2062,2079,2084,2078,2070,2067,2072,2077,2074,2063,2068,2094,2099,2083,2077,2073,2082,2113,2111,2076,2062,2061,2066,2077,2060,2046,2060,2061,2065,2079,2056,2061,2109,2082,2028,2070,2124,2103,2050,2016,2027,2065,2081,2086,2087,2067,2057,2072,2090,2101,2077,2030,2041,2090,2090,2063,2060,2067,2079,2077,2045,2028,2052,2084,2100,2085,2055,2064,2091,2080,2064,2072,2075,2070,2076,2091,2094,2075,2066,2081,2083,2073,2080,2080,2069,2070,2078,2089,2092,2069,2055,2073,2083,2071,2063,2070,2073,2060,2053,2067,2079,2081,2079,2074,2076,2086,2090,2088,2077,2060,2053,2059,2076,2090,2087,2078,2058,2030,2046,2083,2073,2063,2092,2104,2080,2058,2058,2075,2077,2062,2062,2066,2068,2086,2090,2072,2060,2046,2046,2076,2079,2054,2063,2079,2067,2057,2054,2051,2073,2099,2097,2082,2056,2041,2077,2113,2085,2044,2034,2043,2075,2094,2065,2045,2066,2088,2085,2068,2071,2101,2099,2066,2062,2072,2058,2048,2056,2069,2069,2057,2055,2059,2052,2066,2090,2076,2054,2049,2042,2057,2081,2067,2053,2071,2073,2049,2041,2049,2066,2095,2101,2072,2044,2027,2018,2050,2100,2103,2065,2032,2026,2043,2060,2068,2054,2013,2015,2077,2091,2056,2053,2044,2021,2064,2110,2065,2016,2029,2040,2040,2061,2058,2018,2010,2025,2013,2022,2056,2034,1990,2014,2061,2058,2014,1990,2026,2082,2083,2034,2004,2024,2053,2054,2045,2027,2001,2014,2053,2051,2018,1990,1969,1974,2018,2057,2042,1999,2008,2050,2047,2028,2031,2005,1970,1994,2036,2030,2000,1993,2008,2006,1996,2012,2023,2010,2015,2035,2041,2036,2017,1999,2008,2020,2029,2051,2042,1999,1984,1999,2016,2036,2030,1990,1980,2014,2030,2011,1991,1995,2010,2022,2034,2028,1999,1999,2031,2035,2016,2002,1973,1950,1975,2029,2051,1999,1942,1960,2010,2033,2027,1990,1974,2008,2017,2012,2036,2018,1958,1965,2011,2009,1980,1967,1961,1956,1982,2029,2015,1950,1955,2027,2054,2026,2001,1992,1999,2023,2029,1999,1978,1987,1991,1993,2014,2020,2021,2035,2011,1970,1984,2011,2012,2019,2014,1988,1979,1987,1992,1982,1976,2014,2034,1988,1974,2010,2003,1990,2028,2045,2019,2001,1989,1986,2014,2047,2038,1999,1974,1987,2033,2049,1993,1962,2015,2025,1958,1950,2010,2045,2036,2005,1980,1986,2019,2048,2035,1997,1983,1981,1984,2012,2029,2022,2021,2016,2006,2000,1993,2009,2045,2040,1993,1968,1996,2025,2006,1986,1997,2000,2010,2041,2043,2018,2003,2001,2025,2052,2047,2035,2039,2046,2033,1995,1983,2012,2030,2023,1995,1971,1995,2020,2006,2005,2010,1999,2017,2025,2008,2035,2054,2024,2021,2027,2015,2029,2029,2016,2058,2054,1972,1982,2068,2073,2011,1968,2004,2075,2031,1962,2045,2095,2005,1996,2050,2009,1984,2029,2034,2017,2029,2026,2004,2009,2043,2063,2041,2011,2032,2083,2051,1968,1994,2073,2066,2020,1958,1932,2049,2114,1999,1966,2032,2011,2018,2067,2003,1953,2023,2078,2055,2009,1982,1994,2036,2073,2057,1998,1968,1984,2035,2086,2056,1984,1971,2000,2048,2091,2065,2026,2014,1965,1957,2034,2046,1991,1973,1967,1976,2015,2020,2016,2037,2000,1930,1955,2058,2110,2055,1972,1959,1995,2016,2030,2033,1990,1945,1973,2045,2049,1983,1952,1981,2022,2053,2035,1976,1966,2003,2022,2007,1976,1973,2003,2002,1995,2008,1990,1987,2029,2004,1939,1966,2042,2025,1935,1931,2010,2017,1983,2011,2021,1995,2014,2050,2055,2022,1981,1999,2034,2011,1998,2027,2041,2017,1982,1983,2011,2024,2047,2021,1940,1978,2076,2048,2010,2023,1994,1996,2040,2030,2007,1992,1991,2035,2023,1962,1998,2042,1998,1993,2031,2021,1995,1990,2029,2092,2068,1988,1997,2049,2045,2030,2048,2066,2042,1997,2018,2087,2075,2010,2012,2063,2074,2046,2043,2078,2095,2078,2050,2026,2041,2064,2051,2067,2068,1978,1969,2112,2188,2102,1941,1884,2063,2253,2197,2028,1907,1885,2052,2267,2229,1978,1859,1994,2142,2138,2076,2013,1976,2050,2134,2101,2039,2029,2052,2079,2077,2065,2050,2033,2061,2087,2052,2043,2065,2051,2054,2074,2072,2097,2124,2100,2076,2068,2066,2103,2139,2092,2015,2017,2072,2101,2102,2077,2015,1995,2058,2131,2143,2100,2062,2076,2122,2151,2130,2071,2054,2095,2098,2062,2061,2073,2072,2085,2086,2051,2054,2109,2110,2060,2059,2082,2078,2091,2113,2084,2058,2090,2127,2127,2102,2062,2043,2083,2127,2117,2089,2063,2062,2116,2136,2083,2059,2077,2093,2106,2083,2065,2099,2102,2075,2078,2082,2093,2095,2066,2093,2134,2083,2058,2111,2121,2087,2065,2048,2059,2096,2111,2075,2037,2060,2072,2038,2085,2146,2077,2015,2052,2082,2110,2136,2075,2014,2056,2090,2071,2090,2098,2046,2043,2091,2085,2062,2055,2031,2038,2086,2097,2071,2056,2061,2074,2079,2089,2093,2059,2030,2044,2071,2089,2088,2062,2024,2014,2075,2142,2101,2021,2022,2069,2088,2065,2043,2081,2124,2097,2061,2066,2073,2076,2094,2109,2098,2083,2089,2100,2105,2109,2091,2067,2066,2071,2077,2086,2091,2086,2066,2058,2097,2126,2103,2080,2083,2089,2089,2092,2096,2084,2076,2089,2070,2039,2072,2115,2094,2056,2051,2072,2090,2096,2098,2084,2066,2068,2071,2085,2095,2066,2053,2083,2094,2093,2087,2062,2069,2093,2090,2092,2081,2048,2058,2091,2099,2096,2064,2028,2052,2103,2108,2075,2060,2074,2082,2080,2074,2060,2068,2080,2063,2056,2072,2072,2065,2058,2046,2056,2075,2068,2047,2046,2065,2072,2060,2051,2045,2068,2102,2078,2040,2050,2058,2053,2054,2050,2077,2099,2062,2050,2089,2092,2065,2052,2061,2079,2069,2062,2096,2099,2061,2055,2069,2077,2095,2093,2072,2088,2109,2079,2046,2058,2081,2084,2070,2058,2061,2054,2058,2098,2098,2042,2030,2057,2070,2080,2075,2056,2051,2053,2076,2095,2066,2063,2090,2071,2061,2083,2079,2082,2095,2072,2055,2071,2092,2102,2091,2093,2113,2101,2076,2078,2085,2095,2106,2101,2091,2085,2086,2088,2079,2084,2104,2101,2086,2075,2063,2073,2094,2083,2061,2073,2096,2080,2049,2063,2086,2073,2066,2078,2073,2060,2070,2085,2070,2053,2072,2081,2055,2052,2058,2044,2061,2081,2047,2028,2063,2079,2066,2061,2056,2046,2058,2082,2085,2083,2093,2097,2096,2089,2069,2064,2092,2115,2097,2060,2061,2090,2093,2089,2108,2107,2080,2076,2096,2098,2077,2068,2069,2058,2073,2102,2074,2041,2070,2086,2053,2042,2070,2087,2075,2066,2064,2048,2053,2073,2055,2041,2065,2077,2067,2056,2048,2052,2056,2057,2065,2048,2031,2056,2058,2029,2033,2042,2026,2025,2043,2050,2047,2048,2049,2039,2045,2072,2066,2040,2038,2045,2053,2065,2065,2061,2058,2047,2055,2074,2059,2037,2045,2058,2055,2046,2035,2034,2043,2040,2028,2034,2053,2054,2030,2001,2009,2039,2032,1998,1992,2004,2014,2021,2016,2008,2009,2017,2034,2042,2034,2036,2042,2025,2012,2023,2032,2028,2027,2030,2028,2022,2026,2037,2039,2026,2014,2022,2047,2050,2030,2026,2041,2040,2022,2005,2007,2024,2033,2029,2028,2029,2023,2023,2031,2022,2012,2028,2040,2029,2020,2026,2033,2041,2051,2050,2042,2046,2058,2057,2041,2035,2049,2056,2040,2036,2057,2062,2051,2045,2038,2047,2070,2058,2026,2025,2039,2045,2040,2027,2027,2038,2037,2029,2024,2025,2032,2035,2030,2022,2016,2020,2027,2019,2008,2010,2023,2036,2029,2015,2020,2030,2028,2030,2035,2035,2031,2030,2038,2048,2047,2041,2035,2038,2052,2060,2053,2046,2044,2050,2054,2042,2042,2058,2051,2042,2055,2050,2035,2044,2046,2037,2042,2037,2025,2040,2051,2037,2031,2038,2033,2022,2027,2039,2039,2030,2022,2015,2013,2025,2033,2030,2026,2019,2009,2015,2025,2019,2007,2010,2017,2017,2021,2029,2028,2021,2020,2021,2014,2008,2014,2020,2011,2007,2018,2024,2026,2032,2028,2020,2022,2024,2019,2016,2017,2022,2024,2020,2017,2016,2015,2012,2010,2009,2010,2010,2010,2009,2006,2005,2004,2007,2013,2015,2012,2006,1996,1993,1999,2003,2006,2010,2017,2019,2014,2012,2015,2004,1994,2002,2014,2021,2017,2001,2002,2021,2023,2008,1999,2001,2009,2015,2019,2021,2009,1994,1995,2004,2007,2007,2003,2002,2005,2007,2005,2005,2004,2001,2005,2012,2016,2015,2013,2012,2012,2015,2009,1995,1990,1999,2005,2008,2013,2013,2005,2000,2004,2012,2016,2012,2008,2011,2017,2019,2015,2011,2008,2006,2009,2008,2003,2006,2011,2008,1997,1986,1989,1997,1990,1988,2003,2006,2001,2005,2009,2010,2016,2020,2023,2026,2017,2008,2008,2006,2004,2011,2016,2014,2012,2011,2007,2006,2008,2005,2005,2012,2014,2009,2013,2016,2009,2008,2013,2008,1996,1999,2008,2003,1996,1998,2001,2000,1999,2001,2006,2005,2003,2009,2007,1999,1998,1996,1997,2006,2006,2002,2006,2011,2021,2035,2034,2020,2015,2019,2022,2026,2041,2042,2023,2023,2038,2033,2022,2028,2034,2034,2032,2036,2044,2045,2041,2042,2045,2049,2046,2036,2036,2040,2037,2033,2022,2011,2016,2030,2037,2031,2020,2025,2025,2006,2008,2034,2036,2015,2011,2027,2037,2032,2040,2062,2057,2036,2044,2068,2072,2073,2080,2074,2067,2084,2099,2095,2095,2083,2056,2063,2091,2087,2064,2054,2045,2032,2024,2034,2042,2018,1995,2005,2012,2003,1996,1993,1999,2008,2009,2014,2017,2018,2030,2038,2035,2054,2084,2086,2077,2088,2103,2104,2103,2111,2121,2123,2116,2113,2123,2128,2129,2134,2112,2090,2111,2119,2096,2091,2079,2049,2047,2060,2059,2042,2011,2006,2029,2031,2025,2009,1981,2001,2032,1995,1974,2015,2023,2004,2034,2059,2017,2000,2068,2105,2062,2049,2067,2056,2070,2114,2106,2067,2077,2122,2121,2086,2093,2121,2114,2103,2104,2103,2117,2129,2120,2103,2090,2099,2121,2115,2089,2071,2079,2108,2101,2071,2092,2096,2058,2064,2078,2062,2067,2063,2047,2077,2098,2075,2068,2080,2089,2090,2088,2108,2110,2067,2065,2097,2071,2035,2062,2092,2078,2062,2079,2093,2074,2072,2100,2092,2064,2075,2089,2078,2078,2080,2069,2068,2076,2075,2071,2082,2094,2080,2069,2091,2106,2099,2095,2093,2096,2110,2106,2088,2089,2100,2104,2099,2084,2073,2074,2092,2115,2095,2055,2072,2112,2107,2094,2098,2095,2086,2094,2119,2126,2090,2058,2076,2102,2103,2098,2095,2092,2094,2103,2109,2106,2094,2090,2106,2116,2099,2077,2080,2094,2088,2072,2077,2096,2105,2103,2100,2099,2102,2101,2097,2099,2099,2090,2092,2103,2104,2099,2099,2108,2114,2106,2097,2101,2106,2103,2103,2100,2095,2097,2100,2096,2091,2092,2099,2104,2091,2083,2099,2105,2093,2099,2115,2114,2111,2115,2116,2115,2112,2113,2109,2095,2095,2111,2105,2083,2074,2075,2077,2080,2084,2085,2084,2094,2109,2100,2087,2090,2085,2075,2074,2073,2071,2070,2070,2079,2092,2094,2093,2093,2092,2098,2108,2108,2099,2101,2112,2112,2105,2107,2111,2104,2096,2097,2091,2075,2068,2071,2064,2058,2062,2066,2066,2065,2059,2050,2045,2050,2054,2041,2033,2045,2049,2042,2044,2043,2039,2050,2062,2060,2058,2061,2062,2065,2063,2054,2060,2077,2079,2069,2072,2080,2079,2073,2071,2073,2070,2068,2076,2081,2072,2072,2081,2078,2071,2070,2069,2065,2066,2069,2062,2049,2042,2041,2043,2040,2033,2032,2040,2052,2058,2051,2043,2044,2044,2043,2042,2036,2032,2035,2035,2032,2031,2037,2044,2041,2041,2053,2056,2056,2063,2057,2044,2043,2043,2043,2045,2047,2048,2044,2037,2034,2031,2033,2040,2039,2032,2031,2033,2035,2034,2026,2020,2016,2011,2015,2021,2016,2013,2020,2022,2017,2012,2016,2026,2028,2018,2015,2023,2026,2022,2020,2016,2014,2021,2029,2032,2031,2031,2028,2026,2032,2040,2043,2048,2049,2042,2042,2046,2039,2034,2038,2035,2032,2037,2041,2039,2035,2036,2040,2039,2036,2034,2030,2031,2033,2031,2028,2019,2011,2017,2026,2028,2030,2038,2040,2032,2026,2029,2032,2030,2028,2020,2017,2029,2041,2038,2030,2031,2037,2034,2025,2026,2030,2031,2032,2029,2024,2021,2017,2020,2034,2038,2029,2025,2032,2037,2032,2028,2027,2026,2026,2025,2026,2031,2031,2028,2026,2021,2015,2015,2015,2020,2029,2025,2018,2023,2027,2026,2027,2026,2023,2021,2023,2028,2034,2030,2014,2007,2020,2033,2031,2023,2021,2023,2020,2018,2027,2036,2032,2030,2036,2033,2025,2029,2036,2032,2024,2025,2028,2025,2026,2037,2043,2038,2041,2046,2037,2021,2012,2014,2022,2025,2023,2024,2018,2009,2009,2010,2011,2014,2021,2033,2042,2035,2028,2028,2023,2019,2020,2021,2024,2028,2023,2020,2019,2017,2016,2020,2025,2024,2015,2009,2007,2001,1996,2003,2014,2022,2022,2018,2019,2026,2027,2019,2015,2018,2013,2004,2006,2019,2023,2014,2010,2012,2012,2014,2019,2015,2007,2003,2006,2015,2020,2014,2012,2014,2011,2007,2008,2014,2019,2019,2020,2021,2016,2009,2008,2007,2003,2007,2017,2017,2017,2027,2035,2027,2019,2021,2028,2023,2009,2007,2013,2014,2017,2023,2026,2025,2022,2024,2030,2032,2031,2033,2030,2025,2017,2007,2005,2010,2011,2012,2013,2021,2030,2022,2011,2014,2017,2019,2023,2019,2013,2017,2020,2020,2021,2020,2022,2034,2043,2035,2026,2026,2020,2005,2005,2012,2015,2020,2023,2015,2003,2005,2019,2019,2004,2005,2017,2024,2027,2032,2037,2032,2022,2028,2035,2024,2015,2019,2024,2031,2032,2025,2022,2026,2029,2030,2026,2024,2026,2030,2029,2022,2019,2029,2033,2030,2026,2017,2007,2009,2018,2023,2024,2028,2033,2030,2024,2020,2019,2020,2025,2029,2030,2028,2023,2023,2030,2036,2037,2038,2037,2031,2021,2020,2023,2022,2022,2028,2032,2029,2024,2027,2035,2036,2034,2036,2037,2034,2030,2026,2025,2025,2028,2034,2037,2032,2024,2019,2024,2034,2041,2041,2037,2037,2040,2037,2032,2030,2034,2039,2040,2039,2039,2036,2037,2042,2040,2036,2037,2034,2027,2023,2026,2029,2030,2031,2036,2041,2042,2042,2039,2039,2041,2039,2035,2033,2030,2028,2032,2037,2039,2036,2035,2040,2046,2049,2047,2040,2034,2033,2034,2033,2031,2029,2032,2036,2038,2039,2042,2043,2037,2036,2044,2052,2052,2052,2050,2048,2051,2046,2031,2024,2031,2038,2041,2048,2059,2059,2050,2047,2042,2036,2039,2047,2055,2067,2068,2057,2050,2050,2048,2044,2046,2048,2040,2031,2029,2026,2028,2038,2044,2044,2045,2045,2046,2047,2047,2048,2048,2049,2053,2051,2046,2043,2040,2038,2040,2038,2033,2030,2030,2036,2041,2046,2052,2053,2049,2045,2044,2049,2054,2055,2059,2059,2052,2051,2052,2044,2043,2055,2067,2069,2065,2059,2055,2057,2063,2069,2074,2075,2069,2059,2054,2054,2057,2061,2068,2071,2070,2070,2070,2064,2058,2063,2072,2074,2079,2086,2083,2071,2065,2066,2066,2066,2069,2074,2074,2071,2070,2074,2075,2072,2074,2079,2079,2077,2075,2070,2069,2072,2072,2070,2068,2069,2071,2078,2082,2081,2078,2073,2069,2067,2065,2067,2078,2083,2075,2065,2061,2065,2070,2070,2068,2065,2064,2067,2068,2068,2072,2074,2069,2064,2063,2067,2077,2083,2076,2059,2049,2049,2053,2062,2078,2084,2073,2063,2065,2074,2075,2061,2051,2060,2077,2087,2083,2070,2055,2049,2055,2069,2083,2091,2086,2078,2076,2072,2067,2064,2061,2068,2090,2101,2088,2065,2040,2027,2040,2067,2096,2117,2114,2088,2059,2046,2053,2071,2088,2088,2070,2061,2071,2086,2096,2094,2080,2069,2056,2034,2022,2037,2066,2094,2108,2096,2066,2038,2026,2036,2073,2122,2151,2144,2114,2077,2049,2045,2065,2088,2105,2113,2108,2090,2067,2048,2039,2048,2076,2107,2127,2131,2114,2084,2060,2056,2076,2107,2135,2158,2169,2154,2117,2088,2081,2091,2107,2117,2118,2119,2121,2121,2120,2116,2104,2085,2067,2057,2058,2076,2094,2094,2073,2041,2003,1982,1992,2022,2057,2081,2090,2089,2086,2082,2085,2097,2114,2135,2154,2161,2154,2141,2127,2116,2109,2108,2112,2118,2122,2124,2121,2105,2083,2068,2060,2056,2059,2062,2048,2022,2000,1988,1980,1970,1964,1964,1967,1976,1991,2007,2015,2015,2019,2031,2042,2055,2082,2114,2136,2144,2131,2106,2092,2100,2119,2140,2161,2173,2165,2142,2117,2102,2103,2118,2130,2131,2126,2117,2106,2091,2076,2065,2055,2043,2031,2019,2012,2011,2012,2006,1997,1991,1987,1986,1990,1994,1990,1981,1975,1974,1971,1967,1965,1965,1967,1975,1988,2001,2006,2005,2006,2008,2012,2019,2030,2036,2037,2034,2029,2022,2021,2034,2056,2077,2087,2087,2081,2075,2074,2080,2093,2105,2112,2112,2107,2103,2103,2100,2098,2103,2105,2105,2108,2108,2105,2104,2100,2090,2079,2068,2063,2065,2067,2069,2070,2069,2063,2055,2053,2061,2071,2076,2081,2084,2089,2092,2087,2077,2071,2067,2068,2075,2084,2093,2095,2087,2075,2072,2075,2081,2091,2101,2106,2104,2102,2098,2094,2094,2098,2101,2105,2109,2107,2101,2095,2091,2091,2091,2089,2090,2094,2095,2096,2101,2101,2091,2080,2073,2069,2068,2072,2071,2064,2054,2042,2031,2034,2043,2049,2050,2051,2051,2046,2034,2022,2021,2027,2032,2040,2048,2050,2047,2046,2042,2034,2032,2041,2051,2054,2057,2060,2058,2049,2042,2044,2048,2048,2046,2045,2043,2040,2034,2027,2023,2025,2026,2026,2030,2038,2041,2041,2041,2037,2028,2019,2010,2004,2009,2014,2003,1990,1990,1998,2000,2001,2008,2020,2033,2039,2035,2028,2024,2022,2017,2010,2004,2004,2005,2001,1992,1985,1982,1983,1988,1998,2009,2016,2018,2020,2019,2014,2010,2002,1996,2003,2019,2027,2028,2024,2015,2015,2024,2029,2028,2025,2018,2005,1997,1995,1986,1967,1954,1948,1948,1956,1959,1961,1979,2006,2024,2034,2044,2059,2075,2088,2096,2095,2084,2073,2062,2048,2035,2025,2016,2014,2015,2007,1992,1978,1971,1971,1980,1991,1995,1997,2014,2033,2035,2033,2045,2063,2072,2076,2085,2091,2088,2083,2081,2076,2069,2062,2058,2059,2059,2057,2050,2041,2039,2041,2037,2029,2025,2024,2022,2016,2020,2036,2045,2041,2034,2035,2045,2054,2058,2054,2043,2040,2045,2044,2045,2054,2057,2057,2064,2066,2057,2052,2053,2053,2054,2058,2057,2051,2048,2048,2048,2053,2057,2051,2043,2044,2054,2055,2048,2048,2047,2038,2030,2033,2037,2037,2039,2042,2043,2049,2057,2055,2051,2056,2060,2053,2049,2053,2051,2045,2045,2048,2047,2044,2043,2041,2039,2037,2032,2024,2016,2015,2022,2025,2019,2012,2012,2016,2018,2017,2019,2022,2022,2017,2013,2007,1999,1990,1983,1977,1978,1990,2003,2006,2008,2011,2008,2007,2005,2000,1998,1996,1993,1995,1997,2000,2005,2006,2007,2007,2003,2002,2004,2004,2005,2006,2003,2006,2013,2009,2005,2005,2004,2003,1998,1990,1990,1998,2009,2021,2030,2037,2047,2059,2063,2052,2031,2013,2001,1990,1978,1969,1964,1958,1954,1956,1961,1966,1971,1980,1997,2016,2023,2022,2026,2032,2034,2027,2014,2000,1989,1978,1968,1960,1960,1964,1967,1971,1981,1997,2018,2039,2061,2082,2100,2117,2129,2135,2145,2156,2155,2149,2141,2126,2112,2101,2087,2068,2047,2022,2001,1988,1977,1959,1938,1927,1921,1915,1906,1891,1877,1870,1869,1865,1858,1856,1864,1877,1892,1904,1912,1921,1934,1950,1965,1978,1986,2000,2021,2039,2049,2059,2069,2084,2105,2126,2141,2154,2166,2174,2179,2184,2193,2201,2200,2197,2200,2207,2207,2200,2195,2192,2187,2184,2181,2171,2159,2154,2151,2141,2130,2119,2107,2098,2094,2087,2075,2071,2066,2048,2028,2021,2022,2013,1997,1987,1989,1989,1980,1973,1969,1958,1948,1946,1944,1937,1929,1921,1914,1918,1925,1923,1917,1918,1926,1933,1933,1928,1931,1940,1947,1956,1967,1971,1971,1976,1988,2000,2007,2007,2010,2025,2042,2053,2057,2056,2055,2059,2067,2076,2082,2084,2088,2100,2110,2113,2112,2113,2119,2125,2126,2125,2129,2138,2148,2154,2156,2153,2151,2151,2149,2146,2149,2152,2151,2152,2153,2151,2150,2144,2136,2133,2137,2143,2145,2141,2139,2140,2134,2124,2123,2129,2128,2120,2117,2119,2117,2108,2100,2096,2094,2088,2077,2068,2064,2062,2058,2049,2039,2035,2035,2033,2025,2015,2013,2012,2006,1998,1993,1987,1984,1985,1984,1980,1975,1971,1969,1968,1963,1958,1957,1956,1952,1954,1965,1969,1965,1964,1964,1965,1972,1978,1978,1974,1970,1969,1972,1975,1978,1976,1972,1979,1991,1999,2000,1999,2001,2008,2014,2016,2016,2011,2006,2010,2018,2019,2018,2020,2021,2024,2029,2031,2036,2042,2044,2044,2049,2054,2052,2047,2054,2064,2060,2053,2060,2067,2064,2058,2059,2066,2070,2063,2058,2064,2070,2070,2073,2078,2081,2079,2079,2086,2090,2085,2079,2079,2077,2075,2079,2083,2082,2083,2086,2086,2082,2082,2090,2098,2096,2092,2093,2095,2096,2099,2100,2101,2101,2100,2101,2103,2103,2104,2107,2109,2108,2107,2109,2113,2111,2109,2117,2125,2123,2120,2117,2113,2113,2118,2122,2123,2123,2123,2122,2120,2116,2115,2116,2115,2114,2111,2109,2106,2102,2098,2100,2100,2098,2094,2089,2088,2092,2092,2090,2088,2084,2081,2079,2079,2076,2072,2071,2072,2070,2067,2066,2065,2063,2058,2054,2056,2057,2050,2045,2046,2047,2048,2046,2041,2038,2038,2041,2042,2042,2040,2036,2034,2034,2037,2041,2041,2036,2035,2042,2045,2042,2041,2042,2041,2036,2031,2033,2040,2041,2038,2037,2042,2048,2049,2047,2049,2053,2051,2046,2046,2052,2056,2055,2057,2061,2060,2057,2059,2062,2063,2063,2064,2064,2066,2066,2066,2072,2080,2081,2079,2083,2087,2086,2085,2085,2085,2086,2085,2086,2087,2084,2083,2087,2089,2089,2094,2099,2099,2102,2106,2110,2113,2110,2109,2113,2113,2110,2111,2111,2114,2118,2117,2121,2126,2121,2113,2112,2112,2112,2117,2119,2118,2117,2115,2116,2122,2126,2124,2119,2117,2120,2122,2120,2117,2117,2118,2117,2115,2113,2113,2110,2107,2107,2110,2114,2116,2112,2108,2109,2110,2107,2105,2106,2108,2110,2109,2106,2108,2108,2104,2103,2104,2100,2098,2099,2099,2098,2094,2092,2096,2098,2097,2098,2098,2094,2092,2089,2082,2080,2084,2085,2079,2074,2075,2075,2073,2073,2073,2071,2068,2069,2071,2071,2067,2063,2063,2062,2061,2061,2058,2052,2051,2052,2050,2047,2044,2043,2045,2046,2048,2047,2043,2042,2043,2041,2037,2036,2034,2031,2031,2033,2032,2029,2028,2029,2029,2025,2022,2021,2023,2025,2026,2024,2019,2013,2011,2014,2016,2016,2015,2013,2014,2015,2009,2004,2007,2011,2013,2014,2015,2013,2010,2008,2007,2005,2002,2002,2002,1998,1993,1992,1991,1989,1990,1992,1992,1990,1988,1989,1990,1985,1981,1982,1981,1980,1981,1980,1980,1983,1985,1982,1979,1979,1981,1982,1981,1979,1977,1980,1984,1984,1980,1976,1978,1983,1984,1980,1983,1989,1989,1988,1987,1986,1986,1986,1986,1986,1989,1991,1991,1987,1985,1991,1991,1988,1988,1991,1993,1993,1990,1987,1990,1995,1994,1992,1995,1999,1999,1995,1997,2010,2014,2002,1998,2008,2015,2014,2010,2008,2010,2012,2011,2010,2017,2028,2027,2021,2020,2022,2023,2022,2018,2019,2027,2034,2035,2035,2039,2039,2033,2031,2032,2034,2040,2042,2039,2042,2049,2048,2044,2043,2045,2051,2053,2049,2045,2045,2048,2052,2056,2059,2058,2055,2054,2055,2053,2053,2055,2060,2065,2069,2067,2063,2063,2065,2067,2069,2070,2069,2070,2071,2070,2066,2064,2068,2074,2074,2070,2069,2070,2072,2074,2077,2079,2077,2071,2068,2066,2065,2067,2070,2072,2070,2067,2065,2065,2067,2073,2078,2078,2078,2077,2074,2073,2074,2073,2073,2074,2073,2074,2073,2070,2070,2071,2069,2067,2066,2066,2065,2063,2059,2057,2055,2056,2056,2055,2052,2051,2053,2056,2058,2058,2058,2060,2059,2055,2051,2051,2052,2052,2049,2045,2043,2046,2048,2049,2051,2052,2050,2047,2047,2046,2042,2041,2043,2045,2042,2039,2035,2035,2037,2036,2034,2035,2038,2041,2039,2034,2031,2029,2030,2032,2034,2036,2032,2027,2026,2022,2020,2029,2027,2018,2026,2031,2020,2019,2030,2032,2031,2027,2022,2024,2026,2028,2029,2028,2027,2029,2029,2027,2028,2026,2021,2019,2020,2027,2033,2032,2030,2026,2020,2020,2023,2018,2017,2024,2017,2005,2017,2035,2025,2008,2015,2027,2025,2025,2032,2026,2021,2029,2033,2032,2032,2029,2024,2024,2030,2031,2026,2023,2027,2029,2025,2019,2016,2020,2025,2027,2024,2023,2023,2020,2015,2011,2011,2015,2019,2022,2021,2015,2012,2014,2015,2017,2022,2025,2024,2024,2024,2023,2022,2016,2017,2025,2027,2023,2023,2023,2020,2018,2017,2016,2015,2017,2022,2023,2020,2021,2026,2028,2027,2025,2026,2029,2031,2029,2025,2025,2029,2034,2039,2039,2038,2039,2038,2035,2033,2031,2031,2037,2037,2030,2027,2027,2025,2026,2031,2032,2030,2030,2032,2032,2030,2031,2035,2037,2037,2036,2036,2036,2037,2038,2043,2050,2051,2047,2045,2044,2044,2042,2041,2043,2044,2043,2044,2042,2040,2043,2048,2048,2045,2042,2039,2037,2036,2036,2040,2042,2043,2043,2041,2038,2037,2037,2038,2041,2039,2037,2038,2038,2036,2036,2036,2037,2037,2035,2032,2032,2035,2037,2039,2038,2037,2042,2045,2039,2036,2038,2041,2044,2046,2046,2047,2046,2043,2045,2050,2052,2051,2050,2050,2052,2054,2054,2053,2051,2049,2045,2047,2054,2059,2058,2055,2054,2056,2056,2053,2052,2052,2050,2050,2053,2054,2054,2053,2052,2052,2052,2053,2052,2051,2051,2051,2047,2044,2045,2050,2053,2052,2052,2058,2059,2055,2056,2057,2055,2052,2055,2058,2057,2057,2058,2056,2053,2057,2061,2062,2061,2057,2054,2053,2053,2056,2056,2051,2049,2053,2053,2052,2052,2051,2050,2054,2056,2055,2053,2049,2048,2050,2050,2050,2053,2054,2053,2049,2049,2053,2057,2058,2059,2062,2062,2062,2058,2055,2056,2060,2062,2063,2066,2066,2062,2058,2060,2061,2058,2057,2060,2060,2057,2058,2061,2061,2058,2056,2061,2064,2063,2062,2065,2066,2068,2068,2062,2060,2063,2063,2060,2062,2064,2064,2065,2062,2060,2064,2068,2068,2069,2070,2067,2064,2066,2072,2074,2072,2070,2068,2065,2063,2065,2070,2076,2075,2066,2060,2063,2068,2071,2074,2073,2068,2068,2073,2075,2076,2075,2073,2072,2073,2074,2073,2076,2080,2079,2075,2075,2077,2075,2069,2065,2066,2070,2071,2072,2074,2076,2077,2076,2074,2073,2073,2071,2069,2071,2073,2074,2077,2077,2076,2077,2075,2070,2066,2067,2067,2067,2067,2064,2062,2061,2061,2064,2068,2066,2064,2067,2065,2061,2062,2064,2067,2069,2065,2063,2067,2068,2065,2064,2065,2071,2077,2075,2068,2063,2060,2060,2062,2063,2065,2065,2061,2057,2057,2058,2058,2061,2069,2069,2065,2070,2071,2066,2070,2074,2066,2060,2063,2065,2063,2063,2070,2072,2064,2058,2060,2059,2055,2055,2061,2067,2068,2065,2064,2063,2061,2062,2065,2068,2067,2064,2062,2059,2052,2047,2049,2054,2059,2064,2062,2056,2053,2054,2062,2070,2068,2062,2060,2058,2054,2059,2069,2073,2073,2074,2074,2068,2061,2057,2058,2064,2067,2069,2071,2069,2065,2066,2071,2071,2069,2065,2059,2057,2058,2058,2057,2056,2056,2058,2063,2067,2068,2065,2059,2055,2057,2063,2065,2063,2062,2065,2064,2060,2058,2056,2054,2055,2058,2064,2069,2069,2068,2066,2062,2060,2062,2063,2064,2066,2065,2065,2066,2065,2064,2063,2060,2058,2057,2056,2059,2060,2060,2060,2056,2050,2050,2053,2056,2059,2055,2049,2050,2053,2055,2057,2056,2056,2058,2063,2067,2065,2058,2057,2061,2061,2060,2062,2063,2063,2061,2058,2058,2060,2061,2059,2057,2056,2054,2055,2058,2059,2060,2059,2055,2058,2064,2060,2056,2058,2058,2058,2059,2058,2056,2055,2053,2052,2053,2054,2056,2056,2054,2052,2049,2046,2047,2053,2058,2058,2056,2056,2058,2057,2054,2055,2056,2054,2052,2055,2053,2048,2052,2054,2051,2053,2055,2051,2048,2045,2040,2041,2044,2044,2043,2042,2044,2046,2042,2040,2046,2049,2043,2043,2046,2039,2035,2043,2051,2050,2050,2047,2042,2046,2049,2042,2039,2043,2043,2044,2049,2049,2047,2044,2036,2035,2042,2042,2035,2034,2040,2042,2040,2045,2047,2042,2042,2045,2042,2039,2043,2043,2039,2040,2043,2043,2042,2042,2046,2053,2051,2041,2035,2040,2045,2043,2039,2036,2035,2036,2037,2037,2035,2034,2036,2036,2031,2028,2032,2037,2034,2026,2026,2035,2041,2039,2031,2024,2024,2028,2033,2043,2047,2039,2033,2034,2038,2041,2036,2028,2026,2033,2041,2047,2050,2049,2042,2034,2027,2024,2032,2041,2035,2029,2033,2030,2027,2035,2034,2027,2032,2039,2037,2033,2028,2029,2038,2044,2043,2039,2032,2027,2025,2019,2019,2031,2034,2027,2031,2042,2042,2043,2051,2048,2039,2032,2020,2016,2031,2040,2036,2034,2034,2034,2038,2037,2033,2029,2028,2036,2047,2044,2038,2038,2033,2031,2034,2032,2032,2036,2033,2026,2023,2023,2029,2038,2036,2033,2038,2043,2044,2046,2043,2033,2028,2029,2030,2031,2038,2045,2041,2039,2046,2045,2031,2024,2025,2024,2026,2034,2038,2042,2045,2044,2044,2047,2043,2033,2020,2012,2014,2018,2021,2036,2056,2062,2054,2045,2038,2028,2017,2013,2022,2033,2034,2034,2040,2048,2053,2053,2048,2042,2039,2038,2030,2025,2027,2032,2036,2038,2035,2029,2033,2043,2049,2049,2045,2037,2033,2036,2036,2025,2011,2009,2020,2031,2030,2030,2036,2038,2038,2041,2041,2040,2040,2034,2034,2043,2043,2037,2035,2032,2030,2029,2020,2019,2028,2025,2019,2027,2031,2025,2027,2034,2035,2039,2047,2044,2027,2014,2020,2029,2025,2022,2024,2017,2014,2032,2052,2049,2042,2046,2044,2031,2027,2035,2037,2033,2035,2035,2024,2017,2023,2031,2035,2038,2041,2046,2046,2036,2029,2022,2017,2030,2051,2051,2035,2027,2034,2039,2028,2026,2041,2034,2009,2008,2025,2036,2051,2058,2043,2033,2042,2049,2044,2033,2030,2038,2037,2029,2033,2039,2030,2028,2038,2038,2036,2044,2047,2048,2059,2062,2051,2051,2059,2053,2036,2026,2034,2043,2041,2037,2035,2027,2030,2043,2046,2043,2038,2028,2023,2032,2041,2043,2045,2043,2040,2045,2053,2052,2045,2045,2047,2039,2033,2039,2045,2044,2043,2047,2046,2040,2044,2047,2035,2026,2037,2041,2028,2025,2035,2034,2031,2042,2048,2041,2040,2048,2046,2039,2042,2049,2048,2040,2039,2043,2042,2039,2040,2042,2042,2041,2039,2041,2045,2046,2046,2049,2051,2055,2057,2052,2050,2052,2050,2045,2042,2041,2046,2051,2051,2046,2045,2049,2055,2053,2046,2046,2052,2056,2054,2049,2050,2054,2057,2058,2053,2043,2040,2046,2052,2054,2055,2057,2056,2055,2056,2055,2053,2052,2049,2044,2047,2053,2053,2049,2047,2047,2048,2050,2051,2046,2039,2043,2052,2056,2052,2047,2046,2048,2046,2044,2045,2045,2045,2046,2045,2048,2054,2050,2042,2042,2051,2058,2057,2053,2052,2051,2046,2044,2045,2041,2038,2043,2050,2046,2036,2035,2039,2038,2039,2041,2036,2032,2035,2040,2040,2039,2042,2045,2042,2039,2042,2044,2043,2043,2049,2057,2061,2056,2047,2050,2059,2055,2043,2044,2049,2048,2048,2055,2062,2066,2068,2065,2061,2059,2062,2063,2054,2050,2058,2060,2053,2049,2047,2046,2049,2053,2053,2050,2049,2052,2054,2054,2053,2050,2048,2050,2051,2050,2051,2054,2058,2059,2056,2052,2050,2050,2054,2054,2052,2057,2059,2053,2055,2062,2062,2058,2064,2068,2064,2061,2062,2062,2061,2061,2062,2064,2061,2054,2052,2056,2056,2057,2057,2056,2061,2065,2064,2065,2064,2059,2061,2064,2061,2061,2062,2061,2061,2064,2068,2072,2071,2070,2072,2072,2070,2072,2071,2069,2074,2075,2067,2063,2065,2065,2065,2069,2070,2069,2070,2072,2070,2065,2063,2065,2067,2064,2062,2063,2065,2068,2069,2066,2064,2063,2064,2064,2062,2059,2060,2061,2065,2069,2066,2060,2065,2070,2065,2059,2060,2065,2068,2064,2058,2056,2057,2057,2056,2056,2056,2055,2052,2054,2056,2055,2052,2049,2048,2053,2058,2054,2048,2050,2055,2058,2056,2052,2052,2053,2048,2043,2046,2052,2052,2053,2055,2055,2052,2046,2045,2054,2062,2058,2052,2053,2059,2061,2059,2058,2062,2063,2062,2059,2057,2058,2060,2060,2059,2056,2055,2057,2056,2052,2053,2059,2061,2058,2057,2060,2061,2060,2061,2061,2058,2059,2061,2060,2058,2056,2056,2059,2061,2061,2063,2062,2058,2057,2058,2060,2063,2065,2066,2069,2069,2064,2062,2065,2067,2067,2066,2062,2062,2068,2067,2059,2058,2062,2063,2067,2071,2073,2074,2070,2068,2073,2075,2070,2066,2064,2065,2070,2070,2067,2066,2070,2074,2074,2068,2065,2067,2068,2067,2066,2064,2065,2062,2059,2062,2066,2062,2056,2059,2061,2059,2059,2059,2061,2066,2063,2055,2058,2065,2061,2054,2051,2054,2063,2062,2049,2051,2064,2064,2055,2049,2047,2051,2057,2057,2053,2051,2052,2053,2052,2047,2048,2050,2047,2046,2057,2063,2052,2040,2046,2059,2060,2055,2053,2052,2049,2052,2059,2055,2048,2053,2062,2066,2066,2059,2053,2051,2048,2043,2040,2039,2038,2037,2037,2044,2058,2064,2052,2037,2043,2064,2067,2050,2038,2046,2067,2075,2057,2036,2036,2054,2064,2053,2038,2040,2052,2059,2060,2056,2054,2059,2064,2063,2055,2044,2036,2036,2042,2046,2043,2040,2049,2060,2058,2048,2045,2055,2063,2057,2045,2039,2043,2053,2052,2038,2033,2044,2050,2047,2044,2046,2052,2058,2058,2056,2055,2057,2059,2059,2058,2055,2051,2053,2056,2054,2054,2055,2054,2060,2064,2056,2051,2055,2055,2049,2046,2047,2049,2048,2046,2047,2048,2047,2043,2037,2036,2043,2047,2048,2047,2049,2052,2052,2052,2052,2049,2048,2047,2042,2037,2039,2044,2047,2047,2045,2043,2042,2044,2047,2048,2046,2047,2049,2047,2043,2040,2041,2043,2044,2045,2047,2047,2044,2039,2039,2041,2040,2039,2041,2042,2040,2040,2037,2034,2038,2044,2045,2041,2035,2033,2038,2042,2041,2036,2035,2038,2044,2045,2040,2036,2037,2040,2041,2040,2038,2036,2039,2043,2044,2041,2038,2036,2035,2034,2031,2030,2033,2038,2042,2043,2044,2043,2040,2039,2041,2043,2045,2043,2038,2037,2039,2042,2041,2041,2044,2046,2045,2043,2041,2038,2036,2035,2035,2035,2034,2032,2034,2037,2039,2039,2035,2033,2035,2036,2033,2030,2029,2031,2036,2038,2037,2037,2037,2038,2041,2042,2041,2041,2045,2049,2047,2046,2045,2042,2042,2046,2046,2045,2044,2043,2042,2046,2050,2051,2047,2043,2041,2039,2037,2038,2039,2038,2037,2037,2038,2038,2035,2032,2030,2030,2032,2034,2034,2033,2032,2032,2034,2034,2031,2030,2031,2031,2030,2028,2029,2033,2034,2032,2029,2031,2036,2037,2033,2030,2032,2033,2031,2026,2024,2027,2032,2036,2037,2037,2037,2035,2032,2033,2035,2034,2033,2034,2035,2035,2032,2029,2030,2033,2033,2032,2033,2034,2034,2032,2033,2034,2035,2035,2033,2030,2030,2031,2029,2029,2031,2032,2029,2027,2027,2029,2028,2027,2026,2027,2027,2027,2027,2027,2028,2028,2030,2031,2031,2029,2027,2025,2024,2025,2026,2028,2028,2028,2027,2026,2028,2032,2035,2036,2035,2035,2034,2033,2031,2030,2031,2032,2034,2034,2034,2033,2033,2032,2031,2030,2029,2028,2028,2030,2032,2033,2032,2031,2033,2034,2034,2030,2028,2029,2033,2035,2034,2033,2034,2033,2032,2032,2034,2037,2038,2039,2037,2035,2034,2033,2033,2035,2036,2035,2036,2038,2038,2038,2038,2039,2041,2040,2039,2039,2039,2038,2036,2036,2040,2044,2043,2042,2044,2045,2044,2041,2040,2038,2035,2034,2036,2038,2039,2039,2039,2042,2044,2045,2043,2041,2041,2041,2037,2033,2035,2037,2035,2032,2032,2034,2035,2035,2037,2041,2042,2038,2035,2038,2041,2041,2037,2034,2034,2037,2040,2037,2036,2039,2040,2040,2039,2035,2032,2034,2037,2039,2038,2036,2037,2040,2043,2041,2037,2038,2043,2046,2044,2040,2038,2041,2044,2043,2038,2035,2037,2043,2046,2047,2047,2048,2049,2049,2048,2045,2043,2043,2043,2047,2053,2055,2054,2051,2047,2045,2044,2043,2044,2046,2048,2047,2045,2045,2048,2050,2052,2052,2050,2049,2047,2046,2047,2047,2048,2049,2049,2047,2047,2049,2050,2048,2046,2046,2049,2052,2054,2055,2053,2053,2053,2054,2055,2055,2052,2050,2051,2054,2056,2057,2058,2058,2055,2052,2049,2049,2050,2052,2050,2048,2050,2052,2051,2050,2052,2054,2054,2052,2052,2053,2056,2057,2058,2060,2061,2061,2060,2061,2062,2063,2062,2060,2060,2061,2059,2057,2057,2061,2064,2064,2062,2062,2063,2063,2060,2057,2056,2060,2065,2067,2066,2065,2066,2066,2066,2065,2065,2064,2064,2063,2062,2062,2064,2065,2066,2067,2066,2064,2063,2062,2062,2063,2064,2064,2063,2062,2062,2062,2062,2062,2062,2062,2063,2064,2064,2065,2068,2068,2067,2066,2063,2060,2061,2063,2064,2066,2067,2066,2066,2066,2064,2061,2060,2060,2062,2063,2063,2062,2061,2062,2063,2064,2063,2062,2061,2060,2060,2062,2064,2064,2063,2063,2065,2065,2062,2060,2061,2062,2063,2063,2064,2064,2062,2062,2064,2066,2065,2064,2062,2061,2063,2065,2065,2062,2060,2060,2063,2064,2064,2063,2061,2061,2061,2062,2062,2062,2063,2064,2066,2066,2066,2067,2067,2065,2062,2061,2061,2062,2063,2063,2063,2063,2063,2064,2067,2067,2065,2062,2061,2062,2061,2062,2064,2067,2068,2068,2066,2064,2062,2060,2058,2059,2061,2061,2062,2064,2065,2065,2064,2064,2065,2066,2066,2064,2063,2062,2062,2061,2062,2063,2064,2064,2063,2063,2065,2067,2067,2067,2066,2065,2065,2065,2063,2063,2062,2062,2064,2064,2062,2062,2063,2063,2064,2064,2063,2064,2063,2058,2056,2059,2061,2062,2063,2062,2061,2059,2058,2060,2061,2060,2059,2058,2059,2061,2062,2062,2063,2064,2063,2063,2063,2061,2061,2061,2062,2063,2064,2061,2059,2058,2057,2056,2057,2059,2062,2062,2062,2063,2063,2063,2064,2065,2064,2062,2061,2060,2060,2062,2064,2063,2061,2061,2061,2059,2056,2054,2055,2055,2054,2053,2054,2054,2054,2054,2055,2056,2057,2057,2056,2054,2052,2052,2053,2053,2052,2053,2055,2056,2057,2057,2056,2057,2056,2054,2052,2051,2050,2049,2051,2053,2054,2055,2057,2057,2057,2055,2054,2054,2057,2058,2057,2054,2050,2049,2048,2048,2050,2050,2050,2051,2051,2052,2053,2053,2052,2053,2052,2049,2047,2046,2044,2044,2044,2043,2043,2042,2040,2040,2040,2043,2047,2049,2049,2048,2045,2045,2046,2048,2050,2052,2051,2049,2046,2043,2042,2046,2050,2053,2053,2049,2044,2042,2041,2041,2042,2043,2045,2046,2047,2047,2044,2041,2041,2044,2047,2047,2047,2045,2045,2045,2046,2046,2046,2045,2043,2039,2039,2041,2046,2050,2052,2050,2046,2044,2043,2042,2044,2045,2045,2045,2044,2042,2041,2041,2043,2045,2046,2046,2046,2044,2042,2040,2040,2043,2044,2044,2042,2040,2040,2041,2040,2040,2041,2041,2043,2044,2042,2041,2040,2039,2040,2042,2041,2039,2038,2037,2037,2037,2037,2037,2037,2037,2038,2040,2041,2041,2040,2039,2041,2041,2038,2037,2038,2040,2041,2041,2040,2039,2041,2040,2039,2038,2038,2038,2039,2040,2039,2037,2036,2036,2036,2038,2039,2038,2037,2036,2035,2035,2037,2039,2039,2040,2041,2040,2036,2033,2034,2037,2039,2038,2037,2037,2039,2041,2041,2041,2041,2042,2043,2044,2043,2041,2038,2034,2034,2036,2037,2037,2037,2038,2038,2041,2044,2044,2041,2038,2036,2036,2036,2038,2040,2042,2042,2041,2039,2038,2037,2037,2037,2036,2037,2038,2037,2036,2034,2033,2032,2031,2032,2032,2033,2034,2034,2035,2036,2036,2035,2035,2035,2034,2033,2033,2034,2036,2037,2038,2039,2037,2035,2035,2036,2037,2036,2034,2033,2032,2032,2032,2032,2033,2035,2036,2036,2036,2035,2034,2035,2036,2038,2039,2038,2036,2037,2037,2037,2037,2037,2036,2037,2039,2040,2039,2039,2039,2040,2039,2037,2037,2037,2038,2038,2039,2038,2037,2038,2038,2038,2039,2039,2039,2040,2040,2038,2038,2038,2038,2038,2039,2041,2042,2041,2039,2038,2038,2037,2038,2040,2041,2040,2040,2040,2040,2039,2038,2039,2040,2041,2040,2039,2038,2038,2039,2041,2041,2043,2043,2041,2040,2039,2039,2041,2043,2043,2042,2041,2041,2040,2040,2042,2042,2040,2039,2039,2038,2039,2040,2039,2038,2038,2039,2039,2040,2041,2042,2043,2044,2043,2042,2043,2043,2041,2039,2038,2039,2043,2045,2045,2043,2041,2041,2041,2041,2041,2041,2041,2043,2043,2041,2040,2041,2042,2041,2039,2039,2039,2039,2039,2039,2038,2039,2040,2040,2040,2040,2041,2040,2038,2036,2035,2037,2039,2039,2039,2040,2042,2043,2044,2043,2041,2040,2041,2041,2041,2042,2042,2041,2040,2040,2040,2040,2040,2040,2041,2042,2042,2042,2043,2042,2041,2041,2041,2041,2039,2039,2040,2040,2039,2040,2040,2039,2040,2041,2040,2040,2041,2041,2041,2041,2041,2040,2039,2041,2043,2043,2042,2042,2043,2043,2044,2044,2043,2043,2044,2045,2044,2043,2042,2042,2043,2044,2044,2042,2041,2043,2044,2044,2045,2046,2047,2048,2049,2047,2046,2046,2046,2046,2047,2047,2049,2050,2049,2048,2049,2048,2048,2048,2047,2046,2046,2047,2048,2048,2046,2046,2047,2048,2051,2050,2048,2046,2047,2049,2049,2048,2047,2047,2047,2048,2048,2047,2047,2047,2048,2048,2049,2050,2050,2050,2050,2051,2052,2052,2051,2051,2051,2050,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2049,2049,2050,2051,2052,2051,2050,2050,2051,2052,2052,2052,2052,2053,2052,2051,2050,2050,2051,2052,2051,2052,2052,2053,2053,2052,2051,2051,2051,2052,2053,2053,2051,2051,2052,2053,2053,2053,2054,2055,2054,2053,2051,2049,2051,2053,2052,2051,2053,2055,2054,2053,2051,2051,2053,2053,2053,2052,2051,2051,2051,2054,2054,2052,2051,2054,2056,2055,2053,2052,2053,2052,2052,2052,2054,2057,2057,2056,2055,2054,2053,2053,2053,2053,2055,2056,2056,2054,2052,2052,2054,2055,2056,2055,2053,2054,2056,2056,2055,2053,2053,2053,2056,2059,2059,2057,2055,2055,2054,2055,2057,2055,2052,2052,2055,2057,2058,2057,2056,2056,2057,2058,2057,2056,2055,2055,2056,2057,2058,2057,2057,2057,2058,2059,2058,2055,2053,2052,2052,2054,2055,2056,2057,2059,2058,2056,2056,2058,2058,2058,2059,2059,2059,2058,2057,2056,2056,2055,2055,2057,2059,2060,2060,2060,2061,2060,2059,2058,2057,2056,2057,2057,2058,2058,2058,2057,2057,2058,2057,2056,2056,2058,2060,2060,2059,2056,2054,2055,2056,2057,2058,2059,2060,2060,2059,2058,2058,2058,2057,2058,2061,2062,2061,2059,2060,2059,2058,2058,2058,2057,2058,2058,2057,2058,2061,2061,2058,2058,2057,2056,2056,2057,2059,2058,2059,2061,2060,2058,2059,2059,2057,2057,2060,2059,2058,2058,2060,2059,2057,2056,2057,2057,2056,2057,2057,2058,2058,2059,2060,2059,2057,2057,2056,2055,2055,2056,2057,2059,2060,2060,2058,2056,2057,2059,2058,2056,2055,2056,2058,2059,2057,2056,2057,2057,2056,2054,2055,2056,2056,2056,2057,2057,2057,2055,2056,2057,2057,2057,2057,2058,2058,2059,2057,2055,2055,2057,2058,2057,2057,2059,2059,2058,2058,2057,2058,2058,2057,2056,2056,2056,2057,2057,2056,2056,2055,2055,2055,2055,2055,2055,2054,2053,2053,2053,2052,2051,2052,2054,2056,2055,2053,2052,2054,2055,2055,2055,2055,2054,2053,2052,2052,2051,2051,2050,2050,2051,2052,2053,2054,2054,2054,2054,2052,2051,2053,2054,2055,2055,2054,2053,2054,2053,2052,2052,2053,2055,2055,2054,2053,2052,2052,2052,2050,2049,2050,2052,2053,2052,2053,2053,2052,2050,2048,2047,2046,2046,2048,2051,2053,2053,2053,2052,2052,2051,2049,2047,2046,2047,2048,2050,2049,2047,2047,2050,2052,2051,2050,2050,2050,2050,2049,2051,2053,2053,2052,2050,2048,2047,2049,2049,2049,2049,2049,2050,2049,2048,2047,2048,2048,2047,2046,2047,2049,2049,2048,2048,2049,2049,2048,2047,2049,2051,2049,2047,2048,2051,2051,2049,2048,2049,2050,2049,2048,2050,2052,2051,2049,2048,2049,2050,2050,2049,2049,2050,2050,2049,2050,2050,2048,2047,2047,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2048,2047,2045,2044,2044,2046,2047,2047,2048,2048,2047,2047,2047,2046,2046,2045,2044,2044,2044,2044,2044,2045,2047,2048,2047,2045,2044,2045,2046,2044,2043,2044,2043,2044,2044,2044,2045,2046,2044,2043,2043,2045,2046,2044,2043,2043,2045,2045,2045,2045,2046,2046,2045,2044,2042,2041,2042,2043,2043,2043,2044,2045,2045,2046,2046,2045,2043,2042,2043,2043,2043,2044,2044,2042,2042,2044,2046,2046,2044,2042,2040,2041,2042,2044,2045,2044,2042,2042,2043,2044,2045,2044,2044,2044,2044,2042,2042,2043,2044,2045,2046,2043,2040,2040,2041,2040,2040,2042,2043,2044,2045,2045,2044,2042,2038,2036,2038,2041,2042,2043,2043,2044,2043,2043,2045,2046,2045,2043,2042,2042,2042,2042,2040,2040,2043,2043,2042,2042,2044,2044,2043,2043,2042,2041,2042,2042,2040,2040,2042,2041,2039,2039,2041,2041,2039,2039,2041,2043,2043,2041,2040,2041,2042,2041,2040,2039,2039,2039,2038,2041,2043,2040,2040,2043,2039,2039,2048,2046,2030,2029,2044,2054,2048,2031,2026,2045,2061,2048,2025,2025,2044,2053,2038,2026,2037,2049,2050,2045,2035,2033,2043,2043,2036,2037,2044,2042,2035,2037,2045,2046,2039,2037,2041,2044,2043,2040,2038,2039,2043,2042,2040,2042,2045,2042,2040,2040,2042,2044,2042,2039,2039,2042,2045,2043,2039,2038,2039,2040,2040,2040,2041,2040,2038,2039,2040,2040,2039,2038,2038,2037,2036,2038,2038,2037,2038,2039,2038,2038,2038,2038,2038,2039,2039,2040,2041,2040,2041,2042,2040,2039,2038,2039,2040,2040,2041,2042,2041,2041,2041,2040,2041,2042,2042,2040,2041,2043,2042,2042,2043,2042,2040,2040,2040,2041,2041,2043,2043,2042,2042,2044,2044,2041,2040,2041,2042,2041,2041,2042,2044,2044,2042,2043,2044,2043,2039,2039,2042,2044,2043,2042,2044,2045,2041,2039,2043,2045,2041,2038,2038,2040,2041,2041,2039,2039,2042,2043,2040,2040,2043,2044,2043,2042,2042,2044,2044,2042,2041,2040,2039,2040,2042,2043,2044,2044,2043,2042,2044,2045,2042,2039,2042,2047,2045,2039,2039,2043,2044,2043,2042,2042,2041,2043,2045,2044,2043,2045,2046,2045,2045,2043,2040,2039,2041,2042,2042,2043,2042,2041,2041,2042,2042,2041,2041,2043,2043,2041,2041,2045,2046,2044,2042,2042,2043,2043,2042,2042,2044,2043,2042,2042,2043,2045,2045,2043,2044,2046,2047,2046,2043,2041,2041,2043,2044,2043,2043,2043,2043,2045,2046,2046,2046,2047,2049,2049,2046,2044,2045,2048,2048,2047,2046,2045,2045,2044,2043,2041,2041,2042,2043,2045,2044,2043,2043,2044,2044,2044,2043,2044,2046,2047,2046,2046,2048,2048,2046,2044,2045,2047,2048,2047,2047,2048,2050,2051,2051,2050,2049,2048,2048,2051,2052,2051,2050,2051,2050,2048,2048,2049,2049,2051,2052,2052,2053,2054,2053,2051,2050,2050,2052,2053,2052,2052,2053,2051,2050,2051,2051,2051,2051,2051,2050,2050,2051,2050,2051,2052,2052,2052,2052,2054,2054,2054,2054,2054,2055,2054,2053,2052,2052,2053,2053,2052,2052,2052,2052,2053,2054,2053,2052,2052,2051,2051,2051,2051,2051,2052,2052,2052,2053,2053,2052,2051,2050,2050,2051,2051,2053,2054,2055,2055,2055,2054,2053,2053,2053,2053,2054,2054,2055,2057,2056,2056,2056,2056,2055,2056,2057,2056,2057,2058,2058,2058,2058,2058,2057,2057,2057,2057,2057,2056,2056,2056,2056,2056,2057,2057,2058,2058,2057,2055,2054,2053,2051,2051,2052,2052,2052,2052,2053,2053,2053,2053,2054,2055,2055,2053,2052,2051,2050,2051,2052,2052,2052,2053,2054,2053,2052,2053,2054,2054,2052,2052,2053,2055,2055,2054,2054,2055,2056,2056,2055,2055,2056,2056,2056,2056,2055,2055,2055,2055,2056,2056,2056,2056,2055,2054,2054,2054,2054,2055,2055,2053,2052,2054,2054,2053,2052,2051,2050,2050,2051,2052,2051,2050,2050,2049,2050,2050,2050,2050,2049,2049,2049,2049,2050,2051,2052,2054,2054,2053,2052,2052,2052,2054,2055,2054,2054,2055,2055,2056,2056,2056,2057,2058,2057,2057,2059,2059,2058,2058,2059,2060,2061,2061,2060,2058,2057,2058,2059,2059,2059,2059,2060,2059,2057,2056,2057,2058,2058,2058,2058,2058,2059,2061,2063,2063,2064,2065,2064,2062,2060,2060,2059,2058,2059,2060,2061,2061,2061,2061,2060,2059,2059,2059,2057,2057,2056,2055,2054,2055,2054,2054,2055,2054,2053,2054,2054,2053,2052,2051,2051,2051,2051,2050,2051,2050,2048,2047,2047,2046,2046,2045,2046,2047,2048,2048,2047,2048,2047,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2043,2042,2042,2041,2042,2043,2045,2046,2047,2047,2046,2046,2046,2046,2046,2047,2046,2047,2048,2047,2045,2046,2047,2048,2048,2048,2049,2050,2050,2050,2049,2049,2051,2052,2052,2052,2053,2055,2056,2056,2057,2057,2058,2059,2057,2056,2058,2060,2058,2058,2061,2062,2060,2057,2058,2060,2058,2057,2060,2063,2061,2059,2059,2060,2060,2058,2058,2060,2062,2062,2061,2061,2062,2062,2062,2063,2061,2060,2060,2061,2061,2060,2059,2059,2060,2060,2059,2059,2060,2059,2058,2057,2058,2059,2058,2057,2057,2056,2056,2057,2057,2054,2054,2055,2054,2052,2051,2052,2050,2049,2050,2051,2050,2049,2050,2049,2048,2048,2048,2047,2047,2047,2045,2044,2044,2044,2043,2043,2043,2043,2043,2042,2042,2042,2041,2041,2041,2041,2040,2039,2038,2038,2037,2037,2038,2039,2038,2037,2037,2036,2036,2035,2035,2035,2036,2036,2034,2034,2034,2034,2033,2033,2034,2035,2034,2033,2033,2034,2035,2035,2034,2032,2032,2034,2034,2033,2033,2034,2035,2035,2034,2033,2034,2036,2036,2035,2035,2036,2037,2038,2037,2037,2038,2039,2040,2039,2040,2041,2041,2041,2041,2041,2042,2043,2043,2042,2042,2042,2043,2043,2043,2044,2046,2046,2047,2047,2046,2046,2047,2047,2047,2048,2048,2049,2051,2051,2049,2048,2049,2050,2050,2049,2050,2051,2051,2051,2051,2053,2053,2052,2052,2053,2054,2052,2051,2052,2053,2054,2054,2054,2054,2054,2054,2053,2053,2053,2053,2055,2056,2055,2053,2054,2056,2057,2055,2054,2054,2054,2055,2054,2053,2054,2055,2055,2055,2054,2054,2053,2053,2053,2052,2051,2051,2052,2052,2052,2053,2053,2052,2052,2051,2051,2051,2050,2050,2050,2050,2050,2050,2049,2049,2048,2048,2048,2049,2049,2047,2048,2047,2046,2046,2046,2046,2046,2046,2045,2044,2043,2044,2044,2044,2045,2045,2043,2042,2042,2042,2042,2043,2042,2042,2041,2040,2041,2042,2043,2042,2043,2044,2043,2042,2042,2043,2043,2042,2042,2042,2040,2039,2040,2040,2040,2041,2040,2039,2039,2039,2039,2039,2039,2039,2039,2040,2040,2040,2040,2039,2039,2039,2039,2038,2038,2039,2039,2038,2039,2038,2036,2035,2036,2037,2038,2038,2038,2038,2038,2037,2037,2038,2037,2037,2037,2037,2037,2036,2035,2035,2035,2036,2036,2036,2036,2036,2035,2035,2035,2033,2032,2034,2034,2032,2032,2033,2033,2034,2034,2034,2034,2035,2035,2036,2037,2036,2035,2036,2037,2037,2036,2035,2036,2038,2038,2037,2036,2036,2036,2037,2038,2039,2038,2038,2038,2039,2038,2038,2040,2041,2041,2042,2044,2044,2043,2043,2043,2044,2044,2044,2044,2044,2043,2044,2044,2043,2043,2045,2046,2046,2047,2047,2047,2047,2047,2047,2048,2049,2049,2049,2049,2048,2049,2048,2047,2048,2049,2050,2049,2049,2050,2050,2051,2052,2053,2053,2051,2050,2050,2051,2051,2051,2051,2052,2053,2052,2050,2050,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2053,2054,2054,2054,2053,2052,2052,2052,2052,2052,2053,2053,2051,2050,2051,2052,2053,2052,2051,2051,2051,2052,2053,2053,2053,2052,2051,2050,2050,2050,2049,2049,2050,2050,2050,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2051,2051,2050,2049,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2047,2047,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2044,2043,2043,2044,2045,2045,2044,2044,2044,2044,2043,2044,2044,2043,2043,2042,2043,2044,2043,2041,2041,2041,2041,2041,2041,2040,2041,2041,2041,2041,2043,2044,2043,2043,2043,2044,2044,2044,2043,2044,2044,2044,2043,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2043,2043,2043,2043,2042,2043,2044,2043,2043,2043,2044,2044,2044,2045,2045,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2045,2045,2045,2046,2046,2045,2046,2046,2046,2046,2046,2046,2047,2047,2047,2046,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2047,2047,2046,2046,2047,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2049,2050,2050,2050,2050,2050,2050,2050,2051,2052,2052,2052,2053,2052,2052,2052,2052,2052,2053,2054,2054,2053,2053,2052,2052,2054,2054,2054,2054,2055,2055,2055,2056,2055,2055,2055,2055,2055,2055,2056,2056,2056,2055,2055,2055,2054,2055,2055,2055,2055,2055,2056,2055,2055,2054,2054,2055,2055,2056,2056,2056,2056,2055,2054,2055,2056,2057,2057,2056,2056,2056,2057,2057,2057,2057,2057,2057,2057,2056,2056,2056,2056,2056,2058,2058,2058,2059,2059,2058,2058,2059,2059,2059,2058,2058,2058,2058,2058,2057,2057,2058,2058,2058,2057,2058,2058,2058,2058,2058,2058,2057,2057,2057,2058,2058,2058,2058,2058,2059,2059,2058,2057,2059,2060,2059,2058,2057,2057,2056,2055,2057,2057,2056,2057,2057,2056,2056,2056,2056,2055,2055,2056,2056,2055,2056,2056,2055,2055,2055,2055,2055,2056,2056,2056,2056,2056,2056,2056,2055,2055,2056,2056,2055,2054,2054,2054,2054,2055,2054,2054,2054,2054,2054,2054,2055,2055,2054,2054,2054,2054,2053,2053,2054,2054,2054,2055,2055,2055,2055,2056,2055,2054,2055,2055,2055,2055,2054,2053,2053,2053,2054,2054,2053,2053,2054,2054,2055,2055,2054,2054,2054,2054,2054,2054,2054,2053,2053,2053,2053,2054,2054,2055,2054,2054,2054,2055,2054,2053,2053,2052,2052,2052,2052,2052,2052,2052,2052,2053,2054,2054,2054,2053,2053,2053,2053,2053,2053,2052,2051,2051,2051,2050,2051,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2050,2049,2050,2050,2050,2050,2049,2049,2049,2049,2049,2050,2049,2048,2049,2051,2050,2048,2048,2049,2050,2049,2049,2049,2050,2050,2048,2047,2047,2048,2048,2048,2047,2047,2048,2049,2049,2049,2048,2048,2047,2047,2047,2046,2045,2046,2048,2047,2047,2046,2047,2047,2046,2047,2046,2047,2048,2048,2047,2047,2047,2046,2045,2046,2047,2046,2045,2044,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2048,2048,2046,2046,2046,2047,2047,2047,2047,2046,2047,2047,2046,2045,2044,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2045,2046,2045,2044,2044,2044,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2046,2047,2047,2047,2046,2047,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2046,2045,2045,2045,2045,2045,2046,2046,2046,2046,2045,2044,2045,2045,2044,2044,2044,2045,2044,2044,2045,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2045,2044,2044,2044,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2045,2045,2046,2046,2046,2045,2045,2045,2044,2044,2045,2045,2044,2044,2044,2043,2043,2043,2043,2043,2042,2042,2042,2042,2043,2044,2044,2044,2044,2044,2044,2044,2043,2043,2044,2043,2043,2043,2043,2042,2042,2042,2042,2042,2043,2043,2043,2043,2042,2042,2041,2041,2042,2042,2041,2041,2042,2043,2043,2042,2042,2043,2043,2043,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2045,2044,2043,2043,2043,2044,2044,2044,2043,2042,2042,2042,2043,2043,2043,2043,2043,2043,2044,2044,2043,2043,2044,2044,2043,2043,2042,2042,2043,2043,2043,2043,2042,2041,2041,2042,2041,2040,2041,2043,2043,2042,2042,2042,2042,2042,2043,2042,2040,2041,2043,2043,2042,2043,2043,2043,2042,2041,2041,2042,2042,2041,2041,2041,2042,2042,2042,2042,2043,2043,2044,2044,2045,2045,2044,2043,2044,2045,2044,2044,2044,2043,2043,2043,2042,2042,2043,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2044,2043,2043,2044,2043,2043,2043,2044,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2043,2041,2041,2042,2044,2045,2045,2045,2044,2044,2046,2047,2047,2047,2047,2046,2046,2046,2045,2045,2046,2046,2045,2045,2045,2045,2044,2044,2045,2046,2046,2046,2045,2046,2047,2047,2046,2045,2045,2045,2043,2042,2043,2043,2042,2042,2042,2042,2041,2042,2043,2043,2043,2043,2043,2043,2044,2044,2044,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2044,2044,2044,2043,2042,2042,2042,2043,2044,2044,2044,2044,2044,2045,2046,2047,2046,2047,2048,2048,2048,2048,2048,2049,2049,2048,2048,2049,2048,2048,2048,2048,2048,2048,2049,2048,2049,2049,2049,2049,2049,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2050,2049,2049,2049,2049,2048,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2048,2049,2049,2048,2048,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2050,2051,2050,2049,2049,2049,2049,2048,2049,2050,2050,2050,2050,2050,2049,2050,2050,2051,2050,2051,2052,2052,2052,2052,2053,2054,2053,2053,2053,2052,2051,2051,2050,2050,2050,2050,2050,2050,2051,2051,2052,2052,2052,2052,2052,2052,2051,2051,2051,2050,2050,2050,2051,2051,2051,2050,2050,2050,2050,2050,2050,2049,2050,2050,2051,2051,2050,2051,2051,2051,2051,2050,2051,2051,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2051,2051,2051,2050,2049,2049,2048,2048,2049,2050,2050,2051,2051,2050,2050,2051,2051,2052,2052,2052,2052,2052,2051,2051,2052,2053,2053,2053,2052,2052,2052,2052,2051,2051,2051,2052,2052,2053,2053,2053,2053,2054,2054,2055,2056,2056,2055,2055,2054,2054,2054,2054,2055,2057,2056,2056,2056,2055,2055,2055,2055,2055,2054,2054,2055,2055,2055,2054,2054,2054,2054,2054,2054,2054,2054,2054,2054,2055,2055,2055,2055,2055,2055,2054,2054,2054,2054,2054,2055,2055,2055,2056,2056,2056,2055,2055,2056,2056,2055,2054,2054,2055,2055,2056,2055,2055,2055,2055,2055,2055,2054,2053,2053,2053,2054,2054,2053,2053,2053,2054,2054,2055,2055,2054,2054,2055,2054,2054,2055,2054,2054,2054,2054,2054,2054,2054,2054,2054,2054,2054,2055,2054,2054,2054,2055,2054,2055,2056,2056,2055,2056,2057,2056,2056,2055,2054,2053,2053,2053,2053,2053,2052,2052,2053,2053,2053,2053,2053,2053,2052,2053,2053,2053,2052,2052,2051,2051,2051,2051,2051,2051,2051,2052,2052,2053,2053,2052,2053,2053,2053,2053,2054,2053,2053,2053,2052,2052,2051,2052,2052,2052,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2050,2049,2049,2049,2049,2050,2050,2050,2049,2050,2050,2050,2049,2049,2050,2051,2051,2051,2051,2052,2052,2051,2051,2052,2052,2051,2051,2052,2052,2053,2052,2053,2053,2053,2053,2053,2052,2052,2052,2052,2052,2052,2053,2054,2053,2053,2053,2052,2053,2054,2053,2053,2053,2053,2052,2052,2052,2052,2053,2053,2054,2054,2054,2055,2055,2054,2054,2053,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2052,2051,2051,2051,2051,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2045,2044,2044,2044,2044,2045,2045,2045,2044,2044,2043,2043,2044,2043,2043,2043,2043,2043,2044,2044,2045,2045,2045,2044,2044,2043,2043,2043,2042,2043,2043,2043,2043,2044,2045,2045,2045,2046,2047,2047,2048,2047,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2049,2049,2049,2049,2049,2049,2048,2049,2049,2049,2049,2050,2050,2050,2049,2050,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2047,2048,2047,2045,2045,2045,2045,2045,2044,2043,2043,2043,2042,2042,2042,2043,2043,2042,2042,2041,2041,2040,2040,2040,2040,2039,2039,2039,2039,2039,2039,2039,2038,2038,2038,2038,2038,2037,2037,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2035,2035,2035,2035,2035,2035,2035,2036,2036,2036,2036,2036,2037,2037,2036,2037,2037,2037,2037,2038,2038,2038,2038,2038,2038,2038,2038,2038,2038,2038,2039,2039,2040,2040,2040,2041,2041,2042,2042,2043,2043,2044,2044,2044,2044,2045,2045,2045,2045,2046,2046,2047,2047,2048,2048,2047,2047,2048,2049,2049,2050,2050,2051,2052,2053,2054,2054,2054,2054,2054,2054,2053,2054,2055,2054,2054,2054,2055,2055,2055,2055,2055,2055,2055,2055,2055,2054,2054,2054,2054,2055,2055,2055,2054,2053,2052,2051,2051,2051,2052,2052,2052,2051,2051,2051,2051,2050,2050,2050,2049,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2045,2044,2044,2044,2044,2044,2044,2044,2043,2043,2043,2042,2041,2040,2039,2039,2039,2039,2039,2038,2038,2038,2038,2038,2038,2037,2037,2038,2037,2037,2036,2036,2035,2035,2036,2036,2035,2034,2033,2033,2032,2032,2033,2033,2033,2033,2033,2033,2033,2033,2033,2033,2034,2034,2033,2033,2034,2033,2033,2033,2032,2032,2033,2033,2034,2034,2034,2034,2034,2034,2034,2035,2036,2036,2036,2036,2037,2037,2037,2037,2037,2037,2037,2038,2038,2038,2038,2039,2040,2040,2040,2041,2042,2042,2043,2044,2043,2043,2043,2043,2044,2045,2046,2046,2046,2046,2047,2047,2048,2048,2048,2048,2050,2051,2052,2053,2054,2054,2053,2051,2051,2052,2052,2052,2053,2054,2054,2055,2056,2057,2057,2057,2057,2056,2056,2056,2056,2056,2056,2057,2057,2057,2058,2059,2060,2061,2062,2062,2061,2061,2060,2060,2059,2059,2060,2060,2060,2060,2060,2061,2060,2060,2060,2060,2060,2060,2060,2060,2060,2059,2059,2058,2058,2058,2058,2058,2059,2059,2058,2057,2056,2055,2055,2055,2054,2053,2053,2053,2052,2052,2053,2053,2053,2053,2051,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2047,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2044,2044,2045,2045,2043,2045,2046,2045,2043,2043,2043,2042,2041,2040,2040,2040,2040,2039,2040,2041,2040,2040,2041,2040,2039,2039,2039,2038,2037,2037,2037,2037,2037,2037,2037,2037,2036,2036,2036,2036,2037,2036,2036,2036,2037,2036,2036,2037,2036,2036,2036,2037,2036,2035,2035,2035,2035,2036,2037,2037,2037,2038,2038,2038,2039,2039,2039,2040,2040,2040,2040,2040,2039,2039,2039,2039,2039,2039,2039,2040,2040,2041,2042,2043,2043,2042,2042,2043,2043,2043,2043,2043,2043,2044,2044,2045,2045,2046,2047,2047,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2049,2050,2050,2051,2051,2051,2053,2054,2054,2053,2054,2054,2054,2055,2055,2054,2054,2055,2056,2057,2057,2057,2057,2056,2057,2057,2057,2057,2057,2056,2056,2057,2057,2057,2057,2057,2056,2057,2057,2056,2055,2056,2056,2056,2056,2057,2057,2058,2059,2059,2059,2058,2057,2057,2057,2058,2058,2058,2059,2059,2058,2058,2057,2057,2058,2057,2057,2057,2056,2057,2058,2059,2059,2059,2058,2058,2059,2060,2060,2060,2060,2060,2060,2060,2061,2061,2060,2060,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2058,2058,2058,2059,2059,2059,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2059,2058,2058,2057,2057,2057,2057,2057,2057,2056,2056,2057,2057,2056,2056,2057,2057,2056,2056,2056,2055,2055,2055,2056,2056,2056,2056,2056,2055,2055,2055,2054,2054,2054,2054,2054,2053,2053,2053,2052,2050,2050,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2046,2045,2045,2045,2045,2046,2046,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2043,2043,2044,2043,2043,2043,2042,2042,2042,2042,2042,2041,2041,2042,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2042,2042,2042,2042,2042,2042,2042,2043,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2044,2045,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2048,2049,2049,2049,2049,2048,2048,2049,2050,2050,2051,2050,2050,2050,2051,2052,2052,2052,2052,2052,2051,2051,2050,2050,2051,2051,2051,2052,2052,2052,2052,2052,2053,2054,2054,2054,2054,2055,2055,2054,2054,2054,2054,2053,2053,2054,2055,2055,2053,2053,2053,2054,2055,2054,2054,2055,2055,2055,2055,2054,2055,2055,2055,2055,2055,2055,2055,2055,2055,2056,2056,2056,2055,2055,2055,2055,2055,2055,2056,2055,2054,2054,2056,2055,2054,2054,2054,2054,2054,2055,2055,2054,2053,2052,2053,2053,2053,2053,2053,2053,2054,2054,2053,2052,2053,2053,2052,2053,2054,2054,2053,2053,2054,2053,2052,2052,2052,2052,2052,2051,2051,2051,2050,2050,2050,2050,2051,2051,2050,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2048,2048,2047,2046,2047,2047,2047,2047,2046,2046,2045,2046,2046,2046,2047,2047,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2046,2046,2046,2046,2046,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2046,2045,2045,2045,2045,2045,2046,2045,2045,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2045,2045,2045,2045,2045,2046,2046,2046,2045,2045,2044,2044,2044,2044,2043,2042,2042,2043,2042,2042,2042,2042,2043,2043,2044,2044,2043,2043,2043,2042,2041,2041,2041,2041,2041,2040,2039,2039,2039,2040,2041,2041,2041,2041,2040,2039,2040,2040,2040,2040,2039,2040,2040,2041,2041,2041,2041,2041,2041,2040,2040,2039,2039,2039,2040,2039,2039,2038,2039,2039,2039,2039,2039,2039,2039,2039,2040,2040,2040,2040,2040,2041,2042,2042,2041,2041,2041,2041,2041,2041,2042,2042,2042,2042,2042,2041,2041,2041,2041,2042,2042,2043,2043,2042,2043,2043,2043,2043,2044,2043,2043,2043,2043,2043,2043,2044,2045,2045,2045,2045,2045,2046,2046,2046,2046,2045,2045,2046,2046,2045,2045,2045,2045,2044,2045,2045,2044,2043,2043,2044,2045,2045,2045,2044,2045,2046,2047,2047,2047,2047,2046,2047,2047,2046,2046,2047,2048,2048,2047,2046,2046,2047,2047,2048,2049,2048,2048,2047,2047,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2049,2049,2049,2048,2049,2050,2050,2050,2050,2049,2050,2051,2051,2051,2050,2050,2050,2050,2050,2049,2048,2048,2047,2047,2047,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2045,2045,2045,2045,2046,2046,2046,2045,2044,2045,2046,2045,2045,2046,2046,2045,2046,2046,2046,2045,2045,2046,2046,2046,2047,2046,2045,2045,2045,2044,2044,2043,2042,2042,2043,2044,2043,2043,2042,2043,2043,2044,2044,2044,2044,2043,2042,2042,2042,2043,2044,2044,2043,2042,2043,2044,2044,2044,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2045,2046,2046,2046,2047,2047,2047,2046,2045,2045,2045,2046,2046,2046,2046,2045,2045,2045,2045,2045,2044,2044,2044,2044,2043,2043,2043,2044,2044,2043,2043,2043,2044,2044,2043,2042,2043,2043,2043,2044,2045,2045,2044,2045,2045,2045,2046,2046,2046,2046,2045,2046,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2047,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2048,2049,2048,2048,2049,2049,2048,2048,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2048,2049,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2051,2051,2052,2051,2051,2052,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2053,2052,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2052,2053,2053,2053,2053,2053,2053,2053,2053,2053,2052,2052,2052,2052,2051,2052,2052,2052,2053,2053,2053,2053,2054,2054,2054,2054,2055,2055,2054,2054,2054,2054,2054,2054,2054,2054,2054,2054,2055,2055,2055,2055,2055,2055,2055,2055,2055,2054,2054,2054,2054,2053,2053,2052,2052,2052,2052,2052,2052,2052,2053,2054,2054,2054,2054,2055,2055,2054,2054,2054,2053,2053,2053,2053,2053,2054,2053,2053,2054,2054,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2054,2054,2054,2054,2054,2054,2053,2053,2053,2053,2053,2053,2053,2052,2053,2053,2053,2053,2053,2053,2053,2053,2054,2054,2053,2054,2055,2055,2055,2055,2055,2055,2055,2054,2054,2054,2053,2053,2052,2052,2052,2053,2053,2052,2053,2053,2052,2052,2052,2052,2051,2051,2051,2051,2051,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2049,2049,2050,2050,2051,2051,2050,2050,2051,2051,2051,2050,2050,2049,2049,2049,2050,2050,2049,2049,2050,2051,2051,2050,2050,2050,2049,2049,2047,2046,2047,2047,2047,2048,2049,2049,2050,2051,2051,2051,2051,2051,2051,2050,2050,2049,2048,2047,2046,2045,2045,2045,2045,2046,2047,2048,2050,2052,2052,2053,2054,2054,2054,2053,2052,2050,2048,2046,2043,2041,2040,2039,2037,2037,2038,2038,2038,2038,2038,2038,2037,2035,2035,2034,2032,2031,2029,2027,2026,2026,2027,2028,2030,2032,2036,2041,2047,2053,2060,2068,2075,2082,2089,2095,2101,2105,2109,2111,2112,2111,2109,2105,2101,2095,2087,2079,2070,2060,2050,2040,2030,2020,2011,2003,1996,1989,1983,1977,1974,1971,1969,1968,1968,1970,1972,1975,1979,1983,1989,1995,2002,2009,2017,2024,2032,2039,2047,2054,2061,2068,2075,2081,2088,2094,2099,2104,2109,2112,2116,2119,2121,2122,2122,2122,2121,2120,2118,2116,2112,2109,2106,2102,2099,2094,2089,2084,2080,2075,2069,2064,2059,2055,2051,2046,2041,2037,2033,2030,2026,2022,2019,2015,2013,2011,2009,2007,2005,2004,2002,2001,2000,1999,1999,1998,1998,1997,1998,1998,1998,1998,1999,2000,2001,2002,2003,2005,2008,2010,2013,2015,2018,2020,2023,2026,2029,2032,2035,2037,2040,2044,2047,2049,2051,2053,2056,2058,2060,2061,2063,2064,2066,2067,2069,2070,2072,2074,2075,2076,2078,2079,2080,2080,2081,2081,2081,2082,2082,2082,2082,2083,2083,2083,2082,2082,2082,2082,2081,2081,2081,2080,2080,2079,2079,2078,2077,2076,2076,2075,2074,2073,2072,2070,2069,2067,2065,2063,2062,2060,2057,2056,2054,2052,2051,2048,2046,2043,2041,2039,2037,2034,2032,2030,2028,2027,2025,2024,2023,2022,2021,2020,2019,2018,2017,2016,2015,2015,2015,2015,2014,2014,2014,2014,2015,2015,2015,2015,2015,2015,2016,2016,2017,2017,2018,2019,2020,2020,2021,2022,2023,2024,2024,2024,2025,2025,2025,2025,2026,2027,2028,2029,2030,2031,2032,2033,2033,2035,2036,2037,2038,2038,2039,2040,2041,2042,2043,2044,2045,2046,2047,2048,2048,2049,2050,2050,2051,2052,2053,2053,2054,2055,2056,2057,2057,2057,2058,2058,2058,2058,2058,2058,2058,2059,2059,2059,2059,2060,2061,2061,2061,2061,2061,2061,2061,2061,2062,2062,2063,2063,2063,2064,2064,2064,2064,2064,2064,2064,2064,2064,2064,2064,2064,2064,2064,2063,2063,2063,2063,2062,2061,2061,2061,2060,2060,2059,2059,2058,2058,2057,2056,2056,2056,2056,2055,2054,2053,2052,2051,2051,2050,2049,2048,2047,2047,2046,2045,2045,2045,2044,2043,2042,2041,2040,2039,2037,2037,2036,2036,2035,2034,2034,2033,2033,2033,2032,2031,2030,2029,2029,2028,2028,2027,2027,2027,2027,2028,2028,2028,2029,2029,2029,2029,2029,2029,2028,2028,2028,2028,2028,2028,2028,2028,2028,2029,2029,2029,2029,2030,2030,2030,2031,2030,2030,2031,2031,2031,2030,2030,2029,2029,2029,2027,2027,2026,2026,2025,2025,2025,2025,2025,2025,2025,2026,2027,2027,2028,2029,2030,2032,2033,2034,2036,2038,2040,2041,2043,2045,2047,2049,2051,2053,2054,2055,2057,2059,2061,2063,2064,2066,2067,2068,2069,2070,2071,2071,2072,2072,2073,2073,2072,2072,2073,2072,2072,2071,2071,2071,2070,2068,2067,2067,2066,2064,2063,2062,2061,2061,2060,2059,2058,2057,2057,2056,2055,2055,2054,2053,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2049,2050,2050,2050,2050,2051,2051,2052,2053,2053,2053,2054,2054,2054,2055,2055,2055,2055,2056,2056,2057,2058,2058,2059,2059,2058,2058,2059,2059,2059,2059,2060,2060,2060,2060,2060,2060,2061,2061,2061,2061,2060,2060,2060,2060,2060,2059,2059,2059,2059,2059,2059,2059,2059,2058,2058,2057,2056,2056,2055,2055,2054,2054,2054,2053,2053,2052,2052,2051,2051,2050,2049,2048,2047,2047,2046,2045,2044,2043,2043,2042,2042,2041,2040,2039,2038,2037,2036,2035,2034,2033,2033,2032,2032,2032,2032,2032,2032,2031,2030,2030,2029,2029,2029,2029,2028,2028,2028,2028,2028,2029,2029,2029,2030,2030,2030,2030,2030,2030,2031,2031,2031,2031,2032,2032,2032,2033,2033,2033,2034,2034,2034,2034,2034,2034,2035,2035,2036,2036,2036,2037,2037,2038,2038,2039,2040,2040,2041,2042,2042,2043,2044,2044,2045,2045,2046,2047,2047,2048,2048,2048,2048,2049,2050,2050,2050,2050,2051,2051,2051,2051,2052,2053,2054,2054,2055,2055,2055,2055,2056,2056,2056,2057,2057,2057,2058,2058,2059,2060,2061,2062,2062,2062,2063,2063,2063,2063,2064,2064,2064,2064,2064,2064,2065,2065,2065,2065,2065,2065,2065,2065,2065,2065,2065,2065,2065,2066,2066,2066,2066,2066,2066,2065,2065,2065,2065,2065,2064,2064,2064,2064,2065,2065,2065,2065,2064,2064,2063,2063,2063,2062,2062,2062,2062,2061,2061,2061,2061,2061,2061,2060,2060,2060,2059,2059,2059,2058,2058,2057,2057,2057,2057,2056,2056,2056,2055,2054,2053,2053,2053,2053,2053,2052,2052,2052,2051,2051,2051,2051,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2045,2044,2044,2044,2044,2044,2044,2045,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2044,2044,2044,2044,2044,2044,2045,2045,2045,2044,2044,2044,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2047,2046,2046,2046,2046,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2044,2044,2045,2045,2045,2045,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2043,2043,2043,2044,2044,2045,2045,2044,2044,2045,2045,2045,2044,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2044,2044,2044,2044,2043,2043,2043,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2049,2049,2049,2049,2049,2050,2049,2049,2049,2049,2049,2050,2049,2049,2050,2050,2050,2050,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2050,2049,2050,2050,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2051,2051,2051,2051,2051,2050,2050,2050,2049,2049,2049,2049,2050,2049,2049,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2047,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2046,2047,2047,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2045,2045,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2045,2045,2046,2046,2046,2046,2046,2045,2045,2046,2046,2045,2045,2045,2045,2045,2045,2045,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2044,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2049,2049,2049,2049,2049,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2051,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2051,2051,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2045,2045,2045,2046,2046,2046,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2045,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2046,2046,2046,2046,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2050,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2049,2049,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2050,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2049,2049,2048,2048,2049,2049,2049,2050,2050,2050,2050,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2049,2049,2049,2049,2048,2048,2048,2049,2049,2049,2050,2050,2049,2049,2049,2049,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2049,2049,2049,2048,2048,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2050,2050,2050,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2050,2050,2050,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2046,2046,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2046,2046,2046,2046,2046,2046,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2048,2048,2047,2047,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2049,2049,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2050,2050,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2049,2049,2049,2049,2049,2049,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2050,2049,2049,2049,2050,2049,2048,2048,2048,2049,2049,2049,2048,2049,2049,2049,2049,2048,2048,2048,2049,2049,2048,2049,2050,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2049,2049,2049,2048,2049,2049,2048,2047,2047,2047,2048,2049,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2047,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2049,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2049,2048,2048,2047,2047,2047,2047,2047,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2049,2049,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2047,2048,2047,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,};
+/*IMA ADPCM sound, 127968 samples at 6176 Hz, generated by Tools/adpcm_encoder.c*/
+#include "adpcm.h"
+
+const uint8_t asteroid_impact_data[] = {
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x8A,0x80,0x80,0x80,0x00,0x17,0x0D,0x08,0x08,0x80,0x80,0x80,0x9F,0x50,0x08,0x08,0x80,0x80,0x80,0x00,
+0x9F,0x00,0x85,0x80,0x80,0x80,0x80,0xF0,0x09,0x80,0x80,0x80,0x00,0x70,0x81,0x80,0x80,0x70,0x8B,0x8C,0x40,0x80,0x80,0x0D,0x03,0x08,0x68,0x80,0x8C,0x8B,0x50,0x03,
+0xD8,0x80,0x80,0xD0,0x03,0x08,0xE8,0x30,0xD0,0x03,0x03,0x88,0x0D,0x08,0x08,0x08,0x08,0x17,0xD8,0x80,0xBC,0x30,0x50,0x08,0x58,0xB8,0x80,0x40,0xDB,0x33,0xC0,0x30,
+0x80,0xED,0x21,0x20,0x02,0xC0,0x0B,0x80,0x8C,0x40,0x80,0x3C,0xD0,0x30,0x30,0xF0,0x2B,0x02,0x80,0xBC,0x24,0x00,0x08,0x9F,0x32,0xB3,0x0C,0x33,0x34,0x9F,0xAA,0x32,
+0x02,0xB8,0xF8,0x4B,0x86,0x80,0x99,0x80,0x80,0x80,0xB0,0x78,0xC2,0x89,0x22,0x22,0xEB,0x10,0xD0,0xA9,0x40,0x80,0x82,0xBA,0x43,0xB8,0xAF,0x22,0x31,0x08,0x8B,0x58,
+0x9E,0x28,0x08,0x02,0xB3,0x3C,0x27,0x08,0xA8,0x83,0x8B,0xF0,0x3D,0x81,0x93,0x0D,0x08,0x93,0x32,0xFB,0x80,0x30,0xBC,0xA4,0x74,0xF0,0x5F,0x26,0xFB,0x8F,0x32,0x24,
+0x98,0xBA,0xAB,0x99,0x89,0x08,0x31,0x45,0x32,0x33,0x12,0x01,0x98,0xB9,0xCB,0xBB,0xBC,0xAB,0xAA,0xDB,0xCC,0xAB,0x9A,0x18,0x11,0x12,0x01,0x99,0xA9,0xAA,0xBA,0x8A,
+0x63,0x44,0x44,0x43,0x34,0x34,0x24,0x43,0x22,0x43,0x32,0x23,0x33,0x23,0x23,0x11,0x10,0x01,0xA9,0xAD,0x9B,0xCB,0xBD,0xAA,0xCB,0xCC,0xBA,0xBD,0xBB,0xBC,0xCC,0xBB,
+0xDB,0xBB,0xBD,0xBB,0xBD,0xCA,0xAA,0xCB,0xBB,0xCA,0xCB,0xAB,0xBB,0xBB,0xAC,0xBB,0x9A,0xAA,0x9A,0xAA,0x08,0x41,0x42,0x33,0x74,0x34,0x33,0x34,0x35,0x43,0x43,0x32,
+0x34,0x34,0x24,0x33,0x34,0x43,0x33,0x34,0x33,0x34,0x32,0x44,0x32,0x31,0x33,0x33,0x34,0x23,0x34,0x22,0x21,0x23,0x31,0x64,0x21,0x01,0x08,0x99,0x89,0xA9,0xAD,0xBB,
+0xBB,0xAD,0xBC,0xCB,0x99,0xBA,0xBB,0xBC,0x9C,0x12,0x14,0x10,0x02,0xB8,0x03,0xB4,0xC8,0xFB,0xDB,0xBC,0xAF,0xBB,0xDB,0xBC,0xBC,0xCC,0xCA,0xAB,0xBC,0xCB,0xCB,0xBB,
+0xBC,0xCB,0xCB,0xBB,0xBB,0xAD,0xBB,0xCB,0xBB,0xBB,0xBC,0xBB,0xAC,0xBB,0xAB,0xAC,0xAA,0x9A,0xAB,0xA9,0x98,0x89,0x12,0x22,0x44,0x53,0x24,0x53,0x43,0x42,0x33,0x53,
+0x33,0x34,0x43,0x43,0x42,0x32,0x43,0x33,0x53,0x32,0x33,0x34,0x34,0x33,0x25,0x43,0x32,0x43,0x33,0x34,0x34,0x33,0x25,0x43,0x33,0x53,0x32,0x24,0x43,0x33,0x34,0x43,
+0x33,0x34,0x34,0x33,0x25,0x33,0x34,0x43,0x33,0x33,0x35,0x33,0x43,0x43,0x32,0x24,0x32,0x24,0x23,0x33,0x24,0x32,0x33,0x33,0x33,0x05,0x32,0x11,0x08,0x28,0xA8,0xBB,
+0xBF,0xCA,0xFB,0xBA,0xBA,0xDC,0xBB,0xCB,0xAC,0xCC,0xAA,0xBB,0xCC,0xAC,0xAA,0xCC,0xAA,0xC9,0xBB,0xAB,0xEB,0x9C,0xAA,0xBA,0xAC,0xCA,0x9B,0xCB,0xBC,0x9A,0xCA,0xBB,
+0xAC,0xAA,0xDB,0xAC,0x98,0xBB,0x8C,0xDA,0x9B,0xA0,0xCD,0x0A,0x92,0xDC,0x2A,0xD3,0x8C,0x92,0x9B,0x08,0xA8,0x98,0xAD,0x01,0x9D,0xC0,0x3A,0xB3,0x9E,0x10,0xC0,0x8C,
+0x93,0x8D,0x13,0x9A,0x9B,0x27,0xCB,0x01,0x1A,0xA5,0x0B,0x14,0x80,0x99,0x3A,0x97,0x0D,0x07,0x99,0x11,0x02,0xCA,0x40,0x92,0x1A,0x11,0x13,0x1A,0x85,0x21,0x99,0x25,
+0x19,0x00,0x67,0x88,0x80,0x40,0x99,0x33,0x3A,0x17,0x89,0x01,0x35,0xC9,0x49,0x07,0x89,0x90,0x40,0xA2,0x28,0x98,0x53,0xDA,0x31,0xB8,0x22,0x58,0x16,0x90,0x9D,0x01,
+0x38,0xA9,0x37,0x99,0xB8,0x61,0xA8,0x15,0x8C,0x84,0x2B,0x93,0x5A,0xB2,0x8D,0x11,0x24,0xDC,0x10,0x10,0x01,0x01,0xAA,0x90,0x52,0xFC,0x10,0x80,0xA0,0x29,0x31,0x87,
+0x0E,0x03,0x98,0xAA,0x00,0x21,0xEC,0x38,0x81,0x99,0x48,0x11,0x03,0xBD,0xDB,0x60,0x92,0xAB,0x08,0x42,0x99,0x13,0xAF,0x03,0x0D,0x93,0x30,0xE9,0x98,0x4A,0x84,0x89,
+0x9A,0xB3,0xAF,0x21,0x16,0x09,0xC8,0x18,0x09,0xF0,0x70,0xD9,0x62,0xBA,0x21,0x10,0xF8,0x4A,0x84,0xA9,0x2A,0x85,0xAC,0x20,0x01,0x21,0xA2,0x9B,0xB9,0xCB,0x89,0x33,
+0x42,0x55,0x91,0xBA,0xCA,0x99,0x28,0x43,0x34,0x81,0xCC,0xAB,0x8B,0x43,0x45,0x81,0x99,0xCB,0x9B,0x08,0x45,0x12,0x81,0xCC,0x9A,0x09,0x34,0x42,0x03,0xDB,0xBB,0x99,
+0x31,0x43,0x23,0x32,0xB0,0xBC,0x31,0xF9,0x8D,0x89,0x38,0x42,0x14,0x01,0x90,0xFA,0xAE,0x00,0xA0,0x30,0x91,0x38,0x94,0x49,0x85,0x0A,0x24,0x90,0xEC,0x8A,0x11,0x53,
+0x92,0xBD,0x88,0x20,0x11,0x18,0x12,0x21,0x24,0xA8,0xAA,0xBD,0xA9,0xAC,0xBA,0x00,0xAA,0x21,0x56,0x34,0x25,0x81,0xA9,0xEB,0xAB,0xAA,0x88,0x01,0x42,0x22,0x63,0x13,
+0x30,0x15,0x88,0x08,0x88,0xA8,0xBD,0xCA,0xAC,0xA9,0xAA,0x98,0x58,0x14,0x08,0x88,0x54,0x12,0x50,0xA0,0x60,0xA1,0x9B,0x00,0x98,0x89,0xB9,0x2A,0x27,0x32,0x22,0xA1,
+0x8D,0xD9,0x09,0xEC,0x89,0x88,0x42,0x22,0x36,0x80,0x98,0x08,0xBB,0xB9,0xAF,0x01,0x8A,0x21,0xC9,0x38,0xB8,0x89,0x18,0x70,0x16,0x31,0x11,0x82,0x9F,0xA9,0x88,0x8A,
+0x01,0x3A,0x37,0x42,0x84,0x9C,0xC0,0x3A,0xC0,0x18,0xA8,0xDB,0x30,0x28,0x33,0x25,0x2A,0xA2,0x08,0x8F,0xC1,0x2C,0xC1,0x19,0x21,0xF9,0x20,0x11,0xDA,0x34,0xBF,0x24,
+0x99,0x89,0x25,0xBC,0x22,0xAA,0x20,0x88,0x27,0x9F,0x23,0xBB,0x14,0xBB,0x44,0xB0,0x9B,0x80,0x20,0x27,0x9B,0x23,0xC9,0xAB,0x21,0xBA,0x62,0x89,0x12,0x42,0xB8,0xA9,
+0x2A,0x03,0x80,0xBF,0xD9,0x0A,0x50,0x15,0x31,0x00,0xA8,0xB9,0xAB,0xBA,0x89,0xEB,0x30,0xFA,0x18,0x28,0x08,0x27,0x11,0x82,0x30,0xD1,0x09,0x99,0xFB,0x4D,0xA1,0x41,
+0xB8,0x09,0x21,0xC9,0xAA,0x38,0x32,0x83,0xBD,0x89,0xCB,0x10,0x73,0x11,0x25,0x00,0x99,0xC8,0xAB,0xB9,0x0A,0x12,0x38,0x23,0x54,0x02,0x52,0xA0,0x22,0xAC,0xE9,0x9C,
+0xAA,0x98,0x8A,0x80,0x24,0x8B,0x84,0x50,0x33,0x52,0x02,0x42,0x90,0x08,0x08,0xC2,0x2D,0xE9,0x08,0x9C,0x00,0x89,0xA9,0xBB,0xCB,0x89,0x0D,0x43,0x43,0x11,0x82,0x1A,
+0x22,0x16,0x41,0xB0,0x42,0x42,0xB8,0x45,0x88,0x90,0x50,0xB8,0x42,0xB8,0x01,0xBA,0xC8,0x9A,0xAE,0x22,0xBB,0x9B,0x34,0xBC,0x00,0x10,0x11,0xF2,0x0C,0xB2,0x8D,0x91,
+0x88,0x08,0x09,0xB0,0x4C,0x16,0x53,0x21,0x12,0x38,0xA1,0x50,0x82,0xDA,0x9A,0xDF,0x19,0xA8,0x18,0x90,0x30,0x14,0x41,0x13,0x01,0xAB,0xA1,0x8F,0x02,0x49,0x06,0x9A,
+0x23,0x89,0x80,0x80,0x0A,0x26,0xEC,0x29,0x80,0x12,0x20,0x15,0x0A,0xA4,0x1C,0xC2,0x61,0x98,0xA8,0x39,0x80,0xE0,0x0C,0x90,0xB0,0x5B,0x92,0x10,0x00,0x22,0xD8,0x41,
+0xB8,0x31,0x40,0xD0,0x62,0xB9,0x43,0x1B,0xD3,0x18,0x0F,0x96,0x6A,0xD1,0x39,0x91,0xA8,0x39,0x13,0xA8,0xCB,0x09,0x31,0x83,0x41,0xFA,0x1B,0x01,0x02,0xCB,0x39,0x12,
+0x00,0x10,0xC2,0xBF,0x01,0xAB,0x45,0x90,0x19,0x90,0xA8,0x99,0x68,0xD1,0x71,0xD9,0x51,0xB8,0x0A,0x23,0x90,0x08,0xCB,0x54,0xBA,0x18,0x20,0x31,0xB2,0x0E,0x01,0x22,
+0x99,0x81,0x09,0x13,0xCB,0xCE,0x89,0x71,0x05,0x09,0xDA,0x8B,0x21,0x31,0x04,0x89,0x98,0x09,0x22,0x88,0x25,0xA0,0x0D,0xB4,0x0E,0xA1,0x09,0x38,0xA2,0x8A,0xAA,0xB1,
+0x1D,0x04,0xAB,0x10,0xAB,0x14,0x8C,0x12,0xB8,0x7A,0x87,0x10,0x08,0x80,0x08,0x88,0x30,0x13,0xFB,0x0B,0xDD,0x19,0xA8,0x20,0xA9,0x99,0x80,0x29,0x03,0x44,0x11,0x8C,
+0x37,0x80,0x80,0x91,0x28,0xB9,0x63,0xA0,0x89,0x18,0xFD,0x9B,0x88,0x9E,0x15,0x1A,0xF0,0x2B,0x14,0xDB,0x19,0x54,0x92,0x8A,0xCA,0x29,0x16,0xA9,0x34,0x90,0xDB,0x8B,
+0x11,0x31,0x06,0xBA,0x08,0xB9,0x0A,0x55,0x22,0xA1,0xCB,0x9B,0x99,0x80,0x29,0x53,0x44,0x03,0x08,0xAA,0x00,0x38,0x92,0x88,0xFB,0xBF,0x99,0x80,0x80,0x90,0x8A,0x12,
+0x30,0x45,0x24,0x42,0x43,0x13,0x10,0x98,0xBA,0xB9,0x9E,0xD0,0x9C,0x09,0x11,0xBE,0x19,0xD8,0x9A,0x18,0x12,0x88,0x01,0x21,0x80,0x90,0x7B,0x07,0x29,0x15,0x10,0x10,
+0x22,0x11,0x00,0x42,0x23,0x11,0xD0,0x99,0x9B,0xF9,0xA9,0xAF,0xA8,0x89,0xEA,0x38,0xD9,0x8B,0x01,0x08,0x81,0x09,0x56,0x01,0x32,0x21,0x11,0x11,0xCA,0x8B,0x11,0x23,
+0xD0,0x2C,0xA3,0x10,0x5A,0x85,0x72,0x14,0xA0,0x11,0x88,0x99,0xA9,0xBD,0x44,0x80,0x88,0x23,0xDF,0x0A,0x36,0x90,0x9C,0x10,0x22,0x12,0xFA,0x9E,0x10,0x13,0x90,0x89,
+0x80,0xBA,0x9B,0x77,0x91,0x1A,0xC0,0x2B,0x15,0xC9,0x0A,0x02,0xAA,0x41,0x03,0x08,0x11,0xB8,0xCB,0xBA,0xAE,0x31,0x13,0x09,0x46,0xB0,0x28,0x82,0xBA,0xC9,0xAB,0x50,
+0x15,0x08,0x81,0x9B,0x91,0x8D,0x23,0x56,0xD1,0xBD,0x38,0x82,0xAA,0x51,0x03,0x99,0xCA,0x8A,0x34,0x33,0x92,0xBB,0xFB,0x9C,0x11,0x33,0x92,0xAA,0xAB,0x19,0x45,0xA2,
+0xBF,0x89,0x52,0x12,0x81,0xAA,0x51,0xA1,0x9C,0x9A,0x38,0x47,0x91,0x9A,0x31,0xD8,0x8B,0x20,0xC8,0xAB,0x50,0x14,0x80,0xCB,0x8B,0x01,0x42,0x33,0x53,0x83,0xCA,0x0A,
+0xBA,0x49,0x45,0x90,0x21,0xA0,0xBB,0x09,0xB2,0xDF,0x9B,0x21,0x33,0x91,0xBD,0x28,0x46,0x80,0x08,0x80,0x89,0x80,0x90,0xCD,0x19,0x01,0x44,0x81,0x99,0xEB,0x8C,0x00,
+0xA1,0x0B,0x43,0x91,0x11,0x89,0x75,0x13,0x08,0x11,0x20,0x92,0x9E,0x32,0x81,0xDB,0x8B,0x44,0x91,0xCC,0x0A,0x21,0x83,0xCE,0x8A,0x41,0x23,0x90,0xAB,0xBB,0x29,0x55,
+0x13,0x31,0x24,0xFA,0xAB,0x29,0x34,0xE0,0xBC,0x8A,0x01,0xA9,0x89,0x32,0x02,0x18,0x42,0x14,0x10,0x44,0x35,0x80,0x99,0x00,0x01,0xB0,0xDF,0xAB,0x89,0x08,0x98,0xAA,
+0x18,0x44,0x44,0x02,0x10,0x44,0x02,0x00,0x82,0x09,0x00,0xDC,0x0A,0x99,0x89,0x88,0xFC,0xAB,0x42,0xB0,0xEF,0x99,0x00,0x33,0x04,0xDA,0xBB,0x89,0x43,0x24,0x01,0x22,
+0x22,0x98,0xAA,0xCD,0x09,0x90,0x88,0x99,0x9A,0x50,0x82,0xAC,0x40,0x46,0x02,0x98,0xBA,0xBC,0x9C,0x08,0x10,0x90,0xDB,0x9A,0x90,0x89,0x18,0x89,0x19,0x47,0x24,0xA1,
+0xCE,0x89,0x10,0x22,0x34,0x92,0xA9,0x18,0x33,0xA8,0xAC,0x71,0x23,0x13,0xDA,0x9B,0x9A,0x58,0x45,0x23,0x12,0x00,0x90,0xDB,0x1A,0x45,0x23,0x91,0xBC,0x09,0x92,0x38,
+0x13,0x44,0x42,0x91,0xAC,0x48,0x23,0x90,0x30,0x46,0x24,0x01,0xB9,0xBF,0x09,0x41,0x14,0xB9,0xCA,0x1A,0x44,0x02,0xBA,0xAB,0x38,0x17,0x90,0xCC,0x1A,0x33,0x92,0xAA,
+0x08,0xA8,0xAC,0xB9,0xAD,0x88,0x41,0x33,0xE0,0x9C,0xA9,0x8A,0x62,0x81,0xAA,0x08,0x21,0xC8,0xBD,0x89,0x08,0x22,0x76,0x13,0xBB,0xA9,0x28,0x35,0x82,0xCB,0x0B,0x02,
+0x99,0x01,0xDC,0xAC,0x30,0x33,0x03,0xDD,0x8A,0x00,0x31,0x17,0x11,0x03,0xDA,0x19,0x00,0x11,0x41,0x23,0x82,0xDD,0x8B,0x53,0x01,0x98,0x89,0x08,0x28,0xB2,0xFF,0x09,
+0x12,0x80,0x08,0x21,0x83,0xCD,0x89,0x22,0xA1,0x9E,0x31,0x80,0x91,0xBF,0x28,0x14,0xCB,0x18,0x81,0x1A,0x47,0xB0,0xBC,0x9A,0x11,0x12,0xDA,0x9B,0x18,0x32,0x14,0x08,
+0xB0,0x39,0x95,0x9F,0x18,0x13,0x98,0x72,0x82,0x8A,0x36,0xC9,0x9B,0x00,0xA0,0x29,0x36,0xC9,0x0A,0x12,0x32,0xA2,0x9D,0x08,0xA1,0x8B,0x91,0xAF,0x01,0x31,0x92,0x48,
+0x15,0xB9,0x08,0xA8,0x71,0x37,0xB9,0xCB,0xA9,0x40,0x04,0x09,0x21,0x24,0xBA,0xED,0x9A,0x28,0x43,0x92,0x89,0xA9,0x29,0x93,0x09,0x40,0xB6,0x9F,0xE0,0xBF,0x53,0x02,
+0x98,0xCD,0x2A,0x36,0xA0,0xBD,0x09,0x43,0x22,0x98,0x18,0x13,0xB9,0xBF,0xBB,0x0A,0x18,0x45,0x23,0x23,0x23,0xA0,0xED,0xCB,0x9A,0x31,0x02,0xC9,0x0A,0x31,0x02,0x18,
+0x73,0x13,0xB9,0x0C,0x44,0x12,0x99,0x0A,0x32,0x81,0xDC,0xBB,0xBC,0xBB,0x9A,0x00,0xBA,0x9B,0x62,0x44,0x02,0xB9,0x2A,0x55,0x54,0x23,0x91,0xBB,0x9B,0x42,0x13,0xDA,
+0xAD,0x30,0x03,0xEC,0xAB,0x18,0x21,0x02,0x88,0x08,0xAA,0x28,0x47,0x81,0x08,0x33,0x12,0xB8,0x9B,0x74,0x23,0xA8,0xAA,0xCA,0x9A,0x10,0xD9,0xDF,0xAB,0x28,0x54,0x81,
+0xA9,0x0A,0x31,0x26,0x81,0x99,0x30,0x35,0x12,0xA8,0xBB,0x0A,0x21,0x02,0xEA,0xAC,0x99,0x11,0x91,0xBD,0xAB,0x9B,0x20,0x81,0xA8,0x59,0x67,0x23,0xA0,0xAD,0x09,0x43,
+0x81,0xCB,0x9A,0x41,0x12,0x88,0x99,0xBB,0x19,0x55,0x13,0x90,0xAA,0x30,0x37,0x12,0x82,0x88,0x52,0x13,0x22,0x12,0xFC,0x29,0x11,0x14,0xDD,0x0A,0x11,0x91,0x18,0x92,
+0xDF,0x18,0x63,0x81,0xCB,0x8A,0x21,0x33,0x92,0xEB,0x9B,0x20,0x44,0x81,0xAA,0xAC,0x28,0x32,0xA8,0xAB,0x49,0x27,0x00,0x98,0x88,0x11,0x90,0xCB,0x09,0x73,0x34,0xB8,
+0x9D,0x99,0x20,0x35,0xB1,0x9D,0x31,0x13,0xA8,0x9A,0x0A,0x14,0x90,0xA9,0xFB,0x9C,0x32,0x12,0xE9,0xBD,0x10,0x24,0xA9,0xB9,0x9D,0x51,0x23,0x90,0xCA,0x9C,0x30,0x33,
+0x81,0xAA,0xAE,0x09,0x21,0x22,0xA2,0xBF,0x29,0x53,0x12,0xEB,0xAB,0x89,0x20,0x02,0x80,0x88,0x10,0xBA,0x0A,0x72,0x36,0x91,0xAB,0x9C,0x43,0x12,0xA2,0x9D,0x31,0x14,
+0xB8,0xBD,0xBA,0x8A,0x11,0xB9,0xBC,0xCD,0x49,0x04,0x11,0x99,0x30,0x36,0x01,0x88,0xB9,0x8C,0x11,0x81,0xFB,0xAC,0x8A,0x23,0xFA,0x8A,0x10,0xA0,0x88,0x19,0x92,0x8A,
+0x38,0x77,0x90,0x89,0x08,0xF8,0x1B,0x94,0xAA,0xA9,0x19,0x01,0xFA,0x9E,0x00,0x18,0x12,0xA8,0x99,0x88,0x00,0x10,0x12,0x61,0x82,0xDC,0xBA,0xBE,0x09,0x98,0x40,0x82,
+0xC0,0x8C,0x22,0x10,0x02,0xC9,0xBB,0x21,0x23,0xEE,0xBB,0x0A,0x20,0x13,0xE8,0x9D,0x20,0xA2,0x18,0xFA,0xAA,0x31,0x24,0x90,0xCB,0xAB,0x60,0x23,0x22,0xB1,0x1C,0x43,
+0xA1,0x8C,0x21,0x92,0x9B,0x31,0xA2,0xCF,0x9A,0x10,0x98,0xBC,0xBB,0x3A,0x47,0x81,0x28,0x32,0x36,0x11,0x22,0x92,0xBF,0x8A,0x02,0xAB,0x0A,0x28,0x16,0xBB,0x9B,0xA8,
+0xBA,0x72,0x27,0x38,0xB1,0x5A,0x14,0x99,0x98,0xBC,0x98,0x28,0xFB,0x1C,0x20,0x24,0x22,0x08,0xC3,0x0D,0x15,0x09,0x01,0x30,0x80,0x17,0x1B,0x07,0xAE,0x81,0x38,0xB1,
+0x33,0xAE,0x12,0x21,0xD9,0x61,0x81,0x12,0xAA,0x99,0xAD,0x9A,0x40,0x44,0x24,0x12,0x88,0x00,0xDE,0x8A,0x89,0x08,0x42,0x24,0x33,0x22,0x01,0xB9,0xAC,0xAA,0xAB,0x08,
+0x00,0xB9,0xCF,0x09,0xD8,0xAB,0xAB,0x42,0x20,0x67,0x33,0x33,0x33,0x32,0x25,0x81,0x99,0x98,0xCB,0xAC,0xCA,0xBC,0xBD,0xAA,0xAA,0xCB,0x09,0x90,0x20,0x23,0x32,0x24,
+0x55,0x24,0x33,0x10,0x43,0x22,0x23,0x21,0x88,0x52,0x13,0x18,0x91,0x39,0xF8,0x40,0x90,0xFA,0x0C,0xA8,0x8A,0xA8,0xAC,0xA9,0x9A,0x90,0xBA,0xCF,0x38,0x80,0xC1,0x8E,
+0x22,0x89,0x01,0x19,0x27,0xA9,0x9B,0x40,0x26,0x80,0x8A,0x13,0x52,0x92,0x89,0xB0,0x5A,0x16,0x09,0xB9,0x69,0x82,0x89,0xA8,0x89,0x9A,0x9A,0x0A,0x42,0x03,0x00,0xFA,
+0xAD,0x48,0xA1,0x10,0x9A,0x80,0xAA,0x0B,0x46,0x81,0x82,0xBA,0xB0,0xDF,0x20,0xA0,0x40,0x81,0x00,0x32,0xEB,0xEA,0x3A,0x15,0x89,0xA8,0x9D,0x83,0x2B,0x26,0x88,0x23,
+0x08,0xB9,0x30,0x08,0x64,0xD1,0x0D,0x13,0x01,0xBC,0x20,0x24,0xB9,0x0C,0x45,0x91,0x1B,0x85,0xBC,0x60,0x93,0x8A,0x89,0x00,0x31,0xB8,0x10,0x1A,0x02,0x88,0x66,0xA8,
+0x20,0xDD,0x38,0x81,0x21,0x39,0xA4,0x1A,0x92,0xAD,0x24,0xAC,0x41,0x25,0xCA,0x88,0x2A,0x37,0x81,0xAA,0x9C,0x28,0x13,0x11,0xAA,0xAA,0x73,0xC1,0x00,0x30,0xF9,0x38,
+0x90,0x99,0x22,0xA8,0x00,0xDA,0x18,0xD9,0x69,0x83,0x48,0xB1,0x1A,0x19,0xF4,0x9E,0x43,0xB0,0x38,0x92,0xAC,0x18,0x83,0x8D,0x22,0xA8,0x58,0xA3,0x9E,0xA8,0x00,0x99,
+0x00,0x30,0x67,0xA2,0xBA,0xBA,0x89,0xCA,0x19,0x63,0x02,0x62,0x81,0x80,0xFB,0x9A,0x99,0x8A,0x21,0x20,0x21,0x64,0x84,0x9A,0x08,0xA0,0xAA,0xEA,0xBE,0x09,0x88,0x21,
+0x22,0x35,0x83,0x00,0x9A,0x11,0x12,0xA9,0x9B,0xFB,0x9F,0xA9,0x10,0x11,0xF9,0xAC,0x99,0x11,0x90,0x72,0xA0,0x00,0x80,0x43,0x99,0x99,0x32,0x29,0xCE,0x02,0x09,0xBF,
+0x91,0x31,0x29,0x01,0xA6,0x9F,0x20,0xB8,0x22,0xA8,0xA9,0x58,0xF3,0x0D,0x21,0x88,0xA8,0x1A,0xA9,0x69,0xA4,0x3A,0xB0,0x20,0x82,0x62,0xF9,0x0A,0xB8,0x4A,0x81,0x80,
+0x90,0x68,0x01,0xA0,0xAB,0xAC,0x21,0x02,0x31,0xFC,0x51,0xCB,0x26,0x0A,0x90,0xA9,0x23,0x0B,0xC2,0xCF,0x51,0x90,0x09,0x02,0x98,0x19,0xB1,0x2A,0x23,0xEB,0x61,0x01,
+0xB8,0x0D,0x80,0x84,0x1C,0x98,0x94,0x49,0xAB,0x95,0x1F,0x87,0x0C,0x22,0xB8,0xAA,0x7A,0x87,0xA9,0x29,0xA8,0x91,0x71,0x90,0x21,0xC0,0x8C,0x20,0xA2,0x8C,0x10,0x32,
+0x14,0x00,0xBC,0xBB,0x9A,0x08,0x21,0x36,0x33,0x04,0xAA,0xD9,0xBB,0x20,0x83,0xDB,0x60,0x25,0x81,0xC9,0xAC,0x09,0x21,0x13,0x80,0xB9,0xCC,0x8A,0x09,0x21,0x88,0x53,
+0x42,0x34,0x43,0x01,0x11,0xB8,0x9D,0x08,0xBB,0x2A,0xA8,0x42,0x25,0xDB,0x20,0xC0,0xAD,0x09,0x88,0x23,0xAC,0xDB,0x08,0xBC,0x19,0xB8,0x18,0x19,0x37,0x18,0x13,0x1A,
+0x32,0x42,0x27,0x00,0x32,0x53,0x03,0x61,0x01,0x32,0x80,0x50,0x92,0x01,0x9B,0xCB,0x02,0xEF,0x08,0x89,0x88,0xDB,0x08,0xAB,0x88,0x89,0xE8,0x0A,0x81,0x30,0x88,0x34,
+0xEB,0x21,0x43,0xB8,0x12,0xAE,0x32,0x11,0xB9,0x28,0x51,0x16,0x98,0x1B,0x37,0x98,0x28,0xA1,0x4A,0xA2,0x58,0x25,0x81,0xAA,0x50,0x81,0x24,0x8A,0x04,0x00,0x8B,0x83,
+0x6A,0xB4,0x1D,0xB1,0x31,0x90,0xAC,0x11,0xAA,0xA8,0x33,0x3B,0xF4,0x4E,0xD1,0x09,0x21,0x09,0x93,0x0D,0xD9,0x88,0x3B,0x96,0x8B,0x90,0x08,0x0B,0x93,0x6A,0xC0,0x10,
+0x01,0x8C,0x93,0x4B,0xB2,0x72,0xE0,0x21,0x99,0x11,0x88,0x39,0x13,0x33,0xE8,0x0B,0x88,0x87,0x2A,0x93,0xE8,0x39,0xAB,0x24,0x11,0x8C,0x84,0x8A,0x14,0xAB,0x99,0x52,
+0xA0,0x3A,0xA6,0x11,0x8F,0xB4,0x10,0x0F,0xB3,0x5A,0x90,0x00,0x91,0x0B,0x99,0x34,0x88,0x9A,0x02,0xA9,0x19,0xA0,0xD9,0x71,0x99,0x92,0x2C,0xB9,0x00,0x26,0x8E,0x02,
+0x08,0x9B,0x13,0x21,0x90,0xCF,0x25,0x9B,0x83,0x9B,0xA1,0x5C,0x04,0xA0,0x1B,0xE9,0x42,0x99,0x31,0xD8,0x0A,0x20,0xC0,0x2B,0x33,0xC0,0x28,0xB8,0x2C,0x97,0x3C,0x91,
+0x08,0xA9,0x4A,0x28,0xF3,0x2C,0x09,0x04,0xB1,0x7B,0xB1,0x10,0xC9,0x39,0x81,0xB8,0x03,0x0D,0xD9,0x00,0x11,0x32,0xCC,0x00,0x42,0xDC,0x41,0xC8,0x28,0x01,0x19,0xC1,
+0x50,0x89,0xA0,0x8B,0x40,0x89,0x47,0xAB,0x82,0x9A,0x1A,0x87,0x1A,0x80,0x88,0x80,0x88,0x8C,0x15,0xBA,0x24,0x1D,0xB2,0x18,0x1B,0x06,0x98,0x0B,0x06,0x8C,0x15,0x8B,
+0x91,0x29,0xC1,0x80,0x78,0xA1,0x88,0x08,0xA8,0xA1,0x6A,0x94,0x18,0xC8,0x28,0x10,0x02,0x62,0xC8,0x18,0xCD,0x21,0x0A,0x91,0x13,0x0D,0x84,0x28,0x83,0xCA,0x79,0xB2,
+0x0D,0x88,0x10,0xAB,0x84,0x78,0x91,0xA8,0x0A,0x88,0x11,0x06,0x9E,0x10,0x01,0x01,0x9A,0xB0,0xCD,0x6A,0x05,0x99,0x01,0x9B,0x92,0x48,0xA1,0xAC,0x13,0x2B,0x84,0xAC,
+0x24,0x9B,0x34,0xB9,0xAD,0x41,0x82,0xB9,0x4C,0x05,0xB9,0x0C,0x23,0xB8,0x52,0xAA,0xA3,0x3B,0xA2,0x89,0x12,0xDA,0x70,0x93,0x82,0x9C,0xA9,0x21,0x28,0x87,0xAB,0x09,
+0x24,0x31,0xBA,0xF0,0x3A,0x05,0xA9,0x10,0x91,0x55,0xCA,0x01,0x8A,0x91,0x2D,0x85,0x08,0x89,0x02,0x09,0x16,0x8B,0xC8,0x20,0x19,0x13,0xA1,0xAF,0x10,0xA0,0x69,0x93,
+0x40,0xCB,0x25,0x8B,0xA1,0x1A,0x19,0x86,0x19,0xB1,0x0B,0x73,0x81,0xBB,0x2A,0x83,0x89,0x03,0x4C,0xF1,0x49,0xB1,0x50,0xB9,0x21,0x31,0x8B,0xE0,0x9C,0x60,0xB2,0x28,
+0xB9,0x10,0x30,0xA4,0x0B,0xAF,0x34,0x8B,0x84,0x89,0x08,0x90,0xA8,0x09,0x9D,0x04,0x98,0x72,0x20,0xF2,0x8A,0xAA,0x48,0x05,0x81,0x0C,0xA0,0x11,0x99,0x20,0xA8,0xC0,
+0x2C,0x92,0x11,0x20,0xA4,0x2B,0xFB,0x01,0x19,0xAC,0x13,0x20,0x25,0xDC,0x89,0x83,0x78,0xB1,0x98,0x09,0x31,0xFA,0x20,0x10,0x01,0xAB,0x82,0x71,0xCA,0x91,0x3B,0xC1,
+0x62,0x00,0x92,0xAD,0x18,0x88,0x01,0x23,0x0B,0x33,0xF8,0x3B,0x09,0x93,0x2B,0x02,0x0B,0x37,0x04,0xBC,0x00,0xCA,0x51,0xB8,0x72,0x84,0xAC,0x10,0x00,0xA2,0x2A,0x11,
+0x27,0x89,0xDA,0x29,0x21,0xA2,0x09,0x08,0x41,0x82,0x08,0x1A,0x93,0x65,0xC9,0x09,0x22,0x11,0xBB,0x11,0x45,0x09,0x81,0x06,0x2B,0xC0,0x21,0x80,0x60,0x90,0x12,0x8C,
+0x11,0x99,0x27,0x9C,0x43,0xBA,0x34,0xAC,0x02,0x91,0x3A,0x83,0x89,0x1A,0x43,0xF8,0x4A,0x02,0xA0,0xB8,0x2A,0x51,0xA6,0x4A,0x08,0xC3,0x0E,0x12,0xA8,0x11,0x9B,0x15,
+0xBA,0x08,0x41,0x93,0xAF,0x80,0x0A,0x14,0x19,0x85,0x8C,0x98,0xAA,0x42,0x99,0x13,0xBB,0x60,0xD8,0x30,0x98,0x91,0x09,0xAE,0x34,0xA8,0x9A,0xA8,0x53,0xEA,0x18,0x98,
+0x31,0xC8,0x21,0x9A,0x19,0xFA,0x38,0x30,0xE9,0x11,0x8A,0xBB,0x27,0x99,0x80,0xCA,0x09,0x31,0x81,0x98,0x22,0xEF,0x08,0xA8,0x4A,0x11,0x01,0x83,0xEF,0x81,0x28,0xB9,
+0x42,0xB8,0x88,0x49,0x91,0xAA,0x50,0xDB,0x11,0x0A,0x83,0x42,0x98,0xF1,0x1C,0xA1,0x41,0x88,0xBB,0x13,0x8C,0x25,0xDB,0x12,0x8C,0x02,0x88,0x01,0x8E,0x03,0x99,0xA9,
+0x89,0x20,0x57,0xB8,0x09,0xA0,0x0A,0x02,0x18,0xD8,0x58,0x99,0x03,0x8B,0x2A,0xFE,0x42,0x08,0x90,0x98,0x59,0xD9,0x11,0x8A,0x81,0x29,0x86,0x8A,0xAD,0x15,0x2A,0xC9,
+0x10,0x18,0x12,0x90,0x0A,0xD8,0x09,0xA8,0x21,0x73,0xB1,0x8D,0x12,0x03,0x9F,0x02,0x28,0xAA,0x02,0x89,0x2A,0xD2,0xAA,0x59,0x34,0xEA,0x41,0x99,0xA2,0x0E,0x80,0x80,
+0x18,0x98,0x22,0x13,0x1C,0xF8,0x2B,0x99,0x89,0x24,0x28,0xA1,0x82,0xDB,0x1C,0x93,0x13,0x0D,0xF1,0x19,0x00,0x02,0xEA,0x19,0x19,0x91,0x51,0xB9,0x31,0x99,0x02,0x19,
+0x42,0xC2,0x98,0xDF,0x14,0x9A,0xA8,0x18,0x18,0x80,0xA9,0x29,0x22,0x87,0x8F,0x82,0x08,0x0A,0x83,0x89,0xAB,0x27,0x9D,0x94,0x1D,0x91,0x18,0xDC,0x40,0x90,0xAA,0x08,
+0x41,0xA1,0x19,0x0B,0x35,0xB0,0x8D,0x91,0x98,0x0B,0x14,0x31,0x92,0xCB,0x2A,0xB4,0x78,0xC5,0x8B,0x38,0x84,0x1A,0x88,0x10,0x20,0x95,0x0E,0x90,0x99,0x10,0x21,0xF9,
+0x89,0x10,0x1B,0x82,0x47,0x99,0x12,0x9A,0xA9,0x42,0x89,0xF9,0x21,0x29,0xB3,0x4A,0xB1,0x49,0xC0,0x09,0xAA,0x92,0x1E,0xA1,0x29,0x32,0x09,0xF3,0x9D,0x28,0xB8,0xFA,
+0x39,0x01,0x03,0x8B,0x0B,0xD2,0x0B,0xAB,0x82,0x0F,0x06,0x2A,0xA2,0x13,0x1C,0x91,0xB1,0x0D,0x51,0xA2,0x32,0x64,0x88,0x03,0x99,0x2A,0xB8,0x06,0x4D,0x95,0x19,0x80,
+0x31,0x92,0x1A,0xBA,0x53,0x23,0x29,0xFA,0x22,0xAC,0x35,0xB9,0x30,0x18,0x85,0x8A,0xAA,0x12,0x89,0x39,0xC6,0x1C,0x81,0x18,0xB2,0x8A,0x29,0xED,0x91,0x5A,0x99,0xC3,
+0x14,0x4F,0xF0,0x52,0x9D,0x04,0x8A,0x01,0x08,0xA0,0x28,0x91,0x29,0xC1,0x28,0x01,0x10,0xA9,0x40,0xA2,0x9E,0x32,0x81,0x11,0x38,0xA2,0x20,0x01,0x72,0xF8,0x41,0xA0,
+0x21,0x9A,0x37,0xBD,0x51,0xC0,0x49,0x91,0x99,0x30,0x22,0xB1,0x8D,0x83,0x0D,0x01,0x09,0x99,0x61,0x24,0xA0,0x8B,0xDA,0x09,0x98,0x31,0x07,0x28,0x93,0x1A,0xAA,0x9A,
+0xB8,0x71,0x80,0x12,0xCB,0x70,0xA3,0x29,0x02,0x40,0xE9,0x9B,0x98,0x29,0x44,0x24,0x02,0xBB,0xBB,0xBC,0x50,0x82,0x28,0x16,0xA8,0x30,0xC8,0x09,0x00,0x53,0xB0,0x9B,
+0x81,0x9D,0xA0,0x73,0xA2,0x1A,0x11,0x53,0x90,0x40,0xAA,0x33,0xA1,0xFF,0x01,0x11,0x89,0x02,0x18,0xDB,0x52,0xC9,0x29,0x01,0x10,0x9A,0x48,0x95,0x1B,0xA8,0x47,0x90,
+0x88,0x99,0xAB,0x38,0x23,0x63,0x91,0xAC,0x28,0x90,0x32,0x0A,0xA4,0x0D,0x80,0x88,0x48,0x24,0x80,0xAF,0x02,0x9D,0x92,0x60,0x03,0x98,0x18,0x00,0x90,0x0C,0xB2,0x8D,
+0x99,0x08,0x68,0x05,0x81,0x9C,0x01,0x38,0xA2,0x91,0x1A,0x0D,0x17,0xAD,0x28,0xB1,0x51,0x8A,0xB3,0x5A,0x85,0xBC,0x31,0x21,0xB1,0x1B,0xD8,0x18,0xA0,0x0B,0x46,0xA8,
+0x42,0xA9,0x00,0x80,0x9D,0x80,0x8B,0xCA,0x71,0x92,0x31,0xBD,0x33,0xA8,0xAA,0x1B,0xF2,0x8C,0x90,0x52,0xE9,0x18,0x20,0xC8,0x82,0x1F,0x92,0x18,0x18,0x99,0xC8,0x89,
+0x3A,0x07,0x39,0xA9,0x11,0x1A,0x24,0xF9,0x30,0xA8,0xAA,0x18,0x98,0x98,0x53,0x00,0xBD,0x00,0xAA,0x2E,0x84,0xA1,0xAF,0x43,0xC2,0x1A,0xDB,0x12,0x90,0x0A,0x82,0x92,
+0x0F,0x90,0x14,0xAB,0x80,0x11,0x9A,0x01,0xAF,0x43,0xC8,0x2A,0x82,0x2A,0x86,0x3B,0xE0,0x19,0x88,0x30,0xF2,0x9D,0x32,0x10,0xA2,0x18,0xAC,0x21,0x81,0x8C,0x71,0x93,
+0x30,0xAB,0xC8,0x39,0x94,0x8F,0x03,0x0C,0x32,0xA2,0xAD,0x10,0x9B,0x80,0x35,0xBC,0x88,0x31,0x32,0xB1,0x81,0x9F,0x53,0xA1,0x9E,0x92,0xBF,0x41,0x20,0xA1,0x1A,0xB1,
+0x8F,0x21,0x89,0x12,0x10,0xC8,0x19,0xB9,0x35,0xCB,0xAC,0x36,0x08,0x33,0xC8,0x58,0xD2,0x0D,0x12,0x00,0xAA,0x10,0x10,0xC8,0x9A,0x39,0x07,0x89,0xA9,0x31,0x08,0x86,
+0x8E,0x80,0x88,0x30,0xC8,0x69,0x05,0x8A,0x91,0x9B,0x09,0x91,0x0B,0x63,0x82,0x80,0x10,0xD9,0x9F,0x30,0x90,0x88,0x88,0x12,0x01,0x91,0x43,0xAE,0x13,0x28,0xE9,0xAC,
+0x62,0x80,0x8B,0x32,0x38,0xD2,0x0B,0x89,0xB9,0x71,0x23,0xCA,0x9D,0x41,0x03,0xA9,0x10,0x35,0x80,0x90,0xB9,0xCE,0xA9,0x21,0x21,0xB3,0x9F,0x53,0x01,0x80,0x08,0x90,
+0x80,0x0C,0x33,0x90,0xAE,0x51,0x12,0x90,0xCD,0xAA,0x89,0x80,0x63,0x92,0xAB,0x9B,0x11,0x23,0x9C,0x24,0x62,0x82,0xA0,0x8A,0xCE,0x88,0x71,0x02,0x91,0x9B,0x90,0xA0,
+0x38,0x33,0x16,0xA8,0x8F,0xB0,0x8A,0x9D,0x16,0x29,0x93,0x09,0x81,0xBC,0xBA,0x71,0x82,0x32,0x41,0xB4,0xAE,0x89,0x33,0x40,0xC2,0x8B,0x89,0x03,0x70,0x05,0xCA,0xCA,
+0x8A,0x12,0x41,0x23,0x89,0xB0,0x8B,0x0A,0x27,0x9C,0xB9,0x28,0x09,0x37,0x09,0xB8,0x18,0xDA,0x08,0xAD,0x42,0x28,0x47,0xAB,0xB1,0x1D,0x92,0x32,0x0A,0x03,0xAB,0x38,
+0x81,0xF1,0x0B,0xBD,0x36,0x28,0xB0,0x33,0x9C,0xA0,0xAB,0x51,0xBF,0x24,0x10,0x00,0xE2,0x1A,0xDA,0x18,0x20,0x12,0x31,0xA3,0x8F,0xD0,0x3A,0x82,0x88,0x98,0x78,0xA2,
+0x38,0x9A,0x00,0x32,0x10,0xFF,0x08,0x0A,0x83,0x18,0x41,0xB1,0x1A,0xB9,0x68,0x82,0xC9,0x38,0x01,0x24,0xF1,0x49,0xCA,0x82,0x30,0x89,0x90,0x17,0x1C,0xB0,0x1A,0x93,
+0x2D,0xD1,0x11,0x8D,0x32,0xA2,0x32,0x9E,0xA8,0x72,0xCA,0x14,0x3C,0xF5,0x4A,0x91,0x81,0x3A,0xE0,0xA9,0x49,0x24,0x81,0x9B,0x06,0xCC,0x09,0x88,0x30,0x26,0x80,0x98,
+0xDB,0x09,0x80,0x20,0x35,0x82,0x80,0xFA,0x9A,0x80,0xA8,0x40,0x33,0x32,0x11,0xC9,0xBD,0x8B,0x99,0x18,0x10,0x02,0x72,0x16,0x80,0xC9,0x89,0x42,0x82,0xEA,0x8A,0x08,
+0x54,0x01,0x80,0x08,0xFC,0x99,0x08,0x10,0x82,0x19,0x04,0x99,0x24,0xA1,0x9E,0xA0,0x30,0xC9,0x10,0x29,0x26,0x10,0x43,0x91,0x10,0xFA,0x09,0xA8,0x18,0x13,0xDA,0x2A,
+0x05,0xBE,0x9A,0x08,0x40,0x02,0x11,0xC9,0x9A,0x18,0x35,0x80,0x31,0x20,0x45,0x93,0x2D,0xD3,0x0B,0x01,0x28,0x26,0xDB,0x39,0xB0,0x18,0x19,0xA0,0xEA,0x2A,0xA0,0xF8,
+0x09,0x0B,0x27,0x8D,0x01,0x9A,0x11,0x31,0x90,0x20,0x72,0x94,0x0B,0x14,0xEB,0x9B,0x41,0x81,0xA9,0xAA,0x28,0x24,0x20,0x13,0xCA,0xBB,0x9B,0x32,0x73,0x24,0x01,0x33,
+0x88,0x90,0xFB,0x09,0xA0,0x38,0x03,0x50,0xB4,0x0C,0x03,0xCC,0x89,0xBB,0xBB,0x9D,0x80,0x19,0x80,0x01,0x59,0x37,0x00,0x13,0xAA,0x40,0x15,0xA9,0x09,0xA8,0xCA,0x9C,
+0xB8,0xCC,0x40,0xDA,0x09,0x88,0x10,0xC8,0x63,0x01,0x11,0x53,0x80,0x08,0xAA,0x42,0x80,0x52,0x02,0x11,0x38,0x97,0x3A,0xA4,0x9B,0x88,0x11,0x19,0x15,0x41,0x90,0x33,
+0xDC,0x09,0xCC,0x08,0x9A,0x82,0xC9,0x0C,0xD0,0x9E,0x10,0x99,0x89,0x99,0x18,0x12,0x45,0x01,0xA2,0x70,0x83,0x09,0x80,0x51,0x03,0x22,0x50,0x03,0x01,0xBC,0x34,0xAA,
+0x80,0xBC,0x19,0xF8,0x0A,0xB0,0x39,0xF0,0x8C,0x90,0x19,0xD0,0x9B,0x08,0xB9,0x21,0xCC,0xA1,0x9D,0x21,0x98,0x13,0x9A,0x20,0xC0,0x78,0x91,0x54,0xB1,0x39,0x05,0x30,
+0xA1,0x0B,0x55,0x81,0xAA,0x40,0x82,0xCD,0x18,0x08,0x84,0x9A,0x18,0x81,0x00,0xBA,0xAE,0x80,0x71,0x91,0xAA,0x08,0x08,0xEB,0x51,0xA1,0x18,0x04,0x9A,0x88,0x10,0x51,
+0x23,0x30,0x13,0x30,0xA9,0x72,0x46,0x22,0xA8,0x9A,0x28,0x53,0x23,0x25,0x08,0x03,0x1A,0x23,0x63,0xE0,0x8C,0x51,0x04,0x18,0x98,0xAA,0x08,0x98,0x99,0xCA,0x61,0x90,
+0x80,0xCC,0x21,0x98,0x08,0x23,0xEF,0x08,0x09,0x02,0x99,0xA9,0x99,0x2A,0xB4,0xAF,0x80,0x99,0xD8,0x0B,0xA1,0x29,0x98,0xEA,0x1A,0xD1,0xBE,0x99,0x29,0xE2,0x2B,0x13,
+0xDA,0x9B,0x13,0xBC,0x21,0x80,0x91,0xAF,0x81,0x88,0x99,0x24,0x88,0x23,0xBB,0x40,0x52,0x84,0x9D,0x31,0x20,0x14,0xA0,0x0A,0x03,0x73,0xA7,0x0A,0x01,0x00,0x50,0x82,
+0x19,0x80,0x20,0x35,0x81,0x10,0x41,0x14,0xB8,0x29,0xCB,0x73,0x17,0x98,0x08,0x11,0x02,0x18,0xB2,0x1B,0x01,0x53,0x36,0x12,0xB9,0x09,0x72,0x80,0x98,0x20,0x20,0x92,
+0x88,0x72,0x07,0x80,0x91,0x9C,0x12,0xC8,0x69,0x82,0x89,0x28,0xB1,0x9A,0x00,0x1A,0x15,0xBB,0x00,0xBB,0x00,0xA5,0xEF,0x12,0x18,0x92,0x8F,0x80,0x99,0x9B,0x01,0x10,
+0xEC,0x88,0x89,0x15,0xAA,0x0B,0xE2,0x1C,0x93,0xAC,0x01,0x8A,0x98,0x09,0xFB,0x0A,0xB1,0x8B,0xB9,0xA8,0xCE,0x9B,0x20,0x80,0xB8,0xCF,0x08,0xA9,0x8A,0xA0,0x8E,0xA1,
+0xA9,0x0B,0x14,0xEC,0x1A,0xB0,0xCD,0x1A,0x01,0x00,0x31,0x14,0xDA,0x9A,0xAB,0xBA,0x9B,0x01,0xFB,0x7A,0x16,0x98,0x09,0x00,0xCC,0x1A,0x33,0x34,0x46,0x81,0xCB,0xBC,
+0x9C,0x28,0x43,0x24,0x21,0x98,0x13,0x9C,0xA0,0xAC,0xA8,0x0B,0x37,0x22,0x12,0x11,0x98,0x08,0xCA,0xBB,0x62,0x32,0x35,0x31,0x24,0x88,0xB8,0xAD,0x80,0x9A,0x20,0x33,
+0x43,0x44,0x34,0x80,0x80,0xA9,0xA9,0x69,0x34,0x32,0x53,0x04,0x08,0xA9,0xB9,0x9B,0xDB,0x31,0x11,0x21,0x47,0x02,0x18,0xC8,0x99,0x99,0x32,0x23,0x03,0x98,0x74,0xF8,
+0x9A,0x89,0xA1,0x8A,0x30,0xA4,0x2C,0x91,0xA0,0x0D,0xA3,0xCB,0x9C,0xC8,0x8C,0xB0,0x0B,0xD9,0x28,0xE0,0x09,0xDA,0x9A,0x98,0xBA,0x8B,0x20,0xB0,0x9E,0xDA,0x8A,0x18,
+0xD8,0x9C,0x00,0xE1,0x8C,0x03,0x9A,0x32,0xD9,0x20,0xDC,0xAA,0x08,0x22,0xAE,0x11,0x80,0x9C,0x90,0xCA,0x9B,0x31,0xB3,0x9D,0x89,0xD0,0x0A,0x00,0x91,0x9A,0x9E,0xC9,
+0xB9,0x2A,0xBB,0x27,0x0B,0xB2,0x3A,0xF9,0x39,0xB8,0x31,0x1A,0x37,0xAF,0x03,0x19,0xA8,0x02,0x2B,0x99,0x67,0x8F,0x33,0x01,0xA9,0xEA,0x0C,0x34,0x12,0x00,0x12,0xBA,
+0xBB,0xBE,0xCD,0x29,0x73,0x42,0x23,0x02,0xD8,0xAC,0xCB,0x9A,0x10,0x22,0x43,0x34,0x33,0x12,0x88,0xCB,0xCC,0xBB,0xAC,0x9A,0x18,0x22,0x54,0x33,0x53,0x22,0x12,0x80,
+0x88,0xBA,0xDB,0xAC,0xAA,0xA9,0x0A,0x90,0x08,0x73,0x02,0x21,0x24,0x42,0x22,0x24,0x19,0xA2,0x08,0xAC,0xC0,0x8D,0x11,0x31,0x15,0x22,0x42,0xB0,0x20,0xFD,0x8B,0x91,
+0x19,0x32,0x84,0x30,0x44,0xA2,0x3A,0xA2,0xCF,0x09,0x8B,0x03,0x31,0xB0,0x20,0x20,0x81,0x30,0x44,0xD8,0x40,0xC9,0xDB,0x9C,0x88,0x08,0x40,0x84,0x50,0x90,0x12,0xBE,
+0x01,0x88,0x99,0x22,0x8A,0x01,0x19,0x11,0x72,0x05,0x18,0x90,0xAD,0x00,0xAA,0xC9,0x99,0xB9,0x88,0xCD,0x42,0xA8,0x80,0x98,0x39,0x47,0x11,0x80,0x30,0xB3,0x29,0xFB,
+0xA9,0xAB,0x8A,0x52,0xA1,0x40,0x98,0xFA,0x8E,0xA9,0x81,0x30,0xA0,0xA8,0x1A,0x22,0xB9,0x27,0x11,0x9A,0x94,0x0A,0xCF,0xA2,0x49,0x80,0x99,0x15,0x8F,0x81,0x09,0x11,
+0x98,0xB0,0x30,0xBB,0x03,0x40,0xCB,0xDA,0x30,0x9E,0x22,0x20,0x11,0x22,0xD0,0xAB,0xBC,0xD1,0xAF,0x12,0x00,0x3A,0xA4,0x3A,0x04,0xAC,0x01,0x0E,0xA3,0x8C,0x88,0x20,
+0x14,0x1A,0xD1,0x1A,0xC8,0x09,0x20,0xF2,0x5D,0x84,0x9B,0x00,0x09,0x65,0xA0,0xEA,0xBE,0x09,0x63,0x63,0x12,0xA9,0xBD,0xBB,0x89,0x42,0x34,0x13,0x01,0x98,0xA9,0x08,
+0x08,0xB9,0xED,0xCC,0xAA,0x18,0x63,0x34,0x33,0x23,0x90,0xCA,0xBD,0xAD,0xAB,0xAA,0x99,0x18,0x32,0x36,0x45,0x33,0x24,0x22,0x81,0x98,0xB9,0xCC,0xAB,0xCB,0xCB,0xBA,
+0xCB,0xAA,0x9A,0x18,0x53,0x34,0x34,0x23,0x12,0x88,0xA8,0x89,0x89,0x42,0x42,0x34,0x43,0x53,0x13,0x22,0x90,0xB9,0xAE,0xEB,0x9B,0x9A,0x89,0x08,0x91,0x08,0xA8,0x9C,
+0x88,0xA9,0x9C,0xBA,0x9C,0x99,0x19,0x33,0x90,0x50,0xA3,0x8A,0xEA,0xDB,0x8C,0x90,0x30,0x43,0x25,0x18,0x34,0x53,0x44,0x43,0x33,0x24,0x80,0x99,0xBA,0x3A,0x13,0x80,
+0x88,0xAC,0xDA,0x8D,0x80,0x63,0x91,0x18,0x99,0xE8,0x9D,0xAA,0x10,0xA8,0x88,0x73,0x13,0x10,0xC9,0x19,0xEA,0x9B,0xA9,0x98,0x89,0x91,0x89,0xBE,0xA0,0xFF,0x9A,0x99,
+0x99,0x80,0x0A,0x02,0x40,0x02,0xA1,0x39,0x94,0x74,0xB8,0x19,0x0A,0xD3,0x9D,0x28,0x25,0xB9,0x98,0x8A,0x24,0x90,0x39,0xF1,0x39,0x98,0x32,0xA8,0x75,0x01,0x98,0x0A,
+0x18,0x05,0x99,0xA9,0x09,0x02,0x89,0x8B,0x17,0x99,0x18,0x80,0x77,0x88,0x11,0x88,0x00,0xA9,0xB9,0x0A,0x44,0x82,0x90,0x99,0x9B,0x17,0x0A,0xC9,0x24,0x9E,0x13,0x09,
+0x90,0xFB,0x2B,0xA6,0x1C,0x90,0x28,0xBA,0x00,0xBB,0x22,0x38,0xB3,0xCB,0x29,0x89,0xA1,0x39,0x52,0x12,0xF4,0x9F,0xB1,0x0B,0x02,0xAA,0x80,0xB9,0x3A,0xD9,0x82,0x2E,
+0xD2,0x8B,0x21,0x08,0x13,0xED,0x1A,0xC8,0x39,0x05,0xD9,0x19,0x15,0xA9,0x10,0x13,0x38,0xA6,0x0C,0x02,0x31,0xC1,0x0A,0x02,0x18,0x23,0x88,0x9B,0x85,0x8F,0x92,0x28,
+0x22,0x05,0xAB,0x28,0x63,0x81,0x08,0x42,0x81,0x73,0x83,0xAA,0x23,0x00,0x13,0x74,0x27,0x00,0x90,0x1A,0x15,0x88,0x99,0x31,0x22,0x03,0x50,0xD3,0x69,0x84,0x89,0x88,
+0x22,0x12,0xA1,0x1B,0x37,0x09,0x33,0xEE,0x19,0x24,0x98,0x00,0xBA,0x60,0x13,0x98,0x1A,0x95,0x9E,0x32,0x43,0xC1,0xDB,0x8A,0x44,0x33,0x92,0xCC,0xAB,0x09,0x18,0x22,
+0x34,0x14,0x80,0x91,0xCD,0xBA,0xAB,0xBB,0x40,0x45,0x11,0x91,0x89,0x88,0x81,0xCF,0x08,0x18,0x21,0x34,0x80,0x82,0x9C,0x81,0x99,0xAA,0xED,0x9B,0xA0,0x9E,0x89,0x09,
+0xC9,0x1A,0x12,0x00,0x89,0x11,0x32,0x73,0x16,0x08,0x81,0x52,0x12,0x02,0x20,0x81,0xA9,0xAE,0xF9,0x9B,0xA9,0x89,0xAA,0x98,0x1A,0xF0,0x48,0x12,0x03,0xAC,0x00,0x8A,
+0x81,0x88,0xAB,0x99,0xCB,0xDB,0x9E,0x18,0x14,0x99,0x63,0xB0,0x1B,0x47,0x80,0x89,0x22,0x03,0x59,0x14,0x54,0x01,0x53,0x11,0x22,0x00,0x81,0x60,0x83,0x40,0xB0,0x50,
+0xB8,0x18,0x11,0x89,0x98,0x42,0x41,0xB2,0x8C,0x32,0x36,0xBB,0x33,0x33,0x92,0x1C,0x37,0xAC,0x21,0xD9,0x08,0x99,0x19,0x93,0x20,0x92,0xAF,0x05,0x0A,0x06,0x19,0xD1,
+0x50,0x80,0x08,0x19,0x05,0x19,0x98,0xA4,0x7A,0xA1,0x42,0xC8,0x09,0x21,0xB0,0x21,0x8B,0xA8,0xC3,0x1C,0x24,0xEC,0x00,0x20,0xEC,0x28,0xC9,0x08,0x08,0xE0,0x8C,0x81,
+0x8A,0xDB,0x08,0x88,0x80,0xA8,0xAB,0xBE,0x8A,0x9A,0xFB,0x29,0x08,0xE8,0x83,0x3F,0xF5,0x49,0xB0,0x20,0x89,0x80,0x80,0x18,0x90,0x09,0xA1,0x00,0x38,0xE8,0x11,0x8C,
+0xA8,0x20,0x19,0x93,0x58,0xE8,0x2A,0x91,0x30,0xCC,0x21,0x08,0xB0,0x9F,0x20,0x33,0xA2,0xAF,0x18,0x13,0xA9,0x10,0x24,0x00,0x91,0x30,0xD0,0x78,0x04,0x09,0x9A,0x13,
+0x8C,0x92,0x3A,0x83,0x13,0x01,0x9C,0x37,0xC0,0x9B,0x70,0x92,0x10,0x0C,0x15,0x9A,0x28,0x91,0x30,0x25,0x20,0xA8,0x88,0x72,0xA0,0x31,0x41,0xB1,0x64,0x01,0xA8,0x51,
+0x01,0x10,0x38,0xB2,0x2B,0x42,0x45,0xA2,0x0B,0x12,0x42,0xA3,0x3A,0xB2,0x74,0x99,0x01,0x1C,0x85,0x8B,0xA8,0x40,0x83,0x1A,0xC9,0x02,0xAF,0xD2,0x59,0x81,0x09,0x81,
+0x38,0xD8,0x89,0xCB,0x8C,0xD9,0x0A,0x98,0x18,0x58,0x27,0x08,0x23,0x13,0x88,0x52,0x43,0xC0,0x9D,0xBB,0xCA,0x1A,0xFA,0x8D,0x81,0x99,0x9A,0x21,0x08,0xB0,0xB9,0x39,
+0x44,0x04,0x41,0xB1,0x19,0x91,0x0C,0x91,0xAA,0x42,0xAB,0x16,0x88,0xF8,0x8D,0x91,0x9C,0x80,0xCB,0xAA,0x88,0x21,0xB1,0xAD,0x41,0xBE,0x12,0x9F,0x03,0xAA,0x1A,0x04,
+0xAB,0x11,0x80,0x1A,0x16,0x9B,0x42,0xB1,0x1C,0xA3,0x9E,0x80,0x30,0x22,0x84,0x8B,0x23,0x28,0x91,0x1F,0x06,0x3A,0x85,0x9A,0x0A,0x90,0x81,0x71,0x83,0x21,0x22,0xD8,
+0xAC,0x12,0xBB,0x30,0xA5,0x1C,0x83,0x10,0xCB,0x59,0x16,0x08,0x01,0xA8,0x89,0x33,0xC8,0x8C,0x22,0xC0,0x1F,0x04,0x39,0xA3,0x9B,0x24,0x2A,0xA2,0x1B,0x07,0x9C,0x08,
+0x23,0x29,0xD3,0x4A,0x15,0x0A,0x17,0x0A,0x14,0x00,0x98,0x0A,0x02,0x80,0x8B,0x94,0x40,0xE9,0x32,0x00,0xFB,0x50,0x03,0x89,0x82,0x08,0x98,0xC9,0x18,0x12,0x88,0x74,
+0x81,0x91,0x8D,0x15,0xA9,0x48,0xD0,0x38,0x02,0x09,0x80,0x81,0x0E,0x23,0xD9,0x4A,0xD2,0x1B,0x43,0xA8,0x20,0x28,0xA2,0x9D,0x23,0x99,0xCB,0x36,0x9C,0x24,0xBB,0x82,
+0x8A,0xB8,0x38,0x03,0x60,0xA1,0x0A,0x99,0x73,0x86,0x80,0xCC,0x11,0x90,0x4A,0x04,0x80,0x9A,0xBB,0x02,0x5C,0xD2,0x41,0x89,0x92,0x0C,0x93,0x0D,0xA0,0x11,0x8B,0xB4,
+0x6C,0xC1,0x29,0x81,0x80,0x28,0xA8,0x29,0xA9,0x06,0x8C,0xC2,0x0B,0x21,0x22,0x12,0x40,0xB8,0x92,0x8E,0x92,0xAC,0x51,0xD9,0x8B,0x45,0xA9,0x31,0x15,0x09,0x84,0x8B,
+0xCA,0x19,0x04,0xAD,0x23,0xCB,0x51,0x00,0xA0,0x2A,0x40,0xF2,0x39,0xD8,0x31,0x02,0xCE,0x38,0xA2,0x1B,0xD0,0x60,0xA0,0x29,0x35,0xC9,0x9A,0x08,0x21,0x92,0x50,0x02,
+0xA0,0xAF,0x89,0x11,0xA8,0x51,0x80,0x31,0xDA,0x22,0x9C,0x90,0xBD,0x50,0x14,0x10,0x32,0xC9,0x08,0xB8,0x19,0xEA,0xAB,0x0B,0x35,0xD9,0x99,0x41,0x18,0x07,0x8A,0x22,
+0x98,0x11,0x0B,0x13,0xDA,0xBC,0x3A,0x94,0x29,0x9C,0x17,0x9B,0x00,0x0A,0xA1,0x4A,0x26,0xA9,0x10,0xB8,0xCF,0x80,0x3B,0x15,0x80,0xA8,0x30,0x02,0xD8,0x00,0x9C,0xC0,
+0x1A,0x01,0x8B,0x67,0xA9,0xAA,0x33,0x22,0x94,0x9E,0x88,0x61,0x98,0x32,0xAB,0x11,0x89,0x32,0xD3,0x9E,0x10,0x13,0xA8,0xBF,0x43,0x89,0x02,0x0A,0xB9,0x0A,0xEB,0x48,
+0x15,0x9A,0x01,0x30,0x02,0x21,0xE9,0x2B,0x23,0x01,0x9A,0xD8,0x0C,0xB1,0x61,0x99,0xC3,0x8F,0x81,0x18,0x33,0x92,0x71,0xA2,0x9A,0x8A,0x55,0x81,0x80,0xBA,0x18,0x88,
+0x03,0xAC,0x45,0x90,0x80,0xFB,0xBC,0x10,0x99,0x23,0x9A,0x72,0x34,0xB0,0x08,0x89,0x43,0xD8,0x8B,0xB0,0x0E,0x04,0x19,0x91,0x1A,0x14,0x40,0x84,0x08,0xA9,0xC9,0x8B,
+0x99,0x00,0x11,0x73,0xE8,0x8A,0x88,0x21,0x91,0x0C,0x03,0xA8,0xCF,0x80,0x09,0xA9,0x23,0x19,0x72,0x02,0x89,0x12,0x0A,0x17,0xAD,0x80,0x0A,0x91,0x2A,0x04,0x8B,0x03,
+0x9F,0x00,0xC9,0x28,0xA9,0xA1,0x2C,0x02,0x29,0x36,0xD8,0x3C,0x06,0x89,0x08,0x13,0xEB,0x20,0x80,0x24,0x8C,0x13,0x99,0x9A,0x80,0x38,0xB4,0xBF,0x91,0x49,0xD0,0x20,
+0x0B,0x07,0x0C,0x90,0xA8,0x19,0x92,0x8A,0x44,0xDB,0x20,0x80,0xA8,0x4A,0x57,0xB9,0x21,0x11,0xC2,0x2C,0x93,0x0C,0x92,0xAA,0x4A,0x86,0x29,0x04,0x98,0x8A,0x89,0x22,
+0x03,0xBB,0x62,0xC9,0x11,0x18,0x35,0x90,0x39,0xE3,0x1C,0xA1,0x30,0xAC,0x22,0x9D,0x21,0x93,0x2D,0x96,0x19,0x13,0x14,0xBB,0x09,0x00,0x33,0x03,0x1D,0x37,0xBB,0x0A,
+0x25,0x20,0xA8,0x32,0xFC,0x4A,0xC1,0x0B,0x81,0x9B,0x32,0x05,0x39,0x95,0x8C,0xC1,0x3B,0xA3,0x21,0xC9,0x00,0x50,0x85,0x09,0x81,0xCC,0x19,0x22,0x00,0x16,0x20,0xD8,
+0x99,0x08,0x21,0xE0,0x29,0x03,0xD9,0x62,0xA8,0x21,0x88,0xA1,0x89,0x4A,0x95,0x29,0x0A,0x86,0x8B,0x81,0xB9,0x3A,0xD1,0x72,0x88,0x93,0x2C,0xC1,0x0A,0x99,0x11,0xCB,
+0x69,0x84,0x99,0x0D,0x03,0x42,0xAC,0x82,0x0B,0x39,0x86,0x64,0xBC,0x35,0xBC,0x31,0x80,0xA9,0x20,0xD9,0x40,0x02,0x01,0x91,0xCF,0x98,0x20,0x42,0x92,0x11,0xC9,0xBF,
+0x18,0x20,0x13,0x22,0x99,0x02,0x0B,0x83,0x70,0xE8,0x09,0xAA,0x99,0x2A,0x33,0x36,0x81,0xD9,0x89,0x8B,0x35,0x11,0x14,0xC9,0x1A,0xD9,0x19,0x28,0x04,0x1B,0x25,0x99,
+0x9C,0x21,0xCC,0x28,0xA8,0x91,0x0E,0x92,0x0A,0x11,0x91,0x10,0x73,0x93,0x1A,0x03,0xEB,0x28,0xC9,0x29,0xA9,0x37,0xDB,0x10,0x31,0xD8,0x11,0x00,0xED,0x30,0xA0,0xAB,
+0x38,0x85,0x19,0x82,0x33,0xAD,0x02,0xAA,0x80,0x70,0x93,0x8A,0xA9,0xB9,0x71,0xA3,0x60,0xB8,0x9B,0x88,0x39,0xD1,0x0C,0x44,0x98,0xAA,0x00,0x18,0x92,0x0C,0x16,0x0A,
+0xD8,0x0A,0x18,0x54,0xA2,0x1B,0xEA,0x40,0xC9,0x31,0xAA,0x13,0xBB,0x33,0x9C,0x83,0x5A,0xF1,0x0A,0x89,0xA0,0x68,0x92,0x41,0x90,0x30,0xC8,0xB9,0x9C,0xA0,0x50,0x31,
+0xF2,0x1A,0x82,0x20,0x33,0xB3,0x49,0xF9,0xAC,0x12,0x4B,0xC3,0x49,0x88,0x03,0x99,0x0A,0x14,0xBA,0x1C,0x07,0x8A,0x80,0x93,0x1D,0x01,0x04,0x1B,0xE0,0x09,0x89,0x22,
+0xAC,0x17,0x08,0xA8,0x08,0x12,0x0A,0xF9,0x1C,0x11,0xA2,0x5B,0xC2,0x2B,0x98,0x32,0x18,0xA4,0x9D,0x91,0x18,0x99,0x17,0xDB,0x31,0x00,0xA9,0x41,0xB8,0x00,0x80,0xA8,
+0x0D,0xA4,0x0F,0x04,0xB9,0x29,0x81,0x99,0x50,0xC1,0x0D,0x12,0x90,0x39,0x83,0x9B,0x04,0xAF,0x12,0x28,0x91,0x00,0x91,0xFF,0x20,0x01,0x0B,0xA5,0x1B,0xA1,0x21,0x9A,
+0xFB,0x30,0x01,0x99,0xA1,0x0F,0xB0,0x88,0x1A,0xA3,0xBE,0x78,0x04,0xA9,0x01,0xA9,0xA9,0x20,0x41,0xD0,0x1A,0xA2,0x2B,0xD0,0xA8,0x79,0xA4,0x19,0xB1,0x0E,0xA2,0x62,
+0xC9,0x00,0xA8,0x41,0x90,0x98,0x9A,0x52,0xB2,0x0C,0xA0,0x2A,0x14,0x22,0xA2,0xAF,0x82,0x9D,0x12,0x18,0x42,0x82,0x9B,0xA3,0xAF,0x84,0x1A,0xF1,0x28,0xBA,0x42,0x02,
+0x39,0x85,0x19,0xA8,0x89,0x33,0xAA,0xB3,0x2D,0xDA,0x00,0x64,0xC8,0x30,0xA9,0x05,0x0C,0x94,0x0A,0x21,0xE8,0x28,0x99,0x01,0x9D,0x45,0x98,0x88,0x48,0xF2,0x1B,0x02,
+0x21,0x89,0x08,0x82,0x9D,0x91,0x0B,0x17,0x0A,0xA1,0x51,0xC9,0x40,0x81,0xA8,0x8E,0x80,0x19,0x91,0x41,0x10,0xB3,0x0D,0x38,0x87,0x09,0x88,0x92,0x9B,0x20,0xD8,0x8B,
+0x53,0xA8,0x82,0x49,0x94,0xBB,0x88,0x42,0x43,0xF8,0x29,0x12,0xCB,0x80,0x50,0xC8,0x38,0xC8,0x61,0xB8,0x48,0xB0,0x88,0x8A,0x16,0x0A,0x14,0xBA,0x59,0xD2,0x2B,0x04,
+0x9A,0x88,0x30,0x84,0x2A,0x91,0x32,0xCC,0x00,0x19,0xB1,0x38,0x99,0x37,0x9A,0x81,0x68,0xA3,0x0F,0x13,0x11,0x9A,0x15,0xBD,0x20,0x28,0x14,0x38,0x83,0xCE,0x20,0xC9,
+0x38,0x23,0x15,0x8D,0x84,0x8B,0xA8,0x41,0x08,0x90,0x58,0x93,0xBB,0x30,0xF9,0x1B,0x04,0x60,0xB2,0x2A,0x23,0x20,0xF9,0x9C,0x88,0x50,0x03,0xB8,0x3A,0xF8,0x52,0x18,
+0xE2,0x2A,0x11,0xA0,0x88,0x8D,0x80,0x80,0x21,0x03,0x88,0x4A,0x37,0x99,0xC0,0x9E,0x88,0x11,0xDB,0x48,0x00,0x41,0x13,0xA8,0x00,0xA0,0xA8,0x1E,0x04,0x29,0x33,0xD9,
+0xAD,0x10,0xA8,0x1A,0x94,0xAC,0x8A,0x03,0xBB,0x53,0x11,0x25,0x08,0xB8,0x1A,0x52,0x14,0x32,0xA0,0xAB,0x30,0x16,0x98,0xBB,0x24,0xAC,0x89,0xA1,0x8F,0x81,0x22,0xBA,
+0x20,0x27,0xDA,0x31,0xBC,0x24,0x9D,0x90,0x31,0xC8,0x19,0x01,0xB9,0x19,0x23,0xAB,0x83,0xBF,0x53,0x80,0x37,0x88,0x84,0x9C,0x00,0x31,0x89,0xE9,0x40,0x18,0x82,0x33,
+0xBD,0x98,0x30,0xBA,0xBA,0x42,0x20,0x83,0x53,0xAF,0x03,0x0E,0x83,0x38,0xF9,0x2A,0x24,0x88,0x38,0xF8,0x38,0x90,0xA9,0x0C,0x82,0x21,0xA9,0x92,0xAF,0x83,0xBB,0x1C,
+0x27,0xA9,0x08,0xA3,0x0F,0xC3,0x1C,0x93,0x0A,0x90,0x73,0xFC,0x41,0xA8,0x80,0x18,0x80,0x01,0x9A,0x01,0x1C,0x07,0x8B,0x04,0x9A,0x10,0x89,0x90,0x2A,0x07,0x1B,0xA2,
+0x0B,0x91,0xA9,0x58,0x15,0xCA,0x8A,0x22,0xCC,0x42,0xA1,0x0A,0x11,0xD0,0x0B,0x90,0x80,0x59,0xA1,0x29,0x94,0x9C,0x20,0xF1,0x7B,0x01,0x90,0x1B,0xC1,0x48,0xB9,0x33,
+0x19,0xE1,0x29,0x99,0x18,0x94,0x1D,0x93,0x1A,0xA8,0xB9,0x1C,0x95,0x38,0xCB,0x27,0x9C,0x13,0x99,0x1A,0xA3,0x8F,0x11,0x03,0x1C,0xC0,0x28,0x38,0xD8,0x29,0x32,0xFA,
+0x1A,0x01,0x99,0x88,0x51,0x05,0xDB,0x31,0x92,0x08,0xCC,0x00,0x99,0x51,0xA1,0x38,0xB8,0x20,0xBE,0x21,0x1D,0x06,0x09,0x81,0xA9,0x21,0x09,0xDC,0x81,0x1C,0x14,0x89,
+0x24,0xCA,0x51,0xB8,0x8B,0x00,0x10,0xF8,0x70,0xA1,0x9A,0x20,0x21,0xE1,0x49,0xB1,0x4A,0xB1,0x2A,0x01,0x80,0xA9,0x12,0xBF,0x62,0x91,0x1A,0x92,0xBC,0x58,0xD0,0x48,
+0x02,0xA0,0x18,0xA8,0x08,0x48,0xC3,0x2A,0xE1,0x9C,0x10,0x82,0x38,0x04,0xD9,0x69,0xC0,0x38,0x80,0x83,0x8D,0x84,0x9D,0x30,0xA1,0x29,0x99,0xB3,0x6C,0xB1,0x18,0x38,
+0x86,0x98,0x39,0xC2,0x0A,0xCC,0x31,0x80,0x52,0xB0,0x20,0xBB,0xBB,0x72,0x91,0xBA,0x61,0xA0,0x20,0x18,0x82,0xAB,0x83,0xEF,0x11,0xA8,0x59,0x05,0xAA,0x10,0x80,0x98,
+0x32,0xC8,0x29,0xE1,0x39,0x91,0x1A,0x44,0xA8,0x8A,0x00,0xCA,0x5A,0x27,0x99,0x08,0xC9,0x3B,0x17,0x0B,0x83,0xAC,0x18,0x13,0x9B,0x08,0x63,0xB9,0x09,0xAB,0x51,0x15,
+0xDB,0x38,0x93,0x28,0xE9,0x29,0x90,0x30,0x90,0xAA,0x54,0xBC,0x53,0x20,0xA8,0x18,0xFB,0x1A,0x34,0xA1,0x58,0xB1,0x09,0xA8,0x30,0xFB,0x01,0x8B,0x04,0x38,0x32,0xA2,
+0x0B,0x43,0xFA,0x0B,0x9C,0x32,0x36,0x00,0x92,0xAB,0x9C,0x17,0xAA,0x32,0x9A,0x92,0x78,0xB1,0x0C,0x82,0xBE,0x12,0x98,0x40,0x03,0x10,0x1A,0x17,0x18,0xB1,0x29,0xB2,
+0x9D,0xB9,0x19,0x51,0xD3,0x1D,0x03,0x8A,0x01,0x98,0x2B,0x07,0xA8,0x8E,0x23,0x99,0x11,0xA9,0x18,0x20,0xC0,0x50,0x25,0xD9,0x9A,0x28,0x04,0x9E,0x21,0xAA,0x88,0x61,
+0x02,0xA1,0x9C,0xAE,0x52,0x24,0x98,0x80,0xC9,0xAD,0x80,0x18,0x33,0x11,0x35,0x02,0xBE,0x88,0xAB,0xA9,0x0A,0x36,0x98,0x45,0x11,0xB8,0x8A,0x90,0xBD,0x52,0x82,0x09,
+0x80,0x88,0xC8,0xAD,0x19,0x80,0x0A,0x17,0x19,0x15,0x10,0x82,0xB9,0x1C,0x27,0x0A,0x01,0x18,0xB9,0x41,0xF8,0x0A,0x82,0x28,0xE8,0x60,0xB9,0x10,0x0A,0xB4,0x4B,0xA1,
+0x68,0x92,0x0A,0xD2,0x49,0xA0,0x53,0xB9,0x31,0x99,0xB0,0x78,0xA1,0x08,0x99,0x28,0x14,0x31,0x91,0xCD,0x30,0xC9,0x18,0x89,0x54,0xD8,0x19,0x22,0x93,0x9A,0x90,0x09,
+0x82,0x28,0x81,0x18,0xFB,0x72,0xF3,0x28,0xBA,0x53,0xB8,0x0A,0x23,0xB8,0x4A,0xD8,0x09,0x31,0xF0,0x49,0xA2,0x8B,0x32,0xB1,0x1D,0x84,0x89,0x28,0xB2,0x49,0x91,0xFA,
+0x3A,0x81,0xBA,0x73,0xB1,0x39,0x15,0xCC,0x28,0xC1,0x2B,0x83,0x99,0x88,0x24,0x01,0x14,0xDF,0x38,0x91,0x9C,0x11,0x83,0x9F,0x04,0x8A,0x82,0x00,0xDA,0x10,0x2A,0x17,
+0x8E,0xA2,0x2B,0x85,0x09,0x80,0x98,0x19,0x84,0x9C,0x81,0x1A,0x23,0x00,0xCA,0x38,0xA1,0x39,0xE9,0xAB,0x38,0x34,0xB8,0x0B,0x51,0xD1,0x2A,0xA3,0x2C,0x05,0x89,0xD8,
+0xAC,0x41,0x92,0x30,0x0A,0x27,0x9B,0x99,0x80,0x8E,0x02,0x99,0x22,0xAA,0x12,0xA0,0x0A,0x08,0x07,0x9A,0x51,0x54,0xB1,0x3A,0xE1,0x38,0x11,0x9A,0x00,0x90,0x0B,0x84,
+0x19,0x39,0xF0,0x7A,0xA2,0x0C,0x81,0x1A,0x04,0xBB,0x50,0x02,0x3A,0xB4,0x2B,0xFA,0x58,0xC0,0x1B,0x12,0x88,0x81,0x1A,0xA0,0x33,0x82,0x8F,0xB4,0x68,0x18,0xE1,0x30,
+0x9D,0x17,0xAB,0x30,0xC1,0x19,0x01,0xA0,0x10,0x9A,0x38,0xA3,0x2C,0xB8,0xBA,0x28,0x88,0xCF,0x22,0x00,0x00,0xBC,0xA0,0x9F,0x04,0x99,0x8C,0x00,0x12,0x9B,0x15,0xBD,
+0x53,0xAB,0x91,0x1C,0x24,0xBB,0x12,0x8C,0x91,0x99,0x61,0xA8,0x80,0x9C,0x33,0xA8,0x0B,0x12,0xAD,0x37,0x88,0xA3,0x8F,0x04,0x99,0x19,0x15,0x99,0x09,0x41,0xD2,0x0B,
+0x08,0xC2,0x4B,0x80,0x93,0x5B,0xB1,0x4A,0xB3,0x9F,0x81,0x30,0x92,0x30,0x13,0x11,0xA0,0xAF,0x18,0x17,0x9A,0x13,0xA8,0x9B,0x10,0x20,0x22,0x20,0x55,0xD0,0x19,0xAA,
+0x26,0xA8,0x4B,0x07,0x09,0x98,0x31,0xC0,0x2A,0xB1,0x75,0xB1,0x89,0x9A,0x30,0x30,0x03,0x99,0x10,0x73,0xA2,0x08,0xDF,0x40,0x80,0x89,0x41,0xA0,0x99,0x8A,0x35,0x81,
+0xBD,0x8A,0x00,0x21,0x81,0x11,0xFA,0x19,0x91,0x99,0xCA,0x62,0xB0,0x30,0x01,0x47,0xB9,0x20,0xCC,0x10,0x43,0xB9,0x63,0x98,0x11,0xCB,0x63,0x98,0x18,0xA9,0xB9,0x5A,
+0x94,0x38,0xB0,0x9A,0x0B,0xB8,0x41,0xB0,0x76,0x90,0x00,0x8A,0xFB,0x28,0x08,0x01,0x10,0x22,0xFC,0x2A,0x32,0x13,0xDA,0x39,0x98,0x92,0x1E,0x84,0x0B,0x13,0x10,0xD9,
+0x09,0x21,0xA0,0x21,0x89,0x25,0x89,0x52,0xE9,0x39,0xA0,0x52,0x08,0x14,0xCA,0x08,0x00,0xBA,0x37,0xA9,0xAA,0x56,0x91,0x9C,0x05,0x3C,0xB4,0x0B,0x79,0xC6,0x0E,0x24,
+0xBA,0x20,0xA1,0xAB,0x55,0x91,0x88,0xCB,0x09,0x33,0x03,0x80,0xAA,0xAB,0x21,0x00,0xD9,0x00,0x19,0x35,0x14,0xA8,0x18,0xC8,0xCD,0x1A,0x81,0x73,0x81,0x00,0x08,0x90,
+0xA0,0xAC,0xDA,0x48,0x00,0x22,0x72,0xA3,0x88,0xAC,0x90,0x18,0x82,0x88,0x38,0xB3,0xAF,0x08,0x82,0x9C,0x32,0x05,0xA8,0x19,0x01,0x73,0xB9,0x1A,0x14,0x0B,0x05,0xAA,
+0x88,0x98,0x8A,0x14,0x99,0x81,0x8D,0x23,0xC0,0xBB,0x8C,0x8A,0x15,0x30,0x15,0xAC,0xA8,0x2A,0xC8,0x69,0xA3,0x3A,0x27,0x01,0xA9,0xAA,0x28,0x01,0x20,0xF8,0x39,0xC9,
+0x01,0x48,0x93,0x1D,0xF0,0x2C,0x91,0x0A,0x82,0x20,0x9F,0x31,0x03,0x0D,0x81,0x12,0xBB,0xFB,0x61,0xDB,0x32,0xC9,0x18,0x08,0x10,0x01,0xCB,0x64,0xC8,0x20,0x81,0x98,
+0x89,0x21,0x9A,0x15,0x9C,0xA1,0x2B,0x15,0x0B,0xB2,0x68,0xDA,0x21,0x80,0x80,0x8C,0x94,0x28,0xC8,0x3A,0x05,0x22,0xBC,0x08,0xC9,0x43,0x9C,0x10,0x04,0x9A,0x59,0xC1,
+0x19,0x81,0x9B,0xCA,0x30,0x03,0x8C,0xB9,0x06,0x2A,0xA0,0xCD,0x18,0x93,0x2F,0xC3,0x88,0x20,0xAE,0x20,0x87,0x8F,0x05,0x9B,0x31,0x82,0x9E,0x11,0x11,0x99,0x80,0x9C,
+0x53,0x90,0x18,0xA0,0x88,0x29,0xD0,0x18,0x10,0xA2,0x39,0x26,0x99,0xA9,0x99,0xB1,0x0F,0x82,0x09,0x09,0x35,0xA8,0x2A,0x24,0xEB,0x10,0x08,0xFA,0x1C,0x13,0x09,0x92,
+0x8B,0x03,0x21,0x8B,0x27,0x43,0xFB,0x18,0x01,0xD8,0x9D,0x11,0x42,0x02,0x10,0xD9,0x9A,0xAA,0x9A,0x20,0x45,0x12,0x22,0x11,0xFA,0x0A,0x90,0x9A,0x28,0x05,0xBB,0x8B,
+0x92,0x8B,0x12,0x74,0x05,0x09,0x12,0xB9,0xB9,0x3C,0xC3,0x1C,0x02,0xCB,0x20,0xC9,0x0A,0x11,0xAC,0x24,0x98,0x63,0xD1,0x0A,0x01,0x81,0x8D,0xA3,0x2F,0xB3,0x0F,0x06,
+0xAB,0x33,0x80,0xBA,0x50,0x14,0x99,0xB9,0xAE,0x21,0x22,0x10,0xD8,0x2A,0xD1,0x19,0x24,0x01,0x10,0xD9,0x09,0xA0,0x0A,0x73,0x83,0x0A,0xE0,0x9C,0x12,0x12,0x00,0xC9,
+0x0B,0x45,0x01,0x00,0xB8,0xBF,0x00,0x88,0x46,0xA0,0x31,0xB1,0x8A,0xB1,0xCD,0x89,0xB8,0x8C,0x88,0x51,0x21,0x24,0x18,0x14,0x31,0x43,0x03,0x08,0xEA,0x8A,0xA0,0xCE,
+0x09,0xC9,0x09,0x08,0x81,0x0A,0x44,0x01,0x92,0x1B,0xB8,0x22,0x8C,0x17,0x1A,0x13,0x89,0x73,0xB0,0x32,0x1C,0xB6,0x3A,0xFB,0x02,0xAD,0x24,0xB8,0x29,0x93,0x28,0x19,
+0x86,0xAE,0x98,0x12,0x89,0x42,0x01,0xA9,0x8B,0x00,0x89,0x51,0x13,0xAC,0xA8,0x0C,0x36,0xB0,0x89,0x80,0xB9,0x73,0x91,0x03,0x9C,0xA8,0x19,0x34,0x21,0x05,0xAA,0xAC,
+0x42,0x80,0x25,0x9C,0x82,0x9A,0x50,0xA0,0x73,0x91,0x88,0xC9,0x1A,0xA1,0x1D,0x15,0x19,0x80,0x88,0x12,0x18,0x05,0x80,0x2A,0x16,0x98,0xEA,0x68,0xA1,0x2A,0x82,0x89,
+0x08,0x13,0x0A,0xFA,0x28,0x10,0x37,0x90,0x9C,0x94,0x0D,0xA1,0x30,0x80,0x31,0x93,0xBF,0x24,0x9B,0x90,0x21,0x8B,0x98,0x47,0xA9,0x08,0x02,0x98,0x89,0x81,0xCF,0x10,
+0x08,0x14,0x88,0x21,0x84,0x9C,0x47,0xC9,0x09,0x81,0x8B,0x92,0x1C,0x82,0x58,0xC0,0x2A,0x02,0x88,0xB8,0x0D,0x17,0x9A,0x11,0xCA,0x8B,0x11,0x81,0x13,0xBD,0x41,0x05,
+0x9A,0x89,0xDA,0x62,0xB8,0x39,0x24,0xA8,0x1A,0x05,0xBC,0x59,0xA1,0x1B,0x06,0x9A,0x31,0x04,0x8A,0x90,0xA0,0x2C,0x13,0x02,0xAD,0x54,0xE8,0x8A,0x12,0x22,0xBA,0x02,
+0xBB,0x73,0x92,0xCE,0x49,0x04,0x1A,0xB2,0x09,0x99,0x14,0x09,0xE8,0x39,0x05,0xAA,0x11,0x20,0x04,0xBB,0x88,0x20,0x05,0xBC,0x32,0xD8,0x58,0xA3,0x8B,0x82,0x0B,0xA1,
+0xAA,0x72,0xE8,0x60,0xB1,0x1C,0x83,0x0A,0x91,0x50,0xC0,0x1A,0x13,0x90,0xBA,0x38,0xFA,0x48,0x14,0xBB,0x30,0x80,0xD8,0x29,0x13,0xB0,0xBB,0x3A,0x96,0x8A,0x20,0xAA,
+0x26,0xAB,0x22,0xAE,0x51,0xB2,0x0C,0x04,0x99,0xAB,0x40,0x23,0x12,0xFA,0x1D,0x84,0x0B,0x81,0xA8,0x4B,0x86,0x0A,0x22,0x90,0xCA,0x9A,0x90,0x48,0xA0,0x20,0xEA,0x63,
+0xA8,0x00,0x98,0x8C,0xB0,0x9C,0x62,0xA0,0x0A,0x54,0xB0,0x19,0x00,0xA8,0xCA,0x50,0xD1,0x0A,0x80,0x0A,0x26,0x9C,0x01,0x11,0x10,0xC8,0x8E,0x44,0xA9,0x20,0xB8,0x0D,
+0x92,0x8B,0x01,0x11,0x9C,0x85,0xAA,0x28,0x15,0xB8,0xEB,0x8A,0x40,0x05,0x88,0xCA,0x42,0xA8,0x9A,0x50,0xB0,0x19,0x30,0xB2,0x1A,0x73,0xB2,0xAB,0x0C,0x05,0x88,0xA9,
+0x01,0x18,0xB2,0xFA,0x1D,0xA2,0x0C,0x01,0x0A,0x24,0xB9,0x1D,0x34,0xE0,0x8A,0x80,0x81,0x9A,0x12,0x9C,0x83,0x1D,0x25,0x88,0x2A,0x84,0x1A,0xBA,0x63,0x13,0x9C,0xA9,
+0x73,0xB9,0x20,0x01,0xE0,0x2C,0x95,0x0C,0x82,0x08,0x12,0xA9,0x98,0x0B,0xF9,0x79,0x82,0x9A,0x00,0x29,0xC1,0x70,0x90,0x10,0xA8,0x88,0xBB,0x73,0xA3,0x0C,0x83,0x1B,
+0xC1,0x8A,0x8A,0x44,0xC1,0x3A,0x37,0xD9,0x09,0x01,0x90,0x8C,0x24,0xAA,0x21,0x91,0x1A,0x01,0x32,0xDA,0xBC,0x20,0x90,0xA8,0x73,0xF0,0x40,0xB8,0x28,0x22,0xD8,0x1A,
+0x81,0x08,0x9A,0x34,0x98,0x91,0x8E,0xE8,0x58,0xA2,0x28,0x91,0x80,0x0B,0xF8,0x2A,0x12,0xCA,0x48,0x14,0x10,0x08,0xEA,0x2A,0x16,0x80,0x8A,0x03,0x9F,0x21,0x81,0x89,
+0x30,0x82,0x49,0xFB,0x5B,0x93,0x9A,0x42,0xC8,0x0A,0x41,0x82,0x9C,0x32,0x08,0xC0,0x19,0x32,0xD0,0x39,0xC3,0x0D,0x84,0x0B,0x93,0x4B,0x87,0x0D,0x24,0xAB,0x20,0x92,
+0x8F,0x24,0xBA,0x28,0x91,0x2A,0x93,0x39,0x98,0xC1,0x1E,0x03,0x18,0x25,0xBB,0x09,0x21,0xC0,0x38,0xFB,0x41,0x91,0x19,0xB8,0x49,0x83,0x8A,0x25,0x00,0xB8,0xCE,0x38,
+0x31,0x86,0x8D,0x81,0x09,0x10,0xCA,0x51,0x12,0x9A,0x31,0xD9,0x38,0x81,0xC8,0x38,0xD9,0x41,0x99,0x33,0xDF,0x01,0x21,0x88,0x01,0x19,0x81,0x82,0x9D,0x89,0x34,0xB1,
+0x4A,0x84,0xCC,0x40,0x90,0x10,0x9A,0x33,0x1C,0x27,0x9D,0x81,0x98,0x1B,0x15,0x88,0x42,0x90,0xCC,0x72,0xA0,0x29,0xA1,0x3A,0xA8,0x15,0xCB,0x51,0xC8,0x38,0x81,0xB9,
+0x59,0x92,0x2A,0x06,0x09,0xB8,0xCA,0x3A,0xA4,0x78,0x04,0x09,0x01,0xFC,0x29,0x91,0x88,0x10,0x20,0xA1,0x2B,0x03,0xAA,0x82,0x28,0xF9,0x3A,0xB0,0x6A,0x25,0xB0,0x9F,
+0x12,0x08,0x08,0x80,0x88,0xCC,0x41,0xAB,0x15,0x38,0xA3,0xB8,0xDF,0x28,0x24,0x99,0x18,0xD0,0x29,0x02,0x81,0xBC,0x60,0xC1,0x3A,0xA1,0x48,0xA0,0x82,0x0A,0x02,0xA0,
+0x9C,0x2A,0x96,0x4A,0xC8,0x20,0x01,0xAE,0x34,0xA0,0x1A,0xA4,0x0B,0xA1,0x40,0xB1,0x8C,0x99,0x61,0xB3,0x0B,0x32,0xC1,0x2B,0x44,0xC0,0x52,0xA9,0xCA,0x38,0xB0,0x8A,
+0x24,0x03,0xFF,0x32,0x98,0x00,0xC8,0x8A,0x20,0x12,0x01,0x09,0xDA,0x30,0x08,0x44,0x88,0x21,0xF1,0x8F,0x85,0x0A,0x0A,0x06,0x0B,0xB0,0x6A,0x97,0x0D,0x84,0x09,0x8A,
+0xA3,0x79,0xB8,0x02,0x2A,0xB0,0x22,0x0E,0xA1,0x39,0x08,0xA3,0x39,0xDA,0x12,0x3B,0xC1,0x01,0x1C,0xD3,0x18,0x28,0xB3,0x72,0xB9,0x92,0x0C,0xA8,0x84,0x3B,0xB4,0x52,
+0x9A,0x91,0x20,0x9E,0x82,0x28,0xBE,0x13,0x29,0xB0,0x22,0x2B,0xF0,0x28,0x9C,0x01,0x53,0x99,0x13,0x2A,0xE9,0x18,0xAB,0x81,0x52,0xB9,0xAA,0x77,0xC8,0x18,0x11,0x98,
+0xAA,0x28,0x13,0xA0,0xBB,0xBD,0x73,0x01,0xA8,0x29,0x20,0x95,0xAF,0x00,0x11,0x10,0x10,0x98,0xA9,0x1C,0xB2,0x79,0xA2,0x0C,0x02,0x1B,0x25,0x81,0xA0,0xAB,0x09,0xA0,
+0x8F,0x33,0x9D,0x02,0x40,0xC1,0x2B,0x26,0xB9,0x88,0x8A,0x22,0xCA,0x39,0xA1,0x41,0xA9,0xD9,0x48,0x81,0x91,0x49,0xFB,0x6A,0x91,0x89,0x41,0xC1,0x0B,0x13,0xDA,0x8B,
+0x15,0x9A,0x20,0x90,0x31,0xB0,0x64,0xDA,0x88,0x10,0x13,0x0A,0x06,0x9A,0x91,0xA9,0x9D,0x35,0xDA,0x28,0xA2,0x08,0x22,0x00,0x91,0x38,0xD9,0x11,0xDF,0x18,0x01,0x89,
+0x01,0x9B,0xBA,0x63,0xAA,0x44,0xDA,0x08,0xDB,0x52,0x80,0x22,0x90,0x99,0x51,0xA3,0xAD,0x42,0xA8,0x28,0x99,0x73,0xB1,0x9E,0x22,0xD9,0x09,0x45,0xB1,0xAE,0x0B,0x65,
+0x22,0x00,0x99,0xEC,0xAC,0x8A,0x20,0x22,0x55,0x44,0x23,0xA0,0xCD,0xBC,0xAB,0x88,0x31,0x45,0x33,0x23,0x81,0xA9,0xBC,0xBD,0xAC,0xAA,0x89,0x21,0x53,0x44,0x32,0x23,
+0x12,0xB9,0xCC,0xBB,0xBB,0xAA,0x88,0x32,0x34,0x22,0x11,0x10,0x00,0xA8,0xDD,0xAC,0xCB,0xAC,0x8A,0x20,0x54,0x44,0x24,0x22,0x01,0x90,0xCA,0xBC,0xBC,0xAB,0x08,0x20,
+0x23,0x11,0x44,0x12,0x00,0x88,0x80,0xAC,0x32,0x01,0x01,0x10,0x80,0x01,0xD9,0xBD,0xDC,0xBE,0x8B,0xB9,0xAB,0x09,0x89,0x65,0x53,0x53,0x22,0x42,0x01,0x88,0xA9,0xBD,
+0xDB,0xAA,0xAA,0x0A,0x00,0x52,0x04,0x00,0x33,0x01,0x90,0x98,0x8A,0x32,0x21,0x37,0x18,0xA2,0xDB,0xBF,0x98,0x9B,0x80,0x20,0x00,0x34,0x80,0x38,0x85,0x1C,0x17,0x19,
+0x43,0x80,0x22,0xC8,0x1A,0xE0,0x8C,0xA8,0x0A,0xA9,0x28,0x82,0x1A,0x26,0x10,0x02,0x08,0x21,0x91,0xBE,0x19,0xB1,0x9E,0x98,0x30,0x90,0x19,0x85,0xCF,0x39,0x36,0xA2,
+0xAC,0x31,0x34,0x34,0xE1,0xAE,0x11,0x90,0x21,0x90,0x28,0x90,0xAA,0xA8,0x1C,0x16,0x89,0xB1,0x19,0x25,0xB8,0x8D,0xA0,0x0B,0x04,0x9A,0x53,0x80,0x38,0x05,0x8A,0x84,
+0xCF,0x10,0x90,0x50,0x83,0xBB,0x31,0x80,0x09,0x20,0x13,0xBA,0xB8,0xFF,0x39,0x80,0x42,0x22,0xA0,0x71,0xB8,0x9A,0x99,0x10,0x93,0x9F,0x05,0x9B,0x13,0x9A,0x41,0x03,
+0x0A,0xC8,0x0B,0x80,0xD9,0x2A,0xA5,0xAF,0x52,0x01,0x9A,0x11,0x98,0x11,0x01,0x88,0xAB,0x14,0x8C,0x37,0xAA,0x89,0x38,0xC3,0x0E,0x25,0x90,0xA9,0x9B,0x25,0xA9,0xA0,
+0x8C,0x90,0x21,0x90,0x19,0x77,0x08,0x81,0x89,0xCA,0x30,0xFB,0x28,0xA1,0x39,0xB1,0x5B,0x95,0x1B,0x07,0x9B,0x02,0x80,0xBA,0xAA,0x40,0x21,0xA3,0x4C,0xF2,0x2A,0x82,
+0xB9,0x48,0xB8,0x39,0xA0,0x09,0x51,0x14,0xA9,0x9A,0x35,0xEC,0x30,0xB8,0x2A,0x94,0x0B,0x84,0x08,0x33,0xF9,0x2A,0xC0,0x39,0x85,0x09,0x03,0x08,0xB9,0x98,0xBE,0x30,
+0x92,0xBD,0x2A,0x27,0xA8,0x32,0x88,0xB8,0x78,0xB0,0x0B,0x12,0x8D,0x25,0xAB,0x81,0xAB,0x32,0xC1,0x4A,0xA5,0x8E,0x04,0x8A,0xA9,0x18,0x00,0xA0,0x30,0xBA,0x04,0x9F,
+0x17,0x8C,0x01,0x80,0xBB,0x89,0x49,0x06,0x8A,0x42,0xA1,0x99,0x8B,0xA1,0x8E,0x93,0x0C,0x03,0x48,0x82,0x42,0xAC,0x24,0x9D,0x99,0x02,0x0E,0x15,0xCA,0x08,0x21,0xB1,
+0x2C,0x87,0x8B,0x32,0xA8,0x20,0x82,0x98,0x10,0x8C,0x53,0x81,0x8D,0x81,0x8A,0x90,0x52,0x88,0x80,0x18,0x22,0xE0,0x09,0xDC,0x21,0xC9,0x61,0x91,0x0A,0x36,0xE8,0x39,
+0x92,0x9B,0x90,0x39,0x07,0x2B,0xE4,0x1B,0xB9,0x51,0x01,0x13,0xB9,0xAC,0x88,0x8A,0x63,0x04,0xAB,0x98,0x98,0x1C,0x07,0x0B,0x03,0x8C,0x91,0x2B,0xA4,0x39,0xDD,0x41,
+0x99,0x41,0xB1,0x2A,0xC1,0x1A,0x90,0x31,0x21,0xC3,0x8E,0x81,0x18,0xAA,0x01,0x18,0x23,0xD0,0x8C,0x98,0x42,0xE0,0x48,0x82,0x28,0x91,0xAC,0x01,0x3A,0x87,0x9F,0x21,
+0x82,0x0A,0x84,0x0D,0x84,0x0E,0x05,0x8A,0x00,0x19,0xA2,0x2A,0x13,0xA0,0x0C,0x34,0xB1,0x8C,0x91,0x31,0x9C,0x27,0x19,0x92,0x88,0xEB,0x0A,0x23,0x9A,0x64,0x90,0x20,
+0xA1,0x8C,0x25,0xCC,0x22,0x8B,0x84,0xAC,0x48,0x84,0x18,0xA8,0x51,0x90,0x9A,0x10,0xA8,0xCA,0x40,0xD8,0x29,0x25,0x80,0x28,0x90,0xA8,0x1E,0xC1,0x18,0x08,0x94,0x0B,
+0x42,0xC8,0x3A,0x84,0x9A,0x51,0x03,0xCA,0xCB,0x38,0xB0,0x91,0x5E,0xA4,0x2C,0x83,0xAD,0x33,0x9A,0x23,0x9A,0x81,0xAA,0x32,0x20,0x87,0x3C,0xB5,0x8E,0x81,0x88,0x41,
+0xA2,0x38,0x80,0x90,0x8B,0x12,0x81,0xB9,0xAF,0xC9,0x38,0xB2,0x5B,0x33,0x27,0x98,0x18,0x92,0xAD,0x00,0x09,0x26,0xA9,0x28,0xD1,0x49,0xA2,0x1A,0xB0,0x0C,0xA0,0x79,
+0x85,0x1B,0x83,0x8A,0x98,0x41,0xFA,0x28,0x80,0xA8,0x60,0xC0,0x09,0x89,0x81,0x30,0x01,0x91,0x50,0xF8,0x29,0xB1,0x4C,0x93,0xAD,0x20,0x91,0xA9,0x0A,0x88,0x56,0xA0,
+0x29,0xB3,0x1D,0xA4,0x8F,0x21,0x88,0x02,0xAB,0x89,0x17,0x0B,0xA3,0x0E,0x91,0x29,0xA0,0x72,0xA8,0x88,0x10,0x93,0x8C,0x84,0x8E,0x13,0x9A,0xAA,0x75,0xA0,0x00,0x89,
+0x11,0xA9,0x00,0x2A,0x47,0x0A,0xB1,0x1C,0xA2,0x8D,0x34,0x89,0x23,0x8D,0x01,0x1A,0xB3,0x1D,0x05,0xA9,0x31,0xA1,0x88,0x9C,0x01,0x69,0x05,0x88,0x88,0x33,0xD8,0x8B,
+0x91,0x19,0x24,0x80,0xE9,0x0E,0x34,0x24,0xEB,0x9B,0x08,0x63,0x02,0x11,0xDC,0x9B,0x80,0x62,0x13,0x08,0x98,0xAA,0x9B,0xBC,0x9A,0x58,0x45,0x01,0x80,0x08,0x80,0xA9,
+0x8B,0xA1,0xAD,0x19,0x26,0x88,0x01,0xAD,0x32,0xD8,0x39,0x94,0x0B,0x33,0xB8,0x48,0xF0,0x1D,0x03,0x8C,0x14,0xAC,0x42,0x98,0x89,0x90,0xAA,0x64,0xB1,0x0A,0x91,0x9E,
+0x01,0x1A,0x06,0x09,0x23,0xA9,0xA9,0x8A,0xA0,0xAA,0x41,0xB0,0x0A,0x98,0x78,0x87,0x89,0x80,0x20,0xCA,0x08,0xA0,0x9C,0x42,0x02,0x0A,0xD0,0x59,0xC2,0x1B,0x81,0x89,
+0x0A,0x02,0x60,0xA2,0xAF,0x30,0xA8,0x72,0xD8,0x38,0x91,0x18,0xC9,0x8B,0x03,0x08,0x01,0x08,0x82,0xCA,0x8D,0x04,0x1B,0x81,0x10,0x91,0x2A,0xF1,0xA9,0x3A,0xC3,0x8C,
+0x44,0xCA,0x53,0xA8,0x20,0xDA,0x21,0xDA,0x30,0xD8,0x30,0x98,0x82,0x8B,0x40,0xF1,0x3C,0x84,0x1A,0xA2,0x68,0xB0,0x9B,0x08,0x2A,0x05,0x9B,0x18,0x13,0x52,0xC8,0xCA,
+0x1C,0x05,0x89,0x08,0xA9,0x12,0x8E,0x12,0x08,0x53,0x01,0xF8,0x3C,0xA1,0x80,0x39,0x16,0xBD,0x43,0xCB,0x22,0xBB,0x73,0xD9,0x28,0x21,0x91,0x99,0x8B,0x31,0x01,0x00,
+0xB9,0xEC,0x19,0x80,0x22,0x31,0xB4,0x0E,0x93,0x1C,0x02,0xBC,0x54,0xA1,0xAB,0x00,0x54,0x00,0xA8,0xBB,0x0D,0x25,0x90,0x8D,0x24,0xA9,0x01,0x9D,0x27,0xAC,0x30,0x01,
+0x08,0xDA,0x39,0x05,0x9A,0x90,0xAB,0x45,0x82,0xBB,0x19,0x33,0xD8,0x9B,0x45,0x81,0xA8,0x8B,0x32,0x81,0xA8,0xAB,0x08,0x27,0xDB,0x49,0x93,0x40,0xA0,0x18,0xB9,0x8D,
+0x03,0x8B,0x22,0x09,0x11,0x57,0xA9,0x90,0x19,0xA8,0xCC,0x38,0x84,0x09,0x15,0x30,0x04,0xCA,0x9C,0x90,0x2A,0xB0,0x58,0x33,0x45,0xA8,0x49,0xB0,0x1A,0x22,0xA0,0x29,
+0x40,0xF0,0x2C,0x03,0x08,0x90,0xAA,0xBE,0x08,0x23,0x30,0xC1,0x70,0x91,0xAA,0x39,0xA5,0x9F,0x01,0x98,0x0B,0x26,0x10,0x81,0x21,0xFA,0x0B,0x33,0x05,0x0A,0xB2,0x0E,
+0x00,0x11,0x9A,0x30,0x82,0x42,0xB8,0x9D,0x23,0x1A,0xA4,0x1B,0x83,0xDC,0x9A,0x11,0xEC,0x80,0x08,0x83,0x18,0x31,0x17,0x0C,0x34,0xC9,0x9C,0x89,0x20,0xC0,0xAB,0x00,
+0x73,0x93,0x19,0x03,0x19,0x44,0x01,0x08,0xEA,0x72,0xA2,0x99,0x99,0x80,0x02,0xCC,0x50,0x98,0x11,0xFB,0x10,0x98,0x0A,0x25,0xA8,0x18,0x82,0x98,0x18,0xB9,0x09,0x77,
+0x02,0x81,0x9C,0x14,0x0A,0x35,0xAA,0x23,0xBC,0x89,0x02,0x2B,0xF8,0x48,0xA0,0x89,0x31,0xAC,0x03,0x9F,0x21,0xB1,0x4A,0x03,0x32,0x09,0x44,0xD0,0x09,0xA9,0x40,0xB9,
+0x18,0x1B,0xA5,0x2D,0x93,0x1C,0x16,0xAC,0x33,0xDA,0x51,0xA8,0x30,0x13,0xA0,0x41,0x80,0x83,0x0B,0xB5,0x0F,0x14,0x8A,0x20,0x12,0xDA,0x89,0x42,0xFA,0x38,0x98,0x10,
+0x99,0x01,0x19,0x11,0xB0,0x70,0xC5,0x8D,0x01,0x91,0x8A,0x02,0x01,0x1B,0x87,0x9B,0x8A,0x17,0x8A,0xA9,0x35,0xBA,0x9A,0x15,0xAC,0x80,0x30,0xD1,0x38,0x81,0xB9,0x8D,
+0x83,0x0C,0x05,0x18,0x83,0x1B,0xD2,0x8F,0x04,0x8B,0x03,0x89,0xB0,0x7A,0xD1,0x78,0xB0,0x09,0x21,0x99,0x21,0xAC,0x90,0x31,0xE0,0x19,0x00,0x43,0x98,0xBA,0x29,0x02,
+0x8A,0x17,0xCB,0x30,0xC0,0x88,0xAA,0x33,0xB8,0xAE,0x20,0x91,0x21,0x98,0x74,0xB8,0x49,0xCB,0x21,0x08,0x01,0xA0,0x89,0xA9,0x62,0x83,0x8E,0x13,0x99,0xB0,0x8E,0x12,
+0xFA,0x19,0x12,0x90,0x9C,0x38,0xD4,0x4B,0x93,0x20,0xAE,0x31,0xA2,0x8F,0x06,0x99,0x91,0x2A,0x07,0xA9,0xBA,0x62,0xA2,0x8A,0x01,0x98,0x18,0x80,0x93,0xAF,0x13,0xAA,
+0x43,0xB9,0x88,0x19,0x81,0x91,0x09,0x90,0x31,0x9E,0x05,0xAF,0x23,0xB0,0x8A,0x98,0x51,0x92,0x8B,0x53,0x98,0x09,0x62,0xB0,0x9B,0xAC,0x90,0x48,0x33,0x46,0x90,0x08,
+0x88,0xB9,0x9A,0xA1,0x72,0x85,0x00,0xAB,0xA9,0x22,0x8E,0xB2,0x48,0x19,0x97,0x9A,0x29,0x93,0xAD,0x18,0xF9,0x49,0xA0,0x88,0x9A,0x80,0x81,0x8B,0x23,0xBC,0x9B,0x43,
+0xB1,0xBF,0x00,0xAB,0x82,0xBF,0xBA,0x74,0x93,0x28,0xA0,0xAA,0xAA,0x13,0x71,0xE1,0x19,0x01,0x51,0x14,0xFA,0x19,0x98,0x01,0x18,0xA8,0x40,0x16,0x19,0xA1,0x8B,0x8B,
+0xB4,0x7B,0x94,0x0A,0x82,0x18,0xC8,0x20,0x09,0x45,0xB8,0x9A,0x0B,0x26,0x99,0x29,0x02,0xB8,0xBF,0x52,0xA2,0x0B,0xB1,0x2B,0x06,0x9C,0x03,0x09,0x02,0xBC,0x34,0xAD,
+0x03,0xAC,0x00,0x28,0xA3,0x78,0xB1,0x38,0x03,0x9C,0xA2,0x0C,0xA0,0x58,0x83,0x9D,0x21,0x90,0x30,0xF0,0x3A,0x93,0x88,0x0D,0x97,0x8C,0x03,0x89,0x31,0xFB,0x41,0xB9,
+0x01,0x38,0xC0,0x20,0x9B,0x84,0x78,0xB2,0xAB,0x20,0x23,0x00,0x18,0x17,0x0A,0xC2,0x2C,0x91,0x38,0x61,0xE0,0x19,0xB8,0x61,0x91,0x18,0x80,0x99,0x08,0x20,0x22,0x93,
+0x8C,0x03,0x52,0xA3,0x79,0xC2,0x8B,0x50,0x92,0x29,0x01,0x93,0x9D,0x40,0x25,0xB8,0x8E,0x81,0x20,0x41,0x92,0x32,0x1B,0x47,0x9E,0x13,0x9B,0x90,0x59,0x82,0xAA,0x10,
+0x31,0x25,0xA8,0x0B,0x14,0x8A,0x27,0xBB,0x00,0xBC,0x31,0x01,0x00,0x98,0x66,0xA0,0x30,0x91,0x88,0xFA,0x89,0xAA,0x43,0x89,0x15,0xB9,0x70,0xA2,0x20,0xDB,0x20,0x88,
+0xA0,0x41,0xB9,0x38,0x95,0x9D,0x90,0x21,0x80,0xA0,0x20,0x9C,0x34,0x12,0x63,0xFB,0x9B,0x99,0x82,0x31,0x05,0xAA,0x50,0x93,0x2A,0xE0,0x8A,0x88,0x10,0xA3,0xEA,0x8F,
+0x05,0xAB,0x11,0xA8,0x42,0x10,0xA1,0x49,0x93,0x98,0x0A,0x01,0x85,0xBE,0x28,0xA0,0x47,0xB9,0x10,0xB0,0x1B,0x15,0x88,0x8B,0x12,0xCC,0x74,0x81,0x98,0x88,0x21,0x22,
+0xA0,0xC8,0x9D,0x33,0x24,0xA1,0xBE,0x42,0x89,0x82,0x1A,0x25,0xDB,0x53,0x9A,0x11,0x00,0x01,0x80,0xE8,0x8C,0x23,0x11,0x01,0x09,0x00,0xCD,0x71,0xA2,0xAC,0x08,0x41,
+0x01,0x81,0x2B,0x82,0x32,0x9E,0x04,0xAA,0x41,0xE0,0x9B,0x22,0xA8,0x72,0x94,0x9A,0x9A,0xB0,0x0E,0x43,0x90,0x00,0x89,0x9A,0x07,0x0A,0xBA,0x22,0x1C,0x05,0x8A,0x01,
+0xAD,0x00,0x11,0xB8,0x8C,0x40,0xC1,0x58,0x82,0xEB,0x1B,0x91,0x18,0xBA,0x28,0x81,0x4A,0x87,0xBC,0x9A,0x29,0x05,0x89,0xAB,0x33,0x08,0xB3,0x0D,0xF0,0x0F,0x81,0x0A,
+0x82,0xAD,0x43,0x32,0x82,0x89,0xFB,0x0C,0x02,0x9B,0xB0,0x8B,0x22,0x51,0x16,0x8A,0xA1,0x9D,0xB8,0x2A,0x35,0xB8,0x5A,0xB1,0x8B,0xC8,0x09,0x65,0x91,0x09,0x00,0x18,
+0x02,0xF9,0x9D,0xA8,0x29,0x37,0x00,0x89,0x08,0xA9,0x38,0xA0,0xA9,0xAC,0x48,0x26,0x88,0x21,0xA0,0xAA,0x01,0xCF,0x89,0x42,0x01,0x80,0x10,0x24,0xDC,0x11,0xB9,0x20,
+0x88,0xC2,0x8F,0x13,0x21,0x23,0xCB,0x80,0x20,0xC1,0x0B,0x94,0x6B,0x84,0xAA,0x89,0xA2,0x0D,0x26,0xBA,0x28,0x88,0x11,0xB8,0x98,0x8B,0x45,0x23,0xA9,0xB8,0xCF,0x32,
+0x41,0xFA,0x8A,0x80,0x18,0x25,0x08,0x62,0xC0,0xAD,0x09,0x11,0x31,0x82,0x1A,0x82,0x51,0xD0,0xDE,0x29,0x23,0x03,0xFB,0x0A,0x32,0x01,0xCB,0x19,0x44,0x02,0xB9,0x9D,
+0x08,0x99,0x89,0x35,0x80,0x08,0xD1,0x9B,0x88,0x25,0x02,0xB9,0x08,0x44,0xB0,0xBD,0x9A,0x30,0x36,0x90,0x99,0x8A,0x89,0x28,0x22,0x01,0x65,0x98,0xD8,0x8D,0x33,0x88,
+0x88,0xAC,0x20,0xF8,0xAB,0x20,0x63,0xB2,0x0A,0x13,0x33,0x90,0x30,0x83,0xFC,0x8A,0x01,0x22,0xD9,0xCA,0xBD,0x1A,0x47,0x02,0xBA,0x09,0x01,0x00,0x80,0x80,0x33,0xFB,
+0xAB,0x70,0x03,0xA9,0xAD,0x28,0x14,0x91,0x1B,0x02,0x43,0x32,0x03,0xE8,0xBF,0x9A,0x31,0x00,0x21,0x12,0x22,0xCC,0x10,0x88,0x90,0x19,0x11,0x64,0x26,0x91,0xA9,0xDD,
+0x8B,0x44,0x34,0x81,0xDA,0x8A,0x10,0x82,0x1A,0x91,0x32,0xFB,0x8C,0x02,0x68,0x16,0xCA,0x8A,0x90,0x09,0xA8,0x77,0x92,0xAA,0x89,0x32,0x82,0x9A,0xBA,0xFF,0x0C,0x65,
+0x23,0xC9,0xAE,0x8A,0x52,0x33,0x82,0xDA,0xBC,0x89,0x20,0x32,0x43,0x33,0x03,0xDC,0xCB,0x9B,0x21,0x33,0x82,0xA8,0xBC,0xAB,0x08,0x10,0x42,0x46,0x25,0x03,0xB9,0xBE,
+0xAB,0x21,0x54,0x13,0xA9,0xBC,0x89,0x99,0xA9,0x08,0x55,0x33,0xA0,0xCC,0xAB,0x19,0x43,0x34,0x33,0x91,0xCA,0x8A,0x18,0xA9,0xAD,0x60,0x35,0x92,0xDD,0xAB,0x89,0x32,
+0x35,0x14,0xA0,0xBC,0xAC,0x09,0x20,0x44,0x33,0x12,0xB9,0xBE,0xBB,0x8A,0x20,0x53,0x34,0x24,0x90,0xDB,0xCB,0x8A,0x20,0x34,0x03,0xB8,0xAB,0x30,0x14,0xFA,0xAC,0x08,
+0x43,0x13,0x81,0x00,0x10,0x81,0xDA,0xCB,0xAA,0x89,0x21,0x11,0x11,0x63,0x33,0xC8,0xBE,0x9A,0x11,0x43,0x43,0x91,0xCD,0x8B,0x32,0x13,0xCB,0x19,0x45,0x13,0xC9,0xBC,
+0x89,0x11,0x22,0x82,0xC9,0x9A,0x62,0x12,0xDB,0x9B,0x28,0x53,0x13,0x81,0xA9,0x8B,0x42,0x14,0xF9,0xBB,0x38,0x46,0x12,0x98,0x89,0x00,0xA8,0xBC,0x9B,0x10,0x23,0x43,
+0xA2,0xDF,0xAA,0x08,0x11,0x11,0xA9,0x1A,0x36,0x02,0xFA,0xAC,0x29,0x56,0x23,0xC9,0xBC,0x18,0x53,0x13,0xC8,0xAC,0x0A,0x10,0x02,0x00,0x89,0x98,0x88,0x99,0xAA,0x28,
+0x36,0x01,0x80,0x51,0x35,0x14,0xA8,0xA8,0x99,0x30,0x35,0x13,0xFA,0xBB,0x09,0x34,0xC8,0xBD,0x08,0x22,0x23,0xB9,0xCC,0x8A,0x51,0x24,0xA8,0xAB,0x20,0x35,0xB1,0xBE,
+0x0B,0x56,0x22,0xA8,0xBD,0x1A,0x52,0x23,0xB8,0xBE,0x9B,0x21,0x23,0x04,0x88,0x98,0x99,0x00,0xB8,0x28,0xB0,0xAC,0x89,0x42,0x43,0x21,0x42,0xB0,0xBD,0xCB,0x39,0x27,
+0x81,0xB9,0x9C,0x22,0x81,0xAA,0xBE,0x9B,0x73,0x26,0x90,0xCA,0x99,0x31,0x25,0x80,0xCA,0x0A,0x21,0x06,0x2A,0xF1,0x3A,0xB0,0x18,0x11,0xFC,0x38,0xA1,0x28,0x90,0x89,
+0x81,0x48,0x05,0xA9,0x32,0xA0,0x61,0xA1,0xB9,0xAC,0x73,0xA1,0x89,0xA8,0x39,0x25,0x88,0xCA,0x9B,0x01,0x33,0x04,0xCC,0x09,0x00,0x33,0x98,0x48,0x82,0x50,0x04,0xAC,
+0x89,0x09,0x92,0x5A,0xB3,0x9D,0x41,0xA9,0x11,0x28,0x23,0x32,0x45,0xFA,0x8C,0x99,0x18,0x63,0xA2,0xCA,0x9B,0x18,0x26,0x80,0x00,0x08,0x51,0x82,0x9A,0xD9,0x9D,0x32,
+0x90,0xCB,0x9A,0x38,0x14,0x10,0xFB,0x39,0x92,0x28,0x16,0xDA,0xBA,0x20,0x34,0x02,0xAB,0x88,0x39,0x85,0xAB,0xAA,0x88,0xAF,0x55,0xA8,0xA8,0x1A,0x03,0x81,0x9D,0x31,
+0x08,0x14,0xDB,0x9A,0x98,0x99,0x38,0x82,0x32,0xFC,0x38,0xA3,0x9F,0x20,0x00,0x02,0x98,0x89,0x03,0x0C,0x34,0x54,0x91,0xCE,0xBA,0x3A,0x25,0x80,0x98,0x10,0xA8,0xA9,
+0xAA,0x38,0x56,0x23,0x02,0xDF,0x18,0x31,0x83,0xB9,0xAB,0x30,0x63,0x15,0x99,0x99,0x88,0x30,0x33,0x02,0xFC,0x9C,0x21,0x33,0x00,0x99,0xA9,0xAC,0x89,0x32,0x72,0x37,
+0x90,0x9A,0xCB,0x1A,0x54,0x23,0xA9,0xCB,0x28,0x23,0x13,0xB8,0x8B,0x38,0x47,0x01,0xCA,0xAB,0x08,0x10,0x14,0x80,0x19,0x44,0x00,0xB8,0x9E,0x00,0x73,0x92,0xBA,0xAB,
+0x00,0x64,0x13,0xA8,0x9E,0x21,0x52,0x13,0xC9,0x99,0x28,0x01,0xA1,0xAA,0x09,0x88,0x34,0xFC,0x9E,0x41,0x23,0xB8,0xAA,0xBA,0x39,0x47,0x81,0xB9,0x9C,0x09,0x13,0x08,
+0xD9,0x3A,0x04,0x42,0xC0,0xAB,0x9A,0x00,0x42,0x92,0xB9,0x8C,0x53,0x82,0x99,0xAC,0x32,0xBA,0x21,0xF9,0x0C,0x90,0x72,0x03,0xDB,0x8A,0x89,0x22,0xAA,0x9A,0x31,0x35,
+0x03,0xFB,0x8F,0x88,0x18,0x12,0x12,0xB0,0xBB,0x40,0x81,0xD8,0xBC,0x08,0x52,0xA1,0x9A,0xDB,0x30,0x81,0x40,0xC0,0xBB,0x0C,0x82,0x28,0xFB,0x40,0x21,0xB2,0xBF,0x08,
+0x40,0x91,0x09,0xBA,0x0C,0x24,0x99,0x10,0xF8,0x1A,0x21,0x15,0x21,0xDA,0xA9,0x1B,0x34,0x33,0xB0,0x9C,0x90,0xA8,0x4B,0x16,0x90,0x2A,0x67,0x80,0x99,0x39,0x91,0x9B,
+0x9B,0x43,0x08,0x53,0x01,0xBA,0x48,0x25,0x00,0x01,0xDD,0x8A,0x53,0x12,0x18,0xA1,0x0C,0x13,0x12,0xA8,0x09,0x30,0x57,0x12,0x00,0x90,0xA9,0x2A,0x87,0x09,0x49,0x85,
+0x09,0xBD,0x00,0x54,0x11,0xA2,0x9B,0x10,0x01,0x90,0x74,0x15,0x91,0x9C,0x42,0x90,0x10,0xA8,0xAF,0x33,0x89,0xA0,0x89,0x38,0xC3,0x8C,0x33,0x08,0xA4,0x1A,0x90,0xBE,
+0x10,0x46,0x10,0xB2,0x72,0x00,0xA1,0x8A,0x39,0xB3,0x39,0x18,0x07,0xBD,0xB9,0x0C,0x34,0x82,0x99,0xCC,0x88,0x22,0xBB,0x35,0xA8,0x98,0x8E,0x04,0xA9,0x09,0x88,0xFA,
+0x0D,0x01,0x82,0xA9,0x8A,0xC1,0x2A,0x12,0x73,0xB3,0x0C,0xE9,0x19,0x54,0xB0,0x0A,0xB9,0x8B,0x26,0xA9,0x88,0x88,0xA9,0xC9,0x9F,0x02,0x08,0x22,0x00,0xD8,0x9D,0x08,
+0x31,0xF9,0x9A,0xA9,0x42,0x23,0xB0,0x0A,0xDB,0x99,0x0A,0x35,0xE8,0x9B,0x00,0xB8,0xBF,0x19,0x14,0xCA,0x89,0x00,0x98,0x42,0x12,0x81,0x89,0x9A,0x91,0x9E,0xB9,0x62,
+0x00,0xA8,0x0B,0x00,0xD0,0x8C,0x33,0x83,0xBD,0x19,0x33,0x55,0x13,0xC9,0x0A,0x91,0x69,0x77,0x90,0xAB,0x18,0x53,0x81,0xBE,0x48,0x13,0xA8,0x89,0x20,0x81,0x9B,0x32,
+0xB8,0xAD,0x42,0x03,0xCA,0x0A,0x34,0xA0,0x00,0x73,0xA1,0xAD,0x61,0x12,0xB8,0x09,0x23,0x81,0xBD,0x41,0x81,0x88,0x89,0x01,0xB8,0xAF,0x0A,0x42,0x21,0x92,0x40,0xA4,
+0xBD,0x0A,0x51,0x12,0x11,0xB8,0x1A,0xA0,0x09,0x90,0x5A,0xA5,0x9F,0x09,0x53,0x91,0xAA,0x11,0x10,0xB1,0x3A,0x15,0x13,0x8C,0x22,0x43,0x17,0xDB,0x9A,0x88,0x99,0x89,
+0x24,0xBA,0xA9,0x21,0xB9,0x71,0x07,0x99,0x18,0x30,0x26,0x98,0x19,0x83,0x21,0xCB,0x98,0xCF,0x48,0x14,0xA9,0x1A,0x81,0x80,0xA0,0xAE,0x52,0x24,0x91,0x89,0x43,0xA0,
+0x18,0x10,0x53,0x84,0xAA,0x80,0x51,0x91,0x32,0x18,0xB6,0x8D,0x10,0x90,0x80,0x9F,0x33,0x99,0x12,0xBC,0x71,0x93,0x1A,0x24,0xA8,0x41,0x91,0xAB,0x43,0xC9,0x9A,0x81,
+0x8C,0x02,0x2A,0x67,0x90,0x9C,0x08,0x63,0x80,0x80,0x89,0x89,0x08,0xA2,0x3E,0x85,0x88,0x99,0x20,0xC2,0x8D,0x32,0x80,0xF9,0x0D,0x08,0x24,0xB9,0x9C,0x00,0x21,0x01,
+0xA9,0x00,0xCB,0xD9,0x59,0x04,0x9A,0x30,0xD8,0x8C,0x22,0x91,0x89,0x31,0xDB,0xBC,0x3A,0x82,0xBB,0x08,0x88,0xDA,0x71,0x92,0x81,0xEC,0x9C,0x30,0x14,0xA8,0xAD,0x09,
+0x21,0xC0,0x3A,0x83,0x9A,0xCD,0x09,0x25,0x08,0xB1,0xAF,0x30,0x93,0xB9,0x68,0xA3,0x9C,0x99,0x00,0x52,0x91,0xCC,0x9B,0x61,0x34,0xA0,0xAC,0x0A,0x41,0x81,0x28,0x52,
+0xA2,0xBD,0x9A,0x22,0x10,0x32,0x81,0xBA,0x68,0xC2,0x8B,0x82,0x70,0x83,0xBE,0x53,0x01,0x99,0x89,0x98,0x08,0x01,0x43,0x01,0x32,0xF9,0x8F,0x21,0x80,0x80,0x09,0x32,
+0xB9,0x50,0x13,0x02,0xBC,0x48,0x53,0xA2,0xAC,0x19,0x10,0x04,0x8B,0x31,0xB1,0x29,0x73,0xEB,0x08,0x08,0x02,0x30,0x94,0x3A,0xA0,0x8A,0x57,0x99,0xB8,0x30,0x31,0xFC,
+0x0C,0x31,0x82,0x08,0x90,0x8F,0x03,0x9B,0xB8,0x8C,0x34,0x24,0x99,0xC9,0x40,0x10,0xF8,0x0B,0x41,0xA2,0xAB,0x49,0x25,0xA8,0x8A,0xBA,0x53,0xA0,0xBB,0xAB,0x70,0x15,
+0x99,0x19,0x84,0x9A,0xB9,0x30,0xA8,0x81,0x18,0xB9,0x36,0x00,0xC0,0x39,0xC5,0xCF,0x31,0x11,0x81,0x9C,0x90,0x9D,0x33,0x00,0x21,0xF8,0x1E,0x24,0xAA,0x18,0x10,0x90,
+0x68,0x94,0x8D,0xA1,0x30,0xA0,0x10,0x03,0x11,0xAB,0x41,0x37,0x9F,0x01,0x20,0x90,0x10,0xC9,0x0A,0x62,0xA2,0x09,0x11,0xA8,0x50,0xA2,0x1A,0x91,0x40,0x93,0x39,0xF0,
+0x4C,0x93,0x39,0xD1,0x9B,0x41,0x11,0x03,0x89,0xCC,0x20,0x63,0x02,0xCB,0x99,0x00,0x1B,0x85,0x3A,0xD1,0x9C,0x00,0x28,0x34,0xF9,0x29,0x82,0x90,0x9C,0xC8,0x39,0x27,
+0xA8,0x9B,0x48,0xB3,0x3B,0xE2,0x0C,0x80,0x00,0x53,0xFB,0x10,0x9A,0x52,0xB8,0x00,0xBA,0x8A,0x35,0xBA,0xAA,0x01,0x8D,0x14,0x89,0x81,0xA9,0x4A,0x04,0xAD,0xB9,0x4B,
+0x02,0x23,0xAB,0x10,0x80,0xA3,0x9F,0x83,0xAD,0x00,0x00,0xF9,0xAD,0xA0,0x1A,0x81,0xAB,0xF9,0xAD,0x43,0xA8,0x18,0x02,0x8A,0x04,0x55,0xA9,0x90,0x09,0x52,0xB0,0x19,
+0x30,0xB0,0x30,0x04,0xCF,0x18,0xA0,0x10,0xBC,0x88,0x10,0x49,0xA0,0xBB,0x41,0x9B,0x16,0x0A,0xF8,0x0D,0x24,0x02,0xCA,0x19,0x98,0x18,0xB1,0x9B,0x32,0xA9,0x55,0x23,
+0xFB,0x0E,0x00,0x12,0x90,0x9A,0x20,0x43,0x91,0x0A,0x80,0x23,0x19,0x03,0x42,0x00,0xCC,0x31,0x11,0x45,0xB9,0x9C,0x26,0x9A,0x14,0xAA,0x64,0xCA,0x12,0x99,0x18,0xC1,
+0x4A,0x25,0x88,0x82,0xBC,0x19,0x05,0x89,0xA1,0xBB,0x9A,0x01,0xC8,0xCF,0x80,0x88,0x90,0x30,0x14,0x21,0x12,0xC8,0x0A,0x11,0x34,0x22,0xBA,0x08,0xAF,0x46,0xA0,0x50,
+0x93,0xAD,0x0B,0x44,0x24,0xE8,0x8C,0x41,0x01,0x90,0x19,0x16,0x9A,0x14,0x8A,0x41,0xA1,0x8C,0x20,0xB3,0x9B,0x18,0x22,0x80,0x7A,0x87,0x9B,0x00,0xBA,0x39,0x14,0x10,
+0xA8,0x00,0x18,0x13,0x38,0xFC,0x0C,0x24,0x01,0xA9,0x49,0x07,0x8A,0x92,0x18,0xC8,0x29,0x12,0x11,0x9F,0x04,0x89,0x01,0xA8,0xDB,0x29,0x12,0xE2,0x0F,0x23,0x80,0x8C,
+0x00,0x20,0x90,0x50,0x82,0x0A,0x21,0x02,0x9C,0x41,0x01,0x11,0xBC,0x73,0x01,0xA0,0x0C,0x23,0x90,0x00,0xFC,0x50,0x82,0x9A,0x20,0x33,0xD8,0xAD,0x49,0x92,0x18,0x08,
+0x14,0x2B,0xE0,0x3A,0x94,0x89,0xB8,0x8A,0x28,0x28,0x97,0x1B,0xC1,0x8B,0x12,0x5A,0xF2,0x3C,0x33,0x85,0x9C,0xA8,0x2A,0x05,0x8A,0x80,0x32,0xA2,0x79,0xC6,0x1B,0x17,
+0xD9,0x0A,0x36,0xB0,0x9F,0x40,0x12,0xB9,0x9C,0x20,0x43,0x90,0xBA,0x8A,0x11,0x11,0x23,0x01,0xCA,0xAA,0x20,0x02,0x9C,0x21,0x48,0x93,0x88,0xAF,0x11,0x09,0x46,0xB9,
+0x89,0x10,0x81,0x28,0xB9,0x20,0x99,0x8A,0x17,0x8C,0xA3,0x8C,0x08,0x01,0x9A,0x49,0x12,0x36,0x09,0xF1,0x3B,0x92,0x88,0x9B,0xB9,0x28,0x33,0xFD,0x40,0xD8,0x18,0x90,
+0x28,0x81,0x43,0xAA,0x85,0x9D,0x89,0x25,0xC9,0x3A,0x94,0x21,0xAF,0x13,0xA9,0xAD,0x52,0x84,0x9D,0x04,0x0B,0x92,0x1A,0x04,0x1A,0x01,0xD8,0x0C,0x10,0x03,0x8A,0xC9,
+0x18,0x83,0xAF,0x11,0x83,0x2C,0xA1,0x47,0x9D,0x81,0x00,0x9B,0x03,0x0B,0x00,0x17,0x0B,0xB1,0x30,0xC8,0xDA,0x2A,0x57,0xAA,0x10,0x99,0x09,0x11,0xE9,0x49,0x05,0xAC,
+0x03,0x1E,0x92,0x07,0x9F,0x32,0xC0,0x69,0xC1,0x09,0x80,0x20,0x13,0x88,0xE8,0x9B,0x90,0x10,0x58,0x04,0x38,0xB1,0x9B,0xEA,0x1B,0x02,0x72,0x13,0xA8,0x99,0x8B,0xCA,
+0x09,0x32,0x12,0x55,0x33,0x13,0xFA,0xBC,0xBC,0x89,0x90,0x9A,0x21,0x01,0x22,0x45,0x43,0x33,0x32,0x23,0x22,0xA1,0x28,0xB9,0x51,0xA0,0x89,0xFC,0x2B,0x84,0xDA,0xCB,
+0xCD,0x9A,0x99,0x9A,0xA9,0x09,0x88,0x8A,0xCA,0x8B,0x22,0x73,0x36,0x23,0x53,0x32,0x32,0x12,0x28,0x46,0x45,0x13,0x01,0xA8,0xBB,0xBC,0x9B,0xBA,0x9A,0x9A,0x88,0xCA,
+0xDE,0xAC,0x9A,0x88,0x00,0x00,0x00,0xB8,0xAA,0xAD,0x11,0x98,0x31,0x25,0x99,0xC8,0xAB,0xB9,0x2A,0xB1,0x67,0xB9,0x20,0x00,0x82,0xA9,0x9B,0x24,0x72,0x27,0x52,0x12,
+0x11,0x22,0x23,0x33,0x44,0x32,0x25,0x18,0x13,0x10,0x21,0x23,0x00,0xBC,0x31,0x41,0xE8,0x8A,0xD9,0x9D,0x99,0x00,0xDA,0xCB,0xDB,0xAB,0xCC,0xAA,0xCB,0xCB,0xBA,0xA9,
+0xAC,0x99,0xA9,0x08,0x88,0x10,0x11,0xB9,0x39,0x37,0x2A,0x11,0x67,0x80,0x20,0x33,0x80,0x30,0x27,0x11,0x20,0x24,0x31,0x43,0x11,0x42,0x01,0x21,0x15,0x98,0x20,0x03,
+0x09,0x33,0x80,0x93,0x1F,0x92,0x19,0x24,0xEB,0x88,0x81,0xBC,0x18,0xBB,0x10,0xBC,0x12,0x63,0xCA,0xFA,0x1A,0x80,0xA1,0x0B,0x34,0xB9,0x30,0x8D,0x84,0x1B,0x00,0x32,
+0x65,0x14,0x01,0x34,0x34,0x12,0x15,0x19,0x27,0x10,0x11,0x32,0x20,0x21,0xD3,0x3C,0xA4,0x19,0x09,0xF9,0x1C,0xB8,0xAE,0xA0,0x8C,0xB8,0x99,0xDC,0x9B,0x98,0xCC,0x9A,
+0xA8,0x9C,0xAA,0xCB,0xAA,0xCB,0xBA,0xB8,0x8E,0xB0,0xAB,0x00,0xDB,0x21,0xCA,0x8A,0x10,0xBD,0x31,0xA1,0x59,0x87,0x1A,0x01,0x13,0x78,0x92,0x54,0x88,0x32,0x90,0x48,
+0x02,0x33,0x28,0x26,0x08,0x23,0x71,0x82,0x51,0x81,0x01,0x22,0x20,0x13,0x72,0x94,0x58,0x82,0x44,0xC9,0x41,0xA0,0x40,0x98,0x21,0x11,0x98,0x34,0x09,0x53,0x01,0x98,
+0x01,0x0B,0x87,0x2D,0x25,0x90,0x89,0xA2,0x0D,0x83,0x9D,0x31,0x12,0x08,0xF9,0x18,0xCA,0x29,0xB0,0x1D,0x24,0xA0,0x20,0xFC,0x99,0x19,0x81,0x18,0xF9,0x19,0xA1,0xAA,
+0x9A,0xAA,0x12,0x08,0xCC,0xC8,0x8B,0xCB,0xBB,0x00,0x9E,0x08,0x11,0xB8,0xBF,0x90,0x9E,0x98,0x9B,0xB1,0x9E,0x01,0x98,0x99,0x9D,0x81,0x2A,0xC3,0xAD,0x9B,0x73,0x03,
+0x51,0x91,0x20,0x90,0xDA,0xCB,0x8B,0x21,0x21,0x10,0x00,0x34,0x11,0x82,0x60,0x82,0x40,0x54,0x16,0x99,0x81,0x09,0x53,0xA1,0x80,0x18,0x34,0x22,0x00,0x04,0x3A,0x17,
+0x99,0x09,0x83,0x7A,0x14,0x88,0x20,0xA0,0x28,0x88,0xD0,0x1B,0x90,0x08,0x42,0x38,0x67,0x22,0x11,0x9A,0x21,0x21,0x04,0x08,0x36,0x64,0x82,0x82,0x2A,0x03,0x01,0x73,
+0x11,0x23,0x29,0xA1,0x9D,0x13,0x70,0x92,0x34,0x20,0xC9,0x18,0xA0,0x8B,0x88,0xC0,0x3C,0xFA,0x00,0x18,0xFB,0x18,0x9A,0x13,0x81,0xB9,0xBB,0xFB,0xAB,0xAB,0xDB,0x21,
+0xCD,0x89,0xB8,0x29,0xE0,0xA9,0xBC,0x98,0x81,0x99,0xCF,0x90,0x9B,0xC8,0xAC,0x98,0xAC,0x19,0xC0,0x8C,0xC9,0xAA,0x0A,0x89,0xB9,0xCB,0x5A,0xC1,0x31,0xAD,0x03,0xBD,
+0x20,0x81,0x40,0x92,0x38,0x04,0x00,0x82,0x61,0xB1,0x72,0x82,0x10,0x9A,0x26,0x08,0x82,0x01,0x31,0xA1,0x35,0x99,0x58,0x94,0x9B,0x79,0xC3,0x71,0xB1,0x09,0x22,0xD8,
+0x09,0x80,0x11,0xAA,0x91,0x71,0x17,0x0C,0x12,0x08,0x9A,0x25,0x91,0x8C,0x04,0xBC,0x20,0x11,0xB1,0x78,0x91,0x09,0x81,0xB9,0x51,0xA0,0x38,0xEA,0x48,0xD2,0x49,0xB1,
+0x99,0x19,0x00,0x15,0x89,0x05,0xAB,0x28,0x85,0x0C,0x92,0x48,0xB9,0x22,0x0B,0xE2,0x6B,0xB3,0x29,0xA8,0x32,0xEA,0x1A,0x91,0x90,0x59,0x23,0xE8,0x71,0x90,0x91,0x3B,
+0x93,0xAC,0x12,0x1C,0xC1,0x20,0x28,0x86,0x10,0x92,0x1B,0xD4,0x0C,0x81,0x33,0x88,0x33,0x01,0x22,0xD9,0x19,0xCD,0x42,0x10,0x01,0x15,0xAD,0x23,0xAD,0x23,0xAC,0x81,
+0x31,0xB9,0x23,0x39,0xF3,0x0B,0x10,0x82,0xAB,0x11,0xC8,0x70,0xD8,0x80,0x8E,0x91,0x32,0xAA,0x08,0x36,0x9B,0xB8,0x36,0xBF,0x90,0x41,0xA8,0x80,0x0A,0xA8,0x0A,0x33,
+0x85,0xDF,0x14,0x9D,0x80,0x20,0xA1,0x0D,0x14,0x0A,0x98,0x89,0xA9,0x2B,0x83,0x34,0x8E,0xA4,0x0D,0x92,0x8B,0x51,0x83,0x9A,0xEB,0x48,0xC0,0x3A,0x81,0x80,0xBC,0x80,
+0x99,0x78,0x07,0x19,0x91,0xD8,0x9C,0x01,0x20,0x01,0x38,0xA1,0x28,0x81,0xB1,0xAE,0x8C,0x13,0x8B,0x55,0xF9,0x38,0x88,0x32,0x10,0xC9,0x9B,0x33,0x18,0xB0,0x77,0xAA,
+0x32,0x00,0x88,0xAB,0xC0,0x8F,0x23,0x22,0x90,0x41,0x81,0x02,0xAD,0xEB,0x8A,0x08,0x43,0x24,0x34,0x81,0x80,0x89,0xB8,0xCF,0xBB,0xAA,0x08,0x41,0x43,0x34,0x11,0x21,
+0x22,0x44,0x33,0x12,0x98,0xA9,0xBF,0x9A,0xAB,0xBC,0xBB,0x8B,0xDB,0x80,0xAC,0xA9,0xBA,0xAC,0xA9,0x09,0x52,0x22,0x24,0x32,0x47,0x22,0x33,0x43,0x22,0x32,0x23,0x12,
+0x3A,0x57,0x08,0x22,0x00,0x11,0x80,0xFA,0xAA,0xCC,0xAC,0xAA,0xDA,0xBB,0x9B,0xB9,0xAC,0xBB,0xCB,0xBA,0xBC,0xA8,0x00,0x8B,0xA2,0xDC,0x9B,0xA9,0xB1,0x3D,0x14,0x35,
+0x81,0x21,0x55,0x34,0x42,0x22,0x43,0x12,0x20,0x14,0x41,0x90,0x0A,0x01,0x9B,0xC8,0xAA,0x89,0xAA,0x26,0xAB,0x11,0x0A,0x37,0x89,0x11,0xFA,0x0A,0xB9,0x00,0xDA,0x2A,
+0xC1,0x38,0x92,0xCF,0x08,0x99,0x08,0xB1,0x3B,0xD1,0x29,0x83,0x0A,0x85,0x58,0xC0,0x51,0xA9,0x88,0x89,0x10,0x82,0x3A,0xB3,0xC8,0x7B,0x87,0x09,0xB8,0x21,0x11,0x81,
+0xBB,0x53,0x98,0x88,0x49,0x17,0xBC,0x31,0xB9,0x8C,0x24,0xB9,0x52,0xC8,0x20,0xA8,0x32,0x20,0xE1,0x4B,0xC2,0x2A,0x92,0x53,0xA8,0x28,0xCC,0x31,0x51,0x93,0x20,0x90,
+0x41,0x47,0x91,0x39,0x06,0x20,0x80,0x11,0x50,0x24,0x08,0x23,0x61,0x92,0x49,0x13,0xA9,0x01,0x49,0x02,0x20,0x18,0xE8,0x40,0xC0,0x09,0xB8,0x9B,0x90,0x98,0xFF,0x0B,
+0xB8,0xCB,0x08,0xDC,0x89,0xAC,0x80,0xAC,0x98,0xBC,0xB9,0xBB,0xDB,0x1B,0xF9,0x8A,0xD8,0x09,0xA9,0xA9,0x9A,0xDA,0x8A,0x89,0xDA,0x39,0xF8,0x1A,0x91,0x98,0x08,0xCA,
+0x11,0x0A,0x83,0xCB,0x29,0x80,0x15,0x0A,0x55,0x02,0x08,0x62,0x91,0x62,0x20,0x04,0x49,0x05,0x19,0x33,0x11,0x40,0x24,0x01,0x41,0x22,0x16,0x18,0x25,0x11,0x43,0x91,
+0x32,0x30,0x17,0x10,0x22,0x30,0x13,0x51,0x98,0x42,0x33,0x11,0x14,0x72,0x01,0x91,0x29,0xA8,0x44,0x80,0x28,0xA3,0x2C,0xF9,0x00,0x19,0x90,0x80,0x0B,0xC2,0x8A,0x2B,
+0xF2,0x2E,0xD8,0x8B,0x90,0x8C,0xB0,0x9E,0xA9,0xAB,0x00,0xCE,0x88,0xAA,0x09,0xD9,0x8A,0xDC,0x08,0xC9,0xAA,0x88,0xAA,0xCA,0x08,0xBD,0x99,0xAD,0xBB,0x8A,0x82,0xBF,
+0x91,0xAB,0xBC,0x00,0xAB,0x90,0xEB,0x0A,0xE9,0x89,0x9A,0xBA,0x89,0x18,0xC1,0xAB,0x01,0x49,0x87,0x1A,0x25,0x9A,0x15,0x88,0x11,0xB0,0x71,0x93,0x21,0x41,0x25,0x11,
+0x00,0x11,0x21,0x72,0x15,0x20,0x10,0x35,0x10,0x03,0x71,0x01,0x10,0x31,0x04,0x33,0x42,0x03,0x73,0x43,0x81,0x40,0x81,0x23,0x22,0x33,0x90,0x71,0x24,0x22,0x81,0x18,
+0x36,0x21,0x84,0x49,0x03,0x19,0x35,0x18,0x13,0x52,0xB0,0x71,0x82,0x21,0xB0,0x68,0xC1,0x30,0x80,0x90,0x48,0x90,0x90,0x9A,0x1B,0xB4,0x9D,0x9B,0xB8,0x09,0xBF,0xB2,
+0x9F,0xD2,0x2A,0xC0,0x0A,0xC9,0x08,0xAA,0x81,0xAF,0x9B,0x80,0xBC,0x8B,0xA8,0xEA,0x8D,0xA1,0x0C,0xA8,0xBB,0x80,0xBE,0x0A,0xB8,0x9D,0xB8,0x9A,0xAD,0x91,0xAE,0x08,
+0xB0,0x0D,0xE9,0x08,0x89,0xA8,0x8A,0x89,0xB9,0x8B,0xE9,0x2C,0xB2,0x9E,0x08,0xAA,0xBA,0x30,0xDB,0xC8,0x48,0xD0,0x10,0x88,0x88,0x02,0x39,0xF1,0x29,0xA9,0x32,0xF0,
+0x39,0x83,0x44,0x29,0x12,0x86,0x7A,0xF2,0x48,0xB0,0x18,0x12,0x88,0x15,0x9B,0x36,0xD9,0x39,0x93,0x8B,0x21,0x00,0x15,0x3A,0x07,0x98,0x10,0xA0,0x1C,0x84,0x8D,0x53,
+0xA0,0x41,0x91,0x10,0x01,0xBA,0x30,0xD9,0x20,0x09,0x22,0x31,0x28,0x47,0x89,0xA9,0x28,0x02,0x01,0x39,0x47,0x10,0x12,0x81,0x0A,0x90,0x8B,0x02,0x31,0x65,0x91,0x33,
+0xBA,0x82,0xFF,0x89,0xB9,0x88,0x08,0x11,0x01,0x41,0x03,0x89,0xC2,0x8F,0x90,0x88,0x9C,0x34,0x88,0x52,0x98,0x20,0xA8,0x08,0xCA,0xBE,0x80,0xCA,0x99,0x0A,0x81,0xAA,
+0xFC,0x51,0xC8,0x8A,0xB8,0x9A,0x09,0xEB,0x88,0xAF,0x00,0x08,0x99,0x00,0xAB,0x01,0xBD,0xC8,0x9C,0x91,0x99,0xA0,0x28,0xB8,0x0A,0xF0,0x8E,0x82,0xAC,0x09,0x89,0x80,
+0x92,0xAF,0x82,0x29,0x81,0xEB,0x99,0x69,0x82,0x01,0x2A,0xFA,0x52,0xB9,0x31,0xA1,0x30,0xA1,0x55,0xB8,0x62,0x80,0x80,0xAB,0x23,0x28,0xC0,0x38,0x63,0x81,0x44,0x90,
+0x08,0xC1,0x79,0xB1,0x00,0x30,0xC2,0x38,0x21,0x01,0x38,0xC0,0x1A,0xBA,0x89,0x51,0xA4,0x8E,0x02,0xA9,0x50,0xD0,0x18,0xAB,0x90,0x01,0x2A,0xB6,0x0D,0x22,0xBC,0x41,
+0xB9,0x19,0x83,0x8F,0x04,0x8B,0x03,0x38,0x81,0x30,0x33,0xF0,0x7A,0x90,0x31,0x99,0x22,0x02,0x28,0x03,0x43,0x21,0x30,0x96,0x89,0x1D,0x37,0x89,0x11,0x88,0x91,0x9A,
+0x20,0xE8,0x2C,0xA5,0x3D,0x95,0x0B,0x01,0xA9,0x00,0x9F,0x81,0xAA,0x1D,0xA2,0x39,0xFB,0x18,0xC9,0x1A,0x88,0x80,0xCA,0x1A,0xC4,0x2B,0xB1,0x38,0xC8,0x89,0x00,0x8A,
+0x15,0x9D,0x95,0x5C,0xC2,0x58,0xA0,0x80,0x19,0x06,0x8A,0x82,0x1B,0x14,0x19,0x12,0x9B,0x13,0x41,0xB0,0x42,0xA8,0x52,0x21,0xA3,0x0C,0x80,0x45,0x88,0x43,0xAA,0x98,
+0x00,0x60,0xB2,0x39,0x02,0xFB,0x21,0x9B,0xA2,0x9F,0x25,0x9A,0x92,0x4B,0xC8,0x23,0x9E,0x02,0xA9,0x30,0xB8,0x81,0x8E,0xB0,0x60,0x80,0x08,0xB8,0x1C,0xA0,0x61,0xA8,
+0x98,0x52,0xB8,0x18,0xA2,0x0F,0x05,0x09,0xB8,0x38,0x93,0x0E,0x06,0x8C,0x02,0x99,0x18,0x90,0x63,0xA1,0x8B,0x00,0x30,0xFA,0x31,0x99,0xBA,0x73,0x90,0x9B,0x80,0x49,
+0xB2,0x0A,0x10,0x11,0xFC,0x30,0xAC,0xC3,0x4A,0x90,0x14,0x9C,0x19,0x12,0x91,0x0C,0x83,0x0A,0x14,0x1A,0xA0,0x98,0x76,0xD2,0x18,0xA9,0x31,0xD0,0x19,0x8B,0x16,0xA8,
+0x29,0x84,0x8C,0x01,0x08,0xB0,0x1E,0x16,0x98,0xA9,0x11,0x08,0xBA,0x02,0x78,0x92,0x08,0x01,0xAF,0x33,0xA9,0xAD,0x11,0x02,0xCF,0x42,0xB0,0x9A,0x32,0xB9,0xBC,0x18,
+0x98,0xBA,0xA8,0x79,0xA1,0x25,0xAE,0x01,0xA9,0x09,0x15,0xAC,0xA1,0x1A,0x86,0x1A,0xA1,0x19,0x22,0xBE,0x34,0x9C,0x81,0x19,0xA1,0x39,0xFB,0x02,0x0D,0x86,0xAB,0x14,
+0x89,0x13,0xBB,0x41,0x81,0x0A,0x16,0x9B,0x99,0x73,0xA0,0x20,0x9A,0x22,0x31,0xCA,0x42,0x93,0x7B,0x87,0x29,0x98,0x80,0x21,0x80,0x21,0x82,0x39,0xB2,0x71,0x05,0xAB,
+0x31,0x27,0x09,0x22,0x82,0x4C,0x86,0x18,0x10,0x02,0x29,0x27,0x9B,0x15,0x8B,0x20,0x07,0x8A,0x93,0x0A,0x24,0x19,0xA1,0x40,0x91,0x48,0x81,0xB1,0x3C,0xA1,0x12,0x72,
+0xA1,0x15,0x0A,0xBB,0x01,0x53,0xBF,0x31,0x02,0xCA,0x39,0xC3,0x2B,0x06,0xAC,0x12,0xAB,0x30,0x83,0xCC,0x0A,0x20,0xB8,0x18,0x19,0xD8,0xA8,0x5C,0xE0,0x20,0x9F,0x88,
+0x22,0xBD,0x82,0x0C,0x91,0x88,0xAA,0x91,0x8E,0x81,0xAC,0x00,0xAA,0x31,0xFC,0x0A,0x00,0xAA,0x88,0x09,0xFC,0x19,0xB9,0x09,0x11,0xCF,0x13,0x9D,0x01,0x0B,0xC2,0x1A,
+0xA0,0x81,0x1D,0xB2,0x9F,0x11,0x02,0xAB,0x04,0xAC,0x12,0x28,0xE1,0x19,0xA8,0x43,0x08,0xB0,0x5A,0x84,0x0B,0x14,0x89,0x40,0x81,0x10,0x20,0x82,0x38,0x27,0x1B,0x27,
+0x20,0xBC,0x35,0x18,0x02,0x11,0x8B,0x41,0x16,0x30,0xB0,0x40,0x09,0x05,0x30,0x09,0x17,0x18,0x33,0x91,0x51,0x81,0x28,0x54,0x90,0x32,0xB1,0x4B,0x94,0x59,0x01,0xA3,
+0x5B,0xB2,0x31,0x59,0xB3,0x71,0xA8,0x13,0xA9,0x0C,0x07,0x2B,0x92,0xBB,0x51,0x18,0x96,0x2C,0xC1,0x30,0xAB,0x13,0x8B,0xBA,0x02,0x0E,0x15,0xBA,0x08,0x0A,0x95,0x1B,
+0xC0,0x9B,0x89,0x19,0x08,0xF0,0x2E,0xD1,0x58,0xC8,0x11,0xA9,0xB0,0x49,0xB1,0x19,0xB8,0x22,0x8D,0xB3,0x1C,0x91,0x98,0xB8,0x1E,0xD0,0x8B,0x31,0xE9,0x1A,0xB3,0x2D,
+0xD0,0x20,0xAC,0x33,0x8B,0xA6,0x2D,0xD2,0x28,0xA9,0x12,0xA8,0x28,0xB9,0x33,0xA9,0x1A,0xE2,0x8F,0x22,0xCB,0x01,0x8A,0xB8,0x71,0xA9,0x98,0x38,0xD8,0x41,0xE9,0x28,
+0xA1,0x48,0x92,0x9B,0x21,0xA0,0x28,0x09,0x95,0x2D,0xD0,0x48,0x91,0x10,0xAA,0x45,0xB8,0x9E,0x32,0xB8,0x1B,0x15,0x98,0xAA,0x35,0x08,0x98,0xA0,0x2F,0x97,0x1B,0xA3,
+0x1B,0xA1,0x61,0x82,0x8B,0x94,0x0B,0x02,0x09,0xA1,0x7B,0xA5,0x89,0x28,0xA3,0x0F,0x23,0x98,0x10,0x90,0x34,0xAB,0x24,0xC9,0x59,0xE8,0x20,0x90,0x11,0xC8,0x40,0x02,
+0x91,0x39,0x80,0x30,0xB8,0x54,0xAA,0xF2,0x6A,0x92,0x99,0x18,0x88,0x80,0x03,0x1A,0x9A,0x87,0x6A,0xA2,0x09,0x10,0xEB,0x53,0x98,0x11,0xA9,0x33,0xAB,0xA1,0x3B,0x90,
+0x81,0x49,0x84,0xBF,0x33,0xBF,0x33,0xC2,0x0C,0x91,0x21,0x0A,0xB3,0xBF,0x32,0x90,0xAC,0x24,0xCA,0x0A,0x43,0x80,0xC9,0x29,0x14,0x11,0xB9,0x03,0x1D,0xC0,0x44,0x08,
+0x81,0x81,0x9C,0x01,0x15,0xB9,0x4A,0xA5,0x0D,0x12,0xA1,0x0C,0x99,0x57,0xBA,0x88,0x20,0x82,0x89,0xA0,0x0A,0x20,0x16,0x9A,0x02,0x9B,0x53,0x21,0xFA,0x3D,0x81,0x28,
+0x01,0x10,0xAA,0x41,0xB2,0x79,0xD1,0x10,0x8B,0x15,0x8A,0x21,0x90,0x9D,0x00,0x44,0xAD,0x12,0x1A,0x90,0x91,0xAF,0x52,0xA8,0x31,0x11,0xF9,0x1A,0x23,0xB8,0x08,0x09,
+0xC8,0x72,0xE3,0x19,0x08,0xB3,0x4D,0xC3,0x1B,0x12,0x99,0x80,0x33,0xBD,0x21,0xB0,0x79,0xA0,0x21,0x8A,0xA3,0x5B,0xB3,0x8F,0x12,0x0A,0x10,0x81,0x8F,0x93,0x1D,0x84,
+0x9A,0x10,0x52,0xDA,0x42,0xCB,0x41,0xD0,0x4A,0x83,0xBA,0x39,0x13,0xB1,0x2D,0xB2,0x3A,0x82,0x09,0xA0,0x30,0xA9,0x93,0x8F,0x33,0xC1,0x3B,0x25,0xA8,0x10,0x1D,0x83,
+0x0A,0x58,0xF8,0x09,0x52,0xD8,0x21,0x00,0x89,0x00,0x10,0x2A,0xE3,0x4A,0xA0,0x51,0xEA,0x40,0xB0,0x39,0x92,0x0B,0x83,0xDB,0x62,0xB8,0x9A,0x44,0xB8,0x28,0xA2,0x38,
+0xF8,0x08,0x20,0xA3,0x9E,0x24,0xB9,0x10,0xA1,0x1B,0x95,0x2C,0x07,0xBB,0x20,0xB8,0x18,0x83,0x8C,0x93,0x48,0xB0,0x21,0x9A,0x9A,0xA4,0x4E,0xC4,0x1C,0x01,0x98,0x09,
+0x90,0x0A,0x17,0x9B,0x28,0x17,0x9C,0x18,0xB3,0x1C,0x00,0xD2,0x70,0xD9,0x32,0xB9,0x1B,0x13,0x00,0x9B,0x43,0xC2,0x0F,0x84,0x89,0x10,0xC0,0x29,0x13,0xCA,0x42,0xA9,
+0x01,0x19,0x83,0x9D,0x02,0x39,0xB8,0x28,0x26,0xBC,0x13,0x8A,0x81,0x8B,0x02,0x28,0x99,0x43,0xF8,0x8F,0x41,0x81,0xCA,0x2C,0x95,0x49,0xB1,0x8A,0x82,0x19,0x88,0x17,
+0xBB,0x1A,0x86,0x1B,0x94,0x8A,0x58,0x93,0xBC,0x6A,0xA3,0x9C,0x30,0xB3,0x3C,0x83,0x8B,0x07,0x8C,0x81,0x1A,0x01,0x8B,0x99,0x55,0xA9,0x09,0x33,0x9C,0x94,0x9D,0x22,
+0x05,0xCB,0x8A,0x54,0xB0,0x9B,0x22,0xA2,0x0F,0x05,0x0A,0x99,0x53,0xCB,0x11,0x18,0xB8,0x18,0x19,0xB5,0x2D,0x84,0xBB,0x63,0xA8,0x1A,0x02,0xA8,0x1A,0x06,0xAB,0x0A,
+0x37,0xCA,0x40,0x98,0xA0,0x2B,0x84,0x8B,0x82,0x3A,0xA1,0x40,0x81,0xAD,0x32,0x61,0xE9,0x09,0x12,0xD8,0x49,0x90,0x1A,0x12,0x81,0x0C,0x06,0x99,0xBC,0x72,0xB1,0x0D,
+0x13,0xB8,0x28,0x91,0xA3,0x0E,0x83,0x9A,0x09,0x73,0xE8,0x30,0x91,0x8A,0x20,0xB0,0x1A,0x88,0x23,0x30,0xDE,0x31,0x18,0xC8,0x09,0x92,0x7A,0xE3,0x39,0x89,0x14,0x9A,
+0x89,0x33,0xD9,0x1B,0x16,0xAC,0x04,0x8C,0x14,0xA8,0x09,0x32,0xCA,0x88,0x20,0x82,0x80,0x0B,0x48,0x87,0xAC,0x23,0xAA,0x91,0x71,0xB0,0x09,0x42,0xA0,0x00,0xFA,0x28,
+0x82,0xAC,0x23,0x1A,0xB0,0x22,0x7A,0xD1,0x18,0x2A,0xA0,0x07,0x0F,0x04,0xAA,0x41,0xBA,0x24,0x0D,0x91,0x29,0x80,0x80,0x1A,0x23,0xBB,0x73,0xEB,0x41,0xA8,0xAB,0x27,
+0x9B,0x92,0x20,0xAB,0x34,0xB9,0x0A,0x34,0xDA,0x19,0x24,0xD9,0x08,0x33,0xB9,0xDA,0x68,0xA0,0x89,0x21,0x80,0xB2,0x0F,0x16,0xB9,0x29,0x01,0xB0,0x2C,0x04,0xAB,0x31,
+0xA3,0x8E,0x12,0xB8,0x48,0x90,0xA0,0x70,0xCA,0x61,0xC8,0x38,0x90,0x00,0x19,0x03,0xCB,0x22,0xAA,0x15,0xCA,0x38,0x21,0xFC,0x51,0x99,0x80,0x20,0x99,0x09,0x94,0x2C,
+0xB3,0x48,0xA9,0x38,0x97,0x0C,0x82,0x18,0xA1,0x1D,0x86,0x0B,0x12,0x8A,0x22,0xB9,0x2B,0x84,0x92,0xCF,0x37,0xEB,0x38,0x95,0xAA,0x38,0x86,0x9C,0x21,0x90,0x89,0x21,
+0xA8,0x18,0x81,0x88,0x19,0xA2,0x28,0x0B,0x03,0x33,0xAE,0x90,0x55,0xFB,0x20,0x01,0xC9,0x39,0x05,0xAA,0x20,0x92,0x9C,0x03,0x0B,0x81,0x01,0x0E,0x06,0x8B,0x80,0x12,
+0xCB,0x53,0xA8,0xAB,0x35,0xB8,0x09,0x06,0x8C,0x01,0x90,0x4A,0xA0,0x28,0x81,0x3D,0xC5,0x39,0xB1,0x9A,0x41,0xD2,0x2B,0xB1,0x36,0xBD,0x22,0x12,0xAE,0x12,0x08,0xC0,
+0x30,0x98,0xA8,0x60,0xA1,0x89,0x01,0x02,0xAF,0x31,0x91,0xCB,0x78,0xA4,0x8B,0x03,0x99,0x33,0xCB,0x00,0x28,0x92,0x1A,0x22,0xB1,0x8C,0x28,0x83,0xF9,0x6D,0xA2,0x0A,
+0x10,0x90,0x08,0xD3,0x3D,0x96,0x8B,0x12,0x80,0x9B,0x01,0x22,0x9F,0x14,0x08,0x0B,0x83,0xA0,0x8F,0x14,0xB8,0x1D,0x05,0x9A,0x01,0x90,0x19,0xB1,0x28,0x98,0xB8,0x31,
+0xD9,0x61,0xC8,0x88,0x55,0xCA,0x01,0x09,0x30,0xE2,0x59,0xA0,0x1A,0x92,0x49,0xD0,0x08,0x21,0xA8,0x22,0xBE,0x31,0xB0,0x09,0x19,0x17,0x8F,0x11,0x81,0x99,0x58,0xA1,
+0x29,0x8A,0xA3,0x41,0xAD,0x31,0xB2,0x48,0xC9,0x10,0x30,0xB0,0x09,0xC1,0x60,0xB8,0xBB,0x73,0xB9,0x52,0xCA,0x32,0x9A,0x92,0x29,0xC2,0x5C,0xC1,0x19,0x3A,0xF3,0x4A,
+0x91,0x88,0x29,0x83,0x28,0x80,0xEA,0x50,0xA2,0x0D,0x83,0x28,0xD8,0x29,0xB1,0x89,0x5A,0xB5,0x3B,0xD2,0x39,0x91,0x98,0x0C,0x94,0x49,0x90,0x9A,0x00,0x30,0xBF,0x05,
+0x1B,0xB0,0x40,0x90,0x88,0x29,0x07,0x9B,0x11,0x02,0xA8,0x2C,0xA5,0x0D,0x02,0xA9,0x28,0xA9,0x72,0xC8,0x2C,0x84,0x8C,0x11,0x90,0x89,0x20,0xB1,0x10,0xAD,0x24,0x88,
+0x91,0x0A,0x83,0xCF,0x71,0xA0,0x20,0xA8,0x8A,0x33,0x89,0xA8,0x41,0xAA,0x27,0xBB,0x22,0x13,0x98,0x42,0xF8,0x49,0xC0,0x48,0xA0,0x99,0x73,0xC9,0x28,0x91,0x0A,0x83,
+0xAA,0x21,0xA0,0x8B,0x33,0xAE,0x62,0xB2,0x2C,0x92,0x20,0x90,0x59,0x04,0xB9,0x60,0xA2,0x9B,0x11,0x8E,0x95,0x28,0xA9,0x03,0x3B,0xFA,0x21,0x8C,0x92,0x2B,0x06,0x9A,
+0x89,0x43,0xA8,0xBC,0x42,0xC9,0x21,0x88,0x03,0x8B,0xD0,0x2B,0xD3,0x2A,0x23,0xA3,0x1D,0xA0,0x29,0x25,0x9B,0xA0,0xAC,0x21,0xBB,0x90,0x8D,0x73,0x03,0xFB,0x28,0x11,
+0x14,0xB8,0x10,0xCF,0x32,0x91,0x0E,0x84,0x9B,0x01,0x11,0xF0,0x0B,0x12,0x98,0x30,0x02,0x98,0x09,0x11,0xA9,0x4A,0xA5,0x8F,0x23,0x32,0xEA,0x1A,0x02,0x8A,0x44,0x90,
+0x89,0x9C,0xA8,0x41,0xF9,0x1B,0xA2,0x6A,0xA0,0x11,0x18,0x43,0xB2,0x0A,0x8B,0x26,0xA8,0xCB,0x0A,0x08,0x86,0x2B,0xC2,0x48,0xFB,0x30,0xC8,0x18,0x98,0x10,0x90,0x93,
+0x1D,0x80,0x07,0x19,0x61,0x84,0x9C,0x00,0x31,0xD8,0x40,0xA8,0x22,0x98,0x41,0x90,0x09,0x81,0x8F,0x82,0xD9,0x8B,0x25,0xA9,0x81,0x0E,0x06,0x9B,0x13,0x29,0x86,0x1C,
+0x04,0x80,0x98,0x22,0x89,0xFB,0x58,0xB8,0x98,0x9A,0x13,0xBD,0x22,0x9A,0x29,0x83,0x11,0x50,0x91,0x77,0x88,0x20,0x88,0x11,0xA0,0x29,0x11,0xF2,0x2D,0xA0,0xA8,0x0E,
+0x81,0xD9,0x38,0x88,0xDA,0x42,0xAC,0x04,0x49,0xC1,0x58,0xA2,0x19,0x19,0x84,0x0B,0x85,0x0A,0x92,0x88,0x18,0xA2,0xBB,0x71,0xC0,0x1A,0x85,0x2B,0xD0,0x10,0x1A,0xA9,
+0x25,0x8B,0x12,0x88,0x05,0x8F,0xA2,0x3B,0x93,0x2A,0xC2,0x68,0xC8,0x11,0x08,0x90,0x18,0x98,0x13,0xBD,0x25,0x89,0x08,0x13,0x8E,0x02,0xB9,0x0B,0x65,0xEA,0x41,0x98,
+0x80,0x08,0x13,0xAE,0x31,0x88,0x88,0x00,0x81,0xAB,0x34,0xEC,0x28,0xA8,0x30,0x02,0x88,0x00,0x89,0xC8,0x62,0x90,0x41,0xB2,0x1A,0x92,0xA0,0x0C,0xA2,0x8D,0x25,0xAD,
+0x15,0x8B,0x03,0x09,0x88,0x18,0xFA,0x51,0xDA,0x09,0x81,0x10,0x30,0x96,0x2A,0xA9,0x80,0x09,0x28,0x86,0x18,0x18,0x86,0x0A,0x04,0x0B,0xA2,0x9C,0xEC,0x19,0xBA,0x32,
+0x90,0xCC,0x29,0xD3,0x49,0x90,0x00,0x49,0x84,0x20,0x01,0xD9,0x72,0xA0,0x20,0x98,0x09,0x99,0x34,0x0C,0x83,0x1C,0xA9,0x18,0xCD,0x0A,0xA8,0x8D,0x34,0xB0,0x2B,0x90,
+0xA0,0x1A,0x99,0x72,0xB4,0x70,0x81,0xA1,0x0C,0x00,0x01,0x98,0x9E,0x18,0x85,0x0B,0x19,0xE9,0x89,0x1A,0xA3,0x48,0xC8,0x2B,0x07,0x8C,0x12,0x8A,0x08,0x36,0x08,0x98,
+0x09,0x02,0x13,0x1B,0xA6,0x2A,0xA9,0x25,0xCA,0x29,0xCA,0xAA,0x33,0xCA,0xBE,0x63,0x88,0x13,0xBB,0x11,0x9A,0x9D,0x37,0xAA,0x30,0xE8,0x18,0x00,0xA9,0x88,0x75,0xA0,
+0x29,0x91,0x8A,0x09,0x80,0x02,0x09,0xAC,0x92,0x72,0xBB,0x33,0x29,0xC8,0x50,0x24,0xFC,0x39,0x94,0x8B,0xA0,0x59,0x93,0x38,0xC0,0x30,0xEA,0x08,0x08,0x15,0x19,0xB2,
+0x9F,0x21,0x90,0xB9,0x0D,0x00,0x33,0x25,0xAA,0xA8,0x0B,0x21,0xE1,0x19,0x89,0x62,0xD8,0x8B,0x98,0x32,0x04,0x1A,0x04,0x9C,0xB0,0x0F,0x14,0xAA,0x00,0x21,0xEA,0x09,
+0x24,0x89,0xA0,0x19,0x23,0x9A,0xD2,0x8C,0xA9,0x72,0x02,0x24,0xBA,0x20,0xED,0x18,0x10,0x23,0xA9,0x38,0x98,0x98,0xD9,0x9F,0x80,0x20,0x45,0xBA,0x00,0x21,0x99,0x24,
+0x88,0x9B,0x27,0xBD,0x91,0x0D,0x11,0x12,0xCC,0x48,0xC8,0x30,0x12,0x22,0xC9,0x21,0xBD,0x18,0x02,0x9B,0x34,0x82,0x88,0x90,0xAE,0x15,0x98,0xCD,0x21,0x12,0x12,0xEB,
+0x89,0x20,0x11,0xE9,0x28,0x33,0x12,0xEC,0x19,0x08,0x13,0xA8,0x31,0xD8,0x10,0x98,0xBB,0x19,0x25,0xFC,0x39,0x33,0xB0,0xAA,0xCC,0x29,0x84,0x18,0x30,0x86,0x28,0xD9,
+0x09,0x01,0x20,0x03,0xC0,0x38,0xFA,0xA9,0x39,0x35,0xB9,0x50,0x02,0x9A,0x81,0xB9,0x1C,0x13,0x53,0xF0,0x5A,0x83,0x10,0x30,0xFD,0x1A,0x02,0x43,0xA8,0x90,0x0C,0x23,
+0x06,0xAB,0x98,0x0A,0xC1,0x8C,0x18,0x25,0x00,0x10,0x82,0xA9,0x28,0x99,0xA2,0x8D,0xFB,0x39,0x26,0x43,0xB8,0x09,0x13,0x40,0xF9,0x18,0x0A,0x37,0x98,0x89,0x31,0x03,
+0xFB,0x9C,0x21,0x23,0x82,0x99,0xAD,0x43,0x11,0xC3,0x9E,0x00,0x10,0x01,0x9A,0x02,0x1A,0x92,0xB8,0x0F,0x04,0x08,0x00,0x32,0xB2,0xBF,0xB9,0x71,0xA3,0x8C,0x22,0x88,
+0x99,0x01,0x48,0xB3,0x8D,0x74,0xA1,0x9F,0x08,0x43,0xB1,0x0B,0x02,0xAD,0x42,0x92,0xBC,0x29,0x35,0x91,0x8A,0xB9,0x88,0x73,0xA4,0xCC,0x29,0x44,0x02,0xCC,0x09,0x12,
+0xA8,0x39,0x25,0xA9,0xBA,0x9D,0x44,0x13,0xFA,0x8A,0x51,0x23,0xB8,0xAC,0x20,0x22,0x90,0xBC,0x9A,0x52,0x24,0xA8,0xAD,0x30,0x24,0x13,0xEA,0x9A,0x10,0x81,0x10,0x00,
+0xC9,0xCC,0x19,0x53,0xB8,0xCE,0x19,0x43,0x02,0x88,0x89,0x22,0x24,0x90,0xAA,0x9A,0x20,0x43,0x91,0xCF,0xAA,0x1A,0xB1,0xBF,0x99,0x99,0x21,0x63,0x12,0x09,0x12,0x73,
+0x25,0xA0,0x9B,0x22,0x34,0x92,0xCC,0x0A,0x11,0x90,0xAA,0xBC,0xBA,0xCD,0x8A,0x10,0xB9,0x9B,0x19,0x04,0xBB,0xA8,0x18,0x32,0x77,0x02,0x89,0x18,0x33,0x04,0xA9,0x8B,
+0x77,0x12,0x88,0x09,0x11,0x02,0x90,0x20,0x90,0xA0,0x0C,0x11,0xB1,0xEF,0x9B,0x00,0x12,0xA8,0xAD,0x22,0x21,0x12,0xD1,0x8B,0x99,0x56,0x03,0xBB,0x09,0x30,0x16,0x98,
+0xAB,0x31,0x08,0x93,0xCC,0x19,0xDA,0x29,0x53,0x17,0xBB,0xBA,0x18,0xD9,0xCB,0x0C,0x02,0x08,0xB8,0xBE,0x28,0x32,0x83,0x8B,0xD1,0x50,0x82,0x20,0xDA,0x29,0x93,0xAB,
+0xA8,0xDB,0x1A,0xA0,0x55,0x03,0xC1,0xBF,0xAB,0x23,0xCD,0x31,0x82,0x41,0x23,0xCB,0x8A,0xB9,0x8B,0xB0,0xBE,0x11,0x44,0x13,0x00,0xB9,0xC9,0x7A,0x15,0xA8,0x8B,0x25,
+0x98,0xCB,0x89,0xDA,0x9B,0x30,0x10,0x77,0x02,0x11,0x12,0x81,0xBA,0xCB,0xBB,0x8C,0xB0,0xBC,0x0A,0x44,0x11,0x36,0x00,0x53,0x01,0x11,0x99,0x98,0xBB,0x18,0xA1,0xCF,
+0x08,0xA0,0x9A,0x99,0x71,0x94,0x09,0x22,0x80,0x8C,0x02,0x41,0x80,0x24,0xAB,0x91,0x19,0xEA,0x9A,0x39,0xE2,0x8D,0x14,0x0A,0xA0,0x1A,0x02,0x11,0x2A,0x07,0x3B,0xC2,
+0x18,0xDB,0x20,0xD9,0x99,0x89,0xEB,0x8A,0x03,0xCB,0x38,0x90,0x20,0xCA,0xCB,0xBD,0xAD,0x71,0x04,0x00,0x80,0x98,0x98,0x8A,0x10,0x14,0x00,0x99,0xC8,0x18,0x7A,0xA4,
+0x0A,0x89,0xBD,0x51,0x42,0x22,0x54,0xB1,0xAE,0xA9,0xAB,0x98,0x18,0x22,0x31,0x67,0x81,0x10,0x80,0xCB,0xBA,0x9A,0x31,0x23,0x65,0x34,0x32,0x32,0x23,0x23,0xA8,0xDC,
+0xAB,0xEC,0xDB,0x9B,0xB9,0xBB,0x98,0xDA,0x8A,0x98,0x8A,0x52,0x24,0x22,0x35,0x33,0x43,0x35,0x22,0x32,0x44,0x23,0x22,0x10,0x24,0x88,0x31,0xA1,0xAA,0x9C,0xDA,0xAC,
+0xD8,0xBC,0xBB,0xA9,0x9D,0xE9,0x9C,0x90,0x9C,0x80,0x99,0xAA,0x8B,0xB8,0xBA,0x19,0xB3,0x0D,0x23,0xDB,0x60,0x32,0x14,0x28,0x36,0x81,0x51,0x34,0x81,0x10,0x35,0x01,
+0x51,0x14,0x08,0x11,0x80,0x51,0x23,0x91,0x00,0x99,0x33,0x08,0x00,0xF9,0x9F,0x00,0xA8,0x88,0xDB,0x20,0xDA,0x09,0xC9,0x9B,0xC9,0xAE,0x9A,0xB8,0x8D,0x88,0xDB,0x89,
+0xB9,0xCA,0x09,0xA0,0xBA,0x00,0xC9,0x09,0x1B,0x27,0x99,0x09,0x37,0x90,0x8A,0x32,0x91,0x79,0x27,0x80,0x10,0x02,0x91,0x49,0x13,0x20,0x20,0x14,0x43,0x00,0x32,0xF9,
+0x63,0xB8,0x32,0x98,0x28,0xC3,0x39,0xA3,0x40,0xC0,0x58,0xB3,0x8C,0xAA,0x32,0x01,0x84,0xAD,0x43,0xB8,0x28,0x32,0x08,0x9B,0x72,0x88,0x18,0x80,0x51,0x99,0x67,0x80,
+0xA9,0x28,0x12,0x98,0x08,0x9B,0xB9,0xBB,0x28,0x2A,0x17,0xCE,0xAB,0x08,0x02,0xEC,0x28,0xB8,0x89,0xCB,0x88,0xF9,0x3A,0xD2,0x0C,0x00,0x99,0x1B,0x10,0xB0,0x9C,0x19,
+0x23,0x8F,0x35,0x9A,0x90,0xBC,0x52,0xB0,0x2B,0x13,0x2A,0x05,0x9E,0x14,0x20,0x03,0x18,0x90,0x00,0x31,0xA1,0x67,0x99,0x32,0x00,0x08,0xA1,0x1A,0x1B,0x57,0x39,0x82,
+0x21,0x44,0xA8,0xA1,0x09,0x0A,0x27,0x47,0xA9,0x88,0x20,0x81,0x98,0x71,0xA2,0xAB,0x42,0x98,0x20,0xB1,0x19,0xD0,0x31,0x85,0xAD,0x11,0xBA,0x00,0x83,0x39,0xF9,0x01,
+0x9C,0x01,0xC9,0x49,0xB8,0x11,0x9B,0xF9,0x2C,0xC0,0x0C,0x91,0x09,0xBA,0x8A,0xD9,0x9C,0xAB,0xD9,0x9F,0x80,0x98,0x10,0x00,0xD0,0x8A,0x9B,0xDA,0x8B,0x90,0x18,0x85,
+0xAD,0x08,0x21,0xF9,0x8B,0x12,0x99,0x30,0xC1,0x1B,0x98,0x08,0xAE,0x11,0xEB,0x00,0xB8,0x10,0x61,0xB2,0xAF,0x88,0xAA,0x90,0x20,0x80,0x12,0x0A,0x55,0x92,0x90,0x61,
+0xC1,0x0A,0x86,0x0C,0x04,0x08,0x10,0x91,0x88,0x91,0x0D,0x17,0x0A,0x11,0xB2,0x7A,0xA3,0x1B,0x93,0x1F,0x17,0x9B,0x23,0xA8,0x28,0x92,0x69,0x93,0x9B,0x01,0xB9,0x78,
+0x13,0x21,0xD8,0x88,0x50,0x81,0x33,0xCB,0x19,0x24,0xA9,0x18,0x35,0x91,0x9B,0x02,0x1B,0x67,0x81,0x89,0x20,0x92,0x2A,0xB8,0xAC,0x73,0xA2,0x99,0x21,0x04,0xBB,0x9A,
+0x8A,0x45,0xBA,0x18,0x73,0x82,0x99,0x30,0xA2,0xAB,0xAF,0x99,0x22,0x09,0xAC,0xEB,0x8C,0x21,0xC0,0x9B,0x29,0x01,0x41,0xED,0x0A,0x12,0x98,0x39,0x01,0x28,0x9E,0x15,
+0xAC,0x13,0xBC,0x1B,0x94,0x1A,0x22,0xD9,0xAD,0x18,0x82,0xAE,0x91,0x78,0xE9,0x12,0x0B,0x24,0xA9,0x1B,0x00,0x82,0x2A,0xCA,0xB8,0x8F,0x33,0x13,0xBA,0x1E,0xC2,0x48,
+0xEC,0x43,0xCA,0x31,0x09,0xA1,0x3A,0x11,0x82,0x1C,0x91,0x8D,0x33,0xC9,0x1A,0x02,0x0A,0xB0,0x9B,0x08,0x41,0xF9,0x48,0x00,0x12,0xBB,0x11,0xF9,0x73,0xB0,0x99,0x10,
+0x88,0x1B,0x07,0x1B,0x23,0xA8,0x3A,0xA3,0x0E,0x62,0x03,0x89,0x90,0x90,0x72,0xD8,0x09,0x0B,0x85,0x99,0x00,0x08,0x24,0x90,0x19,0x32,0x47,0xB8,0x09,0x98,0x29,0x11,
+0xC1,0x3E,0x15,0xBB,0x9A,0x9A,0x32,0x01,0xFB,0x8A,0x42,0xA8,0x92,0x9C,0x80,0x03,0x4A,0x15,0xA8,0x3D,0xE3,0x1B,0x22,0x98,0x03,0x70,0x03,0xAC,0x11,0x12,0xA9,0xCD,
+0x51,0x82,0x10,0x13,0x99,0xD0,0x38,0x92,0x08,0x9A,0x8A,0x30,0xF3,0x2D,0x03,0x1C,0x16,0x0C,0xB1,0x1D,0x23,0x11,0x9B,0x43,0x80,0xAC,0x09,0x84,0x9F,0x13,0x10,0x8A,
+0x82,0x89,0xCB,0xA0,0x40,0xC2,0x4A,0x37,0x00,0x81,0xC9,0x1B,0x17,0x98,0xA0,0x3A,0xA3,0x19,0xDB,0x31,0xB0,0x4A,0xE2,0x39,0x53,0xD1,0x3A,0xB9,0x30,0x34,0xDB,0x33,
+0x0A,0x00,0x19,0x27,0xCA,0xAC,0x48,0x45,0xC8,0x0B,0x11,0x10,0x09,0x03,0x9A,0x9A,0x24,0x52,0xA3,0x9F,0x91,0x99,0x33,0x02,0x01,0x11,0x89,0xF2,0x8B,0x10,0x15,0x32,
+0xF9,0x8E,0x08,0x00,0x89,0x28,0xB2,0x59,0xA9,0x41,0x23,0x8E,0x04,0x89,0x58,0xA3,0xCC,0x08,0x02,0x90,0xAD,0x08,0x41,0x86,0x1B,0xB8,0x42,0xBB,0x22,0xAB,0x17,0xBB,
+0x82,0x8D,0x33,0xB8,0x00,0x9C,0x22,0xB9,0x31,0xAF,0x35,0x01,0xFB,0x0A,0x44,0x98,0xA9,0x3B,0x17,0x01,0xA0,0xAC,0x20,0x22,0x82,0x0C,0x82,0xBA,0x0D,0x11,0x8B,0x29,
+0x45,0x92,0xCC,0x10,0xB0,0x58,0x80,0x81,0xAB,0x61,0x13,0x00,0x9B,0x03,0x89,0x0C,0xB8,0x8A,0xBF,0x90,0x25,0x10,0xCF,0x10,0x11,0xAA,0x62,0x11,0x89,0x28,0xB2,0x8F,
+0x02,0x29,0x01,0xC9,0x50,0xB1,0xBA,0x1C,0x92,0x12,0x59,0xB6,0x0C,0x98,0x81,0x00,0x9A,0x29,0x05,0xBB,0xB9,0x71,0x85,0x19,0x81,0x0B,0xD3,0x1C,0xBA,0x34,0x18,0xC3,
+0xDC,0x1B,0x06,0x88,0x11,0xAB,0x34,0x8B,0xF2,0x3C,0x02,0x98,0x49,0xC2,0x0A,0x89,0xA2,0x98,0x0D,0x05,0x8D,0x02,0x3A,0xB2,0x49,0xAA,0x04,0x8D,0x82,0x98,0x72,0xD1,
+0x19,0x92,0xAA,0x88,0x11,0x09,0x93,0xBE,0x40,0xDC,0x50,0x92,0xAB,0x08,0x51,0xB2,0x0B,0x04,0xEA,0x19,0x14,0x12,0xBB,0xAB,0x35,0xAD,0xA1,0x39,0xA0,0x35,0xA9,0x8B,
+0x15,0x99,0x8B,0x98,0x72,0xC4,0x28,0x18,0x95,0x9A,0xAC,0x25,0x99,0x80,0x92,0xAB,0x4A,0x95,0x89,0x8A,0x04,0x30,0xC9,0x0A,0x44,0xAA,0x23,0x21,0xFA,0x0C,0x88,0x34,
+0x88,0x05,0xAE,0x98,0x20,0x22,0x81,0x31,0xFA,0xAE,0x10,0x40,0x06,0x98,0x99,0x9A,0x22,0x89,0x32,0x02,0xB9,0xA8,0xBF,0x31,0x12,0xA8,0x73,0x92,0xDB,0x09,0xC1,0x0C,
+0x25,0x88,0x82,0x0A,0x00,0xC0,0x71,0x90,0x89,0xA9,0x8D,0x83,0x5B,0xB2,0x21,0x20,0x86,0xAE,0x21,0x99,0xB8,0x7A,0x84,0x18,0xB8,0x28,0x90,0x82,0xAE,0x22,0x08,0x30,
+0xE8,0x9A,0x79,0x04,0x9B,0x12,0x9B,0x96,0x8E,0x11,0x03,0xAA,0x22,0xB9,0x39,0xC0,0x32,0x9C,0x05,0x29,0x01,0x84,0x8D,0x93,0x9E,0x32,0x99,0xA9,0x70,0x91,0xA9,0x2A,
+0x02,0xA0,0x4A,0x05,0x1A,0xC0,0x3A,0x82,0x10,0xD9,0x21,0xBF,0x14,0x8C,0x93,0x59,0xA1,0x28,0xA8,0x30,0xD0,0x28,0x99,0x20,0x00,0x2A,0x07,0x18,0x41,0xC1,0x18,0xAA,
+0x89,0x54,0xA0,0x3A,0x95,0x9E,0x21,0xB9,0x31,0x13,0xEC,0x39,0x03,0x10,0x8B,0x81,0x9A,0xCA,0x35,0xB8,0xA9,0x38,0xD4,0x2E,0x15,0xA9,0x09,0x88,0x01,0x11,0x09,0xA5,
+0x8F,0x34,0xA0,0x80,0xAA,0xB0,0x4B,0xA4,0x0D,0x83,0x11,0xCC,0x32,0x99,0x32,0x9B,0x15,0x99,0x47,0xB2,0x1C,0xA4,0x8D,0x81,0x38,0x13,0x90,0x9A,0x14,0x9D,0x14,0x9B,
+0x9A,0x42,0xB8,0x39,0x92,0x99,0x1B,0xC0,0x71,0x82,0xDB,0x2A,0x15,0x38,0xD1,0x48,0xA9,0x24,0x9C,0x10,0x89,0x51,0xD8,0x28,0x00,0x99,0x32,0x9A,0xDA,0x21,0x0A,0x03,
+0x53,0x35,0x99,0xA2,0x1E,0x88,0x05,0x9E,0x81,0x21,0x98,0x01,0xDB,0x18,0xB8,0x2A,0x32,0x83,0x89,0x32,0xDE,0x80,0x23,0xEE,0x33,0xCB,0x30,0xA2,0x8B,0x08,0x8A,0xD0,
+0x1D,0x81,0xBB,0x79,0xA4,0x1A,0x23,0xB9,0x08,0xBF,0x51,0x00,0x82,0xC9,0x79,0x91,0x0A,0x13,0x99,0x03,0xBB,0x28,0x82,0xCB,0x49,0xD9,0x58,0xA1,0x39,0x91,0x01,0x2C,
+0xB2,0x99,0x51,0x83,0x93,0xCF,0x08,0x33,0x62,0xC0,0x39,0x81,0xC9,0x78,0xC0,0x18,0x28,0x12,0xB8,0x69,0xB1,0x9B,0x41,0xC8,0x28,0x03,0x9E,0x12,0x98,0x09,0xDA,0x30,
+0xAD,0x12,0x8B,0x18,0x97,0x2C,0x94,0x9B,0x72,0xD8,0x48,0x98,0x8B,0x22,0x90,0x89,0x93,0x0C,0xA1,0x78,0xC2,0x1C,0x04,0x8A,0x98,0x41,0xC9,0x31,0x02,0xCB,0x80,0xAC,
+0x98,0x99,0x75,0xB2,0x1C,0x06,0xAB,0x42,0xC1,0x8B,0x15,0xAA,0x20,0x81,0x88,0x21,0xA0,0xCD,0x10,0x91,0x28,0x85,0x8C,0x23,0xD9,0x09,0x84,0x9D,0x23,0x89,0x20,0x82,
+0x89,0x02,0x98,0xBB,0x14,0x1C,0xA8,0x27,0xBB,0x14,0x8B,0x21,0xAB,0x11,0xDD,0x8C,0x24,0x88,0x21,0x81,0xA0,0x09,0xCF,0x41,0x81,0x8A,0x28,0x02,0x1A,0x92,0xAF,0x20,
+0x00,0x24,0xBD,0x20,0x98,0x02,0x0B,0xCC,0x72,0xA1,0x9C,0x33,0xCA,0x29,0x05,0xAA,0x11,0x82,0xCB,0x32,0xA2,0xBC,0xA0,0xAB,0x65,0x92,0x80,0x88,0x33,0x87,0x8C,0x31,
+0x88,0x04,0xC9,0xBB,0x9A,0x9B,0xA9,0x26,0x83,0xBC,0x13,0xCB,0x50,0x25,0x00,0x38,0x33,0xAD,0x44,0xAA,0x89,0x53,0x98,0x90,0x29,0x05,0xCD,0x8A,0x19,0x91,0x09,0x11,
+0xA0,0xBC,0x53,0xB9,0x0A,0x16,0x0C,0x01,0xB9,0x70,0xB2,0x2B,0x27,0xBB,0x01,0xDA,0x2A,0x24,0x81,0xA0,0x19,0x91,0x3B,0x83,0xFF,0x31,0x91,0x18,0x98,0x10,0x98,0xAD,
+0x18,0x9B,0x03,0x9D,0x01,0x02,0x38,0xB8,0x3C,0x80,0x85,0xBB,0xBC,0x48,0x36,0xA0,0x0A,0x76,0x82,0x80,0xA9,0x9A,0x11,0x02,0xD8,0x28,0xAA,0xBA,0x7B,0x15,0xAB,0x33,
+0xDA,0x1B,0x17,0x88,0x98,0x19,0x24,0x13,0x9A,0xAA,0x3A,0xB8,0x6C,0x03,0x28,0x02,0x0E,0xAA,0x1E,0x25,0x19,0x12,0xDB,0x99,0xBB,0x33,0x02,0x52,0x05,0xD9,0x08,0xCC,
+0x10,0xAB,0x11,0x80,0x72,0xC1,0x2A,0x05,0x98,0x48,0xA1,0x3A,0xA0,0xFB,0x1B,0x12,0x99,0x63,0x91,0x0B,0x16,0xB9,0x28,0xA2,0x9F,0x41,0x91,0x00,0x01,0xCA,0x88,0x52,
+0x06,0x90,0x9A,0xA8,0x28,0x92,0x0B,0x63,0x82,0x99,0x9B,0x82,0x2A,0xF0,0x31,0xB4,0x89,0x42,0x03,0xBC,0x28,0x02,0xBF,0x41,0x23,0x10,0xFB,0x8B,0x13,0xAC,0x21,0x99,
+0x71,0x90,0x29,0x13,0x10,0x32,0x8B,0x43,0xF3,0x19,0xC0,0x41,0x92,0xAB,0x94,0x9C,0x78,0x05,0x90,0x00,0x80,0xA9,0xB9,0x9D,0x31,0x13,0x0A,0x38,0x3B,0x84,0xBB,0x48,
+0x84,0x80,0x84,0x3F,0x07,0x99,0xAC,0x10,0x10,0x02,0x01,0xDA,0x0B,0x48,0xA2,0x1C,0x22,0xBD,0x89,0x34,0x14,0x09,0x08,0xBF,0x10,0x08,0x01,0x5A,0x45,0x98,0x88,0x31,
+0xC9,0x9D,0x01,0xA9,0xAB,0x52,0x01,0x48,0x82,0x22,0xB3,0x0F,0x11,0xA0,0xBA,0x70,0x24,0xBA,0x89,0x80,0x52,0x94,0xCB,0xBB,0x29,0x31,0x62,0x91,0x0A,0x04,0x0A,0x38,
+0xCB,0x33,0x80,0x8C,0x47,0x08,0xBA,0x01,0x8D,0x82,0x80,0x0B,0x43,0x97,0x8B,0xFC,0x29,0x02,0x01,0xBC,0x2A,0x01,0x2A,0x64,0x00,0x18,0x00,0xC8,0x10,0x22,0xD8,0x8B,
+0xAA,0x70,0x03,0x08,0x08,0x52,0xC9,0x0A,0x40,0xA3,0x9E,0x90,0xCB,0xA0,0x89,0xAA,0x30,0x16,0xC2,0xC9,0x8B,0x14,0x12,0x35,0x81,0x22,0xD8,0x9D,0xC9,0x18,0x12,0x15,
+0x98,0x89,0x34,0xE9,0xAB,0x08,0xA1,0x29,0x24,0x82,0x30,0xFB,0x8F,0x08,0x00,0x98,0xDA,0x38,0x15,0x98,0x99,0x21,0x25,0xB9,0xAD,0x40,0x23,0xE9,0x9B,0x19,0x01,0x12,
+0x01,0xAC,0x42,0x82,0xCA,0x2A,0x15,0x91,0xEF,0x28,0x32,0x92,0x9A,0x8C,0x11,0x80,0xB9,0xAA,0x35,0x80,0x08,0xCD,0x30,0x08,0xBC,0x48,0x23,0x52,0x01,0xBC,0xAC,0x11,
+0xA0,0x0A,0x08,0xAC,0xB8,0x73,0x15,0xA9,0xA0,0x9F,0x22,0x11,0xAB,0xA2,0x0D,0x28,0x22,0xEB,0x0B,0x48,0x82,0x8C,0x80,0x53,0x21,0xA2,0xDF,0x10,0xA8,0x99,0x42,0x01,
+0x28,0x53,0xB8,0xBD,0x38,0x01,0x28,0x44,0x85,0xCA,0x98,0x18,0x25,0x99,0x9B,0x89,0x0A,0x72,0x92,0xAB,0xA9,0x8A,0x33,0x30,0xB4,0xBC,0xC0,0x8B,0x74,0x84,0xB0,0x0B,
+0x21,0xAC,0x0C,0x88,0x5A,0x12,0xB9,0x9D,0x28,0x52,0xA9,0x20,0x08,0xB8,0x73,0xA1,0x38,0xB3,0x0C,0x83,0x84,0xC0,0x03,0x84,0xC0,0xCB,0xBA,0x88,0x50,0x27,0xBB,0x82,
+0x50,0x23,0x9C,0xA8,0x0D,0x48,0xA0,0x0A,0x50,0x41,0x23,0xBF,0x88,0x10,0xA2,0x10,0xA0,0x83,0x9F,0x80,0x20,0xDB,0xA9,0x8A,0x63,0x53,0x99,0x03,0x9C,0x10,0x27,0xB0,
+0xA9,0x99,0x82,0x58,0xC0,0x10,0x93,0x0D,0x01,0xA8,0x20,0x80,0x3B,0x35,0xCF,0x1A,0x02,0x10,0x22,0xB3,0x8E,0xA2,0x80,0xB3,0x1F,0x82,0x08,0x32,0x3B,0x00,0x0D,0xC3,
+0x0E,0x01,0x8A,0x80,0x30,0x80,0x80,0xF0,0xB3,0x0C,0x87,0x29,0xA1,0x33,0x08,0x03,0xD0,0x0C,0x73,0xC2,0x2B,0x91,0x58,0x01,0xA8,0x80,0x80,0x80,0x74,0xA0,0x20,0x38,
+0xBB,0x30,0x97,0x0C,0x48,0x93,0x9D,0x23,0xAA,0x80,0x83,0xF0,0x28,0x22,0x32,0xC0,0x30,0xB4,0x8B,0x80,0x58,0x30,0x80,0x50,0x80,0xBD,0x30,0x44,0xBB,0x3C,0x80,0x3C,
+0xF0,0x0A,0x52,0x21,0x88,0x20,0xCD,0x10,0x42,0xBA,0x58,0x08,0x51,0x98,0xC9,0x4A,0x91,0x2A,0x38,0xBB,0x30,0x84,0x80,0x3C,0x34,0xBF,0x43,0xCB,0x12,0x9A,0x58,0x85,
+0x09,0x98,0xA0,0x42,0xA2,0xBD,0x39,0x35,0xB8,0x51,0xB8,0xA0,0x78,0x13,0x9A,0x0A,0x22,0xFB,0x48,0x03,0x9B,0x80,0xA0,0xAB,0x30,0x03,0x08,0x35,0xB4,0xBF,0x0C,0x33,
+0x2A,0x83,0x0B,0x97,0x2A,0x82,0xB0,0xCB,0x8A,0x37,0xA0,0x22,0xE0,0x08,0x82,0x32,0x83,0x8B,0x80,0xBD,0x17,0xC0,0x9D,0x31,0x13,0x80,0x80,0xBB,0xC0,0x73,0xB3,0x2A,
+0x80,0x80,0x8B,0xB5,0x37,0xD8,0x98,0x09,0x23,0x0A,0x85,0x8B,0xD8,0x21,0xA0,0x32,0xCB,0x30,0xF0,0xA8,0xA2,0x33,0xCB,0xB0,0x88,0x35,0x16,0xA2,0x8C,0x04,0x9C,0x41,
+0xB1,0x0C,0x91,0x1D,0x82,0x0A,0x80,0x0E,0x23,0x2A,0x08,0x96,0x8C,0x84,0x89,0x02,0xAB,0x33,0xC0,0x80,0x3C,0x00,0xD8,0x30,0x8B,0xF0,0x0C,0xA8,0x0B,0x43,0xFB,0x31,
+0x20,0x08,0xBB,0x80,0xBC,0xFB,0x21,0x22,0xB8,0xB3,0x40,0x43,0xB3,0x08,0xD0,0x08,0x04,0xBC,0x08,0xED,0x3B,0x24,0x08,0xA8,0xAD,0x8B,0x58,0x84,0x10,0xA0,0xE0,0x0B,
+0x21,0xA2,0x9F,0x32,0x9A,0x48,0x89,0x64,0x80,0xAB,0x19,0xA0,0x02,0xB8,0x0F,0x01,0xAC,0x44,0xA0,0x00,0xA8,0x3A,0xE2,0x19,0x06,0x89,0x80,0xA9,0x24,0x8A,0x0A,0x02,
+0xC0,0x8B,0x40,0xF0,0x2A,0x22,0x08,0x8B,0x84,0x3B,0xD0,0x03,0xEC,0x08,0x22,0x20,0xF0,0x08,0x82,0x0D,0x98,0xA8,0x68,0xB3,0xBC,0x21,0xB0,0x03,0x3B,0x58,0xB3,0x0C,
+0x16,0xC9,0x28,0xA8,0x83,0xC0,0xBA,0x6C,0x91,0x28,0x80,0xB8,0xF0,0x28,0x08,0x02,0x9F,0x33,0xA2,0xAC,0x80,0x25,0x9C,0x0A,0x04,0x28,0xB2,0xBB,0x24,0x43,0xBE,0x10,
+0x9C,0x21,0x23,0x80,0xFF,0x19,0x02,0x10,0x91,0x38,0xA2,0x0A,0x0B,0xF8,0x48,0x91,0x40,0x0A,0xAA,0x6B,0xB1,0x2A,0xDA,0x48,0xA0,0x49,0x03,0x0D,0x83,0xAB,0x38,0xB8,
+0x17,0x1F,0xD3,0x60,0xF8,0x38,0x92,0x9D,0x25,0xCA,0x30,0xC1,0x29,0x01,0xA9,0x38,0xA8,0x20,0xC9,0x51,0x90,0x09,0x81,0xA9,0x22,0x90,0x13,0xAC,0x32,0x89,0xA9,0x52,
+0xA9,0x0A,0x32,0x78,0xDB,0x11,0x98,0x28,0x0A,0x05,0x9C,0xA1,0x80,0x30,0xB8,0x53,0x0B,0xC3,0x4B,0x08,0x48,0x08,0x48,0x8B,0x85,0x0B,0x08,0x44,0xFB,0x28,0x01,0x02,
+0x8E,0x84,0x0D,0x11,0x0A,0x32,0xD0,0x32,0xEA,0x59,0x92,0x2A,0xC1,0x4A,0xA3,0x0B,0x91,0x08,0x58,0xC0,0x61,0x90,0x1B,0x13,0xCB,0x09,0x21,0x32,0xB0,0x6C,0xB1,0x5C,
+0x95,0x0D,0x03,0x89,0x98,0x11,0x9B,0x15,0x00,0xD9,0x2A,0x80,0x82,0x0C,0x01,0xAA,0x25,0x8C,0x27,0x9A,0x10,0x99,0x31,0xC0,0x28,0xA2,0x1D,0x06,0x9B,0x1A,0x82,0x0A,
+0x32,0x03,0x08,0x74,0xF9,0x2A,0x83,0x99,0x10,0xA9,0xAB,0x7B,0x83,0x08,0x22,0x83,0x3B,0xD0,0x73,0xC8,0x89,0x03,0xAA,0x35,0x01,0x0A,0x0B,0x36,0x8B,0x80,0x3B,0x80,
+0x35,0x38,0xC0,0xAC,0x73,0xA0,0x80,0x80,0x30,0x48,0x8B,0x80,0x3D,0x27,0x08,0x28,0x8A,0x80,0xAF,0x19,0x83,0x0B,0x03,0x34,0xCB,0xB8,0x0D,0x03,0xC8,0x48,0xB3,0xBC,
+0x3C,0x43,0x86,0xA0,0xB0,0xB0,0x03,0x34,0x97,0x08,0x08,0x38,0x3B,0xB4,0x38,0xB5,0xC0,0x80,0x80,0x0C,0x3C,0x30,0xD0,0xC0,0x8A,0x3B,0xCC,0x00,0x08,0x88,0x47,0xC8,
+0xA9,0x28,0x8A,0x73,0x09,0x01,0xEA,0x10,0x91,0x08,0x05,0xAA,0x32,0x08,0x0C,0x8B,0x27,0x08,0xD8,0x0A,0x80,0x20,0x0E,0x88,0x0A,0xB8,0x80,0xF0,0xBB,0x3A,0x48,0xB2,
+0xCB,0x30,0x27,0x08,0x0B,0x03,0x43,0x08,0x03,0x08,0x78,0xB2,0x54,0xC2,0x48,0x21,0xA8,0x0A,0x16,0x89,0x22,0xEA,0x19,0x22,0xAB,0x3B,0x27,0x21,0x82,0xCD,0x99,0x39,
+0x02,0x08,0xB8,0xBC,0xC0,0x8B,0xAF,0x02,0x8A,0xBB,0x03,0xFC,0x98,0x08,0x08,0xBB,0x0C,0xCB,0x00,0x03,0x88,0x80,0xAF,0x38,0xC0,0x03,0xB4,0xC8,0xAC,0x78,0x23,0x01,
+0xBA,0x0B,0x70,0x10,0x02,0x0B,0x06,0x01,0x32,0xB8,0x08,0x04,0x48,0x37,0x20,0x01,0x23,0xBE,0x23,0xAA,0x36,0xAD,0x12,0x9B,0x45,0xAA,0x11,0x99,0x48,0x93,0x0D,0x08,
+0x28,0xB0,0x38,0x0B,0x0D,0x38,0xC0,0x08,0xBF,0x02,0xBB,0xC0,0x60,0xC9,0x28,0xE8,0x08,0xA9,0x14,0xA9,0x82,0x0A,0x0B,0xC8,0xAF,0x08,0x8A,0x80,0xB0,0x08,0x88,0x80,
+0xBE,0xBC,0x08,0x34,0xCB,0xB8,0x0D,0x08,0x08,0xBD,0x03,0x80,0x05,0x0C,0x48,0x08,0xCF,0x21,0x08,0x28,0x33,0xCB,0x30,0x8B,0x40,0x64,0x89,0x20,0x08,0x08,0x03,0x04,
+0x74,0x91,0x10,0xB0,0x30,0x07,0x01,0x08,0x08,0x48,0x72,0xA3,0x89,0x80,0x8A,0x43,0xB8,0x43,0x03,0x78,0xC3,0x0A,0x82,0x33,0x48,0xBB,0x03,0x3D,0x03,0x8F,0x84,0xC9,
+0x10,0xA0,0x58,0x82,0xAA,0xB0,0x30,0xBC,0x3B,0x00,0x85,0x80,0x80,0x0E,0x0C,0xB3,0xC8,0xC0,0x8B,0xB4,0x0C,0xCB,0x03,0xBC,0x00,0xBC,0xB8,0x3D,0xC0,0x0B,0x80,0x80,
+0xE0,0x1F,0x82,0x2C,0xC3,0x89,0x02,0x08,0xE8,0x2A,0x80,0x03,0xCB,0x83,0xC0,0x80,0x84,0xC0,0x80,0x84,0x80,0x85,0x80,0xF0,0x0B,0x08,0x38,0x84,0x0B,0x03,0xD8,0x30,
+0xD0,0x30,0x0C,0x80,0x8C,0x84,0xCB,0x97,0x8B,0x82,0x83,0x08,0xB3,0x34,0xC0,0x43,0xB8,0x3C,0x27,0x9C,0x82,0x82,0xB0,0x30,0xF8,0x48,0x91,0x40,0x01,0x38,0x88,0x30,
+0x8B,0x50,0xB8,0x34,0x40,0x84,0xC0,0x30,0x03,0xD0,0x30,0xD0,0x33,0xB3,0x80,0x80,0x36,0xC0,0x0C,0x43,0xBB,0x43,0xCB,0x33,0x80,0xD0,0x80,0x80,0x08,0x08,0x87,0xC0,
+0x80,0x84,0x84,0x0F,0x28,0x88,0x0A,0x38,0x00,0x0D,0x8B,0x08,0x80,0x80,0x80,0x00,0xF0,0x09,0x80,0x0E,0x03,0x0D,0x08,0xC8,0x3B,0x80,0x0D,0x08,0xD8,0x80,0x8C,0x80,
+0x50,0x08,0xD8,0x30,0x80,0x80,0x0E,0x0C,0xC0,0x80,0x30,0xF0,0xA9,0x83,0x80,0x80,0x08,0x05,0xBD,0x30,0x04,0x08,0x88,0x50,0x80,0xD0,0x08,0x08,0x68,0x08,0x3C,0x00,
+0x88,0x80,0x80,0x90,0x17,0x08,0xE8,0x43,0x38,0x0B,0x0D,0x38,0x04,0x0C,0x03,0x08,0x08,0x08,0x87,0xC0,0x80,0x34,0xC0,0x30,0x84,0x8B,0x8C,0x40,0x80,0xD0,0x30,0x80,
+0x04,0x34,0x0B,0x08,0x0E,0x43,0x38,0x04,0x08,0x84,0x84,0xC0,0x80,0x40,0xC0,0x43,0x3B,0x03,0x8C,0x80,0x80,0x86,0x80,0x00,0x68,0xB8,0x03,0x80,0x80,0x07,0x03,0x88,
+0xBD,0x08,0x58,0xC0,0x03,0x58,0x08,0x0C,0x80,0x80,0x08,0x08,0x87,0xC0,0x03,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0xA7,0x08,0x08,0x86,0x8B,0x35,0xCB,0x43,0xBB,
+0xC3,0xBB,0x03,0x0D,0x03,0x3D,0x80,0x80,0xD8,0x03,0x8C,0x80,0x80,0x60,0x08,0x08,0x8D,0xB4,0x08,0xD8,0x03,0x08,0x0D,0x08,0x04,0x0C,0x48,0x8B,0x08,0x3D,0x00,0x88,
+0x3D,0x40,0x80,0x0C,0x08,0x08,0x0E,0x03,0x0D,0x38,0x00,0x0D,0x03,0x88,0x0D,0x03,0x0D,0x03,0xBD,0xC0,0x00,0x08,0x84,0x80,0x80,0x80,0x70,0x80,0xCC,0x30,0x8B,0x00,
+0x08,0x08,0xF8,0x59,0xB8,0x3B,0x80,0xE0,0x3B,0x80,0xD0,0x3C,0x03,0x0C,0x07,0xA8,0x00,0xB8,0x8B,0xB4,0xC8,0x00,0x03,0x08,0xE8,0x03,0xCC,0x33,0xC0,0x00,0xC3,0x08,
+0x58,0x08,0x08,0x0D,0x03,0xBD,0x00,0xC8,0x3C,0x03,0xD0,0x83,0xC0,0x80,0x34,0x80,0x80,0xBD,0x0C,0x08,0x88,0x80,0x80,0xCF,0x33,0xC0,0x00,0x08,0xBD,0x03,0x08,0x08,
+0x78,0x03,0x3C,0x00,0x88,0x80,0x0E,0x48,0x8B,0xD0,0x80,0x40,0x80,0x8C,0x84,0xC0,0x03,0x3C,0x04,0xCB,0x80,0xB3,0x80,0x05,0x08,0xBD,0x03,0x58,0xB8,0xC3,0x80,0x80,
+0xE0,0x03,0x08,0xD0,0xB3,0x58,0xB8,0x58,0x38,0x00,0x84,0x8B,0xD0,0x08,0xD8,0x30,0xB4,0x0C,0x48,0x08,0x03,0x0D,0x83,0xDB,0x03,0x08,0xF8,0x09,0x88,0x03,0xB4,0xBC,
+0x80,0x80,0x80,0x60,0xB8,0x58,0x08,0x53,0x0B,0x03,0xD8,0x03,0x08,0xD0,0x08,0x04,0x08,0xD8,0x03,0xB4,0xEC,0x28,0xB0,0x00,0x03,0x03,0x0D,0x03,0x3D,0x08,0x03,0x80,
+0xBE,0x30,0xCC,0x33,0xC0,0x00,0x03,0xB4,0x1F,0xA4,0x29,0x22,0xEB,0x21,0xA0,0x0B,0x83,0x80,0x0D,0x43,0x08,0x0C,0x43,0x08,0x08,0x3D,0x00,0x88,0xE0,0x30,0x80,0x58,
+0xC0,0x80,0x80,0x44,0x08,0x08,0x85,0xC0,0x1E,0xA0,0x3A,0x08,0x48,0xB8,0x03,0x0D,0xC3,0x0B,0x58,0x83,0x80,0x7C,0x01,0x08,0x8A,0xF0,0x10,0x91,0x28,0xE0,0x28,0x01,
+0xB0,0x30,0xF3,0x2A,0xAA,0x30,0xB8,0x58,0x0B,0x48,0x83,0xB4,0x08,0x88,0x05,0xC8,0x48,0x08,0x08,0xD0,0x08,0x08,0x8D,0x40,0x03,0xD0,0x80,0xD0,0x33,0x80,0xD0,0x30,
+0x84,0x43,0xC0,0x80,0x24,0x00,0x03,0xBD,0x08,0x04,0x08,0x08,0x0E,0x87,0x89,0x20,0x80,0x80,0xB4,0x88,0xD0,0x0B,0x48,0x84,0x80,0x80,0xD8,0x8B,0x80,0x0D,0x03,0x04,
+0x58,0x8B,0xBC,0x30,0x0C,0xC8,0x48,0x48,0x08,0x03,0x84,0x8B,0x80,0x0E,0x08,0x58,0xB3,0x43,0x8B,0x00,0xC5,0x3A,0x08,0x34,0xC0,0x08,0xD8,0xC0,0x30,0x8B,0x85,0x43,
+0x08,0xB3,0xD8,0x80,0x8B,0x80,0x80,0x80,0x17,0x08,0x85,0xD0,0xB0,0x03,0xD8,0x80,0xB4,0x0C,0x08,0x03,0x0D,0x48,0xB8,0x08,0x58,0x80,0xCC,0xBA,0x33,0x50,0xCB,0x33,
+0x80,0x85,0xC0,0x8A,0x30,0x80,0x80,0x70,0x8B,0x0C,0x80,0x04,0x08,0x85,0x84,0xC0,0x33,0x80,0x35,0xCB,0x80,0x8B,0x80,0x80,0x80,0x70,0x41,0xB8,0x08,0x08,0x08,0x8F,
+0x84,0xC0,0x03,0x03,0x80,0x80,0x80,0x00,0x70,0xD1,0x80,0x80,0x00,0x08,0xC6,0xB0,0x3C,0xB3,0x80,0x58,0x30,0x80,0x80,0x0E,0xC8,0x08,0x08,0x8D,0x84,0x30,0xD0,0x80,
+0x80,0x70,0x01,0x38,0xC0,0xBB,0xBC,0x43,0xCB,0x03,0x08,0x48,0x8B,0x85,0x8B,0x0C,0x08,0x04,0x08,0x85,0x80,0x0D,0x08,0x34,0xC0,0xB8,0x08,0x3D,0xDB,0x0B,0x8B,0x80,
+0x0D,0x48,0x80,0x0C,0xC3,0xB8,0x34,0x00,0x08,0x05,0x08,0x68,0x08,0x08,0x0D,0x03,0x08,0x85,0x40,0x80,0x3C,0x80,0x50,0xB8,0x0D,0x3B,0x84,0x03,0x80,0x80,0x80,0x07,
+0x08,0x0D,0xAC,0xCB,0x33,0x30,0xD0,0x80,0xD0,0x80,0xC0,0x0F,0x0A,0x08,0x08,0x80,0x80,0x8C,0xB4,0x08,0x88,0xE0,0xC0,0x80,0x30,0x00,0x08,0x0F,0x03,0x48,0x80,0x0C,
+0x08,0x08,0xB5,0x34,0x04,0x08,0x34,0x80,0x1F,0x82,0x80,0x03,0x40,0x40,0x80,0x80,0x0D,0x48,0x8B,0x00,0x08,0x86,0x80,0x80,0xF0,0x30,0x80,0x80,0x0D,0xC8,0x0C,0x80,
+0x0C,0x03,0x80,0xBD,0x08,0xBD,0x48,0xB8,0x08,0x0D,0x0C,0xC0,0x80,0x8B,0x0C,0x08,0xD8,0x80,0x40,0xDB,0x80,0x80,0xBC,0x08,0x0D,0x08,0x84,0x40,0x8B,0x40,0x8B,0x3D,
+0x00,0x88,0x50,0x80,0x80,0x80,0x07,0x48,0x08,0x43,0xC0,0x03,0x84,0x03,0x40,0x84,0x30,0x85,0x80,0xB4,0x48,0x38,0x34,0x30,0x00,0x85,0x80,0x35,0x03,0x40,0x80,0x80,
+0x3E,0x00,0x88,0x05,0x08,0x0D,0x08,0x0D,0xB8,0x48,0x80,0xD0,0x80,0x8B,0x50,0xAC,0x08,0xC8,0xB8,0x0D,0xB8,0xC8,0xB3,0x8C,0xDB,0x80,0x8B,0x00,0x9F,0xB8,0x80,0xDB,
+0x0B,0x80,0x8C,0x8B,0x80,0x0E,0x08,0x08,0xCD,0x00,0xC8,0x0B,0x08,0x3D,0x00,0x88,0x80,0x80,0x70,0xB5,0x30,0xAC,0x08,0x48,0x84,0x80,0x84,0x80,0x04,0x03,0x50,0x08,
+0xB4,0x48,0x80,0x85,0x43,0x08,0x03,0x34,0x04,0x08,0x48,0x84,0x80,0x50,0x33,0xC0,0x78,0x12,0x32,0xB2,0x0E,0x01,0x38,0x83,0x54,0x80,0xB0,0x0B,0x80,0x40,0x34,0x80,
+0x44,0x02,0x80,0xCC,0xBA,0x83,0x85,0x80,0xB4,0x0C,0xB8,0x58,0xB8,0x8B,0xD0,0x03,0x08,0xD0,0xAC,0x08,0x08,0xBD,0xB8,0xD8,0x30,0xD0,0x3B,0xB0,0xBD,0xBB,0x0C,0xB8,
+0x08,0xE8,0x80,0x80,0xD0,0x43,0xFB,0x11,0xC9,0x28,0xAA,0x0B,0x08,0x3C,0xB4,0x30,0xF0,0x81,0xBA,0x0B,0x30,0x80,0x0D,0x08,0x04,0x08,0x85,0xDB,0x80,0x30,0x00,0x8D,
+0x40,0x30,0x8C,0x84,0x80,0x85,0x43,0x08,0xB8,0x08,0x85,0x80,0x80,0x36,0x80,0x8C,0x84,0x80,0x85,0x43,0x33,0x08,0x08,0x8D,0x84,0x80,0x50,0x48,0x02,0x80,0x40,0x34,
+0x8B,0x04,0x03,0x80,0x36,0x80,0x80,0x50,0x80,0x50,0x08,0x04,0xC8,0xB8,0x08,0x08,0x78,0x80,0x80,0x44,0x03,0xC8,0x08,0x08,0x85,0xD0,0xB0,0x08,0x88,0x80,0x70,0x08,
+0xC8,0x3B,0x04,0x08,0x80,0x86,0xB4,0x8B,0x0C,0x80,0x80,0x50,0x84,0xC0,0x80,0x40,0x80,0x8C,0x8B,0x80,0xF0,0x80,0x84,0x80,0x0C,0x80,0x80,0xE0,0x80,0x0C,0xB3,0x80,
+0x80,0x3E,0x00,0xD8,0x80,0x8C,0x80,0xD0,0xB8,0x08,0xE8,0x80,0x80,0x0D,0x0C,0xB3,0xC8,0x80,0x80,0x80,0xF0,0x8B,0x84,0x80,0xB4,0x08,0xD0,0x0C,0xB3,0x08,0xD0,0x08,
+0xD8,0x80,0x80,0x0D,0x08,0x08,0x08,0x08,0xF8,0xC9,0x80,0x80,0x80,0x0E,0x08,0x58,0x80,0x80,0x80,0x80,0x90,0x00,0x17,0x08,0x08,0x78,0x30,0x80,0x58,0xC0,0x80,0xB4,
+0x83,0x00,0x08,0x08,0x07,0x48,0x84,0x30,0x80,0x08,0x08,0xF8,0x08,0x58,0x08,0x08,0x85,0x84,0x80,0x80,0x04,0x3D,0x80,0x80,0x08,0x05,0x0D,0x03,0x43,0x80,0x00,0xC5,
+0x30,0x80,0xD0,0x30,0xD0,0x80,0x24,0x0B,0x58,0xBB,0x48,0x08,0x58,0xE8,0x28,0x80,0x80,0x0B,0x08,0x44,0xCB,0x03,0xC8,0x0B,0x03,0x80,0xBE,0x3B,0x80,0x80,0x80,0xF0,
+0x09,0xD8,0x43,0xB3,0x08,0xD0,0x03,0x08,0x8D,0x8B,0x0D,0x08,0xD8,0x0B,0x43,0x80,0x85,0x80,0x8B,0xD0,0x3C,0xC0,0x8A,0x03,0x8C,0x4B,0x80,0x40,0x8B,0x80,0x3E,0x00,
+0x0D,0x38,0x00,0x08,0x08,0x8F,0xC0,0x80,0x40,0x80,0xD0,0x80,0x84,0x03,0xD0,0x80,0x84,0xC0,0x8B,0x80,0x80,0x80,0x37,0x8B,0x00,0x85,0x8B,0x85,0xC0,0x80,0xD0,0x80,
+0xC0,0x80,0x34,0xC0,0x80,0x40,0xB8,0x08,0x08,0x08,0x8F,0x84,0x80,0x80,0xE0,0x80,0x80,0x0D,0x08,0x88,0x80,0xF0,0x3B,0x40,0xDC,0x08,0x08,0x83,0x03,0x3C,0xD0,0x30,
+0xC0,0x8B,0xB4,0x48,0x8B,0x58,0x08,0x08,0x04,0x08,0xD8,0x03,0x80,0x80,0x06,0x08,0x58,0x30,0x80,0x0D,0x08,0x08,0x08,0xF8,0x08,0x07,0x29,0x38,0x33,0x00,0x3D,0x84,
+0xC0,0x80,0x80,0xD0,0x80,0x84,0xC0,0x30,0x34,0x80,0x80,0x50,0xDB,0x03,0xC3,0x4B,0x38,0x84,0x80,0xD0,0x33,0x8B,0x80,0x0D,0x08,0x08,0x08,0x78,0xC0,0xC0,0x33,0x00,
+0xD8,0x80,0x80,0x08,0x08,0x08,0xF9,0x52,0x08,0x08,0x08,0xE8,0x80,0xD0,0x80,0x84,0x8B,0x80,0x80,0x80,0x0F,0x08,0x88,0xE0,0x30,0xD0,0x80,0x80,0x80,0x0D,0xC3,0x48,
+0x08,0x3C,0x00,0x88,0x0D,0x03,0xD8,0x80,0x40,0x80,0xBD,0x8B,0x04,0x08,0x0D,0x43,0x8B,0x80,0x0D,0x48,0x08,0x3C,0x30,0x00,0x08,0x86,0x8B,0x50,0x08,0xD8,0x80,0x80,
+0xD0,0x08,0xD8,0x03,0xD0,0x80,0xB3,0x8C,0x80,0x50,0x08,0x08,0x68,0x08,0x0C,0x48,0x08,0x03,0x80,0x60,0x08,0xD8,0x80,0x80,0x80,0x0E,0x43,0x08,0x08,0xD0,0x08,0x08,
+0xE8,0x30,0x80,0x80,0x86,0x84,0x8B,0x40,0x80,0x80,0x05,0x08,0x08,0x05,0x3D,0x80,0xB4,0x88,0x85,0xC0,0x00,0x08,0x88,0x80,0x80,0x47,0xB8,0x48,0x8B,0x80,0x08,0xBE,
+0x48,0x08,0xC8,0x03,0x80,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0xF0,0x59,0xB8,0x80,0x80,0x05,0x08,0x08,0x08,0x78,0x80,0x85,0x80,0x80,0x80,0x80,0x0F,0x08,0x88,
+0x80,0x80,0x90,0xA7,0x08,0x08,0x08,0x8F,0x40,0x03,0x08,0x68,0x03,0x0C,0x08,0xD8,0xC0,0x03,0x0C,0x48,0x38,0x8B,0x50,0xB8,0x08,0x80,0x80,0x80,0x70,0xD1,0x80,0x80,
+0x00,0x08,0x86,0x80,0x80,0x80,0x80,0x9F,0x85,0xC0,0x00,0x48,0x8B,0xC8,0x80,0x80,0x80,0x70,0x08,0x58,0x38,0x00,0x0D,0x08,0x08,0x08,0x08,0x08,0xF9,0x09,0x0D,0xB3,
+0x08,0x08,0x08,0x3F,0x80,0x0D,0x0C,0x08,0x08,0xB5,0x08,0x34,0xD0,0x30,0x80,0x80,0x0D,0x08,0x08,0x08,0xB7,0xC8,0x00,0xBC,0x3C,0x80,0x34,0x30,0x04,0x08,0x50,0x0C,
+0xCB,0xBA,0x0C,0x08,0x48,0x37,0x14,0x21,0x88,0xDA,0xAD,0xCB,0x9A,0xA9,0x20,0x08,0x02,0xB3,0xAF,0xCA,0xCB,0x9B,0x01,0x32,0x67,0x24,0x44,0x43,0x32,0x23,0x13,0x01,
+0xA9,0xBD,0xCD,0xBC,0xAC,0xBC,0xBA,0xBB,0xBB,0xAA,0x99,0x18,0x31,0x54,0x43,0x44,0x33,0x34,0x33,0x34,0x43,0x32,0x43,0x22,0x21,0x23,0x01,0x80,0x99,0xCC,0xDA,0xBB,
+0xBD,0xBC,0xCB,0xCB,0xBA,0xCB,0xBB,0xBB,0xCB,0xBA,0x89,0x9B,0x89,0x89,0x8A,0x0B,0x48,0x48,0x02,0x73,0x22,0x51,0x43,0x11,0x43,0x53,0x32,0x43,0x24,0x32,0x41,0x23,
+0x43,0x51,0x22,0x32,0x33,0x22,0x15,0x12,0x32,0x38,0x33,0x80,0x80,0x0E,0x0C,0xCB,0xBA,0x0C,0xFB,0x9A,0xAA,0xBD,0xC9,0xDB,0x9A,0xBB,0xAC,0xCB,0xCB,0xAB,0xBA,0xBC,
+0xC9,0xA9,0x9C,0xA9,0xAA,0xBB,0xC0,0x30,0x80,0x0C,0x03,0x04,0x08,0x68,0x48,0x02,0x03,0x44,0x32,0x34,0x33,0x00,0x44,0x33,0x34,0x24,0x43,0x33,0x30,0x74,0x82,0x22,
+0x22,0x30,0x43,0x03,0x03,0x35,0x80,0x04,0x03,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0xF0,0x09,0xD0,0x08,0x04,0x08,0xD8,0x80,0x8C,0x80,0x50,0xB8,0x08,0x08,0x08,0xCF,
+0x80,0x80,0x00,0x8D,0xD0,0x80,0x8B,0xBC,0xBC,0x0C,0x8B,0x80,0x0D,0xB8,0xD8,0xC0,0xB0,0x0C,0x8B,0xD0,0xB0,0xC8,0xBB,0xBC,0x80,0x8C,0x80,0x50,0x08,0x04,0x03,0x08,
+0x08,0x08,0x09,0x00,0x70,0x81,0x80,0x60,0x08,0x58,0xB8,0x0C,0xAC,0xCB,0x0B,0xAC,0x8B,0xC8,0x80,0x40,0x40,0x43,0x73,0x43,0x31,0x61,0x22,0x31,0x13,0x42,0x32,0x15,
+0x21,0x28,0x02,0x83,0x30,0x80,0x50,0xD0,0x0B,0x8B,0xCC,0xBA,0xBC,0xBB,0xC8,0x0C,0xCB,0x8A,0xC0,0x8B,0x8B,0x80,0x80,0x07,0x08,0x88,0x80,0x80,0x90,0x00,0x70,0x81,
+0x85,0x30,0x50,0x48,0x08,0x43,0x38,0x00,0x08,0x68,0x80,0x40,0x80,0x80,0xF0,0x80,0x80,0x3C,0x00,0xD8,0x80,0x8C,0x80,0xBD,0xCB,0xC0,0xB0,0x0C,0xCB,0xB0,0xC8,0xB0,
+0xC8,0x0C,0xCB,0xBA,0x0C,0xCB,0xBB,0xCB,0x8B,0x8B,0x80,0xF0,0x80,0xC0,0xC0,0x00,0x08,0x88,0x80,0x80,0x07,0x08,0x80,0x86,0x84,0x43,0x32,0x40,0x03,0x03,0x08,0x45,
+0x03,0x03,0x04,0x58,0x48,0x38,0x80,0x35,0x83,0x84,0x30,0x00,0x08,0x78,0x03,0x58,0x38,0x40,0x08,0x08,0x08,0x08,0x08,0x17,0x84,0x80,0x85,0x30,0x00,0x68,0x03,0x03,
+0x08,0x0E,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x17,0x0D,0x08,0x58,0xB8,0x80,0x04,0x08,0x0D,0x0C,0x80,0x80,0xD8,0x30,0xD0,0x80,0x80,0x0D,0xC8,0x00,0x0C,0x0C,0x08,
+0xC8,0x8B,0x80,0x80,0x0E,0x08,0xD8,0xC0,0x8B,0x80,0xD0,0x08,0x08,0x08,0x0F,0x08,0x08,0xD0,0xB8,0x08,0x85,0x80,0xD0,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0xF0,
+0x09,0x80,0x86,0x80,0x00,0x08,0x08,0x08,0xF0,0x09,0x80,0x86,0x80,0x00,0xE8,0x80,0x40,0xC0,0x30,0x80,0x08,0x08,0x8F,0x84,0x80,0x80,0x08,0x08,0x08,0x09,0xF0,0x59,
+0x08,0x48,0xB8,0x08,0x80,0x80,0x0F,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x78,0x81,0x85,0x80,0x85,0x30,0x80,0xD0,0x48,0x08,
+0x08,0x50,0x08,0x08,0x08,0x08,0x08,0x70,0x41,0xC0,0x80,0x80,0x08,0x3E,0x80,0x00,0x08,0x86,0x8B,0xD0,0x08,0x58,0x08,0x08,0x80,0x80,0x0F,0x03,0x0D,0x38,0x00,0x0D,
+0xC3,0x00,0x48,0x80,0x00,0x85,0x80,0x80,0x80,0xF0,0x08,0x88,0x80,0x70,0x08,0x08,0x80,0x80,0x70,0xC0,0x80,0x80,0xD8,0x80,0x80,0xE0,0x80,0x80,0x08,0x68,0x8B,0xD0,
+0x80,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x07,0x08,0x08,0x08,0xF8,0x08,0x08,0xE8,0x80,0x80,0x80,0x80,0x80,0x00,
+0x00,0x9F,0x00,0x08,0x08,0xF8,0x09,0x80,0x80,0x80,0x00,0x9F,0x00,0x08,0x08,0x08,0x70,0x81,0x80,0x60,0xB8,0xD8,0x80,0x80,0x50,0x08,0x58,0x8B,0xB4,0x88,0x0C,0x08,
+0x04,0x58,0x08,0x08,0x80,0x80,0x0F,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x86,0x80,
+0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x9F,0x00,0xE8,0x80,0x80,0x85,0x80,0x00,0x08,0xF8,0x80,0x80,0x08,0x08,0x08,0x17,0x88,0x80,0x06,0x08,0x08,0x08,0x08,0x09,0x00,
+0x00,0x17,0x08,0x08,0x08,0x78,0x81,0x80,0x80,0x70,0x80,0x80,0x80,0x3E,0x00,0x08,0x08,0x08,0x09,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0xF0,0x59,0x08,0x08,
+0x08,0x68,0x08,0x08,0x80,0x80,0x80,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x59,0x08,0x08,0x08,0x08,0x08,0x08,0x9F,0x00,0x08,0x08,0x08,
+0x00,0x00,0x00,0x00,0xA7,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x86,0xD0,0xB3,0x08,0x08,0x08,0xF8,0x03,
+0x08,0x80,0x80,0x70,0x80,0xD0,0x80,0x80,0x08,0x08,0x3F,0x80,0x8C,0x84,0x80,0x00,0xE8,0x80,0x40,0x80,0x8C,0x80,0x80,0x86,0x80,0x00,0x08,0x0F,0x08,0x08,0x80,0x80,
+0x0F,0x08,0x88,0x80,0x70,0x08,0x08,0x0D,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x70,0xD1,0x80,0x80,0x85,0x80,0x80,0x80,0x80,
+0x3F,0xC0,0x80,0x80,0x50,0x08,0x0D,0x08,0x08,0x80,0x60,0x08,0x0D,0x08,0x03,0x0D,0x03,0x08,0x08,0x86,0xD0,0x30,0x80,0x80,0x80,0x0E,0x08,0x08,0x08,0x08,0x09,0x00,
+0x17,0x0D,0x03,0x08,0x3D,0xC0,0x30,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x9F,0x00,0x08,0x78,0xC0,0x80,0x84,0x8B,0x40,0x80,0x80,0x0D,0x08,0x08,0x08,0x8F,0x80,0x00,
+0x08,0x08,0x08,0x00,0x00,0x2F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0xF0,0x80,0x80,0x00,0x8D,0x80,0x80,
+0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x08,0x08,0x08,0x08,0x00,0x00,0x9F,0x00,0x85,0x80,0x80,0x86,0x80,0x00,0x08,0x08,0x08,0x00,0x9F,0x00,0x08,
+0x08,0x08,0x17,0x0D,0x08,0xC3,0x80,0x80,0x50,0x80,0x0D,0x08,0x0D,0x08,0x08,0x80,0x60,0x08,0x08,0x68,0x3B,0x80,0x0D,0x08,0xD8,0x80,0x80,0xB4,0x08,0x08,0x08,0x08,
+0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x9F,0x50,0x08,0x08,0x0D,0x08,0x08,0x08,0x08,0x08,0x9F,0x00,0x68,0xB8,0x08,0x80,0x86,0x80,0x00,0x08,0x08,
+0x8F,0x80,0x58,0x80,0x8C,0x40,0x80,0x8C,0x40,0x8B,0x80,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x9F,0x00,0x85,0x80,0x80,0x80,0x80,
+0x00,0x00,0x00,0x00,0xF0,0x09,0x85,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0xF0,0x09,0x80,0xB6,0x03,0x88,0x80,
+0x70,0x8B,0x80,0x08,0x08,0x3F,0xC0,0x80,0x80,0x58,0x80,0x80,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x2F,0x00,0x08,0x08,
+0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x78,0x81,0x80,0x80,0x70,0x80,0x80,0x80,0x80,0x90,0x00,
+0xF0,0x09,0xB5,0x08,0x84,0x80,0x80,0x80,0x80,0x00,0xF0,0x09,0xB5,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0x9F,0x50,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,
+0xF0,0x02,0x80,0x80,0x80,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x9F,0x00,0x68,0xB8,0x08,0xB5,0x08,0x88,0x80,0x80,0x90,0x00,0x9F,0x00,0x08,0x08,0x07,0x08,0x0D,
+0x08,0x88,0x50,0x80,0x80,0xF0,0x80,0x84,0x8B,0x80,0xB5,0x08,0x88,0x80,0x80,0x90,0x17,0x0D,0x08,0x58,0x08,0x08,0x08,0x8D,0x80,0x80,0x80,0x07,0x08,0x88,0xE0,0x30,
+0x3C,0x00,0x08,0x08,0xF8,0x03,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x8F,0x84,0x80,0x8C,0x84,0x80,0x00,0x08,0x08,0x08,0x2F,0x00,0x8D,0x84,
+0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x70,0xD1,0x03,0x08,0xD8,0x80,0x80,0x08,0x08,0x08,0x17,0x88,0x80,0x80,0x90,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x41,0x80,0x8C,0x40,0x80,0xD0,0x80,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,
+0x80,0x00,0x00,0x00,0xA7,0x08,0x08,0x08,0x78,0x81,0x80,0x80,0xF0,0x03,0x88,0x80,0x3E,0xC0,0x08,0x08,0x08,0x08,0x08,0x17,0x08,0xE8,0x80,0x84,0x80,0x0C,0x08,0x08,
+0x08,0x08,0x09,0xF0,0x59,0x3B,0x80,0x3C,0xC0,0x08,0x08,0x08,0x08,0x07,0x08,0xD8,0x03,0x80,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x70,0xD1,0x03,0x0C,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,
+0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x07,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x2F,0x0C,0x08,0x3D,0x80,0x00,0x08,0x08,0xF8,0x02,0x80,0x80,0x0F,
+0x08,0xD8,0x80,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x3D,0x80,0x0C,0x80,0x80,0x80,0x80,0x90,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x17,
+0x08,0x68,0xB8,0x03,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xC2,0x80,0x80,0xE0,0x80,0x80,
+0x08,0x08,0x08,0x09,0x9F,0x00,0x08,0x08,0x08,0x00,0x2F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,
+0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x17,0x08,0x08,0x08,0x07,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0x70,0x81,0x80,0x80,0x70,0x80,0x80,0x80,0x80,0x90,0x00,
+0x00,0x9F,0x00,0xE8,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0xF0,
+0x02,0x0D,0x08,0x08,0x08,0x08,0x08,0x70,0x81,0x80,0x60,0x08,0x08,0xE8,0x80,0x40,0x80,0x80,0x80,0x80,0x90,0x00,0x70,0x81,0x80,0x80,0x80,0x70,0x81,0x80,0x86,0x80,
+0xD0,0x80,0x80,0x50,0x08,0x58,0x08,0x08,0x50,0x08,0x08,0x08,0x08,0x08,0x00,0x70,0x81,0x80,0x80,0x0F,0x03,0x88,0x80,0x80,0x07,0x0C,0x08,0x08,0x08,0x0F,0x03,0x0C,
+0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x0E,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x9F,0x85,0x80,0xD0,0x03,0xC8,0x00,0xC8,0x08,0x08,
+0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x8A,0x80,0x86,0xC0,0x30,0x80,0x80,0x80,0x80,0x00,0x00,0x00,
+0x00,0x00,0x9F,0x00,0x85,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x0D,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0xF0,0x09,0x80,0x80,0x70,0x8B,
+0x80,0x05,0x08,0x08,0x08,0x08,0xF9,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x17,0xD8,0x80,0x80,0x0D,0x08,0x08,0x08,0x08,0x08,0x9F,0x85,0x80,0x8B,0x80,0x80,0x80,
+0x00,0x00,0x70,0x81,0x0D,0x08,0x08,0x08,0x86,0xD0,0x03,0x08,0x88,0x80,0xF0,0x48,0x8B,0x80,0x00,0x68,0x08,0x03,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x70,0x81,0xD0,0x08,0x08,0x08,0x86,0x80,0x80,0x80,0x80,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0xF0,0x09,0x50,0x08,0x08,0x68,0xB8,0x08,0x80,0x80,
+0x80,0xF0,0x09,0x80,0x86,0x80,0x0C,0x08,0x08,0x08,0x78,0xC0,0x80,0x80,0x80,0x60,0xB8,0x08,0x08,0x08,0x8F,0x80,0x08,0x08,0x08,0x09,0x00,0x70,0x81,0x80,0x80,0x0F,
+0x08,0x88,0x0D,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xD8,0x80,0x80,0x50,0x08,0x08,0x08,0x08,
+0xF8,0x59,0x08,0x08,0x08,0x85,0xD0,0x80,0x84,0x80,0xD0,0x80,0x80,0x80,0x80,0x06,0x08,0x08,0x08,0xF8,0x08,0x04,0x08,0xD8,0x80,0x40,0x80,0x50,0xB8,0x08,0x08,0x08,
+0x08,0x00,0x17,0x0D,0x03,0x08,0xD8,0x80,0x80,0x80,0x80,0x70,0x81,0x08,0x08,0x08,0x09,0x00,0x00,0x17,0xD8,0x80,0x80,0x80,0x80,0x80,0x00,0xA7,0x08,0x68,0x08,0x08,
+0x80,0x80,0x0F,0x08,0x88,0x80,0x80,0xB7,0x08,0x0D,0x48,0x08,0x08,0x80,0xF0,0x80,0x30,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xD1,0x30,0xC0,
+0x80,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x2F,0x0C,0x08,0x58,0x80,0x80,0x80,0x80,0x90,0x00,0x17,0x08,0x08,0xF8,0x80,0x80,0x08,0xE8,0x80,0x04,0x08,0x80,0x60,
+0x08,0xD8,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xD1,0x30,0x80,0x80,0x80,0x70,0x08,0x08,0x0D,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,
+0x70,0x81,0x0D,0x08,0x08,0x08,0xF8,0x80,0x84,0x8B,0x80,0x05,0x08,0x08,0xE8,0x80,0x80,0x80,0x80,0x07,0xC8,0x80,0x40,0x80,0x80,0x80,0x80,0x9F,0x00,0x08,0x78,0x80,
+0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x9F,0x00,0x08,0x08,0x78,0x81,0x80,0x80,0x80,0x00,0xA7,0x08,0x08,0xF8,0x80,0x40,0x08,0x08,0x08,0x08,0x08,0x9F,0x00,0x08,0x08,
+0xF8,0x02,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x0D,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0xF0,0x03,0x88,0x80,0x80,0x90,
+0x00,0x00,0x00,0x00,0xF0,0x59,0x08,0xB8,0x04,0x08,0x0D,0x03,0x0D,0x08,0x03,0x0D,0x48,0xB8,0x48,0xC0,0x30,0x80,0x0D,0x08,0x08,0x08,0x78,0x80,0xBC,0x84,0xC0,0x80,
+0x84,0x8B,0x84,0x80,0x00,0x08,0x08,0x78,0x81,0xD0,0x03,0x0D,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x0D,0x03,0x08,0x8D,0x80,0xD0,
+0x48,0xB8,0x58,0x08,0x08,0x08,0x68,0x3B,0xD0,0x80,0x80,0x80,0x80,0x80,0xF0,0x09,0x04,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x08,
+0x08,0x08,0x08,0x70,0x81,0x0D,0xB3,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x02,0x80,0x80,0x80,0xF0,0x02,0x80,0x80,0x80,0x00,0x00,
+0x9F,0x00,0x08,0x78,0xC0,0x80,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x17,0xD8,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x8A,0x50,0xB8,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xD1,0x80,0x80,0x00,0x08,0x08,0x08,0x17,0x08,0x08,0x08,0x08,0xF0,0x02,0x80,0x80,0x80,0x9F,0x50,0x08,0x08,0x80,
+0x80,0x80,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x07,0x08,0x88,0x80,0x80,0x90,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x17,0x08,0x08,0x0F,0x48,0x08,0x08,0x88,0x80,
+0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x0D,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x70,0x8A,0x50,
+0x08,0x0D,0x08,0x3C,0x00,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x02,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x60,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x70,0x81,0x3D,0xC0,0x00,0x08,0xB4,0x08,0xC5,0x00,0x08,0x88,0x80,0x80,0x90,0x00,0x70,0x81,0x3D,0x00,0x0D,0x08,0x08,0x08,0x08,0x08,0x09,0x00,0x00,
+0x00,0x00,0x17,0x08,0x08,0x0F,0x08,0x08,0x80,0x60,0x08,0x08,0x08,0x0F,0x08,0x08,0x85,0x80,0xD0,0x80,0x80,0x50,0x08,0x08,0xE8,0x80,0x80,0x50,0x08,0x08,0x08,0x08,
+0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x70,0x80,0x80,0x80,0xF0,0x08,0x03,0x80,0x80,0x80,0x00,0x9F,0x85,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0x00,0x08,0x08,0x08,0x00,0x00,0xF0,0x09,0x80,0x60,0x0C,0x80,0x80,0x04,0x08,0x08,0x08,0x8F,0x84,0x80,0x80,
+0x80,0x80,0x90,0x00,0x00,0x2F,0x0C,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x85,0x80,0x0C,0x08,0x08,0x08,0x08,0x09,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x0F,0x08,0x88,0x80,0x80,0x90,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x70,0x81,0xD0,0x08,0x58,0x8B,0x84,0xC0,0x80,0x80,0x08,0x08,0x08,0x09,0x00,0x17,0x0D,0x08,0x08,0x50,0x08,0x08,0x08,0x08,0x08,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x08,0x08,0x86,0x80,0x80,
+0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x07,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x85,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x17,0xD8,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x70,0xD1,0x30,0x8B,0x80,0x80,0x80,0x90,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0xF0,0x80,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0xF0,0x09,0x85,0x80,0xD0,0x80,0x80,0x50,0x08,0x08,0x08,0xF8,0x80,0x80,0x08,0x05,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,
+0x08,0x70,0x81,0x80,0x80,0x80,0xF0,0x59,0x08,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0xB7,0x03,0x08,0x08,0x08,0x09,0xF0,0x02,
+0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x02,0x80,0x0E,0x03,0x08,0x8D,0x80,0x80,0x80,0x80,0xA7,0x08,0x08,0x08,0x08,0x00,0x17,0x08,
+0x8D,0x80,0x80,0x80,0x07,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x08,0x08,0x08,0xB7,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0xE8,0x80,0x80,0x80,0x80,0x70,0x80,0xD0,0x80,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x70,0x81,0x80,0x0E,0x08,0x58,0x08,0x08,0x0D,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x70,0x8A,0x85,0x80,0x0C,0x03,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x50,0x08,0x0C,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x85,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x85,0x80,0x8B,0x80,0x86,0xC0,0x80,
+0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x08,0x08,
+0x08,0xB7,0x08,0x04,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x3D,0x80,0x80,0x08,
+0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x9F,0x85,0x80,0xD0,0x80,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x70,0x81,0x80,0xF0,0x80,0x80,0x00,0x08,0x08,0x78,0x81,0x80,0xF0,0x30,0x80,0x80,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x8A,0x85,0x3B,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x85,0x80,0xD0,0x48,0x08,0x08,0x80,0x80,0xF0,0x08,0x88,0x80,0x80,0x70,0x5B,0x80,0xC0,0x80,0x80,0x08,
+0x08,0x08,0x79,0x81,0x80,0x80,0x80,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0xA7,0x58,0x08,0xC8,0x30,0x80,0x80,0x80,0x90,0xF0,0x09,0xB5,0x03,0x88,0x80,0x80,0x90,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x85,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x70,0x8A,0x80,0x80,0x80,0x00,0x17,0x0D,0x08,0x08,0x80,0x80,0x80,0x9F,0x50,0x08,0x08,0x80,0x80,0x80,0x00,0x9F,0x00,0x85,0x80,0x80,0x80,0x80,0xF0,
+0x09,0x80,0x80,0x80,0x00,0x70,0x81,0x80,0x80,0x70,0x8B,0x8C,0x40,0x80,0x80,0x0D,0x03,0x08,0x68,0x80,0x8C,0x8B,0x50,0x03,0xD8,0x80,0x80,0xD0,0x03,0x08,0xE8,0x30,
+0xD0,0x03,0x03,0x88,0x0D,0x08,0x08,0x08,0x08,0x17,0xD8,0x80,0xBC,0x30,0x50,0x08,0x58,0xB8,0x80,0x40,0xDB,0x33,0xC0,0x30,0x80,0xED,0x21,0x20,0x02,0xC0,0x0B,0x80,
+0x8C,0x40,0x80,0x3C,0xD0,0x30,0x30,0xF0,0x2B,0x02,0x80,0xBC,0x24,0x00,0x08,0x9F,0x32,0xB3,0x0C,0x33,0x34,0x9F,0xAA,0x32,0x02,0xB8,0xF8,0x4B,0x86,0x80,0x99,0x80,
+0x80,0x80,0xB0,0x78,0xC2,0x89,0x22,0x22,0xEB,0x10,0xD0,0xA9,0x40,0x80,0x82,0xBA,0x43,0xB8,0xAF,0x22,0x31,0x08,0x8B,0x58,0x9E,0x28,0x08,0x02,0xB3,0x3C,0x27,0x08,
+0xA8,0x83,0x8B,0xF0,0x3D,0x81,0x93,0x0D,0x08,0x93,0x32,0xFB,0x80,0x30,0xBC,0xA4,0x74,0xF0,0x5F,0x26,0xFB,0x8F,0x32,0x24,0x98,0xBA,0xAB,0x99,0x89,0x08,0x31,0x45,
+0x32,0x33,0x12,0x01,0x98,0xB9,0xCB,0xBB,0xBC,0xAB,0xAA,0xDB,0xCC,0xAB,0x9A,0x18,0x11,0x12,0x01,0x99,0xA9,0xAA,0xBA,0x8A,0x63,0x44,0x44,0x43,0x34,0x34,0x24,0x43,
+0x22,0x43,0x32,0x23,0x33,0x23,0x23,0x11,0x10,0x01,0xA9,0xBD,0xA9,0xCB,0xBD,0xAA,0xCB,0xCC,0xBA,0xBD,0xBB,0xBC,0xCC,0xBB,0xDB,0xBB,0xBD,0xBB,0xBD,0xCA,0xAA,0xCB,
+0xBB,0xCA,0xCB,0xAB,0xBB,0xBB,0xAC,0xBB,0x9A,0xAA,0x9A,0xAA,0x08,0x31,0x63,0x33,0x73,0x36,0x22,0x43,0x34,0x43,0x43,0x32,0x34,0x34,0x24,0x33,0x53,0x33,0x33,0x35,
+0x32,0x43,0x32,0x53,0x32,0x31,0x33,0x33,0x34,0x33,0x43,0x22,0x21,0x23,0x22,0x64,0x12,0x01,0x08,0x99,0x89,0xA9,0xAD,0xBB,0xBB,0xAD,0xBC,0xCB,0x99,0xBA,0xBB,0xBC,
+0x9C,0x12,0x14,0x10,0x02,0xB8,0x03,0xB4,0xC8,0xFB,0xDB,0xBC,0xAF,0xBB,0xDB,0xBC,0xBC,0xCC,0xCA,0xAB,0xBC,0xCB,0xCB,0xBB,0xBC,0xCB,0xCB,0xBB,0xBB,0xAD,0xBB,0xCB,
+0xBB,0xBB,0xBC,0xBB,0xAC,0xBB,0xAB,0xAC,0xAA,0x9A,0xAB,0xA9,0x98,0x89,0x12,0x22,0x44,0x53,0x24,0x53,0x43,0x42,0x33,0x53,0x33,0x34,0x43,0x43,0x42,0x32,0x43,0x33,
+0x53,0x32,0x33,0x34,0x34,0x33,0x25,0x43,0x32,0x43,0x33,0x34,0x34,0x33,0x25,0x43,0x33,0x53,0x32,0x24,0x43,0x33,0x34,0x43,0x33,0x34,0x34,0x33,0x25,0x33,0x34,0x43,
+0x33,0x33,0x35,0x33,0x43,0x43,0x32,0x24,0x32,0x24,0x23,0x33,0x24,0x42,0x31,0x22,0x31,0x13,0x23,0x12,0x82,0x80,0xB0,0xBC,0xAE,0xDB,0xDA,0xBC,0xCA,0xDA,0xCB,0xB9,
+0x9D,0xAC,0xBA,0xCB,0xDB,0xBB,0xBA,0xDC,0x9B,0xCA,0xBB,0xAB,0xEA,0xBB,0xCA,0xBA,0xAC,0xBB,0x9C,0xCB,0xCB,0x9B,0xC9,0xCB,0xAB,0xB9,0xCB,0xAD,0x98,0xCB,0x9B,0xDA,
+0x9B,0x81,0xDC,0x8A,0xA1,0xEC,0x29,0xB2,0x0E,0x91,0x9B,0x80,0x98,0x98,0xAC,0x81,0x8E,0xB8,0x4B,0xB2,0x9D,0x28,0xD1,0x8B,0x94,0x9C,0x14,0xB9,0xA9,0x34,0xBD,0x02,
+0x2A,0xA6,0x1B,0x22,0x91,0xAA,0x5A,0x87,0x0C,0x06,0xAA,0x21,0x03,0xBB,0x71,0x93,0x0B,0x00,0x13,0x39,0x15,0x20,0xAA,0x23,0x1B,0x22,0x77,0x82,0x80,0x30,0xB9,0x26,
+0x29,0x07,0x89,0x20,0x25,0xB9,0x4A,0x06,0x89,0x91,0x58,0x82,0x18,0xA8,0x44,0xD9,0x31,0xB9,0x31,0x71,0x14,0xB8,0x9D,0x81,0x39,0x00,0x67,0x98,0x98,0x20,0xBA,0x25,
+0x0C,0x84,0x2C,0x93,0x1A,0xB0,0x2A,0x25,0x13,0xDF,0x18,0x10,0x12,0x00,0x99,0x98,0x28,0xCF,0x42,0x88,0xA1,0x1A,0x0A,0x07,0x0D,0x83,0x0A,0x9A,0x11,0x41,0xFA,0x29,
+0x80,0x98,0x40,0x11,0x13,0xAF,0xCA,0x49,0x84,0x88,0xA9,0x10,0x89,0x07,0xAD,0x04,0x8A,0xB2,0x58,0xA8,0x98,0x6A,0x05,0x99,0x9B,0x92,0xAD,0x20,0x17,0x88,0xC9,0x18,
+0x00,0xE8,0x70,0xE8,0x42,0xD9,0x11,0x10,0xE8,0x3A,0x05,0xA9,0x2A,0x84,0x9D,0x10,0x01,0x31,0x91,0x9B,0xA9,0xCA,0x8B,0x22,0x31,0x47,0x82,0x9A,0xBB,0x9A,0x18,0x23,
+0x90,0xCA,0x1B,0x47,0x80,0x81,0x31,0xA1,0x9A,0xEC,0xAB,0x29,0x35,0xB8,0x99,0xBD,0x20,0x73,0x25,0x00,0x90,0xBC,0x9B,0x08,0x21,0x24,0x01,0x31,0x81,0x2A,0x67,0xC8,
+0xAC,0xAB,0x28,0x53,0x43,0x01,0x88,0xCB,0xAD,0x10,0xC9,0x28,0xA1,0x49,0x83,0x78,0x03,0x09,0x23,0xB0,0xCF,0x8B,0x11,0x44,0x92,0xBD,0x88,0x21,0x02,0x00,0x12,0x31,
+0x23,0xB9,0xBA,0xAF,0xA9,0xAC,0xCB,0x88,0x88,0x63,0x63,0x22,0x22,0xA9,0xBB,0xBD,0x9B,0x98,0x00,0x98,0x28,0x22,0x75,0x14,0x31,0x23,0x98,0x00,0x99,0xC0,0xAE,0xBA,
+0xBB,0x99,0xAA,0x99,0x69,0x15,0x88,0x98,0x72,0x03,0x41,0xB2,0x60,0xA1,0xAA,0x89,0xB9,0x0B,0xA0,0x70,0x25,0x21,0x81,0xC8,0x9D,0xB9,0x1A,0xB9,0x52,0x01,0x53,0x18,
+0x44,0x90,0x01,0x88,0xCD,0xB9,0xAE,0x11,0x98,0x20,0x98,0x30,0x10,0x83,0x41,0x21,0xA3,0x9E,0x1A,0x17,0x9A,0x01,0x91,0x4B,0x85,0x19,0x02,0x08,0xE2,0x9F,0xA0,0x58,
+0x90,0x21,0x00,0xA9,0x33,0x19,0xD2,0x19,0x8A,0x91,0x15,0xAF,0xB3,0x1D,0xA2,0x08,0x28,0xF9,0x49,0x02,0xDA,0x34,0xAF,0x14,0x89,0x98,0x25,0xAD,0x12,0xAA,0x10,0x01,
+0x17,0x9E,0x14,0xAB,0x13,0xBB,0x63,0x90,0x9C,0x18,0x01,0x24,0xBA,0x32,0xCA,0x8B,0x12,0xCC,0x41,0x99,0x33,0x43,0xB0,0xAA,0x0A,0x98,0x01,0xCF,0x90,0x28,0x48,0x06,
+0x31,0x81,0x00,0xB0,0x9D,0xDB,0x8B,0xB9,0x49,0xA0,0x21,0x21,0x00,0x27,0x20,0xA2,0x70,0xA1,0x28,0x20,0xFB,0x4F,0x90,0x20,0xCA,0x8A,0x41,0x91,0xB9,0x09,0x11,0x81,
+0xAA,0x30,0xB9,0x40,0x35,0x8B,0x37,0x22,0xA8,0xB0,0xAE,0xBB,0x09,0x21,0x21,0x91,0x50,0x04,0x48,0x90,0x44,0xA9,0x90,0xCB,0xBB,0xBD,0x89,0xA9,0x12,0x0D,0x92,0x50,
+0x14,0x43,0x12,0x45,0x88,0x99,0x8A,0x91,0x4B,0x91,0x11,0xBF,0x90,0xA8,0xAA,0xBA,0xBB,0xA9,0x9F,0x12,0x22,0x48,0x06,0x39,0x12,0x14,0x38,0xA1,0x72,0x33,0xB8,0x44,
+0x09,0x92,0x62,0xB9,0x31,0xC8,0x00,0xBC,0xDC,0x8A,0x9A,0x22,0x99,0x10,0x37,0x88,0x02,0x8A,0x9A,0xB1,0x8F,0xB1,0x0C,0x90,0x8A,0xB9,0xAB,0xCB,0x71,0x16,0x31,0x22,
+0x14,0x11,0xD8,0x8B,0x99,0x98,0x89,0xCD,0x41,0xB9,0x48,0x92,0x18,0x82,0x62,0x82,0xA9,0x9C,0x91,0x9F,0x01,0x29,0x05,0x19,0x25,0x18,0x23,0x91,0x1A,0x05,0xBE,0x50,
+0x00,0x22,0x09,0x14,0x8A,0xC3,0x0F,0xB0,0x1B,0x80,0x90,0x54,0x80,0x82,0x1B,0xA9,0xE9,0x2A,0x92,0x01,0x1B,0x27,0xA9,0x63,0x99,0x80,0x2B,0xD2,0x59,0xB8,0x43,0x1A,
+0xC2,0x09,0x0F,0x97,0x7B,0xC0,0x49,0x81,0xAA,0x28,0x14,0xA0,0xAD,0x00,0x22,0xA1,0x38,0xF8,0x1A,0x21,0x92,0xDB,0x28,0x02,0x10,0x01,0xA9,0xBD,0x10,0x9A,0x46,0xB0,
+0x1A,0x02,0xAB,0x00,0x39,0xC2,0x77,0xEA,0x41,0xC8,0x19,0x22,0x90,0x88,0xAA,0x34,0xDA,0x08,0x20,0x11,0xB1,0x1E,0x22,0x02,0x9A,0x00,0x20,0x80,0xCA,0xDF,0x19,0x62,
+0x03,0x9A,0xEB,0x8A,0x22,0x22,0x04,0x89,0x99,0x00,0x11,0x89,0x25,0x91,0x0B,0xD5,0x0C,0xC0,0x09,0x30,0xA1,0x0A,0xCB,0x12,0x8A,0x13,0xBA,0x08,0xA9,0xA0,0x0F,0x24,
+0x82,0x78,0x03,0x40,0x00,0x90,0x9B,0x8A,0x44,0x81,0xFB,0x8A,0xCB,0x09,0xCA,0x18,0xA9,0x18,0x13,0x1B,0x24,0x43,0x33,0xBD,0x47,0x80,0x00,0x91,0x09,0xCA,0x30,0x90,
+0x80,0x88,0xDF,0x9A,0xA8,0x9F,0x15,0x0B,0xE0,0x3A,0x16,0xCA,0x09,0x63,0x81,0x8A,0xBA,0x39,0x27,0x9A,0x43,0x98,0xDA,0x8B,0x11,0x41,0x05,0xAB,0x09,0xA9,0x1A,0x45,
+0x23,0xA0,0xBC,0x9B,0x99,0x90,0x30,0x35,0x44,0x82,0x89,0xCB,0x18,0x40,0x01,0x10,0xC8,0xCE,0x99,0x08,0x80,0xA8,0x8A,0x11,0x08,0x53,0x35,0x33,0x45,0x14,0x88,0x98,
+0xAA,0x90,0x0C,0xA0,0xAB,0x8A,0x04,0xDF,0x18,0xB8,0x9B,0x99,0x88,0x9A,0x88,0x32,0x28,0x15,0x79,0x06,0x28,0x15,0x18,0x10,0x22,0x11,0x00,0x10,0x11,0x61,0xA1,0x08,
+0x0B,0xD8,0xB9,0xCF,0xA9,0x9B,0xDC,0x28,0xE8,0x89,0x11,0x10,0x81,0x8A,0x36,0x90,0x22,0x30,0x12,0x25,0x80,0x9A,0x42,0x22,0xD9,0x3B,0xA4,0x1A,0x29,0x95,0x73,0x15,
+0xA8,0x10,0x80,0x01,0x98,0xAD,0x45,0x91,0x19,0x23,0xDF,0x1A,0x36,0x98,0xAC,0x10,0x22,0x12,0xFA,0xAC,0x30,0x13,0x80,0x9A,0xA0,0xCC,0x8B,0x67,0x91,0x09,0xC0,0x1B,
+0x06,0xA9,0x0B,0x03,0xAA,0x51,0x02,0x18,0x11,0xA8,0xBA,0xEB,0xAB,0x40,0x02,0x1A,0x46,0xA1,0x18,0x91,0xBA,0xAA,0xBB,0x70,0x13,0x08,0x01,0xBB,0xA1,0x8F,0x23,0x55,
+0xD1,0xBD,0x30,0x02,0xBB,0x61,0x02,0x99,0xCA,0x0B,0x53,0x22,0x81,0x9A,0xDA,0x9C,0x10,0x42,0x92,0xAA,0xAA,0x08,0x54,0x92,0xAE,0x89,0x52,0x12,0x00,0xAA,0x42,0xB1,
+0xBC,0xAB,0x41,0x46,0x91,0x8B,0x31,0xD0,0x8B,0x00,0xD9,0x9B,0x51,0x24,0x81,0xCA,0x9A,0x90,0x20,0x24,0x63,0x12,0xA9,0x89,0xB9,0x1A,0x35,0x80,0x53,0xB0,0xAC,0x89,
+0x92,0xCE,0xAB,0x30,0x44,0x81,0xCA,0x19,0x63,0x81,0x00,0x88,0x99,0x80,0xAA,0xBE,0x29,0x22,0x46,0x82,0x9A,0xDC,0x8B,0x00,0xA1,0x1B,0x35,0x82,0x10,0x9A,0x64,0x14,
+0x90,0x00,0x28,0x83,0xBB,0x41,0x81,0xDA,0x1B,0x26,0xA0,0xBE,0x9A,0x11,0x82,0xBE,0x0A,0x53,0x33,0x90,0x9B,0xDB,0x19,0x63,0x03,0x21,0x33,0xFA,0xAC,0x10,0x34,0xD8,
+0xBD,0x89,0x01,0xA9,0x0A,0x31,0x12,0x20,0x21,0x14,0x20,0x64,0x43,0x91,0x99,0x28,0x22,0xC8,0xCF,0xAA,0x88,0x08,0x99,0xA9,0x19,0x53,0x54,0x02,0x11,0x53,0x81,0x08,
+0x81,0x88,0x02,0xEA,0x8A,0xA9,0x98,0xA9,0xDE,0x9C,0x32,0xB2,0xDF,0x9A,0x10,0x44,0x02,0xDA,0xAB,0x09,0x42,0x23,0x01,0x33,0x24,0xB8,0xBA,0xDC,0x89,0x90,0x98,0x88,
+0x98,0x51,0x91,0x9C,0x40,0x35,0x82,0x98,0xCB,0xCC,0x9C,0x80,0x10,0x81,0xDB,0x9B,0x98,0x89,0x81,0xA9,0x28,0x77,0x23,0x91,0xCC,0x8A,0x11,0x22,0x43,0x01,0x09,0x10,
+0x01,0xBD,0x9B,0x63,0x02,0x01,0x88,0x88,0xC9,0x38,0x47,0x43,0x22,0x80,0x98,0xBA,0x8C,0x53,0x44,0x82,0xBA,0x89,0xB0,0x59,0x24,0x12,0x31,0xA2,0xAE,0x51,0x24,0x90,
+0x18,0x53,0x33,0x80,0xB8,0xBF,0x09,0x30,0x15,0xAA,0xCB,0x8A,0x33,0x83,0xCB,0xAA,0x3B,0x37,0x91,0xEC,0x8A,0x23,0x81,0x89,0x80,0xB8,0x0B,0xA1,0xCF,0xA9,0x1A,0x45,
+0xA2,0xBB,0xCB,0x18,0x35,0xA1,0xAC,0x09,0x21,0x91,0xCD,0x99,0x89,0x20,0x67,0x14,0xB9,0x99,0x08,0x22,0x90,0xBA,0x0A,0x24,0x88,0x13,0xCC,0xAC,0x10,0x32,0x24,0xFA,
+0x8B,0x01,0x52,0x24,0x08,0x22,0xAA,0x10,0x98,0xCA,0x50,0x34,0x13,0xEB,0xAB,0x53,0x80,0xA9,0x89,0x21,0x73,0x91,0xDB,0x1A,0x83,0xBA,0x1A,0x32,0x83,0xBD,0x89,0x31,
+0xF8,0x9F,0x42,0x91,0xB9,0xBE,0x18,0x04,0xAA,0x18,0x02,0x19,0x37,0xB8,0xBC,0x8B,0x80,0x01,0xA9,0x19,0x01,0x8A,0x14,0x19,0x05,0x58,0x94,0xAD,0x10,0xA1,0xAD,0x71,
+0x03,0x19,0x25,0xEB,0x0B,0x31,0x81,0x08,0x33,0xC8,0x39,0xA2,0x8B,0xB0,0x3A,0x25,0xD8,0x0C,0x23,0xBA,0xEA,0xAC,0x08,0x73,0x02,0xCA,0x19,0x01,0x61,0x13,0xCB,0x9B,
+0x88,0x31,0x94,0x9C,0x11,0x25,0xBA,0xED,0x09,0x10,0x23,0xA2,0x8C,0xB8,0x29,0x14,0x31,0x23,0xF2,0x9F,0xC1,0xCF,0x53,0x81,0x90,0xDC,0x19,0x26,0x90,0xBC,0x0A,0x43,
+0x03,0x80,0x10,0x23,0xDA,0xCC,0xAB,0x89,0x08,0x63,0x33,0x24,0x22,0x98,0xEB,0xBD,0x9A,0x20,0x12,0xB9,0x8A,0x32,0x82,0x18,0x56,0x23,0xB8,0x0C,0x44,0x02,0xA9,0x0A,
+0x43,0x82,0xDA,0xBB,0xBC,0xAC,0x9A,0x88,0xA8,0x9B,0x31,0x37,0x02,0xC9,0x1A,0x63,0x45,0x24,0x81,0xAA,0x9A,0x30,0x24,0xB9,0xAD,0x20,0x93,0xDF,0xAA,0x10,0x22,0x81,
+0xA8,0x99,0xBA,0x29,0x47,0x82,0x20,0x44,0x12,0x98,0xAB,0x39,0x24,0x90,0xA9,0xEB,0x9C,0x89,0xA0,0xDE,0xBB,0x38,0x36,0x02,0xB9,0x0A,0x42,0x34,0x81,0x99,0x21,0x26,
+0x02,0x98,0x99,0x18,0x01,0xA8,0xEC,0xCB,0x99,0x20,0x02,0xB9,0xAA,0x8A,0x32,0xA1,0xEC,0x1B,0x67,0x23,0xB0,0xBE,0x89,0x42,0x12,0xA9,0x9B,0x30,0x12,0x80,0x98,0xAA,
+0x50,0x46,0x03,0xA9,0xBD,0x18,0x42,0x22,0x82,0x89,0x20,0x23,0x36,0x23,0xFB,0x29,0x33,0x26,0xEA,0x0A,0x10,0x91,0x08,0xB2,0xEF,0x09,0x32,0x93,0xBD,0x8A,0x31,0x24,
+0x81,0xDB,0x9B,0x40,0x34,0x12,0xA9,0xBA,0x38,0x24,0xC8,0x9C,0x29,0x24,0xA9,0xAA,0x09,0x43,0x82,0xA9,0x28,0x55,0x25,0xC8,0xBB,0x89,0x30,0x36,0xC8,0x9D,0x20,0x13,
+0x90,0x88,0x09,0x13,0x00,0x08,0xF9,0xAD,0x10,0x12,0xC0,0xAF,0x28,0x23,0x88,0xA0,0xBD,0x38,0x14,0xA8,0xCC,0x9C,0x40,0x43,0x01,0x88,0xAA,0x89,0x21,0x11,0xA1,0xDF,
+0x18,0x31,0x13,0xEB,0xBB,0x89,0x28,0x81,0x89,0x99,0x11,0xE9,0x9B,0x40,0x27,0x91,0xAB,0x19,0x56,0x22,0x82,0x9A,0x09,0x80,0x99,0x8B,0xFB,0xAD,0x9A,0x89,0x08,0xAA,
+0x39,0x02,0x31,0x98,0x42,0x37,0x01,0x10,0x80,0xAB,0x32,0xD9,0xEF,0x8A,0x28,0x23,0xFB,0x8A,0x11,0x81,0x89,0x09,0x90,0x0B,0x52,0x26,0xEA,0x9A,0x19,0xB1,0x2C,0xB3,
+0xAE,0xB9,0x19,0x32,0xD0,0x9F,0x00,0x10,0x33,0xA8,0x99,0x88,0x80,0x89,0xA8,0x1A,0xC8,0xCE,0x08,0xAC,0x00,0xC9,0x58,0x01,0xC0,0x8E,0x01,0x20,0x13,0xA9,0xBB,0x9A,
+0x80,0xDD,0xCB,0x09,0x12,0x00,0xC9,0x1B,0x56,0xB0,0x0A,0xB9,0xAB,0x65,0x12,0x01,0xAB,0xCB,0x49,0x14,0x10,0xC8,0x2A,0x35,0x91,0x9B,0x10,0xA2,0x8C,0x08,0x24,0xAA,
+0x99,0x28,0x12,0xBA,0xDB,0x9E,0x11,0xB8,0x0C,0x92,0x22,0x58,0x57,0x15,0x88,0x08,0x82,0xAA,0x89,0x00,0xB2,0xEF,0x99,0x98,0x98,0x58,0x93,0x49,0xB2,0x4A,0x16,0xA9,
+0x08,0x99,0x91,0x72,0xD0,0x89,0x00,0x82,0x08,0x30,0xC4,0x0E,0x13,0x98,0x02,0x30,0xDC,0x12,0x4B,0x27,0xAD,0x81,0x38,0xB1,0x34,0xBC,0x11,0x20,0xF9,0x71,0x81,0x01,
+0xAA,0x98,0xBB,0xAB,0x58,0x42,0x45,0x12,0x00,0x00,0xDD,0x9A,0x89,0x88,0x32,0x44,0x43,0x12,0x02,0xA8,0xBA,0xBA,0xAC,0x88,0x00,0xA0,0xBE,0x0A,0xE9,0x9B,0xAB,0x42,
+0x00,0x67,0x33,0x33,0x33,0x33,0x25,0x01,0x88,0x99,0xCC,0x9B,0xBA,0xCC,0xCC,0x9B,0x9A,0xDB,0x09,0x98,0x10,0x11,0x42,0x23,0x54,0x23,0x24,0x10,0x43,0x22,0x23,0x02,
+0x11,0x34,0x13,0x19,0x93,0x49,0xD8,0x28,0xBA,0xF9,0x8F,0x90,0x0A,0x80,0xBB,0xA9,0xBB,0x98,0xCA,0xCF,0x28,0x00,0xB8,0x8F,0x22,0x8A,0x00,0x19,0x37,0xB9,0xAB,0x40,
+0x26,0x91,0x0A,0x12,0x72,0x92,0x0A,0xA1,0x2B,0x17,0x89,0xA8,0x59,0x84,0x88,0x98,0x99,0x99,0x99,0x09,0x28,0x02,0x18,0xF8,0xAF,0x38,0xA0,0x30,0x99,0xA9,0xBB,0x8E,
+0x53,0x11,0x01,0x9A,0xC8,0xBF,0x30,0xB8,0x61,0x91,0x80,0x21,0xAA,0xFA,0x2A,0x04,0x09,0xA1,0x8D,0x83,0x0D,0x43,0x00,0x24,0x18,0xEA,0x28,0x88,0x33,0xE1,0x0E,0x22,
+0x81,0xAB,0x20,0x34,0xE8,0x8B,0x44,0xA1,0x39,0x85,0xBC,0x41,0x92,0x8B,0xAA,0x30,0x52,0xA0,0x11,0x09,0x12,0xAA,0x74,0xB1,0x20,0xF9,0x39,0x92,0x01,0x58,0xB3,0x29,
+0x92,0xAF,0x22,0x9C,0x53,0x23,0xBB,0xA8,0x3C,0x47,0x01,0xB9,0xAA,0x19,0x14,0x10,0x89,0xB9,0x72,0xB8,0x20,0x41,0xF8,0x28,0x91,0x8A,0x12,0x98,0x88,0xAA,0x59,0xA1,
+0x5B,0x95,0x19,0xC2,0x19,0x50,0xD4,0x9E,0x43,0xB0,0x39,0xA3,0xAC,0x18,0xA2,0x8B,0x24,0x91,0x61,0xB2,0x9E,0x99,0x08,0xA9,0x02,0x00,0x66,0x91,0xAA,0xA9,0x89,0xE9,
+0x0A,0x30,0x84,0x63,0x81,0x10,0xEA,0x9B,0xA8,0xAC,0x01,0x10,0x32,0x73,0x84,0xAA,0x10,0x91,0x9B,0xFA,0xAF,0x88,0x88,0x10,0x11,0x62,0x02,0x00,0x88,0x00,0x00,0xBA,
+0x8B,0xFA,0x1B,0xBA,0x1A,0x01,0xFB,0x9E,0x89,0x10,0xB9,0x61,0x81,0x08,0x90,0x34,0x99,0x98,0x53,0x19,0xDD,0x83,0x89,0x9D,0xC2,0x49,0x18,0x01,0xA4,0x8F,0x10,0x98,
+0x01,0xA9,0x98,0x38,0xF4,0x8B,0x22,0x88,0xD0,0x29,0xCA,0x39,0x07,0x39,0xDA,0x10,0x90,0x50,0xB8,0x0B,0xB0,0x59,0xB1,0x41,0xA0,0x1A,0x32,0x05,0xDB,0x9C,0x00,0x90,
+0x42,0xF9,0x30,0xAA,0x27,0x9A,0x81,0xA8,0x34,0x9B,0xA1,0xDE,0x51,0x98,0x09,0x02,0x0A,0x18,0xB3,0x2D,0x12,0xD9,0x70,0x80,0xA1,0x8D,0x09,0x84,0x2A,0x89,0xA4,0x49,
+0x8B,0x96,0x1F,0x85,0x0D,0x22,0xB8,0xA9,0x7A,0x86,0xAA,0x38,0xA9,0xA0,0x71,0x91,0x31,0xE1,0x8C,0x20,0x82,0x8B,0x88,0x22,0x23,0x33,0xE9,0xCC,0x8A,0x00,0x11,0x32,
+0x10,0x13,0x39,0xA4,0xBE,0x1A,0x80,0xDA,0x69,0x24,0x81,0xC8,0xBB,0x89,0x21,0x24,0x88,0xBA,0xDB,0x9A,0x88,0x31,0x00,0x25,0x43,0x25,0x34,0x01,0x11,0xC9,0x9C,0x11,
+0xCA,0x88,0x98,0x31,0x16,0xCA,0x30,0xC0,0xBC,0x1A,0x98,0x12,0xAE,0xB9,0x08,0xDC,0x09,0x90,0x01,0x0B,0x27,0x00,0x03,0x09,0x01,0x40,0x37,0x10,0x12,0x32,0x04,0x71,
+0x81,0x21,0x81,0x40,0x83,0x90,0xAC,0xC9,0x10,0xAE,0x88,0xA9,0x99,0xCD,0x88,0xBB,0xA9,0x1A,0xE0,0x1C,0xA2,0x18,0x11,0x35,0xBA,0x10,0x52,0xC8,0x22,0xBD,0x41,0x12,
+0xA9,0x30,0x32,0x37,0xA8,0x1C,0x27,0x90,0x19,0xB2,0x49,0x83,0x58,0x25,0xA0,0xAA,0x41,0x02,0x24,0x8D,0x12,0x18,0x09,0x92,0x5A,0xD4,0x1B,0xB1,0x40,0x90,0xBA,0x23,
+0xBA,0xB9,0x22,0x2D,0xF4,0x6B,0xC1,0x0A,0x21,0x09,0x94,0x1C,0xD9,0x88,0x2B,0x96,0x0B,0x00,0x88,0x9B,0x92,0x7B,0xA1,0x10,0x80,0x8D,0x82,0x4A,0xC2,0x71,0xC9,0x21,
+0xA8,0x01,0xA0,0x3A,0x14,0x43,0xA8,0x8C,0x09,0x06,0x4B,0x82,0xD9,0x39,0xBA,0x34,0x02,0x8C,0x84,0x8A,0x23,0xAC,0x98,0x33,0xA8,0x1D,0xA5,0x21,0x8F,0xA5,0x18,0x0E,
+0xB4,0x4A,0x90,0x18,0x91,0x0B,0x90,0x24,0x09,0xA9,0x22,0xA8,0x89,0x80,0xD9,0x72,0xA9,0xA1,0x0C,0x98,0x02,0x27,0x9C,0x82,0x00,0x9D,0x22,0x01,0x88,0xAF,0x34,0x8D,
+0x92,0x0A,0x91,0x4C,0x05,0x98,0x1B,0xD9,0x42,0x99,0x30,0xD0,0x0A,0x21,0xC8,0x19,0x23,0xC1,0x1A,0x90,0x4A,0x97,0x2C,0xA1,0x08,0x99,0x39,0x31,0xF4,0x3B,0x1A,0x13,
+0xF1,0x5A,0xA0,0x10,0xC8,0x39,0x80,0x98,0x12,0x8E,0xC9,0x00,0x20,0x32,0xCC,0x00,0x44,0xCC,0x32,0xD9,0x10,0x00,0x19,0xD1,0x40,0x88,0xB2,0xAB,0x31,0x89,0x67,0xAA,
+0x82,0x9A,0x1A,0x86,0x1B,0x80,0x09,0x81,0x18,0x8B,0x26,0xBC,0x14,0x1C,0xC2,0x28,0x1B,0x06,0x99,0x0A,0x05,0x8C,0x15,0x9A,0x81,0x39,0xC8,0x88,0x79,0x91,0x88,0x28,
+0xA9,0x90,0x7B,0x93,0x19,0xB9,0x38,0x21,0x84,0x62,0xE8,0x18,0xBC,0x22,0x0A,0x91,0x13,0x0F,0x04,0x29,0x03,0xCA,0x59,0xC2,0x0C,0x90,0x01,0x9C,0x03,0x78,0x81,0xA9,
+0x0B,0x00,0x21,0x87,0x9E,0x10,0x01,0x82,0x8A,0xC8,0xBC,0x7A,0x05,0x99,0x01,0x9B,0x82,0x30,0xA0,0x9E,0x12,0x29,0x94,0x9D,0x12,0x9A,0x25,0xB0,0xAC,0x50,0x01,0xB8,
+0x3B,0x06,0xBA,0x8B,0x35,0xA9,0x51,0x9A,0xA3,0x2B,0xA1,0x99,0x32,0xCA,0x72,0x92,0x81,0x8D,0xA8,0x21,0x38,0x86,0x9C,0x89,0x33,0x21,0xBA,0xF0,0x4B,0x05,0x9A,0x08,
+0x81,0x55,0xBA,0x00,0x8A,0x91,0x3D,0x96,0x08,0x89,0x02,0x18,0x15,0x8C,0xC8,0x20,0x18,0x03,0xA8,0x9E,0x20,0x90,0x69,0x92,0x38,0xCC,0x26,0x9A,0xA1,0x09,0x28,0x04,
+0x1A,0xD0,0x09,0x52,0x92,0xBB,0x2B,0x03,0x0A,0x04,0x4A,0xF1,0x6A,0xA0,0x30,0xD9,0x11,0x31,0x8A,0xD0,0xAB,0x78,0xA2,0x28,0xBA,0x21,0x40,0xC3,0x8A,0xBD,0x25,0x89,
+0x03,0x8A,0x19,0x91,0xC8,0x09,0x9D,0x83,0x90,0x73,0x13,0xF3,0x8B,0xBA,0x48,0x16,0x88,0x8C,0x91,0x21,0x99,0x10,0xA0,0xC0,0x1D,0x82,0x10,0x29,0x93,0x2B,0xDC,0x02,
+0x08,0x9F,0x03,0x10,0x14,0xCC,0x09,0xA3,0x78,0xB0,0x98,0x10,0x41,0xF9,0x10,0x80,0x10,0x9A,0x82,0x62,0xBA,0xA1,0x1D,0xB0,0x63,0x10,0x82,0xBC,0x19,0x88,0x10,0x13,
+0x0C,0x24,0xE0,0x29,0x09,0xB3,0x1A,0x13,0x8B,0x33,0x27,0xAB,0x00,0xDA,0x61,0xB8,0x71,0x93,0xBC,0x20,0x11,0xB1,0x1C,0x12,0x27,0x08,0xEA,0x18,0x21,0xA1,0x89,0x98,
+0x31,0x83,0x01,0x2B,0x87,0x42,0xE9,0x09,0x11,0x11,0x99,0x00,0x43,0x19,0x81,0x07,0x2B,0xB1,0x38,0x01,0x50,0xA0,0x05,0x8C,0x11,0xAB,0x47,0x9A,0x33,0xCB,0x25,0xAB,
+0x11,0x98,0x4B,0x84,0x10,0x90,0x1A,0xF1,0x39,0x13,0x98,0x98,0x1A,0x59,0xB6,0x4A,0x10,0xA5,0x0D,0x11,0xA9,0x11,0x9A,0x23,0xBA,0xA8,0x70,0x85,0x9C,0x80,0x0B,0x24,
+0x1B,0x85,0x8B,0xB9,0xAB,0x35,0x99,0x13,0xDA,0x50,0xE9,0x20,0x80,0x81,0x09,0xBC,0x63,0xB8,0x08,0x90,0x10,0xFB,0x10,0x98,0x41,0xA0,0x11,0xAA,0x19,0xFB,0x2A,0x32,
+0xC9,0x12,0x8C,0xCB,0x25,0x8B,0x10,0xC9,0x89,0x31,0xB1,0xA9,0x52,0xDC,0x08,0xB0,0x3A,0xB0,0x10,0x27,0xAF,0x93,0x28,0xFB,0x41,0xA8,0x88,0x19,0xA1,0x98,0x51,0xEA,
+0x11,0x19,0x91,0x30,0xAA,0xE2,0x3C,0xB2,0x51,0x99,0xAA,0x11,0x9D,0x24,0xCA,0x23,0x9B,0x82,0x9A,0x02,0xAF,0x16,0x89,0x98,0x8A,0x88,0x54,0xB8,0x1A,0x92,0x0A,0x01,
+0xA0,0xEC,0x38,0x9B,0x17,0x09,0x20,0xFA,0x30,0x0A,0xA8,0x90,0x70,0xD8,0x11,0x0A,0x11,0x18,0xA4,0x8E,0xAC,0x24,0x39,0xB9,0x20,0x19,0x81,0xC0,0x0C,0x82,0x38,0xB8,
+0x80,0x70,0xC2,0x0C,0x34,0x82,0x9E,0x91,0x18,0xAB,0x02,0x09,0x50,0x93,0x8B,0x29,0x35,0xFC,0x30,0x89,0xA3,0x0E,0x00,0x90,0x09,0x99,0x31,0x05,0x1B,0xF0,0x38,0xB9,
+0xA9,0x80,0x38,0x83,0x23,0xD8,0x3D,0x93,0x92,0x8F,0xE0,0x09,0x20,0x02,0xBB,0x09,0x08,0xB0,0x31,0xBD,0x66,0x90,0x88,0x09,0x20,0xC8,0x88,0x8E,0x14,0x9B,0x98,0x8A,
+0x18,0x01,0x89,0x50,0x81,0xB4,0x9F,0xA1,0x80,0x1B,0xC1,0x28,0x19,0x27,0x8E,0xA3,0x1D,0xA0,0x08,0xFB,0x48,0x91,0x89,0x89,0x38,0xD2,0x89,0x8A,0x25,0x90,0x0B,0x92,
+0x08,0xAB,0x42,0x31,0xB1,0xBC,0x3B,0xC3,0x71,0x97,0x8B,0x39,0x85,0x8A,0x00,0x88,0x19,0x06,0x8B,0x90,0xA8,0x38,0x73,0xE8,0x09,0x00,0x19,0x12,0x37,0x99,0x02,0x9B,
+0xA8,0x13,0x8E,0x90,0x25,0x3A,0xA5,0x1A,0xB0,0x48,0xB0,0x88,0x9D,0x81,0x1B,0x82,0x01,0x5A,0x90,0xF0,0x8D,0x10,0x98,0xD9,0x4A,0x22,0xA3,0x0C,0x01,0xC2,0x0C,0xA9,
+0x88,0x3A,0x07,0x5A,0xC1,0x11,0x29,0x82,0x92,0x8C,0x71,0xA1,0x11,0x42,0x98,0x14,0x88,0x49,0xE0,0x22,0x4B,0x96,0x19,0x98,0x10,0x01,0x10,0x99,0x43,0x14,0x8C,0xB1,
+0x18,0xAF,0x34,0xB8,0x21,0x38,0x97,0x9B,0x98,0x91,0x9B,0x0A,0x87,0x19,0x90,0x19,0xF0,0x2A,0xA8,0x9B,0xB5,0x3C,0x00,0xB4,0x03,0x4F,0xF0,0x62,0x9E,0x04,0x99,0x01,
+0x00,0xA8,0x28,0x91,0x18,0xB0,0x59,0x01,0x00,0xA9,0x41,0x92,0x9D,0x31,0x91,0x12,0x20,0xA3,0x31,0x21,0x74,0xE9,0x40,0x88,0x11,0x99,0x36,0xDC,0x41,0xC0,0x49,0x92,
+0x8A,0x30,0x11,0xA0,0x0E,0x83,0x0C,0x01,0x00,0x98,0x30,0x27,0xA0,0x8B,0xC9,0x09,0x98,0x48,0x07,0x28,0x93,0x09,0xA9,0xA9,0x98,0x62,0x00,0x23,0xBC,0x70,0xA1,0x2A,
+0x02,0x51,0xD8,0x89,0x99,0x18,0x43,0x34,0x92,0x9A,0xAA,0xCD,0x41,0x81,0x19,0x25,0xB8,0x52,0xB0,0x99,0x88,0x42,0xC2,0x8B,0x01,0xAB,0x80,0x57,0xB8,0x08,0x01,0x42,
+0xA8,0x44,0xAC,0x23,0x81,0xBF,0x11,0x23,0x9C,0x83,0x19,0xFA,0x41,0xD8,0x29,0x01,0x00,0x8A,0x38,0x96,0x2C,0xB1,0x54,0x98,0xA8,0x89,0xAB,0x30,0x24,0x43,0xA0,0xBC,
+0x19,0x90,0x32,0x0B,0xD1,0x8C,0x11,0x15,0x8B,0x33,0x02,0xBF,0x82,0x9F,0x80,0x58,0x13,0x90,0x8A,0x10,0x04,0x99,0xD9,0x8C,0x90,0x00,0x1B,0x17,0x02,0x99,0xA1,0x39,
+0xA8,0x05,0x9B,0x1E,0x07,0xAB,0x20,0xC0,0x40,0x09,0xC3,0x7A,0x83,0xDB,0x00,0x10,0x92,0x09,0xC8,0x48,0x91,0x9B,0x26,0xA9,0x23,0x9D,0x02,0x08,0xBB,0x10,0x89,0xDC,
+0x72,0xA2,0x31,0xCC,0x22,0xB9,0x89,0x19,0x93,0x9E,0x81,0x40,0xE9,0x21,0x30,0xEA,0x92,0x1D,0xA2,0x18,0x20,0x98,0xD0,0x08,0x59,0x95,0x29,0xB9,0x01,0x1B,0x35,0xDA,
+0x30,0xB0,0xA9,0x38,0x99,0xB8,0x73,0x90,0x8D,0x92,0x89,0x0C,0x05,0xC0,0x8F,0x33,0xC1,0x29,0xBC,0x22,0x98,0x19,0x90,0xA4,0x0F,0x92,0x12,0xCB,0x88,0x01,0x98,0x14,
+0xBD,0x52,0xC8,0x28,0xA2,0x2A,0xC3,0x2C,0xE0,0x28,0x98,0x39,0xB2,0xAF,0x24,0x88,0xA1,0x99,0x8C,0x44,0x83,0x8A,0x50,0x93,0x11,0xBD,0xBA,0x38,0x83,0x8E,0xB3,0x2C,
+0x34,0x03,0xDB,0x10,0xCB,0x99,0x36,0xAB,0x90,0x40,0x21,0xA1,0xB0,0x0F,0x43,0x90,0x9D,0x92,0xBF,0x41,0x11,0xB2,0x1C,0xB0,0x9C,0x23,0x80,0x03,0x18,0xE9,0x29,0xB1,
+0x63,0xA9,0x9D,0x35,0x09,0x16,0xA8,0x49,0xE1,0x0B,0x23,0x00,0xB9,0x10,0x21,0xC8,0xA9,0x3B,0x87,0x0B,0xA0,0x42,0x18,0x95,0x8D,0xA0,0x89,0x31,0xD1,0x79,0x03,0x8A,
+0x91,0x9D,0x88,0x81,0x8A,0x42,0x13,0x0A,0x88,0xC1,0xCF,0x31,0x90,0x89,0x08,0x01,0x31,0x81,0x24,0xAE,0x11,0x08,0xF9,0x9D,0x42,0x91,0x9A,0x32,0x21,0xC1,0x8C,0xA0,
+0xAB,0x30,0x17,0xD9,0x9C,0x51,0x03,0x88,0x18,0x23,0x99,0x80,0xB9,0xCF,0xAA,0x30,0x22,0xB2,0xCF,0x42,0x02,0x00,0x10,0xA8,0x98,0x8B,0x27,0x91,0xBD,0x30,0x22,0x82,
+0xDC,0xBA,0x9A,0x88,0x73,0xA3,0xBB,0x0A,0x32,0x15,0xBB,0x88,0x61,0x33,0x04,0x00,0xCF,0x9A,0x38,0x14,0x90,0x1B,0x44,0x82,0x89,0xBA,0xDB,0x9A,0x3A,0x96,0x20,0x9B,
+0x27,0x1B,0xE0,0x8B,0x88,0x30,0x04,0x41,0x82,0x81,0x0C,0xC3,0xAF,0x18,0x35,0x21,0xB1,0x8D,0x89,0x91,0x48,0x03,0xBE,0x09,0x28,0x83,0x29,0x13,0x9B,0x82,0x9C,0x1C,
+0x27,0x29,0xD2,0x08,0x8D,0x92,0x0E,0x22,0x12,0xA9,0x34,0xDE,0x08,0x08,0x15,0x9D,0x83,0x4A,0x93,0x30,0xAC,0xA1,0xAB,0x28,0x10,0x27,0x11,0xAC,0x15,0x99,0xEC,0x11,
+0x19,0x03,0x00,0x21,0xCF,0x01,0x8A,0x80,0x92,0x60,0xA0,0x10,0x89,0xDA,0x29,0x13,0x29,0xD4,0x6A,0xB1,0x99,0xAA,0x48,0x03,0x46,0x98,0x98,0xA9,0x0C,0xA8,0x25,0x2A,
+0x94,0xBA,0x59,0xC1,0x39,0x04,0x29,0x92,0xEA,0x9B,0x38,0x23,0x93,0x72,0xF9,0x01,0x08,0xA9,0x00,0x06,0x1B,0xB3,0x9A,0x11,0x2B,0xE1,0x22,0xBB,0x79,0xB2,0x48,0x8A,
+0xA2,0x73,0xFA,0x22,0x2E,0xF4,0x3A,0x83,0x92,0x3B,0xF8,0xBA,0x39,0x37,0x82,0x8B,0x04,0xBF,0x18,0x80,0x09,0x42,0x12,0x10,0x90,0x99,0xEC,0x8B,0x00,0x88,0x55,0x02,
+0x08,0x81,0xEC,0x89,0x20,0x12,0x22,0x88,0xCB,0x9A,0xC9,0x9A,0x10,0x33,0x64,0x14,0x01,0xEB,0xAB,0x28,0x32,0x82,0x20,0xA8,0x44,0xA8,0xC9,0x29,0xFB,0x8B,0x31,0x21,
+0xA3,0x8E,0x83,0x0B,0x37,0xB0,0x9F,0x90,0x18,0xA8,0x12,0x18,0x16,0x00,0x42,0x01,0x00,0xD9,0x1A,0xA9,0x29,0x14,0xB9,0x58,0x84,0xBF,0x99,0x09,0x38,0x01,0x20,0xB8,
+0xCB,0x1A,0x34,0xA1,0x72,0x20,0x34,0x85,0x1A,0xE2,0x0B,0x81,0x29,0x17,0xB9,0x38,0xB1,0x88,0x0A,0x90,0xFA,0x39,0x90,0xE8,0x1A,0x8C,0x07,0x9B,0x12,0x9B,0x11,0x30,
+0xB8,0x00,0x73,0x87,0x19,0x13,0xEB,0x9C,0x21,0x92,0xA9,0x99,0x28,0x15,0x11,0x12,0xB9,0xCB,0x9C,0x10,0x32,0x35,0x11,0x45,0x80,0x91,0xDB,0x8B,0x98,0x38,0x25,0x51,
+0x92,0x8B,0x81,0xCC,0x89,0xB9,0xDB,0xAB,0x08,0x09,0x80,0x12,0x50,0x37,0x11,0x23,0x98,0x42,0x04,0xB9,0x09,0xC0,0xCA,0x9C,0xA8,0xAC,0x30,0xFB,0x0B,0x99,0x08,0xB8,
+0x74,0x01,0x00,0x21,0xA0,0x88,0xCA,0x51,0x01,0x53,0x11,0x01,0x28,0xB4,0x3C,0xA3,0x8C,0x11,0x13,0x29,0x27,0x21,0x81,0x36,0x98,0x10,0xEB,0x9A,0xAB,0x01,0xDA,0x1B,
+0xD0,0xAF,0x00,0x99,0x88,0x18,0x00,0x81,0x35,0x80,0xC0,0x70,0x04,0x08,0x00,0x20,0x81,0x11,0x51,0x23,0x24,0xAC,0x22,0xBB,0x88,0xBB,0x29,0xFB,0x8F,0x98,0x19,0xE8,
+0x8A,0x98,0x09,0xD0,0x9B,0x08,0xB9,0x10,0xAB,0x94,0x9F,0x10,0x98,0x23,0x89,0x34,0x02,0x73,0x83,0x53,0xA1,0x3A,0x07,0x20,0xB2,0x1B,0x44,0xA1,0x9C,0x30,0x93,0xBF,
+0x18,0x08,0x83,0x9C,0x08,0x01,0x11,0xCA,0xAD,0xA1,0x50,0xB1,0xAA,0x40,0x21,0xFB,0x40,0xA0,0x09,0x04,0x8A,0x81,0x08,0x42,0x24,0x40,0x14,0x20,0xC9,0x08,0x45,0x32,
+0x81,0x01,0x42,0x11,0x90,0x20,0x8B,0x27,0x28,0x45,0x32,0xD2,0x9C,0x52,0x03,0x18,0xA0,0x9A,0x10,0x98,0xCB,0xBB,0x70,0xA0,0x08,0xBE,0x31,0xA8,0x09,0x02,0xFF,0x88,
+0x18,0x12,0x98,0xA8,0xBA,0x0A,0xA3,0xAF,0x01,0x09,0xE0,0x8B,0xB1,0x1B,0xC8,0xCA,0x1D,0xB2,0xAE,0x99,0x28,0xF0,0x2B,0x03,0xDA,0x8B,0x03,0xAC,0x11,0x81,0x81,0xBC,
+0x01,0x08,0xCA,0x22,0xAB,0x14,0xAE,0x11,0x53,0x05,0x8A,0x32,0x11,0x81,0xEA,0x2A,0x03,0x74,0xA3,0x0A,0x21,0x81,0x71,0x92,0x19,0x88,0x30,0x44,0x81,0x10,0x38,0x17,
+0x98,0x08,0xAA,0x72,0x24,0xB9,0x18,0x21,0x16,0x20,0x92,0x09,0x80,0x30,0x25,0x30,0xC8,0x20,0x45,0x00,0xA0,0x28,0x20,0x06,0x08,0x42,0x02,0x28,0x83,0x9F,0x32,0xD9,
+0x68,0x92,0x99,0x19,0x92,0xAB,0x01,0x0B,0x07,0xBB,0x98,0x08,0x9A,0xC2,0xFF,0x10,0x10,0x91,0x9C,0x80,0x99,0xC9,0x08,0x98,0xEC,0x88,0x9A,0x23,0xFA,0x0A,0xC1,0x2C,
+0x84,0xAD,0x01,0x89,0xA0,0x80,0xCB,0x89,0x91,0x8C,0xC9,0x09,0xEA,0x9B,0x02,0xB9,0xA9,0xCF,0x18,0xA8,0x9A,0xC8,0x0C,0x01,0xCB,0x08,0x01,0xDE,0x18,0xA0,0xDB,0x89,
+0x11,0x80,0x31,0x13,0xCC,0xA9,0x9D,0xB9,0xAA,0x38,0xF0,0x7A,0x15,0x99,0x09,0x02,0xCC,0x0A,0x23,0x43,0x46,0x02,0xBA,0xDC,0xAB,0x19,0x42,0x23,0x33,0x20,0x17,0x99,
+0xA8,0xAD,0x99,0x0A,0x36,0x21,0x02,0x08,0x88,0x18,0xA8,0x9A,0x72,0x12,0x23,0x31,0x27,0x00,0x90,0xAB,0xA9,0x9D,0x10,0x33,0x43,0x43,0x25,0x00,0x80,0x98,0xBB,0x3A,
+0x27,0x23,0x62,0x14,0x10,0x99,0xB9,0xBB,0xBD,0x31,0x14,0x11,0x34,0x02,0x08,0xD0,0x19,0xB8,0x32,0x08,0x13,0x80,0x71,0xF0,0x9B,0x08,0xC0,0x9B,0x28,0x95,0x2B,0x93,
+0xAA,0x9A,0x01,0xFE,0xAB,0xC9,0x9C,0x02,0x48,0xD0,0x18,0xC9,0x8A,0xFB,0x09,0x89,0x98,0x1A,0x01,0x91,0xBD,0xB9,0x9C,0xA8,0xCC,0x8C,0x18,0x91,0x2C,0x85,0xAC,0x10,
+0xCA,0x22,0xBB,0xAA,0x10,0x93,0xFF,0x08,0x90,0x09,0x82,0xBB,0x9D,0x08,0xA1,0x29,0x80,0xD3,0x8D,0xA9,0x88,0x90,0x1C,0xB3,0x9A,0x1B,0x11,0xE5,0x8F,0x80,0x21,0xB8,
+0x08,0xBB,0x32,0x19,0x47,0x8E,0x12,0x18,0xA9,0xA0,0x3A,0x8A,0x77,0x8D,0x43,0x01,0xA9,0xD9,0x0C,0x34,0x01,0x00,0x24,0x99,0xA8,0xBD,0xDD,0x89,0x42,0x53,0x34,0x12,
+0xB0,0xAD,0xBC,0xAB,0x88,0x31,0x53,0x44,0x23,0x03,0x90,0xB9,0xAC,0xCB,0xAC,0x9A,0x8A,0x08,0x42,0x35,0x63,0x33,0x22,0x11,0x01,0xA9,0xCB,0xCC,0xAB,0xBB,0xAB,0x88,
+0x11,0x45,0x24,0x32,0x22,0x01,0xA0,0xA9,0x0D,0xB0,0x20,0x40,0x06,0x10,0x14,0x20,0x82,0x00,0x0A,0xEE,0x88,0xDB,0x1A,0x02,0x41,0x34,0x03,0x28,0x21,0xF8,0x1B,0xA8,
+0xBD,0x88,0x09,0x03,0x51,0x81,0x21,0x11,0x80,0x91,0x38,0xF0,0x19,0xB8,0xDC,0x8C,0x88,0x08,0x30,0x07,0x48,0x91,0x23,0xAE,0x11,0x99,0xAA,0x81,0xAD,0x80,0x88,0x10,
+0x64,0x03,0x31,0x84,0xAC,0x01,0xAC,0xBA,0xBB,0xCC,0x9A,0x9A,0x73,0x00,0x98,0x88,0x18,0x55,0x02,0x98,0x20,0xA2,0x19,0xE9,0xAA,0x9C,0x09,0x20,0x02,0x01,0xAC,0xF8,
+0x0E,0x89,0x01,0x21,0x90,0x02,0x08,0x81,0xAE,0x11,0x00,0xAD,0xD1,0x8C,0x0A,0x94,0x71,0x91,0x08,0x03,0x8F,0x91,0x89,0x80,0x89,0xC0,0x28,0x80,0xB2,0x70,0x90,0xA8,
+0x12,0xAF,0xA0,0x0C,0x90,0x38,0x82,0x20,0xB9,0xD9,0x9F,0x22,0x11,0x29,0xF1,0x0B,0x01,0x88,0x22,0x3A,0xC5,0xAC,0x89,0x31,0x92,0x2B,0xF8,0x0C,0xA8,0x09,0x28,0xF1,
+0x7B,0x96,0x9A,0x80,0x08,0x45,0x81,0xFA,0xAD,0x0A,0x52,0x54,0x13,0xB8,0xBD,0xBB,0x9A,0x21,0x44,0x32,0x12,0x10,0x81,0x00,0x99,0xDC,0xCC,0xBC,0xAB,0x08,0x62,0x34,
+0x35,0x23,0x02,0x98,0xCC,0xBD,0xAC,0x9B,0xAA,0x08,0x21,0x53,0x35,0x34,0x34,0x33,0x11,0x88,0xBA,0xCD,0xBB,0xCA,0xBA,0xA9,0xAA,0x9B,0x8A,0x00,0x42,0x34,0x43,0x12,
+0x11,0x09,0x88,0x51,0x43,0x45,0x33,0x34,0x12,0x22,0x01,0x89,0xDB,0xDA,0xAB,0xCB,0x9B,0x99,0x00,0x31,0x13,0x40,0xA0,0xBC,0xBA,0xCC,0xBB,0xB9,0xBB,0xEB,0x9B,0x08,
+0x00,0x62,0x82,0x99,0xCC,0xCC,0xAA,0x98,0x31,0x44,0x25,0x22,0x34,0x33,0x44,0x33,0x32,0x22,0x90,0xBB,0xBE,0x0B,0x81,0x89,0x10,0x88,0xA1,0x8F,0xA8,0x38,0xD0,0x98,
+0xBA,0xFA,0x9B,0xA9,0x52,0x00,0x32,0x55,0x02,0x00,0xD9,0x08,0xB8,0x89,0xB8,0xAA,0x9C,0xB0,0xBB,0xEF,0x98,0xBE,0xAA,0xAA,0x9A,0x81,0x29,0x16,0x51,0x01,0x91,0x09,
+0xB1,0x60,0xC0,0x18,0x19,0x85,0x9B,0xBB,0x03,0xAE,0x80,0xAC,0x11,0xA9,0x3A,0xE1,0x60,0x80,0x21,0x98,0x64,0x01,0x98,0x1A,0x80,0x12,0xAA,0xA9,0x89,0x25,0x01,0x8B,
+0x07,0x89,0x98,0xA9,0x57,0x08,0x23,0x10,0x32,0x88,0xB1,0x3B,0x24,0x01,0xB1,0x1C,0xAD,0x37,0x0A,0xA9,0x26,0x8E,0x01,0x89,0xA2,0xCA,0x1D,0x96,0x1C,0x90,0x18,0xAA,
+0x80,0xAB,0x82,0x29,0xD2,0x09,0x10,0x98,0xE8,0x8A,0x99,0x00,0xF2,0x8F,0xA1,0x0B,0x91,0x9B,0x80,0x98,0x28,0x02,0xE2,0x8F,0xA0,0x09,0x81,0x08,0x13,0xEC,0x1B,0x92,
+0x60,0x03,0xDC,0x29,0x13,0xAA,0x00,0x04,0x3B,0x17,0x19,0x04,0x30,0xB2,0x8C,0x03,0x8A,0x24,0x00,0x09,0xD2,0x8F,0x02,0x31,0x20,0x15,0x99,0x10,0x11,0xB8,0xAD,0x72,
+0x12,0x32,0x01,0xCB,0x30,0x31,0x14,0x62,0x84,0x3A,0x84,0x1B,0x27,0x98,0x89,0x20,0x80,0x81,0x68,0xA3,0x6A,0x83,0x28,0x81,0x31,0xA8,0xDA,0x0B,0x27,0x09,0x24,0xDC,
+0x29,0x25,0x99,0x80,0xCA,0x60,0x13,0x99,0x0B,0x85,0xAC,0x33,0x44,0xB1,0xAC,0x8B,0x45,0x43,0xA2,0xCB,0xAB,0x09,0x10,0x11,0x53,0x22,0x08,0x82,0xCF,0x89,0x9A,0xAA,
+0x28,0x35,0x12,0x81,0x19,0x81,0x22,0xFF,0x88,0x08,0x11,0x23,0x98,0x13,0x9B,0x83,0x9D,0xDA,0xDC,0x8B,0xA0,0x9D,0x90,0x08,0xB9,0x3A,0x13,0x81,0xBC,0x88,0x31,0x73,
+0x06,0x19,0x03,0x52,0x02,0x91,0x19,0x02,0xA0,0x9E,0xF9,0x9B,0xA9,0x89,0xBB,0xA9,0x68,0xC1,0x39,0x80,0x94,0x9E,0x11,0x08,0x91,0x8A,0x89,0x90,0xCC,0x80,0x9B,0x09,
+0x37,0x81,0x41,0xB0,0x30,0x47,0x80,0x89,0x33,0x16,0x30,0x84,0x73,0x10,0x24,0x10,0x14,0x08,0x00,0x52,0x02,0x63,0xA0,0x21,0xCA,0x10,0x09,0x11,0x99,0x35,0x31,0xD2,
+0x09,0x32,0x27,0xAC,0x11,0x21,0x11,0x40,0x06,0x9B,0x23,0xEA,0x18,0x88,0x1A,0x01,0x01,0x32,0x8F,0x06,0x19,0xB3,0x4A,0xF0,0x30,0x80,0x80,0x09,0x15,0x1B,0xA3,0x92,
+0x4A,0xA0,0x63,0xB0,0x2B,0x41,0xF2,0x28,0x99,0x28,0xC1,0x2A,0x14,0xBF,0x10,0x21,0xBD,0x80,0xAC,0x98,0x38,0xF0,0x8C,0x10,0xAB,0xFA,0x0A,0x01,0x08,0xC1,0x8C,0xAA,
+0x0B,0xA1,0xEC,0x28,0x89,0xC8,0x03,0x2F,0xF6,0x49,0xB0,0x10,0x88,0x80,0x08,0x00,0x90,0x09,0x90,0x29,0x10,0xC9,0x22,0xAF,0xA1,0x28,0x00,0x98,0x21,0xFA,0x09,0x18,
+0x13,0xAF,0x22,0x0A,0xA3,0xAF,0x11,0x21,0x92,0xAE,0x10,0x21,0xAA,0x11,0x32,0x90,0x18,0x42,0xE8,0x78,0x02,0x98,0x09,0x92,0x8A,0x92,0x3C,0xB4,0x78,0x91,0x1A,0x31,
+0xD2,0x0A,0x58,0x84,0x10,0x1C,0x07,0x99,0x18,0xA0,0x41,0x02,0x01,0x98,0x0B,0x36,0x88,0x11,0x23,0x18,0x47,0x11,0x89,0x41,0x12,0xA9,0x49,0xC1,0x39,0x32,0x46,0xA2,
+0x0B,0x81,0x51,0x03,0x18,0xAA,0x22,0x39,0x95,0x2B,0x27,0x9C,0x90,0x48,0xA2,0x28,0xCA,0x93,0xAF,0xD0,0x50,0x81,0x18,0x81,0x10,0xB8,0x90,0xDD,0xAB,0xEA,0x8A,0x88,
+0x00,0x50,0x26,0x18,0x32,0x03,0x08,0x21,0x46,0xB1,0x9D,0xCB,0xAA,0x0B,0xFA,0x8F,0x81,0x99,0x98,0x20,0x08,0x99,0xB9,0x58,0x21,0x82,0x51,0xB1,0x2A,0x93,0x19,0x92,
+0xA9,0x45,0x9A,0x82,0x8B,0xF1,0xAE,0x98,0x8C,0xA0,0xCC,0x28,0xA9,0x28,0x91,0xAC,0x12,0xDF,0x01,0x8D,0x01,0xA9,0x1B,0x84,0x9C,0x02,0x99,0x1A,0x24,0x88,0x71,0x92,
+0x8A,0xA0,0x9C,0x80,0x50,0x12,0x93,0x0B,0x15,0x30,0x05,0x0B,0x06,0x39,0x94,0xA9,0x0C,0x81,0xA1,0x70,0x85,0x00,0x18,0xA0,0x9D,0x02,0x9A,0x41,0xC2,0x3B,0x04,0x01,
+0xBC,0x40,0x06,0x08,0x20,0x80,0x0B,0x23,0xC8,0xAB,0x21,0xD2,0x2D,0x05,0x19,0x92,0x0A,0x06,0x0A,0xB0,0x1A,0x05,0x0B,0x13,0x26,0x29,0x02,0x11,0x12,0x2E,0x27,0x2B,
+0x03,0x11,0xDB,0x9A,0x53,0x92,0x8D,0x92,0x68,0xA0,0x31,0x80,0xDA,0x40,0x14,0x8A,0x83,0x1A,0x03,0x99,0x11,0x80,0x89,0x37,0x90,0xA1,0x9F,0x16,0x99,0x30,0xC0,0x39,
+0x05,0xAB,0x24,0xA1,0x1D,0x25,0xC8,0x3B,0xB2,0x1B,0x24,0xAB,0x11,0x10,0xC9,0x1A,0x27,0xBB,0x1A,0x17,0xAC,0x23,0xAA,0x82,0x0D,0xA2,0x30,0x80,0x10,0xC0,0x9B,0x1A,
+0x73,0x07,0x88,0xAD,0x21,0xA8,0x3A,0x95,0x09,0x9A,0xAB,0x04,0x7A,0xB0,0x40,0x99,0x92,0x0D,0x81,0x8C,0x88,0x13,0x8B,0x97,0x3A,0xF2,0x1A,0x00,0x80,0x29,0xA1,0x28,
+0xBA,0x25,0x8C,0xE1,0x2A,0x82,0x30,0x01,0x10,0x0A,0x85,0xAE,0xA8,0x9A,0x11,0xCE,0x18,0x25,0xB9,0x62,0x82,0x09,0x91,0x8B,0xFA,0x1A,0x22,0xAC,0x33,0xCA,0x63,0x80,
+0xB0,0x2B,0x22,0xF3,0x49,0xD8,0x40,0x02,0xCE,0x20,0x92,0x9A,0x90,0x73,0xC1,0x1A,0x26,0xA9,0x9B,0x20,0x01,0xA8,0x51,0x12,0xC8,0xAC,0x80,0x10,0x99,0x53,0x91,0x21,
+0xBC,0x32,0x9D,0x90,0xAC,0x72,0x23,0x00,0x43,0xB9,0x08,0xB9,0x89,0xED,0x9B,0x0A,0x33,0xEA,0x88,0x41,0x11,0x17,0x8B,0x13,0x00,0x11,0x09,0x92,0xDA,0xAE,0x29,0xB2,
+0x09,0x8B,0x37,0xAB,0x81,0x2A,0xA1,0x6B,0x25,0xB9,0x18,0xA0,0xBF,0xA0,0x2C,0x17,0x88,0x98,0x30,0x80,0x99,0x11,0xAE,0xB8,0x29,0x92,0x8C,0x47,0xAA,0x9C,0x53,0x11,
+0x91,0x9C,0x81,0x52,0x99,0x33,0xCB,0x18,0x00,0x21,0xF0,0x8C,0x22,0x12,0xA9,0xBE,0x32,0x8A,0x03,0xAA,0xDB,0x10,0xEB,0x38,0x16,0x99,0x01,0x52,0x80,0x10,0xA0,0x1A,
+0x23,0x13,0xBD,0xDB,0x29,0xC0,0x30,0x9A,0xD5,0x8E,0x82,0x20,0x33,0x83,0x60,0xA2,0x9A,0x89,0x55,0x02,0x81,0xBB,0x10,0x9A,0xB0,0x9D,0x53,0xA0,0x00,0xFC,0xAC,0x00,
+0x89,0x33,0x80,0x61,0x35,0xA0,0x19,0x88,0x34,0xFA,0x8B,0xA1,0x0B,0x04,0x28,0xA1,0x2A,0x36,0x42,0x82,0x08,0x99,0xFB,0x9B,0x88,0x00,0x88,0x43,0xE0,0x9B,0x08,0x22,
+0xA0,0x8E,0x13,0x90,0xAF,0x80,0x09,0x98,0x34,0x81,0x41,0x92,0x99,0x22,0x20,0x17,0xAE,0x99,0x09,0x80,0x39,0x85,0x9C,0xA2,0x9D,0x00,0xB9,0x38,0xC9,0x92,0x3B,0x06,
+0x10,0x24,0xC9,0x6A,0x05,0x89,0x19,0x13,0xDC,0x28,0x98,0x15,0x8B,0x13,0x91,0x8A,0x98,0x29,0xF2,0xAF,0x00,0x18,0xC8,0x28,0x1A,0x96,0x0C,0x82,0xC8,0x19,0x91,0x99,
+0x23,0xDB,0x40,0x80,0x98,0x49,0x47,0xBA,0x40,0x20,0xC3,0x2B,0x94,0x0B,0x92,0xA9,0x4B,0x96,0x2A,0x05,0x98,0x89,0x09,0x43,0x03,0xA9,0x18,0xCA,0x33,0x49,0x15,0x80,
+0x8A,0xD3,0x1D,0xA2,0x31,0xAC,0x04,0xAD,0x18,0x83,0x6A,0x85,0x1A,0x11,0x12,0xA9,0x09,0x80,0x30,0x21,0x79,0x37,0xBA,0x8C,0x02,0x20,0xB0,0x39,0xFC,0x5B,0xB2,0x0C,
+0x81,0x8A,0x42,0x91,0x18,0x93,0x8F,0xB1,0x3B,0x94,0x40,0x90,0x81,0x28,0x95,0x8A,0x23,0xEC,0x08,0x30,0x80,0x16,0x18,0xB0,0x8B,0x90,0x58,0xE1,0x29,0x11,0xA8,0x74,
+0xB0,0x20,0x8A,0xA0,0x08,0x50,0x85,0x18,0x09,0xA3,0x9E,0x01,0xB8,0x3A,0xE1,0x51,0x10,0xC2,0x1B,0xB0,0x19,0xB9,0x32,0xDC,0x48,0x04,0x99,0x8D,0x04,0x43,0xBB,0xC2,
+0x0A,0x29,0x96,0x44,0xAE,0x25,0xCB,0x31,0x01,0xAA,0x19,0xB8,0x71,0x01,0x80,0xA0,0xAF,0x88,0x30,0x43,0x81,0x11,0xDA,0xBE,0x08,0x21,0x22,0x43,0xA8,0x02,0x8C,0x82,
+0x31,0xFA,0x09,0xCB,0x99,0x2A,0x34,0x35,0x92,0xCA,0x99,0x99,0x44,0x11,0x24,0xB8,0x8B,0xEA,0x19,0x18,0x04,0x1B,0x16,0x80,0xBA,0x12,0xDD,0x10,0x98,0xB8,0x0D,0x93,
+0x09,0x20,0x03,0x21,0x73,0x93,0x8A,0x01,0xAE,0x20,0xB8,0x3A,0x90,0x57,0xCA,0x10,0x10,0xD9,0x11,0x10,0xEC,0x30,0xB1,0x9A,0x39,0x84,0x1B,0x12,0x16,0x9C,0x01,0x99,
+0x98,0x70,0x83,0x88,0xA8,0xCB,0x50,0x92,0x61,0xB0,0xAA,0xAA,0x10,0xD1,0x1B,0x44,0x90,0xAA,0x10,0x19,0x82,0x1E,0x05,0x8A,0xC8,0x89,0x10,0x52,0xA4,0x1C,0xC0,0x30,
+0xE9,0x21,0x99,0x23,0xAE,0x12,0x8B,0x93,0x6A,0xE0,0x89,0x10,0xA0,0x59,0x92,0x38,0x81,0x21,0xE0,0x9A,0x8B,0xA2,0x70,0x32,0xF1,0x1A,0x81,0x30,0x10,0xA3,0x58,0xE8,
+0xAB,0x12,0x4B,0xB4,0x49,0x90,0x02,0x89,0x9B,0x14,0x99,0x29,0x06,0x8C,0x88,0x83,0x3B,0x92,0x86,0x4B,0xF8,0x09,0x99,0x33,0x9B,0x37,0x09,0xC8,0x0B,0x21,0x98,0xE8,
+0x1A,0x21,0x92,0x79,0xC1,0x0A,0x89,0x33,0x19,0xD1,0x9E,0x12,0x10,0x89,0x24,0xCC,0x20,0x10,0xB9,0x31,0xBA,0x01,0x03,0x9D,0x8A,0x95,0x8F,0x15,0xB9,0x08,0x21,0x98,
+0x10,0xC1,0x8F,0x01,0x91,0x4A,0x85,0x9A,0x80,0x8E,0x13,0x08,0x80,0x81,0xA0,0xCF,0x21,0x92,0x3B,0x97,0x1C,0xA0,0x10,0x9A,0xAA,0x63,0x80,0xAB,0x83,0x9F,0xA8,0x80,
+0x0B,0x91,0x9D,0x73,0x82,0x9A,0x23,0xBC,0x8A,0x12,0x1A,0xE1,0x2B,0xF1,0x3A,0x92,0xB8,0x79,0xB2,0x18,0xC0,0x2B,0x91,0x36,0xAE,0x81,0x99,0x51,0x81,0x99,0x0A,0x30,
+0xD3,0x1C,0xB1,0x2A,0x23,0x33,0x90,0x9E,0x93,0xAF,0x22,0x9B,0x24,0x00,0x8A,0xC1,0x9E,0x03,0x2A,0xD0,0x30,0xBC,0x33,0x14,0x49,0x84,0x08,0x88,0x9A,0x37,0xAB,0xB2,
+0x2A,0xDB,0x10,0x53,0xB9,0x51,0xB9,0x03,0x0F,0x86,0x1A,0x21,0xD9,0x1A,0x99,0x82,0x1B,0x37,0x98,0xA9,0x60,0xE0,0x1A,0x03,0x11,0xA9,0x10,0x80,0x8C,0x92,0x3A,0x87,
+0x0B,0xB2,0x60,0xB9,0x53,0xA0,0xB9,0x8C,0x91,0x29,0x84,0x21,0x29,0xA6,0x0B,0x39,0x07,0x19,0x88,0xB0,0x8A,0x40,0xE8,0x19,0x41,0xB9,0x00,0x48,0x94,0xAB,0x00,0x31,
+0x24,0xFA,0x3A,0x03,0xAE,0x12,0x11,0xF9,0x30,0xB8,0x71,0xA0,0x30,0xE8,0x88,0x0A,0x03,0x1A,0x05,0xA9,0x38,0xC4,0x3B,0x84,0x0A,0x88,0x38,0x82,0x89,0x81,0x12,0xDB,
+0x00,0x48,0xA3,0x71,0x92,0x11,0x19,0xE2,0x4A,0xA2,0x8B,0x73,0x14,0x8A,0x05,0xBC,0x11,0x20,0x05,0x29,0x01,0xCE,0x38,0x99,0x32,0x31,0x17,0x8C,0x83,0x9C,0x80,0x31,
+0x90,0x88,0x48,0x93,0x98,0x63,0xFB,0x1A,0x03,0x68,0x92,0x1B,0x11,0x22,0xF8,0x9D,0x01,0x28,0x05,0x8A,0x18,0xCA,0x73,0x10,0xE8,0x3A,0x03,0xA9,0x00,0x89,0xAA,0x88,
+0x53,0xA0,0x89,0x74,0x82,0x9A,0xA1,0xAD,0x8A,0x25,0xFA,0x18,0x01,0x31,0x03,0x08,0x98,0xB9,0x89,0x3B,0x07,0x38,0x25,0xD8,0x9C,0x10,0xB9,0x29,0x92,0xCD,0x0A,0x13,
+0xAA,0x31,0x02,0x22,0x38,0x94,0xCB,0x79,0x15,0x22,0x98,0x89,0x19,0x25,0xB8,0xAB,0x52,0xA8,0x10,0xF1,0x9D,0x00,0x33,0xB9,0x58,0x02,0xBB,0x54,0xAA,0x13,0xBD,0x98,
+0x30,0xE9,0x18,0x00,0xA9,0x1A,0x24,0x99,0x02,0xBA,0x39,0x45,0x27,0x09,0x84,0x9C,0x20,0x14,0x9B,0xD8,0x50,0x90,0x00,0x33,0xCC,0x00,0x11,0x89,0xCB,0xA0,0x3A,0x04,
+0x34,0xDA,0x09,0x19,0x14,0x38,0xF1,0x0B,0x25,0x90,0x31,0xFC,0x30,0x91,0x9A,0x08,0x98,0x20,0x19,0x87,0x8C,0x80,0xAA,0x8C,0x26,0xC9,0x29,0xA1,0x3B,0xF4,0x1C,0x82,
+0x1A,0x88,0x26,0xCE,0x41,0xA8,0x08,0x28,0x91,0x01,0x9B,0x92,0x2C,0x17,0x9B,0x04,0xAA,0x10,0x88,0x80,0x3A,0x87,0x0B,0xC3,0x0C,0x11,0xA0,0x19,0x15,0xC9,0x8A,0x43,
+0xEA,0x38,0x82,0x9A,0x00,0xA8,0x1C,0x01,0xA1,0x58,0xE8,0x29,0x84,0x8B,0x18,0xD1,0x6A,0x93,0x90,0x29,0xC8,0x31,0xDC,0x31,0x01,0xB8,0x39,0xC0,0x2B,0xA6,0x1C,0xA3,
+0x19,0x91,0xBC,0x29,0x02,0x22,0x9F,0x06,0x9A,0x21,0xB9,0x38,0xB3,0xAF,0x32,0x93,0x1B,0xFA,0x28,0x48,0xF8,0x18,0x11,0xCA,0x30,0x92,0x8C,0x81,0x30,0x05,0xCC,0x32,
+0x92,0x09,0xBD,0x08,0x91,0x48,0xB2,0x51,0x80,0x98,0xEB,0x11,0x8C,0x17,0x00,0x88,0x99,0x82,0x99,0x9D,0x04,0x0C,0x14,0x09,0x83,0xAE,0x62,0xB1,0x0B,0x81,0x10,0xCD,
+0x72,0x90,0x8A,0x18,0x22,0xC9,0x48,0xB1,0x1A,0xA1,0x28,0x32,0xB3,0x9E,0x02,0xBD,0x42,0xA2,0x0C,0x94,0xBC,0x40,0xD0,0x40,0x82,0x98,0x08,0x88,0x80,0x1A,0xA3,0x6B,
+0xD2,0x9D,0x18,0x02,0x30,0x05,0xBC,0x58,0xD8,0x38,0x02,0xA1,0x1D,0x83,0x9F,0x30,0xB2,0x19,0x88,0x91,0x68,0xC0,0x00,0x49,0x85,0xA9,0x30,0xD0,0x09,0xAA,0x32,0x01,
+0x53,0xA0,0x08,0xBD,0xA9,0x72,0x92,0xAB,0x30,0xB9,0x32,0x71,0xA2,0x0A,0xB0,0xBF,0x31,0xB8,0x58,0x06,0xAA,0x00,0x80,0x98,0x31,0xB2,0x0D,0xB1,0x3B,0xA3,0x48,0x35,
+0xB8,0x9D,0x01,0x81,0x38,0x07,0x8A,0x18,0xF9,0x1E,0x14,0x8A,0x03,0x9B,0x99,0x22,0x88,0x99,0x55,0xC0,0xAA,0x19,0x14,0x23,0xDC,0x18,0x11,0x12,0xDB,0x38,0xA9,0x51,
+0x81,0xAA,0x24,0x9D,0x25,0x00,0xA8,0xAA,0xDA,0x0A,0x46,0xA1,0x30,0xC0,0x09,0x90,0x29,0xCA,0x33,0x8D,0x14,0x89,0x52,0x81,0x09,0x21,0xFB,0x8A,0xAA,0x52,0x26,0x09,
+0x02,0xBB,0x2C,0x05,0x8B,0x23,0xBC,0x02,0x30,0xC8,0x29,0xA4,0xDF,0x21,0x98,0x38,0x15,0x98,0x19,0x24,0x98,0x89,0x10,0xB0,0x8C,0xA9,0x98,0x70,0xC3,0x1B,0x04,0x09,
+0x80,0x88,0x2A,0x07,0xA8,0x0C,0x25,0xAA,0x21,0xCB,0x28,0x08,0x01,0x10,0x47,0xD9,0x99,0x2A,0x05,0x9C,0x33,0xB8,0xAB,0x61,0x12,0xB0,0xC9,0xAF,0x52,0x14,0x88,0xA0,
+0xBA,0xAE,0x00,0x10,0x43,0x01,0x32,0x92,0xCD,0x89,0x8A,0xB9,0x1A,0x35,0xA8,0x74,0x23,0xA8,0x9B,0xB9,0xAE,0x50,0x82,0x08,0x80,0x08,0xB8,0x9D,0x80,0x89,0x09,0x26,
+0x20,0x26,0x08,0x12,0xDA,0x3B,0x07,0x09,0x11,0x91,0x9B,0x22,0xEC,0x19,0x80,0x10,0xC9,0x60,0xB0,0x88,0x39,0xF2,0x4B,0x92,0x40,0x91,0x2A,0xD8,0x59,0x81,0x22,0xBB,
+0x33,0xBB,0x91,0x70,0xA1,0x08,0xAA,0x48,0x03,0x64,0xA1,0xBB,0x42,0xDB,0x10,0x99,0x44,0xD0,0x2A,0x32,0x90,0x8A,0xA0,0x0B,0x13,0x32,0x80,0x01,0xDB,0x76,0xE8,0x10,
+0xAA,0x62,0xA0,0x8A,0x12,0xC0,0x2A,0xA0,0x09,0x32,0xE9,0x48,0xA1,0x0B,0x54,0xB1,0x2C,0x92,0x8B,0x28,0xA2,0x60,0x98,0xB9,0x30,0xB8,0xB0,0x72,0xC2,0x29,0x15,0xCD,
+0x20,0xB1,0x1C,0x94,0x99,0x00,0x22,0x99,0x25,0xBF,0x42,0xB0,0x9C,0x11,0x00,0x8C,0x05,0x8A,0x81,0x19,0xD9,0x18,0x3A,0x37,0x9F,0x92,0x1B,0x04,0x0A,0x88,0x80,0x3A,
+0x94,0x9D,0x90,0x1A,0x25,0x91,0xAC,0x48,0x92,0x19,0xC9,0xBB,0x28,0x44,0xA1,0x9A,0x51,0xD9,0x29,0x02,0x8B,0x13,0x8A,0xC9,0x9D,0x35,0x90,0x91,0x2B,0x17,0xAB,0x08,
+0x91,0x8D,0x02,0x1A,0x84,0xAB,0x43,0xA1,0x0C,0x00,0x13,0xAA,0x52,0x46,0xA0,0x3A,0xF0,0x29,0x82,0x00,0x01,0xC8,0x0C,0x81,0x20,0x43,0xF8,0x5A,0xA2,0x19,0x91,0x0A,
+0xB2,0x9E,0x53,0x81,0x19,0x91,0x00,0xBC,0x73,0xE8,0x1B,0x13,0x89,0x00,0x29,0x90,0x50,0xA3,0x0C,0xC0,0x51,0x00,0xC0,0x18,0x8E,0x07,0x9A,0x31,0xB0,0x0A,0x00,0x90,
+0x89,0xAA,0x39,0x94,0x08,0xBB,0x28,0xC1,0x8C,0xDF,0x10,0x18,0x81,0x08,0xFA,0x1C,0x93,0xB9,0x1A,0x85,0x09,0x89,0xB1,0xAF,0x17,0x98,0xA1,0x8A,0x12,0xDB,0x11,0x08,
+0x81,0x9A,0x51,0xE9,0x28,0x98,0x20,0x93,0x9D,0x80,0x8A,0x26,0x08,0xA3,0x0F,0x03,0xAA,0x28,0x16,0xAA,0x80,0x71,0xC0,0x19,0x19,0xA1,0x2A,0x00,0xB2,0x3D,0xC3,0x5B,
+0x93,0x9E,0x18,0x21,0xC1,0x39,0x25,0x80,0x82,0x9D,0x89,0x12,0x9A,0x15,0x80,0x89,0x80,0x9A,0x13,0x31,0x33,0xFA,0x71,0x90,0x12,0xD8,0x0E,0x16,0x08,0x98,0x21,0xC1,
+0x1A,0xB0,0x74,0xA0,0x08,0x98,0x31,0x10,0x81,0x9B,0x00,0x73,0x94,0x08,0xBE,0x31,0xB8,0x29,0x45,0xA0,0x8B,0x89,0x34,0xB8,0xAF,0x99,0x21,0x32,0xA0,0x1A,0xF1,0x1E,
+0x13,0x98,0x89,0x20,0xDB,0x31,0xA8,0x55,0x98,0x22,0xDB,0x08,0x32,0xB9,0x26,0xBA,0x31,0xA9,0x73,0x04,0xC9,0xAB,0xB8,0x58,0x84,0x18,0xB0,0xDB,0x50,0xB0,0x28,0xA0,
+0x65,0x90,0x88,0x9B,0xCA,0x38,0x20,0x14,0x18,0x12,0xEE,0x18,0x11,0x02,0xBA,0x68,0x01,0xA8,0x0B,0x93,0x1B,0x44,0x02,0xDB,0x0A,0x45,0xC8,0x29,0x98,0x21,0x10,0x81,
+0x9C,0x00,0x89,0x05,0x8B,0x26,0x99,0x00,0x29,0xB8,0x41,0x18,0xB8,0x77,0x90,0xCC,0x33,0x3A,0xE4,0x28,0x2A,0xB7,0x9F,0x26,0xBA,0x20,0xA1,0x9B,0x64,0x91,0x89,0xBA,
+0x09,0x34,0x02,0x80,0x9B,0xAB,0x33,0x88,0xBA,0x11,0x0B,0x47,0x23,0x98,0x18,0xCA,0xDC,0x1A,0x91,0x65,0x90,0x00,0x19,0x80,0xA8,0x8C,0xB9,0x48,0x00,0x15,0x70,0x91,
+0x88,0xAC,0x90,0x48,0x83,0x89,0x11,0xB1,0xAE,0x09,0x82,0x9A,0x42,0x14,0x8A,0x18,0x90,0x43,0xDD,0x20,0x05,0x9B,0x13,0x9A,0x11,0xB0,0x9D,0x32,0xBA,0x43,0xC8,0x0B,
+0x22,0x82,0xAC,0xAB,0x01,0x09,0x67,0x90,0x99,0x8A,0x98,0x60,0x05,0x09,0x03,0x00,0xA0,0x0B,0x13,0x30,0xE2,0xBA,0x28,0xCD,0x13,0x72,0xB0,0x0D,0xC0,0x39,0xA0,0x9C,
+0x02,0x13,0x8D,0x23,0x94,0x8F,0x90,0x10,0x8A,0xC8,0x53,0xCE,0x42,0xAA,0x18,0x10,0x01,0x08,0xCC,0x72,0xB0,0x40,0x00,0xAA,0x08,0x00,0x08,0x86,0xAB,0x91,0x29,0x04,
+0x09,0xD1,0x58,0xBA,0x42,0x90,0x08,0x8C,0x94,0x39,0xC8,0x2A,0x85,0x11,0x0B,0x01,0xDD,0x22,0x8C,0x02,0x03,0x9B,0x7B,0xB2,0x08,0x82,0xAD,0xBA,0x21,0x13,0x1C,0xEB,
+0x12,0x39,0x99,0xD9,0x8A,0x84,0x2F,0xB1,0x08,0x38,0x9F,0x02,0x07,0x9F,0x05,0x9B,0x12,0x01,0xAC,0x02,0x22,0xAA,0x01,0x9D,0x43,0x90,0x20,0xB8,0x98,0x4B,0xF1,0x29,
+0x12,0x98,0x20,0x12,0x89,0xCC,0x28,0xB1,0x1F,0x82,0x08,0x9A,0x45,0xB0,0x0B,0x22,0xCA,0x21,0x00,0xFA,0x1D,0x04,0x09,0x82,0x9C,0x10,0x21,0x8A,0x04,0x52,0xE8,0x19,
+0x23,0xE9,0x9D,0x10,0x32,0x03,0x20,0xE8,0x9B,0xAA,0xA8,0x1A,0x35,0x21,0x23,0x22,0xD9,0x0B,0xB1,0xBF,0x00,0x43,0xCA,0x8B,0x92,0x9C,0x01,0x60,0x05,0x09,0x32,0x80,
+0xC9,0x0C,0xC2,0x2B,0x02,0xBB,0x41,0xD9,0x18,0x01,0xA9,0x13,0x0C,0x35,0xD9,0x0B,0x02,0x11,0xAE,0x83,0x2E,0xA5,0x1C,0x05,0xAD,0x32,0x80,0x99,0x48,0x25,0xA9,0xA9,
+0xAD,0x31,0x22,0x08,0xE0,0x2A,0xD0,0x29,0x23,0x11,0x12,0xFB,0x28,0xB8,0x9A,0x51,0x03,0x8A,0xE0,0x8C,0x10,0x31,0x80,0xEA,0x0B,0x26,0x11,0x01,0xB9,0xBF,0x18,0x08,
+0x46,0x90,0x40,0xA0,0x09,0x90,0xCB,0x9B,0xD8,0x9A,0x88,0x32,0x21,0x17,0x28,0x15,0x31,0x42,0x01,0x00,0xC9,0x0A,0xA0,0xCF,0x09,0xC9,0x89,0x00,0x81,0x0A,0x34,0x00,
+0x90,0x18,0xC8,0x22,0x8D,0x84,0x50,0x03,0x89,0x73,0xA8,0x10,0x1B,0xA7,0x2A,0xDB,0x13,0x9F,0x23,0xA9,0x29,0x03,0x19,0x19,0x87,0xAD,0x89,0x11,0x99,0x41,0x11,0xA9,
+0x19,0x12,0x99,0x41,0x93,0xAF,0x98,0x0B,0x47,0xA0,0x09,0x01,0xAB,0x42,0x80,0x03,0x0C,0x91,0x9A,0x50,0x33,0x86,0x19,0xBA,0x52,0x98,0x12,0x9C,0x13,0x98,0x2C,0xD1,
+0x73,0xA2,0x08,0xC8,0x0A,0xB0,0x1E,0x15,0x08,0x00,0x02,0x18,0x90,0x01,0xB9,0x3B,0x57,0x88,0xCA,0x60,0xA1,0x19,0x02,0xA0,0x0C,0x25,0xA8,0xDB,0x30,0x08,0x37,0x90,
+0x9B,0xA1,0x1E,0xA2,0x58,0x91,0x38,0x85,0xBC,0x21,0xBA,0x00,0x33,0xBA,0x18,0x07,0x9A,0x21,0x93,0x88,0x09,0xD9,0xAC,0x00,0x0C,0x16,0x20,0x09,0x04,0x9F,0x45,0xC9,
+0x29,0x81,0x0C,0x91,0x1A,0x83,0x48,0xC2,0x0A,0x11,0x98,0xBD,0x59,0x05,0x9A,0x80,0xB8,0x0A,0x21,0xC0,0x12,0xAF,0x42,0x84,0x8C,0x00,0xA8,0x73,0xB8,0x19,0x33,0xC8,
+0x39,0x94,0xBC,0x40,0xA1,0x1B,0x16,0x8B,0x31,0x05,0xAA,0x98,0xA0,0x2C,0x14,0x81,0xAC,0x34,0xD9,0x0B,0x33,0x84,0xAE,0x02,0x9A,0x52,0x92,0xCE,0x58,0x83,0x1A,0xB1,
+0x1B,0x99,0x34,0x18,0xF8,0x2A,0x05,0x9A,0x11,0x10,0x03,0xBD,0x10,0x11,0x12,0xCD,0x11,0xB8,0x60,0xB2,0x0B,0x02,0x0A,0xA2,0xCB,0x61,0xE8,0x60,0xB1,0x2B,0x84,0x8A,
+0x01,0x30,0xE0,0x1A,0x12,0x90,0xAC,0x21,0xFA,0x49,0x04,0xBA,0x20,0x91,0x90,0x4A,0x83,0x90,0xCB,0x2A,0x86,0xAB,0x28,0xA0,0x22,0x9C,0x23,0xAC,0x72,0xC2,0x1C,0x81,
+0x08,0x99,0x39,0x26,0x10,0xFB,0x1B,0x83,0x0C,0x01,0xB0,0x2C,0x85,0x89,0x34,0x90,0xCC,0x8A,0x81,0x20,0xB0,0x00,0xCB,0x56,0x90,0x08,0xB8,0x0C,0x91,0xAC,0x52,0x81,
+0xAA,0x46,0xB0,0x09,0x02,0x99,0xCA,0x38,0xA1,0x00,0xCA,0x0B,0x57,0x9C,0x01,0x00,0x90,0xCA,0x19,0x47,0xA9,0x20,0xE8,0x0A,0x92,0x09,0x91,0x20,0x88,0xB3,0x9E,0x20,
+0x21,0xA8,0xAC,0xBB,0x69,0x25,0x80,0xBD,0x34,0xB9,0xBA,0x70,0x91,0x8A,0x38,0x85,0x99,0x31,0xC1,0x9B,0x2A,0x17,0x89,0xCA,0x18,0x12,0xB0,0xC9,0x4B,0x94,0x8B,0x81,
+0x8C,0x23,0xC8,0x0D,0x33,0xFA,0x0A,0x08,0x01,0x0A,0x25,0x9A,0x90,0x2A,0x25,0x10,0x10,0xA3,0x0C,0xBD,0x36,0xA2,0xAC,0x80,0x43,0xA8,0x90,0x99,0xE8,0x7B,0x95,0x8B,
+0x01,0x28,0x01,0xA8,0x9C,0x99,0xFB,0x71,0x82,0x9A,0x91,0x2A,0xB0,0x71,0x81,0x09,0xA8,0x08,0x9B,0x56,0xB1,0x1B,0x83,0x0B,0xC1,0x9B,0x08,0x46,0xB1,0x2B,0x36,0xC9,
+0x1B,0x11,0xB2,0x9F,0x34,0xBB,0x32,0x91,0x09,0x91,0x19,0xC8,0x8E,0x10,0x98,0x21,0x46,0xE8,0x28,0xC9,0x18,0x22,0xC8,0x1B,0x01,0x01,0x8A,0x21,0x11,0xD8,0x1C,0xC2,
+0x68,0xB1,0x29,0xA1,0xA9,0x41,0xFA,0x2A,0x43,0xA0,0x29,0x04,0xA9,0x0B,0xD0,0x3A,0x47,0xA9,0x18,0x83,0x8D,0x22,0x98,0x21,0x88,0x04,0x30,0xFC,0x6B,0x92,0x8A,0x22,
+0xD9,0x0A,0x40,0x03,0x9C,0x32,0x80,0xA8,0x21,0x10,0xF9,0x20,0xA0,0x9B,0x25,0x0A,0xE3,0x7B,0xA4,0x0C,0x15,0xAA,0x21,0xB1,0x0D,0x25,0xBB,0x28,0x91,0x29,0x84,0x28,
+0xB8,0xCA,0x4A,0x03,0x1A,0x06,0xAA,0x90,0x31,0x91,0x90,0x9E,0x43,0x01,0x20,0xFA,0x48,0xB0,0x19,0x02,0x28,0xA3,0xBF,0x52,0x80,0x92,0x8E,0x81,0x18,0x23,0xDA,0x38,
+0x13,0x99,0x10,0xE9,0x29,0x11,0xA1,0x1C,0xDA,0x20,0x52,0x85,0xAC,0x80,0x40,0x81,0xB0,0x6A,0x82,0x00,0xA9,0x69,0x13,0xCA,0x49,0xA2,0xAD,0x30,0xB0,0x30,0x90,0x34,
+0x8E,0x07,0x8B,0x90,0x00,0x99,0x23,0x81,0x42,0x23,0xDF,0x51,0xC0,0x28,0xA1,0x09,0x11,0x03,0xC9,0x40,0xF8,0x20,0x01,0xC8,0x38,0xA2,0x2A,0x05,0x10,0xC9,0xDB,0x29,
+0x92,0x79,0x85,0x09,0x01,0xFB,0x28,0x80,0x89,0x11,0x21,0xB1,0x3A,0x03,0x9F,0x01,0x18,0xE8,0x19,0x91,0x49,0x34,0xD1,0x8E,0x12,0x08,0x81,0x99,0xA1,0xAD,0x32,0xBA,
+0x35,0x30,0xA2,0xB9,0xCF,0x18,0x14,0xA8,0x28,0xF8,0x49,0x01,0x90,0xAB,0x50,0xC1,0x39,0xA2,0x40,0x98,0x01,0x8D,0x10,0xB0,0x2B,0x88,0x93,0x79,0xC0,0x10,0x91,0x9D,
+0x25,0xA9,0x29,0xB2,0x1B,0x01,0x60,0xC1,0x1A,0xB9,0x30,0x84,0x8B,0x62,0xB2,0x0B,0x50,0xF1,0x59,0x90,0xB8,0x48,0xB8,0x40,0x81,0x12,0xBF,0x31,0x80,0x10,0xB0,0xAD,
+0x60,0x00,0x00,0x21,0xDB,0x00,0x18,0x30,0xD3,0x29,0xF0,0x0B,0x06,0x99,0x0A,0x07,0x9A,0xA0,0x6A,0x97,0x0D,0x84,0x09,0x8A,0xA2,0x60,0xB9,0x03,0x2A,0xB1,0x11,0x0E,
+0xA1,0x28,0x10,0xA1,0x3A,0xCB,0x13,0x29,0xC2,0x88,0x1D,0xA2,0x1B,0x61,0x92,0x52,0xCA,0x80,0x9C,0x00,0x82,0x3B,0xB3,0x73,0xA9,0x01,0x01,0xAE,0x01,0x00,0xAF,0x22,
+0x10,0xA8,0x80,0x08,0xEA,0x10,0xBA,0x30,0x17,0x89,0x33,0x80,0xD0,0x1B,0xFA,0x00,0x20,0xC0,0x8A,0x75,0xC8,0x3A,0x01,0x80,0xAB,0x10,0x33,0xC8,0xBA,0x9D,0x73,0x81,
+0xA8,0x1A,0x21,0x84,0xAF,0x00,0x00,0x01,0x20,0x80,0xB8,0x1C,0xC2,0x58,0xA2,0x0D,0x83,0x1B,0x15,0x08,0xA9,0x9B,0x28,0x04,0x8C,0x15,0x9D,0x81,0x40,0xC1,0x1A,0x25,
+0xBA,0x88,0x09,0x22,0xFA,0x29,0x90,0x22,0x99,0xDA,0x38,0x22,0x04,0x31,0xFD,0x39,0x90,0x8B,0x42,0xC0,0x0C,0x14,0xA8,0x1B,0x15,0x9B,0x11,0x80,0x20,0xF9,0x30,0xEB,
+0x18,0x20,0x03,0x8B,0x03,0x8E,0x03,0x18,0x9C,0x37,0xC9,0x30,0xB1,0x9B,0x80,0x11,0x81,0x08,0xFB,0x10,0xBB,0x73,0x22,0xA8,0xA1,0xAD,0xBA,0x31,0xCA,0x54,0xA8,0x41,
+0xDA,0x20,0xA9,0x32,0x90,0x99,0x72,0x86,0x9B,0x22,0xB9,0x29,0xB9,0x72,0xB2,0x1D,0x45,0xB9,0x8B,0x63,0xC1,0xBD,0x0B,0x55,0x24,0x01,0x80,0xEC,0xBC,0x9A,0x00,0x21,
+0x73,0x45,0x33,0x81,0xEB,0xBC,0xAC,0x89,0x18,0x43,0x34,0x24,0x12,0x98,0xB9,0xBD,0xBC,0xAB,0x9A,0x10,0x53,0x34,0x43,0x33,0x22,0x98,0xBB,0xBD,0xAC,0xAB,0x8B,0x20,
+0x32,0x22,0x22,0x42,0x21,0x91,0xCC,0xAC,0xDB,0xBC,0x9C,0x09,0x42,0x45,0x34,0x22,0x12,0x80,0xBB,0xCD,0xBB,0xBB,0x89,0x20,0x24,0x21,0x23,0x01,0x98,0x20,0x14,0x99,
+0x42,0x81,0x11,0x12,0xB8,0xAB,0xEC,0x9B,0xC9,0xDF,0x9A,0xBA,0xAA,0x11,0x80,0x54,0x43,0x44,0x22,0x43,0x82,0x80,0x90,0xBC,0xCB,0xAC,0xCA,0x9A,0xA9,0x28,0x93,0x1A,
+0x37,0x22,0x32,0x23,0x20,0x14,0x08,0x03,0x9B,0xFA,0xBC,0xAF,0x88,0x8A,0x08,0x21,0x32,0x35,0x02,0x28,0xC1,0x8E,0x81,0x0A,0x36,0x10,0x24,0xA0,0x19,0xC2,0x8E,0x98,
+0xAB,0xCA,0x89,0x01,0x30,0x26,0x21,0x02,0x00,0x9A,0xA0,0xBF,0x00,0x01,0x8A,0x02,0x18,0x00,0xEA,0xCB,0xDF,0x2A,0x35,0x82,0x8A,0x42,0x53,0x33,0xD1,0xAE,0x00,0xA8,
+0x08,0x81,0x00,0x11,0x90,0x88,0x29,0x14,0x09,0xFA,0x0A,0x34,0xB0,0x8A,0xA0,0x4A,0x03,0x8B,0x13,0xFA,0x8B,0x82,0x4B,0x87,0xAC,0x31,0x01,0x72,0x83,0xBD,0x20,0x00,
+0x89,0x20,0x88,0x80,0xB9,0xBE,0x40,0xA8,0x51,0x34,0x90,0x62,0xC8,0x89,0x8A,0x11,0xA2,0x9F,0x04,0x0A,0x03,0x9A,0x0A,0x02,0x8A,0xA0,0x9C,0x14,0xBB,0x71,0x94,0xAD,
+0x42,0xA1,0xAC,0x12,0x99,0x11,0x12,0x22,0x88,0x24,0x9A,0x25,0xDA,0x8B,0x44,0xC9,0x0C,0x34,0x90,0xC9,0x1A,0x27,0x88,0x98,0x99,0xBA,0x21,0xCC,0x89,0x33,0x99,0x43,
+0x32,0x08,0x57,0xDB,0x28,0xD8,0x2A,0xC0,0x3A,0x94,0x3B,0x27,0x9C,0x11,0x00,0xAA,0xA8,0x29,0x13,0xDA,0x68,0xC0,0x39,0xA2,0xCB,0x38,0xA8,0x52,0x91,0x09,0x41,0x03,
+0xAA,0x9A,0x34,0xEE,0x20,0xB8,0x1A,0x83,0x3A,0x16,0x89,0x31,0xF9,0x29,0xB0,0x48,0xA1,0x9C,0x11,0x19,0x91,0x20,0xA8,0x54,0x11,0xFB,0x0B,0x13,0xC9,0x28,0x02,0xDB,
+0x62,0xB0,0x29,0x83,0x8D,0x14,0xAA,0x08,0xAA,0x50,0xC0,0x4A,0x93,0x8D,0x04,0xAB,0x88,0x08,0x40,0xA1,0x08,0x9C,0xB2,0x0F,0x07,0x9A,0x22,0xA1,0xAB,0xC8,0x2C,0x05,
+0x9C,0x42,0x81,0x99,0x18,0xB1,0x1D,0xB2,0x0F,0x82,0x30,0x01,0x10,0x9B,0x16,0xAC,0x08,0xA0,0x0F,0x13,0xBC,0x18,0x32,0xE0,0x2A,0x06,0x0A,0x23,0xA8,0x20,0x80,0x88,
+0x88,0x9A,0x55,0x92,0x0A,0x03,0xAD,0x81,0x09,0x91,0x9A,0x20,0x21,0x93,0x51,0xEA,0x09,0xB9,0x70,0x86,0x8A,0x35,0xFB,0x3A,0x93,0x09,0x98,0x48,0x94,0x4B,0xC4,0x0B,
+0xC9,0x50,0x00,0x12,0xCB,0x9A,0x88,0x8A,0x64,0x03,0xBA,0x28,0xC1,0x1C,0xB4,0x1D,0x91,0x18,0xA0,0x28,0x93,0x28,0xDF,0x42,0xB9,0x42,0xA0,0x0A,0xB2,0x8B,0x88,0x12,
+0x73,0xB2,0x8E,0x81,0x08,0x0A,0x03,0x0B,0x24,0xA1,0x9A,0x1A,0x04,0xBD,0x38,0x13,0x72,0x84,0x9C,0xA8,0x38,0x96,0xAE,0x20,0x03,0x1C,0x06,0x0B,0x95,0x1D,0x83,0x8A,
+0x80,0x29,0xA1,0x2A,0x15,0xA0,0x8A,0x35,0xB1,0x1B,0x81,0x24,0x9D,0x14,0x18,0x91,0x10,0xFA,0x1C,0x03,0x99,0x31,0xB2,0x6B,0x85,0x0D,0x15,0xAB,0x12,0x8A,0x03,0xBF,
+0x40,0x82,0x00,0xA0,0x40,0xA1,0x0B,0x21,0xC3,0x9F,0x11,0xAA,0x28,0x36,0x90,0x29,0xA0,0x98,0x0B,0xF0,0x19,0x19,0x14,0x0B,0x25,0xE8,0x1A,0x03,0xAA,0x62,0x02,0xB9,
+0x9B,0x38,0xB8,0xB0,0x2F,0xB6,0x3A,0x84,0xAD,0x33,0xA8,0x22,0xA9,0x90,0x8B,0x14,0x58,0xD3,0x5A,0xD1,0x8B,0x22,0x88,0x62,0xA1,0x18,0x80,0xA0,0x8B,0x19,0x83,0x20,
+0x8A,0xC2,0x71,0xC9,0x99,0x49,0x26,0x98,0x29,0xA2,0x9A,0x8B,0xA8,0x57,0x88,0x20,0xB9,0x38,0x02,0xBB,0xA0,0x2D,0xC3,0x79,0x06,0x0B,0x93,0x8A,0xAA,0x44,0xCB,0x00,
+0x10,0xAA,0x55,0xA8,0x89,0xBA,0x08,0x30,0x41,0xB2,0x58,0xFC,0x48,0x90,0x39,0xA2,0xAB,0x20,0x13,0xDA,0x19,0x0A,0x37,0xC9,0x00,0x90,0x2B,0x86,0xAA,0x42,0xC0,0x10,
+0xCA,0x19,0x07,0x0B,0xA3,0x9D,0x02,0x18,0x91,0x23,0xAC,0xB0,0x78,0xB3,0x3A,0x85,0x9D,0x13,0x99,0xAC,0x45,0x90,0x00,0x0A,0x12,0x9C,0x91,0x3B,0x47,0x89,0xC3,0x1C,
+0x91,0x8C,0x24,0x89,0x23,0x9A,0x80,0x40,0xC2,0x1B,0x23,0xDC,0x40,0x93,0x18,0xCA,0x81,0x3B,0x07,0x09,0x88,0x42,0xC8,0x0B,0x03,0x29,0x14,0xB0,0xEA,0x0D,0x36,0x14,
+0xFB,0x9A,0x29,0x33,0x23,0x82,0xFC,0x9B,0x08,0x62,0x12,0x01,0x98,0xB9,0xAB,0xCB,0x9A,0x41,0x45,0x82,0x88,0x00,0x80,0xB9,0xAB,0x98,0xAF,0x20,0x34,0x88,0x11,0xAC,
+0x31,0xE8,0x2A,0x95,0x8B,0x25,0x98,0x19,0xF8,0x2B,0x85,0x0B,0x14,0xAC,0x43,0xB0,0x8A,0xA0,0x9C,0x54,0xA1,0x1A,0xB0,0x8C,0x01,0x2A,0x07,0x0A,0x22,0xA8,0x9A,0x19,
+0xC9,0x09,0x31,0xA0,0x99,0xBA,0x72,0x87,0x8A,0x89,0x01,0xBA,0x48,0x03,0xBC,0x20,0x93,0x0D,0xF0,0x49,0xC0,0x18,0x02,0x88,0x8A,0x90,0x30,0xB0,0x9E,0x43,0xBB,0x72,
+0xD8,0x38,0x92,0x01,0xC9,0x9C,0x22,0x98,0x1A,0xC8,0x31,0xA0,0x0B,0x85,0x29,0x11,0xD0,0x99,0x8D,0xB1,0x1C,0x52,0xB1,0xAE,0x51,0xA8,0x43,0xB8,0x10,0xDB,0x20,0xB9,
+0x08,0xC8,0x60,0x01,0x82,0xA9,0x1C,0xF1,0x5A,0x84,0x9A,0xA1,0x40,0x92,0x8A,0xBA,0x2B,0x17,0x9A,0x08,0x02,0x21,0xC9,0xB9,0x78,0x92,0x88,0x98,0x08,0xA3,0x9F,0x02,
+0x18,0x45,0x98,0xF9,0x3A,0xA1,0x89,0x59,0x94,0xAC,0x42,0xBB,0x33,0xDB,0x72,0xD9,0x28,0x11,0x90,0x89,0x8A,0x21,0x91,0x19,0xBA,0xA8,0x48,0x02,0x81,0x69,0x94,0x2A,
+0xD3,0x1D,0x82,0xBB,0x45,0x91,0xAB,0x11,0x53,0x80,0x98,0xC0,0x9F,0x24,0x91,0x0D,0x04,0x9B,0x22,0x9E,0x25,0xBD,0x41,0x82,0x08,0xC9,0x28,0x04,0xBA,0x11,0xBC,0x73,
+0x82,0xBA,0x88,0x31,0xB8,0x8B,0x36,0x81,0x99,0x9B,0x63,0x81,0x98,0x9A,0x89,0x25,0xBC,0x78,0x92,0x29,0xA2,0x8A,0xB0,0x0C,0x03,0x9B,0x35,0x00,0x01,0x41,0xBA,0xA2,
+0x2B,0xF9,0xAE,0x31,0x14,0xA9,0x23,0x48,0x16,0xC9,0x8A,0xA8,0x8B,0xA1,0x4A,0x26,0x34,0xA1,0x48,0xB1,0x8B,0x22,0xA0,0x19,0x10,0xF9,0x2A,0x14,0x00,0xCA,0xAA,0xAD,
+0x28,0x06,0x28,0xA1,0x42,0xBC,0xB0,0x4B,0xA3,0x9D,0x28,0x02,0x0D,0x36,0x10,0x82,0x00,0xFB,0x0A,0x51,0x14,0x99,0xB0,0x1B,0x12,0x24,0xC8,0x2B,0x93,0x28,0xCA,0x8C,
+0x23,0x49,0xF0,0x0A,0x99,0x00,0x10,0x52,0xEC,0x18,0x88,0x02,0xCA,0x0A,0x23,0x40,0x06,0xBA,0x1A,0xA8,0x32,0xFB,0xAA,0x39,0x44,0x82,0x18,0xA2,0x9C,0x23,0x31,0x80,
+0xAC,0x77,0x84,0x89,0x98,0x89,0x11,0xCA,0x10,0xFB,0x38,0xB9,0x00,0xA8,0x08,0x36,0xA8,0x28,0x92,0xBC,0x38,0xB1,0x4A,0x65,0x02,0x02,0x9A,0x16,0x1A,0x24,0x9C,0x25,
+0xAA,0x88,0x98,0x29,0xF0,0x28,0x98,0x88,0x00,0x0A,0xB3,0x9F,0x63,0xC0,0x1A,0x23,0x80,0x09,0x63,0xA1,0x8A,0x9A,0x22,0xBA,0x81,0x0F,0xA3,0x5C,0x93,0x39,0x04,0xAE,
+0x63,0x99,0x30,0xB8,0x48,0x81,0x0A,0x25,0x08,0x12,0x0A,0x92,0x2C,0x17,0xCA,0x20,0x03,0xCB,0x28,0x33,0xDC,0x50,0xA0,0x99,0x88,0x88,0x1A,0x20,0x24,0x0A,0xE3,0x9F,
+0x13,0x89,0x00,0x08,0x11,0x0B,0x97,0x0C,0xA8,0x13,0x0D,0xB9,0x36,0xAA,0x89,0x15,0x9E,0x90,0x38,0xC1,0x29,0x11,0xA0,0x0D,0x91,0x8A,0x12,0x8B,0x06,0x28,0xF1,0x1F,
+0x04,0x0A,0x91,0x10,0xAA,0x40,0xFA,0x78,0xA0,0x09,0x01,0x99,0x12,0xAA,0x08,0x32,0xF9,0x2A,0x88,0x33,0x08,0xFB,0x38,0x02,0x10,0x83,0xCF,0x18,0x01,0x08,0x9B,0x41,
+0x01,0xDB,0x28,0x90,0x02,0x8C,0x44,0xC8,0x09,0x8C,0x24,0x08,0x90,0xAA,0x1A,0x32,0x22,0x91,0xBF,0x72,0x90,0x90,0x9C,0x91,0xAA,0x1A,0x13,0xC0,0x8C,0x53,0xF0,0x29,
+0xA1,0x82,0x8D,0x33,0x93,0x9F,0x12,0x9A,0x82,0x0D,0x26,0xB8,0x9D,0x71,0x91,0x8A,0x01,0x98,0x08,0x18,0xA3,0x8F,0x02,0x99,0x13,0x99,0x90,0x29,0xC8,0x00,0xBB,0x01,
+0x22,0xBC,0x04,0xAF,0x42,0x91,0x9A,0xBA,0x78,0x04,0x99,0x81,0x0A,0x01,0x25,0xBB,0xBA,0x29,0xB1,0x2C,0x81,0x67,0x90,0x08,0x80,0xAA,0x10,0x04,0x29,0x81,0x04,0xAF,
+0x09,0x14,0x9A,0xD9,0x41,0x88,0x15,0xBB,0x0C,0x92,0x8B,0xB1,0xBF,0x39,0x81,0x00,0xAA,0x88,0x01,0x9F,0x81,0xCA,0x9F,0x31,0x80,0x98,0x1A,0xCA,0x12,0xCD,0xAB,0x36,
+0xB8,0x29,0x00,0xA1,0x1E,0x14,0x41,0xFA,0x2A,0x91,0x28,0x35,0xDA,0x18,0xA0,0x28,0x11,0xB9,0x39,0x87,0x19,0xA3,0x0B,0x59,0xA4,0x6B,0x94,0x0B,0x12,0x89,0xB9,0x38,
+0x20,0x47,0xB8,0xAA,0x1A,0x26,0x90,0x0A,0x80,0x02,0x9F,0x43,0xD8,0x89,0x90,0x49,0x14,0x8A,0x81,0x2A,0xD1,0x9B,0x82,0x8E,0x04,0x89,0xA0,0x38,0xC3,0x6A,0xC1,0x19,
+0xA2,0x8C,0x13,0x29,0xA3,0x4A,0xB2,0x8D,0x22,0xBB,0x09,0xD3,0x2E,0x85,0x00,0x89,0x85,0x1C,0x92,0xAC,0x08,0xEB,0x42,0xA0,0x18,0x33,0xCA,0x22,0x89,0xA3,0x3D,0x96,
+0xAB,0x21,0x14,0x99,0x80,0x43,0x0A,0xE0,0x3A,0x92,0x34,0x64,0xE8,0x0A,0x99,0x72,0x91,0x09,0x88,0x09,0x00,0x31,0x90,0x10,0x9B,0x34,0x11,0xC9,0x39,0x84,0xDA,0x70,
+0xA3,0x3A,0x12,0x03,0xBC,0x0A,0x36,0x81,0x8B,0xA1,0x61,0x21,0x83,0x32,0x4B,0x07,0xAF,0x23,0x9B,0xB0,0x68,0x81,0x08,0x11,0x12,0x12,0xE9,0x19,0x14,0xAA,0x35,0xBB,
+0x12,0xAC,0x02,0x09,0x12,0x12,0x44,0xBB,0x74,0x81,0x08,0xB0,0x8A,0xBC,0x54,0x00,0x22,0xF9,0x3B,0xA2,0x48,0xC8,0x10,0x08,0x98,0x72,0xC9,0x19,0x80,0x8B,0x13,0x43,
+0x88,0xCA,0x00,0x08,0x23,0x10,0x63,0xFB,0x1B,0x9A,0x98,0x63,0x03,0xBD,0x28,0xA4,0x3C,0xC2,0x9A,0xB9,0x8A,0x92,0x98,0x2F,0x27,0xAB,0x20,0xC8,0x31,0x22,0xD8,0x29,
+0xB8,0x21,0xBB,0x0A,0x37,0x98,0x19,0x99,0x47,0xAC,0x22,0xA0,0x8D,0x24,0xA1,0x0C,0x03,0xCB,0x73,0x81,0x98,0x88,0x21,0x33,0x91,0xB9,0xAF,0x52,0x13,0x00,0xCC,0x42,
+0x89,0xA1,0x1A,0x44,0xA8,0x54,0xCA,0x10,0x12,0x81,0xA9,0xD9,0x8C,0x25,0x02,0xB8,0x89,0x21,0xD9,0x50,0xB2,0xAD,0x22,0x23,0x91,0xB8,0x4B,0x84,0x11,0xCC,0x10,0xAA,
+0x50,0xB2,0x9F,0x11,0x88,0x73,0x92,0x9B,0x8A,0xB2,0x2C,0x24,0xBB,0x00,0x8A,0x10,0x47,0x9A,0xCB,0x22,0x19,0x94,0x9B,0x03,0x8A,0xC9,0x20,0xE9,0x89,0x54,0xA1,0x1A,
+0x90,0xEB,0x29,0x92,0x80,0xCC,0x21,0x82,0x8C,0x83,0x9D,0x80,0xAC,0x82,0x9C,0xAA,0x35,0x89,0xC8,0x2A,0xF2,0x8F,0x01,0x09,0xA2,0xAE,0x32,0x33,0x93,0x18,0xF9,0x8B,
+0x93,0x8D,0xA8,0x9C,0x20,0x42,0x14,0x98,0xC0,0x8C,0xC0,0x19,0x22,0xB2,0x49,0xF1,0x1A,0xA0,0x89,0x64,0x90,0x0A,0x81,0x28,0x15,0xC8,0x9D,0xA9,0x2B,0x47,0x81,0x98,
+0x80,0x9A,0x20,0xA0,0x90,0xBF,0x28,0x26,0x88,0x10,0xA0,0x99,0x23,0xCC,0x8A,0x51,0x12,0x91,0xA9,0x30,0xDB,0x53,0xA9,0x00,0x98,0xF0,0x8D,0x13,0x31,0x14,0x9A,0x08,
+0x00,0xD9,0x0A,0x83,0x70,0x95,0x9B,0x09,0x92,0x8C,0x26,0xCA,0x10,0x12,0x01,0xA9,0x98,0xAA,0x31,0x24,0xEA,0x8A,0x9E,0x53,0x12,0xFA,0x8B,0x20,0x22,0x13,0xCA,0x48,
+0xC1,0x9C,0x09,0x13,0x52,0xA1,0x2B,0x04,0x08,0xF9,0xCD,0x39,0x25,0x81,0xEB,0x0A,0x23,0x12,0xBB,0x0A,0x54,0x11,0xB9,0xAC,0x88,0x88,0x19,0x35,0x98,0x89,0xA3,0x9E,
+0x99,0x22,0x53,0x91,0x10,0x18,0xFB,0x9C,0x10,0x31,0x16,0xBA,0x9B,0x18,0x02,0x80,0x80,0x99,0x75,0x01,0xC1,0x9D,0x21,0x09,0x10,0xA8,0x01,0xFC,0x9C,0x21,0x42,0xB1,
+0x1B,0x22,0x24,0xA9,0x30,0x34,0xC8,0xAC,0x9A,0x53,0x01,0xD9,0xBE,0x0C,0x44,0x12,0xC9,0x89,0x00,0x22,0x01,0xBA,0x28,0x99,0x90,0x70,0x94,0xC9,0xAC,0x51,0x13,0xC8,
+0x8C,0x11,0x44,0x01,0x98,0xAA,0x9C,0x88,0x22,0x99,0x28,0x13,0x12,0xEF,0x10,0x32,0x03,0xCB,0xAC,0x61,0x24,0x90,0xBA,0xBA,0x8B,0x43,0x55,0x13,0xB8,0xAD,0x89,0x82,
+0x51,0x03,0x02,0xDD,0x9B,0x00,0x58,0x15,0xC9,0x89,0x90,0x8B,0x88,0x77,0x94,0xAA,0x8A,0x22,0x03,0x08,0xB8,0xFF,0x8D,0x73,0x14,0xC0,0xBC,0x9A,0x53,0x34,0x82,0xCB,
+0xBC,0x0A,0x31,0x32,0x32,0x33,0x03,0xFC,0xBB,0x8B,0x31,0x25,0x01,0xA9,0xCB,0x9A,0x00,0x01,0x00,0x73,0x44,0x13,0xC8,0xCC,0x9B,0x31,0x54,0x02,0xB8,0xBB,0x89,0x90,
+0xAA,0x8A,0x64,0x24,0x90,0xDB,0x9B,0x08,0x43,0x33,0x24,0x91,0xBA,0x9B,0x21,0xC0,0xBD,0x58,0x46,0x81,0xDB,0xAC,0x09,0x31,0x34,0x23,0xA8,0xCD,0xAB,0x09,0x21,0x44,
+0x33,0x02,0xC9,0xBD,0xAA,0x09,0x22,0x42,0x34,0x24,0x90,0xFB,0xBB,0x9A,0x30,0x35,0x13,0xB8,0xAB,0x48,0x23,0xFA,0xCB,0x19,0x43,0x13,0x88,0x88,0x01,0x81,0xC9,0xAC,
+0xAA,0x18,0x32,0x23,0x98,0x41,0x36,0xB0,0xBF,0xAB,0x18,0x43,0x34,0x01,0xCC,0x9A,0x43,0x02,0xEB,0x0A,0x42,0x23,0xB9,0xAD,0x09,0x20,0x23,0x82,0xDA,0x9C,0x41,0x14,
+0xB9,0xAC,0x18,0x34,0x13,0x00,0xAA,0x9B,0x20,0x25,0xD8,0xBC,0x38,0x37,0x03,0xB9,0x9A,0x10,0x91,0xBC,0x8A,0x41,0x53,0x22,0xA1,0xDF,0x9A,0x18,0x10,0x98,0xBA,0x29,
+0x57,0x11,0xB9,0xAE,0x0A,0x45,0x23,0xC8,0xBC,0x18,0x63,0x12,0xB9,0xAD,0x89,0x11,0x12,0x81,0x88,0x89,0x89,0x99,0xBB,0x19,0x35,0x11,0x90,0x50,0x55,0x13,0x98,0xB9,
+0x9C,0x20,0x36,0x13,0xC9,0xAD,0x09,0x32,0xA2,0xBD,0x8A,0x10,0x33,0xB0,0xDB,0x8B,0x62,0x14,0xB0,0xAB,0x30,0x45,0x91,0xFB,0x8A,0x53,0x23,0xB0,0xBE,0x8A,0x52,0x33,
+0xA1,0xBE,0xAB,0x10,0x53,0x12,0x80,0xA9,0x9A,0x18,0x98,0x20,0x92,0x9A,0x98,0x00,0x81,0x18,0x54,0xD0,0xBD,0xBA,0x70,0x25,0x82,0xB9,0x9C,0x11,0x23,0x80,0xDC,0xAB,
+0x48,0x35,0xA1,0xDA,0x8A,0x30,0x26,0x90,0xC9,0x89,0x32,0x05,0x19,0xF0,0x3B,0xA0,0x28,0x00,0xFC,0x38,0x91,0x20,0xA0,0x99,0x81,0x48,0x05,0xAA,0x31,0xA0,0x61,0xA0,
+0xBA,0x9C,0x64,0x81,0x89,0xA9,0x39,0x34,0x80,0xEA,0x9B,0x10,0x33,0x14,0xEB,0x89,0x08,0x33,0x81,0x19,0xA8,0x49,0x15,0x9A,0x88,0x09,0x83,0x3A,0xF1,0x9F,0x30,0x02,
+0x23,0x80,0xA9,0x08,0x73,0xC0,0x9C,0x9A,0x19,0x64,0x81,0xBB,0x9B,0x20,0x26,0xA8,0xA9,0x19,0x74,0x03,0x99,0xB9,0x9D,0x43,0x91,0xBB,0xAB,0x39,0x26,0x10,0xFB,0x19,
+0x80,0x21,0x24,0xDB,0xBB,0x38,0x35,0x03,0xB9,0xA9,0x2A,0x93,0x9C,0x89,0x00,0xAD,0x56,0xA9,0xAA,0x39,0x15,0x80,0xBC,0x18,0x00,0x24,0xB9,0x9C,0x88,0x88,0x10,0xD8,
+0x8A,0xBB,0x74,0x07,0x9A,0x88,0x89,0x10,0x10,0x80,0x90,0x9C,0x22,0x36,0x82,0xDC,0xBB,0x3A,0x26,0x80,0x88,0x18,0xA8,0xBA,0xAB,0x31,0x47,0x13,0x91,0xDF,0x18,0x32,
+0x02,0xA9,0x9C,0x21,0x53,0x04,0xB9,0xAA,0x09,0x42,0x33,0x81,0xFB,0x8D,0x11,0x23,0x80,0xA9,0x89,0x89,0x09,0x22,0x70,0x37,0xA0,0x89,0xEB,0x09,0x53,0x33,0xB8,0xCA,
+0x28,0x23,0x02,0xB8,0x8C,0x00,0x35,0x13,0xDA,0xAA,0x00,0x10,0x23,0xB9,0x3A,0x57,0x01,0xB0,0x9E,0x88,0x52,0x82,0xB9,0x0A,0x08,0x73,0x14,0xA0,0x9D,0x21,0x43,0x03,
+0xDB,0x8A,0x28,0x22,0x91,0x9B,0x9A,0x9A,0x37,0xD9,0xAD,0x41,0x24,0xB9,0x9A,0x9A,0x59,0x25,0x81,0xCA,0x9C,0x19,0x22,0x00,0xC0,0x3B,0x83,0x61,0xE0,0x9A,0x08,0x01,
+0x20,0x82,0xDB,0x9B,0x42,0x03,0x88,0xBC,0x12,0x9A,0x33,0xD0,0x0C,0x91,0x60,0x04,0xEA,0x8A,0x88,0x22,0xA9,0x9A,0x19,0x10,0x80,0xFE,0x8D,0x80,0x10,0x12,0x32,0xA8,
+0xCD,0x29,0x10,0xC8,0xAB,0x28,0x55,0x92,0x9B,0xCB,0x28,0x91,0x30,0xD2,0xBC,0x8D,0x02,0x11,0xDB,0x28,0x41,0xA2,0xBF,0x80,0x40,0x91,0x09,0xCA,0x8B,0x23,0x0A,0x42,
+0xE0,0x0B,0x30,0x16,0x32,0xDB,0x99,0x1B,0x23,0x13,0xD9,0x1B,0x00,0x01,0x39,0x03,0xEB,0x6B,0x57,0x90,0xB9,0x28,0x92,0x89,0x88,0x24,0x99,0x40,0x81,0xBC,0x41,0x24,
+0x02,0x81,0xCE,0x9A,0x63,0x02,0x08,0xA1,0x1A,0x24,0x12,0xB8,0xAB,0x09,0x47,0x23,0x80,0x98,0x09,0x78,0x83,0x10,0x40,0x95,0x19,0xCC,0x89,0x52,0x31,0x92,0x9E,0x00,
+0x80,0x80,0x65,0x03,0x92,0x9C,0x33,0xA0,0x41,0x90,0xAF,0x24,0x9A,0xB8,0x19,0x50,0x93,0x9A,0x11,0x09,0x05,0x18,0x00,0xDC,0x09,0x44,0x11,0xB1,0x60,0x08,0x92,0x09,
+0x30,0xB4,0x2A,0x28,0x15,0xBD,0xC9,0x0C,0x34,0x92,0x9A,0xBC,0x10,0x32,0xCA,0x22,0xC8,0x18,0x8C,0x05,0x9A,0xAA,0x08,0xF9,0x0F,0x80,0x01,0x99,0x8B,0xB1,0x1B,0x53,
+0x54,0xA3,0x8C,0xFA,0x29,0x53,0xB0,0x89,0xA9,0x0B,0x34,0xC9,0x99,0x89,0x99,0xD9,0xAD,0x23,0x18,0x13,0x80,0xF9,0xAD,0x88,0x32,0xE8,0x8A,0xA9,0x52,0x12,0xB0,0x9A,
+0xBC,0x09,0x08,0x25,0xFA,0x8B,0x00,0xB0,0xCE,0x09,0x13,0xC9,0x89,0x00,0x89,0x21,0x33,0x90,0x98,0x0B,0xA4,0x9F,0xA8,0x31,0x01,0xDA,0x18,0x88,0xF0,0x0C,0x21,0x90,
+0xBD,0x09,0x43,0x53,0x13,0xDB,0x0A,0x00,0x38,0x77,0xB2,0xBB,0x10,0x55,0x91,0xCC,0x20,0x24,0x98,0x8A,0x00,0x90,0x9A,0x43,0xA0,0xBB,0x61,0x12,0xDA,0x89,0x32,0x98,
+0x22,0x44,0xB0,0xBE,0x72,0x02,0xA8,0x0A,0x11,0x12,0xAA,0x42,0xA8,0x89,0x18,0x14,0xD8,0xBD,0x0A,0x43,0x33,0x92,0x38,0xC1,0xDD,0x8A,0x40,0x11,0x10,0x98,0x28,0xA1,
+0x08,0x90,0x3A,0x07,0xBD,0x8A,0x55,0x82,0xB9,0x08,0x80,0x88,0x48,0x14,0x82,0x8B,0x24,0x32,0x26,0xDC,0x9A,0x88,0x89,0x20,0x14,0xBA,0x9B,0x32,0xA8,0x71,0x96,0xAA,
+0x21,0x21,0x26,0x81,0x09,0x91,0x28,0x08,0x02,0xEE,0x29,0x24,0xB8,0x3A,0x91,0xA9,0x08,0xCF,0x72,0x22,0x91,0x99,0x32,0xA0,0x18,0x12,0x34,0xA2,0x1C,0x34,0x53,0xA0,
+0x33,0x0A,0xF3,0x8E,0x11,0x08,0x91,0xBF,0x23,0x08,0x13,0xCC,0x40,0x93,0x1A,0x14,0xC8,0x30,0x91,0x0A,0x34,0xB8,0x9B,0x92,0xAF,0x22,0x30,0x27,0xA1,0xAE,0x8A,0x44,
+0x80,0xA8,0x9A,0x09,0x18,0x06,0x49,0x92,0x89,0x9B,0x31,0xC2,0x9F,0x22,0x10,0xF8,0x0B,0x11,0x25,0xC8,0xBC,0x20,0x11,0x81,0xB9,0x18,0xA0,0xBA,0x71,0x96,0xAB,0x30,
+0xC8,0x8B,0x63,0x80,0x99,0x22,0xC8,0xBB,0x38,0xB2,0xCD,0x9A,0x20,0x92,0x41,0x90,0xA8,0xDC,0xAC,0x61,0x82,0xAB,0xBB,0x29,0x54,0xC0,0x1B,0x03,0xAA,0xEB,0x0B,0x25,
+0x99,0xA1,0x9D,0x53,0x92,0xCB,0x58,0xA2,0x8C,0x08,0x88,0x32,0xB1,0xCC,0x9B,0x74,0x23,0xD9,0xAA,0x19,0x33,0x82,0x19,0x41,0xB2,0xBF,0x8B,0x22,0x21,0x24,0x01,0x90,
+0x09,0xF0,0x9C,0x01,0x40,0x93,0xAF,0x63,0x01,0xA8,0x88,0x89,0x09,0x91,0x28,0x20,0x33,0xFB,0x0E,0x33,0xA1,0x00,0x8B,0x33,0xC9,0x48,0x22,0x15,0xCB,0x19,0x12,0x93,
+0xBB,0x42,0x08,0x05,0x9D,0x30,0xA0,0x0A,0x36,0xD8,0x08,0x12,0x22,0x20,0xD2,0x9B,0xA9,0x1A,0x77,0x99,0x98,0x21,0x20,0xF8,0x8B,0x31,0xB8,0x28,0x85,0x0C,0x94,0x9D,
+0x98,0x29,0x25,0x82,0xAC,0xAA,0x50,0x43,0xC0,0x9B,0x30,0x92,0x9A,0x70,0x23,0xB9,0x8C,0x88,0x45,0x90,0xBA,0xAB,0x38,0x15,0xA8,0x28,0x93,0x9D,0xCB,0x72,0x01,0x90,
+0x9A,0xAC,0x31,0x22,0xA2,0x09,0xF0,0xAF,0x52,0x11,0x90,0x9B,0xA8,0x8B,0x36,0x80,0x10,0xD0,0x1E,0x24,0xA9,0x08,0x81,0xB8,0x5A,0x95,0x2B,0xC3,0x38,0xB8,0x28,0x34,
+0x12,0xAA,0x98,0x37,0xBF,0x03,0x40,0x98,0x18,0xA9,0x28,0x55,0xB1,0x1A,0x00,0x98,0x61,0xA1,0x0B,0xA8,0x38,0x05,0x28,0xE8,0x2B,0xB3,0x78,0x93,0x9A,0x31,0x12,0x81,
+0x99,0xBA,0x1A,0x57,0x82,0xBC,0x09,0x01,0x1A,0xA4,0x2B,0xE2,0x9D,0x00,0x28,0x23,0xFB,0x49,0x13,0x98,0xAA,0xFB,0x2B,0x26,0xA0,0x99,0x40,0xB2,0x2A,0xE1,0x0B,0x98,
+0x80,0x52,0xFB,0x20,0xA9,0x34,0xC9,0x18,0xC9,0x99,0x34,0xBA,0x9A,0x11,0x8B,0x17,0x8A,0x90,0x98,0x58,0x83,0xAD,0xCA,0x2A,0x33,0x14,0xAA,0x01,0x88,0xA0,0x8E,0x05,
+0x8A,0x00,0x11,0xD0,0x9F,0xA9,0x8B,0x90,0x09,0xA2,0xCF,0x42,0xB8,0x89,0x02,0x0A,0x13,0x66,0x99,0x81,0x09,0x51,0xA0,0x09,0x20,0xD8,0x18,0x12,0xDB,0x11,0x9A,0x42,
+0xBA,0x19,0xA0,0x9E,0xD9,0x89,0x32,0xA9,0x15,0x8A,0xE0,0x1C,0x34,0x81,0xCD,0x09,0x90,0x10,0xA8,0xBB,0x32,0xC9,0x73,0x14,0xE9,0x8A,0x88,0x42,0x91,0x9A,0x30,0x33,
+0x91,0x30,0xA8,0xA3,0xAF,0x14,0x28,0x23,0x99,0x22,0xD9,0x00,0xCB,0x8B,0x37,0x9A,0x23,0xEB,0x31,0xAF,0x33,0x90,0x29,0xD1,0x1C,0x22,0x98,0x03,0xBB,0x70,0x14,0x8A,
+0x81,0xCC,0x19,0x81,0x28,0xCA,0x9B,0xAB,0xB9,0x59,0x35,0x33,0x10,0xA3,0x8E,0x01,0x89,0x22,0x9E,0x44,0xBA,0x72,0x81,0x11,0xA1,0xAB,0x8C,0x35,0x04,0xFA,0x8B,0x63,
+0x01,0x98,0x99,0x25,0xAB,0x23,0x9A,0x41,0x93,0xBB,0x78,0x95,0x8A,0x01,0x01,0x02,0x09,0x04,0xBD,0x01,0xA9,0x40,0x14,0x01,0xAA,0x32,0x11,0xB3,0x49,0xF8,0x0C,0x25,
+0x01,0x98,0x29,0x85,0x8C,0x82,0x38,0xC8,0x1A,0x83,0x20,0xAE,0x02,0xAE,0x41,0x90,0xAA,0x60,0x81,0xC1,0x8F,0x13,0x90,0x8B,0x01,0x18,0xB1,0x70,0x84,0x89,0x88,0x81,
+0x99,0x20,0x42,0x12,0xA8,0x34,0xA0,0xE8,0xAD,0x30,0x15,0x01,0xC9,0x50,0x93,0x99,0x40,0x84,0xAC,0xBB,0x4A,0x83,0x48,0x08,0x17,0x9B,0xD0,0x3A,0x02,0x38,0x90,0xCA,
+0x8C,0x10,0x93,0x5B,0xA3,0x8B,0x27,0x28,0xF0,0x0D,0x10,0x02,0x9A,0x91,0x4A,0x07,0x99,0x88,0x18,0x80,0x79,0xB4,0x1C,0x17,0xD9,0x0A,0x36,0xC0,0xAC,0x41,0x14,0xC9,
+0x9B,0x20,0x34,0x80,0xBB,0x8A,0x11,0x10,0x33,0x12,0xCA,0xAB,0x29,0x02,0x8A,0x03,0x49,0x04,0x80,0xAF,0x32,0x89,0x45,0xC9,0x89,0x18,0x81,0x28,0xB8,0x00,0xAA,0x20,
+0x17,0x1A,0xC3,0x8D,0x80,0x98,0x88,0x20,0x82,0x44,0x8A,0xF0,0x4A,0xC8,0x20,0x80,0x09,0x02,0x8A,0xC8,0x60,0xA1,0x28,0x81,0x21,0x98,0x17,0xCF,0x01,0xAA,0x19,0x17,
+0xA9,0x19,0xC1,0x31,0xBC,0x14,0x88,0xBC,0x72,0x92,0x9F,0x03,0x8A,0x82,0x09,0x84,0x0B,0x90,0xD8,0x0C,0x30,0x16,0x98,0xA9,0x11,0x81,0x1D,0x93,0x90,0x1E,0xC8,0x25,
+0x9D,0x01,0x11,0xAC,0x04,0x8A,0x09,0x07,0x0A,0x81,0x21,0xBA,0xC9,0x9C,0x45,0x9A,0x11,0x00,0x08,0x00,0xF0,0x1C,0x05,0xAD,0x13,0x2C,0x93,0x27,0xCF,0x32,0xB8,0x7A,
+0xB1,0x2A,0x98,0x30,0x23,0x18,0xF0,0x8C,0x88,0x88,0x40,0x84,0x48,0xA1,0x89,0xD8,0x0A,0xA1,0x50,0x23,0x80,0x00,0x8B,0xE9,0x9B,0x18,0x01,0x46,0x53,0x12,0xB8,0xBD,
+0xBD,0x89,0x90,0x9B,0x11,0x80,0x20,0x43,0x35,0x25,0x22,0x31,0x32,0x81,0x20,0xB8,0x40,0xA0,0x0A,0xFA,0x2C,0x84,0xCA,0xCB,0xCC,0x9C,0xAA,0x9B,0xBA,0x0A,0x98,0x89,
+0xEA,0x9B,0x01,0x20,0x46,0x24,0x43,0x33,0x43,0x13,0x31,0x45,0x54,0x23,0x02,0x91,0x99,0xBC,0xBA,0xCB,0xAA,0x99,0x00,0x80,0xEC,0xCC,0xAA,0x99,0x08,0x00,0x10,0xA8,
+0xCB,0xAE,0x88,0x99,0x10,0x14,0x00,0xB8,0xAC,0xBA,0x2A,0x90,0x66,0xB8,0x28,0x88,0xA0,0x9A,0x09,0x04,0x50,0x26,0x73,0x13,0x12,0x23,0x12,0x31,0x35,0x24,0x34,0x28,
+0x24,0x21,0x33,0x14,0x01,0x99,0x23,0x32,0xD0,0x29,0xD0,0x9B,0xB9,0x99,0xED,0xAB,0xDC,0xBB,0xBD,0xBB,0xCB,0xBC,0xCB,0xAA,0xBC,0x99,0xAA,0x88,0xA9,0x80,0x11,0xA9,
+0x2B,0x27,0x18,0x81,0x46,0x88,0x20,0x37,0x00,0x10,0x23,0x11,0x43,0x26,0x21,0x21,0x01,0x54,0x12,0x21,0x02,0x9A,0x29,0x14,0x00,0x12,0xB9,0x91,0x1D,0x84,0x19,0x03,
+0xDD,0x09,0x81,0xEB,0x88,0xB9,0x11,0x99,0x82,0x11,0xBF,0xC9,0x39,0x80,0xD0,0x8D,0x32,0xA1,0x23,0x8D,0x83,0x3A,0x12,0x24,0x65,0x23,0x21,0x44,0x22,0x22,0x25,0x28,
+0x47,0x00,0x01,0x22,0x20,0x11,0x92,0x4D,0xB3,0x19,0x0A,0xF1,0x2B,0xB0,0xBF,0xB8,0x8C,0xB9,0x19,0xDD,0x9A,0x98,0xBD,0x9A,0xB9,0x9C,0xAA,0xCA,0x9B,0xAC,0xDB,0x9A,
+0x0C,0xB8,0x9A,0x98,0xBD,0x11,0xDB,0x9A,0x81,0xBD,0x00,0xA0,0x5A,0x85,0x8A,0x11,0x84,0x69,0x91,0x53,0x89,0x34,0xA0,0x60,0x01,0x22,0x28,0x24,0x81,0x23,0x72,0x93,
+0x32,0x11,0x02,0x63,0x20,0x13,0x73,0x93,0x68,0x81,0x44,0xB9,0x41,0xA1,0x50,0xA0,0x31,0x22,0x90,0x53,0x88,0x33,0x01,0xA8,0x33,0x3A,0x17,0x2E,0x16,0x81,0x9A,0x82,
+0x0B,0x05,0x9E,0x10,0x11,0x10,0xB8,0x31,0xFB,0x19,0xC0,0x0C,0x33,0x98,0x31,0xEC,0xB9,0x0B,0x93,0x39,0xFA,0x3C,0xA0,0xA9,0xAB,0xAB,0x01,0x80,0xAD,0xD0,0x9B,0xDA,
+0xAC,0x88,0x9C,0x89,0x31,0x80,0xBD,0xC8,0xAF,0x98,0x8B,0xA1,0x9E,0x81,0x89,0x88,0x9E,0x01,0x1B,0xB2,0xBC,0xBB,0x72,0x82,0x72,0x91,0x31,0x90,0xB9,0xCC,0x8C,0x10,
+0x00,0x11,0x01,0x43,0x01,0x88,0x48,0x83,0x40,0x44,0x27,0x88,0x08,0x99,0x62,0x81,0x08,0x08,0x32,0x21,0x31,0x05,0x4A,0x06,0x99,0x09,0x84,0x39,0x16,0x80,0x11,0xA0,
+0x28,0x00,0xD2,0x0C,0xA0,0x80,0x40,0x80,0x45,0x24,0x04,0xA9,0x34,0x12,0x11,0x9B,0x34,0x74,0x13,0x03,0x29,0x83,0x98,0x74,0x00,0x14,0x10,0x81,0x9A,0x91,0x79,0x91,
+0x54,0x11,0xA8,0x10,0xA8,0x8B,0x98,0xA8,0x7A,0xE8,0x00,0x19,0xE9,0x08,0x89,0x03,0x90,0x80,0x9B,0xFB,0x9C,0x9A,0xCA,0x30,0xDB,0x99,0xC9,0x1B,0xB8,0xBA,0x9F,0x88,
+0x98,0x99,0xDE,0x88,0x9A,0xBA,0xAD,0xA8,0xCB,0x1A,0xE0,0x0A,0xB9,0xCB,0x0A,0x88,0xB9,0x99,0x5C,0xC1,0x22,0xBF,0x03,0xBB,0x30,0x92,0x20,0x03,0x3A,0x14,0x08,0xB8,
+0x74,0x94,0x40,0x02,0x81,0x8A,0x37,0x99,0x23,0x02,0x48,0x81,0x33,0x89,0x11,0xE0,0x8A,0x7B,0xD3,0x72,0xB0,0x38,0x22,0xCA,0x0A,0x88,0x22,0x9A,0xB8,0x78,0x27,0x0D,
+0x03,0x89,0x8A,0x36,0x90,0x0A,0x04,0xAD,0x11,0x28,0xB1,0x59,0xA2,0x1A,0x02,0xB8,0x49,0xE0,0x20,0xE9,0x58,0xB2,0x5A,0xA1,0x9A,0x1A,0x81,0x14,0x0A,0x15,0xAB,0x30,
+0x05,0x0D,0xB2,0x39,0xC9,0x14,0x0A,0xE2,0x3B,0xA4,0x2A,0xA9,0x34,0xC8,0x2A,0xB8,0x98,0x51,0x22,0xF1,0x72,0x98,0x81,0x2B,0x94,0xAB,0x13,0x1C,0xD1,0x10,0x28,0x84,
+0x20,0x92,0x1C,0xB5,0x1D,0x98,0x43,0x89,0x22,0x90,0x31,0xA0,0x09,0xCE,0x42,0x20,0x02,0x24,0xAC,0x25,0xBD,0x22,0xAB,0x92,0x51,0xA0,0x82,0x2A,0xC2,0x0B,0x00,0x02,
+0x9A,0x10,0xE2,0x71,0xDA,0x80,0x0C,0xB1,0x52,0x99,0x88,0x25,0x9B,0xA0,0x36,0xBF,0x81,0x41,0xB8,0x98,0x8A,0xA0,0x8A,0x33,0x17,0xAF,0x15,0x9C,0x80,0x20,0xA1,0x0E,
+0x04,0x0A,0x90,0x98,0xAA,0x2B,0xA2,0x44,0x0A,0xA5,0x0E,0x81,0x9B,0x30,0x85,0x09,0xDA,0x40,0xC1,0x2B,0x90,0x00,0xBC,0x01,0xA8,0x7B,0x87,0x19,0x10,0xB0,0x8F,0x00,
+0x08,0x90,0x20,0x83,0x50,0x91,0xB8,0xAD,0x9A,0x24,0x09,0x42,0xFA,0x4A,0x88,0x23,0x20,0xC9,0x9B,0x43,0x08,0xC8,0x36,0xBB,0x34,0x01,0x00,0xAB,0xD1,0xAF,0x23,0x21,
+0x80,0x52,0x01,0x12,0xAC,0xFB,0x9A,0x89,0x42,0x32,0x35,0x11,0x81,0x08,0xA8,0xDD,0xCB,0xBA,0x89,0x20,0x33,0x36,0x12,0x22,0x32,0x45,0x22,0x12,0x08,0x80,0xCC,0xAA,
+0xBB,0xCD,0x9A,0x8A,0xBB,0x80,0xAD,0xA8,0xBA,0x9C,0xBA,0x8B,0x30,0x43,0x24,0x42,0x37,0x33,0x14,0x22,0x21,0x43,0x23,0x23,0x49,0x27,0x08,0x13,0x00,0x31,0x01,0xB0,
+0xBD,0xCF,0xBB,0xAB,0xC9,0xBC,0x9B,0xD9,0xAA,0xAB,0xBA,0xAB,0xAF,0xAA,0x89,0x0B,0x82,0xC9,0x8B,0xAA,0xC0,0x1D,0x82,0x45,0x01,0x20,0x54,0x24,0x22,0x13,0x44,0x12,
+0x38,0x14,0x41,0xA1,0x99,0x11,0x09,0x90,0x99,0x8A,0xCC,0x21,0x0C,0x25,0x18,0x15,0xBB,0x20,0xD9,0x8A,0xDA,0x99,0xDA,0x1B,0xC0,0x39,0x82,0xDC,0x11,0xB9,0x8A,0xD0,
+0x2B,0xA3,0x18,0x23,0x29,0x27,0x49,0xE8,0x30,0xA9,0x00,0x28,0x21,0xC1,0x6A,0x03,0x90,0x5A,0xC3,0x1C,0xA0,0x41,0x01,0xA8,0x8C,0x23,0xA9,0xBA,0x3A,0x37,0xBD,0x23,
+0xC9,0x9B,0x33,0xCA,0x63,0xD9,0x28,0x99,0x12,0x88,0xE8,0x49,0xA3,0x5A,0x91,0x21,0x90,0x30,0xDD,0x01,0x39,0xA1,0x51,0x21,0x42,0x35,0xB2,0x3C,0x17,0x28,0x88,0x11,
+0x50,0x13,0x08,0x33,0x72,0xA3,0x49,0x13,0xA8,0x12,0x30,0x94,0x08,0x08,0xC9,0x73,0xA2,0x18,0xB8,0x8B,0xA8,0xA8,0xFF,0x2B,0xA9,0xAC,0x88,0xEC,0x89,0xBA,0x01,0xBB,
+0xA8,0xAF,0xA9,0xBB,0xD9,0x1B,0xE8,0x0B,0xE8,0x09,0x99,0x99,0x8A,0xCB,0x8A,0x89,0xCC,0x29,0xF8,0x0B,0x80,0x98,0x08,0xC9,0x80,0x0A,0x90,0xDA,0x2A,0xA0,0x12,0x0B,
+0x27,0x02,0x99,0x55,0x81,0x73,0x00,0x93,0x59,0x05,0x18,0x23,0x01,0x30,0x16,0x80,0x42,0x22,0x24,0x19,0x37,0x00,0x42,0x80,0x32,0x21,0x15,0x18,0x12,0x62,0x02,0x32,
+0x90,0x35,0x23,0x00,0x22,0x73,0x02,0x01,0x38,0xA0,0x44,0x00,0x50,0x84,0x29,0xDA,0x00,0x19,0x91,0x08,0x29,0xB3,0x08,0x2D,0xF3,0x1F,0xC0,0x0B,0x80,0x8C,0xB1,0x8C,
+0xA9,0xBB,0x01,0xDF,0x88,0xA9,0x09,0xB9,0xBB,0xDD,0x19,0xD9,0x8B,0x99,0xAA,0xCA,0x09,0xBD,0xA8,0xBB,0xDC,0x8A,0x91,0x9F,0x91,0x9B,0xB9,0x88,0xBB,0xBA,0xDB,0x1B,
+0xD9,0x89,0xCB,0xBC,0x88,0x20,0xB8,0x8A,0xA9,0x8D,0xA3,0x0E,0x25,0x99,0x16,0x80,0x08,0xA1,0x71,0x92,0x11,0x52,0x13,0x01,0x21,0x12,0x02,0x70,0x16,0x10,0x11,0x44,
+0x10,0x03,0x61,0x01,0x11,0x52,0x12,0x32,0x21,0x83,0x72,0x34,0x82,0x41,0x81,0x33,0x21,0x35,0x91,0x61,0x24,0x10,0x80,0x08,0x46,0x10,0x03,0x38,0x02,0x0A,0x46,0x11,
+0x82,0x41,0xB0,0x50,0x81,0x50,0x91,0x48,0xC2,0x38,0x91,0x81,0x40,0x90,0xA0,0x9A,0x1B,0xB5,0x8D,0x8A,0x91,0x89,0x9F,0xC3,0x8F,0xB1,0x2B,0xE0,0x09,0xB8,0x1A,0xA9,
+0x92,0xAF,0x9A,0x90,0xBC,0x0A,0xB8,0xEB,0x8E,0xA1,0x0C,0x90,0xBA,0x19,0xFB,0x8A,0x90,0x9C,0xA8,0x9B,0xAC,0xA1,0xAF,0x08,0xA8,0x1A,0xFB,0x1A,0x99,0xB8,0xAB,0x18,
+0xE8,0x0A,0xC0,0x1B,0xA3,0xAF,0x08,0xA9,0xA9,0x29,0xBA,0xD0,0x4B,0xE0,0x00,0x90,0x08,0x81,0x3B,0xD2,0x40,0xBB,0x34,0xF8,0x39,0x92,0x23,0x19,0x33,0x07,0x7C,0xF3,
+0x49,0xA0,0x00,0x11,0x90,0x24,0xBB,0x47,0xC8,0x39,0x82,0xAA,0x21,0x00,0x13,0x4A,0x17,0x88,0x08,0xA2,0x1C,0x85,0x9D,0x43,0xA0,0x50,0x91,0x10,0x02,0xBA,0x31,0xB8,
+0x19,0x88,0x13,0x41,0x00,0x57,0x88,0x98,0x28,0x80,0x11,0x09,0x37,0x11,0x31,0x93,0x8B,0x92,0x8D,0x13,0x08,0x74,0x91,0x30,0x88,0x92,0xDE,0x0A,0xBA,0x9B,0x18,0x01,
+0x02,0x73,0x02,0x8A,0x92,0x8F,0xA8,0x98,0x9D,0x33,0x89,0x34,0x90,0x22,0xB9,0x42,0xF8,0xAD,0x88,0xB9,0x89,0x09,0x81,0x9D,0xA9,0x54,0xD8,0x8A,0xB8,0x9A,0x09,0xEC,
+0x88,0xBC,0x00,0x99,0xAA,0x90,0x8A,0x16,0xAC,0xB8,0x9D,0x80,0xAB,0xA9,0x1A,0x11,0x00,0xF1,0x8E,0x91,0xAA,0x19,0x91,0x9D,0x93,0x9F,0x83,0x3A,0x11,0xCA,0x88,0x58,
+0x81,0x92,0x3C,0xFA,0x51,0xC9,0x21,0x82,0x38,0x90,0x44,0xBA,0x72,0x80,0x80,0x8C,0x33,0x19,0xB0,0x39,0x34,0x91,0x46,0x80,0x09,0xC0,0x78,0xB1,0x08,0x30,0xA3,0x49,
+0x12,0x81,0x29,0xC1,0x19,0xA1,0xB9,0x49,0xE3,0x0D,0x03,0x88,0x50,0xD0,0x18,0xBB,0x00,0x01,0x0D,0xB2,0x0E,0x22,0xDA,0x31,0xBA,0x18,0x82,0xBF,0x14,0x8B,0x03,0x20,
+0xB8,0x51,0x12,0xC8,0x78,0x92,0x32,0xAB,0x12,0x98,0x78,0x02,0x21,0x01,0x2A,0x85,0x09,0x1B,0x57,0x88,0x00,0x08,0x80,0x8C,0x21,0xD1,0x3B,0x87,0x2A,0x95,0x0B,0x82,
+0xBA,0x00,0xAE,0x91,0x99,0x1D,0xB3,0x39,0xEC,0x20,0xD9,0x0A,0x90,0x90,0xBA,0x3B,0xB6,0x1C,0x90,0x08,0xAA,0x00,0x11,0x10,0x25,0x9E,0xD3,0x5C,0xC3,0x59,0x90,0x08,
+0x2A,0x04,0x8B,0x93,0x1C,0x15,0x08,0x82,0x8C,0x22,0x62,0xA0,0x10,0xA9,0x10,0x31,0x85,0x1A,0x00,0x55,0xA8,0x11,0xAA,0x89,0x31,0x51,0xD0,0x09,0x11,0xDB,0x32,0x89,
+0x93,0xAF,0x14,0x9C,0x92,0x5A,0xA0,0x13,0xAF,0x02,0x99,0x20,0xA0,0x80,0x8B,0xE9,0x40,0xB0,0x09,0xC8,0x4A,0xA3,0x20,0xA8,0xDB,0x72,0xA8,0x18,0x91,0x3C,0x07,0x0A,
+0x99,0x00,0x03,0x0D,0x86,0x8B,0x13,0x9A,0x20,0x88,0x65,0x91,0xAB,0x98,0x41,0xC8,0x52,0x98,0xA9,0x51,0x90,0xAB,0x81,0x4B,0xC3,0x19,0x10,0x13,0xFA,0x32,0x9C,0xB3,
+0x0F,0x90,0x13,0x9C,0x11,0x12,0xA0,0x1C,0x84,0x8C,0x32,0x09,0x91,0xD8,0x79,0xD1,0x28,0x8A,0x31,0xE1,0x0A,0x09,0x05,0xB9,0x38,0x85,0x8B,0x01,0x8A,0xB8,0x3D,0x27,
+0x89,0xA9,0x11,0x80,0xCB,0x91,0x5B,0xA2,0x88,0x43,0xAF,0x24,0x98,0xBB,0x91,0x88,0xCF,0x62,0x98,0x89,0x20,0xA8,0xBA,0x00,0x9A,0x98,0xC9,0x78,0x90,0x22,0xBE,0x21,
+0xAA,0x08,0x27,0xAA,0xA1,0x1C,0xA4,0x1B,0x81,0x00,0x41,0xDC,0x23,0x9C,0x92,0x28,0xA1,0x49,0xFB,0x01,0x8D,0x05,0x9B,0x14,0x89,0x13,0xBC,0x12,0x98,0x88,0x25,0x9B,
+0xA9,0x65,0xB8,0x28,0x98,0x21,0x10,0xB9,0x42,0x01,0x7A,0x87,0x28,0xA0,0x09,0x32,0x88,0x42,0x84,0x09,0x82,0x28,0x83,0x0A,0x73,0x27,0x89,0x11,0x01,0x4C,0x06,0x28,
+0x10,0xA3,0x5B,0x15,0x9C,0x04,0x0B,0x11,0x07,0x09,0x92,0x0B,0x23,0x19,0xB1,0x50,0x81,0x48,0x01,0xA1,0x2E,0xA2,0x01,0x70,0x90,0x13,0x09,0xAC,0x02,0x24,0xBF,0x21,
+0x01,0xCA,0x49,0xA3,0x2B,0x06,0x9C,0x01,0x9B,0x01,0x01,0xBA,0x8D,0x32,0xA0,0x81,0x09,0xEA,0xC8,0x6B,0xC1,0x11,0xAD,0x91,0x42,0xBE,0x81,0x0B,0x92,0x28,0xBA,0xB8,
+0x9F,0x92,0xAC,0x10,0xBA,0x41,0xFA,0x0B,0x80,0xAA,0x98,0x18,0xED,0x28,0xCA,0x98,0x21,0xBF,0x13,0x9D,0x81,0x0A,0xC1,0x2B,0xA0,0x80,0x2C,0xE3,0x8C,0x11,0x02,0x9B,
+0x93,0xAF,0x22,0x08,0xC1,0x2A,0xBA,0x36,0x88,0xB9,0x48,0x83,0x0C,0x13,0x89,0x62,0x91,0x00,0x19,0x93,0x69,0x06,0x09,0x05,0x20,0xDB,0x43,0x08,0x03,0x01,0x98,0x20,
+0x26,0x21,0xB0,0x48,0x29,0x07,0x20,0x08,0x14,0x29,0x35,0x91,0x50,0x91,0x11,0x62,0x81,0x30,0xA1,0x58,0x93,0x59,0x01,0x82,0x3C,0xA4,0x20,0x50,0xB2,0x71,0x90,0x02,
+0x8A,0x8B,0x37,0x1C,0x94,0xAB,0x40,0x08,0x86,0x1B,0xD2,0x20,0xAB,0x04,0x0A,0xA8,0x80,0x0C,0x14,0xB9,0x10,0x8C,0x87,0x0A,0xA0,0x9A,0xA9,0x09,0x80,0xE8,0x2D,0xD0,
+0x68,0xC8,0x20,0xAA,0xB0,0x49,0xA1,0x1A,0xB9,0x22,0x0D,0xB3,0x1C,0x91,0x80,0xF8,0x1B,0xC0,0x09,0x31,0xE9,0x1B,0xD3,0x2A,0xD0,0x10,0xAB,0x34,0x0B,0xA7,0x2E,0xB1,
+0x39,0xB9,0x23,0xA9,0x10,0xAB,0x24,0xC9,0x19,0xC2,0x8F,0x32,0xBA,0x81,0x0B,0xE8,0x51,0xB9,0x98,0x38,0xD8,0x31,0xFA,0x28,0xB0,0x58,0x82,0x9B,0x21,0x98,0x18,0x09,
+0x86,0x1C,0xD1,0x48,0x81,0x08,0xAA,0x53,0xB0,0x9E,0x34,0xA9,0x0A,0x25,0x99,0xBB,0x44,0x09,0x80,0x90,0x4D,0x96,0x1C,0xA2,0x0B,0x80,0x51,0x92,0x0A,0x83,0x0D,0x02,
+0x09,0xB0,0x7A,0xA3,0x1B,0x18,0x86,0x8D,0x14,0x88,0x08,0x88,0x32,0xBB,0x33,0xD9,0x48,0xE9,0x30,0x90,0x21,0xD8,0x41,0x01,0x91,0x29,0x80,0x32,0x92,0x54,0xAB,0xF1,
+0x5C,0x92,0x98,0x18,0x88,0x89,0x91,0x1A,0x98,0x07,0x6B,0xA2,0x19,0x18,0xDB,0x73,0x90,0x10,0x99,0x21,0x99,0x91,0x19,0x90,0x90,0x2A,0x15,0xCE,0x13,0xAE,0x42,0xA1,
+0x0D,0x91,0x10,0x8A,0xA3,0x9F,0x22,0x80,0xAA,0x53,0xC9,0x9A,0x33,0x88,0xD9,0x2A,0x14,0x18,0x98,0x14,0x2B,0xC1,0x54,0x88,0x90,0x90,0x9B,0x11,0x27,0xA9,0x1A,0x97,
+0x0C,0x11,0xB2,0x8D,0xA8,0x37,0xCB,0x08,0x21,0x01,0x88,0xB0,0x0B,0x10,0x15,0x8B,0x02,0xAC,0x33,0x61,0xFA,0x3A,0x91,0x30,0x93,0x18,0xA9,0x60,0x92,0x78,0xD2,0x08,
+0x8B,0x13,0x99,0x21,0x92,0x9F,0x80,0x34,0xCC,0x13,0x2B,0x91,0x92,0xAF,0x43,0xB9,0x42,0x21,0xF9,0x2A,0x23,0xA8,0x88,0x09,0xF8,0x68,0xC2,0x19,0x80,0xA2,0x6C,0xB2,
+0x1B,0x03,0x9A,0x88,0x43,0xBB,0x32,0xB1,0x69,0xB1,0x20,0x0B,0xE2,0x4B,0xB4,0x8E,0x13,0x0A,0x01,0x82,0x9E,0x94,0x1C,0x84,0x89,0x00,0x42,0xDA,0x53,0xCB,0x40,0xD1,
+0x4A,0x93,0xAA,0x28,0x13,0xB1,0x2D,0xC2,0x3A,0x82,0x08,0x98,0x38,0xA8,0x91,0x0F,0x23,0xB0,0x2C,0x34,0xA8,0x01,0x1C,0x94,0x0A,0x50,0xF9,0x88,0x40,0xB9,0x41,0x00,
+0x08,0x01,0x01,0x3A,0xF3,0x3B,0xC0,0x51,0xD9,0x40,0xB0,0x39,0x93,0x0D,0x01,0xC9,0x61,0xB0,0x99,0x44,0xB9,0x28,0x91,0x29,0xE9,0x18,0x30,0x94,0x8D,0x23,0xBA,0x29,
+0xA2,0x0C,0xC3,0x4C,0x86,0xAB,0x11,0xA9,0x28,0x03,0x8E,0x93,0x4A,0xA0,0x10,0x08,0xAA,0xA3,0x2F,0xB5,0x0D,0x02,0x98,0x19,0x81,0x1B,0x17,0x9A,0x18,0x07,0x9D,0x00,
+0xA1,0x2A,0x00,0xD3,0x70,0xD9,0x42,0xB9,0x1A,0x22,0x08,0x9A,0x32,0xC1,0x0F,0x84,0x89,0x10,0xB8,0x3A,0x15,0xC9,0x21,0x99,0x00,0x18,0x13,0x9E,0x02,0x19,0xB8,0x30,
+0x04,0xAF,0x13,0xAA,0x02,0xBB,0x26,0x80,0x09,0x23,0xD9,0x9D,0x41,0x93,0xDA,0x2D,0x95,0x38,0xB1,0x0C,0x02,0x0B,0x10,0x04,0xAC,0x8A,0x07,0x1B,0xA3,0x8A,0x58,0x85,
+0xBA,0x6A,0xA3,0x9D,0x31,0xB1,0x3A,0x83,0x0B,0x87,0x9B,0xA2,0x1A,0x83,0x9A,0xA1,0x56,0xBA,0x99,0x63,0xA9,0x02,0x9C,0x31,0x06,0xCB,0x9A,0x55,0xB0,0x8A,0x11,0xA1,
+0x0E,0x15,0x8A,0xA8,0x34,0xDB,0x10,0x28,0xC8,0x18,0x09,0xA5,0x2C,0x84,0x9C,0x43,0xC0,0x09,0x02,0xA8,0x1A,0x85,0xBB,0x0A,0x27,0xC8,0x30,0xA0,0xB0,0x2C,0x85,0x8A,
+0x81,0x29,0xA1,0x41,0x80,0xAC,0x21,0x51,0xF9,0x19,0x21,0xD8,0x39,0xA2,0x1B,0x22,0x81,0x8F,0x04,0x9A,0xAC,0x73,0xB1,0x0C,0x04,0xB0,0x28,0x91,0xA3,0x8F,0x03,0x9A,
+0x88,0x72,0xC9,0x40,0x91,0x89,0x10,0xA0,0x0A,0x00,0x13,0x30,0xDE,0x21,0x00,0xC8,0x19,0x90,0x78,0xC1,0x39,0x98,0x15,0xAA,0x89,0x34,0xD8,0x1A,0x05,0xAC,0x04,0x8C,
+0x33,0xA9,0x0A,0x24,0xC9,0x09,0x48,0x81,0x88,0x99,0x39,0x87,0x9D,0x22,0x9A,0x81,0x42,0xB0,0x8A,0x44,0x98,0x10,0xFB,0x39,0x81,0xAC,0x42,0x89,0x90,0x13,0x5C,0xC2,
+0x18,0x2A,0xA0,0x87,0x0F,0x04,0xAB,0x42,0xCA,0x24,0x8C,0xA2,0x28,0x88,0x80,0x09,0x23,0xCA,0x62,0xEA,0x31,0xA8,0x9C,0x17,0x8B,0x92,0x20,0xBB,0x25,0xA9,0x09,0x23,
+0xD9,0x09,0x34,0xDA,0x18,0x23,0xB9,0xD9,0x68,0xA0,0x89,0x30,0x80,0xB1,0x0F,0x16,0xB9,0x18,0x01,0xB0,0x2B,0x87,0x9A,0x21,0x92,0x8D,0x12,0xA9,0x38,0x98,0xA2,0x79,
+0xE9,0x41,0xD8,0x38,0x90,0x01,0x19,0x02,0xCB,0x31,0xA9,0x14,0xCB,0x30,0x31,0xFC,0x70,0x89,0x90,0x28,0x98,0x88,0x83,0x2E,0xB2,0x38,0xA8,0x48,0x95,0x0D,0x82,0x18,
+0xA1,0x1C,0x86,0x8B,0x13,0x8A,0x13,0xB9,0x2B,0xA3,0x03,0xFF,0x17,0xD9,0x49,0x93,0xAB,0x59,0x84,0xAC,0x22,0x90,0x99,0x32,0xA9,0x08,0x01,0x89,0x29,0xB2,0x39,0x0A,
+0x83,0x35,0xCB,0x88,0x36,0xDD,0x20,0x01,0xD9,0x49,0x03,0xAA,0x31,0xA2,0x8E,0x02,0x0B,0x00,0x81,0x0C,0x06,0x0C,0x81,0x11,0xBA,0x34,0xB0,0xAD,0x44,0x99,0x8A,0x06,
+0xAA,0x11,0xA1,0x4A,0xB0,0x00,0x82,0x3D,0xC6,0x39,0xB1,0xA9,0x41,0xB1,0x2D,0xB0,0x55,0xAC,0x21,0x11,0xBC,0x22,0x19,0xE1,0x20,0x98,0xA8,0x50,0xA1,0x09,0x01,0x01,
+0xBD,0x41,0x01,0xCC,0x68,0xA3,0x0D,0x02,0x99,0x33,0xCA,0x00,0x20,0x91,0x09,0x02,0xC1,0x8D,0x01,0x02,0xC9,0x79,0xA3,0x0B,0x81,0x01,0xAA,0xD3,0x3E,0x95,0x8B,0x12,
+0x01,0xBA,0x00,0x23,0xAF,0x14,0x88,0x1C,0x83,0xA0,0x1F,0x03,0xC8,0x2C,0x05,0x9A,0x01,0x88,0x1A,0xB2,0x49,0x98,0xB9,0x53,0xD9,0x30,0xB1,0xA9,0x47,0xDA,0x01,0x08,
+0x49,0xC2,0x49,0xB0,0x19,0x92,0x69,0xC0,0x18,0x20,0xB0,0x32,0xCD,0x21,0xA0,0x09,0x09,0x17,0x8F,0x11,0x80,0x8A,0x30,0xC2,0x38,0x9A,0x83,0x30,0xAE,0x42,0xA1,0x40,
+0xCA,0x10,0x21,0xA9,0x09,0xB0,0x72,0xA8,0xBB,0x73,0xC9,0x41,0xCA,0x31,0x8A,0x81,0x2A,0xC3,0x4B,0xD1,0x18,0x3B,0xD5,0x4A,0x91,0x88,0x19,0x04,0x18,0x81,0xD9,0x58,
+0xA2,0x0D,0x02,0x38,0xC8,0x49,0xA8,0x89,0x3A,0xB7,0x3B,0xD2,0x39,0x92,0x89,0x1B,0xB4,0x6B,0x91,0x99,0x00,0x20,0xBD,0x05,0x0C,0xB1,0x30,0x81,0x80,0x2B,0x07,0x8D,
+0x11,0x82,0x98,0x2A,0xB6,0x1C,0x82,0xB9,0x38,0xC9,0x52,0xE0,0x0B,0x85,0x8C,0x01,0x81,0x89,0x41,0x91,0x10,0xAD,0x22,0x89,0x81,0x1A,0x05,0xBC,0x72,0xB0,0x38,0xC8,
+0x0B,0x14,0x88,0x90,0x28,0xCB,0x26,0xAA,0x21,0x32,0xB8,0x62,0xD8,0x39,0xD2,0x48,0xA1,0x99,0x62,0xDA,0x28,0x80,0x8A,0x83,0x9A,0x20,0xA1,0xAC,0x32,0xDC,0x40,0x93,
+0x1D,0x82,0x10,0x90,0x38,0x85,0xAA,0x71,0xA2,0x8A,0x12,0x0D,0x95,0x3A,0xD9,0x02,0x1A,0xBA,0x35,0x9C,0x91,0x1B,0x85,0xAA,0x8A,0x34,0x99,0xDB,0x32,0xDA,0x20,0x10,
+0x84,0x8B,0xC0,0x3A,0xE3,0x49,0x02,0x92,0x0C,0xA1,0x09,0x13,0xAB,0x99,0xAB,0x29,0x88,0xF9,0x89,0x73,0x91,0xDD,0x28,0x11,0x32,0xB1,0x29,0xDF,0x32,0x92,0x0F,0x04,
+0xAB,0x11,0x02,0xD1,0x0C,0x02,0x90,0x18,0x80,0x88,0x29,0x25,0x98,0x09,0xD2,0xAF,0x13,0x21,0xB8,0x2B,0x25,0xAA,0x42,0xA0,0xAA,0x29,0xD9,0x42,0xFA,0x0C,0xB3,0x68,
+0x80,0x10,0x20,0x11,0xD2,0x8B,0x98,0x24,0x99,0xA8,0x29,0x0B,0x17,0x3B,0xD1,0x38,0xFB,0x30,0xBA,0x11,0x88,0x31,0xA8,0x96,0x8C,0x09,0x06,0x2A,0x52,0x05,0x9C,0x01,
+0x51,0xD0,0x38,0xA9,0x21,0x88,0x31,0x90,0x10,0xA3,0x8F,0x91,0xEA,0x1B,0x16,0xB9,0x01,0x0F,0x04,0x8B,0x13,0x18,0x87,0x1B,0x04,0x00,0xA8,0x34,0x09,0xFB,0x40,0xB8,
+0x99,0x9A,0x12,0xBE,0x11,0x99,0x29,0x02,0x11,0x50,0x82,0x57,0x90,0x21,0x80,0x22,0xA0,0x38,0x82,0xF2,0x2F,0xB1,0x99,0x8D,0x01,0xDB,0x38,0x88,0xDB,0x52,0x9C,0x13,
+0x3A,0xD4,0x69,0xA1,0x18,0x08,0x84,0x0B,0x04,0x0B,0x93,0x09,0x28,0x92,0xAC,0x42,0xC9,0x1B,0x96,0x3B,0xE0,0x10,0x1A,0xB8,0x25,0x9A,0x12,0x88,0x04,0x8F,0xB3,0x2C,
+0x93,0x2A,0xB2,0x68,0xC8,0x11,0x09,0xA0,0x28,0x98,0x43,0xAC,0x25,0x89,0x08,0x84,0x0D,0x02,0xB9,0x0B,0x46,0xEB,0x41,0x98,0x80,0x08,0x04,0xAD,0x31,0x88,0x88,0x10,
+0x81,0x9B,0x25,0xCC,0x20,0xC8,0x31,0x82,0x09,0x80,0x19,0xC8,0x50,0x90,0x48,0xA1,0x1C,0x92,0x98,0x1B,0xB2,0x1C,0x25,0xAF,0x05,0x1A,0x84,0x18,0x80,0x09,0xF9,0x30,
+0xE9,0x89,0x10,0x00,0x38,0xA5,0x1B,0xBA,0x88,0x88,0x68,0x04,0x80,0x28,0x85,0x1B,0x04,0x1B,0xB1,0x0C,0xFB,0x0A,0xAA,0x21,0x88,0xDB,0x2A,0xF2,0x3A,0xA1,0x80,0x59,
+0x84,0x08,0x10,0xD8,0x62,0xA0,0x21,0xA8,0x19,0x99,0x15,0x8B,0x95,0x8A,0xA8,0x20,0xED,0x89,0x90,0x8A,0x73,0xA1,0x0A,0x80,0xB8,0x19,0xA0,0x48,0x95,0x78,0x00,0xA2,
+0x8D,0x80,0x01,0xA0,0x9B,0x1A,0x86,0x8B,0x10,0xE8,0xAA,0x2A,0xB4,0x49,0xB1,0x3B,0x07,0x9B,0x23,0x9A,0x9B,0x36,0x92,0xA0,0x59,0x14,0x03,0x0D,0xB1,0x3B,0xAA,0x24,
+0xB9,0x41,0xA9,0xCA,0x11,0xBA,0xFF,0x31,0x00,0x13,0xAC,0x11,0x99,0x9D,0x36,0xB8,0x30,0xCA,0x20,0x00,0xBA,0xBA,0x73,0xB5,0x39,0xA1,0x89,0x09,0x08,0x85,0x9A,0xEB,
+0x80,0x63,0xB9,0x22,0x08,0xA8,0x2A,0x45,0xFA,0x4B,0x83,0x8B,0x91,0x59,0xA3,0x28,0xC9,0x32,0xDA,0x10,0x09,0x17,0x19,0xB1,0xAF,0x20,0x80,0xA0,0x0C,0x00,0x31,0x27,
+0xAA,0xA0,0x09,0x10,0xC3,0x89,0x89,0x43,0xF8,0x9A,0xBA,0x54,0x02,0x09,0x03,0x9D,0xA1,0x1D,0x14,0x9B,0x81,0x21,0xDA,0x2A,0x24,0x9A,0xA1,0x1B,0x35,0x18,0xD0,0x8C,
+0xA8,0x72,0x80,0x34,0xBB,0x40,0xEA,0x18,0x00,0x12,0x98,0x41,0x80,0xA1,0xFB,0x9B,0x02,0x00,0x36,0xDB,0x01,0x20,0xAA,0x21,0x00,0x29,0x67,0xAA,0xA0,0x0E,0x01,0x11,
+0xCB,0x50,0xB8,0x30,0x12,0x22,0xEA,0x22,0xBC,0x21,0x02,0x9B,0x12,0xB1,0x2A,0x84,0x9F,0x15,0x99,0xCC,0x30,0x02,0x31,0xBA,0x8B,0x50,0x02,0xC9,0x50,0x03,0x80,0xDD,
+0x18,0x08,0x22,0xB9,0x62,0x90,0x01,0xB9,0x8B,0x38,0x27,0xEB,0x19,0x25,0x98,0x10,0xAA,0x29,0x04,0x88,0x1A,0x95,0x1B,0xFB,0x19,0x01,0x40,0x03,0xA8,0x20,0xDA,0xB9,
+0x5A,0x23,0x8B,0x45,0x92,0xBD,0x08,0x98,0x3A,0x14,0x30,0xF1,0x58,0x83,0x90,0x29,0xFC,0x2B,0x12,0x53,0xA8,0xA9,0x1A,0x34,0x07,0xAB,0x80,0x1A,0xC0,0x9B,0x19,0x26,
+0x08,0x00,0x80,0x81,0x40,0xC9,0xAA,0x19,0xE9,0x89,0x25,0x42,0xA0,0x8A,0x43,0x30,0xF0,0x08,0x8C,0x36,0x90,0x9A,0x30,0x23,0xB0,0xAF,0x10,0x31,0x92,0x00,0xBD,0x72,
+0x10,0x93,0x9E,0x80,0x10,0x01,0x89,0x02,0x1A,0x85,0x99,0x8C,0x02,0xAA,0x21,0x47,0xA8,0xAB,0x99,0x71,0xB4,0x9C,0x21,0x90,0x99,0x02,0x30,0xD2,0x8C,0x73,0xB2,0xAF,
+0x10,0x42,0xB1,0x0A,0x03,0xAE,0x52,0x81,0xCB,0x29,0x43,0x91,0x99,0x99,0x99,0x73,0xA5,0xCC,0x19,0x44,0x82,0xCB,0x09,0x32,0xB8,0x29,0x33,0xD8,0xBA,0x9F,0x42,0x14,
+0xC9,0x9B,0x51,0x25,0xB8,0xAB,0x28,0x23,0x91,0xDB,0x9A,0x51,0x24,0xA0,0xBC,0x38,0x44,0x12,0xDA,0x8B,0x21,0x01,0x08,0x80,0xB9,0xBE,0x89,0x44,0xB8,0xBF,0x1A,0x53,
+0x02,0x80,0x88,0x32,0x34,0x90,0xBA,0x9B,0x18,0x12,0x90,0xEF,0x9A,0x08,0xB0,0xAF,0x8A,0x99,0x18,0x41,0x23,0x18,0x24,0x64,0x24,0xA1,0xAB,0x41,0x33,0x92,0xCD,0x0A,
+0x22,0x90,0xBA,0xBC,0xAB,0xBC,0xAB,0x80,0xCA,0x9A,0x28,0xB2,0xAE,0x98,0x99,0x18,0x66,0x03,0x80,0x11,0x43,0x02,0xA9,0x8C,0x57,0x23,0x98,0x89,0x42,0x13,0xA0,0x09,
+0x99,0x03,0x20,0xA8,0xC9,0xDF,0x9B,0x00,0x01,0xB9,0x8D,0x53,0x12,0x21,0xA1,0xAE,0x09,0x43,0x04,0xDB,0x08,0x42,0x13,0x98,0xA9,0x38,0x31,0x93,0xBE,0x0B,0x98,0x31,
+0x11,0x87,0xCE,0x9A,0x18,0xB8,0xDD,0x0A,0x13,0x00,0xA0,0xBF,0x28,0x31,0x13,0x8A,0xDA,0x59,0x13,0x11,0xD9,0x0A,0x82,0x89,0xA9,0xDC,0x09,0x00,0x62,0x01,0xA8,0xCD,
+0xAB,0x22,0xDD,0x10,0x81,0x43,0x14,0x99,0x8A,0xAA,0x8B,0xA0,0xAF,0x09,0x52,0x14,0x01,0xA8,0xC9,0x3A,0x27,0x90,0x0B,0x23,0x98,0xEC,0x8A,0xFA,0x8A,0x18,0x01,0x55,
+0x12,0x31,0x23,0x82,0xBB,0xCC,0xAB,0x8A,0xB0,0xBE,0x0A,0x42,0x01,0x36,0x80,0x53,0x11,0x12,0xA8,0xA8,0xBA,0x0A,0x90,0xDD,0x08,0xB9,0x8A,0xC9,0x72,0x94,0x09,0x32,
+0x91,0x8D,0x81,0x40,0x81,0x13,0xAD,0x00,0x20,0xC8,0x0A,0x30,0xD3,0x0D,0x04,0x8A,0xD8,0x1B,0x82,0x11,0x41,0x95,0x29,0xC2,0x2A,0xC9,0x10,0xA8,0x98,0xAA,0xDE,0x8C,
+0x13,0xBB,0x28,0x92,0x22,0xE0,0xDA,0xBC,0xBB,0x70,0x04,0x00,0x88,0xA8,0x89,0x09,0x21,0x04,0x81,0x9B,0x02,0x11,0x3D,0x97,0x8A,0x98,0xEC,0x30,0x45,0x13,0x34,0xC1,
+0xBE,0xA9,0xAA,0xA9,0x08,0x21,0x52,0x36,0x01,0x20,0xA0,0xBD,0xCB,0xAA,0x28,0x20,0x64,0x44,0x33,0x33,0x12,0x32,0xA0,0xEB,0xBB,0xCC,0xCC,0xAA,0xB9,0x9C,0x99,0xBA,
+0xAB,0x98,0x8A,0x73,0x33,0x32,0x44,0x43,0x31,0x26,0x21,0x31,0x35,0x23,0x22,0x11,0x32,0x98,0x31,0xC8,0x9A,0xAB,0xFA,0x9D,0xB8,0xBC,0xBB,0xB9,0x9D,0xEA,0x9C,0xA0,
+0x9C,0x80,0xAA,0xC8,0x8B,0xA8,0xCB,0x1A,0x93,0x0B,0x26,0xA0,0x51,0x42,0x23,0x28,0x36,0x02,0x70,0x23,0x81,0x18,0x32,0x03,0x72,0x12,0x88,0x32,0x80,0x61,0x23,0x91,
+0x09,0xA9,0x22,0x19,0xA1,0xF9,0x9E,0x31,0xA1,0x09,0xFC,0x28,0xB8,0x19,0xC9,0x9C,0xB8,0xBD,0x99,0xD9,0x9B,0x88,0xCC,0x88,0xBB,0xBA,0x0A,0xB8,0xBC,0x99,0xBD,0x98,
+0x2B,0x47,0x89,0x08,0x34,0xB0,0x8A,0x22,0xA3,0x7C,0x25,0x80,0x31,0x03,0xB0,0x2C,0x06,0x08,0x20,0x12,0x34,0x82,0x34,0xC9,0x45,0xB9,0x43,0xB9,0x40,0xC2,0x3A,0x83,
+0x32,0xA2,0x70,0xA1,0x0B,0x99,0x33,0x19,0x84,0x8C,0x47,0xA8,0x10,0x20,0x00,0x90,0x21,0x18,0x15,0x98,0x62,0xA9,0x47,0x98,0xA9,0x20,0x03,0x80,0xA8,0x9D,0x91,0xC8,
+0xB9,0xBD,0x01,0xDA,0x8C,0x83,0xA9,0xBC,0x89,0xEB,0x08,0xB9,0x99,0xFA,0x2B,0xE0,0x0A,0x00,0xC9,0x0A,0x02,0xA0,0x9D,0x20,0x04,0x8D,0x15,0x89,0x90,0xDB,0x41,0xA1,
+0x38,0x05,0x19,0x93,0x0D,0x24,0x19,0x83,0x2B,0x13,0x18,0x30,0x00,0x77,0x93,0x22,0x88,0x08,0x80,0x11,0x9D,0x15,0x50,0x83,0x33,0x24,0x8B,0x04,0x1B,0x48,0x84,0x63,
+0xDB,0x88,0x30,0x91,0xA8,0x71,0x92,0x9B,0x12,0xB9,0x18,0xB9,0x0B,0xBE,0x48,0x24,0xBC,0x10,0xAB,0x21,0x93,0x2E,0xE0,0x08,0xAB,0x81,0xD9,0x4A,0x92,0x81,0x9D,0xFB,
+0x29,0xC0,0x0A,0x98,0x80,0xBA,0x31,0xE8,0x0C,0x89,0xB8,0x8F,0x90,0xAA,0x18,0x21,0xE9,0x08,0xD9,0x98,0x0B,0x92,0x9C,0x01,0xAE,0x29,0x12,0xFB,0x9C,0x12,0x88,0x1A,
+0xF1,0x2B,0x12,0x01,0xBA,0x9A,0xDA,0x08,0xDD,0x88,0x09,0x82,0xAA,0x11,0xBF,0x80,0x19,0x89,0x15,0xBB,0x38,0x91,0xBC,0x55,0xB8,0x1C,0x05,0x2A,0x04,0x89,0x88,0x80,
+0x40,0x82,0x9E,0x05,0x0A,0x12,0xB0,0x3C,0x85,0x29,0x84,0x2B,0x57,0x9C,0x23,0xA0,0x08,0x81,0x58,0x85,0x0A,0x00,0xA8,0x60,0x03,0x28,0xB8,0x1A,0x61,0xA1,0x52,0xA8,
+0x18,0x14,0xBA,0x20,0x34,0x82,0x9B,0xA0,0x48,0x37,0x93,0x0C,0x11,0x12,0x19,0x91,0xAF,0x44,0xB0,0x08,0x22,0x23,0xFB,0x9B,0x28,0x22,0xCA,0x0A,0x72,0x04,0x88,0x8A,
+0x80,0x18,0x19,0xDA,0x10,0xBB,0x0A,0xDA,0xAE,0x19,0x98,0x9C,0x52,0x01,0x20,0xF9,0x0B,0x81,0xDB,0x29,0x12,0x12,0xDB,0x90,0x8E,0x21,0xBB,0x0D,0x91,0x09,0x34,0xFA,
+0x99,0x10,0x12,0xCC,0xC8,0x79,0xB8,0x23,0x8E,0x04,0x98,0x09,0x10,0x80,0x29,0x98,0xA0,0x9D,0x70,0x82,0x99,0x0C,0xB1,0x58,0xFB,0x53,0xBA,0x31,0x88,0x92,0x3A,0x82,
+0x98,0x0C,0x13,0xAC,0x13,0xEB,0x29,0x13,0x9A,0xB0,0xAF,0x20,0x23,0xE8,0x1A,0x11,0x14,0x08,0x98,0xF8,0x50,0x90,0x08,0x9A,0x98,0x28,0x05,0x1A,0x15,0x99,0x21,0xA2,
+0x0D,0x63,0x83,0x08,0xB8,0xAA,0x70,0xD0,0x89,0x08,0x13,0x0A,0x82,0x1A,0x26,0x98,0x80,0x21,0x67,0x90,0x89,0x98,0x18,0x91,0xB1,0x5B,0x86,0xA9,0x9B,0x09,0x15,0x81,
+0xBA,0x89,0x61,0xAA,0x01,0x8B,0x20,0xD8,0x0D,0x33,0x92,0x79,0xD4,0x19,0x21,0x01,0x80,0x1B,0x17,0x98,0x10,0x02,0xB9,0xFA,0x61,0x82,0x8A,0x01,0x9A,0xA0,0x48,0x81,
+0x99,0x80,0xA2,0x0A,0xF8,0x0F,0x14,0x08,0x04,0x0A,0xA1,0x3B,0x94,0x10,0xDB,0x44,0x80,0xAC,0x88,0x03,0x9E,0x83,0x88,0x99,0x16,0xA8,0x8C,0x01,0x48,0x80,0x0D,0x43,
+0x10,0x02,0xD8,0x0A,0x15,0x30,0xC8,0x2C,0xB0,0x38,0xB8,0x41,0xC0,0x6A,0x82,0x39,0x21,0xF8,0x2A,0xB0,0x22,0x18,0xAC,0x45,0x18,0xB0,0x2B,0x17,0xA8,0xA9,0x2A,0x46,
+0xE8,0x1A,0x12,0x81,0x0B,0x23,0x90,0x8A,0x11,0x6A,0x94,0x8B,0xA2,0xBF,0x21,0x01,0x22,0x91,0xAB,0xC0,0x3B,0x24,0x85,0x29,0xEC,0x1B,0x88,0xB0,0x9B,0x50,0xA5,0x39,
+0xDA,0x20,0x13,0xAC,0x05,0x9A,0x71,0x93,0xBC,0x09,0x01,0x01,0xBC,0x18,0x48,0x07,0x3A,0xB0,0x42,0xAE,0x11,0x89,0x05,0xBB,0x91,0x0A,0x44,0x90,0x89,0x09,0x33,0xB9,
+0xDB,0xBF,0x31,0x43,0xC9,0x09,0x45,0xA9,0x98,0x3A,0x17,0x08,0xB0,0xAB,0x40,0x11,0x91,0x0B,0x05,0xBA,0x9D,0x81,0x98,0x10,0x27,0xA0,0xAC,0x41,0x91,0x39,0xC9,0x99,
+0x1A,0x73,0x03,0xA8,0xAB,0x12,0x31,0x0A,0x91,0xAB,0xBF,0x9A,0x15,0x80,0xEE,0x10,0x12,0xDA,0x10,0x21,0x09,0x61,0x92,0x8D,0x82,0x18,0x81,0xBA,0x20,0xC2,0x9A,0x1B,
+0x16,0x91,0x2E,0xA5,0x1A,0x08,0x80,0x8B,0xAB,0x22,0x84,0xDB,0xBC,0x70,0x04,0x89,0x92,0x0A,0xA1,0x5B,0xDA,0x13,0x2B,0xD2,0xBA,0x0C,0x83,0x99,0x33,0x9F,0x15,0x8B,
+0xE2,0x49,0x83,0x98,0x2B,0xD2,0x3A,0x18,0x03,0xBA,0x9F,0x84,0x9B,0x14,0x39,0xC1,0x20,0xBA,0x84,0x1B,0x83,0x09,0x66,0xE8,0x19,0x81,0x9A,0x18,0x80,0x99,0x02,0xAE,
+0x43,0xEA,0x40,0x92,0xCB,0x10,0x53,0xB1,0x0A,0x21,0xEB,0x38,0x33,0x82,0xCD,0x9B,0x44,0xAA,0x91,0x59,0xB8,0x32,0xA8,0x1C,0x25,0x98,0xAC,0xB9,0x70,0xA1,0x41,0x00,
+0x93,0xAD,0x9C,0x25,0x89,0x08,0x81,0xA9,0x58,0x84,0x8A,0x9A,0x92,0x38,0xEA,0x89,0x44,0x98,0x22,0x01,0xF9,0x0A,0x18,0x43,0x99,0x84,0xAF,0x80,0x30,0x21,0x81,0x10,
+0xFB,0xAD,0x10,0x51,0x15,0xA9,0xA9,0x9B,0x52,0x08,0x22,0x82,0xBA,0x89,0x9E,0x20,0x02,0xC9,0x62,0x82,0xC9,0x19,0xE0,0x8C,0x33,0x88,0x12,0x18,0x80,0xC8,0x60,0xA8,
+0xA8,0x98,0x8E,0x94,0x3A,0xB2,0x41,0x20,0x95,0xBF,0x21,0x89,0xA0,0x79,0x85,0x09,0xB0,0x29,0x80,0x80,0xAC,0x32,0x11,0x32,0xF8,0xBA,0x59,0x87,0x9A,0x11,0x9A,0x95,
+0x0E,0x12,0x12,0xAB,0x12,0xB9,0x28,0xB8,0x32,0x8E,0x03,0x38,0x02,0x17,0x0C,0xA2,0xAE,0x31,0x89,0xB9,0x61,0x91,0xB9,0x4A,0x12,0x80,0x29,0x85,0x0B,0xD0,0x3A,0x82,
+0x28,0xD8,0x22,0xBF,0x23,0x8E,0x82,0x38,0xA2,0x48,0xB9,0x41,0xC8,0x28,0xA8,0x01,0x80,0x2A,0x04,0x30,0x62,0xC1,0x19,0xD9,0x89,0x43,0xB8,0x38,0x96,0x0C,0x23,0xC9,
+0x30,0x02,0xFC,0x29,0x12,0x10,0x89,0x91,0x99,0xEB,0x42,0xA8,0x89,0x21,0xE0,0x2C,0x15,0xA9,0x19,0x99,0x81,0x10,0x49,0xA6,0x8D,0x25,0x98,0x98,0x9A,0xA0,0x4A,0xA5,
+0x8D,0x81,0x10,0xAB,0x42,0x88,0x32,0xBB,0x33,0x0A,0x77,0xA2,0x1C,0x93,0x0E,0x81,0x20,0x23,0xA1,0x9A,0x02,0xAF,0x13,0xAC,0x88,0x31,0xA8,0x39,0x83,0xD9,0x2A,0x91,
+0x52,0x05,0xCA,0x89,0x84,0x59,0xC1,0x50,0xA0,0x23,0xAA,0x00,0x09,0x30,0xFC,0x3A,0x08,0x90,0x35,0x19,0xD9,0x21,0x0A,0x90,0x40,0x34,0x98,0x02,0x3B,0xC9,0x17,0x9F,
+0x00,0x28,0x91,0x11,0xCA,0x2A,0xB1,0x1A,0x53,0xC1,0x99,0x81,0xCB,0x11,0x46,0xDA,0x32,0xCB,0x30,0xB2,0x9D,0x00,0x09,0x88,0x2C,0x92,0xBC,0x79,0xB3,0x1C,0x23,0xC9,
+0x00,0xCC,0x42,0x08,0x01,0xEA,0x58,0xA3,0x0A,0x13,0x89,0x03,0xB8,0x1A,0x02,0xDA,0x29,0xF9,0x60,0x90,0x28,0x80,0x00,0x1C,0x92,0xBA,0x40,0x83,0x93,0x9F,0x11,0x24,
+0x40,0xD8,0x29,0x01,0xD9,0x50,0xD8,0x18,0x21,0x12,0xC1,0x49,0xC1,0x9A,0x31,0xB0,0x48,0x84,0x9D,0x01,0x89,0x1A,0xCB,0x53,0xEB,0x11,0x09,0x28,0xA4,0x1F,0xA3,0xAB,
+0x62,0xD8,0x40,0xA8,0x99,0x31,0x98,0x09,0x80,0x0C,0xA1,0x78,0xC4,0x1B,0x05,0x89,0x98,0x31,0xCA,0x52,0x81,0xBA,0xA8,0x9B,0x89,0x88,0x77,0xB1,0x1C,0x06,0x9B,0x41,
+0xB1,0x0D,0x22,0xBA,0x30,0x82,0x89,0x22,0xD8,0xAC,0x10,0x92,0x59,0x84,0x8C,0x23,0xDA,0x19,0x83,0x9E,0x13,0x98,0x30,0x02,0x89,0x11,0x88,0xCB,0x31,0x0A,0x91,0x47,
+0xAD,0x82,0x9B,0x10,0xA8,0x01,0xE8,0x8C,0x24,0x80,0x31,0x88,0xB0,0xA9,0xCF,0x31,0x82,0xA9,0x28,0x23,0x1B,0xB4,0xAF,0x20,0x10,0x83,0xFC,0x18,0x88,0x11,0x0A,0xBC,
+0x64,0xA0,0x9C,0x33,0xC9,0x28,0x05,0xAB,0x20,0x91,0xAA,0x44,0xB1,0xAB,0x99,0x9D,0x73,0x12,0x90,0x9A,0x32,0xB2,0x9F,0x22,0x09,0x33,0xB9,0xCC,0x9A,0x08,0xBA,0x54,
+0x02,0x9E,0x11,0xCB,0x29,0x16,0x88,0x10,0x03,0x09,0x37,0x8A,0xB9,0x68,0x88,0x89,0x59,0x03,0xDB,0x99,0x1A,0x91,0x09,0x81,0xBE,0x0A,0x32,0xA0,0x0A,0x05,0x9E,0x81,
+0xB9,0x72,0xA1,0x2B,0x07,0xAA,0x11,0xEA,0x29,0x24,0x00,0x98,0x0B,0x93,0x2A,0x01,0xBF,0x41,0x98,0x11,0xB0,0x21,0x82,0xDD,0x18,0x8A,0x23,0xAE,0x38,0xA9,0x19,0x80,
+0x80,0x84,0x17,0xB8,0xBC,0x19,0x52,0x80,0xAA,0x75,0x02,0x88,0x99,0x9A,0x21,0x03,0xB0,0xB0,0xBC,0xBB,0x78,0x15,0xA9,0x14,0xF8,0x09,0x14,0x98,0x91,0x09,0x53,0x11,
+0xBB,0xA9,0x40,0xA2,0x52,0x80,0x20,0x95,0x0A,0xB8,0x8D,0x57,0x98,0x02,0xB9,0xA9,0x9C,0x32,0x82,0x60,0x12,0xBB,0x80,0xCF,0x11,0xB9,0x28,0x82,0x73,0xC1,0x3A,0x02,
+0xAD,0x20,0xB3,0x49,0x01,0xEA,0x2B,0x33,0xAA,0x51,0xA4,0x0C,0x25,0xB9,0x3A,0x93,0x9F,0x41,0x11,0x18,0x00,0xC9,0x89,0x50,0x15,0xA8,0xAB,0x98,0x21,0xA3,0x0B,0x26,
+0x83,0x9B,0xAC,0x82,0x22,0xE0,0x30,0xC2,0x0C,0x35,0x12,0x0B,0x28,0x82,0xBF,0x42,0x12,0x81,0xBD,0x8C,0x31,0xBB,0x43,0xA9,0x34,0xC0,0x28,0x15,0x32,0x01,0x2A,0x32,
+0xFB,0x28,0xBC,0x78,0x03,0x8A,0x01,0xBD,0x59,0x15,0x89,0x00,0x88,0x98,0xA0,0x89,0x24,0x21,0xDA,0x9A,0x28,0x03,0xCB,0x80,0x80,0x80,0x35,0x40,0x27,0xAA,0xBE,0x21,
+0x32,0xA2,0x08,0xDE,0x09,0x22,0xA8,0x29,0x22,0xBB,0xCB,0x70,0x03,0x8A,0x05,0x9E,0x10,0x01,0x81,0x8B,0x35,0x9A,0x9D,0x43,0xD8,0x0A,0x14,0x98,0x0B,0x28,0x80,0x33,
+0x06,0x28,0xD8,0x9D,0x28,0x81,0x80,0x20,0x17,0xDB,0x19,0x19,0x63,0x00,0xBA,0xBA,0x1C,0x03,0x42,0x01,0x0A,0x32,0xF0,0x9A,0xA0,0x22,0x03,0x0C,0x37,0x88,0xA9,0x08,
+0x0E,0x0A,0x84,0x8B,0x02,0x02,0x3B,0xFC,0x1F,0x02,0x91,0xB9,0x39,0xA2,0xAA,0x63,0x01,0x21,0x0A,0xE8,0x08,0x22,0xF3,0xAB,0x99,0x41,0x86,0x10,0x08,0x11,0xD9,0x99,
+0x48,0x93,0x8C,0xC0,0xAD,0x01,0xA9,0x82,0x80,0x23,0x03,0xFB,0x0D,0x81,0x19,0x15,0x01,0x2A,0xDB,0xAB,0xAA,0x45,0x11,0x03,0xD0,0x89,0x16,0xC9,0x9C,0x88,0x02,0x28,
+0x28,0x82,0x2A,0xFB,0x9D,0x0A,0x98,0xA0,0x8C,0x60,0x15,0x90,0x8B,0x31,0x43,0xB9,0xBE,0x48,0x24,0xC0,0x9C,0x88,0x01,0x12,0x01,0xBD,0x48,0x03,0xA8,0x08,0x01,0xA8,
+0xFE,0x10,0x34,0x91,0x9C,0x89,0x11,0x80,0xB9,0x0A,0x44,0x01,0xC8,0xCB,0x68,0x00,0xBA,0x10,0x89,0x02,0x15,0xAB,0xAB,0x63,0xC9,0x9A,0x80,0x80,0x08,0x73,0x82,0xAA,
+0x05,0x9E,0x31,0x81,0xA9,0xA4,0xA9,0x08,0x33,0xFB,0x0A,0x58,0x91,0xAA,0x0A,0x45,0x10,0xA2,0xCF,0x30,0x92,0x89,0x43,0x08,0x10,0x22,0xEA,0xCD,0x28,0x81,0x10,0x50,
+0x03,0xCC,0x89,0x20,0x33,0x98,0x9D,0x89,0xA0,0x32,0xBB,0xAF,0xA9,0x02,0x32,0x30,0x84,0x8B,0xD0,0x8B,0x64,0x12,0xD2,0x0B,0x21,0xDA,0xA9,0x08,0x38,0x26,0x88,0xAA,
+0x32,0x27,0xBA,0x01,0x08,0xB8,0x73,0xA3,0x80,0xB3,0x8F,0x10,0x20,0xAB,0x83,0x40,0x80,0x04,0x8F,0x80,0x20,0x16,0xC9,0x89,0x19,0x15,0x89,0x80,0xBA,0x43,0xB2,0xCB,
+0x30,0x07,0x84,0xAB,0x0A,0x35,0xA0,0x0A,0x8B,0x07,0x9C,0xA0,0x22,0xBA,0x30,0x30,0x35,0x33,0xDB,0x03,0xBF,0x2A,0x27,0xA0,0x0B,0x80,0x80,0x50,0xB8,0x2A,0xB2,0x0E,
+0x88,0x80,0x3B,0x04,0x08,0xC3,0xBF,0x4A,0x03,0x28,0x15,0x91,0xAC,0x02,0x38,0xB8,0x0C,0x80,0x80,0x44,0x08,0xC3,0x8B,0x80,0x9F,0x02,0x3B,0xD0,0x33,0x8B,0x85,0x80,
+0xD0,0x7B,0x83,0x89,0x82,0x03,0x8B,0x53,0xBB,0x0C,0x43,0xF8,0x39,0x82,0x22,0x23,0xF3,0x89,0x00,0x82,0x16,0xA9,0xA2,0x08,0xCB,0x30,0x03,0x9F,0x22,0x87,0xAB,0x31,
+0xA0,0x0A,0x38,0xC0,0x00,0x03,0x44,0x08,0x58,0x83,0x8B,0xD0,0x03,0x08,0x80,0x0E,0x08,0xD8,0x30,0x34,0xCB,0x30,0x84,0x80,0xB4,0xBC,0x30,0xB4,0x03,0x85,0xCB,0x80,
+0x34,0xF0,0x28,0x82,0x20,0xB3,0xFB,0x3D,0x92,0x4A,0x93,0xCA,0x30,0x00,0xBB,0x80,0x27,0x9C,0x25,0xB9,0x19,0x89,0x50,0x05,0xA9,0x99,0x08,0x58,0x82,0xBC,0x48,0x21,
+0xCA,0x42,0x98,0x0D,0x58,0x84,0xAA,0x90,0x31,0xFB,0x38,0x13,0xA9,0x10,0xA2,0xBA,0x30,0x34,0x0C,0x30,0xB4,0xDF,0x09,0x12,0x21,0xA4,0x0B,0x84,0x20,0x08,0xBB,0x0C,
+0x8B,0x47,0x81,0x10,0xB9,0xBA,0x3B,0x40,0x80,0x0C,0xC3,0x0C,0x37,0xA8,0xBD,0x21,0x21,0x22,0xB0,0x8B,0xD0,0x73,0x92,0x1B,0xB9,0x00,0x3B,0xD0,0x73,0xD1,0x90,0x89,
+0x41,0x19,0x93,0x1D,0xB0,0x68,0x99,0x30,0xC9,0x19,0xA0,0x82,0x03,0x43,0xFB,0x98,0x8A,0x32,0x16,0xC0,0x1B,0x94,0x9C,0x32,0xC2,0x2A,0xB0,0x1D,0x02,0x38,0x80,0x1F,
+0x82,0x80,0x83,0xF3,0x8B,0x14,0x09,0x84,0x89,0x2A,0xB0,0x0C,0x48,0xB8,0xB8,0x08,0x08,0xF8,0x8B,0xD0,0x3B,0x37,0xC9,0x39,0x02,0x08,0xBB,0x0C,0x8B,0x8B,0x35,0x43,
+0x80,0xF0,0x4B,0x12,0xA0,0x3B,0xCB,0x30,0x07,0x9A,0x8A,0xE0,0x19,0x14,0x19,0xA0,0xCD,0x99,0x48,0x25,0x08,0x89,0xC9,0xAB,0x22,0x95,0x0C,0x34,0xA9,0x80,0xA0,0x35,
+0xA0,0xBD,0x39,0x00,0x08,0xB3,0xBC,0x03,0xBD,0x73,0x90,0x28,0xA8,0x6B,0xB3,0x1D,0x05,0x9A,0x11,0x9A,0x34,0xD9,0x19,0x82,0x0A,0x83,0x3B,0xF0,0x0B,0x82,0x0B,0x80,
+0x04,0x08,0xD0,0x48,0xFB,0x0A,0x14,0x10,0xA0,0x08,0x8B,0xBC,0x80,0x80,0x75,0x91,0x9C,0x21,0x9C,0xA1,0x83,0x30,0xF3,0x0A,0x24,0x9C,0x48,0x08,0x28,0xB0,0xFB,0x19,
+0x82,0x20,0x83,0x03,0xEC,0x2A,0x80,0x03,0x0F,0x33,0xC8,0xCB,0x21,0x33,0xDB,0x10,0x22,0x8A,0x80,0x8F,0x22,0x32,0xDF,0x00,0x09,0x22,0x11,0xA0,0xED,0x2A,0x13,0x01,
+0x91,0x48,0x91,0xAC,0x80,0xD0,0x68,0x90,0x38,0x98,0xA8,0x3A,0xE8,0x48,0xC9,0x30,0xC0,0x48,0x02,0xAB,0x22,0xBB,0x0B,0xC8,0x57,0x8B,0xC4,0x78,0xF0,0x49,0x92,0x9C,
+0x34,0xEA,0x20,0xA1,0x2A,0x02,0xB9,0x48,0xA8,0x30,0xB9,0x51,0xB0,0x29,0x92,0x9A,0x31,0xA8,0x42,0xBB,0x30,0xB3,0x8F,0x43,0xCA,0x08,0x01,0x18,0xC9,0x21,0x98,0x8A,
+0xAB,0x06,0x2A,0xB2,0x80,0x80,0x04,0x53,0x3B,0xE4,0xA9,0x22,0x38,0xB3,0x88,0x3C,0x04,0x1F,0x93,0x28,0xEA,0x08,0x82,0x85,0x89,0x04,0x9E,0x11,0x89,0x32,0xC0,0x21,
+0xFA,0x49,0x92,0x29,0xF2,0x4A,0xB1,0x8A,0x12,0xB8,0x50,0xC1,0x30,0x91,0x89,0x04,0x9C,0xA9,0x42,0x12,0xA0,0x6B,0xD1,0x3B,0x97,0x0C,0x02,0x88,0x98,0x32,0xA9,0x14,
+0x0A,0xDC,0x28,0x81,0x91,0x0A,0x82,0x0B,0x07,0x0C,0x16,0xAA,0x10,0x98,0x48,0xA9,0x20,0x04,0x1C,0x14,0xE9,0x0A,0x12,0x89,0x80,0x15,0x80,0x52,0xD8,0x1A,0x04,0xA9,
+0x09,0xAA,0x0D,0x21,0x94,0x8A,0x83,0xB8,0x73,0xA2,0x40,0xC0,0x2C,0x13,0x0A,0x52,0x82,0xAA,0x0B,0x37,0x9A,0x91,0x8D,0x82,0x24,0x28,0xB2,0xAD,0x40,0xA2,0x20,0x9E,
+0x01,0x08,0xB8,0x30,0x4B,0x84,0x80,0x07,0x08,0x38,0xBB,0x0C,0x03,0x0C,0x08,0x34,0xCB,0xB8,0x08,0x08,0x86,0x40,0xC0,0xCB,0x30,0x70,0x12,0x80,0xBA,0x80,0x40,0x48,
+0x96,0x08,0xB8,0x33,0x4B,0x83,0x80,0xD0,0x08,0x08,0x8D,0x80,0x50,0x48,0xB8,0xAF,0xD9,0x10,0x80,0x38,0x88,0x30,0x84,0x9F,0x9A,0x31,0x88,0x43,0xBB,0x43,0xF8,0x10,
+0x84,0x89,0x22,0xB0,0x30,0x80,0xD8,0x80,0x40,0x80,0xD0,0x0C,0x80,0x84,0x9F,0x83,0xAA,0xBA,0x30,0xB4,0x0C,0x3B,0x08,0xD0,0x08,0x58,0x33,0x07,0xAA,0x00,0x25,0x0A,
+0x02,0x03,0x48,0xB4,0x78,0xA0,0x20,0x32,0xB8,0xAF,0x22,0x08,0x38,0xFB,0x2A,0x01,0x80,0x38,0x37,0x20,0xB2,0xBD,0xA8,0x3A,0x32,0x00,0xD8,0x0B,0xF8,0x99,0xAB,0xB3,
+0x38,0xBC,0x03,0xBD,0x0C,0x80,0x3C,0xFB,0x0A,0x0A,0x3B,0x43,0xB8,0xB3,0x9F,0x80,0x00,0xB8,0x08,0xBD,0xB8,0x34,0x27,0x82,0x8A,0x80,0x30,0x3C,0xB4,0x1F,0x12,0x80,
+0x33,0x08,0x0C,0x17,0x80,0x52,0x01,0x01,0x32,0x9E,0x43,0x8B,0x16,0xCA,0x21,0x9B,0x35,0xAA,0x18,0xC0,0x30,0x84,0x89,0x02,0x38,0x9F,0x10,0xA0,0x0B,0x03,0x0C,0xB3,
+0xBC,0x43,0xCB,0xB0,0x48,0xF8,0x19,0xCA,0x19,0x9C,0x21,0xAA,0xB3,0x0C,0xB8,0x08,0xBF,0x08,0x0B,0x08,0xD8,0x80,0x0C,0x80,0xCC,0x8A,0x8B,0x44,0xBB,0xC8,0xB0,0x08,
+0x04,0x9F,0x80,0x8A,0x43,0xBB,0x48,0x03,0xFC,0x30,0x98,0x28,0x83,0xCB,0x73,0x98,0x10,0x32,0x8B,0x43,0xB3,0x33,0x00,0x08,0x36,0xD0,0x80,0x84,0x30,0x07,0x01,0x0A,
+0x02,0x30,0x40,0x07,0x9C,0x21,0xB0,0x33,0x08,0x78,0xA1,0x38,0xF3,0x19,0x12,0x00,0x08,0xB8,0x08,0x78,0xA4,0x1C,0x14,0xAB,0x00,0xB2,0x3B,0x04,0xC8,0xB0,0x08,0xBD,
+0x48,0x08,0x03,0x0D,0x0C,0xC0,0x80,0x80,0xD0,0xC0,0x00,0x03,0x1F,0xBA,0x00,0x08,0xC8,0xCB,0x03,0x58,0xE8,0x0A,0x80,0xB3,0xC0,0x3B,0x34,0x3B,0xB4,0x0C,0x83,0x8B,
+0xF0,0x2C,0x08,0xA2,0x8B,0x08,0x80,0x80,0x07,0x08,0x0D,0x08,0x0C,0x03,0x3D,0xFB,0x2A,0x21,0x00,0x08,0x0C,0xB3,0x08,0x08,0xBE,0x08,0x04,0x08,0xD8,0x80,0xBF,0x04,
+0x0C,0x01,0x82,0x80,0x03,0x53,0xBB,0x43,0xB8,0x3C,0x07,0x9A,0x08,0x32,0xB3,0x08,0xB5,0x78,0x82,0x52,0x98,0x08,0x82,0x80,0xC0,0x03,0x0C,0x17,0x20,0x08,0x88,0x30,
+0x84,0x80,0x3C,0xCB,0x43,0xB3,0x48,0x30,0x35,0xF8,0x89,0x82,0x80,0x33,0xFB,0x28,0x08,0x08,0x38,0x00,0x08,0x45,0x08,0xBC,0x80,0x80,0x05,0xAF,0x22,0xB2,0x0B,0x30,
+0x04,0xC8,0xCB,0x80,0x0C,0x03,0x40,0x80,0xD0,0x08,0x08,0x08,0x86,0xDB,0x0B,0x80,0x3C,0x80,0x80,0xF0,0xB0,0x08,0x88,0xE0,0x80,0x80,0xBD,0x48,0x03,0x0C,0x08,0x3D,
+0xB8,0xC8,0x43,0xFB,0x08,0x08,0xA8,0x02,0x80,0x37,0x8A,0x30,0x08,0x3C,0x00,0x3D,0x08,0x08,0x0D,0x08,0x58,0x08,0x08,0x0D,0x08,0x3D,0xB3,0x08,0x85,0x30,0xD0,0x30,
+0x80,0x80,0x80,0x80,0xA7,0x08,0x85,0x4B,0x80,0x80,0x50,0x80,0x3D,0x00,0xD8,0x80,0x84,0x80,0xD0,0x30,0x84,0x80,0x8C,0x80,0x85,0x24,0x00,0x08,0x08,0x45,0x08,0xC3,
+0x80,0x80,0x35,0xC0,0xB8,0x78,0x81,0x30,0x08,0xC3,0x80,0x80,0x50,0x80,0x0D,0xB8,0x04,0x08,0x58,0x8B,0x8C,0x84,0x84,0x80,0xBC,0x24,0x03,0x8B,0x50,0x08,0x08,0x08,
+0x0F,0x08,0x78,0x81,0x02,0x0B,0x03,0xD8,0x80,0x80,0x0D,0x03,0xD8,0x03,0x80,0x08,0x0E,0x48,0x08,0x08,0x04,0xBD,0x17,0xA9,0x89,0xBA,0x06,0x2A,0xA8,0x80,0xC0,0x30,
+0xC0,0x03,0x0C,0x80,0x40,0x80,0x80,0x80,0x0F,0x03,0xBD,0x80,0x40,0x8B,0x80,0x80,0x06,0x0C,0x08,0x0D,0x83,0x40,0x80,0x40,0xDB,0x03,0x08,0xBD,0x80,0x84,0x8B,0x85,
+0x03,0x0C,0x80,0x80,0xE0,0x80,0x40,0x48,0x8B,0x40,0xAC,0xB8,0x08,0x08,0x08,0x78,0x84,0xC0,0x80,0x80,0xD0,0x0B,0xC8,0xB3,0x08,0x08,0x08,0x78,0xD1,0x3B,0x00,0xD8,
+0x80,0x80,0xB5,0x3C,0x97,0x8B,0x22,0x0B,0x30,0xF8,0x0A,0x02,0xB8,0x30,0x84,0xC0,0xC0,0x80,0xCB,0x73,0x09,0x2A,0xB8,0xB3,0x43,0xC0,0x80,0xCB,0x43,0xBB,0x3C,0x80,
+0x80,0x50,0x08,0x78,0xD1,0x80,0x82,0x80,0x3B,0xB0,0xBD,0x03,0x80,0x80,0x80,0x0F,0x43,0xCB,0x80,0x03,0x8C,0x80,0x80,0x80,0x07,0x03,0x48,0x80,0x80,0x80,0xF0,0x03,
+0xD8,0xB3,0x08,0x80,0x80,0x0F,0x48,0x8B,0x08,0x50,0x08,0xD8,0x3B,0xC0,0x08,0xB4,0x48,0x8B,0x50,0x08,0x08,0x80,0x0E,0x48,0x8B,0x40,0x08,0xD8,0x80,0x80,0x80,0x86,
+0x84,0xC0,0x80,0x8B,0x85,0x0B,0xC8,0x08,0x08,0x8D,0x80,0x35,0x80,0x80,0x80,0x0E,0xC3,0x08,0xD8,0x80,0x80,0x85,0x80,0x0C,0x0C,0x03,0x0D,0x33,0xD0,0x30,0x80,0x04,
+0x08,0x85,0x80,0x00,0xE8,0x80,0x80,0x80,0xB6,0x0C,0x48,0x08,0xBC,0x00,0x03,0x08,0x08,0x87,0x8B,0x85,0x0B,0x0C,0x03,0x88,0xBD,0x48,0xCB,0x73,0xA0,0x00,0x08,0xB3,
+0x1F,0x03,0x2A,0x80,0xBB,0x48,0xC0,0x80,0x84,0x80,0x85,0x03,0x84,0xCB,0x43,0x8B,0xC0,0x80,0x8B,0x35,0x80,0x80,0x80,0x70,0x08,0x08,0x80,0x86,0x80,0x00,0x08,0xF8,
+0x0F,0x91,0x88,0x23,0x80,0x80,0x80,0x0D,0xC8,0x8F,0x32,0x02,0xB0,0x78,0x82,0x80,0x8A,0xB0,0x48,0xB8,0x08,0xD8,0x30,0x04,0xC8,0x43,0xC0,0x0B,0xF0,0x2A,0xA8,0x80,
+0xC0,0x33,0x00,0x88,0x50,0x80,0xB5,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x9F,0x00,0x68,0x08,0xBC,0x80,0x44,0x08,0x08,0x34,0xB4,0x43,0x08,0x08,0x04,0x0D,0xB3,0x08,
+0x08,0x68,0x3B,0x80,0x80,0x06,0x0C,0x08,0x88,0x80,0xB6,0x08,0xD8,0x3B,0x80,0x50,0x80,0x80,0x80,0x0F,0x0C,0x08,0x08,0x35,0xC0,0x30,0xD0,0x80,0x80,0x8C,0x40,0x80,
+0x40,0x80,0x80,0x60,0xB3,0x0D,0x08,0x3C,0x84,0x80,0xD0,0x03,0xC3,0x43,0x80,0x30,0xB4,0x08,0xBD,0xC0,0x80,0x80,0x58,0x30,0x80,0x80,0xF0,0x08,0x0C,0x48,0x08,0x0C,
+0x08,0x08,0x3D,0x40,0xC0,0x03,0x08,0x3D,0xC0,0xB0,0x08,0x08,0x08,0x08,0x17,0x88,0x05,0xC8,0x0C,0x8B,0x34,0x30,0xD0,0x30,0x40,0x08,0x08,0x8D,0x34,0x80,0x8C,0x80,
+0x0D,0x48,0x48,0x08,0x48,0x38,0x04,0x0C,0x8B,0x80,0x74,0x89,0xA0,0x08,0x08,0x0C,0x03,0xD8,0x80,0x80,0x08,0x08,0x78,0x80,0x00,0xE8,0x80,0x80,0x85,0x30,0x00,0x8D,
+0x84,0xCB,0x30,0x40,0x8B,0x80,0x80,0xBE,0x08,0x04,0x0D,0x48,0x38,0xC0,0x30,0x8B,0xB5,0x08,0x88,0x80,0x80,0x90,0xA7,0x08,0xC5,0x33,0xC0,0x43,0x0B,0xAC,0x8B,0x08,
+0xD0,0x48,0x08,0x08,0xD0,0x03,0xD8,0xC0,0x00,0x08,0x88,0x05,0x03,0x3D,0x80,0x50,0x8B,0xD0,0xB0,0x83,0xF0,0x09,0x08,0x08,0x0C,0x48,0x8B,0x08,0x85,0xC0,0x03,0xD0,
+0x30,0x03,0x08,0x85,0x8B,0x85,0x8B,0x85,0xB3,0x84,0x80,0xD0,0x80,0x80,0x58,0xB3,0x80,0x3D,0xB4,0x08,0xD8,0x80,0x40,0x30,0x80,0x05,0x0C,0xBC,0x30,0x00,0x08,0x08,
+0xF8,0x0C,0x80,0x8F,0x80,0x80,0x0B,0x8B,0x80,0x0D,0x08,0xBD,0x08,0x58,0x08,0x0C,0x0C,0xB3,0x08,0x80,0x86,0x84,0xC0,0xB0,0x08,0x3D,0x08,0x58,0x83,0x30,0x04,0xC3,
+0x3B,0x80,0x80,0x80,0x90,0x57,0x08,0x08,0xC8,0x03,0x80,0x05,0xC8,0x43,0x08,0x0C,0x08,0x08,0x08,0x08,0x8F,0x0C,0x8B,0x80,0x80,0x06,0x08,0xD8,0xB3,0x9F,0x00,0xB8,
+0x8B,0xD0,0x80,0x84,0x8B,0x8B,0x0D,0x08,0x0D,0x08,0x08,0xD0,0x08,0x08,0x8D,0x8B,0x80,0x80,0x80,0x00,0xF0,0x09,0x80,0x80,0x07,0x08,0x48,0xD0,0x03,0x08,0x84,0x80,
+0x80,0x80,0x80,0x70,0x41,0x80,0x04,0x03,0x85,0x84,0x80,0x84,0x80,0x04,0x03,0x85,0x8B,0x35,0x38,0x40,0x24,0x03,0x80,0x80,0x3E,0xB4,0x80,0x84,0x80,0x80,0x80,0xF0,
+0x08,0x58,0x08,0xAC,0xCB,0x80,0x03,0xD0,0x80,0xD0,0x80,0xCB,0xC0,0x80,0x80,0x0C,0xC8,0x0C,0x80,0x80,0xD8,0x80,0xCC,0xBA,0x88,0x00,0x8D,0x80,0x80,0x0E,0xB3,0xD8,
+0xC0,0x30,0xC0,0xBB,0xC8,0x48,0x08,0x08,0x80,0x80,0x70,0xC0,0x30,0x0C,0xC0,0x30,0x40,0x08,0x08,0x08,0x36,0x80,0x50,0x08,0x08,0x08,0x86,0x80,0x35,0x80,0x44,0x38,
+0xB4,0x08,0x58,0x33,0x08,0x58,0x48,0x08,0x78,0x12,0x32,0xB8,0x0F,0x01,0x28,0x82,0x33,0x84,0x80,0x0C,0x80,0x80,0x05,0x48,0x24,0x43,0xB0,0xC8,0xC0,0x30,0x80,0x00,
+0xC5,0x00,0x08,0x88,0x80,0x0E,0x0C,0x08,0x48,0xD0,0xBB,0x8B,0xD0,0x0B,0xC8,0x48,0x08,0xF8,0x0B,0x80,0x0B,0xC8,0x00,0xBC,0x08,0x0D,0x08,0x08,0xD0,0x48,0xF8,0x23,
+0xCA,0x08,0xAA,0x0B,0x08,0x3C,0xB4,0x48,0xBB,0x08,0xBD,0x80,0x80,0x80,0xF0,0x80,0x30,0x0C,0x48,0x8B,0xB5,0x80,0xB4,0x0C,0x08,0x43,0x80,0x85,0x30,0x80,0x85,0x80,
+0xD0,0x80,0x80,0x80,0x86,0x24,0x03,0x8B,0x85,0x80,0x00,0x85,0x84,0x24,0x30,0x00,0x04,0x0D,0x08,0x58,0x83,0x03,0x70,0x03,0x3B,0x08,0x03,0x0D,0x43,0x83,0x80,0x3D,
+0x00,0x88,0x0D,0x03,0x08,0xE8,0x03,0xCC,0x03,0x08,0x04,0x43,0x80,0xBC,0x08,0x04,0x58,0xB8,0xC8,0x30,0x8C,0xD0,0x33,0x84,0xC0,0x30,0x03,0x80,0x80,0x70,0xB8,0xC8,
+0x80,0x80,0x80,0x80,0x90,0x00,0x9F,0x50,0x08,0x0C,0x08,0x08,0x08,0x08,0x78,0x8A,0x0D,0x08,0x08,0x8D,0x84,0x8B,0x85,0x0B,0xC8,0x08,0x04,0x08,0xD8,0x80,0x8C,0x80,
+0xD0,0x08,0xED,0x10,0x80,0x0A,0x08,0x08,0x08,0x8D,0xD0,0x80,0xC0,0x80,0x84,0x80,0x00,0x08,0xF8,0x80,0x80,0xBD,0x08,0x58,0xB8,0x08,0xD0,0x08,0x08,0x08,0x08,0x8F,
+0xB4,0x88,0x0C,0x08,0xD8,0x30,0x80,0x80,0x80,0x90,0x17,0x0D,0x08,0x08,0x50,0x08,0x08,0x08,0x86,0x80,0x80,0xB6,0x08,0x84,0x80,0x80,0x80,0x07,0x48,0x38,0xC0,0x08,
+0x08,0x08,0x78,0x30,0xD0,0x83,0x80,0x0C,0x43,0x30,0x0C,0x48,0x84,0x80,0xD0,0xB0,0x38,0x00,0x85,0x80,0x50,0x03,0x08,0x85,0x8B,0x80,0x0E,0x43,0xF8,0x80,0x22,0x0B,
+0x83,0x80,0x3C,0x00,0x08,0x08,0x08,0x17,0xD8,0x80,0x80,0x58,0xCB,0x70,0xA9,0x80,0x80,0x83,0xCB,0x3B,0x00,0x08,0x68,0xC0,0x3B,0xD0,0x33,0xC0,0x30,0xDB,0x80,0x80,
+0x0C,0xC8,0x08,0x58,0xB8,0x0C,0x03,0x08,0x08,0x0F,0x08,0x08,0x0D,0xB8,0x3D,0x80,0xD0,0xB0,0x83,0x50,0xB8,0x08,0x80,0xF0,0x80,0x30,0x00,0x08,0x86,0x80,0x0D,0x08,
+0x58,0x08,0x08,0x80,0x0E,0x08,0x08,0x68,0x08,0xC8,0x8B,0x80,0x50,0x8B,0x85,0xC0,0x80,0x80,0x80,0x80,0x80,0x00,0xF0,0x59,0x08,0x08,0x04,0xC8,0xB8,0x08,0xE8,0x0B,
+0xC3,0x08,0x58,0x48,0xB8,0x08,0xBD,0x00,0x08,0xBD,0x08,0x34,0x00,0xD8,0x3B,0x80,0xE0,0x03,0x03,0x80,0x80,0x0F,0x0C,0x48,0x8B,0x3B,0x00,0x08,0x08,0x78,0x81,0x80,
+0x36,0xC0,0x80,0x80,0x58,0x80,0x80,0x0D,0x08,0x04,0x04,0x3C,0x80,0x50,0x8B,0x80,0x08,0x45,0x08,0x08,0x85,0x80,0x0C,0x03,0x0D,0x08,0x3D,0xB8,0x0C,0x43,0x08,0x3C,
+0x34,0x08,0xC8,0x03,0x0D,0x33,0xC0,0x0C,0x03,0x53,0x0B,0x0C,0x03,0xC8,0x03,0x08,0x08,0x08,0x08,0x17,0xD8,0x80,0x40,0x80,0xD0,0x80,0x84,0xC0,0x43,0x08,0xC8,0x43,
+0x80,0x8B,0x80,0xE0,0x8B,0x8B,0x50,0x08,0x0D,0x08,0x08,0x0D,0x0C,0x80,0x84,0xC0,0x3B,0xB4,0x48,0xB8,0x03,0xD8,0x30,0x80,0xB5,0x0C,0xC8,0xB0,0x0C,0x43,0x8B,0x3C,
+0x40,0x08,0xC8,0x0C,0x30,0x84,0xCB,0x43,0x08,0x0C,0x08,0x58,0x08,0x08,0x34,0x00,0x04,0xD8,0x0B,0x48,0x80,0xD0,0x80,0x80,0x0D,0x08,0x0D,0x48,0xB8,0x08,0x04,0xBC,
+0x03,0x58,0x03,0x3C,0x80,0x85,0x80,0x4B,0x03,0x80,0x80,0x06,0x08,0x0D,0x08,0x88,0x80,0x80,0x90,0xA7,0x04,0x0C,0x08,0x88,0x80,0x06,0xC3,0xB3,0x58,0xB8,0xC8,0x30,
+0x80,0x05,0x08,0x08,0x08,0xF8,0x08,0x08,0x68,0x3B,0x84,0x80,0x04,0x08,0x80,0xF0,0x80,0x84,0xB3,0x58,0x0B,0x08,0x84,0x80,0x80,0xB6,0x0C,0x08,0x08,0x80,0x80,0x80,
+0x17,0x0D,0x08,0x0C,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x70,0x41,0x03,0x80,0x80,0x80,0xF0,0x09,0xD8,0x03,0x40,0x80,0x50,0x08,0x58,0xB8,0x08,0x80,0x80,0x80,
+0x70,0x81,0x80,0x80,0x80,0x9F,0x00,0x8D,0x8B,0x80,0x80,0x70,0x03,0x80,0x05,0x0C,0xC8,0x00,0x08,0xB4,0x58,0x48,0x08,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0x9F,
+0x00,0x08,0x0F,0x08,0x08,0xD0,0x03,0x08,0x08,0x08,0x07,0x3C,0x84,0x80,0x80,0xD8,0x80,0x8C,0x8B,0x50,0xB8,0x04,0x0C,0x08,0x0D,0x08,0xC8,0x08,0x04,0x08,0x08,0x08,
+0x8F,0xC0,0x30,0x40,0xC0,0x30,0x80,0x0D,0x0C,0x48,0xB8,0x48,0x03,0x0C,0xC8,0xF0,0x19,0x80,0x32,0x38,0x84,0x80,0x80,0x0D,0xAC,0xCB,0x0B,0x08,0x34,0x74,0x83,0x21,
+0x80,0xBA,0xBF,0xDB,0x9A,0xB9,0x28,0x80,0x80,0xC0,0x0E,0xBA,0xDA,0xAB,0x20,0x52,0x54,0x45,0x43,0x34,0x33,0x43,0x21,0x11,0x99,0xAC,0xCD,0xBC,0xBC,0xBC,0xBB,0xBB,
+0xAC,0xAA,0x99,0x08,0x11,0x43,0x44,0x53,0x43,0x33,0x53,0x32,0x33,0x53,0x22,0x32,0x31,0x21,0x00,0x98,0xA9,0xFB,0xBA,0xAC,0xCC,0xAB,0xBC,0xCB,0xAA,0xBC,0xBA,0xBA,
+0xAC,0x9C,0xA9,0xA9,0xB9,0x99,0x89,0x0A,0x3B,0x08,0x48,0x24,0x43,0x56,0x32,0x43,0x42,0x33,0x34,0x42,0x34,0x21,0x33,0x33,0x32,0x52,0x41,0x31,0x23,0x52,0x21,0x28,
+0x08,0x83,0x80,0x04,0xC8,0x80,0xD0,0x80,0x0C,0x8B,0xCC,0x8A,0xCB,0xCB,0xAD,0xBC,0xAC,0xEB,0xA9,0x9A,0xAD,0xBB,0xBB,0xAD,0xBA,0xC9,0x99,0x9A,0xBA,0xBA,0xBB,0x08,
+0xD8,0x80,0x40,0x80,0x80,0x60,0x48,0x48,0x32,0x40,0x33,0x04,0x48,0x08,0x48,0x24,0x43,0x33,0x03,0x37,0x22,0x38,0x33,0x34,0x24,0x43,0x83,0x24,0x30,0x34,0x30,0x35,
+0x83,0x40,0x80,0x80,0x80,0x06,0x08,0x44,0x08,0x08,0x80,0x60,0x48,0x08,0x03,0x80,0x80,0x80,0x00,0x00,0x00,0x9F,0x00,0xCD,0x00,0x0C,0x8B,0x0C,0xCB,0x80,0xD0,0xBB,
+0xCB,0xC0,0xBB,0x8B,0xBC,0x08,0xBD,0xAC,0xCB,0x0E,0x0A,0xAA,0xB8,0x00,0xBC,0xAC,0xB8,0xC8,0x08,0x58,0x08,0x03,0x80,0x80,0x0F,0x08,0x88,0x80,0x70,0x08,0x58,0x08,
+0xB3,0x58,0x08,0x0C,0x0C,0xF0,0x98,0xA8,0x80,0x80,0x80,0x44,0x38,0x24,0x17,0x41,0x33,0x41,0x33,0x34,0x23,0x52,0x33,0x14,0x14,0x21,0x21,0x20,0x30,0xC0,0x30,0x8B,
+0x0D,0xB8,0xBF,0xB0,0x9D,0xAA,0xB0,0xBB,0x0C,0xCB,0xB0,0xAC,0xB8,0x08,0x08,0x08,0x08,0xF9,0x09,0x80,0x3E,0x00,0x48,0x40,0x03,0x40,0x80,0x85,0x80,0x85,0x43,0x38,
+0xC0,0x30,0x00,0x58,0x80,0x80,0x50,0x80,0xD0,0x08,0x08,0x8D,0x80,0x80,0x80,0x0F,0xBC,0xB0,0xC8,0x08,0x0D,0x8B,0x0C,0xCB,0xCB,0xB0,0xAC,0x8B,0x0C,0xAC,0xCB,0xBB,
+0xCB,0x8B,0x8B,0x80,0x80,0xBF,0xB8,0x08,0xE8,0x80,0x80,0x85,0x30,0x00,0x08,0x78,0x80,0x40,0x08,0x04,0x48,0x80,0x00,0x68,0x48,0x08,0x03,0x84,0x34,0x30,0x04,0x53,
+0x38,0x40,0x83,0x84,0x80,0x35,0x08,0x48,0x80,0x50,0x33,0x40,0x80,0x50,0x08,0x03,0x50,0x48,0x33,0x04,0x48,0x08,0x48,0x80,0x00,0x68,0x08,0x08,0x80,0x80,0x80,0x00,
+0x17,0x08,0x08,0x0F,0x08,0xC8,0x80,0x40,0x80,0xD0,0xB8,0x08,0x8D,0x80,0x0D,0x08,0x08,0x8D,0xD0,0x80,0x8B,0x0C,0x08,0x0D,0xC8,0xBB,0x08,0x80,0x0E,0xB8,0x08,0xE8,
+0xC0,0x00,0x0C,0x08,0x08,0x80,0x0E,0x08,0x0D,0x08,0xBC,0x80,0x80,0x50,0x8B,0x80,0x80,0x70,0x80,0x8C,0x80,0x80,0x86,0xC0,0x80,0x84,0x80,0x00,0x85,0x80,0x80,0xB6,
+0x08,0xD8,0x80,0x84,0x80,0x80,0xE0,0x80,0x80,0xD8,0x30,0x80,0x50,0x8B,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x9F,0x0C,0x48,0x30,0xD0,0x30,0x80,0xBD,0x80,0x80,
+0x80,0x70,0x08,0x08,0x80,0x80,0x0F,0x48,0x08,0x03,0x08,0x08,0x08,0x09,0x00,0x70,0x41,0x80,0x04,0x08,0x80,0xF0,0x03,0x08,0x88,0x80,0x80,0x70,0x81,0x0D,0x08,0x84,
+0x80,0x80,0x60,0x08,0x0D,0x08,0x58,0x0B,0x08,0x48,0x8B,0x85,0x80,0x3C,0x00,0x08,0x08,0x08,0x09,0x00,0x00,0xF0,0x09,0x80,0x60,0x3C,0x30,0x80,0x80,0x80,0x07,0xC8,
+0x00,0x08,0x08,0x08,0x08,0x09,0x17,0xD8,0x80,0x80,0x80,0x80,0x0F,0x48,0x08,0x08,0x0D,0xC8,0x00,0x48,0x8B,0x85,0x0B,0x08,0x0D,0x08,0x3D,0xB8,0x08,0x50,0x08,0x08,
+0x08,0x08,0x8F,0x80,0x04,0x0D,0x08,0x08,0x80,0x3E,0xC0,0x03,0x80,0x80,0x80,0x80,0x9F,0x00,0x08,0xF8,0x30,0x80,0xD8,0x80,0x80,0xE0,0x80,0x80,0x04,0x08,0x08,0x08,
+0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x85,0x8B,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0xDF,0x80,0x30,0x80,0x80,0x80,0x07,0x08,0x88,0x80,0xF0,
+0x08,0x08,0x50,0xB8,0x58,0x08,0x08,0x0D,0x03,0x0D,0x08,0x08,0xD0,0x03,0x08,0x08,0x08,0x08,0x00,0x9F,0x50,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x9F,0x00,
+0x08,0x08,0x78,0xD1,0x03,0x08,0x0D,0x08,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x17,0x08,0x68,0x08,0x08,0x80,0x86,0x80,0x00,0x08,0x08,0x08,0x00,0x70,0x81,0x80,
+0x80,0x80,0x00,0x9F,0x50,0x8B,0x84,0x80,0x40,0x80,0x80,0xF0,0x80,0x30,0x0C,0x08,0x08,0x08,0x87,0x80,0x00,0x08,0xC6,0x00,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x85,0x80,0x80,0x80,0x80,0x80,0x17,0x0D,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0xF0,0x59,0x08,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x2F,0x00,0x85,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x70,0x80,0x80,0x80,0x80,0x8F,
+0x84,0xC0,0x80,0x80,0x85,0x80,0x00,0x08,0x08,0x08,0x70,0x81,0x80,0x80,0x80,0x17,0xD8,0x80,0x80,0xD0,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x70,
+0xD1,0x80,0x80,0xB5,0x80,0x80,0x08,0x08,0x78,0x80,0x00,0x68,0x8B,0x40,0x08,0x08,0x08,0xF8,0x80,0x80,0x08,0x08,0x08,0x79,0x81,0x80,0xF0,0x80,0x80,0x00,0x68,0x08,
+0x08,0x80,0x80,0x80,0x9F,0x00,0x08,0x78,0xC0,0x80,0x80,0x50,0x08,0x08,0x80,0x80,0xF0,0x08,0xD8,0x80,0x80,0x08,0x0E,0x08,0x88,0x80,0x80,0x07,0x08,0x80,0x80,0x80,
+0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x17,0x0D,0x08,0x08,0x80,0xF0,0x80,0x80,0x50,0x08,0x08,0x80,0x80,0x70,0x8B,0x80,0x80,
+0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x02,0x80,0x80,0x80,
+0x00,0x00,0x9F,0x00,0x8D,0x80,0xB5,0x08,0x84,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x0E,0x48,0x08,0xC3,0x80,0x80,0x80,0x80,0x8F,0x80,0x80,0x60,0x08,0x08,0x08,0xF8,0x03,0x08,0xD0,
+0x08,0x08,0x08,0x86,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x8A,0x85,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x9F,0x50,0xB8,0x08,
+0x50,0xB8,0x08,0x08,0x86,0xD0,0x80,0x80,0x00,0x08,0x0F,0x08,0x08,0x85,0x8B,0x50,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x17,0x08,0x08,0x08,0x08,0x9F,0x00,0x68,0x08,0x08,0x0D,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x17,0x3D,0x80,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,
+0x70,0x81,0x80,0x80,0x80,0x00,0x00,0xA7,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x17,0x0D,0x08,0x08,0x85,0x80,0x00,0xE8,0x80,0x80,0x50,0x08,0x08,0x08,0xF8,0x80,0x80,
+0x04,0x0D,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0xB5,0x08,0xD8,0x80,0x80,0x58,0x80,0x80,0x80,0x80,0x90,0x70,0x81,
+0x80,0xF0,0x80,0x80,0x50,0x08,0x08,0x0D,0x08,0x08,0x68,0x08,0xC8,0x80,0x8C,0x80,0x80,0x80,0x80,0x9F,0x00,0x08,0x86,0x80,0x80,0x80,0x0F,0x08,0x48,0x80,0x80,0x80,
+0xBF,0x48,0x08,0x08,0x80,0xF0,0x80,0x80,0x85,0x03,0x80,0x08,0x0E,0x08,0x48,0x80,0x80,0x80,0x0F,0x08,0x84,0x84,0x8B,0x00,0xE8,0x30,0x80,0x80,0x80,0x80,0xF0,0x59,
+0x08,0x03,0x08,0x8D,0x80,0x80,0x60,0x48,0x08,0x0C,0x0C,0x80,0x84,0x80,0x80,0xE0,0x80,0x80,0x58,0x80,0x80,0xE0,0x80,0x80,0x58,0x80,0x80,0x80,0x80,0x90,0x00,0x00,
+0x00,0x9F,0x00,0x08,0x08,0x07,0x08,0x0D,0x08,0x88,0x80,0x06,0xC8,0x08,0x0D,0x48,0x08,0x08,0x84,0x8B,0x80,0x80,0x07,0x08,0x88,0x80,0x80,0x90,0x17,0x08,0xE8,0xC0,
+0x30,0x80,0x85,0x80,0x8B,0x85,0x80,0x00,0x08,0x08,0x08,0x9F,0x50,0x08,0x08,0x80,0x0E,0x08,0x08,0x68,0xB8,0x08,0xD0,0x08,0x58,0x08,0x08,0x80,0x80,0x80,0x00,0x17,
+0x08,0xE8,0x80,0x80,0x80,0x60,0xB8,0x08,0xE8,0x80,0x84,0x30,0xD0,0x80,0xD0,0x03,0x08,0x88,0x80,0x80,0x8F,0x80,0x85,0x80,0x00,0xE8,0x80,0x80,0x50,0x08,0x0D,0x8B,
+0x80,0x04,0x08,0x85,0x8B,0x80,0x80,0x70,0x80,0x80,0x80,0x0E,0x08,0x58,0x80,0x80,0x0D,0x08,0x08,0x68,0x80,0x80,0x80,0x0E,0x08,0x58,0xC0,0x80,0x80,0x08,0x08,0x78,
+0x80,0x0C,0x08,0x08,0x08,0x08,0x09,0x00,0xF0,0x02,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x70,0x81,0x0D,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x0D,0x08,0x08,0x08,0x08,0x08,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x0D,0x08,0x08,0x50,0x08,0x08,0x8D,0x40,0x80,0x80,0x80,0x80,0x70,0x81,0x08,0x08,0x87,0xC0,0x03,0xD0,0x30,0x0C,0x03,0x08,0x80,
+0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x9F,0x00,0x08,
+0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x85,0x80,0x80,0x50,0x08,0x08,0x08,0x08,0x08,
+0x00,0x17,0x08,0x08,0x78,0x80,0x80,0x08,0x08,0x08,0x79,0x81,0x80,0x80,0x07,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0xF0,0x09,0x80,
+0x80,0x80,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x9F,0x00,0x08,0x08,0xF8,0x09,0x80,0x80,0x80,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x70,0x81,
+0x80,0x80,0x80,0x00,0x00,0xF0,0x09,0x85,0x80,0x00,0x08,0x08,0x78,0x81,0x80,0x80,0x80,0x00,0x17,0x08,0x85,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x70,0x81,0x80,0x60,
+0x08,0x08,0x08,0x08,0x08,0x17,0x08,0x68,0x08,0x08,0x80,0x0E,0x08,0x08,0x85,0x80,0x80,0x80,0x80,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x17,0x08,0x08,
+0x08,0xF8,0x09,0x80,0x0E,0x08,0x08,0x08,0x08,0x08,0xF0,0x02,0x0D,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x9F,0x00,0x08,0x0F,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x9F,
+0x00,0x08,0x08,0x08,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x17,0x08,
+0x8D,0x80,0x85,0x80,0x00,0x08,0x08,0x08,0x00,0x17,0x08,0x08,0x0F,0x03,0x48,0xC0,0x80,0x80,0x80,0x80,0x07,0x08,0x0D,0x08,0x08,0x08,0x05,0x08,0x8D,0x80,0x80,0x86,
+0x80,0x00,0x8D,0x80,0x80,0x86,0x80,0x00,0x08,0x0F,0x08,0x08,0x80,0x80,0xF0,0x08,0x48,0x80,0x80,0x80,0xF0,0x08,0x48,0x80,0x85,0x80,0x0C,0x08,0x08,0x08,0x08,0x09,
+0x00,0x9F,0x00,0x08,0x86,0x80,0xD0,0x08,0x0D,0x48,0x08,0x08,0xD8,0x80,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0x00,0x08,0xF8,
+0x80,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x9F,0x85,0x0B,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,
+0x08,0xF8,0x02,0x80,0x80,0x80,0x9F,0x00,0x85,0x8B,0x85,0x80,0x00,0x08,0x08,0x07,0x08,0x08,0xE8,0x80,0x40,0x80,0x80,0x80,0xF0,0x48,0x08,0x08,0x08,0x08,0x08,0x09,
+0x70,0x81,0x80,0xF0,0x03,0x08,0x48,0x80,0x0D,0x08,0x08,0x08,0x86,0x80,0x80,0x80,0x80,0x00,0x70,0x81,0xD0,0x08,0x08,0x68,0x08,0xC8,0x80,0x80,0x80,0x06,0x08,0x08,
+0xE8,0x80,0x40,0x80,0x80,0xF0,0x80,0x80,0x00,0x68,0x8B,0x80,0x08,0x08,0x08,0x17,0xD8,0x80,0x80,0x58,0x80,0x80,0xE0,0x80,0x80,0x08,0x08,0x08,0xF9,0x09,0x80,0x60,
+0x08,0x08,0x8D,0x80,0x80,0x60,0x08,0x08,0x8D,0x8B,0x80,0x60,0x08,0x08,0xE8,0x80,0x80,0x50,0x08,0x08,0x8D,0x80,0x0D,0x08,0x04,0x08,0xD8,0x80,0x8C,0x84,0x80,0x00,
+0xE8,0x80,0x80,0x50,0x08,0x08,0xE8,0x80,0x80,0x50,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x59,0x08,0x08,0x58,0xB8,0x08,0x80,0x80,0x80,0x00,
+0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0xF0,0x09,0x80,0x86,0x80,0x00,0x08,0x08,0x08,0x70,0xD1,0x30,0x80,0x80,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x9F,
+0x50,0x08,0x08,0x80,0x80,0x80,0x00,0x17,0x08,0xE8,0x80,0x80,0x80,0x60,0x08,0x08,0x08,0xF8,0x80,0x84,0x80,0x80,0x80,0x80,0x90,0x00,0x00,0xF0,0x09,0x0D,0x08,0x04,
+0x08,0xD8,0x80,0x80,0x80,0x06,0x08,0x08,0x08,0xF8,0x48,0x08,0x58,0x08,0x0C,0x80,0x80,0x04,0x08,0xE8,0x80,0x80,0x80,0x86,0x80,0x0C,0x08,0x0D,0x48,0x08,0x03,0x08,
+0x0E,0x0C,0x03,0x08,0x04,0xD8,0x80,0x80,0x80,0x60,0x08,0x08,0x8D,0x80,0x80,0x80,0x80,0x00,0xF0,0x59,0x08,0xB3,0x08,0x08,0x08,0x08,0x00,0x17,0x08,0x8D,0x80,0x80,
+0x60,0x08,0x0D,0x08,0x08,0x80,0x60,0x08,0x08,0xE8,0x80,0x80,0x85,0x84,0xC0,0x80,0x80,0x00,0x08,0x08,0x08,0x00,0xF0,0x09,0x50,0x08,0x04,0x0C,0x0C,0x08,0x08,0x80,
+0x86,0x8B,0x00,0x08,0x08,0x08,0x70,0x81,0x80,0x0E,0x08,0x08,0x68,0x08,0x08,0xD0,0x03,0x08,0x08,0x08,0x08,0xF0,0x09,0x85,0x80,0x00,0x85,0x8B,0x80,0x80,0x80,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x78,0x80,0x80,0x0D,0x08,0x88,0x3D,0x00,0x08,0x08,0x08,0x09,0x00,0x00,0x17,0x0D,0x08,
+0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x08,0x08,0x08,0x07,0x08,0x08,0xE8,0x30,0x80,0x80,0x80,0x90,0xF0,0x59,0x08,0x08,0x58,0x8B,
+0x40,0xAC,0x08,0x03,0xD8,0x03,0x80,0x0D,0x48,0xC0,0x43,0x0B,0x08,0x88,0xE0,0x30,0x80,0x08,0x08,0xF8,0xB8,0x04,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0x17,0xD8,0x80,
+0x80,0x80,0x60,0x0C,0x80,0x80,0x0D,0x48,0x38,0x0B,0x08,0xE8,0x80,0x40,0x84,0xC0,0x03,0xBC,0x80,0x35,0x8B,0x08,0x80,0xF0,0x30,0xC0,0x03,0xC3,0x80,0x80,0x80,0x80,
+0xB7,0x08,0x80,0x0E,0x48,0x08,0x08,0x0D,0x03,0x08,0x8D,0x84,0x80,0x00,0xE8,0x03,0x80,0x08,0x08,0x87,0x8B,0x00,0x08,0x08,0x07,0x08,0x0D,0x08,0xC4,0x00,0x03,0x88,
+0xE0,0x80,0xD0,0x83,0x80,0x00,0x08,0xF8,0x80,0x40,0x08,0x08,0x08,0x08,0x8F,0x80,0x04,0x08,0x08,0xF8,0x80,0x80,0x08,0x05,0x08,0x8D,0x80,0x80,0x80,0x80,0x00,0x70,
+0x81,0x80,0xF0,0x80,0x30,0xD0,0x30,0x80,0xD0,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x8A,0x80,0x80,
+0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x59,0x08,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,
+0xD1,0x80,0xB4,0x08,0x08,0x80,0x80,0x07,0x0C,0x48,0x08,0x08,0x88,0x80,0x0E,0x48,0x8B,0x50,0x08,0x08,0x80,0x0E,0x08,0x08,0x08,0x86,0x80,0x0D,0x08,0x08,0x08,0x86,
+0x80,0xD0,0x08,0x08,0x85,0x80,0x80,0x80,0x0F,0x08,0x88,0x50,0x80,0xD0,0x08,0x08,0x68,0x08,0x08,0x80,0x80,0x0F,0x03,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,
+0x9F,0x85,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x85,0x80,0x80,0x80,0x80,0x80,0x00,0x17,0xD8,0x80,0xB4,0xC8,0x00,0x08,0xB4,0x08,0x08,0x86,
+0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x02,0x80,0x80,0x80,0x9F,0x00,0x68,0x08,0x08,0x80,0x80,0x3F,0x80,0x00,0x08,0x08,0x08,0x9F,0x50,0x08,0x08,
+0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x3F,0x80,0x08,
+0x08,0x08,0x09,0x00,0x9F,0x00,0x08,0x08,0x08,0x70,0x81,0x80,0xF0,0x80,0x84,0x3B,0x80,0x80,0x80,0x80,0x00,0x9F,0x00,0x85,0x80,0xD0,0x48,0x08,0x08,0x80,0x80,0x80,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x86,0x80,0x00,0x08,0x0F,0x08,0x08,0x85,0x80,0x0C,0x08,0x08,0x68,0x80,0x80,0x80,0x0E,0x03,0x08,0x08,0x08,0x9F,0x80,0x80,0x80,
+0x70,0x0B,0x00,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x02,0x80,0x80,0x80,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x02,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,
+0x17,0x08,0x08,0xF8,0x80,0x80,0x04,0x0D,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x0F,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,
+0x08,0xE8,0x80,0x80,0x50,0x08,0x08,0xE8,0x80,0x80,0x80,0x86,0x80,0x0C,0x08,0x08,0x05,0x08,0x08,0x08,0x8F,0x80,0x04,0x08,0x08,0x08,0xF8,0x59,0x08,0x08,0x08,0x08,
+0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xD1,0x80,0x80,0x00,0x85,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,
+0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x58,0x08,0x08,
+0x80,0xF0,0x03,0x08,0x88,0x0D,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x85,0x80,0x80,0x80,0x80,0x80,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x59,0x08,0xB8,0x08,0x08,0x86,0xD0,0xB3,0x08,0xB4,0x08,0x08,0x08,0x08,0x79,0xD1,0x80,
+0x30,0x0C,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0x17,0x08,0x8D,0x80,0x85,0x80,0x00,0xE8,0x80,0x80,0x80,0x80,0x70,0xC0,0x30,0x0C,0x80,0x80,0x80,0x80,0x07,0x0C,0x08,
+0x08,0x08,0x08,0xB7,0x08,0x08,0x08,0x78,0x8B,0x00,0x08,0x08,0x08,0x00,0x00,0x70,0x81,0x0D,0x08,0x04,0x08,0x08,0x0E,0x08,0x48,0x80,0x80,0x80,0x80,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x02,0x80,
+0x80,0x80,0x00,0x9F,0x85,0x80,0x80,0x80,0x0E,0x08,0x08,0x08,0x08,0x08,0x17,0x08,0xE8,0x80,0x40,0x80,0x80,0x0D,0x03,0x0D,0x08,0x84,0x80,0x80,0xF0,0x80,0x84,0x80,
+0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x70,0xD1,0x80,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x17,0x0D,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0xA7,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xD1,0x80,0x80,
+0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x60,0x08,0xD8,0x80,0x80,0x80,0x80,0x80,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,
+0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x85,0x80,
+0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x0D,0x48,0x08,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0xF0,0x59,0xB8,0x80,0x80,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0xD0,0x08,0x04,0x08,0x08,0x08,
+0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,
+0x00,0x00,0xF0,0x02,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xD1,0x80,
+0x84,0x80,0x80,0x08,0x08,0x3F,0x80,0x80,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x60,0x0C,0x80,0x80,0x08,
+0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x9F,0xB5,0x80,0x80,0x08,0x08,0x08,0x09,0x70,0xD1,0x80,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xD1,0x80,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x9F,0x00,0x08,0x78,0x80,
+0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x9F,0x85,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const ADPCM_Sound_t asteroid_impact = {asteroid_impact_data,127968,{0,0},6176};
@@ -1 +1,156 @@
-const uint16_t asteroid_large_explode[] = {2080,2080,2192,2464,2704,2944,3152,3360,3552,3728,3744,3680,3632,3584,3536,3488,3456,3392,3200,2976,2768,2560,2352,2160,2016,2080,2176,2256,2352,2448,2528,2608,2688,2768,2816,2864,2864,2784,2720,2640,2560,2480,2400,2304,2208,2128,2032,1952,1872,1776,1696,1632,1552,1488,1424,1360,1312,1248,1200,1152,1120,1072,1040,1008,976,944,928,912,896,880,864,848,848,832,832,832,832,832,848,848,864,848,848,848,752,496,288,144,32,0,16,48,96,128,176,224,272,304,352,384,432,480,528,576,624,672,704,752,800,832,1024,1344,1632,1920,2080,2048,2016,1904,1776,1760,1680,1664,1712,1680,1632,1680,1920,2160,2400,2624,2864,3072,3280,3472,3648,3824,3952,3888,3744,3616,3456,3296,3136,2960,2800,2656,2512,2384,2480,2640,2784,2944,3104,3264,3328,3408,3552,3680,3792,3872,3920,3952,3984,4016,4032,4000,3968,3936,3904,3872,3840,3808,3776,3712,3664,3616,3568,3520,3488,3440,3392,3360,3312,3040,2672,2320,1984,1680,1376,1104,864,640,432,256,112,32,0,0,0,0,0,0,0,0,0,0,32,80,96,160,224,288,368,480,592,704,832,944,1072,1200,1328,1440,1568,1680,1792,1904,2016,2144,2272,2400,2512,2624,2688,2768,2832,2880,2944,2992,3056,3104,3152,3184,3232,3280,3312,3344,3376,3408,3424,3456,3472,3488,3504,3520,3520,3536,3536,3536,3536,3536,3520,3520,3504,3504,3472,3472,3456,3456,3440,3424,3408,3472,3456,3408,3360,3328,3280,3248,3200,3168,3136,3104,3072,3024,2992,2960,2944,2912,2880,2848,2816,2800,2784,2704,2496,2304,2128,1952,1792,1648,1520,1392,1280,1184,1120,1264,1456,1632,1808,1968,2144,2288,2432,2560,2672,2752,2656,2464,2256,2064,1904,1712,1536,1360,1184,1008,832,800,928,1024,1136,1248,1360,1472,1584,1696,1776,1872,1856,1648,1440,1248,1040,848,656,480,320,176,64,16,0,0,0,0,0,0,0,0,0,0,0,0,16,64,112,128,176,224,272,304,352,384,448,736,1072,1408,1728,2032,2320,2576,2832,3040,3264,3296,3184,3088,2960,2832,2704,2560,2432,2304,2176,2048,2032,2192,2336,2496,2640,2784,2928,3056,3184,3296,3392,3440,3248,3040,2832,2624,2432,2256,2096,1936,1776,1616,1456,1312,1184,1056,944,864,784,720,672,640,608,608,608,624,640,672,704,736,784,832,896,960,1008,1200,1536,1840,2144,2432,2704,2976,3216,3456,3648,3840,3968,4032,4080,4080,4080,4080,4080,4080,4080,4080,4080,4064,4032,4000,3968,3936,3904,3872,3840,3808,3776,3728,3664,3616,3568,3536,3408,3248,3104,2960,2816,2672,2544,2400,2256,1888,1504,1152,800,480,176,0,0,0,0,0,0,0,0,0,0,64,192,352,544,736,912,1072,1216,1344,1456,1552,1632,1696,1760,1808,1840,1888,1920,1952,1968,1984,2000,2016,2016,2016,2032,2032,2016,2016,2016,2016,2000,2000,1984,1984,1968,1968,1952,1952,1936,1936,1920,1936,1936,1936,1936,1920,1936,1920,1936,1792,1504,1248,992,752,592,608,656,704,736,784,832,864,912,944,976,1024,1056,1088,1120,1152,1184,1216,1248,1264,1296,1328,1360,1376,1408,1424,1456,1472,1504,1520,1536,1568,1584,1616,1712,1856,2000,2160,2320,2480,2800,3216,3568,3888,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4032,3936,3872,3776,3648,3536,3424,3328,3248,3168,3088,3024,2992,3152,3344,3504,3680,3792,3744,3696,3632,3584,3536,3504,3456,3408,3360,3328,3280,3248,3216,3168,3136,3104,3072,3040,3008,2976,2944,2912,2880,2848,2832,2800,2768,2752,2720,2704,2656,2320,1952,1600,1264,960,672,400,160,16,64,128,208,288,400,496,608,720,816,928,1024,1120,1216,1312,1408,1488,1552,1600,1632,1664,1680,1680,1680,1680,1664,1664,1648,1632,1616,1584,1568,1552,1520,1488,1472,1440,1408,1392,1360,1328,1296,1280,1248,1232,1088,784,496,240,80,0,0,16,64,96,128,192,240,272,320,352,400,448,496,544,592,640,752,944,1120,1296,1456,1616,1760,1888,2016,2128,2224,2304,2176,1984,1792,1616,1440,1264,1120,1024,1024,1072,1104,1136,1168,1200,1248,1392,1584,1792,1968,2160,2336,2512,2560,2432,2336,2224,2144,2064,1984,1888,1792,1712,1616,1552,1488,1456,1456,1456,1488,1504,1520,1552,1568,1584,1616,1632,1648,1680,1728,1776,1840,1936,2016,2080,2176,2256,2336,2432,2512,2592,2672,2752,2832,2912,2992,3072,3136,3344,3664,3920,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4064,4032,4016,3984,3936,3904,3856,3584,3264,2976,2720,2480,2464,2496,2512,2560,2592,2640,2688,2736,2784,2832,2864,2688,2448,2224,2000,1792,1584,1392,1232,1088,944,800,672,544,416,320,224,160,128,96,80,80,80,96,112,144,176,208,256,288,336,400,448,512,624,928,1232,1536,1824,2096,2368,2608,2832,3056,3248,3408,3344,3248,3152,3024,2912,2784,2656,2528,2400,2304,2192,2256,2416,2544,2688,2816,2944,3072,3184,3280,3376,3456,3392,3184,3008,2800,2608,2416,2240,2064,1888,1728,1584,1456,1328,1216,1120,1040,976,912,864,832,800,784,768,784,784,800,816,848,880,912,960,1040,1120,1184,1248,1296,1344,1376,1424,1472,1504,1552,1600,1664,1696,1920,2224,2480,2736,2992,3216,3456,3648,3824,3936,4016,4000,3920,3824,3664,3504,3344,3184,3008,2848,2704,2544,2496,2608,2704,2816,2928,3040,3136,3232,3328,3392,3456,3472,3280,3072,2848,2656,2448,2240,2048,1856,1696,1536,1376,1248,1120,1008,912,832,752,704,656,608,592,576,736,976,1216,1440,1664,1888,2096,2288,2464,2640,2784,2928,3056,3152,3248,3312,3376,3424,3440,3456,3472,3472,3472,3472,3472,3440,3392,3328,3248,3168,3088,2992,2896,2768,2416,2064,1712,1392,1088,784,512,256,64,0,0,0,0,0,16,48,80,144,176,224,272,304,352,416,464,512,560,608,640,688,736,768,816,848,896,928,960,992,1040,1072,1104,1136,1168,1184,1216,1248,1328,1440,1552,1680,1808,1920,2032,2128,2240,2336,2432,2512,2608,2688,2752,2832,2896,2960,3024,3072,3120,3168,3216,3248,3280,3312,3344,3376,3392,3408,3424,3424,3600,3840,3984,4080,4080,4080,4080,4080,4080,4080,4080,4080,4048,4016,3984,3968,3920,3888,3792,3584,3376,3168,3040,3104,3152,3200,3264,3312,3376,3424,3456,3424,3376,3328,3296,3248,3216,3168,3136,3104,3072,3024,2992,2960,2928,2896,2880,2848,2816,2784,2768,2704,2592,2512,2400,2304,2192,2096,1984,1888,1792,1696,1600,1504,1424,1328,1248,1040,672,352,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,64,96,160,192,240,272,320,352,416,464,512,544,592,640,672,832,1152,1456,1760,2032,2288,2384,2352,2352,2320,2288,2240,2192,2144,2112,2064,2032,2000,1968,1952,1920,1920,1904,1904,1904,1920,1936,1968,2064,2320,2544,2784,3008,3232,3440,3632,3808,3920,3984,4032,3984,3920,3856,3744,3600,3456,3312,3168,3040,2912,2800,2864,2976,3088,3200,3296,3408,3488,3584,3664,3728,3776,3792,3808,3776,3744,3680,3632,3584,3536,3488,3440,3408,3360,3312,3088,2800,2512,2240,2000,1776,1568,1376,1184,1040,1088,1136,1200,1264,1344,1440,1504,1600,1680,1760,1792,1664,1488,1328,1184,1040,896,752,640,512,416,352,448,608,768,928,1104,1264,1424,1568,1712,1856,1984,2112,2224,2336,2432,2512,2576,2640,2704,2752,2768,2800,2720,2480,2256,2032,1824,1616,1408,1232,1056,896,752,624,512,432,352,288,256,224,224,224,224,256,288,496,752,1008,1264,1520,1744,1984,2192,2400,2592,2768,2944,3088,3216,3328,3424,3504,3568,3632,3680,3744,3776,3808,3808,3792,3760,3712,3664,3616,3552,3488,3408,3344,3168,2848,2544,2240,1952,1680,1424,1184,976,768,592,432,288,176,112,64,48,16,16,48,80,128,176,224,256,304,352,400,448,496,544,592,656,736,832,944,1040,1152,1264,1376,1488,1584,1696,1808,1888,2128,2448,2736,3024,3296,3536,3776,3952,4048,4080,4080,4080,4080,4080,4048,3968,3904,3824,3680,3536,3408,3264,3184,3280,3376,3472,3568,3648,3728,3792,3824,3824,3792,3760,3696,3648,3520,3296,3072,2864,2656,2432,2256,2064,1888,1904,1984,2064,2144,2224,2304,2400,2464,2544,2608,2672,2608,2400,2224,2048,1872,1696,1536,1376,1216,1088,960,928,1056,1168,1296,1424,1568,1696,1824,1936,2048,2160,2256,2336,2416,2480,2528,2576,2608,2640,2656,2672,2672,2640,2416,2176,1920,1680,1456,1232,1024,832,656,496,336,208,128,64,16,0,0,0,0,0,0,0,32,192,432,688,928,1184,1408,1632,1856,2048,2224,2400,2560,2720,2864,2992,3104,3184,3248,3296,3312,3328,3328,3328,3312,3296,3264,3232,3200,3152,3104,3056,3008,2928,2672,2368,2080,1808,1536,1280,1056,832,640,464,304,320,432,544,672,800,928,1072,1216,1360,1504,1632,1744,1872,1968,2064,2160,2240,2320,2384,2448,2496,2528,2560,2592,2608,2624,2640,2640,2640,2624,2624,2608,2592,2576,2544,2528,2496,2464,2432,2400,2368,2336,2304,2256,2208,1968,1680,1424,1168,928,704,496,320,192,112,112,160,192,240,288,320,368,416,480,528,576,608,656,704,752,784,864,1088,1376,1648,1904,2144,2368,2592,2784,2960,3120,3280,3424,3536,3632,3728,3792,3856,3888,3904,3920,3920,3936,3920,3920,3904,3888,3872,3856,3840,3600,3296,3024,2752,2496,2256,2016,1808,1600,1424,1248,1264,1360,1472,1584,1696,1824,1952,2064,2192,2304,2416,2400,2256,2112,1984,1856,1728,1600,1488,1392,1296,1216,1152,1088,1040,1008,992,976,976,976,992,1024,1056,1120,1376,1632,1888,2128,2368,2608,2848,3072,3296,3472,3632,3568,3456,3328,3200,3072,2944,2816,2688,2576,2464,2368,2272,2176,2112,2032,1984,1936,1888,1856,1824,1808,1792,1888,2112,2320,2528,2720,2928,3104,3264,3424,3568,3696,3744,3616,3504,3360,3232,3088,2944,2800,2656,2528,2400,2288,2176,2080,1984,1904,1840,1760,1712,1664,1616,1584,1568,1728,1936,2128,2320,2496,2672,2832,2992,3120,3248,3360,3456,3440,3392,3344,3312,3264,3232,3184,3152,3120,3072,3040,3008,2976,2944,2912,2880,2864,2832,2800,2784,2752,2736,2656,2336,1984,1648,1328,1040,752,496,256,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,64,96,160,192,288,576,912,1216,1520,1792,2064,2320,2544,2768,2848,2784,2736,2656,2576,2496,2416,2336,2256,2176,2096,2032,1968,1904,1856,1808,1776,1744,1712,1696,1696,1680,1712,1904,2096,2288,2480,2672,2848,3008,3168,3312,3440,3536,3472,3360,3232,3104,2976,2848,2720,2592,2464,2352,2240,2288,2432,2544,2656,2752,2848,2912,2992,3040,3104,3136,3184,3216,3232,3248,3248,3248,3248,3232,3216,3184,3152,3056,2800,2560,2304,2064,1824,1616,1408,1200,1024,864,720,592,464,368,288,224,192,176,160,160,160,176,192,224,240,288,336,384,448,528,592,672,736,944,1232,1488,1760,2016,2256,2480,2688,2880,3072,3232,3376,3504,3616,3712,3792,3840,3872,3888,3888,3904,3904,3872,3696,3456,3232,3008,2768,2560,2352,2144,1968,1792,1632,1680,1760,1872,1952,2048,2144,2208,2272,2336,2368,2416,2464,2496,2528,2544,2576,2592,2608,2608,2608,2592,2576,2448,2192,1968,1744,1536,1344,1136,960,800,656,512,464,592,688,800,928,1056,1184,1312,1440,1568,1696,1760,1648,1552,1440,1328,1232,1136,1056,976,896,832,784,752,720,688,688,688,704,704,736,768,800,848,896,960,1024,1088,1152,1216,1296,1376,1456,1536,1600,1680,1760,1840,1920,2000,2080,2160,2224,2288,2368,2416,2560,2832,3056,3296,3536,3776,3936,4032,4080,4080,4080,4080,4080,4080,4080,4080,4080,4064,4032,4016,3968,3936,3904,3872,3840,3808,3776,3728,3680,3632,3584,3536,3488,3456,3408,3312,2976,2672,2368,2080,1808,1552,1328,1120,928,768,608,480,368,272,192,128,96,80,80,80,80,96,112,144,176,208,256,304,368,448,512,592,688,768,848,944,1024,1120,1200,1280,1376,1456,1552,1632,1712,1792,1872,1936,2016,2096,2144,2224,2288,2336,2544,2800,3024,3248,3456,3648,3840,3952,4032,4080,4080,4080,4064,4000,3904,3808,3648,3488,3312,3168,3008,2848,2784,2864,2928,2992,3056,3136,3184,3248,3296,3344,3376,3360,3184,2992,2800,2624,2432,2256,2080,1920,1760,1616,1488,1376,1280,1184,1104,1024,960,912,880,848,816,800,800,800,800,816,832,864,896,912,960,992,1024,1184,1440,1664,1888,2096,2304,2512,2688,2848,3008,3152,3200,3088,2992,2864,2752,2624,2512,2384,2272,2160,2048,1952,1856,1776,1696,1616,1552,1488,1440,1392,1392,1376,1392,1568,1760,1920,2080,2240,2384,2512,2640,2752,2864,2960,2896,2752,2624,2480,2352,2208,2080,1952,1824,1712,1600,1504,1424,1344,1264,1200,1152,1120,1072,1056,1040,1024,1024,1024,1024,1056,1088,1120,1152,1184,1216,1264,1312,1344,1392,1440,1488,1552,1600,1648,1696,1744,1792,1840,1888,1936,1984,2032,2064,2112,2160,2192,2224,2272,2304,2336,2368,2400,2416,2448,2480,2496,2528,2528,2560,2576,2576,2688,2912,3104,3280,3456,3632,3776,3872,3920,3968,3936,3904,3872,3840,3808,3680,3488,3296,3104,2928,2752,2560,2432,2480,2528,2576,2624,2688,2736,2784,2816,2864,2896,2912,2752,2560,2368,2176,2000,1824,1648,1488,1328,1184,1040,1056,1152,1248,1344,1440,1552,1648,1744,1840,1920,2000,2064,2128,2192,2224,2272,2304,2320,2336,2336,2336,2336,2320,2304,2288,2256,2240,2208,2160,2128,2080,2048,2000,1952,1904,1856,1808,1760,1712,1664,1616,1568,1536,1488,1440,1216,944,704,464,256,96,0,0,0,0,0,0,0,0,16,64,144,272,400,544,688,816,960,1088,1200,1328,1424,1536,1632,1712,1792,1872,1952,2016,2064,2128,2160,2208,2240,2272,2304,2320,2352,2368,2352,2144,1936,1744,1552,1360,1184,1040,912,800,720,688,720,768,816,848,896,928,976,1008,1040,1072,1104,1136,1168,1200,1232,1264,1296,1312,1344,1376,1424,1504,1600,1728,1840,1952,2064,2160,2288,2384,2496,2608,2688,2784,2880,2960,3040,3120,3200,3280,3344,3408,3472,3520,3568,3616,3664,3696,3728,3792,3840,3888,3904,3920,3920,3904,3904,3888,3872,3872,3856,3856,3840,3808,3792,3776,3744,3824,3920,3984,3984,3952,3920,3888,3856,3824,3792,3760,3712,3648,3600,3552,3504,3472,3424,3376,3344,3296,3248,3216,3184,3136,3104,3072,3040,3008,2976,2944,2912,2880,2864,2832,2784,2496,2176,1856,1568,1280,1024,784,576,368,336,384,416,464,528,592,656,736,800,880,944,1008,1072,1136,1184,1232,1280,1312,1344,1376,1408,1424,1440,1456,1456,1456,1456,1456,1456,1488,1504,1504,1504,1440,1200,976,752,528,336,160,80,0,0,0,48,80,112,176,208,256,304,336,384,432,480,528,576,624,672,704,752,800,880,1088,1328,1552,1760,1952,2160,2336,2480,2624,2752,2880,2976,3056,3136,3216,3184,3024,2864,2704,2544,2400,2256,2112,1984,1856,1744,1680,1792,1904,2016,2128,2240,2368,2480,2576,2688,2784,2848,2752,2640,2512,2400,2272,2160,2064,1952,1872,1792,1696,1776,1920,2048,2176,2304,2432,2560,2672,2800,2928,3056,3040,2928,2816,2672,2528,2400,2272,2144,2016,1920,1824,1744,1664,1600,1536,1488,1456,1440,1424,1408,1408,1408,1424,1456,1472,1504,1536,1584,1616,1664,1712,1760,1808,1872,2096,2336,2576,2800,3024,3216,3408,3584,3728,3856,3936,3984,4016,4048,4080,4080,4080,4080,4080,4048,4016,3984,3952,3920,3888,3856,3824,3792,3760,3696,3648,3600,3552,3504,3440,3344,3232,3136,3040,2928,2832,2736,2640,2544,2400,2112,1824,1552,1280,1024,784,560,368,176,32,0,0,0,0,0,0,0,0,0,0,0,0,16,48,80,144,192,224,272,304,352,400,464,512,560,592,640,688,736,784,864,960,1072,1184,1360,1664,1936,2208,2480,2736,2976,3200,3408,3584,3760,3888,3952,4016,4048,4080,4080,4080,4080,4080,4080,4080,4080,4064,4016,4000,3952,3920,3888,3856,3824,3792,3776,3728,3648,3552,3456,3360,3264,3152,3056,2960,2864,2768,2672,2480,2160,1888,1616,1344,1104,880,656,464,288,128,64,128,224,336,464,592,720,816,912,1008,1104,1152,1040,928,832,720,624,544,464,384,320,288,256,256,288,320,352,416,464,512,560,608,640,688,736,768,816,864,896,944,992,1072,1168,1264,1344,1536,1840,2112,2368,2624,2880,3104,3312,3504,3680,3840,3936,4000,4048,4080,4080,4080,4080,4080,4080,4080,4080,4080,4048,3936,3792,3568,3344,3120,2912,2704,2528,2352,2192,2208,2256,2304,2368,2432,2496,2560,2624,2688,2736,2784,2688,2512,2352,2192,2064,1952,1824,1712,1584,1472,1344,1232,1136,1040,960,912,848,816,784,768,752,752,768,784,800,832,880,912,960,1008,1056,1120,1168,1264,1504,1744,1984,2208,2432,2640,2832,3008,3184,3328,3472,3440,3344,3248,3152,3056,2944,2848,2736,2640,2544,2448,2352,2272,2208,2144,2080,2016,1984,1920,1904,1872,1840,1904,2096,2256,2432,2592,2736,2880,3024,3136,3264,3344,3424,3504,3568,3600,3632,3648,3664,3664,3648,3632,3600,3536,3312,3072,2816,2576,2352,2128,1936,1760,1584,1440,1280,1120,976,832,720,608,528,448,384,336,304,288,272,272,272,288,320,352,384,432,480,544,592,736,1008,1232,1488,1712,1936,2144,2336,2512,2672,2832,2960,3088,3216,3312,3376,3440,3504,3536,3568,3584,3584,3584,3568,3536,3504,3472,3424,3376,3312,3264,3200,3136,3056,2992,2912,2832,2768,2688,2608,2528,2448,2384,2304,2224,2144,2080,2016,1936,1872,1808,1744,1680,1632,1568,1520,1456,1424,1376,1328,1280,1248,1200,1152,1136,1136,1136,1120,1120,1088,1056,1024,992,960,928,912,896,880,848,640,416,240,128,64,64,96,144,192,240,272,320,352,400,464,512,560,592,640,688,784,928,1104,1264,1424,1584,1744,1888,2016,2128,2240,2352,2432,2512,2592,2656,2720,2784,2816,2864,2896,2928,2960,2960,2976,2992,2992,2992,2992,2992,2976,2976,2960,2944,2928,2912,2896,2880,2848,2832,2800,2784,2752,2736,2704,2688,2656,2464,2240,2016,1792,1600,1424,1248,1088,944,816,720,768,928,1072,1232,1376,1504,1632,1776,1904,2032,2144,2256,2368,2464,2560,2656,2736,2816,2880,2928,2960,2976,3008,3024,3024,3040,3040,3040,3024,3024,3008,2992,2992,2944,2752,2560,2368,2176,2000,1840,1696,1568,1456,1344,1248,1168,1104,1056,1024,992,992,992,992,1024,1056,1072,1232,1456,1680,1888,2096,2304,2512,2688,2880,3040,3200,3264,3200,3152,3088,3024,2960,2896,2832,2752,2704,2640,2624,2736,2864,2976,3088,3200,3312,3408,3504,3584,3648,3696,3744,3792,3824,3824,3792,3776,3728,3664,3616,3568,3520,3472,3424,3392,3344,3296,3264,3216,3184,3152,3104,3072,2880,2608,2368,2128,1888,1680,1456,1264,1088,928,768,704,784,832,912,992,1072,1168,1264,1360,1456,1536,1632,1696,1776,1840,1904,1952,2000,2048,2064,2112,2128,2144,2160,2176,2176,2176,2176,2160,2160,2144,2128,2096,2080,2064,2032,2016,1984,1968,1936,1904,1872,1840,1808,1792,1664,1440,1232,1040,864,688,528,384,256,160,80,32,16,0,0,0,0,0,0,32,64,80,128,176,224,272,304,352,400,464,544,624,704,800,896,992,1104,1200,1296,1392,1504,1600,1696,1776,1872,1968,2048,2144,2224,2304,2368,2448,2512,2576,2656,2704,2864,3104,3312,3520,3712,3872,3968,4032,4080,4080,4080,4080,4080,4080,4080,4064,4032,4000,3968,3936,3904,3872,3840,3808,3776,3728,3680,3632,3584,3536,3488,3440,3408,3360,3312,3280,3248,3200,3168,3136,3072,2960,2848,2736,2624,2528,2416,2320,2208,2112,2016,1936,1888,1824,1760,1696,1520,1248,992,752,512,288,96,0,0,0,0,0,0,0,0,0,0,80,192,304,432,560,656,608,544,480,432,384,336,320,288,288,288,320,352,400,448,496,544,592,640,688,720,768,816,848,896,944,1008,1104,1184,1264,1360,1440,1536,1632,1808,2080,2320,2560,2784,3008,3216,3392,3568,3728,3872,3936,3888,3808,3728,3648,3552,3456,3360,3280,3184,3088,3008,2928,2848,2784,2720,2672,2608,2560,2512,2480,2480,2480,2624,2784,2912,3040,3152,3264,3360,3456,3536,3616,3680,3616,3472,3344,3200,3072,2928,2800,2672,2544,2416,2304,2288,2368,2432,2512,2592,2656,2720,2784,2848,2896,2944,2976,3008,3024,3040,3056,3072,3056,3056,3040,3008,2976,2944,2912,2864,2816,2768,2720,2672,2608,2544,2496,2432,2368,2304,2240,2176,2112,2048,2000,1936,1872,1824,1760,1712,1536,1296,1072,864,656,464,288,144,32,0,0,0,0,0,0,0,0,0,0,0,0,48,80,112,192,336,560,784,992,1184,1360,1536,1712,1856,2016,2144,2256,2368,2464,2560,2640,2704,2768,2816,2864,2752,2592,2448,2304,2160,2032,1904,1776,1664,1568,1472,1392,1328,1264,1216,1184,1168,1168,1168,1168,1184,1200,1232,1264,1312,1344,1392,1456,1504,1568,1632,1680,1744,1856,2096,2320,2528,2736,2944,3136,3312,3472,3616,3744,3856,3920,3968,3984,4016,4032,4048,4048,4048,4048,4032,4016,3952,3824,3648,3424,3232,3024,2832,2640,2464,2304,2144,2000,1872,1776,1696,1616,1552,1488,1424,1376,1312,1264,1232,1200,1184,1168,1168,1168,1184,1200,1216,1232,1264,1296,1344,1376,1408,1456,1504,1552,1584,1632,1680,1728,1776,1824,1872,1920,1968,2000,2048,2096,2144,2192,2240,2272,2448,2656,2848,3024,3200,3360,3504,3632,3760,3840,3888,3856,3792,3680,3536,3408,3280,3136,3008,2880,2752,2624,2576,2656,2704,2768,2816,2880,2928,2976,3008,3040,3072,3088,3088,3088,3088,3072,3056,3024,2992,2960,2912,2864,2816,2752,2688,2624,2560,2512,2464,2416,2368,2304,2208,2112,1888,1616,1360,1104,880,656,448,256,96,0,0,0,0,0,48,128,224,320,432,544,640,736,848,944,1024,1104,1184,1248,1328,1392,1440,1504,1552,1600,1648,1680,1712,1744,1776,1792,1808,1824,1840,1840,1824,1664,1488,1328,1152,1008,864,720,608,496,416,336,400,528,640,784,928,1056,1200,1328,1472,1600,1712,1824,1952,2048,2144,2224,2304,2384,2448,2512,2560,2608,2640,2672,2688,2720,2720,2736,2752,2768,2768,2768,2752,2688,2496,2304,2112,1920,1744,1568,1408,1280,1152,1040,960,1008,1104,1200,1296,1392,1504,1616,1728,1840,1936,2048,2016,1952,1888,1840,1776,1728,1680,1632,1584,1568,1536,1600,1760,1920,2064,2208,2352,2480,2624,2736,2864,2976,3072,3168,3248,3312,3376,3440,3472,3520,3552,3568,3584,3552,3408,3248,3104,2944,2800,2656,2528,2400,2272,2176,2080,1984,1904,1840,1792,1744,1696,1664,1648,1632,1632,1632,1648,1648,1664,1696,1712,1744,1776,1808,1840,1904,1968,2112,2336,2512,2672,2832,2976,3104,3232,3344,3440,3536,3552,3472,3376,3280,3184,3088,2976,2880,2784,2688,2592,2544,2608,2688,2752,2832,2896,2960,3024,3072,3120,3168,3200,3216,3232,3248,3264,3264,3264,3248,3232,3200,3184,3136,2992,2784,2592,2400,2208,2032,1872,1712,1552,1424,1296,1168,1072,992,912,832,784,736,704,672,656,640,688,848,1008,1168,1312,1472,1616,1744,1872,2000,2112,2208,2304,2384,2448,2512,2560,2592,2624,2656,2672,2672,2672,2688,2704,2704,2688,2672,2640,2592,2544,2480,2416,2368,2192,1968,1776,1568,1392,1200,1040,880,752,624,512,416,336,256,208,176,160,144,144,144,160,176,224,400,592,784,960,1152,1344,1520,1680,1840,1984,2112,2240,2352,2448,2544,2624,2688,2752,2800,2848,2880,2896,2784,2640,2496,2352,2224,2080,1968,1840,1728,1632,1536,1456,1392,1328,1264,1232,1200,1168,1152,1152,1152,1152,1232,1408,1584,1744,1904,2064,2208,2352,2496,2608,2720,2816,2896,2992,3072,3168,3232,3280,3312,3312,3296,3296,3248,3072,2880,2704,2528,2352,2192,2048,1904,1776,1648,1536,1440,1344,1264,1200,1152,1104,1088,1056,1040,1024,1024,1040,1056,1072,1104,1136,1168,1200,1248,1312,1376,1424,1472,1536,1600,1648,1712,1760,1824,1888,1936,2000,2048,2096,2160,2208,2256,2288,2336,2384,2432,2464,2496,2544,2576,2608,2624,2656,2688,2704,2720,2736,2752,2768,2784,2800,2944,3104,3248,3376,3504,3632,3744,3824,3872,3904,3888,3856,3824,3792,3744,3696,3648,3600,3552,3504,3456,3408,3376,3328,3296,3200,2944,2720,2496,2288,2080,1904,1712,1600,1616,1632,1648,1664,1696,1728,1760,1792,1824,1856,1856,1744,1600,1472,1360,1232,1120,1008,912,816,736,688,624,576,544,512,496,480,464,480,480,496,512,544,576,608,656,704,752,800,848,912,960,1008,1152,1360,1568,1760,1952,2128,2304,2464,2608,2752,2864,2944,2880,2816,2736,2672,2592,2512,2416,2352,2272,2192,2144,2224,2304,2400,2480,2560,2624,2704,2800,2896,2960,3008,3040,3056,3056,3056,3040,3024,3008,2976,2944,2912,2880,2736,2528,2352,2160,1984,1808,1648,1488,1344,1216,1104,992,896,832,752,704,656,624,608,592,592,592,592,624,672,720,752,800,848,896,960,1024,1088,1152,1360,1584,1792,1984,2176,2368,2528,2688,2832,2960,3088,3184,3280,3360,3424,3472,3520,3552,3568,3584,3584,3584,3568,3552,3520,3488,3440,3408,3360,3296,3248,3184,3136,3072,3008,2944,2880,2800,2736,2672,2592,2528,2480,2432,2352,2160,1952,1744,1536,1328,1136,960,800,656,528,416,464,528,608,688,784,880,976,1072,1168,1248,1344,1424,1504,1584,1664,1728,1792,1840,1888,1936,1984,2016,2048,2080,2112,2128,2160,2176,2192,2208,2224,2224,2240,2176,2000,1856,1696,1568,1424,1296,1184,1088,992,912,848,800,752,720,704,688,688,704,720,752,784,848,1024,1232,1424,1632,1824,2000,2192,2352,2512,2656,2800,2816,2768,2720,2672,2624,2576,2528,2464,2416,2368,2320,2304,2304,2288,2288,2272,2256,2224,2192,2176,2160,2144,2192,2352,2496,2640,2784,2912,3056,3168,3280,3392,3472,3520,3440,3360,3264,3168,3072,2960,2864,2784,2688,2608,2528,2448,2368,2320,2256,2208,2160,2144,2128,2096,2080,2064,2160,2320,2448,2592,2720,2848,2960,3072,3168,3248,3328,3312,3200,3088,2992,2880,2768,2656,2560,2448,2352,2256,2224,2304,2368,2448,2512,2576,2640,2688,2736,2768,2784,2800,2800,2816,2800,2800,2784,2768,2736,2720,2688,2640,2592,2432,2256,2096,1952,1824,1680,1536,1408,1264,1136,1008,1008,1040,1088,1120,1184,1232,1296,1344,1408,1456,1520,1504,1408,1328,1232,1152,1088,1008,944,896,848,800,768,736,720,704,688,688,704,720,736,784,816,848,896,944,992,1040,1088,1152,1200,1264,1312,1376,1440,1616,1808,1984,2160,2320,2480,2624,2768,2896,2992,3104,3088,3024,2976,2896,2832,2752,2688,2608,2544,2464,2400,2400,2496,2560,2624,2688,2768,2816,2880,2928,2976,3008,2992,2880,2752,2640,2528,2432,2352,2272,2176,2096,1984,1888,1792,1712,1632,1568,1504,1456,1408,1360,1344,1312,1296,1280,1280,1280,1296,1296,1312,1328,1344,1376,1408,1424,1552,1712,1872,2032,2176,2304,2432,2560,2672,2768,2864,2944,3024,3088,3136,3168,3200,3232,3232,3232,3232,3232,3168,2992,2832,2688,2528,2368,2224,2080,1952,1824,1712,1632,1664,1696,1744,1792,1840,1904,1952,2000,2048,2080,2112,2032,1936,1824,1728,1632,1552,1456,1376,1296,1232,1168,1216,1296,1376,1472,1552,1648,1728,1824,1936,2032,2112,2176,2224,2256,2272,2288,2304,2320,2320,2320,2320,2320,2272,2112,1984,1840,1712,1584,1456,1344,1232,1152,1056,1008,1072,1152,1232,1312,1392,1488,1568,1648,1744,1808,1872,1840,1760,1712,1648,1584,1536,1472,1424,1376,1344,1312,1280,1264,1248,1232,1232,1248,1248,1264,1296,1312,1344,1376,1408,1456,1488,1536,1584,1632,1680,1728,1776,1824,1872,1936,1984,2032,2080,2128,2176,2224,2272,2304,2352,2400,2432,2480,2512,2544,2576,2608,2624,2656,2672,2720,2768,2928,3088,3232,3344,3456,3552,3632,3696,3760,3824,3840,3808,3696,3584,3472,3344,3232,3104,2992,2880,2768,2672,2624,2672,2704,2752,2784,2832,2864,2896,2928,2944,2960,2976,2976,2976,2976,2960,2960,2944,2912,2896,2848,2816,2784,2736,2688,2656,2608,2544,2496,2432,2384,2336,2272,2208,2048,1856,1680,1504,1328,1168,1024,896,768,656,560,480,400,336,288,256,224,208,192,208,208,224,256,288,320,368,416,464,528,576,640,704,768,832,928,1024,1120,1200,1264,1328,1376,1424,1488,1536,1584,1632,1680,1728,1792,1840,1888,1936,1984,2032,2080,2128,2272,2448,2608,2768,2912,3056,3184,3296,3408,3488,3584,3568,3472,3392,3312,3216,3120,3040,2960,2864,2784,2704,2624,2560,2480,2416,2352,2304,2256,2208,2176,2128,2096,2080,2048,2032,2016,2000,2000,1984,1984,1984,1984,1984,1984,1984,2000,2000,2016,2016,2032,2032,2048,2064,2064,2080,2192,2352,2480,2608,2720,2832,2944,3040,3120,3184,3248,3280,3312,3344,3392,3424,3440,3456,3424,3376,3328,3264,3200,3136,3056,2992,2912,2832,2752,2688,2608,2528,2464,2352,2128,1936,1744,1552,1360,1200,1040,896,768,640,528,432,368,288,240,192,160,144,144,160,176,192,304,480,624,800,960,1120,1264,1408,1552,1680,1808,1824,1792,1760,1712,1680,1648,1600,1568,1520,1504,1456,1488,1616,1728,1824,1936,2048,2144,2240,2336,2416,2496,2528,2464,2384,2304,2224,2160,2080,2000,1936,1872,1808,1760,1712,1664,1616,1584,1584,1584,1600,1616,1616,1616,1600,1600,1600,1600,1616,1616,1632,1648,1664,1696,1728,1744,1776,1808,1840,1872,1920,1952,1984,2016,2064,2096,2128,2176,2208,2240,2272,2304,2336,2368,2384,2416,2448,2480,2528,2704,2848,2992,3136,3264,3376,3488,3584,3664,3728,3776,3712,3616,3520,3408,3312,3200,3088,2976,2880,2784,2672,2688,2736,2768,2816,2848,2896,2928,2960,2992,3008,3024,2960,2816,2688,2560,2432,2304,2176,2048,1936,1840,1728,1696,1744,1792,1856,1904,1952,2000,2064,2128,2208,2256,2272,2160,2032,1920,1792,1664,1552,1440,1344,1248,1168,1088,1136,1216,1296,1360,1440,1520,1600,1664,1744,1808,1856,1808,1728,1648,1568,1488,1408,1328,1264,1200,1136,1088,1120,1232,1328,1456,1552,1648,1744,1840,1936,2016,2096,2112,2048,1984,1904,1840,1760,1696,1632,1568,1520,1456,1424,1376,1360,1328,1312,1296,1296,1280,1296,1296,1312,1344,1472,1616,1744,1872,2016,2144,2256,2384,2480,2576,2672,2656,2608,2560,2496,2448,2384,2320,2256,2208,2176,2144,2176,2288,2368,2432,2496,2544,2592,2640,2688,2736,2768,2752,2656,2560,2464,2368,2272,2192,2096,2032,1952,1872,1840,1904,1968,2032,2096,2176,2240,2304,2368,2416,2464,2512,2544,2592,2624,2640,2672,2704,2704,2720,2720,2720,2704,2624,2480,2352,2208,2080,1968,1856,1744,1648,1552,1472,1392,1328,1264,1216,1184,1152,1136,1120,1104,1104,1104,1120,1136,1152,1184,1200,1232,1280,1312,1344,1392,1424,1488,1664,1824,1968,2128,2272,2400,2528,2640,2752,2848,2928,2912,2896,2864,2816,2752,2672,2592,2512,2432,2352,2272,2208,2144,2096,2048,2000,1952,1920,1888,1872,1856,1840,1824,1808,1808,1808,1808,1808,1824,1840,1856,1856,1872,1936,2064,2192,2320,2448,2576,2688,2800,2896,2992,3072,3136,3184,3248,3280,3296,3328,3328,3328,3328,3328,3296,3280,3248,3216,3168,3136,3072,3024,2976,2928,2864,2800,2736,2592,2400,2224,2064,1888,1728,1584,1440,1312,1200,1088,992,912,832,768,720,672,640,624,608,592,592,592,608,624,672,736,784,832,880,912,944,976,1008,1040,1088,1120,1168,1216,1248,1296,1360,1408,1456,1504,1552,1600,1648,1712,1760,1808,1840,1888,1936,1984,2032,2064,2112,2144,2176,2208,2240,2272,2304,2352,2384,2416,2448,2464,2496,2512,2544,2560,2576,2592,2608,2624,2624,2640,2656,2656,2656,2672,2672,2672,2672,2672,2672,2672,2672,2784,2896,2992,3088,3184,3264,3328,3392,3456,3504,3520,3456,3344,3248,3136,3024,2912,2800,2672,2576,2480,2368,2352,2384,2400,2432,2448,2496,2544,2592,2624,2640,2640,2624,2608,2576,2560,2528,2480,2448,2416,2384,2336,2288,2208,2032,1872,1712,1568,1408,1280,1152,1024,912,800,736,768,816,864,928,992,1056,1120,1168,1232,1296,1360,1328,1264,1200,1136,1072,1024,960,912,880,848,816,864,976,1072,1184,1280,1392,1488,1584,1680,1760,1856,1872,1808,1760,1712,1664,1600,1552,1504,1456,1424,1392,1360,1344,1328,1312,1296,1296,1312,1312,1328,1344,1360,1392,1424,1456,1472,1504,1536,1584,1632,1696,1760,1824,1872,2016,2160,2304,2432,2560,2672,2784,2880,2976,3056,3136,3136,3072,3008,2928,2864,2784,2720,2640,2576,2512,2448,2384,2336,2288,2240,2192,2160,2128,2096,2080,2064,2032,2032,2032,2032,2032,2048,2048,2064,2064,2080,2096,2112,2128,2256,2384,2512,2640,2752,2864,2960,3056,3136,3216,3264,3232,3152,3072,2976,2896,2816,2720,2640,2544,2480,2384,2384,2448,2496,2544,2592,2640,2688,2720,2752,2784,2800,2816,2832,2848,2848,2848,2832,2800,2784,2768,2736,2720,2720,2704,2672,2640,2576,2512,2448,2368,2320,2240,2176,2112,2048,2000,1936,1888,1824,1776,1728,1680,1632,1584,1552,1424,1264,1104,976,832,720,608,496,416,336,272,208,176,160,160,160,176,176,192,224,256,288,336,384,448,512,576,656,720,800,880,960,1024,1136,1344,1536,1712,1904,2080,2240,2400,2544,2688,2816,2912,2912,2880,2848,2816,2768,2720,2672,2624,2592,2544,2496,2544,2640,2720,2784,2864,2944,3008,3056,3120,3152,3200,3248,3296,3344,3376,3392,3392,3360,3344,3312,3264,3232,3136,2960,2800,2640,2480,2336,2192,2048,1920,1808,1696,1632,1664,1696,1744,1792,1840,1888,1952,2000,2048,2096,2128,2176,2208,2240,2272,2288,2320,2336,2352,2368,2368,2384,2384,2384,2368,2368,2352,2336,2320,2304,2288,2272,2240,2224,2208,2176,2144,2128,2096,2080,2048,2032,2000,1968,1952,1936,1904,1888,1856,1840,1824,1808,1776,1760,1744,1728,1728,1712,1696,1680,1664,1664,1648,1632,1632,1616,1616,1600,1584,1584,1600,1632,1648,1664,1648,1648,1632,1616,1504,1360,1232,1104,1008,896,800,720,656,592,544,512,496,480,464,480,496,528,560,592,640,688,800,976,1168,1344,1520,1696,1856,2016,2160,2304,2432,2544,2656,2752,2832,2912,2992,3040,3104,3152,3184,3216,3232,3168,3088,2992,2912,2816,2736,2656,2592,2512,2448,2384,2336,2288,2256,2208,2192,2160,2144,2128,2112,2112,2112,2112,2128,2128,2144,2160,2176,2192,2208,2240,2256,2272,2320,2448,2560,2672,2784,2912,3040,3152,3248,3328,3376,3392,3328,3248,3168,3088,2992,2912,2832,2752,2672,2592,2528,2464,2400,2352,2288,2240,2208,2160,2128,2096,2080,2048,2096,2192,2272,2336,2416,2496,2560,2624,2672,2720,2784,2768,2704,2640,2560,2496,2416,2352,2272,2208,2144,2080,2016,1968,1904,1856,1824,1776,1744,1712,1696,1680,1648,1648,1744,1824,1904,2000,2080,2160,2224,2288,2352,2416,2448,2496,2528,2560,2576,2592,2592,2592,2592,2592,2576,2560,2464,2336,2208,2080,1952,1840,1712,1616,1552,1472,1408,1392,1424,1440,1456,1472,1504,1520,1552,1584,1600,1632,1616,1536,1472,1392,1312,1248,1184,1120,1056,1008,976,944,1024,1088,1168,1248,1328,1392,1472,1552,1616,1680,1744,1712,1664,1632,1600,1552,1520,1472,1440,1408,1376,1344,1392,1488,1568,1648,1728,1824,1888,1968,2048,2112,2176,2224,2272,2320,2368,2400,2432,2448,2464,2480,2496,2496,2480,2368,2272,2160,2064,1968,1872,1792,1712,1632,1568,1504,1456,1408,1376,1344,1328,1296,1280,1280,1280,1312,1344,1376,1408,1440,1440,1456,1472,1472,1488,1520,1536,1568,1600,1632,1664,1696,1728,1760,1808,1840,1872,1920,1952,2032,2176,2304,2432,2544,2656,2768,2864,2960,3040,3120,3152,3104,3040,2992,2944,2880,2832,2768,2704,2656,2592,2544,2496,2448,2400,2352,2320,2288,2256,2224,2208,2176,2160,2144,2144,2128,2128,2112,2112,2112,2112,2112,2112,2112,2112,2128,2128,2128,2144,2144,2160,2160,2176,2176,2192,2192,2208,2208,2208,2224,2240,2240,2240,2240,2240,2240,2272,2384,2512,2608,2720,2816,2896,2928,2976,3024,3040,3056,3072,3072,3072,3056,3056,3040,3008,2976,2944,2912,2880,2832,2784,2736,2688,2640,2592,2544,2480,2432,2368,2320,2208,2048,1888,1744,1600,1472,1344,1248,1152,1056,960,928,976,1024,1072,1120,1168,1232,1280,1328,1392,1440,1472,1408,1360,1296,1248,1200,1152,1104,1072,1040,1008,976,960,960,944,944,944,960,976,992,1008,1040,1072,1184,1328,1456,1584,1712,1824,1936,2048,2160,2240,2336,2352,2320,2288,2272,2272,2256,2224,2176,2128,2064,2016,1968,1920,1888,1856,1824,1808,1792,1776,1760,1760,1760,1760,1776,1776,1792,1808,1824,1840,1856,1888,1904,1936,1968,2080,2208,2320,2432,2544,2640,2752,2832,2928,3008,3072,3136,3184,3216,3248,3280,3296,3296,3312,3296,3296,3280,3264,3232,3200,3168,3136,3088,3056,3008,2960,2912,2864,2816,2752,2704,2656,2592,2544,2496,2432,2384,2336,2288,2224,2080,1920,1776,1648,1520,1408,1296,1184,1104,1024,944,976,1024,1072,1120,1184,1264,1344,1424,1520,1584,1616,1584,1520,1456,1376,1312,1264,1200,1168,1120,1088,1056,1088,1184,1264,1360,1456,1536,1632,1712,1808,1872,1968,1984,1952,1920,1872,1840,1808,1760,1728,1696,1664,1648,1632,1632,1632,1632,1632,1632,1648,1664,1680,1696,1712,1744,1776,1792,1824,1856,1888,1936,1968,2000,2032,2064,2112,2208,2352,2480,2592,2720,2832,2928,3024,3104,3184,3264,3264,3200,3152,3088,3024,2960,2896,2832,2768,2704,2640,2576,2528,2480,2416,2384,2336,2288,2272,2272,2272,2256,2256,2224,2192,2160,2128,2112,2080,2064,2048,2032,2032,2032,2112,2208,2288,2384,2464,2560,2624,2688,2752,2816,2864,2896,2928,2960,2976,2992,2992,2992,2976,2960,2944,2912,2896,2864,2832,2816,2768,2736,2688,2656,2608,2560,2512,2464,2416,2368,2320,2272,2224,2176,2128,2080,2032,1984,1936,1904,1856,1808,1760,1744,1696,1664,1616,1600,1568,1536,1504,1488,1456,1424,1424,1392,1376,1360,1344,1328,1312,1312,1296,1296,1280,1280,1264,1264,1248,1248,1248,1280,1248,1168,1088,992,896,800,720,640,576,512,464,464,544,624,704,800,864,944,1024,1104,1184,1264,1328,1408,1472,1536,1600,1664,1728,1792,1840,1888,1936,1984,1952,1904,1856,1824,1792,1776,1744,1728,1712,1696,1680,1728,1824,1904,1984,2064,2144,2224,2304,2384,2448,2512,2576,2640,2688,2736,2768,2816,2848,2864,2896,2912,2928,2912,2848,2768,2688,2624,2544,2480,2416,2352,2288,2240,2208,2240,2288,2336,2384,2432,2480,2528,2560,2592,2640,2656,2640,2608,2576,2544,2496,2432,2352,2288,2224,2176,2112,2128,2160,2208,2240,2288,2336,2384,2416,2464,2496,2528,2560,2592,2608,2624,2640,2656,2656,2672,2672,2672,2656,2624,2528,2448,2352,2256,2176,2096,2032,1968,1904,1840,1808,1840,1872,1920,1968,2016,2064,2096,2144,2176,2224,2256,2208,2160,2096,2048,2000,1952,1888,1840,1808,1776,1728,1760,1824,1872,1920,1984,2048,2096,2144,2192,2240,2272,2304,2336,2368,2384,2400,2432,2432,2448,2448,2448,2432,2432,2416,2400,2400,2400,2400,2400,2384,2368,2336,2304,2256,2208,2176,2128,2080,2176,2320,2416,2480,2528,2544,2560,2560,2544,2512,2480,2448,2416,2352,2304,2256,2192,2144,2080,2032,1968,1904,1856,1792,1744,1680,1648,1600,1568,1504,1376,1264,1152,1056,960,880,800,720,672,608,592,640,704,752,816,880,944,1024,1088,1152,1216,1280,1344,1408,1456,1504,1552,1600,1648,1680,1728,1760,1792,1824,1856,1696,1488,1344,1248,1168,1120,1088,1088,1088,1104,1136,1168,1200,1264,1328,1424,1504,1584,1648,1696,1712,1664,1616,1584,1552,1536,1504,1488,1488,1488,1488,1488,1504,1520,1536,1568,1600,1632,1680,1712,1760,1808,1840,1968,2080,2176,2240,2304,2400,2512,2608,2704,2768,2848,2896,2928,2976,3008,3024,2992,2928,2864,2800,2752,2672,2608,2528,2480,2416,2352,2304,2320,2336,2352,2352,2368,2384,2384,2384,2400,2400,2400,2400,2400,2384,2384,2368,2352,2352,2336,2320,2304,2288,2256,2256,2128,1856,1664,1504,1376,1280,1200,1152,1136,1088,1024,992,944,912,880,848,816,800,800,800,848,944,1024,1104,1200,1280,1376,1472,1552,1632,1728,1776,1776,1792,1792,1808,1808,1824,1824,1840,1856,1856,1888,1968,2032,2112,2192,2272,2352,2416,2480,2544,2608,2656,2640,2624,2592,2576,2544,2528,2496,2480,2448,2432,2400,2384,2368,2352,2336,2336,2320,2320,2304,2304,2304,2304,2304,2304,2304,2304,2320,2320,2320,2336,2336,2352,2352,2384,2448,2512,2576,2640,2704,2752,2800,2832,2864,2896,2912,2880,2848,2832,2800,2752,2688,2624,2544,2480,2416,2352,2288,2240,2176,2128,2096,2048,2016,1984,1952,1936,1920,1936,2000,2032,2080,2128,2176,2224,2240,2288,2304,2336,2320,2272,2224,2176,2128,2096,2048,2000,1968,1936,1904,1888,1936,1952,1984,2016,2064,2080,2112,2144,2160,2192,2192,2208,2224,2240,2240,2240,2240,2240,2240,2224,2208,2192,2192,2176,2144,2144,2112,2096,2064,2048,2032,2000,1984,1920,1824,1744,1664,1584,1520,1456,1392,1328,1280,1232,1184,1152,1120,1104,1104,1120,1136,1136,1152,1152,1136,1136,1136,1136,1136,1152,1168,1184,1200,1216,1248,1264,1312,1408,1504,1584,1680,1760,1856,1936,2000,2080,2144,2192,2256,2304,2336,2384,2416,2448,2464,2480,2512,2528,2544,2560,2560,2560,2560,2560,2560,2544,2528,2528,2512,2496,2448,2352,2288,2208,2128,2064,1984,1920,1872,1808,1760,1744,1776,1792,1824,1856,1888,1920,1968,2000,2032,2048,2080,2112,2128,2144,2176,2192,2192,2208,2224,2224,2240,2240,2240,2224,2224,2224,2208,2224,2256,2272,2272,2272,2240,2176,2064,1984,1888,1808,1728,1664,1600,1552,1488,1456,1408,1392,1360,1344,1328,1312,1328,1328,1328,1344,1360,1376,1408,1424,1440,1472,1504,1536,1568,1600,1632,1680,1728,1776,1808,1840,1888,1936,1968,2016,2048,2096,2128,2160,2240,2352,2432,2512,2592,2672,2736,2800,2864,2912,2960,2992,3024,3056,3072,3088,3088,3088,3088,3088,3072,3072,3024,2928,2848,2768,2672,2592,2512,2448,2368,2304,2240,2176,2128,2080,2016,1984,1936,1904,1872,1856,1856,1856,1872,1936,1984,2016,2048,2080,2112,2144,2176,2192,2224,2240,2208,2160,2112,2064,2016,1968,1936,1888,1856,1824,1792,1808,1856,1888,1920,1968,2000,2048,2080,2112,2144,2160,2160,2112,2080,2048,2032,1984,1952,1920,1888,1856,1824,1824,1872,1904,1952,2000,2032,2080,2112,2160,2192,2208,2240,2272,2288,2304,2320,2336,2336,2352,2352,2352,2352,2336,2336,2320,2320,2304,2288,2272,2256,2240,2224,2208,2192,2128,2048,1968,1888,1808,1744,1664,1600,1552,1504,1472,1504,1552,1600,1632,1648,1680,1696,1712,1728,1760,1776,1792,1824,1840,1856,1872,1888,1920,1920,1936,1952,1968,1968,1984,1984,1984,2000,2000,2000,2000,2000,2000,2000,2000,1952,1888,1808,1760,1712,1664,1616,1584,1552,1520,1488,1472,1456,1456,1440,1440,1456,1456,1456,1472,1488,1504,1552,1648,1728,1824,1904,1984,2064,2128,2208,2272,2336,2384,2432,2480,2528,2560,2592,2608,2608,2624,2624,2640,2640,2624,2624,2624,2608,2592,2592,2576,2560,2528,2512,2496,2480,2464,2464,2464,2464,2448,2432,2400,2352,2320,2272,2240,2208,2176,2144,2112,2096,2064,2048,2016,2000,1984,1968,1952,1936,1936,1920,1904,1904,1888,1888,1888,1872,1856,1808,1744,1696,1648,1600,1552,1520,1504,1488,1472,1456,1504,1552,1600,1664,1712,1760,1824,1872,1920,1968,2000,2000,1984,1984,1968,1952,1936,1920,1904,1888,1888,1872,1904,1968,2016,2064,2112,2160,2208,2256,2304,2336,2384,2416,2448,2464,2496,2512,2528,2544,2544,2560,2560,2560,2544,2480,2416,2368,2336,2320,2272,2240,2176,2128,2064,2016,2016,2016,2032,2048,2064,2080,2096,2112,2128,2144,2160,2144,2096,2048,2016,1984,1952,1920,1888,1856,1824,1808,1792,1776,1760,1744,1744,1744,1728,1728,1744,1760,1776,1792,1808,1824,1840,1856,1872,1904,1904,1936,1952,1968,2000,2080,2144,2224,2288,2352,2400,2464,2512,2560,2592,2624,2656,2688,2704,2720,2736,2736,2736,2736,2736,2720,2704,2656,2576,2512,2432,2368,2304,2240,2176,2112,2064,2000,1952,1904,1872,1824,1792,1760,1760,1760,1760,1760,1744,1760,1792,1824,1840,1872,1904,1936,1968,2000,2016,2048,2048,2016,1984,1952,1920,1872,1840,1808,1792,1760,1728,1712,1696,1680,1664,1648,1648,1632,1632,1632,1632,1632,1648,1664,1680,1696,1712,1728,1744,1760,1792,1808,1824,1840,1888,1968,2032,2112,2176,2240,2288,2336,2384,2432,2480,2512,2544,2560,2576,2592,2608,2608,2608,2608,2608,2592,2576,2512,2448,2368,2304,2240,2176,2112,2048,2000,1952,1904,1856,1824,1776,1744,1712,1696,1664,1648,1664,1696,1696,1744,1792,1824,1856,1888,1920,1952,1968,2000,2032,2064,2048,2016,1984,1936,1904,1888,1856,1808,1792,1776,1744,1744,1792,1824,1856,1888,1936,1968,2000,2032,2064,2096,2112,2144,2176,2192,2208,2224,2256,2256,2272,2272,2272,2272,2272,2272,2272,2272,2256,2240,2240,2224,2224,2208,2192,2144,2064,2000,1936,1872,1824,1760,1712,1664,1632,1600,1568,1536,1520,1488,1488,1472,1472,1472,1472,1472,1488,1504,1584,1648,1728,1792,1856,1904,1968,2016,2064,2128,2192,2192,2192,2192,2176,2144,2096,2064,2016,1984,1952,1936,1952,1984,2016,2048,2080,2112,2144,2176,2208,2240,2256,2288,2304,2320,2336,2352,2368,2368,2368,2384,2384,2384,2384,2368,2368,2352,2352,2352,2368,2352,2352,2336,2336,2304,2240,2176,2112,2048,2000,1936,1888,1840,1808,1776,1728,1712,1680,1664,1648,1632,1632,1632,1632,1632,1632,1648,1648,1664,1680,1696,1712,1744,1760,1776,1808,1824,1840,1904,1984,2064,2144,2208,2272,2336,2400,2448,2496,2528,2560,2608,2672,2720,2752,2768,2784,2752,2736,2720,2704,2656,2576,2512,2416,2352,2288,2208,2144,2080,2032,1984,1936,1952,1968,1984,2000,2032,2048,2064,2080,2112,2128,2128,2144,2176,2176,2176,2192,2208,2208,2224,2224,2240,2240,2240,2240,2224,2224,2224,2208,2208,2192,2192,2176,2160,2160,2144,2128,2112,2112,2096,2080,2064,2064,2048,2032,2016,2000,2000,1984,1968,1968,1952,1936,1936,1920,1920,1904,1904,1888,1888,1872,1872,1856,1856,1856,1840,1840,1840,1824,1824,1808,1824,1840,1872,1888,1888,1888,1872,1856,1824,1808,1792,1776,1776,1760,1744,1744,1744,1728,1728,1728,1728,1728,1728,1728,1744,1744,1744,1760,1760,1776,1776,1792,1792,1808,1824,1824,1840,1840,1856,1872,1888,1904,1872,1824,1792,1760,1728,1696,1664,1648,1632,1616,1616,1600,1600,1600,1616,1616,1632,1648,1664,1680,1712,1728,1792,1872,1952,2032,2112,2192,2256,2320,2384,2448,2496,2560,2608,2640,2672,2704,2736,2752,2768,2784,2800,2800,2800,2736,2672,2608,2560,2496,2464,2448,2416,2384,2352,2304,2240,2192,2144,2096,2064,2032,2000,1968,1952,1952,1936,1920,1920,1904,1904,1920,1920,1920,1920,1936,1952,1952,1968,1984,2000,2016,2016,2048,2048,2064,2080,2096,2112,2128,2160,2176,2192,2224,2224,2240,2256,2272,2288,2304,2304,2320,2336,2336,2336,2352,2352,2352,2368,2368,2368,2368,2416,2448,2480,2512,2544,2560,2592,2608,2624,2640,2640,2624,2576,2544,2512,2480,2432,2400,2352,2320,2288,2256,2240,2256,2256,2256,2256,2256,2256,2256,2272,2304,2304,2320,2320,2304,2272,2256,2224,2192,2160,2128,2096,2064,2032,1968,1904,1856,1792,1744,1696,1648,1600,1568,1536,1504,1472,1456,1424,1408,1408,1392,1392,1376,1376,1376,1392,1424,1472,1520,1568,1632,1680,1712,1760,1808,1840,1872,1888,1888,1872,1872,1872,1856,1840,1840,1824,1824,1808,1824,1856,1888,1920,1952,1984,2000,2032,2064,2080,2096,2112,2096,2080,2048,2032,2000,1984,1968,1952,1936,1904,1904,1920,1952,1968,2000,2016,2032,2064,2064,2080,2112,2144,2160,2160,2144,2112,2080,2032,2000,1952,1920,1888,1856,1824,1808,1776,1760,1744,1744,1728,1712,1712,1712,1712,1712,1728,1728,1744,1744,1760,1776,1776,1792,1808,1824,1840,1888,1952,1984,2048,2096,2144,2192,2224,2272,2304,2336,2336,2320,2304,2288,2272,2256,2240,2224,2208,2192,2176,2160,2144,2128,2128,2112,2112,2096,2096,2080,2080,2080,2096,2128,2160,2192,2224,2256,2272,2304,2336,2352,2368,2384,2400,2400,2416,2416,2416,2416,2416,2416,2400,2384,2368,2320,2288,2272,2240,2208,2176,2112,2064,2000,1952,1904,1856,1824,1776,1744,1728,1696,1680,1664,1648,1648,1632,1664,1696,1728,1760,1792,1840,1872,1904,1936,1968,2000,2000,1984,1984,1968,1952,1936,1920,1920,1920,1920,1904,1920,1952,2000,2032,2064,2080,2112,2144,2176,2208,2224,2240,2256,2272,2288,2304,2304,2320,2320,2320,2320,2320,2320,2320,2320,2304,2304,2304,2288,2272,2272,2256,2240,2240,2192,2144,2096,2048,2016,1968,1936,1888,1856,1840,1808,1776,1760,1728,1712,1728,1760,1760,1776,1776,1760,1744,1728,1728,1712,1696,1696,1712,1696,1696,1712,1728,1728,1744,1792,1856,1904,1936,1984,2032,2080,2112,2160,2192,2224,2256,2272,2304,2320,2336,2352,2352,2368,2384,2384,2400,2416,2416,2416,2416,2416,2416,2400,2400,2384,2384,2368,2352,2352,2336,2320,2304,2304,2288,2272,2256,2240,2224,2208,2192,2192,2176,2160,2144,2128,2112,2112,2096,2080,2064,2064,2048,2032,2032,2016,2016,2000,2000,1984,1984,1968,1968,1952,1936,1936,1920,1920,1952,1968,1984,1984,1984,1936,1872,1824,1776,1712,1680,1632,1600,1552,1536,1504,1504,1536,1552,1584,1616,1648,1680,1696,1744,1776,1808,1824,1808,1808,1792,1792,1792,1776,1776,1776,1776,1776,1792,1840,1888,1936,1984,2032,2064,2112,2144,2192,2224,2256,2288,2304,2336,2352,2384,2400,2400,2416,2432,2432,2448,2448,2448,2448,2448,2448,2448,2432,2432,2432,2416,2416,2384,2336,2288,2240,2208,2160,2128,2080,2048,2032,2000,1968,1952,1936,1904,1904,1888,1872,1856,1856,1888,1920,1936,1984,2032,2048,2064,2096,2112,2112,2128,2160,2176,2176,2160,2144,2128,2096,2080,2064,2032,2016,2000,1984,1968,1952,1952,1936,1936,1936,1920,1920,1920,1920,1920,1920,1936,1936,1952,1968,1984,2000,2000,2016,2032,2048,2064,2080,2128,2176,2224,2256,2304,2336,2368,2400,2432,2464,2464,2464,2432,2416,2384,2368,2336,2304,2288,2256,2240,2208,2224,2240,2256,2272,2272,2288,2304,2304,2320,2336,2336,2336,2336,2336,2336,2336,2320,2304,2304,2288,2272,2272,2272,2240,2208,2160,2112,2048,1984,1920,1872,1808,1760,1712,1680,1648,1616,1584,1568,1536,1536,1520,1520,1504,1504,1552,1584,1616,1664,1696,1744,1776,1808,1856,1872,1904,1904,1904,1888,1872,1872,1872,1872,1872,1856,1856,1856,1872,1904,1936,1984,2016,2048,2080,2096,2128,2160,2176,2176,2160,2144,2128,2096,2080,2064,2032,2032,2000,1984,1984,2016,2032,2048,2080,2096,2128,2144,2160,2192,2208,2208,2224,2240,2240,2256,2256,2272,2256,2256,2256,2256,2240,2208,2176,2160,2128,2112,2096,2048,1984,1952,1904,1856,1808,1776,1744,1712,1696,1680,1664,1648,1648,1632,1632,1648,1696,1728,1760,1808,1840,1888,1920,1968,2000,2032,2048,2032,2032,2016,2000,1984,1984,1968,1968,1968,1968,1952,1968,1984,2000,2016,2032,2048,2064,2080,2096,2112,2128,2144,2160,2160,2176,2176,2192,2192,2208,2208,2208,2208,2208,2192,2176,2160,2144,2128,2112,2096,2096,2080,2064,2064,2048,2048,2032,2032,2032,2032,2032,2032,2032,2032,2016,2016,2016,2016,2048,2080,2096,2112,2128,2128,2112,2096,2096,2096,2096,2112,2112,2128,2128,2128,2144,2144,2144,2144,2128,2112,2112,2096,2080,2064,2048,2048,2032,2032,2032,2048,2064,2064,2080,2096,2096,2112,2128,2144,2160,2176,2192,2192,2208,2208,2224,2224,2224,2224,2240,2240,2224,2208,2192,2176,2160,2128,2112,2096,2080,2064,2048,2032,2032,2016,2000,2000,1984,1984,1984,1968,1968,1968,1968,1968,1968,1968,1968,1968,1968,1968,1968,1968,1984,1984,2000,2016,2032,2048,2080,2096,2112,2160,2192,2240,2256,2240,2240,2224,2208,2192,2176,2176,2144,2144,2128,2112,2096,2080,2048,2016,2000,1968,1952,1920,1904,1888,1872,1872,1856,1840,1840,1824,1824,1824,1808,1808,1808,1808,1808,1824,1840,1840,1856,1872,1872,1888,1904,1904,1920,1936,1952,1984,2016,2032,2064,2080,2112,2128,2144,2176,2192,2192,2208,2224,2224,2240,2240,2240,2256,2256,2256,2256,2240,2224,2208,2176,2160,2144,2112,2096,2080,2064,2048,2032,2032,2032,2048,2048,2048,2048,2048,2064,2080,2112,2144,2160,2160,2144,2128,2112,2096,2080,2048,2032,};
+/*IMA ADPCM sound, 9517 samples at 6176 Hz, generated by Tools/adpcm_encoder.c*/
+#include "adpcm.h"
+
+const uint8_t asteroid_large_explode_data[] = {
+0x00,0x77,0x77,0x77,0x77,0x77,0x08,0x88,0x80,0xA9,0xA9,0xA9,0x1A,0x11,0x21,0x11,0x22,0x21,0xB8,0xBB,0xBD,0xCB,0xCB,0xBB,0xCB,0xAB,0xAC,0xBA,0xBA,0xBB,0xCA,0xAA,
+0xBA,0x99,0xAA,0xAA,0xB8,0x00,0x88,0x05,0xC3,0x80,0xFF,0xFF,0x8C,0x00,0x00,0x00,0x01,0x01,0x21,0x11,0x22,0x31,0x22,0x77,0x37,0x00,0x98,0x89,0x89,0x81,0x19,0x36,
+0x34,0x33,0x24,0x33,0x92,0xBB,0xBD,0xCB,0xBB,0xBB,0x43,0x34,0x34,0x11,0x24,0x13,0x11,0x11,0x90,0x9A,0xAA,0xAA,0xEB,0xBA,0xBB,0xCB,0xBB,0xFC,0xFF,0xAC,0x9A,0xAA,
+0xA9,0x8A,0x88,0x80,0x08,0x88,0x80,0x11,0x31,0x43,0x44,0x34,0x34,0x43,0x33,0x24,0x43,0x33,0x34,0x33,0x32,0x22,0x33,0x24,0x22,0x33,0x32,0x33,0x42,0x21,0x22,0x38,
+0x08,0x08,0x0D,0x8B,0x8F,0x0A,0xAB,0x7B,0xD1,0xBB,0xAC,0xAC,0xAA,0xCB,0xAB,0xC9,0xBA,0x9C,0xF9,0xFF,0xA9,0xAA,0xAA,0xA9,0x39,0x26,0x33,0x24,0x23,0x13,0xEA,0xAC,
+0xBB,0xCB,0xBB,0x9B,0x14,0x23,0x43,0x32,0x33,0xF8,0xAD,0xBB,0xBB,0xAC,0x8A,0x88,0x80,0x08,0x88,0x80,0x08,0x40,0x13,0x34,0x23,0x24,0x76,0x57,0x22,0x22,0x22,0x02,
+0x99,0xAA,0xBB,0xBB,0xBC,0x48,0x34,0x43,0x33,0x33,0x22,0xCF,0xBB,0xBB,0xCB,0xBB,0xAC,0xBB,0xAA,0x9B,0x9A,0x09,0x18,0x20,0x23,0x35,0x35,0x72,0x67,0x22,0x23,0x32,
+0x32,0x02,0x81,0x80,0x80,0x80,0x80,0x9A,0xAA,0xAA,0xAB,0xCC,0xAD,0xAA,0xEF,0xBA,0xBB,0xCB,0xFB,0xAE,0xBA,0xAA,0x80,0x08,0x88,0x80,0x18,0x34,0x35,0x24,0x32,0x22,
+0x21,0x21,0x11,0x21,0x10,0x10,0x80,0x01,0x0A,0x08,0x0B,0x8B,0x0C,0x0C,0x0C,0x3B,0x80,0xD0,0xB3,0xF3,0xFF,0xFF,0x8A,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x01,0x01,
+0x11,0x11,0x11,0x12,0x13,0x41,0x31,0x77,0x35,0x33,0x57,0x32,0x81,0x80,0x80,0x00,0x08,0x08,0x08,0x08,0xA8,0xAD,0xDB,0xCB,0xAA,0xAA,0x9B,0x47,0x33,0x82,0xA9,0x99,
+0xA9,0xAA,0xB9,0xAA,0xAC,0xAA,0xBA,0xAC,0xCB,0xAA,0xBB,0xDA,0xD9,0xFF,0xDF,0x99,0x9A,0x09,0x10,0x10,0x11,0x12,0x22,0x31,0x32,0x32,0x11,0x02,0x80,0x90,0x98,0x9A,
+0xAC,0xC9,0xAB,0xBC,0xCA,0xCB,0xB9,0xFA,0xFF,0x9F,0x88,0x00,0x08,0x01,0x00,0x10,0x10,0x11,0x41,0x45,0x32,0x23,0x33,0x33,0xD3,0xBD,0xCB,0xAB,0x8A,0x11,0x10,0x11,
+0x47,0x24,0x33,0x03,0xBA,0xAB,0xBA,0xBC,0xCB,0xAA,0x09,0x28,0x10,0x12,0x31,0x12,0x54,0x34,0x27,0x42,0x22,0x24,0x23,0x24,0x33,0x24,0x77,0x12,0x80,0x80,0x80,0x80,
+0x80,0x00,0x88,0x80,0x00,0xA9,0xA9,0xAC,0xFC,0xFF,0x9A,0x08,0x08,0x10,0x00,0x10,0xC0,0xCC,0xBA,0xCB,0xAA,0xBA,0xBA,0xAB,0xAB,0x99,0x88,0x00,0x21,0x32,0x25,0x53,
+0x42,0x76,0x25,0x33,0x33,0x33,0x33,0xA9,0xBA,0xBC,0xCB,0xBB,0x2B,0x36,0x33,0x43,0x23,0x23,0xFA,0xBC,0xCB,0xBA,0xAC,0xBA,0xAA,0xAB,0xA9,0x8A,0x8A,0x08,0x00,0x31,
+0x33,0x56,0x24,0x22,0x22,0x42,0x31,0x43,0x72,0x77,0x21,0x21,0x22,0x01,0x88,0xBA,0xCB,0xBB,0xAC,0x8C,0x22,0x22,0x24,0x22,0x22,0xF0,0xAD,0xBB,0xAC,0xBB,0xBB,0xBB,
+0xAB,0xBB,0xA9,0x9A,0x78,0x47,0x33,0x33,0x33,0x24,0x23,0x22,0x12,0x02,0x00,0x80,0x80,0xCA,0xCC,0xBC,0xDB,0xFC,0xBD,0xBA,0xBB,0xAC,0x08,0x88,0x80,0x01,0x11,0x11,
+0x11,0x23,0x33,0x32,0x53,0x31,0x42,0x22,0x52,0x21,0x32,0x31,0x73,0x37,0x43,0x33,0x33,0x34,0x42,0x22,0x32,0x33,0x32,0x33,0x32,0x33,0x14,0x21,0x70,0x77,0x84,0x00,
+0x08,0x08,0x88,0x89,0xA8,0xC9,0xCF,0xAB,0x11,0x20,0x20,0x11,0xA9,0x9A,0xAA,0xAB,0xAB,0xAD,0xAA,0x9B,0xCB,0x9B,0xFF,0xBA,0xCA,0xCA,0xBA,0xBA,0xAC,0xBB,0xFF,0xBB,
+0x88,0x80,0x08,0x88,0x80,0x08,0x88,0x80,0x08,0x28,0x22,0x16,0x13,0x23,0x26,0x12,0x33,0x72,0x77,0x33,0x02,0x80,0x88,0x98,0x89,0x89,0x99,0x98,0x80,0x08,0x10,0x72,
+0x77,0x22,0x22,0x32,0x11,0x80,0x9A,0xCB,0xBC,0xBB,0xCB,0x22,0x34,0x32,0x33,0x33,0x12,0x90,0xDB,0xBA,0xBB,0xAC,0xCB,0xFF,0xAF,0x99,0xAA,0xA9,0x10,0x10,0x21,0x21,
+0x22,0xD1,0xBC,0xAC,0xBB,0xBB,0xAB,0x73,0x33,0x34,0x33,0x34,0x33,0x33,0x33,0x32,0x33,0x20,0xFE,0xAE,0xBA,0xAB,0xBB,0xBB,0xAA,0x9B,0x99,0x08,0x28,0x72,0x77,0x12,
+0x22,0x22,0x23,0x23,0x22,0x22,0x21,0x21,0x21,0x88,0xBA,0xCB,0xCC,0xBB,0xFF,0xAD,0xAB,0xAB,0xAB,0xBB,0xAA,0x99,0x98,0x00,0x21,0x32,0x31,0x34,0x33,0x34,0x54,0x44,
+0x42,0x32,0x24,0x33,0x73,0x27,0x32,0x32,0x12,0x80,0x80,0x90,0x9A,0xDB,0xAC,0xAB,0x32,0x43,0x22,0x03,0x90,0xCA,0xFA,0xBE,0xCB,0xAB,0xCB,0x10,0x21,0x21,0x22,0x23,
+0xB2,0xEF,0xAA,0xAB,0xBB,0xBB,0x49,0x33,0x34,0x34,0x32,0x24,0x22,0x22,0x11,0x02,0x81,0xFA,0xFF,0xAA,0xAA,0xAA,0xAA,0x9A,0x99,0x88,0x80,0x08,0x18,0x77,0x33,0x24,
+0x33,0x33,0x33,0x24,0x23,0x12,0x11,0x80,0x90,0xA8,0xAA,0xDB,0xBA,0xFE,0xBF,0xBA,0xBB,0xAB,0xBB,0x20,0x33,0x34,0x34,0x34,0x32,0x33,0x43,0x32,0x22,0x12,0x12,0x11,
+0x81,0x90,0xA8,0xAA,0x9E,0xCB,0xBB,0xBC,0xEB,0xFB,0xFF,0xAA,0xA9,0x9A,0x09,0x00,0x01,0x11,0x11,0x12,0x21,0x22,0x52,0x77,0x33,0x32,0x33,0x23,0x24,0x22,0x12,0x11,
+0x00,0x00,0x88,0x98,0x99,0xF9,0xFF,0xAD,0xA9,0xA9,0x9A,0x18,0x12,0x32,0x23,0x24,0x83,0xBD,0xCA,0xBA,0xAB,0xAB,0xBA,0x9A,0x89,0x08,0x21,0x73,0x77,0x24,0x22,0x23,
+0x33,0x93,0xBA,0xCB,0xBB,0xCB,0xBA,0xBB,0xBA,0xAA,0xAA,0x9A,0x78,0x57,0x23,0x24,0x22,0x22,0xB1,0xCA,0xCB,0xBB,0xCB,0xAB,0xBB,0xBB,0xCA,0xA9,0x9A,0x79,0x37,0x32,
+0x23,0x24,0x22,0x82,0x99,0x99,0xA9,0x9A,0xAB,0xAA,0xAB,0x9C,0xBB,0xCA,0xF9,0xFF,0xAF,0xA9,0x9A,0x8A,0x80,0x08,0x88,0x80,0x08,0x88,0x80,0x08,0x88,0x12,0x53,0x61,
+0x77,0x22,0x32,0x32,0x03,0x98,0x99,0x9A,0xBA,0xBA,0xBA,0xBB,0xAA,0xBA,0x09,0x4A,0x77,0x27,0x22,0x21,0x22,0x92,0xBA,0xBC,0xBB,0xBC,0xCB,0x41,0x23,0x23,0x32,0x22,
+0x22,0x02,0x01,0x08,0x9A,0xBC,0xFF,0xDF,0x9A,0xAA,0xAA,0xAB,0xB9,0xA9,0x99,0x88,0x80,0x10,0x11,0x33,0x44,0x34,0x24,0x77,0x23,0x33,0x33,0x24,0x23,0x22,0x22,0x01,
+0x81,0x00,0xF9,0xBF,0xBB,0xCB,0xBA,0xBB,0x11,0x23,0x33,0x22,0x23,0x32,0x21,0x31,0x21,0x08,0xBA,0xFF,0xFF,0x9B,0x9A,0x9A,0x9A,0x22,0x32,0x33,0x34,0x34,0xB1,0xCB,
+0xAB,0xBB,0xCB,0xAA,0x99,0x0A,0x18,0x20,0x43,0x34,0x45,0x32,0x34,0x34,0x24,0x43,0x33,0x43,0x33,0x43,0x72,0x27,0x33,0x23,0x02,0x80,0x80,0x80,0x80,0xA8,0xB8,0xAA,
+0xAA,0xCB,0xBC,0xBC,0xCB,0xBA,0xFF,0xBF,0xBA,0xBA,0xBA,0xBA,0xAA,0xAA,0x99,0x88,0x00,0x00,0x22,0x42,0x43,0x25,0x34,0x24,0x24,0x33,0x43,0x43,0x32,0x43,0x32,0x14,
+0x33,0x72,0x37,0x33,0x33,0x12,0x01,0x88,0xBA,0xEC,0xBB,0xCB,0x8C,0x11,0x11,0x12,0x22,0x11,0xF8,0xBE,0xBA,0xAC,0xBB,0xAB,0xBB,0xBA,0xAB,0x9A,0x9A,0x89,0x80,0x12,
+0x34,0x61,0x22,0x77,0x17,0x22,0x12,0x22,0x12,0xAA,0xAB,0xAC,0xBB,0xAC,0xBB,0xBA,0xBB,0xAB,0x0B,0x19,0x77,0x16,0x12,0x22,0x21,0x92,0xAC,0xAC,0xAB,0xAC,0xBA,0xAB,
+0xBA,0x9B,0xAA,0x89,0x89,0x80,0x24,0x33,0x34,0x45,0x31,0x24,0x25,0x22,0x33,0x43,0x33,0x24,0x43,0x22,0x24,0x22,0x22,0x43,0x31,0x40,0x01,0x77,0x47,0x21,0x12,0x10,
+0x89,0x88,0xC9,0xBD,0xAC,0xCB,0x1A,0x10,0x11,0x11,0x11,0x11,0xDF,0xBB,0xCB,0xBB,0xBB,0x0C,0x22,0x33,0x43,0x33,0x32,0x33,0x14,0x12,0x11,0x08,0x98,0x9A,0xAC,0xEB,
+0xCA,0xBA,0xBC,0xCB,0xCB,0xBA,0x9C,0xAC,0xFF,0xAD,0x9A,0x09,0x88,0x80,0x08,0x18,0x43,0x53,0x33,0x43,0x32,0x33,0x33,0x33,0x34,0x41,0x11,0x12,0x02,0x03,0xF9,0xFF,
+0xAA,0x9A,0xAA,0x89,0x01,0x11,0x11,0x11,0x11,0x12,0x22,0x23,0x23,0x43,0x65,0x44,0x43,0x32,0x24,0x33,0x33,0x24,0x33,0x34,0x32,0x23,0x33,0x33,0x72,0x22,0x10,0x90,
+0x98,0x89,0x89,0xDA,0xA9,0x7C,0x16,0x90,0x99,0x99,0xA9,0xDB,0xAA,0xAB,0xCB,0xBA,0xAC,0xBA,0xBB,0xCB,0xBB,0xBC,0xC9,0xFD,0xFF,0x9B,0xAA,0xAA,0x08,0x10,0x01,0x21,
+0x21,0x22,0x22,0x32,0x22,0x31,0x12,0x11,0x80,0x00,0x68,0x01,0xF0,0xFF,0x9E,0x9A,0x89,0x08,0x00,0x10,0x10,0x11,0x21,0x21,0x32,0x13,0x24,0x76,0x25,0x23,0x33,0x33,
+0x42,0x21,0x22,0xD9,0xBC,0xBB,0xBC,0xCA,0x9A,0x33,0x43,0x43,0x32,0x33,0xB2,0xCD,0xBB,0xAC,0xAB,0xBB,0x73,0x32,0x43,0x23,0x34,0x83,0xAC,0xCC,0xAA,0xBB,0xAB,0xBB,
+0xBA,0x9A,0x99,0x88,0x28,0x23,0x34,0x26,0x43,0x33,0x75,0x47,0x22,0x22,0x22,0x22,0x10,0x00,0x80,0x00,0x9A,0xA9,0xAA,0xBA,0xBB,0xBF,0xBA,0xCC,0xDC,0xBA,0xAC,0xBB,
+0xCC,0xCF,0xBA,0xBB,0xBB,0xAB,0x09,0x88,0x80,0x08,0x88,0x80,0x21,0x62,0x12,0x23,0x43,0x34,0x22,0x24,0x43,0x45,0x53,0x74,0x32,0x33,0x24,0x23,0x23,0x10,0x01,0x80,
+0x80,0x80,0x90,0x8B,0x9C,0xAA,0xAB,0xDA,0xCE,0xBB,0xCC,0xBA,0xCB,0xEB,0xBE,0xBB,0xAC,0xBB,0xBA,0x19,0x32,0x24,0x14,0x32,0x12,0xBC,0xCA,0xBA,0xBA,0xAA,0x09,0x21,
+0x52,0x23,0x43,0x41,0x22,0x33,0x42,0x54,0x34,0x73,0x36,0x33,0x43,0x32,0x23,0x12,0x10,0x08,0x08,0x08,0x08,0xFA,0xCD,0xBC,0xCB,0xBA,0x8A,0x11,0x21,0x21,0x32,0x22,
+0xDE,0xCB,0xAA,0xBB,0xCB,0xBB,0xBB,0xAA,0x9B,0x99,0x09,0x11,0x31,0x26,0x43,0x53,0x52,0x57,0x33,0x33,0x33,0x24,0x93,0xAA,0xBA,0xAC,0xAC,0xBA,0xBB,0xAB,0xCB,0xB9,
+0xA8,0x5A,0x57,0x23,0x23,0x24,0x22,0x21,0x12,0x01,0x00,0x99,0xD9,0xFF,0xBB,0xBA,0xBB,0xBB,0xBC,0xBB,0xAB,0xAB,0xAA,0x99,0x88,0x10,0x32,0x53,0x53,0x73,0x47,0x32,
+0x32,0x33,0x33,0x33,0x33,0x22,0x13,0x01,0x80,0xB8,0xBA,0xCD,0xBB,0xBD,0xBC,0xBC,0xCB,0xBB,0xBC,0xCB,0xBB,0xCB,0xBB,0xCB,0xCA,0xAA,0xBA,0xBB,0xCA,0x8C,0x08,0x89,
+0xBB,0xBC,0xCB,0x99,0xCA,0xFF,0xAF,0x09,0x00,0x01,0x01,0x11,0x21,0x11,0x22,0x65,0x43,0x33,0x24,0x23,0x33,0x32,0x32,0x42,0x11,0x12,0x82,0x11,0x08,0x08,0x0A,0xAB,
+0xBB,0xBC,0xAE,0x9C,0x9C,0xAB,0xFC,0xFF,0x9C,0x9A,0xAA,0x99,0x30,0x33,0x34,0x42,0x32,0x33,0x33,0x34,0x32,0x22,0x11,0x11,0x10,0x08,0x0A,0xAA,0xF8,0xFF,0x9E,0xAA,
+0xA9,0xA9,0xA9,0x99,0x98,0x80,0x10,0x11,0x77,0x33,0x43,0x32,0x33,0x23,0x9A,0xA9,0xAB,0xBB,0xCB,0x68,0x34,0x33,0x24,0x23,0x13,0x22,0x82,0x8A,0xCC,0xAB,0xCB,0xAA,
+0xBC,0xC9,0xA9,0x9C,0xFF,0x9E,0xAA,0xAA,0x9B,0x9B,0x02,0x22,0x22,0x43,0x23,0x14,0x23,0x22,0x23,0x30,0x11,0x21,0x08,0xA8,0xB0,0xFB,0x99,0x9C,0x9C,0xBB,0xBC,0x9B,
+0xFF,0xDF,0x99,0x9A,0xA9,0x98,0x88,0x80,0x08,0x18,0x01,0x32,0x32,0x42,0x53,0x34,0x53,0x43,0x33,0x24,0x34,0x32,0x43,0x33,0x43,0x32,0x33,0x24,0x67,0x23,0x33,0x21,
+0x00,0x08,0x08,0x88,0xA9,0xA9,0xBA,0xBA,0xCC,0xCB,0xBB,0xBC,0xCA,0xAB,0xDA,0xA9,0xED,0xBB,0xAC,0xAC,0xBB,0xAB,0xBA,0xBB,0xFF,0xAD,0xAA,0x9A,0x80,0x08,0x88,0x80,
+0x38,0x34,0x44,0x92,0x9A,0x9A,0x8A,0x89,0x10,0x33,0x44,0x42,0x32,0x41,0x13,0x34,0x54,0x33,0x34,0x34,0x57,0x32,0x43,0x32,0x32,0x03,0xA8,0xAA,0xCB,0xAB,0xCB,0xBB,
+0xAB,0xBB,0xAC,0xAA,0x80,0x77,0x23,0x22,0x23,0x32,0xB2,0xBE,0xBC,0xCB,0xBB,0xCB,0x28,0x32,0x32,0x42,0x22,0x12,0x12,0x01,0xA2,0xA0,0xBC,0xBC,0xBD,0xBC,0xEB,0xBA,
+0xCB,0xBB,0xBC,0xBB,0xCC,0xAA,0xFB,0xCF,0xAA,0xAA,0xAA,0x88,0x80,0x08,0x88,0x80,0x08,0x22,0x72,0x65,0x33,0x43,0x32,0x33,0x23,0x33,0x33,0x23,0x23,0xDF,0xBA,0xBB,
+0xBC,0xBA,0xAB,0xBA,0x9A,0x88,0x80,0x11,0x43,0x24,0x44,0x42,0x33,0x73,0x47,0x22,0x33,0x33,0x33,0x22,0x01,0x01,0x00,0x88,0x98,0xFD,0xCD,0xBA,0xAC,0xAB,0xBB,0xAB,
+0xAA,0xAA,0xAB,0xAB,0xAA,0x98,0x08,0x21,0x21,0x45,0x24,0x42,0x24,0x42,0x42,0x32,0x33,0x24,0x43,0x33,0x24,0x77,0x24,0x23,0x22,0x23,0x80,0xBA,0xAE,0xCB,0xBA,0xCB,
+0x29,0x21,0x21,0x22,0x21,0x11,0x80,0x98,0xC9,0xBB,0xBE,0xDB,0xAC,0xBB,0xAB,0xCC,0xBD,0xDF,0xBB,0xCB,0xBA,0xAA,0x80,0x08,0x30,0x33,0x35,0x33,0x34,0x32,0x33,0x24,
+0x32,0x32,0x23,0x32,0x13,0x22,0x82,0xFA,0xFF,0x9F,0xA9,0x99,0x98,0x30,0x32,0x43,0x33,0x34,0x23,0x24,0x23,0x33,0x32,0x22,0x12,0x31,0x18,0x12,0x80,0xFA,0xFF,0xAE,
+0xA9,0x9A,0xAA,0x19,0x22,0x32,0x34,0x43,0x42,0x99,0x9A,0xAA,0xAA,0x9A,0x49,0x67,0x22,0x23,0x14,0x23,0x23,0x22,0x32,0x21,0x02,0xA1,0xFF,0xBB,0xBB,0xCB,0xBA,0xBA,
+0xBA,0xA9,0xAA,0x98,0x08,0x01,0x41,0x31,0x34,0x73,0x64,0x26,0x23,0x23,0x33,0x32,0xB0,0xBC,0xCB,0xAC,0xBB,0x9C,0x32,0x42,0x22,0x23,0x23,0x12,0x11,0x01,0xA8,0xCA,
+0xFA,0xFF,0xBB,0xBB,0xAC,0xBB,0xCA,0xA9,0xAA,0x99,0x99,0x88,0x72,0x26,0x23,0x33,0x43,0x22,0x23,0x22,0x12,0x11,0x01,0x18,0x01,0x9A,0xCD,0xDB,0xAC,0xEF,0xBA,0xBB,
+0xBB,0xBB,0xBB,0xBA,0xA9,0x88,0x08,0x10,0x74,0x47,0x32,0x33,0x42,0x22,0x23,0x32,0x22,0x22,0x21,0xF0,0xBC,0xAC,0xBB,0xAC,0xBA,0xAA,0xAA,0xA9,0x99,0x80,0x70,0x37,
+0x24,0x33,0x43,0x22,0x23,0x32,0x33,0x12,0x88,0xB8,0xFF,0xAD,0xAA,0xAA,0xBA,0xAA,0xAB,0x9A,0x8A,0x99,0x09,0x11,0x31,0x33,0x45,0x35,0x32,0x34,0x43,0x33,0x25,0x23,
+0x43,0x32,0x32,0x34,0x22,0x24,0x13,0x33,0x12,0x32,0x32,0x73,0x77,0x27,0x11,0x01,0x80,0x88,0x99,0x99,0xA9,0xAA,0x9B,0xAB,0xFF,0xAE,0xAA,0xAA,0x0A,0x00,0x18,0x10,
+0x11,0x00,0xCE,0xAB,0xAC,0xAB,0xBB,0xA9,0xAA,0x99,0x98,0x81,0x12,0x34,0x63,0x33,0x34,0x25,0x72,0x37,0x32,0x33,0x33,0x24,0xA2,0xA9,0xBA,0xDB,0xB9,0x9B,0x43,0x24,
+0x33,0x53,0x23,0x12,0x00,0x88,0x99,0xBB,0xBB,0xFF,0xCF,0x9A,0xAA,0xAA,0xAA,0x9B,0x9A,0x99,0x88,0x88,0x20,0x43,0x32,0x34,0x35,0x43,0x77,0x22,0x32,0x32,0x32,0x23,
+0x22,0x22,0x12,0x00,0x80,0x98,0xBB,0xAD,0xCC,0xCA,0xCA,0xCA,0xCA,0xAA,0xAC,0x9A,0xFC,0xAD,0xBB,0xCB,0xAA,0xAB,0x11,0x23,0x33,0x34,0x24,0x33,0x33,0x34,0x32,0x32,
+0x23,0x32,0x22,0x23,0x32,0x02,0xF3,0xFF,0x9F,0x9A,0xA9,0x99,0x99,0x89,0x88,0x18,0x10,0x32,0x77,0x24,0x22,0x33,0x33,0x03,0x99,0x9A,0xAA,0xAB,0xBB,0x09,0x89,0x99,
+0xAD,0x9A,0x69,0x77,0x22,0x33,0x32,0x32,0xB1,0xCB,0xAC,0xBC,0xBA,0xBB,0xCB,0xBA,0xAA,0x89,0x9A,0x79,0x37,0x43,0x32,0x32,0x22,0xC8,0xAC,0xBC,0xBA,0xAC,0x9B,0x23,
+0x24,0x32,0x32,0x11,0x81,0x91,0x98,0xDA,0xB9,0xBE,0xFF,0xAB,0xAB,0xAC,0xAB,0x0C,0x10,0x20,0x22,0x31,0x42,0xC9,0xDB,0xAA,0xAB,0xAA,0x9B,0x9A,0x99,0x10,0x21,0x27,
+0x42,0x33,0x34,0x25,0x33,0x34,0x77,0x32,0x32,0x32,0x23,0x83,0xAA,0xBB,0xCB,0xBB,0xAD,0x40,0x22,0x43,0x22,0x23,0x92,0xDF,0xBA,0xAB,0xCA,0xCA,0xBA,0xAB,0xAB,0xAB,
+0x8B,0x9A,0x0A,0x28,0x20,0x22,0x27,0x72,0x67,0x12,0x22,0x32,0x22,0x22,0x12,0x11,0x01,0x80,0xE0,0xCF,0xBA,0xBB,0xAC,0xBB,0x1A,0x20,0x21,0x33,0x33,0x22,0xCF,0xAC,
+0xBB,0xBB,0xAC,0x2A,0x34,0x34,0x24,0x34,0x33,0x22,0x02,0x01,0x01,0x08,0xE8,0xEF,0xAA,0xBB,0xBA,0xCA,0x29,0x23,0x43,0x43,0x42,0x21,0xC8,0xA9,0x9B,0xBB,0x9B,0xAB,
+0x99,0x89,0x82,0x53,0x42,0x43,0x34,0x34,0x34,0x43,0x33,0x26,0x22,0x33,0x43,0x32,0x24,0x33,0x32,0x23,0x14,0x36,0x77,0x13,0x22,0x21,0x21,0x90,0xBD,0xCB,0xCB,0xBB,
+0xBB,0x2A,0x21,0x32,0x21,0x13,0x21,0x88,0xA0,0xB8,0xAE,0xAE,0xCB,0xAB,0xBD,0xBC,0xBB,0xCC,0xDF,0xAB,0xAC,0xBA,0xAA,0xAB,0xAA,0x99,0x99,0x18,0x18,0x32,0x53,0x43,
+0x34,0x43,0x34,0x44,0x33,0x32,0x32,0x33,0x34,0x33,0x25,0x33,0x24,0x43,0x67,0x32,0x32,0x33,0x23,0x83,0xBC,0xCA,0xBB,0xDB,0xBA,0xBA,0xBB,0xAC,0xAA,0xBA,0x9A,0x9A,
+0x9A,0xA8,0x80,0x80,0x80,0x85,0x03,0x84,0x34,0x48,0x77,0x57,0x11,0x12,0x11,0x11,0x10,0x11,0x10,0xAA,0xCB,0xCB,0xAC,0xBC,0xAB,0xBC,0xEB,0xBE,0xCB,0xAB,0xBB,0xBB,
+0xBB,0xAA,0xAA,0x99,0x10,0x10,0x77,0x24,0x33,0x33,0x43,0x83,0x98,0x99,0x99,0xAA,0xB9,0x72,0x26,0x32,0x32,0x33,0x13,0xCB,0xAC,0xBB,0xBC,0xBA,0xAB,0xAC,0x0A,0x18,
+0x01,0x98,0x08,0x20,0x30,0x43,0x37,0x41,0x33,0x54,0x22,0x42,0x22,0x15,0x22,0x23,0x23,0x43,0x44,0x77,0x32,0x22,0x32,0x12,0xB2,0xDB,0xBB,0xCC,0xBA,0xBB,0x20,0x21,
+0x31,0x22,0x12,0xF1,0xBF,0xCB,0xCA,0xAA,0xBB,0x18,0x22,0x22,0x42,0x43,0x12,0xBF,0xCB,0xBB,0xBB,0xAC,0x2B,0x43,0x32,0x43,0x33,0x33,0xDB,0xBC,0xBB,0xBC,0xBA,0x2B,
+0x37,0x34,0x33,0x43,0x32,0xB1,0xDB,0xBA,0xBB,0xBB,0x9C,0x9B,0x9A,0x09,0x19,0x20,0x75,0x57,0x31,0x22,0x23,0x32,0x98,0xBA,0xBA,0xBC,0xAA,0x2A,0x47,0x22,0x21,0x22,
+0x22,0xF9,0xCB,0xCA,0xAA,0xBA,0x9B,0x33,0x34,0x34,0x33,0x33,0x23,0x24,0x31,0x03,0x01,0xA8,0xFF,0xBF,0xBA,0xBA,0xBA,0xBA,0xBA,0xAA,0x99,0x99,0x80,0x12,0x42,0x42,
+0x25,0x43,0x52,0x57,0x23,0x33,0x33,0x24,0x82,0x98,0xBA,0xDB,0xBB,0xCB,0xAB,0xBA,0xCA,0xA9,0x98,0x99,0x89,0x80,0x20,0x32,0x30,0x77,0x67,0x12,0x22,0x22,0x21,0x21,
+0x01,0x81,0x00,0xA8,0xB9,0xDB,0xDA,0xBA,0xDB,0xBB,0xFF,0xAA,0xBA,0xAB,0xBB,0xBB,0xBA,0xAA,0xAA,0x98,0x09,0x18,0x52,0x35,0x32,0x23,0x32,0x44,0x42,0x23,0x44,0x32,
+0x33,0x34,0x25,0x22,0x33,0x34,0x42,0x22,0x32,0x33,0x26,0x22,0x31,0x32,0x22,0x32,0x83,0x34,0x88,0x04,0x08,0x08,0x08,0x77,0x77,0x14,0x11,0x10,0x90,0xAC,0xBB,0xBC,
+0xAC,0xCA,0x18,0x00,0x11,0x22,0x02,0x90,0xA9,0xC9,0xAC,0xBA,0xBD,0xFE,0xBB,0xDB,0xAA,0xBA,0xAA,0x11,0x22,0x33,0x33,0x34,0x94,0xBC,0xCA,0xBA,0xAA,0xAA,0x74,0x43,
+0x42,0x22,0x33,0x03,0xAA,0xAB,0xAD,0xAA,0xAA,0x9A,0x99,0x89,0x02,0x22,0x73,0x33,0x42,0x63,0x53,0x33,0x73,0x26,0x32,0x32,0x32,0x23,0xB0,0xCB,0xCB,0xCA,0xAA,0xBB,
+0xBA,0xBB,0xAB,0xAB,0xC9,0x08,0x08,0x02,0x02,0x34,0x33,0x77,0x77,0x21,0x11,0x11,0x91,0x9A,0xBB,0xBB,0xBC,0xCB,0x38,0x22,0x32,0x23,0x32,0x21,0x21,0x08,0xEB,0xA9,
+0x9C,0xA8,0xCC,0xBE,0xCC,0xBA,0xCB,0xBA,0xBB,0xAC,0xBB,0xCB,0xFA,0xAF,0xBA,0xAA,0xAB,0xAA,0x9A,0x88,0x00,0x10,0x22,0x63,0x52,0x42,0x23,0x34,0x24,0x65,0x33,0x43,
+0x32,0x33,0x33,0x90,0x99,0xAA,0xBA,0xBA,0x3C,0x37,0x32,0x33,0x33,0x42,0x32,0x14,0x01,0x9B,0xDB,0xFA,0xBF,0xBB,0xBB,0xBC,0xBB,0x09,0x21,0x22,0x42,0x32,0x22,0x33,
+0x32,0x32,0x22,0x83,0x83,0xC0,0xB8,0xBC,0xBC,0xFB,0x9A,0xBC,0xCA,0xBA,0xCA,0x9C,0xBA,0xDA,0x99,0xCA,0xA9,0x0A,0xAB,0xBB,0xC8,0x0B,0x8C,0xCB,0x48,0x16,0xA2,0xB0,
+0xFA,0xFF,0xAC,0xA9,0x99,0x8A,0x89,0x98,0x01,0x21,0x32,0x74,0x36,0x43,0x33,0x33,0x24,0x23,0x23,0x32,0x32,0x12,0x12,0xCD,0xAC,0xAC,0xAB,0xBB,0xBA,0x9B,0x8C,0x9A,
+0x99,0x08,0x28,0x20,0x23,0x24,0x26,0x71,0x37,0x24,0x34,0x32,0x12,0xB1,0xCB,0xDB,0xBA,0xBA,0xAC,0xAB,0xCA,0x9A,0xAA,0x9A,0x4A,0x37,0x32,0x33,0x24,0x32,0xC8,0xBC,
+0xDB,0xBA,0xBB,0xCB,0xBA,0xAB,0xBB,0xAA,0xC9,0x70,0x26,0x23,0x23,0x33,0x23,0x23,0x12,0x82,0x80,0xA8,0xFA,0xFF,0xAC,0xA9,0x9A,0xAA,0x18,0x10,0x10,0x20,0x12,0x92,
+0xBF,0xBC,0xBB,0xCB,0xAA,0x59,0x43,0x33,0x53,0x23,0x33,0xBA,0xA9,0xAC,0xBB,0xBA,0x5C,0x26,0x33,0x15,0x33,0x32,0x22,0x33,0x22,0x12,0x21,0xA8,0xFF,0xAE,0xA9,0xAA,
+0xAA,0x9B,0x9A,0x9A,0x99,0x08,0x33,0x34,0x83,0x22,0x20,0x17,0x33,0x34,0x43,0x53,0x22,0x24,0x57,0x43,0x32,0x33,0x33,0x13,0xCA,0xAA,0xBB,0xCC,0xC9,0xA9,0xBA,0x9B,
+0xBA,0xAA,0x9B,0x8A,0x8A,0x8A,0x80,0x80,0x80,0x87,0x30,0x40,0x40,0x48,0x48,0x08,0x33,0x00,0x88,0x70,0x77,0x37,0x22,0x10,0x01,0x01,0x08,0x09,0xA9,0xBA,0xBB,0xBE,
+0xCB,0xBB,0xCC,0xBB,0xFB,0xBE,0xBB,0xCB,0xAA,0xBA,0x29,0x21,0x32,0x33,0x44,0x12,0xAC,0xBB,0xBB,0xAC,0xAA,0x9B,0xA0,0x08,0x32,0x33,0x37,0x77,0x25,0x32,0x32,0x32,
+0x03,0x99,0x09,0x99,0xAC,0xAD,0xAA,0xAA,0x9A,0x99,0x89,0x80,0x83,0x33,0x34,0x73,0x32,0x74,0x37,0x33,0x43,0x22,0x23,0x22,0x12,0x02,0x10,0x89,0xA9,0xBC,0xBC,0xAD,
+0xBC,0xCB,0xDB,0xAA,0xAC,0xBB,0xCB,0xDA,0xCE,0xBB,0xBB,0xCB,0xAA,0x1B,0x22,0x32,0x35,0x34,0x13,0xBA,0xCC,0xAA,0x9B,0xAB,0x2A,0x47,0x43,0x32,0x43,0x32,0x90,0xA9,
+0xAA,0xBB,0xBA,0x9A,0x08,0x08,0x30,0x43,0x43,0x36,0x42,0x43,0x25,0x22,0x43,0x67,0x32,0x33,0x33,0x33,0x03,0xAC,0xBB,0xBC,0xCB,0xBB,0xAC,0xBB,0xCA,0x9A,0x08,0x89,
+0xCB,0xBB,0xCA,0xA9,0x89,0x70,0x57,0x22,0x23,0x22,0x23,0x12,0x12,0x81,0xA0,0xA9,0x9D,0xCB,0xD9,0xCA,0xBA,0xBC,0xCB,0xBB,0xBC,0xAC,0xCB,0xBB,0xBA,0xCC,0xB8,0xBB,
+0xB9,0xAC,0xC9,0x8A,0xAB,0xAA,0xAA,0xB8,0xC8,0xC0,0xB0,0x08,0xB7,0xFF,0xBB,0xAC,0xAB,0xAA,0x40,0x43,0x24,0x33,0x43,0x33,0x24,0x33,0x24,0x33,0x33,0xA3,0xAD,0xAA,
+0xB9,0xA9,0xA9,0x67,0x33,0x34,0x33,0x24,0x33,0x24,0x12,0x23,0x30,0x11,0xF9,0xBD,0xCA,0xAA,0xBB,0xAA,0x32,0x34,0x43,0x23,0x52,0x80,0xBA,0xDA,0xDC,0xAA,0xBA,0x20,
+0x23,0x34,0x33,0x24,0x32,0x13,0x12,0x02,0x02,0xC0,0xFE,0xAE,0xBB,0xBA,0xBB,0x9B,0x21,0x34,0x24,0x42,0x31,0xB2,0xDC,0xBA,0xCA,0x9B,0xCA,0x42,0x23,0x44,0x22,0x32,
+0x22,0x32,0x11,0x84,0x82,0xA0,0xA8,0x8B,0x80,0xD0,0xFB,0xCC,0xBB,0xBC,0x67,0x12,0x81,0x81,0x98,0x99,0xCA,0xAA,0xAC,0xAC,0xBB,0xDA,0xBA,0xB9,0xCA,0xCF,0xAA,0xAB,
+0xBA,0xBA,0x28,0x24,0x34,0x52,0x22,0x33,0x24,0x23,0x33,0x23,0x24,0x23,0xF3,0xFF,0x89,0x89,0x80,0x10,0x00,0x12,0x24,0x22,0x01,0xB9,0xA9,0xA8,0x89,0x80,0x20,0x22,
+0x45,0x53,0x42,0x23,0x67,0x12,0x31,0x33,0x33,0x23,0x32,0x11,0xEA,0xBB,0xDB,0xCB,0xAA,0xBB,0x11,0x00,0x11,0x80,0x82,0x80,0xB0,0xC8,0x8B,0xBC,0xCB,0x8F,0xFF,0xBF,
+0x99,0x98,0x90,0x89,0x99,0x98,0x89,0x80,0x62,0x23,0x34,0x43,0x23,0x24,0x08,0x00,0x00,0x00,0x01,0x73,0x34,0x43,0x33,0x43,0x32,0x99,0x99,0xAA,0xAA,0x9C,0xAB,0xA9,
+0x0B,0x8B,0x8B,0x80,0x80,0x80,0x07,0x40,0x40,0x78,0x37,0x24,0x33,0x13,0x32,0xB1,0xAB,0xDC,0xBD,0xBC,0xBB,0xAC,0x9C,0xAA,0xAA,0x9A,0x29,0x17,0x23,0x43,0x30,0x21,
+0xC9,0xBC,0xBB,0xBC,0xAB,0xAB,0x16,0x22,0x14,0x32,0x41,0x18,0x12,0x00,0x88,0xB0,0xBC,0xC0,0x0E,0x9C,0x9C,0xB9,0xFA,0xAF,0xAA,0xAB,0xBB,0xBA,0xAB,0x9A,0x28,0x01,
+0x82,0x8A,0x80,0x58,0x33,0x24,0x17,0x66,0x33,0x24,0x24,0x32,0x22,0x23,0x32,0x22,0x11,0x14,0x21,0x88,0x80,0xB0,0x0B,0xAD,0xFF,0xAC,0xBB,0xBB,0xBB,0x9B,0x12,0x43,
+0x32,0x25,0x13,0x33,0x21,0x15,0x10,0x82,0x83,0xC0,0x80,0x4B,0x16,0x80,0xFC,0xAF,0xAA,0xAB,0xAA,0xAB,0x9A,0x9A,0x99,0x81,0x20,0x32,0x16,0x42,0x43,0x33,0x44,0x34,
+0x32,0x34,0x52,0x31,0x23,0x57,0x22,0x32,0x23,0x33,0x13,0x32,0x11,0x80,0x80,0x8A,0xFF,0xBC,0xCB,0xAA,0xBB,0xCB,0xAA,0xAB,0xAB,0x9A,0x80,0x72,0x23,0x32,0x32,0x23,
+0x14,0xFB,0xCA,0xBA,0xBA,0xBA,0x2B,0x35,0x52,0x32,0x32,0x13,0xE0,0xBA,0xC9,0xAB,0xBB,0x8C,0x16,0x43,0x22,0x33,0x13,0x43,0x21,0x21,0x20,0x08,0xB8,0xC8,0xD0,0xBA,
+0xCB,0xBB,0xFB,0xFF,0xAA,0xAA,0x9B,0x9A,0x31,0x23,0x30,0x21,0x41,0x12,0x24,0x21,0x52,0x10,0x22,0x38,0x80,0x84,0x80,0x80,0x80,0xFF,0xCF,0x99,0x99,0x9A,0x99,0x09,
+0x09,0x81,0x20,0x22,0x77,0x24,0x33,0x33,0x43,0x23,0x32,0x23,0x12,0x10,0x28,0xB0,0x80,0xBB,0xC8,0xEC,0xA9,0xAA,0x80,0xB0,0xEC,0xAD,0xAC,0xAA,0xBB,0xC9,0xB9,0xAA,
+0xAA,0x0B,0xCB,0xC0,0x80,0xBB,0xFF,0xAC,0xBA,0x99,0x89,0x5A,0x33,0x26,0x32,0x33,0x33,0x98,0x98,0xAA,0xBA,0x0B,0x6C,0x27,0x23,0x43,0x42,0x31,0x22,0x30,0x21,0x01,
+0x82,0xB0,0xFF,0x9B,0xB9,0xD9,0xCA,0x0A,0x18,0x11,0x10,0x12,0x12,0xF9,0xAC,0xB9,0xAA,0xCB,0x99,0xA9,0x0A,0xA8,0x38,0x34,0x43,0x42,0x32,0x07,0x13,0x52,0x37,0x24,
+0x23,0x24,0x12,0x22,0x12,0x11,0x08,0x08,0xAB,0xFF,0xCB,0xAA,0xBB,0xBB,0xBC,0xAA,0xBB,0x8A,0x80,0xA8,0x53,0x14,0x43,0x33,0x14,0x03,0xBC,0xBC,0xAD,0xAA,0xCA,0x99,
+0xA9,0x0A,0x0B,0x08,0x48,0x24,0x33,0x34,0x73,0x12,0x72,0x35,0x24,0x23,0x23,0x43,0x21,0x11,0x11,0x80,0x80,0xBA,0xFF,0xAC,0xAA,0xBB,0xBA,0xBB,0xCB,0xAA,0xB9,0x2A,
+0x84,0x36,0x22,0x33,0x23,0x34,0x94,0xAC,0xAD,0xA9,0x9C,0xA9,0x58,0x32,0x52,0x22,0x32,0x13,0x34,0x21,0x51,0x28,0x08,0x08,0x08,0xC0,0x0B,0x0C,0xAC,0xFF,0xBB,0xAB,
+0xAC,0x9B,0xAA,0xAA,0x8A,0x0A,0x08,0x38,0x74,0x47,0x21,0x22,0x22,0x24,0x80,0x90,0xCA,0xBA,0xBA,0x19,0x34,0x43,0x33,0x34,0x23,0x14,0x12,0x23,0x08,0x83,0x80,0x8C,
+0x8C,0x40,0x8B,0x8C,0xFF,0xBC,0xAB,0xAC,0xAA,0xBA,0xB9,0x99,0x8A,0x00,0x88,0x84,0x33,0x34,0x17,0x41,0x21,0x57,0x33,0x32,0x24,0x23,0x12,0x44,0x12,0x01,0x8A,0x9A,
+0xED,0xDA,0xA9,0xBB,0xAA,0xBB,0x11,0x11,0x13,0x12,0x15,0x10,0x04,0x28,0x02,0x02,0x83,0x80,0x8C,0xD0,0xB8,0xC8,0x0C,0xCB,0x0B,0xBC,0x8B,0xDB,0xBB,0xC0,0x0C,0xBB,
+0xC8,0xC0,0xC0,0xB0,0xB8,0x08,0x0D,0xC8,0xC0,0x33,0x27,0x08,0xBA,0xAD,0xAA,0xA0,0x8B,0xC0,0x08,0x08,0x08,0x86,0x40,0x48,0x48,0x38,0x03,0x84,0x34,0x33,0xEF,0xAA,
+0xBA,0x9B,0xAA,0xA0,0x08,0x83,0x34,0x34,0x17,0x47,0x43,0x42,0x22,0x32,0x32,0x23,0x22,0x13,0x21,0x82,0xF0,0xAF,0xBA,0x89,0xAA,0xCA,0xAC,0xBB,0xBA,0xBA,0x0A,0xAA,
+0xB0,0x30,0x08,0x58,0x03,0x34,0x34,0x78,0x10,0x22,0x23,0x26,0x41,0x10,0x22,0x32,0x38,0x04,0x48,0x08,0x03,0x08,0x77,0x33,0x22,0x13,0x22,0xB0,0xCF,0xAA,0xAC,0xAC,
+0xAA,0x2A,0x08,0x08,0x08,0x63,0x20,0xA8,0x9E,0xCB,0xBB,0xBC,0xFB,0xAC,0xAB,0xBB,0xBB,0xBA,0xAB,0x9C,0xA8,0xA0,0x88,0x54,0x36,0x63,0x12,0x32,0x22,0x81,0x09,0xA8,
+0x0A,0x0B,0x3C,0x36,0x34,0x23,0x34,0x22,0xA1,0xFA,0xB9,0xA9,0xB9,0x8C,0x52,0x32,0x22,0x85,0x42,0x23,0xB0,0xBD,0xAE,0xAB,0xBB,0xAB,0x9C,0x0A,0xBA,0x80,0x80,0x04,
+0x03,0x44,0x48,0x32,0x73,0x27,0x24,0x22,0x32,0x22,0xA0,0x99,0xAA,0xAB,0xBB,0xBC,0xBB,0xC8,0xC8,0xC0,0x80,0x64,0x43,0x33,0x42,0x23,0x21,0x83,0x03,0x08,0x08,0xBE,
+0xFB,0x9D,0xBA,0xFB,0xCA,0xAA,0xAA,0xAB,0xB8,0xA9,0x89,0x5A,0x43,0x33,0x26,0x22,0x33,0x98,0xA8,0xBA,0x8A,0x08,0x3C,0x77,0x21,0x21,0x22,0x23,0x21,0x32,0x02,0x83,
+0x80,0x80,0x80,0x8F,0xC0,0x8B,0xBC,0xF0,0xBF,0xAB,0xAB,0x9D,0xA9,0x9B,0xAA,0x42,0x28,0xA8,0xAA,0xB8,0x0C,0xB3,0x48,0x84,0x74,0x26,0x21,0x33,0x42,0x22,0x12,0x23,
+0x21,0x20,0x02,0x43,0x08,0x08,0xD8,0xC0,0xC0,0x8A,0xBB,0x0D,0xBB,0xBC,0xBB,0x8C,0xCB,0xAC,0x8B,0xCB,0x8B,0xBC,0xD0,0xB0,0xB8,0xC8,0xC0,0x0C,0x8B,0x27,0x01,0xF0,
+0xAD,0xBB,0xCA,0xB9,0xB9,0x30,0x41,0x33,0x14,0x25,0x22,0x0A,0x0A,0xA8,0x80,0x08,0x74,0x36,0x32,0x42,0x32,0x23,0x23,0x23,0x15,0x28,0x82,0x83,0x80,0x08,0xD0,0x08,
+0x8C,0xDF,0xAC,0xCA,0xB9,0x9A,0xBB,0xA9,0x8C,0xA9,0x0A,0x45,0x51,0x13,0x22,0x82,0x52,0x01,0xAA,0xDA,0xA9,0x9C,0xAA,0xAA,0xA8,0x08,0x8C,0x80,0x80,0x86,0x43,0x33,
+0x40,0x33,0x44,0x47,0x23,0x24,0x22,0x33,0x08,0x9C,0x9C,0xAC,0xBA,0xC9,0x21,0x21,0x30,0x02,0x43,0x80,0x80,0x80,0xBE,0xC0,0x0C,0xE8,0xDC,0xCB,0xBC,0xCA,0xBA,0xA9,
+0xBA,0xB9,0xA0,0xA0,0x78,0x33,0x34,0x24,0x42,0x31,0x88,0x99,0x08,0x08,0x8B,0x30,0x57,0x24,0x23,0x32,0x14,0x98,0xAA,0x9D,0xCA,0xB8,0x8A,0x16,0x31,0x42,0x21,0x14,
+0x20,0x82,0x83,0xB3,0x08,0xD8,0xCF,0xB9,0xA9,0xDE,0xA9,0xBB,0xBA,0x9A,0x9A,0x8A,0x0A,0x72,0x25,0x23,0x15,0x33,0x12,0x89,0x9A,0x8A,0x8A,0x80,0x3C,0x34,0x43,0x42,
+0x32,0x43,0x33,0x30,0x50,0x48,0x80,0x08,0xCC,0xBB,0xDB,0x8A,0xBB,0xC8,0xC8,0x80,0x80,0x80,0xF0,0x08,0x78,0x15,0x11,0x98,0x8A,0x80,0x03,0x03,0x40,0x80,0xE0,0x0B,
+0xBC,0xBB,0xC8,0x08,0x44,0x48,0x02,0x33,0x44,0x32,0x30,0x40,0x08,0x40,0xD0,0xBB,0xCB,0x9F,0x9A,0xAA,0x8A,0xBB,0xC0,0x08,0x8C,0x80,0x80,0x80,0x80,0x80,0x70,0x61,
+0x33,0x64,0x21,0x26,0x14,0x89,0x99,0xA9,0xD0,0xA0,0xA9,0xDA,0x9C,0x9B,0x9C,0xA9,0xA0,0x0B,0x8B,0xC0,0x80,0x08,0x35,0x40,0x83,0x34,0x40,0x43,0x36,0x42,0x41,0x21,
+0x23,0x20,0x02,0x03,0x48,0x80,0xD0,0xCB,0x9E,0xCA,0xA9,0xAA,0x8A,0x30,0x80,0x80,0x45,0x36,0x82,0xAA,0xBA,0xFB,0x0A,
+};
+
+const ADPCM_Sound_t asteroid_large_explode = {asteroid_large_explode_data,9517,{512,0},6176};
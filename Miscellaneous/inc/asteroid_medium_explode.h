@@ -0,0 +1,107 @@
+/*IMA ADPCM sound, 6345 samples at 6176 Hz. Placeholder derived from asteroid_large_explode (decoded, played 3/2 faster, re-encoded with Tools/adpcm_encoder.c -r 6176) until the original medium explosion is recorded*/
+#include "adpcm.h"
+
+const uint8_t asteroid_medium_explode_data[] = {
+0x00,0x77,0x77,0x77,0x77,0x67,0xA9,0x99,0x1A,0x10,0x11,0x11,0x98,0xB9,0xBA,0xCB,0xBB,0xBB,0xBB,0xBB,0xBB,0xBB,0x9A,0xAB,0x99,0x80,0x22,0x09,0xFF,0xFF,0x0B,0x01,
+0x10,0x11,0x12,0x12,0x22,0x77,0x06,0x89,0x88,0x80,0x42,0x33,0x33,0x14,0xBA,0xCB,0xBB,0x3B,0x44,0x13,0x42,0x11,0x01,0x98,0x99,0xA9,0xAB,0xBB,0xBC,0xFD,0xFF,0x9A,
+0x98,0x09,0x88,0x80,0x08,0x00,0x11,0x32,0x43,0x43,0x32,0x43,0x43,0x22,0x11,0x22,0x12,0x22,0x12,0x12,0x11,0x00,0x90,0x99,0xBA,0xC9,0x6A,0xFB,0xBB,0xAB,0xDB,0x9A,
+0xBB,0x9B,0xFF,0xCF,0x99,0x89,0x33,0x33,0x24,0xA1,0xAE,0xBB,0xAC,0x29,0x22,0x33,0x23,0xED,0xBB,0xBB,0x8A,0x88,0x80,0x80,0x08,0x22,0x42,0x31,0x74,0x77,0x22,0x11,
+0x98,0x99,0x9A,0x0A,0x33,0x24,0x23,0xD1,0xAD,0xBA,0xCA,0xAA,0x9A,0x99,0x09,0x00,0x11,0x33,0x73,0x77,0x22,0x21,0x11,0x08,0x08,0x08,0x98,0x98,0x98,0xB9,0xB9,0xDF,
+0xBA,0xDA,0xAF,0xAB,0x88,0x80,0x80,0x30,0x53,0x32,0x12,0x12,0x01,0x11,0x00,0x08,0x08,0x88,0x98,0x98,0x99,0x01,0x89,0x80,0xFF,0xFF,0x0E,0x00,0x00,0x80,0x01,0x00,
+0x00,0x01,0x10,0x00,0x11,0x57,0x33,0x57,0x81,0x80,0x00,0x08,0x08,0x80,0x9A,0xBB,0xAB,0xBB,0x74,0x13,0xA8,0x98,0x99,0x9A,0xA9,0xA9,0xAA,0xBA,0xBA,0xCA,0xFF,0xFF,
+0x9A,0x00,0x00,0x11,0x10,0x11,0x11,0x00,0x00,0x88,0x98,0x98,0x99,0xA9,0xAA,0xC9,0xFE,0xAF,0x08,0x10,0x00,0x01,0x11,0x62,0x33,0x33,0x33,0xFA,0xBB,0xAA,0x01,0x01,
+0x64,0x33,0x03,0xBB,0xB9,0xBB,0xAB,0x19,0x11,0x21,0x21,0x45,0x35,0x34,0x43,0x33,0x34,0x72,0x17,0x80,0x00,0x08,0x08,0x08,0x08,0x89,0x9A,0xFC,0xBF,0x80,0x10,0x00,
+0xB0,0xBD,0xCB,0xAA,0xAA,0xAA,0x98,0x80,0x10,0x22,0x32,0x73,0x77,0x23,0x21,0x81,0x99,0xAA,0xAA,0x58,0x22,0x23,0x12,0xCD,0xAC,0xBB,0xBA,0xBA,0x9A,0x99,0x08,0x10,
+0x22,0x45,0x22,0x32,0x32,0x24,0x77,0x27,0x11,0x00,0xA9,0xAA,0xBA,0x29,0x32,0x33,0x22,0xFD,0xBA,0xCB,0xAA,0xAA,0xA9,0x98,0x48,0x47,0x22,0x23,0x22,0x11,0x01,0x80,
+0x80,0xAA,0xAD,0xDC,0xCF,0xBA,0x9B,0x80,0x80,0x01,0x01,0x11,0x21,0x21,0x21,0x22,0x22,0x23,0x33,0x76,0x44,0x22,0x23,0x32,0x32,0x23,0x23,0x31,0x12,0x21,0x77,0x06,
+0x08,0x08,0x89,0x99,0xED,0x1A,0x10,0x01,0x98,0x98,0x99,0xA9,0xA9,0x99,0x9B,0xEF,0xAA,0xBB,0xCB,0xBA,0xFE,0x9B,0x80,0x80,0x80,0x08,0x08,0x08,0x11,0x22,0x31,0x24,
+0x32,0x75,0x67,0x00,0x88,0x88,0x88,0x80,0x88,0x00,0x20,0x47,0x22,0x13,0x90,0xA9,0xCB,0xBA,0x48,0x22,0x23,0x13,0x90,0xAB,0xBB,0xCB,0xFD,0xCF,0x9A,0x09,0x00,0x02,
+0x21,0xCA,0xAB,0xAC,0x8A,0x34,0x34,0x43,0x32,0x22,0x21,0x02,0xF9,0xAF,0xAA,0x9A,0x9A,0x89,0x88,0x11,0x76,0x22,0x32,0x22,0x22,0x11,0x11,0x00,0x99,0xBA,0xCB,0xFF,
+0x9D,0x9A,0xA9,0x89,0x88,0x00,0x01,0x11,0x11,0x22,0x34,0x44,0x32,0x43,0x57,0x32,0x02,0x80,0x90,0x99,0xAC,0x2A,0x32,0x12,0x90,0xBA,0xFF,0xAB,0xAB,0x21,0x11,0x22,
+0xB2,0xCF,0xAA,0xAB,0x29,0x43,0x33,0x43,0x21,0x12,0x01,0x98,0xFF,0x9D,0x9A,0x9A,0x88,0x08,0x08,0x58,0x35,0x33,0x33,0x33,0x23,0x12,0x80,0x90,0x9A,0xBB,0xFC,0xFF,
+0xA9,0x99,0x18,0x11,0x22,0x22,0x22,0x22,0x21,0x01,0x01,0x80,0x88,0xA9,0xBA,0xAC,0xEB,0xFC,0xDF,0x99,0x09,0x00,0x00,0x01,0x01,0x11,0x73,0x26,0x21,0x21,0x21,0x10,
+0x80,0x00,0x88,0x89,0xFE,0xAD,0xA9,0x09,0x11,0x22,0x21,0xB0,0xCB,0xAB,0xAB,0x9A,0x89,0x00,0x52,0x77,0x14,0x22,0x81,0xA9,0xAA,0xAA,0xAA,0x9A,0x9A,0x08,0x67,0x33,
+0x22,0x83,0xBB,0xCC,0xBA,0xBA,0xAA,0x9B,0x9A,0x73,0x37,0x22,0x21,0x90,0x98,0x99,0x99,0x99,0x99,0x99,0xCB,0xFF,0xCF,0x99,0x80,0x80,0x08,0x88,0x80,0x80,0x00,0x11,
+0x76,0x22,0x23,0x81,0x98,0xA9,0xA9,0x99,0x99,0x89,0x18,0x77,0x23,0x22,0x81,0xBB,0xCB,0xCA,0x30,0x23,0x22,0x22,0x01,0x00,0x99,0xDB,0xFF,0x9E,0x9A,0x8A,0x99,0x88,
+0x08,0x00,0x11,0x21,0x33,0x77,0x33,0x32,0x22,0x12,0x01,0x00,0xE8,0xAE,0xBA,0xBA,0x18,0x22,0x12,0x12,0x01,0x11,0x08,0xAA,0xFF,0xBF,0x99,0x18,0x11,0x22,0x23,0xB9,
+0xAB,0xBB,0xAB,0x99,0x00,0x21,0x44,0x34,0x53,0x43,0x42,0x23,0x43,0x32,0x77,0x22,0x82,0x00,0x08,0x88,0x98,0x98,0x99,0xAA,0xAB,0xFB,0xFF,0xAA,0x9A,0x9A,0x99,0x88,
+0x80,0x10,0x10,0x22,0x34,0x33,0x34,0x34,0x33,0x43,0x33,0x33,0x77,0x25,0x10,0x80,0x98,0xBB,0xDA,0x19,0x11,0x21,0x10,0xFB,0xBC,0xBA,0xAB,0xAA,0x9B,0x99,0x88,0x00,
+0x12,0x32,0x75,0x57,0x12,0x12,0x99,0xAA,0xB9,0xBA,0xAA,0xAA,0x8A,0x60,0x37,0x22,0x22,0xB8,0xBC,0xAC,0xAB,0xAB,0x9A,0x8A,0x88,0x10,0x32,0x52,0x33,0x44,0x32,0x43,
+0x32,0x43,0x32,0x33,0x32,0x33,0x32,0x72,0x77,0x27,0x00,0x09,0xB8,0xBB,0xBC,0x18,0x11,0x01,0x92,0xDF,0xAA,0xAB,0x0B,0x23,0x33,0x33,0x32,0x13,0x02,0x88,0xA9,0xCA,
+0xBC,0xBC,0xBC,0xBC,0xCA,0xFA,0xFF,0x09,0x08,0x88,0x00,0x21,0x23,0x23,0x33,0x32,0x32,0x22,0x12,0x12,0xF8,0xFF,0x99,0x8A,0x00,0x10,0x00,0x01,0x10,0x11,0x10,0x44,
+0x34,0x34,0x32,0x43,0x32,0x23,0x23,0x32,0x42,0x03,0x91,0x89,0x89,0xBB,0x7C,0x87,0x89,0x99,0xBA,0xAA,0xBB,0xDB,0xB9,0xAA,0xBB,0xBB,0xFF,0xFF,0xA9,0x89,0x00,0x10,
+0x01,0x11,0x10,0x10,0x10,0x80,0x80,0x10,0xB8,0xFF,0x9F,0x88,0x00,0x00,0x00,0x01,0x11,0x01,0x72,0x34,0x32,0x32,0x12,0xA2,0xBD,0xBC,0xBA,0x39,0x43,0x33,0x24,0xD8,
+0xAB,0x9C,0x8B,0x34,0x53,0x32,0x93,0xDB,0xBB,0xAC,0xAA,0x9A,0x88,0x88,0x12,0x32,0x43,0x44,0x77,0x14,0x21,0x01,0x80,0x80,0x88,0x98,0x98,0xA9,0xAA,0xCC,0xBC,0xCB,
+0xEB,0xBE,0xBB,0xAB,0x89,0x80,0x08,0x08,0x18,0x13,0x32,0x43,0x23,0x24,0x36,0x65,0x35,0x33,0x23,0x03,0x01,0x80,0x80,0x98,0xA9,0xA9,0xC9,0xBE,0xBC,0xCB,0xFB,0xBD,
+0xBB,0xBA,0x1A,0x33,0x23,0x33,0xDA,0xBA,0xAB,0x9A,0x11,0x24,0x32,0x33,0x43,0x62,0x34,0x67,0x23,0x33,0x33,0x01,0x80,0x80,0x80,0xEC,0xBC,0xBC,0x0A,0x11,0x11,0x21,
+0xEA,0xBB,0xCB,0xBA,0xBB,0x9A,0x99,0x00,0x21,0x33,0x45,0x73,0x47,0x22,0x21,0x90,0xA9,0xBA,0xAA,0xAB,0xAA,0x9A,0x59,0x47,0x22,0x23,0x21,0x01,0x00,0x99,0xFE,0xAC,
+0xBA,0xAA,0xAB,0xAA,0x99,0x88,0x18,0x11,0x33,0x77,0x25,0x22,0x22,0x21,0x11,0x01,0x80,0x98,0xAA,0xCA,0xCB,0xBB,0xBC,0xAC,0xAC,0xBA,0xBA,0xAC,0xAA,0xAB,0x8C,0x90,
+0xB9,0xCB,0x99,0xFB,0xFF,0x09,0x01,0x10,0x01,0x11,0x52,0x34,0x43,0x22,0x22,0x21,0x11,0x02,0x00,0x80,0x88,0x99,0xAA,0xBB,0xBC,0xEB,0xFF,0xAF,0x9A,0x19,0x22,0x32,
+0x32,0x33,0x33,0x32,0x11,0x10,0x88,0x88,0xBA,0xFF,0xCF,0x99,0x99,0x88,0x80,0x00,0x72,0x33,0x33,0x33,0x98,0xB9,0xB9,0x0A,0x37,0x32,0x33,0x21,0x81,0xA9,0xAC,0xBB,
+0xCB,0xAA,0xAC,0xFF,0xAF,0x99,0x8A,0x11,0x10,0x22,0x11,0x12,0x02,0x11,0x00,0x80,0x98,0x9A,0xBA,0xCA,0xAC,0xDB,0xFF,0x9E,0x99,0x88,0x08,0x08,0x00,0x11,0x11,0x32,
+0x34,0x35,0x42,0x23,0x43,0x32,0x32,0x33,0x77,0x22,0x02,0x00,0x08,0x98,0x98,0x99,0xA9,0xBA,0xBB,0xBC,0xBA,0xFA,0xBE,0xBB,0xCB,0xAA,0xBA,0xFF,0xAB,0x89,0x80,0x08,
+0x28,0x33,0x93,0xAA,0x9A,0x08,0x32,0x34,0x24,0x33,0x63,0x34,0x34,0x74,0x34,0x33,0x43,0x91,0xA9,0xAA,0xBA,0xAB,0xBA,0xAB,0x18,0x77,0x22,0x21,0xA1,0xBC,0xCB,0xBB,
+0x29,0x23,0x32,0x23,0x12,0x00,0xA8,0xCB,0xCC,0xCB,0xAC,0xBC,0xBB,0xDB,0xAA,0xFE,0xAC,0xAA,0x09,0x08,0x88,0x80,0x01,0x73,0x35,0x33,0x33,0x32,0x32,0x21,0xFA,0xBB,
+0xAC,0xBA,0xA9,0x89,0x00,0x20,0x22,0x25,0x24,0x74,0x26,0x22,0x22,0x11,0x80,0x80,0x90,0xFC,0xCA,0xAA,0xAB,0x9A,0xA9,0xA9,0x89,0x88,0x10,0x20,0x14,0x33,0x53,0x33,
+0x43,0x42,0x33,0x72,0x57,0x12,0x12,0x98,0xBA,0xAC,0xBB,0x20,0x22,0x21,0x01,0x80,0xB9,0xDA,0xDB,0xBB,0xBB,0xCD,0xEF,0xBA,0xAB,0x0A,0x08,0x21,0x43,0x32,0x32,0x23,
+0x23,0x23,0x22,0x21,0x81,0xFB,0xFF,0x9C,0x89,0x12,0x32,0x33,0x33,0x33,0x33,0x23,0x12,0x01,0x11,0xA8,0xFF,0xBF,0xAA,0x8A,0x12,0x32,0x33,0x94,0x9A,0x9A,0x9A,0x71,
+0x26,0x32,0x22,0x13,0x22,0x11,0x90,0xEF,0xAA,0xAA,0x9A,0x9A,0x99,0x88,0x01,0x01,0x32,0x73,0x57,0x12,0x22,0x81,0xAA,0xBA,0xDB,0x29,0x22,0x22,0x13,0x11,0x81,0xA8,
+0xEA,0xFF,0xBB,0xAA,0xAB,0xB9,0x99,0x88,0x70,0x24,0x23,0x14,0x22,0x11,0x10,0x80,0x81,0xA9,0xDA,0xFB,0xAF,0xAB,0xAA,0xA9,0x89,0x08,0x00,0x73,0x26,0x23,0x22,0x22,
+0x21,0x11,0xD0,0xAC,0xCB,0xAA,0x9A,0x9A,0x89,0x10,0x57,0x23,0x43,0x21,0x22,0x12,0x80,0xD9,0xBF,0xAB,0xBA,0xAA,0xA9,0x98,0x08,0x10,0x12,0x44,0x32,0x43,0x43,0x33,
+0x33,0x33,0x25,0x32,0x22,0x23,0x21,0x42,0x76,0x47,0x01,0x88,0x98,0x98,0x99,0x99,0xFB,0xAF,0xAA,0x00,0x08,0x10,0x80,0xBC,0xBB,0xBB,0xAA,0x9A,0x88,0x10,0x22,0x44,
+0x43,0x43,0x77,0x23,0x22,0x02,0x99,0xBA,0xAA,0x3A,0x34,0x33,0x25,0x01,0x90,0xA8,0xAA,0xFF,0x9E,0x9A,0xA9,0x89,0x89,0x88,0x10,0x11,0x22,0x24,0x76,0x22,0x23,0x22,
+0x12,0x21,0x80,0x80,0xA9,0xBA,0xCB,0xBC,0xBC,0xDB,0x9A,0xDF,0xBB,0xBB,0x9B,0x22,0x23,0x34,0x33,0x33,0x33,0x23,0x23,0x31,0x21,0x81,0xFF,0xCF,0xA9,0x98,0x89,0x80,
+0x10,0x51,0x27,0x32,0x32,0x91,0x99,0xA9,0x99,0x88,0x88,0x9A,0x48,0x77,0x22,0x21,0xA1,0xAA,0xCB,0xAA,0xAB,0xAB,0x89,0x09,0x77,0x22,0x12,0x92,0xBB,0xBC,0xBB,0x3A,
+0x43,0x22,0x02,0x00,0x98,0xAA,0xCD,0xFF,0x9A,0x9B,0x0B,0x10,0x12,0x22,0xB8,0xBD,0xAA,0xAA,0x8A,0x09,0x30,0x34,0x34,0x44,0x33,0x74,0x27,0x12,0x22,0x90,0x9A,0x9A,
+0xAB,0x33,0x43,0x32,0xB2,0xCF,0xAB,0xCA,0xBA,0xAB,0xAA,0x89,0x89,0x10,0x20,0x24,0x77,0x16,0x12,0x11,0x11,0x00,0x80,0xF9,0xAB,0xBB,0xAC,0x00,0x11,0x22,0x01,0xBE,
+0xBA,0xCB,0x29,0x43,0x43,0x43,0x21,0x00,0x81,0x80,0xDF,0xBB,0xAB,0x8B,0x33,0x34,0x43,0x92,0xBB,0xBB,0x9C,0x8A,0x09,0x10,0x33,0x35,0x35,0x43,0x43,0x14,0x33,0x33,
+0x43,0x32,0x22,0x43,0x77,0x24,0x11,0x01,0xBB,0xBC,0xBC,0x9A,0x12,0x11,0x02,0x81,0x80,0xB9,0xDB,0xCB,0xDB,0xBB,0xFB,0xBF,0xAB,0xBB,0xBA,0x99,0x99,0x00,0x21,0x33,
+0x35,0x34,0x35,0x24,0x22,0x22,0x23,0x24,0x33,0x74,0x26,0x23,0x22,0xB0,0xBA,0xCB,0xAB,0xBB,0xAC,0xA9,0x9A,0x89,0x89,0x80,0x00,0x01,0x12,0x22,0x77,0x77,0x11,0x10,
+0x00,0x01,0x98,0xAA,0xBA,0xAC,0xBB,0xEE,0xBB,0xCB,0xAA,0x9A,0x8A,0x09,0x10,0x47,0x33,0x33,0x83,0x99,0x99,0xA9,0x70,0x24,0x32,0x22,0xC8,0xBA,0xBB,0xAB,0xBB,0x08,
+0x81,0x88,0x10,0x21,0x36,0x43,0x63,0x22,0x33,0x24,0x33,0x42,0x73,0x57,0x12,0x12,0x91,0xBB,0xBC,0xCB,0x18,0x11,0x12,0x91,0xCF,0xBB,0xBB,0x8C,0x12,0x12,0x43,0xD0,
+0xBC,0xBB,0xCB,0x30,0x32,0x34,0x12,0xBC,0xBC,0xAB,0x3B,0x37,0x33,0x24,0xA1,0xBB,0xAC,0xAB,0xA9,0x89,0x08,0x31,0x77,0x17,0x21,0x00,0x99,0x99,0x99,0x30,0x24,0x21,
+0x02,0xFB,0xBA,0xAB,0x0C,0x22,0x24,0x22,0x22,0x12,0x03,0x90,0xFA,0xFF,0x99,0x99,0x99,0x88,0x88,0x80,0x01,0x21,0x22,0x73,0x37,0x22,0x23,0x90,0xA9,0xBB,0xBC,0xAA,
+0xAA,0x9A,0x98,0x88,0x10,0x02,0x74,0x77,0x21,0x11,0x01,0x00,0x00,0x89,0x9A,0xBA,0xCB,0xFB,0xAF,0xAA,0xBA,0xA9,0x99,0x89,0x09,0x10,0x33,0x32,0x32,0x34,0x25,0x43,
+0x33,0x53,0x32,0x33,0x43,0x22,0x43,0x23,0x32,0x23,0x32,0x30,0x10,0x92,0x00,0x70,0x77,0x37,0x11,0xB9,0xCB,0xCB,0xAA,0x10,0x10,0x13,0x88,0xA9,0xBB,0xDB,0xFE,0xBB,
+0xAC,0xAA,0x10,0x21,0x22,0x23,0xAC,0xCB,0x9A,0x39,0x47,0x32,0x42,0x90,0xA9,0xAA,0x9A,0x99,0x09,0x11,0x41,0x23,0x44,0x45,0x72,0x43,0x22,0x23,0xA0,0xBA,0xAC,0xAB,
+0xAB,0xAB,0x9A,0x8A,0x00,0x01,0x32,0x53,0x77,0x37,0x11,0xA8,0xA9,0xBA,0xAB,0x22,0x32,0x12,0x12,0x00,0xB9,0xBA,0xB9,0xDF,0xCC,0xBA,0xBB,0xAC,0xBB,0xCA,0xEF,0xAA,
+0x9A,0x99,0x09,0x00,0x10,0x32,0x44,0x42,0x33,0x57,0x32,0x32,0x13,0x98,0xA8,0xA9,0x29,0x26,0x22,0x22,0x22,0x12,0xA9,0xBC,0xFF,0xAC,0xAA,0x8A,0x11,0x11,0x21,0x21,
+0x11,0x11,0x01,0x80,0x98,0xBA,0xDA,0xC9,0xBB,0xBB,0x9D,0xBB,0xAB,0xAD,0x99,0xBA,0xB9,0xA9,0xCB,0x54,0x81,0xCA,0xFF,0xBF,0x99,0x88,0x09,0x00,0x12,0x74,0x43,0x32,
+0x32,0x22,0x22,0x12,0x82,0xAD,0xAC,0xAB,0xBA,0xA9,0x99,0x09,0x18,0x21,0x31,0x24,0x77,0x26,0x22,0x81,0xAA,0xBB,0xCB,0xAB,0xBA,0xAA,0xAA,0x72,0x24,0x23,0x22,0xCB,
+0xBC,0xBB,0xAC,0xAB,0xBA,0x99,0x79,0x35,0x22,0x23,0x12,0x11,0x08,0xA9,0xFF,0x9D,0x9A,0x89,0x10,0x00,0x11,0xB8,0xBD,0xBA,0xAA,0x62,0x23,0x34,0x12,0x9A,0xBA,0xAB,
+0x7B,0x34,0x33,0x25,0x21,0x12,0x11,0x81,0xFB,0xAF,0xA9,0xA9,0x99,0x98,0x08,0x22,0x01,0x01,0x23,0x34,0x43,0x34,0x62,0x56,0x22,0x23,0x03,0xAB,0xAA,0xAC,0xAB,0xBB,
+0xB9,0xAA,0x99,0x89,0x08,0x08,0x11,0x22,0x32,0x53,0x11,0x06,0x08,0x73,0x77,0x17,0x00,0x80,0x80,0x98,0x99,0xAA,0xAA,0xAC,0xFB,0xBD,0xBA,0xBA,0x19,0x21,0x23,0x33,
+0xCA,0xCB,0xAA,0x9A,0x98,0x10,0x22,0x74,0x57,0x22,0x22,0x91,0x88,0xA8,0xBA,0xAA,0x8A,0x99,0x00,0x20,0x22,0x44,0x73,0x57,0x22,0x22,0x11,0x01,0x00,0x88,0xAA,0xBA,
+0xCC,0xCA,0xBB,0xCB,0xBB,0xFD,0xAC,0xBA,0xAA,0x28,0x31,0x53,0x83,0xBA,0xBB,0xAB,0x3A,0x57,0x32,0x33,0x91,0xAA,0xAA,0x9A,0x88,0x00,0x22,0x53,0x33,0x36,0x33,0x74,
+0x27,0x23,0x22,0xA0,0xAA,0xBB,0xAC,0xBB,0xBA,0x8A,0x98,0xCB,0xBA,0x99,0x70,0x47,0x13,0x22,0x12,0x10,0x98,0xA9,0xAA,0xEB,0xBA,0xBC,0xAC,0xAC,0xCB,0xAA,0xBB,0xCA,
+0xB9,0xAA,0xAB,0xAB,0x9A,0x9A,0x9A,0x9A,0xE5,0xFF,0xBB,0xAA,0x38,0x44,0x32,0x43,0x32,0x33,0x33,0x04,0xBA,0xAA,0xA9,0x79,0x35,0x24,0x23,0x33,0x32,0x12,0x02,0xED,
+0xBA,0xBB,0x8B,0x42,0x42,0x22,0x91,0xCA,0xDC,0xBA,0x28,0x42,0x22,0x32,0x12,0x11,0x01,0xEA,0xDF,0xAA,0xAB,0x19,0x32,0x22,0x33,0xF8,0xAA,0xBB,0x9A,0x44,0x52,0x21,
+0x12,0x12,0x01,0x91,0x98,0x09,0xA8,0xED,0xBB,0x7C,0x15,0x00,0x98,0xA8,0xAB,0xCB,0xAB,0xBC,0xAA,0xFB,0xAD,0xAA,0x9A,0x21,0x42,0x32,0x43,0x23,0x23,0x23,0x23,0xF9,
+0xEF,0x88,0x00,0x10,0x22,0x12,0x99,0x99,0x88,0x00,0x20,0x42,0x53,0x72,0x14,0x42,0x22,0x11,0x01,0xBB,0xCB,0xAC,0x9B,0x01,0x01,0x00,0x08,0x99,0x99,0xAB,0xBD,0xFF,
+0xEF,0x08,0x89,0x88,0x88,0x10,0x12,0x33,0x23,0x03,0x00,0x00,0x10,0x55,0x33,0x34,0x13,0x8A,0x9A,0xAA,0xAA,0x99,0x99,0x09,0x08,0x20,0x40,0x32,0x77,0x37,0x02,0x82,
+0x99,0xDB,0xAC,0xBB,0xAB,0xBB,0x9A,0x61,0x32,0x23,0x13,0xCC,0xCB,0xAB,0x8A,0x24,0x23,0x33,0x21,0x12,0x88,0xDA,0xC8,0xBA,0xAE,0xCA,0xEF,0xAA,0x9A,0xAA,0x89,0x00,
+0x81,0x09,0x28,0x22,0x63,0x57,0x23,0x33,0x33,0x32,0x12,0x22,0x11,0x88,0xA0,0xA9,0xFF,0xBC,0xBB,0xAA,0x10,0x23,0x43,0x22,0x31,0x12,0x11,0x91,0x99,0x71,0x91,0xFF,
+0xAC,0x9A,0xAA,0x99,0x88,0x00,0x20,0x22,0x34,0x43,0x35,0x42,0x32,0x33,0x57,0x22,0x23,0x23,0x21,0x00,0x88,0xD8,0xBF,0xBB,0xCB,0xBA,0xAA,0x9A,0x88,0x44,0x31,0x12,
+0x83,0xBD,0xBC,0xAB,0x3B,0x34,0x34,0x23,0xD0,0xAA,0xAC,0xBB,0x34,0x35,0x32,0x32,0x22,0x11,0x00,0xA9,0xB9,0xBD,0xAC,0xFC,0xCF,0xAA,0x89,0x12,0x11,0x10,0x12,0x12,
+0x22,0x21,0x11,0x20,0x08,0x88,0xFB,0xFF,0x9C,0x98,0x88,0x08,0x10,0x50,0x35,0x24,0x33,0x22,0x22,0x01,0x00,0x88,0x99,0xC9,0xAA,0x8A,0xA8,0xCF,0xBC,0xBA,0xAA,0xBA,
+0xAA,0xB9,0xA9,0xB8,0xFF,0xAD,0x8A,0x09,0x53,0x33,0x43,0x82,0x98,0x99,0x99,0x72,0x24,0x33,0x43,0x11,0x12,0x01,0xA8,0xDF,0x99,0xCB,0x8A,0x11,0x10,0x21,0xE8,0xAB,
+0xAA,0x9C,0x99,0x88,0x29,0x23,0x33,0x35,0x33,0x77,0x33,0x24,0x22,0x12,0x01,0x80,0xA9,0xEF,0xAA,0xAB,0xBB,0xB9,0x8A,0x90,0x31,0x43,0x34,0x23,0xDB,0xCB,0xAB,0xAB,
+0xB9,0x99,0x80,0x52,0x32,0x53,0x14,0x66,0x43,0x22,0x22,0x11,0x11,0x08,0xA9,0xFF,0xA9,0x9A,0xAA,0x9A,0xA9,0x10,0x53,0x31,0x22,0x13,0xDB,0xAB,0xAC,0x1A,0x25,0x24,
+0x23,0x42,0x11,0x03,0x81,0x80,0xB0,0x9A,0xFB,0xFF,0xA9,0x9A,0xA9,0x99,0x08,0x08,0x61,0x26,0x22,0x32,0x81,0xA8,0xAC,0x9A,0x33,0x43,0x43,0x22,0x21,0x01,0x01,0x98,
+0x8B,0xB3,0xCA,0xFF,0xAF,0x9A,0x99,0x99,0x88,0x80,0x01,0x21,0x14,0x23,0x67,0x23,0x33,0x22,0x43,0x12,0x99,0xDA,0xCD,0xBA,0xAB,0x0A,0x11,0x02,0x13,0x21,0x20,0x11,
+0x02,0xA8,0xC8,0xB9,0x8D,0x9E,0xB9,0xA9,0x9D,0xB9,0xB9,0xA9,0xAB,0xCB,0xA9,0xA9,0x9D,0x57,0x80,0xCB,0x9A,0xA9,0xA0,0x08,0x28,0x21,0x43,0x33,0x26,0x42,0x85,0xCF,
+0xAA,0x9A,0x98,0x10,0x21,0x44,0x66,0x43,0x23,0x23,0x23,0x21,0x11,0xA1,0xCF,0x8B,0xA9,0xCB,0xBB,0xBA,0x89,0x99,0x18,0x18,0x13,0x34,0x41,0x32,0x44,0x24,0x12,0x33,
+0x31,0x12,0x21,0x92,0x77,0x25,0x11,0x01,0xBC,0xDB,0xAB,0x9B,0x81,0x80,0x32,0x82,0xBE,0xBD,0xCB,0xCD,0xBB,0xBB,0xAB,0xBA,0x98,0x89,0x72,0x44,0x14,0x22,0x81,0x90,
+0x89,0x89,0x44,0x33,0x33,0x03,0xDB,0xBB,0xD9,0x39,0x24,0x23,0x61,0x82,0xDB,0xAC,0xBB,0xAA,0x8A,0x8A,0x00,0x12,0x33,0x63,0x72,0x37,0x22,0x22,0x90,0xA8,0xA9,0xAA,
+0xAA,0xA9,0xA9,0x70,0x44,0x23,0x14,0x12,0x00,0x00,0xBB,0xDE,0xBA,0xBE,0xAC,0xAB,0xA9,0x99,0x28,0x35,0x34,0x32,0x91,0xB9,0x89,0x98,0x57,0x22,0x32,0x12,0x23,0x11,
+0x08,0x88,0x8A,0xCB,0xAC,0xFD,0x9F,0xAA,0xA8,0x9A,0x20,0x80,0x8A,0x9A,0x91,0x32,0x71,0x47,0x32,0x22,0x12,0x12,0x11,0x21,0x00,0x98,0x99,0xAC,0xDA,0xB9,0xBC,0xAB,
+0xDA,0xAB,0xDA,0xA9,0xA9,0xAA,0x9B,0xBD,0x2A,0x27,0xF0,0xAF,0x9A,0xAA,0x28,0x32,0x32,0x25,0x98,0x88,0x88,0x30,0x77,0x21,0x22,0x21,0x21,0x11,0x01,0x81,0x08,0x89,
+0xBA,0xFF,0xBB,0xBA,0xAA,0xBA,0xB8,0x50,0x53,0x13,0x83,0x14,0xA9,0xBB,0xAC,0xBB,0x99,0xA8,0x80,0x30,0x73,0x14,0x33,0x74,0x25,0x23,0x22,0xA8,0xBB,0xAD,0x9A,0x12,
+0x31,0x21,0x82,0x08,0xAC,0xBC,0xF0,0xCF,0xCB,0xBA,0xAA,0xAA,0x89,0x19,0x26,0x24,0x32,0x02,0x99,0x00,0x8A,0x62,0x35,0x32,0x13,0xA9,0xAC,0x9C,0x1B,0x24,0x24,0x33,
+0x31,0x20,0x91,0x88,0xEF,0x9A,0xCD,0xBA,0xAB,0x9A,0x99,0x38,0x37,0x33,0x34,0x81,0xA9,0x98,0x98,0x41,0x32,0x43,0x43,0x12,0x11,0x03,0x98,0xCE,0xBA,0xB9,0xAA,0x8B,
+0x80,0xB0,0x9B,0x77,0x15,0x99,0x08,0x02,0x11,0x90,0x9C,0xAD,0x9A,0x40,0x31,0x32,0x45,0x12,0x21,0x28,0xE1,0xBB,0xAE,0xAA,0xAA,0x9B,0x99,0x0A,0x08,0x08,0x08,0x73,
+0x27,0x34,0x55,0x92,0x99,0x99,0x9A,0xCA,0xAD,0xBA,0x9A,0xA9,0x99,0x89,0x28,0x34,0x14,0x33,0x55,0x25,0x33,0x33,0x22,0x21,0x20,0xA0,0xFD,0xBA,0xAB,0xAB,0x21,0x08,
+0x72,0x06,0xA8,0xB9,0x0B,
+};
+
+const ADPCM_Sound_t asteroid_medium_explode = {asteroid_medium_explode_data,6345,{512,0},6176};
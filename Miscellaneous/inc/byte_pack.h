@@ -0,0 +1,46 @@
+/**
+*@file byte_pack.h
+*@brief provide CRC-16 and little endian packing of values into byte arrays
+*
+*This header file provide functions shared by records which are written as bytes (telemetry packets, save store slots in EEPROM):
+*CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF, no reflection, no final xor), computed bitwise so that no table is kept
+*in flash, and writing or reading 1 to 4 bytes values in little endian.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef BYTE_PACK_H
+#define BYTE_PACK_H
+
+#include <stdint.h>
+
+#define BYTE_PACK_CRC_INITIAL_VALUE	0xFFFF
+#define BYTE_PACK_CRC_POLYNOMIAL	0x1021
+
+/**
+*@brief 	CRC-16/CCITT-FALSE of bytes
+*@param 	Pointer to bytes
+*@param 	Number of bytes
+*@return 	CRC ("123456789" give 0x29B1)
+*/
+uint16_t byte_pack_crc16 (const uint8_t *dataPtr, uint16_t length);
+
+/**
+*@brief 	Write value in little endian
+*@param 	Pointer to first byte
+*@param 	Value
+*@param 	Number of bytes (1 to 4, higher bytes of value are dropped)
+*@return 	Pointer to byte after value
+*/
+uint8_t* byte_pack_put_value (uint8_t *bytePtr, uint32_t value, uint8_t numOfBytes);
+
+/**
+*@brief 	Read value in little endian
+*@param 	Pointer to first byte
+*@param 	Number of bytes (1 to 4)
+*@return 	Value
+*/
+uint32_t byte_pack_get_value (const uint8_t *bytePtr, uint8_t numOfBytes);
+
+#endif
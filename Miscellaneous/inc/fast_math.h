@@ -0,0 +1,38 @@
+/**
+*@file fast_math.h
+*@brief provide integer arctangent and square root without math library
+*
+*This header file provide integer functions cheap enough to be called every frame on MCU without FPU work or math library.
+*Angles are binary angles: a turn is FAST_MATH_ANGLE_TURN, 0 along positive x axis, counter-clockwise toward positive y axis.
+*fast_atan2 fold (x, y) into first octant and interpolate a 65 entries table of arctangent of 0 to 1 (error below 1.5 binary angle,
+*0.008 degree), one division per call.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef FAST_MATH_H
+#define FAST_MATH_H
+
+#include <stdint.h>
+
+#define FAST_MATH_ANGLE_TURN		65536UL	/*binary angle of a turn (angle wrap around with uint16_t)*/
+#define FAST_MATH_ANGLE_QUARTER		16384
+#define FAST_MATH_ANGLE_HALF		32768
+
+/**
+*@brief 	Angle of vector (x, y)
+*@param 	y
+*@param 	x
+*@return 	Binary angle (refer to FAST_MATH_ANGLE_TURN), 0 when x and y are 0
+*/
+uint16_t fast_atan2 (int32_t y, int32_t x);
+
+/**
+*@brief 	Integer square root (rounded down)
+*@param 	Value
+*@return 	Square root
+*/
+uint16_t fast_sqrt (uint32_t value);
+
+#endif
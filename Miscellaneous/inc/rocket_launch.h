@@ -1 +1,1046 @@
-const uint16_t rocket_launch[] = {2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2048,2048,2047,2047,2047,2048,2047,2047,2047,2048,2048,2048,2047,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2050,2050,2050,2050,2051,2051,2050,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2050,2050,2050,2051,2051,2050,2050,2050,2050,2050,2051,2051,2050,2051,2051,2051,2051,2050,2050,2050,2050,2051,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2051,2051,2050,2050,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2051,2050,2050,2051,2051,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2051,2050,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2050,2050,2050,2050,2051,2051,2050,2051,2051,2051,2051,2050,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2049,2049,2049,2049,2049,2049,2049,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2048,2049,2049,2049,2049,2049,2048,2048,2049,2048,2048,2049,2049,2049,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2049,2049,2049,2049,2048,2048,2049,2049,2048,2048,2049,2048,2048,2048,2049,2048,2048,2049,2049,2048,2049,2049,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2049,2049,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2047,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2047,2047,2047,2048,2048,2049,2049,2049,2048,2049,2050,2049,2048,2047,2047,2049,2051,2050,2049,2049,2050,2050,2050,2049,2047,2046,2045,2045,2047,2049,2049,2048,2046,2046,2047,2049,2049,2047,2045,2045,2047,2050,2052,2052,2050,2046,2043,2042,2044,2046,2046,2044,2041,2042,2045,2048,2048,2046,2044,2045,2048,2051,2053,2052,2050,2048,2048,2050,2051,2051,2050,2049,2049,2050,2050,2050,2049,2047,2046,2044,2044,2046,2047,2048,2048,2047,2047,2048,2049,2050,2049,2049,2049,2051,2054,2057,2057,2055,2051,2049,2050,2054,2055,2052,2048,2045,2046,2047,2044,2039,2034,2034,2037,2044,2049,2053,2053,2051,2047,2044,2046,2050,2052,2050,2047,2046,2049,2052,2052,2049,2044,2040,2037,2037,2040,2044,2047,2046,2044,2043,2049,2056,2057,2051,2044,2043,2048,2052,2050,2047,2045,2046,2048,2049,2048,2047,2047,2047,2047,2049,2051,2053,2050,2045,2044,2047,2051,2051,2048,2046,2049,2051,2048,2044,2041,2043,2048,2053,2052,2049,2048,2050,2051,2049,2049,2051,2052,2052,2050,2048,2048,2049,2049,2047,2045,2044,2047,2051,2054,2053,2050,2049,2051,2050,2049,2051,2052,2048,2047,2052,2055,2052,2050,2052,2051,2048,2048,2051,2053,2054,2052,2048,2045,2046,2047,2045,2047,2051,2053,2051,2048,2043,2038,2043,2049,2043,2035,2039,2048,2051,2054,2057,2054,2046,2045,2048,2050,2048,2044,2043,2044,2048,2049,2047,2050,2052,2049,2043,2044,2047,2047,2051,2054,2051,2049,2053,2054,2048,2044,2041,2038,2041,2046,2047,2044,2040,2035,2037,2048,2054,2050,2048,2049,2046,2044,2044,2044,2045,2051,2057,2056,2051,2051,2058,2058,2049,2041,2039,2040,2038,2041,2070,2139,2206,2213,2165,2113,2092,2102,2126,2119,2056,1980,1948,1962,1997,2028,2025,1977,1915,1882,1901,1961,2019,2029,1988,1943,1945,1996,2059,2095,2089,2051,2016,2025,2063,2084,2080,2077,2080,2088,2107,2127,2135,2138,2141,2138,2134,2128,2116,2102,2089,2069,2048,2033,2015,1982,1946,1920,1916,1938,1968,1971,1954,1948,1972,2022,2065,2068,2043,2024,2029,2058,2096,2110,2091,2061,2033,2010,2006,2013,2011,1999,1981,1965,1969,2000,2024,2019,2009,2018,2035,2049,2065,2084,2097,2094,2088,2097,2112,2110,2104,2109,2115,2123,2133,2131,2118,2100,2076,2060,2061,2059,2043,2025,2012,2001,1999,2012,2022,2020,2021,2026,2025,2026,2026,2018,2025,2048,2060,2065,2065,2044,2026,2040,2065,2078,2080,2074,2076,2084,2085,2079,2081,2089,2095,2092,2081,2079,2087,2090,2080,2067,2054,2038,2030,2039,2045,2042,2047,2055,2041,2026,2035,2046,2046,2051,2051,2032,2016,2015,2019,2033,2044,2033,2014,2008,2012,2016,2013,2004,2004,2006,2001,1999,2005,2016,2033,2032,2005,2003,2036,2059,2056,2053,2061,2074,2082,2091,2094,2078,2066,2079,2086,2068,2045,2023,2015,2024,2032,2044,2057,2051,2039,2038,2038,2045,2051,2038,2023,2016,2004,2002,2021,2034,2036,2034,2025,2018,2025,2045,2062,2061,2048,2040,2047,2072,2091,2074,2049,2050,2060,2062,2061,2054,2049,2054,2059,2060,2063,2065,2057,2047,2049,2064,2077,2076,2064,2054,2061,2081,2090,2081,2062,2049,2065,2086,2079,2066,2063,2052,2046,2060,2069,2060,2055,2056,2048,2031,2028,2041,2051,2047,2038,2034,2038,2039,2035,2046,2058,2044,2028,2035,2043,2044,2053,2057,2050,2051,2061,2066,2066,2065,2065,2065,2062,2054,2050,2048,2044,2046,2049,2038,2027,2031,2031,2022,2018,2028,2037,2038,2036,2038,2039,2041,2051,2057,2050,2043,2040,2042,2049,2043,2031,2034,2038,2036,2037,2031,2022,2026,2031,2033,2037,2032,2021,2016,2016,2027,2044,2043,2034,2032,2028,2031,2042,2048,2051,2047,2035,2033,2044,2054,2061,2061,2052,2049,2049,2050,2057,2058,2051,2049,2050,2051,2058,2058,2048,2045,2049,2052,2055,2052,2043,2040,2045,2050,2051,2048,2045,2043,2046,2054,2056,2051,2051,2056,2054,2049,2050,2052,2051,2052,2056,2056,2054,2053,2048,2042,2040,2042,2045,2049,2050,2049,2054,2064,2067,2062,2056,2055,2055,2057,2061,2058,2050,2052,2059,2060,2058,2059,2062,2063,2060,2055,2048,2041,2040,2047,2056,2054,2040,2031,2037,2043,2047,2052,2043,2025,2036,2062,2056,2034,2038,2050,2040,2033,2033,2019,2015,2043,2063,2045,2023,2013,2010,2032,2072,2090,2081,2065,2052,2051,2051,2032,2029,2075,2104,2075,2057,2073,2083,2111,2174,2183,2120,2079,2069,2049,2053,2073,2035,1998,2054,2134,2140,2109,2076,2038,2015,2005,1989,1988,1984,1945,1941,2025,2095,2084,2061,2052,2049,2093,2140,2092,2023,2034,2043,2022,2072,2134,2082,2000,1983,1959,1924,1979,2107,2216,2242,2152,2032,2039,2141,2169,2108,2044,1998,1981,1988,1956,1946,2067,2172,2108,2016,1990,1925,1895,2027,2134,2054,1961,1950,1917,1869,1881,1928,1999,2078,2044,1898,1869,2042,2240,2320,2239,2061,1983,2015,1975,1940,2051,2124,2059,2046,2064,1947,1866,2013,2165,2130,2059,2052,2068,2166,2294,2226,2022,1952,1995,2012,1996,1928,1849,1844,1872,1951,2136,2198,1965,1774,1897,2027,1940,1859,1837,1773,1893,2275,2475,2309,2112,2010,1938,2044,2236,2189,1994,1915,1980,2105,2132,2061,2103,2200,2147,2052,2075,2098,1975,1915,2094,2194,2088,2070,2035,1880,1982,2215,2103,1899,1955,2059,2078,2060,1975,1926,1981,2069,2183,2180,2007,1978,2190,2390,2354,2108,2101,2350,2250,1962,1878,1747,1804,2197,2236,1924,1854,2012,2107,1976,1851,2004,2071,1930,2004,2242,2277,2106,2062,2253,2299,2140,2153,2289,2181,1854,1872,2469,3118,3355,2788,1466,790,1541,2715,3336,2982,1894,997,638,648,712,468,330,536,488,237,156,125,258,628,698,348,224,317,179,191,402,405,463,418,301,1076,2425,3092,2656,1534,741,669,1275,2291,2182,1100,871,793,219,100,194,389,601,301,348,665,279,53,703,1966,2808,2153,1731,2647,2716,1718,1228,1086,883,660,525,533,314,186,451,386,188,400,253,0,1012,2486,2506,1568,763,698,1977,2802,1954,2049,3267,2977,1734,961,572,501,432,348,474,1058,2400,3085,2646,2965,3584,3402,3396,3290,2797,3153,3873,3350,2033,1626,1802,1202,660,807,739,483,303,772,2205,3005,3169,3715,3726,3640,4026,3958,4094,4021,2670,1903,2021,1547,1054,833,847,1366,1267,555,722,1318,1258,887,652,609,691,463,124,193,128,105,468,25,0,1288,1744,1118,1614,1590,819,1551,2866,2932,1962,1782,2695,2184,1512,3110,3479,1842,2035,3211,3361,3566,3966,3550,2258,1291,1212,1216,1294,1187,622,696,701,203,871,1505,1059,1513,2554,3069,3635,3866,3567,3497,3761,3990,3935,4061,4042,2822,1981,2787,3317,3291,3628,3172,2393,3022,3693,3428,3669,3715,2540,2196,3162,3622,3615,3653,3555,3590,3590,3495,3668,3543,2667,1698,1254,1238,1787,3007,3230,2061,2118,3238,3381,3415,3253,2009,1571,2480,3009,2940,3125,3439,2772,1768,1983,1948,1191,1949,3078,2581,1747,1377,1353,1905,2655,3366,3618,3014,2623,3168,3708,3574,3545,3965,3736,3334,3903,3617,2022,1915,3193,3440,2549,1818,2061,2849,3220,3331,3535,3712,3900,3867,3648,3747,3926,3944,4096,3868,2404,1111,1493,2341,2188,1647,1390,1538,2170,2189,1217,1198,2492,3215,3259,3273,2713,1957,1575,998,520,516,327,79,109,322,971,1403,882,539,1344,2300,1924,874,1263,2526,2777,2855,3300,2688,1443,1251,1835,1890,1452,1262,975,446,439,565,290,169,168,204,393,210,90,513,612,558,868,785,402,339,376,423,378,208,226,164,0,44,162,195,269,248,249,281,568,1398,1634,776,321,689,954,732,301,449,986,832,518,874,1274,1514,1904,1920,1230,969,2004,2712,1839,1035,1168,1376,1584,1473,880,795,907,506,327,486,589,651,344,0,157,443,494,363,116,149,342,298,302,491,671,748,718,765,680,300,315,806,919,493,129,235,416,401,849,1347,899,432,559,487,409,546,473,454,478,364,492,664,658,583,183,0,597,958,611,433,513,332,185,528,823,567,370,530,593,557,500,572,1099,1438,1099,805,834,998,1246,1274,1322,1583,1343,801,926,1571,2011,1879,1379,1058,1016,1136,1239,945,597,658,733,717,729,484,266,484,688,455,115,237,627,625,484,648,713,636,774,860,607,308,343,567,522,353,376,357,264,308,485,672,553,374,864,1462,1313,956,831,784,883,913,734,644,539,363,501,823,897,894,1124,1210,801,513,752,897,764,767,801,718,724,809,856,947,1117,1115,779,470,474,624,756,689,437,423,602,610,558,450,243,359,804,1057,968,791,772,832,800,840,836,477,312,723,917,585,470,761,937,915,1033,1347,1506,1273,1058,1335,1640,1435,1217,1345,1430,1486,1691,1695,1504,1565,1769,1751,1706,1881,1850,1361,1083,1294,1448,1499,1499,1119,955,1533,1809,1385,1204,1287,1311,1570,1594,1082,1026,1475,1432,1011,740,707,1002,1132,759,697,1051,1075,1062,1296,1261,1118,1251,1407,1451,1313,1008,1064,1379,1220,904,1089,1473,1661,1551,1197,1144,1464,1601,1802,2177,1962,1540,1748,1983,1972,2250,2433,2200,2089,2189,2211,2092,1964,2148,2482,2435,2185,2066,2010,2204,2520,2347,1987,2111,2298,2097,1935,2018,2092,2013,1694,1423,1565,1648,1452,1514,1614,1468,1568,1619,1291,1412,1924,1941,1723,1700,1645,1575,1633,1780,1866,1632,1312,1402,1670,1686,1646,1737,1727,1638,1728,1899,2021,2111,1970,1714,1731,1778,1681,1784,1967,1961,1860,1715,1761,2063,2071,1693,1471,1599,1840,1803,1461,1339,1589,1826,1814,1551,1304,1342,1464,1402,1279,1379,1632,1643,1555,1753,1868,1704,1746,1935,1892,1770,1789,1906,1978,1896,1787,1877,2089,2008,1632,1584,1870,1929,1865,1775,1526,1581,1890,1837,1767,1967,1948,1764,1721,1723,1800,1935,1906,1725,1562,1521,1612,1724,1731,1675,1735,1804,1679,1623,1716,1633,1554,1677,1630,1361,1232,1373,1541,1431,1353,1626,1670,1386,1535,1949,1931,1693,1674,1773,1803,1820,1859,1838,1859,1960,1935,1901,1981,1933,1862,1942,1928,1887,2038,2151,2061,1917,1868,1995,2219,2293,2056,1764,1779,1883,1856,2004,2161,1969,1833,1915,1899,2043,2452,2517,2126,1888,2042,2234,2203,2061,1967,1995,2103,2162,2195,2202,2093,2065,2202,2185,1987,1869,1910,2050,2054,1907,1975,2160,2034,1755,1697,1864,2019,1983,1927,2035,2109,2014,1866,1802,1936,2145,2151,2028,2049,2185,2177,1998,1945,2088,2131,2023,1958,1956,1971,2048,2151,2146,2020,1917,1912,1997,2141,2179,2079,2046,2074,2103,2200,2222,2130,2161,2249,2231,2208,2159,2052,2071,2195,2222,2160,2159,2215,2209,2210,2335,2435,2430,2400,2249,2074,2206,2471,2483,2362,2338,2362,2397,2437,2417,2351,2300,2303,2369,2386,2351,2448,2511,2286,2161,2343,2383,2307,2437,2492,2377,2361,2301,2233,2485,2740,2597,2324,2201,2241,2405,2488,2388,2326,2373,2385,2349,2351,2397,2385,2264,2233,2374,2378,2192,2162,2260,2264,2317,2426,2368,2292,2353,2338,2241,2246,2271,2238,2219,2184,2169,2248,2276,2213,2241,2290,2199,2135,2221,2305,2348,2379,2308,2216,2279,2341,2197,2046,2105,2208,2196,2202,2287,2281,2157,2101,2141,2128,2074,2111,2203,2223,2172,2121,2119,2164,2213,2218,2184,2184,2239,2270,2261,2283,2314,2286,2237,2258,2346,2358,2233,2160,2238,2295,2293,2343,2384,2367,2397,2467,2492,2495,2486,2466,2511,2606,2629,2582,2558,2585,2644,2668,2607,2569,2653,2702,2596,2535,2642,2698,2629,2627,2645,2559,2535,2634,2670,2644,2629,2578,2577,2666,2665,2583,2574,2567,2534,2591,2652,2604,2571,2635,2681,2620,2528,2543,2618,2593,2530,2588,2677,2652,2577,2553,2560,2556,2590,2681,2711,2630,2574,2587,2599,2620,2649,2647,2638,2596,2510,2508,2589,2588,2513,2489,2503,2486,2433,2395,2421,2445,2388,2329,2319,2287,2261,2325,2414,2442,2427,2380,2303,2255,2296,2382,2408,2346,2289,2328,2404,2373,2262,2248,2303,2276,2274,2402,2463,2392,2365,2383,2363,2361,2402,2454,2481,2437,2416,2503,2537,2450,2444,2556,2607,2544,2436,2361,2380,2443,2475,2493,2513,2520,2535,2545,2513,2475,2474,2514,2575,2588,2520,2447,2450,2517,2578,2564,2472,2413,2451,2478,2413,2381,2468,2529,2492,2487,2521,2487,2440,2476,2534,2531,2465,2408,2452,2564,2585,2470,2394,2490,2624,2619,2517,2440,2417,2458,2534,2568,2541,2500,2486,2507,2544,2590,2640,2635,2560,2499,2487,2507,2542,2529,2468,2469,2512,2498,2479,2499,2491,2464,2453,2435,2445,2457,2403,2384,2438,2441,2470,2569,2552,2481,2547,2598,2537,2518,2552,2585,2618,2589,2532,2544,2588,2622,2611,2525,2509,2612,2611,2505,2516,2580,2558,2543,2559,2537,2522,2520,2501,2523,2550,2483,2386,2361,2393,2459,2512,2468,2360,2329,2391,2417,2387,2398,2429,2391,2341,2350,2359,2320,2306,2366,2409,2385,2340,2288,2270,2337,2354,2278,2280,2322,2296,2354,2469,2434,2389,2475,2491,2395,2379,2457,2528,2559,2537,2479,2446,2454,2483,2545,2592,2549,2479,2495,2564,2579,2551,2568,2619,2635,2652,2694,2670,2602,2594,2635,2703,2776,2759,2704,2734,2755,2702,2706,2764,2726,2599,2540,2599,2654,2638,2624,2627,2614,2648,2690,2632,2588,2671,2738,2713,2698,2695,2668,2676,2762,2875,2901,2807,2731,2713,2651,2620,2683,2671,2556,2506,2533,2546,2532,2548,2612,2604,2474,2387,2417,2455,2477,2508,2523,2495,2437,2439,2531,2555,2439,2340,2336,2337,2319,2333,2335,2261,2200,2229,2268,2272,2276,2259,2214,2171,2174,2269,2357,2309,2218,2174,2172,2309,2535,2546,2350,2299,2450,2550,2527,2521,2535,2464,2398,2494,2645,2642,2542,2529,2596,2606,2540,2522,2587,2610,2558,2564,2629,2648,2669,2741,2776,2757,2743,2779,2874,2897,2759,2661,2729,2789,2768,2751,2739,2749,2833,2904,2873,2822,2828,2844,2815,2782,2806,2857,2851,2819,2850,2880,2822,2751,2729,2772,2858,2840,2686,2568,2527,2525,2563,2529,2405,2339,2322,2327,2411,2442,2324,2216,2189,2190,2236,2272,2198,2112,2150,2230,2248,2275,2318,2265,2193,2244,2321,2298,2236,2221,2268,2308,2252,2184,2236,2307,2297,2331,2420,2406,2357,2430,2522,2541,2551,2549,2528,2542,2556,2562,2623,2699,2719,2690,2650,2656,2715,2745,2726,2702,2660,2618,2633,2678,2694,2700,2701,2661,2648,2700,2687,2590,2558,2594,2615,2628,2621,2583,2577,2600,2589,2566,2571,2572,2559,2577,2614,2624,2629,2629,2577,2526,2532,2541,2522,2491,2426,2374,2406,2447,2409,2382,2420,2396,2326,2396,2527,2520,2472,2486,2470,2452,2517,2583,2571,2513,2470,2487,2537,2564,2562,2562,2566,2555,2568,2639,2682,2649,2614,2605,2595,2583,2564,2579,2636,2650,2625,2635,2658,2678,2706,2715,2703,2692,2687,2707,2735,2726,2701,2681,2656,2647,2670,2672,2611,2553,2574,2606,2583,2568,2574,2556,2571,2621,2600,2538,2563,2614,2570,2483,2457,2479,2502,2499,2477,2474,2485,2491,2496,2474,2410,2369,2386,2411,2405,2380,2381,2402,2390,2355,2353,2395,2422,2398,2399,2449,2431,2356,2342,2361,2368,2385,2400,2414,2424,2399,2401,2449,2463,2458,2469,2469,2475,2512,2552,2554,2527,2562,2653,2687,2685,2684,2620,2568,2637,2718,2704,2669,2684,2691,2634,2591,2629,2666,2645,2599,2557,2556,2594,2594,2569,2556,2502,2456,2520,2576,2506,2433,2463,2513,2504,2475,2484,2505,2470,2408,2394,2417,2420,2397,2381,2397,2417,2423,2457,2489,2448,2406,2422,2434,2449,2498,2514,2477,2448,2420,2385,2398,2457,2477,2442,2417,2407,2380,2375,2405,2421,2407,2396,2408,2412,2387,2392,2432,2419,2384,2406,2411,2372,2369,2392,2423,2455,2442,2446,2511,2504,2446,2481,2537,2513,2477,2485,2523,2540,2513,2502,2518,2519,2532,2548,2521,2499,2507,2515,2522,2529,2520,2502,2491,2506,2532,2520,2463,2418,2431,2457,2423,2388,2426,2447,2405,2403,2456,2465,2419,2400,2440,2477,2454,2421,2438,2459,2428,2396,2419,2466,2487,2480,2460,2439,2418,2403,2407,2441,2486,2487,2429,2398,2423,2443,2463,2477,2443,2414,2427,2440,2451,2449,2430,2449,2473,2456,2455,2466,2447,2453,2513,2542,2512,2517,2574,2569,2513,2517,2545,2545,2550,2551,2548,2557,2525,2469,2482,2531,2528,2510,2534,2551,2531,2522,2519,2506,2516,2542,2550,2543,2520,2512,2525,2503,2474,2467,2440,2425,2437,2415,2383,2389,2415,2438,2422,2394,2418,2446,2433,2424,2434,2444,2447,2438,2417,2395,2406,2440,2430,2391,2402,2457,2473,2414,2374,2417,2442,2421,2436,2447,2422,2418,2424,2432,2450,2437,2412,2411,2400,2396,2413,2407,2372,2345,2352,2383,2394,2385,2391,2391,2368,2367,2409,2426,2375,2338,2350,2356,2367,2397,2388,2369,2387,2409,2428,2429,2393,2383,2410,2416,2413,2420,2420,2429,2429,2402,2398,2431,2443,2420,2401,2408,2420,2413,2428,2481,2490,2452,2461,2490,2476,2448,2435,2439,2468,2484,2465,2448,2440,2439,2442,2430,2411,2421,2444,2436,2417,2431,2460,2476,2454,2396,2395,2457,2439,2375,2380,2383,2369,2406,2422,2381,2363,2392,2438,2447,2412,2416,2446,2435,2416,2409,2389,2384,2398,2397,2384,2391,2404,2393,2393,2411,2390,2358,2366,2376,2374,2377,2383,2394,2386,2368,2381,2393,2398,2415,2406,2383,2374,2355,2362,2397,2417,2434,2429,2392,2379,2382,2377,2393,2415,2426,2427,2415,2412,2416,2424,2451,2453,2439,2442,2405,2353,2376,2418,2426,2424,2408,2390,2391,2422,2477,2482,2427,2414,2455,2482,2488,2470,2422,2377,2364,2387,2430,2452,2432,2390,2363,2369,2406,2443,2438,2401,2380,2391,2420,2430,2415,2408,2393,2359,2360,2383,2376,2359,2351,2347,2355,2364,2375,2374,2333,2294,2295,2318,2359,2394,2385,2362,2356,2358,2376,2403,2394,2352,2325,2316,2311,2338,2369,2350,2329,2340,2345,2350,2366,2365,2359,2359,2355,2351,2340,2314,2307,2348,2399,2390,2341,2319,2321,2343,2373,2352,2308,2311,2334,2347,2347,2322,2305,2326,2356,2376,2377,2352,2313,2278,2275,2310,2356,2369,2327,2274,2272,2309,2357,2410,2460,2507,2503,2412,2321,2316,2369,2410,2390,2316,2241,2212,2263,2370,2443,2434,2377,2344,2383,2443,2473,2481,2452,2394,2366,2372,2368,2344,2320,2309,2303,2302,2304,2309,2337,2370,2379,2388,2396,2374,2335,2300,2282,2305,2339,2351,2345,2308,2259,2247,2258,2249,2237,2264,2305,2306,2276,2242,2217,2228,2256,2275,2288,2258,2210,2237,2299,2329,2338,2318,2292,2303,2310,2339,2410,2369,2194,2122,2226,2334,2344,2283,2202,2182,2255,2351,2416,2445,2429,2394,2385,2376,2354,2333,2293,2264,2278,2290,2280,2279,2278,2283,2320,2368,2389,2390,2386,2355,2295,2267,2276,2257,2223,2228,2242,2228,2207,2202,2218,2244,2261,2258,2249,2256,2276,2277,2258,2247,2231,2209,2225,2255,2237,2209,2223,2244,2251,2242,2209,2173,2167,2190,2221,2239,2226,2184,2146,2156,2209,2249,2245,2228,2240,2254,2234,2252,2336,2358,2270,2195,2205,2267,2320,2326,2303,2292,2303,2318,2338,2386,2444,2463,2445,2418,2401,2414,2411,2345,2270,2250,2270,2284,2280,2286,2300,2305,2342,2419,2454,2427,2401,2410,2417,2384,2359,2372,2375,2358,2340,2308,2288,2296,2309,2327,2334,2320,2313,2295,2258,2262,2278,2249,2227,2237,2248,2249,2235,2214,2211,2221,2241,2279,2296,2251,2195,2185,2189,2175,2178,2202,2212,2208,2193,2178,2185,2187,2164,2157,2177,2197,2196,2181,2191,2210,2180,2136,2139,2165,2181,2191,2200,2213,2216,2193,2177,2186,2207,2231,2253,2260,2249,2238,2258,2287,2283,2268,2265,2252,2236,2238,2264,2300,2295,2251,2239,2262,2274,2279,2286,2281,2254,2224,2221,2228,2215,2213,2247,2281,2288,2293,2320,2343,2330,2313,2327,2345,2340,2332,2340,2338,2296,2263,2289,2309,2278,2246,2233,2233,2266,2309,2311,2290,2288,2295,2295,2312,2337,2317,2286,2305,2338,2333,2306,2292,2301,2307,2296,2291,2270,2209,2180,2209,2219,2189,2163,2149,2146,2167,2189,2179,2161,2179,2194,2167,2143,2148,2152,2154,2157,2156,2167,2183,2178,2157,2130,2120,2149,2170,2148,2124,2126,2137,2152,2172,2177,2155,2142,2170,2198,2189,2172,2176,2191,2197,2202,2216,2227,2216,2192,2181,2208,2243,2233,2196,2174,2154,2134,2134,2135,2134,2133,2127,2123,2126,2140,2173,2195,2192,2188,2183,2179,2194,2206,2210,2221,2220,2202,2194,2201,2212,2214,2190,2158,2146,2154,2163,2176,2196,2201,2194,2202,2216,2232,2259,2265,2243,2239,2251,2252,2248,2240,2227,2228,2248,2268,2274,2252,2220,2221,2253,2269,2263,2252,2223,2191,2199,2212,2189,2170,2173,2171,2176,2188,2177,2163,2170,2169,2159,2168,2184,2180,2169,2177,2195,2207,2204,2194,2200,2216,2224,2232,2244,2239,2223,2221,2231,2243,2260,2268,2258,2251,2251,2248,2249,2256,2251,2234,2224,2226,2217,2190,2181,2200,2215,2215,2218,2219,2203,2181,2171,2169,2164,2175,2207,2212,2176,2149,2141,2127,2128,2152,2148,2114,2114,2138,2126,2094,2098,2131,2147,2134,2111,2089,2068,2062,2083,2118,2152,2165,2151,2136,2134,2126,2111,2112,2130,2143,2138,2123,2123,2138,2146,2145,2144,2144,2149,2170,2187,2179,2161,2148,2136,2147,2177,2162,2103,2083,2110,2106,2077,2080,2091,2070,2047,2047,2052,2055,2056,2053,2050,2049,2046,2043,2034,2018,2016,2036,2055,2063,2064,2052,2042,2060,2089,2100,2105,2114,2123,2133,2136,2131,2142,2167,2171,2153,2140,2132,2132,2158,2193,2216,2236,2249,2233,2206,2202,2207,2204,2203,2213,2226,2225,2200,2169,2165,2185,2200,2200,2193,2175,2155,2152,2155,2149,2154,2165,2153,2132,2129,2134,2135,2146,2163,2163,2146,2135,2131,2121,2098,2083,2090,2097,2086,2077,2084,2091,2089,2093,2107,2118,2109,2091,2084,2086,2086,2088,2087,2075,2063,2067,2079,2088,2089,2073,2058,2071,2098,2112,2112,2107,2110,2125,2123,2100,2099,2127,2137,2128,2134,2149,2147,2137,2142,2170,2202,2210,2198,2187,2188,2199,2215,2219,2216,2224,2225,2208,2212,2231,2217,2189,2191,2200,2198,2205,2215,2211,2219,2238,2245,2251,2263,2260,2241,2227,2231,2242,2234,2202,2187,2203,2213,2211,2218,2227,2228,2225,2218,2213,2217,2221,2224,2231,2229,2215,2215,2230,2232,2220,2208,2202,2202,2200,2192,2190,2201,2210,2212,2204,2182,2162,2157,2147,2136,2143,2147,2129,2116,2119,2112,2099,2103,2113,2102,2078,2071,2088,2104,2103,2092,2082,2080,2084,2083,2078,2080,2082,2075,2072,2082,2088,2080,2070,2070,2071,2068,2063,2052,2036,2033,2046,2057,2064,2068,2061,2055,2069,2087,2089,2088,2101,2119,2125,2122,2117,2112,2101,2081,2070,2079,2089,2087,2088,2093,2089,2085,2097,2105,2095,2083,2084,2093,2100,2098,2088,2076,2078,2088,2093,2094,2101,2107,2104,2097,2096,2105,2110,2102,2097,2103,2101,2094,2103,2112,2100,2095,2114,2127,2117,2106,2110,2118,2117,2111,2108,2104,2102,2100,2087,2070,2069,2084,2095,2095,2092,2083,2072,2070,2083,2089,2080,2070,2068,2063,2056,2054,2053,2051,2056,2063,2062,2053,2050,2062,2073,2071,2070,2079,2078,2064,2063,2081,2086,2078,2072,2063,2050,2054,2066,2061,2050,2049,2041,2026,2025,2039,2041,2023,2011,2016,2017,2010,2013,2019,2016,2012,2010,2009,2015,2018,2013,2013,2019,2023,2029,2030,2026,2032,2037,2028,2024,2033,2036,2034,2035,2031,2030,2040,2045,2045,2050,2052,2047,2052,2055,2042,2037,2050,2060,2062,2064,2064,2064,2059,2052,2065,2090,2094,2085,2083,2082,2084,2095,2098,2091,2096,2098,2090,2095,2111,2115,2111,2112,2118,2122,2123,2126,2138,2143,2135,2131,2138,2147,2148,2137,2124,2122,2121,2111,2105,2111,2112,2103,2102,2106,2100,2093,2095,2096,2090,2084,2079,2070,2059,2054,2059,2069,2077,2083,2086,2074,2060,2064,2077,2076,2065,2063,2064,2056,2052,2061,2062,2049,2051,2067,2075,2075,2082,2091,2092,2088,2083,2080,2083,2087,2087,2085,2087,2090,2092,2100,2114,2121,2119,2116,2119,2127,2132,2130,2130,2135,2130,2120,2119,2124,2126,2128,2130,2133,2135,2131,2126,2128,2134,2136,2128,2120,2123,2125,2117,2109,2105,2096,2089,2087,2081,2078,2086,2086,2075,2074,2080,2079,2076,2076,2072,2064,2060,2056,2047,2039,2040,2043,2040,2029,2024,2023,2016,2007,2007,2006,2002,2004,2007,2001,1997,1998,1998,2001,2001,1996,1992,1991,1987,1987,1988,1986,1991,1998,1997,1993,1996,1998,1999,2002,1999,1995,2001,2014,2022,2021,2017,2018,2020,2020,2024,2033,2035,2030,2029,2036,2044,2050,2053,2052,2050,2051,2052,2054,2061,2064,2065,2076,2083,2076,2072,2078,2080,2085,2089,2080,2073,2077,2080,2074,2070,2066,2065,2072,2074,2066,2062,2060,2052,2047,2050,2049,2044,2044,2042,2036,2038,2042,2032,2019,2012,2011,2018,2023,2018,2010,2009,2012,2016,2016,2014,2016,2018,2011,2009,2020,2032,2035,2030,2027,2030,2030,2028,2035,2041,2034,2025,2029,2039,2043,2037,2027,2025,2036,2051,2062,2061,2049,2041,2046,2056,2065,2065,2056,2048,2050,2057,2061,2064,2061,2051,2044,2045,2048,2048,2048,2046,2046,2047,2044,2047,2054,2051,2039,2036,2042,2046,2043,2037,2037,2042,2039,2031,2025,2019,2013,2013,2011,2002,1996,1994,1991,1986,1981,1983,1989,1986,1980,1979,1978,1976,1975,1974,1973,1972,1970,1968,1966,1963,1965,1968,1966,1961,1962,1965,1967,1973,1978,1981,1984,1987,1988,1991,1994,1991,1992,2002,2010,2009,2009,2014,2016,2018,2019,2018,2018,2017,2017,2019,2022,2024,2026,2027,2030,2032,2030,2029,2031,2030,2030,2031,2025,2016,2013,2014,2017,2018,2015,2013,2017,2015,2008,2007,2008,2005,2002,2000,1997,1996,2002,2009,2009,2001,1995,2000,2004,2001,1997,1996,2000,2005,2002,1992,1986,1988,1992,1993,1996,2002,2005,2006,2008,2004,2001,2004,2007,2008,2009,2006,2002,2001,2001,2006,2011,2011,2014,2022,2028,2032,2032,2029,2031,2035,2039,2047,2051,2047,2049,2053,2051,2051,2059,2066,2066,2063,2062,2064,2065,2059,2054,2056,2055,2052,2053,2052,2052,2055,2057,2059,2056,2049,2049,2055,2051,2047,2045,2036,2027,2028,2029,2024,2019,2018,2016,2013,2012,2010,2008,2011,2013,2010,2013,2021,2026,2030,2028,2023,2027,2036,2040,2040,2046,2057,2066,2068,2070,2070,2064,2061,2061,2057,2058,2065,2071,2075,2076,2076,2084,2093,2094,2089,2086,2084,2085,2093,2098,2092,2085,2087,2088,2086,2081,2074,2069,2064,2061,2064,2059,2043,2030,2020,2014,2017,2018,2013,2004,1989,1976,1971,1975,1978,1975,1965,1953,1944,1941,1947,1952,1950,1939,1927,1926,1932,1932,1923,1912,1908,1914,1918,1914,1906,1898,1897,1903,1906,1908,1906,1901,1904,1916,1928,1940,1945,1941,1936,1936,1940,1946,1952,1961,1971,1974,1978,1985,1991,1997,2005,2011,2008,1996,1993,2002,2007,2002,1997,1996,1998,2001,2005,2007,2008,2011,2019,2026,2032,2034,2030,2029,2030,2030,2031,2024,2014,2010,2009,2010,2012,2009,2004,2006,2010,2008,2004,2003,2006,2008,2003,1997,1990,1984,1986,1991,1987,1983,1987,1995,1997,1992,1989,1991,1990,1984,1983,1985,1985,1985,1987,1987,1985,1982,1979,1981,1991,2000,2003,2003,2001,2001,2005,2011,2018,2020,2017,2018,2018,2016,2021,2031,2037,2041,2043,2042,2039,2037,2041,2052,2057,2052,2051,2054,2051,2046,2049,2053,2052,2054,2056,2051,2047,2049,2049,2049,2051,2048,2039,2036,2041,2048,2054,2058,2056,2051,2047,2048,2054,2053,2042,2038,2040,2036,2026,2019,2014,2007,2002,2000,2000,2000,2000,2001,1998,1991,1985,1979,1974,1969,1965,1961,1952,1950,1956,1958,1951,1944,1941,1942,1945,1948,1942,1935,1934,1938,1941,1945,1946,1948,1954,1956,1953,1955,1956,1950,1948,1951,1952,1954,1958,1959,1958,1957,1960,1968,1972,1969,1967,1973,1983,1990,1992,1992,1992,1992,1994,1992,1987,1981,1979,1982,1985,1985,1987,1991,1993,1992,1992,1996,1997,1998,2000,1998,1992,1992,1994,1991,1987,1988,1993,1998,1998,2001,2007,2007,2004,2006,2009,2006,2000,1999,2002,2000,1993,1993,1997,2001,2004,2004,2001,2004,2012,2017,2018,2016,2016,2016,2014,2015,2014,2011,2011,2015,2016,2016,2021,2030,2030,2023,2021,2022,2026,2030,2027,2022,2021,2021,2026,2033,2033,2028,2026,2024,2022,2020,2018,2020,2023,2022,2020,2021,2025,2028,2026,2025,2026,2020,2018,2024,2026,2021,2017,2015,2013,2005,2000,2000,1998,1990,1982,1980,1979,1976,1975,1979,1981,1981,1979,1975,1977,1980,1978,1976,1973,1967,1962,1960,1956,1951,1950,1947,1945,1946,1949,1948,1943,1940,1941,1942,1943,1941,1942,1947,1952,1957,1964,1965,1960,1961,1964,1963,1959,1961,1966,1967,1965,1965,1968,1972,1974,1973,1972,1974,1978,1982,1985,1986,1987,1989,1991,1991,1987,1986,1990,1992,1990,1990,1992,1993,1996,2000,2000,1997,1996,1997,1996,1993,1993,1995,1997,2000,2000,1999,1999,2000,2000,1997,1993,1994,1996,1990,1983,1982,1985,1983,1976,1973,1978,1978,1974,1974,1974,1974,1976,1981,1981,1975,1968,1963,1964,1964,1961,1956,1951,1949,1950,1953,1953,1950,1947,1948,1953,1957,1956,1954,1958,1962,1962,1958,1956,1957,1958,1958,1959,1964,1969,1970,1967,1963,1963,1965,1968,1969,1967,1961,1959,1961,1965,1968,1968,1967,1970,1974,1976,1976,1977,1975,1972,1974,1975,1972,1970,1972,1970,1965,1964,1965,1967,1969,1972,1977,1983,1983,1979,1981,1986,1982,1973,1971,1972,1974,1978,1978,1971,1966,1967,1969,1973,1977,1976,1975,1976,1975,1974,1974,1974,1971,1969,1968,1967,1969,1977,1981,1978,1972,1969,1966,1966,1971,1974,1972,1970,1970,1971,1971,1968,1966,1968,1971,1972,1971,1971,1974,1975,1972,1972,1976,1976,1974,1973,1972,1967,1969,1976,1977,1972,1971,1974,1978,1981,1982,1984,1990,1993,1992,1991,1992,1997,2007,2012,2009,2004,2002,2001,2003,2004,2002,2003,2006,2010,2013,2015,2018,2020,2020,2019,2018,2018,2017,2017,2017,2017,2015,2015,2019,2019,2013,2009,2008,2009,2011,2011,2009,2011,2012,2009,2007,2009,2010,2007,2005,2005,2005,2004,2004,2006,2009,2008,2005,2005,2005,2004,2006,2004,1998,1996,1994,1993,1995,1998,1998,1997,1993,1990,1989,1993,1997,1998,1996,1992,1990,1987,1984,1984,1983,1979,1977,1977,1974,1974,1979,1980,1978,1978,1976,1972,1972,1974,1973,1966,1963,1965,1966,1965,1964,1963,1962,1961,1961,1962,1960,1956,1956,1957,1955,1955,1953,1947,1945,1948,1952,1953,1955,1956,1957,1958,1960,1962,1963,1963,1961,1958,1958,1958,1959,1958,1955,1954,1957,1958,1958,1961,1962,1963,1968,1972,1973,1975,1977,1974,1970,1969,1971,1974,1977,1980,1979,1975,1972,1975,1977,1977,1977,1978,1977,1975,1974,1975,1976,1978,1981,1983,1984,1984,1982,1981,1986,1991,1991,1988,1985,1980,1981,1986,1988,1987,1987,1986,1987,1991,1993,1990,1986,1983,1984,1988,1989,1986,1984,1984,1983,1984,1986,1985,1983,1982,1978,1974,1976,1974,1968,1967,1971,1973,1972,1973,1974,1973,1970,1966,1963,1964,1969,1970,1963,1955,1952,1950,1948,1946,1946,1947,1948,1946,1943,1943,1944,1944,1943,1943,1942,1941,1942,1940,1938,1939,1940,1937,1936,1938,1936,1935,1941,1944,1941,1938,1936,1933,1935,1939,1940,1938,1938,1940,1941,1942,1944,1946,1947,1949,1949,1948,1949,1951,1951,1948,1944,1941,1941,1943,1945,1946,1947,1950,1952,1955,1958,1960,1959,1960,1961,1961,1961,1959,1957,1958,1959,1957,1955,1951,1950,1954,1955,1954,1956,1960,1963,1964,1963,1960,1957,1956,1957,1960,1962,1962,1961,1961,1965,1970,1970,1968,1967,1969,1970,1967,1965,1967,1970,1972,1973,1973,1975,1977,1976,1973,1972,1976,1981,1982,1981,1981,1980,1979,1980,1981,1981,1981,1977,1973,1972,1971,1970,1975,1978,1977,1974,1971,1969,1974,1980,1983,1981,1981,1980,1978,1975,1977,1978,1976,1973,1973,1975,1977,1977,1973,1972,1974,1977,1978,1975,1971,1970,1969,1967,1968,1970,1970,1971,1971,1970,1969,1966,1962,1961,1962,1962,1960,1958,1956,1957,1960,1959,1958,1961,1964,1963,1960,1960,1959,1956,1957,1961,1962,1961,1959,1960,1961,1961,1962,1962,1959,1959,1959,1951,1945,1946,1951,1955,1960,1964,1968,1970,1971,1969,1966,1965,1966,1965,1964,1964,1964,1964,1964,1965,1964,1964,1964,1966,1969,1972,1975,1978,1980,1979,1977,1974,1972,1973,1976,1977,1976,1976,1976,1976,1979,1982,1981,1978,1975,1974,1974,1975,1975,1973,1971,1969,1970,1975,1980,1980,1978,1977,1978,1980,1982,1980,1976,1975,1977,1976,1971,1967,1968,1971,1972,1973,1977,1982,1984,1984,1984,1982,1981,1980,1978,1975,1973,1974,1975,1975,1974,1976,1977,1978,1980,1985,1988,1988,1988,1987,1984,1984,1985,1982,1979,1981,1981,1979,1980,1984,1985,1984,1986,1988,1989,1993,1995,1992,1988,1988,1989,1989,1989,1988,1984,1981,1983,1986,1989,1990,1989,1988,1989,1989,1988,1989,1989,1988,1987,1983,1979,1977,1978,1981,1982,1981,1980,1982,1985,1986,1984,1981,1980,1978,1976,1977,1978,1976,1974,1973,1971,1969,1968,1968,1967,1966,1966,1967,1967,1968,1971,1974,1975,1974,1974,1974,1974,1973,1973,1973,1974,1975,1974,1971,1969,1968,1968,1970,1972,1972,1972,1972,1973,1975,1975,1974,1972,1970,1972,1975,1974,1972,1970,1972,1975,1975,1974,1972,1968,1967,1970,1970,1967,1966,1965,1962,1961,1962,1960,1956,1959,1966,1971,1971,1968,1965,1962,1961,1962,1961,1957,1955,1954,1953,1952,1951,1952,1957,1962,1963,1961,1960,1960,1961,1964,1964,1962,1960,1959,1959,1958,1956,1954,1955,1956,1955,1956,1957,1957,1957,1955,1955,1956,1956,1957,1957,1957,1957,1957,1958,1958,1958,1962,1967,1969,1968,1965,1962,1962,1963,1963,1963,1963,1961,1959,1960,1962,1963,1965,1967,1967,1968,1968,1969,1969,1971,1972,1970,1966,1962,1960,1959,1959,1959,1960,1961,1962,1963,1963,1963,1961,1959,1956,1957,1958,1958,1958,1958,1958,1958,1959,1957,1954,1954,1956,1958,1957,1953,1950,1948,1948,1946,1944,1941,1939,1937,1938,1940,1940,1941,1943,1943,1943,1943,1942,1940,1939,1941,1944,1944,1945,1945,1946,1945,1944,1943,1942,1941,1943,1944,1941,1941,1944,1947,1950,1952,1955,1955,1955,1954,1954,1955,1957,1956,1954,1954,1954,1955,1957,1958,1959,1959,1959,1959,1963,1966,1969,1970,1971,1971,1970,1969,1969,1971,1972,1971,1970,1971,1973,1975,1976,1975,1974,1974,1975,1977,1976,1976,1978,1980,1980,1977,1975,1977,1980,1981,1982,1981,1981,1983,1982,1980,1979,1979,1981,1982,1982,1981,1979,1980,1982,1983,1983,1986,1989,1990,1992,1992,1991,1991,1993,1994,1995,1994,1991,1990,1991,1991,1990,1991,1994,1995,1995,1994,1994,1995,1997,1997,1996,1994,1993,1992,1992,1992,1992,1991,1992,1992,1990,1988,1987,1986,1987,1987,1986,1986,1985,1983,1983,1981,1979,1980,1984,1985,1984,1983,1984,1984,1984,1985,1983,1980,1978,1979,1980,1979,1977,1974,1973,1974,1975,1976,1977,1977,1977,1975,1971,1968,1970,1972,1974,1974,1972,1969,1967,1966,1964,1962,1963,1965,1964,1963,1964,1967,1969,1970,1971,1973,1973,1973,1974,1974,1974,1975,1975,1976,1976,1973,1971,1972,1974,1975,1974,1973,1973,1974,1976,1976,1977,1978,1978,1977,1977,1977,1976,1976,1976,1976,1975,1976,1976,1974,1973,1973,1972,1971,1972,1971,1969,1969,1969,1967,1966,1965,1966,1966,1967,1969,1970,1971,1972,1973,1973,1971,1968,1966,1965,1963,1961,1960,1960,1960,1960,1960,1960,1961,1963,1963,1964,1965,1965,1966,1967,1968,1966,1964,1963,1962,1962,1962,1964,1965,1967,1968,1968,1969,1971,1971,1970,1970,1970,1969,1968,1967,1966,1967,1969,1971,1971,1971,1972,1972,1973,1974,1975,1975,1973,1970,1968,1968,1968,1967,1967,1968,1968,1969,1970,1971,1971,1972,1972,1972,1972,1971,1971,1969,1968,1966,1966,1966,1966,1964,1963,1963,1961,1961,1964,1966,1968,1969,1969,1967,1964,1961,1962,1965,1966,1966,1966,1968,1968,1967,1965,1965,1966,1968,1969,1968,1965,1963,1965,1967,1967,1966,1965,1965,1966,1967,1966,1965,1966,1967,1968,1968,1969,1969,1968,1968,1967,1967,1967,1968,1968,1970,1971,1970,1969,1969,1968,1968,1968,1969,1970,1970,1969,1969,1969,1970,1969,1968,1967,1965,1964,1964,1964,1964,1967,1968,1968,1967,1967,1966,1966,1966,1966,1965,1965,1965,1965,1964,1962,1963,1963,1964,1964,1965,1967,1967,1967,1969,1971,1971,1971,1970,1970,1969,1970,1971,1972,1972,1974,1976,1976,1975,1975,1976,1978,1979,1978,1978,1977,1978,1979,1979,1980,1982,1984,1985,1985,1986,1987,1986,1986,1988,1990,1991,1991,1990,1988,1985,1983,1981,1980,1979,1980,1983,1986,1988,1989,1989,1990,1991,1991,1991,1991,1990,1988,1987,1985,1983,1983,1984,1983,1982,1981,1981,1980,1979,1980,1981,1982,1982,1980,1978,1975,1975,1976,1977,1978,1979,1980,1979,1977,1977,1980,1982,1981,1979,1977,1975,1975,1977,1977,1976,1975,1974,1975,1976,1976,1976,1977,1978,1979,1980,1979,1978,1976,1974,1972,1970,1969,1971,1973,1973,1973,1972,1972,1973,1974,1973,1972,1972,1973,1975,1977,1976,1975,1975,1976,1976,1977,1977,1976,1973,1972,1973,1974,1975,1974,1973,1972,1971,1971,1972,1971,1970,1970,1971,1972,1972,1971,1970,1970,1971,1972,1973,1972,1970,1968,1968,1968,1967,1966,1966,1964,1963,1963,1963,1962,1963,1965,1964,1964,1964,1964,1964,1964,1963,1962,1962,1961,1961,1959,1956,1953,1953,1954,1954,1954,1953,1954,1955,1955,1953,1951,1950,1949,1949,1949,1948,1947,1946,1946,1945,1944,1944,1945,1944,1943,1943,1944,1944,1943,1943,1943,1944,1942,1940,1938,1937,1937,1938,1939,1940,1941,1943,1944,1944,1947,1949,1948,1946,1945,1945,1945,1945,1944,1944,1945,1947,1948,1948,1949,1950,1952,1955,1956,1956,1955,1955,1955,1955,1955,1956,1956,1955,1954,1955,1957,1958,1961,1964,1965,1967,1968,1969,1970,1971,1971,1970,1971,1972,1973,1974,1976,1978,1980,1980,1981,1982,1984,1985,1986,1987,1988,1989,1990,1990,1989,1990,1990,1990,1991,1992,1993,1993,1994,1996,1997,1998,1998,1997,1996,1995,1995,1995,1997,1998,2000,2001,2000,1999,1999,2001,2001,2000,2000,2000,2002,2003,2003,2002,2001,2000,1999,1999,1999,1998,1998,2000,2001,2002,2001,2000,1998,1998,2000,1999,1998,1997,1997,1998,1998,1998,1997,1995,1993,1992,1992,1992,1992,1993,1992,1991,1991,1992,1992,1990,1989,1988,1987,1986,1985,1985,1985,1986,1986,1985,1984,1983,1982,1981,1980,1980,1981,1982,1981,1979,1977,1976,1975,1975,1976,1977,1978,1979,1979,1978,1978,1979,1980,1980,1978,1977,1974,1970,1967,1967,1967,1967,1967,1967,1968,1969,1971,1973,1973,1973,1973,1974,1974,1973,1971,1970,1970,1971,1970,1968,1967,1968,1968,1968,1968,1969,1971,1971,1971,1969,1970,1971,1972,1972,1972,1972,1972,1971,1971,1972,1973,1974,1976,1977,1979,1979,1979,1976,1974,1972,1972,1971,1972,1973,1975,1976,1977,1976,1977,1978,1979,1980,1980,1980,1980,1979,1978,1977,1977,1976,1975,1975,1975,1974,1974,1976,1976,1976,1978,1978,1978,1977,1977,1977,1977,1978,1977,1975,1974,1975,1976,1976,1976,1976,1975,1975,1974,1974,1973,1972,1973,1973,1972,1972,1973,1973,1973,1973,1971,1971,1972,1973,1973,1974,1974,1974,1974,1975,1975,1974,1974,1974,1974,1974,1974,1974,1973,1974,1977,1979,1980,1980,1980,1980,1981,1981,1981,1980,1979,1980,1981,1980,1979,1978,1977,1978,1980,1981,1981,1981,1982,1982,1983,1984,1984,1984,1984,1984,1984,1984,1984,1985,1985,1983,1982,1983,1984,1984,1986,1989,1990,1989,1989,1988,1985,1983,1983,1984,1985,1985,1985,1984,1983,1983,1984,1984,1985,1984,1984,1983,1983,1981,1980,1979,1978,1977,1978,1979,1979,1978,1978,1978,1979,1980,1980,1979,1978,1979,1980,1979,1977,1976,1975,1974,1974,1974,1974,1976,1979,1981,1983,1983,1983,1983,1982,1980,1978,1977,1977,1976,1975,1974,1974,1973,1973,1973,1974,1975,1976,1977,1977,1976,1974,1973,1973,1974,1973,1973,1972,1972,1970,1970,1970,1970,1971,1971,1972,1972,1971,1970,1970,1970,1968,1967,1967,1967,1967,1968,1969,1969,1971,1972,1973,1973,1973,1973,1973,1972,1971,1969,1968,1969,1969,1969,1970,1970,1970,1971,1972,1972,1973,1973,1973,1974,1975,1976,1976,1977,1977,1976,1975,1974,1974,1974,1975,1976,1977,1977,1976,1976,1975,1975,1975,1976,1976,1977,1977,1978,1978,1978,1978,1978,1979,1979,1980,1981,1980,1979,1978,1978,1978,1978,1979,1979,1979,1979,1978,1979,1980,1981,1982,1983,1984,1983,1982,1983,1984,1984,1984,1984,1983,1982,1982,1982,1982,1982,1981,1980,1979,1979,1980,1983,1986,1987,1987,1988,1988,1987,1986,1986,1985,1985,1986,1986,1986,1986,1986,1986,1986,1987,1987,1989,1990,1990,1989,1989,1990,1991,1990,1990,1991,1992,1992,1991,1990,1991,1993,1995,1996,1997,1997,1998,1998,1998,1997,1996,1995,1995,1995,1995,1996,1997,1999,2000,2001,2001,2000,2000,2001,2002,2001,2001,2000,1999,1999,1998,1997,1996,1997,1998,1999,1999,2000,2001,2000,1999,1999,1998,1997,1997,1998,1998,1997,1995,1994,1993,1993,1993,1994,1995,1997,1997,1994,1992,1991,1990,1990,1990,1988,1986,1986,1987,1988,1988,1987,1986,1986,1985,1986,1986,1985,1984,1983,1982,1982,1981,1981,1981,1980,1979,1980,1981,1982,1982,1980,1978,1978,1978,1978,1979,1979,1977,1977,1978,1978,1977,1977,1977,1977,1978,1979,1980,1979,1979,1978,1978,1978,1978,1978,1979,1980,1981,1980,1979,1978,1979,1979,1979,1980,1981,1982,1983,1983,1982,1983,1986,1988,1987,1987,1987,1988,1989,1990,1991,1991,1991,1991,1991,1991,1992,1993,1995,1995,1997,1998,1997,1997,1998,1998,1998,1998,1998,1998,1998,1999,2001,2001,2002,2004,2004,2004,2004,2003,2002,2002,2002,2001,2001,2001,2001,2002,2002,2002,2002,2004,2006,2007,2007,2008,2010,2010,2010,2009,2008,2006,2004,2003,2003,2004,2004,2005,2005,2006,2006,2006,2007,2007,2007,2006,2006,2005,2004,2005,2005,2005,2004,2003,2003,2004,2003,2003,2005,2005,2003,2001,2000,2000,2000,2000,1999,1996,1995,1996,1998,1999,2000,2001,2003,2003,2002,2000,1999,1997,1997,1997,1996,1995,1993,1992,1992,1992,1992,1992,1992,1992,1993,1995,1995,1995,1995,1994,1993,1992,1992,1991,1990,1990,1989,1989,1989,1989,1988,1989,1989,1988,1988,1987,1987,1987,1987,1986,1986,1986,1987,1987,1987,1987,1987,1988,1988,1988,1987,1986,1986,1985,1986,1987,1986,1985,1985,1985,1986,1986,1986,1986,1987,1987,1986,1986,1987,1987,1987,1988,1989,1989,1988,1987,1985,1984,1984,1985,1985,1986,1985,1984,1983,1983,1984,1985,1986,1987,1988,1987,1987,1986,1987,1986,1985,1985,1985,1985,1985,1985,1985,1984,1984,1984,1985,1986,1985,1985,1986,1986,1985,1984,1984,1985,1984,1984,1985,1986,1986,1986,1987,1988,1988,1988,1988,1989,1989,1988,1988,1989,1988,1987,1986,1986,1987,1988,1989,1991,1992,1993,1993,1993,1994,1994,1994,1994,1994,1993,1992,1992,1992,1993,1995,1997,1998,1999,1999,1999,1998,1999,2000,2000,2000,1999,1997,1996,1996,1996,1996,1997,1998,1999,2000,2002,2002,2002,2001,2001,2002,2001,2000,1999,1998,1998,1997,1998,1999,2001,2001,2001,2001,2001,2000,2000,1999,2000,2001,2001,1999,1999,1998,1997,1998,1999,1999,1999,2000,2002,2003,2003,2003,2002,2002,2001,2000,1998,1998,1997,1998,1999,2001,2000,1998,1998,2000,2001,2002,2005,2007,2006,2004,2003,2002,2003,2003,2000,1998,1998,1999,2001,2003,2003,2002,2002,2002,2002,2002,2002,2001,2000,2002,2003,2003,2001,2000,1999,2001,2003,2004,2004,2003,2001,1999,1998,1999,2000,2000,1999,1999,1998,1998,1998,1999,2000,2000,2000,2000,1999,1999,1998,1998,2000,2000,2000,2001,2001,1999,1998,1997,1996,1994,1994,1995,1995,1994,1995,1996,1997,1998,1999,1999,1999,2000,2001,2000,2000,1999,1998,1997,1996,1995,1995,1996,1996,1995,1996,1996,1997,1998,1998,1999,2000,2001,2000,1999,1999,1999,1998,1996,1996,1998,1999,2000,2002,2003,2002,2001,1999,1998,1997,1997,1997,1997,1997,1996,1995,1995,1995,1995,1996,1998,1999,1998,1998,1998,1998,1999,1997,1993,1992,1992,1991,1990,1990,1990,1990,1990,1992,1992,1993,1993,1993,1992,1993,1994,1993,1992,1991,1989,1988,1988,1989,1990,1989,1988,1988,1987,1988,1988,1989,1989,1987,1984,1982,1981,1982,1983,1984,1986,1986,1986,1986,1986,1986,1986,1985,1984,1983,1983,1983,1983,1983,1982,1982,1983,1984,1984,1984,1985,1985,1985,1985,1984,1985,1985,1986,1986,1986,1986,1985,1983,1983,1984,1984,1984,1984,1985,1985,1986,1988,1988,1988,1988,1988,1989,1988,1986,1986,1988,1989,1990,1989,1990,1989,1988,1988,1989,1991,1993,1994,1993,1994,1994,1995,1995,1996,1997,1998,1998,1998,1998,1997,1997,1999,2000,2000,2001,2001,2001,2001,2003,2006,2006,2004,2003,2004,2006,2006,2006,2006,2008,2009,2009,2009,2010,2010,2011,2011,2011,2011,2011,2011,2012,2012,2012,2012,2012,2012,2013,2014,2015,2016,2016,2016,2016,2016,2016,2016,2016,2016,2015,2013,2011,2011,2012,2013,2014,2015,2016,2016,2014,2014,2014,2014,2013,2012,2010,2009,2008,2007,2006,2005,2005,2006,2007,2008,2008,2008,2007,2007,2008,2007,2005,2003,2002,2001,2000,1999,2000,2001,2001,2001,1999,1999,1999,2000,1999,1998,1997,1997,1995,1992,1990,1990,1991,1991,1991,1991,1992,1993,1993,1992,1992,1993,1992,1991,1991,1990,1990,1989,1987,1987,1988,1989,1991,1990,1990,1990,1990,1990,1991,1992,1993,1993,1993,1992,1990,1990,1990,1992,1991,1990,1990,1991,1993,1994,1995,1996,1997,1997,1996,1995,1994,1994,1995,1996,1997,1999,2000,2001,2000,2000,2000,2000,2001,2002,2002,2002,2003,2005,2005,2005,2005,2007,2008,2008,2007,2007,2008,2011,2014,2015,2015,2015,2015,2014,2015,2015,2016,2017,2018,2019,2019,2020,2021,2022,2022,2021,2021,2022,2022,2023,2023,2024,2026,2027,2029,2030,2031,2031,2031,2030,2029,2029,2029,2030,2032,2033,2033,2033,2033,2032,2033,2034,2034,2034,2034,2034,2034,2034,2033,2032,2032,2032,2032,2032,2031,2033,2037,2040,2040,2038,2036,2034,2033,2032,2031,2030,2030,2030,2030,2029,2030,2031,2033,2034,2032,2032,2033,2034,2034,2030,2026,2025,2025,2026,2027,2027,2028,2029,2029,2027,2025,2025,2025,2025,2023,2021,2020,2020,2023,2026,2028,2031,2033,2033,2029,2022,2015,2011,2010,2011,2015,2019,2021,2022,2021,2020,2019,2018,2022,2027,2030,2027,2020,2013,2009,2009,2012,2018,2023,2022,2015,2005,1999,1999,2003,2007,2011,2015,2016,2019,2028,2042,2053,2052,2043,2038,2042,2049,2051,2044,2032,2016,2004,1997,1995,1994,1992,1992,1995,2001,2008,2012,2008,1994,1977,1965,1961,1966,1973,1980,1986,1992,1998,2001,2002,2001,2001,1999,1995,1993,1993,1990,1984,1981,1984,1987,1986,1985,1987,1991,1991,1990,1989,1989,1989,1989,1989,1991,1991,1990,1988,1989,1995,2001,2002,1999,1998,2003,2009,2010,2007,2003,1999,1997,1998,2000,2001,2002,2005,2009,2011,2009,2005,2002,1999,2000,2005,2011,2014,2015,2019,2025,2029,2028,2025,2022,2018,2014,2011,2009,2010,2013,2016,2017,2019,2023,2027,2027,2022,2014,2004,1995,1988,1986,1987,1988,1988,1990,1992,1991,1988,1982,1974,1968,1968,1972,1976,1979,1985,1991,1994,1994,1996,2001,2001,1996,1991,1990,1992,1995,1999,2004,2005,2004,2002,2003,2006,2010,2012,2010,2008,2010,2013,2012,2009,2008,2009,2010,2011,2012,2013,2010,2005,2005,2011,2017,2021,2025,2028,2026,2022,2020,2022,2024,2027,2031,2035,2037,2038,2039,2039,2037,2036,2034,2032,2030,2029,2029,2029,2031,2035,2036,2034,2033,2034,2038,2038,2036,2036,2039,2042,2045,2046,2043,2037,2032,2034,2040,2042,2038,2030,2023,2020,2022,2027,2033,2035,2035,2035,2036,2037,2037,2036,2035,2036,2037,2036,2034,2034,2038,2044,2047,2046,2045,2042,2038,2034,2031,2032,2033,2034,2038,2042,2043,2041,2039,2040,2042,2042,2040,2039,2039,2039,2038,2037,2036,2037,2038,2038,2036,2032,2030,2030,2031,2033,2036,2038,2039,2040,2042,2045,2049,2052,2055,2057,2054,2047,2040,2034,2031,2027,2025,2024,2026,2029,2033,2032,2026,2018,2014,2014,2016,2019,2025,2033,2038,2038,2037,2037,2035,2030,2026,2026,2029,2034,2038,2038,2035,2029,2024,2017,2009,2004,1999,1993,1985,1979,1980,1985,1987,1989,1993,2000,2005,2007,2007,2007,2009,2013,2017,2019,2019,2019,2017,2013,2011,2016,2023,2027,2028,2029,2030,2026,2016,2004,1998,1998,2001,2001,1997,1994,1996,2004,2014,2022,2026,2025,2016,2004,1995,1993,1996,2002,2007,2010,2010,2007,2002,1999,2000,2005,2012,2019,2022,2021,2017,2011,2006,2003,2000,1997,1996,1997,2001,2006,2012,2017,2022,2028,2033,2035,2035,2035,2035,2033,2030,2027,2020,2010,2003,2002,2004,2006,2007,2010,2013,2016,2017,2019,2020,2020,2020,2020,2019,2019,2022,2025,2026,2024,2021,2019,2020,2021,2022,2025,2028,2033,2039,2044,2045,2045,2047,2047,2044,2039,2036,2036,2035,2033,2029,2020,2011,2008,2012,2015,2011,2005,2002,2005,2011,2018,2021,2018,2014,2013,2014,2014,2012,2010,2009,2009,2013,2020,2029,2034,2036,2036,2037,2042,2050,2055,2054,2050,2044,2038,2031,2023,2017,2013,2014,2017,2022,2028,2031,2032,2029,2026,2026,2030,2037,2043,2042,2034,2025,2020,2017,2013,2012,2017,2023,2027,2032,2044,2061,2075,2083,2083,2077,2068,2061,2058,2058,2060,2057,2047,2035,2027,2024,2022,2019,2017,2018,2020,2020,2015,2005,1995,1986,1980,1977,1981,1992,2005,2012,2014,2015,2017,2018,2020,2024,2027,2026,2021,2015,2013,2013,2012,2009,2005,2001,1998,2000,2005,2010,2009,2005,2002,2004,2006,2005,2002,2002,2004,2009,2013,2014,2014,2013,2014,2019,2025,2031,2036,2040,2043,2044,2044,2044,2043,2037,2024,2010,2000,1996,1996,1999,2000,2001,2002,2003,2003,2005,2012,2020,2026,2030,2034,2035,2033,2028,2025,2021,2016,2013,2011,2011,2013,2015,2015,2011,2009,2008,2007,2006,2006,2007,2009,2011,2010,2005,1997,1992,1991,1991,1989,1987,1989,1994,2001,2006,2006,1999,1991,1987,1987,1989,1992,1995,1998,2002,2010,2016,2015,2009,2005,2006,2007,2007,2011,2015,2013,2006,2002,2004,2008,2009,2008,2007,2005,2002,1998,1993,1990,1988,1991,1998,2005,2010,2015,2019,2023,2024,2024,2023,2022,2019,2018,2020,2023,2026,2029,2031,2031,2029,2028,2031,2035,2037,2037,2034,2030,2026,2025,2028,2035,2043,2048,2047,2043,2039,2038,2038,2041,2044,2044,2042,2040,2037,2035,2036,2041,2047,2050,2051,2050,2049,2048,2047,2046,2046,2050,2053,2055,2057,2059,2059,2054,2048,2044,2044,2044,2044,2044,2043,2041,2039,2042,2053,2069,2077,2075,2066,2059,2058,2060,2059,2053,2043,2035,2033,2032,2031,2034,2040,2041,2035,2029,2028,2029,2028,2024,2023,2024,2028,2033,2037,2038,2041,2049,2059,2065,2067,2069,2071,2071,2069,2065,2058,2049,2042,2036,2028,2020,2017,2017,2020,2024,2030,2036,2040,2041,2041,2040,2037,2031,2027,2031,2042,2052,2054,2051,2049,2051,2056,2061,2064,2064,2062,2061,2059,2056,2053,2055,2063,2072,2079,2082,2081,2073,2060,2045,2036,2034,2035,2037,2037,2033,2027,2021,2017,2015,2014,2013,2012,2006,1997,1988,1982,1982,1985,1989,1990,1987,1984,1985,1990,1995,2002,2010,2019,2027,2034,2038,2041,2042,2042,2040,2036,2030,2022,2016,2011,2005,1994,1982,1972,1970,1973,1976,1978,1979,1979,1983,1991,1998,2001,2002,2006,2008,2008,2010,2018,2029,2035,2038,2040,2045,2048,2051,2055,2063,2072,2077,2075,2068,2060,2053,2046,2038,2031,2026,2025,2026,2026,2022,2016,2010,2005,2002,2000,2000,2002,2008,2020,2036,2050,2055,2051,2044,2037,2031,2028,2027,2026,2022,2015,2009,2011,2018,2027,2032,2033,2032,2032,2033,2035,2036,2034,2029,2024,2022,2018,2013,2010,2010,2008,2005,2003,2001,2001,2002,2006,2011,2017,2025,2033,2038,2041,2041,2039,2036,2035,2037,2037,2033,2029,2032,2039,2045,2048,2051,2053,2050,2044,2040,2039,2039,2041,2046,2052,2056,2056,2053,2049,2049,2054,2062,2067,2067,2066,2064,2059,2050,2044,2044,2048,2049,2048,2049,2053,2057,2057,2054,2050,2049,2048,2045,2040,2036,2035,2031,2024,2017,2019,2031,2045,2055,2062,2069,2075,2076,2070,2064,2066,2070,2069,2063,2056,2049,2041,2033,2029,2025,2022,2022,2026,2036,2046,2051,2046,2033,2022,2018,2019,2021,2022,2024,2023,2017,2011,2009,2014,2020,2024,2024,2024,2026,2034,2044,2052,2055,2052,2047,2042,2037,2031,2026,2023,2023,2030,2042,2050,2049,2041,2032,2021,2006,1992,1986,1988,1994,2001,2009,2016,2023,2028,2033,2035,2036,2037,2041,2044,2045,2049,2060,2069,2068,2057,2045,2033,2023,2017,2018,2023,2027,2028,2028,2028,2028,2026,2023,2019,2015,2013,2016,2023,2031,2040,2048,2053,2049,2041,2033,2029,2026,2020,2011,2002,1995,1994,2000,2005,2006,2007,2013,2022,2029,2033,2034,2034,2033,2032,2032,2035,2038,2039,2039,2036,2032,2027,2020,2013,2010,2015,2025,2032,2029,2028,2038,2055,2066,2065,2059,2058,2059,2057,2049,2036,2024,2016,2006,1992,1975,1963,1961,1969,1983,1999,2017,2031,2041,2048,2056,2063,2066,2067,2072,2080,2085,2082,2075,2068,2063,2057,2049,2042,2039,2041,2041,2032,2018,2007,2006,2012,2018,2023,2033,2048,2062,2069,2068,2058,2044,2033,2031,2029,2021,2007,1993,1987,1985,1981,1973,1963,1959,1967,1986,2008,2025,2037,2040,2035,2025,2021,2027,2036,2041,2043,2048,2054,2056,2052,2045,2042,2043,2047,2049,2048,2044,2042,2041,2043,2050,2062,2077,2086,2085,2078,2070,2064,2060,2063,2072,2076,2070,2056,2044,2039,2034,2024,2011,2002,2002,2011,2022,2029,2030,2033,2039,2045,2048,2047,2044,2041,2041,2047,2060,2071,2075,2075,2079,2087,2095,2098,2096,2093,2088,2085,2083,2079,2075,2074,2078,2084,2087,2085,2075,2061,2053,2057,2068,2071,2057,2034,2014,2003,1998,1998,2008,2028,2050,2066,2068,2055,2035,2019,2011,2008,2010,2014,2022,2030,2035,2039,2043,2047,2053,2064,2079,2091,2093,2087,2077,2067,2058,2050,2042,2037,2036,2041,2050,2055,2055,2052,2052,2052,2053,2057,2064,2069,2066,2057,2046,2036,2030,2027,2027,2030,2037,2049,2060,2067,2068,2069,2072,2073,2071,2071,2074,2074,2066,2053,2043,2043,2052,2062,2063,2056,2046,2039,2035,2031,2027,2026,2029,2031,2034,2039,2045,2048,2046,2042,2042,2044,2045,2047,2048,2049,2049,2050,2053,2058,2064,2066,2061,2052,2045,2045,2048,2045,2037,2033,2038,2045,2046,2042,2036,2032,2026,2019,2010,2000,1995,1998,2003,2006,2005,2004,2004,2002,1999,2000,2004,2013,2024,2037,2045,2044,2038,2036,2042,2047,2045,2039,2035,2033,2032,2030,2024,2018,2013,2013,2014,2010,2002,2001,2010,2023,2030,2027,2019,2012,2011,2013,2016,2017,2019,2022,2026,2027,2028,2029,2032,2033,2029,2023,2016,2012,2009,2008,2009,2013,2021,2028,2033,2035,2036,2038,2040,2038,2031,2024,2018,2012,2005,1998,1996,1995,1991,1990,1997,2011,2024,2033,2037,2043,2051,2056,2055,2047,2039,2035,2034,2028,2016,2008,2007,2007,2006,2008,2014,2020,2022,2023,2024,2026,2032,2040,2044,2041,2036,2034,2029,2022,2016,2015,2016,2017,2017,2025,2040,2053,2061,2067,2073,2072,2062,2046,2028,2017,2017,2020,2018,2013,2012,2015,2020,2024,2029,2040,2053,2061,2063,2060,2058,2057,2057,2054,2046,2040,2039,2041,2040,2037,2036,2038,2039,2041,2046,2052,2057,2057,2049,2041,2040,2045,2049,2049,2048,2047,2046,2045,2042,2039,2040,2045,2055,2061,2059,2053,2048,2042,2034,2029,2033,2041,2047,2049,2046,2039,2033,2029,2024,2016,2006,1999,1998,1999,2003,2012,2021,2026,2027,2030,2037,2043,2048,2050,2046,2039,2034,2036,2044,2050,2052,2053,2053,2053,2050,2046,2042,2037,2029,2021,2019,2022,2026,2031,2036,2040,2041,2041,2040,2042,2047,2051,2050,2047,2046,2047,2048,2047,2046,2044,2044,2044,2046,2049,2049,2048,2046,2045,2046,2050,2060,2073,2086,2095,2098,2093,2080,2067,2057,2049,2042,2036,2031,2026,2025,2026,2026,2025,2025,2026,2030,2038,2046,2050,2051,2053,2057,2061,2062,2062,2065,2068,2070,2068,2060,2052,2050,2052,2055,2056,2058,2063,2068,2070,2075,2092,2113,2123,2117,2100,2082,2071,2073,2082,2087,2085,2076,2065,2056,2049,2045,2044,2046,2053,2069,2088,2100,2100,2092,2082,2074,2065,2054,2039,2024,2011,2002,1996,1993,1994,1999,2009,2021,2033,2042,2046,2050,2055,2060,2062,2060,2061,2067,2074,2076,2075,2074,2076,2075,2070,2064,2064,2071,2079,2079,2074,2064,2050,2033,2020,2010,2002,1998,1997,1999,2006,2015,2023,2029,2033,2036,2043,2055,2065,2065,2058,2050,2044,2040,2039,2041,2042,2039,2036,2038,2048,2060,2066,2060,2047,2034,2023,2018,2020,2024,2025,2024,2020,2018,2025,2038,2045,2043,2037,2031,2024,2017,2010,2005,2001,1996,1991,1991,1995,1998,1999,1998,2000,2007,2019,2032,2042,2048,2051,2054,2057,2060,2058,2049,2040,2034,2029,2025,2023,2025,2023,2015,2009,2008,2010,2014,2018,2020,2018,2008,1995,1986,1982,1978,1973,1969,1974,1986,2002,2012,2021,2032,2043,2050,2054,2056,2058,2058,2055,2045,2032,2022,2015,2008,2002,1996,1991,1990,1994,2003,2011,2014,2012,2010,2011,2013,2016,2022,2031,2042,2051,2057,2058,2054,2052,2054,2056,2056,2058,2060,2059,2054,2051,2048,2048,2050,2050,2043,2035,2031,2029,2026,2023,2022,2022,2023,2024,2030,2038,2045,2050,2054,2060,2063,2064,2064,2064,2065,2066,2063,2056,2047,2042,2040,2037,2033,2030,2026,2022,2022,2028,2035,2041,2045,2048,2052,2058,2065,2068,2064,2056,2049,2045,2044,2041,2038,2037,2040,2048,2056,2061,2066,2069,2072,2078,2083,2082,2079,2078,2080,2077,2069,2059,2052,2049,2046,2043,2040,2036,2030,2021,2015,2015,2019,2026,2033,2040,2045,2047,2046,2045,2045,2045,2042,2039,2040,2046,2055,2066,2079,2091,2095,2090,2081,2076,2077,2080,2079,2073,2067,2061,2057,2053,2051,2052,2051,2048,2045,2047,2051,2055,2054,2048,2040,2033,2026,2018,2013,2013,2015,2021,2030,2038,2044,2050,2056,2060,2061,2059,2055,2052,2047,2044,2046,2050,2051,2050,2053,2059,2062,2060,2057,2056,2057,2058,2058,2056,2053,2049,2043,2040,2038,2033,2023,2017,2017,2021,2022,2021,2022,2024,2027,2029,2030,2031,2032,2030,2027,2024,2020,2016,2016,2020,2028,2037,2049,2062,2072,2075,2071,2065,2060,2055,2048,2041,2036,2030,2023,2019,2019,2020,2025,2030,2036,2043,2052,2059,2058,2053,2049,2045,2041,2037,2036,2033,2031,2032,2034,2035,2036,2041,2048,2053,2054,2053,2052,2050,2047,2046,2045,2042,2039,2038,2041,2047,2050,2047,2039,2032,2026,2022,2021,2022,2023,2023,2026,2032,2040,2049,2054,2056,2053,2047,2041,2038,2037,2035,2031,2025,2020,2019,2022,2027,2033,2040,2046,2049,2047,2042,2035,2029,2028,2032,2038,2043,2046,2041,2031,2022,2018,2015,2010,2006,2007,2012,2021,2032,2047,2062,2074,2082,2085,2083,2078,2070,2063,2057,2049,2038,2027,2019,2016,2018,2022,2025,2026,2030,2036,2041,2041,2043,2046,2045,2038,2028,2021,2017,2015,2013,2014,2014,2011,2008,2008,2013,2023,2036,2049,2058,2062,2059,2053,2048,2048,2054,2059,2057,2049,2043,2040,2037,2032,2027,2024,2026,2030,2036,2045,2056,2064,2066,2063,2060,2056,2050,2042,2031,2020,2012,2010,2013,2022,2032,2044,2052,2055,2054,2055,2058,2059,2060,2064,2069,2069,2065,2058,2051,2046,2045,2047,2048,2045,2040,2034,2030,2030,2034,2035,2036,2038,2040,2041,2040,2038,2034,2030,2031,2034,2038,2042,2047,2054,2059,2062,2061,2059,2055,2053,2052,2051,2052,2053,2055,2056,2056,2053,2049,2048,2047,2046,2048,2050,2052,2056,2062,2068,2072,2074,2073,2070,2067,2063,2060,2058,2056,2053,2050,2050,2051,2051,2049,2044,2035,2027,2024,2027,2033,2040,2046,2049,2052,2056,2059,2056,2050,2044,2039,2036,2039,2042,2044,2046,2050,2054,2056,2056,2052,2045,2037,2033,2032,2033,2035,2037,2040,2046,2053,2054,2053,2051,2049,2047,2047,2047,2049,2053,2056,2057,2054,2049,2043,2038,2033,2031,2033,2039,2046,2050,2050,2045,2040,2040,2044,2047,2047,2045,2042,2038,2037,2042,2048,2049,2046,2043,2039,2033,2031,2032,2028,2020,2010,2004,2004,2006,2008,2012,2016,2019,2020,2023,2030,2038,2041,2041,2041,2041,2042,2041,2035,2027,2020,2014,2009,2008,2009,2011,2014,2021,2025,2025,2025,2028,2031,2034,2038,2039,2038,2037,2039,2043,2041,2034,2025,2021,2024,2024,2020,2012,2007,2002,1998,1998,2001,2005,2010,2014,2016,2016,2018,2021,2026,2030,2033,2032,2031,2032,2036,2042,2049,2056,2061,2064,2059,2047,2033,2023,2016,2012,2011,2011,2011,2011,2014,2021,2028,2036,2040,2041,2042,2047,2054,2060,2065,2071,2075,2076,2072,2066,2058,2052,2047,2044,2043,2041,2037,2031,2027,2026,2024,2023,2025,2030,2031,2030,2030,2033,2033,2034,2040,2049,2053,2052,2052,2056,2059,2059,2058,2054,2050,2046,2041,2038,2041,2049,2056,2058,2060,2065,2068,2069,2068,2067,2063,2059,2054,2047,2038,2030,2027,2031,2040,2051,2060,2065,2066,2066,2067,2068,2064,2057,2048,2043,2042,2043,2049,2057,2065,2073,2079,2083,2084,2083,2079,2078,2079,2079,2076,2069,2064,2065,2069,2071,2070,2066,2061,2054,2046,2041,2039,2039,2040,2045,2049,2051,2052,2055,2058,2056,2051,2049,2051,2052,2052,2057,2063,2066,2063,2059,2055,2051,2047,2045,2045,2045,2046,2048,2050,2052,2052,2053,2052,2049,2047,2049,2054,2058,2057,2054,2050,2046,2043,2043,2045,2047,2045,2038,2031,2028,2029,2032,2040,2051,2057,2058,2060,2065,2068,2063,2054,2049,2048,2048,2045,2042,2040,2041,2047,2056,2066,2071,2065,2048,2028,2010,1997,1991,1994,2003,2014,2026,2033,2035,2032,2030,2035,2043,2049,2046,2038,2033,2034,2036,2038,2041,2043,2041,2039,2041,2046,2049,2049,2047,2043,2036,2027,2020,2017,2016,2018,2024,2034,2042,2048,2051,2054,2058,2061,2062,2061,2061,2063,2064,2058,2048,2042,2044,2046,2043,2035,2024,2010,1992,1974,1964,1966,1975,1989,2005,2023,2038,2049,2057,2062,2062,2055,2047,2040,2034,2031,2033,2039,2043,2039,2032,2033,2040,2052,2067,2085,2101,2106,2100,2089,2076,2063,2050,2039,2031,2023,2012,2003,1994,1987,1983,1984,1986,1989,1996,2008,2021,2028,2033,2038,2044,2043,2034,2023,2017,2013,2011,2016,2029,2043,2052,2056,2061,2066,2070,2072,2069,2061,2049,2040,2034,2030,2029,2030,2034,2039,2044,2045,2041,2036,2035,2039,2040,2036,2025,2014,2009,2008,2009,2009,2013,2022,2030,2033,2031,2031,2036,2043,2047,2046,2043,2040,2039,2035,2030,2028,2030,2036,2038,2033,2023,2013,2011,2016,2022,2026,2028,2031,2034,2036,2039,2042,2041,2036,2032,2036,2045,2051,2051,2049,2051,2053,2053,2054,2057,2058,2051,2042,2036,2037,2039,2036,2030,2025,2024,2024,2023,2021,2019,2014,2009,2005,2004,2006,2008,2011,2018,2028,2036,2042,2047,2054,2061,2063,2060,2059,2062,2065,2063,2057,2052,2051,2052,2054,2054,2052,2046,2040,2036,2035,2036,2039,2043,2044,2042,2038,2034,2033,2034,2035,2035,2033,2032,2030,2025,2018,2012,2012,2019,2027,2036,2047,2061,2073,2081,2080,2071,2061,2056,2060,2066,2067,2064,2062,2060,2054,2044,2037,2032,2026,2022,2025,2038,2053,2062,2064,2063,2056,2046,2041,2047,2057,2061,2059,2056,2055,2054,2052,2050,2046,2040,2036,2037,2043,2051,2057,2060,2059,2057,2059,2068,2078,2085,2087,2088,2085,2073,2055,2040,2032,2028,2026,2028,2032,2036,2042,2051,2063,2073,2079,2084,2086,2083,2076,2068,2062,2056,2050,2049,2051,2049,2041,2035,2036,2042,2048,2052,2056,2062,2068,2075,2081,2081,2070,2054,2043,2040,2040,2037,2033,2030,2033,2039,2045,2049,2049,2048,2048,2051,2053,2055,2057,2061,2063,2059,2050,2041,2037,2043,2056,2067,2066,2050,2029,2016,2013,2018,2027,2036,2042,2043,2039,2036,2033,2029,2025,2025,2031,2041,2049,2052,2055,2057,2056,2049,2042,2042,2051,2061,2067,2071,2075,2078,2077,2070,2060,2047,2030,2009,1990,1981,1984,1997,2010,2021,2032,2042,2050,2056,2062,2066,2062,2052,2046,2052,2063,2067,2061,2051,2040,2027,2014,2008,2010,2019,2029,2038,2042,2040,2031,2022,2015,2011,2008,2006,2004,2002,1998,1992,1985,1977,1968,1963,1966,1968,1963,1955,1957,1978,2007,2031,2044,2050,2053,2058,2063,2070,2078,2088,2095,2093,2087,2082,2081,2074,2059,2043,2036,2036,2039,2044,2054,2063,2063,2054,2043,2033,2022,2012,2007,2007,2007,2005,2003,2007,2014,2018,2014,2005,1996,1989,1985,1984,1982,1979,1972,1971,1985,2014,2043,2058,2054,2037,2022,2022,2036,2055,2065,2068,2069,2076,2088,2099,2105,2100,2089,2078,2069,2062,2057,2052,2048,2047,2047,2051,2058,2066,2074,2077,2078,2077,2074,2068,2056,2046,2039,2033,2022,2010,2001,1996,1991,1984,1976,1968,1963,1965,1974,1986,2000,2018,2039,2057,2069,2076,2077,2072,2068,2075,2088,2095,2090,2084,2085,2091,2096,2094,2090,2086,2086,2086,2081,2068,2052,2041,2036,2034,2031,2028,2028,2032,2036,2039,2042,2047,2048,2042,2033,2027,2027,2032,2041,2050,2057,2060,2063,2070,2078,2084,2085,2079,2067,2056,2051,2052,2054,2054,2059,2070,2080,2082,2080,2078,2077,2072,2065,2057,2052,2049,2047,2042,2034,2028,2028,2032,2033,2032,2031,2029,2028,2030,2038,2049,2057,2059,2058,2057,2057,2059,2058,2051,2039,2031,2032,2040,2049,2058,2066,2070,2067,2059,2051,2046,2044,2041,2035,2029,2026,2023,2024,2029,2038,2046,2052,2056,2058,2058,2057,2060,2065,2070,2075,2084,2094,2098,2092,2077,2061,2049,2047,2049,2046,2035,2028,2031,2037,2037,2033,2029,2023,2014,2010,2017,2027,2026,2017,2012,2017,2026,2032,2035,2035,2032,2028,2030,2041,2056,2066,2069,2070,2072,2074,2070,2067,2067,2072,2076,2075,2069,2057,2043,2034,2031,2037,2048,2063,2076,2085,2094,2103,2103,2090,2075,2071,2073,2067,2056,2050,2054,2058,2053,2042,2031,2023,2018,2021,2033,2050,2065,2073,2071,2059,2045,2033,2022,2010,2000,2001,2014,2035,2054,2066,2072,2077,2081,2082,2078,2071,2062,2052,2045,2044,2047,2047,2046,2046,2049,2051,2052,2053,2054,2056,2058,2063,2064,2061,2056,2052,2048,2046,2044,2043,2040,2035,2030,2023,2013,2004,2003,2007,2011,2013,2017,2025,2038,2055,2073,2087,2094,2097,2097,2094,2086,2073,2053,2029,2010,2003,2003,2006,2012,2025,2040,2049,2052,2058,2069,2081,2088,2092,2093,2089,2079,2064,2049,2037,2026,2007,1985,1968,1965,1972,1979,1983,1986,1987,1989,1993,2003,2021,2048,2076,2096,2100,2095,2088,2082,2080,2091,2111,2122,2104,2067,2033,2016,2011,2008,1998,1981,1964,1959,1966,1976,1983,1991,2003,2016,2025,2030,2036,2047,2064,2083,2094,2091,2077,2062,2055,2054,2055,2057,2062,2069,2076,2078,2075,2068,2058,2044,2033,2033,2037,2035,2026,2023,2029,2038,2042,2044,2045,2042,2033,2021,2012,2006,2004,2009,2018,2027,2037,2048,2057,2060,2058,2053,2045,2032,2019,2010,2004,2001,2001,2010,2024,2040,2057,2072,2085,2094,2098,2098,2097,2097,2098,2101,2105,2104,2095,2080,2068,2066,2072,2077,2070,2052,2025,1998,1981,1977,1978,1978,1976,1976,1977,1977,1973,1967,1959,1951,1945,1944,1949,1960,1977,1998,2021,2045,2062,2068,2068,2075,2093,2112,2122,2127,2134,2144,2150,2151,2143,2126,2103,2081,2065,2056,2050,2050,2057,2070,2083,2093,2092,2082,2072,2065,2059,2049,2037,2027,2021,2018,2020,2028,2033,2026,2010,1997,1996,2004,2012,2015,2015,2014,2012,2008,2004,2004,2007,2011,2014,2017,2014,2006,1995,1989,1982,1973,1962,1957,1956,1959,1974,2005,2042,2074,2095,2109,2118,2121,2117,2110,2106,2103,2102,2099,2095,2089,2086,2087,2091,2095,2095,2091,2084,2077,2072,2067,2060,2051,2045,2043,2042,2040,2041,2046,2055,2062,2064,2066,2071,2075,2072,2067,2068,2071,2069,2063,2062,2067,2069,2063,2054,2049,2045,2042,2037,2031,2023,2014,2006,1996,1982,1969,1963,1964,1974,1991,2014,2037,2055,2072,2092,2113,2130,2142,2150,2153,2152,2146,2135,2118,2101,2086,2074,2069,2071,2079,2084,2082,2078,2076,2075,2069,2061,2051,2043,2035,2030,2034,2043,2053,2058,2057,2053,2050,2044,2038,2035,2040,2048,2053,2055,2056,2059,2064,2070,2079,2092,2101,2103,2097,2090,2088,2085,2075,2060,2050,2049,2053,2054,2053,2056,2062,2062,2054,2045,2040,2037,2029,2015,1996,1982,1976,1979,1983,1985,1986,1990,1996,2002,2009,2017,2028,2039,2051,2061,2070,2077,2081,2080,2076,2069,2060,2049,2040,2037,2037,2037,2037,2039,2040,2036,2032,2033,2036,2033,2022,2009,1998,1989,1982,1978,1977,1982,1994,2013,2030,2036,2034,2028,2022,2015,2008,2002,1998,1997,2000,2005,2008,2008,2006,2005,2004,2003,2007,2015,2023,2028,2032,2038,2047,2054,2055,2051,2046,2040,2033,2025,2021,2022,2027,2032,2033,2030,2022,2011,2002,1995,1989,1987,1988,1991,1997,2008,2021,2031,2037,2043,2054,2065,2071,2068,2058,2047,2039,2033,2027,2022,2021,2023,2023,2020,2019,2019,2019,2017,2017,2020,2023,2022,2018,2011,2005,2004,2008,2014,2017,2018,2023,2035,2048,2057,2061,2062,2060,2056,2050,2049,2056,2068,2078,2084,2087,2092,2095,2092,2084,2077,2071,2062,2048,2036,2033,2035,2038,2041,2047,2053,2055,2051,2049,2053,2062,2068,2066,2057,2045,2033,2023,2017,2017,2019,2020,2018,2016,2017,2021,2023,2026,2034,2049,2064,2076,2082,2083,2077,2064,2050,2039,2035,2037,2043,2047,2048,2049,2053,2058,2061,2062,2066,2071,2075,2079,2086,2095,2099,2092,2076,2061,2050,2045,2043,2043,2044,2047,2053,2063,2075,2087,2095,2096,2089,2080,2072,2064,2055,2047,2039,2035,2034,2041,2053,2062,2062,2057,2051,2047,2043,2041,2044,2052,2060,2065,2067,2070,2073,2077,2082,2088,2092,2095,2096,2096,2094,2092,2087,2079,2066,2050,2034,2022,2019,2022,2026,2028,2029,2034,2044,2055,2064,2071,2073,2070,2064,2059,2060,2064,2067,2067,2065,2061,2060,2064,2073,2085,2093,2094,2090,2080,2069,2062,2061,2063,2062,2054,2044,2037,2036,2038,2038,2036,2035,2039,2046,2051,2053,2050,2047,2046,2048,2049,2049,2049,2052,2059,2065,2069,2075,2085,2098,2109,2114,2113,2109,2101,2094,2090,2086,2080,2073,2068,2068,2072,2074,2070,2059,2044,2030,2022,2019,2022,2028,2034,2037,2036,2035,2035,2038,2041,2043,2047,2055,2069,2084,2091,2088,2080,2074,2071,2068,2062,2055,2053,2055,2060,2065,2071,2079,2087,2092,2090,2081,2068,2055,2045,2038,2035,2037,2040,2044,2048,2050,2049,2049,2054,2067,2079,2084,2081,2078,2076,2076,2074,2069,2062,2056,2055,2060,2065,2063,2056,2051,2049,2049,2050,2054,2061,2069,2075,2081,2083,2083,2081,2082,2083,2081,2074,2068,2068,2071,2072,2068,2060,2054,2050,2047,2045,2046,2051,2056,2058,2057,2055,2057,2056,2052,2047,2044,2043,2040,2038,2040,2042,2044,2043,2041,2039,2039,2044,2052,2059,2063,2067,2072,2079,2087,2095,2099,2099,2097,2093,2088,2080,2071,2062,2055,2049,2044,2043,2044,2044,2044,2043,2040,2034,2025,2016,2009,2005,2005,2011,2017,2021,2025,2036,2050,2060,2063,2058,2050,2045,2045,2050,2053,2056,2061,2070,2079,2085,2086,2083,2082,2083,2084,2081,2070,2054,2041,2035,2032,2027,2022,2017,2013,2007,2002,1999,2000,2005,2014,2023,2032,2044,2059,2071,2076,2072,2065,2058,2052,2046,2039,2035,2035,2037,2038,2040,2046,2056,2067,2072,2069,2058,2044,2034,2032,2039,2050,2059,2061,2059,2057,2056,2054,2046,2031,2014,2003,2001,2007,2018,2030,2041,2047,2048,2046,2043,2040,2036,2034,2038,2046,2053,2056,2055,2053,2053,2054,2051,2046,2044,2049,2057,2063,2065,2062,2057,2053,2051,2054,2057,2056,2051,2045,2042,2044,2046,2047,2048,2050,2052,2050,2043,2037,2036,2040,2042,2042,2041,2043,2047,2052,2057,2061,2062,2063,2066,2071,2074,2076,2075,2073,2070,2068,2066,2061,2053,2044,2038,2036,2040,2048,2052,2051,2047,2044,2044,2046,2050,2055,2058,2059,2061,2066,2073,2079,2085,2095,2104,2102,2089,2073,2061,2052,2045,2039,2037,2037,2043,2054,2064,2068,2068,2071,2076,2079,2074,2062,2048,2037,2029,2024,2026,2034,2043,2046,2045,2042,2040,2042,2048,2053,2054,2054,2056,2060,2062,2062,2060,2060,2063,2067,2069,2068,2063,2052,2038,2030,2028,2033,2043,2059,2075,2082,2081,2075,2068,2059,2051,2049,2051,2054,2058,2062,2065,2068,2073,2078,2082,2080,2073,2064,2057,2054,2051,2044,2035,2030,2032,2041,2053,2062,2068,2069,2064,2055,2048,2045,2044,2043,2046,2050,2051,2046,2040,2036,2034,2034,2039,2045,2048,2050,2056,2066,2070,2067,2061,2059,2060,2061,2063,2064,2063,2057,2052,2053,2056,2054,2045,2035,2029,2024,2020,2020,2023,2028,2033,2040,2043,2041,2035,2027,2024,2028,2036,2045,2052,2057,2060,2063,2065,2068,2070,2072,2073,2074,2075,2077,2078,2075,2073,2074,2077,2079,2083,2092,2102,2105,2102,2096,2091,2085,2078,2069,2058,2047,2040,2036,2035,2034,2033,2030,2025,2022,2022,2023,2024,2023,2020,2017,2014,2008,2004,2003,2007,2014,2025,2036,2045,2054,2069,2086,2096,2095,2088,2078,2063,2048,2041,2043,2050,2058,2065,2069,2070,2068,2067,2069,2075,2083,2090,2092,2089,2082,2075,2068,2062,2059,2062,2070,2079,2086,2096,2102,2096,2079,2058,2043,2031,2022,2017,2015,2016,2019,2024,2032,2041,2051,2061,2072,2081,2080,2066,2043,2019,1998,1979,1968,1968,1977,1989,1999,2010,2023,2039,2054,2067,2078,2087,2095,2104,2107,2103,2094,2087,2089,2096,2105,2115,2125,2134,2136,2134,2130,2126,2123,2119,2112,2098,2078,2057,2042,2036,2038,2042,2041,2036,2034,2032,2024,2009,1995,1991,1996,2007,2019,2030,2039,2045,2052,2058,2062,2060,2057,2056,2057,2059,2065,2076,2086,2091,2094,2100,2103,2099,2094,2094,2096,2094,2088,2084,2080,2079,2084,2092,2094,2086,2076,2071,2073,2081,2094,2106,2109,2103,2092,2082,2075,2069,2064,2062,2061,2056,2045,2029,2013,2004,2007,2020,2038,2055,2066,2072,2076,2083,2092,2093,2088,2082,2079,2076,2070,2060,2047,2033,2026,2030,2042,2054,2064,2074,2083,2090,2097,2103,2109,2114,2120,2125,2129,2130,2124,2114,2101,2087,2073,2059,2047,2037,2031,2030,2033,2037,2042,2049,2055,2063,2072,2081,2086,2086,2084,2084,2084,2082,2080,2080,2084,2086,2085,2081,2075,2067,2058,2054,2059,2068,2073,2069,2058,2046,2037,2030,2024,2020,2021,2025,2027,2025,2027,2036,2048,2058,2065,2068,2067,2066,2069,2078,2088,2096,2103,2111,2119,2124,2123,2117,2108,2097,2084,2073,2060,2047,2036,2031,2029,2025,2019,2016,2017,2020,2021,2026,2034,2045,2052,2053,2050,2047,2047,2047,2046,2045,2047,2052,2059,2065,2069,2071,2072,2074,2079,2084,2088,2091,2092,2093,2092,2088,2083,2074,2062,2049,2039,2035,2034,2032,2028,2021,2014,2009,2008,2008,2005,2003,2005,2010,2018,2026,2037,2048,2060,2071,2081,2087,2090,2090,2087,2081,2073,2064,2056,2052,2053,2054,2054,2051,2049,2049,2048,2046,2044,2045,2048,2053,2060,2068,2076,2078,2072,2061,2049,2039,2035,2034,2033,2030,2028,2030,2032,2034,2037,2043,2048,2055,2061,2066,2067,2065,2062,2059,2057,2057,2057,2055,2052,2051,2053,2057,2061,2065,2068,2070,2069,2066,2057,2048,2041,2039,2038,2038,2039,2041,2042,2042,2041,2044,2052,2060,2063,2062,2062,2064,2067,2068,2069,2068,2066,2064,2064,2065,2064,2065,2066,2068,2069,2067,2065,2062,2057,2051,2048,2047,2044,2040,2038,2040,2043,2046,2048,2050,2050,2050,2052,2053,2054,2057,2065,2074,2081,2084,2085,2085,2083,2080,2074,2066,2061,2062,2066,2074,2086,2099,2106,2105,2098,2088,2074,2058,2046,2038,2030,2022,2018,2019,2023,2028,2032,2036,2043,2051,2061,2070,2075,2075,2074,2076,2082,2087,2088,2082,2072,2062,2056,2057,2061,2063,2066,2069,2073,2075,2077,2077,2074,2071,2071,2075,2077,2076,2068,2056,2044,2039,2044,2054,2065,2074,2080,2081,2080,2078,2079,2082,2086,2089,2088,2081,2073,2066,2064,2063,2063,2066,2070,2071,2068,2064,2061,2057,2050,2045,2044,2047,2049,2052,2055,2060,2064,2066,2062,2053,2040,2030,2024,2023,2025,2028,2033,2042,2053,2063,2071,2075,2075,2074,2074,2075,2077,2077,2076,2074,2070,2064,2058,2051,2044,2042,2045,2052,2060,2067,2072,2075,2073,2071,2068,2068,2066,2061,2055,2051,2053,2058,2061,2063,2064,2065,2063,2061,2060,2063,2067,2075,2087,2100,2112,2116,2109,2092,2070,2048,2028,2015,2007,2003,2004,2009,2016,2018,2018,2020,2027,2040,2057,2074,2087,2093,2094,2092,2090,2086,2083,2083,2082,2082,2081,2077,2068,2054,2044,2040,2040,2042,2044,2048,2052,2055,2053,2048,2044,2044,2049,2056,2061,2064,2067,2071,2074,2073,2072,2071,2067,2061,2055,2049,2046,2047,2048,2046,2044,2049,2059,2069,2074,2077,2075,2068,2060,2056,2055,2053,2049,2041,2035,2032,2034,2039,2045,2051,2058,2065,2070,2072,2071,2067,2062,2059,2058,2056,2055,2054,2054,2054,2056,2064,2074,2084,2090,2091,2085,2075,2067,2064,2067,2073,2079,2081,2078,2073,2071,2073,2076,2076,2070,2060,2051,2044,2039,2038,2037,2034,2030,2028,2031,2035,2036,2037,2043,2051,2059,2064,2067,2069,2072,2078,2085,2089,2089,2088,2086,2082,2078,2077,2081,2089,2099,2109,2119,2124,2121,2111,2097,2082,2071,2065,2061,2059,2058,2060,2063,2065,2066,2066,2064,2058,2049,2042,2035,2029,2024,2020,2020,2024,2031,2037,2042,2044,2041,2034,2027,2026,2031,2041,2049,2054,2056,2059,2066,2075,2088,2102,2111,2111,2102,2089,2079,2072,2068,2067,2066,2062,2057,2056,2057,2058,2058,2059,2059,2057,2055,2053,2051,2051,2054,2062,2071,2077,2080,2081,2082,2082,2080,2079,2078,2076,2074,2075,2077,2080,2082,2084,2087,2086,2081,2070,2054,2038,2027,2025,2029,2031,2028,2021,2014,2014,2020,2027,2032,2035,2035,2034,2030,2029,2034,2043,2053,2061,2068,2074,2077,2079,2084,2090,2092,2088,2080,2071,2064,2061,2060,2060,2057,2049,2041,2034,2029,2026,2025,2025,2028,2031,2036,2041,2049,2059,2065,2065,2062,2060,2060,2058,2057,2057,2060,2065,2069,2071,2073,2074,2077,2081,2083,2085,2087,2089,2089,2085,2076,2068,2067,2074,2078,2075,2067,2059,2054,2052,2050,2048,2045,2041,2039,2038,2038,2039,2040,2045,2051,2057,2061,2065,2071,2076,2080,2086,2095,2103,2102,2096,2091,2092,2095,2095,2090,2082,2074,2065,2059,2054,2049,2041,2033,2026,2021,2017,2011,2007,2007,2010,2017,2024,2032,2042,2053,2065,2076,2085,2090,2092,2091,2087,2083,2079,2078,2082,2087,2088,2088,2090,2095,2099,2102,2102,2099,2092,2083,2073,2068,2069,2074,2079,2081,2079,2076,2075,2078,2083,2088,2092,2095,2097,2093,2085,2074,2065,2057,2053,2051,2051,2053,2059,2068,2074,2075,2074,2072,2067,2060,2052,2049,2050,2053,2055,2053,2048,2042,2040,2042,2047,2055,2062,2066,2070,2076,2085,2092,2094,2092,2091,2093,2098,2103,2108,2112,2111,2104,2094,2086,2082,2081,2082,2083,2082,2077,2071,2066,2063,2060,2057,2055,2055,2056,2054,2050,2044,2039,2036,2038,2042,2047,2050,2051,2054,2060,2068,2074,2075,2072,2068,2068,2070,2074,2077,2077,2074,2068,2061,2054,2049,2046,2048,2054,2062,2071,2080,2090,2095,2097,2097,2097,2095,2091,2087,2085,2084,2082,2082,2083,2085,2086,2084,2080,2076,2070,2064,2061,2057,2052,2044,2036,2028,2019,2009,1999,1993,1995,2004,2014,2024,2032,2037,2040,2040,2039,2041,2046,2052,2054,2055,2057,2060,2064,2068,2074,2082,2090,2098,2107,2116,2122,2126,2128,2123,2112,2097,2081,2069,2064,2063,2063,2061,2057,2052,2045,2036,2027,2021,2019,2017,2011,2000,1988,1979,1972,1974,1985,2005,2025,2043,2056,2067,2073,2075,2074,2073,2073,2074,2078,2084,2091,2096,2098,2096,2091,2084,2073,2061,2051,2047,2048,2051,2052,2053,2057,2064,2073,2084,2095,2102,2104,2102,2096,2086,2072,2058,2046,2036,2027,2021,2018,2020,2024,2029,2033,2036,2038,2044,2053,2062,2068,2068,2067,2068,2073,2079,2083,2085,2087,2090,2094,2097,2097,2094,2088,2080,2071,2063,2058,2056,2053,2047,2042,2041,2045,2053,2061,2065,2068,2071,2072,2071,2070,2072,2074,2070,2061,2054,2053,2055,2055,2050,2046,2045,2043,2040,2040,2046,2056,2062,2062,2060,2059,2059,2055,2051,2050,2053,2058,2062,2062,2060,2056,2053,2052,2054,2059,2061,2056,2051,2051,2056,2060,2061,2061,2062,2063,2064,2068,2073,2076,2078,2078,2078,2080,2082,2082,2077,2069,2061,2054,2050,2051,2058,2066,2070,2065,2058,2053,2050,2048,2042,2033,2024,2017,2016,2021,2031,2043,2054,2060,2064,2066,2068,2070,2072,2074,2074,2072,2068,2064,2063,2065,2066,2062,2057,2056,2059,2063,2064,2060,2055,2049,2043,2038,2037,2041,2045,2049,2051,2052,2055,2060,2064,2065,2065,2064,2063,2062,2062,2064,2067,2070,2072,2073,2073,2071,2068,2066,2067,2067,2065,2061,2055,2045,2035,2030,2029,2029,2030,2034,2043,2056,2070,2080,2083,2081,2079,2079,2077,2070,2060,2050,2042,2039,2041,2046,2050,2051,2049,2041,2031,2023,2025,2034,2045,2052,2053,2050,2048,2051,2060,2072,2081,2086,2087,2086,2084,2085,2086,2084,2080,2076,2074,2075,2080,2088,2094,2097,2098,2097,2095,2094,2092,2090,2086,2077,2061,2043,2030,2022,2019,2021,2026,2030,2029,2024,2016,2011,2012,2019,2030,2042,2052,2057,2061,2068,2078,2087,2092,2091,2088,2087,2088,2088,2084,2076,2063,2046,2034,2030,2034,2044,2052,2053,2046,2042,2044,2050,2055,2055,2051,2046,2044,2049,2059,2068,2074,2074,2073,2074,2080,2090,2098,2101,2099,2096,2093,2093,2096,2097,2093,2084,2076,2068,2061,2059,2067,2080,2087,2084,2075,2064,2051,2041,2036,2038,2045,2053,2057,2055,2052,2050,2043,2034,2028,2030,2041,2056,2071,2086,2098,2109,2116,2119,2115,2108,2099,2090,2081,2073,2068,2065,2058,2051,2051,2058,2063,2062,2056,2049,2045,2042,2040,2040,2044,2049,2048,2041,2037,2038,2041,2042,2041,2039,2036,2033,2032,2032,2035,2036,2036,2040,2045,2047,2047,2048,2052,2057,2064,2072,2077,2076,2073,2072,2077,2086,2092,2090,2084,2078,2076,2076,2074,2069,2064,2063,2066,2074,2087,2099,2104,2102,2099,2098,2095,2091,2086,2079,2070,2061,2054,2047,2039,2032,2031,2031,2031,2030,2028,2023,2017,2018,2024,2032,2036,2038,2039,2041,2043,2045,2046,2046,2044,2043,2044,2045,2046,2047,2047,2048,2053,2062,2072,2078,2078,2074,2070,2069,2073,2079,2086,2093,2092,2085,2076,2071,2070,2068,2063,2051,2039,2034,2036,2044,2057,2075,2091,2097,2097,2098,2099,2097,2091,2081,2072,2067,2065,2064,2064,2061,2055,2050,2046,2040,2032,2028,2032,2040,2045,2044,2039,2036,2040,2047,2057,2069,2079,2081,2074,2063,2053,2046,2040,2037,2036,2038,2041,2045,2050,2053,2050,2045,2042,2044,2048,2053,2058,2066,2073,2078,2078,2074,2066,2063,2067,2076,2082,2083,2078,2073,2075,2081,2083,2080,2073,2068,2064,2061,2062,2065,2064,2056,2043,2033,2030,2031,2032,2035,2037,2038,2040,2044,2044,2041,2040,2042,2043,2043,2042,2041,2042,2047,2049,2042,2031,2030,2041,2054,2060,2058,2051,2043,2040,2046,2061,2075,2077,2070,2064,2066,2075,2083,2080,2069,2058,2053,2049,2041,2034,2033,2035,2038,2042,2048,2058,2070,2079,2080,2076,2070,2064,2057,2048,2039,2030,2024,2019,2014,2009,2007,2011,2020,2031,2042,2047,2046,2046,2054,2070,2086,2096,2101,2104,2106,2104,2098,2093,2088,2082,2070,2056,2044,2035,2033,2034,2035,2032,2029,2030,2034,2043,2056,2068,2073,2074,2073,2073,2072,2069,2061,2048,2032,2018,2009,2006,2006,2004,2002,2002,2008,2019,2034,2046,2056,2067,2078,2082,2081,2082,2085,2088,2092,2099,2104,2104,2103,2102,2099,2091,2081,2070,2058,2049,2043,2041,2042,2043,2044,2044,2043,2044,2048,2051,2050,2051,2055,2058,2061,2065,2067,2064,2058,2056,2055,2053,2054,2058,2064,2067,2067,2065,2064,2065,2064,2060,2054,2051,2051,2053,2059,2069,2076,2076,2072,2072,2076,2079,2078,2076,2074,2075,2076,2074,2065,2054,2048,2050,2056,2061,2065,2067,2069,2072,2069,2062,2060,2071,2081,2078,2067,2068,2075,2071,2059,2055,2056,2052,2050,2057,2066,2064,2056,2048,2041,2037,2041,2049,2052,2051,2056,2067,2073,2071,2068,2072,2079,2083,2083,2079,2074,2071,2069,2068,2069,2069,2065,2056,2051,2052,2055,2055,2055,2054,2048,2042,2042,2043,2039,2029,2021,2019,2021,2029,2044,2061,2073,2080,2086,2090,2090,2088,2085,2078,2068,2058,2052,2049,2049,2054,2058,2060,2062,2063,2061,2055,2052,2054,2058,2063,2070,2079,2085,2088,2090,2092,2089,2082,2071,2058,2050,2046,2044,2042,2043,2044,2043,2037,2031,2026,2025,2026,2031,2034,2036,2035,2033,2032,2034,2040,2044,2047,2053,2060,2068,2075,2078,2077,2075,2076,2081,2086,2086,2081,2074,2072,2071,2068,2063,2059,2056,2052,2049,2043,2036,2031,2038,2051,2062,2065,2065,2068,2072,2073,2073,2072,2071,2068,2060,2048,2036,2030,2028,2030,2036,2045,2054,2061,2063,2061,2056,2052,2053,2057,2062,2065,2065,2061,2054,2049,2044,2035,2026,2021,2019,2019,2018,2015,2011,2011,2018,2029,2039,2044,2047,2049,2051,2053,2056,2060,2062,2063,2067,2074,2080,2082,2080,2076,2068,2058,2053,2056,2063,2067,2069,2068,2066,2067,2071,2072,2067,2064,2062,2058,2051,2045,2039,2032,2030,2037,2048,2059,2066,2071,2074,2077,2084,2092,2096,2094,2087,2079,2070,2059,2047,2037,2032,2029,2030,2033,2033,2027,2016,2012,2016,2021,2022,2020,2019,2023,2028,2035,2046,2059,2069,2072,2068,2061,2055,2053,2055,2055,2052,2051,2051,2053,2056,2062,2066,2065,2061,2062,2068,2071,2069,2066,2063,2061,2060,2063,2067,2067,2067,2066,2067,2071,2073,2070,2063,2058,2055,2054,2057,2061,2062,2059,2057,2059,2062,2062,2061,2059,2057,2056,2057,2058,2056,2056,2060,2064,2063,2062,2062,2058,2048,2039,2033,2026,2017,2009,2005,2006,2011,2019,2027,2032,2035,2036,2034,2030,2027,2030,2037,2043,2046,2047,2045,2043,2043,2047,2050,2053,2059,2066,2069,2069,2069,2069,2066,2061,2059,2059,2057,2052,2045,2040,2040,2044,2050,2054,2057,2059,2060,2060,2060,2060,2061,2063,2061,2054,2045,2043,2050,2057,2057,2051,2043,2040,2041,2041,2033,2023,2014,2009,2007,2012,2025,2040,2051,2057,2061,2065,2067,2066,2061,2055,2049,2045,2044,2044,2042,2035,2029,2029,2036,2044,2050,2055,2058,2061,2067,2076,2084,2088,2090,2092,2094,2092,2084,2072,2061,2054,2051,2049,2046,2041,2035,2034,2037,2041,2046,2054,2066,2079,2091,2101,2105,2104,2103,2103,2100,2093,2082,2066,2048,2031,2021,2015,2010,2005,2005,2009,2014,2013,2011,2011,2015,2018,2023,2034,2051,2066,2076,2082,2085,2085,2085,2085,2082,2074,2065,2059,2058,2060,2064,2067,2070,2077,2086,2094,2099,2103,2106,2102,2093,2084,2077,2072,2071,2070,2065,2058,2052,2047,2042,2036,2029,2019,2007,1999,1998,2002,2006,2010,2017,2029,2044,2058,2069,2075,2082,2091,2101,2104,2098,2087,2077,2067,2058,2051,2046,2041,2038,2040,2047,2053,2059,2067,2078,2085,2084,2077,2067,2057,2047,2039,2036,2038,2044,2052,2059,2063,2062,2059,2060,2066,2074,2079,2083,2085,2083,2075,2068,2065,2062,2055,2046,2039,2036,2035,2035,2031,2027,2024,2023,2026,2029,2031,2034,2040,2042,2039,2033,2031,2033,2038,2044,2051,2054,2051,2049,2050,2053,2053,2055,2062,2072,2083,2092,2096,2093,2083,2073,2068,2069,2072,2071,2064,2057,2051,2046,2041,2039,2040,2043,2043,2042,2044,2045,2043,2038,2036,2034,2030,2026,2026,2032,2039,2047,2057,2064,2065,2063,2062,2062,2061,2059,2057,2054,2050,2046,2046,2048,2052,2053,2054,2061,2074,2085,2086,2085,2087,2086,2079,2066,2054,2047,2046,2048,2050,2046,2038,2028,2018,2009,2000,1990,1982,1978,1980,1987,2001,2017,2029,2033,2035,2040,2047,2050,2052,2053,2055,2056,2057,2061,2064,2066,2067,2066,2062,2059,2060,2066,2070,2068,2061,2055,2054,2058,2061,2060,2057,2058,2062,2069,2070,2062,2047,2033,2023,2018,2021,2031,2043,2047,2043,2035,2029,2027,2027,2027,2025,2022,2021,2022,2023,2024,2025,2028,2030,2030,2030,2036,2048,2062,2074,2083,2084,2079,2070,2065,2065,2067,2067,2064,2059,2053,2049,2047,2047,2046,2041,2033,2026,2019,2014,2010,2007,2006,2008,2012,2021,2031,2040,2051,2064,2078,2089,2094,2091,2081,2067,2053,2042,2035,2029,2025,2024,2026,2032,2038,2042,2042,2041,2042,2048,2056,2066,2072,2071,2065,2059,2057,2054,2049,2043,2036,2025,2011,2000,1995,1997,2006,2018,2029,2039,2051,2065,2076,2081,2081,2080,2078,2074,2070,2068,2065,2060,2053,2049,2050,2052,2052,2051,2049,2046,2043,2042,2044,2051,2061,2070,2072,2066,2058,2054,2055,2060,2066,2069,2068,2065,2064,2066,2067,2065,2060,2053,2047,2044,2040,2031,2021,2016,2021,2031,2042,2050,2050,2045,2043,2047,2052,2056,2058,2061,2061,2058,2057,2061,2065,2066,2065,2068,2076,2083,2087,2088,2088,2089,2090,2088,2083,2077,2069,2061,2054,2048,2042,2039,2037,2036,2035,2036,2038,2040,2043,2046,2048,2051,2055,2061,2066,2070,2074,2080,2085,2088,2090,2089,2087,2082,2077,2074,2075,2076,2075,2071,2065,2060,2055,2053,2054,2059,2065,2072,2080,2085,2089,2090,2087,2081,2070,2059,2047,2038,2030,2024,2020,2019,2023,2030,2038,2047,2057,2065,2069,2072,2074,2077,2080,2084,2090,2094,2095,2092,2088,2085,2080,2073,2062,2049,2037,2031,2030,2032,2034,2033,2031,2031,2033,2037,2041,2044,2048,2055,2061,2065,2068,2071,2073,2073,2075,2079,2084,2088,2091,2090,2083,2072,2061,2051,2046,2048,2057,2065,2069,2068,2064,2060,2055,2051,2046,2037,2027,2016,2005,1996,1993,1998,2009,2023,2033,2036,2032,2028,2030,2037,2043,2045,2044,2040,2038,2040,2046,2054,2058,2058,2054,2050,2049,2050,2053,2056,2061,2066,2068,2067,2066,2065,2066,2069,2071,2070,2065,2061,2058,2052,2047,2044,2045,2046,2047,2050,2050,2045,2039,2037,2036,2036,2036,2037,2038,2039,2041,2043,2043,2043,2044,2046,2044,2040,2038,2039,2041,2042,2040,2037,2034,2034,2035,2036,2037,2043,2052,2062,2069,2073,2075,2074,2071,2068,2064,2059,2054,2051,2046,2041,2037,2035,2033,2030,2027,2024,2023,2025,2032,2042,2053,2063,2069,2071,2071,2071,2070,2067,2061,2054,2046,2040,2037,2034,2030,2026,2026,2032,2039,2045,2048,2047,2045,2042,2039,2034,2028,2025,2028,2036,2047,2056,2059,2056,2052,2052,2056,2060,2062,2062,2059,2055,2053,2054,2057,2061,2064,2067,2068,2067,2065,2063,2061,2060,2059,2058,2055,2054,2053,2050,2045,2040,2039,2040,2040,2038,2036,2036,2039,2046,2055,2062,2064,2061,2056,2050,2046,2042,2041,2042,2041,2039,2041,2049,2057,2060,2056,2049,2042,2037,2035,2037,2039,2040,2041,2043,2044,2045,2045,2045,2046,2047,2050,2052,2051,2049,2051,2058,2062,2060,2055,2052,2053,2057,2062,2066,2069,2070,2070,2066,2059,2054,2053,2051,2050,2051,2052,2053,2054,2056,2057,2054,2051,2048,2046,2048,2049,2049,2047,2047,2050,2053,2054,2052,2048,2044,2041,2041,2041,2041,2039,2040,2043,2047,2052,2055,2056,2058,2062,2070,2077,2077,2070,2061,2054,2048,2042,2034,2025,2018,2015,2017,2022,2027,2032,2036,2040,2043,2046,2048,2049,2050,2053,2055,2055,2054,2052,2049,2044,2039,2035,2033,2035,2040,2044,2047,2048,2047,2044,2043,2043,2041,2033,2026,2026,2030,2033,2032,2028,2024,2021,2022,2028,2036,2042,2045,2045,2041,2037,2036,2039,2044,2048,2052,2054,2055,2059,2066,2076,2086,2090,2083,2069,2055,2047,2042,2036,2027,2018,2014,2017,2022,2026,2027,2027,2026,2026,2027,2028,2027,2027,2030,2038,2045,2051,2056,2060,2065,2070,2075,2077,2075,2069,2063,2057,2054,2054,2051,2043,2035,2031,2030,2031,2033,2037,2044,2051,2057,2063,2066,2067,2066,2064,2066,2069,2070,2068,2066,2067,2066,2063,2056,2050,2047,2049,2050,2047,2039,2031,2027,2025,2026,2028,2033,2042,2053,2064,2073,2082,2092,2099,2101,2097,2090,2084,2082,2084,2085,2082,2077,2072,2069,2069,2070,2070,2066,2059,2053,2050,2048,2047,2047,2049,2053,2058,2062,2062,2061,2061,2064,2067,2067,2063,2059,2057,2059,2062,2063,2061,2058,2059,2061,2064,2064,2062,2056,2049,2045,2043,2044,2046,2046,2045,2044,2044,2047,2052,2058,2063,2067,2068,2069,2069,2065,2059,2053,2051,2054,2059,2063,2061,2057,2056,2061,2070,2077,2076,2066,2053,2042,2036,2032,2029,2028,2033,2042,2053,2061,2065,2066,2067,2068,2072,2077,2079,2076,2068,2058,2047,2039,2035,2034,2032,2027,2023,2025,2030,2034,2036,2037,2038,2039,2040,2040,2039,2039,2039,2040,2044,2051,2059,2064,2064,2063,2061,2058,2053,2047,2044,2044,2047,2050,2053,2052,2048,2042,2037,2035,2033,2028,2022,2019,2022,2030,2041,2052,2060,2061,2061,2063,2068,2072,2073,2071,2070,2068,2065,2060,2054,2049,2044,2041,2040,2039,2038,2038,2038,2038,2038,2037,2038,2040,2045,2050,2054,2054,2050,2042,2036,2032,2031,2031,2031,2033,2039,2048,2053,2052,2050,2052,2055,2056,2053,2049,2046,2045,2045,2047,2052,2059,2065,2067,2068,2072,2076,2078,2076,2072,2068,2064,2063,2061,2057,2053,2048,2043,2041,2042,2042,2038,2030,2020,2013,2012,2018,2024,2028,2032,2035,2040,2046,2054,2062,2069,2074,2078,2080,2079,2076,2071,2067,2063,2060,2053,2044,2035,2030,2029,2030,2033,2038,2042,2044,2044,2045,2047,2050,2053,2053,2050,2049,2051,2054,2056,2057,2056,2053,2052,2054,2058,2059,2059,2060,2063,2066,2067,2065,2061,2055,2049,2045,2043,2042,2042,2044,2046,2047,2046,2040,2033,2027,2024,2022,2021,2022,2024,2027,2031,2034,2038,2043,2050,2055,2059,2060,2058,2055,2053,2052,2054,2057,2060,2062,2063,2064,2064,2062,2057,2053,2052,2052,2053,2054,2054,2054,2053,2052,2049,2048,2048,2050,2050,2049,2046,2044,2044,2047,2052,2056,2056,2053,2050,2049,2049,2047,2041,2035,2032,2036,2045,2053,2057,2057,2056,2059,2065,2069,2069,2065,2062,2060,2059,2057,2054,2051,2049,2047,2044,2042,2044,2048,2055,2062,2067,2069,2068,2066,2059,2050,2044,2042,2043,2043,2043,2041,2038,2036,2036,2037,2040,2041,2041,2041,2044,2049,2055,2061,2062,2057,2046,2032,2023,2021,2022,2023,2021,2018,2019,2025,2033,2040,2047,2052,2056,2061,2067,2072,2079,2083,2083,2076,2068,2064,2063,2063,2065,2066,2066,2065,2064,2061,2057,2055,2054,2052,2050,2047,2045,2044,2045,2046,2045,2041,2037,2036,2037,2039,2039,2040,2041,2042,2041,2040,2038,2032,2024,2017,2014,2017,2021,2027,2033,2044,2054,2060,2060,2062,2067,2073,2077,2076,2070,2064,2061,2060,2062,2065,2067,2067,2066,2063,2058,2051,2044,2040,2042,2046,2049,2048,2046,2047,2051,2054,2055,2051,2044,2038,2033,2028,2023,2019,2019,2021,2026,2033,2040,2045,2050,2051,2051,2052,2056,2063,2068,2071,2071,2071,2072,2072,2069,2066,2063,2061,2058,2055,2056,2060,2064,2066,2063,2057,2050,2044,2040,2038,2038,2040,2040,2036,2031,2029,2031,2038,2045,2050,2053,2054,2054,2055,2056,2057,2058,2059,2060,2062,2064,2063,2059,2054,2051,2050,2052,2055,2057,2059,2059,2058,2056,2051,2043,2034,2027,2025,2026,2027,2028,2029,2033,2038,2046,2054,2059,2059,2056,2053,2050,2049,2050,2051,2053,2056,2061,2066,2071,2076,2079,2077,2072,2068,2067,2067,2066,2062,2056,2053,2054,2056,2056,2056,2056,2057,2058,2057,2056,2057,2061,2063,2059,2054,2051,2052,2055,2058,2059,2055,2049,2044,2042,2043,2046,2048,2047,2045,2044,2047,2053,2058,2059,2057,2053,2048,2043,2038,2032,2026,2025,2029,2037,2047,2056,2059,2060,2062,2066,2071,2073,2073,2073,2076,2081,2087,2090,2090,2088,2086,2087,2088,2086,2081,2074,2070,2067,2066,2067,2066,2064,2063,2065,2069,2073,2074,2072,2067,2060,2052,2042,2032,2026,2025,2027,2027,2026,2026,2028,2033,2037,2043,2050,2059,2065,2067,2068,2070,2072,2071,2068,2065,2061,2058,2055,2051,2049,2050,2055,2060,2064,2068,2071,2074,2075,2075,2072,2066,2060,2056,2052,2048,2047,2047,2048,2049,2051,2055,2060,2063,2063,2061,2060,2059,2058,2057,2057,2059,2065,2071,2079,2087,2093,2095,2092,2088,2082,2074,2065,2057,2052,2051,2050,2045,2037,2029,2024,2023,2024,2024,2023,2024,2026,2028,2031,2035,2039,2039,2037,2036,2037,2039,2041,2042,2043,2045,2045,2043,2043,2047,2054,2060,2064,2066,2067,2067,2068,2071,2073,2071,2066,2063,2066,2069,2070,2068,2068,2070,2071,2069,2061,2054,2049,2047,2047,2048,2047,2044,2041,2039,2039,2040,2040,2039,2038,2035,2032,2029,2028,2028,2026,2024,2023,2023,2024,2025,2024,2023,2022,2025,2032,2041,2048,2051,2051,2050,2048,2044,2038,2032,2029,2029,2029,2028,2027,2028,2031,2034,2040,2048,2056,2063,2067,2067,2065,2065,2067,2066,2063,2061,2063,2068,2072,2073,2071,2067,2062,2057,2052,2047,2043,2037,2027,2017,2007,1999,1994,1993,1995,2003,2014,2024,2031,2036,2040,2042,2042,2044,2046,2047,2049,2050,2049,2046,2045,2046,2049,2053,2058,2064,2066,2065,2063,2059,2052,2045,2039,2035,2033,2034,2039,2045,2052,2057,2059,2059,2061,2065,2068,2065,2060,2055,2053,2055,2059,2062,2063,2064,2067,2071,2069,2061,2050,2043,2041,2041,2040,2038,2037,2038,2043,2047,2050,2048,2043,2038,2035,2036,2039,2041,2042,2042,2044,2048,2053,2057,2056,2052,2050,2053,2061,2069,2078,2089,2100,2107,2108,2107,2105,2101,2093,2083,2075,2070,2068,2065,2061,2056,2051,2047,2046,2046,2046,2044,2043,2041,2040,2039,2038,2039,2045,2053,2062,2068,2069,2067,2067,2068,2071,2071,2070,2067,2062,2055,2050,2046,2045,2045,2045,2045,2048,2054,2061,2067,2073,2078,2080,2078,2075,2072,2070,2071,2076,2078,2076,2070,2065,2059,2055,2050,2047,2046,2048,2051,2052,2050,2047,2046,2045,2045,2045,2045,2045,2044,2044,2045,2047,2052,2059,2062,2063,2064,2064,2063,2061,2059,2056,2053,2052,2055,2060,2064,2067,2069,2069,2071,2073,2073,2071,2067,2065,2064,2064,2064,2061,2058,2056,2054,2052,2049,2046,2045,2046,2048,2051,2053,2056,2058,2059,2056,2050,2045,2042,2040,2038,2035,2035,2037,2041,2047,2050,2051,2053,2058,2065,2072,2075,2077,2076,2075,2073,2067,2058,2053,2053,2056,2059,2060,2060,2061,2061,2058,2052,2047,2045,2044,2042,2038,2035,2036,2037,2040,2043,2045,2048,2051,2055,2057,2057,2058,2062,2067,2070,2072,2072,2072,2071,2072,2073,2072,2070,2067,2062,2055,2046,2038,2035,2034,2031,2025,2019,2019,2022,2028,2037,2048,2058,2064,2065,2062,2061,2064,2070,2077,2079,2079,2079,2081,2086,2092,2096,2095,2088,2077,2068,2060,2055,2051,2048,2047,2045,2041,2035,2027,2019,2013,2009,2008,2009,2011,2014,2018,2024,2030,2036,2041,2047,2054,2060,2065,2070,2073,2076,2079,2079,2075,2071,2070,2074,2077,2075,2070,2063,2057,2055,2057,2059,2059,2059,2059,2059,2058,2058,2057,2057,2056,2054,2052,2049,2048,2048,2049,2051,2052,2053,2055,2059,2064,2067,2070,2073,2075,2078,2081,2083,2080,2072,2063,2057,2053,2050,2047,2045,2044,2043,2041,2038,2034,2028,2024,2024,2027,2034,2042,2050,2058,2062,2064,2063,2061,2060,2060,2062,2063,2064,2066,2067,2064,2057,2049,2043,2038,2036,2037,2041,2046,2048,2048,2047,2049,2054,2061,2069,2075,2077,2076,2075,2075,2074,2069,2063,2058,2057,2061,2067,2073,2077,2081,2082,2080,2074,2066,2056,2048,2044,2042,2041,2040,2039,2039,2043,2051,2060,2065,2067,2069,2072,2074,2076,2081,2087,2091,2091,2089,2085,2079,2072,2064,2055,2046,2040,2037,2035,2033,2033,2033,2036,2039,2040,2037,2034,2032,2032,2034,2037,2041,2045,2050,2054,2057,2059,2060,2062,2065,2068,2069,2065,2060,2057,2055,2051,2048,2046,2047,2048,2050,2053,2057,2059,2060,2063,2067,2072,2074,2074,2072,2070,2068,2066,2063,2061,2057,2053,2050,2049,2050,2051,2053,2054,2054,2051,2048,2048,2048,2048,2045,2042,2039,2034,2031,2030,2030,2031,2033,2037,2040,2041,2040,2040,2039,2038,2037,2035,2031,2028,2027,2027,2029,2033,2040,2048,2055,2061,2064,2064,2064,2065,2069,2073,2077,2080,2079,2075,2068,2061,2054,2045,2036,2029,2025,2024,2027,2032,2037,2039,2039,2040,2043,2046,2047,2049,2055,2062,2065,2065,2063,2062,2058,2053,2047,2040,2034,2031,2031,2031,2031,2032,2036,2041,2045,2050,2053,2053,2053,2053,2052,2049,2047,2046,2047,2048,2049,2049,2048,2048,2048,2048,2050,2053,2058,2063,2066,2065,2061,2058,2059,2062,2062,2061,2060,2061,2065,2071,2076,2076,2072,2067,2063,2063,2065,2068,2072,2074,2073,2067,2058,2048,2041,2037,2037,2043,2051,2058,2064,2067,2067,2062,2055,2047,2041,2038,2038,2038,2037,2036,2037,2041,2047,2053,2056,2056,2055,2055,2058,2061,2062,2062,2062,2064,2068,2071,2072,2069,2065,2061,2059,2060,2063,2065,2063,2059,2058,2060,2064,2069,2076,2086,2093,2093,2089,2085,2082,2081,2079,2077,2073,2069,2065,2064,2063,2063,2062,2061,2058,2052,2045,2040,2038,2041,2044,2045,2044,2042,2043,2048,2056,2061,2064,2063,2061,2059,2058,2058,2057,2055,2054,2052,2049,2046,2047,2049,2049,2048,2047,2047,2048,2051,2058,2066,2075,2083,2090,2094,2095,2093,2092,2092,2092,2090,2084,2078,2076,2077,2077,2073,2065,2057,2051,2047,2044,2042,2042,2042,2041,2042,2045,2045,2043,2040,2039,2039,2043,2048,2054,2058,2059,2057,2054,2052,2053,2055,2056,2058,2061,2066,2069,2070,2067,2063,2060,2058,2057,2056,2055,2053,2055,2061,2067,2067,2063,2059,2058,2062,2068,2072,2072,2069,2066,2063,2061,2059,2058,2058,2057,2055,2053,2054,2057,2060,2062,2063,2063,2063,2061,2061,2060,2061,2063,2066,2071,2075,2079,2079,2076,2072,2069,2067,2066,2065,2063,2061,2060,2059,2055,2051,2047,2045,2045,2046,2045,2044,2040,2035,2032,2034,2037,2040,2044,2049,2056,2063,2070,2076,2080,2079,2076,2071,2066,2060,2057,2055,2053,2053,2052,2051,2049,2048,2048,2049,2048,2047,2048,2052,2055,2056,2056,2056,2058,2059,2059,2059,2059,2061,2063,2066,2070,2072,2073,2071,2068,2067,2069,2073,2075,2074,2070,2064,2058,2055,2054,2053,2052,2051,2049,2050,2050,2050,2047,2041,2037,2035,2038,2042,2047,2052,2056,2058,2058,2057,2056,2054,2054,2053,2051,2049,2050,2053,2057,2059,2059,2058,2056,2055,2055,2057,2060,2062,2066,2069,2072,2074,2076,2079,2081,2079,2071,2064,2059,2057,2060,2067,2073,2076,2077,2077,2076,2074,2070,2064,2058,2053,2047,2040,2034,2029,2024,2020,2019,2021,2023,2025,2028,2033,2037,2041,2045,2050,2053,2052,2050,2049,2051,2052,2052,2052,2054,2059,2064,2069,2071,2072,2073,2075,2075,2074,2073,2074,2075,2078,2080,2080,2079,2077,2075,2075,2075,2073,2067,2058,2049,2044,2041,2040,2038,2036,2037,2040,2043,2046,2051,2057,2063,2068,2070,2068,2062,2053,2047,2042,2038,2033,2029,2025,2025,2030,2037,2042,2045,2043,2039,2036,2038,2045,2055,2063,2067,2068,2069,2068,2067,2067,2068,2069,2071,2072,2073,2073,2072,2071,2071,2070,2069,2067,2063,2058,2053,2048,2045,2045,2047,2047,2046,2042,2039,2038,2039,2042,2045,2048,2050,2051,2053,2055,2057,2056,2058,2062,2068,2074,2078,2082,2085,2086,2085,2082,2077,2069,2058,2047,2039,2036,2037,2039,2040,2038,2036,2035,2039,2046,2053,2059,2061,2062,2063,2065,2066,2067,2067,2066,2063,2060,2057,2055,2052,2049,2045,2041,2037,2036,2037,2039,2040,2043,2047,2052,2057,2063,2070,2075,2078,2077,2075,2074,2073,2073,2072,2070,2068,2068,2067,2064,2057,2048,2039,2032,2030,2033,2036,2040,2045,2053,2060,2064,2063,2061,2059,2060,2061,2063,2064,2063,2060,2058,2054,2049,2044,2043,2045,2046,2046,2044,2041,2038,2033,2028,2026,2026,2029,2032,2035,2038,2040,2041,2041,2042,2046,2053,2062,2071,2077,2081,2083,2086,2087,2087,2088,2090,2091,2087,2080,2072,2066,2062,2060,2057,2053,2046,2039,2035,2035,2037,2042,2047,2050,2050,2048,2045,2041,2038,2038,2040,2040,2035,2032,2034,2039,2041,2039,2035,2032,2030,2032,2037,2041,2039,2035,2034,2038,2042,2045,2046,2049,2053,2058,2063,2067,2073,2079,2083,2085,2084,2081,2077,2072,2070,2069,2068,2063,2054,2045,2039,2038,2040,2044,2049,2052,2055,2057,2059,2057,2053,2050,2049,2051,2055,2058,2061,2062,2062,2060,2055,2051,2047,2046,2048,2052,2057,2061,2062,2061,2060,2057,2053,2050,2049,2050,2052,2054,2058,2061,2062,2060,2057,2054,2053,2050,2046,2041,2037,2035,2036,2037,2036,2036,2039,2044,2050,2053,2054,2053,2051,2051,2052,2054,2056,2057,2059,2060,2061,2062,2064,2064,2062,2059,2057,2055,2055,2056,2060,2063,2066,2067,2067,2064,2060,2054,2050,2051,2055,2060,2065,2069,2073,2077,2080,2080,2078,2075,2072,2070,2069,2069,2069,2066,2063,2058,2052,2045,2040,2037,2037,2036,2037,2039,2044,2049,2053,2055,2055,2053,2051,2051,2051,2053,2057,2061,2065,2065,2063,2061,2061,2061,2063,2066,2071,2074,2075,2075,2074,2072,2070,2066,2064,2062,2060,2058,2057,2058,2059,2058,2055,2052,2051,2051,2054,2057,2059,2060,2059,2057,2055,2051,2048,2043,2040,2038,2040,2042,2043,2041,2042,2045,2051,2055,2056,2055,2054,2052,2052,2055,2061,2068,2075,2081,2084,2085,2083,2079,2072,2064,2058,2054,2051,2048,2045,2044,2045,2047,2046,2041,2032,2024,2020,2021,2025,2028,2031,2037,2044,2049,2052,2054,2054,2053,2052,2051,2050,2047,2044,2041,2039,2036,2036,2039,2046,2053,2057,2057,2054,2052,2053,2060,2068,2073,2072,2068,2063,2060,2055,2049,2041,2033,2026,2020,2017,2019,2023,2027,2031,2033,2035,2037,2039,2040,2040,2042,2047,2054,2059,2060,2057,2052,2045,2038,2034,2033,2032,2031,2032,2034,2036,2036,2038,2043,2050,2053,2054,2053,2051,2049,2048,2049,2050,2052,2053,2052,2050,2048,2047,2049,2051,2052,2049,2046,2044,2046,2049,2052,2052,2051,2050,2051,2055,2061,2066,2068,2066,2061,2057,2055,2055,2055,2054,2051,2047,2042,2038,2036,2035,2034,2033,2033,2035,2038,2042,2047,2052,2057,2060,2062,2063,2065,2067,2068,2068,2066,2062,2058,2055,2052,2049,2048,2049,2052,2056,2059,2060,2059,2059,2062,2067,2071,2069,2064,2061,2058,2056,2054,2055,2058,2061,2063,2064,2065,2065,2067,2068,2068,2065,2061,2059,2057,2057,2057,2058,2057,2053,2046,2041,2040,2041,2041,2042,2044,2047,2051,2055,2058,2061,2063,2063,2064,2066,2069,2071,2073,2075,2078,2079,2077,2074,2072,2070,2070,2071,2073,2074,2075,2076,2076,2076,2074,2073,2072,2070,2068,2066,2064,2062,2059,2058,2059,2063,2065,2065,2064,2064,2064,2063,2061,2060,2059,2059,2059,2059,2058,2057,2054,2050,2047,2044,2042,2043,2046,2049,2052,2054,2056,2059,2063,2066,2069,2071,2072,2072,2072,2073,2076,2078,2077,2074,2069,2065,2062,2059,2054,2052,2055,2059,2062,2065,2067,2070,2073,2075,2077,2076,2073,2070,2067,2064,2059,2055,2055,2057,2060,2062,2063,2063,2064,2066,2067,2067,2066,2064,2061,2055,2047,2041,2036,2035,2038,2042,2044,2045,2046,2050,2056,2062,2067,2072,2078,2084,2088,2089,2089,2086,2083,2078,2075,2074,2072,2068,2063,2058,2054,2052,2051,2051,2052,2051,2052,2052,2052,2051,2050,2048,2047,2044,2039,2038,2040,2045,2049,2050,2049,2047,2045,2046,2049,2053,2056,2059,2062,2065,2068,2071,2073,2076,2079,2079,2077,2075,2074,2076,2079,2080,2078,2076,2073,2070,2067,2063,2061,2057,2052,2048,2045,2044,2045,2046,2046,2043,2039,2035,2034,2034,2036,2040,2046,2051,2053,2055,2056,2056,2054,2050,2045,2041,2039,2040,2044,2049,2052,2055,2057,2059,2061,2062,2062,2063,2065,2066,2066,2066,2068,2069,2070,2069,2066,2061,2056,2053,2052,2051,2051,2052,2056,2060,2061,2060,2057,2054,2053,2056,2060,2063,2062,2058,2053,2049,2045,2043,2042,2043,2046,2050,2054,2056,2058,2060,2061,2059,2055,2051,2049,2049,2049,2048,2045,2041,2038,2036,2037,2038,2039,2039,2040,2044,2049,2052,2052,2051,2050,2052,2056,2060,2065,2069,2072,2072,2070,2070,2072,2074,2076,2078,2079,2077,2072,2064,2055,2045,2038,2034,2032,2030,2026,2023,2022,2023,2025,2027,2028,2030,2034,2040,2047,2053,2057,2060,2061,2062,2062,2061,2060,2057,2052,2047,2043,2042,2044,2048,2052,2053,2052,2052,2053,2053,2052,2051,2050,2048,2045,2043,2043,2045,2048,2051,2054,2057,2062,2067,2070,2070,2067,2062,2059,2057,2055,2054,2052,2050,2047,2043,2039,2033,2029,2026,2026,2027,2032,2038,2044,2051,2057,2061,2062,2062,2060,2058,2055,2054,2053,2051,2051,2052,2054,2057,2059,2059,2057,2056,2055,2054,2052,2050,2048,2048,2050,2052,2053,2054,2055,2057,2061,2061,2059,2053,2048,2044,2041,2039,2039,2039,2038,2035,2034,2035,2038,2043,2047,2050,2052,2054,2057,2060,2064,2066,2068,2068,2068,2068,2068,2067,2065,2063,2062,2060,2059,2057,2055,2053,2051,2048,2043,2040,2040,2043,2044,2045,2047,2050,2055,2064,2074,2081,2084,2083,2080,2077,2072,2067,2060,2054,2049,2046,2044,2045,2048,2053,2057,2060,2061,2060,2061,2062,2062,2060,2057,2054,2051,2050,2048,2046,2045,2046,2051,2055,2058,2061,2063,2065,2066,2066,2066,2064,2060,2056,2054,2052,2051,2049,2048,2048,2049,2051,2054,2057,2058,2058,2057,2057,2058,2057,2056,2056,2055,2053,2051,2049,2048,2048,2049,2051,2052,2053,2053,2053,2053,2055,2058,2064,2070,2076,2079,2077,2074,2070,2067,2065,2063,2060,2056,2053,2053,2054,2056,2058,2059,2059,2058,2059,2061,2064,2067,2066,2062,2057,2053,2051,2050,2050,2051,2052,2053,2052,2051,2053,2056,2058,2058,2056,2055,2053,2051,2049,2048,2046,2044,2041,2038,2037,2038,2041,2044,2047,2048,2048,2047,2044,2041,2037,2035,2034,2035,2038,2042,2046,2051,2056,2058,2058,2059,2059,2060,2061,2062,2063,2063,2062,2061,2058,2054,2051,2050,2051,2054,2056,2056,2056,2055,2056,2058,2058,2057,2055,2052,2049,2046,2043,2041,2039,2037,2039,2043,2048,2051,2053,2054,2055,2056,2056,2055,2055,2055,2054,2052,2050,2050,2051,2051,2052,2054,2057,2058,2057,2055,2050,2045,2041,2037,2034,2032,2032,2034,2036,2037,2039,2040,2041,2042,2043,2044,2045,2046,2047,2048,2049,2051,2053,2054,2054,2055,2056,2057,2059,2062,2063,2064,2064,2064,2063,2062,2060,2059,2059,2058,2056,2052,2050,2049,2050,2053,2056,2058,2060,2062,2062,2060,2058,2053,2049,2045,2045,2046,2048,2049,2049,2048,2047,2047,2047,2048,2048,2050,2051,2053,2055,2057,2058,2057,2055,2053,2051,2050,2050,2049,2048,2048,2050,2051,2052,2052,2054,2056,2058,2059,2060,2062,2065,2068,2070,2069,2068,2067,2063,2058,2054,2053,2054,2056,2057,2058,2057,2055,2052,2048,2044,2042,2042,2043,2044,2045,2046,2048,2052,2056,2060,2064,2067,2069,2071,2073,2075,2073,2070,2066,2064,2062,2061,2061,2060,2060,2058,2056,2054,2053,2053,2052,2052,2052,2052,2053,2053,2051,2048,2047,2048,2052,2055,2057,2058,2058,2059,2061,2065,2067,2066,2062,2059,2057,2055,2052,2048,2046,2048,2051,2054,2055,2054,2053,2053,2054,2053,2051,2049,2047,2044,2041,2041,2043,2044,2046,2046,2047,2049,2053,2057,2061,2061,2061,2059,2057,2056,2054,2053,2051,2047,2044,2042,2041,2043,2046,2050,2055,2059,2061,2061,2061,2061,2063,2063,2062,2058,2053,2048,2046,2046,2047,2048,2049,2050,2052,2054,2056,2058,2060,2061,2061,2059,2056,2052,2050,2048,2046,2043,2039,2036,2034,2034,2036,2037,2039,2041,2044,2047,2052,2058,2064,2070,2074,2077,2077,2076,2074,2073,2071,2068,2064,2059,2055,2052,2049,2048,2048,2048,2047,2046,2045,2044,2043,2042,2041,2041,2041,2041,2043,2045,2047,2049,2052,2057,2061,2063,2063,2063,2062,2061,2058,2058,2061,2065,2066,2066,2064,2061,2059,2056,2054,2053,2053,2051,2049,2047,2045,2044,2044,2045,2047,2048,2048,2048,2048,2048,2049,2052,2058,2065,2071,2075,2076,2076,2075,2073,2071,2068,2065,2062,2060,2060,2061,2062,2060,2057,2054,2051,2049,2048,2047,2046,2047,2049,2051,2053,2055,2056,2056,2055,2052,2050,2047,2047,2048,2050,2051,2052,2052,2052,2053,2054,2055,2057,2061,2064,2067,2069,2069,2068,2066,2064,2062,2060,2058,2057,2054,2049,2043,2037,2033,2032,2034,2038,2042,2047,2052,2055,2058,2060,2063,2067,2070,2070,2069,2066,2062,2058,2054,2051,2049,2050,2051,2052,2049,2046,2044,2043,2045,2048,2051,2054,2056,2058,2060,2061,2060,2058,2055,2052,2051,2050,2050,2051,2052,2055,2057,2061,2065,2069,2073,2075,2076,2077,2075,2069,2061,2051,2042,2037,2035,2036,2038,2038,2039,2041,2045,2050,2054,2056,2058,2060,2063,2064,2065,2064,2063,2062,2060,2057,2055,2053,2052,2052,2052,2052,2052,2052,2052,2053,2053,2052,2051,2049,2047,2045,2044,2045,2047,2051,2056,2060,2066,2070,2072,2072,2070,2069,2068,2067,2066,2064,2062,2061,2058,2056,2054,2054,2054,2054,2055,2057,2058,2059,2058,2057,2055,2054,2053,2050,2046,2044,2043,2045,2048,2051,2052,2051,2048,2046,2046,2047,2047,2046,2045,2045,2045,2047,2048,2051,2055,2059,2063,2067,2070,2071,2070,2067,2063,2059,2058,2058,2059,2059,2060,2061,2063,2066,2068,2068,2066,2062,2058,2054,2050,2045,2041,2038,2036,2035,2036,2038,2039,2040,2042,2043,2044,2045,2046,2047,2046,2043,2038,2035,2036,2038,2040,2041,2040,2039,2038,2039,2041,2045,2049,2053,2055,2056,2055,2056,2057,2058,2058,2058,2060,2062,2063,2064,2064,2063,2059,2053,2048,2046,2045,2045,2045,2047,2049,2052,2056,2060,2062,2062,2062,2061,2058,2055,2052,2050,2051,2054,2055,2053,2050,2049,2050,2051,2051,2049,2045,2043,2043,2044,2045,2045,2044,2043,2043,2045,2046,2047,2047,2048,2049,2050,2052,2052,2051,2049,2048,2049,2050,2051,2053,2056,2059,2063,2066,2069,2071,2073,2072,2070,2066,2062,2058,2054,2052,2049,2047,2046,2048,2052,2055,2057,2057,2058,2060,2061,2061,2059,2057,2056,2058,2058,2057,2055,2053,2053,2054,2056,2059,2061,2063,2063,2062,2058,2055,2051,2048,2045,2044,2044,2043,2043,2042,2043,2045,2047,2050,2051,2052,2053,2054,2055,2055,2057,2060,2062,2064,2067,2069,2069,2069,2068,2065,2060,2055,2051,2049,2051,2053,2054,2053,2052,2050,2050,2051,2053,2054,2055,2054,2052,2050,2049,2049,2051,2052,2053,2052,2051,2050,2050,2051,2052,2052,2052,2051,2049,2046,2044,2043,2043,2044,2044,2045,2047,2049,2052,2054,2054,2054,2053,2053,2054,2055,2056,2055,2053,2050,2046,2043,2041,2042,2043,2045,2046,2045,2046,2048,2051,2055,2058,2062,2065,2067,2070,2072,2072,2071,2068,2064,2060,2056,2054,2052,2050,2047,2045,2041,2038,2036,2035,2035,2037,2039,2041,2041,2041,2041,2042,2043,2044,2045,2045,2046,2047,2050,2055,2058,2060,2060,2059,2057,2055,2052,2050,2049,2049,2049,2050,2051,2050,2048,2045,2042,2042,2043,2045,2047,2049,2051,2054,2058,2064,2069,2073,2074,2073,2070,2067,2063,2059,2057,2056,2058,2061,2064,2065,2065,2066,2065,2062,2055,2049,2044,2041,2040,2039,2037,2036,2037,2040,2044,2049,2054,2059,2062,2065,2067,2067,2065,2063,2060,2059,2057,2055,2054,2056,2058,2060,2060,2059,2058,2058,2059,2059,2059,2059,2059,2059,2060,2060,2058,2054,2050,2046,2043,2038,2034,2032,2032,2035,2039,2043,2048,2055,2062,2069,2074,2075,2075,2075,2075,2075,2075,2073,2069,2063,2056,2048,2044,2042,2043,2043,2044,2045,2045,2045,2045,2045,2046,2045,2044,2044,2045,2048,2054,2059,2062,2062,2061,2060,2060,2060,2058,2053,2047,2044,2042,2043,2044,2047,2048,2048,2048,2047,2048,2051,2056,2060,2061,2060,2059,2059,2060,2059,2058,2056,2055,2057,2060,2063,2065,2068,2069,2070,2069,2068,2067,2067,2066,2065,2065,2064,2063,2061,2058,2054,2048,2043,2038,2035,2032,2032,2034,2037,2040,2040,2038,2037,2036,2037,2038,2038,2035,2032,2031,2031,2034,2039,2045,2050,2053,2054,2055,2056,2057,2060,2063,2066,2068,2069,2069,2067,2065,2064,2064,2062,2058,2055,2054,2055,2056,2056,2058,2061,2064,2067,2069,2068,2065,2061,2057,2052,2049,2047,2045,2045,2046,2047,2046,2044,2043,2042,2042,2039,2035,2029,2024,2020,2018,2020,2024,2030,2037,2041,2044,2048,2051,2054,2056,2056,2055,2053,2050,2047,2044,2043,2043,2043,2044,2046,2047,2048,2048,2048,2046,2043,2039,2037,2037,2040,2043,2045,2046,2045,2044,2043,2042,2042,2042,2042,2041,2042,2044,2046,2047,2048,2050,2054,2059,2063,2066,2068,2068,2066,2062,2058,2053,2047,2040,2035,2033,2033,2036,2040,2046,2051,2055,2057,2057,2056,2056,2057,2056,2053,2049,2044,2041,2040,2042,2044,2045,2045,2044,2044,2044,2045,2046,2048,2049,2050,2051,2052,2054,2056,2057,2056,2055,2053,2051,2048,2045,2040,2035,2030,2028,2028,2031,2033,2035,2036,2039,2041,2043,2044,2047,2050,2054,2058,2061,2063,2063,2063,2063,2063,2061,2060,2059,2058,2057,2057,2057,2058,2059,2060,2060,2058,2057,2057,2057,2056,2054,2052,2050,2048,2046,2045,2044,2043,2043,2042,2042,2044,2048,2052,2055,2058,2060,2062,2065,2066,2068,2068,2067,2066,2066,2067,2067,2067,2066,2064,2060,2055,2051,2049,2050,2050,2049,2046,2044,2043,2043,2044,2045,2046,2047,2049,2051,2053,2056,2058,2058,2059,2060,2061,2064,2067,2068,2067,2067,2065,2061,2055,2050,2047,2046,2045,2044,2044,2044,2046,2048,2051,2053,2056,2058,2059,2061,2064,2067,2069,2069,2069,2069,2069,2070,2070,2068,2065,2061,2057,2054,2052,2051,2050,2050,2050,2051,2052,2051,2048,2045,2043,2041,2041,2041,2042,2043,2044,2045,2047,2048,2050,2051,2051,2052,2052,2051,2051,2051,2053,2054,2056,2056,2056,2055,2056,2058,2061,2063,2065,2067,2070,2073,2076,2079,2079,2077,2075,2072,2068,2063,2057,2052,2048,2045,2043,2041,2039,2038,2037,2036,2033,2030,2029,2030,2032,2035,2038,2042,2047,2051,2053,2054,2053,2053,2053,2052,2050,2048,2047,2048,2051,2054,2056,2057,2057,2058,2059,2060,2059,2058,2057,2056,2052,2047,2042,2039,2039,2039,2038,2037,2038,2040,2043,2046,2050,2053,2055,2056,2058,2060,2060,2060,2056,2052,2046,2042,2040,2039,2038,2040,2042,2046,2049,2052,2053,2053,2051,2048,2048,2048,2049,2048,2047,2044,2041,2039,2040,2042,2045,2048,2049,2050,2050,2051,2053,2056,2059,2060,2058,2054,2051,2047,2044,2041,2040,2039,2039,2039,2039,2041,2043,2046,2049,2051,2051,2050,2050,2049,2048,2046,2042,2038,2035,2034,2035,2036,2037,2039,2040,2040,2040,2042,2045,2049,2054,2058,2059,2057,2055,2054,2053,2052,2049,2045,2040,2037,2036,2038,2042,2045,2049,2051,2052,2052,2051,2050,2051,2053,2056,2058,2059,2059,2060,2059,2058,2055,2052,2048,2046,2045,2045,2046,2048,2050,2050,2050,2049,2048,2046,2042,2038,2035,2035,2036,2038,2038,2037,2035,2032,2032,2034,2037,2040,2042,2044,2046,2048,2049,2050,2050,2051,2052,2053,2055,2055,2055,2054,2053,2051,2050,2050,2052,2054,2056,2055,2053,2053,2054,2055,2055,2054,2052,2052,2051,2050,2047,2044,2043,2042,2041,2040,2040,2041,2041,2041,2042,2043,2045,2048,2049,2050,2049,2048,2047,2047,2048,2048,2048,2047,2048,2048,2048,2047,2047,2048,2051,2055,2057,2056,2054,2051,2050,2049,2049,2047,2044,2041,2039,2038,2037,2037,2038,2039,2041,2043,2045,2047,2048,2049,2052,2056,2058,2059,2059,2058,2057,2056,2055,2055,2054,2052,2051,2050,2051,2052,2052,2051,2050,2049,2048,2049,2050,2051,2052,2052,2052,2053,2055,2057,2058,2059,2059,2059,2059,2058,2057,2055,2052,2047,2041,2036,2031,2028,2026,2027,2031,2037,2042,2045,2049,2052,2055,2057,2059,2060,2061,2061,2059,2055,2051,2049,2048,2046,2045,2044,2044,2045,2046,2046,2048,2051,2055,2059,2060,2059,2059,2058,2058,2056,2052,2048,2046,2045,2046,2048,2049,2050,2050,2048,2047,2046,2045,2044,2043,2043,2043,2045,2049,2054,2058,2062,2065,2066,2066,2066,2066,2065,2061,2057,2052,2049,2048,2047,2046,2044,2043,2043,2042,2041,2040,2038,2037,2038,2039,2040,2041,2043,2046,2050,2052,2052,2051,2050,2050,2051,2050,2048,2048,2051,2054,2056,2056,2055,2055,2056,2057,2057,2057,2056,2056,2056,2055,2054,2051,2046,2043,2041,2041,2041,2040,2041,2044,2046,2047,2047,2048,2049,2050,2051,2052,2054,2055,2055,2055,2054,2052,2051,2051,2051,2050,2049,2049,2049,2049,2048,2048,2047,2047,2047,2046,2045,2044,2044,2043,2043,2043,2043,2042,2041,2039,2037,2036,2033,2030,2028,2026,2027,2030,2035,2040,2045,2049,2053,2056,2058,2059,2059,2058,2055,2053,2053,2055,2058,2060,2060,2059,2056,2054,2051,2050,2049,2046,2042,2038,2035,2035,2035,2036,2037,2038,2040,2041,2041,2039,2034,2028,2022,2018,2016,2017,2020,2026,2031,2035,2038,2041,2043,2045,2046,2045,2044,2044,2044,2044,2045,2046,2049,2051,2053,2055,2058,2060,2060,2059,2059,2057,2056,2055,2053,2051,2049,2047,2046,2045,2045,2044,2042,2038,2035,2033,2034,2036,2038,2040,2042,2045,2048,2053,2056,2057,2055,2052,2051,2051,2052,2053,2055,2056,2056,2055,2054,2052,2049,2046,2041,2036,2031,2026,2024,2024,2027,2031,2034,2038,2042,2045,2046,2046,2045,2045,2046,2048,2049,2052,2055,2060,2064,2066,2066,2066,2066,2063,2060,2056,2053,2052,2051,2052,2053,2055,2058,2061,2062,2061,2059,2057,2055,2052,2048,2043,2037,2031,2028,2027,2027,2029,2031,2034,2038,2043,2047,2049,2050,2050,2050,2050,2050,2050,2051,2053,2056,2059,2062,2062,2062,2062,2062,2062,2060,2056,2052,2048,2046,2046,2049,2053,2057,2060,2061,2062,2061,2059,2058,2056,2055,2054,2054,2055,2056,2057,2058,2059,2060,2060,2059,2058,2058,2058,2060,2060,2059,2057,2055,2054,2055,2056,2056,2055,2053,2053,2053,2052,2050,2048,2047,2048,2051,2054,2056,2058,2060,2061,2064,2067,2069,2070,2069,2067,2064,2061,2060,2059,2059,2060,2064,2071,2079,2085,2087,2086,2084,2082,2080,2077,2071,2064,2058,2054,2051,2048,2045,2043,2041,2040,2040,2041,2044,2046,2047,2049,2051,2052,2051,2049,2047,2045,2044,2045,2046,2048,2050,2054,2057,2060,2063,2065,2066,2065,2064,2063,2062,2063,2064,2065,2065,2064,2061,2057,2052,2049,2046,2044,2042,2039,2038,2037,2038,2040,2043,2047,2051,2054,2056,2054,2051,2047,2045,2043,2043,2043,2044,2045,2048,2050,2051,2052,2052,2054,2056,2059,2062,2064,2066,2066,2065,2064,2063,2061,2059,2057,2056,2053,2048,2043,2039,2035,2033,2033,2034,2034,2033,2033,2032,2032,2033,2036,2039,2043,2045,2047,2049,2049,2049,2049,2049,2049,2048,2046,2044,2042,2039,2037,2036,2037,2038,2037,2035,2034,2035,2037,2039,2041,2042,2044,2046,2049,2050,2050,2048,2044,2040,2037,2036,2037,2039,2039,2038,2037,2036,2037,2037,2037,2038,2038,2038,2037,2036,2034,2031,2028,2025,2023,2023,2024,2026,2028,2031,2034,2037,2040,2044,2048,2051,2053,2055,2056,2057,2059,2060,2061,2060,2057,2055,2053,2052,2052,2050,2048,2047,2046,2048,2050,2051,2052,2050,2047,2043,2039,2035,2031,2027,2025,2024,2022,2021,2022,2024,2027,2029,2032,2035,2039,2045,2050,2053,2056,2058,2060,2061,2060,2058,2057,2056,2056,2054,2050,2044,2038,2035,2034,2033,2033,2033,2034,2036,2039,2041,2044,2046,2049,2053,2056,2057,2054,2050,2045,2042,2042,2044,2047,2049,2048,2046,2043,2040,2039,2040,2041,2042,2044,2046,2049,2050,2050,2050,2049,2049,2049,2051,2052,2052,2052,2053,2055,2057,2057,2057,2056,2056,2056,2057,2057,2058,2059,2059,2059,2060,2061,2061,2060,2059,2059,2059,2058,2058,2059,2060,2060,2058,2055,2051,2047,2044,2043,2042,2041,2041,2041,2042,2043,2044,2045,2046,2046,2047,2048,2048,2049,2050,2052,2053,2054,2054,2053,2053,2053,2052,2052,2052,2054,2055,2056,2055,2053,2052,2052,2053,2054,2054,2054,2056,2059,2061,2062,2062,2062,2062,2061,2061,2060,2059,2058,2056,2055,2053,2051,2050,2048,2046,2044,2042,2041,2040,2040,2042,2045,2048,2051,2053,2056,2057,2058,2058,2057,2056,2057,2057,2057,2056,2056,2056,2058,2060,2062,2063,2065,2067,2067,2067,2065,2065,2067,2068,2068,2067,2066,2067,2071,2075,2079,2081,2083,2082,2080,2077,2073,2069,2064,2058,2053,2047,2041,2034,2028,2023,2020,2017,2014,2012,2011,2011,2012,2012,2011,2010,2011,2014,2019,2026,2033,2041,2049,2059,2069,2077,2083,2086,2088,2089,2089,2088,2086,2084,2083,2083,2082,2082,2080,2078,2074,2070,2064,2060,2056,2051,2046,2040,2036,2033,2031,2030,2029,2029,2028,2029,2032,2033,2034,2035,2037,2039,2039,2039,2037,2036,2035,2035,2034,2033,2035,2038,2041,2044,2046,2047,2047,2046,2045,2043,2042,2041,2041,2041,2041,2038,2035,2031,2028,2028,2031,2034,2038,2043,2048,2054,2061,2067,2072,2076,2078,2078,2076,2072,2068,2065,2063,2062,2060,2057,2055,2054,2051,2047,2041,2035,2030,2025,2021,2020,2019,2018,2016,2014,2013,2012,2012,2013,2016,2020,2023,2026,2030,2034,2039,2044,2048,2051,2053,2054,2054,2055,2058,2062,2065,2065,2061,2056,2052,2048,2046,2044,2041,2040,2041,2045,2050,2055,2058,2060,2061,2063,2063,2060,2055,2050,2046,2045,2043,2042,2040,2037,2034,2033,2032,2032,2032,2033,2035,2037,2040,2041,2040,2039,2039,2040,2040,2039,2038,2039,2040,2042,2042,2041,2040,2040,2042,2044,2045,2045,2045,2045,2046,2046,2045,2044,2042,2040,2038,2036,2034,2032,2033,2035,2039,2043,2044,2045,2046,2047,2046,2046,2047,2047,2045,2044,2043,2043,2042,2041,2038,2034,2031,2029,2029,2030,2032,2035,2035,2035,2034,2033,2034,2036,2039,2041,2042,2043,2044,2046,2048,2050,2051,2053,2054,2054,2055,2056,2060,2063,2065,2064,2062,2060,2059,2057,2056,2053,2051,2050,2049,2049,2050,2050,2049,2048,2047,2045,2044,2042,2042,2042,2044,2046,2046,2044,2043,2041,2040,2040,2040,2039,2038,2037,2037,2036,2037,2038,2041,2045,2049,2051,2052,2052,2052,2052,2052,2052,2053,2054,2055,2056,2057,2059,2061,2062,2063,2063,2062,2062,2062,2063,2064,2063,2063,2062,2062,2062,2060,2058,2054,2050,2048,2048,2050,2051,2052,2051,2051,2052,2054,2057,2059,2058,2056,2056,2058,2061,2063,2062,2057,2051,2047,2044,2044,2045,2048,2051,2055,2058,2060,2061,2062,2062,2061,2059,2056,2053,2050,2049,2050,2051,2051,2049,2048,2049,2051,2053,2054,2054,2052,2050,2049,2048,2048,2049,2050,2050,2050,2051,2051,2053,2054,2055,2055,2054,2054,2054,2055,2054,2053,2052,2052,2053,2055,2056,2056,2056,2056,2056,2056,2057,2058,2057,2056,2053,2050,2049,2047,2047,2047,2049,2049,2048,2046,2046,2048,2053,2056,2055,2052,2049,2048,2048,2049,2048,2047,2045,2043,2044,2046,2048,2049,2051,2054,2057,2060,2060,2056,2051,2046,2043,2042,2042,2043,2044,2045,2046,2048,2051,2053,2054,2054,2054,2053,2053,2052,2051,2051,2051,2051,2052,2053,2055,2055,2056,2056,2058,2058,2056,2053,2050,2049,2049,2050,2051,2053,2053,2054,2055,2056,2057,2059,2058,2056,2053,2050,2049,2048,2047,2045,2044,2043,2045,2048,2052,2056,2058,2058,2058,2058,2059,2062,2062,2062,2060,2059,2058,2058,2058,2055,2053,2051,2050,2049,2048,2047,2046,2046,2046,2047,2048,2047,2047,2047,2047,2049,2050,2051,2053,2056,2060,2063,2064,2064,2062,2060,2058,2057,2055,2053,2052,2051,2052,2052,2051,2050,2048,2046,2044,2041,2040,2041,2042,2043,2046,2048,2049,2050,2050,2050,2050,2050,2051,2052,2053,2054,2053,2051,2049,2045,2042,2039,2036,2034,2033,2035,2038,2041,2044,2046,2050,2053,2056,2058,2058,2057,2057,2057,2058,2059,2060,2060,2058,2057,2055,2054,2053,2053,2051,2049,2046,2045,2044,2044,2045,2046,2045,2044,2044,2044,2045,2044,2043,2041,2040,2040,2040,2041,2042,2043,2044,2044,2043,2043,2045,2047,2050,2051,2050,2047,2046,2046,2048,2049,2048,2046,2044,2044,2046,2049,2051,2053,2052,2051,2048,2046,2046,2046,2047,2046,2045,2043,2043,2044,2045,2045,2045,2044,2042,2042,2043,2044,2045,2046,2045,2045,2046,2048,2050,2051,2052,2052,2051,2050,2048,2047,2047,2047,2047,2046,2044,2042,2042,2043,2045,2048,2050,2052,2052,2051,2051,2050,2048,2046,2044,2044,2044,2044,2045,2046,2046,2045,2044,2044,2045,2049,2052,2055,2056,2057,2058,2058,2056,2053,2048,2045,2043,2042,2041,2041,2040,2040,2041,2042,2042,2043,2043,2045,2048,2051,2055,2058,2059,2059,2058,2058,2058,2058,2057,2055,2052,2050,2049,2049,2049,2048,2046,2045,2045,2044,2042,2040,2038,2036,2034,2034,2034,2035,2037,2040,2043,2047,2049,2050,2049,2048,2047,2048,2049,2050,2051,2052,2052,2052,2054,2055,2057,2057,2057,2057,2057,2058,2059,2059,2059,2060,2059,2059,2057,2056,2054,2052,2051,2050,2049,2048,2047,2047,2048,2048,2048,2047,2047,2048,2049,2052,2055,2059,2062,2065,2068,2069,2069,2066,2063,2060,2058,2057,2056,2056,2056,2056,2055,2054,2053,2054,2054,2053,2051,2050,2049,2049,2051,2054,2057,2058,2059,2060,2060,2059,2058,2057,2055,2053,2050,2046,2041,2037,2033,2031,2030,2030,2030,2032,2034,2037,2041,2046,2052,2056,2059,2061,2061,2061,2061,2061,2061,2061,2061,2060,2060,2059,2058,2057,2056,2055,2055,2055,2055,2056,2058,2060,2062,2063,2064,2065,2065,2066,2068,2068,2068,2066,2064,2063,2062,2061,2059,2056,2053,2051,2050,2050,2051,2050,2050,2049,2048,2048,2049,2052,2054,2057,2058,2058,2057,2055,2053,2051,2047,2043,2041,2040,2041,2043,2044,2045,2045,2044,2043,2043,2044,2046,2049,2050,2051,2052,2053,2055,2057,2059,2061,2063,2064,2064,2065,2067,2068,2069,2068,2065,2061,2057,2055,2054,2053,2053,2053,2054,2057,2061,2063,2063,2060,2058,2056,2055,2054,2052,2050,2048,2048,2048,2049,2049,2048,2047,2047,2046,2046,2046,2046,2045,2044,2043,2042,2043,2045,2048,2051,2054,2057,2059,2062,2064,2066,2066,2065,2063,2060,2058,2056,2055,2053,2051,2049,2048,2047,2048,2049,2050,2052,2054,2055,2056,2055,2053,2051,2049,2047,2046,2045,2045,2046,2046,2046,2044,2041,2038,2036,2034,2033,2033,2034,2036,2039,2043,2046,2049,2052,2054,2056,2057,2057,2056,2054,2051,2048,2046,2045,2045,2046,2048,2049,2050,2050,2048,2045,2043,2042,2041,2040,2040,2041,2041,2041,2040,2038,2036,2035,2034,2035,2036,2038,2039,2040,2042,2044,2047,2049,2049,2048,2046,2045,2044,2043,2043,2043,2044,2046,2048,2049,2048,2046,2044,2043,2042,2040,2039,2037,2037,2038,2038,2039,2040,2042,2044,2047,2050,2051,2051,2050,2049,2047,2044,2042,2042,2042,2044,2045,2046,2047,2047,2048,2050,2052,2052,2051,2048,2045,2043,2040,2039,2037,2036,2036,2038,2039,2039,2039,2039,2039,2041,2043,2045,2048,2048,2049,2049,2049,2049,2048,2047,2046,2046,2045,2046,2045,2044,2043,2043,2044,2045,2048,2051,2054,2055,2056,2056,2056,2055,2054,2053,2052,2052,2052,2052,2051,2049,2048,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2048,2050,2053,2055,2057,2058,2059,2058,2058,2057,2056,2055,2054,2053,2052,2050,2048,2048,2049,2050,2051,2051,2052,2053,2054,2054,2054,2054,2053,2053,2054,2055,2056,2057,2058,2059,2060,2060,2059,2058,2057,2057,2058,2060,2061,2062,2063,2062,2060,2058,2056,2055,2055,2055,2054,2053,2052,2052,2051,2050,2049,2047,2045,2045,2046,2048,2050,2052,2053,2055,2059,2063,2067,2069,2068,2067,2065,2063,2062,2061,2061,2061,2060,2059,2058,2058,2059,2061,2063,2063,2064,2063,2062,2062,2062,2063,2064,2065,2066,2065,2063,2061,2060,2059,2059,2060,2062,2062,2062,2062,2062,2062,2062,2060,2059,2057,2056,2054,2053,2052,2051,2049,2048,2047,2047,2047,2048,2048,2049,2050,2051,2053,2054,2054,2054,2055,2057,2059,2062,2064,2066,2067,2066,2065,2063,2060,2057,2055,2054,2054,2055,2055,2057,2058,2059,2059,2059,2058,2059,2060,2060,2058,2055,2053,2052,2052,2051,2051,2051,2050,2050,2051,2051,2052,2052,2052,2052,2053,2053,2053,2052,2050,2050,2051,2053,2055,2057,2058,2059,2060,2061,2060,2058,2057,2056,2055,2054,2053,2052,2050,2048,2046,2047,2049,2052,2055,2057,2059,2059,2059,2058,2058,2058,2058,2058,2057,2055,2053,2050,2048,2047,2047,2046,2045,2043,2043,2044,2045,2045,2045,2046,2046,2047,2048,2048,2047,2046,2045,2045,2045,2047,2049,2051,2052,2052,2051,2050,2049,2049,2047,2046,2044,2044,2045,2046,2045,2045,2044,2044,2043,2042,2040,2039,2038,2037,2035,2034,2032,2032,2032,2033,2034,2035,2037,2039,2043,2046,2048,2049,2050,2051,2052,2052,2052,2050,2049,2048,2047,2045,2043,2041,2040,2040,2041,2042,2043,2044,2045,2045,2046,2048,2048,2047,2045,2042,2040,2040,2040,2042,2043,2044,2045,2047,2048,2050,2052,2052,2051,2049,2046,2043,2040,2038,2037,2038,2037,2036,2034,2032,2032,2032,2034,2036,2038,2039,2039,2039,2039,2040,2041,2042,2042,2042,2040,2039,2039,2040,2041,2042,2044,2046,2047,2047,2046,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2043,2043,2043,2044,2045,2046,2049,2050,2051,2051,2052,2054,2056,2057,2056,2053,2049,2045,2044,2044,2044,2043,2041,2040,2040,2043,2045,2047,2047,2046,2046,2046,2046,2047,2047,2046,2043,2041,2040,2041,2042,2043,2044,2044,2045,2047,2048,2050,2051,2052,2052,2051,2049,2048,2047,2048,2048,2048,2048,2049,2050,2051,2050,2049,2049,2048,2049,2050,2051,2053,2054,2055,2055,2055,2054,2053,2051,2049,2048,2047,2046,2046,2048,2050,2052,2053,2054,2053,2052,2050,2048,2047,2048,2048,2048,2047,2047,2047,2049,2052,2054,2055,2055,2055,2055,2055,2057,2059,2060,2060,2058,2057,2056,2057,2058,2057,2056,2055,2054,2053,2052,2051,2052,2053,2054,2056,2057,2057,2057,2057,2058,2058,2059,2059,2058,2058,2057,2057,2056,2055,2053,2051,2051,2052,2055,2057,2059,2058,2057,2056,2055,2054,2053,2050,2047,2045,2045,2047,2049,2051,2053,2055,2057,2058,2058,2058,2057,2056,2056,2054,2052,2049,2047,2045,2043,2042,2042,2043,2044,2046,2048,2051,2053,2055,2055,2056,2056,2056,2057,2057,2056,2054,2053,2052,2053,2054,2056,2058,2058,2058,2059,2060,2061,2061,2060,2059,2058,2057,2055,2054,2052,2051,2050,2051,2051,2051,2052,2053,2054,2055,2054,2052,2051,2050,2049,2048,2048,2047,2048,2049,2051,2052,2053,2054,2054,2054,2054,2054,2055,2056,2057,2057,2055,2053,2051,2049,2046,2044,2043,2042,2042,2042,2042,2042,2042,2042,2043,2045,2046,2048,2051,2054,2057,2059,2061,2062,2063,2063,2062,2063,2063,2064,2064,2063,2061,2059,2058,2058,2058,2058,2057,2054,2051,2049,2048,2048,2047,2046,2046,2047,2047,2049,2050,2051,2052,2053,2054,2056,2058,2060,2061,2062,2061,2059,2056,2054,2052,2050,2050,2049,2048,2048,2049,2050,2050,2051,2052,2053,2053,2052,2051,2049,2047,2046,2046,2046,2046,2047,2047,2047,2048,2049,2050,2052,2053,2053,2054,2054,2054,2054,2053,2052,2050,2048,2046,2045,2045,2045,2046,2047,2047,2046,2044,2042,2039,2036,2035,2034,2034,2034,2035,2036,2037,2039,2040,2042,2044,2046,2048,2050,2051,2052,2052,2051,2051,2050,2050,2050,2051,2053,2054,2055,2055,2055,2055,2054,2052,2051,2049,2049,2049,2048,2047,2045,2044,2043,2042,2042,2042,2042,2043,2044,2045,2046,2047,2047,2046,2045,2046,2047,2048,2050,2050,2049,2048,2047,2046,2046,2046,2048,2048,2049,2048,2047,2046,2045,2045,2046,2047,2047,2046,2045,2045,2045,2045,2044,2044,2042,2040,2038,2038,2040,2042,2044,2045,2046,2047,2048,2049,2050,2049,2048,2047,2046,2046,2047,2047,2047,2048,2050,2053,2055,2056,2056,2055,2053,2050,2046,2044,2042,2041,2040,2040,2040,2040,2040,2040,2041,2043,2045,2048,2051,2054,2057,2058,2058,2058,2057,2056,2055,2052,2049,2046,2043,2039,2037,2036,2037,2038,2039,2041,2042,2044,2046,2048,2051,2054,2056,2058,2059,2059,2059,2057,2056,2054,2052,2050,2049,2050,2051,2052,2052,2052,2050,2047,2044,2041,2039,2038,2038,2037,2036,2034,2032,2032,2032,2034,2036,2039,2041,2043,2045,2047,2050,2051,2051,2051,2050,2050,2051,2053,2054,2053,2052,2051,2051,2052,2052,2051,2048,2045,2043,2043,2045,2045,2045,2043,2041,2039,2038,2039,2042,2045,2048,2050,2052,2055,2058,2062,2064,2064,2063,2062,2061,2060,2058,2055,2050,2046,2044,2043,2042,2040,2038,2036,2036,2037,2038,2038,2038,2037,2036,2035,2035,2035,2036,2037,2039,2041,2044,2047,2050,2052,2053,2054,2054,2056,2058,2059,2059,2058,2056,2055,2055,2055,2056,2056,2055,2054,2053,2051,2050,2048,2048,2047,2046,2046,2047,2049,2052,2055,2058,2058,2058,2057,2056,2055,2054,2054,2054,2054,2054,2052,2050,2048,2047,2047,2047,2047,2046,2044,2043,2044,2045,2047,2049,2050,2050,2050,2049,2049,2049,2049,2049,2049,2050,2050,2049,2050,2050,2051,2051,2052,2053,2054,2055,2054,2054,2053,2053,2053,2053,2053,2054,2055,2055,2055,2053,2052,2051,2051,2052,2054,2056,2056,2056,2056,2054,2052,2050,2048,2046,2045,2044,2042,2040,2040,2040,2042,2043,2045,2047,2048,2047,2047,2046,2047,2048,2049,2050,2050,2049,2048,2047,2046,2045,2045,2046,2047,2048,2050,2051,2053,2053,2052,2051,2052,2053,2056,2057,2057,2057,2056,2056,2056,2054,2052,2051,2050,2050,2048,2047,2047,2047,2048,2049,2051,2051,2052,2053,2054,2055,2055,2054,2054,2054,2053,2052,2051,2050,2048,2046,2044,2043,2043,2042,2042,2042,2042,2044,2046,2047,2049,2051,2053,2056,2058,2060,2060,2060,2060,2059,2058,2057,2055,2053,2051,2049,2047,2047,2046,2047,2048,2050,2052,2055,2057,2059,2060,2060,2059,2057,2054,2052,2050,2048,2046,2045,2045,2047,2049,2052,2054,2055,2056,2055,2054,2052,2050,2047,2045,2043,2042,2042,2042,2044,2045,2046,2047,2047,2046,2045,2045,2045,2046,2046,2047,2049,2051,2053,2055,2056,2057,2057,2057,2059,2061,2061,2061,2060,2058,2057,2057,2057,2057,2058,2058,2057,2054,2051,2049,2049,2049,2050,2051,2052,2052,2052,2051,2050,2049,2049,2047,2046,2045,2044,2044,2044,2045,2046,2048,2050,2051,2052,2053,2053,2052,2052,2050,2048,2047,2046,2046,2047,2048,2049,2050,2050,2050,2050,2051,2053,2054,2055,2055,2054,2055,2056,2058,2058,2058,2056,2055,2054,2054,2053,2053,2054,2054,2055,2056,2056,2055,2053,2050,2049,2049,2048,2048,2047,2046,2046,2046,2046,2046,2045,2045,2045,2044,2043,2042,2041,2040,2039,2038,2039,2039,2039,2039,2040,2040,2041,2042,2042,2042,2042,2042,2041,2041,2041,2041,2043,2044,2046,2048,2049,2051,2053,2055,2056,2057,2057,2057,2057,2055,2053,2051,2050,2050,2048,2046,2044,2044,2044,2044,2043,2042,2041,2039,2038,2037,2036,2036,2037,2038,2038,2038,2038,2037,2036,2035,2035,2036,2038,2040,2042,2044,2047,2050,2051,2052,2052,2052,2053,2054,2056,2056,2055,2052,2050,2047,2045,2044,2044,2043,2042,2040,2039,2039,2040,2041,2043,2044,2044,2044,2044,2044,2045,2045,2045,2044,2043,2042,2043,2044,2045,2046,2048,2049,2050,2050,2049,2048,2046,2045,2043,2042,2041,2040,2039,2039,2039,2039,2040,2040,2042,2043,2044,2046,2047,2049,2050,2051,2051,2050,2049,2047,2046,2045,2044,2042,2041,2040,2040,2040,2041,2043,2044,2046,2048,2051,2054,2056,2057,2057,2057,2057,2058,2057,2055,2052,2049,2046,2043,2041,2040,2039,2039,2040,2040,2041,2041,2042,2042,2044,2045,2046,2048,2050,2052,2052,2053,2053,2053,2052,2051,2051,2053,2054,2056,2056,2056,2056,2056,2055,2055,2056,2056,2056,2056,2055,2054,2051,2048,2047,2046,2045,2044,2042,2041,2042,2043,2045,2046,2047,2047,2048,2048,2049,2050,2050,2050,2050,2050,2051,2051,2051,2050,2049,2047,2047,2046,2045,2044,2043,2042,2040,2038,2037,2037,2038,2040,2043,2046,2049,2051,2053,2054,2055,2056,2057,2058,2059,2060,2062,2064,2064,2064,2062,2061,2060,2059,2057,2054,2052,2050,2049,2049,2049,2049,2048,2047,2046,2045,2045,2045,2045,2046,2046,2046,2047,2047,2049,2050,2050,2049,2048,2048,2048,2049,2050,2052,2053,2053,2053,2052,2051,2049,2048,2046,2046,2046,2046,2047,2048,2049,2050,2051,2052,2053,2054,2055,2055,2055,2055,2055,2055,2056,2057,2058,2059,2060,2059,2058,2056,2054,2053,2052,2052,2050,2050,2050,2051,2051,2051,2049,2048,2046,2046,2047,2048,2050,2052,2054,2054,2054,2054,2055,2055,2055,2055,2055,2055,2055,2055,2055,2054,2053,2051,2049,2046,2045,2044,2044,2044,2044,2043,2043,2044,2044,2044,2044,2044,2045,2047,2049,2051,2054,2056,2057,2057,2056,2056,2055,2055,2054,2053,2051,2049,2047,2046,2045,2045,2045,2045,2045,2045,2044,2044,2042,2040,2039,2039,2039,2039,2039,2040,2041,2043,2045,2048,2051,2054,2056,2056,2056,2055,2054,2053,2052,2051,2050,2049,2047,2046,2045,2044,2043,2042,2041,2041,2042,2041,2041,2041,2041,2042,2043,2044,2045,2044,2045,2046,2046,2046,2046,2045,2044,2043,2043,2043,2043,2042,2042,2042,2042,2043,2043,2044,2044,2045,2046,2046,2045,2045,2045,2046,2046,2043,2040,2035,2032,2030,2030,2030,2030,2031,2032,2033,2035,2036,2037,2038,2040,2042,2043,2044,2043,2043,2042,2041,2041,2041,2041,2041,2040,2038,2037,2037,2038,2038,2038,2037,2036,2035,2034,2033,2033,2034,2036,2037,2039,2039,2040,2041,2044,2046,2047,2047,2047,2047,2046,2045,2043,2042,2043,2044,2045,2043,2041,2038,2036,2035,2034,2034,2034,2035,2037,2040,2043,2045,2046,2047,2047,2046,2044,2043,2041,2041,2041,2042,2043,2044,2045,2046,2047,2048,2049,2049,2049,2047,2045,2043,2042,2041,2041,2041,2042,2042,2042,2042,2042,2041,2041,2041,2041,2041,2042,2042,2043,2044,2045,2046,2047,2048,2048,2048,2047,2046,2045,2045,2044,2044,2044,2044,2044,2044,2045,2047,2048,2050,2052,2053,2052,2051,2051,2051,2052,2052,2053,2052,2052,2050,2049,2048,2047,2047,2048,2050,2052,2052,2053,2053,2053,2053,2054,2054,2054,2054,2053,2052,2050,2049,2048,2048,2049,2049,2050,2051,2051,2052,2052,2053,2053,2052,2051,2050,2050,2050,2051,2051,2052,2052,2052,2052,2052,2053,2054,2056,2058,2059,2060,2062,2062,2063,2062,2061,2060,2058,2056,2054,2053,2052,2051,2051,2051,2050,2049,2048,2048,2047,2047,2048,2049,2051,2053,2054,2054,2054,2054,2053,2053,2053,2053,2052,2053,2054,2056,2058,2060,2060,2060,2059,2058,2058,2057,2055,2053,2052,2052,2052,2053,2054,2055,2055,2056,2057,2058,2059,2060,2062,2063,2064,2064,2063,2061,2059,2057,2056,2055,2053,2051,2049,2049,2050,2050,2049,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2050,2051,2052,2053,2054,2054,2054,2052,2050,2048,2046,2045,2043,2042,2041,2040,2039,2040,2042,2044,2046,2047,2050,2052,2054,2055,2055,2055,2055,2054,2054,2053,2052,2052,2053,2054,2055,2056,2056,2055,2055,2054,2054,2053,2052,2050,2048,2046,2045,2046,2047,2048,2049,2050,2051,2050,2049,2047,2045,2044,2042,2040,2038,2037,2036,2037,2039,2041,2043,2045,2047,2048,2049,2049,2049,2048,2048,2047,2046,2046,2047,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2051,2052,2053,2053,2053,2054,2054,2055,2054,2052,2051,2050,2050,2049,2048,2046,2044,2042,2040,2039,2037,2036,2035,2035,2034,2034,2034,2035,2035,2037,2038,2039,2039,2040,2040,2041,2042,2043,2043,2043,2043,2043,2042,2041,2041,2041,2042,2044,2046,2048,2049,2049,2048,2047,2047,2047,2048,2048,2047,2048,2049,2051,2053,2055,2056,2055,2054,2052,2051,2050,2050,2049,2049,2048,2048,2048,2047,2047,2046,2046,2045,2045,2045,2044,2042,2041,2040,2041,2043,2045,2046,2047,2047,2048,2048,2048,2047,2045,2042,2040,2039,2037,2036,2036,2036,2038,2040,2041,2043,2046,2048,2050,2053,2055,2056,2057,2058,2058,2059,2060,2060,2060,2058,2056,2053,2050,2048,2046,2044,2042,2039,2037,2036,2034,2033,2031,2030,2030,2031,2032,2033,2035,2036,2039,2041,2043,2045,2047,2048,2049,2050,2051,2051,2051,2050,2049,2048,2047,2048,2049,2050,2051,2052,2052,2051,2050,2048,2045,2043,2042,2042,2042,2042,2042,2042,2041,2039,2038,2037,2036,2036,2037,2038,2039,2040,2041,2042,2044,2045,2046,2047,2047,2048,2047,2047,2047,2047,2046,2045,2044,2044,2044,2045,2045,2045,2046,2047,2049,2049,2049,2046,2043,2040,2038,2037,2038,2039,2041,2043,2045,2045,2045,2045,2044,2043,2042,2041,2040,2040,2040,2040,2040,2039,2040,2041,2043,2045,2047,2048,2048,2048,2046,2045,2043,2041,2040,2039,2040,2043,2046,2050,2053,2056,2058,2059,2060,2060,2060,2058,2054,2050,2045,2041,2038,2036,2036,2036,2035,2035,2035,2036,2037,2039,2041,2044,2046,2047,2049,2051,2052,2053,2054,2054,2054,2053,2052,2051,2051,2051,2051,2051,2050,2048,2046,2044,2043,2042,2043,2044,2045,2046,2045,2045,2044,2042,2042,2041,2041,2041,2042,2042,2042,2042,2041,2041,2042,2044,2046,2049,2051,2054,2056,2057,2058,2058,2058,2058,2057,2055,2053,2050,2048,2048,2048,2048,2048,2047,2046,2046,2046,2046,2046,2046,2047,2048,2050,2051,2051,2051,2050,2050,2050,2048,2046,2044,2042,2041,2042,2043,2044,2044,2045,2046,2047,2047,2046,2046,2045,2045,2044,2044,2044,2044,2046,2048,2050,2053,2055,2056,2056,2057,2058,2057,2056,2054,2052,2050,2050,2050,2051,2051,2051,2051,2051,2050,2049,2047,2045,2043,2042,2041,2041,2041,2041,2041,2041,2041,2041,2041,2042,2043,2043,2042,2041,2041,2041,2043,2045,2047,2048,2049,2050,2052,2053,2055,2056,2056,2056,2055,2054,2052,2051,2050,2049,2048,2048,2048,2048,2048,2047,2046,2045,2043,2042,2041,2041,2041,2041,2041,2042,2043,2045,2047,2050,2052,2055,2057,2057,2057,2056,2056,2055,2053,2050,2048,2047,2046,2045,2044,2042,2041,2039,2038,2037,2036,2035,2034,2034,2034,2035,2036,2037,2038,2038,2038,2038,2039,2040,2041,2043,2043,2043,2044,2045,2047,2049,2050,2050,2049,2048,2047,2046,2046,2045,2043,2042,2040,2039,2039,2040,2042,2043,2044,2045,2046,2047,2048,2049,2050,2051,2051,2051,2050,2049,2048,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2048,2048,2046,2045,2045,2044,2045,2045,2044,2044,2044,2046,2047,2048,2048,2048,2047,2047,2047,2048,2047,2047,2046,2045,2043,2042,2041,2041,2041,2042,2042,2042,2043,2045,2046,2047,2048,2048,2047,2047,2047,2047,2049,2051,2053,2054,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2056,2058,2060,2062,2063,2062,2061,2059,2057,2055,2053,2051,2049,2047,2046,2046,2047,2049,2049,2049,2050,2051,2053,2054,2055,2056,2056,2056,2057,2058,2058,2057,2055,2054,2053,2053,2052,2051,2050,2050,2050,2051,2053,2054,2056,2057,2057,2058,2059,2059,2059,2060,2060,2061,2061,2060,2059,2057,2057,2056,2056,2056,2056,2057,2057,2057,2056,2054,2052,2051,2050,2049,2048,2048,2048,2050,2051,2053,2053,2054,2054,2055,2057,2059,2059,2060,2060,2059,2059,2057,2055,2052,2050,2048,2046,2045,2045,2045,2047,2048,2048,2048,2048,2048,2049,2050,2051,2052,2052,2051,2050,2049,2049,2049,2049,2049,2049,2048,2047,2047,2046,2046,2046,2047,2049,2050,2051,2051,2051,2051,2051,2050,2049,2048,2047,2048,2049,2049,2049,2047,2045,2043,2041,2039,2037,2036,2036,2037,2039,2041,2043,2045,2046,2046,2047,2046,2046,2046,2047,2047,2048,2049,2049,2049,2049,2048,2048,2047,2046,2046,2046,2046,2046,2046,2045,2044,2044,2044,2044,2044,2044,2043,2044,2045,2046,2046,2046,2044,2043,2043,2043,2043,2042,2041,2041,2041,2041,2042,2043,2044,2045,2046,2047,2046,2045,2044,2043,2043,2043,2044,2043,2044,2044,2044,2044,2043,2040,2038,2037,2037,2037,2037,2037,2038,2039,2040,2041,2042,2043,2043,2043,2043,2044,2044,2044,2043,2043,2043,2044,2045,2045,2046,2046,2045,2045,2044,2042,2042,2041,2042,2042,2042,2042,2043,2044,2044,2045,2046,2046,2045,2045,2044,2044,2043,2043,2042,2042,2042,2041,2041,2041,2040,2040,2038,2037,2035,2034,2034,2034,2036,2037,2038,2039,2039,2040,2040,2040,2040,2040,2041,2042,2043,2044,2045,2046,2046,2046,2048,2049,2051,2052,2052,2051,2051,2051,2051,2051,2051,2052,2051,2051,2050,2049,2047,2046,2046,2045,2045,2045,2046,2046,2046,2046,2045,2045,2044,2043,2043,2043,2043,2044,2045,2045,2045,2044,2043,2041,2041,2041,2041,2041,2042,2043,2044,2046,2047,2048,2048,2048,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2046,2047,2049,2051,2052,2053,2053,2052,2051,2049,2048,2045,2043,2041,2039,2039,2040,2042,2045,2048,2052,2056,2060,2063,2065,2066,2066,2064,2062,2059,2056,2053,2051,2049,2048,2047,2045,2044,2043,2043,2043,2043,2044,2045,2045,2046,2047,2047,2047,2047,2046,2044,2043,2044,2045,2047,2048,2050,2051,2051,2050,2050,2050,2051,2051,2052,2052,2052,2052,2052,2053,2053,2053,2053,2054,2056,2058,2059,2060,2060,2058,2056,2054,2052,2051,2050,2049,2048,2048,2047,2047,2047,2047,2046,2045,2043,2043,2043,2044,2046,2047,2049,2050,2050,2050,2051,2051,2050,2050,2049,2048,2048,2047,2047,2047,2048,2049,2050,2051,2052,2053,2054,2055,2056,2057,2058,2059,2058,2057,2054,2051,2049,2047,2046,2045,2045,2045,2046,2046,2047,2048,2048,2049,2050,2050,2050,2050,2050,2050,2050,2051,2052,2052,2050,2049,2047,2046,2046,2046,2045,2044,2043,2043,2042,2042,2043,2045,2049,2053,2057,2059,2060,2059,2056,2052,2049,2046,2044,2042,2041,2040,2040,2040,2040,2040,2040,2041,2042,2044,2045,2045,2045,2045,2044,2044,2043,2044,2044,2046,2048,2049,2050,2050,2050,2050,2051,2051,2051,2051,2049,2048,2046,2045,2044,2043,2042,2040,2039,2039,2040,2040,2041,2042,2043,2045,2048,2050,2052,2053,2054,2053,2053,2051,2049,2048,2047,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2045,2045,2045,2045,2043,2042,2041,2039,2037,2035,2034,2034,2035,2036,2038,2038,2038,2038,2037,2037,2037,2037,2038,2039,2040,2042,2043,2046,2047,2048,2048,2046,2045,2045,2044,2045,2045,2046,2048,2051,2053,2055,2057,2059,2060,2060,2060,2059,2057,2056,2054,2051,2048,2045,2043,2042,2041,2041,2040,2038,2037,2036,2035,2035,2034,2034,2034,2033,2034,2035,2037,2040,2043,2046,2049,2052,2054,2055,2054,2053,2052,2051,2052,2052,2052,2052,2051,2051,2052,2052,2051,2049,2048,2047,2047,2048,2049,2048,2047,2045,2044,2043,2042,2041,2040,2039,2039,2039,2040,2041,2043,2045,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2046,2045,2044,2045,2047,2049,2050,2052,2053,2053,2052,2052,2051,2051,2052,2052,2053,2053,2053,2053,2053,2053,2053,2052,2052,2051,2051,2051,2052,2054,2056,2058,2061,2063,2064,2064,2064,2063,2061,2058,2056,2054,2052,2050,2049,2047,2045,2043,2041,2039,2037,2036,2036,2037,2038,2040,2042,2044,2046,2048,2049,2051,2052,2053,2053,2052,2052,2051,2050,2049,2049,2048,2049,2049,2049,2051,2052,2053,2054,2055,2055,2055,2054,2053,2051,2051,2051,2052,2054,2054,2055,2055,2056,2057,2057,2057,2057,2058,2058,2058,2057,2056,2054,2053,2052,2051,2050,2050,2049,2049,2048,2047,2046,2045,2044,2043,2043,2044,2045,2047,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2050,2052,2053,2054,2055,2055,2056,2056,2057,2058,2058,2056,2054,2051,2048,2046,2044,2043,2042,2041,2040,2039,2038,2037,2037,2039,2041,2043,2044,2045,2046,2046,2048,2049,2050,2049,2047,2046,2047,2048,2049,2051,2051,2051,2051,2052,2053,2055,2056,2056,2055,2053,2051,2050,2048,2047,2045,2044,2044,2044,2043,2041,2039,2037,2036,2037,2039,2041,2042,2042,2042,2041,2041,2042,2042,2042,2041,2041,2042,2043,2045,2045,2045,2045,2045,2045,2045,2045,2044,2045,2046,2048,2050,2052,2053,2054,2054,2055,2055,2054,2053,2051,2048,2046,2043,2040,2038,2036,2036,2037,2039,2042,2044,2045,2046,2046,2046,2047,2048,2048,2048,2049,2050,2051,2052,2052,2053,2053,2054,2053,2052,2050,2048,2046,2044,2043,2041,2039,2037,2037,2037,2039,2041,2044,2046,2049,2051,2053,2054,2055,2055,2054,2054,2053,2053,2052,2052,2051,2051,2051,2052,2053,2053,2053,2053,2052,2051,2049,2048,2046,2044,2042,2040,2038,2037,2036,2036,2035,2035,2035,2037,2039,2041,2044,2046,2048,2049,2051,2053,2053,2053,2052,2051,2049,2046,2045,2044,2044,2046,2047,2048,2049,2051,2052,2055,2057,2059,2061,2062,2061,2060,2059,2057,2055,2053,2051,2048,2045,2043,2041,2040,2039,2039,2040,2041,2043,2046,2048,2050,2050,2049,2048,2046,2045,2045,2046,2046,2046,2047,2048,2048,2048,2046,2043,2040,2039,2038,2039,2042,2045,2050,2054,2058,2061,2064,2066,2067,2068,2068,2067,2066,2064,2062,2060,2058,2055,2053,2051,2049,2049,2049,2049,2048,2047,2045,2044,2043,2043,2043,2044,2046,2048,2049,2050,2051,2051,2050,2049,2048,2046,2044,2043,2043,2044,2046,2048,2051,2053,2055,2056,2057,2058,2058,2058,2058,2058,2057,2055,2052,2050,2048,2046,2045,2045,2045,2045,2045,2046,2045,2045,2044,2044,2044,2044,2044,2045,2046,2048,2049,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2050,2050,2050,2050,2051,2053,2055,2056,2057,2058,2059,2060,2060,2061,2063,2064,2065,2065,2064,2062,2060,2058,2057,2055,2054,2054,2053,2053,2052,2052,2052,2051,2051,2051,2050,2049,2047,2045,2044,2043,2041,2039,2038,2037,2038,2040,2040,2040,2039,2038,2037,2037,2037,2037,2037,2037,2037,2038,2039,2039,2040,2041,2042,2043,2044,2045,2046,2048,2050,2052,2053,2055,2055,2056,2056,2054,2052,2050,2048,2046,2045,2044,2044,2044,2045,2046,2047,2048,2049,2050,2053,2055,2057,2057,2056,2053,2050,2047,2045,2043,2043,2042,2042,2042,2043,2043,2043,2043,2042,2041,2040,2040,2039,2038,2037,2037,2037,2038,2039,2039,2039,2040,2040,2041,2041,2040,2040,2040,2041,2042,2043,2045,2047,2050,2052,2054,2055,2054,2054,2052,2051,2049,2047,2046,2045,2044,2043,2043,2043,2044,2045,2046,2046,2046,2046,2046,2047,2047,2048,2048,2049,2050,2051,2053,2055,2056,2056,2056,2055,2054,2053,2053,2052,2052,2051,2051,2051,2051,2050,2049,2047,2045,2043,2041,2040,2039,2038,2038,2037,2037,2036,2036,2036,2037,2037,2037,2037,2037,2038,2038,2039,2041,2043,2045,2047,2047,2048,2048,2050,2051,2053,2054,2055,2055,2056,2057,2057,2057,2057,2056,2056,2056,2055,2054,2052,2050,2049,2047,2046,2044,2042,2040,2039,2039,2039,2040,2041,2041,2041,2041,2041,2043,2045,2047,2049,2050,2051,2051,2051,2051,2051,2051,2052,2052,2053,2053,2053,2052,2051,2049,2046,2043,2041,2039,2039,2039,2039,2040,2041,2043,2045,2046,2047,2048,2049,2049,2050,2049,2049,2048,2047,2047,2048,2048,2049,2049,2049,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2047,2046,2045,2046,2048,2050,2051,2052,2052,2051,2050,2050,2049,2048,2046,2045,2044,2044,2045,2046,2046,2048,2049,2050,2052,2054,2055,2056,2056,2056,2056,2056,2055,2054,2053,2052,2051,2051,2050,2049,2048,2047,2046,2044,2042,2040,2038,2037,2036,2037,2038,2039,2041,2043,2044,2045,2045,2046,2047,2049,2050,2051,2052,2053,2053,2053,2053,2052,2051,2051,2050,2050,2050,2051,2052,2053,2054,2054,2054,2053,2052,2051,2051,2051,2052,2052,2051,2050,2048,2046,2045,2044,2044,2045,2046,2047,2048,2049,2050,2051,2052,2053,2054,2056,2058,2060,2062,2062,2061,2060,2059,2058,2058,2056,2054,2053,2052,2051,2051,2051,2051,2050,2049,2047,2045,2044,2043,2043,2044,2046,2050,2054,2058,2061,2064,2066,2068,2068,2068,2066,2063,2059,2056,2053,2050,2048,2047,2047,2047,2048,2050,2050,2050,2049,2048,2047,2047,2048,2048,2049,2050,2052,2054,2055,2056,2057,2057,2057,2057,2057,2057,2058,2059,2058,2057,2056,2054,2052,2050,2049,2047,2047,2047,2048,2050,2052,2055,2057,2060,2063,2064,2065,2064,2062,2059,2057,2056,2056,2055,2055,2054,2053,2052,2050,2049,2048,2048,2048,2049,2052,2054,2057,2059,2059,2060,2059,2059,2058,2057,2055,2052,2049,2047,2046,2045,2045,2045,2045,2046,2047,2049,2049,2050,2049,2047,2046,2045,2044,2044,2044,2044,2043,2043,2043,2045,2048,2051,2055,2057,2058,2059,2060,2062,2063,2063,2062,2060,2058,2056,2055,2054,2053,2051,2050,2048,2048,2048,2048,2048,2048,2047,2046,2045,2044,2044,2044,2043,2042,2041,2041,2042,2043,2045,2047,2048,2047,2046,2044,2042,2040,2040,2040,2041,2043,2044,2047,2049,2050,2050,2050,2050,2050,2049,2048,2046,2045,2045,2044,2043,2043,2043,2044,2045,2045,2045,2046,2046,2046,2047,2048,2049,2052,2055,2058,2060,2061,2061,2061,2060,2060,2059,2058,2057,2055,2053,2051,2049,2048,2047,2047,2046,2046,2045,2043,2042,2041,2040,2039,2037,2036,2035,2034,2034,2034,2035,2036,2038,2041,2042,2043,2042,2040,2037,2036,2034,2033,2033,2033,2034,2036,2039,2043,2046,2050,2052,2055,2057,2058,2058,2057,2055,2052,2049,2047,2047,2048,2050,2051,2051,2051,2052,2053,2054,2055,2055,2055,2054,2053,2052,2051,2049,2049,2048,2048,2047,2046,2046,2045,2045,2044,2044,2045,2046,2046,2046,2046,2045,2045,2044,2045,2045,2046,2046,2046,2045,2045,2045,2045,2046,2046,2046,2046,2045,2042,2040,2038,2036,2036,2036,2038,2040,2045,2050,2054,2057,2059,2061,2063,2064,2064,2064,2064,2064,2063,2062,2061,2059,2057,2055,2053,2050,2048,2046,2044,2042,2040,2038,2035,2034,2033,2034,2036,2038,2041,2044,2046,2048,2050,2052,2053,2055,2056,2057,2057,2056,2055,2054,2053,2052,2051,2050,2050,2050,2051,2052,2053,2054,2055,2056,2056,2055,2054,2053,2051,2050,2048,2048,2047,2046,2045,2045,2045,2045,2044,2044,2044,2044,2045,2047,2049,2050,2052,2053,2054,2055,2055,2055,2053,2051,2049,2047,2045,2045,2046,2047,2048,2050,2051,2051,2050,2049,2047,2044,2041,2039,2037,2036,2036,2035,2035,2035,2036,2038,2039,2041,2043,2045,2048,2050,2052,2054,2056,2056,2056,2056,2055,2054,2053,2051,2049,2047,2047,2046,2047,2048,2049,2051,2053,2055,2056,2057,2057,2056,2054,2052,2050,2049,2047,2046,2045,2045,2045,2045,2045,2045,2046,2046,2048,2049,2052,2054,2056,2057,2058,2058,2058,2058,2058,2058,2057,2056,2054,2052,2051,2050,2049,2048,2047,2046,2045,2044,2043,2042,2041,2040,2039,2038,2037,2036,2036,2037,2038,2039,2041,2042,2043,2043,2043,2043,2044,2044,2044,2045,2047,2048,2050,2051,2052,2053,2053,2054,2054,2054,2053,2053,2052,2052,2051,2051,2050,2049,2047,2044,2041,2040,2040,2041,2043,2044,2046,2047,2049,2052,2054,2055,2055,2055,2055,2056,2057,2059,2061,2061,2060,2058,2055,2052,2049,2046,2043,2040,2038,2038,2039,2041,2043,2045,2047,2048,2050,2051,2052,2052,2052,2052,2051,2050,2049,2048,2047,2047,2047,2048,2049,2049,2048,2047,2046,2045,2045,2045,2045,2045,2046,2047,2048,2050,2051,2053,2054,2056,2058,2059,2061,2061,2062,2061,2060,2059,2057,2056,2055,2054,2053,2052,2051,2049,2047,2045,2044,2043,2043,2044,2045,2047,2049,2050,2051,2052,2052,2052,2052,2053,2054,2054,2055,2056,2057,2058,2058,2058,2058,2057,2055,2054,2053,2052,2052,2053,2052,2052,2052,2052,2053,2053,2054,2054,2053,2053,2052,2052,2051,2050,2050,2049,2049,2048,2048,2049,2050,2051,2052,2054,2054,2055,2054,2053,2053,2053,2053,2054,2054,2055,2055,2055,2055,2055,2055,2055,2055,2055,2056,2057,2057,2058,2059,2060,2060,2060,2060,2058,2057,2056,2054,2053,2052,2051,2050,2048,2047,2047,2048,2049,2050,2051,2052,2053,2054,2054,2054,2054,2054,2054,2053,2052,2051,2050,2051,2051,2052,2053,2053,2053,2052,2052,2052,2053,2053,2054,2055,2056,2057,2057,2058,2058,2058,2058,2056,2055,2054,2053,2052,2050,2048,2047,2045,2045,2044,2044,2044,2045,2046,2048,2049,2051,2051,2052,2053,2055,2057,2058,2059,2058,2057,2056,2054,2053,2053,2053,2054,2054,2055,2055,2056,2057,2058,2058,2058,2058,2057,2055,2053,2051,2048,2047,2046,2045,2045,2044,2044,2044,2045,2047,2048,2050,2052,2053,2054,2055,2055,2055,2054,2054,2053,2052,2052,2051,2051,2051,2050,2049,2049,2049,2049,2051,2052,2053,2053,2054,2055,2057,2059,2060,2061,2060,2059,2058,2057,2055,2052,2049,2046,2044,2042,2040,2039,2039,2039,2040,2042,2044,2046,2048,2050,2052,2053,2054,2054,2053,2051,2049,2045,2042,2038,2036,2034,2033,2033,2034,2035,2036,2038,2040,2042,2045,2048,2051,2053,2055,2056,2057,2056,2055,2055,2054,2053,2052,2051,2050,2049,2048,2046,2044,2043,2043,2044,2045,2047,2048,2049,2049,2049,2050,2050,2050,2049,2047,2045,2043,2041,2039,2037,2034,2031,2027,2025,2025,2025,2027,2029,2030,2031,2033,2035,2037,2039,2039,2039,2038,2036,2035,2034,2033,2032,2031,2031,2030,2030,2031,2032,2035,2037,2039,2041,2043,2045,2046,2047,2046,2046,2046,2045,2045,2045,2045,2046,2047,2048,2049,2049,2049,2048,2047,2046,2046,2047,2048,2048,2048,2049,2050,2050,2049,2048,2046,2044,2041,2038,2036,2034,2032,2032,2031,2031,2031,2031,2031,2031,2031,2032,2032,2032,2031,2031,2030,2030,2030,2030,2031,2032,2034,2036,2038,2039,2040,2040,2040,2039,2039,2038,2038,2038,2038,2038,2038,2037,2037,2036,2037,2037,2038,2039,2040,2042,2044,2046,2048,2050,2052,2054,2055,2056,2055,2054,2052,2050,2048,2045,2043,2042,2042,2042,2043,2043,2044,2044,2045,2046,2048,2048,2049,2049,2049,2049,2048,2047,2045,2045,2044,2044,2045,2044,2044,2044,2044,2044,2044,2043,2043,2042,2041,2039,2038,2037,2038,2038,2039,2039,2040,2041,2042,2043,2043,2043,2043,2044,2045,2046,2047,2047,2047,2046,2045,2045,2045,2045,2046,2047,2048,2050,2051,2053,2054,2054,2053,2052,2051,2050,2049,2048,2047,2045,2044,2043,2042,2043,2043,2044,2045,2045,2046,2048,2049,2050,2051,2051,2050,2049,2048,2047,2046,2045,2045,2044,2044,2043,2043,2044,2046,2048,2050,2052,2054,2055,2056,2056,2056,2055,2055,2055,2054,2053,2053,2052,2052,2051,2051,2051,2051,2052,2053,2053,2053,2053,2053,2053,2054,2055,2056,2057,2058,2057,2056,2054,2052,2049,2047,2044,2041,2039,2038,2038,2038,2038,2037,2038,2039,2039,2040,2040,2040,2041,2041,2042,2044,2046,2049,2052,2054,2055,2056,2056,2056,2056,2056,2056,2055,2055,2055,2054,2054,2053,2054,2054,2055,2055,2054,2053,2053,2052,2051,2050,2050,2049,2048,2047,2046,2045,2043,2042,2042,2043,2044,2045,2047,2048,2050,2050,2051,2051,2051,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2052,2051,2051,2050,2049,2049,2049,2049,2050,2052,2053,2055,2056,2058,2059,2059,2059,2058,2058,2058,2058,2058,2057,2056,2056,2056,2057,2058,2060,2061,2062,2063,2064,2063,2061,2058,2055,2053,2050,2049,2047,2046,2046,2046,2048,2050,2052,2054,2055,2057,2059,2060,2061,2061,2062,2062,2062,2060,2059,2056,2054,2053,2051,2050,2049,2048,2047,2046,2046,2046,2047,2047,2048,2049,2050,2052,2053,2054,2055,2056,2058,2059,2060,2060,2060,2060,2060,2060,2059,2059,2058,2058,2056,2054,2052,2049,2046,2044,2043,2042,2042,2041,2040,2040,2040,2041,2042,2043,2043,2043,2042,2042,2041,2040,2041,2042,2043,2045,2047,2049,2050,2051,2051,2050,2050,2049,2048,2047,2046,2046,2045,2045,2045,2044,2043,2043,2042,2042,2041,2042,2043,2044,2047,2049,2052,2054,2057,2059,2060,2061,2062,2062,2061,2060,2058,2057,2056,2055,2055,2056,2058,2059,2060,2060,2058,2056,2055,2053,2052,2050,2048,2045,2043,2040,2038,2037,2035,2034,2033,2032,2031,2031,2030,2030,2030,2032,2034,2035,2036,2037,2038,2039,2040,2041,2041,2041,2041,2042,2043,2044,2045,2045,2045,2045,2044,2043,2042,2040,2039,2038,2038,2038,2038,2039,2040,2041,2043,2044,2045,2045,2046,2046,2047,2047,2048,2049,2049,2049,2050,2050,2051,2052,2052,2052,2052,2051,2049,2047,2045,2043,2040,2038,2036,2034,2033,2031,2030,2028,2028,2028,2030,2031,2033,2034,2035,2036,2036,2036,2036,2036,2036,2036,2037,2039,2041,2044,2046,2047,2047,2047,2047,2047,2046,2045,2044,2044,2044,2043,2043,2043,2043,2043,2044,2044,2045,2044,2043,2042,2040,2039,2038,2038,2038,2038,2038,2038,2039,2039,2039,2038,2036,2035,2033,2031,2029,2027,2026,2026,2027,2029,2032,2034,2037,2038,2040,2041,2043,2044,2045,2046,2047,2047,2048,2048,2047,2047,2046,2046,2046,2046,2046,2045,2045,2046,2048,2049,2050,2050,2050,2050,2052,2053,2054,2056,2056,2056,2056,2055,2053,2051,2049,2048,2047,2046,2046,2046,2046,2045,2044,2042,2040,2038,2037,2035,2035,2035,2035,2035,2036,2036,2037,2038,2040,2040,2040,2040,2039,2038,2038,2037,2036,2036,2036,2036,2038,2039,2040,2041,2042,2043,2043,2043,2043,2043,2043,2044,2045,2047,2048,2049,2049,2050,2050,2049,2047,2046,2044,2044,2043,2042,2042,2041,2040,2041,2041,2043,2044,2045,2046,2047,2047,2048,2048,2049,2050,2051,2051,2052,2053,2053,2054,2055,2056,2056,2056,2054,2052,2050,2049,2048,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2048,2049,2048,2047,2044,2042,2041,2039,2038,2037,2036,2035,2034,2033,2033,2032,2032,2032,2032,2034,2036,2039,2042,2045,2047,2049,2050,2050,2050,2051,2053,2055,2057,2058,2059,2059,2059,2059,2058,2057,2055,2054,2053,2052,2051,2051,2052,2053,2055,2057,2058,2058,2058,2058,2059,2059,2059,2058,2056,2054,2053,2053,2053,2053,2053,2051,2049,2047,2044,2042,2041,2040,2038,2038,2038,2039,2039,2040,2041,2043,2045,2046,2048,2049,2050,2050,2050,2049,2047,2045,2044,2043,2043,2043,2043,2043,2043,2045,2046,2048,2048,2048,2047,2045,2043,2041,2039,2037,2036,2035,2035,2035,2036,2037,2039,2041,2042,2044,2046,2047,2048,2049,2050,2050,2051,2051,2051,2051,2051,2050,2050,2049,2049,2050,2050,2052,2052,2053,2053,2053,2053,2053,2053,2053,2052,2052,2050,2049,2047,2045,2043,2043,2043,2043,2044,2045,2046,2047,2048,2049,2049,2050,2050,2049,2048,2047,2046,2046,2047,2049,2050,2050,2050,2050,2051,2051,2051,2050,2049,2048,2047,2047,2047,2047,2046,2046,2045,2045,2044,2044,2043,2042,2042,2042,2042,2043,2043,2044,2046,2048,2050,2052,2054,2056,2058,2059,2059,2058,2057,2054,2050,2047,2045,2043,2042,2042,2043,2045,2047,2049,2052,2054,2057,2059,2059,2060,2059,2059,2058,2058,2057,2056,2055,2055,2055,2055,2055,2056,2056,2056,2056,2055,2055,2054,2054,2053,2051,2049,2047,2045,2043,2042,2042,2042,2042,2042,2042,2041,2041,2042,2042,2042,2042,2043,2043,2044,2045,2045,2046,2045,2045,2045,2044,2044,2044,2044,2045,2045,2045,2044,2043,2043,2043,2043,2043,2043,2043,2044,2045,2046,2047,2047,2048,2047,2047,2047,2048,2047,2047,2046,2045,2044,2044,2044,2045,2046,2047,2048,2049,2049,2049,2049,2049,2049,2048,2047,2045,2044,2042,2041,2039,2038,2039,2041,2043,2046,2047,2048,2049,2050,2051,2052,2052,2052,2051,2050,2049,2048,2047,2046,2045,2044,2043,2042,2040,2040,2040,2040,2041,2042,2042,2043,2044,2044,2044,2043,2043,2042,2042,2041,2041,2040,2040,2040,2040,2040,2039,2039,2038,2037,2037,2038,2039,2040,2041,2042,2042,2043,2044,2044,2045,2044,2043,2042,2042,2042,2043,2043,2044,2045,2046,2048,2050,2051,2053,2053,2054,2055,2056,2057,2057,2057,2056,2055,2054,2053,2052,2050,2047,2045,2043,2041,2040,2040,2040,2039,2039,2038,2038,2039,2040,2041,2042,2042,2043,2043,2044,2045,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2046,2045,2044,2043,2042,2041,2040,2039,2039,2041,2042,2044,2047,2049,2050,2051,2052,2053,2053,2052,2051,2049,2048,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2045,2045,2044,2044,2044,2044,2044,2044,2043,2044,2045,2046,2046,2047,2047,2047,2047,2047,2048,2049,2051,2052,2053,2054,2054,2054,2054,2053,2052,2051,2050,2049,2049,2049,2050,2051,2051,2052,2052,2052,2052,2051,2050,2048,2046,2045,2044,2044,2043,2043,2042,2042,2041,2041,2040,2040,2040,2040,2042,2043,2045,2046,2047,2049,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2050,2051,2052,2052,2053,2054,2054,2054,2053,2052,2050,2049,2048,2047,2047,2046,2046,2046,2046,2046,2045,2044,2044,2043,2043,2043,2043,2043,2044,2046,2047,2047,2048,2049,2049,2049,2048,2048,2047,2047,2046,2045,2045,2045,2045,2044,2044,2043,2043,2043,2043,2044,2044,2044,2045,2045,2045,2046,2046,2046,2045,2045,2045,2046,2046,2047,2048,2049,2051,2052,2052,2053,2053,2053,2053,2052,2052,2052,2052,2051,2051,2050,2048,2046,2044,2042,2040,2038,2036,2035,2034,2033,2034,2035,2036,2037,2038,2040,2041,2043,2045,2046,2048,2049,2050,2050,2051,2052,2052,2053,2052,2051,2051,2050,2050,2049,2049,2048,2047,2046,2044,2043,2042,2040,2039,2039,2039,2040,2041,2042,2043,2044,2044,2045,2044,2044,2043,2043,2043,2043,2043,2044,2044,2045,2045,2046,2047,2048,2049,2051,2053,2054,2055,2056,2056,2056,2055,2054,2053,2052,2051,2049,2048,2047,2045,2044,2043,2043,2042,2043,2043,2044,2046,2047,2049,2050,2051,2051,2051,2050,2049,2048,2047,2045,2044,2042,2039,2037,2035,2034,2034,2033,2033,2034,2036,2037,2038,2039,2039,2040,2041,2042,2044,2046,2049,2050,2051,2052,2052,2051,2050,2048,2047,2045,2043,2042,2041,2041,2042,2043,2044,2045,2046,2046,2046,2046,2046,2046,2046,2046,2045,2044,2043,2042,2042,2041,2041,2041,2041,2041,2042,2042,2043,2043,2044,2045,2046,2046,2047,2047,2047,2047,2047,2046,2046,2046,2046,2047,2048,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2050,2051,2051,2052,2052,2052,2051,2049,2047,2044,2042,2040,2039,2038,2038,2037,2037,2036,2037,2038,2039,2041,2041,2042,2042,2042,2042,2042,2043,2043,2045,2046,2046,2047,2047,2047,2047,2045,2044,2043,2042,2042,2042,2041,2041,2040,2040,2040,2040,2040,2040,2041,2041,2041,2041,2042,2042,2042,2043,2044,2045,2046,2047,2049,2050,2051,2052,2052,2053,2053,2053,2052,2051,2050,2049,2047,2045,2042,2041,2040,2040,2040,2040,2040,2041,2042,2042,2042,2042,2042,2043,2044,2046,2047,2049,2051,2052,2052,2052,2051,2050,2049,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2047,2047,2046,2046,2045,2044,2044,2043,2043,2043,2043,2043,2043,2042,2042,2041,2040,2040,2040,2040,2042,2043,2044,2045,2046,2047,2048,2049,2050,2051,2053,2054,2055,2056,2056,2056,2056,2056,2056,2056,2056,2056,2055,2055,2055,2056,2057,2058,2058,2058,2057,2056,2055,2054,2053,2052,2051,2051,2051,2051,2051,2051,2050,2049,2048,2047,2047,2046,2046,2046,2046,2046,2047,2048,2049,2050,2052,2052,2053,2053,2053,2054,2053,2053,2053,2053,2053,2053,2054,2055,2057,2057,2058,2057,2056,2054,2053,2051,2049,2048,2047,2046,2046,2045,2045,2046,2047,2049,2050,2051,2052,2053,2054,2054,2054,2053,2052,2051,2050,2050,2050,2050,2050,2049,2050,2050,2051,2052,2054,2055,2056,2056,2055,2054,2053,2051,2050,2048,2047,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2049,2051,2051,2052,2052,2053,2053,2053,2054,2054,2054,2053,2052,2051,2050,2049,2048,2048,2049,2049,2050,2051,2051,2051,2051,2050,2050,2049,2048,2048,2048,2048,2049,2050,2051,2052,2053,2053,2052,2052,2050,2049,2047,2046,2045,2045,2044,2045,2045,2047,2048,2049,2050,2051,2051,2049,2048,2046,2045,2045,2044,2044,2044,2045,2046,2047,2048,2048,2048,2047,2045,2044,2043,2042,2041,2042,2043,2044,2046,2048,2050,2051,2052,2053,2052,2052,2051,2051,2050,2050,2049,2048,2047,2046,2044,2043,2043,2044,2046,2048,2049,2051,2053,2055,2056,2057,2057,2057,2057,2056,2056,2056,2055,2053,2051,2049,2046,2043,2040,2038,2037,2037,2037,2037,2037,2038,2039,2040,2041,2042,2044,2045,2045,2046,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2046,2047,2048,2048,2049,2049,2050,2051,2052,2052,2052,2051,2051,2051,2051,2050,2050,2049,2048,2046,2045,2043,2042,2042,2042,2042,2043,2043,2044,2044,2044,2044,2044,2044,2046,2047,2050,2052,2054,2056,2057,2057,2057,2056,2054,2053,2051,2050,2049,2047,2046,2045,2045,2046,2047,2048,2050,2052,2054,2055,2056,2056,2055,2054,2053,2051,2049,2047,2046,2046,2046,2046,2045,2045,2044,2044,2043,2042,2042,2042,2042,2042,2043,2044,2045,2045,2045,2046,2046,2048,2048,2049,2049,2049,2049,2048,2046,2045,2044,2044,2045,2045,2046,2046,2047,2048,2049,2050,2052,2053,2054,2054,2054,2054,2053,2053,2051,2050,2049,2047,2046,2045,2044,2044,2044,2044,2045,2046,2046,2045,2045,2044,2043,2042,2041,2041,2040,2040,2040,2041,2041,2042,2043,2044,2046,2047,2049,2050,2051,2053,2054,2054,2055,2054,2054,2053,2052,2051,2050,2049,2049,2049,2049,2049,2050,2050,2049,2049,2049,2049,2048,2047,2046,2045,2043,2042,2042,2042,2042,2042,2042,2041,2040,2039,2038,2038,2037,2037,2038,2038,2038,2038,2038,2038,2039,2041,2043,2045,2048,2050,2051,2053,2054,2055,2055,2054,2054,2053,2052,2051,2049,2047,2045,2044,2043,2042,2042,2042,2042,2043,2043,2043,2042,2041,2040,2040,2040,2040,2041,2040,2040,2040,2041,2042,2043,2045,2046,2048,2049,2051,2053,2054,2054,2054,2054,2053,2052,2049,2047,2044,2042,2040,2039,2039,2039,2039,2040,2040,2041,2042,2043,2044,2045,2046,2047,2048,2048,2048,2047,2047,2046,2045,2044,2043,2042,2042,2042,2042,2043,2044,2045,2046,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2047,2045,2044,2042,2041,2040,2039,2040,2040,2042,2044,2045,2046,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2046,2046,2046,2045,2045,2045,2046,2047,2048,2050,2050,2051,2052,2053,2053,2053,2052,2050,2048,2047,2045,2044,2043,2042,2042,2042,2042,2042,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2042,2042,2043,2043,2043,2043,2043,2043,2044,2045,2046,2048,2049,2050,2051,2053,2054,2054,2054,2054,2054,2054,2054,2053,2053,2053,2052,2052,2051,2051,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2049,2048,2047,2045,2043,2041,2040,2039,2038,2038,2038,2038,2039,2041,2043,2046,2049,2051,2053,2054,2056,2057,2057,2057,2057,2056,2055,2054,2053,2051,2049,2047,2046,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2045,2046,2047,2048,2050,2051,2052,2052,2053,2052,2052,2052,2052,2052,2052,2052,2051,2051,2050,2049,2048,2047,2046,2045,2045,2045,2045,2046,2046,2046,2047,2048,2048,2049,2050,2050,2051,2052,2053,2054,2055,2056,2057,2057,2056,2056,2055,2054,2054,2053,2051,2050,2048,2047,2047,2048,2048,2049,2049,2049,2050,2050,2051,2050,2050,2049,2049,2049,2048,2048,2047,2047,2046,2046,2045,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2047,2048,2049,2050,2051,2051,2051,2051,2051,2051,2052,2052,2052,2051,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2047,2046,2045,2045,2044,2045,2046,2046,2047,2047,2047,2048,2048,2049,2050,2051,2052,2053,2053,2054,2054,2054,2055,2055,2056,2055,2055,2055,2055,2055,2056,2056,2056,2055,2055,2054,2053,2051,2049,2047,2046,2045,2046,2047,2048,2050,2051,2052,2053,2053,2053,2052,2050,2049,2047,2046,2045,2045,2044,2043,2042,2041,2041,2040,2040,2040,2040,2040,2041,2041,2042,2044,2046,2048,2049,2050,2051,2052,2053,2055,2056,2057,2058,2058,2059,2059,2059,2058,2058,2057,2056,2055,2054,2052,2051,2049,2048,2047,2046,2046,2046,2046,2046,2046,2047,2047,2048,2050,2051,2052,2053,2054,2054,2054,2053,2052,2050,2048,2047,2047,2047,2047,2047,2047,2047,2047,2046,2044,2043,2042,2040,2040,2039,2039,2040,2040,2041,2043,2044,2046,2047,2048,2049,2050,2051,2053,2054,2054,2055,2055,2056,2056,2057,2057,2057,2056,2055,2054,2053,2051,2050,2048,2048,2047,2047,2047,2048,2049,2050,2051,2051,2052,2052,2052,2051,2051,2051,2051,2051,2052,2052,2052,2051,2050,2049,2047,2046,2045,2044,2044,2045,2046,2048,2049,2050,2051,2051,2051,2051,2050,2050,2049,2048,2048,2047,2046,2046,2046,2046,2046,2046,2046,2047,2049,2050,2051,2052,2053,2054,2054,2054,2054,2053,2053,2052,2051,2050,2049,2048,2046,2045,2044,2044,2045,2046,2048,2050,2051,2052,2053,2054,2055,2056,2056,2056,2056,2056,2055,2054,2052,2051,2050,2049,2048,2046,2044,2042,2041,2040,2039,2039,2039,2038,2038,2038,2038,2038,2039,2039,2040,2041,2043,2044,2045,2045,2046,2047,2047,2048,2048,2048,2049,2049,2050,2051,2053,2055,2057,2058,2058,2058,2057,2056,2054,2051,2049,2047,2047,2047,2048,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2050,2051,2052,2053,2054,2055,2055,2056,2056,2056,2056,2056,2056,2057,2057,2057,2057,2057,2056,2055,2054,2052,2051,2049,2048,2047,2046,2046,2046,2045,2045,2044,2043,2043,2042,2042,2043,2043,2044,2046,2047,2047,2047,2046,2045,2043,2042,2041,2040,2039,2039,2038,2037,2037,2037,2036,2037,2037,2038,2039,2040,2042,2044,2046,2048,2049,2050,2051,2051,2050,2050,2049,2049,2050,2051,2052,2052,2053,2053,2053,2053,2052,2052,2051,2050,2050,2050,2050,2051,2052,2052,2053,2053,2053,2052,2052,2051,2050,2049,2047,2046,2044,2043,2043,2043,2043,2043,2044,2044,2044,2044,2045,2044,2044,2044,2044,2044,2044,2043,2042,2042,2041,2041,2040,2040,2041,2041,2042,2043,2044,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2048,2048,2047,2046,2046,2046,2045,2045,2045,2045,2045,2046,2047,2047,2047,2048,2048,2049,2049,2049,2050,2049,2049,2048,2047,2046,2045,2044,2043,2042,2042,2042,2042,2043,2043,2044,2045,2047,2048,2050,2051,2051,2051,2050,2049,2049,2048,2048,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2049,2049,2050,2051,2051,2052,2052,2052,2051,2050,2048,2047,2046,2045,2044,2043,2042,2041,2041,2041,2041,2042,2043,2045,2046,2047,2048,2048,2049,2050,2051,2052,2052,2052,2051,2051,2050,2050,2050,2051,2052,2053,2054,2054,2054,2053,2053,2053,2052,2050,2049,2049,2049,2049,2049,2050,2050,2051,2051,2051,2051,2051,2050,2050,2050,2049,2048,2047,2047,2047,2047,2048,2048,2048,2047,2046,2046,2045,2045,2045,2046,2047,2048,2049,2050,2052,2053,2054,2054,2055,2055,2055,2054,2054,2053,2052,2051,2050,2049,2048,2048,2047,2048,2049,2049,2050,2050,2049,2049,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2048,2049,2050,2050,2051,2051,2052,2052,2053,2053,2054,2054,2055,2055,2056,2056,2056,2056,2056,2056,2056,2055,2054,2053,2052,2051,2050,2048,2047,2045,2044,2042,2041,2040,2038,2038,2038,2039,2040,2043,2045,2048,2051,2053,2055,2056,2056,2056,2055,2054,2053,2053,2052,2051,2051,2050,2050,2050,2050,2049,2049,2047,2046,2044,2043,2042,2042,2042,2041,2041,2040,2040,2040,2041,2042,2044,2047,2049,2052,2053,2054,2054,2054,2053,2053,2053,2053,2053,2053,2053,2053,2054,2054,2055,2056,2056,2056,2056,2056,2056,2056,2055,2054,2054,2053,2053,2053,2053,2052,2051,2050,2049,2048,2048,2048,2048,2048,2047,2046,2045,2044,2043,2044,2045,2046,2048,2049,2050,2051,2052,2052,2053,2053,2052,2052,2051,2052,2052,2053,2054,2055,2057,2058,2059,2060,2060,2060,2059,2057,2055,2053,2051,2049,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2047,2046,2045,2044,2043,2043,2043,2044,2044,2045,2046,2047,2047,2048,2048,2049,2049,2050,2050,2050,2049,2048,2046,2044,2043,2042,2041,2042,2043,2044,2046,2048,2051,2053,2055,2057,2059,2060,2060,2060,2059,2057,2055,2053,2052,2051,2050,2049,2049,2048,2048,2048,2047,2046,2045,2044,2043,2043,2043,2043,2044,2044,2044,2044,2044,2043,2043,2042,2041,2040,2039,2039,2039,2039,2040,2041,2042,2043,2044,2045,2046,2047,2047,2048,2049,2049,2050,2050,2051,2052,2053,2054,2056,2057,2059,2061,2061,2061,2061,2059,2058,2056,2054,2052,2050,2048,2046,2044,2043,2043,2042,2042,2041,2041,2041,2041,2041,2041,2041,2041,2040,2039,2038,2038,2038,2038,2039,2040,2040,2040,2040,2039,2038,2037,2037,2037,2039,2041,2043,2046,2048,2050,2051,2052,2052,2052,2052,2052,2052,2052,2052,2051,2050,2049,2048,2048,2047,2048,2048,2049,2050,2051,2052,2053,2054,2054,2054,2053,2052,2051,2050,2049,2048,2046,2045,2044,2043,2043,2042,2042,2043,2043,2044,2045,2045,2046,2046,2046,2046,2045,2044,2043,2043,2042,2041,2041,2041,2041,2042,2042,2043,2044,2045,2046,2047,2048,2048,2048,2047,2047,2047,2046,2046,2047,2047,2047,2048,2048,2048,2048,2047,2046,2046,2046,2046,2047,2048,2049,2050,2051,2051,2050,2048,2046,2044,2042,2041,2041,2041,2041,2041,2041,2041,2041,2041,2041,2042,2042,2043,2043,2043,2043,2043,2044,2046,2047,2049,2050,2051,2052,2053,2054,2054,2055,2056,2056,2056,2056,2055,2054,2052,2051,2051,2050,2050,2050,2050,2051,2051,2051,2050,2050,2050,2049,2048,2047,2045,2043,2042,2040,2038,2037,2037,2037,2038,2039,2040,2041,2043,2044,2045,2045,2046,2046,2046,2046,2046,2045,2045,2045,2045,2046,2047,2049,2051,2052,2054,2056,2057,2058,2058,2058,2058,2057,2056,2055,2053,2052,2051,2049,2047,2045,2043,2042,2041,2040,2040,2040,2041,2041,2042,2042,2043,2043,2045,2046,2048,2049,2049,2049,2048,2047,2046,2046,2046,2045,2045,2046,2046,2047,2048,2049,2050,2051,2051,2050,2050,2049,2049,2048,2048,2047,2047,2046,2045,2044,2043,2042,2041,2041,2042,2042,2043,2045,2046,2048,2050,2051,2052,2053,2053,2053,2053,2052,2050,2049,2049,2049,2049,2049,2048,2048,2047,2046,2046,2045,2044,2043,2043,2042,2043,2043,2044,2045,2045,2046,2047,2048,2048,2049,2050,2050,2050,2050,2049,2049,2049,2049,2049,2050,2051,2053,2054,2054,2055,2054,2053,2052,2051,2049,2047,2046,2044,2043,2043,2043,2043,2043,2044,2044,2045,2045,2045,2045,2045,2045,2045,2044,2043,2042,2041,2041,2040,2040,2041,2042,2043,2044,2045,2045,2046,2047,2048,2049,2050,2051,2051,2052,2052,2053,2053,2054,2054,2054,2053,2052,2051,2050,2049,2047,2046,2046,2046,2046,2046,2047,2048,2049,2050,2050,2050,2050,2050,2050,2049,2048,2048,2047,2047,2047,2048,2049,2050,2051,2051,2051,2050,2049,2047,2046,2045,2043,2042,2041,2041,2041,2042,2043,2044,2044,2045,2045,2045,2045,2044,2044,2043,2043,2044,2046,2047,2049,2052,2054,2055,2056,2056,2056,2055,2054,2052,2051,2049,2048,2047,2047,2047,2048,2049,2050,2051,2051,2052,2053,2053,2053,2054,2054,2053,2053,2054,2053,2053,2052,2050,2048,2046,2045,2044,2043,2043,2043,2044,2044,2045,2045,2045,2046,2046,2045,2044,2043,2042,2042,2041,2041,2041,2041,2042,2043,2043,2044,2045,2046,2046,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2047,2046,2045,2044,2044,2044,2044,2045,2045,2045,2045,2045,2046,2047,2048,2049,2049,2050,2050,2050,2050,2050,2050,2051,2051,2052,2053,2054,2054,2055,2055,2054,2054,2053,2053,2052,2050,2049,2048,2047,2046,2045,2044,2043,2042,2042,2043,2043,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2048,2048,2049,2050,2050,2050,2051,2051,2051,2050,2050,2049,2048,2047,2046,2045,2044,2042,2040,2038,2037,2037,2037,2037,2038,2040,2041,2043,2044,2045,2046,2046,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2045,2045,2044,2043,2043,2042,2042,2042,2042,2043,2044,2045,2046,2046,2046,2046,2046,2046,2047,2047,2048,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2048,2049,2050,2051,2052,2053,2054,2055,2056,2057,2058,2058,2058,2057,2056,2055,2053,2051,2049,2047,2045,2043,2041,2039,2037,2037,2037,2037,2037,2037,2037,2037,2037,2037,2038,2038,2039,2040,2040,2041,2041,2042,2043,2043,2043,2043,2042,2043,2044,2045,2047,2049,2050,2051,2052,2052,2053,2053,2054,2054,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2052,2052,2051,2051,2050,2050,2049,2049,2049,2049,2048,2047,2046,2045,2044,2044,2044,2043,2043,2042,2041,2040,2040,2040,2040,2040,2041,2041,2042,2043,2044,2046,2046,2047,2046,2046,2045,2043,2042,2041,2040,2040,2041,2042,2043,2045,2046,2048,2049,2050,2050,2049,2049,2049,2050,2050,2051,2051,2051,2052,2052,2052,2051,2050,2049,2049,2048,2048,2048,2047,2047,2046,2045,2045,2045,2046,2046,2046,2047,2046,2046,2045,2043,2042,2040,2040,2040,2040,2041,2041,2042,2043,2043,2044,2044,2044,2044,2044,2043,2043,2042,2042,2042,2041,2041,2040,2040,2041,2041,2042,2042,2042,2043,2044,2044,2045,2046,2047,2047,2048,2048,2048,2047,2047,2045,2044,2043,2043,2042,2041,2039,2038,2036,2035,2034,2033,2033,2033,2033,2033,2034,2035,2036,2038,2039,2041,2042,2043,2045,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2046,2045,2044,2043,2042,2042,2041,2041,2041,2041,2041,2042,2042,2043,2043,2042,2042,2041,2041,2040,2040,2040,2039,2039,2039,2039,2039,2039,2039,2039,2039,2040,2040,2040,2041,2042,2042,2043,2043,2044,2045,2045,2046,2046,2047,2048,2049,2050,2051,2052,2053,2053,2052,2051,2049,2047,2045,2043,2042,2040,2039,2038,2037,2037,2037,2039,2040,2041,2042,2043,2043,2043,2043,2043,2044,2044,2044,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2046,2046,2047,2048,2048,2049,2049,2050,2050,2049,2049,2049,2048,2048,2048,2047,2047,2046,2046,2045,2045,2045,2045,2045,2046,2046,2047,2048,2049,2049,2050,2049,2049,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2049,2050,2051,2052,2053,2054,2055,2055,2055,2055,2054,2053,2051,2050,2048,2045,2043,2041,2039,2039,2039,2039,2040,2041,2041,2042,2042,2042,2042,2042,2043,2043,2043,2043,2044,2044,2045,2046,2046,2047,2046,2046,2045,2044,2044,2045,2046,2048,2050,2051,2053,2054,2055,2056,2056,2056,2056,2056,2055,2055,2055,2054,2054,2053,2052,2051,2050,2049,2048,2047,2046,2045,2045,2045,2045,2046,2047,2048,2049,2049,2048,2047,2046,2046,2045,2046,2046,2046,2047,2047,2048,2047,2047,2046,2046,2045,2045,2044,2043,2043,2043,2043,2043,2044,2045,2046,2046,2047,2047,2047,2047,2047,2047,2047,2048,2049,2051,2052,2053,2054,2055,2056,2056,2056,2056,2055,2055,2054,2054,2053,2052,2051,2050,2048,2047,2046,2046,2045,2044,2044,2043,2042,2041,2040,2040,2040,2041,2041,2042,2043,2044,2045,2046,2046,2047,2047,2047,2048,2048,2049,2049,2049,2049,2050,2050,2050,2051,2051,2050,2050,2049,2048,2048,2047,2047,2046,2045,2044,2043,2043,2042,2042,2042,2043,2044,2044,2044,2044,2045,2046,2047,2048,2049,2051,2052,2052,2052,2052,2051,2051,2052,2052,2052,2051,2050,2049,2048,2047,2047,2046,2046,2046,2045,2045,2044,2044,2043,2043,2044,2045,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2044,2044,2044,2045,2045,2046,2047,2048,2049,2050,2050,2050,2050,2049,2048,2048,2047,2046,2045,2043,2042,2040,2039,2039,2039,2039,2040,2041,2042,2043,2044,2045,2046,2047,2049,2049,2050,2050,2050,2050,2050,2051,2052,2052,2054,2055,2055,2056,2055,2055,2054,2052,2051,2050,2048,2047,2045,2044,2044,2044,2044,2045,2046,2047,2048,2049,2049,2048,2047,2045,2043,2040,2037,2034,2032,2031,2031,2032,2034,2036,2037,2039,2040,2042,2043,2045,2047,2049,2051,2053,2054,2054,2054,2054,2053,2051,2050,2049,2048,2047,2046,2045,2043,2043,2042,2043,2043,2044,2044,2043,2043,2042,2041,2040,2039,2038,2037,2037,2037,2038,2039,2040,2042,2043,2045,2047,2048,2049,2050,2051,2051,2051,2050,2050,2049,2049,2048,2047,2047,2046,2045,2043,2042,2041,2040,2039,2039,2038,2038,2038,2038,2039,2040,2040,2041,2041,2041,2041,2040,2040,2039,2038,2037,2037,2037,2038,2040,2042,2044,2046,2047,2048,2049,2048,2048,2046,2045,2044,2043,2042,2041,2040,2039,2038,2038,2037,2037,2037,2038,2038,2039,2040,2041,2042,2043,2044,2046,2046,2047,2047,2047,2047,2046,2045,2043,2042,2041,2040,2039,2039,2039,2039,2039,2039,2039,2038,2038,2038,2038,2038,2038,2039,2040,2040,2041,2042,2042,2043,2044,2045,2046,2047,2048,2049,2050,2050,2049,2049,2048,2047,2046,2045,2044,2044,2044,2044,2043,2043,2042,2041,2040,2039,2038,2038,2038,2039,2039,2040,2041,2041,2042,2042,2042,2042,2043,2043,2044,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2045,2044,2044,2042,2041,2041,2040,2040,2039,2039,2039,2039,2039,2040,2041,2042,2043,2044,2046,2047,2049,2050,2050,2050,2049,2049,2049,2049,2050,2051,2052,2053,2053,2053,2052,2051,2050,2049,2048,2046,2045,2045,2044,2043,2041,2040,2039,2038,2037,2036,2036,2036,2035,2035,2035,2036,2038,2039,2041,2042,2044,2046,2047,2049,2050,2051,2052,2053,2053,2053,2052,2052,2052,2052,2052,2051,2051,2050,2049,2049,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2047,2047,2047,2047,2047,2046,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2046,2046,2045,2045,2045,2045,2045,2046,2046,2047,2048,2049,2050,2050,2051,2052,2052,2052,2051,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2050,2051,2051,2051,2050,2049,2048,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2050,2050,2050,2049,2049,2047,2046,2045,2043,2042,2041,2040,2040,2041,2042,2043,2044,2045,2047,2048,2049,2050,2051,2051,2051,2052,2052,2053,2053,2053,2052,2052,2052,2051,2050,2050,2049,2048,2047,2046,2045,2044,2044,2044,2043,2043,2042,2042,2041,2040,2040,2039,2039,2039,2040,2041,2043,2045,2048,2049,2051,2051,2052,2051,2051,2050,2049,2049,2048,2047,2046,2046,2046,2046,2047,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2045,2044,2044,2043,2043,2043,2043,2042,2042,2043,2043,2044,2044,2044,2044,2044,2045,2045,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2047,2048,2049,2050,2051,2052,2051,2051,2050,2049,2048,2047,2045,2044,2042,2041,2040,2040,2040,2041,2042,2043,2044,2046,2047,2048,2049,2050,2050,2050,2049,2048,2047,2047,2046,2046,2046,2045,2045,2044,2043,2042,2042,2043,2043,2043,2043,2043,2043,2044,2044,2045,2046,2046,2047,2047,2048,2048,2049,2049,2050,2050,2050,2050,2049,2048,2048,2047,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2046,2045,2045,2045,2045,2046,2047,2048,2049,2050,2050,2051,2051,2052,2052,2053,2052,2052,2050,2049,2046,2044,2042,2041,2040,2040,2040,2040,2041,2041,2042,2043,2044,2045,2045,2045,2045,2044,2044,2043,2043,2044,2045,2046,2048,2049,2050,2051,2051,2050,2050,2049,2049,2049,2048,2048,2048,2047,2047,2047,2046,2046,2046,2045,2044,2043,2043,2043,2044,2045,2047,2049,2050,2051,2052,2052,2052,2052,2052,2051,2051,2050,2049,2048,2047,2046,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2046,2046,2047,2047,2048,2049,2049,2049,2048,2048,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2046,2045,2044,2043,2042,2042,2042,2041,2041,2041,2041,2042,2042,2043,2044,2045,2046,2046,2047,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2050,2050,2049,2048,2047,2045,2044,2043,2043,2043,2043,2043,2043,2043,2042,2042,2041,2041,2041,2042,2043,2044,2045,2046,2048,2049,2051,2052,2053,2053,2053,2052,2051,2049,2048,2046,2045,2044,2043,2043,2042,2042,2042,2043,2044,2045,2046,2047,2048,2049,2049,2048,2048,2047,2046,2045,2044,2044,2044,2044,2045,2045,2045,2046,2046,2047,2048,2048,2048,2049,2049,2050,2050,2050,2050,2049,2048,2047,2046,2045,2044,2043,2043,2043,2042,2043,2043,2043,2044,2044,2045,2046,2047,2047,2047,2046,2045,2044,2043,2043,2042,2042,2042,2041,2041,2042,2042,2043,2044,2045,2046,2046,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2048,2048,2047,2046,2046,2046,2046,2047,2048,2049,2050,2050,2051,2051,2051,2051,2050,2049,2048,2046,2045,2044,2042,2041,2039,2038,2037,2037,2037,2038,2039,2041,2043,2045,2046,2047,2048,2048,2049,2050,2050,2051,2051,2050,2049,2047,2046,2044,2043,2042,2041,2041,2041,2041,2041,2042,2044,2045,2047,2049,2050,2052,2052,2053,2053,2053,2053,2052,2052,2051,2050,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2049,2048,2048,2047,2046,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2048,2048,2049,2050,2050,2051,2052,2052,2053,2053,2052,2051,2050,2049,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2049,2050,2051,2051,2052,2052,2052,2052,2052,2052,2051,2050,2050,2049,2048,2048,2047,2046,2045,2044,2044,2043,2042,2042,2042,2042,2042,2042,2044,2045,2046,2047,2047,2047,2048,2049,2049,2050,2051,2052,2053,2055,2056,2057,2058,2059,2059,2059,2058,2058,2057,2055,2054,2052,2050,2049,2048,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2045,2044,2043,2043,2042,2042,2042,2042,2041,2041,2041,2041,2043,2045,2047,2049,2051,2051,2052,2053,2053,2054,2054,2054,2054,2053,2051,2050,2048,2046,2045,2044,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2045,2045,2046,2046,2046,2046,2047,2047,2047,2048,2049,2050,2051,2052,2052,2053,2053,2053,2052,2051,2050,2050,2049,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2046,2046,2045,2045,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2042,2042,2042,2041,2041,2041,2041,2041,2040,2039,2038,2038,2039,2040,2041,2043,2046,2048,2050,2052,2053,2054,2055,2056,2056,2057,2057,2057,2057,2056,2056,2055,2054,2053,2051,2049,2047,2045,2044,2043,2042,2042,2041,2042,2042,2042,2042,2042,2042,2043,2043,2044,2044,2044,2044,2044,2044,2043,2043,2042,2041,2041,2041,2041,2041,2040,2041,2041,2041,2041,2042,2043,2043,2044,2045,2047,2048,2049,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2050,2051,2050,2050,2049,2048,2048,2047,2047,2047,2047,2046,2044,2042,2040,2038,2037,2036,2035,2035,2035,2036,2037,2038,2039,2041,2042,2044,2045,2045,2045,2045,2045,2044,2044,2043,2043,2042,2042,2042,2042,2042,2042,2043,2043,2044,2045,2046,2046,2047,2048,2049,2051,2052,2053,2055,2056,2057,2057,2056,2055,2053,2052,2050,2049,2048,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2046,2046,2045,2044,2043,2043,2042,2041,2041,2041,2042,2043,2044,2046,2047,2049,2050,2051,2051,2051,2050,2049,2048,2048,2047,2047,2047,2047,2048,2049,2050,2050,2051,2052,2052,2053,2053,2054,2054,2054,2054,2054,2054,2053,2053,2052,2051,2051,2051,2051,2050,2050,2050,2051,2051,2051,2051,2051,2051,2052,2052,2053,2053,2053,2052,2051,2050,2049,2048,2047,2047,2048,2048,2050,2051,2052,2054,2055,2056,2056,2056,2055,2054,2053,2052,2051,2050,2049,2048,2048,2047,2047,2046,2046,2046,2047,2047,2048,2049,2050,2050,2051,2051,2052,2053,2055,2056,2057,2058,2058,2058,2057,2056,2055,2054,2053,2052,2051,2050,2050,2050,2050,2051,2051,2052,2053,2054,2054,2055,2055,2055,2055,2055,2054,2054,2053,2053,2052,2051,2050,2049,2049,2049,2049,2050,2050,2051,2052,2052,2053,2054,2054,2054,2054,2053,2052,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2049,2050,2051,2052,2054,2056,2058,2060,2061,2062,2062,2061,2060,2058,2057,2056,2054,2054,2053,2053,2053,2053,2054,2054,2055,2055,2056,2057,2057,2058,2057,2057,2056,2054,2053,2051,2050,2048,2047,2045,2045,2044,2044,2045,2046,2047,2048,2049,2050,2050,2050,2049,2049,2048,2047,2047,2046,2046,2045,2044,2043,2042,2042,2042,2043,2044,2045,2046,2048,2049,2051,2052,2053,2054,2056,2057,2058,2058,2058,2058,2057,2056,2055,2053,2052,2050,2049,2047,2046,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2044,2044,2044,2045,2045,2045,2046,2046,2047,2047,2048,2049,2049,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2050,2049,2048,2046,2045,2044,2043,2042,2041,2040,2040,2039,2039,2039,2040,2041,2043,2044,2046,2047,2048,2049,2049,2049,2048,2048,2047,2047,2046,2045,2045,2044,2043,2043,2043,2043,2043,2044,2044,2045,2046,2046,2047,2048,2049,2050,2050,2051,2051,2050,2050,2049,2048,2047,2046,2044,2043,2042,2041,2040,2039,2038,2038,2038,2038,2038,2039,2039,2040,2041,2042,2044,2045,2046,2047,2047,2046,2046,2045,2045,2045,2045,2045,2046,2046,2047,2048,2048,2048,2048,2047,2046,2045,2045,2045,2045,2045,2046,2047,2047,2048,2048,2048,2049,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2046,2046,2045,2045,2044,2044,2043,2043,2043,2043,2043,2044,2045,2045,2046,2046,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2042,2042,2042,2042,2043,2044,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2045,2045,2046,2046,2047,2047,2048,2048,2048,2047,2046,2045,2044,2043,2042,2042,2043,2043,2045,2046,2048,2051,2052,2054,2055,2056,2056,2056,2056,2055,2055,2053,2052,2051,2050,2049,2049,2048,2048,2048,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2047,2047,2046,2046,2046,2047,2047,2048,2049,2050,2050,2051,2051,2051,2051,2050,2049,2049,2048,2048,2048,2048,2048,2048,2048,2047,2046,2045,2044,2044,2043,2043,2043,2043,2044,2044,2044,2045,2045,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2050,2051,2052,2053,2054,2055,2055,2055,2054,2054,2053,2052,2051,2050,2049,2048,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2048,2049,2050,2050,2051,2051,2051,2052,2052,2052,2052,2051,2051,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2046,2046,2046,2047,2048,2049,2050,2051,2052,2053,2053,2053,2052,2052,2052,2052,2053,2053,2053,2053,2053,2052,2052,2052,2051,2051,2052,2052,2052,2052,2052,2052,2051,2051,2051,2050,2050,2049,2049,2049,2048,2049,2049,2050,2050,2051,2052,2053,2053,2054,2054,2055,2054,2054,2053,2052,2051,2051,2050,2049,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2047,2047,2047,2048,2049,2049,2050,2050,2051,2051,2052,2053,2053,2054,2055,2056,2057,2059,2060,2061,2062,2062,2062,2062,2062,2062,2061,2060,2059,2058,2056,2054,2052,2050,2049,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2046,2046,2046,2045,2044,2044,2044,2045,2045,2046,2047,2049,2050,2052,2053,2053,2054,2053,2053,2053,2052,2052,2051,2051,2052,2052,2053,2054,2055,2056,2057,2057,2057,2056,2055,2054,2053,2052,2051,2051,2050,2050,2050,2050,2050,2051,2052,2052,2053,2053,2054,2054,2053,2053,2053,2052,2051,2051,2050,2049,2047,2046,2045,2045,2045,2045,2046,2047,2048,2048,2049,2049,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2049,2050,2051,2052,2052,2052,2051,2050,2048,2047,2045,2043,2042,2041,2041,2041,2042,2043,2044,2046,2047,2049,2051,2052,2053,2053,2053,2052,2051,2050,2049,2048,2047,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2051,2051,2051,2051,2050,2050,2049,2048,2047,2045,2044,2043,2042,2042,2042,2043,2043,2044,2045,2045,2045,2045,2045,2045,2045,2044,2043,2043,2043,2042,2043,2043,2043,2043,2043,2042,2042,2042,2042,2042,2042,2043,2043,2044,2045,2046,2048,2049,2050,2051,2051,2052,2052,2051,2051,2051,2051,2051,2051,2052,2052,2053,2054,2054,2054,2054,2053,2052,2051,2051,2050,2049,2048,2047,2046,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2046,2047,2048,2049,2049,2049,2049,2049,2049,2049,2048,2047,2046,2045,2044,2044,2044,2044,2045,2045,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2045,2044,2043,2043,2042,2042,2042,2042,2043,2044,2045,2047,2048,2048,2049,2049,2049,2050,2051,2052,2052,2053,2053,2053,2053,2053,2053,2052,2052,2051,2051,2050,2049,2048,2047,2047,2046,2045,2045,2044,2044,2043,2043,2042,2042,2042,2042,2042,2043,2043,2043,2044,2044,2045,2046,2047,2048,2050,2051,2052,2052,2052,2052,2052,2051,2050,2049,2049,2048,2047,2047,2046,2046,2046,2046,2046,2047,2047,2048,2049,2049,2050,2050,2050,2050,2050,2049,2049,2049,2050,2050,2050,2050,2050,2049,2049,2048,2047,2046,2045,2044,2044,2044,2044,2044,2044,2044,2044,2045,2046,2047,2048,2049,2050,2050,2050,2050,2049,2048,2048,2047,2047,2047,2046,2046,2047,2047,2047,2048,2049,2050,2051,2051,2052,2052,2052,2051,2051,2051,2051,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2046,2045,2045,2044,2045,2045,2046,2047,2049,2050,2051,2051,2050,2049,2049,2048,2048,2048,2049,2049,2050,2051,2052,2053,2054,2055,2055,2054,2054,2053,2052,2051,2050,2049,2047,2047,2046,2046,2045,2045,2045,2046,2046,2047,2048,2049,2050,2050,2051,2052,2053,2053,2054,2054,2054,2054,2053,2052,2050,2049,2048,2047,2047,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2048,2048,2049,2050,2051,2052,2052,2053,2053,2053,2053,2053,2052,2051,2051,2049,2048,2047,2046,2045,2045,2045,2046,2048,2049,2051,2052,2053,2054,2054,2054,2054,2054,2054,2053,2053,2052,2051,2050,2050,2049,2047,2046,2045,2044,2043,2042,2042,2042,2042,2043,2044,2045,2046,2047,2048,2050,2051,2051,2052,2052,2051,2050,2049,2048,2046,2045,2044,2043,2042,2042,2043,2043,2044,2045,2047,2048,2049,2050,2051,2051,2051,2051,2051,2051,2051,2050,2049,2048,2047,2046,2044,2043,2043,2042,2042,2042,2042,2042,2043,2043,2044,2045,2046,2046,2047,2047,2048,2048,2049,2050,2051,2052,2052,2053,2053,2052,2052,2051,2050,2049,2048,2047,2046,2044,2043,2042,2042,2042,2042,2043,2043,2043,2044,2044,2044,2045,2045,2045,2046,2047,2048,2049,2050,2050,2051,2052,2052,2052,2052,2052,2052,2051,2051,2050,2049,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2045,2045,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2046,2046,2047,2048,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2049,2050,2050,2051,2052,2052,2052,2053,2053,2053,2053,2052,2052,2051,2050,2049,2048,2046,2045,2044,2043,2042,2042,2042,2042,2043,2044,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2047,2046,2046,2045,2045,2045,2045,2044,2044,2045,2045,2046,2046,2047,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2051,2052,2052,2052,2052,2052,2052,2051,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2050,2050,2051,2052,2054,2055,2056,2057,2058,2057,2056,2055,2053,2051,2048,2046,2044,2043,2042,2042,2042,2042,2042,2042,2042,2043,2043,2044,2044,2045,2045,2045,2046,2046,2046,2046,2046,2047,2047,2048,2049,2050,2051,2052,2052,2053,2053,2053,2053,2052,2052,2051,2051,2051,2051,2051,2050,2050,2049,2048,2048,2048,2048,2048,2049,2049,2050,2050,2051,2051,2052,2052,2053,2053,2054,2053,2053,2052,2051,2050,2049,2048,2048,2047,2047,2047,2047,2046,2046,2045,2044,2044,2044,2044,2045,2046,2047,2049,2050,2052,2053,2055,2056,2056,2056,2056,2055,2054,2052,2051,2050,2049,2049,2048,2048,2048,2048,2047,2046,2045,2043,2042,2040,2039,2037,2036,2035,2035,2035,2035,2035,2036,2037,2037,2038,2039,2039,2040,2041,2042,2043,2044,2045,2046,2046,2047,2047,2048,2048,2049,2049,2050,2050,2051,2052,2052,2052,2052,2052,2052,2051,2051,2051,2050,2050,2049,2049,2049,2050,2051,2051,2052,2052,2052,2052,2052,2051,2050,2049,2048,2047,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2046,2047,2047,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2047,2046,2045,2044,2043,2043,2042,2042,2042,2042,2042,2043,2043,2043,2043,2043,2043,2042,2042,2042,2043,2043,2044,2044,2045,2046,2048,2049,2050,2050,2050,2051,2050,2049,2048,2046,2044,2042,2040,2039,2039,2039,2041,2042,2043,2045,2046,2047,2047,2049,2050,2050,2051,2051,2051,2051,2050,2049,2047,2046,2046,2045,2045,2044,2044,2044,2044,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2047,2047,2046,2046,2045,2044,2044,2043,2042,2042,2042,2042,2043,2045,2047,2048,2049,2049,2050,2049,2049,2048,2048,2048,2049,2049,2050,2050,2050,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2048,2048,2049,2049,2050,2051,2051,2052,2052,2052,2051,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2051,2051,2050,2048,2047,2046,2045,2044,2044,2044,2044,2044,2044,2044,2045,2045,2046,2047,2048,2049,2050,2051,2051,2052,2052,2052,2053,2053,2053,2053,2052,2051,2050,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2047,2046,2046,2046,2046,2046,2047,2048,2050,2051,2052,2053,2054,2054,2054,2054,2054,2054,2053,2052,2051,2050,2050,2049,2049,2048,2047,2047,2046,2045,2045,2044,2043,2043,2044,2044,2045,2046,2046,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2047,2046,2046,2045,2045,2044,2043,2043,2042,2042,2042,2042,2042,2043,2043,2044,2044,2044,2044,2044,2043,2042,2042,2042,2043,2044,2045,2046,2047,2048,2048,2048,2048,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2051,2051,2050,2050,2049,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2044,2043,2043,2042,2042,2042,2043,2043,2043,2044,2045,2045,2046,2047,2047,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2049,2050,2050,2050,2049,2049,2048,2047,2047,2046,2046,2046,2046,2046,2046,2047,2048,2049,2049,2049,2049,2049,2049,2048,2048,2047,2046,2045,2045,2046,2046,2047,2048,2049,2050,2051,2051,2051,2051,2051,2050,2049,2049,2048,2048,2047,2047,2047,2046,2046,2045,2044,2044,2043,2042,2041,2040,2040,2041,2042,2043,2044,2046,2047,2047,2048,2048,2049,2049,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2047,2047,2046,2046,2045,2045,2045,2046,2046,2047,2048,2048,2049,2050,2050,2050,2051,2051,2052,2052,2053,2053,2053,2053,2052,2052,2051,2050,2050,2049,2049,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2045,2045,2044,2044,2044,2044,2044,2045,2046,2046,2047,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2047,2046,2045,2044,2043,2043,2043,2043,2043,2044,2045,2047,2048,2049,2050,2051,2051,2052,2052,2052,2052,2052,2052,2052,2051,2051,2050,2049,2049,2049,2049,2049,2049,2049,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2047,2046,2045,2045,2045,2045,2045,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2046,2047,2048,2049,2049,2050,2050,2050,2051,2050,2050,2050,2049,2048,2047,2047,2046,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2046,2047,2048,2049,2050,2051,2052,2052,2052,2052,2052,2052,2052,2051,2049,2048,2047,2046,2045,2045,2045,2046,2047,2048,2049,2049,2050,2050,2051,2051,2051,2050,2050,2049,2048,2048,2047,2046,2046,2046,2046,2046,2046,2046,2045,2045,2046,2046,2047,2048,2049,2049,2049,2049,2048,2047,2047,2046,2046,2046,2047,2047,2048,2049,2050,2050,2051,2051,2050,2050,2050,2050,2049,2049,2048,2046,2045,2044,2043,2042,2042,2042,2042,2043,2043,2044,2044,2044,2043,2043,2042,2042,2042,2041,2041,2041,2041,2041,2042,2042,2043,2044,2045,2046,2047,2048,2049,2049,2050,2051,2051,2051,2051,2050,2049,2048,2047,2047,2047,2048,2048,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2048,2047,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2046,2046,2045,2045,2044,2044,2044,2043,2044,2044,2045,2045,2046,2046,2047,2047,2048,2048,2048,2048,2048,2047,2046,2046,2045,2046,2046,2047,2048,2049,2050,2051,2052,2052,2052,2051,2050,2050,2049,2049,2048,2048,2048,2047,2046,2046,2045,2045,2044,2044,2044,2044,2045,2045,2046,2046,2047,2048,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2048,2049,2050,2050,2051,2051,2052,2051,2051,2051,2051,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2047,2046,2046,2045,2045,2045,2045,2045,2046,2047,2048,2049,2049,2050,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2051,2050,2049,2049,2048,2048,2048,2048,2047,2047,2046,2045,2045,2045,2045,2045,2045,2044,2044,2045,2045,2046,2047,2048,2049,2050,2052,2053,2054,2055,2055,2056,2056,2055,2054,2054,2053,2052,2052,2051,2049,2048,2047,2046,2044,2043,2043,2043,2044,2045,2047,2048,2049,2050,2051,2051,2050,2050,2049,2049,2048,2048,2047,2046,2046,2046,2046,2046,2047,2046,2046,2046,2045,2045,2044,2045,2045,2045,2045,2046,2046,2046,2047,2047,2048,2049,2049,2049,2048,2047,2046,2046,2045,2045,2045,2045,2046,2047,2048,2050,2051,2052,2053,2053,2054,2054,2053,2053,2053,2053,2054,2054,2054,2054,2054,2053,2053,2052,2051,2049,2048,2048,2047,2046,2046,2045,2045,2044,2043,2043,2042,2042,2042,2042,2043,2043,2044,2046,2047,2048,2049,2049,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2050,2049,2047,2045,2044,2043,2042,2043,2044,2045,2046,2047,2048,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2049,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2046,2046,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2049,2049,2048,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2048,2048,2048,2049,2050,2050,2050,2049,2049,2048,2047,2046,2045,2044,2043,2042,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2044,2045,2046,2047,2048,2049,2050,2051,2052,2052,2052,2052,2052,2052,2052,2051,2051,2049,2048,2047,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2045,2045,2044,2044,2043,2044,2044,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2045,2046,2047,2048,2049,2050,2050,2050,2049,2049,2048,2047,2046,2045,2044,2043,2042,2041,2040,2040,2040,2039,2039,2040,2040,2041,2042,2044,2045,2046,2048,2049,2050,2051,2051,2052,2052,2052,2051,2051,2050,2050,2049,2048,2048,2048,2047,2047,2047,2046,2045,2044,2043,2042,2041,2040,2039,2039,2040,2040,2041,2043,2044,2044,2045,2045,2045,2045,2044,2043,2042,2042,2042,2042,2042,2042,2043,2043,2044,2044,2045,2046,2046,2047,2047,2047,2047,2047,2047,2046,2046,2047,2047,2048,2048,2048,2048,2047,2047,2046,2046,2046,2045,2045,2044,2044,2044,2043,2043,2043,2042,2042,2043,2043,2044,2045,2047,2047,2048,2048,2048,2047,2046,2045,2044,2043,2043,2042,2042,2042,2043,2043,2044,2044,2045,2045,2045,2045,2045,2045,2046,2046,2047,2047,2048,2047,2047,2046,2046,2045,2044,2044,2043,2043,2044,2044,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2045,2045,2046,2047,2048,2048,2049,2049,2050,2049,2049,2048,2048,2047,2046,2045,2045,2044,2043,2043,2042,2042,2042,2043,2043,2044,2045,2046,2047,2048,2048,2048,2047,2047,2046,2045,2045,2045,2045,2045,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2046,2047,2047,2048,2048,2047,2047,2047,2048,2048,2049,2050,2051,2052,2052,2052,2051,2050,2049,2048,2046,2045,2045,2044,2044,2044,2044,2044,2043,2044,2044,2045,2046,2047,2048,2048,2049,2050,2051,2052,2052,2051,2051,2050,2048,2047,2046,2045,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2046,2047,2047,2048,2048,2048,2048,2047,2047,2046,2046,2047,2047,2047,2048,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2044,2045,2045,2045,2046,2046,2047,2048,2048,2048,2049,2049,2050,2050,2051,2051,2052,2052,2051,2051,2051,2050,2050,2049,2048,2048,2047,2047,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2046,2046,2045,2044,2044,2044,2044,2044,2044,2045,2046,2046,2048,2049,2050,2051,2051,2052,2052,2051,2051,2050,2049,2049,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2049,2050,2051,2052,2053,2054,2054,2054,2054,2053,2052,2051,2050,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2047,2047,2047,2047,2048,2047,2047,2047,2047,2047,2046,2046,2047,2047,2048,2049,2050,2051,2052,2053,2053,2053,2053,2053,2052,2051,2051,2051,2050,2050,2050,2050,2051,2051,2050,2050,2049,2048,2046,2045,2045,2044,2044,2044,2045,2045,2046,2046,2047,2048,2048,2049,2049,2050,2051,2052,2053,2054,2055,2056,2057,2057,2057,2056,2055,2053,2052,2050,2049,2048,2047,2046,2045,2044,2044,2044,2044,2045,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2048,2049,2050,2051,2052,2053,2053,2053,2054,2054,2054,2054,2053,2053,2052,2051,2050,2048,2047,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2049,2049,2049,2048,2047,2045,2044,2043,2042,2042,2041,2041,2041,2041,2042,2042,2043,2043,2043,2043,2043,2042,2042,2042,2042,2043,2044,2045,2046,2048,2049,2050,2051,2052,2053,2054,2055,2055,2055,2054,2053,2052,2051,2050,2049,2049,2048,2047,2047,2046,2045,2045,2044,2043,2043,2042,2042,2042,2042,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2045,2046,2047,2048,2049,2049,2049,2049,2048,2047,2046,2046,2045,2044,2044,2044,2044,2045,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2047,2047,2048,2048,2048,2048,2048,2047,2046,2046,2045,2044,2044,2044,2044,2044,2045,2045,2045,2046,2046,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2047,2047,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2047,2046,2046,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2045,2046,2046,2047,2048,2048,2048,2048,2049,2049,2049,2050,2050,2050,2050,2049,2049,2048,2048,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2047,2047,2047,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2046,2047,2048,2049,2050,2050,2051,2051,2051,2051,2051,2052,2052,2052,2053,2053,2054,2055,2056,2056,2056,2056,2055,2055,2054,2053,2052,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2048,2047,2046,2046,2045,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2048,2049,2050,2051,2052,2053,2054,2054,2055,2054,2054,2054,2054,2053,2053,2053,2053,2053,2053,2052,2052,2051,2050,2050,2049,2049,2049,2050,2050,2051,2051,2051,2052,2052,2051,2051,2051,2051,2050,2050,2050,2050,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2046,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2049,2048,2047,2047,2046,2045,2045,2044,2044,2044,2045,2045,2046,2046,2047,2048,2049,2050,2051,2052,2052,2052,2052,2052,2051,2050,2049,2047,2047,2046,2045,2045,2045,2046,2047,2048,2049,2050,2051,2051,2052,2052,2052,2051,2051,2051,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2050,2049,2049,2048,2047,2046,2046,2045,2044,2044,2044,2044,2044,2044,2044,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2044,2043,2043,2042,2043,2043,2043,2044,2045,2046,2046,2047,2048,2048,2049,2049,2050,2051,2051,2052,2052,2052,2053,2053,2052,2052,2051,2051,2050,2049,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2045,2046,2047,2048,2049,2049,2050,2050,2050,2050,2050,2049,2048,2047,2047,2046,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2047,2047,2048,2049,2051,2052,2052,2052,2052,2052,2051,2051,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2050,2050,2049,2048,2048,2047,2047,2046,2046,2045,2045,2044,2044,2043,2043,2042,2042,2042,2043,2043,2043,2043,2043,2043,2044,2044,2045,2045,2046,2046,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2050,2050,2051,2051,2051,2051,2051,2051,2050,2050,2049,2048,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2048,2048,2049,2050,2050,2050,2050,2050,2049,2049,2048,2048,2047,2047,2046,2046,2046,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2046,2047,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2047,2047,2047,2048,2048,2048,2049,2049,2049,2048,2048,2047,2046,2045,2043,2042,2040,2039,2039,2038,2038,2039,2040,2041,2042,2043,2044,2045,2047,2048,2049,2050,2051,2052,2052,2053,2053,2054,2053,2053,2053,2052,2051,2051,2050,2050,2050,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2048,2049,2049,2050,2050,2051,2051,2051,2051,2051,2051,2050,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2051,2051,2052,2052,2051,2050,2049,2048,2047,2046,2045,2044,2044,2044,2044,2044,2044,2044,2045,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2050,2050,2049,2049,2049,2049,2049,2049,2050,2050,2050,2049,2049,2049,2049,2049,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2047,2047,2046,2046,2046,2046,2047,2048,2049,2050,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2050,2049,2048,2047,2045,2044,2043,2043,2043,2043,2044,2045,2046,2046,2047,2048,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2050,2050,2051,2051,2051,2052,2052,2052,2052,2052,2052,2051,2051,2050,2049,2049,2048,2048,2047,2046,2046,2046,2045,2045,2046,2046,2046,2047,2048,2048,2049,2049,2049,2050,2050,2051,2051,2051,2052,2052,2052,2052,2051,2051,2051,2050,2050,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2045,2045,2046,2046,2046,2046,2047,2047,2048,2048,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2051,2051,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2049,2049,2050,2051,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2050,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2050,2051,2051,2051,2050,2050,2049,2049,2048,2047,2047,2046,2045,2045,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2045,2045,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2045,2046,2046,2047,2048,2048,2049,2049,2049,2049,2048,2048,2047,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2047,2047,2046,2045,2045,2044,2044,2044,2044,2045,2046,2047,2048,2050,2051,2052,2053,2054,2054,2054,2054,2054,2053,2052,2051,2050,2049,2049,2048,2048,2047,2047,2046,2045,2045,2044,2044,2043,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2045,2046,2047,2047,2048,2048,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2047,2047,2046,2046,2045,2045,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2044,2045,2045,2045,2046,2046,2046,2046,2046,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2050,2050,2049,2048,2047,2046,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2043,2043,2042,2042,2041,2042,2042,2042,2043,2044,2045,2045,2046,2046,2046,2046,2046,2046,2046,2047,2047,2048,2049,2049,2050,2050,2050,2050,2050,2049,2048,2048,2047,2046,2045,2045,2044,2044,2044,2044,2044,2045,2046,2046,2047,2048,2048,2049,2049,2050,2050,2050,2050,2049,2049,2048,2048,2047,2047,2046,2046,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2047,2048,2049,2049,2050,2050,2051,2051,2051,2050,2050,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2049,2049,2050,2050,2050,2050,2050,2049,2048,2047,2046,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2048,2048,2049,2050,2051,2051,2052,2052,2052,2052,2052,2051,2051,2051,2051,2052,2052,2052,2052,2052,2051,2051,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2051,2050,2050,2049,2048,2047,2047,2046,2046,2046,2046,2046,2047,2047,2048,2049,2050,2050,2050,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2049,2049,2049,2050,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2051,2050,2049,2048,2047,2047,2046,2046,2046,2046,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2048,2048,2049,2049,2049,2050,2050,2051,2051,2051,2051,2051,2051,2050,2050,2049,2048,2048,2047,2047,2046,2046,2045,2045,2044,2044,2043,2043,2042,2042,2043,2043,2043,2043,2043,2044,2044,2045,2046,2047,2047,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2045,2045,2044,2044,2044,2043,2043,2044,2044,2044,2045,2045,2046,2046,2047,2047,2047,2047,2047,2047,2046,2046,2045,2045,2045,2044,2044,2044,2044,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2047,2046,2046,2045,2044,2044,2043,2043,2042,2043,2043,2044,2045,2046,2047,2048,2048,2049,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2047,2047,2046,2046,2046,2045,2045,2044,2044,2045,2045,2046,2047,2047,2048,2049,2049,2049,2050,2050,2050,2050,2050,2049,2048,2047,2046,2046,2045,2045,2045,2045,2045,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2046,2046,2047,2047,2048,2048,2048,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2049,2049,2050,2050,2051,2051,2051,2051,2051,2050,2049,2049,2048,2047,2047,2046,2046,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2046,2046,2045,2045,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2047,2047,2048,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2046,2046,2046,2047,2047,2048,2049,2049,2049,2049,2048,2048,2047,2046,2045,2045,2044,2044,2043,2043,2042,2042,2042,2042,2042,2043,2043,2043,2044,2044,2045,2045,2045,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2050,2050,2050,2049,2049,2049,2049,2048,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2045,2045,2045,2046,2046,2046,2046,2046,2046,2047,2047,2048,2049,2049,2050,2050,2051,2050,2050,2050,2049,2048,2048,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2044,2044,2044,2045,2045,2046,2047,2047,2048,2049,2049,2050,2050,2050,2051,2051,2051,2051,2050,2050,2049,2048,2048,2047,2046,2045,2045,2044,2044,2045,2045,2045,2046,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2047,2047,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2047,2048,2048,2049,2049,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2046,2045,2045,2045,2044,2044,2043,2043,2043,2043,2043,2043,2044,2044,2045,2045,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2045,2045,2045,2044,2044,2043,2043,2043,2043,2043,2043,2043,2044,2044,2045,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2046,2047,2048,2048,2049,2049,2049,2049,2049,2048,2048,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2046,2047,2048,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2044,2045,2045,2045,2046,2046,2047,2047,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2044,2045,2045,2045,2045,2046,2046,2046,2047,2047,2048,2049,2049,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2044,2044,2044,2043,2043,2043,2043,2044,2044,2045,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2045,2045,2045,2044,2044,2044,2044,2044,2044,2045,2045,2045,2046,2046,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2046,2046,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2046,2046,2046,2047,2047,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2046,2046,2047,2047,2048,2048,2049,2049,2050,2050,2050,2051,2051,2051,2050,2050,2050,2049,2049,2048,2048,2048,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2048,2049,2049,2050,2051,2051,2051,2051,2051,2051,2050,2050,2050,2049,2048,2048,2047,2046,2046,2046,2046,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2050,2051,2051,2051,2051,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2046,2046,2046,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2047,2047,2046,2046,2045,2045,2045,2045,2046,2046,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2047,2046,2045,2045,2044,2044,2043,2043,2044,2044,2045,2046,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2046,2045,2045,2044,2044,2043,2043,2042,2042,2042,2042,2042,2042,2043,2043,2044,2044,2045,2045,2046,2047,2048,2049,2050,2050,2051,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2050,2050,2050,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2049,2049,2049,2050,2050,2050,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2050,2050,2050,2050,2051,2051,2051,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2051,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2047,2048,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2047,2047,2048,2048,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2047,2047,2046,2046,2046,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2046,2046,2045,2046,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2045,2045,2045,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2045,2045,2046,2046,2046,2046,2045,2045,2045,2046,2045,2045,2045,2045,2045,2046,2045,2045,2045,2045,2046,2046,2046,2046,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2048,2048,2048,2048,2047,2048,2047,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2047,2048,2048,2047,2047,2047,2047,2048,2047,2047,2047,2048,2048,2048,2048,2048,2047,2048,2047,2047,2047,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2047,2048,2048,2048,2047,2048,2048,2047,2047,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2047,2048,2048,2048,2048,2048,2047,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2047,2046,2046,2047,2048,2049,2049,2048,2048,2048,2048,2047,2047,2047,2049,2049,2047,2045,2045,2047,2050,2052,2052,2050,2048,2047,2048,2048,2048,2048,2048,2048,2049,2051,2051,2051,2049,2047,2045,2045,2048,2051,2053,2052,2050,2048,2048,2049,2050,2051,2051,2051,2050,2049,2048,2049,2050,2049,2046,2043,2044,2047,2048,2046,2043,2041,2044,2047,2049,2049,2049,2051,2053,2051,2050,2050,2053,2055,2055,2053,2053,2055,2054,2050,2046,2044,2046,2049,2048,2044,2041,2042,2046,2047,2046,2045,2045,2047,2048,2048,2048,2048,2048,2047,2047,2049,2053,2057,2057,2052,2047,2044,2044,2046,2048,2050,2051,2051,2050,2048,2047,2047,2047,2046,2044,2043,2046,2052,2060,2063,2059,2052,2048,2050,2055,2058,2054,2048,2047,2052,2056,2056,2054,2054,2057,2057,2054,2050,2047,2046,2046,2045,2044,2046,2048,2047,2045,2044,2047,2049,2048,2044,2042,2045,2051,2054,2052,2050,2050,2051,2051,2050,2046,2041,2042,2044,2043,2042,2044,2047,2050,2052,2054,2052,2050,2049,2047,2045,2046,2051,2057,2059,2057,2052,2049,2051,2057,2056,2051,2049,2051,2048,2044,2049,2051,2043,2036,2041,2048,2047,2046,2052,2055,2053,2050,2046,2041,2043,2048,2044,2040,2049,2059,2052,2043,2045,2048,2051,2055,2048,2033,2037,2056,2057,2043,2039,2046,2047,2044,2047,2048,2046,2047,2049,2051,2052,2051,2046,2044,2048,2049,2046,2048,2050,2043,2040,2047,2053,2053,2055,2054,2050,2054,2059,2056,2054,2058,2052,2039,2041,2052,2057,2054,2047,2038,2037,2040,2039,2038,2047,2058,2060,2055,2049,2045,2046,2053,2059,2062,2060,2057,2056,2059,2057,2049,2047,2046,2039,2066,2183,2354,2463,2457,2379,2275,2182,2136,2122,2080,2012,1966,1943,1933,1956,1995,1979,1892,1783,1703,1693,1771,1882,1940,1937,1924,1929,1953,1999,2047,2056,2030,2019,2032,2034,2030,2064,2138,2205,2243,2255,2251,2250,2257,2248,2214,2171,2127,2092,2082,2087,2075,2041,1987,1913,1834,1777,1757,1783,1843,1894,1907,1899,1909,1955,2014,2041,2029,2010,2009,2032,2073,2112,2116,2095,2071,2030,1973,1938,1937,1935,1913,1879,1861,1886,1942,1983,1988,1984,1999,2024,2037,2054,2093,2127,2135,2144,2170,2196,2222,2251,2261,2241,2222,2219,2205,2182,2171,2155,2132,2121,2117,2109,2094,2059,2014,1995,1991,1980,1981,2002,2022,2029,2021,1998,1975,1973,1991,2009,2021,2033,2041,2055,2093,2134,2142,2133,2141,2157,2159,2146,2134,2137,2149,2160,2162,2150,2145,2152,2130,2081,2052,2046,2036,2029,2029,2032,2050,2077,2086,2080,2064,2036,2024,2041,2052,2038,2018,1996,1977,1978,1992,1988,1966,1950,1948,1948,1947,1954,1955,1945,1943,1946,1942,1943,1955,1959,1951,1943,1953,1981,2003,2024,2049,2062,2072,2096,2096,2068,2053,2050,2053,2070,2074,2052,2029,2018,2022,2046,2067,2067,2054,2037,2029,2021,2014,2026,2036,2012,1982,1978,1989,2009,2034,2045,2034,2014,2017,2048,2080,2097,2098,2086,2085,2098,2094,2081,2079,2072,2060,2057,2053,2046,2059,2077,2075,2065,2069,2078,2075,2074,2090,2110,2125,2129,2123,2120,2128,2148,2174,2179,2151,2132,2132,2128,2132,2148,2143,2120,2107,2101,2094,2098,2108,2104,2075,2039,2020,2023,2039,2050,2050,2040,2015,1987,1996,2033,2044,2030,2022,2014,2009,2022,2040,2048,2053,2061,2071,2078,2071,2057,2058,2067,2061,2041,2019,2001,2001,2011,2005,1985,1974,1970,1971,1974,1976,1977,1982,1987,1989,1990,1998,2013,2023,2022,2022,2021,2025,2036,2029,2007,1999,2003,2004,2002,1992,1988,1994,1989,1976,1976,1979,1983,1991,1992,1991,1994,1998,2011,2028,2031,2031,2035,2036,2042,2057,2068,2076,2082,2084,2092,2098,2102,2110,2112,2107,2111,2114,2108,2106,2107,2112,2121,2114,2096,2094,2099,2099,2100,2097,2089,2090,2095,2096,2098,2101,2104,2107,2104,2101,2104,2108,2110,2107,2095,2088,2093,2097,2094,2092,2085,2075,2070,2063,2051,2052,2058,2054,2050,2045,2036,2042,2057,2058,2053,2045,2034,2038,2056,2061,2058,2055,2049,2049,2049,2042,2042,2046,2039,2035,2032,2015,2005,2009,2001,1995,2000,1989,1978,1987,1994,1999,2013,2006,1985,1979,1977,1977,1984,1983,1992,2014,2009,1991,1988,1973,1971,2004,1997,1961,1974,1990,1984,2026,2062,2040,2037,2044,2017,2026,2069,2067,2052,2049,2039,2060,2081,2052,2031,2027,2013,2049,2089,2047,2042,2103,2095,2088,2136,2090,2011,2046,2073,2058,2118,2134,2028,1969,1996,2022,2072,2121,2104,2070,2063,2081,2105,2079,2038,2039,1997,1934,1981,2041,2032,2091,2157,2099,2078,2141,2098,2026,2071,2095,2054,2085,2147,2140,2134,2163,2130,2057,2081,2176,2181,2123,2114,2078,2000,2026,2084,2031,2018,2099,2091,2033,2068,2078,1997,1964,1998,2014,2035,2095,2109,2034,2013,2107,2133,2060,2088,2148,2091,2098,2160,2052,1977,2107,2137,2055,2132,2204,2129,2118,2126,1999,1919,1962,1974,1956,1978,2012,2004,1944,1953,2091,2161,2132,2117,1965,1774,1920,2135,2040,1966,1996,1840,1779,1976,1995,1906,2034,2067,1909,1937,2026,1926,1854,1860,1821,1852,1953,1977,1937,1899,1972,2153,2145,1989,2036,2114,2085,2240,2316,2032,1936,2067,1914,1866,2185,2238,2079,2185,2193,2041,2213,2372,2181,2151,2293,2214,2133,2137,2081,2187,2380,2387,2344,2227,2004,2019,2140,2061,2075,2188,2125,2182,2359,2239,2146,2287,2158,1952,2074,2079,1942,2053,2049,1909,2098,2188,1952,1984,2149,2115,2187,2260,2243,2447,2531,2338,2373,2398,2154,2193,2342,2101,2118,2752,3268,3438,3235,2255,1255,1058,841,388,414,510,396,495,546,324,142,140,313,422,246,60,93,151,114,141,118,0,37,194,22,112,347,222,571,1573,2451,3135,3239,2407,1470,1050,923,821,750,711,557,435,416,356,396,360,200,345,395,172,191,206,504,1637,2691,3140,3220,2613,1595,984,812,647,477,517,438,217,340,350,87,174,223,133,313,185,84,973,2159,2875,3249,3164,2505,1684,1243,1070,771,530,452,434,476,323,358,1213,2223,2739,3027,3211,3360,3540,3588,3394,2717,1591,1014,1771,2965,3084,2154,1299,904,648,448,450,482,341,554,1473,2429,2975,3349,3581,3591,3690,3944,3888,3781,3944,3324,1975,1403,1323,1095,1466,2426,3139,3051,2114,1110,1042,2048,2536,1423,618,819,444,195,623,346,6,772,1883,2610,3066,3404,3378,3375,3747,3333,2877,3806,3652,1889,1779,2980,3273,3273,3785,3847,3008,2801,3445,3455,3539,3805,2776,1607,1177,808,745,465,100,395,242,25,458,337,175,335,0,0,872,2372,3347,3298,3367,3056,1712,1807,3019,2831,1973,1253,745,817,779,484,224,352,1267,1716,1542,1733,1476,962,837,878,1899,2991,3056,3405,3355,2184,1448,1354,1637,1906,1536,1174,664,516,1909,2865,2808,3319,3491,3382,3717,3259,2357,1824,1220,670,416,1106,2441,2674,2439,2864,2740,1620,733,1298,2459,2108,1062,1018,1495,2224,2958,3325,3722,3814,3721,4042,4096,3896,3878,3917,4096,3983,2752,1918,1428,772,850,1489,1731,1466,1373,2150,3007,3150,3353,3747,3869,3904,3773,3692,4068,3913,2698,1719,1282,645,399,666,448,284,747,1018,844,267,0,1059,2047,1358,561,443,283,253,335,348,429,294,71,143,174,45,205,519,394,266,824,1188,755,362,272,727,2106,2952,2261,1376,1086,846,517,379,419,407,435,450,75,0,109,255,251,396,297,160,82,0,517,1307,1049,548,533,449,353,365,272,197,297,568,521,124,364,865,609,382,652,713,450,87,0,217,351,543,751,495,374,480,322,508,709,426,956,1949,1734,1016,756,630,638,733,796,829,551,395,719,734,588,995,1170,708,495,627,658,595,368,187,421,606,464,383,378,535,775,470,190,489,393,355,1311,1732,1030,617,666,778,899,833,718,491,539,1567,2119,1281,892,1159,851,485,414,384,589,677,545,658,831,819,637,401,419,446,320,487,753,718,551,450,569,681,544,529,516,320,442,650,632,757,719,419,512,837,880,579,340,814,1386,1047,510,673,1427,2260,2293,1581,1189,1156,1006,848,767,709,534,307,393,494,262,199,410,441,290,319,609,661,474,722,954,590,419,624,688,743,681,532,658,556,242,446,646,466,553,693,527,572,713,446,343,902,1279,1010,913,1086,921,686,586,509,779,976,684,796,1378,1673,1866,1822,1467,1586,1650,1152,1386,2226,2345,2150,1999,1635,1788,2514,2798,2448,1914,1738,1950,1660,951,830,1063,1083,1017,784,510,561,669,633,667,698,635,720,932,842,634,917,1141,677,372,651,902,945,831,962,1603,1791,1492,1602,1440,1125,1808,2311,1943,2073,2411,2394,2886,3399,3107,2772,2796,2715,2412,2312,2623,2593,1924,1476,1329,1169,1410,1705,1393,1032,1120,1321,1374,1374,1488,1565,1339,1017,905,908,756,467,405,525,475,462,514,331,392,816,783,467,606,881,906,832,700,656,821,894,767,683,669,622,651,901,1128,1061,1139,1562,1510,997,1084,1562,1730,1921,2047,1858,1979,2248,2086,2042,2322,2495,2603,2569,2422,2495,2511,2470,2686,2691,2536,2662,2456,1923,1923,2181,2199,2111,1896,1852,2198,2196,1638,1356,1523,1567,1380,1156,965,1086,1502,1512,1163,1286,1679,1726,1730,1806,1555,1202,1290,1691,1723,1170,767,1035,1435,1445,1344,1382,1412,1503,1736,1848,1843,1805,1557,1429,1647,1693,1597,1676,1749,1896,1909,1522,1545,1867,1506,1169,1409,1521,1644,1815,1503,1207,1300,1369,1330,1197,1053,1062,1074,1111,1172,1124,1230,1368,1206,1111,1144,1073,1123,1199,1073,922,913,1133,1277,1124,1279,1718,1790,1755,1725,1354,1110,1331,1595,1657,1588,1543,1529,1509,1706,1882,1634,1495,1846,2160,2128,1973,1996,2172,2139,1990,2031,2046,1973,2042,2106,2086,2195,2263,2076,1997,2185,2186,1986,1887,1726,1607,1759,1819,1841,2067,1999,1672,1696,1936,2091,2128,1947,1738,1764,1985,2166,2054,1918,2057,2106,2042,2213,2412,2468,2427,2287,2323,2498,2479,2408,2283,2015,2080,2439,2446,2137,1979,2079,2239,2249,2122,1920,1706,1665,1671,1514,1477,1590,1469,1285,1318,1306,1189,1192,1278,1428,1652,1732,1675,1717,1781,1694,1576,1577,1678,1798,1858,1808,1714,1731,1825,1853,1893,2068,2218,2109,1841,1778,1933,2024,2084,2126,1992,1944,2140,2276,2340,2442,2504,2530,2453,2335,2326,2301,2407,2661,2572,2417,2555,2501,2472,2764,2725,2479,2544,2631,2674,2665,2522,2625,2748,2566,2652,2876,2736,2668,2766,2723,2755,2817,2738,2750,2875,2984,3045,2933,2719,2588,2513,2512,2605,2640,2588,2547,2506,2517,2663,2792,2797,2795,2737,2546,2424,2483,2572,2547,2477,2542,2573,2398,2435,2733,2721,2434,2296,2342,2466,2508,2430,2420,2430,2365,2298,2244,2319,2457,2400,2350,2454,2465,2442,2521,2573,2560,2494,2483,2584,2540,2370,2382,2542,2681,2680,2533,2510,2621,2600,2535,2610,2735,2755,2671,2634,2608,2494,2488,2555,2444,2362,2448,2440,2358,2401,2491,2491,2406,2345,2380,2454,2492,2473,2424,2360,2282,2265,2361,2493,2531,2433,2379,2501,2610,2627,2612,2483,2346,2331,2329,2407,2545,2503,2438,2515,2544,2529,2571,2641,2725,2678,2474,2366,2472,2673,2688,2418,2261,2314,2290,2355,2506,2346,2185,2369,2435,2272,2291,2429,2488,2560,2599,2513,2456,2530,2599,2583,2608,2761,2897,2874,2750,2652,2679,2788,2840,2907,3022,2940,2774,2839,2860,2670,2631,2679,2561,2542,2717,2751,2568,2382,2299,2273,2312,2435,2496,2429,2362,2315,2275,2262,2188,2166,2353,2454,2272,2104,2124,2145,2047,1994,2130,2253,2228,2218,2180,2096,2189,2315,2295,2351,2426,2345,2268,2200,2163,2352,2555,2591,2642,2617,2469,2416,2431,2460,2502,2492,2576,2637,2455,2450,2630,2445,2230,2356,2405,2356,2426,2502,2605,2637,2511,2510,2569,2499,2520,2541,2351,2232,2337,2435,2346,2177,2237,2428,2350,2172,2255,2434,2479,2458,2506,2598,2572,2468,2486,2586,2649,2660,2572,2508,2632,2729,2663,2636,2645,2640,2740,2762,2638,2694,2784,2635,2556,2605,2573,2651,2818,2790,2701,2694,2652,2584,2555,2523,2454,2428,2501,2535,2507,2533,2518,2480,2579,2645,2618,2681,2744,2744,2794,2814,2800,2832,2765,2596,2563,2667,2758,2858,2888,2713,2669,2994,3207,3094,2994,2927,2902,3025,3036,2970,3116,3209,3049,2874,2822,2928,3050,3021,3008,3022,2870,2752,2844,2958,3000,2992,2914,2821,2773,2727,2674,2682,2706,2655,2589,2530,2488,2545,2566,2503,2583,2682,2618,2597,2581,2490,2570,2684,2555,2441,2506,2540,2540,2642,2749,2737,2682,2656,2651,2664,2630,2565,2603,2683,2746,2788,2684,2567,2620,2628,2596,2719,2765,2635,2553,2562,2589,2547,2471,2563,2703,2616,2453,2433,2472,2487,2573,2683,2557,2307,2297,2434,2507,2536,2511,2495,2502,2434,2407,2421,2396,2525,2688,2599,2453,2445,2571,2721,2682,2650,2764,2701,2579,2637,2673,2774,3005,3079,3030,2942,2785,2706,2672,2685,2887,2979,2787,2681,2806,2951,2966,2909,2920,2913,2809,2748,2762,2875,3109,3219,3163,3123,3018,2908,2949,2882,2657,2630,2750,2804,2863,2836,2712,2758,2847,2786,2788,2768,2672,2844,3043,2956,2964,3064,3074,3264,3441,3393,3456,3518,3366,3260,3221,3204,3256,3176,3011,2946,2867,2805,2828,2822,2827,2861,2851,2813,2730,2655,2669,2693,2745,2837,2842,2865,2977,2961,2836,2810,2782,2614,2503,2564,2522,2283,2185,2358,2523,2475,2273,2092,2029,2036,2054,2097,2159,2128,1999,1946,1955,2005,2291,2526,2304,2100,2269,2394,2348,2262,2152,2213,2355,2268,2202,2322,2340,2322,2423,2376,2168,2060,1968,1865,2013,2287,2398,2514,2712,2768,2695,2590,2509,2609,2840,2945,2798,2550,2554,2749,2689,2517,2586,2714,2781,2872,2897,2908,2975,2910,2690,2545,2588,2712,2768,2749,2762,2900,3046,2941,2729,2766,2895,2839,2665,2492,2431,2444,2347,2246,2243,2200,2169,2191,2193,2221,2185,2028,1954,1954,1927,1866,1663,1502,1656,1840,1864,1940,2031,2044,2090,2117,2048,2030,2158,2283,2272,2211,2197,2214,2301,2425,2491,2556,2608,2583,2639,2737,2673,2708,3017,3179,3044,2935,2944,2984,3054,3103,3123,3176,3229,3275,3355,3379,3319,3301,3333,3329,3297,3228,3109,3065,3140,3200,3204,3188,3104,3007,2989,2958,2859,2797,2811,2847,2852,2820,2830,2865,2807,2699,2705,2839,2943,2899,2789,2724,2717,2785,2862,2800,2654,2597,2632,2598,2453,2445,2649,2712,2540,2407,2389,2497,2723,2838,2810,2782,2720,2685,2747,2769,2768,2795,2744,2687,2757,2880,2934,2894,2869,2903,2886,2894,2981,2956,2899,2957,2935,2877,2925,2863,2758,2870,3009,3068,3172,3214,3182,3209,3225,3214,3246,3255,3209,3145,3119,3196,3258,3198,3143,3097,3031,3063,3042,2817,2705,2808,2813,2733,2765,2827,2826,2817,2822,2811,2760,2696,2652,2593,2546,2565,2585,2591,2636,2643,2582,2560,2553,2471,2403,2439,2481,2474,2477,2431,2313,2300,2342,2257,2213,2307,2344,2387,2485,2402,2237,2260,2339,2346,2356,2348,2302,2275,2334,2485,2543,2410,2319,2431,2611,2703,2677,2588,2531,2580,2708,2791,2808,2807,2754,2743,2867,2936,2877,2839,2814,2781,2785,2779,2780,2785,2701,2630,2653,2662,2626,2545,2436,2406,2433,2475,2558,2525,2364,2367,2495,2453,2301,2255,2252,2170,2145,2284,2364,2265,2157,2100,2100,2180,2210,2185,2210,2170,2095,2153,2198,2178,2273,2367,2326,2305,2336,2309,2248,2212,2201,2202,2263,2397,2461,2416,2407,2423,2385,2390,2460,2468,2405,2370,2409,2509,2601,2626,2604,2566,2518,2504,2576,2672,2713,2709,2689,2680,2691,2712,2768,2799,2740,2704,2693,2624,2679,2849,2831,2719,2735,2771,2797,2843,2813,2748,2741,2779,2798,2716,2643,2706,2773,2780,2769,2665,2568,2587,2589,2564,2556,2477,2393,2414,2468,2461,2413,2438,2507,2484,2478,2539,2475,2378,2431,2497,2500,2502,2502,2511,2501,2460,2435,2389,2356,2414,2469,2511,2571,2541,2492,2509,2454,2382,2422,2466,2495,2568,2561,2428,2329,2386,2503,2531,2538,2579,2545,2525,2632,2683,2611,2570,2572,2587,2591,2514,2463,2551,2635,2614,2579,2588,2619,2620,2584,2584,2596,2549,2502,2495,2477,2478,2538,2572,2497,2407,2462,2564,2506,2375,2368,2442,2476,2451,2436,2492,2512,2409,2314,2300,2336,2436,2509,2474,2451,2496,2516,2482,2434,2437,2502,2522,2489,2506,2525,2475,2429,2404,2401,2477,2543,2500,2461,2487,2515,2550,2590,2620,2634,2554,2434,2468,2575,2523,2377,2350,2449,2514,2480,2440,2440,2461,2505,2499,2407,2353,2371,2375,2385,2438,2496,2500,2429,2354,2343,2354,2357,2358,2349,2355,2386,2383,2356,2383,2419,2379,2320,2311,2350,2446,2500,2422,2360,2381,2396,2454,2514,2454,2412,2481,2522,2506,2489,2515,2612,2673,2620,2523,2450,2480,2568,2543,2470,2504,2564,2580,2605,2649,2648,2587,2561,2578,2515,2437,2501,2624,2651,2595,2543,2527,2541,2584,2584,2496,2438,2448,2443,2463,2506,2478,2449,2460,2422,2372,2402,2505,2591,2564,2469,2385,2321,2342,2459,2541,2511,2383,2258,2310,2481,2519,2426,2422,2530,2561,2463,2375,2363,2381,2364,2288,2279,2443,2599,2568,2447,2354,2262,2174,2191,2310,2388,2402,2439,2459,2441,2488,2570,2547,2454,2424,2433,2396,2381,2459,2529,2551,2623,2717,2698,2575,2470,2431,2399,2337,2346,2481,2603,2631,2682,2747,2671,2479,2306,2245,2407,2699,2806,2688,2569,2542,2545,2517,2498,2566,2615,2506,2346,2280,2282,2306,2383,2518,2587,2525,2458,2458,2479,2511,2509,2415,2286,2182,2145,2205,2273,2298,2360,2421,2389,2343,2328,2250,2154,2170,2235,2239,2225,2205,2153,2159,2280,2392,2401,2393,2405,2316,2184,2193,2244,2207,2196,2233,2250,2303,2395,2480,2551,2550,2476,2412,2362,2311,2277,2286,2379,2493,2548,2604,2647,2563,2400,2305,2311,2358,2386,2383,2358,2331,2345,2394,2436,2468,2475,2419,2350,2364,2420,2402,2324,2270,2266,2294,2305,2288,2308,2368,2453,2589,2680,2616,2445,2283,2216,2182,2105,2083,2104,2102,2195,2320,2321,2358,2485,2552,2571,2521,2419,2433,2497,2469,2422,2404,2404,2398,2345,2307,2290,2254,2274,2328,2351,2396,2434,2451,2504,2522,2464,2369,2241,2190,2277,2402,2519,2537,2413,2314,2238,2089,2047,2175,2258,2260,2259,2208,2116,2081,2093,2073,2041,2037,2055,2114,2213,2284,2295,2298,2353,2413,2403,2416,2502,2451,2216,2034,1985,2000,2077,2154,2166,2193,2271,2323,2347,2426,2540,2597,2591,2561,2510,2472,2449,2375,2308,2342,2378,2342,2343,2413,2484,2544,2601,2664,2711,2645,2482,2381,2384,2411,2415,2386,2370,2394,2412,2410,2405,2409,2424,2374,2274,2285,2360,2331,2270,2293,2341,2348,2314,2267,2250,2267,2276,2256,2269,2315,2281,2183,2136,2141,2171,2205,2182,2115,2049,2001,2012,2032,1988,1961,2023,2080,2041,1982,2044,2139,2112,2058,2043,2021,2059,2124,2119,2133,2144,2065,2031,2089,2144,2241,2353,2355,2317,2349,2364,2294,2229,2190,2108,2047,2102,2206,2293,2380,2455,2495,2507,2503,2531,2598,2625,2561,2471,2417,2380,2359,2384,2436,2485,2512,2508,2517,2546,2518,2431,2344,2311,2350,2376,2358,2388,2432,2430,2434,2437,2394,2329,2274,2301,2405,2435,2384,2394,2440,2397,2315,2306,2327,2324,2352,2367,2335,2347,2348,2269,2243,2293,2339,2389,2397,2382,2430,2446,2375,2299,2229,2200,2235,2274,2337,2413,2415,2395,2423,2480,2556,2598,2569,2522,2486,2506,2594,2657,2668,2654,2598,2556,2569,2583,2587,2581,2561,2579,2596,2546,2518,2546,2548,2528,2493,2405,2333,2339,2359,2381,2412,2405,2382,2397,2438,2493,2527,2498,2462,2440,2377,2314,2289,2258,2231,2217,2164,2103,2104,2158,2208,2201,2155,2117,2069,2036,2086,2150,2156,2172,2209,2207,2199,2203,2180,2127,2070,2061,2103,2093,2035,2017,2000,1965,1964,1969,1958,1944,1920,1923,1925,1886,1901,1964,1980,1993,2027,2033,2030,2016,2000,2040,2087,2091,2074,2031,2000,2009,2013,2029,2091,2148,2155,2129,2131,2177,2201,2200,2217,2239,2257,2254,2234,2260,2305,2303,2313,2364,2406,2431,2433,2400,2364,2354,2375,2394,2397,2393,2352,2282,2241,2198,2150,2162,2205,2230,2247,2241,2234,2259,2278,2263,2248,2246,2243,2233,2227,2228,2236,2253,2260,2266,2283,2274,2242,2223,2193,2156,2150,2154,2158,2170,2180,2207,2244,2265,2268,2221,2152,2167,2228,2233,2208,2191,2176,2179,2203,2224,2234,2226,2197,2174,2194,2230,2224,2179,2138,2114,2101,2084,2060,2045,2035,2032,2037,2017,1987,1994,2011,2002,1987,1980,1981,1989,1990,2002,2045,2098,2122,2113,2121,2161,2183,2181,2196,2215,2225,2238,2239,2245,2285,2311,2294,2290,2316,2340,2333,2289,2257,2277,2298,2283,2268,2275,2292,2299,2302,2317,2310,2271,2268,2294,2301,2311,2304,2272,2303,2365,2344,2294,2281,2252,2225,2252,2275,2265,2270,2303,2325,2304,2247,2206,2206,2222,2240,2261,2254,2226,2234,2284,2333,2365,2382,2393,2386,2347,2310,2313,2343,2381,2407,2407,2412,2427,2409,2378,2373,2365,2345,2352,2378,2390,2378,2341,2299,2282,2288,2282,2253,2217,2175,2123,2081,2055,2016,1955,1888,1833,1805,1790,1771,1766,1775,1779,1777,1759,1714,1679,1680,1695,1693,1672,1672,1705,1723,1716,1733,1778,1827,1880,1919,1919,1908,1910,1913,1920,1941,1953,1958,1971,1981,2007,2064,2110,2146,2212,2252,2213,2151,2119,2123,2152,2178,2206,2236,2229,2195,2169,2133,2103,2119,2144,2149,2165,2183,2167,2140,2133,2127,2109,2095,2084,2081,2100,2124,2142,2150,2131,2134,2184,2189,2136,2117,2109,2070,2067,2111,2145,2172,2202,2218,2211,2179,2144,2134,2137,2140,2148,2164,2189,2201,2181,2157,2153,2157,2150,2132,2129,2144,2150,2149,2157,2161,2147,2134,2136,2130,2098,2075,2086,2098,2096,2102,2110,2112,2117,2121,2133,2158,2172,2166,2155,2133,2102,2085,2089,2092,2095,2119,2148,2152,2135,2108,2089,2097,2104,2088,2080,2099,2133,2154,2153,2162,2187,2174,2130,2107,2101,2103,2120,2136,2141,2129,2110,2114,2125,2115,2110,2099,2064,2060,2097,2110,2094,2087,2093,2105,2113,2104,2096,2111,2129,2137,2161,2201,2221,2227,2230,2216,2213,2246,2266,2247,2225,2219,2234,2256,2250,2229,2226,2223,2219,2244,2272,2257,2227,2239,2280,2310,2327,2329,2309,2297,2301,2293,2279,2290,2313,2329,2353,2392,2413,2393,2367,2370,2378,2363,2339,2326,2317,2304,2310,2332,2332,2314,2319,2334,2332,2330,2348,2372,2374,2365,2381,2407,2410,2394,2364,2336,2336,2330,2298,2284,2280,2260,2258,2275,2274,2263,2248,2230,2222,2205,2176,2167,2170,2160,2147,2139,2129,2110,2086,2074,2082,2094,2094,2085,2080,2074,2058,2037,2023,2019,2032,2055,2063,2055,2052,2061,2058,2040,2034,2042,2049,2051,2036,1997,1969,1968,1968,1952,1931,1924,1931,1940,1968,1998,1978,1941,1940,1945,1941,1945,1936,1915,1907,1905,1897,1878,1859,1868,1874,1851,1852,1888,1906,1907,1909,1912,1916,1908,1893,1899,1905,1903,1919,1936,1930,1927,1931,1933,1946,1956,1944,1921,1896,1880,1889,1902,1900,1903,1913,1915,1918,1918,1908,1915,1936,1937,1927,1933,1942,1941,1939,1950,1975,1993,1994,1992,1999,2011,2015,2001,1989,1990,1984,1978,1983,1984,1990,2005,2007,2004,2016,2022,2025,2037,2039,2031,2031,2031,2020,2014,2021,2030,2028,2028,2048,2072,2083,2083,2084,2094,2108,2116,2119,2118,2107,2103,2108,2110,2116,2134,2145,2151,2162,2172,2175,2175,2178,2184,2188,2189,2194,2194,2185,2179,2178,2172,2170,2178,2178,2174,2187,2200,2197,2192,2179,2151,2137,2132,2116,2106,2105,2099,2089,2077,2071,2081,2089,2086,2087,2082,2071,2076,2081,2064,2052,2055,2048,2037,2034,2032,2020,1999,1988,1990,1992,2003,2021,2019,2003,2000,1998,1984,1977,1978,1976,1977,1984,1991,1997,2001,2008,2028,2044,2043,2046,2053,2050,2048,2058,2066,2078,2098,2113,2122,2127,2128,2136,2146,2144,2144,2164,2185,2193,2201,2207,2209,2212,2209,2196,2185,2183,2184,2188,2197,2200,2201,2207,2200,2177,2166,2170,2170,2167,2171,2169,2162,2158,2153,2137,2116,2105,2108,2107,2101,2097,2086,2069,2059,2052,2044,2036,2027,2023,2031,2029,2017,2011,2005,1996,1993,1983,1967,1960,1957,1949,1942,1940,1941,1942,1940,1939,1938,1933,1925,1921,1920,1924,1931,1933,1933,1939,1948,1956,1962,1965,1965,1962,1968,1982,1984,1983,1995,2002,2000,2011,2024,2026,2024,2024,2031,2049,2063,2076,2091,2088,2069,2069,2082,2086,2080,2070,2070,2081,2082,2072,2063,2056,2054,2058,2055,2047,2037,2027,2021,2014,2003,1996,1997,1996,1986,1973,1966,1957,1945,1942,1938,1926,1925,1930,1924,1920,1919,1910,1905,1909,1912,1910,1902,1901,1912,1918,1921,1934,1943,1947,1959,1966,1965,1964,1959,1958,1961,1955,1954,1958,1954,1956,1979,1999,2013,2029,2032,2022,2018,2026,2037,2042,2046,2051,2057,2063,2067,2070,2074,2071,2060,2054,2057,2060,2061,2065,2069,2079,2090,2086,2078,2074,2068,2069,2085,2088,2078,2082,2093,2092,2093,2097,2093,2088,2076,2059,2054,2056,2052,2050,2051,2047,2045,2042,2037,2035,2028,2017,2013,2011,2007,2008,2012,2014,2012,2003,1992,1989,1996,2000,1997,1995,2003,2012,2014,2010,2004,2007,2017,2023,2023,2025,2032,2038,2041,2043,2048,2049,2050,2055,2053,2045,2045,2042,2035,2044,2059,2058,2052,2055,2057,2053,2051,2053,2048,2039,2037,2038,2036,2038,2049,2051,2036,2026,2030,2033,2025,2025,2032,2031,2023,2013,2006,2004,2004,2005,2005,2005,2014,2027,2032,2034,2039,2043,2042,2031,2016,2013,2023,2032,2024,2002,1991,1997,1998,1995,2000,2008,2021,2033,2028,2015,2004,1999,2005,2007,1997,1991,1988,1982,1980,1973,1964,1969,1978,1980,1985,1989,1989,1991,1980,1967,1973,1988,1996,1998,1994,1989,1991,2000,2011,2019,2028,2035,2028,2022,2029,2033,2032,2037,2033,2023,2026,2031,2030,2031,2027,2025,2036,2048,2054,2054,2046,2040,2035,2021,2012,2019,2017,2009,2008,2004,1990,1982,1982,1979,1978,1982,1986,1988,1982,1976,1979,1981,1983,1994,1998,1993,1996,2001,2004,2026,2051,2055,2056,2063,2057,2042,2032,2025,2029,2047,2072,2098,2111,2108,2104,2104,2105,2110,2116,2119,2117,2111,2113,2123,2129,2127,2125,2124,2122,2114,2101,2087,2078,2075,2072,2056,2034,2020,2009,1995,1990,1991,1979,1958,1938,1923,1919,1918,1906,1888,1872,1852,1834,1830,1838,1842,1829,1809,1797,1791,1783,1775,1765,1756,1759,1768,1768,1756,1745,1745,1750,1744,1735,1734,1737,1746,1764,1782,1800,1818,1826,1823,1820,1821,1826,1829,1840,1868,1899,1914,1930,1951,1963,1972,1981,1981,1977,1976,1970,1962,1960,1966,1981,1993,2000,2008,2017,2023,2025,2022,2021,2032,2051,2064,2070,2076,2080,2076,2061,2051,2049,2040,2029,2032,2042,2043,2040,2045,2054,2048,2028,2017,2015,2007,1997,1992,1984,1983,1989,1983,1974,1985,2002,2001,1988,1980,1980,1982,1980,1969,1959,1967,1979,1974,1969,1975,1970,1955,1952,1961,1970,1979,1983,1984,1981,1981,1994,2009,2006,2005,2019,2024,2016,2020,2034,2040,2042,2046,2050,2055,2055,2051,2055,2063,2069,2078,2087,2088,2092,2097,2092,2094,2104,2102,2095,2093,2083,2072,2075,2082,2080,2078,2081,2084,2083,2089,2110,2128,2124,2111,2109,2110,2094,2077,2081,2089,2083,2071,2056,2044,2041,2035,2022,2017,2027,2039,2042,2027,2010,2007,2001,1981,1968,1967,1966,1964,1962,1961,1960,1958,1954,1948,1939,1929,1920,1919,1925,1927,1928,1937,1945,1943,1939,1938,1938,1933,1924,1919,1918,1918,1920,1920,1921,1930,1938,1935,1927,1924,1922,1927,1939,1950,1955,1965,1978,1981,1975,1971,1960,1947,1948,1950,1939,1934,1932,1926,1930,1943,1952,1956,1953,1943,1934,1932,1935,1934,1928,1927,1926,1917,1906,1900,1895,1893,1894,1892,1901,1920,1928,1921,1911,1905,1902,1894,1885,1883,1877,1868,1873,1893,1909,1914,1916,1918,1918,1918,1919,1929,1947,1961,1965,1964,1961,1959,1961,1965,1973,1987,1993,1996,2012,2027,2025,2026,2035,2041,2047,2052,2047,2042,2047,2056,2059,2055,2057,2068,2073,2065,2058,2055,2051,2049,2059,2071,2074,2072,2072,2067,2062,2063,2059,2049,2041,2032,2029,2032,2028,2021,2017,2011,2011,2014,2003,1988,1982,1974,1965,1962,1964,1970,1974,1972,1967,1962,1963,1969,1966,1950,1941,1940,1931,1918,1916,1919,1917,1913,1913,1914,1906,1891,1884,1888,1888,1877,1872,1882,1893,1901,1915,1924,1914,1900,1907,1922,1920,1910,1917,1930,1933,1929,1927,1935,1947,1952,1947,1944,1949,1960,1970,1980,1997,2013,2016,2011,2006,2001,2003,2009,2011,2014,2024,2034,2036,2035,2040,2049,2052,2051,2050,2046,2041,2041,2043,2047,2057,2064,2067,2072,2072,2070,2072,2075,2071,2063,2063,2066,2063,2059,2057,2044,2030,2029,2034,2033,2030,2026,2026,2033,2037,2037,2035,2028,2015,2008,2005,1996,1979,1966,1962,1959,1959,1964,1964,1955,1945,1938,1931,1925,1924,1923,1925,1927,1915,1897,1896,1901,1894,1891,1902,1911,1916,1916,1909,1903,1902,1896,1887,1881,1871,1858,1855,1865,1875,1874,1876,1888,1897,1900,1902,1898,1893,1896,1896,1889,1888,1890,1891,1894,1896,1891,1891,1899,1903,1901,1905,1916,1924,1928,1936,1941,1937,1930,1922,1913,1909,1911,1914,1922,1934,1942,1942,1942,1938,1927,1920,1921,1918,1918,1932,1939,1934,1935,1939,1937,1934,1941,1945,1941,1938,1934,1929,1929,1936,1938,1934,1936,1943,1944,1939,1936,1938,1942,1949,1955,1955,1954,1957,1954,1945,1945,1950,1947,1943,1943,1943,1942,1940,1941,1948,1949,1940,1935,1940,1947,1951,1955,1959,1963,1966,1970,1971,1971,1981,1992,1992,1988,1989,1985,1981,1980,1978,1978,1985,1992,1995,1998,2001,2003,2006,2008,2009,2010,2016,2020,2019,2016,2015,2015,2011,2007,2008,2008,2004,2002,2004,2004,2006,2008,2007,2005,2004,2006,2015,2021,2016,2010,2008,2005,2007,2019,2026,2023,2021,2025,2025,2018,2018,2022,2017,2009,2007,2009,2013,2018,2024,2029,2025,2009,2001,2007,2017,2020,2022,2026,2026,2018,2009,2007,2005,2000,1995,1991,1991,1994,1999,2007,2010,2006,1997,1990,1987,1988,1989,1986,1981,1980,1985,1989,1988,1985,1984,1979,1970,1967,1968,1965,1963,1966,1969,1964,1956,1950,1947,1945,1946,1949,1953,1956,1962,1970,1975,1978,1981,1980,1973,1964,1954,1943,1937,1933,1929,1929,1934,1938,1938,1938,1940,1937,1931,1935,1947,1954,1956,1955,1953,1951,1945,1934,1930,1935,1937,1936,1935,1932,1927,1921,1919,1923,1927,1921,1914,1913,1915,1914,1916,1923,1930,1934,1933,1929,1928,1933,1938,1936,1926,1918,1919,1924,1926,1928,1933,1933,1930,1928,1926,1922,1919,1921,1927,1932,1934,1935,1936,1933,1927,1924,1923,1921,1923,1928,1928,1922,1920,1920,1915,1913,1916,1920,1920,1916,1912,1909,1909,1910,1910,1912,1916,1920,1922,1920,1916,1912,1908,1901,1897,1900,1905,1907,1906,1904,1901,1898,1898,1901,1908,1914,1915,1914,1918,1926,1930,1930,1929,1925,1921,1920,1924,1934,1942,1942,1939,1939,1940,1939,1937,1938,1942,1945,1945,1947,1950,1951,1952,1954,1958,1962,1966,1971,1973,1969,1958,1949,1948,1948,1947,1948,1954,1960,1967,1975,1980,1982,1981,1980,1983,1987,1987,1983,1980,1977,1974,1970,1965,1957,1954,1956,1959,1958,1957,1956,1955,1956,1955,1953,1951,1949,1944,1940,1940,1941,1943,1947,1950,1949,1948,1945,1939,1933,1934,1936,1934,1933,1937,1943,1943,1939,1939,1944,1946,1944,1944,1945,1947,1953,1962,1966,1965,1963,1958,1953,1949,1945,1941,1941,1941,1939,1938,1943,1949,1953,1951,1947,1942,1942,1950,1959,1961,1960,1961,1958,1953,1954,1960,1963,1962,1965,1969,1969,1966,1965,1966,1967,1968,1971,1973,1973,1975,1980,1979,1973,1971,1977,1986,1995,2000,1997,1990,1985,1978,1967,1960,1965,1973,1979,1984,1985,1985,1985,1986,1986,1987,1987,1988,1991,1993,1992,1989,1986,1983,1982,1982,1981,1979,1979,1979,1982,1984,1981,1970,1959,1954,1950,1948,1952,1965,1979,1990,1995,1997,1994,1984,1974,1971,1972,1973,1972,1972,1969,1964,1959,1958,1960,1963,1968,1976,1980,1980,1978,1974,1971,1971,1974,1977,1981,1984,1983,1979,1976,1975,1976,1978,1980,1980,1979,1975,1968,1966,1968,1966,1960,1958,1960,1960,1962,1967,1972,1976,1979,1977,1974,1969,1961,1956,1957,1956,1949,1943,1942,1942,1943,1946,1951,1957,1963,1968,1970,1969,1965,1961,1960,1959,1957,1960,1965,1964,1960,1959,1961,1964,1969,1973,1974,1978,1984,1985,1981,1978,1978,1973,1966,1964,1969,1973,1976,1982,1988,1991,1993,1995,1996,1998,2000,1996,1988,1984,1986,1989,1992,1995,1996,1993,1989,1990,1994,1995,1993,1994,1995,1992,1990,1992,1995,1997,1998,1993,1982,1972,1969,1973,1979,1982,1982,1984,1988,1987,1977,1969,1966,1966,1968,1975,1980,1978,1973,1971,1970,1968,1965,1961,1956,1950,1946,1945,1946,1948,1952,1955,1956,1959,1963,1963,1959,1954,1948,1943,1942,1945,1947,1946,1943,1940,1936,1931,1928,1931,1936,1941,1943,1944,1943,1940,1937,1935,1932,1929,1923,1916,1911,1912,1920,1931,1939,1940,1935,1927,1923,1923,1920,1915,1910,1910,1912,1914,1915,1915,1918,1923,1928,1932,1932,1927,1921,1919,1919,1918,1919,1921,1921,1918,1915,1913,1912,1914,1919,1927,1934,1938,1938,1939,1941,1941,1937,1934,1930,1929,1930,1928,1927,1928,1930,1930,1930,1932,1935,1935,1930,1926,1925,1924,1923,1923,1920,1916,1914,1915,1916,1918,1924,1931,1934,1935,1934,1929,1922,1917,1914,1914,1918,1920,1920,1920,1920,1919,1919,1922,1927,1932,1933,1930,1928,1927,1926,1924,1925,1927,1927,1924,1919,1920,1924,1928,1930,1933,1936,1935,1930,1927,1927,1928,1930,1931,1932,1932,1933,1938,1947,1951,1951,1953,1958,1961,1963,1964,1961,1958,1958,1956,1953,1951,1951,1950,1949,1949,1950,1954,1960,1967,1971,1972,1968,1964,1965,1970,1977,1986,1993,1996,1997,1996,1992,1985,1982,1985,1992,1996,1997,1999,2002,2004,2010,2018,2024,2029,2033,2030,2023,2021,2023,2024,2024,2025,2023,2021,2019,2017,2017,2019,2024,2029,2036,2040,2040,2041,2042,2041,2039,2035,2028,2022,2017,2013,2012,2016,2020,2023,2025,2025,2023,2019,2014,2009,2008,2009,2013,2018,2016,2009,2000,1991,1987,1989,1993,1996,2001,2008,2012,2011,2004,1994,1983,1975,1969,1964,1959,1955,1952,1952,1957,1962,1967,1973,1975,1972,1965,1957,1951,1949,1948,1948,1945,1942,1937,1932,1927,1924,1926,1928,1929,1930,1931,1931,1931,1931,1929,1923,1914,1907,1904,1904,1904,1904,1905,1908,1909,1904,1897,1891,1889,1886,1883,1881,1880,1878,1876,1877,1877,1875,1877,1879,1880,1883,1886,1887,1886,1886,1885,1885,1885,1884,1882,1881,1880,1878,1877,1878,1883,1890,1895,1900,1905,1908,1905,1901,1899,1899,1898,1899,1904,1907,1909,1910,1908,1907,1907,1908,1910,1913,1917,1921,1926,1930,1938,1944,1946,1950,1954,1954,1955,1958,1960,1961,1964,1966,1964,1959,1957,1959,1964,1970,1976,1979,1981,1980,1978,1979,1981,1982,1982,1984,1984,1985,1986,1983,1979,1975,1972,1971,1972,1975,1977,1981,1984,1985,1984,1982,1978,1972,1969,1969,1973,1980,1988,1995,2001,2008,2013,2014,2012,2008,2005,2004,2002,1999,1996,1995,1996,1999,2003,2004,2007,2012,2017,2021,2023,2025,2027,2027,2029,2031,2030,2027,2024,2020,2018,2019,2023,2029,2036,2041,2044,2049,2052,2053,2051,2049,2045,2040,2038,2039,2039,2041,2044,2046,2045,2044,2039,2034,2033,2036,2037,2036,2032,2028,2024,2019,2012,2007,2003,2001,2002,2004,2007,2008,2006,2006,2006,2004,2001,1998,1992,1983,1977,1974,1972,1972,1973,1969,1965,1962,1958,1952,1949,1951,1953,1952,1952,1952,1948,1942,1938,1937,1938,1939,1941,1944,1946,1946,1943,1938,1934,1931,1929,1925,1923,1922,1921,1921,1922,1924,1928,1931,1932,1931,1928,1923,1919,1917,1917,1918,1918,1919,1921,1924,1926,1925,1924,1922,1921,1921,1922,1923,1924,1926,1929,1928,1924,1922,1920,1918,1920,1924,1927,1927,1927,1928,1928,1926,1925,1925,1925,1925,1925,1927,1930,1933,1935,1937,1937,1936,1938,1939,1939,1937,1934,1933,1930,1928,1928,1931,1935,1940,1943,1944,1947,1949,1949,1950,1954,1957,1958,1957,1956,1954,1954,1954,1954,1957,1961,1963,1966,1968,1969,1971,1973,1975,1975,1973,1972,1972,1969,1967,1967,1968,1970,1974,1979,1985,1989,1992,1995,1996,1996,1993,1986,1979,1972,1967,1962,1960,1962,1968,1977,1984,1988,1991,1989,1986,1986,1986,1988,1991,1990,1985,1978,1971,1967,1965,1965,1966,1970,1973,1974,1974,1974,1972,1969,1970,1971,1968,1963,1960,1960,1961,1964,1968,1975,1980,1982,1983,1981,1980,1980,1978,1976,1974,1974,1975,1978,1981,1984,1985,1986,1987,1989,1990,1990,1992,1996,2000,2001,2000,1995,1990,1986,1983,1981,1981,1984,1990,1996,2000,2001,2001,1998,1994,1990,1988,1988,1990,1993,1997,2001,2003,2006,2009,2010,2007,2003,1999,1996,1992,1989,1988,1992,1996,1998,1997,1996,1993,1989,1987,1988,1991,1994,1996,1996,1997,1997,1996,1995,1994,1992,1989,1986,1984,1986,1989,1992,1994,1993,1991,1988,1983,1979,1977,1979,1981,1983,1985,1987,1988,1987,1986,1983,1981,1978,1975,1973,1971,1970,1969,1969,1968,1966,1965,1965,1966,1968,1969,1970,1971,1971,1971,1972,1971,1968,1963,1955,1948,1942,1938,1938,1941,1946,1949,1952,1953,1952,1949,1946,1943,1942,1941,1938,1937,1939,1941,1943,1945,1948,1951,1954,1954,1955,1956,1956,1956,1953,1950,1947,1945,1945,1946,1948,1951,1953,1956,1960,1963,1966,1969,1972,1976,1982,1984,1981,1974,1968,1963,1961,1959,1959,1961,1962,1966,1972,1976,1979,1982,1983,1982,1982,1983,1982,1981,1979,1977,1978,1980,1982,1983,1983,1983,1981,1978,1977,1977,1977,1976,1977,1979,1980,1978,1976,1976,1976,1977,1978,1978,1978,1977,1975,1973,1972,1968,1964,1960,1958,1957,1955,1953,1955,1961,1966,1968,1968,1967,1963,1957,1953,1951,1953,1955,1956,1958,1958,1958,1958,1957,1955,1953,1951,1950,1950,1952,1953,1955,1957,1958,1959,1959,1960,1962,1965,1967,1971,1974,1977,1979,1979,1977,1974,1970,1968,1966,1967,1969,1972,1975,1981,1986,1990,1993,1996,1997,1997,1995,1994,1994,1995,1998,1999,1999,1998,1998,1996,1995,1995,1997,2002,2008,2012,2013,2012,2010,2007,2004,2002,2001,2003,2005,2008,2011,2013,2015,2017,2018,2017,2014,2009,2001,1993,1988,1984,1983,1983,1984,1987,1991,1993,1994,1995,1995,1996,1998,2000,2002,2001,1998,1996,1994,1989,1985,1981,1979,1979,1980,1982,1985,1989,1991,1990,1987,1984,1980,1976,1975,1977,1979,1980,1983,1986,1988,1989,1990,1991,1992,1991,1990,1989,1986,1982,1977,1974,1971,1969,1971,1975,1978,1980,1981,1983,1986,1987,1987,1986,1986,1984,1981,1977,1975,1974,1973,1973,1974,1975,1974,1971,1970,1970,1969,1968,1967,1965,1963,1963,1964,1964,1965,1966,1968,1970,1970,1970,1970,1969,1969,1968,1966,1966,1964,1963,1963,1964,1964,1963,1964,1966,1965,1963,1961,1962,1963,1963,1964,1964,1965,1963,1960,1958,1956,1954,1953,1954,1957,1961,1962,1964,1965,1965,1964,1964,1965,1967,1968,1971,1973,1975,1977,1980,1980,1977,1974,1971,1966,1960,1955,1954,1956,1959,1961,1963,1964,1965,1965,1965,1966,1966,1966,1966,1966,1967,1968,1969,1970,1971,1969,1967,1965,1964,1965,1966,1968,1972,1976,1978,1977,1974,1969,1964,1961,1960,1962,1965,1969,1973,1975,1977,1976,1974,1971,1968,1963,1959,1957,1957,1957,1956,1957,1958,1960,1962,1964,1965,1966,1968,1971,1973,1974,1974,1975,1976,1975,1971,1967,1965,1964,1965,1968,1971,1975,1979,1984,1989,1992,1994,1994,1993,1990,1987,1986,1987,1990,1994,1995,1995,1993,1991,1990,1991,1994,1997,2001,2004,2006,2005,2004,2000,1997,1994,1995,1996,1998,1999,2001,2002,2002,2002,2002,2002,2001,2000,1999,1998,1997,1997,1996,1995,1995,1997,1998,1998,1997,1997,1997,1998,1998,1997,1995,1993,1991,1990,1989,1987,1983,1981,1979,1978,1977,1978,1980,1982,1984,1985,1984,1982,1981,1981,1983,1985,1988,1990,1991,1990,1987,1984,1983,1984,1984,1986,1987,1987,1987,1986,1986,1986,1987,1989,1992,1994,1996,1996,1995,1995,1995,1996,1996,1997,1998,1998,1998,1997,1996,1996,1996,1996,1997,1999,2000,2000,2001,2003,2005,2006,2007,2007,2007,2007,2007,2009,2010,2010,2009,2009,2008,2008,2007,2005,2002,1999,1996,1994,1992,1992,1993,1996,1999,2003,2006,2008,2006,2002,1998,1994,1990,1989,1989,1990,1992,1993,1992,1989,1986,1983,1981,1982,1984,1988,1991,1992,1992,1991,1991,1989,1985,1981,1977,1975,1976,1979,1984,1987,1989,1990,1990,1988,1984,1978,1974,1972,1971,1971,1972,1973,1975,1978,1979,1980,1978,1977,1977,1977,1978,1978,1979,1979,1978,1976,1973,1970,1967,1965,1965,1966,1967,1971,1976,1980,1981,1980,1976,1972,1969,1967,1966,1968,1971,1974,1976,1976,1974,1973,1972,1973,1973,1972,1970,1969,1970,1973,1976,1976,1975,1974,1973,1973,1974,1975,1977,1978,1979,1980,1981,1981,1980,1980,1979,1978,1977,1976,1975,1974,1975,1978,1982,1984,1985,1985,1984,1983,1983,1983,1983,1984,1986,1988,1990,1989,1985,1982,1980,1980,1981,1984,1987,1990,1992,1993,1994,1993,1991,1989,1989,1989,1990,1991,1991,1990,1990,1990,1990,1990,1991,1992,1992,1991,1990,1990,1991,1992,1994,1996,1997,1997,1997,1998,1997,1995,1993,1991,1990,1991,1992,1992,1991,1991,1992,1992,1991,1991,1990,1988,1986,1984,1982,1981,1980,1980,1980,1981,1982,1983,1985,1985,1983,1980,1976,1975,1975,1975,1976,1975,1974,1972,1970,1968,1968,1969,1972,1975,1979,1984,1988,1990,1989,1986,1981,1976,1974,1974,1976,1979,1981,1983,1985,1987,1988,1989,1990,1992,1994,1995,1996,1996,1997,1999,2000,2001,2001,2001,2002,2002,2003,2006,2008,2010,2011,2012,2012,2012,2010,2007,2004,2002,2000,2001,2004,2007,2011,2016,2021,2024,2024,2021,2017,2014,2011,2011,2011,2011,2011,2011,2009,2007,2004,2002,2001,2001,2003,2005,2008,2011,2012,2012,2010,2007,2004,2001,2000,1999,1998,1998,1999,1999,2000,1999,1998,1997,1995,1993,1992,1992,1992,1993,1995,1996,1997,1997,1997,1996,1995,1993,1990,1989,1989,1990,1991,1991,1991,1991,1991,1989,1986,1983,1981,1981,1983,1987,1991,1994,1995,1993,1989,1986,1986,1987,1988,1990,1991,1993,1993,1991,1989,1986,1983,1981,1981,1981,1980,1980,1982,1984,1986,1986,1987,1988,1988,1989,1988,1986,1983,1982,1982,1983,1984,1984,1985,1984,1984,1984,1985,1986,1987,1988,1989,1989,1989,1990,1991,1990,1990,1989,1989,1990,1993,1996,1999,2002,2005,2005,2005,2003,2001,1999,1999,1999,2000,2000,2001,2002,2003,2004,2005,2009,2013,2017,2018,2019,2018,2017,2015,2013,2012,2013,2013,2014,2014,2014,2015,2016,2018,2021,2024,2028,2029,2029,2029,2028,2026,2024,2022,2020,2020,2019,2020,2021,2024,2028,2031,2033,2033,2033,2032,2031,2029,2028,2026,2024,2023,2022,2021,2021,2021,2022,2022,2022,2022,2021,2020,2018,2016,2017,2018,2018,2017,2015,2012,2008,2005,2003,2003,2005,2009,2012,2015,2016,2014,2010,2006,2002,1999,1997,1997,1998,2000,2001,2001,2001,2001,2001,2000,2000,1999,1998,1999,2000,2000,2000,1999,1998,1996,1992,1989,1988,1989,1989,1990,1990,1991,1992,1992,1992,1992,1991,1990,1989,1988,1988,1988,1989,1992,1996,1998,1997,1995,1991,1987,1985,1984,1985,1987,1990,1994,1997,1998,1996,1994,1991,1990,1989,1989,1992,1996,1999,2001,2001,2001,2001,2001,2001,2002,2002,2003,2003,2003,2003,2003,2002,2001,2001,2001,2001,2002,2004,2007,2009,2012,2015,2018,2019,2018,2016,2015,2012,2009,2005,2004,2005,2007,2010,2012,2014,2014,2014,2012,2011,2010,2011,2012,2013,2014,2014,2012,2009,2005,2002,2001,2002,2003,2005,2007,2010,2010,2008,2005,2003,2000,1997,1994,1993,1992,1990,1988,1986,1986,1987,1990,1992,1992,1992,1992,1990,1986,1981,1976,1974,1972,1970,1970,1969,1969,1968,1968,1967,1967,1967,1968,1969,1971,1971,1970,1969,1966,1962,1958,1956,1957,1959,1961,1963,1965,1965,1963,1961,1961,1962,1962,1962,1961,1960,1960,1959,1958,1958,1961,1965,1970,1972,1974,1974,1973,1972,1971,1971,1972,1973,1976,1978,1979,1979,1978,1978,1978,1978,1979,1983,1987,1991,1994,1996,1998,1998,1997,1994,1994,1995,1996,1998,1999,2001,2002,2003,2004,2004,2002,2002,2003,2005,2007,2008,2010,2012,2012,2013,2014,2014,2014,2014,2014,2013,2011,2012,2013,2014,2015,2018,2020,2021,2021,2020,2018,2018,2020,2022,2024,2025,2025,2024,2022,2019,2016,2014,2013,2014,2015,2017,2019,2021,2021,2020,2017,2015,2013,2011,2009,2008,2008,2010,2012,2014,2015,2015,2015,2015,2013,2011,2010,2008,2007,2007,2008,2007,2006,2005,2004,2002,2002,2002,2003,2003,2004,2005,2008,2010,2011,2008,2004,1999,1993,1990,1989,1990,1994,1998,2002,2006,2006,2003,2001,1999,1998,1998,1998,1999,2000,2000,1999,1999,1999,1999,2000,2001,2003,2005,2006,2008,2009,2010,2011,2010,2010,2010,2010,2009,2009,2011,2012,2014,2017,2020,2023,2024,2025,2024,2024,2021,2018,2015,2014,2015,2017,2020,2024,2027,2029,2031,2031,2032,2031,2031,2033,2035,2037,2038,2038,2037,2035,2033,2031,2032,2034,2036,2038,2039,2039,2038,2038,2038,2038,2040,2041,2041,2040,2038,2037,2036,2036,2036,2036,2036,2037,2036,2034,2032,2029,2026,2023,2021,2020,2019,2019,2019,2018,2018,2016,2015,2014,2012,2011,2010,2010,2011,2011,2010,2009,2007,2005,2003,2000,1999,1998,1997,1996,1995,1993,1991,1991,1992,1993,1993,1991,1989,1988,1987,1987,1988,1990,1992,1994,1994,1994,1993,1991,1988,1986,1984,1985,1987,1991,1994,1996,1995,1995,1994,1994,1993,1993,1994,1995,1996,1996,1997,1999,2000,2001,2002,2002,2002,2004,2006,2008,2008,2008,2009,2009,2008,2005,2004,2004,2005,2007,2010,2013,2016,2019,2021,2022,2022,2021,2018,2014,2010,2007,2005,2005,2006,2008,2010,2012,2015,2016,2015,2013,2011,2011,2013,2015,2017,2018,2017,2015,2012,2009,2008,2007,2007,2009,2011,2014,2015,2015,2013,2010,2005,2002,1999,1996,1993,1991,1992,1994,1997,2000,2002,2003,2003,2001,2000,2000,2000,1999,1998,1997,1997,1997,1996,1996,1996,1996,1997,1999,2000,2000,2000,2001,2003,2006,2007,2008,2007,2004,2001,1999,2000,2002,2003,2004,2003,2002,2001,2001,2003,2003,1999,1995,1995,2002,2009,2013,2013,2013,2014,2016,2019,2022,2024,2024,2022,2022,2025,2029,2032,2032,2030,2028,2028,2031,2033,2033,2032,2029,2028,2027,2028,2029,2027,2024,2022,2021,2020,2018,2016,2016,2018,2020,2021,2019,2016,2012,2008,2005,2003,2002,2001,1999,1996,1993,1991,1988,1986,1983,1982,1981,1979,1975,1969,1963,1960,1960,1960,1962,1964,1965,1966,1967,1967,1966,1964,1963,1964,1965,1964,1961,1958,1955,1954,1954,1954,1952,1950,1951,1955,1960,1964,1965,1967,1970,1970,1969,1968,1968,1967,1967,1968,1971,1975,1979,1982,1985,1988,1988,1988,1989,1992,1994,1996,1996,1996,1998,2002,2005,2008,2009,2009,2009,2007,2006,2007,2011,2014,2013,2011,2010,2009,2007,2003,1999,1998,1998,2001,2005,2011,2015,2016,2016,2016,2016,2014,2011,2009,2010,2011,2013,2013,2012,2009,2006,2005,2006,2008,2011,2013,2014,2015,2016,2019,2021,2022,2020,2017,2015,2016,2018,2019,2021,2022,2025,2028,2030,2030,2029,2028,2026,2025,2025,2027,2030,2033,2035,2036,2038,2039,2039,2040,2041,2043,2044,2046,2048,2050,2051,2051,2049,2047,2044,2042,2042,2045,2049,2051,2052,2050,2050,2050,2051,2051,2048,2046,2045,2047,2050,2051,2051,2050,2050,2051,2051,2050,2047,2044,2043,2043,2042,2041,2039,2040,2041,2041,2042,2042,2042,2040,2037,2034,2033,2032,2031,2031,2033,2032,2028,2023,2021,2021,2021,2021,2021,2022,2023,2021,2018,2014,2011,2007,2004,2002,2002,2002,2002,2001,2000,2002,2005,2008,2010,2012,2013,2013,2011,2009,2008,2006,2006,2006,2008,2011,2015,2016,2017,2017,2017,2014,2011,2009,2008,2007,2006,2006,2006,2007,2006,2005,2005,2006,2010,2014,2019,2022,2024,2025,2026,2026,2026,2024,2022,2020,2020,2021,2023,2024,2025,2025,2028,2031,2032,2028,2024,2022,2020,2017,2012,2010,2010,2011,2011,2010,2010,2011,2012,2011,2013,2018,2020,2018,2015,2014,2016,2015,2010,2006,2005,2005,2007,2011,2017,2022,2025,2025,2025,2024,2023,2022,2021,2021,2022,2021,2019,2019,2019,2019,2021,2024,2026,2024,2023,2025,2027,2027,2027,2027,2028,2030,2029,2026,2023,2020,2016,2013,2011,2011,2014,2018,2022,2024,2025,2027,2028,2027,2026,2025,2026,2028,2030,2033,2035,2035,2033,2033,2035,2036,2034,2032,2031,2030,2029,2030,2031,2030,2028,2026,2025,2025,2026,2025,2024,2023,2024,2026,2028,2031,2032,2033,2034,2035,2036,2035,2034,2034,2035,2036,2036,2034,2032,2032,2033,2030,2026,2024,2025,2027,2031,2034,2035,2034,2031,2027,2023,2019,2016,2015,2014,2013,2011,2010,2008,2007,2006,2005,2003,2000,2000,2000,2001,2001,2001,2001,2000,2000,2000,2000,2000,2001,2003,2003,2002,2000,1997,1994,1994,1996,1997,1996,1993,1989,1986,1984,1984,1986,1989,1990,1988,1986,1987,1989,1989,1989,1989,1988,1986,1986,1990,1997,2002,2004,2005,2009,2013,2014,2013,2013,2015,2016,2017,2016,2013,2011,2011,2013,2014,2014,2015,2016,2018,2020,2022,2023,2024,2023,2024,2025,2022,2017,2010,2006,2007,2010,2014,2014,2013,2015,2020,2027,2033,2035,2034,2030,2028,2027,2025,2022,2019,2017,2015,2015,2016,2015,2013,2011,2012,2013,2016,2018,2018,2015,2012,2013,2017,2023,2027,2028,2029,2032,2036,2040,2044,2047,2047,2046,2042,2036,2031,2031,2031,2030,2029,2030,2034,2037,2038,2037,2037,2039,2040,2041,2043,2046,2049,2052,2054,2057,2058,2057,2053,2048,2046,2047,2048,2049,2051,2053,2055,2053,2050,2046,2042,2039,2036,2035,2036,2041,2045,2044,2041,2039,2037,2036,2034,2031,2028,2028,2029,2031,2032,2035,2035,2032,2028,2025,2023,2022,2021,2018,2014,2011,2014,2018,2018,2014,2015,2019,2022,2022,2022,2023,2024,2023,2023,2023,2019,2014,2011,2010,2011,2011,2012,2013,2014,2016,2017,2017,2018,2020,2019,2017,2016,2016,2017,2018,2019,2019,2018,2017,2016,2017,2020,2023,2024,2024,2024,2022,2018,2014,2013,2014,2015,2016,2018,2020,2021,2022,2023,2025,2025,2024,2025,2026,2026,2023,2020,2018,2018,2017,2015,2014,2014,2015,2017,2018,2019,2021,2022,2021,2018,2016,2015,2013,2012,2012,2014,2014,2011,2008,2008,2010,2011,2011,2013,2014,2016,2016,2016,2015,2017,2021,2022,2019,2016,2016,2015,2016,2018,2020,2020,2020,2022,2023,2021,2018,2018,2019,2019,2017,2015,2014,2017,2022,2028,2031,2033,2033,2034,2038,2044,2048,2048,2047,2049,2050,2048,2045,2043,2043,2043,2042,2041,2038,2034,2032,2035,2038,2037,2035,2033,2032,2030,2027,2026,2029,2034,2035,2034,2033,2034,2034,2031,2029,2029,2029,2029,2029,2031,2034,2036,2036,2035,2033,2030,2024,2020,2019,2020,2022,2025,2027,2028,2026,2021,2016,2015,2020,2024,2024,2021,2022,2023,2020,2016,2011,2007,2004,2002,2000,1998,1997,1997,2000,2004,2008,2011,2013,2014,2016,2017,2014,2006,2000,1998,1997,1995,1993,1991,1988,1985,1984,1984,1984,1984,1985,1986,1988,1991,1995,1997,1998,1997,1993,1991,1992,1997,2001,2006,2012,2018,2021,2022,2022,2023,2026,2027,2027,2028,2032,2038,2041,2043,2044,2048,2053,2057,2058,2058,2058,2057,2057,2054,2048,2039,2033,2032,2035,2042,2056,2070,2077,2074,2072,2074,2076,2073,2068,2064,2063,2064,2065,2066,2065,2065,2066,2070,2074,2074,2070,2066,2063,2062,2062,2062,2059,2057,2057,2057,2053,2049,2047,2046,2046,2045,2045,2045,2045,2043,2039,2035,2036,2039,2042,2043,2042,2040,2036,2035,2037,2040,2041,2040,2041,2045,2048,2047,2042,2036,2032,2030,2029,2028,2029,2030,2030,2029,2030,2032,2034,2033,2033,2033,2031,2027,2024,2022,2021,2022,2024,2023,2021,2020,2021,2020,2018,2018,2019,2015,2009,2004,2002,2001,2002,2006,2011,2014,2011,2003,1992,1987,1990,2000,2010,2013,2009,2004,2001,1999,1998,1997,1996,1994,1993,1994,1995,1993,1989,1985,1983,1983,1985,1986,1986,1986,1988,1994,2001,2004,2003,2004,2007,2008,2003,1997,1996,1997,1998,1999,2002,2005,2007,2005,2001,1995,1990,1987,1989,1995,1999,2001,2002,1999,1993,1986,1983,1984,1985,1986,1987,1987,1988,1991,1995,1999,2001,2001,2000,2000,2002,2004,2006,2007,2011,2016,2019,2018,2014,2011,2011,2014,2017,2017,2016,2017,2021,2027,2030,2031,2029,2026,2024,2022,2019,2017,2017,2020,2025,2033,2040,2045,2045,2039,2033,2029,2030,2032,2032,2031,2032,2036,2038,2035,2033,2037,2045,2053,2059,2062,2061,2059,2056,2057,2060,2063,2062,2058,2053,2051,2053,2055,2052,2046,2039,2033,2029,2029,2034,2041,2044,2042,2042,2047,2056,2063,2069,2077,2085,2090,2091,2086,2078,2070,2066,2064,2059,2052,2049,2050,2052,2049,2044,2044,2048,2051,2051,2051,2050,2047,2044,2041,2039,2039,2043,2051,2059,2063,2065,2065,2061,2052,2041,2031,2022,2014,2007,2001,1998,1995,1993,1992,1994,1998,2004,2009,2011,2012,2017,2024,2028,2025,2019,2016,2019,2024,2030,2033,2035,2033,2027,2018,2009,2004,2002,2000,1997,1994,1992,1992,1994,1998,2004,2010,2015,2018,2020,2020,2019,2018,2018,2021,2025,2028,2028,2025,2021,2019,2018,2016,2017,2024,2034,2044,2049,2053,2058,2062,2059,2051,2042,2039,2042,2048,2051,2050,2049,2053,2059,2060,2054,2047,2044,2046,2048,2048,2045,2040,2035,2032,2031,2029,2028,2031,2037,2040,2040,2039,2038,2034,2030,2027,2029,2032,2031,2026,2022,2022,2027,2035,2043,2047,2048,2048,2047,2043,2037,2034,2035,2036,2036,2035,2033,2032,2030,2028,2027,2025,2022,2019,2018,2019,2018,2018,2018,2017,2016,2015,2015,2018,2021,2026,2029,2030,2031,2033,2038,2043,2043,2041,2040,2039,2037,2036,2036,2038,2039,2042,2047,2051,2053,2051,2048,2044,2043,2042,2039,2035,2034,2037,2041,2043,2041,2038,2037,2040,2048,2056,2063,2066,2069,2071,2070,2068,2068,2069,2070,2069,2064,2059,2058,2060,2065,2069,2068,2064,2062,2061,2059,2057,2058,2058,2056,2051,2045,2039,2031,2021,2010,2000,1995,1994,1995,1995,1993,1994,1998,2005,2011,2017,2027,2041,2050,2052,2052,2055,2060,2063,2063,2059,2053,2048,2045,2045,2043,2039,2035,2032,2028,2022,2019,2018,2016,2011,2006,2004,2003,2002,2002,2004,2004,2002,2001,2002,2006,2011,2017,2021,2021,2022,2025,2029,2030,2026,2021,2022,2023,2021,2014,2006,1999,1996,1994,1991,1989,1991,1998,2006,2010,2011,2013,2015,2015,2012,2010,2007,2006,2005,2005,2006,2010,2014,2017,2016,2015,2014,2016,2017,2016,2015,2012,2009,2008,2010,2010,2009,2009,2007,2004,2002,2002,2001,1998,1996,1999,2008,2015,2015,2011,2008,2008,2009,2012,2012,2012,2013,2015,2016,2017,2020,2023,2024,2025,2028,2031,2033,2035,2035,2031,2024,2020,2021,2023,2023,2019,2013,2012,2014,2017,2019,2021,2023,2027,2032,2034,2033,2031,2028,2027,2032,2038,2038,2034,2034,2036,2035,2029,2025,2025,2029,2030,2029,2029,2031,2034,2037,2040,2039,2035,2034,2037,2037,2032,2028,2029,2031,2034,2037,2038,2036,2031,2028,2027,2029,2030,2031,2029,2027,2028,2030,2027,2017,2009,2011,2020,2027,2032,2036,2039,2043,2046,2045,2041,2038,2037,2038,2039,2040,2041,2046,2052,2058,2060,2057,2052,2050,2050,2048,2044,2040,2038,2036,2035,2037,2041,2045,2046,2047,2046,2047,2050,2052,2050,2048,2047,2048,2050,2049,2046,2045,2050,2058,2065,2072,2078,2080,2078,2075,2071,2065,2060,2055,2051,2048,2047,2044,2043,2045,2049,2052,2054,2058,2062,2067,2067,2065,2062,2061,2059,2057,2053,2049,2047,2047,2048,2047,2047,2051,2061,2071,2078,2082,2085,2086,2089,2090,2087,2084,2085,2086,2084,2082,2081,2080,2077,2073,2069,2062,2052,2041,2034,2030,2026,2026,2030,2034,2036,2038,2042,2046,2044,2040,2040,2042,2043,2038,2030,2026,2031,2045,2055,2057,2054,2050,2044,2038,2035,2034,2034,2033,2029,2026,2023,2019,2014,2007,2002,2001,2002,2002,2003,2006,2011,2017,2023,2029,2032,2032,2032,2033,2033,2030,2027,2031,2037,2039,2038,2037,2037,2035,2029,2019,2010,2006,2006,2010,2012,2009,2003,2000,1998,1994,1989,1984,1984,1990,1996,1999,2000,2003,2004,2003,2002,2003,2005,2008,2012,2017,2020,2021,2018,2013,2008,2001,1994,1988,1987,1987,1987,1986,1985,1987,1992,2000,2007,2011,2014,2018,2022,2026,2029,2027,2024,2021,2016,2009,2005,2001,1997,1996,1997,1999,2002,2006,2009,2012,2019,2028,2035,2040,2044,2049,2051,2051,2050,2054,2063,2068,2068,2063,2056,2050,2047,2047,2045,2039,2034,2034,2037,2041,2047,2051,2056,2062,2070,2076,2079,2080,2080,2076,2071,2067,2066,2069,2074,2078,2079,2077,2075,2078,2084,2087,2084,2079,2075,2076,2077,2073,2067,2063,2063,2062,2062,2066,2073,2077,2080,2082,2083,2084,2084,2084,2084,2082,2078,2075,2074,2075,2076,2074,2071,2070,2069,2067,2064,2063,2064,2063,2061,2059,2059,2057,2053,2051,2050,2047,2047,2050,2049,2042,2039,2041,2047,2052,2056,2057,2056,2056,2055,2053,2051,2047,2045,2045,2047,2051,2053,2052,2048,2046,2044,2040,2033,2028,2027,2026,2026,2026,2027,2027,2027,2029,2033,2037,2041,2044,2044,2041,2038,2036,2034,2032,2027,2020,2014,2013,2014,2014,2010,2007,2007,2010,2011,2009,2002,1993,1987,1984,1983,1984,1987,1990,1995,2003,2009,2013,2016,2019,2022,2025,2029,2034,2038,2040,2043,2051,2061,2067,2064,2058,2051,2045,2041,2037,2035,2033,2028,2019,2009,2000,1989,1977,1965,1957,1950,1945,1944,1952,1965,1974,1977,1977,1979,1981,1982,1983,1986,1994,2001,2006,2009,2015,2022,2027,2030,2032,2036,2039,2043,2050,2058,2063,2065,2066,2066,2065,2065,2065,2064,2063,2062,2062,2064,2062,2054,2043,2035,2032,2030,2027,2023,2019,2017,2016,2015,2019,2025,2029,2030,2031,2033,2033,2033,2033,2034,2035,2034,2035,2040,2049,2060,2066,2069,2068,2066,2060,2056,2053,2049,2045,2040,2036,2034,2036,2039,2043,2047,2052,2055,2055,2052,2048,2049,2052,2054,2052,2048,2043,2036,2032,2030,2028,2028,2030,2030,2024,2019,2016,2015,2012,2008,2005,2005,2008,2015,2020,2021,2021,2021,2023,2026,2030,2033,2038,2046,2057,2068,2075,2081,2085,2084,2080,2079,2081,2078,2070,2062,2056,2048,2040,2038,2039,2041,2040,2037,2036,2037,2040,2043,2047,2050,2054,2057,2061,2062,2061,2059,2059,2060,2058,2054,2052,2053,2057,2063,2069,2073,2072,2069,2068,2072,2076,2077,2077,2076,2074,2074,2075,2075,2074,2075,2078,2081,2085,2089,2090,2088,2086,2082,2077,2069,2062,2057,2052,2046,2040,2035,2031,2031,2033,2034,2033,2031,2032,2037,2045,2053,2059,2063,2066,2068,2071,2073,2073,2071,2068,2067,2068,2072,2078,2083,2086,2089,2090,2089,2087,2085,2084,2081,2077,2073,2070,2068,2067,2067,2067,2066,2063,2061,2057,2053,2049,2048,2050,2051,2052,2055,2060,2062,2062,2062,2063,2062,2060,2060,2059,2056,2052,2052,2058,2067,2077,2081,2074,2060,2048,2044,2042,2039,2033,2030,2030,2032,2034,2036,2038,2040,2042,2045,2052,2060,2061,2057,2053,2051,2049,2048,2051,2053,2051,2049,2049,2049,2045,2041,2038,2040,2045,2051,2056,2058,2059,2057,2057,2061,2067,2070,2070,2071,2072,2071,2070,2071,2073,2070,2064,2056,2050,2047,2044,2038,2029,2019,2011,2009,2013,2018,2020,2021,2022,2023,2025,2028,2031,2033,2036,2038,2040,2043,2049,2054,2057,2059,2061,2062,2063,2063,2064,2066,2068,2067,2064,2064,2068,2072,2075,2078,2077,2073,2071,2073,2074,2071,2067,2063,2060,2062,2068,2068,2061,2053,2049,2050,2053,2054,2052,2048,2043,2037,2034,2036,2038,2038,2042,2049,2055,2055,2054,2053,2049,2044,2042,2042,2042,2037,2030,2028,2033,2042,2048,2047,2041,2036,2040,2050,2055,2050,2042,2037,2036,2041,2046,2045,2040,2034,2026,2020,2020,2027,2031,2031,2030,2031,2033,2035,2038,2041,2040,2039,2041,2045,2046,2041,2031,2025,2025,2026,2030,2036,2040,2039,2034,2029,2024,2020,2020,2022,2024,2026,2026,2023,2020,2018,2016,2012,2008,2007,2007,2009,2013,2018,2022,2025,2026,2027,2028,2031,2035,2035,2033,2030,2028,2030,2033,2037,2039,2042,2042,2038,2032,2029,2030,2033,2035,2035,2033,2032,2034,2036,2036,2033,2026,2019,2017,2019,2022,2024,2025,2025,2026,2029,2036,2042,2046,2047,2046,2044,2044,2044,2046,2049,2050,2048,2044,2041,2042,2042,2042,2041,2038,2037,2040,2046,2050,2052,2053,2052,2052,2053,2055,2057,2061,2067,2068,2065,2062,2061,2059,2059,2064,2073,2080,2083,2087,2091,2094,2094,2092,2090,2089,2091,2093,2093,2089,2085,2085,2087,2090,2090,2086,2083,2082,2083,2082,2078,2073,2069,2066,2066,2067,2068,2069,2068,2067,2067,2070,2073,2073,2067,2060,2057,2059,2064,2069,2070,2067,2063,2062,2063,2062,2061,2061,2062,2063,2063,2062,2058,2050,2041,2035,2035,2038,2041,2042,2040,2037,2035,2038,2044,2052,2056,2057,2056,2056,2055,2053,2052,2053,2055,2055,2053,2053,2056,2061,2063,2061,2058,2056,2057,2057,2055,2052,2048,2045,2042,2041,2042,2041,2040,2042,2047,2051,2053,2053,2053,2052,2052,2055,2058,2059,2057,2056,2055,2054,2053,2052,2048,2043,2042,2046,2050,2052,2053,2054,2056,2057,2057,2053,2048,2049,2054,2056,2055,2056,2060,2062,2060,2058,2055,2053,2051,2049,2044,2040,2042,2048,2056,2062,2067,2072,2075,2071,2064,2059,2059,2061,2061,2061,2061,2060,2058,2056,2054,2054,2056,2056,2053,2051,2053,2060,2066,2070,2070,2067,2061,2055,2053,2053,2054,2056,2061,2068,2074,2077,2078,2076,2071,2067,2065,2064,2064,2063,2060,2057,2054,2054,2054,2054,2053,2052,2050,2050,2053,2058,2062,2066,2069,2071,2073,2070,2065,2061,2060,2059,2059,2058,2055,2051,2047,2046,2047,2050,2052,2052,2048,2045,2045,2046,2044,2041,2039,2035,2031,2028,2025,2023,2023,2025,2028,2030,2032,2037,2045,2051,2053,2056,2061,2064,2065,2066,2068,2068,2065,2063,2061,2059,2060,2062,2062,2058,2053,2047,2043,2040,2038,2038,2039,2041,2043,2043,2041,2035,2030,2027,2026,2025,2028,2033,2037,2037,2037,2041,2045,2047,2048,2050,2052,2056,2059,2060,2058,2056,2057,2063,2070,2072,2070,2068,2067,2067,2065,2064,2063,2061,2057,2051,2045,2041,2040,2040,2042,2045,2048,2049,2048,2046,2046,2048,2050,2053,2058,2064,2068,2067,2068,2072,2075,2075,2075,2077,2080,2083,2082,2078,2073,2067,2065,2067,2071,2070,2063,2058,2061,2067,2073,2076,2075,2072,2068,2065,2064,2063,2062,2061,2061,2061,2063,2067,2072,2076,2078,2077,2076,2075,2074,2071,2068,2066,2066,2069,2070,2066,2062,2060,2060,2061,2065,2070,2074,2073,2071,2068,2067,2069,2073,2077,2078,2079,2078,2075,2072,2068,2064,2063,2065,2069,2072,2074,2073,2072,2071,2071,2069,2064,2058,2055,2057,2062,2066,2066,2063,2060,2059,2059,2063,2065,2064,2058,2051,2047,2048,2053,2056,2055,2053,2053,2053,2053,2053,2054,2057,2060,2061,2060,2059,2061,2063,2061,2057,2053,2052,2055,2062,2067,2068,2065,2062,2060,2058,2057,2058,2060,2060,2057,2054,2053,2054,2054,2054,2055,2055,2055,2057,2057,2058,2059,2061,2060,2058,2056,2053,2047,2041,2041,2047,2053,2053,2048,2042,2036,2034,2034,2037,2042,2047,2050,2048,2044,2042,2043,2045,2045,2041,2035,2031,2031,2032,2031,2027,2023,2023,2026,2028,2029,2032,2037,2043,2049,2053,2055,2054,2050,2046,2045,2047,2048,2046,2042,2038,2035,2033,2031,2029,2027,2026,2025,2025,2025,2025,2026,2030,2039,2047,2049,2047,2046,2047,2048,2049,2048,2046,2044,2044,2044,2043,2039,2035,2035,2038,2040,2039,2040,2044,2050,2053,2055,2054,2051,2050,2050,2049,2046,2044,2045,2048,2053,2062,2069,2071,2068,2064,2063,2065,2066,2065,2063,2060,2058,2058,2058,2056,2052,2051,2051,2046,2041,2041,2048,2056,2060,2059,2055,2051,2050,2050,2052,2053,2056,2060,2068,2075,2078,2078,2079,2082,2087,2092,2094,2095,2095,2095,2091,2084,2079,2077,2073,2063,2050,2043,2042,2044,2046,2046,2047,2048,2051,2055,2059,2059,2058,2060,2063,2065,2066,2068,2069,2068,2066,2065,2065,2065,2064,2063,2065,2070,2075,2075,2072,2070,2072,2077,2082,2085,2084,2082,2080,2081,2084,2087,2090,2091,2091,2089,2085,2079,2072,2065,2060,2057,2057,2062,2071,2077,2074,2065,2060,2062,2069,2074,2073,2067,2062,2064,2071,2076,2076,2075,2074,2074,2073,2070,2066,2062,2058,2054,2050,2046,2043,2041,2044,2049,2054,2057,2061,2064,2069,2075,2081,2087,2094,2101,2107,2111,2112,2110,2108,2106,2104,2102,2101,2101,2100,2096,2091,2085,2079,2073,2067,2061,2058,2059,2060,2057,2051,2050,2054,2060,2062,2060,2057,2057,2062,2067,2071,2073,2074,2077,2081,2083,2081,2075,2070,2069,2072,2078,2082,2085,2085,2082,2076,2072,2070,2070,2070,2068,2064,2060,2059,2062,2068,2074,2078,2080,2079,2076,2073,2071,2068,2063,2059,2057,2057,2059,2060,2061,2062,2062,2065,2069,2075,2080,2081,2078,2075,2076,2082,2084,2079,2069,2060,2059,2064,2069,2072,2072,2071,2072,2073,2071,2069,2066,2062,2059,2058,2058,2060,2062,2061,2057,2053,2053,2058,2061,2062,2061,2061,2063,2064,2062,2061,2060,2060,2062,2065,2066,2063,2057,2053,2052,2055,2061,2065,2067,2070,2073,2073,2070,2064,2060,2060,2062,2062,2058,2053,2051,2055,2063,2069,2070,2066,2063,2063,2065,2065,2063,2060,2058,2058,2060,2062,2062,2061,2060,2055,2046,2034,2027,2029,2034,2038,2036,2032,2031,2033,2037,2040,2043,2047,2052,2057,2057,2054,2049,2046,2046,2051,2056,2058,2056,2052,2050,2050,2047,2041,2037,2036,2039,2044,2048,2051,2055,2058,2059,2056,2051,2044,2038,2032,2027,2027,2031,2037,2042,2046,2051,2055,2056,2052,2046,2043,2042,2042,2041,2040,2039,2040,2041,2044,2045,2045,2043,2040,2039,2040,2041,2040,2039,2039,2040,2037,2031,2024,2019,2019,2020,2020,2020,2023,2028,2033,2035,2036,2038,2042,2047,2051,2053,2054,2053,2053,2054,2055,2055,2052,2044,2035,2029,2027,2030,2034,2040,2045,2051,2056,2061,2065,2064,2060,2054,2049,2045,2043,2040,2037,2035,2033,2030,2026,2024,2025,2030,2036,2041,2043,2045,2048,2053,2059,2064,2068,2068,2065,2061,2059,2057,2054,2050,2046,2042,2039,2035,2033,2034,2038,2041,2038,2032,2025,2023,2028,2039,2054,2068,2076,2079,2078,2078,2081,2083,2080,2071,2061,2055,2057,2060,2060,2055,2049,2044,2041,2036,2029,2022,2021,2027,2033,2033,2026,2019,2017,2021,2025,2025,2021,2018,2019,2025,2034,2043,2049,2052,2055,2059,2065,2071,2074,2074,2075,2080,2087,2092,2092,2090,2089,2088,2085,2081,2077,2075,2073,2070,2068,2068,2070,2073,2074,2074,2072,2072,2073,2077,2081,2080,2075,2067,2060,2055,2052,2050,2049,2049,2051,2055,2060,2062,2063,2065,2065,2063,2061,2062,2065,2070,2075,2081,2086,2090,2094,2099,2106,2110,2110,2108,2106,2106,2107,2107,2106,2105,2105,2102,2097,2091,2087,2084,2078,2071,2065,2063,2063,2060,2056,2055,2057,2059,2057,2051,2049,2054,2065,2074,2078,2077,2074,2070,2067,2068,2070,2071,2071,2073,2077,2083,2087,2090,2091,2092,2093,2092,2089,2086,2084,2082,2081,2081,2080,2079,2075,2071,2072,2078,2085,2089,2091,2093,2095,2097,2100,2105,2113,2121,2126,2129,2131,2134,2134,2131,2125,2119,2112,2102,2091,2079,2073,2072,2073,2073,2070,2068,2069,2071,2070,2069,2070,2072,2071,2066,2061,2058,2057,2057,2056,2054,2054,2055,2055,2057,2059,2059,2058,2056,2054,2051,2047,2043,2041,2041,2043,2041,2037,2033,2033,2036,2040,2043,2044,2043,2042,2042,2042,2042,2042,2044,2045,2046,2047,2049,2052,2058,2066,2073,2076,2073,2065,2058,2052,2046,2040,2034,2028,2023,2019,2012,2006,2000,1996,1993,1991,1990,1991,1992,1991,1987,1982,1978,1974,1973,1974,1977,1979,1977,1973,1972,1978,1988,1999,2008,2013,2015,2014,2010,2005,2000,1995,1988,1980,1976,1977,1981,1988,1993,1998,2003,2008,2013,2016,2017,2016,2011,2007,2003,1999,1994,1990,1990,1993,1997,1998,1998,1996,1996,1996,1999,2004,2009,2012,2013,2015,2019,2025,2031,2033,2032,2029,2026,2023,2021,2020,2019,2019,2018,2017,2017,2016,2015,2013,2014,2017,2021,2025,2030,2035,2039,2043,2048,2050,2049,2048,2049,2051,2054,2056,2057,2060,2064,2072,2082,2090,2096,2099,2103,2106,2105,2099,2097,2098,2100,2099,2096,2096,2100,2104,2108,2111,2112,2110,2107,2104,2102,2100,2099,2099,2099,2098,2094,2088,2083,2081,2083,2084,2082,2080,2083,2090,2096,2098,2099,2100,2102,2104,2105,2106,2108,2112,2120,2128,2132,2129,2125,2121,2119,2118,2119,2120,2121,2122,2123,2122,2120,2119,2118,2118,2118,2118,2117,2114,2114,2117,2121,2121,2117,2115,2117,2119,2118,2113,2109,2105,2103,2102,2099,2093,2088,2087,2088,2088,2091,2094,2093,2091,2089,2090,2089,2085,2083,2086,2089,2088,2083,2083,2087,2089,2089,2089,2089,2089,2092,2098,2105,2108,2106,2099,2089,2081,2078,2079,2078,2077,2075,2073,2072,2070,2069,2074,2083,2090,2091,2086,2080,2078,2079,2082,2084,2085,2085,2082,2080,2081,2082,2079,2074,2071,2069,2069,2071,2074,2075,2074,2072,2067,2061,2057,2056,2055,2052,2046,2040,2037,2037,2037,2038,2040,2042,2044,2051,2060,2068,2074,2079,2083,2085,2086,2086,2087,2087,2084,2081,2078,2078,2078,2078,2077,2075,2071,2067,2063,2061,2061,2061,2062,2064,2066,2070,2078,2090,2100,2103,2101,2100,2101,2099,2095,2090,2086,2081,2075,2072,2071,2068,2062,2058,2057,2057,2055,2052,2051,2049,2048,2050,2055,2060,2062,2064,2067,2070,2073,2072,2067,2059,2055,2058,2063,2068,2071,2074,2078,2082,2083,2083,2084,2086,2087,2087,2085,2082,2080,2081,2083,2082,2075,2065,2056,2056,2061,2065,2065,2062,2060,2061,2066,2074,2079,2077,2071,2068,2068,2070,2072,2074,2072,2068,2064,2063,2065,2066,2063,2057,2049,2043,2041,2044,2046,2048,2050,2054,2055,2053,2052,2055,2057,2056,2054,2054,2057,2061,2062,2059,2055,2054,2056,2061,2064,2064,2064,2068,2073,2074,2070,2062,2054,2050,2046,2043,2043,2049,2057,2059,2059,2061,2063,2062,2060,2060,2060,2056,2052,2052,2055,2053,2046,2040,2039,2041,2042,2044,2047,2050,2052,2054,2054,2052,2049,2046,2039,2031,2027,2030,2034,2036,2034,2030,2028,2030,2036,2041,2041,2037,2035,2039,2044,2043,2038,2035,2036,2037,2034,2031,2032,2036,2041,2045,2047,2047,2047,2047,2046,2047,2045,2039,2033,2031,2032,2034,2035,2036,2037,2038,2037,2036,2037,2040,2043,2044,2043,2043,2046,2048,2048,2047,2049,2052,2052,2049,2047,2051,2055,2056,2053,2051,2050,2050,2051,2055,2060,2059,2050,2037,2029,2027,2028,2030,2031,2030,2031,2035,2041,2047,2049,2048,2046,2046,2049,2054,2060,2066,2068,2067,2066,2069,2073,2073,2068,2060,2051,2046,2045,2045,2046,2049,2050,2048,2046,2048,2051,2051,2048,2046,2047,2048,2049,2048,2049,2053,2058,2061,2061,2060,2059,2059,2064,2072,2080,2084,2086,2086,2085,2082,2079,2075,2067,2059,2054,2055,2058,2063,2067,2071,2075,2077,2077,2073,2071,2070,2070,2070,2072,2073,2073,2075,2082,2091,2095,2095,2093,2088,2082,2076,2072,2070,2070,2070,2071,2073,2075,2076,2077,2078,2078,2073,2068,2067,2070,2071,2068,2065,2064,2066,2068,2069,2070,2071,2074,2078,2086,2095,2101,2103,2103,2101,2098,2091,2081,2072,2068,2070,2075,2078,2077,2074,2073,2074,2078,2081,2082,2079,2074,2072,2075,2078,2079,2078,2076,2074,2076,2080,2083,2084,2084,2082,2080,2078,2078,2077,2077,2077,2076,2076,2078,2080,2079,2076,2075,2076,2076,2072,2070,2068,2068,2068,2066,2062,2060,2061,2065,2065,2062,2059,2057,2059,2059,2058,2058,2061,2063,2063,2060,2055,2051,2049,2053,2057,2058,2055,2053,2055,2055,2053,2051,2050,2047,2039,2030,2023,2020,2021,2024,2026,2029,2031,2033,2036,2038,2038,2035,2032,2032,2032,2033,2033,2035,2038,2043,2045,2041,2032,2022,2017,2015,2014,2012,2011,2015,2023,2033,2037,2036,2031,2026,2020,2015,2015,2019,2023,2027,2029,2030,2030,2030,2028,2026,2022,2019,2016,2015,2014,2014,2013,2012,2015,2021,2026,2028,2028,2028,2029,2032,2034,2035,2033,2032,2036,2043,2047,2045,2039,2035,2034,2036,2040,2043,2043,2039,2035,2033,2033,2033,2029,2024,2022,2024,2027,2026,2023,2024,2029,2034,2039,2039,2033,2026,2024,2028,2032,2036,2039,2039,2040,2044,2051,2054,2055,2054,2053,2054,2060,2065,2068,2069,2072,2073,2070,2069,2070,2070,2066,2063,2063,2062,2058,2056,2059,2064,2067,2064,2055,2045,2037,2034,2035,2039,2043,2045,2043,2042,2042,2042,2045,2050,2054,2057,2060,2065,2067,2066,2066,2069,2072,2073,2073,2075,2079,2086,2091,2092,2090,2088,2089,2089,2088,2085,2082,2082,2085,2086,2085,2082,2078,2070,2062,2055,2052,2053,2060,2071,2081,2088,2089,2088,2084,2079,2074,2069,2066,2065,2067,2068,2067,2066,2065,2064,2065,2068,2072,2078,2083,2083,2080,2075,2070,2063,2055,2049,2047,2047,2048,2051,2056,2058,2059,2060,2061,2063,2064,2066,2067,2067,2065,2062,2057,2056,2059,2066,2076,2083,2087,2088,2090,2093,2093,2092,2092,2090,2084,2076,2068,2063,2059,2056,2055,2057,2059,2059,2056,2052,2049,2049,2050,2050,2049,2047,2046,2047,2046,2041,2035,2030,2028,2031,2037,2044,2048,2048,2049,2050,2051,2051,2051,2051,2054,2061,2067,2068,2062,2054,2049,2047,2047,2048,2050,2053,2056,2060,2063,2067,2068,2066,2061,2058,2058,2059,2058,2057,2058,2059,2059,2057,2055,2056,2060,2067,2072,2074,2077,2079,2081,2084,2087,2085,2075,2060,2048,2040,2033,2029,2031,2036,2040,2043,2047,2052,2055,2056,2058,2062,2069,2075,2077,2076,2075,2076,2076,2076,2073,2066,2059,2058,2063,2069,2072,2073,2077,2085,2092,2094,2092,2089,2087,2082,2076,2070,2065,2059,2051,2047,2050,2055,2058,2059,2064,2071,2077,2078,2075,2073,2073,2075,2077,2077,2075,2072,2071,2071,2069,2064,2060,2059,2063,2065,2064,2062,2062,2062,2061,2058,2055,2053,2051,2049,2047,2048,2052,2057,2059,2057,2054,2054,2058,2064,2071,2075,2075,2070,2068,2071,2074,2076,2075,2073,2070,2063,2056,2051,2049,2047,2045,2042,2036,2028,2022,2019,2018,2017,2018,2022,2028,2033,2034,2033,2032,2032,2033,2032,2030,2026,2023,2022,2024,2027,2032,2036,2038,2038,2037,2036,2034,2031,2028,2027,2026,2025,2022,2020,2019,2019,2021,2024,2028,2030,2029,2025,2019,2013,2010,2008,2007,2007,2010,2013,2014,2014,2015,2019,2024,2028,2032,2036,2040,2043,2044,2042,2038,2036,2038,2042,2044,2043,2040,2038,2038,2035,2032,2028,2027,2026,2025,2024,2026,2028,2028,2027,2029,2032,2034,2034,2037,2043,2048,2051,2053,2054,2055,2054,2052,2051,2049,2046,2044,2045,2049,2053,2055,2054,2054,2057,2063,2066,2065,2062,2061,2061,2061,2060,2058,2055,2053,2051,2051,2052,2052,2051,2048,2047,2050,2054,2058,2061,2062,2064,2066,2069,2070,2069,2068,2069,2072,2075,2075,2074,2073,2073,2072,2070,2069,2069,2070,2068,2067,2068,2071,2075,2077,2078,2077,2074,2072,2071,2071,2070,2069,2068,2068,2067,2066,2064,2062,2061,2063,2066,2070,2075,2080,2085,2088,2090,2090,2089,2086,2084,2083,2083,2081,2080,2081,2083,2081,2075,2070,2068,2069,2070,2071,2071,2067,2064,2064,2067,2070,2070,2069,2069,2071,2072,2070,2068,2066,2066,2067,2069,2072,2075,2079,2084,2092,2099,2101,2099,2098,2099,2099,2097,2092,2089,2088,2089,2089,2085,2080,2076,2074,2074,2073,2072,2071,2070,2069,2065,2062,2061,2063,2063,2062,2062,2063,2065,2066,2067,2070,2075,2080,2085,2087,2087,2086,2081,2075,2070,2068,2067,2066,2063,2059,2056,2054,2055,2058,2060,2063,2065,2068,2071,2073,2074,2075,2074,2072,2070,2069,2067,2064,2062,2062,2062,2062,2061,2058,2056,2055,2055,2055,2055,2054,2054,2053,2051,2050,2051,2053,2055,2054,2053,2052,2051,2050,2050,2048,2045,2043,2042,2042,2042,2042,2041,2042,2045,2046,2045,2043,2043,2044,2045,2044,2043,2043,2044,2044,2041,2036,2032,2031,2035,2039,2041,2042,2044,2045,2045,2042,2038,2035,2033,2030,2028,2027,2028,2028,2027,2028,2033,2038,2041,2042,2040,2037,2034,2033,2033,2032,2032,2033,2036,2036,2035,2034,2035,2034,2031,2027,2028,2032,2036,2038,2039,2039,2039,2039,2041,2044,2046,2047,2046,2045,2045,2046,2046,2045,2046,2051,2058,2062,2062,2057,2051,2047,2044,2044,2044,2042,2037,2034,2038,2045,2050,2049,2043,2035,2028,2024,2021,2020,2021,2025,2032,2038,2042,2045,2049,2050,2049,2047,2046,2046,2048,2050,2052,2052,2052,2055,2058,2060,2060,2059,2059,2061,2063,2065,2066,2064,2062,2058,2055,2055,2057,2056,2052,2050,2051,2052,2050,2048,2046,2043,2039,2031,2024,2021,2023,2029,2033,2031,2029,2031,2038,2049,2060,2069,2072,2071,2068,2068,2069,2067,2063,2058,2053,2050,2048,2047,2046,2044,2043,2044,2046,2049,2053,2056,2059,2062,2064,2066,2067,2067,2065,2060,2054,2049,2049,2053,2054,2050,2046,2046,2049,2051,2050,2048,2048,2050,2051,2054,2056,2056,2055,2053,2052,2051,2053,2054,2053,2050,2048,2048,2049,2049,2050,2051,2055,2061,2069,2075,2077,2078,2080,2083,2088,2091,2091,2086,2078,2069,2059,2051,2048,2050,2053,2054,2054,2055,2056,2056,2056,2058,2061,2063,2061,2059,2058,2058,2057,2058,2057,2056,2053,2050,2045,2040,2034,2031,2032,2033,2034,2034,2034,2033,2033,2035,2040,2046,2050,2053,2055,2056,2056,2058,2063,2067,2070,2071,2070,2068,2065,2065,2065,2065,2063,2060,2058,2059,2062,2063,2060,2055,2053,2053,2054,2053,2053,2053,2054,2054,2052,2049,2047,2045,2044,2042,2041,2042,2041,2037,2035,2037,2040,2040,2043,2050,2057,2059,2056,2053,2051,2050,2048,2047,2046,2047,2048,2050,2051,2053,2053,2052,2050,2049,2051,2053,2056,2058,2058,2056,2054,2054,2055,2055,2054,2054,2056,2060,2062,2060,2055,2049,2044,2040,2040,2043,2044,2043,2042,2042,2043,2044,2045,2048,2050,2049,2044,2040,2038,2037,2036,2035,2034,2032,2031,2031,2029,2027,2026,2027,2031,2035,2038,2041,2045,2049,2054,2058,2062,2068,2071,2071,2070,2070,2070,2068,2065,2063,2061,2056,2048,2040,2030,2022,2019,2022,2027,2031,2031,2033,2037,2044,2050,2052,2051,2048,2046,2045,2045,2048,2049,2047,2044,2044,2048,2051,2052,2051,2050,2049,2050,2051,2054,2056,2056,2055,2054,2053,2052,2049,2047,2047,2049,2050,2052,2056,2062,2067,2069,2070,2071,2073,2074,2076,2077,2076,2075,2073,2072,2071,2070,2069,2068,2067,2067,2067,2065,2061,2056,2052,2050,2049,2050,2051,2052,2052,2051,2050,2054,2060,2063,2061,2061,2066,2072,2076,2079,2081,2084,2084,2083,2081,2078,2074,2070,2068,2066,2063,2059,2055,2055,2055,2056,2055,2059,2069,2079,2083,2081,2079,2080,2081,2078,2072,2069,2067,2065,2062,2058,2056,2057,2057,2055,2054,2055,2058,2060,2063,2062,2057,2049,2041,2034,2030,2029,2032,2035,2035,2034,2034,2035,2037,2040,2047,2053,2054,2052,2051,2054,2058,2060,2060,2060,2063,2068,2073,2077,2083,2087,2085,2079,2076,2076,2078,2079,2077,2072,2065,2062,2063,2066,2070,2072,2073,2072,2072,2071,2070,2068,2066,2064,2061,2056,2053,2050,2046,2042,2038,2036,2034,2031,2028,2028,2031,2035,2038,2039,2036,2032,2032,2035,2043,2051,2058,2063,2066,2070,2073,2073,2073,2073,2073,2073,2073,2073,2072,2069,2064,2060,2056,2054,2054,2053,2051,2050,2050,2046,2039,2032,2029,2031,2035,2040,2045,2050,2054,2058,2059,2060,2060,2059,2057,2056,2057,2055,2049,2042,2039,2039,2040,2038,2036,2035,2037,2042,2048,2052,2057,2063,2067,2067,2065,2066,2068,2069,2069,2068,2065,2059,2053,2049,2049,2050,2050,2049,2048,2044,2037,2032,2031,2033,2037,2038,2041,2045,2050,2052,2052,2053,2053,2052,2049,2048,2048,2048,2044,2040,2037,2040,2045,2048,2046,2045,2048,2053,2055,2053,2050,2048,2044,2041,2040,2039,2037,2034,2030,2027,2026,2028,2031,2033,2035,2037,2038,2038,2040,2041,2041,2037,2032,2029,2030,2035,2039,2040,2039,2036,2033,2034,2039,2043,2044,2040,2037,2039,2041,2039,2033,2026,2024,2024,2025,2025,2026,2030,2037,2044,2047,2048,2049,2047,2042,2038,2038,2044,2049,2052,2052,2052,2054,2058,2061,2063,2065,2069,2070,2068,2066,2067,2067,2064,2061,2062,2069,2073,2073,2069,2066,2061,2054,2047,2042,2038,2033,2030,2033,2037,2037,2033,2031,2034,2041,2047,2051,2054,2056,2062,2074,2086,2092,2089,2083,2076,2071,2070,2072,2073,2071,2068,2066,2063,2055,2045,2038,2033,2025,2017,2014,2021,2033,2043,2051,2059,2066,2071,2072,2069,2064,2058,2053,2049,2046,2042,2042,2045,2050,2052,2052,2054,2058,2062,2065,2067,2068,2068,2066,2063,2061,2059,2057,2056,2054,2054,2054,2055,2057,2061,2065,2064,2059,2056,2057,2058,2056,2055,2054,2050,2042,2034,2033,2034,2031,2028,2029,2032,2034,2035,2038,2039,2036,2033,2037,2042,2042,2037,2037,2046,2056,2059,2059,2058,2053,2045,2039,2043,2050,2051,2048,2048,2052,2054,2054,2052,2047,2040,2036,2039,2044,2045,2043,2044,2045,2044,2040,2039,2039,2039,2037,2039,2044,2049,2047,2042,2039,2041,2044,2046,2045,2045,2045,2045,2043,2041,2043,2047,2049,2048,2047,2050,2054,2057,2056,2055,2056,2058,2056,2053,2050,2048,2047,2046,2046,2047,2049,2050,2048,2045,2044,2049,2055,2057,2055,2053,2052,2048,2042,2038,2040,2044,2050,2059,2069,2076,2077,2077,2080,2083,2082,2079,2078,2081,2083,2080,2075,2073,2072,2071,2069,2068,2068,2066,2066,2067,2068,2064,2054,2044,2038,2037,2040,2043,2046,2044,2039,2035,2038,2048,2057,2061,2062,2066,2073,2079,2085,2091,2096,2099,2100,2100,2096,2092,2090,2090,2087,2076,2062,2054,2052,2054,2058,2067,2078,2085,2086,2086,2084,2078,2066,2053,2048,2049,2050,2048,2047,2050,2057,2063,2064,2061,2057,2053,2053,2057,2063,2065,2063,2057,2054,2057,2062,2065,2065,2063,2062,2065,2073,2082,2084,2081,2078,2075,2070,2064,2065,2073,2079,2076,2071,2069,2068,2064,2058,2056,2058,2057,2056,2059,2062,2061,2061,2067,2076,2079,2075,2074,2075,2069,2053,2040,2039,2047,2054,2059,2062,2059,2048,2037,2031,2029,2026,2024,2027,2033,2039,2045,2058,2071,2075,2069,2060,2054,2052,2055,2065,2076,2080,2077,2073,2074,2076,2076,2075,2075,2077,2081,2085,2084,2075,2061,2048,2041,2040,2040,2037,2034,2036,2048,2064,2074,2076,2073,2068,2063,2060,2060,2063,2068,2071,2071,2066,2057,2049,2046,2047,2049,2047,2042,2039,2040,2045,2050,2053,2051,2045,2038,2031,2025,2020,2019,2022,2024,2025,2026,2030,2033,2032,2030,2028,2023,2012,2002,2002,2006,2006,2006,2013,2023,2026,2021,2017,2016,2015,2017,2021,2022,2019,2015,2012,2010,2010,2018,2034,2042,2031,2011,2000,2000,2002,2000,2003,2009,2009,2004,2009,2034,2062,2067,2044,2010,1987,1979,1984,2001,2022,2040,2050,2054,2050,2037,2025,2019,2019,2019,2022,2029,2037,2038,2033,2029,2028,2028,2027,2032,2040,2044,2041,2037,2038,2038,2031,2021,2016,2022,2034,2045,2050,2049,2049,2054,2061,2065,2065,2061,2054,2044,2038,2041,2052,2063,2070,2078,2088,2092,2086,2076,2070,2071,2073,2074,2071,2067,2064,2067,2076,2086,2093,2097,2098,2095,2090,2086,2081,2074,2061,2048,2042,2046,2054,2060,2065,2073,2081,2086,2094,2106,2113,2104,2083,2063,2051,2046,2045,2049,2056,2061,2066,2074,2080,2078,2068,2060,2059,2059,2057,2063,2079,2095,2101,2100,2103,2105,2098,2084,2073,2066,2062,2060,2066,2074,2077,2077,2082,2090,2092,2087,2080,2075,2070,2065,2061,2060,2063,2068,2071,2067,2061,2060,2064,2066,2066,2070,2080,2088,2089,2083,2076,2074,2077,2086,2096,2105,2112,2116,2115,2111,2107,2102,2098,2093,2087,2083,2083,2082,2072,2061,2070,2100,2126,2133,2140,2161,2180,2173,2150,2130,2106,2066,2026,2016,2030,2042,2044,2047,2049,2043,2037,2040,2050,2061,2075,2095,2112,2117,2112,2108,2107,2104,2102,2107,2117,2124,2122,2116,2117,2129,2136,2129,2112,2097,2088,2082,2080,2082,2081,2072,2062,2054,2044,2031,2020,2014,2008,2001,2000,2006,2013,2023,2037,2049,2049,2042,2044,2055,2064,2066,2069,2075,2081,2081,2080,2078,2075,2074,2076,2077,2071,2059,2049,2043,2044,2051,2058,2059,2055,2048,2045,2042,2038,2034,2033,2038,2046,2050,2047,2042,2038,2037,2037,2037,2040,2046,2051,2055,2058,2061,2062,2060,2058,2056,2053,2050,2049,2049,2051,2054,2055,2051,2043,2036,2035,2035,2030,2020,2014,2014,2018,2021,2023,2026,2027,2025,2025,2028,2028,2023,2020,2025,2035,2045,2057,2072,2083,2085,2080,2073,2065,2055,2044,2037,2034,2032,2033,2038,2045,2045,2037,2023,2012,2005,2002,2002,2004,2008,2012,2015,2020,2028,2039,2048,2051,2049,2042,2033,2024,2020,2022,2025,2026,2022,2021,2026,2033,2035,2032,2029,2032,2036,2036,2036,2037,2038,2036,2035,2038,2042,2041,2037,2037,2039,2033,2022,2017,2020,2025,2032,2048,2069,2083,2090,2102,2115,2117,2105,2094,2090,2079,2058,2033,2016,2010,2013,2022,2026,2024,2021,2026,2033,2038,2043,2052,2057,2057,2061,2071,2082,2092,2104,2120,2136,2150,2159,2160,2151,2139,2123,2099,2070,2049,2043,2046,2055,2071,2092,2105,2103,2094,2085,2081,2083,2087,2088,2084,2086,2092,2093,2089,2091,2098,2104,2106,2112,2117,2111,2100,2097,2100,2097,2090,2090,2096,2097,2089,2081,2072,2060,2050,2047,2050,2054,2061,2066,2068,2069,2074,2080,2087,2095,2107,2115,2112,2104,2094,2084,2072,2062,2057,2056,2056,2058,2061,2059,2054,2052,2056,2060,2061,2060,2060,2057,2056,2056,2059,2061,2062,2065,2072,2079,2079,2071,2059,2054,2057,2063,2066,2066,2068,2069,2070,2068,2062,2052,2043,2040,2043,2049,2055,2062,2065,2063,2057,2046,2034,2023,2017,2015,2017,2024,2035,2046,2050,2047,2041,2034,2029,2029,2035,2044,2049,2047,2043,2043,2049,2056,2058,2054,2049,2047,2047,2049,2051,2049,2045,2045,2053,2063,2071,2077,2080,2080,2080,2085,2088,2080,2065,2055,2052,2052,2050,2051,2060,2070,2075,2074,2067,2060,2057,2058,2057,2049,2045,2050,2060,2069,2075,2083,2092,2097,2098,2097,2094,2085,2074,2066,2064,2064,2060,2056,2054,2055,2055,2053,2053,2054,2053,2055,2062,2075,2086,2091,2090,2086,2079,2071,2063,2058,2060,2067,2071,2069,2063,2059,2056,2053,2052,2055,2059,2057,2050,2044,2046,2053,2056,2053,2049,2049,2048,2045,2044,2047,2049,2047,2046,2049,2052,2052,2056,2064,2072,2075,2075,2074,2070,2064,2062,2062,2058,2050,2046,2053,2064,2073,2079,2081,2081,2079,2079,2077,2070,2060,2057,2060,2063,2061,2058,2058,2067,2078,2083,2079,2070,2066,2067,2071,2073,2075,2076,2077,2074,2071,2069,2068,2069,2070,2072,2079,2090,2099,2101,2096,2084,2071,2062,2059,2059,2058,2058,2061,2063,2062,2059,2059,2061,2062,2057,2052,2048,2045,2042,2042,2045,2052,2061,2069,2072,2072,2071,2067,2061,2055,2051,2048,2045,2043,2045,2048,2051,2052,2055,2063,2073,2079,2078,2071,2067,2069,2077,2087,2090,2083,2071,2063,2063,2064,2061,2058,2059,2063,2067,2071,2075,2078,2074,2064,2053,2048,2054,2066,2075,2076,2071,2066,2061,2060,2066,2078,2087,2088,2082,2070,2057,2047,2040,2034,2027,2024,2028,2034,2038,2042,2050,2057,2059,2055,2050,2048,2052,2060,2065,2069,2071,2074,2073,2068,2060,2054,2050,2048,2046,2043,2041,2038,2034,2028,2026,2032,2045,2057,2068,2082,2093,2095,2086,2075,2066,2058,2052,2048,2045,2042,2042,2045,2044,2036,2026,2023,2026,2032,2038,2046,2050,2047,2043,2042,2043,2043,2042,2042,2043,2049,2056,2060,2062,2065,2071,2072,2063,2050,2039,2032,2032,2036,2043,2047,2045,2039,2032,2028,2030,2033,2033,2032,2035,2044,2052,2058,2062,2067,2066,2062,2056,2050,2046,2047,2053,2059,2059,2056,2052,2046,2037,2027,2020,2019,2025,2037,2053,2066,2074,2076,2074,2069,2066,2066,2065,2063,2063,2066,2069,2067,2064,2062,2060,2060,2063,2069,2074,2072,2067,2064,2065,2066,2064,2059,2052,2048,2049,2056,2066,2073,2070,2063,2059,2066,2077,2086,2088,2086,2081,2077,2079,2084,2084,2075,2062,2055,2057,2064,2071,2077,2082,2086,2088,2089,2089,2089,2089,2089,2090,2091,2091,2089,2086,2083,2079,2072,2064,2059,2060,2063,2064,2065,2069,2073,2076,2077,2078,2079,2077,2073,2068,2065,2065,2071,2078,2085,2089,2088,2084,2079,2079,2082,2087,2092,2097,2098,2090,2078,2071,2075,2084,2090,2090,2087,2080,2067,2050,2036,2029,2028,2029,2030,2031,2032,2035,2043,2059,2075,2082,2078,2071,2065,2057,2049,2043,2041,2038,2035,2037,2046,2054,2058,2060,2063,2069,2076,2080,2080,2077,2073,2072,2073,2074,2078,2082,2084,2079,2070,2060,2051,2049,2052,2056,2055,2052,2047,2042,2035,2031,2030,2032,2034,2041,2056,2073,2085,2087,2082,2076,2072,2067,2063,2060,2060,2061,2060,2057,2056,2056,2057,2057,2055,2050,2044,2042,2047,2055,2064,2070,2074,2076,2074,2071,2065,2059,2055,2054,2054,2051,2048,2046,2045,2043,2043,2047,2052,2056,2057,2059,2061,2061,2062,2065,2068,2066,2062,2062,2066,2067,2061,2047,2031,2016,2008,2006,2007,2008,2008,2011,2016,2021,2023,2024,2025,2026,2026,2025,2026,2031,2040,2051,2061,2066,2066,2063,2061,2060,2059,2057,2056,2058,2060,2059,2057,2056,2057,2056,2053,2050,2049,2049,2045,2036,2027,2023,2025,2027,2027,2027,2030,2035,2043,2055,2067,2071,2070,2068,2069,2068,2067,2069,2075,2081,2084,2086,2087,2083,2076,2067,2059,2053,2048,2045,2042,2042,2047,2057,2067,2072,2073,2075,2081,2087,2091,2089,2083,2076,2067,2057,2048,2044,2046,2053,2064,2074,2083,2091,2095,2092,2083,2076,2078,2087,2096,2102,2106,2109,2109,2108,2107,2104,2096,2088,2086,2090,2094,2096,2100,2104,2105,2102,2097,2091,2082,2075,2074,2078,2084,2088,2089,2089,2089,2090,2088,2084,2078,2072,2067,2066,2072,2081,2083,2075,2063,2059,2064,2073,2082,2091,2097,2096,2088,2077,2071,2068,2063,2055,2051,2054,2061,2070,2081,2092,2101,2106,2110,2113,2116,2117,2116,2111,2103,2091,2077,2060,2045,2033,2026,2028,2040,2055,2065,2062,2050,2038,2036,2042,2050,2054,2055,2055,2056,2060,2063,2064,2063,2064,2069,2071,2065,2057,2053,2055,2059,2059,2053,2045,2040,2036,2032,2029,2028,2031,2037,2043,2049,2051,2051,2054,2060,2067,2074,2077,2075,2068,2059,2054,2053,2051,2046,2044,2047,2055,2064,2073,2079,2081,2077,2069,2061,2057,2056,2057,2056,2056,2058,2061,2060,2051,2041,2037,2040,2046,2056,2065,2071,2071,2068,2064,2059,2057,2060,2063,2060,2056,2055,2057,2055,2050,2048,2048,2047,2046,2046,2045,2043,2043,2048,2056,2062,2064,2062,2058,2055,2052,2048,2042,2040,2044,2049,2053,2054,2053,2051,2050,2054,2058,2059,2060,2066,2074,2078,2077,2074,2071,2070,2071,2074,2073,2066,2056,2049,2048,2051,2054,2053,2048,2044,2044,2045,2041,2032,2020,2013,2013,2017,2022,2030,2038,2042,2039,2034,2032,2029,2026,2023,2024,2026,2027,2030,2037,2046,2053,2055,2052,2046,2041,2041,2045,2047,2042,2032,2025,2022,2021,2020,2020,2023,2025,2026,2024,2019,2016,2022,2034,2044,2043,2034,2027,2025,2028,2035,2041,2044,2044,2043,2042,2046,2055,2062,2062,2057,2050,2047,2048,2050,2051,2051,2052,2053,2056,2061,2064,2063,2059,2058,2060,2061,2060,2058,2060,2063,2064,2059,2051,2045,2046,2053,2061,2069,2076,2081,2083,2082,2080,2072,2061,2055,2054,2057,2060,2063,2062,2060,2064,2076,2091,2099,2103,2105,2105,2105,2108,2113,2119,2124,2130,2133,2131,2122,2114,2110,2110,2107,2099,2088,2082,2080,2081,2083,2088,2094,2098,2099,2100,2107,2118,2130,2140,2142,2133,2119,2107,2103,2103,2104,2104,2105,2103,2099,2099,2105,2114,2122,2128,2133,2137,2138,2135,2131,2128,2128,2129,2127,2122,2113,2103,2095,2089,2088,2090,2093,2096,2100,2103,2102,2098,2095,2093,2092,2090,2088,2088,2087,2084,2079,2072,2066,2063,2062,2063,2063,2064,2070,2083,2098,2111,2115,2112,2108,2104,2098,2087,2073,2063,2062,2069,2077,2082,2078,2064,2046,2034,2035,2041,2044,2039,2035,2034,2037,2042,2043,2038,2029,2023,2025,2032,2039,2044,2046,2048,2053,2059,2062,2060,2058,2055,2048,2041,2040,2044,2049,2054,2061,2068,2069,2062,2051,2041,2035,2034,2036,2037,2038,2041,2044,2047,2048,2050,2053,2057,2061,2064,2064,2062,2056,2047,2037,2029,2021,2016,2014,2015,2016,2016,2015,2012,2006,2000,1998,2000,2002,2005,2012,2020,2027,2029,2029,2029,2031,2038,2047,2051,2047,2040,2035,2034,2035,2036,2038,2035,2030,2028,2031,2029,2021,2018,2025,2034,2033,2026,2024,2029,2036,2044,2053,2055,2046,2034,2026,2025,2026,2028,2030,2028,2024,2022,2025,2034,2041,2045,2042,2037,2034,2034,2035,2036,2037,2038,2038,2036,2033,2033,2036,2040,2042,2045,2051,2059,2064,2068,2069,2066,2060,2054,2050,2049,2051,2052,2050,2044,2039,2038,2038,2034,2029,2026,2028,2035,2048,2059,2066,2070,2072,2073,2075,2079,2083,2084,2082,2080,2078,2074,2064,2053,2042,2033,2028,2030,2037,2045,2048,2048,2047,2051,2057,2061,2064,2071,2078,2082,2081,2079,2079,2076,2072,2067,2063,2059,2056,2055,2058,2059,2058,2058,2064,2072,2076,2073,2069,2071,2081,2094,2103,2107,2105,2099,2089,2078,2071,2068,2061,2052,2048,2052,2058,2063,2068,2076,2082,2087,2094,2101,2102,2098,2095,2101,2109,2113,2112,2110,2112,2115,2115,2111,2103,2094,2086,2083,2084,2088,2091,2093,2092,2088,2084,2082,2079,2076,2076,2081,2085,2084,2081,2083,2090,2096,2098,2098,2095,2090,2086,2085,2084,2084,2087,2092,2099,2106,2110,2111,2109,2107,2106,2105,2104,2104,2105,2108,2110,2108,2100,2092,2085,2078,2069,2060,2054,2053,2058,2065,2075,2085,2095,2101,2099,2089,2078,2067,2058,2053,2053,2056,2059,2061,2066,2070,2071,2071,2074,2079,2083,2084,2088,2097,2107,2112,2109,2100,2087,2072,2059,2054,2055,2062,2070,2075,2076,2074,2072,2068,2063,2056,2054,2058,2065,2071,2073,2071,2067,2065,2067,2070,2068,2063,2057,2056,2058,2060,2059,2057,2058,2062,2067,2071,2070,2062,2056,2057,2065,2071,2072,2068,2063,2059,2055,2055,2057,2059,2062,2065,2067,2069,2069,2065,2058,2053,2054,2061,2066,2067,2067,2066,2064,2059,2056,2059,2065,2070,2071,2071,2072,2076,2080,2082,2081,2080,2079,2078,2077,2071,2058,2043,2029,2022,2022,2025,2025,2024,2024,2030,2039,2048,2056,2063,2065,2062,2054,2047,2043,2044,2048,2056,2067,2077,2079,2072,2061,2052,2049,2054,2065,2072,2072,2067,2067,2073,2080,2084,2088,2089,2085,2073,2058,2047,2043,2041,2037,2032,2025,2020,2018,2020,2026,2033,2041,2048,2055,2059,2060,2058,2054,2048,2042,2039,2040,2045,2051,2055,2056,2056,2058,2061,2065,2067,2067,2066,2063,2059,2056,2055,2058,2061,2059,2055,2054,2055,2055,2049,2043,2040,2041,2043,2044,2046,2050,2054,2057,2057,2055,2048,2040,2035,2034,2035,2037,2038,2041,2046,2051,2053,2053,2053,2055,2056,2055,2048,2040,2033,2029,2027,2026,2031,2039,2046,2049,2051,2055,2060,2062,2059,2054,2051,2051,2055,2060,2064,2066,2068,2071,2074,2075,2075,2073,2069,2064,2059,2057,2057,2060,2061,2060,2057,2052,2048,2043,2040,2038,2035,2031,2026,2023,2026,2035,2047,2057,2064,2067,2067,2064,2059,2054,2050,2045,2038,2032,2033,2042,2053,2061,2063,2060,2058,2056,2055,2052,2050,2049,2049,2052,2058,2064,2069,2069,2066,2064,2063,2064,2065,2066,2066,2066,2063,2058,2052,2045,2040,2037,2036,2036,2038,2040,2042,2043,2042,2043,2047,2052,2054,2055,2059,2066,2072,2074,2072,2071,2072,2073,2073,2073,2073,2074,2075,2076,2075,2073,2070,2066,2062,2056,2050,2046,2045,2049,2055,2064,2071,2074,2072,2067,2063,2061,2058,2053,2045,2038,2034,2033,2035,2036,2036,2036,2040,2048,2058,2065,2068,2071,2078,2087,2096,2100,2101,2103,2105,2105,2100,2093,2092,2095,2094,2082,2068,2061,2065,2073,2081,2089,2097,2102,2099,2087,2071,2060,2057,2061,2067,2069,2069,2065,2059,2053,2052,2056,2061,2061,2057,2053,2051,2052,2053,2053,2053,2054,2059,2068,2076,2079,2077,2076,2076,2076,2072,2065,2057,2052,2049,2048,2048,2049,2048,2044,2036,2026,2019,2016,2016,2014,2010,2006,2007,2013,2022,2033,2044,2051,2055,2056,2053,2051,2051,2055,2061,2066,2067,2069,2069,2067,2062,2058,2053,2048,2043,2043,2048,2055,2060,2064,2067,2067,2064,2059,2052,2045,2039,2034,2031,2027,2022,2019,2020,2023,2026,2030,2036,2045,2054,2060,2063,2062,2061,2061,2061,2060,2060,2058,2054,2048,2042,2040,2040,2043,2047,2051,2054,2055,2056,2057,2057,2053,2047,2042,2043,2047,2052,2056,2061,2064,2065,2065,2066,2069,2072,2075,2078,2079,2078,2074,2071,2070,2069,2067,2063,2057,2052,2050,2053,2056,2058,2057,2055,2051,2044,2038,2038,2045,2055,2064,2069,2070,2069,2068,2065,2059,2052,2051,2056,2062,2062,2059,2057,2058,2062,2066,2071,2073,2074,2074,2071,2067,2065,2067,2075,2082,2084,2083,2083,2085,2085,2079,2069,2062,2061,2064,2065,2062,2056,2050,2046,2044,2045,2047,2052,2057,2063,2069,2076,2082,2086,2085,2080,2076,2075,2079,2086,2092,2093,2091,2087,2086,2087,2087,2085,2084,2084,2084,2080,2075,2068,2062,2055,2048,2041,2034,2029,2028,2030,2030,2030,2034,2041,2047,2049,2048,2052,2061,2069,2073,2074,2073,2071,2067,2064,2064,2066,2070,2075,2080,2080,2077,2076,2075,2072,2066,2064,2065,2066,2064,2062,2062,2061,2059,2059,2059,2058,2058,2063,2071,2079,2083,2086,2089,2087,2082,2078,2077,2079,2080,2080,2076,2065,2048,2034,2029,2030,2036,2042,2046,2048,2048,2049,2051,2054,2055,2057,2059,2059,2060,2063,2068,2074,2079,2084,2087,2087,2085,2081,2079,2076,2071,2065,2058,2050,2039,2030,2023,2019,2016,2015,2015,2017,2017,2015,2015,2017,2022,2028,2034,2039,2044,2051,2058,2064,2067,2065,2059,2052,2050,2055,2062,2065,2066,2068,2073,2075,2073,2072,2077,2084,2087,2086,2085,2082,2076,2063,2046,2027,2013,2005,1999,1994,1993,1997,2003,2009,2016,2025,2035,2046,2057,2065,2070,2070,2068,2066,2065,2061,2054,2047,2044,2047,2054,2061,2067,2071,2073,2073,2069,2067,2067,2070,2071,2066,2057,2047,2040,2040,2045,2054,2063,2070,2073,2071,2069,2072,2078,2080,2075,2065,2054,2048,2051,2061,2073,2079,2080,2080,2080,2080,2079,2077,2075,2072,2070,2068,2068,2067,2063,2054,2044,2036,2029,2021,2014,2012,2019,2035,2050,2055,2053,2052,2058,2067,2072,2071,2068,2063,2058,2055,2058,2067,2076,2084,2089,2086,2077,2066,2062,2063,2062,2058,2055,2057,2063,2070,2076,2077,2072,2064,2055,2047,2041,2040,2046,2055,2066,2076,2080,2078,2072,2069,2073,2077,2076,2069,2063,2059,2057,2053,2050,2047,2041,2030,2019,2014,2016,2025,2036,2047,2054,2058,2060,2066,2075,2082,2087,2089,2093,2095,2095,2093,2089,2085,2082,2081,2081,2080,2080,2082,2083,2079,2070,2060,2052,2050,2052,2055,2057,2057,2058,2062,2070,2079,2088,2092,2089,2082,2075,2070,2068,2064,2060,2055,2051,2046,2042,2039,2040,2046,2054,2062,2070,2079,2087,2094,2100,2106,2113,2120,2121,2114,2102,2090,2081,2072,2062,2051,2045,2046,2052,2058,2062,2063,2062,2060,2058,2060,2064,2067,2067,2064,2063,2066,2073,2079,2080,2079,2076,2071,2064,2061,2061,2061,2059,2055,2053,2053,2054,2052,2048,2046,2047,2050,2051,2048,2045,2046,2050,2055,2060,2064,2064,2060,2054,2049,2045,2042,2042,2044,2046,2043,2038,2035,2036,2039,2040,2040,2038,2037,2037,2040,2047,2056,2063,2066,2066,2066,2064,2060,2052,2042,2031,2023,2018,2014,2010,2007,2007,2010,2015,2023,2033,2042,2044,2041,2037,2034,2034,2032,2028,2021,2016,2019,2027,2034,2037,2037,2037,2036,2037,2041,2050,2058,2064,2063,2055,2041,2028,2019,2013,2010,2010,2011,2010,2011,2019,2033,2045,2050,2048,2043,2035,2028,2026,2030,2033,2033,2032,2031,2029,2025,2021,2019,2019,2025,2034,2038,2034,2027,2023,2023,2025,2027,2031,2035,2041,2049,2057,2062,2063,2063,2064,2066,2070,2076,2082,2088,2092,2094,2092,2085,2072,2056,2038,2021,2008,2002,2003,2009,2015,2016,2012,2007,2007,2014,2026,2040,2057,2071,2079,2083,2086,2088,2087,2083,2075,2064,2051,2038,2030,2028,2030,2037,2044,2051,2056,2061,2064,2066,2065,2061,2055,2048,2041,2037,2033,2030,2032,2040,2049,2054,2056,2059,2062,2063,2062,2063,2066,2069,2071,2069,2064,2059,2060,2063,2066,2065,2060,2052,2047,2049,2056,2063,2067,2070,2074,2077,2077,2078,2080,2081,2080,2081,2088,2097,2100,2095,2084,2072,2067,2069,2069,2063,2055,2053,2056,2061,2069,2080,2088,2089,2084,2079,2074,2068,2059,2053,2051,2054,2058,2060,2061,2061,2059,2057,2057,2062,2070,2078,2083,2083,2077,2069,2064,2066,2075,2083,2088,2089,2085,2076,2064,2055,2052,2052,2052,2054,2056,2058,2060,2062,2062,2060,2060,2065,2072,2077,2076,2073,2069,2066,2063,2058,2056,2058,2059,2056,2050,2045,2043,2044,2046,2050,2058,2070,2084,2096,2102,2103,2101,2097,2093,2091,2090,2090,2088,2084,2078,2070,2062,2055,2051,2048,2045,2041,2040,2038,2037,2038,2042,2047,2052,2057,2061,2066,2073,2082,2091,2097,2098,2097,2094,2089,2082,2074,2066,2059,2051,2044,2039,2037,2036,2035,2033,2028,2023,2021,2023,2024,2027,2032,2037,2042,2046,2051,2058,2067,2074,2077,2077,2077,2080,2080,2081,2082,2084,2083,2079,2074,2068,2058,2048,2041,2038,2035,2030,2025,2021,2019,2020,2025,2031,2034,2033,2035,2040,2044,2044,2045,2049,2053,2055,2055,2053,2052,2053,2055,2054,2049,2042,2035,2028,2020,2017,2019,2025,2030,2033,2034,2037,2041,2046,2049,2050,2050,2050,2050,2050,2050,2049,2047,2043,2040,2040,2042,2042,2041,2041,2040,2038,2034,2030,2030,2033,2038,2041,2041,2044,2049,2052,2052,2048,2042,2035,2030,2027,2028,2032,2036,2039,2039,2036,2033,2032,2033,2032,2033,2035,2039,2040,2035,2029,2023,2021,2022,2027,2033,2037,2038,2039,2043,2048,2054,2059,2060,2058,2056,2054,2052,2050,2046,2042,2039,2039,2041,2043,2045,2046,2047,2046,2043,2037,2034,2035,2039,2042,2046,2052,2058,2061,2062,2062,2058,2051,2044,2042,2046,2051,2053,2054,2056,2058,2058,2056,2054,2052,2049,2047,2046,2048,2050,2052,2052,2051,2051,2053,2054,2054,2055,2057,2060,2064,2064,2061,2057,2054,2056,2061,2067,2071,2071,2071,2071,2069,2064,2058,2055,2054,2054,2054,2056,2059,2060,2060,2061,2062,2062,2062,2060,2058,2056,2053,2052,2052,2052,2055,2062,2072,2078,2082,2086,2092,2095,2095,2093,2090,2084,2076,2071,2069,2067,2063,2060,2059,2059,2059,2061,2063,2064,2059,2052,2048,2047,2050,2055,2063,2072,2078,2081,2082,2084,2087,2089,2088,2085,2085,2089,2095,2100,2103,2105,2104,2102,2098,2091,2083,2072,2059,2047,2039,2038,2042,2052,2068,2083,2092,2095,2096,2094,2089,2079,2069,2064,2063,2064,2067,2072,2075,2073,2067,2064,2063,2065,2065,2063,2059,2057,2059,2064,2069,2073,2078,2084,2087,2086,2082,2075,2067,2059,2052,2045,2043,2046,2050,2052,2051,2050,2050,2053,2057,2060,2061,2063,2065,2070,2075,2077,2075,2068,2057,2047,2042,2041,2040,2036,2029,2024,2024,2030,2040,2048,2050,2047,2044,2047,2054,2064,2071,2072,2069,2061,2053,2047,2045,2045,2046,2045,2043,2041,2042,2045,2051,2055,2058,2058,2058,2057,2054,2049,2046,2050,2058,2064,2064,2059,2051,2045,2044,2046,2049,2050,2049,2045,2040,2037,2038,2042,2046,2048,2049,2049,2047,2044,2040,2037,2037,2043,2050,2055,2058,2058,2059,2059,2058,2054,2050,2049,2049,2047,2044,2041,2039,2043,2049,2053,2052,2048,2045,2045,2047,2049,2049,2046,2040,2033,2028,2026,2026,2026,2027,2027,2023,2017,2013,2015,2021,2025,2027,2029,2033,2039,2044,2048,2049,2045,2038,2033,2032,2030,2026,2022,2019,2015,2014,2020,2032,2045,2052,2054,2055,2059,2064,2067,2062,2053,2042,2033,2029,2028,2029,2031,2034,2037,2041,2046,2051,2054,2055,2055,2056,2057,2057,2055,2054,2053,2053,2053,2053,2051,2047,2045,2043,2045,2048,2049,2049,2047,2046,2044,2042,2039,2036,2032,2029,2026,2024,2023,2022,2022,2025,2030,2036,2039,2042,2047,2055,2062,2068,2071,2074,2076,2072,2061,2047,2036,2028,2021,2015,2013,2014,2019,2027,2035,2043,2051,2059,2066,2070,2072,2075,2078,2079,2078,2077,2078,2078,2076,2070,2065,2062,2061,2059,2058,2057,2055,2051,2046,2040,2035,2029,2022,2018,2019,2026,2036,2046,2056,2065,2073,2082,2090,2096,2096,2094,2091,2088,2087,2085,2082,2079,2077,2074,2073,2074,2073,2070,2064,2056,2050,2046,2045,2048,2051,2054,2058,2063,2069,2073,2077,2081,2085,2088,2089,2088,2086,2084,2081,2077,2072,2069,2068,2068,2069,2069,2068,2067,2064,2060,2056,2053,2051,2049,2047,2046,2045,2044,2044,2044,2045,2048,2050,2053,2055,2059,2062,2066,2068,2072,2075,2076,2074,2068,2060,2051,2044,2043,2047,2053,2062,2070,2077,2081,2078,2071,2065,2061,2062,2065,2069,2071,2071,2069,2069,2068,2065,2060,2056,2055,2056,2054,2049,2045,2043,2042,2038,2032,2028,2028,2034,2042,2047,2047,2044,2040,2038,2039,2040,2042,2045,2049,2051,2052,2051,2050,2047,2044,2043,2043,2046,2047,2048,2050,2052,2052,2050,2048,2049,2051,2053,2058,2062,2064,2061,2054,2045,2038,2032,2030,2029,2031,2036,2043,2050,2056,2059,2057,2053,2045,2035,2025,2017,2014,2018,2024,2032,2040,2045,2048,2050,2052,2057,2061,2066,2070,2073,2072,2066,2056,2048,2044,2044,2045,2046,2047,2046,2045,2042,2040,2040,2041,2040,2038,2037,2039,2041,2043,2045,2046,2048,2048,2046,2042,2040,2041,2044,2049,2057,2065,2073,2077,2078,2079,2079,2077,2073,2068,2063,2057,2050,2042,2036,2035,2035,2035,2036,2040,2045,2049,2049,2044,2035,2025,2018,2015,2014,2013,2011,2010,2009,2010,2012,2018,2027,2036,2044,2050,2056,2061,2064,2065,2064,2062,2060,2059,2058,2058,2056,2054,2054,2056,2056,2052,2044,2035,2026,2020,2019,2023,2030,2036,2041,2045,2050,2055,2059,2061,2061,2059,2058,2058,2059,2060,2059,2058,2059,2066,2076,2084,2087,2086,2082,2076,2069,2062,2055,2048,2043,2041,2041,2039,2036,2032,2028,2025,2023,2024,2030,2039,2048,2055,2057,2054,2049,2045,2045,2048,2052,2055,2060,2064,2067,2068,2067,2063,2057,2052,2051,2054,2059,2061,2058,2054,2049,2047,2047,2046,2046,2048,2053,2061,2069,2078,2086,2090,2089,2083,2076,2070,2065,2063,2063,2066,2068,2069,2069,2068,2066,2063,2059,2054,2049,2045,2039,2034,2030,2029,2029,2032,2036,2044,2053,2061,2065,2069,2074,2080,2084,2084,2083,2081,2077,2071,2064,2061,2064,2070,2073,2069,2062,2055,2050,2048,2047,2048,2052,2059,2066,2071,2076,2081,2084,2082,2079,2078,2080,2080,2077,2072,2068,2064,2063,2065,2071,2076,2078,2074,2067,2060,2055,2054,2054,2054,2054,2055,2057,2060,2061,2058,2055,2051,2049,2048,2047,2046,2046,2046,2048,2051,2052,2051,2048,2047,2049,2054,2062,2070,2078,2083,2086,2087,2088,2091,2091,2084,2068,2052,2042,2040,2042,2047,2055,2062,2068,2074,2079,2082,2082,2078,2070,2062,2056,2056,2059,2062,2063,2063,2063,2065,2067,2064,2052,2035,2019,2011,2010,2014,2022,2032,2041,2047,2050,2052,2054,2058,2060,2060,2058,2056,2055,2054,2053,2054,2056,2056,2054,2051,2045,2039,2033,2027,2024,2024,2028,2034,2040,2045,2048,2049,2048,2049,2052,2056,2058,2058,2058,2060,2063,2065,2069,2071,2072,2073,2074,2075,2075,2072,2066,2057,2050,2045,2042,2041,2037,2031,2023,2016,2014,2012,2009,2006,2007,2014,2026,2038,2048,2052,2052,2053,2054,2057,2061,2067,2070,2068,2062,2057,2054,2053,2050,2048,2046,2043,2038,2033,2031,2030,2029,2026,2022,2020,2019,2019,2019,2021,2021,2019,2014,2012,2016,2026,2037,2046,2052,2056,2056,2053,2049,2047,2046,2047,2048,2047,2043,2037,2034,2033,2035,2035,2036,2037,2040,2041,2040,2039,2039,2038,2037,2037,2037,2037,2035,2033,2031,2031,2033,2037,2043,2048,2050,2050,2049,2047,2047,2048,2049,2050,2049,2048,2045,2043,2041,2041,2043,2045,2047,2049,2052,2054,2056,2056,2055,2054,2052,2049,2047,2046,2047,2047,2045,2042,2041,2042,2044,2047,2050,2053,2055,2057,2057,2056,2053,2050,2050,2053,2057,2060,2061,2059,2057,2055,2055,2057,2059,2061,2061,2062,2062,2063,2062,2059,2055,2052,2052,2053,2054,2056,2056,2056,2056,2056,2058,2059,2061,2063,2065,2067,2069,2070,2070,2070,2070,2069,2065,2061,2059,2057,2056,2054,2051,2047,2045,2047,2053,2060,2067,2072,2074,2075,2076,2078,2080,2082,2084,2087,2089,2090,2087,2081,2071,2062,2054,2050,2049,2051,2055,2057,2055,2052,2049,2048,2049,2051,2055,2060,2063,2063,2058,2050,2041,2035,2032,2031,2035,2041,2045,2049,2054,2061,2067,2072,2075,2077,2077,2079,2079,2077,2076,2078,2082,2083,2078,2070,2060,2052,2045,2040,2036,2035,2035,2038,2041,2042,2041,2042,2043,2043,2045,2050,2055,2058,2056,2052,2048,2047,2048,2049,2050,2053,2060,2066,2069,2067,2060,2051,2044,2037,2030,2023,2019,2018,2019,2022,2028,2036,2043,2049,2056,2062,2066,2067,2066,2062,2056,2048,2041,2036,2034,2036,2038,2040,2040,2042,2046,2049,2051,2052,2055,2056,2051,2044,2039,2036,2032,2026,2020,2017,2019,2023,2025,2026,2028,2031,2035,2037,2036,2034,2030,2026,2024,2024,2030,2040,2047,2048,2045,2046,2051,2058,2063,2064,2062,2059,2056,2055,2053,2050,2047,2048,2050,2053,2053,2049,2043,2034,2026,2022,2024,2030,2039,2048,2053,2056,2055,2052,2048,2041,2034,2029,2026,2025,2025,2025,2028,2034,2040,2044,2044,2044,2045,2049,2054,2056,2055,2053,2054,2056,2059,2060,2061,2062,2061,2061,2061,2060,2060,2058,2056,2054,2053,2052,2051,2051,2050,2049,2047,2046,2047,2049,2052,2055,2058,2062,2065,2066,2065,2063,2061,2057,2052,2050,2050,2052,2053,2052,2051,2049,2047,2045,2046,2050,2054,2058,2059,2057,2052,2047,2042,2039,2036,2034,2034,2034,2033,2033,2037,2044,2050,2054,2055,2056,2057,2060,2062,2063,2063,2063,2062,2063,2066,2069,2070,2070,2068,2064,2060,2056,2053,2053,2055,2058,2062,2064,2065,2064,2061,2058,2057,2056,2056,2057,2058,2058,2056,2055,2055,2054,2053,2053,2053,2053,2052,2053,2058,2063,2069,2073,2078,2079,2077,2073,2068,2061,2052,2046,2042,2042,2047,2055,2061,2065,2068,2070,2071,2071,2069,2064,2057,2052,2051,2052,2054,2056,2057,2059,2064,2073,2081,2084,2082,2079,2078,2078,2077,2076,2073,2070,2067,2065,2061,2054,2044,2037,2032,2031,2033,2037,2041,2040,2037,2035,2037,2041,2044,2044,2043,2043,2044,2046,2051,2060,2071,2078,2083,2088,2092,2095,2096,2095,2090,2081,2069,2057,2047,2039,2034,2032,2032,2034,2037,2041,2045,2048,2048,2046,2044,2044,2041,2036,2029,2028,2033,2041,2048,2050,2051,2052,2053,2055,2057,2057,2053,2048,2043,2041,2041,2045,2050,2054,2056,2055,2055,2055,2057,2056,2053,2050,2047,2041,2035,2030,2027,2026,2030,2037,2041,2045,2050,2055,2060,2062,2060,2057,2053,2048,2045,2043,2042,2040,2037,2033,2031,2031,2033,2037,2043,2048,2052,2055,2058,2060,2061,2060,2056,2049,2041,2035,2033,2033,2034,2037,2041,2044,2045,2044,2040,2038,2037,2038,2038,2037,2035,2033,2033,2037,2045,2055,2061,2063,2061,2059,2057,2054,2052,2053,2055,2059,2062,2063,2059,2052,2043,2038,2038,2040,2041,2039,2036,2033,2034,2037,2039,2041,2046,2053,2058,2060,2059,2059,2061,2065,2068,2068,2064,2059,2055,2053,2050,2046,2044,2042,2040,2037,2032,2027,2025,2025,2025,2026,2029,2035,2042,2048,2052,2055,2057,2057,2058,2058,2058,2059,2060,2060,2057,2051,2047,2046,2047,2050,2050,2048,2043,2039,2034,2029,2025,2024,2030,2040,2051,2058,2060,2059,2058,2055,2053,2051,2050,2051,2050,2048,2045,2042,2037,2034,2035,2039,2045,2050,2053,2054,2053,2053,2053,2053,2054,2053,2049,2046,2044,2044,2045,2047,2054,2063,2069,2070,2065,2058,2053,2050,2049,2049,2049,2052,2057,2065,2074,2081,2085,2084,2078,2069,2062,2056,2052,2050,2051,2055,2056,2056,2056,2058,2062,2067,2071,2073,2073,2071,2068,2063,2055,2048,2045,2046,2049,2052,2057,2062,2067,2070,2074,2079,2085,2090,2094,2097,2099,2100,2098,2093,2086,2080,2074,2072,2074,2081,2090,2094,2089,2077,2063,2052,2043,2036,2031,2029,2030,2030,2031,2034,2036,2036,2038,2045,2055,2062,2065,2066,2065,2065,2064,2062,2059,2059,2060,2064,2069,2074,2077,2079,2077,2069,2061,2057,2056,2056,2055,2055,2058,2065,2068,2068,2063,2057,2049,2042,2039,2039,2039,2039,2036,2032,2030,2030,2030,2030,2030,2032,2032,2031,2033,2037,2043,2047,2050,2053,2055,2057,2057,2057,2056,2056,2056,2055,2054,2050,2045,2040,2037,2038,2039,2039,2040,2042,2044,2044,2041,2036,2032,2030,2032,2036,2040,2044,2047,2052,2056,2059,2061,2061,2060,2059,2058,2054,2048,2041,2034,2028,2024,2024,2025,2025,2024,2022,2020,2020,2023,2028,2033,2037,2042,2047,2050,2048,2045,2045,2046,2045,2044,2047,2051,2051,2046,2042,2040,2040,2041,2042,2043,2044,2044,2043,2043,2045,2049,2056,2063,2068,2069,2065,2056,2046,2037,2028,2022,2021,2023,2029,2039,2050,2057,2060,2058,2053,2050,2048,2049,2051,2050,2050,2052,2054,2052,2049,2045,2041,2037,2035,2037,2039,2040,2040,2038,2034,2029,2025,2024,2023,2025,2029,2035,2044,2054,2061,2063,2060,2055,2052,2053,2056,2059,2060,2063,2067,2072,2075,2076,2076,2075,2071,2065,2060,2058,2057,2051,2041,2027,2015,2009,2006,2005,2007,2012,2018,2025,2032,2037,2042,2046,2049,2051,2050,2047,2041,2037,2036,2039,2041,2040,2037,2033,2030,2031,2035,2042,2046,2049,2051,2053,2054,2056,2058,2059,2058,2057,2054,2052,2049,2046,2044,2042,2042,2043,2043,2043,2043,2044,2046,2048,2052,2054,2055,2053,2050,2046,2043,2041,2041,2044,2049,2053,2055,2053,2050,2046,2043,2041,2039,2037,2035,2034,2032,2031,2032,2036,2039,2042,2047,2054,2058,2059,2057,2053,2048,2044,2043,2043,2044,2046,2051,2055,2058,2058,2057,2055,2055,2055,2054,2051,2048,2043,2037,2030,2024,2020,2019,2021,2026,2034,2043,2053,2062,2069,2074,2078,2079,2077,2072,2067,2062,2061,2064,2067,2068,2068,2068,2068,2068,2067,2066,2063,2059,2056,2054,2055,2058,2061,2062,2062,2061,2060,2059,2059,2062,2067,2068,2066,2063,2061,2060,2060,2060,2061,2060,2058,2055,2050,2044,2037,2033,2035,2042,2053,2068,2085,2099,2109,2113,2113,2109,2099,2087,2075,2066,2058,2051,2044,2035,2025,2018,2014,2014,2019,2026,2032,2036,2042,2049,2058,2067,2073,2072,2064,2055,2051,2053,2060,2070,2081,2091,2099,2104,2104,2099,2092,2082,2071,2060,2052,2048,2048,2050,2052,2053,2050,2045,2038,2033,2033,2035,2037,2037,2036,2038,2040,2043,2045,2048,2051,2055,2059,2062,2063,2062,2062,2060,2055,2048,2044,2042,2042,2041,2040,2037,2036,2037,2041,2044,2047,2049,2050,2049,2045,2044,2045,2047,2047,2047,2047,2047,2045,2042,2039,2038,2038,2040,2043,2046,2051,2056,2059,2059,2057,2055,2053,2054,2056,2061,2064,2063,2059,2053,2045,2038,2033,2031,2030,2030,2030,2034,2038,2042,2046,2049,2050,2050,2049,2047,2046,2047,2050,2051,2049,2047,2045,2042,2038,2033,2030,2030,2030,2032,2035,2037,2039,2040,2039,2038,2038,2040,2042,2043,2042,2038,2035,2034,2036,2039,2041,2040,2038,2036,2034,2034,2037,2043,2051,2055,2055,2049,2042,2037,2036,2039,2043,2048,2053,2056,2056,2051,2043,2036,2032,2031,2033,2038,2044,2049,2052,2053,2053,2054,2056,2057,2057,2056,2054,2052,2048,2045,2044,2043,2041,2038,2034,2031,2029,2028,2028,2028,2028,2028,2027,2027,2029,2034,2041,2047,2051,2053,2056,2057,2058,2059,2062,2065,2067,2068,2070,2072,2074,2073,2070,2066,2065,2066,2068,2066,2060,2053,2050,2048,2048,2048,2049,2051,2049,2046,2043,2042,2042,2042,2041,2040,2037,2032,2028,2028,2033,2038,2042,2045,2048,2049,2047,2044,2043,2043,2043,2044,2047,2051,2054,2057,2063,2071,2078,2081,2079,2075,2070,2066,2062,2059,2055,2052,2050,2049,2049,2049,2049,2048,2048,2050,2051,2051,2049,2047,2045,2043,2041,2036,2032,2030,2032,2036,2043,2052,2058,2060,2058,2054,2049,2048,2050,2054,2057,2059,2061,2065,2068,2072,2072,2067,2057,2046,2037,2028,2019,2014,2015,2021,2030,2037,2042,2045,2045,2044,2042,2039,2038,2039,2042,2046,2052,2057,2059,2059,2060,2062,2065,2067,2064,2058,2053,2050,2050,2053,2056,2058,2058,2055,2052,2051,2053,2056,2059,2061,2061,2060,2057,2053,2047,2043,2040,2037,2034,2032,2034,2038,2043,2048,2053,2056,2057,2054,2047,2041,2037,2038,2043,2050,2058,2067,2075,2081,2082,2080,2077,2074,2073,2073,2072,2071,2071,2070,2069,2067,2062,2058,2057,2058,2060,2060,2060,2058,2057,2054,2052,2050,2048,2049,2050,2049,2049,2048,2049,2050,2055,2061,2065,2067,2067,2066,2063,2059,2056,2055,2056,2058,2058,2057,2055,2053,2053,2055,2059,2063,2068,2072,2075,2077,2077,2075,2073,2068,2060,2051,2042,2034,2031,2034,2039,2043,2046,2046,2045,2045,2048,2054,2060,2065,2067,2068,2071,2074,2078,2081,2082,2080,2073,2066,2060,2058,2060,2062,2061,2055,2046,2037,2032,2031,2033,2036,2041,2045,2048,2051,2054,2060,2067,2073,2076,2074,2070,2064,2060,2058,2057,2058,2060,2061,2059,2058,2057,2058,2058,2056,2052,2046,2041,2040,2041,2042,2042,2042,2044,2049,2055,2058,2059,2059,2057,2057,2061,2066,2070,2069,2066,2061,2057,2051,2046,2047,2052,2061,2068,2073,2075,2075,2070,2064,2059,2058,2056,2052,2050,2048,2046,2043,2043,2045,2048,2051,2056,2059,2061,2060,2059,2057,2052,2045,2039,2036,2037,2040,2045,2051,2058,2065,2066,2063,2058,2055,2055,2055,2057,2060,2061,2060,2057,2053,2049,2045,2044,2047,2053,2061,2067,2069,2068,2066,2064,2063,2060,2057,2053,2047,2042,2037,2034,2033,2033,2034,2037,2041,2044,2049,2055,2058,2059,2057,2056,2057,2058,2060,2061,2059,2054,2050,2047,2045,2044,2046,2046,2046,2046,2044,2040,2035,2035,2039,2045,2048,2046,2040,2035,2033,2033,2035,2037,2037,2035,2033,2032,2033,2035,2038,2038,2035,2032,2030,2030,2032,2037,2044,2052,2058,2061,2062,2059,2053,2045,2035,2024,2015,2010,2010,2014,2020,2025,2024,2021,2018,2018,2016,2015,2016,2020,2028,2036,2043,2049,2053,2054,2051,2047,2043,2044,2048,2053,2055,2054,2049,2044,2040,2037,2035,2030,2024,2019,2016,2015,2014,2014,2017,2023,2032,2041,2048,2053,2056,2059,2063,2066,2068,2068,2066,2063,2062,2060,2058,2055,2053,2049,2045,2044,2045,2044,2042,2041,2041,2040,2038,2034,2030,2027,2028,2029,2032,2034,2037,2040,2041,2043,2044,2045,2046,2048,2051,2056,2064,2070,2073,2072,2069,2064,2060,2056,2051,2045,2041,2040,2041,2043,2046,2050,2053,2054,2052,2049,2047,2047,2049,2052,2053,2052,2049,2044,2040,2040,2041,2042,2044,2045,2045,2045,2046,2046,2047,2050,2053,2053,2053,2053,2055,2056,2057,2058,2059,2061,2062,2061,2057,2053,2050,2048,2048,2050,2054,2059,2063,2065,2063,2058,2054,2051,2047,2042,2038,2039,2043,2049,2057,2068,2078,2084,2086,2084,2078,2071,2064,2060,2057,2055,2052,2047,2043,2040,2040,2041,2043,2046,2049,2051,2053,2057,2062,2066,2070,2071,2071,2069,2068,2067,2067,2067,2067,2067,2068,2069,2072,2075,2077,2075,2069,2061,2054,2047,2044,2046,2051,2056,2063,2072,2082,2088,2090,2089,2087,2083,2081,2081,2083,2086,2087,2083,2076,2068,2060,2050,2041,2035,2033,2033,2034,2036,2041,2048,2056,2063,2068,2072,2073,2072,2073,2075,2076,2076,2075,2073,2071,2067,2063,2059,2058,2058,2059,2060,2061,2063,2066,2068,2069,2070,2069,2068,2068,2069,2070,2071,2073,2074,2073,2070,2065,2058,2051,2043,2037,2033,2031,2032,2033,2036,2039,2040,2039,2038,2039,2043,2048,2051,2055,2058,2061,2064,2065,2065,2064,2063,2062,2061,2059,2058,2057,2056,2056,2056,2056,2055,2056,2056,2058,2060,2063,2065,2065,2064,2063,2062,2059,2055,2051,2047,2045,2043,2041,2041,2042,2042,2044,2048,2054,2057,2059,2059,2056,2054,2053,2053,2054,2056,2058,2059,2058,2056,2054,2052,2050,2049,2049,2049,2051,2053,2058,2063,2067,2071,2073,2074,2073,2071,2068,2064,2058,2052,2048,2047,2047,2046,2045,2042,2040,2041,2043,2046,2049,2050,2051,2050,2047,2046,2048,2053,2057,2059,2059,2056,2050,2043,2041,2044,2049,2053,2055,2056,2056,2057,2056,2054,2051,2047,2042,2037,2034,2033,2033,2034,2034,2034,2033,2033,2037,2043,2051,2059,2066,2069,2069,2067,2065,2064,2063,2062,2061,2058,2055,2053,2051,2048,2045,2040,2036,2033,2032,2032,2035,2040,2049,2060,2071,2077,2080,2078,2074,2070,2065,2061,2056,2054,2054,2058,2062,2066,2069,2068,2065,2059,2052,2044,2039,2038,2040,2042,2046,2051,2058,2064,2067,2067,2064,2059,2056,2055,2056,2056,2052,2047,2040,2035,2029,2024,2020,2019,2022,2028,2036,2044,2051,2057,2062,2066,2068,2067,2067,2068,2070,2070,2070,2069,2068,2065,2064,2063,2062,2061,2057,2050,2041,2032,2028,2029,2032,2035,2037,2038,2039,2041,2045,2050,2057,2062,2065,2067,2065,2061,2056,2051,2046,2042,2041,2041,2041,2042,2043,2046,2049,2051,2054,2056,2057,2057,2056,2054,2050,2045,2040,2039,2038,2038,2038,2039,2041,2044,2047,2049,2049,2048,2048,2049,2051,2054,2054,2051,2045,2040,2035,2029,2021,2016,2017,2025,2037,2049,2056,2057,2054,2049,2046,2045,2044,2043,2043,2043,2043,2042,2041,2041,2041,2039,2038,2039,2043,2046,2048,2050,2050,2049,2046,2044,2042,2039,2036,2033,2031,2029,2028,2027,2026,2026,2027,2029,2033,2038,2041,2043,2041,2040,2041,2045,2051,2055,2058,2060,2060,2058,2055,2050,2045,2041,2042,2045,2047,2048,2049,2048,2047,2043,2038,2035,2033,2033,2033,2032,2031,2029,2028,2027,2028,2030,2032,2034,2036,2038,2039,2040,2040,2039,2038,2038,2040,2040,2040,2038,2038,2040,2046,2051,2056,2060,2061,2060,2056,2054,2054,2056,2057,2058,2058,2056,2053,2050,2049,2051,2055,2061,2065,2068,2069,2069,2067,2065,2065,2066,2066,2066,2062,2055,2049,2045,2042,2040,2039,2040,2041,2042,2045,2049,2054,2060,2067,2074,2081,2086,2089,2087,2080,2071,2062,2055,2048,2044,2040,2039,2039,2041,2045,2048,2051,2053,2055,2059,2062,2066,2068,2069,2068,2066,2066,2066,2067,2070,2072,2075,2076,2075,2073,2069,2066,2063,2061,2059,2056,2055,2055,2058,2062,2064,2066,2067,2069,2070,2070,2070,2069,2066,2063,2060,2057,2055,2054,2053,2052,2050,2047,2045,2045,2045,2047,2049,2049,2049,2049,2051,2052,2053,2055,2060,2066,2072,2076,2078,2078,2076,2073,2068,2062,2056,2053,2053,2054,2057,2060,2063,2065,2066,2066,2066,2065,2064,2063,2062,2059,2057,2056,2054,2051,2048,2048,2050,2052,2052,2050,2049,2051,2053,2055,2056,2057,2058,2060,2062,2061,2059,2054,2048,2043,2040,2040,2042,2045,2049,2052,2055,2056,2056,2055,2053,2052,2052,2054,2056,2058,2060,2062,2064,2064,2062,2059,2054,2050,2046,2044,2042,2041,2039,2040,2043,2047,2049,2048,2046,2043,2040,2037,2036,2035,2037,2038,2040,2043,2047,2051,2056,2060,2063,2065,2067,2067,2067,2066,2063,2060,2057,2056,2057,2059,2061,2062,2062,2061,2060,2059,2057,2052,2046,2040,2033,2025,2018,2012,2009,2009,2011,2017,2026,2036,2045,2053,2057,2059,2061,2062,2062,2061,2058,2054,2050,2047,2044,2041,2038,2036,2033,2030,2028,2028,2029,2034,2039,2044,2048,2053,2060,2066,2070,2073,2074,2071,2065,2057,2051,2045,2040,2036,2032,2031,2030,2031,2034,2037,2042,2047,2050,2050,2048,2048,2048,2046,2043,2040,2038,2036,2035,2034,2033,2032,2033,2032,2030,2027,2025,2023,2022,2022,2024,2031,2041,2050,2058,2064,2069,2075,2081,2085,2087,2088,2087,2083,2078,2071,2063,2057,2054,2055,2056,2057,2056,2054,2050,2045,2041,2036,2032,2028,2023,2018,2010,2002,1997,1998,2002,2008,2016,2024,2033,2041,2046,2050,2053,2055,2056,2057,2058,2059,2059,2059,2058,2059,2058,2057,2057,2058,2059,2060,2059,2056,2053,2050,2046,2044,2043,2041,2039,2038,2039,2040,2045,2054,2063,2070,2073,2074,2074,2071,2067,2063,2059,2057,2055,2053,2048,2038,2026,2015,2009,2009,2012,2016,2020,2024,2028,2032,2036,2042,2048,2054,2060,2066,2073,2079,2085,2089,2090,2089,2086,2083,2080,2077,2072,2067,2063,2062,2062,2066,2069,2071,2068,2063,2056,2049,2043,2039,2038,2039,2042,2044,2044,2044,2042,2042,2045,2051,2058,2065,2069,2070,2069,2067,2067,2067,2065,2059,2052,2047,2046,2048,2051,2052,2052,2052,2052,2052,2052,2052,2053,2055,2056,2058,2059,2059,2058,2058,2058,2060,2062,2063,2062,2062,2063,2063,2062,2060,2057,2054,2052,2050,2049,2050,2052,2054,2055,2054,2052,2051,2049,2050,2052,2055,2059,2062,2063,2063,2061,2059,2057,2057,2059,2062,2062,2061,2058,2053,2050,2048,2047,2047,2048,2050,2052,2052,2052,2052,2053,2054,2054,2052,2050,2049,2049,2049,2049,2048,2048,2049,2051,2050,2047,2042,2037,2033,2030,2031,2034,2037,2040,2042,2042,2045,2049,2053,2057,2061,2065,2069,2072,2072,2071,2069,2064,2059,2055,2053,2054,2055,2057,2058,2059,2059,2059,2058,2055,2053,2051,2049,2049,2051,2052,2052,2052,2049,2044,2038,2033,2028,2026,2027,2031,2034,2037,2039,2043,2047,2051,2054,2058,2063,2068,2070,2071,2071,2070,2067,2064,2063,2063,2064,2063,2059,2053,2049,2046,2045,2047,2049,2053,2058,2063,2067,2067,2064,2059,2054,2050,2048,2048,2050,2051,2051,2049,2048,2049,2051,2055,2058,2061,2062,2062,2060,2055,2048,2044,2043,2045,2051,2059,2067,2075,2079,2079,2074,2065,2057,2049,2042,2038,2035,2034,2033,2033,2036,2040,2047,2054,2060,2064,2064,2061,2058,2054,2050,2045,2040,2035,2032,2030,2031,2033,2037,2041,2047,2052,2057,2061,2062,2059,2053,2048,2046,2048,2053,2058,2062,2064,2062,2056,2048,2040,2031,2025,2024,2028,2033,2039,2042,2043,2040,2039,2040,2042,2043,2043,2043,2043,2043,2043,2042,2042,2043,2044,2044,2045,2044,2042,2039,2036,2036,2036,2034,2031,2027,2027,2031,2037,2042,2046,2046,2045,2042,2037,2033,2030,2029,2031,2035,2040,2046,2052,2056,2059,2060,2060,2059,2056,2053,2050,2049,2048,2048,2047,2046,2044,2043,2041,2039,2039,2038,2037,2037,2037,2037,2036,2036,2035,2035,2036,2037,2038,2038,2037,2036,2037,2040,2044,2048,2050,2049,2049,2049,2050,2049,2047,2044,2043,2044,2044,2044,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2048,2048,2049,2051,2052,2053,2053,2051,2049,2046,2045,2046,2048,2048,2049,2049,2050,2050,2050,2049,2049,2049,2048,2049,2049,2050,2052,2054,2057,2061,2064,2066,2066,2066,2065,2063,2057,2049,2043,2038,2034,2032,2031,2031,2033,2038,2046,2054,2060,2064,2064,2062,2059,2059,2061,2062,2063,2063,2060,2057,2052,2048,2046,2044,2042,2041,2041,2043,2045,2045,2045,2046,2048,2052,2056,2059,2063,2067,2070,2070,2069,2066,2063,2061,2058,2056,2055,2054,2053,2052,2049,2046,2042,2038,2035,2036,2040,2046,2053,2062,2071,2078,2081,2079,2076,2073,2072,2070,2066,2061,2055,2049,2044,2039,2036,2033,2032,2032,2032,2032,2033,2035,2037,2037,2039,2043,2048,2055,2060,2063,2063,2061,2060,2059,2060,2063,2067,2070,2071,2071,2069,2066,2061,2057,2052,2049,2045,2044,2045,2046,2047,2044,2040,2036,2033,2032,2035,2040,2047,2056,2062,2066,2067,2064,2059,2053,2050,2048,2047,2047,2048,2050,2051,2050,2050,2048,2046,2043,2039,2035,2034,2035,2038,2042,2045,2049,2054,2058,2061,2060,2056,2052,2048,2045,2042,2041,2042,2045,2048,2050,2051,2049,2046,2042,2038,2034,2031,2029,2027,2027,2029,2031,2032,2034,2039,2045,2050,2053,2057,2059,2061,2061,2059,2056,2053,2051,2049,2047,2045,2044,2042,2040,2038,2037,2037,2037,2039,2040,2042,2046,2051,2053,2053,2051,2049,2048,2048,2047,2047,2048,2050,2052,2053,2054,2052,2050,2049,2049,2049,2050,2052,2053,2055,2056,2057,2056,2056,2054,2051,2048,2045,2042,2041,2041,2043,2045,2045,2045,2044,2043,2042,2039,2036,2035,2035,2035,2038,2040,2043,2045,2048,2052,2055,2057,2057,2057,2057,2057,2057,2056,2055,2054,2054,2055,2056,2057,2057,2056,2055,2052,2048,2044,2042,2042,2044,2045,2047,2048,2047,2047,2047,2048,2050,2052,2050,2046,2041,2038,2036,2036,2037,2038,2040,2043,2046,2051,2056,2060,2062,2062,2059,2056,2053,2050,2047,2043,2041,2042,2045,2050,2055,2061,2065,2067,2066,2062,2058,2054,2052,2050,2049,2048,2047,2047,2046,2044,2042,2039,2036,2034,2036,2040,2045,2048,2051,2052,2053,2053,2050,2046,2042,2038,2037,2038,2039,2041,2044,2048,2051,2054,2057,2060,2060,2057,2055,2054,2053,2052,2052,2052,2053,2055,2058,2060,2060,2059,2057,2053,2047,2041,2037,2035,2036,2039,2042,2046,2049,2052,2055,2058,2061,2062,2062,2061,2058,2055,2054,2055,2057,2059,2061,2064,2068,2069,2068,2066,2065,2063,2062,2059,2057,2054,2052,2052,2052,2053,2051,2049,2047,2047,2047,2047,2048,2052,2056,2062,2068,2072,2071,2067,2062,2057,2051,2045,2041,2039,2038,2038,2038,2039,2041,2044,2046,2047,2049,2053,2056,2058,2060,2061,2063,2066,2071,2076,2079,2080,2077,2071,2062,2052,2043,2035,2029,2027,2028,2031,2036,2042,2046,2049,2049,2050,2051,2051,2049,2047,2045,2043,2042,2042,2043,2044,2047,2049,2052,2055,2058,2060,2062,2063,2062,2060,2059,2059,2058,2057,2057,2057,2059,2061,2061,2060,2058,2055,2050,2045,2040,2035,2031,2029,2029,2032,2036,2040,2044,2046,2046,2047,2047,2046,2044,2042,2040,2037,2034,2031,2030,2030,2031,2032,2034,2036,2038,2041,2043,2043,2042,2040,2037,2034,2030,2028,2027,2028,2029,2030,2030,2029,2027,2027,2028,2032,2036,2040,2046,2052,2058,2061,2060,2056,2052,2047,2043,2041,2041,2042,2044,2046,2049,2050,2049,2045,2041,2037,2035,2034,2035,2036,2037,2037,2036,2034,2032,2032,2033,2036,2040,2046,2049,2050,2048,2046,2044,2043,2040,2038,2036,2036,2038,2040,2041,2043,2045,2046,2047,2047,2046,2046,2045,2042,2040,2038,2038,2038,2039,2040,2043,2045,2046,2045,2043,2041,2039,2039,2038,2037,2035,2034,2033,2033,2035,2039,2043,2049,2055,2059,2062,2062,2061,2060,2059,2059,2059,2058,2057,2055,2053,2052,2052,2051,2052,2052,2054,2056,2058,2060,2061,2061,2060,2058,2055,2050,2045,2039,2033,2029,2028,2030,2033,2037,2042,2047,2051,2054,2057,2060,2062,2065,2066,2067,2068,2068,2067,2063,2059,2056,2056,2056,2057,2057,2057,2057,2055,2053,2052,2051,2050,2050,2052,2054,2056,2058,2060,2061,2061,2059,2057,2054,2051,2047,2044,2043,2043,2045,2048,2051,2053,2054,2053,2051,2048,2046,2046,2047,2050,2052,2053,2053,2053,2053,2052,2051,2052,2054,2059,2066,2072,2074,2073,2069,2064,2060,2057,2055,2055,2053,2052,2050,2049,2048,2048,2048,2048,2048,2048,2048,2049,2050,2051,2052,2053,2052,2050,2046,2043,2040,2040,2044,2050,2055,2060,2062,2060,2058,2058,2058,2060,2061,2060,2057,2053,2051,2049,2047,2046,2044,2044,2045,2045,2043,2040,2037,2035,2035,2037,2040,2042,2043,2044,2044,2043,2041,2040,2041,2043,2046,2049,2051,2052,2052,2052,2052,2053,2052,2051,2049,2046,2044,2043,2040,2038,2035,2032,2030,2029,2028,2028,2027,2027,2027,2029,2032,2034,2036,2039,2041,2044,2044,2044,2044,2043,2043,2043,2043,2043,2042,2042,2043,2045,2046,2047,2047,2048,2049,2050,2050,2048,2045,2041,2039,2037,2035,2033,2032,2032,2033,2036,2039,2041,2041,2041,2040,2037,2035,2033,2033,2033,2033,2033,2034,2035,2036,2036,2036,2037,2039,2042,2044,2048,2053,2057,2059,2058,2056,2052,2048,2044,2040,2037,2034,2032,2033,2037,2042,2046,2051,2053,2052,2049,2044,2039,2035,2032,2031,2031,2032,2035,2039,2042,2044,2045,2045,2048,2051,2054,2055,2055,2053,2050,2046,2043,2041,2041,2042,2044,2045,2045,2046,2046,2047,2047,2047,2048,2049,2050,2050,2049,2049,2049,2050,2052,2053,2053,2052,2051,2050,2050,2049,2046,2042,2038,2037,2037,2039,2043,2046,2049,2051,2052,2054,2055,2055,2052,2047,2041,2036,2032,2031,2032,2036,2039,2043,2046,2050,2054,2057,2060,2060,2058,2055,2051,2048,2048,2049,2051,2054,2055,2056,2056,2055,2054,2053,2053,2055,2056,2057,2058,2058,2057,2054,2051,2049,2048,2048,2049,2050,2050,2050,2051,2053,2057,2060,2063,2065,2065,2064,2061,2058,2056,2055,2054,2052,2048,2045,2043,2042,2042,2044,2047,2050,2055,2059,2062,2065,2069,2072,2075,2077,2077,2074,2068,2063,2059,2057,2057,2057,2057,2056,2054,2052,2052,2054,2055,2055,2056,2057,2059,2062,2064,2066,2065,2063,2060,2058,2056,2054,2052,2051,2052,2052,2053,2054,2056,2057,2057,2058,2059,2061,2063,2066,2069,2070,2071,2071,2069,2067,2064,2062,2059,2056,2053,2051,2049,2048,2047,2046,2043,2042,2041,2041,2041,2042,2044,2045,2045,2044,2043,2042,2041,2042,2044,2047,2048,2047,2047,2047,2049,2052,2054,2054,2054,2053,2052,2052,2054,2056,2059,2059,2058,2054,2049,2045,2041,2038,2037,2039,2043,2047,2049,2049,2048,2047,2045,2043,2041,2038,2034,2032,2032,2032,2032,2032,2032,2033,2036,2039,2042,2043,2043,2042,2041,2039,2036,2035,2034,2034,2035,2037,2041,2045,2048,2050,2050,2050,2050,2049,2048,2048,2047,2047,2046,2046,2047,2049,2052,2054,2055,2053,2049,2045,2040,2035,2032,2030,2028,2027,2027,2027,2028,2028,2028,2029,2029,2031,2034,2039,2043,2045,2045,2045,2044,2042,2041,2041,2041,2040,2038,2035,2032,2031,2032,2035,2038,2042,2045,2047,2047,2046,2045,2043,2040,2037,2033,2031,2030,2029,2029,2030,2032,2035,2040,2045,2049,2053,2057,2060,2063,2064,2062,2058,2052,2047,2044,2044,2045,2046,2047,2049,2049,2049,2049,2050,2052,2054,2056,2057,2057,2058,2059,2058,2058,2059,2060,2060,2058,2055,2050,2044,2037,2030,2023,2019,2018,2019,2020,2023,2026,2029,2033,2036,2039,2043,2049,2056,2063,2068,2071,2072,2073,2073,2072,2071,2068,2065,2061,2057,2055,2052,2049,2045,2041,2035,2030,2027,2026,2027,2028,2030,2032,2033,2034,2036,2040,2045,2050,2053,2054,2052,2047,2043,2041,2041,2041,2043,2045,2047,2048,2047,2046,2047,2050,2055,2060,2064,2067,2067,2065,2060,2053,2047,2042,2038,2035,2034,2036,2039,2042,2045,2048,2050,2051,2051,2050,2049,2049,2051,2053,2054,2053,2052,2050,2050,2050,2051,2051,2051,2051,2048,2045,2042,2038,2036,2035,2036,2039,2041,2043,2044,2044,2045,2045,2046,2047,2048,2048,2048,2048,2046,2044,2042,2040,2040,2042,2044,2045,2046,2046,2047,2048,2049,2050,2052,2054,2055,2056,2057,2057,2055,2053,2051,2050,2049,2049,2049,2049,2048,2047,2047,2047,2045,2043,2041,2042,2044,2046,2049,2052,2054,2055,2056,2056,2056,2055,2054,2053,2053,2052,2051,2050,2050,2051,2053,2054,2055,2056,2057,2057,2056,2054,2053,2053,2051,2049,2047,2046,2045,2045,2046,2048,2051,2054,2057,2058,2059,2058,2057,2053,2049,2045,2043,2044,2047,2050,2052,2055,2059,2063,2066,2068,2068,2067,2064,2061,2057,2054,2052,2050,2049,2048,2048,2049,2051,2055,2058,2061,2067,2073,2077,2078,2077,2073,2067,2060,2055,2051,2047,2043,2040,2040,2042,2045,2049,2053,2057,2058,2058,2057,2057,2056,2056,2055,2055,2058,2062,2064,2065,2063,2060,2057,2054,2054,2056,2058,2061,2062,2064,2066,2068,2068,2066,2063,2060,2059,2059,2060,2060,2060,2060,2061,2064,2068,2072,2077,2080,2084,2085,2083,2077,2069,2061,2054,2049,2048,2051,2057,2063,2065,2064,2061,2057,2054,2053,2053,2051,2048,2043,2040,2039,2041,2045,2050,2054,2057,2059,2059,2057,2056,2054,2052,2051,2051,2054,2057,2060,2060,2059,2058,2058,2058,2058,2059,2060,2063,2066,2068,2069,2067,2065,2062,2059,2057,2056,2055,2055,2055,2054,2053,2052,2051,2050,2049,2049,2049,2050,2052,2053,2053,2053,2052,2051,2050,2050,2050,2053,2055,2057,2057,2056,2055,2053,2049,2043,2037,2033,2032,2033,2037,2042,2048,2052,2054,2054,2054,2054,2053,2051,2049,2049,2050,2051,2053,2054,2054,2056,2059,2060,2057,2053,2049,2044,2042,2042,2045,2048,2050,2051,2051,2050,2049,2050,2052,2056,2059,2060,2057,2052,2047,2042,2038,2035,2033,2030,2030,2031,2032,2032,2032,2032,2032,2032,2032,2032,2033,2034,2036,2037,2039,2040,2041,2041,2041,2040,2039,2037,2035,2032,2029,2027,2026,2026,2026,2027,2028,2030,2033,2036,2040,2043,2045,2044,2043,2042,2040,2039,2039,2039,2039,2038,2035,2033,2031,2031,2033,2035,2036,2037,2035,2032,2028,2022,2017,2012,2010,2009,2012,2016,2021,2025,2027,2026,2026,2026,2027,2027,2026,2025,2025,2026,2029,2033,2037,2041,2044,2046,2048,2047,2044,2041,2039,2038,2037,2035,2033,2031,2030,2029,2029,2028,2027,2028,2030,2033,2036,2039,2042,2044,2046,2047,2046,2043,2039,2035,2032,2030,2030,2033,2037,2042,2046,2050,2053,2054,2052,2050,2049,2050,2052,2052,2052,2051,2049,2047,2045,2044,2043,2044,2046,2048,2051,2053,2054,2054,2052,2051,2048,2045,2041,2040,2040,2041,2041,2040,2041,2042,2045,2048,2053,2058,2062,2064,2063,2060,2057,2056,2055,2055,2055,2056,2058,2061,2066,2071,2073,2073,2070,2065,2060,2055,2051,2048,2045,2042,2039,2037,2035,2034,2033,2034,2036,2040,2045,2051,2057,2062,2063,2062,2059,2057,2055,2053,2052,2051,2048,2046,2044,2042,2042,2041,2040,2039,2039,2039,2040,2042,2044,2047,2050,2053,2056,2059,2062,2064,2065,2066,2067,2067,2066,2065,2064,2062,2061,2060,2057,2052,2047,2042,2040,2040,2041,2042,2044,2045,2046,2045,2045,2045,2045,2046,2046,2046,2047,2051,2057,2061,2062,2061,2059,2057,2055,2053,2053,2053,2053,2054,2055,2057,2057,2055,2052,2048,2046,2046,2047,2050,2052,2055,2057,2059,2059,2058,2055,2051,2048,2046,2047,2049,2052,2055,2057,2060,2064,2069,2073,2076,2076,2074,2069,2063,2057,2054,2053,2053,2054,2055,2054,2051,2049,2049,2049,2050,2050,2049,2048,2047,2049,2052,2055,2058,2060,2063,2066,2069,2071,2071,2068,2065,2061,2058,2056,2055,2055,2055,2055,2053,2053,2054,2056,2058,2058,2055,2050,2045,2041,2039,2038,2040,2043,2046,2049,2051,2054,2058,2062,2065,2067,2068,2068,2067,2066,2066,2067,2067,2064,2060,2057,2054,2052,2050,2049,2046,2041,2037,2035,2035,2035,2035,2033,2032,2031,2032,2034,2035,2036,2037,2037,2037,2039,2041,2045,2049,2053,2056,2058,2059,2059,2058,2058,2057,2057,2057,2057,2056,2055,2054,2054,2052,2049,2045,2042,2039,2038,2039,2040,2041,2043,2046,2048,2050,2052,2053,2052,2051,2049,2049,2050,2052,2052,2051,2048,2046,2045,2046,2047,2049,2050,2050,2048,2046,2043,2040,2039,2039,2040,2041,2043,2046,2047,2049,2052,2054,2053,2052,2051,2051,2051,2051,2053,2056,2060,2063,2064,2064,2063,2061,2058,2056,2054,2054,2055,2057,2059,2059,2058,2056,2054,2051,2048,2043,2039,2035,2033,2034,2039,2044,2049,2052,2051,2049,2046,2045,2046,2048,2050,2052,2055,2057,2061,2065,2069,2071,2073,2073,2073,2071,2067,2063,2060,2059,2058,2057,2056,2054,2050,2046,2041,2037,2035,2033,2034,2035,2036,2037,2038,2039,2040,2041,2044,2047,2051,2055,2059,2062,2063,2063,2060,2056,2052,2049,2047,2046,2044,2043,2043,2044,2046,2049,2051,2052,2052,2051,2050,2051,2052,2053,2054,2055,2054,2051,2048,2046,2044,2044,2044,2042,2039,2037,2035,2035,2036,2038,2041,2044,2048,2049,2049,2046,2043,2042,2042,2043,2045,2046,2046,2045,2043,2041,2040,2040,2041,2041,2040,2040,2040,2038,2036,2034,2033,2033,2034,2037,2041,2044,2048,2050,2051,2051,2050,2049,2046,2043,2041,2040,2039,2038,2037,2037,2037,2038,2039,2039,2036,2032,2028,2025,2026,2029,2033,2037,2039,2040,2041,2041,2041,2042,2043,2044,2045,2045,2043,2042,2040,2041,2042,2043,2044,2044,2044,2044,2044,2044,2044,2044,2043,2041,2039,2036,2034,2032,2031,2031,2034,2039,2043,2046,2047,2047,2045,2043,2041,2041,2042,2044,2047,2050,2052,2053,2055,2056,2058,2058,2057,2055,2054,2053,2053,2052,2051,2050,2049,2049,2048,2047,2046,2044,2042,2043,2045,2047,2049,2050,2050,2049,2047,2045,2043,2042,2040,2038,2037,2037,2037,2038,2038,2039,2041,2044,2046,2047,2048,2050,2054,2056,2058,2058,2058,2056,2054,2052,2050,2050,2050,2050,2051,2053,2054,2054,2053,2053,2053,2053,2054,2055,2056,2059,2062,2066,2067,2066,2063,2060,2057,2055,2053,2051,2047,2044,2041,2038,2035,2032,2030,2029,2030,2033,2037,2040,2042,2045,2047,2049,2051,2051,2051,2049,2046,2043,2040,2037,2034,2031,2029,2029,2030,2033,2037,2042,2048,2052,2056,2058,2060,2061,2062,2063,2064,2063,2062,2060,2058,2055,2052,2050,2049,2049,2050,2052,2052,2051,2049,2048,2047,2047,2045,2043,2042,2042,2043,2044,2045,2044,2043,2041,2041,2043,2045,2047,2048,2048,2047,2046,2045,2045,2045,2045,2047,2048,2050,2051,2052,2053,2054,2056,2058,2061,2063,2064,2064,2064,2065,2065,2064,2063,2060,2058,2055,2053,2051,2050,2048,2047,2048,2050,2052,2053,2053,2052,2052,2052,2052,2054,2057,2059,2060,2059,2058,2057,2055,2053,2051,2051,2051,2051,2050,2050,2050,2050,2050,2049,2048,2046,2044,2043,2042,2043,2044,2046,2048,2049,2051,2052,2052,2053,2054,2055,2056,2055,2054,2053,2053,2053,2054,2056,2058,2060,2061,2059,2057,2054,2051,2050,2050,2050,2051,2052,2055,2058,2060,2061,2061,2059,2057,2055,2055,2055,2055,2054,2052,2049,2047,2047,2048,2050,2052,2055,2057,2060,2062,2061,2059,2056,2054,2053,2052,2052,2051,2050,2050,2050,2051,2051,2051,2050,2049,2048,2048,2048,2048,2049,2051,2052,2054,2057,2059,2061,2063,2064,2065,2064,2062,2058,2055,2051,2049,2047,2044,2042,2041,2042,2045,2047,2047,2044,2041,2039,2039,2041,2043,2046,2047,2049,2052,2055,2059,2062,2064,2065,2064,2063,2061,2058,2055,2051,2047,2045,2046,2048,2051,2053,2055,2056,2055,2053,2051,2051,2052,2055,2056,2055,2053,2051,2049,2046,2043,2040,2037,2034,2034,2034,2034,2034,2032,2031,2029,2028,2028,2029,2032,2035,2039,2041,2042,2043,2044,2044,2045,2046,2049,2052,2055,2056,2054,2051,2048,2046,2045,2043,2043,2043,2044,2045,2045,2044,2043,2042,2042,2042,2042,2042,2040,2039,2037,2035,2034,2034,2037,2041,2046,2049,2049,2047,2044,2042,2042,2042,2043,2044,2045,2048,2050,2050,2049,2046,2043,2040,2037,2035,2034,2034,2033,2031,2027,2025,2024,2026,2030,2034,2038,2041,2042,2043,2043,2044,2047,2050,2053,2057,2060,2063,2064,2065,2065,2066,2068,2068,2067,2064,2059,2053,2049,2047,2047,2047,2048,2048,2049,2050,2051,2052,2052,2050,2047,2044,2042,2039,2037,2036,2036,2037,2038,2041,2045,2048,2052,2055,2057,2060,2063,2066,2067,2069,2070,2074,2078,2080,2081,2081,2078,2075,2070,2065,2060,2056,2052,2048,2043,2040,2037,2036,2036,2037,2038,2041,2044,2047,2048,2048,2050,2051,2053,2054,2053,2051,2049,2047,2046,2046,2047,2047,2048,2048,2048,2050,2052,2056,2058,2060,2061,2062,2061,2059,2054,2048,2042,2037,2033,2032,2033,2036,2040,2044,2048,2051,2054,2056,2056,2054,2053,2051,2050,2049,2048,2047,2046,2046,2045,2044,2042,2041,2040,2040,2041,2043,2046,2050,2055,2059,2062,2063,2059,2054,2049,2045,2043,2041,2040,2039,2037,2035,2032,2030,2030,2031,2033,2034,2036,2038,2039,2041,2043,2044,2045,2045,2046,2047,2048,2050,2053,2055,2056,2058,2059,2060,2060,2059,2056,2054,2052,2050,2049,2048,2047,2046,2045,2043,2039,2035,2034,2035,2038,2041,2042,2042,2040,2040,2041,2043,2046,2049,2052,2053,2055,2056,2057,2057,2057,2058,2059,2062,2063,2062,2061,2059,2058,2057,2058,2058,2057,2054,2051,2048,2047,2048,2049,2051,2053,2054,2055,2057,2057,2056,2055,2053,2052,2053,2055,2058,2061,2063,2065,2067,2068,2069,2070,2071,2072,2072,2072,2071,2068,2062,2055,2048,2043,2038,2037,2038,2040,2044,2047,2050,2050,2051,2053,2054,2056,2058,2059,2059,2061,2063,2067,2070,2071,2072,2072,2071,2070,2068,2065,2061,2059,2058,2059,2060,2061,2060,2059,2058,2057,2056,2056,2055,2054,2051,2047,2042,2039,2037,2036,2036,2038,2041,2045,2049,2052,2056,2059,2063,2067,2072,2075,2076,2077,2077,2077,2076,2073,2068,2061,2056,2052,2051,2052,2052,2052,2051,2050,2050,2049,2049,2049,2048,2047,2046,2045,2044,2043,2042,2043,2043,2044,2044,2043,2042,2041,2041,2040,2040,2040,2041,2043,2044,2044,2043,2041,2039,2039,2041,2044,2048,2052,2055,2058,2059,2059,2058,2056,2055,2053,2051,2048,2043,2039,2035,2032,2031,2031,2032,2032,2032,2032,2033,2035,2036,2037,2038,2039,2041,2042,2043,2043,2042,2041,2040,2039,2038,2037,2036,2035,2036,2037,2040,2042,2043,2042,2042,2041,2040,2040,2039,2039,2039,2039,2040,2041,2042,2043,2045,2045,2045,2044,2042,2039,2037,2036,2036,2037,2037,2035,2034,2033,2032,2032,2032,2032,2031,2031,2031,2033,2035,2038,2040,2042,2043,2044,2044,2044,2043,2042,2042,2042,2042,2044,2046,2048,2049,2049,2048,2046,2045,2045,2047,2049,2050,2050,2050,2050,2050,2050,2050,2048,2047,2046,2046,2046,2045,2045,2044,2045,2046,2048,2049,2049,2048,2047,2046,2046,2047,2047,2049,2051,2053,2056,2059,2062,2064,2065,2064,2064,2062,2060,2058,2055,2054,2053,2052,2051,2052,2053,2055,2055,2055,2054,2053,2053,2055,2058,2062,2065,2066,2064,2061,2058,2056,2054,2053,2052,2051,2048,2046,2043,2041,2040,2040,2043,2046,2048,2050,2052,2054,2055,2057,2058,2060,2063,2064,2066,2066,2065,2063,2062,2061,2060,2059,2056,2053,2051,2050,2051,2052,2052,2052,2052,2051,2049,2049,2048,2049,2050,2052,2053,2054,2054,2052,2050,2049,2050,2050,2051,2051,2051,2053,2055,2058,2059,2059,2057,2055,2053,2052,2052,2052,2052,2052,2052,2053,2054,2056,2057,2059,2061,2063,2065,2066,2065,2062,2058,2054,2051,2050,2048,2046,2044,2042,2039,2036,2033,2031,2032,2035,2039,2043,2046,2047,2046,2044,2042,2038,2035,2032,2030,2030,2032,2038,2045,2051,2056,2060,2061,2061,2058,2055,2050,2046,2043,2041,2040,2040,2040,2040,2039,2037,2036,2036,2037,2039,2041,2042,2043,2045,2048,2052,2055,2056,2054,2051,2048,2045,2041,2037,2033,2030,2028,2028,2028,2027,2028,2028,2030,2031,2032,2032,2033,2034,2037,2040,2042,2044,2044,2044,2043,2042,2041,2039,2037,2036,2036,2037,2038,2038,2037,2036,2037,2039,2043,2048,2052,2054,2054,2052,2049,2044,2041,2039,2039,2039,2040,2041,2042,2043,2043,2044,2046,2049,2050,2049,2047,2044,2041,2039,2037,2036,2036,2036,2037,2039,2041,2045,2049,2051,2051,2049,2046,2043,2039,2038,2038,2040,2043,2047,2051,2054,2056,2056,2056,2056,2056,2056,2055,2055,2055,2054,2053,2053,2053,2054,2053,2051,2049,2047,2046,2048,2050,2054,2058,2061,2062,2061,2059,2059,2060,2060,2062,2062,2062,2061,2060,2060,2062,2064,2066,2066,2064,2059,2054,2048,2045,2044,2046,2048,2050,2053,2056,2058,2059,2059,2056,2052,2048,2045,2043,2043,2044,2045,2046,2048,2050,2052,2055,2058,2061,2063,2065,2067,2068,2068,2067,2064,2060,2056,2054,2052,2052,2050,2049,2047,2045,2044,2044,2044,2044,2045,2047,2049,2051,2053,2055,2057,2057,2057,2056,2055,2054,2054,2055,2056,2056,2056,2056,2056,2057,2059,2060,2061,2061,2060,2059,2058,2057,2056,2054,2050,2045,2040,2036,2034,2034,2036,2038,2039,2040,2041,2042,2044,2045,2047,2048,2049,2051,2052,2053,2053,2053,2053,2052,2053,2056,2059,2063,2065,2065,2062,2059,2055,2051,2047,2045,2045,2045,2045,2045,2044,2044,2044,2045,2045,2045,2045,2047,2050,2053,2055,2058,2060,2060,2059,2057,2054,2053,2053,2053,2053,2052,2051,2050,2051,2053,2055,2056,2055,2053,2049,2045,2041,2038,2035,2034,2034,2038,2043,2048,2052,2055,2056,2055,2054,2052,2050,2047,2046,2047,2049,2052,2056,2058,2060,2062,2064,2065,2064,2061,2059,2057,2057,2056,2055,2054,2052,2051,2049,2047,2043,2039,2034,2031,2030,2031,2033,2036,2039,2041,2042,2043,2044,2046,2048,2050,2051,2053,2055,2057,2058,2059,2060,2061,2062,2062,2060,2057,2053,2050,2047,2046,2047,2050,2051,2052,2051,2050,2049,2048,2047,2046,2047,2048,2048,2049,2048,2047,2047,2048,2051,2054,2057,2060,2060,2058,2053,2048,2044,2042,2041,2042,2043,2046,2049,2051,2053,2054,2054,2053,2052,2050,2048,2047,2046,2046,2047,2048,2050,2051,2053,2054,2056,2059,2062,2064,2065,2064,2061,2058,2055,2053,2051,2049,2048,2045,2043,2041,2040,2040,2042,2043,2043,2043,2043,2044,2044,2046,2048,2050,2052,2054,2055,2055,2055,2055,2055,2055,2055,2056,2057,2058,2058,2059,2060,2061,2061,2058,2054,2049,2045,2042,2040,2040,2040,2041,2043,2045,2046,2046,2046,2046,2047,2047,2046,2045,2044,2043,2043,2042,2042,2043,2046,2049,2052,2054,2057,2060,2062,2063,2063,2062,2060,2057,2053,2049,2045,2042,2039,2038,2037,2038,2040,2043,2046,2049,2050,2051,2052,2052,2051,2049,2046,2043,2039,2037,2035,2035,2035,2036,2036,2034,2033,2032,2033,2034,2037,2039,2043,2046,2050,2052,2053,2052,2051,2049,2047,2046,2044,2044,2045,2047,2047,2046,2044,2041,2038,2038,2038,2040,2041,2041,2041,2040,2039,2037,2036,2036,2035,2034,2033,2033,2033,2032,2031,2031,2031,2032,2035,2040,2045,2050,2054,2056,2057,2055,2053,2051,2050,2050,2050,2051,2051,2052,2051,2050,2047,2044,2040,2038,2036,2036,2035,2036,2038,2040,2044,2049,2054,2056,2056,2055,2053,2050,2047,2045,2043,2040,2038,2036,2035,2036,2038,2039,2040,2041,2042,2042,2042,2043,2044,2048,2053,2058,2064,2069,2072,2073,2072,2071,2069,2066,2062,2058,2054,2051,2047,2045,2043,2042,2042,2044,2045,2045,2045,2044,2043,2041,2039,2038,2038,2039,2041,2042,2044,2046,2049,2052,2055,2057,2060,2062,2063,2064,2065,2065,2064,2064,2064,2065,2065,2064,2063,2061,2059,2058,2056,2054,2052,2051,2050,2050,2050,2050,2051,2052,2053,2053,2051,2049,2046,2044,2043,2042,2041,2041,2041,2042,2044,2046,2048,2049,2049,2048,2047,2046,2045,2044,2041,2040,2041,2042,2045,2048,2050,2051,2052,2051,2050,2048,2047,2048,2049,2051,2053,2055,2057,2057,2056,2052,2046,2041,2038,2037,2038,2040,2042,2044,2044,2045,2046,2048,2050,2052,2054,2055,2055,2054,2053,2052,2052,2052,2052,2052,2052,2050,2047,2044,2040,2038,2037,2036,2035,2033,2031,2030,2030,2032,2035,2039,2043,2046,2048,2050,2050,2051,2050,2049,2047,2046,2043,2040,2036,2034,2033,2033,2033,2033,2034,2034,2035,2036,2038,2039,2042,2046,2050,2053,2056,2059,2061,2062,2062,2060,2058,2055,2051,2047,2043,2041,2039,2039,2039,2040,2041,2042,2044,2048,2051,2052,2052,2049,2045,2040,2036,2033,2032,2030,2030,2029,2029,2027,2027,2028,2030,2033,2036,2039,2042,2046,2050,2055,2061,2065,2066,2064,2059,2053,2048,2043,2040,2038,2039,2042,2047,2053,2058,2062,2063,2064,2063,2062,2060,2058,2055,2052,2050,2048,2046,2045,2043,2042,2040,2038,2037,2036,2036,2037,2040,2045,2050,2055,2059,2063,2066,2068,2069,2068,2065,2063,2060,2058,2055,2051,2047,2044,2042,2042,2043,2044,2046,2049,2051,2053,2055,2055,2056,2056,2056,2055,2053,2052,2050,2048,2044,2040,2037,2036,2037,2041,2045,2049,2052,2055,2058,2061,2063,2064,2066,2069,2073,2076,2078,2079,2080,2079,2078,2078,2077,2074,2070,2065,2060,2054,2049,2044,2040,2037,2035,2034,2035,2037,2040,2043,2045,2047,2049,2050,2051,2051,2051,2050,2049,2049,2050,2051,2054,2057,2059,2062,2064,2066,2067,2068,2067,2065,2062,2060,2058,2056,2056,2056,2057,2057,2057,2055,2053,2051,2047,2044,2043,2042,2043,2045,2047,2048,2049,2050,2051,2052,2051,2050,2050,2049,2049,2049,2049,2050,2051,2051,2052,2052,2051,2051,2051,2053,2055,2058,2060,2060,2058,2055,2053,2052,2051,2051,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2052,2051,2051,2050,2049,2048,2048,2048,2050,2051,2051,2051,2051,2051,2051,2050,2047,2043,2039,2036,2035,2036,2038,2042,2045,2048,2050,2051,2052,2052,2052,2052,2052,2051,2050,2048,2046,2042,2037,2031,2026,2022,2020,2020,2021,2023,2026,2029,2033,2036,2039,2041,2043,2043,2044,2046,2048,2050,2052,2052,2051,2049,2047,2043,2040,2038,2036,2036,2036,2038,2040,2041,2042,2043,2043,2043,2043,2044,2046,2049,2052,2054,2055,2053,2050,2047,2044,2043,2043,2042,2041,2038,2036,2034,2034,2035,2036,2036,2036,2037,2038,2039,2039,2040,2041,2042,2042,2041,2039,2036,2034,2031,2027,2024,2023,2022,2023,2026,2029,2032,2034,2035,2035,2037,2039,2042,2045,2046,2046,2045,2042,2039,2036,2034,2034,2034,2034,2035,2037,2038,2038,2037,2036,2035,2037,2039,2042,2044,2047,2049,2049,2049,2047,2044,2041,2038,2037,2038,2039,2039,2041,2042,2045,2050,2055,2059,2060,2059,2056,2052,2048,2044,2041,2038,2035,2033,2030,2028,2027,2027,2027,2028,2029,2030,2031,2034,2037,2040,2044,2047,2049,2050,2050,2049,2048,2046,2045,2044,2042,2042,2042,2042,2042,2043,2044,2045,2046,2047,2048,2048,2048,2046,2044,2041,2038,2034,2030,2028,2027,2029,2031,2034,2037,2041,2045,2049,2053,2057,2059,2061,2061,2060,2059,2058,2057,2055,2052,2046,2041,2035,2031,2029,2028,2029,2030,2032,2034,2036,2038,2038,2038,2038,2037,2037,2037,2037,2038,2039,2038,2038,2038,2040,2044,2048,2052,2055,2057,2059,2059,2058,2055,2052,2049,2046,2044,2043,2043,2043,2044,2045,2047,2049,2050,2050,2049,2046,2043,2041,2040,2040,2040,2041,2042,2044,2046,2048,2051,2053,2054,2055,2053,2051,2047,2045,2044,2043,2043,2044,2045,2046,2047,2047,2047,2047,2048,2049,2050,2051,2051,2052,2053,2053,2053,2052,2052,2052,2052,2052,2052,2052,2050,2047,2044,2041,2039,2039,2041,2043,2045,2048,2051,2054,2055,2055,2053,2049,2046,2044,2044,2045,2046,2048,2049,2050,2052,2054,2057,2059,2060,2060,2058,2056,2054,2053,2053,2054,2054,2053,2052,2051,2051,2050,2050,2049,2050,2051,2052,2054,2056,2058,2060,2062,2063,2064,2065,2066,2065,2064,2062,2060,2058,2056,2056,2056,2057,2058,2059,2060,2062,2063,2064,2064,2063,2061,2060,2059,2059,2060,2061,2062,2062,2061,2060,2060,2061,2062,2064,2065,2065,2065,2065,2064,2062,2059,2057,2056,2053,2051,2047,2044,2043,2043,2046,2050,2055,2058,2061,2063,2063,2063,2062,2060,2058,2057,2056,2058,2060,2062,2064,2065,2065,2064,2064,2062,2061,2060,2060,2061,2061,2061,2060,2059,2058,2056,2055,2054,2053,2054,2054,2054,2054,2054,2053,2052,2049,2047,2044,2042,2041,2040,2041,2042,2044,2047,2050,2054,2056,2058,2059,2059,2058,2056,2054,2053,2052,2051,2050,2048,2046,2044,2041,2039,2038,2038,2038,2041,2044,2047,2051,2053,2054,2054,2052,2050,2047,2045,2044,2042,2041,2040,2040,2040,2040,2039,2038,2037,2037,2037,2038,2038,2038,2038,2039,2040,2041,2040,2039,2038,2038,2039,2041,2044,2047,2051,2055,2057,2057,2055,2051,2047,2042,2038,2034,2032,2030,2030,2030,2030,2032,2034,2035,2035,2034,2033,2031,2030,2028,2027,2027,2027,2029,2031,2035,2039,2042,2043,2042,2040,2037,2036,2037,2038,2039,2040,2040,2038,2036,2034,2031,2029,2028,2028,2029,2031,2034,2037,2041,2045,2050,2053,2054,2052,2048,2042,2037,2032,2030,2029,2029,2028,2026,2025,2023,2023,2025,2028,2032,2037,2042,2047,2050,2052,2053,2053,2052,2050,2047,2045,2043,2043,2042,2041,2040,2038,2035,2034,2034,2035,2036,2038,2041,2043,2046,2048,2050,2050,2048,2046,2043,2042,2040,2038,2036,2034,2033,2032,2032,2033,2033,2032,2031,2031,2033,2035,2038,2040,2041,2042,2042,2043,2045,2047,2049,2050,2051,2051,2051,2051,2052,2052,2052,2052,2051,2049,2047,2045,2045,2045,2045,2045,2044,2044,2042,2040,2038,2037,2037,2040,2045,2049,2052,2053,2053,2053,2053,2052,2052,2050,2049,2049,2048,2049,2050,2050,2050,2049,2048,2045,2042,2037,2033,2031,2030,2031,2032,2035,2037,2039,2040,2039,2039,2040,2041,2043,2044,2044,2045,2046,2047,2049,2051,2051,2050,2048,2046,2044,2044,2044,2044,2044,2044,2044,2045,2047,2048,2048,2048,2048,2048,2048,2049,2050,2049,2048,2045,2042,2041,2041,2042,2043,2045,2046,2047,2048,2048,2049,2049,2049,2048,2046,2045,2045,2046,2047,2048,2048,2047,2045,2044,2043,2043,2044,2044,2044,2044,2044,2046,2047,2048,2049,2049,2050,2051,2051,2051,2049,2048,2046,2043,2043,2044,2046,2050,2055,2059,2060,2059,2056,2052,2048,2044,2041,2039,2037,2036,2034,2033,2034,2037,2041,2044,2049,2054,2058,2061,2061,2062,2062,2062,2061,2061,2060,2057,2053,2048,2042,2035,2030,2026,2025,2026,2028,2031,2033,2035,2037,2039,2041,2043,2045,2048,2050,2052,2053,2052,2051,2050,2049,2048,2047,2045,2043,2042,2042,2043,2044,2045,2045,2046,2046,2047,2049,2051,2051,2051,2050,2048,2048,2048,2048,2046,2044,2042,2041,2042,2043,2045,2046,2048,2049,2049,2049,2048,2048,2047,2047,2046,2045,2045,2045,2045,2047,2049,2051,2052,2051,2049,2048,2047,2047,2047,2047,2046,2045,2045,2044,2044,2045,2046,2047,2048,2048,2048,2048,2049,2049,2051,2052,2055,2056,2057,2056,2055,2053,2050,2048,2046,2046,2045,2045,2044,2043,2042,2041,2041,2041,2041,2040,2040,2040,2042,2045,2048,2052,2056,2059,2061,2063,2064,2062,2057,2049,2041,2035,2033,2033,2035,2036,2036,2034,2032,2030,2029,2027,2027,2029,2031,2035,2039,2043,2045,2047,2049,2051,2052,2051,2048,2045,2042,2041,2040,2040,2040,2042,2043,2044,2043,2042,2040,2039,2040,2043,2046,2047,2047,2045,2043,2041,2040,2039,2037,2035,2034,2032,2032,2032,2033,2034,2033,2033,2031,2030,2030,2031,2034,2037,2041,2044,2046,2046,2043,2038,2033,2029,2029,2031,2033,2035,2036,2036,2035,2034,2032,2031,2030,2030,2030,2032,2033,2035,2037,2040,2043,2046,2049,2051,2052,2053,2055,2057,2057,2055,2051,2047,2043,2039,2035,2031,2027,2022,2019,2018,2019,2021,2023,2024,2025,2027,2030,2033,2036,2038,2039,2039,2038,2037,2035,2033,2031,2030,2029,2029,2030,2033,2037,2042,2047,2052,2055,2057,2057,2056,2054,2052,2051,2050,2049,2049,2048,2047,2046,2047,2048,2050,2051,2051,2050,2047,2044,2040,2036,2032,2029,2028,2028,2029,2032,2034,2036,2037,2037,2038,2040,2042,2045,2047,2048,2048,2048,2049,2050,2050,2050,2050,2050,2048,2045,2043,2042,2042,2043,2044,2045,2047,2049,2050,2051,2050,2048,2045,2041,2039,2040,2042,2045,2048,2051,2053,2054,2054,2053,2051,2048,2046,2045,2046,2048,2052,2056,2060,2063,2065,2066,2064,2061,2058,2053,2050,2048,2048,2048,2050,2051,2053,2054,2054,2053,2051,2050,2051,2052,2054,2057,2060,2062,2062,2061,2059,2057,2054,2051,2047,2044,2042,2040,2041,2043,2045,2047,2049,2049,2049,2049,2049,2051,2053,2055,2056,2057,2057,2056,2055,2054,2052,2051,2050,2049,2049,2049,2050,2050,2050,2048,2045,2041,2037,2034,2032,2032,2033,2034,2034,2034,2034,2035,2037,2040,2044,2049,2055,2060,2063,2066,2067,2066,2063,2058,2054,2049,2045,2042,2040,2039,2039,2039,2040,2042,2043,2044,2044,2043,2041,2039,2036,2035,2034,2036,2039,2043,2046,2047,2047,2047,2047,2046,2046,2046,2045,2045,2044,2044,2043,2042,2042,2042,2042,2041,2042,2043,2045,2048,2051,2055,2058,2059,2060,2060,2059,2058,2056,2054,2052,2049,2047,2045,2044,2042,2041,2041,2041,2042,2043,2044,2046,2048,2051,2052,2053,2052,2052,2051,2050,2049,2047,2046,2045,2046,2047,2048,2048,2047,2045,2043,2041,2041,2042,2044,2045,2046,2046,2046,2045,2043,2043,2043,2045,2046,2047,2048,2048,2048,2048,2048,2047,2046,2045,2044,2045,2046,2046,2046,2047,2048,2049,2050,2050,2050,2049,2050,2051,2052,2053,2054,2055,2056,2058,2059,2061,2063,2064,2064,2063,2060,2057,2053,2050,2046,2043,2042,2040,2039,2036,2033,2029,2026,2024,2023,2023,2024,2025,2026,2028,2030,2032,2034,2037,2041,2045,2048,2049,2049,2048,2046,2046,2045,2044,2043,2044,2045,2047,2050,2053,2056,2058,2059,2059,2056,2053,2049,2045,2041,2038,2037,2036,2036,2035,2035,2036,2038,2039,2040,2041,2042,2042,2042,2042,2042,2042,2044,2046,2047,2049,2050,2051,2051,2051,2049,2046,2042,2039,2038,2037,2038,2038,2038,2038,2038,2039,2040,2041,2040,2038,2035,2033,2031,2031,2031,2032,2034,2036,2038,2040,2042,2043,2043,2041,2040,2039,2040,2042,2044,2045,2045,2045,2043,2041,2039,2037,2036,2036,2036,2037,2040,2043,2046,2048,2048,2047,2045,2043,2040,2038,2036,2035,2033,2032,2032,2033,2034,2036,2038,2039,2040,2040,2040,2037,2035,2033,2032,2032,2033,2035,2037,2039,2039,2039,2038,2037,2035,2034,2033,2034,2034,2035,2036,2037,2037,2037,2037,2037,2037,2037,2037,2037,2037,2038,2039,2041,2044,2046,2048,2049,2050,2051,2051,2049,2047,2045,2043,2041,2040,2039,2039,2039,2039,2040,2041,2042,2042,2041,2040,2038,2038,2038,2038,2039,2039,2039,2039,2039,2038,2037,2036,2035,2036,2037,2038,2040,2042,2044,2045,2045,2044,2041,2037,2035,2033,2034,2035,2038,2041,2045,2050,2054,2056,2058,2058,2057,2055,2052,2048,2044,2040,2038,2038,2040,2043,2046,2049,2050,2050,2050,2048,2045,2042,2039,2037,2036,2036,2038,2041,2044,2047,2048,2049,2048,2048,2048,2047,2046,2046,2046,2046,2047,2047,2049,2050,2052,2053,2053,2053,2053,2053,2052,2050,2047,2043,2041,2040,2040,2041,2042,2044,2045,2047,2050,2055,2059,2062,2065,2066,2067,2066,2064,2061,2059,2056,2054,2053,2053,2054,2056,2057,2057,2057,2056,2055,2052,2049,2046,2044,2043,2042,2040,2039,2038,2039,2040,2041,2042,2042,2043,2044,2046,2048,2051,2055,2057,2059,2059,2059,2057,2054,2052,2051,2050,2052,2055,2057,2060,2061,2063,2064,2065,2066,2066,2065,2065,2064,2062,2060,2057,2053,2049,2045,2042,2039,2038,2038,2039,2040,2042,2045,2048,2052,2055,2058,2061,2062,2063,2062,2061,2059,2059,2059,2059,2060,2059,2059,2059,2059,2057,2054,2050,2046,2043,2040,2038,2038,2040,2043,2047,2051,2054,2056,2056,2055,2054,2053,2052,2050,2049,2048,2047,2047,2047,2048,2049,2050,2050,2048,2045,2043,2041,2040,2040,2042,2044,2047,2050,2053,2055,2057,2058,2058,2058,2056,2054,2052,2050,2050,2051,2053,2055,2056,2056,2055,2053,2052,2051,2050,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2048,2047,2045,2043,2042,2041,2042,2043,2044,2044,2045,2045,2045,2046,2045,2045,2044,2043,2042,2042,2043,2045,2047,2049,2051,2054,2056,2057,2058,2057,2056,2055,2053,2052,2050,2050,2050,2051,2052,2055,2057,2059,2061,2061,2061,2059,2058,2055,2054,2052,2052,2052,2052,2053,2053,2053,2052,2050,2048,2044,2041,2037,2036,2035,2035,2034,2033,2032,2030,2029,2029,2028,2028,2030,2033,2038,2044,2049,2052,2055,2057,2059,2060,2061,2060,2059,2057,2055,2053,2051,2048,2047,2044,2042,2040,2038,2037,2037,2038,2040,2042,2044,2046,2049,2052,2056,2059,2061,2060,2058,2055,2050,2047,2046,2047,2049,2051,2052,2052,2052,2051,2049,2048,2045,2042,2039,2035,2033,2031,2031,2031,2032,2034,2035,2037,2039,2043,2047,2051,2054,2054,2052,2047,2041,2035,2028,2023,2020,2018,2018,2019,2021,2024,2028,2034,2040,2046,2052,2057,2061,2064,2064,2064,2061,2059,2055,2051,2048,2044,2042,2041,2041,2042,2041,2040,2038,2036,2034,2033,2032,2031,2030,2030,2031,2031,2031,2032,2034,2036,2038,2040,2041,2043,2044,2045,2046,2046,2045,2044,2041,2038,2034,2031,2029,2030,2032,2035,2037,2038,2041,2043,2045,2046,2047,2048,2049,2050,2052,2054,2055,2055,2055,2054,2052,2049,2047,2044,2042,2042,2041,2042,2042,2042,2042,2041,2040,2040,2038,2037,2037,2037,2037,2036,2035,2035,2036,2037,2039,2041,2042,2042,2041,2038,2035,2033,2032,2033,2034,2035,2037,2040,2042,2045,2047,2049,2050,2051,2052,2052,2052,2051,2051,2051,2052,2054,2055,2055,2054,2052,2049,2046,2043,2041,2041,2042,2046,2050,2053,2056,2057,2057,2054,2050,2047,2045,2044,2044,2045,2046,2047,2048,2048,2049,2048,2046,2042,2037,2033,2030,2029,2029,2031,2033,2036,2039,2042,2046,2048,2051,2052,2053,2055,2055,2056,2056,2057,2057,2055,2054,2052,2050,2048,2047,2046,2045,2044,2044,2044,2044,2042,2040,2038,2036,2035,2036,2038,2041,2045,2048,2052,2054,2056,2057,2057,2056,2054,2052,2049,2046,2043,2042,2043,2044,2047,2050,2053,2057,2060,2062,2062,2062,2061,2059,2056,2053,2050,2047,2043,2041,2041,2042,2045,2048,2051,2054,2056,2057,2057,2056,2054,2052,2050,2050,2050,2050,2052,2055,2058,2061,2064,2066,2068,2068,2066,2064,2061,2059,2057,2055,2053,2052,2050,2048,2048,2048,2047,2047,2047,2047,2048,2049,2050,2051,2052,2053,2052,2051,2049,2049,2049,2050,2051,2051,2051,2052,2053,2054,2057,2059,2061,2063,2064,2065,2064,2062,2059,2056,2052,2049,2046,2045,2044,2043,2044,2046,2048,2050,2052,2054,2056,2056,2056,2056,2055,2053,2052,2051,2051,2052,2053,2055,2056,2056,2056,2054,2052,2050,2049,2049,2049,2050,2052,2054,2056,2058,2058,2057,2055,2052,2049,2047,2045,2044,2044,2044,2045,2047,2049,2050,2051,2052,2051,2049,2047,2046,2046,2048,2050,2053,2055,2057,2057,2058,2057,2057,2056,2054,2052,2049,2046,2044,2042,2041,2040,2039,2039,2040,2040,2039,2040,2042,2046,2050,2053,2056,2057,2056,2055,2054,2053,2052,2051,2049,2048,2047,2047,2047,2048,2048,2047,2045,2043,2042,2043,2044,2045,2046,2046,2044,2043,2042,2042,2041,2041,2041,2041,2041,2041,2041,2042,2042,2042,2042,2042,2042,2043,2043,2044,2045,2046,2047,2047,2047,2046,2044,2043,2042,2041,2041,2041,2041,2040,2040,2039,2039,2038,2038,2038,2038,2039,2039,2039,2040,2041,2043,2044,2045,2046,2046,2047,2048,2049,2049,2049,2049,2048,2048,2047,2047,2046,2045,2044,2043,2043,2044,2044,2043,2041,2039,2037,2036,2035,2035,2036,2037,2040,2043,2046,2050,2053,2054,2055,2055,2055,2055,2055,2055,2054,2053,2052,2051,2051,2049,2048,2045,2043,2042,2041,2041,2041,2041,2040,2039,2038,2037,2038,2040,2043,2045,2047,2048,2048,2048,2047,2046,2044,2042,2041,2040,2039,2039,2040,2041,2044,2046,2047,2048,2048,2048,2049,2051,2053,2054,2055,2057,2058,2059,2058,2056,2052,2048,2044,2040,2037,2036,2036,2038,2041,2045,2049,2053,2056,2058,2059,2060,2059,2057,2055,2053,2050,2046,2044,2042,2042,2041,2041,2040,2040,2040,2040,2041,2042,2043,2044,2047,2050,2053,2056,2057,2057,2057,2057,2056,2056,2057,2059,2060,2061,2061,2060,2059,2057,2056,2054,2052,2050,2049,2047,2046,2045,2045,2044,2044,2043,2043,2042,2041,2041,2042,2043,2044,2045,2044,2043,2041,2039,2039,2039,2041,2043,2047,2050,2053,2056,2058,2059,2059,2059,2057,2054,2051,2048,2046,2045,2044,2045,2046,2048,2049,2050,2052,2054,2055,2057,2058,2058,2058,2058,2057,2056,2055,2054,2053,2053,2053,2053,2054,2055,2055,2055,2054,2053,2052,2052,2052,2052,2051,2050,2048,2047,2046,2046,2046,2047,2048,2049,2051,2051,2051,2051,2050,2049,2048,2047,2047,2048,2049,2051,2053,2054,2055,2055,2055,2054,2052,2049,2046,2044,2042,2042,2042,2043,2045,2046,2048,2049,2050,2051,2053,2054,2055,2056,2056,2055,2053,2050,2048,2045,2043,2041,2040,2039,2039,2039,2040,2041,2042,2044,2046,2049,2052,2054,2055,2055,2054,2053,2051,2050,2049,2049,2048,2047,2047,2047,2047,2048,2048,2049,2049,2049,2049,2049,2048,2048,2047,2046,2045,2043,2042,2040,2039,2037,2036,2035,2035,2036,2038,2039,2041,2043,2044,2045,2046,2045,2045,2043,2042,2041,2040,2040,2040,2040,2040,2040,2039,2039,2040,2040,2041,2041,2042,2043,2044,2044,2045,2045,2045,2045,2046,2046,2046,2045,2044,2043,2042,2042,2041,2040,2040,2039,2038,2037,2037,2038,2039,2042,2045,2048,2050,2051,2052,2052,2051,2049,2046,2043,2039,2035,2033,2032,2031,2032,2034,2037,2039,2041,2042,2043,2044,2045,2046,2047,2049,2051,2053,2055,2056,2056,2056,2055,2053,2051,2049,2047,2046,2044,2043,2042,2042,2041,2041,2040,2040,2040,2040,2040,2040,2039,2040,2041,2043,2045,2047,2048,2050,2050,2051,2051,2052,2052,2053,2053,2052,2051,2050,2049,2048,2048,2048,2048,2048,2047,2046,2045,2044,2043,2043,2043,2042,2043,2043,2044,2044,2043,2042,2039,2036,2034,2033,2033,2034,2036,2039,2041,2043,2044,2044,2043,2043,2043,2044,2045,2046,2047,2048,2049,2050,2052,2052,2052,2051,2049,2047,2044,2043,2042,2041,2041,2042,2043,2045,2046,2048,2049,2049,2048,2047,2046,2045,2045,2044,2045,2046,2046,2046,2045,2044,2044,2045,2046,2048,2049,2050,2050,2051,2052,2053,2054,2054,2055,2054,2053,2051,2049,2048,2046,2044,2041,2038,2037,2037,2038,2041,2045,2049,2053,2055,2057,2057,2056,2055,2055,2055,2055,2054,2052,2048,2044,2041,2040,2039,2040,2042,2044,2046,2049,2050,2052,2053,2053,2053,2052,2051,2051,2051,2052,2053,2054,2054,2055,2054,2054,2054,2054,2054,2055,2054,2052,2050,2049,2050,2051,2052,2053,2053,2051,2050,2049,2049,2050,2050,2050,2049,2049,2048,2047,2047,2046,2045,2044,2043,2041,2040,2039,2039,2040,2043,2047,2050,2053,2055,2056,2057,2057,2056,2055,2054,2053,2053,2053,2053,2052,2050,2049,2047,2045,2044,2045,2046,2049,2051,2054,2056,2057,2057,2056,2055,2052,2048,2045,2043,2042,2042,2042,2042,2042,2043,2042,2040,2038,2036,2034,2032,2031,2032,2033,2035,2037,2039,2040,2041,2042,2043,2045,2045,2046,2047,2049,2049,2048,2047,2045,2044,2044,2044,2046,2047,2049,2049,2048,2048,2049,2050,2051,2052,2053,2053,2053,2051,2049,2047,2045,2044,2043,2042,2042,2041,2041,2040,2039,2040,2041,2044,2047,2050,2052,2053,2053,2052,2050,2048,2045,2042,2040,2039,2040,2042,2044,2046,2047,2048,2048,2048,2048,2048,2048,2047,2046,2046,2045,2045,2046,2047,2049,2051,2054,2055,2056,2057,2057,2057,2057,2057,2055,2052,2049,2045,2043,2042,2042,2042,2042,2041,2040,2039,2038,2038,2038,2039,2040,2041,2043,2044,2046,2048,2051,2054,2058,2062,2064,2064,2062,2058,2053,2048,2045,2042,2041,2041,2041,2042,2043,2042,2041,2038,2036,2034,2033,2034,2036,2038,2040,2043,2046,2050,2054,2056,2056,2053,2050,2046,2044,2042,2041,2041,2042,2045,2047,2048,2049,2050,2051,2051,2051,2049,2047,2044,2041,2037,2033,2030,2028,2027,2027,2028,2028,2030,2031,2033,2036,2039,2042,2044,2045,2046,2046,2045,2045,2044,2043,2042,2040,2039,2039,2040,2042,2045,2048,2050,2052,2052,2051,2050,2048,2046,2045,2045,2044,2044,2043,2044,2045,2046,2048,2049,2050,2052,2053,2054,2054,2051,2048,2044,2041,2040,2039,2037,2035,2033,2032,2031,2032,2033,2034,2035,2038,2040,2044,2048,2052,2055,2056,2056,2056,2056,2054,2050,2046,2040,2036,2034,2033,2034,2036,2041,2046,2052,2057,2060,2062,2063,2061,2059,2057,2055,2055,2055,2056,2057,2058,2058,2057,2055,2053,2051,2048,2046,2045,2045,2046,2047,2048,2049,2050,2051,2052,2053,2053,2052,2051,2050,2049,2049,2050,2052,2054,2056,2057,2059,2061,2062,2062,2060,2057,2054,2051,2048,2047,2047,2047,2048,2049,2049,2049,2048,2048,2048,2050,2052,2055,2056,2056,2055,2054,2053,2054,2055,2056,2058,2060,2061,2061,2062,2062,2063,2063,2063,2061,2058,2055,2053,2052,2053,2054,2056,2058,2058,2058,2058,2057,2055,2054,2052,2051,2051,2052,2052,2053,2054,2055,2057,2059,2059,2059,2056,2054,2051,2049,2047,2046,2044,2042,2040,2039,2038,2038,2037,2038,2039,2040,2043,2046,2050,2054,2057,2059,2059,2059,2058,2057,2056,2055,2055,2055,2055,2056,2056,2055,2054,2053,2052,2051,2049,2048,2048,2048,2050,2051,2053,2054,2056,2058,2058,2057,2054,2051,2049,2047,2046,2046,2046,2046,2046,2047,2049,2050,2050,2049,2047,2044,2043,2042,2042,2043,2043,2043,2044,2045,2044,2044,2043,2044,2045,2047,2049,2049,2049,2048,2046,2046,2046,2046,2046,2046,2046,2048,2050,2054,2057,2058,2059,2058,2057,2056,2054,2051,2048,2045,2042,2039,2036,2035,2035,2035,2033,2031,2030,2030,2031,2033,2035,2038,2039,2039,2038,2037,2036,2035,2034,2034,2034,2036,2038,2041,2042,2043,2044,2046,2048,2048,2046,2044,2041,2038,2036,2036,2036,2036,2036,2036,2036,2037,2039,2041,2043,2045,2047,2049,2049,2049,2047,2045,2042,2039,2037,2035,2035,2037,2040,2043,2045,2047,2048,2048,2048,2047,2045,2044,2043,2043,2043,2042,2040,2038,2035,2033,2032,2033,2033,2034,2034,2034,2034,2036,2038,2040,2042,2044,2045,2046,2047,2048,2048,2049,2050,2051,2051,2051,2052,2052,2051,2050,2048,2047,2046,2045,2044,2044,2043,2043,2043,2042,2042,2041,2040,2040,2039,2039,2038,2038,2038,2038,2039,2041,2043,2045,2046,2046,2046,2045,2045,2045,2045,2044,2043,2043,2044,2045,2046,2047,2047,2047,2047,2048,2048,2048,2048,2049,2050,2052,2052,2052,2050,2048,2045,2043,2041,2039,2038,2038,2040,2042,2044,2045,2046,2047,2048,2048,2049,2049,2048,2047,2046,2044,2043,2041,2040,2038,2037,2036,2036,2036,2037,2037,2037,2036,2035,2035,2036,2038,2040,2042,2044,2045,2047,2048,2048,2048,2046,2043,2041,2039,2037,2037,2036,2037,2038,2039,2040,2040,2039,2037,2035,2033,2033,2033,2034,2036,2037,2039,2040,2041,2041,2040,2039,2038,2037,2037,2038,2040,2043,2046,2048,2049,2050,2050,2049,2048,2047,2045,2043,2041,2040,2039,2038,2038,2039,2040,2041,2042,2042,2042,2042,2041,2039,2037,2035,2033,2032,2032,2033,2035,2037,2040,2043,2045,2047,2049,2051,2052,2052,2052,2051,2050,2048,2046,2044,2042,2040,2038,2036,2035,2034,2033,2032,2033,2035,2038,2041,2044,2047,2049,2051,2052,2052,2052,2051,2050,2049,2047,2046,2045,2044,2044,2045,2046,2048,2049,2051,2052,2052,2051,2050,2048,2047,2047,2048,2049,2051,2052,2054,2054,2053,2051,2048,2045,2043,2040,2039,2038,2039,2040,2042,2044,2046,2047,2049,2050,2051,2053,2055,2058,2060,2061,2061,2061,2062,2061,2059,2057,2055,2052,2050,2048,2047,2046,2047,2047,2048,2049,2050,2051,2052,2053,2054,2054,2055,2055,2055,2055,2055,2056,2057,2058,2058,2057,2057,2057,2058,2059,2059,2059,2057,2057,2057,2057,2058,2057,2055,2053,2051,2051,2051,2052,2052,2051,2050,2049,2049,2048,2047,2046,2047,2048,2051,2055,2060,2064,2066,2067,2067,2066,2065,2063,2061,2058,2057,2056,2055,2056,2056,2056,2056,2054,2053,2052,2051,2051,2051,2051,2051,2051,2052,2053,2054,2054,2054,2053,2052,2051,2051,2051,2052,2052,2052,2051,2050,2049,2048,2047,2047,2048,2050,2051,2052,2052,2052,2051,2050,2049,2047,2045,2044,2043,2042,2043,2044,2046,2048,2049,2049,2048,2046,2044,2040,2038,2036,2035,2036,2036,2036,2036,2037,2038,2040,2043,2045,2048,2050,2051,2051,2051,2050,2048,2044,2041,2037,2035,2034,2034,2034,2036,2038,2040,2041,2042,2043,2043,2043,2042,2041,2040,2039,2038,2038,2038,2039,2040,2042,2044,2047,2048,2049,2049,2050,2049,2047,2045,2042,2039,2037,2035,2035,2035,2035,2035,2035,2034,2034,2035,2036,2037,2040,2042,2044,2046,2047,2048,2049,2049,2050,2052,2053,2055,2057,2057,2057,2055,2053,2050,2047,2044,2042,2040,2038,2035,2033,2032,2031,2032,2033,2035,2037,2039,2042,2044,2047,2048,2048,2048,2047,2047,2048,2049,2051,2053,2054,2055,2055,2055,2054,2054,2054,2054,2055,2055,2055,2055,2054,2054,2054,2054,2053,2052,2051,2049,2048,2047,2046,2046,2046,2046,2046,2045,2046,2047,2049,2052,2053,2054,2054,2053,2052,2052,2051,2051,2050,2050,2050,2049,2049,2048,2048,2049,2049,2048,2047,2046,2046,2047,2048,2050,2052,2055,2057,2059,2060,2062,2062,2062,2061,2059,2057,2055,2053,2052,2051,2049,2048,2046,2046,2045,2046,2047,2049,2051,2053,2054,2054,2054,2054,2053,2052,2051,2049,2048,2047,2048,2049,2049,2050,2050,2051,2053,2054,2056,2057,2058,2058,2058,2057,2055,2052,2049,2046,2044,2043,2043,2044,2045,2047,2048,2051,2052,2053,2053,2053,2051,2050,2048,2046,2045,2044,2044,2044,2045,2045,2046,2046,2048,2050,2051,2053,2053,2052,2052,2051,2050,2050,2049,2049,2048,2048,2049,2049,2048,2048,2048,2047,2047,2047,2046,2045,2044,2042,2041,2040,2040,2039,2039,2040,2041,2041,2041,2041,2040,2039,2038,2037,2036,2036,2036,2037,2039,2039,2040,2039,2039,2040,2040,2041,2042,2043,2044,2045,2045,2045,2044,2044,2043,2042,2042,2041,2040,2039,2038,2037,2036,2035,2035,2035,2036,2039,2042,2045,2048,2050,2051,2050,2047,2045,2042,2040,2039,2039,2040,2041,2041,2041,2040,2039,2038,2036,2036,2036,2038,2041,2045,2048,2051,2052,2053,2053,2052,2050,2048,2045,2041,2038,2036,2034,2032,2032,2031,2031,2031,2032,2033,2035,2038,2041,2044,2046,2047,2046,2045,2044,2044,2044,2044,2045,2045,2046,2047,2048,2047,2046,2045,2043,2042,2040,2040,2039,2040,2041,2042,2044,2045,2045,2045,2044,2043,2041,2039,2038,2038,2039,2041,2044,2046,2049,2050,2050,2050,2048,2046,2044,2042,2040,2038,2036,2035,2036,2036,2037,2038,2039,2040,2042,2046,2049,2053,2057,2060,2062,2064,2064,2063,2061,2059,2058,2056,2055,2055,2054,2054,2054,2054,2055,2056,2057,2057,2056,2054,2051,2047,2043,2039,2036,2033,2031,2029,2029,2031,2033,2036,2038,2040,2042,2043,2045,2048,2050,2052,2054,2055,2056,2056,2055,2055,2055,2054,2054,2054,2053,2051,2049,2047,2046,2045,2044,2043,2042,2041,2040,2040,2042,2044,2047,2050,2052,2053,2053,2052,2050,2047,2044,2041,2040,2040,2041,2043,2045,2048,2049,2050,2049,2049,2048,2047,2047,2047,2047,2047,2046,2046,2044,2042,2041,2040,2040,2041,2042,2042,2042,2041,2041,2040,2039,2039,2040,2040,2042,2043,2046,2048,2051,2054,2057,2059,2060,2060,2059,2058,2056,2054,2053,2051,2049,2048,2047,2046,2045,2045,2043,2042,2040,2038,2036,2035,2034,2033,2034,2036,2038,2042,2045,2047,2048,2048,2047,2046,2046,2046,2046,2046,2046,2046,2046,2047,2048,2049,2051,2053,2055,2057,2058,2058,2057,2054,2051,2048,2046,2044,2043,2042,2042,2042,2042,2044,2045,2046,2047,2048,2049,2049,2048,2048,2048,2048,2049,2050,2051,2051,2051,2050,2049,2048,2047,2047,2048,2049,2050,2050,2049,2048,2047,2046,2046,2045,2045,2045,2045,2046,2048,2049,2049,2050,2050,2050,2049,2048,2047,2046,2046,2047,2048,2050,2052,2053,2054,2053,2053,2052,2051,2051,2051,2050,2050,2051,2051,2052,2052,2051,2050,2048,2047,2046,2045,2045,2045,2046,2048,2050,2052,2054,2056,2057,2059,2061,2062,2062,2062,2061,2060,2058,2056,2054,2052,2049,2047,2046,2045,2045,2046,2047,2048,2048,2049,2049,2049,2049,2049,2050,2051,2052,2052,2052,2053,2054,2055,2058,2060,2061,2062,2061,2058,2056,2053,2050,2048,2047,2047,2048,2050,2051,2052,2052,2051,2048,2045,2041,2039,2038,2037,2037,2036,2037,2038,2040,2043,2048,2053,2057,2060,2061,2060,2057,2054,2050,2046,2042,2039,2037,2036,2037,2038,2041,2043,2045,2046,2047,2047,2048,2049,2049,2050,2050,2049,2047,2045,2043,2042,2040,2039,2037,2036,2036,2036,2036,2037,2038,2039,2040,2042,2043,2043,2044,2044,2045,2047,2048,2049,2050,2052,2053,2054,2054,2054,2054,2055,2054,2052,2050,2047,2044,2042,2040,2040,2041,2042,2044,2045,2046,2046,2046,2046,2046,2045,2044,2042,2041,2039,2038,2037,2037,2037,2039,2041,2043,2044,2046,2047,2047,2047,2045,2043,2039,2036,2033,2031,2030,2029,2030,2031,2034,2036,2039,2042,2044,2045,2046,2047,2048,2050,2051,2052,2054,2055,2056,2056,2056,2056,2056,2056,2056,2054,2052,2050,2047,2044,2042,2040,2038,2036,2034,2032,2031,2030,2031,2032,2033,2035,2037,2038,2040,2042,2045,2047,2049,2051,2051,2051,2051,2049,2047,2045,2043,2041,2040,2040,2039,2039,2039,2039,2040,2040,2040,2040,2039,2038,2037,2037,2038,2039,2042,2046,2049,2052,2053,2054,2053,2052,2052,2052,2054,2055,2055,2055,2053,2051,2048,2045,2043,2042,2042,2043,2043,2043,2043,2044,2043,2043,2042,2041,2041,2041,2041,2041,2041,2040,2039,2038,2038,2038,2040,2042,2044,2045,2046,2047,2047,2048,2048,2048,2047,2045,2043,2041,2039,2038,2036,2036,2037,2038,2041,2044,2047,2049,2051,2053,2054,2055,2056,2057,2058,2059,2059,2059,2058,2057,2055,2053,2051,2049,2047,2045,2043,2042,2042,2042,2042,2041,2040,2039,2037,2036,2036,2037,2037,2038,2038,2038,2039,2040,2042,2044,2045,2047,2048,2048,2048,2047,2046,2045,2045,2044,2044,2044,2043,2043,2043,2044,2046,2048,2048,2048,2047,2046,2044,2042,2040,2038,2037,2037,2038,2041,2044,2046,2049,2051,2052,2053,2054,2054,2054,2053,2052,2050,2048,2046,2044,2043,2042,2042,2042,2041,2041,2040,2039,2039,2039,2039,2040,2041,2042,2043,2043,2044,2044,2045,2045,2045,2045,2045,2044,2043,2041,2040,2040,2041,2042,2045,2048,2052,2055,2057,2058,2058,2057,2055,2054,2053,2051,2050,2048,2046,2043,2041,2039,2039,2040,2042,2045,2047,2049,2050,2050,2051,2051,2050,2050,2049,2048,2047,2046,2045,2043,2041,2039,2037,2036,2035,2035,2036,2038,2041,2045,2049,2052,2055,2057,2058,2059,2059,2060,2060,2060,2059,2058,2057,2056,2055,2054,2052,2051,2050,2050,2051,2052,2054,2055,2055,2055,2054,2053,2052,2052,2052,2051,2050,2049,2047,2046,2045,2045,2045,2047,2048,2051,2053,2056,2059,2060,2060,2060,2060,2060,2060,2060,2059,2058,2056,2053,2050,2048,2046,2046,2046,2048,2049,2051,2052,2053,2053,2054,2054,2055,2056,2057,2058,2059,2059,2060,2060,2059,2059,2058,2058,2058,2057,2056,2055,2053,2052,2051,2051,2051,2050,2050,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2052,2053,2053,2054,2054,2054,2054,2054,2054,2055,2056,2057,2058,2059,2059,2060,2060,2060,2059,2059,2058,2057,2055,2054,2053,2052,2052,2052,2053,2054,2054,2054,2054,2053,2052,2051,2051,2050,2050,2049,2049,2048,2047,2047,2046,2045,2043,2042,2041,2040,2040,2040,2040,2041,2041,2042,2043,2044,2046,2049,2051,2054,2057,2060,2062,2063,2062,2061,2060,2058,2057,2055,2053,2052,2050,2049,2048,2046,2045,2043,2042,2040,2038,2037,2037,2037,2038,2038,2039,2040,2040,2039,2038,2037,2037,2037,2038,2040,2043,2046,2050,2054,2057,2059,2061,2061,2060,2058,2056,2053,2050,2047,2045,2043,2040,2037,2034,2030,2027,2026,2025,2026,2027,2028,2030,2032,2033,2036,2038,2041,2043,2045,2047,2049,2052,2054,2056,2057,2058,2057,2056,2053,2050,2047,2044,2041,2038,2036,2034,2033,2031,2030,2029,2028,2027,2027,2028,2030,2032,2034,2036,2038,2041,2043,2046,2049,2049,2049,2049,2049,2049,2049,2048,2046,2045,2044,2043,2041,2039,2038,2037,2037,2037,2038,2039,2040,2041,2042,2043,2044,2044,2044,2044,2044,2044,2044,2043,2042,2041,2040,2039,2038,2038,2039,2041,2043,2045,2046,2047,2048,2048,2049,2049,2048,2047,2046,2046,2045,2045,2045,2045,2045,2046,2047,2048,2048,2048,2047,2046,2045,2044,2042,2040,2039,2038,2038,2040,2042,2044,2046,2047,2048,2048,2047,2047,2048,2048,2049,2050,2050,2050,2050,2051,2051,2052,2052,2053,2053,2052,2051,2050,2048,2047,2046,2046,2046,2045,2045,2045,2044,2045,2045,2047,2049,2051,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2050,2050,2051,2051,2051,2051,2051,2050,2050,2050,2051,2053,2055,2056,2057,2057,2055,2053,2050,2047,2046,2046,2047,2049,2051,2053,2055,2056,2056,2055,2053,2051,2050,2049,2048,2048,2049,2050,2051,2051,2051,2051,2051,2051,2052,2052,2053,2053,2054,2054,2053,2051,2050,2049,2050,2050,2051,2051,2051,2052,2052,2052,2051,2051,2051,2050,2050,2050,2049,2049,2048,2049,2050,2050,2051,2051,2050,2050,2049,2049,2048,2048,2048,2048,2049,2051,2052,2054,2056,2057,2057,2058,2057,2055,2053,2050,2047,2045,2043,2042,2041,2041,2041,2041,2041,2042,2043,2044,2046,2047,2049,2050,2051,2052,2053,2053,2053,2051,2050,2048,2046,2045,2044,2043,2043,2042,2042,2043,2044,2045,2047,2050,2053,2056,2059,2061,2061,2060,2058,2055,2052,2048,2046,2044,2043,2043,2044,2045,2047,2048,2049,2050,2051,2052,2052,2052,2052,2051,2050,2050,2050,2049,2049,2048,2046,2045,2044,2042,2041,2040,2039,2039,2040,2042,2044,2046,2048,2050,2050,2050,2048,2047,2046,2047,2048,2050,2051,2051,2051,2050,2049,2048,2048,2048,2049,2049,2049,2048,2047,2047,2046,2046,2046,2047,2048,2048,2048,2048,2047,2046,2045,2044,2044,2045,2046,2047,2048,2049,2050,2050,2049,2047,2046,2046,2046,2046,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2048,2049,2049,2049,2049,2049,2049,2048,2048,2047,2048,2048,2049,2050,2050,2050,2050,2050,2050,2051,2051,2050,2049,2047,2045,2043,2041,2039,2038,2038,2038,2039,2040,2041,2043,2046,2049,2052,2054,2055,2057,2058,2058,2058,2058,2057,2055,2054,2053,2052,2051,2050,2048,2047,2045,2044,2042,2042,2042,2042,2044,2045,2047,2049,2050,2051,2051,2050,2049,2048,2047,2046,2045,2045,2044,2043,2042,2042,2041,2041,2041,2042,2042,2043,2044,2046,2047,2048,2048,2048,2047,2047,2048,2048,2049,2049,2049,2049,2048,2048,2046,2045,2043,2041,2041,2041,2041,2042,2042,2042,2042,2042,2042,2043,2044,2044,2045,2046,2047,2048,2049,2050,2050,2051,2051,2050,2050,2049,2048,2047,2046,2046,2046,2047,2048,2049,2050,2051,2050,2050,2049,2049,2048,2048,2048,2047,2046,2046,2045,2046,2046,2047,2048,2047,2047,2045,2044,2044,2044,2046,2047,2049,2049,2049,2050,2050,2051,2051,2050,2049,2046,2044,2042,2040,2040,2039,2040,2040,2040,2039,2039,2039,2039,2039,2040,2041,2042,2044,2046,2048,2050,2052,2054,2055,2056,2057,2057,2057,2057,2056,2055,2052,2050,2047,2045,2043,2042,2042,2041,2041,2041,2042,2043,2045,2046,2048,2049,2051,2053,2054,2054,2053,2051,2049,2047,2046,2045,2045,2045,2044,2043,2042,2042,2042,2041,2042,2043,2045,2047,2049,2052,2054,2056,2058,2059,2059,2058,2056,2054,2053,2052,2051,2051,2050,2051,2051,2051,2051,2051,2050,2050,2051,2052,2054,2055,2055,2056,2056,2057,2058,2058,2059,2059,2058,2057,2056,2055,2053,2052,2051,2050,2049,2048,2047,2045,2045,2044,2044,2044,2044,2044,2045,2045,2046,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2047,2049,2053,2056,2058,2059,2060,2059,2057,2055,2053,2050,2047,2045,2043,2043,2044,2045,2046,2047,2047,2047,2046,2045,2045,2044,2044,2044,2044,2044,2045,2046,2047,2048,2049,2050,2051,2052,2053,2053,2053,2053,2052,2052,2052,2052,2052,2051,2050,2048,2047,2047,2048,2050,2051,2053,2055,2056,2057,2057,2058,2057,2056,2054,2052,2049,2046,2044,2043,2042,2041,2041,2040,2040,2040,2040,2040,2041,2043,2045,2048,2050,2051,2051,2051,2052,2051,2051,2050,2049,2048,2048,2048,2049,2050,2051,2052,2052,2052,2052,2052,2052,2052,2053,2054,2055,2056,2056,2055,2054,2052,2050,2048,2045,2043,2042,2041,2041,2041,2042,2043,2044,2045,2047,2048,2049,2050,2051,2052,2053,2053,2052,2051,2049,2047,2046,2045,2045,2047,2049,2051,2052,2053,2054,2054,2053,2052,2051,2049,2048,2047,2047,2046,2045,2045,2044,2043,2042,2041,2041,2041,2041,2042,2043,2044,2045,2047,2049,2050,2051,2051,2051,2050,2049,2047,2046,2044,2043,2043,2043,2043,2045,2046,2048,2049,2050,2052,2052,2052,2052,2051,2050,2049,2048,2048,2047,2046,2046,2046,2046,2046,2045,2046,2046,2047,2048,2049,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2046,2045,2043,2043,2042,2043,2044,2045,2047,2049,2051,2052,2053,2053,2053,2051,2050,2049,2049,2049,2049,2049,2048,2047,2045,2044,2044,2045,2045,2046,2046,2047,2047,2048,2049,2051,2052,2053,2054,2053,2052,2051,2049,2048,2047,2047,2048,2049,2051,2052,2053,2054,2053,2052,2051,2049,2048,2047,2047,2046,2047,2047,2048,2050,2052,2054,2056,2056,2056,2055,2053,2050,2048,2047,2048,2049,2051,2054,2055,2055,2055,2053,2052,2050,2048,2047,2045,2044,2043,2042,2041,2041,2042,2043,2045,2046,2048,2049,2051,2052,2054,2055,2056,2056,2056,2056,2056,2056,2056,2056,2055,2053,2051,2048,2046,2045,2044,2044,2044,2044,2044,2044,2044,2045,2046,2048,2050,2052,2053,2054,2054,2054,2054,2053,2052,2051,2050,2049,2049,2048,2047,2046,2045,2045,2045,2045,2046,2047,2048,2049,2050,2051,2051,2051,2052,2052,2053,2053,2053,2053,2052,2051,2050,2049,2049,2050,2050,2051,2051,2052,2052,2053,2054,2054,2054,2054,2054,2053,2052,2051,2049,2047,2046,2045,2045,2044,2044,2044,2044,2044,2044,2044,2043,2042,2042,2042,2042,2043,2044,2045,2045,2046,2046,2047,2048,2048,2049,2048,2047,2045,2044,2043,2042,2042,2041,2041,2042,2043,2044,2045,2047,2049,2050,2051,2051,2051,2052,2052,2052,2052,2051,2050,2050,2049,2048,2047,2047,2046,2045,2045,2045,2046,2046,2047,2047,2048,2049,2049,2050,2050,2049,2047,2044,2042,2040,2040,2040,2041,2042,2043,2044,2046,2047,2047,2047,2046,2044,2042,2040,2039,2039,2039,2041,2043,2044,2045,2046,2047,2048,2050,2051,2053,2054,2054,2054,2052,2050,2048,2046,2044,2042,2041,2040,2039,2039,2040,2041,2042,2044,2045,2047,2049,2050,2051,2052,2052,2052,2051,2050,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2046,2046,2045,2045,2044,2044,2045,2045,2046,2046,2046,2046,2047,2047,2048,2049,2049,2049,2049,2050,2050,2051,2051,2051,2051,2051,2050,2051,2052,2052,2052,2051,2050,2049,2049,2048,2048,2047,2047,2046,2045,2044,2043,2043,2043,2044,2045,2047,2048,2049,2050,2050,2049,2048,2046,2043,2042,2041,2041,2043,2044,2045,2045,2044,2043,2043,2044,2045,2047,2050,2052,2053,2053,2053,2052,2052,2051,2051,2050,2049,2049,2047,2046,2044,2043,2041,2040,2040,2040,2041,2042,2043,2044,2044,2045,2045,2046,2047,2048,2049,2049,2049,2048,2047,2045,2044,2043,2043,2043,2043,2044,2046,2047,2047,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2046,2046,2045,2043,2042,2040,2039,2038,2037,2036,2036,2037,2039,2041,2043,2044,2045,2045,2046,2047,2048,2049,2049,2050,2050,2051,2052,2052,2052,2052,2051,2051,2051,2050,2050,2050,2049,2048,2046,2044,2043,2041,2041,2041,2042,2043,2044,2045,2046,2047,2048,2048,2049,2049,2049,2049,2049,2050,2050,2051,2051,2051,2051,2051,2051,2050,2049,2048,2047,2046,2046,2045,2045,2045,2044,2044,2045,2046,2047,2047,2048,2048,2048,2048,2048,2049,2049,2051,2052,2053,2053,2054,2054,2054,2055,2055,2055,2055,2055,2054,2053,2051,2049,2046,2044,2042,2041,2040,2041,2042,2043,2045,2046,2047,2049,2050,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2051,2050,2049,2047,2044,2042,2040,2039,2039,2040,2042,2044,2048,2052,2055,2057,2059,2060,2061,2060,2059,2056,2053,2051,2049,2047,2047,2047,2048,2049,2050,2051,2051,2051,2050,2050,2049,2049,2049,2049,2048,2047,2047,2048,2049,2051,2052,2052,2052,2051,2050,2049,2048,2047,2046,2045,2044,2043,2044,2044,2045,2045,2046,2047,2048,2049,2050,2050,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2051,2050,2049,2047,2044,2041,2039,2039,2039,2039,2040,2041,2042,2043,2044,2045,2045,2046,2046,2046,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2046,2046,2046,2047,2046,2046,2045,2045,2044,2045,2045,2046,2046,2046,2046,2046,2045,2045,2046,2046,2046,2047,2048,2050,2051,2052,2051,2050,2048,2047,2046,2045,2044,2043,2043,2043,2043,2044,2045,2047,2049,2050,2050,2050,2049,2048,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2050,2050,2049,2049,2048,2047,2046,2046,2045,2045,2045,2045,2046,2047,2048,2049,2050,2052,2053,2054,2055,2055,2055,2053,2051,2049,2045,2043,2041,2039,2038,2038,2039,2040,2041,2043,2045,2047,2050,2053,2056,2058,2060,2062,2063,2063,2063,2061,2059,2057,2053,2050,2046,2042,2039,2036,2035,2034,2034,2034,2034,2035,2036,2038,2040,2042,2045,2047,2049,2050,2050,2050,2049,2048,2048,2048,2048,2049,2049,2048,2047,2046,2045,2045,2045,2043,2042,2042,2041,2041,2041,2040,2041,2041,2042,2043,2044,2045,2046,2047,2049,2050,2051,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2050,2049,2048,2046,2045,2045,2044,2044,2044,2044,2045,2047,2048,2050,2050,2050,2050,2049,2048,2047,2046,2045,2045,2045,2045,2046,2046,2047,2047,2048,2048,2048,2047,2047,2046,2046,2046,2047,2048,2049,2050,2051,2052,2052,2052,2051,2051,2049,2048,2046,2044,2042,2041,2040,2039,2038,2038,2038,2038,2039,2041,2043,2045,2047,2049,2050,2051,2051,2052,2052,2053,2053,2053,2053,2052,2051,2049,2047,2044,2041,2039,2037,2036,2036,2037,2038,2039,2041,2044,2046,2048,2049,2050,2050,2049,2049,2049,2050,2049,2048,2047,2046,2046,2045,2045,2046,2046,2046,2046,2046,2046,2045,2044,2043,2042,2042,2042,2042,2043,2044,2045,2046,2047,2048,2049,2050,2050,2050,2049,2047,2044,2042,2039,2038,2037,2037,2038,2039,2041,2043,2045,2046,2047,2047,2047,2047,2047,2048,2049,2050,2050,2051,2051,2051,2051,2050,2049,2048,2046,2046,2046,2046,2047,2048,2049,2050,2052,2054,2055,2056,2056,2055,2053,2052,2050,2048,2047,2046,2046,2046,2045,2045,2046,2047,2047,2048,2048,2048,2049,2049,2050,2051,2052,2053,2053,2053,2053,2052,2051,2049,2048,2046,2046,2046,2047,2048,2050,2051,2053,2054,2055,2055,2054,2053,2052,2050,2048,2046,2043,2042,2041,2041,2042,2043,2046,2047,2049,2049,2049,2048,2047,2046,2045,2045,2045,2045,2046,2047,2048,2050,2051,2053,2053,2054,2053,2052,2050,2049,2047,2045,2044,2042,2042,2041,2041,2042,2043,2044,2046,2047,2049,2051,2051,2052,2052,2051,2050,2049,2047,2046,2045,2044,2044,2044,2044,2045,2046,2046,2047,2047,2046,2046,2047,2048,2050,2051,2053,2054,2054,2053,2052,2051,2051,2050,2049,2048,2046,2043,2041,2039,2038,2038,2038,2039,2038,2037,2036,2035,2034,2034,2034,2035,2036,2038,2040,2041,2043,2043,2044,2044,2044,2044,2045,2045,2045,2045,2046,2046,2046,2045,2045,2045,2044,2044,2043,2043,2042,2042,2042,2043,2044,2044,2044,2044,2044,2043,2043,2042,2042,2043,2043,2044,2045,2046,2047,2048,2048,2047,2046,2045,2044,2043,2043,2043,2043,2043,2043,2043,2043,2042,2042,2041,2041,2041,2042,2043,2044,2045,2046,2046,2047,2048,2048,2048,2048,2048,2047,2046,2044,2043,2041,2040,2039,2039,2039,2040,2040,2041,2041,2042,2042,2043,2043,2044,2045,2045,2045,2044,2043,2041,2040,2040,2041,2041,2041,2041,2040,2039,2038,2037,2037,2037,2037,2037,2038,2039,2039,2039,2038,2037,2036,2034,2033,2033,2033,2034,2035,2038,2040,2042,2044,2046,2046,2046,2045,2045,2045,2045,2046,2047,2047,2047,2046,2045,2044,2043,2041,2040,2039,2039,2040,2041,2043,2045,2046,2047,2047,2047,2046,2045,2043,2040,2038,2035,2033,2032,2032,2033,2035,2037,2039,2041,2042,2042,2042,2041,2040,2040,2041,2041,2042,2043,2044,2045,2046,2046,2047,2048,2048,2049,2050,2050,2049,2048,2046,2044,2041,2038,2036,2035,2034,2035,2037,2039,2041,2043,2045,2046,2046,2046,2045,2045,2045,2045,2046,2047,2048,2049,2050,2050,2050,2050,2049,2048,2047,2046,2046,2045,2044,2043,2041,2039,2038,2037,2037,2037,2038,2040,2042,2045,2048,2051,2053,2053,2053,2052,2051,2051,2051,2051,2051,2050,2048,2046,2044,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2043,2044,2044,2044,2045,2045,2045,2045,2046,2046,2047,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2046,2045,2043,2041,2040,2039,2038,2038,2038,2038,2038,2039,2040,2041,2043,2044,2046,2047,2048,2049,2050,2051,2052,2052,2052,2052,2051,2050,2049,2048,2047,2046,2044,2043,2041,2040,2039,2040,2040,2041,2042,2042,2043,2043,2043,2044,2045,2047,2048,2049,2049,2050,2050,2049,2048,2047,2046,2045,2045,2045,2046,2046,2047,2047,2048,2050,2051,2052,2053,2053,2052,2051,2049,2048,2047,2046,2045,2044,2043,2042,2042,2042,2042,2043,2045,2047,2049,2051,2052,2052,2052,2051,2050,2050,2050,2050,2050,2049,2049,2048,2047,2046,2045,2045,2046,2047,2048,2048,2049,2049,2048,2048,2047,2046,2045,2045,2046,2047,2048,2049,2050,2050,2051,2051,2050,2049,2049,2049,2049,2050,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2048,2049,2049,2050,2050,2051,2051,2051,2050,2049,2048,2048,2047,2046,2045,2045,2046,2047,2048,2049,2051,2051,2052,2052,2051,2051,2050,2049,2049,2048,2048,2048,2048,2049,2050,2050,2050,2050,2049,2047,2046,2045,2045,2045,2045,2046,2046,2046,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2047,2046,2045,2044,2044,2045,2046,2047,2048,2048,2049,2048,2048,2047,2045,2043,2041,2038,2036,2034,2033,2033,2032,2033,2033,2034,2035,2037,2039,2041,2044,2045,2046,2047,2046,2046,2046,2047,2048,2048,2049,2049,2048,2047,2045,2043,2041,2040,2038,2038,2037,2037,2037,2037,2038,2039,2040,2041,2040,2040,2039,2038,2038,2038,2038,2037,2037,2037,2037,2037,2037,2037,2038,2039,2040,2042,2043,2044,2044,2043,2041,2040,2039,2038,2038,2038,2038,2038,2039,2040,2041,2043,2044,2046,2048,2050,2051,2052,2051,2050,2048,2045,2044,2043,2043,2044,2044,2044,2044,2043,2042,2041,2041,2041,2041,2042,2042,2043,2042,2041,2040,2040,2040,2040,2041,2041,2041,2040,2039,2038,2038,2037,2037,2037,2038,2040,2041,2042,2043,2044,2045,2047,2048,2049,2049,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2050,2049,2048,2047,2046,2046,2046,2047,2047,2048,2049,2050,2051,2052,2052,2052,2051,2050,2049,2047,2046,2045,2044,2044,2043,2043,2042,2040,2039,2039,2039,2040,2041,2043,2045,2047,2049,2051,2052,2054,2055,2057,2057,2057,2056,2056,2055,2054,2053,2051,2050,2049,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2044,2043,2043,2044,2045,2047,2049,2049,2050,2051,2051,2052,2052,2053,2054,2055,2055,2056,2056,2056,2056,2055,2054,2053,2052,2050,2049,2047,2045,2044,2043,2042,2041,2041,2040,2040,2040,2040,2040,2041,2042,2044,2046,2048,2050,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2050,2050,2051,2051,2051,2051,2051,2050,2050,2048,2046,2044,2042,2040,2039,2039,2039,2040,2040,2040,2041,2041,2042,2043,2045,2046,2047,2048,2048,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2046,2046,2045,2044,2043,2043,2043,2044,2045,2046,2046,2047,2048,2048,2049,2049,2049,2048,2047,2046,2045,2044,2044,2045,2046,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2046,2044,2043,2042,2041,2042,2042,2042,2043,2043,2043,2044,2044,2043,2043,2042,2042,2041,2041,2041,2041,2041,2041,2042,2043,2044,2045,2047,2048,2049,2050,2050,2050,2049,2048,2047,2046,2046,2047,2047,2048,2049,2049,2048,2048,2047,2046,2045,2044,2043,2043,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2044,2044,2045,2046,2047,2049,2050,2050,2050,2049,2048,2048,2048,2048,2047,2047,2046,2046,2046,2046,2047,2048,2049,2051,2051,2052,2051,2050,2049,2048,2046,2045,2044,2044,2043,2043,2043,2044,2045,2046,2047,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2048,2049,2051,2052,2053,2053,2052,2051,2049,2047,2046,2044,2043,2042,2042,2042,2042,2043,2043,2044,2045,2045,2044,2044,2043,2042,2041,2040,2040,2040,2040,2040,2040,2040,2041,2042,2043,2044,2044,2045,2045,2046,2046,2046,2046,2046,2047,2048,2049,2049,2049,2049,2048,2047,2046,2045,2044,2044,2043,2041,2040,2039,2037,2037,2037,2037,2038,2040,2041,2042,2043,2043,2043,2043,2042,2042,2041,2040,2039,2038,2038,2039,2039,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2041,2042,2044,2045,2045,2046,2045,2045,2045,2044,2043,2042,2041,2040,2039,2039,2039,2039,2039,2040,2041,2042,2043,2044,2045,2046,2046,2046,2046,2045,2043,2040,2037,2034,2031,2030,2030,2031,2032,2033,2035,2037,2038,2039,2040,2041,2041,2041,2042,2043,2043,2044,2045,2046,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2044,2043,2041,2040,2039,2039,2039,2040,2041,2043,2044,2045,2045,2045,2044,2042,2041,2039,2038,2037,2036,2037,2037,2039,2041,2043,2046,2048,2050,2051,2052,2052,2051,2049,2047,2044,2042,2040,2038,2038,2037,2037,2038,2039,2040,2042,2044,2045,2045,2045,2045,2044,2044,2043,2043,2043,2043,2044,2044,2045,2046,2046,2046,2045,2043,2042,2041,2040,2039,2039,2040,2041,2043,2044,2046,2047,2048,2049,2049,2049,2048,2047,2046,2045,2045,2045,2045,2046,2046,2047,2048,2050,2051,2052,2053,2052,2051,2050,2048,2046,2044,2043,2042,2042,2044,2046,2049,2052,2055,2057,2058,2058,2057,2054,2052,2049,2047,2046,2045,2044,2044,2043,2044,2045,2045,2046,2047,2049,2050,2051,2052,2053,2053,2053,2052,2051,2049,2048,2048,2047,2047,2046,2046,2046,2045,2045,2046,2046,2047,2047,2048,2048,2049,2050,2051,2051,2051,2052,2052,2052,2052,2051,2049,2048,2046,2044,2043,2042,2041,2041,2041,2041,2042,2043,2045,2046,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2050,2051,2052,2052,2053,2053,2052,2052,2051,2050,2049,2048,2048,2047,2047,2046,2046,2046,2046,2045,2045,2044,2044,2044,2044,2045,2047,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2049,2051,2052,2054,2054,2054,2053,2052,2051,2050,2049,2048,2047,2047,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2047,2049,2050,2051,2052,2053,2054,2054,2054,2053,2052,2051,2049,2048,2047,2046,2046,2047,2047,2048,2048,2048,2049,2049,2049,2049,2050,2050,2049,2047,2045,2043,2041,2040,2040,2041,2043,2045,2047,2049,2051,2052,2054,2055,2056,2057,2057,2056,2055,2053,2052,2050,2049,2047,2046,2046,2045,2043,2042,2041,2040,2039,2039,2039,2040,2040,2041,2042,2044,2045,2047,2048,2049,2050,2050,2050,2050,2050,2049,2048,2047,2046,2046,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2047,2048,2049,2049,2050,2050,2049,2048,2046,2045,2044,2043,2043,2044,2044,2045,2046,2047,2047,2047,2047,2047,2047,2046,2045,2044,2043,2043,2043,2043,2043,2043,2043,2043,2042,2042,2042,2042,2042,2043,2043,2044,2045,2045,2046,2047,2048,2049,2050,2050,2050,2050,2050,2050,2049,2048,2047,2047,2046,2046,2045,2045,2045,2045,2046,2046,2045,2045,2044,2044,2043,2043,2044,2045,2046,2048,2050,2052,2054,2055,2054,2054,2053,2051,2050,2048,2048,2047,2047,2047,2047,2047,2046,2047,2047,2047,2048,2048,2048,2048,2047,2047,2046,2045,2045,2044,2043,2042,2042,2042,2042,2043,2043,2043,2044,2044,2045,2046,2046,2047,2049,2050,2051,2052,2052,2052,2052,2051,2050,2049,2048,2047,2046,2045,2044,2044,2044,2045,2046,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2048,2048,2047,2047,2047,2046,2046,2045,2045,2044,2044,2043,2042,2041,2040,2040,2041,2043,2045,2047,2050,2052,2053,2054,2055,2055,2055,2055,2054,2051,2049,2047,2045,2044,2043,2042,2042,2041,2041,2041,2041,2042,2042,2043,2043,2043,2043,2043,2044,2045,2046,2048,2049,2050,2050,2050,2050,2049,2048,2047,2046,2045,2045,2044,2044,2045,2046,2047,2049,2050,2051,2051,2050,2049,2047,2045,2043,2042,2042,2041,2042,2043,2043,2044,2045,2045,2045,2045,2044,2044,2045,2045,2046,2046,2047,2047,2048,2048,2048,2048,2047,2047,2046,2046,2046,2046,2046,2046,2046,2045,2045,2044,2044,2045,2046,2048,2049,2051,2052,2052,2053,2053,2052,2051,2050,2049,2048,2046,2046,2045,2044,2044,2043,2042,2042,2042,2043,2043,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2046,2046,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2046,2045,2045,2045,2045,2045,2046,2046,2046,2045,2045,2044,2044,2043,2042,2041,2040,2040,2040,2041,2041,2042,2042,2043,2044,2045,2046,2047,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2049,2049,2049,2049,2049,2047,2046,2043,2041,2040,2040,2040,2040,2041,2042,2043,2044,2045,2046,2046,2047,2047,2047,2048,2049,2049,2050,2051,2051,2051,2051,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2046,2046,2045,2045,2045,2046,2047,2049,2050,2051,2052,2052,2052,2052,2051,2050,2048,2047,2046,2045,2044,2042,2042,2042,2042,2043,2044,2045,2046,2046,2046,2046,2045,2044,2043,2042,2041,2041,2041,2041,2041,2041,2041,2042,2044,2045,2047,2048,2050,2052,2053,2055,2055,2055,2055,2054,2054,2054,2053,2053,2053,2053,2053,2052,2051,2050,2048,2045,2044,2042,2042,2043,2044,2045,2047,2047,2047,2047,2047,2046,2046,2045,2044,2044,2043,2043,2043,2044,2044,2044,2044,2045,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2050,2051,2053,2054,2055,2056,2056,2056,2056,2054,2053,2050,2048,2047,2046,2045,2045,2045,2045,2045,2045,2045,2046,2047,2048,2049,2051,2052,2053,2054,2054,2054,2054,2053,2052,2051,2050,2049,2048,2046,2045,2044,2043,2043,2042,2042,2042,2042,2042,2043,2044,2045,2046,2047,2049,2051,2053,2054,2054,2054,2053,2052,2051,2050,2050,2049,2049,2049,2050,2050,2050,2050,2049,2048,2047,2045,2044,2042,2042,2041,2042,2043,2044,2045,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2050,2052,2053,2054,2054,2053,2052,2051,2051,2050,2050,2050,2050,2049,2048,2047,2046,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2048,2049,2050,2051,2052,2052,2051,2051,2050,2049,2048,2047,2046,2045,2045,2044,2044,2044,2044,2045,2046,2047,2048,2048,2048,2047,2046,2045,2043,2042,2041,2040,2040,2040,2040,2040,2041,2042,2043,2044,2044,2044,2044,2044,2044,2045,2045,2045,2044,2044,2045,2045,2044,2044,2044,2044,2045,2045,2046,2046,2047,2048,2049,2049,2049,2049,2048,2047,2046,2046,2046,2047,2047,2048,2049,2049,2049,2049,2048,2047,2047,2046,2046,2045,2045,2044,2044,2044,2044,2043,2043,2042,2041,2041,2041,2041,2041,2041,2041,2042,2042,2042,2042,2042,2043,2044,2045,2045,2046,2047,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2046,2045,2045,2043,2042,2041,2041,2041,2042,2042,2043,2044,2045,2046,2046,2046,2046,2046,2046,2047,2047,2048,2049,2049,2050,2050,2049,2049,2048,2047,2047,2047,2047,2048,2049,2049,2050,2050,2051,2051,2051,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2049,2049,2050,2050,2050,2050,2050,2050,2050,2048,2047,2045,2043,2042,2040,2039,2039,2040,2041,2043,2045,2046,2047,2048,2048,2047,2047,2047,2047,2048,2049,2050,2051,2052,2052,2053,2053,2053,2053,2053,2052,2051,2050,2049,2049,2049,2048,2047,2047,2046,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2047,2047,2048,2049,2050,2051,2052,2053,2053,2053,2053,2051,2049,2047,2045,2044,2044,2045,2046,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2051,2051,2051,2050,2049,2049,2048,2047,2047,2047,2047,2047,2047,2048,2049,2050,2051,2051,2051,2051,2050,2048,2047,2046,2044,2043,2042,2041,2040,2039,2039,2038,2039,2040,2041,2044,2047,2050,2052,2054,2055,2055,2055,2055,2055,2054,2054,2053,2052,2051,2050,2050,2049,2049,2049,2049,2048,2047,2046,2045,2044,2044,2043,2043,2043,2042,2043,2043,2044,2045,2046,2048,2049,2050,2051,2052,2052,2052,2051,2050,2048,2046,2045,2043,2043,2043,2044,2046,2047,2048,2048,2047,2047,2046,2045,2045,2045,2046,2046,2047,2048,2048,2048,2048,2048,2049,2049,2050,2050,2051,2051,2052,2052,2051,2050,2049,2048,2047,2046,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2046,2046,2047,2048,2048,2049,2050,2051,2051,2051,2051,2049,2047,2045,2044,2042,2040,2040,2039,2039,2040,2041,2043,2046,2048,2050,2052,2053,2054,2054,2053,2053,2052,2051,2050,2050,2049,2049,2048,2047,2046,2046,2045,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2046,2046,2046,2046,2045,2045,2045,2046,2047,2047,2048,2048,2048,2047,2046,2046,2045,2044,2042,2041,2040,2039,2039,2040,2041,2042,2044,2046,2048,2049,2051,2051,2051,2051,2050,2050,2049,2049,2049,2050,2050,2051,2052,2052,2052,2051,2049,2048,2047,2046,2045,2044,2043,2043,2042,2042,2043,2043,2044,2045,2046,2047,2048,2048,2049,2049,2049,2049,2048,2047,2046,2045,2044,2044,2045,2045,2046,2047,2047,2047,2047,2048,2048,2048,2048,2049,2050,2050,2050,2050,2050,2049,2048,2046,2046,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2047,2047,2048,2048,2049,2050,2050,2051,2050,2050,2049,2049,2048,2048,2047,2047,2048,2048,2049,2049,2049,2050,2050,2050,2050,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2048,2046,2045,2044,2043,2043,2043,2043,2044,2044,2045,2045,2045,2045,2045,2045,2046,2047,2048,2049,2051,2052,2053,2054,2054,2054,2053,2053,2052,2052,2051,2050,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2049,2050,2050,2050,2049,2048,2048,2047,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2047,2048,2049,2050,2051,2051,2051,2050,2050,2050,2050,2050,2051,2052,2053,2053,2053,2052,2051,2050,2048,2046,2044,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2045,2046,2047,2047,2047,2047,2047,2047,2048,2048,2048,2047,2046,2046,2045,2044,2044,2044,2044,2044,2045,2046,2047,2048,2048,2049,2049,2049,2049,2049,2049,2050,2050,2051,2051,2051,2050,2049,2048,2047,2046,2045,2045,2044,2043,2042,2041,2041,2040,2040,2039,2039,2039,2039,2040,2041,2041,2042,2042,2042,2043,2044,2045,2046,2047,2048,2048,2048,2048,2047,2047,2046,2046,2045,2045,2044,2043,2042,2041,2041,2040,2040,2041,2041,2042,2042,2043,2043,2044,2044,2045,2047,2048,2050,2051,2051,2051,2050,2049,2047,2045,2044,2043,2043,2043,2043,2043,2044,2044,2044,2045,2045,2046,2047,2047,2047,2046,2044,2043,2041,2041,2041,2042,2043,2044,2045,2045,2044,2044,2043,2042,2041,2042,2042,2043,2044,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2050,2050,2051,2051,2051,2052,2051,2051,2050,2050,2049,2049,2048,2048,2048,2047,2047,2046,2045,2044,2043,2042,2041,2041,2042,2043,2045,2046,2047,2047,2047,2046,2046,2046,2046,2047,2048,2049,2051,2052,2053,2054,2054,2054,2053,2053,2052,2051,2051,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2050,2050,2051,2052,2052,2053,2053,2053,2053,2052,2051,2051,2050,2050,2049,2049,2049,2048,2048,2047,2046,2045,2045,2045,2046,2047,2048,2050,2051,2052,2053,2053,2053,2053,2053,2053,2053,2052,2051,2051,2050,2050,2050,2050,2050,2050,2049,2048,2048,2047,2046,2045,2045,2045,2045,2045,2046,2046,2047,2047,2047,2047,2048,2048,2049,2050,2052,2053,2054,2054,2054,2053,2053,2052,2051,2050,2049,2048,2047,2045,2044,2043,2043,2043,2043,2044,2044,2045,2045,2046,2045,2045,2045,2044,2044,2045,2045,2047,2048,2049,2049,2050,2049,2049,2049,2048,2047,2046,2044,2043,2042,2042,2043,2044,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2048,2049,2050,2050,2050,2049,2048,2046,2045,2043,2042,2041,2041,2042,2042,2043,2043,2043,2044,2044,2044,2045,2046,2047,2048,2049,2050,2051,2051,2050,2050,2049,2049,2049,2049,2049,2049,2048,2046,2045,2043,2042,2041,2041,2041,2042,2044,2045,2047,2047,2048,2049,2049,2049,2048,2046,2044,2043,2041,2040,2039,2038,2038,2038,2039,2039,2039,2039,2039,2040,2041,2043,2046,2048,2049,2051,2052,2053,2054,2055,2055,2056,2055,2055,2054,2054,2053,2051,2050,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2049,2050,2051,2052,2054,2055,2055,2054,2053,2051,2049,2048,2047,2046,2045,2044,2044,2043,2043,2044,2045,2046,2047,2048,2050,2051,2052,2053,2054,2055,2056,2056,2055,2054,2052,2051,2049,2047,2046,2045,2044,2044,2045,2045,2046,2047,2048,2049,2050,2051,2052,2053,2054,2054,2055,2055,2055,2056,2056,2056,2056,2055,2054,2053,2052,2051,2050,2049,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2051,2051,2052,2052,2052,2052,2052,2052,2053,2054,2055,2054,2053,2052,2050,2049,2048,2048,2047,2047,2047,2047,2047,2046,2047,2047,2048,2050,2051,2051,2052,2052,2051,2051,2050,2048,2047,2046,2045,2045,2045,2046,2046,2047,2047,2047,2047,2046,2046,2047,2047,2047,2047,2046,2046,2045,2044,2044,2044,2044,2045,2046,2048,2049,2050,2051,2051,2051,2051,2050,2050,2049,2048,2048,2048,2049,2050,2052,2052,2051,2050,2049,2048,2047,2047,2046,2046,2045,2045,2045,2046,2046,2046,2045,2045,2045,2044,2044,2043,2042,2041,2042,2043,2044,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2049,2049,2050,2051,2052,2052,2053,2053,2052,2051,2049,2048,2046,2044,2041,2039,2037,2036,2035,2036,2037,2039,2042,2045,2047,2049,2051,2052,2052,2052,2051,2051,2050,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2049,2048,2048,2047,2047,2046,2045,2044,2043,2042,2041,2041,2040,2041,2041,2041,2041,2041,2042,2042,2043,2045,2046,2047,2047,2048,2049,2050,2051,2052,2052,2052,2051,2050,2048,2047,2045,2045,2044,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2045,2045,2044,2045,2045,2046,2046,2047,2048,2048,2047,2046,2044,2042,2041,2041,2041,2042,2043,2044,2044,2045,2046,2046,2047,2048,2048,2048,2049,2049,2049,2049,2048,2048,2047,2047,2047,2048,2048,2049,2049,2050,2050,2049,2048,2047,2045,2044,2042,2041,2040,2039,2039,2038,2038,2037,2038,2038,2040,2042,2044,2047,2049,2051,2052,2053,2053,2053,2053,2052,2051,2050,2049,2047,2046,2045,2044,2043,2043,2043,2042,2042,2042,2041,2041,2041,2042,2043,2044,2045,2046,2047,2048,2048,2048,2048,2047,2047,2046,2046,2045,2044,2044,2043,2043,2043,2044,2045,2046,2048,2049,2050,2050,2050,2049,2048,2046,2045,2043,2042,2041,2041,2042,2043,2043,2044,2044,2043,2044,2044,2044,2045,2046,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2045,2044,2043,2043,2043,2043,2043,2044,2045,2045,2046,2046,2046,2047,2047,2048,2049,2050,2051,2051,2051,2051,2051,2052,2052,2053,2053,2054,2054,2053,2053,2052,2051,2050,2050,2049,2048,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2049,2049,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2050,2051,2052,2053,2053,2053,2053,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2050,2049,2049,2048,2048,2049,2049,2050,2052,2053,2054,2056,2056,2057,2057,2056,2056,2055,2054,2053,2052,2051,2049,2048,2047,2046,2045,2045,2045,2046,2047,2048,2048,2049,2049,2048,2048,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2045,2046,2047,2048,2049,2050,2051,2052,2052,2052,2052,2051,2050,2048,2046,2045,2044,2043,2043,2043,2044,2045,2046,2047,2047,2048,2047,2047,2046,2046,2045,2044,2044,2043,2043,2042,2042,2042,2042,2042,2042,2043,2044,2045,2046,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2046,2045,2043,2042,2042,2041,2041,2041,2042,2043,2045,2046,2047,2047,2047,2047,2047,2048,2047,2047,2048,2048,2048,2049,2049,2049,2049,2048,2048,2047,2046,2046,2045,2044,2043,2043,2042,2042,2042,2042,2041,2041,2041,2042,2042,2042,2043,2043,2043,2043,2043,2042,2042,2042,2041,2041,2040,2040,2040,2040,2040,2041,2042,2043,2044,2045,2046,2046,2046,2045,2045,2044,2044,2044,2044,2045,2045,2046,2046,2047,2047,2047,2048,2048,2048,2047,2047,2046,2045,2044,2043,2043,2043,2042,2042,2042,2042,2042,2041,2040,2039,2038,2037,2037,2037,2038,2039,2041,2042,2043,2045,2046,2046,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2048,2049,2049,2049,2049,2049,2050,2050,2051,2051,2051,2050,2048,2047,2045,2043,2042,2042,2041,2040,2040,2040,2040,2040,2041,2042,2043,2044,2046,2047,2049,2050,2052,2053,2053,2053,2053,2053,2053,2052,2052,2051,2050,2049,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2048,2050,2051,2053,2054,2055,2056,2057,2058,2058,2058,2057,2056,2054,2052,2051,2049,2048,2046,2045,2044,2043,2042,2041,2041,2042,2043,2045,2046,2048,2049,2049,2050,2051,2051,2051,2051,2051,2050,2049,2047,2046,2046,2045,2045,2045,2046,2047,2049,2050,2052,2054,2055,2057,2058,2058,2058,2057,2055,2053,2051,2049,2048,2047,2047,2047,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2048,2048,2049,2049,2049,2049,2048,2048,2047,2048,2048,2049,2049,2050,2050,2050,2050,2051,2051,2052,2053,2054,2054,2054,2054,2053,2053,2052,2051,2050,2050,2050,2050,2050,2051,2051,2052,2052,2052,2053,2053,2053,2053,2053,2052,2051,2050,2049,2047,2046,2045,2044,2045,2045,2046,2047,2048,2049,2049,2049,2048,2047,2045,2044,2043,2042,2042,2042,2042,2042,2043,2043,2044,2045,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2047,2047,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2044,2043,2042,2041,2040,2040,2040,2040,2041,2041,2042,2043,2043,2043,2044,2044,2044,2045,2046,2046,2046,2046,2046,2045,2044,2044,2045,2045,2046,2047,2047,2047,2047,2047,2046,2046,2045,2044,2044,2043,2043,2042,2042,2042,2042,2042,2041,2041,2041,2041,2041,2041,2041,2041,2041,2042,2042,2043,2044,2045,2046,2047,2048,2049,2049,2049,2048,2048,2048,2047,2047,2047,2046,2045,2044,2043,2042,2041,2040,2039,2039,2040,2041,2042,2043,2044,2044,2045,2044,2044,2044,2043,2043,2043,2043,2043,2044,2044,2045,2045,2046,2047,2047,2048,2048,2048,2048,2048,2048,2047,2046,2044,2042,2041,2040,2040,2040,2041,2041,2041,2042,2042,2043,2044,2045,2045,2046,2046,2046,2046,2045,2045,2044,2044,2043,2042,2042,2041,2041,2042,2043,2044,2045,2046,2046,2047,2047,2048,2048,2049,2050,2050,2050,2050,2050,2050,2049,2048,2047,2047,2046,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2045,2044,2043,2042,2042,2041,2042,2043,2044,2045,2047,2049,2050,2051,2051,2052,2052,2052,2052,2051,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2047,2047,2047,2046,2046,2046,2047,2048,2049,2049,2050,2051,2051,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2052,2051,2049,2048,2048,2048,2048,2049,2050,2050,2049,2049,2048,2047,2046,2046,2046,2046,2046,2046,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2049,2048,2046,2045,2045,2045,2045,2045,2046,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2051,2051,2051,2052,2053,2053,2054,2055,2056,2056,2056,2056,2055,2053,2052,2050,2048,2046,2045,2044,2043,2043,2044,2045,2046,2048,2049,2050,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2050,2050,2049,2048,2047,2046,2045,2044,2044,2044,2044,2045,2045,2046,2047,2048,2049,2050,2051,2052,2053,2053,2054,2054,2054,2053,2052,2051,2049,2047,2045,2043,2042,2041,2041,2041,2041,2041,2042,2043,2044,2045,2046,2047,2047,2048,2049,2049,2049,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2046,2046,2045,2045,2045,2045,2045,2046,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2047,2046,2045,2044,2043,2043,2043,2043,2044,2045,2046,2047,2048,2049,2049,2049,2048,2048,2047,2047,2047,2048,2048,2049,2049,2048,2048,2047,2047,2046,2046,2045,2045,2046,2046,2047,2048,2048,2047,2046,2045,2044,2044,2044,2044,2045,2046,2047,2047,2047,2047,2046,2046,2045,2045,2045,2045,2046,2046,2047,2048,2049,2049,2050,2050,2050,2049,2049,2048,2047,2047,2046,2045,2045,2044,2044,2045,2045,2046,2046,2047,2047,2047,2047,2047,2046,2045,2044,2043,2042,2041,2040,2039,2039,2039,2039,2040,2041,2042,2043,2043,2043,2043,2044,2044,2046,2047,2049,2051,2052,2053,2053,2053,2052,2052,2051,2050,2049,2048,2047,2047,2046,2045,2045,2044,2043,2043,2043,2043,2044,2045,2046,2047,2047,2047,2047,2047,2047,2047,2046,2046,2045,2045,2045,2045,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2047,2047,2046,2045,2044,2044,2044,2044,2045,2045,2045,2046,2046,2046,2045,2044,2044,2043,2041,2041,2041,2041,2042,2043,2045,2047,2048,2049,2050,2050,2051,2051,2051,2050,2049,2049,2048,2047,2046,2045,2043,2042,2041,2040,2039,2039,2039,2039,2040,2040,2041,2041,2042,2044,2046,2048,2050,2051,2052,2052,2052,2051,2050,2049,2049,2048,2048,2047,2047,2048,2048,2049,2050,2050,2051,2051,2050,2050,2049,2048,2048,2048,2047,2047,2047,2047,2048,2049,2050,2050,2051,2050,2049,2048,2046,2044,2043,2043,2043,2043,2043,2042,2042,2042,2042,2042,2042,2043,2044,2045,2046,2048,2049,2051,2053,2054,2056,2057,2058,2058,2059,2058,2058,2057,2055,2053,2052,2050,2048,2046,2045,2045,2045,2045,2045,2046,2047,2048,2049,2050,2050,2050,2050,2050,2049,2049,2048,2048,2048,2047,2046,2045,2044,2044,2043,2043,2043,2044,2045,2047,2048,2049,2050,2051,2052,2052,2053,2053,2052,2052,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2048,2047,2046,2045,2044,2044,2044,2044,2044,2045,2045,2046,2047,2048,2049,2049,2048,2047,2046,2045,2044,2044,2044,2044,2045,2046,2047,2048,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2046,2046,2046,2046,2046,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2050,2049,2049,2048,2047,2047,2046,2046,2045,2045,2045,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2045,2044,2043,2043,2042,2043,2043,2044,2045,2045,2046,2046,2047,2047,2048,2049,2049,2049,2049,2049,2048,2048,2047,2046,2046,2045,2046,2046,2047,2049,2050,2051,2052,2053,2054,2054,2054,2054,2054,2053,2053,2053,2053,2053,2052,2052,2052,2051,2050,2050,2049,2048,2048,2047,2047,2046,2046,2046,2046,2047,2047,2047,2048,2049,2050,2050,2051,2051,2051,2051,2050,2049,2048,2047,2046,2045,2045,2045,2046,2046,2047,2047,2048,2049,2050,2050,2050,2050,2050,2049,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2046,2045,2045,2045,2045,2046,2046,2047,2046,2046,2045,2045,2044,2044,2044,2045,2046,2047,2048,2049,2050,2051,2051,2050,2050,2049,2049,2048,2048,2047,2047,2047,2046,2046,2046,2047,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2052,2052,2051,2051,2051,2051,2050,2049,2048,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2047,2046,2045,2044,2043,2043,2042,2041,2041,2041,2041,2043,2044,2046,2048,2049,2050,2051,2051,2052,2051,2051,2051,2050,2049,2048,2048,2047,2046,2045,2045,2045,2045,2046,2046,2047,2048,2049,2050,2051,2052,2052,2052,2052,2051,2051,2050,2049,2048,2047,2046,2045,2044,2044,2043,2043,2043,2043,2044,2044,2044,2045,2046,2047,2047,2048,2049,2049,2049,2049,2048,2047,2046,2045,2045,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2047,2047,2047,2048,2049,2049,2050,2051,2051,2051,2052,2052,2052,2051,2051,2050,2049,2048,2047,2046,2046,2045,2045,2045,2044,2044,2044,2044,2043,2043,2042,2041,2041,2041,2041,2041,2042,2042,2042,2043,2043,2043,2044,2045,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2050,2050,2051,2052,2052,2053,2053,2053,2053,2053,2052,2052,2051,2050,2048,2047,2046,2046,2045,2045,2044,2044,2044,2044,2044,2045,2046,2047,2048,2049,2050,2051,2051,2051,2051,2051,2050,2050,2049,2049,2048,2048,2047,2046,2046,2045,2045,2046,2046,2047,2047,2047,2046,2046,2045,2045,2046,2046,2047,2047,2048,2048,2048,2048,2047,2047,2046,2046,2046,2046,2047,2048,2049,2050,2052,2053,2054,2054,2055,2054,2054,2053,2052,2051,2050,2050,2049,2048,2046,2045,2045,2045,2044,2044,2044,2043,2043,2042,2042,2041,2041,2042,2042,2043,2043,2044,2045,2046,2047,2048,2049,2050,2051,2052,2053,2053,2053,2052,2052,2051,2050,2049,2047,2046,2044,2043,2042,2041,2041,2042,2043,2044,2045,2046,2046,2047,2049,2050,2052,2053,2054,2054,2055,2054,2054,2054,2053,2053,2052,2051,2049,2048,2046,2045,2044,2044,2044,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2046,2046,2045,2045,2045,2044,2044,2043,2043,2042,2043,2043,2044,2045,2045,2046,2047,2048,2049,2050,2051,2052,2053,2054,2054,2054,2054,2053,2052,2051,2050,2050,2049,2049,2049,2049,2049,2048,2048,2047,2046,2046,2045,2045,2044,2043,2043,2042,2041,2041,2041,2042,2042,2043,2044,2045,2046,2047,2047,2047,2048,2048,2049,2049,2049,2049,2049,2048,2048,2046,2045,2044,2043,2042,2041,2040,2040,2041,2042,2043,2044,2045,2046,2047,2048,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2047,2047,2048,2048,2049,2049,2049,2049,2048,2048,2048,2049,2049,2048,2048,2048,2047,2046,2046,2045,2044,2044,2044,2044,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2046,2045,2044,2043,2043,2042,2042,2042,2042,2042,2043,2044,2045,2046,2048,2049,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2049,2048,2047,2046,2045,2044,2043,2043,2043,2043,2044,2044,2045,2046,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2045,2045,2045,2045,2046,2047,2048,2048,2049,2050,2050,2050,2050,2050,2049,2049,2048,2048,2048,2047,2047,2046,2046,2046,2046,2047,2048,2049,2050,2051,2051,2051,2051,2050,2050,2049,2049,2048,2047,2047,2047,2047,2047,2048,2048,2048,2047,2047,2046,2045,2044,2043,2042,2041,2041,2041,2042,2042,2043,2045,2046,2047,2048,2049,2050,2051,2051,2052,2052,2053,2054,2054,2055,2055,2055,2055,2054,2054,2052,2051,2050,2049,2047,2047,2046,2046,2046,2046,2045,2045,2044,2044,2045,2045,2046,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2047,2047,2046,2046,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2048,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2048,2047,2046,2045,2044,2044,2043,2042,2042,2042,2043,2044,2046,2047,2049,2050,2051,2052,2052,2051,2051,2050,2049,2048,2048,2047,2047,2048,2048,2049,2050,2050,2050,2050,2049,2048,2047,2046,2045,2044,2044,2044,2044,2045,2045,2046,2046,2047,2047,2047,2048,2047,2047,2047,2046,2046,2045,2046,2046,2046,2047,2047,2048,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2048,2048,2048,2049,2049,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2048,2048,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2048,2048,2047,2046,2046,2046,2045,2045,2046,2046,2047,2048,2049,2049,2050,2050,2050,2049,2048,2047,2046,2045,2044,2043,2043,2043,2043,2044,2044,2045,2045,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2047,2047,2047,2047,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2046,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2046,2045,2045,2044,2044,2044,2043,2043,2042,2042,2042,2042,2043,2044,2045,2045,2046,2047,2048,2049,2050,2050,2051,2051,2050,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2046,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2046,2046,2045,2045,2045,2045,2045,2046,2046,2047,2048,2049,2050,2051,2052,2052,2052,2051,2051,2050,2049,2048,2047,2047,2046,2046,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2049,2049,2050,2051,2051,2052,2052,2051,2051,2050,2049,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2052,2052,2052,2052,2052,2051,2051,2050,2050,2049,2049,2048,2048,2047,2046,2045,2044,2043,2043,2043,2044,2045,2046,2047,2048,2050,2051,2052,2053,2053,2052,2052,2051,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2050,2050,2050,2051,2051,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2048,2049,2049,2050,2051,2051,2052,2052,2052,2052,2051,2051,2050,2049,2049,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2048,2048,2049,2050,2050,2051,2052,2052,2053,2052,2051,2050,2049,2047,2046,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2046,2046,2046,2046,2046,2045,2045,2044,2044,2043,2043,2043,2044,2044,2045,2046,2048,2049,2050,2050,2051,2051,2051,2050,2050,2049,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2047,2046,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2046,2046,2047,2048,2048,2049,2049,2050,2051,2051,2051,2051,2051,2050,2050,2049,2048,2047,2047,2046,2046,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2049,2050,2050,2051,2051,2052,2052,2052,2052,2051,2051,2050,2049,2048,2048,2047,2046,2046,2045,2045,2045,2044,2044,2045,2046,2046,2047,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2051,2051,2052,2052,2052,2052,2052,2051,2051,2050,2049,2048,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2049,2048,2048,2048,2047,2047,2047,2046,2046,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2049,2049,2050,2051,2051,2052,2052,2053,2053,2053,2052,2051,2050,2049,2047,2046,2045,2045,2044,2044,2044,2044,2044,2045,2045,2045,2046,2046,2046,2047,2047,2048,2049,2050,2050,2051,2051,2051,2051,2051,2051,2051,2050,2049,2048,2047,2046,2045,2045,2045,2045,2045,2046,2046,2047,2047,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2047,2047,2046,2045,2045,2044,2044,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2048,2048,2049,2049,2049,2050,2050,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2045,2046,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2050,2050,2049,2049,2048,2048,2047,2046,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2047,2047,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2047,2047,2046,2046,2046,2047,2047,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2050,2051,2052,2053,2053,2054,2054,2054,2054,2054,2053,2052,2051,2050,2049,2048,2047,2046,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2049,2049,2050,2051,2051,2051,2052,2052,2051,2051,2051,2051,2050,2050,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2049,2050,2050,2050,2050,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2051,2051,2051,2051,2051,2050,2050,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2051,2051,2052,2053,2053,2053,2053,2052,2052,2051,2051,2050,2050,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2049,2049,2049,2050,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2048,2049,2049,2050,2050,2050,2050,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2044,2044,2045,2045,2045,2046,2047,2048,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2046,2046,2046,2047,2047,2047,2048,2048,2048,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2045,2045,2046,2047,2047,2048,2048,2048,2048,2048,2049,2049,2050,2050,2050,2049,2049,2048,2048,2047,2046,2045,2044,2043,2043,2043,2044,2045,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2049,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2050,2049,2048,2047,2047,2046,2046,2045,2045,2046,2046,2047,2047,2048,2048,2048,2048,2049,2049,2049,2050,2051,2052,2052,2053,2053,2053,2053,2052,2052,2051,2050,2050,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2050,2050,2051,2051,2052,2052,2052,2051,2051,2051,2050,2050,2049,2049,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2048,2048,2047,2046,2045,2045,2045,2045,2046,2046,2047,2048,2048,2049,2050,2050,2050,2050,2050,2050,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2051,2051,2050,2050,2049,2048,2047,2047,2046,2045,2045,2045,2044,2044,2044,2044,2045,2045,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2046,2046,2046,2046,2046,2045,2045,2046,2046,2046,2046,2046,2047,2047,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2048,2048,2048,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2047,2047,2046,2046,2045,2045,2045,2046,2046,2047,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2049,2050,2050,2050,2051,2051,2051,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2049,2049,2049,2048,2048,2047,2047,2046,2046,2046,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2046,2046,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2048,2048,2049,2049,2049,2049,2048,2048,2047,2046,2046,2046,2046,2045,2045,2045,2045,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2047,2047,2047,2047,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2047,2047,2048,2048,2048,2048,2048,2047,2047,2046,2045,2045,2045,2045,2045,2045,2045,2046,2046,2047,2047,2048,2048,2048,2049,2049,2049,2050,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2046,2046,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2046,2046,2046,2047,2047,2048,2049,2049,2050,2050,2051,2051,2051,2050,2050,2050,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2045,2045,2044,2044,2044,2043,2043,2043,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2044,2044,2045,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2047,2048,2049,2049,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2047,2046,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2049,2049,2049,2049,2049,2048,2048,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2044,2044,2044,2045,2045,2045,2046,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2048,2047,2047,2046,2046,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2049,2049,2048,2048,2047,2047,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,};
+/*IMA ADPCM sound, 66466 samples at 4000 Hz, generated by Tools/adpcm_encoder.c*/
+#include "adpcm.h"
+
+const uint8_t rocket_launch_data[] = {
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x60,0x08,
+0x3D,0x8B,0xB4,0x03,0x3D,0x8B,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x17,0x0D,0x08,0x58,0x08,0x08,
+0x0D,0x03,0x08,0x08,0xE8,0x03,0x80,0x80,0x80,0x90,0x00,0x00,0x2F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x8A,0x80,0x80,0x80,0x17,0x08,0x08,0x3F,0xC0,0x03,0x08,0x88,
+0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0xA7,0x04,0x08,0x08,0x08,0x3F,0x80,0x80,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xD1,0x80,0x80,0x00,
+0x08,0x08,0x08,0x00,0x00,0x70,0xD1,0x30,0x80,0xD0,0x80,0x80,0x04,0x0D,0x08,0x08,0x85,0xC0,0x30,0xD0,0x80,0xB4,0x03,0x0C,0x48,0x8B,0x08,0x85,0x80,0x00,0x8D,0xB4,
+0x08,0x88,0x80,0x70,0x08,0x3C,0x00,0x88,0xE0,0xB3,0xC3,0x80,0x40,0x80,0x80,0x0E,0x48,0x08,0xC8,0x80,0x80,0x50,0x8B,0x85,0x3B,0xD0,0xB3,0x80,0x08,0x08,0x08,0x09,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,
+0x00,0x68,0x08,0x08,0x0D,0x08,0x08,0x68,0x8B,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x02,0x80,0x3E,0x00,0x88,0x80,0x3E,0x4B,0xC0,0x30,0xD0,0x30,0x80,0x3C,0xD0,0xB3,0xB3,0x04,
+0x08,0x3D,0x8B,0x00,0x68,0x8B,0x40,0xB8,0x04,0x3C,0x80,0x0C,0x08,0x08,0x08,0x78,0x8B,0x00,0x08,0x08,0xB7,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,
+0x70,0x8A,0x80,0xB6,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x06,0xA8,0x08,0x08,0x48,0xDB,0x30,0x03,0x3C,0xF0,0x79,0x88,0x00,0xD9,0x19,0x94,
+0x1A,0xB3,0x3C,0x07,0xBC,0x21,0xBA,0x25,0x9A,0x25,0xB8,0x20,0xB0,0x10,0xC9,0x1C,0x22,0x0A,0x33,0x3B,0x67,0xCA,0x22,0xBC,0xA1,0x9F,0x34,0x90,0x2A,0xB2,0x49,0xC0,
+0x9C,0x42,0x99,0x17,0x8C,0x82,0x09,0x80,0x08,0x21,0xBB,0x33,0x1D,0xE1,0x49,0xA2,0x00,0x29,0xB0,0x18,0xBB,0x74,0xA8,0x91,0xC3,0x50,0x0A,0x99,0x14,0xAC,0x91,0x14,
+0xFB,0x11,0x3D,0x12,0xBA,0x93,0x2B,0x82,0xD3,0x19,0x23,0x5B,0xBD,0x49,0xB0,0x7B,0x92,0x98,0x18,0x85,0x39,0xCC,0x90,0x77,0x97,0x2A,0xF9,0x19,0xA1,0x0B,0x05,0x0A,
+0x14,0xA9,0x03,0x08,0x22,0x80,0xA8,0xCA,0xCB,0xAE,0x21,0x88,0x36,0x9A,0x43,0xC9,0x89,0xA0,0x4A,0xA2,0x22,0x33,0x29,0x91,0x32,0xE8,0x8E,0xB8,0x9A,0x02,0x00,0x90,
+0x45,0xD0,0x40,0x80,0x81,0x28,0xA8,0xA2,0xCD,0x18,0x10,0x0C,0x12,0xCC,0x40,0xB9,0x00,0x0A,0x09,0x07,0x4C,0x93,0x22,0xC1,0x10,0xBE,0x20,0x92,0x19,0xD0,0x9A,0x15,
+0x99,0x52,0x99,0x33,0x0E,0x91,0x08,0x10,0x9A,0x15,0x0B,0x85,0x2D,0xA1,0x8A,0x93,0xC8,0x4A,0xA8,0x81,0x83,0x2E,0x11,0x39,0x81,0xB0,0xAB,0x80,0x8F,0x0B,0x05,0x18,
+0x84,0x1C,0xC0,0x10,0xBA,0x32,0xF9,0x69,0xA1,0x18,0x83,0x1C,0x04,0x8A,0x11,0x8A,0x83,0x1D,0xB2,0x4B,0x90,0x49,0xA1,0xB3,0x80,0x12,0xEA,0x1C,0x12,0x72,0xA8,0x28,
+0xB9,0x85,0x10,0xDA,0x3C,0xF3,0x18,0xB1,0x78,0x1B,0x98,0x3B,0xB7,0x2A,0x07,0x0A,0x89,0x96,0x18,0x87,0x9B,0x80,0x7B,0xA1,0x99,0x88,0x5B,0x93,0x38,0xD8,0x00,0xB4,
+0xAB,0x72,0xC5,0x10,0xA9,0x90,0x51,0xAA,0x5A,0xB1,0x99,0x51,0xC8,0x44,0xB9,0x88,0x02,0xB8,0x79,0x88,0x31,0xAD,0x81,0x8A,0x73,0x8C,0x91,0x19,0x07,0x9A,0x02,0x1B,
+0x81,0xA2,0x98,0x7A,0x98,0x5A,0xA9,0x93,0x09,0x84,0x5C,0xC2,0x92,0x8D,0x84,0x2A,0x0A,0x91,0x96,0x28,0x2A,0x8D,0x47,0x9F,0x23,0xAC,0x88,0x08,0x88,0x10,0x89,0x18,
+0x90,0x74,0xC4,0x3A,0xC1,0x98,0x00,0x08,0x19,0x17,0x28,0x8D,0x89,0x08,0x08,0x08,0x17,0x2C,0x92,0xB4,0x8C,0x08,0x34,0x28,0x98,0x48,0x9E,0x99,0x90,0x72,0x01,0x00,
+0xB8,0x8B,0x0B,0xB1,0x03,0x0C,0xA9,0x28,0x7B,0x84,0x88,0x97,0x80,0x21,0x3D,0x11,0xBD,0x80,0x89,0x38,0x58,0x14,0x19,0x00,0xEB,0x12,0xA8,0x03,0xF0,0x21,0x08,0x08,
+0xF9,0x1A,0xA5,0x20,0xB8,0x30,0x18,0x8E,0x39,0xD1,0x38,0x93,0x49,0x18,0x19,0xAE,0xA5,0x39,0x10,0x80,0x00,0xE1,0x1E,0x90,0x10,0x4B,0x82,0xBA,0x9B,0x88,0x14,0x7B,
+0xB0,0x15,0xC0,0x18,0x99,0x0A,0x88,0x80,0x10,0x81,0x1B,0x89,0x99,0x02,0xA1,0x77,0x0B,0xB1,0x83,0x68,0x82,0x7C,0xA9,0x01,0x8A,0x89,0x91,0x3A,0xA8,0x01,0x40,0x18,
+0x1D,0xF3,0x00,0x03,0x0C,0x08,0x88,0x11,0xAC,0x87,0x89,0x11,0x1A,0x88,0x07,0x1A,0x01,0xE2,0x51,0xB9,0x00,0x8A,0x80,0x3B,0xC9,0x84,0x81,0x81,0x2D,0x89,0x88,0x94,
+0x72,0xA8,0x80,0xA9,0x41,0x30,0x8E,0x81,0x88,0x11,0xE3,0x2B,0xA0,0x01,0xBA,0x37,0x0A,0x08,0x2E,0xB1,0x04,0x32,0x2D,0xB1,0x12,0xA1,0x84,0xD2,0x2C,0xC1,0x68,0x8A,
+0x01,0x3C,0xCA,0x02,0x2A,0x20,0x19,0xE2,0x10,0x5B,0xC2,0x20,0x94,0x29,0x21,0x2B,0x8A,0x97,0x1A,0xC3,0x00,0x2B,0xEB,0x91,0x00,0xB0,0x16,0x8A,0x38,0xCB,0x84,0x81,
+0x40,0xC0,0x08,0x21,0x1C,0xF3,0x28,0x9B,0x95,0x1B,0x88,0x84,0x92,0x11,0x2A,0xB0,0xA7,0x4B,0xC0,0x20,0x28,0x9B,0x13,0x9E,0x11,0x18,0x1B,0x2A,0xAF,0xA4,0x93,0x70,
+0x0A,0x01,0x18,0x08,0x08,0x38,0xE1,0x60,0xC9,0x10,0xB2,0x28,0x97,0x3B,0xA8,0x11,0xA0,0x01,0x0E,0x91,0xC3,0x5B,0x08,0xB1,0x69,0x88,0xB2,0x10,0x8A,0x31,0xDA,0x32,
+0x99,0x32,0x3B,0xC1,0x4C,0x90,0x82,0x17,0xDB,0x05,0x09,0x80,0x19,0x18,0xF1,0x01,0x81,0x99,0x07,0x0D,0x92,0x08,0x18,0x0A,0xC1,0x11,0x91,0xA0,0x08,0x8A,0x93,0xD2,
+0x68,0xB1,0x00,0x1F,0x10,0xB8,0x90,0x22,0x9A,0x13,0x4A,0x11,0xD0,0x95,0x2C,0x21,0x20,0x93,0x78,0xA1,0x12,0x4C,0xA9,0x94,0xB0,0x22,0xAA,0x95,0x9A,0x03,0x69,0x8C,
+0xB2,0x85,0x0B,0x51,0xAA,0x11,0x90,0x2E,0xA8,0xB0,0x29,0x9D,0x3A,0x85,0x9C,0x13,0x3D,0xB9,0x81,0x87,0x09,0x20,0x90,0xB4,0x42,0xAD,0x12,0x00,0x90,0x49,0xE1,0x30,
+0xC9,0x91,0x30,0x19,0x2B,0xF3,0x40,0x9B,0x97,0x0A,0x02,0x89,0x22,0xC9,0x10,0x8A,0x91,0xA0,0x19,0x0C,0x72,0x80,0xB3,0x32,0xAB,0x97,0x5B,0x8A,0x91,0x90,0x39,0xED,
+0x31,0xCA,0x82,0x80,0x0A,0x3A,0xE2,0x4A,0x0A,0x68,0x00,0xC1,0x33,0xAA,0x40,0xD1,0x12,0x28,0x11,0x9B,0x27,0x1A,0x2A,0xFA,0x01,0x88,0xA2,0x50,0x89,0x68,0xB2,0xAA,
+0xA1,0x1D,0x28,0xF9,0x10,0x80,0x4A,0xD9,0x80,0xB0,0x18,0x90,0x3B,0xB6,0x5B,0xA7,0x38,0x08,0x2A,0xB3,0x81,0x3A,0x19,0x33,0xA4,0x44,0x8F,0x92,0x38,0xA1,0x90,0x38,
+0x19,0xF9,0x31,0xBF,0x00,0x9C,0x11,0xAC,0x11,0x0C,0x12,0xA8,0x94,0x39,0x9B,0x05,0x94,0x42,0x88,0x10,0x24,0x0B,0x84,0xAB,0x13,0xB8,0xD4,0x3B,0xA0,0x08,0x89,0x50,
+0x91,0x8F,0xC0,0x2B,0x09,0x8A,0x17,0x98,0x14,0x0C,0x02,0x88,0x24,0x9A,0x99,0x05,0x28,0x02,0x19,0xB3,0x9D,0xF2,0x2A,0x89,0x30,0x2E,0xF8,0x00,0x88,0x81,0x8C,0xA1,
+0x81,0x4B,0x00,0xE1,0x18,0x11,0x19,0x83,0x30,0x96,0x54,0xB0,0x69,0x88,0xA8,0x92,0x0B,0xA1,0x8D,0xD4,0x10,0x19,0xBA,0xA2,0x28,0x32,0x0E,0x41,0xB9,0x3B,0xC3,0xA9,
+0x83,0x08,0x5A,0x0A,0xC9,0x16,0x50,0x3B,0xB0,0x84,0x08,0x81,0x2B,0x80,0x2B,0xF4,0x1C,0x2B,0x09,0xD4,0x12,0x1A,0x8A,0x06,0x9A,0x39,0xD4,0x28,0xA0,0x28,0x88,0x92,
+0x90,0x17,0x31,0x1E,0x81,0xB0,0x5B,0x18,0x98,0x29,0xA2,0x99,0xBD,0x9A,0x3D,0xD2,0x03,0x29,0xC8,0x59,0x2C,0xF3,0x01,0x80,0x19,0xA1,0x89,0xC1,0x4A,0x08,0x09,0xD5,
+0x08,0x92,0x40,0xB8,0x12,0x28,0xAA,0xA7,0x08,0x70,0x09,0xB1,0x30,0xA9,0x88,0x4B,0x89,0x97,0x3D,0xAA,0x20,0xB8,0x87,0x18,0x99,0x08,0x19,0x18,0xAB,0x82,0xA3,0x59,
+0x92,0x9E,0x44,0xC8,0x08,0x13,0x89,0x23,0xF8,0x4D,0x90,0x39,0xC4,0x21,0xD9,0x29,0xA2,0x2B,0xA4,0x3A,0x90,0x8C,0xA1,0x19,0xA2,0x9F,0x25,0x8A,0x12,0x9E,0x20,0x89,
+0x11,0x90,0xA8,0x7D,0xC1,0x28,0xA8,0x11,0x8A,0x05,0xDA,0x40,0xC8,0x31,0x34,0xDC,0x11,0xBB,0x72,0x98,0x21,0xA8,0x09,0x8A,0x88,0x32,0x00,0xBD,0x31,0xF8,0x09,0x38,
+0xC0,0x29,0xB2,0x7A,0x92,0x19,0xC6,0x3D,0xB1,0x48,0x02,0x89,0xA9,0x19,0x88,0x52,0x80,0xAC,0xA8,0x91,0x39,0x92,0x12,0xCB,0x59,0x0B,0xA3,0x9F,0x14,0xAC,0x24,0x19,
+0x69,0xF1,0x20,0x90,0x10,0x13,0x99,0xD0,0x1B,0x00,0x60,0xA2,0x80,0x1A,0xB9,0x2A,0x92,0xDB,0xB1,0x39,0xBA,0x70,0xF3,0x89,0x10,0x98,0x90,0x38,0x19,0xF8,0x20,0x11,
+0x9A,0x53,0xA1,0x23,0xAA,0x6B,0xD3,0x28,0x80,0x8D,0x08,0x06,0x02,0x29,0x88,0xF9,0x92,0x8B,0x15,0x89,0x21,0x2C,0xC1,0x00,0xF8,0x2A,0xAA,0x20,0x19,0xC0,0x00,0x10,
+0xD1,0x4A,0xA9,0x31,0xC1,0x14,0x2A,0x21,0xF1,0x40,0xBA,0x8A,0x88,0x08,0x17,0x88,0x11,0x91,0x3A,0xF9,0x19,0x12,0x38,0x06,0x1A,0xA8,0x50,0xD0,0x30,0xC8,0x2B,0x9B,
+0x10,0x8A,0x39,0xB1,0x17,0x29,0x23,0xC8,0x53,0x90,0x88,0xD1,0xA9,0x2E,0x01,0xCA,0x09,0x97,0x8C,0x00,0x2B,0x9A,0x96,0xBA,0x51,0xA3,0x98,0x39,0xA0,0x12,0x18,0x07,
+0xBB,0x95,0x1F,0x89,0xA8,0x00,0x88,0x88,0x1B,0x15,0x1A,0x06,0x21,0x18,0xA4,0x1B,0x37,0xB2,0x09,0x28,0xF0,0x28,0xA8,0x8A,0x10,0xAB,0x31,0xE3,0xB9,0x1D,0x89,0x81,
+0x04,0x8C,0x80,0x8B,0x04,0x2D,0x85,0x20,0x1C,0x83,0x92,0x71,0xA3,0x20,0x10,0x09,0xF1,0x00,0x01,0x23,0xA2,0x2E,0xEA,0x01,0x11,0x99,0x20,0xB0,0x12,0x9E,0x98,0x31,
+0xFA,0xAB,0xA1,0x8B,0x3B,0xAF,0x04,0x8A,0x88,0x90,0x11,0x8C,0xB8,0x1E,0x13,0x3A,0x86,0x24,0x99,0x9D,0x82,0x80,0x02,0x1C,0xA2,0x2C,0x21,0xC2,0x31,0x1C,0x4A,0x99,
+0x97,0x28,0xA9,0xA8,0x1F,0x82,0x9B,0x94,0x9A,0x8A,0x30,0x8B,0x07,0xA1,0x68,0xA9,0x3B,0xAA,0xAC,0xC5,0x09,0x29,0x99,0x82,0x38,0x93,0x93,0x7B,0x98,0x41,0x01,0x00,
+0x3F,0x83,0xB0,0x74,0x88,0x11,0x08,0x59,0x91,0x02,0x33,0x2C,0xE3,0x99,0x2B,0x8A,0xA9,0xC0,0xFB,0x39,0x12,0x0D,0xB2,0xA8,0x81,0x7B,0x22,0x90,0x19,0x00,0x41,0x07,
+0x39,0x00,0xC8,0x11,0x20,0x9A,0x94,0x1D,0xBB,0xAC,0x2A,0xBA,0xA3,0xF9,0xCA,0x19,0xAC,0xBA,0x88,0xB0,0x39,0xD9,0x99,0x38,0xA5,0x31,0xA9,0x77,0x09,0x20,0x91,0x42,
+0x91,0x10,0x23,0x97,0x28,0xC2,0x08,0xAA,0x83,0xBC,0x0B,0x9A,0x2B,0xFF,0x10,0x8A,0x81,0x80,0x7A,0xA2,0x80,0x83,0x3C,0xD2,0x50,0xB2,0x38,0xC2,0x28,0xA1,0x0C,0x80,
+0x90,0x12,0x0F,0xB1,0x81,0xAD,0x99,0x9D,0x99,0xA2,0x8A,0x88,0x9A,0x0B,0xE3,0x30,0x25,0x22,0x92,0x46,0x28,0x01,0x88,0x31,0x31,0x91,0x00,0xFB,0x1F,0x88,0xC0,0x90,
+0xAA,0x53,0x8C,0xA2,0x38,0xFB,0x10,0x22,0x90,0x38,0xB0,0x3B,0x25,0x36,0x90,0x63,0x00,0x81,0x15,0x09,0xA9,0x98,0x08,0x84,0x1E,0xB8,0xAD,0xB0,0xA9,0x99,0x82,0x65,
+0x98,0x24,0x61,0x01,0x99,0x18,0x04,0x51,0xA0,0x38,0xC0,0x91,0xAC,0x8A,0xDF,0x09,0xC8,0x8A,0xA0,0x9C,0x82,0x8D,0xB1,0x1A,0xC0,0x29,0x90,0x71,0x03,0x09,0x42,0x13,
+0x33,0x95,0x3B,0xA8,0x20,0x12,0x46,0x90,0x00,0xAD,0x08,0x0A,0xC2,0x01,0xDC,0x18,0x3A,0xB2,0xA0,0x1A,0x01,0xCB,0x75,0x81,0x30,0x82,0x80,0x27,0x81,0x5A,0x91,0xA1,
+0x01,0xA1,0x09,0xB1,0x2F,0x14,0xAA,0xB3,0x0D,0xAE,0x9A,0x08,0xB8,0xAD,0xBA,0x3B,0xEA,0x28,0xBA,0x22,0x41,0x81,0xC8,0x21,0x83,0x78,0x92,0x27,0x80,0x90,0x0B,0x01,
+0x84,0x20,0x81,0x1D,0x8B,0x06,0x03,0x28,0x0E,0xB8,0x32,0x08,0x17,0x88,0x88,0x29,0x50,0xC3,0x38,0xB8,0x68,0xB1,0xA8,0x29,0x08,0x84,0xC8,0x40,0x9D,0xCB,0xE8,0x89,
+0x29,0xA0,0x00,0xCA,0xBB,0xAB,0x39,0xDB,0x81,0x60,0x34,0x09,0x98,0x04,0x49,0x92,0x52,0x11,0x92,0x4A,0x08,0x41,0xB1,0xB1,0x59,0x82,0x18,0x8E,0xF8,0x88,0x1C,0x89,
+0x20,0xE1,0x0B,0xC9,0x19,0xA8,0x51,0x29,0xB2,0x19,0x70,0xA1,0x18,0xB2,0x3C,0x82,0x53,0x90,0x19,0x0B,0xAD,0x22,0x56,0x2A,0xD9,0x10,0xC0,0x28,0x92,0x80,0xA8,0x9A,
+0x37,0xBB,0x49,0xA0,0xA1,0x4A,0x91,0xA4,0x21,0xBA,0x7B,0xA0,0x34,0x51,0x91,0x64,0xA8,0x00,0x18,0x23,0x02,0x89,0x88,0x09,0xF4,0x1A,0x80,0xC1,0x91,0x0A,0x29,0xB4,
+0x09,0xF8,0x8C,0x02,0xCA,0x51,0xA9,0x9B,0xB9,0xAA,0x86,0xC8,0x80,0x0E,0x90,0x98,0xB1,0x89,0xF8,0x3A,0x12,0x30,0x82,0x8C,0xA0,0x4B,0x31,0x72,0x14,0xB9,0x41,0xA2,
+0x4B,0x18,0x9A,0x31,0x25,0x8A,0x17,0xBB,0x14,0x19,0x83,0x8E,0xA3,0x99,0x02,0xFA,0xA9,0x4B,0x18,0xC8,0x3B,0xF1,0x8C,0x09,0x98,0x08,0x88,0xA8,0x08,0x1C,0x79,0xB8,
+0x39,0x91,0x12,0x24,0x81,0x12,0xCF,0x20,0x31,0x43,0x00,0x91,0x2B,0xFB,0x39,0x50,0x82,0x9C,0x22,0x08,0x07,0x29,0x8A,0x14,0x38,0xB9,0x27,0x89,0x18,0xD0,0x9A,0x33,
+0xBC,0x54,0x08,0x9A,0xB1,0x48,0xA9,0x23,0x9F,0x88,0x01,0x98,0x8E,0xA0,0x2A,0x10,0xB4,0xD8,0x22,0x89,0x11,0xAA,0xFF,0x22,0x22,0xA1,0x09,0x09,0x18,0x09,0x35,0x25,
+0xC9,0x38,0x88,0x50,0xC0,0x09,0xC0,0x59,0x82,0x39,0xD0,0x90,0x0D,0x12,0x05,0x90,0xA9,0x1A,0x18,0x41,0x07,0xA8,0xB1,0x88,0x50,0x28,0x42,0xAB,0x81,0xFA,0x31,0x90,
+0x91,0x91,0xCD,0x38,0x09,0x84,0xAB,0x2B,0xCA,0x9C,0xA8,0x81,0x45,0x80,0x90,0x20,0xF9,0x09,0x83,0x20,0xC1,0x59,0xB9,0x14,0xEA,0x00,0x9B,0x0B,0x4E,0x95,0x99,0xA0,
+0x9A,0x19,0x17,0x89,0x02,0x8B,0xB8,0x10,0x18,0x99,0x21,0x08,0x02,0x76,0xB4,0x09,0x90,0x2B,0x52,0x10,0x11,0xF3,0x9D,0x00,0x01,0xA0,0x8B,0x81,0x10,0xEB,0x22,0xAF,
+0xA9,0xAB,0x11,0x12,0xA0,0x3D,0x13,0x91,0xBC,0x03,0x7C,0x24,0x91,0x20,0x99,0x21,0x03,0x70,0x15,0xA1,0x30,0x99,0x34,0x99,0x83,0x70,0xC8,0x33,0x19,0xA8,0x4A,0xB1,
+0x68,0x50,0x02,0x19,0x93,0x1D,0x19,0x85,0x18,0xA1,0xAA,0x90,0x91,0xAF,0xA1,0xB0,0xEB,0x33,0x1A,0x10,0xBF,0xA2,0x8D,0x21,0x98,0x9F,0x03,0xBA,0xBA,0x82,0x79,0x12,
+0x81,0x81,0x21,0xAD,0x03,0x19,0x23,0xA2,0xB8,0x00,0xC8,0x8F,0x2B,0x0F,0xBA,0x12,0x33,0x22,0xDF,0xA9,0x09,0x80,0x13,0x83,0x84,0xAD,0x10,0x34,0x58,0x90,0xB8,0x2B,
+0x16,0x00,0x13,0xFB,0x99,0x10,0x30,0x10,0xA0,0xDA,0x0C,0xBA,0x0A,0x37,0xC1,0x1D,0x02,0x81,0x2B,0x02,0x0F,0x92,0x19,0x90,0x13,0x82,0xAA,0x38,0x07,0x9A,0x28,0xB3,
+0x30,0xEC,0x8D,0x40,0x91,0x89,0xA0,0xB0,0x1D,0x22,0x85,0x06,0x88,0x39,0x51,0x91,0x31,0xA0,0x22,0x73,0x13,0xA2,0x26,0xC0,0xBC,0x19,0x25,0x01,0x01,0xD9,0xA9,0xB1,
+0x99,0x4A,0xB1,0x9F,0x02,0xA2,0x69,0xB0,0x1B,0xB1,0x39,0x28,0x62,0xD9,0xCB,0x30,0xA0,0x12,0x8B,0x26,0x1A,0x28,0xDC,0x21,0xB9,0x19,0x8B,0x85,0x8B,0x24,0xAE,0xA0,
+0xC9,0x98,0x23,0x8A,0xB0,0xBB,0xFB,0x8F,0x90,0x92,0xBB,0x08,0x9C,0xAA,0xC2,0x28,0x8A,0xF0,0x0E,0x11,0x13,0x33,0x9C,0x98,0x68,0x11,0x62,0x80,0x08,0x81,0x4B,0x62,
+0x22,0x21,0x90,0x32,0x36,0x28,0x32,0x32,0xA2,0x82,0x16,0x32,0x85,0x9B,0x42,0x03,0x5A,0x98,0x51,0xA9,0x8B,0x3A,0x15,0xDB,0x93,0x1C,0x90,0xAE,0x08,0xB1,0x01,0x9E,
+0x9B,0x10,0xC9,0xBA,0x48,0xF9,0x8A,0x30,0x91,0x48,0xE9,0xAD,0x08,0x18,0x23,0x10,0xB8,0x1C,0xCB,0x82,0x60,0xB0,0x13,0x80,0x0A,0x35,0x34,0xE9,0x9B,0x41,0x92,0x31,
+0x82,0xAA,0xBA,0x8B,0x7B,0x50,0x98,0x28,0xFA,0x11,0x98,0x89,0x2C,0x0A,0x82,0x8D,0x04,0x01,0xA1,0x00,0x08,0x7C,0x07,0x08,0x90,0x10,0xAB,0x51,0x80,0x31,0x80,0x80,
+0x30,0x0F,0x31,0x87,0xD8,0x08,0x81,0x0A,0x81,0xA0,0xDB,0x09,0x91,0x28,0xB3,0x48,0xBE,0x0C,0x68,0x14,0x88,0xBB,0xB0,0x99,0x28,0x15,0xC9,0x2A,0xAA,0x8C,0x20,0xA2,
+0x8B,0xAF,0x20,0x52,0x03,0x80,0xBD,0x88,0x83,0x33,0x03,0x74,0x10,0xCA,0x10,0x85,0x99,0x28,0x82,0x03,0x48,0x33,0xAF,0x20,0x80,0x7B,0x31,0xA0,0x84,0xA0,0x0A,0xB8,
+0x8F,0x37,0x00,0x98,0x19,0x08,0x08,0x52,0xA2,0x22,0x3B,0xF3,0x51,0x12,0x82,0xC9,0x08,0x71,0x82,0x19,0x91,0x8B,0x9C,0x23,0x83,0xBB,0x3C,0xF0,0x0D,0x28,0xD3,0x9B,
+0xC0,0x29,0x90,0x0A,0xD8,0x99,0x8A,0x0A,0x05,0x8F,0x18,0x99,0x91,0x88,0x15,0xA9,0x80,0x63,0xBA,0x82,0x15,0xA2,0x46,0x09,0x22,0x80,0x80,0x16,0x02,0x10,0x80,0x20,
+0x16,0x84,0xA9,0xA0,0x20,0x80,0x57,0x20,0xA1,0xDB,0x19,0x01,0x01,0x02,0xBB,0x80,0xBC,0xB4,0x96,0x9E,0x90,0x0E,0x03,0x12,0xDA,0x88,0xCA,0x80,0x80,0x23,0xA8,0xAA,
+0xBB,0x0C,0x3B,0xD0,0x0B,0x0C,0x03,0x58,0xB8,0xCB,0x03,0x0C,0x03,0x04,0x3C,0x30,0xB5,0xBF,0x12,0xD9,0x30,0x41,0xA9,0xC2,0x80,0x08,0x0B,0x96,0x01,0x2D,0x2A,0x82,
+0x33,0x38,0xC0,0xF3,0x2A,0x44,0x02,0x01,0x80,0x8D,0x72,0x11,0x29,0x81,0xCB,0x08,0x14,0x23,0x0A,0xE8,0xA9,0x42,0x82,0xB0,0x6A,0xA9,0x2C,0x01,0x34,0xA0,0xDA,0x9A,
+0x34,0x1E,0x42,0xB3,0x1B,0xF9,0x38,0x81,0x08,0xB8,0x14,0xCB,0x53,0xA8,0x0D,0x91,0x90,0x11,0x80,0xAA,0x33,0xC3,0xAD,0x1E,0x08,0x31,0x82,0x83,0xBB,0xAF,0x82,0x5A,
+0x01,0x14,0x8B,0xCA,0x53,0x83,0xCB,0x89,0xA0,0x0B,0x73,0x08,0x08,0xAF,0x99,0x08,0x13,0xA0,0x02,0xBE,0x19,0xA0,0x3B,0xB3,0xFF,0x28,0x01,0x08,0xC0,0x09,0x98,0x12,
+0x30,0x08,0x48,0x08,0xFC,0x01,0x28,0x24,0x08,0xF2,0x30,0x18,0x0B,0x36,0x29,0x81,0x14,0xA0,0x52,0x28,0x48,0xA5,0x59,0x18,0x02,0x11,0x08,0x20,0x08,0x38,0x74,0x08,
+0x08,0xB0,0x9F,0x12,0x93,0x0A,0xEA,0xBB,0xA9,0x52,0x98,0xA2,0xAF,0x9A,0x02,0x9A,0xB2,0x9D,0xAF,0x00,0x20,0x98,0xC2,0x0A,0x9C,0x43,0x89,0x20,0x04,0xDA,0x01,0x2A,
+0x35,0x03,0xAC,0x22,0x35,0x80,0x38,0x02,0x17,0x58,0x90,0x72,0x01,0x08,0x10,0x83,0x23,0x8A,0x23,0x73,0x24,0xA0,0x09,0x53,0x08,0x4A,0x80,0x80,0x8C,0xB0,0x76,0xA1,
+0x9A,0x99,0x90,0x41,0x90,0xA3,0xCF,0x01,0x10,0xAA,0xA0,0x9C,0x36,0x13,0xEF,0x09,0x12,0x88,0x28,0xA4,0x9F,0x21,0xD0,0x1A,0x21,0x31,0x27,0x1B,0xA2,0xBF,0x89,0x18,
+0x12,0xCE,0x18,0x11,0x02,0x88,0x89,0xAA,0x02,0x38,0x98,0x80,0x02,0x5C,0x86,0x48,0xB0,0x0A,0x11,0x23,0xBC,0x79,0x12,0x14,0x9A,0x9C,0x20,0x31,0xC3,0xDF,0x09,0x00,
+0xA0,0xBB,0x31,0x53,0x10,0xC1,0x29,0x23,0x09,0x14,0x2A,0xC1,0x10,0x01,0x1F,0x25,0xA1,0x29,0x43,0x11,0x99,0xAA,0x09,0x16,0x2A,0x91,0x63,0xD1,0x3C,0xD1,0x8B,0x33,
+0x08,0x80,0x00,0x1B,0x37,0xB9,0x8D,0x20,0x94,0x18,0x98,0x88,0x1A,0xC1,0x0E,0x31,0x21,0x35,0x83,0xDF,0x99,0x18,0xC2,0x8B,0x41,0x04,0x98,0x0B,0x24,0xDA,0xBC,0xCA,
+0x2A,0x20,0x15,0x18,0x12,0xA0,0x6B,0x03,0xD0,0x8E,0x90,0x28,0x15,0xC9,0x1A,0x02,0xA8,0x38,0x15,0xBA,0xAA,0x28,0x35,0x34,0x80,0x98,0xED,0x09,0x10,0x02,0x81,0x90,
+0x13,0xBA,0x11,0x55,0x14,0x00,0xBB,0xA8,0xEF,0x81,0x0A,0x32,0xA9,0x80,0x89,0x65,0x01,0x41,0xA0,0xCB,0x9B,0x41,0x92,0x19,0x15,0xAD,0x99,0x23,0x75,0x02,0xAA,0x80,
+0xDA,0x98,0x18,0xB8,0xAD,0x38,0x05,0x00,0x11,0xB9,0x90,0xBA,0x50,0xA8,0x01,0x1A,0x15,0x18,0x45,0x22,0x80,0xFB,0x8F,0x80,0x00,0x30,0x12,0xA0,0xAA,0x8A,0x82,0x9B,
+0x09,0x13,0xEF,0x09,0x29,0x05,0xBB,0x10,0x42,0x85,0x8A,0x30,0xD8,0x10,0x90,0xBB,0x0C,0x27,0x22,0x80,0x99,0x32,0x82,0x49,0x93,0xBD,0x73,0x93,0x0B,0x02,0xB9,0x69,
+0x13,0x89,0x19,0x14,0x92,0xAF,0x80,0xA8,0x74,0xA5,0x09,0xC8,0x89,0x10,0xA9,0x90,0x19,0x24,0x72,0x12,0x80,0xDB,0xBB,0x0B,0x41,0x03,0xB8,0x5C,0x85,0x18,0x02,0x98,
+0x0A,0x27,0xA0,0xAF,0x00,0x99,0x8A,0x98,0xCC,0x10,0xA0,0x31,0x54,0x22,0x00,0xC9,0xAB,0xCE,0x08,0x00,0x41,0x10,0x00,0x35,0x10,0x22,0x24,0xDA,0xCA,0x89,0xA0,0xBB,
+0x08,0x75,0x83,0xA9,0x09,0xAB,0x43,0x81,0x10,0xB9,0xCB,0x8A,0xAB,0x40,0x65,0x12,0x98,0x80,0x3B,0x16,0xB1,0x8A,0x51,0x92,0x3A,0x06,0xB8,0x0D,0x80,0x22,0xAA,0xB8,
+0xAC,0x9E,0x46,0x12,0xA8,0x01,0xCB,0xAB,0x89,0x45,0xE8,0x09,0x81,0x99,0x21,0x18,0x54,0x98,0xAA,0x1A,0x26,0xCA,0xBC,0x10,0x23,0x13,0x10,0x21,0x17,0xBD,0x0A,0x01,
+0x08,0xA9,0x3A,0x37,0xB1,0x9B,0xCC,0x2A,0x01,0x25,0x81,0x08,0x02,0xC9,0xAD,0x52,0x28,0x07,0x88,0xC8,0xAB,0xAE,0x31,0x24,0x12,0x01,0x83,0xAA,0xCB,0x08,0xBE,0x20,
+0x72,0x82,0xBB,0xB8,0x9C,0xB9,0x69,0x25,0xA0,0x20,0x10,0x91,0x0A,0x92,0x89,0x74,0x93,0xAA,0x31,0xDC,0xA9,0x8C,0x23,0x20,0x82,0x09,0x27,0x20,0x03,0xAA,0xB8,0x40,
+0xF1,0x1C,0xD2,0xAC,0x38,0x25,0xCA,0x09,0x20,0x10,0x31,0x15,0xBA,0xAB,0x29,0x03,0x09,0x52,0xE9,0x9B,0x20,0x35,0x18,0x80,0xD1,0x0D,0x83,0xAB,0xA9,0x11,0x33,0x99,
+0x21,0x81,0x71,0xB4,0x0D,0xC8,0x30,0xB9,0xEB,0x9B,0x02,0x90,0x29,0x67,0x80,0x10,0x9A,0x88,0xAB,0xB0,0x79,0xA3,0x1B,0x10,0x12,0x20,0xE9,0x9B,0x38,0x17,0x10,0xC8,
+0xBB,0x8C,0x29,0x47,0x20,0xA1,0x9A,0xAC,0x08,0x22,0x10,0x63,0x99,0xCB,0x00,0x70,0x14,0xB1,0xAD,0x80,0x19,0x31,0x16,0x98,0xA0,0x0A,0x98,0x11,0x24,0xDA,0x11,0x88,
+0xA8,0x78,0xA3,0xCB,0x39,0x93,0xAD,0xEA,0x09,0x42,0x20,0x22,0xC9,0x40,0x01,0xA8,0xDB,0x1B,0x42,0x81,0x30,0xA0,0x10,0x9A,0x40,0xA0,0x49,0x77,0x95,0xAA,0xAA,0x89,
+0x80,0x20,0x15,0x20,0x00,0x82,0x9E,0x10,0x31,0x71,0x87,0x9B,0x01,0xB9,0x9A,0x50,0x15,0xA9,0xCA,0xAC,0x88,0x32,0x14,0x20,0x08,0x03,0x08,0xAB,0x16,0xFA,0xAC,0x89,
+0x21,0x22,0x51,0xA1,0x9A,0x80,0x39,0x07,0xAD,0x19,0x90,0x50,0x90,0xAA,0xAA,0x0A,0x82,0x71,0x15,0x01,0xA1,0x9C,0x09,0xBA,0x11,0xA2,0xCF,0x99,0x51,0x33,0x13,0x01,
+0xEA,0x9B,0x9B,0x40,0x92,0x00,0x73,0x12,0x88,0x01,0xA0,0x8A,0xD1,0x9B,0x9A,0x20,0x37,0x32,0x00,0x80,0xCE,0x99,0xA9,0x50,0x22,0x42,0xD0,0x8A,0x89,0x34,0x22,0x23,
+0x1B,0xFB,0x9C,0x99,0xAC,0x30,0x24,0x80,0xA8,0x60,0x45,0xA1,0x09,0xA8,0x9B,0x09,0x0A,0x83,0xCF,0x9B,0x31,0x25,0x12,0xA8,0x0B,0x82,0x34,0x9A,0x91,0xFA,0xAA,0xAE,
+0x01,0x10,0x11,0xA8,0xCB,0x71,0x45,0x81,0x9A,0xAB,0x9B,0x30,0x54,0x92,0xAA,0x99,0x29,0x40,0x05,0x98,0x99,0x8A,0x06,0xCC,0x09,0x18,0x44,0x82,0x9C,0xA8,0x8B,0x53,
+0x13,0xDB,0x39,0x83,0xAF,0x99,0x40,0x45,0x02,0xA8,0xBA,0xAC,0x10,0x20,0x02,0xB2,0xAF,0x88,0xA0,0x70,0x24,0x98,0x18,0xB0,0x9A,0x8B,0x72,0x23,0x99,0xEB,0x9B,0x51,
+0x03,0x00,0x11,0xB1,0x9D,0x00,0xBB,0x10,0x11,0xA1,0x0E,0x32,0x26,0x90,0x99,0x10,0x91,0x9C,0x38,0x72,0x24,0xA9,0x9B,0xBA,0x81,0xFE,0x19,0x23,0x21,0xD9,0x0A,0x02,
+0x23,0xF9,0x9A,0x11,0x33,0xA0,0x89,0x42,0xC0,0xAE,0x49,0x03,0x9B,0x03,0xCA,0x52,0xA9,0x8C,0xF9,0x8A,0x21,0x11,0x24,0x80,0xC0,0xCC,0x08,0x31,0x00,0x33,0x91,0x21,
+0xEF,0x91,0xAB,0x19,0x23,0x20,0x53,0x88,0x63,0x14,0xFA,0x9A,0x08,0x28,0x14,0x20,0x32,0x83,0xCC,0x9A,0xB8,0x9B,0x38,0x81,0x12,0x57,0x28,0x80,0xBB,0x4B,0x15,0x12,
+0xA8,0xEB,0xAC,0x52,0x03,0x00,0xDB,0x08,0x43,0x13,0x98,0x90,0x8D,0x01,0xDA,0x9C,0x20,0x82,0xA3,0x1A,0x60,0xA2,0xBB,0x0A,0x30,0x11,0xDA,0x44,0xC9,0x8A,0xB2,0x9F,
+0x51,0x03,0x83,0x8E,0x98,0x28,0x25,0xFC,0x8B,0x21,0x02,0x29,0xA2,0x0A,0x21,0x09,0x03,0xEA,0x9D,0x38,0x25,0x10,0x81,0x80,0x9E,0xB1,0xDE,0x8B,0x42,0x24,0x81,0xA9,
+0x19,0x91,0x49,0x46,0xA1,0xCA,0xA9,0xAA,0x0A,0x20,0x26,0x20,0xBA,0x8A,0x36,0x11,0x82,0xBC,0x9A,0x21,0xA2,0x2A,0xF8,0x8D,0x10,0x04,0x28,0x92,0x99,0x0B,0xA4,0x9F,
+0x12,0x11,0x11,0x9B,0x26,0x19,0x10,0xF0,0x09,0xB9,0x08,0xB9,0x8C,0x31,0x37,0x32,0xA2,0x02,0xAC,0x01,0xEA,0x0A,0x12,0xBA,0x00,0x99,0xED,0x49,0x54,0x13,0xAB,0x11,
+0x89,0xCC,0x9A,0x73,0x81,0x8A,0x03,0x89,0xA8,0x9B,0x35,0x91,0x73,0x02,0xFB,0x8B,0x18,0x41,0x13,0xA1,0xBB,0x0A,0xDA,0x31,0x32,0x25,0xFA,0x8A,0x89,0x22,0x80,0x10,
+0x22,0xEC,0x48,0xD3,0x8D,0x11,0x91,0x98,0x28,0x04,0x91,0x2B,0x25,0x01,0xDC,0xBE,0x28,0x32,0x12,0xA2,0x4B,0xB1,0xBD,0x2A,0x14,0xB9,0x9A,0x99,0xDB,0x9C,0xB1,0x78,
+0x27,0x01,0x20,0x91,0x99,0xAC,0x10,0x03,0xBC,0x9C,0x90,0x21,0xD8,0x9A,0xB8,0x70,0x17,0x0A,0x22,0x10,0x12,0xCA,0xA9,0x88,0x31,0x13,0xB9,0xBF,0xDA,0xA9,0xAA,0x38,
+0x47,0x23,0x90,0x41,0x89,0x01,0x89,0xE8,0x8C,0x89,0x10,0x11,0xC9,0x28,0x15,0x31,0x92,0xAE,0x00,0x52,0x88,0xB8,0x9B,0xCA,0x18,0x88,0x49,0x17,0x88,0xA1,0x8E,0x23,
+0x82,0x9C,0xA9,0x8A,0x62,0x12,0x08,0x23,0x26,0xFB,0x0A,0xA9,0x82,0xA9,0x4B,0xC1,0x31,0x91,0x49,0x17,0x80,0x88,0x82,0xDC,0x29,0x24,0x22,0xCB,0xB0,0x2A,0xDA,0x8A,
+0x36,0xB1,0xAC,0x0B,0x36,0x11,0x90,0xBA,0x08,0x08,0x01,0x11,0xA3,0xBC,0x99,0xDC,0xBD,0x11,0x62,0x45,0x81,0xA8,0xBE,0x08,0x31,0x21,0x23,0xA0,0xBE,0xEB,0x0B,0x11,
+0x00,0x73,0x14,0x98,0x30,0xF8,0x8B,0xB8,0x18,0x11,0x13,0x42,0x04,0xAB,0x80,0x22,0xB0,0xAE,0x90,0x29,0x12,0xE9,0x9B,0x42,0x43,0x90,0xCC,0x9A,0x52,0x34,0x02,0x88,
+0x01,0xEB,0x28,0xFB,0x9C,0x80,0x80,0xA8,0x09,0x62,0x34,0x01,0x33,0x21,0x92,0xCF,0x99,0x20,0x02,0x9B,0xCA,0x8A,0x02,0x9E,0x11,0x80,0x99,0x12,0xD0,0xBB,0x9D,0x70,
+0x27,0x11,0x98,0x08,0x89,0x00,0x98,0xA9,0xBA,0x88,0x51,0x11,0xA2,0x18,0x2C,0xE0,0x9A,0xBA,0xCD,0x9D,0x51,0x24,0x43,0x02,0x90,0xBC,0x0A,0x01,0x89,0xBA,0x9C,0x42,
+0x90,0xAA,0x41,0x01,0x43,0x26,0x9A,0xE9,0x1A,0x18,0xA0,0x9B,0xCF,0x1A,0x00,0x21,0x43,0x24,0x82,0xB9,0x8D,0x88,0x91,0x19,0xCD,0xAB,0x49,0x26,0x98,0xA9,0x19,0x01,
+0x09,0x40,0x14,0x24,0xA9,0xAC,0x20,0xB0,0xBF,0x89,0x51,0x24,0x32,0xC0,0x9B,0x8A,0x90,0x08,0x39,0xE8,0x1A,0x03,0x66,0x01,0x99,0x41,0x22,0xA1,0xAC,0xAE,0x01,0x21,
+0x09,0x84,0xCC,0x8A,0x80,0x18,0x61,0x25,0xA0,0xAC,0x20,0x18,0x02,0x21,0x63,0xE8,0x9B,0x00,0x41,0x23,0xBA,0xBC,0x9A,0x44,0xA8,0x99,0x52,0x01,0x22,0x12,0x98,0xFB,
+0xAF,0x19,0x00,0x33,0x92,0x0A,0x82,0x8A,0x56,0x90,0x9C,0x90,0x9C,0x80,0x30,0x92,0x09,0x00,0x45,0x62,0x04,0xB8,0xA9,0x9A,0x81,0xDF,0x09,0x02,0x08,0x10,0x72,0x92,
+0x89,0xAA,0x21,0x52,0xB1,0xBD,0x0A,0x21,0x08,0x36,0x90,0x98,0xBB,0x13,0xAD,0x20,0x35,0x02,0x19,0xBC,0x01,0xAE,0x8A,0x32,0x09,0xD8,0xA9,0x29,0xA1,0x69,0x26,0x41,
+0x13,0xA8,0xDC,0xBA,0x08,0x90,0xDC,0x8A,0x13,0x64,0x91,0x89,0x02,0x34,0x90,0x80,0xDE,0x89,0x99,0x9A,0x31,0x54,0x04,0xA9,0xA9,0x00,0x40,0x04,0xBC,0x38,0x83,0x89,
+0xCF,0x19,0x33,0x80,0xA9,0x32,0x92,0x80,0x1D,0x15,0xA9,0x28,0xCA,0x18,0x11,0xF8,0x29,0x08,0x42,0x02,0x33,0xA1,0xBB,0xEF,0x19,0x93,0x89,0x32,0x21,0x27,0x05,0xCC,
+0x9A,0x18,0x14,0x10,0xD8,0x9C,0x38,0x91,0x28,0x82,0x21,0x98,0x23,0xFA,0x9F,0x52,0x82,0xAA,0x08,0x11,0x21,0xB2,0x9E,0xC9,0x49,0x23,0xB9,0x8A,0x20,0xCA,0x19,0x14,
+0x35,0x9A,0x10,0xD0,0x19,0xDC,0x9A,0x21,0x04,0xBB,0x62,0x13,0x11,0x10,0x10,0xA8,0x32,0x67,0xA8,0xBA,0xBD,0x89,0x98,0x0A,0x90,0xCA,0x2A,0x57,0x42,0x83,0xDA,0x1A,
+0x21,0x80,0x30,0x93,0xBC,0x1A,0x35,0xA4,0xCF,0x89,0x18,0x21,0x33,0xF8,0xAD,0x19,0x12,0x33,0x23,0x12,0xAB,0x52,0x23,0xA8,0xA9,0xFF,0x89,0x80,0x98,0x9B,0x42,0x12,
+0x02,0x09,0x40,0x14,0x81,0x09,0xA9,0x2A,0xC5,0x1B,0x36,0xC9,0x9A,0x89,0xDD,0x19,0x25,0x10,0x81,0x99,0xDA,0x1A,0x33,0x24,0x21,0x22,0xC8,0xBE,0xBB,0x1A,0x31,0x43,
+0x03,0x88,0x09,0x92,0xCE,0x4A,0xB1,0xAE,0x89,0x81,0x62,0x02,0x28,0x33,0x34,0xB8,0xBE,0xBC,0x8A,0x0A,0x11,0x25,0x88,0x88,0x30,0x15,0x20,0x23,0x81,0xFB,0xBE,0x88,
+0xBA,0x09,0x09,0x35,0x36,0x13,0xA0,0xCB,0x09,0x98,0x90,0x29,0x55,0xA1,0xBD,0x88,0x09,0x21,0x34,0x83,0xAA,0x90,0x1B,0x45,0x81,0xDD,0x89,0x00,0x80,0x35,0x08,0x11,
+0x99,0x08,0x20,0xC0,0xCD,0xA9,0x1A,0x23,0x01,0x32,0x77,0x83,0xA9,0x8C,0x73,0x83,0xDB,0xAB,0x9A,0x21,0x41,0x33,0x00,0x13,0xDD,0x19,0x11,0x01,0x98,0x11,0xFD,0x2A,
+0x24,0x88,0x20,0xA0,0x9C,0x18,0x91,0xCA,0x0C,0x11,0x33,0xFB,0x8E,0x10,0x42,0x82,0x00,0x80,0xBA,0xBC,0x41,0x14,0x98,0xB0,0x0C,0x13,0x90,0x29,0x76,0x04,0xEB,0x9C,
+0x08,0x00,0x20,0x25,0x81,0x88,0x08,0xB9,0x8E,0x00,0x01,0xA9,0x42,0x20,0x81,0xB9,0xAD,0x80,0x70,0x03,0xC9,0x98,0xAB,0x48,0x43,0x02,0xBA,0x98,0x08,0x73,0x07,0xAA,
+0x28,0x91,0x19,0xD0,0xAC,0x88,0x0A,0x02,0x45,0x01,0x42,0x80,0x9A,0x61,0x24,0xD8,0xBB,0x98,0x11,0x88,0xBC,0xAC,0x18,0x24,0xC8,0x39,0x15,0x41,0x35,0xC8,0x9A,0x98,
+0x09,0x00,0xA8,0x08,0x55,0x01,0x88,0x89,0x20,0x21,0xF9,0xDF,0x00,0x99,0x11,0x01,0x89,0x34,0x13,0x31,0xC0,0xAC,0x90,0xBD,0x89,0x20,0x63,0x83,0x89,0x08,0x33,0x20,
+0x14,0x02,0xCF,0x11,0xCB,0x99,0xA9,0x88,0x42,0x25,0x23,0x45,0xA9,0x81,0xEB,0xAA,0xCA,0xAA,0x1A,0x53,0x44,0x23,0x90,0x99,0x12,0x30,0x02,0xED,0x0A,0x02,0x09,0x23,
+0x93,0xDF,0x8A,0x20,0x03,0xB8,0x9D,0x11,0xBB,0x51,0x23,0x44,0x91,0x31,0x03,0xBF,0x88,0xA0,0x8C,0x8A,0xA0,0xAC,0x30,0x22,0x37,0xA0,0x10,0xA2,0xCE,0x19,0x34,0x15,
+0x08,0x9A,0x88,0x10,0xBA,0xBD,0xEA,0xDB,0x9B,0x42,0x23,0x08,0x22,0x20,0x43,0x36,0x24,0xA1,0xCE,0x0A,0x98,0xBA,0x8A,0xEB,0x8B,0x64,0x13,0x01,0x08,0x11,0x92,0xEA,
+0x9A,0x00,0x41,0x43,0x90,0xDC,0xAA,0x09,0x11,0x30,0x24,0x08,0x23,0x21,0x92,0xDD,0x8C,0xB9,0x40,0x12,0x81,0x10,0xAE,0x80,0x8B,0x2A,0x17,0x88,0x8A,0x22,0xA8,0x1A,
+0xB5,0x4A,0x01,0x11,0x26,0x08,0xA1,0xCF,0x29,0x94,0x9B,0xD9,0x8B,0x44,0x03,0x01,0x81,0xAA,0x91,0x1C,0xA3,0xBE,0x19,0x13,0x42,0x81,0x88,0x41,0x02,0xCA,0xA1,0xFD,
+0x9C,0x10,0x36,0x82,0x98,0xBC,0x19,0x01,0xDC,0x40,0x92,0x20,0x15,0x80,0x90,0x8A,0x52,0x01,0x89,0xD9,0xBF,0x0A,0x81,0x9A,0x51,0x23,0x42,0x82,0x08,0xEA,0xAD,0x21,
+0xA0,0x21,0xA8,0x50,0x03,0x38,0x06,0x89,0x00,0xCC,0x1A,0x05,0xCB,0x0B,0x13,0x99,0xAC,0x73,0x24,0x82,0xA9,0xAB,0xB9,0x48,0xB9,0x8A,0x30,0xBB,0x12,0xBA,0x2B,0x22,
+0x27,0x51,0x35,0x98,0x35,0xBA,0x98,0x8C,0x74,0x82,0x98,0xBA,0xAD,0x9A,0x88,0xB9,0x52,0x01,0x11,0x90,0x10,0x80,0x76,0x92,0x09,0x43,0xC9,0x89,0xCC,0x28,0x27,0x00,
+0xA8,0x9A,0x88,0x9A,0xAC,0x32,0xA9,0x54,0x05,0xBB,0x8A,0x10,0x02,0x8B,0x43,0x35,0xB8,0x59,0xA2,0x49,0xC8,0x8A,0xA1,0xBF,0x00,0x01,0x81,0x08,0x90,0x32,0xBF,0x27,
+0xAA,0x61,0xA1,0x30,0xD8,0x99,0x0A,0x21,0x25,0xA0,0xBB,0xBC,0xA9,0x51,0x14,0x58,0x14,0x81,0xA9,0xDA,0x9B,0x80,0x18,0x36,0x80,0x98,0xBE,0x8B,0x08,0x62,0x32,0x83,
+0x10,0x22,0x88,0xDC,0xAC,0x09,0x80,0x20,0x28,0x31,0xD1,0x99,0x42,0x91,0x90,0x9E,0x51,0x94,0x10,0x98,0x80,0xBF,0x31,0x10,0xC0,0x53,0x1C,0xC8,0x90,0x12,0xCB,0x39,
+0x11,0x86,0x30,0x90,0x9B,0x91,0x9E,0x81,0xD8,0x88,0xAD,0x71,0x23,0x01,0xA9,0x9C,0x18,0x01,0xB8,0x30,0x36,0x11,0xEA,0x9C,0x88,0xA0,0x8B,0x12,0x90,0x41,0x53,0x15,
+0x08,0x12,0x9C,0xB8,0xAB,0xDC,0x70,0x01,0x81,0x80,0xCC,0x0A,0x32,0x83,0x8A,0x32,0xDA,0xDB,0x8B,0x98,0x69,0x14,0x10,0x11,0x40,0x01,0xEB,0x39,0x81,0x28,0xAA,0xDA,
+0xAC,0x63,0x12,0x41,0xB1,0xDB,0x9C,0x18,0xC9,0x10,0x08,0x42,0x16,0xA8,0x08,0x09,0x30,0xA1,0x32,0xBA,0x39,0xA3,0x61,0xFA,0x09,0x82,0x29,0x98,0x1A,0x08,0x05,0xD9,
+0xBF,0xAC,0x20,0x14,0x90,0x39,0x04,0x09,0x22,0x25,0x88,0x9B,0xE9,0x1B,0x14,0x01,0x00,0xE1,0x2C,0xB2,0x0B,0xFB,0x8B,0x45,0x12,0x90,0xAA,0x08,0x8D,0x33,0x12,0x35,
+0x11,0xD8,0xAD,0x98,0x89,0x32,0x37,0x83,0x90,0xFB,0xAC,0x98,0x10,0x88,0x31,0x36,0x02,0x88,0xBB,0x28,0x41,0x15,0x91,0xAC,0x99,0xCA,0xBA,0xDD,0x18,0x41,0x34,0x21,
+0x93,0xAD,0xAA,0x19,0x23,0x16,0xBA,0xAC,0x21,0x03,0x39,0x24,0xC0,0x9B,0xAE,0x88,0x9A,0x11,0x42,0xBA,0x42,0x85,0x29,0x48,0x36,0xC0,0x0A,0xB0,0xAB,0x09,0x81,0xC1,
+0x9A,0x3C,0x37,0x82,0x88,0xA9,0x8A,0x03,0x77,0x00,0xB8,0x9C,0x80,0xCB,0xCB,0x0A,0x64,0x01,0x01,0x00,0x10,0x80,0x89,0x03,0x9D,0x02,0x39,0xF3,0xAE,0x20,0x92,0x9A,
+0x90,0x08,0x20,0x00,0x67,0x12,0x9A,0x80,0xAA,0x89,0xDA,0x9C,0x09,0x52,0x44,0x23,0xD9,0xAB,0x89,0x31,0x80,0x52,0x92,0x9A,0xCB,0xDD,0x18,0x24,0x33,0x81,0x99,0xB9,
+0x0A,0x90,0xAA,0x72,0x96,0x0A,0x21,0x89,0x91,0xAD,0xD9,0x2B,0x16,0x09,0x11,0x91,0x20,0x00,0x17,0x00,0xA8,0xCC,0xAA,0x89,0x10,0x12,0x43,0x24,0x24,0x90,0x9C,0x90,
+0xBC,0x2B,0x45,0x04,0xC8,0xBD,0xAA,0x20,0x34,0x13,0x21,0x23,0xA9,0xEC,0xAE,0x08,0x80,0x10,0x31,0x23,0x02,0x52,0x92,0xCF,0x1A,0x13,0xA9,0xCA,0xBD,0x0B,0x35,0x90,
+0x31,0x98,0x30,0x95,0x89,0x31,0x13,0x89,0x03,0xAF,0x9C,0x10,0xB0,0x8C,0x18,0x11,0x81,0xD3,0x2A,0xD1,0x0A,0x61,0x37,0x81,0xA9,0xAB,0xBB,0xB9,0x8A,0x77,0x12,0x80,
+0xB9,0xAB,0xAA,0x52,0x82,0x9A,0x8D,0x54,0x91,0x18,0x81,0x8A,0x22,0x82,0xA9,0x9A,0xAB,0xCF,0x80,0x19,0x47,0xA0,0xAA,0x08,0x69,0x92,0xBB,0x18,0x11,0x81,0x30,0xB2,
+0x65,0xB9,0x41,0x03,0xE8,0x8A,0x00,0x20,0xC9,0x2A,0xA0,0x33,0xFB,0x89,0x88,0x44,0x02,0x27,0xD9,0xAA,0xAC,0x20,0x22,0x12,0x20,0x91,0xD9,0x9C,0x32,0x92,0x0A,0xCF,
+0x02,0xAA,0x60,0x02,0x99,0x32,0x12,0x74,0xB3,0x9E,0xAA,0x19,0x81,0x00,0x88,0x63,0x22,0x32,0xC0,0xAB,0xE8,0x0B,0x30,0x25,0x82,0x29,0xA0,0xB1,0x9F,0x90,0xAD,0x00,
+0x45,0x33,0x03,0xBB,0x81,0xAC,0x00,0xEB,0x89,0x20,0x03,0x28,0xC1,0x2A,0xB1,0x30,0xF1,0x9E,0x00,0x88,0x53,0x12,0xB0,0x8D,0x12,0x0A,0x27,0xDC,0x99,0x20,0x14,0x10,
+0x11,0xEB,0x9B,0xA8,0x20,0x11,0x00,0x88,0x71,0x04,0x98,0xAB,0x20,0xC1,0x9C,0xBB,0x71,0x15,0x10,0x81,0x98,0xCB,0x8A,0x88,0x80,0x20,0x26,0xDB,0x8A,0x30,0x06,0x18,
+0xB0,0x89,0x73,0x01,0x03,0xBA,0xA9,0xCC,0x09,0xFB,0x1A,0x22,0x32,0x26,0x12,0xB9,0xBA,0xBE,0x19,0x22,0x00,0x13,0x1B,0x23,0xAB,0x16,0x30,0xB3,0xDF,0x89,0x10,0xF8,
+0x8A,0x18,0x21,0x53,0x02,0xA9,0x21,0x12,0xC0,0x8C,0x00,0x90,0x0C,0x91,0x9B,0x37,0xB9,0xB0,0xAF,0x26,0x00,0x03,0xA9,0xA8,0x9B,0x0B,0x57,0x81,0xDA,0x09,0x88,0x09,
+0x01,0x30,0x26,0xFC,0x89,0x90,0x31,0x32,0x32,0x33,0xCC,0x09,0x81,0xA9,0x9A,0xBA,0x29,0xFB,0x18,0x10,0x98,0xEF,0x19,0x43,0x14,0x20,0xA1,0x8B,0x12,0xA9,0xCE,0x28,
+0x80,0x12,0xEA,0xBB,0x09,0x44,0x13,0x38,0x15,0x08,0xB8,0xAA,0x58,0xB1,0xAF,0x08,0xB8,0x59,0x23,0x00,0x00,0x21,0xC8,0x8C,0x13,0xA1,0xDF,0x0B,0x00,0x52,0x84,0x89,
+0x08,0x32,0x43,0xC8,0x88,0xDA,0x10,0x08,0x90,0x32,0xAE,0x31,0xEA,0x09,0x81,0x49,0x84,0xCA,0xCB,0x48,0x15,0x11,0x01,0x30,0x84,0x09,0xD8,0x9B,0x90,0x38,0x93,0xEE,
+0xAC,0x00,0x18,0x32,0x16,0x10,0x98,0xAA,0x8A,0x34,0x23,0xB0,0xBE,0x9A,0x10,0x53,0x90,0x98,0x58,0x55,0x82,0xCA,0x9C,0xA8,0x9C,0x08,0x18,0x22,0xA1,0x20,0x21,0x98,
+0x67,0x01,0x28,0xB0,0x38,0x09,0xD1,0xAE,0x00,0xAA,0x00,0xB8,0xAB,0xB8,0x19,0xC1,0x72,0x37,0x98,0xBB,0x88,0x18,0x64,0x14,0x80,0x90,0x38,0xA2,0xCC,0xBB,0xDE,0x9A,
+0x31,0x15,0x01,0x00,0x81,0x09,0x42,0x92,0xDA,0x9C,0x30,0x14,0x20,0xC1,0x0A,0x13,0x31,0xFD,0x0A,0x09,0x21,0xB8,0x1A,0x11,0x71,0xA1,0x58,0x45,0x02,0x98,0xBC,0x98,
+0xBA,0x88,0x98,0x89,0x71,0x15,0x19,0x80,0xBB,0x9B,0x00,0x55,0x13,0xA8,0x39,0xC1,0xAD,0x9A,0x02,0x99,0x09,0x88,0x41,0x27,0x80,0xB8,0x2B,0x26,0x01,0xA1,0x9B,0xC0,
+0xAB,0xBC,0x40,0x33,0xF1,0x9C,0x99,0x52,0x11,0x44,0x81,0xC8,0x0C,0x01,0x90,0xAC,0xA8,0x1A,0x32,0x53,0x11,0x25,0x91,0x01,0xDA,0xBF,0x9A,0x9B,0x62,0x34,0x88,0x32,
+0x00,0x42,0xE1,0xAC,0x99,0xA8,0xBC,0x09,0x30,0x34,0x53,0x22,0x12,0xA9,0x21,0xDD,0x19,0x80,0x80,0x88,0xBA,0x08,0x13,0x46,0x32,0x32,0xF9,0x9E,0x89,0x98,0xBB,0x40,
+0x45,0x81,0x09,0x01,0xA0,0xAE,0x09,0x03,0x28,0x36,0x81,0xA8,0x8D,0x42,0x02,0xDB,0x9C,0x89,0x30,0x25,0x10,0x31,0x93,0xCC,0xBD,0x9A,0x08,0x82,0x9A,0x31,0x45,0x11,
+0x31,0xD8,0xAA,0x0A,0x31,0x14,0x44,0x90,0xAA,0xDB,0x0A,0x11,0xC9,0x08,0xEB,0x9B,0x20,0x05,0x98,0xB9,0x8C,0x71,0x35,0x81,0x21,0x83,0xDC,0xBC,0x8A,0x22,0x10,0x12,
+0x54,0x88,0xCA,0xAC,0x80,0x31,0x14,0x00,0xAA,0x10,0x90,0x10,0x56,0xA2,0x2A,0xA0,0x73,0xA2,0x8C,0x32,0xE8,0xAD,0x38,0x23,0xC0,0x9C,0x88,0x28,0x15,0x08,0x11,0x28,
+0x03,0xAD,0x38,0xB9,0x62,0x46,0xA8,0x88,0xB9,0x89,0x98,0xEC,0x29,0x80,0x58,0x02,0x89,0x98,0xB8,0x29,0x89,0x60,0x47,0x12,0x88,0xA0,0x0C,0xC8,0xAC,0x89,0x00,0xA1,
+0x09,0x45,0x91,0x1A,0x30,0x24,0xCB,0x98,0x09,0x17,0x8B,0x24,0xA9,0x9A,0x98,0x3A,0x43,0x88,0x0A,0x74,0x13,0xBB,0x8A,0x8C,0xEB,0x0A,0xA8,0x8D,0x32,0x55,0x23,0xA8,
+0xAC,0x89,0x98,0x08,0x29,0x04,0x20,0x00,0x62,0x14,0xAA,0x33,0xFA,0x8D,0x89,0x08,0xD9,0x29,0x43,0x81,0x89,0xA9,0x52,0x81,0x8A,0x24,0x25,0x22,0xF9,0x0C,0x32,0x80,
+0xD9,0xBB,0xAD,0x9A,0x21,0x42,0x42,0x98,0x01,0x30,0x26,0x10,0x90,0x30,0x81,0x9B,0xF9,0xCF,0x98,0x10,0x22,0x24,0xCA,0xBB,0xBA,0x61,0x92,0x2A,0x36,0x00,0x88,0x10,
+0x91,0x88,0xC9,0xDC,0x19,0xA8,0x1A,0x33,0x31,0x83,0x57,0x22,0x91,0xED,0x9B,0x00,0x89,0x43,0x02,0x01,0x90,0xAB,0xCB,0xAC,0x11,0x72,0x43,0x82,0x88,0x99,0x98,0xEE,
+0x8A,0x21,0x33,0xA0,0x11,0xA0,0xFB,0x09,0x90,0xDA,0x0A,0x23,0x02,0x70,0x35,0x11,0x00,0xA1,0xAE,0x9A,0xDA,0x18,0x12,0xA8,0x1B,0xD8,0x22,0xBA,0x69,0xA1,0x30,0x22,
+0x45,0x43,0x91,0xBA,0xB8,0xCF,0x18,0x12,0x81,0x9B,0x33,0x82,0xCD,0x29,0x24,0xA8,0xAB,0x31,0x24,0xCB,0xCA,0x9D,0x81,0x60,0x02,0x09,0x21,0x11,0x01,0xDA,0x19,0x25,
+0xA0,0xAF,0x32,0x24,0x82,0xAA,0x89,0xDB,0xBE,0x89,0x31,0x14,0xA8,0x20,0x15,0x98,0x20,0x25,0x98,0xCA,0xAA,0x18,0xCA,0x49,0x13,0xDB,0xEB,0x19,0x91,0x63,0x91,0x29,
+0x55,0x02,0xC9,0xAB,0x9A,0x10,0xEC,0x09,0x21,0x24,0x80,0x88,0xAB,0x8A,0x46,0xA1,0x40,0x94,0xAA,0xEB,0x9B,0x20,0x12,0x01,0x41,0x05,0xCA,0x8B,0x19,0x01,0x35,0x80,
+0x0A,0x11,0xB9,0x30,0xF9,0x30,0xA1,0x71,0x13,0xAC,0x88,0xCA,0x9B,0x89,0x62,0x24,0x12,0x11,0xD9,0xBA,0x18,0x24,0x18,0x06,0xBB,0x89,0x14,0x11,0x91,0xBC,0x19,0xF9,
+0x0E,0x18,0x31,0x22,0x28,0x23,0x23,0xCC,0x18,0x02,0x91,0xBA,0xCC,0xBC,0x52,0x90,0xB0,0x0A,0x98,0xED,0x9B,0x43,0x31,0x34,0x02,0x30,0xD3,0xAE,0xAA,0x33,0x33,0x23,
+0xCC,0xEB,0x18,0x02,0x11,0xA8,0xEE,0x8B,0x12,0x20,0x26,0x33,0x81,0xBB,0xC9,0xDB,0x09,0x80,0x88,0x99,0xAD,0x34,0xA8,0x40,0x43,0x32,0x33,0xC0,0x30,0xB0,0xDD,0xBA,
+0xAD,0x00,0xC9,0x09,0x63,0x12,0xB8,0xAC,0x51,0x11,0x02,0x11,0x00,0x02,0xFC,0x8A,0x28,0x83,0xBA,0x35,0xDA,0xAB,0x38,0x15,0x02,0xBC,0x08,0xDB,0x19,0x00,0x35,0x90,
+0x62,0x23,0x98,0x23,0xB1,0xFF,0x9B,0xA8,0x18,0x10,0x53,0x13,0x81,0x99,0xAD,0x30,0x81,0x80,0xA8,0x8D,0x42,0x52,0x04,0xAB,0x9A,0xB9,0xCE,0x89,0x43,0x25,0x80,0x99,
+0x89,0x21,0x91,0x99,0xBA,0x40,0x22,0x86,0xDD,0x89,0x98,0x39,0x34,0x21,0x34,0x00,0x98,0xAB,0xCA,0xDB,0x9D,0x11,0x52,0x47,0x90,0xA9,0xAB,0x09,0x23,0x92,0x81,0xCB,
+0x9A,0x5A,0x24,0x12,0x98,0xAE,0x98,0x29,0x33,0x90,0xB1,0xC0,0x9D,0x38,0x02,0x38,0x77,0x84,0x9A,0xA9,0x8A,0x12,0x90,0x34,0xE9,0x9B,0x10,0x88,0x33,0xC8,0x9B,0xBC,
+0x8D,0x43,0x81,0xBC,0x0B,0x45,0x24,0x08,0x01,0x91,0xDB,0x2A,0x02,0x29,0xC1,0xCC,0xAB,0x59,0x15,0x10,0x09,0xB8,0x18,0x50,0x91,0xBF,0xAB,0x20,0x21,0x11,0x11,0x33,
+0x14,0x21,0x55,0x00,0xA9,0x9A,0xEC,0x28,0x33,0xA2,0xDE,0x19,0x81,0x09,0x00,0x32,0x84,0xBB,0xA9,0x39,0x04,0x35,0x43,0x16,0xA9,0xAF,0x20,0x90,0xDB,0x09,0x01,0x53,
+0x14,0x21,0xC0,0x9A,0x88,0xAA,0x9A,0x00,0xB1,0x0F,0x25,0x00,0x24,0xCB,0xC9,0x2A,0x03,0x09,0xD8,0xDA,0x01,0x02,0x73,0x81,0x99,0xA9,0x9D,0x31,0x35,0x08,0x91,0xBD,
+0x0A,0x11,0x32,0x23,0xF9,0xAB,0xEB,0x09,0x21,0x53,0x35,0x03,0x89,0xCB,0xBB,0x0A,0x89,0xAA,0x09,0x58,0x53,0x26,0x88,0x99,0x14,0xA8,0x9C,0xA9,0xBA,0x20,0x02,0x28,
+0x77,0x15,0x98,0x99,0x8A,0x91,0xBB,0x9A,0x31,0x43,0xC0,0x9C,0x21,0x01,0x30,0x47,0x02,0xAA,0x9B,0xED,0xAB,0x40,0x33,0x22,0x04,0xB9,0xAD,0x29,0xC9,0x29,0x24,0x12,
+0xB8,0x9C,0x28,0x63,0x34,0x02,0xFB,0x9F,0x08,0x00,0x12,0x11,0x81,0x98,0xAA,0x88,0x80,0x01,0xBB,0x9E,0x73,0x53,0x81,0x89,0xA8,0xAA,0x89,0x30,0x92,0xBB,0xFD,0x29,
+0x03,0xAB,0x91,0x09,0x43,0x57,0x12,0xB9,0x8B,0x01,0x33,0xD1,0xCC,0xAC,0x0A,0x11,0x11,0x11,0xFA,0x2A,0x81,0x09,0x55,0x01,0x10,0x18,0x12,0xD0,0xAE,0x88,0x22,0x15,
+0x98,0xBA,0x30,0xCA,0x01,0xEA,0x00,0x90,0x20,0x01,0x33,0xBA,0x28,0x47,0x26,0x11,0xCA,0xAC,0x9A,0x42,0x01,0x02,0x0C,0x90,0x8B,0x34,0x03,0xBF,0xAB,0x88,0x39,0x43,
+0x21,0x31,0x46,0x02,0xC9,0xAF,0x01,0x88,0x18,0x81,0xAA,0x21,0xB1,0x19,0x82,0xCF,0x0A,0x21,0x25,0x91,0x20,0xC1,0xBF,0x19,0x93,0x52,0x34,0x23,0xB1,0xCD,0x9A,0xBB,
+0x9C,0x30,0x01,0x10,0x83,0x73,0x06,0x98,0xAA,0x00,0xA1,0x9D,0x21,0x43,0x56,0x91,0xA9,0x0B,0x32,0x08,0xFC,0x8B,0x89,0x30,0x35,0x12,0xA8,0xAA,0x29,0x83,0x1A,0x80,
+0x10,0xF0,0xCF,0xAA,0x30,0x54,0x14,0x00,0x88,0xD9,0x9C,0x80,0x00,0x08,0x88,0x61,0x03,0x09,0xD9,0x8B,0x20,0x80,0x50,0x84,0x08,0xA8,0x30,0x34,0x81,0x0A,0x0B,0xBC,
+0xFF,0x9A,0x18,0x01,0x0A,0xA1,0x8B,0x56,0x02,0x01,0x23,0x81,0x9A,0xF9,0x19,0x20,0x43,0xD9,0xBB,0x89,0x91,0x9A,0xFA,0xAD,0x40,0x23,0x23,0x80,0xC9,0x8A,0x11,0x01,
+0xE9,0x0B,0x24,0xA8,0x88,0x80,0x24,0x72,0x24,0x91,0xCC,0xBC,0x18,0x34,0x82,0x08,0xDB,0x0A,0x02,0x09,0x21,0x12,0x52,0xA8,0xDB,0xBF,0x09,0x12,0x22,0x42,0x34,0x01,
+0xA8,0x99,0x09,0x13,0x9C,0xB0,0xBE,0x9C,0x99,0x71,0x24,0x31,0x01,0x89,0x01,0xFC,0x9B,0xA0,0x99,0x11,0x42,0x52,0x10,0x42,0x88,0xFC,0x8A,0x09,0x21,0x22,0x41,0x13,
+0x08,0xA0,0xDE,0x99,0x88,0x91,0xAC,0x19,0x11,0x33,0x12,0x98,0x51,0x03,0x7A,0x15,0x42,0x83,0xCA,0xBE,0xAB,0x99,0xB8,0x0B,0x34,0x36,0x81,0x90,0x8B,0x34,0x01,0x82,
+0xA9,0xFF,0x09,0x09,0x22,0x23,0x12,0xD0,0xAE,0x88,0x32,0x02,0x9A,0x91,0xEA,0x29,0x14,0x10,0x53,0xC9,0xBB,0x8A,0x00,0x35,0x92,0x98,0xDD,0x0A,0x11,0x01,0x54,0x84,
+0x99,0xC8,0xAB,0x42,0x13,0x98,0x41,0x02,0xA8,0xCD,0x89,0x13,0xA0,0xEC,0x0A,0x81,0x8B,0x53,0x22,0x12,0x01,0x04,0xB9,0x1A,0x07,0x1A,0x80,0x9B,0xCD,0x8A,0x19,0x10,
+0x64,0x80,0x1A,0x98,0x01,0x19,0x57,0xA9,0x89,0xDB,0x89,0x10,0x33,0x42,0x16,0x90,0x89,0xAA,0x39,0xB8,0x2B,0x14,0x40,0x25,0x80,0xB9,0xFF,0xAC,0x18,0x24,0x12,0x02,
+0xA1,0xAC,0xA9,0x00,0x31,0x37,0x89,0xC0,0x9C,0x11,0xA1,0x99,0x0A,0x72,0x26,0x00,0x98,0xBC,0x99,0x89,0xA8,0x0A,0x12,0x56,0x90,0x00,0x0A,0x15,0x08,0x81,0x09,0xE9,
+0x9E,0x80,0x21,0x00,0x12,0x03,0xB0,0x0B,0xAA,0xB0,0x0B,0xF8,0x9A,0x08,0xCE,0xDA,0x9C,0x73,0x33,0x12,0x98,0x1A,0x04,0xD9,0x99,0xBC,0x89,0x21,0x81,0xEF,0x99,0x32,
+0x23,0x02,0x88,0x18,0x43,0x51,0x80,0xA9,0xB9,0x9C,0xA8,0xBF,0x21,0x42,0x34,0xA8,0x19,0x03,0xA9,0xDE,0xDB,0x1A,0x23,0x14,0x88,0x11,0x54,0x82,0xA0,0xAC,0x08,0x42,
+0x91,0xBB,0xDE,0x9B,0x11,0x52,0x02,0x08,0x18,0x43,0x80,0x90,0xCD,0x09,0x25,0x91,0x99,0x89,0x02,0x12,0x99,0x30,0xEA,0x2A,0xD0,0x90,0xAC,0x72,0x21,0x42,0x81,0xBC,
+0x08,0x74,0x04,0x89,0xCA,0xAB,0x99,0x0A,0x21,0x31,0xB8,0x9B,0x43,0x36,0x23,0x99,0x29,0x91,0xEF,0x9A,0xA9,0x11,0x25,0xA2,0x9C,0x08,0x31,0x01,0x34,0x24,0xA0,0xDA,
+0xC9,0xAE,0x0A,0x90,0x18,0x52,0x22,0x08,0x90,0xCB,0x9C,0xA2,0x2A,0x24,0x53,0x92,0xBE,0x29,0x98,0x19,0x10,0x9A,0xCF,0x8A,0x32,0x25,0x25,0x12,0x11,0xB1,0xAB,0xC9,
+0x2A,0x14,0xDD,0xCB,0x9A,0x18,0x32,0x45,0x14,0x02,0x98,0x99,0xCE,0x89,0x00,0x22,0x42,0x83,0xBD,0x38,0xA1,0xAB,0x11,0x34,0x01,0x19,0x03,0x71,0x80,0x18,0x30,0x28,
+0xA2,0x0B,0x3B,0xF4,0xDF,0x89,0x08,0x20,0x00,0x11,0x22,0x91,0xA0,0x58,0x93,0x8E,0x02,0x63,0x82,0x90,0xB9,0xDB,0xCA,0xCB,0x89,0x45,0x22,0x01,0x1A,0x98,0x50,0x23,
+0x84,0x1A,0x93,0x7A,0x27,0xA0,0xBB,0xBE,0xBC,0xAB,0x99,0x08,0x08,0x64,0x44,0x43,0x02,0x80,0x89,0x88,0xC9,0xBB,0xCC,0x9A,0x98,0x38,0x01,0x02,0xA8,0x99,0x70,0x14,
+0x90,0xA9,0x80,0xCD,0x2A,0x44,0x45,0x22,0x90,0xBA,0xA8,0x9A,0xCE,0xAB,0x99,0x99,0x08,0x34,0x44,0x24,0x02,0x30,0x93,0xBE,0xA9,0x29,0x26,0x11,0xC8,0xAB,0xA9,0x9B,
+0x88,0x53,0x91,0x18,0x99,0x14,0x99,0x25,0x08,0x91,0xEC,0xAA,0x48,0x06,0x81,0x00,0x9A,0xA0,0xBE,0x1A,0x13,0x99,0x44,0x02,0x43,0x32,0x38,0x27,0xA9,0xA9,0xAC,0x18,
+0x99,0xDB,0x19,0x94,0xBA,0x98,0xAA,0x49,0x77,0x81,0x80,0x01,0x11,0x13,0x90,0x38,0xA9,0xA0,0xFF,0x1A,0x81,0x38,0x83,0x4A,0xA4,0xBF,0x18,0x42,0x01,0x90,0xCB,0x29,
+0x99,0x31,0xA1,0x9C,0x11,0x10,0x34,0xA0,0x08,0xBB,0x37,0x08,0x28,0xF2,0xAD,0x19,0xA0,0x79,0xA4,0x8A,0x90,0x0B,0x23,0x64,0xA1,0x9F,0x08,0x01,0x22,0x88,0x98,0x08,
+0x41,0x18,0xA2,0xAF,0x20,0x01,0x23,0xD0,0x9E,0xA8,0x38,0x36,0x08,0x11,0xA8,0x99,0x9D,0x9A,0x8A,0x12,0x0A,0x34,0x74,0x04,0xA9,0xAA,0x1A,0xC0,0xDA,0x1A,0x41,0x02,
+0x00,0x30,0xC2,0xBF,0xBB,0x30,0x26,0x43,0x80,0x18,0x91,0xBA,0x99,0xAF,0x08,0xA1,0x10,0xBB,0x0A,0x24,0xA1,0x75,0xA1,0x1A,0xC2,0x29,0x34,0xD9,0x09,0xB0,0x19,0x01,
+0x8D,0x23,0x09,0x45,0x91,0xBA,0x08,0xDC,0x40,0x14,0x88,0xBB,0x89,0x12,0xA9,0x74,0x15,0x90,0xAD,0x8A,0x09,0x01,0x31,0x37,0x92,0x80,0xD8,0x8A,0xA8,0x99,0xBC,0x9B,
+0x41,0x37,0x91,0x29,0x20,0x10,0x14,0x08,0x11,0x00,0xDB,0xAD,0x9B,0x19,0xA0,0x73,0x36,0x14,0xB8,0xAB,0x09,0xB0,0x80,0xCB,0x59,0x16,0x80,0x99,0xBD,0xBE,0x89,0x11,
+0x54,0x23,0x80,0x80,0x90,0xA8,0x98,0x18,0x35,0x21,0x50,0xA8,0x8C,0xEB,0x8B,0x80,0x99,0x61,0x13,0xAA,0xDD,0x1A,0x01,0x88,0x48,0x03,0x42,0x32,0x13,0x32,0xF9,0x9F,
+0x08,0x31,0xA1,0xAA,0xD9,0x08,0x90,0x98,0x98,0xC9,0x62,0x44,0x31,0x91,0xBB,0xAB,0xAD,0x11,0x43,0xA1,0xBC,0x9A,0x81,0xED,0x9A,0x20,0x36,0x22,0x01,0xBB,0x8D,0x30,
+0x80,0x9E,0x98,0x81,0xBA,0x1B,0x43,0x63,0x03,0xAB,0x89,0x52,0xC2,0xAA,0xDA,0x10,0x22,0x36,0x91,0xDB,0x08,0x22,0x38,0x94,0xCD,0xAA,0x18,0x01,0x38,0x27,0x00,0x98,
+0x9A,0xB1,0x19,0x75,0x12,0x88,0x9A,0x00,0xDB,0x0A,0x08,0x88,0x22,0x47,0x13,0x98,0xB9,0xD9,0x1A,0x02,0x23,0x08,0x3B,0x37,0x11,0xD9,0x40,0x31,0xDB,0x0C,0x99,0x99,
+0xDB,0x39,0x24,0x74,0x03,0x99,0x8A,0xA0,0x19,0x24,0x99,0x10,0x23,0xCE,0x18,0x82,0x80,0xBA,0xCD,0xA9,0x9C,0x18,0x12,0x16,0x38,0x54,0x02,0xC9,0x9D,0x00,0x21,0x88,
+0x82,0xAE,0x98,0x88,0x11,0x08,0x01,0x9D,0x63,0x13,0x92,0x9C,0x9B,0xEC,0x20,0x25,0x80,0x08,0xA8,0xCD,0x88,0x8A,0x01,0x01,0x83,0x9C,0x68,0x13,0xB9,0xB9,0x1C,0xA2,
+0xAA,0xBD,0xBC,0x9C,0x12,0x46,0x15,0x20,0x98,0xA9,0xCB,0x19,0x21,0x12,0x94,0xAF,0x28,0x22,0x42,0xA1,0xBF,0x0A,0xA9,0x8A,0x34,0x01,0x11,0x91,0x0D,0x33,0x16,0xA9,
+0x08,0x08,0xA8,0x38,0x47,0x02,0x34,0xF9,0x8C,0x88,0x2A,0x13,0x89,0x10,0xFB,0x18,0x82,0x42,0x12,0xD9,0x08,0x10,0x01,0x9A,0x51,0x33,0xA0,0xEC,0x9A,0x61,0x11,0xBA,
+0x1A,0x98,0x70,0x84,0x80,0x23,0xA9,0x18,0xAB,0xBC,0x42,0x23,0x38,0x38,0xCB,0xF0,0x9C,0x44,0x90,0x9A,0xDC,0x28,0x32,0x13,0xA8,0xDA,0xAD,0x8A,0x22,0x45,0x00,0x10,
+0xC9,0x08,0x14,0x20,0x91,0xC9,0xDA,0x1A,0x18,0x23,0xBC,0xAB,0x2A,0x37,0x81,0x10,0x22,0xBF,0xCC,0x09,0x08,0x38,0x52,0x35,0x22,0x98,0x11,0xE9,0x09,0xC8,0x9C,0x99,
+0x20,0x13,0x33,0x36,0xA1,0xBE,0x8A,0x19,0x11,0x83,0xDB,0x0C,0x18,0x10,0x34,0x21,0xB0,0xFA,0x8D,0x28,0xC0,0xCC,0x09,0x10,0x32,0x34,0x33,0x98,0x89,0x34,0x02,0xF8,
+0x9B,0xD0,0x9A,0x09,0x21,0x33,0xAB,0x36,0xB1,0xBA,0x33,0xB8,0x8F,0x84,0x0B,0xA8,0xED,0x38,0x33,0x31,0xB1,0x0D,0x81,0x74,0x82,0xD9,0x9B,0x0A,0x08,0x41,0x44,0x03,
+0xA0,0xEA,0xBB,0x1B,0x12,0x34,0x34,0x13,0xC8,0xCA,0x29,0x01,0xDD,0x9A,0x98,0x9B,0x51,0x24,0x32,0x90,0x38,0xC3,0x29,0xF8,0x9B,0x02,0xBC,0x50,0x33,0x73,0x82,0x99,
+0xD9,0x9B,0xA9,0x1A,0x00,0x9A,0x10,0x73,0x25,0x01,0x22,0xA0,0x8A,0x91,0xDA,0x9B,0x0B,0x73,0x06,0x88,0x0A,0x90,0xCB,0x80,0xAA,0x51,0x83,0x09,0x80,0x82,0x5A,0x10,
+0x15,0xA9,0x80,0x32,0xEB,0x2A,0x07,0xA0,0xCC,0x9A,0x8B,0x23,0x15,0x09,0x31,0xC8,0xB9,0x48,0x63,0x91,0x49,0x84,0x09,0xDA,0x98,0x8A,0x31,0x32,0x85,0x09,0x9C,0xEC,
+0x89,0x88,0x42,0x42,0x33,0x01,0xB9,0xCD,0x9A,0x18,0x35,0x05,0xB8,0xCB,0x9A,0x52,0x22,0xB9,0xBC,0x9A,0x21,0x03,0x0C,0x01,0x46,0x22,0x10,0x04,0xBB,0x00,0xA1,0xDF,
+0x18,0x01,0x99,0xB9,0x9B,0x28,0x37,0x11,0xB9,0xCB,0x48,0x02,0x10,0x07,0x18,0x03,0xBB,0xA8,0x32,0xB3,0xFF,0x90,0x98,0x08,0x89,0x9B,0xBC,0x01,0x20,0x32,0x80,0x8B,
+0x65,0x25,0x34,0x02,0xC0,0x8D,0xBA,0x89,0xB9,0xCB,0x19,0x82,0xD0,0x2A,0x46,0x53,0x81,0x21,0xB0,0xBD,0x99,0xBA,0x30,0x23,0x80,0x83,0xAE,0x24,0x25,0xA8,0xCB,0xBB,
+0x09,0x28,0x45,0x24,0x02,0xBB,0xBC,0x9C,0x30,0x54,0x34,0x02,0x08,0xDD,0xAB,0x09,0x10,0x11,0x32,0x26,0x00,0x99,0x33,0x82,0xB0,0x83,0xF0,0xAF,0xAA,0x09,0x14,0x11,
+0x11,0x80,0x82,0xFA,0xA9,0xAB,0xAE,0x41,0x54,0x01,0x12,0x20,0x03,0xBB,0xDB,0x9D,0x80,0x9A,0x09,0x01,0x21,0x05,0x0C,0x31,0x04,0xBA,0x9F,0x10,0x12,0x23,0x84,0x80,
+0x22,0x25,0xDC,0x9A,0x8A,0x82,0xFB,0x28,0x34,0x88,0x01,0x80,0x80,0xDD,0x9C,0x08,0x19,0x08,0x68,0x53,0x02,0x99,0xA9,0xCC,0x88,0x80,0x99,0x8E,0x08,0x41,0x73,0x02,
+0x88,0x8A,0xAA,0x9B,0xAB,0xA2,0x30,0x72,0x39,0x80,0xAC,0x00,0x0B,0x33,0x70,0xA0,0x28,0xFF,0x9B,0x00,0x21,0x02,0x14,0x00,0x0B,0x88,0x9D,0x81,0xC9,0xA9,0x34,0x23,
+0x74,0x81,0x99,0x1B,0xD3,0xAC,0x89,0x61,0x23,0x90,0xC9,0x00,0x12,0x23,0xA1,0xAE,0x0B,0x01,0xA8,0x80,0x30,0x73,0x42,0x98,0x8C,0x89,0x80,0x37,0x04,0x0A,0x11,0xA9,
+0xBC,0x78,0x11,0x80,0x01,0xC9,0xAB,0x22,0x32,0x38,0xFB,0x28,0x38,0x88,0x73,0x07,0x02,0xAA,0xAB,0x9B,0xC8,0xA9,0x40,0x25,0x00,0x0A,0x2A,0x74,0x01,0x8A,0xBC,0x10,
+0x11,0x41,0x52,0x82,0xDA,0x9B,0xBC,0x81,0x9B,0x80,0x02,0x68,0x31,0x02,0xBF,0xBB,0x9B,0x6A,0x43,0x23,0x01,0xA9,0x29,0x51,0xA0,0xA9,0xDD,0x1B,0x12,0x93,0xAE,0xCB,
+0x9A,0x34,0x24,0x01,0xA9,0x29,0x03,0x80,0x80,0x30,0x37,0x28,0xE3,0x9B,0xCA,0xAF,0xAA,0x98,0x28,0x31,0x22,0x22,0x03,0xF8,0x28,0x54,0x92,0x09,0x91,0x72,0x23,0xBA,
+0x8B,0xA9,0xA8,0xBB,0xC8,0xBE,0x73,0x01,0x01,0xFB,0x9A,0x08,0x23,0x26,0x23,0x11,0x10,0xC9,0xBE,0xAA,0x9C,0x9B,0x19,0x32,0x45,0x23,0x21,0xA0,0xB9,0x42,0x03,0xFA,
+0xAC,0x80,0xB0,0x9B,0x19,0x15,0x53,0x11,0x91,0x98,0x0D,0x01,0x68,0x91,0xCE,0x19,0x22,0x81,0xA9,0xA9,0x80,0x5A,0x35,0x91,0xBB,0x9D,0x74,0x22,0x01,0xC0,0xCC,0x8A,
+0x90,0x10,0x42,0x12,0x12,0x81,0xAA,0x00,0xFA,0x9B,0x30,0xA1,0xAB,0x89,0x83,0x8B,0x77,0x43,0x01,0x90,0xCA,0x8B,0x90,0x89,0x80,0x44,0x81,0xA9,0xBF,0x29,0x81,0x23,
+0xAA,0xA8,0x78,0x54,0x02,0x91,0xDA,0x08,0x80,0x90,0xBD,0x9A,0x08,0x08,0x58,0x9A,0x40,0x07,0x12,0x04,0x90,0x9C,0x99,0x80,0xC9,0xBA,0x08,0x31,0x57,0x33,0x98,0xD9,
+0xAA,0xA9,0xAC,0xB8,0x09,0x41,0x01,0x21,0x15,0x32,0x17,0xA9,0x99,0xCB,0x2B,0x43,0x41,0x22,0x01,0xAC,0x89,0x02,0x02,0xCB,0x9F,0x91,0x40,0x03,0xA8,0xB3,0xFB,0xAB,
+0x20,0x58,0x24,0xA0,0x20,0x37,0x01,0x08,0x08,0x38,0x47,0xA8,0xCB,0xBB,0x1B,0x03,0x71,0x11,0x10,0x91,0x9D,0x99,0x0A,0x54,0x02,0x01,0x21,0xC8,0xAB,0x08,0x02,0xCF,
+0x9A,0x19,0x43,0x82,0x26,0x81,0xCB,0xAE,0x89,0x20,0x80,0x21,0x83,0x9C,0x08,0xB8,0xBA,0x78,0x23,0x80,0xEA,0x39,0xD0,0xBC,0x8E,0x30,0x22,0x01,0x28,0x48,0x80,0xAA,
+0x0A,0x80,0x8F,0x80,0x3A,0x05,0xAC,0xA0,0x0A,0x50,0x42,0xC2,0x8B,0x20,0x08,0xFB,0x0E,0x08,0x22,0x11,0x18,0xA0,0x20,0x33,0xC0,0xBE,0x01,0x20,0x63,0xA0,0xAA,0xB8,
+0xB0,0xC8,0xDF,0x09,0x04,0x11,0x80,0x32,0x52,0x10,0x26,0x98,0x00,0x08,0xD8,0x0D,0x09,0x81,0xA9,0x8A,0x60,0x98,0x9C,0x08,0x42,0x16,0x98,0x90,0x0A,0x08,0x55,0x12,
+0xB9,0xBD,0x8E,0x31,0x45,0x23,0x90,0xDB,0x9A,0xA9,0x09,0x20,0x38,0x08,0xBC,0x61,0x22,0x09,0x81,0x02,0x38,0x08,0x77,0x80,0xAC,0x98,0x99,0x80,0xBB,0x10,0x27,0x00,
+0x91,0x9A,0x0A,0x52,0x32,0x52,0x23,0xFA,0x9D,0x0A,0x00,0x82,0x83,0x00,0x48,0xC9,0xAB,0xC0,0x9A,0x78,0x37,0x91,0xBB,0x9C,0x09,0x08,0x31,0x01,0x98,0x2A,0x27,0x81,
+0x01,0xB8,0xAF,0xB8,0x1A,0x30,0x54,0x14,0x91,0xAB,0x0A,0x89,0x0A,0x88,0x0B,0x48,0xC0,0xBE,0xAF,0x28,0x02,0x89,0x10,0x35,0x44,0xB0,0x09,0x30,0x37,0x14,0x90,0xBA,
+0xAF,0x8A,0x99,0x9A,0x88,0x19,0x65,0x33,0x02,0xA9,0x01,0x0A,0x91,0x8F,0x10,0xBA,0xAB,0xAB,0x58,0x54,0x81,0x90,0x08,0xAB,0x54,0x32,0x9A,0x10,0x02,0x80,0xC0,0x0B,
+0x57,0x53,0x00,0xCA,0xBB,0xCA,0xCA,0x9A,0x21,0x44,0x12,0x03,0x99,0xA9,0x80,0x53,0x23,0xB0,0x8F,0x31,0x21,0x01,0x38,0xF0,0x9C,0x8A,0xA9,0xBB,0x8C,0x44,0xA1,0x00,
+0x28,0x37,0x11,0x21,0xC1,0xBF,0x9B,0x9A,0xAA,0x34,0x33,0x42,0xD1,0x29,0x23,0x28,0x34,0xD9,0xAC,0x9C,0xB0,0xBC,0x41,0x02,0x2A,0x98,0x58,0x83,0x80,0xB0,0x56,0x13,
+0x11,0xC9,0xBE,0xAC,0x38,0x14,0x81,0x82,0x21,0x83,0x22,0xDD,0xBB,0xCB,0x19,0x36,0x33,0x02,0xA9,0x09,0x0A,0x04,0xA8,0xBF,0xDB,0x9B,0x98,0x51,0x53,0x31,0x01,0xCA,
+0x9B,0x32,0x51,0x24,0x84,0xC8,0xBA,0xBC,0x9B,0x11,0x36,0x80,0x9B,0x81,0x21,0xF8,0xAC,0x52,0x34,0x23,0x01,0x9A,0xBC,0xAC,0x09,0xA9,0x9A,0x38,0x26,0x91,0xD9,0x8B,
+0x63,0x13,0x12,0x08,0xF9,0xAA,0x89,0x18,0x99,0x80,0x40,0x15,0x80,0x80,0xA2,0x08,0x73,0x24,0x11,0x43,0xA1,0xBD,0xBB,0x90,0x8A,0x0A,0xDE,0xAA,0xAC,0x31,0xB8,0x89,
+0x80,0x23,0x43,0x16,0x44,0x33,0x11,0xEB,0xCB,0x88,0x21,0x32,0x27,0xC0,0xBC,0x88,0x18,0x80,0xAA,0xB9,0x28,0x02,0x33,0xB8,0x34,0x77,0x23,0x90,0xBB,0xBB,0x0A,0x42,
+0x80,0x20,0x33,0x74,0x85,0x98,0x99,0x89,0xA0,0xCE,0xAA,0x99,0x98,0x28,0x80,0x33,0x77,0x10,0x20,0x12,0x11,0x98,0xA8,0xDC,0xBA,0xBC,0x89,0x03,0x10,0x37,0x13,0x08,
+0x28,0x82,0xFA,0xBE,0x89,0x20,0x33,0x22,0xA1,0xB9,0x33,0x48,0xB8,0x08,0xD8,0xFB,0x53,0x02,0x0B,0xAC,0x8B,0x14,0x43,0x25,0x08,0xB8,0xC9,0xC0,0xAA,0xBD,0x9C,0x32,
+0x24,0x18,0x25,0x11,0x98,0xA9,0x38,0x15,0xA0,0x0D,0x01,0xDC,0x9A,0x31,0x41,0x41,0x52,0x13,0xB9,0xB9,0x9E,0x09,0xB9,0xAD,0x38,0x67,0x12,0x81,0xC9,0xBA,0x0A,0x20,
+0x98,0x0A,0x11,0x45,0x10,0x80,0x30,0xCA,0xCC,0x9A,0x31,0x46,0x32,0xB9,0x8C,0x99,0xA9,0x9B,0x68,0x44,0x80,0x89,0xBD,0x8A,0x08,0x22,0xB2,0xBC,0x00,0x8A,0x67,0x13,
+0x20,0x80,0xCB,0xA9,0xAB,0x80,0xC0,0x9A,0xD0,0x29,0x63,0xB1,0xDB,0x10,0x53,0x82,0x80,0xDA,0xA0,0x18,0x01,0x01,0x52,0x37,0x02,0x09,0xBA,0xBC,0x9B,0xA9,0xDB,0xD9,
+0xB8,0x10,0x73,0x81,0xAC,0x89,0x31,0x37,0x33,0x91,0xDA,0x1A,0x02,0x28,0x83,0xA9,0xDB,0x09,0x0C,0x9A,0x12,0xB0,0x3A,0x48,0xB8,0x58,0x08,0xFF,0x0B,0x50,0x26,0x11,
+0x00,0x88,0xB8,0xBA,0xAC,0xBB,0xAD,0x30,0x44,0x22,0x31,0x91,0xB9,0xC9,0x10,0x23,0x04,0x9C,0xAD,0xA9,0x09,0x8A,0x50,0x25,0x33,0xB8,0xBE,0x2B,0x32,0xA2,0xDE,0x9B,
+0x99,0x20,0x24,0x26,0x23,0x80,0xA9,0xAD,0x19,0x42,0x04,0xA1,0xBC,0xBA,0x80,0x20,0x51,0x27,0x01,0x88,0xB8,0x9C,0xAA,0xBB,0xCA,0xC9,0xA9,0x42,0x43,0x80,0x02,0x64,
+0x12,0x11,0x98,0xAA,0xE0,0xDC,0x09,0x32,0x62,0x82,0x00,0x33,0xD9,0xAD,0xAC,0x18,0x32,0x22,0x01,0xB8,0xAB,0x20,0xB2,0x9E,0x88,0x53,0x43,0x53,0x04,0xA1,0xBA,0xBA,
+0xBC,0xAD,0x19,0x25,0x12,0x28,0x21,0x42,0x80,0xCC,0x8B,0xA2,0x20,0x03,0xAC,0xCB,0xBB,0x70,0x41,0x93,0x0A,0x38,0x83,0x80,0x80,0x17,0x25,0xA8,0xCC,0xBB,0xBC,0x48,
+0x41,0x02,0x08,0xAA,0x1D,0x22,0xA8,0x38,0x64,0x21,0x88,0xCC,0xE9,0xAA,0x89,0x31,0x24,0x32,0x26,0xA9,0x9B,0x28,0x22,0x05,0xA8,0xCF,0x8B,0x99,0x20,0x63,0x21,0x90,
+0xB8,0x89,0xD0,0x80,0x16,0x21,0x43,0x99,0xDB,0xAE,0xBA,0x10,0x33,0x34,0x02,0xEB,0xBD,0x8A,0x10,0x32,0x45,0x22,0xA0,0xA0,0xA9,0xD9,0x8B,0x33,0x83,0x82,0xFA,0xBC,
+0xEB,0x9B,0x30,0x30,0x34,0x98,0xAB,0x9B,0x0A,0x74,0x33,0x23,0x89,0x09,0x48,0x12,0xD0,0x19,0x02,0x04,0xEC,0xBC,0xAA,0x88,0x80,0x10,0xA0,0x0B,0x60,0x45,0x01,0x09,
+0x0A,0x80,0x0A,0x68,0x53,0x24,0x33,0xB1,0xCD,0x9B,0x18,0x01,0x33,0x82,0xE0,0x9B,0x80,0x80,0xB0,0xCB,0xAF,0x21,0x21,0x04,0x48,0x12,0xD0,0x80,0x42,0x63,0x91,0xAA,
+0xBB,0x9C,0x10,0x02,0x37,0x90,0xB9,0xAA,0xBA,0x70,0x26,0x12,0x90,0x98,0xA9,0x89,0x68,0x08,0x28,0x52,0xB1,0xCE,0xAC,0x0B,0x88,0x12,0x08,0x41,0x37,0x12,0x80,0xA0,
+0x90,0x2A,0x82,0x0D,0xAC,0xC9,0xB9,0x1C,0x32,0x17,0x00,0x81,0x89,0x00,0x38,0xBB,0x0C,0x73,0x25,0x82,0x09,0x98,0x8A,0x73,0x13,0xF2,0xCB,0x9A,0x08,0x43,0x32,0x12,
+0x81,0xFB,0xAB,0x8A,0x0B,0x81,0x34,0x14,0x53,0x81,0x80,0xA9,0xFA,0xEB,0x8A,0x98,0x00,0x02,0xA9,0x29,0x54,0x33,0xA0,0xC9,0xA9,0xA0,0xBA,0x3B,0x77,0x32,0x23,0x81,
+0xCA,0x99,0x33,0xC1,0xAD,0xDA,0xCA,0xAA,0x99,0x99,0x58,0x22,0x31,0x01,0x48,0x03,0xB0,0xBD,0x0C,0x28,0x34,0x04,0x21,0x22,0x38,0x33,0xC0,0xFF,0xAB,0xBA,0xAA,0x20,
+0x25,0x81,0x80,0x40,0x46,0x80,0x90,0x0A,0x09,0x88,0x22,0xBD,0xAB,0x80,0x20,0xF0,0xBD,0xBB,0x40,0x45,0x21,0x11,0x12,0x98,0x09,0xA8,0x70,0x11,0x30,0x43,0x08,0xEC,
+0x8A,0x89,0xA9,0xBD,0x8A,0x10,0x30,0x85,0xA9,0xA9,0x38,0x16,0x14,0x08,0x48,0x43,0x10,0xDB,0x9B,0xA9,0x5A,0x13,0x04,0x21,0x04,0x03,0x15,0xE0,0xAB,0xA9,0x00,0x88,
+0x23,0xF3,0xAE,0x99,0x9A,0x99,0x10,0x47,0x33,0x00,0x41,0x03,0x80,0xBA,0x9C,0x19,0x36,0x80,0x01,0xFA,0x09,0xA8,0xCC,0x9A,0x0A,0x11,0x34,0x24,0xA0,0xDB,0x09,0x08,
+0x63,0x90,0xBC,0x9C,0x89,0x43,0x42,0x22,0x11,0x80,0xA0,0x3B,0x33,0x84,0x80,0xF0,0xCD,0x0B,0x38,0x31,0x22,0xD8,0xA9,0x34,0x80,0x83,0x9E,0x0A,0x0A,0xBB,0xCB,0x30,
+0x70,0x27,0x23,0x91,0xFB,0xAB,0x18,0x33,0x35,0x81,0x90,0xB9,0x80,0x20,0xB8,0x8A,0xDF,0xBB,0x0A,0xA0,0x20,0x38,0x78,0x91,0xA8,0x80,0x03,0x0F,0x88,0x20,0x15,0x91,
+0x28,0xEA,0x89,0x42,0x21,0x80,0xE0,0xAD,0x9B,0x34,0x14,0x32,0x98,0xBA,0xDA,0xC9,0x0B,0x12,0x22,0xB0,0x0B,0xBC,0x08,0xBD,0x4B,0x72,0x11,0x22,0xDA,0x10,0x22,0x27,
+0x22,0x32,0xA8,0xCA,0xFA,0x9D,0x09,0x89,0x28,0x83,0x12,0x84,0x80,0x20,0xB8,0xFB,0xC9,0x39,0x64,0x02,0x02,0xAB,0x0B,0x80,0xA8,0x80,0xBB,0x08,0xD8,0x73,0x20,0x08,
+0x35,0x14,0x00,0xAD,0x0A,0x21,0x83,0xF0,0xAC,0x99,0x0A,0xAA,0x20,0x36,0x63,0x80,0x09,0x98,0x28,0x50,0x21,0x02,0xBE,0x9B,0x0A,0x08,0x9E,0x08,0x58,0x13,0x02,0xBA,
+0xBB,0x80,0xCC,0x00,0x03,0x84,0xB4,0x48,0x78,0x43,0x18,0xA0,0x80,0xBA,0xFF,0xAA,0x99,0x20,0x21,0x53,0x23,0x11,0x12,0xA9,0xAB,0xBB,0xBF,0x8E,0x18,0x32,0x10,0x9A,
+0x08,0x32,0x70,0x24,0x15,0x81,0x9B,0xCB,0xDB,0x99,0x11,0x44,0x11,0xB8,0xCB,0xFB,0x9B,0x88,0x14,0x11,0x31,0x36,0x10,0xC9,0xBA,0x0B,0x23,0x03,0x80,0x08,0xAF,0xA9,
+0x80,0x33,0x78,0x12,0x80,0x8A,0x30,0x07,0x01,0x08,0x08,0x8B,0x78,0x21,0xF8,0xCC,0x8A,0x98,0x10,0x32,0x00,0x28,0x16,0x01,0xCA,0x9A,0xA8,0x0B,0x80,0x84,0x03,0x44,
+0x45,0x33,0x20,0xE0,0xB9,0xAF,0x09,0x18,0x01,0x18,0x54,0x13,0xA8,0x0A,0xAA,0x80,0xB0,0x48,0xCB,0xBB,0x80,0xD0,0xCB,0x30,0x37,0x32,0x43,0x34,0x01,0x80,0x80,0x0B,
+0x17,0xA0,0xAC,0xAC,0x00,0xD8,0x9A,0x8A,0x30,0x26,0x23,0x20,0x8A,0x80,0x57,0xB1,0xBB,0xAE,0x99,0x30,0x15,0x12,0xA0,0xAB,0x08,0x3B,0x54,0x14,0xC9,0xDB,0x8A,0x80,
+0x10,0x20,0x63,0x21,0x88,0xB3,0xFB,0x99,0x21,0x82,0xB0,0x8E,0x20,0x15,0x91,0xFA,0x9A,0x19,0x43,0x11,0xEB,0x99,0x10,0x13,0xC0,0xAB,0x1C,0x54,0x23,0x91,0xA9,0xC0,
+0xDA,0x19,0x34,0x34,0x83,0x90,0xC8,0xDD,0xBB,0x8A,0x10,0x31,0x43,0x80,0x0A,0x08,0x80,0x73,0x22,0x58,0x01,0x8A,0xB0,0xFB,0xAC,0x80,0x21,0x08,0x68,0x26,0x12,0xB0,
+0xBB,0xCB,0x29,0x61,0x23,0x91,0xBB,0x9F,0x08,0x99,0x99,0x08,0x51,0x10,0x22,0x82,0xEB,0x8B,0x22,0x23,0x47,0x01,0x98,0xAC,0xCB,0x09,0x48,0x98,0x9C,0x9A,0x28,0x53,
+0x34,0x43,0x23,0xAA,0xDA,0x0A,0x20,0x0B,0xB8,0xCF,0x0B,0x80,0xDA,0x99,0x28,0x08,0x78,0x36,0x22,0x82,0x99,0xDB,0xBB,0x09,0x28,0xC8,0x0A,0x08,0x38,0x37,0x24,0x07,
+0x80,0xD9,0xBA,0x89,0x10,0x21,0x32,0x22,0x0B,0x9E,0x8B,0x38,0x15,0x22,0xB0,0x08,0x08,0x58,0xF8,0xAD,0x1A,0x51,0x12,0x81,0x82,0x80,0xBA,0xB0,0xB8,0x78,0x15,0x23,
+0xA0,0xBF,0x9B,0x09,0x10,0x80,0x00,0x08,0x08,0x3D,0x80,0x50,0x36,0x34,0x84,0x80,0xA0,0xB0,0xBB,0xB8,0x08,0x08,0x86,0xAF,0xAF,0x99,0x08,0x54,0x23,0x23,0x80,0xB9,
+0xCC,0x9B,0x08,0x08,0x8A,0x00,0x36,0x34,0x80,0x80,0x80,0xBB,0xAF,0x0C,0x28,0x20,0x32,0x43,0x36,0x21,0xAA,0xBA,0xCF,0x19,0x01,0x28,0x80,0x0B,0xCB,0xBA,0x33,0x00,
+0x08,0x08,0x8F,0x80,0x37,0x85,0x80,0x02,0xBB,0x8B,0x8B,0x80,0x86,0xC0,0xAE,0x29,0x22,0x30,0x43,0x17,0x01,0x21,0x0A,0x30,0xB8,0xF8,0xBF,0x1A,0x32,0x23,0xC8,0xCC,
+0x99,0xB9,0xA0,0x80,0x23,0x67,0x11,0x21,0x12,0x82,0xA9,0xDA,0xBB,0xBC,0x08,0x38,0x78,0x13,0x82,0xFB,0x0A,0x08,0x98,0xCB,0xAB,0x20,0x35,0x43,0x41,0x84,0x21,0x81,
+0xA9,0xDD,0x9A,0x10,0x41,0x28,0x0A,0x08,0x02,0xBF,0x9B,0x2A,0x27,0x01,0x98,0x9A,0xBA,0x00,0x38,0x47,0x13,0x08,0xAA,0xAD,0xAE,0x20,0x53,0x21,0x11,0x08,0xBC,0x9C,
+0xFB,0x99,0x88,0x09,0x28,0x41,0x13,0x22,0x02,0x33,0x57,0x03,0xB9,0xCD,0x19,0x81,0x80,0x82,0x80,0xB0,0x16,0x23,0x02,0x08,0x83,0x80,0xDF,0xDB,0x89,0x98,0xA9,0x2A,
+0x53,0x01,0xBC,0xAC,0xA9,0x0A,0x20,0x73,0x27,0x20,0x98,0x18,0x02,0x01,0x0A,0x0E,0x28,0x21,0xB0,0xEB,0xEB,0x09,0x18,0x80,0x80,0x80,0xBB,0xAC,0x38,0x74,0x13,0x01,
+0x08,0xB8,0x00,0x03,0x04,0xD8,0xBB,0xC8,0x08,0x34,0x40,0x84,0xB3,0xEC,0xAB,0x8A,0x03,0x36,0x16,0xA8,0xA0,0xA9,0x08,0x08,0x08,0x03,0x35,0x43,0x03,0xEC,0xCB,0xBA,
+0x0A,0x50,0x43,0x21,0x33,0xB8,0x8A,0x43,0x87,0x09,0xFA,0x80,0x10,0x81,0xA0,0xA8,0x8D,0x20,0xA8,0xBB,0x48,0x36,0x34,0x10,0xA0,0xDB,0x9C,0x2A,0x22,0x0B,0x0F,0x98,
+0x08,0x52,0x21,0x20,0x23,0x30,0x04,0x08,0xBD,0xAE,0xBD,0xBA,0xBC,0x30,0x46,0x15,0x81,0x99,0x98,0x89,0x90,0xEA,0x9A,0x90,0x89,0x62,0x63,0x82,0x90,0x80,0x80,0x12,
+0x82,0x80,0xBB,0x8B,0xF0,0xDB,0x80,0xC0,0x9C,0x32,0x16,0x82,0x91,0x2A,0x52,0x33,0x02,0xDD,0xBB,0x19,0x08,0xA8,0xBA,0x9E,0x28,0x52,0x28,0x21,0xB0,0xDE,0x8A,0x21,
+0x45,0x33,0x02,0xC9,0x9C,0x99,0x09,0xBA,0xAA,0x20,0x80,0xC0,0xAE,0x89,0x32,0x16,0x14,0x11,0x22,0x62,0x43,0x83,0xC9,0xBC,0xCC,0x0A,0x99,0x80,0x80,0xD9,0x80,0x12,
+0xA0,0x8D,0x62,0x35,0x11,0x80,0x80,0xC9,0x99,0x21,0x52,0x21,0xC8,0xAB,0xCC,0xAA,0x10,0x32,0x02,0xF8,0xA9,0x89,0x38,0x63,0x23,0xA0,0xB8,0x03,0x84,0xF0,0x08,0x51,
+0x21,0xDC,0xAB,0x80,0x80,0x80,0x32,0x08,0x73,0x16,0x21,0x30,0x08,0xFA,0x98,0x08,0x81,0x89,0xBC,0xAE,0xAB,0x30,0x32,0x15,0x01,0xA8,0x80,0x36,0x25,0x14,0x08,0xBB,
+0xCB,0xBD,0xBA,0x10,0x20,0x51,0x43,0x98,0x0C,0x89,0x22,0x44,0x98,0xAA,0xB0,0xEB,0xC9,0x01,0x73,0x22,0x82,0xC0,0x8A,0x90,0xC8,0xB8,0xAB,0x33,0x33,0x07,0x84,0xA0,
+0x80,0x53,0x14,0xC9,0xBB,0xAE,0x08,0x10,0x01,0x08,0xBB,0x9E,0x28,0x44,0x30,0x42,0x21,0x20,0x02,0x9F,0xBB,0x8A,0x20,0x16,0x80,0xD0,0xA0,0x40,0x21,0xD0,0x9D,0x9B,
+0x10,0x03,0x82,0xBA,0x78,0x73,0x22,0x88,0xAB,0x9C,0x10,0x13,0x22,0x38,0x0B,0xB8,0xFF,0xA9,0x18,0x01,0x18,0xAB,0xAB,0x80,0x07,0x23,0x22,0x38,0x08,0xF8,0xCB,0x80,
+0x02,0x38,0x16,0x02,0x08,0x83,0x27,0x01,0xBA,0xBD,0xCA,0xBA,0x2A,0x02,0x80,0x84,0x80,0x40,0x40,0x30,0x70,0x21,0xB8,0xBB,0xAF,0xFB,0x0B,0x38,0x32,0x14,0x21,0x08,
+0xA8,0xB8,0x48,0x08,0x08,0x0D,0xAC,0xCB,0x30,0x73,0x80,0x20,0x50,0x80,0x0A,0x0B,0x43,0x16,0x24,0x23,0xD8,0xD9,0xAD,0xAB,0x8A,0x80,0x80,0x02,0x04,0x22,0x02,0x3B,
+0x67,0x21,0x10,0x91,0x08,0x08,0x08,0xCB,0x0B,0x0C,0xFB,0x9A,0xA0,0xDB,0x80,0x20,0x62,0x23,0xCA,0x9C,0x19,0x54,0x22,0x98,0x10,0x02,0x82,0x9E,0x0A,0x0A,0x8D,0x82,
+0xB3,0xFB,0x0C,0x18,0x21,0x01,0xB0,0x0B,0xB8,0x3D,0x03,0x53,0x63,0x10,0xA0,0xBE,0xB0,0xDC,0x9A,0x00,0x11,0x54,0x22,0x12,0x00,0x88,0x20,0x00,0x08,0xD8,0x9F,0x0B,
+0x8A,0x20,0x03,0xBC,0x0B,0x0C,0x08,0x08,0x85,0x07,0x12,0x23,0x33,0x27,0x83,0xDC,0xCB,0xAA,0x89,0x43,0x02,0x08,0x82,0x86,0x80,0x00,0x38,0x02,0x80,0xCC,0x70,0x28,
+0xA1,0xA0,0xB8,0xBB,0x08,0x50,0x73,0x80,0xD0,0x80,0x80,0x02,0xB0,0x88,0x85,0x17,0x33,0x00,0xDB,0xBD,0xAE,0x80,0x11,0x00,0x28,0x08,0x22,0x02,0xF0,0x38,0x54,0x22,
+0x01,0xA8,0xA0,0xAA,0x9E,0x9C,0x89,0x42,0xA2,0xAA,0x3B,0x48,0xB2,0xCB,0xBB,0x08,0x44,0x33,0x00,0x08,0x77,0x32,0x81,0xA0,0xAA,0xAD,0x9D,0xA9,0xA9,0x8C,0x22,0x52,
+0x12,0x20,0x03,0x38,0x40,0xC0,0x8E,0xA9,0x9D,0x0A,0x22,0x38,0x73,0x43,0x08,0x2A,0xB0,0x9D,0xAA,0xB0,0xBB,0x78,0x12,0x00,0x08,0x8B,0xC8,0xC0,0x30,0x34,0x17,0xA0,
+0xAA,0xEA,0xAD,0x80,0x31,0x14,0x33,0x02,0x08,0x25,0x04,0xA8,0xBD,0xEB,0x09,0x38,0x41,0xB8,0xDD,0xAC,0x28,0x22,0x31,0x53,0x33,0x08,0xBB,0xBA,0xAD,0x2A,0x01,0xBA,
+0x9E,0x8B,0x42,0x34,0x25,0x21,0xA8,0xA9,0xBA,0xBE,0xAB,0x0A,0x38,0x33,0xD0,0xF0,0x09,0x63,0x23,0x01,0xBA,0x9C,0x9C,0x99,0x28,0x52,0x32,0x15,0x08,0xEA,0x9A,0x0A,
+0x80,0x0A,0x08,0x33,0x34,0x73,0x42,0x11,0xA9,0xEA,0x09,0x0A,0xAC,0x8B,0x32,0x32,0x00,0x34,0x04,0x08,0x0D,0x38,0xFB,0xAB,0x0A,0x80,0x17,0x44,0x12,0xA0,0x10,0x52,
+0xA0,0xBB,0xCC,0xC9,0xAA,0xAB,0xA0,0x68,0x25,0x33,0x32,0x12,0x89,0x80,0xBB,0xBC,0x0C,0x03,0x08,0xF0,0xB9,0x80,0x30,0x04,0xC8,0x03,0x04,0x08,0xBF,0x08,0x30,0x73,
+0x12,0x02,0xAB,0x8B,0x0C,0x48,0x08,0x07,0xCA,0x9C,0x80,0x00,0x38,0x38,0x30,0x00,0x35,0xD0,0xBE,0xCB,0x89,0x34,0x43,0x41,0x28,0x01,0x8A,0xBA,0xCB,0xCD,0x80,0xAA,
+0xAA,0x0B,0x73,0x27,0x02,0x98,0x99,0x8B,0x10,0xB3,0x80,0xC0,0xF0,0x98,0xA8,0x20,0x03,0x48,0x83,0x80,0x0D,0x48,0x73,0x41,0xA9,0xC9,0xDB,0x8A,0x21,0x43,0x13,0x02,
+0x9D,0x0A,0xAA,0xBB,0x03,0x80,0x35,0x43,0x03,0x53,0x08,0xAF,0x09,0x28,0x80,0xF0,0x08,0x51,0x83,0x21,0xA2,0xFB,0x9E,0x89,0x00,0x31,0x81,0xA0,0x2A,0x45,0x22,0xA8,
+0x89,0x0B,0x8B,0x8B,0xBF,0x68,0x24,0x11,0x80,0xA9,0x9D,0x0C,0x0A,0x08,0x08,0x80,0x43,0x43,0x02,0xCB,0x30,0x40,0x08,0x08,0xCD,0xBA,0xAF,0xA0,0x20,0x68,0x21,0x01,
+0x32,0x83,0xB3,0xCC,0xBF,0x08,0x08,0xAA,0x20,0x73,0x43,0x14,0x98,0xDB,0x9A,0xA9,0x40,0x31,0x22,0xBA,0xFA,0x80,0x01,0x22,0x83,0x43,0x08,0xBF,0xCA,0xA0,0x02,0x32,
+0x32,0xF0,0x8B,0x0A,0x3B,0x33,0x27,0x28,0x80,0x83,0xCB,0x8B,0x70,0x85,0x01,0x9A,0xCC,0xAC,0xAA,0x30,0x54,0x22,0x38,0x01,0xBC,0xCB,0x8B,0x00,0x27,0x33,0x11,0xA0,
+0xC8,0xAA,0x80,0x80,0x80,0x04,0xC3,0xCB,0x0F,0x08,0x01,0x20,0x33,0x43,0x43,0xF8,0x0B,0x89,0x0A,0x08,0x73,0x21,0x08,0xA8,0xBB,0xBC,0x9E,0xAA,0x08,0x60,0x23,0x20,
+0x62,0x41,0x33,0x01,0xBA,0xDD,0xAB,0x99,0x80,0x80,0x80,0xC0,0x80,0x30,0x00,0x68,0x03,0x08,0x08,0x08,0x8F,0x9F,0x9A,0xA8,0x08,0x76,0x12,0x10,0x01,0xBA,0xEB,0x9A,
+0x80,0x10,0x00,0x22,0x00,0x03,0x74,0x21,0x01,0x9D,0xA9,0x8A,0x03,0x08,0xC8,0x08,0xD8,0xBB,0x0C,0x08,0x88,0x0D,0x0C,0xC8,0x0E,0x53,0x26,0x22,0x11,0x81,0xA0,0xCA,
+0xDD,0x99,0x98,0x81,0x80,0x12,0x00,0xB8,0xBB,0x08,0x3D,0x30,0x35,0x27,0x03,0xA0,0x08,0x78,0xA9,0xA9,0x80,0xDD,0x9C,0x8A,0x11,0x43,0x14,0x08,0xA9,0xA0,0x08,0x30,
+0x73,0x12,0x35,0x33,0xA2,0xAF,0xBA,0x09,0x08,0x08,0x02,0xCB,0x0E,0x0C,0x21,0x73,0x02,0xB0,0x99,0x80,0x52,0x38,0x20,0x02,0x08,0xAC,0x8B,0x0C,0x03,0x08,0x35,0xD0,
+0xEB,0x8B,0x52,0x33,0x84,0xA9,0x9C,0xAC,0xA9,0x20,0x50,0x22,0x68,0x33,0x01,0x9D,0x9B,0x8C,0x20,0x51,0x10,0x80,0xBA,0xF0,0x99,0x28,0x22,0x23,0x00,0xAF,0x0A,0x80,
+0x08,0xB8,0xBD,0x00,0x48,0x24,0x37,0x26,0x01,0xBA,0xBB,0x09,0x28,0x33,0x33,0xDB,0xBF,0xDB,0x89,0x11,0x13,0x82,0xAA,0xBB,0xEC,0x89,0x42,0x24,0x15,0x22,0x82,0x9A,
+0xAF,0xC9,0x88,0x18,0x00,0xA8,0xA0,0x38,0x48,0x02,0x07,0x21,0x08,0x08,0x48,0xB8,0x08,0x08,0xF8,0xAF,0x9B,0x8B,0x89,0x35,0x25,0x01,0x9A,0xC8,0xC0,0x08,0x28,0x85,
+0x14,0x21,0xAA,0xEA,0xBB,0xC9,0x89,0x20,0x32,0x45,0x03,0xAA,0x80,0x33,0x03,0xF8,0x8B,0x30,0x33,0x40,0x8B,0x0C,0x08,0x0D,0xBC,0x0B,0x58,0x33,0xB8,0xD8,0x80,0x80,
+0x0D,0x08,0x0D,0x48,0x05,0x82,0x83,0x80,0xD0,0xB0,0x48,0x33,0xD0,0x9E,0x8B,0x42,0x46,0x12,0x80,0x99,0xBB,0xAA,0xB0,0x8A,0x8B,0x80,0x35,0x0B,0x44,0x33,0x04,0xF8,
+0x98,0x88,0xB0,0xAE,0x89,0x20,0x30,0x43,0x03,0x08,0x70,0x34,0x32,0x0B,0x9F,0xAB,0x8B,0x08,0x80,0x80,0x70,0x23,0x83,0x03,0xD0,0x0E,0x08,0x08,0x08,0xCB,0x0B,0x73,
+0x32,0x83,0x0B,0x03,0x08,0x0D,0x3C,0x80,0xD0,0xB0,0x0C,0x3B,0x34,0x43,0x33,0xCB,0x8F,0xAB,0x0A,0xB8,0x30,0x40,0x24,0x30,0x34,0x54,0x34,0x03,0x80,0xBA,0xCF,0xCB,
+0x89,0x01,0x80,0xA0,0x0B,0xB0,0xF8,0x28,0x52,0x33,0x82,0x80,0xBB,0x24,0x73,0x82,0xD9,0x9B,0x89,0x80,0x05,0x12,0x0A,0xBB,0xFB,0x9C,0x10,0x22,0xB2,0x80,0x8B,0x85,
+0x17,0x01,0xDC,0xBA,0x89,0x32,0x54,0x13,0x98,0x9B,0x8C,0x82,0x22,0x83,0x80,0xBC,0xFB,0xAC,0x18,0x22,0x80,0x80,0x8F,0x29,0x08,0x8B,0x80,0x34,0x73,0x06,0x01,0x89,
+0x80,0x22,0x02,0xFB,0xA0,0xCB,0x89,0x89,0x08,0x80,0x80,0x80,0x80,0x06,0x37,0x00,0x08,0xFB,0x99,0x28,0x58,0x80,0x80,0x80,0x9E,0x9A,0x88,0x36,0x13,0x10,0x23,0x03,
+0x08,0xBD,0xBB,0x8F,0x0C,0x9A,0x8A,0x30,0x38,0x70,0x63,0x02,0x08,0x9C,0x99,0x8A,0x80,0x33,0x43,0x80,0x0C,0x03,0xD0,0xCB,0xAD,0x80,0x80,0x43,0x45,0x80,0xAA,0x0A,
+0x3B,0x40,0x16,0x02,0x8A,0xB0,0xC8,0x80,0x8B,0x80,0xBE,0xCB,0x43,0x45,0x91,0xAA,0x20,0x33,0x37,0xA0,0xCA,0xCA,0xA9,0x8A,0x33,0x26,0x21,0x32,0x80,0xBF,0x9C,0x09,
+0x28,0x08,0x38,0x64,0x21,0x88,0xAA,0xFB,0x9B,0x30,0x35,0x13,0x80,0xB0,0xFB,0xD0,0x9A,0x8A,0x10,0x14,0x24,0x12,0xD9,0xD9,0xA9,0x10,0x61,0x20,0x01,0x08,0x9A,0xCC,
+0x8A,0x89,0x38,0x62,0x28,0x21,0x15,0x82,0xAA,0x9D,0xBC,0x0C,0x28,0x28,0x38,0x60,0x41,0x30,0x80,0xB0,0xBB,0xCB,0x80,0x80,0x08,0x08,0xBF,0x0C,0x48,0x08,0x08,0x88,
+0x80,0x06,0x08,0x08,0xE8,0x30,0x70,0x23,0x80,0x80,0xDB,0x0B,0x80,0x80,0x80,0x80,0x70,0x41,0x43,0x03,0x03,0x0D,0xAF,0xCB,0x9B,0x08,0x24,0x82,0x30,0x08,0x48,0x30,
+0x85,0x0B,0xC8,0xAC,0x8B,0xC8,0x43,0x70,0x28,0x08,0x08,0x33,0x03,0x08,0x9F,0x0B,0x8B,0x08,0x70,0x51,0x24,0x93,0xBC,0xAF,0x8B,0x08,0x08,0x11,0x02,0x02,0x38,0x70,
+0x32,0x20,0xB0,0x8B,0x80,0xBD,0x8B,0x40,0x34,0x30,0x44,0xBB,0xEC,0xA9,0x00,0xAB,0x0B,0x43,0x47,0x42,0x08,0xB9,0xBB,0xA8,0xB0,0xBE,0xEB,0x9A,0x80,0x21,0x12,0x53,
+0x41,0x12,0x10,0x23,0x33,0x80,0xD0,0xC0,0x8A,0x43,0x03,0xC8,0xFB,0xAA,0x00,0x02,0x83,0x80,0xBD,0x80,0x8C,0x70,0x20,0x83,0x08,0xB8,0xED,0x0B,0x8A,0x20,0x00,0xC8,
+0x30,0x34,0x74,0x82,0xC2,0xCB,0xAC,0x20,0x33,0x23,0x04,0x01,0xEA,0x9B,0xA0,0x20,0x02,0x48,0x08,0x03,0x84,0x80,0x0D,0x03,0x08,0xC5,0x00,0x0C,0x08,0x58,0x83,0x80,
+0xD0,0xC0,0x80,0xCB,0xBB,0xBC,0x48,0x47,0x11,0xA9,0x10,0x02,0x80,0xCB,0x8A,0x30,0x44,0x32,0xB0,0xBD,0x00,0x08,0x08,0x45,0x08,0x03,0x80,0xBE,0xBF,0x9A,0x08,0x38,
+0x33,0x27,0x21,0x30,0x08,0xBF,0xA8,0x0A,0x80,0x80,0x80,0x08,0x05,0x58,0xB8,0xBC,0x80,0x74,0x43,0x81,0x80,0xCA,0xAA,0xBA,0xBA,0xBC,0x43,0x33,0x08,0x58,0x48,0x08,
+0xBC,0x00,0xBC,0xAC,0x8B,0x08,0x35,0x80,0xCC,0x70,0x31,0x01,0x80,0x83,0x03,0x80,0x04,0xBD,0xBB,0x58,0x08,0xB8,0x0D,0x08,0xC8,0x03,0x80,0x80,0xF0,0xCB,0x0B,0x03,
+0x44,0x32,0x34,0x08,0x08,0x80,0x0E,0x08,0x0D,0x48,0x02,0x80,0xCC,0x00,0x08,0x88,0x50,0x07,0x0A,0x9D,0x08,0x28,0x33,0x08,0xC8,0xFB,0x28,0x14,0x04,0x08,0x8C,0x9A,
+0xB8,0xBA,0xEC,0x19,0x42,0x05,0x11,0x0A,0xA0,0x82,0x80,0xCB,0x0B,0x43,0x24,0x03,0x34,0x03,0xD0,0xCB,0x8A,0x8F,0x89,0x80,0xBA,0x80,0x70,0x40,0x20,0x08,0x8B,0x0B,
+0x48,0x80,0xFC,0xA9,0x80,0x72,0x22,0x11,0x80,0x80,0xBA,0x8B,0x80,0x3D,0x00,0xD8,0x80,0x80,0xB4,0xBD,0x0B,0x58,0x83,0x03,0x80,0x50,0x84,0xCB,0xC0,0x00,0x0C,0x8B,
+0x27,0x21,0x20,0x8A,0x9F,0xAA,0xA0,0x08,0x08,0x53,0x16,0x23,0x80,0x00,0xCF,0x99,0x30,0x21,0x22,0xB8,0xBB,0xBC,0x08,0x08,0x3D,0x64,0x80,0xAA,0x0B,0x43,0x32,0xB4,
+0x80,0xDB,0xAF,0x0B,0x10,0x02,0xBB,0xB0,0x08,0x58,0x73,0x42,0x11,0x02,0xBA,0x0E,0x01,0x22,0x08,0x08,0xC8,0xDC,0xA8,0x80,0x03,0xC8,0x0B,0x3C,0x84,0x43,0x83,0xC0,
+0xCB,0x33,0x27,0x03,0xBA,0xBA,0x80,0x8F,0xA9,0x38,0x38,0x64,0x01,0x08,0xB8,0xBA,0xC8,0x80,0x80,0x80,0x66,0x12,0xA2,0x80,0xCB,0x00,0x08,0x88,0x80,0x80,0xF0,0xC9,
+0x08,0x08,0x08,0x0F,0x03,0x43,0x80,0x0C,0xBC,0x0C,0x80,0x47,0x38,0x80,0x80,0x30,0x08,0xAF,0x0A,0xB0,0xBB,0x08,0xD8,0x43,0x63,0x43,0x21,0xA2,0xAB,0xBB,0xBF,0x9D,
+0x18,0x25,0x11,0xA9,0xA0,0xAA,0x00,0x08,0xF8,0x81,0x20,0x30,0x24,0xF0,0xA9,0x80,0x62,0x33,0x21,0x8A,0x30,0x08,0x0C,0xDF,0xB0,0x90,0xA9,0x0A,0x20,0x36,0x21,0x02,
+0x08,0x83,0x80,0xFF,0xAA,0x21,0x32,0x01,0x08,0x02,0xB8,0xBC,0x08,0x08,0xCD,0x00,0x48,0x33,0x40,0x80,0x80,0x05,0xC8,0xAC,0x08,0x43,0x80,0xD0,0x80,0x84,0xC0,0xC0,
+0x03,0x43,0xB8,0xBC,0xBF,0x0A,0x80,0x80,0x43,0x72,0x31,0x84,0x80,0xA0,0xEA,0x0B,0x80,0x82,0xB0,0x30,0x80,0x80,0x80,0xBF,0x0C,0x30,0x80,0xD8,0x80,0x40,0x64,0x12,
+0xA0,0xEB,0x9B,0xAC,0xA0,0x02,0x35,0x54,0x11,0x00,0xA9,0xC0,0x98,0xA8,0x9E,0x9B,0x2A,0x52,0x21,0xA0,0xBB,0x80,0x40,0x43,0x43,0x08,0xC8,0x03,0x84,0xCB,0x80,0xDB,
+0xB0,0xC8,0x43,0x16,0x82,0xAC,0x8B,0x8A,0x33,0x84,0x80,0x34,0x08,0xD8,0xBB,0x3C,0x84,0x80,0x0C,0x30,0x74,0x10,0xA2,0xBA,0xBA,0xBC,0x0B,0x43,0x27,0x01,0xBA,0x0A,
+0x38,0x04,0x03,0xD8,0xC0,0x80,0x30,0x0C,0xC8,0x08,0x58,0x33,0x0B,0x44,0x73,0xA0,0xD9,0x0C,0x0A,0xA0,0x22,0x24,0x52,0x91,0xC8,0xAC,0x0A,0x08,0x38,0x33,0x03,0xD0,
+0x8B,0x84,0x27,0x08,0xA8,0xB8,0x00,0x08,0x58,0x80,0xD0,0x8B,0x80,0x80,0xF0,0xB0,0x08,0x48,0x34,0x30,0x04,0x53,0x0B,0xBC,0x0B,0xBC,0x80,0x8C,0x80,0x50,0x43,0x08,
+0x08,0x35,0x80,0x8C,0x8B,0xD0,0xB8,0xBD,0x00,0x43,0x54,0x04,0xA1,0xAA,0x8A,0x30,0x8B,0x80,0x80,0x80,0x00,0x00,0x00,0x9F,0x00,0x47,0x53,0x08,0xBA,0xBA,0x0A,0x08,
+0x0C,0x3C,0x80,0x80,0xD8,0x30,0x74,0x32,0x08,0xD8,0xA0,0x08,0xB2,0xBB,0xAF,0x89,0x32,0x32,0x34,0x73,0x41,0x81,0xE9,0xAA,0xAA,0x0B,0x28,0x32,0x83,0x80,0x50,0x08,
+0x0C,0x0C,0x30,0x27,0x03,0x02,0xB0,0xBC,0xCF,0x80,0x10,0x08,0x0A,0x88,0x30,0x80,0x80,0x80,0x80,0x57,0x08,0xB8,0xCF,0x99,0x0A,0x20,0x02,0xC0,0x80,0x27,0x25,0x31,
+0x11,0xC0,0xBA,0xBA,0xBA,0xBB,0xBC,0x08,0x04,0x08,0x04,0x74,0x21,0xA8,0xAA,0xBB,0x48,0x33,0x00,0x08,0x08,0x08,0xF9,0x59,0x38,0x00,0xBD,0xBB,0x08,0x04,0x34,0x40,
+0x30,0x00,0x08,0x08,0x08,0x00,0xDF,0x80,0x0B,0xC8,0x08,0x04,0x43,0x84,0x80,0xBC,0xCB,0x80,0x8B,0x80,0x27,0x86,0x20,0x28,0x80,0xBB,0xBC,0x0C,0x80,0x80,0x44,0x08,
+0xC8,0x8B,0x80,0x75,0x21,0x82,0x20,0x30,0x78,0x82,0x0A,0xAD,0xA9,0x08,0x08,0x08,0x88,0xF0,0x9D,0xAA,0x08,0x83,0x80,0x00,0x85,0x27,0x53,0x11,0x89,0xA0,0x08,0xB8,
+0xBC,0x0C,0x43,0x38,0x8B,0xD0,0xC0,0xB0,0xB8,0x08,0xE8,0x0B,0x08,0x37,0x80,0x08,0x0C,0x80,0x34,0x48,0x08,0x0C,0xF8,0x9A,0x8A,0x03,0x33,0x27,0x03,0xB0,0xEB,0xC9,
+0x28,0x51,0x02,0x01,0x0A,0x0B,0x48,0x08,0xBC,0xFB,0xC0,0x80,0x80,0x22,0x80,0x80,0x80,0xBD,0x0C,0x80,0x27,0x21,0x23,0x33,0x30,0xD0,0xCB,0x8D,0x0A,0xB8,0xB0,0x08,
+0x08,0x0E,0x48,0x73,0x21,0x08,0xAB,0xBB,0x8B,0x80,0x50,0x34,0x37,0x80,0xB0,0x0A,0x08,0x03,0xD8,0xCB,0xCB,0xB0,0xAC,0xB8,0x48,0x80,0x50,0x33,0x34,0x80,0x85,0x80,
+0x34,0x80,0xD0,0xFB,0x9A,0x80,0x80,0x83,0x43,0x43,0x08,0xBC,0xB0,0x0C,0x0C,0x03,0x03,0xD8,0x8B,0x40,0x27,0x08,0x0B,0x80,0x80,0x0C,0x0C,0x03,0x84,0x84,0xCB,0xBE,
+0x9E,0x09,0x32,0x42,0x33,0x42,0x10,0x00,0xBB,0x8B,0x80,0xBD,0x8B,0x80,0xE0,0x8B,0x80,0x50,0x08,0x08,0x08,0x36,0x34,0x03,0x80,0xBD,0x0C,0x08,0x88,0x50,0x34,0xB3,
+0xBF,0x9C,0x8A,0x80,0x33,0x24,0x00,0x08,0x04,0x04,0x0C,0x08,0x84,0x8B,0x50,0x03,0x08,0xE8,0x80,0xD0,0x80,0x80,0x00,0x08,0xF8,0xCB,0x00,0x37,0x01,0x02,0x88,0x80,
+0x8B,0xF0,0xAF,0x0A,0x28,0x03,0x14,0xA0,0x80,0x83,0x43,0x30,0x80,0xD8,0xCB,0x8B,0x8F,0x89,0x32,0x33,0x48,0x03,0x48,0xC0,0xC0,0x8A,0x80,0xD0,0x80,0x80,0x08,0xE8,
+0x80,0x40,0x84,0x80,0x00,0x08,0x0F,0x08,0x58,0x83,0xC0,0xC0,0xB0,0xC8,0xB0,0x03,0x58,0x03,0x17,0x08,0xB8,0x8B,0x84,0x80,0x00,0x68,0x08,0xC3,0xC0,0x80,0x0C,0xC0,
+0xC0,0x80,0x80,0x00,0x85,0x40,0x80,0xD0,0x80,0x07,0x33,0x08,0xB8,0x08,0xD8,0xC0,0xBA,0x88,0x00,0x08,0x08,0x08,0x70,0x81,0xD0,0x08,0xD8,0x80,0x80,0x50,0x08,0x04,
+0x08,0x08,0x08,0x78,0x30,0x50,0xB8,0xBC,0xCB,0xCB,0x8A,0x80,0x80,0x35,0x34,0x84,0x80,0x80,0x0D,0xC8,0x0B,0x08,0x80,0x0E,0x48,0x33,0x34,0x80,0xBC,0x0C,0xC8,0x00,
+0x08,0x08,0x05,0x04,0xC8,0xAC,0x08,0x73,0x25,0x13,0x80,0xAA,0x9D,0x8A,0xBA,0xBA,0x3C,0x48,0x08,0xC8,0x0B,0x08,0x80,0x86,0x27,0x21,0xA8,0x20,0x00,0x03,0xBD,0x0C,
+0x80,0x84,0x03,0xD0,0xC0,0xBB,0xC0,0x0B,0x08,0x08,0x08,0x87,0x84,0x03,0x58,0x83,0xC0,0x80,0x80,0x44,0x48,0xB2,0xCB,0xAE,0x89,0x80,0x80,0xCB,0x3B,0x70,0x13,0x00,
+0x08,0x43,0x33,0x80,0xBD,0xCB,0xCB,0x00,0x43,0x33,0x34,0x80,0xCC,0xB0,0xAC,0x08,0x0C,0x08,0x84,0x80,0x50,0x73,0x20,0x01,0xAB,0x8B,0x08,0x80,0xF0,0x80,0x24,0x30,
+0x00,0xFD,0x99,0x08,0x82,0x83,0x03,0x27,0x01,0x80,0x0B,0x03,0xD8,0xC0,0x0B,0x8B,0x80,0x80,0x36,0x00,0xD8,0x03,0x80,0x50,0x40,0x80,0x80,0xBD,0xBC,0xAC,0x08,0x03,
+0x37,0x20,0xB0,0x88,0x00,0xE8,0x80,0x8B,0x0D,0x08,0x58,0x08,0x03,0x80,0xF0,0x30,0x70,0x01,0x80,0x80,0xAE,0x8B,0x8A,0x03,0xC8,0x00,0x48,0x8B,0x00,0x85,0x80,0x85,
+0x84,0x03,0xC8,0x80,0x80,0x80,0x80,0x90,0x00,0xF0,0xC9,0x30,0x80,0x0D,0x0C,0x08,0x48,0x40,0x03,0x44,0x08,0xC8,0xBB,0x0C,0xAC,0xCB,0xB0,0x83,0x50,0x78,0x12,0x82,
+0xB0,0x80,0x80,0xD0,0x03,0x58,0x08,0x08,0x0D,0xB8,0x08,0x0D,0x08,0x04,0x08,0xD8,0xCB,0xC0,0x30,0x30,0x44,0x08,0xC8,0x0B,0x0C,0x48,0x48,0x38,0x80,0x50,0x08,0x08,
+0x80,0x60,0x08,0xBD,0xB0,0x0C,0x48,0x08,0x43,0xC0,0x80,0x80,0xD0,0x08,0x0D,0x03,0x03,0x08,0xBE,0xAC,0x3B,0x73,0x23,0x22,0x00,0x08,0x0D,0x8B,0xBC,0xC0,0x8B,0x64,
+0x30,0x20,0x00,0xF8,0x8B,0x89,0x38,0x83,0x80,0x00,0x68,0x48,0x08,0x0C,0xB8,0x08,0x80,0x80,0x0F,0x0C,0x33,0x04,0xC3,0xB0,0x08,0x08,0x68,0x43,0x03,0x08,0x9F,0x0D,
+0x9A,0x08,0x02,0x08,0x08,0x80,0x80,0x07,0x08,0x84,0x8B,0x0D,0x08,0x08,0x85,0x84,0xC0,0x80,0x84,0x80,0x00,0x08,0x78,0x80,0x80,0xD8,0x80,0x40,0x40,0x80,0x80,0x80,
+0xBE,0x0C,0x08,0x88,0x50,0x80,0xD0,0x0C,0xCB,0x00,0x03,0x88,0x05,0x48,0x80,0x00,0x85,0x40,0x80,0x80,0x0D,0x08,0x08,0x05,0xD8,0x0B,0xC8,0x48,0x08,0x08,0xD0,0x08,
+0x0D,0x08,0x08,0x80,0x36,0x43,0x03,0x08,0xD0,0xB8,0x08,0x8D,0x80,0x80,0xF0,0xB0,0x48,0x38,0x34,0xC0,0xF0,0x9A,0x0A,0x8A,0x30,0x48,0x03,0x43,0x80,0x50,0x08,0x58,
+0x08,0x48,0xB8,0x08,0x9F,0xBA,0x00,0x08,0x88,0x50,0x40,0x80,0x80,0xE0,0xC0,0xB0,0x0C,0x08,0x08,0x35,0x30,0x80,0x50,0x34,0x30,0x80,0xBD,0x0C,0x0C,0x8B,0x40,0x48,
+0x08,0xC8,0xC0,0x8B,0x84,0x07,0x23,0x08,0x02,0xCB,0xBA,0xBC,0x3B,0x40,0x30,0x85,0x80,0xD0,0xB0,0x08,0x3D,0x08,0x08,0x50,0x08,0x04,0x08,0xD8,0x8B,0x8C,0x80,0x35,
+0x43,0x80,0x84,0x80,0x8C,0xD0,0xB0,0x0C,0x08,0x03,0x80,0x80,0x0F,0x08,0x88,0x05,0x08,0x04,0x08,0xE8,0xBB,0x08,0x08,0x08,0x08,0x09,0x00,0x70,0x07,0x22,0xB0,0x08,
+0x0C,0x8B,0xDB,0xB0,0x0C,0x08,0x53,0x83,0x43,0x80,0x80,0x08,0x08,0x08,0x09,0xF0,0x09,0x80,0x0E,0x08,0x0D,0xCB,0x80,0x80,0x35,0x33,0x80,0x85,0xC0,0x80,0x80,0xD0,
+0x08,0x08,0x8D,0x40,0x70,0x10,0x80,0xBA,0x8B,0x80,0x80,0x60,0x08,0x08,0xE8,0x0B,0x08,0x74,0x12,0x00,0xB8,0x0B,0x0C,0x08,0xD8,0x8B,0x80,0x3D,0x40,0x33,0x84,0x80,
+0x0C,0xC8,0x0C,0x80,0x84,0x80,0xD0,0xC0,0x80,0x3B,0x50,0x48,0x32,0x04,0xB8,0x08,0x0D,0x0C,0xCB,0x80,0x80,0x50,0x08,0x03,0x50,0x08,0x08,0x08,0xF8,0xC0,0x80,0x80,
+0x0C,0x0C,0xC8,0x30,0x34,0x84,0x30,0x80,0x0D,0x0C,0x48,0x08,0x03,0x84,0x80,0x80,0x80,0x07,0x08,0xD8,0x80,0x0C,0xC0,0x80,0x40,0x08,0xD8,0xC0,0xB0,0xB8,0x08,0x68,
+0x48,0x02,0x03,0x8C,0xD0,0x80,0x80,0x00,0x85,0x80,0xD0,0x08,0x04,0x48,0x80,0x00,0x08,0x08,0x08,0x00,0x9F,0x0C,0x08,0x08,0x08,0x08,0xF9,0x09,0x50,0x08,0x04,0x0C,
+0x08,0x88,0x05,0x48,0x80,0x00,0x08,0x08,0xF8,0xC9,0x80,0x80,0x50,0x80,0xBD,0xC0,0x80,0x80,0x08,0x45,0x48,0x32,0x00,0x08,0x08,0x08,0xF8,0xC9,0x8B,0x80,0x80,0x80,
+0x8F,0x80,0x0D,0x08,0x08,0x08,0x86,0x40,0x43,0x03,0x03,0x85,0x8B,0xBC,0xC8,0x0C,0x8B,0x80,0x80,0x80,0x37,0x84,0x80,0x0C,0x80,0x8C,0x8B,0x50,0x08,0x58,0x08,0x03,
+0x80,0x80,0x80,0x9F,0x0C,0x08,0x58,0x30,0x80,0x0D,0xC8,0x08,0x08,0x85,0x07,0x84,0x80,0x0A,0xBB,0xBB,0xC8,0x08,0x04,0x08,0x04,0x08,0x85,0x84,0x30,0x00,0x85,0x8B,
+0x0D,0x0C,0x80,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x86,0x80,0x80,0x80,0x37,0x30,0x00,0x08,0xF8,0xC0,0x80,0xC0,0x80,0x80,0x50,0x08,0xD8,
+0x80,0x80,0x50,0x08,0x08,0x08,0x08,0x08,0x00,0xF0,0x09,0x50,0x08,0x08,0x08,0x08,0xF8,0x09,0x80,0x80,0xF0,0x48,0x38,0x40,0x80,0xD0,0x80,0x80,0x80,0x80,0x80,0x9F,
+0x00,0x85,0xD0,0x80,0x80,0x00,0x08,0x08,0x07,0x08,0xD8,0x80,0x80,0xE0,0x80,0x80,0x08,0xE8,0xC0,0x03,0x53,0x38,0x00,0x48,0xD0,0x80,0xC0,0x80,0x8B,0x80,0x86,0x80,
+0xD0,0xC0,0x00,0x48,0x38,0x00,0x58,0x80,0xCC,0x8A,0x8B,0x44,0x08,0x08,0x34,0x80,0x80,0xF0,0xBB,0xCB,0x0B,0x43,0x07,0x08,0x38,0x88,0x80,0x80,0x80,0x80,0x80,0x00,
+0x9F,0x0C,0x08,0x04,0x08,0x68,0x48,0x08,0xC8,0xB0,0x08,0x9F,0xBA,0x0B,0x80,0x44,0x38,0x54,0x22,0x32,0x08,0xC8,0xB0,0xC8,0x0C,0xC0,0x80,0x8B,0x00,0x08,0x78,0x80,
+0x80,0x04,0xD8,0x80,0x80,0x85,0x80,0x00,0xE8,0x80,0x07,0x82,0x02,0x08,0x0C,0x80,0x0C,0xC0,0x30,0x80,0x0D,0x08,0x88,0x80,0x06,0xC8,0x08,0x08,0x85,0x80,0x80,0x80,
+0x80,0x00,0x00,0xF0,0x02,0x80,0x86,0x80,0x00,0x08,0x08,0xF8,0x09,0x85,0x80,0x00,0x08,0xF8,0x30,0x80,0x04,0xBD,0xB0,0x08,0x08,0x08,0x87,0x80,0x85,0x80,0xD0,0x80,
+0x80,0x00,0x08,0x08,0x08,0x70,0x81,0x80,0x80,0x0F,0xC8,0xB0,0x08,0x58,0x80,0x40,0x80,0x85,0x80,0x00,0x8D,0x8B,0x80,0x80,0x07,0x08,0x88,0x05,0x08,0x0D,0x48,0xB8,
+0x08,0xBD,0x08,0x08,0x85,0x40,0x80,0x80,0x80,0x0E,0xC8,0x08,0x58,0x48,0x08,0x08,0x88,0x80,0x06,0x08,0x0D,0x08,0x0D,0x08,0x08,0x08,0x08,0x08,0x09,0x9F,0x00,0x85,
+0x80,0x85,0x84,0x03,0x08,0x80,0x80,0x0F,0xC8,0x00,0x08,0x08,0xE8,0x80,0x80,0x05,0x48,0x80,0x00,0x08,0x0F,0xB8,0x08,0x80,0x80,0xF0,0x08,0x48,0x84,0x84,0x80,0x80,
+0x08,0x08,0x3F,0x80,0x8C,0x8B,0x0D,0x48,0x48,0x08,0x08,0x84,0x80,0x80,0x0E,0x08,0xD8,0x80,0x80,0x80,0x60,0x08,0x08,0x08,0x0F,0x08,0x08,0x80,0x80,0x80,0x00,0x70,
+0x81,0xD0,0x08,0x04,0x08,0x08,0x0E,0xC8,0x30,0x00,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x0D,0xB8,0x08,0x85,0x80,0x80,0x80,0x80,0x00,
+0x00,0x00,0x70,0x81,0x0D,0x08,0x08,0x08,0x08,0x08,0xF0,0x09,0x80,0x60,0x48,0x08,0x08,0xD0,0x08,0xD8,0x30,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x17,0x08,0x8D,0x80,
+0x80,0x86,0x80,0x00,0x08,0x0F,0x08,0x08,0x80,0x80,0x80,0xF0,0x09,0x50,0x08,0x58,0x08,0x0C,0x08,0x04,0x08,0x08,0x08,0x08,0xF9,0xC9,0xC0,0x80,0x40,0x03,0x04,0x08,
+0x08,0x08,0x08,0x2F,0x80,0x80,0x80,0xF0,0x09,0x08,0x05,0x08,0x68,0x08,0xC8,0x80,0x8C,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,
+0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x78,0x81,0x80,0x80,0x80,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,
+0x85,0x80,0x0C,0x0C,0x0C,0x48,0x08,0x08,0x84,0x80,0x80,0x80,0x0F,0x08,0x84,0x80,0x80,0x80,0x80,0x00,0x00,0x9F,0x00,0x8D,0x80,0x50,0x08,0x08,0x85,0x80,0x80,0x80,
+0xF0,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0xF0,0x80,0x8B,0x00,0x68,0x08,0x08,0xD0,0x08,0x58,0x08,0x08,0x80,0xF0,0x80,0x80,0x50,0x08,
+0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x50,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x17,0x08,0x8D,0x80,0x80,0xF0,0x80,0x80,0x00,0x08,0x08,
+0x78,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x86,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,
+0x07,0x08,0x88,0x80,0x80,0x90,0x00,0x70,0x81,0x0D,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0xF0,0x09,0x80,0x80,0x07,0x08,0x88,0x80,0x80,0x90,0xF0,0x09,0x85,0x80,0x00,
+0x08,0x08,0x08,0x00,0x00,0xF0,0x09,0x50,0x08,0x08,0x08,0x08,0xF8,0x02,0x80,0x80,0xF0,0x08,0x88,0x80,0x80,0x70,0x81,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x9F,0x85,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0xF0,0x09,0x80,0x60,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x68,0x08,0x08,0x80,
+0x80,0xF0,0x08,0x48,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x07,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,
+0x70,0x80,0x80,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x85,0x80,0x00,0x08,0x08,0x08,
+0x00,0x00,0x9F,0x00,0x68,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x68,0x08,0x08,0x80,0x80,0x80,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xD1,0xB3,0x03,0x08,
+0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x59,0x08,0x08,
+0x08,0x08,0x08,0x8F,0x80,0x08,0x08,0x08,0xB7,0x00,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0x00,0x8D,0x84,0xC0,0x80,0xB4,0x08,0x88,0xB5,0x03,0x08,0x08,0x08,0x9F,0xB4,0x03,
+0x3D,0x0B,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0xD0,0x03,0x0C,0x80,0x80,0x80,0x80,0x70,0x0B,0x00,0x08,0x08,0x79,0x8A,0x80,
+0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xC2,0x03,0x8C,0x80,0xB5,0x08,0x88,0x80,
+0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x17,0x0D,0x08,0xC3,0x80,0x80,0x80,0x80,0x90,0x00,0x00,0x00,0x17,0x0D,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x70,0x8A,0x80,0x80,0x80,0x00,0x70,0x81,0x0D,0x03,0x0D,0xB3,0x08,0xB4,0x58,0x08,0x3C,0x00,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x4A,0x80,0x3C,0x80,0x80,0x80,0x80,0x9F,0xB5,0x30,0x80,0x0D,0x48,0xB8,
+0x08,0x04,0x0D,0x03,0x3C,0xC0,0xB3,0x84,0x80,0x80,0x80,0x80,0x90,0x2F,0xD0,0x03,0xD0,0x83,0x80,0xB5,0x80,0x80,0x3D,0x80,0x00,0x08,0x08,0x08,0x00,0xA7,0x08,0x08,
+0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA7,0x08,0x08,0x08,0x08,0x00,0xF0,0x02,0x80,0x80,0x80,0x00,0x17,0x0D,0x08,0x08,0x85,0x8B,0x00,0x08,0x08,0xF8,
+0x3D,0xA6,0x00,0x8A,0xB5,0x3C,0x17,0xAB,0x01,0x08,0x13,0xFB,0x69,0x91,0x09,0x01,0xB0,0x28,0xFB,0x21,0x9C,0x33,0x48,0xA8,0x14,0x1A,0xF9,0x3A,0xE9,0x21,0x89,0x02,
+0x08,0x49,0x97,0x8C,0x10,0x81,0x99,0xB0,0x70,0x96,0x0A,0xA2,0x3A,0x91,0x82,0xAD,0x90,0x02,0x2C,0xD2,0x58,0x91,0x80,0xDA,0x81,0x40,0x01,0xA9,0x5A,0x85,0x0B,0xC3,
+0x98,0x10,0x0F,0x02,0xA3,0xAB,0xC3,0x07,0x1B,0xA2,0x5F,0x99,0x81,0x80,0x01,0x98,0x80,0x91,0x6B,0x81,0x39,0x19,0x9F,0x85,0x8B,0x08,0x06,0x8A,0x21,0x90,0xB0,0xD9,
+0x77,0x67,0x9B,0xA9,0x89,0x92,0xAF,0x32,0x80,0x21,0x90,0x81,0x73,0x01,0x88,0xBA,0x89,0xEA,0xAC,0x30,0x01,0x33,0x98,0x53,0xA8,0xBC,0xA8,0x3B,0x07,0x10,0x41,0x01,
+0x23,0xA1,0xA9,0xBB,0x9A,0xDE,0x89,0x21,0xC8,0x28,0x12,0x72,0x01,0x81,0x19,0xA1,0xC0,0x9F,0x88,0x31,0xC0,0x29,0xC9,0x1A,0xC8,0x08,0x90,0x80,0x11,0x4B,0x37,0x32,
+0xD1,0x29,0xC0,0x3A,0xA3,0xBA,0x20,0xAF,0x43,0xA8,0x73,0x90,0x91,0x98,0x98,0x12,0x29,0x38,0x07,0x18,0x05,0x8C,0x10,0xAB,0x18,0xF9,0x1C,0x81,0x0D,0x93,0x89,0x13,
+0x21,0xA9,0xB2,0xAF,0xA1,0x8B,0x00,0x02,0x61,0x81,0x20,0xAD,0x91,0x09,0x8C,0x12,0x10,0x27,0x00,0x43,0x12,0x31,0x81,0xA1,0x58,0xE9,0x00,0x99,0x02,0x11,0x09,0xA3,
+0x8F,0xA1,0xAD,0x0C,0xA8,0x4A,0xC2,0x5B,0x92,0x89,0x89,0xC9,0x8E,0x89,0x1B,0x24,0x9E,0x80,0x14,0xBB,0x03,0x2E,0x64,0x89,0x48,0xA8,0x02,0xBB,0x07,0x38,0x90,0x1F,
+0x12,0x8F,0x12,0x89,0xA2,0xD9,0x30,0x13,0x09,0x2E,0x49,0x00,0x8B,0xA7,0xA9,0xA2,0x83,0x98,0x1E,0x32,0x2D,0x91,0x01,0xE9,0x94,0x93,0xF8,0x08,0x10,0x3B,0x85,0x8F,
+0x93,0xA9,0x84,0xA1,0x91,0x0B,0x13,0x7B,0xA1,0x41,0xF0,0x90,0x84,0x90,0x93,0x00,0x0B,0x25,0xCC,0x81,0x01,0xB3,0xE1,0x80,0x90,0xB3,0x41,0x40,0xA3,0xD9,0xD2,0x77,
+0xD9,0x8A,0x88,0x80,0x19,0x98,0x80,0x90,0x81,0x02,0x77,0xB4,0x8A,0x88,0x09,0x88,0x80,0x59,0x37,0xC9,0x89,0x88,0x88,0x08,0x90,0x67,0x90,0x9A,0x88,0x88,0x72,0x01,
+0x80,0xDA,0x22,0xAB,0x89,0x08,0x27,0x01,0x80,0xB0,0x8F,0x30,0xC0,0x38,0xAB,0x09,0x18,0x27,0x01,0x98,0xF2,0x11,0x80,0x19,0x91,0x9F,0x98,0x80,0x80,0x88,0x47,0xA0,
+0x29,0xC9,0x88,0x29,0x83,0xB8,0x72,0x82,0x9C,0x81,0x0B,0x17,0x00,0xC8,0xA9,0x42,0x18,0x8D,0xB3,0x38,0x23,0x10,0x88,0xB1,0xEF,0x28,0x19,0x13,0x01,0x18,0xFA,0x8C,
+0x88,0x82,0x5B,0xB0,0x08,0x80,0x09,0x28,0x28,0xE3,0x78,0xC3,0x89,0x88,0x90,0x00,0x80,0x19,0x97,0x89,0x90,0x01,0x49,0x1A,0xC8,0x20,0x91,0x19,0x11,0x17,0x8D,0x10,
+0x1B,0x20,0xD0,0x91,0x2A,0xA0,0x03,0x0D,0x72,0xB8,0x02,0x8A,0x17,0x0B,0x0C,0x81,0x81,0x8A,0x39,0xC2,0x01,0xA9,0x32,0xE1,0x32,0x3F,0xF3,0x53,0x9A,0x98,0x98,0x08,
+0x29,0x3A,0x18,0xD1,0x02,0x09,0x1B,0x01,0x28,0x2D,0x87,0x90,0x2C,0x81,0x37,0x0A,0x1A,0x87,0x1A,0xA5,0x0A,0x8C,0x91,0x0A,0x00,0x28,0x3A,0xF8,0x02,0x60,0x90,0x59,
+0x00,0x41,0xA8,0xA8,0xD3,0x9B,0x92,0x2A,0x10,0xD9,0xA8,0x0A,0x90,0x51,0x3B,0xC2,0x20,0x8A,0x79,0x11,0xF3,0x32,0x80,0x92,0x42,0x89,0x10,0x80,0xBE,0x93,0x6B,0xCB,
+0x91,0x3B,0xB1,0x06,0xC0,0x30,0x0F,0x81,0x10,0x01,0x9A,0x82,0x21,0x1D,0xBA,0x24,0xBB,0xB2,0x0A,0x01,0xA4,0x8A,0xC2,0x7B,0x58,0x93,0x9C,0x04,0x09,0xA3,0x78,0x08,
+0x90,0x80,0x01,0xB1,0x92,0xBD,0x21,0xD4,0x58,0xB8,0x31,0x1A,0x20,0xA5,0x10,0xD8,0x58,0x9B,0x93,0xAC,0x98,0xB0,0xA8,0x60,0x83,0xA1,0x39,0xB3,0x30,0x72,0xD9,0x22,
+0x98,0x24,0x02,0xAA,0x63,0x0A,0x50,0x0B,0xB2,0x93,0x22,0x2B,0x80,0x71,0xF1,0x0A,0x91,0x19,0x04,0xE9,0x10,0x19,0x6B,0xC8,0x01,0x88,0x99,0x83,0x10,0x20,0x2B,0xE9,
+0x15,0x1A,0x08,0x94,0xAA,0xB0,0x08,0x59,0x9B,0x04,0xCA,0x68,0xA0,0x14,0xD9,0x28,0x91,0x82,0x32,0xAF,0x96,0x0B,0x81,0x3A,0x3B,0x03,0x1A,0x12,0x17,0x0C,0x32,0xB9,
+0xE1,0x98,0xA4,0x9D,0x21,0xA9,0xA8,0x33,0x8F,0x89,0x03,0x0A,0x04,0xB2,0x4C,0x15,0xB9,0x01,0x82,0x3A,0x8F,0x10,0x94,0x88,0xB0,0x4D,0x8B,0xC4,0x22,0x28,0x0A,0x83,
+0x5B,0xA0,0x21,0x3A,0x9D,0x51,0xA8,0x99,0x9A,0x83,0x08,0x06,0x13,0x11,0xED,0x42,0xB8,0x17,0x0A,0x80,0xA3,0x2C,0x81,0xAB,0x14,0xBA,0x8A,0xB0,0x1D,0x28,0xA2,0x3C,
+0xF0,0x11,0x84,0x09,0x99,0x43,0x9C,0x20,0xF1,0x80,0x48,0x8C,0x20,0xF8,0x11,0x88,0x88,0x40,0xA9,0x05,0x80,0x2A,0x35,0xCA,0x19,0xC4,0x21,0x09,0x9A,0x45,0xA8,0x99,
+0x1C,0x92,0x18,0xA8,0x73,0x18,0x24,0x80,0x8C,0xC0,0x9A,0x08,0x90,0x8C,0x32,0x41,0x9C,0xAD,0xF8,0x12,0xAC,0x00,0xA1,0x29,0x97,0x28,0x99,0x92,0x10,0xC1,0xBC,0x54,
+0x22,0x9A,0x43,0x8D,0xA1,0x22,0x10,0xF8,0x28,0x18,0xC3,0x00,0xAC,0xA8,0x98,0x10,0xBC,0xC0,0x2D,0x13,0x11,0x2A,0x95,0x28,0x24,0x20,0x20,0x17,0x2A,0x11,0x31,0xA1,
+0x81,0xBE,0x22,0xDA,0xB9,0x2A,0x19,0xF9,0x33,0xAC,0x12,0x8E,0xA9,0x96,0x2B,0x05,0x89,0x10,0x89,0x13,0x88,0x11,0x09,0x99,0x7D,0x13,0x00,0x00,0x9B,0x95,0x9B,0xF9,
+0x89,0x28,0x08,0xBB,0x8B,0x30,0xB9,0xEC,0x11,0xEA,0xA0,0x31,0xE3,0x29,0x90,0x79,0xB0,0x34,0xA9,0x33,0x90,0x33,0x9C,0x08,0xE8,0x08,0xAD,0x30,0xAB,0xE4,0xA8,0x31,
+0xAC,0x02,0xA0,0x10,0x24,0x1A,0x9C,0x70,0x81,0x08,0xB2,0x60,0x92,0x0A,0x15,0x09,0x21,0xAA,0x7A,0xA0,0x12,0x8A,0xD2,0x38,0xE8,0x09,0xB9,0x28,0x3A,0x28,0x8D,0x84,
+0x90,0xBA,0x60,0x93,0xC9,0x38,0xB5,0x3E,0x01,0x28,0xB1,0x00,0x3E,0x91,0x81,0x89,0xAB,0x70,0x9B,0xD5,0x28,0x29,0xC9,0x48,0x91,0x91,0x28,0x08,0xC9,0x60,0x89,0x12,
+0xD3,0x4B,0xAB,0x84,0x19,0xD1,0x08,0x31,0xAC,0x00,0x18,0x08,0xE1,0x78,0x98,0x20,0x98,0x83,0x70,0xC8,0x10,0x2A,0x21,0xA9,0xD8,0x24,0x8B,0x81,0x8D,0x01,0x89,0x5B,
+0xB5,0x8B,0x05,0x0E,0x93,0x01,0x8B,0xB8,0x36,0xBB,0x2B,0x04,0x10,0xC3,0x89,0x50,0x41,0xDA,0xA8,0x43,0x11,0xBF,0x53,0x99,0x90,0x92,0x8C,0x31,0xA0,0x10,0xFA,0x19,
+0x21,0x98,0x9B,0x82,0x99,0x27,0xA8,0x1B,0x19,0x62,0x83,0xBB,0x3A,0x27,0xD0,0x1A,0x80,0x18,0x82,0x0B,0xE1,0x19,0x28,0x65,0xD9,0x89,0x09,0x13,0x41,0xB8,0x01,0x0A,
+0xAA,0x29,0x23,0x43,0xFC,0x4A,0xA3,0xDB,0x20,0x90,0x0B,0x89,0x63,0x10,0x82,0xF3,0x8D,0x11,0x10,0x41,0x80,0x99,0x1B,0x08,0x25,0x02,0x9F,0x80,0x08,0x00,0xD8,0x01,
+0x2A,0xA8,0x80,0x20,0xAF,0x02,0xBC,0x91,0x48,0x2B,0xB4,0x29,0x03,0xBB,0x67,0x00,0xB0,0xBA,0x62,0x22,0x00,0xA3,0x9D,0x38,0x01,0xA1,0x8F,0x00,0x01,0xB8,0x6B,0x80,
+0xC1,0x08,0x81,0xC8,0x50,0x00,0xC1,0x8C,0x42,0x80,0x24,0xA9,0x42,0xB0,0x08,0x88,0xB1,0x00,0xEE,0x18,0x80,0x40,0x90,0xCB,0x9A,0xDA,0x31,0xBA,0x5B,0x11,0x81,0xEA,
+0x18,0x9B,0x0A,0xA9,0xB0,0x26,0x11,0x09,0x06,0x8C,0x30,0x95,0x21,0x20,0x90,0x14,0x53,0xB1,0x2A,0xA1,0xCF,0x1A,0x02,0x28,0x89,0x98,0x20,0x21,0xDC,0x8C,0x10,0x43,
+0xF0,0x38,0x9A,0x21,0xB0,0x59,0xDA,0x99,0x99,0xB0,0x18,0x8A,0x10,0x67,0x28,0x01,0x11,0x40,0x80,0x93,0x1E,0x90,0x01,0xB2,0x39,0xD1,0x15,0x9D,0x18,0x38,0xF0,0x19,
+0x91,0x50,0x12,0xC8,0x30,0x01,0xB0,0x99,0x31,0xDD,0x98,0xEB,0xAB,0xBD,0x9A,0x08,0xC0,0x1A,0x89,0x03,0x74,0x02,0x08,0x11,0x20,0x36,0x04,0x8D,0x21,0x90,0xAA,0x11,
+0x92,0x8B,0x9B,0x52,0xA1,0x97,0xAB,0x50,0x22,0xC9,0x08,0x21,0xB8,0xA0,0x39,0x28,0xAB,0xFA,0x08,0x11,0x40,0x85,0xEB,0x08,0x32,0xD9,0x80,0x49,0x03,0xD2,0x0B,0x12,
+0x0B,0xA0,0x8E,0x94,0x28,0x08,0x33,0x37,0x98,0x85,0x1A,0xA1,0x88,0x96,0x69,0x82,0x0A,0x29,0x52,0xB2,0x80,0x9C,0x39,0x09,0x81,0x07,0x30,0xDA,0xA9,0x9A,0x29,0xCA,
+0xEA,0x88,0x9A,0xAC,0x82,0x99,0xAD,0x32,0x08,0xC8,0x11,0xDE,0x98,0x0A,0x43,0x9C,0x81,0x9B,0xD8,0x90,0x78,0x80,0x90,0x00,0x02,0x18,0x92,0xAF,0x01,0x01,0x88,0x85,
+0x18,0x68,0x82,0x11,0x9A,0x09,0x41,0x28,0x32,0x89,0x8C,0x94,0x47,0x00,0x03,0x98,0x20,0x25,0x12,0x10,0x11,0xAB,0x1A,0x40,0x96,0xBF,0xAA,0xA8,0x2B,0x91,0x2B,0xBD,
+0xC8,0xF8,0x0A,0x13,0x9B,0x8B,0x28,0x23,0x47,0x00,0x28,0x54,0x11,0x01,0x61,0x11,0x80,0x9A,0x20,0x11,0xAF,0x80,0x90,0xEA,0x0A,0xA9,0xAC,0xAA,0x08,0xAC,0xC9,0x8C,
+0x9A,0x80,0xA8,0x0B,0x04,0x63,0x82,0x50,0x20,0x32,0x94,0x72,0x23,0x0B,0xC3,0x20,0xBB,0x08,0xBD,0xDA,0x09,0xBC,0x9B,0x8B,0xA8,0xAB,0xC3,0x50,0x53,0x32,0xA0,0x90,
+0x90,0x77,0x03,0x19,0x02,0x12,0x01,0x8C,0x01,0x53,0xA9,0x59,0x08,0x02,0xC0,0x8F,0x88,0x98,0xA8,0x9B,0x19,0xD1,0x2C,0x80,0x04,0x2A,0x84,0x23,0x12,0x01,0xBB,0x7A,
+0x02,0x98,0xF8,0x90,0x84,0x0D,0x09,0xC1,0x8A,0x08,0x35,0x20,0xFA,0x20,0xBC,0x81,0x52,0xC0,0x19,0xA9,0xA8,0x3A,0x02,0xD2,0x7B,0x91,0x38,0x32,0x98,0x12,0xB9,0x03,
+0x4B,0x17,0xAA,0x0E,0x89,0xCB,0x80,0x92,0x1A,0x42,0x18,0x75,0x12,0xC9,0x38,0x27,0x88,0x10,0x88,0x11,0x89,0xDA,0x9A,0xCD,0x9A,0xC8,0x8C,0xB9,0xBC,0x00,0xAC,0xA9,
+0x1A,0xD0,0x80,0x0A,0x54,0x14,0x08,0x30,0x27,0x13,0x01,0xA8,0x38,0x23,0x13,0x49,0x17,0x91,0x8B,0x0B,0x92,0xC4,0x8C,0xAA,0x08,0x6A,0xB8,0x80,0x1C,0x92,0xD8,0x31,
+0x82,0x78,0x10,0x91,0x14,0x20,0x08,0x42,0x22,0x18,0xB2,0xCD,0x82,0x10,0x73,0xA2,0xF9,0x00,0xBB,0xB8,0x58,0xBA,0xE9,0x09,0x88,0x98,0xBB,0x28,0x50,0x98,0xB8,0x0A,
+0x10,0x97,0x0A,0x44,0x23,0xC8,0x0B,0xAB,0x59,0x83,0x8D,0xA0,0xB8,0x9D,0x18,0x07,0x8A,0x9B,0x8A,0x27,0x00,0x38,0x15,0x88,0x30,0x33,0x06,0x21,0x90,0x21,0x49,0xC1,
+0x89,0x15,0x98,0x99,0xAD,0x98,0x9B,0xF0,0xAB,0x19,0xA2,0x3A,0xBE,0xCA,0x88,0x88,0x8F,0xA8,0x32,0x85,0x4B,0x08,0x93,0x41,0x90,0x53,0x35,0x99,0x10,0x41,0x00,0x13,
+0xA9,0x38,0x25,0x81,0xB2,0x1B,0xDB,0x9F,0x90,0x20,0xB0,0x9F,0xDB,0x09,0xA0,0xAB,0x0A,0xF0,0x0A,0x49,0x81,0x9A,0xCB,0x2D,0x01,0x14,0x98,0x90,0x18,0xA1,0x14,0x71,
+0x31,0xC9,0x8A,0x52,0x01,0xAB,0x19,0x86,0x80,0x11,0xBA,0x30,0x4A,0xC1,0x41,0x02,0xE0,0x81,0x0A,0x29,0xE2,0x40,0x11,0x12,0x71,0x80,0x99,0x28,0x23,0x12,0x21,0x95,
+0x89,0x0C,0x8A,0x11,0xC0,0x55,0xAA,0x78,0x80,0xA1,0xA0,0x1A,0x53,0xFA,0x21,0x00,0xAB,0xB8,0x19,0x24,0xCC,0x80,0x0A,0x93,0xE9,0x0A,0x29,0xCC,0x09,0x22,0x34,0x92,
+0xCE,0x9B,0x28,0x00,0x99,0x27,0x89,0xBB,0x82,0xB9,0x2C,0xE8,0x00,0x52,0x98,0x12,0x9E,0x02,0x81,0xA9,0x49,0x12,0xD8,0x89,0x93,0x9B,0x5B,0xB8,0x0A,0x31,0x85,0xCC,
+0x1C,0x82,0x9A,0x71,0x01,0x23,0xB9,0x79,0x83,0x88,0x28,0x11,0x02,0x34,0x15,0xAF,0x88,0x42,0x13,0x08,0x92,0x9B,0xCD,0x18,0x88,0x98,0xB9,0x0D,0x32,0xA8,0x9F,0xA1,
+0x14,0x3A,0x90,0x71,0x84,0xAA,0x9A,0x98,0x53,0xC8,0x60,0x00,0x89,0x02,0x82,0x09,0x31,0x40,0xE0,0x63,0xA2,0xCB,0x3A,0x13,0x08,0x00,0x21,0xCA,0x89,0x0A,0x12,0xFF,
+0x0C,0x44,0x81,0x9B,0x80,0xB8,0x19,0x43,0x90,0x1A,0x32,0xC8,0x18,0x81,0xAF,0xB0,0x18,0x72,0x91,0xDA,0x98,0x0C,0x38,0x43,0xA1,0x8A,0x48,0xA9,0x52,0x31,0xC3,0xD8,
+0x39,0x42,0x12,0x11,0xCC,0x21,0x91,0x4A,0x88,0xA8,0x24,0xFD,0x2A,0x01,0xC2,0x0C,0x21,0x99,0xA9,0xDB,0x19,0x12,0x22,0xEB,0x0B,0x91,0xDB,0x49,0x12,0xAA,0xBA,0xBF,
+0x54,0x90,0x8A,0xAA,0x02,0x30,0x14,0xAC,0x08,0xA1,0x8B,0x65,0x02,0x91,0xAA,0x90,0x01,0x40,0xE9,0x98,0xC8,0x00,0x44,0x91,0xAD,0x10,0x80,0x18,0x25,0x9A,0x09,0xC2,
+0x4A,0x23,0xD0,0x18,0x01,0x70,0x04,0x22,0xA8,0xA8,0x99,0x28,0x57,0x90,0x38,0x26,0x90,0x0B,0x23,0x21,0x36,0x93,0x0B,0x00,0xAA,0x48,0x36,0x01,0xA8,0xAF,0x1A,0x12,
+0xA8,0x9D,0x22,0xFB,0x1C,0x21,0xA2,0xCD,0xA9,0x89,0x22,0x82,0xBD,0x88,0xBA,0x9C,0x11,0x00,0xB8,0xDF,0x08,0x10,0xCB,0x99,0x99,0x88,0x20,0x32,0x98,0x90,0xAB,0xAB,
+0x77,0x16,0x99,0x18,0x02,0x90,0x11,0x34,0x45,0x22,0x10,0x11,0xC1,0x49,0x25,0x88,0x10,0x10,0xB0,0xAD,0x30,0x24,0xB9,0x8F,0x62,0x32,0x81,0x9A,0xA9,0x30,0x32,0x27,
+0x01,0x81,0xBA,0x4A,0x27,0x22,0xA8,0x9B,0x20,0x82,0xCD,0x11,0xBC,0xCC,0x0A,0x11,0x89,0xBA,0xDF,0x09,0xA8,0xBA,0x10,0x89,0x9E,0x00,0x02,0xCB,0xBA,0x99,0x21,0x06,
+0xDA,0x09,0x18,0x13,0x9B,0x28,0x53,0xBB,0x1B,0x07,0x91,0x89,0x10,0x44,0x82,0x11,0xCB,0x9C,0x55,0x21,0x10,0x04,0x99,0x10,0x34,0x22,0x13,0x9A,0x8E,0x51,0x36,0x01,
+0xE8,0xBB,0x29,0x35,0x80,0x19,0xB2,0xAF,0x08,0x02,0x90,0x19,0xAD,0x21,0x26,0x88,0x98,0x09,0x33,0x20,0x83,0x55,0xB8,0xAD,0x38,0x16,0xA0,0x8B,0x31,0x24,0xA2,0xBC,
+0x8C,0x14,0xA9,0x1B,0x14,0x00,0xAA,0xBD,0x43,0xA1,0xCD,0x18,0x22,0xA0,0xAC,0x9C,0x89,0x99,0x22,0x11,0x80,0xFF,0x9F,0x10,0x11,0x99,0x99,0x29,0x21,0x13,0x01,0xE8,
+0x8A,0x31,0x53,0x43,0x53,0xD8,0xAA,0x18,0x43,0x12,0x08,0xA8,0x29,0x03,0xE9,0x88,0x30,0xAA,0x18,0x91,0xDC,0xCD,0xAA,0x79,0x02,0xC9,0x0A,0x02,0x80,0xAA,0x09,0x42,
+0x11,0x42,0x45,0x02,0xCA,0x1B,0x53,0x25,0x02,0x89,0x21,0x90,0x99,0x74,0x83,0xAA,0x1A,0x53,0x21,0xC8,0xBF,0x8A,0x20,0x11,0x10,0x02,0xAC,0xAE,0x19,0x32,0xB0,0xBD,
+0x21,0x42,0x20,0x90,0xFA,0xBB,0x49,0x12,0x13,0x98,0xDC,0x89,0x81,0x9A,0xA9,0x9C,0x11,0x53,0x08,0xB9,0xB9,0x2A,0x6B,0xC8,0x18,0x12,0xCE,0x9B,0x63,0x11,0x88,0x32,
+0x34,0x84,0xCD,0x9D,0x20,0x10,0x00,0x08,0x01,0x12,0xBC,0x38,0x37,0xD0,0x9C,0x30,0x14,0xA9,0xDB,0x09,0x18,0x22,0x31,0x14,0x10,0xCE,0x28,0x43,0x25,0x91,0x9A,0x32,
+0xA1,0x1A,0x27,0x93,0xCB,0x28,0x12,0x80,0xB0,0x9B,0xC0,0x31,0x89,0x02,0xDF,0xA9,0xAD,0x0A,0x33,0xC1,0x29,0x26,0xC0,0x0A,0x11,0x90,0x20,0x27,0x80,0x18,0x11,0xB8,
+0x80,0x44,0x31,0x15,0x08,0x13,0xA9,0xD8,0xCF,0x9A,0x42,0x24,0xCB,0x9C,0x10,0xB0,0x9C,0x52,0x91,0xC0,0xBB,0x51,0x12,0xC8,0x9D,0x08,0x21,0x91,0x19,0x00,0xD9,0xBC,
+0x10,0x46,0xB0,0x9B,0x48,0x82,0x99,0xA1,0x4A,0x94,0x98,0x31,0x31,0xA2,0x9A,0x9D,0x7A,0x06,0x88,0x08,0x32,0xE9,0x09,0x42,0x11,0xA9,0x18,0x91,0x08,0x21,0xAA,0x63,
+0x05,0x00,0xBD,0x28,0x89,0xA2,0xD9,0x9E,0x0A,0x11,0x93,0xBF,0x18,0xB9,0x9B,0x73,0x26,0xA0,0x9C,0x11,0x22,0x01,0x23,0x11,0x32,0x10,0x70,0x23,0x01,0xBE,0x1B,0x36,
+0x16,0xB9,0x0A,0x08,0xB9,0x0C,0x32,0x04,0xBC,0x9A,0x19,0x91,0xCB,0x0B,0x51,0x01,0xCA,0x8D,0x82,0x80,0xCE,0x28,0x16,0xB8,0x19,0x31,0xC8,0xBB,0x88,0x40,0x12,0x11,
+0xFB,0x19,0x01,0x18,0x31,0x01,0x82,0x0B,0x77,0x33,0x98,0x8B,0x00,0x13,0x73,0x17,0x98,0x89,0x81,0x10,0x63,0x02,0xA8,0xAB,0x19,0x46,0x82,0xA8,0xAA,0xB9,0x10,0x80,
+0xEA,0x2A,0xD9,0xCD,0x38,0x33,0xF9,0x9B,0x28,0x80,0x90,0x98,0x02,0x9A,0xDF,0x00,0x10,0x80,0x99,0x89,0x73,0xA2,0xAD,0x18,0x25,0xB0,0x8A,0x62,0x01,0x80,0x10,0x08,
+0xB0,0x80,0x73,0x44,0x91,0xB9,0x8D,0x31,0x02,0xAA,0x21,0xB1,0xDF,0x18,0x22,0xC8,0xCA,0x9A,0xAA,0x41,0x81,0xFB,0x9C,0x89,0x88,0x08,0x21,0xA9,0xCF,0x10,0x12,0xA9,
+0x81,0x98,0xA9,0x67,0x01,0x89,0x10,0x03,0x88,0x30,0x47,0x11,0x99,0x21,0x21,0x82,0x1A,0x35,0x12,0x83,0x80,0x2E,0x41,0x04,0x9A,0x34,0x91,0xCD,0x0A,0x42,0xA1,0xBC,
+0x9A,0x42,0x82,0xC9,0xBA,0xA2,0xAB,0x8C,0x22,0x47,0xF9,0x9C,0x20,0x14,0x9A,0x88,0x01,0x09,0x28,0x24,0x12,0x80,0xA0,0x34,0x47,0x01,0xC9,0x0B,0x63,0x12,0x91,0x31,
+0x82,0xCB,0x48,0x03,0x09,0x31,0xE0,0x0A,0x88,0xB0,0xDF,0x8A,0x09,0x99,0xCA,0x08,0xB0,0xBC,0xAC,0xA9,0x8D,0x82,0x9D,0x28,0x23,0xB0,0xAF,0x58,0x03,0x09,0x19,0x02,
+0x32,0x84,0x72,0x00,0xB0,0x1A,0x35,0x26,0x80,0xCC,0x8A,0x21,0x23,0xAB,0x42,0xA2,0xBE,0x18,0x43,0xD8,0xAC,0xAB,0x31,0x14,0xA8,0x90,0x8A,0x09,0x48,0x83,0x54,0x93,
+0xAE,0x21,0x98,0x39,0xFC,0x73,0x80,0x21,0x81,0x38,0x92,0x3A,0x91,0x8C,0xC2,0x9B,0xAB,0x43,0xFA,0xCB,0x98,0xAB,0xAC,0x99,0xBF,0x1A,0x10,0x01,0x8B,0xB2,0x9F,0x88,
+0x3A,0x17,0x11,0x09,0x19,0x35,0x13,0x10,0x23,0x40,0x16,0x80,0x49,0xA1,0xA8,0x9F,0x41,0x03,0x80,0x9B,0x21,0xD9,0x29,0x23,0x51,0xA2,0x8B,0x33,0x64,0x80,0x9A,0x52,
+0x22,0x11,0x31,0x53,0x90,0xAD,0x51,0x92,0x18,0xCA,0x41,0x88,0x91,0xAD,0x98,0x2A,0x18,0xF9,0x9B,0x28,0xED,0x08,0x18,0xC9,0xBB,0x0A,0xA8,0x63,0x12,0xB8,0x8A,0x71,
+0x02,0xC0,0x9A,0x09,0xA1,0x58,0x27,0x01,0x90,0x0B,0x22,0x48,0xE3,0xAA,0x9C,0x80,0x10,0x68,0xB1,0x90,0x8E,0x40,0x04,0x80,0x89,0x90,0x08,0x42,0x1A,0x82,0x31,0xDD,
+0xBB,0x49,0x15,0x01,0x09,0x31,0xA3,0x21,0xAC,0x2B,0xD1,0x0C,0xA8,0x51,0x23,0x31,0xA9,0x12,0x9E,0xF0,0x2A,0x15,0xCA,0xAB,0x99,0xAA,0x99,0x8D,0x81,0x90,0x80,0x23,
+0xFC,0x2A,0xD0,0x9C,0x31,0xA9,0x83,0xA0,0x78,0x17,0x11,0x18,0x80,0x0B,0x82,0x22,0x33,0x3A,0xFD,0x1D,0x01,0x51,0x02,0x9A,0xA9,0x0B,0xA8,0x10,0x95,0x2B,0x37,0x30,
+0x24,0xB0,0x9E,0x90,0x32,0x08,0x11,0x34,0x42,0xE9,0x19,0x20,0xB0,0xCC,0x1A,0x05,0x9B,0xA9,0x2A,0x22,0xFB,0x8A,0xCB,0x13,0x4B,0x82,0x81,0xD8,0x8D,0x00,0x21,0x28,
+0xB8,0x20,0x91,0x1B,0x47,0xA8,0x9E,0x11,0x02,0x22,0x29,0xF8,0x8A,0x99,0x22,0x22,0xBC,0xBB,0x93,0x8F,0x02,0x23,0x80,0x07,0x8C,0x21,0x20,0xD8,0x81,0x8C,0x56,0x81,
+0x52,0x80,0xA1,0x89,0xA8,0x1C,0xA2,0xAA,0x4B,0x94,0x80,0x0C,0x18,0x14,0xC8,0xAF,0x21,0x91,0x9D,0x84,0x08,0xDB,0xA9,0x89,0x42,0x13,0x91,0xBF,0x98,0xAA,0x88,0x01,
+0x44,0xA1,0x3B,0x37,0x14,0x18,0x01,0x34,0x21,0x06,0x80,0xE9,0x8B,0x73,0x94,0x00,0x99,0x00,0x08,0x02,0xBA,0x88,0x8A,0xDA,0x09,0x09,0xFA,0x20,0xA1,0x1B,0x93,0x63,
+0xEA,0x8A,0x00,0x18,0x81,0xB8,0xAD,0x82,0x1B,0x9A,0xF9,0x8E,0x31,0xF8,0x2B,0x05,0x8A,0x89,0x08,0xA0,0x8B,0x01,0x60,0x84,0x01,0x9C,0x01,0x03,0xCC,0x3A,0x04,0xEA,
+0x19,0x80,0x31,0x83,0x28,0x32,0x17,0xAA,0x12,0x38,0x17,0xA9,0xA9,0x60,0x25,0xB9,0x08,0x18,0xB2,0x73,0x04,0x88,0x01,0xAB,0x81,0xBF,0x39,0x93,0x63,0x43,0x82,0xAC,
+0xB9,0x09,0xA9,0x13,0x99,0xAC,0x72,0x05,0xD9,0xBB,0xAA,0x89,0x30,0x04,0x43,0xAB,0x43,0x92,0xBF,0x98,0x89,0x30,0x24,0x81,0x18,0x04,0xAB,0x09,0x77,0x11,0xB0,0x1A,
+0x82,0x21,0xCB,0x01,0xDA,0x89,0x58,0x80,0xB9,0x10,0xBB,0x74,0x02,0xB8,0x09,0x98,0x99,0xC9,0x0A,0x88,0x99,0x72,0x04,0x52,0x90,0xA8,0x11,0x63,0xA0,0x9A,0xAB,0x15,
+0x8A,0x47,0x02,0x80,0x80,0xAB,0x42,0xA9,0xA9,0xA0,0xDF,0xBD,0x8A,0x80,0x41,0x63,0x02,0x11,0xA8,0x8A,0xAA,0xCB,0xA9,0x8C,0x09,0xA0,0x52,0x05,0x21,0xB8,0x90,0xCF,
+0x99,0x40,0x12,0x80,0x9A,0x08,0x43,0x88,0x81,0xD9,0x18,0xA9,0x8C,0xBA,0x77,0x89,0x00,0x10,0x28,0x02,0x22,0xC1,0x0E,0xB1,0x2B,0x12,0x34,0xB0,0x78,0x90,0xB1,0x2C,
+0x80,0x33,0xE2,0x81,0x1D,0x21,0xC9,0x29,0xB0,0x92,0xCF,0x15,0x12,0xA0,0x88,0x11,0x35,0xB9,0xA8,0xAB,0x49,0x04,0x28,0xA1,0x28,0x9B,0x77,0x04,0x99,0xAB,0x99,0x39,
+0x22,0x06,0x99,0xB9,0x0B,0x18,0x77,0x11,0x80,0x08,0x98,0xA9,0xFB,0x9C,0x19,0x11,0x81,0x19,0xEA,0x71,0x80,0xA9,0x08,0xA9,0xC9,0x0A,0x20,0x53,0x02,0x80,0x4B,0x92,
+0xC0,0xAF,0x10,0xAA,0xB9,0x4A,0x13,0x81,0x28,0x44,0xB1,0xDD,0x8A,0x80,0x51,0x22,0x32,0xA0,0xCC,0xAA,0x10,0x23,0x47,0x12,0x81,0x52,0xB8,0x0B,0xBB,0x41,0x43,0x34,
+0x80,0xAB,0x42,0xA0,0x53,0xBA,0xA0,0x8E,0x38,0x14,0x01,0x88,0xAB,0x80,0xAB,0xBC,0xB1,0xAB,0xBF,0x39,0xBE,0x44,0x81,0x98,0x9B,0x42,0xC9,0xE9,0x8B,0x00,0x10,0x34,
+0xB1,0xAA,0xDE,0x09,0x99,0x81,0xCE,0x09,0x31,0x24,0x21,0x42,0x31,0x17,0xAA,0x9A,0xCA,0xBD,0xBD,0x89,0x43,0x00,0x00,0x33,0x42,0x13,0x22,0x54,0x00,0x08,0x98,0x80,
+0xCF,0x89,0x8A,0x29,0x13,0x81,0x10,0x39,0x77,0x81,0x9A,0xA9,0x1A,0x32,0x83,0x1C,0xB2,0xCD,0x89,0xA1,0x8D,0xAA,0x50,0x82,0x20,0x34,0x47,0x11,0x09,0xC9,0xBA,0x09,
+0x98,0x21,0x33,0x14,0x8A,0xC8,0x50,0x24,0x0A,0x13,0x8A,0x91,0x52,0x24,0xCA,0xCE,0xB9,0x9B,0x00,0x29,0x37,0x12,0x01,0x99,0x51,0x13,0xA0,0xA9,0xAD,0x09,0xB8,0xCC,
+0x19,0x51,0x01,0xA0,0xB8,0x7B,0x17,0xBC,0xA8,0x09,0x01,0x11,0x25,0x9A,0x19,0x90,0xB8,0x1C,0x36,0x90,0x52,0x00,0x08,0xD0,0xAC,0xDA,0x9C,0x11,0x81,0x12,0x12,0x52,
+0x12,0x01,0x20,0x99,0x35,0xC2,0x18,0xAD,0x59,0xCB,0x18,0xC8,0x9B,0x02,0x17,0x98,0x8A,0xD9,0x40,0xA1,0x68,0xB8,0x28,0xC0,0xAB,0x04,0x18,0x21,0x19,0xC4,0x8D,0x31,
+0xA8,0x9C,0x11,0xB0,0xBA,0x9B,0x73,0x13,0x20,0xA2,0x3B,0x25,0xD1,0x1B,0x92,0x49,0xF8,0x0B,0x11,0x38,0x17,0x80,0x18,0xA1,0x0A,0xA8,0x79,0x03,0x18,0x41,0x94,0x9A,
+0x72,0x14,0x81,0x88,0x81,0x0C,0x92,0x0B,0xF9,0x8A,0x01,0x09,0x83,0xAF,0x23,0xB9,0x80,0x18,0xC0,0xEF,0x10,0x98,0x30,0x03,0x88,0x19,0x90,0x62,0xB8,0x80,0xBC,0x1B,
+0x2A,0x17,0x80,0x31,0x99,0x99,0xCD,0x42,0x10,0xA1,0x3D,0x81,0x84,0xAB,0xEA,0x69,0x23,0xB2,0x0B,0x00,0xA9,0x2A,0xC9,0x74,0x91,0xAB,0x20,0x36,0x90,0xAB,0xA0,0x9B,
+0x90,0x99,0x46,0x33,0xD9,0x99,0xB8,0x8C,0x12,0xAB,0xC0,0xEB,0xAB,0x30,0x72,0x24,0x12,0x10,0xA9,0x2A,0xE0,0x9D,0x09,0x01,0xDA,0x89,0x32,0x30,0x14,0x41,0x91,0x78,
+0x92,0x88,0x99,0xEC,0x89,0x12,0x88,0x20,0x54,0x10,0x82,0x31,0xD9,0x0C,0xC2,0x4A,0x83,0xAA,0x89,0x08,0x54,0x81,0xA8,0x9A,0xB3,0x8E,0x51,0xA2,0x19,0x14,0xA8,0xAD,
+0x31,0x92,0x89,0xBF,0x41,0xA8,0x39,0xE1,0x0C,0x93,0x08,0x18,0x03,0x29,0xF8,0x59,0x92,0x99,0x18,0xB9,0x00,0x00,0x01,0x33,0xDD,0xBE,0x15,0xBB,0x19,0x24,0xA9,0x81,
+0xAE,0x80,0x0C,0x02,0x45,0x02,0x9B,0x91,0xBB,0xAA,0x8B,0x08,0x75,0x85,0x18,0x98,0x88,0x9B,0x02,0x71,0x82,0x89,0x9A,0x72,0x14,0x8A,0x91,0x99,0xB8,0xB9,0x4E,0x04,
+0x9A,0x10,0x72,0x02,0x21,0x02,0xD8,0x9B,0xBF,0x18,0x08,0x22,0x08,0x12,0x91,0x09,0x89,0x37,0x0B,0x44,0x99,0x31,0x02,0xFB,0xAD,0x28,0xA5,0x1A,0x93,0x2B,0x84,0x88,
+0xBB,0xBC,0x9C,0x53,0x22,0x44,0x43,0x82,0x89,0x89,0xC9,0xBD,0xBB,0xA1,0x3B,0x95,0x49,0x03,0x42,0xD9,0x28,0x13,0xDB,0x88,0xB9,0x68,0x13,0xB9,0xCA,0x09,0x10,0x31,
+0x27,0x89,0x93,0xBF,0x22,0x08,0x98,0xCB,0x10,0xD0,0x38,0x81,0x01,0x0B,0x43,0xCE,0x40,0x12,0xB1,0x0C,0xC0,0x5A,0x94,0x09,0xA0,0x19,0x81,0xFA,0x8F,0x81,0x08,0x12,
+0x22,0xBA,0x40,0xB1,0xA8,0x9D,0x33,0x43,0xD9,0xBC,0x39,0x24,0x82,0x9C,0x90,0x18,0x11,0xAB,0x92,0x09,0xFF,0x09,0x28,0x13,0x51,0x12,0x08,0xA0,0xCF,0x28,0x23,0x23,
+0xD9,0x8B,0xAA,0xBA,0x71,0x12,0x32,0x04,0x9A,0xCA,0xAB,0x1B,0xB4,0x8F,0x46,0x02,0x18,0xC9,0x19,0xB8,0xAA,0x8C,0x03,0x8D,0x92,0x19,0x36,0x21,0x32,0x38,0x05,0x89,
+0xAA,0xAA,0x29,0x82,0x39,0xA7,0xBE,0x8A,0x38,0x13,0x91,0x5A,0x35,0x33,0x25,0x89,0x80,0x99,0xCD,0xCA,0x8B,0x9A,0xA2,0x4C,0x17,0x99,0x00,0x10,0x23,0x11,0xB9,0x9A,
+0xA8,0x8F,0x26,0x20,0x40,0x25,0x00,0xB9,0xEC,0x8B,0x88,0x08,0x08,0xA0,0x8C,0x88,0x00,0x82,0xCA,0xBC,0x00,0x8E,0x22,0x91,0x08,0x20,0x32,0x77,0x92,0xAC,0xBB,0xBB,
+0xAD,0x89,0x80,0xCB,0x09,0x92,0x7B,0x26,0x91,0xA9,0xBB,0x30,0x24,0x33,0xB0,0xAD,0x8B,0x13,0x98,0x73,0x02,0x53,0x91,0x9A,0x89,0x88,0x9A,0x63,0x44,0x32,0x88,0x22,
+0x32,0x77,0x02,0x91,0x19,0x89,0x33,0xA1,0xAA,0x89,0xF8,0x8C,0xA1,0x53,0x01,0x11,0x31,0x37,0xAA,0x09,0x11,0x99,0x88,0xB0,0x79,0xB0,0x01,0xAE,0xB9,0x8D,0x10,0xA1,
+0xA8,0x5B,0xB8,0x13,0x80,0x66,0xB1,0x9E,0x88,0x98,0x38,0x86,0x8A,0x01,0xA0,0x80,0xAC,0x30,0xA0,0xAF,0xA8,0x9D,0x18,0x21,0x37,0x12,0x00,0xA8,0x89,0xA0,0xCC,0x88,
+0x31,0x76,0x92,0x80,0xAA,0x8B,0xCA,0x88,0x8A,0x58,0x02,0x23,0xFB,0x38,0x12,0x03,0x10,0xB0,0x3A,0xFB,0x0F,0x80,0x28,0x94,0x0A,0x01,0xBA,0x01,0xCF,0x18,0x20,0x88,
+0x82,0x39,0xB2,0x4B,0x85,0x42,0xFA,0xAA,0x40,0x01,0x80,0xA8,0x2A,0xDC,0x10,0x21,0x81,0xDB,0x8E,0x82,0x0A,0x14,0x2B,0xC2,0x08,0x0A,0x25,0x00,0x88,0xAE,0x10,0x10,
+0x09,0x14,0x39,0x91,0x85,0x6B,0xA1,0x09,0x24,0xEF,0x08,0x80,0x22,0x80,0x20,0x24,0x29,0xD1,0x9D,0x18,0x90,0x01,0x89,0x81,0x61,0x81,0x38,0x37,0x80,0xCA,0x9C,0x21,
+0x23,0xA9,0x88,0x02,0x74,0x93,0xBC,0x89,0x20,0x10,0xE0,0x19,0xA9,0x12,0x30,0x67,0x01,0xB9,0x9D,0x11,0x89,0x12,0xB9,0x22,0x9A,0x52,0x90,0x8A,0x88,0x49,0xC8,0xA1,
+0xAC,0xD0,0x3A,0xE0,0x08,0x28,0xA1,0x9F,0x03,0x1B,0x99,0xFB,0x9F,0x01,0x11,0x80,0x89,0x10,0x14,0xDD,0x99,0x28,0x16,0xAA,0x09,0x22,0x80,0xB9,0x9A,0x89,0x71,0x83,
+0x30,0x90,0x73,0xB8,0x39,0xA2,0x8C,0xE8,0x18,0x09,0x25,0xD9,0x30,0x01,0x43,0x91,0x51,0x21,0x98,0xA0,0x9A,0x2D,0xA5,0xBF,0x10,0x91,0x00,0x23,0x33,0x28,0x03,0x73,
+0x94,0x00,0xAA,0x02,0xFB,0x9E,0x48,0x04,0x98,0xA9,0x00,0x09,0x28,0x34,0xBA,0xBF,0x09,0x21,0x10,0x11,0xA1,0xAC,0x75,0x02,0x01,0xA8,0xCC,0x99,0x00,0xA9,0x08,0x99,
+0xD1,0x9D,0x43,0x01,0x00,0x48,0x95,0xBB,0x18,0x32,0x14,0xBA,0x90,0x28,0xC9,0x74,0x22,0x21,0xF8,0xAF,0x18,0x10,0x01,0x30,0x82,0x08,0xD8,0x3A,0x12,0x35,0xA8,0xCB,
+0xDB,0x3A,0x21,0x05,0x09,0x81,0x99,0xC9,0x3A,0x90,0xA8,0x9D,0x0B,0x35,0x8B,0x56,0x90,0x10,0x90,0xCD,0x89,0xCA,0x9B,0x28,0x14,0x88,0xB1,0x9B,0x73,0x82,0x99,0x8B,
+0xB9,0x09,0x36,0xF9,0x8B,0x18,0x01,0x52,0x32,0x03,0x9B,0x14,0x9B,0xEA,0x99,0x20,0x29,0x04,0x46,0x11,0x98,0xB9,0x50,0x92,0x63,0x99,0x80,0xAA,0x09,0xC0,0x60,0x12,
+0x22,0x88,0x33,0x99,0xC9,0xA1,0x7A,0x04,0xA9,0x89,0x0A,0xCA,0x3A,0x67,0x12,0x90,0x0A,0x1A,0xF1,0x0A,0x80,0x0B,0x03,0x39,0xBA,0x29,0x47,0x54,0x80,0x80,0x9B,0xB0,
+0x9C,0x99,0xA8,0x8C,0x91,0x31,0x72,0x25,0xA8,0x9D,0xA8,0x9B,0x22,0x33,0x23,0xB9,0xEB,0x8A,0xB0,0x0D,0x98,0xA8,0x59,0x90,0x9A,0xEB,0x0A,0x88,0x85,0x09,0xA1,0x28,
+0xFF,0x20,0x11,0xA0,0x9C,0x0B,0x90,0x36,0xA1,0x8B,0x19,0x93,0x98,0x0F,0x14,0x81,0x41,0x91,0x18,0x69,0x07,0xBA,0x09,0xAB,0x35,0xEA,0x9A,0x20,0x24,0x01,0x89,0x21,
+0x10,0x04,0x18,0x22,0xFB,0x19,0xAA,0xB1,0xEA,0xAF,0x30,0x88,0x65,0x82,0x08,0xA9,0x8A,0x89,0x10,0x33,0x22,0x81,0xDF,0x10,0x8A,0x82,0x19,0x21,0xA8,0x39,0xD9,0x19,
+0x41,0x67,0x10,0x21,0xC9,0xBD,0x18,0x00,0x00,0x01,0x89,0x88,0xC9,0xCD,0x1A,0x00,0x29,0x36,0x01,0x41,0x02,0xA9,0x90,0x8C,0x94,0x8D,0x80,0x80,0xBB,0xAA,0xB0,0x2F,
+0x41,0x07,0x99,0x98,0x20,0x10,0xA9,0x43,0xB1,0x18,0x89,0x27,0xDD,0x09,0x80,0x18,0x21,0xDA,0x99,0x99,0xA8,0x2A,0x37,0x53,0x42,0x82,0x88,0x9B,0xDE,0x9C,0x11,0x20,
+0x04,0x89,0x18,0x98,0x22,0xA8,0x41,0x81,0xA9,0x8D,0x32,0x47,0x01,0x11,0x98,0x99,0xA9,0x90,0xDF,0x09,0x81,0x39,0x86,0x51,0x11,0x80,0xCA,0x99,0x9C,0x91,0x75,0x80,
+0x90,0x8A,0xA9,0x80,0x19,0x03,0xED,0x9B,0x11,0x08,0x51,0x82,0x30,0x00,0x44,0x14,0x9B,0x00,0xBD,0x20,0x82,0x90,0xBA,0xBE,0xCB,0xAA,0x0B,0x25,0xBA,0x74,0x23,0x11,
+0x08,0x08,0xCA,0x9C,0x88,0xC9,0x8E,0x31,0x23,0x01,0x89,0xF0,0x8B,0x98,0x40,0x34,0x83,0x10,0x90,0xBF,0x08,0xA8,0x9E,0x11,0x32,0x01,0xA8,0x98,0x8F,0x13,0x49,0xB2,
+0xCA,0xA8,0xBC,0x30,0x22,0x21,0xF1,0x1C,0x04,0x9A,0x33,0x9B,0xF3,0x8C,0x00,0x44,0x01,0xBA,0x43,0x00,0x23,0x32,0x0A,0xF8,0x51,0xA8,0xCC,0xB9,0x20,0x9A,0x35,0x22,
+0x47,0xA8,0x89,0x90,0xC8,0xAC,0xAB,0x45,0x22,0x90,0xAA,0xA9,0x32,0x38,0x33,0xA0,0xBB,0xAB,0x10,0x47,0xAB,0xA1,0xF9,0x0E,0x89,0x01,0x92,0x49,0x89,0x27,0xA8,0x2B,
+0x91,0x12,0xE9,0x2A,0x91,0xA1,0x89,0x79,0xC2,0x28,0x08,0x98,0x40,0x08,0x15,0x19,0xC9,0x99,0x20,0xC8,0x72,0x90,0xDA,0x38,0x46,0x00,0x91,0x18,0xA9,0x98,0x98,0x18,
+0xEF,0x19,0x80,0x2A,0x06,0x31,0x22,0x01,0x9A,0xF8,0x9D,0x21,0x04,0xA8,0x8E,0x80,0x20,0x90,0x09,0x83,0x1C,0x02,0x29,0x17,0x8A,0x1C,0x93,0x8A,0x8C,0x00,0x81,0x36,
+0x0A,0xCF,0x20,0x91,0xAC,0x88,0x32,0x36,0xAA,0x39,0x85,0x08,0x08,0x11,0xFA,0x8C,0x98,0x63,0x91,0x89,0x20,0xB8,0x8B,0xA0,0x39,0x94,0xBE,0x8A,0x02,0x12,0xBA,0xCF,
+0x01,0x33,0x9B,0x20,0xC8,0x09,0x57,0x9E,0x00,0x80,0x71,0xD1,0x0A,0x22,0x81,0x9A,0x00,0x82,0x89,0x20,0xA2,0xA0,0x0E,0x25,0x18,0x02,0xDA,0x49,0x33,0xA2,0x0C,0x90,
+0x39,0x26,0x98,0xBA,0xAF,0x21,0x32,0x52,0xF8,0x9A,0x10,0x21,0xB8,0x88,0x73,0x01,0xB8,0x9B,0x30,0x20,0xB3,0xBC,0x8A,0x04,0x0C,0x11,0x17,0x9A,0x62,0x12,0x99,0xAA,
+0x8A,0xAD,0x77,0x30,0xB9,0xDC,0x18,0x00,0x09,0x31,0x03,0x09,0x29,0x92,0x40,0xEA,0x8A,0xA0,0xBB,0xAD,0x89,0x42,0x84,0x48,0x10,0x82,0x98,0xA1,0x9F,0x20,0xA8,0x99,
+0x29,0xA4,0x8A,0x20,0x25,0x01,0xAA,0x8A,0x32,0xDF,0xA8,0x0C,0x11,0x91,0x91,0x7B,0x54,0x93,0xB9,0x9C,0x28,0xB1,0xAE,0x00,0x11,0x53,0x91,0x9C,0x00,0x19,0x93,0x28,
+0x00,0x98,0x85,0x0A,0xBF,0x53,0x27,0x22,0x9B,0xFB,0x0B,0x81,0x10,0x21,0x20,0x34,0x36,0x92,0xEB,0xAC,0x20,0x04,0x99,0x00,0x18,0x08,0x12,0xB2,0x1B,0x1C,0xD0,0xCC,
+0x18,0x12,0x30,0x73,0xA0,0xCB,0x0A,0x00,0x0A,0x02,0x99,0x20,0x61,0xD3,0x1C,0x01,0x00,0xFA,0x19,0x22,0xC8,0xAD,0x18,0x24,0xA9,0x29,0x83,0x49,0xA2,0x0A,0xB1,0x70,
+0x15,0x18,0xF1,0x89,0x28,0x02,0x9B,0xB8,0x70,0x22,0x02,0xCA,0x8B,0x99,0x90,0x80,0x73,0x86,0xA9,0x1A,0xA2,0xA9,0x28,0xE8,0x21,0x8A,0xA8,0x93,0x30,0x72,0x84,0xB9,
+0xC0,0x5A,0x14,0x80,0xD9,0x18,0x89,0x16,0x9A,0x01,0x81,0x99,0x00,0x56,0xB0,0x9D,0x80,0x00,0x19,0xA9,0x9B,0x62,0x04,0xA8,0x9B,0x8A,0x13,0x73,0xA3,0x59,0xB3,0x0E,
+0x98,0x11,0x02,0xBD,0x61,0xA0,0x19,0x05,0xCA,0xAA,0x19,0x21,0x04,0x8A,0x24,0x10,0xDB,0x99,0x99,0xAA,0x47,0x24,0xA9,0xAB,0x89,0x90,0x0E,0x31,0xA1,0x80,0x18,0x34,
+0x41,0xFA,0x0C,0x11,0xAA,0x10,0x38,0x25,0x91,0xBB,0x51,0xA8,0xCD,0x29,0x27,0x80,0x88,0x08,0x91,0x89,0x32,0xAA,0xA1,0xAE,0x72,0xA0,0x41,0x81,0x2A,0xF8,0x19,0x12,
+0x11,0x88,0x00,0xB0,0xFA,0x1B,0x10,0x13,0x80,0xDB,0x60,0x02,0x8A,0x32,0xF3,0x1B,0x03,0xFC,0x9B,0x00,0x10,0x27,0x99,0x9A,0x98,0x32,0x20,0x23,0xA9,0x10,0x84,0xCF,
+0x18,0xA8,0xBA,0x10,0x67,0x91,0x89,0x09,0x88,0x08,0xA9,0x59,0x23,0x90,0xAC,0x88,0x9A,0x38,0x14,0x82,0x23,0x2D,0xF0,0xCF,0x08,0x18,0x01,0x80,0x20,0x35,0x91,0x98,
+0x18,0x98,0x90,0x8B,0xDF,0x08,0x10,0x73,0x82,0x80,0x30,0x11,0xEA,0xAB,0x89,0x73,0x01,0x12,0xBA,0xBD,0x30,0x35,0xA1,0x3B,0x24,0x81,0xC8,0x1C,0x21,0x91,0xCC,0x2A,
+0x03,0x08,0xCC,0x1A,0x96,0x0D,0x33,0xB1,0x9C,0x9B,0x53,0x34,0x11,0x90,0xEC,0xAC,0x19,0x04,0x9B,0x12,0x00,0x01,0x20,0xE9,0x10,0xCA,0xA9,0x20,0x14,0x30,0x25,0xDA,
+0x89,0x2A,0x35,0xA1,0x9C,0x80,0x01,0xBE,0x42,0x03,0xB9,0x20,0x8B,0xC8,0x88,0x98,0x70,0x84,0x9A,0xAB,0x24,0xA0,0x22,0x71,0x83,0x8A,0xA1,0xBF,0x11,0x9B,0xE0,0x9C,
+0x32,0x93,0x9A,0x0A,0x31,0x47,0xA9,0x28,0xEB,0x88,0x18,0xA0,0x78,0xB2,0x19,0x13,0x88,0x26,0xBA,0x01,0x00,0x32,0xA9,0x92,0x58,0xF9,0x4A,0x24,0x81,0xCC,0x18,0x91,
+0x73,0x12,0x08,0x22,0xA3,0x9D,0xC8,0x8B,0x21,0x02,0x65,0x92,0xAC,0x80,0x90,0x41,0x22,0x91,0x0A,0xD9,0xAD,0x19,0x21,0xA8,0x99,0x89,0xDC,0x8B,0x10,0x77,0x81,0xA9,
+0x9B,0x31,0xFA,0x1A,0x98,0x10,0xB8,0x38,0x13,0x32,0x98,0xAE,0x41,0x23,0xCD,0x0A,0x01,0x11,0x31,0x02,0xED,0xAB,0x09,0x90,0xBB,0x21,0x37,0x00,0x61,0xB0,0x09,0xA1,
+0x09,0x0D,0x95,0x39,0x24,0xAD,0x08,0xA0,0x50,0x92,0x0A,0x00,0xA0,0x48,0x41,0x25,0xA8,0xAB,0xA2,0x9D,0xB9,0x78,0x16,0x00,0x11,0x89,0xDA,0xAC,0x31,0x80,0x22,0x43,
+0x80,0xB9,0xBB,0x39,0x39,0x27,0x5A,0x17,0xA9,0x9B,0xAB,0x23,0x24,0x24,0x89,0x05,0x18,0xB8,0x9E,0x10,0xA0,0xA9,0x38,0x90,0x26,0xA0,0x9B,0x31,0x37,0x90,0x89,0x20,
+0xF0,0xBC,0xAC,0x31,0x26,0xC0,0xAB,0x18,0x21,0x00,0x04,0x63,0xB0,0xBE,0x28,0x82,0xA8,0x8A,0x24,0x99,0x81,0x9C,0x81,0x38,0x95,0x1E,0x83,0xBA,0x18,0x23,0xA1,0x9F,
+0x14,0x98,0x2B,0x14,0x30,0x82,0x89,0xFF,0x8D,0x80,0x20,0x32,0xB0,0x0B,0x73,0xA1,0x8B,0x33,0x1A,0x15,0xC0,0xAE,0x98,0x8A,0x31,0x43,0x80,0xBB,0x30,0x04,0x30,0x81,
+0xDA,0x20,0xAA,0xE2,0x0C,0x11,0x13,0xF8,0x8B,0x11,0x23,0x00,0xD1,0xAE,0x18,0x15,0x21,0xB8,0x28,0x14,0x21,0xA8,0xBD,0x20,0xC9,0xAC,0xBA,0x2C,0x57,0x81,0x99,0xBA,
+0x50,0x83,0x89,0x89,0x30,0x05,0x8A,0x01,0xB0,0xBE,0x8B,0x11,0x81,0x44,0x50,0x83,0x18,0x08,0x01,0xD9,0xCC,0x8B,0x45,0xA2,0x8A,0xCC,0x09,0x00,0x73,0x11,0x33,0x11,
+0xC0,0x19,0xCE,0x30,0x32,0xFA,0x0A,0x01,0x9A,0x10,0xA8,0x00,0x18,0x27,0x80,0xB8,0x9D,0x08,0xD9,0x8C,0xA8,0x38,0x36,0x82,0x19,0x22,0x80,0xCB,0x9B,0x44,0x02,0xDB,
+0xBB,0xB9,0x29,0x54,0x15,0x80,0x08,0xC9,0x8A,0x22,0x02,0xC1,0x0D,0x33,0x03,0x30,0x33,0xDA,0xA9,0xEC,0x28,0x90,0xBD,0x72,0x02,0xA8,0x0B,0x94,0x18,0x23,0xA0,0x0A,
+0x27,0x18,0xFA,0x19,0xA9,0x9A,0x22,0x35,0x04,0x9A,0x52,0x98,0x80,0x09,0xDA,0xBC,0xBC,0x09,0x40,0x03,0x72,0x81,0xA8,0x20,0x84,0x89,0x9B,0xA1,0x98,0x89,0x70,0x17,
+0xA1,0x09,0xA0,0xEF,0x18,0x01,0x08,0x01,0x00,0x32,0x12,0x9A,0xEB,0xEB,0x9B,0x88,0x80,0x30,0x25,0x43,0xA1,0x0B,0x05,0x21,0x29,0x04,0xD9,0xDF,0x99,0x08,0x12,0x33,
+0x13,0x98,0xD9,0x28,0x23,0xA1,0x28,0xFA,0x0C,0x42,0x91,0x21,0xFA,0x29,0x13,0x08,0x98,0x99,0xC0,0xBE,0xBA,0x72,0x82,0x21,0x90,0x1B,0x44,0xB0,0x8B,0x99,0x53,0xB1,
+0xBD,0x38,0x26,0x99,0x01,0xAB,0xA9,0xFA,0x0B,0x44,0x01,0x33,0x01,0x90,0x9A,0x88,0xA1,0xEF,0x18,0x00,0x42,0xA3,0xAB,0xB9,0xBB,0x2A,0x57,0x32,0x22,0xB3,0xAF,0xBB,
+0x29,0x02,0x88,0x12,0x1A,0x16,0xB8,0x8C,0xA8,0x08,0xAB,0x12,0x1D,0x35,0xD1,0xAA,0x18,0xCA,0x11,0x98,0x71,0x15,0x90,0xEB,0x9B,0x99,0x31,0x25,0xA8,0x98,0x0C,0x14,
+0x80,0x61,0x93,0xCD,0x8A,0x80,0x63,0x91,0x9A,0x01,0x88,0x9A,0x61,0xA8,0x08,0x32,0x44,0x81,0x31,0x25,0xB0,0xEF,0x9A,0x10,0x98,0x31,0x26,0x01,0x90,0xBC,0x8A,0x32,
+0x12,0xA1,0xBC,0x9B,0x54,0x01,0x81,0x21,0xC9,0x38,0xE9,0x29,0x14,0x02,0x00,0x78,0xA2,0x9E,0xA0,0x29,0x53,0xA0,0xBA,0x0A,0x02,0x98,0x71,0x83,0xBB,0x35,0xA0,0xAF,
+0x00,0x10,0x90,0x41,0xA1,0xA9,0x2B,0xE9,0x09,0x72,0x34,0x88,0x89,0x98,0xBC,0x9B,0x9A,0x18,0x53,0x33,0x37,0x80,0xCA,0xCB,0x9A,0x98,0x9B,0x21,0x34,0x63,0x04,0x10,
+0x18,0xB8,0xDD,0x9A,0xAA,0x28,0x03,0x32,0x30,0x84,0x19,0xF8,0xBD,0x19,0x13,0x32,0x02,0x80,0xB8,0x0E,0x80,0xB8,0x0E,0x05,0x31,0xD0,0xBB,0x31,0x91,0x1B,0x49,0xE3,
+0x9C,0x33,0x11,0x45,0x90,0x99,0xAB,0x20,0x11,0xFB,0x28,0x72,0x01,0xC9,0x29,0x01,0x81,0xB9,0x19,0x02,0x28,0x11,0x27,0xCA,0x70,0x82,0xA0,0x9D,0x00,0x82,0x01,0x99,
+0xAB,0x50,0x57,0x11,0x90,0xCA,0x99,0x89,0x10,0xE8,0x09,0x54,0x01,0x01,0x09,0x24,0x91,0xEA,0xBD,0x0A,0x54,0x01,0xB8,0x8A,0x21,0xB8,0x08,0xB8,0x51,0x42,0x91,0xCD,
+0xAA,0x12,0x09,0x22,0x31,0x05,0xFC,0x89,0x9A,0x48,0x93,0x38,0x15,0xCA,0x89,0x90,0x20,0x13,0x98,0x0D,0x16,0xBB,0x18,0xB1,0x0B,0x14,0xA0,0xAC,0x45,0x02,0xA8,0x8A,
+0xCA,0x68,0x91,0x09,0xA1,0xAF,0x88,0xB0,0x3B,0x14,0x63,0x81,0x9C,0xB9,0x9A,0x57,0x01,0x01,0xDA,0x89,0x10,0x22,0x01,0x18,0x99,0x80,0xCB,0x30,0xA0,0xBA,0xCE,0x9A,
+0x19,0x27,0x52,0x23,0x91,0xDF,0x99,0x18,0x23,0x14,0x11,0x80,0x08,0xAC,0x98,0xA8,0xBD,0xAC,0x72,0x32,0x33,0x80,0x99,0x9A,0x89,0xD9,0xAD,0x10,0x42,0x32,0x22,0x98,
+0xDB,0x8A,0x80,0xC9,0xAC,0x99,0x89,0x30,0x44,0x24,0x43,0xF9,0xAC,0x41,0x23,0xB9,0x2A,0x02,0x89,0xBC,0xA8,0x9D,0xDA,0x59,0x82,0x8A,0x21,0x03,0xA8,0x0B,0x03,0x05,
+0x0C,0x73,0xA1,0xAF,0x09,0x32,0x03,0xFB,0x9C,0x22,0x03,0x21,0x23,0xE0,0x9B,0x00,0x98,0x09,0x99,0x22,0x22,0xE9,0x49,0x46,0x83,0x90,0xBB,0xCD,0x88,0x30,0xB2,0xAF,
+0x89,0x88,0x40,0x25,0x22,0x80,0x89,0x98,0x00,0xED,0x9B,0x33,0x32,0x13,0x89,0x10,0x4A,0x57,0x98,0xBB,0x9C,0x98,0x9A,0x49,0x26,0x98,0x29,0x31,0x02,0xEB,0x28,0xB1,
+0x8B,0x18,0x47,0x14,0xB9,0x8A,0x10,0x90,0xCA,0xBC,0x8C,0x20,0x46,0x11,0x02,0xA8,0x9C,0x03,0xCC,0x89,0x52,0x22,0x91,0x08,0xBB,0x2B,0x07,0xCB,0x89,0x10,0x01,0x9C,
+0x99,0x18,0x94,0x1A,0x67,0x12,0x10,0xFA,0x8C,0x11,0x12,0x81,0xBB,0x28,0x80,0x91,0xFF,0x1A,0x31,0x10,0x00,0x88,0x88,0x81,0xDB,0x9C,0x30,0x33,0x08,0x14,0x28,0x42,
+0x01,0xA1,0xEF,0x89,0xBA,0x9B,0x09,0x47,0x82,0x10,0x12,0xAB,0x99,0xC9,0x8B,0xB9,0x8A,0x01,0xAD,0x67,0x12,0x89,0x19,0xB8,0x0A,0x00,0x82,0x88,0x09,0xD9,0x28,0x37,
+0x91,0x18,0xA0,0xCA,0x30,0x33,0x05,0xB8,0xAC,0xB1,0x1C,0x54,0x12,0xB9,0x69,0x82,0x8A,0x22,0x10,0xD0,0x8D,0x11,0x08,0x21,0x24,0x13,0x90,0xCF,0xA9,0xBB,0x74,0x04,
+0x01,0x11,0x01,0xDD,0x9B,0x20,0x99,0x19,0x24,0xE9,0x9C,0x30,0x31,0x24,0x02,0xA0,0x31,0xFC,0x9C,0x89,0x01,0x00,0x30,0x93,0x8C,0x10,0x36,0xD8,0xAC,0x9B,0x30,0x25,
+0x23,0xA0,0xCC,0x1A,0x01,0x12,0x21,0xDC,0xAA,0x8C,0x02,0x32,0xB1,0xCB,0x73,0x83,0x51,0x91,0x99,0x8A,0x02,0xEC,0x8B,0x44,0x01,0xBA,0x9B,0x08,0x34,0x01,0x43,0x89,
+0x13,0x81,0x90,0xC9,0x9B,0x99,0x9C,0x54,0x44,0x80,0xDB,0x19,0x90,0xAA,0x72,0x91,0xBC,0x9A,0x90,0x73,0x03,0x21,0x80,0x38,0x83,0xFB,0x8B,0x32,0x92,0x9C,0x28,0xB8,
+0xA8,0x08,0x79,0x47,0x92,0xDA,0x9C,0x31,0x13,0x80,0xDB,0x19,0x01,0x55,0x91,0x88,0x99,0xBA,0xBF,0x19,0x82,0x2A,0x82,0x10,0x75,0x13,0x02,0xD8,0xAD,0x8A,0x18,0x12,
+0x89,0xC9,0x49,0x13,0x10,0xA1,0x9D,0x40,0x82,0x18,0xBA,0xCD,0x1B,0x34,0x33,0xA2,0xBD,0x98,0xBB,0x41,0x26,0x21,0xC8,0xAD,0x18,0x12,0xA9,0x08,0xA9,0x70,0x17,0x98,
+0x09,0x12,0xE8,0x0A,0x90,0x1A,0x31,0x16,0x18,0x02,0xAC,0xB9,0x9A,0xAD,0x88,0x72,0x13,0x01,0x00,0xA0,0x9D,0x01,0xCB,0xBC,0x72,0x04,0x88,0x09,0x98,0xAB,0x41,0x13,
+0x88,0xA1,0x9C,0x30,0x67,0xA9,0x89,0x10,0x45,0x90,0xBB,0x0A,0x82,0x30,0x15,0xA9,0xBE,0x10,0x43,0x31,0x24,0x02,0xDA,0x9C,0x43,0xE8,0x9C,0x0A,0x08,0x01,0x43,0x81,
+0x90,0x09,0x24,0x92,0x9F,0x88,0x31,0xC0,0xAC,0x88,0xA9,0x80,0x00,0x50,0x24,0x12,0x88,0x88,0xDD,0x09,0x00,0x92,0xBD,0x42,0x42,0x22,0x89,0xFA,0xCB,0x08,0x98,0x38,
+0x34,0x03,0x09,0x29,0xC4,0x0C,0x01,0x90,0x62,0x16,0xD9,0xBB,0x28,0x35,0x90,0x0A,0x81,0x91,0xCB,0x2A,0x91,0xFB,0x09,0x63,0x14,0x99,0x10,0x21,0x13,0xB9,0x9D,0xFB,
+0x9E,0x18,0x21,0x12,0x01,0xBA,0x10,0xB9,0x59,0x14,0x11,0x01,0x9A,0xAC,0x09,0x80,0x32,0x16,0xCB,0x0B,0x35,0xC0,0x9B,0xAA,0x89,0x26,0x35,0xA0,0x9C,0x28,0x24,0x98,
+0xA0,0xFB,0xBC,0x29,0x36,0x24,0x81,0xAA,0x28,0x80,0x80,0xDA,0x09,0x03,0x98,0x78,0xB1,0x88,0x90,0xEA,0xAD,0x72,0x25,0x82,0xBA,0x9C,0xBA,0x9A,0x32,0x42,0x24,0xC9,
+0x38,0x35,0x82,0xCB,0x9D,0x08,0x90,0x8B,0x00,0x10,0x21,0x53,0x81,0xE8,0x9A,0x98,0x18,0x14,0xB1,0x29,0x80,0xC8,0x0C,0x43,0x16,0x98,0x38,0xA3,0xDF,0x99,0x10,0x22,
+0x82,0x89,0x11,0xAB,0xDD,0x08,0x12,0x91,0x20,0xD2,0x1B,0x03,0xBB,0x70,0x17,0x9C,0x20,0x13,0xFA,0x89,0x32,0x01,0x00,0x88,0xBB,0xA9,0xCC,0x09,0x80,0x59,0x27,0x11,
+0x10,0x12,0x21,0xD9,0x28,0xEC,0x09,0x00,0xAA,0x80,0xD8,0x2B,0x25,0x81,0x8A,0x30,0x34,0x47,0xA0,0xAA,0x9A,0x89,0x80,0x01,0xBA,0xFB,0x0B,0x56,0x81,0x8A,0x12,0x31,
+0x92,0xEF,0xAA,0x30,0x12,0x90,0x09,0x52,0x01,0x11,0xC9,0x0A,0x03,0xAA,0x42,0x81,0xDD,0x9A,0x2B,0x44,0x82,0xEB,0x20,0x35,0x02,0x8A,0x88,0x98,0xCA,0x18,0x90,0xBB,
+0x1B,0xA0,0x62,0x27,0x90,0xAB,0x01,0xA9,0x70,0x33,0x93,0xF9,0xCD,0x29,0x01,0x08,0x24,0x11,0x31,0xD8,0x9C,0x92,0xCD,0x08,0x22,0x21,0x24,0xB8,0x9B,0x11,0x8A,0xA1,
+0xCF,0x00,0x28,0x15,0x90,0x33,0xC8,0xBC,0x61,0x13,0xB9,0x9A,0x9B,0x0B,0x53,0x84,0xA8,0xAF,0x20,0x34,0xB0,0x09,0x12,0xCA,0x8C,0x45,0x81,0x99,0xBA,0xAD,0x08,0x32,
+0x44,0x98,0x11,0xC9,0x9B,0x81,0xC0,0x1D,0x05,0x9C,0x00,0x98,0x28,0xA1,0x8B,0x76,0x12,0xB9,0xBE,0x09,0x12,0x8A,0x88,0x54,0x23,0xA9,0x38,0xA2,0xBC,0xDA,0x9B,0x18,
+0x56,0x12,0x11,0x80,0x99,0xA9,0x8D,0x90,0x98,0xAC,0x28,0x33,0x22,0x31,0x77,0x82,0xAA,0xCA,0x09,0x32,0xA0,0x2A,0x82,0xCD,0x18,0x82,0x81,0x43,0x00,0x12,0x52,0xF9,
+0x8B,0x52,0x82,0xAC,0xBB,0x61,0x36,0x91,0xBA,0x8A,0xAB,0x19,0x33,0x61,0x13,0x98,0x08,0x18,0x62,0xE8,0xAD,0x20,0x63,0x02,0x99,0x10,0xC8,0xCC,0x9A,0x00,0x53,0x12,
+0x08,0x81,0xA9,0xAB,0x18,0x32,0x03,0x0A,0x33,0xC3,0xFF,0xAD,0x08,0x10,0x80,0x32,0x33,0x02,0x8A,0xAA,0x0A,0x98,0x61,0x24,0xA9,0xEC,0xAB,0x19,0x40,0x16,0x99,0x08,
+0x03,0xAA,0x9B,0x30,0x67,0x12,0xA9,0xEB,0x89,0x98,0x29,0x22,0xB8,0x71,0x92,0xAD,0x31,0x01,0x90,0xCC,0x9B,0x80,0x18,0x57,0x13,0x89,0x98,0xAA,0xB9,0xAD,0x29,0x57,
+0x03,0x99,0xAA,0x38,0x12,0xEA,0x9C,0x20,0x52,0x80,0x9A,0x90,0xBD,0xAB,0x51,0x34,0x12,0x00,0x00,0x99,0x8A,0xFA,0x9F,0x10,0x00,0x31,0x23,0xC8,0xBB,0x88,0x20,0x33,
+0x83,0xDA,0x9F,0x08,0x21,0x02,0x29,0x93,0xDF,0xCB,0x51,0x04,0x98,0x88,0x08,0x09,0x89,0x23,0x82,0xAB,0xAD,0x9B,0x89,0x61,0x15,0x09,0x25,0x82,0xCA,0x1C,0x01,0xA0,
+0x9D,0x88,0x99,0x28,0x32,0x13,0x99,0x12,0x2C,0x77,0x03,0x8B,0x11,0xB8,0x1B,0x47,0x00,0x89,0x80,0xBE,0x9A,0x10,0x42,0x45,0x23,0xDA,0xAC,0x89,0x10,0x12,0x31,0x82,
+0x88,0x41,0x82,0xEA,0xAA,0x0A,0x53,0x11,0x80,0xDA,0xAB,0xA8,0x9C,0x21,0x80,0x33,0x76,0x14,0xA8,0xBC,0x08,0x23,0x00,0xA8,0xC9,0xD8,0x19,0xA1,0x20,0x04,0x23,0xFC,
+0x9C,0x21,0x22,0x90,0x1A,0x33,0x13,0xFC,0x9C,0x89,0x41,0x98,0xAB,0x18,0x62,0x43,0x22,0x88,0xCB,0x28,0x02,0x9A,0xDF,0xDB,0x8B,0x40,0x25,0x02,0x80,0x9A,0xAA,0xB9,
+0x8A,0x54,0x42,0x14,0xA0,0xBC,0xAB,0x09,0x42,0x03,0x88,0xBB,0x9B,0x8A,0xC8,0xAD,0x68,0x47,0x12,0x12,0x90,0xBC,0x8A,0x00,0xCB,0xBB,0xCC,0x9C,0x51,0x33,0x13,0x01,
+0x00,0x19,0x89,0x11,0xBC,0xAD,0xA9,0x31,0x77,0x82,0x99,0x99,0xDA,0xAD,0x10,0x12,0x32,0x33,0x35,0x82,0xA9,0xCB,0x0A,0x13,0xFB,0x9C,0x18,0x00,0x39,0x36,0x80,0x88,
+0xBD,0x28,0x80,0x80,0x20,0x02,0x88,0x42,0x19,0xB0,0xBF,0x0A,0x13,0xBA,0x5A,0x27,0x90,0x1B,0x83,0xDC,0x8A,0x11,0x81,0x11,0x9C,0x08,0x29,0xF2,0xAF,0x18,0x12,0x42,
+0x43,0x03,0xC8,0x9C,0x10,0x81,0xA8,0x9C,0x11,0xD8,0xAF,0x2A,0x12,0x43,0x42,0x03,0xB0,0x0A,0xE0,0x9C,0x20,0x53,0xA0,0xAC,0x10,0x98,0x31,0x14,0xE8,0x8C,0x62,0x13,
+0xD9,0xAB,0x98,0x20,0x44,0x80,0x9A,0xAC,0x09,0x32,0x44,0xA0,0x8B,0x43,0xC2,0xCD,0x0A,0x23,0x98,0x11,0x88,0x80,0x10,0xA0,0x9E,0xB0,0x2D,0x26,0xA0,0xBB,0x40,0x44,
+0x02,0xA8,0x9A,0x98,0xA9,0x9A,0x09,0xA0,0x19,0x85,0x2B,0x77,0x80,0x80,0x8B,0x01,0x18,0x80,0x01,0x11,0x16,0xD9,0x2B,0x11,0x81,0x89,0x19,0x73,0x46,0x81,0xE8,0xBC,
+0x99,0x40,0x35,0x90,0x18,0x90,0xCB,0x99,0x19,0x81,0x52,0x24,0x04,0xAA,0xBA,0x98,0xEB,0x9C,0x44,0x35,0x91,0x99,0xBB,0xBC,0x9A,0x80,0x12,0x62,0x34,0x90,0x18,0x14,
+0xA8,0xCD,0x8A,0x00,0xCB,0x39,0x56,0x01,0xAB,0x88,0x10,0x98,0xCA,0x0B,0x34,0x25,0xB0,0xBB,0x29,0x33,0xFA,0xBB,0x8B,0x22,0x74,0x22,0x82,0xBA,0xA9,0xB9,0x8B,0x21,
+0x74,0x92,0x89,0x08,0x23,0xB8,0x0A,0x25,0x13,0xFA,0xCB,0x19,0x01,0xA9,0x9F,0x20,0x33,0x35,0x81,0x08,0x9A,0x31,0xC0,0xDE,0x09,0x12,0x09,0x32,0xDE,0x89,0x11,0x44,
+0x12,0xB9,0xCB,0x29,0x55,0x01,0xAB,0x99,0x09,0xBA,0x8C,0x44,0x12,0xC8,0xBB,0x21,0x44,0x23,0xA9,0x8A,0x28,0x25,0xC9,0xCF,0x08,0x32,0x31,0x82,0xC9,0x28,0x52,0x92,
+0x99,0xBC,0x0A,0xB0,0x0B,0x78,0x55,0xA1,0xCB,0x8B,0x88,0x31,0x21,0x24,0x31,0x36,0xC0,0xBF,0x9B,0x30,0x22,0x00,0xB8,0x99,0x21,0x53,0x23,0xB2,0x99,0x09,0x14,0xFA,
+0xBE,0x9B,0x41,0x12,0x00,0xAA,0xAD,0x19,0x21,0x24,0xB0,0xCD,0x09,0x81,0x0A,0x45,0x45,0x91,0xBA,0x09,0x22,0xC0,0xAC,0x00,0xA1,0x8A,0x74,0x02,0x9A,0xB9,0x21,0x31,
+0x82,0x99,0xAF,0x00,0x43,0xB8,0x8B,0xCA,0x19,0x67,0x23,0x90,0x88,0x99,0x0A,0x29,0x24,0x02,0xFC,0xBC,0x0B,0x42,0x24,0x22,0x01,0x90,0xAD,0x00,0x90,0xAA,0x19,0x35,
+0x11,0xEB,0xCB,0x18,0x14,0xA0,0x0C,0x23,0x80,0x99,0x76,0x03,0xCA,0x89,0x99,0x89,0x00,0x18,0x31,0xE9,0x9D,0x63,0x83,0x89,0x82,0xAC,0xA9,0x08,0xD8,0x0A,0x23,0x01,
+0x8C,0x34,0x13,0x18,0xD9,0xAC,0xEB,0x8A,0x89,0x20,0x25,0x14,0x88,0x08,0x98,0x23,0x12,0x04,0xDF,0xA9,0x09,0x33,0x91,0xBC,0x08,0x38,0x81,0x74,0x63,0x82,0xBB,0xBC,
+0x2A,0x35,0x92,0xBD,0x99,0x41,0x12,0x50,0x81,0xCA,0x0A,0x02,0x10,0x08,0x12,0x89,0x43,0xC0,0x99,0xEF,0x18,0x33,0x11,0xC0,0xAF,0x19,0x23,0x33,0x92,0xBC,0x38,0x13,
+0xA9,0x38,0x13,0xF9,0x8D,0x10,0x38,0x45,0x91,0xAB,0xC9,0x9C,0x29,0x45,0x32,0x23,0xD0,0x9D,0x08,0x99,0x10,0x28,0x43,0xA8,0xAC,0x9A,0x21,0x12,0x32,0x47,0x82,0xCA,
+0xBB,0xAC,0xAA,0x8B,0x38,0xA3,0xD9,0x71,0x81,0x40,0x01,0x0A,0x53,0xD8,0xAD,0x19,0x14,0x89,0xBA,0x8D,0x80,0x30,0x14,0x98,0x9C,0x08,0x36,0x83,0xA0,0x90,0x19,0x54,
+0xD0,0xBC,0xAA,0x88,0x81,0x31,0x37,0x00,0x8A,0x98,0x9E,0x40,0x23,0xA0,0xDB,0x8B,0x29,0x54,0x24,0x23,0xE9,0x8B,0x10,0x00,0x28,0x22,0x01,0x19,0xD2,0xDF,0xAC,0x08,
+0x11,0x23,0x73,0x13,0x00,0x99,0xBB,0xC9,0xDB,0x8A,0x20,0x10,0x45,0x81,0xAB,0x18,0x12,0x29,0x56,0x82,0xEB,0xAA,0x18,0x22,0x01,0x88,0x22,0xAA,0x18,0x90,0xDF,0x8A,
+0x22,0x02,0x10,0x01,0xD9,0x9B,0x24,0x11,0x32,0x06,0x92,0xDB,0x88,0xB0,0xA0,0x0F,0x42,0x13,0x81,0x9A,0x99,0x39,0x15,0xA3,0xAB,0xFD,0x98,0x42,0x14,0xA0,0xBE,0x20,
+0x23,0x16,0xA1,0xBB,0xAA,0x18,0x44,0x64,0x81,0xCB,0xAB,0x0A,0x32,0x04,0x88,0x88,0x34,0xC0,0x9B,0x33,0x42,0xC2,0xAB,0x01,0x38,0x67,0x22,0xE9,0xAC,0x38,0x82,0xAA,
+0x90,0xBC,0x41,0x23,0xA0,0xA9,0x41,0x93,0x88,0x20,0x27,0xB8,0xBB,0x0A,0x99,0xCB,0x10,0x23,0xD0,0x89,0x37,0xA0,0xFD,0x8B,0x41,0x13,0x88,0x99,0x20,0x11,0x95,0xAE,
+0x19,0x12,0x98,0x52,0xC2,0xCC,0xA9,0x18,0x08,0x08,0x28,0x32,0x02,0xA9,0xDE,0x8B,0x18,0x63,0x33,0x98,0x9A,0x90,0xAE,0x30,0xA2,0xDF,0xAB,0x31,0x05,0x08,0x90,0x10,
+0x35,0x23,0xC9,0x8A,0xBA,0x89,0x2A,0x36,0x15,0xA1,0xAD,0x1A,0x45,0x02,0x89,0x10,0x99,0xAB,0x31,0x35,0xB8,0xFB,0x1A,0x08,0x51,0x35,0xA0,0x8A,0x10,0x73,0x82,0xBC,
+0xBB,0xBA,0x99,0x51,0x45,0x82,0xA9,0x99,0xAA,0x98,0x89,0x41,0x44,0x24,0x12,0x80,0xAA,0xDA,0xBF,0x08,0x11,0x08,0x18,0x48,0x27,0x99,0x99,0x00,0x11,0xCC,0x19,0x43,
+0x82,0xEB,0x09,0x24,0x42,0x13,0xFA,0x9A,0x00,0x99,0x18,0x99,0x51,0x23,0x34,0xC9,0xBB,0x08,0x99,0x42,0xFA,0xAC,0x21,0x13,0x35,0x01,0x98,0xA1,0xBD,0xAA,0xCD,0x88,
+0xA8,0x11,0x02,0x30,0x47,0x12,0x90,0x88,0xA0,0xB8,0xCE,0x0A,0x22,0x33,0x92,0x1C,0x92,0x9E,0x30,0xA1,0xBE,0x18,0x51,0x41,0x98,0x80,0x52,0x04,0xB8,0x9B,0x32,0xC0,
+0xDC,0xBC,0x30,0x16,0x99,0x10,0x31,0x44,0x11,0xA9,0x9D,0x98,0xDA,0xAB,0x08,0x21,0x20,0x55,0x13,0xB8,0xAC,0x99,0x28,0x24,0x99,0x12,0xB3,0xBF,0x88,0xAC,0x29,0x45,
+0xA1,0x0B,0x21,0xA9,0x0C,0x90,0xD0,0x9B,0x71,0x34,0x90,0xB9,0x9B,0x89,0x11,0xFB,0x0E,0x33,0x10,0x18,0x01,0xB9,0x30,0x81,0x00,0xB8,0xEF,0x9A,0x71,0x03,0xA9,0x18,
+0x34,0x11,0x81,0x9B,0x99,0x8B,0xBC,0x2D,0x34,0xA8,0xCC,0xB9,0x18,0x40,0x25,0x61,0x11,0xB9,0x8A,0x20,0xA3,0x00,0x41,0x66,0xA1,0xBB,0xCA,0xAC,0xAB,0x48,0x33,0x24,
+0x80,0xCC,0xBB,0x1A,0x73,0x25,0x10,0x10,0x99,0xBB,0x89,0x83,0xAB,0xD8,0x1A,0x01,0xAB,0x36,0x91,0x0B,0x48,0x15,0x22,0x54,0x01,0x80,0xDB,0xBB,0xAA,0x52,0x80,0x18,
+0x54,0x98,0xBB,0x09,0x89,0xA0,0xDC,0x1A,0x52,0x22,0x11,0x93,0x0C,0x61,0x03,0xAE,0x0A,0x50,0x22,0xA9,0x8A,0xC9,0x0D,0x32,0x34,0xC0,0x9B,0xA8,0x10,0x98,0x8C,0x10,
+0x37,0x24,0x12,0xCC,0x9D,0x9B,0x31,0xD9,0x19,0x23,0x63,0x23,0x98,0xCB,0x8E,0x21,0x01,0x9A,0x22,0xBA,0xDC,0xAC,0x80,0xB8,0x89,0x73,0x03,0x01,0x51,0x02,0xAC,0x99,
+0x10,0xA0,0x89,0xC0,0xAC,0x79,0x15,0xA9,0x08,0x21,0x82,0xDC,0x9A,0xC0,0x8B,0x54,0x02,0x10,0x33,0x15,0x10,0x91,0xFC,0x89,0x80,0x01,0x90,0xBB,0x8C,0x30,0x45,0x22,
+0x23,0x41,0x14,0xC9,0xCC,0xBA,0x9B,0x08,0x42,0x11,0x12,0xD8,0x89,0x10,0x28,0x36,0x02,0xFA,0xBD,0x08,0x23,0x33,0xA8,0x99,0xA9,0xB0,0x9C,0x31,0x67,0x02,0xBC,0x99,
+0xA8,0x9A,0x11,0x23,0x33,0x11,0x44,0x43,0x12,0xE9,0xBA,0xA8,0xF9,0x0B,0x23,0x89,0x51,0x24,0x01,0x00,0x33,0xCB,0x19,0xF9,0x8B,0x22,0x31,0xB0,0x1C,0x36,0x23,0x12,
+0x02,0xFA,0xDF,0x89,0x20,0x01,0x11,0x81,0x42,0x02,0x98,0xBC,0x2A,0xA0,0xB8,0xB0,0xEF,0x9A,0x21,0x34,0x33,0x16,0x81,0xB8,0xAF,0x08,0x88,0x88,0x98,0x98,0x1A,0x81,
+0x9A,0x0A,0x62,0xB0,0x1C,0x56,0x12,0xA0,0xA9,0xCD,0x8B,0x80,0x10,0x02,0x32,0x91,0xB9,0xCA,0x4A,0x17,0x98,0x89,0x08,0x13,0x23,0xFA,0x9C,0x91,0xBA,0x00,0x0A,0x56,
+0x12,0x01,0x8A,0x40,0x14,0xC9,0x30,0x02,0x80,0xCA,0x89,0xAA,0x45,0xA1,0x0B,0x71,0x53,0x24,0x89,0xCA,0xA9,0x29,0x83,0x0B,0x57,0x91,0xAB,0x8A,0xBC,0x8B,0x63,0x22,
+0x11,0x33,0x92,0x9C,0xEA,0x9B,0x02,0xA8,0xA9,0x44,0x91,0x0E,0x81,0x31,0x86,0xAA,0x09,0x08,0x33,0x35,0x14,0xCE,0x9A,0xAA,0xCB,0x39,0x26,0x98,0xBB,0x8B,0x57,0x22,
+0xA8,0xAB,0x89,0x88,0x8A,0x32,0x42,0x45,0xB9,0xDB,0xAB,0x88,0x00,0x02,0x51,0x24,0x88,0xAA,0x8B,0x83,0x3B,0x77,0x93,0xCA,0x09,0x10,0x00,0x14,0xD9,0x9A,0x88,0x43,
+0x14,0xC9,0x8B,0x42,0x15,0x00,0x88,0x88,0x09,0xC8,0x0B,0x73,0x04,0x89,0x11,0x98,0x40,0xA2,0xEF,0x09,0x12,0x11,0xBA,0xAB,0x11,0x42,0x24,0x14,0x91,0xCC,0x9A,0xA9,
+0x0A,0x20,0x53,0x13,0xA0,0x2A,0x01,0x20,0x17,0x99,0x9B,0xFF,0x8C,0x10,0x10,0x11,0x11,0x01,0x90,0x72,0x03,0xDB,0xAB,0x80,0x88,0x81,0x50,0x43,0x82,0xBB,0x80,0x9B,
+0x63,0xD1,0xBD,0x9A,0x63,0x13,0x98,0xAA,0x41,0x33,0x22,0xDB,0x89,0xAA,0xCB,0xCF,0x08,0x22,0x11,0x22,0x31,0x13,0x13,0xFA,0xAD,0x10,0x92,0xA9,0x29,0x80,0x29,0x57,
+0x91,0xAE,0x09,0x31,0x02,0x98,0xAB,0x38,0x32,0x64,0x14,0xC9,0xAB,0xAA,0xAB,0x31,0x08,0x61,0x43,0x01,0x08,0x38,0x22,0x84,0xFF,0x8B,0x08,0x12,0x08,0xA0,0x89,0x19,
+0x46,0x42,0x82,0xB9,0xBE,0xAB,0x30,0x24,0x11,0xC9,0xBD,0x88,0x80,0x1B,0x52,0x26,0x81,0xA9,0x0A,0x83,0xFB,0x08,0x01,0xB9,0x98,0x0B,0x9A,0x28,0x77,0x16,0x89,0x88,
+0x00,0xA8,0xBB,0x99,0x32,0x47,0x81,0xAA,0xBB,0x8A,0x13,0x11,0x30,0x77,0x33,0x90,0xC9,0xBB,0xAA,0x28,0x80,0xC9,0x1A,0x32,0x36,0x43,0x22,0x80,0x18,0xC0,0xDB,0x9B,
+0x0B,0x28,0xA3,0xBF,0xAA,0x18,0x35,0x91,0x9B,0xAD,0x62,0x13,0xA8,0x2A,0x53,0x93,0xDF,0x0A,0x21,0x00,0x22,0x02,0x9A,0x80,0xD0,0xAF,0x99,0x9A,0x40,0x35,0x01,0xA1,
+0xCA,0xAC,0x08,0x00,0x41,0x73,0x22,0x83,0xBA,0xCD,0x89,0x10,0x41,0x82,0xCD,0x8A,0x89,0x19,0x32,0x45,0x63,0x91,0xBB,0x9B,0x61,0x23,0x80,0xAA,0xAA,0x9B,0xBB,0x0A,
+0x72,0x37,0x11,0xA0,0xB9,0xDB,0x09,0x30,0x22,0x10,0xB8,0xCB,0xBF,0x48,0x33,0x33,0x31,0x26,0x81,0x98,0xFB,0xDB,0xAA,0x19,0x21,0x12,0x01,0x89,0x31,0x45,0x22,0xB0,
+0xAC,0x0A,0x81,0xDC,0xAC,0x21,0x11,0x12,0x9B,0x80,0x22,0xA2,0x78,0x54,0xB9,0x8B,0x89,0x80,0x01,0x20,0xEB,0x89,0x14,0x00,0xF8,0xBF,0x28,0x24,0x01,0x80,0xA8,0xFB,
+0xAE,0x08,0x30,0x22,0x02,0x21,0x03,0xCA,0x9E,0x19,0x21,0x00,0x28,0x27,0xB0,0x9C,0xB0,0xBA,0x11,0x10,0x83,0x14,0xF9,0xCC,0x9A,0x41,0x13,0x30,0x24,0xC9,0x9C,0x80,
+0x03,0xA8,0x62,0x33,0xA0,0xCD,0x18,0x11,0x46,0x92,0xDA,0x9A,0xAA,0x88,0x20,0x41,0x25,0x82,0x99,0xA9,0x80,0x11,0x23,0x91,0xEF,0xCB,0x10,0x43,0x24,0x23,0x98,0xB9,
+0xDE,0x9B,0x01,0x21,0x00,0x09,0x28,0x09,0x56,0x13,0x91,0xCB,0x8B,0x18,0x43,0xB8,0xAD,0x00,0x32,0x54,0xA1,0xAC,0x09,0x11,0x81,0x31,0x22,0x01,0x0B,0x80,0xFC,0xBF,
+0x20,0x34,0x83,0xBD,0x08,0x22,0x52,0x02,0xBA,0x19,0xB8,0xA9,0x2A,0x55,0x24,0x12,0x93,0xBD,0x0C,0x21,0x32,0x91,0x9E,0x20,0x91,0x2A,0x07,0x00,0xDC,0xAA,0xAD,0x41,
+0x43,0x00,0xA9,0x19,0x14,0x91,0xB9,0x10,0xC0,0xBB,0x09,0x08,0xE8,0xBF,0x8A,0x32,0x36,0x02,0xB8,0xAA,0xC9,0xBD,0x09,0x54,0x13,0xB9,0xBA,0x9A,0x80,0x9B,0x28,0x38,
+0x83,0xCB,0x67,0x44,0x90,0xCC,0xAA,0x08,0x20,0xA0,0xA9,0x8A,0x73,0x15,0xA9,0x18,0x01,0xCB,0x9B,0x31,0x37,0x25,0xC9,0xAC,0x88,0xA8,0x21,0x45,0x12,0x90,0xA9,0x89,
+0xBA,0x1A,0x60,0x43,0xA1,0xAB,0xBB,0x9C,0x01,0x1B,0x46,0x01,0x31,0x14,0x80,0x01,0xE0,0x8B,0x08,0xB9,0x9F,0x73,0x02,0x08,0x99,0x19,0x81,0xD9,0xCD,0x09,0x22,0x81,
+0x20,0x12,0x21,0x95,0xBA,0x0A,0x08,0x34,0x00,0x38,0xF3,0x9F,0x10,0x12,0x10,0xB0,0x1B,0x22,0xBD,0x19,0x80,0x63,0x03,0x03,0xBD,0x0F,0x63,0x03,0xDB,0xAA,0xA9,0x48,
+0x53,0x23,0x81,0x88,0xFB,0xCC,0x89,0x21,0x11,0x21,0x22,0xA1,0x8A,0xBC,0x20,0x11,0x30,0x06,0x8B,0xB8,0xAD,0x32,0x33,0xA0,0x8A,0x0E,0x68,0x13,0xAC,0x80,0x99,0x2A,
+0x24,0x08,0x52,0x45,0xA9,0xAD,0x98,0xA9,0x09,0x98,0x71,0x36,0x22,0xE0,0xAE,0x08,0x80,0x99,0x18,0x34,0x12,0x92,0xCB,0x89,0x21,0xA8,0x2A,0x17,0xB9,0xA9,0x9C,0x19,
+0x90,0x9B,0x74,0x15,0xC9,0x8B,0x12,0x80,0xAB,0x10,0x24,0x36,0x13,0x31,0xE9,0xBC,0xBC,0x9B,0x22,0x30,0x25,0x81,0xAA,0xAA,0x68,0x45,0x13,0x98,0x99,0x98,0x19,0x13,
+0xF9,0xBD,0x8A,0x31,0x02,0x41,0x13,0x10,0x81,0xD0,0x8D,0x20,0x32,0xB1,0xCF,0x21,0x14,0x91,0xAB,0x38,0x47,0x01,0xCA,0x8B,0x10,0x02,0x9A,0x31,0x17,0x98,0xCB,0xAC,
+0x10,0x13,0x80,0x52,0x01,0xB8,0xBA,0x09,0x01,0xFF,0x9B,0x00,0x80,0x53,0x45,0x02,0xB8,0xDB,0x99,0x00,0x02,0xA9,0xBA,0x62,0x03,0x90,0x90,0x90,0xA9,0xA0,0x72,0x55,
+0x01,0x98,0xAA,0xAC,0x89,0x28,0x42,0x23,0x99,0xBB,0x1C,0x84,0xCC,0x29,0x13,0xB8,0x2A,0x35,0x08,0xC8,0x1C,0x82,0x24,0x01,0x20,0x16,0x44,0x42,0xB8,0xBF,0x9C,0xA9,
+0xBC,0x89,0x21,0x33,0x64,0x03,0xA8,0x98,0x30,0x45,0x82,0xBC,0xAD,0x88,0x18,0x11,0x01,0x08,0x43,0x33,0xB8,0xEF,0x19,0x88,0x01,0xB0,0xAC,0x20,0x43,0x13,0xBA,0x53,
+0x81,0xBC,0x8C,0x41,0x25,0xB8,0xBB,0xBB,0x38,0x63,0x81,0xAD,0x19,0x43,0x90,0xAB,0x08,0x23,0x80,0x80,0x30,0x75,0x17,0x01,0xAB,0xAB,0x09,0x21,0xA1,0x8E,0x10,0x80,
+0xCA,0x39,0x45,0x03,0xEC,0x0A,0x42,0x35,0x01,0xBA,0xBD,0x38,0x23,0xA0,0xCC,0x8A,0x34,0x03,0x09,0x8A,0x10,0x24,0x03,0xA0,0xEF,0x0A,0x20,0x51,0x25,0x01,0xB9,0xAB,
+0x20,0x01,0xC9,0xAE,0xA9,0x09,0x12,0x11,0x55,0x14,0xA8,0x9B,0x61,0x11,0x21,0x88,0xCA,0xCD,0xAB,0x08,0x42,0x43,0x13,0x98,0x89,0x91,0xA0,0xEF,0x9A,0x30,0x43,0x80,
+0xA9,0x99,0x08,0x21,0xCD,0x8A,0x43,0x34,0x83,0xB9,0x9C,0x14,0xA1,0xBA,0xA9,0x80,0x20,0xF0,0xAC,0x39,0x11,0x20,0xBA,0x0E,0x35,0x44,0x82,0xA9,0xAB,0x30,0x37,0x82,
+0xCB,0x9A,0x10,0xB8,0xFE,0x9A,0x90,0xA9,0x90,0x73,0x16,0x11,0x80,0x99,0x9A,0xAB,0x8B,0x31,0x44,0x54,0x90,0xCB,0x28,0x01,0x99,0xDB,0xAC,0x08,0x12,0x54,0x13,0xEB,
+0xBC,0x89,0x21,0x44,0x43,0x81,0xA8,0xBB,0x99,0x91,0xBB,0xB8,0x18,0x18,0x46,0x12,0x12,0xA9,0xDF,0x19,0x12,0x23,0x11,0x41,0x02,0xC9,0xBC,0x89,0x80,0x99,0xAB,0xA8,
+0x2A,0x47,0x91,0xAF,0x00,0x41,0x43,0x01,0x91,0x10,0x12,0xF9,0xAC,0x48,0x24,0xB0,0xAB,0x19,0x12,0xB1,0xFF,0x89,0x11,0x23,0x22,0x01,0x01,0xC8,0xB9,0x9B,0x09,0xEB,
+0x9B,0x45,0x34,0x01,0xB9,0xAD,0x39,0x53,0x14,0x98,0xBB,0xAD,0x18,0x34,0x02,0xAA,0x8A,0x61,0x24,0x03,0xBC,0xAA,0xBA,0x99,0x00,0x41,0x31,0xF9,0x00,0x01,0x33,0x27,
+0x11,0xEB,0xCB,0x89,0x30,0x32,0x02,0xC8,0x8A,0x33,0x91,0xBF,0x80,0x34,0x94,0xDB,0x9B,0x18,0x33,0xA3,0xAD,0x61,0x13,0x91,0xB9,0xBE,0x9B,0x19,0x08,0x56,0x13,0x89,
+0xAA,0x99,0x18,0xD9,0x2A,0x21,0xBC,0x90,0x08,0x38,0x08,0x48,0x33,0x07,0xEA,0x99,0xA0,0xA0,0x0A,0x38,0x78,0x15,0x01,0x03,0x98,0xBA,0xEA,0x10,0xFA,0xAA,0x38,0x55,
+0x14,0x80,0x80,0x99,0xB8,0xAD,0x09,0xA8,0x0A,0x55,0x11,0xA8,0xBB,0x8A,0x54,0x12,0x38,0x24,0x32,0xF9,0xAE,0x0B,0x41,0x33,0x02,0xB9,0xCC,0x0A,0x89,0x18,0x21,0x46,
+0x02,0x90,0x38,0x83,0xBB,0xBD,0xAB,0x8B,0xAA,0xAA,0x72,0xB1,0x9D,0x41,0x27,0x03,0xB0,0xBC,0x89,0x31,0x41,0x33,0x08,0xBA,0x0C,0x28,0x82,0xAD,0x00,0xBD,0x0C,0x41,
+0x02,0xB8,0xBA,0x73,0x05,0x90,0xCD,0x89,0x11,0x23,0x40,0x11,0xE9,0xCB,0x99,0x00,0x22,0x55,0x81,0x99,0x8A,0x89,0x10,0x01,0xA8,0xD0,0xAC,0xAD,0x8A,0x53,0x23,0x91,
+0xBB,0x8A,0x80,0x3B,0x04,0x73,0x01,0x28,0xB0,0x9E,0x9A,0xDA,0x30,0x56,0x12,0xB0,0xDC,0x9B,0x28,0x33,0x12,0x32,0x35,0x82,0xC9,0xBC,0xBA,0xA0,0x89,0x80,0x5A,0x36,
+0x12,0x12,0x01,0xCC,0x09,0x98,0xDA,0x89,0x2A,0xB3,0xFF,0x89,0x32,0x03,0x88,0x31,0x41,0x22,0xE8,0xAC,0x89,0x32,0x33,0x9A,0x9D,0x21,0xC8,0x30,0x35,0x38,0x22,0xD2,
+0xAD,0xEC,0x89,0x53,0x13,0x91,0x08,0xE9,0xAB,0x28,0x42,0x21,0x88,0x89,0x13,0xA2,0x08,0xD2,0x8E,0x31,0xB9,0x2A,0xA8,0xAB,0xCB,0xBE,0x8B,0x77,0x21,0x90,0x98,0x80,
+0x9A,0xAC,0x42,0x24,0x80,0xDC,0x8A,0x08,0x90,0xAD,0x09,0x31,0x04,0x32,0x30,0xA2,0x9E,0x20,0x95,0x20,0x21,0xB0,0xBE,0x9A,0x0A,0x1B,0x57,0x12,0xA9,0xBC,0x2A,0x43,
+0x00,0x08,0x99,0x2A,0x74,0x12,0x00,0xB8,0xCF,0x88,0xA0,0x88,0x28,0x32,0x54,0x44,0x90,0xBD,0x99,0x08,0xA0,0xAB,0x40,0x44,0x33,0xD8,0x9B,0x29,0x13,0x12,0xC8,0xCD,
+0xAC,0x88,0x11,0x53,0x12,0x91,0x98,0xBA,0x51,0x16,0x91,0xAA,0x98,0x39,0x33,0x43,0xD1,0xBE,0xA9,0xBA,0x11,0x62,0x44,0x12,0x88,0xCD,0x8B,0x40,0x34,0x02,0xB9,0x08,
+0x11,0xB9,0xBC,0x0A,0x31,0x41,0x91,0x9C,0x50,0x43,0x22,0xEA,0xAC,0x18,0x80,0x88,0x53,0x92,0x1A,0x33,0x05,0x11,0xD8,0xAE,0x11,0x02,0xA8,0xAC,0x10,0x31,0x15,0xEA,
+0xAB,0xD9,0x89,0x19,0x62,0x24,0x82,0x98,0x09,0x81,0xAA,0xBB,0x2A,0x35,0x25,0xF9,0xAA,0x80,0x30,0x91,0xCC,0x18,0x18,0xB1,0x41,0x05,0xB9,0x80,0x10,0x67,0x81,0xA8,
+0xAC,0xAC,0x88,0x8B,0x30,0x15,0xA9,0x98,0x68,0x22,0x31,0xC8,0x9E,0x08,0x08,0x32,0x34,0x80,0xEC,0x8A,0x32,0x23,0x98,0xAB,0x90,0xEE,0x19,0x80,0x30,0x33,0x23,0x12,
+0x04,0x28,0xCC,0xAA,0xA9,0xB0,0xBA,0xCB,0x00,0x73,0x17,0x98,0x90,0x19,0x23,0x08,0x02,0x72,0x91,0xDD,0xBA,0x40,0x12,0x11,0x91,0xCB,0xCB,0x9B,0x10,0xA0,0x5A,0x45,
+0x22,0xA0,0xAE,0x8A,0x20,0x91,0xAE,0x20,0x32,0x02,0xAC,0x38,0x57,0x10,0x99,0xAB,0x9A,0x11,0x03,0xC8,0xCD,0x09,0x53,0x33,0x24,0x98,0xCA,0xBB,0xAC,0x9A,0x54,0x24,
+0x12,0x98,0xC9,0x89,0x31,0x33,0xC0,0x0D,0x22,0x13,0xDD,0xBB,0x19,0x43,0x33,0x42,0x15,0x00,0xBA,0xCD,0x89,0x10,0x12,0x12,0x82,0x10,0x23,0x0B,0x43,0xCB,0x30,0xFF,
+0x88,0x91,0x0A,0xAA,0x65,0x24,0x80,0xA9,0x8B,0x19,0xB0,0x9B,0x80,0x38,0x85,0xD9,0x10,0xA0,0xDA,0x19,0x16,0x98,0xDA,0x9A,0x30,0x14,0xD9,0xBD,0x08,0x10,0x52,0x33,
+0x81,0xFA,0x9C,0x19,0x22,0x10,0xA8,0xB9,0x10,0x54,0x14,0x90,0xFB,0x9A,0x80,0x90,0x21,0x53,0x13,0x11,0x53,0x82,0xEB,0xAC,0xBA,0x9A,0x42,0x43,0x13,0x98,0x51,0x21,
+0x90,0x80,0x01,0x0A,0xB8,0xBE,0xAC,0x00,0x2A,0x57,0x91,0x89,0x89,0xA0,0x29,0xBA,0x3A,0x67,0x23,0x82,0xB9,0x9E,0xAA,0x99,0x41,0x33,0x08,0xAC,0xAB,0x14,0x30,0x27,
+0x00,0xEA,0xCB,0x08,0x32,0x13,0xB8,0xAD,0x0A,0x01,0x61,0x13,0x99,0x9A,0x0A,0xB2,0xB0,0xB8,0xDF,0xAA,0x30,0x00,0xDB,0xA9,0x58,0x93,0x28,0x15,0x03,0x0A,0x0E,0xCB,
+0xB9,0x10,0x57,0x13,0xC9,0xAA,0x01,0x90,0xBA,0x50,0x37,0x10,0xA9,0xCC,0x9A,0x98,0x20,0x34,0x14,0x99,0x00,0x20,0xA3,0xFB,0x8A,0x30,0x13,0xB8,0xAF,0x30,0x27,0x90,
+0xAA,0xBB,0x1A,0x31,0x71,0x36,0x22,0xA8,0x9A,0x89,0x08,0x22,0xEA,0xCE,0xAA,0x09,0x33,0x22,0x43,0x23,0x91,0x98,0xB8,0xAF,0xAA,0xA9,0x58,0x36,0x90,0xDA,0x8A,0x41,
+0x02,0x98,0x09,0x98,0xDB,0x19,0x01,0x9A,0x2A,0x62,0x37,0x33,0x80,0x9C,0xCB,0x89,0xC9,0xBA,0xAB,0x53,0x26,0x91,0x88,0x80,0x10,0x53,0x24,0xB0,0xAF,0x99,0x08,0x21,
+0x21,0x09,0x10,0x04,0xAA,0x8C,0x24,0xCA,0x9A,0x08,0x35,0x20,0xAB,0x0E,0x63,0x12,0xB9,0x98,0x28,0x02,0xBF,0x9A,0x60,0x33,0x24,0x03,0xB9,0xCD,0xCB,0x88,0x12,0x01,
+0x28,0x03,0x32,0x57,0x91,0xBD,0x8B,0x31,0x81,0xDE,0x99,0x08,0x41,0x35,0x82,0xCB,0xAC,0x09,0x23,0x11,0x10,0x91,0xAD,0xBA,0x9A,0x10,0x14,0x05,0x21,0x23,0x26,0x08,
+0xB1,0xBF,0x8C,0x30,0x82,0x80,0xBB,0xCB,0x19,0x26,0x13,0xD0,0xCD,0x99,0x20,0x34,0x12,0x12,0x23,0x83,0x80,0xF0,0xFB,0xA9,0x9A,0x0A,0x31,0x33,0x26,0x12,0xC0,0xBB,
+0x0A,0x89,0x82,0xC8,0x2A,0x75,0x05,0x80,0x18,0x91,0xDA,0x9A,0x81,0x00,0xA9,0x08,0xA8,0xAA,0x72,0x06,0x01,0xA0,0xBC,0xBA,0x42,0x17,0x13,0x20,0x10,0xB0,0xBC,0xCC,
+0x0A,0x98,0xCA,0x18,0x82,0x61,0x42,0x00,0xB9,0x09,0x89,0x72,0x81,0xCA,0xAC,0x38,0x36,0x12,0x81,0xC9,0xBB,0x0B,0x89,0x0C,0x28,0x24,0x21,0x80,0xF0,0x9B,0x71,0x35,
+0x82,0xA9,0xB9,0xCC,0x0A,0x52,0x02,0x80,0xA8,0xA9,0xBD,0x8C,0x30,0x47,0x21,0x81,0x91,0xA8,0xA9,0xAA,0x52,0x81,0xAA,0xA0,0xBC,0x8C,0x52,0x36,0x82,0x80,0xB0,0xEC,
+0x8A,0x20,0x03,0x01,0x22,0x23,0xA8,0x8A,0xFB,0xCB,0xA0,0x20,0x08,0x0B,0x38,0x00,0x08,0x68,0x43,0x80,0x70,0x52,0x28,0xA8,0xFA,0x9A,0x10,0x01,0xAA,0xAA,0xBB,0xBC,
+0xBE,0xAA,0x20,0x33,0x77,0x33,0x04,0xA9,0xB9,0xBA,0xCB,0xAB,0x9D,0x10,0x11,0xAB,0x28,0x77,0x24,0x81,0xA9,0xAC,0xBA,0xBC,0x1A,0x30,0x33,0x26,0x32,0x14,0x92,0xCC,
+0xCB,0x9A,0x9A,0x99,0x33,0x25,0x35,0x82,0x80,0xA9,0xBB,0xAD,0x18,0x32,0x42,0x08,0x80,0xDB,0x9C,0x41,0x16,0x11,0xB0,0x99,0x08,0x40,0x82,0xDA,0xEB,0x8A,0x44,0x02,
+0x88,0x11,0x82,0x22,0x38,0xFB,0xBB,0xA0,0xB0,0x63,0x07,0x90,0x80,0xA0,0x10,0x80,0x0A,0x55,0x02,0xDC,0x0B,0x41,0x03,0xC8,0xA9,0x38,0x81,0x80,0x22,0x38,0xBF,0x29,
+0x01,0x02,0x0B,0x0C,0x8B,0x34,0xB8,0xBD,0x00,0x37,0x26,0x91,0xEC,0x9B,0x09,0x08,0x22,0x15,0x21,0x90,0xBD,0x9A,0x0A,0x23,0x67,0x12,0xA8,0xBC,0x8A,0x20,0x22,0x11,
+0xA0,0x89,0xBA,0xBF,0x9B,0x4A,0x35,0x03,0xBB,0x52,0x01,0xC9,0x10,0xA0,0xAA,0x38,0x03,0xFC,0x19,0x42,0x11,0xDB,0x80,0x82,0x0A,0x08,0x16,0x00,0xA8,0x3B,0x43,0x80,
+0x40,0xFC,0xAD,0x0B,0x01,0x73,0x14,0x02,0x08,0xAB,0xB8,0xBB,0x9D,0x30,0x53,0x82,0xAA,0xAB,0xAA,0xBA,0x30,0x64,0x23,0xB0,0x33,0x80,0xEC,0xEB,0x08,0x81,0x80,0x14,
+0x42,0x11,0xA2,0xD0,0x0C,0x21,0x23,0xAA,0x0B,0xBC,0x4B,0x32,0xBF,0x10,0x17,0x18,0x91,0xBD,0x9C,0x00,0x89,0x80,0x34,0x45,0x14,0x10,0x90,0xEB,0xAB,0x99,0x10,0x43,
+0x43,0x02,0xBD,0x99,0xB8,0x09,0x4A,0x45,0x33,0x04,0x9C,0x9A,0x18,0x08,0x0A,0x26,0x10,0x21,0x91,0x9D,0x8E,0x9A,0xAB,0x08,0x28,0x22,0x00,0xC8,0x30,0x77,0x05,0x99,
+0xCB,0x0A,0x11,0x80,0x99,0x08,0x48,0x41,0x31,0x01,0x0A,0x88,0xBE,0x4A,0x63,0x12,0xB1,0xFB,0x9C,0x98,0x88,0x10,0x44,0x02,0x91,0xB9,0x10,0x42,0x80,0x08,0x62,0x91,
+0xDC,0xAC,0x8A,0x11,0x33,0x23,0x24,0xCA,0xAD,0x41,0x22,0xA2,0xCB,0x8B,0x8B,0xBD,0x80,0x42,0x62,0x12,0xB0,0xCC,0x09,0x51,0x22,0x81,0xB9,0xAA,0x8A,0xB0,0x43,0x73,
+0xA0,0x80,0xB0,0xBF,0x2A,0x63,0x13,0x91,0xAB,0x00,0xFB,0x19,0x28,0x21,0x34,0x94,0xAC,0x8B,0x34,0x23,0xBC,0xAC,0x29,0x54,0x23,0xD8,0x9D,0x22,0x03,0xC9,0xAB,0xBB,
+0x29,0x53,0x52,0x22,0x01,0x08,0xA8,0xDF,0x99,0x80,0x00,0x51,0x13,0x00,0xBA,0x0B,0xDA,0x89,0x22,0x44,0x80,0x22,0xB8,0xFA,0x10,0x21,0x22,0x80,0xCB,0xED,0x0A,0x0A,
+0x80,0xAA,0x30,0x32,0x34,0x33,0xFB,0x8F,0x89,0x03,0x35,0x00,0x81,0xC0,0xB0,0x9A,0x8A,0x33,0x33,0x84,0xFF,0x0B,0x01,0x32,0x90,0xFB,0x09,0x23,0x21,0x33,0x85,0xD9,
+0xBB,0xBA,0x10,0x44,0x42,0x01,0xB0,0xA9,0x00,0x08,0x08,0x8F,0xA9,0x22,0x80,0x43,0x02,0x30,0x04,0xC8,0x07,0x9A,0xBA,0x8A,0xBE,0x88,0x55,0x01,0xC9,0xBB,0x32,0xA1,
+0x3A,0x75,0x02,0x09,0x99,0xD9,0xAA,0x0B,0x41,0x11,0x12,0x04,0xCA,0xAB,0x08,0x17,0x91,0x10,0x00,0xB8,0xBA,0xDF,0x9A,0x19,0x17,0x01,0x11,0x11,0x21,0xA8,0xA0,0xB8,
+0xDE,0x9A,0x11,0x23,0x04,0x82,0x20,0x83,0x80,0xFC,0xA9,0x0A,0x2A,0x06,0x01,0x28,0x36,0x18,0x20,0x08,0xEB,0xBF,0x9A,0x30,0x23,0x14,0x80,0x80,0x02,0xB8,0xFB,0xAF,
+0x09,0x63,0x23,0x02,0xC8,0xAC,0x08,0x11,0x00,0x99,0x98,0x2A,0x35,0x98,0x9D,0x9B,0x1C,0x82,0x24,0x03,0x8A,0x30,0x80,0xF4,0xDD,0x89,0x10,0x12,0x11,0x10,0xA0,0x80,
+0x80,0xC0,0x30,0x40,0xAC,0x3B,0x03,0x80,0x3E,0x40,0x47,0xA9,0xBB,0x9A,0x28,0x55,0x01,0xBB,0x0A,0x80,0x80,0x03,0x80,0x0D,0x08,0x34,0x40,0x30,0x80,0xB5,0xBC,0xAC,
+0x08,0x17,0x54,0x11,0xB9,0xBF,0x9B,0x01,0x42,0x54,0x22,0x81,0xB9,0xCD,0xCB,0x98,0x00,0x22,0x43,0x02,0x99,0x80,0xA2,0xAB,0xF8,0x98,0x08,0x30,0x52,0x33,0x04,0x98,
+0x88,0xB0,0xBE,0xAA,0x38,0x36,0x01,0xCA,0xAA,0x20,0x03,0x03,0xBD,0x30,0x47,0x81,0xA9,0xCE,0xA9,0x99,0x28,0x35,0x24,0x11,0x01,0xA8,0xDE,0xAB,0x1A,0x31,0x26,0x82,
+0x88,0xB1,0x0B,0x2A,0x08,0xB0,0xAF,0x10,0x52,0x41,0x81,0xFB,0x9C,0x08,0x42,0x11,0x80,0x31,0x28,0xA8,0xDA,0x0A,0x52,0x53,0x02,0xDB,0xAB,0x98,0x30,0x20,0x38,0x72,
+0x01,0xC8,0xBC,0x10,0x63,0x12,0x99,0xBD,0x9D,0x28,0x23,0x91,0xB9,0x88,0x53,0x25,0x91,0xAD,0xBB,0x99,0x32,0x45,0x12,0xC0,0xBA,0x0B,0x28,0x32,0x8B,0x37,0x06,0xB8,
+0xB0,0xF9,0xAB,0x10,0xA9,0x8B,0x32,0x45,0x11,0x08,0x01,0x82,0x8A,0xBB,0xC8,0x78,0x80,0xA0,0x3B,0x33,0x27,0xCA,0xA9,0x08,0x08,0xCB,0x30,0x17,0x12,0x02,0xB0,0xCF,
+0x9A,0x28,0x21,0x38,0x32,0xF8,0x0D,0x81,0xA9,0x0B,0x08,0x05,0xCA,0x9C,0x30,0x37,0x03,0x88,0x10,0x01,0xAC,0xFB,0x00,0x24,0x01,0xB9,0xCE,0x8A,0x22,0x33,0x98,0x2A,
+0x12,0x15,0x22,0x31,0xEB,0xCE,0x9A,0x22,0x43,0x81,0x09,0x11,0x23,0x80,0xBD,0xC8,0xDA,0x9B,0x50,0x73,0x02,0x88,0x08,0xB9,0xAC,0x08,0x80,0x08,0x20,0x38,0x48,0x38,
+0x24,0x03,0x8B,0x80,0xBE,0xFF,0x98,0x00,0x20,0x43,0x12,0x13,0x80,0xAC,0xDB,0xDA,0x19,0x11,0x01,0x62,0x11,0x91,0x9C,0x89,0x22,0x52,0x14,0xBA,0xBC,0xC9,0x89,0x60,
+0x43,0x01,0x0B,0x88,0xA9,0x9D,0x41,0x28,0xAA,0xBA,0x73,0x11,0xA2,0x0A,0x32,0x80,0xD0,0x80,0x8B,0xD0,0xC0,0x30,0x43,0x03,0xF8,0x9B,0x8D,0x14,0x33,0xA0,0xBA,0x0B,
+0x70,0x80,0xCC,0x09,0x01,0x22,0x80,0x8B,0x40,0xF0,0xAA,0x52,0x21,0xAA,0xBF,0xAD,0x89,0x01,0x34,0x24,0x91,0x30,0x28,0xFA,0x9B,0x9B,0x00,0x23,0x08,0x0E,0x98,0x88,
+0x20,0x73,0x13,0xCB,0x9A,0x80,0x52,0x16,0x05,0xA0,0x9C,0x00,0x90,0x99,0x18,0xA2,0x8C,0x20,0xB0,0x0F,0x0A,0x26,0x21,0x33,0x28,0x08,0x02,0x80,0xAF,0x8B,0x02,0x25,
+0x04,0xCA,0xAC,0x9A,0xC8,0x8B,0x72,0x43,0x22,0x13,0x0A,0xCB,0xCB,0x8A,0x80,0x80,0xDB,0x48,0x15,0x11,0x12,0x84,0x82,0xAA,0xBD,0xBE,0xB9,0xA0,0x00,0x71,0x43,0x81,
+0x08,0x89,0x89,0x80,0x30,0x03,0xC8,0xFC,0xAD,0x09,0x81,0x21,0x43,0x83,0xA9,0x08,0x38,0xCB,0xBB,0x78,0x23,0x22,0xB0,0xAF,0x29,0x14,0x80,0x80,0xF0,0xBB,0x29,0x28,
+0x83,0xBB,0x0C,0x08,0x34,0x67,0x10,0xB0,0x99,0x21,0xA2,0xBB,0xAE,0x89,0x80,0x80,0x43,0x73,0x23,0xC8,0x80,0xAA,0x08,0x73,0x23,0x9C,0xBC,0x99,0x48,0x32,0x02,0x80,
+0x80,0x80,0xBD,0x48,0x36,0xA2,0xAF,0xBB,0x80,0x12,0xA2,0xE0,0xA9,0x80,0x20,0x16,0x82,0x02,0x38,0x06,0xC8,0xBA,0xD8,0xDB,0x08,0x33,0x03,0xA8,0xAB,0x0F,0x11,0x80,
+0x80,0x30,0x37,0xA2,0xA8,0xAD,0x8B,0x80,0x16,0x43,0x80,0xF9,0xAE,0x19,0x20,0x12,0x82,0x21,0x11,0x04,0x9A,0x88,0xE0,0xBB,0x28,0x35,0x01,0xCC,0x9C,0x39,0x73,0x23,
+0x01,0xEB,0xAA,0x98,0x21,0x24,0x08,0x9A,0x80,0x22,0x83,0xCF,0x99,0x31,0x16,0x11,0xB0,0x8B,0x20,0x32,0x27,0x98,0xCD,0x99,0x52,0x15,0x81,0xCB,0x8A,0x98,0x82,0x33,
+0x13,0x82,0xCD,0x98,0x89,0x2A,0x20,0x33,0x07,0x01,0xB0,0xCF,0x99,0x89,0x31,0x14,0x01,0x28,0x20,0x33,0xB4,0xCB,0x0E,0x9A,0x08,0xBB,0x30,0x47,0x08,0x08,0x8A,0x36,
+0x83,0x9C,0xAB,0xAA,0x08,0xB8,0x08,0x44,0x36,0x42,0xA0,0xBC,0x9C,0x21,0x08,0x02,0x03,0xFF,0x9A,0x32,0x43,0x22,0x02,0xBB,0xDC,0x0A,0x9C,0x9A,0x28,0x41,0x25,0x11,
+0x08,0xCA,0x99,0x28,0x08,0x08,0x17,0x82,0xDC,0x99,0x11,0x22,0x08,0xE8,0x8B,0x00,0x08,0x8B,0x30,0x35,0x73,0x21,0x08,0xD8,0x9A,0x8A,0x30,0x8B,0xBC,0x24,0x67,0x12,
+0xA9,0x9B,0x0A,0xA0,0x82,0x83,0x8B,0x8F,0xAB,0x38,0x08,0x73,0x30,0x17,0x08,0xB9,0xAB,0x8B,0x22,0x03,0x08,0x34,0xC0,0x0C,0xCB,0xB0,0xDC,0x2A,0x47,0x04,0x01,0xA8,
+0xBC,0xAA,0xA0,0x20,0x28,0x08,0x63,0x15,0x80,0xAB,0xAB,0x38,0x56,0x80,0xCB,0x9A,0x28,0x21,0x80,0x3B,0x03,0x34,0x08,0xBD,0x00,0xC8,0xB8,0x74,0x25,0x81,0x9B,0xCB,
+0xA9,0xA9,0x38,0x02,0x80,0x80,0x35,0x04,0x48,0x83,0x84,0xCB,0x0B,0xF8,0x09,0x20,0xB0,0xBC,0xFB,0x28,0x01,0x15,0x14,0x01,0x88,0x0A,0x83,0xC0,0xFF,0x88,0x10,0x12,
+0x10,0x10,0x12,0x02,0x0B,0x8B,0x0C,0x80,0x80,0xBD,0x0C,0x73,0x14,0x01,0xCA,0x9C,0xBB,0x28,0x52,0x80,0xCA,0x0C,0x08,0x28,0x37,0x24,0x03,0x98,0xA8,0x00,0xEB,0xBD,
+0x1A,0x33,0x08,0x8A,0x0D,0x8A,0x02,0x33,0x43,0x80,0x80,0x74,0x06,0x01,0xD9,0x8C,0x89,0x08,0x38,0x41,0x33,0x08,0xDA,0xC9,0x9C,0x99,0x80,0x22,0x35,0x35,0x90,0xC9,
+0xA0,0x20,0xA8,0xCD,0xBA,0x21,0x14,0x22,0x08,0x80,0x73,0x14,0xC9,0xA0,0xA0,0x9C,0x8A,0x80,0x83,0x24,0x73,0xA2,0xC0,0xBA,0xBA,0x00,0x26,0x01,0xBD,0xAB,0x0A,0x68,
+0x21,0x88,0x20,0x8A,0xB3,0x80,0x35,0x34,0x84,0xFB,0x28,0x48,0x80,0xAA,0xAB,0x8B,0xC8,0xCB,0x80,0x80,0x04,0x78,0x23,0x33,0x03,0x0C,0x08,0x88,0x80,0xDF,0xCA,0x0A,
+0x22,0x25,0x08,0x38,0x33,0xB3,0xBD,0x00,0x07,0x21,0xB0,0xB0,0xC8,0x30,0x40,0x80,0xD0,0xEF,0xA9,0x20,0x33,0x83,0x89,0x42,0x22,0x02,0xB8,0xDC,0xA8,0xAA,0x8B,0x30,
+0x00,0x08,0x36,0x47,0x81,0xE0,0xAC,0x20,0x11,0x08,0x01,0x08,0x88,0x80,0x34,0xC0,0xCB,0x8A,0x80,0x74,0x82,0xCA,0xCB,0xAB,0xAB,0x22,0x77,0x13,0x80,0x90,0xA9,0x99,
+0x80,0xBB,0x8C,0x0A,0x20,0x73,0x43,0x01,0xEA,0xBA,0x18,0x15,0x09,0x8B,0x82,0x04,0x08,0x22,0x33,0xF0,0xBA,0xDA,0x08,0x08,0x08,0x33,0x43,0x73,0x80,0xFB,0xAB,0x0A,
+0x51,0x24,0x13,0x09,0x9B,0x0A,0xAC,0xA9,0x08,0x38,0x00,0x88,0x0D,0x07,0x88,0x80,0x0B,0x30,0x80,0x3D,0x34,0xC0,0xBB,0xCF,0x0B,0x23,0x37,0x11,0x90,0x89,0x22,0x82,
+0xFB,0xBA,0xAA,0x3A,0x32,0x17,0x01,0xA8,0xCC,0x10,0x22,0x38,0x08,0x43,0x08,0xCF,0x09,0x01,0x82,0x80,0x43,0x32,0xBB,0xD8,0x3B,0x04,0x48,0x38,0xC0,0x08,0x08,0x08,
+0xFF,0x9B,0x18,0x20,0x80,0x78,0x33,0x23,0xA8,0x0B,0x9F,0x89,0xA0,0x20,0x33,0xF0,0xC8,0x80,0xA0,0x80,0x83,0x17,0x84,0x09,0x28,0x22,0xF0,0xCB,0x0C,0x08,0x08,0x21,
+0x84,0x00,0x82,0xBB,0xCB,0x80,0x64,0x21,0x80,0x30,0x03,0xBC,0xAF,0xA9,0x9C,0xAA,0x80,0x33,0x03,0x74,0x23,0x08,0xAB,0x0B,0xAF,0xA9,0x22,0x30,0x33,0x67,0x00,0xC9,
+0x9B,0x80,0x82,0x22,0x82,0xFB,0x0C,0x21,0xA2,0xC0,0x2A,0x24,0x01,0x20,0x80,0x80,0x44,0x32,0x00,0xD8,0xBB,0xC8,0xAC,0x9F,0x19,0x16,0xA1,0x00,0x41,0x33,0x02,0xAB,
+0xBB,0x0C,0x80,0x80,0x0D,0x48,0x08,0x0C,0x08,0x84,0x40,0x43,0x03,0xBC,0x8B,0x8C,0xDB,0x0E,0x41,0x33,0x02,0x08,0xF0,0x89,0x80,0xAA,0xBA,0x8B,0x40,0x03,0x40,0x64,
+0x23,0xA0,0xEB,0xC9,0x9C,0x80,0x12,0xA2,0xB0,0x33,0x17,0xA2,0xD0,0xBB,0x2A,0x04,0x82,0x80,0x80,0x47,0x08,0xCC,0xAA,0x18,0x82,0x02,0x15,0x14,0xA2,0x0A,0x08,0xFB,
+0xAD,0x00,0x33,0x32,0xA0,0xBF,0xAB,0x09,0x01,0x20,0x67,0x21,0x21,0x08,0x0A,0xBB,0xAA,0x08,0x0B,0x08,0x58,0x48,0x45,0x93,0xFA,0xA9,0x99,0x2A,0x23,0x34,0x24,0x83,
+0xBC,0xBE,0x99,0x11,0x32,0x43,0x22,0x82,0x03,0xBC,0x9E,0xAC,0x09,0x01,0x80,0x80,0x34,0x48,0x03,0x08,0x37,0xBD,0xAB,0x0A,0xB8,0x43,0x16,0xA2,0xF8,0x9A,0x10,0x01,
+0xA8,0x02,0xB0,0xBC,0x80,0x67,0x10,0x90,0xB8,0x10,0x24,0x9C,0x0C,0x9A,0x10,0xB0,0xB0,0xDC,0x51,0x13,0x08,0x08,0x38,0x30,0x34,0x43,0xFB,0xEB,0xAC,0x89,0x52,0x23,
+0x03,0x89,0x0B,0x10,0x00,0xB8,0xC0,0xBB,0xFB,0x9A,0x2A,0x08,0x33,0x47,0x11,0x23,0xA0,0xBF,0x1A,0x28,0x08,0x08,0xBB,0x43,0x33,0xFB,0x9F,0x10,0x12,0x11,0x82,0x02,
+0xB8,0x8B,0x34,0x03,0xDF,0xBA,0xAB,0xA9,0x32,0x67,0x13,0x00,0xB0,0xC9,0x9A,0x09,0x0A,0x0A,0x15,0x34,0x80,0xAA,0xE0,0xA0,0x40,0x43,0x01,0xBC,0xAD,0x18,0x12,0x2A,
+0x50,0x12,0x80,0xB0,0x80,0x8B,0xD0,0x8F,0x80,0x24,0x08,0x52,0x21,0x80,0x33,0x03,0xBC,0x8F,0x8B,0x20,0x80,0xB3,0xC8,0x80,0xD0,0x80,0x80,0x44,0x26,0x01,0x8A,0x0B,
+0x08,0xD8,0xBB,0x48,0x37,0x14,0x91,0xAA,0xBD,0xAB,0x8C,0x22,0x32,0xBB,0x08,0x0D,0x8B,0x80,0x37,0x15,0x82,0xDA,0xAD,0x88,0x31,0x12,0xB9,0xE0,0xA0,0x89,0x08,0x16,
+0x14,0x08,0x08,0xDB,0xAB,0x0A,0x72,0x03,0x08,0x08,0x02,0x02,0xCB,0x8B,0xAF,0x89,0xB0,0x30,0x48,0x08,0x0C,0xAC,0x08,0x43,0x37,0x80,0xAA,0x30,0x48,0x02,0x03,0xCC,
+0xAD,0xB0,0x00,0xCB,0x9E,0x48,0x33,0x24,0xA1,0x80,0x30,0x33,0x00,0x04,0x04,0xEF,0x8B,0x99,0x08,0x41,0x43,0x52,0x81,0x00,0x9A,0x9C,0x0A,0x82,0xB0,0xB8,0x08,0x50,
+0x37,0x15,0x13,0x98,0xAE,0x9C,0x9A,0x9B,0x32,0x26,0x38,0x08,0xC0,0x0D,0x89,0x33,0x25,0x14,0xA8,0xCC,0x99,0x18,0x01,0x80,0xA8,0x8A,0x03,0x03,0xBD,0x43,0x30,0x40,
+0x78,0x82,0xB0,0xEA,0x80,0x82,0x83,0x83,0xF0,0xCA,0xBB,0x12,0x53,0xA0,0xCC,0x8A,0x80,0x22,0x05,0xA8,0x80,0x80,0x43,0x80,0xD0,0x0B,0x08,0xBD,0x9E,0x88,0x23,0x33,
+0x30,0x04,0xC8,0x3B,0x70,0x81,0xB0,0x0F,0x9A,0x08,0x8A,0x80,0x80,0x44,0x72,0x31,0xA0,0xB0,0xB0,0xAE,0xAB,0x3B,0x16,0x82,0xB0,0x00,0x48,0x32,0x34,0x08,0xC8,0xDF,
+0x0A,0x81,0x21,0x12,0x83,0xB0,0xBC,0xBB,0x78,0x15,0x81,0x12,0x02,0x80,0x9F,0x89,0x22,0x08,0xB0,0xC8,0xBB,0x8F,0x10,0x55,0x12,0x81,0xC0,0xA0,0x00,0x08,0xB8,0x8B,
+0x8B,0x50,0x48,0x8B,0x0C,0x73,0x40,0x28,0x01,0x80,0xB8,0xBF,0x08,0x04,0xAA,0x0D,0x08,0x22,0x38,0x33,0x00,0x08,0x08,0xFF,0x8C,0x00,0x13,0x80,0x20,0x30,0x03,0x34,
+0x74,0x08,0xEB,0xBB,0x9A,0x41,0x32,0x02,0xA8,0x08,0x08,0xC8,0xC0,0x80,0x0C,0x80,0x44,0x38,0xF0,0xBA,0x0B,0x20,0x73,0x23,0x84,0x82,0xBC,0xBE,0x8B,0x08,0x41,0x31,
+0x40,0x10,0xA0,0x80,0x8B,0x8B,0xBD,0x80,0x44,0x08,0x0C,0x03,0xF8,0x0D,0x28,0x23,0x84,0x89,0x8A,0x33,0xCB,0xC0,0x3B,0x70,0xC0,0x0B,0x28,0x04,0xA8,0x8A,0x30,0x64,
+0x10,0xA0,0xBB,0xBB,0x3C,0x84,0x03,0xC8,0x9F,0xBC,0x00,0x51,0x81,0x10,0x45,0x13,0x90,0x9A,0x9D,0xA9,0xA9,0x08,0x36,0x08,0x80,0xAB,0x08,0x43,0x30,0x00,0x08,0xC6,
+0x8A,0x9F,0x28,0x28,0xB0,0xBB,0x8F,0x40,0x25,0x83,0x01,0x0C,0xAC,0xCB,0x99,0x28,0x82,0x65,0x22,0x01,0x9B,0x9A,0x28,0x33,0x03,0xFC,0xA0,0x80,0x52,0x91,0xBC,0x8D,
+0x80,0x09,0x88,0x35,0x43,0x25,0x12,0x91,0xCC,0xCA,0x0B,0x08,0x13,0x84,0x80,0xAA,0xE0,0xA9,0x89,0x72,0x13,0x02,0x91,0x8A,0x8A,0x80,0xD0,0xEB,0x9A,0x08,0x32,0x17,
+0xA9,0x9C,0x80,0x14,0x04,0x08,0xAA,0xB8,0x00,0x43,0x80,0x85,0x80,0xDB,0x0B,0x8B,0x44,0x02,0x80,0x40,0x40,0xC0,0x80,0x0C,0x8B,0x8C,0x80,0xED,0x98,0x51,0x10,0x22,
+0x82,0xB0,0xBC,0x4B,0x72,0x13,0x03,0xB0,0x00,0xB8,0xF8,0xC9,0xA0,0x0A,0x02,0x33,0x34,0x80,0xDF,0x99,0x10,0x22,0x32,0x08,0x8F,0x89,0x82,0x00,0x08,0xBC,0x0C,0x43,
+0xBB,0xC8,0x70,0x23,0x03,0xBA,0x8A,0x8B,0x3C,0x80,0x35,0x43,0x30,0x0C,0xF0,0x0C,0x0A,0x08,0x38,0x80,0x30,0x80,0xF0,0xBD,0xC8,0x08,0x54,0x04,0x11,0x89,0x9B,0xCA,
+0x80,0x22,0x62,0x21,0xA8,0xAA,0x9E,0x0C,0x0A,0x82,0x62,0x38,0x00,0xDA,0xA9,0x80,0x20,0x00,0x08,0x84,0x80,0x85,0x27,0x01,0x01,0xAB,0xFB,0x9A,0xA8,0x80,0xBB,0x8B,
+0x50,0x48,0x78,0x11,0x80,0x80,0x80,0x80,0x34,0x03,0x17,0x01,0xB0,0xFB,0xAB,0x9A,0x08,0x78,0x31,0x03,0x80,0xAB,0x8B,0xAF,0x20,0x82,0xBB,0x30,0x35,0x08,0xBC,0x08,
+0x37,0x34,0x22,0xAB,0x9E,0xBA,0x0D,0x0A,0xAA,0x0A,0x33,0x43,0x26,0x23,0x05,0xAA,0xD9,0xAD,0x99,0x32,0x21,0x34,0x16,0x91,0x98,0xBA,0xCD,0x09,0x81,0x80,0x0A,0x38,
+0x30,0x80,0x08,0x68,0x80,0xCC,0x00,0xBC,0x4B,0x32,0x64,0x41,0x22,0x08,0xAC,0xA9,0x08,0xBB,0xBC,0xF0,0xB8,0x10,0x50,0x14,0x28,0x01,0x08,0xEB,0xAB,0xAC,0x42,0x32,
+0x52,0x80,0x0A,0x8A,0xB0,0x88,0x35,0x83,0xD0,0x30,0x8B,0xCC,0xBA,0x38,0x50,0x08,0x08,0x85,0x80,0xFC,0xA9,0x80,0x50,0x61,0x12,0x80,0x80,0x80,0x8A,0x9E,0xCB,0x08,
+0x21,0x23,0x30,0x80,0x8C,0xDB,0x80,0x27,0x21,0x08,0xBB,0x80,0xDB,0x30,0x73,0x82,0xA0,0xBB,0x0B,0x48,0xC0,0xFB,0xC9,0x10,0x30,0x25,0x32,0x20,0x22,0x03,0xBC,0x9E,
+0x9E,0x80,0xA9,0x20,0x42,0x80,0x80,0x30,0xB8,0x08,0x08,0xBF,0x0B,0x03,0x80,0x60,0x78,0x20,0x08,0x88,0x80,0x8B,0xDF,0xA9,0x89,0x52,0x25,0x10,0x99,0xA9,0x2A,0x33,
+0x08,0xAF,0x9C,0x80,0x22,0x02,0xB3,0xC8,0x80,0x40,0x84,0x84,0x03,0x08,0xBD,0xC0,0x30,0x40,0x03,0xBD,0x0B,0x58,0x83,0x03,0x80,0xBD,0xF8,0x99,0x38,0x72,0x10,0xB8,
+0x9D,0x8B,0x20,0x02,0x05,0x08,0x08,0x3B,0x80,0x04,0x0D,0x08,0xC8,0x03,0x80,0x05,0x03,0x08,0x0E,0x08,0x88,0x80,0x80,0xCF,0xBA,0xC8,0x0B,0x78,0x23,0x52,0x21,0xD0,
+0xA0,0x80,0x80,0xBB,0xCB,0x80,0x80,0x50,0x48,0x08,0x08,0x80,0x86,0x30,0x00,0x08,0xBF,0x0B,0x08,0x65,0x32,0x02,0xBB,0xFB,0xA0,0x0A,0x8A,0x80,0x80,0x50,0x48,0x08,
+0x08,0x84,0x70,0x13,0x83,0xBB,0x9F,0xA8,0x80,0x30,0x08,0x08,0x80,0x36,0x03,0x80,0x80,0x80,0x90,0x57,0x08,0xB8,0xBC,0xC0,0xFB,0x9A,0x40,0x41,0x15,0x90,0x99,0xA0,
+0xA8,0x80,0x80,0x34,0x80,0xD0,0x80,0x84,0xB3,0x8C,0x8B,0xD0,0x08,0x0D,0x08,0x53,0x33,0x43,0x08,0xBC,0xCB,0x8B,0x80,0x80,0x80,0x0F,0x43,0x33,0x34,0xB3,0xBF,0x9E,
+0x80,0x80,0x82,0x80,0x03,0x08,0xD8,0x30,0x34,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0xDF,0xB0,0x80,0xBC,0x8B,0x85,0x37,0x83,0xA2,0xE0,0xA0,0x80,0x20,0x02,0x03,0x08,
+0x80,0x80,0x80,0x9F,0xD0,0xF0,0x9A,0x80,0x80,0x38,0x40,0x33,0x34,0x03,0xD0,0xFB,0x98,0x28,0x20,0x80,0x80,0x40,0xB4,0xC8,0x00,0x08,0x0D,0x43,0x33,0x84,0xC0,0xFB,
+0xA9,0x0A,0x8A,0x06,0x23,0x08,0x8B,0x80,0x80,0x80,0x80,0x70,0x03,0x44,0x08,0x0C,0x9F,0xA9,0x80,0x80,0x30,0x30,0x80,0x05,0x08,0x0D,0x0C,0x03,0x08,0xD8,0xC0,0x30,
+0x80,0x58,0x30,0x44,0x02,0x03,0xBF,0xAE,0x98,0x80,0x02,0x82,0x33,0x43,0x03,0x08,0xBD,0x9F,0x0A,0x28,0x33,0x48,0x08,0xC8,0x0B,0x08,0x85,0x30,0x00,0xCD,0xBA,0x0C,
+0x83,0x84,0x30,0x50,0x03,0xC3,0x08,0x0D,0x8B,0x0C,0x80,0x80,0x35,0x00,0x58,0x30,0xD0,0xCB,0x8D,0x80,0x30,0x08,0x43,0x30,0x00,0xE8,0x80,0x80,0x80,0x86,0x80,0x8F,
+0x8A,0x63,0x08,0x08,0xA8,0x08,0x48,0x73,0x21,0x08,0xAB,0x9E,0x9C,0x80,0x20,0x38,0x33,0x03,0xB4,0x08,0xBD,0x8B,0xD0,0x80,0x40,0x43,0x48,0x08,0x03,0x88,0x80,0xBE,
+0x0C,0x08,0x88,0x35,0x00,0xBD,0xB8,0x08,0x08,0x08,0x07,0x07,0x03,0xB0,0xBB,0x08,0xBD,0xB0,0x08,0x08,0x08,0x08,0x17,0x84,0xB4,0xC8,0xB0,0x08,0x44,0x03,0xC8,0x0C,
+0x80,0x0C,0xC0,0xC0,0xB0,0x03,0x74,0x01,0xA8,0x0A,0xB0,0x88,0xD0,0x30,0x40,0x30,0xD0,0xC0,0xB0,0x08,0x88,0x0D,0x48,0x24,0x03,0x40,0x03,0xCC,0xF0,0xB9,0x10,0x22,
+0x03,0x38,0x00,0x08,0x0E,0x08,0x88,0x50,0x80,0x85,0xC0,0x80,0x4B,0x30,0x80,0xE0,0x80,0x80,0x08,0xE8,0x80,0x40,0x70,0x20,0x80,0x80,0xCB,0x8E,0xA9,0x22,0x30,0x30,
+0x50,0x33,0x04,0xC8,0xBB,0xBC,0x80,0x40,0x40,0xC0,0xC0,0x80,0x30,0x35,0x38,0x0B,0xD8,0x3B,0x80,0x0D,0x08,0xD8,0xFB,0x08,0x31,0x32,0x03,0x08,0xBD,0xC0,0x80,0xD0,
+0x80,0x03,0x04,0xC8,0x80,0x80,0x80,0x80,0x70,0x85,0x33,0xC0,0xF0,0x9A,0x0A,0x0B,0x30,0x03,0x04,0x08,0x80,0x86,0x80,0x00,0xE8,0x30,0x80,0xD0,0x08,0x0D,0x03,0x08,
+0x58,0x80,0x80,0xE0,0x80,0x0C,0x80,0x40,0x80,0x80,0x80,0x80,0x00,0x9F,0x00,0x35,0x40,0x80,0x8C,0x80,0xD0,0x08,0x0D,0x08,0x08,0x85,0x30,0xD0,0x80,0x40,0x03,0x04,
+0x08,0x0D,0xB8,0x0D,0x08,0x08,0x85,0xC0,0xC0,0x30,0x80,0x85,0x03,0x80,0x0D,0xBC,0x00,0x08,0x58,0x8B,0xD0,0x30,0x80,0x44,0x03,0x08,0xBD,0xB8,0x08,0x68,0x08,0xC8,
+0x30,0x04,0x03,0x0D,0x0C,0x80,0x80,0x04,0xD8,0xC0,0x00,0x08,0x48,0x80,0x80,0x80,0x80,0xA7,0x08,0x08,0x78,0x30,0x40,0x08,0x08,0x8D,0x8B,0xBD,0x8B,0x44,0x32,0x00,
+0x08,0x08,0x78,0xC0,0x0B,0x80,0x17,0x01,0x0B,0xCB,0x8A,0xC0,0x30,0x40,0x48,0x08,0x08,0x80,0x80,0x80,0x17,0x0D,0xCB,0xB0,0x08,0x34,0x80,0x80,0x86,0x80,0x0C,0xC8,
+0xAC,0x08,0x48,0x80,0x00,0x08,0x08,0x37,0x04,0xC8,0xBB,0xC8,0x80,0x04,0x58,0x08,0xB3,0x08,0x08,0x08,0xF8,0x09,0x80,0x80,0x70,0x80,0x80,0x80,0x80,0x90,0x00,0x9F,
+0x35,0x38,0x00,0xD8,0x80,0x80,0xE0,0xC0,0x03,0xC8,0x00,0x0C,0x08,0x48,0x80,0x50,0x08,0xD8,0x80,0x8B,0x80,0x36,0x03,0x80,0xFD,0x08,0x08,0x32,0x02,0x30,0x80,0xE0,
+0xC0,0x80,0x3B,0x50,0x48,0x08,0x0C,0x8B,0xD0,0x80,0x80,0x80,0x3D,0x40,0x24,0x43,0xB0,0xC8,0x0B,0xC8,0x08,0x58,0x03,0x03,0x08,0xE8,0x80,0x8C,0x8B,0x80,0x80,0x80,
+0xF0,0x09,0x0D,0x08,0x04,0x43,0x80,0xD0,0xC0,0xB0,0x0C,0x8B,0x84,0xC0,0x80,0x34,0x43,0x80,0x80,0xD8,0x80,0x80,0x80,0x80,0x8F,0x80,0x85,0x84,0xC0,0xB0,0x08,0x48,
+0x70,0x13,0x00,0x8B,0x8B,0x00,0x08,0x08,0xF8,0xC9,0x30,0x40,0x80,0x85,0x80,0x00,0xCF,0x80,0x20,0x30,0x30,0x40,0x80,0x80,0xBE,0x8B,0x8C,0x80,0x80,0x80,0x80,0x70,
+0x41,0xC0,0xC0,0x80,0x80,0x85,0x43,0x08,0x0C,0xCB,0x00,0x08,0x84,0x80,0x80,0x80,0x0F,0x08,0x88,0x80,0x80,0x90,0x00,0x70,0x81,0x0D,0x0C,0xC0,0x80,0x30,0x50,0x08,
+0x08,0x50,0x08,0x08,0xE8,0x80,0x84,0x80,0x85,0x80,0x8B,0x80,0x60,0x0C,0x03,0x08,0x80,0xF0,0x80,0x80,0x85,0x80,0xB4,0x08,0xD8,0x80,0x80,0x08,0x68,0x8B,0x80,0x0D,
+0x08,0x04,0x08,0x08,0x78,0x80,0x80,0x08,0x0E,0x08,0x88,0x80,0x06,0x08,0x08,0x08,0x3F,0x80,0x80,0x80,0x80,0x8F,0x80,0x50,0x08,0xD8,0xC0,0x8A,0x80,0x04,0x58,0x08,
+0x03,0x08,0x8D,0x8B,0x85,0x80,0xD0,0xC0,0x00,0x0C,0x03,0x07,0x01,0xA8,0xB8,0x80,0x80,0x50,0x80,0x80,0x60,0x08,0x08,0x8D,0x84,0xC0,0x80,0x80,0xD0,0x08,0x34,0x40,
+0x30,0x00,0xE8,0xBB,0x0C,0x0C,0x48,0x38,0x24,0x30,0x00,0xD8,0xCB,0x8B,0x40,0x80,0x80,0x05,0x08,0x08,0x0E,0x48,0x08,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0xF0,0x09,
+0x80,0x80,0x70,0x80,0x04,0x08,0x80,0x0E,0x08,0x0D,0x8B,0x0C,0x30,0x80,0x50,0x40,0x80,0x8C,0x8B,0x80,0x86,0x80,0x00,0xE8,0x80,0x80,0x80,0x80,0x80,0x00,0x17,0x08,
+0x85,0x8B,0xD0,0xB8,0x08,0x08,0x08,0x37,0x04,0x08,0x88,0xE0,0xC0,0x80,0x80,0x50,0xB8,0x08,0x85,0x84,0x80,0x84,0x80,0xD0,0x80,0xD0,0x80,0x80,0x80,0x05,0x0C,0x08,
+0x88,0x80,0x80,0x90,0x70,0x81,0xD0,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0xF0,0x59,0x08,0x03,0x08,0x08,
+0xF8,0x80,0x80,0x0D,0x08,0x84,0x80,0x80,0x80,0x80,0x00,0x00,0x17,0x08,0x08,0x08,0x8F,0x80,0x08,0x68,0x80,0x80,0x05,0x08,0x0D,0x08,0x88,0x80,0xF0,0xB8,0x08,0x80,
+0x80,0x07,0x03,0x48,0x80,0x0D,0xB8,0xD8,0xC0,0x00,0x03,0x88,0x50,0x80,0x85,0x80,0x00,0x8D,0x80,0x80,0x80,0x80,0x00,0x00,0x9F,0x00,0x85,0x80,0x80,0x86,0x80,0x85,
+0x0B,0xC8,0x08,0x08,0x85,0x80,0x80,0x80,0x80,0xF0,0x59,0x08,0x03,0x08,0x08,0x0F,0x08,0x3C,0x00,0xD8,0x80,0x80,0x58,0xC0,0x80,0x80,0x08,0x08,0x87,0x80,0x00,0x08,
+0xF8,0x80,0x80,0x08,0x08,0x87,0x30,0x00,0x8D,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x17,0x08,0x08,0x08,0x08,
+0x00,0xF0,0x09,0x80,0x80,0x80,0x17,0x08,0x8D,0x80,0x0D,0x48,0x08,0x08,0x80,0x60,0x08,0x08,0x08,0x08,0x08,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x70,0x81,0x80,0x0E,
+0x08,0x04,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x60,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,
+0x80,0x80,0x07,0x08,0x88,0xE0,0x80,0x80,0x08,0x08,0x87,0x80,0x00,0x08,0x0F,0x08,0x58,0x08,0x08,0x08,0x08,0x08,0x08,0x00,0x9F,0x85,0x80,0x80,0x80,0x80,0x80,0x00,
+0x00,0x00,0x00,0x00,0x9F,0x00,0x85,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x07,0x08,0x88,0x80,0xF0,0x03,0x08,0x08,0x08,0x08,0x9F,0x04,
+0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x9F,0x00,0x85,0x80,0x80,0x0E,0x08,0x08,0x68,0x08,0x08,0x80,0x80,0x80,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x70,0x81,0x80,0x80,
+0x80,0x00,0x9F,0x85,0x80,0x80,0x0D,0x48,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x02,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const ADPCM_Sound_t rocket_launch = {rocket_launch_data,66466,{0,0},4000};
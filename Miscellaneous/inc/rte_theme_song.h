@@ -0,0 +1,28 @@
+/*Theme of "Return To Earth" played on start and game over screens, 4 bars in A minor looped (refer to sequencer.h)*/
+#include "../../Device_drivers/inc/sequencer.h"
+
+const Synth_Instrument_t rte_theme_lead = {SYNTH_WAVE_SQUARE,5,80,150,40};
+const Synth_Instrument_t rte_theme_bass = {SYNTH_WAVE_TRIANGLE,5,40,220,30};
+
+const Sequencer_Event_t rte_theme_melody[] = {
+	SEQUENCER_ACCENT(noteA4,EN),SEQUENCER_NOTE(noteC5,EN),SEQUENCER_NOTE(noteE5,QN),SEQUENCER_STACCATO(noteD5,EN),SEQUENCER_STACCATO(noteC5,EN),SEQUENCER_NOTE(noteB4,QN),
+	SEQUENCER_ACCENT(noteC5,EN),SEQUENCER_NOTE(noteE5,EN),SEQUENCER_NOTE(noteA5,QN),SEQUENCER_STACCATO(noteG5,EN),SEQUENCER_STACCATO(noteE5,EN),SEQUENCER_NOTE(noteD5,QN),
+	SEQUENCER_ACCENT(noteF5,QN),SEQUENCER_NOTE(noteE5,EN),SEQUENCER_NOTE(noteD5,EN),SEQUENCER_NOTE(noteC5,QN),SEQUENCER_STACCATO(noteB4,EN),SEQUENCER_STACCATO(noteG4,EN),
+	SEQUENCER_ACCENT(noteA4,HN+QN),SEQUENCER_REST(QN),
+	SEQUENCER_END
+};
+
+const Sequencer_Event_t rte_theme_bassline[] = {
+	SEQUENCER_STACCATO(noteA2,QN),SEQUENCER_STACCATO(noteA3,QN),SEQUENCER_STACCATO(noteA2,QN),SEQUENCER_STACCATO(noteA3,QN),
+	SEQUENCER_STACCATO(noteF2,QN),SEQUENCER_STACCATO(noteF3,QN),SEQUENCER_STACCATO(noteF2,QN),SEQUENCER_STACCATO(noteF3,QN),
+	SEQUENCER_STACCATO(noteD2,QN),SEQUENCER_STACCATO(noteD3,QN),SEQUENCER_STACCATO(noteG2,QN),SEQUENCER_STACCATO(noteG3,QN),
+	SEQUENCER_NOTE(noteA2,HN),SEQUENCER_STACCATO(noteE2,QN),SEQUENCER_REST(QN),
+	SEQUENCER_END
+};
+
+const Sequencer_Track_t rte_theme_track[] = {
+	{rte_theme_melody,&rte_theme_lead,SPEAKER_VOLUME_HALF},
+	{rte_theme_bassline,&rte_theme_bass,SPEAKER_VOLUME_HALF},
+};
+
+const Sequencer_Song_t rte_theme_song = {rte_theme_track,2,140,0,SEQUENCER_PLAY_LOOP};
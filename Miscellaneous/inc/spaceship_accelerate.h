@@ -1 +1,40 @@
-const uint16_t spaceship_accelerate[] = {2064,2080,2080,2096,2112,2128,2144,2160,2176,2192,2208,2224,2240,2256,2272,2288,2304,2320,2336,2336,2352,2368,2384,2400,2416,2432,2448,2448,2464,2480,2496,2512,2528,2528,2544,2544,2544,2544,2544,2528,2528,2496,2480,2448,2416,2384,2336,2288,2240,2192,2144,2080,2016,1968,1904,1840,1792,1728,1680,1616,1568,1536,1488,1456,1424,1392,1360,1344,1312,1296,1280,1264,1248,1248,1232,1216,1216,1200,1184,1184,1168,1168,1152,1136,1136,1120,1120,1104,1104,1104,1104,1104,1104,1104,1120,1120,1136,1136,1152,1168,1184,1200,1200,1216,1232,1248,1280,1296,1312,1328,1344,1360,1376,1408,1424,1440,1472,1488,1520,1552,1584,1616,1648,1680,1728,1760,1808,1840,1872,1920,1952,2000,2032,2064,2096,2128,2160,2176,2208,2224,2240,2256,2272,2288,2304,2304,2320,2320,2336,2336,2352,2352,2368,2368,2384,2384,2384,2384,2384,2384,2368,2368,2352,2320,2304,2272,2240,2208,2160,2128,2080,2016,1968,1904,1840,1776,1728,1664,1600,1536,1472,1408,1344,1296,1232,1184,1136,1088,1040,992,944,896,864,816,784,736,704,656,624,592,560,528,496,464,448,432,416,400,400,400,400,416,432,448,480,512,560,592,640,688,736,800,848,912,960,1008,1056,1104,1152,1200,1232,1264,1296,1328,1344,1376,1392,1408,1440,1456,1472,1488,1504,1536,1552,1568,1600,1632,1648,1680,1712,1744,1776,1808,1824,1856,1872,1904,1920,1920,1936,1936,1936,1920,1920,1904,1872,1856,1824,1792,1760,1712,1680,1632,1600,1552,1504,1472,1424,1376,1344,1296,1264,1216,1184,1152,1104,1072,1040,1008,976,944,928,896,880,848,832,816,800,784,784,784,768,784,784,784,800,816,832,848,864,896,912,944,960,992,1008,1040,1056,1072,1104,1120,1136,1152,1168,1184,1200,1216,1232,1248,1264,1280,1296,1312,1328,1360,1376,1392,1424,1440,1456,1488,1504,1520,1552,1568,1584,1616,1632,1648,1664,1680,1696,1712,1712,1728,1744,1760,1776,1792,1824,1840,1856,1888,1904,1936,1952,1984,2000,2032,2048,2064,2080,2096,2096,2112,2112,2096,2096,2080,2048,2032,2000,1968,1936,1888,1856,1808,1776,1728,1696,1664,1632,1600,1568,1552,1520,1504,1488,1488,1472,1456,1456,1440,1424,1424,1408,1392,1360,1344,1312,1280,1232,1200,1152,1104,1056,1008,960,912,864,816,784,752,720,704,688,688,688,688,704,736,752,784,832,880,912,960,1008,1056,1104,1152,1200,1248,1280,1328,1360,1392,1424,1440,1472,1488,1520,1536,1552,1584,1600,1632,1664,1696,1728,1776,1808,1856,1888,1936,1984,2032,2080,2112,2160,2192,2240,2272,2288,2320,2352,2368,2384,2384,2400,2416,2416,2416,2432,2432,2432,2448,2448,2464,2480,2480,2496,2512,2544,2560,2576,2592,2608,2624,2640,2656,2656,2656,2656,2656,2640,2624,2592,2560,2528,2480,2432,2368,2320,2256,2192,2144,2080,2016,1952,1888,1840,1776,1728,1680,1632,1600,1568,1536,1504,1488,1472,1456,1440,1424,1424,1408,1408,1408,1408,1392,1392,1392,1392,1392,1392,1392,1392,1392,1392,1392,1392,1392,1392,1392,1392,1408,1408,1424,1424,1440,1440,1456,1472,1488,1488,1504,1520,1536,1552,1568,1600,1616,1632,1664,1680,1696,1728,1760,1776,1808,1824,1856,1888,1904,1936,1952,1984,2000,2016,2032,2032,2048,2048,2048,2048,2048,2032,2032,2016,2000,1968,1952,1920,1888,1856,1824,1792,1760,1712,1680,1648,1600,1568,1536,1504,1456,1424,1392,1360,1328,1296,1264,1248,1216,1184,1168,1136,1120,1104,1088,1072,1056,1040,1024,1024,1008,1008,1008,1008,1008,1008,1008,1008,1024,1024,1040,1056,1056,1072,1088,1104,1120,1136,1152,1168,1184,1200,1232,1248,1264,1296,1312,1344,1376,1408,1440,1472,1504,1552,1600,1632,1680,1728,1776,1824,1872,1936,1984,2032,2080,2128,2176,2224,2272,2320,2352,2400,2432,2464,2496,2528,2560,2576,2592,2608,2624,2624,2640,2640,2640,2640,2624,2624,2608,2592,2560,2544,2512,2480,2448,2416,2368,2320,2288,2240,2192,2128,2080,2032,1984,1920,1872,1824,1776,1712,1664,1616,1568,1536,1488,1440,1408,1360,1328,1296,1264,1216,1184,1152,1120,1088,1056,1024,992,960,928,880,848,816,800,768,736,704,688,656,640,624,608,592,576,576,560,560,560,560,560,560,576,576,592,608,608,624,624,640,656,656,672,688,704,704,720,736,736,752,768,784,800,816,832,848,880,896,928,944,976,1008,1040,1072,1104,1136,1184,1216,1264,1296,1344,1392,1440,1488,1552,1600,1664,1712,1776,1840,1904,1952,2016,2080,2144,2208,2272,2336,2400,2448,2512,2560,2592,2640,2672,2704,2720,2736,2752,2752,2752,2736,2720,2704,2688,2656,2624,2592,2560,2528,2496,2464,2432,2400,2368,2336,2304,2272,2256,2224,2208,2192,2176,2160,2144,2112,2096,2080,2064,2048,2016,1984,1952,1920,1888,1856,1824,1776,1728,1680,1648,1600,1552,1504,1456,1408,1360,1312,1264,1232,1184,1152,1104,1072,1040,1008,976,944,912,880,848,816,784,752,720,688,672,640,608,592,560,544,528,512,496,480,480,464,464,480,480,496,512,528,544,560,592,624,656,672,720,752,784,816,864,896,944,976,1024,1072,1104,1152,1200,1264,1312,1360,1424,1472,1536,1584,1648,1712,1760,1824,1872,1920,1968,2016,2048,2080,2112,2128,2144,2160,2160,2160,2144,2144,2112,2096,2064,2048,2000,1968,1936,1904,1872,1824,1792,1760,1728,1712,1680,1648,1632,1616,1600,1584,1568,1552,1552,1536,1520,1504,1504,1488,1472,1456,1440,1424,1408,1376,1360,1344,1312,1296,1264,1248,1232,1200,1184,1168,1152,1136,1120,1104,1088,1088,1072,1056,1056,1056,1040,1040,1040,1024,1024,1024,1024,1024,1024,1024,1024,1040,1040,1056,1072,1088,1104,1120,1152,1168,1200,1232,1264,1296,1328,1376,1408,1440,1488,1520,1552,1584,1616,1648,1664,1696,1712,1728,1744,1760,1776,1776,1792,1792,1808,1808,1808,1824,1824,1824,1824,1824,1840,1840,1840,1840,1840,1840,1824,1824,1808,1808,1792,1776,1760,1744,1712,1696,1664,1648,1616,1584,1552,1520,1488,1456,1424,1408,1376,1344,1312,1280,1264,1232,1200,1168,1136,1104,1088,1040,1008,976,944,896,864,816,768,720,688,640,592,544,496,464,416,384,352,320,288,272,256,240,224,208,208,208,208,208,208,224,224,240,240,256,272,272,288,288,304,320,336,352,368,384,400,432,464,496,528,576,624,672,720,768,832,896,960,1024,1104,1168,1232,1296,1376,1440,1504,1568,1616,1680,1728,1792,1840,1888,1920,1968,2000,2032,2080,2112,2144,2176,2208,2240,2256,2288,2320,2336,2368,2384,2400,2432,2448,2448,2464,2464,2464,2464,2464,2464,2448,2432,2416,2384,2368,2336,2304,2272,2240,2208,2176,2144,2096,2064,2016,1984,1936,1888,1856,1808,1760,1712,1664,1616,1552,1504,1440,1392,1328,1264,1216,1152,1088,1024,976,912,864,816,768,720,672,640,624,592,576,560,544,544,544,544,560,560,576,592,608,624,656,672,688,720,736,768,784,816,848,880,912,944,976,1008,1040,1088,1120,1168,1216,1264,1312,1360,1408,1456,1504,1536,1584,1632,1664,1696,1728,1760,1776,1792,1824,1840,1840,1856,1872,1888,1888,1904,1920,1936,1952,1968,1984,2016,2048,2080,2112,2144,2176,2224,2256,2304,2336,2384,2416,2448,2464,2480,2496,2512,2512,2512,2512,2496,2480,2448,2416,2384,2352,2304,2272,2224,2176,2128,2080,2032,1984,1952,1904,1856,1824,1776,1744,1696,1664,1632,1600,1552,1520,1488,1440,1408,1360,1328,1280,1248,1200,1152,1120,1072,1024,992,960,912,880,848,816,800,768,752,720,704,688,688,672,656,656,656,640,640,640,640,656,656,672,672,688,720,736,768,800,832,880,928,976,1040,1088,1152,1216,1296,1360,1440,1504,1568,1648,1712,1776,1840,1904,1968,2016,2064,2112,2144,2192,2224,2256,2272,2304,2320,2336,2352,2368,2384,2400,2416,2416,2432,2448,2448,2464,2464,2464,2464,2448,2448,2432,2416,2384,2352,2320,2272,2240,2192,2128,2080,2016,1952,1888,1824,1776,1712,1648,1600,1552,1504,1472,1440,1408,1376,1360,1344,1344,1328,1328,1328,1328,1328,1328,1344,1344,1344,1328,1328,1328,1312,1312,1296,1296,1280,1280,1264,1264,1264,1264,1264,1280,1280,1312,1328,1360,1392,1424,1456,1488,1536,1584,1616,1664,1696,1728,1760,1792,1824,1840,1856,1872,1872,1888,1888,1888,1872,1872,1872,1856,1856,1856,1856,1840,1856,1856,1856,1872,1872,1888,1904,1920,1936,1936,1952,1968,1968,1984,1984,1984,1984,1968,1968,1952,1936,1920,1904,1888,1872,1856,1856,1840,1840,1840,1840,1840,1856,1872,1888,1904,1936,1968,1984,2016,2048,2080,2096,2112,2144,2160,2160,2176,2176,2160,2160,2144,2128,2112,2096,2080,2064,2048,2032,2016,2000,2000,2000,2000,2016,2016,2032,2064,2080,2112,2144,2176,2208,2240,2272,2304,2336,2368,2384,2400,2416,2432,2448,2448,2448,2448,2432,2432,2416,2400,2384,2368,2352,2336,2320,2304,2288,2272,2256,2240,2224,2192,2176,2144,2128,2096,2064,2016,1984,1936,1888,1840,1792,1744,1680,1632,1568,1520,1472,1408,1360,1328,1280,1248,1216,1184,1168,1136,1120,1120,1104,1104,1104,1104,1104,1104,1104,1104,1104,1104,1104,1104,1104,1104,1104,1104,1104,1104,1104,1120,1136,1152,1184,1216,1248,1296,1344,1392,1440,1504,1568,1632,1696,1760,1824,1888,1952,2016,2064,2112,2160,2192,2224,2240,2272,2272,2288,2288,2304,2304,2304,2288,2288,2288,2288,2304,2304,2320,2320,2336,2368,2384,2400,2432,2464,2496,2512,2544,2576,2592,2608,2640,2656,2656,2672,2672,2688,2688,2672,2672,2656,2656,2640,2640,2624,2608,2608,2592,2592,2576,2560,2560,2544,2528,2528,2512,2480,2464,2432,2400,2368,2336,2288,2224,2176,2112,2048,1984,1920,1840,1776,1712,1632,1568,1504,1456,1392,1360,1312,1280,1248,1232,1216,1216,1216,1216,1232,1248,1264,1280,1296,1312,1344,1360,1376,1392,1408,1424,1440,1440,1456,1456,1472,1472,1488,1504,1504,1520,1536,1568,1584,1616,1648,1680,1728,1776,1824,1872,1920,1968,2016,2080,2128,2176,2224,2272,2320,2368,2400,2448,2480,2512,2528,2560,2592,2608,2624,2640,2656,2672,2688,2688,2704,2704,2720,2720,2720,2720,2720,2704,2704,2688,2672,2656,2624,2608,2576,2544,2512,2464,2432,2384,2336,2304,2256,2208,2160,2128,2080,2048,2000,1968,1936,1904,1872,1840,1808,1776,1744,1728,1696,1664,1632,1600,1568,1536,1504,1472,1440,1408,1376,1344,1312,1280,1248,1232,1216,1200,1184,1184,1184,1184,1200,1216,1232,1264,1296,1328,1376,1424,1472,1520,1584,1648,1696,1760,1824,1888,1952,2016,2080,2144,2208,2288,2352,2416,2480,2544,2608,2672,2736,2816,2880,2944,3008,3056,3120,3184,3232,3280,3328,3360,3408,3424,3456,3472,3488,3488,3504,3504,3488,3472,3472,3456,3424,3408,3392,3360,3344,3328,3312,3296,3280,3264,3248,3232,3216,3216,3200,3184,3184,3168,3152,3120,3104,3072,3040,2992,2960,2912,2864,2800,2736,2672,2608,2544,2464,2400,2320,2256,2192,2128,2064,2000,1952,1904,1856,1824,1792,1760,1728,1712,1696,1680,1680,1664,1664,1664,1648,1648,1648,1648,1648,1648,1648,1648,1648,1648,1648,1648,1648,1664,1664,1680,1696,1712,1744,1760,1792,1824,1856,1888,1936,1968,2016,2064,2112,2160,2208,2256,2304,2352,2400,2448,2496,2560,2608,2656,2704,2752,2816,2864,2912,2976,3024,3088,3136,3200,3248,3296,3360,3408,3456,3504,3552,3584,3632,3664,3696,3728,3744,3776,3792,3808,3808,3824,3824,3824,3808,3808,3792,3792,3776,3744,3728,3712,3680,3648,3616,3584,3552,3504,3456,3408,3360,3296,3232,3168,3088,3024,2944,2864,2768,2688,2592,2512,2416,2336,2240,2160,2080,2000,1920,1840,1776,1712,1664,1600,1552,1504,1472,1424,1392,1376,1344,1328,1312,1296,1280,1264,1264,1248,1248,1248,1264,1264,1280,1296,1312,1344,1376,1408,1456,1504,1568,1632,1696,1776,1856,1936,2016,2112,2192,2288,2384,2480,2560,2656,2736,2816,2896,2960,3040,3104,3152,3216,3264,3296,3344,3376,3408,3440,3472,3504,3536,3552,3584,3600,3632,3648,3680,3696,3728,3744,3760,3792,3808,3808,3824,3840,3840,3840,3824,3824,3808,3792,3760,3744,3712,3680,3632,3600,3552,3504,3456,3408,3360,3312,3264,3216,3168,3120,3056,3008,2960,2896,2848,2784,2736,2672,2608,2544,2480,2416,2336,2272,2192,2128,2048,1968,1888,1808,1728,1664,1584,1520,1440,1376,1312,1248,1200,1136,1088,1056,1008,976,944,912,880,864,848,832,816,816,800,800,800,800,816,816,832,848,864,880,896,928,960,992,1024,1056,1104,1136,1184,1232,1280,1328,1376,1440,1488,1536,1600,1648,1712,1760,1824,1872,1920,1984,2032,2080,2128,2192,2240,2288,2336,2368,2416,2464,2496,2544,2576,2608,2640,2672,2704,2720,2752,2768,2784,2800,2816,2832,2848,2848,2864,2864,2880,2896,2896,2912,2912,2928,2944,2960,2976,2992,3008,3024,3040,3056,3072,3088,3088,3104,3104,3104,3104,3088,3072,3056,3024,2992,2960,2912,2864,2816,2752,2688,2624,2560,2496,2416,2352,2288,2208,2144,2080,2032,1968,1904,1856,1808,1760,1728,1680,1648,1616,1584,1552,1520,1504,1472,1440,1424,1408,1376,1360,1344,1328,1312,1296,1296,1296,1296,1296,1296,1312,1328,1360,1376,1408,1456,1488,1536,1584,1632,1680,1744,1792,1840,1904,1952,2016,2064,2112,2176,2224,2272,2320,2368,2416,2464,2512,2560,2592,2640,2688,2736,2784,2832,2880,2928,2976,3024,3072,3120,3152,3200,3232,3264,3296,3312,3344,3344,3360,3360,3360,3360,3344,3344,3312,3296,3280,3248,3216,3200,3168,3136,3104,3072,3040,3008,2976,2944,2912,2864,2832,2800,2768,2720,2688,2640,2592,2544,2496,2448,2400,2336,2272,2224,2160,2096,2032,1968,1904,1840,1776,1728,1664,1600,1552,1504,1456,1408,1360,1312,1280,1232,1200,1152,1120,1088,1056,1024,992,960,944,912,896,880,864,848,848,848,864,864,896,912,944,992,1040,1088,1152,1216,1280,1360,1424,1504,1584,1664,1744,1824,1904,1984,2048,2128,2192,2256,2320,2384,2448,2496,2560,2608,2656,2720,2768,2816,2880,2944,2992,3056,3120,3184,3248,3312,3392,3456,3520,3584,3648,3712,3776,3824,3888,3920,3968,4000,4032,4064,4080,4080,4080,4080,4080,4080,4080,4080,4080,4080,4064,4048,4032,4016,3984,3968,3936,3904,3872,3840,3792,3760,3712,3648,3600,3536,3472,3408,3344,3264,3184,3104,3024,2944,2864,2784,2704,2624,2560,2480,2416,2352,2288,2240,2192,2144,2112,2064,2032,2000,1968,1936,1904,1872,1824,1792,1744,1712,1664,1616,1552,1504,1440,1376,1328,1264,1200,1152,1088,1040,1008,960,928,912,896,880,880,896,912,944,976,1024,1072,1136,1200,1264,1344,1408,1488,1568,1648,1728,1808,1888,1968,2048,2128,2208,2272,2352,2432,2496,2560,2640,2704,2768,2832,2896,2960,3024,3088,3152,3200,3248,3296,3344,3376,3408,3440,3456,3472,3488,3488,3488,3488,3472,3456,3440,3408,3392,3360,3328,3296,3264,3232,3200,3168,3136,3088,3056,3024,2992,2960,2928,2896,2848,2816,2768,2720,2688,2640,2576,2528,2480,2416,2352,2304,2240,2176,2112,2064,2000,1952,1904,1856,1824,1792,1760,1728,1712,1696,1696,1696,1696,1696,1712,1728,1744,1760,1776,1808,1824,1856,1872,1904,1920,1936,1968,1984,2016,2032,2064,2080,2112,2144,2160,2192,2224,2256,2288,2336,2368,2400,2448,2480,2528,2560,2608,2640,2688,2720,2752,2784,2800,2832,2848,2880,2896,2912,2912,2928,2928,2928,2944,2944,2944,2944,2944,2944,2944,2944,2928,2928,2928,2928,2928,2928,2912,2912,2912,2896,2896,2880,2864,2848,2848,2832,2816,2800,2784,2768,2752,2736,2720,2720,2704,2688,2688,2688,2688,2688,2688,2688,2688,2688,2704,2704,2704,2704,2704,2704,2704,2704,2688,2688,2672,2656,2640,2624,2608,2592,2560,2544,2528,2496,2480,2464,2448,2432,2416,2400,2384,2384,2368,2368,2352,2352,2352,2336,2336,2336,2336,2320,2320,2304,2304,2304,2288,2288,2272,2272,2272,2256,2256,2256,2272,2272,2288,2304,2320,2336,2368,2400,2432,2464,2496,2528,2560,2592,2640,2672,2704,2736,2768,2784,2816,2832,2848,2864,2880,2896,2896,2896,2912,2912,2912,2928,2928,2928,2944,2944,2960,2976,2992,3008,3024,3040,3056,3072,3088,3104,3120,3136,3152,3168,3184,3184,3200,3200,3200,3200,3200,3200,3200,3200,3184,3184,3184,3168,3168,3168,3152,3152,3152,3136,3136,3136,3120,3120,3104,3088,3072,3072,3040,3024,3008,2976,2960,2928,2896,2864,2832,2816,2784,2752,2720,2704,2672,2656,2640,2624,2608,2608,2592,2592,2576,2576,2576,2576,2560,2560,2544,2544,2528,2512,2480,2464,2432,2400,2368,2336,2288,2256,2208,2160,2128,2080,2048,2000,1968,1936,1920,1888,1872,1856,1840,1840,1840,1840,1840,1856,1856,1872,1888,1904,1920,1936,1952,1984,2000,2016,2032,2064,2080,2112,2128,2160,2192,2224,2272,2304,2352,2400,2448,2496,2544,2592,2656,2704,2768,2816,2864,2928,2976,3008,3056,3088,3120,3152,3184,3200,3216,3216,3232,3232,3248,3248,3248,3232,3232,3232,3232,3232,3232,3232,3248,3248,3248,3248,3248,3248,3248,3248,3248,3232,3216,3200,3184,3152,3120,3088,3040,2992,2944,2880,2832,2768,2704,2640,2576,2528,2464,2416,2352,2304,2272,2224,2192,2160,2144,2128,2112,2096,2096,2096,2096,2096,2096,2096,2096,2096,2096,2096,2096,2096,2096,2080,2080,2064,2048,2032,2032,2016,2000,1984,1968,1952,1952,1936,1920,1920,1904,1904,1904,1888,1888,1888,1872,1872,1872,1856,1856,1840,1824,1824,1808,1792,1776,1760,1744,1744,1728,1712,1696,1696,1696,1680,1680,1696,1696,1712,1712,1728,1744,1760,1776,1808,1824,1856,1872,1888,1920,1936,1952,1984,};
+/*IMA ADPCM sound, 2054 samples at 4000 Hz, generated by Tools/adpcm_encoder.c*/
+#include "adpcm.h"
+
+const uint8_t spaceship_accelerate_data[] = {
+0x70,0x77,0x77,0x77,0x10,0x11,0x00,0x12,0x22,0x21,0x23,0x01,0x90,0xEC,0xCC,0xBD,0xEB,0xBA,0xAC,0xAB,0xAB,0xAA,0xAA,0x99,0x9A,0xA9,0xA9,0xAA,0xAA,0x80,0x40,0x33,
+0x47,0x21,0x54,0x21,0x42,0x33,0x44,0x43,0x34,0x24,0x24,0x23,0x23,0x22,0x22,0x20,0x11,0x22,0x82,0x90,0xFA,0xBE,0xBD,0xCD,0xCB,0xBB,0xBC,0xAC,0xAB,0xBB,0xAC,0xBA,
+0xAC,0xAA,0xAA,0x89,0x20,0x53,0x35,0x35,0x34,0x33,0x24,0x22,0x12,0x22,0x41,0x22,0x24,0x34,0x14,0x23,0x10,0x89,0xBC,0xCD,0xBC,0xCB,0xCB,0xBA,0xCB,0xBA,0xAB,0xBA,
+0xBA,0x89,0x18,0x51,0x42,0x34,0x34,0x32,0x14,0x23,0x33,0x43,0x63,0x32,0x42,0x33,0x43,0x23,0x13,0x42,0x53,0x33,0x35,0x33,0x33,0x12,0xA9,0xCE,0xCC,0xBC,0xBB,0xBB,
+0xBB,0xA9,0x9A,0x9B,0xBF,0xCC,0xCC,0xBB,0xCB,0xAA,0x88,0x20,0x63,0x33,0x35,0x33,0x24,0x22,0x22,0x22,0x44,0x43,0x43,0x43,0x33,0x23,0x32,0x20,0x01,0x01,0x32,0x41,
+0x17,0x22,0x12,0x80,0xEB,0xBD,0xBE,0xBC,0xCB,0xBB,0xBB,0xAA,0x9A,0x9A,0x88,0x98,0x80,0x08,0x08,0x08,0x40,0x43,0x52,0x14,0x34,0x44,0x43,0x52,0x22,0x24,0x33,0x12,
+0x01,0x90,0xCA,0xCD,0xBC,0xDB,0xCB,0xBA,0xBB,0xBC,0xBA,0xBB,0xBA,0xAB,0x9A,0x08,0x18,0x52,0x33,0x36,0x43,0x63,0x32,0x44,0x33,0x36,0x43,0x43,0x33,0x34,0x33,0x33,
+0x33,0x22,0x11,0x90,0xBA,0xBF,0xBC,0xBE,0xDB,0xBB,0xCB,0xCB,0xBA,0xBB,0xBA,0xBC,0xBB,0xCB,0xBC,0xBA,0xBB,0xAB,0x9B,0x8A,0x80,0x22,0x15,0x42,0x51,0x12,0x13,0x35,
+0x33,0x27,0x53,0x42,0x43,0x42,0x43,0x34,0x43,0x42,0x33,0x24,0x23,0x22,0x11,0x98,0xB9,0xCC,0xBB,0xCB,0xBB,0xBB,0xAA,0xBC,0xBB,0xCE,0xAB,0xCD,0xBA,0xBC,0xBB,0xCB,
+0xBB,0xBA,0xBC,0xBB,0xAC,0xBB,0xAB,0x9B,0x0A,0x42,0x24,0x27,0x43,0x43,0x43,0x33,0x35,0x34,0x43,0x24,0x23,0x23,0x12,0x81,0xA9,0xCB,0xAD,0xCB,0xAB,0xBA,0xAA,0x9A,
+0xBA,0xC9,0xBB,0xBE,0xDA,0xAA,0xAB,0xAB,0x9B,0x8C,0x89,0x9A,0x00,0x38,0x64,0x53,0x34,0x35,0x25,0x43,0x22,0x32,0x21,0x11,0x01,0x11,0x18,0x82,0x90,0xAC,0xDC,0xCC,
+0xBC,0xBC,0xBC,0xBB,0xAD,0xCA,0xAB,0xAD,0xBB,0xBD,0xCB,0xBB,0xBB,0x9B,0xAA,0x08,0x18,0x12,0x24,0x31,0x44,0x43,0x36,0x45,0x42,0x34,0x24,0x43,0x32,0x33,0x23,0x33,
+0x33,0x24,0x33,0x32,0x23,0x01,0x08,0xCC,0xCC,0xBC,0xBC,0xBC,0xBC,0xDB,0xBB,0xBD,0xBB,0xBD,0xBA,0xBB,0xAB,0x9A,0x09,0x10,0x32,0x25,0x34,0x52,0x43,0x42,0x43,0x34,
+0x33,0x34,0x23,0x13,0x13,0x21,0x21,0x33,0x65,0x33,0x34,0x44,0x12,0x11,0x88,0xCA,0xDB,0xCB,0xBC,0xBB,0xCB,0xBB,0xCA,0xCB,0xBB,0xDB,0xBB,0xBB,0xAC,0xBA,0xAA,0xA8,
+0x98,0x19,0x21,0x73,0x44,0x44,0x34,0x44,0x33,0x43,0x33,0x33,0x32,0x22,0x21,0x21,0x21,0x11,0x90,0xBA,0xFF,0xBA,0xBD,0xAD,0xBB,0xBA,0xAA,0x9A,0x88,0x80,0x01,0x89,
+0x9A,0xAA,0x8B,0x30,0x57,0x35,0x63,0x33,0x32,0x23,0x01,0x91,0xA8,0x88,0x18,0x31,0x55,0x21,0x22,0xA0,0xDA,0xBC,0xAB,0x8A,0x48,0x35,0x27,0x43,0x31,0x11,0x99,0xCA,
+0xBA,0xBB,0x19,0x41,0x37,0x44,0x33,0x23,0x22,0x01,0xA9,0xBC,0xCB,0xBB,0xBC,0xBE,0xDB,0xBC,0xBD,0xDB,0xAB,0x9C,0xAA,0x9A,0x88,0x08,0x08,0x08,0x08,0x08,0x38,0x56,
+0x54,0x43,0x34,0x34,0x33,0x33,0x21,0x10,0x80,0x88,0x11,0x41,0x34,0x35,0x33,0x43,0x10,0x91,0x99,0xBA,0x9B,0xBC,0xAC,0xFB,0xBD,0xFB,0xCB,0xCB,0xCB,0xAB,0xAB,0x9A,
+0x08,0x20,0x21,0x23,0x42,0x11,0x11,0x23,0x73,0x53,0x44,0x43,0x33,0x34,0x33,0x24,0x31,0x11,0x12,0x11,0x81,0x90,0xCA,0xCD,0xEB,0xBB,0xBC,0xBC,0xCA,0xAA,0xBA,0xAB,
+0xBC,0xBC,0xBB,0xBC,0x9C,0x99,0x18,0x32,0x46,0x34,0x35,0x43,0x43,0x43,0x32,0x43,0x43,0x32,0x23,0x23,0x22,0x01,0x98,0xB9,0xCB,0xAB,0xBB,0xBB,0xBA,0xFB,0xDC,0xCB,
+0xBD,0xCC,0xBB,0xCB,0xAB,0xAB,0xAA,0x89,0x09,0x89,0x80,0x80,0x80,0x21,0x64,0x53,0x53,0x43,0x34,0x33,0x44,0x33,0x43,0x43,0x33,0x34,0x43,0x22,0x23,0x22,0x01,0x91,
+0x89,0xDB,0xDA,0xCB,0xBC,0xCD,0xCB,0xCB,0xCB,0xBB,0xBC,0xBA,0xBA,0xBA,0x9A,0x8A,0x8A,0x09,0x21,0x53,0x45,0x44,0x34,0x44,0x33,0x43,0x32,0x23,0x23,0x22,0x23,0x22,
+0x33,0x33,0x53,0x20,0x90,0xB9,0xBE,0xCD,0xCB,0xCB,0xBB,0xBC,0xBC,0xBC,0xCB,0xBC,0xCB,0xAC,0xBB,0xBB,0xCB,0xAA,0xAA,0x99,0x89,0x09,0x11,0x23,0x64,0x42,0x43,0x34,
+0x43,0x24,0x43,0x42,0x22,0x33,0x42,0x32,0x22,0x32,0x21,0x22,0x20,0x12,0x32,0x35,0x43,0x33,0x12,0xB0,0xDE,0xCD,0xEB,0xBB,0xBC,0xAC,0xBB,0xAB,0xBB,0xBA,0xBB,0xAB,
+0xBB,0xAB,0x80,0x40,0x45,0x36,0x34,0x34,0x34,0x43,0x33,0x33,0x34,0x43,0x43,0x33,0x43,0x22,0x12,0x81,0x98,0xBA,0xAE,0xCB,0xCB,0xBB,0xAD,0xCB,0xCB,0xDB,0xBB,0xBC,
+0xBC,0xCA,0xAA,0xAB,0xBB,0xBB,0xBB,0xBB,0xBA,0x18,0x53,0x46,0x44,0x34,0x43,0x24,0x33,0x33,0x24,0x33,0x33,0x35,0x43,0x34,0x33,0x43,0x22,0x22,0x80,0x80,0x80,0xA9,
+0xCB,0xBD,0xBC,0xBE,0xBC,0xCC,0xBB,0xBC,0xBB,0xBB,0xBB,0xBB,0xCA,0xCA,0xBB,0xBE,0xBB,0xCC,0xAA,0x8A,0x09,0x31,0x54,0x53,0x43,0x33,0x34,0x33,0x34,0x43,0x32,0x43,
+0x32,0x22,0x21,0x00,0xA8,0xBA,0xBD,0xCB,0xDB,0xBA,0xBB,0xBD,0xDB,0xCB,0xAC,0xCB,0xAA,0x9B,0xAA,0x08,0x18,0x22,0x24,0x24,0x32,0x34,0x43,0x43,0x34,0x34,0x24,0x24,
+0x23,0x22,0x12,0x01,0x81,0x80,0xA0,0x88,0xA8,0xC9,0xFB,0xAA,0xBC,0xCB,0xB9,0x09,0x08,0x38,0x81,0x00,0xCC,0xCE,0xDB,0xBB,0xAC,0xAB,0x9B,0x9A,0xA9,0xA0,0xAC,0xC9,
+0x9A,0x2C,0x53,0x45,0x45,0x33,0x53,0x23,0x23,0x31,0x10,0x10,0x01,0x42,0x34,0x43,0x33,0x34,0x13,0x81,0x00,0x9B,0xAB,0xBB,0xBC,0xEB,0xAE,0xBD,0xCC,0xBC,0xCA,0xBA,
+0xAA,0x99,0x8A,0xA0,0xAA,0xCE,0xCC,0xDB,0xCB,0xBA,0xAB,0xAA,0x09,0x00,0x32,0x43,0x25,0x52,0x32,0x44,0x34,0x25,0x43,0x33,0x24,0x22,0x13,0x10,0x00,0x09,0x88,0x11,
+0x80,0x80,0xF9,0xEA,0xCC,0xDB,0xCB,0xBB,0xBC,0xAA,0x8A,0x8A,0x80,0x80,0x80,0x90,0xA9,0x9D,0xCA,0xAA,0xAA,0x99,0xA9,0xAA,0xDC,0xCA,0x9D,0xC9,0x89,0x29,0x12,0x35,
+0x45,0x32,0x33,
+};
+
+const ADPCM_Sound_t spaceship_accelerate = {spaceship_accelerate_data,2054,{320,0},4000};
@@ -1 +1,755 @@
-const uint16_t spaceship_explode[] = {2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2048,2048,2049,2050,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2049,2049,2049,2049,2049,2048,2047,2048,2048,2047,2048,2049,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2049,2049,2049,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2050,2048,2047,2047,2047,2049,2049,2048,2048,2048,2048,2048,2047,2047,2048,2049,2049,2047,2047,2048,2048,2048,2049,2047,2046,2047,2048,2049,2048,2049,2048,2048,2049,2049,2049,2048,2048,2047,2049,2049,2047,2047,2046,2046,2048,2049,2047,2048,2048,2048,2047,2047,2048,2048,2048,2048,2047,2048,2049,2049,2048,2047,2048,2048,2048,2049,2048,2048,2049,2047,2047,2048,2048,2049,2050,2049,2049,2049,2047,2048,2049,2048,2048,2048,2047,2048,2048,2049,2049,2048,2048,2048,2047,2049,2050,2048,2047,2046,2047,2048,2048,2048,2048,2049,2048,2048,2049,2049,2049,2047,2046,2046,2047,2049,2048,2047,2048,2047,2047,2048,2049,2049,2048,2047,2048,2048,2048,2048,2047,2046,2048,2048,2048,2050,2049,2049,2049,2047,2047,2048,2048,2049,2049,2048,2049,2048,2047,2048,2049,2049,2048,2047,2048,2048,2049,2049,2046,2048,2048,2049,2048,2048,2050,2049,2047,2046,2045,2046,2048,2048,2047,2047,2047,2047,2049,2049,2048,2049,2048,2049,2051,2050,2048,2046,2047,2048,2047,2049,2049,2047,2047,2048,2049,2048,2047,2048,2047,2047,2048,2045,2046,2050,2049,2048,2048,2044,2046,2047,2047,2050,2050,2046,2045,2048,2046,2046,2045,2043,2043,2045,2050,2050,2046,2047,2046,2044,2046,2048,2044,2044,2046,2045,2045,2048,2048,2045,2046,2046,2048,2048,2048,2053,2052,2047,2049,2047,2040,2039,2042,2044,2045,2048,2049,2045,2045,2050,2049,2046,2049,2047,2045,2047,2046,2043,2045,2045,2042,2046,2050,2051,2047,2048,2051,2050,2050,2048,2045,2048,2049,2048,2050,2051,2050,2048,2048,2052,2053,2050,2048,2050,2050,2044,2044,2046,2048,2049,2049,2050,2049,2047,2046,2047,2049,2051,2049,2045,2047,2051,2049,2046,2048,2048,2048,2050,2050,2051,2048,2047,2050,2047,2044,2046,2048,2048,2043,2043,2049,2051,2047,2046,2048,2045,2046,2050,2048,2046,2049,2050,2049,2047,2047,2049,2049,2050,2052,2051,2051,2047,2042,2047,2051,2048,2045,2046,2048,2046,2045,2045,2047,2048,2050,2048,2044,2047,2049,2042,2043,2044,2042,2043,2045,2047,2045,2045,2050,2049,2049,2050,2047,2046,2048,2047,2051,2051,2047,2047,2046,2044,2044,2044,2044,2047,2047,2044,2045,2054,2054,2038,2039,2057,2055,2042,2047,2048,2045,2047,2047,2047,2047,2048,2048,2045,2048,2050,2044,2045,2050,2050,2050,2052,2055,2059,2059,2057,2053,2052,2046,2040,2039,2038,2039,2040,2042,2042,2042,2038,2036,2044,2047,2043,2041,2041,2045,2048,2043,2042,2046,2045,2051,2052,2052,2056,2054,2050,2054,2053,2050,2053,2053,2052,2053,2056,2061,2062,2060,2061,2061,2055,2053,2052,2053,2057,2053,2052,2052,2044,2038,2039,2041,2043,2046,2050,2053,2054,2054,2052,2051,2055,2053,2048,2049,2054,2054,2056,2060,2059,2055,2049,2047,2052,2052,2048,2047,2046,2044,2044,2046,2047,2045,2044,2048,2049,2050,2052,2051,2048,2044,2044,2043,2047,2045,2041,2046,2047,2045,2048,2050,2045,2046,2047,2047,2050,2047,2045,2048,2045,2036,2037,2035,2030,2034,2028,2030,2039,2036,2030,2027,2027,2031,2034,2036,2043,2044,2044,2046,2048,2046,2044,2043,2041,2041,2042,2042,2037,2036,2040,2041,2039,2039,2038,2037,2045,2045,2046,2057,2053,2031,2024,2044,2051,2044,2046,2048,2044,2036,2036,2039,2036,2035,2040,2045,2045,2039,2035,2036,2037,2041,2049,2058,2063,2070,2079,2075,2065,2054,2042,2039,2034,2023,2024,2025,2025,2035,2037,2037,2039,2038,2036,2038,2041,2037,2042,2054,2053,2042,2046,2052,2054,2062,2062,2058,2059,2061,2057,2057,2059,2064,2069,2063,2063,2065,2071,2076,2073,2075,2081,2078,2072,2065,2056,2059,2051,2049,2060,2053,2048,2040,2035,2040,2042,2042,2046,2055,2056,2063,2061,2056,2066,2057,2039,2035,2046,2055,2059,2059,2054,2049,2043,2048,2050,2046,2044,2039,2038,2038,2035,2038,2045,2045,2043,2040,2039,2029,2027,2035,2026,2024,2025,2021,2022,2029,2024,2011,2023,2030,2033,2038,2035,2042,2037,2032,2033,2034,2034,2026,2015,2015,2014,2004,2004,2004,2012,2025,2029,2032,2023,2017,2028,2021,2007,2021,2036,2036,2034,2031,2036,2039,2038,2040,2044,2043,2041,2040,2044,2049,2039,2033,2040,2040,2037,2034,2037,2048,2051,2051,2049,2045,2046,2046,2041,2043,2043,2044,2040,2038,2044,2043,2053,2054,2043,2048,2048,2045,2041,2028,2030,2043,2043,2044,2061,2073,2076,2077,2069,2061,2037,2016,2014,2014,2017,2021,2025,2032,2049,2061,2057,2052,2055,2067,2066,2052,2040,2032,2038,2040,2047,2059,2057,2064,2064,2052,2056,2058,2047,2041,2046,2053,2051,2048,2050,2056,2065,2064,2065,2058,2054,2057,2054,2050,2047,2051,2048,2052,2057,2048,2044,2053,2053,2043,2055,2058,2055,2061,2052,2052,2054,2053,2050,2046,2046,2044,2049,2057,2062,2056,2053,2054,2049,2049,2052,2051,2051,2059,2062,2065,2062,2060,2066,2070,2081,2083,2075,2078,2084,2074,2063,2058,2047,2040,2033,2034,2035,2042,2051,2050,2061,2061,2063,2058,2040,2029,2029,2045,2045,2042,2048,2055,2062,2067,2072,2070,2069,2072,2070,2054,2048,2053,2051,2055,2048,2042,2046,2039,2041,2056,2060,2053,2048,2038,2037,2034,2025,2025,2026,2021,2025,2029,2024,2030,2029,2026,2033,2027,2028,2028,2028,2041,2044,2028,2011,2006,2017,2035,2032,2026,2030,2027,2021,2022,2026,2023,2030,2029,2021,2028,2030,2031,2032,2028,2021,2016,2019,2023,2025,2023,2012,2012,2015,2015,2021,2022,2020,2018,2018,2022,2028,2031,2041,2043,2030,2033,2029,2027,2043,2037,2031,2033,2028,2033,2043,2039,2039,2049,2047,2055,2063,2052,2052,2048,2046,2060,2061,2067,2065,2055,2060,2052,2051,2049,2037,2035,2028,2031,2037,2026,2020,2035,2037,2035,2049,2041,2039,2047,2042,2033,2028,2036,2035,2041,2052,2060,2074,2067,2059,2072,2074,2061,2068,2074,2071,2079,2088,2089,2093,2096,2099,2107,2102,2106,2107,2107,2124,2111,2107,2112,2103,2098,2090,2090,2085,2076,2077,2078,2071,2068,2059,2045,2041,2030,2049,2069,2052,2041,2044,2023,2002,2029,2047,2028,2017,2041,2058,2044,2041,2032,2011,1989,1987,2002,2023,2048,2046,2041,2031,2021,2030,2026,2023,2035,2048,2038,2020,2013,2014,2031,2034,2028,2050,2055,2042,2045,2036,2037,2046,2045,2043,2038,2034,2025,2029,2023,2015,2036,2035,2051,2075,2032,1987,1993,1997,2021,2066,2029,1999,2024,2025,2034,2039,2036,2038,2016,1998,1978,1967,2008,2056,2047,2026,2023,2010,2014,2019,2012,2022,2014,2012,2025,2023,2035,2036,2023,2029,2031,2041,2041,2024,2015,2017,2038,2053,2066,2072,2063,2054,2041,2034,2043,2056,2052,2047,2050,2050,2061,2063,2059,2042,2013,2017,2022,2000,2002,2013,2016,2018,1995,1979,1980,1990,2009,2002,1990,2002,2009,2011,2020,2002,1989,2015,2037,2042,2033,2024,2016,2005,2015,2042,2074,2082,2044,2052,2077,2056,2068,2089,2102,2107,2053,2022,2057,2055,2043,2069,2056,2039,2013,2001,2031,1989,1958,1977,1970,2009,2069,2075,2072,2036,1960,1908,1919,1959,1923,1922,2009,2001,1925,1955,2014,1997,2013,2031,2056,2104,2123,2124,2065,2024,1990,1948,2034,2143,2120,2086,2075,2008,2007,2045,2073,2118,2159,2208,2201,2196,2207,2169,2164,2225,2245,2232,2241,2224,2224,2238,2266,2274,2258,2235,2172,2148,2166,2212,2205,2202,2253,2272,2302,2247,2147,2111,2117,2168,2241,2238,2157,2112,2116,2158,2142,2123,2139,2152,2154,2050,1984,1999,2050,2054,2022,2049,2028,1998,2001,1995,1972,1953,1897,1893,1964,1965,1926,1847,1850,1859,1832,1887,1886,1845,1825,1846,1840,1811,1759,1727,1785,1798,1783,1811,1915,1979,1930,1810,1750,1804,1830,1857,1844,1913,1959,1891,1951,1942,1834,1824,1933,2023,2011,1939,1887,1840,1788,1803,1756,1813,1922,1927,1997,2089,2121,2012,1918,1932,1979,1990,1984,2026,2068,2132,2102,2020,1970,1986,2029,2027,2049,2028,2056,2118,2161,2116,1999,1977,1964,2032,2147,2165,2119,2142,2174,2131,2175,2296,2330,2254,2288,2289,2206,2214,2220,2247,2240,2278,2269,2192,2228,2162,2011,1916,1868,1899,2012,2090,2164,2212,2238,2293,2240,2226,2163,2039,2049,2056,1991,1897,1897,1970,2042,2072,2181,2325,2320,2324,2315,2286,2272,2207,2096,1996,1978,2135,2348,2371,2417,2489,2477,2421,2270,2253,2337,2337,2361,2442,2542,2692,2597,2241,1941,1757,1940,2253,2358,2389,2292,2146,2056,1954,1811,1646,1608,1788,1884,1869,1972,1990,1923,1955,2006,1999,2033,2084,2155,2268,2163,1928,1768,1834,1987,1810,1576,1493,1579,1909,2073,2090,2153,1908,1606,1704,1860,1705,1482,1717,2009,1863,1670,1622,1729,1912,1929,1676,1524,1683,1814,1887,1930,1893,1881,1868,1811,1873,2009,2150,2204,2264,2377,2161,1965,1944,1938,2081,2149,2080,1997,2098,2369,2451,2371,2274,2217,2313,2362,2300,2247,2274,2384,2387,2370,2352,2315,2486,2713,2804,2713,2634,2767,2808,2638,2434,2307,2152,1988,2048,2321,2454,2293,2042,1858,1750,1699,1943,2216,2316,2236,2084,2199,2270,2387,2588,2600,2542,2457,2247,2055,2000,2023,1888,1600,1632,1817,1991,2100,2036,1859,1837,2014,2002,1962,1964,1876,1723,1600,1544,1537,1664,1914,1920,1682,1605,1574,1591,1650,1637,1578,1441,1324,1227,1190,1390,1582,1617,1607,1702,1705,1590,1708,1759,1797,1794,1818,1937,1916,2036,2192,1975,1459,1027,974,1515,1806,1937,2105,1750,1486,1475,1475,1241,1018,1093,1263,1125,1022,1176,1331,1640,1744,1810,2012,2170,2221,2545,2490,2019,2016,1949,2047,1937,1508,1145,1103,1884,2398,2296,2389,2303,1994,2227,2460,2219,1927,2119,2776,2750,2321,2492,2719,2712,2443,2310,2429,2303,2290,2254,2152,2178,2148,2012,2115,2435,2564,2571,2695,2756,2757,2929,3014,3127,2918,2792,2739,2596,2681,2517,2451,2379,2369,2361,2638,2791,2559,2341,2115,2269,2238,2388,2561,2664,2800,2806,2880,2996,3284,3363,3229,2910,2702,2485,2336,2411,2433,2060,1755,1968,2126,2067,1961,2050,1611,1524,1792,1782,1972,1965,2033,1893,1812,1872,1916,1997,2041,2099,1770,1269,1360,1525,1343,1663,1904,1998,2143,2021,1645,1311,1331,1483,1812,2088,1983,1517,1761,2213,2003,2084,2302,2174,1704,1131,1007,1271,1400,1521,1618,1411,1321,1502,1603,1619,1545,1535,1292,1268,1494,1272,1607,1876,1681,1463,1684,1943,1694,1922,2081,2039,1721,1633,1887,1692,1636,1814,1746,1831,2080,1917,2260,2567,2560,2651,2314,2011,1838,1556,1516,1770,1882,1842,1770,2069,2162,2176,2367,1959,1908,2490,2366,1774,1791,1875,1746,1669,2260,2193,1466,1728,1604,1644,2170,2376,2517,2672,2868,3008,2580,2273,2802,3172,3318,2950,2680,2672,2659,2670,2493,2559,2385,2139,1874,2144,2603,2561,2656,2661,2720,2951,3079,3063,3118,2777,2386,2413,2231,2091,2100,1992,1750,1699,1941,2177,2101,1854,1640,1697,1952,1883,1945,2045,2065,2172,2071,2089,2367,2515,2213,1934,1767,1523,1402,1229,1551,1773,1256,1300,1786,2060,2095,2277,2283,1879,2073,1976,1613,1512,1425,1354,1260,1609,1424,1230,1480,1450,1270,1263,1616,1459,1307,1490,2037,2639,2696,2477,1997,1849,1775,1711,2036,2518,2226,1545,2042,2512,2160,2184,2369,2193,2206,1989,2089,2424,2006,2043,2145,1933,1736,1553,1841,1994,1976,1916,1630,1452,1587,2020,2083,2023,1961,1579,2017,2398,2197,2360,2596,2479,1871,1881,1973,1379,1196,1585,1820,1685,1845,1985,1896,1999,2068,2051,2165,2182,2001,1909,1928,2075,2060,1947,2300,2413,2060,2237,2320,2111,1991,1999,2195,2119,2223,2358,2410,2139,1834,1852,1691,2127,2368,2164,2336,2448,2238,2237,2742,2931,2259,1768,2407,2582,2621,3051,2941,2948,2811,2835,3026,2912,3025,3100,3157,3262,3248,3341,3183,2961,2870,2656,2657,2623,2528,2461,2496,2419,2087,1938,2022,1971,1773,2316,2071,1302,1503,1513,1918,2218,1928,1706,1482,1350,1167,1363,1730,1879,1791,1690,1852,1632,1474,1639,1519,1462,1605,2009,2005,1689,1819,1880,2187,2306,1855,1644,1776,2066,2177,2037,1867,1588,1607,1794,1794,2083,1837,1784,2159,2069,2404,2512,2373,2304,2379,2338,2078,2512,2669,2456,2621,2332,1969,2107,1827,2077,2398,2225,2202,1738,1887,1881,1998,2287,1955,2091,1813,1800,2081,1841,1611,1621,1750,1597,1578,1664,1766,1680,1599,1662,1415,1435,1697,1619,1395,1492,1726,1634,1500,1467,1307,1293,1458,1264,827,727,812,756,981,1296,1097,1069,1057,919,1130,1318,1557,1373,1385,1553,1594,2021,1898,2016,1993,1809,1768,1456,1977,2485,2623,2467,2203,2278,2210,2257,2418,2283,2195,2163,2235,2396,2358,2695,2380,2100,2219,2004,2284,2317,2747,2812,2571,2825,2791,2733,2621,3126,3054,2837,3336,3435,3348,3235,3371,3348,3064,2653,2538,2378,2172,2570,2501,2686,3062,3033,2887,2611,2886,2719,2615,2799,2083,1739,2077,2479,2574,2463,2237,1924,1781,1727,1926,1872,1828,1743,1735,1873,1665,1936,2197,2257,2096,1836,2006,2141,2066,1662,1547,1634,1603,1635,1426,1499,1868,2042,2083,1795,1837,1825,1378,1399,1337,1626,1745,1784,2353,2369,2375,2260,2253,2084,2037,2390,2385,2572,2220,2101,2392,2406,2537,2147,2093,2601,2642,2542,2321,1978,1950,1876,2036,2343,2455,2641,2575,2529,2483,2534,2665,2352,2400,2438,2277,2478,2243,2242,2353,2053,2082,2102,1878,1591,1824,1918,1752,1959,2137,2482,2394,1999,2059,2233,2257,2272,2160,1927,1874,1890,1804,1761,2013,2001,1862,1847,1908,2034,1905,1827,1647,1534,1466,1255,1316,1526,1439,1390,1578,1531,1530,1500,1419,1423,1403,1337,1439,1482,1345,1523,1418,1376,1611,1583,1315,1136,1437,1708,1752,1868,2268,2291,2232,2334,1949,1963,2365,2646,2548,2645,3272,3054,2662,2662,2831,3104,2343,2022,2232,1700,1863,1928,1811,2322,2661,3009,2840,2375,2407,2388,2502,2785,2615,2352,2411,2245,2043,2323,2379,2196,2022,2039,2132,1906,1903,1787,1651,1543,1492,1517,1701,2362,2040,1632,1674,1496,1462,1520,1552,1333,1498,1420,1428,1603,1325,1548,1579,1332,1428,1521,1586,1750,1631,1579,1678,1803,1943,1686,1660,1782,1886,1726,1765,2175,2002,1893,1974,2071,2025,2004,2163,2038,1974,2065,2001,1984,2094,1979,1899,1823,1812,2100,2341,2560,2694,2681,2520,2379,2391,2504,2474,2156,2031,2025,2005,2103,2256,2089,1836,1965,1730,1778,2080,1795,1765,2096,2482,2274,2112,1974,1550,1909,2214,2412,2487,2260,1948,1962,2167,1870,2037,2088,1946,1992,2070,2434,2376,2020,1845,1768,1471,1355,1452,1420,1273,1231,1435,1333,1227,1266,1218,1273,1458,1618,1693,1534,1474,1560,1505,1667,1699,1693,1570,1602,1783,1583,1642,1808,2129,2405,2377,2139,1976,1867,1843,2232,2337,2772,2948,2572,2626,2560,2641,2539,2286,2338,2307,2370,2399,2326,2221,2305,2740,2887,2610,2436,2876,3321,3219,3300,3262,2888,2629,2470,2296,2158,2397,2555,2532,2542,2248,2134,2221,2215,2261,2213,2153,2023,2120,2158,1829,1846,1966,1945,1748,1782,2017,2070,2175,2170,2049,1852,2033,2025,1611,1810,2445,2895,2838,2373,2041,2045,2065,2390,2399,2253,2410,2049,2031,2373,2505,2477,2374,2256,2131,2157,2224,2377,2478,2505,2386,2430,2391,2191,2144,2084,2198,2006,1781,1744,1673,1789,2215,2477,2126,1954,1920,1820,1852,1828,1831,1947,2007,2167,2303,2064,1693,1332,1483,1788,1868,2150,2149,2005,1947,1678,1461,1278,1259,1526,1537,1630,1909,1809,1520,1425,1424,1284,1310,1367,1297,1237,1220,1351,1238,1119,1276,1191,1158,1232,1060,1069,1269,1477,1462,1361,1547,1722,1666,1493,1654,1798,1681,1774,2023,2142,2053,2000,2121,2126,1959,2227,2471,2297,2179,2191,2166,2018,2073,2026,2013,2067,1973,2127,2051,1820,1826,1838,1716,1687,1943,1819,1652,2184,2185,1800,1868,1874,2009,2152,2269,2294,2040,2001,2287,2166,1913,2189,1968,1545,1512,1626,1641,1498,1648,1707,1796,1906,1695,1483,1528,1584,1536,1581,1602,1636,1769,1844,1588,1464,1538,1368,1356,1463,1320,1386,1524,1458,1599,1518,1384,1273,1676,2429,2275,2011,1781,1740,1754,1699,1955,1950,2098,2142,1832,1711,1964,2130,1969,2007,1949,1649,1529,1847,2075,2063,2231,2127,2080,2242,2010,1936,2050,1905,1838,1966,2048,2051,2103,2126,2236,2161,2013,2188,2184,2225,2275,2273,2454,2399,2361,2329,2191,2372,2705,2825,2708,2632,2694,2821,2801,2727,2848,2664,2644,2809,2714,2794,2750,2834,2945,2875,2906,2903,2801,2733,2865,2779,2857,2979,2870,2847,2908,3195,3077,2819,2804,2664,2666,2962,3021,2886,2968,3051,3257,3106,2831,3044,3147,3164,3214,3090,2906,2876,3044,3266,3243,3185,3323,3402,3209,2898,2792,2678,2521,2387,2370,2431,2360,2191,2024,2092,2076,1902,1869,1970,2044,1946,1982,1901,1708,1763,1791,1807,1780,1763,1692,1685,1833,1820,1859,1803,1733,1762,1734,1689,1605,1567,1503,1438,1479,1799,1896,1919,1984,1608,1435,1638,1903,1828,1761,1743,1714,2033,2092,1939,1893,1971,1655,1396,1662,1684,1513,1402,1492,1638,1782,1880,1989,1891,1558,1515,1689,1761,1732,1851,1697,1574,1509,1522,1750,1563,1460,1475,1527,1394,1286,1378,1232,1325,1482,1461,1369,1431,1420,1370,1445,1367,1452,1481,1336,1377,1567,1548,1613,1759,1706,1733,1657,1724,1959,1989,1954,1991,2050,2131,2097,2067,2227,2210,2414,2703,2526,2365,2354,2576,2888,2850,2641,2592,2746,2741,2688,2896,3014,2973,2862,3043,3282,3063,2926,2894,2949,2964,2926,3030,2787,2767,3040,2910,2821,2877,2861,2751,2701,2746,2510,2273,2242,2266,2309,2243,2209,2305,2449,2341,2216,2220,2044,2157,2347,2250,2182,2120,2203,2440,2447,2189,2045,2087,2096,1969,1885,1837,1664,1589,1407,1460,1768,1615,1532,1579,1597,1623,1585,1672,1608,1464,1398,1282,1091,1054,1153,1155,1170,1160,1139,1106,1172,1433,1643,1455,1147,1070,924,832,812,969,1293,1381,1442,1668,1675,1447,1381,1310,1259,1255,1378,1664,1743,1601,1630,2081,2129,1821,1645,1552,1416,1242,1704,2060,1790,1550,1719,2105,2260,2215,1937,1740,1667,1679,1978,2139,1808,1559,1507,1539,1848,1799,1903,2173,2164,2125,1853,1879,1766,1489,1594,1720,1784,1816,1962,2031,2156,2354,2237,1889,1812,2127,2303,2205,2101,2198,2200,2170,2263,2425,2551,2483,2446,2416,2359,2183,2223,2293,2145,2027,2013,2259,2143,2089,2075,1962,2053,1999,2171,2142,1956,1889,1967,2036,1882,1821,1773,1831,1668,1694,2157,2316,1991,1738,1669,1465,1658,1858,1755,1762,1866,1763,1633,1607,1448,1239,914,1021,1233,1458,1666,1452,1398,1392,1390,1362,1526,1527,1322,1337,1492,1834,1727,1467,1222,1133,1310,1629,1966,1767,1540,1488,1739,1929,1671,1551,1834,1868,1595,1694,1599,1439,1499,1808,2123,2109,2041,1762,1537,1377,1270,1415,1683,1576,1240,1056,1204,1873,2228,2370,2276,1877,1557,1349,1215,1189,1651,1838,2007,2478,2739,2650,2122,1892,1974,2012,1979,2051,2276,2316,2293,2841,3281,2792,2376,2356,2218,1829,2074,2696,2735,2507,2343,2729,3097,3246,3181,2751,2602,2486,2592,3058,2958,2387,2262,2642,2944,2788,2937,3287,3187,3145,2883,2782,2733,2390,2442,2705,2922,2968,3052,3102,3113,3254,3225,2767,2392,2774,3066,2954,2703,2485,2542,2696,2921,3044,3096,3144,3179,3164,3027,2713,2506,2584,2611,2556,2752,3148,3087,2839,2604,2575,2637,2582,2836,2712,2541,2485,2536,2741,2725,2756,2592,2744,2685,2315,2562,2728,2345,1992,2225,2424,2515,2607,2389,2411,2677,2714,2905,2713,2190,2296,2073,2015,2358,2387,2605,2624,2359,2478,2697,2404,2460,2670,2372,2128,2349,2719,2695,2491,1893,1715,2006,2307,2641,2330,2007,2040,2453,2446,1915,1801,1968,2040,1783,1603,1382,1364,1775,2119,2393,2400,1939,1685,1746,1598,1479,1284,1182,1146,1070,1114,1320,1656,1804,1922,1752,1693,1584,1200,1275,1342,1209,1218,1472,1523,1492,1380,1141,1397,1873,2070,1631,1136,1191,1534,1701,1610,1668,1520,1135,1149,1283,1093,1147,1328,1253,1277,1303,1336,1447,1560,1515,1228,1014,1031,1127,1158,1132,1148,1289,1420,1482,1593,1653,1518,1337,1183,1095,1158,1197,1230,1356,1428,1368,1380,1406,1494,1785,1651,1292,1161,1286,1745,1617,1216,1249,1119,1200,1553,1687,1852,1955,1872,1811,1742,1598,1505,1442,1566,1850,2062,2353,2388,2038,1720,1739,1926,1841,1667,1424,1467,1870,2098,2253,2320,2313,2258,2385,2630,2551,2202,1997,2003,1803,1885,2148,2170,2218,2215,2233,2464,2829,2607,1939,1835,2447,2806,2472,2052,1693,1504,1733,2212,2418,2554,2555,2490,2668,2717,2752,2576,2422,2297,2159,2178,2254,2350,2258,2210,2163,2288,2266,2320,2309,2040,2177,2106,2066,2076,2090,1993,1860,1826,1700,1932,1986,1928,1857,1921,1967,1784,1718,1595,1486,1465,1707,1898,1957,1805,1794,1746,1552,1733,1669,1681,1734,1802,1773,1685,1781,1824,1972,2028,2175,2176,2245,2111,2009,2359,2324,2201,1952,1677,1446,1485,1909,2044,1767,1694,1833,1611,1453,1474,1605,1595,1658,1628,1450,1730,1862,1951,1956,1894,1841,1728,1743,1731,1871,1971,2050,2025,1962,2084,2176,2254,2308,2246,2176,2164,2168,2259,2236,2288,2410,2382,2351,2303,2342,2404,2394,2384,2450,2497,2493,2433,2465,2530,2427,2375,2300,2282,2361,2468,2543,2470,2425,2446,2480,2448,2413,2518,2609,2577,2546,2534,2603,2630,2685,2831,2756,2723,2830,2762,2583,2656,2727,2729,2722,2577,2673,2626,2511,2492,2427,2495,2456,2454,2324,2069,2058,2428,2958,2904,2533,2545,2476,2142,2212,2396,2298,2245,2423,2623,2820,3091,2933,2477,2304,2411,2445,2520,2622,2577,2617,2437,2461,2627,2540,2545,2352,2275,2199,2046,1995,1809,1813,1688,1380,1335,1352,1341,1395,1514,1772,1880,1673,1312,1064,944,668,817,1100,1021,951,1196,1378,1050,1142,1343,1296,1178,1052,1044,1045,1347,1376,1430,1460,1301,1316,1310,1443,1394,1497,1629,1685,1837,1638,1285,1174,1367,1473,1448,1553,1794,1624,1239,1189,1368,1608,1758,1621,1374,1703,2058,2169,2011,1877,2076,1920,1706,1626,1781,1873,2076,2375,2297,2438,2420,2139,2112,2442,2527,2446,2594,2579,2628,2625,2610,2723,2740,2639,2532,2554,2601,2635,2581,2500,2562,2497,2374,2478,2467,2456,2466,2383,2406,2399,2389,2303,2295,2404,2342,2277,2345,2399,2434,2478,2469,2373,2284,2308,2242,2175,2170,2141,2173,2242,2203,2101,2125,2142,2218,2248,2149,2112,2063,1932,1963,2129,2167,2197,2160,2072,1968,2067,2179,2177,2200,2144,2243,2014,1979,2286,2117,1923,2005,2121,2240,2610,2630,2320,2246,2403,2669,2723,2486,2392,2666,2445,2311,2583,2544,2745,2909,2732,2468,2278,2299,2143,2123,2458,2323,2083,2045,1902,1773,1680,2069,2532,2598,2246,2004,2113,1810,1800,2101,1941,1678,2136,2789,2444,2024,2029,2024,2045,2085,2037,1979,2109,2137,2361,2585,2265,2117,2199,2213,2211,2183,2209,2265,2411,2408,2382,2432,2359,2497,2551,2414,2509,2606,2546,2536,2648,2682,2683,2649,2542,2883,3120,2749,2593,2635,2736,2905,2820,2688,2726,2644,2672,3076,3263,3424,3425,2858,2609,2987,3135,2975,3015,2942,2948,3066,3110,3210,3150,3082,3000,2955,3046,3111,2969,2883,3042,2982,2804,2754,2682,2591,2506,2380,2358,2361,2376,2315,2168,2275,2248,2090,2047,2005,1930,1892,1930,1789,1745,1829,1767,1697,1615,1577,1565,1481,1470,1437,1316,1220,1182,1244,1277,1244,1139,1131,1146,1136,1288,1191,1041,963,920,1215,1520,1618,1388,1163,1068,956,1411,1826,1669,1440,1180,1055,1081,1317,1545,1510,1565,1721,1889,1807,1713,1861,1995,1976,1769,1778,1809,1702,1670,1591,1557,1587,1611,1636,1656,1597,1462,1412,1464,1400,1266,1222,1262,1279,1108,1028,1184,1232,1059,914,932,1047,1145,1180,1132,1055,1137,1151,1119,1195,1199,1123,1010,1020,1091,1113,1144,1111,1083,1152,1082,1010,1105,1035,1024,1215,1325,1373,1384,1445,1495,1525,1628,1627,1619,1689,1767,1881,1966,1996,2002,2059,2060,2106,2178,2137,2181,2223,2272,2290,2304,2354,2338,2351,2320,2286,2309,2309,2276,2265,2270,2299,2291,2259,2292,2315,2293,2204,2250,2310,2225,2255,2308,2292,2275,2208,2183,2189,2062,1987,1950,1952,1990,1923,1967,1930,1894,2007,1951,1902,1956,1912,1870,1855,1818,1862,1913,1942,1910,1884,1866,1835,1895,1873,1892,1913,1873,1895,1856,1792,1737,1704,1720,1735,1725,1718,1695,1688,1760,1793,1744,1715,1679,1659,1695,1680,1681,1684,1722,1785,1807,1845,1825,1837,1848,1871,1943,1975,1994,2013,2044,2152,2267,2250,2326,2360,2331,2392,2413,2473,2395,2382,2506,2538,2581,2518,2469,2528,2552,2587,2643,2709,2745,2768,2815,2813,2876,2887,2799,2849,2868,2885,2955,2985,3070,3149,3194,3209,3199,3222,3252,3287,3370,3346,3292,3394,3380,3322,3356,3309,3158,3011,3017,3063,3075,3044,3025,3042,2967,2979,3082,3092,3092,3076,2974,2968,2991,2940,2961,2974,2955,2901,2882,2861,2794,2791,2713,2656,2648,2551,2487,2480,2432,2400,2398,2376,2438,2461,2344,2250,2175,2066,2023,1977,1912,1913,1881,1856,1801,1781,1821,1737,1664,1647,1584,1438,1364,1346,1294,1275,1191,1104,1119,1151,1031,884,927,989,923,836,810,784,770,703,713,803,794,799,758,771,839,838,869,884,878,849,840,874,891,896,914,911,819,725,766,829,811,804,797,803,828,850,844,760,733,791,869,930,921,914,908,885,865,848,1008,1195,1209,1245,1262,1293,1353,1440,1587,1631,1625,1630,1691,1729,1820,1950,1878,1849,1935,2002,1944,1935,2079,2118,2196,2216,2079,2029,2025,2054,2146,2158,2214,2257,2125,2166,2282,2281,2326,2348,2332,2375,2467,2586,2678,2733,2787,2722,2694,2738,2749,2823,2851,2844,2697,2568,2670,2716,2654,2657,2647,2389,2219,2313,2406,2502,2556,2579,2644,2718,2802,2803,2707,2766,2773,2654,2689,2698,2708,2698,2689,2759,2752,2735,2686,2644,2669,2675,2605,2536,2524,2530,2579,2571,2544,2497,2362,2364,2461,2474,2508,2541,2562,2538,2471,2473,2429,2382,2343,2274,2234,2191,2183,2239,2303,2253,2255,2206,2074,2158,2190,2067,1981,1977,1942,1853,1872,1943,1936,1907,1928,1904,1884,1873,1891,1932,1945,2016,2037,2013,2015,2079,2137,2177,2263,2310,2359,2318,2296,2417,2518,2589,2525,2389,2347,2279,2209,2201,2263,2319,2211,2200,2262,2228,2196,2182,2189,2109,2133,2154,2124,2093,1926,1937,2013,2112,2203,2175,2112,2074,2221,2325,2423,2495,2480,2524,2495,2440,2405,2445,2570,2607,2566,2634,2666,2580,2598,2769,2889,2842,2763,2598,2493,2388,2341,2585,2649,2466,2318,2321,2289,2206,2164,2109,2150,2120,2098,2254,2572,2825,2878,2760,2550,2530,2479,2348,2260,2291,2411,2515,2710,2938,3152,2992,2632,2456,2220,1854,1765,2066,2203,2394,2740,2895,2814,2574,2442,2316,2242,2431,2653,2381,2051,2352,2712,2789,2722,2640,2585,2593,2586,2443,2455,2532,2481,2490,2425,2157,2069,2306,2573,2553,2336,2232,2234,2309,2460,2576,2299,1952,1908,1920,2007,2027,2128,2092,1916,1949,1818,1815,1871,1676,1479,1647,2022,1956,1674,1347,1201,1317,1498,1791,1744,1548,1504,1500,1582,1537,1369,1265,1272,1290,1393,1724,1869,1674,1456,1313,1346,1471,1616,1915,2132,1975,1653,1518,1476,1589,1826,1935,2044,1952,1746,1832,2144,2233,1884,1518,1351,1574,1813,1832,2030,2038,1709,1373,1408,1500,1292,1320,1543,1592,1447,1373,1230,1056,1197,1221,1126,1079,1005,1051,1225,1222,1078,1074,949,838,962,1108,1104,1141,1346,1499,1634,1563,1339,1191,1182,1010,760,1137,1435,1243,1064,1150,1326,1298,1252,1030,888,768,679,1063,1326,1320,1266,1238,1170,1102,1186,1052,900,1082,1355,1568,1773,2039,2198,1969,1625,1483,1375,1161,1145,1482,1626,1781,2108,2368,2469,2080,1811,1684,1471,1594,2023,2224,1783,1786,2353,2646,2692,2511,2290,2208,2385,2402,2344,2484,2557,2763,2777,2464,2092,2079,2676,3057,2800,2578,2594,2350,2427,2845,2773,2601,2520,2424,2535,2764,2728,2626,2807,3035,3277,3156,2769,2708,2551,2352,2674,3141,3263,3088,2749,2579,2826,3048,2989,2930,2851,2830,3015,3123,3016,2681,2437,2422,2438,2710,3146,3429,3257,2857,2676,2424,2262,2397,2847,3397,3298,2850,2564,2241,2172,2711,3185,3086,2947,2842,2759,2977,3085,2889,2459,2133,2405,2748,2799,2852,2855,2633,2381,2368,2293,2234,2419,2328,2178,2320,2341,2248,2205,2147,2021,1954,1845,1715,1931,1997,1942,1964,1751,1748,1833,1752,1507,1435,1714,1928,2246,2341,2216,1932,1621,1774,1687,1491,1545,1797,2149,2226,2272,2298,2292,2094,1728,1527,1437,1493,1631,1797,1930,1973,1883,1759,1713,1742,1799,1795,1682,1455,1636,1973,2183,2332,2080,1914,1869,1930,2101,2113,2034,1841,1894,2193,2554,2471,1967,1849,1832,1677,1650,1749,1802,1925,2065,2128,2091,1813,1736,1933,1974,1779,1847,1933,1733,1686,1664,1811,1768,1678,1974,2045,1845,1557,1426,1335,1510,1804,1838,2026,1912,1680,1792,1871,1653,1571,1698,1688,1936,1898,1671,1885,1957,1731,1608,1756,1936,1950,1656,1663,1796,1575,1648,1766,1883,1945,1804,1738,1659,1549,1530,1793,1976,2074,2057,1875,1854,1684,1564,1459,1226,1311,1689,1911,1830,1792,1717,1639,1885,2101,1922,1772,1661,1413,1268,1179,1364,1378,1198,1592,1968,1787,1488,1319,1001,981,1089,937,1435,1872,1521,1086,1018,1284,1495,1588,1434,1305,1314,1245,1457,1661,1612,1550,1515,1557,1615,1590,1479,1353,1336,1342,1155,1158,1565,1866,1943,1909,1855,1818,1698,1573,1642,1823,2026,2306,2224,2040,2092,1967,1817,1561,1306,1192,1313,1899,2374,2582,2585,2463,2187,1906,1968,1862,1625,1564,1985,2530,2501,2240,1970,2128,2480,2631,2699,2604,2521,2293,2324,2731,2851,2558,2233,2261,2322,2385,2570,2562,2452,2597,2650,2408,2412,2501,2487,2658,2837,2697,2548,2485,2425,2540,2471,2407,2498,2699,2899,2814,2778,2560,2392,2568,2784,2817,2509,2478,2690,2702,2722,3015,3100,2885,2938,2767,2499,2426,2444,2720,2876,2812,2660,2657,2850,2895,2796,3054,3454,3248,2872,2658,2601,2777,2903,2921,2824,2838,2978,2836,2661,2741,2783,2834,2907,2934,3013,2861,2577,2434,2483,2644,2840,3031,3081,3131,2978,2646,2421,2257,2240,2289,2385,2513,2742,2765,2345,2231,2374,2426,2461,2247,1869,1533,1421,1656,2162,2529,2257,1714,1466,1625,2014,2242,2156,1885,1787,1857,2012,2170,1988,1882,1915,1831,1770,1711,1693,1521,1529,1675,1581,1721,1851,1813,1730,1607,1691,1784,1783,1601,1454,1473,1502,1755,1809,1722,1734,1699,1870,1751,1453,1417,1450,1579,1698,1753,1662,1911,2059,1472,1238,1217,1052,1037,1168,1572,1725,1402,1137,1332,1655,1750,1554,1295,1312,1242,1327,1512,1336,1232,1252,1242,1034,866,1164,1464,1630,1812,1663,1424,1462,1459,1408,1599,1979,1990,1632,1551,1701,1649,1529,1566,1643,2210,2507,1980,1889,1853,1800,2082,2353,2513,2078,1792,2007,2201,2347,2387,2513,2662,2747,2653,2466,2402,2346,2170,2021,2193,2346,2479,2622,2554,2627,2800,2808,2680,2535,2269,2172,2521,2774,2700,2399,2267,2379,2515,2578,2331,2382,2631,2535,2542,2528,2467,2345,2214,2434,2394,2392,2657,2454,2485,2749,2493,2108,1860,1909,2205,2474,2740,2906,2628,2186,2284,2342,2284,2429,2119,1917,1883,1740,2114,2643,2814,2496,2158,1974,1933,2257,2407,2514,2506,2428,2682,2777,2686,2499,2303,2206,2161,2038,2002,2275,2321,2243,2202,2161,2205,2269,2424,2385,2250,2027,1698,1684,1927,2143,2202,2245,2392,2375,2073,2012,2123,2156,2286,2134,1854,1853,1957,1964,1969,1950,2082,2371,2044,1716,1861,1981,2102,1926,1749,1937,2161,2144,2000,1917,1764,1682,1754,1866,1969,2032,1987,1798,1706,1960,2194,2064,2114,2159,1942,1919,1899,1838,1963,2125,2005,1892,2010,1954,1908,1913,1924,2053,1924,1736,1770,1913,2154,2117,1850,1745,1712,1694,1740,1808,1750,1766,1820,1690,1661,1657,1696,1697,1614,1681,1673,1644,1563,1592,1788,1739,1695,1731,1697,1554,1411,1482,1567,1511,1507,1677,1722,1629,1627,1602,1559,1478,1375,1440,1684,1999,2067,1850,1810,1835,1749,1663,1554,1484,1310,1442,1848,1975,2152,2142,2008,2022,1830,1590,1387,1399,1638,1771,1769,1669,1405,1162,1436,1605,1392,1472,1422,1319,1472,1446,1473,1554,1515,1492,1354,1316,1334,1230,1281,1292,1302,1362,1348,1469,1468,1346,1257,1341,1629,1669,1759,1838,1687,1600,1425,1329,1271,1301,1513,1604,1741,1867,1881,1643,1470,1765,1877,1817,1857,1956,2050,1957,1998,2134,2114,2076,2016,2013,2140,2225,2363,2426,2354,2553,2580,2312,2238,2262,2269,2200,2155,2162,2196,2189,2170,2257,2199,2110,2175,2264,2243,2309,2545,2575,2489,2483,2458,2327,2385,2508,2333,2266,2278,2271,2391,2575,2576,2413,2501,2554,2483,2385,2310,2428,2455,2478,2450,2461,2681,2674,2645,2732,2659,2550,2473,2451,2372,2252,2328,2381,2449,2546,2462,2443,2449,2409,2359,2274,2182,2045,2105,2249,2253,2230,2102,1983,2007,2119,2235,2211,2168,2135,2016,1947,1933,1986,2028,2039,2128,2100,1958,1817,1899,2079,1986,1981,2108,2132,2091,1973,1939,1992,2001,2065,2122,2010,1953,1938,1818,1742,1799,1885,1842,1841,1919,2040,2088,1958,1938,1945,1862,1784,1823,1924,1979,2069,2078,2126,2204,2196,2055,1793,1857,2045,2045,2075,2082,2135,2164,2036,2062,2099,2057,2119,2126,2147,2107,2045,2177,2309,2275,2134,2151,2200,2163,2109,2066,2091,2121,2234,2168,2061,2151,2198,2300,2328,2278,2291,2319,2354,2378,2398,2390,2366,2368,2443,2502,2539,2571,2598,2597,2487,2467,2534,2613,2613,2588,2687,2705,2561,2381,2361,2357,2281,2270,2284,2420,2647,2841,2924,2822,2633,2601,2655,2657,2750,2767,2609,2433,2335,2305,2435,2623,2528,2479,2559,2546,2529,2428,2458,2586,2572,2545,2453,2549,2732,2725,2816,2824,2785,2700,2586,2636,2614,2584,2367,2325,2581,2578,2531,2401,2355,2344,2205,2198,2118,2012,1898,1759,1896,2086,1951,1877,2053,2169,2092,1901,1784,1667,1691,1767,1859,2057,2016,1958,1971,1909,1716,1654,1887,1987,2020,2076,2092,1975,1778,1726,1734,1773,1802,1789,1787,1845,1805,1720,1768,1762,1676,1624,1630,1580,1554,1594,1629,1714,1628,1507,1570,1594,1600,1660,1761,1882,1905,1940,1968,1909,1816,1719,1809,1941,2068,2110,2005,2025,1956,1914,1964,1974,2002,1962,1988,2015,1954,1888,1952,2018,1988,2003,1870,1700,1646,1669,1740,1739,1772,1844,1699,1611,1791,1991,2113,1899,1732,1789,1807,1996,2023,1953,1943,1968,2151,2265,2362,2331,2235,2263,2228,2195,2230,2349,2534,2549,2511,2545,2416,2254,2119,2065,2144,2113,2123,2276,2374,2305,2240,2240,2205,2255,2486,2618,2444,2430,2479,2325,2364,2495,2426,2199,1973,2025,2306,2377,2385,2458,2437,2392,2337,2408,2387,2292,2278,2273,2393,2459,2451,2365,2326,2448,2453,2464,2533,2408,2266,2355,2516,2525,2351,2269,2272,2196,2171,2170,2185,2135,2045,2089,2187,2074,1903,1978,2004,2003,2104,2095,1954,1954,2098,2135,2221,2242,2146,1996,1840,1937,2176,2259,2093,2183,2476,2305,2043,2134,2220,2184,2120,2058,2168,2248,2323,2317,2150,2249,2290,2082,1923,1926,1936,1766,1650,1678,1782,1857,1827,1730,1716,1802,1864,1884,1758,1648,1682,1761,1841,1877,1849,1825,1921,2050,2058,1936,1918,1923,1777,1697,1716,1795,1830,1789,1842,1831,1623,1461,1444,1593,1701,1516,1329,1313,1440,1555,1601,1533,1214,1019,1164,1475,1589,1483,1327,1159,1159,1217,1430,1537,1313,1225,1301,1462,1553,1462,1376,1317,1305,1443,1550,1416,1263,1309,1403,1364,1352,1277,1115,1147,1247,1239,1130,1099,1117,1102,1078,1038,1070,975,985,1192,1266,1344,1319,1232,1262,1294,1333,1312,1239,1202,1220,1263,1261,1322,1347,1249,1263,1315,1286,1273,1307,1379,1403,1385,1442,1498,1519,1565,1545,1498,1457,1483,1668,1747,1685,1606,1536,1530,1477,1418,1451,1511,1604,1689,1640,1607,1674,1626,1507,1490,1467,1496,1615,1607,1654,1699,1562,1514,1515,1523,1583,1680,1750,1700,1688,1774,1985,2013,1729,1730,1827,1638,1578,1826,2087,2051,1786,1596,1663,1912,2058,2011,1821,1809,1863,1596,1532,1741,1818,1742,1603,1704,1839,1838,1904,1827,1722,1891,2097,2065,1881,1861,2009,2173,2326,2312,2247,2264,2419,2588,2494,2389,2412,2500,2510,2419,2396,2436,2610,2746,2829,2845,2655,2458,2430,2607,2640,2482,2476,2608,2719,2666,2557,2518,2428,2443,2708,2912,3000,2887,2539,2373,2495,2729,2838,2833,2882,2897,2769,2711,2811,2717,2606,2625,2676,2853,2878,2713,2560,2536,2675,2793,2775,2696,2642,2648,2710,2767,2821,2761,2620,2574,2540,2587,2680,2731,2859,2901,2862,2888,2851,2837,2868,2834,2763,2722,2706,2667,2805,2910,2860,2898,2870,2893,2941,2897,2832,2796,2931,2863,2645,2656,2664,2661,2812,2988,2971,2786,2675,2786,2934,2929,2916,2854,2735,2756,2782,2798,2880,2880,2833,2759,2732,2789,2762,2618,2488,2549,2630,2634,2649,2608,2529,2401,2423,2475,2452,2563,2547,2535,2523,2423,2565,2715,2782,2738,2565,2471,2324,2306,2525,2628,2577,2544,2452,2372,2520,2630,2568,2467,2367,2337,2294,2261,2245,2194,2205,2238,2235,2180,2128,2115,2036,1951,2027,2239,2225,1989,2052,2242,2252,2260,2331,2444,2460,2464,2427,2249,2286,2362,2238,2161,2177,2204,2181,2140,2172,2214,2170,2063,1928,1888,1965,1970,1858,1695,1634,1672,1636,1555,1558,1603,1629,1688,1736,1784,1825,1763,1651,1585,1674,1861,1900,1854,1936,1917,1757,1777,1885,1822,1645,1595,1697,1833,1851,1700,1523,1454,1533,1576,1583,1669,1691,1567,1506,1649,1758,1699,1554,1505,1586,1679,1854,2020,2002,1837,1805,1909,1924,1952,1968,1925,1942,2020,2092,2118,2063,1947,1902,1901,1859,1925,2047,1967,1851,1884,1922,1885,1832,1797,1677,1583,1627,1682,1659,1516,1422,1533,1702,1708,1658,1703,1784,1908,2019,2066,1987,1857,1767,1841,2126,2110,1897,1783,1683,1770,1896,1960,1937,1826,1769,1645,1611,1734,1804,1804,1701,1669,1647,1538,1608,1636,1560,1520,1465,1455,1420,1474,1539,1508,1528,1508,1541,1631,1650,1606,1528,1517,1554,1567,1519,1515,1507,1458,1540,1581,1525,1480,1444,1517,1537,1403,1425,1585,1591,1497,1472,1500,1472,1486,1592,1682,1756,1779,1737,1642,1668,1731,1629,1639,1727,1768,1729,1592,1562,1521,1497,1654,1719,1593,1508,1616,1712,1610,1578,1643,1594,1506,1539,1612,1623,1687,1626,1554,1575,1417,1408,1577,1671,1703,1695,1680,1601,1586,1580,1586,1720,1826,1925,1957,1955,2075,2147,2037,1878,1841,1857,1938,2047,1913,1747,1760,1821,1865,1859,1963,1978,1724,1662,1760,1792,1846,1773,1604,1616,1785,1924,2032,2016,1998,2141,2183,2156,2148,2196,2239,2189,2180,2152,2127,2070,2057,2062,2009,2114,2209,2258,2296,2231,2193,2176,2132,2127,2120,2088,2136,2208,2294,2319,2210,2202,2316,2339,2279,2253,2201,2155,2162,2198,2250,2274,2259,2183,2162,2151,2163,2247,2166,2127,2233,2151,2037,2103,2112,2000,1862,1739,1744,1743,1745,1780,1716,1749,1811,1820,1854,1902,2008,2064,2061,2020,2043,2099,2134,2241,2216,2168,2199,2178,2133,2088,2033,1907,1875,1950,1958,1924,1881,1886,1875,1918,2059,2091,2102,2056,1967,2053,2114,2139,2180,2187,2174,2114,2086,2159,2325,2277,2099,2113,2256,2374,2346,2363,2416,2473,2616,2680,2661,2564,2447,2374,2332,2394,2438,2411,2429,2433,2423,2474,2557,2581,2577,2593,2550,2546,2551,2521,2451,2325,2348,2442,2554,2637,2615,2637,2666,2769,2923,3050,3178,3128,3014,2936,2841,2763,2650,2548,2527,2528,2517,2631,2714,2712,2754,2635,2500,2483,2518,2555,2591,2632,2566,2567,2590,2593,2597,2486,2390,2386,2496,2680,2728,2604,2554,2560,2592,2660,2620,2545,2492,2545,2686,2780,2776,2749,2716,2631,2681,2804,2865,2828,2683,2591,2634,2763,2849,2868,2765,2639,2701,2756,2726,2620,2453,2384,2406,2423,2298,2196,2148,2043,1991,1862,1796,1827,1790,1737,1652,1667,1689,1569,1495,1490,1442,1407,1382,1355,1348,1351,1352,1339,1403,1482,1602,1705,1688,1789,1938,1994,2055,2103,2153,2255,2266,2223,2219,2188,2211,2182,2085,2086,2085,2060,2077,2066,2086,2083,1986,2050,2212,2210,2121,2143,2194,2183,2266,2365,2365,2304,2224,2259,2395,2438,2408,2289,2113,2100,2256,2474,2567,2531,2421,2369,2503,2556,2498,2442,2379,2311,2226,2207,2235,2226,2220,2186,2100,2064,2008,1972,2061,2146,2199,2198,2141,2039,1843,1776,1819,1831,1837,1833,1875,1746,1640,1765,1916,2044,2096,2094,1958,1865,1856,1810,1785,1687,1606,1584,1687,1796,1831,1904,1890,1826,1812,1925,2058,2052,1946,1889,1924,1909,1838,1746,1666,1622,1573,1482,1458,1597,1748,1754,1691,1569,1435,1530,1584,1446,1375,1382,1478,1559,1554,1470,1380,1526,1726,1772,1749,1726,1636,1487,1588,1765,1832,1882,1818,1754,1724,1770,1826,1733,1614,1574,1667,1816,1821,1636,1454,1391,1445,1400,1288,1332,1298,1254,1311,1340,1325,1231,1094,1037,1135,1199,1120,978,942,1082,1187,1160,1139,1192,1194,1121,1176,1322,1368,1399,1355,1293,1362,1434,1503,1554,1563,1531,1541,1631,1659,1657,1641,1610,1642,1633,1603,1660,1602,1542,1648,1810,1897,1832,1812,1819,1845,1886,1876,1947,1931,1862,1968,2094,2061,1952,1971,2062,2138,2269,2315,2271,2252,2119,1996,2067,2126,2056,1895,1827,1943,2003,2037,1998,1802,1685,1695,1818,1852,1759,1695,1682,1769,1846,1867,1860,1847,1815,1814,1840,1765,1697,1674,1634,1600,1537,1481,1568,1677,1690,1634,1620,1683,1653,1671,1728,1783,1903,1920,1873,1790,1745,1813,1932,2033,2112,2207,2240,2208,2110,2067,2155,2172,2089,2008,2032,2109,2160,2222,2191,2092,2009,1955,1954,1957,1979,2001,1952,1897,1891,1862,1939,2058,1971,1842,1871,2003,2087,2157,2233,2235,2169,2148,2234,2264,2290,2353,2395,2405,2385,2444,2567,2641,2631,2606,2620,2710,2785,2797,2771,2767,2797,2724,2646,2574,2495,2504,2704,2890,2830,2753,2681,2685,2769,2782,2674,2498,2459,2571,2753,2809,2728,2652,2554,2440,2487,2697,2776,2715,2627,2492,2418,2547,2646,2665,2764,2727,2644,2655,2667,2749,2746,2580,2555,2580,2471,2441,2480,2416,2366,2452,2453,2383,2446,2514,2503,2405,2326,2330,2273,2299,2430,2473,2496,2477,2464,2511,2563,2598,2599,2587,2575,2612,2590,2580,2602,2564,2576,2575,2614,2648,2654,2667,2607,2605,2683,2801,2809,2685,2724,2849,2843,2835,2819,2732,2631,2611,2695,2714,2754,2784,2749,2714,2630,2645,2682,2702,2714,2637,2583,2555,2567,2578,2571,2640,2632,2590,2609,2609,2632,2606,2584,2560,2498,2527,2494,2410,2355,2279,2260,2293,2310,2268,2235,2224,2246,2376,2468,2461,2403,2276,2201,2151,2086,2118,2159,2098,2062,2094,2127,2182,2149,2137,2183,2148,2169,2152,2138,2179,2095,1985,1956,1964,1924,1899,1906,1841,1783,1788,1819,1879,1850,1732,1713,1734,1717,1723,1733,1744,1768,1779,1775,1737,1709,1664,1564,1547,1530,1514,1512,1443,1435,1397,1352,1368,1297,1218,1186,1147,1158,1199,1160,1067,1024,1047,1060,1049,1020,993,1007,1022,1045,1045,1028,980,955,1039,1068,1096,1131,1063,987,982,1050,1087,1097,1088,1041,943,889,1009,1041,939,905,912,917,940,978,983,998,1058,1120,1220,1313,1312,1357,1381,1355,1374,1369,1424,1449,1504,1551,1487,1480,1488,1549,1612,1651,1657,1652,1658,1653,1736,1765,1777,1746,1734,1832,1894,1920,1810,1702,1662,1655,1788,1894,1849,1833,1920,1957,1947,1978,2110,2234,2253,2306,2407,2407,2351,2358,2329,2310,2351,2362,2341,2296,2272,2358,2466,2447,2390,2351,2312,2261,2232,2281,2267,2184,2182,2133,2093,2234,2295,2252,2238,2272,2319,2345,2405,2396,2349,2362,2448,2444,2353,2422,2528,2522,2463,2401,2370,2395,2443,2490,2424,2353,2337,2290,2308,2247,2254,2245,2176,2249,2176,2073,2068,2147,2185,2141,2100,2074,2159,2154,2107,2156,2272,2330,2341,2368,2357,2425,2388,2273,2256,2265,2231,2241,2332,2303,2232,2199,2178,2145,2140,2164,2197,2172,2040,2024,2073,2143,2130,2033,2012,2015,2068,2082,2076,2065,2045,2094,2197,2238,2243,2343,2354,2297,2268,2305,2373,2399,2440,2382,2303,2332,2409,2477,2474,2390,2365,2370,2335,2389,2443,2456,2417,2412,2468,2421,2407,2407,2372,2404,2407,2388,2380,2380,2407,2332,2298,2416,2510,2569,2565,2538,2475,2388,2365,2327,2235,2224,2342,2398,2410,2372,2345,2343,2365,2498,2485,2357,2204,2151,2230,2239,2232,2171,2126,2146,2097,2068,2133,2151,2092,2070,2160,2183,2063,2055,2068,2086,2118,2122,2166,2139,2126,2170,2233,2226,2197,2218,2215,2244,2266,2258,2224,2164,2139,2185,2231,2322,2376,2245,2131,2032,2022,2142,2212,2191,2141,2176,2219,2220,2199,2218,2201,2115,2074,2059,2053,2019,2100,2176,2000,1806,1790,1864,1911,1867,1890,1986,1900,1808,1771,1695,1703,1688,1645,1615,1523,1482,1576,1590,1504,1473,1562,1707,1750,1791,1851,1898,1864,1775,1749,1744,1791,1829,1895,1864,1715,1715,1793,1822,1780,1770,1828,1866,1818,1740,1786,1921,1963,1919,1880,1909,2046,1996,1796,1745,1768,1818,1886,1940,1930,1921,1949,1960,1926,1910,1973,2030,2108,2105,2033,2008,2068,2265,2358,2280,2190,2181,2192,2136,2112,2097,2029,2004,2049,2033,2036,2096,2075,2043,2026,2009,2015,2024,1886,1649,1634,1774,1920,2059,2136,2135,2064,1995,1970,2059,2104,2021,2029,2148,2259,2198,2130,2191,2156,2047,2016,2126,2165,2050,1929,1861,1880,1925,1931,1869,1801,1748,1705,1689,1676,1632,1609,1654,1582,1504,1551,1644,1740,1752,1760,1748,1750,1844,1945,1989,1957,1960,2047,2065,1999,2030,2051,2017,1975,1975,2062,2035,2045,2122,2165,2205,2170,2224,2346,2379,2299,2230,2217,2152,2103,2063,1994,1929,1964,2071,2065,1937,1929,2129,2230,2214,2215,2232,2244,2228,2283,2348,2386,2370,2276,2217,2182,2191,2177,2106,2092,2083,2027,1998,2005,1997,1926,1828,1911,2072,2066,1964,1840,1764,1725,1665,1670,1731,1768,1723,1604,1585,1687,1824,1902,1815,1722,1701,1728,1751,1735,1795,1823,1798,1735,1691,1836,1965,1848,1640,1582,1652,1734,1716,1638,1575,1510,1572,1681,1688,1637,1609,1572,1591,1687,1630,1496,1416,1465,1517,1407,1313,1251,1230,1198,1102,1009,971,1047,1114,1116,1048,998,1047,1055,1007,987,953,852,738,742,883,970,1045,1193,1187,1072,1125,1290,1359,1414,1473,1434,1449,1563,1639,1599,1563,1607,1586,1476,1498,1707,1793,1698,1598,1597,1652,1617,1621,1627,1550,1465,1448,1668,1847,1687,1449,1462,1557,1519,1567,1639,1514,1339,1430,1713,1894,1962,1980,1993,2007,2032,2042,2138,2323,2387,2323,2188,2238,2425,2476,2430,2390,2494,2634,2638,2524,2529,2642,2627,2644,2694,2614,2543,2651,2769,2657,2441,2509,2820,2777,2503,2507,2673,2765,2780,2824,2837,2805,2918,3057,3057,2994,2967,3058,3112,3111,3233,3323,3261,3173,3196,3273,3277,3226,3270,3356,3318,3316,3360,3386,3358,3224,3181,3197,3131,3078,3111,3142,3094,3001,2959,3006,3021,2948,2856,2842,2870,2892,2895,2785,2710,2717,2705,2765,2844,2855,2853,2814,2790,2845,2802,2730,2773,2787,2769,2758,2727,2717,2747,2778,2818,2831,2699,2588,2614,2623,2588,2573,2583,2592,2597,2542,2494,2512,2499,2491,2481,2402,2339,2337,2258,2181,2255,2285,2226,2198,2151,2037,1947,1939,2029,2125,2126,2137,2067,1955,2003,2089,2074,2013,2057,2144,2156,2094,2072,2088,2019,1974,1999,2085,2128,2186,2291,2233,2221,2268,2273,2246,2125,2114,2194,2195,2084,1999,2064,2078,1918,1806,1877,1955,1997,1942,1720,1562,1626,1840,1989,1991,1907,1829,1903,2040,2015,1929,1993,2095,2161,2204,2177,2099,1993,1958,1975,1976,2016,2104,2116,2043,2020,2002,2025,2044,1969,1963,2020,2025,1951,1879,1898,1941,1946,1927,1957,1979,1941,1940,1891,1832,1915,1985,2003,1980,1901,1837,1779,1791,1854,1950,2069,2063,1884,1737,1797,1869,1910,1910,1830,1878,1908,1807,1829,1965,1961,1827,1734,1744,1792,1738,1722,1838,1877,1843,1842,1811,1755,1749,1778,1799,1765,1753,1817,1868,1889,1843,1712,1647,1710,1773,1823,1834,1782,1723,1581,1489,1583,1732,1791,1688,1580,1563,1593,1653,1623,1511,1463,1495,1610,1714,1637,1520,1499,1489,1485,1506,1498,1482,1483,1429,1381,1378,1420,1496,1440,1278,1193,1284,1403,1334,1188,1092,1085,1087,1066,1154,1259,1258,1172,1127,1146,1164,1225,1284,1228,1123,1149,1179,1171,1217,1129,1032,1070,1167,1223,1190,1271,1436,1457,1399,1385,1389,1420,1424,1380,1362,1236,1121,1216,1335,1383,1400,1368,1439,1631,1668,1583,1539,1507,1446,1463,1597,1664,1684,1696,1686,1756,1862,1945,1976,1917,1899,1927,1883,1908,1936,1845,1801,1838,1934,2031,2044,1990,1998,2060,2052,2051,2088,2169,2296,2366,2376,2437,2514,2454,2296,2292,2478,2530,2424,2422,2509,2547,2567,2677,2693,2542,2472,2503,2534,2531,2463,2456,2627,2711,2523,2437,2527,2466,2358,2347,2370,2383,2350,2358,2464,2497,2378,2305,2256,2167,2125,2080,2179,2403,2401,2224,2142,2101,2111,2169,2143,2200,2254,2300,2436,2423,2441,2481,2386,2401,2452,2412,2371,2358,2386,2393,2357,2354,2383,2405,2431,2426,2328,2238,2241,2204,2107,2077,2110,2161,2200,2181,2141,2089,2042,1974,1895,1988,2138,2195,2256,2306,2234,2135,2168,2253,2264,2170,2141,2185,2161,2199,2281,2324,2310,2231,2212,2268,2309,2316,2272,2211,2240,2214,2151,2166,2118,2073,2119,2211,2208,2118,2128,2115,2069,2095,2129,2175,2123,2023,2075,2114,2096,2023,1924,2030,2138,2035,1943,1965,2018,2093,2141,2189,2195,2112,2188,2290,2245,2151,2095,2177,2248,2275,2316,2329,2283,2200,2205,2297,2317,2195,2180,2213,2084,2008,2084,2191,2114,1955,2022,2104,2050,2037,2013,1887,1764,1767,1922,2002,1898,1881,1948,1930,1849,1685,1588,1684,1804,1784,1662,1610,1687,1796,1850,1872,1827,1727,1682,1682,1700,1686,1631,1604,1670,1802,1871,1897,1945,1904,1788,1816,1897,1966,2049,2039,2030,2058,2091,2008,1845,1793,1834,1918,1922,1902,1835,1658,1580,1622,1703,1749,1667,1628,1778,1799,1708,1729,1775,1804,1666,1596,1839,2012,1931,1855,1914,2019,2056,1896,1705,1714,1957,2188,2142,1927,1741,1847,2080,2145,2158,2083,1966,1930,1925,1998,2122,2155,2047,1857,1797,1954,2141,2251,2247,2114,1944,1911,2010,2064,2036,1970,1981,2102,2195,2272,2377,2412,2363,2286,2316,2556,2714,2585,2403,2427,2605,2669,2649,2643,2671,2810,2889,2807,2671,2664,2785,2739,2650,2711,2788,2744,2730,2830,2747,2655,2693,2701,2737,2747,2756,2785,2829,2868,2862,2826,2790,2727,2633,2724,2815,2700,2561,2559,2721,2822,2782,2631,2486,2487,2538,2560,2554,2559,2568,2558,2549,2556,2449,2385,2531,2523,2366,2341,2449,2515,2395,2197,2123,2178,2253,2348,2393,2333,2251,2189,2167,2199,2147,2090,2206,2233,2150,2067,1963,2019,2125,2061,1957,1929,1972,2023,1989,1979,1986,1899,1868,1922,1910,1867,1889,1835,1764,1847,1917,1881,1804,1759,1776,1815,1821,1769,1711,1727,1815,1816,1750,1798,1885,1871,1772,1715,1773,1892,1921,1771,1620,1656,1693,1666,1738,1803,1820,1813,1827,1924,1949,1868,1815,1836,1836,1771,1649,1561,1611,1690,1697,1685,1682,1681,1721,1788,1864,1900,1874,1799,1763,1841,1889,1911,1990,2027,1862,1727,1890,2078,2094,1988,1889,1777,1648,1692,1853,1850,1694,1666,1775,1852,1860,1910,2018,2068,2038,1977,2051,2182,2106,1997,2021,2092,2128,2148,2237,2223,2163,2193,2190,2165,2067,2043,2096,2108,2102,1978,1940,1971,1941,1912,1921,1976,1902,1815,1819,1860,1920,1895,1868,1930,2023,2074,2102,1969,1853,1983,2045,2008,1952,1954,2054,2123,2013,1768,1686,1742,1787,1749,1725,1739,1656,1529,1491,1552,1591,1656,1667,1563,1462,1415,1484,1536,1372,1150,1192,1415,1625,1718,1637,1430,1247,1212,1254,1317,1312,1349,1445,1369,1235,1209,1307,1374,1229,1059,1077,1252,1441,1450,1313,1203,1170,1256,1394,1405,1255,1152,1182,1183,1231,1332,1298,1273,1245,1175,1189,1192,1169,1148,1216,1372,1432,1369,1328,1427,1468,1413,1410,1382,1440,1504,1418,1340,1343,1472,1601,1638,1621,1582,1625,1712,1758,1753,1764,1815,1866,1860,1803,1770,1781,1804,1793,1787,1836,1923,1967,2022,2045,2003,2025,2116,2200,2192,2184,2182,2200,2238,2290,2377,2397,2403,2367,2378,2427,2496,2568,2542,2579,2591,2622,2714,2747,2734,2716,2788,2863,2912,2905,2857,2888,2963,3021,3003,2964,2952,2982,3032,3037,3102,3168,3162,3157,3196,3232,3176,3161,3175,3142,3085,3069,3156,3156,3096,3121,3142,3155,3167,3154,3101,3040,3067,3078,3033,3027,3071,3073,2995,2960,2987,3048,3028,2956,2933,2926,2894,2882,2975,2979,2925,2874,2875,2959,2939,2911,2907,2906,2871,2851,2916,2901,2849,2794,2687,2579,2536,2606,2627,2535,2563,2668,2684,2656,2681,2719,2640,2567,2587,2589,2564,2574,2583,2575,2535,2516,2523,2460,2390,2317,2297,2292,2262,2254,2196,2167,2133,2105,2137,2098,2022,1960,1942,1909,1800,1789,1823,1807,1802,1800,1804,1775,1756,1793,1803,1761,1731,1704,1670,1649,1636,1653,1616,1548,1548,1581,1589,1535,1482,1501,1481,1430,1452,1486,1496,1470,1445,1403,1324,1267,1263,1237,1160,1140,1107,1099,1128,1136,1118,1091,1125,1159,1147,1064,1057,1138,1147,1119,1108,1115,1109,1087,1033,1034,1091,1169,1194,1134,1135,1092,1070,1128,1126,1106,1061,1045,1082,1117,1146,1131,1139,1139,1136,1154,1100,1093,1187,1248,1241,1272,1309,1317,1365,1410,1431,1434,1399,1374,1401,1383,1374,1399,1437,1492,1441,1458,1571,1576,1521,1541,1588,1594,1609,1626,1643,1655,1668,1694,1742,1781,1774,1743,1720,1736,1718,1704,1764,1812,1858,1870,1846,1875,1888,1893,1904,1939,2024,2054,2034,2031,2086,2126,2128,2144,2198,2201,2166,2239,2290,2252,2181,2207,2280,2284,2341,2460,2488,2393,2430,2568,2586,2503,2493,2589,2614,2649,2685,2638,2631,2678,2726,2707,2636,2617,2610,2596,2610,2646,2705,2741,2712,2679,2695,2685,2699,2737,2742,2690,2579,2583,2650,2649,2640,2679,2742,2732,2670,2700,2794,2874,2876,2755,2677,2635,2683,2815,2807,2749,2685,2623,2614,2613,2600,2548,2474,2427,2435,2510,2576,2569,2533,2463,2370,2326,2372,2448,2456,2434,2405,2350,2311,2317,2364,2364,2311,2269,2212,2145,2107,2176,2215,2140,2063,2001,1955,1920,1941,1936,1926,1903,1872,1952,1992,1951,1873,1798,1725,1681,1718,1727,1630,1537,1561,1557,1556,1530,1412,1417,1498,1514,1548,1594,1577,1569,1581,1630,1707,1690,1658,1706,1742,1730,1655,1581,1550,1506,1505,1503,1525,1598,1598,1560,1559,1591,1633,1649,1610,1579,1557,1610,1700,1719,1776,1789,1770,1753,1682,1681,1720,1711,1689,1720,1809,1897,1887,1827,1879,1927,1953,2000,1999,2070,2121,2071,2088,2131,2100,2058,2091,2149,2061,1967,2074,2154,2132,2120,2165,2167,2152,2269,2296,2225,2198,2250,2344,2387,2357,2276,2232,2306,2451,2473,2459,2445,2391,2430,2493,2522,2592,2669,2659,2659,2665,2778,2935,2933,2912,2809,2759,2952,3247,3318,3133,3069,3184,3298,3163,2965,3027,3133,3103,3044,3009,2951,2941,2941,2851,2759,2767,2835,2826,2767,2769,2784,2746,2792,2908,2934,2894,2782,2748,2816,2776,2754,2832,2924,2925,2827,2847,2958,2920,2776,2702,2821,2947,2879,2832,2848,2822,2758,2702,2627,2499,2424,2463,2587,2637,2541,2377,2317,2297,2201,2171,2174,2210,2205,2140,2095,2091,2131,2092,1970,1850,1890,1998,2002,2001,2001,1956,1884,1859,1887,1942,2060,2159,2152,2044,1865,1838,1993,2107,2132,2063,2006,2013,1992,1955,1884,1781,1779,1801,1712,1634,1654,1785,1822,1602,1478,1564,1575,1574,1617,1525,1350,1258,1373,1575,1562,1367,1275,1295,1299,1293,1272,1258,1271,1306,1386,1399,1314,1244,1209,1237,1291,1286,1262,1306,1411,1444,1381,1306,1246,1250,1272,1227,1159,1075,1076,1156,1159,1125,1130,1200,1268,1261,1187,1127,1168,1176,1104,1098,1114,1076,1086,1116,1150,1169,1113,1113,1176,1164,1134,1187,1249,1277,1244,1266,1374,1383,1337,1294,1399,1515,1396,1296,1409,1570,1553,1504,1579,1632,1566,1494,1515,1541,1528,1507,1532,1558,1520,1485,1485,1468,1460,1458,1369,1288,1302,1359,1405,1514,1685,1749,1736,1638,1583,1740,1862,1891,1923,1876,1899,1981,1944,1951,1893,1696,1645,1796,1972,1903,1691,1626,1751,1935,1991,1860,1694,1664,1732,1914,2030,1935,1812,1774,1840,1851,1819,1788,1797,1856,1803,1700,1648,1652,1662,1706,1755,1750,1740,1788,1932,1924,1774,1695,1714,1838,1952,2038,2136,2117,1878,1710,1863,2095,2136,2035,2025,2098,2056,1926,1909,2028,2025,1917,1945,2000,2001,2077,2255,2365,2167,1943,2081,2336,2356,2201,2113,2130,2177,2242,2374,2442,2290,2108,2052,2187,2303,2178,2086,2142,2178,2209,2261,2203,2106,1928,1703,1783,1919,1915,1950,2018,2125,2143,2100,2137,2209,2196,2052,1988,2055,2133,2142,2044,1991,2114,2236,2233,2233,2143,2072,2154,2141,2128,2181,2184,2158,2126,2110,2073,2046,2069,2119,2170,2212,2241,2257,2296,2272,2219,2256,2308,2355,2401,2396,2384,2434,2528,2530,2465,2440,2442,2492,2571,2645,2644,2582,2608,2706,2779,2815,2819,2793,2854,2962,3012,3052,2996,2940,3042,3200,3268,3204,3091,3022,3103,3231,3295,3283,3239,3289,3301,3271,3341,3415,3431,3424,3364,3310,3332,3353,3366,3289,3166,3148,3153,3169,3186,3211,3263,3245,3196,3162,3132,3231,3325,3245,3150,3088,3116,3201,3184,3085,2938,2873,2951,2969,2868,2845,2850,2764,2742,2807,2786,2655,2608,2673,2666,2535,2465,2576,2648,2479,2285,2337,2419,2345,2286,2298,2247,2172,2260,2339,2208,2005,1998,2242,2402,2292,2076,1988,2033,2103,2154,2196,2230,2211,2208,2234,2274,2262,2160,2163,2223,2186,2084,2034,2049,2005,1942,1944,1944,1856,1720,1663,1695,1720,1685,1572,1474,1388,1220,1174,1351,1487,1410,1246,1199,1318,1426,1408,1427,1487,1447,1359,1360,1415,1363,1264,1215,1265,1403,1467,1429,1339,1262,1313,1393,1432,1426,1314,1247,1306,1371,1347,1231,1152,1204,1301,1291,1271,1311,1277,1192,1115,1115,1216,1279,1260,1211,1175,1198,1306,1407,1356,1219,1167,1181,1212,1253,1327,1370,1329,1374,1438,1411,1340,1253,1321,1473,1510,1454,1395,1403,1474,1602,1643,1560,1463,1390,1450,1546,1561,1548,1548,1590,1628,1705,1734,1691,1769,1859,1819,1736,1739,1755,1750,1777,1723,1669,1677,1743,1900,1987,1909,1788,1814,1874,1812,1790,1861,1883,1832,1813,1869,1903,1835,1737,1648,1638,1745,1855,1937,1921,1870,1937,1948,1889,1922,1970,1995,2002,1925,1799,1739,1823,2013,2082,1980,1925,1869,1821,1896,1918,1887,1905,1981,2086,2098,2058,2101,2160,2150,2157,2118,2018,1993,2021,2077,2116,2121,2127,2143,2153,2192,2297,2420,2551,2565,2455,2389,2426,2535,2599,2613,2530,2325,2229,2277,2290,2291,2335,2362,2304,2167,2129,2240,2290,2240,2145,2037,2069,2188,2213,2196,2184,2187,2242,2375,2414,2188,2009,2083,2175,2201,2251,2313,2408,2478,2425,2361,2361,2462,2575,2555,2468,2385,2350,2473,2633,2586,2485,2381,2314,2328,2202,2164,2263,2237,2180,2166,2192,2249,2283,2230,2149,2105,2176,2353,2387,2283,2184,2143,2139,2064,1984,1968,2002,2050,2081,2131,2137,2066,2049,2139,2211,2097,1848,1771,1951,2103,2128,2108,2033,1989,2015,2065,1969,1767,1754,1803,1820,1888,1936,1887,1840,1914,1961,1846,1638,1637,1758,1781,1894,2026,2051,1980,1894,1891,1946,1969,1916,1941,1990,1957,1899,1925,2038,2067,2052,2060,2016,1867,1738,1722,1722,1712,1734,1841,1901,1926,2062,2084,1863,1691,1800,2026,2131,1997,1756,1737,1863,1987,2016,1837,1784,1901,1979,2069,2019,1844,1780,1849,1948,1996,1952,1943,2058,2073,2037,1956,1839,1954,2126,2229,2264,2217,2186,2152,2200,2353,2449,2511,2672,2775,2755,2738,2768,2926,3009,2906,2810,2701,2687,2910,3033,2939,2898,2910,2898,2838,2789,2836,2857,2761,2606,2530,2629,2775,2770,2756,2808,2769,2765,2810,2746,2547,2368,2424,2559,2527,2397,2367,2462,2498,2376,2296,2317,2290,2359,2498,2471,2352,2255,2226,2235,2194,2158,2119,2012,1916,1829,1862,2100,2200,2093,2062,2085,2070,2064,2051,2000,1948,1938,1992,2101,2159,2105,2044,2015,1942,1847,1788,1816,1982,2052,1979,2096,2260,2281,2201,2073,2088,2194,2228,2168,2098,2041,1994,2002,2074,2172,2126,2075,2095,2038,1961,1891,1884,1815,1769,1946,2023,1873,1718,1589,1484,1590,1865,2098,2142,1948,1843,1840,1680,1518,1545,1718,1828,1789,1744,1718,1718,1836,1989,2031,1970,1900,1880,1876,1805,1740,1809,1909,1960,2045,2144,2131,2071,2075,2043,1935,1883,1934,2007,1960,1869,1943,1985,1856,1746,1701,1716,1761,1797,1781,1711,1637,1591,1625,1694,1769,1795,1827,1896,1777,1636,1714,1897,1975,1902,1867,1902,1944,1954,2022,2150,2162,2081,2084,2247,2345,2296,2219,2167,2175,2129,2049,2142,2311,2325,2269,2189,2095,2119,2161,2140,2110,2057,2052,2120,2116,2095,2103,2047,2026,2075,2039,1918,1896,1965,1976,1961,1989,1977,1916,1876,1823,1779,1778,1774,1713,1609,1551,1541,1547,1516,1402,1334,1426,1510,1436,1341,1329,1293,1195,1227,1379,1430,1358,1272,1311,1346,1263,1253,1291,1280,1242,1242,1289,1254,1191,1199,1271,1320,1283,1210,1123,1068,1025,1050,1157,1188,1195,1168,1121,1151,1209,1282,1258,1183,1162,1144,1184,1258,1302,1295,1313,1368,1391,1351,1222,1206,1298,1331,1289,1204,1155,1152,1229,1285,1223,1154,1171,1243,1313,1389,1382,1252,1094,1071,1178,1238,1313,1455,1538,1545,1469,1359,1432,1632,1710,1726,1763,1743,1660,1595,1748,2011,2059,1919,1721,1717,1908,2038,2121,2119,1967,1797,1819,2012,2154,2151,2114,2099,2013,1897,1819,1809,1906,2085,2167,2088,1998,1908,1868,1940,2091,2214,2133,2025,2057,2086,2091,2136,2208,2272,2246,2162,2221,2342,2441,2563,2529,2419,2397,2410,2496,2630,2685,2669,2646,2624,2599,2661,2806,2853,2890,2933,2829,2760,2875,3072,3135,3086,3056,3121,3221,3243,3323,3365,3270,3209,3203,3141,3070,3065,3059,3077,3048,3003,3050,3072,3036,2966,2920,2993,3083,3048,2967,2954,2957,2905,2838,2794,2822,2924,2966,2932,2923,2967,2928,2865,2996,3154,3100,2980,2991,3074,3082,2960,2932,3016,2996,3009,3059,3071,3094,3069,3036,3018,2970,2920,2890,2888,2927,2959,2950,2908,2857,2900,2962,2889,2869,3022,3083,2941,2855,2877,2898,2941,2987,2982,2941,2960,2992,3001,2956,2840,2792,2810,2828,2779,2750,2742,2665,2660,2692,2681,2653,2599,2584,2595,2544,2516,2492,2401,2320,2298,2397,2460,2411,2367,2290,2193,2155,2167,2215,2245,2187,2139,2061,1934,1929,1995,2066,2099,2009,1885,1863,1934,1909,1825,1890,1908,1789,1695,1653,1727,1849,1822,1734,1731,1659,1558,1553,1613,1724,1703,1580,1544,1512,1428,1501,1685,1680,1503,1392,1482,1516,1410,1340,1245,1183,1225,1312,1379,1432,1507,1463,1255,1119,1183,1259,1277,1356,1408,1385,1354,1364,1396,1381,1399,1474,1588,1641,1563,1494,1511,1614,1692,1641,1575,1599,1624,1654,1721,1696,1621,1577,1556,1537,1489,1489,1512,1469,1461,1496,1474,1427,1408,1399,1411,1492,1552,1547,1561,1635,1657,1622,1663,1669,1666,1723,1764,1794,1824,1852,1889,1909,1881,1856,1835,1889,1929,1881,1893,1895,1877,1822,1766,1800,1806,1774,1792,1832,1793,1682,1637,1710,1774,1838,1893,1852,1816,1775,1730,1782,1857,1873,1894,1932,1924,1882,1853,1881,1941,2017,2070,2122,2226,2232,2195,2226,2288,2338,2297,2325,2410,2412,2390,2413,2480,2437,2358,2329,2317,2342,2369,2404,2381,2311,2267,2251,2242,2231,2243,2239,2226,2216,2170,2131,2139,2139,2130,2106,2142,2232,2198,2116,2076,2042,2009,2015,2055,2086,2101,2079,2009,1925,1906,1957,2042,2048,1964,1917,1890,1862,1870,1904,1907,1883,1834,1792,1782,1790,1795,1801,1859,1825,1748,1797,1851,1826,1746,1697,1680,1651,1604,1515,1424,1361,1405,1558,1639,1634,1586,1450,1281,1202,1271,1430,1519,1518,1559,1581,1550,1516,1525,1640,1658,1558,1583,1617,1507,1396,1377,1464,1571,1583,1568,1559,1484,1356,1289,1311,1426,1526,1488,1437,1400,1371,1415,1536,1654,1667,1609,1559,1555,1547,1559,1655,1739,1797,1867,1908,1884,1837,1888,1974,2008,2035,2035,2046,2065,2087,2132,2124,2061,2012,2030,2064,2044,1991,1948,1937,1942,1906,1893,1950,1960,1881,1768,1696,1688,1717,1776,1829,1854,1828,1790,1786,1804,1823,1824,1794,1742,1726,1768,1830,1826,1718,1607,1605,1740,1921,2038,2085,2016,1910,1947,2083,2232,2344,2371,2340,2291,2255,2299,2454,2516,2386,2264,2220,2227,2300,2352,2344,2314,2264,2206,2175,2217,2241,2221,2274,2317,2312,2347,2358,2319,2294,2285,2297,2347,2411,2434,2413,2359,2304,2285,2252,2311,2438,2383,2199,2116,2147,2184,2219,2274,2284,2209,2144,2171,2247,2267,2221,2155,2093,2083,2076,2088,2153,2192,2209,2231,2258,2320,2376,2347,2298,2245,2188,2146,2175,2251,2186,2093,2091,2098,2087,2059,2114,2205,2153,2033,1997,2043,2116,2153,2163,2180,2147,2060,2035,2163,2329,2366,2292,2251,2286,2268,2216,2293,2435,2485,2409,2310,2295,2330,2317,2268,2276,2299,2285,2267,2227,2177,2214,2239,2238,2297,2272,2204,2168,2178,2240,2254,2235,2250,2304,2298,2262,2272,2314,2344,2329,2337,2360,2370,2359,2326,2311,2376,2424,2407,2405,2375,2343,2310,2335,2433,2475,2482,2494,2516,2525,2535,2557,2564,2552,2560,2579,2579,2571,2530,2525,2548,2516,2501,2531,2551,2546,2495,2417,2419,2483,2501,2444,2346,2318,2406,2501,2552,2536,2451,2436,2541,2614,2658,2731,2711,2600,2513,2457,2452,2555,2653,2671,2662,2615,2625,2689,2734,2740,2711,2705,2683,2634,2608,2578,2575,2631,2642,2641,2691,2725,2708,2634,2544,2487,2535,2627,2684,2672,2560,2471,2437,2371,2355,2397,2295,2191,2233,2254,2206,2151,2109,2098,2107,2075,2099,2142,2051,1973,1965,1955,1981,1979,1956,2004,2015,1970,1949,1973,1983,1980,2038,2070,2021,1915,1832,1841,1867,1814,1785,1874,1910,1808,1677,1655,1687,1713,1774,1867,1981,2008,1930,1852,1810,1771,1737,1774,1844,1816,1721,1640,1592,1598,1607,1614,1618,1603,1602,1598,1587,1595,1597,1570,1556,1560,1564,1569,1584,1587,1563,1549,1564,1607,1631,1568,1449,1382,1371,1370,1348,1322,1338,1368,1362,1344,1371,1418,1441,1408,1413,1473,1498,1517,1508,1496,1538,1599,1632,1611,1516,1429,1398,1432,1569,1641,1627,1632,1598,1541,1538,1578,1638,1630,1555,1547,1558,1545,1490,1468,1509,1481,1440,1465,1510,1495,1487,1484,1450,1456,1496,1530,1531,1522,1496,1476,1472,1477,1510,1535,1497,1438,1445,1469,1500,1532,1542,1559,1559,1568,1620,1661,1670,1724,1813,1897,1959,1984,2005,2022,2028,2060,2101,2110,2099,2088,2092,2106,2128,2161,2237,2321,2342,2354,2394,2437,2448,2450,2465,2460,2441,2456,2486,2519,2536,2531,2578,2618,2626,2625,2637,2656,2620,2611,2625,2606,2575,2547,2516,2487,2480,2495,2516,2477,2409,2368,2326,2332,2371,2369,2403,2446,2452,2467,2477,2546,2611,2586,2558,2543,2542,2542,2463,2385,2406,2458,2494,2512,2507,2480,2479,2507,2506,2468,2430,2392,2332,2315,2310,2305,2328,2338,2304,2244,2238,2240,2212,2182,2180,2189,2202,2197,2158,2177,2170,2110,2090,2129,2180,2116,1996,1955,1972,1999,2009,1947,1898,1843,1715,1685,1741,1762,1749,1754,1775,1776,1785,1775,1755,1807,1889,1952,2034,2061,1961,1854,1870,1956,1997,1975,1930,1898,1873,1842,1847,1859,1801,1719,1671,1679,1721,1741,1714,1667,1628,1609,1639,1679,1680,1617,1511,1430,1397,1370,1348,1371,1383,1366,1306,1249,1220,1116,1010,1007,1046,1034,975,924,894,856,798,785,853,927,933,923,930,957,972,946,963,1018,1012,999,1024,1045,1061,1069,1096,1129,1157,1182,1197,1227,1186,1083,1036,1098,1211,1279,1327,1363,1371,1431,1553,1652,1698,1681,1625,1593,1628,1666,1671,1711,1782,1873,1922,1903,1868,1850,1855,1860,1895,1920,1896,1878,1864,1815,1766,1760,1791,1815,1785,1745,1713,1701,1697,1695,1736,1796,1845,1842,1819,1858,1916,1955,1977,1962,1921,1908,1902,1880,1926,1994,2031,2086,2081,2026,1973,1944,2000,2077,2099,2089,2095,2157,2251,2349,2457,2548,2622,2697,2757,2813,2850,2843,2873,2960,3023,3087,3155,3201,3198,3171,3178,3201,3224,3218,3210,3238,3276,3300,3304,3266,3173,3112,3134,3172,3176,3189,3241,3302,3312,3251,3177,3161,3223,3273,3303,3334,3340,3343,3306,3204,3130,3141,3205,3263,3285,3308,3305,3223,3127,3130,3225,3264,3244,3251,3292,3309,3249,3213,3266,3317,3309,3291,3306,3304,3227,3105,3002,2932,2872,2843,2875,2921,2927,2913,2873,2807,2742,2681,2702,2799,2839,2777,2657,2544,2473,2392,2288,2330,2462,2480,2456,2457,2448,2409,2344,2384,2498,2501,2423,2345,2325,2351,2337,2296,2277,2289,2290,2295,2329,2306,2191,2079,2037,2051,2101,2167,2204,2206,2214,2259,2355,2396,2358,2316,2264,2218,2156,2089,2082,2144,2253,2268,2151,2090,2100,2080,2021,1963,1989,1974,1901,1869,1791,1697,1659,1716,1850,1895,1821,1771,1786,1788,1748,1742,1753,1708,1602,1526,1569,1601,1588,1550,1480,1473,1465,1435,1420,1413,1450,1466,1462,1415,1277,1196,1225,1337,1447,1434,1350,1300,1351,1424,1454,1509,1570,1559,1513,1519,1580,1647,1640,1592,1594,1667,1746,1776,1783,1776,1730,1662,1660,1696,1701,1706,1752,1808,1811,1774,1747,1696,1627,1624,1633,1612,1580,1579,1622,1626,1588,1564,1591,1620,1627,1633,1617,1588,1565,1571,1591,1589,1544,1489,1477,1501,1519,1538,1574,1591,1567,1561,1560,1525,1546,1618,1684,1680,1602,1548,1524,1536,1564,1558,1528,1502,1485,1477,1486,1507,1519,1524,1562,1586,1560,1547,1595,1664,1659,1577,1545,1592,1634,1671,1690,1634,1579,1572,1555,1563,1584,1629,1704,1702,1686,1676,1681,1737,1757,1734,1672,1631,1650,1642,1642,1673,1683,1669,1636,1653,1719,1755,1752,1733,1716,1723,1765,1794,1831,1857,1786,1727,1744,1794,1871,1914,1904,1885,1867,1917,1994,2012,2013,1971,1940,2027,2172,2228,2141,2089,2167,2204,2188,2187,2165,2131,2101,2130,2211,2273,2269,2258,2335,2378,2316,2237,2221,2258,2223,2205,2318,2396,2359,2260,2221,2291,2342,2362,2336,2305,2269,2181,2154,2192,2218,2177,2120,2175,2255,2259,2228,2275,2358,2276,2165,2200,2256,2255,2224,2285,2343,2264,2197,2209,2277,2363,2368,2290,2233,2234,2270,2309,2339,2349,2341,2371,2445,2551,2625,2620,2548,2452,2437,2495,2517,2488,2456,2450,2474,2535,2581,2583,2586,2541,2532,2588,2538,2483,2509,2567,2634,2673,2700,2718,2702,2636,2570,2584,2632,2608,2558,2553,2545,2494,2459,2467,2474,2451,2418,2415,2380,2314,2306,2289,2211,2155,2165,2204,2215,2187,2163,2188,2217,2188,2167,2149,2066,1946,1858,1885,1986,2052,2085,2133,2133,2068,2023,2008,2050,2126,2148,2117,2048,1985,1936,1894,1913,1946,1950,1920,1842,1780,1760,1777,1813,1839,1808,1780,1835,1892,1893,1839,1795,1800,1781,1711,1666,1726,1813,1788,1740,1776,1827,1852,1837,1797,1760,1747,1776,1834,1850,1807,1804,1819,1820,1839,1854,1828,1800,1825,1837,1815,1821,1830,1798,1747,1717,1734,1775,1792,1772,1770,1777,1734,1705,1704,1730,1768,1749,1726,1765,1820,1785,1705,1686,1712,1714,1703,1701,1655,1525,1409,1433,1516,1540,1517,1483,1474,1513,1541,1542,1575,1568,1501,1480,1509,1512,1462,1396,1378,1350,1240,1179,1212,1272,1300,1281,1267,1239,1218,1241,1260,1268,1272,1314,1412,1479,1508,1487,1420,1359,1302,1274,1295,1376,1453,1517,1586,1633,1702,1751,1793,1862,1896,1959,2011,1973,1975,2064,2141,2155,2163,2225,2335,2436,2462,2407,2306,2224,2250,2378,2479,2500,2473,2407,2384,2451,2513,2529,2530,2515,2480,2448,2419,2395,2415,2422,2379,2314,2257,2257,2294,2361,2410,2371,2266,2112,1954,1885,1949,2049,2118,2197,2273,2307,2322,2371,2470,2520,2508,2522,2520,2468,2430,2397,2321,2257,2279,2361,2401,2408,2427,2397,2383,2433,2513,2579,2606,2656,2698,2724,2748,2762,2762,2700,2647,2687,2761,2768,2767,2844,2899,2879,2865,2878,2882,2849,2814,2808,2780,2746,2751,2811,2843,2755,2651,2641,2673,2689,2701,2709,2697,2656,2638,2667,2669,2638,2621,2619,2613,2614,2623,2682,2709,2639,2594,2572,2538,2525,2527,2531,2533,2475,2383,2350,2287,2204,2185,2197,2207,2162,2126,2155,2184,2220,2258,2245,2193,2159,2137,2062,1960,1877,1848,1857,1819,1761,1716,1682,1665,1633,1580,1548,1531,1500,1461,1400,1389,1482,1576,1561,1473,1424,1426,1478,1537,1538,1489,1399,1352,1399,1449,1462,1499,1566,1610,1646,1728,1835,1900,1873,1761,1654,1649,1744,1795,1767,1774,1809,1845,1838,1852,1979,2109,2178,2170,2110,2096,2099,2142,2255,2300,2258,2247,2259,2241,2280,2364,2363,2335,2368,2404,2405,2398,2370,2328,2272,2222,2217,2181,2118,2079,2093,2156,2148,2049,1947,1883,1842,1843,1858,1857,1849,1841,1905,1976,1965,1915,1835,1760,1752,1790,1851,1938,1950,1838,1706,1648,1704,1826,1944,2010,2005,2001,2003,2002,2053,2176,2321,2385,2439,2492,2465,2416,2387,2438,2503,2490,2460,2471,2495,2473,2501,2671,2885,2955,2832,2679,2605,2541,2435,2382,2421,2471,2464,2442,2444,2410,2359,2355,2357,2304,2218,2202,2291,2324,2219,2098,2027,2018,2106,2254,2374,2380,2279,2223,2227,2214,2202,2189,2146,2132,2169,2193,2189,2079,1934,1907,1917,1910,1919,1935,1916,1923,1985,2035,2025,1941,1891,1870,1784,1681,1633,1630,1623,1599,1606,1650,1660,1664,1670,1652,1649,1693,1751,1741,1675,1655,1722,1802,1777,1674,1607,1566,1572,1603,1584,1586,1593,1594,1646,1719,1770,1824,1876,1878,1848,1803,1792,1827,1808,1678,1562,1579,1651,1693,1682,1640,1613,1638,1665,1679,1687,1641,1576,1504,1443,1426,1466,1579,1657,1628,1571,1569,1613,1643,1654,1661,1650,1645,1707,1812,1896,1938,1930,1897,1852,1844,1882,1893,1892,1860,1820,1826,1816,1786,1742,1697,1677,1690,1782,1882,1846,1756,1776,1834,1812,1731,1653,1610,1640,1772,1902,1939,1885,1786,1710,1648,1624,1589,1496,1471,1513,1571,1609,1606,1604,1647,1723,1775,1837,1842,1723,1635,1667,1755,1815,1836,1872,1943,2034,2055,2030,2078,2166,2218,2180,2078,2015,2004,1980,1955,1984,2055,2139,2188,2165,2096,2093,2197,2287,2275,2213,2169,2147,2149,2124,2063,2013,1997,2029,2100,2154,2169,2152,2076,2047,2057,2021,1976,1918,1861,1881,1979,2049,1988,1867,1849,1865,1828,1796,1775,1708,1633,1662,1702,1637,1528,1513,1594,1656,1626,1583,1610,1633,1690,1780,1789,1693,1575,1504,1493,1527,1556,1605,1619,1604,1644,1667,1623,1609,1656,1696,1711,1730,1778,1784,1763,1787,1834,1859,1871,1910,1918,1899,1889,1935,2007,1975,1936,1998,2041,2095,2181,2193,2188,2153,2084,2032,2026,2073,2088,2065,2054,2054,2041,2006,1958,1975,2036,2082,2159,2188,2159,2162,2201,2236,2223,2168,2114,2065,2076,2170,2226,2221,2232,2287,2361,2419,2471,2519,2520,2506,2531,2567,2615,2637,2613,2617,2669,2710,2739,2769,2784,2781,2762,2774,2851,2934,2968,2983,2995,3013,3058,3081,3051,3002,2968,2987,2990,2958,2978,2989,2978,2985,2988,2987,2977,2985,2991,2954,2896,2849,2885,3017,3066,2998,2951,2956,3035,3114,3098,3029,3011,3039,3063,3069,3022,2977,2987,3027,3043,3068,3110,3138,3135,3089,3026,2969,2994,3038,3005,2916,2820,2783,2788,2775,2746,2723,2706,2697,2665,2638,2642,2648,2645,2624,2566,2473,2444,2491,2551,2529,2448,2396,2321,2254,2254,2282,2318,2318,2239,2161,2094,2043,2029,1990,1920,1818,1736,1735,1741,1682,1631,1629,1640,1649,1647,1631,1597,1555,1505,1458,1438,1489,1597,1684,1705,1679,1594,1493,1476,1471,1514,1591,1623,1625,1586,1524,1463,1459,1510,1559,1521,1449,1448,1516,1590,1547,1478,1547,1708,1823,1843,1818,1829,1814,1742,1721,1738,1773,1767,1779,1836,1809,1732,1688,1677,1680,1676,1684,1739,1710,1625,1640,1695,1689,1624,1584,1560,1521,1487,1474,1494,1512,1523,1562,1614,1646,1712,1789,1859,1936,1978,1997,1992,1958,1882,1803,1791,1835,1877,1872,1871,1848,1786,1792,1869,1932,1916,1870,1839,1822,1853,1944,2032,2037,1995,1998,2045,2050,2030,2059,2124,2171,2135,2072,2032,1991,1967,1982,1992,1974,1952,1953,1977,1964,1947,1952,1979,2022,2054,2099,2128,2116,2104,2127,2158,2197,2223,2235,2256,2255,2241,2202,2155,2102,2061,2037,2006,2008,2061,2096,2047,2045,2117,2153,2137,2087,2029,1980,1966,1995,2023,2025,2035,2032,2013,2011,2026,2061,2069,2049,2016,1980,1950,1921,1934,1975,2016,2057,2039,1990,1943,1884,1867,1904,1942,1902,1842,1845,1870,1845,1776,1767,1791,1790,1789,1799,1819,1820,1764,1746,1780,1746,1733,1804,1838,1795,1736,1690,1653,1593,1570,1625,1661,1679,1678,1684,1702,1689,1668,1664,1677,1670,1651,1658,1706,1732,1746,1784,1811,1829,1857,1906,1944,1987,2013,2036,2046,2010,1992,2011,2031,1986,1939,1957,2009,2036,2039,2074,2077,2043,2037,2097,2165,2153,2098,2064,2059,2050,2048,2069,2109,2113,2052,2003,1939,1841,1806,1874,2010,2133,2186,2210,2213,2155,2044,1937,1926,1987,2032,2040,1988,1904,1846,1807,1791,1807,1752,1623,1540,1551,1634,1718,1782,1835,1829,1772,1730,1703,1688,1681,1700,1776,1802,1768,1736,1731,1752,1733,1728,1796,1858,1882,1876,1801,1731,1748,1831,1947,2029,2094,2109,2067,2080,2142,2194,2216,2177,2135,2166,2208,2238,2261,2233,2195,2208,2246,2270,2266,2255,2265,2260,2249,2287,2357,2394,2403,2405,2386,2377,2383,2388,2371,2344,2348,2361,2387,2431,2459,2482,2515,2531,2521,2478,2421,2400,2420,2438,2451,2473,2468,2433,2399,2397,2423,2446,2450,2431,2419,2416,2419,2426,2428,2429,2421,2404,2400,2405,2383,2360,2356,2355,2345,2348,2366,2369,2349,2317,2295,2274,2266,2260,2244,2234,2238,2265,2263,2225,2201,2182,2165,2173,2185,2174,2156,2136,2152,2177,2171,2176,2183,2200,2240,2262,2281,2323,2372,2394,2380,2379,2374,2341,2326,2340,2348,2349,2353,2337,2321,2304,2274,2244,2210,2194,2196,2192,2195,2187,2140,2116,2148,2154,2106,2066,2017,1899,1787,1751,1782,1819,1836,1858,1869,1869,1829,1771,1736,1736,1809,1892,1937,1923,1842,1758,1692,1671,1663,1578,1480,1459,1482,1558,1683,1731,1697,1704,1697,1629,1588,1585,1571,1556,1609,1693,1700,1635,1604,1579,1506,1506,1613,1700,1722,1706,1647,1596,1578,1630,1740,1794,1801,1789,1762,1733,1707,1662,1636,1677,1704,1708,1728,1760,1776,1744,1718,1743,1761,1761,1776,1775,1772,1766,1760,1795,1845,1869,1887,1919,1898,1857,1851,1814,1754,1726,1731,1750,1769,1781,1784,1786,1784,1785,1777,1768,1774,1758,1765,1820,1863,1887,1877,1858,1863,1871,1880,1879,1854,1834,1842,1876,1914,1920,1901,1895,1913,1939,1949,1944,1949,1960,1960,1958,1985,2022,2029,2029,2019,2004,2014,2034,2079,2124,2121,2117,2123,2113,2090,2065,2049,2053,2047,2047,2084,2102,2083,2064,2078,2117,2110,2091,2103,2084,2051,2070,2108,2140,2166,2147,2138,2170,2156,2121,2111,2131,2192,2233,2214,2177,2156,2147,2181,2221,2194,2148,2112,2081,2111,2169,2165,2144,2152,2148,2118,2092,2114,2138,2114,2115,2166,2180,2149,2145,2168,2170,2136,2129,2135,2134,2172,2211,2226,2228,2194,2145,2115,2097,2090,2071,2021,2053,2175,2265,2298,2279,2207,2155,2143,2133,2145,2171,2173,2153,2134,2125,2125,2134,2139,2125,2126,2155,2160,2159,2178,2185,2179,2172,2169,2170,2166,2174,2195,2206,2207,2207,2224,2236,2237,2232,2229,2260,2274,2272,2300,2320,2316,2325,2340,2330,2328,2326,2327,2332,2336,2333,2289,2261,2249,2227,2229,2243,2243,2228,2224,2237,2255,2268,2284,2295,2307,2353,2397,2384,2337,2307,2295,2294,2314,2341,2332,2301,2324,2377,2367,2326,2308,2308,2317,2322,2342,2344,2327,2341,2367,2362,2350,2344,2308,2303,2329,2329,2331,2342,2359,2386,2408,2402,2353,2292,2270,2281,2296,2313,2317,2301,2301,2338,2385,2412,2388,2373,2384,2363,2338,2328,2346,2356,2368,2391,2363,2340,2336,2326,2348,2395,2417,2406,2384,2356,2365,2390,2402,2408,2403,2443,2494,2492,2481,2466,2470,2496,2530,2540,2491,2435,2388,2342,2309,2304,2302,2277,2257,2241,2243,2250,2244,2214,2172,2171,2185,2191,2178,2166,2162,2119,2054,2014,2011,2012,1996,1973,1928,1880,1866,1836,1775,1746,1772,1802,1821,1834,1794,1756,1753,1746,1736,1722,1729,1748,1762,1763,1749,1748,1778,1812,1800,1768,1756,1755,1755,1762,1776,1768,1741,1717,1694,1691,1709,1733,1769,1782,1752,1729,1745,1784,1813,1821,1794,1763,1766,1767,1774,1821,1837,1812,1806,1816,1835,1846,1844,1844,1841,1844,1863,1860,1804,1763,1775,1805,1836,1857,1853,1843,1853,1882,1884,1848,1810,1788,1831,1898,1906,1845,1786,1775,1786,1824,1852,1861,1836,1803,1845,1869,1857,1850,1865,1916,1919,1909,1927,1905,1889,1938,1989,2025,2041,1997,1981,2006,1986,1968,1971,2011,2090,2114,2066,1960,1835,1774,1805,1875,1886,1855,1863,1896,1952,2021,2059,2043,2043,2116,2156,2118,2085,2065,2036,2032,2068,2087,2070,2036,2018,2026,2013,2012,2020,2019,1998,1941,1907,1935,2017,2092,2153,2155,2093,2075,2083,2106,2139,2152,2136,2132,2150,2130,2065,1964,1909,1927,1966,1998,1949,1882,1864,1852,1834,1831,1857,1874,1873,1857,1843,1834,1790,1742,1733,1767,1810,1820,1790,1716,1679,1682,1660,1623,1616,1629,1618,1615,1620,1567,1502,1504,1503,1463,1462,1470,1471,1477,1456,1437,1446,1468,1506,1515,1473,1426,1438,1502,1539,1567,1569,1499,1444,1427,1417,1433,1490,1530,1514,1470,1450,1471,1479,1500,1492,1438,1414,1366,1339,1378,1406,1386,1359,1337,1329,1386,1403,1372,1378,1378,1422,1486,1523,1547,1519,1500,1534,1592,1621,1611,1586,1600,1664,1654,1552,1448,1396,1390,1418,1474,1490,1528,1583,1581,1571,1553,1537,1574,1620,1594,1557,1544,1531,1587,1650,1643,1593,1517,1506,1590,1678,1738,1796,1820,1795,1761,1749,1767,1719,1691,1790,1876,1885,1814,1749,1750,1768,1843,1945,1996,1981,1944,1940,2000,2060,2055,2068,2094,2119,2149,2146,2147,2155,2159,2161,2176,2203,2183,2128,2075,2060,2096,2119,2116,2089,2038,2005,2001,2070,2203,2314,2359,2306,2204,2131,2088,2091,2171,2251,2277,2296,2273,2206,2146,2149,2221,2302,2429,2512,2481,2453,2441,2456,2491,2547,2622,2679,2680,2632,2656,2708,2773,2890,2989,3077,3149,3150,3078,3039,3037,3041,3057,3054,3070,3054,3032,3026,2994,2997,3025,3084,3124,3123,3084,3010,2975,2955,2948,2912,2847,2837,2876,2907,2862,2822,2870,2968,3032,3089,3160,3135,3070,3033,3060,3120,3129,3124,3107,3130,3156,3115,3103,3111,3079,3027,3011,3019,2998,2958,2912,2861,2850,2884,2937,3006,3021,2987,2954,2946,3022,3131,3152,3094,3047,3019,3013,3012,2994,2963,2931,2950,2938,2861,2761,2643,2583,2592,2657,2701,2728,2766,2738,2679,2612,2576,2565,2593,2638,2606,2547,2451,2393,2415,2413,2386,2373,2394,2387,2353,2337,2335,2291,2238,2281,2313,2289,2222,2145,2133,2134,2125,2100,2114,2187,2250,2277,2297,2316,2254,2170,2137,2160,2217,2242,2243,2209,2140,2092,2094,2088,2075,2128,2188,2241,2281,2258,2186,2116,2106,2105,2048,1998,1984,1930,1873,1857,1837,1854,1893,1902,1863,1761,1677,1646,1622,1595,1526,1436,1431,1429,1391,1369,1346,1346,1329,1304,1312,1353,1406,1417,1470,1552,1548,1469,1367,1302,1305,1363,1455,1551,1560,1518,1507,1527,1568,1527,1443,1397,1412,1482,1479,1475,1537,1532,1458,1401,1424,1496,1562,1612,1624,1581,1526,1487,1452,1418,1359,1302,1312,1372,1379,1288,1162,1117,1186,1253,1291,1349,1403,1458,1488,1477,1460,1425,1400,1457,1520,1508,1458,1379,1318,1287,1258,1268,1286,1272,1265,1250,1200,1201,1285,1349,1359,1341,1330,1311,1273,1279,1300,1297,1316,1329,1328,1327,1325,1335,1279,1194,1193,1217,1235,1210,1139,1135,1163,1205,1281,1317,1330,1358,1368,1377,1385,1359,1386,1484,1530,1486,1428,1440,1496,1508,1478,1455,1468,1514,1568,1586,1593,1630,1654,1653,1660,1656,1625,1609,1642,1683,1693,1693,1677,1675,1720,1751,1734,1698,1659,1639,1664,1736,1836,1905,1904,1900,1913,1896,1890,1924,1997,2099,2185,2218,2204,2176,2117,2064,2067,2053,2048,2074,2056,2036,2037,2037,2068,2113,2123,2116,2134,2129,2082,2080,2101,2072,2062,2119,2170,2180,2159,2105,2027,1956,1934,1932,1938,1980,2014,2048,2120,2177,2154,2084,2037,1999,2029,2182,2316,2351,2312,2260,2251,2259,2293,2332,2319,2313,2377,2438,2442,2484,2577,2630,2614,2551,2550,2623,2643,2636,2656,2665,2685,2726,2765,2826,2836,2775,2750,2763,2754,2680,2600,2614,2660,2687,2753,2820,2826,2815,2818,2823,2832,2826,2813,2822,2820,2781,2749,2746,2739,2716,2731,2784,2771,2733,2767,2790,2755,2758,2803,2813,2771,2711,2676,2687,2696,2673,2666,2701,2727,2730,2714,2686,2674,2643,2588,2567,2579,2588,2593,2557,2480,2440,2429,2435,2472,2522,2574,2625,2672,2672,2644,2661,2699,2723,2709,2675,2649,2612,2606,2659,2685,2693,2740,2748,2696,2630,2611,2622,2552,2465,2446,2466,2501,2525,2537,2530,2497,2463,2442,2420,2385,2328,2288,2303,2300,2238,2177,2157,2191,2233,2246,2243,2225,2210,2223,2227,2185,2152,2128,2082,2074,2060,1993,1943,1907,1886,1884,1867,1854,1832,1807,1795,1757,1712,1682,1659,1648,1632,1580,1545,1541,1509,1498,1538,1603,1647,1584,1488,1461,1459,1430,1416,1439,1441,1432,1456,1490,1468,1398,1386,1458,1560,1653,1729,1793,1835,1804,1721,1711,1756,1788,1846,1895,1882,1880,1944,2012,2024,2015,2017,1974,1918,1932,1974,1977,1956,1956,1977,1968,1952,2028,2163,2233,2210,2153,2132,2143,2135,2108,2071,2006,1958,1954,1924,1899,1904,1877,1857,1851,1803,1753,1729,1697,1681,1740,1832,1873,1884,1910,1916,1857,1796,1776,1791,1839,1874,1873,1867,1870,1843,1818,1872,1933,1932,1903,1917,1987,2013,1994,1988,1982,1964,1934,1948,1991,1973,1932,1896,1844,1826,1831,1812,1828,1871,1845,1777,1743,1749,1783,1838,1901,1929,1895,1828,1765,1728,1727,1762,1783,1774,1782,1797,1793,1795,1805,1786,1730,1677,1643,1623,1634,1675,1742,1798,1794,1769,1771,1788,1778,1711,1681,1705,1681,1654,1673,1704,1722,1709,1682,1643,1584,1554,1565,1578,1594,1628,1682,1719,1709,1686,1652,1602,1577,1610,1695,1735,1716,1732,1777,1842,1914,1942,1908,1843,1814,1808,1772,1743,1772,1823,1851,1908,1972,1939,1852,1852,1950,2003,1992,2023,2058,2018,1996,2051,2073,2014,1924,1893,1939,1941,1907,1906,1941,2001,2003,1946,1890,1875,1928,1975,1991,2012,2050,2109,2137,2103,2061,2017,1933,1889,1908,1901,1864,1813,1818,1884,1905,1941,2027,2035,1961,1916,1916,1938,1988,1996,1958,1959,2012,2101,2146,2135,2130,2103,2085,2093,2044,1962,1904,1885,1903,1921,1937,1966,1985,1982,1949,1915,1913,1900,1860,1851,1869,1855,1830,1842,1863,1862,1882,1942,1987,1973,1920,1889,1879,1819,1717,1669,1710,1785,1873,1954,1940,1847,1786,1816,1894,1898,1815,1754,1760,1775,1732,1708,1788,1851,1842,1836,1835,1812,1779,1776,1806,1820,1821,1864,1930,1968,1998,2014,2006,1986,1952,1951,1972,1997,2084,2219,2311,2337,2361,2373,2334,2314,2372,2433,2414,2397,2424,2415,2383,2386,2424,2466,2492,2510,2496,2444,2407,2421,2486,2585,2649,2675,2683,2643,2574,2498,2420,2388,2442,2544,2621,2662,2685,2708,2745,2816,2887,2874,2799,2714,2644,2620,2627,2652,2679,2680,2678,2719,2767,2778,2800,2824,2815,2822,2858,2874,2844,2786,2745,2735,2727,2688,2634,2587,2541,2490,2450,2463,2511,2521,2500,2490,2504,2529,2530,2507,2476,2455,2446,2447,2447,2419,2377,2371,2427,2492,2494,2449,2403,2386,2379,2361,2360,2359,2298,2219,2224,2268,2278,2288,2320,2341,2335,2352,2403,2435,2437,2417,2390,2372,2386,2420,2405,2348,2328,2336,2304,2272,2307,2400,2478,2447,2331,2269,2310,2332,2277,2219,2189,2188,2203,2232,2274,2303,2331,2357,2344,2268,2150,2061,2017,2015,2054,2102,2142,2171,2168,2101,1964,1828,1811,1918,2035,2082,2088,2102,2073,1995,1966,1979,1956,1918,1893,1843,1787,1773,1810,1867,1908,1953,2011,2063,2098,2085,2028,1981,1970,1982,1999,2001,1974,1972,2030,2064,2032,1991,1965,1933,1933,2016,2088,2069,2013,1976,1985,2018,2053,2070,2035,1969,1920,1903,1905,1878,1821,1807,1850,1910,1953,1916,1831,1773,1730,1678,1630,1605,1592,1595,1624,1645,1666,1664,1634,1631,1643,1647,1617,1549,1480,1426,1396,1383,1381,1379,1367,1365,1379,1427,1494,1513,1472,1404,1366,1367,1360,1366,1380,1345,1301,1286,1279,1291,1340,1377,1354,1278,1222,1238,1285,1325,1373,1406,1414,1424,1403,1326,1230,1175,1206,1266,1309,1361,1405,1413,1397,1394,1396,1356,1307,1282,1266,1232,1176,1146,1159,1180,1213,1297,1352,1299,1221,1196,1214,1266,1321,1334,1332,1341,1374,1419,1425,1427,1434,1478,1581,1659,1719,1745,1692,1641,1689,1810,1910,1980,1997,1980,1979,1958,1935,1925,1924,1934,1969,2036,2051,1991,1943,1948,1960,1956,1944,1926,1907,1864,1818,1787,1787,1852,1951,2054,2119,2123,2091,2058,2068,2095,2116,2141,2174,2192,2166,2150,2175,2234,2292,2292,2268,2279,2300,2316,2334,2342,2353,2343,2322,2360,2416,2427,2415,2438,2463,2457,2469,2483,2490,2493,2518,2581,2612,2622,2633,2645,2666,2672,2661,2643,2656,2684,2686,2667,2645,2659,2692,2700,2682,2665,2660,2651,2647,2646,2636,2621,2627,2617,2564,2551,2579,2591,2586,2585,2595,2581,2551,2544,2559,2576,2574,2581,2603,2610,2585,2552,2540,2537,2536,2542,2552,2563,2556,2556,2600,2636,2636,2615,2560,2508,2481,2444,2435,2477,2529,2549,2543,2548,2569,2577,2559,2532,2493,2453,2448,2455,2461,2469,2479,2503,2521,2551,2603,2624,2621,2628,2634,2603,2542,2496,2472,2454,2426,2381,2334,2301,2241,2160,2109,2056,2002,1990,2028,2095,2135,2113,2048,2003,1989,2001,2025,2015,1994,1971,1965,1993,2005,2006,2004,2015,2046,2086,2133,2155,2169,2191,2205,2217,2234,2262,2278,2289,2291,2273,2259,2238,2184,2131,2104,2071,2038,2019,1994,1978,1975,1958,1932,1944,1966,1940,1917,1917,1891,1843,1809,1801,1807,1786,1724,1663,1607,1540,1512,1554,1613,1637,1601,1527,1485,1474,1448,1405,1362,1326,1292,1269,1278,1340,1437,1507,1536,1539,1510,1466,1421,1392,1395,1410,1437,1482,1548,1596,1584,1580,1604,1590,1548,1517,1520,1561,1577,1542,1543,1577,1563,1539,1566,1614,1593,1535,1537,1556,1543,1520,1488,1468,1491,1523,1551,1598,1625,1621,1610,1607,1637,1676,1702,1730,1765,1817,1851,1839,1828,1839,1850,1843,1828,1841,1887,1920,1949,2019,2061,2039,2005,1980,1965,1943,1899,1893,1982,2072,2088,2080,2085,2091,2079,2090,2132,2139,2118,2102,2115,2143,2161,2174,2191,2186,2149,2133,2149,2194,2248,2271,2266,2253,2246,2222,2193,2187,2173,2154,2146,2118,2041,1984,1977,1994,2045,2089,2096,2086,2079,2080,2076,2077,2080,2070,2061,2066,2076,2091,2092,2072,2058,2071,2114,2144,2147,2163,2200,2259,2305,2296,2292,2330,2337,2306,2300,2340,2406,2458,2475,2447,2391,2357,2369,2394,2401,2390,2368,2404,2482,2501,2483,2483,2477,2439,2423,2453,2478,2498,2521,2532,2528,2524,2516,2493,2488,2522,2561,2567,2541,2500,2457,2418,2382,2353,2327,2307,2289,2258,2227,2224,2219,2182,2139,2104,2064,2019,1988,1975,1965,1956,1941,1923,1921,1931,1947,1965,1961,1928,1900,1881,1838,1788,1785,1809,1825,1845,1844,1827,1847,1921,2016,2061,2028,2005,2032,2036,1997,1967,1984,2038,2077,2092,2124,2209,2306,2318,2267,2236,2221,2202,2216,2253,2271,2270,2289,2364,2409,2345,2261,2224,2215,2208,2201,2239,2288,2282,2262,2267,2266,2230,2198,2214,2241,2264,2259,2221,2205,2229,2274,2298,2287,2274,2252,2205,2154,2118,2080,2032,1995,1971,1962,1975,1983,1989,2014,2042,2038,2006,1993,1981,1909,1834,1812,1819,1803,1770,1739,1694,1649,1610,1574,1568,1581,1599,1639,1679,1686,1657,1611,1582,1588,1605,1634,1671,1704,1746,1795,1808,1779,1755,1735,1697,1687,1716,1776,1812,1746,1683,1706,1730,1713,1699,1715,1737,1741,1743,1750,1735,1700,1712,1766,1812,1832,1796,1766,1797,1829,1831,1838,1873,1885,1847,1813,1794,1789,1809,1820,1810,1784,1751,1736,1744,1772,1798,1792,1763,1743,1741,1723,1686,1665,1672,1679,1659,1624,1586,1551,1523,1498,1508,1545,1554,1541,1537,1546,1551,1553,1532,1491,1500,1554,1615,1671,1683,1648,1618,1635,1661,1661,1661,1685,1726,1752,1752,1752,1772,1792,1803,1830,1846,1856,1895,1920,1920,1928,1948,1984,2040,2089,2131,2185,2213,2209,2225,2250,2251,2262,2318,2378,2393,2400,2417,2435,2447,2443,2445,2458,2463,2443,2410,2433,2488,2506,2513,2554,2605,2613,2610,2656,2707,2701,2653,2614,2618,2638,2657,2685,2694,2675,2642,2610,2603,2607,2582,2532,2501,2477,2448,2467,2535,2609,2637,2609,2586,2591,2614,2638,2618,2565,2507,2456,2448,2459,2463,2451,2425,2410,2414,2446,2461,2451,2476,2512,2526,2491,2420,2383,2393,2399,2396,2415,2451,2513,2591,2623,2599,2561,2539,2522,2487,2432,2402,2415,2409,2385,2387,2396,2365,2320,2297,2296,2330,2345,2320,2313,2332,2381,2443,2459,2436,2394,2342,2322,2336,2347,2331,2293,2264,2248,2208,2145,2092,2058,2045,2027,1977,1937,1928,1922,1939,1986,2007,2004,1992,1951,1916,1892,1855,1832,1855,1882,1863,1814,1774,1792,1846,1875,1859,1795,1743,1716,1698,1712,1743,1744,1690,1639,1630,1636,1642,1649,1663,1674,1670,1666,1684,1702,1675,1631,1645,1702,1716,1680,1646,1621,1584,1551,1542,1520,1494,1513,1557,1574,1562,1547,1528,1514,1530,1551,1528,1481,1440,1401,1381,1418,1461,1440,1419,1424,1419,1413,1407,1415,1418,1430,1470,1486,1467,1439,1421,1425,1440,1431,1388,1354,1352,1373,1389,1383,1397,1424,1427,1422,1426,1432,1441,1444,1436,1433,1446,1459,1436,1408,1413,1420,1413,1415,1420,1422,1426,1452,1537,1654,1744,1788,1802,1801,1801,1834,1866,1866,1864,1864,1855,1855,1905,1938,1882,1803,1729,1661,1623,1620,1650,1684,1691,1675,1677,1721,1791,1854,1894,1918,1918,1908,1921,1931,1899,1857,1843,1867,1915,1954,1977,1972,1946,1942,1966,2014,2068,2090,2101,2144,2210,2265,2301,2327,2340,2364,2411,2453,2466,2446,2420,2417,2472,2551,2585,2613,2653,2664,2641,2624,2614,2584,2564,2587,2650,2700,2712,2715,2712,2719,2727,2729,2747,2765,2763,2753,2751,2752,2771,2794,2791,2777,2739,2697,2678,2677,2698,2724,2724,2696,2681,2679,2657,2641,2651,2665,2689,2715,2711,2698,2708,2704,2691,2727,2791,2822,2811,2798,2775,2708,2655,2658,2666,2674,2706,2755,2793,2786,2747,2707,2669,2647,2647,2631,2582,2512,2415,2327,2316,2366,2388,2363,2350,2354,2359,2358,2339,2304,2283,2316,2376,2410,2416,2395,2352,2310,2286,2275,2266,2270,2286,2291,2288,2305,2339,2353,2346,2312,2273,2245,2216,2220,2223,2201,2202,2188,2129,2077,2047,2009,1934,1855,1846,1894,1950,2008,2039,2050,2076,2090,2129,2203,2234,2216,2193,2183,2179,2151,2118,2111,2091,2034,1969,1928,1911,1893,1865,1808,1718,1667,1688,1714,1708,1709,1736,1759,1767,1797,1830,1811,1769,1752,1760,1751,1714,1709,1732,1732,1723,1718,1717,1720,1713,1694,1663,1640,1641,1648,1666,1694,1696,1674,1648,1626,1640,1668,1673,1698,1737,1754,1763,1781,1828,1856,1827,1799,1770,1719,1690,1678,1667,1689,1745,1790,1809,1820,1834,1844,1843,1849,1871,1887,1883,1876,1860,1812,1777,1760,1729,1724,1744,1770,1821,1862,1877,1878,1861,1841,1820,1809,1813,1797,1765,1759,1765,1756,1750,1752,1759,1750,1730,1755,1777,1745,1710,1711,1736,1757,1778,1796,1779,1767,1788,1792,1769,1747,1732,1728,1737,1736,1706,1643,1582,1571,1574,1571,1576,1579,1575,1569,1583,1606,1619,1635,1654,1660,1646,1631,1641,1675,1709,1719,1716,1731,1774,1801,1805,1818,1833,1845,1875,1935,1991,2002,1989,1988,2008,2029,2038,2047,2053,2035,2001,1966,1922,1894,1875,1825,1790,1806,1842,1864,1862,1850,1848,1878,1912,1913,1895,1875,1850,1836,1848,1856,1840,1838,1865,1895,1898,1868,1828,1816,1840,1854,1840,1824,1815,1814,1804,1762,1720,1714,1737,1758,1778,1813,1839,1837,1847,1884,1913,1928,1942,1937,1921,1906,1904,1927,1945,1967,2021,2053,2053,2084,2124,2125,2111,2086,2062,2067,2076,2092,2136,2173,2172,2162,2185,2215,2203,2170,2139,2081,2035,2053,2069,2070,2101,2132,2159,2194,2211,2214,2211,2184,2170,2189,2191,2182,2177,2154,2128,2122,2123,2128,2143,2137,2122,2167,2237,2269,2287,2314,2328,2317,2291,2288,2310,2300,2256,2224,2203,2190,2200,2219,2245,2277,2289,2274,2252,2238,2211,2170,2175,2236,2286,2307,2300,2240,2187,2200,2224,2216,2204,2200,2211,2225,2215,2194,2159,2134,2166,2225,2261,2260,2230,2198,2177,2162,2158,2155,2150,2175,2204,2197,2172,2143,2133,2160,2208,2245,2255,2261,2271,2269,2276,2314,2365,2400,2423,2447,2468,2482,2497,2526,2560,2580,2587,2563,2514,2482,2489,2518,2514,2481,2452,2422,2404,2405,2413,2412,2389,2352,2339,2331,2282,2229,2195,2162,2143,2146,2184,2243,2273,2276,2263,2221,2166,2145,2161,2171,2158,2138,2114,2059,1973,1906,1864,1830,1830,1873,1897,1874,1835,1799,1768,1771,1825,1894,1923,1902,1861,1831,1806,1782,1796,1852,1909,1969,2028,2045,2044,2045,2047,2081,2134,2171,2204,2246,2259,2241,2226,2198,2148,2119,2126,2119,2076,2046,2045,2044,2037,2045,2070,2096,2117,2139,2163,2171,2142,2090,2046,2034,2065,2087,2075,2065,2045,1986,1939,1962,2027,2085,2100,2088,2116,2154,2166,2199,2236,2239,2238,2263,2292,2310,2308,2262,2194,2135,2112,2128,2158,2172,2184,2211,2216,2191,2167,2151,2134,2128,2147,2170,2174,2180,2190,2185,2187,2206,2213,2205,2189,2172,2165,2168,2199,2244,2267,2288,2325,2343,2319,2282,2260,2244,2236,2256,2295,2298,2268,2273,2310,2310,2247,2181,2158,2168,2204,2257,2283,2251,2199,2174,2203,2292,2374,2414,2435,2441,2421,2389,2374,2380,2389,2379,2348,2302,2262,2254,2283,2325,2355,2365,2345,2311,2284,2244,2186,2138,2111,2074,2030,1994,1963,1924,1882,1858,1855,1893,1948,1956,1923,1886,1857,1823,1822,1861,1883,1870,1843,1823,1800,1759,1711,1681,1672,1677,1694,1677,1613,1562,1549,1551,1574,1626,1674,1682,1660,1622,1574,1519,1472,1463,1482,1490,1491,1487,1461,1422,1391,1390,1429,1467,1473,1467,1455,1430,1411,1404,1394,1377,1371,1383,1406,1423,1440,1453,1445,1432,1435,1457,1485,1490,1476,1488,1521,1527,1521,1534,1549,1539,1508,1499,1537,1580,1577,1551,1546,1565,1577,1545,1492,1453,1422,1433,1513,1566,1549,1543,1589,1638,1656,1671,1704,1719,1701,1674,1643,1629,1645,1680,1734,1758,1730,1703,1696,1693,1686,1702,1751,1792,1819,1847,1844,1790,1741,1734,1746,1741,1712,1689,1703,1755,1811,1834,1836,1832,1814,1824,1891,1950,1957,1952,1965,1982,2007,2056,2121,2173,2166,2120,2102,2134,2165,2164,2180,2216,2225,2217,2229,2263,2285,2280,2262,2260,2267,2275,2287,2273,2245,2228,2206,2185,2190,2202,2191,2185,2210,2234,2237,2236,2236,2219,2205,2210,2221,2235,2244,2239,2236,2235,2215,2193,2192,2217,2265,2292,2282,2260,2255,2271,2276,2295,2355,2392,2394,2400,2406,2395,2371,2339,2324,2327,2331,2349,2351,2335,2329,2308,2281,2280,2299,2306,2298,2310,2334,2321,2271,2233,2223,2215,2195,2186,2203,2224,2238,2250,2258,2253,2209,2136,2084,2068,2071,2094,2127,2154,2160,2140,2130,2143,2157,2173,2210,2250,2260,2246,2234,2242,2252,2258,2291,2346,2385,2389,2377,2359,2338,2341,2385,2451,2497,2501,2482,2467,2464,2477,2488,2465,2427,2423,2471,2527,2519,2467,2443,2447,2465,2491,2504,2503,2502,2478,2413,2351,2326,2319,2318,2331,2337,2309,2269,2234,2205,2189,2199,2239,2266,2278,2298,2304,2281,2257,2258,2243,2188,2143,2152,2178,2193,2214,2234,2239,2238,2243,2271,2310,2333,2343,2355,2347,2310,2285,2289,2301,2321,2348,2369,2380,2379,2361,2330,2301,2290,2291,2289,2277,2267,2275,2288,2287,2274,2262,2257,2266,2257,2209,2170,2172,2181,2174,2157,2128,2104,2110,2131,2134,2117,2104,2084,2042,2008,2004,1997,1963,1936,1935,1934,1903,1862,1845,1846,1848,1833,1805,1773,1766,1797,1826,1840,1843,1823,1800,1803,1809,1790,1758,1734,1726,1709,1694,1711,1744,1778,1798,1786,1755,1722,1673,1634,1651,1702,1728,1693,1625,1570,1566,1619,1659,1658,1647,1628,1591,1555,1550,1549,1536,1538,1573,1596,1571,1539,1516,1509,1535,1564,1562,1520,1476,1482,1541,1596,1611,1603,1563,1504,1479,1499,1531,1563,1615,1671,1690,1663,1616,1579,1578,1609,1637,1647,1650,1630,1571,1540,1580,1629,1647,1642,1644,1657,1642,1606,1623,1687,1712,1690,1686,1714,1723,1680,1639,1628,1609,1584,1583,1602,1616,1620,1614,1605,1608,1607,1606,1620,1627,1624,1629,1645,1652,1654,1666,1682,1679,1670,1687,1709,1717,1741,1778,1805,1822,1827,1814,1802,1811,1835,1846,1841,1838,1856,1897,1947,1983,1998,2018,2052,2081,2100,2109,2104,2105,2127,2159,2178,2182,2196,2210,2205,2196,2209,2245,2286,2320,2353,2386,2403,2424,2457,2479,2497,2520,2545,2580,2602,2596,2587,2594,2599,2593,2598,2616,2612,2592,2600,2622,2623,2612,2609,2624,2628,2605,2583,2573,2563,2556,2562,2591,2613,2602,2589,2583,2574,2573,2597,2638,2661,2644,2629,2647,2666,2670,2672,2670,2658,2631,2609,2606,2599,2582,2559,2530,2503,2478,2462,2459,2459,2464,2468,2447,2411,2390,2391,2391,2371,2357,2377,2390,2376,2367,2348,2330,2337,2350,2348,2331,2330,2370,2422,2428,2387,2343,2328,2339,2347,2371,2410,2424,2414,2410,2426,2432,2405,2366,2343,2321,2277,2240,2238,2243,2206,2163,2165,2177,2155,2101,2056,2032,2007,1991,2014,2057,2072,2048,2020,2022,2027,1980,1909,1871,1856,1847,1863,1897,1913,1910,1896,1888,1892,1905,1924,1947,1967,1975,1980,1996,2021,2032,2024,2012,1992,1976,1974,1981,1993,2010,2014,1997,1987,1989,1973,1945,1931,1925,1920,1928,1944,1961,1971,1954,1925,1900,1878,1869,1872,1880,1885,1874,1868,1876,1862,1836,1826,1809,1789,1772,1749,1748,1758,1744,1716,1686,1658,1636,1623,1633,1675,1720,1734,1712,1680,1664,1666,1675,1672,1647,1625,1619,1632,1649,1639,1602,1582,1593,1596,1581,1582,1600,1612,1617,1613,1588,1568,1572,1573,1594,1648,1690,1700,1708,1721,1735,1745,1744,1746,1764,1775,1765,1757,1759,1751,1726,1704,1689,1663,1633,1608,1586,1567,1551,1554,1580,1596,1597,1613,1639,1647,1644,1654,1681,1706,1722,1731,1720,1696,1674,1666,1670,1669,1658,1662,1682,1694,1705,1743,1792,1815,1818,1822,1844,1890,1938,1969,1991,2022,2058,2083,2110,2151,2176,2167,2146,2141,2159,2179,2190,2215,2239,2236,2214,2188,2166,2132,2097,2074,2047,2026,2025,2021,2005,1977,1949,1944,1936,1909,1893,1884,1882,1895,1920,1935,1931,1937,1962,1997,2035,2062,2078,2105,2148,2180,2194,2193,2192,2214,2263,2295,2285,2284,2303,2302,2300,2334,2385,2397,2383,2377,2353,2317,2307,2327,2365,2410,2439,2437,2405,2363,2325,2285,2271,2312,2383,2427,2429,2427,2450,2464,2456,2458,2462,2452,2439,2435,2436,2435,2434,2409,2363,2332,2306,2292,2310,2332,2356,2387,2385,2326,2267,2278,2327,2331,2283,2237,2209,2183,2169,2180,2206,2230,2248,2262,2272,2257,2226,2223,2243,2249,2236,2212,2209,2242,2284,2326,2359,2368,2380,2405,2413,2400,2376,2361,2382,2419,2437,2440,2431,2409,2373,2330,2292,2260,2244,2257,2287,2297,2283,2287,2309,2322,2342,2387,2440,2460,2434,2418,2425,2432,2461,2512,2536,2496,2430,2404,2399,2384,2370,2345,2302,2250,2204,2189,2197,2200,2194,2183,2168,2148,2136,2150,2173,2194,2234,2268,2269,2271,2298,2330,2342,2338,2346,2359,2359,2347,2340,2356,2374,2364,2330,2279,2214,2161,2128,2104,2083,2057,2030,1998,1947,1893,1842,1787,1752,1748,1743,1714,1671,1632,1616,1624,1637,1656,1664,1636,1599,1572,1552,1522,1484,1483,1503,1502,1488,1478,1475,1464,1432,1407,1425,1461,1486,1511,1523,1492,1429,1390,1403,1433,1464,1500,1517,1497,1473,1480,1499,1496,1489,1515,1546,1559,1580,1624,1670,1690,1691,1688,1682,1688,1697,1688,1669,1649,1647,1670,1692,1702,1698,1685,1673,1640,1589,1560,1562,1550,1503,1483,1510,1512,1481,1466,1463,1442,1414,1417,1444,1461,1475,1488,1503,1531,1552,1561,1577,1588,1584,1582,1602,1646,1674,1671,1659,1644,1651,1674,1675,1671,1680,1693,1698,1677,1646,1634,1646,1675,1689,1664,1612,1559,1534,1545,1571,1587,1599,1620,1631,1651,1717,1802,1861,1882,1895,1927,1955,1987,2047,2106,2131,2113,2100,2143,2194,2219,2238,2235,2217,2208,2208,2217,2217,2218,2243,2277,2293,2285,2282,2306,2316,2301,2315,2353,2360,2358,2397,2450,2463,2459,2478,2504,2519,2532,2543,2546,2540,2536,2542,2542,2528,2516,2496,2463,2431,2417,2437,2474,2482,2466,2454,2440,2423,2421,2424,2413,2402,2411,2430,2431,2417,2407,2388,2361,2348,2334,2315,2308,2311,2312,2302,2267,2222,2201,2225,2265,2267,2232,2216,2233,2256,2273,2274,2259,2239,2225,2235,2260,2282,2295,2285,2269,2286,2328,2382,2436,2457,2440,2412,2400,2408,2444,2507,2557,2566,2545,2522,2510,2500,2509,2539,2545,2528,2526,2535,2532,2514,2493,2475,2451,2439,2433,2402,2352,2320,2324,2347,2357,2339,2302,2282,2278,2255,2227,2212,2198,2202,2222,2229,2216,2187,2167,2165,2167,2175,2188,2205,2230,2227,2189,2165,2165,2179,2207,2233,2247,2241,2218,2187,2143,2112,2110,2119,2128,2128,2101,2055,2010,1964,1923,1915,1934,1947,1951,1954,1956,1963,1980,2000,1999,1974,1958,1952,1949,1950,1951,1944,1937,1951,1999,2065,2107,2098,2067,2067,2088,2111,2140,2167,2185,2193,2195,2197,2193,2188,2190,2175,2148,2158,2196,2215,2207,2190,2175,2160,2145,2153,2174,2185,2185,2174,2165,2173,2178,2164,2131,2112,2107,2083,2058,2046,2023,1992,1966,1962,1973,1969,1958,1956,1962,1974,1976,1965,1948,1936,1938,1957,1988,2002,1991,1979,1970,1960,1960,1973,1981,1971,1956,1953,1947,1942,1953,1961,1957,1958,1962,1958,1956,1962,1958,1943,1937,1946,1953,1952,1954,1952,1945,1938,1943,1950,1925,1868,1804,1768,1772,1796,1812,1812,1796,1775,1762,1768,1773,1757,1751,1762,1758,1748,1766,1803,1803,1767,1749,1754,1756,1767,1791,1810,1823,1834,1840,1837,1835,1827,1815,1821,1828,1811,1785,1775,1775,1763,1740,1705,1671,1682,1721,1745,1763,1787,1791,1772,1760,1777,1804,1836,1874,1891,1890,1903,1927,1933,1904,1857,1826,1817,1812,1804,1800,1785,1760,1767,1790,1776,1750,1756,1774,1774,1771,1793,1813,1803,1790,1790,1775,1742,1707,1689,1694,1710,1722,1699,1647,1610,1593,1594,1618,1654,1678,1683,1695,1721,1730,1732,1746,1759,1789,1826,1839,1842,1859,1884,1908,1935,1975,2006,2004,1989,1987,1992,1988,1986,2004,2007,1974,1947,1953,1945,1901,1855,1834,1849,1874,1878,1868,1840,1782,1710,1658,1664,1698,1703,1700,1712,1710,1682,1636,1591,1563,1562,1594,1650,1686,1668,1615,1570,1562,1591,1645,1700,1729,1748,1787,1832,1848,1845,1863,1904,1937,1958,1969,1958,1943,1934,1909,1886,1916,1970,1980,1959,1954,1991,2026,2016,2006,2010,1990,1956,1943,1952,1970,1987,1979,1940,1896,1871,1872,1875,1870,1877,1880,1873,1909,1989,2051,2056,2015,1968,1937,1927,1956,2020,2084,2130,2158,2164,2159,2156,2153,2149,2148,2154,2186,2237,2256,2233,2204,2186,2172,2171,2197,2259,2324,2343,2328,2300,2260,2213,2199,2259,2334,2370,2375,2364,2351,2357,2389,2418,2422,2420,2408,2374,2341,2338,2369,2406,2434,2457,2452,2432,2444,2479,2500,2498,2495,2516,2534,2530,2526,2522,2522,2531,2527,2509,2513,2564,2620,2622,2590,2583,2604,2619,2626,2637,2642,2629,2622,2637,2635,2604,2561,2521,2515,2533,2543,2545,2548,2548,2537,2519,2517,2534,2556,2573,2573,2554,2510,2451,2410,2380,2340,2316,2330,2335,2311,2312,2334,2350,2375,2416,2442,2415,2377,2359,2322,2273,2250,2271,2318,2345,2361,2356,2310,2249,2217,2221,2220,2202,2184,2157,2118,2088,2095,2128,2162,2160,2141,2166,2217,2249,2255,2230,2198,2200,2232,2276,2303,2292,2276,2277,2268,2254,2271,2298,2279,2240,2237,2256,2250,2223,2207,2176,2112,2075,2087,2100,2088,2063,2038,2023,2029,2041,2046,2028,1984,1944,1915,1895,1904,1929,1940,1925,1900,1879,1858,1862,1897,1936,1961,1953,1915,1890,1891,1893,1880,1865,1866,1871,1882,1886,1854,1815,1815,1835,1838,1854,1884,1883,1865,1833,1772,1724,1711,1731,1778,1819,1852,1893,1923,1930,1927,1913,1900,1896,1889,1875,1857,1848,1855,1876,1919,1950,1937,1911,1886,1852,1823,1815,1826,1856,1892,1905,1892,1864,1823,1800,1828,1852,1834,1807,1784,1777,1789,1799,1798,1790,1789,1783,1777,1781,1778,1772,1766,1776,1791,1777,1742,1718,1740,1785,1790,1767,1742,1717,1723,1757,1806,1861,1885,1870,1860,1850,1804,1759,1754,1777,1815,1858,1890,1915,1942,1955,1947,1937,1941,1962,1984,1983,1961,1932,1908,1894,1896,1925,1948,1955,1984,2009,1999,1960,1894,1852,1837,1809,1793,1811,1832,1841,1849,1852,1853,1856,1866,1887,1890,1871,1854,1840,1840,1878,1931,1967,1972,1965,1971,1970,1953,1953,1967,1967,1965,2001,2059,2089,2100,2117,2111,2051,1975,1980,2061,2112,2122,2134,2150,2160,2167,2178,2185,2178,2148,2125,2133,2141,2140,2146,2141,2115,2083,2047,2027,2027,2017,2009,2001,1968,1938,1936,1943,1913,1852,1809,1803,1825,1847,1851,1853,1840,1811,1794,1809,1866,1921,1929,1910,1880,1841,1820,1847,1930,2025,2067,2094,2150,2207,2236,2233,2210,2168,2119,2084,2075,2089,2093,2080,2072,2072,2083,2095,2086,2071,2061,2045,2023,2020,2052,2079,2084,2095,2108,2117,2117,2113,2106,2083,2058,2053,2058,2068,2077,2068,2059,2053,2034,2015,2021,2042,2025,1978,1956,1944,1923,1913,1911,1918,1931,1944,1954,1942,1923,1934,1985,2043,2082,2105,2110,2108,2118,2133,2153,2168,2177,2190,2199,2208,2227,2235,2223,2207,2195,2187,2189,2200,2207,2203,2187,2171,2161,2164,2182,2208,2222,2212,2195,2176,2141,2102,2090,2095,2084,2073,2069,2060,2072,2099,2117,2127,2133,2135,2119,2093,2082,2075,2071,2083,2088,2091,2103,2127,2159,2172,2154,2120,2092,2069,2031,2010,2041,2082,2111,2128,2122,2079,1999,1948,1968,2015,2053,2082,2111,2132,2133,2136,2142,2139,2149,2156,2157,2170,2175,2173,2176,2187,2189,2172,2163,2183,2208,2215,2211,2198,2172,2146,2146,2159,2146,2104,2066,2068,2086,2082,2071,2065,2056,2042,2027,2035,2060,2069,2063,2058,2043,2006,1973,1976,2005,2025,2020,2012,2020,2015,1985,1952,1910,1862,1828,1819,1832,1850,1870,1901,1927,1931,1915,1900,1908,1918,1916,1906,1889,1899,1941,1992,2042,2071,2075,2069,2059,2062,2071,2092,2126,2145,2150,2156,2168,2170,2167,2164,2153,2147,2163,2209,2243,2232,2207,2189,2185,2197,2212,2229,2258,2294,2327,2346,2335,2313,2322,2360,2384,2379,2375,2386,2385,2380,2383,2377,2352,2311,2288,2289,2288,2276,2255,2250,2253,2246,2243,2240,2213,2171,2146,2139,2129,2120,2115,2104,2109,2124,2114,2089,2062,2043,2044,2040,2021,2003,1985,1970,1962,1968,1991,2010,2026,2027,2007,1991,1983,1984,1990,1980,1962,1955,1957,1948,1933,1933,1954,1959,1939,1918,1920,1941,1956,1969,1988,2003,2014,2010,1991,1970,1950,1941,1958,1990,2011,2015,2019,2024,2012,1994,1980,1973,1964,1949,1926,1902,1899,1920,1949,1968,1975,1995,2019,2016,2006,2003,1991,1982,1981,1970,1951,1942,1946,1949,1941,1933,1934,1943,1959,1955,1937,1933,1925,1903,1880,1853,1813,1779,1774,1787,1801,1799,1790,1783,1770,1754,1739,1721,1707,1708,1720,1745,1772,1783,1784,1788,1791,1778,1753,1742,1755,1768,1782,1796,1781,1742,1711,1708,1726,1742,1750,1751,1746,1746,1746,1749,1759,1755,1745,1742,1736,1737,1750,1762,1760,1752,1752,1763,1766,1763,1768,1773,1777,1783,1785,1787,1785,1787,1794,1803,1812,1814,1817,1819,1808,1801,1803,1806,1806,1810,1817,1814,1806,1801,1798,1793,1792,1801,1808,1806,1801,1801,1808,1818,1822,1808,1795,1797,1815,1849,1895,1933,1950,1944,1928,1921,1927,1936,1939,1938,1933,1916,1895,1884,1886,1903,1935,1973,1997,2004,1998,1996,2004,1999,1982,1968,1939,1902,1876,1862,1862,1890,1931,1946,1931,1911,1925,1984,2058,2126,2163,2173,2182,2198,2210,2223,2257,2284,2287,2291,2294,2293,2296,2300,2301,2304,2302,2289,2280,2282,2286,2302,2339,2380,2419,2446,2442,2430,2435,2451,2472,2483,2484,2490,2492,2501,2518,2515,2500,2493,2495,2509,2533,2564,2594,2599,2594,2594,2583,2559,2527,2507,2503,2506,2520,2553,2595,2612,2602,2600,2605,2608,2620,2637,2652,2672,2695,2724,2757,2779,2798,2816,2823,2805,2780,2773,2768,2754,2747,2741,2734,2723,2692,2663,2647,2637,2636,2630,2606,2581,2558,2536,2527,2524,2513,2490,2471,2473,2480,2475,2453,2429,2414,2408,2407,2406,2407,2401,2384,2369,2369,2377,2371,2366,2359,2345,2339,2332,2320,2306,2280,2249,2232,2230,2219,2199,2192,2182,2163,2146,2132,2115,2102,2104,2101,2080,2037,1996,1973,1958,1955,1954,1949,1945,1950,1961,1966,1967,1950,1911,1874,1851,1841,1831,1819,1818,1811,1792,1787,1794,1798,1800,1797,1794,1790,1788,1788,1786,1784,1775,1757,1733,1697,1671,1672,1676,1672,1665,1649,1628,1608,1596,1606,1642,1696,1751,1778,1776,1769,1770,1770,1757,1744,1747,1760,1753,1714,1671,1641,1620,1608,1606,1607,1594,1577,1577,1600,1633,1651,1658,1679,1692,1669,1631,1605,1600,1602,1596,1594,1584,1551,1526,1525,1524,1523,1527,1531,1535,1532,1542,1580,1618,1630,1630,1630,1620,1596,1578,1590,1614,1632,1636,1616,1579,1550,1550,1574,1604,1622,1641,1657,1668,1684,1701,1732,1773,1806,1819,1807,1769,1730,1724,1743,1754,1766,1795,1823,1836,1844,1850,1858,1864,1863,1862,1860,1854,1846,1830,1820,1822,1825,1823,1812,1822,1858,1888,1899,1905,1907,1892,1876,1881,1913,1949,1972,1998,2029,2058,2079,2089,2090,2099,2117,2123,2131,2143,2142,2132,2128,2143,2166,2161,2148,2153,2157,2162,2186,2223,2254,2270,2273,2260,2227,2205,2216,2230,2247,2279,2297,2270,2217,2193,2210,2244,2258,2236,2203,2180,2153,2127,2120,2131,2155,2177,2178,2160,2143,2140,2149,2160,2160,2154,2154,2164,2158,2139,2129,2127,2120,2101,2089,2092,2099,2097,2096,2097,2086,2075,2081,2111,2158,2215,2269,2309,2328,2326,2301,2247,2203,2202,2234,2259,2256,2244,2252,2286,2323,2344,2346,2332,2309,2295,2303,2333,2372,2388,2374,2359,2358,2351,2348,2357,2352,2327,2295,2274,2273,2284,2277,2251,2215,2188,2185,2188,2186,2186,2188,2178,2159,2143,2129,2114,2100,2083,2064,2054,2028,1963,1895,1856,1847,1838,1820,1804,1795,1788,1788,1793,1791,1776,1749,1734,1734,1739,1737,1721,1697,1675,1656,1644,1652,1672,1702,1731,1735,1719,1712,1723,1724,1708,1690,1678,1674,1661,1643,1634,1634,1631,1610,1595,1605,1617,1624,1639,1659,1666,1652,1616,1583,1579,1592,1604,1607,1610,1631,1656,1662,1657,1668,1692,1706,1726,1750,1769,1787,1801,1815,1834,1858,1875,1885,1903,1930,1949,1954,1955,1949,1931,1912,1896,1890,1888,1874,1873,1897,1920,1915,1903,1901,1904,1898,1863,1822,1816,1840,1855,1857,1870,1889,1905,1921,1935,1939,1927,1914,1923,1941,1953,1971,1997,2005,1989,1975,1965,1947,1936,1941,1956,1988,2032,2060,2086,2121,2153,2185,2225,2262,2298,2337,2364,2381,2398,2418,2429,2432,2439,2461,2490,2510,2535,2572,2627,2693,2730,2742,2749,2743,2725,2730,2763,2800,2820,2832,2846,2848,2838,2819,2800,2801,2821,2840,2847,2853,2866,2881,2881,2873,2867,2865,2859,2845,2842,2840,2836,2823,2797,2773,2753,2726,2702,2692,2693,2692,2670,2629,2588,2567,2570,2562,2546,2542,2539,2535,2533,2530,2522,2508,2501,2513,2525,2521,2501,2479,2471,2471,2470,2464,2457,2455,2450,2443,2451,2466,2465,2450,2428,2414,2425,2458,2483,2477,2469,2457,2439,2424,2397,2367,2352,2346,2352,2358,2346,2321,2285,2256,2238,2209,2170,2137,2114,2111,2132,2153,2156,2139,2110,2075,2064,2076,2080,2083,2079,2057,2038,2036,2051,2067,2071,2072,2061,2033,1999,1971,1962,1967,1963,1943,1892,1816,1767,1752,1754,1771,1779,1768,1753,1737,1710,1667,1628,1606,1628,1677,1697,1690,1683,1672,1642,1598,1558,1532,1515,1504,1504,1506,1507,1508,1498,1490,1483,1474,1461,1454,1480,1513,1527,1527,1522,1525,1532,1535,1544,1562,1601,1643,1663,1667,1670,1682,1702,1718,1725,1724,1726,1744,1776,1805,1831,1843,1851,1873,1895,1916,1916,1888,1868,1879,1904,1907,1884,1851,1807,1763,1739,1728,1727,1733,1732,1714,1686,1665,1661,1666,1670,1660,1630,1595,1565,1538,1517,1513,1533,1551,1554,1548,1526,1493,1470,1465,1463,1457,1465,1481,1482,1475,1478,1489,1506,1527,1546,1570,1593,1601,1595,1596,1612,1634,1663,1691,1693,1688,1706,1744,1772,1777,1791,1814,1820,1817,1819,1824,1821,1812,1824,1875,1938,1968,1965,1956,1948,1927,1913,1921,1919,1895,1874,1869,1871,1870,1868,1856,1828,1811,1818,1833,1831,1819,1815,1817,1833,1860,1887,1893,1852,1801,1804,1852,1892,1908,1897,1861,1827,1815,1822,1842,1867,1880,1866,1825,1775,1759,1794,1845,1888,1918,1898,1828,1778,1787,1821,1852,1890,1932,1958,1945,1913,1899,1896,1913,1981,2056,2064,2033,2003,1978,1961,1964,1985,1999,1998,2012,2041,2047,2028,2020,2034,2052,2066,2086,2098,2098,2114,2135,2136,2135,2155,2176,2180,2178,2174,2180,2205,2242,2279,2301,2316,2322,2318,2321,2341,2365,2390,2417,2431,2434,2430,2412,2401,2422,2472,2515,2514,2476,2440,2428,2438,2460,2486,2500,2498,2489,2470,2450,2439,2446,2471,2501,2517,2513,2502,2495,2499,2513,2529,2536,2534,2529,2507,2483,2490,2515,2532,2523,2500,2483,2482,2486,2482,2482,2494,2495,2479,2481,2508,2529,2529,2519,2513,2507,2499,2485,2464,2448,2438,2441,2461,2488,2502,2502,2499,2503,2514,2514,2497,2487,2489,2490,2490,2493,2500,2493,2475,2461,2451,2439,2428,2424,2413,2409,2435,2470,2487,2482,2475,2464,2432,2403,2394,2391,2381,2371,2363,2346,2321,2299,2294,2310,2334,2345,2347,2352,2342,2329,2338,2342,2328,2320,2311,2289,2267,2237,2196,2163,2143,2136,2144,2147,2123,2094,2088,2098,2122,2154,2160,2131,2109,2110,2118,2133,2152,2157,2145,2119,2095,2088,2065,2017,1986,1981,1968,1937,1919,1930,1952,1959,1956,1960,1955,1946,1938,1919,1882,1855,1860,1872,1870,1868,1870,1852,1818,1802,1798,1777,1751,1735,1717,1682,1639,1625,1632,1633,1618,1600,1592,1586,1582,1589,1600,1599,1597,1597,1582,1578,1592,1599,1606,1619,1640,1656,1641,1595,1547,1543,1578,1613,1648,1683,1707,1702,1686,1683,1702,1738,1762,1764,1745,1709,1666,1625,1618,1654,1694,1703,1689,1684,1679,1653,1632,1644,1677,1699,1709,1712,1711,1719,1720,1719,1723,1709,1687,1698,1748,1793,1820,1837,1848,1847,1831,1808,1792,1819,1878,1927,1963,1986,1994,2002,2016,2029,2033,2028,2020,2025,2047,2065,2064,2041,2020,2019,2019,1997,1968,1958,1962,1960,1959,1975,2009,2043,2069,2088,2096,2090,2059,2027,2015,2012,2017,2032,2046,2051,2049,2046,2041,2040,2052,2061,2046,2025,2010,2013,2036,2052,2047,2030,2016,2012,2017,2014,1999,1985,1963,1941,1959,2004,2029,2030,2023,2014,2008,2014,2028,2040,2044,2053,2081,2129,2159,2157,2151,2147,2141,2148,2155,2143,2125,2125,2144,2161,2164,2178,2207,2226,2236,2241,2234,2211,2178,2155,2144,2131,2112,2103,2121,2146,2158,2155,2136,2112,2095,2086,2064,2025,2000,1991,1979,1966,1975,1998,1997,1969,1947,1941,1935,1938,1957,1975,1995,2014,2018,2011,2013,2025,2033,2038,2041,2049,2054,2036,2018,2017,2028,2034,2034,2046,2064,2065,2044,2025,2019,2005,1993,2006,2024,2025,2018,2017,2015,2014,2029,2053,2076,2080,2061,2027,1995,1989,2009,2035,2060,2080,2092,2099,2099,2094,2094,2095,2098,2122,2158,2175,2183,2190,2194,2191,2182,2187,2205,2228,2255,2264,2249,2224,2204,2207,2230,2255,2267,2267,2260,2242,2214,2177,2142,2112,2082,2056,2037,2027,2016,2009,2011,2021,2008,1967,1924,1898,1902,1913,1919,1938,1968,1995,2017,2044,2070,2073,2054,2041,2044,2045,2029,2003,1986,1987,1992,1984,1972,1965,1965,1967,1959,1936,1915,1917,1936,1949,1949,1950,1946,1942,1965,2008,2034,2025,2005,1997,1996,1992,1992,2007,2020,2015,1999,2005,2030,2031,2025,2043,2071,2092,2096,2087,2067,2049,2068,2101,2117,2128,2142,2156,2151,2120,2059,1987,1944,1934,1940,1939,1934,1936,1939,1939,1937,1927,1930,1952,1971,1981,1995,2009,2006,1996,2008,2037,2051,2041,2032,2025,2016,2016,2037,2065,2088,2114,2132,2140,2155,2180,2204,2234,2260,2261,2244,2223,2211,2214,2223,2238,2271,2296,2296,2272,2248,2249,2262,2273,2294,2311,2294,2255,2225,2224,2253,2277,2303,2339,2373,2397,2409,2420,2412,2367,2313,2282,2280,2302,2323,2324,2325,2351,2383,2393,2393,2400,2404,2390,2389,2425,2462,2469,2456,2444,2426,2411,2403,2388,2362,2344,2351,2352,2337,2324,2328,2345,2353,2355,2359,2348,2309,2260,2219,2184,2155,2136,2127,2126,2122,2123,2136,2140,2128,2094,2047,2017,2010,2015,2032,2064,2096,2123,2145,2176,2200,2188,2163,2151,2157,2172,2175,2159,2141,2114,2088,2091,2109,2125,2129,2137,2157,2147,2111,2104,2130,2145,2136,2130,2135,2124,2109,2110,2114,2112,2112,2116,2109,2108,2117,2120,2123,2120,2094,2055,2034,2032,2042,2057,2064,2063,2058,2050,2046,2047,2044,2042,2048,2047,2026,2000,1977,1947,1901,1833,1764,1731,1740,1763,1770,1769,1769,1758,1724,1692,1680,1680,1703,1746,1781,1802,1814,1822,1827,1821,1815,1807,1779,1744,1728,1740,1774,1818,1847,1861,1856,1834,1813,1813,1840,1858,1856,1858,1864,1878,1885,1877,1867,1866,1879,1886,1880,1873,1855,1843,1858,1886,1916,1942,1961,1965,1951,1918,1888,1881,1890,1918,1948,1966,1967,1950,1916,1860,1798,1770,1782,1798,1798,1792,1780,1756,1723,1702,1697,1695,1698,1715,1745,1769,1773,1764,1749,1739,1741,1737,1721,1707,1709,1711,1708,1703,1700,1698,1688,1676,1663,1653,1659,1684,1715,1724,1711,1704,1713,1724,1722,1709,1706,1710,1708,1713,1728,1746,1758,1768,1787,1804,1811,1818,1826,1832,1824,1805,1799,1803,1819,1853,1883,1898,1899,1883,1861,1852,1855,1864,1873,1872,1871,1867,1859,1864,1872,1869,1865,1877,1892,1902,1909,1918,1924,1919,1917,1924,1933,1940,1946,1955,1955,1935,1912,1907,1916,1914,1909,1911,1910,1909,1909,1908,1894,1878,1880,1897,1908,1897,1882,1876,1879,1879,1866,1856,1858,1860,1866,1872,1869,1862,1872,1907,1930,1931,1927,1925,1930,1933,1945,1975,2000,2007,2009,2012,2026,2051,2072,2080,2085,2094,2103,2108,2118,2143,2168,2194,2233,2272,2305,2329,2338,2338,2345,2357,2355,2349,2363,2399,2440,2468,2479,2468,2447,2441,2446,2450,2447,2444,2451,2470,2491,2499,2498,2494,2484,2472,2454,2443,2439,2434,2439,2453,2456,2432,2405,2383,2355,2333,2334,2352,2366,2374,2386,2398,2404,2390,2357,2319,2282,2260,2249,2248,2263,2269,2245,2222,2235,2259,2264,2269,2283,2282,2260,2243,2231,2216,2208,2203,2205,2220,2248,2288,2334,2369,2376,2367,2367,2374,2367,2345,2327,2329,2354,2388,2414,2433,2447,2446,2438,2431,2423,2411,2397,2386,2395,2400,2374,2342,2332,2330,2319,2312,2323,2331,2320,2304,2290,2272,2258,2246,2237,2235,2228,2202,2170,2146,2126,2109,2103,2115,2127,2123,2111,2096,2085,2077,2066,2055,2042,2023,2000,1979,1974,1991,2007,2006,1993,1970,1938,1907,1898,1906,1899,1887,1894,1913,1927,1938,1944,1939,1929,1919,1911,1898,1886,1885,1892,1897,1896,1889,1885,1892,1912,1936,1959,1983,1995,1990,1971,1958,1964,1977,2002,2038,2069,2076,2066,2059,2057,2060,2078,2109,2125,2119,2131,2167,2191,2184,2168,2167,2177,2190,2202,2211,2215,2208,2201,2209,2230,2238,2237,2235,2222,2207,2197,2185,2161,2137,2131,2136,2150,2162,2152,2123,2095,2077,2068,2065,2054,2037,2019,1997,1965,1935,1930,1940,1941,1933,1929,1933,1941,1954,1977,2000,2003,1982,1946,1911,1891,1887,1886,1879,1861,1851,1857,1869,1884,1893,1904,1925,1945,1941,1914,1892,1893,1897,1897,1900,1901,1902,1914,1929,1939,1942,1943,1946,1952,1954,1947,1933,1919,1918,1933,1951,1954,1939,1936,1949,1956,1958,1950,1943,1940,1933,1924,1913,1899,1883,1876,1872,1854,1826,1810,1811,1806,1801,1797,1791,1792,1794,1804,1819,1826,1820,1804,1787,1776,1778,1798,1831,1857,1868,1872,1875,1877,1871,1866,1875,1882,1872,1860,1850,1848,1865,1889,1893,1874,1862,1865,1868,1871,1873,1870,1870,1882,1897,1910,1922,1936,1948,1949,1945,1946,1953,1957,1956,1952,1946,1943,1948,1961,1979,1986,1973,1953,1953,1961,1949,1932,1933,1948,1957,1969,1988,1995,1989,1978,1971,1956,1935,1927,1947,1986,2013,2025,2048,2082,2088,2072,2068,2078,2097,2114,2123,2124,2129,2133,2131,2131,2144,2160,2168,2183,2200,2206,2199,2183,2174,2180,2196,2205,2209,2207,2195,2174,2150,2138,2135,2124,2104,2091,2092,2086,2068,2054,2046,2042,2042,2051,2060,2062,2057,2049,2048,2037,2010,1995,2002,2002,1981,1956,1939,1937,1953,1965,1945,1912,1900,1912,1928,1934,1931,1920,1907,1902,1915,1925,1917,1908,1907,1909,1904,1897,1895,1911,1932,1932,1912,1887,1865,1845,1852,1887,1902,1888,1871,1860,1841,1834,1858,1893,1908,1904,1898,1886,1869,1853,1851,1862,1863,1844,1819,1801,1784,1763,1750,1750,1746,1739,1744,1758,1772,1780,1782,1794,1815,1831,1838,1843,1854,1868,1882,1903,1928,1943,1938,1920,1913,1932,1959,1984,2007,2021,2030,2048,2079,2108,2123,2133,2147,2154,2144,2113,2083,2078,2084,2084,2073,2062,2049,2029,2006,1991,1996,2011,2024,2024,2024,2030,2035,2047,2060,2066,2049,2006,1962,1944,1945,1957,1999,2062,2108,2114,2103,2099,2100,2114,2139,2164,2167,2153,2143,2146,2150,2156,2180,2215,2243,2254,2253,2255,2265,2282,2300,2318,2330,2326,2321,2330,2354,2378,2385,2382,2386,2393,2386,2372,2372,2377,2376,2382,2397,2410,2411,2406,2399,2401,2412,2415,2412,2416,2427,2443,2454,2464,2469,2465,2457,2443,2431,2424,2431,2450,2464,2453,2410,2369,2356,2362,2366,2365,2370,2370,2360,2344,2318,2295,2297,2319,2335,2337,2329,2310,2293,2292,2308,2335,2354,2357,2356,2364,2368,2358,2345,2334,2322,2308,2293,2290,2294,2301,2307,2318,2332,2335,2331,2330,2331,2333,2346,2367,2369,2346,2321,2310,2309,2306,2303,2296,2280,2259,2234,2209,2178,2141,2105,2085,2079,2082,2094,2104,2103,2096,2086,2069,2053,2052,2056,2061,2068,2074,2070,2059,2051,2039,2019,1996,1980,1974,1990,2025,2064,2087,2094,2096,2106,2120,2120,2112,2104,2095,2087,2087,2082,2071,2066,2054,2030,2004,1978,1948,1923,1908,1890,1860,1827,1804,1798,1810,1829,1840,1840,1832,1815,1786,1753,1738,1740,1742,1757,1786,1806,1811,1818,1828,1833,1837,1844,1850,1857,1869,1882,1893,1895,1878,1853,1835,1833,1834,1832,1836,1844,1851,1856,1859,1847,1820,1792,1789,1821,1859,1881,1891,1892,1875,1842,1818,1818,1834,1845,1844,1847,1867,1886,1898,1910,1913,1895,1862,1836,1825,1819,1815,1824,1835,1826,1787,1746,1732,1743,1763,1782,1795,1795,1776,1755,1751,1757,1763,1775,1801,1829,1846,1840,1819,1801,1795,1805,1815,1819,1811,1800,1804,1826,1847,1855,1859,1862,1857,1845,1836,1840,1837,1821,1803,1801,1814,1820,1827,1848,1864,1858,1844,1835,1835,1839,1840,1844,1848,1850,1859,1875,1882,1884,1888,1896,1912,1931,1941,1940,1932,1916,1901,1897,1890,1880,1879,1882,1881,1883,1885,1877,1872,1877,1879,1870,1867,1874,1882,1896,1919,1938,1928,1896,1871,1854,1831,1817,1835,1868,1895,1904,1899,1896,1901,1912,1925,1937,1940,1935,1928,1922,1937,1975,2006,2013,2006,1993,1975,1960,1961,1978,1996,2008,2010,1998,1975,1958,1962,1989,2020,2027,2023,2021,2008,1980,1963,1973,1982,1987,2004,2027,2046,2061,2075,2081,2076,2064,2054,2056,2064,2070,2070,2070,2079,2103,2126,2130,2126,2130,2131,2128,2141,2165,2177,2167,2150,2140,2137,2152,2185,2221,2248,2269,2280,2283,2277,2268,2275,2290,2296,2307,2338,2368,2381,2380,2366,2348,2330,2304,2273,2261,2268,2281,2290,2295,2288,2269,2251,2238,2227,2225,2228,2228,2232,2238,2231,2216,2209,2215,2235,2260,2275,2275,2271,2273,2278,2287,2304,2317,2313,2302,2298,2298,2298,2300,2302,2298,2282,2264,2262,2274,2287,2298,2299,2288,2280,2285,2296,2307,2310,2298,2270,2245,2240,2249,2255,2257,2257,2252,2248,2245,2241,2252,2275,2294,2307,2318,2324,2321,2310,2299,2289,2284,2291,2305,2309,2306,2298,2287,2280,2285,2307,2332,2347,2351,2352,2353,2348,2336,2336,2344,2338,2323,2315,2306,2281,2266,2278,2298,2301,2287,2266,2240,2214,2195,2189,2189,2185,2180,2171,2158,2147,2133,2108,2080,2056,2031,2010,2000,2005,2013,2006,1987,1973,1957,1921,1874,1845,1833,1822,1818,1833,1848,1836,1807,1789,1792,1801,1817,1857,1901,1923,1918,1902,1885,1871,1859,1853,1862,1874,1868,1848,1825,1804,1797,1811,1828,1840,1855,1863,1859,1857,1865,1868,1852,1825,1806,1802,1803,1793,1773,1759,1758,1762,1771,1779,1788,1796,1802,1805,1803,1794,1790,1795,1801,1805,1809,1806,1788,1762,1747,1747,1759,1778,1790,1782,1767,1764,1768,1764,1756,1741,1707,1660,1624,1612,1627,1651,1663,1662,1664,1672,1674,1670,1676,1694,1713,1730,1737,1735,1731,1742,1771,1792,1796,1796,1800,1805,1817,1833,1845,1849,1840,1830,1834,1849,1863,1873,1885,1901,1915,1919,1914,1907,1901,1906,1925,1948,1958,1963,1972,1979,1989,2009,2033,2043,2040,2029,2022,2028,2034,2035,2038,2049,2058,2058,2060,2072,2090,2112,2138,2167,2190,2202,2212,2224,2227,2220,2215,2217,2236,2262,2280,2283,2278,2272,2271,2287,2315,2331,2320,2304,2299,2307,2333,2367,2395,2406,2403,2400,2394,2384,2380,2379,2371,2360,2357,2369,2387,2402,2409,2406,2396,2381,2367,2361,2361,2358,2346,2331,2316,2313,2324,2343,2355,2341,2317,2304,2309,2320,2322,2321,2321,2322,2320,2317,2306,2286,2279,2286,2299,2309,2310,2305,2295,2286,2281,2281,2283,2274,2253,2236,2237,2248,2260,2261,2255,2254,2254,2245,2232,2217,2203,2197,2198,2200,2199,2193,2185,2184,2192,2192,2181,2175,2181,2192,2195,2182,2156,2131,2114,2111,2122,2134,2137,2125,2102,2075,2058,2050,2041,2024,2004,1980,1957,1942,1935,1930,1925,1920,1922,1924,1917,1905,1897,1893,1886,1880,1879,1877,1873,1880,1901,1919,1920,1910,1896,1878,1863,1868,1892,1909,1905,1890,1881,1886,1893,1894,1901,1926,1946,1939,1923,1917,1913,1898,1879,1869,1862,1861,1867,1864,1847,1832,1832,1843,1846,1841,1833,1831,1831,1829,1838,1863,1889,1894,1886,1890,1908,1918,1913,1913,1918,1918,1920,1934,1946,1943,1946,1965,1983,1986,1983,1981,1981,1991,2017,2042,2045,2030,2014,2006,2002,2004,2022,2045,2061,2065,2049,2018,1990,1977,1978,1994,2025,2057,2074,2083,2104,2128,2131,2120,2107,2100,2101,2107,2113,2121,2140,2160,2168,2163,2155,2144,2130,2114,2097,2081,2071,2068,2069,2069,2070,2065,2056,2049,2042,2029,2014,2011,2022,2029,2031,2038,2043,2041,2032,2013,1998,1996,1991,1971,1945,1926,1914,1909,1907,1899,1880,1859,1851,1861,1881,1901,1916,1932,1950,1965,1974,1971,1960,1949,1941,1935,1932,1925,1909,1896,1891,1894,1910,1935,1957,1974,1989,1999,2007,2015,2019,2017,2011,1994,1967,1947,1937,1931,1918,1904,1901,1900,1892,1877,1857,1837,1818,1808,1821,1845,1854,1854,1859,1862,1861,1856,1845,1834,1824,1821,1820,1815,1809,1807,1814,1826,1835,1837,1843,1858,1872,1879,1882,1887,1888,1873,1852,1840,1833,1827,1836,1859,1868,1851,1828,1808,1794,1797,1814,1829,1833,1837,1851,1864,1864,1862,1878,1917,1960,1994,2019,2042,2053,2051,2050,2062,2075,2074,2076,2100,2129,2151,2168,2179,2182,2194,2229,2268,2294,2318,2339,2339,2322,2314,2319,2326,2326,2328,2343,2355,2348,2327,2297,2263,2229,2209,2210,2228,2255,2280,2292,2296,2294,2288,2281,2276,2279,2294,2310,2310,2302,2307,2323,2333,2331,2318,2304,2287,2261,2232,2214,2206,2203,2210,2229,2246,2255,2262,2263,2248,2235,2236,2244,2248,2240,2229,2225,2226,2228,2221,2202,2186,2193,2204,2194,2169,2145,2124,2107,2091,2070,2048,2042,2063,2090,2103,2110,2124,2144,2162,2179,2194,2192,2161,2123,2101,2089,2075,2066,2065,2068,2075,2078,2079,2086,2094,2101,2117,2142,2164,2177,2176,2167,2165,2171,2182,2183,2168,2143,2124,2118,2122,2126,2120,2101,2082,2068,2055,2044,2049,2069,2083,2086,2089,2091,2091,2092,2092,2095,2104,2109,2108,2105,2096,2079,2067,2066,2082,2111,2131,2137,2137,2140,2138,2125,2115,2111,2098,2072,2046,2029,2025,2035,2051,2063,2058,2043,2027,2018,2034,2078,2111,2119,2116,2109,2094,2074,2060,2060,2075,2095,2113,2134,2162,2185,2201,2223,2249,2255,2234,2204,2187,2196,2223,2237,2232,2227,2227,2227,2225,2213,2199,2181,2163,2156,2160,2158,2145,2132,2132,2142,2146,2145,2140,2127,2099,2059,2021,1995,1982,1977,1980,1981,1978,1978,1988,2003,2013,2019,2019,2014,2008,2001,1995,1993,2002,2017,2015,1992,1960,1927,1900,1881,1875,1885,1905,1914,1899,1877,1866,1865,1866,1875,1891,1897,1880,1846,1819,1806,1790,1775,1776,1773,1753,1741,1745,1744,1742,1746,1753,1752,1742,1731,1727,1735,1745,1756,1771,1778,1766,1746,1736,1735,1741,1745,1742,1736,1733,1732,1732,1736,1745,1751,1762,1771,1776,1790,1806,1809,1806,1804,1793,1773,1761,1756,1748,1744,1751,1759,1760,1757,1755,1753,1761,1778,1785,1778,1769,1763,1758,1768,1798,1832,1848,1844,1840,1847,1855,1861,1877,1901,1915,1918,1919,1922,1920,1918,1927,1948,1970,1982,1989,2001,2020,2036,2037,2015,1980,1949,1927,1909,1907,1922,1928,1916,1894,1875,1866,1866,1875,1894,1925,1956,1974,1988,2003,2002,1990,1976,1962,1956,1963,1972,1985,2009,2036,2060,2087,2120,2140,2133,2107,2074,2046,2037,2055,2089,2117,2125,2113,2094,2080,2078,2087,2096,2097,2096,2096,2096,2089,2080,2085,2104,2119,2125,2135,2147,2153,2158,2160,2147,2127,2124,2134,2134,2126,2126,2135,2149,2168,2192,2215,2228,2231,2231,2228,2229,2242,2262,2282,2289,2279,2271,2265,2248,2228,2235,2266,2291,2293,2282,2266,2246,2232,2220,2207,2200,2205,2216,2225,2227,2221,2205,2184,2166,2148,2132,2115,2107,2114,2120,2119,2119,2117,2113,2110,2111,2115,2121,2126,2127,2124,2125,2133,2140,2143,2143,2136,2126,2120,2125,2138,2150,2162,2172,2180,2185,2182,2180,2186,2198,2210,2211,2201,2195,2203,2214,2217,2224,2243,2257,2255,2259,2282,2305,2314,2316,2321,2322,2312,2305,2310,2321,2329,2333,2338,2341,2335,2326,2320,2316,2311,2305,2300,2300,2300,2297,2294,2289,2282,2272,2264,2259,2254,2248,2240,2235,2233,2232,2227,2217,2206,2195,2176,2155,2142,2130,2112,2092,2073,2056,2045,2047,2062,2082,2092,2090,2089,2095,2098,2100,2109,2118,2118,2121,2133,2144,2150,2156,2165,2174,2177,2172,2157,2135,2110,2079,2055,2043,2053,2084,2108,2111,2107,2103,2093,2079,2069,2060,2047,2028,2014,2010,2008,2006,2003,2006,2008,2009,2014,2020,2024,2034,2047,2060,2076,2097,2120,2131,2134,2142,2158,2170,2172,2169,2164,2164,2161,2151,2149,2158,2161,2151,2141,2140,2137,2130,2124,2121,2122,2128,2131,2122,2104,2085,2074,2080,2093,2099,2099,2102,2106,2107,2103,2095,2088,2086,2080,2065,2041,2014,1997,1993,1983,1959,1936,1920,1909,1909,1911,1908,1904,1906,1915,1932,1952,1969,1981,1986,1978,1958,1935,1917,1901,1891,1900,1918,1926,1915,1895,1879,1871,1867,1873,1892,1910,1922,1934,1942,1938,1924,1914,1916,1917,1907,1900,1904,1896,1874,1854,1842,1837,1838,1847,1853,1842,1827,1823,1831,1835,1822,1807,1801,1797,1785,1772,1768,1761,1749,1731,1712,1690,1667,1655,1653,1657,1661,1667,1670,1666,1657,1641,1628,1634,1658,1677,1673,1649,1622,1604,1600,1603,1603,1606,1612,1613,1610,1608,1606,1611,1629,1646,1653,1654,1651,1649,1648,1651,1657,1666,1683,1701,1708,1708,1705,1698,1692,1697,1708,1712,1702,1694,1704,1724,1740,1749,1758,1768,1774,1775,1778,1780,1771,1751,1739,1748,1764,1774,1777,1778,1778,1780,1794,1813,1827,1839,1853,1866,1869,1867,1874,1884,1883,1881,1895,1922,1945,1952,1959,1980,1996,2004,2012,2022,2030,2030,2030,2040,2052,2059,2068,2079,2094,2114,2131,2144,2160,2178,2189,2194,2200,2215,2233,2248,2266,2286,2302,2308,2308,2311,2313,2305,2298,2295,2294,2292,2287,2281,2278,2279,2281,2280,2276,2267,2257,2263,2285,2309,2327,2336,2333,2324,2319,2322,2326,2323,2316,2314,2319,2324,2323,2324,2325,2324,2333,2348,2353,2350,2355,2368,2380,2388,2393,2399,2400,2397,2392,2386,2377,2371,2374,2380,2379,2374,2374,2365,2338,2311,2296,2288,2284,2284,2286,2280,2266,2248,2234,2228,2221,2208,2195,2182,2166,2143,2122,2114,2114,2113,2115,2125,2137,2142,2127,2095,2068,2053,2052,2060,2070,2069,2058,2048,2048,2050,2048,2046,2046,2046,2038,2018,1999,1992,1998,2012,2023,2030,2035,2043,2057,2078,2106,2131,2147,2163,2177,2176,2170,2166,2160,2160,2165,2163,2154,2144,2134,2119,2102,2098,2104,2106,2110,2115,2114,2112,2105,2099,2091,2078,2071,2070,2059,2037,2018,2015,2024,2031,2032,2028,2012,1992,1973,1959,1951,1948,1953,1964,1971,1973,1983,2007,2032,2042,2038,2028,2026,2031,2037,2040,2040,2046,2058,2068,2084,2112,2141,2155,2155,2152,2150,2148,2147,2154,2160,2150,2124,2109,2115,2132,2148,2164,2179,2182,2173,2166,2161,2156,2149,2147,2150,2156,2161,2161,2162,2164,2160,2153,2146,2136,2130,2139,2157,2170,2176,2175,2170,2162,2162,2171,2173,2170,2170,2170,2167,2160,2147,2133,2123,2119,2124,2131,2134,2133,2133,2133,2132,2132,2137,2140,2140,2140,2139,2138,2141,2146,2149,2147,2146,2149,2159,2170,2168,2159,2147,2137,2132,2130,2129,2128,2129,2127,2116,2101,2091,2083,2072,2060,2051,2047,2045,2047,2056,2065,2064,2054,2041,2023,2007,2002,2012,2027,2031,2021,2008,2001,1996,1994,2000,2008,2002,1981,1964,1956,1951,1945,1944,1956,1972,1985,2001,2020,2040,2050,2055,2069,2081,2081,2075,2069,2065,2058,2047,2043,2047,2052,2046,2030,2019,2019,2013,2001,2004,2010,2001,1990,1992,1996,1989,1981,1980,1978,1971,1964,1957,1952,1946,1935,1932,1939,1945,1947,1951,1960,1965,1961,1950,1939,1934,1937,1944,1949,1955,1958,1960,1966,1973,1975,1968,1949,1922,1901,1891,1890,1894,1901,1907,1914,1923,1935,1944,1943,1932,1916,1907,1903,1900,1903,1916,1927,1927,1925,1933,1943,1943,1937,1936,1938,1937,1936,1940,1943,1942,1942,1952,1964,1972,1979,1989,1999,2008,2014,2017,2018,2016,2014,2015,2012,2000,1981,1963,1956,1955,1953,1952,1956,1957,1958,1963,1969,1974,1972,1968,1966,1966,1968,1970,1966,1963,1961,1955,1950,1941,1930,1927,1926,1921,1913,1906,1897,1890,1887,1885,1881,1880,1887,1891,1879,1859,1842,1844,1864,1883,1901,1923,1933,1922,1907,1901,1896,1884,1876,1876,1879,1886,1898,1909,1911,1899,1879,1866,1863,1868,1884,1907,1925,1929,1924,1915,1907,1902,1905,1920,1939,1955,1966,1976,1984,1984,1977,1972,1975,1980,1982,1983,1987,1995,2001,2002,1999,1994,1993,1999,2006,2011,2017,2024,2028,2027,2020,2006,1990,1977,1974,1981,1989,1989,1980,1973,1973,1977,1985,1996,2005,2017,2028,2034,2031,2021,1999,1968,1943,1941,1954,1963,1975,1997,2013,2014,2007,1997,1985,1976,1976,1977,1972,1970,1972,1979,1990,1993,1982,1965,1946,1924,1911,1917,1930,1937,1942,1953,1959,1956,1952,1943,1931,1925,1927,1932,1937,1939,1940,1945,1952,1952,1943,1942,1953,1955,1944,1933,1926,1923,1921,1925,1942,1971,1997,2011,2018,2025,2024,2013,2008,2009,2010,2013,2019,2029,2039,2040,2025,2002,1988,1988,1992,2004,2023,2041,2054,2061,2067,2078,2094,2102,2106,2108,2107,2113,2125,2139,2145,2136,2121,2111,2114,2122,2124,2131,2148,2160,2155,2148,2143,2137,2130,2116,2101,2092,2086,2073,2052,2036,2030,2031,2042,2055,2062,2065,2073,2084,2096,2103,2103,2095,2086,2076,2073,2082,2095,2101,2095,2084,2078,2080,2089,2106,2128,2144,2153,2160,2163,2157,2143,2139,2147,2156,2165,2179,2198,2219,2234,2239,2232,2217,2211,2222,2241,2256,2268,2276,2276,2272,2264,2254,2245,2247,2262,2281,2296,2295,2272,2243,2223,2211,2204,2206,2218,2237,2256,2269,2272,2270,2277,2295,2308,2307,2301,2296,2297,2308,2327,2341,2333,2314,2302,2302,2321,2353,2384,2405,2415,2414,2416,2426,2440,2451,2459,2458,2442,2421,2411,2412,2420,2427,2415,2388,2366,2351,2341,2344,2359,2376,2390,2402,2406,2400,2388,2373,2352,2330,2319,2313,2312,2320,2326,2329,2338,2347,2349,2346,2347,2351,2352,2348,2336,2314,2289,2274,2277,2299,2329,2343,2334,2311,2287,2268,2254,2245,2246,2259,2274,2277,2271,2265,2261,2257,2257,2265,2283,2308,2329,2333,2326,2322,2325,2330,2328,2319,2301,2285,2273,2267,2268,2269,2266,2262,2257,2251,2240,2232,2226,2215,2200,2188,2183,2188,2197,2204,2205,2201,2191,2175,2158,2140,2129,2121,2116,2116,2113,2102,2086,2072,2058,2044,2038,2037,2028,2004,1973,1946,1925,1914,1909,1906,1895,1874,1851,1827,1805,1785,1771,1763,1761,1758,1748,1730,1714,1709,1710,1712,1711,1706,1702,1696,1685,1668,1652,1636,1620,1608,1595,1580,1568,1555,1535,1517,1513,1515,1517,1522,1531,1540,1546,1547,1541,1526,1508,1495,1495,1503,1509,1514,1520,1527,1537,1548,1556,1554,1547,1536,1521,1509,1501,1494,1488,1492,1505,1515,1517,1509,1505,1516,1532,1543,1543,1537,1534,1542,1555,1565,1573,1577,1570,1554,1543,1546,1562,1587,1614,1627,1627,1625,1626,1632,1645,1665,1690,1709,1714,1708,1705,1705,1703,1696,1689,1684,1678,1675,1678,1685,1693,1706,1729,1749,1761,1767,1773,1775,1774,1779,1782,1777,1773,1776,1781,1786,1794,1806,1812,1811,1812,1819,1830,1842,1858,1882,1906,1925,1942,1954,1950,1931,1913,1909,1922,1944,1966,1985,2003,2018,2023,2021,2017,2017,2024,2040,2059,2073,2078,2084,2093,2099,2101,2102,2104,2102,2101,2105,2116,2128,2139,2147,2148,2146,2150,2161,2164,2158,2154,2157,2171,2186,2196,2207,2222,2234,2242,2245,2249,2253,2258,2263,2269,2271,2273,2276,2282,2292,2300,2302,2298,2291,2283,2277,2276,2272,2265,2266,2277,2290,2304,2321,2338,2355,2367,2376,2388,2406,2424,2433,2432,2421,2410,2406,2405,2398,2382,2366,2353,2343,2340,2344,2354,2366,2373,2382,2393,2404,2411,2412,2413,2418,2427,2441,2449,2449,2452,2458,2464,2470,2470,2469,2466,2460,2454,2453,2452,2448,2442,2437,2429,2422,2422,2425,2424,2419,2416,2419,2421,2421,2422,2426,2425,2416,2408,2410,2419,2422,2420,2419,2415,2402,2387,2376,2371,2367,2366,2375,2392,2407,2418,2425,2426,2421,2416,2407,2396,2382,2367,2353,2338,2324,2314,2304,2290,2279,2278,2285,2289,2294,2302,2303,2289,2271,2256,2241,2226,2216,2212,2213,2222,2233,2235,2229,2218,2201,2182,2166,2155,2150,2148,2150,2152,2148,2136,2119,2097,2070,2045,2032,2029,2034,2045,2056,2062,2059,2045,2019,1987,1966,1958,1949,1937,1923,1913,1911,1911,1905,1893,1880,1865,1843,1825,1816,1812,1810,1807,1801,1793,1782,1770,1761,1746,1719,1690,1672,1666,1663,1655,1647,1645,1640,1629,1615,1603,1598,1591,1580,1573,1574,1575,1576,1577,1576,1569,1561,1557,1557,1560,1564,1571,1577,1580,1585,1588,1590,1597,1614,1639,1665,1690,1705,1713,1724,1741,1759,1773,1784,1789,1789,1787,1782,1771,1762,1759,1764,1777,1793,1807,1815,1817,1814,1813,1817,1823,1828,1837,1853,1862,1855,1840,1830,1834,1839,1841,1845,1850,1850,1851,1861,1875,1881,1871,1854,1836,1820,1808,1804,1807,1814,1820,1827,1835,1848,1863,1872,1878,1882,1885,1892,1898,1904,1906,1901,1898,1899,1897,1895,1892,1883,1871,1867,1873,1887,1910,1938,1962,1971,1964,1950,1941,1939,1944,1955,1967,1975,1978,1979,1982,1982,1979,1983,1995,2010,2020,2029,2043,2054,2056,2052,2051,2057,2058,2056,2061,2079,2104,2122,2128,2131,2134,2133,2129,2130,2137,2142,2147,2154,2162,2169,2169,2166,2166,2169,2174,2181,2191,2205,2216,2218,2214,2208,2199,2194,2196,2205,2215,2225,2230,2231,2230,2231,2235,2236,2229,2219,2208,2196,2192,2201,2220,2238,2246,2248,2248,2249,2243,2240,2249,2262,2267,2268,2271,2275,2279,2284,2292,2301,2304,2301,2294,2288,2284,2285,2301,2327,2347,2355,2359,2360,2353,2348,2351,2358,2369,2377,2381,2381,2373,2361,2349,2338,2324,2310,2302,2298,2292,2285,2284,2286,2291,2298,2306,2313,2314,2310,2302,2296,2294,2293,2293,2294,2297,2295,2287,2276,2265,2256,2249,2246,2248,2249,2250,2252,2255,2259,2260,2255,2249,2240,2228,2218,2209,2200,2190,2186,2194,2199,2190,2163,2134,2110,2092,2083,2083,2085,2086,2077,2066,2058,2056,2058,2059,2059,2058,2060,2061,2051,2030,2003,1981,1969,1962,1955,1949,1949,1950,1947,1936,1922,1911,1905,1903,1901,1894,1885,1882,1887,1896,1906,1914,1915,1908,1901,1897,1898,1900,1903,1905,1901,1893,1884,1881,1883,1884,1885,1886,1888,1887,1882,1880,1884,1890,1891,1881,1866,1855,1844,1832,1825,1826,1831,1837,1844,1854,1866,1873,1868,1862,1867,1875,1875,1874,1881,1889,1891,1888,1886,1887,1900,1920,1936,1942,1941,1937,1932,1927,1922,1913,1907,1904,1898,1890,1883,1884,1896,1912,1921,1923,1927,1935,1942,1944,1945,1947,1948,1950,1954,1962,1974,1989,2004,2019,2025,2020,2012,2009,2007,2001,2004,2020,2041,2050,2047,2044,2042,2036,2035,2052,2076,2089,2092,2095,2101,2107,2109,2110,2112,2104,2080,2055,2039,2027,2019,2022,2036,2053,2064,2076,2089,2092,2086,2083,2093,2110,2114,2103,2096,2092,2083,2077,2085,2096,2105,2115,2122,2121,2120,2122,2127,2134,2145,2153,2151,2146,2137,2123,2107,2098,2094,2092,2101,2116,2124,2126,2131,2134,2132,2129,2130,2130,2122,2109,2100,2102,2103,2102,2102,2100,2093,2083,2078,2080,2077,2064,2050,2041,2036,2035,2036,2039,2044,2049,2050,2048,2043,2035,2028,2028,2029,2025,2019,2018,2025,2031,2026,2012,2001,1996,1995,1995,1997,2004,2002,1995,1989,1987,1982,1979,1984,1990,1994,1997,1997,1997,1994,1989,1984,1982,1977,1968,1962,1964,1966,1964,1963,1967,1977,1988,1992,1985,1978,1972,1961,1951,1951,1956,1956,1949,1941,1934,1928,1927,1936,1950,1961,1963,1961,1953,1940,1927,1918,1914,1905,1894,1891,1897,1895,1882,1869,1868,1875,1879,1883,1894,1903,1905,1906,1907,1905,1897,1890,1893,1908,1923,1927,1930,1938,1943,1937,1920,1904,1896,1894,1895,1903,1917,1927,1925,1917,1911,1904,1887,1868,1862,1867,1874,1880,1886,1897,1915,1926,1930,1932,1935,1939,1944,1952,1954,1951,1952,1963,1982,1998,2011,2029,2045,2051,2049,2050,2055,2059,2054,2051,2054,2059,2059,2058,2066,2087,2114,2141,2165,2183,2194,2198,2196,2191,2186,2185,2186,2182,2175,2166,2150,2138,2147,2172,2196,2209,2218,2229,2238,2237,2235,2237,2239,2243,2249,2260,2276,2291,2300,2307,2312,2306,2292,2284,2283,2286,2291,2295,2302,2312,2320,2327,2340,2354,2359,2356,2355,2361,2360,2355,2364,2380,2380,2367,2356,2350,2342,2325,2308,2303,2309,2307,2294,2291,2305,2318,2327,2332,2331,2318,2297,2286,2285,2282,2277,2275,2273,2263,2247,2231,2224,2220,2209,2195,2183,2170,2151,2128,2105,2093,2093,2096,2095,2085,2066,2045,2026,2007,1990,1977,1960,1940,1919,1903,1901,1912,1928,1937,1929,1905,1872,1838,1809,1792,1794,1806,1819,1829,1834,1828,1810,1788,1776,1776,1778,1780,1792,1805,1812,1821,1834,1840,1827,1807,1798,1800,1809,1819,1827,1833,1827,1809,1788,1775,1772,1776,1781,1783,1784,1788,1789,1791,1793,1789,1773,1746,1727,1715,1702,1694,1699,1714,1733,1752,1765,1772,1780,1789,1798,1806,1805,1798,1789,1784,1785,1792,1805,1818,1831,1838,1838,1837,1835,1834,1839,1846,1850,1849,1844,1836,1837,1850,1870,1890,1908,1919,1925,1931,1939,1939,1932,1934,1940,1938,1933,1937,1940,1943,1961,1987,2007,2020,2034,2051,2060,2044,2018,2006,2004,2004,2012,2026,2031,2025,2008,1996,1994,1997,2009,2028,2048,2058,2057,2057,2070,2091,2108,2122,2132,2134,2131,2127,2120,2117,2118,2115,2124,2148,2163,2158,2152,2153,2151,2143,2137,2140,2150,2157,2161,2170,2184,2194,2200,2203,2200,2183,2155,2137,2141,2154,2167,2179,2190,2202,2213,2223,2230,2228,2218,2218,2233,2243,2242,2229,2208,2188,2175,2171,2176,2183,2188,2200,2219,2237,2244,2246,2255,2266,2271,2274,2280,2286,2297,2315,2328,2324,2311,2305,2306,2316,2334,2363,2388,2394,2378,2359,2355,2362,2372,2384,2404,2420,2417,2396,2375,2364,2359,2360,2364,2364,2354,2337,2324,2318,2309,2298,2289,2272,2248,2232,2228,2223,2211,2196,2197,2215,2232,2242,2249,2253,2251,2243,2232,2229,2228,2225,2232,2256,2286,2306,2311,2310,2315,2316,2302,2284,2264,2240,2218,2210,2221,2242,2258,2263,2261,2252,2230,2202,2179,2174,2188,2203,2208,2206,2187,2158,2142,2139,2133,2130,2137,2144,2141,2127,2114,2104,2090,2079,2078,2077,2076,2080,2087,2098,2109,2115,2124,2133,2130,2125,2118,2090,2053,2033,2033,2039,2042,2040,2031,2005,1965,1936,1926,1925,1936,1951,1959,1952,1936,1927,1922,1916,1909,1910,1909,1901,1891,1878,1866,1857,1848,1841,1842,1850,1853,1850,1844,1834,1818,1794,1770,1758,1758,1764,1768,1765,1756,1744,1735,1727,1718,1716,1719,1727,1744,1773,1798,1815,1835,1856,1867,1863,1852,1843,1844,1855,1870,1875,1871,1863,1857,1862,1879,1887,1876,1862,1853,1845,1842,1841,1846,1861,1882,1901,1916,1927,1931,1925,1911,1901,1901,1902,1907,1924,1939,1946,1953,1958,1946,1924,1912,1921,1934,1933,1928,1928,1928,1924,1913,1904,1904,1905,1904,1910,1920,1923,1925,1929,1923,1905,1880,1856,1837,1820,1811,1810,1809,1806,1804,1802,1804,1812,1817,1814,1807,1798,1793,1792,1791,1789,1790,1794,1801,1807,1814,1821,1819,1803,1781,1762,1751,1748,1748,1754,1765,1771,1772,1775,1781,1788,1793,1792,1784,1777,1776,1781,1793,1812,1829,1836,1838,1843,1851,1860,1869,1880,1892,1893,1883,1868,1858,1860,1871,1892,1919,1939,1937,1919,1905,1906,1923,1949,1981,2011,2021,2023,2033,2046,2053,2062,2073,2081,2090,2099,2105,2106,2105,2107,2114,2118,2118,2116,2114,2114,2118,2128,2136,2139,2138,2140,2151,2160,2159,2152,2148,2152,2160,2162,2156,2154,2155,2157,2162,2166,2162,2152,2143,2143,2148,2145,2139,2136,2129,2123,2125,2128,2129,2135,2145,2159,2168,2164,2159,2159,2162,2162,2165,2172,2179,2185,2195,2203,2201,2195,2194,2203,2218,2238,2257,2264,2260,2252,2243,2232,2222,2217,2221,2223,2222,2225,2233,2231,2216,2193,2163,2139,2134,2143,2155,2166,2168,2161,2153,2150,2147,2142,2141,2145,2146,2142,2134,2124,2118,2122,2134,2147,2160,2172,2179,2180,2182,2186,2188,2186,2181,2176,2168,2153,2138,2132,2139,2155,2170,2178,2181,2179,2174,2168,2161,2153,2141,2129,2125,2131,2140,2140,2130,2120,2116,2114,2114,2119,2128,2134,2129,2113,2102,2100,2100,2102,2106,2109,2110,2113,2119,2129,2137,2135,2127,2117,2109,2108,2115,2122,2129,2138,2152,2155,2145,2140,2147,2155,2160,2167,2171,2164,2148,2134,2135,2143,2147,2149,2150,2144,2132,2124,2125,2130,2139,2152,2162,2172,2186,2200,2208,2211,2215,2220,2224,2231,2234,2234,2239,2248,2254,2255,2250,2247,2251,2257,2264,2273,2279,2282,2279,2271,2264,2256,2245,2234,2227,2218,2208,2196,2177,2159,2152,2153,2158,2161,2158,2149,2139,2134,2127,2114,2100,2095,2095,2093,2097,2101,2103,2109,2119,2127,2130,2126,2117,2107,2100,2095,2092,2085,2074,2065,2057,2046,2041,2039,2037,2038,2040,2039,2035,2035,2040,2048,2048,2041,2031,2018,2000,1974,1953,1949,1949,1938,1923,1914,1906,1896,1889,1887,1884,1876,1868,1860,1851,1842,1836,1831,1830,1833,1836,1835,1827,1818,1812,1811,1821,1835,1843,1846,1843,1838,1836,1843,1851,1861,1871,1875,1872,1865,1860,1859,1860,1861,1864,1870,1879,1888,1893,1897,1901,1906,1908,1902,1892,1884,1882,1884,1888,1895,1903,1913,1923,1924,1914,1904,1894,1889,1895,1905,1911,1911,1908,1907,1915,1935,1953,1956,1953,1952,1954,1958,1957,1955,1956,1961,1971,1982,1989,1989,1986,1982,1984,1992,2004,2020,2033,2040,2046,2048,2049,2047,2037,2026,2025,2031,2033,2031,2027,2019,2009,2002,1999,2001,2005,2010,2011,2006,1999,1994,1986,1982,1982,1981,1981,1985,1992,2000,2006,2006,1997,1983,1972,1969,1972,1977,1982,1985,1986,1983,1978,1975,1981,1990,1994,1997,2000,2001,1994,1984,1980,1977,1972,1965,1964,1972,1980,1984,1985,1980,1974,1968,1962,1959,1961,1966,1978,1998,2017,2027,2028,2026,2021,2016,2018,2021,2020,2021,2022,2026,2031,2035,2029,2013,2003,2001,1999,1998,2002,2010,2008,1996,1977,1963,1957,1959,1966,1977,1987,1989,1987,1988,1995,2003,2006,2008,2009,2003,1993,1991,1992,1989,1987,1991,1996,2000,2008,2016,2018,2012,2002,1995,1990,1991,2000,2010,2019,2029,2038,2049,2061,2073,2080,2082,2083,2087,2088,2084,2082,2082,2082,2081,2083,2096,2114,2132,2148,2165,2183,2193,2195,2195,2191,2188,2190,2198,2214,2233,2248,2256,2252,2244,2240,2243,2250,2252,2250,2249,2253,2262,2273,2284,2289,2286,2281,2280,2287,2303,2322,2335,2344,2351,2358,2362,2354,2340,2334,2337,2343,2348,2351,2353,2352,2350,2353,2356,2353,2342,2325,2309,2297,2292,2287,2278,2267,2251,2236,2224,2218,2217,2218,2222,2225,2222,2211,2200,2185,2165,2151,2146,2145,2143,2141,2139,2138,2134,2128,2123,2117,2112,2111,2113,2113,2105,2094,2079,2065,2050,2041,2041,2047,2059,2073,2089,2101,2099,2089,2078,2072,2073,2081,2095,2102,2095,2083,2069,2052,2039,2035,2037,2040,2040,2039,2039,2036,2032,2030,2028,2024,2020,2019,2021,2028,2037,2042,2038,2026,2016,2009,1999,1987,1975,1965,1960,1956,1952,1943,1927,1910,1894,1887,1886,1884,1881,1883,1889,1893,1897,1898,1897,1893,1882,1869,1856,1848,1843,1839,1837,1839,1846,1853,1861,1870,1874,1873,1870,1867,1866,1862,1857,1856,1857,1857,1859,1862,1864,1865,1866,1869,1872,1872,1863,1847,1830,1818,1815,1816,1811,1800,1789,1781,1780,1786,1792,1792,1784,1774,1768,1765,1763,1762,1761,1767,1780,1792,1801,1809,1813,1813,1816,1824,1824,1806,1786,1778,1782,1789,1790,1786,1778,1770,1770,1778,1787,1798,1811,1823,1834,1843,1854,1867,1871,1867,1864,1869,1879,1889,1897,1906,1917,1926,1933,1935,1934,1926,1913,1902,1902,1909,1914,1916,1919,1925,1927,1927,1928,1931,1932,1935,1946,1963,1982,1999,2011,2021,2030,2037,2039,2036,2032,2027,2025,2027,2032,2033,2029,2028,2030,2035,2040,2043,2042,2039,2038,2037,2039,2045,2052,2066,2083,2100,2117,2129,2135,2134,2127,2122,2126,2132,2133,2128,2121,2114,2110,2111,2121,2139,2158,2176,2188,2191,2189,2184,2177,2168,2161,2157,2155,2150,2144,2142,2142,2138,2135,2137,2138,2130,2121,2127,2148,2176,2203,2222,2230,2226,2217,2213,2216,2216,2211,2208,2221,2246,2266,2277,2283,2286,2282,2271,2260,2255,2262,2274,2287,2299,2311,2321,2323,2316,2303,2294,2296,2314,2335,2352,2358,2358,2358,2361,2365,2366,2365,2366,2368,2366,2364,2366,2364,2354,2332,2312,2306,2309,2316,2323,2324,2318,2305,2293,2289,2291,2295,2293,2287,2281,2276,2270,2263,2253,2242,2234,2228,2222,2220,2225,2233,2234,2229,2220,2205,2185,2169,2162,2165,2169,2168,2161,2148,2135,2124,2113,2100,2089,2089,2096,2101,2104,2104,2098,2086,2075,2073,2074,2069,2058,2048,2041,2039,2042,2046,2051,2051,2043,2030,2021,2020,2021,2017,2010,1999,1981,1961,1944,1934,1931,1934,1944,1955,1967,1978,1987,1996,2008,2024,2038,2047,2052,2051,2040,2029,2023,2019,2009,1999,1992,1987,1981,1978,1980,1980,1976,1973,1972,1976,1982,1991,2004,2013,2015,2009,2004,1999,1987,1968,1947,1927,1904,1880,1863,1856,1855,1857,1860,1866,1872,1878,1883,1883,1880,1875,1868,1858,1847,1841,1836,1827,1815,1807,1805,1804,1804,1804,1802,1802,1812,1831,1845,1850,1852,1854,1856,1854,1852,1850,1847,1843,1835,1829,1829,1833,1841,1849,1859,1866,1863,1852,1844,1842,1843,1845,1852,1861,1866,1869,1872,1878,1889,1900,1911,1923,1934,1940,1945,1950,1960,1972,1985,2000,2009,2011,2011,2011,2004,1994,1987,1985,1984,1983,1987,1993,1999,2003,2006,2008,2010,2011,2007,2003,2002,2005,2008,2006,2003,1999,1994,1987,1975,1960,1950,1946,1947,1952,1965,1979,1985,1986,1989,1996,2000,2006,2020,2038,2051,2054,2053,2051,2051,2050,2040,2028,2022,2030,2049,2068,2077,2082,2087,2092,2097,2096,2090,2081,2072,2071,2080,2100,2121,2137,2143,2142,2138,2133,2132,2131,2128,2122,2115,2109,2103,2093,2080,2068,2062,2058,2048,2032,2020,2016,2020,2030,2046,2063,2071,2073,2076,2084,2087,2085,2084,2087,2090,2091,2092,2091,2085,2074,2065,2063,2069,2084,2103,2126,2142,2148,2148,2146,2145,2143,2144,2150,2156,2155,2145,2132,2118,2110,2109,2114,2119,2120,2123,2130,2138,2142,2136,2126,2121,2119,2115,2110,2110,2116,2117,2112,2110,2110,2105,2103,2103,2103,2100,2096,2095,2094,2090,2090,2093,2093,2088,2080,2070,2059,2050,2044,2041,2042,2053,2073,2092,2106,2111,2102,2086,2068,2057,2056,2063,2072,2076,2075,2075,2077,2083,2089,2094,2099,2103,2102,2099,2099,2100,2103,2103,2104,2103,2093,2074,2052,2036,2029,2024,2019,2015,2016,2014,2012,2008,2005,2004,2009,2017,2021,2018,2015,2015,2018,2024,2031,2035,2033,2030,2026,2019,2007,1992,1978,1968,1962,1958,1951,1946,1946,1948,1949,1947,1945,1941,1938,1942,1955,1968,1974,1977,1977,1977,1980,1980,1975,1974,1977,1980,1975,1963,1952,1944,1938,1937,1940,1937,1927,1921,1922,1926,1934,1942,1949,1955,1961,1970,1977,1984,1989,1996,2002,2007,2012,2009,1997,1986,1979,1974,1968,1961,1956,1947,1938,1938,1946,1954,1960,1964,1966,1974,1982,1984,1979,1970,1961,1952,1945,1945,1943,1935,1929,1925,1925,1923,1920,1920,1926,1932,1936,1941,1951,1964,1972,1980,1989,2000,2013,2031,2052,2066,2073,2075,2077,2075,2072,2068,2066,2066,2062,2057,2053,2050,2047,2042,2038,2036,2036,2036,2040,2043,2039,2033,2031,2033,2036,2041,2048,2052,2058,2072,2084,2091,2093,2094,2098,2103,2114,2125,2136,2142,2146,2156,2173,2192,2204,2205,2200,2194,2192,2195,2204,2215,2219,2217,2216,2216,2214,2209,2210,2215,2216,2214,2212,2210,2202,2194,2198,2212,2228,2235,2230,2217,2203,2196,2197,2202,2201,2194,2188,2183,2181,2177,2172,2171,2173,2174,2168,2157,2145,2140,2143,2151,2162,2172,2175,2171,2166,2162,2160,2162,2167,2169,2167,2165,2163,2159,2151,2145,2142,2136,2129,2125,2123,2124,2130,2134,2135,2135,2135,2131,2126,2123,2125,2129,2127,2121,2113,2102,2089,2079,2075,2077,2079,2076,2067,2063,2065,2070,2073,2076,2078,2079,2081,2083,2089,2097,2104,2110,2112,2108,2102,2092,2081,2075,2072,2068,2065,2062,2057,2048,2042,2041,2047,2053,2055,2055,2058,2065,2072,2076,2073,2063,2052,2043,2040,2042,2045,2050,2055,2056,2050,2037,2020,2007,2003,2002,2003,2005,2007,2007,2003,1997,1997,2002,2009,2019,2029,2034,2036,2038,2036,2027,2016,2008,2006,2009,2012,2011,2006,2000,1997,1993,1988,1984,1985,1988,1994,2000,2006,2013,2020,2022,2021,2020,2019,2017,2018,2022,2027,2034,2042,2046,2045,2041,2039,2042,2043,2040,2037,2034,2028,2023,2020,2018,2019,2023,2029,2036,2042,2044,2041,2034,2027,2020,2011,2004,2006,2013,2016,2014,2011,2005,1994,1982,1978,1985,1997,2008,2016,2020,2024,2030,2030,2024,2017,2017,2021,2027,2033,2038,2035,2027,2023,2020,2011,1995,1980,1974,1979,1990,1997,1997,1990,1982,1976,1974,1974,1969,1956,1943,1933,1929,1930,1927,1920,1911,1904,1895,1885,1881,1883,1885,1887,1889,1888,1881,1873,1868,1864,1862,1865,1873,1880,1883,1883,1881,1877,1871,1869,1871,1878,1886,1893,1900,1906,1911,1916,1916,1913,1912,1915,1919,1921,1924,1931,1937,1940,1942,1945,1948,1952,1957,1962,1966,1972,1979,1982,1985,1989,1995,2001,2007,2009,2009,2007,2010,2014,2015,2013,2006,1999,1996,1996,1992,1986,1983,1981,1978,1974,1969,1961,1948,1936,1927,1923,1920,1914,1908,1908,1909,1907,1909,1913,1918,1922,1927,1930,1926,1917,1907,1904,1911,1920,1923,1919,1915,1914,1918,1927,1936,1941,1941,1943,1950,1960,1968,1973,1978,1988,2001,2010,2012,2011,2013,2019,2030,2047,2066,2081,2084,2080,2075,2073,2075,2074,2068,2064,2064,2068,2068,2068,2070,2074,2078,2080,2078,2072,2066,2064,2066,2068,2069,2071,2076,2084,2092,2100,2106,2109,2110,2110,2110,2109,2112,2120,2129,2136,2140,2145,2151,2154,2154,2160,2167,2170,2171,2172,2175,2176,2177,2178,2181,2185,2192,2202,2211,2218,2227,2238,2242,2240,2242,2247,2247,2241,2233,2224,2216,2207,2201,2200,2201,2198,2189,2182,2185,2191,2194,2196,2195,2191,2190,2187,2178,2170,2161,2154,2154,2155,2152,2146,2143,2149,2161,2167,2170,2172,2175,2177,2180,2188,2200,2211,2218,2221,2223,2228,2236,2245,2246,2235,2222,2217,2217,2218,2216,2215,2217,2223,2227,2228,2225,2220,2216,2211,2206,2202,2196,2190,2188,2186,2182,2175,2167,2155,2138,2121,2110,2104,2099,2097,2097,2098,2098,2098,2095,2089,2082,2076,2070,2068,2069,2070,2069,2065,2059,2057,2057,2056,2054,2045,2037,2041,2047,2047,2039,2031,2028,2029,2028,2023,2016,2009,2006,2009,2013,2018,2022,2024,2020,2009,2000,1998,1997,1992,1985,1983,1986,1990,1995,1999,2000,1997,1996,1996,1999,2002,2002,2002,2002,2005,2010,2013,2015,2015,2012,2009,2011,2023,2039,2050,2049,2043,2032,2016,2002,1992,1983,1975,1969,1962,1959,1961,1965,1969,1971,1971,1971,1972,1975,1972,1967,1963,1965,1968,1971,1971,1964,1951,1943,1946,1947,1942,1939,1939,1943,1949,1955,1953,1950,1952,1962,1978,1990,1993,1992,1994,1996,1995,1994,1995,1991,1984,1982,1985,1989,1987,1983,1981,1982,1986,1990,1991,1989,1987,1984,1979,1973,1969,1968,1967,1968,1968,1965,1956,1949,1942,1933,1923,1914,1914,1918,1924,1932,1943,1951,1956,1960,1967,1980,1991,1996,1994,1991,1995,2002,2002,1998,1992,1987,1991,2002,2013,2014,2005,1992,1988,1989,1989,1989,1987,1982,1975,1972,1976,1980,1982,1987,1993,1999,2005,2008,2002,1990,1981,1977,1980,1990,2002,2010,2012,2011,2014,2020,2028,2036,2040,2038,2036,2043,2055,2068,2074,2075,2076,2082,2092,2102,2103,2101,2103,2105,2103,2099,2094,2093,2096,2097,2093,2090,2091,2090,2087,2085,2089,2093,2095,2095,2090,2082,2077,2071,2063,2055,2048,2044,2043,2046,2049,2053,2058,2064,2065,2065,2071,2081,2092,2099,2102,2103,2107,2112,2117,2121,2123,2128,2137,2151,2164,2167,2162,2155,2143,2131,2124,2120,2118,2115,2110,2104,2102,2102,2101,2099,2094,2089,2084,2076,2067,2061,2059,2059,2056,2050,2042,2033,2021,2012,2011,2013,2014,2019,2029,2038,2043,2044,2038,2028,2018,2017,2031,2045,2051,2054,2058,2061,2059,2055,2049,2042,2040,2049,2061,2066,2065,2064,2066,2072,2080,2087,2092,2091,2089,2088,2087,2084,2083,2083,2081,2087,2101,2112,2108,2096,2085,2081,2080,2078,2078,2078,2073,2068,2069,2075,2077,2078,2082,2087,2089,2087,2080,2073,2076,2088,2098,2105,2117,2126,2131,2136,2142,2139,2129,2118,2112,2109,2109,2112,2116,2118,2118,2115,2113,2115,2116,2115,2115,2121,2131,2137,2134,2126,2120,2115,2114,2114,2113,2108,2102,2098,2099,2101,2108,2118,2127,2127,2122,2114,2108,2104,2100,2096,2093,2091,2094,2101,2106,2106,2106,2108,2108,2104,2101,2098,2095,2089,2080,2072,2067,2061,2049,2041,2040,2045,2048,2043,2025,2000,1980,1964,1952,1943,1936,1934,1932,1928,1925,1926,1927,1927,1924,1920,1920,1924,1926,1925,1921,1920,1920,1921,1925,1928,1921,1914,1917,1928,1939,1945,1945,1938,1924,1911,1905,1903,1902,1898,1890,1884,1883,1882,1879,1875,1867,1859,1852,1849,1847,1844,1839,1836,1834,1828,1817,1809,1806,1809,1815,1819,1818,1817,1822,1830,1834,1832,1829,1830,1836,1843,1849,1854,1855,1855,1860,1865,1861,1852,1841,1831,1831,1840,1853,1861,1862,1861,1862,1867,1876,1884,1890,1892,1895,1902,1907,1904,1898,1898,1900,1903,1910,1922,1930,1930,1927,1926,1928,1933,1940,1951,1963,1970,1976,1982,1984,1985,1988,1994,2003,2014,2022,2029,2039,2051,2063,2071,2082,2093,2099,2105,2119,2134,2141,2147,2157,2166,2170,2168,2166,2161,2149,2135,2129,2134,2145,2153,2156,2159,2167,2175,2180,2181,2176,2170,2168,2168,2169,2171,2169,2167,2172,2181,2191,2200,2205,2206,2206,2201,2191,2182,2174,2170,2175,2185,2198,2207,2208,2209,2214,2223,2231,2233,2231,2231,2228,2220,2213,2207,2201,2195,2192,2190,2187,2185,2186,2191,2195,2198,2201,2200,2197,2195,2189,2183,2182,2180,2176,2174,2176,2178,2181,2183,2182,2177,2169,2161,2155,2155,2154,2147,2138,2128,2124,2126,2131,2138,2147,2156,2167,2173,2173,2169,2160,2151,2150,2148,2140,2127,2118,2117,2121,2124,2128,2130,2129,2127,2127,2128,2127,2122,2117,2116,2118,2117,2114,2107,2101,2094,2087,2077,2067,2059,2053,2049,2051,2060,2074,2088,2096,2098,2100,2101,2097,2085,2068,2050,2036,2019,2000,1985,1977,1974,1976,1982,1989,1995,1999,2000,2001,1997,1989,1981,1976,1971,1963,1956,1957,1964,1973,1985,1991,1988,1978,1969,1968,1971,1976,1979,1984,1996,2012,2026,2035,2040,2043,2045,2049,2059,2064,2067,2071,2074,2076,2079,2084,2088,2088,2091,2095,2095,2092,2089,2091,2092,2088,2083,2081,2077,2064,2044,2028,2024,2031,2047,2065,2084,2099,2105,2100,2092,2084,2076,2067,2061,2061,2068,2076,2085,2095,2101,2101,2094,2086,2078,2069,2059,2054,2056,2062,2069,2078,2089,2097,2099,2097,2092,2084,2080,2076,2072,2073,2077,2078,2073,2067,2060,2054,2052,2057,2065,2069,2071,2072,2070,2066,2060,2056,2055,2057,2059,2058,2056,2051,2042,2035,2035,2040,2043,2042,2041,2038,2031,2021,2013,2009,2011,2012,2011,2007,1999,1996,1997,1999,2002,2004,2009,2015,2025,2038,2051,2058,2062,2063,2063,2061,2058,2053,2047,2043,2043,2043,2044,2046,2045,2039,2029,2024,2025,2026,2029,2032,2034,2036,2037,2031,2016,1999,1984,1975,1971,1969,1972,1975,1977,1981,1986,1986,1987,1990,1994,1997,1994,1984,1968,1950,1929,1911,1901,1900,1904,1909,1916,1926,1931,1928,1922,1916,1911,1906,1902,1901,1902,1902,1902,1904,1908,1912,1914,1910,1902,1894,1891,1898,1913,1923,1927,1935,1950,1965,1975,1981,1985,1991,1996,2002,2008,2006,2001,1999,1998,1999,1999,1998,2000,2007,2017,2025,2029,2025,2020,2026,2036,2039,2032,2022,2016,2016,2020,2025,2025,2023,2031,2047,2062,2077,2082,2076,2067,2056,2044,2032,2025,2028,2042,2061,2080,2095,2102,2096,2080,2061,2047,2044,2055,2073,2088,2096,2099,2098,2090,2081,2078,2077,2075,2073,2067,2058,2055,2056,2055,2049,2039,2031,2028,2031,2037,2043,2050,2058,2063,2063,2060,2058,2056,2053,2052,2052,2053,2056,2062,2069,2071,2071,2076,2082,2080,2076,2076,2080,2087,2093,2097,2102,2109,2119,2129,2136,2139,2135,2125,2115,2113,2119,2131,2142,2148,2151,2153,2151,2143,2135,2134,2136,2135,2133,2128,2121,2115,2110,2107,2109,2112,2108,2097,2089,2088,2092,2098,2104,2106,2101,2088,2074,2057,2042,2031,2024,2024,2029,2034,2038,2040,2046,2053,2053,2047,2041,2038,2040,2042,2038,2028,2017,2008,1999,1991,1988,1989,1991,1996,2006,2007,1994,1977,1970,1976,1987,1994,1997,1997,1999,2004,2008,2012,2016,2014,2009,2003,1998,1996,2001,2013,2029,2044,2053,2055,2049,2038,2028,2027,2030,2037,2044,2052,2058,2060,2062,2064,2059,2050,2041,2038,2036,2035,2034,2035,2037,2042,2049,2055,2055,2050,2048,2048,2049,2050,2050,2047,2040,2034,2030,2028,2024,2011,1997,1988,1983,1978,1973,1973,1979,1980,1978,1975,1964,1948,1937,1932,1928,1922,1921,1928,1942,1956,1962,1960,1958,1958,1962,1967,1972,1974,1974,1979,1985,1982,1969,1955,1949,1954,1963,1971,1975,1973,1969,1968,1967,1965,1963,1963,1966,1974,1981,1983,1984,1986,1989,1991,1993,1993,1991,1986,1983,1983,1989,1996,2000,1999,1993,1990,1989,1989,1994,2002,2006,2002,1995,1990,1993,1997,2003,2005,1996,1977,1961,1955,1956,1957,1959,1967,1977,1980,1977,1972,1970,1970,1969,1972,1982,1994,2001,2004,2008,2014,2022,2028,2026,2018,2009,2005,2005,2007,2007,2006,2006,2007,2008,2005,1999,1994,1992,1994,1999,2008,2016,2021,2022,2022,2020,2019,2019,2015,2006,1999,1999,2005,2009,2012,2016,2018,2021,2025,2033,2040,2037,2031,2027,2029,2038,2052,2063,2068,2067,2067,2074,2080,2083,2084,2089,2099,2110,2120,2125,2123,2119,2115,2115,2116,2116,2117,2118,2121,2124,2124,2122,2121,2124,2128,2133,2135,2135,2135,2134,2133,2133,2141,2157,2174,2190,2203,2209,2209,2210,2214,2215,2214,2215,2216,2211,2202,2189,2183,2186,2199,2213,2222,2229,2235,2240,2239,2233,2220,2201,2185,2178,2178,2184,2195,2204,2207,2202,2195,2185,2175,2170,2172,2179,2187,2192,2189,2182,2177,2174,2166,2155,2153,2166,2186,2200,2207,2206,2200,2194,2192,2189,2179,2168,2162,2166,2176,2186,2196,2203,2203,2201,2202,2207,2209,2203,2197,2193,2195,2197,2193,2185,2177,2172,2170,2170,2172,2174,2174,2171,2166,2160,2155,2151,2147,2142,2136,2131,2127,2125,2121,2114,2108,2111,2118,2117,2106,2095,2088,2081,2075,2071,2068,2065,2065,2066,2070,2078,2085,2086,2082,2076,2073,2075,2081,2091,2097,2097,2098,2099,2096,2088,2079,2074,2075,2084,2095,2104,2108,2110,2108,2108,2108,2102,2091,2079,2071,2071,2076,2081,2082,2076,2071,2066,2061,2056,2049,2044,2040,2038,2039,2044,2050,2053,2052,2049,2041,2028,2014,2007,2007,2011,2010,2006,2000,1993,1984,1975,1968,1961,1957,1958,1960,1957,1950,1946,1941,1933,1927,1923,1921,1923,1924,1919,1911,1904,1899,1896,1898,1907,1916,1921,1924,1926,1925,1920,1913,1908,1904,1903,1904,1906,1903,1894,1886,1883,1888,1897,1905,1910,1916,1919,1917,1911,1904,1893,1875,1859,1851,1851,1859,1871,1881,1884,1879,1874,1870,1864,1859,1857,1855,1857,1859,1858,1853,1849,1850,1852,1851,1852,1855,1858,1861,1863,1863,1860,1855,1851,1845,1835,1829,1827,1831,1841,1858,1874,1885,1893,1900,1902,1900,1899,1903,1909,1916,1922,1925,1926,1930,1938,1949,1960,1966,1968,1967,1967,1968,1968,1965,1962,1962,1963,1965,1969,1973,1975,1973,1971,1972,1976,1980,1981,1979,1976,1971,1961,1952,1948,1946,1941,1937,1939,1947,1956,1967,1973,1969,1962,1962,1970,1983,1994,2000,2000,1999,1997,1998,2004,2011,2017,2021,2023,2025,2025,2025,2027,2036,2049,2064,2078,2084,2080,2072,2069,2074,2082,2087,2088,2082,2074,2068,2067,2070,2073,2076,2084,2096,2107,2115,2120,2122,2126,2130,2132,2126,2113,2098,2092,2093,2099,2104,2104,2101,2101,2103,2106,2107,2112,2123,2135,2147,2155,2154,2142,2129,2121,2123,2128,2130,2125,2116,2110,2112,2122,2132,2143,2152,2155,2153,2151,2146,2137,2127,2121,2121,2120,2116,2111,2105,2100,2095,2094,2099,2108,2119,2130,2141,2148,2149,2144,2136,2126,2114,2101,2093,2089,2087,2092,2104,2118,2130,2136,2141,2145,2147,2146,2146,2147,2153,2164,2178,2193,2202,2206,2203,2197,2195,2196,2199,2200,2198,2192,2188,2186,2182,2172,2162,2157,2156,2158,2165,2172,2170,2165,2165,2168,2164,2152,2139,2128,2123,2123,2128,2133,2138,2143,2141,2134,2121,2107,2097,2096,2099,2103,2107,2110,2111,2110,2108,2104,2100,2095,2089,2087,2090,2097,2107,2121,2137,2147,2144,2130,2108,2087,2076,2076,2082,2090,2098,2103,2103,2096,2087,2075,2066,2059,2056,2057,2058,2056,2049,2040,2032,2028,2027,2027,2024,2014,1999,1986,1984,1992,2005,2017,2026,2028,2022,2006,1989,1971,1960,1957,1963,1972,1975,1970,1959,1949,1943,1941,1940,1939,1940,1945,1958,1976,1991,1995,1990,1982,1975,1968,1962,1958,1957,1962,1972,1982,1987,1993,2005,2014,2012,2006,2009,2024,2043,2063,2077,2079,2070,2059,2053,2050,2048,2042,2032,2028,2032,2043,2054,2062,2062,2054,2041,2028,2017,2007,1999,1997,1999,2002,2000,1991,1976,1962,1954,1954,1960,1969,1976,1978,1975,1971,1968,1970,1975,1975,1972,1970,1974,1980,1986,1993,2002,2012,2020,2022,2017,2008,2002,2005,2018,2034,2050,2064,2075,2080,2080,2078,2074,2069,2063,2060,2061,2065,2070,2071,2067,2065,2064,2061,2058,2059,2063,2064,2065,2068,2071,2070,2063,2058,2055,2055,2055,2052,2049,2048,2055,2066,2073,2076,2073,2065,2053,2042,2038,2042,2049,2057,2063,2063,2061,2057,2052,2046,2040,2040,2046,2050,2051,2055,2064,2074,2079,2077,2073,2070,2067,2066,2068,2073,2075,2073,2071,2069,2065,2060,2059,2059,2059,2060,2068,2081,2092,2097,2092,2082,2071,2063,2061,2064,2069,2072,2071,2071,2074,2077,2080,2081,2081,2077,2070,2063,2057,2049,2037,2025,2018,2018,2018,2012,2001,1990,1982,1977,1973,1970,1964,1962,1969,1984,1996,1999,1999,1999,1998,2000,2005,2004,1992,1977,1969,1965,1967,1978,1993,2001,1995,1983,1979,1986,1994,1996,1990,1980,1970,1969,1976,1982,1979,1969,1959,1954,1953,1953,1951,1947,1949,1954,1956,1954,1948,1941,1937,1938,1947,1956,1960,1960,1960,1958,1955,1959,1971,1982,1986,1981,1973,1969,1970,1977,1981,1981,1978,1975,1978,1986,1995,2004,2010,2014,2019,2024,2024,2018,2013,2014,2022,2033,2039,2037,2029,2020,2016,2020,2027,2028,2020,2009,2002,2002,2011,2024,2034,2036,2030,2023,2017,2016,2021,2031,2040,2044,2047,2050,2052,2052,2056,2065,2079,2090,2096,2096,2094,2089,2085,2085,2090,2096,2102,2108,2111,2112,2112,2113,2113,2109,2107,2106,2105,2103,2098,2094,2093,2093,2093,2095,2096,2094,2089,2082,2079,2083,2092,2103,2115,2123,2124,2119,2109,2102,2103,2109,2118,2125,2131,2134,2140,2148,2152,2151,2150,2154,2162,2170,2173,2170,2166,2172,2184,2193,2196,2192,2189,2191,2198,2206,2211,2210,2210,2210,2207,2199,2189,2182,2180,2177,2172,2165,2156,2154,2157,2159,2157,2155,2155,2158,2164,2167,2163,2154,2148,2148,2147,2143,2136,2128,2122,2118,2122,2133,2146,2157,2158,2150,2141,2137,2139,2138,2131,2122,2114,2114,2118,2118,2112,2105,2100,2097,2096,2092,2086,2083,2087,2095,2098,2096,2089,2081,2078,2082,2088,2089,2084,2075,2069,2069,2073,2083,2093,2100,2101,2099,2095,2093,2095,2099,2100,2097,2092,2083,2076,2073,2073,2077,2080,2081,2080,2080,2077,2072,2068,2072,2078,2082,2083,2079,2065,2047,2035,2037,2048,2059,2058,2045,2026,2013,2012,2020,2027,2028,2026,2020,2012,2008,2010,2015,2017,2014,2011,2010,2003,1993,1989,1992,1999,2004,2006,2000,1983,1960,1946,1946,1954,1964,1971,1970,1960,1949,1943,1943,1946,1948,1950,1953,1956,1954,1944,1928,1920,1922,1930,1942,1947,1939,1930,1927,1931,1934,1935,1936,1936,1936,1937,1934,1925,1915,1914,1923,1934,1938,1935,1932,1931,1934,1937,1937,1933,1930,1933,1939,1938,1931,1926,1931,1940,1945,1942,1932,1921,1914,1917,1929,1942,1949,1951,1950,1946,1941,1939,1941,1942,1934,1921,1910,1909,1915,1921,1918,1908,1896,1894,1904,1919,1926,1923,1919,1917,1919,1922,1925,1925,1928,1936,1942,1943,1940,1941,1946,1956,1967,1972,1969,1960,1957,1962,1973,1983,1991,1994,1993,1989,1987,1990,2000,2010,2018,2022,2027,2037,2047,2051,2048,2039,2030,2027,2029,2029,2021,2011,2007,2012,2020,2021,2014,2009,2012,2025,2037,2042,2038,2034,2034,2041,2050,2056,2059,2061,2066,2069,2066,2055,2044,2043,2052,2062,2070,2074,2072,2064,2059,2063,2069,2070,2067,2068,2071,2074,2076,2077,2076,2072,2068,2071,2078,2082,2084,2086,2090,2095,2098,2096,2091,2085,2085,2094,2105,2110,2108,2101,2092,2089,2096,2107,2113,2108,2098,2089,2082,2079,2079,2084,2086,2084,2077,2071,2070,2070,2075,2085,2093,2095,2088,2079,2071,2065,2060,2065,2078,2089,2092,2090,2083,2078,2075,2076,2077,2073,2066,2059,2056,2058,2063,2070,2074,2070,2059,2048,2044,2047,2053,2059,2062,2060,2053,2046,2038,2033,2032,2034,2036,2040,2041,2034,2021,2009,2007,2013,2023,2029,2032,2037,2047,2058,2065,2062,2053,2045,2040,2039,2040,2042,2045,2048,2052,2052,2048,2046,2053,2063,2068,2063,2051,2041,2037,2039,2040,2039,2036,2033,2030,2029,2029,2025,2021,2018,2015,2008,1996,1988,1987,1989,1992,1995,1995,1990,1984,1981,1978,1977,1979,1985,1993,2000,2007,2012,2012,2007,2001,1995,1992,1991,1987,1978,1967,1960,1957,1957,1957,1956,1953,1948,1949,1961,1972,1979,1979,1977,1978,1980,1984,1991,1996,2002,2009,2012,2010,2007,2005,2006,2011,2021,2031,2035,2033,2032,2033,2035,2036,2041,2049,2058,2065,2070,2073,2076,2080,2082,2086,2093,2101,2109,2117,2120,2118,2113,2107,2103,2101,2103,2110,2121,2129,2129,2125,2121,2118,2118,2121,2122,2122,2123,2123,2122,2119,2117,2122,2133,2143,2146,2139,2128,2121,2120,2128,2139,2146,2148,2146,2144,2140,2133,2128,2135,2153,2171,2176,2165,2145,2131,2132,2146,2162,2169,2165,2158,2154,2157,2166,2172,2173,2168,2163,2163,2165,2165,2164,2166,2171,2177,2179,2173,2166,2163,2163,2165,2168,2173,2180,2184,2186,2189,2193,2200,2208,2217,2225,2230,2231,2229,2224,2219,2220,2226,2232,2235,2230,2221,2214,2214,2220,2225,2228,2231,2236,2236,2230,2220,2213,2212,2210,2204,2196,2190,2189,2195,2202,2203,2196,2185,2172,2161,2152,2144,2137,2132,2127,2122,2113,2103,2093,2086,2083,2080,2077,2074,2067,2060,2055,2055,2054,2048,2040,2031,2024,2020,2020,2022,2020,2014,2008,2001,1996,1996,2001,2005,2004,2001,2002,2008,2014,2018,2017,2015,2015,2017,2023,2028,2026,2018,2010,2008,2011,2011,2008,2009,2015,2023,2028,2026,2017,2004,1990,1985,1987,1991,1992,1989,1989,1991,1997,2001,2000,1998,1998,2000,2002,2000,1991,1978,1968,1966,1970,1976,1980,1982,1981,1983,1988,1988,1979,1968,1959,1957,1960,1966,1974,1978,1977,1970,1965,1966,1970,1973,1975,1977,1976,1975,1976,1983,1993,1999,2001,1999,1993,1983,1972,1966,1970,1975,1974,1964,1947,1930,1923,1930,1948,1965,1974,1973,1963,1947,1931,1920,1917,1924,1936,1940,1936,1931,1931,1938,1946,1953,1953,1945,1928,1912,1907,1915,1929,1939,1944,1948,1957,1965,1968,1964,1961,1965,1977,1991,1998,1991,1978,1974,1985,2005,2027,2041,2038,2022,2003,1990,1991,2001,2010,2009,1999,1988,1976,1964,1956,1959,1967,1972,1970,1962,1949,1938,1943,1959,1969,1965,1951,1934,1919,1910,1910,1918,1927,1935,1941,1940,1931,1917,1908,1908,1915,1924,1929,1921,1898,1874,1867,1878,1895,1906,1907,1905,1908,1920,1934,1938,1929,1910,1891,1881,1888,1904,1916,1917,1912,1911,1920,1934,1941,1939,1934,1933,1938,1942,1944,1946,1945,1943,1948,1958,1967,1973,1983,1997,2009,2015,2015,2007,1991,1971,1960,1960,1963,1967,1973,1985,2001,2014,2015,2005,1991,1983,1987,1998,2007,2005,1993,1985,1988,2004,2027,2047,2057,2061,2067,2078,2083,2077,2061,2048,2052,2076,2101,2110,2103,2092,2093,2106,2121,2132,2138,2145,2154,2163,2165,2158,2149,2151,2166,2188,2205,2205,2193,2176,2164,2161,2165,2169,2171,2170,2168,2164,2160,2161,2171,2188,2200,2195,2176,2153,2142,2152,2173,2187,2183,2169,2162,2169,2179,2182,2175,2165,2157,2157,2163,2172,2179,2181,2177,2168,2158,2152,2149,2145,2143,2151,2170,2188,2192,2180,2160,2151,2164,2193,2220,2235,2235,2224,2205,2191,2186,2191,2201,2211,2217,2217,2209,2190,2169,2156,2161,2177,2187,2185,2176,2160,2149,2150,2160,2170,2167,2151,2131,2114,2107,2112,2121,2130,2137,2143,2145,2141,2131,2117,2103,2094,2090,2092,2092,2086,2074,2061,2053,2051,2052,2053,2057,2064,2073,2075,2067,2051,2035,2027,2027,2031,2036,2043,2048,2050,2051,2051,2047,2043,2046,2050,2053,2049,2042,2038,2038,2043,2049,2055,2063,2073,2082,2087,2086,2081,2075,2070,2064,2058,2055,2054,2057,2058,2055,2052,2050,2051,2051,2049,2047,2045,2040,2031,2021,2018,2021,2025,2029,2031,2029,2022,2018,2023,2036,2048,2048,2036,2018,2000,1987,1982,1989,1998,2000,1998,1997,1998,2000,2002,2005,2010,2016,2025,2032,2031,2023,2013,2008,2011,2020,2030,2034,2029,2018,2009,2006,2012,2023,2030,2028,2017,2004,1996,2002,2019,2032,2031,2017,2000,1993,2000,2014,2027,2033,2034,2035,2035,2032,2027,2022,2021,2025,2035,2049,2062,2064,2054,2039,2027,2021,2020,2019,2017,2014,2012,2016,2024,2030,2026,2018,2010,2008,2013,2015,2009,1997,1988,1981,1977,1976,1977,1976,1973,1972,1973,1972,1966,1955,1948,1948,1958,1967,1968,1963,1957,1953,1952,1955,1960,1964,1966,1965,1963,1958,1953,1951,1951,1951,1952,1953,1953,1949,1942,1936,1933,1936,1944,1951,1951,1941,1924,1912,1907,1910,1917,1926,1933,1934,1929,1922,1914,1910,1914,1929,1948,1958,1953,1943,1938,1938,1940,1941,1946,1956,1967,1974,1971,1964,1957,1954,1956,1961,1964,1962,1958,1955,1956,1961,1969,1975,1975,1967,1956,1946,1943,1951,1969,1985,1992,1991,1984,1978,1975,1977,1982,1990,1996,2000,2000,2002,2011,2021,2026,2022,2014,2009,2012,2025,2039,2045,2037,2025,2020,2022,2028,2029,2022,2007,1995,1992,1996,2001,2009,2019,2024,2024,2020,2012,1999,1991,1997,2016,2036,2048,2044,2031,2022,2023,2036,2052,2067,2074,2071,2065,2063,2068,2076,2086,2097,2107,2114,2116,2114,2113,2118,2129,2140,2149,2151,2149,2145,2143,2144,2147,2150,2152,2157,2168,2182,2193,2196,2192,2186,2178,2172,2173,2178,2183,2188,2194,2200,2203,2200,2194,2190,2192,2197,2202,2204,2201,2198,2197,2196,2196,2199,2204,2206,2203,2195,2190,2192,2201,2212,2216,2208,2191,2173,2163,2161,2167,2175,2184,2192,2196,2196,2194,2189,2182,2174,2171,2173,2173,2166,2161,2167,2181,2195,2198,2191,2181,2171,2165,2164,2166,2167,2168,2167,2167,2165,2161,2155,2149,2145,2142,2139,2135,2132,2133,2135,2136,2134,2132,2126,2118,2111,2107,2108,2109,2109,2108,2107,2105,2100,2094,2090,2094,2102,2106,2105,2099,2091,2086,2088,2093,2098,2098,2091,2084,2080,2082,2091,2103,2110,2109,2104,2100,2100,2101,2102,2105,2108,2108,2105,2101,2097,2091,2084,2080,2079,2082,2087,2093,2093,2089,2084,2081,2078,2073,2064,2052,2043,2039,2040,2046,2048,2042,2031,2022,2015,2005,1990,1974,1960,1950,1944,1942,1941,1941,1940,1936,1932,1927,1924,1924,1930,1937,1942,1944,1943,1939,1933,1927,1922,1921,1926,1932,1935,1935,1932,1932,1935,1939,1941,1938,1935,1935,1934,1927,1918,1910,1910,1923,1943,1956,1956,1949,1943,1940,1940,1944,1949,1951,1952,1952,1950,1943,1935,1931,1933,1934,1930,1924,1925,1930,1935,1938,1940,1940,1942,1947,1951,1951,1946,1944,1949,1956,1962,1958,1946,1934,1927,1924,1922,1921,1921,1921,1921,1923,1923,1918,1910,1905,1906,1908,1909,1909,1913,1920,1927,1932,1935,1933,1928,1925,1928,1935,1944,1950,1950,1945,1941,1939,1939,1941,1943,1943,1940,1939,1941,1944,1947,1950,1953,1954,1952,1952,1954,1955,1957,1961,1966,1970,1969,1965,1962,1960,1963,1970,1981,1992,2002,2011,2016,2016,2012,2009,2012,2022,2034,2042,2043,2041,2040,2042,2044,2046,2050,2051,2052,2055,2061,2066,2071,2075,2077,2075,2070,2069,2073,2075,2073,2073,2077,2086,2094,2098,2096,2088,2079,2079,2086,2090,2091,2092,2095,2099,2102,2101,2094,2085,2080,2082,2090,2099,2100,2091,2080,2074,2072,2070,2070,2073,2076,2080,2083,2085,2085,2082,2081,2085,2090,2095,2097,2095,2092,2089,2087,2083,2078,2074,2073,2076,2080,2084,2089,2094,2095,2093,2090,2090,2093,2095,2095,2097,2102,2107,2111,2114,2117,2120,2121,2124,2130,2137,2142,2144,2146,2147,2147,2144,2141,2142,2147,2148,2145,2140,2140,2143,2142,2139,2137,2137,2139,2143,2148,2146,2141,2138,2139,2140,2135,2127,2120,2116,2117,2117,2112,2100,2088,2081,2078,2075,2066,2051,2040,2038,2041,2044,2045,2043,2040,2037,2034,2029,2023,2019,2020,2026,2030,2030,2023,2013,2004,2000,1999,1999,1998,1994,1990,1989,1988,1984,1981,1980,1981,1981,1983,1987,1991,1994,1996,1997,1997,1999,1999,2000,2002,2005,2010,2016,2023,2031,2038,2045,2050,2054,2056,2055,2053,2056,2062,2070,2079,2087,2091,2091,2088,2087,2089,2092,2098,2105,2110,2112,2114,2115,2116,2116,2115,2109,2100,2094,2092,2096,2100,2100,2096,2092,2091,2092,2091,2087,2083,2080,2081,2084,2086,2089,2092,2097,2102,2106,2107,2102,2098,2100,2108,2117,2125,2132,2134,2132,2132,2135,2137,2136,2136,2138,2141,2143,2145,2146,2149,2154,2162,2170,2175,2176,2169,2161,2155,2151,2149,2148,2150,2153,2154,2153,2151,2150,2150,2154,2163,2171,2169,2158,2147,2142,2141,2141,2142,2143,2140,2135,2134,2134,2134,2134,2137,2140,2139,2132,2124,2119,2117,2118,2122,2126,2126,2121,2113,2106,2100,2096,2092,2089,2089,2092,2095,2095,2094,2093,2086,2073,2064,2058,2053,2051,2055,2058,2057,2055,2054,2052,2048,2043,2036,2027,2023,2024,2026,2028,2030,2030,2026,2021,2015,2009,2002,2002,2005,2010,2012,2009,2001,1995,1992,1990,1990,1989,1985,1978,1970,1965,1962,1956,1951,1949,1949,1951,1955,1960,1964,1962,1954,1944,1935,1930,1927,1923,1924,1929,1936,1943,1946,1946,1946,1945,1948,1955,1959,1957,1953,1950,1951,1956,1961,1964,1960,1956,1960,1969,1975,1978,1981,1985,1988,1992,1995,1994,1991,1989,1988,1987,1984,1979,1972,1971,1974,1975,1978,1984,1986,1981,1976,1976,1974,1969,1966,1967,1967,1962,1958,1956,1956,1957,1958,1960,1960,1959,1958,1954,1949,1947,1949,1950,1946,1938,1930,1923,1917,1915,1916,1920,1926,1932,1937,1940,1939,1938,1941,1943,1941,1936,1930,1927,1924,1920,1917,1917,1919,1919,1917,1918,1924,1930,1938,1948,1952,1947,1937,1928,1923,1921,1926,1940,1955,1965,1968,1967,1963,1956,1952,1954,1964,1974,1979,1980,1980,1978,1974,1974,1982,1991,1994,1994,1995,1998,1998,1998,2000,2002,1999,1994,1990,1989,1987,1985,1983,1981,1977,1972,1969,1971,1973,1972,1969,1967,1966,1963,1962,1963,1967,1973,1980,1985,1988,1995,2007,2016,2019,2016,2009,2002,1999,2001,2006,2013,2020,2028,2035,2039,2041,2041,2041,2039,2036,2037,2046,2056,2064,2069,2073,2074,2074,2077,2085,2094,2096,2095,2096,2099,2104,2110,2114,2114,2115,2121,2128,2132,2136,2139,2144,2152,2160,2162,2160,2158,2157,2157,2158,2159,2158,2158,2162,2172,2183,2192,2197,2201,2204,2205,2205,2204,2202,2200,2199,2200,2199,2193,2187,2186,2189,2192,2196,2205,2214,2215,2211,2208,2206,2200,2194,2193,2194,2191,2183,2177,2178,2183,2185,2187,2190,2190,2184,2178,2175,2175,2172,2165,2156,2146,2136,2130,2129,2130,2132,2136,2143,2150,2153,2153,2152,2152,2152,2151,2149,2149,2145,2138,2133,2131,2130,2127,2127,2128,2128,2127,2128,2129,2127,2126,2125,2124,2124,2122,2119,2115,2113,2116,2122,2127,2130,2131,2130,2128,2126,2124,2122,2123,2125,2127,2127,2125,2122,2119,2118,2120,2124,2128,2134,2137,2139,2138,2135,2130,2126,2125,2126,2127,2131,2135,2136,2134,2131,2128,2125,2124,2123,2121,2119,2115,2112,2109,2107,2106,2108,2111,2113,2112,2107,2101,2100,2102,2101,2097,2089,2079,2069,2061,2057,2057,2058,2055,2051,2047,2043,2037,2030,2022,2016,2012,2010,2011,2010,2008,2005,2004,2004,2005,2006,2007,2007,2007,2010,2014,2017,2014,2005,1994,1987,1985,1985,1988,1993,1997,1999,2003,2010,2016,2018,2014,2005,1994,1985,1979,1979,1984,1990,1996,2000,2005,2007,2008,2008,2008,2004,1999,1993,1985,1978,1973,1971,1971,1970,1969,1969,1969,1967,1964,1961,1957,1952,1947,1946,1947,1946,1944,1944,1945,1944,1941,1940,1941,1940,1935,1931,1927,1923,1919,1915,1911,1908,1905,1900,1895,1891,1889,1889,1891,1893,1898,1903,1908,1910,1908,1904,1901,1901,1900,1900,1901,1904,1906,1905,1905,1906,1908,1909,1909,1909,1909,1909,1908,1908,1906,1904,1904,1907,1914,1920,1924,1928,1931,1935,1939,1944,1950,1957,1961,1966,1971,1974,1975,1976,1980,1984,1986,1987,1987,1986,1982,1979,1980,1984,1988,1992,1994,1995,1998,2006,2015,2023,2027,2030,2035,2043,2049,2052,2053,2053,2055,2055,2055,2057,2060,2061,2060,2058,2056,2055,2056,2059,2064,2068,2070,2070,2069,2065,2060,2055,2053,2054,2059,2065,2070,2076,2082,2088,2091,2089,2084,2076,2070,2069,2074,2082,2088,2092,2095,2096,2096,2096,2097,2098,2098,2096,2094,2093,2096,2098,2100,2100,2101,2104,2106,2108,2109,2109,2109,2111,2114,2114,2112,2111,2111,2109,2104,2100,2096,2093,2092,2093,2095,2096,2098,2099,2101,2103,2103,2102,2099,2095,2091,2089,2089,2089,2090,2090,2093,2097,2100,2099,2095,2093,2092,2093,2092,2090,2089,2087,2085,2082,2080,2080,2080,2081,2080,2080,2077,2072,2071,2074,2080,2083,2081,2076,2072,2070,2072,2076,2081,2085,2083,2080,2079,2076,2072,2067,2065,2068,2073,2080,2088,2093,2092,2086,2078,2070,2064,2061,2063,2066,2068,2070,2071,2069,2066,2063,2060,2058,2056,2053,2052,2054,2057,2059,2060,2061,2061,2059,2054,2047,2043,2042,2046,2055,2066,2073,2075,2074,2072,2068,2063,2059,2055,2053,2052,2052,2050,2048,2046,2047,2048,2051,2056,2062,2068,2073,2078,2081,2082,2081,2080,2079,2081,2082,2082,2082,2083,2084,2083,2078,2074,2072,2070,2069,2071,2071,2068,2065,2064,2062,2058,2052,2048,2047,2045,2044,2044,2043,2043,2045,2049,2051,2050,2047,2044,2041,2039,2038,2039,2040,2043,2046,2048,2047,2045,2041,2038,2035,2032,2030,2029,2031,2033,2034,2036,2037,2038,2038,2038,2037,2038,2039,2039,2037,2034,2031,2028,2027,2025,2024,2022,2020,2019,2020,2023,2026,2026,2028,2032,2037,2040,2040,2038,2036,2032,2028,2029,2033,2040,2047,2053,2058,2059,2057,2055,2054,2053,2054,2056,2056,2057,2056,2054,2052,2051,2050,2050,2049,2047,2046,2046,2047,2048,2049,2050,2051,2053,2055,2057,2059,2059,2057,2057,2058,2059,2058,2056,2051,2043,2036,2030,2028,2028,2030,2031,2032,2033,2030,2024,2018,2015,2017,2023,2029,2035,2038,2039,2039,2038,2037,2036,2036,2036,2038,2041,2044,2046,2046,2043,2041,2041,2042,2041,2038,2034,2030,2028,2029,2033,2039,2043,2044,2045,2047,2049,2050,2049,2046,2043,2040,2034,2029,2026,2026,2027,2026,2027,2029,2031,2033,2033,2032,2030,2028,2028,2032,2036,2040,2043,2047,2051,2054,2055,2052,2049,2047,2045,2044,2043,2043,2043,2043,2042,2041,2038,2034,2029,2024,2019,2014,2008,2004,2002,2002,2003,2004,2006,2009,2009,2007,2005,2003,2001,2000,2000,2001,2002,2002,2003,2003,2004,2008,2012,2017,2021,2021,2018,2015,2013,2009,2007,2008,2009,2010,2014,2018,2022,2025,2027,2031,2035,2037,2038,2039,2040,2039,2038,2039,2042,2046,2047,2048,2048,2050,2052,2052,2052,2051,2049,2046,2043,2042,2042,2044,2047,2051,2054,2053,2049,2043,2037,2032,2030,2031,2032,2033,2034,2036,2038,2041,2043,2043,2040,2037,2035,2034,2035,2037,2039,2042,2046,2051,2054,2054,2053,2051,2050,2048,2046,2043,2040,2035,2031,2028,2026,2024,2023,2021,2021,2023,2024,2025,2026,2027,2031,2037,2043,2048,2053,2058,2060,2061,2059,2056,2053,2052,2054,2060,2067,2072,2073,2072,2069,2065,2061,2058,2055,2052,2050,2047,2044,2041,2039,2038,2037,2038,2041,2042,2041,2037,2033,2029,2026,2024,2022,2019,2018,2018,2020,2021,2020,2019,2018,2019,2018,2017,2017,2017,2018,2020,2023,2028,2032,2035,2038,2040,2042,2045,2047,2048,2047,2045,2042,2043,2047,2050,2051,2051,2050,2048,2048,2047,2047,2048,2051,2056,2061,2064,2064,2064,2065,2066,2065,2064,2061,2059,2057,2056,2055,2055,2056,2058,2062,2064,2064,2063,2062,2060,2058,2057,2056,2056,2057,2058,2059,2058,2053,2049,2047,2045,2045,2048,2052,2056,2059,2061,2062,2062,2061,2060,2058,2058,2059,2060,2061,2061,2061,2060,2060,2060,2060,2060,2060,2061,2062,2065,2069,2072,2075,2077,2078,2078,2076,2074,2073,2072,2073,2077,2080,2081,2079,2074,2069,2065,2063,2062,2061,2060,2061,2065,2069,2070,2071,2072,2075,2082,2090,2097,2101,2104,2107,2111,2114,2115,2115,2114,2112,2111,2110,2110,2110,2112,2114,2115,2113,2109,2106,2102,2099,2100,2103,2106,2109,2110,2109,2106,2101,2095,2089,2083,2080,2079,2080,2080,2080,2080,2078,2073,2066,2060,2054,2049,2047,2047,2047,2046,2044,2044,2046,2049,2052,2053,2052,2049,2045,2042,2042,2044,2046,2049,2052,2055,2058,2060,2063,2066,2069,2071,2073,2073,2073,2072,2070,2067,2067,2069,2072,2074,2074,2074,2075,2078,2082,2085,2087,2088,2086,2084,2081,2079,2076,2074,2074,2077,2081,2083,2082,2082,2083,2086,2089,2089,2088,2087,2084,2080,2076,2071,2066,2061,2059,2058,2055,2050,2045,2042,2041,2041,2039,2037,2034,2031,2029,2029,2031,2033,2035,2034,2033,2034,2033,2031,2028,2024,2021,2022,2024,2026,2026,2028,2030,2031,2032,2033,2035,2036,2036,2036,2038,2038,2037,2037,2040,2042,2041,2038,2037,2037,2037,2038,2041,2043,2043,2043,2044,2044,2041,2036,2033,2030,2028,2030,2033,2035,2032,2024,2015,2006,2000,1997,1997,1999,2000,2000,2000,1998,1993,1987,1984,1983,1982,1981,1980,1980,1982,1984,1986,1987,1986,1981,1976,1974,1974,1974,1975,1977,1979,1981,1983,1983,1980,1974,1969,1965,1965,1966,1966,1965,1964,1965,1966,1967,1970,1973,1975,1974,1973,1971,1970,1969,1968,1967,1965,1962,1959,1954,1951,1950,1950,1951,1953,1955,1958,1960,1961,1961,1960,1958,1956,1955,1955,1957,1960,1960,1958,1955,1953,1953,1954,1957,1960,1962,1962,1962,1964,1966,1967,1967,1967,1969,1972,1973,1975,1976,1979,1983,1989,1994,1995,1993,1989,1986,1984,1981,1979,1977,1979,1982,1986,1990,1993,1996,1999,2003,2008,2012,2015,2014,2011,2009,2008,2009,2012,2015,2017,2018,2019,2019,2019,2020,2022,2025,2027,2027,2025,2022,2021,2021,2024,2029,2032,2033,2032,2033,2039,2046,2052,2058,2064,2071,2077,2081,2083,2085,2085,2083,2082,2083,2085,2088,2093,2099,2105,2108,2109,2109,2107,2105,2104,2105,2107,2110,2115,2121,2125,2128,2130,2131,2133,2134,2135,2135,2134,2133,2133,2134,2134,2132,2131,2128,2126,2126,2126,2127,2131,2136,2139,2139,2139,2139,2137,2135,2131,2127,2123,2121,2121,2123,2126,2127,2126,2126,2124,2121,2117,2115,2116,2119,2122,2124,2127,2129,2133,2136,2136,2134,2128,2122,2117,2113,2112,2112,2115,2118,2120,2124,2127,2130,2130,2128,2126,2125,2125,2127,2129,2129,2127,2125,2122,2118,2116,2113,2111,2108,2104,2102,2099,2098,2095,2093,2091,2091,2091,2090,2088,2087,2083,2078,2073,2069,2067,2068,2070,2072,2074,2074,2072,2071,2069,2067,2061,2052,2044,2040,2038,2037,2037,2038,2039,2040,2040,2038,2034,2028,2026,2026,2028,2028,2028,2026,2024,2020,2016,2013,2012,2009,2007,2005,2006,2007,2009,2015,2021,2025,2026,2028,2030,2031,2031,2031,2031,2031,2030,2030,2030,2032,2034,2035,2037,2037,2038,2039,2042,2045,2047,2046,2044,2042,2045,2049,2052,2055,2059,2064,2068,2071,2072,2069,2063,2055,2050,2048,2048,2050,2054,2059,2062,2065,2065,2062,2055,2049,2047,2048,2049,2052,2055,2055,2052,2049,2047,2046,2044,2043,2041,2038,2034,2033,2034,2035,2035,2032,2028,2024,2020,2019,2020,2023,2028,2034,2039,2042,2043,2040,2037,2034,2033,2034,2038,2044,2050,2055,2056,2054,2050,2047,2045,2042,2040,2040,2041,2045,2050,2055,2060,2065,2072,2079,2082,2082,2080,2077,2074,2073,2073,2074,2075,2074,2071,2068,2065,2063,2062,2063,2065,2067,2070,2073,2077,2081,2081,2080,2077,2073,2071,2070,2070,2068,2064,2061,2058,2055,2054,2051,2050,2049,2048,2046,2046,2045,2046,2048,2051,2053,2055,2053,2049,2046,2044,2043,2042,2041,2040,2039,2038,2035,2031,2028,2026,2026,2027,2028,2028,2028,2030,2031,2032,2032,2030,2026,2022,2018,2016,2017,2019,2019,2019,2018,2017,2016,2014,2016,2020,2025,2029,2033,2037,2039,2039,2039,2037,2035,2033,2033,2034,2036,2037,2037,2038,2039,2041,2043,2043,2044,2044,2043,2043,2044,2045,2045,2043,2040,2038,2038,2038,2038,2038,2039,2038,2036,2032,2028,2023,2019,2015,2013,2013,2015,2018,2021,2025,2029,2032,2034,2035,2035,2035,2035,2035,2036,2036,2036,2035,2033,2032,2029,2026,2020,2013,2004,1996,1992,1991,1993,1995,1995,1995,1994,1992,1989,1985,1982,1980,1979,1980,1979,1979,1977,1976,1977,1979,1981,1982,1983,1986,1988,1989,1990,1990,1990,1990,1992,1993,1995,1999,2003,2009,2015,2021,2026,2028,2029,2031,2032,2032,2032,2031,2029,2029,2030,2030,2029,2027,2025,2022,2016,2010,2006,2002,2000,1999,1999,2000,2002,2002,2002,2003,2004,2005,2005,2005,2006,2008,2010,2009,2008,2005,2004,2004,2005,2006,2006,2005,2005,2005,2006,2009,2014,2019,2022,2024,2026,2025,2022,2017,2014,2013,2014,2015,2016,2016,2017,2018,2022,2026,2031,2033,2034,2035,2036,2038,2039,2040,2041,2041,2041,2042,2045,2048,2049,2048,2048,2048,2048,2048,2048,2049,2051,2052,2052,2052,2052,2051,2053,2056,2058,2059,2060,2064,2067,2069,2071,2072,2072,2070,2067,2066,2066,2067,2067,2067,2068,2072,2075,2077,2078,2078,2077,2078,2079,2081,2082,2081,2081,2081,2082,2081,2078,2075,2072,2070,2070,2072,2074,2076,2078,2082,2085,2089,2092,2094,2096,2097,2099,2098,2097,2093,2090,2087,2085,2082,2078,2072,2066,2061,2056,2052,2048,2044,2042,2042,2044,2046,2049,2051,2051,2050,2051,2051,2051,2051,2050,2049,2050,2051,2051,2052,2053,2054,2056,2058,2059,2061,2063,2067,2071,2075,2078,2081,2083,2085,2086,2088,2089,2090,2090,2090,2092,2095,2099,2102,2104,2105,2106,2106,2106,2106,2107,2109,2111,2112,2114,2115,2117,2118,2117,2116,2115,2115,2114,2114,2114,2115,2116,2116,2116,2116,2115,2114,2111,2108,2104,2101,2100,2101,2101,2100,2097,2093,2087,2081,2076,2074,2074,2073,2071,2071,2070,2069,2068,2069,2070,2073,2077,2081,2084,2087,2089,2090,2091,2091,2091,2091,2091,2093,2097,2100,2105,2109,2112,2114,2114,2114,2114,2114,2113,2111,2109,2107,2103,2100,2098,2097,2094,2091,2089,2088,2087,2087,2089,2091,2092,2094,2097,2100,2102,2102,2102,2101,2099,2095,2092,2090,2091,2092,2092,2091,2090,2090,2090,2092,2095,2099,2102,2101,2097,2093,2089,2086,2086,2087,2089,2090,2087,2083,2078,2072,2068,2063,2059,2056,2054,2054,2054,2054,2052,2048,2042,2036,2029,2024,2021,2018,2017,2018,2019,2019,2019,2018,2017,2017,2017,2017,2016,2016,2016,2016,2017,2016,2014,2011,2007,2003,2002,2003,2006,2010,2011,2011,2008,2006,2005,2005,2006,2008,2011,2013,2013,2012,2009,2005,2000,1995,1992,1991,1988,1985,1980,1975,1970,1965,1962,1960,1962,1964,1967,1970,1973,1974,1974,1973,1973,1973,1974,1977,1978,1978,1979,1980,1979,1977,1975,1974,1975,1976,1978,1978,1978,1974,1970,1966,1964,1961,1959,1957,1955,1954,1953,1952,1950,1947,1945,1944,1943,1943,1944,1945,1946,1948,1950,1950,1949,1948,1948,1949,1951,1954,1956,1959,1963,1968,1972,1976,1980,1984,1989,1994,1999,2002,2004,2006,2007,2008,2009,2010,2010,2010,2013,2018,2021,2022,2020,2019,2018,2016,2015,2015,2014,2013,2012,2013,2014,2016,2018,2018,2018,2019,2020,2021,2022,2023,2024,2025,2027,2029,2032,2033,2032,2030,2030,2029,2028,2026,2025,2026,2030,2035,2041,2048,2053,2056,2058,2061,2064,2066,2067,2070,2072,2072,2071,2068,2063,2058,2053,2050,2049,2049,2051,2055,2058,2059,2059,2056,2052,2049,2048,2048,2051,2054,2057,2059,2061,2062,2065,2066,2067,2068,2070,2072,2074,2078,2082,2084,2086,2086,2086,2084,2083,2083,2086,2090,2093,2096,2098,2099,2100,2101,2103,2105,2106,2107,2106,2104,2100,2096,2091,2087,2083,2081,2080,2078,2075,2070,2066,2063,2062,2061,2060,2060,2061,2062,2063,2062,2061,2060,2060,2060,2063,2067,2073,2078,2080,2082,2081,2079,2076,2073,2071,2072,2073,2075,2078,2081,2081,2081,2081,2081,2081,2082,2084,2084,2082,2081,2080,2079,2078,2076,2074,2074,2076,2079,2082,2086,2088,2088,2088,2087,2084,2080,2077,2075,2072,2068,2065,2062,2060,2061,2062,2065,2068,2071,2074,2076,2078,2081,2080,2076,2071,2067,2062,2057,2052,2050,2049,2048,2046,2044,2042,2039,2036,2034,2034,2034,2036,2038,2041,2043,2043,2043,2043,2044,2044,2046,2050,2052,2053,2054,2055,2057,2058,2060,2062,2062,2062,2061,2059,2057,2055,2054,2054,2056,2058,2059,2061,2063,2065,2066,2068,2070,2070,2067,2063,2059,2056,2053,2051,2050,2050,2050,2051,2053,2054,2053,2050,2045,2040,2035,2030,2025,2021,2020,2021,2023,2027,2030,2032,2033,2035,2040,2046,2051,2054,2054,2052,2051,2051,2052,2053,2054,2054,2054,2054,2057,2060,2064,2070,2076,2080,2083,2084,2085,2083,2081,2080,2081,2082,2083,2083,2082,2080,2079,2079,2079,2078,2077,2077,2077,2076,2074,2073,2073,2073,2071,2069,2068,2068,2067,2065,2061,2058,2055,2052,2050,2050,2051,2052,2054,2056,2057,2058,2056,2055,2056,2057,2058,2059,2061,2063,2066,2069,2073,2077,2081,2086,2091,2095,2096,2094,2092,2091,2092,2093,2095,2098,2100,2102,2103,2103,2102,2100,2098,2097,2096,2094,2092,2089,2085,2079,2072,2068,2065,2064,2064,2063,2062,2060,2057,2055,2054,2054,2055,2055,2053,2050,2047,2044,2039,2035,2031,2027,2024,2021,2018,2014,2010,2008,2006,2006,2007,2008,2009,2009,2009,2008,2008,2008,2009,2009,2011,2013,2014,2013,2010,2007,2005,2005,2005,2008,2010,2013,2015,2017,2017,2016,2015,2014,2014,2013,2013,2014,2016,2016,2016,2015,2014,2011,2008,2003,2000,1999,1998,1997,1999,2001,2002,2001,2000,1998,1994,1990,1985,1981,1978,1977,1978,1978,1980,1981,1982,1980,1978,1975,1973,1974,1978,1983,1989,1993,1994,1995,1996,1996,1997,1997,1999,2001,2004,2006,2006,2005,2003,2000,1999,1999,1999,2000,2001,2000,1998,1996,1995,1994,1995,1998,2000,2002,2006,2009,2011,2013,2016,2018,2021,2024,2028,2030,2032,2032,2031,2030,2029,2030,2030,2030,2030,2028,2025,2023,2021,2020,2019,2019,2018,2017,2017,2018,2019,2020,2022,2025,2027,2029,2032,2035,2038,2041,2045,2048,2052,2055,2060,2065,2069,2072,2074,2076,2079,2084,2090,2096,2101,2103,2105,2105,2104,2102,2103,2106,2109,2113,2117,2120,2119,2116,2113,2109,2106,2105,2105,2106,2106,2104,2100,2096,2093,2091,2092,2094,2096,2099,2102,2105,2105,2103,2100,2095,2091,2088,2084,2079,2074,2070,2066,2063,2061,2060,2060,2060,2061,2062,2064,2065,2065,2064,2064,2064,2064,2065,2064,2063,2061,2058,2056,2054,2053,2052,2052,2054,2057,2059,2058,2057,2056,2053,2050,2049,2050,2052,2054,2056,2059,2061,2061,2059,2058,2058,2059,2061,2065,2070,2073,2073,2072,2070,2066,2062,2059,2056,2055,2056,2060,2064,2067,2067,2066,2064,2061,2057,2054,2053,2053,2054,2054,2054,2053,2050,2047,2044,2041,2038,2035,2034,2035,2035,2033,2031,2027,2023,2019,2015,2013,2011,2009,2009,2009,2010,2011,2012,2013,2013,2013,2012,2011,2010,2008,2008,2009,2010,2011,2012,2014,2016,2018,2021,2024,2027,2028,2027,2026,2024,2022,2021,2021,2022,2023,2022,2020,2019,2020,2021,2023,2023,2023,2022,2021,2020,2019,2018,2016,2014,2013,2014,2014,2016,2017,2019,2023,2027,2030,2033,2036,2038,2040,2043,2045,2047,2048,2048,2049,2049,2048,2046,2045,2046,2047,2049,2052,2054,2054,2052,2050,2049,2048,2047,2049,2052,2056,2059,2058,2055,2050,2046,2043,2042,2042,2043,2046,2049,2051,2052,2051,2049,2047,2045,2044,2044,2044,2044,2045,2045,2045,2046,2047,2047,2047,2046,2045,2045,2045,2044,2043,2042,2041,2040,2038,2036,2034,2032,2030,2029,2029,2030,2032,2034,2037,2041,2043,2044,2043,2042,2041,2041,2041,2042,2045,2047,2048,2049,2050,2053,2056,2061,2066,2071,2075,2078,2078,2079,2079,2078,2078,2077,2076,2075,2073,2072,2072,2073,2075,2077,2078,2078,2076,2075,2074,2073,2072,2073,2074,2076,2077,2078,2078,2077,2074,2071,2069,2066,2064,2061,2059,2058,2057,2055,2052,2051,2050,2048,2047,2044,2042,2039,2035,2032,2028,2026,2026,2026,2028,2029,2030,2030,2030,2031,2031,2033,2034,2037,2041,2045,2050,2053,2056,2057,2059,2060,2061,2062,2064,2067,2070,2073,2075,2077,2079,2082,2086,2089,2091,2090,2089,2088,2088,2089,2090,2090,2089,2088,2088,2087,2086,2086,2086,2087,2086,2086,2086,2085,2084,2085,2087,2088,2088,2086,2083,2079,2075,2070,2067,2065,2065,2065,2067,2068,2067,2064,2061,2058,2057,2057,2058,2061,2065,2069,2072,2072,2070,2069,2067,2065,2062,2060,2059,2059,2059,2059,2059,2057,2055,2054,2053,2053,2055,2058,2062,2065,2066,2067,2067,2066,2065,2063,2062,2061,2060,2059,2060,2060,2059,2058,2058,2058,2058,2058,2057,2057,2056,2057,2058,2059,2059,2060,2060,2061,2061,2060,2059,2057,2057,2056,2055,2053,2051,2048,2046,2044,2044,2045,2046,2047,2048,2048,2048,2046,2042,2038,2036,2035,2036,2037,2039,2039,2037,2036,2035,2035,2035,2036,2036,2036,2036,2036,2035,2032,2030,2028,2028,2029,2030,2030,2029,2028,2027,2026,2026,2025,2023,2020,2018,2015,2012,2009,2006,2003,2002,2001,2000,1998,1995,1990,1986,1982,1978,1977,1977,1978,1980,1981,1982,1981,1980,1978,1976,1974,1972,1971,1971,1971,1970,1971,1971,1971,1973,1974,1974,1975,1975,1976,1977,1980,1983,1987,1990,1992,1992,1992,1991,1990,1989,1988,1987,1986,1985,1985,1984,1984,1983,1982,1983,1983,1983,1983,1984,1986,1987,1987,1987,1987,1987,1987,1986,1985,1983,1980,1978,1976,1975,1976,1978,1981,1984,1988,1990,1992,1992,1993,1994,1997,1999,2002,2005,2008,2010,2011,2013,2014,2014,2013,2014,2014,2016,2018,2021,2023,2025,2027,2029,2032,2036,2039,2042,2046,2050,2052,2054,2056,2057,2060,2063,2066,2069,2070,2071,2070,2070,2070,2070,2070,2071,2073,2076,2079,2081,2082,2083,2084,2085,2086,2088,2089,2090,2090,2092,2093,2094,2092,2091,2091,2092,2093,2094,2094,2094,2093,2092,2092,2092,2091,2090,2090,2090,2090,2090,2090,2090,2091,2092,2094,2096,2098,2099,2099,2099,2100,2101,2103,2104,2106,2108,2109,2108,2105,2101,2096,2094,2093,2093,2094,2095,2097,2099,2101,2103,2105,2105,2105,2104,2104,2104,2105,2105,2104,2104,2104,2104,2104,2104,2103,2102,2099,2097,2095,2094,2094,2094,2095,2095,2094,2094,2093,2092,2092,2091,2090,2089,2089,2089,2088,2088,2087,2085,2083,2080,2078,2076,2074,2073,2072,2072,2072,2072,2070,2068,2065,2062,2060,2059,2058,2057,2056,2054,2054,2054,2054,2055,2056,2056,2057,2058,2058,2059,2060,2060,2059,2058,2057,2055,2054,2053,2052,2051,2050,2049,2048,2047,2048,2048,2047,2047,2046,2045,2045,2045,2044,2042,2040,2037,2035,2033,2032,2031,2031,2031,2031,2029,2027,2025,2023,2023,2023,2025,2027,2030,2032,2035,2038,2040,2039,2038,2037,2036,2034,2031,2030,2029,2030,2031,2032,2032,2031,2028,2025,2022,2019,2017,2016,2017,2017,2020,2023,2025,2026,2026,2025,2024,2022,2021,2020,2019,2019,2018,2018,2018,2017,2016,2015,2013,2012,2012,2011,2011,2011,2012,2013,2014,2015,2014,2012,2009,2005,2002,2000,2001,2002,2004,2005,2005,2005,2005,2005,2005,2006,2007,2010,2013,2016,2020,2024,2026,2027,2026,2024,2022,2021,2022,2024,2027,2030,2033,2036,2038,2040,2041,2042,2043,2044,2046,2047,2048,2050,2050,2051,2052,2053,2055,2057,2057,2057,2055,2054,2054,2054,2056,2058,2060,2061,2062,2062,2064,2066,2068,2069,2070,2071,2070,2068,2067,2065,2063,2062,2061,2060,2061,2061,2061,2061,2061,2060,2060,2059,2059,2060,2060,2061,2062,2064,2065,2066,2067,2068,2069,2070,2071,2071,2072,2073,2074,2075,2076,2077,2078,2078,2077,2077,2077,2077,2077,2077,2076,2076,2075,2075,2076,2077,2079,2080,2080,2080,2079,2078,2077,2077,2076,2076,2075,2074,2074,2073,2073,2073,2073,2073,2072,2070,2068,2065,2062,2060,2059,2059,2060,2062,2064,2064,2063,2060,2057,2054,2051,2050,2049,2049,2049,2049,2049,2048,2045,2041,2038,2036,2034,2033,2031,2029,2028,2027,2027,2028,2029,2030,2031,2032,2034,2035,2034,2033,2032,2031,2030,2030,2029,2029,2028,2027,2026,2024,2024,2024,2025,2027,2029,2030,2031,2032,2033,2032,2031,2028,2025,2021,2019,2017,2017,2017,2017,2016,2016,2015,2013,2011,2010,2009,2008,2009,2010,2012,2014,2016,2018,2020,2020,2021,2021,2023,2026,2028,2031,2031,2030,2029,2027,2025,2023,2021,2021,2022,2025,2028,2029,2029,2027,2025,2025,2025,2026,2026,2024,2023,2023,2024,2024,2024,2023,2022,2022,2022,2023,2024,2025,2027,2028,2030,2029,2028,2025,2023,2022,2022,2024,2027,2029,2032,2033,2034,2033,2032,2031,2029,2028,2027,2027,2027,2026,2027,2027,2027,2026,2026,2026,2026,2028,2030,2031,2033,2034,2035,2036,2037,2037,2037,2036,2035,2035,2034,2035,2037,2038,2038,2038,2039,2041,2042,2044,2045,2045,2045,2045,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2049,2050,2051,2052,2054,2056,2059,2061,2063,2064,2064,2064,2064,2065,2066,2067,2069,2072,2074,2075,2076,2077,2077,2077,2076,2075,2074,2073,2071,2070,2069,2069,2068,2068,2067,2067,2067,2068,2069,2070,2071,2072,2073,2074,2075,2075,2074,2072,2069,2066,2063,2062,2061,2061,2060,2059,2058,2058,2059,2061,2062,2065,2068,2070,2072,2075,2076,2077,2078,2079,2080,2080,2079,2079,2078,2078,2077,2076,2075,2075,2074,2073,2072,2071,2070,2071,2071,2072,2073,2074,2075,2076,2076,2075,2073,2071,2069,2068,2067,2067,2067,2066,2064,2063,2061,2058,2057,2057,2059,2061,2062,2063,2063,2062,2060,2060,2060,2060,2060,2060,2060,2060,2060,2059,2059,2058,2058,2058,2059,2059,2058,2057,2056,2055,2053,2051,2049,2046,2044,2043,2042,2041,2042,2043,2045,2047,2048,2048,2046,2045,2044,2043,2042,2040,2037,2035,2033,2030,2028,2026,2026,2026,2027,2028,2030,2032,2033,2033,2032,2029,2026,2022,2020,2018,2016,2014,2013,2012,2010,2008,2007,2006,2007,2008,2009,2011,2012,2013,2014,2014,2015,2016,2017,2018,2018,2017,2016,2015,2016,2018,2021,2023,2025,2026,2028,2031,2034,2037,2041,2044,2046,2047,2048,2048,2049,2049,2050,2052,2053,2054,2057,2058,2059,2059,2059,2059,2059,2058,2057,2057,2057,2058,2058,2059,2059,2060,2061,2061,2062,2063,2065,2067,2069,2071,2071,2070,2069,2067,2065,2063,2062,2060,2059,2058,2056,2054,2052,2050,2049,2048,2048,2049,2051,2052,2054,2055,2056,2056,2056,2055,2054,2054,2055,2056,2057,2058,2058,2057,2057,2055,2054,2053,2053,2053,2054,2055,2057,2059,2061,2061,2062,2061,2060,2058,2057,2056,2056,2057,2059,2061,2062,2062,2062,2061,2061,2061,2061,2061,2062,2062,2062,2061,2059,2058,2057,2057,2057,2059,2060,2062,2063,2064,2064,2064,2064,2064,2065,2064,2064,2063,2062,2061,2060,2059,2059,2059,2059,2059,2058,2056,2055,2055,2055,2056,2059,2062,2065,2068,2069,2069,2070,2070,2071,2071,2069,2068,2066,2063,2061,2059,2059,2058,2057,2056,2055,2054,2053,2052,2049,2046,2042,2039,2037,2037,2037,2036,2034,2031,2028,2026,2024,2023,2022,2020,2018,2017,2016,2015,2014,2014,2014,2015,2017,2017,2018,2017,2016,2015,2016,2018,2021,2023,2023,2022,2020,2018,2017,2016,2016,2017,2020,2022,2024,2025,2025,2024,2022,2019,2017,2015,2014,2015,2016,2017,2018,2019,2021,2023,2025,2026,2027,2030,2032,2035,2037,2038,2039,2039,2037,2035,2034,2034,2034,2034,2035,2037,2038,2039,2040,2040,2040,2040,2040,2040,2040,2038,2037,2035,2034,2033,2032,2033,2034,2035,2035,2036,2037,2036,2034,2032,2030,2028,2027,2028,2029,2032,2034,2037,2039,2041,2043,2044,2045,2047,2050,2053,2057,2060,2061,2062,2062,2061,2060,2058,2057,2058,2059,2061,2063,2066,2070,2073,2075,2076,2078,2079,2080,2080,2079,2079,2077,2076,2075,2074,2073,2072,2073,2073,2074,2074,2075,2077,2078,2080,2081,2082,2083,2082,2081,2081,2081,2081,2081,2080,2081,2081,2081,2080,2079,2078,2076,2073,2071,2069,2067,2067,2066,2066,2067,2067,2067,2066,2064,2061,2060,2058,2056,2054,2053,2051,2050,2048,2046,2044,2043,2041,2040,2038,2037,2035,2033,2030,2028,2026,2026,2026,2027,2027,2026,2026,2026,2026,2025,2023,2020,2018,2015,2013,2012,2012,2012,2013,2013,2014,2014,2015,2015,2016,2015,2014,2013,2012,2011,2010,2009,2008,2007,2007,2007,2007,2008,2008,2008,2007,2007,2005,2002,1998,1996,1995,1996,1997,1999,2000,2000,2000,2000,2001,2003,2006,2009,2013,2016,2019,2020,2021,2020,2020,2020,2020,2021,2022,2023,2024,2026,2027,2029,2030,2030,2030,2030,2030,2030,2029,2028,2027,2026,2024,2024,2024,2024,2024,2026,2028,2029,2031,2032,2032,2032,2031,2030,2029,2028,2028,2029,2030,2031,2032,2034,2035,2037,2040,2042,2044,2046,2049,2050,2052,2053,2053,2054,2053,2052,2051,2049,2049,2050,2051,2051,2051,2052,2054,2056,2059,2061,2062,2063,2065,2067,2068,2069,2069,2069,2069,2070,2069,2070,2070,2071,2072,2073,2074,2076,2078,2081,2084,2087,2089,2090,2091,2091,2091,2091,2090,2090,2090,2089,2089,2088,2086,2085,2082,2080,2079,2078,2077,2076,2075,2074,2074,2073,2072,2070,2067,2065,2062,2061,2059,2058,2057,2056,2055,2053,2052,2051,2049,2046,2044,2042,2041,2042,2042,2042,2043,2043,2043,2042,2041,2040,2038,2037,2038,2039,2040,2040,2040,2040,2039,2039,2039,2040,2041,2043,2045,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2050,2051,2051,2052,2053,2055,2058,2060,2062,2063,2063,2062,2062,2060,2060,2062,2064,2066,2067,2068,2069,2068,2067,2066,2066,2067,2068,2070,2071,2072,2073,2073,2073,2074,2074,2076,2078,2080,2082,2085,2088,2091,2093,2095,2096,2096,2095,2094,2093,2091,2089,2087,2085,2084,2084,2083,2084,2084,2086,2088,2090,2091,2091,2091,2090,2089,2088,2088,2089,2090,2092,2094,2095,2095,2095,2094,2093,2093,2093,2093,2094,2094,2095,2095,2094,2093,2092,2090,2088,2087,2085,2085,2085,2086,2087,2089,2090,2092,2094,2094,2093,2092,2092,2092,2093,2092,2092,2091,2089,2086,2083,2080,2078,2076,2077,2078,2081,2083,2085,2086,2088,2089,2089,2089,2089,2090,2090,2089,2087,2085,2081,2078,2075,2072,2070,2068,2065,2061,2057,2054,2051,2049,2047,2046,2045,2043,2041,2039,2036,2033,2031,2030,2029,2028,2027,2026,2025,2025,2024,2023,2022,2019,2016,2012,2009,2008,2008,2009,2009,2009,2008,2006,2004,2003,2002,2001,2001,2001,2002,2003,2002,2001,2000,1999,1999,1997,1996,1995,1994,1993,1993,1992,1991,1989,1986,1982,1979,1977,1975,1974,1974,1974,1975,1975,1974,1972,1971,1971,1971,1972,1971,1970,1968,1966,1964,1963,1963,1963,1964,1965,1964,1964,1963,1962,1962,1962,1963,1964,1964,1965,1966,1966,1966,1967,1968,1969,1970,1971,1972,1971,1971,1972,1974,1977,1979,1981,1984,1986,1987,1987,1988,1990,1992,1995,1997,1999,2000,2001,2003,2004,2005,2006,2008,2010,2013,2016,2019,2021,2024,2026,2029,2031,2033,2034,2035,2037,2039,2040,2041,2041,2042,2043,2044,2045,2045,2046,2046,2045,2043,2041,2039,2039,2039,2039,2040,2041,2042,2043,2045,2048,2049,2049,2050,2051,2052,2053,2054,2054,2054,2054,2054,2054,2054,2053,2052,2052,2053,2054,2056,2057,2058,2059,2059,2059,2058,2058,2059,2061,2062,2064,2065,2066,2065,2064,2064,2063,2062,2061,2061,2060,2060,2059,2060,2061,2062,2063,2063,2063,2062,2062,2062,2063,2063,2064,2065,2066,2067,2067,2068,2070,2072,2074,2075,2075,2075,2074,2073,2073,2073,2074,2075,2076,2076,2077,2077,2077,2077,2077,2077,2077,2078,2079,2080,2080,2082,2083,2084,2084,2083,2082,2081,2082,2082,2083,2082,2082,2081,2081,2080,2079,2077,2075,2074,2074,2074,2074,2073,2072,2071,2071,2071,2070,2070,2068,2067,2065,2064,2064,2063,2062,2061,2060,2060,2060,2061,2062,2064,2065,2066,2066,2066,2066,2066,2065,2063,2062,2061,2060,2059,2058,2057,2055,2054,2054,2054,2055,2055,2054,2052,2051,2050,2049,2048,2049,2049,2049,2050,2050,2051,2051,2051,2051,2050,2048,2046,2046,2046,2048,2050,2052,2052,2053,2053,2053,2052,2052,2051,2051,2051,2051,2051,2051,2051,2050,2050,2051,2052,2052,2052,2051,2050,2048,2046,2043,2041,2040,2040,2041,2041,2042,2042,2043,2042,2041,2039,2038,2038,2039,2041,2042,2043,2044,2045,2046,2047,2047,2048,2049,2049,2049,2048,2047,2045,2044,2043,2042,2041,2039,2038,2038,2038,2039,2040,2040,2041,2040,2040,2040,2039,2038,2037,2036,2034,2033,2033,2033,2032,2032,2032,2032,2030,2029,2028,2027,2026,2026,2027,2027,2029,2031,2032,2033,2034,2036,2038,2039,2041,2042,2043,2044,2044,2044,2045,2045,2047,2048,2050,2052,2053,2054,2055,2056,2056,2057,2059,2061,2062,2063,2064,2064,2064,2063,2062,2062,2063,2064,2065,2065,2064,2064,2064,2063,2063,2063,2063,2063,2063,2063,2064,2065,2067,2068,2069,2070,2070,2069,2069,2069,2070,2070,2071,2071,2071,2070,2069,2068,2067,2067,2068,2069,2070,2071,2072,2072,2072,2071,2070,2069,2068,2068,2068,2068,2067,2066,2065,2064,2064,2065,2066,2067,2067,2066,2064,2061,2058,2056,2055,2055,2055,2055,2055,2056,2057,2058,2059,2061,2062,2064,2065,2066,2067,2068,2069,2069,2070,2070,2070,2070,2069,2069,2068,2067,2066,2066,2066,2065,2065,2064,2064,2064,2064,2064,2063,2063,2063,2062,2061,2060,2058,2056,2056,2055,2055,2055,2055,2054,2053,2051,2050,2049,2049,2048,2048,2047,2046,2045,2043,2043,2042,2043,2044,2045,2045,2045,2043,2041,2040,2038,2037,2036,2036,2036,2037,2037,2037,2036,2035,2035,2034,2033,2032,2030,2028,2027,2027,2026,2027,2028,2029,2030,2030,2029,2028,2027,2025,2023,2022,2021,2021,2022,2023,2024,2025,2027,2029,2030,2031,2033,2034,2034,2035,2035,2035,2036,2036,2036,2037,2038,2039,2040,2040,2040,2040,2040,2040,2041,2042,2043,2044,2044,2044,2043,2043,2042,2042,2041,2040,2038,2036,2034,2033,2031,2030,2030,2029,2029,2030,2030,2032,2033,2033,2034,2035,2035,2036,2036,2037,2038,2039,2040,2041,2041,2041,2041,2041,2040,2041,2041,2041,2042,2042,2043,2043,2044,2045,2046,2047,2047,2047,2047,2047,2046,2046,2046,2046,2045,2045,2044,2044,2044,2044,2045,2046,2047,2047,2046,2044,2041,2040,2039,2039,2039,2038,2038,2038,2038,2037,2037,2037,2037,2038,2039,2041,2042,2042,2043,2043,2043,2044,2044,2045,2045,2045,2044,2044,2043,2042,2041,2041,2041,2041,2042,2042,2043,2043,2044,2044,2045,2045,2046,2046,2046,2046,2045,2044,2044,2044,2044,2045,2046,2046,2045,2044,2043,2042,2041,2039,2038,2036,2035,2034,2034,2033,2034,2034,2036,2037,2037,2036,2036,2035,2035,2035,2036,2037,2037,2038,2039,2039,2038,2037,2036,2035,2034,2032,2031,2030,2029,2029,2029,2030,2031,2033,2034,2034,2034,2032,2031,2030,2030,2029,2029,2030,2031,2032,2033,2033,2034,2035,2036,2035,2035,2033,2032,2031,2030,2030,2030,2031,2031,2032,2032,2033,2034,2034,2035,2036,2037,2039,2040,2041,2042,2042,2043,2043,2042,2040,2038,2036,2034,2033,2032,2030,2029,2028,2028,2028,2030,2033,2035,2037,2038,2040,2041,2041,2041,2041,2042,2042,2043,2044,2045,2046,2047,2048,2049,2050,2049,2048,2046,2044,2043,2042,2043,2044,2045,2047,2048,2050,2052,2052,2053,2052,2052,2052,2052,2053,2054,2055,2057,2059,2060,2062,2062,2064,2066,2069,2072,2075,2076,2076,2075,2073,2072,2072,2072,2073,2073,2073,2073,2073,2072,2070,2068,2066,2065,2065,2066,2067,2067,2068,2068,2069,2069,2070,2070,2070,2071,2071,2071,2071,2071,2070,2069,2069,2069,2069,2069,2070,2071,2073,2074,2076,2077,2078,2078,2078,2078,2078,2078,2079,2080,2080,2080,2079,2079,2079,2079,2079,2079,2078,2077,2075,2072,2070,2067,2065,2064,2064,2065,2066,2067,2068,2069,2068,2067,2066,2065,2065,2065,2066,2068,2069,2070,2070,2070,2069,2068,2067,2066,2065,2065,2064,2063,2062,2061,2060,2059,2058,2057,2056,2056,2055,2054,2054,2053,2052,2052,2050,2049,2048,2047,2046,2046,2045,2043,2042,2039,2037,2035,2033,2031,2030,2030,2029,2029,2028,2028,2028,2028,2028,2029,2029,2030,2030,2031,2032,2033,2033,2032,2031,2030,2029,2028,2027,2027,2027,2026,2026,2025,2024,2024,2025,2025,2026,2027,2028,2029,2031,2031,2031,2031,2032,2033,2034,2034,2034,2033,2032,2031,2030,2031,2031,2032,2032,2032,2030,2029,2028,2027,2027,2027,2027,2028,2030,2030,2030,2029,2028,2026,2025,2025,2025,2027,2029,2032,2035,2037,2039,2039,2038,2038,2037,2037,2038,2038,2038,2037,2037,2037,2037,2039,2040,2041,2042,2043,2044,2044,2043,2042,2041,2039,2038,2037,2037,2038,2038,2040,2041,2043,2044,2044,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2046,2046,2047,2047,2048,2049,2050,2051,2051,2051,2050,2051,2052,2052,2052,2052,2052,2052,2052,2053,2053,2052,2051,2050,2049,2048,2047,2047,2047,2047,2048,2048,2049,2049,2050,2050,2050,2049,2049,2050,2051,2052,2053,2055,2056,2057,2058,2059,2059,2058,2058,2059,2060,2061,2061,2060,2060,2060,2060,2060,2060,2061,2061,2063,2064,2064,2064,2063,2063,2063,2063,2063,2062,2061,2061,2061,2062,2062,2063,2063,2063,2062,2062,2062,2062,2062,2062,2062,2061,2060,2060,2060,2059,2058,2058,2056,2055,2055,2054,2053,2053,2052,2052,2052,2052,2053,2054,2054,2054,2053,2052,2051,2051,2052,2053,2054,2055,2055,2055,2055,2055,2055,2054,2053,2053,2052,2052,2052,2052,2052,2053,2053,2054,2056,2057,2057,2057,2057,2056,2056,2056,2056,2056,2056,2057,2057,2057,2056,2054,2053,2052,2052,2052,2053,2053,2054,2054,2054,2054,2053,2053,2052,2052,2051,2050,2048,2046,2045,2044,2043,2042,2042,2043,2043,2044,2044,2045,2046,2047,2049,2050,2050,2050,2048,2047,2046,2045,2045,2045,2045,2046,2046,2045,2044,2043,2042,2042,2042,2043,2044,2044,2044,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2043,2042,2042,2042,2042,2042,2043,2043,2043,2042,2041,2040,2040,2039,2039,2039,2038,2038,2038,2038,2037,2036,2034,2033,2033,2033,2033,2033,2032,2031,2030,2030,2030,2030,2030,2030,2031,2032,2032,2032,2031,2031,2031,2031,2030,2029,2029,2030,2030,2030,2030,2030,2029,2028,2028,2027,2027,2027,2028,2030,2031,2032,2032,2032,2033,2033,2034,2034,2034,2034,2034,2034,2035,2035,2035,2036,2037,2039,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2039,2039,2039,2039,2038,2038,2038,2038,2038,2038,2039,2039,2040,2040,2039,2038,2037,2037,2037,2038,2038,2039,2040,2040,2040,2039,2038,2038,2038,2038,2038,2039,2039,2039,2038,2038,2038,2039,2040,2040,2041,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2043,2041,2039,2037,2036,2035,2035,2036,2036,2037,2038,2038,2038,2037,2036,2035,2035,2036,2036,2036,2036,2036,2035,2035,2035,2035,2035,2036,2036,2037,2037,2038,2039,2041,2042,2044,2045,2047,2048,2049,2050,2052,2053,2054,2055,2055,2055,2055,2055,2055,2055,2056,2057,2058,2059,2059,2060,2060,2060,2061,2060,2060,2060,2059,2059,2058,2058,2057,2056,2055,2054,2053,2052,2053,2054,2054,2054,2054,2052,2049,2048,2048,2047,2047,2048,2048,2048,2049,2048,2047,2044,2041,2040,2039,2040,2041,2042,2043,2044,2045,2045,2046,2046,2046,2047,2048,2049,2050,2051,2052,2052,2053,2052,2052,2051,2052,2053,2054,2055,2056,2057,2057,2057,2057,2057,2058,2058,2059,2061,2062,2063,2064,2066,2067,2068,2069,2070,2071,2071,2072,2072,2071,2070,2069,2069,2069,2070,2070,2070,2070,2070,2069,2069,2068,2067,2066,2066,2065,2064,2064,2064,2065,2065,2066,2067,2067,2066,2066,2065,2064,2063,2062,2062,2062,2062,2063,2063,2063,2062,2062,2062,2063,2063,2063,2063,2062,2061,2061,2061,2060,2060,2059,2059,2058,2059,2059,2059,2059,2060,2061,2061,2062,2062,2062,2062,2062,2062,2061,2060,2059,2058,2057,2056,2055,2055,2055,2055,2056,2056,2057,2057,2056,2056,2055,2055,2055,2054,2054,2055,2055,2055,2054,2053,2052,2051,2051,2050,2049,2049,2050,2050,2051,2051,2050,2050,2049,2049,2050,2050,2050,2050,2050,2050,2050,2051,2052,2053,2054,2055,2055,2054,2053,2052,2052,2052,2051,2051,2052,2052,2054,2054,2054,2054,2053,2052,2050,2048,2047,2046,2045,2045,2046,2047,2047,2047,2048,2048,2048,2047,2047,2046,2045,2045,2044,2043,2042,2041,2040,2039,2039,2038,2038,2038,2038,2038,2038,2039,2040,2041,2042,2042,2042,2042,2042,2042,2043,2045,2046,2047,2048,2048,2047,2045,2044,2043,2043,2043,2044,2044,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2043,2043,2044,2046,2047,2049,2050,2051,2052,2053,2053,2053,2052,2052,2052,2052,2051,2050,2049,2047,2047,2047,2047,2047,2045,2044,2044,2042,2041,2040,2039,2038,2037,2037,2036,2035,2034,2033,2033,2032,2031,2030,2028,2028,2027,2027,2027,2026,2026,2026,2026,2026,2027,2027,2027,2028,2027,2026,2025,2023,2022,2021,2021,2023,2024,2026,2027,2028,2028,2028,2028,2028,2028,2029,2029,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2030,2031,2031,2032,2032,2032,2031,2031,2031,2031,2031,2031,2031,2031,2030,2029,2028,2028,2027,2027,2027,2027,2027,2028,2029,2030,2031,2031,2031,2029,2028,2026,2025,2024,2024,2023,2022,2022,2021,2022,2023,2023,2024,2025,2025,2024,2023,2023,2022,2022,2023,2023,2023,2024,2025,2026,2027,2028,2029,2029,2028,2027,2027,2027,2028,2030,2032,2034,2035,2036,2036,2037,2036,2036,2037,2038,2038,2038,2038,2038,2038,2039,2040,2041,2042,2043,2044,2045,2045,2045,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2047,2048,2049,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2052,2052,2053,2053,2053,2054,2054,2054,2054,2053,2053,2052,2052,2052,2052,2052,2053,2053,2054,2055,2057,2057,2058,2059,2060,2060,2060,2061,2061,2062,2064,2065,2066,2067,2067,2068,2069,2070,2071,2073,2074,2074,2074,2074,2073,2072,2072,2072,2073,2074,2075,2075,2075,2075,2074,2073,2073,2073,2073,2074,2075,2076,2077,2077,2077,2078,2078,2077,2077,2077,2077,2078,2079,2080,2081,2082,2082,2082,2081,2080,2080,2080,2081,2082,2084,2086,2086,2086,2086,2086,2086,2087,2087,2087,2087,2086,2085,2084,2083,2082,2080,2079,2078,2077,2077,2076,2076,2076,2075,2074,2073,2073,2072,2072,2072,2072,2071,2071,2071,2071,2071,2070,2070,2069,2069,2068,2068,2068,2068,2067,2065,2064,2063,2063,2062,2062,2062,2061,2060,2058,2056,2055,2053,2052,2051,2050,2049,2049,2048,2047,2046,2045,2044,2044,2043,2043,2043,2043,2043,2043,2043,2044,2044,2045,2045,2045,2045,2044,2043,2042,2042,2041,2041,2041,2042,2043,2044,2044,2043,2043,2042,2041,2040,2039,2039,2039,2038,2037,2036,2035,2033,2031,2030,2028,2027,2027,2026,2026,2026,2025,2025,2024,2024,2024,2023,2022,2021,2020,2020,2020,2020,2020,2020,2020,2020,2021,2021,2020,2019,2019,2018,2018,2018,2017,2015,2014,2012,2012,2011,2011,2011,2012,2012,2012,2012,2012,2012,2012,2013,2013,2014,2014,2015,2015,2016,2016,2017,2018,2019,2020,2021,2021,2023,2024,2025,2025,2025,2025,2024,2024,2024,2024,2024,2025,2026,2026,2025,2024,2024,2023,2023,2024,2025,2026,2027,2027,2027,2027,2028,2028,2029,2030,2030,2031,2031,2032,2033,2033,2034,2034,2035,2035,2035,2037,2039,2041,2043,2044,2045,2046,2047,2048,2049,2051,2052,2053,2054,2054,2055,2055,2054,2055,2055,2055,2056,2056,2057,2057,2059,2060,2061,2062,2063,2063,2062,2062,2062,2061,2061,2061,2062,2062,2063,2064,2064,2065,2066,2067,2068,2069,2069,2069,2068,2067,2067,2066,2066,2066,2065,2065,2064,2062,2061,2060,2060,2060,2061,2061,2061,2061,2059,2058,2057,2057,2057,2058,2060,2061,2062,2062,2063,2063,2063,2064,2065,2066,2068,2069,2069,2069,2069,2069,2068,2068,2068,2069,2069,2069,2069,2068,2068,2068,2067,2067,2066,2066,2066,2065,2065,2064,2063,2063,2061,2060,2059,2058,2058,2057,2056,2056,2054,2053,2053,2052,2051,2051,2050,2049,2048,2048,2048,2047,2047,2046,2046,2046,2045,2045,2045,2044,2044,2044,2043,2043,2042,2041,2040,2039,2038,2038,2037,2037,2036,2036,2036,2037,2037,2038,2039,2039,2039,2039,2039,2038,2038,2038,2038,2038,2038,2037,2036,2036,2035,2034,2034,2033,2033,2032,2031,2030,2029,2028,2028,2028,2029,2031,2033,2034,2036,2036,2036,2036,2036,2036,2036,2036,2036,2037,2037,2037,2037,2036,2036,2035,2035,2034,2034,2034,2034,2034,2034,2034,2034,2034,2034,2034,2035,2037,2038,2040,2040,2040,2040,2040,2040,2040,2040,2040,2039,2039,2040,2041,2042,2043,2044,2045,2046,2047,2047,2048,2049,2050,2052,2052,2053,2052,2051,2051,2051,2051,2050,2050,2049,2049,2049,2049,2049,2050,2051,2051,2052,2052,2052,2052,2051,2050,2049,2047,2046,2046,2046,2047,2047,2046,2046,2045,2045,2045,2045,2046,2046,2046,2045,2045,2044,2044,2044,2045,2046,2047,2047,2047,2047,2047,2047,2047,2048,2050,2052,2053,2055,2055,2055,2055,2055,2055,2054,2054,2053,2052,2052,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2053,2053,2054,2055,2055,2057,2058,2058,2059,2059,2059,2059,2059,2059,2059,2058,2057,2056,2055,2054,2054,2055,2055,2056,2057,2058,2059,2059,2059,2059,2059,2060,2060,2060,2061,2061,2062,2062,2062,2062,2061,2061,2061,2062,2063,2063,2063,2064,2064,2064,2064,2064,2064,2064,2065,2065,2065,2065,2065,2065,2064,2064,2064,2064,2063,2063,2063,2062,2061,2060,2059,2059,2059,2060,2060,2059,2059,2059,2059,2059,2059,2059,2059,2058,2057,2057,2056,2057,2057,2058,2058,2059,2058,2058,2057,2057,2056,2056,2056,2056,2055,2054,2054,2054,2055,2056,2057,2058,2059,2059,2058,2058,2058,2057,2057,2056,2056,2055,2055,2055,2055,2056,2057,2059,2060,2061,2061,2061,2061,2061,2061,2061,2061,2060,2060,2059,2058,2057,2057,2057,2056,2055,2053,2051,2050,2048,2048,2048,2047,2046,2045,2044,2043,2043,2043,2044,2044,2044,2044,2043,2043,2042,2041,2041,2040,2039,2038,2038,2037,2037,2036,2035,2035,2034,2034,2033,2033,2033,2034,2035,2035,2035,2035,2035,2034,2034,2035,2035,2037,2038,2039,2039,2039,2038,2037,2037,2036,2036,2036,2035,2034,2033,2032,2031,2030,2030,2030,2030,2030,2030,2030,2030,2031,2032,2034,2035,2035,2036,2037,2037,2038,2038,2038,2038,2037,2037,2037,2037,2036,2035,2033,2032,2031,2031,2031,2032,2032,2033,2033,2034,2034,2034,2034,2034,2034,2033,2033,2033,2033,2032,2032,2032,2032,2032,2032,2032,2032,2032,2032,2031,2031,2030,2030,2031,2030,2030,2030,2031,2031,2032,2031,2031,2031,2030,2030,2031,2031,2031,2031,2031,2031,2031,2031,2031,2031,2031,2031,2030,2030,2030,2030,2031,2031,2032,2032,2032,2031,2031,2030,2030,2029,2030,2031,2031,2032,2032,2033,2033,2034,2034,2035,2036,2036,2036,2036,2037,2038,2039,2040,2041,2041,2041,2042,2042,2042,2042,2042,2042,2042,2042,2043,2044,2045,2046,2047,2048,2049,2049,2049,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2050,2051,2052,2052,2052,2051,2051,2051,2050,2050,2051,2052,2053,2053,2053,2054,2054,2055,2056,2057,2058,2059,2059,2059,2059,2059,2059,2059,2060,2060,2060,2060,2059,2059,2058,2058,2058,2058,2058,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2058,2058,2059,2059,2060,2060,2061,2062,2063,2063,2064,2064,2065,2065,2065,2065,2065,2065,2065,2065,2064,2064,2063,2063,2062,2062,2061,2061,2061,2061,2061,2061,2062,2063,2063,2064,2064,2064,2063,2062,2062,2062,2062,2063,2063,2064,2064,2065,2065,2065,2065,2065,2066,2067,2068,2069,2069,2068,2067,2066,2066,2066,2066,2066,2066,2066,2065,2065,2064,2065,2065,2066,2066,2065,2064,2063,2062,2061,2061,2060,2060,2059,2058,2057,2056,2056,2055,2056,2056,2056,2055,2054,2053,2052,2052,2053,2053,2054,2054,2055,2054,2053,2053,2052,2052,2053,2053,2054,2053,2052,2052,2051,2051,2050,2049,2048,2048,2047,2047,2047,2046,2046,2046,2046,2047,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2044,2043,2042,2041,2041,2041,2041,2042,2042,2043,2043,2043,2043,2043,2042,2042,2042,2041,2041,2040,2040,2040,2040,2040,2040,2040,2040,2040,2041,2041,2040,2040,2041,2041,2040,2040,2039,2039,2039,2040,2040,2040,2040,2040,2040,2040,2040,2040,2039,2038,2038,2037,2037,2037,2037,2037,2037,2037,2037,2037,2035,2034,2033,2033,2032,2032,2032,2033,2033,2033,2032,2031,2031,2032,2032,2033,2032,2032,2032,2031,2031,2031,2032,2032,2033,2033,2033,2034,2034,2034,2034,2034,2035,2035,2034,2034,2034,2034,2033,2032,2031,2030,2030,2030,2031,2031,2030,2030,2031,2031,2032,2033,2034,2034,2034,2035,2036,2038,2039,2041,2042,2042,2043,2044,2044,2044,2045,2047,2048,2049,2051,2051,2051,2051,2050,2049,2049,2049,2049,2050,2050,2049,2049,2049,2049,2049,2050,2050,2049,2049,2048,2048,2049,2049,2050,2051,2052,2052,2051,2051,2050,2050,2050,2051,2051,2051,2050,2049,2049,2048,2048,2049,2049,2050,2051,2052,2051,2050,2049,2049,2048,2048,2049,2049,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2050,2050,2050,2049,2050,2051,2052,2053,2054,2054,2053,2053,2053,2053,2054,2054,2054,2055,2055,2054,2054,2053,2052,2052,2052,2053,2053,2052,2052,2051,2051,2051,2052,2053,2053,2053,2053,2052,2051,2051,2051,2052,2053,2053,2053,2053,2053,2053,2053,2053,2052,2053,2053,2053,2053,2053,2052,2051,2051,2050,2050,2050,2050,2050,2050,2049,2049,2048,2047,2046,2046,2046,2045,2044,2044,2044,2044,2044,2044,2044,2044,2043,2043,2042,2042,2042,2042,2043,2043,2043,2043,2042,2042,2043,2043,2043,2042,2042,2042,2042,2043,2043,2043,2042,2042,2041,2041,2041,2041,2041,2041,2040,2040,2039,2038,2038,2038,2039,2039,2038,2038,2039,2039,2039,2039,2039,2039,2039,2039,2040,2041,2041,2040,2041,2041,2041,2042,2042,2042,2042,2042,2043,2043,2044,2045,2046,2047,2048,2049,2049,2049,2049,2049,2049,2048,2047,2047,2046,2046,2046,2046,2047,2046,2046,2046,2046,2045,2045,2045,2046,2046,2047,2048,2049,2049,2050,2051,2052,2053,2053,2054,2054,2054,2054,2054,2053,2053,2052,2052,2051,2050,2050,2050,2050,2051,2051,2050,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2049,2050,2051,2052,2052,2053,2053,2053,2053,2052,2052,2052,2052,2052,2053,2054,2054,2054,2055,2055,2055,2055,2055,2055,2054,2053,2052,2052,2052,2052,2053,2053,2053,2054,2054,2054,2055,2055,2055,2055,2056,2056,2057,2057,2057,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2059,2059,2060,2059,2059,2059,2059,2059,2059,2059,2059,2058,2058,2057,2057,2056,2056,2055,2055,2055,2054,2053,2052,2051,2050,2049,2048,2048,2047,2047,2046,2045,2044,2044,2043,2043,2044,2044,2043,2043,2042,2042,2042,2042,2042,2043,2043,2044,2044,2045,2045,2045,2045,2045,2044,2044,2044,2045,2045,2045,2045,2045,2045,2044,2043,2043,2043,2042,2042,2042,2042,2043,2043,2043,2043,2043,2042,2042,2042,2042,2042,2042,2042,2043,2043,2043,2042,2042,2042,2041,2041,2042,2042,2043,2043,2043,2043,2044,2044,2044,2044,2045,2045,2045,2044,2043,2042,2041,2041,2041,2042,2042,2042,2042,2041,2040,2040,2039,2040,2040,2041,2041,2042,2042,2042,2042,2043,2044,2045,2045,2045,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2045,2045,2046,2046,2046,2045,2045,2044,2044,2044,2044,2044,2044,2045,2045,2047,2048,2049,2050,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2051,2052,2052,2052,2052,2053,2053,2053,2054,2055,2056,2057,2057,2058,2058,2058,2058,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2056,2056,2056,2056,2056,2056,2056,2057,2057,2057,2057,2057,2058,2058,2059,2059,2059,2059,2059,2059,2058,2058,2058,2058,2058,2058,2057,2057,2057,2057,2057,2056,2056,2055,2054,2053,2052,2052,2052,2052,2052,2052,2052,2053,2054,2054,2055,2055,2055,2054,2054,2053,2053,2053,2053,2053,2053,2053,2052,2052,2051,2051,2051,2052,2052,2052,2052,2052,2051,2051,2051,2050,2050,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2047,2047,2048,2049,2049,2049,2049,2048,2047,2047,2047,2047,2047,2047,2047,2046,2045,2043,2043,2042,2042,2042,2042,2042,2042,2041,2041,2040,2039,2037,2036,2035,2033,2032,2032,2031,2031,2032,2032,2032,2032,2032,2033,2033,2034,2034,2035,2035,2036,2036,2036,2035,2035,2035,2035,2035,2034,2034,2034,2034,2035,2035,2035,2036,2036,2037,2038,2038,2037,2037,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2037,2037,2038,2039,2040,2041,2041,2041,2040,2039,2038,2037,2037,2037,2037,2038,2038,2038,2037,2036,2036,2035,2035,2035,2035,2036,2036,2037,2037,2038,2038,2039,2040,2040,2041,2041,2041,2042,2042,2042,2042,2042,2043,2043,2043,2043,2043,2043,2043,2042,2042,2042,2042,2043,2043,2043,2043,2043,2043,2042,2042,2042,2041,2041,2041,2041,2042,2043,2044,2045,2045,2046,2045,2045,2044,2044,2043,2043,2043,2043,2043,2042,2042,2041,2040,2040,2040,2040,2040,2040,2040,2041,2041,2041,2041,2041,2041,2042,2042,2043,2044,2046,2047,2047,2048,2048,2049,2049,2049,2049,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2050,2051,2052,2052,2053,2053,2053,2052,2052,2053,2053,2053,2054,2054,2054,2054,2055,2054,2054,2054,2054,2054,2054,2054,2054,2054,2053,2053,2052,2051,2051,2050,2050,2050,2050,2050,2051,2051,2050,2050,2050,2050,2050,2049,2049,2050,2049,2049,2050,2050,2051,2051,2052,2052,2053,2053,2053,2054,2055,2055,2056,2057,2057,2057,2057,2057,2057,2058,2058,2059,2059,2059,2059,2059,2060,2060,2060,2060,2061,2061,2062,2062,2063,2063,2063,2062,2062,2061,2061,2061,2061,2062,2062,2063,2063,2063,2063,2063,2062,2062,2062,2062,2062,2063,2063,2064,2064,2065,2065,2066,2066,2066,2066,2066,2066,2066,2066,2065,2066,2066,2066,2066,2066,2066,2066,2066,2066,2066,2065,2064,2064,2063,2063,2062,2062,2062,2062,2062,2061,2060,2059,2058,2057,2056,2055,2055,2054,2054,2055,2055,2055,2054,2054,2053,2053,2052,2053,2053,2053,2053,2053,2054,2054,2054,2054,2053,2052,2051,2051,2050,2051,2051,2052,2052,2053,2053,2053,2052,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2051,2051,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2049,2049,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2050,2050,2049,2048,2046,2045,2044,2044,2043,2043,2043,2044,2044,2043,2043,2043,2042,2042,2042,2041,2041,2040,2040,2040,2040,2040,2041,2041,2041,2041,2041,2041,2041,2041,2041,2041,2041,2041,2041,2041,2041,2042,2042,2042,2042,2042,2043,2043,2043,2043,2042,2042,2042,2042,2042,2042,2042,2042,2042,2041,2041,2041,2041,2041,2041,2041,2040,2039,2039,2039,2039,2039,2039,2039,2039,2039,2039,2040,2040,2040,2041,2042,2042,2043,2043,2043,2043,2043,2042,2042,2042,2041,2041,2041,2040,2040,2040,2039,2038,2037,2036,2036,2036,2035,2035,2035,2035,2035,2036,2036,2037,2037,2037,2037,2037,2037,2037,2037,2037,2037,2037,2037,2037,2036,2036,2036,2036,2036,2035,2035,2034,2034,2034,2034,2034,2035,2035,2035,2035,2035,2035,2036,2036,2036,2036,2035,2035,2035,2036,2037,2037,2038,2038,2037,2037,2036,2036,2035,2036,2037,2038,2039,2040,2040,2040,2040,2039,2039,2038,2038,2038,2038,2039,2039,2040,2041,2042,2042,2043,2043,2043,2043,2043,2044,2045,2046,2047,2047,2047,2047,2047,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2048,2048,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2046,2046,2047,2048,2048,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2047,2047,2047,2046,2046,2046,2046,2045,2045,2046,2046,2047,2047,2047,2048,2048,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2050,2050,2050,2049,2049,2050,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2053,2053,2053,2054,2054,2054,2054,2053,2053,2052,2052,2052,2051,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2052,2052,2053,2053,2054,2054,2054,2054,2054,2054,2054,2054,2055,2055,2055,2054,2054,2054,2054,2054,2054,2054,2054,2054,2054,2054,2053,2053,2053,2053,2054,2054,2054,2055,2055,2055,2055,2056,2056,2057,2057,2057,2057,2057,2057,2057,2057,2057,2056,2056,2056,2056,2056,2057,2057,2058,2059,2060,2060,2060,2059,2059,2058,2058,2058,2058,2058,2058,2059,2059,2060,2060,2061,2061,2061,2060,2060,2060,2060,2060,2060,2059,2059,2058,2057,2056,2056,2055,2055,2055,2054,2054,2054,2054,2054,2054,2054,2054,2053,2053,2053,2052,2053,2053,2053,2053,2054,2054,2053,2053,2053,2053,2053,2052,2052,2052,2051,2051,2050,2050,2050,2050,2050,2051,2050,2050,2050,2051,2051,2051,2051,2051,2051,2050,2049,2049,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2050,2050,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2050,2048,2047,2047,2047,2046,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2044,2044,2044,2044,2044,2043,2043,2043,2043,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2045,2045,2045,2044,2044,2044,2043,2043,2043,2043,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2045,2045,2045,2046,2047,2047,2047,2047,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2044,2044,2044,2044,2043,2042,2042,2041,2041,2041,2040,2041,2041,2041,2041,2042,2042,2042,2041,2041,2040,2040,2040,2041,2041,2041,2041,2040,2040,2040,2040,2040,2040,2041,2041,2041,2041,2041,2040,2040,2039,2039,2040,2040,2040,2040,2040,2040,2039,2039,2039,2038,2038,2038,2038,2038,2039,2039,2039,2039,2039,2039,2039,2038,2038,2038,2038,2038,2038,2038,2038,2039,2039,2040,2040,2041,2041,2041,2041,2041,2041,2040,2040,2040,2040,2040,2040,2041,2041,2041,2041,2041,2041,2040,2040,2039,2039,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2041,2041,2041,2041,2041,2042,2042,2042,2043,2043,2043,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2049,2049,2049,2050,2050,2050,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2050,2050,2050,2050,2050,2051,2051,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2054,2054,2054,2054,2054,2054,2053,2053,2052,2052,2052,2052,2052,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2054,2055,2055,2056,2056,2056,2056,2056,2056,2056,2056,2056,2056,2056,2056,2056,2055,2055,2054,2053,2052,2052,2052,2052,2052,2052,2052,2051,2051,2050,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2051,2051,2051,2052,2052,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2052,2053,2052,2052,2052,2052,2052,2052,2052,2052,2053,2053,2053,2054,2054,2054,2054,2054,2054,2054,2055,2055,2055,2055,2054,2054,2054,2054,2054,2054,2053,2053,2053,2053,2052,2052,2052,2052,2052,2053,2053,2053,2053,2053,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2047,2047,2047,2046,2046,2046,2045,2045,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2041,2041,2041,2041,2041,2040,2040,2040,2040,2040,2039,2039,2039,2038,2038,2037,2037,2038,2038,2039,2039,2040,2041,2041,2042,2043,2043,2044,2045,2045,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2051,2051,2052,2052,2053,2053,2053,2054,2054,2054,2054,2054,2053,2053,2053,2053,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2044,2044,2043,2043,2043,2043,2042,2042,2042,2041,2041,2041,2040,2040,2040,2040,2040,2039,2039,2039,2039,2039,2039,2039,2039,2039,2039,2039,2039,2038,2038,2038,2038,2039,2039,2039,2039,2040,2040,2040,2040,2041,2041,2041,2041,2041,2041,2041,2041,2041,2041,2041,2041,2042,2042,2042,2042,2042,2043,2043,2043,2043,2043,2042,2042,2042,2042,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2042,2042,2042,2042,2041,2041,2041,2040,2040,2040,2040,2040,2040,2040,2040,2040,2041,2041,2041,2041,2042,2042,2042,2043,2043,2043,2043,2044,2044,2044,2044,2044,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2046,2047,2048,2048,2049,2049,2050,2050,2051,2051,2051,2052,2052,2052,2053,2053,2053,2054,2054,2055,2056,2056,2056,2057,2057,2058,2058,2058,2058,2059,2059,2059,2059,2060,2060,2060,2060,2060,2060,2060,2060,2061,2061,2061,2062,2062,2062,2062,2062,2062,2062,2062,2063,2063,2064,2064,2064,2065,2065,2065,2065,2065,2065,2065,2064,2064,2064,2064,2063,2063,2064,2064,2064,2064,2065,2065,2065,2065,2065,2065,2065,2065,2065,2065,2065,2065,2065,2065,2065,2065,2065,2065,2064,2064,2063,2063,2062,2062,2061,2061,2060,2060,2060,2060,2060,2059,2059,2059,2059,2059,2059,2058,2058,2058,2057,2057,2056,2056,2056,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2054,2054,2054,2053,2053,2052,2052,2052,2051,2051,2051,2051,2051,2050,2050,2049,2049,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2044,2044,2044,2043,2043,2042,2041,2041,2041,2040,2040,2040,2040,2039,2039,2038,2038,2038,2038,2038,2038,2038,2038,2038,2038,2038,2037,2037,2037,2037,2037,2037,2038,2038,2038,2038,2038,2038,2038,2037,2037,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2035,2035,2035,2035,2035,2035,2035,2035,2035,2034,2034,2034,2034,2034,2034,2033,2033,2033,2033,2032,2032,2032,2032,2033,2033,2033,2033,2033,2033,2033,2033,2033,2033,2033,2034,2034,2034,2034,2034,2035,2035,2035,2035,2035,2035,2036,2036,2036,2036,2036,2037,2037,2038,2039,2039,2040,2041,2041,2042,2042,2042,2043,2043,2043,2044,2044,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2049,2049,2049,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2053,2053,2053,2054,2054,2054,2054,2054,2055,2054,2054,2054,2054,2054,2054,2054,2055,2055,2055,2055,2055,2055,2056,2056,2056,2056,2056,2056,2056,2056,2056,2056,2056,2056,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2056,2056,2056,2056,2056,2056,2055,2055,2055,2054,2054,2054,2054,2053,2053,2053,2053,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2053,2054,2054,2054,2054,2055,2055,2055,2056,2056,2056,2056,2056,2056,2056,2056,2055,2055,2055,2055,2054,2054,2054,2054,2053,2053,2053,2053,2052,2052,2052,2052,2051,2051,2051,2050,2050,2049,2048,2048,2047,2047,2046,2046,2045,2045,2044,2044,2044,2043,2043,2043,2042,2042,2042,2042,2042,2042,2042,2042,2041,2041,2041,2041,2041,2041,2041,2041,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2046,2046,2045,2045,2045,2044,2044,2044,2043,2043,2043,2042,2042,2041,2041,2041,2040,2040,2040,2040,2039,2039,2039,2038,2038,2037,2037,2037,2036,2036,2036,2036,2036,2036,2036,2037,2037,2037,2037,2038,2038,2038,2039,2039,2039,2039,2039,2039,2039,2040,2040,2041,2041,2041,2042,2042,2042,2043,2043,2043,2044,2044,2045,2045,2045,2046,2046,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2053,2053,2053,2053,2053,2053,2054,2054,2054,2054,2054,2054,2054,2054,2054,2054,2055,2055,2055,2054,2054,2054,2054,2055,2055,2055,2055,2055,2056,2056,2056,2056,2055,2055,2056,2056,2056,2056,2056,2055,2055,2055,2055,2055,2055,2055,2055,2055,2054,2054,2054,2054,2054,2054,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2043,2043,2043,2043,2042,2042,2042,2042,2043,2043,2043,2043,2043,2043,2043,2043,2042,2042,2042,2042,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2053,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2043,2043,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2046,2046,2047,2047,2047,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2052,2052,2053,2053,2053,2053,2053,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2051,2051,2051,2051,2052,2052,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2053,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2043,2043,2043,2042,2042,2042,2042,2042,2041,2041,2041,2041,2041,2041,2041,2041,2041,2041,2041,2041,2042,2042,2042,2043,2043,2043,2043,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2043,2043,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2051,2051,2051,2052,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2052,2051,2052,2052,2051,2051,2051,2051,2050,2050,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2044,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2042,2042,2042,2041,2041,2041,2041,2041,2041,2040,2040,2040,2040,2040,2040,2041,2041,2041,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2041,2041,2041,2042,2042,2042,2043,2043,2043,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2053,2053,2053,2053,2053,2053,2053,2052,2053,2053,2053,2053,2054,2054,2054,2055,2055,2055,2056,2055,2056,2056,2056,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2056,2056,2056,2055,2055,2055,2055,2055,2055,2054,2055,2054,2054,2054,2054,2054,2054,2054,2054,2053,2053,2053,2053,2053,2053,2053,2052,2053,2053,2052,2052,2052,2052,2051,2051,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2047,2046,2046,2046,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2043,2043,2043,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2041,2043,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,};
+/*IMA ADPCM sound, 47856 samples at 6176 Hz, generated by Tools/adpcm_encoder.c*/
+#include "adpcm.h"
+
+const uint8_t spaceship_explode_data[] = {
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x02,0x80,0x80,0x80,0x00,0x70,0x8A,0x80,0xF0,0x03,0x08,0xC4,0x00,0x08,0xD8,0x30,0x80,0x08,0x08,
+0x87,0x80,0x0C,0x08,0x3D,0x80,0x00,0x68,0x08,0xC8,0x80,0x40,0xD0,0x30,0xB3,0x8C,0x80,0x80,0x80,0x80,0x17,0x0D,0x03,0x08,0xD8,0x3B,0xD0,0x43,0x8B,0x80,0x0C,0x03,
+0x08,0x08,0x08,0xF9,0x02,0x50,0x08,0xBD,0x03,0x80,0x80,0x80,0x37,0x9F,0x08,0x84,0x89,0x80,0xB8,0x30,0x04,0x8F,0x82,0x20,0xAD,0x22,0xB3,0xB3,0x48,0x80,0x0C,0x7C,
+0xB8,0xA0,0x40,0xC2,0x01,0xA8,0x30,0x08,0xC8,0x43,0xB8,0x3C,0x00,0xC4,0x30,0x0F,0x01,0x31,0x0B,0xF8,0x21,0x8A,0xB0,0x03,0x03,0x0D,0xB8,0x17,0xAB,0x3B,0x03,0x08,
+0xC4,0x30,0x80,0xBF,0x20,0x95,0x2A,0x8A,0x33,0xC0,0x3B,0x00,0xD8,0x7B,0x80,0x94,0x88,0x8C,0x02,0x02,0x3B,0xBC,0x43,0xC0,0x3B,0x40,0xF8,0x01,0xA2,0x58,0xC9,0xA9,
+0x42,0xA0,0x80,0x50,0xA0,0xA2,0x72,0xB9,0x2C,0xA1,0x04,0x0C,0x21,0xAA,0xB2,0x30,0x0F,0x97,0x08,0x1D,0x81,0x83,0x9C,0xA3,0x90,0x8B,0x74,0xB0,0x80,0x2A,0xD2,0x28,
+0x09,0x04,0x1C,0x38,0x08,0x87,0x1C,0xF9,0x18,0x01,0x02,0x0B,0x84,0x3B,0xAA,0x92,0x2C,0xC0,0x44,0xB0,0x31,0x89,0xDA,0x13,0x39,0xA1,0x8B,0x27,0xBB,0x83,0x9F,0x21,
+0x81,0x91,0x9B,0x51,0xB2,0x1F,0x94,0x1A,0x80,0x02,0xD1,0x39,0xDB,0x22,0xE8,0x58,0xA1,0x29,0x1B,0xA4,0x39,0x80,0x0B,0x83,0x42,0x89,0xEF,0x23,0xAA,0x11,0x8A,0x38,
+0x31,0xFB,0x12,0x0F,0x90,0x20,0xA1,0x50,0x88,0xB1,0x39,0x6A,0xC0,0x90,0x89,0x80,0x04,0x1C,0x17,0x8F,0x85,0x1B,0x80,0x80,0x80,0x00,0x2A,0xC1,0x30,0x08,0x31,0x04,
+0xCA,0xD9,0x8C,0x08,0x10,0x80,0x9C,0x17,0x99,0x38,0xC2,0x28,0x58,0x00,0xA3,0x4B,0xA9,0x83,0x19,0x64,0x90,0x81,0x9E,0x18,0xB2,0x88,0xCF,0x10,0x20,0x22,0x80,0x99,
+0x94,0x0D,0x84,0x31,0xC8,0x9C,0x03,0x9B,0x99,0x28,0xB2,0x7A,0x11,0x81,0xCC,0x88,0xA4,0x5B,0x90,0x13,0x0D,0x81,0xB3,0x4B,0xFB,0x99,0x3B,0x1D,0x95,0x9A,0x28,0x12,
+0x06,0x18,0x91,0x89,0x0A,0x00,0x8F,0x12,0x0A,0x89,0x17,0x70,0xF9,0x39,0x91,0x00,0xA8,0x18,0x89,0x32,0xC8,0x0A,0x21,0x37,0x32,0x94,0xCC,0x8C,0xC9,0x00,0x48,0x80,
+0x81,0x19,0xA1,0x73,0xC0,0x11,0x21,0xA0,0x10,0x0A,0x41,0xD3,0x10,0x33,0x2A,0xA5,0xEB,0x1B,0x9C,0xA5,0xB9,0x2A,0x01,0x62,0x20,0xA8,0xB5,0x9F,0x22,0x81,0x99,0x2A,
+0x90,0xB9,0x88,0x2A,0x07,0x99,0xE9,0x38,0x9C,0x90,0x40,0xFA,0x13,0x20,0x29,0xA9,0x00,0xD8,0x0D,0xC8,0x80,0x53,0x01,0x9B,0xA4,0x3D,0x04,0x98,0x11,0x18,0x81,0x89,
+0x33,0xBF,0x03,0x9A,0x72,0x81,0xA8,0x00,0x1B,0x00,0x9B,0x86,0x06,0x1C,0x88,0xDA,0x40,0x80,0x26,0x00,0x9A,0xBF,0x88,0x10,0x20,0x25,0x89,0x30,0xC8,0x9C,0x01,0x42,
+0x28,0xC8,0x01,0xAC,0x22,0x98,0x30,0x86,0xB0,0x19,0xA9,0x3A,0x4B,0xF3,0x39,0xD0,0x04,0x28,0x0C,0x80,0x99,0x88,0x62,0xA1,0x09,0x8A,0x82,0x78,0x11,0x99,0x14,0x07,
+0x0A,0xB2,0x9D,0xAB,0x0B,0x40,0x83,0x86,0xA1,0x9F,0x38,0x90,0x22,0x12,0x82,0x18,0xF9,0x1B,0x29,0xBB,0xC2,0x71,0xA1,0xB9,0x98,0x0C,0xA0,0x31,0x3B,0xA8,0xB6,0x81,
+0x70,0xE2,0x8C,0x32,0x98,0x91,0x0A,0x92,0x83,0x3D,0x00,0xA0,0xBC,0x22,0x91,0x9F,0x81,0x13,0x99,0x38,0x26,0x06,0x1D,0x89,0x95,0x09,0x19,0x93,0x50,0x28,0xC3,0x98,
+0x79,0x10,0xB8,0xB2,0x98,0x8E,0x1A,0xD2,0x49,0x80,0xA5,0x28,0xA9,0x3A,0x28,0x26,0x94,0x4A,0xC0,0x21,0x29,0x03,0x12,0x41,0x2A,0x80,0x97,0x2A,0xBB,0x8B,0xEB,0x00,
+0x9B,0xDD,0xB9,0x36,0xAB,0xE1,0x5B,0xA1,0x49,0x91,0x98,0xBC,0x20,0x44,0x88,0x9A,0x81,0x38,0xB3,0x9E,0x40,0x90,0x05,0x1A,0x0A,0x82,0xA8,0xB9,0xB1,0x7C,0x31,0xE6,
+0x0C,0x20,0xB4,0x2A,0x00,0x00,0xB8,0xCB,0x79,0x84,0x89,0x09,0x90,0x81,0x28,0x28,0xB0,0x01,0x03,0x9F,0x58,0x22,0x91,0xBA,0x2A,0x95,0x19,0x48,0x90,0xDE,0x00,0x0B,
+0x11,0xE0,0x0A,0x31,0xA9,0x13,0x30,0xAF,0x35,0x90,0x99,0x3B,0x37,0xD1,0x30,0x2B,0x22,0xF1,0x2C,0x88,0x92,0xBA,0x5A,0xBC,0x92,0x55,0x80,0xEA,0x0A,0xA2,0x60,0xB8,
+0x31,0x19,0x11,0x14,0xC8,0xAB,0x7B,0x85,0x89,0x8A,0x12,0x22,0x83,0x18,0x8C,0x06,0x08,0x09,0x21,0x90,0xFA,0x1A,0x83,0x58,0x21,0xDD,0x09,0x32,0xC8,0x8A,0x93,0x19,
+0x81,0xDF,0x20,0x98,0x91,0x09,0xA8,0xE9,0x58,0x98,0x0C,0x88,0x02,0x9B,0x92,0xEA,0x39,0x91,0x72,0x94,0x9D,0x01,0x81,0x23,0x3C,0xE8,0x48,0x82,0xAA,0xAA,0xB1,0x54,
+0x20,0x14,0xBC,0x10,0x81,0x31,0x93,0x9F,0x10,0x10,0x19,0x24,0xFA,0x89,0x52,0x90,0x01,0x29,0x06,0x1A,0xC0,0x00,0x81,0x81,0x1C,0xFB,0x9C,0x31,0x22,0x02,0xB3,0xC8,
+0x0E,0x98,0x0C,0x22,0x51,0x85,0x80,0x09,0xDA,0x8A,0x45,0x10,0x81,0xC9,0x28,0x18,0x42,0xA4,0xDF,0x2A,0x13,0x90,0x9A,0xBA,0x8C,0x14,0x28,0x90,0x20,0x18,0x41,0xB4,
+0xBF,0x21,0xEB,0x19,0x16,0x00,0xCB,0x11,0xB9,0x53,0xA9,0x29,0x83,0xAD,0x32,0x10,0x88,0xA8,0x52,0x14,0x30,0xBE,0x08,0x22,0xAA,0x73,0x92,0x99,0x12,0x9A,0x40,0x80,
+0xA8,0x57,0x91,0x39,0xC0,0xAC,0xBA,0x61,0xA2,0xAC,0x8A,0x44,0x91,0x2A,0x11,0x85,0x98,0xBC,0x88,0xFA,0x20,0x12,0xA9,0x38,0x88,0xA8,0xAE,0x09,0x73,0xC0,0x88,0x18,
+0x88,0xBB,0x8A,0x36,0x00,0x82,0x4B,0x01,0x00,0x84,0x44,0xFD,0x8C,0x14,0x01,0xAA,0x80,0xBA,0x21,0x9A,0x42,0x15,0x30,0x12,0x86,0x0E,0x08,0xC9,0x0B,0x27,0x08,0x98,
+0x21,0xBA,0x72,0xB0,0x11,0xA0,0x19,0x89,0xA8,0x80,0x2A,0x27,0x28,0x00,0x23,0xD2,0x9A,0x2B,0x9C,0x89,0x78,0xC3,0xCA,0x82,0x22,0x22,0x10,0x73,0x91,0xAD,0x9B,0x00,
+0xBE,0x22,0x99,0xF1,0x39,0x28,0x08,0x99,0x01,0x11,0xF1,0x0F,0x90,0x23,0x10,0xD9,0x8A,0x32,0x94,0x2E,0xA3,0x11,0xD9,0x8D,0x11,0x10,0x9A,0x12,0x90,0xC8,0x48,0x5B,
+0x92,0x3B,0xB3,0x24,0xD9,0x39,0x9A,0x93,0x62,0x5A,0x83,0xC1,0x9C,0x8A,0x22,0x89,0x15,0x38,0x8F,0x85,0x0C,0x90,0x58,0xC8,0x81,0x38,0x11,0x11,0xC1,0x6B,0x02,0xAA,
+0x80,0x98,0xA0,0xCB,0x73,0x08,0x00,0x12,0x00,0xCD,0x90,0x0A,0xB9,0x48,0x93,0xBC,0x41,0x19,0x01,0xA2,0x70,0xC2,0xAB,0x9B,0x6B,0xE2,0x30,0x02,0x81,0x1C,0xC8,0x98,
+0x98,0xA5,0x29,0xA8,0x50,0xA9,0x73,0x04,0xB9,0x89,0x38,0xA5,0x2D,0xA3,0x10,0x89,0x1A,0xC4,0x00,0xAA,0x4A,0x82,0xC9,0x2A,0x07,0x88,0x3C,0x94,0x11,0xF8,0x18,0x9C,
+0x22,0x19,0x91,0x01,0x18,0xA0,0x0A,0x83,0x7A,0xE3,0x11,0x9A,0x20,0x19,0x03,0xBE,0xA8,0x27,0x2A,0xA0,0x70,0xD1,0x3A,0x81,0x83,0x88,0x28,0x19,0x01,0x82,0xC2,0x9C,
+0x0C,0xA8,0x19,0xFA,0x0A,0xB8,0x87,0x0F,0x20,0xA1,0x99,0x99,0x42,0x91,0x29,0x9B,0xA2,0x39,0x17,0x1C,0x40,0xD1,0x09,0x03,0xA9,0x0B,0x83,0xB6,0x58,0x38,0xA1,0x08,
+0xC8,0x16,0x2A,0xDB,0xA1,0x32,0x89,0x1F,0x08,0xB3,0xB1,0x48,0xBB,0x20,0x8A,0x21,0xAA,0xF2,0x58,0xB9,0x32,0xB9,0xB8,0x48,0xFC,0x09,0x28,0xA4,0x80,0x3A,0x34,0x0B,
+0x03,0x07,0x81,0x9A,0x6D,0x13,0xA9,0x80,0x20,0xA9,0x18,0x84,0xB6,0x1B,0x4B,0x70,0xA0,0x82,0x98,0x86,0x49,0x80,0x08,0xB0,0x9D,0x99,0x84,0x41,0x98,0x4B,0x8A,0xF1,
+0x2B,0x03,0xA8,0x9C,0x28,0x88,0x09,0xC2,0x34,0xB1,0x2C,0x92,0x9F,0x00,0xA8,0x61,0x01,0x0B,0xE8,0x90,0x13,0x70,0x80,0x08,0x8A,0x04,0xC1,0x28,0x10,0x8D,0x05,0x99,
+0x8B,0x28,0x23,0x93,0x89,0x40,0x0F,0xA0,0xC3,0x10,0x0C,0xB8,0x3C,0xB1,0x24,0x96,0x0B,0x02,0x98,0x9C,0x90,0x58,0x98,0x08,0xB3,0xDA,0x9A,0x1D,0x93,0x59,0x88,0xA8,
+0x80,0x29,0xE2,0xA4,0x58,0xC8,0x4A,0x03,0x62,0x80,0xC0,0x58,0x92,0x61,0xA9,0x00,0xF2,0x19,0x1B,0x90,0x24,0x92,0x0C,0x18,0x92,0x1B,0xBA,0x14,0xAB,0x28,0x8D,0xA9,
+0x9A,0x41,0x07,0x0D,0x89,0x00,0x2A,0x09,0xD2,0x03,0x1C,0x01,0xA3,0x29,0x24,0x8E,0x12,0x1B,0x87,0x09,0x81,0x38,0x9B,0x92,0x38,0xAC,0x8A,0x67,0x12,0xA0,0x0A,0x81,
+0x9F,0x80,0x21,0xCB,0xC2,0x40,0x8B,0x45,0x9A,0xC9,0x33,0x02,0xCB,0x38,0x1C,0xA1,0x10,0x87,0xAB,0xC8,0x19,0xA8,0x38,0xB9,0x91,0x61,0x13,0xAB,0x92,0x05,0xB0,0x60,
+0x0B,0x64,0x82,0xAA,0x89,0x07,0x14,0x0B,0x18,0xC9,0x00,0x00,0x99,0x71,0xB2,0x69,0x93,0x81,0xAC,0xA9,0x39,0x82,0xD8,0x09,0x00,0x98,0x2B,0xF1,0x29,0xC8,0x40,0x20,
+0xA8,0x3C,0xF8,0x71,0x82,0x9B,0x08,0x02,0x19,0x8C,0x14,0x98,0x99,0x00,0x23,0xB0,0x91,0x8F,0x29,0xCC,0x98,0x72,0xB3,0x8A,0x09,0x08,0x12,0x43,0xED,0x1B,0x13,0x83,
+0x99,0xBC,0x8B,0x05,0x41,0xC9,0x09,0x0A,0x91,0x89,0xB3,0x4C,0x99,0xD2,0x40,0x03,0x4A,0x93,0x3C,0xA3,0x72,0x91,0x28,0xB8,0x36,0xAA,0x80,0x1B,0x89,0xB2,0x96,0x0E,
+0x98,0x48,0xB9,0x17,0x0B,0x28,0x12,0xD0,0x48,0xB9,0xB4,0x8D,0x01,0x2A,0x10,0xC2,0x0B,0x91,0x01,0x40,0xF2,0x09,0x8A,0xB2,0x31,0x49,0xBA,0x7C,0x17,0x9A,0x08,0x28,
+0x10,0xC0,0x39,0xA2,0x90,0x9E,0x24,0x28,0x89,0xC2,0x29,0x9B,0x23,0x10,0x40,0xDA,0x04,0x10,0x58,0x98,0xC8,0x64,0x91,0x19,0x81,0x28,0x8C,0xA3,0x92,0x32,0x1A,0xC8,
+0x5A,0x2A,0xB4,0x28,0x87,0x8D,0x89,0x15,0x1A,0x31,0xEA,0x12,0x00,0xBA,0x48,0x84,0x39,0xC1,0x9E,0xA9,0x89,0xA1,0xCB,0x81,0x8C,0x12,0x1A,0xFA,0x00,0x80,0x98,0x58,
+0x08,0x99,0x80,0xBA,0xB9,0x2C,0x77,0x00,0x9D,0x31,0x98,0x88,0x06,0x89,0xC0,0x3B,0xA0,0x1A,0x43,0x21,0xFA,0x29,0x81,0xB2,0xAA,0x70,0x9A,0x18,0xBA,0xB2,0x52,0xA8,
+0x01,0x3A,0x3B,0xF1,0x50,0x18,0x93,0xA1,0x72,0x80,0x01,0x82,0x59,0x58,0xA5,0x0A,0x53,0xA8,0x29,0x90,0x24,0x99,0x63,0x9B,0x08,0x80,0xF2,0x48,0x99,0x00,0x8A,0xD0,
+0x8B,0x00,0x89,0x42,0xBA,0xD8,0x42,0x99,0x19,0x07,0x9C,0x80,0x99,0xC9,0xB9,0x71,0x99,0x00,0x80,0x91,0x9B,0xEB,0x18,0x00,0x88,0x29,0x57,0xCA,0xA8,0x09,0x62,0x00,
+0x03,0x8C,0x89,0x10,0x06,0x09,0x07,0x9A,0x99,0x59,0xA3,0x2B,0x15,0xB8,0x8A,0x58,0xB1,0x8B,0x58,0x18,0x84,0xB8,0x98,0x1D,0x11,0x20,0x31,0xA4,0x9F,0x14,0x89,0x81,
+0x18,0x23,0x99,0x98,0x0E,0xA1,0x8B,0x97,0x88,0x2A,0x49,0xC8,0x19,0xB1,0xA9,0xE2,0x70,0xB3,0x9B,0x3B,0x94,0x28,0xBA,0xC8,0xEC,0x21,0x32,0x9B,0x80,0x48,0xC8,0x30,
+0x97,0xBA,0x39,0x35,0xBA,0x48,0xB2,0x5A,0xB0,0xA1,0x1A,0x46,0x88,0xBB,0xAA,0x53,0xD9,0x19,0x27,0x91,0xBA,0x99,0x68,0x01,0x24,0xC9,0x09,0x80,0x30,0x80,0x37,0xCB,
+0x90,0x2B,0x06,0x99,0x33,0x80,0x9C,0x19,0x85,0x9D,0x23,0x19,0x93,0xB8,0x89,0x0E,0x32,0x10,0x00,0x82,0xEF,0x22,0x99,0x0A,0x22,0x11,0x00,0xA8,0xAF,0x00,0x28,0x87,
+0xAA,0x18,0x49,0xA9,0x08,0x03,0xC0,0x93,0x1F,0xD2,0x2B,0x12,0xB1,0x58,0x20,0xFA,0x98,0x38,0x20,0xC0,0x31,0x0C,0xC3,0x3B,0x85,0xFA,0x29,0x22,0xBA,0x40,0xD8,0x18,
+0xA0,0xAA,0x68,0x22,0xD0,0x09,0x99,0x99,0x98,0x31,0x25,0xA1,0x99,0x0F,0x90,0x48,0x80,0xC9,0x73,0xB1,0x0C,0x12,0x08,0xC9,0x18,0x09,0x92,0x00,0x20,0x93,0xBF,0x28,
+0x80,0x30,0x13,0x23,0xCD,0xAB,0x11,0x50,0x91,0x00,0x73,0xF8,0x19,0x95,0x0B,0x19,0x14,0x11,0x98,0xA9,0x99,0x72,0x33,0xE1,0x0B,0x92,0xBA,0x70,0x12,0x80,0x18,0x94,
+0xAC,0xA8,0x41,0x00,0x80,0x55,0xFA,0x38,0xA2,0xAB,0x19,0x15,0x81,0x28,0x00,0xAA,0xAA,0x28,0xA2,0xA9,0x85,0x81,0x1F,0x89,0x08,0xBA,0xC8,0x06,0x98,0x01,0x9C,0xAA,
+0x79,0x03,0x8A,0xB9,0x94,0x00,0x92,0x3A,0x71,0x30,0x10,0xBB,0x17,0xD9,0xAC,0x60,0x90,0x19,0x9A,0x28,0x18,0xC8,0x15,0x01,0x89,0x8A,0x30,0x23,0xA9,0x35,0x12,0xAA,
+0x09,0x85,0x52,0x98,0x2A,0x82,0x48,0x82,0x2B,0xD5,0xAA,0x49,0x24,0xAA,0x11,0xA9,0x36,0x99,0x48,0x21,0x97,0x39,0xEA,0x11,0x80,0x2C,0xB9,0xA8,0x92,0xF0,0x8E,0x46,
+0xA8,0x88,0x0B,0x92,0x38,0x43,0xA4,0x9F,0x01,0x00,0x18,0x0B,0xA3,0xC0,0x99,0x9B,0x0D,0xFA,0x08,0x08,0x42,0xB1,0xAE,0xA9,0x41,0x89,0x23,0x1D,0x82,0xAA,0x80,0x07,
+0x00,0x0A,0x28,0x28,0x12,0xC5,0x8E,0x11,0x18,0xA4,0x8D,0x31,0x91,0x4C,0x13,0xA9,0xA3,0x9C,0x22,0x44,0x18,0xD0,0x48,0x91,0x82,0x00,0x28,0xA0,0x0B,0x11,0xBA,0xC3,
+0x3E,0x88,0xB0,0x00,0xC9,0x58,0xAA,0x23,0x22,0xF8,0x1B,0xBA,0x98,0x42,0xDA,0x10,0x13,0x9E,0xD9,0x41,0x01,0xA9,0x3C,0x03,0xA0,0xF4,0x69,0xB9,0x21,0x71,0xB0,0x18,
+0x03,0x9B,0xB5,0x49,0x28,0xA2,0xAD,0xA0,0x68,0xA9,0xA8,0x9A,0x47,0xB0,0x09,0x8A,0x93,0x5C,0x96,0x8A,0x80,0x80,0x18,0x20,0xC3,0x1A,0x80,0x08,0x31,0x90,0xB2,0x15,
+0x2B,0xA4,0x48,0x81,0xB9,0x77,0x9B,0x10,0x92,0x1A,0x0A,0x37,0x82,0xAF,0x13,0x0A,0x08,0x01,0x81,0xA9,0x28,0xC1,0x4A,0xC9,0x99,0xAA,0x8C,0x08,0xE9,0x82,0x9C,0xA8,
+0x19,0x9C,0xA2,0xBA,0x8A,0x8C,0xEA,0x9B,0x12,0xD9,0x08,0x78,0xBA,0x8A,0x57,0xA1,0x9B,0x79,0x93,0xAA,0x09,0x33,0x08,0x43,0xA9,0x33,0xE8,0x00,0x8A,0x8A,0x10,0x00,
+0xEA,0x19,0xCA,0x19,0xE0,0x4A,0xB0,0x0B,0x33,0x90,0x3B,0xA1,0x05,0xCC,0x20,0x01,0x99,0xB4,0x4C,0x8A,0x27,0x01,0x11,0x31,0x08,0x33,0x27,0x00,0x82,0x32,0x2A,0x42,
+0x10,0x93,0xB1,0x2B,0xD0,0x08,0x93,0x3C,0xB3,0x0F,0xD4,0x21,0x98,0x9C,0xF0,0x9A,0x10,0x2B,0x9A,0x96,0x2A,0x9A,0xA9,0x43,0xA1,0x99,0x6B,0x19,0xB1,0xC2,0xBC,0x0A,
+0x81,0xA9,0x78,0xB3,0xBA,0x39,0x09,0x50,0x16,0x92,0x10,0x72,0x11,0x20,0x47,0x18,0x81,0x02,0xB2,0x79,0x11,0x9A,0x02,0x32,0x14,0x31,0x58,0xD0,0x02,0x40,0x31,0x24,
+0x80,0x11,0x62,0xB8,0x86,0x1A,0xF9,0x8A,0x01,0x89,0xA0,0x40,0x00,0xD9,0x18,0x1A,0x90,0x9B,0xE9,0xC0,0x8A,0xAD,0x98,0x89,0x49,0xE0,0xAB,0x9C,0xA9,0x98,0xB9,0x39,
+0xBE,0xB8,0xAF,0xA8,0xB8,0x0B,0xF1,0x0B,0xA2,0x9B,0x89,0x0B,0x86,0xA0,0x40,0x10,0x80,0x99,0x13,0x20,0xF8,0x0F,0x92,0x80,0x10,0x80,0x9D,0x43,0x93,0x80,0x9A,0x79,
+0x27,0x00,0x11,0x53,0x00,0x28,0x31,0xA6,0x28,0x92,0x68,0x20,0xC0,0x89,0x31,0x20,0xF2,0x30,0x10,0x80,0x41,0x25,0x21,0x9A,0x01,0x14,0xF8,0x2B,0x91,0x88,0xDF,0x11,
+0x11,0x10,0x21,0xB8,0x02,0x1D,0x08,0x08,0x83,0xB9,0x1A,0xE0,0x8B,0x38,0x98,0xFD,0x38,0x10,0x01,0xB9,0xA8,0xAC,0xAC,0x8B,0x35,0x0B,0xFB,0x11,0xAD,0x98,0x0B,0x03,
+0x1A,0x99,0x29,0x04,0x07,0x88,0x24,0x52,0x21,0x8A,0x36,0xA2,0x9D,0xAA,0x28,0xE3,0x28,0x99,0x08,0x1C,0x90,0xF9,0x29,0x43,0x99,0x7A,0x12,0x82,0x91,0x8A,0x61,0x80,
+0x11,0x0B,0x37,0x99,0xAD,0x8A,0x06,0xBA,0x80,0x9A,0x19,0x98,0x67,0x03,0xB9,0x98,0xAA,0x31,0x72,0x33,0xFA,0xAA,0x9B,0x14,0x42,0x92,0x9B,0x9A,0x53,0xCC,0x43,0x80,
+0x89,0x80,0x0A,0x81,0x98,0x9F,0x43,0xA8,0x0A,0x31,0xF2,0x8C,0x00,0x10,0xB8,0xA0,0x18,0xCD,0x63,0xB8,0x9C,0x21,0x84,0x9A,0x10,0xB9,0x0A,0x30,0x47,0xBA,0x0A,0x32,
+0x26,0xD9,0x89,0x31,0x21,0xCA,0x61,0xB0,0x9D,0x22,0x20,0xD0,0x0B,0xA0,0x30,0xB1,0xB9,0x2D,0x90,0xA9,0x61,0xA8,0xB8,0x3A,0x85,0x51,0x32,0xE9,0x89,0xCB,0x26,0xA9,
+0x11,0x88,0xAB,0xAA,0x47,0x88,0x88,0x19,0xB9,0x63,0x32,0x14,0xDA,0x99,0x8A,0x15,0x41,0x12,0xAD,0xA8,0x51,0xC1,0x40,0x02,0xA9,0x18,0x80,0x11,0x84,0xCD,0x60,0xA2,
+0x09,0x0A,0x85,0x99,0x18,0x82,0x29,0x34,0xF9,0x98,0x39,0x05,0xA9,0x3A,0x82,0x99,0x48,0x91,0xAF,0x08,0x63,0x92,0x9C,0xA9,0x51,0x84,0xAB,0x8A,0x35,0x98,0x98,0x12,
+0xEA,0x3B,0x03,0x00,0xAC,0x98,0x38,0xBA,0x03,0x9A,0xCA,0xBA,0x5D,0x91,0xD0,0x10,0xE9,0x38,0x53,0x91,0xBC,0x81,0x0B,0x45,0x00,0x00,0xEB,0x99,0x20,0x21,0x90,0x9A,
+0x11,0xB8,0x2F,0x26,0xB1,0x8A,0x31,0x98,0x0C,0x37,0xE8,0x09,0x89,0x01,0x21,0x80,0x8D,0x02,0x1B,0xC1,0x88,0x82,0x7A,0xA1,0x9D,0x29,0x04,0xA3,0x1B,0xD2,0x29,0x58,
+0xB8,0x13,0xAC,0x42,0xE0,0x10,0x1B,0x21,0xB1,0x99,0x8B,0x37,0x81,0x8B,0xAC,0xDA,0x71,0x81,0x88,0x39,0xA3,0xAB,0xAD,0x39,0xB0,0x57,0xA9,0xB9,0x18,0x7A,0xA3,0x8C,
+0x12,0xA1,0x09,0x28,0x83,0x89,0x11,0xB9,0x8C,0xF0,0x70,0x02,0x90,0x98,0x09,0x24,0x95,0x1A,0xAA,0xCC,0x19,0x47,0x81,0xA8,0x0A,0xB8,0x68,0x84,0xA9,0x31,0x01,0x98,
+0x0B,0x17,0xBB,0x00,0x21,0xA0,0x12,0x8D,0x82,0x43,0xBA,0xA9,0x93,0x3A,0x47,0x89,0xAC,0x43,0xE0,0x28,0x00,0x14,0x0B,0xDA,0x88,0x24,0xA9,0x30,0xA1,0x56,0xC9,0x99,
+0x12,0x90,0x28,0xBA,0x11,0x21,0x30,0xEE,0x09,0x32,0x03,0xB1,0xCF,0x89,0x01,0x32,0xF0,0x19,0x00,0xEA,0x8B,0x52,0xA3,0x9D,0x30,0x92,0x9A,0x21,0xA1,0x1A,0x9A,0x89,
+0x0E,0x92,0x33,0xA9,0x2C,0x83,0xAF,0x00,0x06,0x09,0x38,0xFA,0x08,0x11,0x91,0x24,0xBF,0x98,0x18,0x16,0xAB,0x32,0xB1,0x0B,0x19,0xB4,0x0A,0xE0,0x5A,0x23,0xA2,0x0C,
+0x88,0x73,0xB0,0x29,0x99,0x10,0x57,0x9B,0x80,0x22,0xD2,0x1A,0x12,0x10,0x12,0xB9,0x99,0xAD,0x33,0x33,0x29,0x06,0xBB,0x9F,0x25,0xB9,0x19,0x12,0x0D,0x94,0x80,0x99,
+0x4A,0x88,0xA5,0x40,0xEB,0x0A,0x33,0x23,0xEC,0x00,0x18,0xAA,0xA8,0x46,0xA1,0x9B,0x38,0x12,0x98,0x14,0xB9,0xAB,0xB9,0x78,0x91,0x98,0x11,0x84,0xEB,0x8D,0x23,0x01,
+0x82,0x8E,0x01,0xA1,0x0D,0x81,0x80,0x62,0xBC,0x12,0xB1,0x3A,0x84,0x9A,0xAB,0x32,0x23,0xFA,0x6A,0x92,0x10,0x8C,0x88,0x32,0xAB,0xA3,0x09,0x60,0xEB,0x30,0x84,0x9D,
+0x08,0x10,0x09,0xC1,0x08,0x00,0x2B,0x90,0x1C,0x87,0x08,0xB9,0x1D,0x92,0x68,0x90,0x88,0xA9,0x2B,0x77,0xA0,0x80,0x98,0x99,0x2B,0x27,0x82,0x0A,0xCB,0x8A,0x24,0x98,
+0xBD,0x14,0x1A,0x99,0x93,0x11,0x98,0x9C,0xB0,0x82,0x21,0x78,0xC0,0x2A,0x17,0x11,0xAA,0x9C,0x09,0x16,0x12,0xD0,0x5A,0x91,0x10,0xA2,0x21,0x88,0x0A,0x24,0x24,0x6A,
+0xD0,0x09,0x90,0x88,0x81,0x28,0xB9,0x42,0x28,0x27,0x89,0xB9,0x51,0x8D,0x08,0x52,0xB8,0x12,0xAA,0x4A,0x00,0x08,0x07,0x28,0xB9,0x8B,0xCB,0x22,0x52,0x8B,0x90,0xDA,
+0xDB,0x41,0x80,0xAC,0x30,0x83,0x9A,0xAD,0x28,0x01,0x95,0xBD,0x52,0x0A,0x03,0xC9,0x18,0x20,0xD2,0x8A,0xAC,0x32,0x0A,0x73,0xC1,0x08,0xAA,0x31,0x42,0x20,0x83,0xFF,
+0x30,0x08,0x00,0xA0,0x10,0x19,0x10,0xBA,0x47,0xB9,0x10,0xA8,0x09,0x61,0xC9,0x12,0x13,0x0A,0x21,0x11,0x99,0x70,0x12,0x12,0xF8,0x28,0x02,0x59,0xD0,0x8D,0xA0,0x00,
+0x73,0x13,0xBA,0x08,0x20,0xD0,0xAC,0x38,0x95,0x19,0x80,0x1B,0x84,0xA9,0x73,0x10,0x90,0xBA,0x81,0xF9,0x6A,0x90,0x8A,0xA8,0xA8,0xBB,0x3D,0xA5,0x49,0x91,0x9C,0x0A,
+0x21,0x86,0x09,0xD9,0x48,0x01,0x00,0xDA,0x08,0x00,0x08,0x91,0x2B,0xC8,0x0A,0x9A,0x22,0xB6,0x1D,0x81,0x52,0x03,0x11,0xDA,0x3B,0x35,0xB1,0xA0,0x29,0x10,0x1A,0xD2,
+0x3C,0x93,0xF0,0x9E,0x20,0x08,0xC2,0x5A,0x14,0xBB,0x81,0x05,0x09,0x40,0x22,0xA8,0x90,0x19,0x56,0x90,0xB1,0xBC,0x29,0x09,0x16,0x99,0x90,0x71,0xA2,0x08,0x1B,0xA3,
+0xCF,0x40,0x81,0x81,0x98,0x81,0x8A,0x40,0x01,0x9B,0x85,0x30,0xCD,0x32,0xD0,0x09,0x8A,0x08,0xB9,0x51,0xEB,0x01,0x38,0xC8,0x48,0x21,0xB0,0xCD,0x52,0xB1,0x52,0xBA,
+0x11,0x99,0x39,0x22,0xE8,0x02,0xBD,0x00,0xAC,0x20,0x82,0x8B,0x23,0xE0,0x1B,0x32,0x91,0x69,0x04,0x8C,0xC0,0x0A,0x12,0x29,0xF8,0x8D,0x13,0xCB,0x28,0x12,0xF9,0x2C,
+0x13,0xA9,0x0B,0x41,0xD2,0x19,0x13,0xA9,0x89,0x34,0xBC,0x30,0x89,0xFB,0x20,0xB0,0x19,0x98,0x19,0x0D,0x17,0x92,0x09,0x01,0xA8,0x1A,0x82,0x23,0x0F,0x81,0x29,0x04,
+0x38,0x13,0x93,0xBC,0x72,0x87,0x9A,0x98,0x19,0x41,0xA3,0x39,0xFA,0x88,0x31,0x10,0xF2,0x09,0x10,0x33,0x8A,0x74,0xE1,0x18,0x9A,0x35,0xC8,0x0A,0x14,0xA8,0x18,0x8E,
+0x12,0xA9,0x22,0x28,0xBA,0x55,0xB8,0x38,0x33,0xA0,0x50,0x94,0x0A,0x82,0x9A,0x72,0x22,0xD0,0x9B,0x04,0x0B,0x23,0xB9,0xB9,0x70,0x07,0xD8,0x19,0x12,0x18,0x98,0x29,
+0xBA,0x11,0x05,0xAC,0x38,0x82,0x9A,0x38,0x22,0xFB,0x8A,0x31,0x62,0x91,0x80,0x19,0xB9,0x9A,0x7A,0x95,0x91,0x11,0xB9,0x79,0xE9,0x80,0x20,0x84,0xAB,0x42,0x88,0xB9,
+0x10,0x30,0xB0,0xAB,0x94,0xDF,0x11,0x00,0xA9,0x0C,0x81,0x84,0x88,0x5C,0x23,0xE9,0xB9,0x58,0x92,0xA8,0x39,0x93,0xAC,0x99,0x89,0x0A,0x82,0xAC,0xD9,0x3C,0x07,0x1D,
+0x02,0x10,0x02,0x90,0x0E,0xB2,0x0A,0x91,0x19,0xA2,0xCE,0x29,0xC0,0x8D,0x90,0x89,0x11,0x12,0x22,0xFB,0x3A,0x07,0x18,0xC8,0x20,0xD9,0x28,0x02,0xBC,0x2A,0x01,0x12,
+0xAD,0x25,0xC9,0x18,0x52,0x83,0x9B,0x03,0x10,0x1A,0x43,0xB1,0x9E,0x98,0x53,0xCA,0x01,0x99,0xE9,0x1A,0x81,0x9E,0x42,0x90,0x21,0x43,0xA1,0xAD,0x72,0xB0,0xA9,0x31,
+0x81,0x9B,0x8D,0x13,0xB0,0x99,0x2D,0xB1,0xB9,0x98,0x43,0x19,0x29,0x07,0xC9,0x28,0xA0,0x88,0x6B,0xA1,0xAA,0x05,0x0E,0x85,0x89,0x90,0x40,0x22,0xA1,0x0B,0xD3,0x30,
+0xA2,0x9F,0x98,0x16,0x9B,0x32,0x9B,0xA2,0x1C,0x03,0xB3,0x0C,0x9F,0x25,0x80,0xA8,0x08,0x68,0x22,0x81,0x24,0xEB,0x08,0x31,0xBC,0x28,0x81,0x04,0xAF,0x02,0xA1,0x0C,
+0x24,0x82,0x48,0x81,0x18,0xA1,0x90,0xB9,0x09,0x7C,0x22,0xA0,0x89,0x8A,0xA8,0x44,0x14,0x8D,0x04,0x99,0x9A,0x10,0x13,0xD9,0x89,0x60,0x9B,0xA5,0x1C,0xC0,0xCB,0x80,
+0x00,0x1A,0x03,0x31,0x27,0x98,0x20,0x62,0xA8,0x81,0xAA,0xFB,0x29,0x90,0x89,0x28,0x27,0x98,0x3B,0x13,0x02,0xC9,0x59,0x87,0x8C,0x33,0x88,0x12,0x16,0xA8,0xAB,0x2A,
+0x92,0x81,0x48,0x14,0x18,0x8B,0xA0,0xEE,0x30,0x33,0x08,0x61,0x25,0x93,0xAB,0xBB,0xBC,0x09,0x58,0x83,0xE2,0x8B,0x10,0x21,0x0B,0x00,0xF0,0x0C,0x63,0xB1,0x09,0x11,
+0xA9,0x2A,0x27,0x88,0xB8,0x61,0x91,0xAC,0x41,0x01,0xCA,0x11,0xB8,0x9F,0x00,0xAB,0xB9,0xD9,0x1A,0x99,0x0B,0xE0,0x0A,0x8A,0x99,0x08,0x88,0x45,0x25,0x48,0x14,0x11,
+0x41,0x88,0x98,0x91,0x8D,0x90,0x91,0x01,0x2F,0x05,0x0A,0x81,0x43,0xA8,0x2B,0x16,0xC8,0x8D,0x53,0x81,0x8A,0x13,0x9A,0xAA,0x8C,0x81,0xA8,0xAC,0xAA,0x36,0x01,0xDB,
+0x9F,0x01,0x08,0xB0,0x4B,0x34,0x81,0xAC,0x98,0xC8,0x9A,0x34,0x31,0xB8,0x68,0x84,0xAA,0x81,0xCB,0x9B,0xDA,0x58,0x84,0xB9,0x2B,0xD2,0x0A,0x23,0xC0,0x6B,0x14,0x98,
+0xC9,0x42,0x01,0x99,0x18,0xB1,0x9D,0x53,0xD0,0x9B,0x91,0x0A,0x98,0x11,0xD8,0xAC,0x23,0xDB,0x49,0x93,0x28,0xA8,0x72,0x01,0x99,0x22,0x23,0xA0,0x61,0x00,0xA8,0x82,
+0x4A,0xCB,0x56,0x91,0x08,0x10,0x20,0xB8,0x46,0xB9,0x21,0x63,0x80,0xC8,0x1B,0xA2,0x9E,0x12,0x91,0x9F,0x28,0xA1,0x0A,0x22,0x81,0xA8,0x10,0xBD,0xA8,0xCA,0x5B,0x04,
+0x99,0x93,0x31,0x73,0x91,0xAB,0x73,0x22,0x13,0xC9,0x39,0xB0,0x0C,0x14,0x93,0xBD,0x0A,0x18,0xB1,0x8B,0x7A,0xA5,0x0C,0x14,0x22,0xA8,0x38,0x11,0x14,0x80,0x73,0x83,
+0x19,0x24,0x80,0x18,0xCC,0xBB,0x70,0x87,0x99,0x10,0xA0,0x9C,0x43,0x90,0xB9,0x1B,0x17,0xA8,0xAA,0x33,0x30,0xB9,0x00,0x85,0x8F,0xA0,0x08,0xA9,0x03,0x3B,0x83,0xAF,
+0xA0,0x70,0x00,0x08,0x11,0x81,0x88,0x92,0x18,0x1B,0x58,0x02,0xE1,0x58,0x05,0x0C,0x84,0x80,0xBB,0x49,0x10,0x91,0xCA,0x20,0x10,0x9E,0x09,0x80,0x84,0x1A,0x28,0xAA,
+0xFA,0x91,0xAD,0x8C,0x01,0xA9,0x18,0x47,0xA0,0xAC,0xA9,0x11,0x9B,0x21,0xA4,0x38,0x1A,0x99,0xF4,0x8D,0x98,0x08,0xBB,0x20,0xA4,0x8F,0x80,0x00,0x10,0x80,0xAA,0xEC,
+0x98,0x88,0x8B,0xBB,0xE1,0x9C,0x09,0xB2,0x9E,0x10,0x99,0x09,0x21,0x98,0xAD,0x17,0x11,0xDB,0x20,0x11,0xB8,0x9F,0x04,0x8B,0x08,0x11,0x10,0x53,0x35,0x28,0x91,0x00,
+0x23,0x34,0x8D,0x40,0x23,0x80,0x80,0x17,0x90,0x79,0x11,0xBC,0x09,0x44,0x89,0x12,0x18,0x36,0x20,0x83,0x0A,0x89,0x02,0xC9,0x69,0x85,0x9A,0xA9,0x39,0xD9,0xA0,0x7A,
+0x92,0x18,0x11,0x82,0x0A,0x86,0x3B,0x85,0xAA,0x19,0x32,0xBD,0xA8,0xC0,0x80,0x4C,0xBC,0x38,0xA2,0x9B,0x06,0x2A,0x26,0x00,0x38,0xEA,0x08,0x09,0x94,0x9B,0xA8,0x28,
+0xA2,0xBF,0x42,0xD8,0x08,0x01,0x90,0x38,0x17,0x48,0xA0,0x18,0x03,0xB2,0x1D,0x24,0xD0,0x08,0x3A,0x02,0x0A,0xB3,0x09,0x2C,0x90,0x09,0xF3,0x6D,0x13,0x88,0xBB,0xA9,
+0x8E,0x15,0x90,0x09,0x60,0xB8,0x9D,0x02,0xA8,0x19,0x9A,0x13,0x9C,0x15,0x8D,0x00,0x01,0x91,0x38,0x84,0x1A,0x20,0x81,0xFB,0x29,0x73,0xC1,0xAC,0x48,0x81,0x19,0x01,
+0x19,0xD9,0x8A,0x98,0x35,0xDF,0x18,0x91,0x20,0xAA,0xA9,0x80,0x9A,0x9D,0x13,0x8D,0x63,0x10,0x12,0xB9,0x89,0x22,0x94,0x8F,0x02,0x89,0x22,0xCB,0x72,0x80,0x19,0x94,
+0x9E,0x10,0x11,0x80,0x00,0x89,0x33,0x85,0x9B,0x73,0x95,0x0A,0x98,0x88,0x9A,0x92,0x30,0xA9,0x99,0x10,0xFF,0x2D,0x23,0x82,0xA9,0x39,0xC2,0x50,0xA3,0x2A,0xD9,0x38,
+0xC1,0xAC,0x20,0xA8,0xAB,0x9A,0xB9,0x49,0xCD,0x42,0x03,0x80,0x50,0x14,0x88,0x04,0x1A,0xA1,0x8A,0x97,0x30,0x22,0x3A,0x17,0xAA,0xA9,0x9B,0xAD,0x51,0xD0,0x68,0x81,
+0x00,0x80,0x21,0x80,0xBB,0x09,0xD9,0x88,0x9B,0x80,0xCE,0x63,0xB0,0xAB,0xA9,0x38,0xA1,0x8F,0x43,0xA2,0x9B,0x11,0x38,0x91,0xAD,0x47,0xDA,0x19,0x01,0x9A,0x2A,0x03,
+0x8A,0x1A,0xA5,0xAE,0x21,0xAC,0x8A,0xC9,0x9B,0x33,0xB8,0x3B,0xC0,0xA9,0xDF,0x30,0x23,0x86,0x1A,0x15,0x10,0x08,0x33,0x9A,0x92,0x0E,0x17,0xA9,0x10,0x09,0xB0,0x8B,
+0x57,0xBA,0x28,0x19,0xC2,0x2C,0x26,0x00,0x80,0x81,0x52,0x91,0x1B,0x05,0x98,0x33,0xC0,0x30,0x08,0xB1,0x6B,0xB3,0x0F,0x86,0x0B,0x02,0x10,0x88,0x33,0x98,0x49,0x81,
+0x25,0xB9,0x30,0xA0,0x42,0x89,0x22,0xFA,0x1B,0xAB,0x21,0xEB,0x19,0xB0,0x8D,0x01,0xE0,0x0A,0x39,0x03,0xA0,0x4A,0xDA,0x02,0x89,0x8A,0x32,0x04,0xFF,0x00,0x09,0x08,
+0xA0,0x1A,0x88,0xD9,0x0B,0xCC,0x13,0x9B,0xFA,0x8A,0x33,0x00,0xCC,0x31,0xB8,0x52,0xA0,0x09,0xBB,0x62,0x31,0xA5,0x28,0x90,0x8F,0x02,0xAC,0x02,0xAE,0x21,0x90,0xBF,
+0x41,0x02,0xA9,0x32,0xB8,0x42,0x12,0xB9,0x9D,0x81,0x41,0xB0,0x98,0x11,0x8D,0x03,0xBD,0x21,0x90,0x21,0x8B,0xDC,0x34,0x91,0xAD,0x1B,0x63,0x84,0xBD,0x11,0x01,0x2B,
+0xC0,0x60,0xB8,0x0A,0xA1,0x58,0x91,0x90,0x0B,0x11,0x9A,0x35,0xB1,0xBF,0x22,0x02,0xBB,0xCF,0x42,0xA1,0x8B,0x11,0xD8,0x09,0x34,0xCA,0x88,0x08,0x90,0xB0,0x8B,0x73,
+0xFA,0x2A,0xA3,0xAC,0x88,0x38,0x85,0x9A,0x00,0x23,0xFA,0x10,0x18,0xCB,0x41,0x91,0x54,0x90,0x08,0x81,0x99,0xBE,0x43,0x01,0x29,0x17,0x99,0xA8,0x50,0x01,0x80,0x42,
+0x12,0x8A,0xA1,0x11,0x9E,0x41,0x04,0x0A,0x82,0x20,0x74,0x01,0x31,0xEA,0x58,0x90,0x28,0x00,0x03,0x9D,0x00,0xA0,0x78,0xB1,0x2A,0xBA,0x18,0x90,0x50,0xD1,0x9A,0xAA,
+0x49,0x07,0x9B,0x09,0x81,0x21,0x62,0x08,0xB1,0x20,0xA9,0x18,0xB0,0x20,0x22,0xF8,0x8F,0xB9,0x19,0x22,0xB8,0xBB,0xBE,0x74,0x10,0x91,0x1B,0x83,0x9B,0x92,0x52,0x92,
+0x8C,0x22,0xB0,0x2C,0xCA,0xB0,0x4B,0x86,0x0B,0xA9,0x31,0xC3,0x1F,0x81,0xCB,0x34,0xAC,0x20,0x22,0x02,0x3D,0x94,0x9C,0x32,0x11,0xA0,0x0D,0x04,0x8D,0xC1,0x2A,0xA3,
+0x1F,0x91,0x90,0xDB,0x40,0xA1,0x28,0xA9,0xAE,0x32,0xC8,0x29,0x23,0x90,0x9D,0x18,0xB8,0x49,0x16,0x11,0xC9,0x30,0x32,0x88,0x12,0xFD,0x09,0x02,0xA8,0x9F,0x20,0x90,
+0x59,0xA0,0x10,0xC0,0x7A,0x93,0x09,0x12,0xCC,0x40,0x84,0xBB,0x51,0x00,0x99,0x09,0x31,0xB0,0x9E,0x53,0x01,0xBB,0x39,0x91,0x0A,0x26,0x31,0xA1,0x1A,0x57,0xAA,0x30,
+0x81,0x18,0x24,0xDA,0x20,0xA9,0x22,0x89,0xB4,0x1B,0x20,0x00,0x32,0x83,0xBC,0xDE,0x43,0xCC,0x40,0x92,0xBC,0x10,0x80,0x00,0x88,0xE0,0x5A,0xB8,0x39,0xC2,0x9E,0x11,
+0x12,0xAA,0x8A,0xA0,0x6A,0xB1,0xCB,0x41,0xC9,0x18,0x91,0x08,0x9C,0x82,0x1A,0xBC,0x25,0xC9,0x09,0x02,0xCB,0x60,0xA8,0x42,0xC8,0x2A,0x05,0xCC,0x10,0x18,0x02,0x18,
+0x04,0xAB,0x81,0xFB,0x1B,0x83,0x08,0x28,0x35,0x92,0x9D,0x23,0x51,0xF1,0x4B,0x03,0xAA,0xCB,0x41,0xB8,0x39,0x03,0x51,0x81,0x3A,0xA6,0x1B,0x12,0x40,0xA8,0x81,0xE9,
+0x18,0x00,0x8F,0x80,0x09,0xB2,0x0C,0x21,0xA8,0x54,0x11,0xAE,0x13,0x99,0x30,0xD3,0xAF,0x01,0x88,0xA0,0x9C,0x02,0x02,0xBC,0x3A,0xF2,0x0E,0x43,0x80,0xCB,0x18,0x00,
+0x20,0xBA,0x49,0xC1,0x0C,0x53,0xA0,0x8B,0x42,0xC0,0x0A,0x10,0x93,0x89,0x0B,0x98,0x59,0x27,0x8A,0x22,0x8A,0x39,0xD3,0x0B,0x46,0x80,0x19,0x23,0x08,0x32,0xC8,0x09,
+0x81,0x48,0x17,0x02,0x09,0x35,0x88,0x10,0x41,0x05,0x90,0x20,0x44,0x19,0x20,0x15,0x88,0x34,0x82,0x2B,0x26,0xA8,0x18,0x03,0x36,0x88,0x22,0x8C,0xA0,0x8D,0x05,0x1B,
+0x01,0x80,0xCC,0x01,0x8B,0x04,0x9E,0x21,0xD8,0x88,0x99,0x06,0xAA,0x40,0x99,0x80,0x9A,0x85,0xBB,0xBF,0x29,0xC0,0x41,0x80,0x20,0xBC,0x00,0x09,0x80,0x9B,0xF0,0xCB,
+0x09,0x8A,0xAB,0xAB,0xC3,0xAF,0x99,0x8E,0x81,0x88,0x90,0x29,0xC1,0xA9,0x9B,0x19,0xFC,0x10,0xB0,0x1C,0xB9,0x31,0xA0,0xCB,0xBF,0x98,0x9C,0x89,0x01,0xA9,0x43,0xF9,
+0x38,0xA1,0x08,0xA8,0x0D,0x44,0xB1,0xB0,0x49,0xA0,0x9B,0x43,0x92,0x81,0x38,0x9F,0x27,0x10,0x01,0x33,0x81,0xBA,0xA3,0x49,0x64,0x1B,0x07,0x1A,0x01,0x01,0x01,0x11,
+0x25,0xA8,0x1A,0x99,0x27,0x03,0x29,0x01,0x41,0x27,0x89,0x33,0x00,0x05,0x5A,0x92,0x1D,0x03,0x73,0xA0,0x51,0xA0,0x38,0x11,0xA1,0x28,0x93,0x9D,0x88,0x30,0x25,0xAA,
+0x81,0x41,0xD0,0x8F,0x02,0x18,0x83,0x1B,0x37,0xD8,0x9A,0x52,0x98,0xAA,0x08,0xB8,0xAC,0x40,0x83,0xD9,0xAB,0x42,0x90,0xB9,0x0B,0x84,0xCB,0xDB,0x4A,0xB1,0xBC,0x9A,
+0x00,0x99,0x7B,0xA2,0xBC,0x9C,0x01,0xBD,0x80,0x90,0x8F,0x03,0x11,0x88,0x30,0x85,0x3A,0x92,0xCD,0x99,0x88,0x51,0xA0,0x10,0x03,0xBA,0x6A,0x15,0x02,0x98,0x0D,0x81,
+0x29,0x37,0xB8,0x23,0x21,0x50,0xA2,0x30,0xBA,0x53,0xBE,0x34,0x89,0x82,0x78,0x90,0x29,0x23,0xC9,0x4A,0x06,0x88,0x19,0x12,0x42,0x08,0x60,0x85,0xA8,0x69,0x15,0x8B,
+0x21,0xCA,0x20,0x98,0x99,0x08,0xCB,0x20,0xA8,0x18,0x2A,0x27,0xCA,0x29,0x99,0x44,0xB8,0x50,0xD8,0x3A,0xA4,0x08,0xA9,0xB9,0xAE,0x41,0xB1,0x9D,0xA8,0x09,0x81,0xAA,
+0x28,0xFA,0x1C,0x02,0x08,0xBA,0x18,0x73,0x03,0xEC,0x38,0x02,0xA9,0x80,0xB9,0x0D,0xB0,0x0B,0x07,0xAD,0x01,0x00,0xEA,0x29,0x84,0xAB,0x00,0x88,0x08,0x31,0xC0,0xAB,
+0x32,0xA8,0x74,0xA1,0xAB,0x00,0xCA,0x0C,0x03,0x0A,0x35,0xC8,0x2B,0xC0,0x08,0x1A,0x22,0xD1,0x58,0x98,0x52,0xA1,0x71,0x90,0x4A,0xB4,0x4B,0x84,0x29,0xA1,0x0A,0x81,
+0x19,0xA1,0x8A,0x89,0xF8,0x0E,0x12,0x64,0x81,0x9A,0x34,0x10,0x09,0x93,0xB0,0xBF,0x44,0xC9,0x29,0x14,0xBB,0x18,0x25,0xAA,0x29,0x90,0x09,0xA2,0x9E,0x08,0x22,0x88,
+0x73,0xE1,0x09,0x23,0x23,0xF8,0x2C,0x04,0x89,0x81,0x8B,0x83,0x1B,0x01,0x73,0xC4,0x2B,0x04,0xAA,0x10,0x41,0xB1,0x8E,0x22,0xAB,0x02,0x11,0xCA,0xCE,0x21,0x18,0x21,
+0x90,0x31,0xF8,0x19,0x02,0xAB,0x35,0x08,0xAB,0x83,0x39,0xA0,0x9A,0xAB,0x62,0x33,0x12,0xA4,0x2C,0x34,0x84,0x49,0x86,0x8A,0x28,0x25,0xB0,0x61,0x12,0x88,0x62,0x11,
+0xAA,0x64,0x91,0x9B,0x42,0x81,0x29,0x90,0x33,0x81,0xBC,0x11,0xF1,0x8C,0x08,0x01,0x93,0xAA,0x7A,0xA4,0x9C,0x30,0xC8,0x9D,0x11,0x9B,0xC0,0x28,0xE8,0x29,0xD8,0x39,
+0xD1,0x1C,0xA1,0x09,0xA9,0x33,0xCE,0x58,0x92,0x9C,0x10,0x01,0x81,0x18,0x91,0x0C,0x92,0x9D,0x90,0x0B,0xC8,0x9F,0x01,0xB9,0xBB,0x9F,0x24,0xB9,0x39,0x93,0x21,0xCA,
+0x20,0xDA,0x2A,0x16,0xA9,0x2A,0x22,0xE8,0x2A,0x92,0xBC,0x42,0x88,0x91,0xBC,0x58,0x82,0x9A,0x70,0x92,0x9C,0x00,0x22,0x91,0x32,0xD9,0x3C,0x06,0x99,0x20,0x15,0xAB,
+0x2B,0x04,0x08,0x21,0x14,0x5A,0x93,0x0C,0x80,0xB1,0x0B,0x75,0x92,0x0C,0xA2,0x28,0x90,0x39,0xC1,0xBD,0x40,0x24,0xA8,0x02,0x1A,0x13,0xE0,0x9D,0x72,0x90,0x89,0x19,
+0x91,0x30,0x04,0x19,0x83,0xA0,0x8F,0x20,0x01,0x00,0x30,0x47,0x04,0x9B,0x40,0x82,0xFA,0x1A,0x08,0x01,0xD9,0x39,0x91,0xCB,0x31,0x81,0x88,0x73,0xF1,0x1A,0x01,0x20,
+0x12,0xA9,0x40,0x84,0xBB,0x69,0x83,0xBB,0x0A,0x9D,0x93,0x89,0x30,0xA1,0x9E,0x72,0xA1,0x9A,0xA8,0x8B,0x21,0x22,0xD0,0x58,0xC2,0xAF,0x33,0x80,0x9A,0x11,0xFB,0x19,
+0x10,0x91,0x39,0xD1,0x0F,0x01,0x32,0xA0,0x0A,0x11,0x0A,0xA3,0x1B,0x17,0x08,0xFA,0x8B,0x80,0x40,0x02,0x05,0xBE,0x42,0xB2,0x8C,0x22,0xC0,0x28,0x21,0xD9,0x19,0x03,
+0x88,0x04,0xB9,0x3D,0x16,0x91,0x98,0x51,0x12,0x24,0x88,0x50,0xA1,0xBA,0x78,0x92,0x88,0x98,0x29,0xC0,0x9D,0x42,0x88,0x81,0x18,0xFA,0x0C,0x93,0x8A,0x02,0xBB,0x91,
+0x73,0xB8,0x8B,0xA0,0x99,0xBD,0x1C,0x27,0x8A,0x80,0x80,0xA9,0x28,0x25,0xAA,0xB9,0x9D,0x70,0x91,0x52,0xA0,0x0A,0x12,0xAA,0x9A,0x30,0x95,0x1A,0xCB,0x8B,0xAC,0x37,
+0xBC,0xAB,0x72,0x04,0x9A,0xA8,0x0B,0x24,0x89,0x09,0x63,0x90,0x89,0xA8,0x29,0x14,0x43,0xA8,0x90,0xAD,0x32,0xDA,0x22,0xAE,0x09,0x11,0xB8,0xAB,0x51,0x03,0x32,0xCF,
+0x42,0x91,0x08,0x01,0x62,0xA0,0x68,0x81,0x9A,0x90,0x3A,0x07,0xA9,0x09,0x91,0xA8,0x38,0x88,0xC0,0x39,0xFA,0x29,0x80,0x91,0xBB,0xCB,0x80,0xED,0x89,0x88,0x9E,0x22,
+0xBA,0xA8,0x1C,0x17,0xAA,0x11,0x8B,0x81,0x89,0xA3,0x0D,0x24,0xBA,0x9E,0x1A,0x05,0x80,0x1A,0x33,0xD9,0x98,0x52,0x81,0x31,0xB1,0x9F,0x13,0xCA,0x0A,0x24,0xBB,0x50,
+0x42,0xD8,0x8D,0x12,0x42,0x82,0xBA,0x72,0x82,0x81,0xAA,0x65,0xA0,0x8A,0x33,0x01,0xCC,0x40,0x82,0x88,0xAA,0x8A,0x73,0x91,0xAA,0x28,0x34,0xBA,0x01,0x20,0x43,0xC9,
+0x62,0x32,0xC8,0x08,0x62,0x81,0x89,0x28,0x15,0x11,0xAC,0x54,0x91,0x18,0x12,0x12,0x9C,0xA8,0x0B,0x08,0xB9,0x23,0xFB,0x4A,0x93,0x8C,0xB0,0xBB,0x72,0x91,0x10,0xC9,
+0x46,0xA9,0x20,0xC8,0x28,0x08,0x02,0x91,0x9A,0xCB,0x8A,0x33,0xD8,0x3C,0xC4,0x79,0xC2,0x09,0x10,0x81,0x09,0x01,0xFA,0x09,0x90,0x89,0x8C,0x81,0xB9,0x08,0xAC,0xF9,
+0x9B,0x25,0x9A,0xDB,0x88,0x12,0xAB,0xEC,0x28,0x12,0xEB,0x28,0xA9,0x02,0xAD,0x29,0x95,0x0A,0xCA,0x28,0x84,0x9C,0xB8,0x72,0xC0,0x19,0xA0,0xB9,0x19,0x23,0x42,0xFA,
+0x1C,0x01,0x11,0x88,0x00,0x18,0x73,0xA1,0x0A,0x24,0xB9,0x11,0x41,0xC9,0x99,0xB8,0x10,0x8B,0xA3,0x9D,0x19,0x37,0x18,0x14,0x2A,0x00,0x34,0x22,0x32,0xB2,0xBB,0x47,
+0x0B,0x90,0xBD,0x02,0x2B,0xB4,0xBF,0x33,0x33,0xAA,0xAC,0x63,0x10,0x82,0x9B,0x52,0x34,0x72,0x90,0x30,0x91,0x41,0x90,0x41,0xCA,0x89,0x11,0x92,0xAE,0x88,0x08,0x88,
+0xC9,0x0B,0x90,0x5B,0x87,0x9C,0x99,0x28,0x02,0xD9,0x8D,0x32,0xC0,0x9A,0x09,0x82,0xD9,0x8A,0x00,0x60,0xCA,0x32,0xDA,0x8A,0xAA,0xBE,0x2B,0x27,0x98,0xCC,0x19,0x14,
+0x10,0x90,0x09,0x05,0x1B,0xD1,0x8B,0x43,0x90,0xB0,0xAE,0x31,0x93,0xA9,0x29,0x47,0x98,0x09,0x08,0x24,0x32,0x92,0x3B,0x16,0x81,0x10,0x31,0xE8,0x1A,0x81,0xAC,0x08,
+0x8B,0x05,0xDD,0x8A,0x21,0x12,0xA9,0x18,0x81,0xEA,0x39,0x85,0xBE,0x58,0x25,0x90,0x0A,0x34,0x03,0xA8,0x29,0x17,0xBB,0x09,0x13,0x98,0xBA,0x29,0x91,0x25,0x38,0xB0,
+0x9A,0x71,0x14,0xB9,0x9C,0x49,0x97,0xAD,0x01,0x11,0xB0,0x1A,0x13,0xCA,0x8B,0x08,0x15,0x11,0x42,0x93,0xBC,0xAC,0x52,0xCB,0x08,0x98,0x63,0xDA,0x18,0x12,0x00,0xD9,
+0x69,0x04,0x99,0x81,0x3A,0x15,0xBA,0x18,0xA8,0x10,0x98,0xCB,0x22,0x58,0xC9,0x0A,0x14,0x09,0x84,0x0A,0x14,0x08,0x02,0xB9,0x7A,0x84,0xA8,0xAA,0x72,0x03,0x10,0x00,
+0x02,0x19,0x82,0xF8,0x28,0x9B,0x23,0xF8,0x0E,0x12,0xDB,0x49,0x13,0xC8,0x48,0x13,0x93,0xBD,0x8A,0x35,0x80,0x09,0x32,0xA0,0x98,0x9D,0x8A,0x05,0x30,0x92,0xBF,0x2B,
+0x25,0xD8,0x8B,0x8B,0xD2,0x1C,0x90,0x9A,0x08,0x19,0xF2,0x8A,0x18,0x98,0x03,0x9B,0x02,0x78,0xB2,0xBF,0x10,0x9A,0x24,0xCD,0x08,0x11,0x34,0xB1,0xAB,0xA9,0x52,0xD9,
+0xAA,0x00,0x00,0x89,0x90,0x00,0xAA,0x00,0x21,0xD0,0x29,0x27,0xEE,0x0A,0x88,0x09,0x01,0x19,0x14,0x0A,0x24,0x91,0x48,0x15,0xE9,0x9B,0x71,0x01,0x88,0x8A,0x22,0xC8,
+0x08,0xB8,0x29,0xC9,0x41,0x89,0xB0,0x40,0x83,0xB8,0x8A,0x60,0xC2,0x0D,0x21,0x12,0x01,0x70,0x12,0x73,0x33,0x10,0x81,0x32,0x91,0x09,0x22,0x75,0x04,0x20,0x02,0x00,
+0x98,0x31,0x23,0x68,0x13,0x18,0xD2,0x18,0xCA,0xBA,0x8C,0x31,0xDE,0xAA,0x30,0x38,0x03,0x12,0x57,0x99,0x88,0xD0,0x1C,0x21,0x00,0x0A,0x01,0xCB,0xDB,0x89,0x10,0xC1,
+0x8D,0x90,0x8A,0x10,0xC8,0x81,0x9F,0x32,0xFC,0x09,0x81,0xAA,0xFA,0x29,0x80,0x00,0x18,0x89,0x63,0x42,0xD1,0x0A,0x12,0xA8,0x99,0x0A,0xD1,0xAC,0x20,0xA1,0xBB,0x3A,
+0x04,0xEE,0x9A,0x89,0x10,0xB9,0x9C,0xBF,0x10,0xB8,0x9A,0xC9,0x48,0x03,0x09,0x12,0x1A,0x85,0x28,0x11,0x31,0x34,0x22,0xD4,0xAF,0x52,0x12,0x01,0x63,0x13,0x99,0x19,
+0x82,0x52,0x24,0x99,0x88,0x20,0xA2,0x99,0xCD,0x28,0xB2,0xBB,0x89,0x50,0x36,0x98,0x52,0x12,0xB9,0x88,0x5A,0x15,0x83,0xCB,0x39,0x06,0x08,0x44,0x53,0x22,0x23,0x12,
+0x18,0x26,0x22,0x02,0x0A,0x12,0x98,0x43,0x02,0xFC,0x1B,0x01,0x30,0x05,0xDB,0x38,0x12,0x02,0xA8,0xCF,0x20,0x12,0x00,0xCD,0x30,0x81,0x10,0xC1,0x39,0x83,0x1A,0xF0,
+0xAF,0x9A,0x08,0x82,0xA8,0xCB,0x1B,0x16,0xDA,0xAB,0xCA,0x41,0x80,0x08,0xAA,0x71,0x98,0x8B,0x81,0x9A,0x81,0x20,0xF9,0x9E,0x10,0x12,0x08,0x52,0x91,0xAA,0xBA,0x8C,
+0x54,0xC0,0x0A,0xA8,0x1A,0xC8,0xC9,0x9C,0x62,0x90,0x09,0x98,0x18,0xEA,0x1A,0x91,0xB9,0x88,0x9A,0x38,0x82,0xFE,0x0B,0x34,0xA8,0x2A,0x23,0x43,0xB8,0x40,0x84,0x8A,
+0x45,0x00,0xB0,0x8B,0x02,0x40,0x04,0xAA,0xDC,0x00,0xA9,0x30,0xB8,0x3A,0x13,0xA0,0xBD,0x21,0xF8,0x8D,0x11,0x31,0xA1,0x09,0x2D,0x37,0xC8,0x9A,0x10,0xA0,0x9A,0x19,
+0x12,0x60,0xA2,0x59,0x86,0x9C,0x22,0x02,0xCB,0x98,0x20,0x54,0x90,0x08,0x14,0xCA,0x1A,0x09,0x12,0xC9,0x71,0x82,0x89,0x30,0x42,0xE1,0x1B,0x53,0x92,0x98,0x63,0x00,
+0x9A,0x65,0xA1,0x29,0x81,0x88,0x9A,0x61,0x82,0x48,0xA1,0x8C,0x91,0x79,0x92,0x9B,0x23,0x90,0xB9,0x9E,0x02,0xC9,0x43,0xA0,0x53,0xDB,0x20,0x90,0x32,0xAD,0x30,0x04,
+0xBB,0x28,0x23,0x80,0x72,0x26,0xA8,0x8C,0x12,0x99,0x18,0x33,0x80,0x8C,0xB5,0x2B,0x44,0x21,0x80,0xBD,0x30,0xBA,0x88,0xAD,0x00,0xBA,0xC8,0x8E,0xD9,0x0A,0x02,0x9A,
+0x31,0xAB,0xFA,0xBF,0x30,0x13,0x01,0xBB,0x39,0x07,0xB9,0xBA,0x1A,0x02,0xFB,0x9B,0x21,0xA1,0x5A,0x03,0xAC,0x90,0xAE,0x53,0x99,0x21,0x81,0xAB,0x39,0x15,0x8B,0x01,
+0x21,0xCB,0x22,0x0B,0xE1,0xAD,0x31,0xA2,0x18,0xAF,0x20,0xA3,0x5A,0xA4,0x8E,0x81,0x88,0xFB,0x0D,0x02,0x98,0x28,0x00,0x82,0x8D,0x81,0xCB,0xA8,0xAF,0x21,0x91,0x98,
+0x19,0x01,0x40,0x37,0x91,0xBB,0x9C,0x51,0x33,0x23,0x34,0x42,0x31,0xA3,0x70,0x03,0x30,0x36,0x90,0xAD,0x41,0x03,0xA9,0x39,0x13,0x88,0xAB,0xAA,0x11,0xDE,0x8A,0x42,
+0xA3,0xDF,0x9B,0x21,0x32,0x12,0x21,0x25,0x08,0xA8,0xAA,0xAE,0x40,0x82,0x91,0x39,0x36,0x30,0x12,0x11,0xD8,0x2B,0x06,0x48,0x92,0x08,0xA0,0x8A,0xBA,0x70,0xD1,0x8C,
+0x01,0x00,0xA8,0x29,0xA8,0x0A,0x09,0x71,0xE3,0x8A,0x8A,0x08,0xD0,0x9E,0xBA,0x08,0xB0,0x2A,0x32,0x94,0xBC,0xF9,0xBC,0x08,0xAA,0x9B,0xA9,0x9D,0xA9,0xDA,0x58,0x84,
+0xAB,0x20,0x03,0xFB,0x19,0x02,0x41,0x12,0x45,0x81,0xBC,0x38,0x92,0x20,0x82,0x71,0x16,0xA0,0x80,0x41,0x91,0x08,0x28,0x04,0x19,0x02,0xB8,0xEB,0x8A,0xDA,0x1A,0x84,
+0xBE,0x9A,0x00,0x88,0x48,0x84,0xDA,0x8A,0x31,0x05,0xBD,0x2A,0x44,0x81,0x80,0x20,0x55,0x11,0x91,0x89,0x31,0x99,0x20,0x2A,0x77,0xA3,0x9B,0xAA,0x1A,0x82,0x09,0xBA,
+0x80,0xEC,0x48,0xB0,0xAD,0x38,0x26,0xB0,0x09,0x88,0xA8,0x18,0x82,0xEF,0x08,0x08,0x80,0x20,0x81,0xAC,0xC8,0xAC,0x80,0x09,0x02,0x00,0x89,0x35,0xD8,0x49,0x94,0xAC,
+0x0A,0x81,0x08,0x40,0x25,0x32,0xA0,0x9B,0x93,0xFF,0x18,0x81,0x99,0x11,0x00,0xDA,0xBB,0x28,0x37,0xA9,0x28,0x11,0x90,0x58,0x26,0x82,0xA9,0x28,0x80,0xBA,0x80,0xEB,
+0x9B,0x71,0x95,0x0A,0x92,0xCB,0x2A,0x46,0x90,0xBA,0x99,0xC9,0x29,0x22,0x08,0x62,0x22,0xF0,0x1A,0x22,0x20,0x43,0x80,0x52,0x91,0xAC,0x98,0x19,0x44,0x92,0x0B,0x36,
+0xB8,0x99,0x90,0xBC,0x18,0x26,0x80,0x8D,0x98,0xBA,0x1B,0x27,0xDA,0x08,0x89,0xB9,0x1B,0xC2,0x8E,0x22,0xA8,0x11,0x63,0xC0,0xAC,0x00,0x21,0x80,0x12,0x9B,0x24,0x11,
+0x04,0x29,0x24,0x31,0xA1,0x79,0x95,0x3A,0x33,0x06,0xA0,0xAC,0x38,0x90,0x88,0xB9,0x1D,0x25,0x15,0x89,0x22,0xC8,0xBB,0x70,0x82,0x30,0x24,0x23,0x90,0x22,0x15,0x0A,
+0x34,0x22,0x81,0x1A,0x77,0x10,0x18,0x11,0xB9,0x1A,0xA0,0x11,0x19,0x80,0x19,0xF0,0xAE,0x72,0xA2,0x0A,0x24,0xB8,0x18,0x01,0xCB,0x21,0x21,0x24,0xC8,0xBD,0x31,0xFA,
+0x9C,0x80,0x89,0x89,0xA9,0x00,0xA8,0xEE,0x18,0x82,0xAC,0xCB,0x10,0x01,0xBD,0xAB,0xA9,0xEC,0x8A,0xA0,0x8A,0x00,0x90,0xBB,0xBD,0x49,0x37,0x90,0xDB,0x08,0x31,0x81,
+0xC9,0x8B,0x33,0xEA,0x48,0xA3,0x3B,0x57,0x80,0x88,0x89,0x10,0x08,0x92,0xAC,0x88,0x00,0xA4,0x0E,0x83,0x9C,0xA9,0x8A,0x11,0x40,0x24,0x45,0x42,0x01,0xA0,0xBC,0x28,
+0x82,0x98,0x0E,0x34,0xA9,0x99,0x72,0x03,0x89,0x02,0x29,0x26,0xBA,0xBA,0x09,0x91,0x0B,0xA3,0x1A,0x55,0x43,0x82,0x29,0x63,0x11,0x01,0xD9,0xBC,0x9B,0x0B,0x35,0x8C,
+0x25,0xA9,0xBC,0x28,0x01,0x00,0x8A,0x52,0xA0,0xDB,0xAB,0x51,0x33,0xD9,0xDB,0x29,0xB3,0x0D,0x91,0x8E,0x01,0x08,0x01,0x8D,0xA1,0x68,0xA1,0xBB,0xCA,0x39,0x13,0x18,
+0x91,0x8B,0x92,0x1B,0x57,0x30,0x13,0x63,0x32,0x12,0xC1,0x29,0xD1,0x1C,0x14,0x20,0xB0,0x78,0x83,0xAB,0x98,0x20,0x04,0xBE,0xFB,0x29,0x35,0x11,0x98,0xBD,0x28,0x01,
+0xCA,0x9A,0x19,0xFB,0x8B,0x43,0x12,0xB0,0x9A,0x88,0x61,0xA1,0x89,0x91,0x68,0x13,0xD8,0x1B,0x54,0x13,0xA1,0x30,0x13,0xBA,0x32,0x23,0xDB,0x41,0x81,0x18,0x99,0x66,
+0x01,0x90,0x08,0xA0,0x0A,0x41,0x24,0x42,0x91,0xDC,0x19,0x11,0x81,0xCB,0x28,0x03,0xAA,0x08,0x01,0xA0,0x9D,0xD1,0x8C,0x98,0x30,0xD1,0xAE,0x8A,0xA9,0x19,0x85,0x9E,
+0x9A,0x10,0xA9,0x3B,0x95,0x01,0x73,0x22,0x44,0x92,0x88,0xAB,0x02,0x00,0xCA,0xEA,0xCB,0x89,0x08,0xF8,0x2A,0xD1,0xCA,0xBF,0x19,0x01,0x01,0xA8,0x9C,0x58,0x14,0xC8,
+0xAB,0x89,0xDC,0x08,0x53,0x81,0x08,0xAB,0x90,0x38,0x07,0x9B,0xC8,0x40,0x13,0xB8,0x8B,0x73,0x02,0x98,0x99,0x9B,0x23,0x10,0x23,0xBC,0x23,0x20,0x88,0x99,0x77,0x11,
+0xA2,0x8B,0xFB,0x09,0x01,0x01,0x08,0x88,0x09,0x1A,0x67,0x91,0x08,0x00,0xA8,0x1A,0x44,0x90,0x29,0x04,0x08,0x82,0x58,0x05,0x90,0x19,0x72,0x03,0x08,0xA9,0x9C,0x80,
+0x68,0x91,0x1A,0x85,0x09,0xD9,0x32,0x33,0x9A,0x95,0x9C,0x72,0x82,0x9B,0x38,0xA3,0xAE,0x2A,0x85,0x08,0xB8,0x2A,0xB3,0x78,0xA1,0x28,0xC0,0x08,0x40,0x14,0xB0,0xAE,
+0x89,0xD9,0x72,0x04,0xA8,0x8A,0x00,0x81,0x99,0x08,0x00,0x89,0x14,0x28,0x91,0x89,0x90,0x72,0x01,0x48,0x01,0x89,0x17,0x30,0x83,0x21,0x89,0x09,0x12,0xF9,0xBF,0x89,
+0x82,0x8A,0x32,0x33,0x33,0x77,0xB0,0x9A,0x28,0x93,0x3C,0x87,0x9B,0x00,0x20,0xA0,0x41,0x98,0xE9,0x28,0x00,0x21,0x25,0xF8,0x9C,0x10,0x01,0x89,0x44,0xA2,0x19,0xBA,
+0x39,0x11,0xC5,0x8A,0x39,0x27,0x99,0x1B,0x12,0x81,0x47,0x88,0x09,0x42,0xD0,0xCB,0xAA,0x88,0x9A,0x0A,0x91,0xCD,0x18,0xA1,0x89,0xDF,0x89,0x88,0xBA,0x9C,0xDA,0x2A,
+0x12,0xB0,0x8C,0x98,0x09,0x23,0xA8,0x78,0x94,0x9B,0x08,0x11,0xE8,0xBA,0x38,0x73,0xB1,0x2A,0x34,0xB0,0x0C,0x00,0x17,0x8A,0x11,0x81,0x80,0x30,0xF8,0x0F,0x21,0x81,
+0x08,0x02,0xBC,0x5A,0x05,0xCB,0x08,0x22,0xA0,0x3A,0x93,0x29,0x07,0x18,0xA9,0x36,0x03,0x9B,0xA2,0x0A,0x76,0xA1,0xBE,0x1A,0x02,0x09,0x32,0x15,0x88,0x15,0xA9,0xA8,
+0x38,0x91,0xAB,0xA1,0x00,0xC0,0xBF,0x72,0x23,0xB0,0x09,0x22,0x91,0x29,0xFA,0xAF,0x10,0x91,0x8C,0x98,0x10,0x81,0x99,0xD8,0x9B,0x43,0xB1,0x9F,0x98,0x8A,0x81,0x08,
+0xCE,0x80,0x8A,0x81,0x90,0x0A,0x63,0xC0,0x1B,0x25,0x82,0xBD,0x89,0x51,0x92,0x9B,0x02,0x92,0x9E,0x9C,0x22,0xB9,0x99,0x17,0x0A,0x48,0x24,0xA1,0x39,0x15,0x98,0x60,
+0xE8,0x9B,0x18,0x02,0x32,0x90,0x99,0x34,0xBA,0x99,0x47,0xB8,0x8C,0x44,0x22,0x91,0x99,0xB1,0x7A,0x04,0xBA,0x00,0x54,0x81,0x89,0x33,0x08,0x12,0x02,0x18,0x08,0x42,
+0xFA,0x8C,0x12,0xA8,0x9D,0x58,0x27,0x91,0xAB,0x0A,0x43,0x01,0xC8,0x8A,0x44,0x34,0x99,0x18,0x31,0x34,0xB0,0x41,0x64,0x32,0x02,0xAB,0x80,0x81,0x91,0x99,0x0B,0x64,
+0x02,0xEB,0x99,0xA8,0x8C,0x22,0xBB,0x74,0x22,0x93,0xAB,0x41,0x80,0x18,0xC2,0x08,0xDB,0x19,0xBA,0xBD,0x28,0x45,0x90,0x8A,0x46,0x90,0x9A,0x08,0xA9,0x1A,0xF8,0xCD,
+0x09,0x12,0x20,0xB9,0x9C,0x18,0xA3,0xEC,0x1A,0x98,0x18,0xA8,0x89,0xBC,0x23,0xFA,0x8C,0x80,0x09,0x35,0x01,0xC1,0x9D,0x21,0x01,0xCA,0x0B,0x98,0x35,0x23,0xE9,0x8B,
+0xB8,0x9B,0xCC,0x98,0x21,0xC1,0xBF,0x89,0xB9,0x8D,0xA0,0x89,0x98,0x09,0x34,0x51,0x85,0xEB,0x89,0x32,0x04,0x89,0x20,0xDA,0x1A,0x83,0x40,0xD8,0x1A,0x43,0x02,0xBA,
+0xAB,0xEA,0x0A,0x03,0xCF,0x29,0x12,0x22,0x13,0x98,0xAA,0x45,0xB8,0xAD,0x99,0x10,0x89,0xC9,0x78,0x02,0x88,0xA9,0x10,0x10,0x81,0x08,0xF1,0x8F,0x01,0xB9,0x28,0x62,
+0x01,0x01,0x10,0x2A,0x27,0xB9,0x40,0xA0,0x19,0x43,0x01,0x23,0x18,0xC8,0x4A,0x04,0x90,0x58,0x92,0xCB,0x3A,0x57,0x02,0x08,0x88,0x52,0x34,0x81,0xB9,0x0B,0x89,0x92,
+0x0A,0x48,0x06,0x18,0xC8,0x18,0x9A,0x37,0x90,0xDC,0x8B,0x08,0x22,0x63,0x92,0xBB,0x2A,0x77,0x80,0x09,0x00,0x81,0x38,0x02,0x52,0x82,0x8B,0x05,0x18,0x10,0x32,0x05,
+0xAB,0x91,0xCE,0x20,0x31,0x04,0x08,0x00,0x98,0x00,0xAD,0x88,0x2B,0x87,0x2B,0xB2,0x50,0xB0,0xAD,0x00,0x89,0x33,0x98,0x9C,0xEC,0x09,0x01,0xFB,0x8A,0x20,0x33,0x34,
+0xA0,0x31,0x93,0xAD,0x9B,0x17,0x30,0xC0,0x9C,0xC0,0x8D,0x10,0x01,0xA0,0x9B,0xBA,0xAE,0x00,0xBD,0x29,0x03,0x98,0x19,0xE0,0x9B,0x8D,0xD9,0xAA,0x0A,0x99,0xAA,0xD9,
+0xAC,0x99,0xE9,0x8A,0x8A,0x73,0xB2,0x8E,0x98,0x18,0x80,0x21,0xDA,0x48,0x35,0x23,0x91,0x8C,0x12,0x24,0x88,0x44,0x80,0xA8,0x0B,0x03,0x0A,0x92,0x7A,0x57,0x98,0x88,
+0x90,0xB9,0x8A,0xA9,0x90,0x8A,0xCD,0xA9,0x48,0x16,0x01,0xB0,0xAB,0x41,0x02,0x09,0xBA,0x37,0xA0,0x51,0x81,0x98,0xA9,0x51,0xB9,0xDB,0x09,0x19,0xA4,0xAE,0x20,0x34,
+0x91,0xBD,0x8A,0x13,0x19,0x81,0x18,0xFA,0x9D,0x09,0x53,0x02,0x0A,0x81,0x9E,0xA1,0x19,0x22,0xB9,0xDD,0x09,0x01,0x53,0x82,0xAA,0x9D,0x62,0x81,0x30,0x34,0x91,0x9D,
+0x98,0x2A,0x14,0x34,0xDA,0x58,0x82,0x20,0x9A,0x13,0xDC,0x29,0x98,0x28,0x85,0xBB,0x38,0x14,0x31,0x15,0xAA,0xEC,0x09,0x98,0x0B,0x05,0x42,0xB0,0x8A,0x41,0xB0,0x40,
+0x16,0x80,0x99,0xB0,0xAE,0x19,0x10,0x12,0xB8,0x8B,0xD9,0x18,0xB9,0x31,0x30,0x67,0xB8,0x99,0xEC,0x19,0x33,0x84,0xAC,0x31,0xD0,0x0A,0x90,0x49,0x83,0x08,0xAA,0x38,
+0x01,0x65,0x12,0x91,0xA9,0x28,0x73,0x37,0x10,0x90,0x39,0x82,0x29,0xA9,0x30,0x15,0x92,0xBD,0x51,0x26,0x00,0xAA,0xBC,0x29,0x26,0x11,0x10,0x34,0xB9,0xAD,0x09,0x11,
+0x80,0x33,0x21,0x92,0x51,0xB1,0xAF,0x88,0xCB,0xBB,0xBC,0x41,0x90,0x19,0x83,0xCA,0x9A,0x80,0xDC,0x58,0x04,0xAB,0x99,0x09,0xF8,0x8C,0x02,0x11,0x82,0x51,0x82,0xA9,
+0x2A,0x94,0x8F,0x98,0x2A,0x37,0xD9,0x2A,0xA0,0x9B,0x00,0x32,0x22,0x92,0xFF,0x9A,0x18,0x12,0x81,0xFB,0x8D,0x32,0x01,0x88,0x9B,0x91,0x9A,0xCB,0x29,0x15,0x33,0x33,
+0xD9,0x8B,0x11,0xA8,0x78,0xA2,0x9B,0x8A,0x47,0xB8,0x09,0x12,0xA1,0xBD,0x88,0xD9,0x28,0x24,0xEA,0x9A,0xAA,0x99,0x20,0x21,0xB8,0x18,0xD0,0xBF,0xAB,0x88,0x90,0x18,
+0x46,0xA1,0x9D,0x88,0x10,0xCA,0x98,0x41,0xA3,0xAF,0x30,0x31,0x02,0xA1,0xDF,0x19,0x21,0x22,0x90,0x80,0xCB,0x99,0xEB,0x09,0x21,0x27,0xBA,0x09,0x43,0x80,0x21,0x03,
+0x10,0x75,0x33,0xA0,0x3B,0x47,0x01,0x08,0x89,0x88,0x20,0x14,0xAC,0x00,0x88,0x99,0xBD,0x0A,0x56,0x23,0x90,0x09,0x11,0x22,0xA1,0x29,0x47,0x90,0x10,0x20,0x10,0xA9,
+0x64,0x91,0x21,0x18,0x01,0x40,0x27,0x00,0x11,0x90,0x19,0x03,0xBB,0x72,0x90,0x8A,0x89,0x98,0x1B,0xFB,0x2D,0x81,0x18,0xCA,0x29,0x02,0x41,0xD1,0x9C,0x08,0x10,0x92,
+0x78,0x86,0xC9,0x9B,0x8B,0x34,0x82,0x20,0xA0,0xCC,0x8C,0x00,0x11,0x23,0x74,0x81,0x00,0xEA,0x9A,0xA9,0xBC,0xCA,0x9E,0xBA,0x28,0x24,0xC9,0x8A,0x10,0x98,0x8A,0x12,
+0x80,0x52,0x35,0x12,0x22,0x21,0x24,0x01,0xAB,0xFD,0x9C,0x9A,0xA9,0x89,0xBA,0x32,0xBC,0xC8,0xAE,0x08,0xFA,0xBB,0x9C,0x42,0xA1,0x9D,0x98,0xBA,0xAA,0x09,0x56,0x03,
+0x90,0xBA,0x09,0x20,0x45,0x93,0x28,0xB9,0x0B,0x14,0x0B,0x94,0x3B,0x97,0x0C,0x91,0xAA,0x2A,0x34,0x15,0x90,0x38,0x25,0x32,0x26,0x89,0x10,0xA8,0x71,0x12,0x25,0xA9,
+0x99,0xC9,0x78,0x13,0x08,0x88,0x30,0xA1,0x19,0x23,0x31,0xF9,0x19,0x45,0x81,0x98,0xB9,0xA8,0x9A,0xFC,0x8D,0x21,0x02,0x88,0x88,0x00,0x99,0x11,0x02,0xAC,0x72,0x04,
+0x31,0x27,0x88,0x02,0x8A,0x54,0x03,0xC9,0x0A,0x02,0xA8,0x73,0x92,0x80,0x9B,0x23,0x32,0x81,0x98,0x8D,0x45,0xA0,0xCC,0xAB,0xAB,0xAA,0xDB,0x88,0xCC,0xBB,0xBC,0x98,
+0x99,0x8A,0x31,0x83,0xBF,0xEA,0x8B,0x12,0x82,0x3A,0x77,0x92,0x18,0xA0,0x1A,0x24,0x20,0x47,0xA0,0x98,0x08,0x12,0x18,0x26,0xDB,0x89,0x08,0x31,0x98,0x80,0xBB,0x41,
+0x82,0x9D,0x52,0x81,0xA9,0xCD,0xAA,0xBB,0x8A,0x01,0x31,0x85,0x9C,0xF9,0x8D,0x90,0x99,0xBB,0xBA,0x18,0x51,0x03,0xDA,0x0A,0x31,0x24,0x44,0xA1,0x9A,0x8C,0x62,0xC2,
+0x1B,0x91,0x19,0x02,0x18,0xDA,0x61,0x12,0xAA,0x23,0x10,0x14,0xCC,0x89,0x12,0xB9,0x9D,0x30,0x94,0xAB,0xA8,0x9F,0x00,0xCA,0xCB,0xBA,0x41,0x91,0x18,0x00,0xEC,0x50,
+0x24,0xA1,0x1A,0x82,0x20,0x25,0x08,0x21,0x32,0x13,0x27,0x00,0x52,0x35,0x42,0x01,0x20,0x10,0x36,0x01,0x11,0x81,0x10,0xB0,0x2D,0x17,0x30,0x04,0x48,0x83,0xAC,0x10,
+0x31,0x90,0xAD,0x09,0xFA,0x9A,0x2A,0x36,0xA2,0x09,0x21,0xE9,0xCB,0x18,0x88,0x9A,0x30,0x92,0x63,0xB1,0xAF,0x00,0x18,0x53,0x15,0x99,0x99,0xCA,0x09,0xA8,0x10,0xBC,
+0x0B,0x14,0x9A,0x72,0x14,0xB9,0x9C,0x01,0xC8,0x8A,0xDC,0xAA,0x98,0xBB,0x89,0x52,0x01,0xC9,0xAB,0xAC,0x32,0xFA,0x1A,0x14,0xC9,0xAB,0x19,0x83,0xCD,0x08,0x00,0x11,
+0x98,0x23,0xEC,0x41,0xB1,0xAA,0xAC,0x99,0x2B,0x16,0x99,0xA9,0x32,0xDC,0xCB,0x39,0x94,0x0A,0x88,0x08,0x20,0x17,0xB9,0x0A,0x92,0xAF,0x28,0x81,0x31,0x80,0x10,0x02,
+0x8A,0x34,0xBF,0x10,0x09,0x00,0x71,0x77,0x23,0x08,0x10,0x81,0x80,0x88,0x25,0xCC,0xCB,0x89,0x12,0x90,0x30,0x27,0x12,0x88,0x10,0xBB,0x29,0x26,0x82,0x8A,0x62,0x13,
+0x41,0x25,0x12,0x11,0x24,0x91,0x0B,0x56,0x11,0x01,0x89,0xA9,0x29,0x27,0x00,0x18,0x80,0x12,0x90,0x08,0x43,0xA8,0xCF,0x89,0x22,0xB0,0x8A,0xBB,0x32,0x45,0x98,0x81,
+0x7B,0x17,0x88,0xCA,0x0B,0x00,0x43,0x93,0xCB,0x9B,0x98,0xDE,0xBC,0x28,0xA1,0x08,0x80,0xB9,0x3A,0x27,0x90,0xCB,0x99,0x08,0x11,0x28,0x15,0xC8,0xBC,0x0A,0xB0,0xA0,
+0xEF,0xA9,0xBC,0x28,0x24,0x02,0x11,0x73,0x91,0x98,0xA0,0x8A,0xDA,0xAC,0x99,0xCA,0xAE,0x11,0x88,0x12,0x20,0xA3,0x9C,0x90,0x8C,0x02,0x89,0x08,0xC9,0xBD,0x10,0x52,
+0xB0,0xCB,0x42,0x30,0x16,0x20,0x15,0xAA,0xEA,0x99,0x18,0x35,0x01,0x01,0x18,0x22,0x98,0xFB,0x9C,0x8A,0x22,0x36,0x00,0xA9,0x9A,0xA0,0x8D,0x80,0x09,0xA1,0x4C,0xD3,
+0x8B,0x33,0x33,0xAB,0x05,0xBC,0x8A,0x01,0xFF,0x8B,0x80,0x80,0x90,0x22,0x21,0x13,0xBA,0x71,0x05,0x10,0x24,0x10,0x12,0x74,0x03,0x88,0x12,0x01,0xB1,0xCC,0xAC,0xDA,
+0x1A,0x13,0x90,0x48,0x03,0xBA,0x9C,0x11,0x8A,0x45,0xC0,0x9C,0x13,0x9A,0x89,0xF9,0x8C,0x21,0x41,0x82,0x41,0x13,0x81,0xAA,0x58,0x32,0x37,0x38,0x84,0xA9,0x0A,0x21,
+0x37,0x98,0x32,0xC9,0xFB,0x0A,0x01,0x22,0x43,0x01,0xB8,0x3A,0x98,0xD8,0x8C,0x00,0x92,0x7A,0x27,0x10,0x91,0x89,0x92,0xAD,0x99,0x11,0x43,0x91,0xAB,0xDC,0x60,0x12,
+0xC8,0x1B,0x81,0x89,0x11,0xA9,0xAE,0x63,0x02,0xBA,0x99,0x88,0x49,0x83,0xBC,0x49,0x26,0x00,0x81,0x50,0x24,0x21,0x12,0x31,0x24,0xB1,0xAF,0x20,0xB8,0xBB,0x8A,0x01,
+0xDD,0x89,0xCD,0xAA,0x88,0x63,0x01,0xB8,0x9C,0x10,0xA9,0xFA,0xAD,0xA9,0x20,0x91,0xAB,0x0B,0x46,0x91,0xAA,0xA9,0x61,0x33,0x14,0x08,0x38,0x34,0x42,0x90,0xA9,0xAD,
+0x80,0xAC,0x88,0x18,0x33,0x43,0x13,0xED,0x8B,0x22,0x99,0xFA,0x1B,0x35,0x80,0x31,0x30,0x84,0x20,0x23,0xF8,0xBC,0x09,0x12,0x21,0xB0,0xAB,0x9A,0x34,0x01,0x92,0x60,
+0x91,0xCB,0x19,0x56,0x12,0x14,0xBA,0xAA,0x39,0x06,0x0B,0x85,0xCD,0x09,0x42,0xA1,0xAB,0x72,0x14,0x00,0xA8,0x08,0x80,0xCB,0x9A,0x43,0x02,0xC9,0xCA,0xBC,0xBA,0xAC,
+0xCA,0x9B,0x48,0x04,0xBA,0xBA,0x58,0x91,0xAA,0xEA,0xAB,0x09,0xA2,0xCF,0x08,0x31,0x13,0xBA,0xBE,0x8B,0x01,0x80,0xDB,0x8A,0x34,0x80,0xB9,0x9A,0xBA,0x39,0x26,0x23,
+0xAA,0x60,0x04,0x2A,0x05,0x18,0x92,0x9D,0x45,0xA8,0x28,0xC1,0xAD,0x1B,0x27,0x88,0x32,0x01,0x13,0xAA,0x9C,0x51,0x14,0x9A,0x09,0x29,0x36,0x22,0xE8,0x9A,0x81,0xAA,
+0x61,0x14,0x88,0x19,0x36,0x80,0x10,0x42,0x25,0xA8,0x29,0x02,0x31,0x81,0x51,0x82,0x8A,0x11,0xB2,0xAE,0xBB,0x20,0x9A,0x37,0x08,0xA8,0x1B,0x42,0x91,0x88,0xCE,0x30,
+0x37,0x99,0x29,0x30,0x47,0x08,0x80,0xBA,0x09,0x20,0xA0,0xD9,0x0C,0x12,0x19,0x95,0xBF,0x88,0x8A,0x22,0x21,0x80,0xFF,0x8A,0x18,0x12,0x90,0x18,0x11,0x35,0x91,0x09,
+0x02,0x56,0x83,0x98,0x0A,0x55,0x02,0x89,0x18,0xA0,0x8C,0x45,0xB8,0x0A,0x31,0x81,0xB8,0xEF,0x89,0x00,0x90,0xBB,0x9A,0x50,0x12,0x01,0xBA,0xB0,0xDF,0x20,0x10,0x02,
+0x08,0x53,0x02,0x81,0xAD,0x10,0x32,0x23,0xB8,0xBF,0x88,0xA0,0x19,0x82,0xBA,0x29,0xFB,0xAF,0x91,0xC9,0x1A,0x02,0x9B,0xEC,0x8A,0xB9,0x8B,0xD0,0xAC,0x00,0xBA,0x8D,
+0x33,0x02,0xCB,0x10,0xCC,0x8B,0xAB,0x73,0x13,0xB9,0xEC,0x1A,0x14,0xDA,0x0B,0x23,0x88,0xC9,0x8B,0x90,0x40,0xA2,0x9D,0x39,0x83,0xBE,0x60,0x03,0xB8,0xAC,0x31,0x62,
+0x03,0xB9,0x8B,0x33,0x81,0xFA,0x3B,0x14,0x08,0x90,0x1C,0x17,0x09,0x01,0xBB,0xA9,0x0B,0x22,0x80,0x0A,0x80,0x14,0x18,0x16,0x20,0x84,0x4A,0x15,0x73,0x12,0x90,0x19,
+0x13,0x88,0x73,0x17,0x11,0x22,0x01,0x08,0x42,0x02,0x21,0x99,0x73,0x34,0x32,0x22,0x24,0x32,0x63,0x92,0x08,0x91,0x30,0xC8,0x41,0xA0,0x38,0xD0,0x9C,0x99,0x61,0x92,
+0x99,0x89,0x65,0xA2,0x29,0x02,0x80,0xDA,0x8B,0xB8,0xDC,0xAB,0x8A,0x18,0xC0,0xAE,0x80,0xAA,0x23,0xAA,0xCC,0x21,0xB8,0x78,0x07,0xBA,0x08,0x30,0x14,0x89,0x02,0xCC,
+0xAA,0xAE,0x08,0xCB,0x00,0xE9,0x9B,0x99,0x41,0xA1,0x0A,0xE0,0xAD,0x88,0x20,0x01,0x99,0x20,0x42,0x12,0x30,0x24,0xB9,0xAC,0x18,0x43,0xC0,0x09,0xDC,0x8A,0x18,0x42,
+0xB1,0xBE,0x9A,0x10,0xA0,0x29,0xEC,0xA9,0xBB,0x8C,0xB2,0xBE,0xAC,0x19,0x36,0x91,0x9C,0x00,0xC0,0x8A,0x31,0xEA,0x1A,0xA0,0x30,0x11,0xE8,0x1B,0x48,0x37,0x00,0x11,
+0x81,0x30,0xA1,0x09,0xF9,0xAA,0xDB,0xAB,0xAA,0x40,0x02,0x53,0x80,0x42,0x14,0x91,0xAC,0x09,0xA8,0x41,0x22,0x67,0x01,0x10,0x44,0x11,0x32,0x32,0x24,0xA9,0x28,0x13,
+0x25,0xC0,0xBA,0xBD,0xCA,0x89,0xA8,0xBC,0x98,0xAC,0x89,0x43,0x82,0x51,0x45,0x12,0x42,0x13,0x08,0x72,0x82,0x28,0x88,0x54,0x80,0xA8,0x9B,0x52,0x24,0xB8,0xBC,0x9B,
+0x74,0x01,0x18,0x81,0x08,0x98,0x88,0x80,0xEC,0xAA,0x18,0x32,0x84,0xBF,0x30,0xC0,0x9B,0x9A,0x30,0x23,0x21,0xEB,0x38,0xA0,0x8B,0x46,0x24,0x10,0x12,0xB9,0x3A,0x26,
+0x88,0xDB,0xBC,0x9B,0x41,0x90,0x30,0x31,0x57,0xA1,0x08,0x20,0x15,0xEA,0x09,0x89,0xAA,0xAD,0x19,0x88,0x98,0x9A,0x31,0x73,0x83,0x30,0x23,0x08,0x02,0xAA,0x44,0xF9,
+0xCD,0x9A,0x9A,0xA9,0xDB,0xCB,0xAB,0x88,0xCA,0x9B,0x10,0x12,0xCC,0xAB,0xDB,0x28,0xA0,0x89,0xE9,0x2A,0x24,0x22,0xFC,0x1A,0x21,0x12,0xA9,0x20,0x98,0x44,0x21,0x36,
+0x82,0x88,0x01,0xA9,0x8C,0x34,0x91,0x9A,0xDF,0x0A,0xC9,0x29,0xB0,0x89,0xCB,0x30,0x23,0x31,0x26,0x21,0x92,0x48,0x37,0x98,0x09,0x83,0x28,0x02,0xEC,0x19,0x14,0xFB,
+0x9B,0x20,0x11,0x12,0x72,0x17,0x01,0x11,0x31,0x23,0x99,0x44,0x11,0x98,0x09,0x00,0x30,0x25,0x89,0x23,0x3B,0x17,0x48,0x06,0x18,0x12,0x10,0x80,0x08,0xA8,0xCA,0xBE,
+0x29,0x05,0x99,0xA9,0x08,0xA9,0x51,0xB0,0xC9,0x9D,0xB9,0x09,0xA0,0xDF,0x19,0x84,0x9A,0x21,0x02,0xBA,0x2B,0x35,0x92,0x3B,0x77,0x03,0xA8,0x08,0x63,0x03,0xA9,0x98,
+0x31,0xA0,0x18,0xB8,0xBC,0x9D,0xC9,0xAF,0x20,0x90,0x9C,0xA8,0x9B,0x0A,0x13,0xEA,0x8A,0x10,0x32,0x85,0xAE,0x10,0x33,0x92,0xCC,0xAD,0x08,0x81,0xFB,0xBB,0x8B,0x11,
+0x81,0x10,0x33,0xE0,0x8A,0x88,0x90,0x39,0x77,0x85,0x89,0x11,0x22,0x01,0x80,0x88,0xA0,0x1D,0x15,0xA8,0xA9,0x1A,0x14,0xA0,0x19,0xC1,0x9F,0xA9,0xAB,0xEB,0x8A,0x81,
+0x89,0x20,0xA0,0xAC,0x40,0x17,0x99,0x99,0x20,0xA1,0x9B,0x99,0x24,0x09,0xA1,0x38,0xFA,0x3B,0x82,0x91,0xCB,0x32,0xFF,0xDF,0x10,0x80,0x98,0x09,0x90,0x18,0x98,0x53,
+0xC0,0x0A,0x10,0x24,0x11,0x81,0xA8,0x1A,0xD1,0x9D,0xA8,0xDC,0x1C,0x33,0x22,0xB1,0x3A,0x46,0x23,0x18,0x04,0xDC,0x8A,0x88,0xA8,0x1B,0xA3,0x0D,0x83,0x48,0x93,0x0B,
+0xFB,0x9D,0x10,0xA1,0xAF,0x09,0x31,0x12,0x31,0x81,0x23,0x46,0x01,0x32,0x43,0x35,0x98,0x08,0x88,0x03,0xAF,0x90,0xCD,0x09,0x02,0xB8,0xDF,0x0A,0x01,0x00,0xA8,0xBC,
+0x0A,0x63,0x92,0xAC,0x29,0x35,0x11,0x42,0x81,0x31,0x14,0x91,0x99,0xBB,0x74,0x90,0x38,0x83,0x09,0xDA,0x19,0x21,0xF8,0xAB,0x00,0x08,0x90,0x76,0x83,0xAA,0x99,0x52,
+0x24,0x00,0x80,0x88,0x00,0x63,0x91,0xAA,0x09,0x72,0x05,0x98,0xBA,0x48,0x15,0x90,0x08,0x22,0x80,0xB9,0x8C,0x43,0x23,0xA8,0x51,0x02,0x28,0x83,0x89,0x10,0xE8,0x70,
+0x87,0x09,0x10,0x00,0x90,0x18,0xC0,0xBD,0x28,0x00,0x80,0xA9,0x38,0x34,0xB8,0xFF,0xAA,0x9A,0x00,0x89,0x22,0x63,0xA2,0x9C,0xDB,0x19,0x14,0x81,0xCC,0x0A,0x98,0xA9,
+0xBC,0x40,0x83,0x3A,0x27,0x98,0x8A,0x53,0x92,0x09,0x99,0x32,0xFA,0x18,0xA8,0xCA,0x9F,0x00,0xA8,0x8A,0x00,0xA1,0xAF,0xAA,0x21,0xA1,0xAB,0x0C,0x36,0x92,0xAC,0x00,
+0x9A,0x18,0x11,0xCF,0x10,0x10,0x84,0xC9,0xAE,0x19,0x43,0x22,0x12,0x98,0x99,0xA8,0x9B,0x41,0x37,0xB8,0xCB,0x9B,0x51,0x13,0xB9,0xAE,0x32,0xBA,0x8B,0x21,0xA8,0xA0,
+0x19,0xA9,0x5A,0xB4,0xCF,0x52,0xA0,0xAA,0x40,0x45,0x81,0x89,0xBC,0x28,0x53,0x22,0x12,0x99,0x30,0x84,0xCB,0xAB,0x50,0x12,0x34,0xE9,0xAD,0x99,0x19,0x02,0x00,0x00,
+0x41,0xB0,0xAB,0x78,0x17,0x80,0x00,0x89,0x01,0x58,0x15,0x11,0xE8,0x0C,0x14,0x00,0x01,0x00,0x80,0xAA,0x10,0x08,0xC8,0xBD,0x8A,0x98,0xE9,0x0B,0xC0,0xAF,0x00,0x82,
+0x90,0xAA,0x72,0x03,0xA9,0xAB,0x73,0x17,0x10,0x12,0x98,0xB9,0x8A,0x01,0x99,0x10,0x91,0xAA,0xDA,0x58,0x03,0x21,0x81,0xA8,0xCD,0x08,0x12,0x9A,0xD9,0x1B,0xB4,0xBF,
+0xA8,0x89,0x11,0x22,0xDA,0x72,0x25,0x01,0x18,0x11,0x02,0x12,0x31,0xA1,0xAC,0x09,0x22,0xD9,0x9C,0x40,0x15,0xA9,0xFB,0x9B,0x90,0x89,0x19,0x16,0x11,0xA8,0xAC,0x88,
+0x02,0x30,0x47,0xA1,0xBC,0xDA,0x3A,0x25,0x80,0xEC,0x0A,0x23,0x21,0x82,0x00,0x18,0x01,0x02,0x08,0x03,0xAD,0x45,0x80,0xCA,0x0C,0x91,0xBF,0x10,0x90,0x89,0xAA,0x51,
+0x80,0xB8,0xBF,0x30,0x82,0x19,0xE8,0xDB,0xAC,0x08,0x12,0x24,0xA0,0x09,0x01,0xBA,0x72,0x27,0x01,0x88,0x00,0x42,0x01,0x10,0x80,0x98,0x39,0x57,0xA8,0x89,0x11,0x42,
+0x34,0x92,0x1A,0x26,0x98,0x01,0x08,0xD9,0xAD,0x80,0xA9,0x09,0x89,0xE8,0x9E,0x98,0x98,0x08,0xA2,0xCC,0x0A,0xB8,0xBB,0xAB,0x71,0x22,0xB0,0xAB,0x10,0xEA,0x09,0xC9,
+0x40,0xC1,0x0B,0x33,0x53,0x13,0xC8,0xBC,0x39,0x26,0x01,0xA0,0xBB,0xA9,0xDC,0x8C,0x43,0x03,0x43,0x98,0xA8,0x0A,0xDB,0x1A,0xA0,0x0A,0x63,0xC8,0x99,0xCD,0xEB,0x8A,
+0x20,0x98,0x99,0xAB,0xAC,0x38,0x36,0x01,0x00,0xEA,0x29,0x21,0xB3,0xCF,0x18,0x02,0x80,0x08,0x20,0xA9,0x99,0x50,0x93,0x0A,0x04,0x18,0x22,0x12,0x91,0x61,0x34,0x10,
+0xE1,0x0A,0x01,0x41,0xC9,0x99,0x8A,0x25,0xA8,0x48,0x14,0xCD,0x50,0x46,0x13,0x98,0x19,0x01,0x98,0xDB,0x09,0x63,0x15,0x91,0x00,0xA8,0xDA,0xBC,0x09,0x63,0x91,0x2A,
+0x47,0x13,0x10,0x10,0x30,0x83,0x00,0x00,0x00,0x80,0xBB,0x01,0x67,0x34,0x82,0x19,0x31,0x82,0x01,0x42,0xC8,0x09,0x73,0x43,0x80,0xA0,0xEB,0x0A,0x28,0x45,0x91,0x00,
+0x28,0x22,0x53,0x53,0x22,0x11,0xCA,0x89,0x9A,0xA8,0xFA,0x9C,0x09,0xB9,0xAC,0xAB,0x98,0xBD,0x10,0xD8,0xAB,0x89,0x08,0xD9,0x8A,0xA2,0x99,0x9D,0xBA,0xFC,0xAB,0xA8,
+0x9B,0xCA,0xBB,0xAC,0x80,0xEE,0xAB,0x89,0x90,0x18,0x11,0xB8,0xEF,0x99,0x98,0x80,0x9A,0x01,0x80,0x98,0x08,0x89,0xFB,0xDD,0x0A,0x80,0xA9,0xBB,0x2A,0x67,0x23,0x88,
+0x80,0x99,0x20,0xF9,0xBB,0x8A,0x88,0xB9,0x40,0x25,0x30,0xB1,0xAF,0x08,0x88,0xC9,0x8B,0x80,0x00,0x81,0x72,0x07,0x80,0xA8,0x09,0x23,0xB0,0xBE,0x20,0x24,0x22,0x21,
+0x63,0x34,0x91,0xBD,0x28,0x11,0x43,0x11,0x10,0x81,0x90,0xA9,0xBC,0x10,0xC8,0x73,0x17,0x80,0x99,0x40,0x14,0x33,0x33,0x81,0x32,0x11,0x83,0x9B,0x56,0xA8,0x10,0x60,
+0x25,0x82,0xC9,0x1A,0x31,0x15,0xFB,0x19,0x12,0xBA,0xBA,0x9B,0x41,0x03,0xBB,0x28,0x02,0x0A,0xA3,0xBF,0x98,0xAD,0x10,0x88,0xB0,0x1D,0x77,0x43,0x12,0xA8,0xBC,0x20,
+0x82,0x19,0x44,0x82,0xA9,0x1A,0x45,0x91,0x89,0x88,0x91,0xCD,0x0A,0x91,0xDC,0x8A,0x80,0x00,0xBA,0xBA,0xCB,0xDB,0xD9,0xCF,0x89,0x98,0x89,0x88,0x00,0xBA,0x8A,0x81,
+0xEB,0xAB,0x1A,0x54,0x03,0x9A,0x82,0xCA,0x8A,0xCB,0x89,0xD8,0x2B,0x22,0x63,0xA1,0xBF,0x18,0x01,0x30,0x05,0x18,0x14,0x43,0x22,0x22,0x34,0x23,0x73,0x02,0x88,0xBB,
+0x9A,0xC8,0x68,0x93,0x89,0x90,0xDF,0x28,0x81,0x21,0x22,0x12,0xBA,0x42,0x52,0x04,0x9A,0xBA,0x1A,0x73,0x17,0x22,0x32,0x34,0x33,0x23,0x22,0x02,0x41,0x25,0x63,0x44,
+0x02,0x00,0x0A,0x43,0x12,0x81,0xA9,0x0B,0x24,0x11,0x33,0x98,0x8A,0xEA,0x88,0xC9,0xBF,0xCA,0x9A,0x08,0xEC,0xAB,0x80,0x8A,0x88,0x88,0xB9,0x3A,0x94,0xCD,0x89,0x90,
+0x8A,0x99,0x62,0xB8,0xAE,0x62,0x82,0x99,0xBA,0xCC,0x8A,0x10,0xCA,0xAE,0xBA,0xBC,0x0B,0x32,0xB0,0xDD,0x08,0x00,0xB8,0x8A,0x32,0x01,0xFB,0xAE,0x08,0xA8,0xDF,0x99,
+0x00,0x80,0x98,0xCB,0x9B,0x52,0x81,0x98,0xDB,0xAB,0x8A,0x08,0x08,0x99,0x9A,0x9C,0x46,0x01,0x08,0x10,0x41,0x37,0x01,0x10,0x23,0x81,0x30,0x37,0x23,0x40,0x32,0xD0,
+0x1A,0x03,0xCC,0xAE,0x8A,0x08,0xA0,0xAC,0x08,0x90,0xCD,0xAB,0x8B,0x33,0x90,0xCD,0x8B,0x88,0x21,0x90,0x30,0x55,0x42,0x03,0x08,0x52,0x34,0x80,0x72,0x02,0x21,0x00,
+0x18,0xA8,0x73,0x27,0x90,0x98,0x19,0xA8,0x8B,0x80,0xA0,0xAE,0x11,0xA0,0x09,0x54,0x13,0xBF,0x48,0x13,0xB9,0x9B,0x30,0x23,0xFA,0x8E,0x41,0x12,0xD9,0x0A,0x22,0x32,
+0x82,0x9C,0x10,0x57,0x90,0x99,0x09,0x01,0x10,0x12,0x9A,0x22,0x42,0x82,0x43,0x80,0x44,0x80,0x18,0x55,0x14,0x01,0x08,0x33,0x34,0x02,0xB9,0x5A,0x47,0xA8,0x8B,0x20,
+0x13,0x98,0xCA,0x19,0x44,0x82,0x8A,0x20,0x23,0x98,0xBF,0x50,0x81,0xBB,0x18,0x09,0x83,0x0C,0x37,0x98,0x89,0xBA,0xBD,0x09,0x64,0x81,0x18,0x01,0x9C,0x00,0x08,0xA2,
+0xBD,0xBA,0x9B,0x9B,0x77,0x82,0x98,0xAD,0x88,0x99,0xA9,0xAD,0x28,0x23,0x00,0xBA,0x03,0xAC,0xFB,0xEB,0xAC,0x8A,0x81,0xCB,0x18,0x53,0xB0,0x8A,0x31,0x13,0xFB,0x9A,
+0xFB,0x8A,0xB9,0x1A,0x13,0x19,0x99,0xDA,0xBE,0x11,0x88,0xB0,0x9F,0xA8,0xAB,0xDA,0x8D,0x80,0xA9,0x88,0x19,0x82,0x08,0x9C,0x23,0x42,0x35,0xFB,0x8E,0x22,0x32,0x82,
+0x0A,0x52,0x02,0xDA,0xBC,0x38,0x14,0x89,0xA9,0x1B,0x16,0x01,0x18,0x80,0xA0,0x1D,0x47,0x11,0x00,0xA9,0x3A,0x37,0x13,0x00,0x11,0x80,0x08,0x24,0xC8,0x8A,0xC8,0x9C,
+0x80,0x38,0x37,0x23,0x91,0xBD,0x89,0x20,0x03,0x88,0x89,0x24,0xDC,0x0A,0x24,0xB8,0x8B,0x91,0xAD,0xAE,0x72,0x82,0x88,0x19,0x11,0x11,0x65,0x02,0x89,0x18,0x90,0x0B,
+0x43,0x20,0x26,0x01,0xC8,0xAD,0x99,0x9A,0x43,0x81,0xCB,0x9B,0xEC,0x8A,0xA9,0x31,0xD0,0x9A,0x08,0x33,0x34,0xA1,0x21,0x22,0x30,0xF2,0x8C,0x12,0x38,0x05,0xAD,0xA9,
+0x3A,0x84,0x09,0x09,0x64,0x13,0xDC,0x8B,0x42,0x22,0x11,0x90,0x80,0x61,0x15,0x01,0x80,0x19,0x53,0x04,0xC9,0x0A,0x43,0x01,0xB9,0xDD,0xBB,0xAB,0x9B,0x99,0x20,0xFB,
+0x9F,0x00,0x10,0x23,0x32,0x03,0xAA,0x80,0xFB,0x0A,0x90,0x99,0x08,0xEA,0x0B,0x33,0x08,0x99,0x77,0x82,0x8A,0x88,0x10,0x82,0x1B,0x05,0x49,0x34,0x90,0xAC,0x53,0x12,
+0x12,0xE8,0xBF,0x9A,0x00,0x08,0x08,0x98,0x30,0x14,0x22,0xA8,0x72,0x92,0x99,0x89,0x45,0x32,0x13,0x52,0x43,0x83,0xBA,0x1A,0x41,0x26,0xB0,0x8B,0x13,0x25,0xEB,0x8B,
+0x24,0x52,0x22,0x11,0xE9,0x9C,0x18,0x82,0x20,0x14,0x18,0xA0,0x68,0x04,0x99,0xA9,0xA8,0xAC,0x00,0xBA,0x41,0x01,0xA0,0xFF,0xAB,0x9A,0x88,0x08,0x01,0xEA,0xAC,0x09,
+0x42,0x23,0x43,0x92,0xAB,0x21,0xC1,0xDB,0x0B,0x23,0x20,0x94,0x9F,0x13,0x89,0x90,0x0B,0x80,0x10,0x8A,0x13,0xA2,0xFF,0x0F,0x00,0x81,0x98,0x08,0x88,0x81,0xCC,0xDB,
+0xDD,0xAB,0x20,0x80,0x88,0xAC,0x89,0x53,0x23,0x01,0x91,0xA8,0xCD,0x1A,0x45,0x02,0xA8,0x0A,0x33,0x08,0x21,0xA2,0x8B,0x15,0xA9,0xBD,0x54,0x24,0x03,0xDA,0x9B,0x41,
+0x23,0xA0,0xEE,0x9B,0x10,0x88,0xA9,0xAC,0x08,0x20,0x34,0x90,0xAA,0x80,0xBC,0x00,0x98,0x89,0xCC,0xAC,0x72,0x04,0x89,0x11,0xA8,0x08,0x18,0x35,0x23,0x26,0x11,0x12,
+0xEA,0x08,0x73,0x13,0xA0,0x9B,0x10,0x82,0x98,0x2A,0x82,0x6A,0x24,0x22,0x91,0x28,0x34,0x42,0xF8,0x8D,0x81,0x09,0x80,0x80,0xBD,0x40,0xA2,0x9C,0x81,0xBB,0x00,0x23,
+0xC9,0x75,0x05,0x88,0x00,0x52,0x03,0x00,0x52,0x12,0x20,0x11,0x62,0x24,0x26,0x23,0x00,0x10,0x88,0x72,0x14,0x91,0x99,0x01,0x98,0x41,0x13,0x88,0xBA,0xAD,0x98,0x41,
+0xE0,0xAC,0xAC,0x20,0x02,0x22,0xB1,0xDF,0xAB,0x88,0x02,0xCB,0x32,0x10,0x82,0xAD,0xBA,0x99,0x40,0x47,0x24,0x91,0x00,0xA9,0x8A,0x45,0x22,0x81,0x98,0xA9,0xAB,0x12,
+0xDF,0x09,0x99,0x11,0xB9,0xCB,0xAB,0x8A,0xF9,0xAD,0xAA,0x18,0x82,0xBA,0xAB,0xCA,0xDB,0xBC,0x39,0x03,0xCC,0xBE,0x08,0xA8,0x31,0x23,0x91,0xBB,0xDA,0x8B,0x12,0xB0,
+0x4A,0x57,0x33,0x92,0xBB,0x31,0x57,0x12,0x89,0x08,0x62,0x81,0x51,0x92,0x89,0x21,0x21,0x90,0x2A,0x16,0x88,0xBA,0xBB,0xBF,0x09,0x23,0xFA,0xAB,0x89,0xBA,0xCC,0xCC,
+0x18,0x90,0x08,0x21,0x35,0xB0,0xBF,0x8A,0x90,0x9A,0x20,0x23,0x63,0x83,0xAE,0x00,0x08,0x00,0x32,0x03,0x10,0x02,0xFB,0x8B,0x44,0xB0,0x38,0x02,0xBA,0xB9,0xCC,0xCD,
+0x89,0xDC,0x0A,0x89,0x89,0x08,0x43,0xA2,0xDC,0x09,0x64,0x12,0x00,0x90,0x29,0xA1,0xBB,0x68,0x05,0x9B,0x00,0x00,0x88,0x44,0x32,0x33,0x90,0x30,0x81,0xBA,0x4A,0x67,
+0xA0,0x8B,0xB2,0x0D,0x23,0x53,0x91,0xAA,0xDC,0x49,0x35,0x30,0x04,0x89,0x31,0x22,0x00,0x81,0x58,0x23,0x44,0x91,0x9C,0x40,0x11,0xB8,0xCE,0x89,0xC9,0x89,0xB8,0xAB,
+0x88,0x33,0xA0,0x9B,0xFE,0x1B,0xC0,0xAC,0x38,0xB1,0x9F,0x21,0x80,0xAA,0x28,0xA3,0x8A,0xA0,0x9A,0x57,0xC0,0xBB,0x1C,0x25,0xAA,0xB9,0x59,0x15,0x98,0x99,0x0B,0x01,
+0xCC,0xBA,0xBB,0x90,0x19,0x34,0x12,0x64,0x12,0x30,0x33,0x46,0x81,0x9A,0x63,0x23,0x12,0x63,0x13,0x21,0x91,0xBE,0x08,0x98,0xAA,0xCC,0x1A,0x22,0x80,0x21,0x43,0xE2,
+0xCF,0x88,0x31,0x36,0x88,0x08,0x21,0x02,0x99,0x00,0x51,0x25,0x01,0x18,0x33,0x23,0x98,0x72,0x04,0x08,0x91,0x8A,0x81,0x42,0x03,0xA9,0x50,0x80,0x41,0x25,0x12,0xA9,
+0xAD,0x2A,0x26,0xFA,0x8D,0x80,0x00,0x98,0xC9,0x8A,0x33,0xA0,0xAC,0x38,0x26,0x00,0x01,0xAA,0xBB,0xCC,0x08,0x12,0x53,0x80,0x08,0x50,0x05,0xCC,0x89,0x88,0xB9,0xCD,
+0xCB,0xCC,0x89,0x10,0x00,0x99,0xBB,0x00,0x21,0x91,0xAC,0xEC,0xBB,0x49,0x46,0x01,0x10,0x01,0x99,0x99,0x98,0x9A,0xEC,0xBC,0xCB,0xA9,0xBD,0x8A,0x21,0x82,0xB9,0xBF,
+0x0A,0x20,0x25,0x10,0x01,0x11,0x11,0x24,0x03,0xDD,0x0B,0x88,0x11,0x12,0xB0,0xFF,0x38,0x14,0x81,0xC9,0x8A,0x12,0x08,0x24,0x22,0xC0,0xAE,0x89,0x18,0x91,0xCF,0x19,
+0x21,0x81,0xAA,0x19,0x21,0x46,0x81,0xAB,0x29,0x02,0xAA,0x61,0x14,0x00,0xA9,0x1A,0xD9,0x8B,0x13,0x72,0x82,0x9B,0x18,0x00,0x11,0x73,0x11,0x20,0x45,0x01,0xBA,0x8C,
+0xAA,0x18,0x08,0xC1,0x2A,0xD1,0x28,0x73,0x25,0xE9,0x9A,0x9B,0x52,0x03,0x88,0x11,0x32,0x90,0x9A,0x75,0x04,0x98,0x9A,0x38,0x32,0xA8,0xAE,0x50,0x13,0x88,0xEA,0x19,
+0x10,0x42,0x22,0x03,0xB8,0x0A,0x22,0x80,0x74,0x05,0x08,0x80,0x52,0x91,0x9B,0x49,0x46,0x22,0x81,0x98,0x21,0x21,0x37,0x01,0xAA,0xDB,0x9C,0x20,0x01,0xB9,0xAC,0x8A,
+0x81,0x11,0xEA,0x19,0x45,0x02,0x09,0x21,0x34,0xA9,0x89,0x00,0xA1,0xDF,0x28,0x32,0xA8,0x1A,0x53,0xB0,0xCF,0x08,0x01,0x98,0x88,0x39,0x37,0x21,0x91,0xAA,0x9B,0x52,
+0x91,0xBA,0x2B,0x77,0x01,0x80,0xA8,0x10,0xB9,0xAA,0xAF,0x41,0xA0,0xCC,0xBA,0x88,0x88,0xBA,0xCA,0xCE,0xBA,0x9A,0x10,0xC9,0xBA,0xDF,0x99,0x88,0x11,0xC9,0x89,0x21,
+0x37,0x81,0x99,0x9A,0x18,0x92,0xCC,0x9B,0x33,0x32,0x92,0x28,0xE1,0xAF,0x08,0xB9,0x8A,0x21,0x31,0x12,0x81,0x9C,0x31,0x22,0xFA,0xCF,0x10,0x22,0xB9,0x18,0xA9,0xFC,
+0xAF,0x18,0x11,0x08,0x00,0x18,0x32,0x23,0x98,0x73,0x04,0x08,0x21,0x23,0xA0,0x1A,0x35,0x32,0x35,0x90,0xA9,0x72,0x14,0x20,0x20,0x45,0x81,0x9A,0x11,0x00,0x33,0x08,
+0x55,0x44,0x24,0x11,0x11,0x99,0x40,0x25,0x80,0x09,0x63,0x92,0x8B,0x61,0x24,0x81,0x88,0x99,0xA0,0x8A,0x53,0x23,0xA9,0xBD,0x09,0xB9,0xCD,0x28,0x15,0xCA,0x0A,0x02,
+0x80,0x80,0xC9,0x9E,0x31,0x82,0xB9,0xAA,0x18,0xFC,0x0C,0x21,0x90,0x08,0xCB,0xBC,0x0A,0x00,0xCA,0x20,0xD0,0x2A,0x14,0xED,0xAB,0x18,0x12,0xEB,0x9C,0x99,0xCA,0xCB,
+0x99,0x98,0x08,0xA0,0xAB,0xB9,0x8A,0x99,0x74,0x06,0x9A,0xBB,0x60,0x82,0x9A,0x10,0x10,0x37,0xA9,0x89,0xDB,0x99,0x00,0xC8,0x8B,0x03,0xA9,0x88,0x59,0x57,0x90,0x21,
+0x81,0x18,0x08,0x34,0x19,0x45,0x80,0x88,0x73,0x03,0xAA,0x8A,0x40,0x25,0xA0,0xBE,0x09,0x42,0x24,0x30,0x03,0xB9,0x09,0x21,0x72,0x13,0x99,0xCA,0xCB,0xAB,0x08,0x08,
+0xB9,0xBB,0xCE,0x39,0x02,0x22,0xC9,0xAF,0x98,0xCD,0x9A,0x89,0xC9,0x9B,0x51,0x23,0x43,0x22,0xA9,0x9B,0x9A,0xFA,0x9A,0x31,0x37,0x22,0x12,0x11,0xA8,0xED,0x9A,0xA8,
+0x8A,0xA8,0xEB,0xBB,0x3A,0x15,0x00,0x81,0xB9,0xBB,0x89,0xBA,0x49,0x26,0x11,0x36,0x01,0x01,0xDD,0x99,0x29,0x15,0xCB,0xAB,0x30,0x04,0x31,0x83,0x58,0x67,0x12,0x11,
+0x88,0x21,0x08,0x63,0x12,0x01,0x61,0x33,0x22,0xB0,0x19,0x81,0x40,0x92,0xDD,0xBC,0x8A,0x33,0x14,0x00,0x99,0x19,0x53,0x98,0x41,0x82,0xAC,0xDC,0x9C,0x89,0x21,0x23,
+0x81,0xCB,0x20,0xA0,0x9B,0x18,0xFB,0x1E,0x91,0xBD,0xAB,0xCB,0x9B,0x44,0x02,0x32,0x24,0x83,0xCF,0x99,0x89,0x08,0x01,0x18,0x21,0x54,0x23,0x98,0x18,0x02,0xDD,0x9A,
+0x10,0xD9,0xAB,0xAA,0x51,0x02,0x10,0x08,0x18,0x23,0x98,0xFD,0x0A,0x73,0x02,0x08,0xA0,0x8A,0xFB,0xAB,0x18,0x23,0xB9,0xAC,0x74,0x04,0x88,0xA9,0x0A,0x32,0x33,0x36,
+0x22,0x14,0xDB,0x09,0x14,0x98,0x00,0xA8,0xCB,0x8C,0x80,0xAB,0x38,0x81,0xDA,0xEF,0xAA,0x89,0x80,0x08,0x31,0x11,0x88,0xAA,0x99,0x54,0xE8,0xBD,0xAA,0x19,0x23,0xDB,
+0x89,0x10,0x04,0xFB,0x9A,0xAA,0x80,0xAB,0x80,0x18,0x82,0xBC,0x39,0x34,0x16,0xDA,0x0A,0x10,0xA8,0x88,0x28,0x24,0x34,0x61,0x04,0x88,0xEB,0x99,0x89,0x21,0x88,0x98,
+0x73,0xA2,0x9A,0x39,0x77,0x01,0x08,0x01,0x32,0x03,0x18,0x88,0x72,0x23,0x31,0x34,0xE0,0xBC,0xAB,0x38,0xA0,0xBC,0x0A,0x51,0x36,0x11,0x02,0xAA,0x9B,0x22,0x73,0x34,
+0x53,0x81,0xCB,0x8B,0x52,0x12,0xB9,0x89,0x11,0x80,0x80,0xAA,0x71,0x13,0x32,0x21,0xD0,0x8D,0x82,0x0A,0x42,0x45,0x23,0x00,0x09,0x63,0x13,0x9A,0xC9,0x0C,0x36,0x98,
+0xAA,0xAB,0x9A,0x30,0x03,0xEA,0xBD,0xAB,0x9C,0x11,0x08,0x98,0x09,0x31,0x02,0x09,0x36,0x81,0xCC,0x2A,0x45,0x23,0x13,0x89,0x62,0x03,0xAB,0x53,0x21,0x27,0x18,0x35,
+0x02,0x00,0xAA,0x41,0x12,0x11,0xCA,0xAA,0xAA,0x0B,0xA8,0xCA,0xDD,0x9B,0xAA,0xAC,0x09,0xEB,0xBC,0xBE,0xBA,0xCC,0xBA,0x0A,0x53,0x82,0x18,0x00,0x33,0x18,0x26,0x12,
+0x33,0x91,0xEF,0xCB,0x9B,0x51,0x02,0x88,0xA9,0xAA,0xDA,0x9A,0x88,0x18,0x00,0x21,0x52,0x44,0x63,0x13,0x20,0x23,0x80,0x89,0xD8,0x38,0xB0,0x8C,0xA9,0x9B,0x30,0xF2,
+0xBE,0x2B,0x13,0x18,0x01,0xC9,0x8B,0xFB,0xBF,0x8A,0xC9,0xBB,0x89,0x80,0x09,0x63,0x24,0x02,0xC9,0xAD,0x9A,0x31,0xB2,0xAD,0x99,0x51,0x23,0x22,0xC9,0x0A,0xB0,0x1A,
+0xFB,0x9E,0x08,0x01,0xAA,0x29,0xB0,0x9E,0xA8,0x8C,0xB9,0xCD,0xCB,0x89,0x00,0x11,0xA9,0xBD,0x71,0x82,0xBC,0x8A,0x00,0x10,0x88,0x88,0x71,0x13,0x88,0x88,0x21,0x73,
+0x13,0x80,0xAA,0x42,0xC1,0x3A,0x27,0x12,0x12,0x00,0xB0,0xAF,0x41,0x01,0x00,0x30,0x26,0x32,0x03,0x28,0x03,0x79,0x35,0x11,0x24,0x11,0x22,0x08,0x43,0x31,0x44,0x34,
+0x43,0x23,0x11,0x44,0x33,0x25,0x81,0x01,0xAA,0x88,0x99,0x9B,0x10,0xA9,0xCF,0x72,0x24,0x81,0x8A,0x10,0x99,0x18,0x81,0x01,0x69,0x15,0x19,0x34,0x12,0x02,0xA9,0xDA,
+0x1A,0x82,0x0B,0xFE,0x9E,0x89,0x00,0xA9,0xBB,0xA9,0xCB,0xDB,0xBC,0x89,0x08,0x33,0xD1,0xBF,0x89,0x11,0xA8,0x89,0x80,0x88,0xB0,0xDF,0x19,0x22,0x11,0x32,0x47,0x13,
+0x22,0x90,0xA8,0x10,0xB8,0xBC,0xCD,0x18,0x10,0x81,0xA9,0xCA,0x9D,0xB8,0xBF,0x18,0x01,0xC9,0xBD,0x9A,0x18,0x22,0x30,0x67,0x80,0x88,0x10,0x80,0x31,0x42,0x37,0x01,
+0x88,0x88,0x11,0xFA,0x1A,0x32,0x32,0xA1,0x9A,0xAA,0x18,0x32,0x18,0xB1,0xBF,0xAC,0x64,0x12,0x98,0x89,0x03,0x09,0x98,0xFC,0xAB,0x19,0x12,0x08,0x88,0x30,0x82,0x88,
+0x39,0x27,0x99,0x73,0x85,0xCA,0x9B,0x88,0x08,0xE9,0xAD,0xB9,0xAB,0x99,0x31,0x85,0xEB,0xBC,0x39,0x13,0xCB,0x9A,0x28,0xB3,0xEF,0x98,0x88,0x32,0x43,0x34,0x12,0x23,
+0xA0,0x99,0xDB,0x19,0xB2,0xAF,0x98,0x1B,0xB1,0x0C,0xA1,0x8C,0xB8,0xAC,0xBA,0x9E,0x22,0x11,0x15,0xC9,0x9C,0x21,0x31,0x01,0x43,0xC1,0xFF,0x8A,0x08,0x01,0x21,0x22,
+0xB8,0x9D,0x89,0x40,0x02,0x28,0x84,0x89,0x80,0x28,0x92,0x70,0x25,0x31,0x43,0x11,0x90,0x08,0xF9,0xAE,0x89,0x88,0x01,0x28,0x22,0xA9,0x88,0x11,0xAB,0xEA,0xEB,0x9C,
+0xA0,0xBB,0xAD,0x89,0x99,0x24,0xEE,0x8A,0x34,0x43,0x91,0x9B,0xB9,0x0A,0x21,0x35,0xC0,0xAE,0x18,0x63,0x02,0xA8,0x89,0x30,0x26,0x12,0x82,0x99,0x20,0x00,0x41,0x12,
+0xAA,0x48,0x33,0x44,0x81,0xFB,0xBD,0x28,0x01,0xAB,0x10,0x44,0x42,0x23,0xC9,0xCF,0x8B,0x12,0x42,0x02,0xA9,0xAB,0x00,0x8A,0x21,0x06,0xEB,0xDB,0x09,0x12,0x21,0x81,
+0xB9,0xAC,0x20,0x02,0x30,0x04,0x8D,0x04,0xBC,0x9A,0x18,0x77,0x13,0x01,0xA0,0x88,0x00,0x32,0x03,0xEE,0x89,0x20,0x24,0x12,0x31,0x14,0x01,0x18,0x44,0xA1,0xAC,0x20,
+0x30,0x26,0xA8,0x99,0xDB,0x9C,0xB9,0xBE,0x08,0x22,0x02,0x42,0x23,0xB0,0xBC,0x49,0x24,0xCA,0x09,0x63,0x25,0x11,0x90,0x9B,0x32,0x53,0x35,0x13,0xBA,0x4A,0x34,0x23,
+0x98,0xCA,0x0A,0x55,0x02,0xCD,0x9A,0x09,0x32,0x24,0x80,0x51,0x82,0x89,0x38,0x26,0xC9,0x0A,0x54,0x24,0x00,0x18,0x22,0x01,0xCC,0x09,0x11,0xFB,0xAA,0x09,0x32,0x33,
+0x90,0xEB,0xBC,0x8A,0x18,0x02,0x23,0x91,0x20,0xB0,0xFF,0x9C,0x30,0x24,0xC9,0xAB,0x9A,0x20,0x13,0x9A,0x99,0x48,0x66,0x02,0x89,0x10,0xA8,0xBC,0x9B,0x80,0x98,0xBA,
+0xBD,0xCA,0xBD,0x18,0x22,0x90,0xDD,0xCB,0x9A,0x89,0xB8,0xAE,0xBB,0x89,0xFB,0xBD,0x9A,0x89,0xC9,0xBC,0xBA,0x9B,0x88,0xDA,0x9B,0x00,0x98,0xA9,0xEC,0xBB,0xAC,0xCA,
+0xAA,0xAD,0x09,0x10,0x22,0x02,0xFA,0xBB,0x20,0x11,0x22,0x44,0x82,0xCA,0xAD,0x9A,0x1A,0x25,0xA0,0x49,0x24,0xA0,0x38,0x34,0x13,0xFB,0x0A,0x54,0x14,0x80,0x18,0x42,
+0x25,0x90,0x80,0x98,0x99,0x8A,0x30,0x63,0x36,0x11,0x00,0x10,0x90,0x19,0x21,0x54,0x01,0x38,0x44,0x45,0x24,0x22,0xC8,0x8B,0x52,0x33,0x23,0x81,0x09,0x52,0x34,0x20,
+0x21,0x00,0x80,0x28,0x36,0x24,0x80,0x41,0xA1,0x1A,0x47,0x21,0x24,0x01,0x11,0x11,0x12,0x10,0x73,0x02,0xA9,0x9C,0xA8,0x0B,0x37,0x44,0x33,0x23,0x53,0x14,0xA8,0x8A,
+0xA8,0xBE,0xAA,0x08,0x43,0x22,0x34,0x82,0x20,0x54,0x82,0x21,0x22,0x88,0xB9,0x8C,0xA9,0xBC,0xBD,0x28,0xB9,0x3A,0x01,0x50,0xF8,0x0C,0x04,0x88,0xE9,0xAC,0x89,0x28,
+0x36,0x12,0x90,0xB9,0xCC,0xBC,0xBB,0xBB,0xAD,0x28,0x11,0x03,0xCF,0xBA,0xAB,0x08,0x42,0xA0,0xFB,0xBB,0x9A,0x18,0x90,0xCD,0xCD,0xAA,0x18,0x21,0x81,0xDC,0xAD,0x98,
+0x99,0x8A,0x90,0xCA,0xDB,0xAA,0x88,0x98,0xCA,0xAB,0xFC,0xBB,0x88,0x99,0x98,0xBB,0x9C,0xC9,0x09,0x08,0x80,0xCB,0x09,0x21,0x34,0x31,0x11,0x76,0x36,0x23,0x20,0x43,
+0x22,0x00,0x98,0xBB,0x29,0x46,0x13,0x80,0x18,0x12,0x64,0x92,0xAC,0x01,0x01,0x82,0x50,0x14,0xEA,0xBB,0x8A,0x20,0x21,0x63,0x23,0x11,0x21,0x23,0xB1,0x09,0x99,0xFB,
+0x9E,0x42,0x46,0x12,0xA8,0x0A,0x20,0x23,0x01,0x81,0x29,0x56,0x12,0x24,0x90,0x10,0x80,0x71,0x26,0x00,0x00,0x09,0x11,0x21,0x23,0xA0,0x10,0x53,0x64,0x02,0x99,0x9B,
+0x40,0x43,0x01,0x08,0x01,0xFB,0xBB,0x39,0x47,0x01,0x08,0x99,0x33,0x02,0x11,0x22,0x45,0x80,0xBB,0x09,0x77,0x13,0x00,0x99,0x20,0x23,0x01,0xCC,0xBB,0xBD,0x8A,0xAA,
+0x18,0x41,0x33,0xA0,0xAD,0x09,0x08,0x92,0xCF,0xBB,0x9A,0x00,0x10,0x32,0xD0,0xEB,0xAD,0xBA,0x9B,0x23,0xFD,0xAE,0x99,0x00,0x98,0x99,0x08,0x08,0x08,0xC0,0xCF,0x9B,
+0x99,0x88,0x90,0xDA,0x9A,0x88,0xBA,0x29,0x44,0x02,0xBA,0x0A,0x21,0xB1,0xBF,0x19,0x00,0x10,0xB9,0x4A,0x05,0xDE,0xBA,0xAB,0x10,0x32,0x45,0x92,0x1A,0x84,0x38,0x13,
+0x99,0x70,0x37,0x81,0x89,0x99,0xAB,0xA9,0xBB,0x70,0x24,0x10,0x22,0x01,0x00,0x21,0x65,0x53,0x12,0xA8,0x89,0x1A,0x47,0x81,0x88,0x89,0x45,0x02,0x10,0x01,0x00,0xFA,
+0xAD,0x99,0x20,0x33,0x32,0xA1,0x49,0x15,0x9B,0xA9,0x3A,0x34,0x33,0x88,0x31,0x64,0x82,0xC9,0xBD,0x9A,0x28,0x16,0x01,0x81,0x09,0xB8,0xAF,0x00,0x80,0xB8,0x9D,0x80,
+0xBE,0x9A,0x08,0x21,0x02,0xB9,0xBD,0x08,0xCA,0x48,0xA3,0xCF,0x09,0x08,0x82,0xAB,0xA9,0x3A,0x25,0x81,0xA0,0xBC,0xC9,0xAE,0x10,0x89,0x72,0x13,0xBA,0xEA,0x8A,0x01,
+0xBB,0xCB,0x58,0x25,0x80,0xDA,0xAB,0xB8,0x9B,0x82,0xBF,0x28,0x11,0x34,0x00,0x90,0xBC,0x71,0x04,0x20,0x91,0xAE,0x0A,0x28,0x24,0xA8,0xAA,0xCE,0x19,0x11,0x31,0x16,
+0x01,0x10,0x21,0x90,0x50,0x36,0x32,0x14,0x08,0x10,0x99,0x21,0x90,0x75,0x35,0x23,0x02,0x98,0x88,0x90,0xCA,0xAD,0x62,0x23,0x21,0x82,0x08,0x10,0x52,0x44,0x11,0x91,
+0xAC,0x00,0x11,0x43,0x32,0x45,0x91,0x28,0x98,0x73,0xB0,0x9B,0xEA,0x9B,0x81,0x9B,0x35,0x12,0xC8,0xAE,0x80,0x89,0xB8,0xBD,0x99,0xCB,0xBB,0xCE,0xAB,0x00,0xA8,0xBD,
+0xBC,0xBA,0xCB,0xBC,0x10,0x14,0xD9,0xBD,0xAB,0x20,0x21,0x90,0xCC,0x89,0x00,0x42,0x21,0x13,0xDC,0x09,0x21,0x12,0xE9,0xAC,0x08,0x01,0x10,0x00,0x90,0xEF,0x9A,0x9A,
+0x31,0x53,0x02,0x12,0x22,0xA8,0x9B,0x38,0x37,0x23,0x88,0x88,0x32,0x82,0xEB,0x60,0x35,0x14,0x01,0x82,0x09,0x81,0x19,0x11,0x77,0x13,0x22,0xA1,0x9E,0x08,0x21,0x90,
+0xBB,0x08,0x54,0x14,0x80,0x52,0x23,0x01,0x88,0x9A,0x90,0x74,0x93,0x88,0x98,0x1A,0x23,0x42,0x25,0x02,0xE9,0xAE,0x20,0x12,0x22,0x23,0x82,0x0C,0x34,0xC8,0xAE,0x8A,
+0x10,0x31,0x35,0x02,0x31,0x02,0x32,0x74,0x82,0x9B,0x30,0x65,0x03,0xBA,0x18,0x32,0x25,0xC8,0x9C,0x08,0x80,0xCA,0xAA,0xAA,0xEB,0xBC,0x88,0xBB,0x50,0x23,0x11,0xB8,
+0x9B,0x98,0x73,0x47,0x80,0x81,0xB9,0xDB,0x8B,0x41,0x02,0x98,0xCD,0x9A,0x22,0x81,0xDC,0x0A,0x89,0x11,0xC8,0xAA,0xAB,0x88,0x18,0x53,0x23,0x43,0x99,0xFB,0xBF,0x08,
+0x80,0xC9,0xAE,0x88,0x11,0x91,0x9A,0x99,0x09,0xA8,0xBC,0xAC,0xAA,0x30,0x91,0xEB,0xDD,0xAB,0x00,0x81,0xCA,0xA9,0x8B,0x31,0x67,0x22,0x32,0x81,0xA9,0x20,0x14,0xA9,
+0x19,0x17,0xBA,0xA9,0x09,0x61,0x34,0x23,0x90,0xBB,0x08,0x72,0x23,0x11,0xDC,0x1A,0x83,0x09,0x98,0xAC,0x08,0x38,0x05,0x11,0xFA,0xAF,0xAA,0x89,0x88,0x88,0x20,0x92,
+0xCA,0x89,0x98,0x20,0x34,0x34,0xF9,0xAF,0x89,0x00,0x12,0x00,0x12,0x82,0xBB,0x28,0x67,0x12,0x10,0x21,0x33,0x04,0xEB,0x09,0x52,0x25,0xA8,0x0A,0x53,0x25,0x01,0x11,
+0x11,0x22,0x21,0x02,0x08,0x13,0x90,0x89,0x73,0x13,0x18,0x36,0xB8,0x29,0x13,0x9B,0x10,0x25,0xFB,0x0B,0x91,0xAA,0xBC,0x21,0x40,0x56,0x92,0x09,0x00,0x21,0x24,0x25,
+0xA8,0x38,0x57,0x13,0x99,0xAA,0x9B,0x01,0x18,0x84,0xDF,0xBC,0x18,0x12,0x90,0x8A,0xA8,0x10,0xA0,0xCC,0x2A,0x35,0x34,0x82,0x11,0x80,0xAB,0xED,0xAB,0x52,0x13,0x81,
+0xA9,0xBB,0xCD,0x18,0x02,0xBC,0x98,0x20,0x24,0xFA,0x8B,0x00,0x11,0x10,0x62,0x82,0xCB,0x8A,0x32,0x34,0x07,0x9A,0x22,0x31,0xB1,0xCF,0x10,0x01,0xA0,0xAC,0x20,0x53,
+0x33,0x44,0x02,0x11,0x21,0x81,0x53,0x02,0xAA,0x42,0x53,0x12,0xC9,0xBB,0xCD,0xAA,0xDB,0xBD,0x09,0x01,0xB8,0x9B,0xEB,0xAB,0x80,0x11,0x21,0x26,0x91,0xBC,0x9B,0xC9,
+0xBC,0xCB,0x8A,0x08,0x80,0x0A,0x73,0xA8,0xCD,0xEC,0x8A,0x98,0xAA,0xA9,0x8A,0xB8,0xBB,0xBC,0xAA,0x18,0x92,0xBE,0x8B,0x46,0x02,0xA8,0x38,0x53,0x13,0xB8,0x8B,0x10,
+0x42,0x36,0x22,0x31,0xC1,0xAE,0x08,0x31,0x44,0x03,0xBC,0xAB,0x52,0x82,0x89,0x74,0x04,0x88,0x10,0x88,0x10,0x34,0x02,0xA9,0x41,0x46,0x22,0x01,0x90,0xDB,0x28,0x80,
+0xC9,0xBB,0x09,0x32,0xB0,0xAE,0x9C,0x88,0x20,0x35,0x03,0xDE,0x8A,0x10,0x02,0x90,0x9A,0x63,0x11,0x01,0xEB,0x99,0xBA,0x58,0x22,0xA0,0xAC,0x9B,0x31,0x77,0x23,0x88,
+0x98,0x00,0x08,0x20,0x22,0xFC,0x9A,0x08,0x30,0xE8,0xAD,0x09,0x22,0x03,0x08,0x42,0x01,0xB0,0x9D,0xA1,0x28,0x23,0x36,0xB1,0xAE,0x09,0x53,0x42,0x32,0x34,0x12,0x10,
+0xA0,0x09,0x88,0x71,0x57,0x22,0x22,0x80,0x98,0x30,0x45,0x13,0xA8,0x19,0x02,0x88,0x42,0x35,0x92,0x8A,0x64,0x15,0x12,0x01,0xC9,0x09,0x21,0x10,0x98,0x21,0xFA,0xCD,
+0x99,0x99,0xCB,0xAC,0x09,0x18,0x91,0xBC,0xDD,0x8A,0x88,0x88,0x98,0xA9,0xAA,0x18,0xD8,0xDD,0xCA,0x89,0x31,0x44,0x82,0xBA,0x89,0x53,0x91,0xBC,0xAD,0x09,0x81,0x80,
+0x99,0x89,0xAA,0x18,0x55,0xA2,0xBD,0xCA,0xCB,0x9B,0x99,0xDC,0xBC,0x89,0x88,0x20,0x11,0x80,0xEA,0xBD,0x99,0x89,0x20,0x43,0x14,0x98,0x89,0xBA,0x08,0x10,0x23,0x11,
+0x44,0xF8,0xDF,0x8A,0x90,0xAA,0x8A,0x21,0xB0,0xAD,0x89,0x88,0x73,0x14,0x12,0x00,0x83,0xDF,0x08,0x81,0xA8,0x0A,0x32,0x44,0x33,0x42,0x13,0x89,0x51,0x23,0x53,0x22,
+0x00,0xCC,0x0B,0x12,0x11,0x12,0x00,0x02,0x73,0x57,0x22,0x21,0x01,0x89,0x8A,0x11,0x90,0x08,0x24,0x92,0x99,0x18,0x37,0x57,0x33,0x12,0xA8,0x19,0x02,0xBA,0x9C,0x50,
+0x37,0x33,0x80,0xA9,0xAB,0x99,0xBA,0x89,0xBA,0x02,0xDF,0x72,0x35,0x12,0x98,0x19,0x98,0x48,0x36,0x11,0x90,0xAA,0x2A,0x44,0x32,0x03,0xDA,0x0A,0x36,0x13,0x00,0x10,
+0x80,0x00,0x89,0x91,0xFF,0x9B,0x10,0x01,0xC9,0x9B,0x11,0xA9,0xAB,0xCB,0xCD,0x9A,0x8A,0x32,0xA0,0xDE,0xAD,0x09,0x81,0xC9,0xAB,0xCB,0x0B,0x12,0x81,0xEA,0x8B,0xA0,
+0xCC,0x99,0x11,0x02,0xEC,0x0A,0x90,0xCB,0xCD,0xAB,0x18,0x32,0x43,0x32,0x44,0x23,0x81,0xCB,0x9A,0xCB,0xAA,0x9A,0x81,0xAA,0x38,0x65,0x24,0xA1,0xAA,0xED,0xCB,0xBC,
+0x8A,0x08,0x10,0x21,0x81,0x99,0xDB,0x9C,0xB9,0xAD,0x08,0x08,0x09,0x65,0x03,0x00,0x80,0x88,0xA9,0xCB,0x10,0x35,0x24,0xC9,0x8B,0x00,0x34,0x22,0x31,0x47,0x32,0x14,
+0x11,0x53,0x43,0x02,0x80,0xCA,0x8A,0x88,0x32,0x23,0x21,0x01,0xBC,0x38,0xA3,0xCC,0xCD,0xCE,0x9A,0x10,0x35,0x01,0x20,0x22,0x56,0x02,0x88,0x80,0xCB,0x29,0x46,0x01,
+0x01,0x81,0xA9,0x8B,0x73,0x16,0x81,0x98,0x80,0xA8,0xA9,0xC9,0xBC,0x99,0xEB,0x9A,0x21,0x35,0x02,0x21,0x80,0x18,0x01,0x91,0xFC,0x8A,0x61,0x44,0x02,0x80,0x88,0x10,
+0x82,0xEB,0xAB,0x28,0x01,0x31,0x14,0xDA,0x8A,0xA9,0x38,0xC1,0x88,0x9B,0x08,0xCB,0x89,0x8C,0x83,0xDE,0xBD,0xAB,0x19,0x75,0x23,0x90,0xBC,0x8A,0x22,0x81,0x18,0x32,
+0x23,0x93,0x0A,0x31,0x18,0xF9,0xFF,0x8D,0x89,0x08,0x88,0x89,0x18,0x13,0x99,0x10,0x43,0x92,0xAA,0xED,0xBC,0x9B,0xA9,0x89,0x01,0x99,0xAA,0x73,0x17,0x00,0x18,0x98,
+0x18,0xB1,0xBE,0xAB,0x18,0xD9,0x0A,0x41,0x33,0x33,0x26,0x22,0x33,0x32,0xFA,0xAC,0xA9,0xAA,0xBC,0x48,0x23,0x11,0x44,0xA0,0xBC,0xAC,0x90,0xBB,0x0A,0xA9,0x68,0x23,
+0x72,0x24,0x22,0x34,0x36,0x13,0x00,0x98,0x98,0xA0,0xAA,0xA9,0xAC,0x09,0x48,0xC2,0x8C,0x11,0x44,0x32,0x47,0x01,0x10,0x41,0x43,0x11,0x44,0x15,0x80,0x89,0x20,0x13,
+0x88,0x90,0x1B,0x03,0xA9,0xF9,0x1D,0x45,0x91,0xBB,0x0A,0x81,0xBB,0x9A,0xCA,0x18,0xD0,0xBE,0x1A,0x53,0x03,0x99,0x9A,0x31,0x91,0xA9,0xEC,0x9B,0xCB,0x8A,0x40,0x02,
+0x08,0xDB,0x19,0x92,0xDD,0xBD,0x9B,0x10,0xD9,0x09,0x12,0x02,0x10,0x42,0x26,0x12,0xBA,0xCE,0x99,0x89,0xA9,0x9D,0x28,0x12,0x28,0x44,0xA2,0xCD,0x8B,0x10,0x22,0xB0,
+0xEF,0x8A,0x88,0x01,0x98,0x0A,0x32,0x45,0x01,0x91,0xCC,0x8A,0x01,0xA8,0x9B,0xBB,0x0B,0x63,0x34,0x43,0x81,0x98,0x19,0x53,0x35,0x82,0x9A,0x11,0xAB,0xFB,0x9B,0x09,
+0x53,0x34,0xA1,0xCC,0xCB,0x1B,0x13,0x99,0xDD,0x9C,0x42,0x23,0x11,0x83,0xBB,0x28,0x35,0x92,0x9E,0xC9,0xBE,0x19,0x23,0xA8,0xBB,0x09,0xFB,0xAD,0x08,0xA9,0xBA,0xDB,
+0x09,0x01,0x81,0xCC,0x99,0x19,0x34,0x01,0xA9,0x9C,0x51,0x24,0x33,0x33,0xA8,0x28,0x14,0x73,0x22,0x20,0x22,0x34,0x53,0x23,0x22,0x35,0x04,0x90,0x32,0xA0,0xCE,0x09,
+0xCA,0x99,0xB9,0xFB,0xBD,0x9A,0xA8,0x0B,0x90,0x21,0x24,0x23,0xFB,0x8D,0x32,0x90,0x99,0x62,0x13,0x00,0x44,0x22,0x42,0x25,0x80,0x20,0x55,0x33,0x91,0x89,0x80,0xAA,
+0x20,0x08,0x31,0x23,0xFA,0x9B,0x11,0x20,0x74,0x33,0x12,0x81,0x90,0x73,0x43,0x11,0x13,0x30,0x15,0x00,0x02,0x00,0x43,0x65,0x32,0x43,0x81,0x20,0xB0,0xCD,0xBA,0x8B,
+0x90,0xBD,0x31,0x11,0xB8,0xB8,0xCF,0xBB,0x08,0xB9,0x4A,0x27,0x00,0x11,0x31,0x37,0x11,0x20,0x43,0xD0,0xAB,0x00,0x89,0x31,0x12,0xCA,0xBB,0xAC,0xBD,0x98,0xDB,0xDC,
+0xCC,0x9A,0x89,0x00,0x08,0xB9,0xBB,0x8C,0x00,0xB8,0x9D,0x80,0xF9,0x1B,0x83,0xCC,0x08,0xA9,0xDB,0x19,0x32,0x12,0xFB,0x8C,0xA8,0x8B,0x21,0x23,0xA1,0x09,0x33,0x80,
+0x50,0x26,0x81,0xBA,0x72,0x57,0x88,0xCA,0xAA,0xAA,0xA9,0x19,0x21,0x00,0x08,0xA2,0xBC,0x22,0x83,0xFF,0x0A,0x90,0x89,0x32,0x93,0x1A,0x77,0x02,0x08,0x80,0x80,0xA9,
+0x19,0x92,0x9A,0x40,0x03,0x9A,0xEB,0xAC,0x88,0x80,0xFA,0xAC,0xBC,0x8B,0x22,0x45,0x12,0x22,0x36,0x91,0x18,0x83,0xBA,0x2A,0x47,0xB0,0x9C,0x00,0x88,0xCA,0x18,0x02,
+0x43,0x43,0xB1,0xBF,0x08,0x34,0x03,0x18,0x43,0x14,0x98,0x73,0x23,0x08,0x42,0x03,0x18,0x90,0xBA,0x28,0xC1,0x0A,0xC8,0x49,0x13,0xE0,0x9D,0xCB,0xBB,0x8A,0x12,0x43,
+0x04,0x30,0x47,0x02,0x10,0x22,0x02,0x63,0x35,0x91,0xCB,0xBB,0x89,0xA9,0x8C,0x88,0xB9,0xCB,0xCD,0x9A,0x90,0xDB,0xCC,0x8A,0x00,0x52,0x22,0xB0,0xCC,0x58,0x13,0x11,
+0x80,0xB9,0x9B,0x46,0x81,0x08,0x33,0x33,0x98,0x98,0x9A,0xB0,0x77,0x84,0xBB,0x89,0x88,0xA8,0x0A,0x14,0x20,0x04,0xE8,0x1A,0x45,0x41,0x12,0x21,0xC9,0xAB,0x89,0x21,
+0x01,0xAA,0x02,0x88,0x77,0x81,0xAB,0x0A,0x88,0xCB,0x0A,0x51,0x35,0xA0,0xAC,0xA9,0xA9,0x18,0x35,0x08,0x00,0xBB,0xBA,0xDF,0xAB,0xEA,0x8A,0x11,0xFA,0xAE,0x9A,0x99,
+0x88,0x98,0x00,0x88,0x0A,0x02,0xA8,0x09,0x31,0xF3,0x1C,0x45,0x01,0xEA,0x9A,0x88,0xB9,0x8A,0x98,0xCA,0xBC,0x89,0xBA,0x99,0xED,0x9A,0x21,0x81,0x38,0x16,0x99,0x31,
+0x34,0x02,0x30,0xA4,0xCF,0x8A,0x53,0x02,0x88,0x42,0x22,0x11,0x23,0xC9,0x00,0x52,0x26,0x90,0x08,0x42,0x44,0x12,0x02,0x10,0x53,0x24,0x42,0x34,0x32,0x23,0x63,0x14,
+0x21,0x12,0x88,0xDA,0x9D,0x31,0x02,0x31,0x23,0xB0,0x9B,0x18,0xA1,0x59,0x47,0x13,0x80,0xDA,0xAB,0x2A,0x45,0x83,0x20,0x24,0x80,0xA0,0xBC,0xBB,0xAB,0xA9,0x1A,0x35,
+0x32,0xB9,0xFA,0x8C,0xA9,0x19,0x31,0x81,0xDE,0xAC,0x80,0xBC,0x9D,0x11,0x43,0x43,0x02,0xCA,0x8B,0xC8,0xAE,0x00,0x11,0x80,0x88,0x91,0xBB,0x29,0xB9,0xCF,0xBB,0xBE,
+0xAA,0x09,0x64,0x23,0x00,0x90,0xDD,0xBB,0xBC,0xAB,0x08,0x22,0x12,0x00,0xDA,0xAB,0xCA,0x0B,0x63,0x14,0xB8,0x8C,0x21,0x11,0x37,0x14,0x11,0x10,0x13,0x21,0x11,0x31,
+0x83,0x43,0xA8,0x2B,0xE1,0xAB,0xFB,0xEF,0x18,0x22,0x33,0x91,0x9A,0xBB,0x89,0x43,0x53,0x01,0xBA,0xBC,0xAC,0x21,0x43,0x25,0x80,0xBA,0xA9,0x0A,0x12,0xCC,0xAC,0x39,
+0x15,0x01,0xA9,0xAC,0x18,0x91,0xD9,0xBE,0x20,0x81,0xA8,0xDD,0xAA,0x01,0xA8,0x9D,0x10,0x11,0x43,0x37,0x24,0x00,0x90,0xB8,0xAA,0x08,0x10,0xE8,0x9E,0x00,0x11,0x10,
+0xC0,0xDF,0xAA,0x88,0x10,0x10,0x01,0x10,0x22,0xFA,0xBE,0xBC,0x8A,0x11,0x31,0x92,0xBA,0xAA,0x8B,0x81,0x28,0x44,0xB1,0xBF,0x39,0x37,0x21,0x35,0x13,0x11,0x22,0x93,
+0x9A,0x08,0x88,0x71,0x26,0x91,0x2A,0x05,0xBA,0x0B,0x31,0x90,0x75,0x34,0x90,0xBA,0xCB,0x1A,0x45,0x33,0x92,0xBD,0x8B,0x52,0x13,0x00,0xBA,0x09,0x89,0xDB,0x09,0xB8,
+0xBD,0x19,0x33,0x44,0x82,0x89,0xA9,0x88,0x21,0x37,0x01,0x43,0xA9,0x38,0x27,0x22,0x44,0x24,0x90,0xBC,0x39,0x35,0x12,0x80,0xBC,0x08,0x98,0xDB,0xAB,0x1A,0xB2,0xCF,
+0x18,0x32,0xA0,0xDF,0xBB,0x9A,0x18,0x12,0x30,0x03,0xBC,0x19,0xB1,0xDF,0xAA,0x9A,0x00,0x52,0xD0,0x9C,0x21,0x12,0x18,0x21,0x31,0xC9,0xBB,0x49,0x57,0x22,0x90,0xBB,
+0x18,0x33,0x43,0x10,0xA0,0xBE,0x99,0x88,0x10,0x44,0x83,0x9B,0x00,0x81,0xFB,0x9C,0xA9,0xCF,0x9A,0x99,0x28,0x80,0xF9,0xAC,0x89,0x0A,0x52,0x23,0x98,0x10,0x22,0x01,
+0x43,0xFA,0x9D,0x21,0x12,0xA8,0x88,0x98,0x10,0x36,0x00,0x21,0x11,0x98,0xAD,0x40,0x15,0xB8,0x89,0x48,0x25,0xCA,0x1A,0x42,0xD1,0xBF,0x09,0x00,0x32,0x91,0x9A,0x80,
+0x71,0x14,0x01,0x32,0x82,0xCC,0x09,0x00,0x88,0x10,0xDA,0x8B,0x31,0x37,0x02,0x98,0x08,0xFB,0x8A,0x22,0x31,0x21,0x73,0x93,0xAB,0x61,0x35,0x81,0x38,0x12,0x20,0x46,
+0x22,0x99,0x89,0x00,0x00,0x32,0xA8,0x38,0x55,0x81,0x90,0x88,0x77,0x25,0x12,0x08,0x01,0x08,0xA0,0xDC,0x09,0x34,0x23,0x21,0xA8,0xCF,0x9B,0x18,0x33,0x90,0xCB,0x9C,
+0x30,0x23,0xC9,0x9A,0xCD,0x48,0x26,0x81,0x99,0x88,0xCB,0x09,0x24,0x23,0x80,0x20,0xB0,0xAC,0x11,0xEB,0x9C,0x09,0x10,0xA0,0xBC,0xBB,0xCB,0xAD,0x9A,0xDA,0x1B,0x85,
+0xBD,0xAB,0xAA,0x99,0x00,0x72,0x02,0xB9,0x19,0x73,0x02,0x00,0xCA,0x9C,0x30,0x26,0x01,0x08,0xB8,0xBE,0x0B,0x21,0xB0,0xCA,0xBA,0xAD,0x99,0x30,0x24,0xA8,0xDF,0xAB,
+0x00,0xA0,0xBA,0xCD,0xB9,0x09,0x91,0xAC,0xCA,0x9B,0x19,0xB0,0xAF,0x9A,0x50,0x23,0x11,0xB8,0xAD,0x99,0x11,0xFA,0x9B,0x42,0x23,0x13,0xC8,0xDC,0xBD,0x8A,0x42,0x12,
+0x9A,0xA9,0x9A,0x19,0x81,0xAC,0x10,0x08,0x43,0x23,0xC8,0xBD,0xDD,0x9A,0x52,0x36,0x12,0x02,0x88,0x21,0x33,0x01,0x63,0x44,0x01,0x08,0x00,0x9A,0x00,0x31,0x23,0xAA,
+0x61,0x03,0xB9,0xDF,0xAB,0xB8,0x09,0x36,0x15,0xA9,0x30,0x26,0x82,0x88,0x20,0x24,0x02,0x81,0x10,0x57,0x24,0x92,0x9A,0x32,0x01,0xDA,0x8A,0x11,0x52,0x35,0x12,0x20,
+0x11,0xFB,0x9D,0x10,0x01,0x09,0x10,0x20,0x46,0x23,0xC8,0x9C,0x10,0xA0,0xAB,0x51,0x43,0x12,0x98,0xCA,0xAC,0x80,0xAA,0xBB,0x8B,0x64,0x34,0x14,0x90,0xCB,0xBC,0x9B,
+0x28,0x55,0x12,0x11,0x80,0x08,0x53,0x35,0x12,0xA8,0x09,0x11,0xC9,0x99,0xFA,0x9B,0x08,0x33,0xB8,0x28,0xFB,0xAF,0x09,0x11,0x21,0xB9,0xDD,0x89,0x10,0x01,0x80,0xA8,
+0xBA,0x8C,0x51,0x54,0x24,0xC8,0xCC,0x89,0x11,0x02,0xA0,0xCA,0xAA,0x09,0x80,0xBC,0x9C,0x88,0xD9,0xAE,0x18,0x24,0x12,0xDA,0xBC,0x9A,0x31,0x90,0xBC,0x8A,0x88,0x30,
+0x57,0x03,0xA8,0xAA,0xA9,0x28,0x35,0x22,0x26,0xA8,0x61,0x34,0x02,0xB9,0x99,0xA8,0x9C,0x51,0x23,0xB8,0xBD,0xAC,0x8A,0x10,0xC9,0xCD,0x89,0x22,0x02,0x99,0x19,0x02,
+0x9A,0x53,0x34,0x45,0x02,0xBA,0x2B,0x47,0x33,0x13,0x88,0xA9,0x9A,0x20,0x03,0x9B,0xB9,0x1C,0x14,0x30,0x94,0xAF,0x0A,0xA8,0x8A,0x57,0x02,0xC8,0xBC,0x18,0x32,0x83,
+0xA9,0xCB,0x0C,0x23,0x30,0x47,0x81,0x99,0x89,0x30,0x91,0xA9,0xCC,0x08,0x18,0x67,0x13,0xBA,0xAC,0x18,0x11,0x08,0x21,0x02,0xC0,0xBE,0xCB,0xCD,0x89,0xA0,0xBC,0x9B,
+0x9A,0x9A,0x74,0x03,0x80,0x18,0x81,0xCE,0x99,0x30,0x25,0xC9,0x18,0x02,0xC9,0x8B,0x23,0xD9,0xAB,0x08,0xA9,0x31,0x91,0xCD,0x0A,0x36,0x81,0x90,0x29,0x47,0x90,0x9A,
+0x30,0x01,0xA9,0x62,0x43,0x22,0x22,0xB8,0x0B,0x56,0x92,0xCA,0x19,0x03,0xCC,0x0B,0x44,0x03,0xAA,0x8B,0x53,0x23,0x11,0x00,0x72,0x25,0x01,0xA8,0x09,0x22,0x43,0x01,
+0x00,0xC0,0x89,0xA8,0xBC,0x09,0x28,0xB1,0xEF,0x29,0x54,0x23,0x90,0x9D,0x28,0x33,0x13,0x53,0x81,0x28,0x35,0x91,0x3A,0x37,0x91,0x19,0x43,0x82,0x08,0xEA,0xAC,0x98,
+0xBA,0x9D,0x11,0x99,0x20,0x14,0xFA,0x0A,0x98,0xBC,0xAA,0x62,0x25,0xA0,0x9B,0x81,0xDB,0x8A,0x01,0xCB,0x9A,0xA8,0x9C,0x52,0x81,0xCC,0x18,0x12,0xEB,0x89,0x51,0x23,
+0x90,0x99,0x21,0xA0,0xFB,0xAB,0x20,0x11,0x09,0xCB,0x3B,0x26,0xA0,0xFF,0x0A,0x22,0xB8,0xAE,0x10,0x01,0xA8,0x9A,0x20,0x91,0x8A,0xEC,0x19,0x22,0xB1,0xFF,0x89,0x11,
+0x81,0xAA,0x89,0x01,0x10,0x81,0xDE,0x09,0x41,0x90,0x8B,0x11,0x00,0x08,0xA0,0xBF,0x48,0x13,0x98,0x29,0x01,0xAB,0x62,0xC8,0x2A,0x16,0xB9,0xAD,0x50,0x23,0x80,0xA9,
+0x19,0xC0,0xAF,0x18,0x92,0xDB,0x28,0x16,0x89,0x08,0x01,0x10,0x33,0xA0,0x31,0x57,0x91,0x9A,0x42,0x33,0x81,0x8A,0x71,0x23,0x21,0x35,0x91,0xBC,0x08,0xC0,0x9C,0x41,
+0xA8,0x1A,0x37,0x80,0x89,0x33,0x13,0x31,0xA1,0xDF,0x38,0x32,0x81,0x9C,0x21,0x90,0x20,0x12,0x91,0xBC,0x72,0x12,0x21,0x14,0xB9,0x0D,0x45,0x92,0xCA,0x39,0x15,0xC9,
+0xAA,0x89,0x12,0xC9,0x8B,0x30,0x37,0xB0,0xBC,0xAA,0x73,0x03,0xA8,0x9A,0x00,0xCA,0xAB,0x41,0x33,0xFB,0x9C,0x11,0x12,0xB8,0xCC,0x89,0x10,0x02,0xED,0x8B,0x32,0x12,
+0x52,0x33,0xC9,0x9B,0x19,0x20,0x31,0xC0,0x69,0x24,0xDA,0x9B,0x00,0x98,0xA9,0x88,0xBB,0xBB,0xFF,0x8A,0x01,0x81,0xAA,0x9A,0x18,0x64,0x32,0x82,0xCA,0x9B,0xA8,0xCF,
+0x99,0x80,0x98,0x0A,0x37,0x82,0x08,0x11,0x24,0x33,0x92,0x9A,0x41,0x47,0x81,0x08,0x10,0x52,0x33,0x13,0x22,0x31,0x37,0x43,0x81,0xBB,0x9A,0x61,0x25,0xA0,0x99,0x10,
+0x00,0x00,0xB9,0x6A,0x37,0xB1,0xAC,0x38,0x25,0x80,0x99,0xBB,0x74,0x15,0xCA,0x0A,0x42,0x80,0x89,0x20,0x02,0xAA,0x00,0x80,0x31,0x15,0xBC,0x0A,0x21,0x44,0x12,0x22,
+0x36,0x25,0x02,0xB8,0x0A,0x34,0xB1,0xBE,0x20,0x13,0x42,0xC8,0xBD,0x90,0xCB,0x9A,0x34,0xC0,0xCD,0xAB,0xAA,0x9A,0xDA,0xCB,0x8A,0x99,0xB9,0xAC,0x90,0xDB,0xAC,0x0A,
+0x80,0xBC,0xBB,0x48,0x82,0x0A,0x45,0x81,0x88,0x51,0x93,0xBE,0x18,0xA0,0x40,0x15,0xC8,0xBD,0x09,0x01,0x89,0x31,0x82,0x89,0x12,0xFA,0xBF,0x08,0x12,0x81,0x30,0xF0,
+0xBB,0x18,0x42,0x81,0xBB,0x21,0x12,0x92,0x19,0x77,0x02,0xA9,0xEB,0x19,0x81,0xFB,0xAB,0x42,0x14,0xA8,0xCB,0x8A,0x31,0x91,0x89,0x43,0x83,0xFC,0x9B,0x32,0x13,0x41,
+0x02,0x89,0x61,0x14,0xC9,0x28,0x36,0x82,0xCB,0x8A,0x22,0xB0,0xBC,0x9C,0x20,0x92,0xEB,0x2B,0x34,0xC9,0xAD,0x89,0x22,0x21,0xB8,0xAE,0x10,0x13,0xFA,0x8E,0x11,0x82,
+0x00,0x32,0xB1,0xBE,0x2A,0x33,0x90,0x38,0x16,0x98,0x28,0x01,0x91,0x38,0x36,0x43,0x35,0x01,0xEB,0x9C,0x08,0x11,0x53,0x02,0xCA,0x09,0x33,0xC9,0x0A,0x47,0x22,0x10,
+0x02,0xC9,0x1B,0x37,0x91,0x0A,0x33,0x13,0x32,0x03,0xCB,0x70,0x25,0x98,0xBB,0x18,0x10,0x98,0xA9,0x51,0x36,0xD9,0x9C,0x41,0x81,0x9A,0x21,0xA1,0xAB,0x28,0x24,0xA1,
+0xCC,0x8A,0x8A,0x74,0x04,0xCA,0x29,0x36,0x01,0xBA,0x8A,0x30,0x12,0xB0,0xCF,0x09,0x13,0x98,0xAC,0x38,0x82,0xBE,0x9C,0x11,0x22,0x01,0xB9,0xBE,0x9A,0x00,0xDA,0x9C,
+0x88,0x10,0x33,0xC1,0xBF,0x89,0x11,0x12,0x01,0x98,0x2B,0x22,0xEB,0x0A,0x43,0x53,0x34,0x81,0xBA,0xBA,0xAC,0x28,0xA0,0xAA,0x81,0xBA,0xFB,0xCF,0x19,0x11,0x91,0xBB,
+0x74,0x83,0xEB,0xBB,0x29,0x02,0x88,0x00,0x11,0x43,0x25,0xB8,0x9D,0x40,0x13,0xD9,0x8B,0x51,0x92,0xDB,0x2A,0x25,0xC0,0xAB,0x42,0x13,0x80,0x90,0xAA,0x28,0x47,0x12,
+0xDB,0x9A,0x88,0x88,0x29,0x33,0xDA,0x9B,0x03,0xFB,0xAB,0x0A,0x90,0x89,0x80,0xED,0x0A,0x43,0xA0,0xAA,0x28,0x23,0x81,0xDA,0x9B,0x80,0x01,0xE0,0xBD,0x29,0x35,0xD8,
+0xAF,0x08,0x21,0x02,0xB9,0x9B,0x71,0x16,0x99,0x88,0x00,0x31,0x33,0xB9,0xAB,0x31,0x92,0xAC,0x41,0x26,0xC0,0xAD,0x39,0x36,0x82,0x9A,0x19,0x41,0x12,0x00,0x45,0x91,
+0xAB,0x71,0x13,0xBA,0x1A,0x02,0xFB,0x8C,0x01,0x32,0x82,0xC9,0xBC,0x72,0x14,0xA8,0x0A,0x43,0x13,0x98,0x29,0x52,0x23,0x03,0x89,0x63,0x33,0x80,0x8A,0x20,0x11,0x74,
+0x25,0x90,0xA9,0x0A,0x22,0x32,0x14,0xBA,0x1A,0x53,0xA1,0x8A,0x09,0x63,0xA1,0x9F,0x40,0x14,0xEB,0x9C,0x18,0x21,0x12,0x90,0xB9,0x9C,0x81,0xAC,0x73,0x04,0xB9,0xAA,
+0x00,0x00,0x88,0xA9,0xCC,0xA9,0xB9,0x1A,0x11,0xAA,0xDF,0x9B,0x00,0x88,0xA8,0xCC,0x2A,0x16,0xB8,0xAC,0x21,0x03,0xCD,0x19,0x54,0x82,0x9A,0x00,0x10,0x01,0xBA,0xEB,
+0x9C,0x29,0x33,0xB0,0xAC,0xDA,0xDD,0x9A,0x10,0xB1,0xBD,0xCA,0xCD,0xAA,0x89,0x08,0xA8,0xA9,0x09,0x53,0x02,0xA8,0xBC,0x8B,0x53,0x01,0x0A,0x32,0xB2,0x8B,0xF9,0xBF,
+0x58,0x26,0x98,0x89,0x00,0x02,0x80,0xC8,0x9B,0x00,0xCA,0x30,0x23,0x82,0x52,0x83,0x9C,0x44,0xA3,0xCF,0x99,0x88,0x80,0x00,0xB0,0x9E,0x00,0x00,0x42,0x24,0x91,0xAA,
+0x52,0x25,0xA0,0x9A,0x10,0x81,0x9A,0x32,0x34,0x04,0x89,0x22,0x73,0x24,0xB8,0x9B,0x73,0x27,0x33,0x01,0x9A,0x61,0x14,0x80,0x08,0x01,0x02,0x11,0x25,0x32,0xA1,0x9B,
+0x14,0x89,0x74,0x14,0xB9,0x0C,0x13,0x00,0x22,0x82,0xBF,0x0A,0x44,0xB0,0xAD,0x88,0x18,0x21,0x12,0xA8,0x49,0x34,0x91,0xBA,0xDA,0xAC,0x28,0x43,0x34,0x90,0x8A,0x23,
+0x30,0x47,0x22,0x22,0x30,0x37,0x13,0x10,0xA8,0x1B,0x06,0xCA,0x20,0xA9,0x0A,0x52,0x94,0x9C,0x00,0xEC,0x9B,0x80,0xFA,0xAC,0x98,0xDB,0x8B,0x01,0x80,0x99,0xB9,0xAC,
+0x40,0x82,0xEC,0x9A,0x88,0xA8,0x8A,0xB8,0x8A,0x00,0x52,0x24,0x01,0x20,0x18,0x53,0x55,0x43,0x43,0x21,0x91,0x18,0x45,0x43,0x81,0x89,0x21,0x34,0x13,0x11,0x00,0xF9,
+0xAD,0x18,0x82,0xAA,0x19,0xC9,0xAB,0x40,0x31,0x63,0x33,0xC0,0x1B,0x47,0x32,0x80,0x28,0x80,0x10,0x22,0x12,0x54,0x36,0x02,0xDB,0xAA,0x89,0x21,0x80,0x8A,0x58,0x37,
+0xD8,0x9C,0x80,0x00,0xA9,0x08,0x08,0x31,0xF9,0xBB,0x08,0x32,0xC8,0xBE,0xAA,0x9A,0x28,0x83,0x89,0xFF,0x9B,0x89,0x11,0x98,0x98,0xBB,0xCE,0x09,0x01,0x81,0xCA,0xCB,
+0x0C,0x21,0x91,0xAE,0x99,0x88,0xDA,0xAC,0xB9,0x9A,0x10,0x43,0xA3,0xCF,0x9B,0xA9,0x30,0x34,0x82,0x90,0x63,0x92,0xAA,0x40,0x23,0xBB,0x74,0x12,0x21,0x21,0x92,0x9A,
+0x99,0xFB,0x8C,0x11,0x41,0xB1,0x8B,0xD9,0x0A,0xC0,0x9B,0x18,0x30,0x98,0xF9,0x9C,0x01,0xFB,0xAC,0x8B,0x20,0x43,0x13,0x88,0x12,0xE9,0xAB,0xBA,0x8A,0x02,0x1B,0x67,
+0x43,0xA2,0xAD,0x8A,0x62,0x24,0x80,0xA9,0x19,0x34,0x02,0x98,0x0A,0x45,0x81,0x20,0x08,0x20,0xCB,0x8B,0xA9,0xAA,0xBE,0x1A,0x92,0x9C,0xB9,0x2A,0x56,0x34,0x41,0x26,
+0x91,0xBA,0x19,0x42,0x34,0x23,0x00,0x98,0x0A,0x67,0x12,0x00,0x10,0x53,0x80,0x10,0x32,0x83,0x50,0x14,0x12,0x63,0x03,0x89,0x88,0x01,0x09,0x74,0x34,0x21,0x00,0x80,
+0x99,0x08,0xE8,0x9B,0x22,0x73,0x04,0x99,0xA9,0x9B,0xA1,0xAF,0x20,0x01,0x82,0xBC,0x8A,0xEA,0xCC,0x9C,0x08,0x20,0x33,0x01,0x88,0x90,0x89,0xDD,0x9B,0xA8,0x00,0x90,
+0x11,0x9B,0x9A,0xD8,0xCD,0x29,0x27,0x02,0x99,0x99,0x1A,0x22,0xB0,0xBE,0x28,0x35,0x26,0x80,0xCA,0x8A,0x10,0x53,0x90,0xAB,0x8C,0xA9,0xDA,0xBA,0x9A,0x43,0x92,0xCF,
+0x18,0xA9,0xCF,0xAB,0x89,0x90,0xAA,0xDA,0xCB,0x9B,0x09,0x98,0x8B,0x18,0x11,0x80,0x55,0xA2,0xEF,0x8A,0x10,0x11,0x21,0x43,0xA1,0xCE,0x9A,0x28,0x22,0x32,0x10,0x08,
+0xBC,0xDD,0xAA,0x88,0x88,0x08,0xB9,0xCB,0xCC,0x08,0x98,0x18,0xB9,0x19,0xFA,0xAC,0xBB,0xCB,0xBA,0xBD,0x9B,0x10,0x62,0x43,0x91,0xAB,0x88,0x18,0x24,0x89,0x31,0x02,
+0x08,0xB8,0xF0,0x8B,0x76,0x23,0x22,0x33,0x44,0x24,0x23,0x02,0x31,0x14,0x81,0xD8,0x0A,0x34,0x23,0x31,0x77,0x12,0x11,0x33,0x01,0x10,0x08,0x31,0x91,0xAB,0x2A,0x56,
+0x13,0x90,0xDC,0x8B,0x40,0x24,0x34,0x13,0xB9,0xAF,0x28,0x24,0x12,0x80,0x00,0x81,0x9A,0x39,0x33,0x20,0x26,0x13,0x08,0x73,0x98,0x89,0xFB,0xBB,0x8B,0x30,0x21,0x32,
+0x84,0xE9,0xCC,0x09,0x18,0x48,0x33,0xD8,0x8A,0x80,0x9B,0xBB,0xAE,0x08,0x91,0xE8,0x9D,0x53,0x92,0xAC,0x19,0x43,0x93,0x8B,0xDB,0x9C,0x42,0x54,0x81,0xCA,0xBB,0x19,
+0x12,0x01,0xAA,0xCB,0xA9,0x8C,0x41,0x02,0x01,0xFB,0x9E,0x18,0x45,0x02,0x90,0xB9,0xAA,0x89,0xA0,0x9A,0x10,0x55,0x34,0x33,0x02,0x89,0x29,0x01,0x18,0xA2,0xFF,0x98,
+0x18,0xA8,0x8B,0xDA,0xAD,0x98,0x88,0x08,0x51,0x81,0xBB,0xBB,0x19,0x62,0x23,0xB9,0xBE,0xBA,0x8B,0x32,0x32,0x23,0x08,0x3B,0x03,0xFF,0xBB,0xB9,0xB9,0xAB,0x72,0x03,
+0x62,0x24,0x98,0xBA,0x1D,0x63,0x33,0x13,0x9A,0x98,0x21,0x28,0xBA,0x9C,0x0A,0xDA,0x89,0x22,0x32,0x63,0x43,0x03,0x0C,0x21,0xDA,0xEF,0xAB,0x89,0x11,0x00,0xEA,0xAB,
+0x51,0x42,0x01,0x88,0x98,0x00,0x31,0x14,0xB0,0x0B,0xA1,0xED,0xAA,0x41,0x34,0x00,0x22,0x90,0xDB,0xEB,0xAB,0x00,0x18,0x31,0x02,0xBA,0x0C,0x37,0x33,0x44,0x02,0xAB,
+0xAA,0x99,0x08,0xA8,0xFA,0xCD,0xCB,0xBB,0xAB,0x10,0x30,0x03,0xCB,0xBA,0x0A,0x22,0x38,0x48,0x77,0x23,0xA0,0x9B,0x9D,0x01,0x41,0x43,0x22,0x34,0x11,0x10,0x99,0x52,
+0x05,0x81,0x22,0x80,0xC9,0xBC,0x89,0x63,0x24,0xC9,0xCC,0x9B,0x01,0x10,0x22,0x23,0xD0,0xAB,0x19,0x33,0x46,0x15,0x90,0x89,0xAA,0xCB,0xBD,0xAA,0x99,0x8A,0x13,0x12,
+0x72,0x37,0x33,0x13,0x90,0xBB,0x39,0x57,0x02,0x98,0xAB,0xAB,0xAB,0xCB,0xAB,0x99,0x51,0x91,0xBE,0xBB,0xAA,0x9C,0x20,0x91,0xA9,0xB2,0x0A,0x38,0x67,0x25,0x22,0x12,
+0x33,0x91,0xEB,0x41,0x12,0x90,0x0B,0x0A,0x62,0x36,0x02,0x18,0x90,0xC9,0xAA,0xA9,0x10,0x65,0x01,0x99,0xAA,0x9A,0x10,0x32,0xFB,0xAF,0x09,0x32,0x24,0x02,0x90,0xB9,
+0x20,0x21,0x80,0x0B,0x08,0x08,0x35,0x77,0x33,0x11,0xB0,0xAA,0x19,0x47,0x90,0xBD,0x9B,0x89,0x19,0x35,0x11,0x31,0x77,0x12,0x11,0x11,0x00,0xA8,0x88,0x08,0x22,0xB1,
+0xAF,0xAC,0x21,0x33,0x91,0xEC,0xBC,0x9C,0x08,0x80,0xA0,0xEC,0xBA,0x9B,0x80,0xA8,0x20,0x43,0x91,0xCC,0x8A,0x22,0x34,0x43,0x42,0x32,0x23,0x80,0xC9,0x0D,0x32,0x03,
+0x28,0x47,0x12,0xA1,0xCA,0xBA,0x0B,0x45,0x81,0x18,0x34,0x90,0xCA,0xCD,0xCB,0x9B,0xA9,0xBD,0x9A,0xA0,0xBA,0xAC,0x20,0x33,0xA9,0xB2,0xDD,0xAD,0x11,0x02,0x32,0x11,
+0x42,0x82,0x40,0xA0,0x70,0x92,0x9C,0x00,0x51,0x02,0x18,0xE0,0xAD,0xAA,0x32,0xC2,0xDF,0xAB,0x09,0x00,0x80,0xC9,0x9C,0x88,0x89,0x10,0x22,0x91,0xCF,0x09,0x18,0x21,
+0x31,0xC8,0xBF,0x0A,0x80,0x98,0x11,0x41,0x14,0x98,0x9B,0xA9,0xC9,0xAE,0x9E,0x09,0x20,0x31,0x13,0x98,0xAC,0x0A,0x73,0xA0,0x9C,0x18,0x34,0x82,0x30,0x23,0x80,0x55,
+0x31,0x41,0x46,0x03,0xB9,0xAA,0xAB,0x3B,0x45,0x33,0x43,0x44,0x22,0xA9,0x8A,0x31,0x15,0x11,0x80,0x32,0x26,0xA8,0x9C,0x58,0x15,0x91,0x61,0x24,0x33,0x34,0x12,0x81,
+0x99,0x21,0x73,0x43,0x02,0x98,0x99,0x21,0x73,0x14,0x02,0x11,0x10,0x98,0x88,0x01,0x9C,0xAD,0x80,0x62,0x24,0x80,0xA0,0xEA,0xBB,0x09,0x41,0x91,0xA8,0xBD,0x0A,0x34,
+0x42,0x52,0x02,0xFA,0xAB,0x9A,0x20,0x13,0x34,0x02,0xAA,0x0A,0x43,0xC0,0xDA,0xAC,0xAA,0xCC,0xA9,0xB9,0xBA,0x80,0xC9,0xF9,0xBC,0x9B,0x20,0x22,0xA8,0xBA,0xFC,0xBF,
+0x99,0x08,0x00,0x81,0xC9,0x9C,0x10,0x08,0xAA,0xBD,0x9A,0xAB,0x1A,0x31,0x77,0x02,0x10,0x00,0x08,0x88,0x08,0x32,0x31,0x20,0x72,0x24,0xA9,0x5B,0x43,0x42,0x24,0x12,
+0xEB,0xAC,0x09,0x21,0x33,0x02,0xEC,0x8B,0x00,0x22,0xA8,0xBB,0xA9,0xBA,0xCE,0x19,0x81,0xCC,0xCB,0x19,0x53,0x34,0x02,0xAA,0x9B,0x51,0x45,0x02,0xA9,0x9A,0x9B,0x18,
+0x55,0x33,0x63,0x13,0x90,0xAA,0x88,0x01,0xC8,0xCB,0x99,0x21,0x43,0x44,0x84,0xB8,0xAB,0x89,0xEB,0xBA,0x9B,0x9C,0x99,0x8A,0x19,0x45,0x22,0xFA,0x9A,0x89,0x99,0x99,
+0xCD,0xAA,0x18,0x01,0x48,0x11,0xC0,0xBF,0x9B,0x11,0x00,0x9A,0xC9,0x73,0x24,0x33,0x82,0xB0,0xBA,0x10,0x24,0x28,0x42,0x84,0x82,0x0A,0x32,0xF0,0xAD,0x80,0x80,0x91,
+0xED,0xCB,0xBB,0x89,0x32,0x54,0x32,0x11,0x08,0x08,0x81,0xA0,0x9D,0xCD,0xBE,0xBE,0x89,0x11,0x08,0x99,0xBA,0xAB,0x19,0x09,0x9C,0x32,0x14,0x61,0x12,0x01,0x88,0x14,
+0x64,0x53,0x24,0x13,0x10,0x81,0x90,0x8A,0x01,0xBA,0xCD,0xBF,0xBA,0x89,0x18,0x82,0x10,0x11,0x00,0x52,0x93,0xFA,0x89,0x21,0x98,0x88,0x73,0x36,0x22,0x91,0xEB,0x8A,
+0x01,0x81,0x11,0x36,0x14,0x01,0x21,0x11,0x81,0x10,0x37,0x90,0x00,0x08,0x28,0x24,0x80,0xB0,0x56,0x12,0x62,0x22,0x12,0xA8,0x9D,0x10,0x08,0x71,0x23,0x00,0x19,0x41,
+0xA1,0x00,0xA1,0xCF,0x9B,0x28,0x33,0x64,0x32,0x23,0x12,0xA3,0xF9,0xBB,0xBA,0xDD,0xAC,0xAB,0xBA,0x89,0x22,0x33,0x98,0x82,0x08,0xBB,0x43,0x30,0x43,0x36,0x42,0x64,
+0x33,0x33,0x32,0x31,0x21,0x80,0x55,0x25,0x02,0x01,0x88,0x32,0x14,0x14,0x13,0xA9,0x0B,0x0B,0x48,0x03,0x08,0xBD,0xFF,0xAB,0x08,0x90,0xCC,0xCD,0x9A,0x80,0x0A,0x89,
+0x19,0x41,0x35,0x32,0x12,0x81,0x00,0x48,0x27,0x25,0x12,0x08,0x08,0xB9,0xBA,0xBF,0x99,0xBB,0xAA,0x09,0x53,0x31,0x45,0x01,0x98,0xFA,0x9A,0x10,0x90,0x89,0x30,0x46,
+0x93,0xCC,0xBA,0x10,0x11,0xEB,0xCC,0xBA,0xAA,0x89,0x80,0xDA,0xCD,0xBB,0xA9,0x08,0x81,0x90,0x89,0x80,0x89,0x80,0xB3,0xDF,0xCC,0x08,0x43,0x00,0xAB,0x09,0x31,0x25,
+0xA0,0xEC,0xCB,0x8A,0xBA,0xBD,0xCB,0x9A,0x21,0x42,0x12,0x98,0x80,0x52,0x81,0x21,0xBA,0x9D,0x21,0x03,0xF0,0xAF,0x99,0xA9,0x99,0x98,0xCB,0x9A,0x89,0x12,0x52,0x03,
+0xAA,0x20,0x56,0x32,0x55,0x22,0x33,0x35,0x23,0x11,0x11,0x10,0x80,0x56,0x11,0x8A,0x99,0x89,0x99,0x2A,0x42,0x04,0x28,0x22,0x32,0x43,0x45,0x15,0xB9,0xA0,0xC9,0x19,
+0x57,0x34,0x22,0x21,0x12,0x31,0x02,0xD9,0xCD,0x9B,0x09,0x41,0x12,0xB8,0xBC,0x09,0x34,0x33,0x22,0x15,0x11,0x33,0x74,0x13,0x01,0xA8,0x09,0x64,0x22,0x11,0x01,0x33,
+0x11,0xD9,0xBE,0xBC,0x9B,0xA9,0xFB,0xAA,0x98,0x08,0x10,0x91,0xA9,0x80,0x57,0x34,0x11,0x99,0xBB,0x1A,0x31,0x26,0x00,0x08,0x18,0x04,0x9C,0xA9,0xC9,0x0C,0x53,0x63,
+0x01,0x98,0xCB,0xAB,0xEB,0xAA,0x09,0x31,0x34,0x14,0x42,0xC9,0xBC,0xBC,0x8C,0x89,0xA9,0xB9,0xAC,0x00,0x32,0x34,0x08,0x28,0x40,0x27,0x01,0x31,0x31,0x03,0xA8,0xCD,
+0xAA,0x40,0x13,0x34,0x23,0x44,0xD8,0xBC,0xBB,0x9A,0x08,0x41,0x91,0xEE,0xBB,0xCB,0x9A,0x11,0x24,0x02,0x62,0x24,0x82,0x89,0x00,0x11,0x08,0x58,0x34,0x37,0x12,0x10,
+0x9A,0x19,0x11,0xA0,0xAB,0x80,0xBA,0x80,0xEC,0x89,0xC8,0x9C,0xA8,0xFC,0xBA,0xAA,0x18,0x31,0x14,0xB1,0x2A,0x32,0x63,0x63,0x53,0x43,0x43,0x12,0x9A,0x19,0x31,0x24,
+0x12,0x90,0xBC,0x9A,0xBD,0xDC,0xBE,0xAA,0x08,0x89,0xBA,0x9A,0x10,0xB8,0xBF,0xEB,0xBA,0xBB,0xBA,0xBD,0x9A,0x18,0x11,0x80,0x0A,0x20,0x60,0x23,0xFA,0xAB,0x08,0x34,
+0x24,0x83,0xA9,0x89,0x8A,0x63,0x80,0xAA,0xCF,0xAD,0x88,0x29,0x12,0x99,0xFB,0xDB,0xAA,0x08,0x20,0x10,0xBA,0xAD,0x51,0x35,0x03,0x10,0x18,0x20,0x53,0x82,0xB9,0x9C,
+0x08,0x21,0xDA,0x9B,0x2A,0x27,0x52,0x13,0x42,0x31,0x44,0x21,0x98,0x99,0x82,0x80,0xDC,0xBA,0x99,0xA8,0x89,0x23,0x73,0x25,0x42,0x43,0x52,0x32,0x52,0x33,0x12,0x32,
+0x46,0x33,0x11,0x90,0x1A,0x24,0x25,0x93,0xBB,0xBC,0x09,0x81,0xFB,0xBB,0x19,0x22,0x44,0x02,0xCA,0xBD,0xCA,0xCB,0xBA,0xAA,0x88,0x00,0x32,0x01,0x8A,0x00,0xC3,0xFA,
+0xAC,0x9B,0x89,0x54,0x92,0x99,0xBD,0x19,0x33,0x63,0x02,0x9B,0x28,0x73,0x16,0x80,0xBA,0xBB,0x9B,0x52,0x24,0x90,0xBA,0xAE,0x08,0x00,0x98,0xBC,0xBC,0xBC,0x18,0xB8,
+0xFB,0xBB,0xAC,0xA9,0x80,0x21,0x11,0x00,0xAB,0xFB,0x10,0x21,0x52,0x33,0x36,0x04,0x98,0xAB,0x0A,0x21,0xDA,0x19,0x52,0x08,0xAA,0xAA,0xFB,0x9B,0x82,0x14,0x74,0x23,
+0x32,0x22,0x24,0x12,0x18,0xA0,0x9C,0x21,0x55,0x82,0xBA,0xA9,0x49,0x55,0x92,0xEA,0xAA,0x08,0x30,0x23,0x91,0xCB,0xAA,0x80,0x20,0x08,0x33,0x00,0xBD,0x08,0xBD,0xBB,
+0xEC,0xCB,0xCB,0x09,0x41,0x53,0x15,0x91,0x89,0x08,0x51,0x12,0x21,0x35,0x37,0x33,0x82,0x81,0x09,0x99,0xBA,0x0B,0x53,0x14,0xC0,0xA9,0xA9,0x22,0x16,0x82,0xFA,0xAB,
+0xAC,0xBB,0x99,0xCC,0x99,0xAA,0xAD,0xCC,0xBB,0x8A,0x30,0x11,0x80,0x83,0x16,0x55,0x43,0x22,0x21,0x10,0x31,0x35,0x33,0x33,0x55,0x12,0x98,0x09,0x11,0xA0,0x8A,0xBA,
+0x80,0xB4,0x88,0xBC,0x73,0x83,0xCD,0xBE,0xBB,0x0A,0x20,0x91,0xCD,0x9A,0x18,0x54,0x33,0xA8,0xA9,0xDB,0x9A,0x00,0x88,0xDB,0x99,0x48,0x45,0x03,0x81,0x99,0x9B,0xAA,
+0x3A,0xB8,0x0C,0x80,0xD0,0xB0,0x33,0x85,0x03,0x84,0xCB,0x0F,0x9A,0xBC,0xAD,0x0B,0x21,0x21,0x80,0xEE,0x9C,0x08,0x21,0xA8,0xA9,0x00,0x01,0x80,0xC0,0xBF,0x0B,0x21,
+0xA8,0xAB,0x8B,0xEC,0xAD,0xBC,0xAC,0x8C,0x89,0xBB,0xBF,0xBB,0x08,0x20,0x21,0x9A,0xBC,0xCB,0x0A,0xA0,0x82,0x60,0x82,0x82,0x33,0x57,0x24,0x82,0x90,0x99,0x9A,0xAA,
+0xB0,0xB0,0x3C,0x80,0x40,0x17,0x80,0x80,0xB0,0xFB,0xAD,0x9A,0x31,0x26,0x15,0x01,0x10,0x14,0x43,0x13,0x31,0x01,0x2A,0x58,0x53,0x32,0x33,0x55,0x22,0x34,0x12,0x12,
+0x34,0x43,0x11,0x89,0x80,0x20,0x45,0x24,0x11,0x11,0x32,0x23,0x68,0x21,0x9C,0x28,0x22,0x08,0xCB,0x80,0xCB,0x80,0x80,0x08,0x45,0x36,0x24,0x08,0x31,0x15,0x34,0xA2,
+0xDE,0x9C,0x88,0x11,0x31,0x32,0x83,0xA0,0x80,0x83,0x8B,0x80,0x80,0xBE,0xEF,0x99,0x08,0x81,0x89,0xAA,0xB0,0xCB,0x00,0x0C,0xFB,0xEB,0xA9,0x9B,0x09,0x80,0xCC,0xBC,
+0x9B,0xA9,0xC9,0x08,0x28,0x03,0x33,0x40,0x03,0xCC,0xFA,0x99,0xAA,0xB9,0xBA,0x03,0x0C,0xAC,0x08,0xFC,0xCB,0xAB,0x9A,0x08,0xD8,0xCB,0x8B,0x40,0x63,0x32,0x24,0x99,
+0x99,0xEB,0x99,0x21,0x81,0xF9,0xBB,0xBB,0x29,0x68,0x23,0x01,0x9A,0x9C,0x9A,0xA8,0x08,0xCB,0xEB,0x89,0x0A,0x38,0x33,0xB4,0xDF,0xBC,0x09,0x31,0x81,0x80,0x80,0x33,
+0x57,0x43,0x14,0x80,0xAA,0x19,0x53,0x33,0x24,0x12,0x21,0x41,0x21,0x03,0x32,0x63,0x03,0xD0,0x89,0x40,0x43,0x21,0x48,0x24,0x12,0xA2,0x9D,0xCB,0x9A,0x2A,0x80,0x80,
+0x8B,0x8C,0x84,0x24,0x17,0x21,0x12,0x23,0x30,0x43,0x43,0x32,0xB0,0x08,0x08,0xF8,0xC0,0x30,0x73,0x82,0xA0,0xBB,0xC0,0xB0,0x0C,0x8B,0x80,0xD0,0xBF,0xAE,0x9A,0x18,
+0x43,0x98,0xCD,0xBA,0xA9,0x00,0x08,0xFA,0xAD,0x99,0xA9,0x9A,0x09,0x21,0x22,0x62,0x91,0xAA,0xAA,0xB8,0xB8,0xBD,0x0E,0x28,0x44,0x21,0x21,0xAA,0xDF,0xAB,0x0A,0x08,
+0x0A,0xCA,0x9C,0x99,0x21,0x35,0x43,0x03,0x01,0x55,0x32,0xA0,0xB9,0xBC,0x8B,0x72,0x13,0xB0,0x8B,0x20,0xD8,0x0A,0x02,0xB8,0x8B,0x40,0x43,0x17,0x93,0xFA,0x8A,0x38,
+0x24,0x14,0x90,0x99,0xAB,0x0A,0xB8,0x03,0xD0,0x80,0x70,0x23,0x24,0x21,0x83,0xB8,0x8B,0x3C,0x27,0x08,0x52,0x32,0x02,0x08,0x03,0x03,0x04,0x08,0x08,0x36,0x34,0x37,
+0x25,0x13,0x80,0x10,0x23,0x56,0x12,0x11,0x08,0xAA,0xBA,0x9E,0x0A,0x0A,0x0B,0x38,0x34,0x24,0x43,0x83,0xFB,0xAE,0x8C,0x09,0x99,0x89,0x32,0x73,0x23,0x43,0x11,0x11,
+0x01,0x0A,0x0B,0xCB,0x0B,0xCB,0xCB,0x3A,0x48,0x33,0x34,0xC0,0xBE,0xAC,0x09,0xA8,0xAD,0xFB,0x09,0x22,0x12,0x98,0x0D,0x08,0x08,0x08,0xB8,0xC0,0x80,0x84,0xCB,0xCB,
+0xCD,0xDB,0x9A,0x9A,0x12,0x25,0x82,0xBB,0xAA,0xFB,0xAC,0xCB,0xAA,0x08,0x21,0x34,0x02,0xFA,0xCC,0xA9,0xA9,0x99,0xBB,0xA9,0x22,0x62,0x21,0x82,0x32,0x33,0xB8,0xBD,
+0x73,0x25,0x12,0x53,0x33,0x26,0x01,0x01,0x00,0x31,0x12,0x17,0x00,0x08,0x98,0x8A,0x20,0x30,0x30,0x85,0x43,0x36,0x43,0xA0,0xCA,0xCB,0xC9,0x99,0xCB,0xCB,0x99,0x10,
+0x24,0x33,0x82,0xB0,0x0C,0x33,0x34,0xC0,0xF0,0x9A,0x08,0x32,0x45,0x03,0x91,0xDB,0xA9,0x28,0x36,0x81,0xA0,0x80,0x08,0x03,0xD8,0xAE,0x89,0x50,0x41,0x12,0x80,0x80,
+0xB3,0xC8,0xBB,0xBC,0x08,0x08,0xFD,0x0A,0x10,0x37,0x34,0x00,0x81,0x82,0xBB,0xEC,0xAA,0xA0,0x99,0xAA,0xBA,0xDF,0xBB,0x0A,0x98,0xDB,0x9C,0x9A,0xB9,0x9B,0xAA,0x8A,
+0x30,0x07,0xA1,0xAA,0x63,0x25,0x98,0xBB,0xA9,0x20,0x37,0x12,0xA0,0xFB,0xAA,0x18,0x11,0x21,0x44,0x22,0x61,0x32,0x13,0x01,0xBC,0x89,0x08,0x62,0x21,0x82,0x80,0x08,
+0xF8,0xBA,0xBA,0x3A,0x33,0x40,0xB4,0xBF,0xBB,0x2A,0x72,0x43,0x22,0x12,0x32,0x36,0x25,0x10,0x90,0xB9,0x19,0x42,0x63,0x34,0x11,0x12,0x82,0x0A,0x9C,0xAA,0xBA,0x83,
+0x84,0x73,0x32,0x12,0xB3,0x0B,0x08,0xD8,0x03,0xD0,0xBB,0xDF,0xAA,0x8A,0x89,0x02,0xB8,0xED,0xA9,0xBA,0xC9,0xB9,0xCB,0xC9,0xB9,0xC9,0xEB,0xA9,0x08,0x81,0x89,0x80,
+0xDB,0xAE,0xBB,0x09,0x28,0x28,0x30,0x48,0xBB,0xBC,0xBB,0xBC,0x8B,0x80,0x05,0xC8,0xF8,0xDD,0x99,0x11,0x12,0x08,0x28,0x54,0x34,0x43,0x01,0x09,0x80,0x21,0x22,0x16,
+0x13,0x00,0x08,0xB8,0xCB,0xFB,0x08,0x08,0x44,0x41,0x81,0xA0,0xAA,0x0B,0x43,0x32,0x27,0x63,0x22,0x52,0x20,0x01,0x91,0xAA,0x0C,0x21,0x00,0x72,0x43,0x13,0x41,0x22,
+0x01,0x08,0xB2,0x03,0x34,0x43,0x37,0x44,0x23,0x11,0x00,0xA8,0x80,0x0B,0xEC,0xD9,0x9A,0x9A,0xA9,0x0A,0xBB,0xDE,0xCA,0xA9,0x99,0xA9,0x9C,0xC9,0xAD,0x9A,0x01,0x28,
+0x08,0xBB,0xFB,0x19,0x22,0x08,0xB8,0x80,0x44,0x45,0x03,0x08,0x08,0x08,0x03,0x34,0x84,0x24,0x47,0x32,0x81,0x89,0x0C,0x53,0x22,0x21,0xAA,0x0B,0x43,0x25,0x22,0x80,
+0x03,0x37,0x34,0x26,0x14,0x12,0x98,0x99,0xBC,0xBB,0x0A,0x2A,0x70,0x33,0x01,0xA8,0xBB,0x30,0x74,0x13,0x08,0xAA,0x08,0x48,0x38,0xC0,0xBB,0xCF,0xB9,0x80,0x22,0x25,
+0x53,0x98,0x0A,0x20,0x0B,0xFB,0xBD,0x9C,0x1A,0x50,0x21,0x31,0x81,0x80,0x02,0xEB,0xFB,0xBA,0xAA,0xBB,0xBE,0xAB,0xAA,0xA9,0xBB,0xDC,0xAB,0x99,0xA9,0xA9,0xB8,0xBA,
+0xFF,0xAB,0x88,0x81,0x90,0xCB,0x99,0x89,0x38,0xB2,0xBB,0x0C,0xAF,0xA9,0x0A,0xBB,0xDE,0xAD,0x9A,0x09,0x18,0xA0,0xBB,0x00,0xB2,0xFB,0xAC,0x0A,0x28,0xA2,0xB8,0x0C,
+0x30,0x84,0x43,0x80,0x34,0x43,0x33,0x0B,0x74,0x16,0x42,0x11,0x10,0x33,0x25,0x22,0x31,0x22,0x52,0x63,0x43,0x41,0x31,0x22,0x11,0x33,0x22,0x20,0x33,0x03,0x04,0xEC,
+0xCB,0x08,0x28,0x32,0x63,0x15,0x10,0x11,0x22,0x80,0x08,0x08,0xBD,0x30,0x74,0x11,0x82,0xB0,0x30,0x26,0x23,0xB3,0x0B,0xBC,0x0B,0x0C,0x3C,0x43,0x83,0xC0,0x80,0x84,
+0x43,0x43,0x38,0x37,0x14,0x08,0xAA,0x80,0x33,0x03,0x04,0x08,0x80,0x60,0x43,0x78,0x12,0xA0,0xAB,0x83,0xB4,0xB8,0xC8,0xFB,0x9C,0x80,0xA0,0xBA,0x80,0x8B,0xBF,0x9C,
+0xA8,0xBA,0x8A,0x30,0x74,0x12,0x80,0x80,0xFB,0x99,0x9A,0xBA,0x9D,0x08,0x82,0xEB,0x9A,0xAA,0x02,0x48,0x38,0x80,0xD0,0xBE,0x88,0x35,0x03,0x02,0xB8,0xC0,0x80,0x80,
+0x00,0x8D,0x34,0x80,0xCC,0xCD,0xAD,0x09,0x01,0x01,0xB2,0xEA,0x89,0x42,0x21,0x22,0x33,0x48,0x02,0xC0,0xFB,0x9A,0xAA,0xAC,0x80,0x33,0x38,0x0B,0xD8,0xCB,0xFB,0x0A,
+0xA0,0x08,0xE8,0x9A,0xAA,0x38,0x78,0x23,0x21,0x35,0x32,0x32,0x02,0x48,0x78,0x31,0x23,0x22,0x83,0x73,0x23,0x12,0x00,0xBB,0x48,0x33,0xD0,0x80,0x8B,0x00,0x08,0x78,
+0x73,0x12,0x82,0x0A,0x38,0x30,0x00,0xCD,0xBA,0x38,0x35,0x33,0x80,0xBD,0xCB,0x80,0xD0,0xBB,0x8B,0x44,0x02,0xFB,0xBE,0x99,0x08,0x08,0x21,0x32,0x16,0x14,0x11,0x22,
+0x20,0x80,0xC0,0xC0,0xBA,0x88,0x0C,0x0C,0x08,0xD8,0x80,0xBC,0xFB,0x0C,0x0A,0x80,0xBA,0x9E,0x0A,0x0A,0xBB,0xFB,0xA0,0x22,0x82,0xF0,0x9B,0xAB,0x0A,0x38,0x08,0xBC,
+0xC0,0xCB,0xCD,0x89,0x2A,0x23,0x83,0xCB,0xFB,0xAB,0x89,0x32,0x33,0x37,0x12,0x24,0x28,0x80,0x83,0x30,0x44,0x02,0x80,0x80,0x35,0x34,0x80,0x0C,0x0C,0xBC,0xBE,0x9C,
+0x9C,0xA0,0x20,0x58,0x82,0x22,0x30,0x38,0x34,0x24,0x00,0x08,0x3D,0x80,0x85,0x03,0x34,0x43,0x08,0x08,0x0D,0x08,0x0D,0x8B,0x80,0x44,0x03,0xFC,0x9C,0x09,0x98,0x08,
+0xB8,0x00,0x48,0x73,0x01,0x82,0x20,0x30,0x08,0x0D,0xCB,0x0B,0x80,0x04,0x03,0x85,0x84,0x03,0x08,0xBD,0x80,0x40,0x84,0xCB,0xBB,0xFC,0xB9,0xA9,0xA8,0x83,0x17,0x98,
+0xA8,0x00,0x32,0x40,0x03,0xBC,0xAC,0xFB,0x9A,0x0A,0x38,0x72,0x01,0xC8,0x99,0xA8,0x20,0x33,0x03,0x44,0xB2,0xF0,0x9A,0x8A,0x20,0x30,0x40,0x84,0x43,0x72,0x11,0x82,
+0x02,0xEB,0xBB,0x9C,0xCA,0x99,0x88,0x55,0x22,0x31,0x81,0x80,0x83,0x33,0x43,0x33,0x34,0xCB,0xBE,0xAA,0x32,0x72,0x31,0x84,0x91,0x80,0x20,0x33,0x37,0x32,0x50,0x53,
+0x24,0x01,0xB9,0x89,0x10,0x00,0x08,0xEC,0xBB,0x0A,0x22,0x30,0x30,0x40,0x80,0x85,0x80,0xD0,0x0B,0x08,0x58,0x73,0x42,0x11,0x00,0x08,0x38,0x84,0xC0,0x00,0x08,0xD8,
+0xFB,0xAD,0xBB,0x09,0x21,0x22,0xA2,0xCB,0x0B,0x48,0x26,0x01,0xA8,0xBB,0xAC,0xB8,0xBC,0xAC,0xCB,0xBB,0xC0,0x8B,0xDB,0xF0,0x99,0x9A,0xA8,0x9E,0xAD,0xAA,0x9B,0x98,
+0xA8,0x08,0x08,0x03,0x04,0x34,0x04,0xBC,0xBB,0xBC,0x80,0x8C,0xDB,0x30,0x30,0x44,0x72,0x80,0x28,0x22,0x80,0xBB,0xBC,0x03,0x04,0xF8,0xAB,0x0A,0x80,0x73,0x00,0xBA,
+0x9D,0x08,0x44,0x35,0x22,0x90,0xA8,0x20,0x80,0x0B,0x08,0x37,0x32,0x33,0xB8,0xBD,0x9E,0x8A,0x02,0x16,0x14,0x28,0xA8,0x80,0x08,0x08,0x08,0x85,0x84,0x84,0x43,0x32,
+0x00,0x3D,0x03,0x08,0x80,0x60,0xB8,0xBD,0xBB,0x0C,0x08,0x04,0x03,0x04,0xD8,0x30,0x34,0x73,0x22,0x31,0xB8,0x30,0x34,0xC0,0x80,0x80,0x58,0x70,0x01,0xB0,0x00,0x08,
+0xBC,0x80,0x04,0x03,0xD0,0x08,0x08,0x08,0xBF,0x00,0xBC,0xF8,0x0A,0xAA,0xB0,0x80,0x40,0x03,0xD8,0xBB,0x48,0x24,0x03,0x80,0x80,0xBE,0xC0,0x80,0x80,0x04,0x74,0x01,
+0x80,0x8A,0x80,0x80,0x85,0xC0,0xAD,0x0A,0x38,0x48,0x08,0xC8,0xB0,0xC8,0xDC,0x9C,0x9A,0x8A,0x83,0x03,0x53,0x63,0x01,0xD0,0xA9,0x89,0x08,0x83,0xCB,0xBB,0x08,0x44,
+0x08,0x0C,0x08,0x58,0x08,0x08,0xBD,0x80,0x80,0x05,0xC8,0xAC,0xB8,0x08,0x0D,0x08,0xBD,0xAE,0x00,0x08,0xBB,0x0C,0x80,0x80,0x44,0x08,0x0C,0x08,0xBD,0x30,0x00,0x08,
+0xBE,0xB8,0x08,0x75,0x21,0x08,0x82,0x03,0x08,0x88,0x05,0x48,0x54,0x02,0x08,0x08,0x08,0x88,0xE0,0x80,0xD0,0x80,0x80,0x40,0x40,0xC0,0xCB,0x00,0x03,0x34,0x80,0xBD,
+0x80,0x80,0x05,0xC8,0x08,0x34,0x40,0x84,0x80,0x80,0x08,0x05,0xF8,0xBD,0xA9,0x20,0x38,0x83,0xC0,0xCB,0x30,0x80,0x00,0x8D,0x80,0x50,0x48,0x48,0x72,0x31,0x32,0x32,
+0x62,0x21,0x01,0x80,0x80,0x30,0x44,0x02,0x03,0x40,0x8B,0xD0,0xB8,0xD8,0xBB,0xBC,0x3C,0x03,0x80,0xFF,0x09,0x89,0x01,0x28,0xAA,0xCF,0x89,0x11,0x11,0x21,0x20,0x08,
+0x33,0x34,0x24,0x30,0x0B,0x3D,0x24,0x43,0x83,0x80,0x50,0x48,0x25,0x22,0x25,0x21,0x23,0x30,0xB8,0xBD,0x00,0x03,0x08,0xE8,0xC0,0xCB,0xB0,0x0C,0x30,0x40,0x03,0x0D,
+0xCB,0xBB,0x80,0x50,0x08,0x0C,0x48,0x08,0xC8,0x8B,0xD0,0xC0,0xB0,0x03,0x88,0x35,0x40,0x80,0x00,0xE8,0xBB,0xBC,0xAC,0x08,0x48,0x30,0xD0,0xC0,0x00,0x0C,0x03,0xC8,
+0xAC,0x8B,0xBC,0x30,0x40,0xD0,0xB0,0x48,0x08,0x08,0x08,0x45,0x33,0x04,0xBC,0x0B,0xC8,0x30,0x70,0x81,0xB0,0xFB,0xAB,0xA9,0x38,0x02,0x30,0x80,0x0D,0xBC,0xB8,0xBD,
+0xBB,0x0C,0x0C,0x80,0x80,0x44,0x33,0x00,0x08,0x68,0x17,0x22,0xA8,0xAD,0x89,0x38,0x30,0x08,0xD8,0x80,0x80,0xD0,0x48,0x26,0x23,0x23,0x83,0xC0,0x80,0xD0,0xBB,0x0F,
+0x08,0xD8,0x89,0xAB,0xAB,0xBB,0xB8,0xBD,0x0B,0xBC,0xFB,0xA8,0x80,0x8A,0x80,0x40,0x80,0xB4,0xBC,0x9F,0x0A,0x14,0x14,0x82,0x80,0x00,0x83,0x84,0x80,0x00,0x08,0x08,
+0x78,0x41,0x80,0x8C,0x80,0x80,0x80,0xBF,0x0C,0x8B,0x80,0x50,0x43,0x03,0xF8,0xCB,0xA9,0xA8,0x8A,0x3B,0x84,0x24,0xB0,0x0C,0x0C,0x03,0x48,0x24,0x43,0x83,0xCB,0x80,
+0x64,0x43,0x12,0x10,0x0A,0x33,0x80,0x80,0x50,0x34,0x43,0x43,0x08,0x0C,0x03,0x08,0x08,0x08,0x87,0x24,0x43,0x80,0x80,0x80,0x50,0x80,0x85,0x84,0x30,0x80,0xD8,0xC0,
+0x80,0x80,0x04,0x34,0x07,0x22,0x82,0x30,0x48,0x26,0x21,0x20,0x33,0x54,0x02,0x08,0xBB,0x08,0x34,0x84,0x80,0xBC,0x08,0x58,0x43,0x03,0x58,0xB8,0x80,0x40,0x34,0x43,
+0x80,0xBC,0x80,0x35,0x36,0x00,0x08,0x38,0x80,0xD0,0xBB,0xBC,0xAF,0xA9,0xA0,0x08,0xCB,0x0B,0x0C,0x80,0x0C,0x80,0xD0,0xC0,0xB0,0x08,0xD8,0x9F,0x89,0x89,0xA8,0xFB,
+0x9B,0xAB,0xAA,0x8A,0xCB,0xBA,0x0C,0x8B,0x08,0x80,0x60,0x48,0x08,0xC8,0xCB,0xC0,0x80,0x24,0x03,0x8B,0xBD,0xCB,0x80,0xBC,0xCB,0xBE,0xCA,0x0A,0x0A,0xB8,0xC0,0x80,
+0xCB,0xBB,0x08,0x08,0x08,0x78,0xC0,0x0B,0x0C,0xC8,0x9E,0x8C,0x89,0x20,0x08,0x08,0x08,0x85,0x84,0x03,0x03,0x35,0x43,0x03,0x27,0x01,0x08,0x0B,0x08,0x58,0x03,0xBC,
+0xB8,0x58,0x33,0x04,0x08,0x84,0x34,0x30,0x40,0x84,0x84,0x03,0x78,0x25,0x13,0x22,0x31,0x62,0x21,0x01,0x02,0x3B,0x00,0x84,0x84,0x27,0x21,0x82,0x0B,0xC0,0x80,0x84,
+0x43,0x38,0x24,0x43,0x80,0xCB,0xC0,0x80,0x8B,0xFC,0xA9,0x80,0x02,0x80,0x9F,0x0A,0x28,0x16,0x01,0x01,0x20,0x33,0x27,0x08,0x08,0x8B,0x30,0x80,0xD0,0x08,0x0D,0x8B,
+0xD0,0xB0,0x0C,0x9F,0xA9,0xA0,0x8A,0x9E,0x98,0x8A,0xAB,0x8B,0xC8,0xC0,0x80,0x0C,0xC0,0x80,0x0C,0xCB,0xCB,0x8A,0x8B,0x8C,0x40,0x30,0x04,0x08,0xD0,0x08,0x08,0xE8,
+0x0B,0xBC,0xB8,0xD8,0xBB,0xBC,0x08,0x74,0x23,0x03,0x80,0x80,0x80,0x40,0x80,0xD0,0xB8,0xD8,0x80,0x80,0x80,0x80,0x80,0x77,0x42,0x80,0x80,0x80,0x08,0x0C,0x43,0x32,
+0x34,0x33,0x40,0x24,0x07,0xA1,0x89,0x80,0x0B,0x0C,0x08,0x58,0x83,0x03,0x80,0xBD,0xFC,0x09,0x28,0xA8,0xB0,0x80,0x40,0x08,0x0D,0x8B,0x40,0x43,0x08,0x08,0x80,0x66,
+0x23,0x04,0x08,0x08,0x0B,0xAC,0xB8,0x08,0x08,0x08,0x87,0x80,0x50,0x48,0x02,0x17,0x20,0x08,0x08,0x08,0xBC,0xAC,0x8B,0x03,0x35,0x43,0x80,0x80,0x04,0x58,0x48,0x08,
+0xC8,0x00,0x43,0x80,0x85,0x80,0x80,0x50,0x08,0x08,0xE8,0x80,0xD0,0x80,0xCB,0xBB,0x08,0x04,0x0D,0x08,0x08,0x80,0xBE,0xC0,0x03,0x03,0xB5,0xC8,0xB0,0x08,0xD8,0x8B,
+0x40,0x34,0x43,0xC0,0x80,0x8B,0x0C,0x0C,0x08,0x34,0x27,0x01,0x80,0x80,0x80,0x8C,0xDB,0x0B,0xC0,0xFB,0xAB,0x8B,0xA8,0xBB,0xBC,0x00,0x03,0x08,0x0E,0xBC,0xB0,0xBC,
+0xB8,0xD8,0x0B,0x0C,0x0C,0x48,0x02,0x80,0xD0,0x30,0x70,0x22,0x80,0xBB,0xC0,0x80,0xDB,0xBB,0xCB,0x80,0x80,0x80,0x60,0x73,0x82,0x22,0x30,0x08,0xC8,0x08,0xD8,0xFB,
+0xA9,0x80,0x02,0x83,0x84,0x80,0x80,0x0D,0x08,0x0D,0x08,0x08,0x08,0x08,0x8F,0x8B,0xB5,0x80,0x84,0xB3,0x80,0x0D,0x03,0x08,0x08,0x08,0x09,0x00,0x9F,0x00,0x85,0x84,
+0xC0,0xC0,0xB0,0x43,0x48,0x38,0x30,0x50,0x03,0x08,0x44,0x33,0x04,0x48,0x08,0x08,0x08,0x68,0x43,0x43,0x32,0x00,0x0D,0x03,0x08,0x08,0x08,0x37,0x03,0xD0,0x80,0x0C,
+0x43,0x03,0x58,0x38,0x34,0x33,0x80,0x80,0x80,0x07,0x08,0x0D,0x8B,0x08,0xD0,0x08,0x08,0x08,0x08,0x08,0x17,0x04,0x03,0x44,0x03,0x03,0x04,0x08,0x08,0x08,0x8F,0x0C,
+0x8B,0x8C,0x80,0x80,0x36,0x30,0x80,0xBD,0x08,0x58,0x30,0x40,0x80,0x80,0x36,0x43,0xC0,0xBB,0x80,0x00,0x08,0x0F,0x3B,0x40,0xB8,0xBD,0xBB,0xC8,0xC0,0xCB,0x8A,0x3B,
+0x80,0xBD,0xBC,0x48,0x48,0x38,0xCB,0xC0,0x30,0x30,0xBC,0xC8,0xB8,0xBD,0xB0,0x08,0x0D,0x08,0x84,0x80,0x0D,0x0C,0x80,0x80,0xD8,0xCB,0x8B,0x80,0x85,0x84,0x80,0xD0,
+0x80,0x8B,0x8C,0x80,0x80,0x80,0x70,0xC0,0x30,0xD0,0xB0,0x88,0x85,0x80,0x80,0x80,0xF0,0x0B,0x8B,0x80,0x80,0x80,0xF0,0xAF,0xA8,0x80,0x83,0xC0,0x0B,0x03,0xB4,0x08,
+0x8D,0x40,0x30,0x80,0x05,0x08,0x58,0xC0,0x80,0xD0,0xBB,0x8B,0x40,0xD0,0x30,0x30,0x44,0x08,0x43,0x16,0x24,0x28,0x82,0x20,0x17,0x41,0x08,0x98,0x8A,0x80,0x03,0x0C,
+0x80,0x40,0xD0,0xB0,0x48,0x38,0x34,0xC0,0xC0,0x00,0x03,0xD8,0x8B,0x8B,0x85,0x24,0xB3,0xDB,0xB0,0x48,0x38,0x00,0x58,0x80,0x80,0xE0,0x80,0x3C,0x34,0x33,0xC0,0x08,
+0x58,0x08,0x03,0x0D,0xAC,0x08,0x03,0x0D,0x0C,0x48,0x02,0x80,0xCC,0x00,0x43,0x08,0x08,0x08,0xE8,0x03,0x80,0xE0,0x8B,0x8B,0x80,0x80,0x0F,0xBC,0x0B,0xC8,0x8B,0x80,
+0x80,0x80,0x8F,0x8B,0x80,0x86,0x80,0x0C,0x03,0xD8,0x80,0x40,0x80,0x0D,0x0C,0x80,0x80,0x0D,0xBC,0x00,0x03,0x0D,0x03,0x88,0x80,0x80,0x47,0xB8,0x03,0x58,0x08,0x08,
+0x85,0x24,0x43,0x33,0x80,0x80,0xE0,0x8B,0x8B,0x80,0xB6,0x08,0xD8,0x80,0x84,0x43,0x03,0x53,0x33,0x48,0x08,0x08,0x0D,0x0C,0xCB,0x00,0x48,0xB8,0x0C,0x0C,0x08,0x08,
+0x80,0x36,0x43,0x30,0x80,0xD8,0x80,0x80,0x35,0x00,0x04,0x08,0x08,0xBF,0x0B,0x08,0x85,0x30,0x00,0x85,0x80,0x85,0x84,0x30,0x80,0x08,0x08,0x08,0x09,0x70,0x41,0x8B,
+0x80,0x80,0x80,0x8F,0x8B,0x0D,0x0C,0xC0,0xBB,0xCB,0xBB,0xC8,0xB8,0xBD,0xB0,0x48,0xC0,0xC0,0x00,0x08,0x84,0x84,0x84,0x80,0xD0,0x80,0x03,0x80,0x80,0xBE,0x08,0x0D,
+0x08,0x84,0x80,0xD0,0x08,0x08,0x08,0x86,0xD0,0x80,0x8B,0x85,0x03,0x80,0x04,0x08,0x85,0xD0,0xBB,0x8B,0x50,0x08,0xC8,0x8B,0x3C,0x40,0x30,0x80,0x50,0x34,0x80,0x8C,
+0x8B,0x80,0x80,0x80,0x70,0x85,0x03,0xC8,0xB0,0x08,0x08,0x68,0x70,0x21,0x22,0x00,0x08,0x08,0x0D,0x08,0x88,0x80,0x36,0x00,0x58,0x80,0x44,0x32,0x40,0x08,0xC8,0x80,
+0x80,0x80,0x80,0x90,0xF0,0x09,0x80,0x80,0x07,0x08,0x48,0x40,0x80,0x80,0xE0,0x80,0x80,0xD8,0x80,0x80,0x0D,0xBC,0xAC,0x08,0x08,0x08,0x45,0x48,0x08,0x0C,0x8B,0x80,
+0x08,0xE8,0xC0,0x80,0x84,0x80,0xD0,0x80,0x0C,0x8B,0x8C,0x80,0x80,0x86,0x8B,0xD0,0xC0,0x00,0x08,0x48,0x80,0x80,0x80,0x80,0xF0,0x09,0x50,0x48,0x03,0x08,0xBD,0x08,
+0x08,0x08,0xBF,0x0E,0x8A,0x80,0x80,0x8B,0xCC,0xAD,0xDA,0x09,0x8A,0x02,0x80,0x30,0x40,0x40,0x30,0x80,0x0D,0x08,0xD8,0x80,0x40,0x80,0x85,0x24,0xB0,0xC8,0x08,0x08,
+0x08,0x08,0x08,0x70,0x41,0x43,0x03,0xC8,0xCB,0x8B,0x80,0x85,0xC0,0x0B,0x0C,0x08,0x84,0x84,0x84,0x43,0x38,0x80,0x85,0x80,0x40,0x80,0x80,0x80,0x0E,0x08,0x04,0x08,
+0x08,0x0F,0xB8,0x08,0x50,0x43,0x03,0xC3,0xB8,0xD8,0x80,0x80,0x0D,0xAC,0x08,0x08,0x08,0x05,0x08,0x08,0x86,0x34,0x17,0x20,0x28,0x00,0x38,0x00,0x0D,0x08,0x88,0x80,
+0x80,0x90,0x00,0x00,0x00,0x9F,0x35,0x33,0x40,0x80,0x8C,0x84,0x30,0x00,0x68,0x8B,0x80,0x08,0x08,0xF8,0xB8,0x0D,0x8B,0x80,0x58,0xC0,0x80,0x80,0x0D,0xC3,0x30,0x40,
+0x30,0x50,0x08,0x53,0x38,0x84,0x80,0x80,0x85,0x84,0x80,0x40,0x08,0x58,0x48,0x38,0x80,0x0C,0x0C,0x08,0x84,0x84,0x80,0xD0,0x80,0x80,0x85,0x84,0x03,0x03,0x80,0x80,
+0x80,0x2F,0x00,0x08,0x08,0x08,0xF0,0x0D,0x0B,0x0C,0x08,0xC8,0xCB,0xCB,0xBA,0xC8,0x30,0x80,0x0D,0x0C,0x3B,0x80,0x80,0x86,0x80,0xBC,0x0C,0x3C,0x30,0x40,0x08,0xBD,
+0x00,0x08,0x08,0x08,0x08,0x2F,0xD0,0x80,0x0C,0x80,0x80,0x80,0x80,0x90,0x00,0xF0,0x09,0x80,0x86,0x84,0x30,0x80,0x08,0x08,0x8F,0xCB,0xAE,0x89,0x0A,0x38,0xC0,0x80,
+0x8B,0xD0,0xB8,0x08,0x08,0x86,0x80,0x80,0x80,0x80,0x00,0x00,0x70,0x81,0x80,0x86,0x80,0x0C,0x08,0x08,0x08,0xF8,0x08,0x08,0x08,0xBF,0x00,0x08,0x08,0x08,0x78,0x80,
+0x35,0x38,0x00,0x08,0x0E,0xC8,0x00,0x0C,0xC8,0xBB,0x0C,0xB8,0x08,0x08,0x86,0x84,0x80,0x00,0x08,0x08,0x08,0xF0,0x09,0x80,0x0E,0x0C,0x80,0x40,0x08,0x08,0x68,0x08,
+0xC8,0x80,0x44,0x38,0xC0,0xC0,0xB0,0x43,0x33,0x04,0x08,0x0D,0x8B,0x08,0x85,0x24,0x03,0x84,0x80,0x50,0x33,0x04,0x08,0xD8,0x30,0x80,0x08,0x08,0x08,0x09,0x00,0x9F,
+0x50,0x08,0x03,0x0D,0x0C,0x8B,0x80,0x80,0x60,0x48,0x03,0x03,0x0D,0xC8,0x00,0x08,0x08,0x08,0x3F,0x80,0x8C,0x80,0x0D,0x03,0x04,0x48,0x30,0x50,0x08,0x08,0x80,0x80,
+0x80,0x00,0x17,0x0D,0xB8,0x58,0x83,0x30,0x80,0x80,0x80,0x07,0x58,0x08,0xB8,0xD8,0x80,0x4B,0x80,0x80,0xE0,0x80,0x80,0x58,0x30,0x40,0x80,0x80,0x80,0x70,0x80,0x8C,
+0x80,0x80,0x80,0x80,0xF0,0x09,0x50,0x08,0x04,0x08,0x04,0x04,0x08,0x08,0x08,0xF8,0x08,0x08,0x85,0x34,0x03,0xD0,0xC0,0x80,0x80,0x50,0x48,0x38,0x80,0x0C,0x08,0x08,
+0x0E,0xBC,0x0B,0x0C,0xB8,0x08,0x08,0x08,0xF8,0x09,0x3D,0x00,0x48,0xD0,0x80,0x80,0x0C,0xC8,0xB8,0x08,0x08,0xC6,0x00,0x03,0x88,0x80,0xBE,0xC8,0x0C,0x80,0x80,0x08,
+0x08,0x08,0x09,0x70,0x41,0x03,0x04,0x03,0x80,0x80,0x80,0x00,0x00,0x9F,0xFC,0x89,0xA0,0x82,0x80,0x80,0x0C,0xC8,0x08,0x0D,0x08,0xC8,0x80,0x40,0x80,0x85,0x80,0x00,
+0x08,0x08,0x07,0x08,0x08,0x0E,0xC8,0x00,0x0C,0x08,0x0D,0x08,0x08,0x08,0x05,0x08,0x68,0x08,0x08,0x85,0x30,0x85,0x80,0x84,0x8B,0x00,0x08,0x0F,0xB8,0x08,0x0D,0x08,
+0xBD,0xB0,0x08,0x3D,0x80,0x50,0x08,0x0C,0x0C,0x30,0x80,0xD8,0x80,0x80,0x50,0x80,0x80,0x0E,0x0C,0x03,0x08,0x80,0x0E,0xB8,0x08,0x08,0x86,0x80,0x80,0xF0,0x80,0x80,
+0x00,0x68,0x48,0x38,0x80,0x00,0xE8,0x80,0x80,0x50,0x08,0x08,0xE8,0xC0,0x30,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x70,0x81,0x80,0x86,0x30,0x00,0x85,0x80,0x80,
+0x80,0x70,0x80,0x04,0x03,0x85,0x80,0x00,0x85,0x40,0x80,0x04,0x08,0x80,0x0E,0x08,0x58,0x08,0x08,0x80,0x0E,0x08,0x0D,0xB8,0x08,0xD0,0x08,0x08,0x08,0x86,0x84,0x84,
+0x80,0x40,0x48,0x48,0x08,0x08,0x88,0x50,0x80,0x80,0xF0,0xB0,0x08,0x88,0x80,0x06,0x08,0x08,0x08,0x37,0x30,0x80,0x80,0x80,0x90,0x00,0x00,0x9F,0xBC,0x0C,0x08,0x88,
+0xE0,0xC0,0xBB,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x9F,0x85,0x80,0x80,0x50,0x48,0x03,0x48,0x80,0x50,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0xF0,0xC2,0x80,0x80,
+0x80,0x70,0x08,0x03,0x80,0x80,0x70,0x80,0xD0,0x80,0x80,0xD8,0x80,0xD0,0x80,0x80,0x04,0x08,0xE8,0x80,0x80,0x80,0x80,0xF0,0xC8,0xB0,0x08,0x08,0x08,0x08,0x09,0x00,
+0x00,0x9F,0xD0,0x80,0x80,0x80,0x0E,0x48,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x70,0x81,0x85,0x80,0x0C,0x08,0x08,0x08,0x08,0x09,0x70,0x81,0x80,0x80,0x70,0x80,0x80,
+0x0D,0x08,0x0D,0x0C,0xB8,0x08,0x0D,0x0C,0x80,0xD0,0x80,0x80,0x8C,0x80,0x80,0x80,0x80,0x9F,0x00,0xE8,0x80,0x80,0x0D,0xB8,0xD8,0x30,0x40,0x30,0x04,0x53,0x38,0x84,
+0x03,0x40,0x08,0x04,0x08,0x58,0x80,0x80,0x05,0x08,0x58,0x30,0x40,0x80,0x85,0x80,0xD0,0x80,0xD0,0x80,0x80,0x00,0x8D,0x80,0xD0,0x08,0x0D,0xB8,0x08,0xD0,0x08,0x08,
+0xE8,0x80,0x80,0x80,0x0E,0xB8,0xD8,0x80,0xD0,0x80,0x8B,0xD0,0x80,0x80,0x0D,0x08,0x08,0x08,0x08,0x08,0x9F,0x00,0x85,0x80,0x85,0x80,0x85,0x80,0x80,0x80,0x80,0x80,
+0x17,0x08,0x68,0x08,0x08,0x0D,0x08,0x04,0x08,0x08,0x08,0x08,0xF9,0x09,0xD0,0x08,0x0D,0x08,0x08,0x80,0x60,0x08,0x58,0x08,0x03,0x80,0x86,0x80,0x50,0x08,0x0C,0x08,
+0x08,0x08,0x78,0x80,0x34,0x03,0x04,0x03,0x04,0x58,0x08,0x03,0x50,0x48,0x03,0x48,0x30,0x00,0x68,0x08,0x58,0x08,0x08,0x08,0x68,0x08,0x03,0x80,0x80,0x80,0x17,0x04,
+0x48,0x80,0x00,0x08,0x0F,0x08,0x0C,0x03,0x08,0x85,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x9F,0x0C,0x0C,0x0C,0x8B,0x80,0xD8,0x80,0x80,0xE0,0x80,0x0C,0x8B,0xD0,
+0x80,0x80,0x08,0x08,0x08,0x09,0xF0,0x09,0x0D,0x0C,0xC0,0x80,0x80,0x0C,0x0C,0x0C,0x08,0x0C,0xB8,0x08,0x8D,0x80,0xD0,0x08,0x0D,0xCB,0x80,0x8B,0x00,0x8D,0x8B,0x80,
+0x80,0x80,0x00,0xF0,0x09,0x80,0x60,0x08,0x08,0x08,0x0F,0x8B,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x9F,0x00,0x08,0x0F,
+0x08,0x0C,0x08,0x04,0x08,0x08,0x08,0x08,0x79,0x81,0x80,0x86,0x80,0x00,0x85,0x80,0x50,0x48,0x03,0x43,0x30,0x00,0x85,0x40,0x30,0x80,0x50,0x80,0x50,0x08,0x08,0x85,
+0x80,0x80,0x80,0x80,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x70,0x81,0x80,0x80,0x07,0x08,0x48,0x8B,0x50,0x08,0x58,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x17,0x58,
+0x08,0x03,0x80,0x60,0x0C,0x80,0x80,0x58,0x80,0x80,0x50,0x80,0x80,0x80,0x80,0x00,0x70,0x81,0x80,0x80,0x80,0xF0,0x09,0x80,0xF0,0x80,0x8B,0x00,0x8D,0x80,0x0D,0x08,
+0x08,0x08,0xF8,0x80,0x80,0x08,0xE8,0x80,0x80,0xE0,0x80,0x80,0x08,0x05,0x08,0x08,0x78,0x80,0x80,0x04,0x08,0x68,0x08,0x08,0x80,0x80,0x07,0x08,0x84,0x40,0x80,0x80,
+0x80,0xF0,0x08,0xC8,0x80,0xD0,0x80,0xD0,0x80,0xC0,0x80,0x0C,0xCB,0xC0,0xB0,0xC8,0xB0,0x08,0x0D,0xC8,0x00,0x08,0x08,0xE8,0x80,0x80,0x80,0x70,0x08,0x08,0x80,0x80,
+0x70,0x80,0x80,0x80,0x06,0x08,0x08,0x08,0x78,0x80,0x85,0x03,0x84,0x80,0x80,0x50,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0xF0,0xB0,0xC8,0x00,0x0C,
+0xC8,0x00,0x0C,0x0C,0xB8,0x08,0xD0,0x08,0x0D,0x8B,0xD0,0x80,0x80,0x80,0x05,0x08,0x04,0x58,0x08,0x08,0x80,0x86,0x84,0x30,0x80,0x04,0x58,0x48,0x08,0x03,0x84,0x40,
+0x80,0x40,0x80,0x85,0x80,0x00,0x85,0x80,0x80,0x0E,0x08,0xD8,0x80,0x80,0x0D,0x08,0x0D,0x08,0x08,0xD0,0x08,0x08,0xE8,0x80,0x80,0x80,0x80,0x80,0x70,0x81,0x80,0x60,
+0x08,0x08,0x08,0x08,0x07,0x08,0x04,0x08,0x08,0x08,0x07,0x08,0x08,0x68,0x80,0x04,0x08,0x80,0x60,0x08,0x08,0x68,0x08,0x08,0x80,0x80,0x70,0x80,0x8C,0x80,0x85,0x80,
+0x50,0x08,0xC8,0x30,0x80,0x80,0x0E,0x08,0x08,0x08,0xF8,0x08,0x08,0xE8,0x80,0x80,0x80,0x80,0x80,0x9F,0x00,0xE8,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x85,0x80,0x80,0x80,0x80,0x00,0x00,0x9F,0x00,0x8D,0xD0,0x80,0x8B,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,
+0x80,0x00,0x00,0x00,0x00,0x9F,0x50,0x08,0x08,0x80,0x80,0x0F,0x08,0x88,0x0D,0x08,0x08,0x0E,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,
+0x00,0x00,0x70,0x81,0x80,0xF0,0x80,0x30,0x00,0x08,0x08,0xF8,0x09,0x50,0x08,0x08,0x68,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x17,0x08,0x68,0x08,0x08,0x80,0x80,
+0x80,0x17,0x08,0x08,0x08,0x08,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x9F,0x50,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x70,
+0x81,0x80,0x80,0x70,0x80,0x80,0x80,0x70,0x08,0x08,0x85,0x80,0x00,0x85,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,
+0x00,0x00,0x00,0x00,0x00,0xF0,0x59,0x08,0x08,0x08,0x08,0x0F,0x08,0x08,0x80,0x80,0x80,0x00,0x9F,0x00,0x08,0x08,0x08,0x17,0x08,0x08,0x0F,0x08,0x08,0x80,0x80,0x0F,
+0x03,0x88,0x05,0x08,0x08,0x08,0xF8,0x08,0xD8,0x80,0x80,0x80,0xF0,0x80,0xC0,0x80,0x8B,0x80,0x0E,0x08,0x0D,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x9F,0x00,0x08,
+0x08,0x08,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x07,0xC8,0x00,0x08,0x0D,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,
+0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x17,0x08,0x85,0x80,0x80,0x60,0x08,0x58,0x48,0x08,0x03,0x84,0x80,0x80,0x80,0x80,0x00,0x00,0x9F,0x50,0x08,0x08,0x80,0x86,0x80,
+0x00,0x85,0x8B,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x17,0x04,0x03,0x08,0xE8,0x80,0x80,0x80,0x80,0x90,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,
+0x80,0x86,0x80,0x85,0x80,0x84,0x80,0x00,0x08,0xF8,0x80,0x80,0x08,0x08,0x08,0x09,0x00,0xF0,0x09,0x80,0x80,0xF0,0x08,0x88,0x0D,0x08,0x0D,0xC8,0xB0,0xC8,0x08,0x08,
+0x08,0x08,0x78,0x81,0xD0,0x08,0x0D,0x08,0x08,0x80,0xF0,0x80,0x8B,0x00,0xE8,0x80,0x80,0x80,0x80,0x80,0x70,0x81,0x85,0x80,0x85,0x80,0x84,0x80,0x00,0x08,0x08,0x08,
+0x00,0x00,0x9F,0x00,0x08,0x08,0x8F,0x84,0x80,0x80,0x80,0x06,0x08,0x58,0x80,0x40,0x80,0x80,0x80,0x80,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x70,0x81,0x85,0x30,0x00,0x85,0x80,0x80,0x80,0x80,0x00,0xF0,0x09,0xD0,0x08,0x08,0x08,0xF8,0x80,0x84,0x80,0x80,0x80,
+0x80,0x8F,0x80,0x80,0x80,0x80,0x70,0x81,0x80,0x80,0x80,0x70,0x81,0x80,0x80,0x0F,0x08,0x48,0x4B,0xC0,0x80,0xD0,0xB0,0x88,0x0C,0x08,0x0D,0xC8,0x00,0x08,0x08,0x08,
+0x08,0x09,0x00,0xF0,0x02,0x80,0x80,0x80,0x00,0x00,0x9F,0x00,0x08,0x08,0x8F,0x80,0x08,0x08,0x08,0x79,0x81,0x50,0x08,0x04,0x08,0x08,0x08,0x87,0x80,0x00,0x85,0x80,
+0x80,0x80,0x80,0x00,0x00,0x00,0x9F,0x00,0x68,0x08,0x08,0x80,0x80,0xF0,0x08,0x88,0x80,0x80,0x90,0x00,0x17,0x58,0x08,0x08,0x80,0x80,0x80,0x00,0xA7,0x08,0x08,0x08,
+0x08,0xF0,0x09,0x80,0x80,0x07,0x08,0x88,0xE0,0x80,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x9F,0x00,0x08,0x08,0x78,0x8A,0x80,0x80,0x0F,0x08,0x88,0xE0,0x80,0x0C,0x8B,
+0x80,0x0D,0x08,0x08,0xE8,0x80,0x8C,0x80,0x80,0x0E,0x08,0x08,0x85,0x40,0x80,0x80,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0xF0,0x09,0x85,0x30,0x00,0x85,0x84,0x80,0x00,
+0x08,0x08,0x78,0x81,0x50,0x48,0x08,0x03,0x80,0x80,0x70,0x80,0x80,0x80,0x80,0x90,0x00,0x17,0x08,0x68,0x08,0x08,0x80,0x80,0x70,0x80,0x80,0x80,0x3E,0x00,0x58,0x80,
+0x04,0x58,0x3B,0x80,0x85,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x0D,0x08,0x08,0x3D,0x8B,0x80,0x80,0x80,0x9F,0x00,0x08,0xF8,0x03,0x0C,
+0x08,0x0D,0x8B,0xD0,0x80,0x80,0x80,0x80,0x80,0x90,0x00,0x9F,0x0C,0x08,0x0D,0xC8,0xB0,0x08,0x08,0x08,0xF8,0x08,0x0D,0x08,0x08,0x80,0x80,0xF0,0x77,0x00,0x08,0x88,
+0x00,0x88,0x00,0x08,0x08,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const ADPCM_Sound_t spaceship_explode = {spaceship_explode_data,47856,{0,0},6176};
@@ -1 +1,976 @@
-const uint16_t spaceship_thruster[] = {2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2044,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2044,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2045,2045,2046,2046,2046,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2051,2051,2052,2053,2054,2054,2055,2055,2056,2056,2056,2056,2056,2056,2056,2056,2056,2056,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2056,2056,2056,2056,2057,2057,2058,2058,2058,2057,2057,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2059,2059,2059,2059,2059,2059,2059,2059,2058,2058,2057,2057,2056,2056,2055,2054,2054,2053,2053,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2050,2049,2048,2047,2046,2045,2044,2043,2043,2042,2041,2040,2040,2039,2038,2037,2037,2036,2035,2035,2035,2035,2035,2035,2035,2035,2035,2035,2034,2034,2034,2033,2033,2032,2032,2031,2031,2030,2030,2029,2029,2029,2029,2028,2028,2029,2029,2030,2030,2029,2030,2030,2030,2030,2030,2030,2029,2029,2029,2028,2028,2027,2027,2027,2027,2027,2027,2027,2027,2027,2027,2028,2028,2029,2029,2030,2031,2031,2031,2031,2032,2032,2032,2032,2032,2032,2033,2033,2033,2034,2035,2036,2038,2040,2041,2042,2044,2045,2047,2048,2050,2051,2052,2054,2056,2057,2058,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2060,2060,2060,2061,2061,2062,2063,2064,2065,2066,2068,2069,2070,2071,2073,2074,2076,2077,2078,2079,2079,2079,2079,2079,2079,2078,2078,2078,2079,2079,2079,2079,2079,2079,2079,2080,2080,2081,2081,2082,2082,2082,2082,2082,2082,2082,2082,2081,2081,2079,2078,2077,2076,2075,2074,2072,2072,2072,2071,2071,2070,2069,2068,2067,2067,2066,2065,2065,2064,2063,2063,2062,2061,2061,2060,2059,2059,2057,2055,2053,2052,2050,2048,2045,2043,2042,2041,2040,2038,2037,2036,2035,2034,2034,2034,2034,2033,2033,2033,2032,2032,2032,2031,2031,2030,2030,2030,2029,2028,2027,2027,2025,2024,2024,2023,2022,2023,2023,2023,2023,2023,2024,2024,2023,2023,2023,2023,2023,2023,2024,2025,2026,2027,2029,2031,2032,2032,2033,2033,2033,2033,2033,2034,2034,2036,2037,2038,2038,2038,2038,2038,2037,2036,2036,2036,2035,2035,2035,2036,2037,2038,2040,2042,2044,2046,2047,2048,2049,2049,2050,2051,2052,2054,2056,2057,2058,2059,2059,2059,2058,2057,2055,2054,2052,2050,2049,2049,2048,2048,2048,2048,2049,2051,2052,2053,2054,2055,2055,2055,2056,2058,2060,2063,2065,2066,2067,2067,2066,2065,2064,2063,2062,2061,2060,2059,2058,2057,2057,2056,2056,2057,2057,2057,2057,2057,2057,2058,2059,2060,2062,2064,2066,2067,2069,2069,2069,2068,2067,2066,2065,2064,2064,2064,2063,2062,2061,2060,2059,2059,2059,2059,2059,2058,2057,2055,2054,2053,2053,2054,2055,2056,2057,2057,2057,2056,2056,2055,2054,2053,2052,2052,2052,2053,2053,2054,2055,2057,2058,2059,2060,2060,2061,2061,2061,2061,2061,2062,2063,2064,2065,2066,2066,2066,2065,2064,2062,2061,2060,2059,2059,2058,2057,2057,2056,2056,2056,2056,2056,2056,2055,2054,2054,2053,2053,2054,2055,2055,2056,2056,2056,2056,2055,2055,2055,2055,2055,2055,2054,2054,2052,2051,2048,2046,2045,2044,2044,2045,2047,2048,2048,2047,2047,2048,2049,2050,2051,2052,2052,2052,2052,2051,2051,2050,2051,2051,2052,2051,2051,2049,2048,2047,2046,2046,2046,2046,2047,2047,2047,2047,2046,2045,2045,2044,2043,2042,2042,2040,2038,2037,2035,2033,2032,2030,2030,2029,2029,2027,2024,2022,2020,2020,2020,2020,2022,2023,2024,2025,2025,2026,2027,2028,2029,2029,2029,2027,2024,2022,2020,2017,2015,2013,2012,2012,2012,2011,2011,2011,2013,2016,2019,2023,2029,2035,2040,2044,2048,2051,2055,2059,2060,2062,2063,2063,2063,2062,2060,2058,2056,2054,2051,2050,2049,2047,2045,2043,2042,2044,2047,2051,2057,2063,2069,2073,2078,2082,2087,2091,2094,2097,2098,2099,2100,2100,2101,2101,2101,2101,2101,2100,2100,2098,2097,2095,2093,2092,2093,2095,2098,2102,2106,2108,2111,2113,2115,2117,2118,2119,2119,2120,2122,2124,2126,2128,2130,2132,2135,2136,2136,2135,2134,2131,2128,2125,2121,2119,2117,2114,2109,2105,2101,2097,2093,2087,2080,2075,2070,2065,2060,2056,2052,2050,2047,2045,2043,2041,2039,2037,2034,2032,2029,2026,2024,2023,2022,2022,2023,2022,2021,2019,2017,2014,2012,2009,2007,2004,2002,1999,1996,1993,1991,1989,1986,1983,1982,1980,1978,1976,1974,1974,1973,1972,1972,1973,1975,1978,1979,1981,1981,1982,1983,1984,1985,1986,1985,1984,1983,1980,1978,1975,1971,1967,1963,1959,1955,1951,1947,1945,1944,1944,1944,1945,1948,1951,1953,1956,1958,1960,1964,1967,1972,1976,1980,1984,1987,1989,1990,1991,1993,1996,2001,2005,2009,2013,2018,2023,2029,2035,2042,2048,2054,2060,2064,2066,2068,2069,2069,2069,2070,2072,2074,2077,2079,2080,2079,2079,2079,2081,2083,2086,2089,2092,2094,2098,2102,2106,2109,2113,2117,2120,2123,2124,2124,2122,2120,2117,2114,2112,2111,2109,2108,2107,2106,2105,2104,2105,2107,2111,2114,2118,2121,2125,2128,2131,2133,2136,2139,2141,2142,2144,2146,2147,2148,2148,2149,2150,2150,2150,2148,2146,2144,2142,2140,2137,2135,2132,2129,2126,2124,2120,2116,2111,2106,2101,2095,2089,2082,2077,2073,2069,2065,2061,2057,2053,2050,2047,2044,2041,2037,2033,2030,2027,2023,2020,2018,2017,2016,2016,2015,2014,2012,2008,2004,1999,1992,1987,1981,1976,1972,1967,1963,1960,1956,1953,1951,1950,1950,1951,1953,1954,1956,1959,1961,1965,1970,1976,1983,1990,1995,1998,2001,2002,2002,2002,2002,2002,2001,2001,1999,1998,1996,1995,1994,1993,1992,1990,1988,1986,1984,1984,1985,1987,1990,1993,1998,2005,2010,2016,2022,2029,2034,2039,2043,2048,2051,2053,2053,2052,2050,2048,2046,2044,2043,2043,2042,2041,2040,2038,2037,2038,2040,2041,2043,2046,2049,2054,2059,2064,2070,2076,2081,2087,2093,2099,2103,2105,2105,2106,2107,2106,2106,2106,2107,2109,2109,2109,2109,2109,2110,2110,2111,2111,2110,2109,2108,2108,2108,2106,2106,2105,2105,2107,2108,2110,2112,2114,2116,2118,2120,2121,2123,2124,2124,2123,2121,2118,2116,2115,2113,2111,2108,2102,2097,2090,2083,2077,2070,2064,2057,2052,2047,2043,2042,2040,2037,2035,2033,2032,2032,2033,2034,2034,2034,2033,2033,2035,2037,2039,2040,2040,2039,2038,2035,2033,2031,2029,2027,2023,2018,2014,2012,2010,2008,2007,2008,2012,2016,2020,2025,2029,2033,2035,2035,2034,2033,2031,2029,2027,2025,2023,2022,2021,2020,2019,2017,2015,2012,2010,2009,2009,2009,2008,2009,2009,2011,2014,2018,2023,2029,2034,2038,2041,2044,2047,2049,2051,2052,2053,2053,2053,2053,2053,2053,2052,2051,2050,2049,2049,2049,2049,2051,2053,2055,2058,2062,2067,2075,2083,2090,2096,2101,2105,2110,2113,2116,2117,2117,2116,2113,2109,2104,2099,2095,2092,2089,2087,2085,2084,2083,2083,2083,2083,2083,2084,2085,2086,2086,2086,2085,2082,2078,2075,2073,2072,2071,2070,2069,2068,2066,2065,2065,2066,2067,2067,2066,2065,2064,2064,2066,2068,2069,2070,2070,2069,2067,2065,2062,2061,2058,2055,2053,2050,2046,2040,2033,2027,2025,2025,2027,2033,2040,2046,2052,2057,2061,2066,2072,2078,2084,2091,2097,2102,2105,2105,2105,2103,2100,2097,2093,2089,2084,2078,2070,2062,2056,2051,2049,2048,2049,2050,2052,2053,2053,2053,2054,2056,2060,2064,2068,2072,2075,2077,2078,2079,2081,2085,2088,2090,2091,2092,2092,2092,2092,2092,2092,2091,2088,2084,2077,2071,2063,2054,2047,2043,2041,2042,2044,2045,2046,2047,2047,2047,2047,2047,2048,2049,2051,2053,2055,2057,2059,2063,2069,2075,2082,2087,2089,2088,2086,2081,2074,2065,2058,2053,2048,2044,2039,2036,2031,2025,2018,2010,2001,1995,1989,1982,1975,1966,1956,1949,1944,1941,1942,1944,1945,1945,1944,1943,1941,1939,1938,1938,1938,1939,1941,1943,1944,1945,1944,1943,1943,1944,1946,1947,1947,1945,1944,1943,1943,1943,1946,1951,1955,1958,1960,1962,1964,1965,1966,1967,1968,1970,1972,1974,1975,1975,1974,1972,1970,1968,1967,1966,1964,1961,1955,1950,1947,1943,1941,1940,1941,1944,1946,1948,1949,1952,1956,1962,1967,1972,1977,1982,1985,1987,1989,1991,1993,1996,1999,2002,2005,2009,2013,2016,2022,2029,2037,2047,2056,2064,2071,2078,2084,2090,2095,2100,2105,2111,2117,2120,2119,2117,2114,2110,2105,2100,2095,2092,2089,2089,2091,2093,2095,2098,2102,2108,2113,2117,2121,2125,2129,2135,2141,2145,2150,2155,2160,2165,2168,2167,2166,2163,2159,2156,2153,2150,2147,2142,2138,2135,2135,2134,2133,2133,2133,2135,2136,2137,2138,2140,2142,2143,2141,2137,2130,2121,2111,2101,2091,2079,2067,2057,2049,2042,2036,2029,2021,2011,2003,1995,1988,1979,1969,1961,1954,1950,1947,1942,1938,1935,1932,1929,1926,1920,1916,1913,1910,1908,1904,1900,1896,1895,1894,1892,1889,1887,1885,1883,1881,1878,1872,1866,1861,1856,1852,1848,1844,1839,1835,1830,1825,1818,1812,1806,1800,1794,1788,1783,1780,1780,1783,1786,1793,1802,1812,1821,1831,1843,1859,1876,1889,1902,1914,1926,1941,1957,1969,1978,1986,1993,1998,2003,2005,2008,2009,2009,2010,2013,2018,2025,2033,2044,2055,2065,2074,2085,2099,2115,2130,2144,2157,2169,2182,2194,2203,2211,2217,2221,2226,2228,2228,2230,2230,2228,2225,2219,2214,2208,2204,2201,2197,2194,2193,2193,2194,2197,2200,2204,2208,2214,2221,2228,2234,2242,2249,2256,2265,2273,2281,2291,2302,2315,2329,2343,2351,2357,2361,2363,2361,2356,2349,2341,2331,2316,2300,2284,2268,2253,2238,2218,2197,2178,2160,2144,2127,2109,2094,2080,2067,2057,2049,2043,2042,2042,2041,2040,2038,2035,2031,2025,2018,2007,1996,1985,1973,1958,1941,1922,1905,1891,1879,1866,1856,1848,1844,1842,1840,1840,1840,1842,1847,1852,1857,1862,1866,1870,1872,1874,1877,1880,1884,1889,1895,1900,1903,1901,1896,1891,1885,1881,1876,1872,1870,1869,1869,1868,1868,1871,1874,1878,1883,1890,1900,1912,1923,1933,1942,1951,1960,1969,1978,1986,1994,2003,2010,2017,2023,2029,2035,2040,2045,2049,2053,2057,2061,2068,2077,2086,2094,2103,2114,2126,2135,2143,2150,2156,2162,2165,2167,2169,2171,2174,2177,2182,2188,2194,2202,2211,2220,2227,2233,2238,2243,2248,2252,2255,2259,2264,2269,2278,2287,2296,2302,2307,2310,2311,2310,2307,2303,2298,2293,2288,2283,2279,2275,2271,2268,2265,2262,2258,2256,2256,2255,2254,2252,2249,2246,2241,2236,2231,2226,2220,2209,2196,2184,2172,2162,2152,2142,2133,2126,2121,2116,2111,2105,2097,2091,2087,2085,2084,2084,2084,2083,2081,2080,2080,2079,2079,2078,2076,2073,2065,2056,2048,2042,2036,2031,2028,2027,2026,2025,2024,2023,2021,2019,2018,2018,2020,2025,2029,2030,2030,2028,2025,2021,2019,2018,2017,2017,2016,2013,2007,2001,1994,1988,1982,1977,1974,1971,1967,1958,1949,1940,1933,1927,1922,1918,1915,1914,1913,1911,1907,1903,1901,1900,1900,1902,1905,1910,1915,1919,1922,1924,1924,1925,1927,1928,1930,1933,1937,1942,1948,1953,1960,1968,1976,1983,1989,1994,2000,2006,2011,2017,2025,2035,2047,2057,2066,2074,2082,2090,2098,2104,2109,2115,2119,2122,2124,2126,2127,2128,2129,2131,2133,2134,2133,2132,2129,2122,2115,2109,2103,2098,2094,2090,2085,2079,2072,2064,2058,2055,2053,2052,2049,2048,2050,2052,2055,2059,2065,2073,2081,2089,2095,2099,2104,2109,2111,2112,2113,2117,2121,2125,2130,2133,2135,2137,2138,2138,2139,2143,2148,2153,2159,2165,2172,2178,2186,2194,2203,2210,2213,2212,2210,2206,2201,2196,2189,2181,2171,2159,2146,2131,2114,2096,2078,2059,2042,2030,2020,2008,1996,1989,1987,1986,1986,1988,1992,1998,2006,2013,2019,2025,2031,2037,2042,2045,2048,2052,2056,2059,2063,2066,2066,2065,2063,2061,2060,2059,2058,2056,2055,2056,2057,2059,2063,2067,2070,2073,2077,2081,2084,2087,2087,2087,2087,2085,2082,2077,2070,2063,2055,2043,2029,2015,2001,1988,1978,1968,1959,1953,1948,1943,1939,1936,1934,1932,1931,1931,1933,1935,1937,1939,1942,1949,1954,1957,1959,1958,1958,1958,1957,1956,1956,1957,1957,1958,1958,1957,1957,1956,1956,1959,1962,1963,1963,1963,1962,1961,1960,1957,1953,1946,1938,1930,1922,1912,1900,1888,1876,1867,1861,1857,1853,1847,1841,1837,1835,1833,1831,1828,1827,1829,1835,1840,1845,1847,1849,1853,1857,1861,1865,1869,1875,1883,1892,1902,1913,1922,1931,1937,1942,1946,1948,1948,1947,1946,1945,1947,1949,1952,1955,1958,1959,1960,1958,1955,1952,1949,1947,1946,1946,1947,1952,1959,1971,1985,1998,2010,2021,2032,2046,2061,2071,2080,2088,2098,2112,2128,2143,2156,2168,2178,2186,2190,2194,2198,2201,2205,2209,2212,2214,2215,2215,2216,2218,2222,2228,2235,2245,2254,2262,2270,2277,2284,2294,2304,2310,2316,2321,2326,2332,2336,2337,2340,2343,2347,2352,2353,2351,2347,2339,2327,2311,2296,2283,2270,2254,2237,2223,2212,2202,2195,2191,2189,2191,2195,2198,2204,2213,2225,2238,2251,2265,2278,2292,2304,2313,2321,2327,2328,2327,2322,2315,2307,2296,2277,2254,2230,2205,2180,2151,2122,2100,2079,2060,2041,2021,2001,1987,1978,1971,1967,1960,1951,1944,1937,1931,1925,1919,1913,1907,1899,1892,1884,1875,1866,1855,1843,1829,1813,1800,1791,1783,1774,1763,1755,1750,1748,1747,1748,1755,1764,1774,1784,1796,1813,1833,1854,1875,1896,1916,1936,1953,1966,1977,1985,1991,1994,1996,1995,1994,1991,1984,1977,1969,1962,1957,1953,1948,1946,1945,1947,1949,1953,1960,1971,1984,1998,2014,2034,2056,2075,2093,2110,2126,2142,2153,2159,2166,2174,2182,2193,2203,2213,2223,2233,2244,2253,2260,2267,2273,2280,2289,2299,2306,2313,2320,2329,2342,2354,2365,2374,2385,2399,2412,2420,2424,2425,2424,2423,2421,2418,2414,2410,2408,2408,2408,2406,2402,2398,2393,2389,2385,2379,2372,2366,2357,2347,2337,2326,2315,2304,2296,2293,2292,2292,2292,2292,2292,2293,2293,2294,2291,2284,2274,2265,2254,2240,2222,2203,2186,2169,2152,2134,2111,2089,2071,2053,2035,2016,1993,1970,1951,1935,1922,1911,1903,1901,1901,1901,1902,1899,1893,1886,1878,1869,1859,1846,1832,1821,1813,1806,1801,1796,1792,1788,1788,1789,1790,1789,1787,1783,1778,1772,1765,1759,1754,1751,1749,1747,1745,1744,1743,1741,1740,1737,1733,1729,1725,1722,1719,1717,1715,1713,1711,1709,1709,1711,1715,1718,1720,1723,1726,1730,1734,1739,1744,1749,1756,1765,1775,1785,1796,1809,1823,1835,1847,1860,1872,1885,1898,1912,1926,1940,1958,1977,1993,2009,2024,2039,2056,2075,2093,2114,2137,2160,2187,2210,2226,2239,2252,2266,2279,2290,2297,2305,2312,2321,2332,2342,2351,2362,2375,2389,2400,2407,2412,2414,2413,2411,2408,2405,2400,2394,2387,2380,2372,2364,2355,2348,2344,2343,2346,2347,2347,2346,2342,2339,2335,2330,2326,2324,2325,2327,2329,2329,2329,2329,2332,2335,2338,2340,2340,2338,2335,2330,2324,2316,2304,2291,2282,2275,2269,2263,2255,2248,2246,2247,2252,2258,2264,2270,2278,2286,2295,2304,2309,2310,2308,2305,2298,2287,2273,2257,2240,2222,2200,2180,2165,2152,2140,2127,2110,2093,2080,2068,2056,2045,2035,2029,2023,2017,2011,2007,2005,2007,2009,2012,2015,2021,2029,2037,2045,2052,2059,2064,2064,2061,2057,2050,2040,2027,2015,2004,1991,1980,1968,1957,1948,1943,1938,1934,1932,1931,1931,1934,1937,1943,1948,1952,1957,1964,1972,1982,1989,1991,1991,1989,1986,1983,1981,1979,1977,1976,1977,1978,1977,1973,1969,1963,1958,1955,1953,1953,1954,1952,1950,1948,1949,1951,1954,1959,1966,1972,1977,1979,1978,1972,1965,1960,1957,1955,1956,1958,1960,1962,1964,1966,1967,1966,1964,1964,1968,1978,1989,1999,2010,2020,2031,2046,2064,2082,2099,2114,2125,2132,2135,2134,2134,2134,2135,2137,2138,2139,2138,2135,2133,2130,2127,2123,2119,2113,2107,2102,2096,2091,2087,2084,2082,2082,2082,2083,2084,2083,2081,2079,2078,2078,2077,2077,2079,2079,2077,2073,2068,2062,2059,2058,2058,2057,2054,2050,2046,2041,2037,2036,2040,2048,2057,2065,2072,2078,2082,2083,2082,2082,2082,2084,2086,2086,2084,2081,2079,2076,2073,2071,2071,2073,2079,2085,2090,2096,2103,2111,2122,2134,2144,2155,2166,2174,2179,2180,2177,2174,2170,2166,2163,2164,2163,2161,2158,2155,2157,2163,2170,2177,2186,2194,2201,2205,2206,2205,2203,2203,2204,2204,2205,2207,2210,2214,2217,2216,2214,2210,2204,2201,2198,2194,2188,2180,2172,2167,2166,2166,2168,2174,2182,2193,2203,2214,2225,2237,2248,2256,2264,2269,2270,2268,2265,2260,2255,2248,2240,2232,2222,2211,2197,2180,2166,2160,2154,2150,2147,2143,2137,2131,2126,2121,2115,2107,2097,2088,2079,2069,2058,2046,2037,2026,2015,2003,1991,1980,1971,1963,1953,1944,1937,1931,1929,1929,1932,1941,1948,1951,1953,1954,1955,1961,1969,1980,1992,2006,2024,2043,2058,2071,2085,2097,2106,2112,2114,2113,2113,2110,2105,2099,2092,2088,2086,2087,2091,2092,2094,2096,2099,2105,2114,2121,2128,2135,2143,2154,2166,2178,2191,2209,2233,2257,2275,2290,2304,2316,2326,2329,2326,2321,2313,2303,2289,2272,2257,2243,2228,2211,2197,2189,2185,2183,2183,2185,2188,2191,2193,2196,2201,2206,2212,2220,2227,2234,2241,2245,2247,2245,2242,2238,2231,2222,2212,2201,2190,2176,2156,2134,2114,2094,2076,2059,2044,2034,2024,2013,2002,1988,1974,1961,1947,1935,1922,1907,1895,1887,1879,1869,1854,1838,1823,1810,1796,1784,1771,1759,1748,1734,1719,1698,1675,1658,1642,1626,1612,1594,1578,1567,1559,1549,1538,1524,1511,1503,1496,1487,1474,1461,1450,1439,1429,1420,1414,1412,1415,1417,1419,1423,1429,1436,1442,1448,1454,1460,1467,1473,1480,1488,1497,1509,1519,1528,1535,1542,1549,1556,1560,1562,1566,1569,1573,1576,1581,1590,1602,1615,1632,1647,1658,1669,1679,1689,1704,1719,1730,1741,1752,1766,1779,1790,1802,1814,1825,1840,1853,1860,1868,1875,1883,1891,1895,1895,1895,1895,1898,1905,1913,1923,1934,1946,1967,1988,2007,2029,2049,2071,2098,2124,2146,2166,2188,2215,2242,2264,2285,2306,2326,2349,2372,2390,2404,2415,2422,2426,2429,2431,2435,2436,2436,2433,2428,2422,2416,2407,2393,2378,2365,2354,2346,2343,2345,2350,2356,2363,2372,2380,2385,2387,2384,2378,2368,2351,2330,2308,2286,2263,2236,2209,2188,2166,2145,2126,2103,2081,2063,2045,2028,2013,1998,1985,1978,1973,1969,1966,1964,1967,1973,1980,1986,1990,1993,1998,2000,2002,2002,1996,1987,1978,1967,1954,1941,1931,1924,1916,1906,1893,1875,1859,1847,1835,1821,1806,1786,1764,1747,1734,1725,1720,1719,1718,1718,1719,1723,1731,1739,1745,1752,1757,1760,1760,1759,1756,1752,1745,1736,1728,1724,1721,1720,1717,1712,1710,1708,1706,1705,1703,1701,1702,1706,1711,1718,1732,1750,1772,1794,1816,1839,1867,1896,1919,1938,1958,1980,2000,2015,2028,2041,2054,2070,2085,2094,2102,2109,2113,2116,2115,2112,2111,2111,2109,2107,2101,2095,2091,2086,2081,2076,2073,2073,2076,2078,2079,2077,2078,2080,2085,2094,2103,2111,2121,2130,2140,2151,2158,2163,2167,2171,2175,2177,2179,2182,2182,2179,2175,2172,2169,2166,2162,2160,2161,2162,2161,2158,2153,2150,2149,2149,2150,2151,2156,2165,2173,2177,2179,2180,2181,2182,2183,2184,2183,2181,2177,2170,2162,2153,2145,2134,2117,2098,2080,2061,2040,2016,1984,1952,1925,1901,1879,1859,1843,1834,1828,1823,1820,1814,1805,1797,1789,1781,1775,1769,1765,1760,1754,1745,1734,1723,1715,1709,1702,1698,1695,1692,1689,1685,1682,1678,1675,1675,1676,1678,1684,1691,1699,1706,1713,1720,1729,1741,1756,1772,1788,1802,1810,1812,1809,1804,1800,1794,1790,1791,1796,1803,1810,1814,1820,1828,1837,1848,1859,1869,1881,1893,1899,1904,1906,1905,1904,1903,1903,1906,1910,1918,1926,1929,1928,1927,1924,1922,1919,1918,1920,1921,1927,1934,1942,1953,1967,1986,2012,2037,2056,2072,2089,2105,2120,2133,2147,2162,2176,2190,2203,2215,2229,2245,2260,2279,2297,2311,2320,2326,2325,2321,2316,2312,2310,2309,2307,2305,2302,2298,2294,2291,2290,2290,2291,2293,2296,2297,2297,2295,2289,2282,2274,2264,2251,2241,2232,2226,2223,2221,2217,2211,2203,2196,2188,2179,2170,2161,2151,2142,2133,2127,2127,2131,2137,2146,2157,2168,2179,2189,2202,2215,2226,2235,2242,2248,2253,2258,2266,2275,2283,2292,2297,2302,2307,2311,2314,2318,2318,2320,2323,2325,2327,2328,2324,2317,2307,2295,2281,2264,2247,2231,2215,2200,2183,2161,2138,2118,2099,2084,2069,2053,2039,2029,2020,2016,2014,2012,2012,2010,2007,2003,1997,1991,1987,1983,1979,1974,1965,1954,1943,1933,1925,1920,1916,1914,1913,1912,1911,1911,1910,1909,1908,1907,1909,1917,1926,1934,1941,1948,1955,1961,1965,1966,1966,1966,1963,1959,1952,1940,1923,1901,1872,1846,1825,1807,1788,1773,1761,1756,1752,1750,1749,1747,1742,1739,1734,1726,1712,1691,1670,1653,1640,1629,1620,1614,1612,1614,1617,1623,1628,1628,1625,1620,1614,1608,1600,1591,1585,1579,1577,1581,1589,1598,1608,1617,1629,1640,1647,1649,1649,1648,1645,1642,1638,1634,1629,1628,1634,1644,1653,1661,1667,1670,1669,1667,1669,1673,1677,1681,1689,1698,1708,1719,1731,1744,1755,1761,1766,1769,1769,1770,1770,1768,1764,1760,1756,1754,1753,1753,1754,1757,1760,1763,1765,1767,1768,1772,1774,1774,1776,1777,1778,1780,1785,1791,1799,1810,1826,1850,1876,1901,1926,1952,1977,2001,2021,2035,2047,2058,2068,2078,2083,2088,2093,2096,2098,2102,2108,2115,2120,2123,2127,2135,2143,2151,2159,2169,2180,2188,2194,2199,2203,2211,2218,2222,2221,2218,2211,2201,2189,2173,2157,2143,2126,2109,2093,2075,2058,2043,2023,2005,1994,1984,1975,1970,1967,1968,1972,1977,1982,1986,1990,1997,2005,2011,2018,2026,2033,2036,2034,2030,2021,2011,2000,1989,1974,1958,1938,1916,1894,1872,1848,1823,1799,1778,1763,1751,1743,1736,1731,1729,1729,1727,1726,1723,1716,1710,1704,1698,1691,1683,1678,1678,1682,1689,1699,1713,1726,1740,1751,1757,1756,1747,1733,1718,1703,1689,1677,1669,1665,1664,1667,1676,1689,1701,1710,1718,1725,1737,1749,1758,1768,1777,1786,1800,1818,1834,1850,1868,1891,1913,1929,1939,1946,1950,1951,1948,1943,1939,1937,1935,1936,1939,1946,1955,1964,1975,1985,1993,2006,2022,2041,2064,2086,2106,2128,2153,2185,2221,2250,2277,2304,2330,2359,2384,2399,2409,2417,2421,2421,2415,2407,2402,2397,2388,2377,2366,2353,2338,2319,2294,2268,2247,2229,2212,2197,2181,2170,2165,2163,2165,2172,2181,2192,2205,2217,2227,2234,2238,2238,2233,2229,2221,2206,2186,2166,2148,2127,2099,2066,2039,2015,1994,1978,1963,1951,1948,1947,1946,1946,1946,1948,1951,1951,1952,1951,1949,1946,1940,1934,1929,1925,1925,1926,1924,1918,1907,1887,1865,1843,1821,1797,1760,1722,1690,1661,1633,1607,1579,1556,1539,1524,1507,1486,1464,1445,1429,1414,1398,1384,1375,1371,1367,1363,1362,1366,1375,1384,1395,1406,1417,1428,1437,1444,1449,1452,1457,1464,1472,1481,1491,1500,1513,1527,1539,1552,1564,1576,1590,1604,1619,1633,1646,1659,1671,1680,1692,1708,1726,1750,1771,1786,1797,1803,1800,1791,1781,1773,1768,1764,1766,1771,1778,1788,1801,1821,1850,1882,1913,1944,1978,2018,2055,2083,2107,2129,2153,2182,2212,2236,2259,2280,2298,2313,2320,2319,2315,2305,2296,2289,2285,2285,2288,2293,2306,2322,2334,2346,2359,2374,2386,2395,2401,2407,2413,2420,2426,2430,2434,2440,2446,2450,2452,2453,2453,2449,2439,2423,2405,2389,2374,2362,2354,2349,2345,2342,2340,2342,2345,2349,2352,2355,2359,2361,2361,2361,2359,2353,2342,2325,2306,2290,2273,2258,2246,2235,2225,2215,2203,2190,2177,2168,2165,2167,2171,2178,2181,2181,2179,2175,2169,2163,2153,2141,2129,2116,2097,2074,2053,2041,2034,2029,2028,2031,2037,2047,2064,2083,2107,2136,2164,2185,2200,2215,2229,2243,2253,2257,2258,2257,2251,2242,2231,2217,2202,2185,2162,2138,2115,2095,2072,2044,2019,2000,1984,1969,1960,1956,1955,1959,1966,1970,1974,1980,1988,1994,2001,2006,2008,2005,1999,1991,1983,1973,1958,1942,1926,1912,1897,1878,1859,1841,1826,1815,1811,1812,1818,1829,1846,1868,1896,1928,1958,1979,1996,2013,2033,2052,2067,2078,2088,2094,2098,2100,2099,2099,2098,2093,2082,2067,2048,2030,2012,1991,1972,1956,1943,1934,1925,1914,1907,1906,1909,1913,1917,1917,1920,1924,1927,1932,1943,1953,1960,1964,1966,1965,1962,1958,1951,1941,1927,1911,1893,1878,1867,1857,1848,1840,1836,1834,1835,1840,1848,1858,1866,1872,1876,1878,1883,1890,1899,1913,1931,1952,1976,1999,2019,2037,2056,2072,2089,2104,2115,2122,2127,2128,2126,2120,2110,2097,2082,2063,2046,2035,2026,2018,2010,1997,1983,1971,1960,1947,1937,1932,1933,1937,1941,1948,1959,1972,1986,2000,2013,2026,2043,2058,2072,2084,2093,2100,2103,2102,2097,2089,2080,2072,2065,2058,2050,2043,2033,2018,1998,1982,1969,1962,1963,1970,1980,1991,2002,2017,2034,2050,2063,2076,2091,2109,2128,2144,2154,2159,2159,2154,2149,2148,2147,2148,2152,2156,2161,2164,2160,2154,2145,2132,2120,2113,2106,2098,2087,2075,2063,2052,2043,2033,2025,2019,2016,2015,2016,2016,2013,2008,1999,1990,1981,1975,1974,1979,1986,1992,1997,2001,2003,2002,2000,2002,2011,2024,2036,2047,2057,2064,2070,2074,2071,2064,2055,2041,2026,2015,2010,2010,2011,2011,2011,2010,2011,2011,2013,2015,2019,2024,2029,2035,2043,2054,2067,2080,2096,2114,2134,2150,2161,2169,2175,2179,2182,2183,2182,2178,2174,2171,2168,2165,2162,2160,2156,2148,2137,2126,2117,2108,2098,2089,2083,2080,2080,2083,2092,2109,2128,2147,2165,2182,2201,2218,2234,2249,2261,2272,2280,2283,2281,2279,2277,2273,2270,2269,2271,2278,2287,2295,2300,2302,2302,2298,2292,2283,2274,2265,2257,2252,2249,2246,2246,2249,2256,2268,2289,2314,2338,2357,2373,2387,2398,2405,2408,2406,2399,2385,2369,2356,2343,2328,2310,2284,2251,2220,2190,2161,2129,2093,2059,2034,2013,1989,1966,1947,1936,1932,1932,1938,1951,1968,1982,1993,2004,2014,2020,2022,2021,2018,2012,2004,2000,2002,2004,2004,2004,2002,2000,1999,1998,1996,1994,1992,1990,1989,1989,1993,2000,2011,2021,2031,2041,2049,2053,2053,2049,2043,2034,2016,1987,1955,1928,1907,1887,1865,1848,1835,1822,1809,1796,1778,1757,1737,1717,1694,1667,1642,1621,1602,1584,1570,1562,1558,1559,1565,1575,1589,1611,1635,1653,1669,1687,1709,1729,1742,1752,1761,1767,1775,1784,1790,1795,1800,1803,1805,1807,1807,1807,1805,1802,1801,1803,1806,1810,1817,1830,1848,1867,1889,1913,1940,1972,2001,2021,2037,2053,2067,2076,2080,2085,2092,2102,2115,2127,2136,2141,2145,2146,2142,2134,2125,2116,2108,2103,2100,2099,2101,2103,2106,2117,2134,2153,2172,2190,2212,2237,2262,2282,2298,2316,2334,2351,2366,2380,2395,2411,2430,2448,2461,2470,2475,2478,2476,2469,2460,2449,2437,2420,2402,2388,2374,2358,2343,2329,2316,2307,2299,2291,2286,2283,2281,2277,2274,2273,2276,2282,2289,2296,2305,2314,2316,2310,2298,2282,2261,2233,2204,2179,2158,2139,2119,2095,2073,2058,2044,2028,2014,2003,1996,1996,1999,2003,2011,2021,2033,2047,2060,2075,2093,2110,2119,2121,2116,2106,2092,2074,2057,2042,2025,2003,1978,1953,1931,1914,1900,1886,1875,1871,1873,1879,1890,1910,1937,1967,2001,2041,2085,2128,2164,2196,2224,2246,2260,2263,2256,2245,2234,2219,2199,2179,2160,2144,2123,2098,2073,2051,2032,2012,1991,1969,1949,1933,1923,1914,1906,1900,1899,1900,1903,1908,1919,1934,1948,1961,1971,1981,1990,1998,2004,2009,2016,2027,2038,2048,2058,2069,2079,2087,2091,2094,2096,2097,2098,2102,2108,2117,2127,2139,2156,2177,2200,2224,2248,2275,2306,2334,2354,2367,2378,2385,2389,2390,2390,2389,2388,2386,2382,2376,2370,2365,2359,2345,2326,2306,2284,2261,2237,2207,2179,2159,2143,2125,2108,2092,2082,2077,2072,2068,2066,2065,2065,2063,2061,2063,2070,2079,2086,2091,2096,2099,2099,2096,2090,2080,2068,2049,2027,2010,1993,1978,1964,1947,1930,1920,1912,1907,1906,1908,1911,1913,1911,1909,1908,1908,1912,1917,1925,1939,1954,1968,1979,1986,1986,1980,1972,1959,1943,1925,1904,1880,1856,1838,1825,1813,1803,1795,1793,1792,1791,1792,1799,1807,1816,1827,1839,1854,1874,1894,1910,1924,1937,1948,1956,1957,1954,1951,1947,1942,1934,1925,1917,1910,1905,1904,1908,1915,1926,1939,1953,1967,1980,1994,2009,2027,2047,2069,2089,2107,2125,2143,2163,2182,2195,2205,2214,2219,2220,2220,2222,2224,2225,2225,2224,2219,2212,2204,2194,2187,2183,2180,2180,2179,2177,2178,2180,2182,2184,2184,2187,2190,2194,2200,2208,2217,2230,2244,2253,2259,2262,2262,2263,2266,2271,2279,2291,2307,2322,2333,2340,2347,2351,2352,2352,2352,2354,2356,2359,2366,2375,2386,2400,2413,2425,2436,2446,2455,2462,2464,2462,2460,2458,2457,2459,2465,2472,2480,2485,2490,2493,2492,2483,2470,2456,2440,2424,2413,2406,2404,2404,2406,2411,2414,2412,2407,2403,2396,2388,2379,2367,2351,2333,2309,2286,2268,2251,2235,2217,2195,2171,2151,2131,2110,2089,2071,2059,2055,2054,2056,2067,2085,2108,2132,2157,2182,2211,2238,2260,2280,2300,2318,2336,2349,2351,2350,2346,2338,2330,2320,2310,2300,2288,2274,2261,2250,2241,2230,2218,2205,2192,2177,2163,2150,2141,2138,2140,2143,2149,2155,2162,2169,2176,2182,2184,2178,2165,2152,2140,2130,2122,2113,2104,2096,2087,2077,2066,2053,2043,2039,2036,2031,2019,2005,1996,1990,1988,1994,2005,2020,2033,2045,2057,2073,2091,2105,2111,2110,2105,2096,2087,2082,2077,2073,2067,2054,2037,2020,2004,1990,1980,1972,1967,1963,1959,1951,1941,1935,1934,1937,1941,1947,1956,1969,1982,1996,2009,2019,2028,2031,2027,2021,2014,2006,2004,2007,2009,2010,2007,1999,1988,1979,1971,1965,1959,1952,1946,1945,1948,1951,1954,1959,1963,1968,1970,1973,1981,1988,1991,1991,1986,1977,1969,1963,1960,1961,1967,1980,1995,2005,2011,2014,2011,2001,1988,1974,1964,1953,1940,1930,1923,1921,1919,1917,1916,1915,1915,1920,1929,1942,1961,1980,1994,2006,2017,2034,2056,2078,2100,2124,2149,2177,2200,2213,2222,2228,2230,2227,2220,2211,2203,2194,2185,2176,2166,2155,2143,2132,2123,2120,2122,2130,2140,2155,2172,2188,2197,2202,2209,2221,2237,2255,2275,2295,2316,2336,2352,2360,2362,2359,2353,2343,2330,2316,2305,2292,2275,2254,2235,2214,2192,2169,2140,2111,2088,2065,2043,2021,1997,1977,1966,1960,1961,1969,1980,1993,2006,2018,2028,2035,2038,2037,2035,2033,2029,2025,2021,2013,2004,1991,1972,1953,1934,1914,1890,1861,1820,1775,1737,1702,1667,1632,1605,1590,1586,1587,1594,1606,1620,1633,1646,1655,1663,1673,1685,1697,1708,1721,1736,1750,1760,1767,1773,1776,1782,1792,1805,1817,1830,1843,1858,1875,1888,1899,1909,1922,1935,1945,1954,1964,1975,1988,2002,2016,2031,2044,2057,2073,2088,2097,2101,2099,2092,2082,2071,2060,2049,2039,2030,2025,2024,2025,2028,2033,2042,2052,2062,2070,2076,2081,2084,2084,2084,2082,2081,2082,2082,2083,2088,2096,2110,2126,2137,2146,2156,2165,2174,2177,2175,2171,2167,2164,2162,2162,2164,2166,2170,2178,2187,2197,2209,2222,2238,2254,2267,2276,2281,2281,2275,2269,2264,2262,2263,2265,2267,2267,2262,2252,2241,2226,2200,2169,2140,2110,2083,2057,2029,2003,1982,1965,1948,1933,1920,1912,1906,1899,1890,1876,1861,1856,1855,1854,1860,1874,1894,1917,1940,1965,1992,2014,2030,2041,2047,2048,2043,2034,2023,2012,2001,1990,1979,1967,1956,1945,1931,1909,1882,1854,1821,1787,1747,1698,1653,1622,1600,1584,1576,1576,1585,1600,1618,1640,1664,1686,1701,1710,1715,1715,1713,1711,1706,1700,1692,1681,1672,1666,1663,1662,1661,1659,1655,1650,1641,1630,1618,1606,1599,1599,1604,1613,1631,1654,1677,1702,1728,1755,1786,1815,1836,1856,1874,1889,1907,1923,1935,1948,1962,1977,1993,2004,2010,2014,2013,2007,1998,1986,1975,1965,1958,1953,1948,1945,1941,1937,1934,1931,1929,1930,1930,1933,1942,1954,1967,1984,2002,2022,2049,2075,2099,2123,2152,2186,2221,2249,2270,2291,2310,2328,2342,2350,2352,2353,2351,2340,2321,2302,2285,2265,2243,2221,2204,2191,2180,2173,2171,2172,2174,2175,2175,2178,2184,2197,2214,2234,2254,2277,2298,2314,2329,2343,2357,2373,2387,2395,2399,2403,2405,2407,2407,2404,2401,2394,2379,2360,2341,2320,2299,2276,2247,2216,2187,2159,2130,2103,2080,2066,2057,2051,2048,2048,2049,2053,2060,2067,2073,2078,2084,2087,2090,2092,2091,2086,2076,2059,2040,2015,1983,1955,1936,1921,1908,1894,1877,1860,1844,1829,1815,1802,1793,1791,1793,1800,1815,1839,1868,1899,1931,1964,1999,2034,2066,2086,2099,2109,2117,2120,2117,2111,2108,2106,2105,2104,2101,2097,2091,2080,2061,2038,2015,1993,1973,1957,1949,1952,1963,1979,1999,2025,2052,2077,2098,2117,2135,2151,2160,2165,2167,2164,2161,2159,2157,2156,2155,2151,2146,2136,2125,2113,2096,2069,2042,2019,1998,1979,1967,1963,1967,1978,1995,2013,2034,2057,2076,2088,2096,2100,2101,2098,2092,2084,2074,2062,2049,2033,2015,1999,1986,1976,1965,1955,1951,1948,1943,1936,1929,1925,1925,1928,1937,1956,1979,2004,2029,2051,2068,2080,2084,2082,2077,2067,2055,2043,2033,2022,2011,1998,1982,1963,1947,1933,1925,1923,1927,1934,1944,1952,1958,1963,1966,1967,1967,1966,1964,1961,1958,1956,1953,1949,1943,1934,1922,1912,1907,1902,1895,1889,1881,1871,1861,1850,1839,1832,1834,1839,1850,1864,1879,1890,1898,1899,1897,1894,1894,1895,1895,1897,1898,1897,1896,1898,1901,1903,1904,1904,1905,1908,1913,1920,1924,1923,1916,1906,1898,1892,1887,1888,1893,1901,1910,1918,1923,1923,1920,1914,1909,1905,1904,1905,1904,1903,1900,1895,1888,1880,1871,1862,1857,1857,1865,1877,1892,1908,1924,1937,1944,1950,1956,1959,1960,1961,1962,1965,1966,1965,1963,1961,1961,1965,1970,1976,1982,1986,1984,1977,1965,1950,1936,1926,1915,1906,1903,1902,1902,1903,1904,1904,1904,1902,1899,1896,1891,1886,1881,1877,1871,1865,1858,1851,1843,1835,1829,1825,1822,1815,1805,1793,1781,1768,1758,1754,1757,1764,1772,1781,1796,1811,1822,1831,1837,1845,1855,1865,1875,1886,1897,1913,1928,1938,1947,1955,1964,1974,1983,1993,2004,2016,2029,2040,2049,2056,2063,2073,2092,2113,2132,2152,2167,2180,2196,2210,2220,2229,2238,2245,2255,2267,2276,2282,2288,2295,2300,2303,2303,2303,2299,2292,2281,2268,2253,2239,2225,2207,2190,2179,2172,2169,2165,2158,2148,2138,2125,2112,2102,2095,2093,2095,2098,2105,2119,2134,2148,2160,2171,2186,2204,2217,2226,2233,2237,2236,2232,2228,2223,2222,2222,2223,2225,2230,2235,2240,2241,2238,2229,2219,2208,2193,2174,2156,2140,2128,2117,2102,2087,2071,2053,2033,2011,1983,1958,1938,1918,1899,1877,1851,1830,1818,1812,1811,1818,1830,1846,1860,1873,1883,1885,1879,1869,1853,1834,1812,1782,1752,1729,1710,1691,1680,1677,1682,1694,1708,1726,1753,1782,1806,1824,1837,1845,1856,1868,1878,1889,1901,1916,1933,1944,1949,1949,1942,1925,1904,1882,1858,1833,1805,1771,1739,1718,1705,1697,1699,1706,1715,1727,1739,1753,1772,1790,1802,1814,1827,1840,1853,1860,1863,1864,1864,1862,1859,1852,1843,1836,1829,1823,1823,1826,1830,1836,1843,1849,1852,1855,1859,1865,1874,1883,1892,1903,1914,1922,1928,1931,1932,1934,1938,1946,1957,1973,1993,2014,2037,2065,2093,2118,2144,2170,2194,2217,2234,2243,2243,2238,2228,2213,2197,2185,2176,2169,2162,2157,2153,2148,2142,2133,2120,2107,2100,2098,2101,2108,2117,2125,2131,2133,2133,2132,2131,2129,2127,2122,2115,2110,2107,2106,2105,2104,2102,2098,2090,2078,2064,2046,2024,2002,1983,1966,1948,1933,1918,1909,1908,1912,1921,1935,1951,1964,1976,1988,2000,2018,2042,2066,2089,2109,2129,2145,2158,2169,2177,2181,2180,2177,2170,2161,2153,2142,2128,2114,2103,2095,2085,2076,2070,2067,2064,2059,2052,2044,2036,2025,2010,1993,1974,1956,1942,1930,1918,1905,1891,1880,1873,1865,1856,1845,1832,1820,1810,1803,1797,1790,1781,1774,1774,1778,1789,1813,1841,1870,1900,1933,1968,2008,2041,2060,2072,2082,2088,2094,2101,2106,2109,2116,2130,2150,2171,2192,2212,2228,2242,2251,2257,2259,2256,2246,2231,2213,2199,2189,2178,2165,2150,2135,2118,2103,2091,2081,2070,2058,2045,2034,2025,2013,2002,1993,1988,1989,1997,2008,2018,2027,2036,2046,2057,2066,2074,2081,2089,2093,2096,2103,2117,2136,2159,2183,2205,2223,2240,2256,2271,2287,2302,2313,2323,2332,2336,2334,2327,2319,2314,2310,2309,2313,2318,2322,2327,2330,2327,2316,2301,2281,2255,2222,2192,2169,2152,2139,2127,2114,2102,2098,2100,2106,2118,2136,2157,2173,2185,2193,2194,2188,2181,2176,2173,2173,2177,2185,2194,2200,2203,2202,2196,2188,2178,2166,2151,2131,2110,2093,2078,2063,2046,2026,2006,1991,1977,1963,1950,1934,1916,1898,1880,1861,1841,1822,1809,1803,1801,1806,1820,1840,1860,1879,1899,1921,1941,1956,1966,1972,1975,1974,1971,1966,1956,1941,1923,1903,1884,1869,1855,1839,1820,1799,1777,1752,1724,1696,1668,1642,1624,1610,1600,1597,1602,1614,1628,1643,1663,1691,1718,1740,1758,1774,1787,1798,1804,1807,1809,1812,1813,1813,1817,1822,1826,1832,1839,1843,1847,1847,1846,1848,1848,1848,1848,1847,1842,1836,1826,1815,1812,1813,1820,1834,1852,1871,1891,1911,1930,1947,1960,1967,1971,1973,1970,1963,1954,1945,1940,1934,1923,1909,1896,1881,1863,1844,1821,1799,1781,1765,1751,1742,1734,1733,1743,1760,1784,1820,1857,1888,1916,1943,1967,1992,2013,2024,2029,2033,2035,2036,2038,2043,2051,2058,2061,2062,2062,2063,2064,2062,2058,2051,2043,2036,2027,2022,2021,2025,2034,2047,2065,2090,2114,2133,2150,2162,2176,2193,2209,2224,2239,2253,2269,2284,2297,2312,2327,2342,2361,2381,2399,2419,2436,2448,2457,2457,2452,2446,2439,2431,2424,2416,2411,2408,2404,2399,2390,2380,2367,2351,2334,2315,2299,2288,2281,2275,2271,2267,2262,2258,2254,2254,2257,2262,2266,2268,2269,2265,2257,2248,2239,2228,2217,2202,2187,2176,2163,2150,2137,2119,2098,2076,2053,2029,2005,1985,1973,1962,1950,1939,1928,1917,1910,1905,1899,1898,1900,1903,1903,1902,1904,1908,1915,1923,1935,1948,1963,1978,1993,2003,2008,2009,2006,1997,1982,1968,1956,1944,1929,1913,1899,1885,1871,1857,1841,1825,1813,1806,1800,1798,1800,1803,1807,1813,1821,1832,1846,1862,1884,1908,1932,1964,1994,2014,2029,2039,2046,2053,2060,2067,2076,2088,2103,2118,2131,2143,2155,2166,2180,2191,2200,2209,2214,2218,2223,2230,2238,2248,2257,2269,2285,2305,2326,2347,2366,2382,2391,2390,2383,2370,2351,2326,2299,2275,2250,2225,2197,2171,2153,2140,2130,2126,2125,2128,2134,2138,2140,2146,2150,2151,2153,2155,2160,2169,2182,2195,2208,2225,2242,2261,2278,2292,2305,2318,2327,2333,2334,2327,2316,2298,2268,2238,2215,2194,2178,2165,2154,2148,2146,2144,2137,2123,2102,2077,2049,2020,1990,1958,1927,1904,1886,1872,1861,1850,1842,1840,1842,1846,1849,1852,1853,1850,1844,1836,1829,1824,1826,1831,1835,1842,1857,1874,1891,1904,1913,1921,1923,1916,1904,1892,1881,1874,1870,1870,1875,1883,1892,1904,1917,1929,1942,1956,1972,1989,2004,2015,2024,2031,2038,2046,2054,2063,2070,2080,2094,2112,2128,2143,2157,2170,2178,2180,2177,2171,2165,2159,2154,2149,2146,2141,2135,2129,2123,2116,2107,2097,2085,2070,2057,2044,2031,2018,2005,1992,1982,1977,1975,1980,1987,1996,2007,2017,2027,2035,2039,2038,2034,2028,2022,2020,2019,2024,2030,2037,2045,2053,2060,2067,2075,2084,2093,2099,2101,2100,2100,2097,2093,2090,2091,2097,2107,2121,2135,2148,2163,2180,2197,2215,2229,2240,2251,2263,2274,2287,2299,2309,2317,2324,2325,2325,2322,2318,2314,2310,2303,2295,2289,2280,2268,2256,2242,2227,2215,2205,2193,2181,2171,2163,2158,2155,2153,2150,2146,2144,2146,2148,2148,2143,2134,2123,2108,2092,2070,2050,2036,2024,2016,2013,2011,2012,2018,2026,2037,2054,2072,2090,2107,2120,2132,2144,2155,2165,2171,2174,2172,2166,2159,2150,2141,2128,2111,2094,2080,2064,2050,2040,2033,2029,2025,2020,2015,2012,2012,2017,2020,2021,2023,2024,2024,2023,2018,2010,1997,1976,1956,1940,1924,1907,1892,1878,1868,1865,1863,1860,1859,1858,1858,1861,1866,1876,1892,1909,1925,1943,1960,1979,2003,2027,2041,2051,2058,2060,2058,2051,2039,2027,2011,1989,1969,1953,1938,1925,1917,1913,1911,1910,1908,1905,1904,1903,1904,1907,1910,1915,1921,1928,1934,1941,1952,1968,1987,2003,2016,2027,2034,2036,2033,2028,2020,2007,1988,1963,1936,1913,1891,1869,1848,1828,1813,1804,1797,1791,1787,1788,1793,1800,1806,1813,1823,1834,1846,1861,1880,1907,1935,1957,1976,1995,2011,2024,2034,2039,2042,2043,2042,2041,2043,2049,2058,2070,2089,2109,2128,2148,2168,2186,2204,2218,2227,2235,2240,2241,2238,2232,2223,2213,2202,2187,2177,2172,2170,2170,2170,2166,2159,2153,2146,2137,2126,2114,2105,2102,2100,2098,2102,2110,2117,2123,2128,2129,2126,2121,2115,2110,2104,2099,2093,2084,2072,2057,2041,2026,2014,2006,2004,2005,2011,2021,2034,2048,2063,2081,2102,2120,2138,2158,2179,2205,2241,2282,2317,2349,2379,2405,2429,2450,2465,2477,2491,2504,2512,2516,2512,2504,2493,2475,2455,2438,2420,2404,2386,2359,2330,2304,2276,2245,2211,2176,2150,2130,2111,2101,2101,2107,2118,2132,2145,2159,2174,2189,2198,2204,2211,2214,2211,2202,2188,2175,2159,2135,2109,2086,2062,2039,2012,1978,1945,1921,1900,1881,1860,1839,1822,1811,1801,1796,1797,1803,1813,1830,1848,1871,1899,1928,1952,1973,1997,2023,2046,2060,2069,2074,2077,2076,2072,2065,2055,2039,2015,1989,1966,1945,1924,1900,1873,1846,1823,1805,1790,1777,1768,1768,1777,1793,1814,1845,1879,1911,1945,1979,2015,2059,2105,2145,2182,2215,2244,2274,2300,2320,2337,2351,2359,2365,2368,2366,2362,2354,2341,2323,2307,2293,2281,2272,2269,2270,2274,2284,2297,2318,2342,2364,2383,2398,2414,2434,2452,2460,2461,2458,2450,2441,2427,2408,2391,2372,2351,2332,2319,2309,2297,2284,2269,2252,2239,2225,2213,2203,2193,2182,2177,2178,2183,2194,2206,2218,2230,2241,2251,2261,2268,2270,2270,2270,2270,2275,2281,2289,2298,2307,2316,2327,2337,2345,2353,2360,2365,2368,2369,2368,2365,2359,2351,2342,2333,2325,2321,2321,2325,2331,2337,2344,2350,2354,2353,2347,2339,2328,2312,2297,2284,2271,2258,2243,2222,2201,2184,2167,2150,2130,2105,2081,2058,2035,2011,1979,1947,1921,1900,1883,1873,1869,1870,1877,1890,1904,1921,1935,1944,1947,1948,1946,1940,1934,1929,1923,1919,1913,1902,1891,1882,1874,1867,1863,1864,1868,1873,1877,1879,1879,1878,1877,1878,1883,1894,1911,1930,1949,1967,1989,2014,2042,2071,2096,2118,2140,2167,2192,2210,2224,2233,2233,2226,2215,2200,2185,2168,2152,2141,2137,2136,2136,2136,2140,2148,2159,2172,2184,2198,2216,2236,2257,2277,2298,2323,2349,2370,2387,2405,2420,2431,2436,2435,2430,2425,2415,2399,2380,2362,2349,2336,2320,2302,2287,2272,2258,2245,2234,2228,2230,2238,2249,2264,2284,2303,2322,2340,2361,2388,2415,2435,2449,2461,2465,2460,2449,2436,2423,2411,2401,2394,2388,2381,2375,2368,2352,2330,2307,2282,2258,2232,2201,2173,2153,2134,2113,2095,2077,2062,2054,2049,2047,2047,2050,2052,2052,2049,2042,2026,2007,1988,1970,1953,1935,1917,1900,1890,1885,1880,1877,1874,1873,1873,1875,1876,1878,1882,1886,1891,1900,1913,1929,1950,1973,1998,2028,2064,2098,2121,2139,2150,2151,2144,2131,2114,2095,2074,2044,2012,1981,1950,1919,1887,1854,1823,1800,1782,1765,1749,1731,1711,1696,1685,1679,1683,1696,1717,1744,1774,1808,1848,1885,1910,1926,1940,1949,1952,1951,1946,1939,1930,1919,1904,1889,1875,1862,1849,1841,1840,1845,1854,1865,1878,1889,1898,1904,1909,1920,1940,1967,1997,2028,2061,2094,2129,2161,2185,2200,2213,2222,2225,2223,2218,2211,2203,2193,2183,2175,2167,2159,2149,2135,2120,2109,2096,2077,2051,2015,1974,1938,1907,1877,1849,1830,1821,1819,1819,1821,1825,1834,1846,1860,1875,1891,1902,1908,1911,1913,1913,1913,1915,1920,1931,1945,1962,1982,2001,2017,2031,2044,2053,2055,2053,2048,2042,2036,2025,2011,1998,1982,1965,1950,1940,1935,1935,1938,1943,1952,1960,1966,1969,1966,1961,1957,1955,1953,1950,1948,1951,1959,1971,1986,2001,2017,2031,2041,2045,2044,2045,2042,2031,2016,2000,1984,1969,1954,1937,1922,1915,1911,1912,1916,1923,1933,1944,1953,1961,1969,1974,1975,1972,1969,1969,1973,1979,1990,2002,2013,2022,2024,2019,2013,2005,1997,1989,1979,1968,1958,1948,1937,1925,1914,1906,1901,1898,1902,1909,1918,1929,1940,1949,1956,1961,1966,1972,1984,2002,2027,2054,2081,2107,2132,2156,2174,2183,2187,2190,2191,2188,2184,2179,2174,2171,2170,2172,2175,2179,2181,2181,2180,2178,2176,2176,2179,2183,2187,2193,2199,2203,2206,2211,2214,2213,2209,2202,2187,2164,2138,2112,2086,2059,2033,2001,1969,1944,1922,1899,1881,1872,1870,1872,1875,1881,1892,1906,1920,1936,1952,1969,1988,2004,2014,2021,2024,2023,2019,2013,2006,1997,1984,1965,1946,1932,1925,1921,1917,1911,1903,1893,1880,1862,1843,1828,1818,1812,1810,1811,1818,1829,1839,1849,1860,1877,1899,1921,1946,1973,2002,2036,2070,2099,2122,2142,2156,2168,2175,2180,2185,2190,2194,2197,2196,2188,2179,2167,2150,2133,2120,2112,2107,2106,2110,2118,2126,2136,2151,2174,2199,2223,2248,2274,2301,2333,2369,2401,2429,2455,2475,2491,2503,2509,2513,2512,2499,2474,2441,2399,2354,2302,2240,2179,2131,2090,2055,2030,2007,1986,1970,1955,1941,1929,1918,1908,1899,1889,1879,1874,1875,1881,1892,1905,1921,1938,1956,1971,1985,1997,2004,2008,2009,2008,2007,2006,2008,2014,2021,2027,2034,2040,2040,2038,2033,2026,2020,2017,2017,2018,2015,2010,2005,2004,2009,2018,2030,2048,2072,2098,2119,2133,2139,2139,2132,2120,2106,2089,2072,2051,2030,2013,1998,1985,1966,1942,1918,1896,1875,1857,1840,1824,1812,1803,1795,1787,1783,1782,1788,1800,1816,1840,1874,1908,1936,1963,1987,2009,2031,2049,2063,2075,2085,2091,2097,2100,2097,2092,2086,2072,2056,2041,2028,2015,2003,1993,1986,1983,1983,1983,1988,2000,2020,2044,2073,2110,2158,2208,2253,2294,2333,2368,2407,2443,2470,2490,2505,2514,2519,2518,2510,2500,2487,2468,2448,2431,2417,2404,2391,2378,2367,2358,2352,2348,2350,2357,2368,2380,2392,2407,2428,2453,2476,2497,2517,2538,2562,2585,2600,2609,2614,2609,2596,2579,2560,2541,2517,2485,2452,2427,2408,2392,2379,2366,2357,2354,2353,2351,2347,2341,2331,2316,2297,2276,2249,2223,2205,2191,2178,2168,2161,2158,2156,2151,2143,2125,2102,2079,2051,2020,1983,1934,1886,1846,1808,1772,1740,1708,1680,1664,1652,1641,1634,1628,1625,1624,1621,1620,1626,1635,1645,1658,1674,1696,1725,1757,1784,1809,1838,1871,1901,1923,1938,1949,1953,1951,1948,1945,1943,1944,1944,1945,1947,1950,1952,1954,1950,1942,1932,1922,1913,1906,1898,1893,1892,1892,1892,1896,1903,1910,1916,1920,1923,1928,1929,1922,1908,1892,1874,1853,1832,1818,1808,1801,1798,1803,1812,1824,1839,1854,1873,1889,1900,1908,1916,1923,1928,1932,1934,1933,1933,1939,1950,1965,1982,2001,2024,2054,2083,2105,2123,2137,2151,2167,2180,2188,2193,2198,2202,2206,2213,2224,2234,2246,2256,2259,2256,2251,2245,2236,2224,2212,2204,2201,2198,2197,2199,2200,2202,2207,2214,2225,2238,2250,2260,2268,2277,2286,2291,2292,2290,2284,2275,2267,2263,2263,2265,2266,2265,2263,2259,2255,2247,2230,2208,2189,2172,2155,2134,2104,2074,2049,2024,2001,1982,1961,1942,1925,1910,1896,1880,1859,1838,1817,1797,1777,1756,1740,1732,1728,1727,1730,1732,1731,1729,1729,1730,1729,1730,1734,1736,1738,1738,1738,1741,1748,1760,1775,1797,1827,1859,1885,1906,1927,1942,1949,1948,1941,1934,1923,1908,1893,1881,1867,1852,1836,1818,1800,1785,1771,1758,1747,1738,1732,1729,1725,1722,1725,1732,1742,1758,1777,1799,1827,1858,1884,1907,1931,1956,1979,1996,2011,2024,2039,2056,2074,2090,2103,2113,2122,2134,2144,2152,2155,2154,2151,2146,2140,2132,2126,2121,2119,2121,2128,2137,2145,2153,2157,2158,2158,2160,2165,2175,2185,2191,2198,2202,2204,2204,2205,2205,2206,2213,2226,2242,2259,2276,2292,2307,2319,2323,2320,2312,2304,2293,2280,2266,2255,2245,2232,2214,2196,2179,2162,2144,2127,2110,2096,2088,2084,2082,2085,2088,2093,2100,2107,2115,2125,2136,2147,2156,2165,2171,2175,2177,2174,2168,2160,2148,2130,2108,2084,2062,2035,1999,1962,1931,1902,1876,1852,1831,1817,1812,1809,1806,1807,1810,1814,1819,1821,1825,1836,1851,1865,1879,1894,1914,1942,1975,2001,2022,2046,2070,2087,2093,2092,2089,2082,2069,2053,2040,2032,2028,2027,2032,2041,2053,2067,2082,2097,2111,2122,2127,2130,2132,2138,2147,2159,2175,2192,2214,2244,2273,2294,2310,2327,2346,2361,2368,2366,2360,2348,2329,2305,2280,2257,2238,2224,2217,2213,2211,2212,2209,2202,2191,2174,2152,2128,2101,2073,2051,2041,2038,2037,2040,2049,2061,2072,2080,2088,2096,2106,2117,2126,2131,2133,2126,2111,2094,2072,2051,2030,2007,1985,1967,1949,1928,1903,1875,1850,1828,1806,1788,1772,1761,1760,1764,1772,1787,1810,1836,1857,1875,1890,1904,1914,1923,1928,1932,1937,1944,1954,1965,1976,1988,2005,2022,2035,2045,2052,2054,2051,2045,2037,2032,2028,2024,2022,2022,2022,2025,2030,2034,2039,2044,2048,2051,2051,2050,2049,2047,2045,2043,2044,2049,2058,2070,2085,2100,2116,2132,2145,2155,2163,2168,2171,2176,2183,2190,2194,2195,2192,2182,2168,2154,2137,2117,2099,2086,2075,2066,2057,2047,2037,2029,2022,2015,2011,2009,2011,2020,2035,2053,2080,2111,2138,2163,2186,2209,2237,2268,2293,2315,2337,2360,2383,2399,2404,2400,2393,2380,2362,2344,2327,2307,2287,2264,2242,2223,2207,2190,2175,2160,2152,2153,2156,2161,2169,2176,2182,2190,2198,2207,2221,2234,2245,2255,2265,2273,2276,2274,2266,2255,2238,2212,2185,2160,2135,2111,2088,2062,2038,2023,2011,1996,1976,1957,1943,1935,1930,1927,1926,1926,1927,1928,1931,1934,1938,1943,1947,1951,1954,1958,1963,1967,1969,1968,1963,1952,1941,1929,1915,1901,1882,1856,1826,1795,1763,1723,1669,1614,1568,1529,1493,1462,1434,1412,1400,1394,1392,1399,1415,1438,1467,1497,1532,1578,1627,1670,1710,1748,1784,1823,1860,1888,1912,1936,1958,1983,2005,2019,2033,2045,2053,2059,2062,2064,2068,2073,2082,2093,2103,2112,2122,2138,2159,2180,2203,2225,2246,2271,2295,2312,2324,2335,2345,2355,2363,2365,2366,2365,2358,2346,2329,2310,2291,2271,2247,2223,2200,2177,2155,2133,2108,2081,2061,2044,2030,2026,2033,2048,2071,2093,2116,2143,2169,2189,2206,2223,2241,2265,2289,2311,2331,2355,2385,2413,2435,2457,2479,2498,2514,2524,2522,2512,2498,2476,2447,2418,2397,2381,2369,2364,2370,2384,2401,2417,2433,2450,2464,2474,2481,2487,2489,2487,2484,2475,2462,2445,2417,2384,2357,2332,2310,2291,2267,2245,2226,2205,2182,2151,2108,2064,2028,1996,1962,1927,1896,1877,1865,1854,1844,1836,1829,1826,1825,1825,1828,1832,1839,1845,1847,1848,1845,1839,1832,1823,1811,1796,1779,1760,1740,1721,1702,1682,1664,1653,1646,1639,1630,1626,1630,1637,1646,1654,1663,1672,1680,1680,1676,1671,1671,1673,1679,1688,1700,1713,1731,1749,1763,1775,1785,1793,1799,1805,1813,1823,1835,1857,1883,1905,1931,1957,1983,2016,2050,2076,2103,2128,2152,2179,2202,2214,2223,2232,2242,2258,2275,2294,2312,2328,2346,2363,2373,2381,2384,2384,2384,2383,2383,2384,2389,2399,2410,2420,2432,2443,2454,2469,2483,2491,2498,2503,2503,2498,2487,2468,2448,2425,2397,2372,2356,2344,2333,2323,2311,2300,2291,2283,2272,2258,2241,2226,2213,2202,2194,2186,2182,2183,2185,2188,2194,2203,2214,2228,2242,2258,2276,2290,2300,2305,2308,2307,2301,2294,2288,2280,2270,2257,2244,2231,2218,2207,2194,2172,2148,2128,2106,2084,2061,2028,1994,1968,1942,1918,1896,1875,1861,1858,1860,1867,1878,1889,1897,1902,1907,1913,1917,1922,1928,1931,1933,1935,1936,1933,1926,1914,1897,1876,1855,1838,1822,1808,1796,1785,1774,1764,1754,1745,1737,1730,1731,1739,1749,1762,1780,1794,1800,1801,1797,1789,1782,1775,1773,1775,1778,1783,1793,1801,1804,1806,1806,1807,1815,1827,1842,1861,1883,1907,1931,1953,1970,1987,2005,2023,2042,2066,2095,2132,2177,2216,2241,2258,2267,2269,2266,2259,2253,2250,2251,2259,2273,2285,2297,2306,2310,2311,2310,2304,2299,2294,2286,2276,2267,2258,2249,2237,2220,2203,2189,2177,2167,2159,2151,2140,2125,2104,2077,2045,2006,1965,1932,1903,1877,1855,1839,1831,1827,1822,1819,1821,1822,1825,1832,1841,1853,1870,1889,1905,1920,1934,1948,1957,1962,1965,1968,1973,1981,1992,2001,2007,2011,2014,2013,2010,2008,2004,2000,1998,2000,2006,2015,2025,2036,2052,2067,2074,2077,2079,2079,2081,2086,2091,2099,2111,2126,2145,2160,2169,2176,2175,2166,2149,2128,2104,2078,2045,2013,1985,1957,1931,1904,1875,1850,1836,1829,1830,1842,1865,1891,1914,1936,1959,1981,2001,2016,2030,2045,2061,2084,2108,2128,2144,2156,2163,2166,2160,2143,2120,2088,2048,2011,1983,1957,1932,1906,1878,1855,1840,1827,1818,1818,1828,1845,1866,1887,1908,1927,1939,1946,1951,1953,1954,1955,1958,1964,1973,1981,1990,1997,1998,1994,1988,1979,1968,1959,1954,1953,1952,1949,1945,1942,1941,1938,1934,1933,1938,1946,1957,1970,1988,2014,2042,2067,2090,2110,2127,2140,2147,2150,2154,2160,2168,2175,2177,2173,2164,2149,2123,2092,2064,2038,2012,1983,1946,1910,1882,1859,1833,1804,1775,1756,1745,1736,1726,1715,1705,1698,1696,1696,1693,1685,1673,1659,1642,1625,1608,1595,1589,1587,1585,1585,1590,1597,1603,1608,1613,1622,1636,1651,1669,1685,1702,1721,1739,1752,1766,1782,1801,1825,1848,1871,1897,1923,1950,1980,2004,2018,2027,2038,2055,2078,2098,2120,2148,2181,2221,2262,2295,2326,2359,2387,2413,2435,2450,2466,2482,2496,2509,2520,2530,2539,2539,2530,2515,2497,2479,2459,2434,2410,2389,2366,2342,2316,2290,2267,2248,2232,2220,2212,2206,2204,2206,2211,2214,2219,2224,2224,2222,2220,2218,2221,2233,2251,2274,2301,2331,2366,2396,2415,2427,2436,2442,2445,2450,2455,2460,2462,2459,2453,2443,2429,2412,2388,2358,2328,2301,2277,2253,2224,2196,2172,2149,2130,2115,2107,2111,2129,2154,2181,2212,2244,2273,2292,2300,2299,2290,2274,2255,2236,2219,2203,2186,2175,2169,2164,2157,2149,2131,2107,2086,2067,2049,2032,2018,2005,1993,1984,1977,1972,1971,1976,1984,1996,2010,2024,2038,2051,2061,2070,2074,2071,2061,2046,2029,2006,1976,1945,1919,1896,1872,1840,1803,1768,1733,1700,1669,1642,1621,1608,1598,1591,1591,1598,1613,1634,1656,1682,1720,1761,1799,1840,1882,1927,1978,2025,2058,2084,2106,2123,2134,2137,2130,2120,2105,2087,2067,2049,2033,2020,2014,2020,2035,2054,2076,2100,2127,2162,2195,2220,2242,2266,2292,2314,2331,2351,2377,2407,2448,2492,2529,2564,2598,2626,2649,2662,2668,2671,2667,2660,2651,2638,2621,2603,2580,2557,2538,2525,2519,2516,2515,2522,2532,2543,2553,2562,2568,2569,2564,2556,2548,2539,2531,2526,2521,2514,2506,2492,2471,2449,2427,2405,2382,2363,2349,2338,2328,2317,2299,2271,2237,2206,2178,2147,2113,2084,2065,2053,2047,2045,2047,2051,2055,2059,2066,2072,2077,2083,2086,2089,2091,2087,2076,2061,2042,2022,2004,1991,1990,2001,2020,2043,2072,2107,2139,2158,2170,2176,2174,2167,2159,2145,2129,2114,2094,2076,2062,2049,2039,2027,2009,1990,1971,1951,1926,1894,1858,1826,1798,1773,1747,1720,1696,1682,1675,1674,1677,1682,1687,1690,1692,1693,1695,1695,1695,1694,1694,1697,1707,1722,1743,1769,1798,1829,1862,1890,1911,1929,1944,1957,1968,1977,1983,1986,1989,1994,1997,1999,2000,2001,2000,2003,2008,2014,2019,2025,2030,2033,2029,2017,2000,1981,1964,1955,1954,1957,1970,1995,2022,2044,2067,2087,2103,2116,2123,2125,2131,2138,2146,2160,2177,2194,2212,2230,2250,2269,2282,2290,2298,2303,2310,2315,2317,2316,2312,2302,2288,2273,2258,2244,2228,2209,2188,2165,2138,2109,2078,2043,2012,1988,1969,1955,1946,1943,1947,1960,1978,2001,2028,2057,2079,2096,2109,2116,2117,2116,2111,2102,2092,2080,2068,2058,2050,2046,2048,2056,2065,2071,2072,2072,2067,2054,2037,2018,1998,1980,1963,1947,1937,1934,1938,1949,1967,1989,2010,2030,2049,2066,2083,2096,2101,2101,2099,2090,2079,2070,2057,2043,2032,2020,2008,1995,1977,1957,1937,1912,1887,1865,1842,1817,1794,1777,1771,1774,1784,1800,1822,1850,1876,1898,1915,1929,1940,1947,1947,1946,1944,1936,1924,1916,1910,1905,1902,1899,1895,1891,1883,1872,1855,1829,1799,1773,1750,1726,1706,1691,1682,1683,1692,1710,1738,1768,1799,1829,1854,1875,1897,1913,1919,1919,1912,1896,1877,1861,1846,1833,1822,1815,1814,1821,1829,1833,1837,1839,1841,1846,1851,1854,1858,1857,1851,1841,1827,1809,1790,1772,1759,1751,1745,1746,1753,1765,1780,1797,1818,1843,1863,1876,1888,1901,1912,1921,1929,1937,1948,1960,1972,1980,1987,1998,2015,2037,2061,2085,2102,2113,2119,2117,2108,2096,2081,2066,2045,2019,1995,1978,1960,1942,1922,1901,1882,1864,1846,1827,1809,1789,1769,1752,1736,1723,1713,1703,1696,1694,1700,1715,1742,1775,1806,1839,1871,1900,1932,1959,1981,2000,2020,2046,2074,2098,2122,2143,2160,2179,2195,2204,2213,2224,2232,2244,2262,2277,2292,2309,2326,2339,2345,2344,2340,2338,2340,2346,2353,2361,2373,2385,2395,2402,2402,2399,2396,2390,2385,2381,2374,2364,2350,2330,2302,2271,2240,2206,2167,2127,2096,2076,2062,2055,2052,2053,2055,2060,2063,2066,2067,2069,2074,2082,2097,2122,2148,2170,2191,2211,2232,2250,2264,2275,2280,2281,2279,2275,2266,2254,2239,2221,2198,2175,2159,2146,2133,2125,2119,2114,2117,2120,2122,2122,2118,2110,2104,2102,2105,2114,2127,2140,2151,2161,2167,2164,2159,2154,2144,2133,2121,2108,2095,2080,2061,2036,2001,1967,1941,1916,1890,1865,1836,1811,1796,1787,1780,1775,1769,1765,1769,1776,1788,1810,1838,1863,1891,1919,1944,1966,1983,1988,1987,1984,1978,1975,1975,1974,1970,1962,1946,1928,1912,1896,1878,1860,1845,1832,1821,1813,1803,1792,1783,1775,1768,1763,1759,1763,1774,1787,1803,1822,1842,1862,1875,1877,1872,1862,1847,1832,1819,1814,1814,1818,1828,1839,1850,1867,1886,1907,1937,1967,1996,2030,2069,2123,2183,2235,2284,2332,2377,2427,2473,2508,2539,2569,2597,2627,2654,2670,2680,2685,2679,2669,2660,2651,2641,2631,2617,2602,2587,2567,2545,2521,2491,2458,2430,2403,2378,2358,2344,2338,2338,2342,2351,2361,2371,2375,2372,2367,2359,2342,2321,2304,2290,2271,2241,2207,2178,2146,2111,2077,2035,1992,1958,1928,1901,1877,1856,1841,1831,1821,1816,1817,1820,1830,1848,1870,1902,1946,1994,2039,2080,2121,2159,2190,2209,2219,2226,2229,2219,2202,2183,2159,2132,2098,2052,2003,1961,1922,1880,1837,1801,1778,1763,1751,1745,1741,1739,1739,1742,1745,1752,1770,1795,1821,1847,1880,1920,1959,1989,2016,2044,2070,2094,2119,2141,2160,2177,2191,2206,2217,2221,2219,2209,2191,2171,2152,2133,2111,2089,2069,2048,2027,2007,1988,1972,1963,1960,1961,1965,1975,1996,2017,2029,2037,2043,2044,2042,2039,2035,2035,2035,2034,2037,2040,2041,2041,2039,2030,2016,1999,1984,1970,1957,1945,1935,1932,1933,1936,1945,1957,1970,1986,2005,2029,2065,2103,2134,2161,2186,2207,2225,2237,2244,2251,2256,2257,2256,2256,2254,2253,2250,2240,2223,2206,2186,2162,2131,2092,2053,2019,1989,1959,1931,1909,1895,1884,1873,1862,1850,1843,1839,1833,1826,1820,1813,1810,1812,1817,1825,1837,1849,1861,1868,1872,1871,1859,1840,1824,1812,1800,1790,1781,1776,1778,1785,1794,1807,1822,1839,1856,1874,1896,1929,1964,1992,2015,2034,2050,2064,2075,2077,2075,2073,2071,2067,2061,2050,2038,2022,1992,1954,1916,1878,1837,1793,1753,1723,1700,1681,1667,1658,1653,1651,1652,1652,1653,1657,1664,1674,1685,1696,1711,1726,1737,1747,1759,1775,1801,1833,1864,1898,1935,1975,2018,2055,2078,2090,2095,2091,2081,2065,2046,2030,2014,1998,1986,1977,1972,1971,1978,1990,2002,2014,2028,2045,2066,2089,2105,2113,2119,2120,2115,2108,2099,2089,2079,2067,2051,2034,2023,2013,1999,1981,1963,1947,1936,1928,1922,1921,1923,1931,1944,1958,1973,1994,2020,2052,2085,2126,2182,2243,2298,2349,2396,2436,2471,2498,2511,2520,2523,2519,2512,2506,2501,2500,2497,2489,2478,2467,2452,2436,2415,2383,2351,2325,2304,2279,2246,2210,2176,2142,2106,2072,2038,2010,1994,1986,1986,1996,2016,2040,2060,2078,2095,2105,2106,2101,2088,2070,2046,2008,1963,1922,1879,1837,1794,1744,1694,1656,1625,1595,1568,1549,1539,1535,1532,1535,1545,1560,1578,1600,1627,1661,1707,1756,1797,1834,1875,1919,1960,1997,2031,2064,2097,2135,2171,2194,2206,2211,2202,2180,2152,2122,2093,2061,2029,2006,1993,1986,1980,1979,1979,1975,1967,1955,1941,1928,1914,1902,1897,1897,1901,1912,1926,1937,1947,1956,1966,1981,2001,2022,2043,2065,2087,2105,2116,2122,2123,2117,2110,2107,2107,2108,2111,2121,2141,2163,2181,2198,2213,2228,2242,2253,2259,2264,2267,2269,2274,2281,2290,2303,2320,2341,2364,2384,2402,2422,2437,2444,2443,2430,2410,2381,2338,2290,2251,2218,2190,2172,2161,2156,2157,2161,2166,2171,2170,2166,2162,2158,2152,2136,2113,2092,2074,2055,2033,2009,1990,1981,1980,1983,1994,2011,2029,2045,2060,2070,2072,2066,2055,2037,2014,1987,1960,1936,1919,1906,1898,1896,1896,1900,1909,1926,1950,1982,2017,2047,2075,2100,2120,2133,2138,2135,2131,2129,2125,2124,2123,2126,2130,2132,2133,2131,2122,2107,2088,2054,2014,1980,1953,1930,1910,1893,1880,1874,1875,1878,1883,1888,1892,1894,1894,1892,1886,1874,1861,1847,1831,1816,1803,1791,1785,1784,1784,1790,1802,1816,1829,1839,1850,1864,1878,1890,1901,1913,1929,1951,1978,2005,2033,2065,2106,2152,2196,2232,2262,2292,2322,2349,2365,2377,2389,2400,2411,2425,2435,2442,2446,2448,2450,2448,2437,2417,2383,2330,2269,2211,2150,2087,2023,1956,1899,1859,1821,1784,1750,1719,1693,1675,1659,1645,1639,1637,1638,1641,1647,1658,1677,1697,1713,1724,1734,1741,1745,1744,1739,1733,1726,1714,1701,1692,1687,1685,1684,1684,1690,1704,1724,1744,1766,1786,1803,1818,1831,1839,1846,1852,1861,1873,1887,1904,1931,1962,1990,2014,2039,2065,2090,2110,2126,2138,2147,2151,2149,2140,2130,2117,2102,2082,2062,2046,2038,2034,2033,2036,2038,2040,2040,2039,2036,2028,2019,2012,2009,2012,2026,2050,2081,2112,2146,2184,2217,2240,2258,2271,2284,2300,2316,2329,2339,2347,2352,2352,2346,2337,2324,2308,2292,2280,2272,2271,2272,2275,2281,2282,2274,2262,2250,2234,2213,2195,2183,2175,2173,2180,2190,2196,2200,2205,2210,2212,2210,2206,2201,2197,2192,2189,2185,2174,2159,2139,2104,2063,2028,1999,1977,1960,1945,1935,1927,1918,1908,1890,1869,1852,1841,1833,1831,1831,1837,1846,1854,1861,1868,1868,1863,1859,1858,1856,1850,1849,1855,1865,1877,1889,1896,1896,1891,1884,1879,1877,1878,1887,1897,1903,1904,1899,1890,1878,1860,1840,1820,1795,1772,1756,1740,1723,1705,1681,1649,1617,1585,1551,1516,1489,1478,1482,1493,1511,1536,1561,1577,1589,1598,1604,1612,1621,1631,1642,1653,1662,1667,1665,1654,1640,1620,1595,1569,1548,1533,1522,1515,1510,1508,1506,1501,1492,1482,1470,1464,1472,1492,1526,1581,1649,1714,1776,1842,1910,1971,2016,2049,2076,2096,2112,2125,2129,2126,2119,2108,2090,2068,2043,2017,1989,1962,1941,1925,1914,1901,1889,1876,1863,1854,1851,1852,1858,1874,1902,1937,1978,2029,2094,2160,2212,2256,2296,2333,2369,2403,2427,2446,2460,2469,2476,2475,2466,2451,2432,2406,2381,2362,2347,2332,2319,2310,2305,2304,2307,2310,2314,2320,2331,2344,2358,2379,2410,2444,2472,2497,2517,2526,2528,2522,2513,2504,2493,2483,2480,2480,2475,2467,2455,2428,2392,2354,2312,2266,2218,2163,2113,2080,2056,2034,2020,2013,2009,2008,2007,2009,2018,2034,2060,2095,2133,2171,2206,2233,2249,2256,2255,2243,2227,2212,2198,2186,2175,2158,2136,2111,2081,2047,2003,1940,1874,1819,1768,1712,1654,1603,1566,1539,1515,1498,1489,1486,1492,1507,1527,1557,1596,1635,1668,1695,1722,1748,1768,1782,1793,1805,1819,1834,1848,1856,1859,1861,1861,1853,1841,1833,1830,1835,1854,1884,1920,1960,2007,2062,2123,2177,2219,2256,2292,2328,2364,2395,2416,2431,2446,2459,2467,2469,2467,2465,2462,2461,2463,2468,2473,2478,2483,2485,2487,2487,2483,2473,2461,2454,2454,2457,2457,2458,2461,2464,2465,2464,2462,2464,2466,2470,2479,2490,2506,2530,2554,2572,2588,2603,2615,2623,2626,2622,2615,2601,2581,2560,2542,2528,2514,2500,2485,2472,2465,2458,2451,2447,2443,2437,2431,2426,2419,2409,2396,2379,2362,2347,2336,2325,2312,2294,2273,2250,2221,2182,2137,2094,2055,2012,1960,1908,1868,1836,1808,1780,1751,1728,1718,1713,1710,1715,1727,1744,1767,1796,1833,1880,1929,1974,2011,2044,2079,2115,2146,2168,2186,2201,2215,2229,2235,2233,2229,2224,2210,2190,2169,2150,2133,2107,2067,2023,1985,1947,1908,1861,1806,1752,1711,1679,1648,1621,1607,1607,1610,1612,1618,1627,1633,1637,1636,1631,1625,1620,1616,1612,1607,1601,1598,1597,1594,1594,1597,1604,1617,1631,1646,1663,1681,1699,1712,1720,1723,1724,1724,1729,1742,1762,1786,1816,1857,1914,1977,2034,2087,2142,2197,2241,2270,2289,2302,2305,2298,2285,2267,2244,2218,2186,2148,2111,2076,2042,2006,1964,1924,1890,1851,1808,1762,1708,1655,1619,1594,1578,1578,1595,1623,1658,1700,1756,1828,1897,1950,1993,2032,2064,2092,2110,2116,2117,2116,2109,2098,2085,2077,2072,2063,2047,2032,2019,2005,1987,1963,1931,1897,1870,1850,1833,1824,1827,1843,1869,1898,1933,1978,2024,2057,2084,2107,2128,2153,2178,2199,2221,2244,2265,2283,2295,2302,2308,2307,2298,2287,2276,2265,2253,2239,2222,2203,2184,2165,2146,2126,2114,2110,2112,2114,2120,2135,2155,2172,2184,2192,2199,2204,2207,2211,2217,2230,2251,2275,2292,2304,2313,2318,2315,2306,2294,2282,2269,2258,2251,2249,2254,2261,2271,2284,2301,2321,2339,2356,2375,2395,2412,2422,2424,2419,2406,2381,2354,2329,2303,2277,2254,2236,2224,2213,2200,2184,2162,2137,2111,2084,2056,2028,2000,1974,1954,1938,1924,1911,1903,1899,1893,1888,1886,1891,1899,1906,1914,1921,1921,1909,1888,1860,1828,1791,1747,1704,1671,1644,1622,1607,1595,1585,1576,1570,1566,1559,1551,1543,1537,1533,1528,1521,1518,1522,1528,1536,1546,1560,1582,1610,1640,1676,1720,1762,1795,1819,1839,1855,1863,1861,1851,1839,1828,1815,1799,1780,1762,1744,1725,1702,1675,1645,1617,1592,1568,1546,1527,1516,1511,1512,1521,1541,1568,1598,1626,1655,1691,1728,1759,1786,1809,1825,1836,1839,1836,1829,1816,1797,1772,1749,1733,1722,1712,1707,1708,1710,1716,1725,1738,1762,1788,1809,1830,1853,1880,1911,1941,1974,2011,2050,2097,2142,2175,2203,2229,2251,2273,2291,2300,2306,2311,2313,2314,2318,2322,2325,2324,2319,2315,2313,2310,2302,2291,2279,2266,2255,2244,2230,2214,2197,2185,2178,2173,2171,2178,2189,2203,2220,2239,2258,2280,2299,2312,2319,2325,2324,2317,2307,2294,2283,2274,2260,2245,2235,2224,2215,2206,2194,2182,2173,2162,2149,2135,2122,2113,2106,2098,2090,2082,2075,2067,2055,2039,2020,1995,1969,1948,1934,1922,1911,1903,1900,1900,1904,1909,1916,1924,1931,1938,1942,1941,1938,1938,1940,1944,1948,1951,1954,1957,1963,1972,1983,1996,2008,2016,2019,2021,2020,2016,2005,1989,1973,1955,1936,1918,1902,1886,1870,1852,1826,1800,1780,1763,1747,1733,1723,1721,1726,1736,1750,1774,1801,1827,1854,1882,1914,1957,2001,2038,2069,2096,2122,2142,2153,2160,2166,2168,2172,2180,2188,2196,2204,2210,2214,2209,2199,2187,2171,2157,2146,2143,2151,2165,2188,2226,2273,2317,2357,2390,2417,2438,2449,2450,2448,2444,2436,2425,2414,2407,2403,2400,2398,2395,2391,2388,2387,2386,2384,2381,2381,2380,2374,2367,2358,2352,2353,2360,2376,2402,2435,2471,2512,2554,2599,2649,2697,2738,2774,2813,2856,2893,2917,2933,2943,2948,2949,2947,2937,2923,2906,2876,2843,2816,2790,2764,2736,2698,2659,2627,2597,2567,2537,2502,2470,2448,2428,2409,2394,2379,2367,2355,2342,2328,2314,2299,2285,2269,2250,2231,2209,2182,2155,2128,2099,2071,2044,2023,2004,1988,1978,1973,1969,1965,1962,1959,1959,1959,1960,1963,1966,1969,1980,2000,2022,2047,2072,2096,2123,2149,2167,2183,2197,2202,2198,2185,2163,2137,2106,2067,2027,1991,1958,1928,1903,1884,1871,1860,1847,1834,1816,1789,1755,1720,1687,1651,1609,1572,1550,1542,1544,1558,1585,1620,1657,1694,1735,1781,1825,1858,1886,1911,1933,1952,1969,1977,1978,1973,1962,1940,1913,1887,1863,1839,1815,1796,1786,1783,1782,1783,1788,1797,1810,1825,1841,1858,1879,1901,1922,1941,1961,1985,2006,2021,2032,2040,2044,2046,2046,2045,2047,2049,2048,2046,2042,2033,2023,2007,1984,1958,1938,1921,1905,1896,1893,1894,1900,1910,1925,1949,1981,2016,2050,2085,2124,2172,2218,2253,2278,2298,2313,2323,2326,2323,2319,2318,2316,2313,2308,2300,2288,2265,2223,2172,2123,2077,2031,1987,1949,1919,1901,1894,1892,1897,1909,1926,1947,1968,1998,2046,2103,2160,2219,2277,2332,2388,2433,2456,2467,2473,2473,2472,2473,2471,2473,2472,2463,2449,2431,2405,2374,2333,2279,2227,2188,2154,2119,2090,2068,2054,2045,2038,2032,2031,2030,2031,2036,2043,2053,2066,2076,2082,2086,2089,2092,2098,2106,2119,2135,2153,2175,2195,2207,2213,2215,2211,2202,2190,2176,2164,2153,2142,2134,2134,2135,2136,2142,2154,2172,2196,2223,2256,2294,2333,2367,2389,2405,2414,2411,2396,2374,2348,2325,2305,2286,2272,2261,2248,2233,2207,2165,2116,2069,2024,1973,1912,1856,1811,1771,1734,1701,1664,1629,1607,1589,1570,1556,1546,1542,1545,1551,1564,1585,1607,1626,1644,1661,1676,1698,1726,1753,1782,1817,1858,1898,1928,1950,1967,1980,1992,2005,2014,2020,2024,2024,2022,2022,2023,2022,2021,2022,2021,2020,2019,2017,2017,2019,2020,2023,2028,2030,2031,2032,2030,2025,2020,2015,2010,2006,2001,1992,1977,1959,1940,1922,1908,1899,1893,1895,1907,1925,1942,1960,1979,1997,2006,2006,2002,1996,1987,1974,1959,1945,1939,1937,1936,1936,1939,1942,1946,1951,1960,1969,1978,1990,2003,2017,2036,2054,2066,2073,2079,2084,2089,2094,2099,2105,2111,2115,2118,2118,2115,2107,2094,2074,2052,2034,2019,2003,1986,1973,1962,1950,1939,1931,1920,1908,1895,1876,1858,1838,1815,1794,1779,1766,1753,1741,1733,1730,1734,1740,1751,1764,1777,1787,1797,1805,1809,1810,1809,1811,1815,1825,1838,1853,1867,1880,1893,1908,1927,1948,1969,1988,2003,2016,2028,2037,2044,2049,2054,2056,2054,2051,2048,2046,2048,2050,2053,2054,2054,2050,2036,2009,1971,1932,1894,1853,1808,1772,1752,1738,1726,1719,1712,1708,1711,1714,1717,1724,1732,1742,1752,1762,1776,1799,1826,1847,1865,1884,1904,1929,1957,1983,2009,2036,2064,2094,2124,2148,2169,2187,2201,2209,2212,2213,2213,2212,2207,2203,2198,2192,2181,2170,2162,2155,2153,2153,2155,2165,2182,2201,2222,2242,2264,2288,2307,2317,2323,2327,2326,2322,2316,2310,2306,2304,2301,2296,2291,2285,2277,2266,2250,2232,2218,2202,2183,2168,2158,2155,2160,2169,2183,2209,2239,2270,2304,2337,2374,2414,2450,2476,2496,2511,2523,2530,2530,2528,2528,2527,2522,2517,2508,2498,2487,2472,2447,2416,2389,2364,2339,2313,2290,2278,2277,2282,2295,2318,2343,2365,2384,2400,2413,2426,2436,2443,2445,2444,2439,2431,2420,2406,2389,2367,2340,2313,2291,2273,2257,2241,2229,2219,2207,2192,2173,2142,2103,2067,2029,1992,1957,1921,1890,1869,1855,1845,1841,1839,1839,1844,1850,1858,1866,1872,1875,1877,1879,1877,1865,1842,1815,1785,1750,1707,1666,1636,1614,1600,1594,1592,1595,1603,1608,1611,1616,1622,1630,1637,1639,1644,1655,1668,1679,1690,1702,1721,1746,1770,1791,1809,1825,1840,1859,1876,1888,1901,1916,1930,1946,1961,1973,1987,2000,2010,2018,2019,2016,2012,2004,1990,1976,1968,1964,1963,1971,1984,1994,2002,2010,2017,2025,2030,2034,2039,2043,2047,2057,2068,2080,2095,2112,2130,2148,2164,2181,2195,2208,2220,2230,2233,2232,2225,2210,2193,2179,2166,2153,2140,2131,2127,2128,2131,2135,2144,2155,2165,2168,2166,2163,2158,2151,2141,2133,2128,2124,2118,2109,2102,2096,2092,2090,2091,2094,2101,2111,2122,2134,2145,2154,2162,2171,2180,2184,2183,2179,2169,2154,2133,2108,2084,2068,2057,2048,2042,2042,2048,2060,2073,2090,2108,2126,2140,2149,2156,2162,2165,2167,2168,2167,2168,2175,2181,2187,2193,2197,2201,2207,2215,2224,2235,2246,2257,2271,2287,2302,2317,2333,2352,2369,2383,2395,2403,2405,2400,2391,2381,2369,2353,2331,2308,2292,2276,2262,2247,2225,2200,2178,2154,2129,2104,2073,2041,2015,1994,1974,1956,1944,1939,1937,1937,1943,1949,1955,1961,1966,1970,1973,1972,1964,1953,1938,1920,1898,1878,1863,1853,1847,1848,1859,1875,1890,1902,1908,1910,1911,1911,1911,1910,1915,1931,1956,1984,2016,2052,2090,2132,2170,2195,2215,2237,2254,2267,2277,2285,2296,2306,2312,2313,2305,2286,2262,2230,2185,2135,2092,2051,2010,1972,1928,1883,1847,1819,1793,1771,1756,1752,1761,1777,1804,1849,1899,1944,1986,2024,2058,2095,2130,2155,2174,2192,2214,2236,2253,2269,2283,2294,2302,2305,2302,2294,2284,2275,2271,2271,2271,2273,2274,2269,2258,2247,2236,2225,2215,2206,2203,2210,2223,2238,2255,2273,2287,2300,2313,2324,2336,2347,2356,2364,2371,2374,2373,2367,2356,2342,2322,2292,2261,2234,2210,2189,2173,2162,2155,2151,2145,2138,2129,2115,2100,2091,2085,2083,2088,2098,2112,2126,2138,2150,2165,2178,2187,2197,2208,2220,2237,2251,2256,2255,2250,2232,2204,2170,2129,2086,2041,1990,1945,1915,1892,1876,1864,1846,1827,1812,1799,1785,1768,1752,1741,1732,1726,1723,1717,1708,1699,1691,1683,1679,1679,1686,1694,1702,1715,1733,1751,1760,1761,1757,1745,1723,1696,1671,1650,1634,1623,1621,1627,1634,1642,1653,1663,1673,1685,1697,1710,1722,1734,1750,1766,1778,1792,1809,1825,1840,1855,1867,1878,1893,1904,1907,1903,1897,1886,1869,1846,1820,1793,1763,1734,1714,1707,1709,1717,1730,1748,1767,1783,1798,1813,1827,1840,1849,1854,1857,1857,1855,1853,1854,1859,1866,1878,1897,1922,1947,1973,1996,2017,2039,2053,2056,2056,2053,2043,2028,2013,2001,1994,1992,1992,1993,1997,2003,2008,2013,2018,2025,2034,2042,2050,2057,2065,2074,2082,2086,2089,2094,2100,2109,2121,2138,2164,2194,2220,2244,2268,2293,2319,2338,2346,2349,2350,2348,2346,2344,2345,2352,2360,2370,2384,2398,2414,2433,2456,2482,2509,2533,2553,2572,2583,2583,2575,2561,2543,2517,2479,2438,2402,2366,2329,2294,2260,2229,2202,2175,2151,2125,2094,2062,2036,2016,2001,1992,1990,1994,1999,2004,2016,2032,2052,2076,2101,2124,2148,2173,2200,2224,2243,2258,2274,2288,2298,2304,2306,2303,2296,2286,2273,2258,2239,2212,2178,2140,2100,2065,2030,1988,1947,1918,1894,1872,1853,1832,1813,1797,1785,1776,1771,1768,1766,1768,1769,1771,1771,1769,1764,1755,1744,1734,1722,1709,1701,1692,1682,1674,1667,1658,1645,1631,1615,1598,1582,1568,1555,1546,1541,1538,1539,1546,1555,1567,1585,1606,1627,1650,1676,1704,1735,1763,1783,1795,1801,1798,1787,1770,1750,1732,1718,1713,1716,1725,1740,1759,1781,1810,1835,1851,1863,1874,1878,1877,1871,1862,1854,1845,1834,1827,1824,1823,1824,1826,1833,1845,1860,1877,1896,1917,1941,1964,1979,1988,1994,1998,2002,2006,2012,2021,2035,2057,2083,2106,2128,2149,2171,2192,2209,2219,2226,2231,2230,2222,2211,2201,2192,2179,2163,2145,2132,2123,2117,2112,2114,2123,2131,2142,2156,2171,2184,2191,2192,2187,2179,2164,2149,2140,2132,2124,2115,2104,2097,2091,2084,2076,2068,2057,2042,2022,1997,1966,1926,1883,1851,1826,1802,1781,1769,1769,1776,1789,1811,1843,1875,1903,1926,1950,1977,2007,2032,2051,2066,2080,2091,2101,2106,2107,2106,2101,2092,2081,2072,2064,2057,2046,2029,2013,2000,1988,1972,1950,1926,1907,1891,1874,1860,1850,1844,1842,1845,1851,1864,1888,1919,1952,1988,2030,2079,2126,2163,2192,2219,2240,2255,2264,2266,2264,2262,2252,2234,2210,2181,2151,2114,2065,2015,1974,1936,1898,1861,1822,1788,1767,1752,1739,1733,1731,1736,1751,1771,1797,1835,1877,1913,1944,1971,1992,2008,2015,2014,2011,2008,2007,2010,2014,2016,2018,2018,2013,2003,1990,1976,1961,1945,1930,1918,1912,1910,1912,1923,1944,1969,1999,2033,2075,2133,2197,2258,2316,2373,2430,2486,2529,2554,2567,2571,2563,2548,2531,2514,2496,2470,2432,2389,2349,2309,2267,2223,2177,2135,2105,2080,2056,2035,2017,2005,1998,1991,1985,1983,1986,1995,2011,2034,2068,2117,2171,2218,2261,2305,2345,2369,2377,2373,2362,2340,2307,2271,2236,2200,2166,2134,2103,2081,2074,2077,2091,2122,2162,2203,2243,2282,2321,2363,2399,2425,2443,2458,2473,2488,2501,2517,2534,2550,2569,2583,2586,2584,2578,2564,2539,2508,2474,2439,2399,2348,2293,2240,2184,2127,2069,2008,1956,1921,1895,1877,1870,1872,1879,1888,1895,1903,1913,1925,1936,1945,1954,1966,1984,2003,2019,2031,2040,2041,2035,2022,2005,1987,1967,1940,1911,1885,1859,1835,1808,1769,1730,1700,1677,1659,1652,1656,1670,1693,1718,1748,1784,1817,1841,1860,1874,1885,1895,1899,1897,1892,1884,1872,1856,1835,1811,1787,1758,1721,1684,1652,1622,1595,1565,1528,1490,1459,1433,1407,1384,1371,1372,1388,1414,1453,1509,1570,1627,1681,1733,1784,1839,1890,1933,1970,2006,2042,2076,2104,2128,2152,2175,2202,2228,2249,2269,2290,2307,2322,2333,2336,2332,2323,2303,2277,2249,2221,2195,2173,2154,2141,2138,2138,2139,2145,2155,2166,2176,2183,2187,2193,2198,2199,2197,2190,2177,2156,2132,2109,2091,2073,2057,2042,2033,2026,2020,2016,2012,2008,2001,1996,1993,1990,1989,1991,1998,2009,2022,2037,2057,2080,2099,2117,2141,2174,2209,2240,2267,2293,2320,2347,2371,2385,2391,2392,2387,2378,2369,2360,2353,2345,2335,2323,2310,2299,2287,2273,2253,2230,2211,2196,2182,2169,2162,2160,2158,2155,2153,2151,2151,2152,2153,2156,2158,2157,2157,2155,2150,2145,2139,2130,2116,2098,2079,2058,2030,1998,1968,1940,1913,1888,1863,1839,1823,1812,1805,1805,1811,1823,1838,1853,1871,1889,1902,1910,1915,1918,1923,1928,1932,1934,1933,1930,1929,1927,1925,1925,1927,1931,1935,1940,1943,1944,1941,1931,1913,1889,1863,1835,1804,1772,1741,1717,1699,1687,1677,1665,1654,1649,1644,1638,1634,1633,1639,1651,1669,1695,1731,1771,1807,1839,1867,1894,1919,1938,1950,1958,1965,1972,1978,1984,1990,1997,2003,2012,2024,2036,2053,2077,2104,2135,2161,2179,2191,2195,2186,2170,2151,2130,2109,2085,2057,2035,2021,2010,1999,1987,1975,1964,1953,1944,1934,1924,1913,1906,1904,1902,1898,1898,1900,1902,1908,1916,1927,1949,1977,2003,2031,2059,2086,2109,2120,2122,2124,2121,2111,2101,2092,2085,2081,2080,2084,2090,2096,2100,2109,2121,2131,2137,2141,2140,2134,2123,2106,2086,2069,2052,2036,2025,2022,2030,2043,2063,2095,2132,2164,2190,2208,2214,2211,2202,2189,2173,2156,2138,2120,2105,2093,2081,2066,2046,2026,2009,1992,1974,1958,1944,1934,1927,1922,1919,1918,1919,1920,1918,1915,1911,1906,1901,1898,1896,1896,1898,1894,1884,1870,1854,1833,1803,1767,1736,1711,1690,1670,1648,1628,1613,1598,1582,1566,1548,1528,1513,1503,1497,1492,1493,1500,1508,1518,1533,1548,1563,1575,1584,1591,1600,1609,1619,1629,1639,1653,1673,1693,1710,1726,1738,1746,1750,1751,1752,1754,1756,1758,1764,1772,1783,1802,1824,1852,1886,1920,1951,1983,2012,2041,2065,2082,2093,2104,2109,2114,2120,2124,2125,2126,2124,2121,2117,2110,2100,2087,2064,2036,2011,1987,1961,1935,1907,1884,1871,1861,1856,1859,1868,1882,1900,1918,1942,1979,2017,2048,2078,2111,2145,2174,2196,2213,2228,2239,2251,2263,2270,2274,2279,2288,2301,2312,2317,2320,2322,2322,2321,2319,2314,2308,2303,2297,2288,2282,2276,2268,2260,2256,2255,2256,2259,2269,2289,2308,2322,2330,2336,2335,2321,2299,2273,2245,2215,2183,2148,2117,2097,2087,2084,2085,2088,2093,2098,2101,2100,2099,2098,2100,2101,2101,2101,2102,2102,2104,2105,2106,2112,2124,2135,2147,2161,2176,2190,2205,2219,2230,2239,2244,2248,2256,2265,2272,2280,2290,2301,2312,2327,2343,2356,2368,2377,2384,2387,2383,2375,2364,2348,2325,2297,2264,2222,2178,2139,2102,2065,2031,1996,1963,1938,1916,1896,1880,1870,1867,1871,1880,1899,1930,1963,1993,2024,2052,2078,2107,2133,2151,2164,2178,2195,2214,2234,2254,2271,2280,2280,2274,2260,2235,2205,2168,2119,2069,2029,1995,1960,1919,1878,1844,1817,1794,1774,1758,1748,1750,1765,1787,1817,1856,1900,1938,1973,2009,2045,2074,2093,2104,2115,2123,2127,2129,2123,2109,2090,2061,2018,1968,1919,1874,1827,1775,1729,1697,1672,1653,1641,1633,1628,1630,1639,1654,1678,1715,1762,1812,1864,1929,2008,2085,2148,2204,2252,2288,2321,2347,2362,2370,2375,2378,2381,2382,2378,2371,2355,2330,2301,2269,2236,2206,2177,2146,2118,2097,2080,2067,2059,2053,2047,2044,2043,2050,2067,2086,2111,2140,2170,2204,2245,2282,2310,2332,2347,2356,2360,2358,2351,2343,2327,2299,2269,2241,2208,2170,2129,2078,2028,1993,1965,1936,1908,1882,1859,1840,1822,1808,1797,1788,1784,1786,1792,1806,1832,1860,1886,1907,1925,1940,1950,1955,1958,1957,1956,1960,1972,1988,2004,2020,2040,2061,2077,2085,2087,2083,2074,2063,2054,2047,2043,2034,2022,2012,2002,1994,1992,1991,1992,2001,2012,2024,2039,2049,2051,2047,2039,2028,2010,1979,1947,1921,1900,1880,1860,1847,1842,1839,1837,1836,1834,1833,1831,1828,1826,1830,1841,1860,1878,1894,1913,1936,1957,1975,1992,2010,2032,2060,2086,2103,2115,2122,2123,2117,2104,2088,2075,2065,2059,2059,2061,2065,2071,2078,2084,2087,2086,2082,2074,2063,2053,2044,2041,2044,2050,2060,2072,2079,2081,2076,2065,2052,2040,2032,2030,2032,2041,2059,2081,2104,2127,2149,2173,2195,2212,2227,2243,2263,2285,2303,2313,2319,2324,2326,2327,2326,2323,2322,2326,2338,2355,2372,2393,2416,2442,2471,2499,2519,2532,2545,2554,2558,2560,2560,2559,2555,2544,2529,2513,2493,2470,2447,2425,2410,2403,2400,2402,2405,2406,2404,2399,2390,2378,2359,2340,2324,2308,2291,2274,2252,2226,2200,2179,2156,2128,2098,2071,2044,2016,1991,1963,1937,1919,1904,1892,1884,1875,1869,1867,1865,1862,1860,1858,1858,1858,1856,1851,1841,1830,1822,1818,1818,1823,1835,1852,1870,1883,1892,1895,1893,1888,1880,1869,1857,1844,1836,1832,1828,1827,1826,1824,1823,1823,1825,1825,1820,1812,1804,1795,1783,1766,1744,1721,1699,1676,1655,1633,1610,1593,1586,1582,1579,1580,1584,1585,1582,1575,1565,1552,1540,1530,1520,1512,1510,1512,1516,1519,1523,1530,1542,1555,1569,1584,1599,1620,1646,1673,1696,1719,1742,1767,1792,1813,1832,1851,1868,1885,1899,1907,1914,1921,1925,1928,1928,1929,1933,1938,1952,1971,1990,2012,2036,2064,2096,2126,2148,2167,2182,2195,2213,2231,2245,2258,2268,2275,2284,2291,2294,2297,2301,2310,2324,2335,2347,2361,2371,2381,2390,2396,2402,2407,2406,2403,2401,2402,2405,2409,2419,2431,2441,2452,2466,2476,2484,2490,2491,2490,2488,2483,2477,2471,2464,2459,2454,2447,2438,2430,2422,2415,2407,2397,2386,2372,2359,2339,2307,2271,2241,2211,2183,2158,2131,2109,2098,2092,2090,2092,2098,2109,2122,2131,2141,2154,2168,2181,2191,2199,2208,2217,2223,2227,2227,2223,2210,2192,2171,2146,2119,2090,2053,2015,1982,1952,1924,1896,1861,1828,1802,1781,1763,1749,1737,1731,1731,1735,1745,1760,1779,1798,1817,1837,1863,1897,1936,1973,2004,2035,2069,2102,2127,2143,2154,2156,2150,2140,2128,2114,2100,2085,2065,2048,2035,2022,2013,2006,1998,1989,1984,1982,1983,1987,1991,1994,2000,2008,2014,2016,2018,2019,2020,2022,2030,2040,2052,2066,2080,2094,2109,2123,2133,2144,2148,2148,2149,2146,2138,2130,2116,2098,2081,2066,2054,2044,2037,2034,2030,2026,2024,2017,2006,1989,1966,1940,1915,1891,1873,1863,1861,1870,1887,1911,1947,1987,2020,2048,2076,2108,2139,2163,2185,2205,2222,2237,2248,2249,2245,2235,2221,2204,2186,2170,2159,2150,2144,2143,2145,2147,2145,2140,2128,2110,2087,2064,2042,2022,2006,1994,1991,1993,1995,1998,2002,2005,2006,2004,2003,2007,2016,2029,2042,2061,2083,2106,2129,2144,2153,2162,2169,2169,2167,2165,2162,2163,2165,2171,2180,2188,2197,2205,2208,2206,2201,2193,2179,2153,2123,2098,2076,2060,2048,2038,2034,2036,2040,2049,2061,2071,2081,2090,2099,2107,2112,2117,2118,2117,2115,2110,2103,2095,2086,2076,2061,2041,2024,2011,1995,1977,1957,1928,1896,1866,1836,1802,1765,1726,1692,1669,1654,1647,1647,1650,1653,1656,1662,1667,1667,1664,1658,1653,1649,1645,1644,1642,1640,1640,1643,1650,1656,1660,1663,1667,1674,1687,1702,1715,1728,1741,1752,1763,1777,1792,1807,1824,1847,1874,1901,1929,1956,1980,2005,2025,2037,2040,2039,2031,2015,1994,1974,1955,1932,1905,1879,1861,1845,1828,1811,1794,1780,1773,1771,1770,1773,1780,1789,1799,1811,1826,1846,1870,1895,1923,1954,1991,2035,2083,2125,2163,2206,2258,2308,2346,2375,2400,2419,2432,2437,2432,2420,2403,2381,2355,2329,2305,2284,2262,2240,2225,2217,2210,2200,2190,2182,2175,2170,2166,2163,2163,2167,2172,2179,2188,2197,2207,2214,2218,2225,2234,2242,2248,2250,2246,2242,2235,2222,2204,2180,2155,2135,2113,2087,2065,2051,2043,2043,2051,2076,2114,2156,2201,2250,2303,2365,2427,2478,2523,2569,2611,2646,2670,2688,2703,2716,2725,2733,2737,2737,2738,2736,2729,2715,2697,2677,2648,2605,2558,2516,2477,2437,2392,2341,2296,2263,2237,2214,2199,2193,2197,2208,2218,2231,2248,2262,2271,2278,2281,2281,2280,2276,2267,2258,2251,2239,2220,2200,2180,2161,2139,2105,2067,2034,2002,1971,1941,1907,1875,1851,1830,1809,1786,1763,1745,1733,1724,1721,1727,1739,1751,1760,1768,1771,1768,1761,1751,1738,1723,1706,1690,1674,1655,1637,1618,1592,1566,1541,1515,1491,1465,1436,1411,1397,1388,1381,1375,1371,1368,1365,1359,1353,1352,1353,1361,1376,1397,1429,1478,1534,1580,1622,1666,1714,1756,1788,1811,1829,1845,1857,1862,1859,1852,1846,1845,1848,1850,1853,1860,1868,1875,1886,1900,1914,1925,1935,1944,1951,1956,1961,1965,1974,1984,1995,2010,2026,2047,2078,2109,2134,2158,2182,2208,2236,2261,2283,2299,2314,2330,2342,2348,2354,2361,2371,2386,2400,2414,2429,2440,2450,2458,2461,2466,2469,2467,2463,2456,2446,2436,2426,2415,2407,2401,2397,2399,2403,2412,2429,2452,2472,2490,2508,2527,2543,2552,2556,2559,2559,2551,2538,2528,2519,2515,2513,2510,2505,2501,2496,2487,2471,2452,2434,2416,2397,2375,2347,2321,2302,2285,2270,2256,2241,2233,2231,2229,2229,2227,2223,2220,2221,2221,2223,2230,2239,2247,2255,2263,2268,2272,2278,2283,2286,2287,2283,2275,2265,2250,2230,2202,2166,2127,2088,2051,2013,1970,1932,1905,1881,1863,1853,1847,1844,1844,1845,1845,1841,1832,1823,1817,1814,1816,1824,1836,1849,1864,1879,1892,1910,1929,1944,1958,1970,1980,1992,2005,2018,2029,2040,2055,2074,2093,2109,2122,2133,2148,2164,2176,2188,2199,2213,2232,2250,2262,2272,2276,2276,2275,2269,2261,2255,2250,2244,2239,2237,2238,2243,2252,2266,2281,2292,2299,2301,2299,2292,2282,2268,2253,2236,2214,2191,2171,2152,2134,2118,2102,2089,2083,2083,2087,2098,2111,2121,2127,2131,2133,2129,2117,2100,2081,2060,2034,2009,1988,1974,1964,1962,1972,1988,2007,2028,2051,2076,2107,2140,2169,2194,2221,2246,2267,2281,2290,2296,2298,2294,2287,2281,2275,2270,2268,2268,2267,2266,2266,2263,2255,2242,2223,2199,2172,2138,2099,2064,2041,2025,2015,2013,2018,2028,2041,2052,2060,2066,2067,2064,2060,2054,2047,2040,2036,2035,2034,2034,2033,2030,2028,2023,2017,2014,2010,2007,2007,2008,2011,2014,2012,2005,1989,1966,1942,1913,1877,1847,1826,1810,1800,1795,1795,1801,1808,1812,1815,1817,1817,1816,1816,1818,1822,1830,1840,1850,1861,1870,1874,1873,1868,1858,1846,1827,1803,1778,1756,1734,1712,1688,1664,1641,1618,1595,1574,1557,1544,1539,1536,1535,1542,1553,1564,1574,1583,1591,1601,1611,1618,1625,1631,1640,1653,1669,1683,1697,1713,1733,1756,1781,1803,1823,1843,1864,1883,1898,1908,1915,1920,1921,1919,1916,1915,1916,1919,1928,1941,1956,1972,1991,2013,2033,2050,2065,2078,2087,2093,2097,2097,2095,2090,2084,2076,2067,2061,2057,2053,2050,2050,2051,2053,2055,2059,2061,2059,2053,2044,2034,2019,2001,1985,1973,1962,1958,1961,1968,1980,1997,2018,2046,2083,2120,2153,2181,2208,2232,2250,2259,2265,2268,2269,2272,2279,2288,2300,2315,2330,2348,2366,2376,2383,2384,2372,2349,2318,2281,2241,2197,2146,2097,2062,2036,2014,1998,1992,1997,2011,2029,2052,2085,2120,2148,2171,2191,2201,2200,2190,2173,2151,2125,2096,2064,2037,2021,2010,2002,2004,2015,2032,2051,2069,2088,2107,2119,2121,2120,2116,2110,2103,2100,2101,2105,2116,2138,2165,2189,2214,2241,2268,2295,2318,2331,2339,2344,2344,2339,2332,2322,2312,2298,2279,2264,2252,2239,2228,2221,2216,2214,2214,2215,2217,2214,2205,2192,2175,2154,2131,2106,2082,2066,2056,2049,2045,2047,2053,2058,2061,2064,2064,2061,2055,2043,2028,2007,1972,1935,1901,1865,1831,1797,1759,1725,1704,1688,1674,1665,1659,1661,1667,1674,1684,1701,1719,1734,1751,1769,1789,1816,1845,1867,1886,1905,1926,1946,1962,1973,1985,1993,1994,1991,1982,1967,1948,1923,1891,1858,1830,1809,1788,1769,1755,1748,1745,1742,1741,1740,1737,1732,1730,1730,1730,1733,1738,1746,1756,1774,1800,1830,1857,1884,1912,1943,1976,2002,2015,2023,2028,2025,2011,1990,1969,1950,1928,1904,1887,1879,1877,1879,1885,1900,1920,1940,1963,1989,2021,2053,2082,2110,2139,2166,2190,2212,2228,2245,2263,2282,2307,2338,2366,2391,2418,2442,2456,2459,2451,2434,2406,2363,2313,2269,2231,2196,2166,2140,2123,2118,2117,2118,2127,2139,2150,2163,2174,2186,2198,2208,2213,2214,2210,2200,2185,2169,2157,2148,2144,2146,2158,2179,2206,2232,2260,2289,2311,2323,2330,2331,2326,2312,2297,2287,2280,2275,2276,2285,2295,2305,2319,2336,2360,2387,2407,2424,2444,2461,2477,2486,2484,2476,2465,2436,2400,2367,2334,2302,2271,2236,2209,2194,2179,2165,2148,2124,2097,2071,2040,2002,1957,1913,1879,1852,1829,1812,1802,1800,1807,1816,1827,1845,1864,1880,1895,1909,1924,1939,1953,1964,1974,1983,1993,2004,2015,2024,2035,2052,2073,2095,2116,2134,2149,2162,2172,2174,2172,2166,2157,2149,2144,2141,2143,2149,2161,2182,2208,2232,2256,2278,2296,2310,2318,2315,2309,2298,2281,2263,2246,2232,2221,2212,2205,2204,2207,2216,2228,2243,2263,2285,2305,2324,2340,2356,2372,2387,2396,2401,2405,2408,2409,2407,2405,2404,2403,2404,2408,2412,2414,2415,2412,2404,2391,2373,2353,2329,2299,2268,2243,2222,2204,2189,2180,2176,2176,2178,2184,2186,2181,2171,2154,2130,2100,2058,2013,1974,1938,1907,1882,1857,1838,1831,1828,1827,1833,1840,1847,1854,1859,1863,1868,1873,1878,1882,1883,1885,1887,1891,1896,1901,1906,1913,1925,1941,1961,1981,2003,2026,2043,2048,2046,2039,2024,2000,1973,1948,1927,1905,1882,1862,1845,1831,1818,1806,1790,1774,1760,1748,1737,1731,1732,1740,1752,1768,1788,1812,1838,1859,1874,1886,1894,1901,1910,1917,1922,1926,1929,1930,1926,1918,1908,1893,1872,1850,1830,1810,1792,1776,1764,1757,1755,1757,1761,1769,1779,1789,1797,1806,1817,1830,1842,1852,1861,1870,1877,1884,1887,1887,1887,1884,1877,1870,1862,1852,1844,1835,1826,1817,1807,1798,1790,1784,1777,1771,1768,1766,1768,1777,1789,1803,1821,1841,1864,1892,1920,1946,1971,1993,2014,2036,2055,2068,2076,2084,2093,2101,2107,2114,2121,2126,2130,2134,2138,2140,2139,2136,2132,2125,2117,2110,2102,2093,2085,2083,2086,2093,2105,2120,2138,2156,2172,2185,2194,2199,2199,2195,2187,2172,2150,2126,2105,2083,2061,2039,2018,1999,1985,1974,1964,1955,1945,1937,1931,1924,1919,1917,1915,1912,1912,1915,1920,1928,1939,1952,1966,1984,2006,2029,2053,2076,2098,2123,2151,2179,2202,2222,2242,2256,2261,2260,2253,2241,2224,2198,2171,2148,2126,2106,2086,2065,2045,2029,2012,1999,1989,1978,1969,1963,1957,1952,1946,1941,1936,1927,1917,1904,1888,1874,1866,1860,1856,1855,1856,1861,1869,1875,1875,1870,1859,1844,1827,1810,1796,1786,1785,1793,1806,1822,1845,1873,1900,1922,1941,1962,1984,2005,2021,2035,2047,2057,2066,2072,2074,2073,2071,2069,2067,2067,2068,2071,2077,2086,2098,2108,2116,2120,2119,2111,2095,2077,2058,2035,2014,1994,1978,1967,1960,1955,1956,1958,1960,1967,1976,1988,2003,2017,2028,2039,2051,2066,2082,2095,2108,2123,2136,2149,2159,2164,2166,2167,2167,2169,2170,2170,2173,2178,2184,2192,2199,2208,2218,2231,2249,2268,2283,2296,2308,2316,2324,2331,2331,2330,2324,2311,2292,2275,2258,2242,2226,2208,2193,2183,2173,2161,2145,2119,2087,2056,2026,1995,1961,1928,1904,1884,1866,1852,1838,1827,1820,1815,1810,1808,1807,1805,1802,1799,1795,1790,1788,1787,1784,1781,1778,1775,1775,1780,1786,1795,1810,1828,1849,1867,1880,1890,1898,1901,1900,1899,1898,1899,1902,1907,1913,1920,1928,1938,1948,1962,1976,1989,2002,2017,2027,2032,2033,2031,2025,2015,2000,1985,1968,1948,1925,1903,1888,1879,1874,1875,1882,1894,1908,1921,1933,1946,1958,1967,1972,1975,1978,1981,1985,1987,1989,1993,1998,2002,2011,2022,2033,2043,2053,2061,2065,2065,2064,2064,2060,2053,2044,2033,2021,2007,1987,1967,1954,1945,1941,1942,1948,1962,1978,1993,2010,2030,2049,2061,2069,2075,2079,2081,2083,2083,2083,2083,2083,2084,2088,2092,2092,2092,2091,2088,2086,2084,2081,2078,2073,2064,2053,2040,2025,2008,1986,1964,1950,1941,1935,1938,1948,1960,1975,1991,2008,2028,2045,2055,2063,2069,2075,2081,2084,2085,2085,2086,2086,2086,2085,2083,2081,2080,2083,2089,2099,2113,2130,2153,2178,2200,2221,2240,2255,2271,2284,2296,2312,2329,2348,2373,2399,2423,2445,2468,2490,2510,2524,2536,2548,2559,2571,2579,2580,2579,2576,2568,2555,2537,2516,2496,2474,2447,2421,2403,2388,2376,2368,2362,2359,2358,2359,2360,2360,2358,2358,2361,2363,2364,2368,2372,2374,2375,2373,2368,2360,2353,2345,2338,2331,2322,2313,2303,2292,2278,2260,2232,2199,2170,2141,2110,2078,2043,2011,1985,1962,1941,1920,1899,1879,1864,1851,1839,1825,1811,1799,1789,1780,1770,1759,1750,1745,1742,1743,1751,1765,1784,1805,1826,1848,1870,1887,1898,1902,1903,1900,1895,1889,1883,1872,1860,1845,1827,1806,1784,1761,1739,1716,1694,1679,1669,1662,1659,1657,1657,1659,1661,1667,1679,1691,1701,1714,1728,1745,1768,1791,1810,1826,1842,1856,1871,1885,1895,1903,1915,1932,1955,1976,1995,2011,2023,2032,2036,2033,2027,2020,2008,1994,1981,1970,1961,1949,1936,1924,1916,1911,1907,1906,1909,1916,1923,1933,1944,1953,1961,1963,1961,1958,1951,1941,1931,1924,1920,1920,1923,1932,1944,1956,1967,1976,1985,1996,2005,2011,2017,2022,2028,2031,2033,2036,2040,2045,2055,2069,2087,2109,2134,2166,2199,2229,2256,2283,2307,2332,2352,2364,2371,2374,2374,2372,2368,2364,2363,2363,2363,2365,2368,2372,2375,2377,2380,2383,2383,2381,2377,2368,2354,2339,2322,2306,2293,2283,2276,2275,2278,2284,2293,2303,2313,2322,2333,2345,2355,2362,2366,2364,2357,2346,2327,2301,2276,2252,2228,2204,2178,2153,2134,2115,2095,2076,2055,2036,2020,2005,1989,1970,1953,1942,1936,1932,1931,1934,1938,1943,1946,1946,1944,1937,1928,1921,1912,1902,1891,1878,1867,1855,1844,1832,1820,1810,1805,1803,1802,1802,1804,1807,1808,1808,1808,1808,1808,1805,1800,1796,1793,1789,1787,1791,1797,1810,1829,1850,1873,1898,1924,1950,1977,2000,2017,2030,2037,2038,2029,2014,1994,1974,1950,1922,1895,1873,1855,1837,1821,1807,1797,1793,1793,1796,1803,1816,1832,1848,1862,1874,1888,1903,1914,1926,1940,1956,1978,2004,2027,2049,2072,2095,2118,2138,2150,2158,2165,2171,2175,2174,2171,2169,2172,2177,2183,2188,2192,2198,2206,2217,2229,2242,2257,2269,2281,2294,2304,2312,2318,2323,2328,2332,2337,2341,2344,2345,2346,2347,2346,2340,2333,2328,2321,2311,2300,2288,2277,2264,2249,2234,2219,2205,2193,2183,2173,2166,2161,2162,2170,2184,2200,2220,2243,2265,2285,2304,2319,2332,2344,2350,2351,2348,2341,2329,2312,2287,2260,2236,2214,2193,2171,2147,2124,2101,2076,2047,2011,1975,1944,1916,1889,1868,1848,1832,1820,1805,1791,1776,1759,1741,1727,1714,1703,1693,1685,1683,1688,1696,1709,1724,1739,1752,1761,1767,1770,1767,1760,1754,1750,1746,1743,1744,1745,1746,1748,1753,1759,1766,1774,1785,1799,1819,1846,1876,1902,1924,1948,1972,1992,2004,2012,2017,2019,2018,2017,2016,2016,2021,2028,2038,2048,2055,2060,2063,2062,2053,2040,2024,2007,1987,1963,1943,1928,1918,1909,1902,1896,1892,1890,1886,1878,1866,1854,1846,1838,1828,1817,1804,1792,1783,1775,1765,1756,1749,1746,1749,1754,1764,1786,1814,1840,1866,1893,1921,1950,1976,1992,2004,2013,2020,2026,2030,2034,2041,2048,2057,2066,2073,2078,2081,2081,2076,2070,2062,2053,2042,2026,2009,1993,1977,1963,1947,1929,1910,1896,1885,1877,1872,1870,1873,1880,1888,1899,1914,1927,1938,1948,1957,1964,1970,1975,1982,1991,2001,2013,2030,2049,2065,2078,2093,2108,2118,2127,2134,2138,2142,2146,2152,2160,2171,2186,2210,2238,2265,2293,2323,2356,2392,2427,2453,2473,2490,2500,2505,2504,2495,2482,2462,2434,2403,2376,2348,2319,2290,2261,2236,2219,2204,2189,2176,2161,2146,2132,2117,2099,2081,2066,2057,2053,2050,2053,2061,2072,2084,2096,2110,2127,2147,2169,2189,2210,2236,2263,2287,2302,2312,2318,2318,2308,2289,2267,2243,2215,2185,2152,2120,2094,2073,2052,2027,2004,1985,1969,1953,1937,1923,1915,1914,1920,1931,1948,1970,1992,2010,2026,2039,2048,2050,2046,2038,2029,2018,1999,1980,1962,1943,1925,1903,1877,1853,1834,1819,1804,1789,1775,1764,1754,1742,1729,1712,1694,1679,1667,1658,1656,1660,1669,1685,1703,1726,1758,1791,1818,1840,1858,1873,1887,1896,1897,1898,1900,1902,1904,1907,1910,1914,1917,1920,1922,1923,1924,1926,1929,1934,1940,1945,1948,1948,1945,1942,1936,1931,1926,1921,1917,1916,1919,1927,1939,1956,1982,2011,2034,2054,2072,2086,2091,2087,2079,2070,2058,2042,2027,2017,2011,2005,2000,1999,2000,2003,2008,2015,2028,2043,2058,2072,2085,2096,2108,2118,2123,2125,2124,2122,2120,2118,2118,2120,2126,2139,2158,2174,2190,2208,2224,2238,2248,2251,2252,2249,2241,2232,2226,2221,2216,2211,2205,2200,2200,2201,2201,2204,2211,2217,2223,2231,2238,2246,2255,2259,2259,2259,2259,2256,2253,2250,2247,2247,2251,2256,2264,2269,2274,2281,2286,2286,2284,2279,2274,2267,2255,2243,2234,2225,2217,2207,2195,2184,2174,2164,2150,2132,2113,2097,2084,2072,2063,2053,2044,2037,2031,2024,2017,2005,1991,1980,1969,1958,1947,1936,1928,1923,1919,1916,1914,1913,1912,1912,1912,1910,1908,1906,1904,1902,1901,1900,1904,1909,1915,1919,1923,1926,1928,1928,1929,1930,1932,1939,1948,1957,1965,1974,1981,1985,1983,1976,1968,1957,1943,1929,1920,1912,1905,1905,1909,1913,1919,1927,1936,1950,1965,1977,1989,2002,2014,2030,2044,2053,2060,2065,2069,2070,2071,2073,2078,2086,2099,2115,2132,2150,2171,2195,2223,2249,2266,2278,2286,2290,2288,2280,2269,2256,2244,2233,2225,2224,2225,2229,2238,2251,2266,2281,2295,2310,2327,2340,2348,2354,2359,2363,2368,2374,2380,2387,2394,2399,2402,2402,2399,2393,2386,2375,2362,2350,2339,2325,2310,2289,2265,2244,2221,2196,2171,2144,2118,2101,2087,2074,2067,2066,2071,2081,2095,2111,2131,2153,2173,2191,2210,2228,2250,2273,2294,2314,2334,2354,2375,2390,2401,2410,2414,2412,2405,2390,2371,2348,2315,2280,2252,2224,2197,2170,2136,2102,2073,2043,2012,1980,1942,1905,1876,1850,1824,1799,1778,1762,1750,1738,1728,1721,1718,1718,1720,1723,1729,1738,1747,1755,1763,1767,1768,1764,1755,1744,1734,1721,1707,1698,1695,1697,1704,1717,1734,1751,1764,1774,1784,1790,1793,1795,1797,1800,1804,1810,1817,1824,1833,1842,1857,1876,1896,1913,1929,1946,1965,1983,1999,2012,2023,2033,2040,2040,2034,2026,2015,2000,1980,1957,1941,1928,1916,1908,1904,1904,1906,1910,1915,1920,1923,1927,1930,1931,1933,1935,1937,1940,1943,1950,1964,1978,1989,2001,2016,2032,2048,2062,2072,2082,2093,2102,2109,2114,2118,2120,2119,2116,2110,2106,2106,2107,2109,2114,2126,2140,2153,2166,2177,2185,2188,2186,2182,2173,2158,2143,2129,2115,2102,2093,2087,2084,2082,2082,2085,2087,2087,2087,2082,2074,2063,2047,2030,2014,1998,1983,1966,1945,1926,1913,1902,1894,1892,1894,1901,1912,1924,1940,1961,1983,1999,2012,2023,2034,2045,2055,2061,2066,2072,2077,2083,2089,2095,2102,2111,2121,2130,2137,2141,2143,2143,2144,2146,2145,2143,2140,2136,2132,2129,2125,2123,2120,2114,2107,2103,2099,2094,2089,2084,2080,2078,2075,2072,2069,2063,2056,2048,2039,2030,2019,2009,2002,1997,1994,1992,1991,1991,1993,1994,1994,1994,1994,1996,1999,2003,2006,2011,2017,2024,2031,2039,2049,2056,2061,2064,2066,2066,2065,2060,2053,2045,2036,2026,2015,2003,1993,1985,1977,1971,1967,1964,1961,1961,1961,1965,1969,1972,1975,1981,1989,2000,2010,2016,2022,2029,2033,2037,2038,2036,2032,2025,2009,1989,1969,1947,1926,1903,1878,1857,1842,1830,1819,1811,1804,1799,1798,1798,1801,1808,1816,1828,1843,1859,1882,1905,1922,1937,1951,1963,1973,1980,1982,1987,1994,2001,2012,2027,2040,2051,2061,2067,2068,2065,2058,2048,2035,2018,2005,1998,1993,1990,1990,1992,1996,2001,2006,2012,2020,2030,2041,2054,2069,2087,2111,2133,2150,2165,2177,2185,2189,2190,2185,2178,2169,2157,2146,2137,2127,2115,2103,2084,2061,2040,2019,1995,1968,1940,1916,1902,1891,1883,1883,1890,1901,1916,1931,1948,1971,1996,2019,2040,2063,2087,2115,2141,2160,2174,2187,2198,2204,2204,2200,2194,2186,2176,2166,2157,2150,2145,2141,2138,2136,2133,2130,2124,2113,2098,2086,2074,2062,2052,2044,2039,2040,2041,2043,2049,2054,2057,2060,2062,2061,2060,2057,2054,2050,2047,2045,2046,2047,2048,2049,2049,2051,2051,2050,2050,2050,2052,2058,2068,2077,2087,2099,2110,2122,2134,2143,2151,2159,2163,2168,2174,2176,2176,2175,2169,2160,2150,2137,2122,2107,2089,2072,2060,2052,2046,2045,2045,2047,2047,2047,2046,2043,2041,2040,2042,2045,2051,2060,2069,2076,2080,2081,2080,2077,2073,2068,2063,2059,2056,2054,2053,2052,2049,2044,2034,2021,2008,1993,1977,1959,1945,1937,1933,1933,1939,1954,1972,1989,2005,2019,2033,2047,2060,2071,2083,2098,2117,2139,2161,2185,2209,2231,2256,2282,2302,2318,2332,2340,2345,2345,2340,2334,2324,2308,2290,2272,2254,2235,2214,2192,2172,2159,2151,2145,2143,2146,2153,2163,2174,2184,2195,2205,2211,2216,2220,2221,2221,2219,2217,2214,2212,2212,2213,2214,2218,2222,2227,2235,2244,2253,2265,2278,2291,2304,2313,2316,2316,2311,2299,2283,2266,2249,2233,2219,2204,2191,2183,2177,2173,2168,2161,2153,2145,2137,2130,2120,2109,2101,2093,2086,2081,2075,2069,2066,2063,2061,2058,2054,2051,2052,2054,2059,2066,2074,2081,2087,2092,2095,2095,2092,2089,2085,2079,2068,2057,2046,2035,2023,2010,1995,1981,1968,1956,1944,1932,1923,1915,1908,1901,1896,1890,1884,1878,1872,1868,1865,1860,1857,1856,1859,1863,1869,1876,1883,1886,1887,1886,1879,1866,1851,1834,1817,1797,1775,1755,1741,1731,1722,1716,1714,1715,1721,1729,1740,1760,1785,1807,1829,1852,1876,1904,1931,1951,1968,1984,1997,2010,2021,2029,2036,2044,2054,2067,2080,2094,2108,2122,2136,2147,2153,2156,2155,2152,2145,2137,2127,2119,2112,2104,2098,2095,2093,2093,2097,2103,2111,2118,2126,2135,2142,2149,2155,2157,2157,2156,2150,2140,2128,2116,2104,2091,2077,2065,2059,2054,2051,2048,2045,2042,2041,2039,2036,2034,2033,2034,2036,2040,2045,2052,2059,2066,2073,2079,2085,2090,2094,2098,2102,2107,2113,2119,2123,2126,2128,2126,2118,2104,2085,2066,2044,2015,1988,1966,1946,1930,1915,1897,1881,1867,1853,1838,1822,1804,1786,1773,1762,1754,1751,1752,1757,1764,1771,1778,1786,1793,1797,1799,1802,1808,1817,1830,1844,1858,1876,1896,1916,1931,1940,1946,1950,1952,1951,1949,1948,1948,1951,1956,1961,1968,1977,1988,2000,2013,2026,2039,2054,2070,2092,2115,2135,2151,2167,2178,2185,2186,2184,2181,2177,2169,2162,2156,2151,2145,2136,2125,2113,2100,2085,2069,2049,2028,2006,1985,1965,1946,1924,1904,1890,1877,1865,1856,1848,1843,1842,1843,1846,1854,1865,1878,1893,1908,1924,1941,1955,1966,1977,1987,1999,2012,2027,2043,2058,2073,2089,2105,2118,2130,2141,2151,2160,2169,2173,2178,2183,2189,2196,2203,2207,2209,2211,2211,2209,2203,2196,2188,2179,2168,2157,2147,2138,2129,2121,2111,2100,2090,2082,2074,2066,2059,2054,2052,2049,2047,2045,2044,2043,2042,2039,2036,2034,2035,2038,2042,2047,2058,2071,2081,2090,2098,2105,2111,2117,2120,2123,2129,2136,2144,2154,2165,2177,2188,2198,2207,2214,2217,2219,2219,2217,2212,2205,2198,2190,2179,2168,2160,2153,2146,2138,2128,2119,2111,2104,2099,2093,2084,2074,2065,2054,2040,2021,1999,1979,1958,1936,1914,1888,1862,1843,1828,1814,1804,1796,1791,1792,1796,1802,1812,1823,1832,1840,1846,1851,1858,1864,1867,1870,1875,1881,1891,1903,1913,1924,1937,1950,1963,1972,1978,1983,1988,1991,1993,1994,1993,1993,1991,1989,1985,1982,1979,1977,1974,1972,1973,1975,1976,1980,1984,1988,1989,1988,1985,1979,1971,1961,1953,1947,1944,1947,1952,1961,1972,1984,1998,2015,2030,2041,2052,2063,2074,2084,2090,2094,2097,2098,2097,2095,2093,2093,2093,2095,2100,2106,2115,2125,2136,2149,2161,2169,2174,2177,2176,2170,2161,2152,2144,2137,2132,2129,2127,2127,2128,2128,2128,2129,2130,2132,2136,2142,2150,2161,2170,2178,2186,2192,2196,2197,2193,2187,2176,2159,2139,2121,2102,2083,2066,2047,2030,2016,2005,1994,1984,1974,1968,1966,1966,1969,1981,1995,2010,2025,2040,2055,2072,2088,2099,2109,2119,2128,2139,2150,2160,2169,2178,2186,2196,2201,2202,2201,2197,2190,2180,2169,2157,2143,2126,2108,2091,2074,2055,2036,2013,1993,1979,1968,1959,1956,1958,1964,1974,1983,1994,2010,2025,2039,2054,2067,2081,2099,2116,2132,2148,2163,2178,2194,2207,2213,2216,2217,2215,2208,2201,2191,2181,2171,2156,2139,2125,2113,2101,2088,2074,2062,2053,2047,2042,2037,2033,2031,2027,2023,2019,2014,2009,2007,2005,2003,2002,1999,1996,1994,1993,1990,1988,1988,1989,1992,1995,1998,2003,2009,2014,2019,2024,2028,2030,2031,2029,2026,2021,2015,2009,2005,2002,2002,2005,2012,2021,2029,2036,2044,2049,2049,2048,2044,2041,2034,2024,2011,2000,1987,1974,1960,1944,1928,1916,1906,1896,1887,1880,1876,1874,1870,1867,1866,1864,1861,1859,1854,1850,1847,1843,1843,1846,1851,1863,1881,1899,1918,1937,1957,1980,2000,2016,2032,2047,2062,2081,2099,2111,2122,2135,2148,2159,2166,2170,2174,2176,2176,2176,2174,2172,2170,2166,2161,2153,2144,2134,2123,2107,2090,2074,2060,2049,2040,2032,2027,2025,2024,2023,2022,2021,2019,2019,2019,2019,2021,2024,2028,2033,2037,2041,2045,2050,2053,2054,2055,2057,2059,2061,2066,2072,2080,2092,2105,2116,2125,2135,2143,2150,2154,2153,2151,2149,2145,2141,2138,2135,2131,2125,2117,2109,2101,2094,2086,2078,2070,2063,2056,2050,2044,2036,2026,2018,2010,2000,1987,1968,1948,1929,1912,1894,1876,1855,1836,1825,1815,1806,1801,1797,1795,1794,1794,1794,1796,1798,1801,1805,1807,1811,1817,1823,1828,1832,1836,1841,1845,1848,1852,1857,1864,1874,1884,1893,1900,1908,1913,1915,1914,1911,1909,1905,1900,1897,1897,1900,1906,1914,1926,1939,1952,1964,1975,1984,1992,2000,2006,2009,2016,2025,2036,2045,2051,2057,2062,2066,2069,2072,2074,2079,2085,2092,2100,2107,2112,2114,2113,2108,2101,2091,2080,2070,2058,2047,2041,2039,2040,2046,2055,2064,2075,2085,2094,2102,2108,2113,2118,2123,2129,2137,2143,2147,2149,2147,2140,2131,2120,2109,2100,2093,2090,2091,2096,2103,2112,2120,2132,2144,2152,2158,2164,2168,2171,2175,2179,2182,2185,2192,2200,2208,2213,2218,2222,2226,2230,2236,2243,2251,2264,2279,2292,2301,2308,2311,2307,2295,2280,2262,2241,2216,2185,2155,2133,2116,2102,2092,2088,2088,2093,2099,2106,2114,2120,2124,2126,2127,2128,2129,2133,2136,2139,2142,2144,2144,2144,2143,2142,2144,2148,2154,2161,2168,2176,2183,2191,2196,2197,2194,2189,2179,2164,2150,2136,2122,2109,2097,2088,2085,2083,2083,2084,2084,2084,2084,2082,2078,2072,2065,2059,2052,2044,2035,2021,2006,1992,1977,1962,1948,1937,1929,1924,1922,1923,1927,1933,1939,1943,1948,1952,1954,1955,1957,1957,1958,1960,1962,1964,1969,1975,1985,2001,2019,2034,2048,2060,2069,2076,2077,2075,2072,2069,2065,2062,2060,2058,2058,2058,2057,2055,2051,2048,2048,2047,2050,2056,2062,2069,2078,2086,2092,2095,2097,2098,2096,2090,2084,2079,2074,2070,2067,2065,2065,2065,2063,2060,2055,2048,2041,2033,2025,2018,2012,2009,2008,2008,2007,2005,2002,1996,1988,1978,1968,1959,1953,1950,1951,1956,1965,1979,1994,2008,2022,2036,2051,2064,2075,2085,2094,2100,2106,2110,2111,2111,2111,2109,2107,2104,2101,2099,2099,2100,2103,2109,2117,2126,2137,2149,2163,2174,2182,2186,2187,2184,2180,2174,2168,2162,2157,2152,2146,2140,2133,2126,2115,2103,2091,2080,2068,2056,2044,2032,2023,2015,2005,1994,1982,1971,1961,1952,1945,1938,1931,1929,1929,1933,1941,1953,1967,1980,1993,2007,2022,2035,2045,2054,2062,2070,2078,2085,2091,2095,2099,2102,2105,2109,2111,2111,2108,2102,2095,2086,2074,2062,2046,2026,2006,1991,1979,1969,1961,1954,1951,1951,1950,1951,1953,1956,1961,1966,1973,1980,1987,1994,2000,2003,2005,2005,2004,2002,2000,1999,1998,1999,2000,2003,2008,2011,2017,2025,2033,2039,2044,2048,2052,2054,2053,2049,2046,2044,2044,2045,2048,2052,2059,2067,2078,2088,2096,2102,2108,2113,2116,2116,2114,2111,2105,2095,2083,2073,2063,2053,2043,2034,2027,2021,2016,2011,2008,2006,2006,2006,2007,2008,2008,2007,2004,2001,1998,1996,1994,1994,1995,1998,2004,2014,2024,2032,2039,2045,2048,2050,2049,2045,2039,2032,2025,2017,2008,2001,1993,1984,1977,1972,1971,1974,1979,1989,2004,2021,2036,2049,2063,2077,2089,2096,2102,2106,2108,2111,2115,2117,2119,2123,2127,2132,2136,2141,2146,2148,2147,2144,2139,2130,2120,2108,2091,2074,2060,2048,2036,2025,2014,2004,1997,1992,1988,1986,1985,1984,1985,1983,1981,1981,1981,1981,1983,1985,1989,1996,2003,2010,2015,2019,2024,2028,2029,2029,2028,2026,2022,2017,2011,2004,1998,1990,1981,1973,1968,1965,1963,1961,1961,1963,1965,1966,1965,1961,1955,1947,1938,1928,1917,1905,1894,1886,1879,1873,1867,1861,1859,1857,1857,1858,1859,1861,1864,1867,1869,1870,1870,1869,1867,1866,1866,1869,1875,1884,1893,1904,1916,1928,1941,1948,1953,1954,1951,1943,1934,1923,1910,1898,1886,1874,1867,1862,1857,1854,1851,1848,1847,1848,1848,1849,1849,1850,1850,1849,1847,1842,1838,1835,1833,1831,1832,1837,1844,1855,1868,1883,1903,1923,1940,1955,1967,1976,1982,1984,1984,1983,1982,1981,1984,1990,1996,2003,2012,2027,2044,2060,2077,2095,2114,2137,2160,2176,2189,2200,2208,2214,2215,2214,2212,2208,2203,2200,2197,2197,2198,2200,2202,2203,2202,2200,2194,2184,2170,2154,2137,2122,2108,2095,2084,2079,2075,2073,2071,2071,2073,2076,2081,2087,2097,2109,2121,2133,2144,2155,2167,2178,2188,2196,2204,2211,2219,2228,2236,2244,2255,2268,2281,2293,2301,2309,2314,2314,2309,2300,2290,2278,2264,2250,2235,2224,2216,2209,2199,2190,2183,2177,2172,2167,2162,2157,2154,2150,2146,2140,2131,2119,2108,2097,2084,2069,2055,2045,2040,2036,2036,2037,2040,2045,2050,2056,2063,2069,2074,2077,2080,2084,2091,2099,2107,2115,2124,2135,2145,2153,2157,2159,2158,2156,2156,2158,2162,2168,2176,2188,2200,2210,2217,2222,2224,2220,2215,2210,2204,2196,2184,2172,2162,2149,2135,2119,2099,2080,2063,2047,2029,2013,1995,1979,1966,1956,1947,1941,1937,1934,1931,1927,1923,1921,1921,1923,1928,1934,1946,1962,1981,1999,2017,2036,2055,2071,2083,2093,2100,2106,2112,2118,2124,2130,2137,2143,2149,2155,2160,2163,2165,2168,2171,2173,2175,2177,2178,2178,2175,2169,2160,2149,2136,2120,2104,2091,2080,2071,2063,2059,2058,2058,2060,2063,2066,2068,2068,2068,2066,2061,2054,2044,2036,2028,2021,2015,2010,2007,2006,2006,2009,2016,2025,2035,2046,2059,2073,2090,2105,2116,2125,2134,2144,2153,2161,2166,2172,2177,2180,2182,2182,2181,2182,2182,2180,2179,2177,2174,2168,2157,2144,2133,2122,2110,2099,2088,2079,2075,2074,2074,2078,2083,2088,2094,2100,2105,2111,2116,2118,2121,2124,2127,2131,2134,2136,2139,2140,2137,2134,2129,2121,2114,2106,2096,2085,2077,2068,2058,2047,2033,2019,2007,1996,1986,1978,1973,1972,1974,1978,1984,1995,2008,2019,2029,2039,2048,2058,2066,2069,2070,2070,2069,2067,2063,2058,2054,2049,2043,2039,2036,2034,2033,2033,2032,2030,2028,2026,2022,2016,2009,2003,1999,1994,1990,1988,1989,1993,1999,2005,2013,2022,2032,2038,2045,2051,2057,2064,2072,2078,2086,2094,2104,2113,2120,2125,2129,2132,2133,2133,2130,2126,2121,2113,2104,2095,2087,2079,2071,2066,2063,2064,2065,2069,2076,2083,2089,2095,2101,2107,2114,2120,2125,2128,2129,2128,2124,2119,2114,2110,2107,2106,2108,2109,2112,2115,2119,2123,2126,2126,2126,2126,2124,2120,2115,2109,2102,2093,2080,2066,2054,2043,2033,2025,2017,2010,2006,2002,1999,1994,1987,1978,1969,1960,1949,1935,1920,1907,1897,1889,1883,1881,1882,1888,1896,1906,1918,1933,1949,1964,1978,1993,2009,2025,2038,2050,2062,2072,2081,2089,2096,2102,2108,2114,2120,2124,2125,2124,2122,2116,2107,2097,2085,2072,2058,2040,2021,2006,1992,1980,1967,1957,1950,1945,1942,1940,1942,1945,1950,1957,1964,1973,1984,1995,2003,2009,2014,2017,2019,2018,2016,2014,2011,2005,1999,1994,1989,1983,1977,1970,1960,1952,1944,1935,1925,1915,1906,1900,1895,1892,1890,1888,1887,1889,1890,1892,1895,1898,1901,1904,1909,1916,1925,1936,1948,1961,1976,1992,2008,2020,2028,2034,2036,2033,2027,2018,2009,1998,1985,1972,1962,1952,1942,1932,1921,1914,1910,1909,1910,1913,1921,1931,1942,1951,1962,1974,1986,1995,2001,2007,2013,2019,2025,2030,2035,2041,2048,2054,2058,2059,2060,2057,2050,2040,2031,2020,2010,2000,1989,1980,1973,1968,1962,1956,1950,1947,1946,1947,1950,1957,1968,1979,1991,2002,2016,2033,2049,2060,2068,2075,2082,2088,2092,2095,2098,2103,2109,2114,2116,2116,2115,2111,2102,2089,2074,2060,2043,2023,2004,1990,1981,1975,1972,1971,1974,1980,1986,1993,2002,2014,2027,2040,2051,2063,2080,2095,2106,2114,2121,2124,2124,2120,2113,2107,2099,2092,2085,2081,2079,2078,2077,2075,2072,2068,2064,2060,2054,2046,2038,2033,2028,2024,2020,2018,2018,2020,2024,2030,2038,2049,2059,2071,2083,2094,2106,2118,2125,2130,2134,2134,2132,2127,2122,2117,2113,2106,2100,2096,2093,2089,2084,2077,2068,2059,2050,2039,2029,2021,2018,2018,2019,2023,2029,2037,2043,2048,2051,2053,2056,2059,2060,2063,2068,2074,2082,2089,2095,2101,2106,2110,2112,2112,2110,2107,2105,2104,2105,2108,2113,2120,2130,2142,2152,2160,2168,2173,2176,2176,2174,2170,2166,2161,2155,2150,2146,2143,2141,2140,2138,2136,2134,2133,2132,2132,2134,2137,2141,2145,2149,2152,2153,2150,2145,2138,2127,2115,2104,2094,2086,2080,2073,2066,2062,2058,2052,2045,2036,2028,2021,2013,2005,1997,1991,1988,1988,1988,1989,1992,1995,1995,1996,1994,1991,1987,1983,1981,1981,1983,1987,1994,2001,2008,2016,2025,2033,2040,2044,2048,2051,2055,2058,2061,2064,2068,2071,2072,2073,2072,2069,2065,2060,2053,2046,2041,2038,2036,2039,2045,2055,2066,2076,2087,2099,2107,2113,2117,2119,2120,2122,2124,2127,2131,2135,2141,2146,2148,2148,2147,2142,2134,2125,2118,2113,2108,2104,2100,2099,2099,2098,2096,2094,2090,2084,2076,2067,2056,2045,2034,2026,2018,2012,2009,2006,2004,2002,2000,1999,1997,1995,1995,1996,1998,2004,2013,2023,2034,2043,2053,2063,2068,2071,2071,2069,2064,2056,2048,2041,2036,2032,2030,2029,2030,2031,2032,2032,2031,2026,2020,2013,2006,1997,1987,1976,1968,1960,1953,1946,1936,1926,1918,1912,1906,1902,1901,1904,1910,1919,1931,1948,1967,1984,2000,2014,2029,2042,2054,2060,2064,2068,2071,2074,2077,2079,2083,2088,2093,2098,2100,2101,2102,2103,2103,2104,2107,2111,2115,2122,2129,2135,2139,2142,2144,2145,2146,2145,2144,2143,2143,2146,2150,2153,2155,2156,2157,2156,2152,2146,2139,2129,2118,2105,2094,2085,2075,2064,2054,2046,2040,2034,2028,2021,2015,2011,2010,2009,2011,2016,2024,2034,2044,2056,2072,2087,2099,2110,2121,2132,2145,2158,2170,2181,2193,2207,2223,2238,2247,2253,2256,2257,2253,2247,2237,2225,2211,2192,2172,2155,2139,2125,2110,2094,2080,2070,2062,2055,2048,2041,2035,2030,2025,2019,2011,2001,1992,1982,1971,1960,1947,1933,1924,1919,1914,1913,1917,1923,1932,1941,1951,1962,1973,1981,1988,1993,1998,2003,2008,2012,2016,2021,2028,2036,2044,2053,2062,2071,2083,2095,2104,2111,2117,2121,2123,2121,2116,2110,2101,2089,2074,2059,2046,2033,2020,2006,1993,1984,1978,1973,1967,1962,1956,1950,1944,1936,1925,1913,1902,1893,1885,1878,1871,1866,1863,1862,1862,1863,1864,1867,1871,1875,1879,1885,1890,1893,1894,1895,1896,1896,1898,1900,1903,1908,1915,1923,1932,1941,1951,1961,1973,1984,1994,2002,2010,2016,2020,2021,2018,2014,2008,1999,1989,1981,1974,1966,1957,1948,1939,1933,1927,1922,1919,1917,1915,1914,1913,1912,1912,1913,1914,1916,1918,1922,1928,1936,1945,1954,1964,1974,1988,2004,2019,2033,2048,2066,2082,2095,2106,2115,2122,2126,2127,2126,2123,2117,2109,2100,2091,2081,2072,2064,2056,2050,2047,2045,2045,2046,2050,2054,2058,2063,2069,2075,2081,2086,2090,2094,2096,2096,2096,2096,2095,2095,2096,2099,2104,2110,2116,2122,2130,2135,2138,2139,2138,2135,2130,2124,2117,2111,2103,2095,2086,2078,2072,2068,2064,2061,2062,2063,2064,2066,2068,2070,2073,2073,2073,2073,2072,2067,2060,2052,2044,2035,2025,2015,2008,2004,2001,2001,2004,2007,2011,2013,2016,2018,2019,2018,2018,2018,2020,2021,2022,2022,2024,2026,2029,2033,2036,2040,2044,2047,2050,2052,2053,2053,2054,2054,2051,2048,2044,2038,2031,2022,2010,1998,1989,1983,1979,1979,1982,1989,1996,2004,2012,2019,2023,2025,2025,2023,2021,2019,2016,2013,2012,2011,2011,2014,2017,2022,2029,2037,2047,2055,2062,2066,2070,2071,2071,2068,2065,2061,2056,2049,2041,2035,2029,2023,2018,2015,2015,2020,2026,2034,2044,2056,2068,2076,2081,2085,2088,2090,2091,2092,2094,2095,2097,2099,2102,2103,2105,2107,2109,2111,2111,2112,2111,2109,2106,2103,2099,2094,2089,2083,2075,2069,2062,2054,2045,2036,2028,2023,2020,2019,2019,2020,2021,2021,2021,2019,2014,2007,2000,1994,1989,1983,1977,1974,1972,1971,1971,1972,1973,1975,1978,1982,1987,1992,1998,2004,2009,2014,2019,2024,2029,2032,2035,2037,2039,2039,2038,2037,2036,2036,2036,2036,2038,2039,2039,2041,2042,2041,2041,2041,2041,2042,2042,2042,2042,2043,2044,2046,2049,2052,2056,2060,2065,2070,2075,2081,2085,2090,2096,2101,2105,2106,2107,2106,2103,2097,2090,2084,2076,2066,2057,2049,2044,2039,2035,2030,2027,2025,2023,2022,2022,2023,2025,2027,2029,2030,2029,2027,2026,2022,2017,2012,2007,2003,2002,2002,2003,2008,2016,2025,2035,2044,2052,2061,2066,2068,2068,2066,2063,2059,2054,2048,2042,2037,2031,2026,2022,2017,2012,2007,2001,1995,1990,1986,1984,1982,1978,1975,1972,1969,1965,1961,1956,1953,1951,1950,1950,1952,1956,1961,1966,1972,1978,1985,1990,1993,1995,1996,1998,2001,2003,2005,2008,2012,2017,2023,2029,2035,2040,2046,2049,2051,2052,2052,2051,2050,2047,2044,2042,2039,2036,2032,2027,2022,2017,2014,2010,2009,2010,2012,2015,2021,2029,2038,2046,2052,2057,2061,2063,2066,2067,2067,2067,2065,2061,2055,2048,2041,2032,2019,2005,1993,1983,1974,1965,1958,1952,1950,1950,1951,1953,1957,1962,1968,1973,1979,1987,1993,1998,2003,2009,2015,2025,2036,2046,2056,2069,2083,2099,2114,2127,2141,2155,2170,2184,2193,2198,2202,2203,2199,2193,2185,2176,2166,2154,2142,2132,2124,2116,2108,2101,2094,2089,2085,2082,2080,2078,2077,2076,2076,2075,2074,2074,2075,2076,2078,2079,2081,2082,2083,2083,2083,2083,2084,2084,2084,2083,2083,2081,2078,2075,2071,2067,2063,2058,2054,2051,2051,2052,2055,2061,2067,2072,2077,2081,2085,2087,2086,2084,2081,2077,2071,2067,2064,2063,2064,2066,2069,2074,2079,2084,2088,2092,2095,2097,2097,2096,2093,2089,2083,2077,2071,2064,2057,2048,2039,2032,2026,2022,2018,2016,2017,2019,2024,2029,2035,2041,2045,2048,2050,2050,2049,2046,2042,2038,2034,2030,2028,2027,2028,2030,2031,2032,2034,2034,2034,2032,2031,2029,2027,2025,2022,2019,2016,2012,2008,2004,1999,1994,1988,1984,1981,1981,1981,1983,1988,1992,1998,2003,2008,2015,2020,2024,2027,2029,2031,2033,2034,2035,2036,2038,2040,2042,2044,2044,2045,2045,2044,2044,2042,2040,2037,2034,2031,2027,2024,2020,2018,2014,2010,2006,2002,1998,1994,1989,1986,1986,1988,1990,1994,2001,2008,2016,2022,2028,2033,2035,2036,2036,2034,2033,2032,2031,2032,2035,2040,2049,2059,2070,2080,2090,2100,2110,2120,2126,2132,2136,2139,2141,2142,2140,2137,2131,2123,2116,2109,2102,2096,2091,2087,2084,2082,2081,2080,2081,2080,2079,2078,2075,2070,2063,2055,2047,2040,2031,2024,2018,2014,2015,2017,2021,2027,2034,2042,2049,2055,2061,2065,2068,2070,2070,2069,2067,2063,2058,2054,2049,2045,2041,2037,2035,2034,2034,2036,2040,2044,2046,2049,2052,2055,2058,2060,2061,2062,2062,2062,2061,2061,2061,2061,2062,2063,2064,2066,2067,2068,2068,2066,2062,2058,2053,2048,2041,2034,2027,2021,2015,2011,2007,2003,2001,2001,2002,2004,2007,2010,2012,2013,2014,2014,2014,2013,2012,2011,2010,2011,2011,2013,2015,2016,2019,2022,2025,2030,2034,2039,2045,2051,2055,2060,2064,2067,2070,2072,2071,2070,2068,2065,2059,2053,2048,2043,2040,2038,2039,2042,2047,2053,2061,2068,2076,2081,2085,2088,2091,2092,2093,2093,2093,2091,2088,2083,2079,2075,2071,2065,2059,2054,2050,2047,2046,2046,2047,2049,2051,2052,2054,2053,2051,2047,2041,2035,2028,2020,2012,2008,2006,2005,2007,2010,2014,2019,2024,2029,2034,2040,2046,2051,2056,2061,2066,2070,2073,2075,2073,2069,2065,2059,2052,2045,2037,2029,2023,2018,2014,2011,2007,2003,1998,1991,1985,1978,1969,1960,1952,1946,1941,1938,1938,1941,1946,1953,1962,1971,1982,1992,2000,2007,2015,2023,2031,2037,2042,2046,2050,2055,2058,2061,2062,2063,2065,2067,2069,2072,2073,2076,2079,2081,2081,2080,2078,2075,2070,2064,2057,2051,2045,2038,2032,2027,2026,2027,2030,2035,2041,2047,2053,2057,2059,2061,2062,2060,2057,2054,2049,2044,2040,2035,2031,2027,2024,2020,2017,2013,2010,2007,2004,2001,1999,1999,1999,1999,2000,2001,2002,2003,2003,2003,2002,2001,2001,2001,2003,2007,2012,2019,2026,2033,2041,2048,2052,2053,2053,2051,2046,2039,2031,2024,2016,2008,1999,1989,1981,1975,1968,1959,1951,1944,1939,1935,1931,1929,1928,1929,1932,1936,1940,1946,1952,1958,1962,1967,1972,1978,1983,1988,1993,1999,2006,2014,2020,2025,2029,2033,2035,2036,2036,2037,2037,2038,2038,2040,2043,2045,2048,2051,2052,2052,2051,2049,2046,2042,2037,2033,2029,2025,2019,2013,2008,2002,1996,1990,1984,1978,1974,1972,1971,1970,1971,1974,1977,1980,1984,1987,1990,1992,1994,1994,1994,1993,1993,1993,1995,1998,2003,2010,2019,2027,2034,2042,2051,2059,2065,2070,2074,2078,2082,2086,2089,2091,2093,2094,2094,2093,2091,2090,2087,2083,2079,2075,2071,2067,2064,2060,2058,2057,2057,2056,2054,2051,2047,2044,2040,2036,2031,2028,2026,2025,2024,2023,2023,2023,2023,2023,2023,2023,2024,2025,2027,2028,2031,2034,2038,2041,2044,2048,2053,2060,2068,2076,2085,2095,2108,2120,2130,2139,2148,2158,2167,2174,2179,2181,2182,2181,2178,2175,2171,2167,2162,2156,2151,2147,2144,2140,2135,2130,2125,2120,2115,2110,2104,2096,2087,2080,2072,2063,2052,2042,2035,2029,2024,2020,2019,2019,2020,2022,2025,2030,2037,2044,2050,2056,2063,2071,2077,2081,2083,2084,2084,2084,2082,2081,2079,2077,2077,2077,2078,2079,2081,2084,2087,2089,2090,2090,2089,2086,2081,2075,2069,2064,2058,2051,2044,2037,2031,2025,2017,2008,1999,1992,1987,1983,1982,1982,1985,1988,1992,1997,2001,2003,2003,2003,2002,2000,1997,1993,1991,1990,1990,1991,1992,1994,1995,1995,1995,1993,1992,1990,1989,1989,1991,1995,2000,2004,2009,2014,2019,2022,2025,2025,2026,2027,2030,2033,2038,2044,2050,2058,2066,2074,2080,2085,2090,2094,2099,2104,2109,2114,2119,2124,2129,2133,2136,2137,2136,2134,2131,2127,2121,2115,2107,2100,2095,2092,2090,2089,2089,2089,2090,2089,2089,2088,2087,2087,2088,2089,2092,2096,2100,2103,2106,2107,2107,2106,2104,2101,2097,2093,2089,2084,2079,2075,2072,2069,2066,2064,2064,2063,2063,2063,2063,2063,2063,2063,2064,2066,2069,2072,2074,2077,2079,2080,2079,2078,2077,2076,2076,2078,2080,2084,2087,2091,2094,2096,2096,2095,2091,2085,2077,2068,2058,2049,2039,2030,2019,2010,2002,1996,1992,1988,1987,1987,1989,1991,1994,2000,2007,2015,2023,2031,2039,2049,2056,2061,2064,2067,2069,2071,2072,2075,2078,2081,2086,2091,2094,2095,2096,2095,2093,2089,2086,2082,2079,2075,2071,2067,2064,2062,2058,2055,2051,2049,2047,2047,2048,2049,2050,2052,2054,2056,2059,2062,2063,2063,2063,2061,2058,2055,2051,2049,2047,2047,2048,2049,2051,2053,2055,2056,2056,2056,2056,2055,2055,2055,2055,2055,2056,2057,2058,2059,2059,2060,2061,2063,2065,2067,2069,2070,2072,2072,2071,2069,2067,2063,2059,2053,2044,2034,2025,2015,2005,1995,1986,1980,1977,1974,1973,1974,1977,1980,1985,1989,1995,2004,2012,2019,2024,2030,2035,2039,2042,2044,2045,2046,2048,2051,2053,2055,2057,2061,2063,2065,2066,2067,2068,2068,2068,2067,2066,2064,2062,2058,2055,2052,2049,2046,2044,2043,2044,2046,2049,2053,2059,2067,2076,2083,2090,2097,2102,2106,2108,2109,2108,2105,2102,2099,2096,2093,2090,2086,2083,2081,2079,2077,2075,2072,2070,2069,2067,2064,2061,2059,2056,2054,2052,2050,2050,2051,2052,2054,2057,2061,2067,2073,2079,2084,2090,2096,2102,2105,2108,2109,2109,2108,2105,2102,2098,2094,2090,2084,2080,2076,2073,2070,2067,2064,2060,2056,2051,2045,2037,2028,2019,2011,2003,1995,1986,1978,1972,1967,1963,1960,1958,1958,1959,1960,1963,1967,1972,1976,1980,1985,1990,1994,1996,1998,1999,1999,2000,2001,2003,2006,2011,2017,2027,2038,2049,2058,2068,2079,2088,2095,2099,2102,2105,2106,2106,2104,2102,2099,2094,2087,2080,2073,2066,2059,2050,2041,2033,2026,2019,2013,2006,2000,1995,1991,1988,1985,1981,1978,1975,1974,1973,1973,1973,1973,1974,1976,1978,1981,1984,1986,1988,1990,1992,1995,1998,2000,2003,2006,2010,2012,2013,2014,2014,2014,2014,2013,2013,2012,2011,2009,2008,2006,2005,2003,2002,2001,2000,2000,2002,2004,2006,2009,2013,2017,2021,2024,2027,2030,2032,2034,2036,2038,2040,2043,2045,2047,2048,2049,2050,2050,2049,2048,2047,2046,2046,2046,2047,2048,2050,2053,2056,2059,2063,2066,2070,2074,2079,2083,2088,2093,2099,2106,2111,2117,2121,2125,2129,2133,2135,2137,2139,2141,2145,2150,2155,2160,2165,2171,2176,2180,2182,2182,2180,2175,2169,2163,2156,2149,2143,2135,2129,2124,2120,2116,2113,2111,2110,2109,2109,2108,2107,2105,2103,2101,2099,2096,2091,2086,2081,2076,2070,2063,2057,2052,2049,2047,2046,2047,2049,2051,2054,2057,2061,2063,2065,2065,2065,2063,2059,2055,2051,2048,2044,2041,2039,2038,2038,2039,2041,2044,2047,2050,2052,2053,2055,2057,2058,2059,2060,2061,2061,2062,2062,2060,2058,2055,2053,2050,2049,2048,2047,2046,2047,2047,2048,2049,2049,2050,2049,2049,2048,2047,2046,2044,2043,2043,2042,2042,2042,2041,2041,2040,2039,2037,2034,2032,2029,2026,2024,2022,2020,2019,2018,2017,2016,2015,2014,2012,2010,2008,2007,2005,2003,2001,1999,1998,1998,1997,1997,1997,1997,1997,1997,1999,2001,2005,2009,2014,2022,2031,2042,2052,2060,2069,2078,2085,2091,2095,2099,2102,2104,2106,2107,2107,2106,2106,2104,2102,2099,2096,2092,2088,2084,2081,2078,2076,2073,2069,2066,2064,2061,2058,2054,2050,2048,2045,2043,2041,2039,2038,2037,2037,2037,2038,2038,2039,2039,2039,2039,2039,2038,2037,2038,2038,2039,2040,2042,2044,2045,2047,2049,2050,2051,2051,2051,2051,2052,2053,2054,2056,2057,2059,2062,2064,2067,2070,2073,2077,2080,2083,2085,2088,2090,2091,2092,2090,2088,2085,2081,2075,2068,2061,2054,2047,2040,2033,2027,2024,2022,2021,2020,2021,2023,2025,2027,2030,2033,2035,2037,2039,2040,2041,2043,2044,2045,2046,2047,2049,2052,2056,2061,2065,2072,2081,2090,2099,2106,2114,2123,2131,2137,2142,2146,2150,2154,2157,2159,2160,2161,2162,2163,2162,2161,2160,2157,2154,2149,2144,2138,2132,2123,2113,2102,2092,2083,2073,2063,2051,2041,2032,2026,2019,2012,2006,2003,2001,1998,1997,1996,1996,1997,1999,2001,2003,2007,2012,2017,2021,2026,2031,2035,2039,2041,2044,2046,2049,2051,2052,2054,2055,2055,2055,2054,2054,2053,2051,2050,2049,2047,2047,2046,2046,2047,2047,2049,2051,2052,2054,2055,2056,2058,2058,2059,2059,2058,2057,2055,2054,2052,2049,2044,2039,2033,2027,2020,2012,2005,1999,1995,1992,1991,1992,1994,1997,2000,2004,2009,2016,2022,2028,2034,2042,2051,2058,2065,2071,2077,2082,2086,2089,2092,2093,2095,2096,2098,2099,2099,2100,2100,2099,2098,2097,2095,2092,2087,2080,2073,2065,2058,2049,2041,2034,2030,2028,2027,2028,2031,2034,2039,2043,2048,2053,2058,2063,2066,2069,2072,2075,2076,2076,2075,2072,2068,2064,2060,2057,2054,2051,2049,2047,2047,2047,2047,2047,2048,2048,2049,2050,2049,2047,2044,2042,2039,2035,2032,2029,2028,2028,2029,2031,2034,2039,2044,2048,2052,2055,2058,2059,2060,2061,2061,2060,2059,2057,2055,2053,2052,2051,2051,2051,2052,2052,2053,2054,2054,2055,2055,2056,2056,2055,2055,2054,2053,2052,2050,2048,2046,2045,2044,2044,2045,2047,2049,2051,2053,2054,2054,2054,2053,2052,2050,2047,2045,2044,2043,2043,2043,2043,2044,2046,2048,2051,2054,2058,2061,2063,2064,2063,2062,2059,2056,2052,2049,2045,2041,2036,2032,2029,2026,2022,2019,2016,2015,2014,2015,2017,2020,2022,2025,2028,2030,2032,2033,2032,2032,2031,2029,2027,2026,2024,2023,2023,2024,2025,2028,2030,2032,2034,2036,2037,2037,2037,2037,2038,2038,2040,2042,2044,2045,2047,2048,2049,2049,2048,2048,2048,2050,2051,2053,2056,2060,2065,2069,2071,2073,2075,2075,2075,2073,2071,2068,2066,2063,2061,2060,2061,2063,2067,2071,2075,2079,2082,2086,2089,2091,2094,2096,2098,2100,2104,2107,2110,2112,2114,2115,2117,2117,2118,2119,2120,2121,2123,2125,2127,2129,2132,2134,2134,2134,2131,2127,2119,2111,2102,2094,2086,2079,2072,2066,2062,2060,2059,2057,2054,2052,2050,2047,2045,2042,2040,2039,2037,2036,2034,2032,2031,2029,2028,2028,2027,2027,2027,2027,2027,2027,2028,2030,2032,2035,2038,2040,2043,2044,2045,2044,2044,2043,2042,2042,2042,2043,2044,2046,2048,2050,2052,2054,2055,2056,2058,2059,2061,2063,2064,2066,2067,2067,2068,2068,2067,2067,2067,2066,2066,2065,2063,2061,2059,2056,2054,2051,2048,2045,2043,2040,2036,2032,2028,2024,2021,2018,2015,2013,2011,2009,2009,2009,2008,2008,2007,2007,2006,2005,2005,2006,2007,2009,2011,2013,2016,2019,2022,2025,2029,2032,2036,2040,2043,2046,2049,2052,2055,2058,2060,2062,2064,2066,2068,2069,2068,2067,2066,2064,2061,2059,2058,2056,2055,2054,2053,2052,2051,2050,2048,2045,2042,2039,2036,2032,2027,2024,2020,2017,2014,2012,2010,2009,2008,2008,2008,2009,2009,2009,2009,2009,2010,2011,2011,2012,2013,2013,2013,2012,2011,2011,2010,2009,2009,2009,2010,2010,2011,2011,2011,2010,2009,2008,2006,2003,2001,1998,1996,1994,1991,1988,1986,1984,1983,1981,1981,1981,1983,1984,1986,1988,1991,1994,1996,1997,1998,1999,1999,1999,1998,1997,1996,1994,1992,1991,1989,1988,1987,1986,1986,1986,1986,1986,1987,1987,1989,1990,1992,1995,2000,2006,2012,2018,2025,2033,2043,2052,2060,2067,2075,2082,2089,2094,2098,2102,2106,2109,2112,2114,2116,2117,2118,2120,2121,2123,2124,2125,2126,2128,2128,2129,2129,2128,2126,2123,2119,2115,2111,2104,2098,2092,2086,2081,2076,2072,2069,2066,2065,2065,2064,2064,2064,2063,2063,2062,2061,2059,2058,2056,2055,2054,2052,2051,2049,2048,2048,2047,2046,2045,2045,2045,2045,2046,2048,2049,2050,2051,2052,2053,2053,2052,2051,2049,2047,2045,2042,2041,2040,2041,2041,2042,2043,2044,2044,2043,2041,2038,2036,2034,2033,2031,2031,2031,2031,2032,2033,2034,2035,2036,2036,2037,2036,2036,2036,2036,2036,2037,2038,2039,2041,2043,2045,2046,2048,2049,2050,2051,2051,2053,2054,2056,2059,2061,2063,2066,2068,2069,2069,2068,2067,2065,2062,2059,2057,2054,2050,2047,2044,2042,2040,2038,2035,2032,2029,2027,2025,2022,2020,2018,2018,2017,2017,2017,2016,2015,2014,2013,2012,2011,2011,2011,2013,2015,2019,2024,2030,2036,2041,2047,2052,2058,2063,2067,2070,2072,2075,2077,2077,2077,2076,2075,2073,2071,2070,2069,2068,2068,2068,2068,2069,2070,2070,2071,2071,2070,2069,2067,2064,2060,2056,2052,2049,2046,2044,2041,2040,2040,2041,2042,2043,2044,2046,2047,2048,2049,2050,2051,2052,2052,2053,2053,2053,2054,2054,2055,2055,2056,2056,2057,2058,2060,2061,2064,2067,2070,2073,2075,2077,2079,2078,2077,2076,2073,2069,2064,2060,2056,2052,2049,2045,2041,2039,2036,2034,2031,2028,2025,2022,2020,2017,2014,2012,2010,2010,2010,2010,2012,2014,2017,2020,2023,2027,2031,2034,2037,2039,2042,2045,2048,2051,2052,2053,2054,2054,2055,2054,2054,2054,2054,2055,2056,2057,2059,2060,2062,2063,2064,2065,2065,2064,2063,2061,2058,2056,2053,2049,2045,2040,2036,2032,2028,2023,2019,2016,2014,2013,2012,2013,2016,2018,2021,2024,2027,2030,2032,2034,2035,2037,2038,2038,2039,2040,2041,2042,2045,2048,2050,2053,2056,2060,2064,2068,2072,2075,2079,2083,2087,2089,2091,2092,2092,2091,2089,2087,2086,2084,2083,2082,2083,2085,2087,2090,2094,2099,2102,2104,2106,2108,2109,2110,2109,2108,2108,2108,2108,2108,2108,2108,2109,2109,2110,2111,2111,2110,2109,2107,2105,2103,2100,2097,2092,2088,2083,2079,2075,2071,2068,2066,2065,2065,2067,2070,2073,2076,2079,2081,2083,2084,2085,2085,2084,2083,2082,2080,2079,2078,2077,2075,2074,2073,2072,2072,2071,2071,2071,2071,2071,2070,2068,2065,2061,2056,2050,2045,2038,2031,2023,2018,2014,2012,2011,2012,2015,2019,2024,2031,2038,2046,2052,2057,2061,2066,2070,2074,2076,2077,2077,2077,2076,2074,2072,2069,2066,2062,2059,2056,2055,2053,2052,2051,2050,2049,2048,2046,2044,2040,2035,2031,2026,2020,2013,2007,2003,2001,1999,1998,1998,1998,2000,2002,2004,2006,2010,2014,2018,2022,2027,2032,2036,2039,2042,2044,2044,2044,2044,2043,2042,2041,2039,2039,2039,2040,2041,2043,2045,2046,2047,2048,2048,2047,2046,2044,2042,2039,2036,2034,2031,2028,2026,2025,2024,2023,2021,2020,2020,2020,2019,2019,2020,2020,2019,2019,2018,2017,2014,2012,2010,2007,2004,2001,1999,1997,1996,1996,1996,1997,1998,1998,1999,1998,1997,1995,1993,1990,1987,1984,1981,1979,1978,1978,1979,1981,1985,1988,1992,1997,2003,2008,2013,2016,2019,2022,2024,2025,2025,2025,2025,2024,2022,2020,2018,2016,2012,2009,2005,2001,1997,1994,1992,1989,1987,1985,1983,1981,1978,1975,1971,1967,1965,1963,1961,1961,1963,1966,1971,1977,1985,1994,2002,2010,2018,2026,2035,2042,2048,2053,2057,2062,2066,2070,2073,2076,2079,2083,2086,2088,2089,2089,2089,2089,2090,2090,2091,2092,2094,2096,2098,2100,2101,2102,2102,2102,2102,2102,2101,2101,2101,2101,2102,2103,2103,2104,2105,2105,2104,2103,2100,2097,2093,2089,2086,2082,2078,2075,2072,2070,2067,2064,2060,2056,2052,2048,2044,2041,2038,2037,2036,2036,2036,2037,2038,2038,2038,2038,2038,2038,2038,2038,2039,2040,2041,2042,2043,2044,2045,2045,2044,2044,2043,2042,2041,2040,2038,2037,2037,2036,2036,2037,2038,2039,2040,2040,2040,2040,2040,2039,2039,2038,2038,2038,2038,2038,2038,2037,2036,2033,2029,2026,2023,2019,2015,2011,2009,2007,2006,2004,2003,2002,2001,2001,2000,2000,2000,2000,2001,2002,2002,2004,2005,2007,2009,2011,2014,2017,2020,2022,2023,2025,2026,2028,2029,2030,2031,2033,2034,2036,2037,2038,2039,2039,2039,2038,2037,2036,2036,2035,2034,2034,2033,2032,2030,2029,2028,2027,2027,2026,2026,2025,2024,2023,2022,2020,2018,2017,2016,2015,2015,2016,2017,2018,2019,2020,2021,2021,2022,2022,2023,2023,2024,2025,2027,2029,2031,2033,2035,2037,2040,2042,2044,2046,2048,2050,2052,2054,2055,2057,2059,2062,2064,2067,2069,2072,2075,2077,2079,2080,2082,2084,2086,2088,2090,2091,2093,2094,2094,2093,2092,2091,2088,2084,2080,2076,2072,2068,2064,2059,2054,2050,2047,2042,2038,2033,2029,2026,2023,2019,2015,2012,2010,2008,2007,2007,2007,2007,2008,2009,2011,2014,2017,2021,2024,2028,2032,2038,2044,2049,2053,2058,2063,2067,2071,2073,2076,2078,2080,2081,2081,2080,2078,2076,2072,2067,2063,2059,2055,2049,2043,2039,2034,2030,2026,2022,2018,2015,2013,2011,2009,2008,2006,2006,2006,2006,2006,2006,2006,2006,2006,2007,2008,2010,2012,2014,2016,2019,2022,2025,2027,2029,2030,2031,2032,2033,2033,2034,2034,2035,2036,2036,2037,2037,2037,2038,2038,2039,2039,2039,2039,2039,2038,2038,2038,2038,2040,2042,2044,2046,2048,2050,2052,2054,2055,2056,2057,2058,2060,2062,2064,2065,2067,2069,2071,2072,2074,2075,2077,2079,2081,2084,2087,2090,2094,2098,2100,2102,2103,2104,2104,2103,2102,2099,2096,2092,2088,2085,2082,2080,2080,2080,2082,2084,2085,2087,2089,2091,2092,2093,2095,2096,2097,2098,2098,2098,2098,2098,2097,2096,2095,2095,2095,2095,2095,2095,2094,2093,2092,2091,2088,2085,2083,2080,2075,2070,2063,2057,2052,2047,2041,2037,2033,2032,2031,2032,2033,2036,2038,2039,2041,2044,2047,2051,2055,2058,2061,2066,2070,2074,2077,2079,2082,2084,2086,2088,2089,2090,2090,2089,2087,2085,2082,2078,2074,2068,2063,2059,2054,2049,2042,2036,2031,2028,2025,2022,2021,2022,2023,2026,2029,2033,2038,2042,2045,2049,2052,2056,2060,2063,2065,2067,2069,2071,2072,2073,2073,2074,2074,2074,2074,2074,2073,2072,2071,2070,2069,2068,2066,2065,2063,2061,2058,2055,2052,2047,2043,2039,2037,2035,2034,2034,2035,2036,2038,2040,2042,2044,2044,2045,2044,2043,2040,2037,2033,2029,2025,2022,2018,2014,2011,2009,2007,2005,2003,2001,2000,1999,1998,1998,1997,1998,1998,1999,2000,2000,2001,2000,2000,1999,1998,1997,1997,1997,1997,1999,2002,2006,2009,2013,2016,2019,2022,2024,2025,2025,2024,2023,2022,2021,2021,2020,2020,2020,2020,2020,2020,2020,2020,2019,2019,2018,2017,2017,2015,2014,2013,2012,2010,2008,2005,2002,2000,1998,1997,1996,1996,1996,1997,1999,2002,2006,2009,2013,2015,2018,2020,2022,2024,2026,2027,2028,2030,2033,2037,2041,2045,2051,2057,2063,2069,2073,2077,2081,2085,2087,2088,2089,2090,2090,2090,2089,2089,2088,2088,2087,2087,2087,2088,2088,2089,2090,2091,2092,2093,2093,2093,2092,2091,2088,2086,2082,2078,2073,2070,2067,2065,2063,2062,2062,2063,2064,2065,2066,2067,2068,2068,2068,2067,2066,2065,2064,2062,2061,2060,2059,2059,2059,2059,2060,2061,2062,2063,2064,2065,2067,2069,2070,2071,2071,2071,2071,2070,2069,2067,2066,2064,2062,2061,2061,2061,2061,2061,2062,2062,2062,2062,2061,2059,2056,2053,2050,2048,2044,2041,2038,2036,2034,2033,2032,2031,2031,2031,2031,2032,2033,2034,2035,2036,2037,2037,2038,2038,2039,2039,2039,2039,2039,2039,2039,2039,2040,2042,2044,2046,2048,2049,2050,2051,2052,2052,2052,2051,2050,2049,2047,2046,2045,2043,2040,2038,2035,2033,2031,2030,2029,2028,2028,2028,2028,2028,2028,2028,2027,2027,2025,2024,2022,2020,2018,2017,2015,2013,2012,2011,2011,2012,2012,2014,2015,2016,2017,2018,2019,2021,2022,2023,2025,2026,2028,2029,2030,2031,2031,2032,2032,2033,2034,2035,2037,2040,2043,2046,2049,2052,2054,2057,2058,2059,2059,2059,2058,2057,2055,2054,2053,2052,2051,2051,2052,2053,2054,2056,2057,2059,2060,2061,2062,2063,2063,2064,2065,2066,2067,2068,2069,2070,2070,2070,2070,2069,2068,2067,2067,2066,2064,2063,2061,2059,2058,2056,2054,2051,2048,2046,2043,2040,2036,2033,2030,2028,2027,2027,2027,2028,2029,2029,2030,2030,2030,2029,2029,2028,2028,2028,2029,2030,2031,2033,2035,2038,2039,2041,2041,2042,2042,2041,2040,2039,2039,2038,2037,2037,2036,2036,2035,2035,2034,2034,2034,2034,2034,2034,2035,2036,2037,2039,2041,2043,2044,2046,2047,2047,2048,2048,2048,2049,2049,2049,2049,2050,2051,2051,2051,2051,2051,2050,2048,2047,2046,2045,2044,2045,2045,2047,2048,2050,2052,2054,2055,2056,2057,2058,2059,2059,2060,2061,2062,2063,2065,2066,2067,2068,2069,2070,2070,2071,2071,2071,2072,2072,2072,2072,2071,2071,2071,2070,2069,2068,2066,2064,2062,2060,2059,2059,2058,2058,2058,2058,2059,2059,2059,2059,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2057,2056,2054,2053,2051,2050,2048,2047,2046,2045,2045,2045,2046,2048,2050,2052,2055,2057,2059,2061,2063,2065,2067,2068,2069,2071,2072,2074,2074,2075,2075,2074,2072,2070,2069,2066,2064,2061,2059,2057,2056,2055,2054,2053,2052,2051,2050,2049,2047,2045,2042,2040,2038,2035,2033,2032,2032,2032,2032,2033,2034,2035,2035,2036,2035,2035,2034,2034,2034,2034,2035,2036,2037,2039,2040,2041,2043,2044,2044,2045,2044,2044,2044,2044,2045,2046,2047,2049,2051,2053,2054,2056,2057,2059,2060,2060,2061,2061,2061,2060,2060,2059,2059,2058,2057,2055,2052,2050,2048,2046,2044,2043,2042,2042,2042,2044,2046,2049,2051,2053,2056,2058,2060,2061,2062,2063,2063,2064,2065,2066,2066,2066,2066,2067,2067,2066,2066,2065,2064,2062,2060,2058,2056,2053,2049,2046,2042,2039,2036,2032,2028,2024,2021,2019,2018,2017,2016,2017,2018,2019,2021,2024,2027,2030,2032,2034,2036,2039,2041,2043,2046,2048,2050,2051,2052,2052,2052,2052,2051,2049,2048,2046,2045,2043,2041,2040,2038,2037,2035,2034,2033,2032,2031,2031,2030,2029,2028,2028,2027,2027,2027,2027,2028,2029,2031,2033,2036,2039,2042,2045,2048,2051,2054,2057,2059,2061,2062,2062,2062,2061,2060,2059,2058,2056,2054,2053,2052,2051,2050,2049,2049,2049,2050,2051,2052,2053,2054,2054,2054,2054,2053,2052,2051,2050,2050,2049,2049,2050,2051,2052,2054,2055,2057,2059,2060,2061,2063,2064,2065,2066,2067,2068,2069,2071,2073,2075,2077,2079,2081,2083,2084,2085,2085,2085,2085,2084,2083,2082,2081,2079,2077,2073,2070,2066,2063,2058,2053,2049,2046,2044,2043,2043,2044,2045,2047,2048,2048,2048,2047,2046,2045,2042,2040,2037,2035,2034,2033,2032,2032,2033,2035,2036,2038,2041,2044,2047,2050,2052,2055,2058,2060,2062,2064,2065,2066,2067,2067,2067,2067,2067,2067,2067,2067,2068,2068,2068,2068,2068,2068,2068,2068,2067,2066,2066,2065,2065,2064,2064,2063,2061,2059,2058,2056,2053,2051,2048,2046,2044,2042,2040,2038,2036,2036,2035,2034,2034,2034,2034,2034,2034,2035,2035,2037,2038,2040,2042,2045,2048,2051,2052,2054,2055,2056,2056,2057,2057,2058,2060,2062,2064,2066,2068,2071,2073,2075,2076,2077,2077,2077,2077,2077,2077,2076,2075,2073,2070,2067,2064,2060,2055,2050,2044,2039,2035,2031,2027,2024,2022,2021,2020,2020,2020,2020,2020,2020,2021,2021,2021,2021,2020,2020,2020,2020,2020,2020,2021,2022,2024,2027,2030,2034,2037,2040,2043,2047,2051,2055,2057,2059,2062,2063,2064,2065,2065,2065,2065,2065,2065,2065,2065,2065,2066,2067,2067,2068,2068,2068,2069,2068,2068,2067,2065,2063,2059,2056,2053,2049,2045,2040,2036,2032,2029,2026,2022,2019,2017,2016,2015,2014,2014,2014,2014,2014,2014,2015,2015,2016,2017,2019,2021,2024,2027,2029,2031,2033,2035,2038,2040,2042,2043,2045,2048,2051,2053,2055,2056,2057,2058,2058,2058,2058,2058,2058,2058,2058,2057,2057,2055,2054,2051,2049,2048,2046,2044,2042,2040,2038,2037,2036,2035,2034,2034,2033,2033,2033,2033,2033,2032,2032,2031,2030,2030,2030,2030,2030,2031,2032,2033,2034,2035,2037,2038,2041,2044,2046,2049,2052,2055,2059,2063,2067,2070,2073,2075,2078,2081,2082,2084,2085,2085,2086,2086,2085,2085,2084,2083,2081,2080,2079,2077,2076,2073,2071,2069,2068,2066,2065,2063,2062,2060,2059,2057,2054,2052,2050,2048,2047,2045,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2044,2045,2046,2047,2048,2049,2050,2052,2053,2054,2055,2056,2057,2058,2059,2059,2059,2059,2059,2060,2060,2060,2061,2061,2062,2061,2061,2060,2059,2058,2056,2055,2054,2053,2052,2051,2050,2048,2047,2045,2043,2040,2038,2036,2034,2033,2031,2030,2029,2029,2029,2028,2028,2028,2027,2028,2028,2028,2028,2028,2027,2027,2026,2025,2024,2023,2022,2022,2021,2021,2022,2022,2023,2024,2025,2027,2028,2029,2031,2032,2033,2035,2035,2036,2036,2036,2035,2035,2034,2034,2033,2032,2032,2032,2031,2031,2031,2031,2032,2032,2033,2034,2035,2035,2036,2037,2037,2038,2038,2038,2039,2040,2041,2043,2046,2049,2052,2055,2058,2061,2065,2068,2070,2072,2074,2076,2077,2078,2079,2079,2080,2080,2079,2079,2079,2078,2076,2075,2073,2072,2070,2067,2065,2062,2060,2058,2055,2053,2050,2047,2044,2042,2040,2037,2035,2034,2033,2033,2032,2032,2033,2034,2035,2036,2038,2041,2043,2045,2046,2047,2048,2049,2050,2050,2050,2050,2050,2049,2049,2048,2048,2047,2047,2046,2045,2044,2043,2042,2040,2039,2038,2036,2034,2032,2031,2029,2028,2028,2027,2027,2028,2028,2029,2030,2031,2033,2034,2035,2037,2038,2041,2043,2044,2045,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2049,2050,2052,2054,2055,2057,2058,2060,2061,2062,2063,2063,2064,2064,2064,2064,2064,2064,2065,2065,2066,2066,2067,2067,2067,2067,2066,2066,2065,2065,2064,2063,2062,2060,2059,2057,2056,2054,2053,2052,2051,2050,2050,2051,2051,2052,2053,2054,2055,2056,2057,2058,2059,2059,2060,2060,2059,2059,2057,2056,2054,2053,2051,2050,2049,2047,2046,2045,2043,2041,2039,2037,2036,2035,2034,2034,2034,2035,2036,2037,2039,2042,2045,2047,2049,2051,2054,2056,2057,2058,2059,2060,2061,2063,2064,2065,2067,2068,2070,2071,2072,2072,2072,2071,2071,2070,2070,2069,2069,2068,2068,2068,2067,2065,2064,2062,2060,2058,2057,2056,2056,2056,2056,2058,2059,2060,2062,2063,2065,2065,2066,2066,2066,2066,2066,2065,2065,2064,2063,2063,2063,2062,2061,2061,2060,2059,2058,2057,2057,2057,2057,2058,2059,2061,2063,2065,2067,2068,2069,2070,2071,2072,2072,2073,2073,2073,2074,2074,2074,2074,2073,2073,2072,2071,2071,2070,2069,2069,2068,2068,2067,2067,2066,2064,2062,2060,2058,2056,2053,2050,2048,2047,2045,2044,2043,2042,2042,2042,2043,2043,2044,2044,2045,2045,2046,2047,2048,2049,2050,2050,2051,2051,2051,2051,2051,2051,2050,2050,2049,2049,2049,2049,2049,2050,2050,2051,2051,2051,2051,2051,2050,2050,2050,2049,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2050,2049,2049,2048,2048,2047,2047,2048,2048,2048,2049,2050,2050,2050,2050,2049,2049,2048,2046,2044,2042,2040,2038,2037,2035,2034,2033,2033,2032,2032,2032,2032,2032,2033,2033,2034,2034,2035,2036,2037,2037,2038,2038,2039,2038,2038,2036,2035,2034,2033,2032,2032,2033,2034,2035,2037,2039,2041,2043,2045,2046,2046,2047,2047,2047,2046,2046,2045,2044,2043,2042,2041,2040,2039,2038,2037,2037,2037,2037,2038,2039,2040,2041,2042,2043,2044,2044,2043,2043,2042,2041,2040,2040,2039,2039,2040,2040,2041,2042,2043,2044,2045,2045,2046,2047,2047,2048,2049,2050,2051,2052,2053,2054,2055,2056,2057,2058,2058,2059,2060,2061,2062,2063,2065,2066,2068,2070,2072,2073,2074,2074,2075,2075,2075,2075,2076,2076,2077,2078,2078,2079,2080,2080,2080,2079,2077,2076,2073,2071,2069,2067,2065,2062,2060,2057,2055,2052,2050,2047,2044,2041,2039,2037,2035,2034,2034,2033,2034,2034,2034,2035,2035,2034,2034,2034,2034,2034,2034,2035,2036,2038,2040,2042,2045,2047,2048,2050,2051,2052,2052,2051,2051,2051,2050,2050,2050,2050,2049,2049,2047,2046,2044,2042,2040,2037,2034,2031,2029,2028,2026,2026,2025,2025,2024,2024,2023,2022,2022,2021,2020,2019,2018,2018,2019,2020,2021,2022,2023,2024,2025,2025,2025,2025,2024,2024,2023,2023,2023,2023,2023,2024,2025,2025,2026,2026,2027,2027,2027,2028,2028,2028,2028,2029,2030,2030,2031,2033,2034,2035,2036,2038,2041,2043,2046,2048,2052,2056,2060,2063,2065,2067,2069,2070,2070,2069,2068,2066,2064,2062,2060,2059,2058,2057,2056,2055,2055,2054,2054,2054,2055,2055,2056,2057,2057,2058,2058,2058,2058,2057,2057,2055,2054,2052,2051,2050,2048,2047,2047,2047,2048,2049,2050,2052,2053,2054,2055,2056,2056,2056,2056,2056,2055,2055,2054,2053,2053,2053,2053,2053,2053,2054,2054,2054,2055,2055,2056,2056,2057,2057,2057,2057,2056,2055,2054,2052,2050,2047,2044,2042,2039,2037,2034,2032,2030,2028,2027,2026,2025,2024,2023,2023,2023,2023,2022,2023,2023,2023,2024,2024,2025,2026,2028,2029,2031,2033,2035,2036,2038,2040,2042,2044,2046,2048,2049,2051,2053,2055,2057,2058,2058,2059,2059,2058,2058,2057,2056,2055,2053,2052,2051,2049,2048,2046,2045,2043,2041,2039,2037,2034,2032,2031,2029,2027,2026,2025,2024,2024,2024,2024,2024,2024,2025,2025,2026,2027,2028,2030,2031,2033,2035,2037,2039,2041,2043,2044,2045,2047,2048,2049,2049,2049,2050,2050,2049,2049,2048,2048,2047,2046,2046,2045,2044,2044,2043,2042,2041,2041,2040,2040,2040,2040,2040,2040,2041,2041,2042,2042,2043,2044,2045,2046,2046,2047,2048,2049,2050,2051,2051,2052,2053,2053,2054,2054,2054,2055,2055,2056,2056,2057,2057,2058,2059,2060,2061,2062,2064,2065,2067,2070,2072,2074,2075,2077,2077,2078,2078,2077,2076,2075,2073,2071,2068,2066,2065,2063,2061,2059,2057,2056,2055,2054,2053,2053,2053,2052,2052,2052,2052,2051,2051,2050,2050,2049,2049,2048,2048,2048,2048,2048,2049,2050,2051,2053,2055,2057,2059,2061,2062,2063,2064,2065,2064,2064,2063,2062,2061,2060,2060,2059,2059,2060,2060,2061,2061,2062,2062,2063,2064,2064,2064,2065,2065,2065,2064,2064,2063,2062,2061,2060,2059,2058,2057,2056,2054,2053,2052,2051,2049,2048,2048,2047,2047,2047,2047,2047,2047,2047,2046,2045,2045,2044,2044,2044,2044,2045,2046,2047,2048,2050,2051,2052,2054,2055,2056,2057,2057,2058,2058,2058,2058,2057,2057,2056,2055,2055,2054,2054,2053,2053,2052,2051,2051,2050,2049,2048,2048,2047,2047,2047,2046,2045,2044,2044,2043,2042,2041,2040,2039,2039,2038,2037,2037,2037,2036,2036,2036,2036,2036,2036,2035,2035,2035,2035,2035,2036,2036,2037,2038,2039,2040,2042,2043,2044,2046,2048,2049,2049,2050,2051,2051,2051,2050,2050,2049,2048,2047,2046,2045,2044,2043,2042,2041,2040,2038,2037,2035,2033,2032,2030,2029,2027,2026,2024,2023,2022,2021,2020,2019,2019,2019,2019,2019,2020,2022,2023,2025,2027,2028,2031,2033,2034,2036,2037,2038,2040,2040,2041,2042,2042,2043,2044,2045,2046,2047,2048,2049,2049,2050,2050,2051,2051,2051,2051,2052,2052,2053,2053,2054,2055,2056,2056,2056,2057,2057,2058,2058,2058,2058,2059,2059,2059,2059,2059,2059,2059,2059,2059,2060,2059,2059,2059,2059,2059,2058,2058,2057,2056,2055,2054,2053,2051,2050,2048,2047,2045,2043,2041,2040,2039,2038,2038,2039,2039,2041,2042,2044,2045,2047,2048,2049,2051,2051,2052,2053,2053,2053,2053,2052,2052,2051,2051,2051,2051,2051,2052,2052,2053,2054,2055,2055,2056,2057,2058,2058,2059,2059,2059,2058,2058,2057,2056,2055,2053,2052,2051,2050,2050,2049,2049,2049,2049,2049,2050,2051,2052,2053,2054,2054,2055,2054,2054,2053,2051,2050,2048,2046,2044,2043,2042,2042,2041,2042,2042,2043,2044,2045,2046,2047,2047,2048,2049,2049,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2054,2055,2056,2058,2060,2061,2062,2062,2062,2062,2061,2060,2059,2058,2056,2055,2054,2053,2052,2051,2051,2050,2050,2050,2050,2050,2049,2050,2049,2049,2049,2049,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2052,2053,2054,2054,2055,2055,2056,2056,2057,2057,2058,2058,2058,2059,2059,2059,2059,2058,2058,2057,2056,2055,2054,2053,2053,2052,2051,2050,2049,2048,2047,2046,2045,2044,2044,2043,2043,2043,2043,2043,2042,2042,2041,2040,2039,2037,2036,2034,2033,2032,2031,2031,2030,2030,2030,2031,2031,2032,2033,2034,2034,2035,2035,2036,2036,2037,2037,2038,2038,2039,2039,2039,2039,2039,2038,2038,2037,2037,2037,2037,2037,2037,2037,2038,2038,2039,2039,2039,2039,2038,2038,2037,2037,2036,2035,2035,2035,2035,2035,2035,2036,2036,2037,2038,2039,2040,2041,2042,2044,2046,2048,2049,2051,2052,2054,2055,2056,2057,2057,2058,2058,2058,2058,2058,2057,2056,2055,2054,2053,2052,2051,2049,2048,2047,2046,2045,2044,2043,2042,2041,2041,2040,2040,2040,2040,2041,2042,2043,2043,2044,2044,2045,2045,2046,2046,2047,2048,2049,2051,2053,2055,2057,2059,2061,2064,2066,2067,2069,2069,2069,2069,2068,2067,2066,2065,2063,2061,2059,2058,2056,2055,2054,2052,2051,2051,2050,2050,2051,2051,2052,2053,2054,2056,2057,2058,2059,2059,2059,2059,2058,2057,2057,2056,2055,2055,2054,2054,2053,2053,2053,2052,2051,2051,2050,2049,2048,2047,2046,2045,2044,2043,2042,2041,2040,2039,2038,2038,2037,2037,2036,2036,2036,2037,2037,2038,2038,2039,2040,2041,2043,2044,2045,2046,2048,2049,2050,2051,2051,2051,2051,2051,2051,2051,2050,2050,2049,2048,2048,2047,2047,2046,2046,2045,2045,2044,2043,2043,2042,2042,2041,2041,2041,2041,2041,2041,2041,2041,2041,2040,2040,2040,2039,2039,2040,2040,2041,2042,2043,2045,2047,2049,2050,2052,2053,2054,2055,2056,2056,2057,2057,2057,2057,2057,2057,2056,2056,2056,2056,2055,2055,2054,2054,2054,2053,2052,2052,2051,2050,2049,2049,2048,2047,2046,2044,2043,2042,2041,2040,2039,2038,2038,2038,2039,2039,2040,2041,2043,2044,2045,2046,2048,2049,2050,2050,2050,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2049,2048,2048,2047,2046,2045,2044,2043,2042,2041,2040,2040,2039,2039,2039,2039,2038,2038,2038,2037,2037,2037,2037,2037,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2036,2037,2037,2038,2038,2039,2039,2040,2040,2040,2041,2041,2041,2040,2040,2039,2038,2037,2035,2034,2032,2031,2030,2028,2027,2027,2026,2026,2027,2027,2028,2029,2030,2031,2032,2033,2034,2035,2035,2036,2037,2037,2037,2038,2038,2039,2039,2040,2041,2041,2042,2042,2043,2044,2045,2046,2046,2047,2048,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2045,2045,2044,2044,2043,2043,2042,2041,2041,2040,2039,2039,2038,2038,2037,2037,2037,2036,2036,2036,2036,2036,2037,2038,2040,2041,2043,2045,2048,2051,2053,2055,2056,2058,2059,2061,2062,2064,2065,2067,2068,2070,2071,2072,2072,2073,2073,2072,2072,2071,2070,2069,2067,2066,2065,2063,2062,2060,2059,2058,2057,2055,2054,2053,2052,2051,2050,2050,2050,2050,2050,2051,2051,2052,2053,2053,2054,2054,2055,2056,2057,2058,2060,2061,2063,2065,2067,2068,2070,2071,2072,2073,2073,2073,2072,2072,2070,2069,2068,2067,2065,2064,2063,2062,2061,2060,2060,2059,2059,2059,2058,2058,2058,2057,2057,2056,2056,2055,2054,2053,2052,2051,2050,2050,2049,2049,2049,2050,2050,2050,2050,2050,2049,2049,2049,2048,2048,2047,2047,2046,2045,2044,2043,2042,2041,2040,2039,2039,2039,2039,2039,2040,2041,2042,2043,2043,2044,2045,2046,2047,2048,2049,2050,2051,2051,2052,2052,2053,2054,2054,2055,2055,2055,2055,2054,2053,2052,2050,2049,2047,2045,2043,2041,2040,2038,2037,2035,2034,2033,2032,2031,2030,2029,2029,2028,2028,2028,2028,2029,2029,2029,2030,2031,2032,2033,2034,2035,2035,2036,2038,2039,2040,2040,2041,2042,2044,2045,2046,2046,2047,2047,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2047,2048,2048,2049,2050,2051,2052,2053,2054,2055,2056,2056,2056,2057,2057,2056,2056,2056,2056,2055,2055,2054,2054,2054,2053,2054,2054,2054,2055,2055,2055,2055,2055,2054,2053,2052,2050,2049,2047,2046,2045,2044,2043,2042,2042,2042,2042,2042,2042,2042,2043,2043,2044,2045,2045,2046,2047,2048,2049,2050,2050,2051,2052,2053,2054,2055,2056,2057,2058,2058,2059,2060,2061,2061,2062,2063,2063,2063,2064,2063,2063,2062,2061,2060,2059,2058,2057,2056,2055,2054,2053,2052,2051,2051,2050,2049,2048,2048,2047,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2047,2048,2049,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2053,2054,2055,2055,2056,2056,2056,2056,2056,2056,2056,2056,2056,2056,2056,2055,2055,2053,2051,2049,2048,2045,2043,2041,2039,2038,2036,2035,2034,2033,2032,2032,2031,2031,2031,2030,2030,2030,2029,2029,2029,2028,2028,2028,2028,2029,2029,2030,2031,2032,2033,2035,2037,2038,2040,2042,2044,2046,2048,2049,2050,2051,2052,2052,2052,2052,2052,2051,2051,2050,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2045,2044,2043,2042,2041,2040,2039,2038,2038,2038,2037,2038,2038,2039,2040,2041,2043,2044,2046,2047,2048,2049,2050,2051,2052,2053,2054,2055,2056,2056,2057,2058,2058,2058,2058,2057,2057,2056,2055,2055,2054,2053,2052,2052,2051,2051,2050,2049,2048,2047,2046,2045,2043,2042,2041,2040,2039,2038,2038,2037,2037,2037,2037,2037,2038,2038,2038,2039,2039,2040,2041,2041,2042,2043,2045,2046,2047,2047,2047,2048,2047,2047,2046,2045,2044,2043,2042,2041,2041,2040,2040,2040,2040,2039,2039,2039,2039,2038,2037,2037,2036,2036,2035,2035,2035,2035,2035,2035,2035,2035,2034,2034,2034,2033,2033,2032,2032,2031,2031,2031,2031,2032,2032,2032,2032,2032,2032,2032,2032,2031,2031,2030,2030,2030,2030,2030,2030,2030,2030,2031,2031,2032,2033,2034,2035,2036,2037,2038,2040,2041,2043,2044,2046,2047,2049,2050,2051,2051,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2053,2052,2052,2051,2051,2050,2049,2048,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2043,2044,2044,2044,2045,2046,2047,2048,2050,2051,2052,2053,2054,2055,2056,2057,2058,2059,2060,2061,2061,2062,2062,2062,2063,2063,2063,2063,2063,2063,2063,2063,2063,2063,2062,2062,2061,2060,2059,2058,2057,2055,2053,2052,2051,2049,2048,2047,2047,2047,2047,2047,2048,2049,2050,2051,2052,2053,2054,2055,2056,2057,2058,2059,2060,2062,2063,2064,2065,2066,2066,2067,2067,2068,2068,2068,2067,2067,2067,2067,2066,2066,2066,2066,2065,2065,2064,2063,2062,2061,2060,2058,2057,2056,2055,2054,2053,2053,2052,2052,2051,2051,2050,2050,2049,2049,2048,2048,2047,2046,2046,2045,2044,2043,2042,2041,2040,2039,2039,2038,2037,2037,2037,2037,2037,2037,2038,2038,2039,2040,2040,2041,2041,2041,2041,2041,2040,2039,2039,2038,2038,2038,2037,2037,2037,2037,2037,2038,2038,2039,2040,2040,2041,2042,2042,2043,2043,2043,2043,2043,2043,2043,2043,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2044,2045,2045,2046,2046,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2044,2044,2044,2045,2045,2046,2046,2047,2047,2048,2049,2049,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2053,2053,2054,2054,2055,2055,2056,2056,2057,2058,2059,2059,2060,2060,2061,2061,2061,2062,2062,2061,2061,2061,2061,2061,2060,2060,2059,2059,2059,2058,2057,2057,2056,2056,2056,2055,2055,2054,2054,2054,2053,2053,2052,2052,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2052,2053,2054,2054,2055,2056,2056,2056,2057,2057,2057,2056,2056,2056,2055,2055,2054,2054,2053,2053,2052,2052,2052,2052,2052,2051,2051,2051,2050,2050,2050,2049,2049,2049,2048,2048,2047,2047,2046,2046,2046,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2048,2049,2049,2050,2050,2051,2051,2051,2050,2050,2049,2048,2048,2047,2047,2046,2045,2044,2043,2042,2042,2041,2040,2040,2039,2039,2039,2039,2039,2038,2038,2038,2037,2037,2037,2036,2036,2036,2037,2037,2038,2039,2040,2041,2042,2043,2044,2045,2046,2047,2048,2049,2049,2050,2050,2050,2051,2051,2051,2050,2050,2050,2050,2050,2051,2051,2052,2053,2054,2055,2056,2057,2057,2058,2059,2059,2060,2060,2060,2060,2059,2059,2058,2058,2058,2057,2057,2056,2056,2056,2055,2055,2054,2054,2053,2053,2052,2051,2050,2050,2049,2048,2046,2045,2044,2043,2041,2040,2039,2038,2038,2038,2039,2039,2040,2041,2041,2042,2043,2044,2045,2045,2046,2046,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2047,2046,2045,2045,2044,2043,2042,2041,2040,2039,2038,2037,2036,2034,2033,2032,2031,2030,2029,2028,2028,2027,2027,2026,2025,2025,2025,2025,2024,2025,2025,2026,2027,2028,2029,2031,2033,2035,2036,2038,2039,2041,2042,2042,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2042,2042,2042,2041,2041,2041,2040,2040,2040,2040,2040,2040,2039,2039,2039,2038,2038,2038,2037,2037,2037,2037,2037,2037,2037,2038,2039,2040,2041,2042,2043,2044,2045,2046,2047,2048,2049,2049,2050,2050,2051,2051,2051,2051,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2049,2050,2051,2051,2052,2053,2054,2055,2056,2056,2056,2057,2057,2057,2056,2056,2055,2055,2054,2053,2052,2052,2051,2050,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2051,2051,2052,2053,2053,2054,2055,2056,2057,2057,2058,2058,2059,2059,2059,2059,2059,2058,2057,2057,2056,2054,2053,2051,2050,2049,2048,2047,2046,2046,2046,2046,2046,2046,2047,2048,2049,2049,2050,2051,2052,2053,2053,2053,2054,2054,2054,2053,2053,2053,2053,2053,2053,2053,2052,2052,2052,2051,2051,2050,2050,2049,2048,2047,2046,2045,2044,2043,2042,2041,2040,2039,2039,2038,2038,2037,2037,2037,2036,2036,2036,2036,2037,2037,2037,2038,2038,2039,2039,2039,2039,2039,2039,2039,2039,2039,2039,2039,2039,2039,2039,2039,2040,2040,2041,2041,2042,2043,2044,2045,2046,2046,2047,2048,2049,2050,2051,2051,2052,2052,2053,2053,2053,2052,2052,2052,2051,2051,2050,2050,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2048,2049,2050,2051,2052,2052,2053,2054,2055,2055,2056,2056,2056,2056,2056,2055,2055,2054,2053,2052,2050,2049,2048,2046,2045,2043,2042,2041,2040,2040,2039,2039,2039,2039,2039,2040,2040,2041,2041,2042,2042,2042,2043,2043,2043,2044,2044,2045,2045,2046,2046,2047,2048,2049,2050,2051,2052,2053,2054,2055,2056,2056,2057,2057,2057,2057,2057,2057,2057,2056,2056,2055,2054,2054,2053,2052,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2049,2048,2047,2046,2046,2045,2044,2043,2042,2042,2041,2041,2041,2041,2041,2041,2042,2043,2044,2045,2046,2047,2048,2049,2051,2051,2052,2053,2054,2054,2055,2055,2056,2056,2057,2057,2058,2058,2059,2059,2060,2060,2061,2061,2060,2060,2059,2059,2058,2057,2057,2056,2055,2055,2054,2053,2052,2052,2051,2050,2049,2048,2047,2046,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2046,2047,2048,2049,2050,2050,2051,2052,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2054,2054,2054,2054,2054,2054,2054,2054,2053,2053,2052,2052,2051,2050,2050,2049,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2050,2050,2051,2051,2052,2052,2053,2053,2053,2053,2053,2053,2052,2051,2051,2050,2049,2048,2047,2047,2046,2046,2045,2045,2045,2044,2044,2043,2043,2042,2041,2040,2040,2039,2038,2038,2037,2037,2037,2037,2037,2038,2038,2039,2039,2040,2041,2042,2043,2044,2044,2045,2045,2045,2046,2046,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2046,2046,2046,2045,2045,2045,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2046,2046,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2051,2052,2052,2052,2053,2053,2053,2053,2053,2054,2054,2054,2054,2053,2053,2053,2053,2053,2053,2053,2053,2052,2052,2052,2052,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2050,2051,2051,2051,2052,2052,2053,2053,2054,2054,2055,2055,2056,2056,2056,2056,2056,2056,2056,2056,2056,2056,2056,2055,2055,2055,2054,2053,2053,2052,2051,2050,2049,2048,2047,2047,2046,2045,2045,2044,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2045,2045,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2046,2045,2045,2045,2044,2044,2044,2045,2045,2046,2046,2047,2048,2048,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2052,2053,2053,2054,2055,2056,2056,2057,2057,2058,2058,2058,2057,2057,2057,2056,2055,2054,2053,2052,2052,2051,2050,2049,2048,2047,2046,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2046,2046,2046,2047,2048,2049,2050,2051,2052,2052,2053,2053,2054,2054,2054,2053,2053,2053,2052,2051,2051,2050,2050,2049,2049,2048,2048,2047,2047,2046,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2043,2043,2043,2043,2042,2042,2042,2042,2041,2041,2041,2041,2041,2041,2040,2040,2040,2039,2039,2038,2038,2037,2037,2037,2037,2037,2037,2037,2038,2038,2038,2039,2039,2039,2039,2039,2040,2040,2040,2041,2041,2042,2042,2043,2044,2044,2045,2045,2046,2046,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2049,2049,2049,2050,2050,2050,2051,2051,2051,2051,2051,2051,2052,2052,2052,2053,2053,2054,2054,2055,2055,2056,2056,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2057,2058,2058,2058,2059,2059,2059,2059,2059,2059,2059,2059,2059,2059,2058,2058,2057,2057,2056,2055,2054,2053,2052,2051,2050,2049,2048,2048,2047,2046,2046,2045,2045,2044,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2045,2045,2046,2046,2046,2047,2047,2047,2048,2048,2049,2049,2049,2049,2050,2049,2049,2049,2049,2048,2047,2047,2046,2046,2045,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2046,2046,2046,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2052,2052,2053,2053,2054,2054,2054,2055,2055,2056,2056,2056,2056,2057,2057,2057,2057,2057,2057,2058,2058,2058,2058,2058,2058,2058,2058,2057,2057,2057,2056,2056,2056,2056,2056,2056,2056,2055,2055,2055,2054,2054,2053,2052,2051,2051,2050,2049,2048,2047,2046,2045,2045,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2044,2045,2045,2046,2046,2047,2048,2048,2049,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2049,2049,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2043,2043,2043,2043,2042,2042,2043,2043,2043,2044,2044,2045,2046,2047,2047,2048,2049,2049,2050,2050,2051,2051,2051,2052,2052,2053,2053,2054,2054,2055,2055,2055,2056,2056,2055,2055,2055,2055,2054,2054,2053,2053,2052,2052,2051,2050,2049,2048,2048,2047,2046,2045,2045,2044,2044,2044,2044,2045,2045,2045,2046,2047,2047,2048,2049,2049,2050,2051,2052,2052,2053,2054,2054,2055,2056,2056,2057,2057,2057,2058,2058,2058,2058,2057,2057,2057,2056,2056,2056,2055,2054,2054,2053,2053,2052,2052,2051,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2051,2052,2052,2052,2052,2053,2053,2053,2053,2054,2054,2054,2054,2054,2054,2054,2054,2053,2053,2053,2053,2053,2052,2052,2052,2051,2051,2051,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2046,2046,2045,2045,2044,2044,2044,2044,2043,2043,2043,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2043,2043,2043,2043,2043,2043,2043,2042,2042,2042,2041,2041,2041,2040,2040,2040,2040,2040,2040,2039,2039,2038,2038,2037,2037,2037,2036,2036,2035,2035,2035,2035,2035,2035,2035,2035,2035,2035,2036,2037,2038,2039,2040,2041,2042,2043,2043,2044,2044,2045,2045,2045,2046,2046,2046,2046,2047,2048,2048,2049,2050,2051,2052,2053,2054,2055,2055,2056,2056,2057,2057,2057,2057,2057,2057,2057,2056,2056,2056,2056,2056,2056,2056,2056,2057,2057,2057,2057,2057,2057,2056,2056,2056,2055,2055,2054,2053,2053,2052,2052,2051,2050,2050,2050,2050,2050,2050,2050,2051,2051,2052,2053,2053,2054,2054,2055,2055,2056,2056,2056,2056,2056,2057,2057,2057,2057,2057,2056,2056,2056,2056,2056,2056,2056,2056,2055,2055,2055,2054,2054,2053,2052,2051,2051,2049,2048,2047,2046,2045,2044,2043,2042,2041,2041,2040,2040,2040,2040,2040,2041,2041,2041,2041,2042,2042,2043,2043,2043,2043,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2044,2044,2044,2043,2043,2043,2043,2042,2042,2042,2041,2041,2040,2039,2039,2039,2038,2038,2038,2038,2039,2039,2039,2040,2040,2040,2041,2041,2041,2041,2041,2041,2041,2041,2041,2041,2041,2041,2042,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2044,2044,2045,2045,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2049,2049,2050,2050,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2050,2050,2050,2051,2051,2051,2052,2052,2052,2053,2053,2054,2054,2054,2055,2055,2055,2056,2056,2056,2056,2057,2057,2057,2057,2058,2058,2058,2058,2058,2059,2059,2059,2058,2058,2058,2058,2058,2057,2057,2057,2056,2056,2056,2055,2055,2055,2055,2054,2054,2054,2054,2054,2054,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2054,2054,2053,2052,2052,2051,2051,2050,2050,2049,2049,2049,2048,2048,2047,2046,2046,2045,2045,2044,2044,2043,2043,2043,2042,2042,2042,2041,2041,2041,2040,2040,2040,2040,2040,2040,2040,2040,2041,2041,2041,2042,2042,2043,2043,2044,2044,2044,2044,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2046,2046,2047,2047,2048,2049,2049,2050,2050,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2051,2051,2051,2052,2052,2053,2053,2053,2054,2054,2054,2054,2054,2054,2054,2054,2054,2054,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2052,2052,2052,2052,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2048,2048,2047,2047,2046,2046,2045,2045,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2049,2049,2050,2050,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2049,2049,2049,2048,2048,2047,2047,2046,2046,2045,2045,2044,2044,2043,2043,2042,2042,2042,2041,2041,2041,2041,2040,2040,2040,2040,2040,2040,2040,2040,2040,2040,2041,2041,2042,2042,2043,2044,2045,2045,2046,2046,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2050,2050,2049,2049,2048,2047,2047,2046,2046,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2044,2044,2044,2043,2043,2042,2042,2042,2041,2041,2041,2041,2041,2041,2041,2041,2041,2042,2042,2042,2042,2042,2043,2043,2043,2044,2044,2044,2045,2046,2046,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2048,2048,2048,2049,2049,2050,2050,2050,2051,2051,2052,2052,2052,2053,2053,2053,2053,2054,2054,2053,2053,2053,2053,2053,2052,2052,2052,2051,2051,2051,2051,2050,2050,2049,2049,2049,2048,2048,2048,2047,2047,2047,2046,2046,2045,2045,2044,2044,2043,2043,2043,2042,2042,2042,2042,2042,2043,2043,2043,2044,2044,2045,2045,2046,2046,2047,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2050,2050,2050,2049,2048,2048,2048,2047,2047,2046,2046,2046,2045,2045,2044,2044,2044,2043,2043,2042,2042,2042,2042,2041,2041,2041,2041,2041,2042,2042,2042,2042,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2048,2048,2049,2050,2051,2052,2052,2053,2054,2054,2055,2055,2055,2056,2056,2056,2056,2055,2055,2055,2054,2054,2054,2054,2053,2053,2053,2052,2052,2052,2052,2052,2051,2051,2051,2051,2050,2050,2049,2049,2049,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2046,2046,2046,2047,2047,2047,2048,2048,2049,2049,2049,2050,2050,2050,2050,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2045,2045,2045,2045,2046,2046,2047,2047,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2044,2045,2045,2045,2045,2045,2046,2046,2047,2047,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2053,2053,2053,2053,2054,2054,2054,2054,2053,2053,2053,2053,2052,2052,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2053,2052,2052,2052,2052,2051,2051,2051,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2044,2044,2043,2043,2043,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2049,2049,2048,2048,2048,2047,2047,2047,2046,2046,2045,2045,2044,2044,2043,2043,2043,2042,2042,2042,2042,2043,2043,2043,2043,2043,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2045,2045,2046,2046,2046,2047,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2049,2049,2049,2050,2050,2050,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2053,2053,2053,2053,2053,2053,2052,2052,2052,2052,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2044,2044,2044,2043,2043,2043,2043,2042,2042,2042,2042,2042,2042,2042,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2046,2047,2047,2048,2048,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2049,2049,2050,2051,2051,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2050,2050,2051,2051,2052,2052,2053,2053,2054,2054,2055,2055,2055,2055,2055,2055,2055,2055,2054,2054,2054,2054,2054,2054,2053,2053,2053,2053,2053,2053,2053,2052,2052,2052,2051,2051,2050,2050,2049,2049,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2047,2047,2046,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2048,2048,2049,2049,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2053,2053,2053,2053,2052,2052,2052,2052,2052,2051,2051,2051,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2050,2050,2051,2051,2051,2051,2051,2052,2051,2051,2051,2051,2051,2050,2050,2049,2049,2049,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2045,2045,2045,2044,2044,2044,2043,2043,2043,2043,2042,2042,2042,2042,2042,2042,2042,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2050,2050,2050,2050,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2053,2053,2053,2053,2053,2052,2052,2052,2052,2051,2051,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2045,2045,2045,2045,2044,2044,2044,2043,2043,2043,2043,2043,2042,2042,2042,2043,2043,2043,2043,2044,2044,2044,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2053,2053,2053,2053,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2050,2050,2050,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2050,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2048,2049,2049,2049,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2049,2049,2049,2048,2048,2047,2047,2047,2046,2046,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2045,2045,2045,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2042,2042,2042,2042,2041,2041,2041,2041,2040,2040,2040,2039,2039,2039,2039,2039,2039,2040,2040,2040,2040,2040,2041,2041,2041,2042,2042,2042,2042,2042,2043,2043,2043,2043,2044,2044,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2051,2052,2052,2052,2053,2053,2054,2054,2054,2054,2055,2055,2055,2055,2055,2055,2056,2056,2057,2057,2058,2059,2059,2060,2060,2061,2062,2062,2063,2063,2064,2064,2065,2065,2066,2066,2066,2067,2067,2068,2068,2068,2069,2069,2070,2070,2071,2071,2072,2072,2072,2073,2073,2073,2074,2074,2074,2074,2074,2074,2074,2074,2073,2073,2073,2073,2073,2073,2073,2073,2073,2073,2073,2073,2073,2074,2074,2074,2074,2074,2073,2073,2073,2073,2072,2071,2070,2069,2068,2067,2067,2066,2065,2064,2063,2062,2061,2060,2059,2058,2057,2056,2055,2055,2054,2053,2052,2051,2050,2050,2049,2049,2049,2048,2047,2047,2046,2045,2043,2042,2040,2039,2037,2035,2033,2031,2030,2028,2027,2026,2025,2024,2023,2022,2020,2019,2018,2017,2016,2015,2014,2013,2013,2012,2011,2010,2009,2007,2006,2005,2004,2004,2003,2003,2003,2002,2001,2000,2000,1999,1998,1996,1995,1993,1992,1991,1991,1990,1989,1989,1989,1990,1990,1990,1991,1991,1991,1992,1992,1993,1994,1995,1996,1998,1999,2001,2004,2006,2007,2009,2011,2013,2014,2015,2017,2018,2020,2022,2023,2025,2026,2028,2030,2031,2032,2033,2034,2036,2038,2040,2042,2044,2046,2048,2051,2053,2054,2056,2057,2059,2061,2062,2064,2066,2069,2072,2074,2076,2079,2081,2083,2085,2086,2087,2088,2089,2091,2092,2093,2094,2094,2095,2096,2097,2098,2099,2099,2099,2099,2100,2100,2100,2101,2101,2102,2102,2103,2104,2105,2106,2107,2107,2108,2109,2110,2111,2112,2113,2113,2114,2114,2114,2113,2113,2112,2110,2109,2108,2108,2107,2106,2104,2103,2101,2100,2099,2098,2096,2095,2093,2091,2089,2087,2085,2083,2082,2080,2078,2076,2075,2073,2072,2070,2067,2065,2063,2062,2061,2059,2058,2056,2054,2052,2050,2047,2044,2042,2040,2038,2035,2032,2030,2028,2027,2025,2023,2021,2020,2018,2017,2015,2013,2011,2009,2008,2006,2005,2004,2003,2002,2001,2000,1999,1998,1997,1996,1996,1995,1994,1994,1994,1994,1994,1994,1994,1993,1993,1992,1991,1990,1989,1987,1987,1986,1986,1985,1985,1984,1984,1983,1983,1983,1983,1983,1984,1984,1984,1984,1985,1985,1986,1986,1987,1988,1989,1990,1991,1992,1994,1996,1998,2000,2003,2005,2009,2011,2013,2014,2016,2018,2020,2023,2025,2027,2028,2030,2031,2032,2033,2035,2037,2039,2041,2043,2045,2047,2049,2051,2053,2056,2058,2060,2064,2067,2069,2071,2073,2076,2079,2081,2084,2086,2088,2090,2092,2093,2094,2094,2094,2094,2096,2096,2097,2098,2099,2099,2100,2100,2101,2102,2103,2104,2104,2105,2105,2105,2105,2105,2105,2106,2106,2107,2108,2110,2111,2112,2113,2114,2116,2118,2119,2120,2120,2120,2120,2120,2120,2120,2119,2119,2118,2117,2116,2115,2113,2112,2110,2108,2106,2104,2101,2098,2095,2092,2089,2086,2083,2081,2080,2080,2079,2078,2077,2075,2074,2072,2070,2068,2067,2065,2064,2062,2060,2058,2057,2055,2054,2052,2051,2049,2046,2044,2041,2038,2034,2031,2029,2026,2024,2023,2021,2020,2018,2016,2014,2010,2007,2005,2004,2003,2003,2004,2006,2007,2008,2008,2008,2009,2009,2009,2008,2007,2005,2002,1999,1996,1994,1992,1990,1988,1986,1984,1981,1978,1974,1972,1970,1968,1967,1967,1967,1968,1969,1969,1970,1971,1972,1973,1974,1975,1977,1977,1978,1979,1980,1982,1984,1986,1987,1987,1986,1985,1984,1983,1983,1983,1984,1985,1987,1988,1990,1993,1995,1998,2000,2002,2004,2006,2008,2010,2010,2011,2012,2014,2016,2019,2021,2022,2023,2023,2023,2023,2023,2024,2026,2029,2032,2035,2038,2041,2045,2050,2055,2058,2061,2064,2068,2072,2075,2077,2078,2080,2082,2085,2086,2087,2087,2087,2087,2087,2087,2088,2088,2090,2092,2094,2098,2101,2104,2109,2113,2116,2118,2119,2121,2122,2124,2126,2128,2130,2132,2134,2134,2134,2134,2134,2134,2135,2136,2138,2139,2139,2140,2141,2142,2145,2148,2151,2154,2155,2154,2153,2151,2149,2147,2146,2143,2141,2137,2131,2123,2116,2109,2102,2094,2088,2084,2081,2079,2077,2074,2072,2071,2070,2070,2071,2071,2071,2069,2066,2063,2058,2054,2052,2049,2045,2041,2034,2025,2018,2011,2005,1998,1993,1989,1985,1981,1976,1970,1965,1963,1961,1961,1961,1962,1964,1967,1968,1971,1973,1976,1978,1979,1979,1978,1975,1971,1967,1963,1959,1955,1950,1946,1942,1938,1933,1927,1921,1916,1912,1909,1907,1905,1905,1905,1905,1905,1905,1905,1905,1905,1905,1904,1903,1900,1898,1897,1896,1897,1898,1901,1904,1909,1913,1917,1921,1926,1931,1935,1940,1946,1952,1958,1965,1971,1977,1984,1990,1994,1997,2000,2003,2006,2009,2011,2012,2013,2016,2020,2024,2030,2036,2042,2049,2056,2062,2068,2075,2083,2092,2100,2107,2112,2118,2123,2128,2130,2131,2131,2132,2132,2132,2130,2128,2126,2125,2124,2125,2125,2126,2126,2126,2126,2127,2129,2131,2134,2140,2145,2150,2154,2156,2158,2160,2161,2162,2164,2166,2169,2171,2172,2172,2172,2172,2172,2172,2172,2173,2173,2173,2172,2171,2171,2172,2172,2172,2172,2172,2171,2169,2167,2161,2154,2147,2140,2132,2124,2116,2110,2105,2100,2095,2088,2081,2076,2071,2067,2064,2060,2056,2053,2051,2049,2047,2043,2041,2038,2035,2033,2029,2025,2022,2019,2015,2012,2008,2005,2002,1999,1996,1990,1984,1979,1974,1970,1966,1963,1959,1957,1955,1955,1955,1954,1953,1951,1950,1950,1948,1947,1947,1946,1945,1945,1945,1944,1943,1941,1939,1934,1929,1924,1919,1916,1914,1913,1912,1912,1911,1911,1911,1910,1911,1910,1910,1911,1913,1916,1919,1924,1928,1934,1943,1953,1962,1970,1978,1984,1989,1992,1993,1994,1995,1999,2004,2010,2015,2020,2024,2029,2035,2040,2045,2050,2054,2059,2064,2069,2074,2080,2086,2093,2099,2105,2112,2118,2122,2125,2125,2125,2125,2124,2125,2126,2127,2128,2129,2130,2130,2130,2130,2130,2130,2129,2130,2132,2135,2139,2144,2147,2148,2148,2149,2151,2153,2155,2154,2154,2155,2156,2156,2156,2155,2154,2153,2152,2149,2147,2145,2142,2140,2138,2136,2135,2135,2136,2136,2134,2131,2127,2123,2119,2116,2114,2112,2110,2107,2105,2104,2103,2102,2099,2095,2091,2086,2080,2074,2069,2063,2057,2051,2046,2041,2036,2031,2026,2020,2015,2011,2005,2001,1998,1997,1997,1997,1996,1997,1998,2000,2000,1999,1997,1993,1990,1988,1986,1983,1980,1977,1973,1970,1966,1960,1954,1948,1943,1938,1933,1927,1921,1917,1916,1915,1914,1911,1908,1905,1902,1900,1898,1895,1891,1888,1886,1885,1884,1884,1883,1884,1885,1885,1886,1887,1887,1888,1889,1891,1895,1898,1903,1908,1913,1919,1924,1927,1928,1931,1936,1942,1949,1954,1958,1962,1965,1969,1973,1975,1976,1977,1979,1983,1988,1993,1998,2003,2009,2016,2022,2030,2038,2046,2054,2061,2062,2063,2064,2066,2069,2075,2080,2085,2090,2094,2097,2100,2101,2101,2099,2097,2094,2092,2091,2090,2090,2091,2091,2093,2095,2099,2104,2108,2110,2110,2110,2110,2114,2119,2126,2134,2142,2149,2158,2165,2171,2177,2181,2182,2183,2182,2182,2181,2181,2179,2177,2175,2173,2172,2171,2169,2166,2162,2158,2153,2148,2143,2140,2139,2139,2140,2140,2139,2137,2133,2128,2121,2111,2103,2095,2088,2081,2073,2065,2058,2053,2047,2043,2038,2034,2032,2029,2026,2024,2021,2017,2014,2011,2010,2011,2014,2017,2020,2021,2021,2021,2020,2020,2019,2019,2017,2014,2011,2006,2000,1992,1981,1971,1962,1954,1946,1938,1929,1920,1914,1907,1899,1890,1883,1880,1878,1876,1873,1869,1866,1865,1864,1864,1865,1866,1866,1865,1862,1858,1851,1843,1836,1831,1827,1824,1820,1817,1814,1812,1809,1807,1804,1802,1804,1807,1811,1816,1820,1825,1830,1835,1842,1851,1860,1868,1875,1882,1889,1895,1899,1903,1905,1908,1909,1910,1908,1907,1907,1908,1910,1913,1915,1916,1917,1918,1919,1918,1918,1919,1921,1927,1934,1941,1946,1953,1960,1969,1977,1985,1992,1999,2007,2015,2021,2026,2030,2034,2041,2049,2058,2067,2077,2087,2098,2107,2113,2117,2123,2130,2138,2145,2150,2156,2160,2162,2165,2167,2169,2170,2172,2174,2178,2182,2184,2185,2185,2187,2191,2196,2203,2210,2221,2232,2241,2250,2258,2265,2270,2272,2272,2270,2267,2261,2256,2252,2248,2244,2239,2232,2226,2223,2221,2219,2217,2213,2208,2206,2205,2206,2211,2218,2224,2228,2232,2237,2241,2243,2240,2236,2231,2222,2212,2203,2196,2189,2185,2180,2175,2172,2169,2166,2164,2159,2154,2150,2145,2141,2136,2133,2130,2127,2122,2116,2107,2096,2086,2073,2059,2043,2023,2003,1986,1971,1956,1941,1929,1921,1915,1910,1907,1904,1901,1901,1901,1901,1903,1904,1907,1910,1912,1915,1918,1920,1920,1918,1916,1913,1907,1901,1897,1892,1888,1883,1875,1868,1863,1859,1856,1852,1848,1845,1843,1840,1837,1833,1829,1827,1826,1826,1828,1833,1838,1841,1841,1839,1836,1834,1833,1832,1829,1827,1826,1825,1825,1826,1827,1829,1831,1833,1835,1838,1842,1848,1854,1858,1863,1868,1875,1886,1897,1908,1918,1929,1940,1951,1960,1971,1981,1992,2006,2021,2033,2044,2054,2063,2075,2085,2092,2098,2106,2118,2132,2144,2154,2163,2170,2177,2181,2183,2184,2185,2184,2183,2183,2183,2185,2189,2196,2205,2213,2223,2233,2245,2261,2276,2289,2301,2313,2325,2338,2350,2360,2367,2374,2379,2382,2382,2381,2378,2373,2366,2358,2352,2348,2346,2345,2345,2346,2348,2351,2354,2358,2363,2367,2372,2375,2376,2376,2375,2374,2373,2371,2368,2363,2359,2355,2350,2342,2330,2316,2303,2290,2276,2264,2249,2235,2225,2216,2209,2203,2199,2196,2193,2189,2185,2176,2166,2158,2149,2142,2134,2124,2113,2105,2098,2090,2081,2071,2062,2052,2040,2027,2012,1997,1986,1974,1964,1956,1950,1945,1941,1937,1932,1926,1919,1914,1908,1902,1896,1889,1882,1878,1874,1870,1868,1866,1865,1864,1863,1863,1859,1854,1850,1847,1844,1843,1844,1847,1852,1857,1861,1865,1870,1874,1875,1876,1875,1874,1874,1874,1873,1873,1873,1870,1867,1863,1860,1858,1857,1856,1856,1857,1858,1859,1860,1861,1862,1865,1870,1876,1886,1897,1907,1918,1929,1938,1949,1959,1968,1975,1983,1989,1993,1994,1995,1996,2001,2011,2024,2040,2056,2074,2092,2108,2118,2128,2139,2151,2167,2181,2192,2203,2214,2224,2235,2244,2250,2255,2261,2267,2273,2274,2273,2270,2266,2262,2261,2261,2263,2266,2269,2273,2276,2276,2276,2276,2280,2283,2285,2285,2284,2283,2282,2283,2283,2284,2284,2285,2287,2287,2285,2279,2272,2265,2259,2256,2253,2250,2247,2244,2240,2238,2235,2234,2233,2234,2236,2236,2236,2234,2229,2220,2210,2198,2186,2174,2161,2148,2139,2129,2119,2108,2095,2083,2075,2067,2058,2048,2039,2033,2028,2023,2018,2013,2009,2007,2004,1997,1988,1978,1970,1961,1952,1942,1932,1923,1917,1912,1910,1908,1903,1896,1889,1881,1872,1861,1851,1845,1841,1838,1836,1834,1834,1835,1838,1842,1844,1844,1841,1835,1827,1816,1799,1782,1769,1760,1753,1750,1748,1747,1745,1743,1741,1739,1737,1733,1731,1731,1733,1739,1748,1757,1767,1775,1785,1797,1811,1821,1829,1835,1840,1844,1848,1851,1856,1864,1877,1893,1907,1919,1930,1940,1951,1963,1969,1973,1976,1977,1980,1983,1987,1992,1996,1998,2000,2002,2005,2010,2013,2016,2018,2019,2018,2015,2013,2013,2014,2018,2021,2026,2034,2046,2060,2073,2087,2102,2117,2130,2142,2151,2161,2171,2179,2185,2189,2193,2196,2203,2210,2216,2223,2228,2232,2234,2233,2230,2227,2225,2224,2223,2222,2222,2223,2224,2224,2224,2223,2220,2217,2213,2207,2201,2196,2191,2187,2183,2179,2176,2175,2176,2179,2181,2181,2181,2181,2180,2179,2179,2180,2183,2185,2186,2184,2182,2181,2181,2182,2184,2186,2186,2187,2188,2188,2191,2195,2201,2206,2210,2214,2220,2226,2233,2240,2246,2253,2258,2261,2262,2261,2257,2251,2237,2219,2203,2189,2174,2158,2141,2125,2111,2097,2082,2066,2051,2038,2027,2019,2010,2000,1990,1983,1978,1974,1969,1963,1956,1948,1940,1930,1915,1898,1883,1869,1856,1842,1832,1828,1827,1828,1831,1836,1841,1848,1852,1856,1860,1862,1864,1867,1870,1876,1885,1894,1902,1907,1911,1915,1917,1916,1912,1905,1897,1887,1876,1867,1861,1858,1856,1852,1849,1847,1848,1849,1850,1849,1849,1850,1854,1858,1863,1870,1879,1887,1894,1901,1908,1916,1924,1931,1936,1937,1938,1938,1939,1941,1942,1942,1942,1942,1943,1946,1950,1957,1967,1974,1982,1991,2002,2018,2034,2048,2062,2074,2085,2097,2107,2116,2124,2134,2145,2154,2161,2168,2175,2185,2198,2213,2225,2237,2249,2260,2272,2282,2290,2297,2302,2306,2310,2313,2317,2319,2322,2325,2327,2327,2325,2324,2325,2329,2333,2336,2338,2340,2342,2344,2347,2352,2358,2364,2374,2384,2392,2398,2404,2406,2406,2403,2399,2394,2388,2382,2376,2370,2364,2357,2348,2338,2328,2320,2313,2308,2303,2302,2303,2307,2311,2319,2328,2337,2344,2349,2352,2354,2353,2352,2350,2346,2341,2333,2321,2312,2303,2296,2290,2279,2266,2255,2243,2230,2215,2199,2186,2174,2162,2149,2131,2113,2097,2082,2066,2052,2036,2024,2018,2012,2008,2008,2009,2008,2005,2001,1996,1993,1990,1988,1988,1989,1993,1997,2002,2006,2008,2009,2008,2005,2001,1997,1994,1993,1991,1988,1985,1986,1989,1994,2004,2015,2025,2033,2041,2049,2057,2061,2063,2064,2063,2063,2067,2073,2080,2087,2093,2099,2104,2107,2109,2111,2112,2114,2113,2113,2113,2114,2119,2125,2129,2132,2137,2144,2156,2169,2181,2191,2201,2212,2222,2229,2239,2250,2263,2280,2295,2304,2314,2323,2332,2345,2356,2363,2372,2382,2396,2411,2424,2437,2450,2463,2479,2494,2505,2514,2523,2531,2537,2541,2541,2538,2531,2525,2521,2520,2519,2518,2516,2513,2508,2505,2501,2496,2493,2493,2494,2495,2497,2498,2498,2498,2499,2499,2499,2497,2494,2489,2486,2483,2478,2470,2461,2455,2448,2440,2431,2420,2408,2396,2383,2370,2356,2337,2320,2308,2294,2279,2263,2249,2238,2229,2220,2211,2199,2187,2177,2166,2157,2147,2134,2122,2114,2109,2105,2097,2085,2076,2066,2055,2043,2025,2005,1990,1976,1961,1943,1919,1895,1875,1858,1841,1824,1807,1794,1783,1773,1764,1756,1750,1748,1747,1748,1749,1748,1746,1745,1743,1743,1741,1738,1736,1734,1731,1728,1724,1719,1714,1707,1700,1694,1687,1683,1681,1680,1680,1684,1693,1703,1713,1723,1732,1740,1746,1747,1746,1743,1738,1734,1730,1728,1726,1725,1729,1734,1741,1750,1759,1771,1784,1796,1805,1813,1821,1833,1848,1860,1873,1887,1902,1918,1932,1940,1946,1950,1950,1949,1945,1940,1937,1934,1934,1938,1942,1947,1954,1964,1979,1995,2006,2015,2022,2028,2034,2039,2044,2048,2053,2062,2071,2078,2086,2094,2103,2111,2116,2121,2127,2135,2146,2162,2179,2195,2213,2233,2260,2289,2314,2334,2351,2363,2374,2381,2382,2381,2379,2379,2380,2383,2384,2384,2382,2377,2371,2364,2357,2352,2345,2333,2319,2309,2301,2293,2284,2274,2268,2265,2263,2261,2257,2251,2245,2239,2232,2223,2213,2204,2196,2190,2183,2173,2162,2152,2140,2127,2115,2097,2078,2062,2045,2029,2014,1999,1987,1978,1970,1963,1957,1950,1944,1937,1931,1927,1924,1924,1927,1930,1934,1940,1944,1949,1953,1957,1959,1960,1960,1959,1956,1953,1950,1945,1941,1934,1923,1910,1894,1873,1849,1827,1807,1786,1761,1739,1723,1712,1702,1696,1691,1688,1689,1693,1700,1709,1721,1736,1753,1770,1786,1805,1823,1837,1848,1857,1865,1869,1869,1865,1859,1852,1843,1833,1822,1812,1803,1793,1783,1777,1775,1776,1777,1779,1784,1791,1801,1813,1830,1855,1881,1904,1925,1945,1963,1981,1996,2002,2004,2006,2006,2009,2012,2014,2015,2014,2013,2013,2012,2011,2012,2013,2015,2018,2023,2031,2042,2055,2074,2093,2109,2124,2137,2148,2155,2157,2157,2157,2157,2155,2155,2155,2155,2156,2156,2160,2168,2177,2185,2194,2202,2211,2219,2226,2233,2239,2245,2255,2266,2279,2294,2312,2332,2352,2368,2380,2391,2400,2407,2409,2411,2410,2406,2400,2397,2396,2398,2400,2403,2405,2405,2402,2397,2390,2378,2366,2357,2350,2345,2343,2340,2338,2338,2337,2336,2335,2330,2321,2311,2302,2290,2275,2255,2236,2221,2210,2202,2196,2190,2185,2178,2168,2153,2134,2116,2098,2079,2060,2041,2025,2014,2005,1997,1992,1985,1979,1974,1969,1965,1959,1952,1947,1943,1938,1937,1942,1949,1956,1961,1965,1967,1969,1971,1971,1968,1965,1958,1949,1942,1935,1928,1923,1914,1903,1895,1886,1877,1868,1858,1848,1838,1827,1815,1799,1786,1779,1776,1772,1768,1761,1754,1751,1752,1754,1758,1762,1766,1770,1776,1784,1795,1807,1816,1824,1831,1837,1843,1849,1853,1857,1861,1863,1863,1862,1860,1860,1862,1868,1877,1887,1898,1909,1922,1941,1961,1979,1996,2016,2040,2065,2084,2101,2117,2133,2152,2174,2191,2209,2229,2253,2283,2311,2331,2346,2358,2367,2375,2381,2388,2394,2401,2410,2420,2427,2436,2445,2454,2466,2479,2488,2494,2499,2504,2506,2505,2505,2505,2505,2509,2518,2530,2543,2555,2568,2582,2590,2594,2597,2598,2597,2593,2587,2583,2580,2578,2580,2583,2588,2594,2602,2608,2615,2618,2618,2615,2611,2604,2596,2587,2580,2574,2568,2560,2552,2547,2545,2543,2540,2536,2533,2529,2524,2519,2513,2509,2508,2507,2507,2506,2503,2500,2495,2487,2478,2466,2447,2427,2406,2385,2361,2331,2299,2269,2238,2207,2176,2140,2104,2074,2049,2023,1995,1969,1951,1936,1923,1914,1906,1900,1897,1891,1884,1875,1860,1843,1828,1813,1796,1776,1758,1742,1725,1706,1685,1659,1636,1620,1606,1591,1578,1565,1553,1543,1535,1528,1518,1510,1505,1503,1501,1500,1495,1487,1478,1468,1459,1451,1442,1435,1434,1435,1439,1447,1454,1460,1466,1473,1481,1490,1499,1505,1511,1520,1529,1539,1547,1556,1567,1581,1598,1618,1635,1650,1663,1675,1688,1699,1708,1717,1726,1736,1753,1775,1797,1817,1837,1860,1882,1899,1912,1925,1937,1951,1964,1972,1976,1979,1981,1985,1990,1997,2005,2017,2037,2061,2080,2095,2109,2119,2128,2137,2144,2152,2162,2175,2188,2198,2207,2220,2234,2252,2272,2287,2298,2306,2308,2306,2298,2287,2274,2257,2240,2227,2220,2219,2223,2231,2241,2252,2261,2268,2274,2277,2277,2279,2281,2284,2287,2295,2302,2310,2320,2331,2340,2344,2343,2338,2329,2318,2303,2283,2263,2248,2235,2223,2216,2211,2209,2207,2205,2203,2204,2204,2206,2208,2209,2213,2219,2225,2226,2226,2229,2233,2234,2228,2218,2205,2190,2166,2141,2118,2094,2071,2047,2016,1985,1960,1938,1916,1891,1866,1848,1834,1820,1809,1803,1803,1808,1813,1819,1828,1837,1846,1855,1862,1865,1866,1865,1862,1858,1856,1852,1848,1846,1845,1841,1835,1824,1812,1801,1791,1782,1773,1762,1751,1741,1732,1723,1714,1707,1702,1698,1695,1692,1691,1693,1697,1702,1709,1718,1729,1740,1750,1761,1774,1786,1795,1801,1805,1811,1818,1824,1826,1825,1823,1820,1815,1805,1794,1784,1777,1772,1771,1772,1773,1777,1784,1794,1812,1834,1854,1875,1896,1918,1948,1980,2006,2030,2053,2075,2102,2127,2147,2164,2180,2194,2205,2208,2205,2200,2192,2180,2168,2158,2150,2144,2141,2145,2155,2166,2178,2194,2213,2233,2249,2265,2280,2294,2308,2316,2320,2322,2325,2327,2332,2337,2344,2351,2357,2360,2359,2357,2355,2351,2346,2338,2327,2316,2307,2298,2289,2283,2280,2279,2278,2277,2279,2282,2284,2285,2283,2280,2279,2280,2281,2281,2282,2283,2287,2291,2292,2294,2297,2299,2302,2306,2309,2312,2313,2310,2301,2287,2271,2252,2228,2202,2183,2163,2143,2123,2101,2082,2068,2058,2050,2044,2038,2032,2027,2023,2020,2013,2005,1999,1995,1994,1995,1993,1989,1983,1972,1958,1938,1912,1885,1863,1843,1817,1787,1761,1742,1727,1711,1695,1677,1662,1652,1643,1635,1627,1618,1612,1610,1610,1615,1623,1634,1645,1655,1665,1674,1677,1677,1676,1673,1668,1658,1644,1632,1621,1613,1610,1609,1608,1608,1608,1609,1611,1614,1619,1622,1625,1631,1642,1654,1663,1670,1676,1680,1685,1691,1697,1702,1707,1711,1717,1724,1730,1734,1738,1748,1760,1771,1785,1798,1812,1830,1848,1861,1875,1889,1904,1925,1947,1964,1978,1990,2000,2008,2011,2012,2014,2016,2020,2025,2030,2040,2052,2069,2090,2110,2128,2147,2168,2195,2221,2238,2255,2271,2287,2307,2331,2354,2375,2393,2412,2433,2451,2465,2475,2481,2483,2481,2475,2468,2460,2452,2451,2455,2461,2468,2476,2489,2505,2518,2530,2539,2546,2550,2551,2551,2551,2551,2550,2547,2543,2538,2534,2528,2517,2502,2483,2461,2438,2414,2385,2358,2336,2318,2302,2291,2277,2266,2260,2256,2252,2247,2240,2235,2229,2221,2213,2203,2193,2186,2181,2178,2176,2175,2177,2180,2182,2182,2177,2169,2160,2148,2133,2116,2091,2065,2043,2017,1992,1966,1935,1908,1889,1873,1859,1843,1828,1816,1804,1790,1775,1751,1727,1709,1693,1681,1672,1661,1654,1649,1646,1646,1644,1637,1628,1616,1601,1583,1558,1534,1515,1500,1486,1479,1477,1479,1485,1494,1506,1520,1531,1536,1536,1535,1535,1540,1550,1559,1566,1572,1579,1586,1591,1594,1598,1600,1598,1593,1583,1568,1550,1530,1511,1495,1484,1477,1473,1477,1486,1497,1508,1520,1533,1547,1560,1570,1581,1591,1602,1617,1633,1648,1662,1677,1699,1722,1743,1764,1784,1803,1824,1843,1857,1871,1887,1903,1922,1939,1952,1964,1977,1991,2003,2011,2020,2030,2039,2051,2062,2072,2085,2098,2111,2125,2140,2156,2175,2194,2218,2243,2264,2281,2294,2306,2320,2334,2345,2354,2361,2366,2371,2372,2370,2366,2357,2343,2323,2303,2286,2273,2261,2252,2243,2237,2232,2228,2226,2226,2228,2231,2235,2243,2252,2258,2260,2262,2262,2260,2256,2250,2243,2235,2224,2212,2200,2190,2180,2170,2158,2142,2126,2112,2096,2077,2054,2027,2002,1985,1971,1956,1939,1925,1915,1905,1893,1880,1867,1854,1845,1836,1828,1818,1809,1804,1804,1804,1804,1804,1802,1799,1793,1786,1780,1771,1761,1752,1744,1739,1740,1747,1759,1773,1788,1806,1830,1853,1872,1890,1905,1918,1928,1936,1942,1946,1950,1953,1955,1958,1960,1960,1956,1945,1934,1923,1910,1895,1878,1860,1847,1842,1842,1844,1845,1844,1842,1839,1835,1833,1834,1838,1844,1852,1863,1878,1896,1915,1933,1950,1967,1988,2010,2026,2040,2055,2067,2077,2086,2090,2093,2099,2107,2121,2138,2151,2160,2167,2177,2189,2201,2213,2224,2235,2249,2265,2281,2301,2323,2344,2367,2385,2397,2408,2416,2423,2428,2428,2429,2433,2436,2439,2444,2448,2456,2463,2469,2474,2476,2473,2470,2466,2459,2449,2439,2434,2432,2434,2443,2453,2462,2469,2473,2476,2480,2482,2481,2481,2484,2488,2489,2488,2487,2486,2487,2492,2499,2506,2510,2512,2509,2502,2491,2478,2465,2452,2434,2416,2402,2392,2386,2384,2383,2383,2383,2381,2381,2382,2381,2381,2382,2382,2377,2365,2349,2336,2324,2313,2301,2287,2276,2269,2261,2252,2238,2223,2212,2200,2186,2170,2150,2133,2122,2113,2107,2104,2098,2091,2082,2070,2058,2042,2023,2002,1979,1955,1930,1901,1877,1860,1846,1836,1829,1824,1823,1820,1814,1807,1791,1773,1761,1749,1738,1729,1718,1710,1708,1707,1707,1705,1699,1693,1689,1686,1684,1685,1685,1686,1690,1697,1707,1722,1736,1746,1755,1763,1768,1771,1768,1757,1746,1734,1720,1710,1703,1699,1698,1700,1706,1714,1720,1729,1741,1755,1775,1796,1813,1828,1843,1863,1883,1899,1913,1925,1938,1952,1963,1970,1977,1984,1993,2002,2008,2016,2024,2031,2042,2055,2066,2078,2091,2102,2118,2135,2149,2162,2175,2194,2216,2237,2258,2278,2300,2327,2353,2371,2388,2404,2418,2437,2459,2477,2495,2517,2541,2565,2582,2596,2609,2620,2627,2630,2628,2624,2619,2613,2605,2592,2581,2573,2567,2560,2552,2545,2538,2531,2525,2520,2515,2513,2514,2517,2524,2536,2552,2569,2586,2605,2627,2650,2669,2686,2700,2714,2727,2738,2742,2739,2730,2716,2699,2680,2661,2640,2612,2570,2527,2491,2455,2419,2380,2336,2299,2272,2250,2232,2220,2208,2196,2183,2171,2160,2147,2136,2129,2123,2120,2120,2115,2106,2096,2082,2064,2038,2010,1987,1964,1939,1915,1884,1851,1824,1799,1773,1750,1724,1701,1682,1666,1650,1633,1619,1611,1605,1601,1599,1596,1597,1605,1612,1619,1626,1632,1637,1638,1638,1637,1633,1630,1626,1620,1615,1608,1594,1577,1562,1546,1529,1513,1497,1483,1470,1460,1453,1449,1449,1453,1460,1469,1483,1503,1524,1545,1566,1587,1610,1639,1671,1703,1735,1771,1811,1846,1869,1886,1898,1905,1909,1912,1910,1910,1911,1908,1903,1897,1892,1891,1888,1884,1882,1882,1884,1888,1894,1904,1916,1927,1937,1949,1970,1997,2021,2045,2067,2089,2114,2136,2151,2165,2177,2187,2200,2216,2234,2255,2279,2307,2337,2362,2383,2401,2415,2428,2439,2445,2448,2451,2454,2458,2461,2466,2472,2480,2489,2497,2501,2504,2505,2502,2495,2485,2474,2466,2461,2458,2456,2454,2451,2449,2445,2438,2427,2417,2406,2394,2382,2365,2348,2334,2316,2294,2271,2243,2217,2200,2186,2175,2168,2165,2170,2178,2188,2201,2217,2232,2246,2262,2277,2290,2298,2301,2299,2294,2288,2280,2272,2265,2255,2245,2233,2217,2200,2184,2165,2144,2117,2082,2046,2016,1987,1957,1927,1902,1885,1871,1860,1846,1831,1816,1802,1789,1777,1761,1744,1731,1718,1703,1689,1672,1655,1641,1627,1616,1608,1597,1588,1584,1583,1587,1597,1610,1624,1638,1649,1659,1669,1675,1676,1674,1672,1671,1672,1672,1673,1677,1680,1681,1682,1682,1683,1684,1683,1679,1674,1670,1665,1659,1653,1647,1643,1642,1642,1644,1651,1660,1669,1680,1691,1702,1715,1729,1744,1763,1784,1808,1837,1863,1882,1897,1910,1923,1938,1953,1970,1989,2013,2046,2083,2116,2147,2177,2208,2240,2268,2288,2304,2322,2344,2364,2380,2398,2418,2440,2466,2491,2512,2531,2544,2554,2561,2563,2560,2554,2544,2533,2525,2523,2526,2531,2537,2545,2553,2561,2570,2578,2585,2587,2584,2580,2575,2571,2573,2580,2592,2607,2622,2641,2670,2701,2726,2746,2765,2782,2797,2807,2812,2815,2818,2821,2823,2823,2820,2816,2806,2789,2768,2748,2730,2712,2695,2678,2664,2651,2639,2627,2613,2600,2588,2575,2563,2550,2535,2520,2506,2493,2479,2462,2446,2433,2422,2410,2398,2381,2362,2343,2321,2296,2266,2229,2192,2162,2137,2113,2091,2073,2062,2053,2046,2041,2033,2024,2015,2003,1990,1976,1958,1940,1924,1909,1892,1874,1858,1847,1839,1836,1834,1832,1829,1825,1818,1811,1804,1796,1789,1784,1778,1771,1761,1751,1742,1731,1721,1711,1697,1683,1672,1660,1647,1632,1618,1607,1596,1587,1583,1583,1587,1593,1602,1614,1627,1640,1649,1659,1672,1687,1702,1714,1723,1730,1735,1739,1747,1756,1763,1770,1776,1780,1784,1787,1789,1788,1784,1777,1774,1775,1780,1788,1803,1827,1855,1881,1906,1927,1947,1969,1990,2007,2024,2043,2069,2096,2119,2143,2172,2204,2243,2282,2317,2350,2379,2404,2424,2435,2439,2441,2440,2435,2429,2423,2418,2413,2408,2407,2407,2408,2409,2410,2414,2423,2435,2451,2469,2491,2520,2551,2579,2609,2640,2674,2712,2749,2780,2806,2829,2849,2862,2867,2868,2866,2859,2845,2828,2812,2796,2781,2761,2736,2710,2688,2671,2656,2644,2638,2636,2633,2629,2625,2622,2622,2620,2616,2609,2604,2599,2593,2586,2580,2574,2564,2550,2534,2514,2494,2472,2447,2423,2404,2385,2366,2343,2311,2280,2257,2235,2210,2180,2147,2120,2094,2066,2039,2010,1983,1962,1946,1934,1930,1933,1939,1946,1953,1961,1971,1980,1987,1991,1994,1997,1998,1995,1989,1982,1973,1959,1942,1923,1904,1886,1866,1839,1813,1792,1771,1750,1727,1699,1674,1656,1642,1631,1626,1624,1624,1623,1623,1625,1629,1632,1631,1629,1626,1621,1616,1609,1602,1595,1586,1574,1560,1546,1532,1517,1504,1492,1482,1475,1469,1464,1461,1460,1465,1479,1497,1522,1558,1595,1629,1665,1703,1744,1797,1850,1894,1933,1969,2002,2035,2061,2077,2091,2104,2114,2121,2125,2132,2141,2150,2159,2166,2173,2181,2185,2187,2190,2198,2208,2219,2234,2251,2267,2280,2295,2310,2325,2341,2354,2363,2370,2377,2382,2387,2390,2389,2385,2380,2379,2381,2385,2391,2400,2411,2426,2443,2459,2474,2491,2510,2533,2556,2576,2591,2604,2614,2621,2623,2622,2620,2616,2611,2606,2604,2607,2615,2623,2630,2634,2637,2640,2645,2648,2652,2654,2651,2647,2640,2630,2622,2614,2605,2593,2571,2544,2517,2484,2450,2416,2379,2344,2315,2287,2262,2238,2214,2194,2181,2171,2161,2150,2139,2131,2122,2113,2106,2096,2089,2085,2082,2082,2081,2081,2082,2079,2073,2066,2053,2034,2016,1995,1971,1949,1922,1898,1882,1868,1855,1844,1834,1823,1813,1805,1797,1789,1783,1779,1776,1774,1775,1778,1784,1794,1801,1808,1814,1817,1818,1816,1810,1800,1786,1771,1758,1746,1732,1719,1708,1700,1692,1685,1679,1675,1672,1667,1662,1659,1654,1647,1636,1626,1620,1615,1611,1612,1616,1624,1633,1643,1651,1657,1660,1662,1664,1667,1675,1688,1700,1715,1733,1753,1778,1800,1815,1829,1842,1857,1871,1879,1886,1894,1899,1902,1905,1907,1910,1915,1923,1940,1964,1991,2018,2045,2071,2092,2108,2123,2139,2152,2169,2188,2205,2224,2241,2255,2273,2290,2301,2310,2319,2331,2340,2344,2347,2351,2355,2362,2373,2381,2391,2404,2418,2437,2455,2465,2469,2466,2456,2444,2436,2431,2427,2426,2428,2435,2444,2451,2456,2462,2471,2477,2480,2483,2488,2497,2509,2526,2548,2575,2606,2641,2677,2705,2729,2752,2764,2763,2749,2725,2700,2670,2631,2597,2570,2548,2529,2507,2483,2462,2440,2419,2392,2351,2304,2262,2221,2182,2145,2110,2083,2068,2055,2043,2032,2020,2011,2004,1995,1984,1968,1947,1927,1907,1889,1876,1867,1864,1867,1871,1876,1882,1887,1889,1887,1880,1867,1843,1816,1793,1774,1757,1744,1731,1719,1711,1705,1698,1695,1696,1699,1702,1703,1703,1701,1700,1703,1706,1710,1719,1734,1754,1773,1791,1808,1822,1832,1833,1826,1817,1802,1779,1755,1734,1714,1696,1680,1666,1654,1647,1645,1646,1648,1651,1652,1652,1653,1658,1667,1680,1697,1718,1742,1770,1804,1839,1869,1894,1915,1929,1937,1938,1935,1932,1927,1919,1909,1901,1898,1897,1897,1900,1907,1915,1925,1934,1945,1956,1966,1976,1988,2000,2018,2040,2061,2086,2112,2140,2176,2214,2243,2266,2287,2307,2323,2331,2336,2342,2347,2352,2359,2362,2365,2367,2370,2376,2382,2381,2378,2374,2367,2359,2347,2331,2316,2300,2281,2263,2252,2242,2235,2233,2238,2248,2260,2272,2284,2300,2316,2328,2341,2357,2373,2390,2404,2411,2412,2411,2405,2393,2381,2371,2361,2352,2341,2328,2315,2299,2281,2263,2242,2225,2214,2205,2196,2191,2191,2197,2205,2213,2220,2225,2227,2224,2217,2205,2186,2152,2114,2081,2051,2021,1988,1952,1921,1891,1859,1824,1777,1726,1684,1648,1615,1589,1566,1549,1543,1540,1539,1543,1550,1558,1566,1569,1571,1573,1574,1571,1563,1553,1543,1533,1529,1530,1534,1539,1545,1550,1551,1549,1544,1535,1521,1506,1496,1493,1496,1506,1521,1536,1549,1561,1572,1581,1588,1592,1596,1600,1606,1614,1619,1618,1615,1613,1613,1617,1624,1633,1647,1661,1675,1685,1689,1687,1683,1674,1663,1655,1656,1663,1674,1689,1710,1734,1758,1779,1803,1831,1860,1887,1913,1937,1962,1990,2017,2039,2061,2085,2115,2146,2171,2195,2218,2237,2253,2259,2254,2247,2237,2222,2206,2193,2182,2175,2165,2153,2141,2133,2127,2123,2124,2134,2147,2162,2180,2199,2221,2248,2277,2305,2331,2361,2397,2434,2463,2486,2505,2517,2524,2528,2528,2526,2525,2523,2521,2519,2515,2508,2495,2475,2450,2429,2411,2395,2382,2369,2357,2348,2339,2327,2316,2306,2299,2296,2295,2300,2314,2329,2341,2349,2356,2360,2358,2352,2344,2338,2332,2326,2319,2313,2306,2296,2282,2259,2235,2215,2194,2173,2151,2128,2108,2094,2080,2068,2058,2047,2041,2039,2037,2038,2040,2041,2044,2048,2053,2057,2057,2052,2046,2039,2028,2010,1986,1961,1936,1909,1880,1846,1812,1784,1757,1731,1707,1686,1668,1656,1649,1646,1646,1649,1655,1662,1670,1680,1693,1707,1721,1736,1753,1770,1785,1795,1797,1793,1783,1764,1743,1725,1711,1702,1697,1698,1700,1702,1703,1705,1707,1710,1710,1708,1705,1705,1711,1722,1734,1747,1761,1776,1791,1803,1811,1819,1825,1830,1837,1844,1848,1851,1854,1861,1873,1885,1901,1919,1935,1956,1980,2001,2018,2031,2039,2043,2041,2035,2028,2020,2014,2013,2015,2018,2022,2028,2038,2047,2051,2056,2060,2065,2070,2075,2083,2095,2113,2143,2177,2207,2238,2268,2294,2321,2343,2354,2360,2362,2357,2346,2332,2318,2304,2290,2274,2262,2256,2258,2264,2273,2289,2308,2324,2338,2351,2362,2372,2381,2393,2409,2427,2445,2464,2478,2487,2494,2495,2484,2463,2435,2404,2367,2320,2272,2233,2198,2165,2134,2102,2074,2056,2045,2039,2043,2052,2065,2077,2088,2098,2105,2108,2111,2115,2120,2127,2133,2137,2138,2134,2128,2119,2101,2079,2055,2029,2001,1968,1936,1912,1891,1873,1857,1840,1825,1816,1809,1807,1807,1805,1800,1797,1794,1791,1785,1777,1774,1772,1770,1771,1773,1774,1774,1772,1772,1772,1773,1772,1770,1769,1768,1765,1761,1753,1743,1733,1720,1703,1683,1661,1638,1612,1578,1546,1524,1508,1495,1486,1480,1478,1482,1490,1498,1507,1519,1531,1541,1551,1568,1596,1630,1662,1694,1729,1764,1802,1836,1860,1878,1892,1900,1905,1906,1904,1901,1896,1890,1885,1882,1882,1881,1877,1872,1867,1862,1858,1854,1851,1851,1852,1854,1861,1875,1898,1925,1949,1974,1997,2019,2044,2067,2083,2097,2107,2115,2125,2133,2138,2144,2149,2154,2161,2165,2167,2170,2172,2173,2174,2174,2174,2174,2174,2174,2176,2182,2190,2197,2206,2215,2227,2241,2255,2268,2285,2302,2316,2327,2338,2350,2361,2369,2374,2378,2383,2389,2396,2400,2400,2400,2398,2394,2388,2380,2370,2356,2337,2316,2300,2281,2259,2233,2201,2170,2145,2124,2107,2096,2090,2087,2085,2079,2070,2056,2040,2026,2015,2007,2003,2000,1999,2001,2002,2002,2001,1995,1986,1975,1962,1949,1932,1911,1891,1866,1835,1801,1760,1720,1689,1665,1646,1633,1622,1611,1599,1586,1571,1549,1526,1509,1494,1481,1471,1460,1452,1448,1446,1445,1443,1441,1441,1443,1446,1448,1446,1439,1425,1407,1387,1366,1344,1328,1319,1317,1319,1323,1328,1331,1333,1333,1332,1329,1325,1321,1317,1312,1308,1307,1308,1313,1324,1338,1361,1391,1421,1452,1482,1506,1522,1528,1527,1523,1519,1519,1526,1539,1556,1575,1595,1621,1647,1664,1680,1693,1704,1718,1732,1740,1747,1754,1761,1769,1776,1785,1798,1816,1846,1885,1919,1949,1972,1986,1994,1993,1984,1976,1969,1965,1968,1976,1986,1999,2012,2030,2051,2069,2089,2111,2137,2168,2197,2218,2233,2245,2251,2252,2248,2244,2242,2243,2250,2259,2271,2280,2283,2282,2282,2281,2280,2278,2275,2275,2280,2286,2295,2306,2319,2337,2357,2378,2402,2427,2454,2483,2504,2513,2516,2515,2513,2514,2517,2521,2526,2528,2524,2519,2516,2509,2501,2488,2469,2447,2423,2398,2371,2335,2294,2257,2223,2192,2166,2141,2119,2109,2102,2096,2087,2067,2038,2008,1981,1955,1928,1906,1897,1893,1891,1890,1884,1878,1874,1870,1865,1857,1843,1825,1807,1788,1763,1732,1699,1674,1655,1638,1628,1627,1631,1637,1643,1646,1645,1640,1633,1626,1621,1619,1618,1619,1623,1629,1636,1643,1648,1651,1654,1658,1660,1658,1649,1635,1617,1598,1574,1544,1517,1501,1494,1495,1503,1521,1543,1563,1583,1607,1638,1670,1698,1723,1746,1767,1787,1803,1813,1823,1831,1840,1850,1859,1867,1877,1885,1887,1885,1876,1865,1854,1842,1833,1831,1836,1850,1870,1897,1933,1970,2002,2031,2063,2105,2150,2189,2224,2256,2285,2316,2344,2363,2376,2383,2387,2390,2391,2391,2392,2390,2385,2378,2371,2365,2359,2356,2357,2360,2364,2371,2377,2384,2391,2395,2398,2403,2412,2431,2453,2474,2496,2515,2535,2557,2577,2590,2599,2602,2602,2601,2598,2596,2593,2589,2586,2588,2591,2591,2587,2578,2563,2546,2533,2518,2501,2483,2462,2446,2439,2437,2440,2448,2458,2468,2478,2487,2497,2508,2516,2518,2516,2513,2508,2502,2495,2487,2480,2477,2475,2475,2475,2473,2468,2456,2435,2410,2383,2354,2317,2264,2208,2162,2122,2086,2056,2029,2008,1995,1983,1971,1960,1944,1929,1918,1911,1903,1892,1878,1867,1856,1847,1843,1843,1846,1851,1852,1848,1838,1820,1797,1769,1739,1708,1675,1646,1627,1615,1608,1610,1621,1634,1645,1654,1661,1669,1675,1678,1678,1677,1674,1669,1664,1660,1659,1662,1671,1686,1701,1713,1723,1730,1730,1720,1703,1682,1661,1638,1615,1599,1595,1603,1617,1635,1662,1690,1715,1739,1762,1781,1799,1812,1819,1822,1823,1828,1835,1846,1863,1886,1913,1949,1988,2020,2048,2074,2098,2115,2121,2119,2115,2109,2108,2111,2115,2124,2136,2149,2163,2175,2184,2194,2203,2215,2228,2237,2242,2248,2252,2257,2263,2272,2287,2307,2329,2355,2381,2400,2415,2427,2432,2431,2424,2411,2396,2381,2369,2363,2361,2360,2359,2360,2358,2358,2362,2368,2376,2385,2388,2387,2382,2375,2368,2364,2366,2376,2393,2414,2438,2464,2489,2508,2522,2530,2527,2514,2497,2476,2457,2442,2427,2415,2408,2400,2391,2381,2367,2352,2335,2315,2292,2262,2228,2201,2175,2150,2131,2113,2102,2098,2096,2094,2096,2098,2100,2102,2101,2098,2090,2077,2061,2047,2036,2026,2015,2002,1990,1979,1967,1949,1926,1904,1880,1858,1838,1817,1799,1790,1783,1780,1779,1777,1775,1775,1775,1774,1773,1773,1776,1776,1773,1770,1762,1749,1734,1718,1702,1687,1670,1653,1638,1625,1611,1592,1567,1542,1516,1491,1465,1439,1415,1396,1382,1373,1367,1364,1364,1368,1374,1379,1381,1382,1383,1385,1387,1386,1381,1377,1380,1388,1397,1410,1423,1436,1446,1454,1461,1470,1479,1484,1489,1495,1503,1515,1526,1535,1543,1551,1557,1565,1575,1586,1596,1605,1616,1629,1642,1657,1671,1685,1702,1723,1747,1773,1799,1828,1856,1876,1888,1897,1904,1912,1919,1924,1929,1935,1943,1955,1964,1971,1977,1983,1990,2000,2009,2023,2039,2059,2086,2116,2142,2167,2191,2214,2243,2274,2304,2334,2366,2403,2438,2462,2483,2501,2515,2528,2537,2540,2539,2537,2533,2523,2507,2490,2475,2458,2442,2431,2424,2422,2422,2426,2431,2435,2438,2440,2442,2446,2452,2459,2465,2467,2466,2463,2459,2456,2451,2447,2444,2439,2432,2421,2405,2388,2369,2343,2315,2294,2279,2266,2255,2246,2241,2237,2231,2224,2212,2197,2182,2169,2157,2145,2131,2117,2100,2080,2060,2036,2013,1993,1970,1948,1926,1895,1861,1828,1796,1759,1711,1663,1629,1603,1582,1570,1564,1564,1571,1575,1575,1573,1567,1564,1563,1561,1563,1571,1582,1594,1605,1614,1623,1630,1635,1637,1633,1624,1610,1587,1561,1535,1510,1482,1448,1417,1395,1377,1365,1358,1352,1349,1347,1342,1334,1324,1313,1305,1303,1305,1311,1321,1331,1340,1353,1370,1392,1424,1458,1483,1506,1528,1552,1582,1615,1646,1678,1714,1759,1806,1844,1883,1924,1966,2017,2065,2099,2128,2158,2185,2217,2249,2277,2303,2328,2351,2370,2384,2397,2413,2430,2456,2483,2503,2519,2533,2542,2548,2553,2562,2573,2588,2607,2628,2646,2663,2679,2688,2692,2690,2686,2684,2682,2680,2679,2676,2673,2669,2663,2657,2652,2648,2649,2653,2661,2678,2696,2708,2718,2724,2728,2730,2733,2740,2751,2769,2790,2808,2820,2827,2828,2823,2809,2791,2775,2760,2743,2721,2701,2685,2669,2652,2634,2608,2579,2557,2535,2514,2493,2465,2436,2412,2386,2357,2319,2279,2251,2231,2214,2203,2190,2174,2162,2147,2130,2112,2091,2074,2065,2058,2054,2046,2036,2027,2017,2006,1997,1987,1978,1972,1967,1963,1956,1944,1928,1912,1895,1878,1860,1845,1833,1825,1821,1815,1804,1791,1774,1756,1735,1707,1682,1664,1648,1633,1620,1605,1594,1589,1587,1586,1591,1604,1621,1635,1644,1646,1636,1621,1609,1600,1594,1594,1608,1633,1662,1694,1727,1761,1795,1824,1842,1853,1860,1860,1856,1848,1838,1829,1824,1827,1837,1852,1871,1893,1922,1965,2008,2041,2067,2086,2099,2107,2111,2116,2125,2137,2158,2182,2204,2227,2253,2278,2306,2332,2348,2359,2367,2368,2361,2348,2333,2319,2305,2293,2285,2282,2282,2282,2281,2280,2275,2268,2261,2248,2230,2214,2208,2209,2214,2227,2250,2279,2306,2331,2356,2387,2419,2443,2462,2479,2491,2500,2505,2503,2501,2498,2494,2493,2495,2494,2491,2483,2468,2447,2425,2401,2378,2357,2337,2320,2312,2310,2314,2323,2337,2351,2362,2372,2386,2401,2411,2418,2424,2433,2441,2449,2453,2453,2449,2442,2432,2417,2400,2385,2370,2351,2321,2288,2260,2234,2209,2188,2165,2144,2130,2117,2105,2092,2078,2063,2049,2033,2012,1988,1962,1939,1918,1901,1888,1880,1877,1875,1871,1866,1863,1865,1869,1871,1871,1868,1858,1847,1839,1832,1825,1820,1814,1809,1808,1806,1803,1800,1793,1784,1772,1756,1736,1710,1682,1660,1642,1625,1611,1598,1584,1572,1560,1548,1536,1525,1519,1516,1512,1511,1511,1513,1518,1523,1529,1539,1553,1570,1587,1602,1615,1629,1640,1647,1654,1659,1666,1679,1691,1702,1716,1731,1746,1765,1782,1792,1798,1804,1809,1813,1818,1822,1824,1824,1825,1826,1828,1831,1837,1850,1872,1895,1913,1930,1946,1960,1974,1986,1997,2009,2021,2035,2044,2047,2048,2049,2047,2044,2038,2029,2021,2010,1994,1979,1963,1948,1933,1914,1895,1879,1871,1870,1875,1885,1903,1927,1952,1979,2010,2045,2077,2105,2133,2160,2187,2216,2238,2252,2265,2274,2281,2292,2302,2312,2323,2334,2348,2361,2371,2380,2388,2391,2393,2393,2390,2388,2388,2389,2392,2399,2409,2422,2436,2452,2466,2473,2480,2486,2490,2490,2484,2476,2470,2463,2451,2439,2431,2421,2413,2406,2395,2381,2367,2352,2334,2315,2293,2274,2262,2253,2243,2228,2213,2207,2203,2200,2201,2199,2193,2188,2180,2169,2154,2132,2109,2093,2079,2066,2053,2044,2040,2035,2030,2026,2017,2006,1996,1981,1963,1943,1918,1894,1873,1852,1828,1803,1780,1764,1751,1738,1727,1709,1687,1667,1647,1625,1603,1583,1571,1568,1568,1571,1580,1591,1604,1617,1628,1638,1645,1647,1642,1634,1620,1599,1577,1560,1544,1530,1521,1516,1516,1517,1518,1519,1521,1523,1523,1523,1523,1522,1523,1529,1534,1543,1554,1566,1582,1599,1612,1623,1633,1641,1647,1649,1645,1639,1632,1626,1625,1625,1628,1634,1643,1661,1684,1703,1722,1740,1758,1783,1805,1820,1837,1855,1878,1902,1923,1945,1969,1996,2033,2071,2104,2138,2172,2203,2233,2258,2278,2297,2316,2335,2352,2366,2381,2395,2410,2424,2433,2438,2443,2445,2444,2445,2448,2452,2455,2460,2475,2493,2511,2534,2558,2586,2618,2647,2668,2684,2699,2716,2733,2750,2767,2783,2798,2817,2835,2849,2862,2872,2877,2874,2864,2850,2835,2809,2773,2734,2700,2669,2641,2619,2601,2589,2586,2587,2589,2591,2587,2580,2569,2556,2543,2528,2513,2502,2492,2481,2473,2463,2451,2441,2430,2417,2401,2377,2349,2322,2293,2256,2201,2140,2087,2039,1992,1948,1899,1859,1833,1809,1785,1762,1737,1715,1698,1681,1669,1662,1660,1665,1673,1684,1699,1716,1733,1744,1753,1759,1761,1760,1759,1755,1748,1739,1724,1710,1702,1697,1694,1692,1689,1684,1677,1667,1654,1637,1619,1602,1587,1575,1567,1562,1564,1571,1579,1590,1606,1630,1656,1676,1695,1714,1734,1756,1773,1786,1799,1813,1830,1847,1863,1882,1905,1927,1953,1973,1982,1988,1991,1988,1985,1981,1978,1977,1974,1976,1983,1990,1998,2006,2016,2032,2049,2063,2075,2088,2103,2118,2127,2137,2149,2164,2185,2207,2224,2241,2259,2275,2289,2297,2298,2297,2293,2285,2277,2274,2275,2279,2286,2300,2317,2332,2347,2363,2379,2400,2420,2434,2447,2460,2473,2485,2492,2499,2507,2516,2522,2525,2522,2514,2504,2488,2458,2422,2389,2358,2324,2283,2242,2210,2187,2165,2146,2130,2116,2109,2105,2100,2099,2101,2106,2113,2117,2121,2129,2136,2144,2150,2154,2155,2151,2142,2130,2115,2096,2065,2027,1993,1964,1936,1910,1883,1859,1844,1834,1826,1821,1814,1809,1808,1807,1806,1806,1809,1817,1830,1844,1863,1886,1909,1929,1946,1961,1975,1985,1992,1994,1992,1987,1971,1946,1922,1897,1873,1849,1823,1799,1783,1772,1761,1753,1745,1736,1729,1722,1714,1708,1709,1716,1727,1738,1750,1768,1788,1802,1816,1830,1840,1853,1865,1870,1871,1871,1865,1854,1837,1815,1789,1760,1724,1688,1658,1631,1608,1591,1578,1565,1552,1542,1534,1531,1534,1541,1551,1564,1583,1609,1635,1658,1683,1710,1741,1776,1809,1837,1862,1888,1916,1942,1963,1980,1995,2007,2019,2028,2033,2038,2043,2050,2059,2066,2074,2080,2086,2092,2098,2101,2103,2103,2103,2105,2110,2117,2127,2142,2163,2185,2203,2223,2243,2263,2283,2302,2315,2326,2337,2346,2351,2355,2355,2356,2358,2358,2357,2354,2347,2338,2327,2307,2280,2255,2229,2202,2172,2138,2105,2081,2062,2050,2052,2062,2080,2102,2126,2157,2195,2233,2263,2286,2306,2323,2338,2349,2356,2358,2358,2354,2347,2338,2325,2309,2285,2250,2211,2176,2143,2108,2068,2019,1972,1938,1912,1896,1891,1895,1907,1923,1938,1955,1974,1990,2002,2012,2021,2035,2049,2059,2070,2084,2098,2116,2132,2139,2140,2137,2126,2107,2084,2061,2040,2016,1984,1950,1918,1889,1862,1838,1815,1797,1787,1781,1774,1766,1754,1743,1737,1731,1726,1724,1725,1728,1732,1738,1747,1759,1773,1784,1792,1796,1797,1793,1785,1772,1758,1742,1723,1706,1694,1684,1676,1670,1665,1661,1659,1653,1646,1636,1624,1611,1601,1593,1586,1585,1586,1589,1594,1598,1605,1617,1632,1646,1659,1672,1687,1704,1718,1728,1737,1748,1766,1787,1806,1825,1844,1863,1880,1893,1898,1899,1897,1892,1887,1883,1882,1886,1895,1912,1933,1953,1972,1991,2011,2034,2056,2070,2078,2084,2090,2097,2102,2110,2118,2128,2144,2161,2174,2186,2198,2206,2207,2201,2195,2192,2189,2189,2190,2191,2196,2205,2218,2237,2255,2270,2285,2302,2321,2344,2364,2378,2388,2397,2408,2422,2435,2445,2452,2455,2455,2451,2445,2436,2426,2416,2403,2389,2375,2364,2357,2353,2353,2353,2354,2354,2355,2356,2358,2363,2369,2376,2386,2396,2406,2417,2427,2439,2456,2476,2493,2505,2515,2520,2517,2505,2488,2466,2443,2415,2380,2343,2313,2290,2268,2250,2241,2237,2237,2240,2241,2240,2240,2238,2233,2222,2206,2185,2162,2140,2117,2094,2072,2055,2041,2025,2008,1985,1954,1919,1888,1859,1827,1789,1753,1723,1697,1676,1661,1650,1646,1650,1657,1666,1680,1696,1709,1715,1712,1705,1694,1683,1670,1654,1635,1616,1597,1581,1567,1554,1540,1521,1496,1473,1458,1447,1434,1423,1418,1417,1421,1428,1439,1454,1472,1488,1507,1529,1551,1574,1593,1604,1613,1625,1638,1652,1664,1678,1695,1716,1744,1775,1801,1825,1849,1872,1893,1911,1923,1932,1939,1948,1956,1961,1966,1973,1979,1993,2009,2025,2043,2063,2084,2108,2129,2144,2160,2176,2196,2216,2233,2247,2263,2278,2296,2309,2313,2314,2310,2297,2282,2270,2259,2246,2230,2214,2201,2196,2196,2194,2195,2201,2213,2227,2243,2263,2291,2318,2336,2352,2364,2375,2389,2405,2418,2433,2450,2467,2484,2493,2490,2481,2466,2442,2416,2392,2366,2336,2304,2269,2239,2221,2207,2194,2188,2187,2190,2198,2209,2225,2247,2271,2291,2308,2323,2336,2350,2364,2375,2387,2400,2411,2421,2425,2420,2409,2393,2364,2327,2287,2241,2194,2139,2068,1998,1941,1885,1828,1770,1704,1642,1595,1555,1517,1482,1454,1440,1435,1435,1443,1459,1479,1499,1518,1537,1556,1574,1587,1589,1587,1584,1577,1566,1551,1532,1513,1491,1465,1439,1417,1397,1375,1349,1318,1290,1265,1243,1223,1203,1186,1179,1178,1180,1191,1206,1224,1243,1263,1289,1323,1357,1385,1413,1442,1470,1500,1528,1546,1559,1572,1581,1587,1591,1592,1594,1598,1599,1599,1598,1597,1596,1594,1591,1589,1591,1597,1605,1616,1631,1647,1664,1681,1699,1721,1744,1764,1784,1802,1823,1856,1893,1929,1966,2003,2042,2082,2119,2147,2169,2186,2199,2206,2209,2214,2218,2222,2232,2243,2251,2261,2270,2275,2279,2281,2279,2276,2271,2263,2253,2245,2236,2224,2212,2201,2196,2196,2198,2204,2214,2227,2239,2253,2266,2281,2301,2319,2334,2348,2364,2380,2397,2414,2428,2441,2456,2472,2486,2493,2495,2494,2488,2475,2460,2445,2427,2409,2391,2368,2349,2338,2330,2324,2323,2325,2330,2339,2348,2357,2367,2380,2392,2403,2413,2418,2418,2415,2412,2410,2409,2405,2397,2387,2370,2349,2322,2280,2234,2194,2153,2110,2068,2020,1974,1939,1906,1876,1850,1830,1818,1810,1802,1796,1792,1790,1793,1795,1798,1804,1808,1812,1818,1827,1840,1858,1873,1882,1886,1886,1880,1868,1854,1842,1828,1813,1793,1766,1736,1710,1683,1658,1637,1624,1617,1616,1618,1623,1633,1644,1656,1666,1677,1692,1711,1728,1746,1768,1794,1827,1857,1878,1892,1902,1905,1903,1899,1893,1886,1877,1866,1855,1846,1838,1830,1823,1818,1815,1814,1813,1810,1803,1789,1774,1762,1754,1748,1749,1754,1762,1773,1786,1805,1833,1861,1886,1906,1920,1929,1936,1939,1938,1937,1936,1938,1946,1959,1977,1998,2023,2057,2093,2120,2142,2158,2166,2166,2161,2154,2149,2144,2141,2140,2138,2139,2144,2157,2182,2212,2240,2270,2295,2315,2331,2343,2347,2349,2353,2363,2378,2394,2410,2428,2445,2462,2476,2483,2485,2483,2473,2458,2445,2435,2428,2425,2426,2430,2431,2433,2437,2445,2458,2471,2482,2491,2499,2505,2507,2507,2507,2506,2504,2507,2516,2523,2528,2530,2527,2518,2505,2488,2471,2452,2428,2400,2376,2354,2336,2323,2309,2296,2285,2272,2262,2254,2245,2239,2233,2228,2223,2213,2199,2185,2169,2150,2131,2110,2093,2084,2076,2069,2065,2060,2055,2056,2059,2062,2064,2064,2064,2064,2065,2071,2082,2095,2106,2117,2124,2126,2122,2114,2102,2086,2069,2049,2031,2015,1999,1982,1965,1946,1932,1924,1918,1913,1910,1908,1910,1916,1925,1936,1951,1965,1975,1983,1992,1999,2005,2011,2015,2018,2020,2014,2006,1998,1990,1982,1972,1959,1944,1932,1917,1899,1882,1868,1856,1850,1845,1841,1846,1856,1867,1883,1901,1921,1949,1976,1994,2009,2020,2028,2035,2040,2040,2039,2035,2024,2012,2001,1992,1984,1977,1971,1963,1956,1948,1936,1924,1917,1915,1918,1924,1932,1945,1959,1969,1982,1998,2017,2044,2075,2103,2131,2158,2183,2209,2232,2247,2259,2271,2282,2295,2306,2315,2324,2331,2336,2339,2338,2330,2318,2301,2283,2271,2265,2262,2258,2251,2242,2231,2221,2211,2203,2199,2199,2202,2208,2216,2225,2240,2251,2253,2251,2247,2236,2220,2203,2187,2173,2161,2150,2139,2128,2115,2099,2075,2049,2030,2016,2005,1996,1984,1973,1968,1964,1963,1967,1976,1990,2013,2037,2065,2100,2138,2171,2197,2221,2240,2253,2257,2256,2251,2244,2232,2218,2203,2187,2172,2155,2129,2099,2068,2032,1993,1951,1898,1845,1800,1759,1720,1683,1645,1610,1585,1563,1539,1517,1500,1490,1484,1479,1477,1475,1471,1467,1463,1459,1458,1462,1473,1490,1512,1543,1581,1617,1643,1661,1673,1678,1669,1654,1641,1627,1613,1600,1591,1588,1592,1598,1606,1615,1624,1633,1644,1651,1655,1660,1664,1665,1665,1665,1664,1665,1669,1679,1691,1706,1726,1747,1762,1774,1783,1789,1793,1797,1795,1790,1783,1774,1767,1765,1764,1764,1767,1773,1779,1783,1789,1794,1797,1799,1804,1813,1823,1835,1852,1871,1887,1902,1919,1937,1957,1975,1990,2006,2023,2043,2074,2110,2143,2172,2199,2226,2249,2266,2279,2289,2295,2297,2295,2286,2271,2251,2226,2198,2173,2160,2155,2155,2162,2173,2183,2195,2205,2213,2223,2231,2233,2234,2234,2235,2240,2246,2250,2254,2256,2255,2251,2244,2238,2232,2223,2206,2186,2168,2146,2123,2098,2068,2042,2027,2017,2009,2006,2007,2014,2026,2038,2053,2070,2084,2099,2112,2124,2138,2155,2175,2196,2215,2232,2248,2260,2262,2258,2251,2237,2216,2194,2174,2155,2135,2114,2097,2086,2077,2069,2059,2038,2013,1990,1966,1944,1920,1890,1861,1840,1824,1811,1799,1795,1799,1806,1816,1830,1842,1851,1856,1852,1846,1837,1827,1819,1813,1807,1802,1795,1787,1781,1773,1765,1753,1731,1706,1683,1663,1646,1633,1620,1612,1610,1609,1612,1619,1628,1638,1652,1668,1686,1708,1727,1737,1742,1745,1748,1757,1771,1786,1803,1824,1853,1885,1911,1935,1957,1973,1983,1987,1983,1976,1970,1964,1962,1966,1973,1983,1994,2004,2011,2012,2013,2012,2009,2006,2007,2011,2017,2023,2035,2052,2070,2089,2106,2121,2138,2154,2164,2173,2181,2184,2185,2182,2180,2179,2178,2176,2179,2187,2199,2215,2233,2254,2271,2279,2282,2281,2275,2269,2262,2259,2259,2265,2278,2296,2313,2331,2348,2362,2373,2381,2382,2381,2378,2372,2362,2349,2336,2322,2306,2283,2259,2243,2232,2227,2227,2228,2229,2227,2216,2203,2184,2152,2117,2091,2070,2053,2044,2043,2053,2073,2099,2134,2176,2214,2243,2265,2285,2302,2316,2328,2336,2341,2344,2343,2338,2333,2324,2314,2304,2291,2277,2264,2248,2229,2203,2176,2152,2129,2106,2082,2054,2026,2006,1991,1979,1968,1958,1949,1941,1932,1918,1901,1884,1873,1866,1863,1863,1864,1867,1869,1871,1876,1881,1886,1890,1890,1885,1875,1861,1844,1827,1809,1793,1777,1762,1751,1746,1748,1755,1769,1788,1810,1828,1841,1851,1858,1860,1861,1864,1872,1885,1910,1939,1966,1993,2020,2047,2077,2101,2116,2124,2126,2124,2121,2116,2113,2113,2113,2115,2118,2121,2125,2130,2136,2144,2153,2163,2176,2187,2196,2202,2204,2207,2211,2217,2228,2241,2256,2276,2297,2318,2343,2364,2379,2389,2392,2391,2388,2385,2387,2393,2401,2416,2434,2448,2456,2459,2457,2453,2447,2440,2431,2418,2401,2382,2365,2347,2327,2307,2286,2266,2251,2240,2231,2228,2232,2238,2243,2250,2259,2264,2264,2260,2254,2251,2250,2249,2246,2244,2242,2239,2236,2231,2225,2223,2225,2228,2235,2242,2250,2259,2269,2277,2282,2282,2277,2269,2256,2238,2222,2212,2205,2198,2189,2176,2159,2143,2127,2112,2098,2082,2069,2062,2056,2050,2044,2037,2034,2036,2042,2053,2069,2086,2100,2115,2132,2146,2159,2169,2167,2159,2146,2127,2108,2094,2081,2072,2064,2052,2037,2019,2001,1981,1957,1933,1912,1892,1871,1851,1830,1813,1806,1804,1806,1814,1828,1847,1867,1884,1900,1917,1931,1937,1935,1927,1911,1886,1858,1831,1806,1786,1769,1752,1734,1717,1701,1686,1671,1655,1639,1627,1620,1616,1616,1620,1628,1641,1656,1675,1699,1722,1746,1772,1803,1844,1889,1930,1967,1999,2029,2055,2070,2072,2069,2061,2050,2039,2028,2017,2008,1998,1986,1974,1960,1947,1934,1918,1900,1884,1871,1863,1856,1852,1850,1846,1846,1848,1850,1860,1876,1897,1930,1967,2010,2066,2125,2171,2215,2257,2296,2341,2383,2413,2435,2459,2487,2518,2543,2564,2581,2590,2589,2580,2566,2547,2521,2484,2445,2410,2375,2340,2303,2264,2230,2206,2187,2174,2169,2170,2180,2195,2211,2230,2252,2272,2286,2291,2287,2275,2256,2235,2218,2203,2189,2175,2161,2148,2141,2137,2135,2135,2139,2147,2155,2164,2174,2185,2196,2205,2214,2224,2238,2253,2270,2285,2299,2314,2331,2344,2351,2352,2352,2344,2326,2306,2291,2280,2273,2266,2256,2247,2237,2225,2212,2194,2174,2158,2145,2134,2122,2106,2090,2077,2063,2051,2038,2018,1998,1984,1972,1961,1951,1946,1945,1946,1948,1950,1949,1946,1941,1932,1921,1906,1890,1873,1857,1841,1821,1794,1766,1739,1710,1681,1651,1621,1595,1581,1577,1584,1606,1633,1658,1684,1713,1749,1795,1838,1871,1899,1928,1957,1990,2020,2041,2057,2074,2087,2097,2103,2106,2104,2094,2072,2043,2012,1981,1946,1905,1854,1805,1769,1743,1719,1702,1695,1696,1707,1722,1745,1782,1820,1854,1887,1921,1962,2019,2079,2132,2182,2235,2294,2353,2399,2438,2471,2494,2507,2511,2503,2489,2470,2440,2402,2363,2328,2297,2264,2232,2209,2193,2185,2183,2189,2205,2224,2239,2253,2269,2291,2325,2361,2390,2418,2450,2487,2526,2556,2580,2599,2608,2609,2601,2584,2562,2532,2490,2448,2413,2381,2352,2325,2296,2270,2251,2234,2218,2207,2197,2190,2191,2198,2207,2227,2257,2291,2327,2362,2394,2428,2456,2472,2484,2494,2499,2500,2496,2482,2464,2439,2402,2359,2321,2284,2251,2222,2191,2161,2139,2119,2100,2082,2057,2031,2013,1999,1987,1978,1977,1988,2009,2033,2060,2091,2117,2131,2136,2138,2132,2119,2102,2081,2054,2024,1982,1936,1900,1869,1839,1810,1776,1742,1713,1685,1657,1624,1582,1536,1497,1466,1434,1398,1364,1342,1327,1321,1326,1340,1359,1379,1397,1416,1438,1463,1490,1514,1537,1562,1590,1619,1647,1675,1703,1734,1765,1791,1806,1814,1817,1809,1793,1772,1746,1718,1689,1656,1624,1597,1574,1553,1536,1527,1527,1537,1552,1570,1598,1630,1659,1687,1717,1749,1786,1824,1855,1885,1916,1950,1989,2025,2046,2060,2071,2078,2081,2081,2080,2079,2075,2068,2065,2065,2065,2061,2054,2043,2029,2020,2015,2011,2012,2018,2028,2045,2066,2093,2130,2168,2204,2242,2280,2324,2377,2427,2464,2494,2526,2561,2593,2612,2623,2634,2641,2647,2653,2659,2662,2662,2656,2639,2613,2584,2551,2514,2474,2438,2413,2396,2383,2375,2375,2383,2392,2402,2416,2435,2455,2472,2487,2500,2514,2528,2540,2543,2536,2522,2500,2468,2438,2418,2402,2389,2375,2360,2347,2333,2314,2288,2255,2223,2201,2185,2169,2157,2147,2141,2138,2137,2136,2137,2139,2137,2132,2127,2122,2111,2097,2079,2056,2031,1998,1951,1900,1856,1819,1786,1752,1723,1704,1691,1680,1671,1661,1653,1653,1656,1662,1667,1670,1673,1676,1681,1689,1697,1706,1717,1728,1737,1743,1745,1742,1733,1721,1707,1689,1666,1640,1617,1598,1578,1556,1534,1512,1491,1468,1445,1426,1416,1417,1426,1438,1458,1485,1511,1532,1551,1574,1602,1631,1654,1676,1700,1727,1763,1799,1824,1842,1860,1877,1892,1900,1902,1902,1898,1892,1887,1881,1870,1854,1831,1803,1776,1759,1749,1749,1763,1791,1826,1865,1906,1948,1997,2044,2082,2120,2157,2192,2229,2262,2285,2303,2318,2322,2314,2299,2280,2260,2236,2205,2171,2142,2115,2083,2050,2012,1976,1953,1937,1922,1919,1927,1943,1969,1996,2026,2065,2105,2140,2177,2216,2259,2317,2381,2441,2501,2566,2633,2689,2725,2743,2753,2752,2738,2718,2694,2666,2634,2596,2549,2502,2462,2427,2392,2355,2323,2301,2282,2264,2249,2238,2232,2234,2244,2263,2293,2334,2380,2421,2459,2502,2548,2586,2611,2624,2629,2627,2619,2610,2601,2595,2587,2570,2547,2521,2486,2448,2402,2341,2281,2235,2191,2148,2111,2073,2045,2033,2028,2029,2042,2063,2092,2126,2160,2197,2242,2282,2310,2331,2346,2354,2359,2362,2361,2361,2364,2366,2364,2354,2333,2308,2276,2230,2183,2143,2101,2059,2019,1976,1942,1925,1918,1918,1928,1944,1961,1978,1995,2012,2028,2039,2043,2045,2046,2044,2038,2030,2022,2018,2015,2013,2010,2004,1990,1975,1953,1920,1886,1855,1825,1796,1768,1738,1714,1702,1699,1704,1725,1755,1786,1818,1852,1886,1921,1948,1962,1967,1968,1965,1963,1961,1962,1966,1975,1987,1997,2000,1997,1990,1973,1948,1922,1900,1879,1858,1836,1818,1810,1811,1817,1829,1853,1884,1919,1956,1992,2030,2078,2125,2163,2196,2226,2254,2276,2291,2305,2320,2335,2357,2378,2386,2383,2369,2344,2307,2265,2226,2192,2157,2122,2095,2081,2076,2077,2085,2105,2133,2164,2203,2246,2295,2354,2412,2462,2508,2554,2597,2632,2655,2670,2681,2691,2702,2715,2722,2722,2717,2703,2674,2635,2591,2545,2490,2423,2359,2311,2270,2235,2209,2192,2185,2189,2200,2216,2239,2265,2294,2323,2350,2382,2418,2451,2477,2496,2513,2526,2534,2536,2532,2524,2511,2489,2456,2416,2369,2319,2262,2194,2127,2074,2027,1985,1947,1912,1887,1876,1873,1876,1888,1903,1922,1944,1964,1989,2021,2055,2084,2109,2132,2153,2173,2189,2198,2202,2206,2208,2206,2196,2174,2147,2109,2050,1987,1927,1865,1804,1740,1669,1604,1558,1525,1496,1467,1440,1422,1408,1394,1383,1375,1371,1372,1377,1383,1396,1411,1426,1439,1450,1463,1484,1505,1522,1535,1548,1559,1568,1573,1570,1562,1549,1526,1497,1467,1443,1428,1418,1415,1418,1425,1436,1447,1460,1479,1498,1517,1538,1562,1591,1623,1652,1680,1707,1737,1775,1809,1835,1859,1880,1901,1929,1954,1971,1985,1998,2011,2020,2023,2025,2029,2035,2045,2057,2068,2082,2096,2107,2114,2120,2124,2128,2129,2133,2145,2159,2175,2192,2210,2236,2264,2286,2303,2313,2316,2316,2314,2307,2296,2280,2261,2242,2224,2205,2189,2176,2167,2162,2161,2163,2167,2172,2173,2170,2162,2153,2141,2123,2105,2094,2088,2086,2091,2104,2124,2145,2166,2187,2207,2224,2237,2246,2253,2257,2257,2252,2246,2241,2237,2233,2226,2219,2213,2206,2198,2185,2168,2155,2146,2136,2122,2104,2087,2078,2074,2071,2073,2088,2111,2134,2153,2170,2187,2198,2198,2191,2180,2164,2142,2116,2091,2066,2043,2022,1999,1980,1965,1950,1931,1902,1868,1838,1811,1787,1767,1742,1715,1695,1677,1657,1639,1623,1613,1610,1608,1609,1611,1612,1611,1604,1592,1583,1570,1554,1537,1519,1502,1489,1475,1461,1453,1450,1447,1443,1431,1416,1399,1384,1373,1365,1362,1365,1372,1380,1393,1413,1437,1465,1496,1537,1589,1642,1688,1730,1773,1814,1853,1886,1909,1929,1947,1961,1973,1982,1987,1993,1999,1999,1991,1973,1947,1917,1883,1847,1822,1813,1816,1824,1842,1874,1913,1949,1984,2021,2064,2107,2142,2174,2205,2239,2281,2325,2361,2391,2419,2445,2465,2475,2474,2470,2458,2437,2412,2385,2352,2314,2268,2208,2144,2090,2042,1994,1945,1903,1878,1864,1855,1851,1857,1865,1877,1891,1908,1928,1954,1981,2006,2028,2052,2080,2106,2125,2141,2153,2162,2169,2175,2177,2176,2174,2165,2149,2129,2110,2089,2062,2029,1996,1968,1945,1925,1910,1899,1891,1892,1902,1916,1943,1985,2036,2087,2137,2191,2248,2297,2329,2350,2362,2364,2355,2342,2329,2317,2305,2291,2275,2262,2252,2244,2233,2214,2189,2162,2135,2107,2078,2050,2026,2008,1993,1981,1974,1978,1990,2008,2030,2057,2089,2119,2141,2155,2162,2160,2148,2131,2113,2097,2082,2068,2053,2040,2029,2023,2022,2026,2034,2043,2053,2062,2075,2092,2110,2126,2141,2155,2166,2174,2179,2183,2190,2199,2213,2229,2244,2262,2280,2294,2306,2311,2308,2302,2294,2280,2264,2248,2232,2214,2195,2172,2150,2137,2128,2120,2116,2118,2126,2140,2156,2172,2187,2200,2209,2214,2219,2221,2223,2226,2231,2238,2247,2260,2279,2305,2333,2358,2382,2406,2427,2440,2448,2450,2447,2433,2412,2390,2365,2339,2317,2303,2295,2294,2298,2307,2323,2341,2354,2361,2363,2360,2352,2340,2327,2314,2302,2291,2282,2278,2277,2279,2285,2292,2299,2301,2300,2295,2289,2277,2259,2237,2213,2186,2157,2131,2113,2098,2086,2077,2075,2075,2075,2076,2077,2076,2073,2068,2061,2054,2049,2045,2045,2049,2054,2060,2065,2068,2069,2070,2071,2070,2071,2073,2080,2092,2107,2125,2148,2171,2186,2199,2210,2219,2230,2238,2240,2243,2249,2258,2269,2278,2281,2280,2278,2272,2262,2251,2238,2224,2209,2189,2168,2150,2130,2108,2084,2052,2021,2001,1989,1981,1978,1981,1990,2003,2011,2010,2000,1982,1959,1932,1896,1858,1828,1813,1806,1803,1807,1817,1828,1836,1841,1841,1837,1827,1812,1794,1775,1757,1737,1717,1700,1686,1675,1672,1680,1695,1715,1741,1772,1804,1835,1861,1876,1888,1898,1904,1907,1908,1910,1917,1928,1940,1951,1958,1963,1964,1954,1933,1904,1875,1846,1816,1783,1754,1730,1709,1692,1673,1657,1650,1652,1659,1669,1684,1704,1724,1737,1747,1754,1762,1772,1783,1796,1811,1827,1847,1865,1880,1895,1908,1921,1932,1938,1940,1944,1950,1962,1979,1995,2013,2031,2047,2064,2078,2086,2093,2100,2116,2144,2177,2208,2238,2271,2305,2333,2353,2374,2393,2412,2430,2446,2456,2464,2474,2481,2483,2477,2465,2451,2436,2415,2392,2372,2354,2337,2321,2302,2282,2267,2252,2235,2219,2207,2201,2198,2196,2199,2207,2215,2221,2226,2232,2239,2249,2264,2279,2289,2300,2314,2326,2331,2328,2321,2309,2285,2255,2228,2203,2180,2156,2131,2107,2086,2068,2052,2029,2004,1984,1967,1951,1936,1922,1910,1902,1892,1882,1870,1856,1847,1847,1850,1856,1868,1884,1901,1915,1927,1931,1924,1907,1885,1864,1840,1815,1795,1782,1774,1770,1772,1776,1780,1783,1786,1786,1779,1767,1754,1747,1743,1738,1733,1727,1725,1730,1741,1757,1785,1824,1866,1909,1952,1997,2047,2087,2106,2114,2118,2121,2123,2123,2121,2116,2106,2092,2076,2057,2036,2014,1985,1949,1913,1884,1861,1840,1822,1807,1797,1790,1781,1772,1763,1759,1764,1776,1792,1818,1857,1898,1930,1951,1969,1985,1992,1987,1981,1976,1968,1960,1950,1936,1921,1907,1887,1860,1830,1802,1777,1749,1718,1695,1682,1675,1668,1662,1655,1650,1649,1654,1664,1684,1721,1771,1822,1868,1916,1967,2010,2039,2058,2074,2087,2104,2123,2141,2161,2184,2207,2230,2246,2251,2251,2239,2207,2168,2134,2101,2071,2044,2014,1985,1966,1950,1932,1915,1902,1894,1892,1890,1893,1902,1914,1924,1932,1936,1940,1949,1961,1972,1989,2018,2056,2096,2129,2151,2170,2181,2174,2154,2128,2096,2063,2031,1994,1958,1933,1912,1887,1858,1825,1796,1770,1743,1717,1697,1686,1686,1694,1705,1724,1752,1781,1807,1833,1865,1910,1959,2004,2043,2080,2109,2126,2128,2119,2102,2080,2053,2024,2004,1995,1993,1997,2007,2015,2019,2020,2018,2008,1994,1976,1958,1945,1934,1926,1926,1931,1936,1943,1951,1961,1976,1992,2010,2029,2047,2060,2068,2069,2066,2058,2042,2022,2003,1989,1981,1976,1976,1979,1982,1981,1976,1969,1958,1946,1935,1927,1923,1931,1946,1962,1982,2004,2032,2067,2102,2130,2155,2183,2213,2247,2279,2303,2322,2338,2350,2355,2356,2353,2351,2348,2343,2335,2328,2317,2304,2286,2262,2235,2210,2187,2162,2143,2134,2133,2137,2147,2165,2195,2231,2264,2294,2324,2351,2375,2396,2413,2427,2438,2443,2443,2442,2437,2432,2429,2420,2407,2396,2384,2368,2343,2305,2259,2213,2169,2119,2065,2017,1981,1955,1933,1913,1899,1893,1894,1903,1920,1944,1973,2005,2035,2064,2098,2139,2182,2221,2252,2279,2306,2330,2349,2358,2356,2349,2336,2312,2283,2254,2223,2184,2138,2091,2051,2017,1984,1954,1924,1894,1870,1849,1835,1831,1838,1850,1864,1880,1902,1934,1969,2004,2036,2067,2098,2130,2159,2182,2200,2214,2220,2216,2204,2189,2170,2144,2111,2076,2045,2022,2001,1983,1968,1959,1951,1940,1925,1910,1896,1883,1872,1862,1855,1854,1861,1871,1883,1901,1922,1943,1965,1982,1995,2007,2016,2022,2028,2029,2021,2003,1969,1926,1885,1840,1788,1732,1672,1619,1581,1551,1522,1496,1477,1461,1451,1441,1431,1424,1422,1425,1432,1445,1465,1497,1534,1570,1606,1647,1696,1745,1792,1839,1888,1939,1995,2048,2088,2117,2137,2148,2152,2146,2134,2121,2109,2102,2099,2099,2103,2110,2112,2109,2104,2095,2086,2081,2078,2078,2085,2098,2113,2131,2150,2161,2164,2167,2170,2172,2172,2172,2173,2178,2184,2193,2204,2209,2208,2205,2193,2173,2149,2125,2103,2085,2071,2058,2046,2039,2034,2032,2029,2028,2031,2038,2046,2056,2071,2087,2100,2111,2116,2117,2117,2122,2126,2128,2131,2138,2145,2152,2160,2166,2170,2170,2171,2172,2172,2175,2182,2192,2201,2209,2217,2225,2234,2241,2243,2244,2244,2244,2244,2245,2245,2245,2245,2245,2248,2251,2253,2253,2257,2267,2277,2285,2290,2295,2296,2286,2265,2240,2218,2195,2170,2153,2142,2131,2123,2118,2109,2099,2092,2084,2076,2065,2050,2036,2026,2020,2018,2014,2004,1994,1986,1978,1969,1960,1950,1942,1937,1936,1934,1928,1918,1906,1895,1882,1866,1855,1851,1850,1854,1861,1868,1878,1888,1896,1902,1910,1919,1924,1925,1923,1920,1919,1919,1916,1909,1896,1876,1850,1829,1811,1795,1781,1771,1766,1764,1764,1763,1759,1754,1749,1745,1747,1754,1766,1786,1802,1816,1833,1855,1883,1921,1966,2009,2050,2094,2147,2200,2244,2283,2317,2345,2371,2392,2404,2413,2424,2437,2455,2473,2491,2510,2528,2545,2558,2561,2557,2552,2547,2542,2537,2528,2518,2504,2480,2452,2429,2408,2391,2379,2370,2366,2367,2369,2372,2376,2375,2370,2359,2345,2328,2301,2270,2243,2214,2185,2153,2114,2077,2053,2036,2022,2014,2009,2011,2021,2032,2043,2054,2057,2052,2045,2036,2029,2026,2029,2039,2053,2071,2098,2128,2155,2170,2176,2179,2175,2168,2163,2160,2155,2150,2142,2132,2123,2110,2094,2074,2051,2034,2026,2023,2025,2033,2043,2053,2061,2067,2067,2061,2054,2051,2053,2057,2065,2078,2089,2093,2096,2093,2076,2045,2009,1970,1935,1905,1880,1865,1864,1872,1884,1894,1900,1899,1892,1881,1868,1855,1846,1843,1848,1857,1873,1895,1918,1937,1953,1970,1993,2021,2046,2068,2088,2105,2118,2126,2120,2102,2076,2040,1995,1952,1917,1888,1859,1832,1812,1798,1785,1772,1756,1737,1722,1716,1716,1722,1737,1763,1793,1820,1844,1870,1901,1926,1944,1961,1979,1999,2024,2048,2066,2084,2102,2117,2129,2135,2138,2138,2138,2138,2137,2134,2131,2124,2113,2094,2075,2065,2062,2063,2077,2109,2157,2209,2260,2313,2371,2420,2453,2477,2497,2513,2528,2542,2551,2560,2569,2576,2579,2580,2577,2571,2562,2549,2537,2526,2515,2503,2488,2468,2443,2419,2396,2369,2338,2312,2297,2291,2291,2300,2319,2340,2360,2386,2417,2448,2481,2513,2540,2563,2583,2594,2597,2594,2582,2567,2546,2516,2487,2466,2446,2428,2412,2391,2366,2339,2307,2267,2219,2175,2141,2110,2081,2062,2050,2039,2028,2018,2009,2006,2003,2004,2012,2026,2050,2090,2134,2169,2198,2225,2244,2256,2262,2259,2252,2244,2232,2222,2216,2207,2193,2168,2125,2073,2021,1965,1907,1853,1801,1759,1733,1714,1700,1694,1687,1681,1680,1684,1694,1714,1737,1760,1786,1813,1841,1870,1895,1915,1931,1947,1961,1971,1981,1991,2001,2008,2010,2000,1982,1958,1929,1894,1856,1823,1802,1788,1776,1768,1764,1759,1754,1750,1744,1740,1744,1754,1769,1788,1811,1839,1866,1884,1898,1915,1930,1942,1955,1967,1980,1996,2013,2024,2027,2019,2001,1969,1923,1871,1824,1783,1743,1706,1675,1652,1630,1606,1580,1552,1525,1505,1494,1489,1498,1525,1563,1605,1647,1691,1736,1773,1796,1815,1832,1845,1859,1876,1892,1909,1923,1927,1921,1908,1888,1866,1841,1816,1803,1801,1804,1808,1815,1822,1827,1826,1820,1810,1804,1805,1818,1842,1872,1914,1978,2046,2103,2157,2210,2260,2312,2358,2392,2422,2450,2471,2485,2491,2484,2469,2445,2407,2368,2337,2313,2292,2276,2264,2254,2250,2245,2234,2219,2201,2185,2173,2164,2161,2166,2178,2194,2213,2235,2257,2283,2307,2324,2337,2350,2359,2361,2354,2339,2318,2287,2238,2180,2127,2075,2028,1990,1956,1932,1923,1923,1931,1945,1957,1963,1967,1969,1972,1974,1978,1984,1993,2003,2016,2034,2055,2071,2084,2096,2101,2103,2103,2098,2091,2082,2064,2042,2022,2000,1977,1951,1920,1891,1871,1856,1844,1834,1829,1830,1834,1838,1844,1852,1862,1875,1887,1900,1920,1942,1962,1985,2008,2031,2055,2074,2083,2086,2086,2080,2069,2055,2040,2025,2004,1976,1946,1920,1895,1873,1854,1835,1819,1809,1809,1812,1817,1824,1834,1844,1856,1872,1893,1915,1935,1955,1976,1997,2020,2039,2048,2049,2045,2038,2029,2019,2008,1998,1986,1966,1939,1910,1878,1843,1809,1775,1746,1730,1722,1719,1728,1750,1778,1811,1843,1877,1922,1970,2013,2061,2110,2163,2232,2307,2367,2417,2461,2494,2524,2547,2556,2559,2560,2554,2544,2529,2504,2475,2441,2396,2353,2323,2297,2274,2261,2257,2264,2280,2297,2317,2341,2357,2369,2383,2396,2411,2435,2463,2491,2521,2549,2576,2597,2607,2608,2605,2595,2578,2562,2549,2538,2526,2511,2491,2466,2441,2413,2383,2351,2321,2297,2279,2267,2259,2252,2248,2246,2246,2249,2260,2276,2295,2314,2334,2358,2381,2400,2410,2411,2408,2397,2377,2355,2333,2309,2287,2266,2239,2211,2183,2152,2116,2071,2024,1983,1947,1911,1878,1848,1825,1811,1804,1801,1806,1819,1842,1871,1903,1941,1987,2028,2057,2077,2090,2091,2083,2072,2059,2048,2039,2032,2033,2035,2035,2033,2024,1998,1961,1925,1891,1860,1833,1811,1797,1794,1797,1803,1812,1820,1826,1834,1842,1850,1861,1872,1883,1895,1904,1909,1910,1905,1899,1892,1887,1888,1900,1916,1934,1956,1978,1998,2011,2013,2008,1999,1988,1981,1980,1986,1994,2006,2025,2042,2050,2056,2061,2065,2069,2075,2082,2094,2107,2121,2137,2149,2153,2151,2146,2138,2129,2126,2128,2135,2147,2163,2176,2179,2175,2164,2145,2119,2096,2081,2075,2078,2096,2125,2156,2187,2216,2243,2269,2289,2300,2310,2322,2337,2360,2386,2409,2428,2441,2442,2434,2421,2403,2382,2361,2341,2327,2321,2317,2312,2306,2295,2283,2271,2260,2252,2249,2251,2261,2277,2295,2320,2350,2379,2404,2426,2448,2473,2499,2523,2545,2567,2588,2602,2608,2606,2596,2580,2557,2526,2492,2458,2424,2384,2337,2293,2254,2216,2178,2139,2100,2070,2054,2045,2043,2050,2064,2079,2094,2110,2133,2163,2196,2227,2257,2291,2328,2361,2385,2395,2393,2385,2362,2326,2284,2244,2205,2164,2119,2082,2054,2029,2002,1971,1932,1890,1851,1814,1779,1746,1710,1678,1656,1638,1626,1627,1637,1655,1685,1722,1764,1821,1882,1932,1976,2014,2041,2065,2083,2088,2083,2071,2049,2026,2007,1987,1966,1943,1910,1870,1830,1789,1746,1704,1659,1620,1595,1574,1554,1536,1522,1518,1523,1532,1553,1593,1640,1688,1736,1787,1846,1899,1933,1957,1978,1992,2000,2000,1992,1979,1966,1952,1938,1923,1910,1899,1884,1866,1852,1845,1843,1844,1850,1865,1882,1896,1910,1922,1930,1936,1942,1949,1958,1973,1993,2015,2036,2058,2081,2103,2129,2154,2172,2187,2199,2204,2204,2196,2179,2158,2134,2100,2069,2043,2017,1992,1969,1945,1925,1909,1891,1874,1859,1839,1819,1809,1801,1796,1799,1808,1822,1839,1854,1866,1881,1894,1899,1901,1902,1903,1908,1915,1917,1920,1918,1905,1889,1871,1854,1840,1832,1830,1838,1853,1871,1897,1931,1964,1990,2012,2033,2053,2071,2086,2101,2117,2135,2151,2168,2178,2179,2174,2161,2135,2107,2081,2055,2029,2004,1977,1952,1932,1911,1889,1869,1845,1826,1819,1817,1819,1829,1843,1856,1871,1884,1897,1909,1915,1914,1915,1920,1931,1955,1985,2013,2042,2072,2098,2115,2122,2122,2118,2108,2090,2071,2052,2030,2004,1974,1936,1898,1868,1843,1820,1804,1798,1802,1814,1830,1847,1868,1888,1897,1898,1895,1885,1868,1853,1845,1842,1843,1847,1854,1861,1867,1869,1866,1856,1845,1839,1834,1826,1816,1800,1781,1763,1745,1725,1706,1693,1688,1691,1698,1715,1749,1791,1828,1859,1890,1920,1942,1954,1959,1961,1966,1976,1988,2000,2012,2022,2029,2035,2033,2022,2011,1998,1981,1965,1953,1943,1936,1929,1921,1915,1911,1911,1914,1922,1937,1961,1990,2020,2055,2099,2143,2176,2205,2233,2256,2278,2299,2315,2329,2343,2353,2360,2358,2348,2333,2313,2281,2244,2211,2179,2145,2113,2080,2047,2026,2013,2002,1995,1992,1996,2012,2032,2055,2089,2128,2165,2203,2240,2275,2315,2352,2380,2406,2431,2456,2483,2502,2509,2508,2498,2475,2444,2412,2377,2341,2304,2263,2227,2201,2182,2167,2156,2147,2141,2138,2137,2139,2143,2151,2165,2183,2204,2230,2263,2297,2325,2350,2376,2400,2418,2430,2434,2431,2422,2399,2368,2330,2288,2243,2196,2142,2090,2049,2016,1987,1963,1949,1945,1947,1951,1957,1963,1967,1970,1972,1972,1974,1978,1988,2001,2014,2029,2049,2068,2081,2089,2093,2093,2088,2079,2064,2040,2015,1988,1954,1919,1891,1869,1844,1816,1791,1775,1766,1760,1755,1752,1752,1751,1751,1751,1746,1735,1721,1708,1697,1684,1671,1663,1658,1653,1647,1643,1640,1639,1643,1649,1658,1674,1699,1724,1747,1766,1788,1816,1840,1854,1865,1874,1881,1895,1917,1936,1957,1986,2021,2059,2092,2121,2149,2170,2187,2199,2207,2213,2218,2222,2224,2224,2221,2219,2213,2204,2195,2185,2177,2172,2170,2172,2176,2178,2181,2187,2191,2194,2197,2199,2203,2215,2233,2253,2274,2294,2314,2332,2344,2350,2351,2345,2334,2320,2301,2282,2267,2254,2240,2225,2208,2193,2180,2163,2143,2120,2099,2086,2079,2073,2069,2071,2077,2086,2094,2103,2117,2132,2146,2160,2172,2183,2198,2210,2215,2216,2215,2211,2203,2192,2180,2166,2149,2127,2104,2084,2064,2044,2028,2015,2005,2004,2008,2013,2023,2035,2048,2062,2077,2093,2108,2121,2128,2134,2137,2138,2137,2137,2135,2132,2132,2133,2134,2134,2133,2132,2133,2135,2137,2139,2140,2140,2138,2133,2131,2132,2138,2146,2158,2169,2179,2184,2186,2183,2176,2169,2167,2165,2161,2155,2153,2151,2148,2144,2140,2135,2130,2125,2119,2115,2110,2106,2101,2097,2093,2091,2091,2090,2089,2088,2090,2094,2103,2116,2129,2144,2161,2172,2170,2156,2136,2112,2083,2046,2005,1968,1941,1920,1900,1885,1871,1859,1848,1837,1831,1833,1842,1855,1869,1885,1905,1932,1958,1979,1997,2018,2043,2068,2090,2112,2137,2170,2214,2260,2298,2328,2354,2372,2378,2372,2355,2331,2303,2270,2238,2213,2191,2172,2154,2136,2122,2113,2109,2109,2117,2126,2131,2134,2135,2133,2124,2108,2091,2073,2056,2037,2018,2000,1991,1986,1982,1980,1981,1987,1997,2005,2011,2015,2016,2014,2009,1999,1984,1966,1946,1927,1907,1885,1864,1851,1848,1849,1857,1874,1894,1912,1923,1926,1925,1920,1907,1889,1870,1852,1836,1816,1793,1773,1759,1749,1745,1748,1761,1780,1802,1822,1843,1863,1880,1894,1905,1915,1927,1938,1947,1957,1970,1983,2001,2020,2033,2042,2047,2043,2029,2005,1975,1945,1910,1866,1822,1786,1753,1723,1695,1666,1643,1634,1631,1634,1648,1670,1696,1724,1753,1785,1830,1879,1926,1974,2024,2078,2139,2199,2247,2285,2318,2344,2359,2358,2345,2323,2291,2248,2203,2163,2126,2090,2052,2013,1976,1949,1929,1910,1890,1872,1858,1852,1850,1853,1863,1878,1897,1924,1955,1990,2034,2080,2118,2152,2186,2217,2242,2258,2263,2261,2245,2210,2165,2118,2069,2020,1971,1923,1881,1850,1826,1805,1786,1774,1770,1772,1776,1789,1817,1854,1892,1932,1973,2016,2064,2107,2137,2155,2166,2171,2170,2165,2157,2152,2148,2142,2132,2117,2094,2064,2026,1974,1920,1876,1841,1813,1795,1787,1790,1801,1816,1836,1866,1904,1941,1980,2030,2096,2167,2234,2300,2363,2423,2478,2526,2558,2576,2585,2585,2577,2564,2549,2535,2518,2492,2462,2430,2395,2357,2315,2263,2210,2165,2128,2095,2062,2026,1992,1966,1946,1930,1920,1917,1925,1943,1966,1997,2035,2074,2111,2144,2173,2198,2221,2237,2244,2244,2236,2219,2200,2185,2168,2149,2129,2108,2090,2076,2058,2040,2025,2007,1988,1973,1960,1950,1945,1942,1941,1942,1948,1962,1981,1998,2013,2028,2042,2052,2057,2056,2050,2040,2024,1996,1964,1935,1907,1879,1852,1825,1800,1783,1772,1762,1757,1753,1750,1748,1746,1745,1751,1759,1764,1770,1778,1786,1795,1804,1811,1818,1829,1844,1861,1879,1899,1916,1929,1944,1954,1953,1947,1938,1928,1921,1918,1917,1919,1921,1920,1916,1910,1900,1888,1876,1862,1849,1840,1834,1829,1826,1823,1820,1815,1809,1802,1791,1782,1779,1782,1789,1798,1811,1828,1844,1855,1862,1865,1863,1860,1859,1859,1861,1869,1883,1897,1908,1914,1918,1922,1926,1930,1936,1946,1963,1986,2009,2026,2037,2045,2050,2048,2040,2030,2022,2016,2017,2028,2044,2066,2092,2117,2140,2160,2175,2187,2198,2210,2223,2234,2243,2251,2256,2252,2241,2226,2210,2195,2183,2176,2175,2179,2187,2194,2196,2190,2175,2153,2126,2094,2057,2021,1993,1975,1966,1964,1969,1975,1980,1984,1983,1975,1962,1948,1935,1922,1909,1895,1880,1867,1851,1830,1806,1786,1772,1765,1762,1767,1780,1796,1813,1826,1829,1824,1813,1801,1793,1786,1785,1797,1819,1846,1874,1902,1931,1959,1977,1981,1978,1974,1970,1962,1954,1950,1947,1941,1927,1904,1877,1844,1809,1774,1738,1708,1694,1691,1694,1702,1710,1717,1724,1727,1728,1729,1733,1742,1757,1777,1806,1845,1885,1919,1948,1978,2004,2027,2047,2062,2077,2092,2110,2128,2141,2149,2154,2151,2140,2125,2111,2100,2087,2070,2053,2040,2031,2026,2023,2018,2014,2012,2014,2021,2031,2047,2065,2080,2091,2097,2100,2103,2105,2107,2112,2125,2147,2176,2201,2224,2243,2255,2259,2253,2237,2218,2192,2158,2127,2103,2083,2061,2038,2016,2001,1993,1988,1985,1984,1991,2010,2037,2067,2102,2146,2189,2222,2247,2265,2276,2286,2295,2303,2311,2321,2333,2342,2346,2346,2341,2332,2321,2307,2294,2286,2283,2284,2284,2283,2278,2273,2268,2259,2241,2219,2197,2176,2158,2140,2123,2111,2102,2093,2082,2065,2044,2026,2007,1984,1960,1942,1932,1930,1932,1938,1950,1967,1986,2004,2022,2043,2068,2092,2110,2123,2135,2144,2147,2145,2136,2127,2116,2101,2087,2076,2061,2046,2029,2003,1976,1955,1932,1903,1866,1827,1795,1767,1739,1717,1696,1676,1665,1661,1658,1661,1670,1681,1696,1712,1730,1755,1784,1808,1834,1864,1894,1929,1964,1991,2013,2035,2048,2050,2045,2029,2005,1972,1933,1896,1863,1832,1806,1782,1757,1735,1721,1712,1705,1701,1701,1704,1711,1722,1737,1757,1777,1795,1813,1835,1861,1891,1919,1940,1957,1975,1992,2004,2009,2007,1997,1981,1960,1939,1922,1910,1900,1893,1891,1891,1890,1886,1878,1870,1865,1866,1875,1891,1921,1967,2020,2069,2118,2165,2208,2250,2284,2305,2322,2340,2356,2371,2384,2392,2401,2408,2408,2401,2387,2366,2347,2331,2316,2306,2303,2300,2294,2285,2272,2256,2239,2224,2214,2212,2219,2240,2271,2305,2347,2395,2438,2467,2488,2503,2513,2517,2517,2516,2512,2502,2487,2469,2445,2418,2387,2346,2292,2239,2198,2167,2137,2114,2098,2089,2082,2074,2061,2041,2021,2009,2006,2009,2020,2043,2072,2101,2129,2159,2190,2218,2238,2257,2276,2296,2321,2346,2365,2381,2393,2396,2392,2382,2360,2333,2302,2262,2225,2199,2177,2158,2150,2146,2144,2145,2141,2138,2140,2146,2159,2180,2205,2234,2270,2301,2322,2341,2357,2370,2383,2395,2405,2415,2424,2428,2428,2420,2406,2389,2366,2331,2293,2259,2227,2197,2170,2150,2140,2139,2144,2150,2155,2158,2160,2160,2155,2148,2142,2140,2139,2139,2139,2139,2140,2139,2135,2130,2125,2118,2110,2104,2095,2084,2070,2051,2029,2008,1990,1972,1950,1925,1902,1882,1865,1847,1828,1809,1792,1779,1770,1757,1742,1729,1720,1713,1710,1710,1714,1723,1736,1751,1769,1791,1812,1826,1837,1848,1853,1852,1847,1840,1833,1823,1813,1807,1804,1802,1797,1794,1798,1806,1812,1820,1829,1845,1875,1911,1948,1987,2031,2085,2138,2181,2216,2248,2276,2302,2322,2334,2340,2344,2341,2334,2324,2311,2295,2276,2250,2223,2201,2178,2152,2120,2074,2022,1975,1927,1877,1827,1773,1721,1683,1654,1632,1623,1625,1636,1654,1672,1695,1728,1760,1791,1826,1862,1899,1942,1984,2014,2038,2062,2083,2095,2098,2098,2095,2089,2077,2063,2048,2028,2005,1975,1935,1892,1856,1825,1793,1759,1729,1710,1700,1698,1705,1720,1739,1758,1779,1804,1834,1872,1913,1946,1975,2005,2030,2048,2054,2053,2051,2043,2027,2010,1996,1982,1962,1937,1910,1886,1863,1838,1809,1775,1744,1724,1708,1690,1677,1674,1679,1687,1699,1719,1750,1785,1817,1850,1882,1919,1965,2008,2036,2057,2077,2088,2091,2088,2080,2075,2071,2062,2050,2036,2015,1993,1968,1935,1901,1874,1853,1836,1828,1831,1842,1857,1873,1889,1913,1940,1962,1981,2001,2022,2047,2071,2093,2113,2130,2141,2147,2145,2137,2124,2101,2070,2040,2017,2000,1985,1970,1952,1931,1913,1894,1872,1850,1827,1806,1794,1785,1781,1785,1792,1799,1809,1822,1841,1870,1906,1943,1981,2029,2088,2148,2198,2240,2278,2305,2320,2322,2313,2294,2270,2241,2207,2175,2150,2127,2100,2069,2036,2009,1986,1965,1951,1944,1942,1947,1957,1969,1981,1993,2006,2016,2024,2036,2055,2077,2099,2123,2148,2176,2203,2223,2234,2237,2233,2219,2194,2163,2132,2106,2083,2062,2050,2049,2057,2067,2081,2101,2125,2148,2168,2185,2200,2216,2229,2231,2230,2228,2219,2205,2194,2184,2177,2173,2170,2168,2167,2165,2163,2160,2153,2144,2135,2125,2113,2095,2074,2056,2040,2028,2016,2007,2004,2009,2021,2035,2053,2079,2108,2132,2149,2162,2172,2178,2179,2175,2165,2150,2130,2107,2082,2059,2034,2001,1963,1926,1888,1851,1815,1778,1743,1717,1696,1681,1673,1669,1670,1678,1689,1705,1733,1770,1811,1857,1909,1967,2036,2106,2162,2209,2247,2274,2294,2302,2293,2278,2253,2215,2173,2131,2085,2042,1997,1944,1894,1855,1819,1787,1761,1731,1702,1685,1672,1658,1650,1646,1645,1654,1670,1691,1726,1767,1811,1857,1905,1955,2009,2057,2091,2116,2135,2146,2151,2154,2153,2150,2150,2149,2145,2141,2132,2120,2108,2092,2073,2058,2043,2026,2012,1999,1987,1981,1978,1979,1989,2005,2026,2049,2079,2119,2164,2211,2259,2307,2354,2403,2444,2470,2487,2496,2495,2487,2478,2466,2454,2439,2419,2396,2375,2355,2339,2326,2315,2310,2312,2317,2323,2330,2335,2339,2343,2347,2352,2360,2365,2370,2378,2390,2408,2437,2472,2499,2525,2551,2566,2573,2569,2549,2522,2489,2440,2390,2348,2302,2254,2205,2148,2092,2051,2021,1998,1979,1963,1954,1953,1953,1946,1934,1917,1898,1883,1872,1862,1854,1853,1856,1867,1886,1914,1950,1986,2012,2032,2053,2072,2083,2090,2093,2095,2098,2099,2097,2093,2083,2072,2058,2041,2026,2021,2019,2022,2033,2050,2068,2084,2095,2097,2090,2080,2074,2071,2066,2061,2062,2066,2075,2084,2095,2111,2126,2135,2142,2145,2148,2150,2148,2142,2137,2134,2134,2137,2140,2139,2134,2132,2135,2141,2148,2156,2167,2186,2207,2227,2242,2252,2261,2274,2287,2297,2307,2317,2325,2331,2335,2334,2332,2329,2326,2326,2324,2315,2302,2284,2253,2213,2174,2138,2105,2074,2045,2024,2014,2008,2003,2001,1999,1999,2002,2001,1996,1989,1982,1979,1982,1984,1993,2010,2030,2050,2072,2089,2105,2126,2146,2163,2182,2206,2234,2259,2273,2277,2274,2259,2231,2199,2171,2150,2135,2128,2127,2135,2152,2173,2198,2228,2258,2282,2300,2316,2328,2335,2339,2340,2338,2336,2333,2330,2326,2320,2315,2307,2297,2288,2279,2271,2262,2250,2228,2200,2168,2133,2095,2051,2011,1981,1958,1939,1925,1914,1909,1913,1920,1927,1938,1956,1978,1997,2010,2020,2028,2028,2020,2006,1990,1969,1939,1905,1871,1840,1813,1787,1759,1734,1717,1706,1698,1691,1682,1672,1663,1658,1652,1644,1634,1628,1624,1623,1626,1635,1651,1676,1704,1741,1787,1832,1870,1901,1924,1937,1944,1941,1928,1910,1888,1862,1830,1795,1766,1743,1719,1698,1687,1683,1685,1689,1696,1706,1714,1719,1726,1731,1736,1744,1753,1761,1771,1785,1805,1829,1851,1874,1895,1913,1929,1944,1956,1968,1979,1995,2014,2031,2046,2059,2068,2072,2072,2067,2062,2059,2056,2056,2059,2062,2063,2062,2059,2055,2051,2049,2047,2050,2061,2076,2093,2110,2124,2139,2154,2158,2151,2139,2123,2103,2085,2074,2068,2068,2075,2086,2101,2113,2117,2116,2107,2092,2078,2067,2058,2052,2048,2043,2041,2040,2040,2038,2031,2024,2022,2022,2022,2026,2033,2043,2053,2061,2069,2078,2082,2080,2076,2072,2068,2065,2066,2070,2078,2091,2108,2127,2145,2161,2176,2194,2216,2240,2261,2279,2296,2306,2307,2296,2277,2254,2222,2173,2125,2086,2050,2019,1990,1963,1946,1941,1938,1938,1940,1944,1949,1955,1961,1971,1985,2002,2018,2036,2056,2075,2094,2111,2123,2133,2142,2150,2158,2163,2166,2166,2164,2156,2143,2126,2107,2088,2068,2042,2016,1997,1983,1974,1971,1977,1989,2005,2022,2042,2070,2099,2124,2146,2167,2192,2223,2253,2277,2299,2319,2342,2367,2388,2400,2404,2403,2396,2384,2367,2344,2315,2280,2232,2180,2132,2082,2028,1968,1897,1826,1772,1725,1680,1640,1610,1592,1584,1578,1583,1600,1622,1643,1667,1696,1729,1759,1789,1820,1852,1887,1927,1966,1998,2027,2056,2080,2099,2111,2117,2116,2107,2088,2066,2045,2023,2001,1975,1942,1915,1897,1882,1867,1853,1838,1825,1816,1810,1811,1820,1835,1852,1873,1897,1924,1956,1987,2010,2029,2050,2069,2089,2108,2122,2135,2148,2157,2163,2167,2171,2176,2179,2178,2178,2180,2182,2184,2187,2185,2180,2176,2169,2155,2138,2120,2105,2093,2078,2065,2060,2058,2058,2062,2063,2066,2077,2090,2102,2118,2142,2176,2212,2243,2272,2295,2312,2323,2327,2325,2322,2318,2311,2301,2290,2282,2274,2264,2251,2234,2219,2208,2197,2188,2179,2174,2172,2171,2170,2171,2175,2178,2182,2187,2193,2205,2220,2237,2258,2280,2303,2324,2339,2342,2338,2329,2312,2292,2276,2263,2251,2240,2224,2203,2185,2165,2145,2126,2104,2087,2081,2080,2082,2089,2094,2094,2093,2089,2086,2085,2087,2091,2100,2115,2136,2169,2206,2235,2260,2283,2298,2304,2300,2285,2266,2243,2215,2189,2166,2139,2108,2069,2016,1959,1905,1852,1796,1740,1695,1668,1649,1633,1622,1610,1600,1595,1593,1594,1602,1618,1637,1659,1684,1715,1756,1796,1827,1858,1887,1916,1950,1980,1999,2017,2033,2045,2057,2065,2065,2063,2057,2047,2039,2033,2030,2029,2034,2048,2064,2074,2081,2083,2079,2071,2060,2051,2046,2044,2047,2054,2057,2060,2066,2070,2074,2081,2090,2101,2116,2135,2154,2170,2182,2190,2192,2189,2181,2172,2161,2151,2142,2135,2135,2145,2158,2176,2201,2227,2247,2263,2273,2278,2283,2286,2289,2294,2298,2305,2316,2326,2331,2335,2341,2350,2361,2375,2388,2401,2412,2415,2411,2403,2390,2376,2359,2337,2318,2302,2287,2274,2260,2246,2237,2232,2225,2218,2208,2195,2183,2170,2155,2142,2128,2114,2102,2091,2079,2065,2050,2035,2022,2011,2002,1994,1987,1985,1982,1976,1968,1962,1962,1965,1969,1976,1988,2001,2012,2020,2025,2028,2029,2026,2021,2018,2015,2011,2007,2004,1999,1993,1984,1969,1951,1929,1904,1879,1851,1817,1789,1769,1754,1739,1722,1706,1696,1689,1679,1669,1664,1664,1670,1681,1693,1708,1728,1750,1768,1781,1793,1806,1816,1823,1828,1835,1839,1844,1849,1853,1857,1859,1861,1864,1867,1868,1870,1871,1872,1874,1877,1879,1879,1877,1873,1867,1861,1856,1852,1851,1854,1861,1872,1884,1901,1927,1955,1978,1999,2019,2037,2056,2069,2075,2079,2081,2082,2084,2083,2083,2086,2089,2090,2093,2095,2097,2098,2101,2103,2103,2101,2099,2093,2084,2070,2053,2040,2029,2020,2017,2019,2028,2046,2068,2096,2136,2177,2211,2238,2261,2282,2299,2306,2306,2303,2300,2300,2300,2295,2287,2277,2267,2258,2245,2233,2224,2218,2212,2207,2200,2193,2186,2175,2158,2138,2122,2111,2103,2100,2100,2106,2121,2141,2165,2193,2218,2238,2256,2271,2284,2296,2306,2315,2323,2333,2345,2356,2364,2364,2359,2350,2336,2319,2303,2285,2267,2247,2217,2183,2149,2112,2074,2033,1988,1950,1925,1908,1894,1883,1878,1881,1887,1893,1897,1902,1909,1919,1928,1937,1951,1973,2000,2027,2053,2083,2118,2150,2172,2188,2203,2216,2226,2232,2232,2231,2229,2214,2190,2162,2128,2092,2051,2002,1956,1923,1895,1871,1853,1839,1832,1835,1840,1848,1860,1873,1887,1902,1914,1928,1950,1973,1993,2015,2041,2072,2112,2148,2172,2193,2212,2224,2228,2223,2211,2197,2176,2143,2107,2071,2036,2004,1972,1937,1904,1880,1862,1844,1823,1806,1797,1792,1793,1797,1806,1821,1839,1857,1874,1895,1921,1949,1975,2000,2028,2064,2100,2129,2154,2177,2193,2202,2201,2192,2177,2159,2131,2091,2049,2013,1980,1945,1909,1876,1851,1833,1817,1805,1796,1791,1791,1794,1799,1813,1831,1850,1872,1893,1915,1951,1991,2025,2064,2102,2142,2193,2244,2282,2316,2346,2369,2388,2396,2396,2397,2392,2381,2369,2358,2345,2336,2329,2323,2318,2316,2317,2318,2316,2311,2305,2296,2285,2274,2262,2251,2243,2237,2235,2237,2243,2254,2267,2281,2299,2318,2337,2353,2365,2373,2376,2370,2361,2349,2332,2313,2292,2261,2228,2200,2173,2148,2126,2105,2093,2088,2084,2082,2081,2079,2076,2074,2071,2070,2070,2072,2073,2075,2079,2087,2094,2099,2103,2106,2109,2111,2111,2109,2103,2095,2084,2068,2049,2030,2011,1990,1962,1936,1916,1897,1880,1868,1859,1855,1858,1862,1867,1872,1874,1875,1876,1873,1872,1876,1884,1894,1910,1928,1946,1971,1998,2019,2038,2057,2074,2087,2093,2092,2090,2082,2064,2041,2017,1990,1964,1933,1894,1853,1816,1785,1756,1728,1707,1698,1695,1692,1692,1698,1706,1716,1726,1738,1752,1774,1800,1826,1850,1871,1894,1916,1929,1937,1943,1944,1937,1929,1920,1912,1903,1894,1884,1874,1865,1855,1842,1824,1801,1779,1762,1747,1735,1730,1732,1740,1751,1761,1774,1792,1809,1829,1851,1879,1919,1964,2008,2052,2095,2133,2170,2201,2218,2226,2227,2220,2208,2194,2178,2165,2151,2135,2122,2110,2097,2084,2070,2055,2041,2033,2030,2030,2038,2053,2067,2081,2098,2115,2136,2158,2176,2195,2216,2241,2268,2297,2318,2334,2349,2358,2357,2352,2342,2329,2309,2278,2245,2215,2184,2156,2131,2104,2079,2062,2049,2038,2028,2019,2013,2006,1999,1993,1988,1980,1972,1962,1953,1947,1940,1934,1932,1928,1925,1923,1919,1913,1907,1900,1891,1882,1873,1865,1856,1846,1830,1804,1778,1756,1737,1720,1705,1693,1691,1696,1703,1715,1734,1755,1773,1788,1802,1816,1830,1844,1852,1858,1866,1875,1883,1886,1885,1881,1874,1861,1843,1827,1810,1790,1767,1747,1731,1714,1695,1673,1643,1613,1590,1573,1557,1548,1546,1553,1569,1588,1610,1641,1677,1707,1733,1758,1780,1802,1825,1844,1861,1877,1894,1912,1929,1942,1955,1967,1977,1987,1994,2000,2006,2009,2009,2004,1996,1985,1973,1960,1944,1931,1925,1924,1928,1937,1952,1967,1982,1995,2007,2017,2021,2021,2020,2017,2015,2016,2020,2027,2035,2045,2057,2067,2076,2084,2089,2092,2095,2095,2094,2093,2092,2091,2092,2093,2096,2102,2112,2127,2148,2168,2187,2207,2223,2236,2244,2245,2239,2230,2215,2194,2171,2152,2137,2123,2113,2107,2103,2103,2106,2109,2109,2107,2106,2106,2104,2101,2098,2098,2097,2096,2097,2098,2102,2112,2125,2141,2165,2195,2227,2255,2278,2299,2321,2341,2356,2366,2375,2381,2384,2386,2386,2383,2380,2372,2361,2345,2327,2306,2282,2252,2219,2191,2167,2145,2124,2102,2079,2057,2034,2010,1985,1957,1934,1923,1916,1914,1919,1926,1936,1947,1956,1965,1976,1988,2000,2011,2021,2035,2055,2079,2100,2120,2144,2172,2199,2219,2231,2243,2252,2260,2266,2269,2271,2273,2272,2263,2249,2229,2206,2179,2145,2110,2082,2059,2035,2014,1992,1972,1957,1943,1926,1907,1891,1881,1874,1868,1865,1865,1870,1882,1898,1917,1943,1974,2003,2028,2049,2068,2088,2106,2117,2123,2130,2135,2137,2134,2129,2126,2124,2124,2126,2129,2134,2141,2150,2160,2169,2175,2180,2184,2185,2185,2185,2182,2178,2174,2169,2165,2163,2161,2162,2166,2175,2186,2193,2197,2200,2201,2197,2189,2178,2162,2147,2130,2106,2081,2060,2043,2025,2008,1993,1982,1976,1969,1963,1959,1954,1951,1949,1943,1937,1933,1929,1929,1932,1936,1947,1962,1977,1997,2021,2048,2083,2119,2149,2176,2202,2228,2255,2278,2291,2300,2306,2306,2305,2300,2291,2281,2269,2257,2250,2246,2242,2240,2234,2225,2217,2206,2192,2176,2158,2138,2124,2114,2106,2102,2099,2099,2104,2111,2120,2134,2148,2160,2173,2187,2199,2215,2228,2236,2240,2243,2240,2230,2214,2194,2174,2150,2123,2101,2088,2080,2075,2075,2078,2084,2091,2097,2100,2102,2104,2106,2108,2109,2112,2117,2121,2126,2134,2142,2154,2169,2184,2197,2208,2218,2227,2233,2235,2231,2226,2218,2199,2174,2148,2120,2091,2061,2026,1996,1977,1963,1955,1953,1955,1960,1966,1971,1975,1979,1981,1983,1986,1990,1999,2013,2029,2044,2059,2072,2086,2098,2101,2099,2096,2089,2077,2067,2056,2047,2041,2032,2018,2003,1988,1973,1954,1929,1904,1887,1875,1867,1866,1873,1885,1898,1911,1929,1950,1976,2001,2023,2044,2068,2096,2122,2142,2154,2161,2161,2153,2139,2118,2091,2064,2034,2003,1974,1952,1936,1918,1899,1882,1867,1853,1839,1827,1822,1825,1836,1855,1878,1904,1936,1967,1992,2012,2033,2058,2081,2100,2119,2139,2157,2174,2187,2192,2188,2178,2162,2135,2099,2063,2028,1988,1944,1906,1878,1858,1839,1825,1816,1812,1816,1826,1839,1860,1895,1938,1981,2020,2062,2109,2153,2185,2209,2231,2248,2264,2275,2279,2277,2275,2269,2258,2243,2225,2205,2179,2140,2092,2046,1998,1947,1896,1838,1783,1748,1725,1706,1698,1700,1712,1733,1758,1789,1830,1872,1904,1934,1963,1991,2021,2050,2072,2091,2114,2135,2151,2161,2162,2161,2153,2138,2120,2101,2078,2055,2027,1989,1948,1912,1876,1835,1788,1742,1708,1684,1664,1650,1645,1649,1661,1678,1699,1725,1758,1790,1814,1834,1856,1880,1900,1912,1920,1928,1931,1930,1926,1917,1905,1893,1878,1857,1836,1817,1799,1777,1749,1723,1705,1688,1669,1652,1635,1620,1612,1609,1606,1610,1626,1648,1675,1705,1741,1786,1832,1868,1900,1931,1957,1979,1996,2005,2012,2018,2022,2024,2024,2026,2029,2030,2029,2025,2020,2011,2001,1988,1971,1954,1940,1929,1920,1913,1909,1907,1907,1906,1907,1913,1920,1926,1933,1943,1954,1968,1983,1994,2005,2016,2027,2037,2046,2054,2063,2074,2086,2100,2113,2125,2135,2144,2152,2158,2163,2166,2168,2168,2168,2170,2170,2169,2170,2171,2171,2172,2172,2171,2168,2161,2151,2140,2127,2114,2098,2081,2067,2054,2040,2022,2001,1980,1963,1947,1933,1925,1925,1934,1948,1964,1983,2006,2030,2050,2064,2074,2084,2091,2097,2101,2101,2102,2103,2104,2102,2098,2093,2086,2075,2060,2044,2027,2010,1996,1980,1964,1953,1945,1938,1930,1922,1916,1915,1916,1920,1930,1940,1949,1961,1972,1980,1989,1996,2002,2008,2015,2021,2029,2035,2040,2044,2045,2042,2038,2032,2024,2015,2005,1992,1980,1972,1965,1958,1954,1952,1951,1953,1956,1960,1969,1981,1997,2017,2039,2062,2089,2111,2125,2132,2134,2129,2119,2107,2096,2087,2080,2074,2069,2066,2062,2057,2051,2040,2028,2020,2014,2008,2002,1998,1996,1996,1998,1998,1997,1998,2002,2008,2013,2022,2037,2058,2080,2103,2130,2159,2187,2206,2221,2230,2233,2231,2226,2218,2208,2199,2189,2179,2170,2161,2151,2142,2134,2129,2127,2127,2129,2136,2145,2151,2155,2156,2158,2162,2168,2175,2184,2194,2211,2234,2259,2283,2304,2323,2342,2360,2377,2388,2395,2399,2398,2392,2381,2368,2351,2334,2313,2292,2275,2260,2247,2235,2222,2207,2195,2182,2166,2145,2121,2098,2076,2054,2031,2007,1987,1975,1966,1959,1956,1958,1966,1977,1988,2004,2024,2045,2064,2083,2100,2117,2132,2143,2147,2149,2152,2153,2151,2150,2150,2150,2151,2152,2150,2146,2142,2138,2135,2128,2116,2106,2099,2087,2074,2059,2043,2024,2006,1984,1957,1932,1916,1906,1900,1897,1902,1913,1927,1939,1952,1968,1984,1997,2010,2022,2033,2044,2055,2062,2066,2067,2067,2068,2070,2072,2073,2076,2080,2082,2081,2078,2072,2063,2052,2042,2033,2023,2015,2007,2000,1996,1998,2002,2007,2017,2030,2045,2062,2077,2094,2117,2139,2156,2175,2193,2209,2227,2239,2246,2249,2251,2251,2251,2254,2259,2266,2273,2281,2287,2288,2287,2284,2275,2262,2246,2228,2210,2191,2167,2144,2124,2107,2090,2073,2055,2038,2027,2019,2014,2014,2018,2026,2037,2051,2067,2087,2104,2114,2122,2129,2137,2148,2157,2165,2172,2178,2184,2189,2189,2186,2182,2176,2168,2160,2152,2143,2133,2122,2110,2101,2095,2089,2083,2075,2067,2062,2056,2047,2039,2035,2034,2039,2047,2057,2070,2087,2103,2118,2132,2146,2160,2174,2184,2192,2200,2203,2200,2193,2185,2174,2161,2144,2120,2097,2076,2056,2035,2008,1983,1964,1945,1926,1910,1891,1871,1856,1843,1833,1828,1830,1838,1851,1868,1889,1915,1938,1955,1968,1980,1990,2002,2013,2019,2026,2033,2036,2035,2029,2017,2003,1982,1951,1920,1894,1868,1846,1826,1808,1794,1784,1775,1768,1760,1751,1741,1732,1724,1722,1724,1732,1744,1760,1777,1796,1816,1833,1846,1856,1869,1885,1902,1917,1932,1946,1956,1960,1956,1948,1935,1918,1897,1876,1857,1848,1844,1844,1852,1867,1882,1900,1918,1935,1954,1971,1984,1997,2009,2023,2044,2070,2093,2114,2137,2161,2183,2199,2211,2220,2227,2234,2239,2240,2240,2238,2231,2217,2197,2176,2155,2128,2096,2065,2038,2018,2000,1984,1971,1963,1960,1960,1964,1970,1976,1984,1991,1997,2001,2008,2017,2024,2032,2042,2052,2067,2082,2094,2103,2111,2118,2125,2130,2131,2132,2132,2131,2130,2130,2129,2128,2124,2118,2108,2100,2092,2083,2075,2071,2072,2077,2087,2101,2119,2136,2150,2161,2171,2181,2189,2197,2204,2212,2219,2226,2231,2233,2232,2230,2225,2216,2205,2191,2174,2155,2135,2113,2093,2078,2067,2060,2056,2057,2060,2060,2060,2060,2057,2051,2044,2036,2028,2022,2016,2011,2006,2002,1998,1994,1988,1982,1979,1976,1975,1976,1977,1980,1984,1989,1995,2002,2007,2009,2005,1996,1981,1963,1944,1926,1911,1897,1886,1879,1874,1869,1865,1861,1853,1841,1829,1817,1802,1784,1768,1757,1750,1744,1741,1740,1742,1747,1752,1758,1764,1771,1780,1788,1798,1810,1826,1843,1857,1868,1877,1884,1889,1891,1892,1890,1889,1887,1885,1887,1891,1895,1901,1905,1908,1911,1912,1911,1909,1904,1899,1893,1888,1883,1881,1881,1883,1886,1890,1895,1903,1913,1922,1932,1946,1965,1988,2012,2030,2044,2056,2066,2073,2076,2077,2077,2076,2075,2075,2074,2075,2076,2076,2073,2070,2066,2064,2062,2061,2061,2062,2064,2068,2072,2079,2085,2088,2091,2092,2091,2091,2090,2090,2091,2096,2106,2119,2130,2142,2156,2168,2180,2192,2201,2210,2219,2225,2235,2247,2255,2260,2263,2263,2261,2259,2256,2251,2247,2245,2244,2246,2250,2254,2262,2272,2278,2281,2281,2280,2279,2276,2273,2269,2265,2263,2260,2258,2257,2259,2262,2265,2269,2274,2278,2280,2278,2272,2263,2253,2239,2224,2204,2178,2151,2129,2107,2084,2057,2031,2011,1994,1976,1960,1945,1934,1929,1927,1925,1927,1932,1939,1946,1950,1953,1957,1960,1965,1974,1986,2000,2017,2035,2051,2065,2077,2086,2092,2094,2090,2084,2074,2055,2034,2015,1997,1981,1965,1943,1920,1900,1880,1859,1836,1809,1783,1764,1751,1741,1735,1734,1737,1745,1753,1764,1780,1798,1817,1838,1859,1882,1906,1930,1950,1967,1984,2002,2017,2024,2026,2027,2024,2018,2011,2002,1993,1986,1977,1967,1958,1948,1937,1926,1913,1901,1892,1887,1887,1891,1900,1913,1928,1942,1959,1980,2000,2014,2027,2038,2047,2057,2066,2074,2085,2097,2111,2130,2148,2161,2172,2178,2179,2176,2172,2170,2170,2170,2169,2168,2168,2167,2166,2162,2156,2149,2140,2132,2127,2125,2130,2140,2154,2170,2189,2213,2235,2250,2261,2268,2272,2274,2275,2277,2280,2285,2293,2301,2307,2309,2308,2304,2295,2285,2276,2268,2261,2254,2246,2237,2227,2215,2199,2178,2154,2133,2113,2095,2079,2066,2058,2058,2059,2061,2067,2075,2081,2085,2086,2087,2087,2087,2089,2094,2100,2109,2121,2131,2140,2149,2161,2176,2192,2208,2224,2242,2259,2273,2282,2284,2281,2275,2265,2249,2232,2216,2200,2182,2158,2132,2110,2088,2066,2041,2012,1983,1958,1934,1913,1890,1866,1846,1833,1823,1816,1812,1808,1806,1805,1804,1804,1808,1813,1818,1825,1834,1839,1842,1843,1843,1842,1839,1834,1831,1830,1830,1832,1833,1831,1830,1829,1827,1824,1822,1818,1813,1807,1801,1795,1790,1787,1787,1789,1793,1799,1806,1813,1816,1817,1817,1815,1808,1798,1787,1777,1766,1753,1740,1729,1720,1710,1703,1698,1696,1697,1701,1705,1711,1718,1723,1730,1737,1745,1756,1766,1773,1782,1792,1806,1827,1852,1879,1909,1943,1987,2032,2070,2104,2135,2163,2191,2214,2231,2246,2260,2273,2287,2300,2312,2322,2333,2345,2356,2366,2374,2382,2387,2390,2388,2383,2377,2369,2360,2346,2330,2315,2299,2281,2266,2253,2247,2246,2247,2253,2264,2277,2286,2294,2301,2307,2311,2312,2309,2305,2301,2297,2293,2292,2294,2299,2308,2322,2337,2351,2364,2377,2389,2399,2407,2411,2414,2417,2417,2415,2409,2399,2386,2370,2348,2325,2306,2288,2269,2253,2238,2227,2221,2217,2216,2218,2222,2225,2227,2228,2227,2221,2214,2210,2207,2205,2210,2219,2228,2240,2251,2262,2274,2283,2286,2287,2287,2285,2282,2279,2274,2269,2263,2253,2241,2231,2219,2207,2191,2171,2151,2133,2117,2103,2091,2081,2075,2071,2068,2065,2060,2053,2046,2037,2028,2019,2007,1996,1987,1980,1974,1970,1966,1963,1961,1957,1952,1947,1941,1934,1923,1910,1898,1884,1871,1860,1850,1841,1833,1823,1814,1810,1808,1809,1814,1824,1835,1848,1863,1880,1900,1917,1929,1937,1943,1944,1939,1929,1915,1901,1886,1868,1851,1840,1831,1821,1814,1807,1800,1794,1789,1784,1778,1773,1771,1771,1772,1774,1777,1780,1787,1797,1807,1822,1845,1872,1900,1927,1956,1992,2028,2057,2082,2106,2126,2144,2156,2160,2161,2157,2150,2143,2134,2126,2121,2115,2112,2113,2116,2121,2125,2129,2135,2138,2137,2134,2129,2122,2112,2101,2090,2082,2075,2071,2072,2076,2083,2092,2104,2121,2137,2150,2162,2174,2185,2194,2199,2200,2197,2190,2180,2168,2158,2147,2138,2130,2123,2116,2114,2114,2114,2116,2119,2122,2126,2129,2133,2139,2145,2151,2156,2160,2164,2170,2179,2188,2199,2210,2221,2237,2253,2266,2275,2281,2282,2277,2266,2251,2232,2208,2178,2148,2123,2101,2077,2053,2032,2014,1997,1981,1965,1946,1928,1915,1903,1891,1882,1875,1873,1872,1872,1873,1875,1875,1875,1875,1875,1877,1882,1889,1895,1902,1910,1918,1927,1934,1937,1938,1937,1931,1923,1916,1908,1899,1889,1878,1869,1863,1857,1853,1852,1853,1855,1857,1859,1862,1867,1875,1882,1891,1902,1913,1930,1950,1966,1984,2002,2020,2039,2057,2070,2082,2094,2103,2110,2112,2110,2106,2098,2084,2068,2052,2035,2017,2000,1981,1965,1956,1951,1949,1953,1961,1970,1982,1992,2001,2010,2016,2019,2022,2026,2028,2031,2033,2035,2038,2039,2038,2034,2027,2019,2013,2008,2003,1998,1994,1992,1988,1982,1975,1968,1959,1948,1936,1923,1911,1904,1901,1901,1906,1917,1931,1946,1962,1978,1997,2014,2027,2039,2051,2062,2074,2087,2099,2109,2120,2129,2137,2144,2147,2148,2147,2143,2137,2129,2119,2109,2099,2086,2073,2063,2055,2049,2045,2041,2038,2036,2036,2034,2034,2034,2034,2034,2035,2033,2031,2029,2027,2024,2022,2019,2016,2014,2014,2014,2013,2013,2013,2015,2016,2017,2017,2020,2021,2021,2023,2027,2032,2039,2048,2057,2067,2077,2088,2096,2097,2096,2093,2087,2078,2071,2063,2055,2048,2037,2022,2008,1991,1974,1955,1930,1904,1884,1867,1850,1836,1823,1814,1812,1814,1816,1823,1833,1842,1851,1859,1867,1878,1890,1900,1911,1924,1939,1958,1974,1984,1993,2001,2006,2008,2007,2004,2001,1996,1989,1982,1975,1971,1967,1964,1962,1962,1964,1966,1968,1970,1972,1977,1982,1987,1992,1999,2006,2010,2012,2012,2009,2004,1997,1990,1983,1975,1967,1958,1948,1936,1924,1909,1891,1873,1857,1841,1827,1814,1801,1787,1779,1772,1764,1761,1760,1762,1767,1771,1778,1792,1809,1826,1844,1864,1887,1914,1941,1965,1987,2010,2034,2054,2069,2082,2094,2103,2109,2112,2113,2112,2110,2107,2104,2102,2099,2096,2092,2087,2083,2081,2081,2082,2087,2096,2107,2120,2131,2141,2153,2161,2164,2164,2163,2161,2158,2155,2155,2155,2157,2162,2169,2178,2187,2197,2208,2220,2230,2239,2246,2253,2260,2267,2273,2276,2276,2274,2269,2257,2243,2228,2215,2203,2191,2183,2180,2179,2180,2181,2182,2182,2181,2180,2179,2176,2171,2166,2161,2157,2150,2141,2133,2128,2126,2124,2123,2124,2128,2133,2141,2148,2156,2167,2180,2190,2199,2206,2212,2216,2216,2211,2204,2194,2181,2170,2160,2151,2143,2134,2125,2115,2106,2097,2086,2073,2057,2042,2028,2014,1998,1981,1965,1954,1946,1939,1934,1931,1933,1939,1948,1960,1979,1997,2014,2030,2043,2053,2061,2064,2061,2057,2051,2045,2042,2044,2049,2059,2072,2090,2110,2129,2146,2160,2172,2182,2188,2190,2189,2186,2181,2173,2164,2153,2139,2123,2103,2084,2068,2054,2046,2043,2046,2052,2061,2070,2079,2085,2087,2082,2072,2060,2046,2029,2013,2002,1996,1991,1989,1990,1992,1998,2006,2015,2027,2041,2054,2066,2079,2092,2107,2121,2132,2139,2144,2146,2145,2143,2140,2137,2137,2142,2153,2166,2181,2196,2213,2232,2249,2258,2263,2265,2263,2257,2247,2236,2225,2213,2198,2185,2175,2167,2161,2156,2148,2139,2130,2122,2112,2100,2089,2080,2073,2067,2064,2061,2059,2058,2057,2057,2058,2059,2062,2065,2069,2074,2079,2084,2086,2085,2084,2081,2072,2061,2050,2038,2027,2018,2008,2002,2002,2005,2011,2022,2034,2047,2061,2075,2090,2107,2125,2139,2152,2164,2174,2182,2189,2191,2190,2186,2175,2161,2148,2131,2113,2093,2068,2044,2024,2005,1987,1971,1952,1932,1915,1900,1886,1869,1852,1838,1827,1817,1810,1807,1807,1813,1822,1833,1849,1870,1890,1908,1924,1940,1959,1976,1988,1998,2008,2017,2026,2033,2036,2037,2035,2032,2027,2021,2016,2010,2004,1998,1991,1985,1978,1970,1961,1951,1942,1937,1934,1932,1935,1941,1950,1961,1974,1988,2004,2022,2036,2048,2057,2063,2066,2065,2059,2050,2037,2018,1999,1982,1968,1955,1945,1939,1940,1947,1959,1974,1994,2022,2050,2073,2091,2110,2129,2146,2160,2171,2183,2197,2213,2229,2242,2252,2264,2275,2285,2293,2298,2303,2307,2309,2307,2299,2287,2271,2252,2224,2191,2161,2133,2106,2079,2053,2033,2024,2019,2018,2024,2034,2043,2053,2062,2068,2073,2076,2076,2076,2075,2072,2068,2066,2064,2062,2058,2052,2044,2036,2029,2022,2014,2003,1992,1983,1974,1962,1947,1930,1914,1899,1884,1873,1867,1867,1874,1890,1912,1943,1982,2024,2059,2087,2111,2128,2135,2132,2123,2110,2093,2071,2052,2038,2028,2019,2013,2007,1999,1990,1981,1969,1953,1937,1924,1913,1904,1898,1894,1892,1891,1889,1887,1887,1892,1901,1914,1930,1952,1985,2019,2048,2074,2096,2113,2122,2124,2118,2106,2091,2070,2043,2014,1988,1964,1940,1913,1887,1865,1846,1827,1810,1793,1778,1768,1763,1760,1761,1769,1781,1793,1806,1820,1838,1857,1874,1891,1911,1933,1961,1989,2012,2033,2054,2073,2088,2098,2104,2109,2110,2107,2103,2096,2087,2077,2064,2048,2031,2017,2004,1990,1974,1960,1950,1941,1935,1931,1930,1933,1940,1952,1965,1978,1993,2009,2022,2033,2043,2055,2066,2074,2082,2090,2100,2111,2122,2130,2139,2148,2156,2165,2173,2178,2184,2187,2187,2185,2180,2173,2165,2154,2142,2131,2122,2115,2109,2103,2099,2098,2098,2101,2103,2103,2100,2095,2088,2079,2067,2050,2032,2016,2002,1989,1978,1971,1967,1968,1970,1974,1984,1997,2009,2022,2035,2051,2069,2087,2100,2109,2117,2120,2119,2113,2107,2100,2095,2090,2086,2087,2090,2094,2100,2106,2110,2110,2107,2103,2092,2079,2067,2055,2042,2032,2023,2018,2017,2018,2020,2022,2026,2033,2040,2045,2052,2062,2073,2084,2094,2105,2116,2125,2131,2134,2136,2136,2133,2127,2123,2119,2114,2108,2101,2093,2085,2074,2063,2050,2033,2015,2000,1987,1974,1964,1957,1953,1954,1958,1965,1975,1987,1998,2009,2020,2031,2044,2056,2064,2071,2076,2080,2082,2081,2079,2078,2075,2071,2066,2062,2058,2053,2048,2044,2041,2037,2033,2029,2026,2024,2021,2019,2017,2015,2014,2013,2014,2016,2017,2020,2024,2028,2031,2037,2044,2054,2065,2075,2087,2100,2113,2125,2136,2142,2146,2149,2148,2143,2134,2124,2115,2104,2092,2085,2080,2078,2077,2078,2082,2087,2092,2097,2103,2109,2118,2128,2139,2149,2161,2175,2188,2198,2205,2212,2218,2224,2230,2236,2242,2248,2254,2260,2267,2271,2271,2268,2261,2248,2234,2218,2199,2180,2158,2139,2125,2115,2106,2101,2100,2102,2105,2110,2117,2128,2141,2157,2174,2190,2206,2221,2233,2239,2241,2240,2236,2230,2223,2216,2210,2203,2196,2190,2186,2182,2177,2170,2158,2144,2129,2112,2094,2073,2048,2023,2003,1986,1971,1957,1945,1938,1932,1928,1926,1926,1929,1935,1942,1951,1963,1974,1982,1989,1994,1995,1993,1990,1985,1979,1972,1964,1955,1948,1941,1934,1928,1923,1918,1915,1911,1905,1899,1889,1878,1870,1862,1854,1849,1845,1845,1849,1855,1862,1872,1883,1893,1901,1908,1916,1923,1929,1932,1935,1937,1940,1943,1946,1947,1949,1951,1953,1955,1959,1963,1967,1973,1981,1990,1997,2002,2007,2012,2016,2017,2017,2017,2018,2019,2021,2024,2029,2034,2041,2048,2054,2058,2062,2065,2068,2073,2076,2079,2083,2086,2088,2090,2090,2089,2086,2081,2076,2071,2067,2066,2066,2069,2071,2073,2074,2075,2076,2076,2076,2077,2080,2083,2089,2097,2107,2116,2125,2134,2143,2149,2152,2153,2153,2150,2146,2142,2140,2140,2143,2148,2156,2167,2175,2183,2190,2194,2197,2200,2202,2203,2203,2203,2202,2202,2199,2194,2186,2175,2163,2153,2143,2132,2122,2113,2106,2102,2097,2094,2092,2090,2089,2089,2090,2091,2092,2092,2094,2096,2099,2105,2112,2118,2124,2131,2136,2139,2141,2141,2140,2139,2135,2128,2120,2110,2100,2085,2065,2043,2025,2008,1991,1975,1958,1944,1934,1927,1920,1916,1912,1908,1904,1899,1893,1886,1879,1872,1867,1863,1863,1868,1878,1892,1907,1926,1949,1970,1987,2000,2009,2016,2018,2017,2015,2010,2004,1996,1986,1975,1966,1957,1947,1935,1923,1911,1902,1894,1888,1887,1889,1893,1898,1903,1908,1914,1918,1921,1923,1926,1930,1934,1939,1945,1953,1962,1974,1987,1999,2011,2021,2031,2041,2049,2052,2054,2052,2048,2042,2036,2029,2022,2015,2007,2001,1995,1989,1985,1982,1980,1980,1982,1984,1988,1994,1999,2003,2007,2011,2016,2023,2031,2038,2046,2056,2068,2081,2095,2107,2117,2128,2138,2147,2151,2152,2152,2148,2142,2134,2125,2116,2107,2097,2086,2074,2062,2050,2038,2024,2012,2005,2002,2000,2002,2006,2013,2021,2029,2038,2047,2055,2061,2070,2078,2088,2101,2116,2130,2147,2165,2183,2203,2222,2235,2245,2254,2259,2262,2262,2258,2254,2248,2239,2230,2219,2207,2194,2179,2160,2141,2126,2113,2102,2092,2085,2081,2079,2078,2079,2080,2082,2086,2090,2096,2104,2115,2127,2139,2151,2162,2173,2181,2184,2183,2179,2173,2165,2157,2150,2143,2138,2133,2129,2124,2118,2112,2103,2088,2070,2055,2039,2023,2009,1995,1983,1976,1972,1970,1969,1967,1964,1963,1962,1961,1962,1965,1969,1976,1984,1994,2006,2016,2023,2028,2032,2036,2039,2040,2041,2041,2041,2040,2040,2038,2034,2029,2022,2012,2001,1990,1981,1972,1961,1952,1947,1946,1946,1949,1956,1964,1972,1979,1986,1993,2001,2009,2016,2022,2029,2037,2044,2050,2055,2058,2060,2062,2065,2068,2071,2075,2078,2082,2085,2087,2089,2089,2085,2081,2076,2069,2061,2051,2037,2023,2011,2002,1994,1989,1988,1992,1997,2003,2010,2021,2031,2040,2049,2057,2065,2076,2086,2094,2102,2108,2114,2120,2126,2130,2132,2134,2137,2139,2140,2140,2139,2137,2133,2128,2122,2115,2107,2098,2086,2073,2062,2052,2041,2029,2017,2008,2001,1996,1994,1995,2000,2008,2019,2032,2051,2071,2087,2103,2118,2132,2147,2161,2172,2182,2192,2200,2209,2215,2218,2219,2219,2214,2208,2200,2190,2180,2171,2160,2151,2146,2141,2136,2132,2127,2122,2116,2110,2104,2099,2097,2098,2101,2106,2113,2122,2131,2139,2145,2150,2155,2160,2163,2164,2165,2164,2158,2150,2139,2126,2112,2095,2073,2051,2033,2015,1998,1981,1963,1946,1935,1925,1915,1906,1898,1893,1890,1887,1884,1883,1884,1888,1895,1903,1913,1927,1940,1951,1961,1971,1982,1992,1999,2004,2008,2010,2007,2001,1992,1980,1967,1952,1931,1911,1891,1872,1853,1832,1811,1795,1782,1771,1763,1757,1755,1757,1760,1763,1766,1769,1771,1773,1774,1776,1780,1784,1790,1797,1805,1815,1827,1841,1854,1867,1882,1900,1919,1935,1949,1964,1977,1992,2005,2014,2021,2025,2026,2027,2027,2025,2024,2024,2023,2024,2026,2028,2031,2035,2039,2043,2046,2049,2051,2052,2053,2056,2058,2061,2064,2069,2074,2077,2079,2080,2080,2079,2079,2080,2082,2083,2085,2087,2090,2091,2092,2092,2089,2087,2087,2087,2089,2092,2097,2103,2108,2112,2115,2116,2116,2113,2108,2103,2099,2095,2093,2092,2092,2094,2098,2103,2109,2115,2118,2122,2126,2129,2131,2133,2136,2141,2149,2157,2164,2170,2175,2178,2178,2174,2167,2160,2151,2141,2134,2131,2130,2131,2133,2136,2138,2141,2143,2145,2147,2149,2152,2155,2159,2162,2165,2169,2171,2171,2170,2169,2164,2159,2155,2149,2143,2137,2130,2124,2116,2108,2098,2085,2069,2052,2036,2018,2000,1981,1964,1952,1944,1937,1931,1926,1923,1923,1924,1926,1932,1942,1954,1967,1983,2000,2020,2040,2055,2067,2077,2085,2089,2091,2090,2089,2087,2084,2083,2082,2079,2076,2072,2065,2058,2049,2040,2030,2017,2001,1983,1967,1952,1937,1923,1910,1901,1896,1892,1890,1890,1894,1900,1909,1921,1937,1955,1972,1988,2002,2016,2030,2040,2048,2055,2062,2069,2079,2092,2104,2117,2130,2144,2157,2165,2169,2171,2171,2168,2163,2155,2147,2139,2130,2120,2110,2102,2094,2086,2078,2070,2066,2063,2063,2065,2072,2082,2093,2103,2113,2123,2133,2141,2145,2149,2153,2157,2163,2168,2174,2180,2187,2194,2201,2204,2207,2210,2211,2211,2209,2204,2198,2190,2178,2164,2152,2141,2132,2122,2113,2106,2102,2099,2098,2096,2096,2097,2099,2101,2104,2109,2115,2120,2125,2129,2133,2136,2138,2140,2142,2144,2148,2152,2157,2161,2165,2170,2173,2175,2174,2171,2168,2161,2151,2140,2130,2121,2112,2102,2092,2085,2078,2070,2062,2053,2043,2037,2031,2026,2022,2018,2015,2014,2013,2011,2009,2006,2003,2001,1999,1997,1998,2001,2006,2013,2021,2029,2038,2046,2051,2055,2058,2058,2058,2059,2059,2058,2056,2052,2048,2044,2040,2035,2030,2024,2018,2014,2011,2006,2003,2001,2001,1999,1996,1993,1990,1987,1984,1980,1977,1976,1976,1979,1982,1986,1991,1998,2005,2010,2015,2020,2024,2029,2033,2036,2039,2042,2044,2046,2045,2042,2039,2035,2030,2024,2018,2012,2008,2004,2001,2000,2002,2005,2009,2016,2023,2028,2032,2035,2039,2044,2051,2058,2066,2075,2085,2096,2105,2111,2116,2120,2121,2123,2125,2126,2127,2127,2126,2125,2123,2121,2117,2113,2109,2106,2104,2103,2104,2108,2115,2124,2134,2145,2157,2173,2189,2201,2210,2218,2226,2235,2244,2249,2254,2260,2266,2270,2271,2269,2267,2263,2254,2244,2234,2224,2214,2202,2185,2167,2151,2137,2123,2106,2090,2078,2068,2060,2053,2047,2043,2043,2045,2049,2054,2062,2072,2082,2090,2098,2106,2111,2115,2117,2119,2119,2120,2121,2123,2124,2125,2125,2121,2112,2102,2090,2076,2059,2041,2026,2013,2002,1994,1987,1983,1982,1981,1980,1980,1982,1984,1986,1989,1994,2001,2009,2015,2019,2022,2023,2022,2018,2011,2004,1995,1986,1977,1969,1963,1957,1953,1949,1944,1941,1936,1930,1921,1908,1893,1881,1871,1859,1849,1842,1840,1841,1844,1848,1856,1867,1878,1890,1901,1913,1928,1943,1954,1962,1970,1975,1979,1979,1977,1975,1970,1964,1957,1952,1946,1941,1937,1933,1930,1929,1928,1927,1926,1924,1920,1915,1910,1903,1894,1888,1883,1881,1879,1878,1879,1881,1884,1887,1891,1896,1900,1904,1907,1911,1915,1919,1922,1924,1925,1925,1924,1924,1924,1924,1926,1928,1933,1938,1943,1948,1953,1958,1962,1965,1966,1967,1967,1966,1965,1966,1969,1975,1981,1990,1999,2007,2014,2021,2027,2033,2039,2044,2048,2053,2057,2060,2061,2059,2055,2051,2043,2035,2027,2021,2017,2015,2016,2019,2024,2030,2036,2044,2051,2057,2061,2064,2065,2065,2064,2062,2059,2056,2052,2045,2038,2032,2025,2017,2010,2002,1998,1995,1993,1994,1997,2001,2005,2009,2012,2015,2018,2019,2019,2019,2018,2017,2015,2013,2013,2014,2016,2021,2026,2031,2035,2040,2044,2048,2051,2053,2055,2056,2057,2056,2054,2050,2045,2039,2029,2017,2004,1992,1980,1967,1955,1948,1943,1939,1937,1936,1935,1936,1935,1933,1931,1927,1924,1922,1921,1920,1922,1925,1929,1935,1941,1948,1957,1965,1971,1977,1983,1988,1994,1998,2002,2004,2006,2007,2007,2007,2007,2007,2008,2010,2013,2017,2022,2028,2035,2041,2047,2051,2054,2054,2052,2047,2042,2036,2029,2021,2012,2002,1994,1988,1981,1976,1973,1972,1972,1973,1976,1981,1985,1989,1991,1994,1996,1998,1999,2001,2002,2004,2007,2012,2018,2026,2034,2045,2057,2069,2080,2090,2100,2110,2120,2128,2133,2138,2142,2144,2145,2144,2143,2140,2136,2130,2123,2116,2110,2105,2101,2098,2096,2095,2095,2094,2092,2089,2086,2083,2079,2076,2073,2072,2074,2078,2084,2093,2104,2115,2125,2133,2141,2149,2156,2160,2164,2167,2169,2170,2171,2173,2173,2173,2173,2172,2170,2169,2167,2163,2157,2151,2145,2140,2135,2130,2125,2120,2115,2109,2103,2097,2090,2084,2080,2077,2074,2075,2078,2084,2092,2100,2110,2121,2132,2141,2150,2157,2163,2167,2170,2170,2169,2168,2165,2161,2157,2153,2150,2144,2137,2129,2122,2115,2109,2102,2093,2083,2073,2062,2049,2033,2015,1998,1982,1967,1954,1941,1931,1926,1923,1922,1924,1927,1930,1934,1936,1939,1942,1946,1949,1952,1956,1961,1967,1972,1975,1976,1977,1977,1976,1974,1971,1967,1963,1958,1953,1948,1943,1938,1935,1932,1928,1925,1922,1920,1916,1914,1914,1916,1919,1923,1929,1936,1943,1950,1958,1965,1977,1989,2001,2013,2026,2041,2057,2069,2077,2084,2090,2094,2096,2097,2097,2097,2094,2089,2083,2078,2071,2063,2052,2042,2033,2026,2018,2010,2002,1995,1990,1987,1985,1987,1990,1994,1999,2003,2008,2015,2022,2029,2038,2049,2064,2082,2101,2117,2131,2144,2155,2164,2170,2172,2173,2173,2171,2169,2166,2165,2164,2162,2159,2157,2155,2154,2152,2148,2144,2140,2136,2132,2130,2129,2129,2131,2133,2134,2136,2136,2136,2136,2135,2135,2138,2143,2150,2158,2167,2176,2187,2194,2198,2200,2200,2197,2192,2186,2180,2175,2171,2167,2163,2160,2158,2157,2157,2158,2161,2164,2167,2170,2175,2181,2187,2192,2195,2198,2199,2199,2198,2194,2189,2182,2171,2159,2148,2137,2126,2114,2102,2088,2076,2064,2050,2032,2013,1996,1981,1969,1957,1946,1936,1930,1927,1923,1919,1916,1912,1911,1910,1912,1916,1922,1929,1936,1944,1953,1964,1973,1980,1986,1990,1993,1994,1993,1991,1988,1985,1983,1980,1979,1979,1979,1979,1979,1977,1974,1971,1967,1964,1962,1963,1967,1971,1977,1983,1988,1991,1992,1992,1992,1990,1989,1988,1987,1988,1989,1990,1992,1993,1993,1992,1988,1983,1978,1973,1966,1960,1955,1951,1951,1951,1954,1961,1971,1980,1989,1999,2008,2020,2030,2039,2047,2056,2066,2078,2089,2097,2103,2108,2111,2111,2110,2108,2106,2103,2099,2095,2091,2085,2079,2070,2059,2047,2036,2025,2013,1999,1988,1980,1975,1971,1969,1971,1975,1981,1987,1993,2000,2008,2015,2021,2025,2029,2035,2041,2047,2053,2059,2064,2067,2068,2067,2065,2062,2058,2052,2047,2042,2039,2034,2031,2029,2026,2023,2021,2018,2015,2013,2010,2009,2008,2009,2011,2015,2021,2026,2033,2040,2047,2053,2058,2062,2065,2065,2063,2060,2056,2052,2046,2039,2033,2027,2022,2016,2009,2000,1992,1984,1975,1966,1956,1946,1938,1932,1927,1922,1917,1914,1911,1908,1905,1902,1899,1899,1899,1900,1903,1908,1913,1918,1923,1929,1935,1942,1947,1951,1955,1959,1963,1967,1969,1971,1972,1973,1974,1974,1974,1973,1974,1976,1980,1985,1990,1996,2003,2010,2017,2022,2026,2029,2030,2029,2028,2026,2023,2020,2016,2013,2010,2007,2004,1999,1995,1991,1987,1984,1982,1981,1981,1982,1982,1982,1982,1982,1981,1980,1978,1976,1975,1975,1976,1978,1981,1986,1992,2000,2007,2013,2019,2026,2033,2038,2043,2047,2050,2053,2057,2059,2062,2064,2065,2067,2070,2072,2074,2077,2080,2085,2090,2095,2099,2104,2109,2114,2119,2124,2129,2133,2138,2142,2145,2147,2149,2150,2151,2151,2151,2152,2152,2153,2152,2152,2150,2148,2144,2138,2130,2122,2113,2103,2093,2081,2071,2062,2056,2050,2045,2039,2035,2032,2028,2025,2022,2020,2020,2021,2025,2032,2041,2051,2062,2072,2084,2097,2111,2121,2129,2138,2145,2152,2158,2162,2165,2167,2168,2168,2166,2163,2159,2152,2142,2130,2119,2107,2094,2081,2067,2054,2045,2037,2031,2024,2015,2007,2000,1993,1987,1980,1974,1970,1969,1968,1969,1973,1978,1984,1989,1994,1999,2005,2010,2013,2014,2016,2018,2021,2023,2026,2029,2031,2032,2031,2028,2025,2020,2014,2009,2006,2004,2004,2005,2007,2009,2011,2012,2013,2013,2012,2011,2009,2008,2007,2005,2004,2003,2001,1999,1996,1991,1985,1979,1971,1964,1955,1946,1937,1932,1928,1925,1925,1926,1930,1935,1940,1946,1952,1956,1960,1963,1966,1968,1971,1974,1977,1980,1984,1988,1992,1995,1997,1998,1999,2000,2001,2003,2004,2006,2009,2013,2019,2025,2030,2034,2039,2043,2044,2043,2041,2038,2036,2036,2037,2039,2044,2050,2058,2065,2070,2073,2075,2076,2075,2074,2074,2074,2075,2076,2078,2079,2079,2079,2078,2076,2072,2068,2064,2061,2057,2054,2052,2052,2053,2056,2062,2069,2076,2082,2088,2094,2100,2105,2109,2112,2116,2120,2125,2128,2131,2133,2134,2133,2130,2126,2121,2116,2110,2105,2100,2097,2094,2092,2090,2088,2086,2086,2085,2084,2081,2079,2076,2073,2070,2066,2062,2058,2055,2052,2050,2048,2047,2048,2049,2051,2053,2055,2058,2061,2063,2065,2066,2067,2068,2068,2067,2067,2067,2067,2068,2069,2071,2074,2077,2080,2084,2087,2091,2096,2100,2104,2107,2109,2110,2109,2105,2099,2091,2082,2071,2057,2043,2032,2022,2013,2004,1996,1989,1984,1979,1974,1970,1968,1968,1969,1970,1973,1976,1980,1984,1987,1990,1993,1998,2001,2005,2008,2012,2016,2021,2026,2030,2035,2041,2046,2049,2051,2051,2050,2047,2041,2036,2030,2024,2018,2011,2004,1998,1993,1987,1981,1974,1967,1961,1956,1952,1949,1947,1948,1950,1952,1955,1958,1962,1966,1970,1973,1978,1984,1990,1997,2004,2013,2026,2039,2053,2065,2076,2088,2100,2110,2117,2123,2128,2134,2139,2144,2150,2155,2161,2167,2172,2175,2177,2178,2178,2176,2173,2169,2165,2159,2152,2144,2135,2127,2119,2110,2101,2093,2086,2081,2077,2072,2068,2066,2066,2066,2068,2071,2076,2080,2083,2086,2089,2092,2095,2097,2100,2103,2107,2113,2119,2125,2129,2134,2138,2141,2141,2140,2139,2135,2129,2122,2114,2107,2098,2089,2077,2063,2051,2041,2030,2018,2007,2000,1994,1991,1989,1990,1992,1995,1998,2001,2004,2006,2007,2007,2008,2009,2011,2016,2021,2028,2035,2042,2049,2054,2058,2059,2058,2056,2051,2047,2042,2038,2032,2025,2017,2010,2003,1994,1982,1969,1955,1943,1934,1925,1916,1910,1908,1907,1908,1910,1913,1916,1919,1921,1923,1926,1930,1935,1940,1947,1955,1967,1980,1991,2001,2010,2018,2026,2032,2035,2036,2036,2036,2034,2031,2028,2026,2023,2019,2014,2010,2005,2000,1994,1988,1983,1980,1980,1980,1983,1987,1993,1999,2005,2011,2016,2021,2024,2027,2031,2035,2040,2046,2053,2059,2066,2073,2081,2088,2092,2095,2097,2098,2098,2098,2098,2097,2096,2094,2092,2089,2086,2082,2076,2070,2063,2058,2052,2046,2041,2038,2036,2036,2036,2037,2038,2041,2044,2046,2049,2052,2055,2059,2062,2066,2071,2077,2083,2088,2092,2096,2099,2103,2107,2109,2111,2112,2115,2117,2120,2123,2127,2130,2134,2138,2142,2145,2148,2150,2151,2151,2150,2150,2149,2148,2146,2144,2142,2140,2138,2135,2133,2131,2129,2129,2130,2131,2132,2132,2132,2130,2127,2123,2119,2114,2110,2104,2099,2095,2092,2091,2090,2090,2090,2091,2092,2094,2096,2099,2101,2103,2104,2106,2106,2106,2104,2102,2100,2098,2095,2092,2088,2085,2084,2082,2080,2077,2074,2070,2066,2061,2054,2045,2036,2028,2019,2008,1998,1989,1981,1972,1964,1956,1949,1944,1940,1936,1934,1934,1935,1937,1938,1940,1943,1945,1946,1948,1949,1950,1952,1954,1956,1960,1964,1969,1975,1982,1988,1994,2000,2007,2013,2018,2022,2024,2026,2027,2027,2026,2024,2021,2017,2013,2009,2006,2004,2002,2001,2002,2005,2008,2011,2017,2023,2030,2035,2039,2043,2046,2048,2049,2050,2051,2053,2056,2059,2062,2064,2066,2068,2070,2070,2071,2071,2071,2071,2070,2069,2067,2065,2061,2054,2046,2036,2027,2018,2008,1999,1992,1988,1987,1988,1991,1996,2001,2006,2010,2014,2018,2021,2024,2026,2029,2033,2038,2043,2048,2053,2057,2060,2062,2062,2061,2059,2057,2054,2052,2050,2048,2046,2044,2041,2038,2035,2031,2026,2020,2015,2011,2008,2007,2007,2009,2013,2019,2026,2032,2040,2048,2056,2062,2067,2071,2076,2080,2084,2087,2090,2093,2095,2096,2096,2094,2092,2087,2080,2072,2065,2058,2050,2043,2035,2030,2027,2023,2020,2017,2014,2011,2010,2008,2007,2008,2012,2016,2022,2031,2042,2052,2061,2068,2074,2080,2084,2087,2088,2088,2088,2086,2084,2082,2080,2078,2076,2073,2071,2068,2065,2062,2058,2052,2046,2040,2034,2028,2021,2014,2008,2002,1998,1994,1990,1988,1987,1987,1988,1989,1993,1998,2002,2006,2011,2016,2021,2025,2028,2030,2032,2033,2033,2034,2034,2034,2033,2033,2035,2038,2042,2047,2054,2061,2068,2073,2077,2081,2083,2084,2083,2082,2079,2075,2071,2067,2063,2060,2056,2053,2049,2047,2045,2044,2043,2042,2041,2041,2041,2040,2040,2038,2036,2034,2032,2030,2028,2026,2024,2024,2023,2025,2030,2036,2043,2051,2058,2066,2074,2081,2087,2091,2095,2098,2101,2103,2105,2107,2110,2114,2118,2121,2123,2124,2125,2126,2126,2127,2128,2129,2132,2134,2136,2138,2138,2138,2136,2132,2128,2123,2117,2108,2100,2094,2090,2086,2084,2083,2083,2083,2082,2081,2078,2073,2068,2063,2059,2055,2051,2049,2049,2050,2052,2056,2060,2063,2067,2070,2073,2078,2083,2088,2094,2099,2106,2113,2120,2125,2128,2131,2131,2130,2126,2120,2114,2107,2099,2090,2081,2075,2069,2061,2053,2044,2036,2028,2020,2012,2003,1995,1989,1985,1982,1980,1979,1979,1981,1983,1985,1989,1994,1999,2005,2011,2017,2025,2031,2036,2039,2041,2042,2040,2037,2032,2027,2021,2014,2007,2001,1996,1991,1987,1983,1979,1975,1971,1967,1963,1959,1957,1955,1954,1955,1957,1958,1960,1963,1965,1968,1972,1977,1981,1986,1992,1999,2007,2015,2022,2030,2039,2048,2057,2064,2068,2072,2075,2076,2075,2073,2072,2069,2067,2065,2064,2064,2065,2065,2065,2064,2063,2061,2060,2058,2056,2056,2056,2056,2058,2060,2063,2066,2069,2072,2077,2083,2090,2097,2103,2111,2119,2129,2139,2147,2152,2157,2160,2162,2162,2162,2161,2158,2155,2152,2150,2148,2146,2145,2144,2143,2142,2141,2140,2138,2137,2136,2135,2134,2134,2134,2134,2134,2133,2132,2131,2130,2129,2129,2130,2132,2135,2139,2143,2147,2150,2153,2155,2156,2154,2152,2147,2140,2131,2122,2114,2106,2096,2087,2079,2073,2069,2066,2064,2063,2064,2065,2066,2068,2070,2072,2075,2076,2077,2078,2079,2079,2079,2079,2079,2079,2081,2084,2087,2090,2093,2096,2099,2100,2101,2101,2100,2099,2096,2093,2090,2086,2081,2075,2067,2061,2055,2050,2046,2042,2041,2040,2040,2042,2046,2050,2055,2059,2064,2068,2072,2073,2073,2071,2068,2063,2057,2052,2048,2045,2041,2037,2033,2030,2027,2024,2020,2015,2011,2007,2004,2001,1999,1996,1995,1994,1994,1994,1996,1999,2003,2007,2013,2021,2029,2036,2043,2051,2058,2067,2074,2080,2083,2086,2088,2088,2086,2083,2080,2076,2072,2068,2064,2061,2058,2055,2052,2048,2044,2039,2035,2030,2025,2020,2016,2013,2009,2006,2004,2003,2003,2004,2006,2011,2017,2024,2033,2042,2052,2066,2081,2094,2104,2115,2127,2137,2143,2146,2149,2150,2150,2149,2147,2144,2142,2139,2135,2131,2127,2123,2117,2109,2100,2091,2082,2074,2065,2057,2049,2043,2037,2033,2028,2024,2021,2019,2017,2017,2017,2019,2022,2026,2031,2037,2044,2051,2057,2062,2065,2066,2065,2062,2058,2054,2049,2043,2037,2032,2027,2022,2016,2009,2003,1996,1990,1984,1978,1974,1972,1971,1971,1972,1975,1979,1982,1986,1990,1995,2001,2008,2014,2020,2026,2034,2040,2045,2048,2050,2051,2049,2046,2042,2036,2031,2024,2015,2006,1999,1993,1986,1978,1970,1964,1960,1956,1954,1952,1951,1952,1953,1956,1959,1963,1968,1973,1977,1982,1988,1995,2000,2005,2011,2017,2024,2031,2037,2041,2045,2048,2051,2051,2050,2048,2044,2039,2033,2026,2020,2014,2007,2000,1993,1988,1985,1982,1979,1978,1978,1979,1981,1984,1987,1991,1995,1999,2001,2004,2006,2009,2010,2012,2013,2015,2018,2021,2025,2028,2033,2039,2045,2051,2056,2061,2066,2071,2074,2076,2076,2076,2075,2074,2074,2074,2074,2074,2075,2077,2078,2080,2081,2082,2083,2083,2083,2084,2083,2083,2082,2081,2080,2078,2076,2074,2072,2069,2068,2068,2068,2069,2072,2076,2079,2085,2092,2099,2105,2110,2115,2118,2120,2121,2120,2118,2117,2115,2112,2109,2107,2106,2103,2100,2097,2094,2092,2089,2086,2082,2080,2077,2075,2073,2071,2069,2067,2065,2064,2062,2062,2062,2063,2064,2066,2070,2075,2080,2085,2090,2094,2097,2099,2100,2099,2096,2093,2088,2083,2079,2075,2072,2068,2063,2057,2052,2046,2038,2030,2022,2016,2012,2009,2007,2006,2006,2008,2011,2015,2018,2022,2026,2029,2031,2032,2034,2036,2038,2041,2044,2048,2052,2056,2059,2061,2061,2060,2056,2051,2045,2039,2032,2023,2015,2007,2001,1994,1987,1979,1972,1965,1961,1957,1955,1954,1954,1955,1957,1960,1964,1969,1974,1979,1984,1989,1994,1998,2000,2002,2004,2006,2009,2012,2015,2018,2022,2025,2027,2028,2028,2026,2024,2019,2014,2010,2005,2000,1995,1989,1984,1979,1975,1972,1969,1966,1965,1965,1966,1967,1969,1972,1974,1977,1979,1982,1985,1989,1991,1993,1996,1999,2003,2008,2013,2018,2024,2032,2039,2044,2047,2049,2050,2050,2049,2047,2046,2044,2044,2043,2043,2044,2045,2046,2047,2048,2049,2050,2052,2055,2058,2061,2064,2067,2070,2073,2075,2077,2079,2081,2083,2084,2086,2088,2089,2091,2094,2098,2103,2107,2112,2117,2122,2126,2128,2130,2130,2130,2128,2126,2124,2123,2123,2123,2125,2126,2128,2129,2132,2134,2137,2139,2141,2143,2146,2148,2150,2151,2151,2150,2147,2144,2141,2138,2136,2132,2128,2125,2122,2120,2118,2117,2115,2113,2111,2109,2105,2102,2098,2094,2089,2085,2080,2075,2070,2066,2062,2058,2055,2052,2049,2048,2047,2046,2046,2047,2048,2049,2050,2051,2050,2049,2048,2047,2046,2045,2044,2044,2045,2045,2046,2046,2046,2046,2046,2047,2047,2047,2046,2046,2045,2044,2043,2041,2039,2036,2033,2030,2025,2021,2018,2015,2013,2012,2011,2010,2010,2011,2012,2013,2014,2015,2015,2015,2014,2012,2010,2007,2005,2003,2001,1999,1997,1996,1995,1996,1998,2001,2004,2008,2013,2018,2024,2030,2036,2041,2046,2051,2055,2058,2060,2062,2064,2066,2069,2072,2075,2078,2082,2085,2087,2088,2088,2087,2084,2081,2077,2072,2068,2064,2060,2057,2054,2052,2050,2047,2044,2042,2041,2040,2040,2042,2045,2048,2053,2057,2061,2066,2070,2074,2077,2079,2083,2087,2092,2098,2104,2112,2121,2131,2138,2144,2148,2150,2149,2146,2141,2134,2127,2119,2110,2101,2094,2089,2084,2078,2073,2068,2064,2060,2055,2050,2046,2042,2040,2039,2038,2038,2039,2040,2042,2044,2046,2050,2053,2057,2061,2067,2074,2082,2089,2096,2101,2105,2107,2107,2104,2099,2093,2084,2073,2064,2056,2049,2041,2033,2026,2021,2017,2013,2008,2003,1998,1994,1991,1989,1986,1985,1985,1985,1986,1986,1987,1987,1988,1988,1990,1991,1994,1997,2001,2004,2007,2010,2012,2013,2011,2009,2006,2000,1994,1989,1984,1980,1976,1973,1972,1972,1973,1974,1976,1978,1978,1979,1979,1979,1979,1978,1978,1978,1979,1981,1983,1985,1987,1988,1989,1990,1991,1991,1990,1990,1990,1989,1989,1989,1988,1988,1988,1988,1988,1987,1987,1988,1989,1992,1995,2000,2005,2012,2021,2030,2039,2047,2055,2064,2071,2076,2080,2082,2083,2084,2084,2083,2082,2081,2080,2079,2078,2077,2076,2075,2073,2072,2071,2070,2069,2068,2068,2068,2068,2068,2069,2071,2074,2078,2081,2084,2087,2091,2094,2097,2099,2101,2103,2105,2106,2108,2108,2108,2108,2107,2106,2104,2101,2099,2096,2093,2091,2089,2087,2086,2084,2083,2081,2080,2080,2079,2079,2079,2079,2079,2080,2081,2084,2087,2091,2095,2101,2107,2113,2118,2122,2127,2131,2134,2135,2137,2137,2137,2135,2132,2128,2124,2119,2113,2106,2099,2094,2090,2085,2081,2078,2077,2076,2074,2072,2070,2068,2066,2064,2062,2060,2057,2055,2054,2052,2051,2050,2049,2048,2049,2049,2050,2051,2051,2051,2051,2052,2052,2052,2051,2051,2050,2049,2047,2045,2043,2041,2040,2039,2039,2039,2040,2040,2041,2042,2043,2043,2042,2040,2038,2036,2033,2031,2029,2027,2025,2023,2020,2018,2016,2013,2011,2010,2008,2006,2005,2002,1999,1995,1991,1986,1981,1976,1969,1962,1956,1952,1948,1944,1942,1942,1943,1945,1949,1954,1960,1966,1971,1976,1981,1985,1988,1991,1992,1995,1998,2002,2006,2009,2013,2018,2023,2027,2032,2035,2038,2041,2044,2045,2047,2047,2046,2044,2042,2039,2036,2033,2028,2023,2019,2017,2015,2014,2015,2017,2020,2024,2027,2030,2034,2038,2040,2041,2042,2042,2042,2042,2043,2043,2045,2046,2048,2049,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2047,2046,2046,2046,2047,2049,2053,2057,2062,2067,2073,2079,2085,2091,2096,2099,2100,2100,2099,2096,2093,2089,2084,2080,2077,2076,2075,2075,2075,2075,2075,2075,2075,2074,2073,2072,2072,2072,2072,2072,2073,2073,2073,2074,2074,2074,2074,2075,2075,2077,2079,2081,2084,2086,2088,2090,2091,2092,2091,2090,2087,2083,2079,2073,2066,2061,2056,2051,2047,2044,2044,2043,2044,2046,2049,2053,2056,2060,2064,2068,2071,2073,2075,2076,2076,2074,2071,2067,2064,2060,2056,2052,2047,2044,2042,2040,2037,2035,2033,2032,2030,2029,2027,2024,2021,2018,2014,2009,2003,1998,1993,1990,1987,1986,1985,1987,1989,1992,1996,2000,2005,2010,2014,2017,2020,2023,2025,2026,2026,2026,2026,2025,2024,2024,2023,2023,2024,2024,2025,2026,2026,2027,2028,2030,2031,2032,2033,2035,2036,2035,2035,2033,2032,2030,2028,2027,2027,2027,2029,2030,2032,2034,2035,2036,2036,2035,2034,2032,2031,2029,2028,2027,2027,2028,2029,2032,2035,2039,2042,2046,2049,2053,2056,2059,2061,2063,2066,2068,2071,2073,2075,2076,2076,2075,2073,2071,2069,2066,2064,2062,2061,2060,2059,2058,2057,2055,2053,2051,2049,2046,2043,2039,2036,2034,2032,2031,2030,2030,2031,2032,2033,2035,2038,2040,2042,2044,2047,2049,2050,2051,2052,2053,2054,2055,2055,2055,2055,2054,2053,2053,2053,2054,2055,2057,2058,2059,2059,2058,2057,2054,2052,2049,2047,2044,2041,2039,2038,2037,2036,2035,2033,2032,2031,2029,2028,2025,2022,2019,2016,2014,2011,2008,2006,2003,2002,2000,1999,1998,1997,1996,1996,1997,1997,1999,2002,2004,2006,2008,2010,2012,2013,2014,2015,2015,2015,2016,2017,2017,2018,2019,2020,2021,2023,2024,2024,2025,2025,2024,2024,2023,2022,2021,2020,2018,2017,2016,2014,2012,2009,2007,2004,2001,1998,1996,1994,1993,1992,1992,1992,1992,1992,1991,1991,1990,1988,1987,1987,1988,1990,1992,1996,2000,2004,2008,2013,2018,2022,2026,2029,2032,2035,2039,2041,2044,2046,2048,2050,2053,2054,2056,2057,2058,2058,2057,2057,2057,2056,2056,2056,2056,2057,2057,2057,2055,2054,2052,2051,2050,2050,2050,2052,2054,2056,2059,2062,2066,2069,2072,2074,2077,2079,2082,2083,2085,2086,2088,2089,2091,2093,2094,2095,2096,2096,2095,2094,2092,2090,2087,2084,2082,2080,2078,2076,2075,2073,2072,2070,2068,2065,2063,2061,2059,2059,2059,2060,2061,2062,2063,2064,2065,2065,2065,2065,2065,2064,2063,2063,2063,2063,2063,2064,2065,2066,2067,2068,2069,2069,2069,2067,2066,2064,2063,2061,2060,2059,2058,2058,2058,2058,2057,2057,2057,2057,2057,2059,2060,2062,2063,2065,2067,2068,2069,2069,2069,2068,2068,2067,2066,2065,2064,2062,2060,2058,2056,2055,2054,2053,2052,2051,2050,2049,2049,2047,2046,2045,2044,2043,2043,2043,2043,2044,2045,2047,2049,2052,2055,2058,2061,2065,2068,2072,2074,2075,2075,2074,2073,2071,2068,2066,2063,2060,2057,2054,2052,2049,2046,2041,2037,2033,2029,2025,2021,2016,2012,2008,2006,2004,2002,2002,2004,2006,2009,2013,2018,2024,2029,2035,2040,2047,2054,2059,2064,2068,2071,2074,2075,2075,2074,2072,2070,2067,2064,2061,2060,2058,2057,2056,2055,2055,2056,2056,2056,2056,2055,2054,2052,2050,2047,2044,2042,2041,2040,2040,2042,2044,2047,2051,2056,2062,2068,2074,2079,2083,2088,2092,2094,2096,2096,2095,2092,2089,2084,2080,2076,2072,2067,2064,2060,2058,2056,2054,2052,2050,2048,2047,2046,2044,2043,2041,2039,2038,2036,2035,2034,2034,2034,2035,2035,2037,2039,2040,2042,2043,2046,2047,2049,2050,2051,2052,2053,2053,2053,2053,2052,2051,2051,2050,2051,2052,2053,2055,2057,2058,2059,2059,2058,2056,2053,2049,2045,2039,2033,2027,2022,2018,2015,2013,2012,2012,2013,2014,2016,2018,2020,2023,2025,2027,2029,2032,2035,2037,2039,2040,2042,2043,2043,2043,2043,2042,2042,2041,2041,2041,2042,2042,2043,2044,2044,2045,2044,2044,2042,2039,2035,2031,2027,2023,2018,2013,2010,2007,2006,2005,2005,2006,2008,2010,2014,2018,2023,2027,2031,2035,2039,2044,2048,2051,2054,2056,2058,2059,2059,2058,2057,2056,2056,2056,2056,2056,2057,2057,2058,2059,2059,2058,2057,2055,2053,2051,2048,2046,2044,2042,2040,2038,2037,2036,2036,2037,2038,2040,2041,2044,2046,2049,2051,2053,2054,2056,2057,2058,2059,2060,2061,2061,2062,2062,2062,2062,2063,2063,2064,2064,2064,2064,2064,2065,2064,2064,2064,2064,2063,2061,2060,2058,2057,2055,2052,2049,2047,2045,2043,2041,2040,2039,2039,2039,2038,2038,2037,2036,2035,2034,2032,2030,2027,2025,2023,2021,2020,2018,2018,2018,2018,2018,2019,2020,2021,2022,2023,2024,2026,2028,2030,2031,2033,2034,2035,2035,2035,2035,2035,2035,2034,2034,2034,2034,2035,2035,2034,2034,2034,2033,2033,2033,2032,2031,2029,2027,2024,2021,2017,2013,2009,2005,2001,1998,1997,1996,1995,1995,1996,1997,1999,2001,2003,2005,2007,2008,2008,2009,2009,2009,2008,2008,2008,2009,2011,2012,2014,2015,2016,2017,2018,2019,2019,2020,2021,2023,2025,2027,2029,2031,2032,2033,2033,2032,2031,2030,2030,2029,2029,2028,2028,2028,2028,2028,2029,2030,2030,2031,2031,2032,2032,2032,2032,2031,2030,2029,2028,2027,2026,2024,2022,2019,2017,2015,2014,2013,2013,2014,2016,2017,2020,2023,2027,2031,2035,2039,2044,2049,2053,2058,2061,2064,2067,2069,2070,2071,2072,2073,2074,2075,2076,2076,2076,2077,2076,2076,2075,2074,2072,2070,2068,2065,2063,2060,2057,2053,2049,2047,2044,2042,2040,2039,2038,2037,2037,2036,2036,2036,2036,2037,2038,2039,2041,2044,2046,2049,2053,2057,2060,2064,2066,2069,2071,2073,2075,2077,2078,2079,2079,2080,2080,2079,2078,2077,2075,2072,2071,2069,2068,2068,2068,2069,2070,2071,2073,2074,2074,2074,2074,2073,2071,2069,2066,2063,2061,2058,2055,2052,2049,2047,2044,2042,2040,2038,2036,2036,2035,2034,2033,2032,2031,2029,2028,2026,2023,2021,2018,2017,2015,2014,2014,2014,2014,2016,2018,2020,2023,2026,2029,2033,2036,2041,2045,2049,2053,2056,2060,2063,2065,2067,2068,2068,2067,2066,2063,2061,2058,2055,2051,2048,2045,2043,2040,2037,2034,2031,2029,2027,2024,2022,2021,2020,2020,2020,2021,2023,2025,2027,2029,2031,2034,2037,2040,2044,2048,2053,2059,2066,2073,2078,2084,2089,2095,2100,2103,2105,2107,2108,2109,2110,2109,2109,2108,2108,2106,2105,2103,2101,2098,2095,2093,2090,2089,2087,2085,2083,2081,2080,2079,2077,2076,2075,2075,2074,2074,2074,2073,2073,2073,2074,2074,2074,2074,2075,2075,2075,2075,2075,2076,2076,2076,2077,2077,2077,2077,2077,2077,2077,2077,2077,2076,2076,2075,2075,2074,2074,2073,2073,2073,2073,2074,2074,2075,2076,2078,2079,2080,2081,2080,2080,2080,2079,2078,2076,2075,2073,2071,2068,2066,2063,2061,2058,2056,2054,2052,2051,2050,2050,2050,2050,2050,2051,2051,2052,2053,2053,2054,2054,2054,2054,2053,2053,2052,2052,2052,2051,2051,2051,2051,2050,2049,2048,2046,2045,2043,2042,2040,2039,2038,2037,2036,2035,2034,2033,2032,2030,2029,2027,2026,2024,2024,2023,2023,2023,2023,2024,2024,2025,2026,2028,2030,2032,2034,2036,2038,2041,2043,2046,2048,2051,2054,2056,2058,2060,2061,2061,2061,2060,2059,2058,2057,2055,2054,2052,2050,2049,2046,2043,2040,2037,2033,2030,2026,2022,2019,2016,2013,2011,2008,2007,2006,2005,2005,2006,2007,2008,2009,2011,2014,2017,2021,2026,2030,2035,2040,2047,2053,2058,2062,2066,2070,2073,2076,2078,2080,2081,2083,2084,2084,2083,2082,2079,2076,2073,2069,2066,2064,2061,2059,2057,2055,2053,2052,2050,2050,2049,2049,2050,2052,2054,2057,2060,2063,2066,2070,2073,2077,2079,2081,2083,2084,2085,2085,2086,2086,2086,2086,2085,2085,2084,2083,2081,2080,2078,2076,2073,2070,2067,2064,2062,2059,2057,2055,2054,2052,2051,2050,2050,2050,2050,2050,2051,2051,2051,2052,2052,2052,2052,2052,2051,2050,2047,2045,2042,2038,2034,2030,2026,2023,2020,2017,2014,2012,2010,2008,2007,2005,2004,2004,2003,2003,2004,2005,2005,2006,2007,2008,2009,2010,2012,2015,2017,2020,2024,2027,2031,2034,2036,2037,2038,2038,2038,2038,2037,2036,2035,2033,2031,2030,2028,2027,2026,2026,2026,2026,2026,2027,2028,2029,2030,2031,2031,2032,2032,2032,2032,2032,2032,2031,2030,2029,2028,2027,2026,2025,2024,2023,2022,2021,2020,2019,2018,2017,2016,2014,2013,2013,2012,2012,2012,2012,2013,2014,2014,2015,2015,2016,2018,2019,2020,2022,2024,2026,2029,2030,2032,2034,2037,2038,2040,2041,2042,2044,2045,2047,2048,2049,2050,2050,2051,2050,2050,2049,2047,2044,2041,2038,2036,2034,2031,2029,2028,2027,2027,2027,2027,2028,2030,2031,2033,2036,2040,2043,2046,2049,2052,2055,2057,2060,2062,2064,2066,2068,2069,2071,2073,2074,2076,2077,2079,2079,2080,2080,2080,2079,2078,2077,2075,2073,2070,2067,2064,2061,2058,2055,2052,2049,2046,2043,2041,2038,2035,2033,2031,2029,2028,2028,2028,2028,2029,2030,2030,2032,2033,2034,2034,2036,2037,2039,2041,2043,2044,2045,2046,2046,2046,2046,2045,2044,2043,2042,2042,2042,2041,2040,2039,2039,2038,2037,2036,2035,2034,2033,2032,2032,2031,2030,2028,2027,2027,2026,2025,2025,2024,2025,2025,2025,2026,2028,2029,2031,2032,2033,2035,2037,2038,2040,2041,2042,2043,2043,2044,2044,2044,2043,2042,2041,2039,2038,2036,2034,2033,2031,2030,2030,2029,2029,2030,2030,2031,2032,2034,2035,2037,2038,2039,2040,2041,2042,2043,2044,2045,2046,2047,2048,2049,2049,2050,2049,2048,2047,2046,2044,2043,2041,2039,2038,2037,2035,2034,2032,2031,2029,2028,2027,2026,2026,2026,2027,2028,2030,2033,2036,2039,2042,2045,2049,2054,2057,2061,2064,2068,2073,2077,2081,2084,2088,2091,2094,2097,2098,2099,2100,2100,2100,2099,2098,2097,2095,2093,2090,2088,2085,2083,2080,2077,2075,2074,2072,2072,2071,2071,2071,2072,2073,2073,2074,2075,2075,2076,2077,2078,2079,2080,2081,2083,2084,2085,2087,2088,2089,2089,2090,2091,2091,2091,2091,2091,2091,2091,2091,2090,2089,2088,2086,2084,2081,2079,2076,2073,2070,2067,2064,2062,2060,2058,2056,2054,2052,2050,2047,2044,2041,2039,2037,2036,2035,2035,2035,2036,2037,2037,2038,2038,2039,2040,2041,2043,2045,2047,2049,2051,2054,2056,2058,2059,2059,2059,2059,2058,2057,2056,2055,2054,2052,2050,2048,2046,2045,2043,2041,2039,2037,2035,2033,2031,2029,2027,2025,2024,2023,2022,2021,2020,2018,2018,2017,2016,2015,2014,2013,2013,2013,2013,2013,2014,2014,2015,2015,2016,2017,2018,2019,2020,2022,2023,2025,2026,2027,2029,2031,2033,2035,2037,2038,2040,2042,2044,2045,2045,2046,2046,2047,2047,2047,2046,2045,2044,2043,2042,2041,2040,2039,2039,2038,2037,2036,2035,2034,2033,2032,2031,2031,2031,2032,2033,2035,2037,2040,2043,2046,2050,2052,2055,2059,2063,2067,2071,2074,2077,2080,2081,2082,2083,2082,2082,2081,2080,2079,2078,2078,2077,2077,2077,2078,2078,2078,2078,2079,2079,2079,2079,2079,2079,2078,2078,2078,2078,2078,2079,2079,2079,2079,2079,2080,2080,2080,2080,2081,2082,2082,2083,2083,2083,2082,2080,2077,2074,2071,2068,2066,2063,2061,2059,2059,2058,2058,2059,2059,2060,2060,2060,2060,2061,2062,2062,2063,2064,2066,2067,2068,2069,2069,2069,2069,2068,2067,2067,2066,2065,2064,2063,2063,2062,2062,2060,2058,2056,2053,2050,2046,2042,2038,2035,2032,2029,2027,2025,2023,2022,2022,2022,2022,2023,2023,2024,2024,2025,2026,2027,2027,2028,2029,2029,2030,2031,2031,2031,2030,2030,2030,2030,2029,2029,2030,2030,2030,2031,2031,2032,2032,2032,2032,2032,2032,2032,2032,2032,2032,2033,2033,2034,2034,2035,2036,2036,2037,2037,2038,2038,2039,2039,2039,2038,2038,2038,2038,2037,2037,2037,2037,2038,2038,2039,2039,2040,2041,2042,2043,2044,2045,2045,2046,2046,2046,2045,2044,2043,2043,2043,2043,2044,2046,2048,2050,2052,2055,2058,2060,2062,2062,2063,2063,2063,2061,2060,2059,2057,2055,2053,2051,2050,2049,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2048,2048,2048,2049,2049,2050,2050,2052,2053,2055,2058,2061,2064,2067,2070,2073,2074,2075,2075,2075,2075,2073,2072,2071,2070,2069,2068,2068,2067,2067,2067,2067,2066,2066,2065,2064,2062,2060,2058,2056,2054,2053,2051,2050,2049,2048,2048,2047,2047,2047,2047,2048,2049,2050,2051,2052,2053,2054,2054,2055,2054,2053,2052,2051,2050,2049,2047,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2046,2045,2044,2043,2041,2039,2037,2034,2031,2029,2027,2024,2021,2018,2016,2015,2014,2014,2015,2016,2017,2019,2021,2023,2026,2027,2029,2030,2031,2033,2035,2036,2037,2039,2041,2043,2044,2046,2047,2048,2049,2050,2051,2052,2052,2053,2053,2053,2053,2052,2052,2051,2049,2047,2045,2044,2042,2039,2038,2037,2036,2036,2036,2037,2038,2038,2039,2040,2041,2041,2042,2042,2043,2044,2044,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2047,2048,2049,2050,2050,2051,2052,2052,2052,2052,2052,2051,2051,2050,2050,2050,2051,2052,2054,2055,2057,2059,2062,2064,2066,2067,2068,2069,2070,2071,2071,2071,2071,2070,2070,2068,2067,2066,2065,2063,2061,2060,2059,2058,2058,2057,2057,2057,2057,2057,2056,2056,2055,2054,2054,2054,2054,2054,2055,2055,2056,2057,2058,2059,2059,2060,2060,2061,2061,2061,2062,2062,2062,2061,2061,2061,2061,2060,2059,2058,2057,2056,2056,2055,2055,2054,2054,2054,2054,2054,2054,2054,2053,2052,2051,2050,2049,2047,2046,2046,2045,2045,2044,2044,2044,2044,2044,2044,2043,2043,2043,2043,2044,2044,2045,2045,2045,2045,2045,2044,2044,2043,2043,2043,2043,2042,2042,2042,2042,2041,2041,2041,2041,2041,2042,2042,2042,2043,2043,2043,2043,2043,2042,2042,2041,2041,2040,2040,2040,2040,2040,2040,2040,2041,2041,2042,2042,2042,2042,2042,2042,2041,2041,2040,2040,2040,2039,2039,2038,2037,2036,2035,2033,2031,2029,2027,2025,2023,2022,2021,2020,2019,2019,2019,2019,2020,2020,2021,2023,2024,2025,2027,2029,2031,2033,2035,2036,2038,2039,2041,2042,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2044,2045,2046,2047,2047,2048,2047,2047,2047,2046,2045,2043,2042,2041,2039,2038,2037,2037,2037,2038,2040,2042,2045,2048,2050,2053,2055,2057,2058,2058,2059,2059,2059,2058,2057,2057,2056,2056,2055,2054,2053,2053,2052,2051,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2051,2052,2054,2056,2058,2060,2062,2063,2064,2065,2065,2065,2065,2064,2063,2061,2060,2058,2057,2056,2054,2052,2050,2048,2046,2044,2042,2041,2039,2038,2037,2036,2036,2036,2036,2036,2036,2036,2037,2038,2038,2039,2040,2042,2044,2046,2048,2051,2053,2056,2058,2060,2061,2063,2064,2064,2065,2065,2065,2065,2065,2065,2065,2064,2063,2062,2060,2058,2057,2055,2054,2052,2051,2049,2048,2047,2046,2044,2042,2041,2040,2039,2038,2037,2037,2037,2037,2038,2039,2040,2042,2043,2044,2045,2046,2047,2047,2048,2049,2049,2050,2051,2051,2052,2052,2053,2054,2054,2054,2054,2054,2054,2054,2053,2053,2053,2052,2052,2051,2051,2051,2051,2050,2049,2048,2048,2047,2046,2045,2045,2046,2046,2047,2048,2049,2050,2051,2052,2052,2053,2053,2054,2055,2056,2056,2058,2059,2060,2061,2062,2063,2063,2063,2063,2062,2061,2060,2059,2058,2057,2056,2055,2055,2055,2054,2054,2054,2053,2052,2052,2051,2051,2050,2050,2050,2050,2051,2051,2051,2052,2053,2053,2053,2054,2054,2055,2055,2056,2056,2057,2058,2059,2060,2060,2060,2059,2058,2056,2053,2051,2048,2045,2041,2038,2036,2034,2033,2031,2030,2030,2029,2029,2029,2029,2029,2030,2031,2032,2034,2036,2039,2041,2042,2044,2046,2048,2049,2050,2050,2051,2052,2054,2055,2056,2057,2058,2059,2060,2060,2060,2059,2058,2056,2055,2053,2051,2049,2047,2045,2044,2042,2041,2039,2038,2037,2037,2036,2036,2036,2036,2037,2037,2038,2038,2039,2039,2039,2039,2039,2039,2039,2039,2039,2039,2039,2039,2040,2041,2042,2043,2044,2046,2047,2048,2049,2049,2050,2051,2052,2053,2054,2054,2055,2055,2055,2055,2054,2053,2051,2050,2048,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2047,2047,2048,2049,2050,2052,2053,2055,2057,2059,2060,2062,2064,2066,2067,2069,2071,2072,2073,2073,2073,2073,2072,2071,2070,2068,2067,2065,2064,2063,2062,2061,2060,2059,2059,2058,2058,2058,2058,2058,2058,2058,2059,2059,2060,2061,2061,2062,2063,2064,2065,2066,2067,2068,2069,2070,2070,2070,2071,2070,2070,2069,2068,2066,2065,2063,2061,2059,2058,2056,2054,2052,2050,2049,2047,2046,2044,2043,2041,2040,2039,2038,2037,2036,2035,2034,2034,2033,2032,2032,2032,2032,2032,2033,2035,2036,2038,2039,2041,2043,2044,2045,2046,2047,2047,2047,2047,2047,2047,2046,2046,2045,2045,2044,2043,2042,2041,2039,2038,2037,2036,2034,2033,2032,2031,2030,2030,2029,2029,2029,2028,2028,2028,2028,2028,2029,2029,2030,2031,2033,2034,2036,2037,2039,2041,2042,2043,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2044,2044,2044,2044,2043,2043,2043,2043,2044,2044,2045,2046,2047,2048,2049,2050,2051,2052,2053,2054,2054,2055,2055,2055,2054,2053,2052,2051,2050,2049,2047,2046,2045,2043,2042,2040,2039,2038,2037,2037,2037,2037,2037,2038,2039,2040,2041,2042,2042,2042,2042,2042,2041,2041,2041,2042,2042,2043,2045,2046,2048,2049,2051,2052,2053,2054,2055,2055,2055,2054,2054,2053,2052,2051,2049,2048,2046,2045,2044,2043,2042,2041,2040,2040,2040,2040,2040,2041,2042,2043,2044,2045,2046,2047,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2047,2046,2045,2044,2043,2042,2041,2039,2037,2036,2035,2033,2032,2030,2029,2028,2027,2026,2026,2025,2026,2026,2027,2027,2028,2028,2029,2029,2029,2030,2031,2031,2032,2033,2034,2036,2038,2039,2040,2041,2042,2043,2043,2043,2042,2042,2041,2040,2039,2038,2038,2037,2036,2035,2034,2033,2033,2033,2033,2033,2033,2034,2035,2037,2038,2040,2041,2042,2044,2045,2045,2046,2046,2046,2047,2047,2047,2048,2049,2049,2050,2051,2051,2051,2052,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2049,2049,2048,2048,2048,2049,2049,2050,2051,2052,2053,2055,2056,2057,2059,2060,2061,2062,2063,2063,2064,2065,2066,2066,2067,2067,2067,2066,2066,2065,2064,2063,2062,2061,2060,2060,2059,2059,2058,2058,2057,2056,2055,2055,2054,2053,2052,2051,2051,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2049,2050,2051,2053,2054,2056,2058,2059,2061,2062,2064,2064,2065,2066,2067,2068,2069,2069,2070,2071,2071,2071,2071,2071,2070,2069,2068,2067,2066,2065,2064,2063,2062,2061,2059,2058,2056,2054,2052,2050,2048,2046,2044,2043,2042,2042,2042,2042,2042,2042,2042,2042,2042,2041,2040,2039,2038,2037,2037,2036,2036,2036,2037,2037,2037,2038,2038,2038,2038,2038,2037,2037,2037,2037,2037,2038,2039,2040,2040,2041,2042,2043,2044,2044,2044,2044,2045,2045,2046,2047,2048,2049,2050,2050,2051,2051,2050,2049,2048,2047,2045,2044,2043,2042,2040,2039,2038,2037,2036,2035,2033,2032,2030,2029,2027,2026,2025,2024,2024,2024,2025,2025,2027,2028,2029,2030,2032,2034,2036,2038,2039,2041,2044,2046,2049,2051,2053,2055,2058,2060,2062,2064,2066,2067,2069,2070,2071,2071,2072,2072,2073,2073,2073,2074,2073,2073,2072,2071,2070,2068,2066,2065,2063,2062,2061,2060,2059,2057,2056,2054,2052,2050,2048,2046,2044,2043,2042,2041,2041,2041,2041,2041,2042,2043,2044,2044,2046,2047,2049,2051,2053,2055,2057,2059,2061,2063,2065,2066,2067,2068,2069,2070,2070,2070,2071,2071,2072,2073,2073,2074,2074,2073,2072,2071,2069,2067,2065,2062,2059,2057,2055,2053,2051,2050,2048,2047,2046,2046,2045,2044,2043,2043,2043,2044,2045,2046,2047,2049,2050,2051,2053,2054,2055,2055,2056,2056,2056,2057,2057,2057,2058,2058,2059,2059,2060,2060,2059,2059,2058,2057,2056,2055,2054,2052,2051,2050,2049,2048,2047,2046,2045,2044,2043,2042,2041,2040,2040,2039,2039,2039,2039,2040,2040,2041,2042,2043,2044,2045,2046,2047,2048,2049,2050,2050,2051,2052,2052,2053,2052,2052,2051,2050,2048,2046,2045,2043,2041,2039,2038,2037,2036,2036,2035,2035,2034,2034,2034,2033,2033,2032,2032,2031,2031,2031,2032,2033,2034,2036,2038,2040,2042,2044,2047,2048,2050,2052,2054,2055,2056,2057,2058,2059,2059,2059,2058,2058,2057,2056,2055,2054,2052,2051,2050,2049,2049,2049,2049,2049,2049,2049,2050,2050,2049,2049,2048,2047,2047,2047,2047,2047,2048,2049,2050,2051,2052,2053,2054,2055,2055,2055,2055,2054,2054,2053,2052,2052,2051,2050,2050,2050,2050,2050,2050,2051,2051,2052,2052,2053,2054,2054,2054,2055,2055,2055,2055,2055,2054,2054,2053,2053,2052,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2049,2049,2048,2047,2047,2046,2046,2045,2045,2045,2045,2045,2046,2047,2048,2048,2049,2050,2050,2050,2050,2050,2050,2049,2047,2046,2045,2043,2042,2040,2039,2037,2036,2035,2035,2034,2033,2032,2032,2032,2032,2032,2032,2032,2033,2033,2033,2034,2034,2034,2035,2036,2036,2037,2038,2039,2040,2041,2041,2042,2042,2043,2043,2043,2043,2043,2043,2042,2042,2041,2040,2039,2038,2037,2036,2035,2035,2034,2034,2033,2033,2033,2033,2033,2032,2032,2032,2031,2031,2031,2031,2032,2032,2033,2034,2035,2037,2038,2039,2041,2041,2042,2043,2044,2044,2044,2045,2045,2045,2046,2046,2047,2047,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2045,2045,2044,2043,2043,2042,2041,2039,2038,2037,2037,2037,2037,2038,2039,2040,2042,2043,2045,2047,2048,2049,2051,2052,2053,2055,2056,2057,2058,2059,2060,2061,2061,2062,2062,2062,2061,2061,2061,2060,2060,2059,2059,2059,2059,2058,2057,2056,2055,2054,2053,2051,2050,2049,2048,2047,2047,2047,2047,2048,2048,2048,2049,2050,2050,2051,2052,2053,2054,2056,2057,2058,2060,2062,2063,2065,2066,2067,2068,2069,2069,2069,2069,2069,2068,2067,2067,2066,2065,2064,2064,2062,2061,2059,2058,2057,2055,2052,2050,2048,2046,2045,2043,2041,2040,2039,2038,2037,2037,2036,2036,2036,2035,2035,2035,2035,2035,2035,2036,2037,2037,2038,2039,2040,2041,2042,2043,2044,2044,2045,2045,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2044,2044,2043,2042,2042,2041,2040,2040,2040,2039,2039,2039,2039,2039,2039,2039,2039,2039,2039,2038,2038,2037,2037,2036,2036,2035,2035,2035,2036,2036,2036,2036,2037,2037,2037,2038,2038,2038,2039,2039,2040,2040,2041,2042,2042,2043,2043,2044,2045,2045,2045,2046,2046,2047,2047,2047,2047,2046,2046,2046,2046,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2046,2046,2047,2048,2048,2048,2049,2049,2050,2050,2050,2051,2051,2052,2052,2053,2053,2054,2054,2055,2055,2055,2055,2055,2055,2055,2054,2054,2053,2053,2052,2051,2051,2051,2050,2050,2050,2050,2050,2051,2051,2052,2053,2054,2054,2055,2056,2056,2057,2057,2057,2057,2057,2057,2056,2056,2055,2055,2054,2053,2052,2051,2050,2049,2048,2047,2046,2046,2045,2044,2044,2044,2043,2043,2042,2042,2041,2041,2040,2040,2039,2039,2040,2040,2041,2041,2042,2043,2044,2044,2045,2045,2046,2047,2047,2047,2048,2048,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2048,2047,2046,2046,2045,2044,2044,2043,2043,2043,2042,2042,2041,2041,2041,2041,2041,2041,2042,2043,2044,2046,2047,2049,2051,2052,2054,2055,2057,2058,2059,2060,2060,2061,2062,2062,2062,2062,2062,2062,2061,2060,2059,2057,2056,2054,2051,2049,2048,2046,2044,2043,2041,2040,2039,2038,2037,2036,2035,2035,2034,2034,2034,2035,2036,2036,2037,2038,2040,2041,2042,2043,2044,2045,2046,2046,2047,2048,2049,2049,2050,2050,2050,2050,2050,2049,2049,2048,2047,2046,2045,2043,2043,2042,2042,2042,2043,2043,2044,2045,2046,2047,2048,2048,2049,2050,2050,2051,2052,2053,2054,2054,2055,2055,2055,2055,2055,2055,2055,2054,2053,2053,2053,2053,2052,2052,2052,2052,2052,2052,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2053,2052,2052,2052,2051,2051,2050,2050,2049,2049,2048,2047,2046,2045,2044,2043,2042,2042,2041,2040,2040,2039,2039,2039,2039,2039,2039,2038,2038,2039,2039,2040,2040,2041,2043,2044,2045,2046,2046,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2044,2044,2044,2043,2043,2043,2042,2043,2043,2043,2044,2044,2045,2046,2047,2048,2048,2049,2049,2049,2049,2050,2050,2050,2051,2051,2052,2053,2053,2054,2054,2053,2053,2052,2052,2051,2050,2049,2049,2048,2048,2047,2047,2046,2046,2045,2045,2045,2045,2046,2046,2047,2048,2049,2050,2052,2053,2054,2055,2057,2058,2059,2059,2060,2060,2060,2060,2060,2060,2060,2060,2060,2061,2061,2061,2061,2061,2061,2060,2059,2058,2057,2055,2054,2052,2051,2050,2048,2047,2046,2045,2045,2044,2044,2044,2045,2045,2046,2047,2047,2048,2049,2050,2051,2052,2052,2053,2053,2053,2053,2053,2054,2054,2054,2055,2056,2056,2057,2058,2058,2059,2059,2060,2059,2059,2059,2058,2057,2056,2055,2054,2053,2052,2050,2049,2049,2048,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2047,2047,2047,2048,2049,2050,2052,2053,2054,2055,2056,2057,2057,2058,2058,2058,2057,2057,2056,2055,2054,2053,2052,2050,2048,2047,2045,2043,2041,2039,2038,2036,2035,2033,2032,2032,2031,2031,2030,2030,2030,2030,2031,2031,2032,2034,2035,2036,2038,2040,2042,2044,2046,2048,2050,2052,2054,2055,2055,2055,2055,2055,2054,2053,2052,2051,2049,2048,2046,2045,2044,2043,2041,2040,2039,2038,2037,2036,2036,2035,2036,2036,2036,2036,2037,2037,2038,2038,2038,2039,2040,2041,2042,2043,2044,2046,2048,2049,2050,2052,2054,2055,2056,2057,2058,2058,2059,2059,2059,2059,2059,2059,2059,2058,2059,2059,2059,2060,2060,2060,2060,2060,2060,2060,2059,2059,2059,2059,2058,2058,2057,2056,2056,2055,2054,2053,2052,2051,2050,2050,2049,2049,2048,2048,2048,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2046,2047,2047,2048,2049,2050,2051,2052,2053,2054,2054,2054,2054,2054,2053,2053,2053,2052,2051,2051,2051,2050,2050,2049,2049,2049,2048,2048,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2045,2044,2044,2043,2043,2043,2042,2042,2042,2042,2042,2041,2041,2041,2040,2040,2039,2039,2038,2037,2037,2036,2035,2035,2035,2034,2034,2034,2034,2034,2035,2035,2036,2037,2037,2038,2039,2039,2040,2040,2041,2041,2041,2042,2042,2042,2042,2043,2043,2043,2043,2043,2042,2042,2042,2041,2041,2040,2040,2039,2038,2038,2037,2036,2035,2034,2033,2033,2032,2031,2030,2030,2029,2029,2030,2030,2031,2032,2034,2035,2037,2038,2040,2042,2043,2044,2045,2047,2048,2049,2049,2050,2051,2052,2053,2054,2054,2055,2055,2056,2056,2056,2056,2056,2056,2056,2056,2056,2056,2055,2055,2054,2054,2053,2052,2051,2051,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2045,2045,2044,2044,2044,2043,2043,2043,2042,2042,2042,2041,2041,2041,2041,2042,2042,2042,2043,2043,2044,2044,2045,2045,2046,2046,2047,2047,2047,2048,2048,2049,2049,2049,2050,2050,2049,2049,2049,2048,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2048,2048,2047,2047,2047,2046,2045,2045,2044,2043,2042,2041,2040,2040,2040,2039,2039,2039,2039,2039,2038,2038,2038,2038,2037,2037,2037,2038,2038,2039,2039,2040,2041,2041,2042,2042,2043,2043,2043,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2043,2043,2042,2042,2041,2041,2040,2039,2039,2038,2038,2037,2037,2037,2037,2037,2037,2037,2037,2037,2037,2038,2038,2039,2040,2041,2042,2044,2045,2047,2049,2050,2051,2052,2053,2054,2055,2056,2056,2057,2058,2059,2059,2060,2060,2060,2060,2060,2059,2058,2057,2056,2055,2054,2053,2052,2052,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2050,2050,2050,2051,2051,2052,2053,2054,2055,2056,2057,2058,2059,2060,2061,2062,2062,2063,2064,2064,2064,2065,2065,2065,2065,2065,2065,2064,2064,2064,2064,2064,2063,2063,2063,2063,2062,2062,2062,2061,2061,2060,2059,2059,2058,2057,2056,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2054,2054,2053,2053,2052,2052,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2046,2046,2045,2044,2042,2041,2040,2039,2038,2038,2038,2038,2038,2038,2038,2039,2039,2040,2040,2041,2041,2041,2042,2042,2042,2042,2043,2043,2044,2044,2044,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2044,2043,2043,2042,2041,2041,2041,2041,2041,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2043,2044,2044,2045,2045,2045,2046,2046,2046,2046,2047,2048,2048,2049,2050,2051,2052,2053,2054,2055,2055,2056,2056,2057,2057,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2058,2059,2059,2059,2059,2059,2059,2059,2059,2059,2058,2058,2057,2056,2056,2055,2055,2054,2054,2054,2055,2055,2056,2056,2057,2057,2057,2056,2056,2055,2055,2054,2053,2052,2051,2050,2049,2048,2047,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2049,2049,2049,2048,2048,2048,2047,2047,2046,2045,2044,2043,2043,2042,2042,2042,2042,2042,2042,2042,2042,2042,2041,2041,2041,2041,2040,2040,2040,2039,2039,2039,2038,2038,2038,2038,2038,2038,2038,2038,2038,2039,2039,2040,2041,2041,2042,2043,2043,2044,2044,2045,2045,2046,2046,2046,2045,2045,2044,2044,2044,2043,2043,2042,2042,2042,2042,2042,2041,2041,2041,2041,2041,2041,2041,2041,2041,2042,2042,2042,2042,2042,2042,2042,2042,2042,2043,2043,2044,2044,2045,2046,2047,2047,2048,2049,2050,2051,2052,2053,2053,2054,2054,2054,2054,2054,2053,2053,2052,2052,2051,2050,2050,2049,2048,2048,2047,2046,2046,2045,2045,2044,2044,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2045,2045,2046,2046,2047,2048,2048,2048,2049,2049,2050,2050,2050,2051,2051,2051,2050,2050,2050,2049,2049,2048,2048,2047,2046,2045,2044,2043,2043,2042,2041,2040,2039,2038,2038,2037,2036,2036,2036,2036,2036,2036,2036,2037,2038,2038,2039,2040,2040,2041,2042,2042,2043,2044,2044,2045,2045,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2046,2046,2045,2044,2044,2043,2043,2042,2042,2042,2041,2041,2041,2041,2041,2041,2041,2042,2042,2042,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2042,2043,2043,2043,2044,2045,2046,2046,2047,2048,2049,2049,2049,2050,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2046,2046,2045,2045,2044,2044,2043,2043,2043,2043,2044,2045,2045,2047,2048,2049,2050,2051,2051,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2048,2048,2049,2049,2050,2051,2051,2052,2052,2053,2053,2053,2054,2054,2054,2054,2055,2055,2055,2055,2055,2055,2055,2054,2054,2053,2053,2052,2051,2051,2050,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2051,2051,2051,2052,2053,2053,2054,2055,2056,2056,2057,2058,2058,2059,2059,2059,2060,2060,2060,2060,2060,2059,2059,2059,2058,2057,2056,2054,2053,2052,2050,2048,2047,2045,2044,2043,2042,2042,2042,2042,2042,2042,2043,2043,2044,2045,2045,2046,2046,2047,2047,2048,2048,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2050,2050,2051,2051,2051,2051,2052,2052,2052,2052,2051,2051,2051,2051,2050,2050,2049,2049,2049,2048,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2049,2049,2050,2051,2052,2053,2053,2054,2054,2055,2055,2056,2056,2056,2057,2057,2057,2057,2057,2057,2057,2057,2056,2056,2055,2054,2053,2052,2050,2049,2048,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2049,2049,2050,2051,2052,2053,2054,2054,2055,2056,2057,2058,2058,2059,2060,2060,2061,2061,2061,2062,2062,2062,2062,2061,2061,2060,2060,2059,2058,2057,2056,2055,2054,2054,2053,2053,2053,2052,2052,2052,2051,2051,2050,2049,2049,2048,2048,2048,2047,2047,2047,2047,2046,2046,2045,2045,2044,2044,2043,2043,2043,2042,2042,2042,2042,2042,2042,2042,2043,2043,2044,2044,2045,2045,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2045,2045,2045,2044,2044,2044,2044,2044,2044,2045,2045,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2051,2051,2052,2052,2052,2052,2052,2051,2051,2050,2050,2049,2049,2048,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2046,2046,2047,2047,2048,2049,2049,2050,2051,2052,2053,2053,2054,2054,2055,2055,2055,2055,2055,2055,2054,2054,2053,2053,2052,2052,2051,2051,2050,2050,2049,2049,2048,2047,2047,2046,2046,2046,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2053,2053,2054,2054,2055,2055,2055,2056,2056,2056,2056,2056,2055,2055,2055,2055,2055,2055,2054,2054,2054,2054,2053,2053,2053,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2045,2045,2044,2044,2044,2043,2043,2043,2043,2042,2042,2043,2043,2043,2043,2044,2044,2044,2044,2044,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2050,2050,2049,2049,2049,2048,2048,2047,2046,2046,2045,2044,2044,2043,2043,2042,2041,2041,2040,2040,2039,2039,2040,2040,2040,2041,2042,2042,2043,2044,2045,2045,2046,2047,2047,2048,2048,2048,2049,2049,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2049,2050,2050,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2050,2050,2050,2051,2051,2051,2052,2052,2052,2053,2053,2053,2053,2053,2054,2054,2054,2054,2054,2054,2054,2054,2053,2053,2053,2052,2052,2051,2051,2050,2049,2048,2047,2046,2046,2045,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2044,2045,2045,2046,2046,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2052,2052,2053,2053,2053,2053,2053,2053,2052,2052,2052,2051,2051,2050,2049,2049,2049,2048,2048,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2045,2044,2044,2044,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2053,2053,2053,2053,2054,2054,2054,2053,2053,2053,2052,2052,2052,2051,2051,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2051,2051,2051,2052,2052,2052,2053,2053,2053,2053,2053,2053,2053,2052,2052,2052,2051,2051,2051,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2046,2046,2047,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2051,2052,2052,2053,2053,2054,2055,2055,2056,2056,2056,2056,2056,2056,2055,2055,2054,2053,2053,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2053,2053,2053,2054,2054,2054,2055,2055,2055,2055,2055,2056,2056,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2055,2056,2056,2056,2056,2056,2055,2055,2055,2055,2054,2054,2053,2053,2053,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2047,2047,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2048,2047,2047,2046,2045,2044,2043,2043,2042,2042,2041,2041,2041,2040,2040,2040,2041,2041,2041,2041,2041,2041,2041,2041,2042,2042,2042,2042,2042,2042,2042,2043,2043,2043,2044,2044,2044,2044,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2049,2049,2048,2048,2047,2047,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2048,2048,2048,2049,2049,2049,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2047,2048,2048,2049,2050,2050,2051,2052,2052,2053,2053,2053,2053,2053,2053,2052,2052,2052,2052,2051,2051,2051,2050,2050,2050,2049,2049,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2045,2045,2044,2044,2043,2043,2043,2042,2042,2042,2041,2041,2041,2041,2042,2042,2042,2042,2043,2043,2043,2043,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2051,2051,2051,2052,2052,2052,2053,2053,2053,2053,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2050,2050,2050,2051,2051,2051,2051,2051,2052,2052,2053,2053,2053,2053,2054,2054,2054,2054,2053,2053,2053,2053,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2053,2053,2053,2053,2053,2053,2054,2054,2054,2054,2054,2054,2053,2053,2053,2052,2052,2051,2050,2049,2048,2047,2047,2046,2045,2044,2044,2044,2043,2043,2043,2043,2043,2043,2043,2043,2043,2044,2044,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2045,2045,2044,2044,2043,2043,2043,2042,2042,2041,2041,2041,2041,2041,2041,2041,2041,2042,2042,2042,2043,2043,2043,2044,2044,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2044,2044,2044,2043,2043,2042,2042,2042,2042,2041,2041,2042,2042,2042,2042,2042,2043,2043,2043,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2050,2050,2049,2049,2048,2048,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2048,2048,2048,2049,2049,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2049,2049,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2049,2049,2049,2050,2050,2050,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2049,2049,2049,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2049,2049,2049,2048,2048,2048,2047,2047,2046,2046,2046,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2043,2043,2043,2043,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2048,2048,2049,2049,2049,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2051,2051,2051,2050,2050,2049,2049,2048,2048,2047,2047,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2048,2048,2049,2049,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2049,2049,2048,2048,2047,2047,2046,2046,2046,2045,2045,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2046,2046,2046,2047,2047,2048,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2046,2046,2046,2047,2047,2048,2048,2049,2049,2049,2050,2050,2051,2051,2051,2052,2052,2052,2052,2052,2052,2051,2051,2051,2050,2050,2050,2049,2049,2049,2048,2048,2048,2047,2047,2047,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2049,2049,2048,2048,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2050,2050,2050,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2047,2047,2047,2046,2046,2046,2046,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2047,2047,2047,2048,2048,2048,2049,2049,2049,2050,2050,2051,2051,2051,2051,2051,2052,2052,2052,2052,2052,2052,2052,2052,2052,2051,2051,2051,2051,2051,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2046,2046,2046,2046,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2046,2046,2046,2045,2045,2045,2045,2045,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2044,2045,2045,2045,2045,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2049,2049,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2051,2051,2051,2051,2051,2051,2051,2051,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2047,2047,2047,2047,2048,2048,2048,2048,2049,2049,2049,2049,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2045,2045,2045,2045,2045,2045,2045,2045,2045,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2046,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2050,2050,2050,2050,2050,2050,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2047,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2049,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2049,2049,2049,2049,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,};
+/*IMA ADPCM sound, 61989 samples at 4000 Hz, generated by Tools/adpcm_encoder.c*/
+#include "adpcm.h"
+
+const uint8_t spaceship_thruster_data[] = {
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x17,0x3D,0x8B,0x80,0x80,
+0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,
+0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x50,0x08,0x08,0x80,0x80,0xF0,0x08,0x88,0xE0,
+0x80,0x80,0x08,0x08,0x08,0x17,0x88,0x80,0x80,0x90,0xF0,0x09,0x80,0x80,0x07,0x08,0x88,0x80,0xF0,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0xF0,0x09,0xB5,0x08,0x88,0x80,0x80,0x90,0x9F,0x00,0x08,0x08,0xF8,0x09,0x80,0x60,0x0C,0xC0,0x80,0x80,0x00,0x08,0x78,0x80,0x80,0x08,0x0E,0x08,0x48,0x80,
+0x50,0x03,0x34,0x00,0x04,0x08,0xE8,0x80,0x40,0x80,0x44,0x72,0x10,0x01,0x08,0x08,0x8B,0x80,0x08,0x68,0x80,0x44,0xB8,0x48,0x08,0x08,0x80,0x80,0x80,0x17,0x08,0xE8,
+0xC0,0xBA,0xBC,0x0B,0x08,0x08,0x08,0x08,0xDF,0xCD,0xB9,0xC0,0xA9,0xA9,0xAB,0x08,0x08,0xD8,0xC0,0x8A,0xCB,0x8B,0xD0,0x33,0x80,0x00,0xE8,0xC0,0x8A,0x80,0x80,0x50,
+0x34,0x03,0x40,0x80,0x50,0x78,0x44,0x22,0x53,0x22,0x24,0x81,0x80,0x08,0x20,0x38,0x73,0x43,0x22,0x25,0x22,0x08,0xA8,0x20,0x80,0x30,0x40,0x84,0x80,0xD0,0xFB,0xAB,
+0x8D,0x99,0xBA,0xD8,0xC0,0xB0,0xAA,0xF9,0xBB,0xAD,0xAA,0x9A,0x0B,0x98,0xA8,0xB8,0x0B,0xFC,0xB9,0xA9,0x82,0x20,0x0B,0x08,0x65,0x52,0x13,0x08,0x28,0x35,0x08,0xAA,
+0xB0,0x48,0x65,0x23,0x13,0x41,0x52,0x11,0xB8,0xDB,0x8B,0x09,0x41,0x13,0x02,0x47,0x13,0xA0,0xB9,0xC9,0x99,0x2A,0x80,0x30,0x56,0x14,0x91,0xA9,0x0A,0xCA,0xA9,0x08,
+0xFB,0x8B,0x23,0x01,0xBA,0x9E,0x28,0x52,0x33,0x20,0x08,0x63,0x03,0xDA,0x9B,0xAA,0xBA,0x00,0xF8,0x98,0x31,0x02,0xB8,0x08,0xF8,0xCE,0x9B,0x41,0x90,0x31,0x21,0xB0,
+0x3A,0xC3,0xFA,0x0B,0x28,0x80,0x8D,0xAB,0xDD,0xBA,0x9B,0xD9,0x8D,0x28,0x12,0x20,0x83,0xEC,0xBB,0x9B,0x98,0x78,0x54,0x34,0x31,0x12,0x80,0xA9,0xBB,0xBA,0x8C,0x65,
+0x34,0x33,0x22,0x02,0x00,0x80,0xA9,0xDA,0x30,0x37,0x12,0x22,0x28,0x24,0x43,0x91,0xDB,0xAC,0xDB,0xCB,0xCC,0xBA,0x9B,0x9A,0xAA,0xBB,0x9C,0x08,0xA9,0xBD,0xCB,0xDA,
+0xAA,0xAB,0xBA,0xB8,0x40,0x24,0x11,0x13,0xDA,0xFB,0xBC,0xCB,0x99,0x20,0x32,0x34,0x54,0x32,0x01,0x53,0x33,0x54,0x43,0x22,0x00,0x10,0x31,0x90,0x21,0x35,0x62,0x32,
+0x22,0xA1,0xCB,0xA9,0x99,0x39,0x37,0x24,0x23,0x13,0x22,0x11,0x90,0xCC,0xDB,0xCB,0xDB,0xBC,0xBD,0xAB,0xBA,0xBB,0xCB,0xBB,0xAC,0x88,0xB9,0xCF,0xBB,0xBB,0xBB,0x0A,
+0x11,0x34,0x37,0x25,0x82,0x80,0x88,0x99,0xA8,0xBA,0x1A,0x45,0x46,0x33,0x33,0x13,0xA8,0xAA,0xA0,0xAA,0x23,0x55,0x55,0x23,0x34,0x01,0x80,0x10,0x00,0x18,0x90,0x0A,
+0xA9,0x49,0x53,0x43,0x33,0xA0,0xAF,0xB9,0xDF,0xBB,0xCB,0x8B,0xA9,0x09,0x81,0x88,0x14,0x80,0xAC,0xCB,0xAE,0x99,0x41,0x53,0x82,0x98,0xB9,0x89,0xAA,0xAD,0x80,0x10,
+0x46,0x25,0x22,0x11,0x80,0x80,0x99,0x88,0x43,0x74,0x45,0x12,0x12,0x81,0xCA,0xBA,0xA9,0x88,0x80,0x02,0xA0,0xBF,0x99,0xA8,0x09,0x91,0x0B,0x25,0x91,0xBE,0xDB,0xEA,
+0xAD,0x20,0x34,0x32,0x34,0x25,0x00,0x9A,0xBB,0xAF,0x8B,0x00,0x00,0x20,0x34,0x12,0x31,0x23,0x81,0x80,0xFC,0xCE,0x9B,0x00,0x00,0x80,0x20,0x21,0x73,0x34,0x90,0xDC,
+0xAA,0x9A,0xDB,0xBB,0xBC,0x9D,0x19,0x08,0x89,0x09,0x11,0x81,0x29,0x91,0x8A,0x78,0x16,0x01,0x10,0x12,0x91,0xBA,0xBA,0xEF,0x99,0x10,0x21,0x63,0x33,0x12,0x21,0x43,
+0x43,0x55,0x24,0x22,0x32,0x32,0x98,0xCB,0xBB,0x11,0x52,0x24,0x33,0x35,0x42,0x82,0xBA,0xB9,0xAD,0x98,0x10,0x01,0x13,0xFD,0xCD,0xBB,0xBB,0xDA,0xBA,0xCB,0x9A,0xA9,
+0xA9,0xBA,0xB9,0x8C,0xAA,0xAA,0xFB,0xAC,0xBA,0xCA,0xBC,0xCB,0x8A,0x42,0x45,0x63,0x23,0x43,0x13,0x12,0x01,0x18,0x42,0x35,0x43,0x35,0x32,0x13,0x12,0x80,0xA8,0xBB,
+0xAA,0x08,0x42,0x64,0x42,0x42,0x33,0x36,0x13,0x90,0xCA,0xCD,0xBB,0xBD,0xBB,0xAC,0xAA,0x08,0x98,0xA9,0xCC,0xDB,0xBC,0xAA,0x8A,0x08,0x11,0x22,0x11,0x22,0x34,0xC8,
+0xBB,0x9B,0x90,0x53,0x74,0x43,0x32,0x33,0x24,0x32,0x22,0x32,0x64,0x42,0x23,0x23,0x10,0x11,0x53,0x34,0x23,0x22,0x42,0x44,0x13,0x90,0xBA,0xAC,0xAA,0xBA,0x98,0xB9,
+0xCE,0xDB,0xBE,0xBB,0xAB,0xBA,0xBB,0x09,0x98,0x88,0xA9,0xEF,0xAA,0x99,0x90,0x89,0x30,0x03,0xDA,0x99,0xC0,0xBE,0xBB,0xCA,0xBE,0xAA,0x98,0xB8,0x89,0x42,0x33,0x01,
+0x22,0x64,0x63,0x23,0x33,0x42,0x36,0x23,0x33,0x22,0x11,0x01,0x02,0xC9,0xAF,0x9B,0xCB,0xAC,0x98,0x10,0x32,0x37,0x22,0x02,0x31,0x23,0x02,0x60,0x34,0x34,0x26,0x80,
+0xAA,0xEB,0xCC,0xBC,0xBB,0xBA,0x88,0x20,0x33,0x33,0x32,0x32,0x13,0xAA,0xA9,0x1A,0x74,0x32,0x33,0x81,0xDB,0xCF,0xCD,0xBA,0xAA,0x99,0x89,0x00,0x11,0x24,0x81,0x90,
+0x08,0x91,0x88,0x16,0x88,0xC9,0xCF,0xDB,0xBC,0x99,0xAA,0x98,0x19,0x33,0x31,0x34,0x54,0x35,0x23,0x02,0x88,0x10,0x13,0xB0,0xBB,0x28,0x77,0x26,0x42,0x12,0x33,0x25,
+0x12,0x11,0x10,0x81,0x20,0x63,0x33,0x53,0x22,0x21,0x11,0x22,0xD9,0xDE,0xBA,0xAC,0x9A,0x00,0x41,0x53,0x33,0x22,0x80,0xCB,0xCF,0xCB,0xBB,0xBB,0x9B,0x99,0xAA,0x9A,
+0xBB,0xDB,0xEB,0xBB,0xB9,0x9A,0x28,0x35,0x55,0x43,0x23,0x12,0x81,0xA0,0xAA,0x9A,0x09,0x41,0x46,0x44,0x33,0x23,0x21,0x33,0x24,0x33,0x32,0x25,0x52,0x23,0x34,0x02,
+0x98,0x99,0x88,0xBA,0xCB,0xDC,0xBC,0xAC,0x09,0x08,0x00,0xFB,0xDA,0xBC,0xDB,0xBB,0xCB,0xAC,0x99,0x88,0x90,0xBA,0xDB,0x9A,0x8A,0x08,0x98,0xBB,0xAC,0x99,0x98,0xB9,
+0xBC,0xAA,0x9A,0x52,0x42,0x43,0x44,0x45,0x53,0x33,0x34,0x53,0x43,0x32,0x44,0x43,0x23,0x22,0x12,0x22,0x33,0x44,0x01,0x88,0xA9,0xCB,0xBB,0x18,0x98,0xBA,0x0C,0x01,
+0x10,0x14,0xB8,0xDF,0xAD,0x9A,0x8B,0x31,0x53,0x33,0x90,0xFC,0xDB,0xBB,0xBA,0xAC,0xAB,0x9A,0x8A,0x18,0x41,0x43,0x02,0xB9,0xCE,0xBB,0xAC,0x99,0x08,0x31,0x22,0x36,
+0x80,0x99,0x98,0x81,0xEB,0x8A,0x98,0x19,0x62,0x14,0xB8,0x9C,0x20,0x11,0xA0,0x71,0x27,0x43,0x25,0x12,0x80,0x00,0x80,0x99,0xB9,0xCB,0x9A,0x09,0x80,0x8A,0x19,0xC0,
+0xBE,0x89,0xCA,0x9C,0x73,0x33,0x81,0x00,0x90,0xAA,0x0A,0x46,0x53,0x44,0x33,0x81,0xA9,0x88,0xA9,0x63,0x34,0x02,0x09,0x18,0x32,0xC8,0xBB,0xFC,0x8B,0x20,0x36,0x34,
+0x33,0x90,0xB9,0xBD,0xDD,0x9A,0x98,0xA9,0xC9,0xBA,0xBD,0xCA,0xBB,0xBA,0xAB,0x30,0x23,0x20,0x57,0x44,0x23,0x12,0x80,0xA9,0x8A,0x01,0x31,0x26,0x53,0x34,0x46,0x22,
+0x01,0x98,0xDB,0xBA,0xAB,0x08,0x01,0x21,0x43,0x23,0xA0,0xEB,0xCC,0xDC,0xBB,0xAA,0xBA,0xCB,0xCB,0x9A,0xDB,0xAB,0xBB,0xCC,0xBC,0xBA,0x9C,0xBA,0xAA,0xCB,0xAB,0x9B,
+0x01,0x33,0x43,0x33,0x45,0x24,0x32,0x11,0x21,0x63,0x45,0x22,0x33,0x43,0x43,0x42,0x22,0x22,0x01,0x28,0x44,0x64,0x33,0x44,0x32,0x34,0x42,0x22,0x12,0x00,0x08,0xA9,
+0xDB,0xAB,0x18,0x32,0x03,0xF9,0xCD,0xDB,0xBA,0xBA,0xBB,0xBB,0x99,0x09,0x22,0x12,0x81,0xDC,0xBD,0xB9,0xCC,0xBB,0xCC,0xAB,0x09,0x18,0x32,0x02,0x98,0xDB,0x9A,0xA9,
+0x99,0x09,0x63,0x67,0x43,0x24,0x23,0x13,0x33,0x12,0x01,0x88,0x98,0xAB,0xAB,0x20,0x80,0x73,0x26,0x43,0x11,0x11,0x80,0x9A,0xA9,0x80,0xCB,0x08,0x73,0x14,0x80,0x91,
+0xDA,0xCC,0xCE,0xCB,0xCC,0xAA,0x99,0x98,0x99,0x99,0xA9,0xBB,0xAB,0xA9,0xA9,0x0A,0x72,0x33,0x54,0x44,0x02,0x89,0x1A,0x22,0x42,0x34,0x34,0x81,0x88,0x32,0x03,0xA9,
+0x19,0x64,0x55,0x35,0x33,0x23,0x24,0x33,0x44,0x13,0x91,0x89,0x88,0xA9,0x08,0x11,0xB8,0xCE,0xAD,0x8A,0xB9,0xCB,0xCB,0xAB,0x31,0x45,0x43,0x23,0x21,0x43,0x22,0x21,
+0x10,0x21,0xF9,0xDC,0xAC,0xCB,0xBC,0xBA,0x9B,0x89,0x88,0x9A,0x9A,0xDC,0xAB,0x89,0x88,0x88,0x38,0x27,0x33,0x81,0xA8,0xFE,0xCC,0xBA,0x99,0x08,0x89,0xDA,0xAC,0x9A,
+0x08,0x01,0xA8,0xBB,0x8B,0x63,0x53,0x02,0x98,0xA9,0x58,0x33,0x90,0x21,0x54,0x53,0x23,0x81,0x90,0x9A,0x08,0x31,0x11,0x03,0x12,0x65,0x75,0x44,0x33,0x23,0x22,0x11,
+0x10,0x21,0x21,0x34,0x25,0x21,0x13,0xC9,0xCD,0xBC,0xBC,0xCB,0x9A,0x09,0x10,0x21,0x33,0x13,0xE9,0xDB,0xDC,0xCB,0xBB,0x9B,0x89,0x88,0xB8,0xB9,0x0B,0x63,0x44,0x81,
+0xBC,0xBB,0x09,0x63,0x21,0x33,0x42,0x44,0x53,0x13,0x81,0x89,0x08,0x32,0x34,0x64,0x43,0x53,0x24,0x33,0x12,0x00,0x8A,0xAA,0xDB,0xBD,0xBA,0x9A,0x18,0x42,0x22,0x90,
+0xEA,0xCC,0xBC,0x9C,0x9A,0x80,0x00,0x08,0xA8,0x99,0x90,0xFC,0xBC,0xBE,0xBB,0xBB,0xBA,0xAC,0xBA,0x89,0x08,0x33,0x34,0x12,0x22,0x25,0x35,0x43,0x43,0x23,0x33,0x46,
+0x22,0xA0,0x99,0x28,0x62,0x55,0x42,0x23,0x32,0x33,0x33,0x90,0x9A,0x18,0x53,0x33,0x14,0x12,0x12,0x22,0x00,0xFB,0xAE,0x9A,0x88,0x10,0x01,0x80,0xFA,0xAD,0xAB,0xB9,
+0xBB,0x18,0x82,0xB9,0xEC,0xEB,0xAB,0x09,0x31,0x56,0x13,0x22,0x01,0x99,0xCB,0xDC,0xBA,0xAC,0x8A,0x08,0x11,0x21,0x00,0xBB,0xCD,0xBC,0xBC,0x9A,0x31,0x47,0x23,0x32,
+0x22,0x01,0x88,0xD9,0xBC,0xBC,0xA9,0x89,0x01,0x10,0x52,0x11,0x98,0xEB,0xCC,0xA9,0x89,0x21,0x22,0x21,0x64,0x35,0x33,0x24,0x02,0x90,0xDA,0xBB,0xAA,0xAC,0xBB,0x18,
+0x53,0x34,0x34,0x33,0x01,0xCA,0xAA,0xCB,0xAF,0x0A,0x32,0x53,0x23,0x35,0x01,0x89,0x18,0x01,0xC9,0xAC,0xCA,0xAC,0xAA,0x09,0xA8,0xDB,0x1A,0x23,0x82,0x68,0x35,0x12,
+0xB0,0xBE,0x09,0x88,0x00,0x21,0x43,0x37,0x44,0x13,0x01,0x98,0x98,0x99,0xEB,0xBA,0x8C,0x38,0x37,0x24,0x33,0x22,0x88,0x98,0x30,0x14,0xB0,0xCC,0x9A,0x19,0x74,0x26,
+0x21,0x80,0xBA,0xBB,0xCF,0xBB,0xBC,0xBA,0x9A,0x20,0x23,0x13,0x90,0x9A,0x00,0x98,0x98,0x9A,0x70,0x35,0x23,0xB8,0xFF,0xBB,0xAA,0xAA,0xBC,0xEB,0xBA,0x9A,0x08,0x52,
+0x23,0x34,0x11,0x12,0x11,0x00,0x88,0x18,0x71,0x35,0x45,0x23,0x12,0x10,0x22,0x11,0xB8,0xAB,0x89,0x41,0x57,0x42,0x33,0x32,0x33,0x44,0x11,0x98,0xCA,0xAC,0xBB,0xAB,
+0x9A,0x98,0x38,0x34,0xB3,0xFF,0xCB,0xB9,0xAB,0xAA,0x09,0x21,0x34,0x34,0x92,0xEB,0xBB,0xAE,0xAB,0x89,0x31,0x46,0x35,0x23,0x02,0x98,0xBB,0xCB,0xBC,0xBB,0x9C,0x8A,
+0x08,0x31,0x34,0x22,0x31,0x34,0x24,0x12,0x00,0x52,0x64,0x34,0x34,0x13,0x01,0x88,0x98,0xA9,0xBF,0xCC,0xBB,0xBA,0x99,0x88,0x88,0x31,0x22,0x90,0xEC,0xAE,0xAB,0xAB,
+0x89,0x81,0x88,0x31,0x47,0x01,0xB9,0xCD,0xAC,0x9A,0x88,0x10,0x32,0x55,0x22,0x02,0x98,0xB9,0x9A,0x30,0x55,0x33,0x54,0x23,0x34,0x21,0x00,0x00,0x88,0xBB,0x9B,0x90,
+0x11,0x20,0x54,0x45,0x13,0x00,0x43,0x27,0x01,0x00,0x10,0x52,0x43,0x22,0x80,0x88,0x33,0x23,0xFA,0xCD,0x89,0x18,0x90,0xAA,0xCD,0xBD,0xAB,0xBD,0xCA,0x8A,0x18,0x44,
+0x43,0x33,0x32,0x81,0x9A,0xBB,0xBC,0xBB,0xBD,0xAC,0x18,0x21,0x22,0xE8,0xBB,0xBA,0xBC,0xAC,0xC8,0xBB,0x40,0x34,0x44,0x82,0xA9,0x99,0xDC,0xAB,0x9A,0xB9,0x1A,0x41,
+0x35,0x24,0x98,0x9A,0x01,0xDB,0xAB,0xAB,0x21,0x32,0x52,0x04,0xBC,0x8A,0x56,0x01,0xC9,0xBB,0x9B,0x88,0x18,0x74,0x14,0x43,0x43,0x34,0x01,0x90,0x9A,0xBA,0xBB,0x19,
+0x55,0x13,0x41,0x44,0x23,0x91,0xB9,0xCB,0xBD,0xCC,0xBB,0xCB,0x9A,0x10,0x23,0x12,0x98,0x99,0xDC,0xBD,0xDC,0xBC,0xBB,0x0A,0x20,0x12,0x22,0x33,0x34,0x11,0x52,0x42,
+0x33,0x43,0x22,0x53,0x33,0x34,0x81,0xBA,0xBC,0x0A,0x30,0x44,0x12,0x88,0x08,0x41,0x37,0x23,0x82,0x99,0x08,0x52,0x44,0x35,0x01,0xA8,0x08,0xA1,0xEC,0xCE,0xAB,0x9C,
+0xAA,0x98,0xB9,0x09,0x51,0x34,0x34,0x81,0xA8,0xAB,0xBB,0xEC,0xCC,0xCC,0x9A,0x19,0x21,0x32,0x00,0x88,0xB9,0x99,0x88,0xBA,0xBE,0x28,0x47,0x43,0x43,0x12,0x22,0x22,
+0x13,0x90,0xAC,0x9A,0x99,0x89,0x08,0x46,0x54,0x34,0x53,0x23,0x32,0x01,0xB8,0xBC,0xBC,0xAA,0x08,0x00,0x62,0x44,0x22,0x32,0x11,0x00,0x98,0xDD,0xCB,0xCC,0xBA,0x9B,
+0x88,0x10,0x11,0x11,0xA8,0xCE,0xAE,0x9A,0xAA,0xBA,0x09,0x62,0x44,0x24,0x03,0x01,0x88,0x88,0xA8,0xDC,0xAB,0x19,0x44,0x33,0x33,0x01,0x89,0x90,0xC9,0xDC,0xBD,0x9A,
+0x21,0x34,0x04,0x91,0x99,0xCB,0xAC,0x9A,0x99,0x8A,0x61,0x45,0x22,0x88,0xB9,0xAA,0xCC,0xAA,0x11,0x22,0x00,0x98,0x99,0xDA,0x9D,0xAA,0xDB,0xAB,0x42,0x25,0x80,0x08,
+0x80,0x18,0x01,0x30,0x05,0xBD,0x8A,0x34,0x03,0xBB,0x09,0xB9,0xCF,0x9B,0x64,0x33,0x12,0x81,0x01,0x89,0x31,0x14,0xFC,0xBB,0x8A,0x08,0x80,0x9A,0xAC,0xCB,0xBC,0xAA,
+0xDD,0xAB,0x30,0x73,0x12,0x22,0x43,0x24,0x22,0x42,0x33,0x23,0x64,0x24,0x32,0x12,0x22,0x13,0x12,0x90,0xDD,0xCB,0x9C,0x99,0xB9,0xAC,0x08,0x53,0x33,0x35,0x11,0x99,
+0x88,0x11,0x83,0xDC,0xCD,0xBA,0xBB,0xCD,0xAC,0xBB,0x9C,0x08,0x33,0x82,0xDA,0xCD,0xAA,0x89,0x32,0x45,0x11,0x21,0x31,0x12,0xD9,0xBC,0xCD,0x8A,0x18,0x21,0x33,0x22,
+0x03,0x80,0xBA,0xAB,0x21,0x25,0x30,0x35,0x35,0x01,0x21,0x56,0x44,0x43,0x32,0x81,0xA9,0x9B,0x99,0xB9,0xBC,0x10,0x24,0x08,0x98,0xAC,0x88,0xB8,0xEF,0xBC,0xBA,0x8B,
+0x31,0x34,0x53,0x35,0x23,0x12,0x90,0xBA,0xBC,0xAB,0x9A,0xCA,0xEB,0xCC,0x9A,0xAB,0xAA,0xCB,0x9A,0x9B,0x71,0x36,0x44,0x12,0x01,0x00,0x32,0x43,0x22,0x90,0xDB,0xAA,
+0xBB,0xAC,0xBB,0xBB,0x9C,0x41,0x32,0x24,0x22,0x41,0x47,0x23,0x32,0x23,0x81,0x9A,0x19,0x22,0xE8,0xDE,0xAC,0x99,0x89,0x21,0x24,0x91,0x89,0x20,0x12,0xBA,0xDD,0xAD,
+0xCA,0xAA,0xBB,0xDB,0xBB,0x8A,0x52,0x43,0x33,0x01,0xA8,0xFB,0xBA,0xCA,0xBC,0xAD,0x9A,0x10,0x42,0x24,0x22,0x01,0x00,0x10,0x21,0x00,0x80,0xA0,0xCD,0x39,0x47,0x33,
+0x13,0x90,0xAA,0xDA,0xDB,0xBC,0xAC,0x89,0x62,0x34,0x33,0x23,0x00,0x18,0x02,0x08,0xA8,0xCB,0x19,0x74,0x25,0x12,0x33,0x32,0x24,0x34,0x34,0x02,0x99,0x9A,0x8A,0xCB,
+0xCD,0x9C,0x89,0x99,0x00,0x11,0xBA,0xBD,0xBD,0xCB,0xBD,0xCC,0x9A,0xA9,0x89,0x19,0x08,0x21,0x45,0x33,0x80,0xEB,0xBA,0xAC,0xCB,0xAA,0x08,0x21,0x44,0x45,0x34,0x11,
+0x10,0x22,0x33,0x43,0x22,0x20,0x33,0x55,0x34,0x03,0xC9,0xCD,0xBA,0xAB,0x09,0x00,0x11,0x00,0x53,0x34,0x25,0x22,0x91,0xFB,0xAC,0x9A,0x88,0xCA,0xBD,0xAC,0x9A,0x8A,
+0x00,0x80,0xA9,0x18,0x62,0x33,0x02,0xCB,0x9A,0x31,0x45,0x43,0x33,0x22,0x32,0x63,0x34,0x13,0x98,0x9A,0xB9,0xBA,0xBE,0xBD,0xCB,0x9B,0x20,0x43,0x03,0xA9,0x09,0x53,
+0x33,0x44,0x82,0xA0,0x39,0x47,0x53,0x33,0x22,0x33,0x23,0x98,0xAA,0xBD,0xBD,0xAD,0xAB,0x9A,0x98,0x18,0xDA,0xDD,0x9C,0x99,0x20,0x52,0x33,0x32,0x02,0xA9,0xFB,0xBB,
+0x9C,0x89,0x0A,0x10,0x00,0xB9,0xFF,0x9A,0x9B,0x88,0x80,0x31,0x36,0x53,0x23,0x81,0xAA,0xBD,0xAC,0x88,0x88,0x08,0x20,0x32,0x74,0x23,0x01,0xAA,0xCF,0xAB,0xBB,0x89,
+0x18,0x21,0x43,0x46,0x33,0x13,0x01,0x08,0x41,0x45,0x32,0x23,0x81,0xA9,0xBC,0x0A,0xA8,0xCA,0xBC,0x89,0x41,0x02,0xAA,0xCB,0xDC,0xAD,0x8A,0x31,0x45,0x43,0x43,0x36,
+0x23,0x22,0x21,0x80,0xBA,0xAD,0xCC,0xCB,0xAC,0x9A,0x18,0x22,0x13,0x11,0xCA,0xFB,0xBB,0xCC,0xAA,0xAB,0x99,0x20,0x63,0x24,0x33,0x13,0x80,0xB9,0xBE,0xBC,0xBC,0xAA,
+0x08,0x44,0x35,0x53,0x33,0x33,0x12,0x02,0x98,0xCA,0xAA,0x18,0x62,0x24,0x32,0x02,0xA9,0xCC,0xAC,0x9A,0xCB,0xAA,0x9A,0x20,0x34,0x33,0x01,0x28,0x44,0x43,0x23,0x02,
+0xB0,0xDC,0x8A,0x22,0x23,0xCA,0xCF,0xBA,0xBD,0xBB,0xCD,0xCA,0xBB,0x9A,0x20,0x33,0x01,0xA8,0x9A,0xCC,0xAA,0x10,0x02,0x88,0x73,0x37,0x44,0x23,0x43,0x02,0xA8,0xCA,
+0x89,0x08,0x22,0x44,0x34,0x44,0x22,0x02,0x98,0xDA,0xAA,0xAC,0xBA,0x19,0x53,0x34,0x44,0x12,0xA0,0xAA,0xA9,0xA9,0xCF,0xCA,0xAB,0xAB,0x9A,0x08,0x80,0xEB,0xCB,0xAB,
+0x99,0x88,0x00,0x11,0x54,0x45,0x44,0x12,0x98,0xCA,0xDB,0xCA,0xAA,0xA9,0xAA,0x18,0x44,0x44,0x12,0x80,0x98,0xB9,0xAA,0x18,0x42,0x12,0x73,0x35,0x34,0x12,0x00,0x99,
+0xA9,0xB9,0xCB,0xEC,0xBC,0xBB,0x88,0x10,0x31,0x23,0x00,0x28,0x45,0x25,0x12,0x98,0xB9,0xCC,0x9B,0x00,0x13,0xA1,0x99,0x29,0x56,0x24,0x01,0xC8,0xBC,0xCB,0x89,0x21,
+0x33,0x02,0x09,0x62,0x14,0xA8,0xCA,0xBB,0xBD,0x8A,0x40,0x33,0x13,0x74,0x35,0x24,0x01,0x80,0x89,0x08,0x01,0x88,0x28,0x22,0x32,0xB1,0xFF,0xAF,0xBA,0xAB,0x8B,0x00,
+0x32,0x53,0x23,0x81,0xA8,0xDC,0x9B,0x98,0xDA,0xBB,0x89,0x32,0x63,0x45,0x43,0x24,0x11,0x10,0x00,0xA9,0xCB,0x89,0x20,0x73,0x43,0x34,0x34,0x22,0x01,0xD9,0xCD,0xBC,
+0xAA,0x9A,0x99,0x89,0x99,0x10,0x43,0x23,0x12,0x88,0x20,0x32,0xA0,0x9C,0x88,0x8C,0x73,0x46,0x03,0xA8,0xCB,0xAC,0xCA,0xCB,0xAA,0x9A,0x89,0x41,0x37,0x33,0x23,0x12,
+0x01,0xA9,0xCC,0xAA,0x0A,0x38,0x57,0x35,0x24,0x33,0x12,0x80,0x99,0xAC,0xA9,0x9A,0x18,0x33,0x55,0x24,0x33,0x02,0xCA,0xEB,0xBB,0xAA,0x09,0x98,0xCB,0xCD,0x9A,0x89,
+0xA8,0xBD,0xDD,0xCB,0xAA,0x9A,0x89,0x88,0x10,0x31,0x46,0x32,0x24,0x01,0x88,0x08,0x00,0x90,0xBB,0xBA,0x80,0x43,0x22,0xD1,0xBF,0xAD,0x09,0x31,0x34,0x22,0x11,0x00,
+0x63,0x54,0x24,0x12,0x12,0x01,0x21,0x23,0xA8,0xCC,0x99,0x00,0x31,0x36,0x32,0x02,0xDA,0x09,0x80,0xAA,0xFF,0xBA,0xBC,0xBB,0xBB,0xBB,0xCD,0xBA,0x89,0x80,0x08,0x18,
+0x00,0x30,0x76,0x34,0x22,0x90,0xB9,0xBB,0xCC,0xAB,0xAA,0x89,0x31,0x47,0x34,0x43,0x22,0x22,0x23,0x32,0x01,0xA8,0xAB,0x38,0x35,0x81,0x61,0x22,0x01,0x18,0x47,0x34,
+0x82,0xB9,0xCB,0xDB,0xCB,0xBB,0x9A,0x10,0x31,0x53,0x32,0x81,0xDA,0xCE,0xEB,0xBB,0xAB,0x89,0x18,0x00,0x42,0x43,0x45,0x32,0x02,0xA8,0xAB,0x18,0x43,0x34,0x11,0x31,
+0x45,0x36,0x31,0x82,0xB9,0xBD,0x9B,0x88,0xB9,0xCE,0xBB,0x09,0x31,0x21,0x33,0xA2,0xDE,0xCB,0xBB,0xCC,0xAB,0x9B,0x20,0x35,0x23,0x22,0x10,0x43,0x53,0x22,0x98,0x9A,
+0x88,0x20,0x32,0x82,0x99,0x39,0x77,0x25,0x12,0x11,0x11,0xB8,0xCE,0xAB,0xAA,0xAA,0x9A,0x51,0x56,0x23,0x34,0x33,0x23,0x98,0xDB,0xBB,0xAD,0xBA,0x88,0x21,0x31,0x53,
+0x22,0x92,0xFB,0xBD,0xCB,0xAA,0xBA,0x9A,0x09,0x00,0x11,0x11,0x22,0xC0,0xBE,0xCD,0xBE,0xDC,0xAB,0x9B,0x89,0x21,0x44,0x44,0x22,0x23,0x22,0x22,0x11,0x00,0x11,0x23,
+0x45,0x34,0x33,0x12,0x02,0xA0,0xBE,0xCC,0xBB,0xBC,0xAB,0x28,0x35,0x25,0x22,0x24,0x43,0x33,0x23,0xA8,0xCD,0x9B,0x28,0x32,0x14,0x11,0xA9,0xFC,0xBB,0xBB,0xCB,0xEC,
+0xBA,0xAA,0x99,0x88,0x08,0x10,0x80,0xAA,0xCD,0xCB,0xBB,0x99,0x18,0x32,0x03,0x99,0x52,0x55,0x32,0x11,0x32,0x56,0x33,0x35,0x32,0x14,0x11,0x32,0x43,0x11,0x80,0x00,
+0x33,0x34,0x34,0x02,0xFA,0xCC,0x9A,0x9A,0x9A,0xCB,0xAA,0x8A,0x10,0x53,0x44,0x12,0x90,0x9A,0xBC,0xBC,0xEC,0xBA,0xCC,0xBA,0x9A,0x10,0x12,0x10,0x11,0x00,0xDA,0xBE,
+0xAB,0xBA,0xBA,0x19,0x54,0x03,0xA9,0x89,0x32,0x03,0x50,0x56,0x34,0x32,0x43,0x55,0x22,0x80,0x88,0x20,0x21,0x80,0x99,0xBB,0xDB,0xAD,0x9A,0xDA,0xDD,0xAB,0x9B,0x89,
+0x08,0x11,0x34,0x33,0x02,0x21,0x33,0x82,0x99,0x0A,0x46,0x35,0x01,0x10,0x53,0x35,0x91,0xDC,0xCC,0xBB,0xBB,0x0A,0x53,0x33,0x33,0x33,0x36,0x11,0xC9,0xDD,0x9A,0xAB,
+0x99,0x20,0x24,0x12,0x00,0x10,0x32,0xA0,0xCB,0x0A,0xA9,0xA8,0x60,0x55,0x35,0x32,0x01,0x11,0x90,0xED,0xBB,0xCC,0xBA,0xAB,0x99,0x8A,0x88,0xCB,0xCB,0x89,0x28,0x11,
+0x44,0x34,0x34,0x52,0x43,0x43,0x23,0x31,0x34,0x46,0x22,0x23,0x12,0x12,0x82,0xBA,0xCD,0xBB,0xBC,0xBB,0x89,0x00,0x01,0x88,0x72,0x45,0x14,0x01,0x10,0x88,0xB9,0xCD,
+0xCB,0xBB,0xBA,0x28,0x45,0x14,0x80,0xBA,0xAA,0x99,0xDA,0xBB,0xAC,0xA9,0x08,0x42,0x24,0x02,0xC9,0xDD,0xBB,0xCC,0xBB,0xAB,0x89,0x41,0x63,0x34,0x53,0x22,0x01,0x88,
+0xAA,0xAA,0x31,0x44,0x25,0x32,0x32,0x54,0x33,0x23,0x01,0x99,0xCB,0xAC,0x88,0x21,0x12,0xA8,0xBA,0xB9,0xFD,0xCB,0xAA,0xA9,0xCE,0xBA,0xAB,0x88,0x01,0x11,0x10,0xB8,
+0xBF,0x8A,0x44,0x26,0x81,0x98,0xAA,0xAB,0xCA,0xCB,0xCD,0xBA,0xBA,0x09,0x10,0x08,0x80,0x20,0x56,0x34,0x33,0x21,0x01,0x01,0x80,0x11,0x22,0xC1,0xCF,0x09,0x63,0x23,
+0x12,0x20,0x42,0x43,0x33,0x11,0x01,0xD9,0xAC,0xBC,0xCD,0xAC,0xAA,0x08,0x33,0x26,0x01,0x88,0xAA,0x99,0x20,0x01,0xFB,0xCB,0xAA,0x30,0x44,0x33,0x03,0xB8,0xDA,0xBA,
+0xEB,0xBC,0xCB,0x8B,0x21,0x26,0x22,0x81,0x98,0x9A,0x98,0xC9,0xDE,0xBA,0x9A,0x30,0x46,0x22,0x11,0xA9,0xAB,0x8A,0x11,0x01,0x21,0xB0,0xDE,0xAC,0x08,0x32,0x36,0x22,
+0x22,0x32,0x23,0x64,0x24,0x01,0xBA,0xCC,0xBB,0xCB,0xBB,0xBC,0xAB,0x9B,0x48,0x47,0x23,0x14,0x32,0x33,0x32,0x12,0x42,0x33,0x14,0x88,0x21,0x43,0x02,0xA9,0xBA,0xDF,
+0xCD,0xCB,0x99,0x08,0x00,0x00,0x42,0x34,0x23,0x12,0x98,0xCB,0xAE,0x9A,0x89,0x00,0x99,0x38,0x35,0x92,0xC9,0xBC,0xDC,0xAE,0xAB,0xAC,0x88,0x09,0x41,0x34,0x43,0x81,
+0x88,0x98,0xCB,0xCB,0xAA,0xAA,0x9B,0x1A,0x54,0x44,0x80,0xBA,0x09,0x41,0x63,0x44,0x53,0x25,0x33,0x22,0x23,0x12,0x98,0x99,0xBA,0xCC,0xCC,0xBA,0x89,0x11,0x81,0xC9,
+0xBB,0xBF,0xCC,0xBB,0xBB,0x9B,0x89,0x21,0x56,0x34,0x32,0x01,0x98,0xCB,0xBE,0xBB,0x9C,0x88,0x08,0x10,0x34,0x35,0x33,0x33,0x23,0x13,0xB0,0xBD,0xBD,0xCA,0xAA,0x00,
+0x52,0x11,0x88,0x88,0x10,0x98,0xCD,0xBB,0x8A,0x31,0x46,0x55,0x22,0x12,0x00,0x80,0x90,0xDB,0xFB,0xBB,0xAB,0x9A,0x99,0x89,0x8A,0x30,0x24,0x81,0xAF,0x9A,0x09,0x43,
+0x34,0x46,0x13,0x12,0x80,0x98,0xCB,0xCF,0xBB,0xAB,0x89,0x88,0x10,0x22,0x43,0x42,0x55,0x43,0x23,0x80,0xAA,0xAA,0x99,0x22,0x34,0x26,0x00,0xA8,0xBA,0xAC,0xDB,0x9B,
+0x89,0x42,0x54,0x44,0x36,0x32,0x02,0x80,0x88,0x88,0xAA,0xDC,0xBA,0xDB,0xCB,0xAA,0x18,0x32,0x22,0xA9,0xED,0xCB,0xDB,0x9A,0x9A,0x08,0x21,0x52,0x34,0x43,0x33,0x33,
+0x13,0xC8,0xDB,0xAA,0x88,0x98,0xB9,0x9A,0x20,0x24,0x43,0x35,0x24,0x81,0x09,0x28,0x36,0x33,0x22,0x00,0x32,0x56,0x33,0x03,0xEA,0xBE,0x9B,0x89,0x10,0x88,0xA9,0xAE,
+0xCA,0x89,0x31,0x23,0xA1,0xCD,0xAC,0x8A,0x10,0x54,0x43,0x12,0x88,0x80,0x00,0x88,0xEC,0xAD,0x9A,0x89,0x00,0x00,0xB8,0xCB,0xAB,0x08,0x53,0x42,0x23,0x63,0x44,0x44,
+0x23,0x23,0x12,0x11,0x11,0x90,0xFD,0xBD,0xCB,0xAB,0xAA,0x99,0x89,0x10,0x31,0x12,0x81,0xA9,0x9C,0x88,0x62,0x34,0x33,0x11,0x43,0x55,0x33,0x33,0x11,0xA0,0xDB,0xAB,
+0x09,0x00,0xA8,0x9B,0x74,0x37,0x23,0x11,0x22,0x01,0xA9,0xAC,0x89,0x01,0xCB,0xBE,0x89,0x12,0x11,0x98,0x9A,0xFA,0xDE,0xAB,0x9A,0x99,0xBB,0x99,0x21,0x12,0x99,0xA8,
+0x73,0x03,0xA9,0x28,0x05,0xEA,0xCC,0xBB,0xCA,0xCD,0xBB,0x19,0x42,0x12,0x10,0x22,0x81,0xEB,0xBC,0x99,0x88,0xB9,0x39,0x77,0x27,0x22,0x01,0x81,0x90,0xA9,0xBA,0x99,
+0x9A,0x8A,0x51,0x46,0x34,0x23,0x23,0x11,0x88,0xBB,0xAC,0x99,0x08,0x11,0x44,0x36,0x12,0x90,0x9A,0x88,0xFB,0xBD,0xBD,0xAA,0x89,0x08,0x31,0x45,0x22,0x90,0x9A,0xAA,
+0xBD,0xDE,0xBB,0xBB,0x9A,0x09,0x41,0x24,0x23,0x12,0x21,0x02,0x98,0x8A,0x65,0x45,0x43,0x31,0x12,0x11,0x00,0x88,0x00,0x01,0x90,0x9B,0x00,0x10,0x09,0x42,0x57,0x24,
+0x11,0xA0,0xDB,0xAB,0xBA,0x99,0xA9,0xB9,0xBF,0xAB,0xDC,0xFB,0xBB,0xBD,0xAA,0xAA,0x08,0x21,0x45,0x34,0x32,0x22,0x11,0x80,0xC9,0xBA,0xBF,0xBC,0xCC,0xA9,0x88,0x00,
+0x81,0x88,0x89,0x88,0x08,0x43,0x44,0x02,0x00,0x63,0x55,0x34,0x24,0x01,0x90,0xB9,0xCB,0xCB,0xBB,0xBD,0xAC,0x08,0x33,0x46,0x22,0x11,0x80,0x98,0x98,0xA9,0xDA,0xBB,
+0x8A,0x53,0x35,0x23,0x33,0x42,0x12,0x80,0xA9,0xBB,0xBD,0xBC,0x80,0x52,0x12,0x01,0x41,0x25,0x11,0xAA,0xAB,0x18,0x44,0x35,0x33,0x92,0xEC,0xCB,0x9A,0xA9,0xCC,0xBB,
+0xBB,0xAA,0x98,0x28,0x22,0xF9,0xCE,0xBB,0x9B,0x99,0x98,0x89,0x99,0x20,0x54,0x45,0x25,0x11,0x80,0xA9,0xAA,0xDB,0xCB,0xBA,0x89,0x42,0x44,0x43,0x22,0x80,0xB9,0x9C,
+0x8A,0x10,0x63,0x33,0x35,0x44,0x24,0x22,0x11,0x00,0x00,0x88,0x98,0xBA,0xCB,0xAD,0x89,0x31,0x36,0x14,0x01,0xBA,0xBA,0xAC,0xBA,0xDB,0xBB,0xAA,0xBA,0xCE,0xBD,0x9A,
+0x09,0x20,0x12,0x90,0x11,0x11,0x54,0x24,0x81,0xEA,0xBC,0xBB,0xCD,0xAB,0x9A,0x30,0x45,0x34,0x35,0x33,0x11,0x00,0x11,0x01,0xC9,0xAB,0x51,0x57,0x22,0x01,0x88,0x99,
+0x08,0x89,0x80,0x88,0xBA,0x48,0x67,0x43,0x24,0x33,0x22,0x00,0xA8,0xDB,0xBB,0xBD,0xBB,0xAD,0xA9,0x99,0x9A,0xAB,0xBC,0xBD,0xBC,0xAA,0x89,0x88,0x00,0x10,0x37,0x44,
+0x22,0x81,0xDA,0xCC,0xAB,0x9A,0xA9,0xCC,0xDB,0x9A,0x28,0x44,0x33,0x33,0x12,0x91,0xDA,0xBB,0x9B,0x08,0x32,0x44,0x34,0x43,0x12,0x00,0x08,0x98,0xEB,0xAD,0x9A,0x18,
+0x54,0x44,0x43,0x13,0x01,0x88,0x88,0xCA,0xCF,0xBA,0x99,0x18,0x21,0x64,0x43,0x32,0x01,0x88,0x80,0xA9,0xDC,0xAC,0xAA,0x89,0x88,0x10,0x11,0x01,0x11,0x44,0x14,0x80,
+0xBA,0xAB,0x08,0x72,0x54,0x24,0x12,0xA9,0xAC,0xA9,0xD9,0xBE,0xCB,0xAB,0xBB,0x9A,0x99,0x20,0x43,0x32,0x44,0x44,0x13,0x21,0x10,0x88,0x80,0x80,0x08,0x00,0x82,0xB0,
+0xBA,0xFB,0xBF,0xAA,0x40,0x43,0x03,0xA8,0xAC,0x89,0x10,0x31,0x44,0x54,0x02,0x11,0x11,0x01,0xD9,0xAE,0xAB,0xAB,0xBA,0xEB,0xBC,0xAA,0x8B,0x20,0x24,0x22,0x08,0x62,
+0x43,0x43,0x34,0x22,0x02,0x91,0x88,0x01,0xD8,0xFF,0xCB,0x9A,0x88,0x08,0x10,0x12,0x34,0x43,0x53,0x33,0x34,0x22,0x00,0x88,0x99,0xAB,0x89,0x64,0x43,0x24,0x00,0x98,
+0x89,0x99,0xEB,0xBB,0xAC,0x30,0x65,0x43,0x24,0x11,0x00,0x88,0x99,0xDA,0xAC,0xBB,0x08,0x34,0x33,0x22,0x90,0xCA,0xCD,0xAC,0xAA,0xA9,0xCE,0xCB,0xAB,0x99,0x08,0x11,
+0x00,0xA0,0xCE,0xBD,0x9B,0x08,0x01,0x20,0x10,0x23,0x54,0x24,0x23,0x23,0x43,0x23,0x23,0xA8,0xBC,0x1A,0x34,0x32,0x22,0x42,0x55,0x34,0x33,0x23,0xA0,0xAF,0xAA,0x09,
+0x31,0x02,0xA9,0x9D,0xBA,0xAA,0x18,0x46,0x33,0x23,0xA0,0xEF,0xAB,0x89,0x31,0x34,0x13,0x01,0x00,0x22,0x13,0x45,0x43,0x35,0x43,0x23,0xA0,0xDB,0xBD,0xAA,0xBD,0xDB,
+0xBB,0xAB,0x09,0x10,0x11,0x90,0xDC,0xAD,0x88,0x32,0x02,0x80,0x70,0x35,0x35,0x13,0x12,0x11,0x91,0xDC,0xAE,0xBB,0xAC,0x9A,0x18,0x62,0x33,0x33,0x22,0x23,0x22,0x80,
+0x9A,0x08,0xA8,0xBC,0xAC,0x52,0x34,0x33,0x32,0x12,0xC9,0xEE,0xBB,0x9A,0x98,0xBA,0x9A,0x41,0x24,0x14,0x32,0x14,0xC8,0xCF,0xBC,0x9B,0x99,0x9A,0xAA,0x99,0xA8,0x9A,
+0x30,0x73,0x02,0xE9,0xBB,0x0A,0x11,0x23,0x34,0x53,0x32,0x34,0x32,0x82,0xEB,0xCD,0xAB,0x10,0x33,0x32,0x23,0x80,0x18,0x74,0x34,0x43,0x00,0xB9,0x9A,0x00,0x11,0x32,
+0x43,0x33,0x22,0x64,0x46,0x33,0x24,0x80,0x08,0x20,0x43,0x54,0x33,0x02,0xBA,0xCF,0xBB,0xAC,0xBA,0xBB,0xAB,0x00,0x31,0x45,0x43,0x23,0x22,0x01,0xA9,0xCC,0xCE,0xBB,
+0xAC,0xAA,0xA9,0x89,0x00,0x88,0xA9,0xAC,0xBA,0xCA,0xCC,0xAB,0x9A,0x20,0x55,0x53,0x24,0x02,0xB8,0xAB,0x20,0x54,0x14,0x81,0x98,0x9A,0x08,0x30,0x36,0x25,0x02,0x01,
+0x42,0x35,0x33,0x13,0x91,0xAB,0xCD,0x9A,0x10,0x33,0x15,0xB8,0xAC,0xBA,0xAA,0xBB,0xEF,0xCC,0xBA,0x89,0x31,0x35,0x42,0x22,0x11,0x81,0xA8,0x9A,0xBC,0xCB,0xBD,0xBA,
+0x89,0x41,0x37,0x45,0x12,0x02,0x80,0xA9,0xCC,0xAD,0xAB,0xAB,0x89,0x20,0x73,0x23,0x02,0x80,0x08,0x00,0xB9,0xCB,0x9B,0x30,0x57,0x54,0x24,0x33,0x01,0x98,0xAA,0xCC,
+0xBB,0xAC,0xAA,0x89,0x09,0x30,0x47,0x33,0x04,0x98,0xCB,0xBA,0x8B,0x50,0x43,0x24,0x12,0x11,0x22,0x12,0x99,0xBE,0xCD,0xBC,0xCB,0x9B,0x08,0x00,0x11,0x11,0x32,0x11,
+0xBA,0xDD,0xBB,0xDC,0x9B,0x09,0x42,0x24,0x12,0x01,0x99,0xDB,0xEB,0xAB,0xCB,0xAB,0x9B,0x51,0x45,0x33,0x34,0x22,0x22,0x22,0x23,0x22,0x81,0xEB,0xBB,0x9B,0x08,0x22,
+0x12,0x81,0xFB,0xAE,0xA9,0x99,0x88,0x99,0x18,0x53,0x35,0x63,0x24,0x33,0x12,0x98,0x99,0xBA,0xBB,0xCE,0xAA,0x89,0x98,0x00,0x00,0x98,0xCB,0xCF,0xCC,0xBB,0xCB,0x89,
+0x20,0x33,0x13,0x11,0x81,0x89,0x18,0x22,0xA1,0xFF,0xBF,0xAA,0x9A,0x89,0x88,0x31,0x47,0x33,0x23,0x11,0x10,0x11,0x33,0x47,0x13,0x90,0xAC,0xBC,0x99,0xAA,0xAA,0x9A,
+0x98,0x10,0x73,0x36,0x34,0x81,0x98,0x8A,0x10,0x21,0x23,0xA0,0xCF,0xBB,0x28,0x75,0x22,0x80,0xAA,0xBA,0xB9,0xAD,0xAB,0x9B,0x08,0x88,0xA9,0x89,0xC0,0xDF,0xCC,0xAA,
+0xAB,0xAA,0x9C,0x89,0x20,0x43,0x22,0x32,0x43,0x36,0x22,0x00,0x18,0x52,0x55,0x24,0x33,0x12,0x01,0x00,0x98,0xC9,0xCE,0xBA,0x9C,0x08,0x22,0x64,0x23,0x33,0x12,0x12,
+0x20,0x12,0x00,0x98,0xBA,0xCB,0x9B,0x30,0x77,0x01,0xDA,0xDB,0xAB,0x08,0x00,0x80,0x08,0x80,0x00,0x52,0x43,0x43,0x12,0x31,0x32,0x54,0x23,0x02,0xCA,0xCF,0xCC,0xBB,
+0xAB,0xAA,0x09,0x52,0x34,0x33,0x13,0x33,0x24,0xA0,0xDD,0xBD,0xBA,0xAC,0xA9,0x18,0x44,0x33,0x24,0x01,0x00,0xBA,0xCF,0xBB,0xAB,0x99,0x18,0x62,0x44,0x34,0x33,0x21,
+0x00,0x08,0xA9,0xCC,0xBA,0xAB,0x99,0x08,0x52,0x44,0x43,0x12,0x80,0xB9,0xCD,0xDB,0xAB,0xAA,0xAA,0x99,0x10,0x44,0x22,0x02,0x08,0x42,0x53,0x02,0xA9,0x99,0xBB,0x9A,
+0x40,0x35,0xA0,0xFB,0xAE,0x9A,0x88,0x08,0x09,0x41,0x53,0x33,0x53,0x23,0x81,0xBB,0x8A,0x11,0x03,0xC8,0xAC,0x38,0x15,0xC8,0x9C,0x40,0x45,0x33,0x23,0x34,0x11,0x80,
+0x18,0x45,0x44,0x23,0x12,0x80,0xB9,0xBD,0xAD,0x09,0x80,0xB9,0xBD,0xCB,0xCC,0xCA,0xBB,0xBC,0x9A,0x99,0x88,0x08,0xA8,0xAB,0x28,0x47,0x01,0x99,0xAC,0x98,0x80,0x08,
+0xCA,0xEC,0xBC,0xBC,0x9A,0x08,0x90,0xCA,0xAA,0x18,0x30,0x45,0x63,0x34,0x33,0x24,0x23,0x21,0x00,0x10,0x54,0x44,0x24,0x12,0x22,0x12,0x01,0x31,0x43,0x23,0x22,0x98,
+0x11,0x37,0x33,0x12,0x99,0xAC,0xCA,0xAC,0xDB,0xEB,0xBE,0xBB,0x9C,0x08,0x11,0x22,0x23,0x22,0x81,0xFC,0xDB,0xBC,0xBB,0xBC,0x9A,0x89,0x21,0x34,0x54,0x24,0x33,0x02,
+0x98,0xBA,0xBB,0xAB,0x9A,0x18,0x31,0x13,0x01,0x65,0x34,0x24,0x02,0xA0,0xFB,0xAB,0x8A,0x89,0xFB,0xBC,0x9B,0x41,0x36,0x33,0x24,0x12,0x81,0xBA,0xAB,0x0A,0x90,0xFB,
+0xAD,0x9A,0x00,0x00,0x08,0x53,0x44,0x13,0x01,0x88,0x10,0x33,0x91,0xFB,0xBF,0x9A,0x08,0x21,0x22,0x02,0x90,0xBA,0xDD,0xAC,0xCC,0xBC,0xCC,0x9B,0x08,0x00,0x80,0x89,
+0x88,0x18,0x12,0x41,0x35,0x24,0x43,0x54,0x43,0x22,0x81,0xBA,0xCC,0xBB,0xBA,0x8B,0x18,0x33,0x56,0x53,0x44,0x42,0x23,0x12,0x80,0xAA,0xAC,0xAB,0x99,0x99,0x89,0x10,
+0x42,0x12,0x33,0x90,0xFB,0xBF,0xCA,0x89,0x61,0x34,0x35,0x33,0x23,0x11,0x81,0x80,0xBA,0xDE,0xBB,0xBD,0xA9,0x09,0x11,0x12,0x80,0x98,0xBA,0xCD,0xEB,0xBB,0xCB,0xAB,
+0xBA,0x89,0x21,0x02,0xB9,0xDC,0xBB,0xDC,0xBB,0xBC,0x9A,0x88,0x89,0x28,0x75,0x35,0x33,0x13,0x02,0x88,0x08,0x11,0x31,0x24,0x11,0x31,0x44,0x74,0x22,0x33,0x23,0x22,
+0x20,0x43,0x23,0x11,0x90,0xCB,0xAC,0x09,0x73,0x25,0x13,0x01,0xAA,0x8A,0xA9,0xFA,0xCB,0xCC,0xAA,0xAA,0x88,0x98,0x00,0x32,0x23,0x22,0x91,0xDF,0xED,0xBB,0xBC,0x9A,
+0x09,0x08,0x9A,0x10,0x42,0x43,0x33,0x33,0x43,0x63,0x13,0x33,0x33,0x35,0x01,0xA8,0xA9,0x09,0x73,0x13,0xA0,0xCD,0xBC,0xAC,0xAA,0x10,0x23,0x80,0xDD,0xDB,0x9A,0x21,
+0x34,0x35,0x24,0x12,0x81,0x99,0x88,0x80,0xC9,0xCE,0xAD,0x8A,0x10,0x11,0x88,0x99,0x88,0x88,0x99,0x8A,0x28,0xE0,0xDF,0xBC,0x99,0x18,0x00,0x80,0x20,0x33,0x82,0xEA,
+0xCE,0xBA,0xAC,0xBB,0x8A,0x28,0x32,0x32,0x22,0x45,0x53,0x34,0x24,0x23,0x01,0x88,0x20,0x44,0x44,0x22,0x11,0x98,0xB9,0x99,0x08,0x11,0xC8,0xDE,0xAB,0x29,0x73,0x35,
+0x24,0x12,0x00,0x10,0x32,0x24,0xB8,0xDF,0xCB,0xAA,0x09,0x31,0x34,0x12,0xA9,0xCC,0xAB,0x08,0x33,0x43,0x80,0x8A,0x20,0x47,0x43,0x13,0x00,0xA9,0xCA,0xAA,0x99,0x00,
+0xD9,0xDC,0xAB,0x99,0x01,0x81,0xC9,0xFD,0xBB,0xCB,0x9A,0x09,0x10,0x33,0x43,0x35,0x32,0x23,0x01,0xCA,0xCE,0xBA,0x8A,0x09,0x98,0x80,0x21,0x74,0x24,0x43,0x02,0xA8,
+0xBB,0xAC,0x00,0x53,0x53,0x43,0x23,0x22,0x43,0x34,0x12,0xC8,0xBE,0xBB,0x9A,0x18,0x12,0x22,0x01,0xCA,0xAB,0x50,0x45,0x14,0x00,0xAA,0x88,0x22,0x73,0x23,0x22,0x90,
+0xED,0xBA,0xBB,0xA9,0xDB,0xEB,0xAA,0x8A,0x18,0x22,0x22,0x32,0x22,0x23,0x54,0x34,0x12,0x90,0x9A,0x10,0x56,0x33,0x03,0xA9,0xAD,0x9A,0x18,0x44,0x43,0x23,0x03,0x81,
+0x88,0x10,0x81,0xFB,0xBF,0xAC,0x9A,0x09,0x81,0xEB,0xCD,0xAB,0x9A,0x08,0x10,0x10,0x10,0x00,0x20,0x51,0x35,0x25,0x88,0xCC,0xAB,0xBB,0xAA,0xAC,0x8A,0x42,0x35,0x23,
+0x12,0x11,0x90,0xFB,0xBC,0xAB,0x89,0x31,0x32,0x34,0x33,0x13,0x98,0xCC,0xCB,0xCB,0xAA,0x9A,0x61,0x54,0x34,0x34,0x32,0x12,0x11,0x21,0x10,0x88,0xCB,0xBB,0x39,0x57,
+0x23,0x82,0xC9,0xBE,0xBB,0x9C,0x9A,0xA9,0x98,0x08,0x42,0x54,0x34,0x34,0x34,0x22,0x90,0xCC,0xBB,0xCB,0xAA,0xAA,0x99,0x99,0xCB,0xAC,0x89,0x21,0xA0,0xCF,0x9A,0x41,
+0x54,0x22,0x33,0x21,0x01,0x90,0x80,0x42,0x23,0xD0,0xBE,0xAC,0x8A,0x18,0x31,0x34,0x52,0x32,0x43,0x01,0x08,0x10,0x32,0x54,0x35,0x22,0x01,0xC8,0xBD,0xCB,0x9A,0xDC,
+0xBC,0xCB,0xA9,0x99,0x98,0x80,0x89,0x98,0x98,0x31,0x56,0x33,0x01,0x88,0x21,0x42,0x44,0x43,0x01,0xB9,0xBD,0xBE,0x89,0x31,0x32,0x23,0x10,0x01,0x32,0x45,0x33,0x80,
+0xB9,0xBF,0xAE,0x8A,0x32,0x44,0x23,0x10,0x80,0x00,0x81,0x90,0x99,0xEC,0xCC,0xAD,0x89,0x32,0x63,0x12,0x10,0x80,0x00,0x89,0x31,0x56,0x25,0x32,0x31,0x53,0x24,0x14,
+0x12,0x02,0x90,0xDA,0xDB,0xAB,0x99,0x08,0x80,0x18,0x10,0x80,0xCB,0xCB,0xDB,0xFB,0xBD,0xCB,0xBB,0xBA,0xAA,0xBA,0xAA,0xAB,0x19,0x74,0x33,0x23,0x88,0xB9,0xCC,0xBD,
+0xBC,0x99,0x08,0x28,0x33,0x64,0x33,0x32,0x23,0x63,0x33,0x12,0x99,0xBC,0xCA,0x9B,0x89,0x32,0x25,0x91,0xCB,0x8A,0x52,0x24,0x33,0x21,0x02,0x42,0x56,0x45,0x23,0x33,
+0x02,0x88,0x88,0x10,0x10,0x00,0xD9,0xBE,0xAB,0x18,0x33,0x44,0x12,0xB9,0xEF,0xAA,0xBB,0xBB,0xBB,0xBC,0x9A,0x18,0x01,0xA9,0xBC,0xBD,0xCB,0x9B,0x08,0x01,0x08,0xAA,
+0xAA,0x72,0x67,0x42,0x22,0x81,0xB9,0xCC,0xAB,0xAA,0x09,0x41,0x23,0x24,0x42,0x35,0x43,0x13,0x11,0x88,0x10,0x21,0x52,0x43,0x33,0x12,0x21,0x01,0x80,0xBC,0xCD,0xBC,
+0xAD,0xAB,0x8A,0x62,0x44,0x22,0x12,0x98,0xFB,0xBB,0xBB,0xCC,0xCC,0xAA,0xA9,0xA9,0xBA,0x9A,0x09,0x43,0x23,0x81,0xAA,0x19,0x28,0x44,0x74,0x44,0x32,0x12,0x00,0x08,
+0x21,0x12,0xC0,0xCD,0xAC,0x9A,0x89,0xA9,0xBB,0xDB,0xAB,0xAB,0x20,0x77,0x23,0x24,0x01,0x01,0x11,0x11,0x90,0xAA,0xCD,0xBB,0xCC,0x99,0x08,0x32,0x34,0x12,0x31,0x64,
+0x23,0x14,0x02,0x11,0x63,0x35,0x44,0x23,0x11,0xA8,0xEB,0xCA,0xAA,0x9A,0xAA,0xBA,0xAB,0x18,0x43,0x44,0x34,0x34,0x12,0xB9,0xBE,0xCC,0xA9,0xAB,0xAA,0x09,0x52,0x23,
+0x12,0xA9,0xCC,0xCB,0xBC,0xAA,0xAB,0xBA,0xAD,0x89,0x43,0x46,0x22,0x02,0x00,0x00,0x10,0x00,0x10,0x12,0xA0,0xAB,0x9C,0x73,0x47,0x23,0x81,0xAA,0xAB,0x99,0x10,0x63,
+0x43,0x22,0x01,0x98,0x20,0x47,0x33,0x12,0xB8,0x9A,0xAA,0x08,0x42,0x43,0x24,0x08,0xA9,0x28,0x35,0x23,0xB9,0xCF,0xBB,0xCC,0xCA,0xBC,0xAB,0xAA,0xBA,0xBD,0xBB,0xAB,
+0x89,0x08,0x99,0x8A,0x40,0x25,0x01,0x30,0x47,0x23,0xB8,0xDD,0xAA,0x18,0x32,0x27,0x33,0x33,0x12,0x00,0x73,0x44,0x34,0x13,0x91,0xBA,0x8B,0x20,0x36,0x53,0x11,0x11,
+0x21,0x01,0xA8,0xBE,0xDB,0xBD,0xBC,0xAC,0x8A,0x28,0x43,0x24,0x43,0x33,0x34,0x11,0xA8,0xDD,0xAC,0xBB,0xBC,0xDB,0xBA,0xAA,0x99,0x89,0x00,0x22,0x11,0xBA,0xBD,0x0A,
+0x73,0x13,0x02,0x10,0x21,0x53,0x36,0x33,0x24,0x12,0xA8,0xFB,0x9B,0x8A,0x00,0x11,0x81,0x11,0x61,0x24,0x44,0x22,0x21,0x01,0x99,0x08,0x71,0x33,0x02,0xD9,0xBC,0x9B,
+0x88,0x10,0xC9,0xDD,0xAB,0xAD,0x8A,0x10,0x53,0x24,0x21,0x11,0x11,0x31,0x33,0x02,0x10,0xA9,0xBB,0xDA,0xAC,0xBB,0xAB,0xEA,0xCC,0xBC,0x8A,0x09,0x81,0x10,0x42,0x44,
+0x34,0x02,0xB0,0xDC,0xDB,0xAA,0x99,0x08,0x12,0x63,0x23,0x23,0xA8,0xFE,0xCB,0xAC,0xA9,0x89,0x00,0x32,0x55,0x22,0x21,0x10,0x41,0x23,0x80,0xCB,0x9D,0x88,0x11,0x22,
+0x35,0x46,0x12,0x01,0xA8,0xAB,0xCB,0xBE,0xBC,0x9C,0x09,0x31,0x53,0x24,0x43,0x22,0x01,0x99,0xAA,0x8A,0x89,0xDA,0xBC,0xAA,0x00,0x12,0x01,0xA9,0x9A,0x01,0x10,0x88,
+0x72,0x57,0x33,0x22,0x22,0x80,0xEB,0xCC,0xAC,0x89,0x00,0x98,0x18,0x42,0x03,0x98,0xAB,0x9A,0xD8,0xCF,0xBC,0x9A,0x51,0x33,0x24,0x33,0x45,0x43,0x33,0x13,0x80,0xCA,
+0xBC,0xCC,0x99,0x08,0x22,0x22,0x11,0x98,0x88,0x10,0x53,0x35,0x35,0x81,0xEB,0xAC,0xAA,0x99,0xA9,0xCA,0xBA,0xAA,0x99,0xA9,0x28,0x54,0x13,0x90,0xEB,0xCC,0xCB,0xBB,
+0xAC,0xA9,0x9A,0xAA,0x9A,0x31,0x25,0xA0,0xDF,0xDB,0x9B,0x89,0x10,0x64,0x32,0x34,0x22,0x22,0x11,0x43,0x33,0x12,0xA8,0xCB,0xAA,0x09,0x43,0x53,0x12,0x90,0xCD,0xBC,
+0x9B,0x98,0x89,0x89,0x21,0x44,0x33,0x33,0x42,0x24,0xC0,0xDF,0xBC,0x9C,0xBA,0xAA,0xAC,0x9A,0x10,0x21,0x12,0x40,0x44,0x35,0x12,0x00,0x09,0x21,0x53,0x53,0x43,0x25,
+0x12,0x80,0xA9,0x99,0xCB,0xCC,0xCC,0xBA,0xBB,0x9A,0x89,0x31,0x54,0x33,0x23,0x53,0x43,0x33,0x32,0x12,0x22,0x13,0x80,0xEB,0xDB,0xAB,0xCB,0xBB,0x9B,0x99,0x88,0xAA,
+0x30,0x76,0x23,0x12,0x21,0x34,0x35,0x23,0x01,0xCA,0xDB,0xAB,0xCB,0xAB,0xDA,0xDA,0xBD,0xBC,0xAD,0x99,0x09,0x11,0x22,0x11,0x11,0x43,0x34,0x25,0x11,0x00,0x88,0x99,
+0xA9,0x10,0x32,0x91,0xDF,0x8B,0x40,0x44,0x25,0x22,0x11,0x80,0x88,0x30,0x44,0x25,0x01,0xBA,0xAB,0x89,0x00,0x10,0x55,0x24,0x12,0xC9,0xCE,0xCB,0xAB,0xAA,0x9A,0x30,
+0x36,0x43,0x22,0x32,0x23,0x33,0x90,0xFB,0xDB,0xCB,0xCB,0xAB,0x19,0x21,0x35,0x42,0x33,0x34,0x23,0x81,0xBA,0xDC,0xBB,0xCB,0x9A,0x8A,0x99,0xAA,0x98,0xA9,0xA8,0x38,
+0x72,0x33,0x13,0xB8,0xCD,0x0A,0x45,0x23,0x90,0xEA,0xBC,0xBD,0x9C,0xAA,0x98,0x88,0x99,0x8A,0x60,0x46,0x33,0x34,0x32,0x24,0x22,0x11,0x08,0x89,0xCA,0xEB,0xBC,0xAA,
+0x89,0x80,0x09,0x10,0x23,0x42,0x01,0x21,0x56,0x34,0x33,0x80,0xA9,0xA9,0xBD,0xCC,0xBA,0xBA,0xBD,0xFB,0xBC,0xBB,0xAC,0x99,0x08,0x18,0x01,0x32,0x22,0x23,0x73,0x24,
+0x13,0x98,0xAA,0x40,0x55,0x33,0x23,0x22,0x26,0x11,0x11,0x31,0x24,0x91,0xCD,0xCB,0x09,0x42,0x33,0x22,0x42,0x22,0xC9,0xBD,0x8A,0x32,0x45,0x22,0x11,0x11,0x34,0x22,
+0x42,0x64,0x23,0xB1,0xCE,0xCC,0xAA,0x88,0x11,0x01,0x80,0x11,0x00,0x80,0x30,0x44,0x33,0xA8,0xDF,0xBA,0x9A,0x08,0x80,0xB9,0xBC,0xEC,0xBB,0x9C,0x89,0x21,0x11,0x01,
+0x10,0x30,0x67,0x33,0x12,0x89,0x99,0x08,0xA8,0x09,0x53,0x44,0x11,0xB8,0xBB,0x8A,0xA8,0xDD,0xBC,0x8A,0x90,0xDB,0xAD,0x0A,0x54,0x43,0x33,0x22,0x11,0x90,0x98,0x09,
+0x63,0x44,0x14,0x91,0xA9,0xAA,0xBB,0xCE,0xBB,0xBC,0xBA,0xBC,0xBA,0x09,0x63,0x34,0x24,0x22,0x22,0x11,0x11,0xB8,0xEC,0xDC,0x9B,0x9A,0x08,0x10,0x31,0x32,0x02,0x98,
+0x09,0x41,0x73,0x14,0x11,0xA9,0x18,0x53,0x35,0x23,0x91,0xE9,0xAC,0xAC,0x9A,0x89,0x08,0x80,0xAA,0x19,0x72,0x25,0x02,0xA8,0xBC,0xBC,0xAB,0x30,0x67,0x22,0x22,0x00,
+0x01,0x21,0x21,0x91,0xDC,0xBE,0xAB,0xAB,0x9A,0x08,0x89,0x00,0x51,0x33,0x33,0x80,0xDB,0xCC,0xBC,0x99,0x00,0x91,0xCD,0xCC,0xAB,0xAA,0x89,0x01,0x12,0x90,0x09,0x66,
+0x53,0x23,0xA0,0xBC,0xBD,0x99,0x89,0x08,0x80,0xA0,0x9B,0x2A,0x67,0x44,0x33,0x11,0x88,0x20,0x51,0x44,0x34,0x24,0x21,0x08,0x99,0x08,0x00,0xA8,0xED,0xBB,0x9B,0x88,
+0x00,0x53,0x34,0x33,0x24,0x32,0x43,0x44,0x21,0xA9,0xCC,0xBB,0xBA,0xAA,0xAA,0xAA,0xFB,0xBC,0xBC,0x89,0x11,0x32,0x12,0x52,0x43,0x34,0x01,0x09,0x42,0x36,0x11,0x9A,
+0xDB,0xBC,0xDC,0xBB,0xBB,0x9C,0x99,0x98,0x08,0x42,0x46,0x33,0x22,0x21,0x21,0x22,0x12,0x11,0x11,0xC8,0xCF,0xBC,0xAA,0x88,0x11,0x08,0xDA,0xBB,0xAB,0x08,0x55,0x53,
+0x24,0x22,0x22,0x11,0x08,0x88,0xA9,0xCF,0xBB,0xAB,0x18,0x22,0x24,0x12,0x31,0x22,0xC9,0xBE,0xAE,0xCB,0xBC,0xBA,0x09,0x42,0x34,0x33,0x02,0x98,0xBA,0xAC,0x88,0x99,
+0xDA,0xAD,0x9A,0x31,0x55,0x23,0x42,0x42,0x33,0x12,0x80,0xDA,0xBC,0x9C,0x09,0x33,0x43,0x24,0x01,0xB9,0x9B,0x20,0x43,0x02,0xB9,0xCF,0xCE,0xAB,0xAA,0x99,0xDA,0xCB,
+0xBC,0x8A,0x20,0x54,0x33,0x44,0x22,0x12,0x12,0x02,0x90,0xCC,0xCC,0xBC,0xAA,0x99,0x18,0x22,0x35,0x12,0x80,0xA8,0xBB,0xCC,0xBC,0xBC,0xBB,0x98,0x00,0x31,0x42,0x47,
+0x53,0x14,0x01,0xB9,0xCB,0xBA,0x9C,0x09,0x41,0x43,0x33,0x22,0x22,0x43,0x11,0xDA,0xCC,0xBB,0x9A,0x9B,0x28,0x46,0x53,0x33,0x21,0x01,0x22,0x81,0xFB,0xCC,0xAC,0x99,
+0x10,0x22,0x25,0x43,0x22,0x91,0xAA,0xAA,0x89,0xA9,0xCB,0xAD,0x9A,0x18,0x73,0x34,0x34,0x12,0xA0,0x9A,0x9C,0xAA,0xBD,0xAD,0x0A,0x21,0x14,0x01,0x21,0x44,0x22,0x02,
+0x9A,0x38,0x56,0x24,0x02,0x98,0xAB,0x9B,0x98,0x99,0x30,0x35,0xA2,0xEF,0xBB,0xBA,0x9A,0xBC,0xBC,0xAB,0x08,0x12,0xA8,0x9C,0x40,0x45,0x43,0x12,0x21,0x21,0x00,0xCA,
+0xAE,0x09,0x45,0x43,0x12,0x00,0x11,0x23,0xA0,0xBE,0xBA,0x89,0xA8,0xFB,0xCC,0xAB,0x99,0x98,0x98,0x20,0x47,0x23,0x02,0xB9,0xAC,0x89,0x00,0xB8,0xBE,0xAE,0xAB,0xDB,
+0x99,0x18,0x64,0x43,0x32,0x11,0x01,0x11,0x21,0x00,0x10,0x42,0x24,0x02,0x80,0x18,0x14,0x91,0xED,0xBD,0xCB,0xAB,0xB9,0x9A,0x10,0x55,0x34,0x33,0x34,0x24,0x34,0x11,
+0xA9,0xDC,0xAC,0xAB,0xAB,0xA9,0x9A,0xCB,0xCB,0xBC,0x9A,0x21,0x44,0x23,0x21,0x22,0x42,0x44,0x43,0x22,0x80,0xDA,0xBD,0xBB,0x9C,0xA9,0xA9,0xDB,0xAB,0xAB,0x88,0x11,
+0x32,0x24,0x18,0x20,0x55,0x25,0x34,0x33,0x02,0xB9,0xAE,0xBB,0xAC,0x8A,0x89,0x08,0x10,0x54,0x44,0x63,0x33,0x24,0x22,0x80,0xBA,0xCB,0xAB,0x89,0x20,0x42,0x24,0x12,
+0x08,0x08,0x44,0x44,0x01,0xC9,0xBB,0xBD,0xAA,0x19,0x10,0x02,0x98,0xCF,0xDB,0x9B,0x10,0x11,0x81,0x00,0x81,0x32,0x35,0x33,0x81,0xC1,0xDD,0xDD,0x9A,0x28,0x42,0x02,
+0x90,0x99,0x09,0x42,0x36,0x23,0x91,0xB9,0xCD,0xAA,0x19,0x54,0x34,0x01,0x01,0x00,0x11,0x11,0x10,0xBB,0xEC,0xDB,0xCB,0xAB,0x89,0x81,0xC8,0xBC,0xBB,0x89,0x10,0x53,
+0x34,0x34,0x23,0x21,0x89,0x08,0x11,0x11,0x09,0x01,0x48,0x65,0x53,0x44,0x32,0x03,0xA0,0xBF,0xBC,0x9B,0x9B,0x98,0x11,0x82,0xC9,0xAE,0x0A,0x71,0x34,0x22,0x90,0xBA,
+0xCB,0xBB,0xDA,0xAB,0xA9,0xAA,0xCC,0x89,0x31,0x54,0x23,0x11,0x12,0x43,0x35,0x24,0x00,0x99,0xAA,0xCC,0xBB,0x19,0x72,0x25,0x12,0x01,0xA8,0xBD,0xDD,0xAB,0x9A,0x08,
+0x21,0x43,0x23,0x53,0x25,0x35,0x43,0x33,0x02,0xA0,0xDB,0xBB,0xBB,0xBA,0x89,0x89,0x88,0x20,0x11,0x81,0x81,0x99,0xFC,0xBC,0x9C,0x40,0x34,0x13,0xA9,0xBC,0x0A,0x53,
+0x24,0x12,0xB8,0xDD,0xDA,0xAB,0xA9,0x20,0x34,0x12,0xA8,0xCB,0x8A,0x11,0x01,0x9A,0xDB,0xBC,0xBD,0xAD,0x89,0x42,0x34,0x33,0x12,0x01,0x22,0x03,0x90,0xFB,0xDA,0xAA,
+0xBC,0xCB,0x0B,0x42,0x36,0x23,0x81,0x99,0x41,0x47,0x24,0x23,0x11,0x91,0xCA,0xCB,0xAA,0x88,0x88,0xB9,0xBF,0xAC,0x8A,0x31,0x25,0x23,0x01,0xB9,0xBC,0xAB,0x09,0x25,
+0x32,0x12,0x81,0x09,0x11,0x24,0xE0,0xCD,0xBD,0xBB,0xAA,0x10,0x32,0x81,0x98,0x1A,0x23,0x37,0x45,0x53,0x22,0x01,0xA9,0xDC,0x9A,0x31,0x45,0x13,0x11,0x88,0xC9,0xCA,
+0xAC,0x89,0x20,0x00,0xEB,0xCC,0x9A,0x10,0x33,0x44,0x32,0x23,0xA1,0xDC,0xBC,0xAB,0xB9,0xBC,0xCD,0xAA,0x28,0x53,0x34,0x32,0x33,0x22,0x02,0x11,0x13,0x23,0xB8,0xDF,
+0xCB,0x9B,0x30,0x53,0x02,0xA0,0xCA,0xBB,0xBB,0xAC,0xAB,0x09,0x20,0x81,0x99,0x72,0x47,0x43,0x01,0xCA,0xCB,0xBC,0xAB,0x9D,0x9A,0x00,0x32,0x24,0x42,0x32,0x44,0x22,
+0x01,0x00,0x28,0x32,0x91,0xDA,0xAD,0xCC,0xCA,0xBA,0x8A,0x10,0x33,0x23,0x80,0x18,0x66,0x35,0x43,0x22,0x21,0x11,0x90,0xA9,0xBC,0xAC,0x8A,0xA9,0xBD,0xAC,0x99,0x88,
+0x80,0x21,0x52,0x25,0x54,0x35,0x44,0x33,0x33,0x02,0x99,0xCA,0xAB,0xCA,0xBB,0xCC,0xCC,0xCB,0x9A,0x89,0x10,0x43,0x43,0x23,0x81,0x98,0x89,0x10,0x24,0x81,0xEC,0xBC,
+0xDB,0xCA,0xBB,0x8A,0x20,0x33,0x80,0xD9,0x89,0x20,0x80,0xB9,0x28,0x57,0x33,0x02,0x21,0x55,0x53,0x22,0x32,0x32,0x43,0x81,0xC9,0xCC,0x9B,0x88,0x80,0x88,0x20,0x25,
+0x03,0xB9,0xBE,0xAC,0xAB,0x98,0x80,0x80,0x73,0x21,0x91,0x98,0x43,0x26,0x81,0xDD,0xBD,0xCB,0xAA,0x89,0x10,0x43,0x34,0x15,0x11,0x10,0x31,0x02,0xA0,0xBB,0xCC,0xAA,
+0x9C,0x1A,0x20,0x32,0x84,0xC8,0xBC,0x08,0x23,0x02,0x98,0x80,0x42,0x12,0x64,0x22,0x93,0xDD,0xED,0xBC,0xBB,0x9A,0x20,0x42,0x44,0x22,0x11,0x10,0x21,0x22,0x11,0x80,
+0xB9,0xBE,0xBB,0x2A,0x56,0x35,0x33,0x02,0xA9,0xBA,0xCB,0xA9,0xAB,0xD9,0x9B,0x9B,0x31,0x74,0x25,0x33,0x12,0xA8,0xDB,0xBB,0xBB,0xCB,0xEC,0xAC,0xCB,0xAA,0x8A,0x00,
+0x32,0x43,0x13,0x81,0x31,0x56,0x35,0x34,0x11,0x81,0xA8,0xCB,0xDB,0xCB,0xAA,0xAB,0xA9,0x99,0x09,0x28,0x33,0x32,0x44,0x42,0x13,0x00,0x99,0xB9,0xBB,0xAC,0x51,0x64,
+0x33,0x23,0x32,0x43,0x12,0xA0,0x99,0x38,0x46,0x35,0x44,0x33,0x26,0x23,0x22,0x21,0x44,0x42,0x12,0xC9,0xCC,0xCA,0xA9,0x98,0x90,0xA8,0xB9,0xBD,0xDC,0x8A,0x19,0x21,
+0x22,0x98,0xCC,0xAA,0x0A,0x31,0x15,0x21,0x11,0x10,0xDB,0xBB,0xA9,0x11,0x12,0xAA,0xCC,0xA9,0xA0,0xDA,0xBF,0xAC,0x9A,0xA9,0xCA,0xAB,0xBC,0x99,0x80,0x60,0x55,0x65,
+0x32,0x23,0x12,0x01,0x80,0x9A,0xBC,0xAB,0xCA,0xBA,0xBC,0xBA,0x99,0x18,0x81,0x08,0x1B,0x32,0x47,0x22,0x00,0x31,0x43,0x46,0x43,0x33,0x13,0xB0,0xEE,0xBC,0xAC,0x9A,
+0x08,0x21,0x22,0x11,0x12,0x31,0x56,0x73,0x33,0x43,0x12,0x12,0x10,0x90,0xA9,0xCD,0xFB,0xBB,0xCB,0xBB,0xAA,0x99,0x88,0x21,0x52,0x33,0x23,0x23,0x12,0x81,0x89,0xAC,
+0x99,0x11,0x16,0x32,0x11,0xDA,0xDA,0xBF,0xBD,0x9C,0x09,0x21,0x53,0x43,0x24,0x23,0x12,0x11,0x00,0x91,0x99,0xED,0xBC,0xAC,0x89,0x21,0x32,0x34,0x12,0x81,0xDB,0xAB,
+0x9A,0x08,0x00,0xB2,0xBD,0xBD,0x09,0x62,0x24,0x13,0x81,0x99,0xAA,0x09,0x11,0x11,0x02,0xDB,0xF9,0xAA,0x30,0x34,0x01,0xDB,0x9C,0x88,0x41,0x44,0x14,0xA8,0xCC,0xDA,
+0xAA,0xAA,0x09,0x33,0x43,0x81,0xB9,0xCA,0x20,0x63,0x22,0x08,0x21,0x24,0x14,0x09,0x41,0x56,0x13,0x82,0xB9,0xAC,0x39,0x36,0x43,0x22,0x31,0x25,0x11,0x01,0x21,0x43,
+0x05,0xD8,0xCE,0xBB,0xAB,0x99,0x99,0xAA,0xA9,0xAA,0x9A,0x88,0x80,0x63,0x44,0x12,0x89,0x09,0x42,0x43,0x22,0x43,0x33,0x28,0x0A,0xAA,0xCF,0xBC,0xBC,0xCC,0xBB,0xAB,
+0x0A,0x99,0xB0,0x30,0x45,0x25,0x34,0x34,0x32,0x33,0x32,0xA1,0xE8,0xAA,0xA9,0xB9,0xEC,0xCB,0xAC,0xAB,0x89,0x00,0x80,0x11,0x11,0xC0,0xB8,0x10,0x83,0xBB,0xFF,0xBB,
+0xCB,0x9A,0x19,0x42,0x35,0x20,0x98,0xB9,0x9D,0x9A,0x08,0x11,0x54,0x57,0x43,0x25,0x23,0x23,0x12,0x21,0x10,0x11,0x11,0x00,0xEB,0xCC,0xAD,0xAB,0x9A,0x90,0x80,0x9A,
+0xA9,0xBA,0x0B,0xAB,0x20,0x35,0x41,0xC0,0xBC,0x8E,0x10,0x01,0xEB,0x9A,0x09,0x21,0x11,0x91,0x08,0x52,0x45,0x21,0x31,0x52,0x34,0x04,0x99,0xCC,0xCB,0xAB,0xDA,0xAA,
+0xBA,0x88,0x98,0x9B,0x19,0x76,0x44,0x42,0x12,0x21,0x88,0x99,0x89,0x08,0x01,0x91,0xEC,0xBC,0xBA,0x19,0x20,0x22,0x21,0x12,0x10,0x83,0x33,0x57,0x45,0x21,0xA0,0xFB,
+0xAB,0xCB,0x9A,0xBB,0xCA,0x9A,0x18,0x52,0x53,0x23,0x33,0x13,0x01,0x09,0x11,0x44,0x12,0x91,0xDD,0xDB,0xCC,0xBA,0x9A,0x28,0x42,0x23,0x13,0x01,0x32,0x27,0x53,0x43,
+0x33,0x12,0xA8,0xB9,0x1A,0x63,0x26,0x02,0x81,0x88,0x80,0x11,0x90,0xDB,0xFB,0xBC,0xAC,0x9A,0x31,0x33,0x13,0x90,0xDA,0xA8,0xBA,0xA0,0x80,0xFC,0xCE,0xCB,0x9C,0x08,
+0x32,0x26,0x22,0x22,0x80,0x99,0xCA,0x9B,0x89,0x9A,0xEB,0xCC,0xBC,0x99,0x00,0x22,0x53,0x43,0x22,0x81,0x88,0x8A,0x21,0x23,0x82,0xEB,0xAE,0xBA,0x99,0x0B,0x09,0xA1,
+0xC9,0xBE,0xAD,0x8A,0x28,0x08,0xCB,0xCD,0x9A,0x48,0x53,0x44,0x12,0x02,0x80,0xAA,0xCB,0xCC,0xAA,0xA9,0xBB,0x9E,0x8A,0x34,0x47,0x32,0x24,0x12,0x22,0x21,0x02,0x00,
+0x00,0x41,0x02,0x81,0x88,0x18,0x21,0xA2,0xFD,0xAD,0xBB,0xAB,0xBD,0xBC,0xA9,0x80,0x01,0x08,0x18,0x31,0x42,0x98,0x9C,0xAC,0x0A,0x33,0x82,0xB0,0x0C,0x08,0xFC,0xDF,
+0xBA,0x99,0x8A,0x89,0x08,0x12,0x43,0x54,0x23,0x22,0x21,0x43,0x12,0xA0,0x8B,0x0C,0xBC,0x9C,0x99,0xCA,0xCC,0x99,0x31,0x42,0x28,0x21,0x75,0x22,0x33,0x43,0x32,0x53,
+0x43,0x43,0x21,0x32,0x23,0x91,0xFB,0xBD,0xBC,0xBC,0xCA,0xAB,0xBB,0x9A,0x08,0x31,0x36,0x44,0x25,0x32,0x23,0x11,0x90,0xFB,0xBA,0xBC,0xBB,0x9C,0xA9,0x98,0x80,0x80,
+0x21,0x34,0x36,0x12,0x21,0x18,0x11,0x01,0x12,0x00,0x8B,0x70,0x27,0x23,0x32,0x42,0x42,0x23,0x24,0x73,0x42,0x13,0x00,0xD9,0xCB,0x8A,0x20,0x31,0x12,0x13,0x82,0xA0,
+0x8C,0x80,0xDA,0xDC,0xCC,0xCE,0xAA,0x9B,0x28,0x11,0x42,0x33,0x35,0x23,0x21,0x02,0xC9,0xFB,0xCB,0xCB,0xAB,0x9A,0x21,0x44,0x22,0x43,0x11,0x12,0x18,0x08,0xA9,0x9B,
+0xBC,0xCE,0xBC,0x9B,0x28,0x41,0x11,0xB9,0xBF,0xCB,0xAB,0xA9,0x8B,0x89,0x01,0x82,0xC0,0x0A,0x70,0x27,0x32,0x81,0x89,0x98,0x08,0x08,0xA9,0x9A,0xBD,0xDC,0xAD,0x09,
+0x38,0x55,0x21,0x13,0x21,0x63,0x63,0x33,0x22,0x02,0x81,0x98,0x88,0x01,0x12,0x03,0xCA,0xDF,0xAC,0x99,0x18,0x11,0x00,0x9A,0xBA,0x0B,0x28,0x24,0x54,0x12,0x90,0xBC,
+0xBC,0x80,0x82,0xB0,0xFF,0xBA,0xAB,0xA9,0x80,0x21,0x32,0x28,0x82,0x80,0x30,0x77,0x12,0x82,0x99,0x9C,0xCC,0xBB,0xAA,0x08,0x08,0xCA,0xCC,0xBB,0x9C,0x11,0x43,0x31,
+0x43,0x25,0x11,0x11,0x52,0x27,0x33,0x12,0x98,0x9B,0x9B,0x32,0x25,0x43,0x11,0x14,0x13,0x00,0x9D,0xCA,0xBC,0xDC,0xBB,0xBD,0x9C,0x00,0x01,0x90,0x89,0x12,0x73,0x23,
+0x00,0x9B,0x99,0xAA,0xB0,0x08,0x78,0x44,0x33,0x11,0x10,0x00,0x05,0xA8,0xBD,0xA9,0x34,0x36,0x12,0x03,0x23,0x34,0x14,0x22,0x28,0xB0,0xC0,0xFB,0xBD,0x99,0x00,0x81,
+0x89,0x08,0x80,0x80,0xFC,0xAD,0xAA,0x0A,0x63,0x34,0x42,0x22,0x32,0x11,0xD9,0xAC,0xAD,0x99,0xA9,0xC9,0xAC,0xAC,0x09,0x10,0x11,0x99,0x28,0x52,0x43,0x23,0x0A,0x22,
+0x56,0x23,0x14,0x81,0x89,0xA9,0xDE,0xBA,0x99,0x41,0x24,0x24,0x02,0x11,0x01,0x81,0xA9,0xBF,0xEC,0xBA,0xEB,0x9A,0x89,0x01,0x43,0x22,0x33,0x24,0x11,0x90,0xAB,0xBD,
+0xBA,0xBB,0x0B,0xAC,0x89,0x38,0x57,0x44,0x32,0x33,0x00,0xA9,0xCB,0x9A,0x0B,0x21,0x24,0x08,0x9D,0x9A,0x51,0x53,0x32,0x33,0x23,0x54,0x43,0x33,0x00,0xC9,0xD9,0xCD,
+0xEB,0x9A,0x08,0x11,0x88,0xAA,0xAC,0x99,0x21,0x54,0x33,0x34,0x12,0x11,0x08,0x80,0x01,0x80,0xB0,0xCB,0x0B,0xFF,0xC9,0xAA,0xBA,0x8A,0x89,0x80,0x32,0x65,0x14,0x22,
+0x18,0x31,0x44,0x33,0x11,0x08,0x9A,0xDF,0xCB,0xBD,0xBA,0x89,0x08,0x08,0x80,0x88,0x80,0x61,0x35,0x43,0x34,0x12,0x02,0x08,0x80,0x20,0x10,0x80,0xDA,0xCF,0xBC,0xBC,
+0xBA,0x8B,0x89,0x80,0x11,0x43,0x26,0x23,0x24,0x42,0x23,0x11,0x80,0x80,0xA9,0xCE,0xBA,0xBC,0xB8,0x99,0x00,0x8A,0x0D,0x08,0x24,0x73,0x43,0x34,0x35,0x23,0x23,0x11,
+0x91,0xB9,0xBB,0xEC,0x9B,0xCA,0xB9,0xCC,0xB9,0x98,0x80,0x80,0x21,0x24,0x53,0x33,0x41,0x08,0x28,0x20,0xB3,0xDC,0x9E,0x9A,0xCB,0xCC,0xAB,0xBA,0x90,0xA0,0x82,0xB0,
+0xBB,0x9F,0x0A,0x22,0x35,0x34,0x24,0x82,0xA9,0xD8,0x98,0x88,0x33,0x06,0x03,0x02,0x36,0x47,0x42,0x33,0x31,0x11,0x81,0x09,0xDB,0xCA,0xBC,0xBC,0xDB,0xAA,0x9B,0x90,
+0x21,0x63,0x13,0x12,0x01,0xA8,0x89,0xBA,0xCD,0xBB,0xDC,0xAB,0x98,0x21,0x34,0x43,0x35,0x12,0x01,0x08,0x28,0x63,0x25,0x33,0x11,0x01,0x80,0x23,0x03,0xD0,0xBB,0xFB,
+0xCC,0xAA,0x9A,0x12,0x52,0x13,0x22,0xE0,0xBB,0x9D,0xBB,0xEB,0x9B,0x89,0x31,0x56,0x21,0x23,0x02,0x32,0x43,0x13,0x98,0xAA,0xB0,0xF0,0xCC,0x9A,0x08,0x14,0x24,0x81,
+0x08,0xC9,0x98,0xAA,0xDA,0x08,0x72,0x43,0x11,0x02,0x81,0x82,0xAA,0xAB,0xCB,0xB0,0xDF,0xCB,0x9D,0x9A,0x89,0x01,0x20,0x11,0x14,0x82,0x80,0xBA,0x80,0x40,0x03,0xD8,
+0xC0,0x8A,0x80,0x44,0xB8,0xAC,0x38,0x70,0x81,0xBA,0xDF,0xBA,0x9A,0x09,0x08,0x12,0x53,0x10,0xA2,0xCD,0x8A,0x23,0x37,0x04,0x81,0x88,0xBB,0xC9,0xA9,0x20,0x52,0x32,
+0xA0,0xAD,0x89,0x32,0x25,0x22,0x53,0x42,0x32,0x52,0x30,0x42,0x25,0x24,0x11,0x08,0x21,0x22,0xA2,0xCF,0xAD,0xBB,0xAD,0xCB,0xBB,0x89,0x80,0x01,0x89,0x20,0x44,0x46,
+0x11,0x91,0x88,0x08,0xBA,0xBE,0xCD,0x9A,0x88,0x99,0x99,0xB9,0x30,0x15,0x03,0xA8,0x0A,0x08,0x87,0x12,0x20,0x30,0x33,0x47,0x63,0x43,0x35,0x22,0x01,0xBA,0xBB,0xB9,
+0x99,0x28,0x58,0x82,0xB0,0xFA,0xBB,0x8B,0x22,0x27,0x11,0x08,0x9A,0x8A,0x00,0x83,0x34,0x03,0xD0,0xCF,0xBD,0xCB,0xBA,0xA9,0x99,0x98,0x01,0x22,0x45,0x16,0x32,0x43,
+0x41,0x32,0x18,0x99,0xE9,0xA9,0xAB,0xBC,0xAE,0x9A,0x9A,0x80,0x10,0x41,0x53,0x24,0x33,0x32,0x01,0x91,0x0B,0x0E,0x0C,0xAB,0x89,0x80,0x33,0x78,0x84,0x32,0x84,0x03,
+0x02,0x32,0x33,0x74,0x33,0x55,0x11,0x02,0xB9,0xDC,0x9A,0x9C,0xAA,0x00,0x89,0xA9,0xA0,0x8A,0x30,0x73,0x27,0x13,0x81,0xA9,0x9B,0x10,0x23,0x60,0x10,0xA0,0xE8,0x9B,
+0x9C,0x8E,0x9B,0x0A,0x80,0xD0,0xA0,0x20,0x42,0x34,0x15,0x11,0x80,0x9A,0xAB,0xBB,0xAC,0xCB,0x0B,0xDC,0xC8,0xAB,0xAA,0xB8,0x00,0xC8,0x08,0x34,0x74,0x33,0x25,0x38,
+0xA0,0xA9,0x9D,0x9C,0xBB,0xAE,0xBB,0xCB,0xB9,0x89,0x10,0x55,0x33,0x24,0x32,0x11,0x12,0x25,0x12,0x20,0x38,0x38,0x64,0x28,0x01,0x20,0x80,0x80,0x40,0x8B,0xD0,0xDC,
+0xCA,0xAD,0xBC,0x9A,0x38,0x43,0x43,0x32,0x02,0xA8,0x0B,0x48,0x78,0x11,0x84,0x01,0xAA,0xCC,0x9B,0x8A,0x20,0x73,0x11,0xA9,0xDC,0x9C,0x99,0x11,0x23,0x21,0x23,0x30,
+0x08,0x08,0x68,0x36,0x26,0x01,0x9A,0xCB,0xAB,0x8B,0x8A,0xB0,0x08,0x48,0x40,0x80,0x80,0x80,0x57,0x02,0x22,0x03,0x03,0xD8,0xFB,0x9A,0xCA,0xC9,0xAB,0x89,0x80,0xBB,
+0xBF,0x9E,0x99,0x28,0x38,0x22,0x38,0x33,0x03,0x80,0xBD,0x08,0x08,0x45,0xB8,0xC8,0xCB,0x80,0x40,0x73,0x14,0x26,0x31,0x13,0x11,0x08,0xDA,0xB9,0xBC,0xBA,0x9D,0xA9,
+0x00,0x24,0x82,0x33,0x73,0x53,0x34,0x15,0x01,0xA8,0xAA,0xCC,0xA9,0x8B,0x18,0x32,0x35,0x81,0xC0,0xB8,0xA8,0x0B,0x0F,0x9C,0xAA,0xAB,0xBC,0xA8,0x0A,0x33,0x78,0x24,
+0x43,0x13,0x08,0x80,0xAB,0xCB,0xBB,0xF0,0xA8,0x0A,0x80,0x80,0x0C,0x3B,0x44,0x57,0x21,0x22,0x18,0x00,0xA8,0xB0,0x0B,0xBC,0xBB,0xBC,0xBF,0x9C,0x9B,0x28,0x52,0x24,
+0x43,0x28,0x0A,0x80,0x80,0x80,0x80,0x04,0x08,0x8D,0xDB,0xEB,0xC9,0x9A,0x0A,0x8A,0x0B,0x08,0x0D,0x08,0x08,0x50,0x48,0x33,0x40,0xC0,0xBB,0xEF,0xA9,0x9B,0x10,0x32,
+0x43,0x22,0x22,0x30,0x24,0x43,0x33,0x07,0x23,0x08,0xB8,0x0B,0x0C,0xC8,0xB0,0xBC,0xAC,0xCB,0x0B,0x0C,0x80,0x57,0x62,0x23,0x22,0x32,0x32,0x15,0x81,0x99,0xBC,0xBB,
+0xAE,0xB9,0xBA,0x89,0x20,0x23,0x03,0x27,0x73,0x23,0x13,0x83,0xA9,0xBC,0xBC,0xBA,0x0B,0xB0,0xB8,0xBC,0x9F,0x0C,0x2A,0x08,0xA8,0xB8,0xAC,0xFB,0xBA,0x0A,0x38,0x16,
+0x12,0x24,0x33,0x22,0x33,0x80,0xFC,0xDB,0xAC,0xBA,0xAB,0x9B,0xAA,0x20,0x00,0x37,0x21,0x44,0x11,0x43,0x12,0xA2,0xA8,0x08,0x08,0x37,0x51,0x41,0x81,0xA2,0x80,0xAB,
+0xB8,0x03,0x04,0xD8,0xDE,0xBA,0xB9,0x80,0x08,0x32,0x43,0x16,0x12,0x24,0x33,0x22,0x16,0x82,0xA2,0xEB,0xB9,0xCA,0x9C,0xA9,0xA9,0xBA,0x80,0x30,0x74,0x12,0x80,0x80,
+0x38,0x27,0x01,0x08,0x08,0x08,0xFC,0xAE,0xBA,0xAB,0xB9,0x0A,0x0A,0x8A,0x0B,0x48,0x33,0x67,0x41,0x32,0x22,0x81,0xA0,0xA9,0xA8,0xB8,0x08,0xD8,0xBB,0xAF,0x9C,0xA0,
+0x42,0x34,0x43,0x41,0x13,0x03,0x84,0xA0,0xBA,0xFA,0xA0,0xC9,0xC9,0xBB,0xAB,0x89,0x80,0x03,0x53,0x33,0x57,0x18,0x99,0xC9,0x99,0x89,0x0A,0xB8,0xCB,0x8A,0x80,0xD0,
+0x80,0xBC,0x8B,0x50,0x08,0x08,0xBD,0x80,0x80,0x05,0x37,0x42,0x24,0x25,0x32,0x18,0x82,0x80,0x80,0xBB,0xBC,0xAF,0x09,0x08,0x88,0x80,0xD0,0x80,0x80,0x35,0x36,0x14,
+0x14,0x33,0x22,0x20,0x80,0x80,0x80,0xBD,0xAF,0xCC,0xBB,0x0B,0x80,0x35,0x41,0x41,0x31,0x43,0x21,0x12,0xB0,0x00,0x0C,0x8B,0xAF,0xFB,0x99,0x99,0x98,0x9A,0x8A,0x8D,
+0xBB,0xAC,0xAA,0x8A,0x30,0x70,0x20,0x80,0xBB,0x8B,0x8C,0x40,0x43,0x43,0x02,0x80,0xD0,0x80,0x80,0x58,0x43,0x43,0x08,0xC8,0xB0,0x0C,0x03,0x34,0x34,0x03,0x04,0x08,
+0x85,0x30,0x35,0x83,0x27,0x21,0x30,0xB8,0x08,0xBD,0xB0,0xBC,0xB8,0x0D,0x8B,0xBC,0x80,0x0C,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x70,0x55,0x30,0x00,0xB2,0xB0,
+0xC8,0xAC,0x08,0x0C,0x0C,0x8B,0x0C,0xCB,0xC0,0x30,0x80,0x80,0xE0,0x80,0x84,0x30,0x17,0x31,0xB8,0xBB,0xBC,0xDC,0xAA,0xBA,0x00,0x0C,0x8B,0x0C,0x03,0x37,0x34,0x42,
+0x12,0x02,0x02,0x8B,0x40,0x43,0x26,0x21,0x32,0x80,0xCB,0xC0,0x0B,0xCB,0xC0,0xEB,0xC0,0x9D,0xAA,0x0B,0x21,0x22,0x62,0x10,0x22,0x08,0x02,0x80,0x8C,0xAF,0xA9,0x9D,
+0x9C,0xBC,0xB9,0xA9,0xD8,0x80,0x19,0x15,0x44,0x33,0x14,0x81,0x00,0x88,0xB0,0xB0,0xC8,0x00,0xC8,0xB8,0xD8,0x80,0x80,0x57,0x31,0x42,0x21,0x21,0x80,0x0B,0xB8,0x08,
+0x08,0x08,0x08,0x00,0x9F,0xD0,0x30,0x70,0x13,0x15,0x82,0x02,0xBB,0xFB,0xB8,0xAA,0xB0,0x00,0x48,0x83,0x84,0x80,0x35,0x33,0x27,0x21,0x00,0xF8,0xB0,0x9E,0xA9,0x89,
+0x80,0x14,0x12,0x04,0x82,0x8A,0x80,0xC0,0xC0,0xBA,0xEC,0x9B,0xAC,0xA9,0x0A,0x0B,0x30,0x40,0x03,0x08,0x08,0x08,0x08,0x57,0x32,0x17,0x21,0x33,0x22,0xB0,0xC8,0xB0,
+0xBC,0x08,0x08,0x8D,0x8B,0x0D,0x08,0x58,0x08,0x08,0x0D,0x48,0x08,0x08,0x80,0x60,0x43,0x26,0x41,0x20,0x08,0xBB,0xFB,0xAD,0xAA,0x8B,0x89,0x20,0x32,0x30,0x80,0x35,
+0x43,0x73,0x32,0x14,0x01,0x80,0xB0,0xCB,0xFA,0x80,0x0A,0x80,0xEA,0xA9,0x9C,0x89,0x08,0x32,0x17,0x33,0x22,0x15,0x10,0x32,0x38,0x33,0xC0,0xAC,0xCB,0xBB,0x8F,0xAB,
+0xBC,0xA8,0x80,0x80,0x84,0x73,0x03,0x84,0x82,0x08,0x08,0x48,0x08,0x08,0xBD,0xF0,0x9A,0x0A,0x02,0x08,0x48,0x8B,0xC8,0x80,0x04,0x58,0x38,0x34,0x83,0x80,0xBD,0xCB,
+0x0F,0x9A,0xA8,0xAA,0xBB,0xAC,0x8B,0x58,0x83,0x17,0x84,0x82,0xA2,0x80,0x0B,0x08,0x88,0x05,0x48,0x8B,0x0C,0x0C,0x08,0x88,0x05,0x08,0x08,0x68,0x30,0x44,0x38,0x24,
+0x30,0x40,0x80,0x85,0xC0,0x00,0x08,0x0D,0xB8,0xC8,0x08,0x08,0x08,0xF8,0x80,0x0C,0x03,0x04,0x58,0x38,0x84,0x43,0x83,0x80,0x80,0x80,0x0E,0xAF,0xCA,0xA9,0xAA,0x0B,
+0xC0,0x80,0x80,0x35,0x83,0x84,0x80,0x50,0x08,0x08,0x80,0x80,0x70,0x30,0x04,0x08,0xD0,0x08,0x0D,0x08,0x58,0x08,0x0C,0xC0,0xB0,0xBC,0xB0,0x48,0x24,0x43,0x30,0x08,
+0x08,0x68,0x78,0x30,0x22,0x82,0x0B,0xCB,0x9F,0xC9,0xB9,0xA9,0x80,0x80,0x30,0x80,0x04,0x34,0x27,0x12,0x83,0x0B,0xAC,0xCB,0xB0,0xBC,0x0B,0x0C,0x08,0xD8,0x80,0x0C,
+0x8B,0x80,0x0D,0xBC,0x0C,0x80,0x40,0x48,0x08,0x03,0x35,0x70,0x10,0x22,0x30,0x48,0x08,0x08,0x0D,0x8B,0x08,0x80,0x80,0x80,0x00,0x17,0x04,0x03,0x04,0x08,0x85,0x34,
+0x03,0x44,0x08,0x08,0x88,0x50,0x40,0x80,0x80,0x80,0xBE,0xBC,0xBF,0xBA,0xD8,0xA0,0x0A,0x80,0x0B,0x08,0x88,0x35,0x04,0x03,0x34,0x80,0xB5,0xC8,0xBB,0xBC,0x8B,0x80,
+0x80,0x80,0x90,0x00,0x70,0x81,0x50,0x48,0x48,0x02,0x80,0x80,0x80,0x80,0x90,0x70,0x81,0x80,0x80,0x0F,0x0C,0x8B,0xD0,0x30,0x08,0x08,0x08,0x08,0x07,0x43,0x30,0x35,
+0x83,0x84,0x24,0x00,0x03,0x58,0x80,0x80,0xE0,0xC0,0x80,0xC0,0xC0,0xBA,0xBC,0xAE,0xAB,0x08,0xB8,0x80,0x80,0x80,0x06,0x43,0x24,0x43,0x83,0x80,0x00,0xCD,0xBA,0xC8,
+0x80,0xD0,0x80,0x8B,0x00,0x8D,0xD0,0x03,0x43,0x33,0x34,0x43,0x30,0x84,0x43,0x30,0x0C,0xC0,0xCB,0xF0,0x99,0xBA,0xA8,0x38,0x48,0x32,0x34,0x06,0x03,0x15,0x80,0x02,
+0x8B,0x0B,0xBC,0xAC,0xCB,0x0B,0xAC,0x08,0x08,0x44,0x33,0x40,0x80,0x85,0x30,0x80,0x80,0x0E,0xB8,0xD8,0xC0,0xB0,0xB8,0x08,0x68,0x03,0x08,0x08,0x0E,0x08,0x0D,0xCB,
+0xB0,0x0C,0xB8,0xC8,0x08,0x08,0x68,0x08,0x08,0xD0,0xB8,0xD8,0x80,0xD0,0xBB,0xC0,0x0B,0x08,0x08,0x68,0x17,0x14,0x21,0x01,0x02,0x78,0x38,0x42,0x21,0x21,0x80,0x80,
+0x8B,0x80,0x50,0x80,0xD0,0xB8,0xBD,0xBB,0x0C,0x08,0x04,0x07,0x21,0x02,0x30,0x08,0xD8,0x80,0x80,0x0D,0xAC,0x9F,0xAB,0xAB,0x9D,0x0A,0x28,0x00,0x33,0x80,0x85,0xC0,
+0x80,0x40,0x80,0x80,0x0D,0xC8,0xB8,0xBD,0xB0,0x48,0x30,0x50,0x08,0x08,0x80,0x60,0x08,0x08,0x68,0x33,0x04,0x48,0x08,0x48,0x30,0x35,0x08,0x03,0x08,0x0E,0xC8,0x0B,
+0xC8,0x30,0x40,0x40,0x30,0x40,0x84,0x84,0x03,0x58,0x38,0x00,0x48,0x8B,0x80,0x0E,0x0C,0x8B,0x8B,0x80,0x86,0x80,0x00,0xE8,0xBB,0xBC,0x0C,0xCB,0x8A,0xCB,0x8B,0x8B,
+0x0D,0x0C,0x80,0x40,0x48,0x03,0x03,0x04,0x58,0x08,0x08,0x80,0x80,0x70,0x80,0x80,0x80,0x0E,0x0C,0x08,0x34,0x70,0x20,0x83,0x83,0x80,0x80,0x80,0x80,0x90,0x9F,0x00,
+0x8D,0x8B,0x0D,0x48,0x08,0x03,0x85,0x70,0x80,0x82,0x00,0x08,0x0C,0x08,0x88,0x80,0x80,0x90,0x9F,0xD0,0x80,0x8B,0x80,0x60,0x08,0x08,0x08,0xF8,0x80,0x80,0x08,0x0E,
+0xBC,0xB0,0xBC,0xB8,0x08,0x08,0x86,0x84,0x84,0x30,0x80,0x04,0x34,0x40,0x80,0xD0,0xC0,0xB0,0x0C,0xCB,0x8A,0xCB,0xC0,0x80,0x8B,0x00,0x08,0x36,0x70,0x13,0x83,0x83,
+0x84,0x80,0x0C,0x8B,0x80,0x50,0x40,0x80,0x80,0x05,0x08,0x08,0x08,0x08,0x09,0x17,0x08,0x08,0x0F,0x48,0x08,0x48,0x08,0x08,0x08,0x0E,0xBC,0xBB,0xBC,0xC0,0x80,0x80,
+0x08,0x68,0x80,0x80,0x80,0x06,0x08,0x08,0x08,0xF8,0x08,0x0D,0xCB,0xB0,0x08,0x88,0x50,0x80,0x85,0x84,0x43,0x32,0x40,0x08,0x03,0xD0,0x08,0xBD,0xBB,0x08,0x80,0x80,
+0x80,0x17,0x04,0x03,0x58,0x03,0x44,0x38,0x30,0xD0,0x80,0x8B,0x0D,0xB8,0x0D,0x8B,0x0C,0xCB,0xCB,0xB0,0x08,0x58,0x48,0x32,0x04,0x38,0x34,0x84,0x30,0x80,0x08,0x0E,
+0x0C,0xCB,0xB0,0x0C,0xCB,0xB0,0x0C,0xB8,0x08,0x85,0x30,0x00,0x08,0x08,0x78,0x81,0x85,0x84,0x03,0x08,0x80,0xF0,0x0B,0xC0,0x80,0x80,0x58,0x80,0x80,0x50,0x80,0x85,
+0x24,0x17,0x21,0x82,0x02,0x0B,0xC8,0xB0,0xC8,0x08,0x0D,0xB8,0x0C,0x0C,0x8B,0x8B,0x80,0x86,0x30,0x00,0x08,0x08,0x08,0x9F,0x00,0x85,0x80,0x80,0x0E,0xB8,0xD8,0x80,
+0x80,0x80,0x80,0x80,0x00,0x9F,0x00,0x08,0x86,0x80,0x80,0x80,0x80,0x17,0x04,0x03,0x58,0x30,0x80,0x80,0x80,0x90,0x00,0xF0,0x09,0x80,0x80,0x80,0x17,0x04,0x08,0x08,
+0x08,0xF8,0x08,0x0D,0x8B,0x0C,0x8B,0xD0,0xC0,0x80,0x80,0x00,0x85,0x84,0x84,0x43,0x38,0x30,0xD0,0x80,0x80,0x0D,0x0C,0x8B,0x8B,0x80,0x0E,0x43,0x48,0x02,0x30,0xD0,
+0x80,0xBC,0xC0,0xC0,0x00,0x48,0xB8,0x08,0x08,0x0E,0x48,0x38,0x00,0x08,0x08,0x08,0xF9,0x09,0x3D,0x00,0x34,0x40,0x30,0x40,0x80,0x80,0x86,0x80,0x85,0x30,0x80,0x85,
+0xC0,0xC0,0x8A,0xC0,0x80,0x80,0x08,0x08,0x08,0x79,0x81,0x85,0x80,0x50,0x08,0x08,0x0D,0xB8,0xD8,0x80,0x8B,0xD0,0x08,0x0D,0x08,0x0C,0x08,0x0D,0x08,0x08,0x80,0x80,
+0x80,0x00,0x70,0x81,0x85,0x30,0xD0,0x80,0x8B,0xBD,0x8B,0x8C,0x80,0x80,0x80,0x80,0x17,0x08,0x85,0x84,0x84,0x03,0x08,0x80,0x80,0x80,0x9F,0x85,0x80,0x84,0x80,0x00,
+0x08,0x08,0x08,0x00,0xF0,0x59,0x08,0x08,0x08,0x85,0x80,0x85,0x30,0x00,0x85,0x80,0x0D,0x08,0x08,0x8D,0xD0,0x0B,0x8B,0xCC,0xBA,0xC8,0x80,0x84,0x30,0x00,0x85,0x80,
+0x80,0x80,0x80,0xF0,0x09,0x80,0x0E,0x08,0x08,0x85,0x40,0x03,0x44,0x08,0x03,0x88,0x80,0x80,0xF0,0x09,0xD8,0x80,0x80,0x80,0x80,0x90,0x17,0x04,0x03,0x04,0x04,0x08,
+0x04,0x08,0x8D,0xD0,0xB0,0x08,0x88,0x80,0x0E,0x08,0x08,0xE8,0x80,0x80,0x0D,0x08,0x08,0x08,0x8F,0x8B,0xD0,0x80,0x40,0x80,0x04,0x08,0x0D,0x0C,0x8B,0xD0,0x80,0x30,
+0x00,0x68,0x08,0x08,0x80,0x86,0x24,0x43,0x30,0x08,0x08,0xE8,0xC0,0x8A,0x8B,0x80,0x3D,0x00,0x08,0x08,0x08,0x17,0x34,0x70,0x20,0x83,0x08,0x08,0x0D,0x8B,0x80,0x08,
+0x08,0x08,0xF9,0x09,0x0D,0x08,0x04,0x43,0x84,0x43,0x08,0x08,0x0D,0x08,0x0C,0x08,0x0D,0xB8,0xBC,0x0C,0x8B,0x8B,0x80,0x60,0x08,0x08,0x85,0x80,0x85,0x80,0x00,0x85,
+0x80,0x80,0xF0,0xB0,0xC8,0xBB,0xC8,0x80,0x80,0x80,0x80,0x90,0x00,0x17,0x58,0x48,0x08,0x03,0x88,0x80,0xF0,0xB8,0x08,0x80,0x80,0x80,0x00,0xF0,0x09,0xD0,0x48,0x08,
+0x03,0x85,0x24,0x30,0x00,0x58,0x80,0x80,0x50,0x80,0x50,0x08,0x0D,0xB8,0xC8,0x8B,0x8C,0x80,0x80,0x80,0xF0,0x08,0x88,0x80,0x36,0x00,0x44,0x08,0xC3,0x80,0xCC,0xB0,
+0x0C,0xC0,0x80,0x8B,0x0C,0x0C,0xC8,0x00,0x48,0x80,0x50,0x08,0x03,0x80,0x80,0x80,0x70,0x41,0x30,0x80,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,
+0x41,0x80,0x04,0x03,0x80,0x80,0x80,0x00,0x00,0x00,0x17,0xD8,0x80,0xDB,0x0B,0xC0,0x80,0x80,0xD8,0x80,0x80,0x0D,0x08,0x08,0x08,0x87,0x84,0x80,0x80,0x08,0x0E,0x08,
+0x88,0x80,0xF0,0x08,0x0C,0x0C,0x8B,0x80,0x3D,0x00,0x84,0x84,0x30,0x50,0x08,0x03,0x80,0x86,0x30,0x00,0x08,0xF8,0x80,0xD0,0x80,0x80,0x80,0x80,0x70,0x08,0x08,0x80,
+0x86,0x30,0x50,0x08,0x58,0x08,0x0C,0x80,0x0C,0x8B,0xD0,0x80,0x80,0x08,0x05,0x08,0x68,0x08,0x03,0x80,0x80,0x80,0x9F,0xD0,0xC0,0xB0,0xB8,0x08,0x08,0xF8,0x80,0x80,
+0x04,0x04,0x48,0x80,0x00,0x08,0x08,0xF8,0x09,0xD0,0x08,0x58,0x08,0xC8,0x80,0x04,0x08,0x50,0x08,0x08,0x08,0x08,0x07,0x08,0x08,0x08,0x08,0xF9,0x09,0x80,0x0E,0x08,
+0x08,0x8D,0x80,0x80,0x80,0x80,0x00,0x70,0x81,0x80,0x80,0x80,0x17,0x08,0x85,0x80,0x80,0xF0,0x80,0x80,0x00,0x08,0x08,0x08,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0xF0,0x80,0x80,0x00,0x08,0x08,0x07,0x08,0x08,0x08,0x08,0xF9,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x17,0x58,0x08,
+0x08,0x80,0xF0,0x80,0x80,0x00,0xE8,0x80,0x80,0x80,0x80,0x70,0x80,0x40,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x0F,0x08,0xC8,0x80,0x8C,0x80,0x0D,
+0x08,0x04,0x08,0x0D,0x08,0x88,0x05,0x08,0x08,0x05,0x08,0x08,0x08,0x08,0x00,0x70,0x81,0x80,0x0E,0x08,0x0D,0x08,0x08,0x50,0x08,0x58,0x08,0x03,0x80,0x86,0x84,0x30,
+0x80,0xD8,0xC0,0x80,0x0C,0xC0,0x80,0x80,0x08,0x08,0x87,0x80,0x00,0x85,0x80,0x50,0x08,0xD8,0x80,0x8B,0xD0,0x08,0x08,0x08,0xF8,0x80,0x80,0x08,0xE8,0x03,0x80,0x80,
+0x80,0x07,0x08,0x0D,0x08,0x08,0x08,0x08,0x08,0x00,0x9F,0x00,0x8D,0x80,0x80,0x80,0x07,0x08,0x84,0x80,0x50,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x17,0x08,0x68,
+0x08,0x03,0x80,0x80,0x80,0x00,0xF0,0x09,0xD0,0x08,0x08,0xE8,0x80,0xD0,0x80,0x30,0x00,0x08,0x08,0x08,0x00,0xF0,0x09,0x80,0x0E,0x08,0x08,0x68,0x8B,0x80,0x08,0x08,
+0x87,0x80,0x50,0x08,0x08,0x0D,0x08,0xD8,0x30,0x80,0x80,0x60,0x08,0x08,0x08,0x86,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0xF0,0x09,
+0xD0,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x17,0x58,0x08,0x08,0x80,0x80,0xF0,0xC8,0x00,0x08,0x08,0x08,0x8F,0xC0,0x80,0x80,0x50,0x48,0x48,0x02,0x03,0x80,0x80,0x80,
+0xF0,0x09,0xD8,0xC0,0x8B,0xDB,0x80,0x8B,0x00,0x08,0x78,0x30,0x40,0x48,0x08,0x03,0x80,0x80,0x07,0x08,0x88,0xE0,0x80,0x80,0x0D,0x08,0x88,0x80,0x80,0x90,0x00,0x17,
+0x08,0x85,0x84,0x80,0x00,0x08,0x08,0xF8,0xC9,0x80,0x8C,0x80,0x0D,0x08,0x08,0x08,0x08,0x08,0x70,0x81,0x80,0x86,0x80,0x00,0x08,0x0F,0x08,0xC8,0x80,0x80,0x0D,0x08,
+0x08,0x08,0x08,0x09,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0x00,0x08,0x08,0x78,0x81,0x80,0x80,0x80,0x00,0x17,0x08,0x08,0x86,0x80,
+0xD0,0x08,0x08,0x08,0x0F,0x08,0x08,0x80,0x60,0x08,0x08,0x68,0x08,0x08,0x80,0x80,0xF0,0x08,0xD8,0x80,0x80,0x0D,0x08,0x88,0x80,0x0E,0x08,0x08,0x08,0x08,0x09,0x00,
+0x00,0xF0,0x02,0x80,0x80,0x07,0x08,0x88,0x80,0x80,0xF0,0x09,0x08,0x08,0x87,0x80,0x00,0x08,0x08,0x07,0x08,0x04,0x08,0x08,0xF8,0x80,0xD0,0x80,0x80,0x80,0x80,0x80,
+0x70,0x81,0x08,0x05,0x08,0x85,0x80,0x80,0x80,0xF0,0x08,0x0D,0x08,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x9F,0xD0,0x80,0x80,0x80,0x80,0x0F,
+0x08,0x88,0x80,0x70,0x48,0x08,0x48,0x08,0x08,0x08,0x0E,0x08,0x88,0x0D,0x08,0x08,0xE8,0x80,0x80,0x50,0x80,0x50,0x08,0x08,0x85,0x8B,0x80,0x80,0x80,0x00,0x00,0x00,
+0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x78,0x8B,0x80,0x80,0x86,0x80,0x00,0x85,0x8B,0x80,0x0E,0x08,0x0D,0x08,0x08,
+0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0xF8,0x80,0x80,0x08,0x08,0x08,0x09,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x70,0x81,0x80,0x80,0x70,0x80,0x04,
+0x58,0x08,0x08,0x08,0x8D,0x80,0xD0,0x08,0x08,0x08,0x0F,0x08,0x08,0x80,0x86,0x30,0x00,0x85,0x80,0x80,0x80,0x80,0x00,0x9F,0x00,0x8D,0xD0,0x80,0x80,0x00,0x08,0x08,
+0x08,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0xF0,0x09,0x80,0x60,0x08,0x08,0x08,0x08,0x78,0x81,0x80,0x80,0x07,0x08,0x88,0x80,0x0E,
+0x08,0x08,0xE8,0x80,0x80,0x80,0x80,0x90,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x17,0x08,0x08,0x86,0x80,0x80,0x80,0x70,0x80,0x80,0x80,0xF0,0x08,0xC8,0x80,0xD0,0x80,0x80,0x08,0x08,
+0x08,0x79,0x81,0x80,0x60,0x08,0x08,0x08,0x08,0xF8,0x09,0x80,0xF0,0x80,0x80,0x00,0x08,0x08,0x08,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,
+0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,
+0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x70,0x81,0x80,0x80,0x70,0x80,0x80,0x80,0x80,0x90,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,
+0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x9F,0x00,0x08,0x08,0x08,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x70,0x80,0x80,0x05,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0xF0,0x09,
+0x80,0x80,0x80,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x9F,0x00,0x08,0x0F,0x08,0x08,0x80,0x80,0x80,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x9F,0x00,
+0x08,0x08,0x8F,0x80,0x08,0x08,0x08,0x17,0x88,0x80,0x80,0x90,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0xF0,0x09,0x50,0x08,0x08,0x08,0x08,0x08,0x00,0x17,0x08,
+0x08,0x78,0x80,0x80,0x0D,0x08,0x88,0x0D,0x08,0x08,0xE8,0x80,0x80,0x80,0x80,0x90,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,
+0x08,0x00,0x00,0x70,0x81,0x80,0x80,0x07,0x08,0x88,0x80,0x80,0x90,0x00,0x00,0x2F,0xD0,0x80,0x80,0x80,0x80,0x80,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,
+0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x70,0xD1,0x80,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x70,0x8A,0x80,0x80,0x80,0x17,0xD8,0x80,0x80,0x80,0xF0,0x80,
+0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x17,0x08,0x8D,0x80,0x80,0x60,0x08,0x08,0xE8,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,
+0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x02,0x80,0x80,0x80,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x0F,0x08,0x88,0x80,0x80,0x90,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0xF8,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0xF0,0x59,0x08,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x70,0x81,
+0x80,0x80,0x80,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x85,
+0x80,0x00,0x08,0xF8,0x80,0x80,0x58,0x80,0x80,0x80,0x80,0x90,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x60,0x08,0x08,0x8D,0x80,0x80,
+0x80,0x80,0x00,0x00,0xF0,0x09,0x80,0x60,0x08,0x08,0x68,0x08,0x08,0x80,0x80,0x80,0x00,0xF0,0x09,0x80,0x80,0x80,0x9F,0x00,0x85,0x80,0x80,0x60,0x08,0x08,0x08,0x08,
+0x08,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x2F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0xF0,0x09,0x80,0x86,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x17,0x08,
+0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x17,0x08,0xE8,0x80,0x80,0x80,0x80,0x80,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x70,0x81,0x80,
+0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x02,0x80,0x0E,0x08,0x08,0x08,0x08,0x08,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x17,0x08,0x08,0x08,0x8F,0x80,0xD8,0x80,0x80,0x05,0x48,0x80,0x00,0x08,0x08,0x08,0x9F,0x00,0x08,
+0x08,0x08,0x17,0x08,0x68,0x08,0xC8,0x30,0x80,0x80,0x80,0x90,0x00,0x00,0x9F,0x00,0x08,0x78,0x30,0x80,0x08,0x08,0xF8,0x08,0x0D,0x8B,0x0C,0x80,0x04,0x08,0x80,0x80,
+0x80,0x9F,0xD0,0x30,0x80,0x0D,0x08,0x08,0xE8,0xC0,0x00,0x08,0x88,0x80,0x80,0x8F,0xD0,0x80,0x8B,0x0C,0x48,0x80,0x50,0x48,0x08,0x03,0x84,0x84,0x30,0x50,0x33,0x40,
+0x84,0x03,0x53,0x08,0x03,0x08,0x35,0x34,0x43,0x03,0x53,0x33,0x48,0x03,0x48,0x24,0x03,0x84,0x84,0x80,0x80,0x0D,0x08,0x88,0x80,0x06,0xC8,0x08,0xBF,0x9C,0xAA,0x9D,
+0xAC,0xBA,0xD0,0xB9,0x89,0xD0,0xB8,0xAE,0xDA,0xAA,0x9A,0x9B,0xBC,0xB9,0xA9,0xDA,0xBB,0xAA,0x0A,0x9E,0xCA,0xBB,0x0C,0x0C,0x01,0x01,0x32,0x63,0x63,0x24,0x42,0x21,
+0x23,0x24,0x33,0x31,0x35,0x44,0x14,0x31,0x22,0x35,0x33,0x15,0x11,0x22,0x11,0x31,0x82,0x20,0x38,0x43,0x25,0x22,0x25,0x03,0xA2,0xE8,0xAB,0xDA,0xAD,0xB9,0xDB,0xBB,
+0xAC,0xAC,0xCA,0x9C,0xA9,0xCB,0xEA,0xAA,0xBB,0xB9,0xAB,0xAC,0xCB,0xAA,0x9A,0xAB,0x9C,0x9A,0x08,0xB8,0xF0,0xCB,0x09,0x9A,0x8A,0x80,0x03,0x34,0x78,0x32,0x45,0x43,
+0x26,0x21,0x32,0x33,0x03,0x35,0x33,0x34,0x25,0x53,0x13,0x24,0x23,0x22,0x81,0x11,0x23,0x12,0x53,0x10,0x80,0x30,0x73,0x15,0x42,0x82,0x80,0xA0,0x9A,0xDD,0xBA,0xAE,
+0xBC,0xBB,0x89,0xBA,0xCA,0xBB,0xCC,0xA9,0x9C,0xAD,0xBC,0xBB,0x9A,0xCB,0x9E,0x89,0x21,0x00,0x81,0xDA,0xAD,0xAA,0xCB,0xBC,0x9A,0x00,0x11,0x22,0x33,0x12,0x37,0x83,
+0xBB,0x20,0x34,0x46,0x24,0x22,0x02,0x53,0x13,0x81,0x20,0x47,0x42,0x53,0x21,0x23,0x11,0x03,0x80,0x10,0x42,0x45,0x34,0x12,0x21,0x24,0x81,0x00,0x40,0x11,0x62,0x24,
+0x98,0xAB,0xDB,0xDF,0xBA,0xAB,0xA8,0x89,0x00,0xB8,0xAE,0xBA,0xCE,0xBB,0xAA,0xCB,0x9A,0x00,0x21,0x32,0x82,0xEB,0xAC,0xBC,0xCB,0xBC,0x99,0x88,0x80,0x80,0xC8,0x9A,
+0x42,0x45,0x43,0x43,0x53,0x33,0x23,0x22,0x12,0x41,0x54,0x43,0x33,0x35,0x32,0x12,0x08,0xA0,0x99,0x10,0x08,0x32,0x67,0x12,0x01,0x21,0x02,0x80,0x00,0x90,0x19,0x80,
+0xD9,0xFF,0xCB,0xAC,0xA9,0x9C,0x9A,0x9A,0xA9,0xB9,0xCA,0xBB,0xCB,0xBA,0xBF,0xAA,0xAA,0x08,0xA9,0xA8,0xA0,0x98,0xCB,0xFF,0x99,0x88,0x80,0x90,0x11,0x25,0x65,0x23,
+0x13,0x00,0x32,0x24,0x43,0x23,0x43,0x34,0x43,0x14,0x08,0x08,0x01,0x00,0x08,0x38,0x45,0x82,0x22,0x08,0x01,0xB9,0xFA,0xBA,0xAA,0x81,0xDD,0xAC,0xA9,0x9A,0xC9,0xEC,
+0xBB,0xCB,0xAB,0xBC,0xBB,0x0A,0x08,0x02,0xDB,0xAA,0xBC,0xBD,0xBD,0xCB,0x9B,0xA8,0xAA,0xCA,0xAA,0x99,0x01,0x11,0x31,0x67,0x42,0x13,0x42,0x24,0x22,0x02,0x41,0x24,
+0x44,0x43,0x14,0x00,0x31,0x23,0x12,0xB8,0x99,0x19,0x50,0x26,0x80,0x62,0x34,0x24,0x12,0x80,0x98,0x99,0xA9,0xEB,0xCB,0x08,0x88,0xCC,0xBE,0xBA,0xAC,0xAA,0x99,0xAA,
+0xAA,0x20,0x04,0x90,0x98,0xCD,0xDD,0xBC,0xCA,0xAA,0xBB,0x99,0xA9,0x08,0x00,0xDB,0xAF,0x99,0x99,0xA9,0x28,0x34,0x34,0x45,0x33,0x13,0x12,0x88,0x28,0x12,0x11,0x08,
+0x76,0x33,0x35,0x33,0x15,0x22,0x53,0x43,0x13,0x33,0x23,0x12,0x01,0x32,0x13,0x51,0x56,0x24,0x22,0x81,0xAA,0xBA,0xBC,0x99,0xBB,0x19,0x37,0x32,0xA1,0xFC,0xAB,0x9A,
+0x8A,0xBA,0xBB,0xAC,0xEA,0xBD,0xCD,0xAC,0xBB,0x99,0x89,0x08,0x10,0x11,0x01,0xB9,0xAD,0xCB,0xAC,0xB9,0xA9,0xBA,0x99,0x73,0x91,0x99,0xA9,0x09,0x21,0x33,0x67,0x22,
+0x54,0x43,0x33,0x34,0x25,0x23,0x23,0x52,0x33,0x13,0x01,0x88,0x10,0x45,0x44,0x24,0x33,0x24,0x12,0x08,0xBA,0x9B,0x88,0x21,0x34,0x13,0x88,0xBA,0xAF,0xED,0xCB,0xCB,
+0xAA,0x99,0x98,0xCB,0xBB,0xBC,0xBB,0xBD,0xDC,0xAA,0x9A,0xA9,0xA9,0xAB,0xAC,0xA9,0x88,0xA8,0xAC,0x09,0x34,0x34,0x81,0x08,0x09,0xEA,0x9B,0x18,0x01,0x51,0x66,0x34,
+0x33,0x24,0x12,0x10,0x55,0x34,0x33,0x43,0x23,0x43,0x21,0x21,0x98,0x0A,0x20,0x12,0x28,0x03,0x99,0x11,0x30,0xF9,0xDF,0x89,0xA9,0x89,0x10,0xB8,0xEF,0xCA,0xAA,0xBB,
+0xBB,0xAC,0xAA,0xA9,0xC9,0xAD,0xCB,0x9B,0x99,0xCB,0xCC,0x89,0x89,0x11,0xA0,0xFC,0xAC,0x89,0x98,0x88,0x89,0x32,0x36,0x63,0x12,0x10,0x31,0x36,0x32,0x13,0x01,0x12,
+0x12,0x21,0x13,0xA8,0x28,0x64,0x47,0x43,0x23,0x23,0x02,0x32,0x32,0x82,0x9A,0x89,0x10,0xB8,0xFB,0xBD,0xAA,0x0A,0x02,0x90,0x28,0x13,0x8D,0x30,0x11,0x62,0x37,0x42,
+0x34,0x23,0xA0,0xEF,0xBB,0xBC,0xBB,0xBC,0xAA,0x9B,0x9A,0xCB,0xEC,0xBA,0x9A,0x18,0x21,0x11,0x11,0x53,0x14,0x01,0xBA,0xBE,0x8A,0x8A,0x00,0x18,0x52,0x35,0x42,0x23,
+0x01,0x00,0x80,0x31,0x57,0x42,0x25,0x33,0x32,0x42,0x22,0x63,0x32,0x33,0x22,0x12,0x11,0x01,0x09,0x33,0x22,0x73,0x54,0x23,0x91,0xAA,0xBC,0xEB,0xCB,0x9A,0x10,0x53,
+0x22,0x80,0x99,0xBE,0xAC,0xDB,0xCB,0xAC,0xCA,0xAC,0xAB,0x9A,0x08,0xA8,0x89,0x18,0x32,0x81,0xCA,0x8A,0x8B,0x66,0x24,0x22,0x81,0x20,0x34,0x23,0x01,0x81,0x40,0x24,
+0x65,0x43,0x32,0x52,0x24,0x22,0x32,0x52,0x43,0x42,0x13,0x12,0x80,0x9B,0x80,0xAA,0xBA,0x18,0x01,0x00,0xD8,0xAC,0xBF,0xCB,0xBD,0xBC,0xAE,0xBA,0xAB,0xBA,0xBC,0xCA,
+0x9B,0xC9,0xBB,0xDD,0xBA,0xCC,0xAA,0x9B,0xAA,0x89,0x00,0x89,0x90,0xA9,0xC9,0xDB,0xAA,0x18,0x64,0x23,0x82,0xA9,0x99,0x30,0x46,0x25,0x32,0x34,0x44,0x22,0x00,0x99,
+0x08,0x22,0x37,0x23,0x21,0x31,0x34,0x43,0x22,0x54,0x25,0x45,0x22,0x11,0x80,0x00,0x88,0xA9,0xBA,0xAE,0xBA,0x99,0xA8,0xBB,0xBE,0xAA,0xBD,0xBC,0xAE,0xBB,0x9B,0xAA,
+0x9A,0x8A,0x21,0x23,0x13,0x91,0xCB,0xEC,0xDD,0xAD,0xAC,0xAA,0x98,0x10,0x42,0x43,0x24,0x12,0x90,0xB9,0xCB,0xBA,0x08,0x30,0x55,0x36,0x33,0x13,0x00,0x01,0x88,0x80,
+0x00,0x63,0x45,0x24,0x11,0x88,0x80,0x00,0x32,0x34,0x24,0x32,0x55,0x63,0x12,0x01,0x80,0x89,0x10,0x90,0xEA,0xAA,0x89,0x88,0xB8,0xBE,0xCE,0x9A,0x99,0xC9,0xBC,0xBC,
+0x9A,0x9A,0x99,0xA9,0x9A,0x42,0x12,0x00,0xC9,0xAD,0xCB,0xAC,0xCB,0xCB,0xBC,0x98,0x9A,0x18,0x22,0x54,0x33,0x32,0x21,0x82,0x09,0x74,0x53,0x44,0x42,0x24,0x31,0x33,
+0x45,0x22,0x01,0x11,0x21,0x22,0x43,0x11,0x00,0x18,0x45,0x43,0x01,0x90,0x8A,0x28,0x43,0x12,0xB9,0xBE,0xCA,0x9A,0xA9,0xB9,0xAC,0x88,0xB9,0xCF,0xCE,0xBC,0xBD,0xCB,
+0xAC,0xAA,0x9A,0x99,0x98,0xCA,0xCA,0xAB,0xCC,0xAB,0xAA,0x9A,0xAA,0x89,0xB8,0xBC,0xBB,0x30,0x34,0x53,0x23,0x44,0x33,0x46,0x23,0x23,0x32,0x64,0x33,0x24,0x22,0x03,
+0x01,0x22,0x55,0x23,0x12,0x22,0x24,0x53,0x43,0x81,0xB9,0xBC,0x09,0x32,0x23,0x01,0x21,0x35,0x25,0xA0,0xEC,0xAC,0x9A,0x88,0x08,0x00,0x22,0x10,0xC1,0xFD,0xBC,0xDB,
+0xBB,0xBB,0xAB,0x8A,0x20,0x32,0x03,0x90,0xA9,0x8A,0xFC,0xAC,0xBA,0xBB,0xBB,0x99,0x28,0x54,0x44,0x33,0x12,0x23,0x98,0xFB,0x9B,0x08,0x51,0x46,0x33,0x36,0x32,0x33,
+0x22,0x81,0xBA,0xAB,0x28,0x45,0x35,0x32,0x12,0x00,0x22,0x12,0x99,0xEA,0xAC,0x9B,0x88,0x10,0x90,0x08,0x10,0x14,0x22,0x25,0xD1,0xEF,0xBC,0xBA,0xAC,0x8A,0x99,0x99,
+0x8A,0x88,0xEA,0xDD,0xBA,0xAD,0xA9,0xAA,0xA8,0x89,0x20,0x33,0x13,0x98,0xCD,0x9C,0x08,0x08,0x21,0x51,0x24,0x21,0x22,0x31,0x14,0x54,0x34,0x25,0x33,0x35,0x22,0x01,
+0x10,0x31,0x46,0x24,0x34,0x23,0x53,0x23,0x24,0x10,0x98,0x8A,0x11,0x44,0x22,0x01,0x80,0x99,0xCA,0xCF,0xBC,0xAC,0x9A,0x8A,0x99,0x99,0xBB,0x99,0x18,0x80,0xDD,0xDC,
+0xBC,0xBC,0x9C,0xAA,0xA9,0xDB,0x9A,0x9A,0x88,0xA9,0xEC,0xAB,0x8A,0x20,0x33,0x80,0x31,0x33,0x14,0x82,0xFA,0xBE,0x9B,0x18,0x43,0x33,0x33,0x45,0x42,0x34,0x43,0x22,
+0x33,0x24,0x32,0x22,0x33,0x44,0x43,0x34,0x35,0x12,0x13,0x02,0x80,0xEB,0xAC,0x9A,0x99,0x00,0x30,0x12,0x90,0xCB,0xBE,0xCB,0xBC,0xCC,0xCC,0x9A,0x9B,0xAA,0xAB,0xB9,
+0x0A,0x88,0xB9,0xCC,0xAC,0x41,0x54,0x34,0x23,0x11,0x01,0x00,0xC9,0xDB,0xBC,0x09,0x80,0x99,0x21,0x64,0x34,0x53,0x32,0x12,0x11,0x42,0x23,0x33,0x25,0x34,0x36,0x22,
+0x12,0x80,0x11,0x21,0x22,0x99,0xDC,0x0A,0x34,0x12,0x81,0x20,0x98,0x41,0x15,0xC9,0xAF,0xAD,0x8A,0x80,0x08,0x08,0xE8,0xBB,0xBC,0x9A,0xBD,0xCA,0xAC,0x8A,0xA9,0xBC,
+0xBE,0xCC,0x9A,0x89,0x88,0xBB,0xBB,0xAA,0x80,0xAB,0x09,0x20,0x57,0x23,0x01,0xDA,0xBB,0x09,0x32,0x73,0x35,0x42,0x23,0x23,0x22,0x22,0x23,0x35,0x34,0x44,0x42,0x34,
+0x43,0x24,0x31,0x33,0x35,0x22,0x81,0x98,0xBA,0xAA,0xBB,0xBB,0x0A,0x72,0x37,0x53,0x22,0x12,0xA8,0xBC,0xDD,0xBC,0xBC,0xAA,0x9A,0x99,0x9A,0x89,0xA8,0xEB,0xAD,0xBB,
+0xBD,0xBA,0xAB,0xAB,0x99,0x08,0x22,0x12,0x90,0xB9,0xFB,0xBD,0xBC,0xBB,0x89,0x31,0x47,0x33,0x45,0x43,0x23,0x11,0x08,0x88,0x89,0x98,0x10,0x52,0x33,0x47,0x33,0x23,
+0x22,0x53,0x44,0x23,0x21,0x00,0x10,0x11,0x13,0x90,0xBC,0x8B,0x99,0xEA,0xBC,0xCC,0xBC,0xCD,0x99,0x19,0x21,0x33,0x24,0x80,0x9A,0xBB,0xCD,0xCC,0xCC,0xBB,0x9C,0xA9,
+0x9A,0xBA,0xBA,0xBC,0xBB,0xBA,0x19,0x54,0x32,0x82,0x88,0x10,0x01,0x18,0xB8,0xCC,0xBB,0x19,0x56,0x43,0x34,0x36,0x25,0x21,0x22,0x45,0x43,0x32,0x22,0x23,0x43,0x24,
+0x12,0x81,0xAA,0x08,0x22,0x33,0x82,0xAA,0x71,0x45,0x26,0x22,0x11,0x00,0x90,0xCA,0xAD,0xBB,0xAA,0xCB,0xBA,0xBC,0xCB,0xBB,0xDB,0xBC,0xBE,0xAC,0x9A,0x89,0x99,0xBA,
+0xBC,0xCA,0x9B,0x88,0xA8,0xBA,0xAA,0xCC,0xCB,0xAC,0xDB,0xAA,0x0A,0x21,0x35,0x42,0x33,0x12,0x42,0x21,0x11,0xB8,0x29,0x77,0x34,0x33,0x23,0x45,0x42,0x53,0x22,0x02,
+0x08,0x89,0x89,0x00,0x20,0x44,0x45,0x43,0x34,0x22,0x01,0x98,0xBB,0xDB,0xBB,0x9B,0x90,0x09,0xA9,0xAA,0xCB,0xCE,0xCC,0xAB,0xCC,0xAB,0xBC,0xCB,0xBB,0xAA,0x10,0x21,
+0x12,0x00,0xB8,0xEC,0xAC,0xBD,0xBA,0xAD,0x9A,0x08,0x08,0x00,0x99,0xAA,0xCC,0xBC,0xAB,0x9A,0x28,0x76,0x34,0x44,0x33,0x33,0x13,0x11,0x10,0x21,0x11,0x20,0x53,0x34,
+0x33,0x24,0x11,0x80,0x0A,0x32,0x47,0x33,0x36,0x22,0x01,0x98,0x09,0x22,0x02,0x22,0xA0,0xBE,0xFB,0xCD,0xCC,0xBA,0xAB,0xAA,0x99,0x9A,0x9A,0x89,0x08,0xB9,0xCF,0xBC,
+0x9D,0x9A,0x99,0x99,0x89,0x28,0x22,0x02,0xD8,0xBD,0xAC,0xAA,0x9A,0x99,0xCA,0x9C,0x09,0x53,0x22,0x10,0x54,0x54,0x33,0x32,0x12,0x11,0x10,0x73,0x36,0x23,0x22,0x43,
+0x23,0x33,0x22,0x12,0x31,0x34,0x46,0x82,0xB9,0x89,0x31,0x22,0x14,0x32,0x67,0x44,0x23,0x81,0xCB,0xAD,0xAA,0xBA,0xEA,0xAC,0xBB,0x8A,0xA9,0x98,0xBB,0xAC,0x0A,0x01,
+0x01,0xFB,0xAD,0xA9,0x89,0x09,0x00,0x88,0x21,0x46,0x33,0x92,0xEB,0xAC,0xBA,0x89,0x00,0x00,0x52,0x45,0x35,0x22,0x80,0x98,0x89,0x08,0x22,0x24,0x43,0x54,0x53,0x53,
+0x21,0x11,0x00,0x01,0x18,0x91,0xA9,0xBD,0xBC,0x9A,0x30,0x44,0x33,0x34,0x13,0xB9,0xAC,0xBC,0xCC,0xBC,0x99,0x28,0x21,0xA0,0xFC,0xAF,0xBA,0xBA,0xCD,0xAA,0x99,0x88,
+0x01,0x00,0x90,0xB9,0x18,0x11,0xA0,0xCD,0x09,0x34,0x24,0x11,0x21,0x81,0x19,0x73,0x24,0x80,0xAB,0x41,0x46,0x43,0x34,0x33,0x34,0x43,0x33,0x13,0xA8,0xCB,0xA9,0xAB,
+0x19,0x54,0x63,0x43,0x53,0x22,0x10,0x88,0x88,0xA8,0xBD,0xAB,0xAA,0xBA,0x8A,0x61,0x22,0x90,0xAA,0xAA,0xEC,0xBD,0xCB,0xAB,0xAA,0x0A,0x08,0x11,0x91,0xDB,0xCF,0xDB,
+0xBB,0xCB,0x9A,0x08,0x10,0x32,0x43,0x24,0xA0,0xCC,0x8A,0x08,0x10,0x88,0x38,0x45,0x43,0x12,0x21,0x01,0x63,0x34,0x35,0x22,0x98,0x99,0x18,0x42,0x11,0x22,0x73,0x47,
+0x23,0x13,0x91,0xAA,0xCA,0x09,0x42,0x33,0x23,0x63,0x33,0x02,0xEC,0xDC,0xAB,0xAB,0x9A,0x10,0x21,0x01,0x10,0x02,0xB9,0xDF,0xCB,0xBB,0xAA,0x99,0x88,0x88,0x9A,0x89,
+0x81,0x08,0x90,0x99,0xDE,0xDC,0xCC,0xBC,0x9A,0x09,0x11,0x32,0x72,0x35,0x43,0x13,0x01,0x80,0x89,0x88,0x99,0x89,0x08,0x73,0x27,0x33,0x22,0x11,0x11,0x11,0x01,0x00,
+0x80,0x28,0x35,0x45,0x34,0x24,0x32,0x11,0x22,0x80,0xC9,0xEC,0xAC,0xDC,0xAB,0x8A,0x88,0xBA,0x9B,0x89,0x00,0xD9,0xDB,0xCC,0xCD,0xAB,0x99,0xA9,0xCA,0x9A,0x9A,0x88,
+0x08,0x00,0xFA,0xDB,0x8A,0x10,0x80,0x88,0x99,0x09,0x73,0x37,0x33,0x80,0x08,0x33,0x36,0x23,0x22,0x12,0x21,0x54,0x37,0x12,0x98,0x88,0x21,0x52,0x42,0x53,0x12,0x08,
+0x09,0x12,0x01,0x88,0x08,0x42,0x55,0x53,0x33,0x81,0x18,0x00,0x99,0xDA,0xCD,0xEB,0xBB,0xAB,0x89,0xCA,0xBC,0x9B,0x88,0x98,0xA8,0xBD,0xCD,0xAB,0x09,0x01,0x98,0x99,
+0x10,0x22,0x11,0xA2,0xEF,0xEB,0x99,0x31,0x33,0x36,0x32,0x12,0x21,0x21,0x02,0xBA,0xAC,0x61,0x55,0x33,0x35,0x32,0x23,0x01,0x00,0x88,0x9A,0x09,0x12,0x23,0x41,0x57,
+0x23,0x14,0x01,0x88,0x89,0x81,0xEA,0xBB,0xCC,0x09,0x21,0x22,0x13,0xA8,0xCA,0x8A,0x90,0xFE,0xCC,0xBD,0xBB,0xAA,0x99,0xA9,0x99,0xAB,0x89,0x01,0xFA,0xCD,0xBB,0x89,
+0x21,0x11,0x01,0x98,0x89,0x62,0x33,0xB0,0xCF,0x9B,0x30,0x45,0x22,0x13,0x18,0x31,0x56,0x33,0x22,0x90,0x00,0x21,0x33,0x33,0x24,0x21,0x62,0x45,0x23,0x81,0xC9,0x8A,
+0x88,0x08,0x32,0x91,0xBB,0x72,0x47,0x22,0xA0,0xBB,0xAB,0xAA,0xEB,0xEB,0xBB,0x9C,0x89,0x08,0x00,0xB9,0xAC,0xBB,0xDB,0xCC,0xAC,0x9A,0x88,0x80,0x08,0x80,0xDA,0xBC,
+0xBC,0xCB,0xCC,0xAC,0xAB,0x99,0x10,0x00,0x00,0x98,0x51,0x43,0x22,0x23,0x51,0x23,0x23,0x35,0x43,0x34,0x54,0x53,0x23,0x11,0x01,0x21,0x12,0x31,0x44,0x55,0x23,0x34,
+0x34,0x24,0x12,0x01,0x98,0xBA,0xAC,0x89,0x01,0x01,0x31,0x92,0xA9,0xBA,0xFC,0xCD,0xAD,0x99,0x98,0xA9,0xAC,0xBA,0xCC,0xBC,0xCB,0xCC,0xDB,0xAA,0x09,0x00,0x98,0x80,
+0x31,0x21,0x02,0xDA,0xBE,0xBD,0x9B,0x89,0x98,0x9A,0x18,0x32,0x55,0x26,0x32,0x53,0x43,0x24,0x53,0x12,0x22,0x22,0x22,0x21,0x34,0x11,0x11,0x43,0x33,0x83,0x88,0x98,
+0xA9,0xAA,0x50,0x37,0x11,0x20,0x45,0x12,0xC8,0xBB,0xBD,0xBB,0xBE,0xCA,0xBB,0xDC,0x9B,0x99,0xAA,0xBA,0x8A,0xAA,0xBA,0xBB,0xA9,0xDE,0xBB,0x9B,0xB9,0xCD,0xBD,0xA9,
+0xAA,0x08,0x43,0x92,0xAC,0x39,0x57,0x33,0x03,0x80,0x99,0x38,0x54,0x36,0x21,0x00,0x21,0x43,0x53,0x02,0x80,0xAA,0x9A,0x08,0xA8,0xEA,0x0B,0x51,0x26,0x43,0x12,0x01,
+0x88,0x08,0xA8,0xBE,0xAC,0x8B,0x21,0x23,0x24,0x21,0x12,0xA9,0xCE,0xDB,0xAD,0xAB,0xAB,0xB9,0xCA,0xBC,0xAC,0x89,0x89,0x00,0xA0,0xBB,0xAA,0x8A,0xBA,0xDF,0xCD,0xAA,
+0xAA,0xAA,0x9A,0x88,0x10,0x43,0x36,0x33,0x12,0x52,0x33,0x35,0x12,0x11,0x00,0x00,0x72,0x27,0x21,0x21,0x22,0x80,0x98,0xCB,0xCC,0xCB,0x8B,0x30,0x46,0x34,0x33,0x34,
+0x11,0x11,0x22,0x23,0x02,0x90,0x00,0x63,0x34,0x22,0xA1,0xBA,0xAE,0xAB,0xCC,0xCC,0xAB,0xBA,0x99,0x90,0xCA,0xDD,0xAA,0x9A,0x98,0xCA,0xCC,0xBC,0xCB,0x9A,0xCA,0xBB,
+0xAC,0x08,0x22,0x23,0x91,0xFB,0xAC,0x8A,0x00,0x08,0x80,0x20,0x44,0x35,0x12,0x81,0xAA,0x10,0x73,0x27,0x32,0x32,0x34,0x53,0x35,0x42,0x12,0x22,0x21,0x22,0x01,0x00,
+0x10,0x54,0x44,0x24,0x21,0x22,0x33,0x33,0x91,0xFB,0xCD,0xAA,0x8A,0x08,0x98,0xBA,0xAB,0xBA,0xCB,0xDD,0xDB,0xCD,0xAB,0x9C,0xA9,0xA9,0x89,0x18,0x31,0x12,0x81,0x99,
+0xBC,0x89,0x99,0xDC,0xBC,0x99,0x20,0x73,0x24,0x32,0x23,0x33,0x35,0x15,0x81,0x88,0x08,0x21,0x52,0x33,0x34,0x32,0x45,0x33,0x12,0x98,0x8A,0x51,0x34,0x44,0x23,0x22,
+0x22,0x11,0xCB,0xEF,0xBB,0xAC,0x9A,0x89,0x88,0x11,0x20,0x01,0xB8,0xFC,0xBD,0xBA,0x9B,0x99,0x88,0x00,0x42,0x45,0x22,0x02,0xA0,0xCD,0xCB,0x9B,0x99,0x9A,0x89,0x33,
+0x54,0x23,0x22,0x81,0xFB,0xCC,0xBC,0x9A,0x99,0x09,0x21,0x35,0x44,0x24,0x33,0x23,0x22,0x02,0x11,0x22,0x21,0x01,0x20,0x74,0x35,0x33,0x24,0x12,0x00,0x80,0xA9,0xFD,
+0xBB,0xBD,0x9B,0x21,0x44,0x34,0x12,0x01,0x80,0xBA,0xED,0xBB,0xCC,0x9A,0x00,0x12,0x12,0x31,0x21,0x34,0x81,0xEA,0xCB,0xCC,0xBA,0x9A,0x98,0x9A,0x88,0x10,0x42,0x23,
+0xA8,0xCD,0xAC,0xA9,0x98,0xB9,0xAD,0x8A,0x11,0x53,0x34,0x34,0x23,0x45,0x33,0x23,0x98,0x89,0x63,0x25,0x34,0x02,0x11,0x21,0x34,0x23,0x98,0x89,0x11,0x47,0x33,0x35,
+0x23,0x32,0x22,0xA8,0xDB,0xDB,0x8A,0x08,0x08,0x31,0x44,0x43,0x35,0x23,0xC9,0xBE,0xAE,0xAA,0x88,0x00,0x98,0xDA,0xCB,0xAB,0xCA,0xCC,0xCB,0xBB,0xA9,0x00,0x32,0x81,
+0xBA,0xDC,0xAB,0xBB,0xAE,0x9A,0x09,0x32,0x44,0x34,0x13,0x32,0x53,0x35,0x43,0x22,0x11,0x11,0x21,0x44,0x34,0x23,0x34,0x23,0x24,0x98,0xBB,0xCC,0x8A,0x18,0x34,0x37,
+0x22,0x31,0x33,0x14,0xCA,0xBD,0xBD,0xAB,0x89,0x11,0x34,0x24,0x22,0x22,0x83,0xFA,0xDD,0xDB,0xBB,0xBC,0xBB,0xAA,0x88,0x21,0x22,0x13,0x90,0xCA,0xCC,0xBB,0xEB,0xAB,
+0xAA,0x19,0x32,0x54,0x34,0x33,0x24,0x01,0x81,0x00,0x08,0x89,0x31,0x45,0x34,0x44,0x32,0x46,0x32,0x14,0x02,0x00,0x10,0x11,0x01,0x98,0xAA,0xBC,0x0A,0x42,0x34,0x45,
+0x22,0x24,0x23,0x23,0xA0,0xCC,0xBC,0xAC,0x88,0x11,0x33,0x24,0x81,0x89,0xDA,0xDE,0xCD,0xCA,0xAB,0xAA,0x98,0x88,0x00,0x10,0x30,0x24,0x90,0xAC,0xCC,0xBD,0xAB,0x09,
+0x11,0x23,0x44,0x53,0x34,0x01,0x98,0xA9,0xA9,0x9A,0x88,0xFA,0x9A,0x28,0x63,0x35,0x12,0x81,0x18,0x52,0x54,0x23,0x81,0x98,0x88,0x20,0x47,0x32,0x01,0x20,0x32,0x34,
+0x01,0xBA,0xAB,0x10,0x30,0x37,0x12,0x00,0x29,0x33,0xF8,0xCC,0xCD,0x9A,0xAA,0x99,0x9A,0xB8,0xBC,0xBE,0x99,0x99,0x18,0x80,0x00,0x35,0x14,0xC9,0xCC,0xBB,0xBC,0x9A,
+0x88,0x21,0x35,0x22,0x22,0x91,0xBC,0xEB,0xBC,0xBC,0x99,0x38,0x35,0x37,0x11,0x01,0x98,0xAB,0xA9,0xBA,0xBC,0x20,0x54,0x52,0x54,0x32,0x33,0x21,0x22,0x11,0x90,0xBD,
+0x8B,0xB9,0xAC,0x0A,0x41,0x15,0x98,0xCD,0xAA,0xBA,0xDD,0x9A,0x99,0x09,0x31,0x37,0x26,0x12,0x80,0xA8,0xAA,0xCC,0xCC,0xBC,0xAC,0xBA,0xA9,0x8A,0x88,0x98,0x08,0x52,
+0x45,0x12,0xA0,0xA9,0x89,0x20,0x22,0x12,0x01,0x80,0x72,0x54,0x12,0x10,0x99,0x8A,0x18,0x22,0x12,0x62,0x45,0x43,0x33,0x34,0x64,0x23,0x23,0x01,0xA0,0xEB,0x9B,0x10,
+0x21,0x22,0x80,0x11,0x02,0xC8,0xDA,0xBE,0xBD,0xAC,0x88,0x11,0x43,0x22,0x53,0x33,0x03,0xB9,0xAF,0xCB,0x99,0xC9,0xAC,0xBC,0xAA,0x09,0x21,0x03,0xA9,0xAB,0xAA,0xBC,
+0xED,0xAC,0xAA,0x08,0x31,0x63,0x23,0x10,0x42,0x45,0x33,0x13,0x98,0x09,0x31,0x13,0x90,0x18,0x54,0x36,0x43,0x12,0x81,0x88,0x28,0x64,0x14,0x80,0x8A,0x30,0x45,0x22,
+0x80,0xA9,0xBC,0xBE,0x8A,0x00,0xCB,0xBF,0x9A,0x30,0x55,0x12,0x12,0x01,0x88,0xA9,0xBA,0xCC,0xAD,0xBB,0xAC,0x99,0xA9,0xBB,0x89,0x18,0x20,0x02,0xFA,0xBD,0xBB,0x0A,
+0x72,0x23,0x81,0x21,0x55,0x43,0x23,0x81,0x88,0x80,0x01,0x22,0x53,0x22,0x10,0x44,0x45,0x33,0x01,0x08,0x31,0x16,0x80,0xAA,0xDC,0xCA,0xBB,0x9A,0x11,0x21,0x98,0x89,
+0x89,0xAA,0x0B,0x64,0x43,0x82,0xFB,0x9C,0xA9,0xBC,0xCB,0x9A,0x99,0x18,0x45,0x33,0x23,0xDA,0xAC,0xAA,0xDB,0xBC,0xCB,0xBB,0x08,0x42,0x24,0x03,0xC9,0xBE,0xAA,0xBA,
+0xBA,0x9C,0x08,0x42,0x35,0x54,0x34,0x32,0x01,0xA8,0x99,0xAA,0xBB,0xCC,0x8A,0x89,0x00,0x74,0x54,0x24,0x33,0x13,0x32,0x23,0x91,0xDA,0xBD,0xBB,0xAC,0x8A,0x21,0x42,
+0x01,0xC9,0xBA,0xAA,0x99,0x20,0x33,0x25,0x43,0x34,0x34,0x01,0xEA,0x9A,0x9A,0xBB,0xCD,0xA9,0xBB,0xCB,0xBC,0xA9,0x08,0x80,0xCA,0xDC,0xBB,0xBE,0xBC,0x9C,0x20,0x24,
+0x54,0x22,0x32,0x22,0x11,0x90,0xBD,0xCD,0xBB,0xAA,0x18,0x53,0x24,0x54,0x32,0x24,0x22,0x80,0xA9,0xBC,0xAB,0x9A,0x20,0x23,0x64,0x23,0x25,0x12,0x98,0xDB,0xAC,0xBA,
+0x9A,0x8A,0x18,0x72,0x33,0x24,0x01,0xA0,0xEA,0xAC,0xAB,0xAB,0xBA,0xAB,0x1A,0x44,0x25,0x80,0xAA,0xCD,0xAC,0xBA,0xAC,0xDA,0xBA,0xBA,0x89,0x21,0x33,0x35,0x43,0x43,
+0x43,0x02,0xA0,0xBC,0xAD,0x9B,0x1A,0x32,0x36,0x43,0x24,0x43,0x12,0x81,0x80,0x88,0x88,0xAB,0x99,0x52,0x65,0x43,0x53,0x13,0x23,0x11,0x00,0x81,0xDA,0xCC,0x9B,0x89,
+0x10,0x32,0x33,0x23,0xC8,0xBF,0x9A,0xAA,0xEB,0x9C,0x99,0x88,0x08,0x98,0xB9,0xCE,0xCD,0xAB,0xAA,0x98,0x88,0x01,0x00,0x22,0x32,0x81,0xDC,0xDC,0xBA,0xBB,0xBC,0x0A,
+0x53,0x24,0x43,0x33,0x54,0x21,0x01,0x80,0x89,0xDB,0xAB,0x48,0x45,0x34,0x33,0x33,0x22,0xA8,0xDB,0xBC,0xCB,0x9C,0x09,0x31,0x35,0x34,0x54,0x43,0x13,0x81,0xA9,0xCA,
+0xBB,0xCB,0x9A,0x99,0x20,0x55,0x32,0x14,0x81,0x98,0xA8,0xBC,0xCE,0xAB,0xAB,0x09,0x21,0x35,0x24,0x01,0x00,0x08,0xB9,0xDE,0xAB,0xAC,0x89,0x20,0x21,0x02,0x80,0x99,
+0x88,0xCA,0xDE,0xBB,0xCB,0x09,0x52,0x43,0x13,0x80,0x08,0x21,0x80,0xFB,0xAB,0xAB,0x28,0x55,0x34,0x34,0x32,0x21,0x31,0x92,0xFB,0xBC,0xAA,0x08,0x42,0x54,0x43,0x32,
+0x12,0x10,0x00,0xC9,0xCD,0xBC,0x9A,0x89,0x11,0x33,0x53,0x23,0x01,0x90,0xEB,0xBD,0xBD,0xAB,0x9A,0x08,0x31,0x42,0x24,0x22,0x01,0x80,0xEB,0xCE,0xCB,0xBB,0xA9,0x99,
+0x89,0x08,0x21,0x12,0x43,0x22,0x02,0xD9,0xBD,0x9A,0x20,0x42,0x43,0x44,0x43,0x43,0x22,0x32,0x12,0x01,0x11,0x33,0x24,0x01,0x31,0x46,0x44,0x12,0x88,0xC9,0xBB,0xAB,
+0x09,0x01,0xB9,0xBF,0x8A,0x62,0x43,0x22,0x01,0x98,0x99,0xAA,0xFB,0xAA,0xBC,0x99,0x72,0x23,0x82,0xC9,0xBD,0xBB,0xAB,0xDC,0xAC,0xAA,0xAB,0xAA,0x80,0x80,0xAB,0xCD,
+0xAB,0x9B,0xB8,0xBD,0x9A,0x21,0x56,0x44,0x35,0x33,0x22,0x12,0x10,0x80,0xEB,0xAC,0x19,0x53,0x43,0x33,0x53,0x33,0x22,0x81,0xB9,0xCD,0xDC,0xAB,0xAB,0x88,0x10,0x31,
+0x24,0x33,0x23,0x12,0x80,0xEA,0xDB,0xBC,0x9A,0x89,0x52,0x46,0x42,0x11,0x90,0x98,0x99,0x98,0xCB,0xCB,0xAB,0x99,0x41,0x63,0x12,0x98,0xAB,0xAA,0x8A,0x21,0x33,0x27,
+0x23,0x01,0x33,0x36,0x13,0x98,0xCC,0xCB,0xAC,0x99,0x31,0x43,0x12,0x01,0x21,0x65,0x34,0x23,0x81,0xDA,0xBC,0x89,0x31,0x13,0xA8,0xBC,0x9B,0x18,0x22,0xA9,0xEF,0xBC,
+0xAB,0x8A,0x00,0x98,0xA9,0x09,0x22,0x02,0x00,0x71,0x47,0x23,0x21,0x01,0x32,0x81,0xD9,0xDB,0xBC,0xCC,0xBC,0x89,0x20,0xA1,0xDC,0xAD,0x09,0x10,0x81,0xB9,0xBC,0xBB,
+0x1A,0x54,0x35,0x12,0x01,0x10,0x22,0x81,0xDE,0xCB,0xAB,0xAA,0x08,0x42,0x13,0x21,0x33,0x36,0x32,0x12,0x20,0x45,0x33,0x13,0x72,0x25,0x24,0x12,0x22,0x10,0x90,0xCA,
+0xBC,0xBA,0xAC,0xAB,0x89,0x21,0x12,0x44,0x43,0x03,0xDA,0xAF,0xAB,0xAC,0xC9,0x9A,0x9A,0x9A,0x9B,0x20,0x44,0x02,0xCC,0xBC,0x8A,0x00,0x81,0xCA,0x89,0x8A,0x73,0x37,
+0x44,0x12,0x80,0x80,0x99,0xBB,0xCD,0xAA,0x9A,0x98,0x19,0x63,0x25,0x02,0x90,0x98,0xBA,0xDC,0xBB,0x9C,0x98,0x09,0x51,0x37,0x43,0x11,0x11,0x21,0x23,0xA0,0xCD,0xBB,
+0xAB,0xAA,0x89,0x20,0x12,0x41,0x73,0x35,0x12,0xB9,0xBD,0xAC,0xCA,0xBA,0x9B,0x18,0x53,0x43,0x45,0x22,0x80,0xB9,0x8B,0x18,0x81,0xB9,0xAC,0x1A,0x21,0x63,0x43,0x02,
+0xB9,0xBD,0x88,0x91,0xC9,0x9B,0x52,0x45,0x25,0x33,0x34,0x11,0x00,0x98,0xA9,0xDC,0xCB,0x9A,0x21,0x45,0x33,0x23,0x02,0x90,0xA8,0xCB,0xFD,0xCB,0xAC,0xA9,0x88,0x21,
+0x33,0x54,0x23,0x23,0x81,0xB9,0xCD,0xBC,0xBB,0xAB,0x8B,0x20,0x63,0x34,0x33,0x14,0x81,0xBA,0xCD,0xAA,0x99,0xA9,0xAA,0x89,0x31,0x36,0x24,0x11,0xA0,0xDF,0xDB,0xBB,
+0x9A,0x8A,0x99,0x00,0x52,0x34,0x35,0x34,0x24,0x12,0x90,0x89,0x08,0x00,0x99,0x09,0x51,0x23,0x00,0x80,0x31,0x04,0xE9,0xAE,0xAA,0x8A,0x88,0x11,0x44,0x12,0x18,0x10,
+0x23,0x03,0x00,0x62,0x43,0x23,0x81,0x80,0x80,0x31,0x60,0x26,0x91,0xEF,0xAA,0x9A,0xA8,0x99,0xCB,0x99,0xB9,0xBA,0xAC,0x98,0xBD,0xCC,0x08,0x22,0x23,0x23,0x98,0xA0,
+0xFF,0xAC,0x99,0x08,0x89,0x19,0x44,0x53,0x64,0x33,0x34,0x23,0x02,0x21,0x32,0x32,0x90,0x98,0xCB,0xBF,0xAA,0x88,0x00,0xB8,0xDD,0xBC,0xCC,0x9A,0x88,0x11,0x81,0x99,
+0x28,0x55,0x23,0x90,0x98,0xA8,0xCB,0xBD,0x09,0x31,0x01,0x9A,0x41,0x14,0xF8,0xBE,0xBB,0x10,0x01,0xB9,0x9A,0x51,0x34,0x53,0x33,0x23,0xC8,0xDE,0xAA,0x9A,0xA9,0x8A,
+0x28,0x45,0x32,0x23,0x42,0x23,0x22,0x00,0x88,0xB9,0xBE,0x38,0x77,0x43,0x12,0x10,0x01,0x00,0x88,0x9A,0xAA,0xCC,0xCB,0x9B,0x21,0x44,0x53,0x22,0x82,0xA9,0xAD,0xAB,
+0xCB,0xDC,0xBB,0x9A,0x89,0x89,0x21,0x47,0x22,0x81,0x98,0x89,0xFB,0xCC,0xBB,0xAA,0x88,0x08,0x32,0x53,0x33,0x22,0x11,0x12,0xEB,0xCD,0x9A,0x98,0x88,0x08,0x33,0x27,
+0x21,0x21,0x32,0x92,0xFD,0xBC,0xAA,0xAA,0xBA,0x89,0x73,0x43,0x12,0x11,0x12,0x01,0xBB,0x9D,0x18,0x10,0x99,0x48,0x57,0x25,0x33,0x22,0x12,0x98,0xDB,0x9A,0x99,0x98,
+0xAB,0x89,0x52,0x43,0x14,0x11,0xC9,0xDE,0xAB,0x9B,0x18,0x01,0x80,0x01,0x32,0x34,0x11,0xA8,0xFB,0xCB,0xBC,0xA9,0x88,0x11,0x22,0x44,0x34,0x34,0x81,0xA9,0xDB,0xBD,
+0xAB,0x9A,0x00,0x32,0x54,0x42,0x23,0x81,0xA9,0xBA,0xCF,0xDB,0x9A,0x18,0x43,0x44,0x24,0x44,0x23,0x12,0x80,0x98,0xCA,0xAC,0x9A,0x20,0x32,0x21,0x53,0x34,0x23,0x98,
+0xAB,0xBB,0xCE,0xBC,0xAA,0x89,0x88,0x42,0x53,0x13,0x90,0xBD,0xBB,0xCD,0xDB,0xBB,0xBB,0x89,0x20,0x45,0x24,0x01,0x98,0x89,0x08,0xD9,0xBD,0xAB,0x08,0x11,0x11,0x23,
+0x13,0xA8,0x0A,0x47,0x34,0x80,0x9A,0x30,0x35,0x10,0x11,0x44,0x13,0xA9,0x09,0x54,0x91,0xEC,0x8A,0x62,0x32,0x13,0x21,0x34,0x12,0xBA,0xBD,0x89,0xA9,0xAB,0x19,0x55,
+0x35,0x42,0x32,0x23,0x90,0xDC,0xBC,0xCC,0xBA,0xAB,0x09,0x21,0x42,0x25,0x34,0x01,0xCA,0xBC,0xBC,0xAA,0xBC,0xCB,0xAB,0x89,0x31,0x46,0x24,0x22,0x80,0xA9,0xAA,0xDC,
+0xBB,0xAC,0x9A,0x89,0x51,0x44,0x43,0x11,0x81,0x99,0x99,0xA9,0x8A,0x20,0x33,0x23,0x31,0x47,0x33,0x35,0x12,0xA0,0xCC,0xAD,0xBA,0xAA,0xBA,0x9B,0x18,0x34,0x24,0x00,
+0x20,0x90,0xBF,0x8B,0x41,0x46,0x23,0x22,0x22,0x23,0xB8,0xCF,0xBA,0xAB,0xCB,0x8A,0x10,0x33,0x23,0x18,0x66,0x33,0x13,0xA8,0xBC,0xDC,0xAC,0x9A,0x11,0x32,0x81,0xBB,
+0x09,0x21,0x91,0xAC,0xDB,0xBE,0xBB,0x08,0x66,0x23,0x13,0x10,0x21,0x11,0xA0,0xBC,0xAB,0xAA,0x09,0x74,0x45,0x24,0x23,0x21,0x21,0x98,0xDC,0xCB,0xBB,0x9A,0x09,0x42,
+0x36,0x43,0x33,0x32,0x02,0xC8,0xBD,0xBC,0x9A,0x99,0x08,0x20,0x44,0x25,0x23,0x11,0xC9,0xCD,0xDB,0xAA,0x89,0x08,0x00,0x00,0x20,0x33,0x14,0x88,0xCC,0xCD,0xAA,0xBB,
+0x98,0x08,0x88,0xBB,0xCB,0x9A,0x99,0x31,0x76,0x23,0x24,0x11,0x42,0x63,0x33,0x23,0x01,0x00,0x88,0xB9,0x9A,0x10,0x21,0x12,0x73,0x47,0x12,0x91,0xCA,0xAA,0xCB,0xBA,
+0xBD,0x89,0x10,0x32,0x44,0x32,0x01,0xA8,0xCC,0xCD,0xBA,0x9A,0x11,0x33,0x44,0x12,0x00,0x98,0x00,0x88,0x11,0x80,0x8B,0x74,0x15,0x90,0x8A,0x9A,0xA8,0xBA,0xBC,0xBA,
+0x9B,0x98,0x71,0x47,0x04,0xDB,0xCD,0xAA,0x9A,0x99,0x18,0x33,0x45,0x32,0x43,0x63,0x24,0x11,0xA9,0xCB,0xAA,0x9A,0x09,0x11,0x90,0xCC,0xBB,0x9C,0x08,0x21,0x01,0xC8,
+0xBE,0xCC,0x89,0x30,0x14,0x98,0xBC,0xBC,0x9C,0x28,0x34,0x24,0x22,0x12,0x43,0x24,0x90,0xCE,0xCC,0xAB,0xBA,0x08,0x42,0x53,0x44,0x43,0x33,0x12,0x98,0xDB,0xBB,0xCB,
+0x9A,0x9A,0x08,0x32,0x55,0x24,0x32,0x81,0xD9,0xBC,0xBC,0xA9,0x89,0x10,0x44,0x34,0x23,0x00,0x88,0x98,0xDB,0xCD,0xAB,0x09,0x21,0x44,0x73,0x33,0x23,0x12,0x90,0x99,
+0xCB,0xDB,0xBC,0xAA,0xAB,0x9A,0x21,0x54,0x33,0x22,0x80,0xBA,0xCA,0xBB,0xAC,0xBB,0x9A,0x08,0x73,0x32,0x02,0xC9,0xCE,0xBA,0x9C,0x89,0x88,0x08,0x11,0x22,0x32,0x45,
+0x24,0x12,0xA9,0x8A,0x00,0xCA,0xCC,0xAA,0x98,0xA9,0xBC,0x31,0x47,0x11,0x88,0x28,0x25,0x01,0x21,0x65,0x12,0x91,0x99,0x48,0x45,0x22,0x12,0x22,0x81,0xBC,0x9B,0x20,
+0xB1,0xFF,0xCB,0x89,0x10,0x88,0xAA,0xAA,0xCB,0xBC,0x8A,0x33,0x04,0xAB,0x2A,0x57,0x33,0x82,0x98,0x89,0xFA,0xBC,0xAC,0x08,0x10,0x00,0x30,0x74,0x33,0x32,0x12,0x23,
+0x02,0xC9,0xBA,0xAC,0x89,0x09,0x51,0x24,0x01,0x11,0x65,0x23,0x91,0xEB,0x9C,0xBA,0x99,0x18,0x63,0x44,0x12,0x11,0x10,0x01,0xA8,0xAA,0x09,0x98,0xDA,0xBE,0xBB,0x9A,
+0xCC,0xCB,0x9B,0x10,0x34,0x53,0x14,0x02,0x98,0xAB,0xCB,0xCD,0xCA,0xBC,0xAB,0x9A,0x08,0x32,0x54,0x43,0x43,0x23,0x91,0xEA,0xCB,0xAA,0x9A,0x88,0x10,0x42,0x33,0x36,
+0x22,0x03,0xC8,0xBB,0x9A,0x80,0xAA,0x40,0x77,0x34,0x32,0x11,0x11,0x01,0xA8,0xBB,0x8A,0xA9,0xBD,0x0A,0x56,0x44,0x02,0x81,0x90,0xBA,0xDC,0xAD,0xA9,0x88,0xA9,0x09,
+0x41,0x43,0x14,0x22,0x33,0x01,0xC9,0xCD,0xAB,0x88,0x88,0x10,0x35,0x26,0x11,0x11,0x01,0xB8,0xEC,0xBB,0xAB,0x00,0x00,0x90,0x89,0x80,0x90,0xBA,0xCC,0xEC,0xCB,0xBB,
+0xAC,0xCB,0xA9,0xAA,0x89,0x32,0x55,0x22,0x81,0xA9,0x9A,0xA8,0x31,0x54,0x57,0x53,0x23,0x22,0x02,0x88,0xB9,0xDB,0xBB,0xBF,0xBC,0xAC,0x99,0x10,0x31,0x34,0x34,0x23,
+0x03,0x80,0xB9,0xCC,0xCD,0xBA,0x9A,0x10,0x33,0x54,0x33,0x23,0x88,0xBA,0xDA,0xBC,0xDB,0x9B,0x8A,0x20,0x64,0x32,0x25,0x12,0x80,0x89,0xB9,0xDB,0xAC,0x0A,0x21,0x53,
+0x32,0x43,0x23,0x91,0xEA,0xBB,0xBA,0xCB,0xCB,0x9B,0x18,0x32,0x47,0x44,0x34,0x12,0x90,0xBA,0xBB,0xBC,0xBB,0x89,0x21,0x32,0x42,0x45,0x43,0x12,0xB8,0xBE,0xAA,0x10,
+0x43,0x33,0x22,0x80,0xCB,0x99,0x88,0xA8,0xBC,0xED,0xAA,0x8A,0x31,0x46,0x13,0x81,0xB9,0xCD,0xCB,0xCC,0xBA,0xAA,0x88,0x21,0x46,0x53,0x34,0x21,0x90,0xB9,0xBC,0xCC,
+0xAA,0xA9,0x99,0x88,0x31,0x46,0x43,0x23,0x01,0x80,0x80,0xA8,0xBA,0xBB,0xBB,0x09,0x55,0x64,0x43,0x24,0x02,0x90,0x99,0xAA,0xAA,0x89,0x11,0x11,0x11,0x32,0x77,0x32,
+0x01,0xDA,0xBD,0xCB,0xAC,0x9A,0x88,0x98,0x9A,0x99,0x30,0x55,0x22,0x02,0x00,0x80,0xBA,0x9C,0x20,0x35,0x90,0x8A,0x09,0x43,0x25,0x11,0x98,0x89,0x81,0x19,0x44,0x47,
+0x13,0x32,0x22,0x01,0x98,0xC0,0xFD,0xAE,0xAA,0x99,0x08,0x80,0x99,0x10,0x44,0x33,0x34,0x63,0x02,0xD8,0xAB,0x09,0x32,0x36,0x21,0x81,0x80,0x89,0xAA,0xBA,0xFB,0xCE,
+0xCB,0x99,0x89,0x10,0x32,0x12,0xB0,0xDC,0xBD,0xBA,0xAA,0x98,0x8A,0xAA,0x88,0x73,0x45,0x34,0x11,0x99,0xCB,0xAC,0x8A,0x08,0x11,0x01,0x21,0x53,0x44,0x23,0x22,0x42,
+0x23,0x01,0x8A,0x18,0x80,0x9A,0x49,0x57,0x22,0xA0,0xBC,0x8A,0x52,0x81,0xCB,0x99,0x89,0x98,0x0B,0x38,0x36,0x13,0x99,0x0A,0x74,0x44,0x32,0x35,0x02,0xC9,0xCE,0xBB,
+0xAA,0x88,0x10,0x20,0x33,0x35,0x23,0x12,0x82,0xC8,0xBD,0xCD,0x9A,0x10,0x43,0x25,0x33,0x25,0x32,0x13,0xA8,0xEB,0xCD,0xCB,0xCC,0xAA,0x99,0x08,0x12,0x33,0x43,0x53,
+0x22,0x12,0x91,0xBB,0xDB,0xBB,0xAA,0xAA,0x20,0x45,0x44,0x22,0x22,0x22,0x11,0x10,0x08,0x00,0xA9,0xED,0xBA,0x8B,0x00,0x41,0x54,0x36,0x22,0x81,0x98,0x9A,0xBA,0xAC,
+0xAA,0x88,0x10,0x31,0x56,0x44,0x12,0xB9,0x9C,0xCA,0xBB,0xBC,0x89,0x11,0x89,0x18,0x74,0x35,0x13,0xA0,0xBC,0xBC,0xDD,0xCB,0xAB,0x99,0x98,0x00,0x22,0x54,0x33,0x42,
+0x12,0x02,0x80,0x99,0x08,0x33,0x92,0xBB,0x2A,0x22,0x32,0x47,0x45,0x02,0x98,0xAB,0x19,0x65,0x23,0x11,0x00,0x31,0x12,0x52,0x24,0x91,0xBC,0xAE,0xAB,0x9A,0xB9,0xCB,
+0xBC,0xAB,0xCC,0xAA,0x9A,0xA9,0x09,0x42,0x25,0x01,0x99,0x99,0xCA,0xDE,0xCC,0xAC,0x9A,0x9A,0x99,0x28,0x53,0x24,0x21,0x01,0x11,0x01,0x01,0x01,0x20,0xA8,0xCC,0x09,
+0x46,0x56,0x22,0x13,0x00,0x80,0x10,0x00,0x10,0x88,0xFB,0xBC,0x09,0x54,0x46,0x12,0x02,0x88,0x88,0xA9,0xAA,0x99,0xAA,0xEC,0x9A,0x18,0x54,0x24,0x21,0x11,0x31,0x91,
+0xCA,0xCC,0xCC,0xBC,0xAD,0x99,0x09,0x01,0x10,0x31,0x36,0x53,0x12,0x01,0x80,0xEB,0xDB,0xBB,0xAA,0x08,0x20,0x22,0x53,0x43,0x35,0x22,0x91,0xC9,0xCC,0xBB,0xAC,0xA9,
+0x89,0x20,0x33,0x45,0x43,0x24,0x13,0x90,0xDA,0xAD,0xBB,0x9B,0x99,0x00,0x42,0x43,0x36,0x43,0x25,0x21,0x00,0x98,0x99,0x98,0x08,0x98,0xBA,0xAB,0x1A,0x73,0x53,0x13,
+0x91,0xDB,0xDC,0xAB,0xAB,0x88,0x88,0x08,0x08,0x21,0x12,0x02,0xC9,0xFD,0xBB,0xAE,0xAA,0x88,0x01,0x80,0x18,0x63,0x63,0x23,0x22,0x88,0xCC,0xCC,0xBC,0xBA,0x99,0x00,
+0x21,0x52,0x34,0x23,0x01,0xA8,0xAA,0xBA,0xDC,0xAD,0x8A,0x20,0x43,0x63,0x54,0x33,0x23,0x80,0xA9,0xAA,0xAA,0xCB,0x8A,0x31,0x35,0x44,0x42,0x24,0x12,0x90,0xDB,0xAD,
+0xBB,0x9A,0x9A,0xA8,0xA8,0xAA,0x9A,0x99,0xBA,0xCC,0xCB,0xFC,0xBB,0xAA,0x10,0x44,0x23,0x32,0x21,0x82,0xC9,0xBE,0xBC,0xBB,0xCE,0xA9,0x18,0x43,0x34,0x33,0x33,0x33,
+0x33,0x33,0x22,0xA0,0xDC,0xAC,0x18,0x53,0x23,0x01,0x09,0x31,0x45,0x12,0x81,0x88,0x00,0x73,0x36,0x33,0x92,0xDA,0xAD,0x99,0x08,0x80,0x88,0x88,0x88,0x52,0x56,0x34,
+0x32,0x12,0x01,0x88,0xDA,0xCC,0xBC,0xBA,0xAC,0xCB,0x9B,0x00,0x12,0x32,0x33,0x74,0x32,0x24,0x12,0x81,0x80,0xEB,0xCC,0xAB,0xAB,0xBA,0xAB,0x89,0x30,0x56,0x24,0x22,
+0x11,0x00,0x89,0x00,0x31,0x33,0x01,0x90,0xBA,0x8B,0x73,0x15,0xA0,0xCD,0xCD,0xBA,0xAA,0x99,0x89,0xA9,0x09,0x61,0x44,0x55,0x22,0x23,0x02,0x80,0xAA,0x9A,0x98,0xCB,
+0xDC,0x9A,0x89,0x20,0x34,0x43,0x14,0x81,0xEB,0xDB,0x9A,0x18,0x10,0x00,0x00,0x12,0x52,0x34,0x23,0x92,0xFA,0xBE,0xDB,0x9A,0x08,0x01,0x00,0x20,0x43,0x33,0x82,0xB9,
+0xAD,0xCA,0xBC,0xBE,0x8A,0x21,0x43,0x26,0x33,0x14,0x80,0xDB,0xCB,0xAB,0xAA,0xBA,0x18,0x54,0x34,0x32,0x24,0x22,0x82,0xEB,0xCC,0xCB,0x99,0x09,0x20,0x45,0x33,0x24,
+0x11,0x81,0x98,0xBA,0xDE,0xCB,0xCB,0x89,0x18,0x32,0x25,0x31,0x22,0x22,0x80,0xBA,0xCC,0xBD,0xCC,0xAB,0x89,0x10,0x43,0x23,0x33,0x12,0x88,0xBB,0xBE,0xDB,0x9C,0xAA,
+0x9A,0x20,0x45,0x45,0x22,0x12,0x00,0x00,0x00,0x99,0xBA,0xAD,0x99,0x08,0x20,0x42,0x34,0x43,0x23,0x52,0x33,0x23,0x22,0x80,0x80,0x00,0x91,0xFC,0xBD,0xBC,0xDB,0xAC,
+0x9A,0x32,0x54,0x22,0x11,0x80,0x80,0xA9,0xCD,0xBB,0x9C,0x9A,0x0A,0x31,0x44,0x22,0x12,0x33,0x01,0xC9,0xBD,0xAD,0x8A,0x08,0x52,0x55,0x43,0x02,0xA9,0x9A,0x99,0xA9,
+0xAC,0xA9,0x88,0x00,0x32,0x67,0x44,0x33,0x02,0x99,0xAA,0xAA,0xAB,0x09,0x42,0x11,0x42,0x64,0x45,0x22,0x13,0x81,0xBA,0xBD,0xAC,0xBA,0xBA,0xCE,0xBA,0xAB,0x8A,0x21,
+0x44,0x43,0x23,0x01,0x90,0x00,0x90,0x9A,0xBD,0xCC,0xCC,0xEB,0x9A,0x18,0x22,0x33,0x32,0x33,0x01,0x10,0x20,0xA0,0xED,0xAB,0xAB,0x28,0x74,0x33,0x26,0x23,0x13,0x81,
+0x10,0x32,0x81,0xFB,0xCC,0xCB,0xAB,0xBB,0x99,0x31,0x45,0x22,0x21,0x22,0x02,0x98,0xBC,0xDB,0xAC,0xA9,0xAA,0xAC,0x40,0x73,0x23,0x33,0x22,0xA8,0xDC,0xBD,0xDB,0xAB,
+0xBA,0xBB,0x89,0x53,0x35,0x12,0x12,0x12,0xA8,0xED,0xAC,0xAA,0x9A,0x99,0x9A,0x10,0x54,0x33,0x31,0x34,0x13,0xB8,0xCE,0x8A,0x20,0x53,0x23,0x23,0x45,0x33,0x33,0x21,
+0x00,0xC8,0xCD,0xCC,0xAA,0x99,0x08,0x11,0x11,0x22,0x43,0x34,0x21,0x01,0x90,0x80,0xDB,0xBC,0x0A,0x64,0x24,0x12,0x22,0x21,0x80,0xDA,0xCD,0xBC,0x99,0x08,0x08,0x9A,
+0xAB,0xAA,0xBA,0xAB,0x18,0x52,0x44,0xD8,0xCE,0xAA,0x9A,0x98,0xCB,0xBC,0x9B,0x09,0x21,0x43,0x53,0x35,0x21,0x00,0x88,0x28,0x22,0x01,0xCA,0xCB,0x08,0x42,0x36,0x55,
+0x34,0x21,0x00,0x88,0x00,0x98,0x99,0x08,0x32,0x15,0x81,0x08,0x73,0x27,0x23,0x23,0x42,0x12,0x88,0xA9,0x19,0x62,0x03,0x90,0xA9,0xAA,0x28,0x53,0x83,0xDE,0xDD,0xBC,
+0xDB,0xAA,0xAA,0x09,0x18,0x11,0x11,0x62,0x43,0x23,0x91,0xDA,0xAD,0xBB,0xAD,0xBC,0xAA,0x09,0x21,0x44,0x43,0x43,0x22,0x02,0x98,0xA9,0xBB,0xCB,0xBC,0x19,0x53,0x44,
+0x33,0x22,0x22,0x45,0x22,0x80,0x88,0x08,0x98,0xDA,0x9A,0x62,0x45,0x13,0x01,0x00,0x21,0x81,0xCB,0xAB,0xBC,0xDD,0xBC,0xAB,0x88,0x21,0x01,0x08,0x31,0x36,0x43,0x35,
+0x24,0x82,0xBA,0xBD,0xCD,0xBA,0xBC,0xCB,0xBA,0x89,0x09,0x08,0x11,0x03,0x00,0x9A,0x08,0x88,0xB9,0xEB,0xAC,0x0A,0x53,0x13,0xC8,0xBE,0xCC,0xAA,0x8A,0x11,0x23,0x44,
+0x33,0x74,0x44,0x44,0x23,0x32,0x21,0x21,0x21,0x22,0x11,0x98,0xCB,0xBD,0xAD,0x88,0x32,0x12,0x82,0xA8,0x0A,0x72,0x34,0x24,0x11,0x80,0xCA,0xCE,0xBB,0xAA,0x89,0x01,
+0x80,0xAA,0x38,0x36,0x25,0x00,0x98,0xAA,0xCD,0xCB,0xBD,0xAA,0x8A,0xA8,0xBA,0xEB,0x9A,0x89,0x99,0xBB,0xCE,0xBB,0xBA,0x9B,0x30,0x46,0x44,0x11,0xA0,0xCB,0xAC,0xA9,
+0x99,0xA9,0x09,0x10,0x63,0x55,0x44,0x43,0x22,0x11,0x98,0x99,0x98,0x01,0x21,0x98,0xDB,0xBB,0x19,0x44,0x35,0x33,0x01,0xC9,0xCB,0xAA,0x89,0x20,0x21,0x34,0x32,0x64,
+0x43,0x25,0x82,0xCA,0xCE,0xAB,0xBB,0xAB,0xAC,0xAA,0x89,0x00,0x80,0x20,0x33,0x35,0x01,0xCA,0xBC,0xAD,0x99,0x10,0x30,0x44,0x54,0x34,0x34,0x22,0x12,0x98,0xDC,0xBB,
+0xAC,0x08,0x22,0x33,0x11,0x11,0x10,0xC0,0xBC,0xAA,0xBA,0xCD,0xCD,0x9A,0x30,0x36,0x34,0x22,0x33,0x33,0x13,0x90,0xDB,0xCC,0xAB,0x99,0x89,0x08,0x08,0x99,0xBA,0x9A,
+0x90,0x11,0x41,0x21,0x77,0x34,0x15,0x90,0xAB,0xBC,0xCD,0xCC,0xBB,0xAB,0x0A,0x21,0x23,0x44,0x42,0x34,0x12,0x80,0xA8,0xAB,0x99,0x18,0x21,0x34,0x35,0x82,0xDB,0xBC,
+0xCC,0xCC,0xBC,0xBA,0xAB,0x89,0x11,0x64,0x53,0x34,0x33,0x33,0x12,0x81,0x88,0x99,0xA9,0x88,0x74,0x32,0x03,0x90,0x09,0x30,0x45,0x34,0x23,0x23,0x91,0xFC,0xBB,0x9A,
+0x00,0x80,0xA8,0xBB,0xDC,0x8A,0x18,0x34,0x45,0x23,0x01,0xDB,0xCB,0xBA,0xBB,0xCD,0xAC,0xAC,0xAA,0x88,0x42,0x35,0x32,0x80,0xA9,0x30,0x65,0x23,0x13,0x80,0xBA,0xCC,
+0xBD,0x89,0x20,0x22,0xC9,0xCC,0x9A,0x00,0x21,0x35,0x43,0x33,0x02,0x98,0x28,0x47,0x43,0x11,0xA8,0xBB,0xAD,0xA9,0xB9,0xDB,0xAA,0x99,0x88,0x10,0x31,0x33,0xA8,0xFF,
+0xAA,0x8A,0x31,0x45,0x43,0x23,0x13,0x81,0xEB,0xBC,0xBD,0xBA,0xCB,0xAA,0xBB,0x8A,0x31,0x55,0x23,0x24,0x12,0x12,0x88,0xA9,0xBA,0xBB,0xCD,0x8A,0x20,0x36,0x35,0x22,
+0x90,0xDB,0xAD,0x9A,0x30,0x64,0x33,0x32,0x22,0x43,0x31,0x12,0x11,0xC9,0xED,0xBC,0xCA,0x89,0x10,0x11,0x01,0x88,0x88,0x99,0xBB,0xCC,0xBB,0xCD,0xAC,0x89,0x73,0x35,
+0x22,0x81,0xBA,0x9B,0x9A,0xB9,0xEB,0x9A,0x89,0x88,0x41,0x74,0x43,0x12,0x90,0xCB,0xAC,0xCB,0xAA,0xAA,0x88,0x21,0x43,0x34,0x63,0x33,0x23,0x02,0x90,0xB9,0xCD,0xAA,
+0xBB,0x99,0x40,0x53,0x33,0x33,0x32,0x34,0x33,0x24,0x12,0xB8,0xDC,0xAC,0xA9,0x08,0x81,0xDB,0xDD,0xAB,0x8A,0x10,0x34,0x44,0x23,0x02,0xA9,0x9A,0x10,0x33,0xC8,0xCE,
+0xBB,0x8A,0x10,0x33,0x73,0x33,0x24,0x81,0xA9,0xB9,0xCC,0xCC,0xBD,0xAA,0x08,0x31,0x34,0x34,0x13,0x81,0x98,0xAA,0xCA,0xB9,0x9B,0xAA,0xA9,0x21,0x54,0x63,0x45,0x43,
+0x23,0x81,0xCA,0xBC,0x99,0x20,0x22,0x44,0x44,0x33,0x23,0x31,0x33,0x23,0xE8,0xCE,0xBC,0x9B,0x89,0x11,0x44,0x43,0x13,0x90,0x9A,0xBA,0x9A,0xDC,0xCC,0xCC,0xAB,0x9A,
+0x89,0x18,0x42,0x22,0x91,0xA9,0xBC,0xAB,0xAB,0xCB,0xCD,0xAA,0x19,0x43,0x25,0x32,0x11,0x11,0x10,0x21,0x34,0x36,0x23,0x82,0x00,0x42,0x35,0x23,0x32,0x32,0x13,0xD9,
+0xBD,0x18,0x11,0x01,0x48,0x74,0x25,0x13,0x81,0xA9,0x28,0x46,0x12,0x11,0x00,0x98,0xFC,0xAB,0xAC,0x99,0x98,0x00,0x00,0x30,0x26,0x23,0x80,0xD9,0xDC,0xCD,0xBB,0xAB,
+0x9A,0x99,0xB9,0xAB,0x19,0x47,0x45,0x21,0x80,0x98,0xBA,0xBA,0xAD,0x9A,0x20,0x12,0x12,0x22,0x63,0x35,0x34,0x32,0x90,0xBA,0xCB,0xBB,0xAA,0x10,0x44,0x22,0x44,0x34,
+0x36,0x33,0x03,0xA0,0xBC,0xCC,0xCB,0xCB,0x89,0x11,0x33,0x24,0x53,0x44,0x43,0x23,0x12,0x98,0xBA,0xCC,0xCC,0xAB,0x99,0x08,0x10,0x42,0x44,0x22,0x81,0xBA,0xBB,0xBA,
+0xFB,0xCD,0xBA,0x9B,0x88,0x88,0x08,0x42,0x44,0x12,0x01,0x08,0x98,0xDA,0xBD,0xAC,0x8A,0x31,0x43,0x43,0x32,0x33,0x03,0x22,0x33,0x23,0xE1,0xEB,0xCD,0xBB,0x09,0x32,
+0x35,0x42,0x33,0x32,0x22,0x11,0x81,0xC9,0xBD,0xCE,0xBB,0xCB,0x8A,0x21,0x65,0x23,0x33,0x23,0x23,0x00,0xB9,0xCD,0xAA,0x9A,0xBA,0xBA,0x28,0x45,0x14,0x22,0x00,0xEB,
+0xBD,0xBE,0xAB,0xAC,0xA9,0x89,0x09,0x20,0x44,0x33,0x33,0x12,0xC9,0xCD,0xBD,0xBC,0xAB,0x99,0x18,0x01,0x00,0x31,0x53,0x35,0x44,0x24,0x32,0x22,0x80,0x80,0x08,0x20,
+0x22,0x12,0x30,0x52,0x23,0x80,0x10,0x32,0x13,0xCA,0x48,0x57,0x12,0xB8,0xBB,0x8A,0x63,0x24,0x22,0x31,0x46,0x23,0xA8,0xCD,0x9A,0x10,0x11,0x11,0x32,0x33,0x91,0xEC,
+0xCB,0xBC,0xDC,0xCC,0xDB,0x9A,0x99,0x08,0x21,0x44,0x34,0x23,0x01,0x98,0x88,0xB9,0xEB,0xDB,0xBC,0xBB,0x9A,0x18,0x63,0x34,0x43,0x12,0x21,0x34,0x43,0x01,0xA0,0xBA,
+0xBC,0xCB,0xAA,0x28,0x35,0x34,0x13,0x31,0x42,0x33,0x12,0x90,0xFC,0xBC,0xBB,0x9A,0x09,0x18,0x42,0x23,0x13,0x31,0x34,0x34,0x92,0xFB,0xBE,0xBB,0xBB,0xBC,0xAB,0xAA,
+0x98,0xA9,0x9A,0x62,0x45,0x23,0x01,0x80,0xB9,0xDB,0xCB,0xAA,0x8A,0xBA,0xCA,0x8B,0x41,0x55,0x32,0x32,0x12,0x02,0xCB,0xCD,0xAA,0x19,0x62,0x13,0x32,0x45,0x34,0x12,
+0x01,0x81,0x98,0xBA,0xAB,0x40,0x67,0x43,0x23,0x23,0x22,0x12,0x99,0xCE,0xCA,0xAD,0xCB,0xAA,0x99,0x18,0x31,0x24,0x13,0x81,0x10,0x81,0xFC,0xCC,0xAB,0x9B,0x88,0x00,
+0x20,0x24,0x12,0xC9,0xCC,0xBA,0x9A,0xBA,0xED,0xAB,0xAB,0x10,0x63,0x33,0x25,0x12,0x91,0xB8,0xAA,0xAA,0x89,0xA9,0xDC,0xAC,0x89,0x20,0x41,0x22,0x43,0x01,0x08,0x28,
+0x45,0x43,0x13,0x90,0x38,0x56,0x24,0x23,0x22,0x22,0xA8,0xCE,0x9A,0x28,0x53,0x23,0x81,0xA8,0xDA,0xBC,0xBC,0x89,0x21,0x32,0x02,0x98,0x9A,0x62,0x25,0x33,0x22,0x91,
+0xDC,0xDE,0xBB,0xAC,0x88,0x88,0x98,0x99,0x10,0x44,0x34,0x33,0x32,0x12,0x08,0x18,0x54,0x34,0x14,0xB0,0xEB,0xDB,0xAA,0x89,0x10,0x22,0x12,0x11,0x42,0x46,0x35,0x24,
+0x23,0x12,0x80,0xB8,0xBC,0xAB,0x89,0xA9,0xBB,0xAC,0x63,0x47,0x22,0x12,0x11,0x00,0x08,0x99,0xEB,0xBA,0xCB,0xBB,0xAD,0x9A,0x31,0x37,0x25,0x12,0x01,0x99,0xAA,0xDB,
+0xCB,0xCB,0xCC,0xBD,0xAB,0x9B,0x08,0x02,0x11,0x12,0x43,0x82,0x90,0xCB,0xDB,0xAA,0xBA,0xB9,0x39,0x55,0x34,0x45,0x43,0x34,0x12,0x00,0x90,0xAA,0xDC,0xBA,0xBA,0x9A,
+0x20,0x33,0x45,0x54,0x34,0x33,0x11,0x88,0x09,0x99,0x89,0xAB,0xAC,0x18,0x12,0x08,0x49,0x57,0x53,0x01,0xA8,0xAB,0xA9,0x89,0x21,0x52,0x34,0x02,0xB8,0xDE,0xBC,0xBC,
+0xBC,0xCC,0xAB,0x9A,0x99,0x98,0x10,0x43,0x53,0x13,0x01,0x99,0x99,0x80,0xA8,0xCB,0x39,0x46,0x02,0x88,0x89,0x11,0x01,0xDD,0xCB,0x9B,0x40,0x36,0x34,0x24,0x43,0x22,
+0x01,0x89,0xAA,0xBC,0xBF,0xCB,0x9B,0x09,0x22,0x43,0x22,0x42,0x23,0x02,0xB9,0xCC,0xAA,0xA9,0xB9,0x9B,0x38,0x47,0x34,0x23,0xA0,0xCA,0xAD,0xCB,0xBC,0xDB,0xAB,0x9A,
+0xA9,0x99,0x18,0x34,0x63,0x23,0x22,0x13,0x10,0x88,0x61,0x53,0x34,0x22,0x98,0xAA,0xBB,0xCC,0xBB,0x89,0x81,0x90,0xBA,0x19,0x76,0x35,0x42,0x22,0x21,0x21,0x20,0x22,
+0x35,0x34,0x34,0x43,0x22,0x11,0x08,0x00,0xA9,0xEF,0xDB,0xCB,0x9A,0xAA,0x99,0x09,0x51,0x35,0x44,0x22,0x22,0x11,0x90,0xB9,0xBF,0xCC,0xBA,0xA9,0xBA,0xBA,0x89,0x30,
+0x43,0x43,0x11,0x21,0x22,0xA9,0xDD,0x8A,0x10,0x11,0x98,0x99,0xAA,0xEB,0xCE,0xBC,0x9D,0x89,0x21,0x33,0x22,0x22,0x33,0x25,0x02,0x11,0x31,0x57,0x22,0x91,0x99,0x30,
+0x56,0x11,0x80,0x08,0x01,0x80,0xDB,0xBA,0x8A,0x73,0x34,0x33,0x22,0x24,0x11,0xB9,0xCD,0xAB,0x99,0x0A,0xB9,0xCB,0xCC,0xAA,0x09,0x21,0x52,0x12,0x81,0x88,0x31,0x45,
+0x25,0x25,0x12,0xC9,0xCE,0xBD,0xBA,0xAA,0xA9,0x08,0x21,0x23,0x42,0x32,0x44,0x42,0x22,0x98,0xBD,0xBC,0xAC,0xCB,0xAB,0x8A,0x11,0x33,0x34,0x36,0x45,0x25,0x33,0x12,
+0x22,0x32,0x32,0x01,0xB9,0xDC,0xCC,0xCA,0xAA,0xA9,0x08,0x31,0x22,0x32,0x32,0x47,0x22,0x81,0xC9,0xBD,0xCC,0xBC,0xBB,0x9A,0x18,0x11,0x01,0x01,0x54,0x43,0x03,0xA8,
+0xCB,0xCC,0xDA,0xBC,0xBB,0x8A,0x18,0x12,0x21,0x53,0x46,0x23,0x22,0x81,0x98,0xA9,0xBB,0xBD,0x9B,0x30,0x36,0x33,0x22,0x44,0x53,0x33,0x11,0x80,0x98,0xAA,0xEC,0xBB,
+0xAC,0x08,0x10,0x23,0x52,0x42,0x25,0x21,0x12,0x21,0x33,0x34,0x24,0x82,0x88,0xCA,0xAA,0xAC,0x29,0x81,0xFA,0xBD,0xBC,0x99,0x00,0x31,0x13,0x12,0xCA,0xDB,0xAD,0xA9,
+0xBC,0xED,0xCB,0xAC,0xAB,0xAB,0x8A,0x18,0x21,0x20,0x20,0x53,0x45,0x33,0x34,0x11,0x80,0xBA,0xAC,0x8A,0x33,0x47,0x23,0x11,0x10,0x33,0x22,0x11,0x08,0xAB,0xFF,0xAE,
+0xBB,0x0A,0x21,0x23,0x32,0x41,0x53,0x22,0x80,0xAA,0xAA,0xCA,0xDB,0xAD,0x8A,0x51,0x34,0x34,0x22,0x22,0x21,0x98,0xEC,0xAC,0xAC,0x99,0x99,0x98,0x31,0x56,0x23,0x13,
+0x00,0x98,0xA9,0xB9,0xBB,0xCF,0xCA,0xBA,0xAA,0x88,0x21,0x34,0x25,0x12,0x01,0x88,0x30,0x46,0x25,0x12,0x90,0xBA,0xBB,0xBC,0x89,0x8A,0x90,0xDA,0xAA,0x9B,0x70,0x46,
+0x43,0x22,0x11,0x11,0x32,0x11,0x01,0x30,0x33,0xA0,0xEF,0xCC,0x9A,0x08,0x98,0xCB,0xBA,0x09,0x41,0x33,0x44,0x53,0x43,0x12,0xB8,0xCC,0xBC,0xCA,0xCB,0xBA,0x9C,0x89,
+0x10,0x31,0x53,0x43,0x02,0xA8,0xDB,0xAC,0xAA,0xAA,0xAB,0x9A,0x11,0x33,0x55,0x43,0x35,0x34,0x24,0x11,0x89,0x99,0x08,0x90,0x99,0x8A,0x28,0x36,0x73,0x53,0x43,0x24,
+0x01,0x80,0x99,0x99,0x89,0x99,0x99,0x09,0x98,0xB9,0x29,0x75,0x24,0x12,0xD9,0xCE,0xBB,0xAC,0x98,0x00,0x01,0x02,0x01,0x08,0x40,0x33,0x15,0x90,0xCA,0xCC,0xAE,0x9B,
+0x89,0x31,0x43,0x14,0xA8,0xBD,0xAA,0xAB,0xCB,0xAC,0xAA,0x89,0x48,0x63,0x35,0x43,0x14,0x11,0x98,0xAA,0xAB,0xBA,0xAD,0xBC,0xAB,0x8B,0x28,0x47,0x44,0x44,0x22,0x12,
+0x80,0x98,0xA9,0xAA,0xCE,0xBA,0xBB,0xAA,0x9A,0x08,0x41,0x44,0x14,0x91,0xBA,0xBC,0xBB,0xAE,0xBB,0x99,0x20,0x33,0x64,0x33,0x24,0x02,0xB8,0xEB,0xBC,0xCA,0x9B,0x99,
+0x18,0x32,0x34,0x44,0x42,0x33,0x22,0x81,0xD9,0xBC,0xDB,0xAA,0x89,0x10,0x42,0x22,0x12,0x21,0x43,0x45,0x24,0x33,0x01,0x88,0x80,0x30,0x12,0x01,0x91,0xBA,0xBF,0x9C,
+0x18,0x37,0x36,0x33,0x11,0x9A,0xBA,0xBA,0xBD,0xCA,0xBA,0xBA,0xBB,0x09,0x53,0x47,0x33,0x01,0xCA,0xBC,0xCA,0xBC,0xBD,0x9B,0x88,0x22,0x33,0x13,0x42,0x53,0x23,0xB0,
+0xBF,0xBD,0xAC,0xCB,0x9A,0x88,0x21,0x43,0x33,0x13,0x22,0x43,0x33,0xA1,0xDD,0xBB,0xBD,0x9B,0x9A,0x01,0x33,0x24,0x25,0x32,0x36,0x35,0x12,0x90,0x89,0x09,0x11,0x21,
+0x43,0x35,0x33,0x23,0x33,0x33,0x77,0x32,0x12,0x80,0xA9,0x00,0x13,0x25,0x23,0x24,0xA1,0xDC,0xBA,0xBC,0x99,0xAB,0xCD,0xCB,0xBC,0xAB,0xAB,0x89,0x10,0x11,0x9A,0xBB,
+0x20,0x01,0x20,0xB0,0xF8,0xCD,0xCD,0xAC,0x8A,0x89,0x02,0x82,0xB9,0xAE,0xAC,0x19,0x62,0x63,0x43,0x32,0x12,0x21,0x23,0x24,0x81,0xDA,0xCC,0x9A,0xAA,0x9A,0x18,0x45,
+0x43,0x13,0x43,0x44,0x35,0x12,0xB8,0xDB,0xAC,0xAA,0xAA,0xAB,0x9B,0x09,0x21,0x43,0x54,0x35,0x32,0x90,0xDC,0xAC,0xBA,0xAB,0xAA,0x9B,0x8A,0x00,0x10,0x20,0x54,0x23,
+0x92,0xFB,0xAD,0x9A,0x00,0x11,0x80,0x90,0x30,0x33,0x22,0xA1,0xA0,0xB0,0x80,0x8B,0x77,0x47,0x44,0x33,0x13,0x01,0x90,0x98,0x98,0x8A,0xA9,0x08,0x38,0x47,0x33,0x24,
+0x21,0x02,0x90,0xCB,0xBD,0xBA,0x9A,0x9B,0x00,0x48,0x56,0x35,0x34,0x22,0x00,0xB8,0xBD,0xBE,0xBA,0x89,0xA9,0x9A,0xBA,0x9B,0x9A,0x19,0x03,0x28,0xA8,0xFB,0xBC,0x9B,
+0x28,0x51,0xC8,0xCC,0xAB,0xAD,0xBB,0xBA,0xDA,0xBE,0xCC,0xAC,0x9A,0x18,0x53,0x33,0x23,0x22,0x24,0x34,0x25,0x21,0x01,0x99,0xCB,0xCC,0x99,0x31,0x43,0x33,0x80,0x10,
+0x31,0x12,0x80,0xA0,0xA8,0x08,0x8F,0x52,0x67,0x42,0x32,0x80,0xB9,0xAC,0x88,0x08,0x88,0x0A,0x08,0x81,0x01,0x12,0x57,0x22,0x01,0xEA,0xCD,0xBB,0x8B,0x10,0x24,0x34,
+0x21,0xB0,0xCC,0xCB,0xAA,0xAA,0x99,0xCB,0xDC,0xBC,0x99,0x11,0x34,0x24,0x22,0x81,0xA0,0x88,0x11,0x11,0x43,0x32,0xC2,0xDB,0x8A,0x33,0x25,0xB0,0xDB,0x8A,0x71,0x34,
+0x53,0x21,0x22,0x23,0xA0,0xDB,0x9B,0xA9,0xCA,0xDB,0xBC,0x9A,0x19,0x32,0x26,0x23,0x21,0x01,0x90,0x0A,0x72,0x82,0xCA,0xBD,0x9C,0x8A,0xAB,0xCA,0xBD,0xBB,0xAC,0x9A,
+0x8A,0x31,0x27,0x13,0x12,0x28,0x30,0x32,0x15,0x98,0xCA,0xCB,0xFB,0xDA,0xAA,0x8A,0x80,0x99,0x9A,0x71,0x44,0x34,0x33,0x32,0x23,0x24,0x12,0x90,0x90,0x18,0xA0,0xAE,
+0x89,0x35,0x36,0x24,0x22,0x22,0x32,0x22,0xB0,0xEC,0x9C,0xAA,0xB9,0xAC,0x9B,0x11,0x13,0x01,0xC8,0x08,0x58,0x32,0x83,0xDD,0xBA,0x0B,0xA0,0x08,0x72,0x53,0x11,0x90,
+0xB9,0xCC,0xBB,0xB9,0xAB,0xDA,0x9B,0x88,0x55,0x44,0x53,0x22,0x98,0xBA,0xCC,0xBA,0xCD,0xBA,0xBC,0xA9,0x28,0x53,0x44,0x53,0x12,0x12,0x98,0x9A,0x9B,0x89,0x00,0x90,
+0xCC,0xAC,0x18,0x63,0x35,0x34,0x22,0x80,0xCB,0xCB,0xBB,0xA9,0xAA,0xB8,0xBA,0xBB,0x20,0x71,0x32,0x23,0x23,0x01,0xBA,0x3A,0x56,0x12,0xF9,0xDC,0xAC,0x9A,0x08,0x20,
+0x32,0x42,0x32,0x11,0x98,0x90,0x28,0x21,0xB3,0xFF,0xAD,0x9C,0x89,0x10,0x43,0x34,0x42,0x22,0x10,0x8A,0x80,0x81,0x02,0xCB,0xCC,0xAB,0x9C,0x28,0x42,0x44,0x21,0x02,
+0x02,0x00,0x01,0x82,0x20,0x0B,0xFC,0xCB,0xBD,0xAB,0x8A,0x90,0xAB,0xFB,0xAD,0x99,0x80,0x21,0x31,0x44,0x22,0x01,0x88,0x89,0x02,0x0B,0x0C,0xCF,0xDD,0xBB,0xAC,0x88,
+0x30,0x32,0x83,0x01,0x89,0x26,0x12,0x13,0x41,0x45,0x12,0xA0,0x99,0x0A,0x08,0x04,0x22,0x08,0xBF,0xB9,0xCF,0x99,0x38,0x62,0x34,0x44,0x13,0x22,0x10,0x11,0x18,0x99,
+0xCA,0xEB,0xCB,0xBB,0xAA,0x89,0x09,0x11,0x55,0x53,0x24,0x31,0x11,0x01,0xA0,0xEA,0x99,0x18,0x22,0x81,0xD9,0xBD,0xDB,0xAB,0xBB,0x99,0x9A,0xBB,0xBF,0x9B,0x89,0x43,
+0x45,0x43,0x34,0x33,0x12,0x98,0xBC,0xAE,0xAA,0xBB,0xBA,0x9A,0x20,0x16,0x34,0x44,0x54,0x23,0x33,0x12,0x00,0x88,0xA9,0xEA,0xAA,0xB9,0xA9,0x9B,0x89,0x09,0x01,0x38,
+0x80,0x03,0x04,0x08,0x80,0xBE,0xC0,0x8B,0x84,0x37,0x14,0x0A,0xBC,0xDD,0xAB,0xBC,0x9A,0x08,0x18,0x12,0x82,0x0A,0x8B,0x8B,0xFC,0xCB,0xAC,0xB9,0xB9,0xBC,0xAD,0x89,
+0x10,0x42,0x45,0x32,0x35,0x24,0x23,0x90,0xB9,0xDA,0xCB,0xBD,0xDB,0xAB,0xAB,0x99,0x21,0x51,0x45,0x53,0x33,0x33,0x22,0x21,0x90,0xDB,0xAC,0xAB,0xAA,0x8A,0x48,0x63,
+0x43,0x23,0x12,0x01,0x80,0x99,0xAD,0xFB,0xAB,0xAB,0xA9,0x09,0x18,0x10,0x80,0xDA,0xCF,0xBC,0xBB,0xBB,0xB9,0x99,0x30,0x38,0x14,0x37,0x35,0x14,0x00,0x98,0xA9,0x9C,
+0x09,0x18,0x13,0x22,0x08,0xB8,0x9F,0xBB,0xCA,0xBA,0xFA,0x99,0x80,0x21,0x21,0x17,0x34,0x43,0x33,0x22,0x53,0x11,0x90,0xFB,0xAC,0xAA,0x0A,0x28,0x43,0x27,0x33,0x32,
+0x32,0x23,0x24,0x12,0xA0,0xCB,0xDE,0xBA,0xAC,0xBB,0xAB,0x8B,0x18,0x21,0x23,0x54,0x33,0x83,0xA0,0xAC,0xA0,0x0D,0xAC,0xBA,0xD0,0xAA,0xA9,0x80,0x53,0x34,0x25,0x24,
+0x11,0x98,0xC9,0xAD,0xBB,0x09,0x21,0x34,0x16,0x12,0x13,0x23,0x02,0xEB,0xDB,0xBA,0xDA,0xAA,0x0B,0x21,0x57,0x32,0x35,0x52,0x22,0x23,0x12,0x81,0xA8,0xDB,0xBB,0xAC,
+0x8A,0x89,0x13,0x21,0x51,0x31,0x63,0x02,0x82,0x00,0x88,0xCC,0xCD,0xCB,0xBC,0xB9,0xBA,0xBD,0x9B,0x09,0x10,0x12,0x43,0x27,0x23,0x82,0xB0,0xB9,0xFB,0xBA,0xBB,0xBC,
+0xAC,0x9A,0xBB,0x99,0x9C,0x08,0x22,0x68,0x41,0x52,0x31,0x34,0x14,0x05,0x00,0x81,0xBA,0xB9,0xA9,0xCA,0xCA,0x0A,0x72,0x44,0x24,0x63,0x31,0x02,0x91,0x98,0x89,0x18,
+0x80,0x01,0x08,0x8A,0x30,0x08,0x04,0x78,0x11,0xD0,0xDF,0xAA,0x8A,0x08,0x81,0x10,0x11,0x25,0x01,0xB8,0xC8,0xA9,0xDA,0xCD,0xDC,0xAB,0xAA,0x09,0x18,0x00,0x12,0x12,
+0x22,0xA8,0xB8,0x30,0x40,0x84,0x80,0x00,0x35,0x70,0x20,0x23,0xB0,0x88,0x0C,0x48,0x24,0x17,0x03,0x01,0x9D,0x10,0x64,0x34,0x13,0x00,0x9C,0xCB,0x9B,0x99,0x80,0x0A,
+0x08,0x33,0x30,0x44,0x67,0x24,0x13,0x00,0xA9,0x9A,0x99,0x80,0xDA,0xDB,0x9D,0x9A,0x99,0x80,0x23,0x33,0x22,0xBE,0xC9,0x8B,0x20,0x08,0xE8,0xDA,0xCC,0xAC,0xDB,0x89,
+0x10,0x32,0x24,0x21,0x33,0x44,0x21,0x31,0x02,0x01,0x0A,0xCF,0xBA,0x9B,0x2A,0x21,0x22,0x33,0x33,0x80,0x85,0x80,0x37,0x22,0x02,0xC0,0x0B,0x73,0x36,0x24,0x12,0x82,
+0xA0,0xC9,0xDB,0x9A,0x9A,0x80,0xAA,0x8A,0x30,0x70,0x04,0x21,0x20,0xB8,0x00,0xCF,0x99,0x98,0x88,0xB0,0xAE,0xDB,0xA0,0x09,0x08,0x8B,0x43,0x08,0xB8,0x0D,0xB8,0xC8,
+0x80,0x04,0x03,0x80,0xBE,0x8B,0x80,0x50,0x84,0x80,0xBC,0xC8,0xAC,0xBF,0xBE,0x9A,0x9A,0x28,0x48,0x33,0x37,0x32,0x22,0x00,0x08,0x28,0x33,0x16,0x89,0xDA,0xAC,0xAB,
+0x60,0x73,0x22,0x82,0x81,0x89,0x99,0x8B,0x9C,0x80,0x38,0x88,0xC0,0x00,0x78,0x45,0x22,0x83,0xA0,0xAD,0xAB,0xBD,0x9D,0x9B,0x99,0x80,0x10,0x22,0x37,0x63,0x23,0x31,
+0x18,0x80,0xA0,0xF9,0x9B,0xAB,0x9C,0xCB,0x9A,0x0B,0x10,0x45,0x21,0x21,0x21,0x22,0x32,0x80,0x80,0x0D,0xAC,0x08,0xAF,0xCA,0x10,0x52,0x41,0x81,0x14,0x31,0x24,0x01,
+0xDA,0xC9,0x99,0x98,0xD8,0xA0,0x89,0x02,0x33,0x48,0x03,0x43,0x27,0xC8,0xCD,0xDB,0xAB,0x9A,0x09,0x80,0x13,0x37,0x22,0x33,0x38,0x33,0x42,0x01,0xFA,0xBA,0xBC,0xBB,
+0x9B,0x0A,0x28,0x33,0x08,0x08,0x80,0x60,0x17,0x24,0x03,0x14,0x84,0x01,0xCA,0xEB,0x99,0x80,0x00,0x88,0x20,0x03,0x37,0x63,0x33,0x53,0x31,0x01,0xB0,0xBC,0xBB,0xCA,
+0xA9,0x08,0x08,0x33,0x34,0x37,0x32,0x83,0xB3,0xFB,0xBD,0x9C,0xCB,0xBA,0xAA,0x9B,0xAC,0xB8,0x08,0x58,0x16,0x33,0x12,0x80,0xA0,0x0A,0x9E,0x9E,0xC9,0xA8,0x98,0xA0,
+0x80,0x22,0x36,0x34,0x14,0x81,0x80,0x20,0x08,0x8B,0xC0,0x30,0x70,0x15,0x22,0x03,0x82,0xAD,0xDB,0xBB,0xAD,0x99,0x80,0x42,0x03,0x08,0x0B,0x73,0x43,0x24,0x11,0xA0,
+0xCA,0xEB,0xA9,0x9A,0x08,0x21,0x15,0x14,0x28,0x88,0x80,0xBB,0xFB,0xBA,0xAF,0xAA,0xAB,0x0B,0x08,0x22,0x03,0x43,0x73,0x53,0x31,0x81,0xA9,0xAC,0xA9,0x9D,0x08,0x28,
+0x37,0x32,0x23,0x28,0x38,0x33,0x03,0x08,0x08,0xF8,0x80,0xBC,0x30,0x70,0x73,0x31,0x31,0x12,0x84,0x82,0xAA,0xAD,0x8B,0xBA,0xEB,0xB8,0xBA,0x8A,0x0B,0x0C,0x48,0x36,
+0x26,0x33,0x11,0x34,0x38,0x80,0xD0,0xBA,0x9D,0xBB,0xFC,0xAA,0xAA,0x08,0x08,0x98,0xCA,0xA9,0x28,0x30,0x08,0x0C,0x08,0x37,0x51,0x01,0x10,0x53,0x21,0xA2,0xDB,0x9E,
+0xAA,0x9B,0xCC,0xBA,0xAA,0x20,0x34,0x54,0x23,0x44,0x24,0x23,0x33,0x22,0x21,0x01,0xB2,0xEA,0xDB,0xBA,0xD9,0xBA,0xBC,0xAB,0x09,0x10,0x24,0x73,0x33,0x63,0x11,0x11,
+0x10,0x11,0x01,0xBC,0xCD,0x9D,0xBA,0xA9,0xA0,0x89,0x32,0x34,0x43,0x21,0x28,0x20,0x33,0xC0,0xFB,0xBA,0xBC,0xC9,0xC9,0xAA,0x89,0x20,0x32,0x17,0x33,0x22,0x32,0xBB,
+0xDF,0xBA,0x9C,0x99,0x09,0x0A,0xAA,0x30,0x56,0x24,0x15,0x13,0x21,0x81,0x99,0x9C,0x9C,0x0A,0x80,0x82,0xEA,0x80,0x40,0x41,0x41,0x08,0x9A,0xBA,0x0A,0x08,0x43,0x24,
+0x30,0x00,0xBD,0xF8,0x08,0x80,0x80,0xC0,0x0B,0x8F,0xA9,0x80,0x63,0x48,0x08,0xA8,0x9E,0xAC,0xAA,0xA9,0x0B,0x08,0x38,0x48,0x78,0x38,0x42,0x28,0x01,0x08,0xBB,0x9F,
+0x9C,0xA9,0x00,0xB8,0xB0,0x48,0x33,0x47,0x13,0x23,0x38,0x38,0x33,0x80,0xD0,0xB8,0xD8,0xBB,0xFC,0x0C,0x18,0x33,0x26,0x32,0x52,0x21,0x11,0x01,0x0A,0xBA,0x80,0x9F,
+0xBC,0x9B,0x0C,0x28,0x40,0x40,0x61,0x31,0x24,0x12,0x01,0x98,0xBA,0x9D,0xDC,0xC9,0xBB,0xAC,0xA9,0x99,0x98,0x88,0x20,0x33,0x27,0x23,0x22,0x08,0xB8,0x08,0xBD,0xAC,
+0x8B,0x0C,0x08,0x08,0x8D,0xDB,0x0B,0x03,0x40,0x40,0x30,0x44,0x32,0x34,0x48,0x02,0xC0,0xC0,0xB0,0x08,0x88,0x50,0x34,0x03,0x44,0x38,0x84,0x43,0x02,0x80,0xD0,0xCB,
+0x8A,0x8B,0x40,0x34,0x43,0x43,0x08,0xC8,0xBB,0xEC,0xBA,0xBA,0xBA,0xC0,0xBA,0x0C,0x3B,0x03,0x37,0x32,0x83,0x24,0x30,0x00,0xD8,0x9F,0xAA,0x89,0xAB,0x08,0x48,0x54,
+0x26,0x33,0x33,0x21,0x82,0x80,0xBE,0xDC,0xAC,0xAA,0xBA,0xB9,0x98,0x58,0x48,0x14,0x12,0x12,0x84,0x82,0xB0,0xEA,0xC9,0x09,0x21,0x52,0x11,0x22,0x15,0x82,0x80,0xB0,
+0x8B,0x0C,0x80,0x04,0x08,0x80,0x80,0x80,0xF0,0xC9,0x8B,0xCC,0xCD,0xA9,0xA9,0x0B,0x80,0x3B,0x04,0x37,0x04,0x01,0xA8,0x80,0x0B,0x08,0x0D,0x0C,0x08,0x58,0x16,0x12,
+0x80,0x03,0x33,0x34,0xCB,0xF0,0x9A,0xA8,0xAA,0x08,0x43,0x36,0x24,0x25,0x28,0x88,0x00,0x38,0x08,0xF8,0xAC,0xCB,0xBB,0x0B,0x8A,0x33,0x73,0x41,0x28,0x08,0x82,0x05,
+0x03,0x23,0x0B,0xAF,0xAB,0x9E,0xB9,0x90,0x08,0x08,0x38,0x84,0x37,0x13,0x14,0x82,0xAA,0xEB,0xD9,0xAC,0xBB,0xCA,0x99,0x89,0x10,0x52,0x53,0x24,0x43,0x03,0x00,0xBA,
+0xCB,0x8D,0xAB,0x9B,0xA9,0x82,0x23,0x30,0x74,0x51,0x22,0x24,0x12,0x81,0x80,0xA8,0x83,0x03,0x80,0x0D,0xC8,0xBB,0xEC,0xAB,0xA8,0x0B,0x8B,0x8B,0x0D,0x78,0x40,0x31,
+0x22,0x80,0x0B,0x8F,0xA0,0x0A,0xBB,0x8B,0x8B,0x80,0xBE,0xC0,0x80,0xD0,0xB0,0xBC,0xBB,0x0C,0x0C,0x48,0x32,0x34,0x33,0x40,0x80,0x85,0xC0,0xB0,0x0C,0x0F,0xCB,0x09,
+0x9C,0x19,0x40,0x63,0x42,0x11,0x23,0x11,0x23,0x22,0x80,0x80,0x80,0xBD,0xF8,0x9A,0x08,0x0B,0x08,0x0C,0x08,0xD8,0xC0,0x80,0xCB,0xC0,0xB0,0xB8,0x58,0x48,0x02,0x43,
+0x03,0x53,0x38,0xC0,0xF0,0x98,0x08,0x08,0x80,0x8B,0x8C,0x80,0x50,0x08,0x04,0x03,0x58,0x8B,0xCC,0xAD,0x8C,0x89,0x80,0x0B,0x0C,0x33,0x70,0x11,0x83,0x83,0x80,0x00,
+0x8D,0xDB,0xBB,0xCB,0x80,0x80,0x80,0x36,0x73,0x44,0x13,0x23,0x83,0x24,0x01,0xB0,0xEB,0xBA,0xBA,0x0A,0x08,0x08,0x0D,0x08,0x84,0x34,0x73,0x42,0x31,0x22,0x02,0x83,
+0x80,0x8C,0xD0,0x80,0x8B,0xBC,0xFC,0x99,0x08,0x08,0x08,0xB8,0xBC,0x8B,0xD0,0x80,0xD0,0x80,0xC0,0x80,0x40,0x08,0x0D,0x08,0x08,0xBD,0xFB,0x9C,0x0B,0x88,0x20,0x33,
+0x40,0x08,0x43,0x30,0x85,0x30,0x80,0xD0,0x08,0xBF,0xAA,0x80,0x03,0x80,0x08,0x08,0x87,0x24,0x00,0x03,0x44,0x73,0x41,0x11,0x10,0x02,0x80,0x80,0x80,0x08,0x68,0x80,
+0x80,0xE0,0xCB,0xBA,0x38,0x85,0x03,0xBC,0xCB,0xBE,0xCA,0x08,0x08,0x02,0x33,0xC0,0xB8,0xBD,0x0E,0x8A,0x80,0xB0,0x88,0x0C,0x0C,0x0C,0x08,0x08,0x35,0x43,0x43,0x02,
+0x03,0xCC,0xB0,0x0C,0xC0,0x80,0x80,0x50,0x08,0x08,0x50,0x03,0x37,0x51,0x41,0x28,0x08,0xAA,0xBB,0xBB,0xBC,0x0C,0x8B,0xD0,0x80,0x80,0x50,0x33,0x34,0x30,0x85,0x03,
+0x0C,0xCB,0xC0,0xBE,0xC0,0xC9,0xB0,0x08,0x08,0x85,0x04,0x03,0x84,0x22,0x38,0x30,0x08,0x08,0xE8,0xBB,0xBC,0x0C,0x8B,0x80,0x50,0x48,0x08,0x08,0x80,0x80,0x70,0x07,
+0x23,0x28,0x8A,0x0B,0x08,0x08,0x68,0x80,0x80,0xE0,0xCB,0x8A,0xCB,0x80,0x27,0x53,0x11,0x80,0x0A,0x08,0x48,0x08,0x08,0x0D,0xB8,0xC8,0x08,0x0D,0x8B,0x34,0x78,0x20,
+0x01,0x83,0x03,0x08,0xD0,0xAC,0xCB,0xBB,0x80,0x80,0x35,0x04,0x78,0x30,0x23,0x32,0x30,0x80,0x0D,0xEC,0xBB,0xAE,0xBA,0x09,0x80,0x22,0x32,0x03,0x34,0x03,0x08,0x08,
+0x08,0x08,0x00,0xF0,0xC9,0x80,0x80,0x50,0x34,0x80,0x04,0xC8,0xC0,0x8B,0xF0,0xA9,0x0A,0x80,0x03,0x04,0x58,0x33,0x73,0x20,0x31,0x38,0x08,0x08,0x0D,0xAF,0xAD,0x99,
+0x80,0x80,0x20,0x80,0x43,0x73,0x03,0x14,0x21,0x22,0x30,0x08,0xBC,0xFB,0xCA,0x09,0xA8,0xB0,0xBB,0x0C,0x8B,0x8B,0xBD,0x8B,0x8C,0x80,0x50,0x43,0x03,0x03,0x04,0x58,
+0x08,0xC8,0x80,0x80,0x80,0xF0,0xB8,0x0C,0x0C,0x80,0x34,0x03,0x04,0x08,0x08,0x08,0x08,0x79,0x81,0x85,0x24,0x00,0x0C,0xBC,0xBB,0xC8,0xC0,0xC0,0x80,0x80,0x00,0x85,
+0x84,0x24,0x43,0x16,0x12,0x00,0xB8,0xC0,0xBB,0xC0,0xBB,0xBC,0xB8,0xD8,0x80,0x80,0x80,0x80,0x80,0x70,0x81,0x80,0xF0,0x0B,0x80,0x80,0x05,0x48,0x80,0x00,0x68,0x08,
+0x08,0x85,0x84,0x80,0x0C,0xC0,0x80,0x80,0x58,0x30,0x40,0x34,0x80,0x80,0x50,0x40,0x43,0x30,0x80,0xD8,0x80,0xD0,0xC0,0xB0,0x08,0x0D,0x08,0xBC,0xAC,0x08,0x08,0x08,
+0x08,0x78,0x80,0x00,0x08,0x08,0x08,0x00,0x9F,0x0C,0xBC,0xB8,0x08,0x3D,0x80,0x85,0x30,0x50,0x48,0x38,0x30,0x00,0xC5,0xB0,0xAC,0xCB,0x0B,0x8F,0xA9,0x82,0x33,0x73,
+0x30,0x10,0x30,0x02,0x30,0x80,0x80,0xBE,0x08,0x0D,0xC8,0x00,0x08,0x44,0x48,0x02,0x80,0x04,0xC8,0x80,0x8C,0x80,0xD0,0x48,0x48,0x38,0x30,0x00,0x85,0x80,0xD0,0xB8,
+0xBD,0xFB,0xA9,0xA9,0x08,0x08,0x48,0x38,0x04,0x43,0x83,0x34,0x43,0x80,0xD0,0xB0,0xF8,0xA8,0x89,0x0B,0x8B,0x80,0x0D,0x03,0x58,0x08,0x53,0x38,0x40,0x38,0x00,0x08,
+0x05,0x58,0x08,0xC3,0xC0,0xC0,0xB0,0x08,0x0D,0x08,0x08,0x08,0x08,0x87,0x30,0x50,0x48,0x08,0x08,0x0D,0x8B,0x0C,0xB8,0x08,0xE8,0x0B,0xC8,0x48,0x08,0x58,0x08,0x48,
+0x08,0x08,0x80,0x0E,0x0C,0x80,0x0C,0x80,0x80,0x0D,0x48,0x80,0x50,0x08,0x08,0x50,0x08,0xD8,0x80,0x80,0xD0,0x48,0x08,0x08,0xD0,0x0C,0xC0,0x80,0x80,0x85,0x30,0x84,
+0x24,0x30,0x04,0x43,0x33,0x84,0x80,0xBC,0xBC,0x08,0xD8,0x80,0x80,0x80,0x86,0x30,0x50,0x48,0x08,0xC3,0x00,0x08,0x08,0x08,0x08,0x17,0xD8,0x80,0xBC,0xC0,0x80,0x80,
+0x80,0x80,0xF0,0x0C,0x8B,0xD0,0x80,0x80,0x80,0xE0,0x80,0x0C,0x80,0x40,0x34,0x30,0x80,0x80,0x0E,0x8F,0xBC,0xA0,0x0A,0x8B,0x03,0x80,0x58,0x80,0x80,0x05,0x03,0x04,
+0x58,0x08,0x08,0x80,0x80,0x70,0x03,0x44,0x02,0x80,0xD0,0xC0,0xBB,0xC0,0x0B,0x08,0x08,0x08,0x08,0x79,0x81,0x85,0x24,0x30,0x40,0x80,0x00,0x8D,0xD0,0x80,0x80,0x00,
+0x8D,0x80,0xD0,0xB8,0xD8,0x80,0x80,0x50,0x08,0x08,0x08,0x78,0x30,0x80,0x04,0x04,0x08,0xD8,0xC0,0xC0,0x80,0x8B,0x0C,0x08,0x0D,0x08,0x88,0x80,0x80,0x07,0x08,0x85,
+0x84,0x43,0x38,0x80,0x00,0xE8,0x80,0xD0,0xB0,0xC8,0x00,0x0C,0x08,0x88,0x80,0x36,0x74,0x38,0x20,0x08,0xB8,0xC0,0xB0,0xB8,0x0D,0x8B,0x0C,0x80,0x80,0x80,0x80,0x70,
+0x41,0x48,0x08,0x03,0x80,0x0E,0xB8,0xD8,0x80,0xD0,0x30,0x80,0x40,0x80,0x0D,0x08,0x08,0x85,0x80,0xD0,0xB8,0xD8,0xBB,0xC8,0xB8,0x08,0x85,0x84,0x30,0x00,0x08,0x08,
+0x08,0x70,0x81,0x50,0x48,0x48,0x08,0x48,0x08,0x03,0x04,0x04,0x03,0xD8,0xC0,0x80,0xD0,0x30,0x08,0x34,0x00,0x04,0xD8,0xC0,0x00,0x08,0x88,0x80,0xF0,0x8B,0xBC,0x8B,
+0x00,0x08,0x36,0x40,0x03,0x04,0x08,0x85,0x80,0x85,0x80,0x8B,0xBD,0xFB,0xAA,0x0C,0xA8,0x80,0x80,0x84,0x43,0x38,0x80,0x85,0x80,0x80,0xD0,0xB8,0xD8,0x0B,0x0C,0xBC,
+0x00,0x08,0x04,0x04,0x43,0x80,0x85,0x03,0x40,0x08,0x08,0x85,0x40,0x80,0x80,0x0D,0x08,0x58,0x80,0x04,0xC8,0x80,0x04,0x08,0x0D,0x08,0x08,0x08,0x08,0x08,0xDF,0x8A,
+0x8B,0x80,0x50,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0xF0,0xC9,0xC0,0xC0,0x0B,0xC0,0x03,0x58,0x38,0x00,0x48,0x80,0x80,0x80,0x80,0x00,0x17,0x08,0x08,0x08,0xF8,
+0x09,0x80,0x86,0x30,0x00,0x85,0x80,0xD0,0xB8,0x08,0x68,0x08,0x08,0x80,0x80,0x80,0x00,0x70,0x41,0x43,0x30,0x80,0x08,0x08,0x8F,0xCB,0x0B,0xBC,0xB8,0x08,0x08,0x08,
+0x08,0x17,0x04,0x03,0x44,0x08,0x03,0x80,0xF0,0xB0,0xBC,0x00,0x0C,0x08,0xD8,0x80,0x0C,0x80,0x40,0x80,0x80,0x60,0x48,0x48,0x08,0x08,0x0D,0x38,0x00,0x08,0xE8,0xC0,
+0x80,0xD0,0x80,0x80,0x8C,0x80,0x80,0x86,0x80,0x00,0x68,0x48,0x38,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x70,0x81,0x50,0x08,0x08,0x08,0x86,0x80,0x0D,0x08,
+0x08,0x8D,0x80,0xD0,0x08,0x08,0x08,0x0F,0x08,0x0C,0x03,0x08,0x85,0x40,0x30,0x80,0x80,0x80,0xF0,0x09,0xD8,0x80,0x8C,0xD0,0x80,0x30,0x50,0x08,0x08,0x85,0x80,0x00,
+0x8D,0x80,0x0D,0x08,0x0D,0xB8,0x08,0xD0,0x48,0x08,0x58,0xB8,0x80,0x04,0x58,0x38,0x00,0x84,0x80,0x80,0x80,0xF0,0x08,0x0D,0x08,0x0C,0x08,0x88,0x80,0x80,0x70,0x81,
+0x04,0x04,0x03,0x04,0x04,0x08,0x08,0xE8,0xC0,0x8B,0xD0,0x80,0x8B,0x00,0x8D,0x40,0x30,0x40,0x40,0x80,0x04,0x08,0x80,0x0E,0x0C,0x8B,0xDB,0xB0,0xC8,0x00,0x08,0x0D,
+0x48,0x08,0x48,0x80,0x85,0x03,0x34,0x48,0x48,0x08,0x08,0x48,0x80,0x0D,0x0C,0xCB,0xBA,0x88,0x0C,0x08,0x08,0x08,0x78,0x30,0x50,0x03,0x43,0x80,0x00,0x08,0xBF,0xBB,
+0xC8,0xC0,0x8B,0x80,0x85,0x80,0x85,0x43,0x38,0x40,0x08,0x08,0x08,0x08,0xF8,0x08,0x0D,0x8B,0xD0,0x80,0x03,0x80,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x17,0x08,0x08,
+0x08,0x08,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x9F,0x00,0x08,0x78,0x80,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x9F,0x0C,0x0C,0x08,0x88,0x80,0x80,
+0x90,0x17,0x08,0xE8,0x80,0x40,0x80,0x80,0x05,0x0C,0xC8,0xB0,0x08,0xD8,0x80,0x80,0x80,0x70,0x08,0x03,0x50,0x08,0x04,0x03,0x08,0x08,0xF8,0x08,0x0D,0x08,0x0C,0x08,
+0x04,0x48,0x80,0x85,0x03,0x40,0xB8,0x08,0x08,0x08,0x8F,0x80,0xD8,0x80,0x8C,0x80,0x80,0x80,0x07,0x48,0x08,0x08,0x0D,0x08,0x88,0x80,0x0E,0xC8,0xB8,0x08,0x08,0x0F,
+0x08,0x08,0x85,0x80,0x85,0x30,0x80,0x85,0x80,0x00,0x08,0x08,0x8F,0x0C,0xC0,0xC0,0x80,0x80,0x00,0x68,0x48,0x38,0x24,0x30,0x04,0x03,0x88,0x0D,0x0C,0x0C,0x8B,0x0C,
+0x8B,0xD0,0x80,0x84,0x30,0x40,0x80,0x85,0x30,0x00,0x08,0xF8,0x80,0x80,0x08,0x08,0x08,0x17,0x88,0x50,0x80,0x80,0x80,0xF0,0x08,0xD8,0x80,0x80,0x58,0x80,0x04,0x08,
+0x80,0x80,0x80,0x00,0xF0,0x09,0xBD,0x8B,0x8C,0x80,0x80,0x60,0x08,0x34,0x40,0x80,0x00,0x08,0x08,0x08,0x00,0x9F,0x00,0x08,0x0F,0x08,0x08,0x80,0x80,0x07,0x08,0xD8,
+0x80,0x80,0x08,0x08,0x08,0xF9,0x09,0x80,0x80,0x07,0x08,0x48,0x40,0x30,0x40,0x80,0x80,0x80,0x80,0x9F,0x00,0x8D,0x80,0x80,0x80,0x80,0x00,0x70,0x81,0x80,0x80,0x0F,
+0x0C,0x8B,0xD0,0x80,0x80,0x80,0x50,0x80,0x85,0x80,0x00,0x08,0x08,0x08,0xF0,0x09,0x0D,0xB8,0x08,0x8D,0x80,0x80,0x86,0x80,0x85,0x03,0x40,0x08,0x04,0x08,0x08,0x0E,
+0xC8,0x0B,0x0C,0xB8,0x08,0x85,0x40,0x30,0x40,0x40,0x03,0x80,0x05,0x08,0x08,0x0E,0xC8,0xB0,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x0E,
+0x08,0x08,0x08,0x86,0x80,0x80,0x80,0x80,0x00,0xF0,0x09,0xD0,0xB8,0x08,0x8D,0x80,0x80,0x80,0x70,0x80,0x04,0x58,0x08,0x08,0x04,0x08,0x08,0x08,0x8F,0x8B,0x0C,0xC8,
+0x08,0x08,0x08,0x86,0x40,0x30,0x80,0x05,0x43,0x30,0x00,0x08,0x0F,0x08,0x0C,0xB8,0x08,0xE8,0x80,0x80,0x80,0x60,0x08,0x58,0x08,0x03,0x80,0x80,0x80,0x00,0x00,0xF0,
+0x09,0xD0,0x08,0xD8,0x80,0x80,0x85,0x30,0x00,0x08,0x08,0x8F,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0xF0,0x80,0x80,0x0C,0x08,0x08,0x08,0x87,
+0x80,0x50,0x08,0x03,0x80,0x86,0x80,0x00,0x08,0x08,0xF8,0x09,0x80,0x0E,0x08,0x08,0x68,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,
+0x17,0x08,0x08,0x08,0x08,0x9F,0xD0,0xC0,0x00,0xC8,0x00,0x08,0x08,0x08,0x08,0x17,0x88,0x05,0x08,0x58,0x80,0x8C,0x80,0x80,0xF0,0x80,0x80,0xD0,0x80,0x80,0x50,0x08,
+0x58,0x08,0x08,0x85,0x80,0x50,0x08,0x08,0x0D,0x08,0x08,0x8D,0x80,0x80,0x80,0x80,0x70,0x81,0x80,0x60,0x08,0x08,0x08,0x08,0x08,0x9F,0x00,0x8D,0x80,0x80,0x80,0x80,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x9F,0x00,
+0x08,0xF8,0x80,0x0C,0x80,0x04,0x08,0x50,0x08,0x08,0x85,0x80,0x80,0x80,0x80,0x17,0x08,0xE8,0x80,0xD0,0x80,0x80,0x00,0x8D,0x80,0x50,0x08,0x08,0x08,0x08,0x08,0x17,
+0x04,0x08,0xD8,0x80,0xD0,0x80,0x80,0x08,0x08,0x87,0x80,0x00,0x08,0x08,0x78,0x81,0x80,0x80,0xF0,0x08,0xD8,0x80,0x80,0x04,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0xF0,0x09,0x85,0x80,0x00,0x85,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x50,0x08,0x08,0x8D,0x80,0x0D,0x08,0x0D,
+0xB8,0x08,0x80,0x80,0x80,0x00,0x17,0x58,0x08,0x08,0x80,0x80,0x0F,0x08,0x0D,0x08,0x0C,0x08,0x88,0x0D,0x08,0x04,0x58,0x08,0x03,0x85,0x30,0xD0,0x80,0x80,0x80,0x0E,
+0x08,0x08,0x8D,0x80,0x0D,0x08,0x08,0x85,0x80,0x50,0x08,0x58,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x02,0x80,0x80,0x80,0xF0,0x09,0x80,
+0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x17,0x08,0x08,0x86,0x80,
+0x80,0x80,0x80,0x00,0xF0,0x09,0x80,0x0E,0x08,0x58,0x08,0x03,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x9F,0x00,0x08,
+0x08,0x08,0x00,0x70,0x81,0x80,0x80,0xF0,0x08,0x88,0x80,0x80,0x8F,0xD0,0x80,0x80,0x50,0x08,0x58,0x08,0x03,0x08,0x08,0x08,0x08,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,
+0x00,0x00,0x17,0x08,0x68,0x08,0x08,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0xF0,0x09,0x50,0x08,0x08,0x08,0x08,0x08,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x9F,0x00,0xE8,0x80,0x80,0x80,0x60,0x08,0x58,0x08,0x08,0x80,0x80,0x0F,0x08,0xD8,0x80,0x80,0x08,0x08,0x08,0x09,0x00,0x17,0x08,0x85,0x80,0x80,
+0x80,0xF0,0x08,0x88,0x80,0x80,0x07,0x08,0x80,0x80,0x70,0x80,0x80,0x80,0x0E,0x08,0x08,0xE8,0x80,0x80,0x80,0x80,0x90,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,
+0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x70,0x81,0x80,0x80,0x80,
+0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0xF0,0x09,0x50,0x08,0x08,0x68,0x08,0x08,0x80,0x80,0x80,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,
+0x2F,0x0C,0x08,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x70,0x81,0x80,0x60,0x08,0x08,0x08,0x08,0x08,0xF0,
+0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x86,0x80,0x00,0x08,0xF8,0x80,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0xF0,0x09,0xD0,0x08,0x08,0x08,0x86,0x80,0xD0,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,
+0x81,0x80,0x80,0x80,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x9F,0x00,0xE8,0x80,
+0x80,0x80,0x80,0x80,0x00,0x00,0x17,0x08,0x08,0xF8,0x80,0x80,0x08,0x08,0x08,0x09,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x17,0x08,
+0x85,0x80,0x80,0x80,0x80,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x68,0x08,0xC8,0x80,0x80,0x80,0x80,0x8F,0x80,0x80,0xF0,0x80,0x80,0x00,
+0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x50,0x08,0x08,0x08,
+0x08,0x08,0x00,0xF0,0x09,0x80,0xF0,0x80,0x80,0x85,0x80,0x80,0x85,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0xF0,0x09,0x80,0x80,0x0F,0x08,0x84,0x80,0x80,0x86,0x80,0x00,
+0x08,0x08,0x08,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x59,0x08,0x08,0x08,0x08,0x08,0x08,
+0xF0,0x09,0x80,0x60,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x9F,0x00,0x08,0x08,0x08,0x17,0x08,0xE8,0x80,0x80,0x50,0x08,0x08,0x08,0xF8,0x80,0x80,0x08,0x08,0x08,0x09,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0xA7,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x70,0x81,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,
+0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x86,0x80,0x00,0x8D,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,
+0x70,0x80,0x80,0x80,0x80,0x8F,0x80,0x80,0x80,0x80,0xF0,0x09,0x80,0x60,0x08,0x08,0x08,0x86,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x0E,0x08,0x08,0x08,0x86,
+0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0x80,0xF0,0x08,0x88,0x80,0x80,0x90,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x59,0x08,0x08,0x08,0x08,0x08,0x08,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x78,0x80,0x80,0x08,
+0x08,0x08,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x17,0x08,0x08,
+0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x78,0x80,0x80,0x08,0x08,0x08,0x09,0x17,0x08,0x08,0x08,0x08,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x70,0x81,0x0D,0x08,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xD1,0x80,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x08,0x08,0x08,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x09,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x17,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x81,0x80,0xF0,0x80,0x80,0x00,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xD8,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+const ADPCM_Sound_t spaceship_thruster = {spaceship_thruster_data,61989,{0,0},4000};
@@ -0,0 +1,106 @@
+/**
+*@file synth.h
+*@brief provide functions for synthesizing notes with wavetable oscillator and ADSR envelope
+*
+*This header file provide functions for synthesizing notes.
+*Each voice has a phase accumulator oscillator: 32 bits phase move forward by frequency/sampleRate of a turn every sample,
+*so pitch error is below 1/2^32 of sample rate whatever the note. Sine is read from a 256 entries table (linear interpolation
+*between entries), square, triangle and noise (new random value every period) are computed from phase.
+*Oscillator output is scaled by ADSR envelope of instrument: level rise to full in attack time, fall to sustain level in decay time,
+*is held until note is released (end of note duration or synth_note_off) and fall to silence in release time.
+*Notes are rendered block by block into 16 bits samples, nothing block the caller (speaker_play_note mix them with sound effects).
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#ifndef SYNTH_H
+#define SYNTH_H
+
+#include <stdint.h>
+
+/*
+*@SYNTH_WAVEFORM
+*/
+#define SYNTH_WAVE_SINE			0
+#define SYNTH_WAVE_SQUARE		1
+#define SYNTH_WAVE_TRIANGLE		2
+#define SYNTH_WAVE_NOISE		3
+
+/*
+*@SYNTH_STAGE
+*Stage of envelope
+*/
+#define SYNTH_STAGE_ATTACK		0
+#define SYNTH_STAGE_DECAY		1
+#define SYNTH_STAGE_SUSTAIN		2
+#define SYNTH_STAGE_RELEASE		3
+#define SYNTH_STAGE_OFF			4
+
+#define SYNTH_SUSTAIN_FULL		255			/*sustain level of instrument*/
+#define SYNTH_ENVELOPE_FULL		(1UL << 24)	/*envelope level of voice*/
+#define SYNTH_AMPLITUDE_MAX		32767		/*peak of oscillator output*/
+#define SYNTH_GATE_HOLD			UINT32_MAX	/*note is held until synth_note_off*/
+
+/***********************************************************************
+Synthesizer structure definition
+***********************************************************************/
+
+typedef struct{
+	uint8_t waveform;	/*refer to @SYNTH_WAVEFORM*/
+	uint16_t attack;	/*milliseconds from silence to full level*/
+	uint16_t decay;		/*milliseconds from full level to sustain level*/
+	uint8_t sustain;	/*level held until note is released, 0 to SYNTH_SUSTAIN_FULL (note end after decay when 0)*/
+	uint16_t release;	/*milliseconds from level at release to silence*/
+}Synth_Instrument_t;
+
+typedef struct{
+	uint32_t phase;			/*fraction of oscillator period, a turn is 2^32*/
+	uint32_t phaseStep;		/*phase added every sample*/
+	uint32_t envelope;		/*0 to SYNTH_ENVELOPE_FULL*/
+	uint32_t attackStep;
+	uint32_t decayStep;
+	uint32_t sustainLevel;
+	uint32_t releaseStep;	/*computed from envelope level when note is released*/
+	uint32_t releaseSamples;
+	uint32_t gate;			/*samples left before release, 0 release note at next sample, SYNTH_GATE_HOLD when held*/
+	uint32_t noise;			/*state of noise generator*/
+	uint8_t waveform;
+	uint8_t stage;			/*refer to @SYNTH_STAGE*/
+}Synth_Voice_t;
+
+/***********************************************************************
+Synthesizer APIs prototype
+***********************************************************************/
+
+/**
+*@brief 	Start note on voice
+*
+*Oscillator restart from phase 0 and envelope from silence. Frequencies from half of sample rate alias to lower pitches.
+*
+*@param 	Pointer to voice
+*@param 	Instrument (waveform and envelope)
+*@param 	Frequency in Hz (refer to notes.h)
+*@param 	Duration in milliseconds before release, 0 to hold note until synth_note_off
+*@param 	Sample rate in Hz
+*@return 	None
+*/
+void synth_note_on (Synth_Voice_t *VoicePtr, const Synth_Instrument_t *InstrumentPtr, uint32_t frequency, uint32_t duration, uint32_t sampleRate);
+
+/**
+*@brief 	Release note, envelope fall from its current level to silence in release time of instrument
+*@param 	Pointer to voice
+*@return 	None
+*/
+void synth_note_off (Synth_Voice_t *VoicePtr);
+
+/**
+*@brief 	Render next samples of note
+*@param 	Pointer to voice
+*@param 	Buffer receiving 16 bits samples
+*@param 	Number of samples
+*@return 	Number of samples rendered, less than requested when note end in buffer (0 when note has ended)
+*/
+uint16_t synth_render (Synth_Voice_t *VoicePtr, int16_t *bufferPtr, uint16_t numOfSamples);
+
+#endif
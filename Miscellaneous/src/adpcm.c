@@ -0,0 +1,124 @@
+/**
+*@file adpcm.c
+*@brief provide functions for encoding and decoding IMA ADPCM sound
+*
+*This implementation file provide functions for encoding and decoding IMA ADPCM sound.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*
+*@reference	IMA Digital Audio Focus and Technical Working Groups, Recommended practices for enhancing digital audio compatibility
+*in multimedia systems, revision 3.00, 1992
+*/
+
+#include "../inc/adpcm.h"
+
+static const int16_t ADPCMStepTable[ADPCM_STEP_INDEX_MAX + 1] = {
+	7,8,9,10,11,12,13,14,16,17,19,21,23,25,28,31,34,37,41,45,50,55,60,66,73,80,88,97,107,118,130,143,157,173,190,209,230,253,279,307,
+	337,371,408,449,494,544,598,658,724,796,876,963,1060,1166,1282,1411,1552,1707,1878,2066,2272,2499,2749,3024,3327,3660,4026,4428,
+	4871,5358,5894,6484,7132,7845,8630,9493,10442,11487,12635,13899,15289,16818,18500,20350,22385,24623,27086,29794,32767
+};
+
+static const int8_t ADPCMIndexTable[16] = {-1,-1,-1,-1,2,4,6,8,-1,-1,-1,-1,2,4,6,8};
+
+/***********************************************************************
+Encode one sample
+***********************************************************************/
+uint8_t adpcm_encode_sample (ADPCM_State_t *StatePtr, int16_t sample)
+{
+	int32_t step = ADPCMStepTable[StatePtr->stepIndex];
+	int32_t difference = (int32_t)sample - StatePtr->predictor;
+	uint8_t code = 0;
+
+	if(difference < 0){
+		code = 8;
+		difference = -difference;
+	}
+
+	/*quantize difference in steps, same approximation as decoder*/
+	if(difference >= step){
+		code |= 4;
+		difference -= step;
+	}
+
+	if(difference >= step/2){
+		code |= 2;
+		difference -= step/2;
+	}
+
+	if(difference >= step/4){
+		code |= 1;
+	}
+
+	/*predictor follow decoded sample, not input sample*/
+	adpcm_decode_sample(StatePtr,code);
+
+	return code;
+}
+
+/***********************************************************************
+Decode one sample
+***********************************************************************/
+int16_t adpcm_decode_sample (ADPCM_State_t *StatePtr, uint8_t code)
+{
+	int32_t step = ADPCMStepTable[StatePtr->stepIndex];
+	int32_t difference = step >> 3;
+	int32_t predictor = StatePtr->predictor;
+	int32_t stepIndex = StatePtr->stepIndex + ADPCMIndexTable[code & 0x0F];
+
+	if(code & 4){
+		difference += step;
+	}
+
+	if(code & 2){
+		difference += step >> 1;
+	}
+
+	if(code & 1){
+		difference += step >> 2;
+	}
+
+	if(code & 8){
+		predictor -= difference;
+	}else{
+		predictor += difference;
+	}
+
+	if(predictor > INT16_MAX){
+		predictor = INT16_MAX;
+	}else if(predictor < INT16_MIN){
+		predictor = INT16_MIN;
+	}
+
+	if(stepIndex < 0){
+		stepIndex = 0;
+	}else if(stepIndex > ADPCM_STEP_INDEX_MAX){
+		stepIndex = ADPCM_STEP_INDEX_MAX;
+	}
+
+	StatePtr->predictor = (int16_t)predictor;
+	StatePtr->stepIndex = (uint8_t)stepIndex;
+
+	return (int16_t)predictor;
+}
+
+/***********************************************************************
+Decode consecutive samples of sound
+***********************************************************************/
+void adpcm_decode_block (ADPCM_State_t *StatePtr, const uint8_t *dataPtr, uint32_t position, int16_t *bufferPtr, uint16_t numOfSamples)
+{
+	const uint8_t *bytePtr = &dataPtr[position >> 1];
+
+	for(uint16_t i = 0; i < numOfSamples; i++){
+		uint8_t code;
+
+		if(position & 0x01){
+			code = *bytePtr++ >> 4;
+		}else{
+			code = *bytePtr & 0x0F;
+		}
+		position++;
+
+		bufferPtr[i] = adpcm_decode_sample(StatePtr,code);
+	}
+}
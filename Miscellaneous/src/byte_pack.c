@@ -0,0 +1,55 @@
+/**
+*@file byte_pack.c
+*@brief provide CRC-16 and little endian packing of values into byte arrays
+*
+*This implementation file provide CRC-16/CCITT-FALSE and little endian write and read of values.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../inc/byte_pack.h"
+
+/***********************************************************************
+CRC-16/CCITT-FALSE, bitwise so that no table is kept in flash
+***********************************************************************/
+uint16_t byte_pack_crc16 (const uint8_t *dataPtr, uint16_t length)
+{
+	uint16_t crc = BYTE_PACK_CRC_INITIAL_VALUE;
+
+	for(uint16_t i = 0; i < length; i++){
+		crc ^= (uint16_t)dataPtr[i] << 8;
+
+		for(uint8_t bit = 0; bit < 8; bit++){
+			crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ BYTE_PACK_CRC_POLYNOMIAL) : (uint16_t)(crc << 1);
+		}
+	}
+
+	return crc;
+}
+
+/***********************************************************************
+Write value in little endian, return pointer to byte after it
+***********************************************************************/
+uint8_t* byte_pack_put_value (uint8_t *bytePtr, uint32_t value, uint8_t numOfBytes)
+{
+	for(uint8_t i = 0; i < numOfBytes; i++){
+		*bytePtr++ = (uint8_t)(value >> (8*i));
+	}
+
+	return bytePtr;
+}
+
+/***********************************************************************
+Read value in little endian
+***********************************************************************/
+uint32_t byte_pack_get_value (const uint8_t *bytePtr, uint8_t numOfBytes)
+{
+	uint32_t value = 0;
+
+	for(uint8_t i = 0; i < numOfBytes; i++){
+		value |= (uint32_t)bytePtr[i] << (8*i);
+	}
+
+	return value;
+}
@@ -0,0 +1,101 @@
+/**
+*@file fast_math.c
+*@brief provide integer arctangent and square root without math library
+*
+*This implementation file provide integer arctangent and square root.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../inc/fast_math.h"
+
+#define FAST_MATH_SEGMENT_BITS		6
+#define FAST_MATH_ATAN_SEGMENTS		(1 << FAST_MATH_SEGMENT_BITS)	/*table entries - 1*/
+#define FAST_MATH_RATIO_BITS		16								/*y/x of first octant in Q16*/
+#define FAST_MATH_FRACTION_BITS		(FAST_MATH_RATIO_BITS - FAST_MATH_SEGMENT_BITS)
+
+/*arctangent of i/FAST_MATH_ATAN_SEGMENTS in binary angle, 0 to 45 degree*/
+static const uint16_t fastMathAtanTable[FAST_MATH_ATAN_SEGMENTS + 1] = {
+	0,163,326,489,651,813,975,1136,1297,1457,1617,1775,1933,
+	2090,2246,2401,2555,2708,2860,3010,3159,3307,3453,3599,3742,3884,
+	4025,4164,4302,4438,4572,4705,4836,4966,5094,5220,5344,5467,5589,
+	5708,5826,5943,6058,6171,6282,6392,6500,6607,6712,6815,6917,7018,
+	7117,7214,7310,7405,7498,7589,7679,7768,7856,7942,8026,8110,8192
+};
+
+/***********************************************************************
+Angle of vector
+***********************************************************************/
+uint16_t fast_atan2 (int32_t y, int32_t x)
+{
+	uint32_t absX = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+	uint32_t absY = (y < 0) ? -(uint32_t)y : (uint32_t)y;
+	uint32_t ratio, index, fraction;
+	uint16_t angle;
+
+	if(!absX && !absY){
+		return 0;
+	}
+
+	/*smaller over larger coordinate (0 to 1 in Q16), larger coordinate is scaled down first so that numerator fit in 32 bits*/
+	while(absX >= (1UL << (32 - FAST_MATH_RATIO_BITS)) || absY >= (1UL << (32 - FAST_MATH_RATIO_BITS))){
+		absX >>= 1;
+		absY >>= 1;
+	}
+
+	if(absY <= absX){
+		ratio = (absY << FAST_MATH_RATIO_BITS)/absX;
+	}else{
+		ratio = (absX << FAST_MATH_RATIO_BITS)/absY;
+	}
+
+	index = ratio >> FAST_MATH_FRACTION_BITS;
+	fraction = ratio & ((1UL << FAST_MATH_FRACTION_BITS) - 1);
+
+	angle = fastMathAtanTable[index];
+	if(index < FAST_MATH_ATAN_SEGMENTS){
+		angle += ((fastMathAtanTable[index + 1] - fastMathAtanTable[index])*fraction + (1UL << (FAST_MATH_FRACTION_BITS - 1))) >> FAST_MATH_FRACTION_BITS;
+	}
+
+	/*unfold octant, quadrant then half turn*/
+	if(absY > absX){
+		angle = FAST_MATH_ANGLE_QUARTER - angle;
+	}
+
+	if(x < 0){
+		angle = FAST_MATH_ANGLE_HALF - angle;
+	}
+
+	if(y < 0){
+		angle = -angle;
+	}
+
+	return angle;
+}
+
+/***********************************************************************
+Integer square root
+***********************************************************************/
+uint16_t fast_sqrt (uint32_t value)
+{
+	uint32_t root = 0;
+	uint32_t bit = 1UL << 30;
+
+	/*one result bit per iteration, from highest*/
+	while(bit > value){
+		bit >>= 2;
+	}
+
+	while(bit){
+		if(value >= root + bit){
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		}else{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return (uint16_t)root;
+}
@@ -0,0 +1,193 @@
+/**
+*@file synth.c
+*@brief provide functions for synthesizing notes with wavetable oscillator and ADSR envelope
+*
+*This implementation file provide functions for synthesizing notes.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../inc/synth.h"
+
+#define SYNTH_TABLE_SIZE	256
+
+/*one period of sine, SYNTH_AMPLITUDE_MAX peak*/
+static const int16_t synthSineTable[SYNTH_TABLE_SIZE] = {
+	0,804,1608,2410,3212,4011,4808,5602,6393,7179,7962,8739,9512,10278,11039,11793,
+	12539,13279,14010,14732,15446,16151,16846,17530,18204,18868,19519,20159,20787,21403,22005,22594,
+	23170,23731,24279,24811,25329,25832,26319,26790,27245,27683,28105,28510,28898,29268,29621,29956,
+	30273,30571,30852,31113,31356,31580,31785,31971,32137,32285,32412,32521,32609,32678,32728,32757,
+	32767,32757,32728,32678,32609,32521,32412,32285,32137,31971,31785,31580,31356,31113,30852,30571,
+	30273,29956,29621,29268,28898,28510,28105,27683,27245,26790,26319,25832,25329,24811,24279,23731,
+	23170,22594,22005,21403,20787,20159,19519,18868,18204,17530,16846,16151,15446,14732,14010,13279,
+	12539,11793,11039,10278,9512,8739,7962,7179,6393,5602,4808,4011,3212,2410,1608,804,
+	0,-804,-1608,-2410,-3212,-4011,-4808,-5602,-6393,-7179,-7962,-8739,-9512,-10278,-11039,-11793,
+	-12539,-13279,-14010,-14732,-15446,-16151,-16846,-17530,-18204,-18868,-19519,-20159,-20787,-21403,-22005,-22594,
+	-23170,-23731,-24279,-24811,-25329,-25832,-26319,-26790,-27245,-27683,-28105,-28510,-28898,-29268,-29621,-29956,
+	-30273,-30571,-30852,-31113,-31356,-31580,-31785,-31971,-32137,-32285,-32412,-32521,-32609,-32678,-32728,-32757,
+	-32767,-32757,-32728,-32678,-32609,-32521,-32412,-32285,-32137,-31971,-31785,-31580,-31356,-31113,-30852,-30571,
+	-30273,-29956,-29621,-29268,-28898,-28510,-28105,-27683,-27245,-26790,-26319,-25832,-25329,-24811,-24279,-23731,
+	-23170,-22594,-22005,-21403,-20787,-20159,-19519,-18868,-18204,-17530,-16846,-16151,-15446,-14732,-14010,-13279,
+	-12539,-11793,-11039,-10278,-9512,-8739,-7962,-7179,-6393,-5602,-4808,-4011,-3212,-2410,-1608,-804
+};
+
+static uint32_t synth_ms_to_samples (uint32_t ms, uint32_t sampleRate);
+static int32_t synth_oscillator (Synth_Voice_t *VoicePtr);
+static void synth_envelope (Synth_Voice_t *VoicePtr);
+
+/***********************************************************************
+Start note on voice
+***********************************************************************/
+void synth_note_on (Synth_Voice_t *VoicePtr, const Synth_Instrument_t *InstrumentPtr, uint32_t frequency, uint32_t duration, uint32_t sampleRate)
+{
+	VoicePtr->phase = 0;
+	VoicePtr->phaseStep = (uint32_t)(((uint64_t)frequency << 32) / sampleRate);
+	VoicePtr->waveform = InstrumentPtr->waveform;
+
+	/*steps of envelope are computed once, so that rendering only add and subtract*/
+	VoicePtr->envelope = 0;
+	VoicePtr->attackStep = SYNTH_ENVELOPE_FULL / synth_ms_to_samples(InstrumentPtr->attack,sampleRate);
+	VoicePtr->sustainLevel = (uint32_t)(((uint64_t)InstrumentPtr->sustain * SYNTH_ENVELOPE_FULL) / SYNTH_SUSTAIN_FULL);
+	VoicePtr->decayStep = (SYNTH_ENVELOPE_FULL - VoicePtr->sustainLevel) / synth_ms_to_samples(InstrumentPtr->decay,sampleRate);
+	VoicePtr->releaseSamples = synth_ms_to_samples(InstrumentPtr->release,sampleRate);
+	VoicePtr->releaseStep = 0;
+	VoicePtr->gate = duration ? synth_ms_to_samples(duration,sampleRate) : SYNTH_GATE_HOLD;
+	VoicePtr->stage = SYNTH_STAGE_ATTACK;
+
+	/*noise generator keep running from note to note, it must not be 0*/
+	if(VoicePtr->noise == 0){
+		VoicePtr->noise = 0x12345678;
+	}
+}
+
+/***********************************************************************
+Release note
+***********************************************************************/
+void synth_note_off (Synth_Voice_t *VoicePtr)
+{
+	VoicePtr->gate = 0;
+}
+
+/***********************************************************************
+Render next samples of note
+***********************************************************************/
+uint16_t synth_render (Synth_Voice_t *VoicePtr, int16_t *bufferPtr, uint16_t numOfSamples)
+{
+	for(uint16_t i = 0; i < numOfSamples; i++){
+		synth_envelope(VoicePtr);
+
+		if(VoicePtr->stage == SYNTH_STAGE_OFF){
+			return i;
+		}
+
+		/*envelope is reduced to 15 bits so that product fit in 32 bits*/
+		bufferPtr[i] = (int16_t)((synth_oscillator(VoicePtr) * (int32_t)(VoicePtr->envelope >> 9)) >> 15);
+	}
+
+	return numOfSamples;
+}
+
+/***********************************************************************
+Private function: Convert milliseconds to samples (at least 1 sample)
+***********************************************************************/
+uint32_t synth_ms_to_samples (uint32_t ms, uint32_t sampleRate)
+{
+	uint32_t samples = (uint32_t)(((uint64_t)ms * sampleRate + 500) / 1000);
+
+	return samples ? samples : 1;
+}
+
+/***********************************************************************
+Private function: Compute next oscillator sample and move phase forward
+***********************************************************************/
+int32_t synth_oscillator (Synth_Voice_t *VoicePtr)
+{
+	uint32_t phase = VoicePtr->phase;
+
+	VoicePtr->phase = phase + VoicePtr->phaseStep;
+
+	switch(VoicePtr->waveform){
+		case SYNTH_WAVE_SQUARE:
+			return (phase < 0x80000000UL) ? SYNTH_AMPLITUDE_MAX : -SYNTH_AMPLITUDE_MAX;
+
+		case SYNTH_WAVE_TRIANGLE:
+		{
+			/*rise from negative peak to positive peak in first half of period, then fall*/
+			int32_t position = phase >> 16;
+
+			if(position >= 0x8000){
+				position = 0xFFFF - position;
+			}
+
+			return 2*position - SYNTH_AMPLITUDE_MAX;
+		}
+
+		case SYNTH_WAVE_NOISE:
+			/*new random value (xorshift32) when phase wrap around, noise is pitched by note frequency*/
+			if(VoicePtr->phase < phase){
+				VoicePtr->noise ^= VoicePtr->noise << 13;
+				VoicePtr->noise ^= VoicePtr->noise >> 17;
+				VoicePtr->noise ^= VoicePtr->noise << 5;
+			}
+
+			return (int16_t)VoicePtr->noise;
+
+		default:
+		{
+			/*top 8 bits of phase select table entry, next 8 bits interpolate toward following entry*/
+			uint8_t index = (uint8_t)(phase >> 24);
+			int32_t fraction = (phase >> 16) & 0xFF;
+			int32_t sample = synthSineTable[index];
+
+			return sample + (((synthSineTable[(uint8_t)(index + 1)] - sample) * fraction) >> 8);
+		}
+	}
+}
+
+/***********************************************************************
+Private function: Move envelope forward by one sample
+***********************************************************************/
+void synth_envelope (Synth_Voice_t *VoicePtr)
+{
+	/*note is released at end of its duration or by synth_note_off, from any stage*/
+	if(VoicePtr->gate == 0){
+		if(VoicePtr->stage < SYNTH_STAGE_RELEASE){
+			VoicePtr->releaseStep = VoicePtr->envelope / VoicePtr->releaseSamples + 1;
+			VoicePtr->stage = SYNTH_STAGE_RELEASE;
+		}
+	}else if(VoicePtr->gate != SYNTH_GATE_HOLD){
+		VoicePtr->gate--;
+	}
+
+	switch(VoicePtr->stage){
+		case SYNTH_STAGE_ATTACK:
+			VoicePtr->envelope += VoicePtr->attackStep;
+			if(VoicePtr->envelope >= SYNTH_ENVELOPE_FULL){
+				VoicePtr->envelope = SYNTH_ENVELOPE_FULL;
+				VoicePtr->stage = SYNTH_STAGE_DECAY;
+			}
+			break;
+
+		case SYNTH_STAGE_DECAY:
+			if(VoicePtr->envelope <= VoicePtr->sustainLevel + VoicePtr->decayStep){
+				VoicePtr->envelope = VoicePtr->sustainLevel;
+				VoicePtr->stage = VoicePtr->sustainLevel ? SYNTH_STAGE_SUSTAIN : SYNTH_STAGE_OFF;
+			}else{
+				VoicePtr->envelope -= VoicePtr->decayStep;
+			}
+			break;
+
+		case SYNTH_STAGE_RELEASE:
+			if(VoicePtr->envelope <= VoicePtr->releaseStep){
+				VoicePtr->envelope = 0;
+				VoicePtr->stage = SYNTH_STAGE_OFF;
+			}else{
+				VoicePtr->envelope -= VoicePtr->releaseStep;
+			}
+			break;
+
+		default:
+			break;
+	}
+}
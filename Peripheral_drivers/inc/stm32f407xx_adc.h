@@ -5,21 +5,35 @@
 *This header file provide APIs for interfacing with ADCs on stm32f407xx MCUs.
 *
 *@note This library only support the following configurations and features:
-*	number of conversion: 1
+*	number of conversion: 1 (read value in busy-wait method) or regular sequence of up to 16 channels in scan mode (read by DMA)
 *	resolution: 12 bits
-*	conversion mode: single
-*	read value in busy-wait method
+*	conversion mode: single or continuous
 *
 *@author Tran Thanh Nhan
 *@date 26/08/2019
 */
 
+/*
+ *@Version 1.1
+ *Date 17/10/2026
+ *Add scan mode over regular sequence, sampling time selection and DMA transfer of conversions into circular buffer
+ *(ADC_DMA_init, ADC_start_DMA, ADC_stop_DMA)
+ */
+
+/*
+ *@Version 1.2
+ *Date 17/10/2026
+ *ADC_init set common ADC prescaler from APB2 clock so that ADC clock stay within its limit with every clock profile
+ */
+
 #ifndef STM32F407XX_ADC_H
 #define STM32F407XX_ADC_H
 
 #include "stm32f407xx.h"                  // Device header
 #include "stm32f407xx_common_macro.h"
 #include "stm32f407xx_gpio.h"
+#include "stm32f407xx_dma.h"
+#include "stm32f407xx_rcc.h"
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -64,19 +78,52 @@ Macro definition
 #define ADC_CVSMODE_SINGLE 0
 #define ADC_CVSMODE_CONT 1
 
+/*
+*@ADC_SAMPLE_TIME
+*Sampling time selection (in ADC clock cycles, conversion take 12 more cycles at 12 bits resolution)
+*Longer sampling time let sampling capacitor settle with high impedance source (e.g. potentiometer), so conversion is less noisy
+*/
+#define ADC_SAMPLE_TIME_3_CYCLES	0
+#define ADC_SAMPLE_TIME_15_CYCLES	1
+#define ADC_SAMPLE_TIME_28_CYCLES	2
+#define ADC_SAMPLE_TIME_56_CYCLES	3
+#define ADC_SAMPLE_TIME_84_CYCLES	4
+#define ADC_SAMPLE_TIME_112_CYCLES	5
+#define ADC_SAMPLE_TIME_144_CYCLES	6
+#define ADC_SAMPLE_TIME_480_CYCLES	7
+
+#define ADC_MAX_CONVERSIONS	16	/*length of regular sequence*/
+
+/*
+*@ADC_DMA_STREAM
+*DMA stream & channel used by each ADC (RM0090 table 43)
+*/
+#define ADC1_DMA_CONTROLLER	DMA2
+#define ADC1_DMA_STREAM	0
+#define ADC1_DMA_CHANNEL	DMA_CHANNEL_0
+#define ADC2_DMA_CONTROLLER	DMA2
+#define ADC2_DMA_STREAM	2
+#define ADC2_DMA_CHANNEL	DMA_CHANNEL_1
+#define ADC3_DMA_CONTROLLER	DMA2
+#define ADC3_DMA_STREAM	1
+#define ADC3_DMA_CHANNEL	DMA_CHANNEL_2
+
 /***********************************************************************
 ADC structure definition
 ***********************************************************************/
 
 typedef struct{
-	uint8_t numOfConversion;
+	uint8_t numOfConversion;	/*1 to ADC_MAX_CONVERSIONS, scan mode is used above 1*/
 	uint8_t resolution;	/*refer to @ADC_RESOLUTION for possible value*/
 	uint8_t conversionMode;	/*refer to @ADC_CVSMODE for possible value*/
+	uint8_t sampleTime;	/*refer to @ADC_SAMPLE_TIME for possible value, used for every channel of sequence*/
+	const uint8_t *sequencePtr;	/*channels of regular sequence in conversion order (numOfConversion channels), NULL when channel is selected by ADC_read*/
 }ADC_Config_t;
 
 typedef struct{
 	ADC_TypeDef *ADCxPtr;
 	ADC_Config_t *ADCxConfigPtr;
+	DMA_Handle_t *DMAxHandlePtr;	/*DMA stream receiving conversions, set by ADC_DMA_init*/
 }ADC_Handle_t;
 
 /***********************************************************************
@@ -111,6 +158,7 @@ void ADC_ctr(ADC_TypeDef *ADCxPtr, uint8_t onOrOff);
 *	set ADCx resolution to 12 bits
 *	set conversion mode to single
 *	select EOC as indicating end of each regular conversion
+*	program regular sequence and sampling time of its channels, enable scan mode when sequence has more than 1 channel
 *	
 *@param Pointer to ADC handle struct
 *@return none
@@ -136,9 +184,41 @@ void ADC_deinit(void);
 
 /**
 *@brief Read value from ADC channel
+*@note Regular sequence is replaced by given channel, do not use while ADC is converting into DMA buffer
 *@param Pointer to ADCx 's base address
 *@param ADC channel
 *@return Value from ADC
 */
 uint16_t ADC_read(ADC_TypeDef *ADCxPtr, uint8_t channel);
+
+/**
+*@brief Initialize DMA stream receiving conversions of ADC
+*
+*Refer to @ADC_DMA_STREAM for stream & channel used by each ADC. Stream is configured in circular mode without interrupt:
+*buffer always hold latest conversions and is read with plain memory loads.
+*
+*@param Pointer to ADC handle struct (ADC_init is called before)
+*@return none
+*/
+void ADC_DMA_init(ADC_Handle_t *ADCxHandlePtr);
+
+/**
+*@brief Start conversions of regular sequence into circular buffer through DMA
+*
+*Conversions are started by software. In continuous mode, sequence is converted again and again and buffer is filled again
+*from its start after its last element until ADC_stop_DMA is called.
+*
+*@param Pointer to ADC handle struct
+*@param Buffer receiving 16 bits conversions in sequence order
+*@param Number of conversions in buffer (multiple of numOfConversion, 1 to 65535)
+*@return none
+*/
+void ADC_start_DMA(ADC_Handle_t *ADCxHandlePtr, volatile uint16_t *bufferPtr, uint16_t count);
+
+/**
+*@brief Stop conversions into buffer through DMA
+*@param Pointer to ADC handle struct
+*@return none
+*/
+void ADC_stop_DMA(ADC_Handle_t *ADCxHandlePtr);
 #endif
\ No newline at end of file
@@ -14,12 +14,19 @@
  *Add DAC_init_channel function
  */
 
+/*
+ *@Version 1.2
+ *Date 17/10/2026
+ *Add DMA transfer of samples on trigger event (DAC_DMA_init, DAC_start_DMA, DAC_stop_DMA, DAC_DMA_intrpt_handler)
+ */
+
 #ifndef STM32F407XX_DAC_H
 #define STM32F407XX_DAC_H
 
 #include "stm32f407xx.h"                  // Device header
 #include "stm32f407xx_common_macro.h"
 #include "stm32f407xx_gpio.h"
+#include "stm32f407xx_dma.h"
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -69,6 +76,27 @@ Macro definition
 #define DAC_OBUFFER_EN 0
 #define DAC_OBUFFER_DIS 1
 
+/*
+*@DAC_DMA_STREAM
+*DMA stream & channel used by each DAC channel
+*/
+#define DAC1_DMA_CONTROLLER	DMA1
+#define DAC1_DMA_STREAM	5
+#define DAC1_DMA_CHANNEL	DMA_CHANNEL_7
+#define DAC1_DMA_IRQ	IRQ_DMA1_STREAM5
+#define DAC2_DMA_CONTROLLER	DMA1
+#define DAC2_DMA_STREAM	6
+#define DAC2_DMA_CHANNEL	DMA_CHANNEL_7
+#define DAC2_DMA_IRQ	IRQ_DMA1_STREAM6
+
+/*
+*@DAC_EVENT
+*Event during DMA transfer (can be combined)
+*/
+#define DAC_EV_DMA_HALF_TRANSFER	0x01	/*first half of buffer is output, it can be refilled*/
+#define DAC_EV_DMA_TRANSFER_CMPLT	0x02	/*second half of buffer is output, it can be refilled*/
+#define DAC_EV_DMA_TRANSFER_ERR	0x04
+
 /***********************************************************************
 DAC structure definition
 ***********************************************************************/
@@ -84,6 +112,7 @@ typedef struct{
 typedef struct{
 	DAC_TypeDef *DACxPtr;
 	DAC_Config_t *DACxConfigPtr;
+	DMA_Handle_t *DMAxHandlePtr;	/*DMA stream feeding DAC channel, set by DAC_DMA_init*/
 }DAC_Handle_t;
 
 /***********************************************************************
@@ -145,4 +174,49 @@ void DAC_deinit(DAC_TypeDef *DACxPtr);
 */
 void DAC_write(DAC_Handle_t *DACxHandlePtr, uint16_t digiVal);
 
+/**
+*@brief 		Initialize DMA stream feeding DAC channel
+*
+*Refer to @DAC_DMA_STREAM for stream & channel used by each DAC channel. Stream is configured in circular mode, half transfer,
+*transfer complete and transfer error interrupts of stream are enabled. User need to enable stream 's interrupt vector in NVIC
+*and call DAC_DMA_intrpt_handler from stream 's IRQ handler.
+*DAC channel must be initialized with a trigger event (refer to @DAC_TRIGGER_EV), one sample is transferred on each trigger event.
+*
+*@param 	Pointer to DAC handle struct
+*@return 	None
+*/
+void DAC_DMA_init(DAC_Handle_t *DACxHandlePtr);
+
+/**
+*@brief 		Start output of circular buffer through DMA
+*
+*Samples are written as is to data holding register selected by resolution and alignment of DAC channel
+*(uint8_t samples for 8 bits resolution, uint16_t samples for 12 bits resolution).
+*Buffer is output again from its start after last sample until DAC_stop_DMA is called, a half of buffer can be refilled
+*while the other half is output (refer to @DAC_EVENT).
+*
+*@param 	Pointer to DAC handle struct
+*@param 	Buffer of samples
+*@param 	Number of samples in buffer (even number, 2 to 65534)
+*@return 	None
+*/
+void DAC_start_DMA(DAC_Handle_t *DACxHandlePtr, const void *bufferPtr, uint16_t count);
+
+/**
+*@brief 		Stop output of buffer through DMA
+*
+*DAC channel keep last output sample
+*
+*@param 	Pointer to DAC handle struct
+*@return 	None
+*/
+void DAC_stop_DMA(DAC_Handle_t *DACxHandlePtr);
+
+/**
+*@brief 		Interrupt handler for DMA stream feeding DAC channel
+*@param 	Pointer to DAC handle struct
+*@return 	Occurred events, refer to @DAC_EVENT
+*/
+uint8_t DAC_DMA_intrpt_handler(DAC_Handle_t *DACxHandlePtr);
+
 #endif
@@ -0,0 +1,225 @@
+/**
+*@file stm32f407xx_dma.h
+*@brief provide APIs for interfacing with DMA controllers on stm32f407xx MCUs.
+*
+*This header file provide APIs for configuring DMA streams and starting transfers between peripherals and memory on stm32f407xx MCUs.
+*Stream and channel selection for each peripheral request is given in DMA request mapping table (RM0090 table 42, 43).
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+/**
+*@Version 1.0
+*17/10/2026
+*/
+
+#ifndef STM32F407XX_DMA_H
+#define STM32F407XX_DMA_H
+
+#include "stm32f407xx.h"                  // Device header
+#include "stm32f407xx_common_macro.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+/***********************************************************************
+Macro definition
+***********************************************************************/
+
+/*
+*@DMA_CHANNEL
+*DMA channel (peripheral request) selection
+*/
+#define DMA_CHANNEL_0	0
+#define DMA_CHANNEL_1	1
+#define DMA_CHANNEL_2	2
+#define DMA_CHANNEL_3	3
+#define DMA_CHANNEL_4	4
+#define DMA_CHANNEL_5	5
+#define DMA_CHANNEL_6	6
+#define DMA_CHANNEL_7	7
+
+/*
+*@DMA_DIRECTION
+*DMA data transfer direction
+*/
+#define DMA_DIR_PERIPH_TO_MEM	0
+#define DMA_DIR_MEM_TO_PERIPH	1
+#define DMA_DIR_MEM_TO_MEM	2
+
+/*
+*@DMA_DATA_SIZE
+*Peripheral and memory data size
+*/
+#define DMA_DATA_SIZE_8BITS	0
+#define DMA_DATA_SIZE_16BITS	1
+#define DMA_DATA_SIZE_32BITS	2
+
+/*
+*@DMA_MEM_INC
+*Memory address increment after each data transfer
+*/
+#define DMA_MEM_INC_DIS	0
+#define DMA_MEM_INC_EN	1
+
+/*
+*@DMA_CIRCULAR
+*Circular mode (transfer restart automatically after last data)
+*/
+#define DMA_CIRCULAR_DIS	0
+#define DMA_CIRCULAR_EN	1
+
+/*
+*@DMA_PRIORITY
+*Stream priority level
+*/
+#define DMA_PRIORITY_LOW	0
+#define DMA_PRIORITY_MEDIUM	1
+#define DMA_PRIORITY_HIGH	2
+#define DMA_PRIORITY_VERY_HIGH	3
+
+/*
+*@DMA_STATE
+*Possible DMA stream state
+*/
+#define DMA_STATE_READY	0
+#define DMA_STATE_BUSY	1
+
+/*
+*@DMA_INTERRUPT
+*DMA stream interrupt selection (can be combined)
+*/
+#define DMA_INTRPT_TC	DMA_SxCR_TCIE
+#define DMA_INTRPT_HT	DMA_SxCR_HTIE
+#define DMA_INTRPT_TE	DMA_SxCR_TEIE
+
+/*
+*@DMA_EVENT
+*Event during DMA transfer (can be combined)
+*/
+#define DMA_EV_TRANSFER_CMPLT	0x01
+#define DMA_EV_HALF_TRANSFER	0x02
+#define DMA_EV_TRANSFER_ERR	0x04
+
+/***********************************************************************
+DMA structure definition
+***********************************************************************/
+typedef struct{
+	uint8_t channel;	/*Refer to @DMA_CHANNEL for possible value*/
+	uint8_t direction;	/*Refer to @DMA_DIRECTION for possible value*/
+	uint8_t dataSize;	/*Refer to @DMA_DATA_SIZE for possible value (same size for peripheral and memory)*/
+	uint8_t memInc;	/*Refer to @DMA_MEM_INC for possible value*/
+	uint8_t circular;	/*Refer to @DMA_CIRCULAR for possible value*/
+	uint8_t priority;	/*Refer to @DMA_PRIORITY for possible value*/
+}DMA_Config_t;
+
+typedef struct{
+	DMA_TypeDef *DMAxPtr;
+	uint8_t streamNo;	/*0 to 7*/
+	DMA_Stream_TypeDef *DMAxStreamPtr;	/*Set by DMA_init*/
+	DMA_Config_t *DMAxConfigPtr;
+	volatile uint8_t state;	/*Refer to @DMA_STATE for possible value*/
+}DMA_Handle_t;
+
+/***********************************************************************
+DMA driver APIs prototype
+***********************************************************************/
+
+/**
+*@brief 		DMA controller clock enable/disable
+*@param 	Pointer to base address of DMA controller
+*@param 	Enable or disable action
+*@return 	None
+*/
+void DMA_CLK_ctr(DMA_TypeDef *DMAxPtr, uint8_t enOrDis);
+
+/**
+*@brief 		Initialize DMA stream
+*
+*Stream is disabled and configured with direct mode (no FIFO). Transfer is started later by DMA_start
+*
+*@param 	Pointer to DMA handle struct
+*@return 	None
+*/
+void DMA_init(DMA_Handle_t *DMAxHandlePtr);
+
+/**
+*@brief 		Start DMA transfer
+*@param 	Pointer to DMA handle struct
+*@param 	Peripheral address (or source address in memory to memory mode)
+*@param 	Memory address
+*@param 	Number of data items to transfer (1 to 65535)
+*@return 	None
+*/
+void DMA_start(DMA_Handle_t *DMAxHandlePtr, uint32_t periphAddr, uint32_t memAddr, uint16_t numOfData);
+
+/**
+*@brief 		Stop DMA transfer
+*
+*Stream is disabled and function return after stream is effectively disabled
+*
+*@param 	Pointer to DMA handle struct
+*@return 	None
+*/
+void DMA_stop(DMA_Handle_t *DMAxHandlePtr);
+
+/**
+*@brief 		Enable or disable memory address increment
+*@note 		Only take effect when stream is disabled (before DMA_start)
+*@param 	Pointer to DMA handle struct
+*@param 	Enable or disable action
+*@return 	None
+*/
+void DMA_mem_inc_ctr(DMA_Handle_t *DMAxHandlePtr, uint8_t enOrDis);
+
+/**
+*@brief 		Set peripheral and memory data size
+*@note 		Only take effect when stream is disabled (before DMA_start)
+*@param 	Pointer to DMA handle struct
+*@param 	Data size, refer to @DMA_DATA_SIZE
+*@return 	None
+*/
+void DMA_set_data_size(DMA_Handle_t *DMAxHandlePtr, uint8_t dataSize);
+
+/**
+*@brief 		Get number of data items remaining to be transferred
+*@param 	Pointer to DMA handle struct
+*@return 	Value of NDTR register
+*/
+uint16_t DMA_get_remaining(DMA_Handle_t *DMAxHandlePtr);
+
+/**
+*@brief 		Enable or disable DMA stream interrupts
+*@param 	Pointer to DMA handle struct
+*@param 	Interrupts, refer to @DMA_INTERRUPT
+*@param 	Enable or disable action
+*@return 	None
+*/
+void DMA_interrupt_ctr(DMA_Handle_t *DMAxHandlePtr, uint32_t interrupts, uint8_t enOrDis);
+
+/**
+*@brief 		Enable or disable DMA stream 's interrupt vector in NVIC
+*@param 	IRQ number
+*@param 	Enable or disable action
+*@return 	None
+*/
+void DMA_intrpt_vector_ctr(uint8_t IRQnumber, uint8_t enOrDis);
+
+/**
+*@brief 		Config priority for DMA stream 's interrupt
+*@param 	IRQ number
+*@param 	Priority
+*@return 	None
+*/
+void DMA_intrpt_priority_config(uint8_t IRQnumber, uint8_t priority);
+
+/**
+*@brief 		DMA stream interrupt handler
+*
+*Clear interrupt flags of stream and report which events occurred. Driver using DMA (SPI, DAC, ...) call this from its own handler
+*
+*@param 	Pointer to DMA handle struct
+*@return 	Occurred events, refer to @DMA_EVENT
+*/
+uint8_t DMA_intrpt_handler(DMA_Handle_t *DMAxHandlePtr);
+#endif
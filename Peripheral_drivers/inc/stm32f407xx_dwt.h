@@ -0,0 +1,69 @@
+/**
+*@file stm32f407xx_dwt.h
+*@brief provide APIs for using DWT cycle counter of cortex M4 core on stm32f407xx MCUs.
+*
+*This header file provide APIs for measuring execution time in CPU clock cycles with DWT (Data Watchpoint and Trace unit) cycle counter.
+*Counter is 32 bits and wrap around after 2^32 cycles (about 28s at 150MHz), difference of 2 readings is correct across 1 wrap.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+/**
+*@Version 1.0
+*17/10/2026
+*/
+
+#ifndef STM32F407XX_DWT_H
+#define STM32F407XX_DWT_H
+
+#include "stm32f407xx.h"                  // Device header
+#include "stm32f407xx_common_macro.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+/***********************************************************************
+Macro definition
+***********************************************************************/
+
+/*
+*@DWT_CYCLE_COUNT
+*Read current value of cycle counter (macro to keep measurement overhead at a single load)
+*/
+#define DWT_CYCLE_COUNT	(DWT->CYCCNT)
+
+/***********************************************************************
+DWT driver APIs prototype
+***********************************************************************/
+
+/**
+*@brief 		Enable or disable DWT cycle counter
+*
+*Trace must be enabled in debug exception and monitor control register before DWT can count
+*
+*@param 	Enable or disable action
+*@return 	None
+*/
+void DWT_cycle_counter_ctr(uint8_t enOrDis);
+
+/**
+*@brief 		Reset cycle counter to 0
+*@param 	None
+*@return 	None
+*/
+void DWT_cycle_counter_reset(void);
+
+/**
+*@brief 		Get current value of cycle counter
+*@param 	None
+*@return 	Number of CPU cycles since counter was enabled or reset
+*/
+uint32_t DWT_get_cycle_count(void);
+
+/**
+*@brief 		Get number of cycles elapsed since given counter value
+*@param 	Counter value read before measured code
+*@return 	Number of CPU cycles
+*/
+uint32_t DWT_get_elapsed_cycles(uint32_t startCount);
+#endif
@@ -8,6 +8,12 @@
 *@date 23/07/2019
 */
 
+/*
+ *@Version 1.1
+ *Date 17/10/2026
+ *Add GPIO_Intrpt_software_trigger
+ */
+
 #ifndef STM32F407XX_GPIO_H
 #define STM32F407XX_GPIO_H
 
@@ -173,6 +179,15 @@ void GPIO_Intrpt_priority_config (uint8_t IRQnumber, uint8_t IRQpriority);
 */
 void GPIO_Intrpt_ctrl (uint8_t IRQnumber, uint8_t enOrDis);
 
+/**
+*@brief Generate interrupt of GPIO pin by software (EXTI software interrupt event register)
+*
+*Interrupt of pin must be configured, its handler run as if an edge was detected on pin.
+*
+*@param GPIO pin number
+*@return none
+*/
+void GPIO_Intrpt_software_trigger (uint8_t pinNumber);
 /**
 *@brief Handler for GPIO pin 's interrupt
 *@param GPIO pin number
@@ -8,12 +8,25 @@
 *@date 31/07/2019
 */
 
+/**
+*@Version 1.0
+*31/07/2019
+*/
+
+/**
+*@Version 1.1
+*17/10/2026
+*Add queue of master transactions (write then read, with repeated start or stop between them) moved by DMA and driven by event/error
+*interrupts (I2C_DMA_init, I2C_queue_transaction, I2C_queue_busy_check, I2C_DMA_TX_intrpt_handler, I2C_DMA_RX_intrpt_handler)
+*/
+
 #ifndef STM32F407XX_I2C_H
 #define STM32F407XX_I2C_H
 
 #include "stm32f407xx.h"                  // Device header
 #include "stm32f407xx_common_macro.h"
 #include "stm32f407xx_rcc.h"
+#include "stm32f407xx_dma.h"
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -52,6 +65,7 @@
 #define I2C_READY 0
 #define I2C_BUSY_IN_TX 1
 #define I2C_BUSY_IN_RX 2
+#define I2C_BUSY_IN_QUEUE 3	/*transactions queued by I2C_queue_transaction are running*/
 
 /*
 *@I2C_Event_and_Error
@@ -68,6 +82,54 @@
 #define I2C_EV_SLV_DT_REQ	8/*device (acting as slave) is requested to send data*/
 #define I2C_EV_SLV_READ 9	/*device (acting as slave) needed to read data*/
 
+/*
+*@I2C_TRANSACTION_RESULT
+*Result of queued transaction given to its callback
+*/
+#define I2C_TRANSACTION_OK 0
+#define I2C_TRANSACTION_NACK 1	/*address or data byte not acknowledged (no device, device busy or data refused)*/
+#define I2C_TRANSACTION_ARLO 2	/*arbitration lost to other master, transaction can be queued again*/
+#define I2C_TRANSACTION_BERR 3	/*misplaced start or stop condition on bus*/
+#define I2C_TRANSACTION_DMA_ERR 4
+
+/*
+*@I2C_QUEUE_RESULT
+*Result of I2C_queue_transaction
+*/
+#define I2C_QUEUE_ACCEPTED 0
+#define I2C_QUEUE_FULL 1
+#define I2C_QUEUE_BUSY 2	/*interrupt based transfer (I2C_master_send_intrpt, I2C_master_receive_intrpt) in progress*/
+
+/*
+*@I2C_DMA_STREAM
+*DMA streams & channel used for I2C transmission and reception (RM0090 table 42)
+*/
+#define I2C1_DMA_TX_STREAM	7	/*also used by UART5 TX*/
+#define I2C1_DMA_TX_IRQ	IRQ_DMA1_STREAM7
+#define I2C1_DMA_RX_STREAM	0	/*stream 5 is used by DAC1*/
+#define I2C1_DMA_RX_IRQ	IRQ_DMA1_STREAM0
+#define I2C1_DMA_CHANNEL	DMA_CHANNEL_1
+#define I2C2_DMA_TX_STREAM	7
+#define I2C2_DMA_TX_IRQ	IRQ_DMA1_STREAM7
+#define I2C2_DMA_RX_STREAM	2	/*stream 3 is used by USART3 TX*/
+#define I2C2_DMA_RX_IRQ	IRQ_DMA1_STREAM2
+#define I2C2_DMA_CHANNEL	DMA_CHANNEL_7
+#define I2C3_DMA_TX_STREAM	4	/*also used by SPI2 TX*/
+#define I2C3_DMA_TX_IRQ	IRQ_DMA1_STREAM4
+#define I2C3_DMA_RX_STREAM	2
+#define I2C3_DMA_RX_IRQ	IRQ_DMA1_STREAM2
+#define I2C3_DMA_CHANNEL	DMA_CHANNEL_3
+
+/*
+*Number of transactions which can wait in queue (including transaction running), power of 2 not above 128
+*/
+#define I2C_QUEUE_SIZE	8
+
+/*uint8_t head and tail count freely and wrap at 256, slot is count % size: only a power of 2 dividing 256 keep slots in order at wrap*/
+#if ((I2C_QUEUE_SIZE) == 0) || ((I2C_QUEUE_SIZE) & ((I2C_QUEUE_SIZE) - 1)) || ((I2C_QUEUE_SIZE) > 128)
+#error "I2C_QUEUE_SIZE must be a power of 2 not above 128"
+#endif
+
 typedef struct{
 	uint32_t SCLspeed;	/*refer to @I2C_SCLspeed for possible value*/
 	uint8_t deviceAddress;	
@@ -75,6 +137,21 @@ typedef struct{
 	uint8_t FMdutyCycle;	/*refer to @I2C_FMdutyCycle for possible value*/	
 }I2C_Config_t;
 
+/*
+*Master transaction: txLength bytes written then rxLength bytes read from same slave, either part can be empty (both empty only
+*check that slave acknowledge its address). Transaction and its buffers must stay valid until callback is called (from interrupt).
+*/
+typedef struct I2C_Transaction{
+	uint8_t slaveAddr;	/*7-bit address*/
+	const uint8_t *txBufferPtr;
+	uint16_t txLength;
+	uint8_t *rxBufferPtr;
+	uint16_t rxLength;
+	uint8_t repeatedStart;	/*refer to @I2C_RepeatedStart, read follow write with repeated start instead of stop then start*/
+	void (*callback)(struct I2C_Transaction *TransactionPtr, uint8_t result);	/*refer to @I2C_TRANSACTION_RESULT, can be NULL*/
+	void *contextPtr;	/*free for application*/
+}I2C_Transaction_t;
+
 typedef struct{
 	I2C_TypeDef *I2CxPtr;
 	I2C_Config_t *I2CxConfigPtr;
@@ -86,6 +163,12 @@ typedef struct{
 	uint8_t slaveAddr;	/*To store Slave device address*/
 	uint32_t rxSize;
 	uint8_t repeatedStart;
+	DMA_Handle_t *DMAxTxHandlePtr;	/*DMA stream used for transmission, set by I2C_DMA_init*/
+	DMA_Handle_t *DMAxRxHandlePtr;	/*DMA stream used for reception, set by I2C_DMA_init*/
+	I2C_Transaction_t *queuePtr[I2C_QUEUE_SIZE];	/*transactions waiting, transaction running is at queueHead%I2C_QUEUE_SIZE*/
+	volatile uint8_t queueHead;	/*count of transactions finished (free running)*/
+	volatile uint8_t queueTail;	/*count of transactions queued (free running)*/
+	uint8_t phase;	/*write or read phase of transaction running*/
 }I2C_Handle_t;
 
 /**
@@ -188,6 +271,49 @@ uint8_t I2C_master_receive_intrpt (I2C_Handle_t *I2CxHandlePtr, uint8_t *rxBuffe
 */
 uint8_t I2C_master_send_intrpt (I2C_Handle_t *I2CxHandlePtr, uint8_t *txBufferPtr, uint32_t Length,uint8_t slaveAddr,uint8_t repeatedStart);
 
+/**
+*@brief Initialize DMA streams used by transaction queue (refer to @I2C_DMA_STREAM)
+*
+*Call after I2C_init. Interrupt vectors of DMA streams, I2C event and I2C error must be enabled by application.
+*
+*@param Pointer to I2C handle struct
+*@return none
+*/
+void I2C_DMA_init(I2C_Handle_t *I2CxHandlePtr);
+
+/**
+*@brief Queue master transaction (DMA base)
+*
+*Transaction start at once when queue is empty, otherwise after transactions queued before it. Its callback is called from interrupt
+*when it finished, next transaction is already started then. Callback can queue transactions (e.g. queue again after I2C_TRANSACTION_ARLO).
+*
+*@param Pointer to I2C handle struct
+*@param Pointer to transaction
+*@return Refer to @I2C_QUEUE_RESULT
+*/
+uint8_t I2C_queue_transaction(I2C_Handle_t *I2CxHandlePtr, I2C_Transaction_t *TransactionPtr);
+
+/**
+*@brief Check whether queued transactions are still running
+*@param Pointer to I2C handle struct
+*@return TRUE if busy, FALSE otherwise
+*/
+uint8_t I2C_queue_busy_check(I2C_Handle_t *I2CxHandlePtr);
+
+/**
+*@brief Interrupt handler for DMA stream used for I2C transmission
+*@param Pointer to I2C handle struct
+*@return none
+*/
+void I2C_DMA_TX_intrpt_handler(I2C_Handle_t *I2CxHandlePtr);
+
+/**
+*@brief Interrupt handler for DMA stream used for I2C reception
+*@param Pointer to I2C handle struct
+*@return none
+*/
+void I2C_DMA_RX_intrpt_handler(I2C_Handle_t *I2CxHandlePtr);
+
 /**
 *@brief Slave receive data
 *@param Pointer to base address of I2C registers
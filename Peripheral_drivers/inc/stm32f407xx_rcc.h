@@ -23,6 +23,24 @@
 *06/09/2019
 */
 
+/**
+*@Version 1.2
+*add following functions:
+*RCC_get_TIMCLK_value
+*17/10/2026
+*/
+
+/**
+*@Version 1.3
+*add clock profiles (refer to @RCC_CLOCK_PROFILE) and following functions:
+*RCC_set_SYSCLK_profile
+*RCC_get_TIM_period
+*RCC_get_SPI_prescaler
+*RCC_get_ADC_prescaler
+*RCC_set_SYSCLK_PLL_84_MHz now select RCC_PROFILE_84_MHZ (previous PLL factors gave 150 MHz)
+*17/10/2026
+*/
+
 #ifndef STM32F407XX_RCC_H
 #define STM32F407XX_RCC_H
 
@@ -73,14 +91,48 @@ Macro definition
 #define RCC_SYSCLK_HSE 	1
 #define RCC_SYSCLK_PLL		2
 
-#define RCC_PLL_84_VCO_INPUT_DIV				8
-#define RCC_PLL_84_VCO_OUTPUT_MUL 	300
-#define RCC_PLL_84_PLL_OUTPUT_DIV			0
-#define RCC_PLL_84_MAIN_PLL_DIV						7
-
 #define APB1 0
 #define APB2 1
 
+#define RCC_HSE_VALUE	8000000
+
+/*
+*@RCC_CLOCK_PROFILE
+*System clock profiles (PLL from HSE), refer to RCC_clockProfile
+*/
+#define RCC_PROFILE_84_MHZ		0
+#define RCC_PROFILE_120_MHZ		1
+#define RCC_PROFILE_168_MHZ		2
+#define RCC_NUM_OF_PROFILES		3
+
+/*
+*Limits of clocks (voltage scale 1, supply 2.7V to 3.6V)
+*/
+#define RCC_MAX_SYSCLK			168000000
+#define RCC_MAX_PCLK1			42000000
+#define RCC_MAX_PCLK2			84000000
+#define RCC_MAX_ADCCLK			36000000
+#define RCC_FLASH_WS_CLK		30000000	/*HCLK range per flash wait state*/
+#define RCC_PLL48_CLK			48000000	/*USB OTG FS, SDIO and RNG clock*/
+
+/***********************************************************************
+Structure definition
+***********************************************************************/
+
+typedef struct{
+	uint32_t SYSCLK;	/*resulting system clock (Hz)*/
+	uint8_t PLLM;	/*VCO input division factor [2,63], VCO input must be in [1,2] MHz*/
+	uint16_t PLLN;	/*VCO multiplication factor [50,432], VCO output must be in [100,432] MHz*/
+	uint8_t PLLP;	/*main PLL division factor: 2, 4, 6 or 8*/
+	uint8_t PLLQ;	/*PLL48CLK division factor [2,15]*/
+	uint8_t APB1div;	/*RCC_APB_DIVx*/
+	uint8_t APB2div;	/*RCC_APB_DIVx*/
+	uint8_t flashLatency;	/*wait states*/
+	uint32_t flashAccel;	/*FLASH_ACR_PRFTEN, FLASH_ACR_ICEN and FLASH_ACR_DCEN bits to set*/
+}RCC_Clock_Profile_t;
+
+extern const RCC_Clock_Profile_t RCC_clockProfile[RCC_NUM_OF_PROFILES];
+
 /***********************************************************************
 RCC driver functions prototype
 ***********************************************************************/
@@ -109,12 +161,24 @@ void RCC_MCO1_config (uint8_t option, uint8_t prescaler);
 void RCC_set_SYSCLK_HSE (void);
 
 /**
-*@brief 		Set system clock source as PLL 84 MHz
+*@brief 		Set system clock source as PLL 84 MHz (RCC_PROFILE_84_MHZ)
 *@param 	None
 *@return 	None
 */
 void RCC_set_SYSCLK_PLL_84_MHz (void);
 
+/**
+*@brief 		Set system clock source as PLL with a clock profile
+*
+*Flash wait states, prefetch buffer and instruction/data caches are set as well. Clock passes through HSE while PLL is programmed.
+*Settings derived from bus clocks (timer prescalers, SPI prescaler, UART baud rate, ADC prescaler) must be computed again afterwards,
+*refer to RCC_get_TIM_period, RCC_get_SPI_prescaler and RCC_get_ADC_prescaler.
+*
+*@param 	Refer to @RCC_CLOCK_PROFILE
+*@return 	None
+*/
+void RCC_set_SYSCLK_profile (uint8_t profile);
+
 /**
 *@brief 		Get system clock value
 *@return 	-1:	PLL is configured as system clock source however configration is wrong
@@ -130,4 +194,44 @@ int32_t RCC_get_SYSCLK_value (void);
 */
 int32_t RCC_get_PCLK_value(uint8_t APBx);
 
+/**
+*@brief 		Get clock value of timers on APB bus
+*
+*Timer clock is twice APB bus clock when APB prescaler is not 1.
+*
+*@param 	APB1 or APB2
+*@return 	-1:	PLL is configured as system clock source however configration is wrong
+*								clock value of timers on APB1 or APB2
+*/
+int32_t RCC_get_TIMCLK_value(uint8_t APBx);
+
+/**
+*@brief 		Compute timer prescaler and auto reload value for an update rate
+*
+*Period (timer clocks between updates) is timer clock / rate rounded down, it is split with smallest prescaler that divide it
+*and leave auto reload value in 16 bits.
+*
+*@param 	Timer clock (Hz), refer to RCC_get_TIMCLK_value
+*@param	Update rate (Hz)
+*@param	Pointer to prescaler (value written to PSC)
+*@param	Pointer to auto reload value (value written to ARR)
+*@return 	TRUE if update rate is exact, FALSE otherwise
+*/
+uint8_t RCC_get_TIM_period(uint32_t timerClock, uint32_t rate, uint16_t *prescalerPtr, uint16_t *reloadPtr);
+
+/**
+*@brief 		Compute SPI baud rate prescaler giving fastest serial clock not above a maximum
+*@param 	APB bus clock of SPI (Hz)
+*@param	Maximum serial clock (Hz)
+*@return 	Baud rate control value (0 for division by 2 up to 7 for division by 256, refer to @SPI_CLK_SPEED)
+*/
+uint8_t RCC_get_SPI_prescaler(uint32_t PCLK, uint32_t maxSCLK);
+
+/**
+*@brief 		Compute ADC prescaler keeping ADC clock not above RCC_MAX_ADCCLK
+*@param 	APB2 bus clock (Hz)
+*@return 	ADCPRE value (0 for division by 2 up to 3 for division by 8)
+*/
+uint8_t RCC_get_ADC_prescaler(uint32_t PCLK2);
+
 #endif
@@ -24,12 +24,21 @@
 *Add SPI_send_16_bits function
 */
 
+/**
+*@Version 1.2 
+*17/10/2026
+*Add SPI_send_data_16_bits function
+*Data frame format is only reconfigured when it changes
+*Add DMA transmission functions (SPI_DMA_TX_init, SPI_send_data_DMA, SPI_DMA_TX_busy_check, SPI_DMA_TX_intrpt_handler)
+*/
+
 #ifndef STM32F407XX_SPI_H
 #define STM32F407XX_SPI_H
 
 #include "stm32f407xx.h"                  // Device header
 #include "stm32f407xx_common_macro.h"
 #include "stm32f407xx_gpio.h"
+#include "stm32f407xx_dma.h"
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -105,6 +114,24 @@ Macro definition
 */
 #define SPI_EV_TRANSMISSION_CMPLT 1
 #define SPI_EV_RECEPTION_CMPLT	2
+#define SPI_EV_DMA_TRANSMISSION_CMPLT	3
+
+/*
+*@SPI_DMA_TX_STREAM
+*DMA stream & channel used for SPI transmission
+*/
+#define SPI1_DMA_TX_CONTROLLER	DMA2
+#define SPI1_DMA_TX_STREAM	3
+#define SPI1_DMA_TX_CHANNEL	DMA_CHANNEL_3
+#define SPI1_DMA_TX_IRQ	IRQ_DMA2_STREAM3
+#define SPI2_DMA_TX_CONTROLLER	DMA1
+#define SPI2_DMA_TX_STREAM	4
+#define SPI2_DMA_TX_CHANNEL	DMA_CHANNEL_0
+#define SPI2_DMA_TX_IRQ	IRQ_DMA1_STREAM4
+#define SPI3_DMA_TX_CONTROLLER	DMA1
+#define SPI3_DMA_TX_STREAM	7
+#define SPI3_DMA_TX_CHANNEL	DMA_CHANNEL_0
+#define SPI3_DMA_TX_IRQ	IRQ_DMA1_STREAM7
 
 /***********************************************************************
 SPI structure and enumeration definition
@@ -128,6 +155,7 @@ typedef struct{
 	uint32_t rxLength;	/*To store Rx Length*/
 	uint8_t txState;	/*To store Tx State: BUSY_IN_TX or READY*/
 	uint8_t rxState;	/*To store Rx State: BUSY_IN_RX or READY*/
+	DMA_Handle_t *DMAxTxHandlePtr;	/*DMA stream used for transmission, set by SPI_DMA_TX_init*/
 }SPI_Handle_t;
 
 /*
@@ -265,6 +293,60 @@ void SPI_send_8_bits(SPI_TypeDef *SPIxPtr, uint8_t data);
 */
 void SPI_send_16_bits(SPI_TypeDef *SPIxPtr, uint16_t data);
 
+/**
+*@brief 		Send multiple half-words (16 bits) through SPI using 16 bits data frame configuration
+*
+*Data frame is configured once for the whole buffer. Function return after last half-word is shifted out
+*
+*@param 	Pointer to base address of SPI registers
+*@param 	Pointer to buffer containing half-words to send
+*@param 	Number of half-words to send
+*@return		None
+*/
+void SPI_send_data_16_bits(SPI_TypeDef *SPIxPtr, const uint16_t *txBufferPtr, uint32_t count);
+
+/**
+*@brief 		Initialize DMA stream used for SPI transmission
+*
+*Refer to @SPI_DMA_TX_STREAM for stream & channel used by each SPI peripheral. Transfer complete interrupt of stream is enabled,
+*user need to enable stream 's interrupt vector in NVIC and call SPI_DMA_TX_intrpt_handler from stream 's IRQ handler
+*
+*@param 	Pointer to SPI handle struct
+*@return 	None
+*/
+void SPI_DMA_TX_init(SPI_Handle_t *SPIxHandlePtr);
+
+/**
+*@brief 		Send multiple data frames through SPI (DMA base)
+*
+*Function return immediately after DMA transfer is started. SPI_application_event_callback is called with SPI_EV_DMA_TRANSMISSION_CMPLT when DMA finish
+*
+*@param 	Pointer to SPI handle struct
+*@param 	Pointer to buffer containing data to send (must stay valid until transmission complete)
+*@param 	Number of data frames to send (1 to 65535)
+*@param 	Data frame, refer to @SPI_DATA_FRAME
+*@param 	ENABLE to send consecutive data in buffer, DISABLE to send first data of buffer repeatedly
+*@return 	Status of transmitter (transfer is only started if status is SPI_STATE_READY)
+*/
+uint8_t SPI_send_data_DMA(SPI_Handle_t *SPIxHandlePtr, const void *txBufferPtr, uint16_t count, uint8_t dataFrame, uint8_t memInc);
+
+/**
+*@brief 		Check whether DMA transmission is still ongoing
+*
+*Transmission is only finished after DMA transfer complete and last data frame is shifted out
+*
+*@param 	Pointer to SPI handle struct
+*@return 	TRUE if transmission is ongoing, FALSE otherwise
+*/
+uint8_t SPI_DMA_TX_busy_check(SPI_Handle_t *SPIxHandlePtr);
+
+/**
+*@brief 		Interrupt handler for DMA stream used for SPI transmission
+*@param 	Pointer to SPI handle struct
+*@return 	None
+*/
+void SPI_DMA_TX_intrpt_handler(SPI_Handle_t *SPIxHandlePtr);
+
 /**
 *@brief 		Receive multiple bytes from SPI (interrup base)
 *@param 	Pointer to SPI handle struct
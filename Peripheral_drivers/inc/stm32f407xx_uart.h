@@ -8,6 +8,19 @@
 *@date 15/08/2019
 */
 
+/**
+*@Version 1.0
+*15/08/2019
+*/
+
+/**
+*@Version 1.1
+*17/10/2026
+*Add DMA transmission with queue of pending buffers (UART_DMA_init, UART_send_DMA, UART_DMA_TX_busy_check, UART_DMA_TX_intrpt_handler)
+*Add circular DMA reception delivering frames ended by idle line (UART_receive_DMA, UART_stop_receive_DMA, UART_DMA_RX_intrpt_handler,
+*UART_DMA_RX_event_callback)
+*/
+
 #ifndef STM32F407XX_UART_H
 #define STM32F407XX_UART_H
 
@@ -15,6 +28,7 @@
 #include "stm32f407xx_common_macro.h"
 #include "stm32f407xx_rcc.h"
 #include "stm32f407xx_gpio.h"
+#include "stm32f407xx_dma.h"
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -94,6 +108,65 @@ Macro definition
 */
 #define UART_EV_TX_COMPLETE 0
 #define UART_EV_RX_COMPLETE 1
+#define UART_EV_DMA_TX_SENT 2	/*one buffer queued by UART_send_DMA was sent, it can be reused*/
+#define UART_EV_DMA_RX_ERROR 3	/*DMA reception stopped by transfer error*/
+
+/*
+*@UART_DMA_STREAM
+*DMA streams & channel used for UART transmission and reception (RM0090 table 42, 43)
+*/
+#define USART1_DMA_TX_CONTROLLER	DMA2
+#define USART1_DMA_TX_STREAM	7
+#define USART1_DMA_TX_IRQ	IRQ_DMA2_STREAM7
+#define USART1_DMA_RX_CONTROLLER	DMA2
+#define USART1_DMA_RX_STREAM	5
+#define USART1_DMA_RX_IRQ	IRQ_DMA2_STREAM5
+#define USART1_DMA_CHANNEL	DMA_CHANNEL_4
+#define USART2_DMA_TX_CONTROLLER	DMA1
+#define USART2_DMA_TX_STREAM	6
+#define USART2_DMA_TX_IRQ	IRQ_DMA1_STREAM6
+#define USART2_DMA_RX_CONTROLLER	DMA1
+#define USART2_DMA_RX_STREAM	5	/*also used by DAC1*/
+#define USART2_DMA_RX_IRQ	IRQ_DMA1_STREAM5
+#define USART2_DMA_CHANNEL	DMA_CHANNEL_4
+#define USART3_DMA_TX_CONTROLLER	DMA1
+#define USART3_DMA_TX_STREAM	3
+#define USART3_DMA_TX_IRQ	IRQ_DMA1_STREAM3
+#define USART3_DMA_RX_CONTROLLER	DMA1
+#define USART3_DMA_RX_STREAM	1
+#define USART3_DMA_RX_IRQ	IRQ_DMA1_STREAM1
+#define USART3_DMA_CHANNEL	DMA_CHANNEL_4
+#define UART4_DMA_TX_CONTROLLER	DMA1
+#define UART4_DMA_TX_STREAM	4	/*also used by SPI2 TX*/
+#define UART4_DMA_TX_IRQ	IRQ_DMA1_STREAM4
+#define UART4_DMA_RX_CONTROLLER	DMA1
+#define UART4_DMA_RX_STREAM	2
+#define UART4_DMA_RX_IRQ	IRQ_DMA1_STREAM2
+#define UART4_DMA_CHANNEL	DMA_CHANNEL_4
+#define UART5_DMA_TX_CONTROLLER	DMA1
+#define UART5_DMA_TX_STREAM	7	/*also used by SPI3 TX*/
+#define UART5_DMA_TX_IRQ	IRQ_DMA1_STREAM7
+#define UART5_DMA_RX_CONTROLLER	DMA1
+#define UART5_DMA_RX_STREAM	0
+#define UART5_DMA_RX_IRQ	IRQ_DMA1_STREAM0
+#define UART5_DMA_CHANNEL	DMA_CHANNEL_4
+#define USART6_DMA_TX_CONTROLLER	DMA2
+#define USART6_DMA_TX_STREAM	6
+#define USART6_DMA_TX_IRQ	IRQ_DMA2_STREAM6
+#define USART6_DMA_RX_CONTROLLER	DMA2
+#define USART6_DMA_RX_STREAM	1	/*also used by ADC3*/
+#define USART6_DMA_RX_IRQ	IRQ_DMA2_STREAM1
+#define USART6_DMA_CHANNEL	DMA_CHANNEL_5
+
+/*
+*Number of buffers which can wait for DMA transmission (including buffer being sent), power of 2 not above 128
+*/
+#define UART_DMA_TX_QUEUE_SIZE	8
+
+/*uint8_t head and tail count freely and wrap at 256, slot is count % size: only a power of 2 dividing 256 keep slots in order at wrap*/
+#if ((UART_DMA_TX_QUEUE_SIZE) == 0) || ((UART_DMA_TX_QUEUE_SIZE) & ((UART_DMA_TX_QUEUE_SIZE) - 1)) || ((UART_DMA_TX_QUEUE_SIZE) > 128)
+#error "UART_DMA_TX_QUEUE_SIZE must be a power of 2 not above 128"
+#endif
 
 /***********************************************************************
 UART structure and enumeration definition
@@ -117,6 +190,15 @@ typedef struct{
 	uint8_t *rxBufferPtr; /*pointer to buffer to store received data*/
 	uint32_t txLength; /*length of data to send*/
 	uint32_t rxLength; /*length of data to receive*/
+	DMA_Handle_t *DMAxTxHandlePtr; /*DMA stream used for transmission, set by UART_DMA_init*/
+	DMA_Handle_t *DMAxRxHandlePtr; /*DMA stream used for reception, set by UART_DMA_init*/
+	const uint8_t *txQueueBufferPtr[UART_DMA_TX_QUEUE_SIZE]; /*buffers waiting for DMA transmission*/
+	uint16_t txQueueLength[UART_DMA_TX_QUEUE_SIZE];
+	volatile uint8_t txQueueHead; /*count of buffers sent (free running), buffer being sent is at txQueueHead%UART_DMA_TX_QUEUE_SIZE*/
+	volatile uint8_t txQueueTail; /*count of buffers queued (free running)*/
+	uint8_t *rxRingPtr; /*circular buffer filled by DMA reception*/
+	uint16_t rxRingSize;
+	uint16_t rxReadPos; /*first byte of circular buffer not delivered to UART_DMA_RX_event_callback*/
 }UART_Handle_t;
 
 /*
@@ -272,6 +354,90 @@ void UART_close_send_data(UART_Handle_t *UARTxHandlePtr);
 */
 void UART_close_receive_data(UART_Handle_t *UARTxHandlePtr);
 
+/**
+*@brief Initialize DMA streams used for UART transmission and reception
+*
+*Refer to @UART_DMA_STREAM for streams & channel used by each UART peripheral. Transfer complete and error interrupts of transmission
+*stream, half transfer, transfer complete and error interrupts of reception stream are enabled. User need to enable interrupt vectors
+*of streams in NVIC and call UART_DMA_TX_intrpt_handler/UART_DMA_RX_intrpt_handler from their IRQ handlers.
+*Only 8 bits data frame (or 7 bits data with parity) is transferred by DMA.
+*
+*@param Pointer to UART handle struct
+*@return none
+*/
+void UART_DMA_init(UART_Handle_t *UARTxHandlePtr);
+
+/**
+*@brief UART send data (DMA base)
+*
+*Buffer is added to queue of pending buffers and function return at once. Queued buffers are sent back to back, next buffer is
+*started by transfer complete interrupt of previous one. Buffer must not change until UART_application_event_callback is called with
+*UART_EV_DMA_TX_SENT for it (events come in queue order). Function must be called from one context only (e.g. main loop), it can be
+*interrupted by DMA interrupt of same UART. Do not mix with UART_send/UART_send_intrpt while buffers are queued.
+*
+*@param Pointer to UART handle struct
+*@param Pointer to data to send
+*@param Length of data (1 to 65535 bytes)
+*@return UART_STATE_READY when buffer is queued, UART_STATE_TX_BUSY when queue is full (buffer is not queued)
+*/
+uint8_t UART_send_DMA(UART_Handle_t *UARTxHandlePtr, const uint8_t *txBufferPtr, uint16_t Length);
+
+/**
+*@brief Check whether DMA transmission is still ongoing
+*
+*Transmission is only finished after every queued buffer is sent and last data frame is shifted out
+*
+*@param Pointer to UART handle struct
+*@return TRUE if transmission is ongoing, FALSE otherwise
+*/
+uint8_t UART_DMA_TX_busy_check(UART_Handle_t *UARTxHandlePtr);
+
+/**
+*@brief Interrupt handler for DMA stream used for UART transmission
+*@param Pointer to UART handle struct
+*@return none
+*/
+void UART_DMA_TX_intrpt_handler(UART_Handle_t *UARTxHandlePtr);
+
+/**
+*@brief UART receive data continuously into circular buffer (DMA base)
+*
+*DMA fill circular buffer without stopping. Received bytes are given to UART_DMA_RX_event_callback when line become idle after a frame
+*(USART IDLE interrupt, from UART_intrpt_handler), and at half and end of circular buffer so that frames longer than buffer are received.
+*A frame may be given in several pieces, last piece has endOfFrame set (it can be empty). Callback must take bytes before DMA write
+*half of buffer again. User need to enable UART interrupt vector in NVIC, UART and reception stream interrupts must have same priority.
+*
+*@param Pointer to UART handle struct
+*@param Pointer to circular buffer
+*@param Size of circular buffer (2 to 65535 bytes)
+*@return Status of UART receiver before call, reception is only started when it was ready
+*/
+uint8_t UART_receive_DMA(UART_Handle_t *UARTxHandlePtr, uint8_t *rxRingPtr, uint16_t size);
+
+/**
+*@brief Stop DMA reception, bytes not given to UART_DMA_RX_event_callback yet are dropped
+*@param Pointer to UART handle struct
+*@return none
+*/
+void UART_stop_receive_DMA(UART_Handle_t *UARTxHandlePtr);
+
+/**
+*@brief Interrupt handler for DMA stream used for UART reception
+*@param Pointer to UART handle struct
+*@return none
+*/
+void UART_DMA_RX_intrpt_handler(UART_Handle_t *UARTxHandlePtr);
+
+/**
+*@brief give bytes received by DMA to application
+*@param Pointer to UART_Handle struct
+*@param Pointer to received bytes (inside circular buffer)
+*@param Number of bytes
+*@param TRUE if line became idle after these bytes (end of frame), FALSE otherwise
+*@return none
+*/
+void UART_DMA_RX_event_callback(UART_Handle_t *UARTxHandlePtr, const uint8_t *dataPtr, uint16_t length, uint8_t endOfFrame);
+
 /**
 *@brief inform application of UART event or error
 *@param Pointer to UART_Handle struct
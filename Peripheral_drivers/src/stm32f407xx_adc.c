@@ -5,10 +5,9 @@
 *This implementation file provide functions for interfacing with ADCs on stm32f407xx MCUs.
 *
 *@note This library only support the following configurations and features:
-*	number of conversion: 1
+*	number of conversion: 1 (read value using busy-wait method) or regular sequence of up to 16 channels in scan mode (read by DMA)
 *	resolution: 12 bits
-*	conversion mode: single
-*	read value using busy-wait method
+*	conversion mode: single or continuous
 *
 *@author Tran Thanh Nhan
 *@date 26/08/2019
@@ -33,6 +32,10 @@ void ADC_channel_13_init(ADC_TypeDef *ADCxPtr);
 void ADC_channel_14_init(ADC_TypeDef *ADCxPtr);
 void ADC_channel_15_init(ADC_TypeDef *ADCxPtr);
 void ADC_configure_channel (ADC_TypeDef *ADCxPtr,uint8_t channel);
+void ADC_configure_sequence (ADC_TypeDef *ADCxPtr, const ADC_Config_t *ADCxConfigPtr);
+
+static DMA_Handle_t ADCxDMAHandle[3];
+static DMA_Config_t ADCxDMAConfig[3];
 
 /***********************************************************************
 ADC clock enable/disable
@@ -81,6 +84,10 @@ void ADC_init(ADC_Handle_t *ADCxHandlePtr)
 	/*turn off ADCx peripheral for initilization*/
 	ADC_ctr(ADCxHandlePtr->ADCxPtr,DISABLE);
 	
+	/*ADC clock is APB2 clock divided by common prescaler, it must not exceed 36MHz (APB2 is 84MHz with 168MHz clock profile)*/
+	ADC->CCR &= ~ADC_CCR_ADCPRE;
+	ADC->CCR |= RCC_get_ADC_prescaler((uint32_t)RCC_get_PCLK_value(APB2)) << ADC_CCR_ADCPRE_Pos;
+	
 	/*set ADC resolution to 12 bits*/
 	uint8_t option = ADCxHandlePtr->ADCxConfigPtr->resolution;
 	ADCxHandlePtr->ADCxPtr->CR1 &= ~ADC_CR1_RES;
@@ -94,6 +101,11 @@ void ADC_init(ADC_Handle_t *ADCxHandlePtr)
 	/*set EOC as indicating end of each regular conversion*/
 	ADCxHandlePtr->ADCxPtr->CR2 |= ADC_CR2_EOCS; 
 	
+	/*program regular sequence (otherwise channel is selected by each ADC_read)*/
+	if(ADCxHandlePtr->ADCxConfigPtr->sequencePtr != NULL){
+		ADC_configure_sequence(ADCxHandlePtr->ADCxPtr,ADCxHandlePtr->ADCxConfigPtr);
+	}
+	
 	/*enable ADC peripheral*/
 	ADC_ctr(ADCxHandlePtr->ADCxPtr,ENABLE);
 }
@@ -177,6 +189,80 @@ uint16_t ADC_read(ADC_TypeDef *ADCxPtr, uint8_t channel)
 	return ADCxPtr->DR; 
 }
 
+/***********************************************************************
+Initialize DMA stream receiving conversions of ADC
+***********************************************************************/
+void ADC_DMA_init(ADC_Handle_t *ADCxHandlePtr)
+{
+	uint8_t index;
+	DMA_Handle_t *DMAxHandlePtr;
+	DMA_Config_t *DMAxConfigPtr;
+	
+	if(ADCxHandlePtr->ADCxPtr == ADC1){
+		index = 0;
+		ADCxDMAHandle[index].DMAxPtr = ADC1_DMA_CONTROLLER;
+		ADCxDMAHandle[index].streamNo = ADC1_DMA_STREAM;
+		ADCxDMAConfig[index].channel = ADC1_DMA_CHANNEL;
+	}else if(ADCxHandlePtr->ADCxPtr == ADC2){
+		index = 1;
+		ADCxDMAHandle[index].DMAxPtr = ADC2_DMA_CONTROLLER;
+		ADCxDMAHandle[index].streamNo = ADC2_DMA_STREAM;
+		ADCxDMAConfig[index].channel = ADC2_DMA_CHANNEL;
+	}else{
+		index = 2;
+		ADCxDMAHandle[index].DMAxPtr = ADC3_DMA_CONTROLLER;
+		ADCxDMAHandle[index].streamNo = ADC3_DMA_STREAM;
+		ADCxDMAConfig[index].channel = ADC3_DMA_CHANNEL;
+	}
+	
+	DMAxHandlePtr = &ADCxDMAHandle[index];
+	DMAxConfigPtr = &ADCxDMAConfig[index];
+	
+	DMAxConfigPtr->direction = DMA_DIR_PERIPH_TO_MEM;
+	DMAxConfigPtr->dataSize = DMA_DATA_SIZE_16BITS;
+	DMAxConfigPtr->memInc = DMA_MEM_INC_EN;
+	DMAxConfigPtr->circular = DMA_CIRCULAR_EN;
+	/*conversion not moved before the next one end is lost (overrun stop DMA requests)*/
+	DMAxConfigPtr->priority = DMA_PRIORITY_MEDIUM;
+	
+	DMAxHandlePtr->DMAxConfigPtr = DMAxConfigPtr;
+	DMA_init(DMAxHandlePtr);
+	
+	ADCxHandlePtr->DMAxHandlePtr = DMAxHandlePtr;
+}
+
+/***********************************************************************
+Start conversions of regular sequence into circular buffer through DMA
+***********************************************************************/
+void ADC_start_DMA(ADC_Handle_t *ADCxHandlePtr, volatile uint16_t *bufferPtr, uint16_t count)
+{
+	ADC_TypeDef *ADCxPtr = ADCxHandlePtr->ADCxPtr;
+	
+	DMA_start(ADCxHandlePtr->DMAxHandlePtr,(uint32_t)(uintptr_t)&ADCxPtr->DR,(uint32_t)(uintptr_t)bufferPtr,count);
+	
+	/*ADC request DMA transfer after each conversion and keep requesting after last transfer of buffer (circular DMA)*/
+	ADCxPtr->SR &= ~(ADC_SR_OVR | ADC_SR_EOC);
+	ADCxPtr->CR2 |= ADC_CR2_DMA | ADC_CR2_DDS;
+	
+	if(ADCxHandlePtr->ADCxConfigPtr->conversionMode == ADC_CVSMODE_CONT){
+		ADCxPtr->CR2 |= ADC_CR2_CONT;
+	}
+	
+	/*execute software start*/
+	ADCxPtr->CR2 |= ADC_CR2_SWSTART;
+}
+
+/***********************************************************************
+Stop conversions into buffer through DMA
+***********************************************************************/
+void ADC_stop_DMA(ADC_Handle_t *ADCxHandlePtr)
+{
+	/*continuous conversions stop at end of current sequence, ADC stop requesting DMA transfers at once*/
+	ADCxHandlePtr->ADCxPtr->CR2 &= ~(ADC_CR2_CONT | ADC_CR2_DMA | ADC_CR2_DDS);
+	
+	DMA_stop(ADCxHandlePtr->DMAxHandlePtr);
+}
+
 /***********************************************************************
 Private function: initialize GPIO pin corresponded to channel 0
 ***********************************************************************/
@@ -334,8 +420,52 @@ Private function: configure regular channel
 ***********************************************************************/
 void ADC_configure_channel (ADC_TypeDef *ADCxPtr,uint8_t channel){
 	/*configure regular channel sequence length as 1*/
-	ADCxPtr->SQR1 &=  ~ADC_SQR1_L_Pos;
+	ADCxPtr->SQR1 &=  ~ADC_SQR1_L;
 	/*set channel as 1st conversion*/
 	ADCxPtr->SQR3 &= ~ADC_SQR3_SQ1;
 	ADCxPtr->SQR3 |= channel<<ADC_SQR3_SQ1_Pos;
 }
+
+/***********************************************************************
+Private function: configure regular sequence and sampling time of its channels
+***********************************************************************/
+void ADC_configure_sequence (ADC_TypeDef *ADCxPtr, const ADC_Config_t *ADCxConfigPtr)
+{
+	/*SQ1 to SQ6 are in SQR3, SQ7 to SQ12 in SQR2, SQ13 to SQ16 in SQR1*/
+	volatile uint32_t *SQRPtr[3] = {&ADCxPtr->SQR3,&ADCxPtr->SQR2,&ADCxPtr->SQR1};
+	uint8_t numOfConversion = ADCxConfigPtr->numOfConversion;
+	
+	if(numOfConversion == 0){
+		numOfConversion = 1;
+	}else if(numOfConversion > ADC_MAX_CONVERSIONS){
+		numOfConversion = ADC_MAX_CONVERSIONS;
+	}
+	
+	/*configure regular channel sequence length*/
+	ADCxPtr->SQR1 &= ~ADC_SQR1_L;
+	ADCxPtr->SQR1 |= (uint32_t)(numOfConversion - 1) << ADC_SQR1_L_Pos;
+	
+	for(uint8_t i = 0; i < numOfConversion; i++){
+		uint8_t channel = ADCxConfigPtr->sequencePtr[i];
+		uint8_t position = 5*(i%6);
+		
+		*SQRPtr[i/6] &= ~(0x1FUL << position);
+		*SQRPtr[i/6] |= (uint32_t)channel << position;
+		
+		/*sampling time of channel 0 to 9 is in SMPR2, channel 10 to 18 in SMPR1*/
+		if(channel < 10){
+			ADCxPtr->SMPR2 &= ~(0x07UL << (3*channel));
+			ADCxPtr->SMPR2 |= (uint32_t)ADCxConfigPtr->sampleTime << (3*channel);
+		}else{
+			ADCxPtr->SMPR1 &= ~(0x07UL << (3*(channel - 10)));
+			ADCxPtr->SMPR1 |= (uint32_t)ADCxConfigPtr->sampleTime << (3*(channel - 10));
+		}
+	}
+	
+	/*scan mode convert every channel of sequence one after the other*/
+	if(numOfConversion > 1){
+		ADCxPtr->CR1 |= ADC_CR1_SCAN;
+	}else{
+		ADCxPtr->CR1 &= ~ADC_CR1_SCAN;
+	}
+}
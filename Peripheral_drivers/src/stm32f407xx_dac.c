@@ -10,9 +10,14 @@
 
 #include "../inc/stm32f407xx_dac.h"
 
+static uint32_t DAC_get_data_register(DAC_Handle_t *DACxHandlePtr);
+
 DAC_Handle_t DACxHandle;
 DAC_Config_t DACxConfig;
 
+static DMA_Handle_t DACxDMAHandle[2];
+static DMA_Config_t DACxDMAConfig[2];
+
 /***********************************************************************
 DAC clock enable/disable
 ***********************************************************************/
@@ -159,3 +164,109 @@ void DAC_write(DAC_Handle_t *DACxHandlePtr, uint16_t digiVal)
 		}
 	}
 }
+
+/***********************************************************************
+Initialize DMA stream feeding DAC channel
+***********************************************************************/
+void DAC_DMA_init(DAC_Handle_t *DACxHandlePtr)
+{
+	uint8_t index;
+	DMA_Handle_t *DMAxHandlePtr;
+	DMA_Config_t *DMAxConfigPtr;
+	
+	if(DACxHandlePtr->DACxConfigPtr->channel == DAC_CHANNEL_1){
+		index = 0;
+		DACxDMAHandle[index].DMAxPtr = DAC1_DMA_CONTROLLER;
+		DACxDMAHandle[index].streamNo = DAC1_DMA_STREAM;
+		DACxDMAConfig[index].channel = DAC1_DMA_CHANNEL;
+	}else{
+		index = 1;
+		DACxDMAHandle[index].DMAxPtr = DAC2_DMA_CONTROLLER;
+		DACxDMAHandle[index].streamNo = DAC2_DMA_STREAM;
+		DACxDMAConfig[index].channel = DAC2_DMA_CHANNEL;
+	}
+	
+	DMAxHandlePtr = &DACxDMAHandle[index];
+	DMAxConfigPtr = &DACxDMAConfig[index];
+	
+	DMAxConfigPtr->direction = DMA_DIR_MEM_TO_PERIPH;
+	DMAxConfigPtr->dataSize = (DACxHandlePtr->DACxConfigPtr->resolution == DAC_RES_8_bits) ? DMA_DATA_SIZE_8BITS : DMA_DATA_SIZE_16BITS;
+	DMAxConfigPtr->memInc = DMA_MEM_INC_EN;
+	DMAxConfigPtr->circular = DMA_CIRCULAR_EN;
+	/*DAC request a new sample on every trigger event, late transfer would repeat previous sample*/
+	DMAxConfigPtr->priority = DMA_PRIORITY_HIGH;
+	
+	DMAxHandlePtr->DMAxConfigPtr = DMAxConfigPtr;
+	DMA_init(DMAxHandlePtr);
+	DMA_interrupt_ctr(DMAxHandlePtr,DMA_INTRPT_HT | DMA_INTRPT_TC | DMA_INTRPT_TE,ENABLE);
+	
+	DACxHandlePtr->DMAxHandlePtr = DMAxHandlePtr;
+	
+	/*DAC channel request DMA transfer on each trigger event*/
+	if(DACxHandlePtr->DACxConfigPtr->channel == DAC_CHANNEL_1){
+		DACxHandlePtr->DACxPtr->CR |= DAC_CR_DMAEN1;
+	}else{
+		DACxHandlePtr->DACxPtr->CR |= DAC_CR_DMAEN2;
+	}
+}
+
+/***********************************************************************
+Start output of circular buffer through DMA
+***********************************************************************/
+void DAC_start_DMA(DAC_Handle_t *DACxHandlePtr, const void *bufferPtr, uint16_t count)
+{
+	DMA_start(DACxHandlePtr->DMAxHandlePtr,DAC_get_data_register(DACxHandlePtr),(uint32_t)(uintptr_t)bufferPtr,count);
+}
+
+/***********************************************************************
+Stop output of buffer through DMA
+***********************************************************************/
+void DAC_stop_DMA(DAC_Handle_t *DACxHandlePtr)
+{
+	DMA_stop(DACxHandlePtr->DMAxHandlePtr);
+}
+
+/***********************************************************************
+Interrupt handler for DMA stream feeding DAC channel
+***********************************************************************/
+uint8_t DAC_DMA_intrpt_handler(DAC_Handle_t *DACxHandlePtr)
+{
+	uint8_t DMAEvent = DMA_intrpt_handler(DACxHandlePtr->DMAxHandlePtr);
+	uint8_t event = 0;
+	
+	if(DMAEvent & DMA_EV_HALF_TRANSFER){
+		event |= DAC_EV_DMA_HALF_TRANSFER;
+	}
+	
+	if(DMAEvent & DMA_EV_TRANSFER_CMPLT){
+		event |= DAC_EV_DMA_TRANSFER_CMPLT;
+	}
+	
+	if(DMAEvent & DMA_EV_TRANSFER_ERR){
+		event |= DAC_EV_DMA_TRANSFER_ERR;
+	}
+	
+	return event;
+}
+
+/***********************************************************************
+Private function: Get address of data holding register selected by resolution and alignment
+***********************************************************************/
+uint32_t DAC_get_data_register(DAC_Handle_t *DACxHandlePtr)
+{
+	DAC_TypeDef *DACxPtr = DACxHandlePtr->DACxPtr;
+	uint8_t resolution = DACxHandlePtr->DACxConfigPtr->resolution;
+	uint8_t alignment = DACxHandlePtr->DACxConfigPtr->alignment;
+	
+	if(DACxHandlePtr->DACxConfigPtr->channel == DAC_CHANNEL_1){
+		if(resolution == DAC_RES_8_bits){
+			return (uint32_t)(uintptr_t)&DACxPtr->DHR8R1;
+		}
+		return (alignment == DAC_ALIGNMENT_LEFT) ? (uint32_t)(uintptr_t)&DACxPtr->DHR12L1 : (uint32_t)(uintptr_t)&DACxPtr->DHR12R1;
+	}else{
+		if(resolution == DAC_RES_8_bits){
+			return (uint32_t)(uintptr_t)&DACxPtr->DHR8R2;
+		}
+		return (alignment == DAC_ALIGNMENT_LEFT) ? (uint32_t)(uintptr_t)&DACxPtr->DHR12L2 : (uint32_t)(uintptr_t)&DACxPtr->DHR12R2;
+	}
+}
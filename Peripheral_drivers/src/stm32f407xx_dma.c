@@ -0,0 +1,269 @@
+/**
+*@file stm32f407xx_dma.c
+*@brief provide APIs for interfacing with DMA controllers on stm32f407xx MCUs.
+*
+*This source file provide APIs for configuring DMA streams and starting transfers between peripherals and memory on stm32f407xx MCUs.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../inc/stm32f407xx_dma.h"
+
+static DMA_Stream_TypeDef* DMA_get_stream(DMA_TypeDef *DMAxPtr, uint8_t streamNo);
+static uint8_t DMA_get_flag_position(uint8_t streamNo);
+
+/*
+*Interrupt flags of each stream inside LISR/HISR (stream 0,4 | 1,5 | 2,6 | 3,7)
+*/
+#define DMA_FLAG_FEIF	0x01
+#define DMA_FLAG_DMEIF	0x04
+#define DMA_FLAG_TEIF	0x08
+#define DMA_FLAG_HTIF	0x10
+#define DMA_FLAG_TCIF	0x20
+#define DMA_FLAG_ALL	(DMA_FLAG_FEIF | DMA_FLAG_DMEIF | DMA_FLAG_TEIF | DMA_FLAG_HTIF | DMA_FLAG_TCIF)
+
+static DMA_Stream_TypeDef* const DMA1StreamTable[8] = {DMA1_Stream0,DMA1_Stream1,DMA1_Stream2,DMA1_Stream3,DMA1_Stream4,DMA1_Stream5,DMA1_Stream6,DMA1_Stream7};
+static DMA_Stream_TypeDef* const DMA2StreamTable[8] = {DMA2_Stream0,DMA2_Stream1,DMA2_Stream2,DMA2_Stream3,DMA2_Stream4,DMA2_Stream5,DMA2_Stream6,DMA2_Stream7};
+
+/***********************************************************************
+DMA controller clock enable/disable
+***********************************************************************/
+void DMA_CLK_ctr(DMA_TypeDef *DMAxPtr, uint8_t enOrDis)
+{
+	if(enOrDis == ENABLE){
+		if(DMAxPtr == DMA1){
+			RCC->AHB1ENR |= RCC_AHB1ENR_DMA1EN;
+		}else if(DMAxPtr == DMA2){
+			RCC->AHB1ENR |= RCC_AHB1ENR_DMA2EN;
+		}
+	}else{
+		if(DMAxPtr == DMA1){
+			RCC->AHB1ENR &= ~RCC_AHB1ENR_DMA1EN;
+		}else if(DMAxPtr == DMA2){
+			RCC->AHB1ENR &= ~RCC_AHB1ENR_DMA2EN;
+		}
+	}
+}
+
+/***********************************************************************
+Initialize DMA stream
+***********************************************************************/
+void DMA_init(DMA_Handle_t *DMAxHandlePtr)
+{
+	DMA_Config_t *DMAxConfigPtr = DMAxHandlePtr->DMAxConfigPtr;
+
+	DMA_CLK_ctr(DMAxHandlePtr->DMAxPtr,ENABLE);
+
+	DMAxHandlePtr->DMAxStreamPtr = DMA_get_stream(DMAxHandlePtr->DMAxPtr,DMAxHandlePtr->streamNo);
+
+	/*stream must be disabled before configuration*/
+	DMA_stop(DMAxHandlePtr);
+
+	uint32_t temp = 0;
+	temp |= (uint32_t)DMAxConfigPtr->channel << DMA_SxCR_CHSEL_Pos;
+	temp |= (uint32_t)DMAxConfigPtr->priority << DMA_SxCR_PL_Pos;
+	temp |= (uint32_t)DMAxConfigPtr->dataSize << DMA_SxCR_MSIZE_Pos;
+	temp |= (uint32_t)DMAxConfigPtr->dataSize << DMA_SxCR_PSIZE_Pos;
+	temp |= (uint32_t)DMAxConfigPtr->direction << DMA_SxCR_DIR_Pos;
+
+	if(DMAxConfigPtr->memInc == DMA_MEM_INC_EN){
+		temp |= DMA_SxCR_MINC;
+	}
+
+	if(DMAxConfigPtr->circular == DMA_CIRCULAR_EN){
+		temp |= DMA_SxCR_CIRC;
+	}
+
+	DMAxHandlePtr->DMAxStreamPtr->CR = temp;
+
+	/*direct mode, FIFO is not used*/
+	DMAxHandlePtr->DMAxStreamPtr->FCR &= ~DMA_SxFCR_DMDIS;
+
+	DMAxHandlePtr->state = DMA_STATE_READY;
+}
+
+/***********************************************************************
+Start DMA transfer
+***********************************************************************/
+void DMA_start(DMA_Handle_t *DMAxHandlePtr, uint32_t periphAddr, uint32_t memAddr, uint16_t numOfData)
+{
+	DMA_Stream_TypeDef *DMAxStreamPtr = DMAxHandlePtr->DMAxStreamPtr;
+	uint8_t flagPos = DMA_get_flag_position(DMAxHandlePtr->streamNo);
+
+	/*clear all flags left from previous transfer*/
+	if(DMAxHandlePtr->streamNo < 4){
+		DMAxHandlePtr->DMAxPtr->LIFCR = (uint32_t)DMA_FLAG_ALL << flagPos;
+	}else{
+		DMAxHandlePtr->DMAxPtr->HIFCR = (uint32_t)DMA_FLAG_ALL << flagPos;
+	}
+
+	DMAxStreamPtr->PAR = periphAddr;
+	DMAxStreamPtr->M0AR = memAddr;
+	DMAxStreamPtr->NDTR = numOfData;
+
+	DMAxHandlePtr->state = DMA_STATE_BUSY;
+	DMAxStreamPtr->CR |= DMA_SxCR_EN;
+}
+
+/***********************************************************************
+Stop DMA transfer
+***********************************************************************/
+void DMA_stop(DMA_Handle_t *DMAxHandlePtr)
+{
+	DMAxHandlePtr->DMAxStreamPtr->CR &= ~DMA_SxCR_EN;
+
+	/*wait until current data transfer is finished and stream is effectively disabled*/
+	while(DMAxHandlePtr->DMAxStreamPtr->CR & DMA_SxCR_EN);
+
+	DMAxHandlePtr->state = DMA_STATE_READY;
+}
+
+/***********************************************************************
+Enable or disable memory address increment
+***********************************************************************/
+void DMA_mem_inc_ctr(DMA_Handle_t *DMAxHandlePtr, uint8_t enOrDis)
+{
+	if(enOrDis == ENABLE){
+		DMAxHandlePtr->DMAxStreamPtr->CR |= DMA_SxCR_MINC;
+	}else{
+		DMAxHandlePtr->DMAxStreamPtr->CR &= ~DMA_SxCR_MINC;
+	}
+}
+
+/***********************************************************************
+Set peripheral and memory data size
+***********************************************************************/
+void DMA_set_data_size(DMA_Handle_t *DMAxHandlePtr, uint8_t dataSize)
+{
+	uint32_t temp = DMAxHandlePtr->DMAxStreamPtr->CR;
+
+	temp &= ~(DMA_SxCR_MSIZE | DMA_SxCR_PSIZE);
+	temp |= (uint32_t)dataSize << DMA_SxCR_MSIZE_Pos;
+	temp |= (uint32_t)dataSize << DMA_SxCR_PSIZE_Pos;
+
+	DMAxHandlePtr->DMAxStreamPtr->CR = temp;
+}
+
+/***********************************************************************
+Get number of data items remaining to be transferred
+***********************************************************************/
+uint16_t DMA_get_remaining(DMA_Handle_t *DMAxHandlePtr)
+{
+	return (uint16_t)DMAxHandlePtr->DMAxStreamPtr->NDTR;
+}
+
+/***********************************************************************
+Enable or disable DMA stream interrupts
+***********************************************************************/
+void DMA_interrupt_ctr(DMA_Handle_t *DMAxHandlePtr, uint32_t interrupts, uint8_t enOrDis)
+{
+	interrupts &= (DMA_INTRPT_TC | DMA_INTRPT_HT | DMA_INTRPT_TE);
+
+	if(enOrDis == ENABLE){
+		DMAxHandlePtr->DMAxStreamPtr->CR |= interrupts;
+	}else{
+		DMAxHandlePtr->DMAxStreamPtr->CR &= ~interrupts;
+	}
+}
+
+/***********************************************************************
+Enable or disable DMA stream 's interrupt vector in NVIC
+***********************************************************************/
+void DMA_intrpt_vector_ctr(uint8_t IRQnumber, uint8_t enOrDis)
+{
+	if(enOrDis == ENABLE){
+		if(IRQnumber <= 31){
+			NVIC->ISER[0] |= (1<<IRQnumber);
+		}
+		else if(IRQnumber > 31 && IRQnumber <= 63){
+			NVIC->ISER[1] |= (1<<(IRQnumber%32));
+		}
+		else if(IRQnumber > 63 && IRQnumber <= 95){
+			NVIC->ISER[2] |= (1<<(IRQnumber%64));
+		}
+	}else{
+		/*ICER is written, not read back: reading return every enabled interrupt and writing them back would disable them all*/
+		if(IRQnumber <= 31){
+			NVIC->ICER[0] = (1<<IRQnumber);
+		}
+		else if(IRQnumber > 31 && IRQnumber <= 63){
+			NVIC->ICER[1] = (1<<(IRQnumber%32));
+		}
+		else if(IRQnumber > 63 && IRQnumber <= 95){
+			NVIC->ICER[2] = (1<<(IRQnumber%64));
+		}
+	}
+}
+
+/***********************************************************************
+Config priority for DMA stream 's interrupt
+***********************************************************************/
+void DMA_intrpt_priority_config(uint8_t IRQnumber, uint8_t priority)
+{
+	uint8_t registerNo = IRQnumber/4;
+	uint8_t section = IRQnumber%4;
+
+	*(NVIC_IPR_BASE_ADDR + registerNo) &= ~(0xFF << (8*section));
+	*(NVIC_IPR_BASE_ADDR + registerNo) |= (priority << (8*section + NUM_OF_IPR_BIT_IMPLEMENTED));
+}
+
+/***********************************************************************
+DMA stream interrupt handler
+***********************************************************************/
+uint8_t DMA_intrpt_handler(DMA_Handle_t *DMAxHandlePtr)
+{
+	uint8_t flagPos = DMA_get_flag_position(DMAxHandlePtr->streamNo);
+	uint8_t event = 0;
+	uint32_t flags;
+
+	if(DMAxHandlePtr->streamNo < 4){
+		flags = (DMAxHandlePtr->DMAxPtr->LISR >> flagPos) & DMA_FLAG_ALL;
+		DMAxHandlePtr->DMAxPtr->LIFCR = flags << flagPos;
+	}else{
+		flags = (DMAxHandlePtr->DMAxPtr->HISR >> flagPos) & DMA_FLAG_ALL;
+		DMAxHandlePtr->DMAxPtr->HIFCR = flags << flagPos;
+	}
+
+	if(flags & DMA_FLAG_HTIF){
+		event |= DMA_EV_HALF_TRANSFER;
+	}
+
+	if(flags & DMA_FLAG_TCIF){
+		event |= DMA_EV_TRANSFER_CMPLT;
+
+		/*stream is disabled by hardware at the end of transfer (except circular mode)*/
+		if(!(DMAxHandlePtr->DMAxStreamPtr->CR & DMA_SxCR_CIRC)){
+			DMAxHandlePtr->state = DMA_STATE_READY;
+		}
+	}
+
+	if(flags & DMA_FLAG_TEIF){
+		event |= DMA_EV_TRANSFER_ERR;
+		DMAxHandlePtr->state = DMA_STATE_READY;
+	}
+
+	return event;
+}
+
+/***********************************************************************
+Private function: Get stream registers from DMA controller and stream number
+***********************************************************************/
+DMA_Stream_TypeDef* DMA_get_stream(DMA_TypeDef *DMAxPtr, uint8_t streamNo)
+{
+	if(DMAxPtr == DMA1){
+		return DMA1StreamTable[streamNo & 0x07];
+	}else{
+		return DMA2StreamTable[streamNo & 0x07];
+	}
+}
+
+/***********************************************************************
+Private function: Get position of stream 's flags inside LISR/HISR register
+***********************************************************************/
+uint8_t DMA_get_flag_position(uint8_t streamNo)
+{
+	static const uint8_t flagPosTable[4] = {0,6,16,22};
+
+	return flagPosTable[streamNo & 0x03];
+}
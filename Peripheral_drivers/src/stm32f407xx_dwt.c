@@ -0,0 +1,50 @@
+/**
+*@file stm32f407xx_dwt.c
+*@brief provide APIs for using DWT cycle counter of cortex M4 core on stm32f407xx MCUs.
+*
+*This source file provide APIs for measuring execution time in CPU clock cycles with DWT (Data Watchpoint and Trace unit) cycle counter.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../inc/stm32f407xx_dwt.h"
+
+/***********************************************************************
+Enable or disable DWT cycle counter
+***********************************************************************/
+void DWT_cycle_counter_ctr(uint8_t enOrDis)
+{
+	if(enOrDis == ENABLE){
+		CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+		DWT->CYCCNT = 0;
+		DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	}else{
+		DWT->CTRL &= ~DWT_CTRL_CYCCNTENA_Msk;
+	}
+}
+
+/***********************************************************************
+Reset cycle counter
+***********************************************************************/
+void DWT_cycle_counter_reset(void)
+{
+	DWT->CYCCNT = 0;
+}
+
+/***********************************************************************
+Get current value of cycle counter
+***********************************************************************/
+uint32_t DWT_get_cycle_count(void)
+{
+	return DWT->CYCCNT;
+}
+
+/***********************************************************************
+Get number of cycles elapsed since given counter value
+***********************************************************************/
+uint32_t DWT_get_elapsed_cycles(uint32_t startCount)
+{
+	/*unsigned subtraction stay correct when counter wrapped once*/
+	return DWT->CYCCNT - startCount;
+}
@@ -246,6 +246,12 @@ void GPIO_Intrpt_ctrl (uint8_t IRQnumber, uint8_t enOrDis)
 	}
 }
 
+void GPIO_Intrpt_software_trigger (uint8_t pinNumber)
+{
+	/*bit is cleared with pending bit by GPIO_Intrpt_handler*/
+	EXTI->SWIER |= (1<<pinNumber);
+}
+
 void GPIO_Intrpt_handler (uint8_t pinNumber)
 {
 	if(EXTI->PR & (1<<pinNumber)){
@@ -10,6 +10,25 @@
 
 #include "../inc/stm32f407xx_i2c.h"
 
+/*phase of queued transaction*/
+#define I2C_PHASE_WRITE	0
+#define I2C_PHASE_READ	1
+
+/*loops waiting for stop condition before next start (stop take one SCL period, about 1000 cycles at 100KHz)*/
+#define I2C_STOP_WAIT_LOOPS	4000
+
+static void I2C_wait_stop_sent(I2C_TypeDef *I2CxPtr);
+static void I2C_queue_start_next(I2C_Handle_t *I2CxHandlePtr);
+static void I2C_queue_end_write_phase(I2C_Handle_t *I2CxHandlePtr);
+static void I2C_queue_finish(I2C_Handle_t *I2CxHandlePtr, uint8_t result);
+static void I2C_queue_event_handler(I2C_Handle_t *I2CxHandlePtr);
+static void I2C_queue_err_handler(I2C_Handle_t *I2CxHandlePtr);
+
+static DMA_Handle_t I2CxDMATxHandle[3];
+static DMA_Config_t I2CxDMATxConfig[3];
+static DMA_Handle_t I2CxDMARxHandle[3];
+static DMA_Config_t I2CxDMARxConfig[3];
+
 //extern int32_t RCC_get_PCLK_value(uint8_t APBx);
 //extern int32_t RCC_get_PLL_output (void);
 
@@ -442,6 +461,11 @@ I2C error interrupt handler
 ***********************************************************************/
 void I2C_err_intrpt_handler (I2C_Handle_t *I2CxHandlePtr)
 {
+	if(I2CxHandlePtr->State == I2C_BUSY_IN_QUEUE){
+		I2C_queue_err_handler(I2CxHandlePtr);
+		return;
+	}
+	
 	/*case interrupt triggered by bus error*/
 	if(I2CxHandlePtr->I2CxPtr->SR1 & I2C_SR1_BERR){
 		I2CxHandlePtr->I2CxPtr->SR1 &= ~(I2C_SR1_BERR);
@@ -475,6 +499,10 @@ I2C event interrupt handler
 ***********************************************************************/
 void I2C_event_intrpt_handler (I2C_Handle_t *I2CxHandlePtr)
 {
+	if(I2CxHandlePtr->State == I2C_BUSY_IN_QUEUE){
+		I2C_queue_event_handler(I2CxHandlePtr);
+		return;
+	}
 	
 	/*case interrupt is triggered by SB flag (start condition generation is detected)*/
 	/*this block is only executed in master mode*/
@@ -575,10 +603,303 @@ void I2C_event_intrpt_handler (I2C_Handle_t *I2CxHandlePtr)
 	}
 }
 
+/***********************************************************************
+Initialize DMA streams used by transaction queue
+***********************************************************************/
+void I2C_DMA_init(I2C_Handle_t *I2CxHandlePtr)
+{
+	uint8_t index;
+	
+	if(I2CxHandlePtr->I2CxPtr == I2C1){
+		index = 0;
+		I2CxDMATxHandle[index].streamNo = I2C1_DMA_TX_STREAM;
+		I2CxDMARxHandle[index].streamNo = I2C1_DMA_RX_STREAM;
+		I2CxDMATxConfig[index].channel = I2C1_DMA_CHANNEL;
+	}else if(I2CxHandlePtr->I2CxPtr == I2C2){
+		index = 1;
+		I2CxDMATxHandle[index].streamNo = I2C2_DMA_TX_STREAM;
+		I2CxDMARxHandle[index].streamNo = I2C2_DMA_RX_STREAM;
+		I2CxDMATxConfig[index].channel = I2C2_DMA_CHANNEL;
+	}else{
+		index = 2;
+		I2CxDMATxHandle[index].streamNo = I2C3_DMA_TX_STREAM;
+		I2CxDMARxHandle[index].streamNo = I2C3_DMA_RX_STREAM;
+		I2CxDMATxConfig[index].channel = I2C3_DMA_CHANNEL;
+	}
+	
+	/*all I2C requests are on DMA1*/
+	I2CxDMATxHandle[index].DMAxPtr = DMA1;
+	I2CxDMARxHandle[index].DMAxPtr = DMA1;
+	
+	/*transmission: write bytes of transaction to data register, end of transfer is seen by I2C BTF event (only errors interrupt)*/
+	I2CxDMATxConfig[index].direction = DMA_DIR_MEM_TO_PERIPH;
+	I2CxDMATxConfig[index].dataSize = DMA_DATA_SIZE_8BITS;
+	I2CxDMATxConfig[index].memInc = DMA_MEM_INC_EN;
+	I2CxDMATxConfig[index].circular = DMA_CIRCULAR_DIS;
+	I2CxDMATxConfig[index].priority = DMA_PRIORITY_MEDIUM;
+	
+	/*reception: data register to read buffer, stop condition is generated on transfer complete*/
+	I2CxDMARxConfig[index] = I2CxDMATxConfig[index];
+	I2CxDMARxConfig[index].direction = DMA_DIR_PERIPH_TO_MEM;
+	I2CxDMARxConfig[index].priority = DMA_PRIORITY_HIGH;
+	
+	I2CxDMATxHandle[index].DMAxConfigPtr = &I2CxDMATxConfig[index];
+	DMA_init(&I2CxDMATxHandle[index]);
+	DMA_interrupt_ctr(&I2CxDMATxHandle[index],DMA_INTRPT_TE,ENABLE);
+	
+	I2CxDMARxHandle[index].DMAxConfigPtr = &I2CxDMARxConfig[index];
+	DMA_init(&I2CxDMARxHandle[index]);
+	DMA_interrupt_ctr(&I2CxDMARxHandle[index],DMA_INTRPT_TC | DMA_INTRPT_TE,ENABLE);
+	
+	I2CxHandlePtr->DMAxTxHandlePtr = &I2CxDMATxHandle[index];
+	I2CxHandlePtr->DMAxRxHandlePtr = &I2CxDMARxHandle[index];
+	I2CxHandlePtr->queueHead = 0;
+	I2CxHandlePtr->queueTail = 0;
+}
+
+/***********************************************************************
+Queue master transaction (DMA base)
+***********************************************************************/
+uint8_t I2C_queue_transaction(I2C_Handle_t *I2CxHandlePtr, I2C_Transaction_t *TransactionPtr)
+{
+	uint8_t tail = I2CxHandlePtr->queueTail;
+	
+	if(I2CxHandlePtr->State == I2C_BUSY_IN_TX || I2CxHandlePtr->State == I2C_BUSY_IN_RX){
+		return I2C_QUEUE_BUSY;
+	}
+	
+	if((uint8_t)(tail - I2CxHandlePtr->queueHead) >= I2C_QUEUE_SIZE){
+		return I2C_QUEUE_FULL;
+	}
+	
+	I2CxHandlePtr->queuePtr[tail % I2C_QUEUE_SIZE] = TransactionPtr;
+	
+	/*transaction is visible to interrupts only after tail is advanced*/
+	I2CxHandlePtr->queueTail = tail + 1;
+	
+	/*queue is only ready when no transaction is running, so interrupts can not start the same transaction*/
+	if(I2CxHandlePtr->State == I2C_READY){
+		I2C_queue_start_next(I2CxHandlePtr);
+	}
+	
+	return I2C_QUEUE_ACCEPTED;
+}
+
+/***********************************************************************
+Check whether queued transactions are still running
+***********************************************************************/
+uint8_t I2C_queue_busy_check(I2C_Handle_t *I2CxHandlePtr)
+{
+	if(I2CxHandlePtr->State == I2C_BUSY_IN_QUEUE){
+		return TRUE;
+	}
+	
+	return FALSE;
+}
+
+/***********************************************************************
+Interrupt handler for DMA stream used for I2C transmission (transfer error only)
+***********************************************************************/
+void I2C_DMA_TX_intrpt_handler(I2C_Handle_t *I2CxHandlePtr)
+{
+	uint8_t event = DMA_intrpt_handler(I2CxHandlePtr->DMAxTxHandlePtr);
+	
+	if((event & DMA_EV_TRANSFER_ERR) && I2CxHandlePtr->State == I2C_BUSY_IN_QUEUE){
+		I2C_start_stop_generation(I2CxHandlePtr->I2CxPtr,STOP);
+		I2C_queue_finish(I2CxHandlePtr,I2C_TRANSACTION_DMA_ERR);
+	}
+}
+
+/***********************************************************************
+Interrupt handler for DMA stream used for I2C reception
+***********************************************************************/
+void I2C_DMA_RX_intrpt_handler(I2C_Handle_t *I2CxHandlePtr)
+{
+	uint8_t event = DMA_intrpt_handler(I2CxHandlePtr->DMAxRxHandlePtr);
+	
+	if(I2CxHandlePtr->State != I2C_BUSY_IN_QUEUE){
+		return;
+	}
+	
+	if(event & DMA_EV_TRANSFER_ERR){
+		I2C_start_stop_generation(I2CxHandlePtr->I2CxPtr,STOP);
+		I2C_queue_finish(I2CxHandlePtr,I2C_TRANSACTION_DMA_ERR);
+	}else if(event & DMA_EV_TRANSFER_CMPLT){
+		/*last byte was NACKed by hardware (LAST bit), stop condition end the transaction*/
+		I2C_start_stop_generation(I2CxHandlePtr->I2CxPtr,STOP);
+		I2C_queue_finish(I2CxHandlePtr,I2C_TRANSACTION_OK);
+	}
+}
+
+/***********************************************************************
+Private function: Wait until stop condition is sent (STOP bit cleared by hardware), CR1 must not be written before
+***********************************************************************/
+static void I2C_wait_stop_sent(I2C_TypeDef *I2CxPtr)
+{
+	for(uint16_t i = 0; i < I2C_STOP_WAIT_LOOPS && (I2CxPtr->CR1 & I2C_CR1_STOP); i++);
+}
+
+/***********************************************************************
+Private function: Start transaction at head of queue
+***********************************************************************/
+static void I2C_queue_start_next(I2C_Handle_t *I2CxHandlePtr)
+{
+	I2C_Transaction_t *TransactionPtr = I2CxHandlePtr->queuePtr[I2CxHandlePtr->queueHead % I2C_QUEUE_SIZE];
+	
+	I2CxHandlePtr->State = I2C_BUSY_IN_QUEUE;
+	I2CxHandlePtr->phase = (TransactionPtr->txLength || !TransactionPtr->rxLength) ? I2C_PHASE_WRITE : I2C_PHASE_READ;
+	
+	/*event and error interrupts drive transaction, buffer interrupts are only used for 1 byte read*/
+	I2CxHandlePtr->I2CxPtr->CR2 &= ~(I2C_CR2_ITBUFEN | I2C_CR2_DMAEN | I2C_CR2_LAST);
+	I2CxHandlePtr->I2CxPtr->CR2 |= I2C_CR2_ITEVTEN | I2C_CR2_ITERREN;
+	
+	I2C_wait_stop_sent(I2CxHandlePtr->I2CxPtr);
+	
+	/*start condition is held back by hardware while bus is used by other master*/
+	I2C_start_stop_generation(I2CxHandlePtr->I2CxPtr,START);
+}
+
+/***********************************************************************
+Private function: All bytes of write phase were sent, go on with read phase or end transaction
+***********************************************************************/
+static void I2C_queue_end_write_phase(I2C_Handle_t *I2CxHandlePtr)
+{
+	I2C_Transaction_t *TransactionPtr = I2CxHandlePtr->queuePtr[I2CxHandlePtr->queueHead % I2C_QUEUE_SIZE];
+	
+	I2CxHandlePtr->I2CxPtr->CR2 &= ~I2C_CR2_DMAEN;
+	DMA_stop(I2CxHandlePtr->DMAxTxHandlePtr);
+	
+	if(!TransactionPtr->rxLength){
+		I2C_start_stop_generation(I2CxHandlePtr->I2CxPtr,STOP);
+		I2C_queue_finish(I2CxHandlePtr,I2C_TRANSACTION_OK);
+		return;
+	}
+	
+	I2CxHandlePtr->phase = I2C_PHASE_READ;
+	
+	if(TransactionPtr->repeatedStart == I2C_REPEATED_START_DISABLE){
+		I2C_start_stop_generation(I2CxHandlePtr->I2CxPtr,STOP);
+		I2C_wait_stop_sent(I2CxHandlePtr->I2CxPtr);
+	}
+	
+	I2C_start_stop_generation(I2CxHandlePtr->I2CxPtr,START);
+}
+
+/***********************************************************************
+Private function: Remove transaction from queue, start next one then inform application
+***********************************************************************/
+static void I2C_queue_finish(I2C_Handle_t *I2CxHandlePtr, uint8_t result)
+{
+	I2C_Transaction_t *TransactionPtr = I2CxHandlePtr->queuePtr[I2CxHandlePtr->queueHead % I2C_QUEUE_SIZE];
+	
+	I2CxHandlePtr->I2CxPtr->CR2 &= ~(I2C_CR2_ITBUFEN | I2C_CR2_DMAEN | I2C_CR2_LAST);
+	I2CxHandlePtr->queueHead++;
+	
+	if(I2CxHandlePtr->queueHead != I2CxHandlePtr->queueTail){
+		I2C_queue_start_next(I2CxHandlePtr);
+	}else{
+		I2CxHandlePtr->I2CxPtr->CR2 &= ~(I2C_CR2_ITEVTEN | I2C_CR2_ITERREN);
+		I2CxHandlePtr->State = I2C_READY;
+	}
+	
+	if(TransactionPtr->callback != NULL){
+		TransactionPtr->callback(TransactionPtr,result);
+	}
+}
+
+/***********************************************************************
+Private function: I2C event interrupt handler of queued transaction
+***********************************************************************/
+static void I2C_queue_event_handler(I2C_Handle_t *I2CxHandlePtr)
+{
+	I2C_TypeDef *I2CxPtr = I2CxHandlePtr->I2CxPtr;
+	I2C_Transaction_t *TransactionPtr = I2CxHandlePtr->queuePtr[I2CxHandlePtr->queueHead % I2C_QUEUE_SIZE];
+	uint16_t status = I2CxPtr->SR1;
+	
+	/*case start condition sent, SB flag is cleared by writing address to DR*/
+	if(status & I2C_SR1_SB){
+		I2C_address_phase_execute(I2CxPtr,TransactionPtr->slaveAddr,(I2CxHandlePtr->phase == I2C_PHASE_READ) ? READ : WRITE);
+		return;
+	}
+	
+	/*case address acknowledged, DMA must be enabled before ADDR flag is cleared (bus is stretched until then)*/
+	if(status & I2C_SR1_ADDR){
+		if(I2CxHandlePtr->phase == I2C_PHASE_WRITE){
+			if(TransactionPtr->txLength){
+				DMA_start(I2CxHandlePtr->DMAxTxHandlePtr,(uint32_t)(uintptr_t)&I2CxPtr->DR,(uint32_t)(uintptr_t)TransactionPtr->txBufferPtr,TransactionPtr->txLength);
+				I2CxPtr->CR2 |= I2C_CR2_DMAEN;
+				I2C_clear_ADDRflag(I2CxHandlePtr);
+			}else{
+				I2C_clear_ADDRflag(I2CxHandlePtr);
+				I2C_queue_end_write_phase(I2CxHandlePtr);
+			}
+		}else if(TransactionPtr->rxLength == 1){
+			/*1 byte: NACK and stop are set up before ADDR is cleared, byte is read on RXNE (DMA can not NACK a single byte)*/
+			I2C_ACK_ctr(I2CxPtr,DISABLE);
+			I2C_clear_ADDRflag(I2CxHandlePtr);
+			I2C_start_stop_generation(I2CxPtr,STOP);
+			I2CxPtr->CR2 |= I2C_CR2_ITBUFEN;
+		}else{
+			/*LAST make hardware NACK byte which complete DMA transfer*/
+			I2C_ACK_ctr(I2CxPtr,ENABLE);
+			DMA_start(I2CxHandlePtr->DMAxRxHandlePtr,(uint32_t)(uintptr_t)&I2CxPtr->DR,(uint32_t)(uintptr_t)TransactionPtr->rxBufferPtr,TransactionPtr->rxLength);
+			I2CxPtr->CR2 |= I2C_CR2_DMAEN | I2C_CR2_LAST;
+			I2C_clear_ADDRflag(I2CxHandlePtr);
+		}
+		return;
+	}
+	
+	/*case last byte of write phase shifted out (BTF is cleared by start or stop condition)*/
+	if((status & I2C_SR1_BTF) && I2CxHandlePtr->phase == I2C_PHASE_WRITE && !DMA_get_remaining(I2CxHandlePtr->DMAxTxHandlePtr)){
+		I2C_queue_end_write_phase(I2CxHandlePtr);
+		return;
+	}
+	
+	/*case single byte of read phase received*/
+	if((status & I2C_SR1_RXNE) && I2CxHandlePtr->phase == I2C_PHASE_READ && TransactionPtr->rxLength == 1){
+		TransactionPtr->rxBufferPtr[0] = I2CxPtr->DR;
+		I2C_queue_finish(I2CxHandlePtr,I2C_TRANSACTION_OK);
+	}
+}
+
+/***********************************************************************
+Private function: I2C error interrupt handler of queued transaction
+@Note: after arbitration loss interface is already back in slave mode, no stop condition is generated
+***********************************************************************/
+static void I2C_queue_err_handler(I2C_Handle_t *I2CxHandlePtr)
+{
+	I2C_TypeDef *I2CxPtr = I2CxHandlePtr->I2CxPtr;
+	uint16_t status = I2CxPtr->SR1;
+	uint8_t result;
+	
+	if(status & I2C_SR1_AF){
+		I2CxPtr->SR1 &= ~(I2C_SR1_AF);
+		I2C_start_stop_generation(I2CxPtr,STOP);
+		result = I2C_TRANSACTION_NACK;
+	}else if(status & I2C_SR1_ARLO){
+		I2CxPtr->SR1 &= ~(I2C_SR1_ARLO);
+		result = I2C_TRANSACTION_ARLO;
+	}else if(status & I2C_SR1_BERR){
+		I2CxPtr->SR1 &= ~(I2C_SR1_BERR);
+		I2C_start_stop_generation(I2CxPtr,STOP);
+		result = I2C_TRANSACTION_BERR;
+	}else{
+		/*overrun and timeout only happen in slave and SMBus modes*/
+		I2CxPtr->SR1 &= ~(I2C_SR1_OVR | I2C_SR1_TIMEOUT);
+		return;
+	}
+	
+	DMA_stop(I2CxHandlePtr->DMAxTxHandlePtr);
+	DMA_stop(I2CxHandlePtr->DMAxRxHandlePtr);
+	I2C_queue_finish(I2CxHandlePtr,result);
+}
+
 /***********************************************************************
 inform application of I2C event or error
 @Note: this is to be define in user application
 ***********************************************************************/
 __attribute__((weak)) void I2C_application_event_callback (I2C_Handle_t *I2CxHandlePtr,uint8_t event) 
 {
+	(void)I2CxHandlePtr;
+	(void)event;
 }
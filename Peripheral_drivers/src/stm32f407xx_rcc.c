@@ -15,11 +15,24 @@ void	RCC_HSI_clock_ctrl (uint8_t enOrDis);
 void	RCC_HSE_clock_ctrl (uint8_t enOrDis);
 void	RCC_PLL_clock_ctrl (uint8_t enOrDis);
 void PWR_set_scale_mode (void);
-void FLASH_set_latency (void);
-void RCC_set_PLL_84_MHz (void);
+void FLASH_set_latency (uint8_t latency, uint32_t flashAccel);
+void RCC_set_PLL (const RCC_Clock_Profile_t *ProfilePtr);
 int32_t RCC_get_PLL_output (void);
 void RCC_delay( volatile uint32_t delay);
 
+/*
+*Clock profiles, VCO input is 2 MHz (HSE/4) in every profile for lowest PLL jitter.
+*Flash wait states follow RM0090 table 10 (2.7V to 3.6V): one wait state per 30 MHz of HCLK.
+*/
+const RCC_Clock_Profile_t RCC_clockProfile[RCC_NUM_OF_PROFILES] = {
+	/*84 MHz: VCO 336 MHz, APB1 21 MHz, APB2 42 MHz*/
+	{84000000,4,168,4,7,RCC_APB_DIV4,RCC_APB_DIV2,2,FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN},
+	/*120 MHz: VCO 240 MHz, APB1 30 MHz, APB2 60 MHz*/
+	{120000000,4,120,2,5,RCC_APB_DIV4,RCC_APB_DIV2,3,FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN},
+	/*168 MHz: VCO 336 MHz, APB1 42 MHz, APB2 84 MHz*/
+	{168000000,4,168,2,7,RCC_APB_DIV4,RCC_APB_DIV2,5,FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN},
+};
+
 /***********************************************************************
 Configure MCO2 for clock measurement
 ***********************************************************************/
@@ -77,32 +90,46 @@ Set system clock as PLL 84 MHz
 ***********************************************************************/
 void RCC_set_SYSCLK_PLL_84_MHz (void)
 {	
+	RCC_set_SYSCLK_profile(RCC_PROFILE_84_MHZ);
+}
+
+/***********************************************************************
+Set system clock as PLL with a clock profile
+***********************************************************************/
+void RCC_set_SYSCLK_profile (uint8_t profile)
+{
+	const RCC_Clock_Profile_t *ProfilePtr;
+	
+	if(profile >= RCC_NUM_OF_PROFILES){
+		return;
+	}
+	ProfilePtr = &RCC_clockProfile[profile];
+	
 	/*set voltage scale mode to mode 1*/
 	PWR_set_scale_mode ();
 	
-	/*set flash latency to 2 wait state*/
-	FLASH_set_latency();
+	/*run from HSE (8 MHz, any flash latency is enough) while flash and PLL are reprogrammed, so that latency is never too low
+	whether clock goes up or down*/
+	RCC_set_SYSCLK_HSE();
+	
+	FLASH_set_latency(ProfilePtr->flashLatency,ProfilePtr->flashAccel);
 	
-	/*set AHB division factor as 1, APB2 division factor as 1, APB1 division factor as 2 so that AHB clock is 84Mhz, APB1 clock is 42Mhz, APB2  clock is 84 Mhz*/
+	/*set AHB division factor as 1, APB1 and APB2 division factors of profile*/
 	RCC->CFGR &= ~(RCC_CFGR_HPRE);
 	
 	RCC->CFGR &= ~(RCC_CFGR_PPRE2);
-	RCC->CFGR |= RCC_APB_DIV2 << RCC_CFGR_PPRE2_Pos;
+	RCC->CFGR |= ProfilePtr->APB2div << RCC_CFGR_PPRE2_Pos;
 	
 	RCC->CFGR &= ~(RCC_CFGR_PPRE1);
-	RCC->CFGR |= RCC_APB_DIV4 << RCC_CFGR_PPRE1_Pos;
+	RCC->CFGR |= ProfilePtr->APB1div << RCC_CFGR_PPRE1_Pos;
 	
-	/*set PLL as 84 Mhz*/
-	RCC_set_PLL_84_MHz();
+	RCC_set_PLL(ProfilePtr);
 		
 	/*select PLL as system clock*/
 	RCC->CFGR &= ~(RCC_CFGR_SW);
 	RCC->CFGR |= RCC_SYSCLK_PLL << RCC_CFGR_SW_Pos;
 	
 	while (((RCC->CFGR & RCC_CFGR_SWS) >> RCC_CFGR_SWS_Pos) != RCC_SYSCLK_PLL);
-	
-	/*turn of HSI*/
-	RCC_HSI_clock_ctrl (DISABLE);
 }
 
 /***********************************************************************
@@ -166,6 +193,96 @@ int32_t RCC_get_PCLK_value(uint8_t APBx)
 	return PCLK;
 }
 
+/***********************************************************************
+Get clock value of timers on APB bus  
+***********************************************************************/
+int32_t RCC_get_TIMCLK_value(uint8_t APBx)
+{
+	int32_t PCLK = RCC_get_PCLK_value(APBx);
+	uint8_t APBdivStatus;
+	
+	if(APBx == APB1){
+		APBdivStatus = (RCC->CFGR >> RCC_CFGR_PPRE1_Pos)	& 0x07;
+	}else{
+		APBdivStatus = (RCC->CFGR >> RCC_CFGR_PPRE2_Pos)	& 0x07;
+	}
+	
+	if(PCLK == -1){
+		return -1;
+	}
+	
+	/*timers are clocked at twice APB clock when APB is divided*/
+	if(APBdivStatus <= 3){
+		return PCLK;
+	}
+	
+	return 2*PCLK;
+}
+
+/***********************************************************************
+Compute timer prescaler and auto reload value for an update rate
+***********************************************************************/
+uint8_t RCC_get_TIM_period(uint32_t timerClock, uint32_t rate, uint16_t *prescalerPtr, uint16_t *reloadPtr)
+{
+	uint32_t period = timerClock/rate;
+	uint32_t minPrescaler, prescaler;
+	
+	if(period == 0){
+		period = 1;
+	}
+	
+	/*smallest prescaler leaving reload in 16 bits, then first one dividing period*/
+	minPrescaler = period/0x10000 + ((period % 0x10000) ? 1 : 0);
+	for(prescaler = minPrescaler; prescaler <= 0x10000; prescaler++){
+		if(period % prescaler == 0){
+			break;
+		}
+	}
+	
+	if(prescaler > 0x10000){
+		prescaler = minPrescaler;
+	}
+	
+	*prescalerPtr = (uint16_t)(prescaler - 1);
+	*reloadPtr = (uint16_t)(period/prescaler - 1);
+	
+	if(timerClock % rate == 0 && period % prescaler == 0){
+		return TRUE;
+	}
+	
+	return FALSE;
+}
+
+/***********************************************************************
+Compute SPI baud rate prescaler giving fastest serial clock not above a maximum
+***********************************************************************/
+uint8_t RCC_get_SPI_prescaler(uint32_t PCLK, uint32_t maxSCLK)
+{
+	uint8_t baudRate = 0;
+	
+	/*serial clock is PCLK/2^(baudRate+1)*/
+	while(baudRate < 7 && (PCLK >> (baudRate + 1)) > maxSCLK){
+		baudRate++;
+	}
+	
+	return baudRate;
+}
+
+/***********************************************************************
+Compute ADC prescaler keeping ADC clock not above RCC_MAX_ADCCLK
+***********************************************************************/
+uint8_t RCC_get_ADC_prescaler(uint32_t PCLK2)
+{
+	uint8_t ADCprescaler = 0;
+	
+	/*ADC clock is PCLK2/(2*(ADCprescaler+1))*/
+	while(ADCprescaler < 3 && PCLK2/(2*(ADCprescaler + 1)) > RCC_MAX_ADCCLK){
+		ADCprescaler++;
+	}
+	
+	return ADCprescaler;
+}
+
 /***********************************************************************
 Private function:enable/disable HSI clock
 ***********************************************************************/
@@ -202,6 +319,7 @@ void RCC_PLL_clock_ctrl (uint8_t enOrDis)
 		while (!(RCC->CR & RCC_CR_PLLRDY));
 	}else if (enOrDis == DISABLE){
 		RCC->CR &= ~RCC_CR_PLLON;
+		while (RCC->CR & RCC_CR_PLLRDY);
 	}
 }
 
@@ -210,46 +328,55 @@ Private function:set voltage scale mode to mode 1
 ***********************************************************************/
 void PWR_set_scale_mode (void)
 {
+	/*PWR registers are only written while its clock is on*/
+	RCC->APB1ENR |= RCC_APB1ENR_PWREN;
 	PWR->CR |= PWR_CR_VOS;
 }
 
 
 /***********************************************************************
-Private function:set Flash latency (in case of increasing system clock)
+Private function:set Flash latency, prefetch buffer and caches
+@note caches may only be reset while disabled, they are flushed so that no line read before change is kept
 ***********************************************************************/
-void FLASH_set_latency (void)
+void FLASH_set_latency (uint8_t latency, uint32_t flashAccel)
 {
-	FLASH->ACR &= ~(0x07 << FLASH_ACR_LATENCY_Pos);
-	FLASH->ACR |= FLASH_ACR_LATENCY_7WS;
+	FLASH->ACR &= ~(FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN);
+	FLASH->ACR |= FLASH_ACR_ICRST | FLASH_ACR_DCRST;
+	FLASH->ACR &= ~(FLASH_ACR_ICRST | FLASH_ACR_DCRST);
+	
+	FLASH->ACR &= ~(FLASH_ACR_LATENCY);
+	FLASH->ACR |= latency << FLASH_ACR_LATENCY_Pos;
+	
+	/*new latency must be in effect before clock goes up*/
+	while(((FLASH->ACR & FLASH_ACR_LATENCY) >> FLASH_ACR_LATENCY_Pos) != latency);
 
-	FLASH->ACR |= FLASH_ACR_DCEN;
-//	FLASH->ACR |= FLASH_ACR_ICEN;
-//	FLASH->ACR |= FLASH_ACR_PRFTEN;
+	FLASH->ACR |= flashAccel & (FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN);
 }
 
 /***********************************************************************
-Private function:configure PLL as 168 MHz and turn PLL on
+Private function:configure PLL with factors of clock profile and turn PLL on
+@note PLL must not be system clock
 ***********************************************************************/
-void RCC_set_PLL_84_MHz (void)
+void RCC_set_PLL (const RCC_Clock_Profile_t *ProfilePtr)
 {
 		/*turn on HSE*/
 	RCC_HSE_clock_ctrl (ENABLE);
 	
-	/*select HSE as PLL input, turn off PLL, and program PLL 's division factors to achieve 84Mhz*/
+	/*turn off PLL, select HSE as PLL input and program PLL 's division factors*/
+	RCC_PLL_clock_ctrl (DISABLE);
 	RCC->PLLCFGR |= RCC_PLLCFGR_PLLSRC;
-	RCC->CR &= ~RCC_CR_PLLON;
 	
 	RCC->PLLCFGR &= ~(RCC_PLLCFGR_PLLM);
-	RCC->PLLCFGR |= RCC_PLL_84_VCO_INPUT_DIV << RCC_PLLCFGR_PLLM_Pos;
+	RCC->PLLCFGR |= ProfilePtr->PLLM << RCC_PLLCFGR_PLLM_Pos;
 
 	RCC->PLLCFGR &= ~(RCC_PLLCFGR_PLLN);
-	RCC->PLLCFGR |= RCC_PLL_84_VCO_OUTPUT_MUL << RCC_PLLCFGR_PLLN_Pos;
+	RCC->PLLCFGR |= ProfilePtr->PLLN << RCC_PLLCFGR_PLLN_Pos;
 
 	RCC->PLLCFGR &= ~(RCC_PLLCFGR_PLLP);
-	RCC->PLLCFGR |= RCC_PLL_84_PLL_OUTPUT_DIV << RCC_PLLCFGR_PLLP_Pos;	
+	RCC->PLLCFGR |= (ProfilePtr->PLLP/2 - 1) << RCC_PLLCFGR_PLLP_Pos;	
 	
 	RCC->PLLCFGR &= ~(RCC_PLLCFGR_PLLQ);
-	RCC->PLLCFGR |= RCC_PLL_84_MAIN_PLL_DIV << RCC_PLLCFGR_PLLQ_Pos;	
+	RCC->PLLCFGR |= ProfilePtr->PLLQ << RCC_PLLCFGR_PLLQ_Pos;	
 	
 	/*turn on PLL*/
 	RCC_PLL_clock_ctrl (ENABLE);
@@ -20,6 +20,9 @@ static void SPI_data_frame_config(SPI_TypeDef *SPIxPtr, uint8_t dataFrame);
 static void SPI_close_transmission(SPI_Handle_t *SPIxHandlePtr);
 static void SPI_close_reception(SPI_Handle_t *SPIxHandlePtr);
 
+static DMA_Handle_t SPIxDMATxHandle[3];
+static DMA_Config_t SPIxDMATxConfig[3];
+
 
 /***********************************************************************
 SPI clock enable/disable
@@ -261,7 +264,123 @@ void SPI_send_16_bits(SPI_TypeDef *SPIxPtr, uint16_t data)
 	while(!(SPIxPtr->SR & SPI_SR_TXE));
 	SPIxPtr->DR = data;
 }
+
+/***********************************************************************
+Send multiple half-words (16 bits) through SPI using 16 bits data frame configuration 
+***********************************************************************/
+void SPI_send_data_16_bits(SPI_TypeDef *SPIxPtr, const uint16_t *txBufferPtr, uint32_t count)
+{
+	SPI_data_frame_config(SPIxPtr,SPI_DATA_16BITS);
+	
+	while(count > 0){
+		/* wait until tx buffer is empty*/
+		while(!(SPIxPtr->SR & SPI_SR_TXE));
+		SPIxPtr->DR = *txBufferPtr;
+		txBufferPtr++;
+		count--;
+	}
+	
+	/*wait until last half-word is shifted out*/
+	while(!(SPIxPtr->SR & SPI_SR_TXE));
+	while(SPIxPtr->SR & SPI_SR_BSY);
+}
+	
+/***********************************************************************
+Initialize DMA stream used for SPI transmission
+***********************************************************************/
+void SPI_DMA_TX_init(SPI_Handle_t *SPIxHandlePtr)
+{
+	uint8_t index;
+	DMA_Handle_t *DMAxHandlePtr;
+	DMA_Config_t *DMAxConfigPtr;
+	
+	if(SPIxHandlePtr->SPIxPtr == SPI1){
+		index = 0;
+		SPIxDMATxHandle[index].DMAxPtr = SPI1_DMA_TX_CONTROLLER;
+		SPIxDMATxHandle[index].streamNo = SPI1_DMA_TX_STREAM;
+		SPIxDMATxConfig[index].channel = SPI1_DMA_TX_CHANNEL;
+	}else if(SPIxHandlePtr->SPIxPtr == SPI2){
+		index = 1;
+		SPIxDMATxHandle[index].DMAxPtr = SPI2_DMA_TX_CONTROLLER;
+		SPIxDMATxHandle[index].streamNo = SPI2_DMA_TX_STREAM;
+		SPIxDMATxConfig[index].channel = SPI2_DMA_TX_CHANNEL;
+	}else{
+		index = 2;
+		SPIxDMATxHandle[index].DMAxPtr = SPI3_DMA_TX_CONTROLLER;
+		SPIxDMATxHandle[index].streamNo = SPI3_DMA_TX_STREAM;
+		SPIxDMATxConfig[index].channel = SPI3_DMA_TX_CHANNEL;
+	}
+	
+	DMAxHandlePtr = &SPIxDMATxHandle[index];
+	DMAxConfigPtr = &SPIxDMATxConfig[index];
+	
+	DMAxConfigPtr->direction = DMA_DIR_MEM_TO_PERIPH;
+	DMAxConfigPtr->dataSize = DMA_DATA_SIZE_8BITS;
+	DMAxConfigPtr->memInc = DMA_MEM_INC_EN;
+	DMAxConfigPtr->circular = DMA_CIRCULAR_DIS;
+	DMAxConfigPtr->priority = DMA_PRIORITY_MEDIUM;
+	
+	DMAxHandlePtr->DMAxConfigPtr = DMAxConfigPtr;
+	DMA_init(DMAxHandlePtr);
+	DMA_interrupt_ctr(DMAxHandlePtr,DMA_INTRPT_TC | DMA_INTRPT_TE,ENABLE);
+	
+	SPIxHandlePtr->DMAxTxHandlePtr = DMAxHandlePtr;
+}
+
+/***********************************************************************
+Send multiple data frames through SPI (DMA base)
+***********************************************************************/
+uint8_t SPI_send_data_DMA(SPI_Handle_t *SPIxHandlePtr, const void *txBufferPtr, uint16_t count, uint8_t dataFrame, uint8_t memInc)
+{
+	uint8_t state = SPIxHandlePtr->txState;
+	
+	if(state != SPI_STATE_TX_BUSY){
+		SPIxHandlePtr->txState = SPI_STATE_TX_BUSY;
+		
+		SPI_data_frame_config(SPIxHandlePtr->SPIxPtr,dataFrame);
+		
+		DMA_set_data_size(SPIxHandlePtr->DMAxTxHandlePtr,(dataFrame == SPI_DATA_16BITS) ? DMA_DATA_SIZE_16BITS : DMA_DATA_SIZE_8BITS);
+		DMA_mem_inc_ctr(SPIxHandlePtr->DMAxTxHandlePtr,memInc);
+		DMA_start(SPIxHandlePtr->DMAxTxHandlePtr,(uint32_t)(uintptr_t)&SPIxHandlePtr->SPIxPtr->DR,(uint32_t)(uintptr_t)txBufferPtr,count);
+		
+		/*SPI request DMA whenever tx buffer is empty*/
+		SPIxHandlePtr->SPIxPtr->CR2 |= SPI_CR2_TXDMAEN;
+	}
+	
+	return state;
+}
+
+/***********************************************************************
+Check whether DMA transmission is still ongoing
+***********************************************************************/
+uint8_t SPI_DMA_TX_busy_check(SPI_Handle_t *SPIxHandlePtr)
+{
+	if(SPIxHandlePtr->txState == SPI_STATE_TX_BUSY){
+		return TRUE;
+	}
+	
+	/*last data frame may still be shifting out after DMA transfer complete*/
+	if(!(SPIxHandlePtr->SPIxPtr->SR & SPI_SR_TXE) || (SPIxHandlePtr->SPIxPtr->SR & SPI_SR_BSY)){
+		return TRUE;
+	}
+	
+	return FALSE;
+}
+
+/***********************************************************************
+Interrupt handler for DMA stream used for SPI transmission
+***********************************************************************/
+void SPI_DMA_TX_intrpt_handler(SPI_Handle_t *SPIxHandlePtr)
+{
+	uint8_t event = DMA_intrpt_handler(SPIxHandlePtr->DMAxTxHandlePtr);
 	
+	if(event & (DMA_EV_TRANSFER_CMPLT | DMA_EV_TRANSFER_ERR)){
+		SPIxHandlePtr->SPIxPtr->CR2 &= ~SPI_CR2_TXDMAEN;
+		SPIxHandlePtr->txState = SPI_STATE_READY;
+		SPI_application_event_callback(SPIxHandlePtr,SPI_EV_DMA_TRANSMISSION_CMPLT);
+	}
+}
+
 /***********************************************************************
 Receive multiple bytes from SPI (interrup base) 
 ***********************************************************************/
@@ -468,6 +587,15 @@ Private function: Configure data frame format at run time
 ***********************************************************************/
 void SPI_data_frame_config(SPI_TypeDef *SPIxPtr, uint8_t dataFrame)
 {			
+		/*nothing to do if data frame format is already as requested*/
+		if(((SPIxPtr->CR1 & SPI_CR1_DFF) ? SPI_DATA_16BITS : SPI_DATA_8BITS) == dataFrame){
+			return;
+		}
+		
+		/*wait for ongoing frame to be shifted out before disabling peripheral*/
+		while(!(SPIxPtr->SR & SPI_SR_TXE));
+		while(SPIxPtr->SR & SPI_SR_BSY);
+		
 		SPI_periph_ctr(SPIxPtr,DISABLE);
 		
 		if(dataFrame == SPI_DATA_8BITS){
@@ -174,14 +174,15 @@ void TIM_intrpt_vector_ctr (uint8_t IRQnumber, uint8_t enOrDis)
 			NVIC->ISER[2] |= (1<<(IRQnumber%64));
 		}
 	}else{
+		/*ICER is written, not read back: reading return every enabled interrupt and writing them back would disable them all*/
 		if(IRQnumber <= 31){
-			NVIC->ICER[0] |= (1<<IRQnumber);
+			NVIC->ICER[0] = (1<<IRQnumber);
 		}
 		else if(IRQnumber > 31 && IRQnumber <= 63){
-			NVIC->ICER[1] |= (1<<(IRQnumber%32));
+			NVIC->ICER[1] = (1<<(IRQnumber%32));
 		}
 		else if(IRQnumber > 63 && IRQnumber <= 95){
-			NVIC->ICER[2] |= (1<<(IRQnumber%64));
+			NVIC->ICER[2] = (1<<(IRQnumber%64));
 		}
 	}
 }
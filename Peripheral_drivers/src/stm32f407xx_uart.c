@@ -18,6 +18,13 @@ static uint16_t USARTDIV_integer_part_calc (uint32_t periphCLK, uint32_t baudRat
 static void UART_pins_pack_1_gpio_init(USART_TypeDef *UARTxPtr);
 static void UART_pins_pack_2_gpio_init(USART_TypeDef *UARTxPtr);
 static void UART_pins_pack_3_gpio_init(USART_TypeDef *UARTxPtr);
+static void UART_DMA_TX_start_next(UART_Handle_t *UARTxHandlePtr);
+static void UART_DMA_RX_deliver(UART_Handle_t *UARTxHandlePtr, uint8_t endOfFrame);
+
+static DMA_Handle_t UARTxDMATxHandle[6];
+static DMA_Config_t UARTxDMATxConfig[6];
+static DMA_Handle_t UARTxDMARxHandle[6];
+static DMA_Config_t UARTxDMARxConfig[6];
 
 /***********************************************************************
 UART clock enable/disable
@@ -426,6 +433,215 @@ void UART_intrpt_handler (UART_Handle_t *UARTxHandlePtr)
 			UART_application_event_callback(UARTxHandlePtr,UART_EV_RX_COMPLETE);
 		}
 	}
+	
+	/*case interrupt triggered by IDLE (line idle after frame received by DMA)*/
+	check1 = UARTxHandlePtr->UARTxPtr->SR & USART_SR_IDLE;
+	check2 = UARTxHandlePtr->UARTxPtr->CR1 & USART_CR1_IDLEIE;
+	
+	if(check1 & check2){
+		/*IDLE flag is cleared by reading SR (done above) then DR*/
+		(void)UARTxHandlePtr->UARTxPtr->DR;
+		UART_DMA_RX_deliver(UARTxHandlePtr,TRUE);
+	}
+}
+
+/***********************************************************************
+Initialize DMA streams used for UART transmission and reception
+***********************************************************************/
+void UART_DMA_init(UART_Handle_t *UARTxHandlePtr)
+{
+	uint8_t index;
+	
+	if(UARTxHandlePtr->UARTxPtr == USART1){
+		index = 0;
+		UARTxDMATxHandle[index].DMAxPtr = USART1_DMA_TX_CONTROLLER;
+		UARTxDMATxHandle[index].streamNo = USART1_DMA_TX_STREAM;
+		UARTxDMARxHandle[index].DMAxPtr = USART1_DMA_RX_CONTROLLER;
+		UARTxDMARxHandle[index].streamNo = USART1_DMA_RX_STREAM;
+		UARTxDMATxConfig[index].channel = USART1_DMA_CHANNEL;
+	}else if(UARTxHandlePtr->UARTxPtr == USART2){
+		index = 1;
+		UARTxDMATxHandle[index].DMAxPtr = USART2_DMA_TX_CONTROLLER;
+		UARTxDMATxHandle[index].streamNo = USART2_DMA_TX_STREAM;
+		UARTxDMARxHandle[index].DMAxPtr = USART2_DMA_RX_CONTROLLER;
+		UARTxDMARxHandle[index].streamNo = USART2_DMA_RX_STREAM;
+		UARTxDMATxConfig[index].channel = USART2_DMA_CHANNEL;
+	}else if(UARTxHandlePtr->UARTxPtr == USART3){
+		index = 2;
+		UARTxDMATxHandle[index].DMAxPtr = USART3_DMA_TX_CONTROLLER;
+		UARTxDMATxHandle[index].streamNo = USART3_DMA_TX_STREAM;
+		UARTxDMARxHandle[index].DMAxPtr = USART3_DMA_RX_CONTROLLER;
+		UARTxDMARxHandle[index].streamNo = USART3_DMA_RX_STREAM;
+		UARTxDMATxConfig[index].channel = USART3_DMA_CHANNEL;
+	}else if(UARTxHandlePtr->UARTxPtr == UART4){
+		index = 3;
+		UARTxDMATxHandle[index].DMAxPtr = UART4_DMA_TX_CONTROLLER;
+		UARTxDMATxHandle[index].streamNo = UART4_DMA_TX_STREAM;
+		UARTxDMARxHandle[index].DMAxPtr = UART4_DMA_RX_CONTROLLER;
+		UARTxDMARxHandle[index].streamNo = UART4_DMA_RX_STREAM;
+		UARTxDMATxConfig[index].channel = UART4_DMA_CHANNEL;
+	}else if(UARTxHandlePtr->UARTxPtr == UART5){
+		index = 4;
+		UARTxDMATxHandle[index].DMAxPtr = UART5_DMA_TX_CONTROLLER;
+		UARTxDMATxHandle[index].streamNo = UART5_DMA_TX_STREAM;
+		UARTxDMARxHandle[index].DMAxPtr = UART5_DMA_RX_CONTROLLER;
+		UARTxDMARxHandle[index].streamNo = UART5_DMA_RX_STREAM;
+		UARTxDMATxConfig[index].channel = UART5_DMA_CHANNEL;
+	}else{
+		index = 5;
+		UARTxDMATxHandle[index].DMAxPtr = USART6_DMA_TX_CONTROLLER;
+		UARTxDMATxHandle[index].streamNo = USART6_DMA_TX_STREAM;
+		UARTxDMARxHandle[index].DMAxPtr = USART6_DMA_RX_CONTROLLER;
+		UARTxDMARxHandle[index].streamNo = USART6_DMA_RX_STREAM;
+		UARTxDMATxConfig[index].channel = USART6_DMA_CHANNEL;
+	}
+	
+	/*transmission: one buffer at a time, memory to data register*/
+	UARTxDMATxConfig[index].direction = DMA_DIR_MEM_TO_PERIPH;
+	UARTxDMATxConfig[index].dataSize = DMA_DATA_SIZE_8BITS;
+	UARTxDMATxConfig[index].memInc = DMA_MEM_INC_EN;
+	UARTxDMATxConfig[index].circular = DMA_CIRCULAR_DIS;
+	UARTxDMATxConfig[index].priority = DMA_PRIORITY_MEDIUM;
+	
+	/*reception: data register to circular buffer, higher priority as received data is lost when it wait too long*/
+	UARTxDMARxConfig[index] = UARTxDMATxConfig[index];
+	UARTxDMARxConfig[index].direction = DMA_DIR_PERIPH_TO_MEM;
+	UARTxDMARxConfig[index].circular = DMA_CIRCULAR_EN;
+	UARTxDMARxConfig[index].priority = DMA_PRIORITY_HIGH;
+	
+	UARTxDMATxHandle[index].DMAxConfigPtr = &UARTxDMATxConfig[index];
+	DMA_init(&UARTxDMATxHandle[index]);
+	DMA_interrupt_ctr(&UARTxDMATxHandle[index],DMA_INTRPT_TC | DMA_INTRPT_TE,ENABLE);
+	
+	UARTxDMARxHandle[index].DMAxConfigPtr = &UARTxDMARxConfig[index];
+	DMA_init(&UARTxDMARxHandle[index]);
+	DMA_interrupt_ctr(&UARTxDMARxHandle[index],DMA_INTRPT_HT | DMA_INTRPT_TC | DMA_INTRPT_TE,ENABLE);
+	
+	UARTxHandlePtr->DMAxTxHandlePtr = &UARTxDMATxHandle[index];
+	UARTxHandlePtr->DMAxRxHandlePtr = &UARTxDMARxHandle[index];
+	UARTxHandlePtr->txQueueHead = 0;
+	UARTxHandlePtr->txQueueTail = 0;
+}
+
+/***********************************************************************
+UART send data (DMA base)
+***********************************************************************/
+uint8_t UART_send_DMA(UART_Handle_t *UARTxHandlePtr, const uint8_t *txBufferPtr, uint16_t Length)
+{
+	uint8_t tail = UARTxHandlePtr->txQueueTail;
+	
+	if((uint8_t)(tail - UARTxHandlePtr->txQueueHead) >= UART_DMA_TX_QUEUE_SIZE){
+		return UART_STATE_TX_BUSY;
+	}
+	
+	if(!Length){
+		return UART_STATE_READY;
+	}
+	
+	UARTxHandlePtr->txQueueBufferPtr[tail % UART_DMA_TX_QUEUE_SIZE] = txBufferPtr;
+	UARTxHandlePtr->txQueueLength[tail % UART_DMA_TX_QUEUE_SIZE] = Length;
+	
+	/*buffer is visible to DMA interrupt only after tail is advanced*/
+	UARTxHandlePtr->txQueueTail = tail + 1;
+	
+	/*transmitter is only ready when DMA is stopped, so DMA interrupt can not start the same buffer*/
+	if(UARTxHandlePtr->txState == UART_STATE_READY){
+		UARTxHandlePtr->UARTxPtr->SR &= ~USART_SR_TC;
+		UART_DMA_TX_start_next(UARTxHandlePtr);
+	}
+	
+	return UART_STATE_READY;
+}
+
+/***********************************************************************
+Check whether DMA transmission is still ongoing
+***********************************************************************/
+uint8_t UART_DMA_TX_busy_check(UART_Handle_t *UARTxHandlePtr)
+{
+	if(UARTxHandlePtr->txState == UART_STATE_TX_BUSY){
+		return TRUE;
+	}
+	
+	/*last data frame may still be shifting out after DMA transfer complete*/
+	if(!(UARTxHandlePtr->UARTxPtr->SR & USART_SR_TC)){
+		return TRUE;
+	}
+	
+	return FALSE;
+}
+
+/***********************************************************************
+Interrupt handler for DMA stream used for UART transmission
+***********************************************************************/
+void UART_DMA_TX_intrpt_handler(UART_Handle_t *UARTxHandlePtr)
+{
+	uint8_t event = DMA_intrpt_handler(UARTxHandlePtr->DMAxTxHandlePtr);
+	
+	if(event & (DMA_EV_TRANSFER_CMPLT | DMA_EV_TRANSFER_ERR)){
+		UARTxHandlePtr->txQueueHead++;
+		
+		/*next buffer is started before informing application, so that line does not stay idle*/
+		if(UARTxHandlePtr->txQueueHead != UARTxHandlePtr->txQueueTail){
+			UART_DMA_TX_start_next(UARTxHandlePtr);
+		}else{
+			UARTxHandlePtr->UARTxPtr->CR3 &= ~USART_CR3_DMAT;
+			UARTxHandlePtr->txState = UART_STATE_READY;
+		}
+		
+		UART_application_event_callback(UARTxHandlePtr,UART_EV_DMA_TX_SENT);
+	}
+}
+
+/***********************************************************************
+UART receive data continuously into circular buffer (DMA base)
+***********************************************************************/
+uint8_t UART_receive_DMA(UART_Handle_t *UARTxHandlePtr, uint8_t *rxRingPtr, uint16_t size)
+{
+	uint8_t state = UARTxHandlePtr->rxState;
+	if(state == UART_STATE_READY){
+		UARTxHandlePtr->rxRingPtr = rxRingPtr;
+		UARTxHandlePtr->rxRingSize = size;
+		UARTxHandlePtr->rxReadPos = 0;
+		UARTxHandlePtr->rxState = UART_STATE_RX_BUSY;
+		
+		DMA_start(UARTxHandlePtr->DMAxRxHandlePtr,(uint32_t)(uintptr_t)&UARTxHandlePtr->UARTxPtr->DR,(uint32_t)(uintptr_t)rxRingPtr,size);
+		
+		/*UART request DMA whenever a data frame is received*/
+		UARTxHandlePtr->UARTxPtr->CR3 |= USART_CR3_DMAR;
+		
+		/*clear IDLE flag left from previous reception (read SR then DR)*/
+		(void)UARTxHandlePtr->UARTxPtr->SR;
+		(void)UARTxHandlePtr->UARTxPtr->DR;
+		UARTxHandlePtr->UARTxPtr->CR1 |= USART_CR1_IDLEIE;
+	}
+	return state;
+}
+
+/***********************************************************************
+Stop DMA reception
+***********************************************************************/
+void UART_stop_receive_DMA(UART_Handle_t *UARTxHandlePtr)
+{
+	UARTxHandlePtr->UARTxPtr->CR1 &= ~USART_CR1_IDLEIE;
+	UARTxHandlePtr->UARTxPtr->CR3 &= ~USART_CR3_DMAR;
+	DMA_stop(UARTxHandlePtr->DMAxRxHandlePtr);
+	UARTxHandlePtr->rxRingPtr = NULL;
+	UARTxHandlePtr->rxState = UART_STATE_READY;
+}
+
+/***********************************************************************
+Interrupt handler for DMA stream used for UART reception
+***********************************************************************/
+void UART_DMA_RX_intrpt_handler(UART_Handle_t *UARTxHandlePtr)
+{
+	uint8_t event = DMA_intrpt_handler(UARTxHandlePtr->DMAxRxHandlePtr);
+	
+	if(event & DMA_EV_TRANSFER_ERR){
+		UART_stop_receive_DMA(UARTxHandlePtr);
+		UART_application_event_callback(UARTxHandlePtr,UART_EV_DMA_RX_ERROR);
+	}else if(event & (DMA_EV_HALF_TRANSFER | DMA_EV_TRANSFER_CMPLT)){
+		UART_DMA_RX_deliver(UARTxHandlePtr,FALSE);
+	}
 }
 
 /***********************************************************************
@@ -457,6 +673,57 @@ __attribute__((weak)) void UART_application_event_callback (UART_Handle_t *I2CxH
 {
 }
 
+/***********************************************************************
+give bytes received by DMA to application
+@Note: this is to be define in user application
+***********************************************************************/
+__attribute__((weak)) void UART_DMA_RX_event_callback(UART_Handle_t *UARTxHandlePtr, const uint8_t *dataPtr, uint16_t length, uint8_t endOfFrame)
+{
+}
+
+/***********************************************************************
+Private function: Start DMA transfer of buffer at head of transmission queue
+***********************************************************************/
+static void UART_DMA_TX_start_next(UART_Handle_t *UARTxHandlePtr)
+{
+	uint8_t index = UARTxHandlePtr->txQueueHead % UART_DMA_TX_QUEUE_SIZE;
+	
+	UARTxHandlePtr->txState = UART_STATE_TX_BUSY;
+	DMA_start(UARTxHandlePtr->DMAxTxHandlePtr,(uint32_t)(uintptr_t)&UARTxHandlePtr->UARTxPtr->DR,(uint32_t)(uintptr_t)UARTxHandlePtr->txQueueBufferPtr[index],UARTxHandlePtr->txQueueLength[index]);
+	
+	/*UART request DMA whenever data register is empty*/
+	UARTxHandlePtr->UARTxPtr->CR3 |= USART_CR3_DMAT;
+}
+
+/***********************************************************************
+Private function: Give bytes written by DMA since last call to application (in 2 pieces when circular buffer wrapped)
+***********************************************************************/
+static void UART_DMA_RX_deliver(UART_Handle_t *UARTxHandlePtr, uint8_t endOfFrame)
+{
+	uint16_t readPos = UARTxHandlePtr->rxReadPos;
+	uint16_t writePos;
+	
+	if(UARTxHandlePtr->rxRingPtr == NULL){
+		return;
+	}
+	
+	writePos = UARTxHandlePtr->rxRingSize - DMA_get_remaining(UARTxHandlePtr->DMAxRxHandlePtr);
+	if(writePos >= UARTxHandlePtr->rxRingSize){
+		writePos = 0;
+	}
+	
+	if(writePos < readPos){
+		UART_DMA_RX_event_callback(UARTxHandlePtr,UARTxHandlePtr->rxRingPtr + readPos,UARTxHandlePtr->rxRingSize - readPos,FALSE);
+		readPos = 0;
+	}
+	
+	if(writePos > readPos || endOfFrame){
+		UART_DMA_RX_event_callback(UARTxHandlePtr,UARTxHandlePtr->rxRingPtr + readPos,writePos - readPos,endOfFrame);
+	}
+	
+	UARTxHandlePtr->rxReadPos = writePos;
+}
+
 /***********************************************************************
 Private function: USARTDIV 's integer part calculator
 ***********************************************************************/
@@ -0,0 +1,110 @@
+/**
+*@brief test UART DMA APIs by echoing frames between PC and STM32F4 discovery board
+*
+*Bytes typed on PC terminal are received by circular DMA, every frame (bytes followed by idle line) is copied and queued back for DMA
+*transmission with its length, so that echo is sent without busy waiting. Purpose is to test UART_receive_DMA (idle line framing) and
+*UART_send_DMA (queue of pending buffers). Green led is toggled on every sent buffer, red led is turned on when a frame is dropped
+*because transmission queue is full.
+*UART configuration:
+*	921600 baud, 8 data bits, 1 stop bit, no parity
+*	DMA1 stream 3 channel 4 (transmission), DMA1 stream 1 channel 4 (reception)
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+/*
+*@PIN_MAPPING
+*Pin mapping
+*UART3 TX	- PB10
+*UART3 RX	- PB11
+*/
+
+#include "stm32f4xx.h"                  // Device header
+#include "../Peripheral_drivers/inc/stm32f407xx_uart.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_dma.h"
+#include "../Device_drivers/inc/led.h"
+#include <stdio.h>
+#include <string.h>
+
+#define ECHO_RING_SIZE	256
+#define ECHO_MAX_FRAME	128
+
+UART_Handle_t *UART3HandlePtr;
+
+uint8_t rxRing[ECHO_RING_SIZE];
+
+/*echo buffers, slot of a buffer is only reused after UART_DMA_TX_QUEUE_SIZE buffers were queued behind it*/
+char echoBuffers[UART_DMA_TX_QUEUE_SIZE + 1][ECHO_MAX_FRAME + 16];
+uint8_t echoSlot = 0;
+uint16_t frameLength = 0;
+
+int main (void)
+{
+	led_init(GPIOD,GPIO_PIN_NO_12);
+	led_init(GPIOD,GPIO_PIN_NO_14);
+
+	UART3HandlePtr = UART_general_init(USART3,UART_pins_pack_1,UART_BDR_921600,UART_STB_1,UART_WRDLEN_8_DT_BITS,UART_TX_RX,UART_NO_PARCTRL,UART_NO_FLOWCTRL);
+
+	/*Initilize DMA streams for UART3, IDLE interrupt come from USART3 vector*/
+	UART_DMA_init(UART3HandlePtr);
+	DMA_intrpt_vector_ctr(USART3_DMA_TX_IRQ,ENABLE);
+	DMA_intrpt_vector_ctr(USART3_DMA_RX_IRQ,ENABLE);
+	UART_intrpt_vector_ctrl(IRQ_USART3,ENABLE);
+
+	UART_receive_DMA(UART3HandlePtr,rxRing,ECHO_RING_SIZE);
+
+	while(1);
+}
+
+/*called from USART3 and DMA1 stream 1 interrupts, which have same priority*/
+void UART_DMA_RX_event_callback(UART_Handle_t *UARTxHandlePtr, const uint8_t *dataPtr, uint16_t length, uint8_t endOfFrame)
+{
+	char *echoPtr = echoBuffers[echoSlot];
+	uint16_t prefixLength;
+
+	/*frame is collected after its length prefix, pieces beyond ECHO_MAX_FRAME are counted only*/
+	for(uint16_t i = 0; i < length; i++){
+		if(frameLength < ECHO_MAX_FRAME){
+			echoPtr[16 + frameLength] = dataPtr[i];
+		}
+		frameLength++;
+	}
+
+	if(!endOfFrame){
+		return;
+	}
+
+	prefixLength = sprintf(echoPtr,"%5u bytes: ",frameLength);
+	memmove(echoPtr + prefixLength,echoPtr + 16,(frameLength < ECHO_MAX_FRAME) ? frameLength : ECHO_MAX_FRAME);
+
+	if(UART_send_DMA(UARTxHandlePtr,(uint8_t*)echoPtr,prefixLength + ((frameLength < ECHO_MAX_FRAME) ? frameLength : ECHO_MAX_FRAME)) == UART_STATE_READY){
+		echoSlot = (echoSlot + 1) % (UART_DMA_TX_QUEUE_SIZE + 1);
+	}else{
+		led_on(GPIOD,GPIO_PIN_NO_14);
+	}
+
+	frameLength = 0;
+}
+
+void UART_application_event_callback (UART_Handle_t *UARTxHandlePtr,uint8_t event)
+{
+	if(event == UART_EV_DMA_TX_SENT){
+		led_toggle(GPIOD,GPIO_PIN_NO_12);
+	}
+}
+
+void USART3_IRQHandler (void)
+{
+	UART_intrpt_handler(UART3HandlePtr);
+}
+
+void DMA1_Stream3_IRQHandler (void)
+{
+	UART_DMA_TX_intrpt_handler(UART3HandlePtr);
+}
+
+void DMA1_Stream1_IRQHandler (void)
+{
+	UART_DMA_RX_intrpt_handler(UART3HandlePtr);
+}
@@ -0,0 +1,64 @@
+/**
+*@brief Print press and release events of buttons captured by EXTI interrupt
+*
+*This program initialize shoot and thrust buttons of "Return To Earth" with button_event_init, then send each event (button, press or
+*release, time since previous event in microseconds) through UART and display on PC. A bouncing button give one press and one release.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+/*
+*@PIN_MAPPING
+*Pin mapping
+*Shoot button	- PC1
+*Thrust button	- PC3
+*UART3 TX	- PB10
+*UART3 RX	- PB11
+*/
+
+#include "stm32f4xx.h"                  // Device header
+#include "../Peripheral_drivers/inc/stm32f407xx_rcc.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_uart.h"
+#include "../Device_drivers/inc/button.h"
+#include <stdio.h>
+#include <string.h>
+
+#define DEBOUNCE_TIME_US	5000
+
+UART_Handle_t *UART3HandlePtr = NULL;
+
+void EXTI1_IRQHandler (void)
+{
+	button_intrpt_handler(GPIO_PIN_NO_1);
+}
+
+void EXTI3_IRQHandler (void)
+{
+	button_intrpt_handler(GPIO_PIN_NO_3);
+}
+
+int main (void)
+{
+	Button_Event_t Event;
+	uint32_t previousTimestamp = 0;
+	uint32_t cyclesPerMicrosecond;
+	char str[80];
+
+	RCC_set_SYSCLK_PLL_84_MHz();
+	cyclesPerMicrosecond = RCC_get_SYSCLK_value()/1000000;
+
+	UART3HandlePtr = UART_general_init(USART3,UART_pins_pack_1,UART_BDR_9600,UART_STB_1,UART_WRDLEN_8_DT_BITS,UART_TX_RX,UART_NO_PARCTRL,UART_NO_FLOWCTRL);
+
+	button_event_init(GPIOC,GPIO_PIN_NO_1,GPIO_PU,DEBOUNCE_TIME_US);
+	button_event_init(GPIOC,GPIO_PIN_NO_3,GPIO_PU,DEBOUNCE_TIME_US);
+
+	while(1){
+		if(button_get_event(&Event)){
+			sprintf(str,"%s %s, %lu us after previous event\n\r",(Event.button == 0) ? "shoot" : "thrust",
+			(Event.type == BUTTON_PRESSED) ? "pressed" : "released",(unsigned long)((Event.timestamp - previousTimestamp)/cyclesPerMicrosecond));
+			UART_send(UART3HandlePtr,(uint8_t*)str,strlen(str));
+			previousTimestamp = Event.timestamp;
+		}
+	}
+}
@@ -0,0 +1,96 @@
+/**
+*@brief test STM32F4xx DAC driver DMA APIs
+*
+*This generate a 100Hz sinewave on DAC channel 1 (PA4) without CPU writing samples: TIM6 update event trigger DAC conversion
+*at 1kHz and DMA1 stream 5 feed DAC from a circular buffer holding 2 periods of sinewave. Each half of buffer is refilled
+*on half transfer and transfer complete interrupts (amplitude is toggled every second to show refilled samples are output).
+*Green led is toggled on every refill. Logic analyzer is then used to monitor the generated sinewave.
+*Purpose of this program is to confirm correctness of DAC driver DMA APIs.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+/*
+*@PIN_MAPPING
+*Pin mapping
+*DAC_channel_1 PA4
+*Green_led PD12
+*/
+
+#include "stm32f4xx.h"                  // Device header
+#include "../Peripheral_drivers/inc/stm32f407xx_gpio.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_dac.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_dma.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_timer.h"
+#include "../Device_drivers/inc/led.h"
+
+#define SAMPLE_NUM 10
+#define HALF_BUFFER_SIZE SAMPLE_NUM
+const uint16_t sineWaveTable[SAMPLE_NUM] = {2048,3251,3995,3996,3253,2051,847,101,98,839};
+
+uint16_t buffer[2*HALF_BUFFER_SIZE];
+uint16_t numOfRefills = 0;	/*100 refills per second*/
+
+extern DAC_Handle_t DACxHandle;
+
+/*copy one period of sinewave into half of buffer, full or half amplitude*/
+void refill (uint16_t *halfBufferPtr)
+{
+	uint8_t halfAmplitude = (numOfRefills++ / 100) & 0x01;
+
+	for(uint8_t i = 0; i < SAMPLE_NUM; i++){
+		if(halfAmplitude){
+			halfBufferPtr[i] = 2048 + ((int16_t)sineWaveTable[i] - 2048)/2;
+		}else{
+			halfBufferPtr[i] = sineWaveTable[i];
+		}
+	}
+}
+
+void TIM6_init(void)
+{
+	/*select reload value and prescaler so that TIM6 period is 1ms (16MHz HSI)*/
+	TIM_Config_t TIM6Config = {.reloadVal = 999,.prescaler = 15};
+	TIM_Handle_t TIM6Handle = {TIM6,&TIM6Config};
+	TIM_init(&TIM6Handle);
+}
+
+int main (void){
+	/*initilize green led on PD12*/
+	led_init(GPIOD,GPIO_PIN_NO_12);
+
+	refill(buffer);
+	refill(buffer + HALF_BUFFER_SIZE);
+
+	/*initialize DAC channel 1 on PA4, triggered by TIM6 update event, fed by DMA*/
+	DAC_init_channel(DAC_CHANNEL_1);
+	DACxHandle.DACxConfigPtr->triggerEV = DAC_TRIGGER_EV_TIM6;
+	DAC_init(&DACxHandle);
+	DAC_DMA_init(&DACxHandle);
+	DMA_intrpt_vector_ctr(DAC1_DMA_IRQ,ENABLE);
+
+	/*enable trigger TRGO on update event, no timer interrupt*/
+	TIM6_init();
+	TIM_update_event_TRGO(TIM6);
+
+	DAC_start_DMA(&DACxHandle,buffer,2*HALF_BUFFER_SIZE);
+	TIM_ctr(TIM6,START);
+
+	while(1);
+}
+
+void DMA1_Stream5_IRQHandler (void)
+{
+	uint8_t event = DAC_DMA_intrpt_handler(&DACxHandle);
+
+	if(event & DAC_EV_DMA_HALF_TRANSFER){
+		refill(buffer);
+	}
+
+	if(event & DAC_EV_DMA_TRANSFER_CMPLT){
+		refill(buffer + HALF_BUFFER_SIZE);
+	}
+
+	led_toggle(GPIOD,GPIO_PIN_NO_12);
+}
@@ -0,0 +1,192 @@
+/**
+*@brief Compare structure of arrays entity store with array of Space_Object_t structures
+*
+*This program place a number of asteroid sized objects at random position on 320x240 screen, then time 2 passes on both layouts:
+*integration (move every object by its velocity and wrap it around screen edges) and AABB pass (find objects overlapping a rocket sized area).
+*Array of structures pass work like game engine did before entity store (Q16.16 position update of every Space_Object_t), entity store pass
+*walk its Q16.16 position and velocity arrays. Number of objects is swept from 16 to 1024.
+*Cycles of both layout (measured with DWT cycle counter) and number of overlapping objects found are sent through UART and display on PC.
+*
+*@note 		Entity store capacity must be raised for 1024 objects, define ENTITY_STORE_MAX_ENTITIES=1024 in project options
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+/*
+*@PIN_MAPPING
+*Pin mapping
+*UART3 TX	- PB10
+*UART3 RX	- PB11
+*/
+
+#include "stm32f4xx.h"                  // Device header
+#include "../Peripheral_drivers/inc/stm32f407xx_rcc.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_rng.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_uart.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_dwt.h"
+#include "../Game_engine_return_to_earth/game_engine.h"
+#include "../Game_engine_return_to_earth/entity_store.h"
+#include <stdio.h>
+#include <string.h>
+
+#define SCREEN_WIDTH	320
+#define SCREEN_HEIGHT	240
+#define MAX_NUM_OF_OBJECT	1024
+#define NUM_OF_REPEAT	16
+
+#if (ENTITY_STORE_MAX_ENTITIES < MAX_NUM_OF_OBJECT)
+#error "define ENTITY_STORE_MAX_ENTITIES=1024 in project options"
+#endif
+
+UART_Handle_t *UART3HandlePtr = NULL;
+
+Space_Object_t Object[MAX_NUM_OF_OBJECT];
+entity_store store;
+uint32_t hitMask[ENTITY_STORE_MASK_WORDS];
+
+const uint16_t numOfObjectSweep[] = {16,64,256,1024};
+
+/*same object in both layouts, speed is -2 to 2 pixels per frame on each axis in quarter pixel steps (sub-pixel position is kept by both layouts)*/
+void place_random_object (uint16_t numOfObject)
+{
+	entity_store_clear(&store);
+
+	for(uint16_t i = 0;i < numOfObject;i++){
+		uint32_t random = RNG_get();
+
+		int16_t x = (random & 0x1FF) % SCREEN_WIDTH;
+		int16_t y = ((random >> 9) & 0xFF) % SCREEN_HEIGHT;
+		float dx = (int16_t)(((random >> 17) % 17) - 8) / 4.0f;
+		float dy = (int16_t)(((random >> 22) % 17) - 8) / 4.0f;
+
+		Object[i].Object_Property.x = x;
+		Object[i].Object_Property.y = y;
+		Object[i].Object_Property.xFraction = 0;
+		Object[i].Object_Property.yFraction = 0;
+		Object[i].Object_Property.dx = RTE_REAL(dx);
+		Object[i].Object_Property.dy = RTE_REAL(dy);
+		Object[i].Object_Property.aliveFlag = RTE_ALIVE_TRUE;
+		Object[i].Object_Image.imageWidth = RTE_ASTEROID_MEDIUM_BMP_W;
+		Object[i].Object_Image.imageHeight = RTE_ASTEROID_MEDIUM_BMP_H;
+
+		entity_store_add(&store,RTE_ASTEROID_SIZE_M,x,y,ENTITY_STORE_VELOCITY(dx),ENTITY_STORE_VELOCITY(dy),RTE_ASTEROID_MEDIUM_BMP_W,RTE_ASTEROID_MEDIUM_BMP_H);
+	}
+}
+
+/*position update of every live Space_Object_t (sub-pixel position is kept)*/
+void integrate_array_of_structures (uint16_t numOfObject)
+{
+	for(uint16_t i = 0;i < numOfObject;i++){
+		Object_Property_t *PropertyPtr = &Object[i].Object_Property;
+
+		if(PropertyPtr->aliveFlag != RTE_ALIVE_TRUE){
+			continue;
+		}
+
+		RTE_Real_t xPosition = PropertyPtr->xFraction + PropertyPtr->dx;
+		RTE_Real_t yPosition = PropertyPtr->yFraction + PropertyPtr->dy;
+		int16_t xStep = RTE_REAL_FLOOR(xPosition);
+		int16_t yStep = RTE_REAL_FLOOR(yPosition);
+
+		PropertyPtr->xFraction = xPosition - RTE_REAL(xStep);
+		PropertyPtr->yFraction = yPosition - RTE_REAL(yStep);
+		PropertyPtr->x += xStep;
+		PropertyPtr->y += yStep;
+
+		if(PropertyPtr->x < 0){
+			PropertyPtr->x += SCREEN_WIDTH;
+		}else if(PropertyPtr->x >= SCREEN_WIDTH){
+			PropertyPtr->x -= SCREEN_WIDTH;
+		}
+
+		if(PropertyPtr->y < 0){
+			PropertyPtr->y += SCREEN_HEIGHT;
+		}else if(PropertyPtr->y >= SCREEN_HEIGHT){
+			PropertyPtr->y -= SCREEN_HEIGHT;
+		}
+	}
+}
+
+/*check whether span a and span b overlap on a wrapping axis (both start inside screen)*/
+uint8_t span_overlap (int16_t a, uint16_t aLength, int16_t b, uint16_t bLength, uint16_t size)
+{
+	int32_t distance = b - a;
+
+	if(distance < 0){
+		distance += size;
+	}
+
+	return (distance < aLength || distance > size - bLength);
+}
+
+/*count live Space_Object_t overlapping given area*/
+uint16_t overlap_array_of_structures (uint16_t numOfObject, int16_t x, int16_t y, uint16_t width, uint16_t height)
+{
+	uint16_t numOfHit = 0;
+
+	for(uint16_t i = 0;i < numOfObject;i++){
+		if(Object[i].Object_Property.aliveFlag == RTE_ALIVE_TRUE
+			&& span_overlap(Object[i].Object_Property.x,Object[i].Object_Image.imageWidth,x,width,SCREEN_WIDTH)
+			&& span_overlap(Object[i].Object_Property.y,Object[i].Object_Image.imageHeight,y,height,SCREEN_HEIGHT)){
+			numOfHit++;
+		}
+	}
+
+	return numOfHit;
+}
+
+int main (void)
+{
+	uint32_t start, aosIntegrateCycles, soaIntegrateCycles, aosOverlapCycles, soaOverlapCycles;
+	uint32_t aosHits, soaHits;
+	char str[120];
+
+	RCC_set_SYSCLK_PLL_84_MHz();
+
+	UART3HandlePtr = UART_general_init(USART3,UART_pins_pack_1,UART_BDR_9600,UART_STB_1,UART_WRDLEN_8_DT_BITS,UART_TX_RX,UART_NO_PARCTRL,UART_NO_FLOWCTRL);
+
+	RNG_init();
+	DWT_cycle_counter_ctr(ENABLE);
+
+	for(uint8_t sweep = 0;sweep < sizeof(numOfObjectSweep)/sizeof(numOfObjectSweep[0]);sweep++){
+		uint16_t numOfObject = numOfObjectSweep[sweep];
+
+		entity_store_init(&store,numOfObject,SCREEN_WIDTH,SCREEN_HEIGHT);
+		place_random_object(numOfObject);
+
+		aosIntegrateCycles = soaIntegrateCycles = aosOverlapCycles = soaOverlapCycles = 0;
+		aosHits = soaHits = 0;
+
+		for(uint8_t repeat = 0;repeat < NUM_OF_REPEAT;repeat++){
+			start = DWT_CYCLE_COUNT;
+			integrate_array_of_structures(numOfObject);
+			aosIntegrateCycles += DWT_get_elapsed_cycles(start);
+
+			start = DWT_CYCLE_COUNT;
+			entity_store_integrate(&store);
+			soaIntegrateCycles += DWT_get_elapsed_cycles(start);
+
+			/*rocket sized area at random position, both layouts hold same positions so hit counts must match*/
+			uint32_t random = RNG_get();
+			int16_t x = (random & 0x1FF) % SCREEN_WIDTH;
+			int16_t y = ((random >> 9) & 0xFF) % SCREEN_HEIGHT;
+
+			start = DWT_CYCLE_COUNT;
+			aosHits += overlap_array_of_structures(numOfObject,x,y,RTE_ROCKET_BMP_W1,RTE_ROCKET_BMP_H1);
+			aosOverlapCycles += DWT_get_elapsed_cycles(start);
+
+			start = DWT_CYCLE_COUNT;
+			soaHits += entity_store_overlap_mask(&store,x,y,RTE_ROCKET_BMP_W1,RTE_ROCKET_BMP_H1,hitMask);
+			soaOverlapCycles += DWT_get_elapsed_cycles(start);
+		}
+
+		sprintf(str,"%u objects: integrate AoS %lu SoA %lu cycles, AABB AoS %lu SoA %lu cycles, hits %lu/%lu\n\r",numOfObject,
+		(unsigned long)(aosIntegrateCycles/NUM_OF_REPEAT),(unsigned long)(soaIntegrateCycles/NUM_OF_REPEAT),
+		(unsigned long)(aosOverlapCycles/NUM_OF_REPEAT),(unsigned long)(soaOverlapCycles/NUM_OF_REPEAT),
+		(unsigned long)aosHits,(unsigned long)soaHits);
+		UART_send(UART3HandlePtr,(uint8_t*)str,strlen(str));
+	}
+
+	while(1);
+}
@@ -0,0 +1,148 @@
+/**
+*@brief test I2C transaction queue (DMA base) by polling a sensor and an EEPROM on I2C1 without waiting for bus
+*
+*This program queue a register read of a sensor (MPU-6050 at address 0x68: WHO_AM_I then 14 bytes of measurements, write then read with
+*repeated start) and a read of 16 bytes of an EEPROM (24C32 at address 0x50: 2 bytes memory address, stop then start before read) every
+*time main loop counter wrap, while main loop keep counting. Purpose is to test I2C_queue_transaction: transactions are run by DMA and
+*I2C event/error interrupts, callbacks report results. Green led is toggled on every successful transaction, red led is turned on when
+*a device does not acknowledge, orange led is toggled when arbitration is lost (transaction is queued again from callback).
+*I2C configuration:
+*	SCL = 400KHz (Fast mode)
+*	DMA1 stream 7 channel 1 (transmission), DMA1 stream 0 channel 1 (reception)
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+/*
+*@PIN_MAPPING
+*Pin mapping
+*Green led PD12
+*Orange led PD13
+*Red led PD14
+*I2C1_SCL PB6
+*I2C1_SDA PB7
+*/
+
+#include "stm32f4xx.h"                  // Device header
+#include "../Peripheral_drivers/inc/stm32f407xx_gpio.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_i2c.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_dma.h"
+#include "../Device_drivers/inc/led.h"
+
+#define SENSOR_ADDRESS	0x68
+#define EEPROM_ADDRESS	0x50
+
+I2C_Handle_t I2C1Handle;
+I2C_Config_t I2C1Config = {.SCLspeed = I2C_FSCL_FM,.ACKctr = I2C_ACKctr_ENABLE,.deviceAddress = 0x33,.FMdutyCycle = I2C_FMduty_2};
+
+const uint8_t whoAmIRegister = 0x75;
+const uint8_t measurementRegister = 0x3B;
+const uint8_t eepromAddress[2] = {0x00, 0x00};
+uint8_t whoAmI = 0;
+uint8_t measurements[14];
+uint8_t eepromData[16];
+
+I2C_Transaction_t WhoAmIRead, MeasurementRead, EepromRead;
+
+volatile uint32_t numOfDone = 0;
+volatile uint32_t loopCounter = 0;
+
+void I2C1_GPIO_pin_init (void)
+{
+	GPIO_Pin_config_t GPIO_I2C_pin_config = {.mode = GPIO_MODE_ALTFN,.speed = GPIO_OUTPUT_HIGH_SPEED,.outType = GPIO_OUTPUT_TYPE_OD,.puPdr = GPIO_PU,.altFunc = 4};
+	GPIO_Handle_t GPIO_I2C_pin_handle;
+	GPIO_I2C_pin_handle.GPIOxPtr = GPIOB;
+
+	/*SCL*/
+	GPIO_I2C_pin_config.pinNumber = GPIO_PIN_NO_6;
+	GPIO_I2C_pin_handle.GPIO_Pin_config = GPIO_I2C_pin_config;
+	GPIO_init(&GPIO_I2C_pin_handle);
+
+	/*SDA*/
+	GPIO_I2C_pin_config.pinNumber = GPIO_PIN_NO_7;
+	GPIO_I2C_pin_handle.GPIO_Pin_config = GPIO_I2C_pin_config;
+	GPIO_init(&GPIO_I2C_pin_handle);
+}
+
+/*called from I2C1 and DMA1 interrupts*/
+void transaction_done (I2C_Transaction_t *TransactionPtr, uint8_t result)
+{
+	if(result == I2C_TRANSACTION_OK){
+		led_toggle(GPIOD,GPIO_PIN_NO_12);
+		numOfDone++;
+	}else if(result == I2C_TRANSACTION_ARLO){
+		led_toggle(GPIOD,GPIO_PIN_NO_13);
+		I2C_queue_transaction(&I2C1Handle,TransactionPtr);
+	}else{
+		led_on(GPIOD,GPIO_PIN_NO_14);
+	}
+}
+
+void set_transaction (I2C_Transaction_t *TransactionPtr, uint8_t slaveAddr, const uint8_t *txBufferPtr, uint16_t txLength,
+uint8_t *rxBufferPtr, uint16_t rxLength, uint8_t repeatedStart)
+{
+	TransactionPtr->slaveAddr = slaveAddr;
+	TransactionPtr->txBufferPtr = txBufferPtr;
+	TransactionPtr->txLength = txLength;
+	TransactionPtr->rxBufferPtr = rxBufferPtr;
+	TransactionPtr->rxLength = rxLength;
+	TransactionPtr->repeatedStart = repeatedStart;
+	TransactionPtr->callback = transaction_done;
+	TransactionPtr->contextPtr = NULL;
+}
+
+int main (void)
+{
+	led_init(GPIOD,GPIO_PIN_NO_12);
+	led_init(GPIOD,GPIO_PIN_NO_13);
+	led_init(GPIOD,GPIO_PIN_NO_14);
+
+	/*initilize I2C1 on PB6:PB7 with its DMA streams*/
+	I2C1_GPIO_pin_init();
+	I2C1Handle.I2CxPtr = I2C1;
+	I2C1Handle.I2CxConfigPtr = &I2C1Config;
+	I2C_init(&I2C1Handle);
+	I2C_DMA_init(&I2C1Handle);
+	I2C_periph_ctr(I2C1,ENABLE);
+
+	/*enable I2C1 event, I2C1 error and DMA interrupt vectors in NVIC*/
+	I2C_intrpt_ctrl(IRQ_I2C1_EV,ENABLE);
+	I2C_intrpt_ctrl(IRQ_I2C1_ER,ENABLE);
+	DMA_intrpt_vector_ctr(I2C1_DMA_TX_IRQ,ENABLE);
+	DMA_intrpt_vector_ctr(I2C1_DMA_RX_IRQ,ENABLE);
+
+	set_transaction(&WhoAmIRead,SENSOR_ADDRESS,&whoAmIRegister,1,&whoAmI,1,I2C_REPEATED_START_ENABLE);
+	set_transaction(&MeasurementRead,SENSOR_ADDRESS,&measurementRegister,1,measurements,sizeof(measurements),I2C_REPEATED_START_ENABLE);
+	set_transaction(&EepromRead,EEPROM_ADDRESS,eepromAddress,sizeof(eepromAddress),eepromData,sizeof(eepromData),I2C_REPEATED_START_DISABLE);
+
+	while(1){
+		/*queue is only filled again when previous transactions finished, so that their buffers are not read while being written*/
+		if(!(loopCounter & 0xFFFF) && !I2C_queue_busy_check(&I2C1Handle)){
+			I2C_queue_transaction(&I2C1Handle,&WhoAmIRead);
+			I2C_queue_transaction(&I2C1Handle,&MeasurementRead);
+			I2C_queue_transaction(&I2C1Handle,&EepromRead);
+		}
+		loopCounter++;
+	}
+}
+
+void I2C1_EV_IRQHandler(void)
+{
+	I2C_event_intrpt_handler(&I2C1Handle);
+}
+
+void I2C1_ER_IRQHandler(void)
+{
+	I2C_err_intrpt_handler(&I2C1Handle);
+}
+
+void DMA1_Stream7_IRQHandler (void)
+{
+	I2C_DMA_TX_intrpt_handler(&I2C1Handle);
+}
+
+void DMA1_Stream0_IRQHandler (void)
+{
+	I2C_DMA_RX_intrpt_handler(&I2C1Handle);
+}
@@ -52,27 +52,30 @@ int main (void){
 	
 	while(1){
 		if (ADCOutFlag == SET){
-			joystick_init(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7);
+			uint16_t xPos, yPos;
 			uint8_t jsDir = joystick_read_direction(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7);
 			
+			/*position is read through joystick driver, ADC_read would break scan of joystick driver built with JOYSTICK_USE_DMA*/
+			joystick_read_position(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7,&xPos,&yPos);
+			
 			if(jsDir == JS_DIR_LEFT_UP){
-				sprintf(str,"Direction: left up X:%d Y:%d\n\r",ADC_read(ADC1,ADC_CHANNEL_5),ADC_read(ADC1,ADC_CHANNEL_7));
+				sprintf(str,"Direction: left up X:%d Y:%d\n\r",xPos,yPos);
 			}else if (jsDir == JS_DIR_LEFT_DOWN){
-				sprintf(str,"Direction: left down X:%d Y:%d\n\r",ADC_read(ADC1,ADC_CHANNEL_5),ADC_read(ADC1,ADC_CHANNEL_7));
+				sprintf(str,"Direction: left down X:%d Y:%d\n\r",xPos,yPos);
 			}else if (jsDir == JS_DIR_LEFT){
-				sprintf(str,"Direction: left X:%d Y:%d\n\r",ADC_read(ADC1,ADC_CHANNEL_5),ADC_read(ADC1,ADC_CHANNEL_7));
+				sprintf(str,"Direction: left X:%d Y:%d\n\r",xPos,yPos);
 			}else if (jsDir == JS_DIR_RIGHT_DOWN){
-				sprintf(str,"Direction: right down X:%d Y:%d\n\r",ADC_read(ADC1,ADC_CHANNEL_5),ADC_read(ADC1,ADC_CHANNEL_7));
+				sprintf(str,"Direction: right down X:%d Y:%d\n\r",xPos,yPos);
 			}else if (jsDir == JS_DIR_RIGHT_UP){
-				sprintf(str,"Direction: right up X:%d Y:%d\n\r",ADC_read(ADC1,ADC_CHANNEL_5),ADC_read(ADC1,ADC_CHANNEL_7));
+				sprintf(str,"Direction: right up X:%d Y:%d\n\r",xPos,yPos);
 			}else if (jsDir == JS_DIR_RIGHT){
-				sprintf(str,"Direction: right X:%d Y:%d\n\r",ADC_read(ADC1,ADC_CHANNEL_5),ADC_read(ADC1,ADC_CHANNEL_7));
+				sprintf(str,"Direction: right X:%d Y:%d\n\r",xPos,yPos);
 			}else if (jsDir == JS_DIR_UP){
-				sprintf(str,"Direction: up X:%d Y:%d\n\r",ADC_read(ADC1,ADC_CHANNEL_5),ADC_read(ADC1,ADC_CHANNEL_7));
+				sprintf(str,"Direction: up X:%d Y:%d\n\r",xPos,yPos);
 			}else if (jsDir == JS_DIR_DOWN){
-				sprintf(str,"Direction: down X:%d Y:%d\n\r",ADC_read(ADC1,ADC_CHANNEL_5),ADC_read(ADC1,ADC_CHANNEL_7));
+				sprintf(str,"Direction: down X:%d Y:%d\n\r",xPos,yPos);
 			}else if (jsDir == JS_DIR_CENTERED){
-				sprintf(str,"Direction: centered X:%d Y:%d\n\r",ADC_read(ADC1,ADC_CHANNEL_5),ADC_read(ADC1,ADC_CHANNEL_7));
+				sprintf(str,"Direction: centered X:%d Y:%d\n\r",xPos,yPos);
 			}
 			
 			UART_send_intrpt(UART2HandlePtr,(uint8_t*)&str,strlen(str));
@@ -0,0 +1,70 @@
+/**
+*@brief Measure CPU cycles spent reading joystick per frame, with conversions polled and with conversions read from DMA buffer
+*
+*This program read joystick direction NUM_OF_READS times with 2 conversions started and polled with ADC_read (as joystick driver
+*without JOYSTICK_USE_DMA does), then with joystick driver reading scans written by DMA. Cycles per read (measured with DWT cycle
+*counter, polled figure count conversions only, DMA figure count whole joystick_read_direction) and cycles saved per frame are sent
+*through UART and display on PC.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+/*
+*@PIN_MAPPING
+*Pin mapping
+*Joystick x axis (ADC1 channel 5)	- PA5
+*Joystick y axis (ADC1 channel 7)	- PA7
+*UART3 TX	- PB10
+*UART3 RX	- PB11
+*/
+
+#include "stm32f4xx.h"                  // Device header
+#include "../Peripheral_drivers/inc/stm32f407xx_rcc.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_uart.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_dwt.h"
+#include "../Device_drivers/inc/joystick.h"
+#include <stdio.h>
+#include <string.h>
+
+#define NUM_OF_READS	1024
+
+UART_Handle_t *UART3HandlePtr = NULL;
+volatile uint16_t position;
+
+int main (void)
+{
+	uint32_t start, polledCycles = 0, DMACycles = 0;
+	char str[120];
+
+	RCC_set_SYSCLK_PLL_84_MHz();
+
+	UART3HandlePtr = UART_general_init(USART3,UART_pins_pack_1,UART_BDR_9600,UART_STB_1,UART_WRDLEN_8_DT_BITS,UART_TX_RX,UART_NO_PARCTRL,UART_NO_FLOWCTRL);
+	DWT_cycle_counter_ctr(ENABLE);
+
+	/*single conversions polled (sampling time at reset value, 3 cycles)*/
+	ADC_init_channel(ADC1,ADC_CHANNEL_5);
+	ADC_init_channel(ADC1,ADC_CHANNEL_7);
+
+	for(uint16_t i = 0; i < NUM_OF_READS; i++){
+		start = DWT_CYCLE_COUNT;
+		position = ADC_read(ADC1,ADC_CHANNEL_5);
+		position = ADC_read(ADC1,ADC_CHANNEL_7);
+		polledCycles += DWT_get_elapsed_cycles(start);
+	}
+
+	/*scans written by DMA*/
+	joystick_init(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7);
+
+	for(uint16_t i = 0; i < NUM_OF_READS; i++){
+		start = DWT_CYCLE_COUNT;
+		position = joystick_read_direction(ADC1,ADC_CHANNEL_5,ADC_CHANNEL_7);
+		DMACycles += DWT_get_elapsed_cycles(start);
+	}
+
+	sprintf(str,"polled: %lu cycles per frame, DMA: %lu cycles per frame, %lu cycles saved per frame\n\r",
+	(unsigned long)(polledCycles/NUM_OF_READS),(unsigned long)(DMACycles/NUM_OF_READS),(unsigned long)((polledCycles - DMACycles)/NUM_OF_READS));
+	UART_send(UART3HandlePtr,(uint8_t*)str,strlen(str));
+
+	while(1);
+}
@@ -0,0 +1,128 @@
+/**
+*@brief Measure CPU cycles spent in "Return To Earth" game engine update functions
+*
+*This program create player spaceship, a full wave of asteroids and rockets, then call RTE_update_* functions for a number of frames.
+*Cycles of each call are measured with DWT cycle counter, average and maximum are sent through UART and display on PC.
+*Build once with RTE_FIXED_POINT_PHYSICS defined (Q16.16) and once with it commented out (float) in game_engine.h to compare both modes.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+/*
+*@PIN_MAPPING
+*Pin mapping
+*UART3 TX	- PB10
+*UART3 RX	- PB11
+*/
+
+#include "stm32f4xx.h"                  // Device header
+#include "../Peripheral_drivers/inc/stm32f407xx_uart.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_dwt.h"
+#include "../Game_engine_return_to_earth/game_engine.h"
+#include <stdio.h>
+#include <string.h>
+
+#define NUM_OF_FRAME	1000
+#define NUM_OF_ASTEROID	5
+
+#ifdef RTE_FIXED_POINT_PHYSICS
+#define PHYSICS_MODE	"Q16.16"
+#else
+#define PHYSICS_MODE	"float"
+#endif
+
+extern Space_Object_t PlayerSpaceship;
+
+extern entity_store AsteroidStore;
+extern entity_store RocketStore;
+extern uint8_t rocketLifeSpan[RTE_ROCKET_BUFFER_SIZE];
+
+UART_Handle_t *UART3HandlePtr = NULL;
+
+typedef struct{
+	uint32_t total;
+	uint32_t max;
+}Cycle_Stat_t;
+
+void add_sample (Cycle_Stat_t *StatPtr, uint32_t cycles)
+{
+	StatPtr->total += cycles;
+	if(cycles > StatPtr->max){
+		StatPtr->max = cycles;
+	}
+}
+
+void print_stat (const char *name, Cycle_Stat_t *StatPtr)
+{
+	char str[80];
+	sprintf(str,"%s: avg %lu max %lu cycles\n\r",name,(unsigned long)(StatPtr->total/NUM_OF_FRAME),(unsigned long)StatPtr->max);
+	UART_send(UART3HandlePtr,(uint8_t*)str,strlen(str));
+}
+
+/*keep rockets flying during whole benchmark (same speed and size as rocket fired to the north)*/
+void refill_rocket (void)
+{
+	uint16_t index = 0;
+
+	while((index = entity_store_add(&RocketStore,RTE_HEADING_DIR_N,PlayerSpaceship.Object_Property.x,PlayerSpaceship.Object_Property.y,
+	0,ENTITY_STORE_VELOCITY(-RTE_ROCKET_BASE_SPEED),RTE_ROCKET_BMP_W1,RTE_ROCKET_BMP_H1)) != ENTITY_STORE_NONE){
+		rocketLifeSpan[index] = RTE_ROCKET_LIFESPAN;
+	}
+}
+
+int main (void)
+{
+	Cycle_Stat_t PlayerStat = {0,0};
+	Cycle_Stat_t RocketStat = {0,0};
+	Cycle_Stat_t AsteroidStat = {0,0};
+	uint32_t start;
+	char str[50];
+
+	RTE_init();
+
+	UART3HandlePtr = UART_general_init(USART3,UART_pins_pack_1,UART_BDR_9600,UART_STB_1,UART_WRDLEN_8_DT_BITS,UART_TX_RX,UART_NO_PARCTRL,UART_NO_FLOWCTRL);
+
+	DWT_cycle_counter_ctr(ENABLE);
+
+	RTE_seed_random(RNG_get());
+	RTE_create_player_spaceship(&PlayerSpaceship);
+	RTE_create_asteroid(&AsteroidStore,NUM_OF_ASTEROID,&PlayerSpaceship);
+	RNG_deinit();
+
+	for(uint16_t frame = 0;frame < NUM_OF_FRAME;frame++){
+
+		/*player must stay alive and moving, refill rockets which hit asteroid or ran out of life span*/
+		PlayerSpaceship.Object_Property.aliveFlag = RTE_ALIVE_TRUE;
+		PlayerSpaceship.Object_Property.dx = RTE_REAL(RTE_PLAYER_MAX_SPEED);
+		refill_rocket();
+
+		start = DWT_CYCLE_COUNT;
+		RTE_update_player_spaceship(&PlayerSpaceship);
+		add_sample(&PlayerStat,DWT_get_elapsed_cycles(start));
+
+		start = DWT_CYCLE_COUNT;
+		RTE_update_rocket(&RocketStore,&AsteroidStore);
+		add_sample(&RocketStat,DWT_get_elapsed_cycles(start));
+
+		start = DWT_CYCLE_COUNT;
+		RTE_update_asteroid(&AsteroidStore,&PlayerSpaceship);
+		add_sample(&AsteroidStat,DWT_get_elapsed_cycles(start));
+
+		/*start new wave when all asteroids are destroyed*/
+		if(AsteroidStore.total == 0){
+			RNG_init();
+			RTE_seed_random(RNG_get());
+			RTE_create_asteroid(&AsteroidStore,NUM_OF_ASTEROID,&PlayerSpaceship);
+			RNG_deinit();
+		}
+	}
+
+	sprintf(str,"Physics mode %s, %d frames\n\r",PHYSICS_MODE,NUM_OF_FRAME);
+	UART_send(UART3HandlePtr,(uint8_t*)str,strlen(str));
+	print_stat("RTE_update_player_spaceship",&PlayerStat);
+	print_stat("RTE_update_rocket",&RocketStat);
+	print_stat("RTE_update_asteroid",&AsteroidStat);
+
+	while(1);
+}
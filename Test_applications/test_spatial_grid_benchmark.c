@@ -0,0 +1,146 @@
+/**
+*@brief Compare spatial grid collision detection with brute force pairwise AABB check
+*
+*This program place a number of asteroid and rocket sized rectangles at random position on 320x240 screen, then find all overlapping pairs
+*by checking every pair (brute force) and by checking only pairs sharing a grid cell. Number of objects is swept from 15 to 1000.
+*Cycles of both method (measured with DWT cycle counter) and number of overlapping pairs found are sent through UART and display on PC.
+*
+*@note 		Grid capacity must be raised for 1000 objects, define SPATIAL_GRID_MAX_IDS=1024 and SPATIAL_GRID_MAX_ENTRIES=4096 in project options
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+/*
+*@PIN_MAPPING
+*Pin mapping
+*UART3 TX	- PB10
+*UART3 RX	- PB11
+*/
+
+#include "stm32f4xx.h"                  // Device header
+#include "../Peripheral_drivers/inc/stm32f407xx_rcc.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_rng.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_uart.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_dwt.h"
+#include "../Game_engine_return_to_earth/spatial_grid.h"
+#include <stdio.h>
+#include <string.h>
+
+#define SCREEN_WIDTH	320
+#define SCREEN_HEIGHT	240
+#define MAX_NUM_OF_OBJECT	1000
+
+#if (SPATIAL_GRID_MAX_IDS < MAX_NUM_OF_OBJECT)
+#error "define SPATIAL_GRID_MAX_IDS=1024 and SPATIAL_GRID_MAX_ENTRIES=4096 in project options"
+#endif
+
+typedef struct{
+	int16_t x;
+	int16_t y;
+	uint16_t width;
+	uint16_t height;
+}Rect_t;
+
+UART_Handle_t *UART3HandlePtr = NULL;
+
+Rect_t Object[MAX_NUM_OF_OBJECT];
+uint16_t queryResult[MAX_NUM_OF_OBJECT];
+spatial_grid grid;
+
+const uint16_t numOfObjectSweep[] = {15,50,100,250,500,1000};
+
+/*1 large asteroid out of 7 objects, other are medium asteroids and rockets*/
+void place_random_object (uint16_t numOfObject)
+{
+	for(uint16_t i = 0;i < numOfObject;i++){
+		uint32_t random = RNG_get();
+
+		Object[i].x = (random & 0x1FF) % SCREEN_WIDTH;
+		Object[i].y = ((random >> 9) & 0xFF) % SCREEN_HEIGHT;
+
+		if(i % 7 == 0){
+			Object[i].width = 50;
+			Object[i].height = 42;
+		}else if(random & (1 << 20)){
+			Object[i].width = 27;
+			Object[i].height = 25;
+		}else{
+			Object[i].width = 13;
+			Object[i].height = 22;
+		}
+	}
+}
+
+uint32_t count_pairs_brute_force (uint16_t numOfObject)
+{
+	uint32_t numOfPair = 0;
+
+	for(uint16_t i = 0;i < numOfObject;i++){
+		for(uint16_t j = i + 1;j < numOfObject;j++){
+			numOfPair += spatial_grid_overlap(&grid,Object[i].x,Object[i].y,Object[i].width,Object[i].height,
+			Object[j].x,Object[j].y,Object[j].width,Object[j].height);
+		}
+	}
+
+	return numOfPair;
+}
+
+uint32_t count_pairs_grid (uint16_t numOfObject)
+{
+	uint32_t numOfPair = 0;
+
+	spatial_grid_clear(&grid);
+
+	for(uint16_t i = 0;i < numOfObject;i++){
+		spatial_grid_insert(&grid,i,Object[i].x,Object[i].y,Object[i].width,Object[i].height);
+	}
+
+	for(uint16_t i = 0;i < numOfObject;i++){
+		uint16_t numOfCandidate = spatial_grid_query(&grid,Object[i].x,Object[i].y,Object[i].width,Object[i].height,queryResult,MAX_NUM_OF_OBJECT);
+
+		for(uint16_t k = 0;k < numOfCandidate;k++){
+			uint16_t j = queryResult[k];
+
+			if(j > i){
+				numOfPair += spatial_grid_overlap(&grid,Object[i].x,Object[i].y,Object[i].width,Object[i].height,
+				Object[j].x,Object[j].y,Object[j].width,Object[j].height);
+			}
+		}
+	}
+
+	return numOfPair;
+}
+
+int main (void)
+{
+	uint32_t start, bruteForceCycles, gridCycles, bruteForcePairs, gridPairs;
+	char str[100];
+
+	RCC_set_SYSCLK_PLL_84_MHz();
+
+	UART3HandlePtr = UART_general_init(USART3,UART_pins_pack_1,UART_BDR_9600,UART_STB_1,UART_WRDLEN_8_DT_BITS,UART_TX_RX,UART_NO_PARCTRL,UART_NO_FLOWCTRL);
+
+	RNG_init();
+	DWT_cycle_counter_ctr(ENABLE);
+	spatial_grid_init(&grid,SCREEN_WIDTH,SCREEN_HEIGHT);
+
+	for(uint8_t sweep = 0;sweep < sizeof(numOfObjectSweep)/sizeof(numOfObjectSweep[0]);sweep++){
+
+		place_random_object(numOfObjectSweep[sweep]);
+
+		start = DWT_CYCLE_COUNT;
+		bruteForcePairs = count_pairs_brute_force(numOfObjectSweep[sweep]);
+		bruteForceCycles = DWT_get_elapsed_cycles(start);
+
+		start = DWT_CYCLE_COUNT;
+		gridPairs = count_pairs_grid(numOfObjectSweep[sweep]);
+		gridCycles = DWT_get_elapsed_cycles(start);
+
+		sprintf(str,"%u objects: brute force %lu cycles, grid %lu cycles, pairs %lu/%lu\n\r",numOfObjectSweep[sweep],
+		(unsigned long)bruteForceCycles,(unsigned long)gridCycles,(unsigned long)bruteForcePairs,(unsigned long)gridPairs);
+		UART_send(UART3HandlePtr,(uint8_t*)str,strlen(str));
+	}
+
+	while(1);
+}
@@ -26,7 +26,7 @@ int main (void)
 	{
 		if(button_read(GPIOA,GPIO_PIN_NO_0)){
 			led_on(GPIOD,GPIO_PIN_NO_12);
-			speaker_play_sound(rocket_launch,(sizeof(rocket_launch)/sizeof(rocket_launch[0])));
+			speaker_play_ADPCM_voice(&rocket_launch,SPEAKER_VOLUME_FULL,0,SPEAKER_PLAY_ONCE);
 		}else{
 			led_off(GPIOD,GPIO_PIN_NO_12);
 		}
@@ -0,0 +1,79 @@
+/**
+*@brief Measure cost of speaker mixer per output sample
+*
+*This program mix blocks of 1 to SPEAKER_NUM_OF_VOICES looping voices (sound effects of "Return To Earth", IMA ADPCM sounds
+*decoded while mixed) with speaker_mix_block,
+*as timer interrupt of speaker driver does every SPEAKER_BLOCK_SIZE samples. Cycles per output sample (measured with DWT cycle counter)
+*are sent through UART and display on PC. Timer of speaker is not started, only mixing is timed.
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+/*
+*@PIN_MAPPING
+*Pin mapping
+*UART3 TX	- PB10
+*UART3 RX	- PB11
+*/
+
+#include "stm32f4xx.h"                  // Device header
+#include "../Peripheral_drivers/inc/stm32f407xx_rcc.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_uart.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_dwt.h"
+#include "../Device_drivers/inc/speaker.h"
+#include "../Miscellaneous/inc/asteroid_large_explode.h"
+#include "../Miscellaneous/inc/spaceship_accelerate.h"
+#include <stdio.h>
+#include <string.h>
+
+#define NUM_OF_BLOCKS	256
+
+UART_Handle_t *UART3HandlePtr = NULL;
+
+uint16_t block[SPEAKER_BLOCK_SIZE];
+
+/*short sound effects are used in turn*/
+void play_voice (uint8_t voice)
+{
+	if(voice & 0x01){
+		speaker_play_ADPCM_voice(&asteroid_large_explode,SPEAKER_VOLUME_HALF,0,SPEAKER_PLAY_LOOP);
+	}else{
+		speaker_play_ADPCM_voice(&spaceship_accelerate,SPEAKER_VOLUME_HALF,0,SPEAKER_PLAY_LOOP);
+	}
+}
+
+int main (void)
+{
+	uint32_t start, cycles;
+	char str[100];
+
+	RCC_set_SYSCLK_PLL_84_MHz();
+
+	UART3HandlePtr = UART_general_init(USART3,UART_pins_pack_1,UART_BDR_9600,UART_STB_1,UART_WRDLEN_8_DT_BITS,UART_TX_RX,UART_NO_PARCTRL,UART_NO_FLOWCTRL);
+
+	speaker_init(DAC_CHANNEL_1,9,679);
+	DWT_cycle_counter_ctr(ENABLE);
+
+	for(uint8_t numOfVoices = 1; numOfVoices <= SPEAKER_NUM_OF_VOICES; numOfVoices++){
+
+		play_voice(numOfVoices - 1);
+
+		/*playing voice start speaker timer, mixing is timed alone*/
+		TIM_ctr(SPEAKER_TIMER,STOP);
+
+		cycles = 0;
+
+		for(uint16_t i = 0; i < NUM_OF_BLOCKS; i++){
+			start = DWT_CYCLE_COUNT;
+			speaker_mix_block(block,SPEAKER_BLOCK_SIZE);
+			cycles += DWT_get_elapsed_cycles(start);
+		}
+
+		sprintf(str,"%u voices: %lu cycles per block of %u samples, %lu cycles per sample\n\r",numOfVoices,
+		(unsigned long)(cycles/NUM_OF_BLOCKS),SPEAKER_BLOCK_SIZE,(unsigned long)(cycles/((uint32_t)NUM_OF_BLOCKS*SPEAKER_BLOCK_SIZE)));
+		UART_send(UART3HandlePtr,(uint8_t*)str,strlen(str));
+	}
+
+	while(1);
+}
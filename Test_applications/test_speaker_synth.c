@@ -0,0 +1,73 @@
+/**
+*@file test_speaker_synth.c
+*@brief test synthesizer notes of speaker driver by playing a part of "Small World"
+*
+*This program play the part of "Small World" played by test_buzzer.c with speaker_play_note (see synth.h and speaker.h for details).
+*Notes are rendered while they are mixed by speaker driver, so main loop is never blocked: next note is started when voice of
+*previous one is freed and LED on PD12 follow user button all along. Button select waveform of melody (sine when released, square when pressed).
+*The frequency of piano notes used in this is defined in "notes.h".
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "stm32f4xx.h"                  // Device header
+#include "../Peripheral_drivers/inc/stm32f407xx_gpio.h"
+#include "../Peripheral_drivers/inc/stm32f407xx_rcc.h"
+#include "../Device_drivers/inc/led.h"
+#include "../Device_drivers/inc/button.h"
+#include "../Device_drivers/inc/speaker.h"
+#include "../Miscellaneous/inc/notes.h"
+
+typedef struct{
+	uint32_t frequency;
+	uint32_t duration;
+}Melody_Note_t;
+
+/*notes are released 30 ms before their end so that consecutive notes are heard apart*/
+const Synth_Instrument_t flute = {SYNTH_WAVE_SINE,20,60,200,30};
+const Synth_Instrument_t chip = {SYNTH_WAVE_SQUARE,5,40,160,30};
+
+const Melody_Note_t melody[] = {
+	{noteG5,HN+QN},{noteG5,QN},{noteB5,HN},{noteG5,HN},{noteA5,HN+QN},{noteA5,QN},{noteA5,HN+QN},{Rest,QN},
+	{noteA5,HN+QN},{noteA5,QN},{noteC6,HN},{noteA5,HN},{noteB5,HN+QN},{noteB5,QN},{noteB5,HN+QN},{Rest,QN},
+	{noteB5,HN+QN},{noteB5,QN},{noteD6,HN},{noteB5,HN},{noteC6,HN+QN},{noteC6,QN},{noteC6,HN},{noteB5,QN},
+	{noteA5,QN},{noteD5,WN},{noteFs5,WN},{noteG5,WN},
+};
+
+int main (void)
+{
+	uint8_t noteIndex = 0;
+	const Synth_Instrument_t *InstrumentPtr = &flute;
+
+	RCC_set_SYSCLK_PLL_84_MHz();
+
+	/*initilize led on PD12*/
+	led_init(GPIOD,GPIO_PIN_NO_12);
+
+	/*initilize user button on PA0*/
+	button_init(GPIOA,GPIO_PIN_NO_0,GPIO_NO_PUPDR);
+
+	speaker_init(DAC_CHANNEL_1,9,679);
+
+	while(1){
+		if(button_read(GPIOA,GPIO_PIN_NO_0)){
+			led_on(GPIOD,GPIO_PIN_NO_12);
+		}else{
+			led_off(GPIOD,GPIO_PIN_NO_12);
+		}
+
+		/*previous note has faded out, start next one (rest is a silent note so that it last its duration too)*/
+		if(speaker_find_voice(&flute) == SPEAKER_NO_VOICE && speaker_find_voice(&chip) == SPEAKER_NO_VOICE){
+			InstrumentPtr = button_read(GPIOA,GPIO_PIN_NO_0) ? &chip : &flute;
+
+			if(melody[noteIndex].frequency == Rest){
+				speaker_play_note(InstrumentPtr,noteA4,melody[noteIndex].duration - 30,0,0);
+			}else{
+				speaker_play_note(InstrumentPtr,melody[noteIndex].frequency,melody[noteIndex].duration - 30,SPEAKER_VOLUME_HALF,0);
+			}
+
+			noteIndex = (noteIndex + 1) % (sizeof(melody)/sizeof(melody[0]));
+		}
+	}
+}
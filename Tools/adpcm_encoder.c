@@ -0,0 +1,471 @@
+/**
+*@brief Encode sound into IMA ADPCM header file of "Return To Earth" sound assets
+*
+*This program read a sound from WAV file (PCM, 8 or 16 bits, mono or stereo) or from header file holding 12 bits samples
+*(const uint16_t array, previous format of sound assets), encode it with IMA ADPCM (Miscellaneous/src/adpcm.c) and write header
+*file defining ADPCM_Sound_t played with speaker_play_ADPCM_voice. 12 bits samples are scaled to 16 bits before encoding
+*(speaker driver scale decoded samples back to 12 bits).
+*Sound may be stored at lower sample rate than input (option -r) to save flash: it is resampled offline with windowed sinc filter
+*(low-pass below half of lower rate, so that downsampling does not alias) and speaker driver resample it back to its output rate
+*with linear interpolation. Sample rate is stored in sound asset.
+*Sound is decoded again and compared with input: flash used by 16 bits samples and ADPCM codes and signal to noise ratio
+*of round trip (in 12 bits DAC range, resampled back to input rate like speaker driver does) are printed. With option -c, flash
+*and round trip SNR of sound stored at each given rate are reported, so that rate of each asset can be chosen.
+*Sample rate of input is read from WAV file, header file is at sample rate of speaker (6176Hz with speaker_init(DAC_CHANNEL_1,9,679)
+*and RCC_set_SYSCLK_PLL_84_MHz, refer to speaker_get_sample_rate) unless option -s is given. Sound should not be stored above
+*sample rate of speaker, speaker driver does not filter when it drop samples.
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 Tools/adpcm_encoder.c Miscellaneous/src/adpcm.c -lm -o adpcm_encoder
+*
+*Run:
+*adpcm_encoder [-s <input rate>] [-r <stored rate>] [-c <rate>,<rate>...] <input.wav | input.h> <sound name> [output.h]
+*e.g. adpcm_encoder rocket_launch.wav rocket_launch Miscellaneous/inc/rocket_launch.h
+*     adpcm_encoder -c 6176,5000,4000,3000 rocket_launch.wav rocket_launch
+*     adpcm_encoder -r 4000 rocket_launch.wav rocket_launch Miscellaneous/inc/rocket_launch.h
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../Miscellaneous/inc/adpcm.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define SAMPLE_MIDPOINT		2048
+#define SAMPLE_MAX			4095
+#define SAMPLE_SCALE_SHIFT	4		/*12 bits samples to 16 bits samples*/
+#define BYTES_PER_LINE		32
+#define SPEAKER_RATE		6176	/*default rate of header file input*/
+#define MAX_RATE			65535	/*sampleRate of ADPCM_Sound_t is 16 bits*/
+#define MAX_COMPARED_RATES	16
+#define FILTER_ZERO_CROSSINGS	8	/*half length of windowed sinc filter in zero crossings*/
+#define PI					3.14159265358979323846
+
+/*samples read from input file (12 bits)*/
+uint16_t *samplePtr = NULL;
+uint32_t numOfSamples = 0;
+uint32_t sampleCapacity = 0;
+uint32_t inputRate = 0;
+
+void add_sample (uint16_t sample)
+{
+	if(numOfSamples == sampleCapacity){
+		sampleCapacity = sampleCapacity ? 2*sampleCapacity : 65536;
+		samplePtr = realloc(samplePtr,sampleCapacity*sizeof(uint16_t));
+
+		if(samplePtr == NULL){
+			fprintf(stderr,"out of memory\n");
+			exit(1);
+		}
+	}
+
+	samplePtr[numOfSamples++] = sample;
+}
+
+uint32_t read_le (const uint8_t *bytePtr, uint8_t numOfBytes)
+{
+	uint32_t value = 0;
+
+	for(uint8_t i = 0; i < numOfBytes; i++){
+		value |= (uint32_t)bytePtr[i] << (8*i);
+	}
+
+	return value;
+}
+
+/*read PCM WAV file, channels are averaged, return 0 on error*/
+uint8_t read_wav (FILE *filePtr)
+{
+	uint8_t header[12], chunk[8], format[16];
+	uint16_t numOfChannels = 0, bitsPerSample = 0;
+	uint32_t sampleRate = 0;
+
+	if(fread(header,1,12,filePtr) != 12 || memcmp(header,"RIFF",4) || memcmp(header + 8,"WAVE",4)){
+		fprintf(stderr,"not a WAV file\n");
+		return 0;
+	}
+
+	while(fread(chunk,1,8,filePtr) == 8){
+		uint32_t chunkSize = read_le(chunk + 4,4);
+
+		if(!memcmp(chunk,"fmt ",4)){
+			if(chunkSize < 16 || fread(format,1,16,filePtr) != 16){
+				fprintf(stderr,"bad fmt chunk\n");
+				return 0;
+			}
+
+			numOfChannels = read_le(format + 2,2);
+			sampleRate = read_le(format + 4,4);
+			bitsPerSample = read_le(format + 14,2);
+
+			if(read_le(format,2) != 1 || (bitsPerSample != 8 && bitsPerSample != 16) || numOfChannels == 0){
+				fprintf(stderr,"only 8 or 16 bits PCM WAV file is supported\n");
+				return 0;
+			}
+
+			fseek(filePtr,chunkSize - 16 + (chunkSize & 1),SEEK_CUR);
+		}else if(!memcmp(chunk,"data",4)){
+			uint16_t frameSize = numOfChannels*bitsPerSample/8;
+			uint8_t frame[32];
+
+			if(frameSize == 0 || frameSize > sizeof(frame)){
+				fprintf(stderr,"data chunk before fmt chunk or too many channels\n");
+				return 0;
+			}
+
+			for(uint32_t i = 0; i < chunkSize/frameSize; i++){
+				int32_t sum = 0;
+
+				if(fread(frame,1,frameSize,filePtr) != frameSize){
+					break;
+				}
+
+				for(uint16_t channel = 0; channel < numOfChannels; channel++){
+					if(bitsPerSample == 8){
+						sum += ((int32_t)frame[channel] - 128) << 8;
+					}else{
+						sum += (int16_t)read_le(frame + 2*channel,2);
+					}
+				}
+
+				add_sample((uint16_t)((sum/numOfChannels + 32768) >> SAMPLE_SCALE_SHIFT));
+			}
+
+			printf("WAV file: %u Hz, %u bits, %u channels\n",sampleRate,bitsPerSample,numOfChannels);
+			if(!inputRate){
+				inputRate = sampleRate;
+			}
+			return 1;
+		}else{
+			fseek(filePtr,chunkSize + (chunkSize & 1),SEEK_CUR);
+		}
+	}
+
+	fprintf(stderr,"no data chunk\n");
+	return 0;
+}
+
+/*read numbers between braces of const uint16_t array, return 0 on error*/
+uint8_t read_header (FILE *filePtr)
+{
+	int character;
+	long value;
+	uint32_t numOfClippedSamples = 0;
+
+	while((character = fgetc(filePtr)) != EOF && character != '{');
+
+	while(fscanf(filePtr," %ld",&value) == 1){
+		/*DAC keep 12 low bits only, out of range sample is clipped instead of wrapping around*/
+		if(value < 0){
+			value = 0;
+			numOfClippedSamples++;
+		}else if(value > SAMPLE_MAX){
+			value = SAMPLE_MAX;
+			numOfClippedSamples++;
+		}
+
+		add_sample((uint16_t)value);
+
+		character = 0;
+		if(fscanf(filePtr," %c",(char*)&character) != 1 || character != ','){
+			break;
+		}
+	}
+
+	if(numOfClippedSamples){
+		printf("%u samples out of 12 bits range are clipped\n",numOfClippedSamples);
+	}
+
+	return numOfSamples ? 1 : 0;
+}
+
+int16_t scale_sample (uint16_t sample)
+{
+	return (int16_t)(((int32_t)sample - SAMPLE_MIDPOINT) << SAMPLE_SCALE_SHIFT);
+}
+
+/*resample 12 bits samples with windowed sinc filter (Blackman window), cutoff is below half of lower rate, return number of samples*/
+uint32_t resample_sound (const uint16_t *inputPtr, uint32_t numOfInputs, uint32_t fromRate, uint32_t toRate, uint16_t **outputPtr)
+{
+	uint32_t numOfOutputs = (uint32_t)(((uint64_t)(numOfInputs - 1)*toRate)/fromRate) + 1;
+	double cutoff = 0.5*0.95*((toRate < fromRate) ? (double)toRate/fromRate : 1.0);	/*cycles per input sample*/
+	double halfLength = FILTER_ZERO_CROSSINGS/(2*cutoff);	/*input samples*/
+
+	*outputPtr = malloc(numOfOutputs*sizeof(uint16_t));
+	if(*outputPtr == NULL){
+		fprintf(stderr,"out of memory\n");
+		exit(1);
+	}
+
+	if(fromRate == toRate){
+		memcpy(*outputPtr,inputPtr,numOfInputs*sizeof(uint16_t));
+		return numOfInputs;
+	}
+
+	for(uint32_t i = 0; i < numOfOutputs; i++){
+		double time = (double)i*fromRate/toRate;
+		double sum = 0, weightSum = 0, sample;
+		int64_t first = (int64_t)ceil(time - halfLength), last = (int64_t)floor(time + halfLength);
+
+		for(int64_t k = (first < 0) ? 0 : first; k <= last && k < numOfInputs; k++){
+			double distance = k - time;
+			double window = 0.42 + 0.5*cos(PI*distance/halfLength) + 0.08*cos(2*PI*distance/halfLength);
+			double weight = (distance == 0) ? 2*cutoff : sin(2*PI*cutoff*distance)/(PI*distance);
+
+			weight *= window;
+			sum += weight*((double)inputPtr[k] - SAMPLE_MIDPOINT);
+			weightSum += weight;
+		}
+
+		/*weights are normalized so that gain is 1 at edges of sound too*/
+		sample = SAMPLE_MIDPOINT + ((weightSum != 0) ? sum/weightSum : 0);
+		sample = (sample < 0) ? 0 : (sample > SAMPLE_MAX) ? SAMPLE_MAX : sample;
+		(*outputPtr)[i] = (uint16_t)lround(sample);
+	}
+
+	return numOfOutputs;
+}
+
+/*encode 12 bits samples, return ADPCM codes (2 samples per byte)*/
+uint8_t* encode_sound (const uint16_t *soundPtr, uint32_t numOfSoundSamples, ADPCM_State_t *initialStatePtr)
+{
+	uint8_t *dataPtr = calloc((numOfSoundSamples + 1)/2,1);
+	ADPCM_State_t state;
+
+	if(dataPtr == NULL){
+		fprintf(stderr,"out of memory\n");
+		exit(1);
+	}
+
+	/*decoder start from first sample, so sound does not start with a step from silence*/
+	initialStatePtr->predictor = scale_sample(soundPtr[0]);
+	initialStatePtr->stepIndex = 0;
+	state = *initialStatePtr;
+
+	for(uint32_t i = 0; i < numOfSoundSamples; i++){
+		dataPtr[i >> 1] |= adpcm_encode_sample(&state,scale_sample(soundPtr[i])) << ((i & 1) ? 4 : 0);
+	}
+
+	return dataPtr;
+}
+
+/*decode sound stored at given rate and compare it with input in 12 bits range, return SNR in dB (INFINITY when lossless)*/
+double round_trip_snr (const uint8_t *dataPtr, uint32_t numOfSoundSamples, ADPCM_State_t initialState, uint32_t soundRate)
+{
+	double *decodedPtr = malloc((numOfSoundSamples + 1)*sizeof(double));
+	double signal = 0, noise = 0;
+	ADPCM_State_t state = initialState;
+
+	if(decodedPtr == NULL){
+		fprintf(stderr,"out of memory\n");
+		exit(1);
+	}
+
+	for(uint32_t i = 0; i < numOfSoundSamples; i++){
+		int16_t decoded;
+
+		adpcm_decode_block(&state,dataPtr,i,&decoded,1);
+		decodedPtr[i] = (decoded >> SAMPLE_SCALE_SHIFT) + SAMPLE_MIDPOINT;
+	}
+
+	/*speaker driver interpolate toward silence after last sample of sound played once*/
+	decodedPtr[numOfSoundSamples] = SAMPLE_MIDPOINT;
+
+	/*linear interpolation back to input rate, as speaker driver does*/
+	for(uint32_t i = 0; i < numOfSamples; i++){
+		double time = (double)i*soundRate/inputRate;
+		uint32_t k = (uint32_t)time;
+		double error, output;
+
+		if(k >= numOfSoundSamples){
+			k = numOfSoundSamples - 1;
+			time = k;
+		}
+
+		output = decodedPtr[k] + (decodedPtr[k + 1] - decodedPtr[k])*(time - k);
+		error = output - samplePtr[i];
+		signal += ((double)samplePtr[i] - SAMPLE_MIDPOINT)*((double)samplePtr[i] - SAMPLE_MIDPOINT);
+		noise += error*error;
+	}
+
+	free(decodedPtr);
+
+	return (noise > 0) ? 10*log10(signal/noise) : INFINITY;
+}
+
+/*report flash and round trip SNR of sound stored at each rate*/
+void compare_rates (const char *namePtr, const uint32_t *ratePtr, uint8_t numOfRates)
+{
+	uint32_t inputBytes = (numOfSamples + 1)/2;
+
+	printf("%s at %u Hz: %u samples, ADPCM %u bytes\n",namePtr,inputRate,numOfSamples,inputBytes);
+	printf("%10s %10s %12s %12s %10s\n","rate (Hz)","samples","ADPCM bytes","saved bytes","SNR (dB)");
+
+	for(uint8_t i = 0; i < numOfRates; i++){
+		uint16_t *soundPtr;
+		uint32_t numOfSoundSamples = resample_sound(samplePtr,numOfSamples,inputRate,ratePtr[i],&soundPtr);
+		ADPCM_State_t initialState;
+		uint8_t *dataPtr = encode_sound(soundPtr,numOfSoundSamples,&initialState);
+		uint32_t numOfBytes = (numOfSoundSamples + 1)/2;
+
+		printf("%10u %10u %12u %12d %10.1f\n",ratePtr[i],numOfSoundSamples,numOfBytes,(int32_t)inputBytes - (int32_t)numOfBytes,
+				round_trip_snr(dataPtr,numOfSoundSamples,initialState,ratePtr[i]));
+
+		free(dataPtr);
+		free(soundPtr);
+	}
+}
+
+/*parse sample rate of option, return 0 if it is not valid*/
+uint32_t parse_rate (const char *textPtr, char **endPtr)
+{
+	unsigned long rate = strtoul(textPtr,endPtr,10);
+
+	if(*endPtr == textPtr || rate < 1000 || rate > MAX_RATE){
+		fprintf(stderr,"sample rate must be 1000 Hz to %u Hz\n",MAX_RATE);
+		return 0;
+	}
+
+	return (uint32_t)rate;
+}
+
+void print_usage (const char *programPtr)
+{
+	fprintf(stderr,"usage: %s [-s <input rate>] [-r <stored rate>] [-c <rate>,<rate>...] <input.wav | input.h> <sound name> [output.h]\n",programPtr);
+}
+
+int main (int argc, char *argv[])
+{
+	FILE *filePtr;
+	uint8_t *dataPtr;
+	uint16_t *soundPtr;
+	uint32_t numOfBytes, numOfSoundSamples, soundRate = 0, comparedRate[MAX_COMPARED_RATES];
+	uint8_t numOfComparedRates = 0;
+	ADPCM_State_t initialState;
+	const char *inputPtr, *namePtr, *outputPtr;
+	double snr;
+	uint8_t ok;
+	int argument = 1;
+	char *endPtr;
+
+	for(; argument < argc - 1 && argv[argument][0] == '-'; argument += 2){
+		if(!strcmp(argv[argument],"-s")){
+			inputRate = parse_rate(argv[argument + 1],&endPtr);
+			if(!inputRate){
+				return 1;
+			}
+		}else if(!strcmp(argv[argument],"-r")){
+			soundRate = parse_rate(argv[argument + 1],&endPtr);
+			if(!soundRate){
+				return 1;
+			}
+		}else if(!strcmp(argv[argument],"-c")){
+			const char *textPtr = argv[argument + 1];
+
+			do{
+				if(numOfComparedRates == MAX_COMPARED_RATES){
+					fprintf(stderr,"up to %u rates are compared\n",MAX_COMPARED_RATES);
+					return 1;
+				}
+
+				comparedRate[numOfComparedRates] = parse_rate(textPtr,&endPtr);
+				if(!comparedRate[numOfComparedRates++]){
+					return 1;
+				}
+				textPtr = endPtr + 1;
+			}while(*endPtr == ',');
+		}else{
+			print_usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if(argc - argument != 3 && !(argc - argument == 2 && numOfComparedRates)){
+		print_usage(argv[0]);
+		return 1;
+	}
+
+	inputPtr = argv[argument];
+	namePtr = argv[argument + 1];
+	outputPtr = (argc - argument == 3) ? argv[argument + 2] : NULL;
+
+	filePtr = fopen(inputPtr,"rb");
+	if(filePtr == NULL){
+		fprintf(stderr,"can not open %s\n",inputPtr);
+		return 1;
+	}
+
+	if(strlen(inputPtr) > 2 && !strcmp(inputPtr + strlen(inputPtr) - 2,".h")){
+		ok = read_header(filePtr);
+		if(!inputRate){
+			inputRate = SPEAKER_RATE;
+		}
+	}else{
+		ok = read_wav(filePtr);
+	}
+	fclose(filePtr);
+
+	if(!ok || numOfSamples == 0){
+		fprintf(stderr,"no sample read from %s\n",inputPtr);
+		return 1;
+	}
+
+	if(inputRate > MAX_RATE && outputPtr != NULL && !soundRate){
+		fprintf(stderr,"input sample rate is above %u Hz, give stored rate with -r\n",MAX_RATE);
+		return 1;
+	}
+
+	if(numOfComparedRates){
+		compare_rates(namePtr,comparedRate,numOfComparedRates);
+	}
+
+	if(outputPtr == NULL){
+		free(samplePtr);
+		return 0;
+	}
+
+	if(!soundRate){
+		soundRate = inputRate;
+	}
+
+	numOfSoundSamples = resample_sound(samplePtr,numOfSamples,inputRate,soundRate,&soundPtr);
+	dataPtr = encode_sound(soundPtr,numOfSoundSamples,&initialState);
+	numOfBytes = (numOfSoundSamples + 1)/2;
+	snr = round_trip_snr(dataPtr,numOfSoundSamples,initialState,soundRate);
+
+	filePtr = fopen(outputPtr,"w");
+	if(filePtr == NULL){
+		fprintf(stderr,"can not open %s\n",outputPtr);
+		return 1;
+	}
+
+	fprintf(filePtr,"/*IMA ADPCM sound, %u samples at %u Hz, generated by Tools/adpcm_encoder.c*/\n",numOfSoundSamples,soundRate);
+	fprintf(filePtr,"#include \"adpcm.h\"\n\n");
+	fprintf(filePtr,"const uint8_t %s_data[] = {",namePtr);
+
+	for(uint32_t i = 0; i < numOfBytes; i++){
+		fprintf(filePtr,"%s0x%02X,",(i % BYTES_PER_LINE) ? "" : "\n",dataPtr[i]);
+	}
+
+	fprintf(filePtr,"\n};\n\n");
+	fprintf(filePtr,"const ADPCM_Sound_t %s = {%s_data,%u,{%d,%u},%u};\n",namePtr,namePtr,numOfSoundSamples,initialState.predictor,initialState.stepIndex,soundRate);
+	fclose(filePtr);
+
+	printf("%s: %u samples at %u Hz, 16 bits samples at %u Hz %u bytes, ADPCM %u bytes (%.2fx smaller)",namePtr,numOfSoundSamples,soundRate,
+			inputRate,2*numOfSamples,numOfBytes,(double)2*numOfSamples/numOfBytes);
+
+	if(isfinite(snr)){
+		printf(", round trip SNR %.1f dB\n",snr);
+	}else{
+		printf(", round trip lossless\n");
+	}
+
+	free(dataPtr);
+	free(soundPtr);
+	free(samplePtr);
+
+	return 0;
+}
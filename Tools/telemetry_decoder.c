@@ -0,0 +1,164 @@
+/**
+*@brief Decode telemetry stream of "Return To Earth" into live statistics and CSV file
+*
+*This program read telemetry stream (see Game_engine_return_to_earth/telemetry.h) from a file captured from game console UART3
+*(RTE_SEND_TELEMETRY in return_to_earth.c), from serial port device or from standard input, and decode packets as they arrive with
+*same reader as game engine (Game_engine_return_to_earth/telemetry.c). Every <interval> packets a line of statistics is printed:
+*longest update, draw and collision time and average SPI bytes per frame over the interval, live asteroids and rockets, audio underruns,
+*packets missing (gap in frame numbers: dropped by console or lost on line) and corrupted packets (bad COBS framing or CRC).
+*With option -c every packet is also written as a line of CSV file. Cycles are converted to microseconds at CPU clock given by option -f
+*(clock profile RTE_CLOCK_PROFILE in game_engine.h, 168MHz by default). Serial port must already be set to baud rate of game (e.g. stty -F /dev/ttyUSB0 115200 raw).
+*
+*Build on PC from repository root:
+*gcc -O2 -std=gnu99 Tools/telemetry_decoder.c Game_engine_return_to_earth/telemetry.c Miscellaneous/src/byte_pack.c -o telemetry_decoder
+*
+*Run:
+*telemetry_decoder [-f <CPU clock in MHz>] [-i <packets per line>] [-c <output.csv>] [<stream file | serial port>]
+*e.g. telemetry_decoder -c session.csv /dev/ttyUSB0
+*     rte_headless -t telemetry.bin 3000 1 && telemetry_decoder -i 75 telemetry.bin
+*
+*@author Tran Thanh Nhan
+*@date 17/10/2026
+*/
+
+#include "../Game_engine_return_to_earth/telemetry.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DEFAULT_CPU_CLOCK_MHZ	168.0
+#define DEFAULT_INTERVAL		8	/*about 1 second at 30 frames/s and 4 frames per packet*/
+
+/*statistics of packets since last printed line*/
+typedef struct{
+	uint32_t numOfPackets;
+	uint32_t numOfFrames;
+	uint32_t updateCycles;	/*longest*/
+	uint32_t drawCycles;
+	uint32_t collisionCycles;
+	uint64_t SPIbytes;	/*sum*/
+}Interval_Stats_t;
+
+double cyclesPerMicrosecond = DEFAULT_CPU_CLOCK_MHZ;
+uint32_t numOfMissing = 0;
+
+void add_packet (Interval_Stats_t *StatsPtr, const telemetry_frame *FramePtr)
+{
+	if(FramePtr->updateCycles > StatsPtr->updateCycles){
+		StatsPtr->updateCycles = FramePtr->updateCycles;
+	}
+	if(FramePtr->drawCycles > StatsPtr->drawCycles){
+		StatsPtr->drawCycles = FramePtr->drawCycles;
+	}
+	if(FramePtr->collisionCycles > StatsPtr->collisionCycles){
+		StatsPtr->collisionCycles = FramePtr->collisionCycles;
+	}
+
+	StatsPtr->SPIbytes += FramePtr->SPIbytes;
+	StatsPtr->numOfFrames += FramePtr->numOfFrames;
+	StatsPtr->numOfPackets++;
+}
+
+void print_stats (const Interval_Stats_t *StatsPtr, const telemetry_frame *LastPtr, const telemetry_reader *ReaderPtr)
+{
+	printf("frame %8lu | max update %8.1f us, draw %8.1f us, collision %7.1f us | SPI %7.0f B/frame | asteroids %3u, rockets %3u | "
+	"underruns %5u | missing %lu, corrupted %lu\n",(unsigned long)LastPtr->frameNumber,StatsPtr->updateCycles/cyclesPerMicrosecond,
+	StatsPtr->drawCycles/cyclesPerMicrosecond,StatsPtr->collisionCycles/cyclesPerMicrosecond,
+	StatsPtr->numOfFrames ? (double)StatsPtr->SPIbytes/StatsPtr->numOfFrames : 0.0,LastPtr->numOfAsteroids,LastPtr->numOfRockets,
+	LastPtr->audioUnderruns,(unsigned long)numOfMissing,(unsigned long)ReaderPtr->numOfErrors);
+	fflush(stdout);
+}
+
+int main (int argc, char *argv[])
+{
+	FILE *inputPtr = stdin;
+	FILE *csvPtr = NULL;
+	uint32_t interval = DEFAULT_INTERVAL;
+	telemetry_reader Reader;
+	telemetry_frame Frame, Last;
+	Interval_Stats_t Stats;
+	uint8_t firstFlag = 1;
+	int byte;
+
+	while(argc > 2 && argv[1][0] == '-'){
+		if(!strcmp(argv[1],"-f")){
+			cyclesPerMicrosecond = strtod(argv[2],NULL);
+		}else if(!strcmp(argv[1],"-i")){
+			interval = strtoul(argv[2],NULL,0);
+		}else if(!strcmp(argv[1],"-c")){
+			csvPtr = fopen(argv[2],"w");
+			if(csvPtr == NULL){
+				fprintf(stderr,"Can not create %s\n",argv[2]);
+				return 1;
+			}
+		}else{
+			break;
+		}
+		argc -= 2;
+		argv += 2;
+	}
+
+	if(argc > 2 || (argc == 2 && argv[1][0] == '-') || cyclesPerMicrosecond <= 0 || interval == 0){
+		fprintf(stderr,"Usage: %s [-f <CPU clock in MHz>] [-i <packets per line>] [-c <output.csv>] [<stream file | serial port>]\n",argv[0]);
+		return 1;
+	}
+
+	if(argc == 2){
+		inputPtr = fopen(argv[1],"rb");
+		if(inputPtr == NULL){
+			fprintf(stderr,"Can not open %s\n",argv[1]);
+			return 1;
+		}
+	}
+
+	if(csvPtr){
+		fprintf(csvPtr,"frame,frames,update_cycles,draw_cycles,collision_cycles,spi_bytes,asteroids,rockets,audio_underruns\n");
+	}
+
+	telemetry_reader_init(&Reader);
+	memset(&Stats,0,sizeof(Stats));
+	memset(&Last,0,sizeof(Last));
+
+	while((byte = fgetc(inputPtr)) != EOF){
+		if(telemetry_read_byte(&Reader,(uint8_t)byte,&Frame) != TELEMETRY_PACKET){
+			continue;
+		}
+
+		/*frame number of packet is its last frame*/
+		if(!firstFlag && Frame.frameNumber - Last.frameNumber > Frame.numOfFrames){
+			numOfMissing += (Frame.frameNumber - Last.frameNumber - Frame.numOfFrames)/Frame.numOfFrames;
+		}
+		firstFlag = 0;
+		Last = Frame;
+
+		if(csvPtr){
+			fprintf(csvPtr,"%lu,%u,%lu,%lu,%lu,%lu,%u,%u,%u\n",(unsigned long)Frame.frameNumber,Frame.numOfFrames,
+			(unsigned long)Frame.updateCycles,(unsigned long)Frame.drawCycles,(unsigned long)Frame.collisionCycles,
+			(unsigned long)Frame.SPIbytes,Frame.numOfAsteroids,Frame.numOfRockets,Frame.audioUnderruns);
+		}
+
+		add_packet(&Stats,&Frame);
+
+		if(Stats.numOfPackets >= interval){
+			print_stats(&Stats,&Last,&Reader);
+			memset(&Stats,0,sizeof(Stats));
+		}
+	}
+
+	if(Stats.numOfPackets){
+		print_stats(&Stats,&Last,&Reader);
+	}
+
+	printf("Packets: %lu, missing: %lu, corrupted: %lu\n",(unsigned long)Reader.numOfPackets,(unsigned long)numOfMissing,
+	(unsigned long)Reader.numOfErrors);
+
+	if(csvPtr){
+		fclose(csvPtr);
+	}
+
+	if(inputPtr != stdin){
+		fclose(inputPtr);
+	}
+
+	return 0;
+}